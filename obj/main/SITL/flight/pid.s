@@ -0,0 +1,21933 @@
+	.file	"pid.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/build/debug.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/common/axis.h"
+	.file 8 "./src/main/common/filter.h"
+	.file 9 "./src/main/common/maths.h"
+	.file 10 "./src/main/drivers/io_types.h"
+	.file 11 "./src/main/drivers/adc.h"
+	.file 12 "./src/main/fc/controlrate_profile.h"
+	.file 13 "./src/main/fc/rc_controls.h"
+	.file 14 "./src/main/fc/rc_modes.h"
+	.file 15 "./src/main/fc/runtime_config.h"
+	.file 16 "./src/main/flight/pid.h"
+	.file 17 "./src/main/common/vector.h"
+	.file 18 "./src/main/flight/imu.h"
+	.file 19 "./src/main/flight/mixer.h"
+	.file 20 "./src/main/drivers/resource.h"
+	.file 21 "./src/main/drivers/bus.h"
+	.file 22 "./src/main/sensors/gyro.h"
+	.file 23 "./src/main/navigation/navigation.h"
+	.file 24 "./src/main/sensors/sensors.h"
+	.file 25 "./src/main/common/calibration.h"
+	.file 26 "./src/main/drivers/pitotmeter.h"
+	.file 27 "./src/main/sensors/pitotmeter.h"
+	.file 28 "./src/main/common/global_functions.h"
+	.file 29 "./src/main/flight/pid.c"
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 31 "./src/main/flight/kalman.h"
+	.file 32 "./src/main/rx/rx.h"
+	.file 33 "./src/main/fc/config.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	pid.c.8eb1f31d
+	.weak	pid.c.8eb1f31d
+pid.c.8eb1f31d:
+	.long	0x2bc3
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2c
+	.long	.LASF2512
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x16
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1707
+	.uleb128 0x16
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1708
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1709
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1710
+	.uleb128 0x5
+	.long	.LASF1712
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x16
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1711
+	.uleb128 0x5
+	.long	.LASF1713
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.long	.LASF1714
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0x16
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1715
+	.uleb128 0x5
+	.long	.LASF1716
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x5
+	.long	.LASF1717
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x2d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x12
+	.long	0x88
+	.uleb128 0x5
+	.long	.LASF1718
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1719
+	.uleb128 0x5
+	.long	.LASF1720
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x2e
+	.byte	0x8
+	.uleb128 0x16
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1721
+	.uleb128 0x5
+	.long	.LASF1722
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF1723
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x5
+	.long	.LASF1724
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x12
+	.long	0xd4
+	.uleb128 0x5
+	.long	.LASF1725
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x5
+	.long	.LASF1726
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x12
+	.long	0xf1
+	.uleb128 0x5
+	.long	.LASF1727
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x94
+	.uleb128 0x12
+	.long	0x102
+	.uleb128 0x5
+	.long	.LASF1728
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa7
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1729
+	.uleb128 0x12
+	.long	0x11f
+	.uleb128 0x16
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1730
+	.uleb128 0x13
+	.long	0xd4
+	.long	0x142
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1731
+	.byte	0x4
+	.byte	0x17
+	.byte	0x10
+	.long	0x132
+	.uleb128 0xc
+	.long	.LASF1732
+	.byte	0x4
+	.byte	0x18
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0x5
+	.long	.LASF1733
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xf1
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.byte	0xe
+	.long	0x195
+	.uleb128 0xb
+	.long	.LASF1734
+	.value	0xfff
+	.uleb128 0xb
+	.long	.LASF1735
+	.value	0xf000
+	.uleb128 0xb
+	.long	.LASF1736
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1738
+	.value	0x8000
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1739
+	.byte	0x5
+	.byte	0x2a
+	.byte	0xf
+	.long	0x1a1
+	.uleb128 0x23
+	.long	0x1ac
+	.uleb128 0x4
+	.long	0xb3
+	.byte	0
+	.uleb128 0x22
+	.byte	0x8
+	.byte	0x5
+	.byte	0x32
+	.byte	0x5
+	.long	0x1cd
+	.uleb128 0x1d
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x33
+	.byte	0xf
+	.long	0xb3
+	.uleb128 0x1d
+	.string	"fn"
+	.byte	0x5
+	.byte	0x34
+	.byte	0x16
+	.long	0x1cd
+	.byte	0
+	.uleb128 0x8
+	.long	0x195
+	.uleb128 0xe
+	.long	.LASF1778
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2c
+	.long	0x22d
+	.uleb128 0x7
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xb
+	.long	0x15a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1740
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0xf1
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1741
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x22d
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1742
+	.byte	0x5
+	.byte	0x30
+	.byte	0xe
+	.long	0x22d
+	.byte	0x10
+	.uleb128 0x7
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x31
+	.byte	0xf
+	.long	0x232
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1743
+	.byte	0x5
+	.byte	0x35
+	.byte	0x7
+	.long	0x1ac
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.long	0xe5
+	.uleb128 0x8
+	.long	0x22d
+	.uleb128 0x5
+	.long	.LASF1744
+	.byte	0x5
+	.byte	0x36
+	.byte	0x3
+	.long	0x1d2
+	.uleb128 0x12
+	.long	0x237
+	.uleb128 0x5
+	.long	.LASF1745
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x11
+	.long	0xd4
+	.uleb128 0x5
+	.long	.LASF1746
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x12
+	.long	0x102
+	.uleb128 0x5
+	.long	.LASF1747
+	.byte	0x6
+	.byte	0x21
+	.byte	0x12
+	.long	0x113
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x4
+	.byte	0x33
+	.byte	0xe
+	.long	0x315
+	.uleb128 0x1
+	.long	.LASF1748
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1749
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1752
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1754
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1756
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1757
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1758
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1759
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1760
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1761
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1762
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1763
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1764
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1765
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1766
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1769
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1770
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0x19
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x7
+	.byte	0x1d
+	.byte	0xe
+	.long	0x334
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1775
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1776
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1777
+	.byte	0x7
+	.byte	0x21
+	.byte	0x3
+	.long	0x315
+	.uleb128 0x12
+	.long	0x334
+	.uleb128 0xe
+	.long	.LASF1779
+	.byte	0x4
+	.byte	0x8
+	.byte	0x16
+	.long	0x35f
+	.uleb128 0x2
+	.long	.LASF1780
+	.byte	0x8
+	.byte	0x17
+	.byte	0xb
+	.long	0x11f
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1781
+	.byte	0x8
+	.byte	0x18
+	.byte	0x3
+	.long	0x345
+	.uleb128 0xe
+	.long	.LASF1782
+	.byte	0xc
+	.byte	0x8
+	.byte	0x1a
+	.long	0x39d
+	.uleb128 0x2
+	.long	.LASF1780
+	.byte	0x8
+	.byte	0x1b
+	.byte	0xb
+	.long	0x11f
+	.byte	0
+	.uleb128 0x7
+	.string	"RC"
+	.byte	0x8
+	.byte	0x1c
+	.byte	0xb
+	.long	0x11f
+	.byte	0x4
+	.uleb128 0x7
+	.string	"dT"
+	.byte	0x8
+	.byte	0x1d
+	.byte	0xb
+	.long	0x11f
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1783
+	.byte	0x8
+	.byte	0x1e
+	.byte	0x3
+	.long	0x36b
+	.uleb128 0xe
+	.long	.LASF1784
+	.byte	0x24
+	.byte	0x8
+	.byte	0x21
+	.long	0x422
+	.uleb128 0x7
+	.string	"b0"
+	.byte	0x8
+	.byte	0x22
+	.byte	0xb
+	.long	0x11f
+	.byte	0
+	.uleb128 0x7
+	.string	"b1"
+	.byte	0x8
+	.byte	0x22
+	.byte	0xf
+	.long	0x11f
+	.byte	0x4
+	.uleb128 0x7
+	.string	"b2"
+	.byte	0x8
+	.byte	0x22
+	.byte	0x13
+	.long	0x11f
+	.byte	0x8
+	.uleb128 0x7
+	.string	"a1"
+	.byte	0x8
+	.byte	0x22
+	.byte	0x17
+	.long	0x11f
+	.byte	0xc
+	.uleb128 0x7
+	.string	"a2"
+	.byte	0x8
+	.byte	0x22
+	.byte	0x1b
+	.long	0x11f
+	.byte	0x10
+	.uleb128 0x7
+	.string	"x1"
+	.byte	0x8
+	.byte	0x23
+	.byte	0xb
+	.long	0x11f
+	.byte	0x14
+	.uleb128 0x7
+	.string	"x2"
+	.byte	0x8
+	.byte	0x23
+	.byte	0xf
+	.long	0x11f
+	.byte	0x18
+	.uleb128 0x7
+	.string	"y1"
+	.byte	0x8
+	.byte	0x23
+	.byte	0x13
+	.long	0x11f
+	.byte	0x1c
+	.uleb128 0x7
+	.string	"y2"
+	.byte	0x8
+	.byte	0x23
+	.byte	0x17
+	.long	0x11f
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1785
+	.byte	0x8
+	.byte	0x24
+	.byte	0x3
+	.long	0x3a9
+	.uleb128 0x22
+	.byte	0x24
+	.byte	0x8
+	.byte	0x26
+	.byte	0x9
+	.long	0x450
+	.uleb128 0x27
+	.long	.LASF1786
+	.byte	0x8
+	.byte	0x27
+	.byte	0x14
+	.long	0x422
+	.uleb128 0x1d
+	.string	"pt1"
+	.byte	0x8
+	.byte	0x28
+	.byte	0x11
+	.long	0x39d
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1787
+	.byte	0x8
+	.byte	0x29
+	.byte	0x3
+	.long	0x42e
+	.uleb128 0x13
+	.long	0x11f
+	.long	0x46c
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x8
+	.byte	0x3b
+	.byte	0xe
+	.long	0x485
+	.uleb128 0x1
+	.long	.LASF1788
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1789
+	.byte	0x1
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1790
+	.byte	0x18
+	.byte	0x8
+	.byte	0x45
+	.long	0x4c6
+	.uleb128 0x7
+	.string	"buf"
+	.byte	0x8
+	.byte	0x46
+	.byte	0xc
+	.long	0x4c6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1791
+	.byte	0x8
+	.byte	0x47
+	.byte	0x12
+	.long	0x4cb
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1792
+	.byte	0x8
+	.byte	0x48
+	.byte	0xd
+	.long	0xe5
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1793
+	.byte	0x8
+	.byte	0x49
+	.byte	0xd
+	.long	0xe5
+	.byte	0x11
+	.byte	0
+	.uleb128 0x8
+	.long	0x11f
+	.uleb128 0x8
+	.long	0x126
+	.uleb128 0x5
+	.long	.LASF1794
+	.byte	0x8
+	.byte	0x4a
+	.byte	0x3
+	.long	0x485
+	.uleb128 0x5
+	.long	.LASF1795
+	.byte	0x8
+	.byte	0x4c
+	.byte	0x11
+	.long	0x4e8
+	.uleb128 0x8
+	.long	0x4ed
+	.uleb128 0x24
+	.long	0x11f
+	.long	0x501
+	.uleb128 0x4
+	.long	0xb3
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1796
+	.byte	0x8
+	.byte	0x4d
+	.byte	0x11
+	.long	0x50d
+	.uleb128 0x8
+	.long	0x512
+	.uleb128 0x24
+	.long	0x11f
+	.long	0x530
+	.uleb128 0x4
+	.long	0xb3
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1797
+	.byte	0x14
+	.byte	0x9
+	.byte	0x67
+	.long	0x57e
+	.uleb128 0x2
+	.long	.LASF1798
+	.byte	0x9
+	.byte	0x69
+	.byte	0xb
+	.long	0x11f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1799
+	.byte	0x9
+	.byte	0x69
+	.byte	0x13
+	.long	0x11f
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1800
+	.byte	0x9
+	.byte	0x69
+	.byte	0x1b
+	.long	0x11f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1801
+	.byte	0x9
+	.byte	0x69
+	.byte	0x23
+	.long	0x11f
+	.byte	0xc
+	.uleb128 0x7
+	.string	"m_n"
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x9
+	.long	0x88
+	.byte	0x10
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1802
+	.byte	0x9
+	.byte	0x6b
+	.byte	0x3
+	.long	0x530
+	.uleb128 0x5
+	.long	.LASF1803
+	.byte	0xa
+	.byte	0x7
+	.byte	0x11
+	.long	0xe5
+	.uleb128 0x5
+	.long	.LASF1804
+	.byte	0xa
+	.byte	0x8
+	.byte	0xf
+	.long	0xb3
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xb
+	.byte	0x16
+	.byte	0xe
+	.long	0x5cd
+	.uleb128 0x1
+	.long	.LASF1805
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1806
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1807
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1808
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1809
+	.byte	0x4
+	.byte	0
+	.uleb128 0x14
+	.byte	0x8
+	.byte	0xc
+	.byte	0x2d
+	.byte	0x5
+	.long	0x618
+	.uleb128 0x2
+	.long	.LASF1810
+	.byte	0xc
+	.byte	0x2e
+	.byte	0x11
+	.long	0xe5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1811
+	.byte	0xc
+	.byte	0x2f
+	.byte	0x11
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1812
+	.byte	0xc
+	.byte	0x30
+	.byte	0x11
+	.long	0xe5
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1813
+	.byte	0xc
+	.byte	0x31
+	.byte	0x12
+	.long	0xf1
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1814
+	.byte	0xc
+	.byte	0x32
+	.byte	0x12
+	.long	0xf1
+	.byte	0x6
+	.byte	0
+	.uleb128 0x14
+	.byte	0x5
+	.byte	0xc
+	.byte	0x35
+	.byte	0x5
+	.long	0x649
+	.uleb128 0x2
+	.long	.LASF1811
+	.byte	0xc
+	.byte	0x36
+	.byte	0x11
+	.long	0xe5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1815
+	.byte	0xc
+	.byte	0x37
+	.byte	0x11
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1816
+	.byte	0xc
+	.byte	0x38
+	.byte	0x11
+	.long	0x649
+	.byte	0x2
+	.byte	0
+	.uleb128 0x13
+	.long	0xe5
+	.long	0x659
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.byte	0x5
+	.byte	0xc
+	.byte	0x3b
+	.byte	0x5
+	.long	0x68a
+	.uleb128 0x2
+	.long	.LASF1811
+	.byte	0xc
+	.byte	0x3c
+	.byte	0x11
+	.long	0xe5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1815
+	.byte	0xc
+	.byte	0x3d
+	.byte	0x11
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1816
+	.byte	0xc
+	.byte	0x3e
+	.byte	0x11
+	.long	0x649
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.byte	0x1
+	.byte	0xc
+	.byte	0x41
+	.byte	0x5
+	.long	0x6a1
+	.uleb128 0x2
+	.long	.LASF1817
+	.byte	0xc
+	.byte	0x42
+	.byte	0x11
+	.long	0xe5
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1818
+	.byte	0x14
+	.byte	0xc
+	.byte	0x2b
+	.long	0x6e2
+	.uleb128 0x2
+	.long	.LASF1819
+	.byte	0xc
+	.byte	0x33
+	.byte	0x7
+	.long	0x5cd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1820
+	.byte	0xc
+	.byte	0x39
+	.byte	0x7
+	.long	0x618
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1821
+	.byte	0xc
+	.byte	0x3f
+	.byte	0x7
+	.long	0x659
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1822
+	.byte	0xc
+	.byte	0x43
+	.byte	0x7
+	.long	0x68a
+	.byte	0x12
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1823
+	.byte	0xc
+	.byte	0x45
+	.byte	0x3
+	.long	0x6a1
+	.uleb128 0x12
+	.long	0x6e2
+	.uleb128 0xc
+	.long	.LASF1824
+	.byte	0xc
+	.byte	0x49
+	.byte	0x23
+	.long	0x6ff
+	.uleb128 0x8
+	.long	0x6ee
+	.uleb128 0x2f
+	.long	.LASF2513
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0xd
+	.byte	0x18
+	.byte	0xe
+	.long	0x777
+	.uleb128 0x1
+	.long	.LASF1825
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1826
+	.byte	0x1
+	.uleb128 0x30
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1827
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1828
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1830
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1831
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1832
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1833
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1834
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1835
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1836
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1837
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1838
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1839
+	.byte	0xf
+	.byte	0
+	.uleb128 0x13
+	.long	0xc8
+	.long	0x787
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1840
+	.byte	0xd
+	.byte	0x51
+	.byte	0x10
+	.long	0x777
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xe
+	.byte	0x1c
+	.byte	0xe
+	.long	0x8a2
+	.uleb128 0x1
+	.long	.LASF1841
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1842
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1843
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1844
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1845
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1847
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1848
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1849
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1850
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1851
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1852
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1853
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1854
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1855
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1856
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1862
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1863
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1864
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1865
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1866
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1867
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1868
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1869
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1870
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1871
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1872
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1873
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1874
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1875
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1876
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1877
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1878
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1879
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1880
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1881
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1882
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1883
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1884
+	.byte	0xe
+	.byte	0x48
+	.byte	0x3
+	.long	0x793
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xf
+	.byte	0x54
+	.byte	0xe
+	.long	0x91c
+	.uleb128 0x1
+	.long	.LASF1885
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1886
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1887
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1888
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1889
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1890
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1891
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1892
+	.byte	0x80
+	.uleb128 0xb
+	.long	.LASF1893
+	.value	0x100
+	.uleb128 0xb
+	.long	.LASF1894
+	.value	0x200
+	.uleb128 0xb
+	.long	.LASF1895
+	.value	0x400
+	.uleb128 0xb
+	.long	.LASF1896
+	.value	0x800
+	.uleb128 0xb
+	.long	.LASF1897
+	.value	0x1000
+	.uleb128 0xb
+	.long	.LASF1898
+	.value	0x2000
+	.uleb128 0xb
+	.long	.LASF1899
+	.value	0x4000
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1900
+	.byte	0xf
+	.byte	0x66
+	.byte	0x11
+	.long	0x102
+	.uleb128 0x9
+	.long	0x30
+	.byte	0xf
+	.byte	0x6c
+	.byte	0xe
+	.long	0x9ee
+	.uleb128 0x1
+	.long	.LASF1901
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1902
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1903
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1904
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1905
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1906
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1907
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1908
+	.byte	0x80
+	.uleb128 0xb
+	.long	.LASF1909
+	.value	0x100
+	.uleb128 0xb
+	.long	.LASF1910
+	.value	0x200
+	.uleb128 0xb
+	.long	.LASF1911
+	.value	0x400
+	.uleb128 0xb
+	.long	.LASF1912
+	.value	0x800
+	.uleb128 0xb
+	.long	.LASF1913
+	.value	0x1000
+	.uleb128 0xb
+	.long	.LASF1914
+	.value	0x2000
+	.uleb128 0xb
+	.long	.LASF1915
+	.value	0x4000
+	.uleb128 0xb
+	.long	.LASF1916
+	.value	0x8000
+	.uleb128 0x18
+	.long	.LASF1917
+	.long	0x10000
+	.uleb128 0x18
+	.long	.LASF1918
+	.long	0x20000
+	.uleb128 0x18
+	.long	.LASF1919
+	.long	0x40000
+	.uleb128 0x18
+	.long	.LASF1920
+	.long	0x80000
+	.uleb128 0x18
+	.long	.LASF1921
+	.long	0x100000
+	.uleb128 0x18
+	.long	.LASF1922
+	.long	0x200000
+	.uleb128 0x18
+	.long	.LASF1923
+	.long	0x400000
+	.uleb128 0x18
+	.long	.LASF1924
+	.long	0x800000
+	.uleb128 0x18
+	.long	.LASF1925
+	.long	0x1000000
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1926
+	.byte	0xf
+	.byte	0x8c
+	.byte	0x11
+	.long	0x102
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x10
+	.byte	0x39
+	.byte	0xe
+	.long	0xa4f
+	.uleb128 0x1
+	.long	.LASF1927
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1928
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1929
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1930
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1931
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1933
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1934
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1935
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1936
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1937
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1938
+	.byte	0xb
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1939
+	.byte	0x10
+	.byte	0x47
+	.byte	0x3
+	.long	0x9fa
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x10
+	.byte	0x4a
+	.byte	0xe
+	.long	0xa80
+	.uleb128 0x1
+	.long	.LASF1940
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1941
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1942
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1943
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1944
+	.byte	0x10
+	.byte	0x4f
+	.byte	0x3
+	.long	0xa5b
+	.uleb128 0xe
+	.long	.LASF1945
+	.byte	0x4
+	.byte	0x10
+	.byte	0x51
+	.long	0xac6
+	.uleb128 0x7
+	.string	"P"
+	.byte	0x10
+	.byte	0x52
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x7
+	.string	"I"
+	.byte	0x10
+	.byte	0x53
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x7
+	.string	"D"
+	.byte	0x10
+	.byte	0x54
+	.byte	0xd
+	.long	0xe5
+	.byte	0x2
+	.uleb128 0x7
+	.string	"FF"
+	.byte	0x10
+	.byte	0x55
+	.byte	0xd
+	.long	0xe5
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1946
+	.byte	0x10
+	.byte	0x56
+	.byte	0x3
+	.long	0xa8c
+	.uleb128 0xe
+	.long	.LASF1947
+	.byte	0x2c
+	.byte	0x10
+	.byte	0x58
+	.long	0xaec
+	.uleb128 0x7
+	.string	"pid"
+	.byte	0x10
+	.byte	0x59
+	.byte	0xc
+	.long	0xaec
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0xac6
+	.long	0xafc
+	.uleb128 0x15
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1948
+	.byte	0x10
+	.byte	0x5a
+	.byte	0x3
+	.long	0xad2
+	.uleb128 0x12
+	.long	0xafc
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x10
+	.byte	0x5c
+	.byte	0xe
+	.long	0xb2c
+	.uleb128 0x1
+	.long	.LASF1949
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1950
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1951
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x10
+	.byte	0x62
+	.byte	0xe
+	.long	0xb45
+	.uleb128 0x1
+	.long	.LASF1952
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1953
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1954
+	.byte	0x10
+	.byte	0x65
+	.byte	0x3
+	.long	0xb2c
+	.uleb128 0x12
+	.long	0xb45
+	.uleb128 0xe
+	.long	.LASF1955
+	.byte	0xac
+	.byte	0x10
+	.byte	0x67
+	.long	0xd03
+	.uleb128 0x2
+	.long	.LASF1956
+	.byte	0x10
+	.byte	0x68
+	.byte	0xd
+	.long	0xe5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1957
+	.byte	0x10
+	.byte	0x69
+	.byte	0xf
+	.long	0xafc
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1958
+	.byte	0x10
+	.byte	0x6a
+	.byte	0xf
+	.long	0xafc
+	.byte	0x2d
+	.uleb128 0x2
+	.long	.LASF1959
+	.byte	0x10
+	.byte	0x6c
+	.byte	0xd
+	.long	0xe5
+	.byte	0x59
+	.uleb128 0x2
+	.long	.LASF1960
+	.byte	0x10
+	.byte	0x6d
+	.byte	0xe
+	.long	0xf1
+	.byte	0x5a
+	.uleb128 0x2
+	.long	.LASF1961
+	.byte	0x10
+	.byte	0x6f
+	.byte	0xd
+	.long	0xe5
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF1962
+	.byte	0x10
+	.byte	0x70
+	.byte	0xe
+	.long	0xf1
+	.byte	0x5e
+	.uleb128 0x2
+	.long	.LASF1963
+	.byte	0x10
+	.byte	0x72
+	.byte	0xd
+	.long	0xe5
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF1964
+	.byte	0x10
+	.byte	0x74
+	.byte	0xd
+	.long	0xe5
+	.byte	0x61
+	.uleb128 0x2
+	.long	.LASF1965
+	.byte	0x10
+	.byte	0x76
+	.byte	0xd
+	.long	0xe5
+	.byte	0x62
+	.uleb128 0x2
+	.long	.LASF1966
+	.byte	0x10
+	.byte	0x78
+	.byte	0xe
+	.long	0x102
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF1967
+	.byte	0x10
+	.byte	0x79
+	.byte	0xe
+	.long	0x102
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF1968
+	.byte	0x10
+	.byte	0x7b
+	.byte	0xd
+	.long	0xd03
+	.byte	0x6c
+	.uleb128 0x2
+	.long	.LASF1969
+	.byte	0x10
+	.byte	0x7d
+	.byte	0xe
+	.long	0xf1
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF1970
+	.byte	0x10
+	.byte	0x7e
+	.byte	0xe
+	.long	0xf1
+	.byte	0x72
+	.uleb128 0x2
+	.long	.LASF1971
+	.byte	0x10
+	.byte	0x81
+	.byte	0xe
+	.long	0xf1
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF1972
+	.byte	0x10
+	.byte	0x82
+	.byte	0xb
+	.long	0x11f
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF1973
+	.byte	0x10
+	.byte	0x83
+	.byte	0xb
+	.long	0x11f
+	.byte	0x7c
+	.uleb128 0x2
+	.long	.LASF1974
+	.byte	0x10
+	.byte	0x84
+	.byte	0xb
+	.long	0x11f
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF1975
+	.byte	0x10
+	.byte	0x86
+	.byte	0xd
+	.long	0xe5
+	.byte	0x84
+	.uleb128 0x2
+	.long	.LASF1976
+	.byte	0x10
+	.byte	0x87
+	.byte	0xb
+	.long	0x11f
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF1977
+	.byte	0x10
+	.byte	0x89
+	.byte	0xd
+	.long	0xe5
+	.byte	0x8c
+	.uleb128 0x2
+	.long	.LASF1978
+	.byte	0x10
+	.byte	0x8a
+	.byte	0xd
+	.long	0xe5
+	.byte	0x8d
+	.uleb128 0x2
+	.long	.LASF1979
+	.byte	0x10
+	.byte	0x8b
+	.byte	0xd
+	.long	0xe5
+	.byte	0x8e
+	.uleb128 0x2
+	.long	.LASF1980
+	.byte	0x10
+	.byte	0x8d
+	.byte	0xb
+	.long	0x11f
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF1981
+	.byte	0x10
+	.byte	0x8e
+	.byte	0xb
+	.long	0x11f
+	.byte	0x94
+	.uleb128 0x2
+	.long	.LASF1982
+	.byte	0x10
+	.byte	0x8f
+	.byte	0xd
+	.long	0xe5
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF1983
+	.byte	0x10
+	.byte	0x90
+	.byte	0xb
+	.long	0x11f
+	.byte	0x9c
+	.uleb128 0x2
+	.long	.LASF1984
+	.byte	0x10
+	.byte	0x91
+	.byte	0xb
+	.long	0x11f
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF1985
+	.byte	0x10
+	.byte	0x92
+	.byte	0xd
+	.long	0xe5
+	.byte	0xa4
+	.uleb128 0x2
+	.long	.LASF1986
+	.byte	0x10
+	.byte	0x94
+	.byte	0xe
+	.long	0xf1
+	.byte	0xa6
+	.uleb128 0x2
+	.long	.LASF1987
+	.byte	0x10
+	.byte	0x95
+	.byte	0xd
+	.long	0xe5
+	.byte	0xa8
+	.byte	0
+	.uleb128 0x13
+	.long	0xc8
+	.long	0xd13
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1988
+	.byte	0x10
+	.byte	0x96
+	.byte	0x3
+	.long	0xb56
+	.uleb128 0x12
+	.long	0xd13
+	.uleb128 0xc
+	.long	.LASF1989
+	.byte	0x10
+	.byte	0xa0
+	.byte	0x16
+	.long	0xd30
+	.uleb128 0x8
+	.long	0xd13
+	.uleb128 0x13
+	.long	0xc8
+	.long	0xd40
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1990
+	.byte	0x10
+	.byte	0xa6
+	.byte	0x10
+	.long	0xd35
+	.uleb128 0x13
+	.long	0xd4
+	.long	0xd57
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF1991
+	.byte	0x10
+	.byte	0xa7
+	.byte	0x10
+	.long	0xd4c
+	.uleb128 0xc
+	.long	.LASF1992
+	.byte	0x10
+	.byte	0xa7
+	.byte	0x1d
+	.long	0xd4c
+	.uleb128 0xc
+	.long	.LASF1993
+	.byte	0x10
+	.byte	0xa7
+	.byte	0x2a
+	.long	0xd4c
+	.uleb128 0xc
+	.long	.LASF1994
+	.byte	0x10
+	.byte	0xa7
+	.byte	0x37
+	.long	0xd4c
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x10
+	.byte	0xb9
+	.byte	0x6
+	.long	0xda6
+	.uleb128 0x1
+	.long	.LASF1995
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1996
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1997
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.byte	0xc
+	.byte	0x11
+	.byte	0x1b
+	.byte	0x5
+	.long	0xdd1
+	.uleb128 0x7
+	.string	"x"
+	.byte	0x11
+	.byte	0x1c
+	.byte	0xe
+	.long	0x11f
+	.byte	0
+	.uleb128 0x7
+	.string	"y"
+	.byte	0x11
+	.byte	0x1c
+	.byte	0x10
+	.long	0x11f
+	.byte	0x4
+	.uleb128 0x7
+	.string	"z"
+	.byte	0x11
+	.byte	0x1c
+	.byte	0x12
+	.long	0x11f
+	.byte	0x8
+	.byte	0
+	.uleb128 0x22
+	.byte	0xc
+	.byte	0x11
+	.byte	0x19
+	.byte	0x9
+	.long	0xdea
+	.uleb128 0x1d
+	.string	"v"
+	.byte	0x11
+	.byte	0x1a
+	.byte	0xb
+	.long	0x45c
+	.uleb128 0x31
+	.long	0xda6
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1998
+	.byte	0x11
+	.byte	0x1e
+	.byte	0x3
+	.long	0xdd1
+	.uleb128 0x14
+	.byte	0x6
+	.byte	0x12
+	.byte	0x20
+	.byte	0x5
+	.long	0xe27
+	.uleb128 0x2
+	.long	.LASF1999
+	.byte	0x12
+	.byte	0x22
+	.byte	0x11
+	.long	0xc8
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2000
+	.byte	0x12
+	.byte	0x23
+	.byte	0x11
+	.long	0xc8
+	.byte	0x2
+	.uleb128 0x7
+	.string	"yaw"
+	.byte	0x12
+	.byte	0x24
+	.byte	0x11
+	.long	0xc8
+	.byte	0x4
+	.byte	0
+	.uleb128 0x22
+	.byte	0x6
+	.byte	0x12
+	.byte	0x1e
+	.byte	0x9
+	.long	0xe49
+	.uleb128 0x1d
+	.string	"raw"
+	.byte	0x12
+	.byte	0x1f
+	.byte	0xd
+	.long	0xe49
+	.uleb128 0x27
+	.long	.LASF2001
+	.byte	0x12
+	.byte	0x25
+	.byte	0x7
+	.long	0xdf6
+	.byte	0
+	.uleb128 0x13
+	.long	0xc8
+	.long	0xe59
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2002
+	.byte	0x12
+	.byte	0x26
+	.byte	0x3
+	.long	0xe27
+	.uleb128 0xc
+	.long	.LASF2003
+	.byte	0x12
+	.byte	0x29
+	.byte	0x1e
+	.long	0xe59
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x13
+	.byte	0x28
+	.byte	0xe
+	.long	0xea8
+	.uleb128 0x1
+	.long	.LASF2004
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2010
+	.byte	0x6
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2011
+	.byte	0x8
+	.byte	0x13
+	.byte	0x41
+	.long	0xef6
+	.uleb128 0x2
+	.long	.LASF2012
+	.byte	0x13
+	.byte	0x42
+	.byte	0xc
+	.long	0xbc
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2013
+	.byte	0x13
+	.byte	0x43
+	.byte	0xd
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2014
+	.byte	0x13
+	.byte	0x44
+	.byte	0x9
+	.long	0xef6
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2015
+	.byte	0x13
+	.byte	0x45
+	.byte	0xd
+	.long	0xc8
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2016
+	.byte	0x13
+	.byte	0x46
+	.byte	0xe
+	.long	0xf1
+	.byte	0x6
+	.byte	0
+	.uleb128 0x16
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2017
+	.uleb128 0x12
+	.long	0xef6
+	.uleb128 0x5
+	.long	.LASF2018
+	.byte	0x13
+	.byte	0x47
+	.byte	0x3
+	.long	0xea8
+	.uleb128 0x12
+	.long	0xf02
+	.uleb128 0xc
+	.long	.LASF2019
+	.byte	0x13
+	.byte	0x49
+	.byte	0x16
+	.long	0xf02
+	.uleb128 0xe
+	.long	.LASF2020
+	.byte	0x1c
+	.byte	0x13
+	.byte	0x53
+	.long	0xfae
+	.uleb128 0x2
+	.long	.LASF2021
+	.byte	0x13
+	.byte	0x55
+	.byte	0xe
+	.long	0xf1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2022
+	.byte	0x13
+	.byte	0x56
+	.byte	0xe
+	.long	0xf1
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2023
+	.byte	0x13
+	.byte	0x57
+	.byte	0xe
+	.long	0xf1
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2024
+	.byte	0x13
+	.byte	0x58
+	.byte	0xd
+	.long	0xe5
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2025
+	.byte	0x13
+	.byte	0x59
+	.byte	0xe
+	.long	0xf1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2026
+	.byte	0x13
+	.byte	0x5a
+	.byte	0xe
+	.long	0xf1
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2027
+	.byte	0x13
+	.byte	0x5b
+	.byte	0xe
+	.long	0xf1
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2028
+	.byte	0x13
+	.byte	0x5c
+	.byte	0xb
+	.long	0x11f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2029
+	.byte	0x13
+	.byte	0x5d
+	.byte	0xb
+	.long	0x11f
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2030
+	.byte	0x13
+	.byte	0x5e
+	.byte	0xd
+	.long	0xe5
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2031
+	.byte	0x13
+	.byte	0x5f
+	.byte	0x3
+	.long	0xf1f
+	.uleb128 0x12
+	.long	0xfae
+	.uleb128 0xc
+	.long	.LASF2032
+	.byte	0x13
+	.byte	0x61
+	.byte	0x16
+	.long	0xfae
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x14
+	.byte	0x16
+	.byte	0xe
+	.long	0x10bc
+	.uleb128 0x1
+	.long	.LASF2033
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2034
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2035
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2036
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2037
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2039
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2040
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2041
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2042
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2043
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2044
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2045
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2046
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2047
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2048
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2049
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2050
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2051
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2052
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2053
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2054
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2055
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2056
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2057
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2058
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2059
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2060
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2061
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2062
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2063
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2064
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2065
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2066
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2067
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2068
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2069
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2070
+	.byte	0x25
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x14
+	.byte	0x43
+	.byte	0xe
+	.long	0x1147
+	.uleb128 0x1
+	.long	.LASF2071
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2072
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2073
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2074
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2075
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2077
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2078
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2079
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2080
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2081
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2082
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2083
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2084
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2085
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2086
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2087
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2088
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2089
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2090
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2091
+	.byte	0x14
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x15
+	.byte	0x3a
+	.byte	0xe
+	.long	0x1172
+	.uleb128 0x1
+	.long	.LASF2092
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2093
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2094
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2095
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2096
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2097
+	.byte	0x15
+	.byte	0x40
+	.byte	0x3
+	.long	0x1147
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x15
+	.byte	0x4b
+	.byte	0xe
+	.long	0x12b7
+	.uleb128 0x1
+	.long	.LASF2098
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2099
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2100
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2101
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2102
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2103
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2105
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2106
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2107
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2108
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2110
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2111
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2112
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2113
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2114
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2115
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2116
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2117
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2118
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2119
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2120
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2121
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2122
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2123
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2124
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2125
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2126
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2127
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2128
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2129
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2130
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2131
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2132
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2133
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2134
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2135
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2136
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2137
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2138
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2139
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2140
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2141
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2142
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2143
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2144
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF2145
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF2146
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2147
+	.byte	0x31
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2148
+	.byte	0x15
+	.byte	0x94
+	.byte	0x3
+	.long	0x117e
+	.uleb128 0x29
+	.byte	0xa6
+	.uleb128 0xe
+	.long	.LASF2149
+	.byte	0x18
+	.byte	0x15
+	.byte	0x9f
+	.long	0x133a
+	.uleb128 0x2
+	.long	.LASF2150
+	.byte	0x15
+	.byte	0xa0
+	.byte	0xc
+	.long	0xb3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2151
+	.byte	0x15
+	.byte	0xa1
+	.byte	0xf
+	.long	0x1172
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2152
+	.byte	0x15
+	.byte	0xa2
+	.byte	0x17
+	.long	0x12b7
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2153
+	.byte	0x15
+	.byte	0xa3
+	.byte	0xd
+	.long	0xe5
+	.byte	0x10
+	.uleb128 0x7
+	.string	"tag"
+	.byte	0x15
+	.byte	0xa4
+	.byte	0xd
+	.long	0xe5
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2154
+	.byte	0x15
+	.byte	0xa5
+	.byte	0xd
+	.long	0xe5
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2155
+	.byte	0x15
+	.byte	0xb3
+	.byte	0x7
+	.long	0x12c3
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2156
+	.byte	0x15
+	.byte	0xb4
+	.byte	0xd
+	.long	0x58a
+	.byte	0x13
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2157
+	.byte	0x15
+	.byte	0xb5
+	.byte	0x3
+	.long	0x12c5
+	.uleb128 0x12
+	.long	0x133a
+	.uleb128 0x29
+	.byte	0xbc
+	.uleb128 0xe
+	.long	.LASF2158
+	.byte	0x28
+	.byte	0x15
+	.byte	0xb7
+	.long	0x13b5
+	.uleb128 0x2
+	.long	.LASF2159
+	.byte	0x15
+	.byte	0xb8
+	.byte	0x23
+	.long	0x13b5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2151
+	.byte	0x15
+	.byte	0xb9
+	.byte	0xf
+	.long	0x1172
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2153
+	.byte	0x15
+	.byte	0xba
+	.byte	0xe
+	.long	0x102
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2154
+	.byte	0x15
+	.byte	0xbb
+	.byte	0xe
+	.long	0x102
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2155
+	.byte	0x15
+	.byte	0xc9
+	.byte	0x7
+	.long	0x134b
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2156
+	.byte	0x15
+	.byte	0xca
+	.byte	0xa
+	.long	0x596
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2160
+	.byte	0x15
+	.byte	0xcb
+	.byte	0x10
+	.long	0x13ba
+	.byte	0x20
+	.byte	0
+	.uleb128 0x8
+	.long	0x1346
+	.uleb128 0x8
+	.long	0x102
+	.uleb128 0x5
+	.long	.LASF2161
+	.byte	0x15
+	.byte	0xce
+	.byte	0x3
+	.long	0x134d
+	.uleb128 0x8
+	.long	0xc8
+	.uleb128 0xe
+	.long	.LASF2162
+	.byte	0x28
+	.byte	0x16
+	.byte	0x3b
+	.long	0x1445
+	.uleb128 0x2
+	.long	.LASF2163
+	.byte	0x16
+	.byte	0x3c
+	.byte	0x9
+	.long	0xef6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2164
+	.byte	0x16
+	.byte	0x3d
+	.byte	0xe
+	.long	0x102
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2165
+	.byte	0x16
+	.byte	0x3e
+	.byte	0xe
+	.long	0x102
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2166
+	.byte	0x16
+	.byte	0x3f
+	.byte	0xd
+	.long	0xe5
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2167
+	.byte	0x16
+	.byte	0x40
+	.byte	0x9
+	.long	0xef6
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF2168
+	.byte	0x16
+	.byte	0x41
+	.byte	0xe
+	.long	0x260
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2169
+	.byte	0x16
+	.byte	0x42
+	.byte	0x11
+	.long	0x248
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2170
+	.byte	0x16
+	.byte	0x43
+	.byte	0xb
+	.long	0x45c
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2171
+	.byte	0x16
+	.byte	0x44
+	.byte	0x3
+	.long	0x13d0
+	.uleb128 0xc
+	.long	.LASF2172
+	.byte	0x16
+	.byte	0x46
+	.byte	0xf
+	.long	0x1445
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x17
+	.byte	0x3b
+	.byte	0x6
+	.long	0x147c
+	.uleb128 0x1
+	.long	.LASF2173
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x17
+	.byte	0x4b
+	.byte	0x6
+	.long	0x149b
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.byte	0xa
+	.byte	0x17
+	.byte	0x92
+	.byte	0x9
+	.long	0x1527
+	.uleb128 0x2
+	.long	.LASF2179
+	.byte	0x17
+	.byte	0x93
+	.byte	0x15
+	.long	0xe5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2180
+	.byte	0x17
+	.byte	0x94
+	.byte	0x15
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2181
+	.byte	0x17
+	.byte	0x95
+	.byte	0x15
+	.long	0xe5
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2182
+	.byte	0x17
+	.byte	0x96
+	.byte	0x15
+	.long	0xe5
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2183
+	.byte	0x17
+	.byte	0x97
+	.byte	0x15
+	.long	0xe5
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2184
+	.byte	0x17
+	.byte	0x98
+	.byte	0x15
+	.long	0xe5
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2185
+	.byte	0x17
+	.byte	0x99
+	.byte	0x15
+	.long	0xe5
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2186
+	.byte	0x17
+	.byte	0x9a
+	.byte	0x15
+	.long	0xe5
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF2187
+	.byte	0x17
+	.byte	0x9b
+	.byte	0x15
+	.long	0xe5
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2188
+	.byte	0x17
+	.byte	0x9c
+	.byte	0x15
+	.long	0xe5
+	.byte	0x9
+	.byte	0
+	.uleb128 0x14
+	.byte	0x2e
+	.byte	0x17
+	.byte	0x91
+	.byte	0x5
+	.long	0x1628
+	.uleb128 0x2
+	.long	.LASF2153
+	.byte	0x17
+	.byte	0x9d
+	.byte	0xb
+	.long	0x149b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2189
+	.byte	0x17
+	.byte	0x9f
+	.byte	0x11
+	.long	0xe5
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2190
+	.byte	0x17
+	.byte	0xa0
+	.byte	0x12
+	.long	0xf1
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2191
+	.byte	0x17
+	.byte	0xa1
+	.byte	0x12
+	.long	0xf1
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2192
+	.byte	0x17
+	.byte	0xa2
+	.byte	0x12
+	.long	0xf1
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2193
+	.byte	0x17
+	.byte	0xa3
+	.byte	0x12
+	.long	0xf1
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2194
+	.byte	0x17
+	.byte	0xa4
+	.byte	0x12
+	.long	0xf1
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2195
+	.byte	0x17
+	.byte	0xa5
+	.byte	0x12
+	.long	0xf1
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2196
+	.byte	0x17
+	.byte	0xa6
+	.byte	0x12
+	.long	0xf1
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2197
+	.byte	0x17
+	.byte	0xa7
+	.byte	0x12
+	.long	0xf1
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2198
+	.byte	0x17
+	.byte	0xa8
+	.byte	0x12
+	.long	0xf1
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2199
+	.byte	0x17
+	.byte	0xa9
+	.byte	0x12
+	.long	0xf1
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2200
+	.byte	0x17
+	.byte	0xaa
+	.byte	0x12
+	.long	0xf1
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2201
+	.byte	0x17
+	.byte	0xab
+	.byte	0x12
+	.long	0xf1
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2202
+	.byte	0x17
+	.byte	0xac
+	.byte	0x12
+	.long	0xf1
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2203
+	.byte	0x17
+	.byte	0xad
+	.byte	0x12
+	.long	0xf1
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2204
+	.byte	0x17
+	.byte	0xae
+	.byte	0x12
+	.long	0xf1
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2205
+	.byte	0x17
+	.byte	0xaf
+	.byte	0x12
+	.long	0xf1
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2206
+	.byte	0x17
+	.byte	0xb0
+	.byte	0x12
+	.long	0xf1
+	.byte	0x2c
+	.byte	0
+	.uleb128 0x14
+	.byte	0x18
+	.byte	0x17
+	.byte	0xb3
+	.byte	0x5
+	.long	0x16db
+	.uleb128 0x2
+	.long	.LASF2207
+	.byte	0x17
+	.byte	0xb4
+	.byte	0x11
+	.long	0xe5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2208
+	.byte	0x17
+	.byte	0xb5
+	.byte	0x12
+	.long	0xf1
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2209
+	.byte	0x17
+	.byte	0xb6
+	.byte	0x12
+	.long	0xf1
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2210
+	.byte	0x17
+	.byte	0xb7
+	.byte	0x12
+	.long	0xf1
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2211
+	.byte	0x17
+	.byte	0xb8
+	.byte	0x12
+	.long	0xf1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2212
+	.byte	0x17
+	.byte	0xb9
+	.byte	0x12
+	.long	0xf1
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2213
+	.byte	0x17
+	.byte	0xba
+	.byte	0x11
+	.long	0xe5
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2214
+	.byte	0x17
+	.byte	0xbb
+	.byte	0x12
+	.long	0xf1
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2215
+	.byte	0x17
+	.byte	0xbc
+	.byte	0x12
+	.long	0xf1
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2216
+	.byte	0x17
+	.byte	0xbd
+	.byte	0x12
+	.long	0xf1
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2217
+	.byte	0x17
+	.byte	0xbe
+	.byte	0x11
+	.long	0xe5
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2218
+	.byte	0x17
+	.byte	0xbf
+	.byte	0x11
+	.long	0xe5
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2219
+	.byte	0x17
+	.byte	0xc0
+	.byte	0x11
+	.long	0xe5
+	.byte	0x16
+	.byte	0
+	.uleb128 0x14
+	.byte	0x2e
+	.byte	0x17
+	.byte	0xc3
+	.byte	0x5
+	.long	0x1844
+	.uleb128 0x2
+	.long	.LASF2207
+	.byte	0x17
+	.byte	0xc4
+	.byte	0x11
+	.long	0xe5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2220
+	.byte	0x17
+	.byte	0xc5
+	.byte	0x11
+	.long	0xe5
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2221
+	.byte	0x17
+	.byte	0xc6
+	.byte	0x11
+	.long	0xe5
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2222
+	.byte	0x17
+	.byte	0xc7
+	.byte	0x12
+	.long	0xf1
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2223
+	.byte	0x17
+	.byte	0xc8
+	.byte	0x12
+	.long	0xf1
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2224
+	.byte	0x17
+	.byte	0xc9
+	.byte	0x11
+	.long	0xe5
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2225
+	.byte	0x17
+	.byte	0xca
+	.byte	0x12
+	.long	0xf1
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2226
+	.byte	0x17
+	.byte	0xcb
+	.byte	0x12
+	.long	0xf1
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2227
+	.byte	0x17
+	.byte	0xcc
+	.byte	0x11
+	.long	0xe5
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2228
+	.byte	0x17
+	.byte	0xcd
+	.byte	0x12
+	.long	0xf1
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2229
+	.byte	0x17
+	.byte	0xce
+	.byte	0x10
+	.long	0xbc
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2230
+	.byte	0x17
+	.byte	0xcf
+	.byte	0x12
+	.long	0xf1
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2231
+	.byte	0x17
+	.byte	0xd0
+	.byte	0x12
+	.long	0xf1
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2232
+	.byte	0x17
+	.byte	0xd1
+	.byte	0x12
+	.long	0xf1
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2233
+	.byte	0x17
+	.byte	0xd2
+	.byte	0x12
+	.long	0xf1
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2234
+	.byte	0x17
+	.byte	0xd3
+	.byte	0x12
+	.long	0xf1
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2235
+	.byte	0x17
+	.byte	0xd4
+	.byte	0x12
+	.long	0xf1
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2236
+	.byte	0x17
+	.byte	0xd5
+	.byte	0x12
+	.long	0xf1
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2237
+	.byte	0x17
+	.byte	0xd6
+	.byte	0x12
+	.long	0xf1
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2238
+	.byte	0x17
+	.byte	0xd7
+	.byte	0x12
+	.long	0xf1
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2239
+	.byte	0x17
+	.byte	0xd8
+	.byte	0x12
+	.long	0xf1
+	.byte	0x26
+	.uleb128 0x2
+	.long	.LASF2240
+	.byte	0x17
+	.byte	0xd9
+	.byte	0x11
+	.long	0xe5
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2241
+	.byte	0x17
+	.byte	0xda
+	.byte	0x11
+	.long	0xe5
+	.byte	0x29
+	.uleb128 0x2
+	.long	.LASF2242
+	.byte	0x17
+	.byte	0xdb
+	.byte	0x11
+	.long	0xe5
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2243
+	.byte	0x17
+	.byte	0xdc
+	.byte	0x11
+	.long	0xef6
+	.byte	0x2b
+	.uleb128 0x2
+	.long	.LASF2244
+	.byte	0x17
+	.byte	0xdd
+	.byte	0xd
+	.long	0xef6
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2245
+	.byte	0x17
+	.byte	0xde
+	.byte	0x11
+	.long	0xe5
+	.byte	0x2d
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2246
+	.byte	0x74
+	.byte	0x17
+	.byte	0x8f
+	.long	0x1876
+	.uleb128 0x2
+	.long	.LASF2247
+	.byte	0x17
+	.byte	0xb1
+	.byte	0x7
+	.long	0x1527
+	.byte	0
+	.uleb128 0x7
+	.string	"mc"
+	.byte	0x17
+	.byte	0xc1
+	.byte	0x7
+	.long	0x1628
+	.byte	0x2e
+	.uleb128 0x7
+	.string	"fw"
+	.byte	0x17
+	.byte	0xdf
+	.byte	0x7
+	.long	0x16db
+	.byte	0x46
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2248
+	.byte	0x17
+	.byte	0xe0
+	.byte	0x3
+	.long	0x1844
+	.uleb128 0x12
+	.long	0x1876
+	.uleb128 0xc
+	.long	.LASF2249
+	.byte	0x17
+	.byte	0xe2
+	.byte	0x14
+	.long	0x1876
+	.uleb128 0x13
+	.long	0xd4
+	.long	0x18a3
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x18
+	.byte	0x14
+	.byte	0xe
+	.long	0x18e0
+	.uleb128 0x1
+	.long	.LASF2250
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2251
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2252
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2253
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2255
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2256
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2257
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x18
+	.byte	0x30
+	.byte	0xe
+	.long	0x192b
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2259
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2260
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2261
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0x80
+	.uleb128 0xb
+	.long	.LASF2266
+	.value	0x100
+	.uleb128 0xb
+	.long	.LASF2267
+	.value	0x200
+	.byte	0
+	.uleb128 0x8
+	.long	0x13bf
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x19
+	.byte	0x23
+	.byte	0xe
+	.long	0x1955
+	.uleb128 0x1
+	.long	.LASF2268
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2269
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2270
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2271
+	.byte	0x3
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2272
+	.byte	0x19
+	.byte	0x28
+	.byte	0x3
+	.long	0x1930
+	.uleb128 0x14
+	.byte	0x18
+	.byte	0x19
+	.byte	0x2a
+	.byte	0x9
+	.long	0x19b9
+	.uleb128 0x2
+	.long	.LASF1780
+	.byte	0x19
+	.byte	0x2b
+	.byte	0x1c
+	.long	0x1955
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2273
+	.byte	0x19
+	.byte	0x2c
+	.byte	0xe
+	.long	0x254
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2274
+	.byte	0x19
+	.byte	0x2d
+	.byte	0xe
+	.long	0x254
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2275
+	.byte	0x19
+	.byte	0x2e
+	.byte	0x1c
+	.long	0xef6
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2276
+	.byte	0x19
+	.byte	0x2f
+	.byte	0xe
+	.long	0x30
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2277
+	.byte	0x19
+	.byte	0x30
+	.byte	0xb
+	.long	0x11f
+	.byte	0x14
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2278
+	.byte	0x19
+	.byte	0x31
+	.byte	0x3
+	.long	0x1961
+	.uleb128 0x14
+	.byte	0x18
+	.byte	0x19
+	.byte	0x33
+	.byte	0x9
+	.long	0x19e9
+	.uleb128 0x2
+	.long	.LASF2279
+	.byte	0x19
+	.byte	0x34
+	.byte	0xb
+	.long	0x11f
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2280
+	.byte	0x19
+	.byte	0x35
+	.byte	0xd
+	.long	0x57e
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2281
+	.byte	0x19
+	.byte	0x36
+	.byte	0x3
+	.long	0x19c5
+	.uleb128 0x14
+	.byte	0x30
+	.byte	0x19
+	.byte	0x38
+	.byte	0x9
+	.long	0x1a19
+	.uleb128 0x2
+	.long	.LASF2282
+	.byte	0x19
+	.byte	0x39
+	.byte	0x1d
+	.long	0x19b9
+	.byte	0
+	.uleb128 0x7
+	.string	"val"
+	.byte	0x19
+	.byte	0x3a
+	.byte	0x1c
+	.long	0x19e9
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2283
+	.byte	0x19
+	.byte	0x3b
+	.byte	0x3
+	.long	0x19f5
+	.uleb128 0x5
+	.long	.LASF2284
+	.byte	0x1a
+	.byte	0x17
+	.byte	0xf
+	.long	0x1a31
+	.uleb128 0x8
+	.long	0x1a36
+	.uleb128 0x24
+	.long	0xef6
+	.long	0x1a45
+	.uleb128 0x4
+	.long	0x1a45
+	.byte	0
+	.uleb128 0x8
+	.long	0x1a4a
+	.uleb128 0xe
+	.long	.LASF2285
+	.byte	0x28
+	.byte	0x1a
+	.byte	0x1a
+	.long	0x1a98
+	.uleb128 0x2
+	.long	.LASF2286
+	.byte	0x1a
+	.byte	0x1b
+	.byte	0x13
+	.long	0x192b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2287
+	.byte	0x1a
+	.byte	0x1c
+	.byte	0xe
+	.long	0xf1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2288
+	.byte	0x1a
+	.byte	0x1d
+	.byte	0x14
+	.long	0x1a25
+	.byte	0x10
+	.uleb128 0x7
+	.string	"get"
+	.byte	0x1a
+	.byte	0x1e
+	.byte	0x14
+	.long	0x1a25
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2289
+	.byte	0x1a
+	.byte	0x1f
+	.byte	0x1b
+	.long	0x1a98
+	.byte	0x20
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2290
+	.byte	0x1a
+	.byte	0x18
+	.byte	0x10
+	.long	0x1aa4
+	.uleb128 0x8
+	.long	0x1aa9
+	.uleb128 0x23
+	.long	0x1abe
+	.uleb128 0x4
+	.long	0x1a45
+	.uleb128 0x4
+	.long	0x4c6
+	.uleb128 0x4
+	.long	0x4c6
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2291
+	.byte	0x1a
+	.byte	0x20
+	.byte	0x3
+	.long	0x1a4a
+	.uleb128 0xe
+	.long	.LASF2292
+	.byte	0x80
+	.byte	0x1b
+	.byte	0x2e
+	.long	0x1b3f
+	.uleb128 0x7
+	.string	"dev"
+	.byte	0x1b
+	.byte	0x2f
+	.byte	0x10
+	.long	0x1abe
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2293
+	.byte	0x1b
+	.byte	0x30
+	.byte	0xb
+	.long	0x11f
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2294
+	.byte	0x1b
+	.byte	0x32
+	.byte	0x1d
+	.long	0x1a19
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2295
+	.byte	0x1b
+	.byte	0x33
+	.byte	0x11
+	.long	0x39d
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF2296
+	.byte	0x1b
+	.byte	0x34
+	.byte	0xe
+	.long	0x260
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF2297
+	.byte	0x1b
+	.byte	0x35
+	.byte	0xe
+	.long	0x254
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF2298
+	.byte	0x1b
+	.byte	0x37
+	.byte	0xb
+	.long	0x11f
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF2299
+	.byte	0x1b
+	.byte	0x38
+	.byte	0xb
+	.long	0x11f
+	.byte	0x78
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2300
+	.byte	0x1b
+	.byte	0x39
+	.byte	0x3
+	.long	0x1aca
+	.uleb128 0xc
+	.long	.LASF2301
+	.byte	0x1b
+	.byte	0x40
+	.byte	0x10
+	.long	0x1b3f
+	.uleb128 0x9
+	.long	0x30
+	.byte	0x1c
+	.byte	0x1f
+	.byte	0xe
+	.long	0x1ba6
+	.uleb128 0x1
+	.long	.LASF2302
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2303
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2304
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2305
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2306
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2307
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2311
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2312
+	.byte	0xa
+	.byte	0
+	.uleb128 0x32
+	.value	0x138
+	.byte	0x1d
+	.byte	0x3e
+	.byte	0x9
+	.long	0x1d19
+	.uleb128 0x7
+	.string	"kP"
+	.byte	0x1d
+	.byte	0x3f
+	.byte	0xb
+	.long	0x11f
+	.byte	0
+	.uleb128 0x7
+	.string	"kI"
+	.byte	0x1d
+	.byte	0x40
+	.byte	0xb
+	.long	0x11f
+	.byte	0x4
+	.uleb128 0x7
+	.string	"kD"
+	.byte	0x1d
+	.byte	0x41
+	.byte	0xb
+	.long	0x11f
+	.byte	0x8
+	.uleb128 0x7
+	.string	"kFF"
+	.byte	0x1d
+	.byte	0x42
+	.byte	0xb
+	.long	0x11f
+	.byte	0xc
+	.uleb128 0x7
+	.string	"kCD"
+	.byte	0x1d
+	.byte	0x43
+	.byte	0xb
+	.long	0x11f
+	.byte	0x10
+	.uleb128 0x7
+	.string	"kT"
+	.byte	0x1d
+	.byte	0x44
+	.byte	0xb
+	.long	0x11f
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2313
+	.byte	0x1d
+	.byte	0x46
+	.byte	0xb
+	.long	0x11f
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2314
+	.byte	0x1d
+	.byte	0x47
+	.byte	0xb
+	.long	0x11f
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2315
+	.byte	0x1d
+	.byte	0x4b
+	.byte	0xb
+	.long	0x1d19
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2316
+	.byte	0x1d
+	.byte	0x4c
+	.byte	0x11
+	.long	0x4d0
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2317
+	.byte	0x1d
+	.byte	0x4f
+	.byte	0xb
+	.long	0x11f
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2318
+	.byte	0x1d
+	.byte	0x50
+	.byte	0xb
+	.long	0x11f
+	.byte	0x54
+	.uleb128 0x2
+	.long	.LASF2319
+	.byte	0x1d
+	.byte	0x53
+	.byte	0x11
+	.long	0x39d
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2320
+	.byte	0x1d
+	.byte	0x56
+	.byte	0x17
+	.long	0x35f
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF2321
+	.byte	0x1d
+	.byte	0x57
+	.byte	0x11
+	.long	0x39d
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF2322
+	.byte	0x1d
+	.byte	0x58
+	.byte	0xe
+	.long	0x450
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF2323
+	.byte	0x1d
+	.byte	0x59
+	.byte	0xe
+	.long	0x450
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF2324
+	.byte	0x1d
+	.byte	0x5b
+	.byte	0xb
+	.long	0x11f
+	.byte	0xbc
+	.uleb128 0x2
+	.long	.LASF2325
+	.byte	0x1d
+	.byte	0x5d
+	.byte	0xb
+	.long	0x11f
+	.byte	0xc0
+	.uleb128 0x2
+	.long	.LASF2326
+	.byte	0x1d
+	.byte	0x5e
+	.byte	0xb
+	.long	0x11f
+	.byte	0xc4
+	.uleb128 0x2
+	.long	.LASF2327
+	.byte	0x1d
+	.byte	0x61
+	.byte	0x11
+	.long	0x39d
+	.byte	0xc8
+	.uleb128 0x2
+	.long	.LASF2328
+	.byte	0x1d
+	.byte	0x62
+	.byte	0x14
+	.long	0x422
+	.byte	0xd4
+	.uleb128 0x2
+	.long	.LASF1969
+	.byte	0x1d
+	.byte	0x64
+	.byte	0xe
+	.long	0xf1
+	.byte	0xf8
+	.uleb128 0x1e
+	.long	.LASF2329
+	.byte	0x65
+	.byte	0x17
+	.long	0x501
+	.value	0x100
+	.uleb128 0x1e
+	.long	.LASF2330
+	.byte	0x66
+	.byte	0x9
+	.long	0xef6
+	.value	0x108
+	.uleb128 0x1e
+	.long	.LASF2331
+	.byte	0x67
+	.byte	0x9
+	.long	0xef6
+	.value	0x109
+	.uleb128 0x1e
+	.long	.LASF2332
+	.byte	0x68
+	.byte	0xb
+	.long	0x11f
+	.value	0x10c
+	.uleb128 0x1e
+	.long	.LASF2333
+	.byte	0x6a
+	.byte	0x14
+	.long	0x422
+	.value	0x110
+	.byte	0
+	.uleb128 0x13
+	.long	0x11f
+	.long	0x1d29
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2334
+	.byte	0x1d
+	.byte	0x6b
+	.byte	0x3
+	.long	0x1ba6
+	.uleb128 0x2a
+	.long	.LASF2339
+	.byte	0x6d
+	.long	0xef6
+	.uleb128 0xa
+	.long	.LASF2335
+	.byte	0x6e
+	.byte	0xe
+	.long	0x11f
+	.uleb128 0xa
+	.long	.LASF2336
+	.byte	0x6f
+	.byte	0x10
+	.long	0xc8
+	.uleb128 0xa
+	.long	.LASF2337
+	.byte	0x70
+	.byte	0x14
+	.long	0x39d
+	.uleb128 0xa
+	.long	.LASF2338
+	.byte	0x71
+	.byte	0x14
+	.long	0x39d
+	.uleb128 0x2a
+	.long	.LASF2340
+	.byte	0x74
+	.long	0xef6
+	.uleb128 0x1f
+	.long	0xd40
+	.byte	0x75
+	.byte	0x3f
+	.long	0xe49
+	.uleb128 0x1f
+	.long	0xd57
+	.byte	0x78
+	.byte	0x9
+	.long	0x1893
+	.uleb128 0x1f
+	.long	0xd63
+	.byte	0x78
+	.byte	0x17
+	.long	0x1893
+	.uleb128 0x1f
+	.long	0xd6f
+	.byte	0x78
+	.byte	0x25
+	.long	0x1893
+	.uleb128 0x1f
+	.long	0xd7b
+	.byte	0x78
+	.byte	0x33
+	.long	0x1893
+	.uleb128 0x13
+	.long	0x1d29
+	.long	0x1dbc
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2341
+	.byte	0x7b
+	.byte	0x13
+	.long	0x1dac
+	.uleb128 0x13
+	.long	0x39d
+	.long	0x1dd7
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2342
+	.byte	0x7c
+	.byte	0x14
+	.long	0x1dc7
+	.uleb128 0xa
+	.long	.LASF2343
+	.byte	0x7f
+	.byte	0x14
+	.long	0x39d
+	.uleb128 0xa
+	.long	.LASF2344
+	.byte	0x80
+	.byte	0xe
+	.long	0x11f
+	.uleb128 0xa
+	.long	.LASF1983
+	.byte	0x81
+	.byte	0xe
+	.long	0x11f
+	.uleb128 0xa
+	.long	.LASF1984
+	.byte	0x82
+	.byte	0xe
+	.long	0x11f
+	.uleb128 0xa
+	.long	.LASF1980
+	.byte	0x89
+	.byte	0xe
+	.long	0x11f
+	.uleb128 0xa
+	.long	.LASF1981
+	.byte	0x8a
+	.byte	0xe
+	.long	0x11f
+	.uleb128 0xa
+	.long	.LASF2345
+	.byte	0x8d
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0xa
+	.long	.LASF2346
+	.byte	0x8e
+	.byte	0xe
+	.long	0x11f
+	.uleb128 0xa
+	.long	.LASF2347
+	.byte	0x8f
+	.byte	0xe
+	.long	0x11f
+	.uleb128 0xa
+	.long	.LASF2348
+	.byte	0x91
+	.byte	0xe
+	.long	0x11f
+	.uleb128 0xa
+	.long	.LASF2349
+	.byte	0x93
+	.byte	0x10
+	.long	0xe5
+	.uleb128 0x5
+	.long	.LASF2350
+	.byte	0x1d
+	.byte	0x96
+	.byte	0x10
+	.long	0x1e67
+	.uleb128 0x8
+	.long	0x1e6c
+	.uleb128 0x23
+	.long	0x1e77
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2351
+	.byte	0x97
+	.byte	0x1b
+	.long	0x1e5b
+	.uleb128 0xa
+	.long	.LASF2352
+	.byte	0x98
+	.byte	0x19
+	.long	0x4dc
+	.uleb128 0xa
+	.long	.LASF2353
+	.byte	0x99
+	.byte	0x19
+	.long	0x4dc
+	.uleb128 0xa
+	.long	.LASF2354
+	.byte	0x9a
+	.byte	0x1d
+	.long	0xef6
+	.uleb128 0xc
+	.long	.LASF2355
+	.byte	0x1d
+	.byte	0x9c
+	.byte	0x1b
+	.long	0xd1f
+	.uleb128 0x13
+	.long	0xd13
+	.long	0x1ebf
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2356
+	.byte	0x9c
+	.byte	0x4b
+	.long	0x1eaf
+	.uleb128 0xa
+	.long	.LASF2357
+	.byte	0x9c
+	.byte	0x76
+	.long	0x1eaf
+	.uleb128 0x33
+	.long	0xd24
+	.byte	0x1d
+	.byte	0x9c
+	.byte	0x9f
+	.uleb128 0xc
+	.long	.LASF2358
+	.byte	0x1d
+	.byte	0x9c
+	.byte	0xd4
+	.long	0x243
+	.uleb128 0x34
+	.long	0x1edd
+	.byte	0xfc
+	.uleb128 0x35
+	.long	0x1ea3
+	.byte	0x9e
+	.byte	0x14
+	.uleb128 0x19
+	.long	.LASF2367
+	.byte	0x10
+	.byte	0xc4
+	.long	0x1f16
+	.uleb128 0x4
+	.long	0x340
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF2359
+	.byte	0x1e
+	.value	0x13d
+	.byte	0x11
+	.long	0xa0
+	.long	0x1f2d
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2360
+	.byte	0x9
+	.byte	0x85
+	.byte	0x7
+	.long	0x11f
+	.long	0x1f48
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2361
+	.byte	0x8
+	.byte	0x5d
+	.byte	0x7
+	.long	0x11f
+	.long	0x1f6d
+	.uleb128 0x4
+	.long	0x1f6d
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0x8
+	.long	0x35f
+	.uleb128 0x20
+	.long	.LASF2362
+	.byte	0x13
+	.byte	0x76
+	.byte	0x5
+	.long	0xef6
+	.uleb128 0x20
+	.long	.LASF2363
+	.byte	0x13
+	.byte	0x75
+	.byte	0x7
+	.long	0x11f
+	.uleb128 0xd
+	.long	.LASF2364
+	.byte	0x8
+	.byte	0x62
+	.byte	0x7
+	.long	0x11f
+	.long	0x1fa5
+	.uleb128 0x4
+	.long	0x1fa5
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0x8
+	.long	0x422
+	.uleb128 0xd
+	.long	.LASF2365
+	.byte	0x8
+	.byte	0x50
+	.byte	0x7
+	.long	0x11f
+	.long	0x1fc5
+	.uleb128 0x4
+	.long	0xb3
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2366
+	.byte	0x8
+	.byte	0x51
+	.byte	0x7
+	.long	0x11f
+	.long	0x1fea
+	.uleb128 0x4
+	.long	0xb3
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2368
+	.byte	0x12
+	.byte	0x4a
+	.long	0x1ffb
+	.uleb128 0x4
+	.long	0x1ffb
+	.byte	0
+	.uleb128 0x8
+	.long	0xdea
+	.uleb128 0xd
+	.long	.LASF2369
+	.byte	0x9
+	.byte	0xa0
+	.byte	0x7
+	.long	0x11f
+	.long	0x2016
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2370
+	.byte	0x9
+	.byte	0x9f
+	.byte	0x7
+	.long	0x11f
+	.long	0x202c
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2371
+	.byte	0xf
+	.byte	0xa3
+	.byte	0x5
+	.long	0xef6
+	.long	0x2042
+	.uleb128 0x4
+	.long	0x102
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2372
+	.byte	0x9
+	.byte	0x90
+	.byte	0x5
+	.long	0x88
+	.long	0x206c
+	.uleb128 0x4
+	.long	0x88
+	.uleb128 0x4
+	.long	0x88
+	.uleb128 0x4
+	.long	0x88
+	.uleb128 0x4
+	.long	0x88
+	.uleb128 0x4
+	.long	0x88
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2373
+	.value	0x1e7
+	.byte	0x5
+	.long	0xef6
+	.uleb128 0xd
+	.long	.LASF2374
+	.byte	0xd
+	.byte	0x70
+	.byte	0x9
+	.long	0xd4
+	.long	0x208e
+	.uleb128 0x4
+	.long	0xd4
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2375
+	.value	0x199
+	.byte	0x8
+	.long	0xbc
+	.uleb128 0x20
+	.long	.LASF2376
+	.byte	0x12
+	.byte	0x45
+	.byte	0x7
+	.long	0x11f
+	.uleb128 0xd
+	.long	.LASF2377
+	.byte	0xe
+	.byte	0x77
+	.byte	0x5
+	.long	0xef6
+	.long	0x20bc
+	.uleb128 0x4
+	.long	0x8a2
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2378
+	.value	0x198
+	.byte	0x5
+	.long	0xef6
+	.uleb128 0x19
+	.long	.LASF2379
+	.byte	0x1f
+	.byte	0x39
+	.long	0x20de
+	.uleb128 0x4
+	.long	0xe5
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2380
+	.byte	0x1c
+	.byte	0x50
+	.byte	0x9
+	.long	0xc8
+	.long	0x20f9
+	.uleb128 0x4
+	.long	0x13cb
+	.uleb128 0x4
+	.long	0xe5
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2381
+	.byte	0x8
+	.byte	0x59
+	.byte	0x7
+	.long	0x11f
+	.long	0x211e
+	.uleb128 0x4
+	.long	0x211e
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0x8
+	.long	0x39d
+	.uleb128 0xd
+	.long	.LASF2382
+	.byte	0x9
+	.byte	0x87
+	.byte	0x5
+	.long	0x88
+	.long	0x2143
+	.uleb128 0x4
+	.long	0x88
+	.uleb128 0x4
+	.long	0x88
+	.uleb128 0x4
+	.long	0x88
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2383
+	.byte	0x20
+	.byte	0xd2
+	.byte	0x9
+	.long	0xc8
+	.long	0x2159
+	.uleb128 0x4
+	.long	0x30
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2384
+	.byte	0x8
+	.byte	0x57
+	.byte	0x7
+	.long	0x11f
+	.long	0x2174
+	.uleb128 0x4
+	.long	0x211e
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2385
+	.byte	0x8
+	.byte	0x58
+	.byte	0x7
+	.long	0x11f
+	.long	0x2194
+	.uleb128 0x4
+	.long	0x211e
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2386
+	.byte	0x9
+	.byte	0x91
+	.byte	0x7
+	.long	0x11f
+	.long	0x21be
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF2387
+	.byte	0x9
+	.byte	0x88
+	.byte	0x7
+	.long	0x11f
+	.long	0x21de
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2388
+	.byte	0x8
+	.byte	0x5a
+	.long	0x21f4
+	.uleb128 0x4
+	.long	0x211e
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2389
+	.byte	0x13
+	.byte	0x73
+	.byte	0x5
+	.long	0x88
+	.uleb128 0x19
+	.long	.LASF2390
+	.byte	0x8
+	.byte	0x54
+	.long	0x221b
+	.uleb128 0x4
+	.long	0x211e
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2391
+	.byte	0x8
+	.byte	0x60
+	.long	0x2236
+	.uleb128 0x4
+	.long	0x1fa5
+	.uleb128 0x4
+	.long	0xf1
+	.uleb128 0x4
+	.long	0x102
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2392
+	.byte	0x8
+	.byte	0x53
+	.long	0x2251
+	.uleb128 0x4
+	.long	0x211e
+	.uleb128 0x4
+	.long	0x11f
+	.uleb128 0x4
+	.long	0x11f
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2393
+	.byte	0x21
+	.byte	0x8a
+	.byte	0xa
+	.long	0x102
+	.uleb128 0x26
+	.long	.LASF2394
+	.value	0x474
+	.byte	0xd
+	.long	0x2269
+	.uleb128 0x8
+	.long	0xafc
+	.uleb128 0x26
+	.long	.LASF2395
+	.value	0x471
+	.byte	0x13
+	.long	0x227a
+	.uleb128 0x8
+	.long	0xb08
+	.uleb128 0x1c
+	.long	.LASF2399
+	.value	0x414
+	.long	0x22b9
+	.uleb128 0x17
+	.long	0x22aa
+	.uleb128 0x3
+	.long	.LASF2396
+	.value	0x42b
+	.byte	0x12
+	.long	0xe5
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2332
+	.value	0x42c
+	.byte	0x18
+	.long	0xfd
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2397
+	.value	0x461
+	.byte	0x13
+	.long	0xefd
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2398
+	.value	0x403
+	.byte	0xb
+	.long	0xa80
+	.long	0x22d6
+	.uleb128 0x6
+	.long	.LASF2401
+	.value	0x403
+	.byte	0x26
+	.long	0xa4f
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2400
+	.value	0x3c7
+	.long	0x2333
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x3c7
+	.byte	0x1a
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF2402
+	.value	0x3cd
+	.byte	0x9
+	.long	0xef6
+	.uleb128 0x3
+	.long	.LASF2403
+	.value	0x3ce
+	.byte	0xd
+	.long	0xe5
+	.uleb128 0x17
+	.long	0x2324
+	.uleb128 0x3
+	.long	.LASF2396
+	.value	0x3d4
+	.byte	0xe
+	.long	0x88
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2314
+	.value	0x3d9
+	.byte	0xf
+	.long	0x11f
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2404
+	.value	0x3ee
+	.byte	0x15
+	.long	0x126
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2411
+	.value	0x3b4
+	.byte	0xd
+	.long	0x2394
+	.uleb128 0x6
+	.long	.LASF2341
+	.value	0x3b4
+	.byte	0x33
+	.long	0x2394
+	.uleb128 0x6
+	.long	.LASF2405
+	.value	0x3b4
+	.byte	0x45
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF2406
+	.value	0x3b6
+	.byte	0x14
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF2407
+	.value	0x3b7
+	.byte	0x12
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF2408
+	.value	0x3b8
+	.byte	0x12
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF2409
+	.value	0x3c1
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2410
+	.value	0x3c2
+	.byte	0x11
+	.long	0x126
+	.byte	0
+	.uleb128 0x8
+	.long	0x1d29
+	.uleb128 0x11
+	.long	.LASF2412
+	.value	0x37a
+	.byte	0xd
+	.long	0x23e4
+	.uleb128 0x6
+	.long	.LASF2341
+	.value	0x37a
+	.byte	0x2a
+	.long	0x2394
+	.uleb128 0x3
+	.long	.LASF2413
+	.value	0x37c
+	.byte	0x11
+	.long	0xdea
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2414
+	.value	0x38b
+	.byte	0x13
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF2415
+	.value	0x396
+	.byte	0x13
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF2416
+	.value	0x397
+	.byte	0x13
+	.long	0x11f
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2417
+	.value	0x340
+	.byte	0x7
+	.long	0x11f
+	.long	0x2418
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x340
+	.byte	0x1c
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF2418
+	.value	0x342
+	.byte	0xb
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF2419
+	.value	0x344
+	.byte	0xd
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2448
+	.value	0x322
+	.byte	0x10
+	.long	0xe5
+	.long	0x2443
+	.uleb128 0x3
+	.long	.LASF2420
+	.value	0x32a
+	.byte	0x9
+	.long	0x88
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2421
+	.value	0x334
+	.byte	0x37
+	.long	0xc8
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2422
+	.value	0x31e
+	.byte	0x9
+	.long	0xc8
+	.uleb128 0x1c
+	.long	.LASF2423
+	.value	0x318
+	.long	0x2467
+	.uleb128 0x6
+	.long	.LASF2424
+	.value	0x318
+	.byte	0x25
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2425
+	.value	0x313
+	.long	0x247f
+	.uleb128 0x6
+	.long	.LASF2424
+	.value	0x313
+	.byte	0x26
+	.long	0xc8
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2426
+	.value	0x30e
+	.byte	0xd
+	.long	0x2497
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x30e
+	.byte	0x27
+	.long	0x11f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2427
+	.value	0x302
+	.byte	0xd
+	.long	0x24bd
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x302
+	.byte	0x20
+	.long	0x11f
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2396
+	.value	0x304
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2428
+	.value	0x300
+	.byte	0xd
+	.long	0x24d5
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x300
+	.byte	0x31
+	.long	0x11f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2429
+	.value	0x2ff
+	.byte	0xd
+	.long	0x24ed
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x2ff
+	.byte	0x35
+	.long	0x11f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2430
+	.value	0x2fe
+	.byte	0xd
+	.long	0x2505
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x2fe
+	.byte	0x28
+	.long	0x11f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2431
+	.value	0x2fd
+	.byte	0xd
+	.long	0x251d
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x2fd
+	.byte	0x2b
+	.long	0x11f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2432
+	.value	0x2fc
+	.byte	0xd
+	.long	0x2535
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x2fc
+	.byte	0x2f
+	.long	0x11f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2433
+	.value	0x2fb
+	.byte	0xd
+	.long	0x254d
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x2fb
+	.byte	0x22
+	.long	0x11f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2434
+	.value	0x2df
+	.byte	0x34
+	.long	0x25a3
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x2df
+	.byte	0x5d
+	.long	0x11f
+	.uleb128 0x6
+	.long	.LASF2397
+	.value	0x2df
+	.byte	0x52
+	.long	0xefd
+	.uleb128 0x6
+	.long	.LASF2435
+	.value	0x2df
+	.byte	0x68
+	.long	0xefd
+	.uleb128 0x6
+	.long	.LASF2436
+	.value	0x2df
+	.byte	0x8e
+	.long	0xb51
+	.uleb128 0x3
+	.long	.LASF2330
+	.value	0x2e8
+	.byte	0xf
+	.long	0xefd
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2396
+	.value	0x2ea
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2437
+	.value	0x298
+	.byte	0x34
+	.long	0x2671
+	.uleb128 0x6
+	.long	.LASF2341
+	.value	0x298
+	.byte	0x62
+	.long	0x2394
+	.uleb128 0x6
+	.long	.LASF2396
+	.value	0x298
+	.byte	0x84
+	.long	0x334
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x298
+	.byte	0x90
+	.long	0x11f
+	.uleb128 0x6
+	.long	.LASF2397
+	.value	0x299
+	.byte	0x47
+	.long	0xefd
+	.uleb128 0x6
+	.long	.LASF2435
+	.value	0x299
+	.byte	0x5d
+	.long	0xefd
+	.uleb128 0x6
+	.long	.LASF2436
+	.value	0x299
+	.byte	0x83
+	.long	0xb51
+	.uleb128 0x3
+	.long	.LASF2438
+	.value	0x29b
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2439
+	.value	0x29c
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2440
+	.value	0x29e
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2441
+	.value	0x29f
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2442
+	.value	0x2a5
+	.byte	0xb
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF2443
+	.value	0x2ae
+	.byte	0xb
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF2444
+	.value	0x2c0
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2445
+	.value	0x2c1
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2446
+	.value	0x2c3
+	.byte	0xb
+	.long	0x11f
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2447
+	.value	0x2b3
+	.byte	0xf
+	.long	0x11f
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2449
+	.value	0x282
+	.byte	0x35
+	.long	0x11f
+	.long	0x26ef
+	.uleb128 0x6
+	.long	.LASF2341
+	.value	0x282
+	.byte	0x4d
+	.long	0x2394
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x282
+	.byte	0x5d
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF2450
+	.value	0x283
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2451
+	.value	0x284
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2452
+	.value	0x285
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2453
+	.value	0x287
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2454
+	.value	0x288
+	.byte	0xb
+	.long	0x11f
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2455
+	.value	0x287
+	.byte	0x56
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2456
+	.value	0x287
+	.byte	0x9c
+	.long	0x126
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2457
+	.value	0x26d
+	.byte	0x34
+	.long	0x2776
+	.uleb128 0x6
+	.long	.LASF2396
+	.value	0x26d
+	.byte	0x4e
+	.long	0x8f
+	.uleb128 0x6
+	.long	.LASF2313
+	.value	0x26d
+	.byte	0x60
+	.long	0x126
+	.uleb128 0x6
+	.long	.LASF2458
+	.value	0x26d
+	.byte	0x70
+	.long	0x11f
+	.uleb128 0x6
+	.long	.LASF2446
+	.value	0x26d
+	.byte	0x8b
+	.long	0x4c6
+	.uleb128 0x6
+	.long	.LASF2436
+	.value	0x26d
+	.byte	0xb2
+	.long	0xb51
+	.uleb128 0x3
+	.long	.LASF2459
+	.value	0x26f
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2460
+	.value	0x270
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2461
+	.value	0x272
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2462
+	.value	0x272
+	.byte	0x45
+	.long	0x88
+	.uleb128 0x3
+	.long	.LASF2463
+	.value	0x272
+	.byte	0x77
+	.long	0x11f
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2464
+	.value	0x24e
+	.byte	0x34
+	.long	0x27ca
+	.uleb128 0x6
+	.long	.LASF2341
+	.value	0x24e
+	.byte	0x60
+	.long	0x2394
+	.uleb128 0x6
+	.long	.LASF2396
+	.value	0x24e
+	.byte	0x82
+	.long	0x334
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x24e
+	.byte	0x8e
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF2438
+	.value	0x250
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2439
+	.value	0x251
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2465
+	.value	0x252
+	.byte	0x11
+	.long	0x126
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2466
+	.value	0x246
+	.byte	0xd
+	.long	0x27e3
+	.uleb128 0x6
+	.long	.LASF2341
+	.value	0x246
+	.byte	0x2c
+	.long	0x2394
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2467
+	.value	0x240
+	.byte	0xe
+	.long	0x11f
+	.long	0x2823
+	.uleb128 0x6
+	.long	.LASF2341
+	.value	0x240
+	.byte	0x27
+	.long	0x2394
+	.uleb128 0x6
+	.long	.LASF2438
+	.value	0x240
+	.byte	0x37
+	.long	0x11f
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x240
+	.byte	0x48
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF2439
+	.value	0x241
+	.byte	0xb
+	.long	0x11f
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2468
+	.value	0x233
+	.byte	0x5
+	.long	0xef6
+	.long	0x2840
+	.uleb128 0x6
+	.long	.LASF2324
+	.value	0x233
+	.byte	0x27
+	.long	0x11f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2469
+	.value	0x22c
+	.byte	0xd
+	.long	0x2864
+	.uleb128 0x6
+	.long	.LASF2341
+	.value	0x22c
+	.byte	0x36
+	.long	0x2394
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x22c
+	.byte	0x46
+	.long	0x11f
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2470
+	.value	0x206
+	.byte	0xd
+	.long	0x28de
+	.uleb128 0x6
+	.long	.LASF2341
+	.value	0x206
+	.byte	0x22
+	.long	0x2394
+	.uleb128 0x6
+	.long	.LASF2396
+	.value	0x206
+	.byte	0x44
+	.long	0x334
+	.uleb128 0x6
+	.long	.LASF2404
+	.value	0x206
+	.byte	0x50
+	.long	0x11f
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x206
+	.byte	0x6c
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF2471
+	.value	0x209
+	.byte	0xb
+	.long	0x11f
+	.uleb128 0x3
+	.long	.LASF2472
+	.value	0x20f
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2473
+	.value	0x211
+	.byte	0xb
+	.long	0x11f
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2474
+	.value	0x20d
+	.byte	0x44
+	.long	0x88
+	.uleb128 0x3
+	.long	.LASF2475
+	.value	0x20d
+	.byte	0x94
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2476
+	.value	0x1f1
+	.byte	0xe
+	.long	0x11f
+	.long	0x2969
+	.uleb128 0x3
+	.long	.LASF2477
+	.value	0x1f4
+	.byte	0x13
+	.long	0xe0
+	.uleb128 0x3
+	.long	.LASF2478
+	.value	0x1f5
+	.byte	0x13
+	.long	0xe0
+	.uleb128 0x3
+	.long	.LASF2479
+	.value	0x1f6
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2480
+	.value	0x1f7
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x3
+	.long	.LASF2404
+	.value	0x1f9
+	.byte	0xb
+	.long	0x11f
+	.uleb128 0x17
+	.long	0x293c
+	.uleb128 0x3
+	.long	.LASF2481
+	.value	0x1f4
+	.byte	0x5e
+	.long	0xd4
+	.byte	0
+	.uleb128 0x17
+	.long	0x294e
+	.uleb128 0x3
+	.long	.LASF2482
+	.value	0x1f5
+	.byte	0x5f
+	.long	0xd4
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2483
+	.value	0x1f6
+	.byte	0x5e
+	.long	0xe0
+	.uleb128 0x3
+	.long	.LASF2484
+	.value	0x1f6
+	.byte	0x8e
+	.long	0xe0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2485
+	.value	0x1aa
+	.long	0x29da
+	.uleb128 0xf
+	.string	"dT"
+	.value	0x1aa
+	.byte	0x22
+	.long	0x11f
+	.uleb128 0x37
+	.long	.LASF2486
+	.byte	0x1d
+	.value	0x1ac
+	.byte	0x4b
+	.long	0xf1
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF2487
+	.value	0x1cf
+	.byte	0x11
+	.long	0x126
+	.uleb128 0x17
+	.long	0x29ab
+	.uleb128 0x3
+	.long	.LASF2488
+	.value	0x1b0
+	.byte	0x12
+	.long	0xf1
+	.byte	0
+	.uleb128 0x17
+	.long	0x29bd
+	.uleb128 0x3
+	.long	.LASF2396
+	.value	0x1c6
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2396
+	.value	0x1d3
+	.byte	0xe
+	.long	0x88
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2489
+	.value	0x1de
+	.byte	0x19
+	.long	0x126
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2503
+	.value	0x1a5
+	.uleb128 0x1b
+	.long	.LASF2490
+	.value	0x195
+	.byte	0xe
+	.long	0x11f
+	.long	0x29fe
+	.uleb128 0x3
+	.long	.LASF2487
+	.value	0x197
+	.byte	0xb
+	.long	0x11f
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2491
+	.value	0x179
+	.byte	0xe
+	.long	0x11f
+	.long	0x2a27
+	.uleb128 0x6
+	.long	.LASF1819
+	.value	0x179
+	.byte	0x33
+	.long	0xf1
+	.uleb128 0x3
+	.long	.LASF2487
+	.value	0x17b
+	.byte	0xb
+	.long	0x11f
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2492
+	.value	0x173
+	.byte	0x7
+	.long	0x11f
+	.long	0x2a5c
+	.uleb128 0x6
+	.long	.LASF2493
+	.value	0x173
+	.byte	0x22
+	.long	0xc8
+	.uleb128 0x6
+	.long	.LASF2494
+	.value	0x173
+	.byte	0x31
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF2495
+	.value	0x175
+	.byte	0x11
+	.long	0x126
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2496
+	.value	0x16d
+	.byte	0x7
+	.long	0x11f
+	.long	0x2a91
+	.uleb128 0x6
+	.long	.LASF2497
+	.value	0x16d
+	.byte	0x20
+	.long	0x11f
+	.uleb128 0x6
+	.long	.LASF2494
+	.value	0x16d
+	.byte	0x31
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF2495
+	.value	0x16f
+	.byte	0x11
+	.long	0x126
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2498
+	.value	0x162
+	.byte	0x9
+	.long	0xc8
+	.long	0x2aba
+	.uleb128 0x6
+	.long	.LASF2499
+	.value	0x162
+	.byte	0x23
+	.long	0x11f
+	.uleb128 0x6
+	.long	.LASF2500
+	.value	0x162
+	.byte	0x3d
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF2501
+	.value	0x15c
+	.byte	0xe
+	.long	0x11f
+	.long	0x2ae3
+	.uleb128 0x6
+	.long	.LASF2493
+	.value	0x15c
+	.byte	0x2a
+	.long	0xc8
+	.uleb128 0x6
+	.long	.LASF2500
+	.value	0x15c
+	.byte	0x39
+	.long	0xc8
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2502
+	.value	0x153
+	.long	0x2afd
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2396
+	.value	0x156
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2504
+	.value	0x14b
+	.uleb128 0x1a
+	.long	.LASF2505
+	.value	0x114
+	.byte	0x5
+	.long	0xef6
+	.long	0x2b76
+	.uleb128 0x3
+	.long	.LASF2506
+	.value	0x116
+	.byte	0x14
+	.long	0x10e
+	.uleb128 0x17
+	.long	0x2b32
+	.uleb128 0x3
+	.long	.LASF2396
+	.value	0x11e
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.uleb128 0x17
+	.long	0x2b44
+	.uleb128 0x3
+	.long	.LASF2396
+	.value	0x129
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.uleb128 0x17
+	.long	0x2b55
+	.uleb128 0x38
+	.string	"i"
+	.byte	0x1d
+	.value	0x132
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x17
+	.long	0x2b67
+	.uleb128 0x3
+	.long	.LASF2396
+	.value	0x13b
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x3
+	.long	.LASF2396
+	.value	0x141
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2507
+	.byte	0x17
+	.byte	0xe2
+	.byte	0x6a
+	.long	0x2b82
+	.uleb128 0x8
+	.long	0x1882
+	.uleb128 0x21
+	.long	.LASF2508
+	.byte	0x13
+	.byte	0x61
+	.byte	0x74
+	.long	0x2b93
+	.uleb128 0x8
+	.long	0xfba
+	.uleb128 0x21
+	.long	.LASF2509
+	.byte	0x13
+	.byte	0x49
+	.byte	0x74
+	.long	0x2ba4
+	.uleb128 0x8
+	.long	0xf0e
+	.uleb128 0x21
+	.long	.LASF2510
+	.byte	0x10
+	.byte	0xa0
+	.byte	0xa6
+	.long	0xd30
+	.uleb128 0x21
+	.long	.LASF2511
+	.byte	0x10
+	.byte	0xa0
+	.byte	0x53
+	.long	0x2bc1
+	.uleb128 0x8
+	.long	0xd1f
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 23
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0x21
+	.sleb128 4
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 29
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x88
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x38
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 34 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 35 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 36 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x24
+	.file 37 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x26
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 39 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 40 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x28
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2a
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 43 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 45 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x2d
+	.file 46 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2a
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 50 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x33
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF976
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1003
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 59 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3b
+	.file 60 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 61 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x3d
+	.file 62 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 63 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x3f
+	.byte	0x4
+	.file 64 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1322
+	.file 65 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x41
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 66 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x42
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.file 67 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x21
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1510
+	.byte	0x4
+	.file 68 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1511
+	.byte	0x4
+	.file 69 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1523
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xe
+	.file 70 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x46
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x11
+	.byte	0x4
+	.file 71 "./src/main/common/quaternion.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x47
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 72 "./src/main/flight/rpm_filter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x16
+	.file 73 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x49
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1583
+	.byte	0x4
+	.file 74 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4a
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1584
+	.file 75 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x4
+	.file 76 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4c
+	.file 77 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1597
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 78 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x17
+	.file 79 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4f
+	.byte	0x4
+	.file 80 "./src/main/flight/failsafe.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.file 81 "./src/main/sensors/acceleration.h"
+	.byte	0x3
+	.uleb128 0x39
+	.uleb128 0x51
+	.file 82 "./src/main/drivers/accgyro/accgyro.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x52
+	.file 83 "./src/main/drivers/exti.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.file 84 "./src/main/sensors/compass.h"
+	.byte	0x3
+	.uleb128 0x3a
+	.uleb128 0x54
+	.file 85 "./src/main/drivers/compass/compass.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x55
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x19
+	.file 86 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.file 87 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x57
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1691
+	.file 88 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x58
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1692
+	.byte	0x4
+	.byte	0x4
+	.file 89 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3c
+	.uleb128 0x1c
+	.file 90 "./src/main/common/logic_condition.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1698
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1706
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF968
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF975
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF997
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1002
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1005
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1007
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1022
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1032
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1035
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1023
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1024
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1025
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1026
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1096
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1189
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1202
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1221
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1238
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1239
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1240
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1242
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1244
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1269
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1272
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1274
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1275
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1276
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1287
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1288
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1289
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1290
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1306
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1308
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1314
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1333
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1336
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1359
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1369
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1371
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1374
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1410
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1438
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1507
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1509
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1514
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.controlrate_profile.h.24.a29fb23b15b994a8ab0c8a938d2fe4c7,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1522
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1527
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1537
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1548
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1571
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1580
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rpm_filter.h.46.638ccbdb612f529ec85646b839a0f5ec,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1582
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1596
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1614
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.53.b0572c40fe419f4a50a6d38b60eada44,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.kalman.h.26.85424e40cb4929a2f1a029e26fa2572b,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1622
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1630
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1638
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1641
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1669
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.42.8e2e5ec4be4bbc896da78d2242718f91,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1673
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.accgyro.h.26.c216749ed1719625534279293524b224,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1682
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.acceleration.h.27.660fcdd2e4bcff931374bf2e31ee90e0,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1687
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1203
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1222
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1240
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1242
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1244
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1689
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pitotmeter.h.35.88e0fa507f1d3021c3ba40f69b4ff33a,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.global_functions.h.29.fb1af0cee01f455e1be8fe7fa6b2a019,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1702
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x16
+	.long	.LASF1
+	.long	.LASF2514
+	.long	.LASF2515
+	.long	.LASF2516
+	.long	.LASF2517
+	.long	.LASF2518
+	.long	.LASF2519
+	.long	.LASF2520
+	.long	.LASF2521
+	.long	.LASF2522
+	.long	.LASF2523
+	.long	.LASF2524
+	.long	.LASF2525
+	.long	.LASF2526
+	.long	.LASF2527
+	.long	.LASF2528
+	.long	.LASF2529
+	.long	.LASF2530
+	.long	.LASF2531
+	.long	.LASF2532
+	.long	.LASF2533
+	.long	.LASF2534
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x5b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2535
+	.byte	0x11
+	.long	.LASF2536
+	.byte	0x11
+	.long	.LASF2537
+	.byte	0x11
+	.long	.LASF2538
+	.byte	0x1
+	.long	.LASF2539
+	.byte	0x3
+	.long	.LASF2540
+	.byte	0x2
+	.long	.LASF2541
+	.byte	0x2
+	.long	.LASF2542
+	.byte	0x2
+	.long	.LASF2543
+	.byte	0x2
+	.long	.LASF2544
+	.byte	0x6
+	.long	.LASF2545
+	.byte	0x6
+	.long	.LASF2546
+	.byte	0x7
+	.long	.LASF2547
+	.byte	0x7
+	.long	.LASF2548
+	.byte	0x7
+	.long	.LASF2549
+	.byte	0x7
+	.long	.LASF2550
+	.byte	0x8
+	.long	.LASF2551
+	.byte	0x2
+	.long	.LASF2552
+	.byte	0x8
+	.long	.LASF2553
+	.byte	0x8
+	.long	.LASF2554
+	.byte	0x6
+	.long	.LASF2555
+	.byte	0x6
+	.long	.LASF2556
+	.byte	0xc
+	.long	.LASF2557
+	.byte	0xa
+	.long	.LASF2558
+	.byte	0xc
+	.long	.LASF2559
+	.byte	0x2
+	.long	.LASF2560
+	.byte	0x6
+	.long	.LASF2560
+	.byte	0xc
+	.long	.LASF2561
+	.byte	0x2
+	.long	.LASF2562
+	.byte	0x8
+	.long	.LASF2563
+	.byte	0x11
+	.long	.LASF2564
+	.byte	0x8
+	.long	.LASF2565
+	.byte	0xb
+	.long	.LASF2566
+	.byte	0x7
+	.long	.LASF2567
+	.byte	0x14
+	.long	.LASF2568
+	.byte	0x15
+	.long	.LASF2569
+	.byte	0x15
+	.long	.LASF2569
+	.byte	0x14
+	.long	.LASF2570
+	.byte	0x11
+	.long	.LASF2571
+	.byte	0x14
+	.long	.LASF2572
+	.byte	0x14
+	.long	.LASF2573
+	.byte	0x11
+	.long	.LASF2574
+	.byte	0x11
+	.long	.LASF2575
+	.byte	0x13
+	.long	.LASF2576
+	.byte	0x11
+	.long	.LASF2577
+	.byte	0x12
+	.long	.LASF2578
+	.byte	0x12
+	.long	.LASF2579
+	.byte	0x11
+	.long	.LASF2580
+	.byte	0x11
+	.long	.LASF2581
+	.byte	0x11
+	.long	.LASF2582
+	.byte	0x14
+	.long	.LASF2583
+	.byte	0x11
+	.long	.LASF2584
+	.byte	0x11
+	.long	.LASF2585
+	.byte	0x11
+	.long	.LASF2586
+	.byte	0x11
+	.long	.LASF2587
+	.byte	0x11
+	.long	.LASF2588
+	.byte	0x11
+	.long	.LASF2589
+	.byte	0x11
+	.long	.LASF2590
+	.byte	0x11
+	.long	.LASF2591
+	.byte	0xf
+	.long	.LASF2592
+	.byte	0xe
+	.long	.LASF2593
+	.byte	0xd
+	.long	.LASF2594
+	.byte	0x15
+	.long	.LASF2595
+	.byte	0xe
+	.long	.LASF2596
+	.byte	0xe
+	.long	.LASF2597
+	.byte	0x1
+	.long	.LASF2598
+	.byte	0x2
+	.long	.LASF2599
+	.byte	0x3
+	.long	.LASF2600
+	.byte	0x6
+	.long	.LASF2601
+	.byte	0x7
+	.long	.LASF2602
+	.byte	0x2
+	.long	.LASF2603
+	.byte	0x2
+	.long	.LASF2604
+	.byte	0x8
+	.long	.LASF2605
+	.byte	0x6
+	.long	.LASF2606
+	.byte	0x6
+	.long	.LASF2607
+	.byte	0x6
+	.long	.LASF2608
+	.byte	0x6
+	.long	.LASF2609
+	.byte	0x6
+	.long	.LASF2610
+	.byte	0x9
+	.long	.LASF2611
+	.byte	0x3
+	.long	.LASF2612
+	.byte	0x8
+	.long	.LASF2613
+	.byte	0xc
+	.long	.LASF2614
+	.byte	0x4
+	.long	.LASF2615
+	.byte	0x6
+	.long	.LASF2616
+	.byte	0xc
+	.long	.LASF2616
+	.byte	0x5
+	.long	.LASF2617
+	.byte	0x14
+	.long	.LASF2618
+	.byte	0x10
+	.long	.LASF2619
+	.byte	0x10
+	.long	.LASF2620
+	.byte	0x14
+	.long	.LASF2621
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2366:
+	.string	"nullFilterApply4"
+.LASF1152:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF2209:
+	.string	"auto_disarm_delay"
+.LASF2314:
+	.string	"rateTarget"
+.LASF730:
+	.string	"__DECL_SIMD_logf "
+.LASF1125:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1621:
+	.string	"MAX_KALMAN_WINDOW_SIZE 512"
+.LASF935:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF963:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF2456:
+	.string	"_right9"
+.LASF1101:
+	.string	"USE_RX_PPM "
+.LASF1248:
+	.string	"USE_FAKE_BARO "
+.LASF741:
+	.string	"__DECL_SIMD_expl "
+.LASF1252:
+	.string	"USE_BARO "
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1349:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1936:
+	.string	"PID_VEL_Z"
+.LASF1648:
+	.string	"MIDRC_MIN 1200"
+.LASF1827:
+	.string	"THROTTLE"
+.LASF848:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1523:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1232:
+	.string	"_WCHAR_T_DEFINED "
+.LASF2210:
+	.string	"braking_speed_threshold"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF839:
+	.string	"__DECL_SIMD_sinh "
+.LASF1377:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1485:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1259:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF767:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1851:
+	.string	"BOXMANUAL"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1805:
+	.string	"ADC_BATTERY"
+.LASF1513:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1215:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2289:
+	.string	"calculate"
+.LASF2416:
+	.string	"coordinatedTurnRateEarthFrame"
+.LASF1176:
+	.string	"USE_SERIALRX_CRSF "
+.LASF903:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF2226:
+	.string	"max_throttle"
+.LASF740:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2352:
+	.string	"dTermLpfFilterApplyFn"
+.LASF2060:
+	.string	"OWNER_RX_SPI"
+.LASF2318:
+	.string	"errorGyroIfLimit"
+.LASF798:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1337:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF843:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF959:
+	.string	"__DECL_SIMD_tan "
+.LASF944:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1156:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1799:
+	.string	"m_newM"
+.LASF1906:
+	.string	"ANTI_WINDUP"
+.LASF1713:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1932:
+	.string	"PID_VEL_XY"
+.LASF1801:
+	.string	"m_newS"
+.LASF1863:
+	.string	"BOXGCSNAV"
+.LASF1376:
+	.string	"FAST_MATH "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF2017:
+	.string	"_Bool"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF865:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF2292:
+	.string	"pito_s"
+.LASF698:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1296:
+	.string	"U_ID_2 2"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1041:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1795:
+	.string	"filterApplyFnPtr"
+.LASF907:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF749:
+	.string	"__DECL_SIMD_pow "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2489:
+	.string	"axisTPA"
+.LASF2144:
+	.string	"DEVHW_M25P16"
+.LASF1698:
+	.string	"MAX_LOGIC_CONDITIONS 16"
+.LASF835:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1689:
+	.string	"__need_size_t "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1996:
+	.string	"HEADING_HOLD_UPDATE_HEADING"
+.LASF1508:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1935:
+	.string	"PID_HEADING"
+.LASF1628:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1116:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1876:
+	.string	"BOXNAVCRUISE"
+.LASF884:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2014:
+	.string	"hasFlaps"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2312:
+	.string	"GLOBAL_FUNCTION_ACTION_LAST"
+.LASF1657:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1773:
+	.string	"DEBUG_COUNT"
+.LASF2460:
+	.string	"setpointHpf"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF804:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1611:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF1313:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1878:
+	.string	"BOXUSER1"
+.LASF1879:
+	.string	"BOXUSER2"
+.LASF1543:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF836:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF744:
+	.string	"__DECL_SIMD_expf64 "
+.LASF2500:
+	.string	"maxInclination"
+.LASF1390:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1571:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF2491:
+	.string	"calculateFixedWingTPAFactor"
+.LASF1536:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF1102:
+	.string	"USE_SERIAL_RX "
+.LASF1077:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF2254:
+	.string	"SENSOR_INDEX_RANGEFINDER"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1124:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF715:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1159:
+	.string	"USE_CMS "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF2504:
+	.string	"pidResetTPAFilter"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1364:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF841:
+	.string	"__DECL_SIMD_sinhl "
+.LASF764:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1072:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1441:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2057:
+	.string	"OWNER_LED"
+.LASF703:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1562:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF1766:
+	.string	"DEBUG_NAV_YAW"
+.LASF1528:
+	.string	"BOXID_NONE 255"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1185:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1726:
+	.string	"uint16_t"
+.LASF2082:
+	.string	"RESOURCE_SPI_SCK"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF1386:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF2039:
+	.string	"OWNER_SOFTSERIAL"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF2225:
+	.string	"min_throttle"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2493:
+	.string	"stick"
+.LASF2122:
+	.string	"DEVHW_AK8975"
+.LASF947:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1292:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF861:
+	.string	"__DECL_SIMD_atan2l "
+.LASF2106:
+	.string	"DEVHW_MPU6000"
+.LASF2374:
+	.string	"getRcStickDeflection"
+.LASF1071:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1302:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1321:
+	.string	"__NO_TRAPPING_MATH__ 1"
+.LASF775:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1146:
+	.string	"USE_OLED_UG2864 "
+.LASF2200:
+	.string	"rth_altitude"
+.LASF1097:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF2243:
+	.string	"allow_manual_thr_increase"
+.LASF2249:
+	.string	"navConfig_System"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF2425:
+	.string	"updateHeadingHoldTarget"
+.LASF1652:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF2223:
+	.string	"cruise_speed"
+.LASF1462:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1027:
+	.string	"_Mdouble_ float"
+.LASF713:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1444:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1525:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF1479:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF2059:
+	.string	"OWNER_TX"
+.LASF2205:
+	.string	"rth_home_offset_distance"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF2032:
+	.string	"motorConfig_System"
+.LASF2241:
+	.string	"launch_max_angle"
+.LASF1556:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF1593:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1814:
+	.string	"fixedWingTauMs"
+.LASF950:
+	.string	"__DECL_SIMD_erfcf "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1995:
+	.string	"HEADING_HOLD_DISABLED"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF2214:
+	.string	"braking_boost_timeout"
+.LASF1264:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1430:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1903:
+	.string	"CALIBRATE_MAG"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1223:
+	.string	"__wchar_t__ "
+.LASF1818:
+	.string	"controlRateConfig_s"
+.LASF1823:
+	.string	"controlRateConfig_t"
+.LASF732:
+	.string	"__DECL_SIMD_logf16 "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1459:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF1764:
+	.string	"DEBUG_RPM_FILTER"
+.LASF2280:
+	.string	"stdDev"
+.LASF1683:
+	.string	"GRAVITY_CMSS 980.665f"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1578:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1993:
+	.string	"axisPID_D"
+.LASF2306:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_ROLL"
+.LASF1992:
+	.string	"axisPID_I"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1991:
+	.string	"axisPID_P"
+.LASF2013:
+	.string	"platformType"
+.LASF788:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2390:
+	.string	"pt1FilterInitRC"
+.LASF2071:
+	.string	"RESOURCE_NONE"
+.LASF1929:
+	.string	"PID_YAW"
+.LASF2507:
+	.string	"navConfig"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF731:
+	.string	"__DECL_SIMD_logl "
+.LASF2386:
+	.string	"scaleRangef"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF720:
+	.string	"__DECL_SIMD_sincosf "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1194:
+	.string	"_T_PTRDIFF_ "
+.LASF1147:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF968:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1484:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF897:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1426:
+	.string	"BIT(x) (1 << (x))"
+.LASF2051:
+	.string	"OWNER_BEEPER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1933:
+	.string	"PID_SURFACE"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF949:
+	.string	"__DECL_SIMD_erfc "
+.LASF2204:
+	.string	"max_terrain_follow_altitude"
+.LASF814:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1446:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1023:
+	.string	"_Mdouble_"
+.LASF1724:
+	.string	"int32_t"
+.LASF1357:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF971:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2080:
+	.string	"RESOURCE_I2C_SCL"
+.LASF1644:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1247:
+	.string	"USE_IMU_FAKE "
+.LASF993:
+	.string	"__f64x(x) x ##f64x"
+.LASF1501:
+	.string	"PG_INAV_END 1023"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2006:
+	.string	"PLATFORM_HELICOPTER"
+.LASF2149:
+	.string	"busDeviceDescriptor_s"
+.LASF2157:
+	.string	"busDeviceDescriptor_t"
+.LASF923:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1692:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2125:
+	.string	"DEVHW_IST8308"
+.LASF818:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2062:
+	.string	"OWNER_SPI_PREINIT"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1526:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF1582:
+	.string	"RPM_FILTER_UPDATE_RATE_US (1000000.0f / RPM_FILTER_UPDATE_RATE_HZ)"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF2072:
+	.string	"RESOURCE_INPUT"
+.LASF953:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1511:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2468:
+	.string	"isFixedWingItermLimitActive"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1542:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1268:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1966:
+	.string	"axisAccelerationLimitYaw"
+.LASF2379:
+	.string	"gyroKalmanSetSetpoint"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1453:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF2372:
+	.string	"scaleRange"
+.LASF1287:
+	.string	"USE_RX_PPM"
+.LASF2279:
+	.string	"accumulatedValue"
+.LASF2081:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF924:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2019:
+	.string	"mixerConfig_System"
+.LASF2373:
+	.string	"navigationIsControllingThrottle"
+.LASF838:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF837:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1663:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF1918:
+	.string	"AIRPLANE"
+.LASF2001:
+	.string	"values"
+.LASF2422:
+	.string	"getHeadingHoldTarget"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2487:
+	.string	"tpaFactor"
+.LASF1941:
+	.string	"PID_TYPE_PID"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2113:
+	.string	"DEVHW_BMP280"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1465:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1024:
+	.string	"__MATH_PRECNAME"
+.LASF874:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF2308:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_YAW"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1054:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1307:
+	.string	"FAST_CODE "
+.LASF1134:
+	.string	"USE_OPFLOW "
+.LASF1736:
+	.string	"PGR_SIZE_MASK"
+.LASF1896:
+	.string	"NAV_WP_MODE"
+.LASF1779:
+	.string	"rateLimitFilter_s"
+.LASF1781:
+	.string	"rateLimitFilter_t"
+.LASF2339:
+	.string	"pidFiltersConfigured"
+.LASF1056:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF2285:
+	.string	"pitotDev_s"
+.LASF2291:
+	.string	"pitotDev_t"
+.LASF2151:
+	.string	"busType"
+.LASF2170:
+	.string	"gyroADCf"
+.LASF1521:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_DEFAULT 20"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2176:
+	.string	"NAV_HEADING_CONTROL_NONE"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1011:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1143:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1208:
+	.string	"_T_SIZE_ "
+.LASF2137:
+	.string	"DEVHW_DS2482"
+.LASF1250:
+	.string	"USE_FAKE_GPS "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1404:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF1797:
+	.string	"stdev_s"
+.LASF1802:
+	.string	"stdev_t"
+.LASF1777:
+	.string	"flight_dynamics_index_t"
+.LASF2187:
+	.string	"rth_climb_ignore_emerg"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF2107:
+	.string	"DEVHW_MPU6050"
+.LASF1144:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF697:
+	.string	"_MATH_H 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1982:
+	.string	"dBoostGyroDeltaLpfHz"
+.LASF1045:
+	.string	"__MATHDECL_1"
+.LASF2454:
+	.string	"dBoost"
+.LASF1470:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF2050:
+	.string	"OWNER_USB"
+.LASF2326:
+	.string	"previousRateGyro"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF997:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF396:
+	.string	"false 0"
+.LASF2070:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1819:
+	.string	"throttle"
+.LASF1351:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1219:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF981:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1392:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2477:
+	.string	"stickPosAil"
+.LASF1843:
+	.string	"BOXHORIZON"
+.LASF863:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1885:
+	.string	"ANGLE_MODE"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF2233:
+	.string	"launch_idle_throttle"
+.LASF1353:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1761:
+	.string	"DEBUG_ACC"
+.LASF833:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1745:
+	.string	"timeDelta_t"
+.LASF2190:
+	.string	"waypoint_radius"
+.LASF1541:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF799:
+	.string	"__DECL_SIMD_exp2 "
+.LASF2030:
+	.string	"motorPoleCount"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1169:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF817:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1203:
+	.string	"__need_ptrdiff_t"
+.LASF2129:
+	.string	"DEVHW_LM75_0"
+.LASF2131:
+	.string	"DEVHW_LM75_2"
+.LASF1960:
+	.string	"dterm_lpf_hz"
+.LASF2133:
+	.string	"DEVHW_LM75_4"
+.LASF1949:
+	.string	"ITERM_RELAX_OFF"
+.LASF2135:
+	.string	"DEVHW_LM75_6"
+.LASF2136:
+	.string	"DEVHW_LM75_7"
+.LASF2410:
+	.string	"yawRate"
+.LASF1019:
+	.string	"_Mdouble_ double"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1940:
+	.string	"PID_TYPE_NONE"
+.LASF2260:
+	.string	"SENSOR_BARO"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2450:
+	.string	"dBoostGyroDelta"
+.LASF1601:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF2221:
+	.string	"max_dive_angle"
+.LASF1421:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1371:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1747:
+	.string	"timeUs_t"
+.LASF1494:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF1612:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF2470:
+	.string	"pidLevel"
+.LASF1069:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1533:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF2392:
+	.string	"pt1FilterInit"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1340:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2038:
+	.string	"OWNER_SERVO"
+.LASF1429:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF976:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1614:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF1401:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1362:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF2311:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_CHANNEL"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF711:
+	.string	"__DECL_SIMD_sinl "
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF824:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF2361:
+	.string	"rateLimitFilterApply4"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1477:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF1964:
+	.string	"heading_hold_rate_limit"
+.LASF2295:
+	.string	"lpfState"
+.LASF900:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF2069:
+	.string	"OWNER_IRLOCK"
+.LASF2215:
+	.string	"braking_boost_speed_threshold"
+.LASF1749:
+	.string	"DEBUG_GYRO"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1492:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF758:
+	.string	"__DECL_SIMD_powf128x "
+.LASF956:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1344:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1812:
+	.string	"dynPID"
+.LASF1427:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF1561:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1405:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1665:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF1658:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF1620:
+	.string	"GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)"
+.LASF1999:
+	.string	"roll"
+.LASF1200:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1343:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF2418:
+	.string	"headingHoldRate"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1642:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1714:
+	.string	"__int16_t"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1558:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1716:
+	.string	"__uint16_t"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1535:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF2194:
+	.string	"max_manual_speed"
+.LASF2037:
+	.string	"OWNER_MOTOR"
+.LASF825:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1301:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF2094:
+	.string	"BUSTYPE_I2C"
+.LASF1298:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF358:
+	.string	"__k8 1"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1854:
+	.string	"BOXLIGHTS"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1235:
+	.string	"__INT_WCHAR_T_H "
+.LASF978:
+	.string	"__HAVE_FLOAT32 1"
+.LASF870:
+	.string	"__DECL_SIMD_log10f "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF795:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF967:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1569:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF772:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF712:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF2443:
+	.string	"newDTerm"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF1524:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1944:
+	.string	"pidType_e"
+.LASF1397:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1461:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF2020:
+	.string	"motorConfig_s"
+.LASF2031:
+	.string	"motorConfig_t"
+.LASF826:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF922:
+	.string	"__DECL_SIMD_erff16 "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF934:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF727:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF2448:
+	.string	"getHeadingHoldState"
+.LASF755:
+	.string	"__DECL_SIMD_powf128 "
+.LASF796:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1572:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF2252:
+	.string	"SENSOR_INDEX_BARO"
+.LASF1074:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2251:
+	.string	"SENSOR_INDEX_ACC"
+.LASF1589:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF2027:
+	.string	"digitalIdleOffsetValue"
+.LASF2265:
+	.string	"SENSOR_GPS"
+.LASF2034:
+	.string	"OWNER_PWMIO"
+.LASF992:
+	.string	"__f32x(x) x ##f32x"
+.LASF2118:
+	.string	"DEVHW_BMP388"
+.LASF2278:
+	.string	"zeroCalibrationParams_t"
+.LASF1605:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1750:
+	.string	"DEBUG_AGL"
+.LASF1089:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1026:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1163:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1810:
+	.string	"rcMid8"
+.LASF1186:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1415:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1050:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1058:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1886:
+	.string	"HORIZON_MODE"
+.LASF1707:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1565:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF725:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF887:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF805:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1503:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1509:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF2467:
+	.string	"pTermProcess"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1201:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1389:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF880:
+	.string	"__DECL_SIMD_log2f "
+.LASF1438:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1210:
+	.string	"__SIZE_T "
+.LASF1815:
+	.string	"rcYawExpo8"
+.LASF1094:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1760:
+	.string	"DEBUG_SMARTAUDIO"
+.LASF2163:
+	.string	"initialized"
+.LASF1784:
+	.string	"biquadFilter_s"
+.LASF1785:
+	.string	"biquadFilter_t"
+.LASF2433:
+	.string	"pidMulticopter"
+.LASF1450:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF2024:
+	.string	"motorPwmProtocol"
+.LASF1729:
+	.string	"float"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1979:
+	.string	"iterm_relax"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF2483:
+	.string	"_left2"
+.LASF2395:
+	.string	"pidBank"
+.LASF2474:
+	.string	"_left4"
+.LASF2462:
+	.string	"_left6"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF1841:
+	.string	"BOXARM"
+.LASF1306:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1817:
+	.string	"fpvCamAngleDegrees"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1234:
+	.string	"___int_wchar_t_h "
+.LASF2490:
+	.string	"calculateMultirotorTPAFactor"
+.LASF2299:
+	.string	"pressure"
+.LASF1894:
+	.string	"FAILSAFE_MODE"
+.LASF1047:
+	.string	"__MATHDECL"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1877:
+	.string	"BOXBRAKING"
+.LASF921:
+	.string	"__DECL_SIMD_erfl "
+.LASF1639:
+	.string	"NAV_BLACKBOX "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2400:
+	.string	"pidController"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1274:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1483:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF782:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF2242:
+	.string	"cruise_yaw_rate"
+.LASF1778:
+	.string	"pgRegistry_s"
+.LASF1744:
+	.string	"pgRegistry_t"
+.LASF2305:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_POWER_LEVEL"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF2447:
+	.string	"delta"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1324:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1086:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF2256:
+	.string	"SENSOR_INDEX_OPFLOW"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF878:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF803:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF2184:
+	.string	"rth_tail_first"
+.LASF1788:
+	.string	"FILTER_PT1"
+.LASF2364:
+	.string	"biquadFilterApply"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1693:
+	.string	"_STRINGS_H 1"
+.LASF1373:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF847:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1852:
+	.string	"BOXBEEPERON"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF2403:
+	.string	"headingHoldState"
+.LASF2298:
+	.string	"pressureZero"
+.LASF374:
+	.string	"__unix 1"
+.LASF1738:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1111:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2384:
+	.string	"pt1FilterApply"
+.LASF2061:
+	.string	"OWNER_VTX"
+.LASF512:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF2479:
+	.string	"mostDeflectedStickPos"
+.LASF1828:
+	.string	"AUX1"
+.LASF1829:
+	.string	"AUX2"
+.LASF1830:
+	.string	"AUX3"
+.LASF1831:
+	.string	"AUX4"
+.LASF1832:
+	.string	"AUX5"
+.LASF1833:
+	.string	"AUX6"
+.LASF1728:
+	.string	"uint64_t"
+.LASF1835:
+	.string	"AUX8"
+.LASF1836:
+	.string	"AUX9"
+.LASF1451:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1166:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF2065:
+	.string	"OWNER_1WIRE"
+.LASF1293:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1031:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2496:
+	.string	"pidRateToRcCommand"
+.LASF1068:
+	.string	"FP_NORMAL 4"
+.LASF1476:
+	.string	"PG_INAV_START 1000"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1755:
+	.string	"DEBUG_ALWAYS"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2044:
+	.string	"OWNER_RANGEFINDER"
+.LASF2269:
+	.string	"ZERO_CALIBRATION_IN_PROGRESS"
+.LASF1245:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1531:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1606:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1330:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF2142:
+	.string	"DEVHW_MS4525"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF829:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1913:
+	.string	"NAV_CRUISE_BRAKING_BOOST"
+.LASF901:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1793:
+	.string	"coeffsLength"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF918:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1655:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF893:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF985:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF2376:
+	.string	"calculateCosTiltAngle"
+.LASF2227:
+	.string	"pitch_to_throttle"
+.LASF1460:
+	.string	"PG_GPS_CONFIG 30"
+.LASF721:
+	.string	"__DECL_SIMD_sincosl "
+.LASF952:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF2139:
+	.string	"DEVHW_SRF10"
+.LASF869:
+	.string	"__DECL_SIMD_log10 "
+.LASF945:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1291:
+	.string	"USE_ITCM_RAM"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF845:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1884:
+	.string	"boxId_e"
+.LASF1734:
+	.string	"PGR_PGN_MASK"
+.LASF982:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1018:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1021:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF2451:
+	.string	"dBoostGyroAcceleration"
+.LASF1113:
+	.string	"USE_NAV "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1514:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF2211:
+	.string	"braking_disengage_speed"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF2349:
+	.string	"usedPidControllerType"
+.LASF1976:
+	.string	"navVelXyDTermLpfHz"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF708:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF2085:
+	.string	"RESOURCE_SPI_CS"
+.LASF2126:
+	.string	"DEVHW_QMC5883"
+.LASF1486:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF2023:
+	.string	"motorPwmRate"
+.LASF1731:
+	.string	"debug"
+.LASF1630:
+	.string	"HDOP_SCALE (100)"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF2417:
+	.string	"pidHeadingHold"
+.LASF1545:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1849:
+	.string	"BOXNAVRTH"
+.LASF1279:
+	.string	"USE_PITOT_ADC"
+.LASF1671:
+	.string	"CALIBRATING_PITOT_TIME_MS 2000"
+.LASF2452:
+	.string	"dBoostRateAcceleration"
+.LASF1676:
+	.string	"GYRO_LPF_98HZ 2"
+.LASF748:
+	.string	"__DECL_SIMD_expf128x "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF911:
+	.string	"__DECL_SIMD_acoshl "
+.LASF2186:
+	.string	"rth_allow_landing"
+.LASF1108:
+	.string	"USE_ADC_AVERAGING "
+.LASF1396:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF894:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2332:
+	.string	"axisAccelLimit"
+.LASF984:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF699:
+	.string	"__DECL_SIMD_cos "
+.LASF1552:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF1746:
+	.string	"timeMs_t"
+.LASF2455:
+	.string	"_left8"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1649:
+	.string	"MIDRC_MAX 1700"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1787:
+	.string	"filter_t"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF2217:
+	.string	"braking_bank_angle"
+.LASF1550:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF2415:
+	.string	"bankAngle"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF858:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2232:
+	.string	"launch_time_thresh"
+.LASF2503:
+	.string	"schedulePidGainsUpdate"
+.LASF1333:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF877:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1675:
+	.string	"GYRO_LPF_188HZ 1"
+.LASF780:
+	.string	"__DECL_SIMD_asinf "
+.LASF1179:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1136:
+	.string	"USE_OPFLOW_MSP "
+.LASF1740:
+	.string	"size"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF2218:
+	.string	"posDecelerationTime"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2353:
+	.string	"dTermLpf2FilterApplyFn"
+.LASF2084:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2054:
+	.string	"OWNER_MPU"
+.LASF1329:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1437:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1051:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF806:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1022:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1035:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF2273:
+	.string	"startTimeMs"
+.LASF2408:
+	.string	"sinCameraAngle"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF747:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF904:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1807:
+	.string	"ADC_CURRENT"
+.LASF1520:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MIN 2"
+.LASF700:
+	.string	"__DECL_SIMD_cosf "
+.LASF1654:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1882:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF2064:
+	.string	"OWNER_TEMPERATURE"
+.LASF844:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF733:
+	.string	"__DECL_SIMD_logf32 "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1088:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1213:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2055:
+	.string	"OWNER_INVERTER"
+.LASF2419:
+	.string	"error"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1653:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1739:
+	.string	"pgResetFunc"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1981:
+	.string	"dBoostMaxAtAlleceleration"
+.LASF1725:
+	.string	"uint8_t"
+.LASF1010:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1604:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1126:
+	.string	"USE_RX_UIB "
+.LASF1563:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1791:
+	.string	"coeffs"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1025:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1974:
+	.string	"fixedWingItermLimitOnStickPosition"
+.LASF394:
+	.string	"bool _Bool"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2179:
+	.string	"use_thr_mid_for_althold"
+.LASF1538:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF2343:
+	.string	"antigravityThrottleLpf"
+.LASF2253:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1939:
+	.string	"pidIndex_e"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF765:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1599:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF1591:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF2407:
+	.string	"cosCameraAngle"
+.LASF1567:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF957:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF919:
+	.string	"__DECL_SIMD_erf "
+.LASF1826:
+	.string	"PITCH"
+.LASF1850:
+	.string	"BOXNAVPOSHOLD"
+.LASF2154:
+	.string	"param"
+.LASF1445:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF1285:
+	.string	"USE_ADC"
+.LASF2402:
+	.string	"canUseFpvCameraMix"
+.LASF2160:
+	.string	"scratchpad"
+.LASF1547:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1928:
+	.string	"PID_PITCH"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1236:
+	.string	"_GCC_WCHAR_T "
+.LASF1231:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2293:
+	.string	"airSpeed"
+.LASF2074:
+	.string	"RESOURCE_IO"
+.LASF1751:
+	.string	"DEBUG_FLOW_RAW"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF1325:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF2375:
+	.string	"navigationGetHeadingControlState"
+.LASF2453:
+	.string	"acceleration"
+.LASF1305:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF2158:
+	.string	"busDevice_s"
+.LASF2161:
+	.string	"busDevice_t"
+.LASF376:
+	.string	"unix 1"
+.LASF2360:
+	.string	"fapplyDeadbandf"
+.LASF1055:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF819:
+	.string	"__DECL_SIMD_cosh "
+.LASF1789:
+	.string	"FILTER_BIQUAD"
+.LASF709:
+	.string	"__DECL_SIMD_sin "
+.LASF1131:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1985:
+	.string	"antigravityCutoff"
+.LASF2431:
+	.string	"pidMulticopterRelaxGyro"
+.LASF2262:
+	.string	"SENSOR_RANGEFINDER"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF2167:
+	.string	"sampleBufferActive"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF1239:
+	.string	"_BSD_WCHAR_T_"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF722:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1670:
+	.string	"CALIBRATING_BARO_TIME_MS 2000"
+.LASF2127:
+	.string	"DEVHW_MAG3110"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF2140:
+	.string	"DEVHW_HCSR04_I2C"
+.LASF975:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1270:
+	.string	"USE_SERVO_SBUS"
+.LASF2077:
+	.string	"RESOURCE_UART_RX"
+.LASF2321:
+	.string	"ptermLpfState"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1286:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1122:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF1517:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MIN 6"
+.LASF1222:
+	.string	"__need_size_t"
+.LASF2196:
+	.string	"land_descent_rate"
+.LASF2036:
+	.string	"OWNER_PPMINPUT"
+.LASF1803:
+	.string	"ioTag_t"
+.LASF1261:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1911:
+	.string	"PWM_DRIVER_AVAILABLE"
+.LASF752:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1775:
+	.string	"FD_PITCH"
+.LASF783:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1000:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1132:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1664:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1323:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF2396:
+	.string	"axis"
+.LASF1039:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1623:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1190:
+	.string	"_STDDEF_H "
+.LASF906:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1249:
+	.string	"USE_FAKE_MAG "
+.LASF2458:
+	.string	"currentPidSetpoint"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF2423:
+	.string	"resetHeadingHoldTarget"
+.LASF1681:
+	.string	"GYRO_LPF_NONE 7"
+.LASF1436:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1669:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF986:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF737:
+	.string	"__DECL_SIMD_logf64x "
+.LASF2263:
+	.string	"SENSOR_PITOT"
+.LASF2449:
+	.string	"applyDBoost"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1566:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF2206:
+	.string	"rth_home_offset_direction"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2316:
+	.string	"gyroRateFilter"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1568:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF1300:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF2345:
+	.string	"yawLpfHz"
+.LASF1609:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF1348:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1867:
+	.string	"BOXTURNASSIST"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF1121:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF855:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1937:
+	.string	"PID_POS_HEADING"
+.LASF2100:
+	.string	"DEVHW_ADXL345"
+.LASF2359:
+	.string	"lrintf"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2466:
+	.string	"applyItermLimiting"
+.LASF1662:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF872:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2102:
+	.string	"DEVHW_LSM303DLHC"
+.LASF1216:
+	.string	"_SIZE_T_DECLARED "
+.LASF1482:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF1752:
+	.string	"DEBUG_FLOW"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1934:
+	.string	"PID_LEVEL"
+.LASF2488:
+	.string	"filteredThrottle"
+.LASF1435:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1120:
+	.string	"USE_PITOT_ADC "
+.LASF1598:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF1075:
+	.string	"MATH_ERRNO 1"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF892:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1066:
+	.string	"FP_ZERO 2"
+.LASF2093:
+	.string	"BUSTYPE_NONE"
+.LASF1564:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF2512:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1956:
+	.string	"pidControllerType"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF912:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1030:
+	.string	"_Mdouble_ long double"
+.LASF2505:
+	.string	"pidInitFilters"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1519:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 180"
+.LASF1090:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1555:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF1499:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1965:
+	.string	"itermWindupPointPercent"
+.LASF2404:
+	.string	"horizonRateMagnitude"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1720:
+	.string	"__uint64_t"
+.LASF2471:
+	.string	"angleTarget"
+.LASF1597:
+	.string	"SPIDEV_COUNT 4"
+.LASF1403:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF2440:
+	.string	"rateTargetDelta"
+.LASF1680:
+	.string	"GYRO_LPF_5HZ 6"
+.LASF2198:
+	.string	"land_slowdown_maxalt"
+.LASF2164:
+	.string	"targetLooptime"
+.LASF991:
+	.string	"__f64(x) x ##f64"
+.LASF794:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2063:
+	.string	"OWNER_COMPASS"
+.LASF1366:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF2459:
+	.string	"setpointLpf"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1942:
+	.string	"PID_TYPE_PIFF"
+.LASF1646:
+	.string	"PWM_PULSE_MIN 750"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1175:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF2336:
+	.string	"headingHoldTarget"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF2282:
+	.string	"params"
+.LASF2457:
+	.string	"applyItermRelax"
+.LASF1705:
+	.string	"D_BOOST_LPF_HZ 10"
+.LASF2259:
+	.string	"SENSOR_ACC"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1574:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF1064:
+	.string	"FP_NAN 0"
+.LASF853:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2152:
+	.string	"devHwType"
+.LASF2029:
+	.string	"throttleScale"
+.LASF1741:
+	.string	"address"
+.LASF1409:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1037:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1395:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF2348:
+	.string	"iTermAntigravityGain"
+.LASF2229:
+	.string	"land_dive_angle"
+.LASF1218:
+	.string	"___int_size_t_h "
+.LASF1303:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1288:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF701:
+	.string	"__DECL_SIMD_cosl "
+.LASF1870:
+	.string	"BOXCAMERA1"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1975:
+	.string	"loiter_direction"
+.LASF2007:
+	.string	"PLATFORM_TRICOPTER"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1845:
+	.string	"BOXHEADINGHOLD"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1284:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1312:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1890:
+	.string	"NAV_POSHOLD_MODE"
+.LASF2464:
+	.string	"pidApplyFixedWingRateController"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF1241:
+	.string	"NULL"
+.LASF1632:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF2508:
+	.string	"motorConfig"
+.LASF1901:
+	.string	"GPS_FIX_HOME"
+.LASF1148:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1868:
+	.string	"BOXAUTOTRIM"
+.LASF2000:
+	.string	"pitch"
+.LASF2045:
+	.string	"OWNER_SYSTEM"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1418:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1237:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1135:
+	.string	"USE_OPFLOW_CXOF "
+.LASF2090:
+	.string	"RESOURCE_RX_CE"
+.LASF2047:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF779:
+	.string	"__DECL_SIMD_asin "
+.LASF2347:
+	.string	"antiWindupScaler"
+.LASF1697:
+	.string	"P0 101325.0f"
+.LASF1768:
+	.string	"DEBUG_DYNAMIC_FILTER_FREQUENCY"
+.LASF1988:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1491:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF2469:
+	.string	"pidApplySetpointRateLimiting"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF2207:
+	.string	"max_bank_angle"
+.LASF2103:
+	.string	"DEVHW_L3GD20"
+.LASF1081:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2033:
+	.string	"OWNER_FREE"
+.LASF2465:
+	.string	"newFFTerm"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1908:
+	.string	"NAV_MOTOR_STOP_OR_IDLE"
+.LASF2219:
+	.string	"posResponseExpo"
+.LASF1309:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1042:
+	.string	"_Mdouble_ _Float64x"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF929:
+	.string	"__DECL_SIMD_tanh "
+.LASF2315:
+	.string	"gyroRateBuf"
+.LASF1548:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1198:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1737:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF2388:
+	.string	"pt1FilterReset"
+.LASF1067:
+	.string	"FP_SUBNORMAL 3"
+.LASF1771:
+	.string	"DEBUG_KALMAN"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF2485:
+	.string	"updatePIDCoefficients"
+.LASF2173:
+	.string	"NAV_LOITER_RIGHT"
+.LASF1765:
+	.string	"DEBUG_RPM_FREQ"
+.LASF1842:
+	.string	"BOXANGLE"
+.LASF1866:
+	.string	"BOXFLAPERON"
+.LASF1183:
+	.string	"USE_VTX_TRAMP "
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF962:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF770:
+	.string	"__DECL_SIMD_atanf "
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1227:
+	.string	"_T_WCHAR "
+.LASF2076:
+	.string	"RESOURCE_UART_TX"
+.LASF2220:
+	.string	"max_climb_angle"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1417:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1225:
+	.string	"_WCHAR_T "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1118:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1327:
+	.string	"UNIT_TESTED "
+.LASF1280:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF2193:
+	.string	"max_auto_climb_rate"
+.LASF915:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF2228:
+	.string	"loiter_radius"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF778:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF1229:
+	.string	"_WCHAR_T_ "
+.LASF2432:
+	.string	"pidMulticopterRelaxSetpoint"
+.LASF1580:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF2385:
+	.string	"pt1FilterApply3"
+.LASF2381:
+	.string	"pt1FilterApply4"
+.LASF1986:
+	.string	"navFwPosHdgPidsumLimit"
+.LASF1359:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF777:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF823:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF476:
+	.string	"__P(args) args"
+.LASF1472:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF988:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1440:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1916:
+	.string	"AIRMODE_ACTIVE"
+.LASF1365:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1345:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1207:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1338:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1512:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1038:
+	.string	"_Mdouble_ _Float128"
+.LASF1002:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1627:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF948:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1297:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2406:
+	.string	"lastFpvCamAngleDegrees"
+.LASF1408:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF895:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF2216:
+	.string	"braking_boost_disengage_speed"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1619:
+	.string	"GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)"
+.LASF2143:
+	.string	"DEVHW_PCA9685"
+.LASF1914:
+	.string	"NAV_CRUISE_BRAKING_LOCKED"
+.LASF2398:
+	.string	"pidIndexGetType"
+.LASF1722:
+	.string	"int8_t"
+.LASF1233:
+	.string	"_WCHAR_T_H "
+.LASF1686:
+	.string	"ACC_VIBE_FLOOR_FILT_HZ 5.0f"
+.LASF1467:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF2008:
+	.string	"PLATFORM_ROVER"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1915:
+	.string	"NAV_EXTRA_ARMING_SAFETY_BYPASSED"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF1400:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF2309:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_THROTTLE"
+.LASF1924:
+	.string	"SET_REVERSIBLE_MOTORS_FORWARD"
+.LASF891:
+	.string	"__DECL_SIMD_log1pl "
+.LASF773:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1824:
+	.string	"currentControlRateProfile"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF2497:
+	.string	"rateDPS"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1902:
+	.string	"GPS_FIX"
+.LASF1532:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF723:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1243:
+	.string	"__need_NULL"
+.LASF896:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2192:
+	.string	"max_auto_speed"
+.LASF1840:
+	.string	"rcCommand"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1059:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1428:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF2255:
+	.string	"SENSOR_INDEX_PITOT"
+.LASF1372:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1806:
+	.string	"ADC_RSSI"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF2202:
+	.string	"min_rth_distance"
+.LASF840:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1673:
+	.string	"CALIBRATING_ACC_TIME_MS 500"
+.LASF1003:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF785:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF2181:
+	.string	"user_control_mode"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1607:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF2437:
+	.string	"pidApplyMulticopterRateController"
+.LASF1616:
+	.string	"DYN_NOTCH_RANGE_HZ_MEDIUM 1333"
+.LASF1969:
+	.string	"pidSumLimit"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1137:
+	.string	"USE_PITOT_MS4525 "
+.LASF2421:
+	.string	"_abs10"
+.LASF2338:
+	.string	"fixedWingTpaFilter"
+.LASF1046:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2222:
+	.string	"cruise_throttle"
+.LASF1576:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1743:
+	.string	"reset"
+.LASF1129:
+	.string	"USE_RANGEFINDER "
+.LASF1399:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF2097:
+	.string	"busType_e"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1763:
+	.string	"DEBUG_ERPM"
+.LASF2378:
+	.string	"navigationRequiresTurnAssistance"
+.LASF792:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1475:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1990:
+	.string	"axisPID"
+.LASF1412:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1339:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1891:
+	.string	"HEADFREE_MODE"
+.LASF786:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2048:
+	.string	"OWNER_SDCARD"
+.LASF1962:
+	.string	"dterm_lpf2_hz"
+.LASF1092:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF889:
+	.string	"__DECL_SIMD_log1p "
+.LASF2367:
+	.string	"autotuneFixedWingUpdate"
+.LASF1688:
+	.string	"_STRING_H 1"
+.LASF973:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF961:
+	.string	"__DECL_SIMD_tanl "
+.LASF2021:
+	.string	"maxthrottle"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1157:
+	.string	"USE_LOG "
+.LASF1076:
+	.string	"MATH_ERREXCEPT 2"
+.LASF2182:
+	.string	"rth_alt_control_mode"
+.LASF1336:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1723:
+	.string	"int16_t"
+.LASF2335:
+	.string	"headingHoldCosZLimit"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1082:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF766:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1708:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1919:
+	.string	"MULTIROTOR"
+.LASF2319:
+	.string	"angleFilterState"
+.LASF1711:
+	.string	"signed char"
+.LASF989:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1141:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF2012:
+	.string	"motorDirectionInverted"
+.LASF1987:
+	.string	"controlDerivativeLpfHz"
+.LASF1164:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1748:
+	.string	"DEBUG_NONE"
+.LASF1837:
+	.string	"AUX10"
+.LASF1838:
+	.string	"AUX11"
+.LASF1839:
+	.string	"AUX12"
+.LASF1204:
+	.string	"__size_t__ "
+.LASF1617:
+	.string	"DYN_NOTCH_RANGE_HZ_LOW 1000"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1062:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1600:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1016:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1379:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1892:
+	.string	"NAV_LAUNCH_MODE"
+.LASF2231:
+	.string	"launch_accel_thresh"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1522:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF2484:
+	.string	"_right3"
+.LASF2428:
+	.string	"pidMulticopterDBoostRelaxGyro"
+.LASF2475:
+	.string	"_right5"
+.LASF2463:
+	.string	"_right7"
+.LASF1909:
+	.string	"COMPASS_CALIBRATED"
+.LASF917:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1375:
+	.string	"sq(x) ((x)*(x))"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1084:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1130:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1820:
+	.string	"stabilized"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF738:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1701:
+	.string	"GLOBAL_FUNCTION_FLAG_ENABLE(mask) (globalFunctionsFlags |= (mask))"
+.LASF1888:
+	.string	"NAV_ALTHOLD_MODE"
+.LASF1883:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF2108:
+	.string	"DEVHW_MPU6500"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF2177:
+	.string	"NAV_HEADING_CONTROL_AUTO"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1212:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1271:
+	.string	"USE_DASHBOARD"
+.LASF1184:
+	.string	"USE_VTX_FFPV "
+.LASF1585:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF1625:
+	.string	"LAT 0"
+.LASF2473:
+	.string	"angleRateTarget"
+.LASF1093:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1603:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1848:
+	.string	"BOXCAMSTAB"
+.LASF881:
+	.string	"__DECL_SIMD_log2l "
+.LASF905:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF2300:
+	.string	"pitot_t"
+.LASF2304:
+	.string	"GLOBAL_FUNCTION_ACTION_SWAP_ROLL_YAW"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1319:
+	.string	"__RECIPROCAL_MATH__ 1"
+.LASF1774:
+	.string	"FD_ROLL"
+.LASF1457:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF2261:
+	.string	"SENSOR_MAG"
+.LASF2430:
+	.string	"pidMulticopterDBoost"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1085:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF932:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1154:
+	.string	"USE_ANTIGRAVITY "
+.LASF1978:
+	.string	"iterm_relax_cutoff"
+.LASF791:
+	.string	"__DECL_SIMD_hypotl "
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1861:
+	.string	"BOXAIRMODE"
+.LASF1590:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1299:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1032:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1706:
+	.string	"PID_MULTICOPTER_RATE_CONTROLLERS(_name,_useDBoost,_useItermRelax,_itermRelaxType) static void FAST_CODE NOINLINE _name(float dT) { pidApplyMulticopterRateControllers(dT, _useDBoost, _useItermRelax, _itermRelaxType); }"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1780:
+	.string	"state"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF2283:
+	.string	"zeroCalibrationScalar_t"
+.LASF1182:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1224:
+	.string	"__WCHAR_T__ "
+.LASF2441:
+	.string	"rateTargetDeltaFiltered"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2041:
+	.string	"OWNER_SERIAL"
+.LASF942:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1192:
+	.string	"_ANSI_STDDEF_H "
+.LASF2183:
+	.string	"rth_climb_first"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF2052:
+	.string	"OWNER_OSD"
+.LASF2281:
+	.string	"zeroCalibrationValue_t"
+.LASF1317:
+	.string	"__FINITE_MATH_ONLY__"
+.LASF2068:
+	.string	"OWNER_PINIO"
+.LASF774:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1735:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF735:
+	.string	"__DECL_SIMD_logf128 "
+.LASF2022:
+	.string	"mincommand"
+.LASF2324:
+	.string	"stickPosition"
+.LASF1114:
+	.string	"USE_TELEMETRY "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF2168:
+	.string	"lastSampleTimeUs"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2245:
+	.string	"yawControlDeadband"
+.LASF1703:
+	.string	"PID_GYRO_RATE_BUF_LENGTH 5"
+.LASF1246:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1846:
+	.string	"BOXHEADFREE"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1471:
+	.string	"PG_VTX_CONFIG 54"
+.LASF1318:
+	.string	"__FINITE_MATH_ONLY__ 1"
+.LASF1363:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1546:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1001:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1478:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF2296:
+	.string	"lastMeasurementUs"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2284:
+	.string	"pitotOpFuncPtr"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1105:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF726:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1943:
+	.string	"PID_TYPE_AUTO"
+.LASF1510:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF885:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF2201:
+	.string	"rth_home_altitude"
+.LASF729:
+	.string	"__DECL_SIMD_log "
+.LASF990:
+	.string	"__f32(x) x ##f32"
+.LASF1341:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1859:
+	.string	"BOXFAILSAFE"
+.LASF2053:
+	.string	"OWNER_BARO"
+.LASF2121:
+	.string	"DEVHW_AK8963"
+.LASF852:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1334:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF888:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1594:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF2329:
+	.string	"ptermFilterApplyFn"
+.LASF743:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2438:
+	.string	"rateError"
+.LASF2147:
+	.string	"DEVHW_IRLOCK"
+.LASF742:
+	.string	"__DECL_SIMD_expf16 "
+.LASF2446:
+	.string	"itermErrorRate"
+.LASF1537:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF2478:
+	.string	"stickPosEle"
+.LASF1139:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1579:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF2389:
+	.string	"getThrottleIdleValue"
+.LASF2394:
+	.string	"pidBankMutable"
+.LASF2123:
+	.string	"DEVHW_IST8310_0"
+.LASF2124:
+	.string	"DEVHW_IST8310_1"
+.LASF1278:
+	.string	"USE_PITOT_MS4525"
+.LASF1282:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1742:
+	.string	"copy"
+.LASF2075:
+	.string	"RESOURCE_TIMER"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF2328:
+	.string	"dBoostGyroLpf"
+.LASF1433:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF979:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1881:
+	.string	"BOXLOITERDIRCHN"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1926:
+	.string	"stateFlags"
+.LASF1667:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF1953:
+	.string	"ITERM_RELAX_SETPOINT"
+.LASF2301:
+	.string	"pitot"
+.LASF2274:
+	.string	"windowSizeMs"
+.LASF1140:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF812:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1776:
+	.string	"FD_YAW"
+.LASF1719:
+	.string	"long int"
+.LASF1871:
+	.string	"BOXCAMERA2"
+.LASF1872:
+	.string	"BOXCAMERA3"
+.LASF998:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1454:
+	.string	"PG_SERVO_MIXER 21"
+.LASF513:
+	.string	"__always_inline"
+.LASF1769:
+	.string	"DEBUG_IRLOCK"
+.LASF2098:
+	.string	"DEVHW_NONE"
+.LASF2365:
+	.string	"nullFilterApply"
+.LASF882:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1592:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF1165:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF1269:
+	.string	"USE_USB_MSC"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1679:
+	.string	"GYRO_LPF_10HZ 5"
+.LASF2042:
+	.string	"OWNER_PINDEBUG"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF820:
+	.string	"__DECL_SIMD_coshf "
+.LASF831:
+	.string	"__DECL_SIMD_expm1l "
+.LASF2010:
+	.string	"PLATFORM_OTHER"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2240:
+	.string	"launch_climb_angle"
+.LASF1381:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF857:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1757:
+	.string	"DEBUG_VIBE"
+.LASF1767:
+	.string	"DEBUG_DYNAMIC_FILTER"
+.LASF1856:
+	.string	"BOXOSD"
+.LASF753:
+	.string	"__DECL_SIMD_powf32 "
+.LASF1544:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1106:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1197:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1425:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2266:
+	.string	"SENSOR_GPSMAG"
+.LASF1930:
+	.string	"PID_POS_Z"
+.LASF1196:
+	.string	"__PTRDIFF_T "
+.LASF1378:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1864:
+	.string	"BOXKILLSWITCH"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF2109:
+	.string	"DEVHW_BMI160"
+.LASF846:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF724:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF1651:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF1014:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1320:
+	.string	"__NO_SIGNED_ZEROS__ 1"
+.LASF1206:
+	.string	"_SIZE_T "
+.LASF2362:
+	.string	"mixerIsOutputSaturated"
+.LASF1887:
+	.string	"HEADING_MODE"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1356:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2091:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF1951:
+	.string	"ITERM_RELAX_RPY"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1413:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF2199:
+	.string	"emerg_descent_rate"
+.LASF849:
+	.string	"__DECL_SIMD_cbrt "
+.LASF879:
+	.string	"__DECL_SIMD_log2 "
+.LASF1422:
+	.string	"EXPAND_I(x) x"
+.LASF1893:
+	.string	"MANUAL_MODE"
+.LASF1167:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1677:
+	.string	"GYRO_LPF_42HZ 3"
+.LASF717:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF871:
+	.string	"__DECL_SIMD_log10l "
+.LASF1020:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1727:
+	.string	"uint32_t"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1989:
+	.string	"pidProfile_ProfileCurrent"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF974:
+	.string	"__f128(x) x ##f128"
+.LASF1295:
+	.string	"U_ID_1 1"
+.LASF781:
+	.string	"__DECL_SIMD_asinl "
+.LASF1352:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1895:
+	.string	"AUTO_TUNE"
+.LASF2383:
+	.string	"rxGetChannelValue"
+.LASF994:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1087:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1672:
+	.string	"CALIBRATING_GYRO_TIME_MS 2000"
+.LASF1682:
+	.string	"GYRO_SAMPLE_BUFFER_SIZE 16"
+.LASF2116:
+	.string	"DEVHW_LPS25H"
+.LASF769:
+	.string	"__DECL_SIMD_atan "
+.LASF2351:
+	.string	"pidControllerApplyFn"
+.LASF2405:
+	.string	"fpvCameraAngle"
+.LASF1786:
+	.string	"biquad"
+.LASF1276:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF2325:
+	.string	"previousRateTarget"
+.LASF1308:
+	.string	"NOINLINE "
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2495:
+	.string	"maxRateDPS"
+.LASF1920:
+	.string	"ROVER"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2073:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2486:
+	.string	"prevThrottle"
+.LASF867:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF2414:
+	.string	"airspeedForCoordinatedTurn"
+.LASF898:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1844:
+	.string	"BOXNAVALTHOLD"
+.LASF995:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1049:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF2412:
+	.string	"pidTurnAssistant"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1452:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF908:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2435:
+	.string	"useItermRelax"
+.LASF1380:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF937:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1253:
+	.string	"USE_UART1 "
+.LASF1458:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF1332:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1957:
+	.string	"bank_fw"
+.LASF1858:
+	.string	"BOXBLACKBOX"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF2427:
+	.string	"pidFixedWing"
+.LASF1710:
+	.string	"long unsigned int"
+.LASF2310:
+	.string	"GLOBAL_FUNCTION_ACTION_SET_VTX_BAND"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF2159:
+	.string	"descriptorPtr"
+.LASF1189:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1083:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1847:
+	.string	"BOXHEADADJ"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1468:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1732:
+	.string	"debugMode"
+.LASF1226:
+	.string	"_T_WCHAR_ "
+.LASF2476:
+	.string	"calcHorizonRateMagnitude"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1160:
+	.string	"CMS_MENU_OSD "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1361:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF2004:
+	.string	"PLATFORM_MULTIROTOR"
+.LASF718:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1959:
+	.string	"dterm_lpf_type"
+.LASF1898:
+	.string	"FLAPERON"
+.LASF2492:
+	.string	"pidRcCommandToRate"
+.LASF1865:
+	.string	"BOXSURFACE"
+.LASF1970:
+	.string	"pidSumLimitYaw"
+.LASF2043:
+	.string	"OWNER_TIMER"
+.LASF1065:
+	.string	"FP_INFINITE 1"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1637:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1980:
+	.string	"dBoostFactor"
+.LASF1439:
+	.string	"PG_CF_START 1"
+.LASF2095:
+	.string	"BUSTYPE_SPI"
+.LASF1115:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1656:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF1668:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF1109:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF910:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1721:
+	.string	"char"
+.LASF1052:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF813:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1811:
+	.string	"rcExpo8"
+.LASF789:
+	.string	"__DECL_SIMD_hypot "
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1855:
+	.string	"BOXNAVLAUNCH"
+.LASF1238:
+	.string	"__DEFINED_wchar_t "
+.LASF2333:
+	.string	"rateTargetFilter"
+.LASF2145:
+	.string	"DEVHW_UG2864"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1388:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF2009:
+	.string	"PLATFORM_BOAT"
+.LASF2096:
+	.string	"BUSTYPE_SDIO"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1410:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1804:
+	.string	"IO_t"
+.LASF1790:
+	.string	"firFilter_s"
+.LASF1794:
+	.string	"firFilter_t"
+.LASF1005:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1540:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF2264:
+	.string	"SENSOR_OPFLOW"
+.LASF2213:
+	.string	"braking_boost_factor"
+.LASF745:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1816:
+	.string	"rates"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF810:
+	.string	"__DECL_SIMD_exp10f "
+.LASF704:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF876:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF768:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF2110:
+	.string	"DEVHW_ICM20689"
+.LASF1504:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1602:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1398:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF1171:
+	.string	"USE_RX_MSP "
+.LASF2271:
+	.string	"ZERO_CALIBRATION_FAIL"
+.LASF1414:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1406:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF395:
+	.string	"true 1"
+.LASF1700:
+	.string	"GLOBAL_FUNCTION_FLAG_DISABLE(mask) (globalFunctionsFlags &= ~(mask))"
+.LASF1496:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF706:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1487:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF1314:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF2371:
+	.string	"sensors"
+.LASF2286:
+	.string	"busDev"
+.LASF760:
+	.string	"__DECL_SIMD_acosf "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1214:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1151:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF746:
+	.string	"__DECL_SIMD_expf32x "
+.LASF943:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1155:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1119:
+	.string	"USE_PITOT "
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1394:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF1971:
+	.string	"fixedWingItermThrowLimit"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1370:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF2105:
+	.string	"DEVHW_MPU3050"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1756:
+	.string	"DEBUG_SAG_COMP_VOLTAGE"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1770:
+	.string	"DEBUG_CD"
+.LASF1825:
+	.string	"ROLL"
+.LASF902:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1221:
+	.string	"__size_t "
+.LASF1690:
+	.string	"__need_NULL "
+.LASF2197:
+	.string	"land_slowdown_minalt"
+.LASF1581:
+	.string	"RPM_FILTER_UPDATE_RATE_HZ 500"
+.LASF2067:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1374:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF851:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1009:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF996:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1463:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1927:
+	.string	"PID_ROLL"
+.LASF955:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF784:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2128:
+	.string	"DEVHW_LIS3MDL"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1242:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF987:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF2509:
+	.string	"mixerConfig"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF940:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1527:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF916:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1420:
+	.string	"STR_HELPER(x) #x"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF2195:
+	.string	"max_manual_climb_rate"
+.LASF2357:
+	.string	"pidProfile_CopyStorage"
+.LASF1057:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1104:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF2267:
+	.string	"SENSOR_TEMP"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1559:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF2294:
+	.string	"zeroCalibration"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF2028:
+	.string	"throttleIdle"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1360:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF2212:
+	.string	"braking_timeout"
+.LASF1950:
+	.string	"ITERM_RELAX_RP"
+.LASF2413:
+	.string	"targetRates"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2079:
+	.string	"RESOURCE_EXTI"
+.LASF1240:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF807:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1195:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF2276:
+	.string	"sampleCount"
+.LASF909:
+	.string	"__DECL_SIMD_acosh "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1699:
+	.string	"MAX_GLOBAL_FUNCTIONS 8"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1161:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF2178:
+	.string	"NAV_HEADING_CONTROL_MANUAL"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1112:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF371:
+	.string	"__linux 1"
+.LASF1061:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF2337:
+	.string	"headingHoldRateFilter"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF2334:
+	.string	"pidState_t"
+.LASF2322:
+	.string	"dtermLpfState"
+.LASF1495:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF866:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF2436:
+	.string	"itermRelaxType"
+.LASF822:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1702:
+	.string	"GLOBAL_FUNCTION_FLAG(mask) (globalFunctionsFlags & (mask))"
+.LASF1080:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF2230:
+	.string	"launch_velocity_thresh"
+.LASF1586:
+	.string	"DMA_NONE (0)"
+.LASF2397:
+	.string	"useDBoost"
+.LASF2303:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_THROTTLE_SCALE"
+.LASF1385:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF1383:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF2320:
+	.string	"axisAccelFilter"
+.LASF965:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1012:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF2420:
+	.string	"navHeadingState"
+.LASF1931:
+	.string	"PID_POS_XY"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1994:
+	.string	"axisPID_Setpoint"
+.LASF2203:
+	.string	"rth_abort_threshold"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF954:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1060:
+	.string	"__MATHCALL_NARROW"
+.LASF1434:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1133:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1367:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF2472:
+	.string	"angleErrorDeg"
+.LASF2340:
+	.string	"pidGainsUpdateRequired"
+.LASF2442:
+	.string	"newCDTerm"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF2445:
+	.string	"newOutputLimited"
+.LASF1507:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF1588:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF759:
+	.string	"__DECL_SIMD_acos "
+.LASF1857:
+	.string	"BOXTELEMETRY"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF386:
+	.string	"__REVISION__ \"5c97225\""
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF2234:
+	.string	"launch_throttle"
+.LASF2258:
+	.string	"SENSOR_GYRO"
+.LASF1910:
+	.string	"ACCELEROMETER_CALIBRATED"
+.LASF830:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1335:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1346:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF736:
+	.string	"__DECL_SIMD_logf32x "
+.LASF2224:
+	.string	"control_smoothness"
+.LASF1350:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1432:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF2188:
+	.string	"auto_overrides_motor_stop"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1984:
+	.string	"antigravityAccelerator"
+.LASF1322:
+	.string	"__ASSOCIATIVE_MATH__ 1"
+.LASF1117:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF2246:
+	.string	"navConfig_s"
+.LASF2248:
+	.string	"navConfig_t"
+.LASF2165:
+	.string	"sampleLooptime"
+.LASF1091:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF1368:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1172:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1187:
+	.string	"USE_CLI_BATCH "
+.LASF2499:
+	.string	"angleDeciDegrees"
+.LASF1730:
+	.string	"double"
+.LASF1618:
+	.string	"GYRO_PID_PROCESS_DENOM_MAX 8"
+.LASF1449:
+	.string	"PG_PID_PROFILE 14"
+.LASF2244:
+	.string	"useFwNavYawControl"
+.LASF1907:
+	.string	"FLAPERON_AVAILABLE"
+.LASF941:
+	.string	"__DECL_SIMD_asinhl "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF762:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1534:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF859:
+	.string	"__DECL_SIMD_atan2 "
+.LASF2270:
+	.string	"ZERO_CALIBRATION_DONE"
+.LASF1577:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2185:
+	.string	"disarm_on_landing"
+.LASF1311:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF2481:
+	.string	"_abs0"
+.LASF2482:
+	.string	"_abs1"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF2409:
+	.string	"rollRate"
+.LASF1633:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1431:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF2290:
+	.string	"pitotCalculateFuncPtr"
+.LASF2411:
+	.string	"pidApplyFpvCameraAngleMix"
+.LASF1553:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF1442:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF2356:
+	.string	"pidProfile_Storage"
+.LASF1704:
+	.string	"D_BOOST_GYRO_LPF_HZ 80"
+.LASF936:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1230:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2513:
+	.string	"rc_alias"
+.LASF1518:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_DEFAULT 20"
+.LASF1516:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 180"
+.LASF1384:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1099:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1587:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF1904:
+	.string	"SMALL_ANGLE"
+.LASF2058:
+	.string	"OWNER_RX"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1917:
+	.string	"ESC_SENSOR_ENABLED"
+.LASF1304:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1244:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2501:
+	.string	"pidRcCommandToAngle"
+.LASF1551:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF1079:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1897:
+	.string	"NAV_CRUISE_MODE"
+.LASF1782:
+	.string	"pt1Filter_s"
+.LASF1783:
+	.string	"pt1Filter_t"
+.LASF1717:
+	.string	"__int32_t"
+.LASF1006:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1718:
+	.string	"__uint32_t"
+.LASF1696:
+	.string	"AIR_DENSITY_SEA_LEVEL_15C 1.225f"
+.LASF1958:
+	.string	"bank_mc"
+.LASF1595:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF2323:
+	.string	"dtermLpf2State"
+.LASF1263:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1103:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF946:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF2189:
+	.string	"pos_failure_timeout"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1584:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1455:
+	.string	"PG_IMU_CONFIG 22"
+.LASF2156:
+	.string	"irqPin"
+.LASF2111:
+	.string	"DEVHW_MPU9250"
+.LASF1694:
+	.string	"PITOT_MAX PITOT_FAKE"
+.LASF2377:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF2191:
+	.string	"waypoint_safe_distance"
+.LASF1283:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF2155:
+	.string	"busdev"
+.LASF808:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1912:
+	.string	"NAV_CRUISE_BRAKING"
+.LASF1162:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF2049:
+	.string	"OWNER_FLASH"
+.LASF761:
+	.string	"__DECL_SIMD_acosl "
+.LASF1456:
+	.string	"PG_RX_CONFIG 24"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1034:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1631:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF999:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF939:
+	.string	"__DECL_SIMD_asinh "
+.LASF1128:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1177:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1015:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1145:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF750:
+	.string	"__DECL_SIMD_powf "
+.LASF1017:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1181:
+	.string	"USE_VTX_CONTROL "
+.LASF1424:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF756:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1220:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF2399:
+	.string	"pidInit"
+.LASF2016:
+	.string	"fwMinThrottleDownPitchAngle"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF983:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF787:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2166:
+	.string	"pidProcessDenom"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1191:
+	.string	"_STDDEF_H_ "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1202:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2150:
+	.string	"devicePtr"
+.LASF2434:
+	.string	"pidApplyMulticopterRateControllers"
+.LASF1753:
+	.string	"DEBUG_SBUS"
+.LASF864:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1921:
+	.string	"BOAT"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1048:
+	.string	"__MATHCALL"
+.LASF873:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1973:
+	.string	"fixedWingCoordinatedYawGain"
+.LASF2346:
+	.string	"motorItermWindupPoint"
+.LASF1497:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF1905:
+	.string	"FIXED_WING_LEGACY"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF821:
+	.string	"__DECL_SIMD_coshl "
+.LASF1158:
+	.string	"USE_STATS "
+.LASF1251:
+	.string	"USE_MAG "
+.LASF2066:
+	.string	"OWNER_AIRSPEED"
+.LASF2104:
+	.string	"DEVHW_L3G4200"
+.LASF1040:
+	.string	"_Mdouble_ _Float32x"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1869:
+	.string	"BOXAUTOTUNE"
+.LASF2235:
+	.string	"launch_motor_timer"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF926:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF899:
+	.string	"__DECL_SIMD_atanh "
+.LASF2439:
+	.string	"newPTerm"
+.LASF705:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF1853:
+	.string	"BOXLEDLOW"
+.LASF1008:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1007:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF1834:
+	.string	"AUX7"
+.LASF2341:
+	.string	"pidState"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF811:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1500:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1900:
+	.string	"flightModeFlags"
+.LASF1369:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1315:
+	.string	"__FAST_MATH__ 1"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF886:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1228:
+	.string	"__WCHAR_T "
+.LASF1096:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1481:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1647:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF1469:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF2350:
+	.string	"pidControllerFnPtr"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF966:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1880:
+	.string	"BOXFPVANGLEMIX"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF828:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1608:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF790:
+	.string	"__DECL_SIMD_hypotf "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF2015:
+	.string	"appliedMixerPreset"
+.LASF964:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF2236:
+	.string	"launch_motor_spinup_time"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1199:
+	.string	"___int_ptrdiff_t_h "
+.LASF1967:
+	.string	"axisAccelerationLimitRollPitch"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1070:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1685:
+	.string	"ACC_CLIPPING_THRESHOLD_G 7.9f"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF927:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1294:
+	.string	"U_ID_0 0"
+.LASF2480:
+	.string	"modeTransitionStickPos"
+.LASF868:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2239:
+	.string	"launch_max_altitude"
+.LASF1968:
+	.string	"max_angle_inclination"
+.LASF2115:
+	.string	"DEVHW_MS5607"
+.LASF754:
+	.string	"__DECL_SIMD_powf64 "
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1796:
+	.string	"filterApply4FnPtr"
+.LASF1733:
+	.string	"pgn_t"
+.LASF1028:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF970:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1640:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF1808:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1758:
+	.string	"DEBUG_CRUISE"
+.LASF2391:
+	.string	"biquadFilterInitLPF"
+.LASF1643:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2101:
+	.string	"DEVHW_MMA8452"
+.LASF2401:
+	.string	"pidIndex"
+.LASF776:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1098:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1626:
+	.string	"LON 1"
+.LASF1821:
+	.string	"manual"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF800:
+	.string	"__DECL_SIMD_exp2f "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1490:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF716:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1809:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1575:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF1813:
+	.string	"pa_breakpoint"
+.LASF2130:
+	.string	"DEVHW_LM75_1"
+.LASF2011:
+	.string	"mixerConfig_s"
+.LASF2018:
+	.string	"mixerConfig_t"
+.LASF969:
+	.string	"_BITS_FLOATN_H "
+.LASF2132:
+	.string	"DEVHW_LM75_3"
+.LASF2506:
+	.string	"refreshRate"
+.LASF1423:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2134:
+	.string	"DEVHW_LM75_5"
+.LASF1862:
+	.string	"BOXHOMERESET"
+.LASF1153:
+	.string	"USE_D_BOOST "
+.LASF2114:
+	.string	"DEVHW_MS5611"
+.LASF1209:
+	.string	"_T_SIZE "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1635:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF854:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2141:
+	.string	"DEVHW_VL53L0X"
+.LASF1506:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1033:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF2005:
+	.string	"PLATFORM_AIRPLANE"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1443:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1272:
+	.string	"USE_OLED_UG2864"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF2208:
+	.string	"hover_throttle"
+.LASF890:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1358:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1557:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF1188:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1310:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1265:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF2086:
+	.string	"RESOURCE_ADC_CH1"
+.LASF2087:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2088:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2089:
+	.string	"RESOURCE_ADC_CH4"
+.LASF827:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF834:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1661:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF2426:
+	.string	"nullRateControllers"
+.LASF2498:
+	.string	"pidAngleToRcCommand"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF938:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1792:
+	.string	"bufLength"
+.LASF2146:
+	.string	"DEVHW_SDCARD"
+.LASF809:
+	.string	"__DECL_SIMD_exp10 "
+.LASF980:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1573:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF883:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1955:
+	.string	"pidProfile_s"
+.LASF797:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF2380:
+	.string	"getRcCommandOverride"
+.LASF914:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1029:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF714:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1972:
+	.string	"fixedWingReferenceAirspeed"
+.LASF1178:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1138:
+	.string	"USE_1WIRE "
+.LASF2025:
+	.string	"motorAccelTimeMs"
+.LASF930:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1798:
+	.string	"m_oldM"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1800:
+	.string	"m_oldS"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2370:
+	.string	"sin_approx"
+.LASF2354:
+	.string	"levelingEnabled"
+.LASF1502:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF2035:
+	.string	"OWNER_PWMINPUT"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1674:
+	.string	"GYRO_LPF_256HZ 0"
+.LASF1636:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF802:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF1281:
+	.string	"USE_1WIRE_DS2482"
+.LASF2172:
+	.string	"gyro"
+.LASF757:
+	.string	"__DECL_SIMD_powf64x "
+.LASF707:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1529:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1419:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1326:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1266:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF771:
+	.string	"__DECL_SIMD_atanl "
+.LASF1260:
+	.string	"USE_UART8 "
+.LASF1629:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF2148:
+	.string	"devHardwareType_e"
+.LASF1013:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1961:
+	.string	"dterm_lpf2_type"
+.LASF1407:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1822:
+	.string	"misc"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1638:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF1997:
+	.string	"HEADING_HOLD_ENABLED"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF815:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1922:
+	.string	"ALTITUDE_CONTROL"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF925:
+	.string	"__DECL_SIMD_erff128 "
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF875:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1149:
+	.string	"USE_FRSKYOSD "
+.LASF2162:
+	.string	"gyro_s"
+.LASF2171:
+	.string	"gyro_t"
+.LASF842:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1110:
+	.string	"USE_BLACKBOX "
+.LASF763:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1925:
+	.string	"FW_HEADING_USE_YAW"
+.LASF2502:
+	.string	"pidResetErrorAccumulators"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF850:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF2099:
+	.string	"DEVHW_BMA280"
+.LASF1464:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1923:
+	.string	"MOVE_FORWARD_ONLY"
+.LASF751:
+	.string	"__DECL_SIMD_powl "
+.LASF2117:
+	.string	"DEVHW_SPL06"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF2092:
+	.string	"BUSTYPE_ANY"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1622:
+	.string	"VARIANCE_SCALE 0.67f"
+.LASF1583:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF728:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF933:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1107:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1142:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1354:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1267:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1036:
+	.string	"_Mdouble_ _Float64"
+.LASF1860:
+	.string	"BOXNAVWP"
+.LASF1290:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1393:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF1480:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF1150:
+	.string	"USE_DJI_HD_OSD "
+.LASF1328:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1634:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF2003:
+	.string	"attitude"
+.LASF2174:
+	.string	"NAV_LOITER_LEFT"
+.LASF2119:
+	.string	"DEVHW_DPS310"
+.LASF1043:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1217:
+	.string	"__DEFINED_size_t "
+.LASF1402:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1684:
+	.string	"GRAVITY_MSS 9.80665f"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1615:
+	.string	"DYN_NOTCH_RANGE_HZ_HIGH 2000"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2083:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF2046:
+	.string	"OWNER_SPI"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1382:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1316:
+	.string	"__NO_MATH_ERRNO__ 1"
+.LASF1473:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF2272:
+	.string	"zeroCalibrationState_e"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF2180:
+	.string	"extra_arming_safety"
+.LASF1678:
+	.string	"GYRO_LPF_20HZ 4"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF2510:
+	.string	"pidProfileMutable"
+.LASF466:
+	.string	"__PMT"
+.LASF1275:
+	.string	"USE_RANGEFINDER"
+.LASF2511:
+	.string	"pidProfile"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF920:
+	.string	"__DECL_SIMD_erff "
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1073:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1489:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF2317:
+	.string	"errorGyroIf"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF2327:
+	.string	"dBoostLpf"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1053:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1211:
+	.string	"_SIZE_T_ "
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF2355:
+	.string	"pgResetTemplate_pidProfile"
+.LASF1610:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF2461:
+	.string	"itermRelaxFactor"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF702:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1173:
+	.string	"USE_SERIALRX_SUMH "
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2444:
+	.string	"newOutput"
+.LASF2002:
+	.string	"attitudeEulerAngles_t"
+.LASF2056:
+	.string	"OWNER_LED_STRIP"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1254:
+	.string	"USE_UART2 "
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF2342:
+	.string	"windupLpf"
+.LASF2175:
+	.string	"NAV_LOITER_YAW"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1505:
+	.string	"PG_ID_INVALID 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2424:
+	.string	"heading"
+.LASF1342:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1938:
+	.string	"PID_ITEM_COUNT"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1762:
+	.string	"DEBUG_ITERM_RELAX"
+.LASF710:
+	.string	"__DECL_SIMD_sinf "
+.LASF1660:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF2237:
+	.string	"launch_min_time"
+.LASF1474:
+	.string	"PG_CF_END 56"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF2238:
+	.string	"launch_timeout"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1691:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1570:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF928:
+	.string	"__DECL_SIMD_erff128x "
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1004:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2257:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1772:
+	.string	"DEBUG_SDCARD"
+.LASF2112:
+	.string	"DEVHW_BMP085"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1983:
+	.string	"antigravityGain"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1448:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1759:
+	.string	"DEBUG_REM_FLIGHT_TIME"
+.LASF1488:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF2169:
+	.string	"sampleDeltaTimeUs"
+.LASF1650:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1466:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1391:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF2307:
+	.string	"GLOBAL_FUNCTION_ACTION_INVERT_PITCH"
+.LASF801:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1666:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2313:
+	.string	"gyroRate"
+.LASF1255:
+	.string	"USE_UART3 "
+.LASF1387:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1873:
+	.string	"BOXOSDALT1"
+.LASF1874:
+	.string	"BOXOSDALT2"
+.LASF1875:
+	.string	"BOXOSDALT3"
+.LASF1754:
+	.string	"DEBUG_FPORT"
+.LASF1712:
+	.string	"__int8_t"
+.LASF1498:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF1100:
+	.string	"USE_I2C_PULLUP "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1645:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1963:
+	.string	"yaw_lpf_hz"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1416:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1205:
+	.string	"__SIZE_T__ "
+.LASF1347:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1180:
+	.string	"USE_RCDEVICE "
+.LASF1624:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1289:
+	.string	"USE_RCDEVICE"
+.LASF1560:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1641:
+	.string	"RADAR_MAX_POIS 5"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1889:
+	.string	"NAV_RTH_MODE"
+.LASF2287:
+	.string	"delay"
+.LASF2120:
+	.string	"DEVHW_HMC5883"
+.LASF1277:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1952:
+	.string	"ITERM_RELAX_GYRO"
+.LASF2368:
+	.string	"imuTransformVectorEarthToBody"
+.LASF1947:
+	.string	"pidBank_s"
+.LASF1948:
+	.string	"pidBank_t"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF856:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF2330:
+	.string	"itermLimitActive"
+.LASF2297:
+	.string	"lastSeenHealthyMs"
+.LASF2247:
+	.string	"general"
+.LASF913:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF2302:
+	.string	"GLOBAL_FUNCTION_ACTION_OVERRIDE_ARMING_SAFETY"
+.LASF1709:
+	.string	"unsigned int"
+.LASF2250:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1256:
+	.string	"USE_UART4 "
+.LASF1447:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF793:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF960:
+	.string	"__DECL_SIMD_tanf "
+.LASF832:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF958:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1095:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1174:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1063:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1549:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF1695:
+	.string	"PITOT_SAMPLE_COUNT_MAX 48"
+.LASF1539:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF972:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1998:
+	.string	"fpVector3_t"
+.LASF1123:
+	.string	"USE_GYRO_KALMAN "
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2363:
+	.string	"getMotorMixRange"
+.LASF860:
+	.string	"__DECL_SIMD_atan2f "
+.LASF719:
+	.string	"__DECL_SIMD_sincos "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF931:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2358:
+	.string	"pidProfile_Registry"
+.LASF1168:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF2344:
+	.string	"antigravityThrottleHpf"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1687:
+	.string	"ACC_VIBE_FILT_HZ 2.0f"
+.LASF1355:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2040:
+	.string	"OWNER_ADC"
+.LASF1715:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1193:
+	.string	"_PTRDIFF_T "
+.LASF1127:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1170:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF862:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF1596:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2494:
+	.string	"rate"
+.LASF2277:
+	.string	"stdDevThreshold"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1257:
+	.string	"USE_UART5 "
+.LASF739:
+	.string	"__DECL_SIMD_exp "
+.LASF1530:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1954:
+	.string	"itermRelaxType_e"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF1044:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1411:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2078:
+	.string	"RESOURCE_UART_TXRX"
+.LASF1899:
+	.string	"TURN_ASSISTANT"
+.LASF951:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1613:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF2429:
+	.string	"pidMulticopterDBoostRelaxSetpoint"
+.LASF1273:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1331:
+	.string	"EXTENDED_FASTRAM "
+.LASF2268:
+	.string	"ZERO_CALIBRATION_NONE"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1554:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF816:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1515:
+	.string	"MAX_CONTROL_RATE_PROFILE_COUNT 3"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1659:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF977:
+	.string	"__HAVE_FLOAT16 0"
+.LASF2382:
+	.string	"constrain"
+.LASF2275:
+	.string	"allowFailure"
+.LASF1945:
+	.string	"pid8_s"
+.LASF1946:
+	.string	"pid8_t"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2138:
+	.string	"DEVHW_MAX7456"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1977:
+	.string	"iterm_relax_type"
+.LASF1078:
+	.string	"M_E 2.7182818284590452354"
+.LASF2153:
+	.string	"flags"
+.LASF1493:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2393:
+	.string	"getLooptime"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF734:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1262:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2387:
+	.string	"constrainf"
+.LASF2026:
+	.string	"motorDecelTimeMs"
+.LASF2288:
+	.string	"start"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1258:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF2369:
+	.string	"cos_approx"
+.LASF2331:
+	.string	"itermRelaxActive"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2600:
+	.string	"rx_pwm.h"
+.LASF2584:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2533:
+	.string	"/usr/include"
+.LASF2590:
+	.string	"mathcalls-helper-functions.h"
+.LASF2586:
+	.string	"floatn-common.h"
+.LASF2569:
+	.string	"stdint.h"
+.LASF2514:
+	.string	"src/main/build"
+.LASF2530:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2568:
+	.string	"stdbool.h"
+.LASF2540:
+	.string	"time.h"
+.LASF2573:
+	.string	"wordsize.h"
+.LASF2555:
+	.string	"bus.h"
+.LASF2557:
+	.string	"navigation.h"
+.LASF2526:
+	.string	"src/main/target/SITL"
+.LASF2563:
+	.string	"mathcalls.h"
+.LASF2616:
+	.string	"compass.h"
+.LASF2596:
+	.string	"common_post.h"
+.LASF2570:
+	.string	"libc-header-start.h"
+.LASF2604:
+	.string	"rpm_filter.h"
+.LASF2559:
+	.string	"calibration.h"
+.LASF2591:
+	.string	"platform.h"
+.LASF2534:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2554:
+	.string	"resource.h"
+.LASF2521:
+	.string	"src/main/flight"
+.LASF2552:
+	.string	"imu.h"
+.LASF2538:
+	.string	"debug.h"
+.LASF2567:
+	.string	"stdc-predef.h"
+.LASF2614:
+	.string	"accgyro.h"
+.LASF2551:
+	.string	"vector.h"
+.LASF2582:
+	.string	"math.h"
+.LASF2529:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2542:
+	.string	"filter.h"
+.LASF2603:
+	.string	"quaternion.h"
+.LASF2571:
+	.string	"features.h"
+.LASF2528:
+	.string	"src/main"
+.LASF2522:
+	.string	"src/main/io"
+.LASF2518:
+	.string	"src/main/drivers/compass"
+.LASF2572:
+	.string	"features-time64.h"
+.LASF2620:
+	.string	"strings.h"
+.LASF2611:
+	.string	"feature.h"
+.LASF2517:
+	.string	"src/main/drivers/accgyro"
+.LASF2549:
+	.string	"runtime_config.h"
+.LASF2566:
+	.string	"config.h"
+.LASF2588:
+	.string	"fp-logb.h"
+.LASF2556:
+	.string	"gyro.h"
+.LASF2580:
+	.string	"time64.h"
+.LASF2617:
+	.string	"string.h"
+.LASF2593:
+	.string	"target.h"
+.LASF2608:
+	.string	"bus_spi.h"
+.LASF2543:
+	.string	"maths.h"
+.LASF2599:
+	.string	"parameter_group_ids.h"
+.LASF2581:
+	.string	"wchar.h"
+.LASF2574:
+	.string	"timesize.h"
+.LASF2515:
+	.string	"src/main/common"
+.LASF2565:
+	.string	"rx.h"
+.LASF2532:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2607:
+	.string	"rcc_types.h"
+.LASF2601:
+	.string	"stats.h"
+.LASF2610:
+	.string	"gps.h"
+.LASF2621:
+	.string	"logic_condition.h"
+.LASF2613:
+	.string	"acceleration.h"
+.LASF2594:
+	.string	"stddef.h"
+.LASF2589:
+	.string	"fp-fast.h"
+.LASF2520:
+	.string	"src/main/fc"
+.LASF2585:
+	.string	"floatn.h"
+.LASF2606:
+	.string	"bus_i2c.h"
+.LASF2592:
+	.string	"common.h"
+.LASF2562:
+	.string	"pid.c"
+.LASF2578:
+	.string	"stubs-64.h"
+.LASF2577:
+	.string	"stubs.h"
+.LASF2539:
+	.string	"parameter_group.h"
+.LASF2546:
+	.string	"controlrate_profile.h"
+.LASF2550:
+	.string	"pid.h"
+.LASF2564:
+	.string	"kalman.h"
+.LASF2553:
+	.string	"mixer.h"
+.LASF2615:
+	.string	"exti.h"
+.LASF2558:
+	.string	"sensors.h"
+.LASF2583:
+	.string	"math-vector.h"
+.LASF2548:
+	.string	"rc_modes.h"
+.LASF2537:
+	.string	"stdint-uintn.h"
+.LASF2575:
+	.string	"cdefs.h"
+.LASF2605:
+	.string	"sensor.h"
+.LASF2523:
+	.string	"src/main/navigation"
+.LASF2545:
+	.string	"adc.h"
+.LASF2576:
+	.string	"long-double.h"
+.LASF2547:
+	.string	"rc_controls.h"
+.LASF0:
+	.string	"./src/main/flight/pid.c"
+.LASF2587:
+	.string	"flt-eval-method.h"
+.LASF2524:
+	.string	"src/main/rx"
+.LASF2579:
+	.string	"typesizes.h"
+.LASF2618:
+	.string	"locale_t.h"
+.LASF2560:
+	.string	"pitotmeter.h"
+.LASF2595:
+	.string	"sanity_check.h"
+.LASF2609:
+	.string	"dma.h"
+.LASF2527:
+	.string	"src/main/target"
+.LASF2541:
+	.string	"axis.h"
+.LASF2612:
+	.string	"failsafe.h"
+.LASF2519:
+	.string	"src/main/drivers"
+.LASF2619:
+	.string	"__locale_t.h"
+.LASF2602:
+	.string	"bitarray.h"
+.LASF2598:
+	.string	"utils.h"
+.LASF2597:
+	.string	"build_config.h"
+.LASF2525:
+	.string	"src/main/sensors"
+.LASF2536:
+	.string	"stdint-intn.h"
+.LASF2516:
+	.string	"src/main/config"
+.LASF2535:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2561:
+	.string	"global_functions.h"
+.LASF2544:
+	.string	"io_types.h"
+.LASF2531:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375 \"\021\001"
+	.string	"\036"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\b\033"
+	.string	""
+	.string	""
+	.string	"."
+	.string	""
+	.string	""
+	.string	"0"
+	.string	""
+	.string	""
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"4"
+	.string	""
+	.string	""
+	.string	"5"
+	.string	""
+	.string	""
+	.string	"9"
+	.string	"N"
+	.text
+	.section	.gnu.lto_.icf.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`y\n5\035"
+	.string	"\344\036m\013"
+	.string	"N"
+	.string	"\201\343\364\365\017\n\002"
+	.string	"\002"
+	.string	"\002\001\002\002\002\003\002\004\002\005\002\002\002\005\002\006\004\250\320\377\273\f"
+	.string	"\005\343\240\303\320\003\016\001\002\002\006\276\215\233\274\002"
+	.ascii	"\007\265\370\213\367\002\006\002\007\002\007\b\002\b\b\240\342"
+	.ascii	"\234\212\n\n\255\320\303\212\r\b\002\001\002"
+	.string	"\001\002\t\001\002\n\013\f\r\211\241\250\277\001.\003\002\013\002\005\002\f\002\005\002\r\016\002\007\002\017\022\205\270\251\331\017\030\017\007\017\007\002\017\023\352\263\360\321\b\024\315\343\301\244\013\025\026\343\244\344\237\002D\002\020\007\002\021\007\002\013\020\002\020\030\373\364\354\350\016\006\031\257\347\353\317\f\032\324\211\314\370\r\006\002\022\033\315\204\254\230\001V\022\002\023\002\017\022\024\002\025\026\003\002\027\002\024\002\030\017\002\017\034\035\036\037 !\"#$'()*+,-.\243\350\364\310\005b/0\211\361\266\312\td1\263\311\346\266\n234\212\356\325\371\013p5\251\263\315\351\016r6\341\243\260\252\013\004\005\002\00278\267\225\324\301\004\0049\270\272\202\365\001F\007\002\023\005\002\013:\377\206\372\334\n\002;\214\303\205\267\n\001\002\013\001\022\002\022<=>\312\260\362\235\017\006\005\002\002?\354\230\305\225\006\004\007\002\023@\324\253\314\353\b"
+	.string	"A\202\334\331\367\r"
+	.string	"B\234\361\245\244\017"
+	.string	"C\350\230\231\315\013\002DE\255\374\330\210\tT\005\001\002\n\022\002\022FG\220\316\230\376\fH\245\213\310\271\003IJ\233\221\354!\003KL\366\332\320\323M\355\356\220\330\017\020\003\002\003\013N\265\215\374\316\013\034\007\002\031\023\032\002\032PQ\323\274\325!R\336\243\272\214\b\002S\356\344\210\235\007r\b\002\013\005\002\023\002\033\001\002\f\032\002\032\032\002\032Y\270\304\375\334\006\006Z[\336\222\231\360\r\\\260\334\331\257\017]^\240\342\234\212\n"
+	.ascii	"\200\342\250\021&\251\0311III"
+	.string	"!\303\030P\202A\212\250J\033\022\200\364\031\005T\306@3R\"\301d\245\250\2142\332\034;\020\330n\357\263\3603\247h%\236\3603m\370\344\215\263,\"h\375\200zdG=.\370\360\334\235\206\212\345\0060\177\314x\013\327$\334\277\241B0\240\333\214\325\317\302%'\b\340\342\305\247,-\250\203^\204<Z\"C\377\3467\350R\224u\224\334\3110\b!y\342!\317\220PN\305GURU\f\031Q&\313\0060M\277\306\347\252\225\310,\034\360(\223\214\340\341Bx\303\253\005\374\337\246\356\336\177\234\241\340\272\3071\201 \315\313}\204\302c\234:aEx\013\224\033W\3337\343\300\375Pz4\326\301\217\277\313CU\227\262\314\311\352\005@\252\257q\017\023\344\253\3563\262\256X\363\203Q\366\025\333\016\212\357b\001\343\032\023\331>\335l\354\226{\006\fnqq\234?Pj\253\245\331\372\20786\364\004\027"
+	.string	"\221V\230\273\177\255p\213\353\266\004\230Ri\031\253\236\231\324\242\307\230\215B\177\245\213mZ\351l\364:),\354\304\f\n\3777&-0 H\346\fp\210K\017\b\f\016\230\310@\030\370\272\227\207\371\013\231\346\370\206,\350v\331\335=e\\\025\350\363\"\362PY\364\bWs^G\215TzV\267C\276\036\356n\263\272\275\347\201s\246\233\317\215)\212{\274\201\323\364\337\220\032t4Q\257\2224\251,\323\025T\r|j7\036~i\"\250J'\256\306\306\317>@4\274t\357\250"
+	.ascii	"R\351b\376\313kR\314\007=Ae\264\250e\f"
+	.text
+	.section	.gnu.lto_.ipa_sra.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\024\003\345\b"
+	.string	"\262H\030\032@\205Cc\3030\f\257\245\272\363 .\246\002Y\206e\215\344\0302\366\2262\245\236"
+	.string	"\347\311d\226H?R\273Eg\b\264\037s\217\235\345\330:\333\254\311,\346\342i\271+O9'K\324\021\225\013y8\276\361bU\001\377\212\023\206\360`\260\357/\020N\201\246\357\272\003\332\235\353\325\325)C5\bh\250\320\3226\323\032\260\202)\252\232\003\021`\031bP\t\311\210$\005\256\327\030\351\2225\233A"
+	.ascii	"\300s\374c\250\234\347\2726\3471\302$t\301po\372\225\306\232"
+	.ascii	"\226\274\247\251C\343+\332\245\345\314\276\273@\2466\267\206"
+	.ascii	"\204K\311\202\362FP\231YJ\222\267\201\312x\311\\\326D\360Z@\341"
+	.ascii	"N\306\200jh\323&&8\373\310\263\204\204\227p\026\301\310\230."
+	.ascii	"\275\202\370S\225\237^=\201\313W(\357\335+\257\300\201\\H\257"
+	.ascii	"\374\316\250\020\316\310\201\232t\035\213\234\256\200\375\314"
+	.ascii	"Gg\210\263(\230d\321r\251\206\b\376II\345Y\220f{ \0062.\303b"
+	.ascii	"\035\372\"\351\\\033"
+	.text
+	.section	.gnu.lto_.inline.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\314\017\325*"
+	.string	"\346\361\255E\200\236M:\325"
+	.string	"\222\340\244\027Z\330w0\276"
+	.string	"\316V\021\271nv8\326\343\365\353\233E\357\251\304P\n8*\325?\240(j=\277\003\217\020\252\214\013\241\2338J\320\217\235\216^\226zZ_\215\020$mK)S\214"
+	.string	"\232"
+	.string	"\243"
+	.string	"\335\r\364C-0\254\016Z\t\243U"
+	.ascii	"\253E\253Q\264hg\350\257\352a,\332(\255MI3[\362\342\207\324\306"
+	.ascii	"\372\264[\335\273\243\026\233\325\275[\360 \336\2307\305\242"
+	.ascii	"'\236\212\"<R\340?\270^\355\207\274\0237-\353\177\005\253\337"
+	.ascii	"3\324bu\267\200\217B{\\\217\377\337j\273\361\317\261\326\360"
+	.ascii	"7&a\377'X\275\236uL\026\206d\247\364Z\215\356\336]\371s\277N"
+	.ascii	"\333\335=\376\272\rv\267\203\375Y\267k\272\373\300\257\364\222"
+	.ascii	"\030K\262X2^\025\023}Y\"\255\252\024E\332\250\277$\362\325"
+	.string	"\206\327\210$\346\305\025\024:\0219\337\304;\177\376\361\265\256a\361\215\236\226x`\316\357,\277\263\374\316\025\033V\247\f\226.\261\273k_\362\313\264J\252Qy\306\357\262\300hg|\202\251\202e\354v\003Zd\356\310\271i1c\007M\251\370\327\344G\327\347\330\n\340zgb:V\372\364f.h\252\353\247\207\301\321\252\352\031\212\331\b\205k\224\036`h\376S\347\0347\234\351\363\323i\221p\375\2040x\371\034\333\316\002d\322\216j\243kL\332\250\357U\267_UJv\334~\201\007\0245O\364\313\013\336r\222\344\215\366\270\205\3119\356\n\313\271\333\236\330\335\004NA\211\f}T\266J\226\031\030\036\335\363\t\f$\026\257v\310C\264\256\310\350\235/i\371\363%\252\037\300\310ReV\303\265b\035>a\020\035{\2044||Y\026h\346\005\226\246b\207\200\246\213E\026H\230\251+4\345\362\007'\342\351"
+	.ascii	"2\300\370\237\210gc\035\232*\264/v\013\320j\250p`,\025;B!\232"
+	.ascii	"\344\b&yt\262iwF\332|\361\227<zO\361?\350(n\360\234\224\271\242"
+	.ascii	"s\266K\254O\021\305\361\0236\026[f\345E\334\227w\332\251CMZ\031"
+	.ascii	"1\316W\035\347\b\346\201\003t\023\0136\265d\f\371\022\363\270"
+	.ascii	"\236^w\211\352\207\360j\213\212\325\321\345L\332\317\034\007"
+	.ascii	"\241\301I\214\370u|&\"\004\017\341\n\342\001:\210U\251\361w\261"
+	.ascii	"=)\240O\351`\001\212\311R\037\377\300\363\036\346\236\275\303"
+	.ascii	"\350\245\273\207\316an\210\323\335O\334\323\020\364"
+	.string	"\343Um\335r\\t\363\005F\350\031Zl\257\373\006\r\027\034$\343\365\270\232c\310-\025\2212\337-\201'\250\2411Rdff$IA\241\320\001\201\004D!\344,\225\356\001\022@\004AD\262\224\221\212\220H\211\210\004\t\222\244\214\262\222\016N\035\271\350p\207\0202\304!\002\021\"\215Qu\005\2232z\025E\030;\3161\251\304]n\260\365/\262lIJ\230I\240\221\244/J\366\222N\001\307\325\211\335FK\204\354\323\315A\0304\004\220\013\226\236\201hqP\273\245\272\270\335\t\206\351\001\243\265\244lB\230\302\\Y#\211!\227_%Vt\032\237\261(I\005/l\2348\265\213Pu\007\200\027\212+\025\035R\302\301rV\030\357\210\026=\27072I;\216\243\r\177*\203\212\242\325\002\232\272\030{uA\033\230\\\bV\217\225D\032\301\240,{\004c\251['\325\206\367b\271\033\005\355*>\215\340"
+	.string	"\2548B\362\021\260\030T\226_\306\360#Mi\n\360~/\300\243Mg\003CE\363\203\366k\370K\0362\375^k\023\241\260\331\226\363"
+	.string	"(j\3058yHc5\231\373s\"\1775\247\217DcK\276\027\263A1\351\302\221d\331\232m)\207\310\212\004u5F^\230Aj`\213/\351\002\344P\357@\372&\223\337!\372##%=;U\202\367\326x\016L\254kf\224\2054\216\202oA\004\3471\002E\376\274\310\206O\3547\210X\353\200\320\227B\272\250\t\265@\217\220\304\235S\236;\356\267\"\262\023\321kLD\240\346a\220\020a\304\005\303w\177\na\264\314\227B\272\271\272\322\021M\377\366\231PV\240\322\005o\312\326<\2550D\b\373\3276\3643\214\210\214\220\026\017p\2772V\240\375\020\022\342VwoC\3236\3552\253\333\230g2\320\234\262\021n\241\377\261\243\205Q5GnzJ\033\317\335\267N5-k\355\374s\370"
+	.ascii	"\345G{\261\247\356\b\030\220I\036\301\254\346\300,\261#\273\016"
+	.ascii	"\354L\271O\342!\247Wm\327\004[\322\223\313X2C\032\365o\"(!\031"
+	.ascii	"\0170\353\321\333\013\020\301\326<I\331\327\025\300\314G=\307"
+	.ascii	" \327\366\021\211\207\365\031\033\316\037\207\027F\226\022\002"
+	.ascii	"+x\302\226g\370\017\250\201T\005\301\356w\032\300^\314.\334\""
+	.ascii	"\210\301\200\001\317hs\310\270\220\035\206d\361\f]\024\034\301"
+	.ascii	"\260\272\360\234Ibe\310~\211\005\302\260\375\034\240\303\231"
+	.ascii	"\276\231\003(\373\356\021\337\335`k\221&y\236\243\243p\0050@"
+	.ascii	"\364\031\032\001e9\217\025-\311\246:%!5\317\243\t\253\3250p\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\356\020\325\037"
+	.string	"F\336a@"
+	.string	"\225\222\016\354\357\375\243\333\271\""
+	.string	" 'P"
+	.string	"\367\272\263u\377\210\200\223D%:\006jYL\372\377\271!%v\337\261"
+	.string	"]\026\302\243dBj\027k\004 \361\360+\257a\227\200X\331\366N)\005L"
+	.string	"M"
+	.string	"Q"
+	.string	"2l\333\005(K\213\177\317p\311{\2579\315y,\276\375\246\2226j\243b5X\315{3Y\346\342\340\235v\242\332\211\334b[\3038\232$&7S\365\254\236\224}\244\261\341\254uY\206B\345x\340\331\354\216\365\326vmA\035@$\004T>\245+\206,\003Mw\224\002Y\027m\250'"
+	.string	"\373'\355u9a\340c\210PR\270\206M\303w\261\237\362|\210g\210\007\257'e\322\264kk\3575$*B+:\236\260\245K\313\240-\203w\363\355\210$\311\272\255'\202'\365t\267"
+	.string	"\373\030\332\013m-\324\265\020\246\340M\210\035\304\216z\357=\177\260\376`\205\024\nW\276+X\257\340\335<\301\305%x\223\020\241>\374\0366\017\3570\006!\273\215\024j[|\2009\320\201\343\347\300\341\337p\310a\377\033\\\231\322\225\356\312\354\331\003mM\264%J\"e\204\210\n\355*\006\364q\266\300\203\336^\373\204\301\013\306\274%]\344\213\2724\351\210m\304s\223\343\027\271+\254+\234\371\2749w;\204\004\242\375\260\340\315y\250:p@g \366\017\213|\217X\234\030\335X\337\320\276\300\270\351\3220]\031\320\n\201.\250qQV#\222$I\2455\001\005\306(\007\225t\345\001\022\340\3020\205\3020\210\244!\304\230\221\021\221!)(\243\270PX\016\317$(bB\334\374\340\237\216\003\263\303LeO\241\232e\336vnl&\003F9y\001\276\\X6d\021A\202tbR\250\024\364"
+	.string	"\032\031y\364\235A\227-\\^\253{\343\261\201\337\036\022'\352\326\312\2656C\234;\235\241)`\207(\003i`\2717\224\214\200\247A\372\242\2371B\347/Z\305\377l\343\313i\255\314J!\257\017\r"
+	.ascii	"\203?\305\223\342,\245:\rn\013\331\fT\315\017l\371}\006\356\354"
+	.ascii	"\204?=gg\001vO:\220\355\210\203\225\f\306#\205(0\377\024P\215"
+	.ascii	"\263\362\200I>e\305\317_F\230\341\222\221:xb\211\200\3342\376"
+	.ascii	"\313\t8I\315p\235\244\257i\335x\232\316\037\231\026Q\001\nE^"
+	.ascii	"\2746\334Q\250\267 \"\201\320\246F\363\236\242\246\222\243\033"
+	.ascii	")K.A*A\372\340v\271>\206i.\036\350\255~w\214\361\034\362\370"
+	.ascii	"*\373\031\007\325\266\206\2077f?\263\025\250v\354f\016\343Q\276"
+	.ascii	"\2637(\326Q\341\223A\364\221\265\200\253\351\005\345h`\027\350"
+	.ascii	"\036&}?\001\231\251\b\213\223\224\356\233f\013\346\352\360\023"
+	.ascii	"X\253a\271F\022[\312\025>u\310!\205\355.0X2\246\340qp#N\246\230"
+	.ascii	"w\266\b\230\207t?\025f\020.\204\220\026\213\303u\320\222I\205"
+	.ascii	"C\300\360q}\247\257\222\310\246\276\227\255\326\342\024\323\200"
+	.ascii	"\013\316:)h\367\365\337D\n\004\225\317\255\270x\311\2104\005"
+	.ascii	"r\262\020\201P\3353\361B\3629\366)h\004\"O\327X\235\257\242\021"
+	.ascii	"\331\315\230\307\363>\211\2614\276@g\340\t\355\354^\262\330\177"
+	.ascii	"\207\213e\236\275\303\226]n\260\253y\216\372K\226\214\034N\032"
+	.ascii	"!\300\244\212\005\316\255\350\324U2 \234\2218\270B\270,\303@"
+	.ascii	"f7\bC\267)\205\n$\344\364\216\252(S\374\300\274\214Z\206\"\020"
+	.ascii	"\377T\227\200U\377,U\261\036R2gD\333\236\352P\321{\021\002BI"
+	.ascii	"\261qB\230/\261\301\007\330\321Sp'[\024w\230V\376\244\257\203"
+	.ascii	"\371\315\r\212\251\232\306^\bMI\022\207\021\316\263\fS7{\304"
+	.ascii	"\273\026\n\307\327\031\005\333\303\3223#%\332w\235\bz"
+	.text
+	.section	.gnu.lto_.pureconst.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375 \2005\003"
+	.string	"\002\210\030\035@U\322\001\361\2303\243+\227a\b\276\226\214\337\177\370\263\322\214\250\222\320\235-*\030\022\333i3}\245\2154G\237\350\013m\240\371\231\236\255\363q\346fjffb\346\345\263|\225\215r'W\222/r!\367q\035\267q\031Wq\023\027q\017\327p\013\227\360\r\246`\006>\300\251\257\326b\255\205\n"
+	.text
+	.section	.gnu.lto_.ipa_modref.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\f\004\225\r"
+	.string	"\266\32044P\2456\303\001\260\262\02393\263\224\200Q\325XWU\375dff\206263\240\215 \303\220-\376\377\372\026\005\037\377jJ?*\017\233ci\bm\"e\n\""
+	.string	"#"
+	.string	"*"
+	.string	"\"\273\001\376\002\224rJU^\025\nXjt\351&V\336\3209)g\350\\\350ly\353V\330\275\013\020\007\223\252\301PC\350"
+	.ascii	"ph^\312/\235\017\345\226\316\254<\353t\350\304\002\252\004oY"
+	.ascii	"\374\314y\245|\006"
+	.string	"\232\343t\343F\223\301\274%\033z\037\220\367\036\366\033\210\316\212\246<\323y\225c\244O\210<\321\233&j\273Z\204\2676+z\001w0\350\217\367\370\251\225k\235\034\251\203\34374~\222\321\221\317\363\354\0361\246\244\\Rwqg\213\n\212jB\342:\202\001j\250QM\310jZP\312\316\001p\202\021\252\243y\022`\345(\n\225D\251\231R\345\377\257\0034\004\304|yHOV\226C\366\332\233\223H#\273\303\020\255\245H\210\363\374\035\241+\367\240\2257>\240_x\346\023\354&TC\261\375\343\366\271\266\f)eqr\351\233\360l\302^B\227\222\213\004'\250D\345\006A\315\\D\342\001\321o\365\232\006\3560\202\007\022\007|\274\001\222\314>\314\024\205^\177\332\245#\227x\313v\231\375M\311\206R\037\223\310\354\336\340\022\350\206\007G&\2668\330W\026\357\323\227\202\254\201\365RE\270KMxi\377"
+	.ascii	"(\034\360\240\034D\333P\257\031!x\357\263z2\205-\207/\001\273"
+	.ascii	"\373\255\204\3359\246sw\350\344\200)\311\201\n\021\222c6K\215"
+	.ascii	"!\207\006"
+	.text
+	.section	.gnu.lto_.lto.2fbcc39cf4c403b6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidProfile_Registry.134.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375 \235e\004"
+	.string	"\244\007k"
+	.string	""
+	.string	""
+	.string	"&"
+	.string	"\005\001\212\001\206\200\200\374\342\203\336\222\037\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\202\200\200\350\306\030wu"
+	.string	"\334\007sq\250\365\006so"
+	.string	"\005\001\006'\001\254\201\002\216\240\0030mk\301\001i\300\001g\277\001e\276\001c\275\001a\274\001"
+	.string	"\013/root/repo"
+	.string	"\030./src/main/flight/pid.c"
+	.string	"\006"
+	.string	"C\210a\345*@\bL:\374\fn"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidProfile.136.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\375\002%\020"
+	.string	"\006XYD\360\230\2505\304Nb\307\034UE_\3555\361\3773~\317l\037h\371n\307\232\366C\212F\321\320\0318'\376\332[p#/Rs\322s\322s\322s\322k\257\252\235\334MT\017\250\b\253K\302d\t\331I\006F"
+	.string	"E"
+	.string	"G"
+	.string	"\223)\225h\264\347\315,xI\361\210\216`\245a\244K"
+	.string	"D\261jp\307\261\330"
+	.string	"\275\353\340\274b\217\346\200@\317W\252\002\344l/\016\304\256t\226\203sr'@p\225\340n"
+	.string	"7\333\243w\b\256\364n>g\347&D\236]d##\271v\222mf\262m'\245\237\220N\307\232|\207vZ\001\031%\366%2\005\327\322s\350\310\253\243\241\216\241\0018D\363-\332k@W\330U\206A"
+	.string	"\331wi\217\2315\001\207H\324\3447i\003#\210\243\204\230\213\210\273\214 \341qu\266H\031\346)\246q\236]\345\332V\266\031\313\266\263\224\326B:\355\272\314\261\337\252\314~\205^oTh>\327\233\275\246\273\261\207)\225\250B)a\342s\220a\026\362\220gL\007\363\360\266\230u],^\030\327\2701n]\031\273\356\214_\227\3066n\370x\305\305\333zt\360\215\007\223\020\306\021\341\034\022\3261\341\035\024fU\230\207\205{\\\330\007\206_2\\j8\266a\222\303?:<z\030\310\207\003N\250\301d$\335\210\031\2553\214\001\220\002\221+\233\007\021\220D\212\f\205iARPj1\340"
+	.string	"\332\226\033Rg\004\335s\3012"
+	.string	"q],u\241l\217(\266/:TS|\220(t2\310\200\003i\211\035\031\264\353\356;*\221!O\325\211$\022\227#"
+	.string	"\361\316Xr/\210\037\347"
+	.ascii	"hq\260rB\031\201\036\343R&\306\312\205\272: \237\020'\276\013"
+	.ascii	"\356\270\n\263@A\023*\332\263\370\345g\235\327\234\215D &\274"
+	.ascii	"\376\210E\245K_\b\236\200\207A\360m\322?\202=\210\024\fR"
+	.text
+	.section	.gnu.lto_pidInitFilters.137.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\313\021\355E"
+	.string	"\212r\b\031;0\346J\0079\030\245p\322\267\317"
+	.string	"\310\355\247[\243\t\341@O\371\21674\322uP\023:\232\025\t"
+	.ascii	"\200\216\0030\364\331\321\200S\017\324\027\256\252\252\212\021"
+	.ascii	"\331\214l\262\367N)\245\207\001]\001\201\001z\272\005\273\237"
+	.ascii	"\335s\272\375\272\367Zen>{\230A\2306\204\n\017\375"
+	.string	"\376\214\020\346a\247\276J\201\203\204\214x\002\031\031\350Q\337\2358\3177q\022?\254u\350p\nw\210\314\027\347\230<\200r8\205\353\243x\357\245s\300\335\344\376+\301\364\343@\2778{\212\356\275\033V8(\237A7\017g\210L\037\333\027I\261\3270\263\334\243\233\214\245G7\207\346\336\313v\312\255\246\0073\333)\222\371\0077\037\263%\340\0344\232N\363\243\367|\254A\332\326?#[\024\335\333Tv\312_k\247\\M\245v\212\266\224\332)s\003\b?\270\355\346\335\222\306\323#\322F\361\336\246\330c\261\232\202J\3627\332l^\325\266\261\256\254\252\262\250\246\244\242\240\236\234\222ML\354\222\026r=\252)\272\365\336r\007i,\276F\305\344\351+\323Wd\n\267\270\025\227\256\342\322Y\205d\3148\225\226\301,>u\345M\257\245\006\033\3149\210f\261\356M\257\243\362\356\3349\024^?\341\265\023\372\264"
+	.string	"\212'\347\272\251\213\351\210\241\356mJ\263(\227\024g\024_\232k-'\2253\216D\237\026\250\371z\304p\345M\256\217q\255.\271\305u\232t[\363#nC\034\355\245\\o\375u\227a\333\023\224\353\336\333_\332\320\370\243`s\205pI7!(\325\037+\206\232\257\273\276\264\225q?b\270\367\262\263\271\2755\003hf\227\301\314,\230\235\032\005\337ul\020Gt\2413C\376i\230\223\020\311"
+	.string	"\345\364_\267\022;\215\206\3503\271\233\233\367\336\255\267;\241\366\263`\223\310l\242\007\235X\357U\213\300-\b\310!\212U/M\355\264\277\371\332\2650\035\315\245\331\3436l@)\270\365X\305\no\266\025j\247e\337\210\020\345\226\336\310\r\247=L\251\3537\r\025\370\327\206\004\261\021U\034\235{\357}\037\352\330\263`\203\250\346\222\330\355,2\034\373\336k\256\2453r\322\231\321`x\263\215}7\241\023\362A\270\371\372\254\211\237EF\327\031\231\233B\374\231\314\335j\024\251\254\361\3331\223`\235E\230\201`\235\313Xg\262\016\254\363\006\326YC\006\326\371\002\353\\\201u\246\300:O\350\275\346\261\006\354\034\326z\232\225-\330\f\326\317f\004=\247\371@\3735\177!\235\r\254\316\005Rg\002K\316^\251\363"
+	.ascii	"\244s\327\352\314\225:\013Xr\016\240:\003H\235\267Tg-\3259\353"
+	.ascii	"\350\214\245:_\245\316V\252s\225\352L\205t\236Z\235\245P\347"
+	.ascii	"\250\2433\224\352\374\204:;\251\316I\325\271)ufB\235Y\244\363"
+	.ascii	"\322\352\214D\235\327\243\363QuVQ\347TuFU\347O\235\035u\356\263"
+	.ascii	"\260@sR\360\264<\241\346]\3228\351\372I\355p\351\315\326\342"
+	.ascii	"\251\235bY\375\325w\026\247;\223d\365}\247=\021\213\336\234\006"
+	.ascii	"<\201T_E\305\364\0244\274\316\370\377\364Lv\244\262\373N\257"
+	.ascii	"\213S\266$\225\335\340\217p;5u\3704OK\331\007\0168\017|\317I"
+	.ascii	"v\370\236s\340;0\001\323$\365S\016\305\237\310\221E\210s'SQ/"
+	.ascii	"\005\247\030\365]\210g\206)\371O\017\345n\336\306\301\302a\253"
+	.ascii	"\305\227\220\211mq%ea\236\004\312\351\237\216(:};\021\233>\331"
+	.ascii	"4\206}\246\241f\342\342E\024\231\276\235\355i\256\034\372\332"
+	.ascii	"\206:t\234\335J\236a\226\264\336\216P\263\255\027W#d\257\370"
+	.ascii	"\361\245\b7m\226\236^\f\221\317dd\3421\303\247y[\312\376\372"
+	.ascii	"#\t\372\3537$\252\271\244\224\311\327cX:c\373\2757\310\232\341"
+	.ascii	"\333/\254\277>\303\367\332\334\327\033%?\032\360\261G\376R\230"
+	.ascii	"vL#\215\266LWj\317t\033Jd\021&\225\2111.\255\217|\007$Riq\375"
+	.ascii	"\026D\334\223\202S\273\034}\365\217\317\334\362e\360fc\256\265"
+	.ascii	"\017\302\334\220pL\035\2621o\350G\034,xhGdb\021\332.\335\250"
+	.ascii	",\354\356\336+aQ3\002\301\034\302\314\233\315L\355\364\370\315"
+	.ascii	"\346$}\365\0350\321\211\364\333\211\347\354\265(\211\350\356"
+	.ascii	"\345\013\215\215\204j\367.\275\376\321\357\265/B\274\221\307"
+	.ascii	"\376\277\327\024M=\335\330\317\2757}&\367\231\352\001\034#\255"
+	.ascii	"u\244\361X\201\262\013\006\016^0`\201&A\201\023\332\216\025\""
+	.ascii	"b\350@\313\361\002-\007\313-\024\270H\273!\266#\006\214\264\031"
+	.ascii	"/\304j\244\255\240!\326\"\207\0161\005Wl\343\006Z\016\261\035"
+	.ascii	"6l\344\020c\233\313~;V\013\311\275q^\371\234n\276\366\200X\346"
+	.ascii	"\215\323\271[5,\354\031\303\362\205`Q\201\271\213\214n\267*\273"
+	.ascii	"\034\007l\333&m\\\234\332)\200;GKo\3043"
+	.string	"\345\352\231\314\346U\201\3704/K\331Je\241\362[\217\025\210o=\312\007\221\300\t\023\257/\360\006\342\320H>q8\355\231\007w\376\246,\201\033\003\004\276\300\367\241\276\"\004\276\013\333\213\212\336\335\232\t|\366x=Wa\267\022<M\276*\353\355\006Dq\276\263vm\200\036]\032\nk\324\340q\243\2222\373O\214R6\030\030#\330\267 :e\366-\b\366f\221\f\rx\200\347\372.34\230\246x\231\366\214\202<'S\3665\246K\300s}\003\022\251D\305\303\\\001\337\203\355%\207E\021\230\013\204y\002<\027\323s\361\245\224\335\202]\201n9\330h\230:)HZ\017\340\273\351]p\254\367.\233\215}\213s\341P\005\007\016\265\323\255\007\360\t\254x\226\263VmK\021\013\032\274\n}l\262^+\353\273O\3243\277\b\237H<\243N\r\036\001\202;\215\366A\360\375\354F\241H|?\021<\211"
+	.string	"\317@\303.\257\372\253\307r&\016&=\267\343@\340\320\353\334J\313l\261\264x\036\201p\250QP%\025\"\221\021\221 \222$)\244\003A\006\204\030TF\346\001\021\240 i$d52A\222\244\320\034\177{IL\374mP\234\2478\3701\251\266\036\2132WL\352J/\347U\304}f\227\231\336E\240\0021\266\034\243J#3@\\\267;|\207\220r\234\005t\346\223a\303#&\271\206\032Js)\251\\q\247\246\276@\0036\3022\227\032\335\323\266\315\361\377`'\002\032(\340\273"
+	.string	" \275\357\361"
+	.ascii	"\327ixBh\260\205Bwq\377\025\312\315\204\205\035R\347\375\202"
+	.ascii	" \225c\220\262\242\021\f\230eG\327w\245oq@\"\035\204i\201\\\215"
+	.ascii	"\243P\022\352\206\200\330\242\230O\302\357\321\267>F\236\325"
+	.ascii	"\243\032M\363\332]i\212I\022\035\306\034\305\026U\242@\0138\344"
+	.ascii	"F\007OL\255\360X10\371\224\205\025\204\256\2043\227\372;\227"
+	.ascii	"\024\235e\241P!\240\233\036D\205\255\203\306c\020\345\303\245"
+	.ascii	"\233\3031f9E}\243\250\340\343.4\342\271\310n#f\370\232\334\374"
+	.ascii	"\26482c-\035\221\307\316\323>\303\025\225\337\321\320\214\033"
+	.ascii	"\236\032\221-\344\234B(\333g\224\334\033\036W5\266\006\005\312"
+	.ascii	"\210\225m\234\241\342\345\230\361\377\177\215)\373\256\013|\334"
+	.ascii	"\303\035\366\217G$2\270\262\206G\ne=\017\252\340\273\307\244"
+	.ascii	"\375\022\233>\326\263~\b`\214\225\036V\373^\333\232\212\320\260"
+	.ascii	" \343x\037\373\342\215"
+	.string	"\307\267M\"\354^.i\030\230\244|\\:n\233\203`\323\307\330m\377>\3719+g\372\344\207\205{Q'\036/B:?&\342\222\250b\313V\233\036E\2032\033(j\230^\341\005\255um~5\314\017\017\211\022(\237,\325\227\310t\202;\211\206\370\344\260\203\216\034\300\250\347\334jJ1C\n\007\212\313\001'\024\374\020=\232\276\2269\335\235\324d?\2611\206\326\211Y\330\220G\203*\325\364\031\034\032\016~\210/Y|BS\\J\020\350\242d\224\250\263\237\240B`\312\366\027|*\304h\207\n\233\312\013\370\363\037\376W|\204R"
+	.ascii	"<\212\235o\033\002\236`\365\237\252\277]m\3352*\035?\354\300"
+	.ascii	"\331'\357(\341\240F\277S\341\263|@\234\032i\226\3413\353\337"
+	.ascii	"P#e\324\335~UbBb;z\365\313'\335\032l\334\223\244\033\361`;`\001"
+	.ascii	"\337M\307\340\034\243\006"
+	.text
+	.section	.gnu.lto_pidResetTPAFilter.138.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"M\f"
+	.string	"\246VSC\020q\224\016p\306h\003E\330?\272J\374\300\362A\025\2051\001=\006\006\\%%'\035R\004\214\250\305H\250\271a\265\377c\362\345v\371\205\360R\004\200\342(4\270\215\2408\234\036Ma\033\331[\312\224\002A"
+	.string	"="
+	.string	"@"
+	.string	"6v\027\323\020\337\036\241\346\346\177\365\216\316\343\0361\034\016\241\206\306\212\032 %]\306C\245BM\210\213\r"
+	.string	"\274\013P"
+	.string	"\013\b\031_=3x\037\231\227\004\273\353\354<\r\367u\333\fl\033\260\257 7]\217\327\002\255\016\036\331\342l\261z\261\211\303\376\270\324\224}\270*bkZ3\235O\3772@\205\245\001\214]\220\226\034\313\212*\"l\337>\211\315\316x\263g\374S\355Ux\300\200\022*;;\212\004\314.\352"
+	.string	"\n\013\240\247\250HN\327\243\352WFL|\023?q\322D\242\3531\365)#\367\307\375%]\bK5\345<\351\272:8i\241\362\206\375\0227!\371$\256`\312w\217\016\356l\036d!\254\024\341\223M\200\200Q\3108 \2543\"a\033\002\326B\236\021V\322\264\021\226\371\366pUd\001\013\226\207~\304"
+	.string	"is:\371\316\252\234\021\214\360ZPS\376\347R\325\017'1\354y\212\317W\002\027"
+	.ascii	"3\241e\034\370\352-\257\331\353g+\2608\310\331\303q\027\3632"
+	.ascii	"V\352g\227\250!1X\001\213\205\310#\b\366\023g\241k8\323\020\312"
+	.ascii	"x\346!4Y\025J\254v\356\001"
+	.text
+	.section	.gnu.lto_pidResetErrorAccumulators.139.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\225\001M\017"
+	.string	"V\233cF\320VM:\200#\344\251\352\nUt\007g\0068\302I\325Q\f\337\"j\031C'\\\246\301\264\371\221\355\326V,\344p9\027\351=\2131"
+	.string	"\236A\256\006\024Z\001\212\316R\007&\360\013\3066\323Y\333\310\336R\246\024K"
+	.string	"O"
+	.string	"P"
+	.ascii	"'\271e\013\375\323\331\367\2700\3013\264\273\234\266\260\036"
+	.ascii	"~7\314\326#\324l\371\"\324\316\027\b\001\022\353"
+	.string	"\\\217\220\300\356\n\350H@\bY\323\301\022\312\260\271\376\273\203 Mb\235\315S\204\332]g\254Kqo\267\275\262=\301\376\220\2073nR\366cd\223f\177\256\324\034\373_\305\261\357y\367E\b\226\024\261pd\367D\355\311\002E\0371\356\375\366Y\204L>\r\3773\211\005\211\3515n\243u\317?F.\024#\035=0\222\354n\351\321)\243G\224\037\330\036\341\013l\217\001\367\216b\372u\323\227X\001\313\232ST\374\260\336\203\307\016S\220\022\037\333\311\300\356p\036\373$\220`[\304sx0\020\264\273+7\216\003\204\377\342\321!h\362\261G\237f{l\2403\364\312\232\003\310\210\250\356\256K]\372\275S`\361J\232\377\005~Q\211\020\243r\001f\3454\200\225\372\320\002\355rzI\311p3\0310\2444\304p\034R-\0338\227\025\213;)\260J\006f\305\315\250T+\216\364\355\025\307;\037\311\230"
+	.string	"\275\024\0265\307"
+	.ascii	"f\272\251\316\262\364k\315\203_+\314F\244\023\332\315*\352\225"
+	.ascii	"\264C\270i% p\002)7t\007{R\004\241\275&\007\362\236*\334\205"
+	.ascii	"\205\035\270{\314\330\373\320\352\227\265Y\"()\204\005\213\362"
+	.ascii	"t\334\034\f\231l\016\235\240\027\025\320T\f\366\330u+\336-,v"
+	.ascii	"\272\211\323\004L\033C\007?\364\273\242\313\214\306\r7X\332\333"
+	.ascii	"\016\370\240\334\271\304\023"
+	.text
+	.section	.gnu.lto_pidRcCommandToAngle.140.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`6\001\235\r"
+	.string	"VZ\\B"
+	.string	"\223\223\016\377O\233\237H|\355\344K3\207\220(\376\236$\223^[\001\221n\217\354\022\33060tx\327\372\264T\341?0H\233\357\264\3655\013m\fn\216\022%\372\231\264M\350i\204l\222dJ\001I"
+	.string	"D"
+	.string	"H"
+	.string	"\3562\364e\206\220\361\"3K\212\200\343\027"
+	.ascii	"\333\326),\303\2655UG\242"
+	.string	"\304\345B\346\205\246Gff\036\023\260\374*\017\260\374>\302\234\221\253\315\302\325\211\031)\024L\311x1\310\314\"\n\346\203{\267=\320\326Ak\024\001]\t/\242u\225\217i\217\355x\306\026q\347b\356l\316\261\327\261\026b\037b\253c\217XD\254G\nx\260\361@Gf\207T\220\254\361`\230h\313\265X{b3\343c\001\307\357\244E\tbk\025^\301\005\033\0054\252\363*A\274T\354\327}\272y\267\252\277\373\264\243:\t\215\310\177\3438\335\244\260\273\263\307\204@\212\307n\032\026\236\007\006\016n\f\313o+X@\243\360\236\323K\345\334w\216\227!&L\025m\204\334H\004\322\006\242M#\201D\332JH\324\340\002\210\245S\024\223\004*&\020R\024|F&\2044\222\313k\350\203\242\265d$\t\021\264\025\225L\244\201X\262\320\310%\373\220tkI\031e\244m\033eX\227n;\367\230\256\241"
+	.string	"\360\267\276\2415\376Q\0011\231&\003\327\333\032"
+	.ascii	"\204)Efh0\202\333\004\025\264\270i\204\033Xg\332\2015F\tp\t\346"
+	.ascii	"e\220\246\006\3030K\270\240\251\311M\t\3055\321\030[D\222\t\f"
+	.ascii	"\f\003CP\250yp\367I\265b\022&\031"
+	.text
+	.section	.gnu.lto_pidAngleToRcCommand.141.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\032\001u\r"
+	.string	"\366\331\\D\360\2226\035\312\226\337\333\"T\255*_\305\272R\bVm!\266j}\354\305{\252\276B)\371\346\331\272\311z\300\222 rCK\241\341\374d\2737\263J\364\250\230\367n\t\025#\033\304c\033}\332D\312\224\002H"
+	.string	"D"
+	.string	"H"
+	.string	"\2261gW\306\013\030\273\253\300\t\256\307\254\262\355\247\270\n\222K\031\222\320`\225p\301\022\323cw\265\221\023\260\036\363\003\254G\035\361\322\263\344\277\305+\0243t\244ZL\317\r\203\335u\246Z\\n\275m\004\266\037\330w\t~\265\372b;\335yxc\017\377\3530\277\225\351\230\351J\323\252\351\314\364E\n|\270\001\241\306n\206\232\037k#\3068a\233d\207\330&&>\232\207)9\356\202"
+	.string	"\322\340z4\t\361\311\264\277\342,H\017\003\367a\001/\273\247\003\230\332\340\204|*\352f\303rP\223s\306\003\246\017\237\235\222\306V^+\275\324\246P!\237\3024C\251\311\252\225\252\036\305#u\223\203%\210\245W\215A\3558e\215s\246\003\216M\032;4\245\212p\037\350\215\266\317\013q\237\003\013[\n"
+	.string	"\237\220,@!\211\320}<\001V\272N\004\352J<\256+\351B\240o\0331\3479\361T\264\221\004\220\027B\321>oK\3218\321\212\3461`P\245\023i#\020\024i!\341\336\035\315Nz\301Q;z\024\rNb\260L\026"
+	.ascii	"\267S\240\314\2000\354\323\256:\214\325@\213\233F\270\001\212"
+	.ascii	"i\263\351b\323\202xF\355\002\246|\t\3155\334\267\026\220d\301"
+	.ascii	"/!\237\0165\017\356\032\251VL\302$\003"
+	.text
+	.section	.gnu.lto_pidRateToRcCommand.142.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\026\001}\r"
+	.string	"\326\031]D"
+	.string	"\223\223\016\363yH\250\355\313m\302\0201\342\021}M\312\036\021\312z\231P\020\311l\310\256\325\236X4\272om0\320+\200\215\244\253y+$\375\315X\231\215\262\2413\021%O\374 \375HH\342\336R\246\024G"
+	.string	"J"
+	.string	"D"
+	.string	"5f9\333\245\001\343fwO|"
+	.ascii	";\264\355\2578\213\315f\275\256\304\211\363\310\231q\261\263"
+	.ascii	"\273"
+	.string	"\321s\001\"\207\357\001D\016\225\304\267\347\346\337\346OE\215\027)\032\323\363r\260\273\316\024\215\207[o\333\200\355\007\366?\004\360\335\377\236\326\247S\323\037!\200\203C\302\217]\016-!{\003\342\240\370\352\2677\337\306$\021N\321^e\300L\035\006\244L\330\320\331]\004\207\006\255\354DM;\301\202\355\335\006\353n\210\0357\273\335\211\033`\207+=\342\363\001\371T\246oA\250\311PU\257\003\345C\006\324\257\356\341X\027a\354\264\313\231\244B\315\030\250\0242\331\3625\365(\235\247\327\22733\204\313\226sF\213\034\233A\354\316\224:\302\376[U\331Og\257\371\257\257\356*)\240PI\203\240A{\031ynAQ\340\2022!\304\340S\242\222\002\n\2254\322e\226O\213\b&\226*P\020Yp\211\027D\332Kd!\305\304O\001\217`B\244X\032\215H\221\244\333\277\253*S\017\2472\276\362d\326\201"
+	.string	"P\355r&\227\3321\030\002\026"
+	.ascii	";\303\033\\\221iy\252\215\261e\035\350{c\211\202\267\204\323"
+	.ascii	"\016\030\301\304\031!\330\340\006TB\217/K\2700f\333l\357\314"
+	.ascii	"ND\220\225\020.\031\200\312hj\347\023"
+	.text
+	.section	.gnu.lto_pidRcCommandToRate.143.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`2\001\025\016"
+	.string	"\226\332_D\360t\224\016h\212\325_\\m\005 Q\345\026\\\360\035\202v\205\317\233\202\366\030\314*#}k\007\376\007\030\232P\203\032n\007\260\374\006G\367\n\276#\313u\337L\3461{\257\353T\020\220&\215\354-eJ\001H"
+	.string	"O"
+	.string	"G"
+	.string	"\336\277\021\216\273.9bv\327c\005\332c\200\264\355\3178\r\317\206\301oE\213\323\320\260\274\216\354.\3279\201\354\021~@\366\250*\356==\377\257C\0313FX-\251\347&\302\356:Y-&n\275\355\004\266)\330\207\0211\246aLkLg\246\31710\363\003\203\220]\0221%\353#\356pq\327\355\343\3608!\230\307\376\353.\020Z\252D\001\026\013\"5\273\273\340\321\022\264\020\f\214\0318\360\376\"\302\272\213bH\314\356\3471\004\3551\024\303\223\371\033~\215\333\bpOh\312\033\205\231\252>\310\252\210L\246w\275\243\202\335\305\332\312\256\nAj\246\251c\365B%c\276\246~U\023\365\neX\226\2502\346\344\321\003\310f\022\373K\245\246\260\017W[vLo\377\376\315]w\366\227?\027*L u\"\013!D(\033\251\023\235\240M@\rN@\031H\017>"
+	.string	"8\214J\035*z\3641)\245p\335\006\r\245\016'\234\207\222\b\205\033\235P\334\347\200M)\244\023\327\231L'\216\363\355\341jk\323\216JU\254\345\212aG\"\240\005\325\376\200\312\2636\r\032"
+	.string	"\204)E&\036.E\013\244\220\005\007\013\264\270i\t,\026\005\313"
+	.ascii	"a\030\306\304m!\330\340\006TB\217/K\2700*\300\262\255\263\307"
+	.ascii	"\262\221\033s\237\020-\203\212\rN<\251VL\302$\003"
+	.text
+	.section	.gnu.lto_calculateFixedWingTPAFactor.144.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`.\005\335\036"
+	.string	"\226\367\300H\240VN:\214\311i\341\241E\241?\270\201\034\354t\356@\216R\232\205mt2\311\t4\240%q\257\253l?\013\314\266\261<\304\243|\r~\371\035\336\200\377\311\023rigc\013?\2117v\375\027?+k\t!I\312\024\257"
+	.string	"\231"
+	.string	"\257"
+	.string	"V\002;^L.|\315\211\242\270e.!\217\340P+U[\311z\345\233\204\026\007\324\312[\265\245\0247\301\2623\2639\347\217\222\016\252I8q`\327\326*\375\241\244D\021&\347|*32'\321\200{jJ\316\254m+\017\355\241do\215\304\250)\032\221,MXX\346\234\273"
+	.ascii	"\232+\225\034\325\246T\3625TIk\264\222\034\277JV\006P\276\204"
+	.ascii	"\303%\255Ey1E\206\n'\245\331\206,"
+	.string	"\264l\n.\251?'\035o\303\021\373\261\200\031\227\025\334\220i\314\241\270!\324+\335\022C\340.-h\316\351\025\016U\250_\3246\t\333\020l2BQZ\314\214\274\250\334c\270\202\302\264Zl\023\351\220\"\240(\333H\205p\250\315\311\244 H\210#]\324\234S\247@\034H\252\312\212\245@@X\247\314KZ\025*iM*\225\324\353\244\234~[4N\227\375\272\322d\356\231M\\\332C\331\372b\261X\364i\330>=:%\252\n\340Q+\365N\271\326)\3279\345\032g\3277\343:\3675\200rmS\256k\3125\315\256gv-S\256q\345:f\3270\273\276\355\332F\256_\276\256\355\232\266\353r\327\344\256Gr\375q\275\337=\377\360\024\374\222q`.tW+\r\360\333\263\232\353\276\\\2020h\216{\3155\b6s\232\377\204\311\274\374\314}\262dnc\341-\3658\347o@\314q\377\t\013\352"
+	.string	">\346cV\320\354v\333a\316\023\026\314\001\334\342\355\345\331\313mI\206T+\n\211\207#\305z\271j\035\251]\261\244\234p`+j\250VP\225\2072\355\345{\264'\tx\371\255\322\324\005\006l\270`\211\024*\362P\372 1R\024\031\017E~\374\237\\)\251Y\333\302\205U!y\032\327\023\360K\376\307kS\027\013\251\326\220\212\215e\251\327\330\257bdU\277-\252\006=\236oH\350\201\020\222\357\305\031\020$\320\200"
+	.ascii	"\003\021\003 \031\242\016>\037\257\267\301W\363\020P\006#\244"
+	.ascii	"\235oC\221Q\007\r;\017FBG\273\241\336\207\035P\216yHD\275\235"
+	.ascii	"\217\307\353\355n\304\251\343<\rk\227\225qmti\321|\316c\2367"
+	.ascii	"x\372\035h\003K\3023\326\016e\365\321u\202T'\\J\312\236\357\274"
+	.ascii	"\204\355\243s\237oX\020\006pF\231\025\321"
+	.string	"A\261H%\347:8\267y\3165\250\343\3468'\271\004\315r\277iR\244^cL&\034i\326X\356\352E&\006\340\232E\346\264L;\267\371\310%\230C\257TM\200\355\330y\320\217\326\223[&\335m\n\025V\205\001b\250a(\344\030S\3121QP\220\244\240\220\306\240\002\231\031\263\016\021\2001c\212\204&-u\237\365\3612\020N~O(\024:\305\351\242J\317$\005\212g!\031\252\030P\342v\331\231\0132\345\351\3030\304\260E\206p\254a\235\210\356\312\244fcH-Fm1\035\341\242\260\234\211\265j\262\346~\017w\245\351m\207@\226{\221t\265\255k\357h\262\3078\276\316\273~\315F\036\347\t\313A\312[\320\372F\334E\022\2162\023kxP\271\210\210X\272\301\336\354\037\013\300\315\247\270\244\002w\244\246\316&\221\333\f\337:\270NngP\216\320@;\321\310Pk\234\3348@\243\266\013"
+	.ascii	"]\rK(\004\373\200\315\371P)Q'p0d\221\227\t\262V\030\245jZj"
+	.text
+	.section	.gnu.lto_calculateMultirotorTPAFactor.145.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\251\0035\031"
+	.string	"\326\355\236H\300\226M:\024lR\337r\033)\303ow"
+	.string	"TB\030\237u\272l\022U\307\234\246"
+	.string	""
+	.string	"E\233\360\365F\311\013\003$\200W|\240\241\023\030\002\303 \210\216\350\007L\343\005E\201\365\214L]\006\340\301\266A\310&[\312\224\002\207"
+	.string	"\177"
+	.string	"\221"
+	.string	"\253j\275\372\002\n\264\200\302A\313\234)v_\346\023/\352\306q\277m\3447\271\025\001\013\317q\206\002\217T\274jU7\254\346\234;\367\234"
+	.string	"\274\347\363x\017#\033*\346\226\230\276'\0336\247-s\316\230\316\003\310{\3617\362\336\322\270\321?\351\305U#\377\363\211;\256\350\222nG\377\\\\\262n.\356\325NhDj\335l\272\256\033-\352\3149\337tEq\263\251~>sNk\322m\305\r\336\366\b\333>\366F\t:\347<\332U\n\222\272\030\200P!i\027\333@\027\022\004[\262\205\356\324\001\234\023\211A\020\022\037\020,1\225\220\367ta5p\276\217\377(\3413y\026B\237t\317\017!\357}\021\324x\021\352\316\004\262\350\224\223(S\275\3309\232\256\222\3758w\206\235\363:\356\306\221\352\233\250\266\211\352\032\251\006 \3254R\355\212\352\031\251\226\211\352VT\263\242:&\252AO\375E\265\364\324^T\307U\0073<"
+	.ascii	"`we\226fjf]\273\003\246f\025\202;\263=R5\034\255\225\331\235"
+	.ascii	"\252\232\025kc\266\265\004\236j9h\272c\255\001\247\032\016\232"
+	.ascii	"\356\254\033\263;\305\026Ff\312\213ssNo\225\fn\\\023\337\202"
+	.ascii	"\020\036U\001<\222'\211 a\302\004y\357\333\005T8\027\f.\217\253"
+	.ascii	"$7\356R\001\302\304[I\341G*\374\252\312\323\253\252x\373+*\334"
+	.ascii	"n\334\333\302\204\272\203\335\210\005p\316\331\343\023y\221\013"
+	.ascii	"\376\221\351\223d{!TQ\241\356\036\316\300\243@\003\017\006\240"
+	.ascii	"\036\030"
+	.string	"\r\321\254H\366\363\340g\250(\3062X\006\241\241X\321\206 !\017\032b \204~>\304dD\"b0\001\236\r\001\021\305\212f3\242X+\027>\316\235\341\353t\354u\277\356J\276\366:%^\316\336\206\016\247\206\372T\234Ea\033g\033\304\b\227\3467\235\265\204\005\216}\302\357u\263/\233\275\331\001N5k)\267\224\264\331\225\252\331\017\314N\346\354q\327\t\241.\303\312\217\234\203\335.K\316j\223Z\016\2325\324\207\330\2054\003L\250A,\"\221c\206\261\031Q\322\244 \351\200\002!)\273\016\021\300\271B\"\206\264\377\033@]=I\262\213:g\231P\304\207\252Yh[)\341\"Y\305\260\377\362\031\363\002\371*2\374\364 [\304\242P\213t \004\001\022\326\326NH\271\356B+s\027\256\301CrM\3423AP\036\350\211M(\342\177\23639\244\215\350.3\356 \017#7xf\350eC"
+	.string	"+\020M\241{\233\033"
+	.ascii	"<fu\033\213\332M{I\r\202\316\037\376\026\332\005\001\305\213"
+	.ascii	"\372{\226\f\177(\325\252s\"v\034\312;\275z\256I6\373\375\001"
+	.text
+	.section	.gnu.lto_schedulePidGainsUpdate.146.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375 \356\225\006"
+	.string	"2\f.5Pm\222\0160\354\354\207\343*\301 \253\034\263[\321 \314\333\252\266-T\261l\355nD\313n\343\"\274~\302qUUEUu\007\bK\201\257M,\031\204\310\024W*\005\353\0221\016\r\226\205!BX\t\017\261\202E\304\212\340\353\262\200E\314ua\221\332\262\317\003CI\022q\336\304mf\272\035\365\310\\\215%4\256Z\341\325L\205\005\037\023\216+=\020\"\"\225\244C\371m\343\036\306\027 \237\347_C9\"\261\234dV\224RR\004\202l\374\245\316~\244\333'\013\002Q|\21423\276\214fu\331-G\005\264\316\246."
+	.string	"!3wZ\307\242\277\376\006\377\301\177\021\b"
+	.ascii	"3\001#8\343d|\241k\270[\b\343e\bp\351\026\355|\002"
+	.text
+	.section	.gnu.lto_updatePIDCoefficients.148.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`J\026\225^"
+	.string	"\212\231\300!L0\016\323\031\016\346\303\246\272\274\264<z\0362\211\265\224s9\021\272\255\"$~\355\301\036\342#/\222xY\221\326\356v\226>\016\307\207\204]|\020`\0254\252\023\002\301\031\227y\315\003\354x\306V\355\356\356\276Y]\324D\310\2262\311"
+	.ascii	"\002\330\001\f\002\274F>\274E?\274D\347\035:\257\320y\203|x\221"
+	.ascii	"D^ #\357\317\221\367h\344\3659\362\032}x\213F^\342y\207\347\025"
+	.ascii	"\372\360\246F\336.\3622\221\367^/\3640\237\\\231k:lk\222\250"
+	.ascii	"\236\365\005\241\232,O\363\227\371\335>\344t\367n\344\366E|m"
+	.ascii	"\236k\\R\007xFj\017\267g\203fM\006V\272\004\027(\242y\334\356"
+	.ascii	"q+8\013\013\004u\2421\301\334I\301\341\326\270D\316\313\272\256"
+	.ascii	"jokB\253X\226*Z\322P\260GS\301\356\361B\034U\314\354\021\207"
+	.ascii	"\2262\373$k\001\250\227@\361B\034L\244\366c\366+\354\021\007"
+	.ascii	"\263\355*\250w\273 \n\214m]\346\310cc\233Q\274P\210_t1{\304\301"
+	.ascii	"\201\324.[\006Qbl\253\225\033\201\200`\246.\334\025\305\033~"
+	.ascii	"R\347\335\203\271\232\372\265u\256q]\335\234aa]W\252\005Q\274"
+	.ascii	"0\352G\303\013\323\027\r/\334Uw\363\316\206\266\376\355M\021"
+	.ascii	"7\300u]\255\232J\323\366S\266\357O\253\177rjbZRJB:2*\"\032\022"
+	.ascii	"\nB\002\375\034}\214E\342P\2306\253{\037\262\257?\251\335\t\314"
+	.ascii	"\033\t\334\364\345LKDw\234{J[\226^8)\215B!\215Z\3275\013#a\371"
+	.ascii	"Q\212\324R\027v\350\362Jz\345\2242x6X\330(\205\027A\227V\266"
+	.ascii	",\2530\321\333\245\362\270\001\023x\246\344\313\207\204\210Y"
+	.ascii	"gJ\322\036\204\266e\031\205\221[\226\314\r\320\245\032\003\245"
+	.ascii	"B\320%\224t\204\031'\374\363\021\224<\371\221\237\334\247\311"
+	.ascii	"\215i\t\""
+	.string	"\200O\016]6I\177\362\024\201\341b\276a\313\222\t\027\211Ex\270\341L\211\331\205\320\245\331W \302i*\245\0277C\022,\312#\231\030w*\305t\341\003$\331Xz\024G\004;\027s>B\026\306L\314Z\327uYI\246\344\253\341\273l\265\273\030\354\032\225\005|?\235\342\025\331\263\007E\263\202\360E<\266\321\247\217\202>\335\341\316\254\330\306~\221=\201\200\305NJS\003\306\321\342\0348z{qsn\303n~k\270\367\373\337\226j\202\312\205\313\360\302\017h~r|O\310\271\247Q\355l\004a7\367F\023\273\253\255\316\235\353]0D\355\322ex!\261\241\322\314~\346\326\334\350\273=\n\214\005w\3307\232\237ct\034\370\200\026\366\311\034O\rS\\W\260+\3672\334\216\372EUS\303\250a\2061d\360\225\303\216\032\353\257M[\330)\336\230\336n\325\355h\024\327uM\261\217\341tj\354"
+	.string	"\004\360\225\004\364\237wj\276\302\217d.\016\272\262\340\"\261LI!\355\346\336\200aw\237\265\325\331\002.\307\200\313\331\355\"p(\216\342\272\212a\305\301 \201\303\331Y\341\032^\330}\271\273\265=\335\353\270\024\320\241\243\017\367\2511d\334t7\227\277c\370v\240\355N\214\363\354\376\315\347v\354\255,\003\r\360\225\r\f/|C\335\231\201qt\233\326\240\027\363\004\346\330\002\371V\026\334e\013\343nF\243\321\350\366\224\335 \336!H\336\256 ^!H^\256 @\316\273\343\274:\356\366\275\361\265\377\200\363\3328o\215\247\371j\3218\357\214\363\3128\257"
+	.string	"\347\215q\336\254\363\3028\357\213#\257\013\"o\213\363\2628\357\212\363\2528\362\246 \362\2428/\326yO\034yM\020yK\234\227\304y\257\316;\342\310kE\344\255:/\325yE\234w\352\310+E\344\rq\336"
+	.string	"\316\013\342\274\037\216\274\036\210\274\035\316\313\341\274"
+	.ascii	"\234w\303\2217\212\310\013E\344\325p\344}2\362:\021y\233^\346"
+	.ascii	"\313\004\304\273t^\245\363&\035y\221\216\274G\307X\222{X||%\331"
+	.ascii	"g\225\"\371\307V\222x\212U\222\314d \025\032\217\341\205P\255"
+	.ascii	"\346\205\te\315\311i<\260\354\326U\354\312;7)\310h\311\301\273"
+	.ascii	"\2411\225\244\224d\364=\206\027\n\351;\257\345%\355/\214\316"
+	.ascii	"\031\020x\n7\325\2570\225\b\221\341\205\\\375\274\270\327\200"
+	.ascii	"r\306\302\207\236h\226\035\244\3659\3774*O\350\n\367\227\235"
+	.ascii	"Q[\006\366!\351\340\264){CW\244\241\273\3164\264\207#\241k\001"
+	.ascii	":\350\005-\220\250\233\353\202\004!\035}1?\022\024\372\366\004"
+	.ascii	"\355\350\032S\177\232\273\220\002\366\366\224\313\031\323\311"
+	.ascii	"\325\350\263\035\207\0240\026L\207Z\360\256jD=\302W\352h\342"
+	.ascii	"SJX\177q\233\226\030\262\b\251\340\247$*\031_\271\303\251\237"
+	.ascii	"\230\351\324'\2236\204$.O\220\013o\352\240\263'M}\342\316\214"
+	.ascii	"\351\302\260Q\363\202\206\334\032.\265\003mu\374\230\311R\377"
+	.ascii	"\334\231\371\320u\201\002u3D\235c\220\336\324\207\251i\364\021"
+	.ascii	"\252\323h\0317\363T\360\214Fg\201\261\340\377\364'H\277\214\210"
+	.ascii	"\323\350 \3751&\b&\024%\017x\311:\223\354\326u\305\332\335\244"
+	.ascii	"\037\203\240\226\031\331]\270\374\001\227\251K\230\250N"
+	.string	"T'\177J>\347\303\2148ya]\027F4\252'\266\256`\034\222Z\251?\266\005\251\223Z\003\336\230\336\025\267\237\006H\216\242\250!\360\225H^S\276\317\241Q\037\265\320m\214Y\324FUL\324\273jS\245\302W\026u\224X\177-\215&\352\341\263\310\236\037\272(\335\353\272~\035\273\271\\\234\372\315\274\030\270\227g\234:S\037\331\373\f\365\362\021F\262\316\264\205[87%\237P\007\365\220\2260\216\256\024\007\365\307\260\021\336\340\312\252Y\324\022\370J\241\376\236\024\"\375\265\310\016\352\341\337\230\036\023a1dS\335\251\211.\371%)c\3341\004\342/\240\243\272\027\276\256\353Z\234\341\321\276\237\301~*\003\033A\214\003r\020\207\374\260\200G\272%\201\227\027WW\0049|lumyI\360\343\001\241..\257\036<\264x\b\3612\256\217\253\022\017\\9\260\225\242*(\207\017\336\036U>~\b\261\362\212"
+	.string	"\202\037\022<`\025\344\007\217\t\254zt\r\261\252RZ.![]V^\\\\]VG6\260g\201u\330\327S7\233|\357\327dh~ujN\335\\c\035& \335u\206\246\256\245\365\246\325O\303q\177qBh\002\322O\243\325@\2500\345\230\251\003\016\220x\260\003\0043a\007Q\310\303fiF]+\327\t\325F\3242\247\336"
+	.ascii	"\216\222OF\2473Z\370\034{#@\307h\031\315\2047\306$\321,Z\200"
+	.ascii	"~zb5\211\216\361\306\250.J\b\2735d\224\272)\366\022\335\300\332"
+	.ascii	"\2275qT8H\352\346\362\321:\317\215\207'\317\250F\333\350#\373"
+	.ascii	"\344\336\260\252\177\206\254\203\"\247\301\372\253\327%Y\275"
+	.ascii	"gP\317\022J\236\024;\030\235\365\242a\270\350\027\2554\247E\273"
+	.ascii	"\b\004\304c\326\242\256\f\312\242\377\374\372\214\274\351\331"
+	.ascii	"Y\321,T\364\212\024\255\242\225\236(:\305\034\353\335\3113CQ"
+	.ascii	"\347\001\226\035\031\352\234h,\023}\242\211n%\332\004\235\030"
+	.ascii	"\346\230\225\250##!\007\032\347\252I\330\350\021}e\325#\252\332"
+	.ascii	"\212\016\216\013fU}6g<5=L\2656\374\206\307\235hm6\t\207[H\016"
+	.ascii	"\036\216]\223dt\207\364\333\310u"
+	.string	"\271\221k\363\214\332\350\257\371\020\244n\262\2073\202'\034iu\347\265\261\371;\240\033\204\236\312\031\\\023\243:^\243&\016O\034\206{K\323\001\r\360\217J\016\2371S&u\003\024\321TS-B\252\247Z\351\031\242\245\346\260[r\017\005\232\n\311>\023hmv!\032EZ\237\223\303n\222\016\263\205Y\203\262\003\334\013\340\216\301|Ia\017\210\016\340C\203\360\320\037\2328\330\241=\310\300]N\340\322\241\261\356\326\350\3528\364n\022\217MX\347\323\026\265\f\251\204A\261\345\230\025\020\200\346P\24374"
+	.string	"Q\275\241\225\334\306\364\240:\252\177\207\003\201\306\250q0e\021SfDDD$I\222\264\006\241\005\304\030\345\234:\333\022`T=\206\222\316\031J\243IJ\n\205\3667\027\353\030\322\3764\361\362\025}\212\345l\267%\353\376\3365$j\022\336\007\030\352\207\021\357\351\016\322\254i\211\367C^X\307S\343Ew\303>\305\223<\237\221\206\024\035Gp\314\277\304 ]\202\2050\342\263\327\326\375\234#\344\342\200\tJ\333\366\n\210\243p\340\361\375\374\241\216b\262\033\277\263\273\024r\224\231\340\027\226\200\003\227\236\210\363\315%\353\bx\202\227\035\316\301\264\r\\\323\354A\366\364\252kT),]I;O\306\210\205\013\203c0\353\253qg\foM\225\365I\301\367t\210\r(k\024O\250\016C\221\233a\f\252T\t\207\032\263"
+	.string	"o\020\302\2051RT)]\272\232~\004b\333\026\001=N\3561\213k\263\225\260|q'A\326&\b,\366D&\210\022#H\240\232XQ%+6Y\267\301\n\230&\017\323\340\324\354Q<\206\034\241\005\006}Ai?\177$*\265\261B\3145\242\032\021\005z"
+	.string	"\241\020\332\325\354\0256\\t\233\f\005\031\225l\225\370+R\f\003\232\326\210\310\363\251\351P\240\007\020\nA\235\353\301\031i\364I"
+	.ascii	",1\026\034^\223\206\030\304\335\3670d\310\277\262\"\313\212\260"
+	.ascii	"\375-\333X\202\323\375\332Q{\211\035`\256\274'\256\227\250N\004"
+	.ascii	"\307l\264\223_\037\317_\234\212\034]I\207nN\003\255\260\252\364"
+	.ascii	"oX\235n\334\361W\036\365\004\325\202\177x\320\316'\332\325\276"
+	.ascii	"\2172\257\016\313,\373\235B\231\244iy\362'\330\313c\034\336\220"
+	.ascii	"\341\316\003\022\213\337\025\2318\254i\362\346\027\344\333\201"
+	.ascii	"\007(\n\261\322Asa\f\0351\214\276Dn\fB\333\341\262\243\255G\250"
+	.ascii	"\002"
+	.string	"z\347Yb\353ex\322\rN\005X63\235\373dq\253\200N\310\005:\030\231\256z\"o\304\365\244Qe\300\037\020B\374\334O\320\211\334y\021\343\350\301\254\300\257\305K&y\204\300=\013\216\227\234\270\333\224\364\266x\354!\347\027\312\322\035\304g\220\250\251y_\331\332h?Ju`\375f\245r#2\235N\033I]\250\251\360K\234\006\0313A\002.\340,\215\263x\310O+\366\003\021\316\361\032l\312G\273\330Q_\201\036$`\363\241\265\250\205\225\312h\340l\205:\370{\025b\020\032\022\223Ocd\231\253n\316\270\0065\321!\373v\322\027\202\036xV\201\007U\371\332\225t\361\245\276l\223\232\035\272\250\350\r\335\311\225\007IL\030\231\020\342\"\r\252>\236\001\250M\202\216\270\230\312\303\221\356w'I~\260\331\212A\b\212\006\206apv\005S5\260)\303C\340\020Ee,\211\377=\016\234\221\351"
+	.string	".\316\272\244\257\215\312\355mL\356\324\021\253\224"
+	.string	"\257/\351\3168d\217\026\223\330\220\277Lz!\031w\324/~\260t\300\024-p\377\336T\204z\033\221"
+	.string	"\340\213X\031d\202\0348\301\217\243\020\354{F\222\274\2046\f\003rP\334|\tb\200c6\007\316\237\025\001/o\351\213\351G8\375\217/\275\024\207\270\303/2\237\301"
+	.ascii	"C\352\334\242\005\032U\\\025\035KJ\253\001"
+	.text
+	.section	.gnu.lto_calcHorizonRateMagnitude.149.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\357\006\335("
+	.string	"ZG\354\017F`\034R:\177\321\307\032\227Y\252R\230V\374!\230^\233\375u\372\366N_\325_\375A\231\337\303\250\375V\217\253\306*\356zR\376\225\031'\364B@\337\016u\376\243*\277\262\002\323\342\314\361\244\353\023\262\311\336I\006\350"
+	.string	"\334"
+	.string	"\357"
+	.ascii	"b"
+	.string	"\372gz\005v\221\341\360\035\227Y\231\366\371\223\346E\247\3345-l\215\371X\367\332:N\246O \256\271u\345u\261\034\027\323@L=a9\272\3271:\272\327c\334-\325\347\362.\367r0g\366\312\302-\f\217cW\235*\377\261;f\261\347\013\217\335T\325.\354\315\016\234\016$X\017\337Q@\026B\304\255JR\221e\217d\327\333\211\3351\360J\303\277\272\271\233\252*B\276\325\301\345\234\215\216\273\301\356\270\257\345^R\335Mt\271\305\2456\333\250\300\320\345\234\177\276\367\322c\364\004\322\343\013\345RWS\214^+\325W\215@\334$\225SW\223<\rRR\241\276\234\363\231H\213\217\034\345)\217\374\242\016\256\330\030\tR\036\321\236\232\223:\027\273\025\2424Z\253v\3109\267M*\213\274w\357nbw\177\351N\247\004\347mQ\321\262\316\236\372\271\232\213\260B\013\272\377\022t\215\340`\001\272/{"
+	.string	"tU+\3165k\353}\230\237y\324\f\253\270^#'\222\256h\237\315c\302\273'\273\257h\3714\2205zw\r\241}\222wU&X\307;\325?s|\226e\335\234\255e\313\247{i\264W\253\373h\276O\272y\266\021\360l\037"
+	.string	"`\333"
+	.string	"\317v\001"
+	.ascii	"\266\213z_\276\211v\266\007\034\354=\204m\013a\333A/{\003a\333"
+	.ascii	"\353\311\336\274\177\275U\325v\232\332\306\251mtg\373\252\266"
+	.ascii	"mj\373\t\220\224\250\3710\313\231\310\263ON"
+	.string	"\303g\272^\366\223\375_\377\362\007;\356>\260L\232\253\351\025\330<s\362eFk\215\031\217 P\232nV^\316^\201]\312p<\027\311\007\362\366f\007.\211\024\r\375!.7b\027W\202\304\0066.\246\364X};\357\231_`\305\305\353j\313W\321>\361\033\323\233[&\356\246\342hl)\016\32410F\306\222\315\2515A\3470U`\313\371\370\344\305\032\305\333T\034\314V\316\307\nl@\026}.\247\364\270\300\275\330Ed\2112g\224\023\206\244\017\347qZ\274\200\001#=.\272wkk~\204UV\231\0179\305\252\220\334\221;\225\344U\332\275Z\3661\322\0017@\234\227\266\243\335\323}\265\257\305\350s\265\214\031\366\311\031\351\361\200\313 \212\222\242\330\037\005\212\363G\302\266T\325\311\271Y\033\272\007\273\257\330\2741\310\222\264\334\034\236O\270c\316\305\005\366\016];\206\274\362ko\2061$\234"
+	.string	"{\361\274\235\251\321\205n\367Q\222}\362\367\314c,X\310;\325Aw\275B\367\302\0302\217\321>{e\222e\026mc\002q)\330D#\245"
+	.string	"EC\225\020!\n\351\210\006n\022z\b6\205\210Z\225\202\304\244`\323R\020\0041j\350\324\213\032\256`J\022\022[<\r\205Da\324\323\021\224\213\240\322\320\251\250\225$PX\222\200\024\274"
+	.string	"A(\250\204\203(|\252q\204\"H<\002>\rw\b\241\2066\210:\t\202\222\360\306\217h\243\206\260i\351\367$<r\372%AE\375 \030\350\341\215 \324\2178\034B\375\326e\361h\276O:U\"q7o_\367l\223\366\256\252^\fX\305k\3543\377\255\265$kjw(Z>j\357\376\253w\357\034R\r\363;8O3uq9\347\251\364j\265E\017\334!ph\346P5o\201\213\340\n\351\356&\272C\027\311\013\232\002\27259\242\373\245\023:`K<\351%\3027\275\t\372\r\212\257\357^\364b'\325\237\226\342\3629\017/\303v\347x>\\\b\200\212\250Q0\306\0343\n\315\310\210\202\024$I\033\200\002\031\252*z\021@\265c\222\255\366X\003\241\345\303\370\363\374?D\254\333\263\247\373^Y\003\246lENk\322\313\306\035\372q\324\362\366"
+	.string	"\213a\246\305\373\31408Y\022C\344\fs\t\216\346\016\202y:\267R=o\013\3572\360\363 \020\220\242oX\214\035\030\031\356"
+	.ascii	"\232\027\204\305aX\022\250\260\227Z\327{\305\242\006\376E\251"
+	.ascii	"\021\360\2653\013\242\202\213W\020\0207\242\376\373\032i\005"
+	.ascii	"\372\342\306\252\306\004\216\327\246\257S\177\356\027I\221\332"
+	.ascii	"\335\342\275FMh\330z{\307\332\030\252\316\267\203\001N\351\212"
+	.ascii	"\365ev\"y\323\373\210k}\234K\236}\013\\5S\340h^\304%\323\375"
+	.ascii	"o\277\303\2711\235,(\204L\360]\310r1Cr\013\253:\007k\"Q\310\241"
+	.ascii	"T\315=\310\0210W\330\202\265\267\231l\327\005>0\376\242\376\307"
+	.ascii	"\025\241\271J\213\2477!3\224\005,\017\016\233Y\\\026Q\020\177"
+	.ascii	"\320\365A|\030\300?\275\3278\204\032"
+	.text
+	.section	.gnu.lto_pidLevel.150.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\272\017\rN"
+	.string	"\232\204\004\035M0L\323\351\343\277\362\037v,\034Au\342\312@"
+	.ascii	"\231vfI[\301\001\3155\361g\317WrK%\006e\"hQn\335\365B[\356N\254"
+	.ascii	"H\357\371\326\200\330\237\234\257\205\243\310&w\346"
+	.string	")w\362Ub2\263n\ba\332dwK)\245\263\001\232\001\300\001\316@\253\363O\320\371\270:\033W\347\342\320\231\270:\373\f\235\207\026\234\205B\347U\350\034\024:\253B\347tu\006\006\235\177u\366\240s\367\b\242\245\253\202\257\226\340\357\336\256?=\267.\205\303\322t\335m\335n\335e\032\310\334OaTp]Gy\370\264f\307qDY]g\3508\356\210\034\273?N\262\234IQ\256sf\330h\267\346&\354\313\2324%\310\375\027\033\236\260/q\0024\241\215\206y\310I\032\216;H\017\332\f\373\322o\314H\332\f\267\036s\2043H\270\241I\230\207\235\252-B\223\351'\017\237\304\312\200)\261\342\346\200]\331\231X\003\037\250`nch\337%\327\353\346\2349\363\356\275G\235\262\017~j\"\206\215\002k\247O\022\250\3705\206\002\217w\013\253y\346\336\213\3045\326Nw\350Q\341j\035B\333`\224"
+	.ascii	"\2177\213\nW\323\332)\021pG\236\212v\346\376\322hm\247E\320?"
+	.ascii	"\367\226\271\235\271W\r\211M\254\235\262Z\017\251\235\256\035"
+	.ascii	"\244v\312-3\n\031\264\356\025\213\263\n\224lx\356\275J_\245\333"
+	.ascii	"\016\002\3729\032\213D\237\241\005\341\032TS\340{\313\375l\341"
+	.ascii	"\362\353\252\203\200\254\364O\324+\003\247\037\233m\354\250W"
+	.ascii	"\263\237b^$\206\265\217\024\271\013|h\241\311\226DiaG\275,x\353"
+	.ascii	"\020Z\274\300|\rA\266\204\331\301a\361K\351*\320(\357\215\257"
+	.ascii	"\353\312r\370\225\364\224\350\336\253\345\300F2\373\201Fal\232"
+	.ascii	"\024\277\260\200CvT\346\364\263}\353+\313=\330t\357e_~-i\026"
+	.ascii	"j\346.\200\231\2570\027\271\004d\030\004\337\214\031P\205O\344"
+	.ascii	"+r\346\366\203\266\213\367R\370A&cX\177\365\035\330\264\355\251"
+	.ascii	"wz\375?\241\203\277\362y\t~\233q\226\323\352\312\222\252\337"
+	.ascii	"za\342\254\367v\213\246\246\257~+"
+	.string	"\231XuZ\257EkA\220!C\3554}\244\356+\313\260:\340\367\363\201\231S\363o\326\255De\361@\302\340ey\036>\021\355\022\275\356\307K\337e\232\b\351~\374\301\375\201\317\\\303\206\367r\351\211\264\376\212\377\201t\234\326{o\013n9=\347\006\343\320\341\275\324\241v\372/\200\023\356\375\377\251\\\001\351\177O\032\357\251\335\334\335\233\325\202\271G\337\035\260\336\233\265\004\207\275\203@?\233\032\374P;\355\357g\003\273|\255\271\tC\203\343v\323o\022\340\326\200\027\360\341\275\364\241vZ\343\033\005<&\322\377\270\347\332\206\024\262f\323?qd\274\234t\261\343b\230x\365\351]\367cV\303\3627cn\340\3752f\2433\017\243\363\323\321y\207\321Y\307\3219\007\321\031G\257u\337pj1\3356:\255\233\200\243s\r\2423\215\031Gg\031\355\326\334\024cufZ\235a4]\363\013\243\263\213\243\363"
+	.string	"F\347\026K\r\246\233\205\321yE\2675'u\231f\244wN\361\316G\357l\364\316(\336\371\204\320\331\204\320\271D\321\271\350\235I\020\235G\274\263\210w\016\361\316D\2533\b\242\363\207w\366\360\316\035Vg\016\357\274\341\2355\254\316\031\210\316\030|\234/\274\363\320;\013\005\235\203>eahC3\250\2066\355x\031\253B\317\335\231\360D\266\003\r\234\277\355\331\215Yx\2637\037\203Z\352e\2771\273\347b\254\n\315\326\214\"\300:\276\337\232"
+	.ascii	".\316=,8nO\\J\216\270\021\204o\306\027\30401!\030\343\335\234"
+	.ascii	"\201)\241\277\364H\277\345\315\366\2518\336G/\f\036;\230[\300"
+	.ascii	"\366\261~\354\036v\217\332)\216/r2\337\272\235U"
+	.string	"\342\332\211\033\232W\237\235\353~\035\336\003\207\357\300\3419\354I\352!\375o\325\360\033\2763\274\206\177:\311<\f\237\341[\271\202\023\366\357\3074\357\315\272\362&-\326\2575[-g\322*}\t\217v\002\347\223R;\305\360?\306\t\347]\356%\265\325R@\201\332\351\205w>'\363D\024M\323\267\033C\273\314\t[\306.\307\370\373\313\223u/r\304\3207\275?\223Z\204\036\351\207\276\223Y\202^\350\323=\311<\347rb\272\343\266\313\267\332/\030w\367^\237\300\227-\023'-\024(j\247A\317\204\007\327\317\356f\024\204(\3227!\327\030@\037\343;\031\306\364@\357t\222y+\334\347\217\332\370G\r\343\231\333(\255\024\357%S\216&\227\371W|\324/\036\3063=\223|E:\262\027\337t?_\374\027o\364&\231\345\370?\337I\236t\255\343\377\323\t\247\306\035u\333\265\n6\206\214v:G\366"
+	.string	"\2639N-\276\361\237-\031F\374\342\267\230#\333\r\200qw\334N\361\253\226\n\020z\367\347\2675\253\322:\235j\247\304\007\306\341\245\r\337\347\237\255\265\322{\332\r\270\375ZO\213\245=k\267\264[\324N\207\017\\\301\231\326\026\365\"D\013L\204\205\325\220\250\"?\324"
+	.string	"\252~\004\207RQ4\252\250\252\252j\020\255\242\244\252\240\f\210*\"e\004\312h\200\020\217\022\222\304j\312\210\024\024\216(+(\036F\250 \230\252\242\"\"\204d\352\001( \013\001`\305\020"
+	.string	"\200D\265H2FYAY\365\0202ud\345 IB\246\216(Y\021\221\232*2D\311\310\024T\003JA\252\220(%e`\252#QUJVTTUJC5d\003\357\227\361\332fK\035\362\261\200AIO\020N&R,z\035(\305\223\021\272\373\275\245\336\321\243\370\024\277\201-\031f\364G\337a\017\032\027\201\241\353j\364}\007/-\351O<\212\017\356%\265\334x\206\366\365\023\017\334Kf\301j\023%z\375\347\315\270\347\234\265)\241F\247\357;gN%\2648\343\223~\313\304\003\361\022o\302\331J\274\007'\263\rX\322w\333\321\351"
+	.ascii	"\267\361$~\306\027\311\261i\274\227NO\244\374+f\007\023\304C"
+	.ascii	"/\231\3315\036\002;\267\252\261z,\335R\004j\247E\337\313'#\236"
+	.ascii	"\304\377\\2\217K\f\330\355\323k\346\311;c$6W\036\2328J\250\217"
+	.ascii	"\213"
+	.string	"_\301\376\251#\036H\2308Y\236\307\316\321\330\277\242/\254\034\f^Z&[gh\004\212)lx\212]\344\270\264\\-\276\345<\030 M\tD9\347@n\213\036\027\337rg2\326\250\361y3v\013O@B\035\317\343\2678J\323\300BC\216\004(u}z3\276\333r\370\206\367\360\"\236\231}\303\302\361^\316x\242\344_]\300\225\246\246'\304\213\370\247\323\364D\037\002\304\023\275\272\227\314\373\360 X<\267\302\376u\\\025\317\200\225\323c\356X:\356dSh\262j\330:\315\006\245v\032\354\364C\007S\330\002\201@\250q,\344\224bH\r\211\210$I\ni\fQ\005\304(\306\034L\017\021\0201TL\325\214$I\2411\213\346\330\332\036Y\f\364\314Ms\377\337?\245b3bHR\324\233\301\016\242#\373\220\217:\311\325\033\"p\007:t\013hX\226\341\270Z\255\252*\226\325\342\354\006]C"
+	.ascii	"^\347\305\354\325\"hKnx\210\351\203r\372v\002\277?\b\177`I/\022"
+	.ascii	"R\250u\250\033a\372\343K\243\n+"
+	.ascii	"\215\303z\315\037\2504h\365\371\366a\314u\331\335\007Zg \030"
+	.ascii	"8"
+	.string	"D1I\027a\301\210\213\376\312P\ft\003J\330\263\212\275\266\364'v\271\324\026w\256\336\370*\331\253uy\305\260\342\255\022\223u\272w\360\230\312\212|\226\2209v\231'\245\017i\256fB\033\225\334\027,\345a\260\345M\236\036&=\300=\267\220\003,\217\274\354\030@~\370\210\244\275\300K\337J\001\373\363\003\376\352\337\337\225\305\331\337E`?\352.d\005,\302I\025\016\264\211'\263+\244\253\315=\026\035\360\004\225\231\2214\2639\033\033\365\226HA\302\344\200\272\250\001\266b]\235\231\013\205h\375\023\213\260\323\341\340\202\242(N:l\371D\314\326\324fZ~\\[\035\372\235\237\245Ue\276L\233\263\201\303\201\034\201S\b \023\366\032a\205<Yw\002\237\031\236\234;\375\005o/\242\\V\347\331\232\003\275\310\025\266\237\332\331\202\370&\007\264L\nx\361\017\317\222\b[c\264\263>$K\201\225c\""
+	.string	"\213\023\312\002\356\313\303\344\200@\034*\272\265\215f\323L\274\306\320\230\033\350V\367\354\fJL\310\370\257\351\220\035\361\322\244\244`\227\035d\335\036-\r\214\b\004@\373\337'\037\223\376\375C(\006oi\221\220\241\372|\222\t\364S\317\003R\301\343g(\004\375\275dOJ\t\3607\201\332{\300\276y\324p\251:\240\376@\206$=\033(\372"
+	.string	"\366h\312\370_*1\006\225\036\270|S\2546'\007\032z{\"\321\232\312d\210\fs\304vgj\016\265\310,\317\326\200\001,\323\2123\326#x!\">z\025\266\307#\002d\214\234\243\276\233\235\366\207\361)\376\205\375\035\3440\277%\020\026\312"
+	.ascii	"\202G\206\371H\301d\300\313\344\226\243\252Dl+\214\t\372\355"
+	.ascii	"\332J\223j\312\204C@\205\227\255\243)\234D]\221\205V\003"
+	.text
+	.section	.gnu.lto_pidApplySetpointRateLimiting.151.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`p\0015\017"
+	.string	"\346\334fG\360\262&\035 \370\275\341\251\250*L\263\355\203\372\325\242B\244$\214\230\217\334\016z\230\351%\370\200u\210i\213`\360\354\0322\312E\251-w\0064E8~\"%:\037\331\300\203\375\226\374\212j\310\220b#[\312\224\002R"
+	.string	"N"
+	.string	"R"
+	.string	"\353\372\221\355\202'F\260]3x\222\320\265\355\006B\327\334\331?%\035\226\305"
+	.string	"\205\215\032\036 \273\313)\211w\217\232\235\377\330\001x\037\3531\3045*"
+	.string	"\212\361C\300G\023InLx\217=m\276V\246\210\312\356:\275\017\304\255\335v\004\333\020\354\327\b\352\262\277\363o\207\375\"\231\216\232\326Lg\246/\n\220\002\347\273\007\036\2737C\204\254\217&\343\204\355\333g\321\331\"{\205\006J\346c>\370\025\335w\034F\002k\323\372 \333\335\023\253l\327L\342J\017\312\363:\276\212\347t\207\311\274\300\006\236\215:\214\f\327\036\344P\275'\302\216\371\013\207\243\327o\274RG%\356b\246\363W\020\220LC\333y\340\332\022\333A\223A\2665\274\205\303mw\033\370<\251\r\033\3165_&t\355:\242\0036\223C\234`\226\203c3\210\r\262RG\330\217\273\273\016\023J\351R\312\202\227\224\026\223\003\322"
+	.string	"\323\212e%\241tJmv!\225N)nU\201\302\351\302\013\207\341\304\002\303\271\250b8R\211Q)\223\212[\241P*N\004\356\343\252k\233\315\360\231\321V\214\032:\034\361\341\365\020\345\246\327TU\333\002L\336\213jR\243,\373=\034F\257\035"
+	.ascii	"\007Rf\342\235\030\215\370w\371\266le\335\330X~\0041\270,\211"
+	.ascii	"r*\021\271a\261\357p\370\250\206\201k\244\353D\241\307\023I\252"
+	.ascii	"\320\bhQ\301@\300^sc\235u\031\003N\024\252V\304I\236\352\312"
+	.ascii	")\205\332\003"
+	.text
+	.section	.gnu.lto_isFixedWingItermLimitActive.152.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"\355\013"
+	.string	"v\327UD\020s\223\016@Om\022\366\002qN\302<\024\360\320\0234a\200Y\214\017\023\017\007\301\333\370\325\267E\350\233LHZ \354\f\037\"D3"
+	.string	"@\204DIa@\033\374ZL\b\034\027\002\264\262\226\354-eJ\001B"
+	.string	">"
+	.string	"B"
+	.ascii	"\325\243m7\b\215\314\375+q2\340\222"
+	.string	"CC\213\036\273\237\245$\316\035jr>\247K9\334\264\\\241\002\0174Z\006t%\350\211\t\241\343\336s\245S\311\324\200\354\256\323\324q\270\343mC\260\035\301\376\202\273V\021\366_\376\350\264\246_]\251\023Kw\026\033\273\247\231\324\326\2102N\330\276\375odw\354\020\024\241\314{~\212\253\030\375\305(\003\330\235\201\202\261\273\f\234`\363\210\340\236\352\021\276@Z\202\232\214jk\030\362&U\250)\031\203G\f\b=W]E`p\250\244\214\375\025g\301\371&\234\001%oz\364Q\252\307k\200\033\035H9\343{\347\270\370\260\301\307\216\315\037\366WJ\035a\037\356\006\036\0019(\001\211\220<\370\0200\311\260\r\323\262\220\n\027\266i\002|}F\260\023k\2430\001\263Pb\231`\022.X\227H\263>\007\234\235\220\210\254-\313DV\347#\035\252\352\275oR.2/Py\230\247\256\330N5\b)\r"
+	.ascii	"\204#\360\303\001a\230&\013\331\r+\f\325\026H9\021\200q&\300"
+	.ascii	"\\f\314\271\213-M\323\300\024\024"
+	.text
+	.section	.gnu.lto_applyItermLimiting.154.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\034\001m\r"
+	.string	"&Y[D\360\262&\035 \320|s\321\362G\201z\377\003\3444\205Pq\254\325A\317C\337\311\023\022=\260\275\360#A\340\365m;3\312\203\321:\312\f\264\342\201k>\005\377\013\343~\"\303]\022\237\nw%{K\231RG"
+	.string	"@"
+	.string	"J"
+	.string	"\005\254Cgv\017\022\231\325\030\320x\340\020cgw/\035\361\354\360if\376U\377l\234v\030\200\233\371\2133\327\207 g\306\017\001\\\314\0339\235\330\256zv\340`2\001<\330]\347\306}\270\255\333\216`\333\201}-\376\333\335\265\242\354\247~K\323O\323\232\351\177\036\r\210\257tvO=A\026\007\322@a\373\366\273\314\016\261!\324P\360\274\312g\361\026\331S.'\260\213\272q\263\333%\260\201x\350\356#\326a|\227a\033U\223\022\257Y\251H\0332\247\024/\246\2456\006\226\374\346\247\332I\360\344\334\250[\254+\n\f\0361\311c;\303_\264\304\3355\361]\2244D\023\207\276\213ux\025\331\221z\311\036\037X\205\300\261\t\304\356\264T\021\016\016\225,P)A\0215"
+	.string	"\r\020\231NL\022B\030):\005\024\302H\227\211\302\004\314\202\312u\001;Y\271RJ,\027\210\304#\222\250t\231F\243\322\025\322\355\337*\312q\265\002\347Ea\340S\273\302kl#\242\343\345\330|\250>}:\033v\354\225\030"
+	.string	"\007Rf\3429?\034\311\302fm\031\303\232\304\030\330\240\362\374\262\274\350j\324p\002G\323\033\026"
+	.ascii	"R\bu\025\032B\261\002>\326\3253\313[\0274\343Z\216)\262\345>"
+	.ascii	"\032\203\332\003"
+	.text
+	.section	.gnu.lto_pidMulticopter.160.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\332\036\r~"
+	.string	"\312\307\300+L \020\323\031\016\177\n\256\210\350g\347\356\333%;k\214J\fI\370b*\333\254r\f\354\340\326G\374 \206!\004\355n"
+	.ascii	"(\207\205\333\207Z\026-\200\002\240\244^\214\221W\340\376\340"
+	.ascii	"\266\201\262@\222\341[\007\3160\212\350F\233H\231d\270\002O\002"
+	.ascii	"\264\002\3073c\265\331\247\260\256kef\217\275\343\0173s\311\361"
+	.ascii	"\240\222\234+\227Q]\327\377\366\200\017\274\340\007y\345*V\362"
+	.ascii	"\222\255\326\350\246\215\031\233\2643\2665I\320TUU\307\210\361"
+	.ascii	"\362\246\344x\366\321\353\371\236\337\360\276\367\351\2559_^"
+	.ascii	"g~YNw~u\242\370k-\212\022\306gn\211XY\230\250\034\2379$\032\254"
+	.ascii	"DN\366\220}\211\3629\261\341[\026-\224\224\250cam\317\251\314"
+	.ascii	"\236\222\031\216K\026\234zp<0;\002\361\365\340xPb\251\036\017"
+	.ascii	"J\270v9W.\020K\263>\247\027\216?\374\274}\236\333\240\344xP\215"
+	.ascii	"\265*\255\260Pc\301\351\314s\026o4\224s\350\376n\325\267\333"
+	.ascii	"\355\357\254\321\355\r\222\257\3145\004\300\262\267\350\272:"
+	.ascii	"\247\356\334\307\235\316\353^\303\322\026;u\242\266\234\200\307"
+	.ascii	"\"\337N\235\250\034\253\222\353\204\032\035\272\271(\335\234"
+	.ascii	"\213%\033\365r;\352\034\211\3749rH\222\326*\275\243\232\030\246"
+	.ascii	"\265\335\303\021\261\204y\333\001\347x>\334T\216\225IZ\023\026"
+	.ascii	"\263\276\263\276\247NQ\216\227\363\267}\034)q\246\016g\333\216"
+	.ascii	"\325W\026'\252\3666\265ws\302"
+	.string	"r[\026-\246\376\006\211R\225s\325\"\326\201q\236\365\255\2533\005\227b\233\222\375\230\2279\r?\3634\177\236\355l\356\306\351\0067m\314\266(\331\244\235\361\030\201mM\0224\261\256\022\236j\310\302|M!\r\232}\222\245\021\003\201\313\0313\373\244\223\207L.\n\205F\303Z\022\341\272v\2612,\261!f\312\220I\362\225k\345\271,e\"D\177\024\237\362x3F\311\305\354S\270\256\255\306\245\227\2673/5\212O\367jK\214O}L9\356~\206%O\333\247\222\225s\r\033\326u\255\235\245x\272\f\024\237\262qwG\332\361\274\373\263\203Q\217\266\317\375Y\32773k\326ue\332\023\305\247JG\032>\025\336h\370t\325]\274$&kU\002e\177Wc\372\326umj\025\266/t~\205X\375\220P\220\021\350\247H\034\246\302fuO\234\021\346\302=U\002\325\354\314lU}H\310\301Kx"
+	.ascii	"\223\205R\340:\341A\304\031\\'q\205\313\204\033\205JtO\252\230"
+	.ascii	"\300@%\374Gx\364\202\213r\272'%\b\221\346\260\344\241\302E\022"
+	.ascii	"W\270\272N\274b\253\223\340\362"
+	.string	"\244\213\207\277{\212\005\314\2323\277+\\'<-J\271ph\213\211Pi]W\343\226\025\267\020I\313\205\346\320\326Rx\214\262\335\360;\347\254-+f\342\214u]\227\233[\\_\242\357~\304\356\006\356\212\350\022\255e\367.\312v\203\260\310\220\303\221[P_\34079\364P\312\321\013.J\023u\013\252\335Yq\237U\272:6\034j\242\376UW\030\267\240\216uQ\311T\262\341\323\241\346>\257\026\306\204z\205\262nk\352)\301\305~\237\243 \325L\005\303o\n\265p\355\352\25256P\007\365\231\\\262\250a\214?\r\324g\366]\241\361\323K_5\212=\002E^\025:b{\335`\276\246\236\020\274\317\022\303\336\333\351p\3427\211\255\304\354\252M[\330\303>3\316r\027S\331\347>l#X5\374\346\252\031>M;\004X\227\222\007\267{\237_\266ZWe\ta\247i\230bK\036\334$\336\333M"
+	.string	"\204\337\354~\331\327\262\253\366w\016D\306\357\313OO\r\177\fL>Q\277\275?jx;P~\272+)\217d\3709\334\207\273\222\222\377\326\270\372qY\371o\327\271\374\327\326\262\373\257\235e\367\274\030 \361^p^\013\210x+8\342\245\200\233|\203\234\027\310\217\363N@\344\365q\336\036D^\t\210\274\021\234\227\007\221\327\311\210w\307yu\2347\307y!8/\216\363\3368\257\215\363\3268\357\003\347\245q\336\031\347u\340\2742\316\033\343\200_\030\347m\200\310\313\300y\027 \362\276"
+	.string	"\200W\201\007~]\234\267\305y\0238/\002,.\370]q\336\003\316\333\244\242\210\227\211\003\357R\212\"\336#\007^\003x\353\213\342\274'\316k\342\274\005\020y\t(A\304;\300\007\277$\316\253t^\001\202xG\360\372\0251\304\033\202\253\276 \316\373\341\274\001\360\362\233t^\017\347\355 \304\213\364\303{t\350\327\350v_"
+	.ascii	"\210\274EA\274\034\214\274DF\336\241\363\n\2357\350\274\306\363"
+	.ascii	"\002\235\367\347\274\305\363\022\317;<oz^\341y\373h?\203\320"
+	.ascii	"k\316\342x)\373"
+	.string	"k;\347\2525\b\270\322I\331\274\300M~\273\037z\336\372\001\377\300_\360\037<\257\347\252\363\362\306\335/oq\255qYk\237\373\204\356\310[o[~\302\243\356\270\313O\224\260V\235\013og}}En\262\354d\215\273\204\231,_\261\b\234ELk\213z\235q\323GV\323\304\222\261\332\364\030\f_\315\314\340\204\234f\222\214#bs\203\241\255zyla`sJ\257]\225\2343\227\254\253\033>5\240\217\240]rP4o\235h\023\215\242\037(\350\026\026\bx\"i\207\373\354\223\250\347\026\346\327g\242\005\200\242q\275h\r\217\233\261\265\024\320\033\3301\337>\323\2557\200{\366\n\350#(\032\032\230\241\224++\020\001\375\277\335 \254\227\204.-\347q4\211'iC2/o\370\364M@\017\333\230rB:x\312\350\224e\334\260~Z\313\016\345L!\222h$2p\004\207%:\253\303\325\254\341"
+	.string	"\315\201\032\324\212\373\340Q\263\364T\255\001\272\003X\227\030\236\262\022\375\301\"\211\376\240R\213h\022\315-@+5\221\217\031g\217\241\373$\252zS\347\216\235"
+	.ascii	"\r\003\f\rO\027\347\272\256\304\261\217\350\r\226\353\260\235"
+	.ascii	"\"I\276$\237$\237\341\323\021\035\004\355\362\300\004\272\025"
+	.ascii	"O\025\021\315k\r\006\321!z\377\227\374K\006\362\233\"\372\217"
+	.ascii	"\347\2060\375mr\220\351\250U/\232k\003\234#\027\242\323\270\346"
+	.ascii	"\224A\020\315U\037:\200\006\261d\270}\276\310\212\2348\037\372"
+	.ascii	"c\336\366i\034k\353s{\023@3A\357\0021hV6ib\235\255~/\246\233"
+	.ascii	"\323/\032\203\271-\350 "
+	.string	"}A/\005\215A/\360u\325U\313M\330\r\005KW\334F\025A\310\n\2320\257\263\224\r\333\005\235\246iN\251\240-\3503\243J5\374T\263\234\250ZZ\303\247\025\364\020X\227r\213\321\250P\32244ag\314P\320\035\300\320j \201.Hs\023 \235\324A\372qL.\313&\253J\341\265}\032\255\240\311RF\305b\324\223\213\222\001\322L`N\376-5@\241\343\254_\2139\306\315+)\261\230y%\345\235\037]R\363\322Cw\350\244f\022X\314>\211\322\324f\360\3202\300\320\376V\245\302\316}\376\260\265\345\361:\013\243b\021J\233\363\345u\006\206\321n\0075|\332\241M@\321\330\352@d\334\304\372\270\255~{k\224\337\217\317\231\357;c\017\251\257w\324\3173j\244\376\225\340Z\036\333\252U\330\254\210\007\0272\250X\216\276,A\273\242\320\350V0\367Q\243\240Z\3417W\211\211\035\307"
+	.ascii	"\025t\247y\273\335\013\230L\305\322tg]\327"
+	.string	"\027O\227\2730\f\252\226}\330\323UUP\301\300\206O\217\372\315)J\036,Z\313\373B\327\353\272V\r[\313\262p\351\277\363\207!\3637B\247xQg\355\246\210\361\245\274\273\220\354\n\212<2"
+	.ascii	"\372vE\r@?\360JP\311\203iB\250\214 \211\244H*!T@\210<\035)\""
+	.ascii	"\217(\t\022\202\020#\310\037PRH*\035\310)$BTSQQ\017\330@N!\371"
+	.ascii	"\231z\nA\210\020\t\302\023\325\020\032\034~\210\210 \245\220"
+	.ascii	"TF\236p\b\2412\202\264A\205,\"%$\b\222J\210\224\207\0326~\210"
+	.ascii	" \251\236\240\236xP!9B\205\244G\022\344\007\034\220TB~HEII\335"
+	.ascii	"\200\222BR=\rAI!\203\370H\202\374\240\270DV \300\301\212\r\220"
+	.ascii	"/T\020\005!\302;D\005\221\247#MT\035\024y2\302A\323\007OB\240"
+	.ascii	"\232\206HM5\251H\332\250#H\251&\252\250(\251&\243S\371\257\235"
+	.ascii	"e\211_~b\312^\356\336\016\372\027\270*\227v\350\346\300\375a"
+	.ascii	"\216\344\314\343CG\311\177C\255e\177\356\202~t\337\245)n\324"
+	.ascii	"YL7\352\032^d\376\016\025\n\265\026\034s\246\030W4[\375g\013"
+	.ascii	"\031\364\352\t\304\342G\037\272t\243\376\321gz-\243ydt\353RY"
+	.ascii	"\305\353\240` \340\377x\313\217\017\337\236^\336\177\3677!\023"
+	.ascii	"\270\372E'\350v\023m\303fLS\217\262\327\354\323h%.\372T3A3\201"
+	.ascii	"\371\365\350F\023\227\347\214\031a[S\017\037\037kIh\207;e\306"
+	.ascii	"z\264\217n;L\271\036\263\317\237\2718:b\324z\364\t04=\t\322\234"
+	.ascii	"]X\264\004s\"@\003C\2264\3437yt\004fq^Z\206\376\302#\316\251"
+	.ascii	"\313\222P\242-M\3261$\313\276$\315\314\234\232m`\312\311\331"
+	.ascii	"\321]\222`\206\266\364XsI\206IK\252\251\ra\364\216\3468\246\334"
+	.ascii	"\007n2\340\2432I\032\254\272jQ\340\261\351h\027Z\b\313\321\016"
+	.ascii	"\264\216\036\252\373b\307\364\202\240\271s\340\350\033\r\301"
+	.ascii	"\n8\372\247\313F\323\350\033\335|L\257\032\375@\333\350\2441"
+	.ascii	"gz\313>od\005n\217\n)\324\350\247\001"
+	.string	"s\3210\372\201\376P\367%\217)6\243e4\215N\371\230\\\322t\026\270hc\351+3\276\366\331lpQ\024\274\034\350\241/2\224:\251e\264\t1\212x\\v\006\036\225\377]\201/%\036\t0\372\200!x\201n\240]\300`\240\033`\240\211mL=/z\201\026\332aF\025\350\027\375\241\355J\360\331T\222l\3670\006\227\245\213\004\005\372qP<(.\372\201-\272D\273hN\240\021\350\026=L\323\246\245\354\223h\f\356\253\2434\224\004:\006\006\315\242\021h!\037\323k\271\005o\213E_0\210\257/x@\253\350\025\315mM}@\247mv\275\345V\347\211V\323\236\212\024\315\324\273\324*\234d\260\264\245\255\233$\343\210\346\334\274d5\231:\035\203\345\226\254[\212K\001\204Q\364\261\327\200N\321@\002\202\241\2502)5J\202\214)D3\"\"I\222\244\003r\013\020\b\002Q\236\325\324\003\022"
+	.ascii	"tE\217C4&\"\"\326\030\206\001\003\215\371"
+	.string	"\266\311l\247?\023\236\215\226\316E\304\240X\233eMD\377\220\242hh\273K\222\003\335\340\231uI\022*\244\344\321v\006\034\352`\372%\305=\211\217~\004{zh\274\343\034\002K4\231\017y\274\264\315\372\303\246\245\003\204\263\320\222\321K\374\331\230\202#:\322\207Z\177\277\305\271m\212P\273\274\t\376\357\254\252\215#\375\306a\n\013qn\257\216\344\354c\362N\323K\361\310U\301\035\254\243+\217\300D\311h2\245\367\357\366dP\300R\212\240\002 _\341,\365^V}\222\200]X\306\227\325~\r\242\300)P\315b\022\365\230>O\251\231\3070cK\373\031&\371\245\273f\370\020\206\027\233\241\243\233u\2161\361\003\275\225\373\255\037\253\377\2341b\304\374\315^Z\020\223\252d\325\034\361X\031p\222\261\356\317 ,*\t\225\336\220\244y\021\224+\030\022e\2622\215\021J\244\271%\346>\240J\254\260\300'"
+	.string	"FQ\210]\340\374\005\304\032\027\375\304\320\243\301\263\240\374\206\336([\362\r\315\3709\030(\020\023\034\343\240B\353\250\031\273\336\027\276\312\347#\035\242\241n\251\204T\274\201\256\267\327\240\211\240\231\024\346\215\201O\262\271\020\033~\361z\007\035b<6\f\3140E\004\215\322\206\337t\311&\214y\350\nS\254\307\201\263\031e\351I`\343\253\026\300\346\260\307S\204\005Ec\246\357\270\303rI(e\257:\221'\033Q\340\341fa\272\317\240\337\0065\260\023\212\234\314\267\021R\312\006\307\343TL*\316\314\222\334\264\321J\354\310m\234\223\226\335\253\025\032\350p\300\261"
+	.ascii	"\"\316\203\277e20\325DI\345\370\313.Jm0|\361\336\220mOc\207>"
+	.ascii	"{\022\357b}\311\263\224\215\263\byl\305\304\276\270\3011\330"
+	.ascii	"\303%C\371\243[&8M\253\362\305,\005\306\274+>\347XB\266*\212"
+	.ascii	"\262\216f\177Z,\256\267\237\rC\t\311d'V\"g0\2347\201\265\361"
+	.ascii	"\032\034A:\021\035G\266\326\3034\247"
+	.string	"\016\304\304#Qr\210\304E1R\021Cg\261\225\347\t\"\277\277\335\037\273\373\215w\005\335Mrp}w\316\373\330z\006gU\177\035)\272\003j\034Y\207\363\376\333\360{\305\013O\250\375X\237\200\221cq\316oyj\246$\342\243Y\"\260\201\264>\201\330\323\\\360\243\254V\363\\\030\257V.\331\335\314\356pJh\210\336\345XD9+\305\264 \214\267/\373s\245\302D\254\237\252\353Z\277R\257\265'^#\302)t<\306s;\362\365\314p\247q\363\027\336\r\330I\332f\235\235@\275\027\031V\372\rp\317\321\354<\316\305\263\341V\031o\004\214\013\350\177\341\270\311\261ku\232S\022Ac1L\331\0273\361\323\265\257\363\300\266\361\321\003\234v\353BH`l+\031\256PkL\212\226[?v\260,\241k\020\311tT\344\263s\221\025\316\311,\235]C\276\277*Wh\2462\2544\034\217M\036\r2"
+	.string	"\251Q\264\035\241#\223\033\351\341\237\341\254\305'\364\205\340\354@\0227b\346\263\351\027>\272\3761\032\353\037{\225Uv\367\213&Z\025#9\002,S\004\200\037\376\262\232\213,%\314[\304!RO\254\333\201%\020Mc\346\276)\241\346\004\237U9\276\256s\256&R\273s4\335\2338f\253B\333\311\002\022/U\323\327^\356\nw\377\227\263\333\"\301;\263bv/\234(\264\310\206\030\234\335\363\377\207e8\021\031\314"
+	.string	"#\260\275\201\226\024\325\316\336\240\324\236\342q?\036\215u=o\204\001\222\2751r\bo\017$>"
+	.string	"\330\223h\361O/\250\372\340G\304\333\303\0054\f\204\372>\233\201#Tx\375\305\t\311\016\265\242X$\353i\227\356K\273\263\262\350A\363\213\200\226\335&<sG\362\211\t\022\031\211\224\026\252j\257\026\226\257\301s\326\341'!5\204\237\211\346\317\301\367c\007P\345+\234\206|\002\021;\203X\341\210T\304\214?`\257e\315\033\3746\026\344\007\n\325\224\234\303\340\232\034\254\224\306o\275\024\177\377J"
+	.ascii	"l\007'\340\3063\007}JGc\243\004\013\331\0209f29\036a\234\256"
+	.ascii	"_N3\2030sc\177\347\241\274\221z}\246\003\274\346\244\26719\363"
+	.ascii	"\253\216\373\006"
+	.ascii	"\355-!\252\004\250vX\204)\356 \255\017\tS\201\363>*\200\274U"
+	.ascii	"\241\201}1\304xh\233^w\304!\353\254\200\312\036\030u\b"
+	.text
+	.section	.gnu.lto_pidMulticopterRelaxSetpoint.161.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\t(-\241"
+	.ascii	"\232\370\3146K \320\322\032\003\367\336a\346\3730\230-\225=\364"
+	.ascii	"\303^\331\240\252O\034h\252\353(?\210G\020\275\004\246c\021c"
+	.ascii	"k\"\t,W\006\230<\230\362M\367y\361\302m\360\204hU\3660\252\231"
+	.ascii	"\273\003\231n\256k\036\005n#2\245\224\002r\003\370\002e\003Q"
+	.ascii	"\377Rb\246\243*\331\272G\277\224\244p~\361\255\r\236\035\335"
+	.ascii	"\213HY[\005\331\244\217\273WS\253!\2025\270\005\357\372\276S"
+	.ascii	"HM\324a\227\364)\016"
+	.string	"\205=\212K\271\223\322\305T\344T\320;U\005\2059)_\024.\236\0065\301\336\243&k[\374\256a\307&\366,\337\362':\324\2368\311\203\362\266\245\265\205\317\231\034\233\250c\232d\366\254&o\262\305o\360\350X\354(p\017\237\340T\354U\316\304\257\214n\324kt\315\241<\256\240#\234nuf\307a\262\335\255\316\360\264\335\353z\375\271#0\271\343\376<\241\377\234\214\332\336-\242\275\256\316r\023va\033\366\241\277\316\364\246;}\212{j8\363\305\214\333\032\335\234\0226\327u]\270\030\272\244Y\322p\270\257=\247qh:=\3309\274V\036Xt\r{\245\344\207u\363\344`\257\320\023\263:\375>\337\023\316\324\302\\\331\324\321K\022\302\013\204\002\016\\\274\\\005\225\314\br\n\025KD\354\225\305\005*\215\t\\\002C\322Y\326&GM\221/I\036o9j\212\210p\272\375\347\324\276]m\357\226"
+	.ascii	"\316/\203JZ\222;\336\200\334q\372\206%\375\347\364Vo3,\305[Y"
+	.ascii	"[\033`\333\261\211\212v\335\307\355\347\246i+7\037\273Q\335\306"
+	.ascii	"\215\327mz\257mX\301\367\306\315\223V\033a\362\350\375\306\315"
+	.ascii	"\323\215\267\271E\342\255MU\357Z\325[\3414\3436\033\034n\222"
+	.ascii	"F\357<6I\214^\246\234\344[\fHq\314}g\254\022\246\r\0165\311\366"
+	.ascii	"\276\213\272\361R\271%U\3712\2706\330D\245'\311\266\3534\334"
+	.ascii	"k\240\254\211j5Lm\253A\2655\327\2674Q\334uJVu\234BET\243I\202"
+	.ascii	"d\266\275M\214{`\332\326\006\337\267\315D\332\221\272\204\033"
+	.ascii	"\256\307\264\fMC\313\365\264\351\332L\327\240D\247\2063_\310"
+	.ascii	"\232f\334\326r\244@7\247\204\355\254k\312\264\f\2270\375\256"
+	.ascii	" G\206\247\\\344\316HH\243a\006\236\266\211\303\205\315\325\211"
+	.ascii	"M\2068%\355\033\327gjVgBf\030#FI\277[\257\353YQcr\355qlb\016"
+	.ascii	"4pK:\006\236\266o\334\333\343\354\222f\255\213\214c\023\271\337"
+	.ascii	"N\350i\"\017\256$s\303pB\273\361\0249\325\366\232\025\367\272"
+	.ascii	"\342\326L4\221[\034\233\370=\3148\244\311v\346^k0n\263\361\224"
+	.ascii	"w\3367M\336\334\373\276HL\342\330Dd{(6\261m\242b\023\331e\376"
+	.ascii	"3\242z\231\r\250\021V\301\r\276\357\233\364W\370\273mk\036r\267"
+	.ascii	"\211\206\204\202\200~:\370\364\360\354\034\215Eb\373\356r\033"
+	.ascii	"a\204\351\026\007/C\247u\006-f\023\265Ae\355\002O\037Za\013K"
+	.ascii	"\013\031a\210mQ\351\240nJ\033\250e\200jP\005\237\034\252\334"
+	.ascii	"tZ\026\231\377P\301\022\365\016\325,\351\227\373\030a\244u\b"
+	.ascii	"\261-\025\272\247EV\263\274Tp\236)\275\323&\243"
+	.string	"wO\272\2325\245\365\240W%\216\024?\206\020\333\352jc\225Ou\210\264\254./\266_\023\253\200\231[\303\212mai\342\021J\267?ZT-\362}\337\036\255)\377\326C\023\026\240?Z\3166y\245\243\323|\355WZS\356F\030\357\373\262C\265\266\232\213\232\271M`n\013\230G\244\bBq\200^\252\377\276/\263\370c\354\355Q7_w\0301\331\024\336D\013\375\025\263\211\b\300\232~\335r\021+\001\310e\350\333*\364C\337\205U\206M?$\376\030\263\337\225\216N\273T\f:\341c\356\025oh\320\027\241$\243wO\036\350\337\360\315o\312s`d\273\322\342\317\003}Wu\311y\031WZ\346fq\263\024\233\370\363>\030\315\202V}\237\006-O\205\316!\341\307\357\034\212|\334-.\027oh\207o\337\256gr\317\363\274\317\3673\315\t\247\326\263\363<\337\317\3017/;\177\344\366\345\370\005\224"
+	.string	"\364\252\032?\214\013\306\005\241s\220\316S\021\305\347\266\306\220\341\r5>\362\371L&~\373\305\357\347\032v/\376\002O\271\315\230\006\227\361\206r\231b\023\211?\200\264\253\351\207\374\317\323f\237z\337\246\210\366\211r\3173\247\037\362"
+	.string	"\316m\245@\311\033\372\337j`\316gr\3635\217\030,\030v\216\r\335.<\353\\\261\201\357S\261\337t\265\221\315NR\354<\377\276kd\323\263\334a\016\233\366z\226\271\315\331\375\376\030s\367\373V\230\333\331\351\203\263\221v.2\344<\002"
+	.string	"\316M\216\325,B;\023\031\322\316J\2433S;\0131:\0071:/\265s\bFg\020\214\234?hg\017\332\271\203v\346\240\2357hg\r\3329\203v\006\322\316\030\264\363\005\355\374\243\235}\264s\217\3166[\320\316<\214\316;@8\3530:W"
+	.string	"\3029G;+\031\235q\200p\246`\310\371F;\333h\347\032^\326L\243\235g8Y\263\214v\236\300\245\3151>8\303h\347\027@\316\0214a\263\213v\206\300\350\334\242\235\0370:;\340\301\231E\0276\257hg\025\355\334@;3\220\242\r\233Q\264\363\002\355\234t\242\310\031\211\310\371\310D\221s\222\310Y\001Gk.\321\316$\332yD;'`tF@\304\220\363\001}\330\034\242\235\221\355l"
+	.string	"\220s\001\3766\023 \344<\2003\233\005h\347"
+	.string	"\332\031"
+	.ascii	"w6\033\2653\210v\376\020"
+	.string	"\344\354a\307\271\250\373\232\211\332\332<dt\026\002r\016\372q\006\372q\376i\347\016\355\354\323\316=\355\314\323\316;\355|lgc;\027\333\231\330\316m;\177\263u{o\375\334\232\235\231\032\341[\333\336&\207\204o\033\242\031-\216\325m\355\356k\227\266\223\265\227\265\243ug\273\t\273\013\273\r\273\017\333\337vf\273\263\201\230\233\035-\355L\013O9\253\232t\264\246\262\237\345\330;[\342Z\366XH\2636H\3468\305\313\330\315<\013\367\260\353\372\025v2\227:\026\327\315j\242\204\247Jt\256I\005\247\342bn\305Wx\255\273\026\242k>V\226<\272\217\265xsuPIvp\257\322\3241p\031\261\021{_|\256\016'a`<m\361z\t0\274\370\035\241\270?/6\274{\262\326\341\307j\344q\365\240x\017O\274(O\212\277\212\340\233\r\356\303,\355\204\335\235\261\201\211\340\023\220J\351l\263"
+	.string	"k\376Eq\361M\350\017<\004\277\302E\213\207\240\305\033\251\3179\016\374\003\337\276y^Y\274\003\037"
+	.ascii	"\265\312p\314\277\260\224\241A\240\335Y\361\322\205\3057^\337"
+	.ascii	"\237\223\025\337\205*^\304\257xo\340\031x\025_\224\243\341]\340"
+	.ascii	")\020\332\035\030\227\026\032\370\b\234>\3053\360\255\3403\352"
+	.ascii	"$\373\323J\361m\350#\210\342\333p\201?\361(\336\251I\277\300"
+	.ascii	"\023\251\3175N?L\253s\203v\226\024x\302\304#=\037\375\t\026\200"
+	.ascii	"\034\221\311}\226%\025H\257\256\213Y\031\322\023\341\244\323"
+	.ascii	"\245\335\021\236\t ^\342\223\317\n\274\211\367\001v\005\b\211"
+	.ascii	"3\277\302\222\nDW\327\302\230\225\344\267\205P\256\017{\261e"
+	.ascii	"\235\232\245\235]\261\211\n|Q_\227]\211w4\022?\342"
+	.ascii	"K|\027"
+	.string	">\225:\263\217\376\027\211%\336{\361\324(\247\316\354\247\274\224\021o@\037[Z\013\305\301\251\353\371\261\004>H\336s\361\224\250\205\206\020\312\223\004\276\250\217\215\rL\021\212\330\313\203\300w\226\371\307o-\365\216\370\263^k\271\267|\263\264Z\213Ml\350\034\021\217\300\027\251O6m\0338j\325\346\230:\253\235\037\343\242\035\2271\304{\020\243\306\260(\342\257>\264\353,\036\360C\336\372\246<\207\307r\235}n\325\001\377A\332u\006GM\304\367\3411\304\367!\362\t\370\020\357o\300#\337(\370\\\003\347\241<\005b\242q\303\344\255\fx\027R68[\332\336\3675\232\351\002>\b?\325?\227\270\315xy\303\022p\tXlb\001\357\323\327UD\205\352\013\307\213\200\367\327\206\013\360\003<wv\031\270\024\364\206\022\360\331oz\200T\347\231Kl\013\351Q\t\377=\034\340\211xP\256C\001\336\231\001<"
+	.string	"/\3002\353\205<m\2410\302l"
+	.string	"\337pX\236\366\240Q\007\007\353"
+	.string	"\360H}~\205N\357M,\250U\373Tw\364Y\327\206\275\306p\377\"/\302\033ynz\247\177"
+	.ascii	"\254\352\231\354X.\350\343\310\261xy\3508\270\314\016ad\314\242"
+	.ascii	"k\304\3009F\236(\007\345\032\341\213|?\257M@\277\272N*\267\252"
+	.ascii	"\252\330\304\021\376G\332\325d\3427\270WD72fq\3404\375\007)\233"
+	.ascii	"\rQ\252\"\274c\021y\243\027\341\033\357\231\346\304b\027\005"
+	.ascii	"\357\343iO\030\031+|\256W\217\0346W+\221G\222\242\320Mf\203\223"
+	.ascii	"\252_u7y\2429\264\221M+\1776\262\351\207\255\032\275;A\374\207"
+	.ascii	"7zo\342ox\n\344\346f\017\304\277\220\262e\331\325r=\236\356\320"
+	.ascii	"Q\343D\327\332\270^\035\334\362\300\242kl<\257\255N\305&~\370"
+	.ascii	"\021}l>\325<b\352\316r\250{\261\201/\227nl\013\335u\332\267t"
+	.ascii	"\0136\303\b\364\360-\247\350\033\220\350=|W\031\306\001\322\261"
+	.ascii	"\353\304\357\226@\254\260s\275\212\326\034\365u=\261UU\270\177"
+	.ascii	"\321Gq\245xC\031Ie\365:'\037>h[\2313p4\256W\022\337\373\276\016"
+	.ascii	"\324\340T\367\213\333\254\211\354Rq\303\302\212M,\372\206r5\375"
+	.ascii	"0KRF\224LD\037LM<\244\216(\241\240\222\b\031z\202ZB\344\270B"
+	.ascii	"j\210\322\b\bE\026P \030\207 \3111\004\311\r\251#MOH\244\224"
+	.ascii	"Q=PORB\226jH\371`jBrT\"Y\362\243\204%#\312\036\024(\243\222t"
+	.ascii	"\220\212zz\232`\2062*\311NTS\tK\255\222\204&)!1\202v\200\230"
+	.ascii	"\224PJ)#M5\226\244\214(gH)\211@-\375PJ-A\201\2201c\207I)\325"
+	.ascii	"\344\324\224C*\t\022\251$;\224(\217\004)\245\226z@=AA\321p\202"
+	.ascii	"RJ5\3758A)\177\360P\242<rd&\024\f\fA\021D\351\300\t\240\037L"
+	.ascii	"\316BN05!I\222\022\201H\223\221!IG\232\226\234\222\204@E%\235"
+	.ascii	"0\342'$J\250$\251\247'\250\244\236\266f\367\373V\330\b\206=k"
+	.ascii	"\276\223\271\255}\215lf\013_f\323\371\246\232w\327\035\246\333"
+	.ascii	"\0051\207mD?\306;~BC\376\375\210&\232\350\257\220\232\350e\370"
+	.ascii	"E\305d\273\257\035\372\261c\034\265\253\252\251\217\321s\013"
+	.ascii	"d\343-\030\362\335w\324"
+	.string	"D?\344\373\031u^\001\271T_g\223\351\357\241!\262\331Y42)\266\216`\240\234\006\354\366+|\261W%^K\345\032\375\202\203\316i\266^x\327vJ+E\371HX!\3316\n^\034.(-\025:\247\016\223\223\245\336\007\276-'B\236\351\377\315\223M\233\305\323\035=\2746m\2236\005!OB\312&'\b\326\025\224\024\037$o\211\211U\224\345\22774\204_\242\241}\342ui\251\332\251\020\360@h\233K= \262\366m\231K)^\313\257/\020\336ox\262i\376\331}`\270\244\362CF\370\205\313\260*\313\261\261\242\213\377\340\035\357\311\346H\rF<\273\224.\313J\374\321y\360\330\301:\035\274\217\367\340\177\366\274X\237Q\016\336\277\203\357\r^\203\347@p\203\337\351\312\340/x\r\376\005\237Q \217\301g\360Fp\317\264,\037\310\323&\n\273\303a\216\034 \337r\322\025\357\3421\370"
+	.string	"\366\274"
+	.ascii	">\317~|\217\277\340\211\202\3174-\017xw\375\273\341\007\034\236"
+	.ascii	">\335\335\325\257\317\307\377x\251\366@\362\370\036o\345\261"
+	.ascii	"\245\372J\311\312\306\252\204E\275\032K\214\2349\354\325\202"
+	.ascii	"\357\254\320\216\337\3737n\274\231Z\324\361;l\350\310\032\245"
+	.ascii	"T\200\364m\362r|\005J9\0369\365\314\270\237\032\257\364\306\302"
+	.ascii	"gZ\237\301\342\211\341\370\243\267[\352\261 [C\301\343x\343\233"
+	.ascii	"*C\".c\313\222\202\357C\260\2513b>}`\276\004\375\030\320"
+	.string	"\217\361\317\215'\001\315\215\236\263\326\221\200\005h\364\207H\221H\320\306w\326\350m\374\313=\323\234V\273\252\232\032\357W\332\261t{\206\306\327\370\023\202O:<X1\032\357e3h|\001\205\3173\347\264\311\330\260\005L\202\303C:2~\306'\251\317\264b\235X\273Y\027\275\300\232Y\232\230'\366Z\2512\336\311&x\031\2031\376\305O\360F\270\347\231\323JW}\337\245L\376\342a<\373\225\245\227\345\027oh\214GR]\371\251\017\003\370\256\224q\231.\310\236\314\313-\301\204Y\272\271\025\233\b\343\277\020\312\205\245\233\314\032\246\352+|\231\363\261&\3442G\257\362\342=\354\341\332\243\356\325\310&\225\fqc\226o\314\323#\230Y\002\321\353\002\037\003O\337\002\203~\250B19KB\246\020\321\210\210$I\222\306B\013\020\b\002Q\234\305X\017\022 T=\320\203\206LDDN\322\030Q\331\325zZ"
+	.string	"`t\016la\236\022\223\245\n\242\b+\201\237hy\270\263\344T\nH\213\254\0340=\331\322\025!B\324\246\\7(BD\277n2dQ\005\353\267\277\230^wN\202\2718\360\202\020P"
+	.string	"\260\374\247\033\301\323\0168+\022X\025\305\367\334\200\367\202&\023\2406\257A\262\200o\303\323\005D`%\244\343\371\356\234\322Xq.\321\307\317\335_\222\234{\f-.\356\261\t\f\\(^B\347S\246_\273\223\354HA\302W4D\023\247\013\013J[\306#\350p\303\t\002*\3471\211+\206\275U1\222\310\261\262\330\371\004l\201U.\300\377\330\333\344\271\243N\307\nZc\336*:\r\266\360\223\2069.\024\020\300\352\342\b\033\212\266\0220\346\022\003\013\265v\375\021=&\366\304\305\260\274\354{\354\254[\353\031?\350O\271\362\375\247\307\022EO\255\301\265\256\004\267\360\322\032\2354\031*`\032Z\200\031\364\001\245j\025\244K\233\246RS}\366P\027q\221}\210\230m\251/Q\324\026\257\310\242\241\237Z*#\205#+\004\371\220j\220\276\r\312\243Kh\336}\301\256\246 \237,\302\356\373\003\266\247"
+	.string	"\351\373\217\316\277Y\001\336'\346\200]\317\267z]\374L\277\274q\306\367\"\214\024\"\252m\302\343\t\337\304\n\344]#\372\342\374f\261\274\177\372\036\354\370@\0367"
+	.ascii	"\262\246\001\257\354\032a\002{\351T\273\262\271\251\201WU\314"
+	.ascii	"v\247mH\016@0t\377q\016=P\177\327\232\226X\026\030`\373,#Zf\242"
+	.ascii	"\307#\367\\a\373\355\344\347\265\013?\260N\r9\361\376\221"
+	.string	"\242A\320\235n`\217\021\215\204\025Zdzc\370*\3409\251+\264\001\204\203j/M<\277\001\217P\262\211\335\363\317\265\032\f\001\026\n\n%\315\345\347i|f\260K\332\270a\333\261\212$?\002b\264\345\254ra\316\227]'\007\212!:\221\364\360\302\265\\%i\321\024\241\375\202\377\030\264\001\217D\026\031\362\023\004W\371\275\\\271\277\332\304Gx\202c\315\005I3P\037\fP\024"
+	.ascii	"\005\002j\\\311\006\036C\277\220M\033W\353\311`\207\234\022\276"
+	.ascii	"Q\202'\274\221\247\327\333\220\f\f\231\340\263i\353{la\001\004"
+	.ascii	"\306\364\216:\004\031\333\230j\232*\026\332\333`\214\232N\301"
+	.ascii	"\204\003Cd\0052\353r\302p\340K\236_\314\221\251\262p\323\254"
+	.ascii	"o\004\345\022\242O\213V\334\225\345\312\251\026\351\244\316l"
+	.ascii	"d\r\017^\205\231}\"\332\300\331\2412\334fE0\276Y\027\216c\030"
+	.ascii	"\254}\203\211\0358\027\237\344\300B\fbB7\033liY\273zTA\235\007"
+	.ascii	"\312\006)\342\304\362\3071\003\357D\344d\317l'\007\261\030\233"
+	.ascii	"\206\317\357[\232\354X\223\345:_@-\301\236\002h\026I>F*!\375"
+	.ascii	"WrDD\036\330Q\330\243\3170\035\321\027\f\312._W\226\345(\271"
+	.ascii	"e\213\343\263\213[X"
+	.string	"\251\347\217\315\275ETVJ$\036\006\217\227=\030\2031\037jYk\300\246\037\016\035\t\236\006\205Yj\375\177\221wr\312\001\307\\\366\210\325n\233\257+\343\034\214\006\272\235\341`\267.H\257n\307\206\025\335\331\273\200g\355S\245\324\353D\352^\n\030-\250\001|^+\032R\250\022\254^\324\326\353\227m\364\366\270\244\253\334\226\252\\\375X \221b\340\243\017V\330+5\030%cS X\260S\3551\337\251\360\320\301\331\321\020\210\213|\377\262C\363\3135/\263\271\177\274\2510\022\372W\271\223u_\332\246*\013M>N@F\213x, \217\376\231\264\321\fta^\215\367\275\265\033\0220\232\210QN\r\223\245\275e2\347\357<:}f\363\261P\333>\256bF\345\353 \360\340\332#\254\337{9\331\255Y\275\036\020\262\214:\337\377\032'\242\307\211M\007\351.Z\212\251Qr(<\204\216\200\030*\220"
+	.string	"E\370\254\004q\320e@7\257-4\223G\227p\264\237\340v4da\376\b\217\220o\203\353\304=\027\201.N\b\242R\306\375\025%\tS\037\355\311\325\324\202x)&\354\205\253T5\224A\t\037\315\217\270H\b\262\232\321\263f\376\003\316\215\036\246\372,\363>\fGf'4F\213\333m\366\371\355\302\243\0316\206K\020\256\177\034[(\321&\177\354\255\323\rFlX\2220UV\203-d2\016\212e\315\257bJ+\221\315\250\375X\354<\200(j\230t\217\313\005}\317\024\231\350\256Y\264\3011\326\021\321\257t\202r%\351!o\327\377^\3244H\256\216_\355V\321X;\214{\303y\b\277!\\>*RH\224m\023\2320\356\347#\265\\i\243 p\002"
+	.string	""
+	.string	"-\371\352\211\333\037('\345\302\203X\r\246\200\007\221\021\233\214&\315)}\37795k2\337\312\316\021\177$\307\346\344\203\235\314S\260\0224j\212\327\257\330\361\271m\201\205\365\217KC\\d\363\211\314Q\372\205 \212\311\3100F$\370\0165\256\031\322\3047*\200\267\322\254 \376'z\357G(\257\243\205\340\353\207\226\264&\250\310=\267\377\bW\345\235-\030\203\260\317\320\240"
+	.string	"\327&\205\017\224\215\006\305\267\003\2660\203\377\\~\030T\325\250\177\037\210\366\202\026\240\264qZ\b\b\373\367\375\271x\b\216\025\320\300+\353\345\331\274\371\313$%\223p\301B\327\213\367\306\022\225\032\275(\263v0\372\304>\242*\355@\310\343gQ<S\212B\371 \021\237-\254\300d\217\bT\365a\265\246Qonm\253#_\023;\252\244ca\3329\201R\t>.+V\375\020\375\004\f\305\255\232\222\316\207D\234\217h!\213\034\017=\2002\267#Y\223.]\006\221\2464\263\207\022\333@\25569\362\2146\277U\263\374]\345\375^K\302w\037\346\001\t]\006O\232m~Q\310\253Y\005P1'\251~0\351\373\023\307|\032)\214;\201T\346X~\254\376\350"
+	.ascii	"\032BI\r\\J\353\302JX\250\271N\f\311qul\351\225\004\332"
+	.text
+	.section	.gnu.lto_pidMulticopterRelaxGyro.162.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\024(\035\241"
+	.ascii	"*\371\3306I \020\323\031\016\347\243\016%\301\224'Tz\231\241"
+	.ascii	"\312\304\221\343\367\342N\302\207\003\365\031@\337\365\2771\243"
+	.ascii	":j\261\255\301\260\366\342}\272\215\275R}\327\215?\26109_f0\254"
+	.ascii	"\303$!\252\277U\335\237\217nB\266\224I\006s\003\355\002m\003"
+	.ascii	"\253\031(oqr\346#\013\2512C\2678Y\321\334\262\307\006\210fd0"
+	.ascii	"$fn\024\b\"\217\230\301\244\216\007\311\026\340\230\272\351\272"
+	.ascii	"b9}\350c\016\311Z\330\3122\026\316B\227\345k\343\216XJ+V\027"
+	.ascii	"\024\344D\367\260\\Y\251\0223lm\232\3026\246o*f\224Z\346b/\256"
+	.ascii	"\342c\255\n\025;+o^]c\366X\212\361C\037R\344.sI\361\2241}\200"
+	.ascii	"F\336ZFa\215\366\004\206\262\234\305RX\253\250&n\ne\343'\020"
+	.ascii	"\255g\211&G\251\363\243\020y\346(uV\252\346}\255\354\3741\bI"
+	.ascii	"\304\354<\341\200\246D\270\255^Ly_\027\334\037\372\340\t_\310"
+	.ascii	"+_1\223\233\214\265F4\3249CG\r\333\0349N\332\226\313\345rM\f"
+	.ascii	"e\356<\271\237\375\364\202~\303\t\035\360\206\272\313.\f\312"
+	.ascii	"\026\250\305\243/\220\017\025\207\255KU\316\n}u\256'\240\255"
+	.ascii	"\245\231\352)t\327\004\2045\t\205\033\310\230\231\376\361\240"
+	.ascii	"\363\267+X<!\221g\0067\210G\233AO`@6\315\334\002\341\031\341"
+	.ascii	"\f\262\210\037\b\317\b$\232\313\003\232R\327/\267\325K\200\346"
+	.ascii	"\031@\036b\220D|\277\375\237\333\360\344\200\246:\312\312\024"
+	.ascii	"[\361f\346\346\346\347f<\023q\356|\373\276\345\235\353\355\367"
+	.ascii	"v\311\344n\373\272\357y\336kh`\257\017\037\252.\267CH#\277\017"
+	.ascii	"\037*\035+\323\313\304\333\036\274\273)\336]\213&\235\345\365"
+	.ascii	"\354\340\203,\362\355\3644\021\261^\005B\276\305\340\004\267"
+	.ascii	"{\272b\2274{;\360 \317\247c\242c\205\242\346\251\313\031@6\300"
+	.ascii	"\017yTA~\356w\366y\254\344ar<\033\367(\200ky\246ow\230\354\345"
+	.ascii	"xD\221\333\025,\230\334N\223\343\225\333:\245\230\207\306\215"
+	.ascii	"\rp]\335P\250\031\343\236\354\327"
+	.string	"\274\315e\270\233\303\271\364sN\3474\360 DC\2353eL:j\330z\2440G\216\2236\264/-\3228d\322|]\001\316\233\225\222\201\203F\202\232\233\031V\272\347\017\031=\323\2516\031\340\234\250+\334\321\326\242\240\031\231\241\r\033'_\275V\276\363\262&e\032\304\370a\017;k\236<\206\225\252+\334j\324,s\207\255\214\r\343\207\373\267\023\214>\004r\005\271{\030N\270\232\225\036\261\334\3263b\336\027\034\033\212\017\367\205\361\3036\332\335\321\205<\357\236\355h\226o[\351\022\255\353\23599\353\272:\255\t\343\207\307\177 ~\250\236\211\370\341.w\001\211\200\262^5\2606\230\265\006p]\327\247\376\262}\325\355\333\201\227g\352\260\244\224\204\304\341\310\250\210\310X$\016\325\346\345\276H#\315U:0\3027\275\031\272\256\316\244*\231\251\0138\271\303\n^`\276T\2441\346\305\345JgF\237\2442"
+	.ascii	"\005P\205#CY|\256\306U\306H\\\300@\231\003\036Wt\013\037\025"
+	.ascii	"i\250}\304\230\227\n7R\217x\\`*p\221\226\023\251H(]\225\343q"
+	.ascii	"iQ?\334u\371\223\205\215#\306\274\276^\314b\254\217P\343\372"
+	.ascii	"b\342\373>\354\202F\016[\340\230\027\230\017\215V\256\"uAQ\217"
+	.ascii	"\353\272\032uaq\253\037\246\260\360D\352j\252\310\351\034B\337"
+	.ascii	";"
+	.string	"kua1\027i\254\353\272\374\354\362\372z\370\356M\330}\005\273%b\004\275\256\353\025\261\311\226\325\246\177\357O\303F0\205F\361\245\326\332E\021#\214\331w\225\314\330\t?2\035\372zK\335\241?\230E\310\344\302a\223\355\366M\347\020R\241\210J)\230l\371\205\377Tj\242\025$\224\256J'u\023\276\365a\261\241=~\031%\"uR?\353\013\016\307YF\315\226a\226a\210\037\"5\003B\303\244\341\255\355FL\307=\005\231`c\337\220\207\243\345\230%\031\376\223C\253\353W_\255Q\027\365Q\337\251\326\\\263fD\324E}'\340\233\031\242nRs\306\330\005\234\360\003\303+v\232%\032\376{\n:\362JI\020{\257W\303\006\377Y\354\243\263\257v\330j\023\373\316<\313f\370\205\225\356\317\026\307\306\341?7\016\361\303a\017\020\375br\341v\257\364\313X\353\312$\241\366\020\216\023\255\311\205;"
+	.string	"\357\365&\340\301\177v\177-\254\331W\373\275\027\261\t\f\013\024\264\326\360\273\340,4\r\034\264R\021\337\347x?2\337\204x;\356\323\375\310d\301\345\300\025\250\266\262\340\256[\363_\233l\367_\333\313\356y\225\200\340\235:o\222\016\274#"
+	.string	"\300+\002o}\245\316\033\002\222\363\036)\362&\317\033U\3445R\344-r^\250\"/\b\"x?8\257\007\347\355\340\274\034\234w\203\363jp\336\f\316\213\301y\211\234\367\202\363Zp\336!\347\025r\301o\220\363VP\344\005\022\202\367G\221\327G\b^\n\316\333\243\310\313#\004\357\216\016\274\023\234W\307y%8o\0166\373\3428\357\r.\373\3328o\004\034\375\326"
+	.string	"\301K\343\2743\316+#\2117\306\017}a\234\027\202\"\357\213\363>P\344u\340\003\257\213\017~[\234\227\305y\0338/\003+N\370Uq\336\005\316\373\224\302\003\257\023\023o\023\n\017\274H&^\0058\355{\342\274&\316[\342\274\t\024y\021 \321\201\367\200\027~G\234\367x^\003\222x\013\340\365K\300\022\357"
+	.string	"|\365\025\340\274\001\234\027"
+	.ascii	"n~E\2347\304yA(\361~ \342\365p\276/\323\365\276\035\212\274K"
+	.ascii	"I\274JH\274IH\274H\347\345p\336\243\363\032\235\267\350\274D"
+	.ascii	"\3475\236\267x^\342y\207\347U\317\333o\373\371Vx\312\226\347"
+	.ascii	"\320\332`\353\271\255S\n\017\255{\206t\304\360\326\257\367\363"
+	.ascii	"\235\243\347\262\263\3319\355\027\374\017\375\203?\341_x^\317"
+	.ascii	"W\347\346\223v\277\234\246\206&f\245\313\205\207\344\264\307"
+	.ascii	"-\243\365\310C{\302b\362X\270\303\006\370\306\250\205\315\226"
+	.ascii	"\3178\314\032\355r\311_\226\3138\312`\226K\256)N\212\272@\345"
+	.ascii	"H\251\300\\x\214\275\360\n\335E\327\002\224\215\311\314\220F"
+	.ascii	"f\262\027oK\037\\\220\034\230\273H=\206\2153V\"o\313\336\322"
+	.ascii	"\007\025\261\260\225\276\bM\264\004\007\bl\t\351\252\260qh\262"
+	.ascii	"\034vW\214T\364\007g\035\264hEk\305\350\267\255\3514PDbthmhb"
+	.ascii	"t\002\321,\027\274\2130& ,0\372\207\370\201\206\240[\300x\321"
+	.ascii	"\020\274\350b\234S\220\003\375@\253}\234S\027\355@\007\020\227"
+	.ascii	"E\330\246_P\312\360\020it^\314\224q\321\257\343\003D\245E\177"
+	.ascii	"\220E\223\350\026\315\r4\003\315\242\211p\334\264\013+MJ\243"
+	.ascii	"\013#\323B\003\035CI\257h\006Z\375sB\233e\200\272V\364\t\217"
+	.ascii	"\376T\364\t\027\350\024\255\2429\356\251\027\350a\2343O\223\013"
+	.ascii	"\325\344\370\244\241=\rJ\201\242\235z\233:\005\013D\232\312\340"
+	.ascii	"t\030e\\\322\235\\\23133\247\036\256\211J\225sMu(\210\360\211"
+	.ascii	"F\366*\320(ZH\330\027\"&\352\364\n\312\270\2449r-\220yA\266:"
+	.ascii	"\370\274\322b=\246\224\303\243\234\233#~\250@{\340\373\232;\321"
+	.ascii	"\234f\242K\364\211\376`s\221;kho1\241\254k"
+	.string	"\260\225\026\003\311\235\265\226\316R\242\r\340kS\373\022\234\0379\243&K\240\213\330\365\225\225\016\273\354\034\262R%\201\366\300\327\326\206\206hel-B\240/\270;\244\275\224wM\333\\\335\245\314S\366Q\352\351\021?\374S\020\211F\240\211qN=\352\036?kx\3146rQ\210\232l\211sW\212#\372\003\033<\204D\022\255\005\342\313&\361\200>\362\306\207\305\206zk\331\344[f\035\320 \242_h~\326H\364\013\215#\372\205\307&\240G4\267\001}\354\342\2373\217\237~\2564\351\312\016\037)\035\305\200\206\021m\3633\306m]\327\"\235\027\320E\266\241\264\023j\177\266J\033\224~J?\342\207\005\364\021\337\227\nx\253\0370\002\232W\tX\200\036\240\367\202\312A\312?\376\223\200\026lf\007N\205\372J\031\370\245\273\270C\275\026\016\320\303\272\347\225B\001\232\257\002h"
+	.string	"Z"
+	.string	"\245 \017\256\364Kb\207\004\003\350\257\t\\\251QZ\034 `!"
+	.ascii	"\332\211\257oPI3s\353\031\345\214\365C\235rn\201\323\032\314"
+	.ascii	"\235\244\245z\252W\204V\322\017\204e\365\325\362\026\377\ti\342"
+	.ascii	"\255U\026\362\r\313+\016bo\316\240l\303A\202\246z\b\347ye\204"
+	.ascii	"N\322wN\231~<]6\241,\263\262\210\037\216\320H\321/\246\024\266"
+	.ascii	"a\2515T\363\346\354\217\037\021\032D\264\255\006,xR\315[!\264"
+	.ascii	"\210\226\352\3279\325\232[\273D\201\371Vj$\366\306\313\336\022"
+	.ascii	"\314(\220\236\251^\b\355\024E\341/\253\201\n\036k\375S\234i\374"
+	.ascii	"\374\221\031\205\235?2\373\002\361D47C4\210\026\321<\205\373"
+	.ascii	"\2544I\r\237\274\020-#\332&\270\313.\276[)\321\234\270?P\266"
+	.ascii	"=K0\016j\354\302\240lz\330\356zS\304\017At\t\2766\306z\021\033"
+	.ascii	"94Crk\340\240\225\314\037\330\302_\350<\346\377\373\322\030\364"
+	.ascii	"\241\037\310C\337\217\251?\364\263\b\341\374\346\354\222\n\323"
+	.ascii	"A\205h1\267\004\363\220\247\211\357\213\252\r\217\005s{h,\313"
+	.ascii	",\374\347\036\241\350\261\334\324\321\336\363z\273\030\260\235"
+	.ascii	"%\330\323\336\272\256\016\320\300q\313-\373\263\017w\311e)&F"
+	.ascii	"\374\320C\377y\205\311\205Kp~f\360\002PVI\222QC!QR@\254\224$"
+	.ascii	"\253\252\232\030\351@U\365\004\211\261\205\325\221d\222\017\210"
+	.ascii	".\252>(\036Y\322\343\310\022\035VJ\244\250\226X%\231\030UQY\031"
+	.ascii	"\201\312a%$Jj\2111\271\344\311\220\022\240\222$\203L\220d\322"
+	.ascii	"\204\203\025\023*\252\bn$\2314!b\"U\002\224\232$A\312\312H\r"
+	.ascii	"%\242\244\250dU\322*\211T\016(\253$\311\033VI$UPC\222VPU!l\334"
+	.ascii	" \212JZIMI\365\260j\262\304\252\311\017'I%JI+\250 UTUU8\246\252"
+	.ascii	"\222VRHSU\311!@\234$\225\0307J\005\003GT\024I:\220\"iH\024\257"
+	.ascii	"\221\024QRK\236\254B@\"\225\344\310\223\022)\250\251'#UL\236"
+	.ascii	"R\210X\252%\311\252'+*\252\252'#7\346\277\266\227\035\356\tD"
+	.ascii	"cvs\367z|?2\005\007\327+f\263\017\236\035\335\237\346o\201M\241"
+	.ascii	"\034\246&[\242\276%$\335}C\024gj-\2473\265\215>(\033\301\363"
+	.ascii	"\251\035\232\314\370gM+Kz$\242WM\322\321A\220"
+	.string	"\364\371\232\316\324H\372Nhs\352G\006om2\257x-$<2/\230V\026\r,\3647(\320\375\376\276\3015pZ\247r\231B\267\254y\nb\252`uSU\213\232\345H;\005F\t\252X\352\376\\\261\242\306=\005\025JRQ\336\201\330\363\232\022\325\311\356>N=*\327J\211\356\352\366\250S\324\024\242\332D\264-\220\221-\255\256\025m\304\256\210\224(T\224Y\370O\250.\342Fu\326\225Q\241\250XPu \250L\345]\222\272\252WJ+X\224Y\262(i\020\232mp\352\231\373\200P\t\206Tv\250\007\225[\270(\305\304\2100\372\203\346:\247\036\032XPI\246\374r\002\320\034\017:\020\260P\007=\244=h\244<3zN(\007\315\335\301\006\255As\360\267A\023}e\320\027\264\006\335\177N(\006M\2443h\021k\234j\321\036\264\3223\211\321\335 (\020\006}8\321\026\r\243\211t"
+	.ascii	"yf\374\234h\026\264\220\276\240\207\177N5\263\366\243\233\002"
+	.ascii	"\262\301\002?+\3559t\323>\276!\215d\006O\310\261\202\026\322"
+	.ascii	"z\025\214\301[\243efd]\304\240`\337b\023HN\3404H_p\tH\347u\037"
+	.ascii	">\374\215#\376h :~\b\026\263\370p\352=v\024\264\217\036\024\364"
+	.ascii	"\021\253\257\340\220rt\217.\016:\325^'\260n\214G7\365\234\362"
+	.ascii	"\316EY\236\035\315\243\213}\262\b\245\330\206\030e\032\377\271"
+	.ascii	"\243_\030\206Ug\354\210\017\315\031\245&Kj\262E\232\240I\260"
+	.ascii	"3\301\345\350\025\232\301\302\023\212\204\204\310\364\247\243"
+	.ascii	"i\034a\033-\001\031"
+	.string	"\345\032\377\251cF\327h\t\272\353\234hM=;<<9\232\277\234\301\\\255\203\243st\212?'\241\242\3001\034\315f7pt\001\203N\264\246\364oj\030\0236\243\260\220\220\215\276\321\3108\247\032Qn\354|v\"X\0303\314\207vc\253^\234\215\346\262\b\332\006`\215\226\321\021tq\215\023\255\2517\007om\216\032a\031M\243\227\277(\317(\321\360\2375\372\b\345K\307\021b\300\336\0278\313+\030e\355\246\337(\323\250Q\276\275\021?\244\321=\370\274\002\346/\323K\203\307+\234\221\303d?2\241\374\320\3061r\027\031\315b3\232\241\f\006\327\206\315\214&\352\030V\372\006\203\214\203|\250B)9KB\246\024\242\021\021I\222$\215\001b\013\020\b\342P\034\306\366\006\022@T=\220CC&\"\"'i\fq\331\325,-\204|r\224\265k\236\352\311\030\005\005\204\225\323\317\267\374\375\231uv"
+	.ascii	"\245\r\326\212\333&\312N\305\0209\325\246\242\0337pt\276.\021"
+	.ascii	"r\273\004\253\264\277x\223vN\251_P\263\200\220\375\240X\022\340"
+	.ascii	"#\262\322\016b+\036X+\212\257\336\200u\005A\034`\363\305\t{\001"
+	.ascii	"\256\206\277\362\022N\241H\304\377\0355\245\252\356<\332^F\210"
+	.ascii	"?R\242\032\262\320\347\270\332\025b0\241\226\213\231\207\316"
+	.ascii	"Xq\234\004\236b\334\031\267>\2329b@\241h\304<\034\216[\034A\247"
+	.ascii	"2\252\324\2732\322[%c\305\231\267\322jO\305\006\f)\341\377\217"
+	.ascii	"7\300\355\016\355{\307\325\306\362^\360iD\311\251\006\263\023"
+	.ascii	")p\214\324\340\220\251rm\274\212\360\035\203;\217cPE\020|\316"
+	.ascii	"|\211v/\023\325&\302\350RF@\270\211=l<\212\016\265\270l\275\326"
+	.ascii	"\335\322\016\321\373l:4\301\304Z\330\255Qt;/R\212\352#\273\250"
+	.ascii	"CZ\005\327s\017\375^7Y\207\210\271=\3322H_\360\224\f\233\005"
+	.ascii	"\252\271^4C\276\276\240\030$\004\322\313 >\214\t\315;\030\254"
+	.ascii	"c\032D\270\214\2302'\030\354\337|\302\001D\004\3418\324\310\357"
+	.ascii	"\322@\225\363\030\271&\036\013_\236^q\375p/\020\221\312\232\365"
+	.ascii	"F\002\016\324\340(\004)\002O\340Y\265\372\363T\307\206\340b\b"
+	.ascii	"% X\b\001\247\306\346\376\212\031Xh\003\265\374\342\360Y\035"
+	.ascii	"\2130I\004\b\306\361\367\267\242\007\0070:k%\361\341\311\201"
+	.ascii	"a\006\343\0226\253\260B!\302=\361-%\276/A5\001]\03705"
+	.string	"\236\344\t\177C\023\304\265\374\350\362\245\327\217\375\230\300X\366\320\241\374x\236\212\265\026\212=\r%\254 A\371\255,D\221]\354n\353\224\251\274V' W"
+	.ascii	"\351\\\364L:\027\362\362\252z\bhZ\035\346\330\372e\370\323$\211"
+	.ascii	"\320\245\013(\350\234\345\252\210\213\215\353\273,z\305\240\025"
+	.ascii	"o$\266\310\320\234 \222\225\337\350\312\005\313F5\3567\270\227"
+	.ascii	"\\15\003\305\301\304\2436C \355\306\245\241\342\021][\203\240"
+	.ascii	"/\312\223U:\354u\267[\311\fxo\ny\257\373\217\215\331"
+	.string	"\224%\327.\276u\341\216\327\314\366N\037\242;\326\321j\230\343\022\355\343`4L7c\002}\276\240\302\035\353\245\352\277\226%\357/G\250UM\2779\3535B:\212\250g\025\022\367\313r\341a pB:\233O\303\237\244pb\237&7\264x\037\002w\214\t\234o\227\340\252y\203Zo(\346\033\207\342\227\fZ\334-\016\346>\305\206\374\355+7\r\024b\240b1#6\226\277\0363\220NDHv\264t\274\002\213Ai\370\374\276\035\223\335\236l\020\337\313\313\222\347()f\021\344\261\325\022\306\253?\307\200\307\223\023\205\230)L\247U\276h\241\fjt\005\220\034\265\002lu|\366\361\316\341\352\025es)E\r\225\0229\207\001\365\272\016\206x\276X\355\373\332\020\233\250\243\243\357!\321\231\244\326\373/\365f\257\234\300\2745\21507$Q\262\322\244\240\361\217\266\223\034\354\312\005\225\250S)a\003\234A"
+	.ascii	"\367\214+\252\350\265\304U"
+	.string	"\025W\001\207\223j\350\226\377u\206;R$\213\216z\242z,\214:<\356?]^\242*\234\276\357J`7p\313\227{v\033\r$@\312lT\227\024\250e\314w*\016tH\317\r\306\273\270\371/o\001\361\242\300\353o\206\234\333\255\331\004 *\245_\037\244O<\305O\243\342\324\335\250\321#\034\262\363\317.Ov@\027\006&x\337#vo\001\243\235\261\212\2220l4\271\223\306\356\316\366\351\3635\037\002jA\306\335\323\310~=\007\036\b{P(85Bvkf\351Aq-s\347\033\274\246\246Sq\026\323\305\260KKQ\322\225\034\362Z\210\020#\217\0332\340!A)A\035\366\233T\250Z\343\231N)\n\235\320\033$\216\206$L Gq\363nD\235\016\273\235\336\347\030\207\326T*\271\303\322\231P\025\241]\311N-\024\007\306\004\307p\225\272\0068\234\341\2439\354\027ILV\021z\352\366\373"
+	.string	"r\242\201V\373\237\315\207\203\310\344\004\316\325B\273M>\277\\|-\313\206h\t\037\356\017\322 \245\332\304\227-s\007\"\320\206\345\003\246_5<\344\314:\274\030\254\261U\310jEK\0315\261\224h\247(\212k\222\314\350o\210\037\222 \215o\233\212\236=\250;o\260\rN@t\t%i\331u\330\223\260\024\332\213\200\250\273M4\326\206`\275\021\247\211\002|\300\307E\227\023m\333\204&n\373\337@-\002p/\004\026\260\002\260%\377~O|\275\257U.\371\020\216\374\330\361"
+	.string	"(DP\242\331=e\243\\\265\263\\\314\227\3079G\026I\334\234\303`'x\327\261\210R\260\304\370\267{}\"f\260\244\360_g\016.<\375\331\235\027~1"
+	.string	"\305\320\300\032#\001>\016\3067cxbb\r\364\005\031R\220\377\225\276\377\021\226\325\245\r\360\021\247\221\240\033p\272\347\222K\343\307\373dsF0\006\363^4@\313\344\326\003\216\330\323\366}\300:L\346\177\303\f\216Q\225\363\0273\201\271"
+	.string	"4(\375\234\026\232\373\377/~\3568\334\301;\243\360b\275f|E\177>I)$X\267\320\326TU[RT\005\027js\001@\223\330O\244\200\035\345r\344\006\245\003\205\022\311\263D\304\355\355\025l&\211\300\256\037H+P\323\315\3546\362r\022;UK6-b;\207(\005WM\230\342\241\377q\374U\301\265\321\254\340p\223\200\311\357\350[\026b\247C#\346\224\260P\323\220\227\226\212\032a\320\r\224q\004hS\233\330(\315\253\272\322\210J6\357\205E\370\316\303\231\341\275\317\240\222f\351/\024y\317T8\\\227,\r\003&\305u#\371\177b\265qw\235\252\251\313\321w_=\300K\361\333"
+	.ascii	"K\031#\370\b;@w\213!b\256\264-\275\222@\033"
+	.text
+	.section	.gnu.lto_pidMulticopterDBoost.163.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\360&\365\230"
+	.string	"z\355\0344J \322\322\031\016\357\327\266\315\336"
+	.string	"\371\235>N \f\001\310\270\244|G\204\361 \ru\313;5\306(\203\b\206D\310\356\006\b\235\363\234\247\276\326"
+	.string	""
+	.string	""
+	.ascii	"\243\002\375~\236\210\210\373i\357\341\177;\277:=\231\232u\023"
+	.ascii	"\262\245L2F\003\304\002@\003\3110(\025X\306\324\360\027\030\313"
+	.ascii	"\260\317ur\247\304_\227[\366\312\201\347\265\204e\300\353\322"
+	.ascii	"f\r\220\335\304)q\027SY\256\302W\344\256XQ\222T\005b\305ZvQ\263"
+	.ascii	"\306"
+	.string	"\256J\fJ@(\275\326\245(\3214\255\250\016F*P\313N\230\213\241\260\024v\352p:\247`\325\020&%J\026\2263(O\22449\343\2545\256-\255h\241\361C\035oJ\273\354\004\212\265\234g\200F\316Zn\262B\353\0023Y\266\342\027\030\253\350&\027\355Z\343&\017\254f\002K\276b\263\243P\351\314Wl\366\231\3429Wf\356\360S\002bf\272\360\275(\244\266\225\353\b\317y\301\375\237\017\236\360\205\274r\222\225\274\344\252\025\212c3f\215\333\032\234\032%l\252\252\252gn\b\323f\311\361\354\243\337\363\037\316\347\200\367\323[r\274\272\326\002\261\232\364\002\351H\261\327\032\002\212Y\237\257\314\325\2053\2652\3218}\354\222\240\260\0325\371!ML\364\257i\315\337\302\210\261$\005^\331\233_\023\016~KlPZ\226\265\365\271)2F)\210\337\347\246H\212\245\372\275\250tu\266\255\\&\226c"
+	.string	"\233\274(\001\361\371\366y\256g\311\367\242\372jU~\3010S\326\326\306\327f\374\021\021\316\241{=\265\315\363\366wVE\362\266}\335\347\034\357v\230\306\352\320\221\332j\373\243d\344\327\241#\245\301\252\344Raf\316\235]\364\316\316\201\345\032\365q6\240\243T\344\313\211\223\004iM\366)\231\271\241\305\333\356\351\212X\312D7p\243t>\035\022\rV&nLX\306"
+	.string	"\256\001~\330\004E\351p\336f\377&\312\033$w\263r\277\002T{\0235\323\006\311~\256\351jna\304@r\037\222$%\333V\255\"\036\231\2665\300umc\201f\224[\262?s\034\236\303wx\232?\017\3675\217k\342\023\307f\314\230r\215\333Z\016\030\340\324(a;s\306\360\354!\255\314\327,ix\330gZ\2323\026\320v\320a\237s\362\244\305\211F\261\345\360\246$]\337~\246vu&D\007\034\320(\371\312\265\262]\230\332\013Q\037\306\017s\370pf\311o\330g\272\276\255B\3130m\326\302\3240~\2707\343\202\320\207<\244(\355\336\006\027\356\266\317\244\252\266\325\214\210\347|[c\361\341F`\374\220\205vq\004*\235w\277v2\352\331\366\271@\353\332\246\215\232u][\254\n\343\207I\037A\3740\375\021\361\303Uw\367\220\230\254\311\006\324\b\255\316"
+	.string	"\256\353\312\324Z\266\237\266}\211X}\021\321\220P\020\220\261H\034\246\315\352\2768\243\314\323\037\252\024.\363t\330J\276(\005\321\225.\300d\242\342\214,\\W>d\345Bi\322\235\223*V8(\206\003\245J]tP~\347$\206t\204\035\226<T\330\210\002\214\313\371\242\025W\035\005\232\023'\023\257\367!\0262j\326\002\301\270\256|h\214\362\264h\213I\232\264\256\253\320V\025w:B\253K\263hk\231*E\341\370\374\316\031k\253\212\2718c]\327\345\346\026\327\327\350\2737\261{\023v\021(\022\205!\336\370\304\334\365\272\256Ib\213-\247K\377\235\277\f\032A\030\232\305C4\326.\013\n\274\224zO\323\300V\360\245\001\320\317\013\321"
+	.string	"\364\007\255\b\225\\8l\261]\275(\034\237\364H\004\301\202\313T.\374&\210&FQ\352\242\203\322F\335\204f\364\252\330\317&]\365B,j\243\276\225s\007\346A\365\362E\005\243\202!~X\324\f\330\305\345\013Q\347\220\326r\315=\007\260\261\357G\304\220*F\035\303o\022u\272:;\271B\035\324C}&\332\322\f\031!\240\016\3523\001\225nj\031\240^*C\303\330\004\254\340\253rWl25\370\257\271\347\004\3573\005\261\367y7p\360\233\305Nbvr\207\2356\261\317|\263\254\306a\366\2717\333\246\355\201\337\334\036\210\037\016{"
+	.string	"2\247\222\013\267{\237_\256ZWe\212\264\207i\230gK.\334"
+	.string	"x\237\267\243\007\277\331}5\257e'\367w\036\204&\320+p\317j\347\247\201\331'\032\350\267J\021_g\357\376$\304\313\341>\335\223\224,\270Bs\002\321V\026\334m[\376k\213\355\376k\207\355\236\367\310\021o\324y\215\200\340-B\202W\005\316\372B\2357\005\"\347\035R\344=\236\367\251\310+\244\310\033\344\274NE^\024F\360\236p^\023\316[\302yI8\357\b\347\025\341\274!\234\027\204\363~p^\017\316\333\301y\201\234\367\307y}\374\317\267\307yy\024yw\234\227\203\"\257\016\021\2749>\370m:\357\006\347\305q^\rndp^\f\316k\243\306\021\357\005<\366\245q\336\031\347\265\340\274\025\360\226/\005\347\235\340\274\022\2347\202\363B\300e_\031\347}\300\210\327\0016\373\3068o\003\347e\340\2740N\370}q\336\005\316\313\344\002"
+	.string	"\336\026!x\227X"
+	.string	"\300\253\024\202W\001\376\372\2568\257\212\363&p^\004\212\274\007\244"
+	.string	"\301k\300\013\277(\316\233t\336\002\210x\t\340\365{\302\210w"
+	.string	"N~M\234W\200\363\006\300\313/\322yK\234\227D\021\357\b ^\021\207~\217\236\367\005\240\310\033\202\210\027\304\020\257\321\020o\321y\211\316;t^\241\363\006\235\027\350\274\306\363\026\317K<\357\360\274\351y\373l?_\253\325\254\275\211\252\021v^\333\252U\370g\2353\\\343\205\263\376\274\037z6;\227\235\267\234\307\316_\377\237\177\360'\374\013\317\3539y^\336h\367\313]\334e\331\013\237\255\320\252*\025\036[&\343-\\\306f\314e\205\234S\260\244D\311\202\362\244\211\312ZdmP\214eY\214\265\024\267\346\362da\323\321$\013\324\230\032\016+k\323\021m\303>\215\266\342fpk\203\240'\200\262U\221\321\\\366@\313"
+	.string	"\264\3011\332\201^\036{\200\307\232\214S\003cp\275\206,\374\321\227\270\263\036\32358\320\3043Tb4\2335\3201\3360\3200\272\201&\0162\317\226a\266\342\314\324h`\240\177\003\224\307V\215\3223\354S\310-\016\f\032\214v\301\345\037\323\233\242\345\247\001\r\234W\226\260')\357\340\351\363\367\242O\270@\273\350\027\315rL\275@\017\345\230o\226\\x6G\307K\027&?\027,\272E\357R\2730\033ai\214M\227!\341\030\331\315\205\331B\326\242\207g\264\310!\355\226\352X"
+	.string	"\341\025\255\324\253@\263\350\037^b#\250p\323aH8Fps3`\001S\352t\260)\245eh/d\235\034\244\235\035\361C\005Z\004\324\tgE\363\227\212N\240W\364\007\373\312\234Y[\351**\220xMe\237\305\2769\263v\366\224\004\272"
+	.ascii	"(\033\330C\274\341\231\023j1\004:H\235\206\262\317\341\226\017"
+	.ascii	"\177\236p!\320\"\240lld\210Q\300\326\240\003\372\202\273@\332"
+	.ascii	"\t2oi\033\206\326BB\221x\220z\364\020?|sO\212>\240\211r\3148"
+	.ascii	"\351\034<jwJ\034\346\256\200Zl\211p\244\024Q\364\b4n\b\211)\032"
+	.ascii	"\213\304\325\027\210\006\364\0203\320*"
+	.string	"\366\323M\365\005>\265\211\001M\202\314y\206G-E\277\320\210\242_\230\324'\032Es\027\320I]\374c\276\351\353\253}\032%}\240\323V\315,\240' c\303\003\246m]\327\242\232\023\320A\266\227]uD\372!\377\220\177\304\017\t\350!\250\323\312\335\212\247\312\211\346\325\006\233\350\001z/\210\fD\n\362\233'Z\260W\247\026\202\213\034\344Bd\341C\330\311\375!\034\034\240\207uM)\205&\232\223\002t"
+	.string	"m\"\311\202\373|\210/?\201\002\364\317\364\331\247\320\0279@>\177\001t\013\250\336\340\221feV\363\352\\\365w1\347\332\002\243\0250\267\221\206\352\250^\025\372HC\340e\325\311\345,\366\013a\211\t\357Q\255\210\276x0\353Z\033\366E\243z\230\246)\245H\033\3513\243J=\274\247\276\200\2456iB\374\260H\027\2219\225Z\214G\335\032\272\361`\246\007U\241I\220\261\331\231r\007\325\234\225B#5T\277\216\211\266\314Z\365\t\347\355S\350\213\2070;\352\227P_\234h\235\024\272\005Y\223\177\314\316\223;\306\372\265\230_\270\371$\345\0253\237\244\324\013\274Cj^\226h\022\215\324\034\205\361\366i\344vgW\242+ c\023\\u\n\313\331'\020\234\\\236\256\2658\352\027\221\233\034\257\2565:\256{^\024\361C\022\235"
+	.string	"\224\215\253\036\204f\356\314\317\334\032\350\267\202\371\003\321\376>\347/\377\337w\206\337\210~\237\210>\337Q\217\350[\021\276\361\301\255J\205\337\034K8\340F\375\022\321f\t\352\224b\273\203\301\334\"\372\212*\003\277\271IL\362X.j\350N\363y\273 p\234\372\305tg]W\031\314F\305\2627\373pU1U\213\026\342\207\"\372M)J\016NTF\216OC\031TC\216FN B0uB\321Hjj\311\r\032$\216HAQ9M\035\215\034\205\bq\032z\"\036\251\234\250~<A\255`<\256\260\004H\013NF\216>p\034\221$!\242B\"%u\201\215#\222$@H\240ZpJ\217,@Q\t\241\001\002\310\350\3518u\2442\002\225\201\023\225\221\243\r\252#\221)' G*\247\251\0225l"
+	.ascii	"=\035\251\240\242\240rP%Y\201*\311\016%\307# \216TN>\246\244"
+	.ascii	"\246\2460\210\232:RA\025EM\035\201\360Pr<b\334\247\027\f\fy\021"
+	.ascii	"\344(\303\205\021\220'^!.\236\240V`\242J\201\b\224\221!LG\240"
+	.ascii	"\234\242\230\204L!ar\201\264R+\034\247\230\250\244\244\246\230"
+	.ascii	"\204\332\224\377\332a[\364\n<S\366r\367y\320-\202\203kR\271\254"
+	.ascii	"s'\207\356/\363{a\026\316)j\261\005\322\033\"\322\2557d\361\243"
+	.ascii	"\306j\361\243\256\321\205F\360\320\224\250\305>\205)\207M(\203"
+	.ascii	"\346\252\003\215\245A\255\236A7\210\364\241K?j\"}f\3272\312\227"
+	.ascii	"v\267.\225\234\344\265\220p\360\177.\3705f\026\330\347\317\257"
+	.ascii	"\217\357\327\373\263\320\f\256\201\321!\235V\211\306@\345Ls\217"
+	.ascii	"2\235R\027M\245\244Q\206\004>u\372\244.\017\327V*\327\334\323"
+	.ascii	"\347\250\205\314#q\007\206\257\247>v\327a\306I\263\366\tdW7'"
+	.ascii	"\305J\233O\255\202\214\255O\310\225\025\226\033-DN\220\224IZ"
+	.ascii	"%\206,\3437\235:\210\231TY\027&M\246\253S\035\n\204\310<\243"
+	.ascii	"?=\210\324B\206,+;\322(4\353a\306\201s\202\037$\227\2421\300"
+	.ascii	"\016Dz\371\202\004\003\206\330\243Oh\256c\306\211;\262\b5\244"
+	.ascii	"\230\252N\356\212=8\023\372\357\007\277\022\032H\233\320Exb\362"
+	.ascii	"\230]$4w\t\375\021Z\204&\241o\204\006r\206\320\036\264\b\335"
+	.ascii	"\177 \364\007\035B"
+	.string	"#\235a\242\215i\276}\376\350\213\356\207== \364\323\2205u\217\376\240\005\300\023\303\307<\353\240\177\264\007=\374c\242\221i<tQ=h\007y\373l8\272\250\235:@\272H\314\217$\037\215\324?\032\317\207q\017mg\354Q\271\340\037\360R\356M\351\321\377\363$\016\232G7\365\330\321<vtQ\216\271GGs\320i\035f4G\353h\001\344\254\b\313\364\034\244\333K|\241\013\223\023'G\277\016\312\266\367\244\251?\270A\247\350\246.\034\255Ao\320\3044\314.3M\267O\243/t^p\336\340h\n\240lG\372Fk\320\351\037\263k9\266\267u\243O8\224\001\006\375\2423h\376c\242\231\225m\031\313\022v\006\373\255\240\221s\026\030=\3016j`\340\203\215\264\032%0{\031i\364\0058 s\3407kt\222\325\232\020\214vh8\325\n\250/\216\216\232\347\005\375?0w4\232\307\236t"
+	.ascii	"[0\243+\240\241\303>\323l\017"
+	.string	"3\032\250\337\366\371\334\036,\370r\2676\223\235\271<e\343\245\224\321\025\264\004rL>E[`]\036\024\350\245\364\003\363rb\235\027\237}8\007\266\312@A\363\226\t\232\002\tz\202\036\340/\202\206\240%h\244?5\331h\366\371\021\311\270\031\316\334\020A?\216lJ\203c\25029=\nB\245\020\242\031\021\221$I\322\001\222\013\020\210\002I\034\266\322\003\022\300cA\220\223\b\225\210\310\254t4\242\236e\022\t\245\024\220O\260\323'\241\224^\r\350 \254t\367Q\227\027\317\365s\362\310\266\375\006\330z@\313\314G\244?\244\3564\255\364\025\212b\356\316\345r)l\360\362qR-\362\211\2216Td\364 \376\235\231D,\0329\307/\346W\347\272\\5_\221\217S\255\2062\364\003wZW!=G\035\021\273\230j\027\3407\305\327\267\303\370\342n\323\261&zX\221\322\200\201\366\302@p\254\314j\235"
+	.ascii	"]\226h\356\t\fM\305(H\202%L8Z\3308\026\307\035\355\326\023e^"
+	.ascii	"\002\030\323\001>\307\023^\242\363\177\312\370\337\225\234\216"
+	.ascii	"^e\364F\257\377e~Z\007\230\236\257mz]\270\034\316\227\377\350"
+	.ascii	"\244f\304\300B}\031R\007Y\243A\227\224V\374\263\013\360\365\b"
+	.ascii	"\013oW\016R\346\020%&\004B\304\002\353\nI\026\266w\211\271\232"
+	.ascii	"z}\321\273|;Y\221\036\361\204f\177a\211Z\205\322U\2742c(\025"
+	.ascii	"\004\201\304\022\202\036\005\022RH\0328=I\033cx#\241V\206\271"
+	.ascii	"\261\214?\310\327X \311>\005`\366\340\343\300\330\005\214I(\370"
+	.ascii	"P\210$B\353)\003\272\214\\\026\267d\336\020\254\244\027\276n"
+	.ascii	"\200\311\356J\335<\004_r\232\307E\005\005_\312\314Y\232mO_\n"
+	.ascii	"\210p\250\250\201\003_\342\314\312\351%\006I<\371\331B\211\250"
+	.ascii	"9\r\375\237\n\204\255\366;\221\361\234\217\371\203\275\313\""
+	.ascii	"m\345\251A\204\270YG\365V\345\031\3433\330\n\t\b\276\f\340\324"
+	.ascii	"3\027-Y\3370\374\nz\bg\214\226A\037 z\312\256\206\300\353\355"
+	.ascii	"d\346\253\267\236\370\025\231\336\\\240o*m\331\377\301\343\212"
+	.ascii	"\330\351\255\bb\237\350\302\232-T\006\272~\320\346\315\2447\263"
+	.ascii	"\230w\236\203k\305\217(9Q\213\025)\250\347\347\036\036\340\251"
+	.ascii	"\320@:%\353\225\001\350?\357\350Q\262\267l\205\3473\342\361\363"
+	.ascii	"\331\334I\206\223\025z\033J\343\350.o<IU}\013B\326\247?\223\254"
+	.ascii	"\220v\312d;-\355Nb\206\r\230ce\255V\236\372\247}\020L\f\323\345"
+	.ascii	"\230\210-\fV\244c\335\b?\347\222\337\031\t~\306\341\377\346E"
+	.ascii	"\337\033\022\f\242\260^X\334\250\345\206t\333\347$9\331p\007"
+	.ascii	"\317%\205g\373P\357@+\200"
+	.string	"\271\305\262\332\256o=ZT\034\203\301\343\204\351\020\016\300\220<\007A%\336\354\316\256,L\300+\275\020\264w \275\310 \266\203?\2261@NDl\363#\351\326\273\016\343 \337w\331\326\265\354\370g\351\231.3-QA\2311K\346\037\313'AG\316rt\366\020-C\201\243\223\331\2308\005\364\013\233\025\005 \273b/G>e\213\351<\271tv\237\347\317\325[\306\246\337\0215\362\337*1\031\354\275\275~[\226\232\022Z\t\034\035\375\004\354\303t\242Nw\267\001\202r\214\327\205f\344\206\360\317\370\225\323H\204D\265}5v\371\033o\024\364F'H\375j\234W\222\3569LT\365\245GJ\205*\262Y#\312k\251\001\352\0251\004Am\256^\rF\307\210\237\255\311w\203\n\252O\017\211g\r\314\352+\222\275\032\0060\223"
+	.ascii	"\206\307\013\255\325\b&;5\324\035,\317\206\210]\313/+\243\b\215"
+	.ascii	"\206\3337d\226u\231\232\276\204Y\252Ne\335\225\242\244\331\272"
+	.ascii	"\206\264\023\250"
+	.string	"\343&=\343\2203\337\f\337\004\377\313[\347:\271\273\260Sb\237\355^\245\373/\345\262po\274'\315*\335\343r=\361g\001x\177\300\230I7,\035j;(\376z[$wD\226\315\224\336c\226e\257\2609#\347\026\017]_n5\212}\3311?\356Z\306\361h\024r\302\214\364X\261\342\364$C$\223{\005\311F_?\274\367\347`\354\032\356\373fv\bdrc\240\351\3476\3021\337\035:\321\340\006\351e\214Q\367\360o&\023\256\356\242\275\026\243].\204C\307\227\261\003\252\023nF~\332\007\363\257!\227\206u\033\3673*\203\263j(\002J\331\2642\364)\"OFj\206\204\214\r\031\210\301)QV\264\375]\335\002PN\023\302\211\334LrB \"\324\256b\231\342\376DfP\264\006\357\274\232\fSJ\305\261y\"C4M@\020\264\\\253\204\031%\241\231`\005\362\030\303\005\007\330\365\033"
+	.string	"j^_\303\3035'\330\264|\372\347/\260\211\322\223\270\205\354~r\252\365\347\207`\201\263\311"
+	.ascii	"\250.\237\234\025`\002\203B.\025\023\304k\367\361\300E\304s\242"
+	.ascii	"9v\212\366\346Pf\361\317?\2149\261,\322\2509\256\310N(\005ri"
+	.ascii	"Xn\341\366\026\304\336\344FXP\374\355\317\212\013o\236\024\250"
+	.ascii	"\023\277|\217\3023\231\306\340\r\237\230\271\232\301r\"1\n\240"
+	.ascii	"\307\233(\310\203\n\357=\020j\357\217IxX\320\330\257u\216\271"
+	.ascii	"7\246\304pc<2h2\340\256\221\301:@A\023\356\001\334!\325(\016"
+	.ascii	"T\361t\377>c\303vU\261\376\033!\330\024\314v\013\227l\261C\352"
+	.ascii	"\017\031\237\371\034p\316\347\n\217\263w\362\250\355OL\021\024"
+	.ascii	"\022\245/\f\006U\256/c\303\024\"\016Hq{\t\345\211\334\233\303"
+	.ascii	"\001\216GFu\257\370\266s\365\021\001\243\361\n*\225D\350\327"
+	.ascii	"\007\222\372\333\273q\256Md\331\035XB%\201\230\r#\247\225:BD"
+	.ascii	"f\301\335w\271\252t\270\3467\253;[\246\261\272\254m\226!V\352"
+	.ascii	"p\310\f\007\2248\375pa\241\367n\306b{l\2419L\214\371\242O^\315"
+	.ascii	"\276cW\231\362K\211\373.\355?\202\004\037\354\035F\317\221\215"
+	.ascii	"\320\326\256\036z\210\346\303\2074`\215A\331p\277L#\026f\301"
+	.ascii	"\317\375\274\b6\253i\272\247\016\035\002"
+	.text
+	.section	.gnu.lto_pidMulticopterDBoostRelaxSetpoint.164.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`(0E\273"
+	.string	"\212\034\315>N\020\030\207\351\f\007\347\243\216\265QLa\020\275X\236\001z"
+	.string	"\321f~\362\220U\311\236\202\005\313\036\323g\265\240\261\t-5\200P\377\261\263Od\306wR`\242i!\007*\253\222\025\336\212\233$B\003\270\262\343\370\266\250Z7![\312$\003\361\003Y\003\363\003UL\246\\\220L\237E\247e2.\343-\334\205\275\324\340\362r\206\325\f\250\322\205K\326\037\262-fZds\322\312\264 \231\262)^X\343\215\314\211\263p\245)\306\300b\313c\214e\2076\231d+\313a\f\345+\311d\022$UB_\317\270'(,\205\251p\025\226\241\267\352\266<\323\030L\314Xd\006\263\240-iC\212\221\003\363\327\323\307\254\032*\016\340E\321K\332\200a\212\327F-X\277<9J\325\230\215+\243\312\374\214R\265\202\031E/\315\217\254\310]=\304\326j"
+	.ascii	"\032\211\230\273\236\376\246G\226\237\231\335t]\255R\\h#\216"
+	.ascii	"\221c`&\313N\370I\335\023\256\235[\262:Z\255\276\264\342\240"
+	.ascii	"zN\232l\364h\351\265\242@\222f\3067\235R|ZN\302Jx\211\215\263"
+	.ascii	"%0\3341iS\262e\246\307G\212\027\332\210\032w9\311\023#1\343\363"
+	.ascii	"+r\326\262\326\016-\021.\262|\305G\030\213\31067}\246\261\363"
+	.ascii	"\006\226\323\001&\033a#\302\240\361\314F\330lT\305\343Z\271I"
+	.ascii	"\374\n#B\037c\020s\223\310\363@)\255\255J\222\360\270\016\270"
+	.ascii	"\017\364\300\013~\220WV\362\222\231l\265Cm\330\240\255aK\223"
+	.ascii	"\213\253RK&\223I2c\274\270\031\362;\373\351\371\374\206\373\271"
+	.ascii	"\337\001\365\326\235\3273\355\017k\006\337_\235(\366Z\221\226"
+	.ascii	"\214\375\371\332\\\211\220\235\205\231\312\371C'\310\n\253\221"
+	.ascii	"\326\r\\\276L\373D0\321f\254\351\333\025\023\f!\201'\366\326"
+	.ascii	"G\004\023mF\231>C\304\030\231bk{\336\270\200f\024\342\357y\343"
+	.ascii	"\002\tf\362y\240\324\225kmU\"\202\211\3467#\2131\210\257g\217"
+	.ascii	"\3476\fy\036\2506\262.\247\254h\023[[\323\263V|\3220\316\367"
+	.ascii	"\366|I7\317\333\353mr\352k{\273\3179\336k\310@\317N\235\250\255"
+	.ascii	"\265@\306\"\337N\235(\031\353RI\211\2669R:S)\035\026\3145\311"
+	.ascii	"\313\t\241\216\221\310\277\223\023DiU\3561\266\215I\361\266\373"
+	.ascii	":\342W\030\277\020\336\030\317\257\233\222\261\026ac\372B\363"
+	.ascii	"K\363\273p\306\022\343\343\334\315\036\016\0238S\177\263s7\342"
+	.ascii	"w\006g\332\346fjO7\303\b\335\256\230`\3524\004YR\256\255H\210"
+	.ascii	"x`\326\322\374\326u\355DYqn\310\236\314\313\334\314\321\034\356"
+	.ascii	"\321\313}\315\333\314\360\323\206\rZ\330r\r[\032\r\006\310\305"
+	.ascii	"U\251\221q\305\020U\303%\314W\031\340\322l\224\013\034\331\013"
+	.ascii	"eh\316lt\016\036.r\246Pjf\336\252\324\365\355dgF\310\234\316"
+	.ascii	"\224q\253\372\252de:U\316\216LI(^H\203\0062C>f\243\352\372\266"
+	.ascii	"\0161\275\270I\363\002\243x\341\276\215\310\320\2057\232\030"
+	.ascii	"w/\206\310\3316\272d\265\266\216\r\361\270\336\322N\\\270\026"
+	.ascii	"\024/\354\241]\020\350\030\317\273O;\230\344\3256\272A\353\352"
+	.ascii	"\306\206\270u]Sl\211\342\205K\3770\274P}\322\360\302M\356\346"
+	.ascii	"Q*\262*%8\033\274\"\343\267\256+S[\331\276\272\366\355\300\311"
+	.ascii	"'u@:2*\342@4$\024T$\016\205jsrOt\021\346\352\r]\203myg\266\224"
+	.ascii	"OR\217\304\324\007\232\334A\006%W\216DtAE\211\224\037}\t\275"
+	.ascii	"\221\032A\021?(D\200\256\352\274,I\030\027I\271\362d\016\322"
+	.ascii	"$\320(L\004\345C\352\2224I\027\024\026\212\341A\252\361Y\267"
+	.ascii	"\344\322$1\250\037\350|\341y\302\305\021T\224p\235x\305V\037"
+	.ascii	"Q\226\204\213\207\347\273\360\013L\\\332\037\025%W.,2\271Z\264"
+	.ascii	"UD]Z\327uh\313\212[\375\200d\006g\321\026S5N\345\374\\\357\214"
+	.ascii	"\265e\305Lt\261\256\353\262sK\311\327\303w/d\367e\273)\370\004"
+	.ascii	"\311'Lz\353\272\266\330\303|\222]\373\261\0137\031%)E\312\360"
+	.ascii	"B\017}g\223%\017\"\275\351\371\"\355u]\225\303\006[VQ\374z\177"
+	.ascii	"\0307@\006\364\211#5\326\356\211\f\274\226|W\271P1\241\207K\207"
+	.ascii	"~\036Rw\350\007^\t.yP\330`\273|S9?\252\216\341\021"
+	.string	"\023\177%\301\370\316\243\03621>\353\226\264Q\267`\033\237\025\003\332\245'\255\f\213\332\250\177\305\305\307w\222V\240I\261\244\330\360\302\242f\277'\026-\034Z\017K\3179\371p\261\017\310\003\221\226\244\031\337\311\241\325\225\253\225;\324BM\324o\2261\245\\\206\202Z\250\337\364\233s\026\324(\344|)\366\002&\364tI\211]\227D\343>'\237\021\274Q\022\303\336\347%\303\274\340;\211\275\324l\345\n[\355a\277\tg\231\006\246\333\350~la\254\032\276s\325\f/\024v\002P\256%\017n\367F\277l\265\256K\022j\013\341\232dL\036\\\005x\237\027\003\004\276\263\373g^\314V\356\365.\344\366\347\365\307\247\206\277K\363\317\364\257\317\0325\274\035\271_\372\007\031\376\216\373u_Z2\340\032\221\375\225\255\f\270\273\306\374\327\006\333\375\327\256\262\273\004\301{\345y\277&\361&\021\340Er\326w\001\347U"
+	.string	"\221\363&\200\310;\344\274B\210\274UD\336\027\316\033\204\310Ku"
+	.string	"\357\324y\245\316\213\200\363\0029o\324y\177\234\027\352\274>\316\353\302y\017p\336\247\363\266p\336\036\007\374\3628\357\221\310\273C\211\327\211\310\313\202\022o\323yW \362\352P\3425@\022o\001\316\253\302yS`\261/\n\347%"
+	.string	"\207}s\234w"
+	.string	"\f\375\236"
+	.string	"\202\327\204\363\3428\342%\341\201\276#\234\367\006\221W\204\363\332 \362\326\b\301K\343\201\337\031\347\r\341\274 \234WF\214\017\316\353\301y;\200\001\202\227\003~\373\2768\257\213\363np^\r\370\3147\203\363bp\336\013\316k\301y+`4\337\026\347\245\240\003/\013N\363\235\340\274\022\2347\202\363\256\270\340\027\202\363>p^&\025\037xSx\340Eq\342\003\257\321\003\257"
+	.string	"\230\355k\342\274%\316\353\300y\033 \362\006\200D\022/"
+	.string	">\370\035q\336\245\3632p\304\273"
+	.ascii	"\257_\005:\360&\300\312\257\210\363\"p\336\003\230\371U:o\210"
+	.ascii	"\363\202@\342\375\020\304\353\341{\337\244\347};\020y\221\216"
+	.ascii	"x\217\214x\215\214x\213\316\313\341\274D\347\035:\257\320y\203"
+	.ascii	"\316[</\361\274\303\363\n\317\253\236\267\257\366\363\305:.-"
+	.ascii	"N\235\263\301\316[[\221\f\006Z\347\b\327d\341\254?\357\337;C"
+	.ascii	"\317ag\261s\2323\232\363\231\363\333\231\355\007\374\003\375"
+	.ascii	"\201\277\340?x^\317\3123\363I\273_Vc5\313Q\216\333\241M&\277"
+	.ascii	"\360\333\262\031>\303h8\r\303\355\220\2273\254.\\\262\266\230"
+	.ascii	"i%9\013t-\315\217\333\226\311p\031\342\026\035\036v\253\241\345"
+	.ascii	"\346\024\0267\246\206r\214\323\363@M)\361\025\026\307lb\326\302"
+	.ascii	"lt\223H\215\314\366\271\3455\032xkC8\f\336\fn\322\374\032K\033"
+	.ascii	"#\253\361\227e4\0063\007&\255\n\2139C\\\313@\007\255\001\001"
+	.ascii	"-\243C\350!\\\363\211\326\200\0335\322R\347\005\350\017\204\316"
+	.ascii	" F\313h\265\257\371d\206\345\331\212\321\027$"
+	.string	"\372\300\203\206\240?h\356k\226\245As\346\315m\314Y\314\017\305\355\216\354o:\202;\200\341A/5[\331\327\001\027\030M\314^\305\027\315A\030$\033\337\t\243\227\256\366\3400j\353)r0hO\233:z\362p\320\357s61{\321\374\366\245%o\340\2425x\261\267Q2\253\306E\007u\336F\313\254\232\r\264H5h6s\206\273\312\306k\331\2425\350\013\346\232~\212\266\250\250\271\320\237\327\262\017\225\350\207v^\034w!\035\225UJ\006\315g0\350\f.h\f:\201>\013\272\202\276\240\225\372\354l\364\037\224u\360,\350\267\201\252-\351l\324h\253\315\2269w\0254\006{j]-\232\321P\320-\374d\360\004\315\242\227\337(\340\267\256KA\20203\035\007\371\347IZ\332\220\301y\303\242\207d\236L\320\234F\202\236"
+	.string	"N\004\275\242%\350a`\223\214I\267\325f\214\206\271\b\372c\336\330lt\210\255\315\032\271\025\255\002\356\017\343sR\346\357\342&\347\3456\346KK\275;\177\372 \350\013>\320*\032\202\3469\246~\240\205sM8L\036\214\322\325Q\003\307\324G\305\211N\321\213\242U\2401\001E\030\232>\203dcD\207\316\213\231\267\024-$\343\006\207|\203\302\356D\0166\321\306^\001\364\211\306\3415\306\204\022r\335\206dc$G\267E\f\233\261\325@g\023\265\016\203\234\243C\276y3\274P"
+	.string	"\355a\217+\216\211f\266\022\355@\233\350\007\246\321\215\2415\240\0042N{\331(q\017\335\330Y\027\007\232\201=51Gz\273C7\324`\r4\013vm\266Q\341\026\r\201\312\2644\320\036\366\324\324\300\f\231PY\205\002\320\007\334-\241\263 \357Plc\351\031\220t\220xH;v\206\027\336\311\207D\007\240\207sM9\352\234;g\322e\031:#A\r\266\3038M\210#\372\203\333\033\301!\211\306\002\361\244r\b\200\346\321\266g\305\200\240Ie^\262\b"
+	.ascii	"\032\004\224\213\354\316\031\211\376`qD\177p\251\025\350\021"
+	.ascii	"\315\315@/5\261\257\tg\257\255l\324HIC\035\031\300\030h\f\240"
+	.ascii	"jw\314\326\326u%\352\371\002\315\3026\225\376\322\201\274\203"
+	.ascii	"\264\001i\303\360\302\005\232h\217\313\005(\322\365N\227T\201"
+	.ascii	"\346U\006\213\350\004z\017\210\334\203\354\303w*\320\200-%\205"
+	.ascii	"\024}\375D\3769\022\235\271@Q\240$\320B;g\223A\021\315J\004\372"
+	.ascii	"\200\026\201\374\353\0306z\244)O\270\020\350\223\351&\033\035"
+	.ascii	"\3222\347\327Lz\311\001\235b\217/P\272.\233\227YN#g\253\377\331"
+	.ascii	"\244[\373\233r\300\334_\225\275\310\376\262+\360\272j\345rV+"
+	.ascii	"\301\201\202\263\026\031\330[\310A\016S\322\214=\323\204I\220"
+	.ascii	"\\\331B8g\223d\177\3557\247\313\316j\255\244\222\231,Rdxa\262"
+	.ascii	"\213\240\\\313\253v&\217\b\331\322\214\0351\202l\020"
+	.string	"P\265\032\234,\2409K\001\255\324\013\350\3335\3138k\223X\335\334\350\320\2244U\212$\237\f\355\2213\265R@\247\200j\375a5\300 e\254\037IS\013;\277\2644\302\315/-\371\376\244J\315\314\020\r\242\225\232\265z\271Q#\266V\366\032\2425\200\252\001n\022\t\013n4Hn\016\3173-0\371\204\003\333\235\3273\r\220\003=\017jx!\210v`O\215\255.\344FG\006\210n\375\353\263\256\371\377\376\234\373\276.\372|\350\357\361\320\327\223\324\037\372W\202oz\3446\271\305\177:B\260\360K>\361\360\007\305\036W\224\232\224\005s{h&I'|\347.\025\311\343\033\240\210\364\234\317\333\315\301}\002MT>\216;\204-*0\212\222\032\022\343\005\210\037QOTMRG\037G'\247&\242\035C\034;\236nP\3758JI\005q\352\020%5\244G\221\005\025\217\243\017\035C\n\244t\020y"
+	.string	"\241\301\003\210\f\252\037OQ@\250\216SCRQTNM\037P\341\330\361\004\244x\0042\244\004!M>\216$\200p\234\n\302\201j**\212\203\016\216SA\202\246\236\2044\251\307\027\236\250\234^\034\005\031\3558J\035\251|<}\320D\345\343\330\001\325\261\207TS\tG\252&\251\0200:\b\332q\244z\202z\242A\025\004\bU\020\021\252\216?\216\216TM$HEIIy"
+	.ascii	"%u\244z*\202\222:\226p\243\352\370\243\270; \210\200\007\004"
+	.ascii	",\034[\2500*a\007\257\223\212\035O@\230\250Z\350\361\344\203"
+	.ascii	"\007\323\217\247&(&'\251)&\025J\033\005\344(\305D\025\025%\305"
+	.ascii	"4\264\266\374\327\256\262D\257?\262e3w\237\367=h\030`\340\252"
+	.ascii	"\\2\355H\357\352\3760?\030\267\301iR\203m\020\037\022\221n>\341"
+	.ascii	"\211'5V\212'5\f\276\247\033\340\367\324\016\rV\304s\206u\025"
+	.ascii	"%R\352U\215Th\036D\372{(\236\324D\372\315's\252\207\213te.\225"
+	.ascii	"\274\016\n\006\006: \333\0314i\304\302\240\177\377\363\276\367"
+	.ascii	"\371\236\353\371\371\002\327\277i\002\342\250u\246xR2N>Ku\216"
+	.ascii	"\335T\275S\345$\340O\310\237Zg\207'\016\034u\316\311\347\317"
+	.ascii	"\0207\310;\020"
+	.string	"ztL!=\244\333NS\216:\267\321 :vs\332\260\021\322%\240j{\252\344\342\212\304\350\252\273\027\324\300]!\265\370\316 \375\002\032;/\352\031\325L\020;\2522\310;#2\252\033\362\b\026RK\353\313\246j\266\241)'\316\224\332\206DR\024\246\262\251b\220[0 \2310\031\216\320S\315vM9?\332P\261\207'\310.\023y\344\244ZM\005\243\246!\240[h\251.\302\373\222\327|\002in\004\364\217\006\322\200\250\016\342\202\352\003\364\217\356>\037\355BC\265\022\231fY\024\325\313F\2374\245\356\206\263.>\372p\320\031=B\273\320\b\340}\321\323${\352\036}\200\026\3665\313\244\250[\352\246\252\231Z\366\244\222m\264\345\352\246Yfh\241\213\276H{,\035\273\207:v\314c&]\241ab`_S\236]\317r\333\023\3677\345\321\007D\332\241\206\251W\240\374\235\033:\365\016\025\234"
+	.string	"\211OXH\241\202Uij\026Vh\352%\253V\276\025\245\320+41\360l\376\354\250\350h\024\252\027\362\216\2020U\212\001ZG\023\355\\\tr\216/\244\001\372\203^Vl\250\020\355\201A;j0\243\006\333\242\002\364\013jW\001\036\227\367g\203\031\234\317\242\036\303\244>\025\372\200J\255B7\\\263\214\231\027G\372F\232B\263\225\363\225\253lP\350\024ZE_\323\217\320\037\n\315b_\""
+	.string	"\n\275@\364ij0\363\332`p\320O\216&@\033\347\232eC\272\023\347\261\017\273\260\\x\2277\227\2439l"
+	.ascii	"\235\343\204\306\321\003h\"\231&\0313O\356\204f\250\017\306\321"
+	.ascii	"&\364\262\025$\024)\306w\236`E]\202\203\001=+0 \0071\bS\267T"
+	.ascii	"%H,Y\220Z\264\f/4\241;\320\331\344\312\037\226\027F\3122\240"
+	.ascii	"\3051\330\003\255\232\342\027\216\346)\252\363\374\344\256s\221"
+	.ascii	"Mj\251\f\320\312B\232\355F\213^c\r<\247\017\250G6j\344\nG\007"
+	.ascii	"!\275\345\351Z\301\272%i\034\032l\2354\357\324\206>\350\017M"
+	.ascii	"\273\247P\214\306\"\241\257\326\306\307E\265\322\0214\245\216"
+	.ascii	"Le\252K\022\272\001\350\223\003\236\002\257<NF\350\007\372\222"
+	.ascii	"\215\276\3213F\020\241o\210\320\304\271&\237\032m\243U;\315)"
+	.ascii	"\215\256\321"
+	.string	"\b\314]\t\236\365 \362\313Ch\251\253\"\030H\243o\267\247\226\007\206\031\375\300\020\232D\317x\202\020\204@\250cr\345\251$fA\346\034\"\221\031I\222\244\003\003\027@p04$\231\n\233\356\023"
+	.ascii	"\220\312\023\342&s\322\230\221i\222\f\333\001\020\200\225\021"
+	.ascii	"R\345\345\232.\251\022\031\335\034\201\213\211]\213\332\301\005"
+	.ascii	"\375\341\034\302\264\363\247\230\360\210\005\025\t+\311> 9\345"
+	.ascii	")\350\b+H[\370Bn\027\264\275\374\205H\340\"\265\240#KM\0322`"
+	.ascii	"\2709\242\347\202\t\302eu\357\213\374~\007\362\332\305a\n\252"
+	.ascii	"\360\247\256@\235\004V\202\371\264\022 \243v\\\375q\031\310\223"
+	.ascii	"b_#\353\237:F`0\263\272\026\037\017\3543\211\232\377\\ M\255"
+	.ascii	"\356\264\031\r\277\360\026\206\\\342\305{\277(\235\243 \232)"
+	.ascii	":\362\317\332go\016\r%\302R\030\223e\322\334\346P\243$\364rd"
+	.ascii	"+\224\037\347kS\0261\262\346\364\355\376\006Kb<\226\031m#\027"
+	.ascii	"\005'\247\317\033\327\2241\006\265\037\036\233\353\246\225*{"
+	.ascii	"/\256\313_$]\243x\224\320\225\017\266\234\217Ay\n\203\361Q\275"
+	.ascii	"\345\f5\307Y6\030\"\250->\024\320\001\\R\341\031b\323\323\273"
+	.ascii	"B\377\202\223\025T\237V\250Z\350\264\356\373\266\272\216\022"
+	.ascii	"#\302\330\"\017\230\353t\257\373v{\020\003"
+	.string	"e\251?l\246\243\213\224WY\306\\\335T~2\343\215\355,lD\233Rd\304\177\3577\201\332\003\241\027\016\232\027d!' \334\033\222u\221\345rH\341'\314\005\f~\320x\200Rx\334\345]r\330\f<\001\037\017<F\2769\226\304C\231\212p\036G\020\233\205F\211X'4'6\211\310v\245\270\306\0261\026f.R\221\345\256\037\361\"R\312\030m\241\032\247\016\220\230a\026\317\272\034\244\333A\243\324\\\2032c\024E\367\340\305\334[\212\216p\bQ\203\311\2210\033,\013\343\211C\201#f\263\207B\036\377`\212\267\b\203m\325\277\226\337\026d\344\253\035\210\244\356kV\370\265tn\242\3504g\374\241X`\350O\370\305\234e\322o\255\007\r~c1\333\246\342T\246\335Fs\032j\361\270U>\263,|\332-\336f;G0\345\272\f{s\337K\245\341jW\032\"Q\346n>\235\303\330\374P"
+	.string	"\216\204i\331\032X\371\346\212\0310\322"
+	.string	"b\273\223\365\232J\206A$B\212ki`*u\376\353R\342\230\212\340D\211\313p!\272\rL\265\362\375\002\303n\323Lr\243\275N\027\200\230!\253\023o\235\246\253\3261\017C(\215\264y\026\324k\300J\300\b\"Y\222Gj\013p\262v\370\226\301\261\310\004\340n\201\262\366y\242\036%G\356\301\267\231s\333\310\310\013I\275y~\202\342d\030\314D\ba"
+	.ascii	"K\026P"
+	.string	"\017Q\\:\231\007\266\233!\366\037\353\020^\032&\353\210u]\352\257z\372\213\367\347\256\226\310\310\347\021\324X\003\006\361-\251\274%3\nj\257\370hS\357\033\316M!h\317\r\254\370\275\027(\0342G{ej33\006\272\226\231\251K\335\017\236\236\227 \003\211\275d\341\021\210\240\373\233\225\252\325\315w\315\361\236\341TW\003\212\034h\232\3658\262\345\255a\210K?8\334\210\022x\335k\353L2I\307\220\\\356\337\360\rrF\f\342c?\252\006\217\356\244}\002f(\353\235L\230\n/*Z\310\036\226\002sQ\206\230\305u\266\204x3\252\337\315\3423\321A\337C\\}r\341\031\f;\365\267o\202\203O^\341\250>\377\n\273'\3107\r.\2108tl\267\006\021\337\331s\030\034T\"y\034\322\027\2617\267OT \367]=W\240M\002\303T\217\270R\002\206K\002\205B\024\021\376S\247\324y\031"
+	.string	"9?\252\332Z \357\237l\270\346ea&\202S\264s\211Ae\342\022\242\235>\221\360\301\023:\252\267\271\306t\3632((\357\306\215E\217\0379@.6\347\365`\356\267\213\340\373\"V\253,\2232\b(6(\213\306[\215\254\310\317\252\266\271\246\331-\277\324#\021<:\f\b\362I\353\"\204\362\206ge\033R\020\344v\247"
+	.ascii	"\371UC\006\346]\365~\357\020>Rt\027\020\352\263`\276x\002\177"
+	.ascii	"\353y\236!\210\252\300l\f\317\r\225\177V\006\356\360lB\037D\247"
+	.ascii	"\324s\373\350wq\330\221r\203Q\205\336;\260\2049\003\304}tnO\265"
+	.ascii	"\201\017^\371L\234\267\220@5Bs\307Z\237C\272\243\201\323\256"
+	.ascii	"^\rf2\214Sd!\223l\316a\262\r\246Y.\253\332{\035\225~\241\031"
+	.ascii	"M+\224"
+	.string	"\023S\243\364\036\343\221\311\200\3063q4\016\367a\302\272\367jwR\214\206\032\240\025\3044\3770\273%\2435\272\242OW\370\210\207}\352;\213\221\022\373\r\036<{\210\031!\272HDFg\342\177\260\232fW\311/\253^\304\251\226{\352\273\356\226\374\rI\376bD\213 \341\347YAN\253R2 R\rX\n6Dj\"\323\\\314\274\271\"p54\256\017\201\256\350~\225a\242Q_x\324%\177N\020\265Z\223p-0\350(S\306\345i[\020\222\322\025\022-B\237\030\022\020.k\016\tH}\305\205\312\303\313C{|\325\313\275\037\3415\201>\316\276\334\341j\021\202\207\r'\203\361\255o\312\323r\207cN9\ne\206\253\002\224\345=>`\341\026\234z9!m\231\344\323\3665j\266\236\261C\204!fF\022\"\f\221Jw\230jr\007\001\002\036`e\351\020\0024\215\3055\302\360A9\\\007"
+	.string	"\027\272=[\351D\340\240Jnw\354\351uWZ`\025\244a\207\305\2729\317\006\346b\320\020\245\231j\314X\372\260K\t'\274\253\026\245\332\264\032w!\007#\033\017K@b?\252\360H\332\230\354!\232\267N\021\304R\200yU5d4\246\276\244\240P\312U\252\326\212\351\031e]J9G"
+	.string	"\005\"\022\215$\001\036\357Jd\215\273@Q\t\207\257\216-\213\302\211\310Q\022\244n\273\272\361`\313\201\256\360J\246\316\017\332\021\203\352\337\370=\240\276\341w\206\324\272(\325\024\232\220\356\257\026\265\352C\240!\360\013\006"
+	.ascii	"E\371)2(\242 \002\271\bE\300+\311\300#\330\021\255\214\346\330"
+	.ascii	"\224&\003\241\234\365K\347\310O\244\032\347\004\006v\202\270"
+	.ascii	"\324\240\2044B\360#(\3700d\260\204\366\217R\022\027\216=pH7\277"
+	.ascii	"\340\023El"
+	.string	"d\306\360\204\037J\346\315\374\235h<\005\372<\260\nR\323\351\367\033!\033\235?\001\217K\232\266\265'\002\367\0312\006\376\240\017\311\266j\232\342\013`\230\001\013m\"\360{\240\252\305\376(d\303\377\252\320\377*& \027\234\220\212\301\\\213\217B\377\303>\367\274t\363\364$<|/\364%\033\177\306D\331'\324Y\250\206.\245Y\256)\237>4\206L\030\020\330&\324@G\325\216\244\022eG\021V\311\213\211\024{(\025\316e\"V\366\303\327\032\221tcA\033\252\314\211`Q%\023\030KCN*\225\244\375LQ\350[\204\373=<\035\215\270\235\240\222I:+\224\345\260$\036\272\030\375\261@S\257\226\253\312\323i6\022\247\025\272\355D\2022\275\260\225q\373U\221\224\275~\022\277Ew\254i\t\355 \037\265Z&\352qcL\\\334\346\345\274\214\226~vY\261.<H9\027\007\252m\241\314\253\037>"
+	.ascii	":\327\243\231\341\002\366\230\245\025\2473\201\"pS\307\333z\037"
+	.ascii	"\226"
+	.ascii	"\027\001"
+	.text
+	.section	.gnu.lto_pidMulticopterDBoostRelaxGyro.165.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`60\r\273"
+	.ascii	"\312\034\311>M\020\030\207\351\f\007\347\243\216\265QLa\020\275"
+	.ascii	"X\236\001.\243)\266>y\250r\031.U\213\300h\207FF\020$BK\262\177"
+	.ascii	"\310\274\271C\333\261\032\204\235?0\324\007\207\343r%f\005g\023"
+	.ascii	"\200\n\340\312\225AS]\224\233\b\331R&\031\360\003U"
+	.string	"\003\365\003X\346:\006;`\026`\265d\312\005\311\024j|ZF\3434\336\302]\330\013\215//k[\255\200)]\270p\005B\333\242v\004\255\016[\232\026$S7\306\017i\310\241=q\226/5F\030\370l\331\n_Y\242U*\231\312r\031\233q\025\2452\t\022\253\2411\350\034\324\023\216\302b<\205c\350\256\273-P6&;;\032\231\311*\200S\236\325\210r\334\300<\006u2\313F\314\001=(|\312\032/H\t\333h\005\353\027(C\261\262R#\353\2502C\241X\245hB\341c\003D32X\21737\032\202\307\"f0\250\307\351\301\005\250\2067]W\254\023\037\326\230sd\030x\311r\023vr\347\344k\353\230\260\220V\254\261#sf|M\230l\024\211\031\266\232@\302\246\3467\225b\204ZN\302^\254\244\306\232\222\027\362\226\300yu\251\361\261\021\343\2075\242\307]N\002\305H\324\374"
+	.ascii	"\215\314\265|d\211\226\b\027Y\316b#\274U|\253\233B\331\370ic"
+	.ascii	"\353\351@\223\265\334\204Px<\263\226\233\215\252z_+;C\370s\024"
+	.ascii	"bv\022\371\236\250%\267\325KI\357\353\202\373A\037<\341\013y"
+	.ascii	"\345%3\271\311XK\364\306\r\2306oltsVmJ\245RY\206\214\0278W\317"
+	.ascii	"\263\237\336\317k8\240\003^Pw\345\205A\331\002\267d\370\005\336"
+	.ascii	"\221\342\2605I\211\225@_\235+"
+	.string	"\021\26451S:\201\354\bIa=:R\003\227/\323?\031m\3766\305\004W\"\364\316\344\376\3100\363\347j\314\261y\346\326'\216\0170\307!~\2378>D4\225\337\023\245\256_n\253\027\002M0\2002\262\034\205\370|\366zN\303\325\367D\265\326\312\224\222\002\356\314\315\215\217\233\361J\3049\357\333\373)\341|o\317\267J\252\273\355\361^\347z\237a\005\037\236;R]n\203\216F>\236;R1V\246\327\b\270:R;S\251\035\025\3156\312\323\031\223\003\341\316\261\310\317\243#di]\3669\302\2219!\267\373\273\342\230\234\033\bq\216\347\337Q\305X\213\2745\215\201\001d\003\374P\206\222\343\347\034\316^\316\0229T\217\263u\327\002\\\2233\205\203C\265\267\223\241e\267)&\240\272\fB\230\226n+\222\242^\03076\300uu+\221f\254\273\332\227\271\231\237y\232\257y\364to\36372"
+	.string	"\275q\003\246\214\331\346\215m\206\002\350\346\254\332\320\276`\210\262\341\"\346k\fk\324l\224\313\032\264!ii\320l\264\216\036.t\246Qmg\344\254\324U\356hkZhOh\314\304Y}\365Z\331\316\2245#\323\021\214\037\316\220\241\314\325\311lT]\345V\242\246\0278l^^\030?\334\303\021!\372\320\006\223\343\356\307\020\371\333F\231\260\334V+D\275/9\266\022\037n\005\306\017\233h\367\2033\307\363\356\331\036F\371\266\215\256\320\272\302\351\233[\327\365\304\2160~\310t\017\304\017\325+\021?\\\345\356\236\245\"\353R\202/ZYe"
+	.string	"\327umj*\333W\335\276\034Xy%\016IHGF\033\212\210\206\204\214E\342PmV\356\213-\304\\\275{B\246\271\207\246ky%\025\351L}\300\311\034b\360\252\362\244b\0131\257(G:\323\354Gj\004E"
+	.ascii	"\237\024\t\312\272\363\264$el\024\245\n\2247H\223\230A\341\242"
+	.ascii	"''R\231\244I\300\236\360\020\f\027R\217\320;%\227&\201A\365`"
+	.ascii	"gL\217\0236\206\020\363\372z1\213\261\036\"-\311\027\023\357"
+	.ascii	"\367\341X\2309\266@1\257*\037\032\227\\5\352*\2422\255\353J\324"
+	.ascii	"\205\305\255z@\202\345i\324\325T\217S:@\347;oua1\027[\254\353"
+	.ascii	"\272\374\354\362\372v\370\356Y\330}\332.\212\r|\353\272\262\350"
+	.ascii	"\303~\224`{+\037\256\022\2122J\024\342\207\035\372O&L.L\222\343"
+	.ascii	"\363E\332\353\272.\211M\266\254\232\370\371~1q\202\n\350\022"
+	.ascii	"O\352\255\335\022\030\2041\375\256r\021#\301\207\013\207\376"
+	.ascii	"^Rs\350\017f\0212\271p\330d\273~S:@\252\016\"R\023\217)\311\370"
+	.ascii	"O\244&.9B\357\224\364Q7!\234\037\026\013Z\246+\251\020\215\372"
+	.ascii	"\250\237\365\345\307y\224T\314\224g\3123\342\207F\315\200\320"
+	.ascii	"+Z\244k\363]\351\272\247\0376\366\005u(\322\242T\343?7\264\272"
+	.ascii	"~\365r\211z\250\213\372\316\264\246\224\013\221P"
+	.string	"\017\365\235\200u\326\204\332\004\235/\306^\200\004\0370i\261\357\224`\370\357\351'\004oT\004\261\367{J1.\370\317b39{\271\303V\233\330w\312Y\226\201\3556\272\267\262/\226\r\377\271l\210\037\016;\001\263/&\027n\367F\277\214\265\256L\021j\017\3278\321\232\\\270\n\360~\017\306\007\374g\367\327\302\232\275\334\363}(.0,\320\317:\303\337\305\031h\032\370\347R\304\343\241\373\245\277\020\342\363\270\177w&&\013\356\206i`\332\312\202\273n\315\177m\262\335\177\355)\273\315\017\274g\236\367K%\336\257\007\360*\231\353\233<\257\013-\234\227H\2217\001\347\275*\362\262P\344\265:\357\220\"\257\020\003x\253\316Ku\336\251\363\"\340\274A\316+u^ \347\215:\357\217\363\3728\357\001\316\013u\336\025.\370\355q^\036E^\344\022\357\216\"\357\323\022\257\n\347u*\362\246\260\304\253C\211\327"
+	.string	"\347E\341\274\0058\357\t|\3665\341\274\004\340\262o\216\363\016\200\315\276%|\340%\341\2748\316{\003\211w\204\017\372\212p^\033E\336\020\316[\243\310K\003\004\357\214\017~e\234\027\204\363~p\336\0300<8o\007\347\345\340\305\007\336\rX\356\353\342\274-\316\253\301y3`4_\f\316{\301y-8o\005\347\245\200\323|Y\234w\005\007^\025\254\346;\301y%8o\004\347Mq\302/\004\347}\340\274M(<\360\236\350\300k\242\204\007\336c\007^\001\360\333\227\304yG\234\327\201\3636P\344\r\200\b%^"
+	.string	"\274\360\033\342\274L\347e"
+	.ascii	"\211w\001^\277\np\340M\200\227_\004\316{\300y\r\340\346w\351"
+	.ascii	"\274 \316\373!\211\327\203\020o\207\367}\225\276\367\345P\344"
+	.ascii	"MB\342E:\342=:\3425:\357\206\363\026\235\227\350\274C\347\025"
+	.ascii	":\257\361\274\305\363\022\317;<\257z\336~\333\317\307\302S\266"
+	.ascii	"9[\276h\365\236\333\212\244p\320Zg\330&\013s\375{\177\337\331"
+	.ascii	"\354\\v>;\2539\2479\2439\313\235\337~\301\177\320?\370\023\376"
+	.ascii	"\205\347\365\274<7\257\264\373\3456f\263\034\345\271%Z\245\362"
+	.ascii	"\013\313-\237a4\234\206\325\360\232%\362\262\266\325\205\013"
+	.ascii	"\327\026\265#J\316b\346\306\006\310p\313e\330L\261\313N\017\307"
+	.ascii	"\3218\022\367T6G\206\306\222\314\323\367DI\0311V6\307oc\334\304"
+	.ascii	"lt\223H\217\374\366\272e\267\031znW,F\017\013\0346\300\276\362"
+	.ascii	"\346\310m\374e\031\f\207\251\013\303f\265\325\f\035\243Ah\342"
+	.ascii	"\032'\024L\013n\364H\313]\230\240\300\017\032\003\030\035\243"
+	.ascii	"\325?'\264Y\266\247\013F\237\260\310\203\016\032\202\366"
+	.string	"\240\371\317\231\246&\r\032\27182\3471\377\223\270<\264\300i\b\346\340E\007\315\344\354\345\037\007\\^81\207\031]\364\006b\222o\374\347\213f\312\352s\343\b\256\247\311B\241>o\356\360\331\263A\377\357\311D\315E\263\334\231\230\254A\213\316\300E\337F\313,\233\026-\324{\0335\263l4\320\"\315\240\371\314y\315U7aL\026\235A[P\347\004d\324%\306\346C\201a\314?b\321\023\361\302x\356C;\2615\n\006\315h.h\f,\350\013:\201\277\n\232\202\266\240\227\376\360l\364\036\226w\364*\350\2771kc\332\331\350Q\327\233-u\362(\350\013\372\332\300X4\247Y\321,"
+	.ascii	"c\360\004\255\242\227\345"
+	.string	"V\260\\\337\235 A\331\231\236\223\ft%-o\320\344\304Q\321\3042N&hV#AO '\202N\321\0224q\320\211\326\264\353zcE\206\272\b\372d\344\334l\224\350\355M\033\272\024\215b\315_\346\327\304\314\337%\216.,\216\314\231\230|y\002\375A\320'|\240Q4\004\315uM\375@\017\353\234r\232\\\030\265\273\303fM\323\037\024%\372D\257\211F\221\206\004\023ei\032M\322\315\221\035;/g\344N\364\260L\334\232d\034\023x%r0\211>\366\n\240K\364\21502$\214\240k\270\244\233#:\273-c\336\216\255\016>\231\264\265\230d\235]2N\034\342\207\002\350\016}_sH4\277\215h\007\232D\177\220\315\316\n\230\005\214H\316i/\033-\366\261\263\262\326\305\201f\240\257m\314\223\344\362\330\0215Y\003\255\002^\253mt\330%\303\2404-\rt\207\276\266\2660\304%b\353P"
+	.ascii	"\372\202\2738:K2\317\304\366\225\306\222\264\223\324K\342I\342"
+	.ascii	"y\372\021\321\001hb\235\223\216Z'\317\232\224i\306NK\250\311"
+	.ascii	"\2268\207I1D{\210\213CH\024\321[\037\256\\\022\001\320<\340\372"
+	.ascii	"\260X\220\231r\271\247,\002\200\376`\366\205\226gMD\277\320\030"
+	.ascii	"\242_\310\324\nt\210\346f\240\231\272\370\347\224\323\327T6z"
+	.ascii	"\264\224\341N\fd\f\364\005fmy\324\334\326u-\362\371\002\255\302"
+	.ascii	"\266X\217\351H\346I\322\220\244\201\370\341\002]\324\367\345"
+	.ascii	"\343\211t\315\003&U\240y\215\301\bt\002\275\027L\366I\376\341"
+	.ascii	"?\025h\301\216r\302\211\277\206&\003=\311N\335 (O\022\350!\336"
+	.ascii	"\223I!\002\315\313\003\332\200F \031\3300l\364IR\234|\035\320"
+	.ascii	"/\323L6J\244\245\016\260\227\264\022\003"
+	.string	"\372D\237\337\240tm63\271\236Zg\254\037\352\264s\013\234n\300\334_2{\225\375fS\020\226\325\313e\256\366\272a\202\27169\330]\311\302\rR\324X\201\262\r\223 9\263\207k\236L\326\376\262\357\2342\233\253\217(\227Me\221\"\304\017\277\266\221\331\0273\253\237J#\30375V\214h)\373\203Y\333\fM\222\315\\.\364R'\373x\3164\346Z\345V;7J$E\315\224\"J'D}\350L\261\\\350\023fG\376\262\031^\220\362\326\217\304\251\205\237gbj\261\363LL\277@\351Rs\023D\177\350\245\346#\315\334\350\321[/{\005\321\031\230\265\t\256\022\t\023nT\210\256N\017\224mP\351d\303[^\030\224M\220\007}/\212\370\341\207v\240\257\215\261>\024g\207&\310n\r\374\263\266\371\003\003\235\377\276-\376x\350\367\351\320\347\243\324\036\372Y\204r|\350V\331\305\201:@\250"
+	.string	"T:\351\020\310D\337\227T\233T\005sw\350%\312&\374\3472\025\331\343\032\242\212\370\236\337\333\315\301\177\224N\232\002NU?\220;\206,(8\222\232\272\202\341\342\003\020)\250*\247)\344\017\344\323\223S\321\016\342\215\035P6\252\200 \247\246\204<q\220\232\272\352aTQ\305\003\371C\007q\305\224\216\"\217 3x\004\211Q\005\004J*H\025\222\212hJ\252\352\311\311\203\252\033;\240\202\030\221A\256p\260\340\364\0039\302\007H*!\033\252\250\244\2446\340"
+	.ascii	"I%D\210\n\212\005'\0259\004\252\352\311\005\222\320\321\016\344"
+	.ascii	"\024\262\352\007\224\007NU?\220\034T!{L9"
+	.string	"\341@V9M\201x\301\201\320\016d\025T\024\324\214*!A\252\204\204`\205\004\202\204\254r\032aJjj\252\203\250)d\025\224Q\324\024\022\207\r+$\020\343\356\200 \002\036\020\250\200d\201\342\b\307\016\336'\024;\240\2024U\255\320\003\352\007\217& PNQMOSTM(\226V*\br\252\251JJj\252\211\310\215\371\257=e\207u\002\321\230\335\334\375\336\373\314\312\004\007\327%\263\211G\232w\367\213\371\327\314t\255JM\266B~I-t\373\rK\\\251\267N\\\251_\370A\343\004\337\247rh2\243\236\265\255\254h\321R\257z\204B\367h\241\337g\342J\335B\337\tmN\371p\221\256M\346\222\327B\302\301A\027|C\223F\315Y\231Y`\240\277?}\316\347\367\033\\\003\247D\346\250w\246z\3222O?L\265\016\3364\217\016\221>\021x\025\250\336\341\351\231#G\255{\372\t\224"
+	.ascii	"8\311\274\017|v.\024^u\002\272\3618\351\324mT\310\016^\2357n"
+	.ascii	"\256z\204Y[\037\026\350\346\2260\232\205<+6k\232I#\374\347\220"
+	.ascii	"\266J\203\347EE\243\236\031\202'\304L2\357\250\214\032\227,\222"
+	.ascii	"\2254b\344\315\026\322L\203\223\316\234*\025.\271eT"
+	.string	"\246\276\251c\222G\220$\273\272\210\"tU3\236\223\316\233!\334aI\222\304\036:\252nS\303\250lS\r\325Tm\244\367e\317\tm6\367T\220\226j\004, H\013}\001i\037-\325\375\027\325?\032H/\225q\2469Q\275l\364JR\356jX\353\022\325_c&\243E\350\037}\200\336\027>N\264\003\364\n\355\243\207\177\31640u\313\335TUS\323\016\240\242m\264\351\356\246Y\260@\265\321\027\351\nL<z\005\325\n\217=j\322\325\254\354\214lL\n\024\354\\q}\346\002\247=\372\202IH\265L\255b\306\337:\342\216F\242\260C\260\350\344\351\204J6E\205~rR\241\231\260z)gtB;uq\360n\002\361\304Rh\023jX2oE\231\032EG\247\320E<Y\204\b\340\034Q\222R\370O\035\375\3020,7bE}a\300 5\331Q\223\255\221\001z\210\nf\200\317\355\005\322"
+	.string	"\313\023j\324\203\250\364\207B\267"
+	.string	"\3029\272"
+	.string	"dI*\374'\n8\272\204.@7\236\023\255\271\227'\215#=\241\231\312\271\312U7&\364\t\215\342\317\th(\320\204\346\2633\021\300\204^ z53\250\205iPX\b(G\023\240\217u\3164\242]\211\263\225\023\301\256|\230\267W\227\243\271l"
+	.ascii	"\235\243\204\276\321\003\350b\031'Zs\217\256\204f3\037|\243I"
+	.ascii	"\350e*\311\263\344\025\376\263\004*\352\0137\030\340\243\342"
+	.ascii	"\225,\274\240LM\242v%\263hI\252\251\021?$\241{\360\311\244\312"
+	.ascii	"_\266'F\3121\200\231c\2623\025\371\240ec\034\273\321,\005G3\224"
+	.ascii	"\301\216\250G\270\266p\264\220jd\243ZY7Z(In\017\330\022\336)"
+	.ascii	"a\333\320d\333\304\231\327F\344A{p\342A\207`\364\326\b\37568"
+	.ascii	"?.*\226\016!)whjSe\216\320\r\2309\271\340W\204\355i\"B\177\320"
+	.ascii	"\231j\264\215\226!B\bm#\204.\3269\375\320\350\032\255\342qNg"
+	.ascii	"4\215>"
+	.string	"\240.\213p\255\013\223_\016B\313\335\024\302\301\031}\274\276\266=/\310\350\017\202\320\"Z\006\364\203\204?\250S\242\325\251$fA\346\030\"\221\031I\222\244\003\363\026@`04$\031+\243\356\023@P\312\023\352$s\322\230\221i\222\f\333\001\020\200\262\021\326g\210\232\n\256\200\300\034\034!\350\025E\213z\205\013\300\034z>\264\034\230\352\312\363\004boV\320}\220\362\027g\346\203fDZ\261;\207u\216,\003\fQ\301\213\324\212\016\256@e\262\200\3450+\231k\307}\240\265\255\257\023];"
+	.string	"\027\027n^\020Z\224\235=\215VX\300\361\323\215\257\221\032r\365\301\313\300S\312\334$\271\203zD\201\201iu\033?\016\r\324d\317"
+	.string	"\322\340({{Gj\032\211\303\327w1\243\330\\\375i\334\345s\350Lm\261\344\357\346\356\026Q\212\227\222t\204t\317\025N\354D\211N2\331\204\002\016\225Uv_<,p/\357a\330\335\217\241\024-x\"\256\343\237Q\021R<\233\313\027\r\252\340XD\347\221\007`\003n)\206*\013n\211py\245\344\354\344\2076UQ\003\003\264o\226\"\264_\224^\330\b"
+	.string	"H\267\266pUWha\340\177\222+n\305Z\n\326\022\334\3721\332\222\t\342\360L\262\373\246a\232\340CMy\213\355\371HR\271\371\243\216lSNi8\315\375\203f\"sR\254\312\2649\"q\241f \370\022\020*?\220\r\206tt\320\f\262\004\361\314\260v\264\254;\231\224\006\2041\030\032\200o\007\227l\0370+\365a\24654\332\254 Zy\247\262\f\036\t%$\37082\200\201\234\0045\372\243\220\220"
+	.ascii	"\375b\230J\223\215:*>s\350\212\212\252N \3702\273\231\321\026"
+	.ascii	"\264\221\273F\274\276\316\257\267\246\203j\271\214\377L\371`"
+	.ascii	"Gb\030\213\365\212\276B\021l_&\007\317\214\203\017\006\236ZM"
+	.ascii	"\005\\I\371\n!\211\203\262'\255\331\370(\234\346X\210.\347\266"
+	.ascii	"\327\fH\353\004\201>SQT\355N\216\236\005r\3320x\236\331\226\226"
+	.ascii	":\232\273\316\033\300e\355+?\037\221\222m\317\256\233W\377\247"
+	.ascii	"/9\022\335\330\033\375\310\341\360\352\373\374\212Z\335 $\002"
+	.ascii	"\020\373s.m|\224\231)U!5\273\276\216\251\024\3004\264\021\347"
+	.ascii	"\357\034`\f\013\302\245'gN%\346\036\tE\246\034\3640\035t\177"
+	.ascii	"\203i\301\230\314|\262\355\245\002!\032\016I\205\341v\0354\357"
+	.ascii	"\342,O\321^C\227\001\330.\341\021Wx\323\241\226\231@E(\221\264"
+	.ascii	":(\370kP%('\"\311\310r5\0134Z\353N\312\270\342\310\024\027\247"
+	.ascii	"G\221\374<V\221!?\350QY\315;2\313\260\245$:\364nHqfn\340\025"
+	.ascii	"~0\210#\3137\201x\\\033}\203\256\232\241\365\225\225\t/\306\311"
+	.ascii	"\021Iw-\252\327w:Nw\317[\033\231*\3401\216X\274\204\350JBiKz"
+	.ascii	"\n\271\257\270\332\326\273/N\r\f\240\347\300Zae\030Jj2\317\267"
+	.ascii	"\202R\214\t\003#"
+	.string	"\311\214\363\242\246\007\2675_\020C\262\0202WU\f\f}\030+\005\344\347\203\353X\362q\316\260\001:\212\307\215z\\\361\362\356\275\241\251\337\fW\210\024\360\370\035U\246\272F2LB\367&\373\315\006\007\r(c\001\252i~\024\323\316\005\343\336\365\035&\344T\004\025\t\332m\003\013\254\310\227\261\361=\2267\273)\351}\305\200O\304\300d\210{L\271^2\242\234R\013\216\t\360\025\256\360\257O9\204\324\360^\316j6\031wdj\203A\223y\"1\003\307\236\236\f\021\021$\036\342\316\r\017\203\213\256\210\001T\241@\006\216M\364\212\300\207\242 5\244\327\265\376\340\272\017\254\315(%}\247jK\303\274\336d\347\205\027\271\231(N!\277\2136\227\021\230`\373@H\252\214g\003\321S\336\"S\264\316\270\247\3248.+\302 \343\203.\322\323k\334\335\240\026'\372a\271\346\345$\325\020R,(\313\360\373"
+	.ascii	"\031\256\320\332\255Gm\027K\335\304'\b\330\364\231\r\344\221"
+	.ascii	"\226\310\345\375\244\307\216\366V\230\330\275\300\3431\345\303"
+	.ascii	"\370 \274\363\200\213'\375Q\204\2070$\302f^\375a9\310\321\366"
+	.ascii	"\371+[uD\2629\334\251\"\377\267)\356+RhLQ{\365s5\362n\374\350"
+	.ascii	"\254\274!\252\320\370\232\"\321\321@}\237\221\333\227m0!O\310"
+	.ascii	"12K\005\253Fr\356P\323r`\3265\240\341z^\306\254\266\307\033\032"
+	.ascii	"\344\312\315\362\017]\303o\266L\225\347\255'\351W\006Y\326jr"
+	.ascii	"2w\214\250\307L\362H\320J\202\240\206\340bLX\367\210\332d\212"
+	.ascii	"\321\036'\264\203\030\373\037d\223P\264\006s\364\331\013\037"
+	.ascii	"\204\260\306|\2076\216g\277\033\217*=\224iH\004/y\2403\364\017"
+	.ascii	";\323\254\210o\364\272\2759\341\212\315\241\031\273o\255\335"
+	.ascii	"\222$\333$\311\217()\270\202\340\327]U\363 \306\016\264\003\266"
+	.ascii	"\201h\272\313H\3242\001ct5X\256\030Q\224\320\300\314\330(\352"
+	.ascii	"t<\376\312\225\275\305\t\n\2718\341Zi\240\243\\\001\227\253/"
+	.ascii	"$\232\270\313\030\262\b\275\207E\020\270\2549\246\214:\331\013"
+	.ascii	"\245\217"
+	.string	"\311k\233\3702\333X\327\224\rY\376x\274r\265\203G\220`\2661\031,\017|S\345\314\035;9\001\030\257.^uK\350{\370\200\271\200\312\365ZN\232\226f\246\3055\034lk\220C-C\\\212$\201\230Z\3051\231\324$sO\002\bA\315\340q\nh\005\351>\004\257\202\242\220\336;\227\243\236\361\341\374\023\034\026s\304\312\311\262+\031\356\025\222W\300r|;\257\366\367b\352\033UL\365\204o\376\320\355\244\023[\253\026tmb>r\241\251\224\215\314%\244\237\037\321\366\375\333d\223\221\216x\356\006\t\301\362(\323\0035\200\023\346p\253\214\337\177\225L\255\f6\243PCyU\253Q\3605y\353sL\227AE*\271\237+\352\347\030\350@\272\177\235p\226\022M\360g\327\005\317Xt\244\270w\330\356\270\240m\033<\376F\213\250\356\265\352\241V\302D\331\220\320\264\333~-\251%l\314X\201\373`"
+	.string	"\020\345\377\363\022\252v\f\346\022=\261\264\177\n\017\364\214x\0274)\246xe\0207\3532\277\234\317Q\374HF\316\0210v\342x\305\241\004k\036\330\003[\365\3167`\t\375\357\314\024.\024\373\276[#\177\201?\212\347\373\215\351\r_\274&\232\311\233\370y\007>\2071\025\244\346\251w\t\204\242\273\324\033\276Di^\353\256\323\3575a)N\237\247\257\022\r\324\002.\301\002\f\245\215\033\224bY\345\344\001\311\224\344_>3\204\254J\325\237AbF\001\214\267ds-j`\370\307\3773\341\253S\271a\343\325\365\256k\320\376\013\023\305*a\337\302\355Qa{\351\300"
+	.ascii	"\372\264E[\270\224`K\374j\272c\263PkW\304\354\374p\"\241\027"
+	.ascii	"\254@\325JD\220?\270\257=\316\233\374\332\316dZ\006\013X\362"
+	.ascii	"\032\223\216\344G\245\300?\266\025\036\375\020\0265C\331\265"
+	.ascii	"\341\306\331\224\246\354T\024-\204\331t\334\301\344:\201\223"
+	.ascii	".qaR\3013s\326\nO\320\235J+\026\351}^W\232\033+\222\332\3136"
+	.ascii	"\361\333t\313 \212Y\007\255Q\3033\021\036\327eb\374msO|my\336"
+	.ascii	".\036\322#\203j\346\320Dm\372\257\361\377\313\030`X\3344\223"
+	.ascii	"/@\032o\332`\341\214!\004j*\333U\217\257\365\""
+	.text
+	.section	.gnu.lto_pidFixedWing.166.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\210\026\ra"
+	.ascii	"J\233<\"N0\020\323\031\016\302\"\310\320L\t\274\335C\361\362"
+	.ascii	"\3526\233\020\376\031\031\311\304\236\241\t\327Q\320\267\351"
+	.ascii	"\326ZX\252\335\320n\017p)\371lH\t\177A\020\206k\351\t\335g\263"
+	.ascii	"\t\3078p=\035\245\363\371\210\341!\263\027\305M\310\336R&\031"
+	.ascii	"\027\002\331\001\023\002wTL\331\201C$\317\016\034\021M,\345\352"
+	.ascii	"\324\343\204\362e\324\221\365Wb`S\336\334\303=\356r\252\352\246"
+	.ascii	"\215\223\r_<`\323d\316\333\3766Ck\351F\304\003\267&hV\224e\325"
+	.ascii	"\321yBZI\372\361\351\240yB`-^\231(\313\252S\262\021)\2625\371"
+	.ascii	"2*\310\265\026Y\341\002K\326\311i\262w\3637\217C$L\0348]c\234"
+	.ascii	"~O\211\220y\023\203\023t=\373\0300\2571D\306\3344y\033'\354\006"
+	.ascii	"\006,\004\t~2@\331\257\025\321\222\264\3735(\217\241\327\304"
+	.ascii	":[\007~.\\-\n\363i3\264\324\240\300\206\314\r\233(\b\254R\316"
+	.ascii	"\234x\241~\031\205\256X\312\365J\211\226\204\362\327\354_8Z\224"
+	.ascii	"/\243\220\224\353\225\2102\r\332\224C\224\277\033\365\\\210\262"
+	.ascii	"\013\374Y\006ga\257\246g\202\026\032\360\351\356\252C*\345\372"
+	.ascii	"\345\373r\306F\354\256\bX\322\371f\031<\3152Q\345\372e\324\264"
+	.ascii	"\342F\354\356\351\372\370=\025\"&i\257\334\227\t!!i\027\315\256"
+	.ascii	"}\275Z?\345.\254J\335\272\256JOw\307\357\351\376L\006\273\300"
+	.ascii	"\247)pW\310\227\244\363\356\305>\246\236l\231\033\264\256n\316"
+	.ascii	"\330\254\353\372bW\374\236\016\177\324{\212\336\250\367t\325"
+	.ascii	"]:$)\253T\215\260cU\232\273u]\227\032\204\355\243\312/\021\253"
+	.ascii	"/\"\032\022\022r\b\0027\004\375|\275\024mV\367>\246\025\216~"
+	.ascii	"i\241\316\021)\365\"t(\0044\306\024\023}p\345\365\241\256\013"
+	.ascii	"\2414\244\334i\375\rK\027\032\364S\005\307\205\205\311sH\312"
+	.ascii	"mq\320\307\004,\341\345J\353\033\376\206e\313\036\0178\350\305"
+	.ascii	"\254\377\336\260d\371\320\244\244\234\r\204\310*\364\310\355"
+	.ascii	"\313\235\237eq\017\035\256\353*D\032\321a\2112X\2608\345\340"
+	.ascii	"(\232T\227\326G\210\224\202\036]\021s\274\332\331\nI\305\375"
+	.ascii	"\2623\020V\305\316\313\225\327\331\307\264\256\353\362\021y\365"
+	.ascii	"5\372\356\233v\327j\367\250J\215\345\212\225\346s|\016\031\330"
+	.ascii	"6\372F\343\350\275\332\017 \374c\216\036V\265\324^\215\255\""
+	.ascii	"@\321u\265-\200\217\007\b\331\231\001zJe\n\016!l\\f\220\224\031"
+	.ascii	" )\201\230\352F\243\360\"k\256\260\201\344l \2062w\227O\330\350"
+	.ascii	"#ev\250\330\317^m\023`\251e\246H\263\273\033\273\313\204\327"
+	.ascii	"!@;8\024\222b\201\236\027\325{j\243;\314\221\251\375]\315\261"
+	.ascii	"\2675\355\267b\266E\211\247\007\330g\363a\177\315\207\305\003"
+	.ascii	"\212\n:\217\273\313\344\177\206,9\327u\315\201w?D\366_OW\201"
+	.ascii	"\005\370\307\005zO\337?j)r\336\376\354\271\325\353\272J\365*"
+	.ascii	"\361\340*\362\237}\331Q3^X<\263\336V\376\263\253\234\342\016"
+	.ascii	"\263\373\257\rf\367\274A\216x\201\234\227\200\016\274?\214x\231"
+	.ascii	"N\367\365q\336\036\347\345\021\344\035\240\210W\200 \357\216"
+	.ascii	" \257\216\363\346 \342\305q\336\033\347\265!\344\255q^\032B\336"
+	.ascii	"\031B^\031\347\215!\344]\032\342\205q\336\027\347uq^\245\363"
+	.ascii	"&\235\267\205\220\227\305yW\byU\b\361\2468/\212\363\2368\257"
+	.ascii	"\t o\t \357\360\274$\316\033\300y\001\020\362\216\020\362\212"
+	.ascii	"8o\b!^\020\347E:\357\207\363z8\357\321y;\274\311[t^\242\307}"
+	.ascii	"\207\316+$<o\360d?P\310\373;\232\257\217\003o/\310\233\236\027"
+	.ascii	"\005\3626\220\227Q\336?\320-4\251\302\254\272\216r\275\222\007"
+	.ascii	"hmK\325H8\335\037\3677\1774Gw\277\357s\032,x\235\235\221%\347"
+	.ascii	"\256"
+	.string	"\217\005v\337\243D\217\002K\261\244\330S\206\247\222:0+vJv\201\247\333\347Y\340\3322\333\356\200Q\201\362:\373\271\317p<\2763K0I\261;E\254\002H\315\243Q>\306\273\240\031\030\027\336se\251/3\244\001\356\340\367~\217\252\201z\205\177d\242\332\320a\226}J\347\236R[XV\025\363\347\342\277\266\032`\217Z\222\024\211&\226\306f\200\3560\267\207\213\236\0239\345\266\232\353\223\016R\257Y\242\375\370\374\320\035\032\251\233\315\230\364\320\300\376\320\275\032\214e\216z\250=t\232\306X\006\311.\224\220\324ja\310\341\234I\255\263\243\266\241fa\263ev\332\262\2044,tha\034\243~\263\250\211\332\250\f\007\214\246\353\214\262\210\254kL\214\250U\314\255\005\351\303\321\331q\376r7j\223\203\241\255\006\003\233\200\366\321@z\231:H\353\340\242\343\024\032p\341\314\3420u\313\321\276\222Z(\234"
+	.ascii	"\244\323\345Q\313\217&\240o\254+\226\300f\324-.j\227.\275\247"
+	.ascii	"?Z\350\205U\374\302e\3240\351\031\264/2c\230\332\003\013\271"
+	.ascii	"\016|\364\351z\364P\373\350\263\031\313\320\255\n\002\213Y&\260"
+	.ascii	"\013\032\230\021\276z\364\013\257<Y\336V<'\252\223C6\357|X\264"
+	.ascii	"\343\374\260(\007\303\333P?N\250\203=\324\2744\216\231R\2758"
+	.ascii	"\204e\n\235\361\352\022\352\036^d\315\025\302\037,3(m\311\025"
+	.ascii	"f\b\207.pN0\301V!\367w"
+	.string	"\311\245\275\375&\030\301\332\334z}:l\037\372\272\327\257\nd&\355]U\004\366\222\344C\227!\035\270\322\345\361\371\353\264A\244\251\nT\344\274\336\t\275\240\016\263\377\363\304\034\223\277\255\357\330\233\021-\325d\301\202W\327\202\321\336\237\251$\250d\370\307\035\215\266\224/IO\307\362\026\326J\002\246\2321\323{\252\243\203sX\3775\237j\276\301lk\f\3327;\201\263\226\371\245\023k\310\3638\361\270\003\264\277\344+\327u\355u\007\337\206W\303z\334\335\257\302\232\342\274]\276\342,j\330\376kU\025\3241\376Q\035\353=\345\3061\207\005Uf\315_\366WQ\203l\303\253+\2469\002[\001\324\023\024T\001MO\214@\031`@T\323\222 %PM\f\024\211jZ\362kzb\344\311\002H\234\230\374\226<9=qr\362T\304\202\t\234\2368\341\340\304\t\003#\350\"\221A\203\002\031G\232r\300\020b"
+	.ascii	"\t\357\0040\22081YzRA\022\247\013(XZ\342dD\311\322\004PN\226"
+	.ascii	"` \355\023\223&\250\245'OOPK@e\361_\033\314\n\377\224gX[\261"
+	.ascii	"\247\212:\314\006\331\031\022v\333a\245\373\332\352\305}\r\344"
+	.ascii	"\217\227\225\251\310\177\030%\022\366\321\270\270\257\205}\264"
+	.ascii	".\016\256\351\366a\221\016[\026.\274:-\3048\036\234\034\254\321"
+	.ascii	"\350\032\335q\3069\235e\231Ank\340\256\2204z\205\027\031\330"
+	.ascii	"\214+V\332\030\365\f22\252X\275!\272\361\2171ZFSY\246\317n\215"
+	.ascii	"XO\351\252\030Mb\216\214\313\222\024b\034\241\236j*\"\033\035"
+	.ascii	"\242\233[oi\316\026\214~s\027\252\245\210Ma\327r^\257\3048b\035"
+	.ascii	"\342\034\377H\234\353\275h\030\315l\3069+\272E\273x\241\324I"
+	.ascii	"\355\"9\005h\231B\177\374(\265\217\271\244N\227\306\344T\267"
+	.ascii	"`\321 \370\030\237*zE3\036c]\212V\321#\370\314\300wD<\027a\267"
+	.ascii	"\346\213\206>)\372y\346\352t\360\266\016!\300&\372D\243\350\236"
+	.ascii	"\035Q\217"
+	.string	"\236\247\035\212<\313l\344\022\020\035\236\023\035D\326Fm\242oLN\345-\345\210q#\364+\321G\312\3466\254g\321\033v\21195\214\310G\035\033\266\2139\254\032\336V!\211\256\263t\312\305\325p|\006\341\020\r@\007\320\373&\021\217\370\207\177$\321CcK\275-3\b\271tk\013\240\203\310F4"
+	.ascii	"\"zD#\261\031\237\":D\232\252@ :D\243Kc\235\034\037\016\304\274"
+	.ascii	"\036\bb\r\314F\314\373\255+\325\215e9\352\024Uj\377\005A\357"
+	.ascii	")\210\276\334S\244-\341\222cdo\030\216:%E\255\252\352=\025\240"
+	.ascii	"O7\207U\244\341\007lyY\371\017\321\332\013X\256\214\240\207\202"
+	.ascii	"\347\351\264\005y4\025n\203\346\224a-\356\370\f\201\337\250q"
+	.ascii	"8\346\230B32\"\"\222$\005I\007\221\005\304\030\304\034<;\021"
+	.ascii	"\320,\311\230\232\031!i\222\312t\350\353\265\367\247>\222<\244"
+	.ascii	"\255\344\213\221\204\232\374)' A\026\031\354\376xdu6\377y>\335"
+	.ascii	"J\335\214WZ\310\225Q\325u\260Z\272\272\016\277\365d\345"
+	.string	"\370]a\250\221x=m\270\005S\237\227\272\355\245\240N\022\365\353\265\353\305\305\3656P\034\n\016\334\332\301\034\004\016\351\nG\212\367\366O\372*\255\246\017\317\260_\3451\350=\233zs\004\230\007\361\217%\007\310\307B\005\277C\367|\326\344b\307M\347\242\304\216d\232\200\274n\036\337.\205q\357\330&Z\023\361\274g\024(\016\365\034D\362\\\377\023\003\033\032\305\242'`\364\366\274'4]\263\243\323\004\307\002\253s)\352\317\362KA\024\207\3479\243A-\335\341\001\327Y\177\257C\035\270\b\274\033^\004'\035\201\031\005\332%T\232@\327\353{\025\346\351\230\270\370'L\023\242v\327\321\035b\031\327\257\247q)\255\203\303$\212\264e\003E\206\2676\t\bR\250j\312\354H\216\253*\213\243\025)\345\261F\350\272\2436\315\303\202\272\334\013\2415r\352\357\275\024qwD5\345@[\327\226o\377\022i\021\021"
+	.ascii	"\367\30049\246<\322\324\236\313Lu\246\243Nsj\fo\351xW\3613\035"
+	.ascii	"\237D/7\214\b}r\306<i\206Y\246\337\f\223$h\275F5\242}h\212\313"
+	.ascii	"6(\304\315K\221F\316F\321\270\b\331Q\213uU@Y\214\263\355b\255"
+	.ascii	"B\202\001\035,\2220\215|\3006@C\026\032T\260\271\341\031y\265"
+	.ascii	"\360#V\013mE"
+	.string	"\023\331\343RIAPn@k\204&E\343b\373\241\330;\352\247\231\327\251S<\267\215\223\356\202\007\033\210\246P\220\2617J\374z'!h\265H\333J\347%5\366\374\242\246\224o\346T\210\202d\3253\310\325\237\333\253\363\372s\317t\006W`\f\233\321\036e!\362:m5\334ST{\207\217\321\244&\324U\t\020B\372l\210A\220G\345\2673s\237\2518.\350\303=H$\251\305G\323\271\272lDJ\225\333\005\003\255\333\002?\264\200X\325\273\202\342\223\306\030\323\024XC\345)\fqc\235\342\030\tp?\204\005(\213\356yw\260\344tg\350E\202YF\373U\222\027\023U\267ar\251\032\340\2325\206\006\213\351\322x\213\347\002\263\004\360\375\256+knr{D.)F+\316R\245\251\222j|d\0229p\375\033,\270\330\377\024IJ\337/g\250\204Y\317\232%\027\016P!\203I\0326\214\037"
+	.string	"\306\027\004\311G\261'\177\222;p[\323\212^7M\243g\317\356\363\225\321Q\362\376p\227\317h\321-7\032\001\362\220g\330`\t\2249\313\025\204\0055\t%\250L\006\332\240|\020\224Y)\332\206\221\023#\362\2123\245\265l\234LY4@\200\034\276P\355\236\327KQ\366\363C=\276\202\323\346'\312\006\022l\235n\226\204\305\307\\\312M$\347"
+	.string	"\327\214YI\365p<\207\346\301\256\232\270Cy\352\253\314\275\323a:\003&\312c[\353\274~\247t\227\370\034J\327\322o\241n\002\310\013\200?\245$\244y"
+	.ascii	"\264\310}\247\354pM\346\217\223\202u\254\bW\345R\302\320\200"
+	.ascii	"g\036\312E\004\214\303\232$\336\267\224\211\230\217x\266\352"
+	.ascii	"\233b:\r"
+	.text
+	.section	.gnu.lto_nullRateControllers.167.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\t"
+	.string	"m\007"
+	.string	"\"\31646Pu\032\003"
+	.string	"\240%\346\367U\016\355\031\001\374\230\365\312\331\2322P\034E\266\017e\263\242\031?\235F\003S\266\315\035\036N\202\335*CuL\213\234\b\331{K\231R\335B\n\244\220\304\210A\013\200\330bE\332\306\225\246\211b\202\253 \315\013.\302b\212<\214\251\201\332\225F\3364u\2357?\251\373\272D\265\303\212YeH\215\036\260^f\036m\332\024\030\245H\353\353\377+Qm\004 )\t\335\322\372=Z7_a0&m\375i\037:\020\034[\2438\345\263JU\365\3742*\227\377\t5\350\030#\360@f\354\262@f\254_K\003\3328\270p\002\302\301R\363\177\312\021\177\216_\355\025{N!\350\310q\370\337x\n?\\\351\266\005m\033\332\206\004\b"
+	.ascii	"i\221\"\023\257\364\242\301\205k\227A\276\325hp\227\027\355$"
+	.ascii	"\003"
+	.text
+	.section	.gnu.lto_updateHeadingHoldTarget.168.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`4"
+	.string	"\315\b"
+	.string	"6\221@< \345*\035"
+	.string	"\254L\342U*\314\001\261\\e\251\241\211;\212W\212\002\251\266\372B(\310b\013p,J\334\360x_\001"
+	.string	"FIU\002\302\202\241\n\002\204\347Q\226\215>\331d\313\224\002,"
+	.string	"/"
+	.string	"-"
+	.string	"\372\202\356\322\240-\363\320c;!\262\013\223\231\335\235\261\343\340\025\364O{\300\013\326\272j\036v\327\372\202e\334\361\266\021l;\330>\t\002\262\024\330Q`v1n\001\266&Y@l\337~\b\332\034\033\3026UO\363E>\002~\306\262\334\335PY\331\335\005'l.\tn\320]\006\256ha\215>\311KX\376\207+V\372\327\245\277\352.\017b4\\z\263\202\255\345e\025\200\035\2664r\330\347vw\035c\366g\277r\001\016y\030F\236\bQ\2037@2}\241\217\250\2441\310\013}\250\251*\221>\211\3214}\237\211\tJQL\257\343\023J\224\232\252\323)59\341\236\333\030\363\306\346R\013\007"
+	.ascii	"\006Rd\342-_4\302\205\035\272L\004wn\321\316'"
+	.text
+	.section	.gnu.lto_resetHeadingHoldTarget.169.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\002\001U\r"
+	.string	"6\031[F\020\257&\035"
+	.string	"/\013\t\201\2224\367\227\240\346Y\003\246\260!U\365\022r\367\376\036U5\233w\00548\371\350\273\263iX\301\260\206\300\250\323"
+	.string	""
+	.string	""
+	.string	"\220 \250p\032\354y\032~\341\017\266\227\240\001\331\336m\313\224\002C"
+	.string	"G"
+	.string	"H"
+	.string	"\366A<\004\367\025\312rw\303\t\232\335]`\004\327\345\200\027\360\\\352\tx.\315\331/\016\256lH\365U\020\021cwg\354p\356\312\371w9"
+	.string	"/ur\375h\354\256\325Ka\270\343m\213l;\260\237!Q\305\376\352\277\f\320b!u\231\231\335\01393\266%Q\264\370/\2179\035\364a@),\276\335\305\316\272\226\346\322\240\372lvW\301\345F8U\317:}\205\002\355\273O\345\301\346\322\1779\331\330\3451{C\305T\r,\227\016\3214\t$z\317\007(\304\023o0~\227\233V\347\2178\t\224\317\342\t&z\317\304si\300EJ\2479~\314\277\022\256\250\201\371?\204)Z<\236ukt\212\343\004\341M\315*\216\r\242h\344`\277\263\273\353.\221\030x\220\036\230\032\214\004|\210d%\016\023\310\307\035\243R62K@>\262\b\036S$\343\b\231\035\033\311\034\205\254\215\230\266Y\242i\333\304\300\356\235\215*\276B\031\255.\242\030S\317\330V\321\301\233\320\256\335\356\236_\3422\020\374\027"
+	.ascii	"\006Rd\342e\322h\303\203\006\"\005\233\325\377uC\313\354xj\r"
+	.ascii	"[\245\026\232\260/\267\331\264\355.\363\200\206\346E(=.\016\205"
+	.ascii	"bR]\212\312\222\265j\005\234\344\3055\311"
+	.text
+	.section	.gnu.lto_getHeadingHoldTarget.170.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375 \371\325\006"
+	.string	"\302\214/4PO\323\001\200\276j>sT8o\220#\224Z\261b1\305`\224\306(#\315\266\234\327\366P\016\342B\244\252\"\n1\204\337x\244%\034\3572\332D\312\224\002\246\246\206\352\202\230\b\210J\342\001RT\f\023\220\302*\340T`\353r\300 \306\2620(q{\355\244\032h\272\261\177r.\372!\266\310\344\267??\023\375\245\006\200lh\331Y\352\330t\261\271,\325\303>\264\332\261\235N\205<(g\371\354ft/\273\362TDlkl\311\0379\211\3061\341B\313\016<&\030\237\226\335\205\002'\210\376\362\003\321\237~<>\243\377\222/lR\272\215\223=\001\024v\327\271q4n=\202m\216\t"
+	.ascii	"2\001\0038\003\\\034\240kxn\210\0213\366pW\244\331\360\256{\003"
+	.text
+	.section	.gnu.lto_getHeadingHoldState.171.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\022\003\265\030"
+	.string	"F\256\243H\260\226Q:M\004\1778a\t_\205\353Yz\347\344\276\350\361A\356\325!>\fY\341\242\210\2075\342\032\272\372\257\267UrI\200\3622:\254{\300\231\001<i\177"
+	.string	"vz\306B\243~&\214{\334\333\215O6\331r\247\024\225"
+	.string	"\201"
+	.string	"\217"
+	.string	"<(Yj\255\017\036\232\201\353\241\354\005\350\303\371\001\364\241%P \262\355"
+	.string	"\212\333\026\031/I\316\b\227Z\235f\213\343\266\303\270D\032\316\2256\377v\030%\036\026\327l\360T\305\207\001\037;\250\213\263\300\224\033X\257:J\232\016fHq\361\322\345$\025qx\360\246\264\330@\332=\2347\265\326W\035\355\246\013\205\2341\272\024SVk}\351N\310\235\t\226ht\211\321\341\246,\nU\356\276+\350q\264\223R\304\251\265Z\032\351\220n"
+	.ascii	"\267\335d\333\202\275\002\002\273\300*\251H\216\206\221vP\by"
+	.ascii	"\243\357\004%\334\336|\337\337\024\204QU\245\226\355t\223\313"
+	.ascii	"d\177\307q\034\275K\366\177w\354\275\033fi\221JS*\035\206\322"
+	.ascii	"sJ\357J\313\225~LL\017K\367\247\251Z[\214^*U\b\334\361\337\337"
+	.ascii	"\273\264\237\363\303\306w\362\213\370\225\003d\310\211\020\375"
+	.ascii	"g\342\325\250\036\027\204\207U\301\3650\200\274M\344\373\374"
+	.ascii	"\312i\262y\220\013!z\317R\257H\365*\250\0041n\342\b:\367\276"
+	.ascii	"\273\252b;\027\301\227\024YT*\266SJER\353J\036e\342PM\265\326"
+	.ascii	"\033\377\351P\032|\035\017M\343\341\261\024}\030[\033+\340\213"
+	.ascii	"|v\2611\023|B\227\311J\320'\003l\341%\204p\330\n\375\254\216"
+	.ascii	"$(\304_\216F*\363\301a\273\363\273\232\t\362`\373\336eER\313"
+	.ascii	"\273\260="
+	.string	"Tn+&\355\237\232\274\321n\211\231 \220g\325\030\217\3542Y\356w\347'\345\204\314\262\177\344H\274\304\327\341\016\216\n}G\005\021jD\354\3204P\367\324L\330P\263\343sC#\3433D\033\272\360\003T\353\241\371\344\220\240\001\311\230\207\246\247\006b6\304\341\247\346a\303\f\250F\3730\343\021\0221\2439\340 \020>B\263\241\240 \241\331\313\251~\326]r\370&\227\256;9\201\234\214\255\371\333\250\201\034\214-Q\336F]\344vW\244o\243\342\262\260-\256q\212\026\347Yk\2550SUT2V\274p\351P\2722W\277\253y\035\032.\335\347\222pr\264\317\344@\035\f\0312\320\207\341\312%9\016T\0229 p\002\021*4\017\246\n\224Yh\257\211q\"\306\367\205(@e\254\214F\037\b\373\325\222\213\257\026l\213\200\227\307%\273\264:\264B\2558\037\207;\016\034\355\360$\246\235\035\351\244"
+	.ascii	"U\243q[\326\254\343W\006\323\330\320\327\332i\320\226\274\024"
+	.ascii	"\322X\333\340x\207\026\335\020\356k\311\350\021\330\215\207\334"
+	.ascii	"\017\372sF\304\035KR\036\353m*\331\227&\022\344Aq\037\227\351"
+	.ascii	"\340\331\017\310\025\004\327-#\256w\205="
+	.text
+	.section	.gnu.lto_pidHeadingHold.172.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`:\007\335*"
+	.string	"jM\320\020B`\236J:\375\341ql\217\303v\025\316KZEfH\353\310c\274\333\033\027-\324{\361\334U\355\304\017c\035\253\017\357)9b}\210l\307\274I\264x\335\274\177\036\352\226\272\375\2775B\biR&\031\357"
+	.string	"\345"
+	.string	"\b\001uM)\306\311\345~\272\363\356\223Z\366Imu\320\316\334\274<P\263;\227]\240\255q\274\275\321_R\355w\2734\256eO;}\201gn\265\326-4\366v5v\201^\366n\272\237{\335\002a\rR\355\322m\362\365G\3455t\220\307+\364e\006\035Tq\317\222^\016\354\365X_\361 w\370\325Z\023\274\\\t\350K\"\276\221\211\205\207\352|\270M\356\260V3n`j\255\013V\n}\271\273{\344\335\322\335\2440N\215m"
+	.string	"\022\207\261nO\255\325\312\351H\346K\341\215\314\227\255\344\351\207\350i\226\302\346t\177^a\215\245Qs,\013\373\360\t\375\221\037C~\n\251\316\316"
+	.string	"\271\236\0173!\022\033$t~gdS\310\313\342\r\026\002y\013\225\221\t\235j\255\257;\353(\033c>\257j\255\313\307\262\037_\342w\267\310\356r\355\236R\001a\335ik\303\313\301\314\244F1w\206\214\373\354\024`\224\244\276\334\235\304\330\317\232\235\324\3473\376)\273\333\354\027\237\b\273\334\227\271\031\260=\333\2260\301?\232\350\241\031w\367\215\177\210_2\337\334f^\361\312\030\017\356\356\211\223\001\223R\333\315\372\230\024\005\366j\255\016\302\\\314\326\236\355\345\256\350\342\037\273\314\227o\251581\036\334\031fzl\327\206\306\347\257\262\237\335\2701\356\264\335\013k'\331%\362\" \362F\ry\017\020y\241\206\274\006\236\016\367\027h\032\362\0168\335\227\t\345\025\260\244\224\204t\271\357\321y\215N\336"
+	.string	"'o\321y\211P\336\241\363\n\235\274"
+	.string	"N\336 \224\027\350\344%\232\274C\223\0275yO\223\3274y\313\222Wh\362v\311\313%\357\245\b"
+	.string	"\216\265\241C\346h8q\265\307``U\020*\334\317\002Z'\205rA\201\032\033\013\363%\372\3153_\002\365\353ne\244/\360\354mH\207\305\223jX\237\263\341h\366\246D\3059\300\005\217\303\344ac\004\205\303\302\301^\255d?\376n5\374\315\206\327\251\325J\346\300Mz\205\303\236\315\205\371\022\252\177w\fU\326\362\214\301\301\023\242\3676\035<\200"
+	.ascii	"a\2764\320\357\213\343\345XD\216tyQ\036\027\037<\214\334y\223"
+	.ascii	"\343\331\232\263\323\320@\344\2311Y.\365\n\205G\215\304\027a"
+	.ascii	"\n\350\240\277\2718\3734W#b\004\t\022\346K\001\035\265fv\367"
+	.ascii	"\257)\311\323\253\354\347A\360\336|\360\271C\354\346#\332!\375"
+	.ascii	"\370\374!\231K\303^jA\263\3070\321\036\366\217\032\355\013\032"
+	.ascii	"\377\210\275\225\235\266CvQ\232\264R\013\331\265}\341\244>j\035"
+	.ascii	"\217r0\363\250Q\314\245y\335\257\006\210<\352+1\241\322\331J"
+	.ascii	"\274\367\030"
+	.string	"\246\331g_\260x\366-\200R\364\270\326\032\313\265%#\353\203V\013\257\f+^tiemq\r}y}}m\225\253\305\240\201\n\006(\266 T\r\205\320\342MQ\245\325\005\303J\006\327\212\256\026*\254^te\271\260J\361\025\303\252Ji\275`l}Y\311\360\362\372\262\002\212\023\273\260v\222e4\252w\370\215\221cL\236P\215\340\251#\240\211\365\330N\351)\363\244\200\013\364&/l\352k\271`\312\004\255U\354\307\275\237\007\246k\351\222\224\t\377\23021S'i\033\377\370\324'\320\214\035\266Sz\3064!`\2426j\246\336M\245\244T\370\307\246v*v\330\006h\243\242\016\320&\232\342_Q+\325\031\377\f5Q\263`\321\317\312\365\244o\350\335`\340\200\016\t\255\330\251\203v\366\006\227g@\362\313\224\2360zL}\272M\036\007\335\021\264\272\024\006\007\367\220\325*\006%\324L\315|E("
+	.string	"Z\250O\276\242_P\023\033@7_\021\nP\007m\212\374_\3726\241\357vR,\001\200\213\250A8\304\020RJ\251\021\021\221\2214i\f\220\002\241\031+z\021\220\255Sg\323B\215\326(\336?}\024\034\221\325\017\023JJ\200\016{\246g"
+	.ascii	"\227\216\202\b\362\217\244d\313\372\235\242Pe\274C\246c\200\364"
+	.ascii	"_\253s\3576\345M\347N\247\357l\343\243\201)\030\3235\372\371"
+	.ascii	"\266\301\241\247>\242\230\006\025;\342.\342\002\031:\215\334"
+	.ascii	"F!U\021\005+\005F\230\227\353f\202\016_<:\266{\232\254\030\340"
+	.ascii	"\253\213Ub1\274\032fm\206\261\031.\355\304\033\016\366\245\337"
+	.ascii	"]\017\273~\2545\357\341I\267\2530+\264\271\224\312\036\315\362"
+	.ascii	"\036\277Xe\207\230\3133\341\240@\271C\304\"\206H\357~gb~\017"
+	.ascii	"\356h\030\274d\346X\006cq\363\213\256\245U\342\322\255#\021\200"
+	.ascii	"\256\005\rxW(\374\227\347\372\377\273-\307\365\236\365\314o\360"
+	.ascii	"\377\274Vsse\f`<\275\366\366j\304\005\324\253\037\337\bM\323"
+	.ascii	"M<\245\332a\217\272\223zZ\370,\242\t\003\234\302\313k\212\203"
+	.ascii	"\005\003\316\005\\<Q2\335\206\0305"
+	.text
+	.section	.gnu.lto_pidTurnAssistant.173.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\246\016\355E"
+	.string	"zzd\032:@\350I:\2631%\342m\272w~\373\302\233\372\303b\344x)\250\323\223\376i\203\330E\335\234m$v%\232\346\317"
+	.string	"\265]\365\f\374y\305\346\004\320\272\265\326Z\333DJ\231\002\201\001y\001\237\001?`\344\033(\362\013\020\371]\225O\240\362\271*\177@\345oU\276V\345g\031\371\002*?@\345c\031\371"
+	.ascii	"\212\374+\"\337\252\362\253*\237\252\362\217\225o\254\374b\345"
+	.ascii	"\023+\177X\371\302!\277\n\371g\345\367\311\347\223\277e\bB\261"
+	.ascii	"M\322\243#\330\227\360\322(MSi\244Zh\315\376\331\r\264\273\267"
+	.ascii	"\233g\317\177\t\rz\r\271=;b\007\264\202\226Iv\267\267E\355O\240"
+	.ascii	"3\317\264\317\262\261\243\206\315\017\342V2D}\326\017\272\177"
+	.ascii	"\316dIh\354\254\371K\323t\005q+\362\\\001\302\335\363\037\217"
+	.ascii	"d\365\276\003\300\210\002%W'M\323\343\326\257\036$\377q+o\336"
+	.ascii	"\217dm\304\026o\361\240\233'\311\246S\322\342\030:\246\376\322"
+	.ascii	"T\312\204\255\037\213DE6'\266\374o\235\265\203\356\235\222\305"
+	.ascii	"J\3231\214\006\245)\336\327\275\210[\217\267Z\302\255\304"
+	.string	"\025 \334z\364\347\304\345\226\256a\240\023\370\246\207T\232\246a]f\321\265\252\242:\032\213\304\241\260\236\315\350wm\255\252\250\272\354\361D\366I\341r\"\355\244lacQA\230)rK\034\216\345\255\2020S\264\354\020\313\n\215pX\266Z\301)Od\232\246\313t\343\363D6\212\364\266}R\342\316\004c\274\224:\302\265q\237\022\376\b\211\332>)YN\255(j\226\233\267\354\004\216\215y8\226\246\351y\t7e\177\265\377)\375/\363[]\005{\244\320\234\t\267\262\350en\004<\240\376\344\354\334%/\255\037\211\022&L\b\267\336\350\345\264\204\226\254K\230A\213\305\007HJ\225\301O)\013^H\266\225\316<@\267\223\226\022\212/\232\255W\301\202\205pk\213.\336%\271\271\021\346\366\326j\021\341\331E<\240>\345e\342b\344\332\020\376/b\360.\317^B_\332\230\273P\370\030bS\n\360\205"
+	.ascii	"qY;\231\333\306\317.M?\242\3314\325\226\246I\006\335iy\220\264"
+	.ascii	"\370\237A\203w\331\375\341\013[\257}\373\004R\351[\272\300\277"
+	.ascii	"AmC\310\235#/S\033\007\236\230\246kC\270\315\275oql\334\374w"
+	.ascii	"\3212\262\361E\363\0338x\2278\204[\267\2670\305\005\302\225-"
+	.ascii	"\"\b\243\006\373\230\377\231\301\257c\r\235I\374\3156\257G\026"
+	.ascii	"]\232\246\032\266j\371\221Jr\363G\002\3736o\215|\356\340\225"
+	.ascii	"\002LY\360\307c\343\236\373\367L{\314\177\344\337\330?{\031\033"
+	.ascii	"h\377b\367\366.*\277E\345\2638\362W\354\335.Y\345\217U\376\210"
+	.ascii	"\312\027Q\371!*\037\204\221\377\241\362=T~\007#\237C\221\277"
+	.ascii	"\201\310\327P\371\031*\037C\345_\250|\013\225_\241\362\305*?"
+	.ascii	"\254\362\301\214\374\257\312\247P\371\023\214|\tE~\004\"\037"
+	.ascii	"\302\311\367:\371\017*\337A\3457\250|\006\225\277\240\362\025"
+	.ascii	"T>\322\310OP\371\b*\007\fG\034\320\313\207\351\216\243\234\031"
+	.ascii	"\202\241h\330\352\020uwY\255%\240\263\004t\327\240\362K\232\246"
+	.ascii	"D\254\016\320\253\264\003\320X}\nR\376]5\200\336\267SInR\340"
+	.ascii	"%\272\306M\016?\312\306MP76E\207\2761\023\264\311\326\363[\016"
+	.ascii	"\324\ts\242C\023n\275jn\326\025\3426vCC\237\240Q\242\b\267Z5"
+	.ascii	"s\252\213K\302f\003\257\336\346\241T\210\313\037\265\202b\341"
+	.ascii	"]\036\tApK\327\r:cg\254\342t\213\007\227\200Y\366\324\231^\203"
+	.ascii	"K\376\320-\r\374\3224=\377V\211pkU{\325\335%\373\bR\341DnQ\332"
+	.ascii	"\024\223\234i\032f\304\346\331\342_\036nb\371\005\n\366!Zs\210"
+	.ascii	"I\354\271\263\220E?x3\264W[\364X;\371\251\272l\240\201~\264\004"
+	.ascii	"LV\302\022\347\013\225\214\246\352a(\245\035\333'\031\275\177"
+	.ascii	"\026\231<\266\214\346G\241\254\210\211\224e\354c\017+)\355\212"
+	.ascii	"Mlcw\205R2b\343\246\227b\013=}\t\343a\377\250\030t\216wIld[\257"
+	.ascii	"\375E\017{8\250\004\204\364\2427\020%I}\234\204\375\242\371\221"
+	.ascii	"\322\256\266\260\271\004)\377\222\334,\263\237\320:\f~\350\231"
+	.ascii	"\005D\323|\321\375\255't\315\3216\250\033\336%\352F\270\2656"
+	.ascii	"\006L\217\\ \223,x\007|\346\322\301\353:s\257\244i\200\261\376"
+	.ascii	"Q8\250\034\336\245\213\3367_\224~\201\211\372\306z\367\226\025"
+	.ascii	"\005\302\211\224\034\366\034\235\325\204\332!\246i\233\206o\246"
+	.ascii	"%z\350\235\357\024\271\367Q\"\r\355\304\01633\"E\322\316\312"
+	.ascii	"\272\314\202\364\030B\002\310\220\262\034E3!ei'|\250\245\225"
+	.ascii	"\231\030\222fD\306\0163\265\262!g;\322\320\320t\034(b\246V\006"
+	.ascii	"C\315\254GZ\231\332\361;*\\\340Q!\207\031\007\260+3\2652\265"
+	.ascii	"\030;\316\210\020\257\003l\307\031\22105\037=\316\202\360\b\033"
+	.ascii	"rV&$LGZ\22100\256\243\0211K\013SCCK\013;\342%\367L{\314\307\222"
+	.ascii	"\315\266V[5\202\217\207\016\321\"F\350\235\371\200.\004\235\210"
+	.ascii	".\202\350\020\037\032\304\207\036\206\352\320\0368t\207\r\315"
+	.ascii	"\001\017]cK"
+	.string	"twP7\206Dw7\005u\302|\033\232-\325\325\321\320\314WG\210\252\347\376gh\236s\346\200\254\223\217B\2075\206\f\027Z\2541\310Y\350\n}\241\013\350Q\332\261-i2\034K\350\035\242\205\336\274=\345H\022\005\212\337\254\330\243\307M\005ns\246\210\rb`\035\366\325`_\ra\323\204\246 \241'\364Y)BK`3\234\006]\353MhP\267\266t\006U\203:iG{>\341\326\b\335\233\350 t;\302\024Gg\017\371YYt\3549G\353\265\215\366A{1\231\007\275%\307\301\2303\267\350\344N=\bZA7p\300\240\027t\203>\371\312\030\f\203^D^\316\024!\307q\026\264\210\272;d+H\320\310\004]@\320\201F`\240\017\364\311W\240\r|\261\026t\255\365\374\262\240n<\350\027\227\002u\302\235\nt\353a\272\322\325\334\tS\234\240\033\002]\345L-?\253\036\\\002:\340"
+	.ascii	"\255\325\\\004\032\251\354\265\017\350\255\346\222c\323\021\201"
+	.ascii	"\022\250q(\005\025d\206dDD\222\202$\031\306\201\005\204(\306"
+	.ascii	"\230e\036\021\3404\307\244\232\031-\247$\311\260\033\204z \266"
+	.ascii	"J\031\221\272\371\223\323i)J\247\257Z\242/\223Va`\345oI\252\t"
+	.ascii	"P\351\tm\311&R\200D\316O0cv\313\367\230Gcc\275\230\270/\205\020"
+	.ascii	"\275\237 \271\350_U$\311\360?\334m\001\331\306\355\354\t\321"
+	.ascii	"\266\261\372\373\376\360\211\027\004\370pn\241|\300D\3228\221"
+	.ascii	"\265\204\344\331\374-\027\264\020\241+\244F\260\024.\364\033"
+	.ascii	"\016\027\316\262\247\270\251\250Bq4-\276\026\352\271{\371\226"
+	.ascii	"\002\277Wjy\312\265\233\b,\373\357\232N4\226\273\0059\306\245"
+	.ascii	"I\203Y}@\376\245\361QD\004\356\3725\2073\017\271J\022O\020S>"
+	.ascii	"\240IRS\t\222,\366\320\350\205BD\325'\333\233\371V\022i\256\343"
+	.ascii	"{\b\237\030\2301(@\222c\007\025\006\007\366\276\2108\212\t\341"
+	.ascii	"B\277q\270H\200x}\036\035A\fvF\311\215\210\263U'\342\276Y\323"
+	.ascii	"\017\327\323\201\303$C@\373\033(\214RU9;"
+	.ascii	"\335\327-)w\362\246\366\215l\255\030\2022\251\254\006o\365\r"
+	.ascii	"\b;\371\341\272k\222\277\352\016\331r\bg\236\270F`\227\030\341"
+	.ascii	"&\3401~\242\214\022\213W\372\233\fH\243\231\331\\N\244\344\304"
+	.ascii	"\2635\367\263\"\234N\3031\276a.4\376\216\360\322i\265\352\254"
+	.ascii	"\2622\021l4\243l\266\273\365RE[\225z\341\244!\001\026\260\223"
+	.ascii	"?\242\215\025u\250\326\f\331@`F\275\206\342\222\222\222\366\201"
+	.ascii	"\274)\312\203k\2528\300d\336c1:\225\212\204\343\345\b\225d\347"
+	.ascii	"05\366k\212\034?(\252z\210\306\224\350_{r\304\007\t\273\341\303"
+	.ascii	"\344O\3260Q\356\205y\"\032\231\243c\214\300_\342\022\346\303"
+	.ascii	"\220&\300\373\371\204\365\202j\270t:\241\355\345\364\271\337"
+	.ascii	"\323\214Q\371\007\315\017\223\267nF\244\343Kmd\245\230\322\021"
+	.ascii	"\375\250\376\333yfF^\3313!\233\2600\274\037m\255\325"
+	.text
+	.section	.gnu.lto_pidApplyFpvCameraAngleMix.174.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`m\004\r\034"
+	.string	"\0063\264H\220\232Q:\205\020I\r\201\234\201\274\256\246\n\255D\003\326\330,r\217e\217|\200M\273\242\314\265\374\327~\377]\220\364K\341\034\360\311\266.C\257\025\374\221\347\331\245\024\217\225\352\365a"
+	.string	"\027\330l\340\217e\263\204H)S\237"
+	.string	"\215"
+	.string	"\244"
+	.string	"Ke\315Z)\252\027R\037\316554\t\255\221=\302\333\252\245\2554*k)R\t\275j\255\f\326<\207sM\240rH\211P\363\017a\002o\215L\253S\177\\1.\234k\016Q\t-\377Kd\213\360v\252\305\356\324Z\004\323\244V\243\203+8\327\274qk\2605\317\355\201\255y\336/F\200\213\332\223P$L\223U\232Z\253\255\201,o\313f\336w\261\226\n\207\275-ml\227@V\266\232fC`I\240\330C\315b-\303\030\376\230c\027j\255g\341\220\306\336\334\377\032\376\213\370\313!\001\333#\216|\001\362\232\177\221l\022\246o\324U\224\340\025\256\371-\001[s\373"
+	.string	"\024\321\307\3113\225\361b\312\262"
+	.string	"\211eKe\344o\354q\377\370\267\254]\374\267j\377\263W{\237\235\332\035\260\306\335\032\345\363P\376\016\345\353P>\215\362g\224\237C\3718\224/\243\374\033\312\247\224\177R~\214\362a\224oR~I\371\335|>\371[\200\306\0255\\1cj\235\221dS\267\314'A\266j\367jc\fc\223\315\177\327j\261.\033B^\0057Yh/\024(\242O\307\372\274\022k\n]D\034?\275UU~l@e\303\r\201\227\322\353\347\206O\357\325zp\3621r\247\374\350\340\251\326J\341+e\303-\301ST\013\330\232>\r\240kj\301W\215\022\006\005\305\265x\205D\260V\341\004\354\036\322\354o\223u\362c\212k]\013\266f[\t\311\344p\331\377Q\216Wh6\020\260{\377qe\264\211\341To!\231<\003\254\325g\240\273\354\r\n\371q\362\334\335\033\364\362q\362\265\346\356(M_jj\275\344"
+	.ascii	"\324\216\315B\242\3315>\222Y\335?^\353\270\335\255\003\022R\222"
+	.ascii	"\356\304\355n\035\226n,b8\244\243\023\030n:\234\211[\206\025"
+	.ascii	"JF\263\027=\210`\364`\004\256B\020\r\267\273\355<\024\345\224"
+	.ascii	"\316\023\005\025\345\224l;\022G9$#\333\211\334\315\204\215H\227"
+	.ascii	"\302\026$\340IJ8\235m\227\224\244\263\311\214u\313\332\305\363"
+	.ascii	"K\307\226\257\177\347\t\363c\355\211\212\231\035\036\235\236"
+	.ascii	"\365N\227VA\036?Z\353t\241\365\036\273\210\276\234\236q\311\351"
+	.ascii	"\t]\304\0348\315\365c\315\313\254\333\b\311\3640\360\307\325"
+	.ascii	"Rk\rP\254\325g@\326?\210\020\274B\234\006\nv\3577}\266\254K&"
+	.ascii	"A\251\237\246\035O\2501H\246\2203hl&#%M[\f\260\002\021\241;\017"
+	.ascii	"\022\300\004:\354\230\241\013r\353\377o\0078D\025\223Za\237t"
+	.ascii	"]-\272\363\226\217\353\325\335.\003\206\2403[6\013'8k\225P2*"
+	.ascii	"\250\356V\331\243\302\221Ht b\r~\257\213\247\2261!\303?\273\334"
+	.ascii	"\262\370A\b\203I`\340\f\302f\266\230>X \374\315\341g1'\351\346"
+	.ascii	"G\302\r\314\356\373^\270}cK]\301t$\233L\310\3643\003xDp\237\233"
+	.ascii	"W\013\231R\325\213\353\347nr\201!V\227\021\256h\346L\223\317"
+	.ascii	"\005\321\251\224 \004J<\3169\234\302\316j"
+	.text
+	.section	.gnu.lto_pidController.175.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\005\001\335\r"
+	.string	"\226ZcH\340\2228\035\240\244\350\237b\002j]\236Q$,\257\266\264\350\001B!\202\322CF\f\357\313\315\312\020@o/\201\314\007\373D9\r\235\362\347\211\007\fd\020^\004\243\250\306\233j!\277\203\016t\001Y\254-m\262wJ\001L"
+	.string	"O"
+	.string	"K"
+	.string	"\253\300\007\270\327\317\013l\257\332\tl\257\036m\234\223)v\004\326z\251\221\355nGQ\214s\274F\347\350\213\270R\3278\022\247\232\201\227\211\231\307\265\322>5l^^~\206p\271\314\3311\331]O\226k\304]o\033\202m\r\3663\0040\030\212\203\334VN\220\265\2513V\330\276\375\330\350\323\274\264'\264\243t\201\332bf9(p\257!\031\211}\032/h0\236\374\360I\221\333\352\304\314x\310\310v\311\004\257~\300\275\332!\033$\237\207\3712o1~\3061\034\262K\203\205\214\335\336`\232gY\243\251\357n\212\032\265\235\236\224:\\\346\017\3735\177\201\362U\230C\313<\353\325o\331^O\001\334\300\250f\216_^\004\206\017\021\263\036;\201\330\344j\322\023\366'\b\234\233\022\246/\3733\177\245\323\337\020\304\312\033\261\036\302\n^\td\361\"t I"
+	.string	"M\030F\236h"
+	.string	"x\362N\026\276\025qB\312(\374<PE\200\277\022\006(%'\240\003P\200\013\337\264\b\364\205\244\356\244\222\022\256\240t\243\320c\351D%S\007\032\261H\002K\335I\024K\235\207T\235\276l\023\025]i\334\254\324\001\021"
+	.ascii	"i\221\"34\235\363\256\206l\303\262B\265\n\002\235\b\261u\b\360"
+	.ascii	"]\006@0p\r\264\274\216\3223\256\345\246\304\2431\250="
+	.text
+	.section	.gnu.lto_pidIndexGetType.176.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\346"
+	.string	"\275\f"
+	.string	"\326\327WD"
+	.string	"\221(\035s\314\002Y\242\331\035\324\234\361h\310QT\301\177\017&\200\261\303\216\236\023\364\232\030\003\350\357\017T8\202\302g\342q\266g\n\364wY\364\343\224\350Zr\273\"\370\347\314\\\303\f\355\357\275\245L)D"
+	.string	"D"
+	.string	"D"
+	.string	"&)j\314\371a\005\376\221\217\360\003\344\343\206\370\352\021\256\256\374\216\365\270I9\344\224\234\320\340\272\224/<\240\342B\003\200\216\004~d>\310\270wuu#\252\032\321\234\323\312u(\267\274m\t\266\033\330\217\020 l\253%T\307\267\374k\265\256\372\032\217\b\025(?\2111g\206\031\0343&\266(a\377\023\261;\266\203\027\005\252\367\336\022\342\2169_+X\314\371%\260\201\315\243m\337\304O\210x\365\240\244\325!\200q\005\013\227\24503d<\300]Y\2717\311\341\243\270\313\005\177\204=@\364\334\243\017\"\037\277\036\226\r-\235\361_^\035N\202S\211\331\207\310\335\221\313\013\022\265\341{?\313\213\003\214\2517\354\217\245\273b\037\316\r\316B\013L\241Q\211\001("
+	.string	"\206R\206\202\220i\251\215I\240LKa\037\025(h\026L\030J\233p\302H*\017\fD\300[\252\244\302>\266M\205u\276y\b\343\336\273\200\225\253\353Z\213Z;\0229\272k\2376=\027\003\024"
+	.ascii	"\237\221\302y\241\301\bB\013\365G(\210\355eF[F\b'\231(\034*<"
+	.ascii	"P\325T\200\255\n\3035q\035\023\272T\001\020?G\2749HTC\362\\\n"
+	.ascii	"\n"
+	.text
+	.section	.gnu.lto_pidInit.177.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`*\027\315_"
+	.string	"\332\222\360 P0P\342\031\003.\310v\t\350\236\240\246\302\243\304\376\205I\371\374\240\334\314\344\1777AQ\252\325\205$\336}r\032\361R\301=f"
+	.string	"&q\r\351\372R\t\2030@E\243\022\344V\337\007\357I\210Xr\365\320\322\262\253r{ii\023)eJ)\005\374\001\324\001\377\001C\241\263P\350\314\262\316\253\320Y\025:\277\320\331Y\347\266 \211om\206%q>\376J\332[c0\207\327\312\372\304\254\331\272\231\033\252,\0066B\361\210\306\b\242J{k\024\363XhC\362\307\300\260W(/&n7\35676B\261\320L\272\211\333Nd\364\273|\233\312J\\\235"
+	.ascii	"\303^e\372\206\355\325\273\206\355\025j\311\304mP5\230@\214p"
+	.ascii	"\233m\252\337\253w\252\031G\247\345}\323\226z\345\243!tUB\377"
+	.ascii	"r YC\262\353z\3377\255\325Bh$\334.4\353\376\322B`\356\247\b\215"
+	.ascii	"\204\213\315\271\"\357\373\032{\345F\023\201\331\330+kd\2279"
+	.ascii	"K\2475\337\234\270\036X\320\277\367}\235~\214\277\325\264\346"
+	.ascii	"\033w[D\b\020O\037\234\232<0-)%!\035\031%\213\210\206\204\202"
+	.ascii	"\200~|zxvtr:\340\334\330\324\320\314\310\304 a\216\306\"q(dW"
+	.ascii	"\365\335\345v\366\020\031\337\332\025&[T-\"\004\210\275~Rw\246"
+	.ascii	"jr\317?8\335uS\225;\367\240g\347L\302\022Kt\255\244\356PQ\223"
+	.ascii	"t\236T\027\303\024G\302\"\203\037\325\320FQ8O\026\2755\221\223"
+	.ascii	"&>\364\306\304\205\202\334\032\250-\211\377\270=\335\247\207"
+	.ascii	"\307{@\311\352\373\342B\353\035\247\216\221\234\"G\274\003\022"
+	.ascii	"\247\231\343\2502?\324\017W~#,!\306\345\243mjhz\364L\231\032"
+	.ascii	"$D\213\314ex4=\246\225:\032\t\243\003\207\037[\252\305\202\020"
+	.ascii	"\255\034n\364\352\242T\313K\rzk!"
+	.string	"!Z+8Qh\370\305\245B\013\325\247\350\016\301\226ju\251H wU\375\206\345l\267\365\312\244!\003\022\300/.\037\275\332hUU\322\022wC\215\037K\343\226\225\277\252\224\243\016\005\344\326\f\365\006\017\254\206~\266gmU\271\013K\274\357\313\276\334\342j\036\321\314\377\203\231;`\266\371\317\033\022\200.\271\321R,\267_o\221\n\342\236\271gl\257?M.I_\200R\342s\363\265\026\216\272C\030\316{\311pl\257/\267\364\033\276\372\304o\261\031Y\321\"\027\016\331\027\256\317zh,{\256r\325\323#`MI\221\3773\273F\\\247\367R\375 \253\247b\2166\rx\322\367\345\002\006\007\263X\275\257\222\310\377\277\257\204T\275\377\347]iQ\372 S\323\340\2425\234\336\373Z\005\300\354&\351\031L\f\245\255\227\003H4{\260`{\355og\253gO\2404\344@{r\327V\240\024X\300{\271"
+	.string	"\333\253\001\337Y\324Z\001\034_i=#\327D\213\306\220-\316.2\271\241\265\3568\367\323\201\007\274\227\374O\205\374\021vD}&\267\fv\200\377\257\265\275~\362\211\246\223\321sOF\321T$h\270\346\373Z\0010\245\3752\001w\017\025l\257\003|\317\221=[J\317\251\240 E\n\266\327\022\337pdKJ\330d\370g\262\367\024k\342W\254M\255\334\013s?i(S\334=\270\202\013\274\227\027\260\275\232x\240i\227\322\007\271\237]\224\342\224\276\036H\301\031\020\300-\316\304\206\025@\277\327\003\231\323\252\272\337g2w\277\357\373\362\2071\247\020:\243P\235#P\235O \235\023@:\0330t6\021\343\\\002\351L\300\321y"
+	.string	"\030\347%\030g%\030\347$\2423\222\320\371Hu6j\266\346\344\320\271h\350L4t\036\032:\013\035\235\203\206\316@G\347\237\241\263\317\320\271\347\350\314st\3361:\353\f\235s\210\316\035\210\3168E\347\233\242\263\215\320\271F\350L#t\236\021:\313\b\235c\204\316H\2413\f\321\3718t6\016\235\213Bg\242\3209)\276\257rT\371 N\037\030\021\267\021\221\244\005|\272X8h\253\340\026\036g+\350s\304\305\3021b\203\023\341\351\253\341k\373"
+	.string	"p\341L\b\035\3153yK\333\245\235\350\275\257\262\227\314-\016n\326\002\002\375p\261z|\260v\313\024\334\rln\211\013\007\t3\317\364\255.~\177\311\355<s\033\350<ZA\037oz\231\213\205C\346\315rl\257+\264\035t1\031;O\202\354\251\234\202A\221\201Yj?.u\327-\275\262 \231\032\351\263\\\304\351Py\230\024\330\327\372\266\364Cz\235\347\201\016c\236\311\335\r5\243\262C~\230\215\364mP\251\002\363Ln\022J\030\002\005\2134\377\216D\216\022ut\351U\245\210\342\217>\3135cs\036\246\312q\270f9O\002\355h\206{q\264\003"
+	.ascii	"\314\f\201\257\340b\331\350\275\357\033@\257\354]\256\202K\202"
+	.ascii	"\233\345\322\240\301\366z4\355J~\207wA#\316\243\370\276\322b"
+	.ascii	"\3648\257\001\224\006\037\326\027\245\017v\332\373\276\305g\262"
+	.ascii	"\017O|\317\322\013N\030\301\033}\026\210\226\301\032\375\321"
+	.ascii	"\313Z\02570\247\324\350\333I\007)=P%\336\374\211\032n\343\346"
+	.ascii	"\233\313\324\311\350\240|C\233\217\340\037\212\365e\313OpO\260"
+	.ascii	"\371v\302R\302\216p\t\237\031\245\223\337\322\265\351[\317\270"
+	.ascii	"\201\031\221\376\373\276T\3543\247\330fk\tv(\333Z\035\362\225"
+	.ascii	"\004F\244F\313\306\347\335p\023j\336\003Y\020\232\022Tp\033\274"
+	.ascii	"|I\363I\0353#\340xA\035~5\363M\323\0332V-\270\334\322\017\314"
+	.ascii	"\225.S\346\213\310\236`6b\374\345\350\030\303\275\335\322\017"
+	.ascii	"\371\034\365\230W\345\256\200T\371 \030\026%i\\`\036y|\230\327"
+	.ascii	"\261\273\322b\374\3437\326\027\262\316\301\370\"\246\317Ai\361"
+	.ascii	"\275L\361\270\240\273,\375\\\037\375\347\232\r\375\016\030\026"
+	.ascii	"\217\224@\377r\240"
+	.string	"\005\274\001\214\027-Z\030\200@\324\213\030D\030R\035H5\300A\024\013\026&\220\214\301S\210\f\236VD\005\320\024\363B\n\004\025*\263h\302@\352\003'\030\033h \305A\006N\036H\251\350\300\211\205\213\027NM9\334\342\203(\027N0Z\264p\341dLS\366\2071q,\211\025\345WQ\2110{,\247\223\204\025\276\263\020\317\344\020{O\334\006\211\352(\315\020{\037\270=[Z\372*\020\337Wd\354\311\313\020\"\332\227\330\207g\362\210\262&n\207D\265\224\346\2102\017\334\022QR\032t\362wG_\023LY\020\265O\211\202\207\242\357\037F\\\3205+r\2651\035L\317\344'*J\334:\243\232M\357\211J\022\267hQ\"\232I\237\305\234\364\200I\262\256\245g\372\3327\245K\351\303\330\271\264\314\037_X\2532\035\303\221D\364.p \032\363\222\276q\336\305\202\030\303\367}c\364\332\321^\201"
+	.string	"\002\211\241g\334\306N@\032\372\266\361\304\006\217\222D\0255\373\334\257U[k\241\320.\313\024\304\214\206\370\206\002\223z5\344m)\322\2336\311\273#\242\322Bl~E\310n(\310\315\363\202\350\200\232\322\326\256m\322\342M\021zk\243wqA\317\344\270\026\212"
+	.ascii	"\315:\325N\f\r\210\201\336E+\347S\200\276G\314\371S\327?\277"
+	.ascii	"bmo\316\347d\374\030i\247\264t?\016\305\243\264v\355]\213\207"
+	.ascii	"\307\246 F\244}z\236\373\211\307\271\211\005\341(hE\232=\256"
+	.ascii	"\026\365:\252\251\341\361"
+	.string	"<\223\373\211\277%\365\270L\305n"
+	.ascii	"Q\315\300aG\375r\002F\343e\311\233\316"
+	.string	"\352\3631R\266\301\236\272\266.9\317d\337\321>\377J\330\002gp7g\363\2666\257\275\322N\333)\333\253\317\303h\016\002\nv\370\236_\321b\361%\256Y\317\343L\237Jg7\031X\240\024\347\231\f\263g\223\342\327\262\325\267:\371Y\007\254:\276\222_B\351\201\255\336\244\370f\353\240\236b\223\037\201\375\250\2014$\231B3#\"\"\222$)\244\003\221\005\204\030\345\244\263n\021\3000\306\244*\022\221\202\202$\251\f\007\224\005\212\211\367}J\34318\0016\233a\206\377\223\025\357\361\031\234Y\002E\364\013\364)\266\367\372\245ZP%\344\217J\314tI\274\327\350\251\"X\t\342/J\272\320\270jhi\303a\330\033^\002d\005\207\315#\251\223N\030\r\001\246J\207\301<T\013U\"\021\255\324\020\037\274\255\016V\370\342B\023\362\262\226\352G-X\270\277|$z\343\003\005\363\317^\267;\304\241}j"
+	.ascii	"\251\362\363\265\3545:\0040/\247\250f\315\347\007.\311c\234\357"
+	.ascii	"v\344|h\3002\037\216s\336\220pC5\177\016\004\305\234\373:$\017"
+	.ascii	"\241^\313\205tJ\351\225\"\230eh\302gL\301\020\315\005\265\211"
+	.ascii	"\377\025\2145\261sz\264\201\262I6\016q\200L{\002O\2120\177s|"
+	.ascii	"\b\216^E\022\260R\234\275\254mt7\025\202Z\036\332v\3655k\023"
+	.ascii	"5\013\264D9\213\r\020"
+	.string	"\230\207\2545_\367\t\2635\367ha\314@T+\237H\304\204~\274'\355v\214\350@)\243rB\363\0030&pr\326\007\240\314\347\025\215\3446\n\276ux\0243Q|7\233\034KV\346!s\024\207\247C\273\227\340@\214bc\362C/P\037\0340\232!\036^R\337\340\331\227y\006@pw\350\370\206p40\025\374Mz\272\300@\021|/\224/g8\312\252\305\252\307C\346\320\245\340\211Q\327\336\274&\341\340;\307\265\2418s\036*\311\2636\304\320>\220\306W\3414\273\262\345\227)5\352`\323\036\035\304\220a\265\265\260o\021\023(\231d\370\237iD\f\364\321>\232\372#\326\343\303Ms>\217\361Q\260\336u\370\1778\267\365@\263\331\227\334m&\321\315R\310m$\265\016\f\251\224\032j1\300\241B\b\350@\214x\371$4\204\303\367#\201\341\342\234\376\256\253\353\211W\310\211$x>\312t"
+	.string	"\255(]#-\353BEC\337\200\200\214\226\023h\341+\354\237\024\366\035\017\025\242\243\212\360\376\240>\005\202\326\022\231\237\350\363\350\272o\3562\271b\276\336\347\335\017Y\234{\327\233_<\331,\335\307&\301\304\203+\201R\364\244D\021a\340\033\314\300\261\215Ya\313\357+\234\236$.\235\013\234ic~G\304\330\257\226\341\203W\020&[\272%\215#D\323\331\347\212\213\210O\b\003\336\237\270k\240{\372T\202\332\352\332\322\346\263`\326]\243e\204\365*n2\352QCj\260!C\337\rR\301_\202X\3126\350g\017\271\341(\231%\036\271]\224\370 \345g&\311\375>\307\302,n\021\335\347\206\031\360\375d\323\372\205\036\256\370\356\310@J\350N"
+	.ascii	",\260W\030\"\331\004\322\033\344Y 9\324Q\"\301?\337\004\275\330"
+	.ascii	"\350\320\335\211J)\005\202\222N\200\311H\361\b\032\356^\3430"
+	.ascii	"\335\311\231\366\311\243\306\207\325,\207P\360W#\021\200\f\001"
+	.ascii	"`T\005uSAK\326\f8\343\230\363\2241\373[hj\345\300\242\351\313"
+	.ascii	"\b\004g\302\304qA\350w\020\327\273\210\324\260\\@M\374\351\016"
+	.ascii	"\355g\222\364\260\240\0020\320~&!]\033\020]\333\363I\001\377"
+	.ascii	"\301\036L\212'$\nP\305E\247W\310#8D\265\2775t\204\016\200/G\021"
+	.ascii	"\260\202\324\237Kl~\340\f\210\223\321\b\2155\"\310\322\f8tA\336"
+	.ascii	"\240\305(\370%\202q\341\342RT\3549\035\332 ~k\317\260%\241\313"
+	.ascii	"\n(\277t$V\341\375\001"
+	.text
+	.section	.gnu.lto_pidBank.178.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\276\001E\017"
+	.string	"\006\333bF"
+	.string	"\261&\035p\264\341\032\340>\236v\rU\312\315\242\332C\246\317~B\345\\ov\3261\336}C\276\225qj%\036a3;\276?\206P\004D\221\277\253*\303\226\214\222Os\201V\245\033%\354\313\266\275\367\226)\005O"
+	.string	"F"
+	.string	"S"
+	.ascii	"\031\\<\031\0041`\030\\:v?\315\337A\346e\350\003\346%$\361\356"
+	.ascii	"2B\355\374\263\036\352qA\3110\235.\\\306<~\234b\016\343\001\024"
+	.ascii	"\r\016\001N\245\b\302#\302\306Y\327\227\023I\025\264`w\255\246"
+	.ascii	"\023\314=o\333\201m\005\266\026\b\376H\nG\330\217\273\273\206"
+	.ascii	"3\266\325\240\250\236V\313\250\216V+T?$\340E\203\003s\324kw\303"
+	.ascii	"O\217\335\221:47\tR\377X"
+	.string	"\336\362l\251b5\273\233]\3726,vv\251~\253\305\316\374\023G\321\342\016\006[\022qQa\273+\265\2620/A\360\2543\250Q\305H=-:\370,\216#\301\204\343\346o\300~\363\006\037\236\342\327\260\232\341\261r\274\204\t\265\003\2172\017\001\340P\001+\351\016\373+\356B\361WNY\321\233V\346\345\241\001\225\007O\177\234\311\254\362p.\021\205@\330N4\225\022\222mB\004\215\302\366\300D\023\215R\264\020\002\346NFF\232\n\307\215\264\354\363\036\027\316X\243\204\nAP\341\013\234&@x\220\024\245N\367WJ\364\234\321\366\032>\3625?\033\315\211\361\204\210\207\321\211\370\354\226n\262G\376\202$\264\001& \220\002\0212\354\001d\303\213q\265%Wy\310\342\2444\363\313\317\3544\257/\023\3237\2103\267T\334\2402\301aBQ\\\211{\031\213\020\305\200\267J\374\221\r\255\246-\005\232\nq"
+	.string	"\242\205\323 \241\255\037@\212\230p\321\004/\013\203\234x"
+	.ascii	"\016\nk\377\251\243F\013\241"
+	.text
+	.section	.gnu.lto_pidBankMutable.179.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\275\001%\017"
+	.string	"\246ZaE"
+	.string	"\321$\035p\202\360]*)\023\225LDE\214[W\373\215\245\315\376(\212\326\024y\341-\351\201\005\2043\212\324t\"\237\237F\340-+\214 \"\251\365?\032(\331\223\275@\275=\375\341\200.\215\354\275\245L)M"
+	.string	"G"
+	.string	"S"
+	.string	"\026\270\030\004,Z\027v\220\346\3742\1777\311\307\322\007\310\307\375\360\355\021\256n\376Y/\305x\241\222\321y\025\036_\0169\274\227/<\240\022\332\020\300k\201&\"\017\255\263\256.^J\365Z0\347\264v\236\206[\336\266\003\333\nl-\020j\303\376R\2724\366\341\334\031\333\352\013\252\245\325\021\252\241\325\272\352\227\004\370\334\360\310\\U4g\206\244\033s(\002\205\310I"
+	.ascii	"\342\337\312IX\n\255\216\220\346\234\330\243\217\263bc\217j\263"
+	.ascii	"\330\230\177\363\021,\336\026C\2459\247\207\n\n#\357\201Q\243"
+	.ascii	"\"\037\257=\353\f\202VG:E)`|\024\347Q!\3214\271'\214\236\363"
+	.ascii	"\006\336K\3740\"\\p\254\031\267\351TC{\023\371\005`\243c\324"
+	.ascii	"\2425\354\233\370\216\211_\343\223\024}\227\"\037\277\006V\034"
+	.ascii	"8M2&3\003\026\371\350\200p*\311PDBN\022\"d\023N\017H\262\017"
+	.ascii	"\324I\326A\300Z\t\b*C\3214T\206}\334\341\334\031+\214\253{\255"
+	.ascii	"\256\213m]\331\242\003\267)\030\201\266\007\201\374\0075\362"
+	.ascii	"V\364\221\037\216\376\320 \212\201K\343\025\233Gg\207\274\347"
+	.ascii	"\024' \220\002\0212\354\001d\341e\2651\256\221\244\026\276\231"
+	.ascii	"L\306\206z\211;\315\006ry\237\013\226(\312\202\r\327>*dp+&.m"
+	.ascii	"\021\254h\361V\211=\262\241\325\264\245@S!\016@\264p\032$4\177"
+	.ascii	"\370\331E\035\205M`h\322\226\325\036'2\200\333\303\332\177\352"
+	.ascii	"\250\321B("
+	.text
+	.section	.gnu.lto_applyItermLimiting.part.0.243.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\b\001}\f"
+	.string	"\306\327S@\020Q\225\016|Y\351)\256{\250B\001,\354\332Gf\342\215!\n\336\307R\301\037\360a%\033}\034\036X<F\304*#Z\027\200X"
+	.string	""
+	.string	"\206\006\332\250p}\252"
+	.string	"\n\272\n\2641\242\275\245L)>"
+	.string	"@"
+	.string	">"
+	.string	"\330\007L\036\355\263\260M\262G\376\231\330\224;{\304\302aK\013Tt@\201\350\330\335\354QK\274\273&\354|OU\272\376\365\364T \236\002\016?\034\354\256\261\020w\274m\215\355\006\366Q\001\252\351\374\367\237\222\".#v=\224\360X\022q\006\n\333\267\377\"\331\025\377\325\331\025\223\356\032Y\276\375\220z@#A\346?\277\305[\335]\243\007\330]\325\220\261\373!x\364\005{\364\367\002\223\307\027\362^T\003'-\331\026\375\005TJ\252\352O$6\206\2038\004\333]\215\357BC\006\377\304\243?\232<\246\036\310\3212e\211\017C$\305\215\315\035\251,+<\\]\331\232\216\232\206\232\016\356d\024|2\021<\f0"
+	.string	"<\334\206\203\320\321@\2309\230\216\006\312\270\t\0224\n\237\314\202\266\251\220qB\242\fc\361\006\362\2042n\333BY\345pu\205\211\254\260a\322\rVU\226\355\2501\034B"
+	.string	"\207\366\360H(\t\325\336\002\030"
+	.ascii	"\237\2212A\341\036)\232\030]I{\023\261\n\036\220|\025\343U\255"
+	.ascii	"\214\2519\246\022S\244B\001\344\201\021\256\030\213\266\200%"
+	.ascii	"\004\306\263\344\373\214\335\031\013\270K\\\346\305<\371\332"
+	.ascii	"\202\007"
+	.text
+	.section	.gnu.lto_pidResetTPAFilter.part.0.259.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\216\001\325\016"
+	.string	"\306\033`C"
+	.string	"\223\223\016\263\002\335\212\203\2238=f\277\036\340b\027{\350Ti\357\252\206\rs7\001\264(\177\333V'\364\261\346\232\"\375\3075\311i\211\204\005t@\207\220\277\227H\365|\211\r\2735B\310&I\246\024K"
+	.string	"E"
+	.string	"R"
+	.string	""
+	.ascii	"\004(p\221I\342E$YO\307\212\326\255\226\026T\267L-\310\3174m"
+	.ascii	"[J\324\324\356\370\205\212\364\315\352\245FHfr~Oa\223\217\230"
+	.ascii	"\251v\313\236\016\346\344\177`L\030\003\030\323\034df\267\023"
+	.ascii	"\356s\333\005m\021\264\230 m\360z\365p\311D\035\300\377V\261"
+	.ascii	"H\341\253>\3366TAP\370\252\007[\322\007t\347k-X\251\237:\302"
+	.ascii	"\243\345#q\b^\246\307\214\345c\332c?\031\326s\354v\254\226a\263"
+	.ascii	"\207}\030\026;\366\307\"b\0354|3\241B\b\335\2052\277\326\302"
+	.ascii	"\005tW\003\252\237R#V9;\332\267\354\332{v\277\024)\006\31701"
+	.ascii	"N+r\315\211m~d\2720\220\021\002\245\236a\311\374\336\215\243"
+	.ascii	"\3432\f\307`\251g:JyuJ\346\207\3356:(z\303\252\025\020V\006\025"
+	.ascii	"\225d\030\251p+\033PF\0344p\036F&\0358Q\t\004W2\240$\225\223"
+	.ascii	"\022\267B\"\2258P[4\226\217)\205\0359\250\247zc\277L\333\002"
+	.ascii	"\370\311\201\343\001\004\021?\325\363\017\001l#H@w\236\233\206"
+	.ascii	"\304E\202\377v\273\\#\264e\242\334\325\001& \240\002!#\233\007"
+	.ascii	"/\022c}\003\275\020'\034\f\316b+\303\337f\260\376\b6\\B\242\365"
+	.ascii	"\030m\035\213@\357\265\215zcR5\331\315\200\311wF\271@\204\347"
+	.ascii	"1\263\037k\\9\032\374\024\221\331\314\351\254\266\247\006\024"
+	.ascii	"\026\332)\233\r\200\267\027\222S:\375Z3\006"
+	.text
+	.section	.gnu.lto_isFixedWingItermLimitActive.part.0.261.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\230\001\r\020"
+	.string	"\366\234hH\360\260(\035\362\3321\351\031\f\017/h\250\345\275\275\330Hm\373\361\311\274\362\210\320l\315iE\333\013=\217\333\031ua\323\376B\324\f3\016\277&\264\260t\031\272\326\254u<ri|,\364\301j\352\371\220\354-wJ\001Q"
+	.string	"V"
+	.string	"Q"
+	.ascii	"?>1vW\301\247\021\210>\017\274@\367)"
+	.string	"?\240\373\264\257\302$%\226\314\266IJ-\273\036\342\304\b\324j\310\340\204vC\357SM\334u\215\322\345G\330\f\206\353o\207P\023\273\001\233\371\360\030r\t\240dw-\002q\317\333v`;\202}\035\001C<v\304\224q\242\005\313*\2714!\216\207\327t\370\261\t-L(\362\334yVV\251\206\f/\022\t\200xbB8\024\335\3379nu\026\376\250\345\202f\266\335\035}\372;\253\3737\226=\362o-{d\226\f\227&3AQ\322\370\320\317\271N\353+\354\343\217\335\027X|\232Jq\344\202f9:~\317]\200>\315\026P\3610T\367\251z\0334hp\177 B\300\214\036\031\207\0249\256Q\017\024#\364\212C\376\355\"%6\356\210zc\225\227\2536\266\243;GO\215\2263Z5:>\374/\222\265\036 \263\335XV9\031Y\22022\001\245\001\t\244\005\374R\037\n4Y1})T"
+	.string	"\233H'\237\213\227R\241\360UH\361Z>\t,\236\351\204\362H\006\f\272\240\234\274\024\b\236\274\321\345\252MH\234\332\351\006\333\235\272\344\245/\2527\266\245F\235*_\310\330^\374\335gE\264\013\303\300\207\021& @B#\035\361\006Zp\b\023\250E1\022\024\370\250\260^D\213;\202\202\020\266\215k-\n\204\250nG?\036\231\r\3602\003\3072\020\365a\256p\235Q\350`\210\336\205?,\340E6Z\006,Pg\213\342b(R\031\006\271n\023\372\236"
+	.ascii	"\3050*\003A\016\2448\372\332\202\007"
+	.text
+	.section	.gnu.lto_pidIndexGetType.part.0.267.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\357\001\345\021"
+	.string	"\366!xG\340\360&\035\360\206\230\230\377\b\035\240\271\234c9\nh\t/x\177\230\375\350hc\235\340H\030\203\272\331\320m\356\261\305|z\2232\313\307\005c\214qe\006\004\212\351cT\342\007rt\305\244_\247i\215\354\275\245L)e"
+	.string	"\\"
+	.string	"a"
+	.ascii	"\b\220ndE;\346\254y\217!\007\221\217\360\003\344\343\206\270"
+	.ascii	"\353\234\214p\365\344\362u\366\321\234\373\210\331\334$T\320"
+	.ascii	"\342;J}2\b"
+	.string	" \b\307\211\356\313\240\261\213\331(\315>\017\207p\204gI\007D\006\210\033\335W\243\233\372b0d\316y\333\365\346\203\251\n\370\211;\231s\372\257\235\033u\3335\266\035\330\032\022\272>\336\323\341\334\036[\252\271\250\226Q\035\243\032\276\366/T+T\037\245?#Ks\342\334z\314\0171\211\204}\233\214\335\371\266\031\273\263\314\207b`m\222<0J\260\372\332\207b\214\232\223v\004c\316\032\311\243\r\234\036\355\013\311\330\005k?\337\006\333~\212\253\230\261\013B\354\365\005,\346\322|&Z\220\225b8%\340\005)\267\025\027\256\\HC\246\203\212+\213dI\3611r\027\256\352\220%\301\214h(t\316I\263\353c[D\352\242\020\331\250\321&\273\306\234\027\221_\335\313v`z\263\277\342E,\376\b\263^\364\263G\377E>~\0330\355\274\364\346\333~\0214\0233\246\362\bV\231,X1AQaP\022"
+	.string	"\203\212\252%\202j\345rrJ\211j\345\342\301P\230\260\252\260\342\265\254$\260x)-\013^I\001\263\\TZ\036\f\213\325\362:\333z8\267\307\004f9@\362.\236\232q\340\211\277K\336\366w\230\345"
+	.ascii	"A\337%\271\275\261\315\255O^\013\343>\206bhx\201$\327G\242\020"
+	.ascii	"1\035\240\t\355OS\016\244\330\351\004' \220\242\251\322:6F\240"
+	.ascii	"\001\245P\034$\361N\035\227\327%|V$\367\353\006\221\035g\231"
+	.ascii	"k^W\324\332b\260q\307+\224\366\265\355\3504\035\361`O\344\301"
+	.ascii	"\b?\006P\017(uT\217 \230e4.\317b\306\361\2421v\267\r\334\345"
+	.ascii	"\003\026f\264*\3269\262\330\205\235"
+	.text
+	.section	.gnu.lto_pidController.part.0.315.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\262\017mP"
+	.string	"Z\206\f\035S@\324\345\244\003\377\222\236\356\"[\\\276\307>\347\031>,zJ\244\007\335\022!Q\372\n\r\311\340\306;7=k\034h\264\247\265\305\340\310\223\276\330\323m\266\251\233\003k]\212\337\213\021\212\266\003\334\006\177!;y\266\224\207(\323\3755\265\226\020\"e\222\001\276\001\227\001\264\001F\234\035=\213\022\037\301R\205\253\355\227\273\362\262\275\031\323\307\310\226\351/\264um!u\320"
+	.ascii	"\364+\037\333[\251\301J\2255\276\032\251|\026\246k\t\222\205"
+	.ascii	"\334O\035A\240\217\375k\377\204\016\"OPY*Q8\257/g+\344\2348\332"
+	.ascii	"O\331a\234rt1$^\220X\267:\300r\334\023r\217\262\273[ Wbo\354"
+	.ascii	"(\267+*\256Z\353\216\351aJ< \261B\335\253\255\215+\350g\005I"
+	.ascii	" \034\037\312\236\2117\001\344aJL\254P9^KT\341j#!\367\323\206"
+	.ascii	"\237\203.\001d{\377\305\264/\036lw\313\364\257t\357\365'\273"
+	.ascii	"\373\231\243\313\223$\202\240V\312\343\005\271\2379\332\200v"
+	.ascii	"\357\265\013\334H\217\204\020\336\217X\237pVJ$W[\255\304\240"
+	.ascii	"\237\013An\231Lb\335\202\312\241\005\210\371\304}\223;I\337\265"
+	.ascii	"\306\215\251\265\312\021Qj\2555~.\001\271\237\274\357\240?\315"
+	.ascii	"\347\240?w\317dw\231\2406\335\365rbV\365\351z\022>i\253\265\n"
+	.ascii	"\375\354\036\266o\022\2771\234~G'\007\347\306\246\206fFf\247"
+	.ascii	"\213\311\341\320\323l\346I\367\272\250\337w\200\270N\316\020"
+	.ascii	"P?0\316\226\017|\263\245\3056[\257\311\2421yT:\360\214\314\324"
+	.ascii	"w&\020R\n\026G\203\312\301\334y\nbx\260\307\030\002\n\007\326"
+	.ascii	"\2316hP7\230\t\220\r\341\030\036\214\330\360\\\f\034n\b\211\021"
+	.ascii	"\251\2434Q"
+	.string	"B\223g\346\304\247\r7\037\345\234\303X\323\226%\242\216\274M \252\262#4QAsG\213U\227\203\235\213D51\343\234\0077Tk\335\003\203\370\366|\367O\273[\265K\023$\027\240?\317\266\241%f\366\033\2607\263\256\265\376\316\306Z\356\240\237\354\271\266\256-\241\221\203N\243\213\254\331X\275o\273Ri\277\265\030h\300\037j\200\376\354Q\313!\312\237\225$3~'\244!\211\222\255\017\345;\244{\013\224\273\373aNG4\361rw9\370\025J7\262v=\270\025\037\3248\326Z\033H\236\r\204\375\326\317\rA\004\376P\004\364'\367\r-'@^\356\301\336\246\240\005!Q\254\322\215\265\273B\320\267\t^jA\376\262\005\274IA\353\177\235w\303\273%\364\370\303\367\243\252\232\372\267\\d;S&\353\203\240/\276\241\224I\200\ff\017v\235\220\255\2122Y\031\f7\3266\317k_\355\322\240\341\025"
+	.ascii	"\307;C\206W\306\2167\206\311\313{\361\013\303\344\r`\206\367"
+	.ascii	"g\206\027\200\257}_\314\360\272\230\341m\341\203\343\355a^\236"
+	.ascii	"\035\346\325a\336\034\346\305y\332\367\206ymt\27458^\032\034"
+	.ascii	"\357\214\f\257\314\216w\367\262\257\356\304?\306\344\315\231"
+	.ascii	"\2748\223\027e\336\363W\276\246\216\267u\274\374\257\357\207"
+	.ascii	"L)Dj\250j}Z\206\251U\247\230\020/\376_\377\225\277\354_\373\241"
+	.ascii	"\374[\376\263O\261k\344\005\211Y[\301\032\264\273\273\306\n\206"
+	.ascii	"\354d\370\371\264\353v\277_\343\242vDZ\250+\240\257\251a\251"
+	.ascii	"\035wVnH\2566\030\236\266\217bw\313tt,{-\207\002\267\203[\230"
+	.ascii	"-hD\257-\273\300\215\243\243\t9\261>]\214(\314\235e\331\021\027"
+	.ascii	"J5!a+\237\233o\231\376~\350\317\026]C\353YK&\272\3062`-\347\323"
+	.ascii	"k\2324\332\354\"5n\266\004kA\376\222s4{\bl\312\031\320\214i\254"
+	.ascii	"\305e\201\005N\247\241\240\272\336\361\351_9\340f\373\364\235"
+	.ascii	"\250\232\310\256\203|\263\022\001\363"
+	.string	"tO\357\246CR!\177\310=K%<DX\007\252)\323l\230\204\200y\264\360\\\355\304\220>\361\207<}\034\252\234\372\267\234\332\351\227\345t\372ei[~\263\177J\230\005R\211t\200\203k\374\027\234\253\234\336\247\2453\2444\360\207:mV\251\376mM\347\364\235\2207\215\323OsJ\002\307\314\320n\372i\347\255\361U\273\271`\255\300\0316}\323\034\3464\304L\333\264i\346\204\214\342\27212(>B\223$J6\231\376\2263\203\331\232\036\262\3014},|$\235\312\325\n\374p\331\b\317\220\332\200C:5\205\352\220\356\300\037\326\364\315~2\251\032\322\2775\233\246\227\207I\231\236\351\246\"|\343\247\324\352\313\007vS,\226!\355\341a6\325\342\030\322\037\356\345Xk\260\001\030|\244@\354\267\214\320\2372\375\245\232\3302\021\036\032\245B\244JR%\350\317]\337\213\232\024\220\227K\234\256_v\336"
+	.string	"\034SDj\004\177\250k U\301\376\355\217o\312\023k\255h\0204\327I^k\270F;\327\235&\224\3025\372\204\277TP\263\321f*B1\037\026lg\357\246K\270i\215=G\006\246Lt\216?\227+\377\322&i\027\016\034a\303$\220\227,\374m\2156\036\330\225\340n9\b"
+	.string	"\3630\024XpAED@\226\214~\364\350a\360\003\311\005\243$$\037:&\n<\214\226\224\316\245\242\036I\275\035EK\275$\235\222Q\013=\323\203\r&(Z\352u\320B\357H\207k\301\b\203^R\321QO\002\026T\320Q\244\364\301\217\036\017\234\242\245\336\222\007D) U\320\343\207\021Q\257\310\207\315\022)\300\300\t\n\230P\364"
+	.string	"\0025;\210xy @d\244\202\320\222\217\036F)\234 \364\303\250w$\304#II\b\001\237ER\241(Ih\t\t)Ih\367\327\276\332!`7\355\224 @/Ca\243\317\353\211\257XD\177\n\3201R\006 \211B\253:\"\360\214\276\022\334\004\016\032G&\230\360\205\311\350\031}\341\033\220\227`\320\352\26349\311yj\205\312h\031\036v}F.\246VO\333\365I\341/\337\224cI\271R d\364\323\324\234$\021\243\217E\255\177Zq\361\302\341\365\223\0370\001\367\215\241\273>+>2\376\220\327iUPW\034\033r\003\003\211\315\222\310\206\306\001_\t&\342\370\311\352\312\342\323\022\254\002\255\356Y\255\265&\200\346/\031\244\371\244\340\017\003h\033\310\246\376\021\033+\007E\327\224\320(s/?\227\307 \273\324\204\306\035;\035F\027\371y\255\367\271\241"
+	.string	"\364\317\222\376\321\025\335\220\312$\214~q\206\235\214\200\241\350FT&\227\212\026\253.2\215\345\345\313Dp\021A\324|\\\370C\037\027\364'"
+	.ascii	"G+\212nU\312$;\375\305\013\251J\305\256\244\006'\021\"\215b\001"
+	.ascii	"\307\364\213\336\373\250@\337\205\177\360U!s\334=\200}H\231\374"
+	.ascii	"h\255\217\315w\005O\330\277\256\027\375\265\363&\340]\237\322"
+	.ascii	"\007\206?|\321_R\325\304\245\tZ\335\025\200\272h\023\274\372"
+	.ascii	"\005\240-\332E\007\201`\250\2214\306\224R\204dDD$I\222t\361\004"
+	.ascii	"\304 (%f\036\021`\265S\214F\222$\311\260w\355<\242)\365\343\375"
+	.ascii	"\323x\230\363\317\272'L\322\025\331\2606\313\321r\347)\256\376"
+	.ascii	"\313\036F\300\355\242C\342&\360?\225\203)\231J \375\206\252\363"
+	.ascii	"r\274/QR*!38N\231\227s\244\20299\344\266QV\033\233I\336(\332"
+	.ascii	"\026\323\347^\200Pc\225:\333\212v0~\341z\002"
+	.string	"\3541\374w*\247\356\321*\360\357jy\232\307\315\333\265\016\224\016\323\251\271/\357\336\305\226\235\037\314W'\"\275\344TZ7\331c\213\301\321\241z\333j\t\327H\262\255\205\213\374]=\242\244\244}\037\320A$i\375\330t\234\227!/\306L*\250Z\357\210\375\364\2222\337\271\210\244\310)\222\226i\257\331d\345\246\324-\034\315W\367\267\265q\235\246\322\267\224\250ji\272J!\334J\025GC\206\316\2009\2224\375\262\270\257\025\307\205\263\301\367\364q\031Nt\335\325H\261\371\177-\330\nmG\234\234#\317!=nH\224\235\257\335\373(\324\233\005\366x\007\023\277\364\310\r\206\370\302\230\367\311\254\362"
+	.string	"\224\005\017\304\351\364U\331\002\300Y\371\370\272KGN\372w\204\200L=\337\230\352\t\037Z\321\024\201\276\224Q\341\333R\002z\367\265\363\261\217\2013\266\241cW\307\"\311B\3407\364?\201f4wJ\374\376p\346\341\240\360%@12W\231\030E/ztC\257\037\200\326*:X>FJ\345\211B\032!\177\271\306\na\020s\203\\\026-\242\201b@\017\002\211\035\034\027/\023\223+{J9\001^\262I\007\305#\334I\236\361\271\325\223Cc\031)\334\376\341\246\371\244\177u\024\2271\276$\333\271\323W\206\227\317\324E\377\306\313\350\256b\257\373Q[^i\361V\231\346\301\035\262\005\204\301K\355_\354V\215\240Q\177\241\266\240\024\345\346-Dwi\n\265\314\034\242\017\200\005xr\357\3077\260\314\302"
+	.string	"\2601\271\033aB\342XI\312D\f\235\314\372\b\314t\021\326A#\204]\274\263k\215\3657\307JfXK\371\027\2733\021~^*\033\203\351\351_L@O!'5!\212\250\266\t\330\343\002\273\353\004\242|Oxv\006\337\222\360g1\240\013`H"
+	.ascii	"^\206c\212X\2179\226\375\\|&L\351 \365b\356#\313\f\367\0033\214"
+	.ascii	"\026\256\020I\344\n\216t\035\234\2614\307\253\321\261E;\030F"
+	.ascii	"#|\373q\311\272\211<\301\177\216\206\327\032{\231j\251\342\355"
+	.ascii	"F\215\356\016\275\272\034\333\336\312\363\324z\307\373o\323\203"
+	.ascii	"bG\221\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\372\02157"
+	.string	":U\234\022<0\246Nc\324\353\244\026\fmt\r\320\023.\326"
+	.string	"\0240\323\222\275\352\257^\277\272o#\202\245\324\016i\305\027\255\025R\266{\327\r\004y\276@\f\002\\\003(\240\320\002\241M\344N2\034\001\020\001\032\001F\366\253\f\213\354S!\262/E\035\262\037E\325\317\257\234hU\220\005\325\246\333\006giL\023\257}(][\225\242^\310\276\331\033d\253bj\202\f\270\276lC [\r\373\261\177F\365\261\017\253=\262%\036\271\322\272c\337\214\252c\337\251\346\310\201\\\373e\324\255,\tG\216t#CZs\266\221\037\2559{yi\321\360\221\325\365\345\225\265\245\324\312\216\262\356\326\310S\032\357[g\234O\306\301b\344K\r\362$\0309\323\213L\350\"Sj\221\007W\375d\2211\255\310\205\353U\354\223!\246\330\367\202"
+	.string	"\305\276\240zb\177\213j\342w%\366\333\250$^h\304\t\255\332\025\361\274\020\373h*\210\343\371p@\036n\267v8\224\303\276\0265\303m\370\253!kZ\261\366\313\324\f\247[u\316\177\237\030\262\242\365\302\376\231ja\177\212\252\247\323\351\264\302\376\230\372\244Ca\037\215:\341q\fn\007\201\204\317Ys\316D\267\331t\331r\3369C\307>t]\327\275\332\277\242\346\234\217\204\001D}#\367\0215\024\034]u"
+	.ascii	"c\374\343ZY\361\375\203\275Hk\304\367OS(\351O\336[\265\332\376"
+	.ascii	"\2367\373z\334\354\317\245\355\347A\333\277\323f\377\311f?\316"
+	.ascii	"\331\276\2345\373\211\\5\373mi\366\351\240\331\207c\266\3577"
+	.ascii	"vf_\n\357#2\263\037u\356\357\225\331\017Df\037"
+	.string	"o\314\376 1\373\202\302\354\373\001\263\377\347\313~\235\227}>]\366\373\334\345\262\017\347n\331\257\343j\331gs\313\366\335N\366\2605\313\233k\316G\272\276\274tpay\2235\347\254\257\254\033_8\274pt\321\340\n\222\377\312\375\312\237\254\303\261\3755+\373jj\225\375CT\366\337\246\354\353I\3317t\367\351\346L\365(\373\361\241\354\277y\262\357FU\305 \001z\271\223\375\264&y\323\305.\367w\253nj\330>\033\265\271\277fA\376[\017\266\257F\325\371n^\264\016\367~\032&\373\\\334%\317\262\346\351t:U\262O\226$3Z\221\354c9\262o%,\313\262,\313\262L&s\370F\316)\246\376\033\274v\265\370\216\251\237\026\377\317\233\301\3773\217\311d2\231L\346r\271\034^\260\271\324\367\203\337\244w\336\245~\333+i\271\\.\227\313\345r\251T*\207\017T\352\373\275o\261\233\364\002"
+	.string	"\355\270\345HJ\3754\370y\223\036Y\235\214\247T*\225J\245R\251\223\304AR\366?]\327M\016\265\006\223\303\253\365M%\365\315\244;\336\234\227\324Q\315k\327u\301\n$\365S|\007b\364\310\362\243\244\016\300\227\324\305h\022RR\277)5\245\017K\351;*\240\213t\305\377\335_\031\241-)\025<\365^\253\371s\246\226\031!\3651\006D\352#\374\207\324Oo\024\251\213\3613 >`\300r#\244&J\245H\035\005\025\037\265\361\375;\352\"L\227\001\217\272\353\316IoI\243N:\352="
+	.ascii	";N\263\254\310I\033\2457\240G7\230\0279i\242\223\350\244\221"
+	.ascii	"\001b\243&\306\211\214\372\361_Xf:\227\375\212\032\353:K\213"
+	.ascii	"\272\370\362\005\371\3515\302\2009\220&:\253r \375\270\b\031"
+	.ascii	"\220\206f;]\244\354w\241\3037\377b\206\352\247\270\272\f\325"
+	.ascii	"G\370R\206j\002o\206\352\344\033\315P}\2400C\265\2158\243s\253"
+	.ascii	"\317\351}~b\312P\375\243\017\231\241\3069<\261\234)C5\021\347"
+	.ascii	"\037\r\273s\314PMu\227\353\364\201:M|\363\036\325n\220\217\f"
+	.ascii	"\204<\247\265\372\236\361\270Q\224\226\263\234\326\212\373\200"
+	.ascii	")v\205k_\226\323\004*e9\035\025_\212\222\025\272\214\227\345"
+	.ascii	"\236\320\340\266l)\313i\"\034\247\211/\234&\302|q~\352\367\335"
+	.ascii	"\212\355\n`\025\005}\347\313\204H\334%\005\022\377.WL\365&\245"
+	.ascii	"P\360\340\325\036\341\225\306\312\223\2564U\034\253!\223\030"
+	.ascii	"\311\373\\\247\207\226\227)Yi\257\250\225\346!e\245\241\234\020"
+	.ascii	"\254t\321\221\225\306\232T\245\211\201U{UC\301\252\266m\207\352"
+	.ascii	"Y\\\253\217IZ\b\023\306\255~`\334\266m\333\266m\333\266m\333"
+	.ascii	"\262,;T\317X}Lq\341K\b\263\372\213\244,\313\262\001\201R\250"
+	.ascii	"A8\246\264D\"\"\"I\222\244\003\001\006\204)f\306m\021\240\220"
+	.ascii	"\223\214)E\"\"\"\222&\035P\033\315W\200&\263\003a\005\201\255"
+	.ascii	"l\350\377\241R\370\203\273\205\223\231\340\344\202\305\016u\032"
+	.ascii	"\177\002R\001\363\n\232\357\272\351\302\371\214p\232\236q\001"
+	.ascii	">\024`!\214\377\215\204\024\364\310A\305\02454\005 \323\317\031"
+	.ascii	"\333\206\300C\264\025\331)[V\266([&9\367*\265d\203\275H88\360"
+	.ascii	"\372\2646\245\027-\265\013\331\202Y{\355\3534\363\300\264\242"
+	.ascii	"\231\374\307&\365\321\334/\372\f-?\266$\225\323F\307\223\374"
+	.ascii	"\027\362\246\373$\375\222~\275\\\256\327\353Z\243\203\227\353"
+	.ascii	"\204\367h\371\242|j\372\022\372\243\241`.\327L&\023\th\007\320"
+	.ascii	"\306\362\200\002L}#\001H\313\215\277\217;Q\307K&\223\211@\035"
+	.ascii	"\365i\253\343F\372\356\003m\204\276\016\016\307\343q,\221\303"
+	.ascii	"ct\304\333c\220\220/\207\3143\200\344\327\3655\220}\312:\031"
+	.ascii	"\323o\370\245\221\023\007fI!\035|r\376>?\336\300i8kR9u\376\341"
+	.ascii	"\377mnf\016}J|\357^\274;#\305\353\001\017\031\244|\315Yb\332"
+	.ascii	"\267\206\315\030\370\203U8~\274@'\\FQ\243\240Q\320(h\2101\375"
+	.ascii	"\036>\305\230~\017\237\207\317\303\347\341\363\360\317\375k "
+	.ascii	"w!VQ,\026w\007\345]\342\204r\256\357\333\3030\362\264YEj\200"
+	.ascii	"\223]\320\363\005e\244~\031M\376WC@\236&\2346\026\307\361\231"
+	.ascii	"\034\214H\"lM\331@\317\264\2233\030\230\266\017b\357\2527zK<"
+	.ascii	"\216\335\257\316H\330\267\247\035\246\334\304\346\256\340\323"
+	.ascii	"\301U\312\3765\022\335\333&pyx\376\035\0200}\325F\034-_\355\b"
+	.ascii	"k\202\275~2\3220\330\031\373M\240\313~\245\355\270R\313\206\217"
+	.ascii	"\274u\307\027A\262=\r\262\033:>>\276>>\371m\334h\370H\314!\211"
+	.ascii	"bMe\255\227\337$\360\265K\274#\252\232\030\255\245o\267\256\363"
+	.ascii	"\"_\225\200\362\256\316\005'b)\220\021\271\315\236\314\356\202"
+	.ascii	"<e\023M8b\253\315\256>\272+\254\002"
+	.text
+	.section	.gnu.lto_.refs.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\t\ne#"
+	.string	"zF0\rF\220\232J\206\003\204\311\263\032\243=G_l\223_\266~l3C,\250\017\001  a\3256e5\"\021"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324{(\237\307\314\003j\324\035Jq(\216\326\374\034`qD\255\325,!\245}\033m\313\024\250"
+	.string	"\346"
+	.string	"\270"
+	.string	"\277\233\230\266.M\3755\246_\313\231\360/\213\002e\376K\246|\261\340/\230\3375\037k\376\325\374\246\331\203SN\324{\241\245\376\243\364\277\244\367!\275\317Q\347\031]d\365_\326\254\364\247\322\373\305\372X\375\"\340\003\215\377#z\236\336C\274\203B\277\024\364EB\037 \350\201B\275\027\324{\200\272\016\350\237\236\377\262\373\321\316\306\337L\374\231\214\277`\374.\361\257\372R\300G\222\017\340\367C\276\377\355\336\247\367<\362u\306}~3\215\2774\376\2218/\267\320\356\177=\363\344\016\366}\325\345\036s\277#?\327\317\275\250\013\\L\353\306\r\364\336\226\234\267%\327\365\002\271\345\017\037a;t\340\2501\343\353\305\212\023$Dxp\223f\f\030\262\271\326J\226>z\360"
+	.string	"\033\320e\216\033S]\322\220\352RF\214\250.]@u\251bvi\342\350\345\210\020 \346\313\016qpomT\232,\231^Y\213\3357\2670m^\272\260\251\245\241])\2232|2vd\210\016\0332\b`}K\220"
+	.ascii	"1\345\345\340u\305u\337\270i\263&\r\2322c\334\300tYKC\273\342"
+	.ascii	"DI\222\"+\346V\006\256\23386j\340\316\220y\023\323\306Em\213"
+	.ascii	"\226,V\310\304\232z\22141}\277\252\344UqbRm]$G\214\020\031\320"
+	.ascii	"+$\310T/\020\251^\037aQ\275`P\2756f\257\214\243/\214\026,R,}"
+	.ascii	"?\314\357\20685i\236~3e\234\002\272\207\205 \227\017\373\240"
+	.ascii	"K\341\016zwt\306\227\n\024s\306a3\306-\f\0276\264*\243\250@\374"
+	.ascii	"\256\307\372SRoB \027\312_\022?\351\b\300\220\374\240\307\372"
+	.ascii	"\317d\3357\331\213[\362\235|\235x\003\341\362\2612\350<\263\353"
+	.ascii	"f\027\310u\372R\\\201\274!\022\364\347\300Y3\266\215"
+	.string	"\b\344\247M\251\222\017e\224\027\230r\252\361\237\3067\232r\337\370\273\361\256\237e\357\003\275\"@|\340\260aNT\037\016T?\016n\226\001\363Em\2742g\037\312\260\311\330|\004S~ \370\\\363\265\346O\315\227\232\037\234\275H\370D\363\203z\377\233\2757\345>\363y\363uS\006\237&G\371\232\\Mf\320\301\220\2337^\310\3350\035y\303\300\254\344\005\323\222w\307\r*yod\311\213#F\221\2741\256\344\375\332\214K^\024\233\365\226\020\277#F<U\204W\275\236z5\214&\257\0069k\221/\307\351,\362\3318\365\325\300\211\3753\242\357gcS\3332\026\371[>\223\217vV\346dv-\245\216\205\324\253\b\364)\254\016e\324g\260+\t\350\351A\343\373\214\277\323-h\255#^\241\313\004S\350\277m\346%\rK\2252a?\312p\311\256/I\371Q\377gv\340e\337{\330w\300'"
+	.string	"O\220%\034_I\374\235\207\237\003.\201\347\b\275\347(\362\200\325\250A\224Edh$\b\005\005I*\255\001\340\242\252\221\250\r\022`~ARR\377\377\252;\361\020\266\273w0w\222a\365NT\342\013'\212\347\032\310Z\b\262h>\254\334\0017"
+	.string	"\306\020\266\222ltN\223\240\003\373\307\r\360a\232\341\263}\352\210#\355mA\246c\315\377]m\035\003\262t\253\357`"
+	.string	"\337\366Z\350\254x\r\003K\235c\251\361\231\337\004\202l\337\230\2377e\260\363\377\016I\330\314\004"
+	.ascii	"\001`i\201\357\343\373fLm&\235\232\312\244R\020\227\356\034%"
+	.ascii	"\247K\353\021\217\240c\351A\263\351\273\201\334\030\223&\220"
+	.ascii	"3\316\347\037<9E!x>\346\374\230\323\035\341][\344\244!!\006\215"
+	.ascii	"-\341\366\n-.\213D\254\004vh\250\021\210 H~\271\360i\035\310"
+	.ascii	"\261jF#\3063\023\204\0308\\#\0303\301\203\3209\215\346\234\020"
+	.ascii	"\027\262P\217e\356\360<p\004\r\035\341]+r\3220\301\244\213en"
+	.ascii	"W\201\003a\206CR\206\001,D\032*\325\003\324\267\366\242R\251"
+	.text
+	.section	.gnu.lto_.decls.2fbcc39cf4c403b6,"e",@progbits
+	.string	"(\265/\375`\025\260%\233\002\216\034\004\211\016R\020(\205\3514\006\300\325\023\242EL>z\336\363\272\031\270\356\333\n\363e\351\261}\250\266\275\376\335~\340\250T\215\n\032\\6\020\004*@\255>\004F\001"
+	.ascii	"\b\004A\257C\240\211g\030\206e=\336E\035 H\022\301\311\3042A"
+	.ascii	"M\204\310\275\267\334R\246\217\f\210\016#\017?\306\202\276\241"
+	.ascii	"L\224K\017\2039jzJ\370\366n\366\260\351\305\271\n!\177hG\177"
+	.ascii	"\210\247?\024\243?\304\242?\204\242?\f\323\037\366\320\037\322"
+	.ascii	"\320\037n}\241\236\276\320\214\276\320\251/d\242/\374\241/\274"
+	.ascii	"\322\017\366\351\007\331\350\007\271\350\007\327\364\203J\364"
+	.ascii	"\203^\372\301*}\340\035} \033}\340\026}\271\033\244\036\bE\037"
+	.ascii	"\030\246\017$\242\361\363\006\251 .\220\372\346\020!B&{Sy8\377"
+	.ascii	"G\277P h\020\364\007\nv\235\250\020\324\307\r\224\013m2\327)"
+	.ascii	"`TO\033\230\351\316\r\331\331\251\252\253\206\231\216\251\347"
+	.ascii	"\336MT\b\272\003\365\352aj\356\253\325iFW\r>T\bZ\303\252\253"
+	.ascii	"\006\037\260\355\251\357\2120\037\250C\243"
+	.string	"<\320\256\353\024B{\230q\262\332\201\363\2015t\b\366\025R\337w\205\324\377\360\350\377\236\032\345\302\350\026\232\343(\027\212\343\034|p\341\023\312\225\367n\272\327\202\236{-H\341\2164\255\251\371\277;\375\037\235\376/\213\376/\211\376Q-\032\351\026\\\017&k\231\2240\262,\254\240\0349\036u8\007\333\252\312\350\256\254|\356\312\260\272\240Vh\325e\233\322\021\005g\224J\bUbd\213\025\234\377\003\242\317\232`40;L\034&\206\206+l\314\352\013\b\2213)uw_wG\230\370\214\215\315\023\2231Y\313\023\226\204\352\211\317\326\362\202\b\2111\204\031\204H\327\023I\016f\220!=\226\314x\356\275\247X\031\363\334\273\211\261\270\201y\356\275\311\314\360<\303\216\240\321!U\245\314S\352\307dJ\246\236\370\013,\f\007)\302\343\271\367>K\303j\250\032\226\246\262F\207(\215\034\236\342\024\363\225\207\177"
+	.string	")\202\303\230h\256>\310\303h\360\231\272/(\024\226\203\337\240Q(\023\316\203n\034\007\323\301}\350\f\374D\245P'<\007\343\301x\350\023\256\203Na8\270\r\332\204\306@e`6\230\017\337\301z\330\016v\203\367\256\023\347a5\307vx\315ss\357'|\226\207\243`\265\236\247\237\375\004\306\207\215\374x\n\025;L\226\207\313\244H=\367n\002\255\246\266\232&\344\377\2544p\356\006\2517\214I_\273\321\327jt]\017U\035--8_\217\241\303Z\360\034\332d\236\340t\366\304f\256\023\323\3417\241L\305\265\003N\316?\346\322\206\263\3402j\233\032\251>\234\311\be\267)\264\0308_\307\351\177"
+	.ascii	"g\244K\0303\256\b\033\376\202\3456\323\033\017\226h\001\253\303"
+	.ascii	"\007\006\213\301cp\230\353\304_\260\227\333\034\326\250\023\203"
+	.ascii	"\n\230\257\233\350k2}=\246\257\305\364\365\021\215\267\020\035"
+	.ascii	"s\211\262\323\004g \021}\335C_\343\320x\356\006\251\033\\ \265"
+	.ascii	"\202\013\244^G\351W\271A\352W;\372+\236\376\n\244~\335\242\277"
+	.ascii	"6\321_\277\364W)\215\237`(\327\351\0017\377{jn\266\275\233>\277"
+	.ascii	"4{<\252\340\374u\353_\017\252O___\337\365\240^\245\323?vr\214"
+	.ascii	"\306\266\367\336\020\324\232[\303\2053\007D\307NT\263.>\350\340"
+	.ascii	"|\325\251?w\201\324\253P\364U\246\276\212C?\275\243\237\316\351"
+	.ascii	"?/\220\3724M?\r\323O\271\364\323(\375\034G?\257\321w_ \365\317"
+	.ascii	"\033\244>\213\321\317Q\364\363\021\375\314C_\254\013\244>C\351"
+	.ascii	"\243p\364\3211\372za\037\036\206t\3228\231a/\274%\345\206\253"
+	.ascii	"\016\316\277iXH\360\024U\223\250\273\365<\375\354)'4&\035\206"
+	.string	"\272tx\013\313\270\033\252\206\245\001\252.\355\271\367>\226\232\341\344>\211\361\244\203\254;\2076\337\264\214\265#O\234\003\357\300<\260\016\334\205o`\034\330\006\356\201\271\256\023oa\032\307Z\270\306s\030\274\205\255n\033\332d\256T\300\314\236hUw\256\247\351g?9\235\321\341-|u\347z\232\232\033k]\023\353\252\301\267w\363\003\346\033s\253\322\220\357\334\rR;\\ \365\250\022}t\210>\312C\037\305\322\307}\3728O\037\217\321\177\233\242?w\203\324\3433}lD\347\035\372\307O\031\350'.N4\354\204\233Zlm=\301s\334\204\231\256\327\206\036-)f9p\276yn\337ur\300{\373\\\275!NY8\037\327\320 \330\373rPo_\337\345\240\3365\242_<#\030\371\321\344\016\207\225\211\226\036A\354L\340\323\274Q\365\243\016\035=\345\306\013\024\316\377\245\303\207FQy\355*{7/"
+	.ascii	"\263L9\262\003\3479\315\247\275\267\220Z\007O\023\017\234\217"
+	.ascii	"\267\276p.\230{\327\223\356\375\003\217\211\006w\343\350\374"
+	.ascii	"W\357\356\3358W\316u^8\027\357\227\315ms\374\013\345'\272pn\224"
+	.ascii	"\253\245\251\217\271\367\276O\340\334\274\373\274s[$\324M=\205"
+	.ascii	">|H\247\266\254\231\002\346\347us\333z\230~\266S\335\f\346\233"
+	.ascii	"\353\274\317\237\203\017~\233{\243\355\275?\ba\271\273\036Ar"
+	.ascii	"\376m\243\177\355\364\365\272Aj\206\013\244\376v\321\377o\232"
+	.ascii	"\253\346\332]4w\315u\336\273\343\346\336U\316\220\251\273mwn"
+	.ascii	"k\204-vO:3w\256'\335\333kM\230{w\305\334\271;7\244\204.w\317"
+	.ascii	"\275\233\377\340\256\fs\357\246\320\207\017\037>|\030\216\301"
+	.ascii	"\013;\023\346\3376\375;E\377\232\351\nn\220z\307\\2\327\231\301"
+	.ascii	"-\363;\345\246=mj\356\346\336M\037l\004\217\2255\234\177\305"
+	.ascii	"\364o\006*\332\327w3P\177\275\364\320\rR\177q\304\271\211\343"
+	.ascii	"\213\273oyL\271\373\345z\271\316\033w\251\364?p\273m=\350\336"
+	.ascii	"]x\230{7\177\323~\"-W\312\315\322\203\356\335\224\207\271\367"
+	.ascii	"~\007?\321\317\301\007W\313}\273m\035\234\366\356\"B\001\223"
+	.ascii	"\232)"
+	.string	"s\370\366n\376\277\\n\227\273\345:\257\226\3776\257\332o\363\303\207\017B\270\253\312\233\033:\177\005}\024\364\177\251\374f\371\357\332e\273m\032\330\373i\357\275A)\3065\005\347[\345Z\271\316\t.\226s\360\301Q\246(\033m\357\246\3170\317Y\036;8\277\004-\034\372\275r 3\373\203\373\350\337\t\324\333w'P\357\024\242_*\377ur\321\200T\254\255\346\256\262\367\366A\337\342\240\356\340\214/\220\372\237\026\272A*z\201\324c\355\341\006\251\351\005Row\203\324\237\013\244\376\334 \365\315\033\244\352\013\244\376(\024ZG\205\362\377\371\377\315\257>\371U\f~tG\3320G\235@\325\250h?\272D\035\241F\340\344\307XT\240&Y.\f\n\202\037\337\375(\020\365\fuS\3152\300C\310h\340\377\245\205 ?\375\360\220\020Kx\177J\227\202Q=@{\\\205\nYi\202_\207!3'\201>"
+	.ascii	"\325\255R\231\250\314\377=?\360\203\024\350>?0\203<\201\007\344"
+	.ascii	"\n`d3\277*\226C\270\034\310u~\224\205\013\006\003\033]\247\373"
+	.ascii	"B\315\340\312\270\373\206\340\266\371\202\274\201\332\001\272"
+	.ascii	"\205\017\225\321A\b\355\241\206H\363\277\370\377\332\376\334"
+	.ascii	"\244\"\t\001z\305\364[\177\024\n\225q\267\3068I\265p\244v\346"
+	.ascii	"\374\267E\352\365\253G\324\260\037c\301"
+	.ascii	"v\331\313\237j\375\252\221\037\247\360\337\343!\021\370Q\037"
+	.ascii	"j\221?\r\362\247B~\225\bV\363c4?n\363\3434*\204TP\207\374\230"
+	.ascii	"\356\"~-\301\237\337<\341\023?V\361c\025\202\334\313\375/\300"
+	.ascii	"\377\033\373o\tj\ni\013U\310\022uD\220\377"
+	.string	"\033\376\253\360\226\341_}\334\003\371S\272\037O\251C*X\246\322\366\323\361g+\277*\244\362\337\325\361\277~\200M\357\376\024\357W\277~\264\013\332\003\3079\307T\301`\324!l\244F\340*\262\004\252\017bn\037\201_\357\235\351\327m\017\301\257\245t\301Y\206\324\255'\177}\326\246b\035\306\257\307\322)\352\325\237\376W~\354\305\002\277:\244Z\375*\325]\374\032,\237p\237\027\220\205*\027|\345\177\031L\005\335@\376@e\3721\334\217\267\240I\270-\005\252\373\307_\260\333\217W\374\370\355\307Sy\003\034\345\307,\016\363c,9H\rA\224z\"\177\310\027\244N~u\0046\372/\004\202\037e\341\177\007t\206\372\001\017\374\252R\345\300\257\022\377\253p\026\277\026\221\205*\005~\\\345*`\272\007\177m\200?/\325\t\374\031\304U\270[z\315\237&Q%\360c)?\356\201\265\250\021\300t\027\376\272"
+	.string	"?\306\362\3477*\004~\314\366\343\251{\201{\371U\025\377\341\374\352\n8\005\230\232\342Og\250\017\370\257\227\037\223\370U\024?\372Fu\300\177\333\250*\3749J=qKPS\370\321+j\003T\023*\003\324\241\017"
+	.string	"\017\301t\227\300\277j\371\257\005Z\330\177\312\364\253(\274\003\312\252'\374x\310-\370\327\261\377Z"
+	.string	"s\371q\333\217\307\340-?vb1\377\255\200\272"
+	.string	"\265\304\177\257T\022\350\022u\304\217\256\251&\374\030Lz\347O\361\374\252\210\364?\252\245\226\240*\340W\363\217\247\324!5\00142P\373S\240_\r\201\207\230\3758\220\225\344#\377\363\377\263\300\177\205~\264K%\341\336\213\205\320\262\377B\377\252\224\026\251#\374O\243\346W;\030"
+	.string	"_\231k\370W\251\253\200\345\277\377\267\302U\\\377\277\005T\340O-\360\253\b\270\n\367?\003\374iQ\025\341O9\360\247\312_=\300\177\025\356\017\374W\034?\216\3731\231\257\377\217"
+	.string	"\177fA\r\341?\232\307\371U\003\230aI\207\376\017\240\303/\374\372\313\237\261\360\027\234\005\325\312+\250 `*\377u\221\352\251\037\374X\353\307 \370S0\252\007?\256\361\343\251\037\257\375\030\007\006\320\f\250\035\240=\266\374)\227_\345 \203_%\372\257\342W\207\336\341\377"
+	.ascii	"~5\304\257f\360g)\020\376\037\320\177c\374w\351\277\311\377\312"
+	.ascii	"\370\357\376\357\007\376\033\202\377\266\377}\361_\020\374W\352"
+	.ascii	"\277\310\377F\375\267\351\277-\376\353\201\377n\340\277N\377"
+	.ascii	"\205\361\337\031\377]\376\327\370_\246\377>\375\027\352\277,"
+	.ascii	"\374\327\305\177;\360_\016\374\267\205\377\036\377\253$\376\327"
+	.ascii	"\350\277E\377\245\300\177-\360\337\013\374\267\002\377\315\300"
+	.ascii	"\177\021\360\377\303\0174\361\247#\376\324\304\237\242\360\247"
+	.ascii	"%\376\224\304\237\236\360\247\r\370\323\007\250\003\370Q1\251"
+	.ascii	"\t\177*\342O1\370\317\017\344\372U\001\374*\005\277*\301\257"
+	.ascii	"f\370\325\364O\361\374\351\234?\335\373S\274?5\363\247a\376\224"
+	.ascii	"\313\237f\371S*\177\352\344O\231\374)\331\237\n\371S\037\177"
+	.ascii	"\212\343O\265\376\364\352O\247\376\224\351O;\360\247.\376T\371"
+	.ascii	"\247\033\370S\r\374\251\005\376t\205?}\300\237\246\360\247\030"
+	.ascii	"\374i\004\177\n\364\247\301?\275\177\256\363g9\177\326\373s\232"
+	.ascii	"?;\375y\314\237\315\374y\356\317d\376,\367\347-\177n\373\263"
+	.ascii	"\225?S\371s\373g\265?\233\375Y\311\237\217\374\231\310\237\277"
+	.ascii	"\376\254\343\3175\376l\3743\326\237\245\376\374\364g\030\177"
+	.ascii	"^\372\263\322\237\221\376\274\342\317\031\3703\006\376|\201?"
+	.ascii	"O\340\317*\376\374\200?\237\370s\003\376l\342\317'\374y\001\177"
+	.ascii	"\016\341\317 \374\231\203?\017\375\031\304\2377\370\363\207?"
+	.ascii	"{\370s\006\177\026\300\2371\370\363\005\177\256\340\317\022\374"
+	.ascii	"\271\303\2375\374\331\347\317\303?\257\177F\177\264\357G\355"
+	.ascii	"\374(\234\037\325\373\321\274\037\275\373Q\273\037\025\363\243"
+	.ascii	"`~T\356G\273\374\350\226\037}\373Q\347\217"
+	.string	"\262\375\350\223\037m\362\243f?Z\366\243B~\024\310\217\036\177\374\200\037e\177\024\351G1\360\243`?\036\362\337\254\377V\375\250\217\037\355\361\243]\377\275\377\347\374\350\216\037\345\372\361\334\217\342\370Q\033?\252\365\243Y\377-\341G\257\376\273\365\037\313\177\025~\224\352\277\377_\346G\245~4\352G\237~\024\371\243J?j\374\321\244\377+\374h\006~\264\002?J\201\037\347\375\230\356\307\020\370q\211\377\n\371/\215\377b\375\327\352\277\025\374?\361_\n\376\213\376\027\377\267\363\237\357\177\235\377t\376\223\375\017\363\177\203\276\276\276\276\237\202\013\374\023\240\177\033$\272\312\035\037N8\257V~je\270\234`\246\036&\2340&*uz\205<\315\257Q\232+\333\205\242\265\256}e\013~\371\342v\004\347\307\271sP\310\266\202\340\374U\215\212F\241\017\355\353\023\264U\306\177\366\336N{w\361X\265\352jx\370\232\366"
+	.string	"\220i\n\240\f}m\362\353\\\233\254=r\224\315\024\\\263\322Uc\275;bC\016\316\017\200\227\036\356\r}53\273t\204\242l\032\030\352\270dt\361\355-\247A\260+\n\017\035\316\017"
+	.ascii	"\224^\201nh%\262\026\371j\344\353\222\377:W#k\331o\357\275\267"
+	.ascii	"6\323\233\003\300mayX\313\334~[F\260p\376J\266*\371\177\351\021"
+	.ascii	"+R\364p\376\005x\364\327$\377\177=[\230\31428\257c\032\352\002"
+	.ascii	"9\031h$G\232@\205}\035\373\312\214z\372R\202\363\212d\025\373"
+	.ascii	"\312\\\217\254L\017\274\366nZ\231>w\366n\362\271\327\202{-\310"
+	.ascii	"M\300\304\256\250\371\027\274\321\267I\3645\314.K\213\r\234\177"
+	.ascii	"\301=\376\325\335\204\265\367\246\2216\367\233\223P\375\357o"
+	.ascii	"z\257\207\177x\321{\301\377\374\023}\231\300\336[l\302\366\336"
+	.ascii	"\027N\217\016%I\260T\260\377?\357\275a7\277\262\242\2366\323"
+	.ascii	"\215b\373\312\212b\373\302\272\020%\346+k?e\231=}y\335\250\247"
+	.ascii	"/,\254\247\315ta\263}aE\355\257\254\237\315\266qD\26151\335\250"
+	.ascii	"\247\235\265\367\327\376\331QMY\233\255\211u!\212\355\013+\212"
+	.ascii	"\355+\353B\024[SV\324\366\332?Q\315\037X\273\371\305ta\212\255"
+	.ascii	")k\263ye]\330l_YQu<\306\204\324<\301\250\342\260\215\265\335"
+	.ascii	"7QO\333\252jG\023\326\317\\T\323k\333\355}\253@m\254=\267\367"
+	.ascii	"\005{\357\360\302\262k\302q\337\234\346\254\234\2604yq\250r\002"
+	.ascii	"\363\332OsLw\317E)\361\332[\211\023\213]\265\367\336\03605\347"
+	.ascii	"6\221;\307\364c\307\246\202\332;\202\335\334\273jo\246\273\347"
+	.ascii	"\366\336L{\357\025kGs\357\034?Q\314\252\252\275\267\204\252\366"
+	.ascii	"\016&-P{\343*woYQl`^DZ\246\2601\267\214&\323\215\242\362\332"
+	.ascii	"\314m\367\205\245\331\230\3246\325\336\373\356if\226\226\336"
+	.ascii	"*D\312\030.\234\177\301\016\275\002\021\316y\315\210\202\363"
+	.ascii	"/\260\241W0\240\233s+\013\347[\320\247W\037b\336\222\340|\013"
+	.ascii	"\346\350f\360\255\313J\r\234\327\256\274/N7\234o\301\032\035"
+	.ascii	"\353\216\237W\216\265&\234o\001\235\016\004\240\r}\345\272"
+	.string	"\316\225K%\363\333"
+	.string	"\n\231\005r\332G\306\320W\034\316\025\007nJ\237\366\217!\352\026*#r\370\366\336\322\240'\255J\330\035\316\267`L\213"
+	.ascii	"7\364\325\206\r\022\234th\004\230\031\372\252\245\225R\t57\223"
+	.ascii	"\002\366\304\364\314,x\322\"\314\r}\315\272\3165+\245B\243\366"
+	.ascii	"\2461\224\246%\246\307\267\261\2604x\005o\264\325z%\214\001\345"
+	.ascii	"\210\2204V+\325Jg\352\f\035\316\257 \313:\265\316\310g\244\250"
+	.ascii	"\335i\255Rk\024Z\006\017\036\2715j\225\341\363c\313\216\225\025"
+	.ascii	"\352\253\f4\2663Uk\f\364\211G\030\033\265O\275\2632\251y\326"
+	.ascii	"\275:\255M*\236\353\\\237T;|X-\017\035\254v\353P\201\305\231"
+	.ascii	"\255Oj\234\224\016\332\034\333\373G\227J\203\n,\216o\316\007"
+	.ascii	"y\250\300\342\370\326'\365M\212\207\252a\225\250\233\222\243"
+	.ascii	"bQ\201\305\231\255Oj\035\001\360Q\201\305\241\255O\252\236\n"
+	.ascii	"\247\203\324\336_D\324\032T`q|{o\241\224N\032\336\017\f\371\025"
+	.ascii	"\204\351W\340\245_A\226~\005M\372\024\350\351SPF\237\202,z\317"
+	.ascii	"\307K\234\036o8\237\202(\372\0240\365)\020\242\177\365\351F\312"
+	.ascii	"\214&\034n\204ow\240n\344"
+	.string	"\345-J\036r|m\330\304\321\2513\003g6x>6\306\362\344\270\273\212\3476\\2\346\355\013\316\352\232\267\021\223\204L\215\235\232\036'\261:RT\272\253j~\214E5\243\246\301\350\256#\307\ng\265N=s\235\207S\321l\237K\304\013\023\021\234OA\017\375b\357\275\357\341\324\365p*\3367HU\347\210\256\322\001\240\rN\013\316k\0312w\234:\230X%\363\253b\3241)\2350\033\331\243\223\201\263\b\315\033\244\256C\3240(\327\352$\016\254\n\030/7\266\244\341\334%\215\223\322\351\340\024\205\002\032\233\247\332%\275\243\022\271{bQ\213\330=\247\250]\322:xj\027\365\210\232\245\203ST~+\303E\325\242nQ\277\250q\252\234\352E\205\273N\265\213\352v\034\246\276=\371\236z)\234;W\205\004Z\233g\227\364\315\336\234;|{o\035\245\t\253\013\206\254\0010G\267\005\307d%\371\302\371"
+	.string	"`\203\005\212:\245\203S\024\nr\240<U,\352\025\325\212ZE\245r\235\252S\025\273jD\r\273\020\032\022\265\254\207\351\302\336?\2360Q\313:8E\241 \227\366DS\235\252\031\032\232\352T\317\324'wn\253\271i"
+	.string	"\325\220\311)\373\365\300!\207%\314l\252\2245`Z\220M\206\363\001\260\204mM\265\341\025\027&\312\325\265\347\001\245\246`\361\201\263\252\246\216\371\220\331\340\253\302Ym>K>\2132gG\226\377?=\026'U\206\363\001`D\377\352\0235\255\204\033\036n8\243\001\255TAQ\303\371"
+	.string	"\350\241\235\250M\202w3v\036\316\007\200\226>"
+	.string	"\250\364\001"
+	.ascii	"\245\017\200\255.Q\333\\\211\302\207\363'x\243*Q\311n\022(:;"
+	.ascii	"5\311U2\224Km\016s\b\316\217\243\216\375\377\t\321\324Ak\303"
+	.ascii	"\371W\307T&\016C\205\n\216\353T\231\252\330\377Mg\313)\017\316"
+	.ascii	"\237 \215\376\004f\364' \243q\363\006\251\036.\220\372\t\340"
+	.ascii	"\264:du\202S\326\206\363'H\323)\036\325\252\016\035 \252\220"
+	.ascii	"\353T\203\374\351\217\324\216\032D\275R\177\334\271*\231\257"
+	.ascii	"\316\323\207I\n\225\226\232U0-nk\304p\376\004A\364/\235\352C"
+	.ascii	"\315R{\334\271*\271I\233\347\227\352u\235\252\017\325\207\212"
+	.ascii	"\025\254Z3\263\303L(\345\251yE\315]\300;N{c8\177\202.\375\016"
+	.ascii	"l\324\230Q\367\005\307\341P5,=\005\f\314SK\325\241n\2519\324"
+	.ascii	"\035*\217\353T\271\324\033*\227J\203m\003'Zw7\370>\254]f\344"
+	.ascii	"\336\204\371\035\372\364;\314\321\357\360\324\357\260F\277\203"
+	.ascii	"\031\375"
+	.string	"\016a\364;t\321\357\260\246\337\001\212Z\225\236q\216\211\202\363;\b\321\377\325(\025J\235Rg\250R\252\214\353T\251T\252\264\017\345\362\231\2523\263\203\017m\247pz~{\177\215aJ\341\254\231\331\301\247\306P\3338\231\331\301\367\244>\371L\221\231\331\301\247R\245y<\364<5w\326\352\3343\263\343\203\032\304\251i\243'_\0029\252S0\017N\026'8_\2022j\323\207h\323\2151n8_\002.\372\022L\321\227\340L_\202#\372\022\004\321\227\340\206F\367\rR/A\225N\345\244s\256\363aR\2767}z\326H\311#\303\371\022<\351\337\207QCp\037F}\004z\351\336\021\020*]p~\004k\364#\360\242\037\301\025\375\b\324\334\260\311mg9\326p~\252\246\347\351g\357\"iO6\351]\212w\347\252\344\262&yi\233\353L\331\374\003\007\340\220\261\033lR<\\\346M\027\037\316\217"
+	.ascii	"\212"
+	.string	"\376E\253+\362vf\310\333\232\324.Ms\235\251\232TM\212\206\312\032\331\r>!\222\246\030=\235\037\201\017\375\bz\350G\300\303\f\035\0239\033Q8\247sK\256\334\320\340\374\bh\350)`=\230h3\230P\372\230gV\314\364*\305bB&\246\307\347%\215\002\346\t&\335\222\312\245V\322\265\324\231\272\245pi\\\372\226\206I\253\244l\251\226tJ*%\365\222\226I\251\244W\322\266TL\332%\315\222\222I\271\244X\3221\327\231~\371\323f\252\206\257\210\331\303S\276\2060\253\236<\323\335d\345\331\204\212I\224F\244%\246g\226\301\3440;\206\332\006N\234\304\364\370\316r\210\245\333*\333\3455\271\017U\303j\200\323\025'SL\263+\346\223\250\247\232\364\0136K\277\244KR&w\256\312\336Y\033\220\221\211\351\361e0\351\227<\006\203\263:1=\276\254\263\364\307\323/)\220TI\bPX\f"
+	.string	"\333\361L\277\244:R/T\rK\303T\035\222'\236\362%\365\221R\241jX\f"
+	.ascii	"3\362$\373\222r\245[\250\032\326\tkf\031\314\227L&\247\351\340"
+	.ascii	"\024\265\233\276F8\343\"\246\307\267w\363\203\234\0169\"\344"
+	.ascii	"s\260\323@\315\033\244b\263\013\244\236\003\032}\016f\3649\224"
+	.ascii	"\321\347\020F\237\203\027}\016]\36498\36594\365\237\226=er7<"
+	.ascii	"\224\013b\346\004g\fE\364\264,\377\220s\225\004\347sP\242\311"
+	.ascii	"\346\b\031K\203\3639\f\321\277hB\322\"!@a\375f\254]=\203\324"
+	.ascii	"m\245b\351X\232$Er\235)3\r\023j\356\375t\237\244\314\364\b\327"
+	.ascii	"s\357f\312L\215<K\bPX?\031NV\317\275\233A\034Nl\204\001\3639"
+	.ascii	"\350\320\347p\245\317aJ\377i\221\224\b\227\215\030m\316\273\245"
+	.ascii	"C\242x\2511\367\336?\302;8mUp>\207\030\372By\364\205\340\350"
+	.ascii	"\013\241\321C\027H\275\320\027}\241*\372BLz\330\t\273\252\302"
+	.ascii	"\371B@x\\g\332\225\356`bv\211=\367\336B\037\32015*\"9_HK_\310"
+	.ascii	"I\177C\034\375\rjR\034\034~?\254\310\246p\376\0062\372\177j#"
+	.ascii	"\255q\235\351\215w\220\336H\265R\252;W%o\221{\2467R\032\271\357"
+	.ascii	"\316U\311rn\317\2757\207\017\0370\223\2665P\324\374\r`\3647p"
+	.ascii	"\321\337\300\246\277\241L_\346\005R\277\001L\177\003\r=\345\263"
+	.ascii	"\373d\310\301\371\033\240\364/\032T\032\323\t\215\231\316H\245"
+	.ascii	"R\031\327\231F\2451\2362a\2514*}r\362\253{J\025\321\371\033\234"
+	.ascii	"\3645\314\321\327\360F_C\236\276\2063Zx\201\324\333\274@"
+	.string	"j\036\335V\004\214\t\316\327"
+	.string	"\247\335\\y\262\321\361\266\367\306{\342\314\273\302\304\262G\306\371|Sv\345\356nw\256\312e\3069\237{\3576w\353\371\355-\347\344\215N\236\223\355\344;YN\256\223\361d8\231\357:s\234\254\367,\227\277\3448\371y\267\236\247\346\016[\327|\355\351\361\355\275\203[oQv\031\3625\224\351k\020\242\257\341\207\276\006\037\372\032\272\3645\350\320\327\260\245\257\301\206\276\006\032\372\032\256\36450\351\373v\201\324\373\274@jF\203\233\224"
+	.ascii	"\351\303\371An\364\2573\237\311uxH\344\232p\376\263\231\347\272"
+	.ascii	"\273\tw\007\354\244F\026\0348g\272\267\t\3568{c\206s\236K\325"
+	.ascii	"\200h1\203s.\343\223E\315\316\b\316\217s\267\377\277\273$\313"
+	.ascii	"\331\025\234\037$F?\310\251\037\324D?\310\210\306\373\002\251"
+	.ascii	"\330\353\006\251\030\\ \025c\305\345.W\230{Yp\266\222\335z\232"
+	.ascii	"~\366F\322\366\204\313\\\2563w\311]\262\226\274\345\316\r\311"
+	.ascii	"M\240<\367\336\0378|\310W\370\300\300\2509o\301L\327k\245\321"
+	.ascii	"Em\013\316\017\022\242\177\323\234Nf\226\374\226\333\2563\273"
+	.ascii	"\375\271\312\rsLw\0053aaf\267\214\0053\001\211|\335\241\361}"
+	.ascii	"\370\240|\002\304\216\316\017\222\322\017r\322\317\320\247\237"
+	.ascii	"\201O\253\231Jf\353\022\027\006\205sn\312c\030\310\322Sb\206"
+	.ascii	"\022\311lh\030\372\326\323\324\334L.\336\350)1\313R\362Z\236"
+	.ascii	"r\235\231-7\237\325r\024\214%\263\241j\362\276sCR5R\370\216\211"
+	.ascii	"d\207\316\253\327\rR\017\347\002\251\317\300F\037KM\3111\235"
+	.ascii	"\354\230R`\230XN\346}2\343\313S\031&\226\2500Vm\367I\326\225"
+	.ascii	"<\226m\344/\264\311,\201F\253\312s,\327\200\362\f\0035\006K\f"
+	.ascii	"2Or\223\234$\223\345#\371,\247e'\031J\026\313H\262Y\016\313h"
+	.ascii	"\231If\346%YI.\273\316<F#\206\025*7fU\026\246\f1c\371\n\313s"
+	.ascii	"\357\346\220N\313\271\347!\377\252\3510c\343\201\204\231\343"
+	.ascii	"\214\331#\214\211\303\t\323\253k\207\030\363\006\0323\203e!\331"
+	.ascii	"G&\222\215\344\037\271H\006\222\207\344 \327\231\277~\274\005"
+	.ascii	"O\375\346\255\237\350+s9\2014y\356\335\364\221\323u\204\216\206"
+	.ascii	"\374\f]\36434\3653 \321\317\300\245\237AJ\037\250\216>\220\235"
+	.ascii	">P\234\016\341\006\251\007\202\242\017\004D\037\250\207>\320"
+	.ascii	"\224>\006;\372\030\316\350c\200\323\307\240\246\217\201\251\217"
+	.ascii	"!\207>\206(\375\013{\372\027\310\350_p\352_x\242\177!L\377\202"
+	.ascii	"\016\375\0132\364\177\360\364\177\266\350\377\230\351\3770\365"
+	.ascii	"\361\224\033:L9\350\034\264\016\032\007\245\203\366\241p2\023"
+	.ascii	"\312\207\342A\357\240yP;\327\231\367\217\242A\323\264\261\223"
+	.ascii	"\266\327\206\371\306\r\221\236\224\274*l\356\362<\331\304\270"
+	.ascii	"\303|\362=\325\326\3641\355\242\362F\361\244\340\311\033\315"
+	.ascii	"\273m@\352\b\255;\232\230\234u\310\377\361\241\377s"
+	.string	"\245\3573G\337\247\214\276\217\233\276O\023}\237\037\372>P\372=v\372=p\372=j\372=c\372=H\364m\336 U\350\002\251\307F\314\302\236S\254\236j{czJ\370\216\320\351)1\243R\345\204\bQ\224\034\314\264\036\314\373\344\314\b3\255\f\t\023\n\217\347\336\315'\250\227\214\256\247\224\335\324\344\341\315\033=%|HP\2569Z\364\224\360\021\255q=\261,\021c\336'M\212<1\2261'O\"\266;'c\213\251\304\f\245C\275\240VP.\350\025\024\013\252\005\205C\303\240N\364\f*\006\355\202\226A\263\240c\320/(\030\324\r5\203\222A\343\320-\250\034Z\207\316\241m\327Y\0045B\324\334\361\334\273y\237\240\r\251\242\206\212IvE\310\031\026\364\r\235A\345\3103\311ms\341CO\211\331\336\315\243b\001C.H\360\232\302\034\027\352\210\003\205\346\206\263\220\353\266a\256\246\324S\210\303"
+	.string	"L\264\b2B\031\027N\te\bkp\251oVu\266\320\201S\227fua\215\013\265\324+\\\272n\340|a\226\220\306\377[\357\306\340\254\341|\003\314\320\302+!\226\026\236\0328p>6\300S\006\301'o\226D\341\3743\355\204!\301YH%\254\372\377K\275\230L\355Ue cY\234\b\245\2043T\"[i\244\b\243@p\243M\200\323w!S\2370F\223\017\234\230/)\302\247\013c\270ef\036\21538\013\235\204M\302\rB\031m\302Z\220\316\203v\202t\202xz\272X\311)\343\323\312\301\344\013\336y\020O\035\22264p~\034\017>3\246\310q\302\371\301: \234i\022e\3018\017\316\t\306\t\2061\342d*\nO\216\021MBG\233\007\335\264\t\356\335(\373\352"
+	.ascii	"M{zf\033\350\314\340\364\036\334\313\317\030Ovp\016\276\001J"
+	.ascii	"\221\261c\006\013\347\340\363\316a!\323\004/\017\004\034\232"
+	.ascii	"\0049g\036Ls&\210w\243\354+\016\250\201\3251\353\311Bksr\367"
+	.ascii	" \236W\0336hp\016\256Y\253\250\216@a\3029h\247&\210\346\203>"
+	.ascii	"=\202Lp\314\203e\202c\202f\232\314\261\031B'H\367\240\231<\037"
+	.ascii	"\263<N\0338\007\347\310|\360\324$6\334\203^\340\202a\204\226"
+	.ascii	"D\271Ej \261\001\346\3010yB\"]\230W8\007\277\374\236Z\330\262"
+	.ascii	"\310\305}0\247Ih\t\276=\270%\370\026\344\222\003\250\304*\217"
+	.ascii	")\234\221\003\357.\310\005\253\3351\231\023\323\362\001\232N"
+	.ascii	"\300\021+\017:\255\004\263h\341rw#\333\350\261&\246\355\301,"
+	.ascii	">\354\270\204\340\034\304r\345\2030\235\200\033C\377\203i\017"
+	.ascii	"\252\245\005\251\254]\204\266\323\323\356\"\002d\307J\r\037\337"
+	.ascii	"\216\332\362p\337\232\b\271\022\345A*\017N\341\340\203\213yb"
+	.ascii	"%m\006\316\017\262\005\245\374?\237;mL\326\340|\017\340\350\007"
+	.ascii	"\327\310\306\270\344p>\366\340M\006\3021S\224d\tBy\260\371\377"
+	.ascii	"~[\272\200|\341|\017\326\350?\370\344\377\255W\322\350`\342|"
+	.ascii	"\017\316\350{0F' \317\331\203N\316\326\262[\327\246\253Fj\304"
+	.ascii	"H\214\0368?\330\304\003,:\001z\301%\0172\t.\371I\345u\325\340"
+	.ascii	"C\367\342\320\371\300\371\3012\017\226\350\004T\t\022y\320H\220"
+	.ascii	"H\220l\313\236^\2300s\332$y\220\314\r\350\245\245\b\035\316A"
+	.ascii	"$\301\261&Pf\344\306\036d\302q\222\307\252\307\333\2168uA\261"
+	.ascii	"t\207\216\035w{8\007\217\004\303\202E<\350\241K\b\013\202=\b"
+	.ascii	"$\b\026\024\"\344\305\024'x\203\252\356\255\312\031\236\227`"
+	.ascii	"\220\007\205\f\343H\231{\202\325\310\\\335\251\363\303\003\034"
+	.ascii	"Z\001w\\\017\352\340\n\372\020\"\373\272CC\321l\002\026\364z"
+	.ascii	"\320G\336\017N\033\226=\234\037'\330\243\352\356L\227\036\301"
+	.ascii	"\256)s\264\230p\016\362\360\341Zc$\006\316\367`J\177\3079\f\323"
+	.ascii	"\274\221\202\207\363\2039:h\243K\330A\033\017\342\b\332\370\311"
+	.ascii	"\241\251\202\246g\004\347\007o\230\321%\334\bf=\250\025\314\372"
+	.ascii	"\311y\331\273\273\001\304\233\263\246\207\363\2034:\360\242K"
+	.ascii	"`\023\254z\360*X\365\223\242\363f\313\3030\317Y\337\236\025\023"
+	.ascii	"]B\224\240\323\2031\376\353\f:\005\247n\224}\225\001\316\351"
+	.ascii	"\356\306ZD\213\230&3\036\234:\\\2225LGp\016J\241^S\334\270p\016"
+	.ascii	"F\035.\207\020-'\316A\031A\250\340S\007a\272\004><\007\366"
+	.string	"\341\t2\035}\332]\\\353\033\225\0219|pey\350\202\373A&5\215\223\254+{j\032u\215\022\0372\362t\200C\213\310A\347@;t\326\262\261-whz\314\225ZX\235\016\230\264\b+8\007\312\201\003\234#\344\305\364\306\002/YzJz\300L\271s\232\203z\271\305\311\362\026gN\233"
+	.ascii	"\306\346\300<6@=!\275\323\200\\=\261\223l\310\2247\007\352\301"
+	.ascii	"\245Pl\340\230\301\031\370<\234\035+P\316\340"
+	.string	"\fts\2700d\300z\300\331\320\342dL\2338=\242\206\231\003\317\230\001\336\301i\335\335\340C\233`EEYs\340\335\224\2706:8\003\355\324T\311\221\007g\240\232\273\231\255\371\302\20330\r\232:\016\256\350\021p\200c\016,\003\034\003\234\273`x]5~uRR\316\314\035n\311]\332\030\316\007\222\341`\211\036\361\004\bw\240\027 \0340\f\027\247\273\033|N_\276\334\300\034\030\306\255l\255\215\026\234\201_\200rq\034\024\321$\\\031:\220\013\227\2747\016\2644\tP\206\016\314r\235\300,@-(\374\354\r\246\343\r\250\345\007\272\001\337\320*\354\205\344\rO\016\347\n\274n\220\232\2378\330\232\2045A\016\024\003\006\001b!r\332MP\206\274\254\t\343\336\200\271\203\263\023c\331{C\207\363\211\366\364/\032\023\230d\315\223\f8f\367,\003\232\335\271!%\224\215y*\001\216\225a\262\001\257"
+	.string	"\255"
+	.string	"\251"
+	.string	"\245"
+	.string	"\253\\'p\n\360,\r8\005\270\204\314\024`\023`\224;\267\365\263\237\262\264y~"
+	.string	"\316\370\232\343\321\223\231o\363\004\017\250\006\\\273N`\224\013\001\243"
+	.string	"\235"
+	.ascii	"\233\007\220\263B\202\306\341\303P\357\214\235\0165\377\300&"
+	.ascii	"\020\n\226\246\220=\234\201O\266p\204\211\201\363\211\242\350"
+	.ascii	"\037\210v\235\300\2648fZ\354\340\3748o\343\245\b\030\024}\242"
+	.ascii	"3}\2420\rd\242\321<y\220\301\371DA\364\211\276\364\211x\350\023"
+	.string	"\331\320'\302\322?0\tp\214\r\f\0342c\267\255n\f\225\023\316'\242\322\300#@$>gmL1\200ax\bW\334\036\316\007\032\361\301\262\333]p>\260\310\377_R\326U\022\234\201D4\324P_\006\251\331\021g\334\220\003\21105\260#\311\017 8\003\205\020\0358$\345\n\343\303\b\316\301\013\244~\bO\223\340f\350\236]\340\216\003\177`;\274\346:\201;P\032(lm\032C^\352vhp\317\270\344q\303\031\350\003\b\326\303\305\212\252\t\316\007~\r1sd\t\316\370\036N\005\3668\320\353\377\005\331\250\370\270\303\371Ci\364\201]7\210\231\230<8\037\310#x\207\206\235\332\220\\\006,t\215M\341\374\2414Mb\f\320\306\2018\2006\2009\340pa\363\024NIQq\313\301\325cD\314l\214\013\270e\327\007\027U\367\323\373Rg\356\006\022M\"\017X\005\254\001\274\002V\001\265\214"
+	.string	"\323\264\246\342r\310\001\265\2004\262\030&ux4\016\314\262\263\345\306\254\356\177s\343\330\213\342\005\304\302ok\242\270\b\301\371@\253\241 Z\0013\200N\007\306"
+	.string	":\001\247\2560}\276H\245)\003\234q\340TTS\2344\234\201P@\251\377?\0370+knH\001\243\264\374\030\322\224GxG\207\236\032\240\214\254\207*\371j2\007|\032\252\241M\370r\347\277<w\200Lb\3017Q\342H\001\356\003\231\244\334\001\302\006\347_\337\357)\324\362\301\347\206g(\206V@\021\276\377\352\360\251xC\204c\234pWt\342h\005H\201\363\237\0348\271\356\3764\235\352\2100\367\336\362\240\202mi{\3069\243E\320\031Z\211\374?\273\377\356\354~z7\312\276\352\300\204\306\236\036\337\336[\036p\233*Nbo\376\323\303Lf\220%\301\371\327\346\3674#\246\255\357\367\374\271\031;b\205c*\216\223<\247_^\032\003\267\261rs\007\347\037\233\037\336\232\020]4\211\2763\377\2459\243\331"
+	.ascii	"5\330\232C\206\006\213\036a\316\320\177f~f\326!\033\300\355\205"
+	.ascii	"`\242=h\031\372o\356\327\371\233[\203\020=\355\246\036\352\016"
+	.ascii	"*\2608\r\240\272\276\340\374\020I~`~d~c~`V\031j\\\230\037\231"
+	.ascii	"\337\2300\253\2147{Y\313\352\315\0271?\364C\\\351\023\316t\371"
+	.ascii	"/\256\313ON\214\223\250>1dj^\376\223\273T\356\350\270\300\205"
+	.ascii	"\330\032\2055\267\377\264\270\375\266`\257\2757\324~q\346\354"
+	.ascii	"\311SK\335\016\"[\310\322\346Ly\303\323(\2709\377ksn\034N[O\013"
+	.ascii	"\032,]\264\bW\206\376\263\342\374Y\301L\036vSS\005N\366@D\321"
+	.ascii	"(\250\371\255\375\252\374\244\374\326~T\256\234\325\006\231\230"
+	.ascii	"\036\337\025\342\245\212\335\224\377\250\370\270y\023\302\206"
+	.ascii	"\rD\021\235\242o\350wv\177N\376k\336)7\355w\366S\273sw\323h\272"
+	.ascii	";M\0331O\020<\364\357\311\017J\032\032\21095\305\232\262\377"
+	.ascii	"\314\312V\031a\300p\236\254=&|Z\004\274\241\377\304\376S\"\226"
+	.ascii	"\266\226\344G6\306\244\323+\2001\362\337\021#\232M[\333somy\370"
+	.ascii	"\345\335i~\205]\321*\204\374\370\025\371\005\371\375\370\021"
+	.ascii	"\321LxLT\307\2166\315!\377\021A\307\362\320\210\201\363O\bf\002"
+	.ascii	"\206\261{\202\003\b\023\255B\314\217\307\177=~<~_\227\004"
+	.string	"\2741\252\034-?t\370\370\357\313\r\030\007J,\t\316?\257\273\255q_\204tu\375\320\020\310\272\361\337\326\177\235\277\033?\035x\357\275\231\353\024#W\236kg\322\262\340\374\377r\374\247\0033\t\325\276T\305\301\371\307u\267\\\307\t\217.\034\005\300\322\020\250\243\361_\r\032\232\r\207%\302*\035Z~\340\374\237\226\034-\302\222!\224\353\376\246\376\303\342\340\203\353\374M\241\\(D1\351\r9\341\362\263\372]\375W\365\243\332\200NG\340\351\007\365_\324\017\352'\025dc\255\001V\276t\371I\215\221\201Q\341\374\237\214-v~O:\217\235\237\323\002\316\356\374\236t\236;?\247_\254&\035\300,\0371\2712\273\357?\247_\323Jg\306\347\003\347\037S\026\363BF\004\347oP\345\267\261\376\377\360\226\r$ep\276\306c\246\277\201\017m\002\307\234k:s\326,0\276\rj\270\321q\264\236\033\rg"
+	.ascii	"(\300\236:\216\326\323O\r\347\267\261\342\250<\200l\362b\270"
+	.ascii	"\341\254\341\260\301Y\361z\303\247\257\001\234\235n\243\361\354"
+	.ascii	"4\033\b\340Y\243\333h\2745\232\r\0072\262-\017)\332\230\266&"
+	.ascii	"\316\232\215\031%H\256\340|}\267\246\257A\021m\"\355\314u\232"
+	.ascii	"3k\226\023\032\r\250\264\t\270\271k3s{twz\004\256\241c\"DrX\r"
+	.ascii	"\035\027\301E\270h\231h\003\346Z\f\230:1=\2630p\232\0011\342"
+	.ascii	"\256\345\342\270xI\323\b\3602t\315\345:5\027\335e\b\312\232\356"
+	.ascii	"Be\246\027\207\r\316\377@\246\031\300C\273]k\321n}k\372\r\207"
+	.ascii	"F\200\217\241\353\2666\274\341\223\216:98\377\003\224F\300\215"
+	.ascii	"\241k\247\263\355G\304-*\313\035\215\200\251\241k+VT7\367\302"
+	.ascii	"\336Mbo\033kK\003\037=\256:=\215\200=tMESQ\335\250X%\300\370"
+	.ascii	"r\032\036o~\340|\002\330i\021\342\f]7\271\226\242\233\344-\027"
+	.ascii	"\253\202]\246\256\315scmi\240\342\271\303\304\fg\255\246\327"
+	.ascii	"4\333\377\013\352Y\251\261\203\363\t0\247\257\243\374\377\251"
+	.ascii	"P\244\214\023\347"
+	.string	"|\017\247^C\321\315\377\027\2642\202\227\005\347\023@N_?\321y\373\206\022\234u\232\206\"\300\225\f~J\360X\001\321N\256\323~\215v\241\264\320\207g\016\316\303\013\244\246LD\327N\202d\342\236Pp>\001\242h\022\252\206\256\315\314t\231\320\317~\222r\306$\200\021MB\323\320\265\022\255D\227\241Q\273\t\f\003/Nz\211\23563\344\340|\002\344\320'\300\223\306Q\206\256\223\\\247N\242\252\371\357i7\2111\367\336\322 7\311\"&\n\316\367\220G\343,C\327L\346m\023\362b\322\253\340Y%d+\343q\223\206\b\316\367"
+	.string	"F\223\2605\204r]\215D#A\271\2046\323\236\007^\300<\\\321#\374\030\272\016\323a\267mh\275\022\203\207\0075=\202\224\241\353\"E\210\204\351\021\234\206\216\201"
+	.string	"\231\201\2006C\327B\204D\331\320\b\340\033:\026\202\205H\215\320d\350\372\307\217\273\345\237=\025\243\007\323\303\223\036Al\350\372K\177q\311 O3`I\327\265W\327*C\357>\262\036e\364\267\266t\225\272\367mz]a\355-,\017\016\270\302\245wh\035\\\272J3\355=V'\246g\246s`\321\317 \211F\321\314\3228\264V\226\276\361\237&U\307\232\215\353\033y\372\tG\221.\234u\2155\2150\006\333\0176\032\031\330\320 8\207\256\257~\235\372j\375B\243\2746\215\n\306\234\346\334A\361\332h\235\301\371\031\\\351\023\270\264\324\365\224\226\322UP\3004\325uU\235\331S\313\232\346\367d\013X\033\316\3273\006\220G\227p3\244\237\256\206\222q\267\274\253\\f\032\037\323\215\376"
+	.string	"\310h\034\200;f\216\324\032\234K\324\r\351}u\323zG;\335\355n\032\033\323\rIs\363\034\200\233\376"
+	.string	"\236\350\273]\374\264wS"
+	.string	"|\200\244\331\331\300\271\204\227\241\365\316]\363\334Y\373n\333\335P\033\0063-\3579"
+	.string	"!\372\003\260\322\277\267M-A&\347+\237\234\325\316:f\255\316W;i\022\257)-\234W:k\232\333\205\215\211\312mK\301\344\260q\233\003Gw@3\364\025\316u\256p\326\0378\312f\362q\322\270C\323f\362H\311\301\371\002\300\323D2\206\276>\177\235\353s\325\363\340\265i\f\321\361\241\247\244\212\354\210\r\234\3277\017\320\3632\003\347\013\240\214\276"
+	.string	"\262h"
+	.string	"h\r}e\303f\315\303Q6\215\340\032\227\217\263\314\006\330\332F\rl\206\032\234/\200\246\276"
+	.string	"\216h\240\274\241\257ww@\263\236#p\256\322p\276"
+	.string	"\2764\2123d\276\316\221Y\355\324\254:1=>5_\355\362\2045\336\2601\202\363Z\267\246\221A\006\304K\0324O\254l\331I\347~u\274\2409\303\371g~\255\306b\204\301y5\263V\001\305\334x\013\303y\245[\313\b\200K\223"
+	.string	"7\364U\214\030\324\212h\357\037FF\360\262&\247\001\232\226\203\313\211\3631\350\323#\274\r}\005\343\\\301\3346\241\315\244W\001\034YS\203c\260F?\200L\334W\271\270\265\f\317\352\345Mc\3301\364\265K\027\254\366{\332_D\326\035Tuo\250X\224\230\030\316\307\300K\213"
+	.string	"e\350\353\226\353\\\267\334\r\205\035C-\004'X[\203c0\245Q\330j\373\352\326\266\276\rY\271\300\336n\333\232,\263\264,s4\004\232L\371Ze\312\352\324{o\246\237\355\204\207\306\274\362\325\031\254q\005\261]:q\201\202`{,\242>\313\013\330c\321x,\026-a\020]\030\211C\013\224\224\254\212\244p\311\036!\225\026\020\001\023*F\210(Z"
+	.string	"\t\007\234(\032\221\242h\005\023\027X\243\345Y\200`!D\313\256p$*\031\211\r@*a$\005\235\005\210\345q\t\251\310H\\\2014&\t`\271d\215\214\210*\006*\260\300P\006R\007t\360B\031\342\205\022\310\310\036\217D\026#Z\366\204\027\312\013m\361hbX\002E\nm\361h\002\210=.\265\310v\211\270aD\212\266x4\021DB\3621\022\215\226mqE\210\245cR\001^,\035\213\306\002x"
+	.string	"B\021\b!\274\b\301\036-\031\215\216\305\020\312\345R\210\020FlrY\301\021i\035\001\002\273@*Y\264\310\343\212Dd\215\031\251=\026\225F\365E\361\204\022\331\"O\264l\322\317\021\333\022\225K-q\205v)\331.9`iB\203\007Ak[\324A\022)\b\343\bi\002R\005\213VI\\@\004\224\224H\244\345\221\250T\261\244T\234`\2114\002\276@*\223Ib\321\261\270\004&\035\213K\023\024"
+	.string	"\215H,\t\243\024-\233\224\2415\026U,\221#\202N\250\340\207\304&\035\211)X#\321h\031d\215G&Z6)\003\322\261HT\266\313#\322\b\b#\211\034\221DT\"\333\025\316\002Dr\t\251L*R\262-\033\302\350\270T\"xD\302\351\262())l\213\216I\311\364\230\224D\331\026\212\313\274\\\262\312\243#\342\n#\2114\312\3126\211^\bC\331.\213Il\n\240#v\271\224Ol\211GEI\311\2411\251\304&%#`\215+\210\355\322\211\236\365B\217\217\007F\343\322\361\307\003\237\365\230\224\207\031\216\212\311\236\f\032.l\020v"
+	.ascii	"B\231\354Y\266G\266hTDBb\221#H\230@\261\024t\304*\213K\034`S"
+	.ascii	"$5\260-\361(\t\201\345\261H<\341\250\210\2025.\035\261,\214\226"
+	.ascii	"\032T\024\223\030\220*\216\212I\240\245\022)B\211T*\027"
+	.string	"\300\341\210U.-\225lk\314\260\354a\213\330$\f\025G\305\344\317'\tCE\313\236\240\341\250\230\024J\260,^pA\004\n\025-\273dS\034\025\223BH%\214\023&\260\200D\006\244\022\306\t\033\220\222)\270\370I\360C\302\004\212\242\337\021{L*\032\211\353r\375r\271\242H\211\250l\227D$\020C\022&P,\213/\210+\007\032~T\034\005\245g\001\"ii\005{\024\342\310X\\Z\301\201=B\236HZZ\301\036\375\216X\343\n\342q\001I\307\242\221m\301\032}\\\020a\350c\221x\202\b%%\253\242\230\001)\211B\261=\022\177L\004)\3316\2114:*&{0\f\201h\225\304$\210\244c\021\2061\231$rH:\026S\264\354\n\035\322v\271\024qT.\2518*&\177z\206\216\305\345O\017\021\210%\322\350G\003\007 J\264K\242Q\350E\361\004Q\311\036\025\223\034t\373\323b"
+	.string	"\032\331\026l\nG\305\244\036\301\201M\302P\201\342\210].\005\035\223\210'\330\226\230\342\210l\241\250D\242`d$\032\t\235\005\b\243\343\022\005\313$\242\261\004{\204<\341S\201%rD\006\024Z6\t\b\251\"\305Q1\tTB\202\245q\351\b\244\304\266K\030+``[b\212\366\310*\225KF\034\330\026\212\372\355\222\210\344"
+	.string	"UIda\224E\240P\241D\266He\2615.\235\350p\243\242\276\007 \024"
+	.ascii	"\204\020^\254\017A\204!\021\206\324\207 \002\021\221\b \020\351"
+	.ascii	"\203@\204bh\333\242\245\2225.-\240%\006\265Ek[td\342\005r\305"
+	.ascii	"\252\317\002\304\322H\031\302\b\251\303\b#\345\221\021\211B\020"
+	.ascii	"R2\005bR\005\006\326\304Q1\tl\213^\260G\307b\321\322\250\250"
+	.ascii	"D<\3028*\332p\026 \220J\030IH%\214$\225Xl\213\307b\260\355a\225"
+	.ascii	"\212m\022\211L\241G\tydI,\227\254\221\217\222EBZ2\001\303O[\244"
+	.ascii	"Tl\203"
+	.string	"K\b\260JE\025\027\220F\220\020\261\"\227Gv\271,R\333\226U\n\261T\262-\212\312\243\021AFF\242\321\257]\026\261F\305`\013\226\304ri\205\232\246\312\026\205\321q\251D\322\001=\313\242\026,\211\026\331\026\223\300\226MB[\260G\350\021\313&WP\026\211\272-R\022\215D\243\025\332\242\366,@,Y\264D\245c\221\022\272,j\301\036\265\313\365\304\211\025\216\214\310\"%u\005\027\354\261HIU\217\330\226h\\RZ22\"\376\030\211-\320\266\b\305\206\263"
+	.ascii	"aT\201\212\026,\211\243v\351\303jh\225\304v\031\\\236`[(\256"
+	.ascii	"\340\002yt,\272\020\226\020&\225\210\313\340R\211\250$&U\345"
+	.ascii	"\212\242\2218\002\251d[\3601\352\266h\t\001\b\264GV\211U.-\211"
+	.ascii	"\354\211\266\250\325\313\0230X\264F\"\213\302\221eWh\227D\343"
+	.ascii	"\005\244\222\255\200\220U.-\227\2542\251[\\dk\304\266xqa\334"
+	.ascii	"\026n[tTL\002\377\203\202\005l\202\005L\202\005\\\242\004\013"
+	.ascii	"(\211\021,\240*X\300Z\tDZ2!\330\n\225E\244 \322\322\n\264%\""
+	.ascii	"\215H\351\022\t\211E\032\251,\332\244#\233\002\322\322\212_K"
+	.ascii	"L\201T\302H\352\t\"\231@*a\234\240D*\225\354\317O\333\026\225"
+	.ascii	"\212)\260-Qy\301'9\034\266E\232\250M\242*\333\022\333\0258@J"
+	.ascii	"\246\260\034\266l\222\222\250\002\003R\t\343\004\266%\246X.!"
+	.ascii	"\213-Xe\362\247UqD\324&\203lKl\227\351\210\024\030)\231\302\257"
+	.ascii	"=\013\020!\216H%%\244\221\004\034\300\300\313\242#\342\022\007"
+	.ascii	"\212+z\206V`\242\025\230\203\025\230\210\2109 b\242\027\230\203"
+	.ascii	"\027\230\b\006FJ\2460T\266(\216%<@\272p,\001\303\230L\212P\262"
+	.ascii	"\255\261X\"\211\201mQl\215D\274 \032\331\024=.\210J\364,@,)\025"
+	.ascii	"\215F\2442\247.\2100\320%\273d$\266P[\020\217\301##\222Ek$\026"
+	.ascii	")\221HEGE\245\242\345\322\006\030m\322\261\250\244$\026\021\225"
+	.ascii	"\355\013\026H\311.\227.\260GH\245\242\326H\314\340\323.\225E"
+	.ascii	"\244\"c\221\330\026\261h\225=G\344\205\244c\361\350H4\026\261"
+	.ascii	"J\3441\251\330*5$\221\355\222=**\225l\013$\207e\022\321\210\224"
+	.ascii	"\262\312%c\221\210T\264D&\201|X$\342\262\b\006\321\205\206\036"
+	.ascii	"d\273\004\364\303\266D\345\205\326H<\026[#\361\005Q\251\350\350"
+	.ascii	"\002y\344\002i\\fh\217\254\321\222=*JR\262J,\006\341\005\026"
+	.ascii	"\255\262\350XT\372i\225\310\025\304\"\026\255\022\b\211Tt,\022"
+	.ascii	"\225JV\002\326\350Hl\227B\310\"V\t\311\242\210E\253\344`$*\331"
+	.ascii	"#\233\264*\331\026H\026=0\210F\366\250HII\\\026\217\212\220\355"
+	.ascii	"\022\361\302\206\r>H\031\202\216\214\310$b\322\221]\026\217\212"
+	.ascii	"\332%\0229A\322\261\310\002Q\271\002\003\253TTAb\211L\002!\223"
+	.ascii	"/\026\300.\217\310\344\222M\261D&}\214\224\360Y\200H*\266 \036"
+	.ascii	"\003\360\202\250\344\363\202\250\324#\\.\331#\213\026\211TZ\026"
+	.ascii	"a8\026_\020\225\204\310\266\210\205Q[L^X.\025\217\210\312!\333"
+	.ascii	"\242xTtt$\032}`\264E#\244\221m\241\201\305\222e\215\214\210,"
+	.ascii	"\226\254R\261\305\300\032\217\212\031\224\254R\261\305\220\\"
+	.ascii	":\026\223\313\"%\262E\n\035\213>\355\022\222U*\266=\354\321R"
+	.ascii	"[l\215@+\224\212F#\fE,\214\216KD\343\217\013\"\214\"vY\\R\032"
+	.ascii	"\371\260K\"\2534:\026\213\224,\332\242\"\027H\243\221\310\201"
+	.ascii	"\002-\210*\270(\301.\2270\034\035\211+\216\210#\\\020a`p\201"
+	.ascii	"\204\207\352\021\333*\331\026G\023$4\260I\030*\224\224H\244\226"
+	.ascii	"hL\n\215H\244\tE\3512I4\226X\022Y\350\226]\262J\024J\366E\361"
+	.ascii	"\304\021[4&\223D\fG\027H\022*\216\305\023.\220$h\331\026\305"
+	.ascii	"\226\330\242\250dIhX\026\2418*&\205l\022\206\n%k\034qTL^p\201"
+	.ascii	"\324\266g\001\342\250\230\024*Q\002/\213B8*&U\024\327\304%q\217"
+	.ascii	"\212ItY\304\302\221h\302Q1\3713R*b\341H\\\261\262I\030mO\013"
+	.ascii	",\212\204l\022F\353\323\002\213\"\016\220\222\306\243a\013,\212"
+	.ascii	"\220\222\306\"\027D\030\300\266\250T4\026\035\031\221,\212\222"
+	.ascii	"\216\305#\"\313bC{d\215\224,\212\366XD\242H.\035\035\213\022"
+	.ascii	"\330\340\202H\001\241\266\210\203\016X\030\265E\024F#2\305\021"
+	.ascii	"Y\\\026_\020\001pD\026[\342\261h4:\026\213Xc\322\221X\364\202"
+	.ascii	"\250\024\024tA\244\300\nG\305d\217\013\244\222\205\n\241#\226"
+	.ascii	"M.\225E\021\254\321\221U\262Hl\212\b\216E\342\t.\210\0248b[\342"
+	.ascii	"\261x\244D\"GHpD\026\333\342\022\211\202\005\243b\273\302\321"
+	.ascii	"\001J\2665q\301\021Yl\215Xe\361\250H\311\266E\244\361GI\311\252"
+	.ascii	" \001c\002F6\002-\210G\fl\022F\373cT\204\341\005\321\310*\213"
+	.ascii	"\224\224l[\f*\221\255\021\261\204\360\210,\262F\243\210V\304"
+	.ascii	"\013\342\t\016-\240\200\224L\201\330\032Y\022H%\214\023\332%"
+	.ascii	"\022i\302Q\206c\221x\202\217\022\331\022\225\254\006$$d\2734"
+	.ascii	"\002F[lAT&\025\333#\361B[T*\246\240\264\264<*\242H:Ba\211D\341"
+	.ascii	"\242D\013\342Q\303Y\200P\262/\212J\021\f_\020\225\202GG\242\222"
+	.ascii	"\022\322\350XT\002\262-1\205\320\2104B\266H%\n%\027(\214D,O\260"
+	.ascii	"JE\025F\326\210%\361\303.\031\211\021h\331%\022\222\003X\343"
+	.ascii	"\221\t#\261-&\025\2174\260\306#\023B\326H4Za\330\036\227\220"
+	.ascii	"#X#\022\205\022\331\"\225z\326v\311\262\312$\226\004kL:\212P"
+	.ascii	"\"\216h\221D\302`\264,*\345eQR\021\351\210\034\301\266\304\024"
+	.ascii	"@!\034\025O\030)U\022&P\034a\034\251\355\261\210L\262@d\225+"
+	.ascii	"\212\210\311a[\004\002Q{,.\351\345\211%\242\212\244cQ\002G\354"
+	.ascii	"\213\"R\017kl[\244\222E\253\217\330\026\212\306\342\nb\273\004"
+	.ascii	"\236\005\b\326XDB*\223ElKT\032\221\312\366\2104\na\204\301\221"
+	.ascii	"IV\031\242E\"\225!\202F\3125\004d\362\305\002\\\020)`\244\004"
+	.ascii	"\266E!\264\307\342\322\372#\242\016\220\210V\260!\200\360\371"
+	.ascii	"\001\0160\242\002\b\250p\2026\002qTL\206hY$\025\215H!\216E\242"
+	.ascii	"R\b#\3452\004\210\rK\266%*S#q\351HTR\377\017\233\253\035\037"
+	.ascii	"aG\330\340\214\266\367\026\032\3268\373\302{\002d\370\246\211"
+	.ascii	"\234\260\264\325\256\347\355L\0174hB\035K\372\232TC'\302\032"
+	.ascii	"\267\310\324\214\256a\2235H\317^\331U\224\341\331\372\026D\322"
+	.ascii	"\334\022\003g\t\020\031&\031\232\r\225\f\223\f\231\204\2050d"
+	.ascii	"2,C\263\342|\3311,\033.\001j\255\221\002G\304\216\026\0262=\375"
+	.ascii	"\017\307\360\231\241\224\031D\246\f\231\353\020\034U\025\305"
+	.ascii	"\034\212\375\234|fp\321*\033\"\031\022\331\322\365\344\307\360"
+	.ascii	"H\320\207\n\0055\004j\030\366\223\003Z\351{\303fhd\375Z\3314"
+	.ascii	"\351\320\031\026\t\n\261\363\002B\205s\220G\366\351\302\265\325"
+	.ascii	"d\bp\016\2154ib\340<\0042\f\362\241\220\017\205\340\241\020\264"
+	.ascii	"\257OM;CE\315\377\360G\320L6\263g"
+	.string	"\007\rX\020O\206\214\036\033g\025\344\344\030~\ry\344\030\372`\222uy}\350#\217\312I\221,\234\207=\3264n\322\324"
+	.ascii	"\301y\330\265V\241S"
+	.string	"\252x\024\331\241c\213N\341\r\215!\327\320\006\215\341\326\375\361\2647\324\356\200\222%3\236C\034\037n\271\005\311\262#\r\347\341\215a\r\255)\372\037f\005\263\2205\231\365\r\261\250\250y\346T\311\031Z\365\220Q\223\306\016\347\037 \212>\341f\3504\254\032B\r\235\206TN\270\f\247>\244\"r\227\203\n\347\341\214\3035\031\253\252\302y(\005\374\362d,\017\316\303\250\273\005\327\306\020\361\201\363P\306\263\240}sf\310\031\306\030>%\321\377\260\251\354N\0315\032C&\340\224\220$d\272\206[\337\030\216y1+\323\227n\361M\231\0017\274aPH\336\340\314\2006!\034!\036\341\034!\034\341\035\002\314\331\023\3233\263s\341\235<6rv\312p\026\326\241\303'\224#\214s\200+\335\243\226\205\311\320\202s\003\300\352\204zB5u\3027O\301F\365\362\274\360M\336\225\032R\270p\026\272Y\323\004u"
+	.ascii	"\231\303\205\2630o\255Z\343\205\206\033\316\3026w\263\223W\247"
+	.ascii	"\fg!\033\224\013G\033/;\234\205x(W\236.:\035\302\273 gp\330\301"
+	.ascii	"Y\270\306\007\b\r$dp~\by\204vB4\027\246\371\177j\234\232\021"
+	.ascii	"\0338?\204\247\276\360L\026\355\200:a\030\241\031\341\030a\030"
+	.ascii	"!]\227:\346$\234\273\220\356\367\024$\013\024\316\3022k\232 "
+	.ascii	"\235\031\334\034\234\205d\304\250\351_\bFW\215\251\021\367E\303"
+	.ascii	"Y\233\224a\002\223\013\222\375P\202\205\315K\352\265W'NK\334"
+	.ascii	"O\017\216\026:Cp\026*\3719\235(\241\3029\211\036\022;\\\326\037"
+	.ascii	"\037\370\202D\331\022\234\322Q\203\306\017\234{\366\360\250\254"
+	.ascii	"\275\255z`\206`\ts[\363\262\310\3524\t\263\374\244L\320\243\002"
+	.ascii	"\322\206\325\264\225\274\271),\253\223\310\331\236\025\316\302"
+	.ascii	"+lY\214\323\226\251\355\323S\247\356j\216\225 \323\2150!IpF\323"
+	.ascii	"\024\336])\023\007\013\247\304\341\320\022\2053\231&[\226\024"
+	.ascii	"\324\035\316ixiZlk\331\360I\225-1k+[\326b\006J*J\020\317\257"
+	.ascii	"GX\2153jLX|\\\241\0216\357\034\216\030v\234B(\302\030\267\fS"
+	.ascii	"\026\037\302'=\262\340dI\233\363\001C\222\346\206\026\006hwD"
+	.ascii	"M\231\023\340]0\016\2322yM\200z(\221"
+	.string	"\276.{g\232\215\025\256!`87\253\320\261z>\231\350.-W\020\033e\301\275\033\004J\033S\270$\030F\311\0326G\232h{7}\204WWF\274\310\202\\|\244\272\362\354$\311}t\360x)\023\216\245T^S\262\354p\226\300\022!\021!Sh\204\210P\354\227FS\216\r\2760\201\325\021\212\t\221\224\255Q\313\203Dx\304\316\206\025\022\224\312D\2334/\3020\254\006\314\021\271\275\"eM\266\275\233>\031\266\230X\t\001j\311\242#\246\004g\021A\204>.\004\023\372\020\002Y\311\\}\361Q\300\213\026:\341\217\013\2018-\tk\303\371qV\036\377\177C\2636h\270\276B\230\241E\240\ty\\\330C\310\343'\025\344\205IO\211\003n@\201u\255\321\"\252\334\270p\353\206P\307\215\262\2578\350Y\345i\302\027\213\376\2504E\215\026\005\213\353\202(\013\264\034\347\220s\210jh\033\001S\025"
+	.string	" HD\034\022\212\265a\367\006\024\200\022\\\256tnT\237\214\244,J!e\f"
+	.string	"\204"
+	.string	"@\007\b"
+	.string	"\020\020\020"
+	.string	"\001"
+	.ascii	"?.\013\225\264\206\326\020\267\366\005g7h\247\323\2411H\034\003"
+	.ascii	"\271\343=\216am\325\204\357\200\214\027l\240\"J\347\0275\363"
+	.ascii	"\203l\222\344v/p\037\b\017\302\037\030\3758\351\273\271\257V"
+	.ascii	"\223\230N\2217\037\311D\024\2241"
+	.string	"Q\244\216|\333\350\333\306\355\tc\005 \033\240\270\004\016\215\017\322\340\330\034d\373<\bp\374\336\235Z\037\326\230\304\005\231J]^\345\276\2526\377\325\316_\001\271\216N\021\032h\353\265\220i\361\235\b\323\262\277L\271\203\210?\3129\246\312.\315\273\231l\030\300\256\301_\332\361\214R\315&\030\006\364\356\2353\357%{\001\022P\210!a\035/\004I}8):O?h\210\326\320X\2206\316\257\253U\324{v\301R\022\250a\030\"P\022N\330\334\362\332\231\250\n\232\367\306T\310\027\335Z\317'\245\225|\3328Q B\3063\nsx\024\344\321\327\337\224\005\357\034\305\345\276\243\320\200\321T\3272\235\020\017\277\276\255\235\031\264\305}\031\273\353\3710S\370\244E\235M'\217\236\2724'\230\212K\226C^\002\3162\222\267(\250\004\376K\367\f/\252uA\340\332\267\240x\344\334\035\302P\266\205\377w\005R"
+	.ascii	"\244\003\3344\264R}\030\3267\300\002<67\340\037\002\332\303\342"
+	.ascii	" \025x\031\271\004\375\332A`\226Pd\037'\260\212G9\003W\256\264"
+	.ascii	"H\242\371\030S~\3214\361z\007\216t;\265c\\.\224\272;\256?\214"
+	.ascii	"\013\270\n\371\373\376r\\\323%I\f\251C.\3157\214\t\365o\tvU\204"
+	.ascii	"2|o\211\025\0310\204\n\2109J\346\210,\240\267\207A\017&\006\207"
+	.ascii	"\201G\226H\235n\"\006\206:\n\305\344!\305N\261[\bp\212\357\277"
+	.ascii	"\240\bD\027RHH\361\004\232\377\036f;P\024\200\226\341\343\250"
+	.ascii	"\225\005q\233\312\202\001\304\217f6\207\370\324A\337]\006E\205"
+	.ascii	">\207f\f\265\260d\020+\2027q5\247r_4\327\327\340\213\305\252"
+	.ascii	"\243'\302\261\273\226V\314:[\252L\375\201\251\250\356\264\027"
+	.ascii	"\025\254\021\301\30639/\274\367Y\314\314y\204<F\b\206\245\201"
+	.ascii	"\354\246\0351\270\tFqfLp\256\367\344Yp\n\006\350\314-\216B \304"
+	.ascii	"%\247*\3333\347@+\352\370\374\256\036\002b\006D\350\271q$M\347"
+	.ascii	"k\205y\372\0058e\034\327\034\246\233\2272\302+C\201h\024\223"
+	.ascii	"\250\247V\306D\260>\033\260\360\355T\b\007\271Y-I\377\t,IV\323"
+	.ascii	"YV\221,\355\210%\317\017P\250\2434\347+'\202\273\323\003\223"
+	.ascii	"Yy\315\2372\231\251=F\211\306T\351M\253bb.P\274\360\035~k\372"
+	.ascii	"\234;\341\306K\302\001\035fVdnqr\217\0233k\323\021+\203\350\342"
+	.ascii	"\3331\222m\230(dH\225'\305\211n\n\250\262\t\321\316\263i\377"
+	.ascii	"c5\345\315Y\303M\020\243\200\344\025\260>\214\3611i\251\214U"
+	.ascii	"\313\n\362\246\347Y\221^\201\276\207\017c\3357\254mZ\216\227"
+	.ascii	"\264\226\236\257 \330\242\\\341\240\240\224\271\303\242\211/"
+	.ascii	"\355\3379p\347P\374J\277(\0304P\246\211v\215\326\362\265\276"
+	.ascii	".\\\250gj\275\006\354\302\250X\267\376\264\223h\324@\274\321"
+	.ascii	"\r(\231\224\201\312\0132\200\013!\325r `\326xkv\235\200W\362"
+	.ascii	"\320\361\3245\277\251zu\335\275\310\317-u@\260\206\f\200\241"
+	.ascii	"{\020z\364\302\260\001\207\243\246\224I\217\255\nE\023\276\273"
+	.ascii	"S\177\304\032\334\201\237FN\\\224\265N\336\220\216/\177\377Q"
+	.ascii	"-\301\353\037\021\262l1\215\235\030]\357n\032$\004\273~\251\265"
+	.ascii	"\241HYS\270\211\346>\0253\277=/\373\re\224q\231\202\234NY\fa"
+	.ascii	"\216\347\264\334\365\254\255_\371\206\264BVQ\267\033Tx\3178L"
+	.ascii	"\274\027\316\250\307\347jh\376\204\273\2006z\273.L\254%/\261"
+	.ascii	"\345Y\237\312\217\t\302\375\251\254"
+	.ascii	"L\204\370\310Q\2008\023\007$\207T\265\377v*\370\272\321\366\240"
+	.ascii	"\371B`\270\030\377\213\350\005L\237\232\025`A\216@&\270\r\271"
+	.ascii	"q\242<T;\261&\331\340\016\274\303,<\223\225\374\302\241,\251"
+	.ascii	"\254\332IJOb\315\263R\240#`\272\215\275\301L]5\302M\317\257\370"
+	.ascii	"\215\336[D\032\260m\353\216M\334\016\026k\262~\236\037\275\006"
+	.ascii	"j1\364\234\240k\356(\0318\275\332q\024`\321\013j\366\372\347"
+	.ascii	"\327W\256R\300\\\272\343'\374\216\023\343b\366/~3\244\202\277"
+	.ascii	"\023@8\265\026]\255\362\202\324$\317\373\256[\203\366N\\\315"
+	.ascii	"\322\035!|)R\304m\251\320\213rw\202v\251\257c\r\t\023\240\330"
+	.ascii	"#\204\250\210\207\334\205\2753\003'|\367\225PD\256\337Z\341c"
+	.ascii	"\034+$\305\256\b\\\234x7\356\317\272Dp\022}\335\240\357\030\322"
+	.ascii	"\235\215\020\023\031\255L\267;}Dk\367}\305\272\230\325\002c\240"
+	.ascii	"!+\343$\315G\211U4\2144\213\247K\013\032\231),\334\356\t\271"
+	.ascii	"T\33395\215\256"
+	.string	"]\372G\344\r\212\024\333Xe\321\375\244E\367\272\371Q5\253o\255\206\235\373kQ\273\224\316Fi!@\214D\370\203\362$B\2442\312l}\344_\274T\237\020!,LI\347\254Uy\311\217\363\315\374D\f\222\221G\352`\3158\007d\317\271#\244>d\\\360@<\216\2757\251?\311\352\253\210\213\356\226M^b\2302j\252\374\201\243\354\305t\255,\212\247|\352\226W\232\226\231!x\217\310\234\331P\266\035\270\353W\001\200\207\355h.M\nVK\212{\372{]2\375m\233\343\227\301\247@v\312f\020\242\255\206\220/\325\233\211\226\332\037,\277\315\346X\025k\346\250\035\260}\276\313lY?\2211;\351\205\017y\314\366\242\326\336\261\301\022\302\216\275r\215-O\003O\276\2152p\274<w\226\361C\247\365\016?\341\323\025\363\271#~U\375\364^7\234Q\273}\254\332\005\244\304\356s\237}:\022\r"
+	.string	"w\021\3134^\267q\355\373\223\225\355\202?w\312\205?'\305\241\344\235\221H\252}\006\214\t\237\031\231n\251\203%J\r+\005d\350\372"
+	.string	"]Y\214\226\301\007\365r\004y\341\036\031\366=\352\345~\344\341\003\377H\260\353\210l\255\001\364,\377\3321\352\261\"\264\377\276\020\300K\313\366P\017\300@D\036\330\3126\254>\244\274\271\352\363\365\3157\035!Q'\226.7[\251\033\320\3655\235(N\3728\023@A\017\346\216\002\340@\265\252\277\251O:\004\256P\342%\304\357\"\346n\r,\020=\247\315n\317\316\331|\001\267Z`\034l_\024<\177\027\023'\324}\307Z\360\231F\266\353%\341^?\242\026/\034\351c\354\321\335\236\226:D\2008=\203\001\275\344\030\033\020\267\002\374\355\353\240\214s\036\252\224\316\226,]e\310\252-\304\225\310\337\267\277%\221\245\302\215T\222\371\360\263\211.\346_"
+	.string	"\243\360\247\275\207*\374j]\357\275\341\310C\334\357\006r\315\336\023-\264\305\340\037\344M\333\234\375\323\2612\253\037&;\335\2655d\bx\271\344\255\235\242\f\002\27492\"\214\216\263\241\264a\345CM\236\227\017\205cZ\225\2677Bw\033\022\016\003\022\021\312\335%u^_\375\341\204\006$\250\017\272V\2631\343-\371\313"
+	.string	"\006{\267\330v\036\333\372s\237\214K\201\023(F\230"
+	.string	"\362\2165\243\370\254\240\364\023\366\001\0062\205,\254\001\362d\271sK\003\201\224c\177\006j\273\251\256\252HZNr\220\343>\261Bg\217\304\215\305r\254>\223a\236-,!b\001\221\r!0\330\247\313\257D\022\373{F\203A\243_\367h\037\360\210"
+	.string	"Y4+\366s\270g\020r\313\342\017\236S!\313\265i\355c\t"
+	.string	"\374:\275l\352\247\334\242\252Q\263\313\360\201\3576\343`\030D<\177^p\222`\017\257\215\374\364\222>\347\321f)\002F\323\365\216@^\206*\201%[\025jd~\277(\022e!e\226\220\250\245\bt\266SAk\220\337&\005\341\026\f\034b\261\016}1\322\326\275\317\016pF\245\260\344@\376cT\354\f\t\357\371\361\003\376\034\312\332\214\374G\272\271uUm\371z6X\b\020\315!4"
+	.string	"\242\305X\324*\017fI\233{=9\334\nf\013\006ZT\t\325\370L\303N\331? \2117\2630\271\325\341\003\334\246?\250\302l~c.\270!;6ng,I\212\330\376\200\313nK\363\201}\255`\371\005\027bR\255\332\331\324\226\367>\t\346\345L}\017\340\034\306\\Z\201Q\236k$d\305\300\267\0317\260\321\325\231\242\013T\367\243K\342\335\273\233\372>\266\253\366\223nP\370\263y\200\337\231\n\007z\366\263\376\021:\321'\030i\236\201// D+^\022'q\233\"\367\345\004\300\007\025\274\340iu\231Fv\017\323G\313\333\354\373@\262\016\347@k\351\257\306\236\t\265XT\276*\304\245\273\272\370!<\375)\211\322\302@\211B\017 \363\r\222vq\275\336\312\2323\032\242s;\354G\035lw\006\370q\313DCr5\266Bnp\\\243\024pa\006\224K"
+	.string	"\032\262rH\345\272M!ag\020\2533\312\\\013\301;\345\n\220\244\376y\210\305\305\254f\240M\251\261\347\275H\241<p\211\030o\300\375\262\225\2224o'\2318\341\003\224\355h\367\372\340\266W\352*\\\205\361\371N\343\300\230\302\200\252*\204\326J\b\372\227\214E\356\272d\"\244\336\253\261\022\212\307lMU\266\256vl\331L\322T(A=\363\351\"\203W1\t\026\016\271\246PPa7\314\3443\301\017\230\035m\304\247f\362\001\204\363c\307n\033\202e+\377\275\320XQ\211\024\023\275\201\232\311\340\036\323M[\305\027\253\364$\365\013\365\251y5S\254\361x\352\t\323\364\307{\301\213\213\r\353\003\326\333\276\367\324\214\323#\250,\366m\t\347\3726D)(\371%\241\361\210H0\245\345\246\034\276\340\354\307\363\357Bg\344\362\270\240h\224\203\202\3427\331\200j\006\355\203s\231"
+	.string	"\216\310\276\0227,iJ\311\321\335\031\276(\316R\210\f\325\332\374\263;\257)\377\202\003J\037\300W?\031\234D\335\345`@\273\250\244V\245\01684\025"
+	.ascii	"\316|\003C\324\372\3110\260\340(\204\035\301\212\363\205\271"
+	.ascii	"\230DgT\270\336\324A*\331\223@\021\026\021\241\214~\347\246\024"
+	.ascii	"H\327s]b\211\233o\377_\336\323\003C\227]\344M\205\037sM0t\264"
+	.ascii	"U\335\231`v\020\247\347\267\231u\276-^\306\373\035\027\260/\323"
+	.ascii	"2\305\341\tZ&#^#\006\003\212I\006\323\377\271\344\373A=M\374"
+	.ascii	"\2112\300pE\205\271\2772]\244e\373l\036%7\032\b\027p\254\273"
+	.ascii	"_\336E\344\345}\217\"\025\025\217(2\265E\273\262I]z\207\020\037"
+	.ascii	"k@\236Y\353%\275\252\270a\374sTy\\\237\316\3215\177\355\033\343"
+	.ascii	"\005\235\227\032U\347bp\363&\n\242\f\270A\366p\f\354\266[\316"
+	.ascii	"\350\273\344\034\255#\240)2oi=\345-\027\003\347V\007\343@~\267"
+	.ascii	"v\252m;\210w\027h\221\235r\213q\243(\374\362\277\331V\250&\257"
+	.ascii	"Qj\216\237&\036L\203\251~\206\227I\2524\030\350\241\020;\361"
+	.ascii	".\3245G\232\262i\267\017\332\322\207\302\021\314<\"J)\364\320"
+	.ascii	"\316\223\035\332\3622\300\270\023\007\221\243g[dQ\245\241\326"
+	.ascii	"\034\017\242\007A\213\001\200C"
+	.string	""
+	.ascii	"=Y\276\243\353\310V\275\350\254\267\245\303\312\006K\267\354"
+	.ascii	"\226\244\241<\017\320\234\274g$\316\036\206\021h\033\345sp\026"
+	.ascii	"\361\272bk\377\032\216\272N\302L\260`\035\235\331\340\002:\366"
+	.ascii	"GB\351\035oQJ.\027O#g\323N\b-\003\037%0[\366\345\265\230s\370"
+	.ascii	"\021\274\271`\373\310\355\250\343\307\022\0036\332\n\225\367"
+	.ascii	"5gP\375\222\034*^#\360\322W$\016m\261\tr\013\301\302\363YL\376"
+	.ascii	"\262H`\303\262B\037\303\245\034\"\003@\231}\r8\307\350\235`\245"
+	.ascii	"\0341\016\241&\377\331\242i\210\035\340\317\370\243\361\307C"
+	.ascii	"\307[Ix\271#d\230\220\375j&\r.8\221-}\264\251r\266\024\261\031"
+	.ascii	"&\220A\004\247\341H\347\325\346 Z\372\031\307\206u\316\311\355"
+	.ascii	"\312\245\376\373\371\214<[rF\240M\332;\332l\r\024J\3519+\363"
+	.ascii	"\00773r\256\356\247\345\350\"d\220Q\024\240\3310p\322F\350\024"
+	.ascii	"\235\246w\\\b^\022\2107\252\023\2044\026"
+	.string	"a\247\346%:\204\2222-\031\242\214\213\262Q\316\360\271yw\213\206\367\020\325\225%\027EZ\352\246\n\223\276\234{v\177r\265\024\027|\210\227\207p\2321\322\377\001\\}\216\254\3601\2703\312&\264\346B*\255c\tY*\034\317\272r\254<\270\246Nsf\374(\354\223\233L\350gv\364h\346\315MX\2446!\235\002\232\372\r\036\t]#{T;\2306O\021\1774.\025\265\273\346\2011-\020\325\3071x=^\252L\3265Z\217\311\370\317\361\263\303PV\001\254\"\343\b\240\033\370\322\033\310\364/X\t\212\360\215\021<\324\337\267\205\337\0165\r\037\030\037C\363\0254a\005\355\336\360\376`>N\006\265u?\234{\274mq\013\204\366\032\257\326\2705A\346\034\243\002\365\030A\217\3508\342~\342T9\200\205\326\3615\227\201\022\nT\371kq\365\223\007\r\f\005\312\315\367\320D\335\265\300[x\037s"
+	.string	"\324X#\325\345\306$\320y\0306\211(\310#\tgL\\R\365\337P\017h\nG0\032f1\210\353\346q\255&\202\215?\343kZ\350\252i6\350\236n3\355[\017\226\200.\236\030\310"
+	.string	"3>{\274\277\"FvH\004\256-\034\024p\017\221=\313\307x\200\260.%\3778\251\322\034\020]\202\222@\026\224\2219C\030\b(\351\340\353\n\222\005B &\007\314C\020G\320\005\243\333]\026\232\353'\304\034\353eG\351\310\270\203\032\005W\215\035\217T\373k\200e\334j\240\207\020&\0316\267\b\236\222r9\024L\371\245\335\023\353\275\315\024?,\227\223\241\220K\321U4L<\216\301,Q1\203\220c\f\303\360&\321'\032\261\374 \267d\f\375U9\342T\215\271g8\262C\236\021k\177\3718U\033+#xx\023\316^\262s\b\236\205|\206\026j\377\265\305\307%Y\001\003\b\035\306'+*N\020@\355\217\201NTr\270]\264,\232"
+	.string	"X\254\021.\013\273\013\b\246\\`T\276\032\225\177$\313"
+	.string	"\354e:Kt\004p\024g}<P\223D\310\360\304!\036!\1771\0205\300v\227\305\203V\202>\302\b\237JbK\333\307\242\017Z\333\034\213\215\003\326\f\211\263\b\370hM\003\215\376\300\210\001.\035\245\327IC\"\007Y\345>\003\375d`\340\327\347df1R\361I\364E\b\017\337\204\232uG\2755\332\017rh\225\362\n\256\260!\311\020\224\013o1\372\256\240n>Xt8I\261\261\236\212\367\006\300v\016?\006\377\374\236\345^;\340\321\272\207\233(\"\231\212\276*\007\364\0330$\026l(\033\373\033c&\311\022|j\005Mr\017>\271\253r\324>`?.\234\200\361\032\027\225\2605\234#\267P\005\366\026\214\274\363\354\244\352\323\330\365C7\264\023w\230\025+L$\312\016M\211\323O\024twj\342\023l[w\340S\357(\210\203\350\264\3067\003\226)\255\370~\301\001\314"
+	.ascii	"\255\006[k7\020\210\361]\373\360Us\331\331\032\347|!\023\237"
+	.string	"5\344c\205\325,\025Y6\031q\234\211\301blU1\330\201\246\217\351~kD\334\340\340\251n`\315\251\342C\345L\317[\037\224\356\265_Y\nQk6\b#[2\007\243(Z\257\377\356 \330\202\357H\001\031\302Z@\247\210\362\204\354\207Q\257\341\247/\374\237\366\341\250F\255\236\037H\230-\265\351\342&\024\244\tX\365\206z\034\034w%\377\260h}\223=\372n\365\334\265\246\217\365\024\252\017\245MT\032\332\fR\261\310\302\177\304\374\177\220\373-\321014\357\340\212\214=&z\017Q\3614\337L\nc'\364\207Z\362\366\233\360\005\354\t\211\223/a\021\314\243\001?!\327)\020\353\217\377\366\373\213Ax\211\007\266\2471\032x\205J\240_\375\345\256\247s\260FTS\007aR\361r\347\222\370\3125dd\022P\321\201\312\354Z\302\250\240\022{j\210@\240\3138\244\266\301>\225\003|1\333\376\177\221"
+	.string	" \243R\353\243/U\245$e\323\210\256( \235\004\375\200\367\350\370m\233F'\030\273\020\272\006Bl\336\345\025\202\357\326"
+	.string	"\305\204\333\333ln\002`\f\221\361\254\341F\257\214=\376x\201\236\232O+\346\034\367\200\212\240\007\303\302\261\224q\264&\302\023B\327\372t\330"
+	.string	"\246\276\320\237\320\234w\245\227\370\212\b\327\310\222n^\274"
+	.string	"\376\360~\200F\224q\337\213\200\223\223\006\363\247\233\375\366\307\236\311\202\021a\036v\t\b8\307|(\323\241:\333\330\031q\024\246I\320\264abL\210.Cf>\257{\243xt^\273\244xP\276\350\2158"
+	.ascii	"9\311\223\260]\246\240\245Y`\265r\353,\fj\002Q\031k\331\"#`\363"
+	.ascii	"#\257\bQ\272\260\241>\344i\264-\303\245\020\323\"H\212\304,1"
+	.ascii	"\001\t\t\213B\231\363\327\267Y|N\024\b\223PkN\267\211\332\225"
+	.ascii	"\370\004\364\333\2405\311\237\320\320e\331q\277\036\204\362\253"
+	.ascii	"\201}\300\023\034\013)\315\374v9\334\251\370\313\254-\331\353"
+	.ascii	"\217\350\301/\211~\245l\352\326\201\204\313Y\343_\241\212\264"
+	.ascii	"%p\022\n\315\377\310\270\022\334\242XmcmBZ\266\005\r\3665\313"
+	.ascii	"\030\030\312\230\231\206\"\374\364\200\261i\030 R"
+	.string	"\202n2\025\277Y\252Z\213\263\362/\267;o\204!T\327\t\334~^j\037\212w\302\366A\374\361\331\264\266\003\315\"\355[\355\245\023\225\020\001e\221\377\030(V\016\277\013\2648\"\206\2110\354\247\333\317\216\224\2014\277\215\3555\225%(\341\226eg\277\003J\303\253\302<\177\223\245UFnH\364\215\370\226=h(\205w\374MO\023Y\037\244eH\016b\331!`\241'\330\034lU\225\250\215\244\371R\"f\207\263\237\252\226\335\302\273\315\005O\262\310*6\231\202\242t\031R\r\034\265&\342bYnp\263\226)o\357\265\020\023 \032r\333\013\217\364p\034\240\324C\260\353\302\302\257\240\255\020\320D\323\200\216\001 \217\373\370\0137\177\256y\344J\200\307\264B\337\227 \315\347\251k\220M\023EjJ\277\352\216f>\0276\314\215\313iZ\261\333\266e\345(\207|\211b\277\312\020\3617\030\3748\331\354\345"
+	.ascii	"@\030\343\321\362\356}\244W\213 b\332(\233}\007v|\034~O\255\325"
+	.ascii	"C\251\025\032hNr\312R\333K\353a1\353\342K/\2341\217\351\331\373"
+	.ascii	"\003\275\320\376\334\372\221\343\002\234'(r\275\346\353\006"
+	.ascii	"8\354/5\004s\327\211\001\260\222\032\222\266N\016\252\320\347"
+	.ascii	"\201\334\246\254\221\315_\3059\364G\b\203\205P\346_\210\331\225"
+	.ascii	"w\331@\357\375c\t$1\322\335\351\340L\2460A\217\215\335\004\245"
+	.ascii	"\256\366U\230\230$\340\370h\030\307\202GN\312q\030\345\343\007"
+	.ascii	"\017Z;C\303\263\320\267\263\264\345\223\257\007\332\371\202A"
+	.ascii	"\260?\314\2455,\352\206p\345\200\222\304\264{Wm+\326\323\234"
+	.ascii	"6\231\227\266\273\\vU\242r\315\220M\263F\250u\001\233`\230Pe"
+	.ascii	"\363\226\352\306\320\007\363!9\206\257\006\317\026\033\220\024"
+	.ascii	"\263l\371\353-\2462\210\022g\030\371\314\260V\321\t\274\005t"
+	.ascii	"\016\331J~\221\203\030\334En\250\362~Fj\274\253p\330\341\330"
+	.ascii	"\2071x\337\274\311\224\346\361\363w\275\232\320\236\217\371\325"
+	.ascii	"?\271 Ta\016\\,Z\206$AZ\366\\\b\305>\254\367\267\035\237\207"
+	.ascii	"\031\340\214@|\241\235\367\203\227\213\0339A\277B\037AI\240R"
+	.ascii	"\333\227k\345\254\251n=\365\346\211"
+	.string	"\323\346\222wE\265\223(\037o\224\323\362\354\203\177Ti*\006l\263\230t\177X\267\275\220\332\375\310<\310\273\032:\364\316\242\324\025Gi7\246\343\020?\377\210\031\376\226Yn\333\203_\213\323\001;w\033\214\327Q\202\253J\276\336\360\301>1\314\026\313\374\034\241\343\267eWx\220\361\252|\273\310\330\022\307\322{^ty\ny\360iQW\377\350\364\220FE\367\353\222N:\310K\375^aoA\177\335\313y\237S\277fu\324\376\237\241p7\316\332\016\234w\316\320\005{\364R'\216\230\222C\006\342!Et\t\t\357\350\376\020\316\3230\313\341;\307\263\304\271[~s\307q\226\376\234KA\016\313\240N4\353\220\366\373\376\3220F\346q\262\033\034W\340\365\267\031\271G\3027m&:\2105k\372\336#;\326\344\021:\006\026_\214\366\303W\200\005\360\321\244\374\235\303\251\006\223d_H;\020\377\227d_"
+	.string	"\002\017\225\320\377\363\022\337\202\342\321\3745\201y\253`\326\233>\006\217\017e\027Wp\"\342\342\222\247\265`\335\037\354\201/\001:a\335KQ\304\200\204<L\\\016\200\375o\312\377\342\235[\214\266\013\036\177\340\367\203\253\034"
+	.string	"\303\035\364r\264\0044K\334,\022W\217c\034\034\373\017>_\030;\336\"\307\267\310\367QH4\3021\306\033\350\337\307=}\371\234{8\323|\005!w\357\236\213I{3\370\365~\336u\004\231\364\252\35230\262\002n\376CJ]\363\311\305\253\341\005\305g\217\336\257\267cH\344\327\226[>mz\354c\371\202\370\266\311Z\200\257\016\273\225\2737\236\033\356\317]\224\377\3264X\324\327\346\326[\t\323\347A?\345\335\233\033\346l\335,\242w\0206\346\355\345\233fu\364\355[\236+\237\234\206\204a\236\2778d\022uas:\030\3325X>\347\007\362\3270\361}\333\377\304\235\247\325$\344e\243\274a{\327\332\370\320\332\302\016\347\326\277Z\227d\270\025!\370\270\306|F\373\253\200\307:\2765"
+	.ascii	"\317\257\343\r\027$\001N\333\t|\272\016"
+	.string	"\344^\371\374\205 ;\313n\202\277\333X\377\t\237\301=\257\257\337\340\356\002\310\216\265Yc&_\314\355\2014\375\343~9\330#n9\375>\205-\213\335\360\375\342D\201\035\307Y)\016-\347\230\345\276sjnv\372\315U\345&0\253\t\273\354\362\333H\272\275\374%\316<\257\272\365R\307z\024\243\235a\317\216\343\3130NG\361\024\266\304\t|\256\321\\\251\224\313\317z\244\363\277%=\243\316/\032y\314\\[y\317\314\b$\276\272\362\305F\326\021\257\270\346\216\027F\321\360\t\373\233\212\356\036\215F\256\251\300\322$quo\324\264\r^o\177\003@\273>\364!\346\337D\335[\325s\022\262\021\324\335\017\035\344\244\207 wo\375\016\304\234\245\375\313i8\313W\365\333\274\362\212N\354\016~&\r:-\025\355\376\004\364\276\215O\305>6!\213gN\202I;@\252u\263\273\001h\177\230l\001h\257\346z"
+	.ascii	"\342\363\213\276\276\031n\227\271\353!\017d=E\211\217:\334\353"
+	.ascii	"2/\023\217\340\311\273w\2607\237\370\231Yl\005\005S\270\037\232"
+	.ascii	"e\337\265O\235\341^L\254\322\363-4\231\345\367s\261\213\334\236"
+	.ascii	"\203B|.\351\033\231\303\006\357\2371p\310\241\373\235}\304\341"
+	.ascii	"\256\376\234\032v\007\002=\013\023\275\361\322\261'6~\372\024"
+	.ascii	"\231>\f?I\353M\304\227[G\204&\003\202N\366\345\f1 \333\351P("
+	.ascii	"\3073\255M\332\246\344\260N~\217\3772\357:a=0\350\200\272\203"
+	.ascii	"8^C\210o\332\242h\361\252\303=\270\201\036\303\364 D~N\027\233"
+	.ascii	"\024\227\210\273\266\316\307`\034\332\035\200\366\2018\274rn"
+	.ascii	"\244r_n\"xB\3202\005~\375\357\225\257mC\274\002\3415\3208\314"
+	.ascii	"g\344\267oo\253?\200\246\333e\361\331\370\345\321\305U_\303\227"
+	.ascii	"A\233\372m\tqB\317Y\373\373(,\325\374'\177:z$\3630\260(w\253"
+	.ascii	"l\264\371\017"
+	.text
+	.section	.gnu.lto_.symtab.2fbcc39cf4c403b6,"e",@progbits
+	.string	"pidProfile_ProfileCurrent"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\003"
+	.string	""
+	.string	"axisPID"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\004"
+	.string	""
+	.string	"axisPID_P"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\004"
+	.string	""
+	.string	"axisPID_I"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\004"
+	.string	""
+	.string	"axisPID_D"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\004"
+	.string	""
+	.string	"axisPID_Setpoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"M\004"
+	.string	""
+	.string	"pidInitFilters"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\004"
+	.string	""
+	.string	"pidResetTPAFilter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\004"
+	.string	""
+	.string	"pidResetErrorAccumulators"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\004"
+	.string	""
+	.string	"pidAngleToRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\004"
+	.string	""
+	.string	"pidRateToRcCommand"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\004"
+	.string	""
+	.string	"pidRcCommandToRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\004"
+	.string	""
+	.string	"schedulePidGainsUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\004"
+	.string	""
+	.string	"updatePIDCoefficients"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\004"
+	.string	""
+	.string	"isFixedWingItermLimitActive"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"t\004"
+	.string	""
+	.string	"updateHeadingHoldTarget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\004"
+	.string	""
+	.string	"resetHeadingHoldTarget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\315\004"
+	.string	""
+	.string	"getHeadingHoldTarget"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\004"
+	.string	""
+	.string	"pidHeadingHold"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\004"
+	.string	""
+	.string	"pidController"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\335\004"
+	.string	""
+	.string	"pidIndexGetType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\004"
+	.string	""
+	.string	"pidInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\004"
+	.string	""
+	.string	"pidBank"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\005"
+	.string	""
+	.string	"pidBankMutable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\005"
+	.string	""
+	.string	"pgResetTemplate_pidProfile"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\005"
+	.string	""
+	.string	"pidProfile_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\005"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\003"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\003"
+	.string	""
+	.string	"motorConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\003"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\003"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\003"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\003"
+	.string	""
+	.string	"navConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\003"
+	.string	""
+	.string	"pitot"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\004"
+	.string	""
+	.string	"debugMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"0\004"
+	.string	""
+	.string	"debug"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\004"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\004"
+	.string	""
+	.string	"pt1FilterApply4"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\004"
+	.string	""
+	.string	"nullFilterApply4"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\004"
+	.string	""
+	.string	"nullFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\372\004"
+	.string	""
+	.string	"pt1FilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\005"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\005"
+	.string	""
+	.string	"constrainf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\005"
+	.string	""
+	.string	"getThrottleIdleValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\005"
+	.string	""
+	.string	"scaleRangef"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"j\005"
+	.string	""
+	.string	"constrain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\005"
+	.string	""
+	.string	"navigationGetHeadingControlState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"w\005"
+	.string	""
+	.string	"calculateCosTiltAngle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\005"
+	.string	""
+	.string	"getRcStickDeflection"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\005"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\005"
+	.string	""
+	.string	"navigationIsControllingThrottle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\005"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\005"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\005"
+	.string	""
+	.string	"imuTransformVectorEarthToBody"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\005"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\005"
+	.string	""
+	.string	"rateLimitFilterApply4"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\005"
+	.string	""
+	.string	"mixerIsOutputSaturated"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\005"
+	.string	""
+	.string	"getMotorMixRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\005"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\307\005"
+	.string	""
+	.string	"fapplyDeadbandf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\005"
+	.string	""
+	.string	"getLooptime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\323\005"
+	.string	""
+	.string	"pt1FilterInitRC"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\005"
+	.string	""
+	.string	"pt1FilterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\005"
+	.string	""
+	.string	"autotuneFixedWingUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\005"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\005"
+	.string	""
+	.string	"pt1FilterInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\005"
+	.string	""
+	.string	"rxGetChannelValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\005"
+	.string	""
+	.string	"pt1FilterApply3"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\006"
+	.string	""
+	.string	"getRcCommandOverride"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\006"
+	.string	""
+	.string	"gyroKalmanSetSetpoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\006"
+	.string	""
+	.string	"navigationRequiresTurnAssistance"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\006"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\006"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2fbcc39cf4c403b6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
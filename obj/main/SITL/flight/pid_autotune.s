@@ -0,0 +1,13693 @@
+	.file	"pid_autotune.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/blackbox/blackbox_fielddefs.h"
+	.file 7 "./src/main/common/axis.h"
+	.file 8 "./src/main/drivers/adc.h"
+	.file 9 "./src/main/fc/config.h"
+	.file 10 "./src/main/fc/controlrate_profile.h"
+	.file 11 "./src/main/fc/rc_controls.h"
+	.file 12 "./src/main/fc/rc_modes.h"
+	.file 13 "./src/main/fc/rc_adjustments.h"
+	.file 14 "./src/main/fc/runtime_config.h"
+	.file 15 "./src/main/flight/pid.h"
+	.file 16 "./src/main/flight/pid_autotune.c"
+	.file 17 "./src/main/config/feature.h"
+	.file 18 "./src/main/common/maths.h"
+	.file 19 "./src/main/drivers/time.h"
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 21 "./src/main/blackbox/blackbox.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	pid_autotune.c.a4fc589e
+	.weak	pid_autotune.c.a4fc589e
+pid_autotune.c.a4fc589e:
+	.long	0x10bc
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1c
+	.long	.LASF1965
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1578
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1579
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1580
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1581
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1582
+	.uleb128 0x3
+	.long	.LASF1583
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1584
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x7
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1585
+	.uleb128 0x3
+	.long	.LASF1586
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1587
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1588
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1589
+	.uleb128 0x3
+	.long	.LASF1590
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x1e
+	.byte	0x8
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1591
+	.uleb128 0x3
+	.long	.LASF1592
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1593
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1594
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF1595
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1596
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x3
+	.long	.LASF1597
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1598
+	.uleb128 0xc
+	.long	0xf3
+	.uleb128 0x7
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1599
+	.uleb128 0x3
+	.long	.LASF1600
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xcf
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x140
+	.uleb128 0x5
+	.long	.LASF1601
+	.value	0xfff
+	.uleb128 0x5
+	.long	.LASF1602
+	.value	0xf000
+	.uleb128 0x5
+	.long	.LASF1603
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1605
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1606
+	.byte	0x4
+	.byte	0x2a
+	.byte	0xf
+	.long	0x14c
+	.uleb128 0x1f
+	.long	0x157
+	.uleb128 0x8
+	.long	0xa2
+	.byte	0
+	.uleb128 0x20
+	.byte	0x8
+	.byte	0x4
+	.byte	0x32
+	.byte	0x5
+	.long	0x176
+	.uleb128 0x18
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0xa2
+	.uleb128 0x18
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x176
+	.byte	0
+	.uleb128 0x9
+	.long	0x140
+	.uleb128 0xa
+	.long	.LASF1622
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2c
+	.long	0x1d6
+	.uleb128 0xe
+	.string	"pgn"
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xb
+	.long	0x106
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1607
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0xcf
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1608
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1d6
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1609
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x1d6
+	.byte	0x10
+	.uleb128 0xe
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x31
+	.byte	0xf
+	.long	0x1db
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1610
+	.byte	0x4
+	.byte	0x35
+	.byte	0x7
+	.long	0x157
+	.byte	0x20
+	.byte	0
+	.uleb128 0x9
+	.long	0xc3
+	.uleb128 0x9
+	.long	0x1d6
+	.uleb128 0x3
+	.long	.LASF1611
+	.byte	0x4
+	.byte	0x36
+	.byte	0x3
+	.long	0x17b
+	.uleb128 0xc
+	.long	0x1e0
+	.uleb128 0x3
+	.long	.LASF1612
+	.byte	0x5
+	.byte	0x1c
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0xc
+	.long	0x1f1
+	.uleb128 0x3
+	.long	.LASF1613
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x12
+	.long	0xdb
+	.uleb128 0xc
+	.long	0x202
+	.uleb128 0x3
+	.long	.LASF1614
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0xe7
+	.uleb128 0x19
+	.long	.LASF1621
+	.long	0x30
+	.byte	0x6
+	.byte	0x78
+	.long	0x253
+	.uleb128 0x1
+	.long	.LASF1615
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1616
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1617
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1618
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1619
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1620
+	.byte	0xff
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1621
+	.byte	0x6
+	.byte	0x7f
+	.byte	0x3
+	.long	0x21f
+	.uleb128 0xa
+	.long	.LASF1623
+	.byte	0x4
+	.byte	0x6
+	.byte	0x81
+	.long	0x279
+	.uleb128 0x2
+	.long	.LASF1624
+	.byte	0x6
+	.byte	0x82
+	.byte	0xe
+	.long	0xdb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1625
+	.byte	0x6
+	.byte	0x83
+	.byte	0x3
+	.long	0x25f
+	.uleb128 0xa
+	.long	.LASF1626
+	.byte	0x8
+	.byte	0x6
+	.byte	0x85
+	.long	0x2ac
+	.uleb128 0x2
+	.long	.LASF1627
+	.byte	0x6
+	.byte	0x86
+	.byte	0xe
+	.long	0xdb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1628
+	.byte	0x6
+	.byte	0x87
+	.byte	0xe
+	.long	0xdb
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1629
+	.byte	0x6
+	.byte	0x88
+	.byte	0x3
+	.long	0x285
+	.uleb128 0xa
+	.long	.LASF1630
+	.byte	0xc
+	.byte	0x6
+	.byte	0x8a
+	.long	0x2f9
+	.uleb128 0x2
+	.long	.LASF1631
+	.byte	0x6
+	.byte	0x8b
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1632
+	.byte	0x6
+	.byte	0x8c
+	.byte	0x9
+	.long	0x2f9
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1633
+	.byte	0x6
+	.byte	0x8d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1634
+	.byte	0x6
+	.byte	0x8e
+	.byte	0xb
+	.long	0xf3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1635
+	.uleb128 0x3
+	.long	.LASF1636
+	.byte	0x6
+	.byte	0x8f
+	.byte	0x3
+	.long	0x2b8
+	.uleb128 0xa
+	.long	.LASF1637
+	.byte	0x10
+	.byte	0x6
+	.byte	0x91
+	.long	0x333
+	.uleb128 0x2
+	.long	.LASF1638
+	.byte	0x6
+	.byte	0x92
+	.byte	0xe
+	.long	0xdb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1639
+	.byte	0x6
+	.byte	0x93
+	.byte	0xe
+	.long	0x213
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1640
+	.byte	0x6
+	.byte	0x94
+	.byte	0x3
+	.long	0x30c
+	.uleb128 0xa
+	.long	.LASF1641
+	.byte	0x4
+	.byte	0x6
+	.byte	0x96
+	.long	0x359
+	.uleb128 0x2
+	.long	.LASF1642
+	.byte	0x6
+	.byte	0x97
+	.byte	0xe
+	.long	0xdb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1643
+	.byte	0x6
+	.byte	0x98
+	.byte	0x3
+	.long	0x33f
+	.uleb128 0x21
+	.long	.LASF1966
+	.byte	0x10
+	.byte	0x6
+	.byte	0x9c
+	.byte	0xf
+	.long	0x3aa
+	.uleb128 0x10
+	.long	.LASF1644
+	.byte	0x9d
+	.byte	0x1f
+	.long	0x279
+	.uleb128 0x10
+	.long	.LASF1645
+	.byte	0x9e
+	.byte	0x21
+	.long	0x2ac
+	.uleb128 0x10
+	.long	.LASF1646
+	.byte	0x9f
+	.byte	0x29
+	.long	0x300
+	.uleb128 0x10
+	.long	.LASF1647
+	.byte	0xa0
+	.byte	0x24
+	.long	0x333
+	.uleb128 0x10
+	.long	.LASF1648
+	.byte	0xa1
+	.byte	0x1f
+	.long	0x359
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1649
+	.byte	0x6
+	.byte	0xa2
+	.byte	0x3
+	.long	0x365
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x7
+	.byte	0x1d
+	.long	0x3d4
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1653
+	.byte	0x7
+	.byte	0x21
+	.byte	0x3
+	.long	0x3b6
+	.uleb128 0xc
+	.long	0x3d4
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x8
+	.byte	0x16
+	.long	0x40f
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1655
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1656
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1657
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1658
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x9
+	.byte	0x26
+	.long	0x50a
+	.uleb128 0x1
+	.long	.LASF1659
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1660
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1661
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1662
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1663
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1664
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1665
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1666
+	.byte	0x80
+	.uleb128 0x5
+	.long	.LASF1667
+	.value	0x100
+	.uleb128 0x5
+	.long	.LASF1668
+	.value	0x200
+	.uleb128 0x5
+	.long	.LASF1669
+	.value	0x400
+	.uleb128 0x5
+	.long	.LASF1670
+	.value	0x800
+	.uleb128 0x5
+	.long	.LASF1671
+	.value	0x1000
+	.uleb128 0x5
+	.long	.LASF1672
+	.value	0x2000
+	.uleb128 0x5
+	.long	.LASF1673
+	.value	0x4000
+	.uleb128 0x5
+	.long	.LASF1674
+	.value	0x8000
+	.uleb128 0x4
+	.long	.LASF1675
+	.long	0x10000
+	.uleb128 0x4
+	.long	.LASF1676
+	.long	0x20000
+	.uleb128 0x4
+	.long	.LASF1677
+	.long	0x40000
+	.uleb128 0x4
+	.long	.LASF1678
+	.long	0x80000
+	.uleb128 0x4
+	.long	.LASF1679
+	.long	0x100000
+	.uleb128 0x4
+	.long	.LASF1680
+	.long	0x200000
+	.uleb128 0x4
+	.long	.LASF1681
+	.long	0x400000
+	.uleb128 0x4
+	.long	.LASF1682
+	.long	0x800000
+	.uleb128 0x4
+	.long	.LASF1683
+	.long	0x1000000
+	.uleb128 0x4
+	.long	.LASF1684
+	.long	0x2000000
+	.uleb128 0x4
+	.long	.LASF1685
+	.long	0x4000000
+	.uleb128 0x4
+	.long	.LASF1686
+	.long	0x8000000
+	.uleb128 0x4
+	.long	.LASF1687
+	.long	0x10000000
+	.uleb128 0x4
+	.long	.LASF1688
+	.long	0x20000000
+	.uleb128 0x4
+	.long	.LASF1689
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x11
+	.byte	0x8
+	.byte	0xa
+	.byte	0x2d
+	.byte	0x5
+	.long	0x555
+	.uleb128 0x2
+	.long	.LASF1690
+	.byte	0xa
+	.byte	0x2e
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1691
+	.byte	0xa
+	.byte	0x2f
+	.byte	0x11
+	.long	0xc3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1692
+	.byte	0xa
+	.byte	0x30
+	.byte	0x11
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1693
+	.byte	0xa
+	.byte	0x31
+	.byte	0x12
+	.long	0xcf
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1694
+	.byte	0xa
+	.byte	0x32
+	.byte	0x12
+	.long	0xcf
+	.byte	0x6
+	.byte	0
+	.uleb128 0x11
+	.byte	0x5
+	.byte	0xa
+	.byte	0x35
+	.byte	0x5
+	.long	0x586
+	.uleb128 0x2
+	.long	.LASF1691
+	.byte	0xa
+	.byte	0x36
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1695
+	.byte	0xa
+	.byte	0x37
+	.byte	0x11
+	.long	0xc3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1696
+	.byte	0xa
+	.byte	0x38
+	.byte	0x11
+	.long	0x586
+	.byte	0x2
+	.byte	0
+	.uleb128 0x14
+	.long	0xc3
+	.long	0x596
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x11
+	.byte	0x5
+	.byte	0xa
+	.byte	0x3b
+	.byte	0x5
+	.long	0x5c7
+	.uleb128 0x2
+	.long	.LASF1691
+	.byte	0xa
+	.byte	0x3c
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1695
+	.byte	0xa
+	.byte	0x3d
+	.byte	0x11
+	.long	0xc3
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1696
+	.byte	0xa
+	.byte	0x3e
+	.byte	0x11
+	.long	0x586
+	.byte	0x2
+	.byte	0
+	.uleb128 0x11
+	.byte	0x1
+	.byte	0xa
+	.byte	0x41
+	.byte	0x5
+	.long	0x5de
+	.uleb128 0x2
+	.long	.LASF1697
+	.byte	0xa
+	.byte	0x42
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1698
+	.byte	0x14
+	.byte	0xa
+	.byte	0x2b
+	.long	0x61f
+	.uleb128 0x2
+	.long	.LASF1699
+	.byte	0xa
+	.byte	0x33
+	.byte	0x7
+	.long	0x50a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1700
+	.byte	0xa
+	.byte	0x39
+	.byte	0x7
+	.long	0x555
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1701
+	.byte	0xa
+	.byte	0x3f
+	.byte	0x7
+	.long	0x596
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF1702
+	.byte	0xa
+	.byte	0x43
+	.byte	0x7
+	.long	0x5c7
+	.byte	0x12
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1703
+	.byte	0xa
+	.byte	0x45
+	.byte	0x3
+	.long	0x5de
+	.uleb128 0xc
+	.long	0x61f
+	.uleb128 0xd
+	.long	.LASF1840
+	.byte	0xa
+	.byte	0x49
+	.byte	0x23
+	.long	0x63c
+	.uleb128 0x9
+	.long	0x62b
+	.uleb128 0x19
+	.long	.LASF1704
+	.long	0x30
+	.byte	0xb
+	.byte	0x18
+	.long	0x6b1
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0x1
+	.uleb128 0x22
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1710
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1717
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0xf
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xc
+	.byte	0x1c
+	.long	0x7bf
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1729
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1730
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1731
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1748
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1749
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1752
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1754
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1756
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1757
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1758
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1759
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1760
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1761
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1762
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1763
+	.byte	0xc
+	.byte	0x48
+	.byte	0x3
+	.long	0x6b1
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xd
+	.byte	0x1b
+	.long	0x909
+	.uleb128 0x1
+	.long	.LASF1764
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1765
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1766
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1767
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1768
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1770
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1771
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1772
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1773
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1774
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1775
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1776
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1777
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1778
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1779
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1780
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1781
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1782
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1783
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1784
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1785
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1786
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1787
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1788
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1789
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1790
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1791
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1792
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1793
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1794
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1795
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1796
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1797
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1798
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1799
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1800
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1801
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1802
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1803
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1804
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1805
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1806
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1807
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1808
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1809
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1810
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF1811
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF1812
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1813
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF1814
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1815
+	.byte	0xd
+	.byte	0x52
+	.byte	0x3
+	.long	0x7cb
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xe
+	.byte	0x15
+	.long	0x9e0
+	.uleb128 0x1
+	.long	.LASF1816
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1817
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1818
+	.byte	0x80
+	.uleb128 0x5
+	.long	.LASF1819
+	.value	0x100
+	.uleb128 0x5
+	.long	.LASF1820
+	.value	0x200
+	.uleb128 0x5
+	.long	.LASF1821
+	.value	0x400
+	.uleb128 0x5
+	.long	.LASF1822
+	.value	0x800
+	.uleb128 0x5
+	.long	.LASF1823
+	.value	0x1000
+	.uleb128 0x5
+	.long	.LASF1824
+	.value	0x2000
+	.uleb128 0x5
+	.long	.LASF1825
+	.value	0x4000
+	.uleb128 0x5
+	.long	.LASF1826
+	.value	0x8000
+	.uleb128 0x4
+	.long	.LASF1827
+	.long	0x10000
+	.uleb128 0x4
+	.long	.LASF1828
+	.long	0x20000
+	.uleb128 0x4
+	.long	.LASF1829
+	.long	0x40000
+	.uleb128 0x4
+	.long	.LASF1830
+	.long	0x80000
+	.uleb128 0x4
+	.long	.LASF1831
+	.long	0x100000
+	.uleb128 0x4
+	.long	.LASF1832
+	.long	0x200000
+	.uleb128 0x4
+	.long	.LASF1833
+	.long	0x400000
+	.uleb128 0x4
+	.long	.LASF1834
+	.long	0x800000
+	.uleb128 0x4
+	.long	.LASF1835
+	.long	0x1000000
+	.uleb128 0x4
+	.long	.LASF1836
+	.long	0x2000000
+	.uleb128 0x4
+	.long	.LASF1837
+	.long	0x4000000
+	.uleb128 0x4
+	.long	.LASF1838
+	.long	0x8000000
+	.uleb128 0x4
+	.long	.LASF1839
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1841
+	.byte	0xe
+	.byte	0x47
+	.byte	0x11
+	.long	0xdb
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xe
+	.byte	0x54
+	.long	0xa59
+	.uleb128 0x1
+	.long	.LASF1842
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1843
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1844
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1845
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1846
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1847
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1848
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1849
+	.byte	0x80
+	.uleb128 0x5
+	.long	.LASF1850
+	.value	0x100
+	.uleb128 0x5
+	.long	.LASF1851
+	.value	0x200
+	.uleb128 0x5
+	.long	.LASF1852
+	.value	0x400
+	.uleb128 0x5
+	.long	.LASF1853
+	.value	0x800
+	.uleb128 0x5
+	.long	.LASF1854
+	.value	0x1000
+	.uleb128 0x5
+	.long	.LASF1855
+	.value	0x2000
+	.uleb128 0x5
+	.long	.LASF1856
+	.value	0x4000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1857
+	.byte	0xe
+	.byte	0x64
+	.byte	0x3
+	.long	0x9ec
+	.uleb128 0xd
+	.long	.LASF1858
+	.byte	0xe
+	.byte	0x66
+	.byte	0x11
+	.long	0xdb
+	.uleb128 0xb
+	.long	0x30
+	.byte	0xf
+	.byte	0x39
+	.long	0xac5
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1862
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1863
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1865
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1866
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1867
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1868
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1869
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1870
+	.byte	0xb
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1871
+	.byte	0x4
+	.byte	0xf
+	.byte	0x51
+	.long	0xaff
+	.uleb128 0xe
+	.string	"P"
+	.byte	0xf
+	.byte	0x52
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0xe
+	.string	"I"
+	.byte	0xf
+	.byte	0x53
+	.byte	0xd
+	.long	0xc3
+	.byte	0x1
+	.uleb128 0xe
+	.string	"D"
+	.byte	0xf
+	.byte	0x54
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0xe
+	.string	"FF"
+	.byte	0xf
+	.byte	0x55
+	.byte	0xd
+	.long	0xc3
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1872
+	.byte	0xf
+	.byte	0x56
+	.byte	0x3
+	.long	0xac5
+	.uleb128 0xa
+	.long	.LASF1873
+	.byte	0x2c
+	.byte	0xf
+	.byte	0x58
+	.long	0xb25
+	.uleb128 0xe
+	.string	"pid"
+	.byte	0xf
+	.byte	0x59
+	.byte	0xc
+	.long	0xb25
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0xaff
+	.long	0xb35
+	.uleb128 0x15
+	.long	0x37
+	.byte	0xa
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1874
+	.byte	0xf
+	.byte	0x5a
+	.byte	0x3
+	.long	0xb0b
+	.uleb128 0xc
+	.long	0xb35
+	.uleb128 0xa
+	.long	.LASF1875
+	.byte	0xac
+	.byte	0xf
+	.byte	0x67
+	.long	0xcf3
+	.uleb128 0x2
+	.long	.LASF1876
+	.byte	0xf
+	.byte	0x68
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1877
+	.byte	0xf
+	.byte	0x69
+	.byte	0xf
+	.long	0xb35
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1878
+	.byte	0xf
+	.byte	0x6a
+	.byte	0xf
+	.long	0xb35
+	.byte	0x2d
+	.uleb128 0x2
+	.long	.LASF1879
+	.byte	0xf
+	.byte	0x6c
+	.byte	0xd
+	.long	0xc3
+	.byte	0x59
+	.uleb128 0x2
+	.long	.LASF1880
+	.byte	0xf
+	.byte	0x6d
+	.byte	0xe
+	.long	0xcf
+	.byte	0x5a
+	.uleb128 0x2
+	.long	.LASF1881
+	.byte	0xf
+	.byte	0x6f
+	.byte	0xd
+	.long	0xc3
+	.byte	0x5c
+	.uleb128 0x2
+	.long	.LASF1882
+	.byte	0xf
+	.byte	0x70
+	.byte	0xe
+	.long	0xcf
+	.byte	0x5e
+	.uleb128 0x2
+	.long	.LASF1883
+	.byte	0xf
+	.byte	0x72
+	.byte	0xd
+	.long	0xc3
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF1884
+	.byte	0xf
+	.byte	0x74
+	.byte	0xd
+	.long	0xc3
+	.byte	0x61
+	.uleb128 0x2
+	.long	.LASF1885
+	.byte	0xf
+	.byte	0x76
+	.byte	0xd
+	.long	0xc3
+	.byte	0x62
+	.uleb128 0x2
+	.long	.LASF1886
+	.byte	0xf
+	.byte	0x78
+	.byte	0xe
+	.long	0xdb
+	.byte	0x64
+	.uleb128 0x2
+	.long	.LASF1887
+	.byte	0xf
+	.byte	0x79
+	.byte	0xe
+	.long	0xdb
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF1888
+	.byte	0xf
+	.byte	0x7b
+	.byte	0xd
+	.long	0xcf3
+	.byte	0x6c
+	.uleb128 0x2
+	.long	.LASF1889
+	.byte	0xf
+	.byte	0x7d
+	.byte	0xe
+	.long	0xcf
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF1890
+	.byte	0xf
+	.byte	0x7e
+	.byte	0xe
+	.long	0xcf
+	.byte	0x72
+	.uleb128 0x2
+	.long	.LASF1891
+	.byte	0xf
+	.byte	0x81
+	.byte	0xe
+	.long	0xcf
+	.byte	0x74
+	.uleb128 0x2
+	.long	.LASF1892
+	.byte	0xf
+	.byte	0x82
+	.byte	0xb
+	.long	0xf3
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF1893
+	.byte	0xf
+	.byte	0x83
+	.byte	0xb
+	.long	0xf3
+	.byte	0x7c
+	.uleb128 0x2
+	.long	.LASF1894
+	.byte	0xf
+	.byte	0x84
+	.byte	0xb
+	.long	0xf3
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF1895
+	.byte	0xf
+	.byte	0x86
+	.byte	0xd
+	.long	0xc3
+	.byte	0x84
+	.uleb128 0x2
+	.long	.LASF1896
+	.byte	0xf
+	.byte	0x87
+	.byte	0xb
+	.long	0xf3
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF1897
+	.byte	0xf
+	.byte	0x89
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8c
+	.uleb128 0x2
+	.long	.LASF1898
+	.byte	0xf
+	.byte	0x8a
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8d
+	.uleb128 0x2
+	.long	.LASF1899
+	.byte	0xf
+	.byte	0x8b
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8e
+	.uleb128 0x2
+	.long	.LASF1900
+	.byte	0xf
+	.byte	0x8d
+	.byte	0xb
+	.long	0xf3
+	.byte	0x90
+	.uleb128 0x2
+	.long	.LASF1901
+	.byte	0xf
+	.byte	0x8e
+	.byte	0xb
+	.long	0xf3
+	.byte	0x94
+	.uleb128 0x2
+	.long	.LASF1902
+	.byte	0xf
+	.byte	0x8f
+	.byte	0xd
+	.long	0xc3
+	.byte	0x98
+	.uleb128 0x2
+	.long	.LASF1903
+	.byte	0xf
+	.byte	0x90
+	.byte	0xb
+	.long	0xf3
+	.byte	0x9c
+	.uleb128 0x2
+	.long	.LASF1904
+	.byte	0xf
+	.byte	0x91
+	.byte	0xb
+	.long	0xf3
+	.byte	0xa0
+	.uleb128 0x2
+	.long	.LASF1905
+	.byte	0xf
+	.byte	0x92
+	.byte	0xd
+	.long	0xc3
+	.byte	0xa4
+	.uleb128 0x2
+	.long	.LASF1906
+	.byte	0xf
+	.byte	0x94
+	.byte	0xe
+	.long	0xcf
+	.byte	0xa6
+	.uleb128 0x2
+	.long	.LASF1907
+	.byte	0xf
+	.byte	0x95
+	.byte	0xd
+	.long	0xc3
+	.byte	0xa8
+	.byte	0
+	.uleb128 0x14
+	.long	0xab
+	.long	0xd03
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1908
+	.byte	0xf
+	.byte	0x96
+	.byte	0x3
+	.long	0xb46
+	.uleb128 0xc
+	.long	0xd03
+	.uleb128 0xa
+	.long	.LASF1909
+	.byte	0x8
+	.byte	0xf
+	.byte	0x98
+	.long	0xd62
+	.uleb128 0x2
+	.long	.LASF1910
+	.byte	0xf
+	.byte	0x99
+	.byte	0xe
+	.long	0xcf
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1911
+	.byte	0xf
+	.byte	0x9a
+	.byte	0xe
+	.long	0xcf
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1912
+	.byte	0xf
+	.byte	0x9b
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1913
+	.byte	0xf
+	.byte	0x9c
+	.byte	0xd
+	.long	0xc3
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1914
+	.byte	0xf
+	.byte	0x9d
+	.byte	0xe
+	.long	0xcf
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1915
+	.byte	0xf
+	.byte	0x9e
+	.byte	0x3
+	.long	0xd14
+	.uleb128 0xc
+	.long	0xd62
+	.uleb128 0xd
+	.long	.LASF1916
+	.byte	0xf
+	.byte	0xa0
+	.byte	0x16
+	.long	0xd7f
+	.uleb128 0x9
+	.long	0xd03
+	.uleb128 0xd
+	.long	.LASF1917
+	.byte	0xf
+	.byte	0xa1
+	.byte	0x1c
+	.long	0xd62
+	.uleb128 0xd
+	.long	.LASF1918
+	.byte	0xf
+	.byte	0xa1
+	.byte	0x51
+	.long	0xd62
+	.uleb128 0xd
+	.long	.LASF1919
+	.byte	0x10
+	.byte	0x36
+	.byte	0x22
+	.long	0xd6e
+	.uleb128 0x1a
+	.long	0xd84
+	.byte	0x59
+	.uleb128 0x1a
+	.long	0xd90
+	.byte	0x87
+	.uleb128 0xd
+	.long	.LASF1920
+	.byte	0x10
+	.byte	0x36
+	.byte	0xb9
+	.long	0x1ec
+	.uleb128 0x23
+	.long	0xdb4
+	.byte	0xe8
+	.uleb128 0x24
+	.long	0xd9c
+	.byte	0x38
+	.byte	0x1b
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x10
+	.byte	0x40
+	.long	0xdeb
+	.uleb128 0x1
+	.long	.LASF1921
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1922
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1923
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1924
+	.byte	0x10
+	.byte	0x44
+	.byte	0x3
+	.long	0xdcd
+	.uleb128 0x11
+	.byte	0x18
+	.byte	0x10
+	.byte	0x46
+	.byte	0x9
+	.long	0xe4f
+	.uleb128 0x2
+	.long	.LASF1925
+	.byte	0x10
+	.byte	0x47
+	.byte	0x18
+	.long	0xdeb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1926
+	.byte	0x10
+	.byte	0x48
+	.byte	0xe
+	.long	0x202
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1927
+	.byte	0x10
+	.byte	0x4a
+	.byte	0xc
+	.long	0x2f9
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1928
+	.byte	0x10
+	.byte	0x4b
+	.byte	0xb
+	.long	0xf3
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF1929
+	.byte	0x10
+	.byte	0x4c
+	.byte	0xb
+	.long	0xf3
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1930
+	.byte	0x10
+	.byte	0x4d
+	.byte	0xb
+	.long	0xf3
+	.byte	0x14
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1931
+	.byte	0x10
+	.byte	0x4e
+	.byte	0x3
+	.long	0xdf7
+	.uleb128 0x14
+	.long	0xe4f
+	.long	0xe6b
+	.uleb128 0x15
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1932
+	.byte	0x54
+	.byte	0x1a
+	.long	0xe5b
+	.uleb128 0x6
+	.long	.LASF1933
+	.byte	0x55
+	.byte	0x1a
+	.long	0xe5b
+	.uleb128 0x6
+	.long	.LASF1934
+	.byte	0x56
+	.byte	0x11
+	.long	0x202
+	.uleb128 0x25
+	.long	.LASF1967
+	.byte	0x15
+	.byte	0x22
+	.byte	0x6
+	.long	0xea3
+	.uleb128 0x8
+	.long	0x253
+	.uleb128 0x8
+	.long	0xea3
+	.byte	0
+	.uleb128 0x9
+	.long	0x3aa
+	.uleb128 0x12
+	.long	.LASF1935
+	.byte	0x11
+	.byte	0x1e
+	.byte	0x5
+	.long	0x2f9
+	.long	0xebe
+	.uleb128 0x8
+	.long	0xdb
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1936
+	.byte	0x12
+	.byte	0x88
+	.byte	0x7
+	.long	0xf3
+	.long	0xede
+	.uleb128 0x8
+	.long	0xf3
+	.uleb128 0x8
+	.long	0xf3
+	.uleb128 0x8
+	.long	0xf3
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1937
+	.byte	0xe
+	.byte	0xa1
+	.byte	0xa
+	.long	0xdb
+	.long	0xef4
+	.uleb128 0x8
+	.long	0xa59
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1938
+	.byte	0xe
+	.byte	0xa0
+	.byte	0xa
+	.long	0xdb
+	.long	0xf0a
+	.uleb128 0x8
+	.long	0xa59
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1939
+	.byte	0xc
+	.byte	0x77
+	.byte	0x5
+	.long	0x2f9
+	.long	0xf20
+	.uleb128 0x8
+	.long	0x7bf
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1940
+	.byte	0xf
+	.byte	0xa3
+	.byte	0x13
+	.long	0xf2c
+	.uleb128 0x9
+	.long	0xb41
+	.uleb128 0x17
+	.long	.LASF1941
+	.byte	0x13
+	.byte	0x1d
+	.byte	0xa
+	.long	0x202
+	.uleb128 0x26
+	.long	.LASF1968
+	.byte	0xf
+	.byte	0xb2
+	.byte	0x6
+	.uleb128 0x17
+	.long	.LASF1942
+	.byte	0xf
+	.byte	0xa4
+	.byte	0xd
+	.long	0xf51
+	.uleb128 0x9
+	.long	0xb35
+	.uleb128 0x27
+	.long	.LASF1943
+	.byte	0x14
+	.value	0x13d
+	.byte	0x11
+	.long	0x8f
+	.long	0xf6d
+	.uleb128 0x8
+	.long	0xf3
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1958
+	.byte	0xa5
+	.long	0x1011
+	.uleb128 0xf
+	.long	.LASF1944
+	.byte	0xa5
+	.byte	0x3c
+	.long	0x3e0
+	.uleb128 0xf
+	.long	.LASF1945
+	.byte	0xa5
+	.byte	0x48
+	.long	0xf3
+	.uleb128 0xf
+	.long	.LASF1946
+	.byte	0xa5
+	.byte	0x5e
+	.long	0xf3
+	.uleb128 0xf
+	.long	.LASF1947
+	.byte	0xa5
+	.byte	0x74
+	.long	0xf3
+	.uleb128 0x6
+	.long	.LASF1948
+	.byte	0xa7
+	.byte	0x14
+	.long	0x20e
+	.uleb128 0x6
+	.long	.LASF1949
+	.byte	0xa8
+	.byte	0x11
+	.long	0xfa
+	.uleb128 0x6
+	.long	.LASF1950
+	.byte	0xa9
+	.byte	0xb
+	.long	0xf3
+	.uleb128 0x6
+	.long	.LASF1951
+	.byte	0xaa
+	.byte	0x18
+	.long	0xdeb
+	.uleb128 0x28
+	.long	0xff8
+	.uleb128 0x6
+	.long	.LASF1952
+	.byte	0xaf
+	.byte	0xf
+	.long	0xf3
+	.uleb128 0x13
+	.uleb128 0x6
+	.long	.LASF1953
+	.byte	0xb0
+	.byte	0x48
+	.long	0xf3
+	.uleb128 0x6
+	.long	.LASF1954
+	.byte	0xb0
+	.byte	0x89
+	.long	0xf3
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x6
+	.long	.LASF1955
+	.byte	0xc4
+	.byte	0x1b
+	.long	0x1fd
+	.uleb128 0x6
+	.long	.LASF1956
+	.byte	0xc5
+	.byte	0xd
+	.long	0x2f9
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.long	.LASF1969
+	.byte	0x10
+	.byte	0x93
+	.byte	0xd
+	.long	0x1041
+	.uleb128 0xf
+	.long	.LASF1631
+	.byte	0x93
+	.byte	0x3b
+	.long	0x909
+	.uleb128 0xf
+	.long	.LASF1633
+	.byte	0x93
+	.byte	0x57
+	.long	0xb7
+	.uleb128 0x13
+	.uleb128 0x6
+	.long	.LASF1957
+	.byte	0x9a
+	.byte	0x2d
+	.long	0x300
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1970
+	.byte	0x10
+	.byte	0x80
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF1959
+	.byte	0x71
+	.long	0x1061
+	.uleb128 0x13
+	.uleb128 0x6
+	.long	.LASF1944
+	.byte	0x73
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1960
+	.byte	0x63
+	.long	0x1077
+	.uleb128 0x6
+	.long	.LASF1948
+	.byte	0x65
+	.byte	0x14
+	.long	0x20e
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1961
+	.byte	0x58
+	.long	0x109a
+	.uleb128 0xf
+	.long	.LASF1962
+	.byte	0x58
+	.byte	0x2e
+	.long	0x109a
+	.uleb128 0x13
+	.uleb128 0x6
+	.long	.LASF1944
+	.byte	0x5a
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0xe4f
+	.uleb128 0x1b
+	.long	.LASF1963
+	.byte	0xa1
+	.byte	0x92
+	.long	0x10aa
+	.uleb128 0x9
+	.long	0xd6e
+	.uleb128 0x1b
+	.long	.LASF1964
+	.byte	0xa0
+	.byte	0x53
+	.long	0x10ba
+	.uleb128 0x9
+	.long	0xd0f
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 54
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 22 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 23 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 24 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x18
+	.file 25 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1a
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 27 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 28 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x1c
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1e
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 31 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 33 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x21
+	.file 34 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 38 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 39 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 42 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 43 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2c
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1004
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1031
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 52 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x34
+	.file 53 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 54 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x36
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 55 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x37
+	.byte	0x4
+	.file 56 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x15
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4
+	.file 57 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 58 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x3a
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x13
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x11
+	.byte	0x4
+	.file 59 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8
+	.file 60 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1505
+	.byte	0x4
+	.file 61 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1506
+	.byte	0x4
+	.file 62 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1518
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xc
+	.file 63 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3f
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1577
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF996
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1003
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1025
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1030
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1033
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1035
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1060
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1063
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1082
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1083
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1084
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1085
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1086
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1087
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1124
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1217
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1230
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1231
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1250
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1273
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1274
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1275
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1276
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1285
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1286
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1287
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1288
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1289
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1290
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1291
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1292
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1293
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1294
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1295
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1296
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1312
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1277
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1320
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1354
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1364
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.blackbox_fielddefs.h.118.64974b54fe1f46092cf27af1822419c0,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1366
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1369
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1405
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1433
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1502
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1504
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1509
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.controlrate_profile.h.24.a29fb23b15b994a8ab0c8a938d2fe4c7,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1517
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1522
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1532
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_adjustments.h.121.1375c5dbbb76305753358dfb80c7f17e,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1535
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1546
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1569
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF1971
+	.long	.LASF1972
+	.long	.LASF1973
+	.long	.LASF1974
+	.long	.LASF1975
+	.long	.LASF1976
+	.long	.LASF1977
+	.long	.LASF1978
+	.long	.LASF1979
+	.long	.LASF1980
+	.long	.LASF1981
+	.long	.LASF1982
+	.long	.LASF1983
+	.long	.LASF1984
+	.long	.LASF1985
+	.long	.LASF1986
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x40
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1987
+	.byte	0xc
+	.long	.LASF1988
+	.byte	0xc
+	.long	.LASF1989
+	.byte	0xc
+	.long	.LASF1990
+	.byte	0x4
+	.long	.LASF1991
+	.byte	0x3
+	.long	.LASF1992
+	.byte	0x1
+	.long	.LASF1993
+	.byte	0x3
+	.long	.LASF1994
+	.byte	0x5
+	.long	.LASF1995
+	.byte	0x6
+	.long	.LASF1996
+	.byte	0x6
+	.long	.LASF1997
+	.byte	0x6
+	.long	.LASF1998
+	.byte	0x6
+	.long	.LASF1999
+	.byte	0x6
+	.long	.LASF2000
+	.byte	0x6
+	.long	.LASF2001
+	.byte	0x7
+	.long	.LASF2002
+	.byte	0x7
+	.long	.LASF2003
+	.byte	0x4
+	.long	.LASF2004
+	.byte	0x3
+	.long	.LASF1991
+	.byte	0x5
+	.long	.LASF2005
+	.byte	0xc
+	.long	.LASF2006
+	.byte	0x1
+	.long	.LASF2007
+	.byte	0xf
+	.long	.LASF2008
+	.byte	0x10
+	.long	.LASF2009
+	.byte	0x10
+	.long	.LASF2009
+	.byte	0xf
+	.long	.LASF2010
+	.byte	0xc
+	.long	.LASF2011
+	.byte	0xf
+	.long	.LASF2012
+	.byte	0xf
+	.long	.LASF2013
+	.byte	0xc
+	.long	.LASF2014
+	.byte	0xc
+	.long	.LASF2015
+	.byte	0xe
+	.long	.LASF2016
+	.byte	0xc
+	.long	.LASF2017
+	.byte	0xd
+	.long	.LASF2018
+	.byte	0xd
+	.long	.LASF2019
+	.byte	0xc
+	.long	.LASF2020
+	.byte	0xc
+	.long	.LASF2021
+	.byte	0xc
+	.long	.LASF2022
+	.byte	0xf
+	.long	.LASF2023
+	.byte	0x10
+	.long	.LASF2024
+	.byte	0xb
+	.long	.LASF2025
+	.byte	0xb
+	.long	.LASF2026
+	.byte	0xf
+	.long	.LASF2027
+	.byte	0xf
+	.long	.LASF2028
+	.byte	0xc
+	.long	.LASF2029
+	.byte	0xc
+	.long	.LASF2030
+	.byte	0xc
+	.long	.LASF2031
+	.byte	0xc
+	.long	.LASF2032
+	.byte	0xc
+	.long	.LASF2033
+	.byte	0xc
+	.long	.LASF2034
+	.byte	0xc
+	.long	.LASF2035
+	.byte	0xc
+	.long	.LASF2036
+	.byte	0xa
+	.long	.LASF2037
+	.byte	0x9
+	.long	.LASF2038
+	.byte	0x8
+	.long	.LASF2039
+	.byte	0x9
+	.long	.LASF2040
+	.byte	0x9
+	.long	.LASF2041
+	.byte	0x2
+	.long	.LASF2042
+	.byte	0x3
+	.long	.LASF2043
+	.byte	0x4
+	.long	.LASF2044
+	.byte	0x5
+	.long	.LASF2045
+	.byte	0x5
+	.long	.LASF2046
+	.byte	0x6
+	.long	.LASF2047
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1180:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF1854:
+	.string	"NAV_CRUISE_MODE"
+.LASF1280:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF758:
+	.string	"__DECL_SIMD_logf "
+.LASF1787:
+	.string	"ADJUSTMENT_MANUAL_RC_YAW_EXPO"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1104:
+	.string	"MATH_ERREXCEPT 2"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF991:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1254:
+	.string	"USE_FAKE_BARO "
+.LASF1258:
+	.string	"USE_BARO "
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1868:
+	.string	"PID_VEL_Z"
+.LASF974:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1518:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1241:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1203:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF867:
+	.string	"__DECL_SIMD_sinh "
+.LASF1680:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1372:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1265:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF795:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1730:
+	.string	"BOXMANUAL"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1654:
+	.string	"ADC_BATTERY"
+.LASF1508:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF1204:
+	.string	"USE_SERIALRX_CRSF "
+.LASF931:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF911:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF768:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1332:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF871:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF972:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1184:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1749:
+	.string	"BOXCAMERA1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1583:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1864:
+	.string	"PID_VEL_XY"
+.LASF1742:
+	.string	"BOXGCSNAV"
+.LASF1371:
+	.string	"FAST_MATH "
+.LASF1822:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF1635:
+	.string	"_Bool"
+.LASF893:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF726:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1302:
+	.string	"U_ID_2 2"
+.LASF1917:
+	.string	"pidAutotuneConfig_System"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1639:
+	.string	"currentTimeUs"
+.LASF1036:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF935:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF863:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF915:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1503:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1867:
+	.string	"PID_HEADING"
+.LASF1755:
+	.string	"BOXNAVCRUISE"
+.LASF1807:
+	.string	"ADJUSTMENT_VEL_XY_I"
+.LASF1828:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF1446:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1806:
+	.string	"ADJUSTMENT_VEL_XY_P"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1234:
+	.string	"_WCHAR_T "
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF832:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1319:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1354:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1757:
+	.string	"BOXUSER1"
+.LASF1758:
+	.string	"BOXUSER2"
+.LASF1818:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF772:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1233:
+	.string	"__WCHAR_T__ "
+.LASF1385:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1569:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF1531:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF1130:
+	.string	"USE_SERIAL_RX "
+.LASF938:
+	.string	"__DECL_SIMD_acoshf "
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1152:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF743:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1933:
+	.string	"tuneSaved"
+.LASF1187:
+	.string	"USE_CMS "
+.LASF916:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1359:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF869:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1436:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF731:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF383:
+	.string	"SITL 1"
+.LASF1523:
+	.string	"BOXID_NONE 255"
+.LASF885:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1669:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1213:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1595:
+	.string	"uint16_t"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF1381:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF1785:
+	.string	"ADJUSTMENT_RC_YAW_EXPO"
+.LASF1037:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1837:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF750:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF889:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1344:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1099:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF725:
+	.string	"_MATH_H 1"
+.LASF1308:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1207:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1222:
+	.string	"_T_PTRDIFF_ "
+.LASF1125:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF739:
+	.string	"__DECL_SIMD_sinl "
+.LASF1457:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1269:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF741:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1439:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1474:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1114:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1554:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF1694:
+	.string	"fixedWingTauMs"
+.LASF978:
+	.string	"__DECL_SIMD_erfcf "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1401:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF1270:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF987:
+	.string	"__DECL_SIMD_tan "
+.LASF1425:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1232:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1703:
+	.string	"controlRateConfig_t"
+.LASF760:
+	.string	"__DECL_SIMD_logf16 "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1454:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1921:
+	.string	"DEMAND_TOO_LOW"
+.LASF1021:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF816:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1861:
+	.string	"PID_YAW"
+.LASF1754:
+	.string	"BOXOSDALT3"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF759:
+	.string	"__DECL_SIMD_logl "
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1931:
+	.string	"pidAutotuneData_t"
+.LASF1370:
+	.string	"sq(x) ((x)*(x))"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1175:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF996:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1819:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1421:
+	.string	"BIT(x) (1 << (x))"
+.LASF1282:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1865:
+	.string	"PID_SURFACE"
+.LASF767:
+	.string	"__DECL_SIMD_exp "
+.LASF977:
+	.string	"__DECL_SIMD_erfc "
+.LASF842:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF859:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1441:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1051:
+	.string	"_Mdouble_"
+.LASF1593:
+	.string	"int32_t"
+.LASF1352:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF999:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1571:
+	.string	"AUTOTUNE_FIXED_WING_UNDERSHOOT_TIME 200"
+.LASF1253:
+	.string	"USE_IMU_FAKE "
+.LASF1496:
+	.string	"PG_INAV_END 1023"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF951:
+	.string	"__DECL_SIMD_erff32 "
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1243:
+	.string	"___int_wchar_t_h "
+.LASF769:
+	.string	"__DECL_SIMD_expl "
+.LASF1521:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1506:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1540:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1274:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1886:
+	.string	"axisAccelerationLimitYaw"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1448:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1293:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF833:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1005:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1679:
+	.string	"FEATURE_UNUSED_10"
+.LASF866:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF865:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1601:
+	.string	"PGR_PGN_MASK"
+.LASF1052:
+	.string	"__MATH_PRECNAME"
+.LASF902:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1313:
+	.string	"FAST_CODE "
+.LASF1162:
+	.string	"USE_OPFLOW "
+.LASF1603:
+	.string	"PGR_SIZE_MASK"
+.LASF1853:
+	.string	"NAV_WP_MODE"
+.LASF1879:
+	.string	"dterm_lpf_type"
+.LASF1084:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF834:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1811:
+	.string	"ADJUSTMENT_VEL_Z_D"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1055:
+	.string	"_Mdouble_ float"
+.LASF1810:
+	.string	"ADJUSTMENT_VEL_Z_I"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1809:
+	.string	"ADJUSTMENT_VEL_Z_P"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1284:
+	.string	"USE_PITOT_MS4525"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1039:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1171:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF1256:
+	.string	"USE_FAKE_GPS "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1399:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1645:
+	.string	"flightMode"
+.LASF1653:
+	.string	"flight_dynamics_index_t"
+.LASF1088:
+	.string	"__MATHCALL_NARROW"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1791:
+	.string	"ADJUSTMENT_MANUAL_YAW_RATE"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1795:
+	.string	"ADJUSTMENT_PITCH_BOARD_ALIGNMENT"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1073:
+	.string	"__MATHDECL_1"
+.LASF1465:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1291:
+	.string	"USE_ADC"
+.LASF1516:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_DEFAULT 20"
+.LASF1025:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF396:
+	.string	"false 0"
+.LASF948:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1699:
+	.string	"throttle"
+.LASF1346:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1009:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1387:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1722:
+	.string	"BOXHORIZON"
+.LASF891:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF1842:
+	.string	"ANGLE_MODE"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1416:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1348:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1889:
+	.string	"pidSumLimit"
+.LASF920:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1612:
+	.string	"timeDelta_t"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1539:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF827:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1040:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF1197:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF845:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1764:
+	.string	"ADJUSTMENT_NONE"
+.LASF1169:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1558:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF1880:
+	.string	"dterm_lpf_hz"
+.LASF1136:
+	.string	"USE_ADC_AVERAGING "
+.LASF1100:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF956:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1001:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1489:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF1932:
+	.string	"tuneCurrent"
+.LASF1097:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1528:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1502:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1678:
+	.string	"FEATURE_BLACKBOX"
+.LASF1335:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1660:
+	.string	"FEATURE_VBAT"
+.LASF1820:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF1286:
+	.string	"USE_1WIRE"
+.LASF1396:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1775:
+	.string	"ADJUSTMENT_YAW_D"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1774:
+	.string	"ADJUSTMENT_YAW_I"
+.LASF1857:
+	.string	"flightModeFlags_e"
+.LASF1773:
+	.string	"ADJUSTMENT_YAW_P"
+.LASF852:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1298:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1472:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF1884:
+	.string	"heading_hold_rate_limit"
+.LASF928:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1542:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1487:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF786:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1692:
+	.string	"dynPID"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1950:
+	.string	"maxDesiredRate"
+.LASF1228:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1338:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1584:
+	.string	"__int16_t"
+.LASF881:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1556:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1586:
+	.string	"__uint16_t"
+.LASF1024:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF853:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF820:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1304:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1824:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1733:
+	.string	"BOXLIGHTS"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1959:
+	.string	"autotuneStart"
+.LASF898:
+	.string	"__DECL_SIMD_log10f "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1477:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF823:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1567:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF1110:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF792:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1519:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF717:
+	.string	"__size_t "
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1392:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1456:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1681:
+	.string	"FEATURE_AIRMODE"
+.LASF1803:
+	.string	"ADJUSTMENT_POS_Z_I"
+.LASF854:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1910:
+	.string	"fw_overshoot_time"
+.LASF1802:
+	.string	"ADJUSTMENT_POS_Z_P"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF962:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1109:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF755:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF783:
+	.string	"__DECL_SIMD_powf128 "
+.LASF824:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1102:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1020:
+	.string	"__f32x(x) x ##f32x"
+.LASF1969:
+	.string	"blackboxLogAutotuneEvent"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1174:
+	.string	"USE_OLED_UG2864 "
+.LASF1117:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1191:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1690:
+	.string	"rcMid8"
+.LASF1214:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1410:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1078:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF1772:
+	.string	"ADJUSTMENT_PITCH_ROLL_D"
+.LASF1952:
+	.string	"maxDesiredRateInAngleMode"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1843:
+	.string	"HORIZON_MODE"
+.LASF1578:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1563:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1663:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1030:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1498:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1504:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1229:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1384:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF1695:
+	.string	"rcYawExpo8"
+.LASF1144:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1141:
+	.string	"USE_NAV "
+.LASF358:
+	.string	"__k8 1"
+.LASF1568:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF1445:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1598:
+	.string	"float"
+.LASF1899:
+	.string	"iterm_relax"
+.LASF1953:
+	.string	"_left0"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1440:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF1940:
+	.string	"pidBank"
+.LASF1963:
+	.string	"pidAutotuneConfig"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF1720:
+	.string	"BOXARM"
+.LASF1312:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1697:
+	.string	"fpvCamAngleDegrees"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1851:
+	.string	"FAILSAFE_MODE"
+.LASF1938:
+	.string	"enableFlightMode"
+.LASF1756:
+	.string	"BOXBRAKING"
+.LASF949:
+	.string	"__DECL_SIMD_erfl "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1478:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1968:
+	.string	"schedulePidGainsUpdate"
+.LASF810:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1221:
+	.string	"_PTRDIFF_T "
+.LASF1622:
+	.string	"pgRegistry_s"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1821:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF1665:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1322:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1480:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF906:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1631:
+	.string	"adjustmentFunction"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF1366:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT_FUNCTION_FLOAT_VALUE_FLAG 128"
+.LASF875:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1731:
+	.string	"BOXBEEPERON"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1605:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1211:
+	.string	"USE_VTX_TRAMP "
+.LASF1139:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1356:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF512:
+	.string	"__wur "
+.LASF1926:
+	.string	"stateEnterTime"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1134:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1708:
+	.string	"AUX1"
+.LASF1709:
+	.string	"AUX2"
+.LASF800:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1103:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1713:
+	.string	"AUX6"
+.LASF1667:
+	.string	"FEATURE_UNUSED_3"
+.LASF1668:
+	.string	"FEATURE_UNUSED_4"
+.LASF1672:
+	.string	"FEATURE_UNUSED_5"
+.LASF1673:
+	.string	"FEATURE_UNUSED_6"
+.LASF1677:
+	.string	"FEATURE_UNUSED_7"
+.LASF1684:
+	.string	"FEATURE_UNUSED_8"
+.LASF1685:
+	.string	"FEATURE_UNUSED_9"
+.LASF1299:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1059:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1825:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF1471:
+	.string	"PG_INAV_START 1000"
+.LASF1705:
+	.string	"ROLL"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1168:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1403:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1202:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1047:
+	.string	"_Mdouble_ double"
+.LASF1643:
+	.string	"flightLogEvent_IMUError_t"
+.LASF822:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1526:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF848:
+	.string	"__DECL_SIMD_coshf "
+.LASF929:
+	.string	"__DECL_SIMD_atanhl "
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1911:
+	.string	"fw_undershoot_time"
+.LASF921:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF980:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF826:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1069:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1297:
+	.string	"USE_ITCM_RAM"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1927:
+	.string	"pidSaturated"
+.LASF1010:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1049:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1375:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF880:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1198:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1251:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1896:
+	.string	"navVelXyDTermLpfHz"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF918:
+	.string	"__DECL_SIMD_log1pf "
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF736:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF899:
+	.string	"__DECL_SIMD_log10l "
+.LASF1333:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1290:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1543:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1285:
+	.string	"USE_PITOT_ADC"
+.LASF1920:
+	.string	"pidAutotuneConfig_Registry"
+.LASF776:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1832:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF1178:
+	.string	"USE_DJI_HD_OSD "
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1012:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1082:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1613:
+	.string	"timeMs_t"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF992:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1548:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF886:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1331:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF905:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1912:
+	.string	"fw_max_rate_threshold"
+.LASF808:
+	.string	"__DECL_SIMD_asinf "
+.LASF1164:
+	.string	"USE_OPFLOW_MSP "
+.LASF1607:
+	.string	"size"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1826:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF1771:
+	.string	"ADJUSTMENT_PITCH_ROLL_I"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1432:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1079:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1770:
+	.string	"ADJUSTMENT_PITCH_ROLL_P"
+.LASF1050:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1063:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1479:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1515:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MIN 2"
+.LASF775:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF932:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF728:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1689:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1007:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1676:
+	.string	"FEATURE_DASHBOARD"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1637:
+	.string	"flightLogEvent_loggingResume_s"
+.LASF1640:
+	.string	"flightLogEvent_loggingResume_t"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1397:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1113:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1641:
+	.string	"flightLogEvent_IMUError_s"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1901:
+	.string	"dBoostMaxAtAlleceleration"
+.LASF1594:
+	.string	"uint8_t"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1154:
+	.string	"USE_RX_UIB "
+.LASF1561:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1072:
+	.string	"__MATHDECL_1_IMPL"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1053:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1894:
+	.string	"fixedWingItermLimitOnStickPosition"
+.LASF1418:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1831:
+	.string	"ARMING_DISABLED_CLI"
+.LASF1536:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF1839:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF1710:
+	.string	"AUX3"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF793:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1565:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF985:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF967:
+	.string	"__DECL_SIMD_asinh "
+.LASF1706:
+	.string	"PITCH"
+.LASF1729:
+	.string	"BOXNAVPOSHOLD"
+.LASF1716:
+	.string	"AUX9"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1860:
+	.string	"PID_PITCH"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1245:
+	.string	"_GCC_WCHAR_T "
+.LASF1240:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1120:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1736:
+	.string	"BOXTELEMETRY"
+.LASF995:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1317:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1311:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF794:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1745:
+	.string	"BOXFLAPERON"
+.LASF1763:
+	.string	"boxId_e"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF698:
+	.string	"__need_size_t "
+.LASF1093:
+	.string	"FP_INFINITE 1"
+.LASF1083:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF847:
+	.string	"__DECL_SIMD_cosh "
+.LASF1085:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF737:
+	.string	"__DECL_SIMD_sin "
+.LASF1159:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1220:
+	.string	"_ANSI_STDDEF_H "
+.LASF1905:
+	.string	"antigravityCutoff"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF1923:
+	.string	"DEMAND_OVERSHOOT"
+.LASF933:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1003:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1276:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1292:
+	.string	"USE_VCP"
+.LASF1098:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1150:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1789:
+	.string	"ADJUSTMENT_MANUAL_ROLL_RATE"
+.LASF718:
+	.string	"__need_size_t"
+.LASF1339:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1231:
+	.string	"__need_ptrdiff_t"
+.LASF780:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1651:
+	.string	"FD_PITCH"
+.LASF811:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1028:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1160:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1321:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1944:
+	.string	"axis"
+.LASF1067:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1218:
+	.string	"_STDDEF_H "
+.LASF934:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1892:
+	.string	"fixedWingReferenceAirspeed"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1431:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1081:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF830:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1767:
+	.string	"ADJUSTMENT_THROTTLE_EXPO"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1626:
+	.string	"flightLogEvent_flightMode_s"
+.LASF1629:
+	.string	"flightLogEvent_flightMode_t"
+.LASF765:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1564:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF1056:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1566:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF1306:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1343:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1746:
+	.string	"BOXTURNASSIST"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF801:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1149:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF883:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1869:
+	.string	"PID_POS_HEADING"
+.LASF1388:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1283:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1004:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF860:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1430:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1148:
+	.string	"USE_PITOT_ADC "
+.LASF1573:
+	.string	"AUTOTUNE_FIXED_WING_DECREASE_STEP 8"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1494:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF1965:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1876:
+	.string	"pidControllerType"
+.LASF1002:
+	.string	"__f128(x) x ##f128"
+.LASF940:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1058:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1514:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 180"
+.LASF1617:
+	.string	"FLIGHT_LOG_EVENT_LOGGING_RESUME"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1957:
+	.string	"eventData"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF981:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1398:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1727:
+	.string	"BOXCAMSTAB"
+.LASF892:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1469:
+	.string	"PG_CF_END 56"
+.LASF1361:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF809:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1960:
+	.string	"autotuneCheckUpdateGains"
+.LASF988:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1777:
+	.string	"ADJUSTMENT_PITCH_RATE"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF864:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF1856:
+	.string	"TURN_ASSISTANT"
+.LASF1086:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1608:
+	.string	"address"
+.LASF1404:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1065:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1443:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1814:
+	.string	"ADJUSTMENT_FUNCTION_COUNT"
+.LASF1309:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1294:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF729:
+	.string	"__DECL_SIMD_cosl "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1895:
+	.string	"loiter_direction"
+.LASF1724:
+	.string	"BOXHEADINGHOLD"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1318:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1847:
+	.string	"NAV_POSHOLD_MODE"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF719:
+	.string	"NULL"
+.LASF1711:
+	.string	"AUX4"
+.LASF1300:
+	.string	"U_ID_0 0"
+.LASF1661:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF1784:
+	.string	"ADJUSTMENT_ROLL_D"
+.LASF1769:
+	.string	"ADJUSTMENT_YAW_RATE"
+.LASF1747:
+	.string	"BOXAUTOTRIM"
+.LASF1794:
+	.string	"ADJUSTMENT_ROLL_BOARD_ALIGNMENT"
+.LASF1783:
+	.string	"ADJUSTMENT_ROLL_I"
+.LASF1782:
+	.string	"ADJUSTMENT_ROLL_P"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1725:
+	.string	"BOXHEADFREE"
+.LASF1778:
+	.string	"ADJUSTMENT_ROLL_RATE"
+.LASF466:
+	.string	"__PMT"
+.LASF1413:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1246:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1163:
+	.string	"USE_OPFLOW_CXOF "
+.LASF1400:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1599:
+	.string	"double"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1621:
+	.string	"FlightLogEvent"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1875:
+	.string	"pidProfile_s"
+.LASF1908:
+	.string	"pidProfile_t"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1486:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF955:
+	.string	"__DECL_SIMD_erff64x "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF908:
+	.string	"__DECL_SIMD_log2f "
+.LASF1816:
+	.string	"ARMED"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1841:
+	.string	"armingFlags"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF957:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1546:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1649:
+	.string	"flightLogEventData_t"
+.LASF1966:
+	.string	"flightLogEventData_u"
+.LASF1226:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1604:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1823:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1000:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1804:
+	.string	"ADJUSTMENT_POS_Z_D"
+.LASF1623:
+	.string	"flightLogEvent_syncBeep_s"
+.LASF1625:
+	.string	"flightLogEvent_syncBeep_t"
+.LASF1507:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1236:
+	.string	"_T_WCHAR "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1553:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1412:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1146:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1325:
+	.string	"UNIT_TESTED "
+.LASF1935:
+	.string	"feature"
+.LASF761:
+	.string	"__DECL_SIMD_logf32 "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF897:
+	.string	"__DECL_SIMD_log10 "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF806:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF1656:
+	.string	"ADC_CURRENT"
+.LASF1238:
+	.string	"_WCHAR_T_ "
+.LASF1906:
+	.string	"navFwPosHdgPidsumLimit"
+.LASF1670:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1647:
+	.string	"loggingResume"
+.LASF805:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF476:
+	.string	"__P(args) args"
+.LASF1467:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF1016:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1435:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1827:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1340:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1597:
+	.string	"uint64_t"
+.LASF1632:
+	.string	"floatFlag"
+.LASF1066:
+	.string	"_Mdouble_ _Float128"
+.LASF1520:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF976:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF923:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1131:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1781:
+	.string	"ADJUSTMENT_PITCH_D"
+.LASF1780:
+	.string	"ADJUSTMENT_PITCH_I"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF1395:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1834:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF919:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1840:
+	.string	"currentControlRateProfile"
+.LASF1687:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF846:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1527:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF751:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF721:
+	.string	"__need_NULL"
+.LASF924:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1087:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1165:
+	.string	"USE_PITOT_MS4525 "
+.LASF1068:
+	.string	"_Mdouble_ _Float32x"
+.LASF1367:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1655:
+	.string	"ADC_RSSI"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF868:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1031:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF813:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF781:
+	.string	"__DECL_SIMD_powf32 "
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF912:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF797:
+	.string	"__DECL_SIMD_atan "
+.LASF843:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1619:
+	.string	"FLIGHT_LOG_EVENT_IMU_FAILURE"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1930:
+	.string	"gainFF"
+.LASF1074:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1817:
+	.string	"WAS_EVER_ARMED"
+.LASF1610:
+	.string	"reset"
+.LASF1157:
+	.string	"USE_RANGEFINDER "
+.LASF1394:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF831:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1407:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1848:
+	.string	"HEADFREE_MODE"
+.LASF814:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1882:
+	.string	"dterm_lpf2_hz"
+.LASF917:
+	.string	"__DECL_SIMD_log1p "
+.LASF1958:
+	.string	"autotuneFixedWingUpdate"
+.LASF1902:
+	.string	"dBoostGyroDeltaLpfHz"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF989:
+	.string	"__DECL_SIMD_tanl "
+.LASF844:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1185:
+	.string	"USE_LOG "
+.LASF1717:
+	.string	"AUX10"
+.LASF1075:
+	.string	"__MATHDECL"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1315:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1579:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1904:
+	.string	"antigravityAccelerator"
+.LASF1582:
+	.string	"signed char"
+.LASF1017:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF762:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1907:
+	.string	"controlDerivativeLpfHz"
+.LASF1192:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1172:
+	.string	"USE_DASHBOARD "
+.LASF1648:
+	.string	"imuError"
+.LASF1718:
+	.string	"AUX11"
+.LASF1719:
+	.string	"AUX12"
+.LASF700:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1090:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1628:
+	.string	"lastFlags"
+.LASF1374:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1849:
+	.string	"NAV_LAUNCH_MODE"
+.LASF1242:
+	.string	"_WCHAR_T_H "
+.LASF1682:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1954:
+	.string	"_right1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1674:
+	.string	"FEATURE_RSSI_ADC"
+.LASF941:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF945:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1947:
+	.string	"pidOutput"
+.LASF757:
+	.string	"__DECL_SIMD_log "
+.LASF913:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF1158:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1700:
+	.string	"stabilized"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1327:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1845:
+	.string	"NAV_ALTHOLD_MODE"
+.LASF1422:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1019:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1835:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1277:
+	.string	"USE_DASHBOARD"
+.LASF1212:
+	.string	"USE_VTX_FFPV "
+.LASF1121:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1424:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF909:
+	.string	"__DECL_SIMD_log2l "
+.LASF1559:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1650:
+	.string	"FD_ROLL"
+.LASF1452:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1922:
+	.string	"DEMAND_UNDERSHOOT"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1008:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1182:
+	.string	"USE_ANTIGRAVITY "
+.LASF1898:
+	.string	"iterm_relax_cutoff"
+.LASF1815:
+	.string	"adjustmentFunction_e"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1740:
+	.string	"BOXAIRMODE"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1305:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1060:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1925:
+	.string	"state"
+.LASF1433:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1805:
+	.string	"ADJUSTMENT_HEADING_P"
+.LASF1836:
+	.string	"ARMING_DISABLED_OOM"
+.LASF1210:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1961:
+	.string	"autotuneUpdateGains"
+.LASF1043:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1334:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF970:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1934:
+	.string	"lastGainsUpdateTime"
+.LASF1105:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF1128:
+	.string	"USE_I2C_PULLUP "
+.LASF753:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1602:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1444:
+	.string	"PG_PID_PROFILE 14"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1664:
+	.string	"FEATURE_UNUSED_1"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1252:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1124:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1112:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1466:
+	.string	"PG_VTX_CONFIG 54"
+.LASF1761:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF1358:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1544:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1038:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1473:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1133:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF754:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1057:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1765:
+	.string	"ADJUSTMENT_RC_RATE"
+.LASF943:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1018:
+	.string	"__f32(x) x ##f32"
+.LASF1336:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1094:
+	.string	"FP_ZERO 2"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF939:
+	.string	"__DECL_SIMD_acoshl "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF770:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1532:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1288:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1167:
+	.string	"USE_1WIRE_DS2482 "
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1688:
+	.string	"FEATURE_OSD"
+.LASF1609:
+	.string	"copy"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF1946:
+	.string	"reachedRateDps"
+.LASF1624:
+	.string	"time"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1760:
+	.string	"BOXLOITERDIRCHN"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1829:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1956:
+	.string	"gainsUpdated"
+.LASF1652:
+	.string	"FD_YAW"
+.LASF1589:
+	.string	"long int"
+.LASF1750:
+	.string	"BOXCAMERA2"
+.LASF1751:
+	.string	"BOXCAMERA3"
+.LASF1449:
+	.string	"PG_SERVO_MIXER 21"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1193:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF946:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF873:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1357:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF922:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1376:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF1735:
+	.string	"BOXOSD"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1534:
+	.string	"MAX_SIMULTANEOUS_ADJUSTMENT_COUNT 4"
+.LASF1287:
+	.string	"USE_1WIRE_DS2482"
+.LASF1225:
+	.string	"_PTRDIFF_T_ "
+.LASF1808:
+	.string	"ADJUSTMENT_VEL_XY_D"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1420:
+	.string	"UNUSED(x) (void)(x)"
+.LASF1970:
+	.string	"autotuneUpdateState"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1943:
+	.string	"lrintf"
+.LASF1862:
+	.string	"PID_POS_Z"
+.LASF1224:
+	.string	"__PTRDIFF_T "
+.LASF1743:
+	.string	"BOXKILLSWITCH"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF874:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1042:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1844:
+	.string	"HEADING_MODE"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF807:
+	.string	"__DECL_SIMD_asin "
+.LASF1408:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF877:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1812:
+	.string	"ADJUSTMENT_FW_MIN_THROTTLE_DOWN_PITCH_ANGLE"
+.LASF1417:
+	.string	"EXPAND_I(x) x"
+.LASF1850:
+	.string	"MANUAL_MODE"
+.LASF1460:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF745:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1590:
+	.string	"__uint64_t"
+.LASF1048:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1596:
+	.string	"uint32_t"
+.LASF1916:
+	.string	"pidProfile_ProfileCurrent"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1301:
+	.string	"U_ID_1 1"
+.LASF1517:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF1852:
+	.string	"AUTO_TUNE"
+.LASF1022:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1115:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF907:
+	.string	"__DECL_SIMD_log2 "
+.LASF914:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1314:
+	.string	"NOINLINE "
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF895:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1768:
+	.string	"ADJUSTMENT_PITCH_ROLL_RATE"
+.LASF926:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1941:
+	.string	"millis"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1096:
+	.string	"FP_NORMAL 4"
+.LASF1723:
+	.string	"BOXNAVALTHOLD"
+.LASF1023:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1077:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1525:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1447:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF936:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF965:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1877:
+	.string	"bank_fw"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF777:
+	.string	"__DECL_SIMD_pow "
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1217:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1111:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1726:
+	.string	"BOXHEADADJ"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1463:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1351:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1235:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1188:
+	.string	"CMS_MENU_OSD "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1855:
+	.string	"FLAPERON"
+.LASF1744:
+	.string	"BOXSURFACE"
+.LASF1890:
+	.string	"pidSumLimitYaw"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF1123:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1900:
+	.string	"dBoostFactor"
+.LASF1434:
+	.string	"PG_CF_START 1"
+.LASF1512:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MIN 6"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1143:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1913:
+	.string	"fw_ff_to_p_gain"
+.LASF1137:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1591:
+	.string	"char"
+.LASF1080:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF903:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1691:
+	.string	"rcExpo8"
+.LASF1790:
+	.string	"ADJUSTMENT_MANUAL_PITCH_RATE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1734:
+	.string	"BOXNAVLAUNCH"
+.LASF963:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1011:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1662:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF733:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1383:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF900:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF817:
+	.string	"__DECL_SIMD_hypot "
+.LASF1033:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1538:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF1737:
+	.string	"BOXBLACKBOX"
+.LASF857:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1696:
+	.string	"rates"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1195:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF732:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF904:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF796:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1728:
+	.string	"BOXNAVRTH"
+.LASF1330:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1499:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1633:
+	.string	"newValue"
+.LASF1393:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF1199:
+	.string	"USE_RX_MSP "
+.LASF1409:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1247:
+	.string	"__DEFINED_wchar_t "
+.LASF395:
+	.string	"true 1"
+.LASF1491:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF734:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1482:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF1530:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF1161:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF788:
+	.string	"__DECL_SIMD_acosf "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF1918:
+	.string	"pidAutotuneConfig_Copy"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1179:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF774:
+	.string	"__DECL_SIMD_expf32x "
+.LASF971:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1183:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1147:
+	.string	"USE_PITOT "
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1389:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF1891:
+	.string	"fixedWingItermThrowLimit"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1006:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF699:
+	.string	"__need_NULL "
+.LASF876:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1369:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1458:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1859:
+	.string	"PID_ROLL"
+.LASF983:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF812:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF968:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1522:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF944:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1415:
+	.string	"STR_HELPER(x) #x"
+.LASF1630:
+	.string	"flightLogEvent_inflightAdjustment_s"
+.LASF1636:
+	.string	"flightLogEvent_inflightAdjustment_t"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF746:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF1462:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF1132:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1557:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF1323:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1355:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF984:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF838:
+	.string	"__DECL_SIMD_exp10f "
+.LASF771:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1545:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1721:
+	.string	"BOXANGLE"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1738:
+	.string	"BOXFAILSAFE"
+.LASF1249:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1686:
+	.string	"FEATURE_UNUSED_11"
+.LASF1027:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1223:
+	.string	"_T_PTRDIFF "
+.LASF802:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF994:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF937:
+	.string	"__DECL_SIMD_acosh "
+.LASF993:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1189:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF1779:
+	.string	"ADJUSTMENT_PITCH_P"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1140:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF371:
+	.string	"__linux 1"
+.LASF1089:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1122:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1092:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1014:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1194:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1490:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF894:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1151:
+	.string	"USE_GYRO_KALMAN "
+.LASF1919:
+	.string	"pgResetTemplate_pidAutotuneConfig"
+.LASF850:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF947:
+	.string	"__DECL_SIMD_erf "
+.LASF1108:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1683:
+	.string	"FEATURE_VTX"
+.LASF1380:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF1378:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1044:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1776:
+	.string	"ADJUSTMENT_RATE_PROFILE"
+.LASF1863:
+	.string	"PID_POS_XY"
+.LASF763:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1368:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF982:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1937:
+	.string	"disableFlightMode"
+.LASF1362:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF1707:
+	.string	"THROTTLE"
+.LASF1955:
+	.string	"stateTimeMs"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF376:
+	.string	"unix 1"
+.LASF787:
+	.string	"__DECL_SIMD_acos "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF858:
+	.string	"__DECL_SIMD_expm1f "
+.LASF882:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1341:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF764:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1345:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1427:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1634:
+	.string	"newFloatValue"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1145:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF952:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1119:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF1200:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1215:
+	.string	"USE_CLI_BATCH "
+.LASF1878:
+	.string	"bank_mc"
+.LASF1281:
+	.string	"USE_RANGEFINDER"
+.LASF969:
+	.string	"__DECL_SIMD_asinhl "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF790:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1423:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1574:
+	.string	"AUTOTUNE_FIXED_WING_INCREASE_STEP 5"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1833:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF1046:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF1391:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1426:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF960:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1551:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF1437:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF964:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1239:
+	.string	"_BSD_WCHAR_T_ "
+.LASF835:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1513:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_DEFAULT 20"
+.LASF1511:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 180"
+.LASF1379:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1127:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1666:
+	.string	"FEATURE_GPS"
+.LASF1885:
+	.string	"itermWindupPointPercent"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1310:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1250:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1549:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF1107:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1924:
+	.string	"pidAutotuneState_e"
+.LASF1762:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF1587:
+	.string	"__int32_t"
+.LASF1034:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1101:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1588:
+	.string	"__uint32_t"
+.LASF798:
+	.string	"__DECL_SIMD_atanf "
+.LASF423:
+	.string	"__USE_GNU"
+.LASF841:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF975:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1962:
+	.string	"data"
+.LASF1675:
+	.string	"FEATURE_LED_STRIP"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF872:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1450:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1838:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF1949:
+	.string	"absDesiredRateDps"
+.LASF1618:
+	.string	"FLIGHT_LOG_EVENT_FLIGHTMODE"
+.LASF1939:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF1289:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF861:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1190:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF789:
+	.string	"__DECL_SIMD_acosl "
+.LASF1572:
+	.string	"AUTOTUNE_FIXED_WING_INTEGRATOR_TC 600"
+.LASF1451:
+	.string	"PG_RX_CONFIG 24"
+.LASF1455:
+	.string	"PG_GPS_CONFIG 30"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1062:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1205:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1129:
+	.string	"USE_RX_PPM "
+.LASF1173:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF925:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF778:
+	.string	"__DECL_SIMD_powf "
+.LASF1045:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1209:
+	.string	"USE_VTX_CONTROL "
+.LASF1419:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF784:
+	.string	"__DECL_SIMD_powf32x "
+.LASF716:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1801:
+	.string	"ADJUSTMENT_POS_XY_D"
+.LASF815:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1800:
+	.string	"ADJUSTMENT_POS_XY_I"
+.LASF1219:
+	.string	"_STDDEF_H_ "
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1230:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1799:
+	.string	"ADJUSTMENT_POS_XY_P"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1798:
+	.string	"ADJUSTMENT_LEVEL_D"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1562:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF1797:
+	.string	"ADJUSTMENT_LEVEL_I"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1076:
+	.string	"__MATHCALL"
+.LASF901:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1893:
+	.string	"fixedWingCoordinatedYawGain"
+.LASF1492:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF1796:
+	.string	"ADJUSTMENT_LEVEL_P"
+.LASF1671:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF849:
+	.string	"__DECL_SIMD_coshl "
+.LASF1786:
+	.string	"ADJUSTMENT_MANUAL_RC_EXPO"
+.LASF1186:
+	.string	"USE_STATS "
+.LASF1257:
+	.string	"USE_MAG "
+.LASF1483:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1866:
+	.string	"PID_LEVEL"
+.LASF1748:
+	.string	"BOXAUTOTUNE"
+.LASF1967:
+	.string	"blackboxLogEvent"
+.LASF954:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF927:
+	.string	"__DECL_SIMD_atanh "
+.LASF740:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1248:
+	.string	"_BSD_WCHAR_T_"
+.LASF1732:
+	.string	"BOXLEDLOW"
+.LASF1712:
+	.string	"AUX5"
+.LASF1035:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF1714:
+	.string	"AUX7"
+.LASF1116:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1715:
+	.string	"AUX8"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF839:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1495:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1858:
+	.string	"flightModeFlags"
+.LASF1364:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1704:
+	.string	"rc_alias"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1237:
+	.string	"__WCHAR_T "
+.LASF1476:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1464:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1759:
+	.string	"BOXFPVANGLEMIX"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF856:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF818:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF752:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1887:
+	.string	"axisAccelerationLimitRollPitch"
+.LASF1095:
+	.string	"FP_SUBNORMAL 3"
+.LASF1576:
+	.string	"AUTOTUNE_FIXED_WING_MAX_FF 200"
+.LASF1013:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1070:
+	.string	"_Mdouble_ _Float64x"
+.LASF1614:
+	.string	"timeUs_t"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1951:
+	.string	"newState"
+.LASF1793:
+	.string	"ADJUSTMENT_NAV_FW_PITCH2THR"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF896:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1453:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF1888:
+	.string	"max_angle_inclination"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF782:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF748:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1600:
+	.string	"pgn_t"
+.LASF998:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1657:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1360:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1642:
+	.string	"errorCode"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF804:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1126:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF1701:
+	.string	"manual"
+.LASF1592:
+	.string	"int16_t"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF828:
+	.string	"__DECL_SIMD_exp2f "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1485:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF744:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1658:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF1428:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1693:
+	.string	"pa_breakpoint"
+.LASF1026:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1347:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1156:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF997:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1560:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF1741:
+	.string	"BOXHOMERESET"
+.LASF1181:
+	.string	"USE_D_BOOST "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF1766:
+	.string	"ADJUSTMENT_RC_EXPO"
+.LASF1405:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1501:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1303:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1061:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1438:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1278:
+	.string	"USE_OLED_UG2864"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1328:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF950:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1353:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1555:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF1216:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1316:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1271:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1429:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF855:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF862:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1830:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF966:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF837:
+	.string	"__DECL_SIMD_exp10 "
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF851:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF825:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF942:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1698:
+	.string	"controlRateConfig_s"
+.LASF742:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1206:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1166:
+	.string	"USE_1WIRE "
+.LASF803:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF958:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1529:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF990:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF1505:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1497:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF1015:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1929:
+	.string	"gainI"
+.LASF1615:
+	.string	"FLIGHT_LOG_EVENT_SYNC_BEEP"
+.LASF1646:
+	.string	"inflightAdjustment"
+.LASF1928:
+	.string	"gainP"
+.LASF1550:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF785:
+	.string	"__DECL_SIMD_powf64x "
+.LASF735:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1524:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1414:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1324:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1272:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF799:
+	.string	"__DECL_SIMD_atanl "
+.LASF1266:
+	.string	"USE_UART8 "
+.LASF1041:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1881:
+	.string	"dterm_lpf2_type"
+.LASF1402:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1702:
+	.string	"misc"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1788:
+	.string	"ADJUSTMENT_MANUAL_PITCH_ROLL_RATE"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1227:
+	.string	"___int_ptrdiff_t_h "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF930:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF910:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF953:
+	.string	"__DECL_SIMD_erff128 "
+.LASF836:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1638:
+	.string	"logIteration"
+.LASF870:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF727:
+	.string	"__DECL_SIMD_cos "
+.LASF1138:
+	.string	"USE_BLACKBOX "
+.LASF791:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1373:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1365:
+	.string	"FLIGHT_LOG_COMPRESSED_INTERFRAME 'C'"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF878:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1459:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF1142:
+	.string	"USE_TELEMETRY "
+.LASF779:
+	.string	"__DECL_SIMD_powl "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1948:
+	.string	"currentTimeMs"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF756:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF961:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1659:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF1244:
+	.string	"__INT_WCHAR_T_H "
+.LASF1135:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1170:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1349:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1273:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1064:
+	.string	"_Mdouble_ _Float64"
+.LASF1739:
+	.string	"BOXNAVWP"
+.LASF1296:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1475:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF1326:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1071:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1259:
+	.string	"USE_UART1 "
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1377:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1468:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1177:
+	.string	"USE_FRSKYOSD "
+.LASF1964:
+	.string	"pidProfile"
+.LASF1390:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1533:
+	.string	"ADJUSTMENT_INDEX_OFFSET 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1307:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1484:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1118:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1570:
+	.string	"AUTOTUNE_FIXED_WING_OVERSHOOT_TIME 100"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1267:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF819:
+	.string	"__DECL_SIMD_hypotl "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF730:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1201:
+	.string	"USE_SERIALRX_SUMH "
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1581:
+	.string	"long unsigned int"
+.LASF1541:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1260:
+	.string	"USE_UART2 "
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1500:
+	.string	"PG_ID_INVALID 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1337:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1575:
+	.string	"AUTOTUNE_FIXED_WING_MIN_FF 10"
+.LASF1870:
+	.string	"PID_ITEM_COUNT"
+.LASF887:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1275:
+	.string	"USE_USB_MSC"
+.LASF1488:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF749:
+	.string	"__DECL_SIMD_sincosl "
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1032:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1029:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1942:
+	.string	"pidBankMutable"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1903:
+	.string	"antigravityGain"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1585:
+	.string	"short int"
+.LASF1644:
+	.string	"syncBeep"
+.LASF1577:
+	.string	"AUTOTUNE_SAVE_PERIOD 5000"
+.LASF1461:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1386:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF1620:
+	.string	"FLIGHT_LOG_EVENT_LOG_END"
+.LASF829:
+	.string	"__DECL_SIMD_exp2l "
+.LASF766:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1261:
+	.string	"USE_UART3 "
+.LASF1382:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1752:
+	.string	"BOXOSDALT1"
+.LASF1753:
+	.string	"BOXOSDALT2"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1320:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1493:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1883:
+	.string	"yaw_lpf_hz"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1411:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF1342:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1255:
+	.string	"USE_FAKE_MAG "
+.LASF1208:
+	.string	"USE_RCDEVICE "
+.LASF1295:
+	.string	"USE_RCDEVICE"
+.LASF1792:
+	.string	"ADJUSTMENT_NAV_FW_CRUISE_THR"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1846:
+	.string	"NAV_RTH_MODE"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1606:
+	.string	"pgResetFunc"
+.LASF1873:
+	.string	"pidBank_s"
+.LASF1874:
+	.string	"pidBank_t"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF884:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1470:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1909:
+	.string	"pidAutotuneConfig_s"
+.LASF1915:
+	.string	"pidAutotuneConfig_t"
+.LASF1580:
+	.string	"unsigned int"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1262:
+	.string	"USE_UART4 "
+.LASF821:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1481:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF986:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1945:
+	.string	"desiredRateDps"
+.LASF1091:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1547:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF1537:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1054:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF888:
+	.string	"__DECL_SIMD_atan2f "
+.LASF747:
+	.string	"__DECL_SIMD_sincos "
+.LASF959:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1196:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1350:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF840:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1153:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1155:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF738:
+	.string	"__DECL_SIMD_sinf "
+.LASF1611:
+	.string	"pgRegistry_t"
+.LASF890:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF773:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1813:
+	.string	"ADJUSTMENT_VTX_POWER_LEVEL"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1263:
+	.string	"USE_UART5 "
+.LASF1442:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF1406:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1176:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1535:
+	.string	"MAX_ADJUSTMENT_RANGE_COUNT 12"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF979:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1279:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1329:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1552:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF1510:
+	.string	"MAX_CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1914:
+	.string	"fw_ff_to_i_time_constant"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1871:
+	.string	"pid8_s"
+.LASF1872:
+	.string	"pid8_t"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1897:
+	.string	"iterm_relax_type"
+.LASF1106:
+	.string	"M_E 2.7182818284590452354"
+.LASF1627:
+	.string	"flags"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1616:
+	.string	"FLIGHT_LOG_EVENT_INFLIGHT_ADJUSTMENT"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1363:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1268:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF973:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1936:
+	.string	"constrainf"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1264:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF879:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1509:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2044:
+	.string	"io_types.h"
+.LASF2035:
+	.string	"mathcalls-helper-functions.h"
+.LASF2027:
+	.string	"math.h"
+.LASF2016:
+	.string	"long-double.h"
+.LASF2025:
+	.string	"__locale_t.h"
+.LASF2036:
+	.string	"platform.h"
+.LASF2005:
+	.string	"mathcalls.h"
+.LASF1975:
+	.string	"src/main/drivers"
+.LASF2029:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2010:
+	.string	"libc-header-start.h"
+.LASF2015:
+	.string	"cdefs.h"
+.LASF1984:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2028:
+	.string	"math-vector.h"
+.LASF1973:
+	.string	"src/main/common"
+.LASF1988:
+	.string	"stdint-intn.h"
+.LASF1997:
+	.string	"rc_controls.h"
+.LASF1993:
+	.string	"axis.h"
+.LASF1983:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1986:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1994:
+	.string	"adc.h"
+.LASF1971:
+	.string	"src/main/blackbox"
+.LASF1978:
+	.string	"src/main/target/SITL"
+.LASF2038:
+	.string	"target.h"
+.LASF2014:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2001:
+	.string	"pid.h"
+.LASF1982:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1995:
+	.string	"config.h"
+.LASF2026:
+	.string	"strings.h"
+.LASF2012:
+	.string	"features-time64.h"
+.LASF1987:
+	.string	"types.h"
+.LASF2031:
+	.string	"floatn-common.h"
+.LASF2030:
+	.string	"floatn.h"
+.LASF2000:
+	.string	"runtime_config.h"
+.LASF2020:
+	.string	"time64.h"
+.LASF2008:
+	.string	"stdbool.h"
+.LASF1985:
+	.string	"/usr/include"
+.LASF1972:
+	.string	"src/main/build"
+.LASF2003:
+	.string	"feature.h"
+.LASF2011:
+	.string	"features.h"
+.LASF1977:
+	.string	"src/main/flight"
+.LASF2019:
+	.string	"typesizes.h"
+.LASF0:
+	.string	"./src/main/flight/pid_autotune.c"
+.LASF2006:
+	.string	"blackbox.h"
+.LASF1974:
+	.string	"src/main/config"
+.LASF1998:
+	.string	"rc_modes.h"
+.LASF1989:
+	.string	"stdint-uintn.h"
+.LASF1979:
+	.string	"src/main/target"
+.LASF2042:
+	.string	"utils.h"
+.LASF2002:
+	.string	"pid_autotune.c"
+.LASF2045:
+	.string	"rx_pwm.h"
+.LASF2032:
+	.string	"flt-eval-method.h"
+.LASF1980:
+	.string	"src/main"
+.LASF2013:
+	.string	"wordsize.h"
+.LASF1991:
+	.string	"time.h"
+.LASF2043:
+	.string	"parameter_group_ids.h"
+.LASF2021:
+	.string	"wchar.h"
+.LASF2034:
+	.string	"fp-fast.h"
+.LASF2046:
+	.string	"stats.h"
+.LASF1999:
+	.string	"rc_adjustments.h"
+.LASF2037:
+	.string	"common.h"
+.LASF2017:
+	.string	"stubs.h"
+.LASF2047:
+	.string	"bitarray.h"
+.LASF2004:
+	.string	"maths.h"
+.LASF2033:
+	.string	"fp-logb.h"
+.LASF2022:
+	.string	"string.h"
+.LASF2039:
+	.string	"sanity_check.h"
+.LASF1981:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2024:
+	.string	"locale_t.h"
+.LASF2009:
+	.string	"stdint.h"
+.LASF2041:
+	.string	"build_config.h"
+.LASF2023:
+	.string	"stddef.h"
+.LASF2018:
+	.string	"stubs-64.h"
+.LASF1992:
+	.string	"blackbox_fielddefs.h"
+.LASF1996:
+	.string	"controlrate_profile.h"
+.LASF1976:
+	.string	"src/main/fc"
+.LASF2040:
+	.string	"common_post.h"
+.LASF1990:
+	.string	"parameter_group.h"
+.LASF2007:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375`j"
+	.string	"\305\006"
+	.string	"2J%-pK\323\030p\254\2672\315\344\313\351\026)?.\205B\016I\362#\215\314\364s\261[u\001"
+	.string	""
+	.string	"\032\272\221\355\357\227m\357n{\247-\003\272\220TM\315zhd8\314\021EB\3032w\326X3\323\254\313\314\362\\.\003\326\343\361\201\331\341<,D'\251\212\352@\321\205D\021\033p\007x\177\357lo+\353\002\321\342a\230x.YH\252\246\366~\360\367\033\022D\036\034\314\255'\267\345\203\240\"\317j\200\200\341\260\326\354\365\257u\350 \n\022\027:u\025\004\034"
+	.string	"k\0234\005\202]"
+	.string	"\b`\252\274\253B"
+	.string	"\002\300nf\210\235"
+	.string	"\301n\310`"
+	.string	"\332\340\202\314+"
+	.ascii	"\030\316\300\331*\377\325\213U1\201\363Vf\005\"R.\312\345|1\340"
+	.ascii	"J1\271\300\n0\004"
+	.text
+	.section	.gnu.lto_.ipa_sra.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375 \236u\002"
+	.string	"\024\002\222"
+	.string	"\b"
+	.string	"\002"
+	.string	"\001"
+	.string	"\001\001\001"
+	.string	""
+	.string	"\001\003"
+	.string	"\007"
+	.string	""
+	.string	""
+	.string	"\b\001\t"
+	.string	"\f\004\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023"
+	.ascii	"\240\b\030`\250=\271\004(\206o\2661\224b\241\032\256\340h\311"
+	.ascii	" U]\314\020/\0042/\250\fh\211\0013\020\220\311\006\260"
+	.text
+	.section	.gnu.lto_.inline.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375`\356\001\025\f"
+	.string	"6\021=8@\345&\035\265\327!\322\335;\030\371\177c\251>\332\203\324bP\372r\b\310\211\243\260\177\233'\332\215CD\336\300U\240\245\364\350\275\212\327\247cT\220\b\245\215-\223L\001("
+	.string	"/"
+	.string	"0"
+	.ascii	"\326\212{\273 \004s"
+	.string	"\321\\<\274K<\216\017\313\231\266/\365\273\333\235\356\356jn\273\340\351tr\036w\267\272L\371-\001/&\033W\030\273\013\262O\224\347*\273\273@\241)\273\031\t\026\260\365\211\213\204F\245\315\355\344(IhT\312\254\\L;\323\362@vT\273\003_Kh\200\023)F\301\271\216\270\306eVL \331q={\032\374\237\317Hf\277H\006Mv\013WV\317Q\"\t@F_yp;;\367p\t\206\\$\b\300\264\r3\246Y\333\2745\234\004\303\022\002]\255!\240\251\365\203~\337\367\335\020~\r\035\276!\362D74\354\364d\346d\312\034= `\242RW\345\001\275$A\017l\030^\332b\226H4\337\203a\")mN,k\207\270\210K\252\215\253\036\277\217N;*\343\234\215\302\220\350\200\264\305\350\006\022/`V\021{\006f\271Lh!\004v*\201\205\003\n\022\227J\007TA\373\r\240\202"
+	.ascii	"@\306\300\\\304\305\231\267F4\f\240h$\b\234\002`$\303\300\"n"
+	.ascii	"\001\350\017\304Y\3525V_\307\036b;\361\317!\364\007e\2618;\214"
+	.ascii	"\235\300\325\352$K]W\200!"
+	.text
+	.section	.gnu.lto_.jmpfuncs.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375`\336"
+	.string	"e\007"
+	.string	"\002\r'*\200)I\00730\223\331\006\024\236DF\344\342\353\2230\237\r\0025\b1A\355\365e#7dY\313\255\025=A\304\356&\223\f$+\032\026+\322\"\224\2028 2\250R\206\201@\226\345\006T\033\3501\275\327\2775$\222\021\246\270%\003\230TR'\240&\222"
+	.ascii	"|\342%\356t`A\225\222JY\222\321S\034\245\034\245V@-\3573>\326"
+	.ascii	"Zk{H\236Y\323#]\340\373=A?A\235\017\265\207_\235\246|\001\235"
+	.ascii	"\bzIn\217c{\246c\006Tkz\221\336\343\313\304/\002# \220\002\222"
+	.ascii	"B;\f\301\276\253\2159\235m\002\216c\002\003A\315K`\250p\007\336"
+	.ascii	"\006\027\206\332E\027\205\037\r\270\353\3203t\005\007 \270\371"
+	.ascii	"<\f+u\251/A\257\324\377\307i\310\260\204\201X\217p\272\235m?"
+	.ascii	"\006\364\263\277\212V\334"
+	.text
+	.section	.gnu.lto_.pureconst.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	"\031"
+	.string	""
+	.string	""
+	.string	"\b"
+	.ascii	"\230\004\001\230\004\002\232\004\003\232\004\007\232\004\b\230"
+	.ascii	"\004\t\230\004\f\231\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375 \312\345\003"
+	.string	"r\307\025\037\220)\351\377\277\377\335\335\201+w\375n#{\005\360\017\374/F(\262\324Y\265M\220&S\nB\036\213\n\r\315\237\271c\336X\2221_\314\025\363\304\034\261y\230G\333hn\230;[g\215\312PL\001\037l@\023\251JI\252\364\302~\266\204\255\n\236\313\230\324I\016"
+	.ascii	"Ae\250\231\227c\341\"\266\005R\004r\001_B\354bV\302\305T);\357"
+	.ascii	"\007\004\203\202\007P\004"
+	.text
+	.section	.gnu.lto_.lto.a317780d6d121c7f,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_pidAutotuneConfig_Registry.50.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375 \234\225\004"
+	.string	"D\ba"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\206\200\200\374\342\203\267\254\021\001\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\334\007us\250\356\006uq"
+	.string	"\005\001\006'\001\b\360\007?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/flight/pid_autotune.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_pidAutotuneConfig.52.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375 C\335\001"
+	.string	"\344\0026"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006'\001\330\004\005\001\006\035\001\n2\310\001\344"
+	.string	"?\202\210\200(\177}\277\001{\276\001y\275\001w\274\001u\273\001"
+	.string	"\004"
+	.ascii	"*\2026\217Mi\037\003E"
+	.text
+	.section	.gnu.lto_autotuneUpdateGains.56.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375`\377\003\325\030"
+	.string	"\346.\237E\260XQ:\304\324\310WtS]\340\r\3200c0{s\330+e.\3234\301\362U\r0\306\343\307z\350z\313GI31\f\205\365\006\362}\340\340\245\036J\237\212\370\322\242 (\363\340\241\253\266F6\2212\245\207"
+	.string	"|"
+	.string	"\223"
+	.string	"3\210\316\344Mn\367\331\n\013W\203%\345Crfw\201\036]\201\365\b\003\337\262c8\242\247\375$Wr\373\223\213\277v\235\270L\331\355\t9\001\353\321\275\373\204\217\254\007\b\037}\263\315\274\307\333\373\21649a\263\2732\375a=\330\273\301\274=\202\2327\177U\264\344\005t\374t;\334#\330\263\273\256\035\f0A\306\330\345\022\034\202\343z\250#\310\201E\267\303\361\\\025\355\256S\267\263q\207\267]\263\215\301\006e\001\327\3243\021\311e\225_z\r\3074\305Y\312*\357D\255Q\335]\234\032\350\367\375\001\217\245\244\362\241\016\032\351\221Qj\300lR\331=\\\252\017\373\337\335\265:\331\261?\375>\367\335\2570\335\023\323"
+	.string	"\300\264K\323<1\275\023\246[1\255\003\246s4\315\n\323\253\230\016\301t\3244\370\264f:3\375\002+\033_\006\374viT\275Y/\261\212\220\373~\3731\031D~\317\207r+\026\357\342\237\020o\212G\205\200\300\3619\204\366\205o\321\222\005\351\300T\232\035\205\355DQ\265\324\316p,W\254\224\230\375L\345hK\207\225\243\341TXm\300\254\324\336\360\037\007\003<\333\303\245t \300\333\335\006\217\366\207G\001\301\202R\233\375L)\205\217\327\241\211\272R\020NS\034W\332G#\362\272P\025\360\310)\316\255\004\3256\201\"\257\213\n{\2418\333\264?\361/hjw\031\370R-V0\340\005y\364]\204Ad\236R}T\365LE\004\334Z\302,\222Z\314@\0379h@d\204\264`6$`f\233\211"
+	.string	"m4t\224B\311F\263)\315@\210HR!\263\221\030\221t\002I\226\"i\206BfTc!\033\212\231\246\342\250&\263\321h5Y\253\267\377\252\223#\334\360\262\2449\377\244-aB^gXNq\376\222\353H\355\242\372pN\031\215\251\226I\240\2774\206\320_\n\241\314\213tC\325\343\245EKIupw\027\214\351}\207\005\375\2451=\323\216\\V\371"
+	.string	"\223\232\036\265)|\214\2300!\\\332\243\321\t"
+	.string	"\036\227\205H\250AH\344\020R\212\220H\f\r%J\007\320\002\031\232\342\016\021p\2552J\021QI\2419\204O\r\330\253\350\b\004|{[\244\r\232\327~V\340mo\345\032\211\227\243\306\323\022\212\210\377&zu\334)\343\216?;w\266_a\215\265\006$\035x\306\272\356\261\343(\025\2323\005\372\370c\243\177)\300\222\276\207\035\2276\027\216VdW\323\315W~\020WQr\032\t\262\202<=\004\230W\234["
+	.ascii	"\226;\\]\221\3217.o\337\366\033\022\262$\346\330t\351Gx\230\322"
+	.ascii	"Q\016\025"
+	.text
+	.section	.gnu.lto_autotuneCheckUpdateGains.57.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375`w\001-\017"
+	.string	"\346\233eF\360\222(\035 \303\215\210S\364\376mOJ\021\\\225\307\260:j\236\tg\002\243&\247\367.IW\237\366\277\340\200\367\257Wf\221\t\0212\033\005Z\307\310\256\016r\3125\354\367\024t\202l\244\371_Cd\223-S\nO"
+	.string	"M"
+	.string	"R"
+	.ascii	"\251\230\036\273c\202O+\330|r\037\260}j\027\260}\332d\363\370"
+	.ascii	"\330\262\217\301\254\\\370\330\335N\232\270\351\232T\223\317"
+	.ascii	"i\235\256\201\270\324\f\270V~\214\264R\032Wcfu\330"
+	.string	"5\245\245R\r!\331]+\253\365\341\236\267\r\301\366\004\3732\001\177\235C)\020O\2653h\320\2636\371\020$R\362\344\303\316\221\215\300\261\n\304\036O*Y\354k\273\273\226.\373\257{S\265\252\372\234\220\327\215N\216\335\016\263 ;3eP\374\365\333?\314\"\334\216\007g\361\027\323_\0336'\017\033\230\037O\3172\247\222'\253lE\214/$@\363\342\262\023\337\345#\030\216\264\354\242@)\"T\274\246\304\f\206\224,F\260\272\270\251\244\020\263\241\322\032_nR\3459\244H\351\314~\213\307D\337\305\030Fz\326\247?\332>/;'TP:\263\312V6\031\376\0344`\340\231,\370x\n\214\"| P\002)\364\211D%\017\200=\317\027*\221DR\351SR\001D\351H\026N\300\013&]\b\374\200:O4\352<\007,\242|\242\216$\212\242Nd\334K\227IP2\245m\222FG\207\312K"
+	.string	"\375\370\031a\207\306\227\361\230\222i0\3240\036"
+	.string	"\035\224\300\231\f\353\304\2017eY\310bF\032\004\202i|"
+	.string	"f\356\327;[\350\022\325R\252\310\"m\323\237\021"
+	.ascii	"\341\202A\344,\013s\253\bx\305`~\224t\235\211-\245\256&\227\331"
+	.ascii	"_\335\376S\366\211K\367T\323S4\005\005"
+	.text
+	.section	.gnu.lto_autotuneStart.58.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375`\205\004\345\031"
+	.string	"\006n\240G\260XQ:\204\206H\030R\021\375\210K\275bb\274P\327,D\242\016\210 )MxOX\031\025\223\266\375\031\027\211Ru\363\n\301\0333\271\020x;\252\331\231\350}i\031\374\320#\022 \024\232\026\377\033![\312\224\002\206"
+	.string	"~"
+	.string	"\227"
+	.string	"s\316\270r3\243B+B\356\373\355\347\\\331\361\223\370?\277r\260\354\234\351J\306\373\f\325\302\321h95\21513\347\324y\350\007\255\2079' >\224\027 >\374\313\243M\346\277\336|\023\225\f&k\346\234\263\375\341\275\374\335R\307\207ru\364Y=KW\336\225n\352\211\207{(\003\3149\001\360`\310\007I<\235J\"6\276\377]\253\250i\232z\342\331\270\262z\346\234\326\035\257\306-\336\366\n\333\032li$\266\203\316\304\006\0018'\022\317C\373\304\227\244h\315\211\024\241\311\305M\326\233s>\310C\377\205\370PW\002\225\222\234^\231\245v\321\221~\367\375\215\035\272\305\031\346\264Ejjpw\316\211[\353\374\276W\330\221\323\240\377\273,\302c"
+	.string	"\323\0206VS\203\366\017\247\353\303\376\347\366\260c\367\3350\251~I5\316\252]\252n]\315Z\265\250\352\360j\271\352U\265^\375\004\026\242\326\234Q\220%\207ml\037C\207\016\t\323\020\037\321\276\3601>UT\f\200h\244p\326\306\360\251\0371aB\250\235\025\002\2653h\320\357p\366J%|\223\215\225\317A\2647\034\f\207\250/\rzi`N_\\kw\270\227.\\Z\353Z\t\365\341[\204(\364\264\330vzY\206n2`k)"
+	.string	"a\355qx\021\327\006q,W\254\204+\2068\225)RV\204\222\213\324\256-\342P<%\301\323\210\002<N\376\204\204i5\375\256&>\374\316JwWF\211a\306\006z\023!\t\300\006\232\300\263S\013\202@\223\035(\262\265\240I\327d@*\216\214nFG4\022%lC3#\023B6\024A3\0256Z\212Y\215\250h&[\340\333\020\020\321\314\350v#\232\275~\363\333\303?o\242r\253\363k\3754W\363\343\007\361xdTR%\361\341Fy-\013u\nJ\235\241\325\f"
+	.string	"\311\274\314\270\224dd\252\001\350\315\231\373n\364%\345\370\322=\370~\341\372\260\253jc\273U\252s\330&\331\266\203\303\326\247\nI\333\004y\300\334\223\323\340\245\214\355}\317i\020Y\2501<\306\240b\246\202\021\2218\322$\035\300\002\231\222\"\017\021\220\035bf\250\346\2700\007\204\252#\266\371\002\340\302\272\3065KF0q\357\307q\372\245\253\027g\302\226i\223\211\256a\334V]\246\306\374O\331u\2131\303u\253\261\213\240er\372o\2043\276 X\254@\363aT\300\374W\326O]8|`\224A\271\207\243#\264VCG\274^\256\035\214\371h-\007h\003(\350\254H\202L\347I%\353\031(Bx\2042\"7L\260\332.b\370\307#\364\354\233*\254\257"
+	.ascii	"\375IraB\001JcXT\301\316\037\027\226-\rD@\322\306\026+\301\245"
+	.ascii	"__\246\002"
+	.text
+	.section	.gnu.lto_autotuneUpdateState.59.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375`I\002\235\021"
+	.string	"\326_oF\360\260(\035rV)\343U'\340\221i\224\370NcM\355\316Q\326\027\330\254Z\215\030\001k*\341z\355'Q\307\363h\240\234\266c\\\257\244\352`6'mI&+2\302jo\275\360\200<\254\355\223M\266\224)\005_"
+	.string	"S"
+	.string	"X"
+	.string	"9\035Vrr\354n\247#\356\272(\004\342\342\0065]>W\n}2\357\242\020I\306\005\346 \210\340\006\f\034\357i\201\201\003XJ|\2779\tE\313Kr\\I\306%\346\361\257\230o\0346$\034\311b\251 \262\025(\262\273\277yz\220\3012\271\322\356:?\231\313=\272\355\032\333\235\235%\001\236ZC\274F\240\325\210\245\016\307,p\225hc\310\220\377\256\tD\304\324s\326@\364l\356\260g^*\215}\270\273k\235\2613\315e:fz\3134\314\264f:\237~"
+	.string	"\321\316\214\003:\273,?<\226g\3331a\373\366q\\\366\310.\333\306g$\366\001-\036\225\253E\r\251I\241\034J\004\246\236Aj'\"\200\264MR\371\317\252\236g\273\273)\r\355\233\262h>\240\275*B\335r*@\r\361\361G-\304\241\322\370\252\250\232=\360\252\230\252\372\225\027X\376\330\237\235\205\312\267\361*e\363S\342\267T\0055/\257\374y\356nF\215\224\234\250\264V-\225\023\211\204\024J\327\242`\222\2620\241;I\235T\035\212u\241\033!y\205R\302\352Z\253\025\253\033\315\366pu\306\013b\360\274\024&\"\220\240=\203h7p\360Q[\021\022\220\307\271\216\311"
+	.ascii	"\215\335\327?\337\305_<\360m\276\031\202\311\024\277\331$\247"
+	.ascii	"\230\212\0362>\340\2008e\321j<4 \300\002\021)\264\003\262B\267"
+	.ascii	"J\201\351\301\302\265\327\321\274#m6\226\227`\023\216\307\344"
+	.ascii	"\215)b\027\300\241\267z\222U\270kN\025yw\2647~1\253H6\343\267"
+	.ascii	"\002\004^=\345K\276|z\f%`\230\331\304\004\222,K\325e\034\304"
+	.ascii	"k\2062\303'@\002zC\214F\241 \246#\232\346\027pT\367=:\256 h\244"
+	.ascii	"\2413s\231\253uo\273\250\036"
+	.text
+	.section	.gnu.lto_blackboxLogAutotuneEvent.60.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375`\334"
+	.string	"\235\f"
+	.string	"V\330YD"
+	.string	"\2216\035\340\021\340\247\317!\b\372\372z\322\036\237t\003U\275F\303\b!\225\215\r\262\373,z\223\332\bhb\210MaZE\237\202\256A\377\367c\202\353\350\305c\312\360(m\f\033\343\220,\331{\313\224\002D"
+	.string	"G"
+	.string	"C"
+	.string	"S\236"
+	.string	"\365\351\317\266\361\220\264\231\225\023\036\\\270\354\256\025M\374\273\214\372\371/\335\003\034\201.\253\020\2172\344\364\"G\200QH\202\244\240"
+	.string	"_\272~\030\241\250f\036\354\256\025\034\201\270\347mC\260\315\261\217 o\371eT\277\232 r\271\021Bc7e\207\216\2351a\260\330\276}\026\237\375akH#\252/\205\033\244\200\r\225`1\355\256\210)\210\030\271~\205\237\342*\276\267p\260\307.\211\030\323n(\342\004\325\247\346 \324\003\242\227S\207\210\"\001\350\2142\332\035N\017zF\320I0'S\264\006\352\321B\213\032!\205qF5\273\377P\266w\242\007\037\025\214\bE\220\013\304\020\275\340X\215\261C\220\306\025\373rw\327Q\305~\370\317\231WrI8\311\266\312\231\203\006\f0\222\005\327\306\300\306i\035\266y\021\272-\353t\037/\003\347\032`l\223m^\307u\336U\201\243\231X\035\206\013Z\t\211\265iW\307\302<\037ks\300\234I\346\261:\216\363X\037\341^nT\261\224\021\017"
+	.ascii	"\202Q\022gX\267\320\035]\027\213\001\262D\t\200\203A\230\260"
+	.ascii	"\032l!\\F\004\262n(\323\342Z\216)$\215A\355\001"
+	.text
+	.section	.gnu.lto_autotuneFixedWingUpdate.61.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375`\367\026=a"
+	.string	"z\235\324\"M0\220\322\351.\372\256\351\215~f\353]s\235\351<I\213\213:\350\b/7\310#w\007\312\376q\313wL\226TW\240\303S\363n\033\0211s\274\256\306T\205\252\212\027\313\374\373\221\217Vx\325\324\3141\217\030\206\020\217\221\266\273\245\224R\r\002\357\001&\002;\356\334au\326\301q\316qg\034wN\272\363\315\352\214\264q^\223\3166\356\\\343\316\307\033g#\322YE:\247\356\\\\\235\337\306\331k\234\373\211H\f\231\022\350\335\177\211\273D\2429\\.i\236\t\375\327\235\327=\245\233\256\273J\267\225V\231\233\350\320\257\001y%B\374\373\241\334\212\273`\026\260qq;\234a+iE\022\333}T\312\254\270K\344\005\233\240\333\341\275qY"
+	.string	"\223\270\365\270\2654\037\257D\\\266p\253\334\302\013\223\205\333\276E\256w\021\001*H\267\247\307G\202\367\3366\211\373\216\033\013\221^\036\267]^"
+	.string	"\233\034\033\217ye\253\276cc\236\341\332)wk\305\274vZl*\375B\327\265\035\257DK\254"
+	.ascii	"\251\343j\315\232T\271\300\t\325\322\035\264\321q{\314\372\362"
+	.ascii	"iz\331Bx\357e\347\222\230\247\0049f}\035\357\270\370\b\357\215"
+	.ascii	";\321)[p\354\224\231(lNL\217!.\300Ap\354\224\210\231\344q\334"
+	.ascii	"\026s\256\227V\030\336\275\327\210\0218v\n\002\207\244v\346v"
+	.ascii	"\3537\266\3414\340\232{\317r\300\273w\316\210S\034;Uv\217\332"
+	.ascii	"i\261w\324N\231e&\323qh\267\245\330uI9\274\367\"\375\b\3156\320"
+	.ascii	"\217\007\237\036\236\235\016:98\311\033\344jSs4\252i\361\235"
+	.ascii	"\3456\3060\222(\367\245\nXV\003\265\365\017\030\017\306?'>\306"
+	.ascii	"\030\305\2747<7\304\263\"l\335cB\223\022\324\234\263/\266\"\317"
+	.ascii	"\016\023\357\300F\202\353\244y\216Z\343\250\225y\222\r\220\314"
+	.ascii	"o\320\372\354kL\355!a\217\t\027\235}\261=\262\330\323e\211\230"
+	.ascii	"\016\374j+\232 \353;\242\304\327$m\363A\215X\321\223\257$~,:"
+	.ascii	"+\022\326\306\300\257\260.W\233|Z\236\026\221\262p\021\311A;"
+	.ascii	"S\206\313\213G$\375I0\255\242\362\336\333v\355^`[\356\306\030"
+	.ascii	"\367^v'X\221\346\240f\3563\314}d\346\031\fN>\207\306\235\310"
+	.ascii	"B\373\206%v\204\316\201MCS\001\313\244\315\240\361h\336S;]\337"
+	.ascii	"\347\322\340J83k\002\353\304\333i\363\306\262\343\327\374\207"
+	.ascii	"\304&\237\361\217\037\224\330$\274\201\205\322zh,\nm\310\252"
+	.ascii	"`\006+\217mc\202@\355\324\370\215\245C\240!\311\201\354\255L"
+	.ascii	"\027\262Q\3307\226\005\226\005\265\323\006\276\311\f\366^;\215"
+	.ascii	"\235\351\265\316^\335W\031\b64\226n!u,p\013K\302\310\245\032"
+	.ascii	"\250N\357`\344\374\266\374Lw4\032M,>\264\037\260\211S\354[\206"
+	.ascii	"\252\376\01690[~\206\273e\250\351\253\337]aZaZ\214\214\002fx"
+	.ascii	";g\250\235\246?\224\026\266\272y\035\n5\276\351Z\311l"
+	.string	"\333\214\217[\3672C\024\277\306\267_\363\211\226G\371\277\370@\206M\302\377\357\2564L\217b\021\266\240SSYb6\240\277\034\320s\2027\232\006\034\307{\267\224\274d\220\200R\253\371P;\365o*\203y\334\201-\203\017n5^ \207\2673\207\332i\277\322`\030\024\032\337Uf<\215w\273\346!\323\243\354uN\002\233\276\255\264\222\351h\230\307\231\035x\300\333\331\364-f\246\365Y\314\263\205\020\261\360:\032\3468-\177(s\1774\032E\303\037\002\263\216s\003:\316\f\364_3\216v\241\373F\317u\037\320y\3156j4\\\267SWi\246\321q\3353\332JsSOi\206\321t\315L\2533\001\356\374buv\341\316K\253s\013wVr\347$wf\341\316\003\270\363\nwV\261:\247\300qFr\347#w6rg\024\356|bu6a\343\\\302\235I\270\363\bw\026\341\316\002\030\235C\254\316"
+	.string	"\3408\027\271\263\322\235\211\334\031\304\352<\204\343,\204t\376\200t\016\312q\006r\347\037w\366\340\316>\356\334\263:\363\3308\0071t\370\240C<\262P\016\314\nT=C\033\373l?\266\020\3373\264\016"
+	.ascii	"E\017@\226\247\200BQM\b\206q\210\205c9\017}\302\255\221\023\366"
+	.ascii	")b-\t\355P\350\356M\350\310\033\033\316C\225\337\201r}>wQ\224"
+	.ascii	"_\002\267jLRCg!\223\216\350\225\0374\246\311\307\006\342\211"
+	.ascii	"\236h\371\b\334\366\234\240\b\354\023\206 \024\304\367\334 \234"
+	.ascii	"\317]\333\022\332\031\302$\216\037\372~\"\347'\364C\\\276\204"
+	.ascii	"\005\341L\350[\f\036\271S!\320\313\232cdy\"\341\025\303.7\017"
+	.ascii	"e7cG\302d\204\004\311\330\277\230\314\220\032\231\222{\263\334"
+	.ascii	"Y\302\225p\223\035\321\356\013\267C\267\303\033wK(\267<\rC\225"
+	.ascii	"i*\265\373\372\361\020\327\"(\243\005\261\020\307\367_+?<\216"
+	.ascii	"\177\277\2564A\337\364\037^Ml\256iy\264\313\305X\016\332.\214"
+	.ascii	"}\366\224g\320\267]\032\034`\267\220;1\277b\330e\f\371P\246j"
+	.ascii	"\3328\221\326\001C\215\243\00169r\007Qa\274\027\214\007\362r"
+	.ascii	"#AF\024a\237\001\200\001\375\2104\270\273'\214\357)k\020\265"
+	.ascii	"\247t\0163\346\035\030G\243\321\250\315\317[p\343\177\276\r\233"
+	.ascii	"\207L/\304\232\2072\215\367\360"
+	.string	";\344\376\230\336\347=|\020]\262\347}\276\233|Z\337\363@v;\3173\304\2078\271\227\013a\211\200\261F\214\250\235\356<\213A8\036\300\213Xx\217\017\245R\231Y\017|\003\252!%\357b\237>h\367\336\245N\331\271\274\311\2121\233\204\035\033S;E\201f&\206@\343C[\211\240_\007\251\215\357\021\003\331\327x\246\367\352\3608\277C\016P\347;\374\357\345\274N\231k\261 \034a`\333\2169\277\345\251F\366\006\347Y\f\340\265\007<\316\267]\363\320\256m\352\262\0042}\f\246\372P\033_\343\205\300\310\365\255W\316\262\264\r\0243\343\363lK\253N\314\230|\235F9C\326]\261\361\235w\305\260\213\231\232|\033\3377_\363\311o\344\337\274\320\230\365\221\354\222N\023L\301\321\217\325\n\265\274z\202\232\312a%\025\3654\0012\305\225\004\313\036:T\025U:\214K\250\0377\226=&\220\222!e"
+	.ascii	"\220\325\215\245\217(\006\256\244\226UU@x\334XM5Y\355x\322i\302"
+	.ascii	"\340\311Gry\365t\265\300\005K\251\343\025\220\251+ 8\240\242"
+	.ascii	"\246j(\340\361\264\254JZM5-\257\236\024\200ZVEY-\241\222\274"
+	.ascii	"t\261\224\304C\002\026OG?VQ\030<\025\231\307\321R\n\310\325\217"
+	.ascii	"+ O:\240\242\246\220\256(\230 \252\207\004HRQO>\220xTY!\035\025"
+	.ascii	"\361\217\251e\025\322\325\217\037UHk\034\263\213\367Ch\212\256"
+	.ascii	"!\0222_\253\b\364Pf\326\203GB\345\301\021\033\276\b\313\001\330"
+	.ascii	"\227QZ\030\263-\363\035\004\031\372!\354\323\347\205\0040\030"
+	.ascii	"\326\002\006&\351\366\304%?z\004\374\372\342\t\330\200\333\276"
+	.ascii	"{\256\357b\237M\345\233\376\342\373\016\213\r\235l\257xps\361"
+	.ascii	":K\357\342\263\004\323\374\025\214\366\322w;\030\205\260\223"
+	.ascii	"m\233\017\316\t\bx\213\347i,/*3\326\027\254A\256\317b\245o\361"
+	.ascii	"w\206\333n\035\007Gd\237m\345\220\204\332\251\322w\233\006\307"
+	.ascii	"\323B\031\3238k\\\262"
+	.string	"<\261\207H\023g\217\031vC\027,\303^\330}k\327\214\f{\rL\346\330Xa\324N\331\235\267K\313\232\323+\271<\r'\3332\003\274\271x\030v,"
+	.string	"\301{\231\355\004\303X5`\225\361v\262r+I\322\027\032\274\320pd\221\205!\026\016\336\316\244\3572\263\346gq\262\025c\201\350\\"
+	.string	"\377\006x\026O\302p\305\037\375"
+	.string	"\017\264\327|\242\342\271\3553<+R\274\nB\244O\201\205\306\371\266 }\217I;\264!\361G\377c\227l\237\201F\317\214\225\3500pK\264\307>\205\364\212c\234\205(\236\304\033\375\217\224\023\217\302\304\237\370!)M\3027\201\025\365+Nx%\276\263\244\3011\357\270e\262c\237IVH<S\332\321\f\342\355\323{cK\343\241\313y\201\216\n`\322I\326\267C\2273\342\317o\304\234\234\013\"~D\236"
+	.ascii	"/\002\356\315M\200\201\306\250a4%\231R\210DDD\222$)\264\006\241"
+	.ascii	"\005\204\030\305\030e\335\022\200\0245\310\202\220*b\"%\005\005"
+	.ascii	"I\246}\003\345N\305\275v\003_\346\357$\225\242d.\\u\351\222\006"
+	.ascii	"E\230TI0S\250\004\023C\335_\035\272\365\302\347\0047\321\372"
+	.ascii	"zlH\345sI\310\273\204\332\032J{\337\325#\3265\356\0073\354\277"
+	.ascii	"\302z\\\201\020\267\355\253\363F\372\374KnM\262Z\215\226P\316"
+	.ascii	"\035t\200mq$\260#\250\276\200\002\243\320]\373)\207\002\370\312"
+	.ascii	"\bd\251\200\nF%u\267\227P\226\362y\364_\315E\302]Zj@\002\227"
+	.ascii	"\304~j\250\331\345\343\234\346\265\222\027\225\330I\250\2532"
+	.ascii	"\317S\315\224\303eB\316\312\344\316+9\2455\213u\373\216X\255"
+	.ascii	"z\302\001*+\005\241\257\345\270<\\\027\207\314\331\005\252\337"
+	.ascii	"S\n\226\251\213\347\3744A\254\b\200\2114`+\327H\202\215'z\fD"
+	.ascii	"\324\326\007<T\377:\332\353\334|\351C\266\267\237RE%\001\326"
+	.ascii	"\2767K\2438\321\f6\357\001\222\016\363\344\231,\36433k\233\317"
+	.ascii	"\005_#q%fj\241\027 \360\356Tw\316\354`\362\264.]\356Ne5\205#"
+	.ascii	";(\306#\213oA\211a2\306\022\252\240j2\312Arb\222\023\310\227"
+	.ascii	"kfX`2`\204.\321\243\347\260\177\355}K*\311_N\037\300.1\206X\333"
+	.ascii	"\257[\306\024\242\001\354\013\356a\264\273@\211\nd\264\005\206"
+	.ascii	"\340\241\357\033 \254}\342C\3447\372\222F\3014f"
+	.string	"S7\311\374\322\031pY\"V$\264\221\254\3124o\314\345\f\345\241\004\232\0058\307\345,!qJ\372j\364\350EAJ>\247\277F\036\023\f\367<\0173\315\013\026\307\236\254TA)\234\272\306/\031%\030\027\361]\020\007\n\031g-\211\205m\276\233\307\363\036&\240\234|\320'C0\034\351\251!J\223\375C%\231\2608\203`\374\274\374\2342\353\2411\313\374Yh\301\033\007\204\247z\261y\370\316\023r\34130\324e\325sND\027\225:{dF\353\312\tH\3179\337\001MQev%Y:n\247\023c\\h'f?\364{\f8\\\274x\222\001.,zG\241\213\356c\210\376\227\217\263Ab\233Os~\177\303\341\345\006\307\222|f\207\357\362'\325\022>W\367[4\r-\321\"\004\"1P@\227'\331k\305\235\025n\263\300\206,!^y\220d\026\221\267 l<\350\340\316\034\3244\021\217"
+	.string	"\234\b\213\365DS]\226\b\311\276\274\231iX\230\356l\356\236\266\270q\022\2435\210\336\364\216\301\312r\320B\260\\w HM\205\032\004\330\003\222\344\027\323\316E"
+	.string	"z \020\177\332\3752\341\275\210\325\034;u\345\366'\270\b&\300\201\252\337\021\314\361\345\373\275f8,$\\\377IX\002\351\217#\347{\350\341A\206R\276\311\363-x`\257Y\007\266\2719\241\373\364\204\257Q_T:\330Y\022\016\306|}\346D\037\037\n\325b\244\336\331 \203\007\036\3047}\311\2229\237m\265zz9:"
+	.ascii	"\352\204\003;\375j\321\301h\353\004p\037\204M\201\360\2153c\322"
+	.ascii	"\023\"\272\016G3\355C36\"\227\257#\005\206\221\375l1\230\224"
+	.ascii	"+x\023\f\245\365\226\365\376"
+	.text
+	.section	.gnu.lto_blackboxLogAutotuneEvent.part.0.77.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375`\352\001\215\021"
+	.string	"f\341uI\360\2606\035\342\216\2413C\301\031\201\315\360\253\036!\021\307\354\025\341\201\223\211\205H(\262v\377\212\225L\206i,\303\207\267,A\025\347Q\355m\213+\321\260 ba\036-\026\203f\236tl\345\270\236\361\377Vkm\357\224\002["
+	.string	"`"
+	.string	"b"
+	.string	"*Z\271.\261.\204\211\322\227\376\212\263 _\243b\321n\f\220\316n\211\340\233\023p\337\272\213\204\276i\027\020\372f_\205mW\314\244M\343\345\314z\310L\264\2309v\327\373VI\234|\245\032\351\337\274\b\346\362z\035\271\274\234\206\\\363\200\260\273\346>\334\333m\217\330\016m\352 \377\310"
+	.string	"\016\210\210]\017A:\026f\213A\363\331o\337\237\275\205\177\232d\327qZ\356X\312}\305\272\023\246\317n\3729\035\n\223\375\034\337\305_\220\307iq\257\030\005Y\212\032\273\261\003\337\f\362|\3347]6\3117I\233d\233\224n\306T\351olR\264"
+	.ascii	"\3132\202Fgw+p\337\354zMA\006\241\207\361\363\364\235\036\030"
+	.ascii	"\200\203!\273$E\017s\327\241\276\214\332\341\371\361\361U!;\303"
+	.ascii	"OU\217\r\240Zm\361g\n\201\022 >r~h\2655\374D\021\231\331\335"
+	.ascii	"\005\207\371\274\322\252\335h\331\261B\203<\302!\343\347\271"
+	.ascii	"\031;0?>K\201h\225\271j\332\356\256\253\214\375\233\277n\324"
+	.ascii	"\364\345\003\337\370E\030Cp\003(\002Y&\337\204\026\030r\006\033"
+	.ascii	"0\0309\221(\370J\003B15\236B\226\2041\004U#\n\013\003\352\013"
+	.ascii	"\361\251\004\206\254Q\034Y\237\005T\352\304\033/\224\244LH\274"
+	.ascii	"0\365\251\274\323\n\305+\025\260x\002\256\274Q\024W\036\3116"
+	.ascii	"\275\266U\3067\317\315^xV*\007\327Ze\266[\332n\314\203\03264"
+	.ascii	"' \240\202!\2649\006\211Y\342W\306\370\372\317\305\244L\254>"
+	.ascii	"\020\023\277\355d|\23076\016<\334\025\007~\253\200\245\222\227"
+	.ascii	"\021i.t\361n\006=t8W\\\217\245H\327\001+\314\0029D\202\037\f"
+	.ascii	"\231\270\254f\353\230\037\300H\3362\013n/JNw\372\265}\f"
+	.text
+	.section	.gnu.lto_autotuneUpdateState.part.0.78.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"\345\007"
+	.string	"r\31635Po\322\030\200~\354Z7\371KeK\336\2730\277}\321?\343\352\331\215\021\224\007<\221\3507m\306\201\265&2G\322c\270\0277t\272\004Y@\221l\271e\no2\234\316\246a\332\246QX\270<Qsh\270\036\030b\347\322@\304M\366\211\231\2021\017'\213\032\206e\321\372_\302U\322\t()\024\032R-\375\325\2536#"
+	.string	"\376\263Uh\267@\007|/1\361R4AH\273\007J8T\366\265<-\2550\341*\351!\306`d\027\343\305e=\250\223\220O\023\350\255\323\304\275\225T\212\374\240\214\271_I\022\220\315\323\205\305\211ewcR\372\221\\\352\203\334)\032u\251i\312'\032i\344\303$\f@\330\335\253\215\234\312\377\340\217\277I\021"
+	.string	"V\023\030\017\246\020h\345\274Bgk\340)@\3462\207a\314\316i@\247\2056Sv\032"
+	.ascii	"\256=\027\3241\333yB\031\003"
+	.text
+	.section	.gnu.lto_.symbol_nodes.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375`\323\002\375\016"
+	.string	"\246\026VC"
+	.string	"Q&\035\021\t%\202\376\275\372\177\237\374g\261\241\021\3330G$\216\370!\273\234*\013<D\302\212[Y\222\330{\246\245\377\377z\241h\001"
+	.string	""
+	.string	""
+	.string	"\b\221A\345\303\340\001\2640\016t\022\t!Zn\231\002A"
+	.string	"E"
+	.string	"C"
+	.string	"6:]\242\234{p\377+8x\271\351\021\214\326\240\017\242i\0215\320\301x8\376w\254e>\034\203\016\321\377T$K\354\202\006u\n\232\204\240\212\"I\373\373\007!\227\243\326Z\023\364_\320\377\f#\021\372)P}\024\020\372\266\363A\233\316S\237L\375Z\251\337b+Y\377\003'\251\357bG\032\356\317\320z\271.\260D\033\356W\275T\026^+\327\252E\201\205\341;z\2048\334m\240\f\3679\013\317?\370<\317\2232\364\330\273u\345^<\356\314\335\220\016\347\007\345\220\2712\356Z(Sf\224q2JF\357\326\225\001(w\263\345Z\253\006\001\224W\334\375\020R#\306\227S"
+	.ascii	"\226\273\262r\236\320_!\241\337\221\352\253\b_\021f\210\230\007"
+	.ascii	"s-\034FlX\220W&R\22076\333\3138A\002D\001\220)\267\275MF\243"
+	.ascii	"\343\002r*\004y\202\371Xb\356o\314\200\231\240\037{1\376^\253"
+	.ascii	"\265F>\002\037\243\274\b\3578 \022z\034? \320\002\251\032\233"
+	.ascii	"\003(\230U\376\027c\230\312\221\235\231\227\rv0$\b\321\f\375"
+	.ascii	"\201\237E3\264\013Za\235?\f2\245\240/8\n&\013v\301\251`9\206"
+	.ascii	"\363x\331\016N\235\201\004\220\004\311Az\023\320%\027\0013\262"
+	.ascii	"F@F\006\222\257\240!\264tm\202A\031V\215\031z\341\307\221\307"
+	.ascii	"\370;k\b\350\222\316\f\236J\2048c\003\201\237\037\304\351\023"
+	.ascii	"\fL\345\334\313@}\034\261\3029\020}\037\271u\234"
+	.text
+	.section	.gnu.lto_.refs.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375 \355U\005"
+	.string	"R\n\",pU\222\016\234\347\352(U\267@\366\021\202\241\252\342\277\033\276\217\377\377\377\377\277{\177fl\344\201\320b#mi\226\rmB\032\221)W\315j\261\031\240k\251P\262w\"\211\344\027\222\355>\n\b\006\004\002"
+	.ascii	"\262\217\247\303\331d_\223\211?&\377K\276#~#;\203\372\213\372"
+	.ascii	"j\272\240\370\360\332Q\372HzG\030\272\027\256c\371\330\353\211"
+	.ascii	"\354WvDv+\373\224=\312\016\340\223\353\322k\303|\370\372sC\357"
+	.ascii	"\317\002\022\004\001@\200\002\0278\nk\021pK\261\240D\346\001"
+	.ascii	"\006\204\347\001vS\240\224[\334\212i\006"
+	.text
+	.section	.gnu.lto_.decls.a317780d6d121c7f,"e",@progbits
+	.string	"(\265/\375`\2714}\352"
+	.string	"\nk\305PT \fY:\215\001\326g\231\007\262\375\035\250\340\235\207\254\200\254\262)\3249\247\007\266U\0061\nb\376\326\202\235\241E\364\252\230\177[\005\r\220\216\2775\227m\370\231\315\241\370\255\236\"m)\262\333\321\347\022)\331\354-\023\t\216\212\342\234(\253I7\"\245\224)]\004\367\0043\005Wew9t>\336\242\217\313t\226\225c\325\222G\252\310\3024\306P4\b\233\001\370\243\263\031\200\326\314O\354\313\223\245\036V:kL3\350n\376\265\272<\254\336u\3322YI\312\334\234_f/"
+	.string	"/\325\320o\025Ncs\222s\363\265\027\2009x\332\264\365\210{\362`\241\341E\006\005\034\314g\005\333t\344J\330\315\327\306\275\361\213\343N\355\213\203\003\347\336K\027\007\220\234\275\227\200\254\365`\255\207\374$\353\210\0310\037{\351\3776A\2741\303\364u\363\255\341\003\2351\204\354\346K\243\351'\n\316\r\265-=\004e\337\334\031\370\331\025\002\223\223\250\205^(\273w+\224\243\252\254\364rnc\335\334'\017P"
+	.string	"\3042\367\324w3\023\r\n,\306\315\307A\364I\330\276\"|v\316V\327\016\332LqD\272\344\\\246\273\224\305\265\343\353:]\0317\206\205^\246\273\264\317\275\307|p\300\211\021\265\223\217\237\364\361\222>\336\372w\216\376\225\243\2032"
+	.string	"-\234\241\3338\027\200M\252\347.\003~1\343<\271y\347\356\351_;}\017\300FOo\273\351\272\331\346\t\345>+7-7\375\r\344,\335\017\223\324\r\275!1<\366\320\233-3\025\024\243\272\241\267g\247\2409\032\246\322\234\300)\256G\324\246\261wV\215\215Z<\013\265v\366\214\235\035\023\254\302\264#\272\201\235\r\023guC/D\b\0361Oxc?\371W\211\266B\366\002\320\316\035\201\212Q\347\264f\236\303\234>x)G\030\264\035\332\222\261p\026\n\302\306\021\203TY\273\371wJ\337\202"
+	.string	"\002\201"
+	.string	"\376.\351[6\372v\215\276\255\323A\366\002\360,\b\205-\253\354\346\337~\261l\272H\022';\246P\261U0\225\246\256\022\244G\324\202Y6\373<\332O\323so\001\345\256\240\346\354m\200\305\252\375,\237[*\030\204\007\324\2346\353\305r\261],\324\262Y-\267[\354\332\363s\357\246\275\367I\374C\277\006$,\233-\263g\370\331\265\231\342l|X\352;\353\262\267\3673D\210\020B!~h\326\240\r\331\311\177\263\031\200=VJ\333,\026\315B7\3304\274\f\003\362\231\343dN\234\233oe\350\333\r@\333g7"
+	.string	"\277j{v\255\231\275r{f\255\\\003\022\357i\332`{?\355Y\336{\311Z\017?\326z\370q\341Z\022\003\346\037\365\211\332\206Y1\013=\027Kv+\305N\271N\323s\217\355\275\201\354\220.\313!7\237\003\272\207\350v\354\034\302\366&q\r\372\305\336{\007\355\271"
+	.string	"\037\244\177u\007\233\001\230\355\005 \024\013\266\0013\243\234\273l\357g\005\240g\016\032@n\376\323f"
+	.ascii	"j{\001hD\243\363\3431\377\r\341\352\377\332\333\376\263\035\032"
+	.ascii	"&\350\307P\354\336u\321\3036\301\021\344\277V}yV\304\177y\374"
+	.ascii	"6\002\377\335q\271\377\005\270\320\212\377UW\307\235:\005~\354"
+	.ascii	"\346\267`\256\324\177%P\343\307N\376k\002\215\033\365_\020@]"
+	.ascii	"\303\217\303\314\270\373\277&\315}\372\257\214\313\274FN'\300"
+	.ascii	"\217\273\3746\356\306\270Mw\377\227E\t\376\177\370/\tn\341\307"
+	.ascii	"h\27753\202\337\342\377\277\337\002\377\347\377\372\267<\277"
+	.ascii	"\325\271*D\360_a\b\376G\177\301\006\256\201o\370\261\225\337"
+	.ascii	"2\371m\223\337z\375\326\311o\277\376\033\364\037\370g\001\374"
+	.ascii	"w\203\377z\360\337\022\377\355\340\277\034\3747\001\377]\300"
+	.ascii	"\t\377\365\360_\r\376;\004\343?\320\237a\374\367\305\177\223"
+	.ascii	"\377=\376\327\370\337\243\377\016\377\353\201\377\256\370\357"
+	.ascii	"\004\376K\302\177E\370\257\003\376\313\200\377V\370\257\375m"
+	.ascii	"\337o\371~\033\347\267w\277\265\373\355\232\337\242\371m\335"
+	.ascii	"o\313\374\326\355\267a\376\307\375\237\373\255\005\277]\373m"
+	.ascii	"\206\337j\371\255\332o\213\374V\353\267(~\353\363?\357\267i\277"
+	.ascii	"\315\362\333\263\337\226\375\026\004\2775\373\255\330\177\262"
+	.ascii	"\377\317\337F\371\355\223\337r\375v\353\267D~;\344\267\023\370"
+	.ascii	"-\005~\273\341\267\027\374v\202\337b\370-\320o\177\376\353\375"
+	.ascii	"G\361\377\313\177\025\377\275\374\007\373\037\302\1770\377y\372"
+	.ascii	"\372\372\372\376\037\t\377N\007~\002\364\005N\251f\207)\"\314"
+	.ascii	"\206\273\034{\301a\216\275`7\275\334\273\bU\023\304\217\301\034"
+	.ascii	"\273\331\365\\\020d\213B\251r3\376\202\245\370\350A\245r\334"
+	.ascii	"|6\266\n\260n\311\017\031s\364{\304\350\377\376\300m\343\367"
+	.ascii	"\334iL=\026\304\357c\261\r\300\377\274=\260\300s3]\321\323\003"
+	.ascii	"~\301\322\241w;\354\177/\235\315\n\314\347\030V\223\331\204\245"
+	.ascii	"\3032\307\260\246\230cX\313\313t[\232jn\254\245\336\316)\315"
+	.ascii	"\\\332{\314\271\247x\236X{?\261\226\372\271\324\334\314'\226"
+	.ascii	"\263\002\263\tk\3122\307vs7\355\246\005\346\336S{\f\353\3162"
+	.ascii	"7V\2239\346\234\252\260\233\356\370\236\314X\335\260RtY|L1\233"
+	.ascii	"v\215\n\276\232\234\3157\346\323i\323\366^\2269\355&\326\336"
+	.ascii	"VN\017iMF\226iLo5\202TM\317\245\255\242\301\224\345\324y2\355"
+	.ascii	"7\346\022\347\221\323\336t\233\006\007K\273\224\261\231\226v"
+	.ascii	"o\247gso&\247\007\250\234\266\214\214\346\366\331MKQLY\316\036"
+	.ascii	"'&\247\214\275\344\207\235b\216e9\207\324\310\306\2726\323si"
+	.ascii	"\2736\035VS\217-\237\233\231\347\343&\213\334\336\315kB>n\342"
+	.ascii	"\270\344\202<\201x\322\256\254\340x>\177\340\304I\271\271\371"
+	.ascii	"\0024D\307ii\327J\204\240\275\263\266\272z\2524\026\234E\307"
+	.ascii	"\271Cl\351\346\367La1\303g\273\207\206\227*r}f\027\264!:.\203"
+	.ascii	"\342\262k%\302s/\177\304\270\232M\f\316\303\246\n\031\206[\363"
+	.ascii	"\302\273\031C\201wpG\230\250i\036\276'\325\225\030\016\333\311"
+	.ascii	"\301\304\264\303\364\024\374|^:-pMD\246\340(y\213\314\030\036"
+	.ascii	"\0240\030f\362\363D\215\326\025_\222\030O\2248\211\336\037]`"
+	.ascii	"CL0\022(Q&\370\b4\212\027\376\302M\360\023\354\304B1\023\274"
+	.ascii	"$(d\212\215\253'\237g\251\277\263F\177\307M\177\207L\177\307"
+	.ascii	"K\177\247\207\376\261\221\017\272i\313\031\030\327\326\217\212"
+	.ascii	"\213\217&A/\350\226\222\"\032\202M\324|\244@\004\017\001:\343"
+	.ascii	"\325\\\303C\260\226\035\203\342\021v\263\020\274\244\210\026"
+	.ascii	"+7\177\247\251o\327\352\356\232\237\2458]vM\214\\\025\230\267"
+	.ascii	"\032jkC\350\332\304\235Q\3031\270\272\330\244\211\232\021\233"
+	.ascii	"\003\206L\024\237\236]\224\013\333\321\240bhuqi\273\212\206\331"
+	.ascii	"\321\305\245K\020\037`ef\300\211\023\346\316\271}_\242sb|Q0n"
+	.ascii	"r<\272\334\274\311\032\023]\213\203\212&\321r\233\340g\232\226"
+	.ascii	"\001\335\272\\\274\364\240\213^<\2617Cx\331&\207\317M\r?\335"
+	.ascii	"-V-\b\221\350\336\317\013f\214\234T\024?\341}k\304y\301?\360"
+	.ascii	"\024\216\302Y\330\nWa\036\270\211q\340\0358\b\206\302@\360\025"
+	.ascii	"\266\201\251\260\023\366\201Q\300)`)\314\304=\260\023ca\031\370"
+	.ascii	"\006\326\201i\340\034x\006\256a\241\370\t/"
+	.ascii	"\0353\341\246\347K\207\237n\336\305\373i\n\332MY{\367\313\177"
+	.ascii	"\335\354\005\355&&\272\256\013\207\237\256\334m\362\263\364\334"
+	.ascii	"\315 \364i\307W\210\235\032PTO\b\344\353\274\321;o[i\364u\276"
+	.ascii	"\350\353h\321"
+	.string	"\3271\323\035\240\350\227\031\321O\323\271\322\327i\352\247\351\304\320\327j\3645\027}\rv\357t\314\344\365(S\242\257q\350\3375\327\316:\367\036\343\271\361VWu\363Es\323X\250\206\253\006O\213i\352\346\353(M\202\275\255\006\240\355\353\263\032\200\032\f\375\236Y\373\361\346\346\007\333\350\277\005\317\350\007\301\350\007\303\364\203B\364\203P\372Q \235>\260\213>pL\037\250D\037\350\324\007\342\320vG\2012\364\177j\364\177m\372\2772m\233?$\372?\037\372?\246\266\31644\r\265\246\213\023\332\315\262\223\205\214\313\352f,@8|K=\364\314.\222\373\004\202\246k\353r\275)\273V\356\331\275b\241\327\354R\371\r\273b\277\327\307?t\315.\326\325\352\353\3423\273c\227\314\276Q5 \016*\272\367\376Ai\251\203\332\311\337\200\354BgT\261\320K\006v\333\316\370H!\347g2\372\331M[\247\315"
+	.string	"\304\220\3134\330\215r\245\\(w\212\205\336\347\357s\357\262'b\234X5\373F\305"
+	.ascii	"-t\321\257\333\344\347\267\267\263\356&\271\317\253\3446\261"
+	.ascii	"oZ\017X;\023%\361\034#\024\302'\f\232-'=\371\231\212~~\242\237"
+	.ascii	"\267\364]r\231X\350\207\353\365Ke\371\376[z\356\347-\302gE\354"
+	.ascii	"\346\347,}\373\001\210\373\372\354\007\3403\016\235A\206\342"
+	.ascii	"Z\303\265\327\305u\205\330u\035\271]\327\210\205^\256\274\365"
+	.ascii	"I\244`\325\256\370\256\326\005r\203\374\340\275\227\346t]\255"
+	.ascii	"+\244\0049Wm\210\334\"w\210\205^\255\377:\357\217\033UtK`7\377"
+	.ascii	"\226\206\376cz\"6g\314\315\257\362[\3322G\310\300Y\376v\216\003"
+	.ascii	"\203\306\244\311\315\3171\263$cXs\346\262\225*\255,\2765.\035"
+	.ascii	"k\310\344\274\315qC\243M\216\303\305IN\355F\206\223\247\332d"
+	.ascii	"\361\220s\363\006)zzy\357\202-KqW{\036H\262\233\334<\357\241"
+	.ascii	"y\211\251Q\2739\267\311l0Xi\0163\242\321\214\207!\n\036\034\216"
+	.ascii	"\237\270\024f@\345\273g\2743 &&[X\320\276\324\310UE\365\0061"
+	.ascii	"v\277]Nc\203\236LrV\272\200\200\360\301\325\020\2437\350\235"
+	.ascii	"9\223\323\b9\227w \274,\363l\3400(l62\232\3474\027O\002@\214"
+	.ascii	"T]A\203\005\005\207Esp\312\311e\272\035\2713\0351\033K>\350\346"
+	.ascii	"\262[\22384sfr\034\2525_\317\255#/\314\t\325\034\220\300\301"
+	.ascii	"\3458`\025-P\226\b\201\023\345L\\\031\2357UN\276\233\177!Ks`"
+	.ascii	"c{\376\302\226\337,\033\373\334T\316%\036\001||i\302\266\267"
+	.ascii	"\231T l\332\023!f`\236\337\236\307h@\342nY\212\225(3\302d1r\260"
+	.ascii	"4\251C\243\004IU\233\005\272\017=a\310\226d\311m\317^~\035\035"
+	.ascii	"-WA\260\336\272\374:A33<\272\300\350[X\323\034\240iO\313k6\354"
+	.ascii	"\312\216/0Mhdy-o\371)r\344\013\311\026-@\272>.\314KC\007\317"
+	.ascii	"\013\234\267\254f\367n\035s\213\020\250\346\020%K\026<\007=\263"
+	.ascii	"\343+(dn,\216\021\275A\313\314,_\021\002\227D\213\317\030\033"
+	.ascii	"hSg\317W\354\231\017\033\350\233\224\213'FJ\016\234\233o\341"
+	.ascii	"Io\210\"z\376\231\313l\330\226\262V\260\216$\331\333\233\nD\236"
+	.ascii	"\2433\323\244\312s\331\207\344e\271\335\234\311\360X\024Z\031"
+	.ascii	"\267\f\235\223r\322%C\363\030\227\2224O7\213i-++9\326t\016\313"
+	.ascii	"T4d5<~L\231"
+	.string	"\242_\301\210\266\300\b\321\263\024)\230\213P\320n\202J\245\375\304\221j\362\246C[\360\274\361\334\303B\363\215\f&D\345\271\004\352\002\336\021\221A\345f(\367J\336\035\231\233_a\206\276\005sf\254\272\254\374\003\214.\232B\326\362\n\023\035\002\222\177\374,+\354\rdL\327\222\374$;\311M2\223\374e\241\331+\017y\276\312>.\304\227\275r\02001s\2742\221\234\304\276Q\005\355\246,j\242;3\260\336z\374d\347\325\\\300\304\024A\n\032$Y\211\205\346$\027\312Ir\221\334e\337\250\236\333\006\017\2260!;4\204\360\301+C\307\003\330\225\217\\y\n\311\2739\033\241\322\001&\206\227-\013\315\\\232\315\227Z\0345\357B$\213M?(M?H,\013\321r\321\036b\242\350\0079\321\017Z\242\037\264\245\037$D\377\031+\377\030\373\242'&\377\260j7.L\024\323\315\017\312\322\367i3"
+	.ascii	"A\330\013\300\274#[e)'X\2261xL\200\310\230\263\233s\325\325\252"
+	.ascii	"b\313\243\312OM\272\275\246\303hJ*\311\3159\207v\n\312\361\341"
+	.ascii	"\367\305u\306v\363s\216\373X%\001\022\344\346\214c\350\031\205"
+	.ascii	"_\025\230\037En\346\261\027\200\007\212\243- #\262Nlfzn2\345"
+	.ascii	")\020\300]\326f/\272\233V\030\350\344\021\201\223\361,\333@\022"
+	.ascii	"*\313\233"
+	.string	"sT\256\221\245~\235\237-5\242\236\344\351g\032;Zp\\Ln\276y\3063\324X\225\037g\354\36433?\245\360\3456\307\214~\226\301#\307\006\035\225\233\263\223v\002j\373`\302\025\022\250\233\237\235\376\034\343\372\2708N\350\343ss\263\317\226\241\347&\0361l\321)^\332\002-\242\347e^b.B\317m\003\210gG\205\301\316\334\022\270\256\036\272\202<\242\343\276><\204\007Z\266\343\013\b\307\205\006\210I\367t\021\035\363A1\337E\023\n\3336,\304U]\265\331\343\271b\362\221\251\323\034\324\260a\203\343@\261\334\320\333\373\2451\227\033\3039\216\203\235j\322\310\335\214\367\360\233\034\3055eys\360\rT\03127c7?*A\324\340n\306m\200\262P\241+r4\313$\213\02335\215A\216\3508/\357\342\345\240gSV\226.|\204y\344\b\025}\341\215\350\370\356\356\342\211\340\\\2621"
+	.string	"$wy6\366\366n\303\300\347\311\221\030Q(\250\301k\324\3409*vx\215]so\252\215\345\2307\364\276\260\035X\\\231\233\377\263\324\3671\243;XA\203\006\317Y\252\006\210\325E9\360\246\251M\233\336\260$:\256\203\342:[\3066\265Y\226\221\350n>1\270\317\230\356@\306\314\315\3409\275\367>\353\332\271\002\247m\353l\216\347~pK\214\230\025\321\035\334\214\371\030\\Fo+\366E\005B\247q\023\026&\356\270\f\206:,g0\\O\224\231\027\"pd\232\344\232d6/\256M\335\223\233\337~[\003I\f07\337G\207~[\033v\003\356m\237\001\2530]\215\252\t\236\235\337\021\211\204\204\034\026\035\213irG%\"\221\204\303\344\210a\221\006\020,0\302\n\242\017\204 \230\240"
+	.ascii	"\n!Q\tB\025#(\213\304\n'\216j\320\210b\222X\201\262h4\026\221"
+	.ascii	"\200Fc:<ZS\244\021\312\265\310b\204\322\321\b\001/\224\216E#"
+	.ascii	"\0028\350@\330A\211\027#T\242\322\210\244Ri\304\210\241\232\244"
+	.ascii	"\354p,\n\022\211\270+\362\030,JUc.Z\217\305\244\021\250\032Y"
+	.ascii	"\244\253\022\nb1\205jT\"\252GC\345\004?\022q\201\252\026\005"
+	.ascii	"\177$bU\302\020\004#\tI4\301\372#\021IJ\310\244\221"
+	.string	"0\251\256*R\232L\223F\fU%\317\261\350\376\224\302\236Ux4J\372\035\215\222\260zBQ\231\225J5I$\246A\030I\310aN\256I\370=0\222\253\262h\244\226P\001Q=\032\025\215i\220\250*\225\2622\370tM\211I\241Q\222\2171\tI]\261\252J\265\004\243$\017H\352\252\204\241BH\003\321P\303\t\n\200~$\302\250XtTJ\002\300\350XDJ\246<\025\254\311tU\341\263*S\343\005\023\206\352\021\221\220R]SbR\005.\be bM\246I\"\214\220$"
+	.string	"\340\303bR=\252F\372\034t\200\200\016J\274\b\276\204\0022P@\006\300\227P\300\320\220\002:\030\322\357`\b\257\353QM&\225\210xT!q\204\027H\026AU\250T\211H\024\025\210j\213T\205\316z\342g\025\276P\211\307\242P9,\"\245G\030D!\005\252\020\303\205\026H\241\213\242\n+\022y\244L\252\304\243\222\320E\221\005\245\232<Z\205.\2122\b\223\200\326c\272*\217\310\241PX\024\"WaQ\221\320E\221\320\252\266(\256i\213bR51\201R\230BM\202\261\"\251\032\211\\\024\r\221X\004\177N8\022\366"
+	.ascii	"\235p$\324\200\350s\302\221\260(\311(t\221\302\330"
+	.string	"1\n\211F\344\221\320\350X$\246\352\021\005\353Q\035&\325\024)\222\224\210\307\342\005\220(p\221f@\350h\270\026S\030\215\310\022\216\310\242\262\370\"\345`\034\036\213\302T\370\"E\312\300\343\"\315\300\217\013d\362h\205\020QU\223\224\311\342\007\352\360\250&\325\"\265\204\n\\\244\0318\026\211I$\222\310\202\242\022\231\302\204aqUq\244\300\b\001P\223E\242\020i\fBJ\252+L\300\300\200Q\265@\213\364hAM\202\261\006\r\205\026^\244F5)DJ\252k\221'\211\\\207\351\211\236#\262\250\032\215\037\254\037\274HQh8A\204\242$\022\322\325\250\232@&a\204\260*\221H\b\0201\034\213i\b@I\344\232&U\243:\034~0AQ\021rU\"\202\261\026[\244I\243\342zL+\254E\244\"\tHJJb1\205\021Q\004%2\205\213\023-\322\343\004\253RU\223F\252\t\325ht\374"
+	.ascii	")%j\221Tda\250,\"e\245\320\250XtD\022\251kZ\302\205\022\304\""
+	.ascii	"\212a\022hb\204\024G\030D\340z,\"\223LH\325$\013a\232\344\263"
+	.ascii	"\n;\030\322J\024J\351\n\243c\361\002D\365E\261\350G5\256+2y\264"
+	.ascii	"j\242zB\321Xd\221\256\312\235\037\211P\215\305\"d2IhD&\327#r"
+	.ascii	"8b8\200a2X\002\231\364\002\004\027i\006\206\311\035\345\317\230"
+	.ascii	"*\035S$`2=\032\346\365G\"\204N\234\270Ja\tb1\t\230\302\216`M"
+	.ascii	"Xb1\t+\205&\034S\b\020\213I:\2530]S\023\025\356\341\304\211c"
+	.ascii	"15\002\252B\025\037\020\213I\026~\253P\211BE*\256ZE*\256H\252"
+	.ascii	"\353\021\004uMW\345\017Q]\323\244\322\232\252 \026\223zR\214"
+	.ascii	"p,\246F\277\037\211P\026\251D\242Q-\026\t_ Y\2300L\215,\fpd\222"
+	.ascii	"\232\034\261\"\221\311\021<J\341\007\307\242p=\252-@0B\222 \200"
+	.ascii	"UXb=\026\225\202Gdq\035\036\225N\254G\025iU*}\200\230Z0\"\221"
+	.ascii	"\020\020\376\214R\343\211\"\235U\250\301\006\353\261\030\274"
+	.ascii	"\352A\t\022\303\"\016R\021B\367\300\003\242\016\025\230@\bz("
+	.ascii	"B=*\255\310U)\025\022\213I#\326#\243\242\261h\304\261\230\"\215"
+	.ascii	"\030&\225#Dtp\241\036\265\252dL-\260\246H\343\t\027\352\321\347"
+	.ascii	"\377\317G.k\373"
+	.string	"\032\323\374]\355\321q\315y\335\214\265d7&-P7\377f\350\234AY\022u\363O\022<#qn\376U\005\261\274\260ll\321\036\216\374n\374\250~7~:t\232\313\273\020r?\035\277\034\326\253\216\312\234\034?\024\350P\250aD\310\bj\242t\371\341\300K\370\013W[^\231>\332o\212JP\317\031=,ea\372\3775\261\333}czy\223\312W\200\350\234A\242j\244I#\345\311\213\306\305\323V\354\336\240\2422\236\317\335\2236[\003\310o\352\254\254n~\202\365HI\025q\336\037\223M\207\032sl\352\311\351\314O\006\335\317\354K\034\216\237\023.\243\245\031\005\344:\267\023S\215\311\241\335\374_\323\206\204e\250\363\202#zP\260\005A\245\024R\206\206f&\032\0033\024@@hP(\033Px9\037\023@Ui\263\241\240\265J!\032\031I\222\222dg\317\231A\310\304\207g=\375d\232\334"
+	.ascii	"\364\362\220\206\037\023\333\032\005e\275R\004\203\\\034\310"
+	.ascii	"\373#\034\t@\34269\265\217zQ]\367:\255\225mi_k+\024\247S\362"
+	.ascii	"\376\377Z\343B]\005\310oA\030\223[,w\342\210b\332\342\215g\273"
+	.ascii	"\004\243g4\356Osx\2452\210,\325\350E\345OL\r\341W=\254\005A\223"
+	.ascii	"?\345\300\302U\366\346N\204\316$\022\022\205\235:-@\262\327\317"
+	.ascii	"@cg\354\021U\376\311\3664\372}T\363\235\223\316]t\365\006\262"
+	.ascii	"\234\324\235*\322\362\242\254U7Dc\216\021Y\210\303\027\314*\247"
+	.ascii	"m\fnx3\303\370u\030|nM.\344c\035w\nM\252\264\271c!\244'\333s"
+	.ascii	"X\216F]loq\002\250\242Z'\332$\0324h\204\244'x\272\013\005^w\t"
+	.ascii	"S\005\256\214\313Z\235\225?\202\324\n_J\003\234;\347\315\333"
+	.ascii	"\004\255\220~\006\326\017\311\306:0l\355\3015"
+	.string	"\31770P\3728\332,)$\205\023D^\351\360m#\340/\316\377\001\206\365\330\216\021\023\254k\250\367\365f\375\214X\261;\334\322\217\n\225\245z:\270\304\304:\305\230S\376X\245\253\016\245\322D\316A\023\f\b\036\270jI\016\235\364\355Z.k\365\013*\033\377i\272\235\017\302+Q\306B\217\314Wt{\361\341\351\2102\372\237\346\212\022.\375q\366\235\223,\007bn\226\001\323\352\212?($yi|1[\212\373z}\311E\347\275\226dY\352\342\325\313\221\326`\367D\211x\315\335NxI \"\203E\366\363\363\032\f\006ED,\352 \360\024X?\376\347\270\327Z\327\373/QAO'\265N\346\342\263\244C\324\005V\032\273\235/Nc:X\233h\200P\375/\b\031d\257?%l\002\312\236\332\007YJ\013{\253\365D\203\304\352^\302\231\274\300\032^[#\354\306\210\210\032\005F\370`;\263\374"
+	.string	"\353\251\025\204/\032\341\005\337\362\373$f\357~\271O\033\351\242\214\020\262\2763\240\326\243\b\214cX\023\363\250\212\001\034gV\303\032\030\233\336\271X|\344$\365\240\357\373o\216  \n\322%hfx\207\237=\265\3003k\357\244R\322\032+\371\t\302\251\231\303R\254T\361^$\206\007\206\226\214\365\375e\324<\r\300\267"
+	.ascii	"\232\316x*\204[\347\342\225\252q\371\206\353RV#\271j\322\tg\254"
+	.ascii	"\350\343\317\254\206\334}\20273\001\02360[\002\006\313<\036\020"
+	.ascii	"\245\324\004\275\362\021b\027U\021\320,\262\2613\257CX\224DO"
+	.ascii	"e_\362\030\021]\266\365*g1\245\302\247\302\333l&}I\027.<\277"
+	.ascii	"w\361j\307\375_&#D\304\320\236\274\226\200\"\362\320\204nl\314"
+	.ascii	"\375q\231\200\224\347\rh\373e.\"#\"\270\326G\002\377\273\213"
+	.ascii	"\251\267\330\023\363Y\355'T\261n;\022e\372\337k"
+	.string	"^{\314!\303S\303F\265*Zu\237\241\333\210O\360A\274\322`\355\025\261Il2\361\211\003\372$\346\340\217\007x\220\274\246\221\214\326\201g\222\262\257\240\273\037'\272j\372#\250y\321j\241\326\357<\337\346a\237\323'q\024\225I5\347\024\204\310*m\f.\352m\231$\034\330\304\250\324\341\351J\227~m$\f\222\257v\004\214\322\022\232\233\240:\312\020\262\271\344\374uY\317\276\331H9\266\336Tw\004\363!\032\247\211\206\333\0265I\262\254.\026\022d\0256\263h\333\367\222\3219\035\304\301\036\026s\036\030\321\033\301\374\204\253\030"
+	.string	"\027\365\252\202\202\274d\024|Dxi\212\334N*#B\275\033\210\213\266\267\334dYs\003uME[n\253\311\013;\241\327\344\336\221\244\017\326\354\272\306UZS\013\017\326 q\030P\315A\177I\335qv\035v\252}"
+	.string	"-\210\254>c*\004\034\205\371\343\264\333f/\335\356]\b\316\0258)\r5\231?\337*\324\f\354F?u<\013tD\241\343\001\023\327\177\342\200.5\033v:d\003\266\\}\003JF\003;e\271\327\363\250\216\342\224\366\232.\335\335\316\212V\233\001\365!\340\027\037\\\267\005\351\246.\303\022\030\254@\240W\372\247\303\030\347\321\265\025.S-\343\354\211\310"
+	.ascii	"\264\f\035\263\240\2418\2627\215\302\274q0\243(o\212<\304+\177"
+	.ascii	"b#\362\002\321i\031Td\243\217\240j\031\226Y\336\246\362_!N\301"
+	.ascii	"\263\027T\357\334\001Z\204\027\231\t\232k\bEW\376\266S\021P\016"
+	.ascii	"\365\347\024\\\271L\0174\304\n\364\356\203\202\344 \017/\364"
+	.ascii	"\221\222\254\n\242\305\341\201m\215\372\033\r\266-\242\204B\261"
+	.ascii	"\366\231\301\221#\377\035\214\200BkUS\275\224\241\202%\r]\017"
+	.ascii	"\374\0172ul\t\311\2539\334}\013C\322b\360\352\264"
+	.string	"\305\201\207W\2664\"\027\370\360\374#\303)\016\371w\214\2547w\266D4\264\345,<\n\\C]\006}\004j\020\3676\216B\034\231E\rm\212\206\023\032\274\025v\347\033u\304g\363\362=\216\035C\323\377\003%\022}\007\3444?D\325\013\t\232E\2411}GH \374\2124\177g\r?Y\264\256\316\357!t\002\030?\372x\036\361Ba\323\237\2505\2672\335\307\233\346z\026I\223\216\226\372\360\031\032\203\246\322\246%2\022\262\232\352g#\2300\032\017\324=\023\036\246\261\007\226#D0\365\354\267\305\3647\301\253=\314\307s\213\352g\264&\2773\224m\330\367n\";\002\263\322\235\321\351[\345\317\234\0061Yv\306$_\256/Q!z\233x4\b\356\310\345\267\363,R\326\236\203\376\001\370\270\2074\253\3474\363mk\2561\341M\311rxN\362\026\226\234+V\231\235qnV\216k\225\244\261\030\n"
+	.ascii	"\364\026s\bI\343\024\375\246b\321`\016o\214\2664_\366\367qg\b"
+	.ascii	"\326\227l\332\357\312\205\355B\300\206\r"
+	.string	"\223%\251R\270\300cI \230\260\332h\017\035\b\232j\334\317`.\260\240}\347\231l\271H\345o\307H!r\271\"\273\332$-%?\326W\312\327\b\242ie+\237\374\177%\200/\203\347\032\377\t\t]\305\026\264\243\\\b~\0274\313\026W\250\250\202\241+\342jj\\\031\2764\222l\037s\003\332\303\364\007*\264\003\241\235\361#%\324\247|\007\213\244\355\317\224\034]3!\f0\307\361\210vYEG\354\213:\035\303\006C4\f\251\221'\344a\220\230=\252\202\314\375\034\0317~\240gi\303kM\203Y\032E\340\354\306\254\345I\2132g\376\335\360\364\340\213`\373\f\032'\260\222o\032\350\237K\321\270>\262;\355o\364\341\211-\274\331`\223\202\301\257r\321v\257\341hh\330\342\200\373b\306VqY\323I\272\300{8D\037NV\020\327\341\207\251O\f\354 KA\f\376N\207\026\t\373\304\rb"
+	.string	"\303In\310\037\323\025\340\201n\226\222\rN/\003LR/\r~\327E\316\332\336I#\361\246l\353A7v\305Z&69!\224\326]\332\370\007\265\264@\357\220V/\315\230\352\247\313\255R\350\245\357\302\004 '?\221\227\303\341\315\276a\237\022d\317\242\374\260m\002d&\274\267\203\337U\213\241\232{S\307\244J\257\034\260\005\243\374\2670\350qR\226\352\361j<\320)\340\234\"\344\n\340\372\261\346\324\013\266\217\330s)\316T\377>T\345\022\210\001\321\330\016\355\321@\032\360\3641\274F\032O\336\n\277{\020c\314\027;_cf\237\344J\233\035\177\356\220\t)f\263\020\243\366\250\367\224{\201\311"
+	.ascii	"\004yQ\270\312\356\225\373_0\362'\202\215\250\213\005\177\330"
+	.ascii	"\357A\217\216;\263h\b~\003\336A\346\307\371N\336\276\371\243"
+	.ascii	"\340\233\330\030\317.au;\020\177\275\357\3457\363`6/-gv\327\316"
+	.ascii	"\251\306\307\3417\367krc{\200\337\236\206\375\341k1'\036o\207"
+	.ascii	"\3402\231\227\021\316\021h\211\232\\\035N\340\270\362I\232\366"
+	.ascii	"zt\031~Qt\215\340h\365\247\377\206<\004\\\264\276B\357l\301\267"
+	.ascii	"\223\035w\366E\027l\237\213\347\264\301/\300\027\326\022\200"
+	.ascii	"Wf\034\301N\352\375\036^\252\036\325\257\240\273#\263\212\362"
+	.ascii	"\013Z\026\216\024j\205\233rx\354\377\326K\354\020\302;\341T\333"
+	.ascii	"\036\2149\256\316\002\375\026?K\276!>a\336\360\263\313\314i\342"
+	.ascii	"\273\016\303\340\343\322\001\301\202\353\237\353\317\274q\302"
+	.ascii	",\237\f\316\037\347H\314\217(\277\";\202iH\356\f\371\025\265"
+	.ascii	"\303\220C\301\275\224I\270V\215\345wzW\250#\353\272\024\027:"
+	.ascii	"\362\356\277\271\035\003\224\272\001"
+	.text
+	.section	.gnu.lto_.symtab.a317780d6d121c7f,"e",@progbits
+	.string	"autotuneUpdateGains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\001"
+	.string	""
+	.string	"autotuneCheckUpdateGains"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.string	"autotuneStart"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\001"
+	.string	""
+	.string	"autotuneUpdateState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\356\001"
+	.string	""
+	.string	"autotuneFixedWingUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\373\001"
+	.string	""
+	.string	"pidAutotuneConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001\002"
+	.string	""
+	.string	"pgResetTemplate_pidAutotuneConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"pidAutotuneConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\002"
+	.string	""
+	.string	"pidAutotuneConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	">\002"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\361\001"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\363\001"
+	.string	""
+	.string	"currentControlRateProfile"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\001"
+	.string	""
+	.string	"pidProfile_ProfileCurrent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\001"
+	.string	""
+	.string	"blackboxLogEvent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\002"
+	.string	""
+	.string	"schedulePidGainsUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\002"
+	.string	""
+	.string	"pidBankMutable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"`\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"pidBank"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\002"
+	.string	""
+	.string	"enableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"l\002"
+	.string	""
+	.string	"disableFlightMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"constrainf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"x\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.a317780d6d121c7f,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
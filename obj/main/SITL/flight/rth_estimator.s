@@ -0,0 +1,8945 @@
+	.file	"rth_estimator.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	rth_estimator.c.acb5596b
+	.weak	rth_estimator.c.acb5596b
+rth_estimator.c.acb5596b:
+	.long	0x73
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2
+	.long	.LASF1494
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1483
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1484
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1485
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1486
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1487
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1488
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1489
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1490
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1491
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1492
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1493
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.file 1 "./src/main/flight/rth_estimator.c"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 2 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 3 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x2
+	.uleb128 0x3
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 5 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x5
+	.file 6 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 7 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x7
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF450
+	.file 8 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 9 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x9
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF504
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 12 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF577
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF595
+	.file 14 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xe
+	.file 15 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x10
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF618
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF504
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF678
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF682
+	.byte	0x4
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF683
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF746
+	.byte	0x4
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 23 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x17
+	.file 24 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x18
+	.file 25 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 26 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x1a
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 27 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x1b
+	.byte	0x4
+	.file 28 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x4
+	.file 29 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x1d
+	.file 30 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 31 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 32 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 33 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x21
+	.file 34 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x22
+	.file 35 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1030
+	.byte	0x4
+	.file 36 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1031
+	.byte	0x4
+	.file 37 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 38 "./src/main/fc/fc_core.h"
+	.byte	0x3
+	.uleb128 0x8
+	.uleb128 0x26
+	.byte	0x4
+	.file 39 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 40 "./src/main/flight/imu.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x28
+	.file 41 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 42 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x2a
+	.file 43 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2c
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1328
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF577
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1355
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x33
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x4
+	.file 53 "./src/main/common/quaternion.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x35
+	.byte	0x4
+	.byte	0x4
+	.file 54 "./src/main/flight/mixer.h"
+	.byte	0x3
+	.uleb128 0xc
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 55 "./src/main/flight/wind_estimator.h"
+	.byte	0x3
+	.uleb128 0xd
+	.uleb128 0x37
+	.byte	0x4
+	.file 56 "./src/main/navigation/navigation.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x38
+	.file 57 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x39
+	.byte	0x4
+	.file 58 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3a
+	.byte	0x4
+	.file 59 "./src/main/flight/failsafe.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 60 "./src/main/io/gps.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x3c
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 61 "./src/main/sensors/battery.h"
+	.byte	0x3
+	.uleb128 0x11
+	.uleb128 0x3d
+	.file 62 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF473
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF476
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF477
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF482
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF487
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF503
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF514
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF515
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF574
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF576
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF594
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF603
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF605
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF607
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF609
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF611
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF613
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF615
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF617
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF675
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF677
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF681
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF745
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF751
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF754
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF847
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF909
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF928
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF951
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF961
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF963
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF999
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1027
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1029
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1045
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1048
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF605
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF607
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF609
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF611
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF613
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF615
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF617
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1320
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1327
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1349
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1354
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1357
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1359
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1374
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1377
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1374
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1377
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1384
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1377
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1387
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1377
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1387
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1377
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1387
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1377
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1387
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1377
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1387
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1375
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1376
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1377
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1378
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1396
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1397
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1398
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1399
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1406
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1407
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1408
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1409
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1410
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1411
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1448
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1457
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1465
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1473
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1476
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.battery.h.24.51677ced5cbab253fc0b310fcbed170d,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1482
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF1495
+	.long	.LASF1496
+	.long	.LASF1497
+	.long	.LASF1498
+	.long	.LASF1499
+	.long	.LASF1500
+	.long	.LASF1501
+	.long	.LASF1502
+	.long	.LASF1503
+	.long	.LASF1504
+	.long	.LASF1505
+	.long	.LASF1506
+	.long	.LASF1507
+	.long	.LASF1508
+	.long	.LASF1509
+	.long	.LASF1510
+	.long	.LASF1511
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3f
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1512
+	.byte	0x6
+	.long	.LASF1513
+	.byte	0x10
+	.long	.LASF1514
+	.byte	0x1
+	.long	.LASF1515
+	.byte	0x11
+	.long	.LASF1516
+	.byte	0x11
+	.long	.LASF1516
+	.byte	0x10
+	.long	.LASF1517
+	.byte	0xd
+	.long	.LASF1518
+	.byte	0x10
+	.long	.LASF1519
+	.byte	0x10
+	.long	.LASF1520
+	.byte	0xd
+	.long	.LASF1521
+	.byte	0xd
+	.long	.LASF1522
+	.byte	0xf
+	.long	.LASF1523
+	.byte	0xd
+	.long	.LASF1524
+	.byte	0xe
+	.long	.LASF1525
+	.byte	0xe
+	.long	.LASF1526
+	.byte	0xd
+	.long	.LASF1527
+	.byte	0xd
+	.long	.LASF1528
+	.byte	0xd
+	.long	.LASF1529
+	.byte	0xd
+	.long	.LASF1530
+	.byte	0xd
+	.long	.LASF1531
+	.byte	0xd
+	.long	.LASF1532
+	.byte	0x11
+	.long	.LASF1533
+	.byte	0x2
+	.long	.LASF1534
+	.byte	0xc
+	.long	.LASF1535
+	.byte	0xb
+	.long	.LASF1536
+	.byte	0xa
+	.long	.LASF1537
+	.byte	0xb
+	.long	.LASF1538
+	.byte	0xb
+	.long	.LASF1539
+	.byte	0x3
+	.long	.LASF1540
+	.byte	0x1
+	.long	.LASF1541
+	.byte	0x2
+	.long	.LASF1542
+	.byte	0x2
+	.long	.LASF1543
+	.byte	0x5
+	.long	.LASF1544
+	.byte	0x4
+	.long	.LASF1545
+	.byte	0x4
+	.long	.LASF1546
+	.byte	0x4
+	.long	.LASF1547
+	.byte	0x5
+	.long	.LASF1548
+	.byte	0x5
+	.long	.LASF1549
+	.byte	0x5
+	.long	.LASF1550
+	.byte	0x6
+	.long	.LASF1551
+	.byte	0x2
+	.long	.LASF1552
+	.byte	0x2
+	.long	.LASF1553
+	.byte	0x10
+	.long	.LASF1554
+	.byte	0xd
+	.long	.LASF1555
+	.byte	0xd
+	.long	.LASF1556
+	.byte	0xd
+	.long	.LASF1557
+	.byte	0xd
+	.long	.LASF1558
+	.byte	0xd
+	.long	.LASF1559
+	.byte	0xd
+	.long	.LASF1560
+	.byte	0xd
+	.long	.LASF1561
+	.byte	0xd
+	.long	.LASF1562
+	.byte	0xd
+	.long	.LASF1563
+	.byte	0x2
+	.long	.LASF1564
+	.byte	0x6
+	.long	.LASF1565
+	.byte	0x6
+	.long	.LASF1566
+	.byte	0x8
+	.long	.LASF1567
+	.byte	0x2
+	.long	.LASF1568
+	.byte	0x3
+	.long	.LASF1569
+	.byte	0x6
+	.long	.LASF1570
+	.byte	0x7
+	.long	.LASF1571
+	.byte	0x9
+	.long	.LASF1533
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF691:
+	.string	"INT32_MAX (2147483647)"
+.LASF797:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1128:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1424:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF633:
+	.string	"__STD_TYPE typedef"
+.LASF1053:
+	.string	"__DECL_SIMD_cosl "
+.LASF845:
+	.string	"USE_CLI_BATCH "
+.LASF792:
+	.string	"USE_OPFLOW "
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1122:
+	.string	"__DECL_SIMD_atanf "
+.LASF1323:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF1089:
+	.string	"__DECL_SIMD_logf64x "
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1291:
+	.string	"__DECL_SIMD_asinh "
+.LASF1037:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF963:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF764:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1227:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1007:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1400:
+	.string	"__MATHCALL"
+.LASF1336:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF753:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF1289:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1158:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1343:
+	.string	"__f64(x) x ##f64"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF835:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF769:
+	.string	"USE_GPS "
+.LASF982:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF466:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1369:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF564:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1256:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF824:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1177:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF478:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF879:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1147:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF950:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF539:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF666:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1041:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF1143:
+	.string	"__DECL_SIMD_hypotl "
+.LASF737:
+	.string	"INT16_C(c) c"
+.LASF758:
+	.string	"USE_I2C_PULLUP "
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1257:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1211:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1103:
+	.string	"__DECL_SIMD_powl "
+.LASF730:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1165:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1112:
+	.string	"__DECL_SIMD_acosf "
+.LASF1162:
+	.string	"__DECL_SIMD_exp10f "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF1135:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1216:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1396:
+	.string	"__MATHDECL_1_IMPL"
+.LASF777:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1352:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1149:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF765:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1277:
+	.string	"__DECL_SIMD_erff128 "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1106:
+	.string	"__DECL_SIMD_powf64 "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF862:
+	.string	"USE_UART7 "
+.LASF871:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF947:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF956:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF772:
+	.string	"USE_TELEMETRY "
+.LASF1130:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF1222:
+	.string	"__DECL_SIMD_log10f "
+.LASF706:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF774:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF976:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF553:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF653:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF948:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1111:
+	.string	"__DECL_SIMD_acos "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF678:
+	.string	"__STD_TYPE"
+.LASF1092:
+	.string	"__DECL_SIMD_expf "
+.LASF1432:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1453:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF716:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF526:
+	.string	"__P(args) args"
+.LASF1058:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF915:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1305:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1438:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF408:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF927:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF646:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1260:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF830:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1254:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF443:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF902:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1442:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF889:
+	.string	"USE_VCP"
+.LASF849:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF720:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF401:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1330:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1312:
+	.string	"__DECL_SIMD_tanf "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1119:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF472:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF677:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF685:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF630:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF514:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF973:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF944:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF488:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF412:
+	.string	"_T_SIZE "
+.LASF1017:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1470:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF967:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF694:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF715:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF454:
+	.string	"__USE_ISOC95"
+.LASF1244:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF796:
+	.string	"USE_1WIRE "
+.LASF711:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1241:
+	.string	"__DECL_SIMD_log1p "
+.LASF1412:
+	.string	"__MATHCALL_NARROW"
+.LASF469:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1405:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF1437:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1374:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF456:
+	.string	"__USE_POSIX"
+.LASF1387:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1110:
+	.string	"__DECL_SIMD_powf128x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1295:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF898:
+	.string	"U_ID_1 1"
+.LASF536:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1441:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF891:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1392:
+	.string	"_Mdouble_ _Float32x"
+.LASF1433:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF732:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF598:
+	.string	"__stub_fchflags "
+.LASF877:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1160:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1416:
+	.string	"FP_NAN 0"
+.LASF655:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1366:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF430:
+	.string	"_T_WCHAR "
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF465:
+	.string	"__USE_XOPEN2K8"
+.LASF829:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF563:
+	.string	"__always_inline"
+.LASF410:
+	.string	"_SYS_SIZE_T_H "
+.LASF763:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1178:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1364:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1073:
+	.string	"__DECL_SIMD_sincosl "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF476:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF687:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF931:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF512:
+	.string	"__GLIBC__ 2"
+.LASF480:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1494:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1483:
+	.string	"long int"
+.LASF504:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1057:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1105:
+	.string	"__DECL_SIMD_powf32 "
+.LASF541:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF481:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF498:
+	.string	"__USE_XOPEN2K8 1"
+.LASF661:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1399:
+	.string	"__MATHDECL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1428:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1191:
+	.string	"__DECL_SIMD_sinh "
+.LASF933:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF791:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF407:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF752:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF1006:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1252:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1026:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF675:
+	.string	"__FD_SETSIZE 1024"
+.LASF1381:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1373:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF1163:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1376:
+	.string	"__MATH_PRECNAME"
+.LASF660:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1462:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF1141:
+	.string	"__DECL_SIMD_hypot "
+.LASF1407:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF722:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF654:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF560:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF561:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF419:
+	.string	"_SIZE_T_DECLARED "
+.LASF528:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF818:
+	.string	"CMS_MENU_OSD "
+.LASF874:
+	.string	"USE_DASHBOARD"
+.LASF1197:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1242:
+	.string	"__DECL_SIMD_log1pf "
+.LASF969:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1423:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF946:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1429:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF549:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF729:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF914:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1398:
+	.string	"__MATHDECL_ALIAS"
+.LASF1341:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF983:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF449:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1230:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF636:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF505:
+	.string	"__USE_MISC 1"
+.LASF1482:
+	.string	"MAX_BATTERY_PROFILE_COUNT 3"
+.LASF605:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF789:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1379:
+	.string	"_Mdouble_ float"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF509:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF519:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF937:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1047:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1077:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1488:
+	.string	"signed char"
+.LASF1232:
+	.string	"__DECL_SIMD_log2f "
+.LASF928:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1101:
+	.string	"__DECL_SIMD_pow "
+.LASF1466:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1378:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF620:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF530:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF827:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF635:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1159:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1402:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1406:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF520:
+	.string	"__LEAF , __leaf__"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1114:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF1240:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF801:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF651:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF870:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1425:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1248:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF612:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF418:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1226:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF1382:
+	.string	"_Mdouble_ long double"
+.LASF1485:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF486:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF527:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF517:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF707:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1091:
+	.string	"__DECL_SIMD_exp "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF856:
+	.string	"USE_UART1 "
+.LASF420:
+	.string	"__DEFINED_size_t "
+.LASF618:
+	.string	"_BITS_TYPES_H 1"
+.LASF1115:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1086:
+	.string	"__DECL_SIMD_logf64 "
+.LASF773:
+	.string	"USE_TELEMETRY_LTM "
+.LASF911:
+	.string	"NOINLINE "
+.LASF904:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1300:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF858:
+	.string	"USE_UART3 "
+.LASF1120:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1447:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF782:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1351:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1479:
+	.string	"VBAT_SCALE_MAX 65535"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF686:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1354:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF943:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1298:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1471:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1493:
+	.string	"_Bool"
+.LASF1140:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF565:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF596:
+	.string	"__stub___compat_bdflush "
+.LASF1221:
+	.string	"__DECL_SIMD_log10 "
+.LASF416:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF444:
+	.string	"NULL"
+.LASF1258:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF761:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF662:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1308:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF473:
+	.string	"__USE_GNU"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF702:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1184:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1490:
+	.string	"char"
+.LASF929:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF908:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1434:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1337:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1220:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF607:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1263:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1116:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF601:
+	.string	"__stub_setlogin "
+.LASF1363:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1121:
+	.string	"__DECL_SIMD_atan "
+.LASF1212:
+	.string	"__DECL_SIMD_atan2f "
+.LASF799:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF623:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF475:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF1294:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF568:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1231:
+	.string	"__DECL_SIMD_log2 "
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF746:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1010:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1299:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF1062:
+	.string	"__DECL_SIMD_sinf "
+.LASF463:
+	.string	"__USE_XOPEN2K"
+.LASF1313:
+	.string	"__DECL_SIMD_tanl "
+.LASF958:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF548:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF464:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1190:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1068:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1417:
+	.string	"FP_INFINITE 1"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1345:
+	.string	"__f64x(x) x ##f64x"
+.LASF1003:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF566:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF602:
+	.string	"__stub_sigreturn "
+.LASF1167:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF901:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1157:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF495:
+	.string	"__USE_POSIX199309 1"
+.LASF1022:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF900:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF713:
+	.string	"INT_FAST8_MAX (127)"
+.LASF701:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1055:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF1414:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1439:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF1292:
+	.string	"__DECL_SIMD_asinhf "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1155:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1395:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF742:
+	.string	"UINT32_C(c) c ## U"
+.LASF721:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF458:
+	.string	"__USE_POSIX199309"
+.LASF692:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF756:
+	.string	"I2C1_OVERCLOCK false"
+.LASF1188:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1346:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF932:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1078:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1265:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF910:
+	.string	"FAST_CODE "
+.LASF1249:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF731:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1418:
+	.string	"FP_ZERO 2"
+.LASF1269:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF816:
+	.string	"USE_STATS "
+.LASF807:
+	.string	"USE_FRSKYOSD "
+.LASF513:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF462:
+	.string	"__USE_UNIX98"
+.LASF834:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1444:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF479:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF848:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF949:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1029:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1206:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF676:
+	.string	"_BITS_TIME64_H 1"
+.LASF1169:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF639:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1458:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1199:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF438:
+	.string	"__INT_WCHAR_T_H "
+.LASF624:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1044:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1465:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF786:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF669:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF760:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF762:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1048:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1266:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF709:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1327:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF535:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF991:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF671:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF842:
+	.string	"USE_VTX_FFPV "
+.LASF1237:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF615:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF867:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1200:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1303:
+	.string	"__DECL_SIMD_erfcl "
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF577:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF748:
+	.string	"bool _Bool"
+.LASF1009:
+	.string	"STR_HELPER(x) #x"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF994:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF433:
+	.string	"_BSD_WCHAR_T_ "
+.LASF672:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1253:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1375:
+	.string	"_Mdouble_"
+.LASF784:
+	.string	"USE_RX_UIB "
+.LASF1468:
+	.string	"LAT 0"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF718:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF998:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1054:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF814:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF1238:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF608:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF502:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF1371:
+	.string	"_Mdouble_ double"
+.LASF828:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF925:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF930:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF542:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1394:
+	.string	"_Mdouble_ _Float64x"
+.LASF986:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1302:
+	.string	"__DECL_SIMD_erfcf "
+.LASF719:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF650:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF712:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF609:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF445:
+	.string	"NULL ((void *)0)"
+.LASF1004:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1239:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF872:
+	.string	"USE_USB_MSC"
+.LASF899:
+	.string	"U_ID_2 2"
+.LASF558:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF446:
+	.string	"__need_NULL"
+.LASF980:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1131:
+	.string	"__DECL_SIMD_asin "
+.LASF1207:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF954:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF863:
+	.string	"USE_UART8 "
+.LASF1109:
+	.string	"__DECL_SIMD_powf64x "
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1236:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1021:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF499:
+	.string	"_ATFILE_SOURCE"
+.LASF629:
+	.string	"__SLONG32_TYPE int"
+.LASF734:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1335:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF450:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF817:
+	.string	"USE_CMS "
+.LASF1138:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1180:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF452:
+	.string	"__USE_ISOC11"
+.LASF503:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1152:
+	.string	"__DECL_SIMD_exp2f "
+.LASF555:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF681:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF683:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF776:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1233:
+	.string	"__DECL_SIMD_log2l "
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF809:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1288:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1329:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1355:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1290:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF632:
+	.string	"__U64_TYPE unsigned long int"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF725:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF1168:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF652:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1148:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1484:
+	.string	"long unsigned int"
+.LASF693:
+	.string	"UINT8_MAX (255)"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF521:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1060:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF489:
+	.string	"_POSIX_SOURCE"
+.LASF907:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1161:
+	.string	"__DECL_SIMD_exp10 "
+.LASF587:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF600:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF411:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1334:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1317:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1393:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF905:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1014:
+	.string	"UNUSED(x) (void)(x)"
+.LASF540:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF926:
+	.string	"EXTENDED_FASTRAM "
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1030:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1262:
+	.string	"__DECL_SIMD_acoshf "
+.LASF571:
+	.string	"__restrict_arr __restrict"
+.LASF1449:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1186:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF522:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1224:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF451:
+	.string	"_FEATURES_H 1"
+.LASF484:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1094:
+	.string	"__DECL_SIMD_expf16 "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1365:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1413:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF447:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF467:
+	.string	"__USE_LARGEFILE"
+.LASF1150:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF833:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1427:
+	.string	"MATH_ERRNO 1"
+.LASF552:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1304:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1175:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1033:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1023:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF850:
+	.string	"USE_IMU_FAKE "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF634:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1000:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1204:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1377:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1066:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1319:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF864:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF402:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1320:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1170:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF922:
+	.string	"UNIT_TESTED "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF840:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1082:
+	.string	"__DECL_SIMD_logf "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF397:
+	.string	"_T_PTRDIFF_ "
+.LASF853:
+	.string	"USE_FAKE_GPS "
+.LASF1043:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1467:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF938:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF471:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1273:
+	.string	"__DECL_SIMD_erfl "
+.LASF1419:
+	.string	"FP_SUBNORMAL 3"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1179:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1223:
+	.string	"__DECL_SIMD_log10l "
+.LASF1213:
+	.string	"__DECL_SIMD_atan2l "
+.LASF1383:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1397:
+	.string	"__MATHDECL_1"
+.LASF770:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF670:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF997:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF1464:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF775:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF429:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF1347:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1210:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF1063:
+	.string	"__DECL_SIMD_sinl "
+.LASF580:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF457:
+	.string	"__USE_POSIX2"
+.LASF934:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1205:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1436:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF425:
+	.string	"__need_size_t"
+.LASF841:
+	.string	"USE_VTX_TRAMP "
+.LASF881:
+	.string	"USE_PITOT_MS4525"
+.LASF414:
+	.string	"_SIZE_T_ "
+.LASF1278:
+	.string	"__DECL_SIMD_erff32x "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1264:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1431:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1435:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1142:
+	.string	"__DECL_SIMD_hypotf "
+.LASF1201:
+	.string	"__DECL_SIMD_cbrt "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1166:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF426:
+	.string	"__wchar_t__ "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF594:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF448:
+	.string	"_STDINT_H 1"
+.LASF1051:
+	.string	"__DECL_SIMD_cos "
+.LASF1340:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1039:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1202:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF724:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF575:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF431:
+	.string	"__WCHAR_T "
+.LASF1492:
+	.string	"double"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF832:
+	.string	"USE_SERIALRX_XBUS "
+.LASF525:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1080:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF940:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF971:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1475:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF574:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF892:
+	.string	"USE_RCDEVICE"
+.LASF790:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF516:
+	.string	"__PMT"
+.LASF989:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1108:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1261:
+	.string	"__DECL_SIMD_acosh "
+.LASF795:
+	.string	"USE_PITOT_MS4525 "
+.LASF1228:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF974:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF1031:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1326:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1129:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF1348:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF656:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF500:
+	.string	"_ATFILE_SOURCE 1"
+.LASF625:
+	.string	"__SQUAD_TYPE long int"
+.LASF1306:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF917:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1491:
+	.string	"float"
+.LASF1098:
+	.string	"__DECL_SIMD_expf32x "
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF474:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF591:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF395:
+	.string	"_ANSI_STDDEF_H "
+.LASF1243:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1309:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1404:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1181:
+	.string	"__DECL_SIMD_expm1 "
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1255:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1219:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF961:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1247:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF358:
+	.string	"__k8 1"
+.LASF586:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1182:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1322:
+	.string	"__HAVE_FLOAT128 1"
+.LASF875:
+	.string	"USE_OLED_UG2864"
+.LASF1445:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1095:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1164:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1487:
+	.string	"unsigned int"
+.LASF680:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF806:
+	.string	"USE_TELEMETRY_SIM "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF396:
+	.string	"_PTRDIFF_T "
+.LASF1296:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1286:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1472:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1032:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF882:
+	.string	"USE_PITOT_ADC"
+.LASF880:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF846:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF470:
+	.string	"__USE_MISC"
+.LASF1370:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF747:
+	.string	"_STDBOOL_H "
+.LASF440:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1446:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF497:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1090:
+	.string	"__DECL_SIMD_logf128x "
+.LASF663:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1316:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF622:
+	.string	"__U32_TYPE unsigned int"
+.LASF1385:
+	.string	"_Mdouble_ _Float32"
+.LASF1455:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF823:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF398:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF547:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1015:
+	.string	"BIT(x) (1 << (x))"
+.LASF1097:
+	.string	"__DECL_SIMD_expf128 "
+.LASF1218:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF869:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1072:
+	.string	"__DECL_SIMD_sincosf "
+.LASF551:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF573:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF599:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF704:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF659:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF697:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF895:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF825:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF616:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF781:
+	.string	"USE_GYRO_KALMAN "
+.LASF1153:
+	.string	"__DECL_SIMD_exp2l "
+.LASF562:
+	.string	"__wur "
+.LASF757:
+	.string	"I2C2_OVERCLOCK false"
+.LASF771:
+	.string	"USE_NAV "
+.LASF953:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF1102:
+	.string	"__DECL_SIMD_powf "
+.LASF750:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF736:
+	.string	"INT8_C(c) c"
+.LASF749:
+	.string	"true 1"
+.LASF404:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF628:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF674:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF511:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF638:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1104:
+	.string	"__DECL_SIMD_powf16 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1064:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1401:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1279:
+	.string	"__DECL_SIMD_erff64x "
+.LASF964:
+	.string	"sq(x) ((x)*(x))"
+.LASF645:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1275:
+	.string	"__DECL_SIMD_erff32 "
+.LASF523:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF579:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF578:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF988:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF529:
+	.string	"__STRING(x) #x"
+.LASF606:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1189:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF576:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1339:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF812:
+	.string	"USE_ANTIGRAVITY "
+.LASF1079:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF421:
+	.string	"___int_size_t_h "
+.LASF1284:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1448:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF996:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF428:
+	.string	"_WCHAR_T "
+.LASF1005:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF1333:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1411:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1246:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF972:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF851:
+	.string	"USE_FAKE_BARO "
+.LASF1267:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1187:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF403:
+	.string	"_GCC_PTRDIFF_T "
+.LASF754:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF805:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF854:
+	.string	"USE_MAG "
+.LASF583:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1093:
+	.string	"__DECL_SIMD_expl "
+.LASF524:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF585:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF1318:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF409:
+	.string	"_SIZE_T "
+.LASF436:
+	.string	"_WCHAR_T_H "
+.LASF1270:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1172:
+	.string	"__DECL_SIMD_coshf "
+.LASF1389:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1087:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1107:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1234:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF1250:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF813:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF699:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF942:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF852:
+	.string	"USE_FAKE_MAG "
+.LASF1478:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF544:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF866:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF647:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1196:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1137:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF783:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF394:
+	.string	"_STDDEF_H_ "
+.LASF1156:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF413:
+	.string	"__SIZE_T "
+.LASF1245:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF1002:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1081:
+	.string	"__DECL_SIMD_log "
+.LASF1113:
+	.string	"__DECL_SIMD_acosl "
+.LASF1276:
+	.string	"__DECL_SIMD_erff64 "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1027:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF727:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF453:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF959:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF836:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1315:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF461:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1325:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF987:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1059:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF531:
+	.string	"__BEGIN_DECLS "
+.LASF1084:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1025:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1096:
+	.string	"__DECL_SIMD_expf64 "
+.LASF439:
+	.string	"_GCC_WCHAR_T "
+.LASF1125:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF708:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1217:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1001:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF995:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF559:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1028:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF496:
+	.string	"__USE_POSIX199506 1"
+.LASF1314:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF755:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF684:
+	.string	"__intptr_t_defined "
+.LASF1036:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1268:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF819:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF876:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1287:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1018:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1282:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1384:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF383:
+	.string	"SITL 1"
+.LASF1124:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1020:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF455:
+	.string	"__USE_ISOCXX11"
+.LASF417:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1310:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1457:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF916:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1311:
+	.string	"__DECL_SIMD_tan "
+.LASF1076:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF590:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF399:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1415:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF811:
+	.string	"USE_D_BOOST "
+.LASF705:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1426:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1229:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1133:
+	.string	"__DECL_SIMD_asinl "
+.LASF492:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1035:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF1480:
+	.string	"CURRENT_METER_SCALE 400"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1194:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1443:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF975:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF1193:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1215:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1214:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF477:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF459:
+	.string	"__USE_POSIX199506"
+.LASF1469:
+	.string	"LON 1"
+.LASF738:
+	.string	"INT32_C(c) c"
+.LASF1070:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1359:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF743:
+	.string	"UINT64_C(c) c ## UL"
+.LASF860:
+	.string	"USE_UART5 "
+.LASF945:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF803:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1274:
+	.string	"__DECL_SIMD_erff16 "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1368:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1046:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF501:
+	.string	"__WORDSIZE 64"
+.LASF909:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF424:
+	.string	"__size_t "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1460:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF603:
+	.string	"__stub_stty "
+.LASF1151:
+	.string	"__DECL_SIMD_exp2 "
+.LASF802:
+	.string	"USE_DASHBOARD "
+.LASF643:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF810:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF537:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1146:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF631:
+	.string	"__S64_TYPE long int"
+.LASF415:
+	.string	"_BSD_SIZE_T_ "
+.LASF843:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF978:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF534:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF460:
+	.string	"__USE_XOPEN"
+.LASF432:
+	.string	"_WCHAR_T_ "
+.LASF955:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF794:
+	.string	"USE_OPFLOW_MSP "
+.LASF1331:
+	.string	"__HAVE_FLOAT64 1"
+.LASF951:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1307:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF621:
+	.string	"__S32_TYPE int"
+.LASF1050:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF695:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF820:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1117:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF556:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1481:
+	.string	"CURRENT_METER_OFFSET 0"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1183:
+	.string	"__DECL_SIMD_expm1l "
+.LASF793:
+	.string	"USE_OPFLOW_CXOF "
+.LASF733:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF837:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF679:
+	.string	"_BITS_WCHAR_H 1"
+.LASF766:
+	.string	"USE_ADC_AVERAGING "
+.LASF1074:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1353:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF739:
+	.string	"INT64_C(c) c ## L"
+.LASF1280:
+	.string	"__DECL_SIMD_erff128x "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1386:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF981:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1321:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF745:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF993:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF1203:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF787:
+	.string	"USE_RANGEFINDER "
+.LASF1476:
+	.string	"RADAR_MAX_POIS 5"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1185:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF894:
+	.string	"USE_ITCM_RAM"
+.LASF965:
+	.string	"FAST_MATH "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1145:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF839:
+	.string	"USE_VTX_CONTROL "
+.LASF893:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1272:
+	.string	"__DECL_SIMD_erff "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1134:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF985:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF920:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1209:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1013:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1259:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1297:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF597:
+	.string	"__stub_chflags "
+.LASF1042:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF941:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF423:
+	.string	"_SIZET_ "
+.LASF665:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF861:
+	.string	"USE_UART6 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1061:
+	.string	"__DECL_SIMD_sin "
+.LASF1420:
+	.string	"FP_NORMAL 4"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF589:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF913:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1350:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF658:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF779:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF584:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF1328:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF567:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF886:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1332:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF1342:
+	.string	"__f32(x) x ##f32"
+.LASF1450:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF557:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF888:
+	.string	"USE_ADC"
+.LASF884:
+	.string	"USE_1WIRE_DS2482"
+.LASF935:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF885:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF717:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1139:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF532:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1052:
+	.string	"__DECL_SIMD_cosf "
+.LASF1075:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1456:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1065:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF593:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1251:
+	.string	"__DECL_SIMD_atanh "
+.LASF960:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1390:
+	.string	"_Mdouble_ _Float128"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1489:
+	.string	"short int"
+.LASF393:
+	.string	"_STDDEF_H "
+.LASF990:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF648:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1099:
+	.string	"__DECL_SIMD_expf64x "
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF482:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF570:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF515:
+	.string	"_SYS_CDEFS_H 1"
+.LASF767:
+	.string	"USE_64BIT_TIME "
+.LASF689:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1154:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF545:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1324:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1038:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF788:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF923:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF582:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1173:
+	.string	"__DECL_SIMD_coshl "
+.LASF1034:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF952:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF626:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF611:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF406:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF617:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF400:
+	.string	"_PTRDIFF_T_ "
+.LASF664:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF543:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1473:
+	.string	"HDOP_SCALE (100)"
+.LASF924:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF804:
+	.string	"USE_OLED_UG2864 "
+.LASF435:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1176:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF906:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1100:
+	.string	"__DECL_SIMD_expf128x "
+.LASF546:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF627:
+	.string	"__SWORD_TYPE long int"
+.LASF992:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF550:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF427:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF554:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1301:
+	.string	"__DECL_SIMD_erfc "
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF640:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF493:
+	.string	"__USE_POSIX 1"
+.LASF1208:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF726:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1049:
+	.string	"_MATH_H 1"
+.LASF723:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1271:
+	.string	"__DECL_SIMD_erf "
+.LASF912:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF592:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF441:
+	.string	"__DEFINED_wchar_t "
+.LASF1421:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1344:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF918:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1083:
+	.string	"__DECL_SIMD_logl "
+.LASF741:
+	.string	"UINT16_C(c) c"
+.LASF921:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF800:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF855:
+	.string	"USE_BARO "
+.LASF619:
+	.string	"__S16_TYPE short int"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF735:
+	.string	"WINT_MAX (4294967295u)"
+.LASF977:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1367:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1126:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1011:
+	.string	"EXPAND_I(x) x"
+.LASF696:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1356:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1171:
+	.string	"__DECL_SIMD_cosh "
+.LASF896:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF434:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF506:
+	.string	"__USE_ATFILE 1"
+.LASF487:
+	.string	"__USE_ISOC95 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF740:
+	.string	"UINT8_C(c) c"
+.LASF1454:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF778:
+	.string	"USE_PITOT_ADC "
+.LASF1338:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF437:
+	.string	"___int_wchar_t_h "
+.LASF1019:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1008:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1408:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1409:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF785:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1391:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF887:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF581:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF657:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF569:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF688:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1283:
+	.string	"__DECL_SIMD_tanhl "
+.LASF1127:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF979:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF483:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1085:
+	.string	"__DECL_SIMD_logf32 "
+.LASF857:
+	.string	"USE_UART2 "
+.LASF1285:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1357:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1477:
+	.string	"VBAT_SCALE_DEFAULT 1100"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF939:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF442:
+	.string	"_BSD_WCHAR_T_"
+.LASF1362:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF703:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1174:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF826:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1461:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF485:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1198:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF637:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF698:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1403:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1040:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF710:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1422:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF533:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF970:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF490:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF494:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF649:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1235:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF588:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1281:
+	.string	"__DECL_SIMD_tanh "
+.LASF690:
+	.string	"INT16_MAX (32767)"
+.LASF610:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF883:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF868:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF641:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF897:
+	.string	"U_ID_0 0"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF642:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF873:
+	.string	"USE_SERVO_SBUS"
+.LASF700:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF966:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1361:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF890:
+	.string	"USE_RX_PPM"
+.LASF518:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1069:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF376:
+	.string	"unix 1"
+.LASF999:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF682:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1486:
+	.string	"short unsigned int"
+.LASF844:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1388:
+	.string	"_Mdouble_ _Float64"
+.LASF714:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF613:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF822:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF507:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1045:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF510:
+	.string	"__GNU_LIBRARY__"
+.LASF614:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF751:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1071:
+	.string	"__DECL_SIMD_sincos "
+.LASF668:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF865:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1067:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF508:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1132:
+	.string	"__DECL_SIMD_asinf "
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1123:
+	.string	"__DECL_SIMD_atanl "
+.LASF878:
+	.string	"USE_RANGEFINDER"
+.LASF962:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF831:
+	.string	"USE_SERIALRX_SUMH "
+.LASF405:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1360:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1372:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF815:
+	.string	"USE_LOG "
+.LASF759:
+	.string	"USE_RX_PPM "
+.LASF538:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1452:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF595:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF768:
+	.string	"USE_BLACKBOX "
+.LASF1192:
+	.string	"__DECL_SIMD_sinhf "
+.LASF957:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1024:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1349:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF644:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF859:
+	.string	"USE_UART4 "
+.LASF1012:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1440:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF838:
+	.string	"USE_RCDEVICE "
+.LASF1118:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF468:
+	.string	"__USE_LARGEFILE64"
+.LASF1144:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1410:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1088:
+	.string	"__DECL_SIMD_logf32x "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF936:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF903:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1474:
+	.string	"NAV_BLACKBOX "
+.LASF1293:
+	.string	"__DECL_SIMD_asinhl "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF919:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1358:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1451:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF984:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF1459:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1195:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1380:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF604:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF847:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1016:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF673:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF728:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1136:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1225:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1430:
+	.string	"M_E 2.7182818284590452354"
+.LASF491:
+	.string	"_POSIX_C_SOURCE"
+.LASF780:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF667:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF968:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF744:
+	.string	"INTMAX_C(c) c ## L"
+.LASF821:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF422:
+	.string	"_GCC_SIZE_T "
+.LASF572:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1463:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF1056:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF798:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF808:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1545:
+	.string	"io_types.h"
+.LASF1561:
+	.string	"mathcalls-helper-functions.h"
+.LASF1553:
+	.string	"math.h"
+.LASF1523:
+	.string	"long-double.h"
+.LASF1534:
+	.string	"platform.h"
+.LASF1562:
+	.string	"mathcalls.h"
+.LASF1536:
+	.string	"target.h"
+.LASF1546:
+	.string	"rx_pwm.h"
+.LASF1517:
+	.string	"libc-header-start.h"
+.LASF1509:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1502:
+	.string	"src/main/navigation"
+.LASF1530:
+	.string	"stdint-intn.h"
+.LASF1551:
+	.string	"axis.h"
+.LASF1508:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1511:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1524:
+	.string	"stubs.h"
+.LASF1504:
+	.string	"src/main/target/SITL"
+.LASF1501:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1547:
+	.string	"stats.h"
+.LASF1507:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1569:
+	.string	"failsafe.h"
+.LASF1543:
+	.string	"config.h"
+.LASF1550:
+	.string	"imu.h"
+.LASF1519:
+	.string	"features-time64.h"
+.LASF1526:
+	.string	"types.h"
+.LASF1554:
+	.string	"math-vector.h"
+.LASF1557:
+	.string	"floatn-common.h"
+.LASF1556:
+	.string	"floatn.h"
+.LASF1521:
+	.string	"timesize.h"
+.LASF1532:
+	.string	"stdbool.h"
+.LASF1510:
+	.string	"/usr/include"
+.LASF1512:
+	.string	"rth_estimator.c"
+.LASF1495:
+	.string	"src/main/build"
+.LASF1537:
+	.string	"sanity_check.h"
+.LASF1518:
+	.string	"features.h"
+.LASF1535:
+	.string	"common.h"
+.LASF1527:
+	.string	"typesizes.h"
+.LASF1496:
+	.string	"src/main/common"
+.LASF1497:
+	.string	"src/main/config"
+.LASF1566:
+	.string	"navigation.h"
+.LASF1528:
+	.string	"time64.h"
+.LASF1531:
+	.string	"stdint-uintn.h"
+.LASF1505:
+	.string	"src/main/target"
+.LASF1542:
+	.string	"utils.h"
+.LASF1555:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1568:
+	.string	"feature.h"
+.LASF1503:
+	.string	"src/main/sensors"
+.LASF1565:
+	.string	"wind_estimator.h"
+.LASF1558:
+	.string	"flt-eval-method.h"
+.LASF1506:
+	.string	"src/main"
+.LASF1548:
+	.string	"fc_core.h"
+.LASF1533:
+	.string	"time.h"
+.LASF1564:
+	.string	"mixer.h"
+.LASF1514:
+	.string	"debug.h"
+.LASF1529:
+	.string	"wchar.h"
+.LASF1560:
+	.string	"fp-fast.h"
+.LASF1549:
+	.string	"runtime_config.h"
+.LASF1570:
+	.string	"gps.h"
+.LASF1498:
+	.string	"src/main/drivers"
+.LASF1563:
+	.string	"quaternion.h"
+.LASF0:
+	.string	"./src/main/flight/rth_estimator.c"
+.LASF1541:
+	.string	"maths.h"
+.LASF1559:
+	.string	"fp-logb.h"
+.LASF1500:
+	.string	"src/main/flight"
+.LASF1522:
+	.string	"cdefs.h"
+.LASF1516:
+	.string	"stdint.h"
+.LASF1540:
+	.string	"build_config.h"
+.LASF1515:
+	.string	"stddef.h"
+.LASF1525:
+	.string	"stubs-64.h"
+.LASF1552:
+	.string	"vector.h"
+.LASF1520:
+	.string	"wordsize.h"
+.LASF1571:
+	.string	"battery.h"
+.LASF1499:
+	.string	"src/main/fc"
+.LASF1538:
+	.string	"common_post.h"
+.LASF1544:
+	.string	"adc.h"
+.LASF1539:
+	.string	"parameter_group.h"
+.LASF1513:
+	.string	"stdc-predef.h"
+.LASF1567:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.d6e84129537e0573,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.d6e84129537e0573,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.d6e84129537e0573,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.d6e84129537e0573,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.d6e84129537e0573,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.d6e84129537e0573,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.d6e84129537e0573,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.d6e84129537e0573,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.d6e84129537e0573,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.d6e84129537e0573,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.d6e84129537e0573,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\001"
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.symtab.d6e84129537e0573,"e",@progbits
+	.text
+	.section	.gnu.lto_.ext_symtab.d6e84129537e0573,"e",@progbits
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
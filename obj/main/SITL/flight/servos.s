@@ -0,0 +1,16962 @@
+	.file	"servos.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/config/parameter_group.h"
+	.file 6 "./src/main/common/time.h"
+	.file 7 "./src/main/common/filter.h"
+	.file 8 "./src/main/flight/mixer.h"
+	.file 9 "./src/main/flight/servos.h"
+	.file 10 "./src/main/drivers/pwm_mapping.h"
+	.file 11 "./src/main/drivers/adc.h"
+	.file 12 "./src/main/fc/config.h"
+	.file 13 "./src/main/fc/rc_controls.h"
+	.file 14 "./src/main/fc/rc_modes.h"
+	.file 15 "./src/main/fc/runtime_config.h"
+	.file 16 "./src/main/flight/imu.h"
+	.file 17 "./src/main/flight/pid.h"
+	.file 18 "./src/main/drivers/resource.h"
+	.file 19 "./src/main/sensors/gyro.h"
+	.file 20 "./src/main/flight/servos.c"
+	.file 21 "./src/main/common/logic_condition.h"
+	.file 22 "./src/main/common/maths.h"
+	.file 23 "./src/main/common/global_variables.h"
+	.file 24 "./src/main/rx/rx.h"
+	.file 25 "./src/main/config/feature.h"
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 27 "./src/main/drivers/pwm_output.h"
+	.file 28 "/usr/include/string.h"
+	.file 29 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	servos.c.30e6ea18
+	.weak	servos.c.30e6ea18
+servos.c.30e6ea18:
+	.long	0x147a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x23
+	.long	.LASF2236
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1786
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1787
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1788
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1789
+	.uleb128 0x4
+	.long	.LASF1791
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1790
+	.uleb128 0x4
+	.long	.LASF1792
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF1793
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0xc
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1794
+	.uleb128 0x4
+	.long	.LASF1795
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF1796
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF1797
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1798
+	.uleb128 0x4
+	.long	.LASF1799
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x25
+	.byte	0x8
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1800
+	.uleb128 0x4
+	.long	.LASF1801
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x4
+	.long	.LASF1802
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x4
+	.long	.LASF1803
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x4
+	.long	.LASF1804
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x18
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF1805
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF1806
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0x4
+	.long	.LASF1807
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa2
+	.uleb128 0x4
+	.long	.LASF1808
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1809
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1810
+	.uleb128 0xe
+	.long	0x12f
+	.uleb128 0x26
+	.uleb128 0x4
+	.long	.LASF1811
+	.byte	0x5
+	.byte	0x19
+	.byte	0x12
+	.long	0xec
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x16a
+	.uleb128 0x6
+	.long	.LASF1812
+	.value	0xfff
+	.uleb128 0x6
+	.long	.LASF1813
+	.value	0xf000
+	.uleb128 0x6
+	.long	.LASF1814
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF1815
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1816
+	.value	0x8000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1817
+	.byte	0x5
+	.byte	0x2a
+	.byte	0xf
+	.long	0x176
+	.uleb128 0x27
+	.long	0x181
+	.uleb128 0x3
+	.long	0xae
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x8
+	.byte	0x5
+	.byte	0x32
+	.byte	0x5
+	.long	0x1a2
+	.uleb128 0x19
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x33
+	.byte	0xf
+	.long	0xae
+	.uleb128 0x19
+	.string	"fn"
+	.byte	0x5
+	.byte	0x34
+	.byte	0x16
+	.long	0x1a2
+	.byte	0
+	.uleb128 0xe
+	.long	0x16a
+	.uleb128 0x12
+	.long	.LASF1826
+	.byte	0x28
+	.byte	0x5
+	.byte	0x2c
+	.long	0x202
+	.uleb128 0xb
+	.string	"pgn"
+	.byte	0x5
+	.byte	0x2d
+	.byte	0xb
+	.long	0x130
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1818
+	.byte	0x5
+	.byte	0x2e
+	.byte	0xe
+	.long	0xec
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1819
+	.byte	0x5
+	.byte	0x2f
+	.byte	0xe
+	.long	0x202
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1820
+	.byte	0x5
+	.byte	0x30
+	.byte	0xe
+	.long	0x202
+	.byte	0x10
+	.uleb128 0xb
+	.string	"ptr"
+	.byte	0x5
+	.byte	0x31
+	.byte	0xf
+	.long	0x207
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1821
+	.byte	0x5
+	.byte	0x35
+	.byte	0x7
+	.long	0x181
+	.byte	0x20
+	.byte	0
+	.uleb128 0xe
+	.long	0xdb
+	.uleb128 0xe
+	.long	0x202
+	.uleb128 0x4
+	.long	.LASF1822
+	.byte	0x5
+	.byte	0x36
+	.byte	0x3
+	.long	0x1a7
+	.uleb128 0x18
+	.long	0x20c
+	.uleb128 0x4
+	.long	.LASF1823
+	.byte	0x6
+	.byte	0x1c
+	.byte	0x11
+	.long	0xcf
+	.uleb128 0x4
+	.long	.LASF1824
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x12
+	.long	0xf8
+	.uleb128 0x4
+	.long	.LASF1825
+	.byte	0x6
+	.byte	0x21
+	.byte	0x12
+	.long	0x104
+	.uleb128 0x12
+	.long	.LASF1827
+	.byte	0x4
+	.byte	0x7
+	.byte	0x16
+	.long	0x25b
+	.uleb128 0x2
+	.long	.LASF1828
+	.byte	0x7
+	.byte	0x17
+	.byte	0xb
+	.long	0x25b
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1829
+	.uleb128 0x4
+	.long	.LASF1830
+	.byte	0x7
+	.byte	0x18
+	.byte	0x3
+	.long	0x241
+	.uleb128 0x12
+	.long	.LASF1831
+	.byte	0x24
+	.byte	0x7
+	.byte	0x21
+	.long	0x2e7
+	.uleb128 0xb
+	.string	"b0"
+	.byte	0x7
+	.byte	0x22
+	.byte	0xb
+	.long	0x25b
+	.byte	0
+	.uleb128 0xb
+	.string	"b1"
+	.byte	0x7
+	.byte	0x22
+	.byte	0xf
+	.long	0x25b
+	.byte	0x4
+	.uleb128 0xb
+	.string	"b2"
+	.byte	0x7
+	.byte	0x22
+	.byte	0x13
+	.long	0x25b
+	.byte	0x8
+	.uleb128 0xb
+	.string	"a1"
+	.byte	0x7
+	.byte	0x22
+	.byte	0x17
+	.long	0x25b
+	.byte	0xc
+	.uleb128 0xb
+	.string	"a2"
+	.byte	0x7
+	.byte	0x22
+	.byte	0x1b
+	.long	0x25b
+	.byte	0x10
+	.uleb128 0xb
+	.string	"x1"
+	.byte	0x7
+	.byte	0x23
+	.byte	0xb
+	.long	0x25b
+	.byte	0x14
+	.uleb128 0xb
+	.string	"x2"
+	.byte	0x7
+	.byte	0x23
+	.byte	0xf
+	.long	0x25b
+	.byte	0x18
+	.uleb128 0xb
+	.string	"y1"
+	.byte	0x7
+	.byte	0x23
+	.byte	0x13
+	.long	0x25b
+	.byte	0x1c
+	.uleb128 0xb
+	.string	"y2"
+	.byte	0x7
+	.byte	0x23
+	.byte	0x17
+	.long	0x25b
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1832
+	.byte	0x7
+	.byte	0x24
+	.byte	0x3
+	.long	0x26e
+	.uleb128 0xf
+	.long	0x25b
+	.long	0x303
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x8
+	.byte	0x28
+	.long	0x339
+	.uleb128 0x1
+	.long	.LASF1833
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1834
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1835
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1836
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1837
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1839
+	.byte	0x6
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1840
+	.byte	0x8
+	.byte	0x8
+	.byte	0x41
+	.long	0x387
+	.uleb128 0x2
+	.long	.LASF1841
+	.byte	0x8
+	.byte	0x42
+	.byte	0xc
+	.long	0xb7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1842
+	.byte	0x8
+	.byte	0x43
+	.byte	0xd
+	.long	0xdb
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1843
+	.byte	0x8
+	.byte	0x44
+	.byte	0x9
+	.long	0x387
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1844
+	.byte	0x8
+	.byte	0x45
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1845
+	.byte	0x8
+	.byte	0x46
+	.byte	0xe
+	.long	0xec
+	.byte	0x6
+	.byte	0
+	.uleb128 0xc
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1846
+	.uleb128 0x4
+	.long	.LASF1847
+	.byte	0x8
+	.byte	0x47
+	.byte	0x3
+	.long	0x339
+	.uleb128 0x18
+	.long	0x38e
+	.uleb128 0x8
+	.long	.LASF1848
+	.byte	0x8
+	.byte	0x49
+	.byte	0x16
+	.long	0x38e
+	.uleb128 0x8
+	.long	.LASF1849
+	.byte	0x8
+	.byte	0x71
+	.byte	0xc
+	.long	0x88
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x9
+	.byte	0x1a
+	.long	0x495
+	.uleb128 0x1
+	.long	.LASF1850
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1851
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1852
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1853
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1854
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1856
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1862
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1863
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1864
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1865
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1866
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1867
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1868
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1869
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1870
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1871
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1872
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1873
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1874
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1875
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1876
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1877
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1878
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1879
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1880
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1881
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1882
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1883
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1884
+	.byte	0x22
+	.byte	0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x9
+	.byte	0x42
+	.long	0x4f5
+	.uleb128 0x1
+	.long	.LASF1885
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1886
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1887
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1888
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1889
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1891
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1893
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1895
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1896
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1898
+	.byte	0x6
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1899
+	.byte	0x6
+	.byte	0x9
+	.byte	0x67
+	.long	0x543
+	.uleb128 0x2
+	.long	.LASF1900
+	.byte	0x9
+	.byte	0x68
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1901
+	.byte	0x9
+	.byte	0x69
+	.byte	0xd
+	.long	0xdb
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1902
+	.byte	0x9
+	.byte	0x6a
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1903
+	.byte	0x9
+	.byte	0x6b
+	.byte	0xd
+	.long	0xdb
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1904
+	.byte	0x9
+	.byte	0x6d
+	.byte	0xc
+	.long	0xb7
+	.byte	0x5
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1905
+	.byte	0x9
+	.byte	0x6f
+	.byte	0x3
+	.long	0x4f5
+	.uleb128 0x18
+	.long	0x543
+	.uleb128 0xf
+	.long	0x543
+	.long	0x564
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1906
+	.byte	0x9
+	.byte	0x76
+	.byte	0x15
+	.long	0x554
+	.uleb128 0x8
+	.long	.LASF1907
+	.byte	0x9
+	.byte	0x76
+	.byte	0x52
+	.long	0x554
+	.uleb128 0x12
+	.long	.LASF1908
+	.byte	0x8
+	.byte	0x9
+	.byte	0x78
+	.long	0x5bd
+	.uleb128 0xb
+	.string	"min"
+	.byte	0x9
+	.byte	0x79
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0xb
+	.string	"max"
+	.byte	0x9
+	.byte	0x7a
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1909
+	.byte	0x9
+	.byte	0x7b
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1902
+	.byte	0x9
+	.byte	0x7c
+	.byte	0xc
+	.long	0xb7
+	.byte	0x6
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1910
+	.byte	0x9
+	.byte	0x7d
+	.byte	0x3
+	.long	0x57c
+	.uleb128 0x18
+	.long	0x5bd
+	.uleb128 0xf
+	.long	0x5bd
+	.long	0x5de
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1911
+	.byte	0x9
+	.byte	0x7f
+	.byte	0x15
+	.long	0x5ce
+	.uleb128 0x8
+	.long	.LASF1912
+	.byte	0x9
+	.byte	0x7f
+	.byte	0x46
+	.long	0x5ce
+	.uleb128 0x12
+	.long	.LASF1913
+	.byte	0xa
+	.byte	0x9
+	.byte	0x81
+	.long	0x651
+	.uleb128 0x2
+	.long	.LASF1914
+	.byte	0x9
+	.byte	0x83
+	.byte	0xe
+	.long	0xec
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1915
+	.byte	0x9
+	.byte	0x84
+	.byte	0xe
+	.long	0xec
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1916
+	.byte	0x9
+	.byte	0x85
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1917
+	.byte	0x9
+	.byte	0x86
+	.byte	0xe
+	.long	0xec
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1918
+	.byte	0x9
+	.byte	0x87
+	.byte	0xd
+	.long	0xdb
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1919
+	.byte	0x9
+	.byte	0x88
+	.byte	0xd
+	.long	0xdb
+	.byte	0x9
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1920
+	.byte	0x9
+	.byte	0x89
+	.byte	0x3
+	.long	0x5f6
+	.uleb128 0x18
+	.long	0x651
+	.uleb128 0x8
+	.long	.LASF1921
+	.byte	0x9
+	.byte	0x8b
+	.byte	0x16
+	.long	0x651
+	.uleb128 0x8
+	.long	.LASF1922
+	.byte	0x9
+	.byte	0x8b
+	.byte	0x3f
+	.long	0x651
+	.uleb128 0x12
+	.long	.LASF1923
+	.byte	0x8
+	.byte	0x9
+	.byte	0x8d
+	.long	0x6a1
+	.uleb128 0x2
+	.long	.LASF1924
+	.byte	0x9
+	.byte	0x8e
+	.byte	0xb
+	.long	0x25b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1925
+	.byte	0x9
+	.byte	0x8f
+	.byte	0xb
+	.long	0x25b
+	.byte	0x4
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1926
+	.byte	0x9
+	.byte	0x90
+	.byte	0x3
+	.long	0x67a
+	.uleb128 0xf
+	.long	0xc3
+	.long	0x6bd
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1927
+	.byte	0x9
+	.byte	0x92
+	.byte	0x10
+	.long	0x6ad
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xa
+	.byte	0x34
+	.long	0x6e7
+	.uleb128 0x1
+	.long	.LASF1928
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1929
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1930
+	.byte	0x2
+	.byte	0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xb
+	.byte	0x16
+	.long	0x711
+	.uleb128 0x1
+	.long	.LASF1931
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1932
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1933
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1934
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1935
+	.byte	0x4
+	.byte	0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xc
+	.byte	0x26
+	.long	0x80c
+	.uleb128 0x1
+	.long	.LASF1936
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1937
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1938
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1939
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1940
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1941
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1942
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1943
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF1944
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF1945
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF1946
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF1947
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF1948
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF1949
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF1950
+	.value	0x4000
+	.uleb128 0x6
+	.long	.LASF1951
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF1952
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF1953
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF1954
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF1955
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF1956
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF1957
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF1958
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF1959
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF1960
+	.long	0x1000000
+	.uleb128 0x5
+	.long	.LASF1961
+	.long	0x2000000
+	.uleb128 0x5
+	.long	.LASF1962
+	.long	0x4000000
+	.uleb128 0x5
+	.long	.LASF1963
+	.long	0x8000000
+	.uleb128 0x5
+	.long	.LASF1964
+	.long	0x10000000
+	.uleb128 0x5
+	.long	.LASF1965
+	.long	0x20000000
+	.uleb128 0x5
+	.long	.LASF1966
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF2237
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0xd
+	.byte	0x18
+	.byte	0xe
+	.long	0x87f
+	.uleb128 0x1
+	.long	.LASF1967
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1968
+	.byte	0x1
+	.uleb128 0x29
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1969
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1970
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1972
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1973
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1974
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1975
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1976
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1977
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1978
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1979
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1980
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1981
+	.byte	0xf
+	.byte	0
+	.uleb128 0xf
+	.long	0xc3
+	.long	0x88f
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1982
+	.byte	0xd
+	.byte	0x51
+	.byte	0x10
+	.long	0x87f
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xe
+	.byte	0x1c
+	.long	0x9a9
+	.uleb128 0x1
+	.long	.LASF1983
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1985
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1986
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1987
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1989
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1990
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1991
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1992
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1993
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1994
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1995
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1996
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1997
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1998
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1999
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2000
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2001
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2002
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2003
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2004
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2009
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2010
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2011
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2012
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2013
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2014
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2017
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2018
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2019
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2020
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2021
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2022
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2023
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2024
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2025
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2026
+	.byte	0xe
+	.byte	0x48
+	.byte	0x3
+	.long	0x89b
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xf
+	.byte	0x15
+	.long	0xa80
+	.uleb128 0x1
+	.long	.LASF2027
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2028
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2029
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2030
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2031
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2032
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF2033
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF2034
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF2035
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF2036
+	.value	0x4000
+	.uleb128 0x6
+	.long	.LASF2037
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF2038
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF2039
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF2040
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF2041
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF2042
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF2043
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF2044
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF2045
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF2046
+	.long	0x1000000
+	.uleb128 0x5
+	.long	.LASF2047
+	.long	0x2000000
+	.uleb128 0x5
+	.long	.LASF2048
+	.long	0x4000000
+	.uleb128 0x5
+	.long	.LASF2049
+	.long	0x8000000
+	.uleb128 0x5
+	.long	.LASF2050
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2051
+	.byte	0xf
+	.byte	0x47
+	.byte	0x11
+	.long	0xf8
+	.uleb128 0xd
+	.long	0x30
+	.byte	0xf
+	.byte	0x54
+	.long	0xaf9
+	.uleb128 0x1
+	.long	.LASF2052
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2053
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2054
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2055
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2056
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2057
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2058
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2059
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2060
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2061
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2062
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF2063
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF2064
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF2065
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF2066
+	.value	0x4000
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2067
+	.byte	0xf
+	.byte	0x66
+	.byte	0x11
+	.long	0xf8
+	.uleb128 0xc
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2068
+	.uleb128 0x2a
+	.byte	0x6
+	.byte	0x10
+	.byte	0x20
+	.byte	0x5
+	.long	0xb3d
+	.uleb128 0x2
+	.long	.LASF2069
+	.byte	0x10
+	.byte	0x22
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2070
+	.byte	0x10
+	.byte	0x23
+	.byte	0x11
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0xb
+	.string	"yaw"
+	.byte	0x10
+	.byte	0x24
+	.byte	0x11
+	.long	0xc3
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1d
+	.byte	0x6
+	.byte	0x10
+	.byte	0x1e
+	.byte	0x9
+	.long	0xb5f
+	.uleb128 0x19
+	.string	"raw"
+	.byte	0x10
+	.byte	0x1f
+	.byte	0xd
+	.long	0xb5f
+	.uleb128 0x2b
+	.long	.LASF2071
+	.byte	0x10
+	.byte	0x25
+	.byte	0x7
+	.long	0xb0c
+	.byte	0
+	.uleb128 0xf
+	.long	0xc3
+	.long	0xb6f
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2072
+	.byte	0x10
+	.byte	0x26
+	.byte	0x3
+	.long	0xb3d
+	.uleb128 0x8
+	.long	.LASF2073
+	.byte	0x10
+	.byte	0x29
+	.byte	0x1e
+	.long	0xb6f
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x11
+	.byte	0x39
+	.long	0xbdb
+	.uleb128 0x1
+	.long	.LASF2074
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2075
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2076
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2077
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2078
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2080
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2081
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2082
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2083
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2084
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2085
+	.byte	0xb
+	.byte	0
+	.uleb128 0xf
+	.long	0xc3
+	.long	0xbe6
+	.uleb128 0x2c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF2086
+	.byte	0x11
+	.byte	0xa6
+	.byte	0x10
+	.long	0xbdb
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x12
+	.byte	0x16
+	.long	0xce2
+	.uleb128 0x1
+	.long	.LASF2087
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2088
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2089
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2090
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2091
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2092
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2093
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2094
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2095
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2096
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2097
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2098
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2099
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2100
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2101
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2102
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2103
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2105
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2106
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2107
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2108
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2110
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2111
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2112
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2113
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2114
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2115
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2116
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2117
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2118
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2119
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2120
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2121
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2122
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2123
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2124
+	.byte	0x25
+	.byte	0
+	.uleb128 0xd
+	.long	0x30
+	.byte	0x12
+	.byte	0x43
+	.long	0xd6c
+	.uleb128 0x1
+	.long	.LASF2125
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2126
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2127
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2128
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2129
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2130
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2131
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2132
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2133
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2134
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2135
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2136
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2137
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2138
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2139
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2140
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2141
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2142
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2143
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2144
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2145
+	.byte	0x14
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2146
+	.byte	0x28
+	.byte	0x13
+	.byte	0x3b
+	.long	0xde1
+	.uleb128 0x2
+	.long	.LASF2147
+	.byte	0x13
+	.byte	0x3c
+	.byte	0x9
+	.long	0x387
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2148
+	.byte	0x13
+	.byte	0x3d
+	.byte	0xe
+	.long	0xf8
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2149
+	.byte	0x13
+	.byte	0x3e
+	.byte	0xe
+	.long	0xf8
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2150
+	.byte	0x13
+	.byte	0x3f
+	.byte	0xd
+	.long	0xdb
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2151
+	.byte	0x13
+	.byte	0x40
+	.byte	0x9
+	.long	0x387
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF2152
+	.byte	0x13
+	.byte	0x41
+	.byte	0xe
+	.long	0x235
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2153
+	.byte	0x13
+	.byte	0x42
+	.byte	0x11
+	.long	0x21d
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2154
+	.byte	0x13
+	.byte	0x43
+	.byte	0xb
+	.long	0x2f3
+	.byte	0x1c
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2155
+	.byte	0x13
+	.byte	0x44
+	.byte	0x3
+	.long	0xd6c
+	.uleb128 0x8
+	.long	.LASF2156
+	.byte	0x13
+	.byte	0x46
+	.byte	0xf
+	.long	0xde1
+	.uleb128 0x8
+	.long	.LASF2157
+	.byte	0x14
+	.byte	0x39
+	.byte	0x1c
+	.long	0x65d
+	.uleb128 0x15
+	.long	0x662
+	.byte	0x39
+	.byte	0x47
+	.uleb128 0x15
+	.long	0x66e
+	.byte	0x39
+	.byte	0x69
+	.uleb128 0x8
+	.long	.LASF2158
+	.byte	0x14
+	.byte	0x39
+	.byte	0x95
+	.long	0x218
+	.uleb128 0x1a
+	.long	0xe13
+	.byte	0xbe
+	.uleb128 0x2d
+	.long	0xdf9
+	.byte	0x3b
+	.byte	0x15
+	.uleb128 0x15
+	.long	0x564
+	.byte	0x44
+	.byte	0x47
+	.uleb128 0x15
+	.long	0x570
+	.byte	0x44
+	.byte	0x7d
+	.uleb128 0x8
+	.long	.LASF2159
+	.byte	0x14
+	.byte	0x44
+	.byte	0xbe
+	.long	0x218
+	.uleb128 0x1a
+	.long	0xe3a
+	.byte	0xed
+	.uleb128 0x15
+	.long	0x5de
+	.byte	0x55
+	.byte	0x41
+	.uleb128 0x15
+	.long	0x5ea
+	.byte	0x55
+	.byte	0x6b
+	.uleb128 0x8
+	.long	.LASF2160
+	.byte	0x14
+	.byte	0x55
+	.byte	0xa0
+	.long	0x218
+	.uleb128 0x1a
+	.long	0xe5a
+	.byte	0xc9
+	.uleb128 0x15
+	.long	0x6bd
+	.byte	0x63
+	.byte	0x9
+	.uleb128 0x9
+	.long	.LASF2161
+	.byte	0x65
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0x9
+	.long	.LASF2162
+	.byte	0x66
+	.byte	0x15
+	.long	0x554
+	.uleb128 0x9
+	.long	.LASF2163
+	.byte	0x67
+	.byte	0xc
+	.long	0x88
+	.uleb128 0x9
+	.long	.LASF2164
+	.byte	0x69
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0x9
+	.long	.LASF2165
+	.byte	0x6a
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0x9
+	.long	.LASF2166
+	.byte	0x6b
+	.byte	0x10
+	.long	0xdb
+	.uleb128 0xf
+	.long	0x2e7
+	.long	0xec5
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2167
+	.byte	0x6d
+	.byte	0x17
+	.long	0xeb5
+	.uleb128 0x9
+	.long	.LASF2168
+	.byte	0x6e
+	.byte	0xc
+	.long	0x387
+	.uleb128 0xf
+	.long	0x6a1
+	.long	0xeeb
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2169
+	.byte	0x70
+	.byte	0x18
+	.long	0xedb
+	.uleb128 0xf
+	.long	0x262
+	.long	0xf06
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2170
+	.byte	0x71
+	.byte	0x1a
+	.long	0xef6
+	.uleb128 0x2e
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x14
+	.value	0x178
+	.byte	0xe
+	.long	0xf39
+	.uleb128 0x1
+	.long	.LASF2171
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2172
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2173
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0x3
+	.byte	0
+	.uleb128 0x2f
+	.long	.LASF2175
+	.byte	0x14
+	.value	0x17d
+	.byte	0x3
+	.long	0xf11
+	.uleb128 0x1e
+	.long	.LASF2176
+	.byte	0xc
+	.byte	0x77
+	.uleb128 0x1e
+	.long	.LASF2177
+	.byte	0x11
+	.byte	0xab
+	.uleb128 0x30
+	.long	.LASF2238
+	.byte	0x1d
+	.byte	0x1d
+	.byte	0xa
+	.long	0x229
+	.uleb128 0x10
+	.long	.LASF2178
+	.byte	0x7
+	.byte	0x5d
+	.byte	0x7
+	.long	0x25b
+	.long	0xf85
+	.uleb128 0x3
+	.long	0xf85
+	.uleb128 0x3
+	.long	0x25b
+	.uleb128 0x3
+	.long	0x25b
+	.uleb128 0x3
+	.long	0x25b
+	.byte	0
+	.uleb128 0xe
+	.long	0x262
+	.uleb128 0x10
+	.long	.LASF2179
+	.byte	0x15
+	.byte	0x8b
+	.byte	0x5
+	.long	0x88
+	.long	0xfa0
+	.uleb128 0x3
+	.long	0xb7
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2180
+	.byte	0x16
+	.byte	0x90
+	.byte	0x5
+	.long	0x88
+	.long	0xfca
+	.uleb128 0x3
+	.long	0x88
+	.uleb128 0x3
+	.long	0x88
+	.uleb128 0x3
+	.long	0x88
+	.uleb128 0x3
+	.long	0x88
+	.uleb128 0x3
+	.long	0x88
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2181
+	.byte	0xe
+	.byte	0x77
+	.byte	0x5
+	.long	0x387
+	.long	0xfe0
+	.uleb128 0x3
+	.long	0x9a9
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2182
+	.byte	0x17
+	.byte	0x26
+	.byte	0x9
+	.long	0xcf
+	.long	0xff6
+	.uleb128 0x3
+	.long	0xdb
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2183
+	.byte	0x18
+	.byte	0xd2
+	.byte	0x9
+	.long	0xc3
+	.long	0x100c
+	.uleb128 0x3
+	.long	0x30
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2184
+	.byte	0x19
+	.byte	0x1e
+	.byte	0x5
+	.long	0x387
+	.long	0x1022
+	.uleb128 0x3
+	.long	0xf8
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2185
+	.byte	0x16
+	.byte	0x87
+	.byte	0x5
+	.long	0x88
+	.long	0x1042
+	.uleb128 0x3
+	.long	0x88
+	.uleb128 0x3
+	.long	0x88
+	.uleb128 0x3
+	.long	0x88
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF2186
+	.byte	0x1a
+	.value	0x13d
+	.byte	0x11
+	.long	0x9b
+	.long	0x1059
+	.uleb128 0x3
+	.long	0x25b
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2187
+	.byte	0x7
+	.byte	0x62
+	.byte	0x7
+	.long	0x25b
+	.long	0x1074
+	.uleb128 0x3
+	.long	0x1074
+	.uleb128 0x3
+	.long	0x25b
+	.byte	0
+	.uleb128 0xe
+	.long	0x2e7
+	.uleb128 0x10
+	.long	.LASF2188
+	.byte	0x7
+	.byte	0x63
+	.byte	0x7
+	.long	0x25b
+	.long	0x1094
+	.uleb128 0x3
+	.long	0x1074
+	.uleb128 0x3
+	.long	0x25b
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2189
+	.byte	0x7
+	.byte	0x60
+	.long	0x10af
+	.uleb128 0x3
+	.long	0x1074
+	.uleb128 0x3
+	.long	0xec
+	.uleb128 0x3
+	.long	0xf8
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2190
+	.byte	0x1b
+	.byte	0x20
+	.long	0x10c5
+	.uleb128 0x3
+	.long	0xdb
+	.uleb128 0x3
+	.long	0xec
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2191
+	.byte	0x1c
+	.byte	0x3d
+	.byte	0xe
+	.long	0xae
+	.long	0x10e5
+	.uleb128 0x3
+	.long	0xae
+	.uleb128 0x3
+	.long	0x88
+	.uleb128 0x3
+	.long	0x110
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2192
+	.byte	0x1c
+	.byte	0x2b
+	.byte	0xe
+	.long	0xae
+	.long	0x1105
+	.uleb128 0x3
+	.long	0xae
+	.uleb128 0x3
+	.long	0x12a
+	.uleb128 0x3
+	.long	0x110
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2193
+	.value	0x1d2
+	.long	0x387
+	.uleb128 0x21
+	.long	.LASF2195
+	.value	0x1cd
+	.long	0x1129
+	.uleb128 0x32
+	.long	.LASF2212
+	.byte	0x14
+	.value	0x1cd
+	.byte	0x20
+	.long	0x387
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF2194
+	.value	0x1c8
+	.long	0x387
+	.uleb128 0x21
+	.long	.LASF2196
+	.value	0x17f
+	.long	0x1228
+	.uleb128 0x7
+	.long	.LASF2197
+	.value	0x181
+	.byte	0x21
+	.long	0xf39
+	.uleb128 0x7
+	.long	.LASF2198
+	.value	0x182
+	.byte	0x15
+	.long	0x229
+	.uleb128 0x7
+	.long	.LASF2199
+	.value	0x184
+	.byte	0x14
+	.long	0x6ad
+	.uleb128 0x7
+	.long	.LASF2200
+	.value	0x185
+	.byte	0x14
+	.long	0x1228
+	.uleb128 0x7
+	.long	.LASF2201
+	.value	0x186
+	.byte	0x14
+	.long	0xcf
+	.uleb128 0x14
+	.long	0x11a7
+	.uleb128 0x7
+	.long	.LASF2202
+	.value	0x18d
+	.byte	0x1e
+	.long	0x88
+	.uleb128 0xa
+	.uleb128 0x7
+	.long	.LASF2203
+	.value	0x18d
+	.byte	0x75
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF2204
+	.value	0x18d
+	.byte	0x9d
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0x11d3
+	.uleb128 0x7
+	.long	.LASF2202
+	.value	0x19f
+	.byte	0x1e
+	.long	0x88
+	.uleb128 0xa
+	.uleb128 0x7
+	.long	.LASF2205
+	.value	0x19f
+	.byte	0x75
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF2206
+	.value	0x19f
+	.byte	0x9d
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.long	0x11ff
+	.uleb128 0x7
+	.long	.LASF2202
+	.value	0x1a4
+	.byte	0x22
+	.long	0x88
+	.uleb128 0xa
+	.uleb128 0x7
+	.long	.LASF2207
+	.value	0x1a4
+	.byte	0x79
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF2208
+	.value	0x1a4
+	.byte	0xa1
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x7
+	.long	.LASF2202
+	.value	0x1bf
+	.byte	0x16
+	.long	0x88
+	.uleb128 0xa
+	.uleb128 0x7
+	.long	.LASF2209
+	.value	0x1bf
+	.byte	0x6d
+	.long	0x88
+	.uleb128 0x7
+	.long	.LASF2210
+	.value	0x1bf
+	.byte	0x95
+	.long	0x88
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xcf
+	.long	0x1238
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2211
+	.byte	0xee
+	.long	0x12a8
+	.uleb128 0x33
+	.string	"dT"
+	.byte	0x14
+	.byte	0xee
+	.byte	0x17
+	.long	0x25b
+	.uleb128 0x9
+	.long	.LASF2213
+	.byte	0xf0
+	.byte	0xd
+	.long	0x12a8
+	.uleb128 0x14
+	.long	0x1267
+	.uleb128 0x1b
+	.string	"i"
+	.value	0x137
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x129c
+	.uleb128 0x1b
+	.string	"i"
+	.value	0x13c
+	.long	0x88
+	.uleb128 0xa
+	.uleb128 0x7
+	.long	.LASF2214
+	.value	0x147
+	.byte	0x17
+	.long	0xe7
+	.uleb128 0x7
+	.long	.LASF2215
+	.value	0x148
+	.byte	0x17
+	.long	0xe7
+	.uleb128 0x7
+	.long	.LASF2216
+	.value	0x151
+	.byte	0x11
+	.long	0xc3
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1b
+	.string	"i"
+	.value	0x156
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xc3
+	.long	0x12b8
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x21
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2217
+	.byte	0xd7
+	.long	0x12e4
+	.uleb128 0x9
+	.long	.LASF2202
+	.byte	0xdb
+	.byte	0x9
+	.long	0x88
+	.uleb128 0x9
+	.long	.LASF2218
+	.byte	0xdc
+	.byte	0x9
+	.long	0x387
+	.uleb128 0xa
+	.uleb128 0x13
+	.string	"i"
+	.byte	0xe5
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.long	.LASF2239
+	.byte	0x14
+	.byte	0xc0
+	.byte	0xd
+	.long	0x131a
+	.uleb128 0x14
+	.long	0x12ff
+	.uleb128 0x13
+	.string	"i"
+	.byte	0xc5
+	.byte	0x16
+	.long	0x88
+	.byte	0
+	.uleb128 0x14
+	.long	0x130e
+	.uleb128 0x13
+	.string	"i"
+	.byte	0xcc
+	.byte	0x12
+	.long	0x88
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.string	"i"
+	.byte	0xd2
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2219
+	.byte	0xa5
+	.long	0x1330
+	.uleb128 0xa
+	.uleb128 0x13
+	.string	"i"
+	.byte	0xae
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.long	.LASF2220
+	.byte	0x14
+	.byte	0x9b
+	.byte	0x5
+	.long	0x88
+	.uleb128 0x16
+	.long	.LASF2221
+	.byte	0x84
+	.long	0x1361
+	.uleb128 0x14
+	.long	0x1355
+	.uleb128 0x13
+	.string	"i"
+	.byte	0x87
+	.byte	0xe
+	.long	0x88
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.string	"i"
+	.byte	0x96
+	.byte	0x12
+	.long	0xdb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2222
+	.byte	0x7f
+	.long	0x1378
+	.uleb128 0x17
+	.long	.LASF2202
+	.byte	0x14
+	.byte	0x7f
+	.byte	0x29
+	.long	0xdb
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF2223
+	.byte	0x14
+	.byte	0x73
+	.byte	0x9
+	.long	0xc3
+	.long	0x1395
+	.uleb128 0x17
+	.long	.LASF2224
+	.byte	0x14
+	.byte	0x73
+	.byte	0x26
+	.long	0xdb
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2225
+	.byte	0x57
+	.long	0x13c4
+	.uleb128 0x17
+	.long	.LASF2226
+	.byte	0x14
+	.byte	0x57
+	.byte	0x2a
+	.long	0x13c4
+	.uleb128 0xa
+	.uleb128 0x13
+	.string	"i"
+	.byte	0x59
+	.byte	0xe
+	.long	0x88
+	.uleb128 0xa
+	.uleb128 0x9
+	.long	.LASF2227
+	.byte	0x5a
+	.byte	0x23
+	.long	0x5c9
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x5bd
+	.uleb128 0x16
+	.long	.LASF2228
+	.byte	0x46
+	.long	0x13f8
+	.uleb128 0x17
+	.long	.LASF2226
+	.byte	0x14
+	.byte	0x46
+	.byte	0x30
+	.long	0x13f8
+	.uleb128 0xa
+	.uleb128 0x13
+	.string	"i"
+	.byte	0x48
+	.byte	0xe
+	.long	0x88
+	.uleb128 0xa
+	.uleb128 0x9
+	.long	.LASF2229
+	.byte	0x49
+	.byte	0x23
+	.long	0x54f
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.long	0x543
+	.uleb128 0x22
+	.long	.LASF2234
+	.byte	0x9
+	.byte	0x8b
+	.byte	0x74
+	.long	0x1409
+	.uleb128 0xe
+	.long	0x65d
+	.uleb128 0x1c
+	.long	.LASF2231
+	.byte	0x7f
+	.byte	0xe4
+	.long	0x13c4
+	.long	0x142a
+	.uleb128 0x17
+	.long	.LASF2230
+	.byte	0x9
+	.byte	0x7f
+	.byte	0xfb
+	.long	0x88
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2232
+	.byte	0x7f
+	.byte	0x83
+	.long	0x1446
+	.long	0x1446
+	.uleb128 0x17
+	.long	.LASF2230
+	.byte	0x9
+	.byte	0x7f
+	.byte	0x93
+	.long	0x88
+	.byte	0
+	.uleb128 0xe
+	.long	0x5c9
+	.uleb128 0x1c
+	.long	.LASF2233
+	.byte	0x76
+	.byte	0x9b
+	.long	0x1467
+	.long	0x1467
+	.uleb128 0x17
+	.long	.LASF2230
+	.byte	0x9
+	.byte	0x76
+	.byte	0xb1
+	.long	0x88
+	.byte	0
+	.uleb128 0xe
+	.long	0x54f
+	.uleb128 0x22
+	.long	.LASF2235
+	.byte	0x8
+	.byte	0x49
+	.byte	0x74
+	.long	0x1478
+	.uleb128 0xe
+	.long	0x39a
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 20
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 30 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 32 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x20
+	.file 33 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x22
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 35 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 36 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x24
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x26
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 39 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 41 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x29
+	.file 42 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 46 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF740
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF776
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 51 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF818
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF819
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF820
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF697
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF822
+	.file 56 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF823
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF840
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF853
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 63 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF858
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x4
+	.file 66 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x42
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF862
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 67 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF879
+	.file 68 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF880
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF881
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x46
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF893
+	.byte	0x4
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF900
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x4
+	.byte	0x4
+	.file 73 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF905
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x4a
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 76 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x4c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF907
+	.file 77 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF908
+	.byte	0x4
+	.byte	0x4
+	.file 78 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 79 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4f
+	.file 80 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 81 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x51
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 82 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x52
+	.byte	0x4
+	.file 83 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.file 84 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x54
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x6
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.file 85 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 86 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x56
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1176
+	.byte	0x4
+	.file 87 "./src/main/config/config_reset.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x57
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x19
+	.byte	0x4
+	.file 88 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x1b
+	.file 89 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1262
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1284
+	.byte	0x4
+	.file 90 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1285
+	.byte	0x4
+	.file 91 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1289
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xe
+	.file 92 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5c
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.file 93 "./src/main/fc/controlrate_profile.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x5d
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0x10
+	.file 94 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x5e
+	.file 95 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x5f
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 96 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x60
+	.file 97 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x61
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.file 98 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x62
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1600
+	.byte	0x4
+	.file 99 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x63
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.file 100 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x64
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.file 101 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x65
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x1a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x4
+	.file 102 "./src/main/common/quaternion.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x66
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x32
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro80
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x13
+	.file 103 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x67
+	.file 104 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x68
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1745
+	.byte	0x4
+	.file 105 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x69
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1746
+	.file 106 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x6a
+	.byte	0x4
+	.byte	0x4
+	.file 107 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x6b
+	.file 108 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x6c
+	.byte	0x7
+	.long	.Ldebug_macro81
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1759
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro82
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro83
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1783
+	.byte	0x6
+	.uleb128 0x135
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1785
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF735
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF749
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF768
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF775
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF797
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF803
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF827
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF829
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF835
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF852
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF857
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF860
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF874
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF878
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF892
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF896
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF904
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1002
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1015
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1016
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1017
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1060
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1079
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1081
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1087
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1090
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1101
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1124
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1134
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1136
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1139
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1175
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config_reset.h.23.96c4afc0737b13234a3b55c02753565a,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1181
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1250
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1252
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.mixer.h.25.134dd336825ea35bbf13b0db63069102,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1261
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.servos.h.23.dae97ea15020a251313e9c2556f531f5,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1278
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pwm_mapping.h.29.5f2a3671df9c4f1621241af7b58f1e07,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1283
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1288
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1293
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1303
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1314
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.controlrate_profile.h.24.a29fb23b15b994a8ab0c8a938d2fe4c7,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1322
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1594
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1599
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1602
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1604
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1620
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1621
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1622
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1620
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1621
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1622
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1629
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1620
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1621
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1622
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1632
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1620
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1621
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1622
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1632
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1620
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1621
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1622
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1632
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1620
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1621
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1622
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1632
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1620
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1621
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1622
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1632
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1620
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1621
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1622
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1623
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1641
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1642
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1643
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1644
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1651
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1652
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1653
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1654
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1655
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1656
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1693
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pid.h.23.0d213d6411833d3cfce9e5cf9d4011a9,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1716
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro80:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1744
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro81:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1758
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro82:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1776
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gyro.h.53.b0572c40fe419f4a50a6d38b60eada44,comdat
+.Ldebug_macro83:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1782
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF2240
+	.long	.LASF2241
+	.long	.LASF2242
+	.long	.LASF2243
+	.long	.LASF2244
+	.long	.LASF2245
+	.long	.LASF2246
+	.long	.LASF2247
+	.long	.LASF2248
+	.long	.LASF2249
+	.long	.LASF2250
+	.long	.LASF2251
+	.long	.LASF2252
+	.long	.LASF2253
+	.long	.LASF2254
+	.long	.LASF2255
+	.long	.LASF2256
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x6d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2257
+	.byte	0xd
+	.long	.LASF2258
+	.byte	0xd
+	.long	.LASF2259
+	.byte	0xd
+	.long	.LASF2260
+	.byte	0x11
+	.long	.LASF2261
+	.byte	0x3
+	.long	.LASF2262
+	.byte	0x2
+	.long	.LASF2263
+	.byte	0x2
+	.long	.LASF2264
+	.byte	0x6
+	.long	.LASF2265
+	.byte	0x6
+	.long	.LASF2266
+	.byte	0x4
+	.long	.LASF2267
+	.byte	0x4
+	.long	.LASF2268
+	.byte	0x5
+	.long	.LASF2269
+	.byte	0x5
+	.long	.LASF2270
+	.byte	0x5
+	.long	.LASF2271
+	.byte	0x5
+	.long	.LASF2272
+	.byte	0x6
+	.long	.LASF2273
+	.byte	0x6
+	.long	.LASF2274
+	.byte	0x4
+	.long	.LASF2275
+	.byte	0x8
+	.long	.LASF2276
+	.byte	0x6
+	.long	.LASF2277
+	.byte	0x2
+	.long	.LASF2278
+	.byte	0x2
+	.long	.LASF2279
+	.byte	0x2
+	.long	.LASF2280
+	.byte	0x7
+	.long	.LASF2281
+	.byte	0x3
+	.long	.LASF2282
+	.byte	0xd
+	.long	.LASF2283
+	.byte	0x4
+	.long	.LASF2284
+	.byte	0x10
+	.long	.LASF2262
+	.byte	0x4
+	.long	.LASF2285
+	.byte	0x10
+	.long	.LASF2286
+	.byte	0x11
+	.long	.LASF2287
+	.byte	0x11
+	.long	.LASF2287
+	.byte	0x10
+	.long	.LASF2288
+	.byte	0xd
+	.long	.LASF2289
+	.byte	0x10
+	.long	.LASF2290
+	.byte	0x10
+	.long	.LASF2291
+	.byte	0xd
+	.long	.LASF2292
+	.byte	0xd
+	.long	.LASF2293
+	.byte	0xf
+	.long	.LASF2294
+	.byte	0xd
+	.long	.LASF2295
+	.byte	0xe
+	.long	.LASF2296
+	.byte	0xe
+	.long	.LASF2297
+	.byte	0xd
+	.long	.LASF2298
+	.byte	0xd
+	.long	.LASF2299
+	.byte	0xd
+	.long	.LASF2300
+	.byte	0x10
+	.long	.LASF2301
+	.byte	0xd
+	.long	.LASF2302
+	.byte	0xd
+	.long	.LASF2303
+	.byte	0xd
+	.long	.LASF2304
+	.byte	0xd
+	.long	.LASF2257
+	.byte	0xf
+	.long	.LASF2305
+	.byte	0xc
+	.long	.LASF2306
+	.byte	0xc
+	.long	.LASF2307
+	.byte	0xc
+	.long	.LASF2308
+	.byte	0xc
+	.long	.LASF2309
+	.byte	0x10
+	.long	.LASF2309
+	.byte	0xd
+	.long	.LASF2310
+	.byte	0xd
+	.long	.LASF2311
+	.byte	0xd
+	.long	.LASF2312
+	.byte	0xd
+	.long	.LASF2313
+	.byte	0xf
+	.long	.LASF2313
+	.byte	0xd
+	.long	.LASF2314
+	.byte	0xc
+	.long	.LASF2315
+	.byte	0xc
+	.long	.LASF2316
+	.byte	0xc
+	.long	.LASF2317
+	.byte	0xc
+	.long	.LASF2318
+	.byte	0xd
+	.long	.LASF2319
+	.byte	0xd
+	.long	.LASF2320
+	.byte	0xd
+	.long	.LASF2321
+	.byte	0xd
+	.long	.LASF2322
+	.byte	0xd
+	.long	.LASF2323
+	.byte	0xd
+	.long	.LASF2324
+	.byte	0x10
+	.long	.LASF2325
+	.byte	0xd
+	.long	.LASF2326
+	.byte	0xd
+	.long	.LASF2327
+	.byte	0xc
+	.long	.LASF2328
+	.byte	0xc
+	.long	.LASF2329
+	.byte	0x10
+	.long	.LASF2330
+	.byte	0xb
+	.long	.LASF2331
+	.byte	0xa
+	.long	.LASF2332
+	.byte	0x9
+	.long	.LASF2333
+	.byte	0xa
+	.long	.LASF2334
+	.byte	0xa
+	.long	.LASF2335
+	.byte	0x1
+	.long	.LASF2336
+	.byte	0x1
+	.long	.LASF2337
+	.byte	0x2
+	.long	.LASF2338
+	.byte	0x3
+	.long	.LASF2339
+	.byte	0x3
+	.long	.LASF2340
+	.byte	0x4
+	.long	.LASF2341
+	.byte	0x4
+	.long	.LASF2342
+	.byte	0x5
+	.long	.LASF2343
+	.byte	0x2
+	.long	.LASF2344
+	.byte	0x5
+	.long	.LASF2345
+	.byte	0x2
+	.long	.LASF2346
+	.byte	0x10
+	.long	.LASF2347
+	.byte	0xd
+	.long	.LASF2348
+	.byte	0xd
+	.long	.LASF2349
+	.byte	0xd
+	.long	.LASF2350
+	.byte	0xd
+	.long	.LASF2351
+	.byte	0xd
+	.long	.LASF2352
+	.byte	0xd
+	.long	.LASF2353
+	.byte	0x2
+	.long	.LASF2354
+	.byte	0x4
+	.long	.LASF2355
+	.byte	0x4
+	.long	.LASF2356
+	.byte	0x4
+	.long	.LASF2357
+	.byte	0x4
+	.long	.LASF2358
+	.byte	0x4
+	.long	.LASF2359
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF2228:
+	.string	"pgResetFn_customServoMixers"
+.LASF2168:
+	.string	"servoFilterIsSet"
+.LASF1785:
+	.string	"SERVO_AUTOTRIM_TIMER_MS 2000"
+.LASF1047:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1356:
+	.string	"__DECL_SIMD_logf "
+.LASF938:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1561:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF2210:
+	.string	"_right7"
+.LASF1589:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF903:
+	.string	"alloca"
+.LASF1021:
+	.string	"USE_FAKE_BARO "
+.LASF888:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1901:
+	.string	"inputSource"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2083:
+	.string	"PID_VEL_Z"
+.LASF1723:
+	.string	"MIDRC_MIN 1200"
+.LASF1969:
+	.string	"THROTTLE"
+.LASF1277:
+	.string	"SERVO_OUTPUT_MAX 2500"
+.LASF1289:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF728:
+	.string	"_WCHAR_T_DEFINED "
+.LASF988:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF831:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1957:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1142:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1649:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1032:
+	.string	"USE_UART7 "
+.LASF1329:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF2165:
+	.string	"minServoIndex"
+.LASF2218:
+	.string	"zeroServoValue"
+.LASF1261:
+	.string	"DSHOT_3D_DEADBAND_HIGH 1048"
+.LASF1993:
+	.string	"BOXMANUAL"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1927:
+	.string	"servo"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1931:
+	.string	"ADC_BATTERY"
+.LASF1287:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1260:
+	.string	"DSHOT_3D_DEADBAND_LOW 1047"
+.LASF950:
+	.string	"USE_PITOT_MS4525 "
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF825:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF989:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1665:
+	.string	"FP_NORMAL 4"
+.LASF1529:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1201:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF1226:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2114:
+	.string	"OWNER_RX_SPI"
+.LASF813:
+	.string	"__pid_t_defined "
+.LASF824:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1424:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1102:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1225:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1585:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1570:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF746:
+	.string	"WNOWAIT 0x01000000"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2012:
+	.string	"BOXCAMERA1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1792:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1039:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF1900:
+	.string	"targetChannel"
+.LASF2005:
+	.string	"BOXGCSNAV"
+.LASF1141:
+	.string	"FAST_MATH "
+.LASF2033:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF1846:
+	.string	"_Bool"
+.LASF1491:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1324:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF2086:
+	.string	"axisPID"
+.LASF1069:
+	.string	"U_ID_2 2"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2170:
+	.string	"servoSpeedLimitFilter"
+.LASF1025:
+	.string	"USE_BARO "
+.LASF870:
+	.string	"NFDBITS __NFDBITS"
+.LASF1533:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1375:
+	.string	"__DECL_SIMD_pow "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1906:
+	.string	"customServoMixers_SystemArray"
+.LASF1461:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF1513:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF697:
+	.string	"__need_size_t "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1251:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF2082:
+	.string	"PID_HEADING"
+.LASF2018:
+	.string	"BOXNAVCRUISE"
+.LASF2039:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF1194:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1843:
+	.string	"hasFlaps"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1732:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1042:
+	.string	"USE_USB_MSC"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1430:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1773:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF1086:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF2020:
+	.string	"BOXUSER1"
+.LASF2021:
+	.string	"BOXUSER2"
+.LASF1864:
+	.string	"INPUT_FEATURE_FLAPS"
+.LASF1462:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1370:
+	.string	"__DECL_SIMD_expf64 "
+.LASF720:
+	.string	"__WCHAR_T__ "
+.LASF1180:
+	.string	"RESET_CONFIG(_type,_name,...) static const _type __UNIQL(_reset_template_) = { __VA_ARGS__ }; memcpy((_name), &__UNIQL(_reset_template_), sizeof(*(_name)));"
+.LASF740:
+	.string	"_STDLIB_H 1"
+.LASF1716:
+	.string	"ANTI_GRAVITY_THROTTLE_FILTER_CUTOFF 15"
+.LASF1302:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF915:
+	.string	"USE_SERIAL_RX "
+.LASF1632:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1536:
+	.string	"__DECL_SIMD_acoshf "
+.LASF937:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1341:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF972:
+	.string	"USE_CMS "
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1129:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1467:
+	.string	"__DECL_SIMD_sinhl "
+.LASF971:
+	.string	"USE_STATS "
+.LASF1669:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1184:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2111:
+	.string	"OWNER_LED"
+.LASF1051:
+	.string	"USE_PITOT_MS4525"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1564:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF1294:
+	.string	"BOXID_NONE 255"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1946:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1886:
+	.string	"SERVO_GIMBAL_ROLL"
+.LASF998:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1805:
+	.string	"uint16_t"
+.LASF2136:
+	.string	"RESOURCE_SPI_SCK"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF1151:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF2093:
+	.string	"OWNER_SOFTSERIAL"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF1849:
+	.string	"mixerThrottleCommand"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1909:
+	.string	"middle"
+.LASF1199:
+	.string	"PG_RX_CONFIG 24"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1674:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF2048:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF1065:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF1000:
+	.string	"USE_CLI_BATCH "
+.LASF1114:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1668:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1075:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1646:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF811:
+	.string	"__uid_t_defined "
+.LASF910:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1450:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1727:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF1337:
+	.string	"__DECL_SIMD_sinl "
+.LASF1205:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1036:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1187:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1590:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1686:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1701:
+	.string	"HEADING_HOLD_RATE_LIMIT_DEFAULT 90"
+.LASF1853:
+	.string	"INPUT_STABILIZED_THROTTLE"
+.LASF1170:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1576:
+	.string	"__DECL_SIMD_erfcf "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1196:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF2233:
+	.string	"customServoMixers"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF810:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1862:
+	.string	"INPUT_GIMBAL_PITCH"
+.LASF1413:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF719:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1358:
+	.string	"__DECL_SIMD_logf16 "
+.LASF2160:
+	.string	"servoParams_Registry"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1366:
+	.string	"__DECL_SIMD_expf "
+.LASF1202:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1565:
+	.string	"__DECL_SIMD_asinh "
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF793:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1842:
+	.string	"platformType"
+.LASF1414:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF2125:
+	.string	"RESOURCE_NONE"
+.LASF2076:
+	.string	"PID_YAW"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1357:
+	.string	"__DECL_SIMD_logl "
+.LASF1602:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1346:
+	.string	"__DECL_SIMD_sincosf "
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1405:
+	.string	"__DECL_SIMD_asin "
+.LASF1007:
+	.string	"_T_PTRDIFF_ "
+.LASF960:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1594:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1907:
+	.string	"customServoMixers_CopyArray"
+.LASF2030:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1403:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF2105:
+	.string	"OWNER_BEEPER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2080:
+	.string	"PID_SURFACE"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF2223:
+	.string	"getFlaperonDirection"
+.LASF1575:
+	.string	"__DECL_SIMD_erfc "
+.LASF1440:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1189:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF853:
+	.string	"_SYS_SELECT_H 1"
+.LASF1803:
+	.string	"int32_t"
+.LASF2225:
+	.string	"pgResetFn_servoParams"
+.LASF771:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2134:
+	.string	"RESOURCE_I2C_SCL"
+.LASF1719:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF1020:
+	.string	"USE_IMU_FAKE "
+.LASF1666:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1155:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1835:
+	.string	"PLATFORM_HELICOPTER"
+.LASF1549:
+	.string	"__DECL_SIMD_erff32 "
+.LASF908:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF730:
+	.string	"___int_wchar_t_h "
+.LASF2116:
+	.string	"OWNER_SPI_PREINIT"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1292:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF2234:
+	.string	"servoConfig"
+.LASF2126:
+	.string	"RESOURCE_INPUT"
+.LASF1285:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1308:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1041:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF838:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF799:
+	.string	"__lldiv_t_defined 1"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF2192:
+	.string	"memcpy"
+.LASF2180:
+	.string	"scaleRange"
+.LASF1060:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF2135:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF777:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1848:
+	.string	"mixerConfig_System"
+.LASF1956:
+	.string	"FEATURE_UNUSED_10"
+.LASF1963:
+	.string	"FEATURE_UNUSED_11"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1463:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1738:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2071:
+	.string	"values"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1208:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1498:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF1500:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF756:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1080:
+	.string	"FAST_CODE "
+.LASF947:
+	.string	"USE_OPFLOW "
+.LASF1814:
+	.string	"PGR_SIZE_MASK"
+.LASF2063:
+	.string	"NAV_WP_MODE"
+.LASF1827:
+	.string	"rateLimitFilter_s"
+.LASF1830:
+	.string	"rateLimitFilter_t"
+.LASF1762:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1653:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1432:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1054:
+	.string	"USE_1WIRE_DS2482"
+.LASF2154:
+	.string	"gyroADCf"
+.LASF1321:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_DEFAULT 20"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1469:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1437:
+	.string	"__DECL_SIMD_exp10l "
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1608:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF956:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF753:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF1893:
+	.string	"SERVO_DUALCOPTER_LEFT"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1169:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1537:
+	.string	"__DECL_SIMD_acoshl "
+.LASF857:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1393:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF957:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1648:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1720:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF1323:
+	.string	"_MATH_H 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1642:
+	.string	"__MATHDECL_1"
+.LASF1254:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_LOW 80"
+.LASF2104:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF2176:
+	.string	"saveConfigAndNotify"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF396:
+	.string	"false 0"
+.LASF2124:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1116:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1279:
+	.string	"MAX_MOTORS 12"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF781:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1157:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1985:
+	.string	"BOXHORIZON"
+.LASF1489:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF2052:
+	.string	"ANGLE_MODE"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1269:
+	.string	"SERVO_SINGLECOPTER_INDEX_MAX SERVO_SINGLECOPTER_4"
+.LASF1118:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1459:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF1823:
+	.string	"timeDelta_t"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1307:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1425:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF2046:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF982:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1443:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1274:
+	.string	"FLAPERON_THROW_MAX 450"
+.LASF1621:
+	.string	"__MATH_PRECNAME"
+.LASF1651:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF921:
+	.string	"USE_ADC_AVERAGING "
+.LASF1616:
+	.string	"_Mdouble_ double"
+.LASF754:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1844:
+	.string	"appliedMixerPreset"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1212:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF773:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF822:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF1136:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1825:
+	.string	"timeUs_t"
+.LASF1774:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1381:
+	.string	"__DECL_SIMD_powf128 "
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1105:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1937:
+	.string	"FEATURE_VBAT"
+.LASF2031:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF2092:
+	.string	"OWNER_SERVO"
+.LASF1166:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1127:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1759:
+	.string	"SPIDEV_COUNT 4"
+.LASF1482:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF1992:
+	.string	"BOXNAVPOSHOLD"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF806:
+	.string	"__ino_t_defined "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF2178:
+	.string	"rateLimitFilterApply4"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1220:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF1175:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1288:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF2123:
+	.string	"OWNER_IRLOCK"
+.LASF1203:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1130:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1724:
+	.string	"MIDRC_MAX 1700"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1235:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF1384:
+	.string	"__DECL_SIMD_powf128x "
+.LASF828:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1706:
+	.string	"HEADING_HOLD_ERROR_LPF_FREQ 2"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1740:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF803:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF1782:
+	.string	"GYRO_STAGE_PROBE_XYZ(stage,values) do { for (int probeAxis = 0; probeAxis < XYZ_AXIS_COUNT; probeAxis++) { gyroStageProbe(stage, probeAxis, (values)[probeAxis]); } } while (0)"
+.LASF861:
+	.string	"__timeval_defined 1"
+.LASF2069:
+	.string	"roll"
+.LASF1013:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1108:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1059:
+	.string	"USE_VCP"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1717:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1793:
+	.string	"__int16_t"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1703:
+	.string	"FW_ITERM_THROW_LIMIT_MIN 0"
+.LASF1795:
+	.string	"__uint16_t"
+.LASF796:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2091:
+	.string	"OWNER_MOTOR"
+.LASF1451:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1071:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF358:
+	.string	"__k8 1"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1996:
+	.string	"BOXLIGHTS"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF731:
+	.string	"__INT_WCHAR_T_H "
+.LASF1760:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF808:
+	.string	"__gid_t_defined "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1955:
+	.string	"FEATURE_BLACKBOX"
+.LASF1891:
+	.string	"SERVO_BICOPTER_LEFT"
+.LASF1890:
+	.string	"SERVO_RUDDER"
+.LASF1421:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1593:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1714:
+	.string	"MC_ITERM_RELAX_SETPOINT_THRESHOLD 40.0f"
+.LASF1398:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1338:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF854:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF1110:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1162:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF1204:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF1958:
+	.string	"FEATURE_AIRMODE"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1452:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF848:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1659:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1548:
+	.string	"__DECL_SIMD_erff16 "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF767:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1560:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF2200:
+	.string	"servoMiddleAccum"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1237:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2231:
+	.string	"servoParamsMutable"
+.LASF1422:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF1253:
+	.string	"MAX_SUPPORTED_MOTORS 12"
+.LASF2230:
+	.string	"_index"
+.LASF2220:
+	.string	"getServoCount"
+.LASF809:
+	.string	"__mode_t_defined "
+.LASF1736:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1751:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2088:
+	.string	"OWNER_PWMIO"
+.LASF792:
+	.string	"__f32x(x) x ##f32x"
+.LASF1439:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1767:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF959:
+	.string	"USE_OLED_UG2864 "
+.LASF1478:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF976:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF999:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1655:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1447:
+	.string	"__DECL_SIMD_coshl "
+.LASF2053:
+	.string	"HORIZON_MODE"
+.LASF1786:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1710:
+	.string	"FP_PID_RATE_D_MULTIPLIER 1905.0f"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1940:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1431:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1246:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1252:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF965:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1014:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1154:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF1506:
+	.string	"__DECL_SIMD_log2f "
+.LASF929:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF926:
+	.string	"USE_NAV "
+.LASF2147:
+	.string	"initialized"
+.LASF1831:
+	.string	"biquadFilter_s"
+.LASF1832:
+	.string	"biquadFilter_t"
+.LASF1715:
+	.string	"MC_ITERM_RELAX_CUTOFF_DEFAULT 15"
+.LASF1193:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1733:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF1829:
+	.string	"float"
+.LASF2203:
+	.string	"_left0"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF2174:
+	.string	"AUTOTRIM_DONE"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF2207:
+	.string	"_left4"
+.LASF2209:
+	.string	"_left6"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF1983:
+	.string	"BOXARM"
+.LASF1079:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF2061:
+	.string	"FAILSAFE_MODE"
+.LASF1644:
+	.string	"__MATHDECL"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF2019:
+	.string	"BOXBRAKING"
+.LASF1547:
+	.string	"__DECL_SIMD_erfl "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF889:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF844:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF1006:
+	.string	"_PTRDIFF_T "
+.LASF1826:
+	.string	"pgRegistry_s"
+.LASF1822:
+	.string	"pgRegistry_t"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF2214:
+	.string	"target"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF2032:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF1216:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF1942:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1092:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1683:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1908:
+	.string	"servoParam_s"
+.LASF1910:
+	.string	"servoParam_t"
+.LASF1504:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1429:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF2187:
+	.string	"biquadFilterApply"
+.LASF1138:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1473:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1994:
+	.string	"BOXBEEPERON"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF374:
+	.string	"__unix 1"
+.LASF1037:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF1816:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1177:
+	.string	"__UNIQL_CONCAT2(x,y) x ## y"
+.LASF924:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1579:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2115:
+	.string	"OWNER_VTX"
+.LASF512:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF919:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1970:
+	.string	"AUX1"
+.LASF1971:
+	.string	"AUX2"
+.LASF1972:
+	.string	"AUX3"
+.LASF1973:
+	.string	"AUX4"
+.LASF1941:
+	.string	"FEATURE_UNUSED_1"
+.LASF1975:
+	.string	"AUX6"
+.LASF1807:
+	.string	"uint64_t"
+.LASF1945:
+	.string	"FEATURE_UNUSED_4"
+.LASF1949:
+	.string	"FEATURE_UNUSED_5"
+.LASF1950:
+	.string	"FEATURE_UNUSED_6"
+.LASF1954:
+	.string	"FEATURE_UNUSED_7"
+.LASF1961:
+	.string	"FEATURE_UNUSED_8"
+.LASF1962:
+	.string	"FEATURE_UNUSED_9"
+.LASF1066:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1628:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2036:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF1219:
+	.string	"PG_INAV_START 1000"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF2157:
+	.string	"pgResetTemplate_servoConfig"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1408:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF987:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2098:
+	.string	"OWNER_RANGEFINDER"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1297:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF864:
+	.string	"__NFDBITS"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1768:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1098:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1455:
+	.string	"__DECL_SIMD_expm1 "
+.LASF759:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1527:
+	.string	"__DECL_SIMD_atanhl "
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1544:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1730:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1519:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF785:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1347:
+	.string	"__DECL_SIMD_sincosl "
+.LASF1578:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF1960:
+	.string	"FEATURE_VTX"
+.LASF1245:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF821:
+	.string	"__timer_t_defined 1"
+.LASF1495:
+	.string	"__DECL_SIMD_log10 "
+.LASF1064:
+	.string	"USE_ITCM_RAM"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1471:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF2026:
+	.string	"boxId_e"
+.LASF1812:
+	.string	"PGR_PGN_MASK"
+.LASF1132:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1618:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1474:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF859:
+	.string	"____sigset_t_defined "
+.LASF1018:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF823:
+	.string	"_ENDIAN_H 1"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1148:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF2224:
+	.string	"servoPin"
+.LASF2139:
+	.string	"RESOURCE_SPI_CS"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1497:
+	.string	"__DECL_SIMD_log10l "
+.LASF1522:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF423:
+	.string	"__USE_GNU"
+.LASF1057:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1311:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1991:
+	.string	"BOXNAVRTH"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF1052:
+	.string	"USE_PITOT_ADC"
+.LASF1374:
+	.string	"__DECL_SIMD_expf128x "
+.LASF2043:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF2215:
+	.string	"from"
+.LASF963:
+	.string	"USE_DJI_HD_OSD "
+.LASF1161:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1520:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF2205:
+	.string	"_left2"
+.LASF764:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF784:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1325:
+	.string	"__DECL_SIMD_cos "
+.LASF1824:
+	.string	"timeMs_t"
+.LASF1672:
+	.string	"MATH_ERRNO 1"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF1914:
+	.string	"servoCenterPulse"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF905:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF892:
+	.string	"__ONCE_ALIGNMENT "
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1484:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2041:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1101:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1911:
+	.string	"servoParams_SystemArray"
+.LASF1503:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1406:
+	.string	"__DECL_SIMD_asinf "
+.LASF750:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1255:
+	.string	"YAW_JUMP_PREVENTION_LIMIT_HIGH 500"
+.LASF949:
+	.string	"USE_OPFLOW_MSP "
+.LASF1818:
+	.string	"size"
+.LASF2099:
+	.string	"OWNER_SYSTEM"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF875:
+	.string	"__blksize_t_defined "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF2138:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1449:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2108:
+	.string	"OWNER_MPU"
+.LASF845:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1583:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1619:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1613:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1227:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1530:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1933:
+	.string	"ADC_CURRENT"
+.LASF1326:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2024:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF2118:
+	.string	"OWNER_TEMPERATURE"
+.LASF1709:
+	.string	"FP_PID_RATE_I_MULTIPLIER 4.0f"
+.LASF2159:
+	.string	"customServoMixers_Registry"
+.LASF779:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1953:
+	.string	"FEATURE_DASHBOARD"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1685:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2109:
+	.string	"OWNER_INVERTER"
+.LASF1682:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF1808:
+	.string	"size_t"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1728:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF834:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF1270:
+	.string	"SERVO_FLAPPERONS_MIN SERVO_FLAPPERON_1"
+.LASF1817:
+	.string	"pgResetFunc"
+.LASF2211:
+	.string	"servoMixer"
+.LASF1351:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1804:
+	.string	"uint8_t"
+.LASF1364:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1607:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF939:
+	.string	"USE_RX_UIB "
+.LASF1708:
+	.string	"FP_PID_RATE_P_MULTIPLIER 31.0f"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1633:
+	.string	"_Mdouble_ _Float64"
+.LASF1622:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF893:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2042:
+	.string	"ARMING_DISABLED_CLI"
+.LASF1179:
+	.string	"__UNIQL(x) __UNIQL_CONCAT(x,__LINE__)"
+.LASF2050:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF2027:
+	.string	"ARMED"
+.LASF1213:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1761:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF1753:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF1712:
+	.string	"FP_PID_LEVEL_P_MULTIPLIER 6.56f"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1378:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1263:
+	.string	"MAX_SUPPORTED_SERVOS 16"
+.LASF1545:
+	.string	"__DECL_SIMD_erf "
+.LASF1968:
+	.string	"PITCH"
+.LASF1904:
+	.string	"conditionId"
+.LASF1188:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF1058:
+	.string	"USE_ADC"
+.LASF807:
+	.string	"__dev_t_defined "
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF2075:
+	.string	"PID_PITCH"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF732:
+	.string	"_GCC_WCHAR_T "
+.LASF727:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2128:
+	.string	"RESOURCE_IO"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF761:
+	.string	"__WCOREFLAG 0x80"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF766:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1084:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1078:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1392:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF376:
+	.string	"unix 1"
+.LASF1662:
+	.string	"FP_INFINITE 1"
+.LASF1652:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1445:
+	.string	"__DECL_SIMD_cosh "
+.LASF1654:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF1278:
+	.string	"SERVO_OUTPUT_MIN 500"
+.LASF1335:
+	.string	"__DECL_SIMD_sin "
+.LASF944:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF894:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF2151:
+	.string	"sampleBufferActive"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF735:
+	.string	"_BSD_WCHAR_T_"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1348:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF775:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1043:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF935:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF1264:
+	.string	"SERVO_PLANE_INDEX_MIN SERVO_ELEVATOR"
+.LASF1317:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MIN 6"
+.LASF718:
+	.string	"__need_size_t"
+.LASF2158:
+	.string	"servoConfig_Registry"
+.LASF2090:
+	.string	"OWNER_PPMINPUT"
+.LASF1863:
+	.string	"INPUT_GIMBAL_ROLL"
+.LASF1016:
+	.string	"__need_ptrdiff_t"
+.LASF837:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1409:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1597:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF945:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1091:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1623:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1636:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1003:
+	.string	"_STDDEF_H "
+.LASF1857:
+	.string	"INPUT_RC_THROTTLE"
+.LASF1022:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF1744:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1331:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF2029:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF1428:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1600:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF786:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF839:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1572:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1363:
+	.string	"__DECL_SIMD_logf64x "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1711:
+	.string	"FP_PID_RATE_D_FF_MULTIPLIER 7270.0f"
+.LASF1625:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1540:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1713:
+	.string	"FP_PID_YAWHOLD_P_MULTIPLIER 80.0f"
+.LASF1123:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1771:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF1113:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2009:
+	.string	"BOXTURNASSIST"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF934:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1481:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF2084:
+	.string	"PID_POS_HEADING"
+.LASF2186:
+	.string	"lrintf"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1361:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1938:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF1569:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2081:
+	.string	"PID_LEVEL"
+.LASF826:
+	.string	"__BIG_ENDIAN 4321"
+.LASF933:
+	.string	"USE_PITOT_ADC "
+.LASF2226:
+	.string	"instance"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1518:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1178:
+	.string	"__UNIQL_CONCAT(x,y) __UNIQL_CONCAT2(x,y)"
+.LASF2190:
+	.string	"pwmWriteServo"
+.LASF1211:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF1365:
+	.string	"__DECL_SIMD_exp "
+.LASF2236:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF774:
+	.string	"__f128(x) x ##f128"
+.LASF1538:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF877:
+	.string	"__fsblkcnt_t_defined "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1319:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MAX 180"
+.LASF1242:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF832:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1799:
+	.string	"__uint64_t"
+.LASF1888:
+	.string	"SERVO_FLAPPERON_1"
+.LASF1889:
+	.string	"SERVO_FLAPPERON_2"
+.LASF1168:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF741:
+	.string	"WNOHANG 1"
+.LASF2148:
+	.string	"targetLooptime"
+.LASF1420:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2117:
+	.string	"OWNER_COMPASS"
+.LASF1855:
+	.string	"INPUT_RC_PITCH"
+.LASF887:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1721:
+	.string	"PWM_PULSE_MIN 750"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF798:
+	.string	"__ldiv_t_defined 1"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1089:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1919:
+	.string	"tri_unarmed_servo"
+.LASF1661:
+	.string	"FP_NAN 0"
+.LASF1479:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1551:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1819:
+	.string	"address"
+.LASF1174:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1634:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1383:
+	.string	"__DECL_SIMD_powf64x "
+.LASF1160:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1061:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF967:
+	.string	"USE_ANTIGRAVITY "
+.LASF1327:
+	.string	"__DECL_SIMD_cosl "
+.LASF2131:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1836:
+	.string	"PLATFORM_TRICOPTER"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1987:
+	.string	"BOXHEADINGHOLD"
+.LASF1624:
+	.string	"_Mdouble_ float"
+.LASF1085:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1281:
+	.string	"PWM_TIMER_HZ 1000000"
+.LASF1879:
+	.string	"INPUT_MAX"
+.LASF1122:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF743:
+	.string	"WSTOPPED 2"
+.LASF1851:
+	.string	"INPUT_STABILIZED_PITCH"
+.LASF1067:
+	.string	"U_ID_0 0"
+.LASF1487:
+	.string	"__DECL_SIMD_atan2l "
+.LASF961:
+	.string	"USE_TELEMETRY_SIM "
+.LASF2010:
+	.string	"BOXAUTOTRIM"
+.LASF847:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF901:
+	.string	"__have_pthread_attr_t 1"
+.LASF2070:
+	.string	"pitch"
+.LASF744:
+	.string	"WEXITED 4"
+.LASF1917:
+	.string	"flaperon_throw_offset"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1874:
+	.string	"INPUT_STABILIZED_ROLL_MINUS"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF2162:
+	.string	"currentServoMixer"
+.LASF466:
+	.string	"__PMT"
+.LASF1523:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF733:
+	.string	"_WCHAR_T_DECLARED "
+.LASF948:
+	.string	"USE_OPFLOW_CXOF "
+.LASF2144:
+	.string	"RESOURCE_RX_CE"
+.LASF2101:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF2044:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF891:
+	.string	"__LOCK_ALIGNMENT "
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1631:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1234:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1781:
+	.string	"GYRO_STAGE_PROBE(stage,axis,value) gyroStageProbe(stage, axis, value)"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1678:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2201:
+	.string	"servoMiddleAccumCount"
+.LASF1582:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF2188:
+	.string	"biquadFilterReset"
+.LASF868:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2051:
+	.string	"armingFlags"
+.LASF1639:
+	.string	"_Mdouble_ _Float64x"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1555:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1314:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1115:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1912:
+	.string	"servoParams_CopyArray"
+.LASF1731:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF1815:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF878:
+	.string	"__fsfilcnt_t_defined "
+.LASF1664:
+	.string	"FP_SUBNORMAL 3"
+.LASF2034:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF772:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1531:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1984:
+	.string	"BOXANGLE"
+.LASF2008:
+	.string	"BOXFLAPERON"
+.LASF996:
+	.string	"USE_VTX_TRAMP "
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2037:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2130:
+	.string	"RESOURCE_UART_TX"
+.LASF1700:
+	.string	"HEADING_HOLD_RATE_LIMIT_MAX 250"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF721:
+	.string	"_WCHAR_T "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF931:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1095:
+	.string	"UNIT_TESTED "
+.LASF2184:
+	.string	"feature"
+.LASF1053:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1784:
+	.string	"GET_RX_CHANNEL_INPUT"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1404:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF1407:
+	.string	"__DECL_SIMD_asinl "
+.LASF725:
+	.string	"_WCHAR_T_ "
+.LASF1752:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF1679:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF1124:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1073:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1262:
+	.string	"MAX_LOGIC_CONDITIONS 16"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1215:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF1612:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF788:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1183:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF2038:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1892:
+	.string	"SERVO_BICOPTER_RIGHT"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1103:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1286:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF2191:
+	.string	"memset"
+.LASF1635:
+	.string	"_Mdouble_ _Float128"
+.LASF1291:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF1599:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1574:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1070:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF890:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF1521:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1586:
+	.string	"__DECL_SIMD_tanf "
+.LASF1801:
+	.string	"int8_t"
+.LASF1460:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1837:
+	.string	"PLATFORM_ROVER"
+.LASF863:
+	.string	"__suseconds_t_defined "
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF880:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF872:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1517:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1399:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1887:
+	.string	"SERVO_ELEVATOR"
+.LASF819:
+	.string	"__clockid_t_defined 1"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2107:
+	.string	"OWNER_BARO"
+.LASF1349:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF855:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF739:
+	.string	"__need_NULL"
+.LASF1017:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1982:
+	.string	"rcCommand"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1656:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1637:
+	.string	"_Mdouble_ _Float32x"
+.LASF1137:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1932:
+	.string	"ADC_RSSI"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1466:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1222:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1411:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1379:
+	.string	"__DECL_SIMD_powf32 "
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1769:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF1510:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF1395:
+	.string	"__DECL_SIMD_atan "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1643:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1929:
+	.string	"SERVO_TYPE_SERVO_DRIVER"
+.LASF2028:
+	.string	"WAS_EVER_ARMED"
+.LASF1821:
+	.string	"reset"
+.LASF942:
+	.string	"USE_RANGEFINDER "
+.LASF1164:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1418:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1877:
+	.string	"INPUT_STABILIZED_YAW_PLUS"
+.LASF1775:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF2058:
+	.string	"HEADFREE_MODE"
+.LASF1412:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2102:
+	.string	"OWNER_SDCARD"
+.LASF2156:
+	.string	"gyro"
+.LASF1689:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1131:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF1852:
+	.string	"INPUT_STABILIZED_YAW"
+.LASF906:
+	.string	"_STRING_H 1"
+.LASF1894:
+	.string	"SERVO_DUALCOPTER_RIGHT"
+.LASF1587:
+	.string	"__DECL_SIMD_tanl "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF970:
+	.string	"USE_LOG "
+.LASF1673:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1090:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF737:
+	.string	"NULL"
+.LASF1802:
+	.string	"int16_t"
+.LASF1541:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1663:
+	.string	"FP_ZERO 2"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1082:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1787:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1790:
+	.string	"signed char"
+.LASF789:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1841:
+	.string	"motorDirectionInverted"
+.LASF1343:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF977:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1979:
+	.string	"AUX10"
+.LASF1980:
+	.string	"AUX11"
+.LASF1981:
+	.string	"AUX12"
+.LASF700:
+	.string	"__size_t__ "
+.LASF1779:
+	.string	"DYN_NOTCH_RANGE_HZ_LOW 1000"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1334:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF751:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1068:
+	.string	"U_ID_1 1"
+.LASF1464:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1144:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF2059:
+	.string	"NAV_LAUNCH_MODE"
+.LASF729:
+	.string	"_WCHAR_T_H "
+.LASF1959:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2204:
+	.string	"_right1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF2206:
+	.string	"_right3"
+.LASF820:
+	.string	"__time_t_defined 1"
+.LASF2208:
+	.string	"_right5"
+.LASF2169:
+	.string	"servoMetadata"
+.LASF1951:
+	.string	"FEATURE_RSSI_ADC"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF2173:
+	.string	"AUTOTRIM_SAVE_PENDING"
+.LASF1140:
+	.string	"sq(x) ((x)*(x))"
+.LASF1339:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1511:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF1605:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF836:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF943:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1647:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1097:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF2055:
+	.string	"NAV_ALTHOLD_MODE"
+.LASF2025:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF900:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF791:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF2222:
+	.string	"servoComputeScalingFactors"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1044:
+	.string	"USE_DASHBOARD"
+.LASF997:
+	.string	"USE_VTX_FFPV "
+.LASF1747:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF1690:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF1726:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF879:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1990:
+	.string	"BOXCAMSTAB"
+.LASF749:
+	.string	"__WCLONE 0x80000000"
+.LASF1667:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1507:
+	.string	"__DECL_SIMD_log2l "
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF874:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF1200:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1695:
+	.string	"PID_SUM_LIMIT_MIN 100"
+.LASF765:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF780:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2171:
+	.string	"AUTOTRIM_IDLE"
+.LASF1417:
+	.string	"__DECL_SIMD_hypotl "
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF2003:
+	.string	"BOXAIRMODE"
+.LASF1532:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1072:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1629:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1828:
+	.string	"state"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF2047:
+	.string	"ARMING_DISABLED_OOM"
+.LASF995:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1050:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1924:
+	.string	"scaleMax"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1275:
+	.string	"MAX_SERVO_RULES (2 * MAX_SUPPORTED_SERVOS)"
+.LASF2095:
+	.string	"OWNER_SERIAL"
+.LASF1568:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1005:
+	.string	"_ANSI_STDDEF_H "
+.LASF2194:
+	.string	"isServoOutputEnabled"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF2106:
+	.string	"OWNER_OSD"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF2122:
+	.string	"OWNER_PINIO"
+.LASF1400:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF2202:
+	.string	"servoIndex"
+.LASF2213:
+	.string	"input"
+.LASF1813:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1192:
+	.string	"PG_PID_PROFILE 14"
+.LASF1483:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF2152:
+	.string	"lastSampleTimeUs"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2182:
+	.string	"gvGet"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1944:
+	.string	"FEATURE_UNUSED_3"
+.LASF1019:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1988:
+	.string	"BOXHEADFREE"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1681:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1214:
+	.string	"PG_VTX_CONFIG 54"
+.LASF1128:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1312:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1598:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1221:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF918:
+	.string	"USE_SERIALRX_IBUS "
+.LASF2229:
+	.string	"_reset_template_73"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1352:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1626:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1284:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1244:
+	.string	"PG_INAV_END 1023"
+.LASF1873:
+	.string	"INPUT_STABILIZED_ROLL_PLUS"
+.LASF790:
+	.string	"__f32(x) x ##f32"
+.LASF2057:
+	.string	"NAV_POSHOLD_MODE"
+.LASF1106:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2001:
+	.string	"BOXFAILSAFE"
+.LASF1947:
+	.string	"FEATURE_CURRENT_METER"
+.LASF842:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1088:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1514:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1756:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF1345:
+	.string	"__DECL_SIMD_sincos "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1368:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1458:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF1303:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF1055:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1866:
+	.string	"INPUT_RC_CH10"
+.LASF1867:
+	.string	"INPUT_RC_CH11"
+.LASF1868:
+	.string	"INPUT_RC_CH12"
+.LASF1869:
+	.string	"INPUT_RC_CH13"
+.LASF1870:
+	.string	"INPUT_RC_CH14"
+.LASF1871:
+	.string	"INPUT_RC_CH15"
+.LASF1872:
+	.string	"INPUT_RC_CH16"
+.LASF1965:
+	.string	"FEATURE_OSD"
+.LASF1820:
+	.string	"copy"
+.LASF2129:
+	.string	"RESOURCE_TIMER"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF2035:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF2023:
+	.string	"BOXLOITERDIRCHN"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1309:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1742:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF898:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF953:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1438:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1133:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1798:
+	.string	"long int"
+.LASF2013:
+	.string	"BOXCAMERA2"
+.LASF2014:
+	.string	"BOXCAMERA3"
+.LASF1359:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1197:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1776:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1508:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1765:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1754:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF978:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF2096:
+	.string	"OWNER_PINDEBUG"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1062:
+	.string	"USE_RCDEVICE"
+.LASF1457:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1839:
+	.string	"PLATFORM_OTHER"
+.LASF2227:
+	.string	"_reset_template_90"
+.LASF1146:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF1606:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF1998:
+	.string	"BOXOSD"
+.LASF1310:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1010:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2077:
+	.string	"PID_POS_Z"
+.LASF1009:
+	.string	"__PTRDIFF_T "
+.LASF856:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF862:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF802:
+	.string	"EXIT_SUCCESS 0"
+.LASF1472:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1350:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF1611:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF1749:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF2054:
+	.string	"HEADING_MODE"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF2145:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1475:
+	.string	"__DECL_SIMD_cbrt "
+.LASF2060:
+	.string	"MANUAL_MODE"
+.LASF2079:
+	.string	"PID_VEL_XY"
+.LASF896:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF1390:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1617:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1806:
+	.string	"uint32_t"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF804:
+	.string	"_SYS_TYPES_H 1"
+.LASF1322:
+	.string	"CONTROL_RATE_CONFIG_TPA_MAX 100"
+.LASF2062:
+	.string	"AUTO_TUNE"
+.LASF818:
+	.string	"__clock_t_defined 1"
+.LASF2183:
+	.string	"rxGetChannelValue"
+.LASF794:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1684:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1505:
+	.string	"__DECL_SIMD_log2 "
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1049:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1173:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF1081:
+	.string	"NOINLINE "
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF2127:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1493:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1524:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2238:
+	.string	"millis"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1986:
+	.string	"BOXNAVALTHOLD"
+.LASF795:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF866:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1296:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1195:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2199:
+	.string	"servoMiddleBackup"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF734:
+	.string	"__DEFINED_wchar_t "
+.LASF1026:
+	.string	"USE_UART1 "
+.LASF1766:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF797:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF2000:
+	.string	"BOXBLACKBOX"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF1789:
+	.string	"long unsigned int"
+.LASF1778:
+	.string	"DYN_NOTCH_RANGE_HZ_MEDIUM 1333"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1002:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1680:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1989:
+	.string	"BOXHEADADJ"
+.LASF2172:
+	.string	"AUTOTRIM_COLLECTING"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF860:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1121:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF722:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF973:
+	.string	"CMS_MENU_OSD "
+.LASF1391:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF1282:
+	.string	"PULSE_1MS (1000)"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1126:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1344:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF2065:
+	.string	"FLAPERON"
+.LASF800:
+	.string	"RAND_MAX 2147483647"
+.LASF2007:
+	.string	"BOXSURFACE"
+.LASF2097:
+	.string	"OWNER_TIMER"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1182:
+	.string	"PG_CF_START 1"
+.LASF1355:
+	.string	"__DECL_SIMD_log "
+.LASF928:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1743:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF865:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1620:
+	.string	"_Mdouble_"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF994:
+	.string	"USE_VTX_CONTROL "
+.LASF1362:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1800:
+	.string	"char"
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1433:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1899:
+	.string	"servoMixer_s"
+.LASF1905:
+	.string	"servoMixer_t"
+.LASF1567:
+	.string	"__DECL_SIMD_asinhl "
+.LASF745:
+	.string	"WCONTINUED 8"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1563:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1997:
+	.string	"BOXNAVLAUNCH"
+.LASF783:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1939:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF2198:
+	.string	"trimStartedAt"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1153:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1838:
+	.string	"PLATFORM_BOAT"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1415:
+	.string	"__DECL_SIMD_hypot "
+.LASF1966:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF1306:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF742:
+	.string	"WUNTRACED 2"
+.LASF1783:
+	.string	"GET_RX_CHANNEL_INPUT(x) (rxGetChannelValue(x) - PWM_RANGE_MIDDLE)"
+.LASF850:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF980:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1330:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1502:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF1394:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1100:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1247:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1764:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF1369:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1163:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF984:
+	.string	"USE_RX_MSP "
+.LASF1171:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF395:
+	.string	"true 1"
+.LASF1239:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF1332:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1230:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF1301:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF946:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF1386:
+	.string	"__DECL_SIMD_acosf "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF964:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1925:
+	.string	"scaleMin"
+.LASF1372:
+	.string	"__DECL_SIMD_expf32x "
+.LASF952:
+	.string	"USE_1WIRE_DS2482 "
+.LASF968:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF932:
+	.string	"USE_PITOT "
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1159:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF1135:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF1729:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF1921:
+	.string	"servoConfig_System"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF778:
+	.string	"__HAVE_FLOAT32 1"
+.LASF1967:
+	.string	"ROLL"
+.LASF1528:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF717:
+	.string	"__size_t "
+.LASF699:
+	.string	"__need_NULL "
+.LASF2121:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1139:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1858:
+	.string	"INPUT_RC_CH5"
+.LASF1859:
+	.string	"INPUT_RC_CH6"
+.LASF1860:
+	.string	"INPUT_RC_CH7"
+.LASF1861:
+	.string	"INPUT_RC_CH8"
+.LASF1865:
+	.string	"INPUT_RC_CH9"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1206:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF2074:
+	.string	"PID_ROLL"
+.LASF1581:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1410:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2196:
+	.string	"processServoAutotrim"
+.LASF738:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1534:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF1915:
+	.string	"servoPwmRate"
+.LASF2235:
+	.string	"mixerConfig"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1566:
+	.string	"__DECL_SIMD_asinhf "
+.LASF1293:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1542:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF851:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF899:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1509:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1210:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF917:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1704:
+	.string	"FW_ITERM_THROW_LIMIT_MAX 500"
+.LASF1093:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF858:
+	.string	"__sigset_t_defined 1"
+.LASF1125:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1436:
+	.string	"__DECL_SIMD_exp10f "
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1313:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1850:
+	.string	"INPUT_STABILIZED_ROLL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1671:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2133:
+	.string	"RESOURCE_EXTI"
+.LASF736:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1878:
+	.string	"INPUT_STABILIZED_YAW_MINUS"
+.LASF1008:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF812:
+	.string	"__off_t_defined "
+.LASF1592:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1535:
+	.string	"__DECL_SIMD_acosh "
+.LASF1856:
+	.string	"INPUT_RC_YAW"
+.LASF1591:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF974:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF1763:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF925:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1884:
+	.string	"INPUT_SOURCE_COUNT"
+.LASF1645:
+	.string	"__MATHCALL"
+.LASF2212:
+	.string	"flag"
+.LASF371:
+	.string	"__linux 1"
+.LASF1658:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1512:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1691:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF979:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF814:
+	.string	"__id_t_defined "
+.LASF1238:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF1492:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF936:
+	.string	"USE_GYRO_KALMAN "
+.LASF1448:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1677:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1273:
+	.string	"FLAPERON_THROW_MIN 50"
+.LASF897:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF758:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1601:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1150:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1298:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF1609:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF2078:
+	.string	"PID_POS_XY"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF816:
+	.string	"__daddr_t_defined "
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1580:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1657:
+	.string	"__MATHCALL_NARROW"
+.LASF748:
+	.string	"__WALL 0x40000000"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF829:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1104:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF843:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF1250:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF1750:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF1385:
+	.string	"__DECL_SIMD_acos "
+.LASF1999:
+	.string	"BOXTELEMETRY"
+.LASF2179:
+	.string	"logicConditionGetValue"
+.LASF1271:
+	.string	"SERVO_FLAPPERONS_MAX SERVO_FLAPPERON_2"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1456:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1480:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1111:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1257:
+	.string	"DSHOT_DISARM_COMMAND 0"
+.LASF1259:
+	.string	"DSHOT_MAX_THROTTLE 2047"
+.LASF1895:
+	.string	"SERVO_SINGLECOPTER_1"
+.LASF1896:
+	.string	"SERVO_SINGLECOPTER_2"
+.LASF1897:
+	.string	"SERVO_SINGLECOPTER_3"
+.LASF1898:
+	.string	"SERVO_SINGLECOPTER_4"
+.LASF760:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1675:
+	.string	"M_E 2.7182818284590452354"
+.LASF1638:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF930:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1596:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1550:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2149:
+	.string	"sampleLooptime"
+.LASF1688:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF2068:
+	.string	"double"
+.LASF1780:
+	.string	"GYRO_PID_PROCESS_DENOM_MAX 8"
+.LASF1048:
+	.string	"USE_RANGEFINDER"
+.LASF1918:
+	.string	"servo_protocol"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1388:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF846:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF1485:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1595:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1258:
+	.string	"DSHOT_MIN_THROTTLE 48"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1916:
+	.string	"servo_lowpass_freq"
+.LASF827:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1615:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1266:
+	.string	"SERVO_DUALCOPTER_INDEX_MIN SERVO_DUALCOPTER_LEFT"
+.LASF1739:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF830:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1558:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF1698:
+	.string	"PID_SUM_LIMIT_YAW_DEFAULT 350"
+.LASF1185:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1318:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_DEFAULT 20"
+.LASF1562:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1426:
+	.string	"__DECL_SIMD_exp2f "
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF726:
+	.string	"_BSD_WCHAR_T_ "
+.LASF2237:
+	.string	"rc_alias"
+.LASF2161:
+	.string	"servoRuleCount"
+.LASF1316:
+	.string	"CONTROL_RATE_CONFIG_ROLL_PITCH_RATE_MAX 180"
+.LASF912:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1943:
+	.string	"FEATURE_GPS"
+.LASF1117:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2112:
+	.string	"OWNER_RX"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1903:
+	.string	"speed"
+.LASF1077:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1696:
+	.string	"PID_SUM_LIMIT_MAX 1000"
+.LASF1299:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF2064:
+	.string	"NAV_CRUISE_MODE"
+.LASF2006:
+	.string	"BOXKILLSWITCH"
+.LASF1796:
+	.string	"__int32_t"
+.LASF1603:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1670:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1797:
+	.string	"__uint32_t"
+.LASF1396:
+	.string	"__DECL_SIMD_atanf "
+.LASF1757:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1573:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF755:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF916:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1952:
+	.string	"FEATURE_LED_STRIP"
+.LASF1746:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1470:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF1198:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1539:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF2049:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF1280:
+	.string	"MAX_SERVOS 16"
+.LASF2181:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF2239:
+	.string	"filterServos"
+.LASF1056:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF975:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF2103:
+	.string	"OWNER_FLASH"
+.LASF1387:
+	.string	"__DECL_SIMD_acosl "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF1923:
+	.string	"servoMetadata_s"
+.LASF1926:
+	.string	"servoMetadata_t"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF776:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1023:
+	.string	"USE_FAKE_GPS "
+.LASF941:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF990:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF914:
+	.string	"USE_RX_PPM "
+.LASF958:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF876:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1376:
+	.string	"__DECL_SIMD_powf "
+.LASF747:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF1614:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF723:
+	.string	"_T_WCHAR "
+.LASF1382:
+	.string	"__DECL_SIMD_powf32x "
+.LASF716:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF1845:
+	.string	"fwMinThrottleDownPitchAngle"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF757:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF954:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF2150:
+	.string	"pidProcessDenom"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1004:
+	.string	"_STDDEF_H_ "
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2232:
+	.string	"servoParams"
+.LASF1490:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1833:
+	.string	"PLATFORM_MULTIROTOR"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1336:
+	.string	"__DECL_SIMD_sinf "
+.LASF1499:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1240:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF992:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF1948:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF2113:
+	.string	"OWNER_TX"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF902:
+	.string	"_ALLOCA_H 1"
+.LASF1024:
+	.string	"USE_MAG "
+.LASF2120:
+	.string	"OWNER_AIRSPEED"
+.LASF1231:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF2011:
+	.string	"BOXAUTOTUNE"
+.LASF1692:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF1283:
+	.string	"MAX_INPUTS 8"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1552:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1525:
+	.string	"__DECL_SIMD_atanh "
+.LASF835:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF1995:
+	.string	"BOXLEDLOW"
+.LASF1974:
+	.string	"AUX5"
+.LASF1604:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF1976:
+	.string	"AUX7"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1977:
+	.string	"AUX8"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1978:
+	.string	"AUX9"
+.LASF1243:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF2067:
+	.string	"flightModeFlags"
+.LASF1134:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1011:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF724:
+	.string	"__WCHAR_T "
+.LASF1693:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1224:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1722:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF752:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1737:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF805:
+	.string	"__u_char_defined "
+.LASF2022:
+	.string	"BOXFPVANGLEMIX"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1454:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1770:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF1416:
+	.string	"__DECL_SIMD_hypotf "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF867:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF698:
+	.string	"__need_wchar_t "
+.LASF1401:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1553:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1810:
+	.string	"long long unsigned int"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF2216:
+	.string	"inputLimited"
+.LASF1494:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1380:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF2177:
+	.string	"pidResetErrorAccumulators"
+.LASF1811:
+	.string	"pgn_t"
+.LASF1320:
+	.string	"CONTROL_RATE_CONFIG_YAW_RATE_MIN 2"
+.LASF770:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1934:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2189:
+	.string	"biquadFilterInitLPF"
+.LASF1718:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF1477:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1402:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF911:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2163:
+	.string	"servoOutputEnabled"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF1228:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1233:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1342:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1935:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1256:
+	.string	"FW_MIN_THROTTLE_DOWN_PITCH_ANGLE_MAX 450"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1840:
+	.string	"mixerConfig_s"
+.LASF1847:
+	.string	"mixerConfig_t"
+.LASF769:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1707:
+	.string	"FP_PID_RATE_FF_MULTIPLIER 31.0f"
+.LASF1181:
+	.string	"RESET_CONFIG_2(_type,_name,...) *(_name) = (_type) { __VA_ARGS__ };"
+.LASF2004:
+	.string	"BOXHOMERESET"
+.LASF966:
+	.string	"USE_D_BOOST "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1543:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1272:
+	.string	"FLAPERON_THROW_DEFAULT 200"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1304:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF1249:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1630:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF1834:
+	.string	"PLATFORM_AIRPLANE"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1186:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1045:
+	.string	"USE_OLED_UG2864"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1516:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1702:
+	.string	"FW_ITERM_THROW_LIMIT_DEFAULT 165"
+.LASF1001:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1083:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1038:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF2140:
+	.string	"RESOURCE_ADC_CH1"
+.LASF2141:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2142:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2143:
+	.string	"RESOURCE_ADC_CH4"
+.LASF1453:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF985:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1880:
+	.string	"INPUT_GVAR_0"
+.LASF1881:
+	.string	"INPUT_GVAR_1"
+.LASF1882:
+	.string	"INPUT_GVAR_2"
+.LASF1883:
+	.string	"INPUT_GVAR_3"
+.LASF2087:
+	.string	"OWNER_FREE"
+.LASF1875:
+	.string	"INPUT_STABILIZED_PITCH_PLUS"
+.LASF1435:
+	.string	"__DECL_SIMD_exp10 "
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF768:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF909:
+	.string	"_STRINGS_H 1"
+.LASF1423:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF815:
+	.string	"__ssize_t_defined "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1165:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1340:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF991:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF951:
+	.string	"USE_1WIRE "
+.LASF1556:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1300:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF1758:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1588:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF873:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF2089:
+	.string	"OWNER_PWMINPUT"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF787:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1697:
+	.string	"PID_SUM_LIMIT_DEFAULT 500"
+.LASF2119:
+	.string	"OWNER_1WIRE"
+.LASF1333:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1295:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF1526:
+	.string	"__DECL_SIMD_atanhf "
+.LASF1094:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1913:
+	.string	"servoConfig_s"
+.LASF1920:
+	.string	"servoConfig_t"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1397:
+	.string	"__DECL_SIMD_atanl "
+.LASF1033:
+	.string	"USE_UART8 "
+.LASF881:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1610:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF904:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1172:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1748:
+	.string	"DMA_NONE (0)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1012:
+	.string	"___int_ptrdiff_t_h "
+.LASF1640:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1441:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1265:
+	.string	"SERVO_PLANE_INDEX_MAX SERVO_RUDDER"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1496:
+	.string	"__DECL_SIMD_log10f "
+.LASF1434:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1501:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF2146:
+	.string	"gyro_s"
+.LASF2155:
+	.string	"gyro_t"
+.LASF1468:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF923:
+	.string	"USE_BLACKBOX "
+.LASF871:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF1389:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1143:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF841:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1476:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1207:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF927:
+	.string	"USE_TELEMETRY "
+.LASF1377:
+	.string	"__DECL_SIMD_powl "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF817:
+	.string	"__key_t_defined "
+.LASF1809:
+	.string	"long long int"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1745:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1354:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1559:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1936:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF801:
+	.string	"EXIT_FAILURE 1"
+.LASF955:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1119:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF762:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1040:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1158:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF2002:
+	.string	"BOXNAVWP"
+.LASF1063:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1223:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1096:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF2073:
+	.string	"attitude"
+.LASF969:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF1167:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1777:
+	.string	"DYN_NOTCH_RANGE_HZ_HIGH 2000"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1964:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF895:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF2137:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF2100:
+	.string	"OWNER_SPI"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1176:
+	.string	"MAX_GLOBAL_VARIABLES 4"
+.LASF1147:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF2164:
+	.string	"mixerUsesServos"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF962:
+	.string	"USE_FRSKYOSD "
+.LASF2221:
+	.string	"servosInit"
+.LASF2193:
+	.string	"isMixerUsingServos"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1546:
+	.string	"__DECL_SIMD_erff "
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1074:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1232:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1687:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1930:
+	.string	"SERVO_TYPE_SBUS"
+.LASF2175:
+	.string	"servoAutotrimState_e"
+.LASF2197:
+	.string	"trimState"
+.LASF1650:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1034:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1772:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF833:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF2040:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1328:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF986:
+	.string	"USE_SERIALRX_SUMH "
+.LASF763:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2072:
+	.string	"attitudeEulerAngles_t"
+.LASF1922:
+	.string	"servoConfig_Copy"
+.LASF2110:
+	.string	"OWNER_LED_STRIP"
+.LASF2219:
+	.string	"loadCustomServoMixer"
+.LASF1027:
+	.string	"USE_UART2 "
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1248:
+	.string	"PG_ID_INVALID 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1107:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF2085:
+	.string	"PID_ITEM_COUNT"
+.LASF849:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF840:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF1149:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1735:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF1236:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF1217:
+	.string	"PG_CF_END 56"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF907:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1554:
+	.string	"__DECL_SIMD_erff128x "
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1290:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2045:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1191:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF2153:
+	.string	"sampleDeltaTimeUs"
+.LASF1725:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1446:
+	.string	"__DECL_SIMD_coshf "
+.LASF1209:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1156:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1741:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1444:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1367:
+	.string	"__DECL_SIMD_expl "
+.LASF1028:
+	.string	"USE_UART3 "
+.LASF1152:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF2015:
+	.string	"BOXOSDALT1"
+.LASF2016:
+	.string	"BOXOSDALT2"
+.LASF2017:
+	.string	"BOXOSDALT3"
+.LASF1087:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1791:
+	.string	"__int8_t"
+.LASF1241:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF913:
+	.string	"USE_I2C_PULLUP "
+.LASF1353:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1627:
+	.string	"_Mdouble_ long double"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF1112:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF993:
+	.string	"USE_RCDEVICE "
+.LASF1705:
+	.string	"AXIS_ACCEL_MIN_LIMIT 50"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF1373:
+	.string	"__DECL_SIMD_expf64x "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1268:
+	.string	"SERVO_SINGLECOPTER_INDEX_MIN SERVO_SINGLECOPTER_1"
+.LASF1267:
+	.string	"SERVO_DUALCOPTER_INDEX_MAX SERVO_DUALCOPTER_RIGHT"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF2056:
+	.string	"NAV_RTH_MODE"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1854:
+	.string	"INPUT_RC_ROLL"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF1145:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1876:
+	.string	"INPUT_STABILIZED_PITCH_MINUS"
+.LASF2167:
+	.string	"servoFilter"
+.LASF1218:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1928:
+	.string	"SERVO_TYPE_PWM"
+.LASF1788:
+	.string	"unsigned int"
+.LASF1029:
+	.string	"USE_UART4 "
+.LASF1419:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF852:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF1229:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1584:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF2195:
+	.string	"setServoOutputEnabled"
+.LASF1660:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1276:
+	.string	"MAX_SERVO_SPEED UINT8_MAX"
+.LASF1694:
+	.string	"GYRO_SATURATION_LIMIT 1800"
+.LASF1305:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF2166:
+	.string	"maxServoIndex"
+.LASF922:
+	.string	"USE_64BIT_TIME "
+.LASF1486:
+	.string	"__DECL_SIMD_atan2f "
+.LASF1035:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1557:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF981:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1427:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1120:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2094:
+	.string	"OWNER_ADC"
+.LASF1794:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF940:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF983:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1488:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF1371:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1902:
+	.string	"rate"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1030:
+	.string	"USE_UART5 "
+.LASF1885:
+	.string	"SERVO_GIMBAL_PITCH"
+.LASF1190:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF1641:
+	.string	"__MATHDECL_1_IMPL"
+.LASF869:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2132:
+	.string	"RESOURCE_UART_TXRX"
+.LASF2066:
+	.string	"TURN_ASSISTANT"
+.LASF1577:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1676:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1046:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1099:
+	.string	"EXTENDED_FASTRAM "
+.LASF1515:
+	.string	"__DECL_SIMD_log1p "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1699:
+	.string	"HEADING_HOLD_RATE_LIMIT_MIN 10"
+.LASF1442:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1315:
+	.string	"MAX_CONTROL_RATE_PROFILE_COUNT 3"
+.LASF1734:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF1076:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2185:
+	.string	"constrain"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1015:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1109:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF2217:
+	.string	"writeServos"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1465:
+	.string	"__DECL_SIMD_sinh "
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1360:
+	.string	"__DECL_SIMD_logf64 "
+.LASF1571:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1755:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1031:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF920:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2341:
+	.string	"rx_pwm.h"
+.LASF2319:
+	.string	"thread-shared-types.h"
+.LASF2283:
+	.string	"pwm_output.h"
+.LASF2253:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2348:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2255:
+	.string	"/usr/include"
+.LASF2352:
+	.string	"mathcalls-helper-functions.h"
+.LASF2310:
+	.string	"endianness.h"
+.LASF2304:
+	.string	"floatn-common.h"
+.LASF2287:
+	.string	"stdint.h"
+.LASF2266:
+	.string	"pwm_mapping.h"
+.LASF2240:
+	.string	"src/main/build"
+.LASF2252:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2286:
+	.string	"stdbool.h"
+.LASF0:
+	.string	"./src/main/flight/servos.c"
+.LASF2262:
+	.string	"time.h"
+.LASF2313:
+	.string	"select.h"
+.LASF2355:
+	.string	"bus.h"
+.LASF2248:
+	.string	"src/main/target/SITL"
+.LASF2282:
+	.string	"mathcalls.h"
+.LASF2318:
+	.string	"pthreadtypes.h"
+.LASF2359:
+	.string	"dma.h"
+.LASF2334:
+	.string	"common_post.h"
+.LASF2339:
+	.string	"parameter_group_ids.h"
+.LASF2251:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2288:
+	.string	"libc-header-start.h"
+.LASF2308:
+	.string	"timer_t.h"
+.LASF2330:
+	.string	"platform.h"
+.LASF2256:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2276:
+	.string	"servos.c"
+.LASF2274:
+	.string	"resource.h"
+.LASF2265:
+	.string	"servos.h"
+.LASF2245:
+	.string	"src/main/flight"
+.LASF2272:
+	.string	"imu.h"
+.LASF2335:
+	.string	"debug.h"
+.LASF2285:
+	.string	"stdc-predef.h"
+.LASF2345:
+	.string	"vector.h"
+.LASF2346:
+	.string	"math.h"
+.LASF2309:
+	.string	"endian.h"
+.LASF2263:
+	.string	"filter.h"
+.LASF2353:
+	.string	"quaternion.h"
+.LASF2289:
+	.string	"features.h"
+.LASF2250:
+	.string	"src/main"
+.LASF2298:
+	.string	"time64.h"
+.LASF2291:
+	.string	"wordsize.h"
+.LASF2242:
+	.string	"src/main/config"
+.LASF2290:
+	.string	"features-time64.h"
+.LASF2329:
+	.string	"strings.h"
+.LASF2281:
+	.string	"feature.h"
+.LASF2323:
+	.string	"struct_rwlock.h"
+.LASF2271:
+	.string	"runtime_config.h"
+.LASF2268:
+	.string	"config.h"
+.LASF2295:
+	.string	"stubs.h"
+.LASF2275:
+	.string	"gyro.h"
+.LASF2301:
+	.string	"waitflags.h"
+.LASF2332:
+	.string	"target.h"
+.LASF2296:
+	.string	"stubs-64.h"
+.LASF2358:
+	.string	"bus_spi.h"
+.LASF2278:
+	.string	"maths.h"
+.LASF2302:
+	.string	"waitstatus.h"
+.LASF2244:
+	.string	"src/main/fc"
+.LASF2299:
+	.string	"wchar.h"
+.LASF2292:
+	.string	"timesize.h"
+.LASF2241:
+	.string	"src/main/common"
+.LASF2280:
+	.string	"rx.h"
+.LASF2254:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2311:
+	.string	"byteswap.h"
+.LASF2357:
+	.string	"rcc_types.h"
+.LASF2342:
+	.string	"stats.h"
+.LASF2307:
+	.string	"time_t.h"
+.LASF2260:
+	.string	"stddef.h"
+.LASF2351:
+	.string	"fp-fast.h"
+.LASF2303:
+	.string	"floatn.h"
+.LASF2356:
+	.string	"bus_i2c.h"
+.LASF2331:
+	.string	"common.h"
+.LASF2321:
+	.string	"atomic_wide_counter.h"
+.LASF2261:
+	.string	"parameter_group.h"
+.LASF2344:
+	.string	"controlrate_profile.h"
+.LASF2273:
+	.string	"pid.h"
+.LASF2338:
+	.string	"config_reset.h"
+.LASF2312:
+	.string	"uintn-identity.h"
+.LASF2264:
+	.string	"mixer.h"
+.LASF2306:
+	.string	"clockid_t.h"
+.LASF2347:
+	.string	"math-vector.h"
+.LASF2270:
+	.string	"rc_modes.h"
+.LASF2259:
+	.string	"stdint-uintn.h"
+.LASF2305:
+	.string	"clock_t.h"
+.LASF2350:
+	.string	"fp-logb.h"
+.LASF2267:
+	.string	"adc.h"
+.LASF2294:
+	.string	"long-double.h"
+.LASF2269:
+	.string	"rc_controls.h"
+.LASF2293:
+	.string	"cdefs.h"
+.LASF2349:
+	.string	"flt-eval-method.h"
+.LASF2246:
+	.string	"src/main/rx"
+.LASF2297:
+	.string	"typesizes.h"
+.LASF2277:
+	.string	"logic_condition.h"
+.LASF2354:
+	.string	"sensor.h"
+.LASF2333:
+	.string	"sanity_check.h"
+.LASF2327:
+	.string	"locale_t.h"
+.LASF2249:
+	.string	"src/main/target"
+.LASF2343:
+	.string	"bitarray.h"
+.LASF2337:
+	.string	"axis.h"
+.LASF2243:
+	.string	"src/main/drivers"
+.LASF2314:
+	.string	"sigset_t.h"
+.LASF2326:
+	.string	"stdlib-float.h"
+.LASF2300:
+	.string	"stdlib.h"
+.LASF2317:
+	.string	"struct_timespec.h"
+.LASF2336:
+	.string	"build_config.h"
+.LASF2316:
+	.string	"struct_timeval.h"
+.LASF2247:
+	.string	"src/main/sensors"
+.LASF2258:
+	.string	"stdint-intn.h"
+.LASF2324:
+	.string	"alloca.h"
+.LASF2279:
+	.string	"global_variables.h"
+.LASF2328:
+	.string	"__locale_t.h"
+.LASF2257:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2322:
+	.string	"struct_mutex.h"
+.LASF2325:
+	.string	"stdlib-bsearch.h"
+.LASF2284:
+	.string	"string.h"
+.LASF2320:
+	.string	"pthreadtypes-arch.h"
+.LASF2340:
+	.string	"io_types.h"
+.LASF2315:
+	.string	"__sigset_t.h"
+	.text
+	.section	.gnu.lto_.profile.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`x\002\225\r"
+	.string	"\004\021l\003"
+	.string	"+"
+	.string	"\203\342\222\216\005\002\002"
+	.string	"\002"
+	.string	"\001\215\227\230\342\001"
+	.string	"\002\325\252\232\236\f\003\321\300\313\362\b\030\002\001\002\002\002\003\002\003\002\004\002\005\001\002\006\007\001\002\006\004\240\342\234\212\n\005\007\b\t\n\317\344\253\311\013\004\002\b\013\f\r\315\346\206\312\004,\002\t\002\t\002\004\002\004\n\002\013\n\002\n\013\013\f\002\f\t\002\t\016\352\263\360\321\b\020\021\022\023\024\370\367\260\226\001"
+	.string	"\025\277\217\266\270\007\n\r\002\016\r\002\016\026\027\221\274\374\326\t\002\030\031\267\276\266\207\006\026\017\b\032\033\034\353\236\203\324\b\b\b\002\b\035\036\037\252\363\356\357\f\f\002\b\002\020\b\002!\353\326\344\330\f\236\001\001\002\021\002\001\002\022\023\024\025\002\025\006\002\026\002\027\002\b\027\r\002\016\022\002\022'(\343\204\312\376\004\b)\221\221\336\374\004\002*\311\267\330\205\016+\370\362\211\255\007,\310\202\362\326\013-.\313\343\243\305\007/0\377\241\342\376\0131\236\344\356t2\240\342\234\212\n"
+	.ascii	"P\250\201E9\023\314ISi\317`\002\202\250\210\033\022 \2233\346"
+	.ascii	"\245\200b&M\030\373];\227\034\2217\316\266\276K\003HTT#\f1\005"
+	.ascii	"x+\271aS9\240;dL,\357\021{\002\317\333m\020\013\353\375\370\247"
+	.ascii	"8\375\025\006\b_n\367\361\332\0051\252\314\316\307\261\345 h"
+	.ascii	"\315\002\311v@d}\240\0072\n\271\301\r\273T^S\237\024\020\277"
+	.ascii	"\217\321\253b\347j\347\217\240\322\271\263\375\n{\316\263\275"
+	.ascii	"\303.\336,\017}>\344\225\226j\026L\006\177\253l\177\272\301}"
+	.ascii	"N\206\017\217\250\312\341\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375 \346e\003"
+	.string	"\204\003\332"
+	.string	"\020"
+	.string	"\001\001\001\001\001\003\001\003"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001\n"
+	.string	"\003\r\001"
+	.string	"\001\024"
+	.string	"\003\025\001\027"
+	.string	"\003"
+	.string	"\002\031"
+	.string	"\001\034"
+	.string	"\001\037!\004("
+	.string	""
+	.string	")"
+	.string	"\003*\001+"
+	.string	"\003"
+	.string	"\026"
+	.string	"[H\255!8\246\310\200\001\\ \200"
+	.string	"[\320\211!\242\2518\226\b \006J\214\235a\300\215\251,\231\231\021P\003s\024@\f\225\300/al"
+	.ascii	"\013"
+	.text
+	.section	.gnu.lto_.inline.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\311\003\225\017"
+	.string	"fSJA\020\007k8\341\305y\bxu\237\214z\317\021*\b\026\"\033o\003\305\227t\201\232\255l\273n\275B\240\267\024"
+	.string	"\2664M\023\033"
+	.string	"@<\240\002"
+	.string	"\021\020\236\2360\357\275!\t\322\335z\373\367\226R\2467"
+	.string	"7"
+	.string	":"
+	.string	"0\277\007\025\373s\215Kr"
+	.string	"\016P\234\3372\371\327Q8\333\323\003%8\326V\245\343\227\200\274\356\267\334\356\356\317/c\020\033PG\356\25726m@\035\302_zx\023\335\246+\204^\206\033\335\315\361\243V\325\342\203\332\214\357U\374iT\321\302\230\200\201\006\n4b\313\262\303!8\357#\327\206\\\f\372\270-S\177%\371-\223$\322\366\026\001X\263u\300\253\311\255\356 \332^S\204\301\251:M\235\240\351\r\277~\024\376\203clrn,\332.0\tyyx\252\344\327\372\316\360\273\026\247\273G_w/\3509\266)\035\237\270\330Mi\311\022\373\210\327\342Nz\005T0\336\365~2\247C(I\024\377\227@z\222M+\341\257\t\237\032\223\370Zx\366\304\340\021\0013=K\363s\245\227\355\316"
+	.ascii	"\227T\250!\245\205D\250\2106;s@\002b\220ce\007\022\340\204L\206"
+	.ascii	"r\f!$p\334\304\345\237\205u\213\001\244'\350\261R\242\211\304"
+	.ascii	"\305\214&\367W3\r%NfU%\327\006\262\025\n\365\257cc\364c\027\216"
+	.ascii	"3\007q5\345 \250\346\373=\355(&\205C\016_\037\243\216\362\332"
+	.ascii	"[\026\373\237\"C\rS\323\213\230!#q\362}<\256\374\031+\304\360"
+	.ascii	"\231\022yGd/\210\270S3{\376\242%\222F\263\225\341(\334\345\315"
+	.ascii	"\0246\225\277\272\263\220\314\261\337\t\340\324_\355H\262p;\315"
+	.ascii	"\262\213\\gg\016\017l4\330<\341\311K\326)\310\033\223\331\234"
+	.ascii	"[`\030\223y\353\354\373b\253\342\025\257\034\223\302&\205_1"
+	.text
+	.section	.gnu.lto_.jmpfuncs.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\237\005\005\017"
+	.string	"6\22194`E\224\016@\375\310u\bv/\224p$B!\025\0043\211\013\362Q6\303\255\004\n"
+	.string	"\254I\003\036\3618Q\024\372\250>\232\016\3407R\362\311\312\266wJ)&"
+	.string	"("
+	.string	"."
+	.ascii	"\024v\214\034\fsCyC\267\255\231n\200<t&\355L\336\345L\336Zx\227"
+	.ascii	"\325.s\233\006\256\016\233\335\200&D5%o\353\355A\233e\255/\017"
+	.ascii	"\247\274\245"
+	.string	"'|\216\244-\301@\201@\013i\251Z1\266\305\230\226\260#|ws\367\n;\237\315'\342\361hH\032\022\325\332\177k\3165\032\231\357M\223\303AQ\217GUA \221\210e\331\222\177a\241\233\020\356\333\nuB-S2m/\022\206vabL\336R\301*\230\241E\376\276\360\337K\203\0018\303\016\376\023=\321\005\272@\230Q\310\030~\235\327\271JW\251\215\332h\023\200\204\250\021a\214f\nS\030\346\300\002\221\032\";\022\300Aj\002\214\304B\207Hd$\005\245E5\352\326\r\205%\\1\273L\031\207@7\303\341\200\267/\273\334Y\375\b\336\343j-.\261:]\020\3341\306\024\224\375/\316\007A\370\212\033\274\260\355\373\233L\204uf\302\212\302\f\245\226\036\316/M\313I\204\025\365\202\013\235\314\300uz\241\306L\3556\266\363\3463\264-\025\302\247\024L)C!\336Q\204_\001\t8\210B"
+	.string	"\021\b \002\001D \200\b\004\020\201"
+	.string	"\"\020\340\221B\226f\356\3043\214\346q\364<\230\224,\f\350\265\331\005\250\272\326\365\276\3446&e\314d\350(\n\325\244\037\344\265\333\037\023\023\200\344\023\267\337I\330\374\312\364k+\306\212\030z8\302-)`\257\267\217\266\021\263\236K"
+	.ascii	"\306P\221\303D\"\376\356[x\204'*\222\253\004\323\244\360\001"
+	.text
+	.section	.gnu.lto_.pureconst.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\232\004\001\230\004\003\231\004\n\204\004\r\232\004\024\200"
+	.ascii	"\004\025\231\004\027\204\004\031\231\004\034\230\004\037\230"
+	.ascii	"\004!\231\004(\232\004)\204\004*\230\004+\204\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\211"
+	.string	"M\006"
+	.string	"\322\211\035&\240\247\225\003\377\177\326%\310]U\375U\361\273\372F\210C\341o\277\273\273\373\377\277\373X\360\214\2659\233t#2\245&\034$Z\225\245\260P-\223\301\226t\213v"
+	.ascii	"\"\333\202=D\204\037\352\324\226R\364i;M\232G\333h\315\034\332"
+	.ascii	"B[T\035K\\N\177\266\317\234`;0o\266\002sf\313\314\003\266\316"
+	.ascii	"\026\211\342a\342jp\320\210\327U \226aCg\b$ P\202Rwv\247\005"
+	.ascii	"\030@{\324'\314\030\2150\035\002k\344<I\354R\227\007\243k.\t"
+	.ascii	"\253G8\340\355*\265fJ\271\352\006\013\363w\221\350.\320g(% \245"
+	.ascii	"`W\006k\306K\006\2763\367\031\254\264\n\030\344m<E\242\241\f"
+	.ascii	"\240\b"
+	.text
+	.section	.gnu.lto_.lto.fae46121b84a2488,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_servoConfig_Registry.105.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375 \225]\004"
+	.string	"\324\007`"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\206\200\200\374\342\303\274\250\017\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\335\006us\250\366\005uq"
+	.string	"\005\001\006'\001\n\264 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.ascii	")\"\301$\016\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_servoConfig.107.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375 K\375\001"
+	.string	"\344\002>"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\035\001\001'\001\310\031\001\0242\334\013?\202\210\2000\177}\300\001{\277\001y\276\001w\275\001u\274\001s\273\001"
+	.string	"\006"
+	.ascii	")\"\300\r\2306/\006RZ\301@\021"
+	.text
+	.section	.gnu.lto_customServoMixers_Registry.111.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375 \227U\004"
+	.string	"\304\007b"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\203\306\321\033\030\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\347\007us\366\006uq"
+	.string	"\005\001\006'\001\300'\001\225 ?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.string	"J\005\017\263\350\024E\336"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetFn_customServoMixers.112.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\337\001\375\021"
+	.string	"\206c{H\320\224M:\320\366\322Q\273l\314\330C\3061\314\2664\212uZ\034\004Aoy\257D4L\023\001\326\361)\261f\233\302\204\212\202\030\027hp\305\003|\361\304\276\366\0201(\n\343]s\037\206\224dtl\322\b\331R\246\024f"
+	.string	"a"
+	.string	"e"
+	.string	"!>`N\032\242\036s\212\f|\342\235\263x\003\3359\357\005\272s~\331F.\306\230\037K\270\354 \3159\277\205a\223K\361\226\372:'W_~\316\025\254"
+	.string	"\232\321`\347\344\221X\030\005\240\215\220\022\\\210\244x\355\372B\223\251\264\201\371\276\366\223\030\236\031\r\346ZJ\231sZg4\024ww\333.\333\025lE\020S\223l\021\246[c_\200\216\020\"/\215m:\316_\372x\313\253w\325\272\352\227t?\206\034\270\315i\342\206d\006q>f\250~D\025Q\371;\366\t\005\244\362E\277\346\3239T\220\312\266\257s\035\257\217\376\361`'<\236Q\305\321\2343u\316\024\274s&\362'\033\345\243\272\332\307\361\034\257\343\0046B"
+	.ascii	"B\037Oo\373m\347\001\352\020\321\234\341g\376\216\367p\220\227"
+	.ascii	"q\316 \300\356\263s>\330\235\333\265;|\320\317\\r#\023.\314\272"
+	.ascii	"\245\335=\031\nmtw\220\356\253\373\220\206Lo\226\373M\031\271"
+	.ascii	"$\211\351\315%73s\347'a\253\261{\204\343\"f\235\372\307G\220"
+	.ascii	"\211i\222_\273\2741\2436\033\241\254\033\202\003\225\325\203"
+	.ascii	"U\003\025\n\201\325\n\213J\013\310\302\362\274\202\002\266<\270"
+	.ascii	"V\340\327\202\341\002+\203\205\217\205\245\242\341[q\201\037"
+	.ascii	"J\002\2676\254\\_K\253\345\372N\342\374\322\3709\367l@\202b+"
+	.ascii	"\343\266\306\246\2365\355\026i\352r_\374\323\311\235P$B\217H"
+	.ascii	"\240\031\271)1M\272\234sNi\332\2177Yp\271\246}\330B\246\267\277"
+	.ascii	"\b\003! p\202!\303\365b\022\214\004v\272\201\254\037\262e\251"
+	.ascii	"7\310C\f$\002\013\024\372Ql\276r\263%\225M\303\306@\321\006\323"
+	.ascii	"%\351\205\256xm\341|\303\\\363H]-\264f\334\276\t\266\334\357"
+	.ascii	"\257\364v\t\026\361^\250\035\357G\244s\211'"
+	.text
+	.section	.gnu.lto_servoParams_Registry.116.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375 \230]\004"
+	.string	"\324\007c"
+	.string	""
+	.string	""
+	.string	")"
+	.string	"\005\001\212\001\202\200\200\374\342\303\326\221\035\007\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\350\364\006us\306\006uq"
+	.string	"\005\001\006'\001\200'\001\252\300"
+	.string	"?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\033./src/main/flight/servos.c"
+	.string	"\004"
+	.string	"J\005\017\263\350\024E\336"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_pgResetFn_servoParams.117.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\302\001u\021"
+	.string	"&\341uH\320\224M:\324\262yq]%_)!\323\222R\257\321 \321\305@ \222\331\243\240\020\037y\026\335w\375\272\330\372N\004\030\3073\202Yk\016\270\302\013\356\206\234\251Y\307Z\222\315\352H\214\267\031h\351\332\b!dK\231R`"
+	.string	"Y"
+	.string	"e"
+	.ascii	"7<p\314)6p\n\370\316\342\017x\357\300\033\360\336Yf\023\271\350"
+	.ascii	"b~\334y\tJ2\347\f7\307\003.\305[\252Le\376\317\025\260 \202\261"
+	.ascii	"\315\336\311=\332q\023`+!'\324\344\3748\356\032csQ\t\203\346"
+	.ascii	"{\334SV\020\301\330h\256\237\312\234\323\nc\233\271\275\333\206"
+	.ascii	"\331\276`\237I\336\033\333t\237\377\373x\313\253W\325\252\352"
+	.ascii	"\003\370f\216N\206\346D\221[2\215\272\034;\037\177\373(\236\225"
+	.ascii	"\037d\237P/V\276\350\343|z\207\322Y\331\366m\034H\366\321E\340"
+	.ascii	"L\006\034\032g\024\231s\246\336\331\002\370\016E\376d\243lVW"
+	.ascii	"\3735\336#\273\317\210\023\2303\257\325\034\367\333\324\224\220"
+	.ascii	"\002\324r\020f4D\037\361E\310=x\376\215\020 |\035_\004\222!*"
+	.ascii	"t\277\335M\340\243&\003\274{x_\335\327b\270h\316r\277\013\202"
+	.ascii	"\2744\241i\316\237\216\333\f\372M\b!\331=:\322cd\235\372\307"
+	.ascii	"ShA\323%\037w\311sS!%\244\251K\2668\323\305\261\217\340\004\220"
+	.ascii	"L\256[\302\003V+B\313\301JU\240\265\302\302j\211\261\270@\257"
+	.ascii	"\250b\257\017\260V,l\321\220\301\265\001C\310\342bq\bW`\261P"
+	.ascii	"u\342W\207\026,ly\275`\341I\234\337\033\377\034\034JaD[\227n"
+	.ascii	"q\374%\255i7IS\227\033\343\"On\205$\022\252\004\310M\256\nM\227"
+	.ascii	".\347\234S\232\366\343Q\030\\\256i\003# `\002!\206c\007b\022"
+	.ascii	"\224\006\366\037\271K;\r\242Ws\006)\3610\262\341\263Mge\363."
+	.ascii	"\234\330ch\271\327\320\2004\201b4\004\302\034/!\252\270\217("
+	.ascii	"\\EX1\337U\264Y\334\030\266\210o\257\274\3552X\240=\211%\250"
+	.ascii	"\036\357O\244s\231'"
+	.text
+	.section	.gnu.lto_getFlaperonDirection.129.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\212"
+	.string	"\265\n"
+	.string	"6\223JB\020\005+\035"
+	.string	"@0\367 \230\013\035JEh\rx\006K\320\362\374\b\024{Bg\007t>\235r\365w4\214\237\364\263H\216\\3<\001"
+	.string	"D\276\2244\374\033\242\356\002u\2208\242\277!D\310\336R\2465"
+	.string	"7"
+	.string	"7"
+	.string	"\037/\003\270\037e\331r+\345\362\013\333zJ\341\315\314\332\322:\262\345\324\022\314X\025\365n\001v\267L3e\314\037Sw\237g&\312\376\333\377\031\3771\376\023\bm\262@A\353|7.\377_\177\350\177()Q\376'(^\253s\235v\333hj\272O\210\217@\373\375\377\276,\314\353%\237-'\340\r"
+	.string	"\311\314\201\356\016\025V\004nKi\364&\021\032\253\b\274\001lc\240\267Bi\356u] S\r\231\036\031#\370\356\366\200\207\263\323\234\340?aLs\377\326\246\270\177u\273|\376\326O\201\236\003O\007\267\220@\211\025bD\211\264\260R\235@O\221Xc\b)\262\302V\007\207\312c#\\\251P\037a\212d\205\244\206\217 \"\031\266\306\221\fCg/\305\375b\204\356n\rTb\004p\271%\030\017"
+	.ascii	"6\211\244u\005\013\266E5\361+\024\300B\ra\257\3166\230\352y\017"
+	.ascii	"v\270&\342eA&\213\tQ\252\032h.\005\005"
+	.text
+	.section	.gnu.lto_servoComputeScalingFactors.130.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\304\003\345\026"
+	.string	"v(\220J\240\024R:\r\\\240^\340G\243\302O\301\227_W\356\355\265\326\n\363&t\201\203\242\216\227@\3174\334\376i\301\\PP\353\213\223Q\326y4\202\265\340UQ\206\303k\311\275\317a\2606\206i-[4\267\366\177\262\211\2242\005s"
+	.string	"u"
+	.string	"|"
+	.string	"\335=\373\317c\001\252i S\320E'\201\0242\273\nu]\241B\037}z\f\233&\223D\370\234ht\367\213\316\333\300t\262hJ\251\223T"
+	.ascii	"\245N\236\375\003\200\310\354\376\bdx\032\324p\356.\252q\325"
+	.ascii	"-|y\001\230\316\363\376!*Tj\035\036\203\212G\272\273\306!\224"
+	.ascii	"\247\313\273j\223\306~\300\r\272\257\232\356\376\376\200\036"
+	.ascii	"\364\254\377[\376K\370I\227A\260\032\311\226\214\353h\250\264"
+	.ascii	"\242T\227\320\222\"\312\n\245,\275\345:\n+\317\254\240\256\336"
+	.ascii	"\036\277F\340\216^\256_\370\263\234\364+\331\214\364kP\025e\356"
+	.ascii	"O\346\336d\367\263\335\313\310}l\356as\377\332}\271\373I\356"
+	.ascii	"\311\3353\271\337\335+-v\204C\310\312\261\233\303QIkM\027$\244"
+	.ascii	"b\\\020\217\024c\216\310\236J0<n\335G\235\256\303Y\t\"\212J/"
+	.ascii	"\024\306\r\216m\365g+u\316\342\217\210\225&9\r\250\273\327\362"
+	.ascii	"b\030\253\317F\311/\026\220\345\333\232\314\\\262J\321\307\364"
+	.ascii	"\263\307\223<oz\205c\252(\253\026$+\217\037D\025\362Q$ji\302"
+	.ascii	"h\231Y\203\272\236\243U8\376\021\031\025\005\273\201f\224\370"
+	.ascii	"gP\026\023v\345\3518\004\021\354n\032*5\356\\G\350|\316\302\352"
+	.ascii	"O\347uW\352\\\326\342\222\323\025J\265Ie\001\327\301\335\224"
+	.ascii	"\2479\200s\233\271\031\210\201\241a\270A\340Q \273\rf\227\273"
+	.ascii	"\240\273\355j=:98\n\021j<8\234\235\232M\267\253\301\004x\256"
+	.ascii	"\302MW\353\311\345t\265\231\260\247d3\322\027|\320\352\361\317"
+	.ascii	"O\370g\240Z:r\230\360\311\214Md<y\306*Y1\2265\320\0338\256\""
+	.ascii	"B\232\262Q#\306\332c)\312\bV\007\251(-U\030\365t\206\276\030"
+	.ascii	"\207\264z'\214C;`\374;P\031\267ZQ\352\356\231\307x\220\022B\250"
+	.ascii	"Q<\"\215C\310\221pDFq\325\001\320\202\021\242a\035\022\300%9"
+	.ascii	"\350\224\022\030\345\324\004\225\226\331j\335\304\006\r\003x"
+	.ascii	"z\247\362\002]^H\006q\260\312.\2139\351\245\333]\354\304\211"
+	.ascii	"\344\306\013\252,\212\214E\262\353\237v\204\213\202\003\346\b"
+	.ascii	"\343\2030(I\r\353\364X\036\323\231\203\255n\235]\262u\246\204"
+	.ascii	"<\332\r\210o%(\337(\002\3759E-\333g\240\177>\341\236\343+\241"
+	.ascii	"ZZ\035G\214*\266b\375n\333\261\270\247\250\0348\tF\301\334\t"
+	.ascii	"\250\275x\035?"
+	.text
+	.section	.gnu.lto_servosInit.131.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`[\003M\030"
+	.string	"V+\230J\240XU:\300\364\325\371\255\030\272\001\255\370\003)n\270\350\236/\274\262\300I\377\004\034py!\221:\323\200z\317\002E\371l!\213T\002\343)\214\227\343\345\310\002\035\304O\252\330\356h\023#O\333\303r\262!B\310\336r'\031\203"
+	.string	"\204"
+	.string	"\200"
+	.string	"<S\336\242\3762\336\326\007\030o\2519cf\362\223w\017\354\020\004\244r\357]\265\n\223O\257\347\271\366\354%\263$\215\2666\235\361I\026\201\026?n9\332K'\342F\374.3\003\027\202\232$+\305\020\211\227\224\304I2\272!\021\037\2118\021\025U\003\210\332\332\303\":SnC}PB\005\222\237\247B9\033\2552@\274\177~\206W\274\345@\234\222\254{/\323[n\350\314rf>\302\314\021\230\233A\277\335\362}\306\333\027\236\224\032-2KPF\367\020\n\321\223f\025\204\0235z\304?_i\350h\320\004\361\322#\346\223F{\307\374\030\017?\0347\n\346\223\211\274\357l\337\243L)\345\273\224\240\f\r4\271\367C\321\312Ub\213`\334\367\367N\231\237\022\376\330L\rQ\320`\366\236\254\2741\310 \360\205\223{O\325mJ\007\r\337\006\377d3\305\203\346D\2771{\217\205%\rW\356"
+	.string	"~pr\357U\335\006@X\330b!,d\274\215\021\266"
+	.string	"\r9\214\275c\276l|S\300\301\347\361\0362\276\013\316q\271\306\3337\314\212\020\245\242\022e\326y\321\337\030ek\032\277\306KA\"\333;&\215\372\324mDU\257-\304g\341X[\202\321\017\255\222DW\233U\243G\257\367\336[{\327\357\035E\363\332\247>P\t\033-\362\200\233\t\242i\344;#3\367\\\307N\013\357\336k\303\317q`\214\357\342\2265\370\320l\223\340\246\345\240\205`A\r"
+	.string	"\327\031\247&\366\352\201\265b+\036\0139\256\013\025V\030\\7:+\034XlU#\200_\031Z\260\025\317\353\005[\231\347}\243(\203Q\224\324\332\306\245\336\035`Q\232\232+\211l+\033\355\357u\212\355\373n\232\372\276\243\202\334\266\251\300\355\210\013\245\315<\341\346\247il\233\366\203\256$){\307\324\336\307\377;\211'd2\336\307\311\026\342\223zw\331X$\303q\301,!B\274\374\037\017J\2501 \b*\246\210#R\023\211h\201\241\016P\002A\310\316\016\021\320=T'\225\366\r{(\336\035\227\360\312Uz\303\035\006or\366]\024n\013\271\212\332"
+	.ascii	"\333+\305\365v\207h\227\332\211\016Q\370N\306{\005\232\311#\321"
+	.ascii	"\205\007\331\211\234{0@\240g\232\3551\334u/j\016\315\b\317(\261"
+	.ascii	"\346\243\273\0320\327\337T\353\207o\224\354\371\nQ\355\236\340"
+	.ascii	"\302\245\277\323zg\316\216\207\336aa\252T\252i,\245G\203\005"
+	.ascii	"[\357k`R@\304\t:\262!\320ht\215\026\362\31615s\224\036\376\355"
+	.ascii	"\235\005\377\001"
+	.text
+	.section	.gnu.lto_getServoCount.132.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`s"
+	.string	"\235\t"
+	.string	"v\022B:0\345(\035\300}\3175\300\270\022\360H\220p\005\3711\207\r\325\253\204\036@\345\227\266\266\317\030\024\355C\f'\037|\243J\n\nPf\b\320\207\2362\322d\266\033#dK\231R/"
+	.string	"0"
+	.string	"1"
+	.string	"?\320\236\305\033h\317\364\343\337\243\346\347k@\323cF\343Z"
+	.string	"\246\"gw\377z\256@T\246\300gw\235*0\343\316n[\301v\202\355\001\001-\373qw\327\312\2623\0353\235O?\333l\264t^v1b\002\226%K\021\261O\362\331\033\337\365\221\317V\211!\b\370\226\353\342\004\300\356n\2346\205\227WEU5\245\232\244]\031LbR\031\300~\311C\222\037b\213R^\365\314/i\317\256\0040\034\247\214\371\257kP`.\2330;4\245\006\006y<\256\242\013y\333\350\301A\004\321\260I\210\026\"6P\347m\036\004s\023\241n\033q\\\267m\302\275\262\006<V:\262sk\324\324\225\355T\177N\212\2121\223\001\020"
+	.ascii	"Y\004<\261\031\354!\0068\001v\005\325\024\310A0&B\244\034\002"
+	.ascii	"\244\313\024\231\021\215;\335T{Ca\336\332R\006"
+	.text
+	.section	.gnu.lto_loadCustomServoMixer.133.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\230\006]\""
+	.string	"\266\270\312H\200XN:~\224"
+	.string	"\247\r\342&\333\322\276\244@2\231\312\312\024\307\343\021\224\324}Q\f\215\335H\200\206\261}s1\327\305\230\323\261\357\226!-\037\206Bq\031\272yVD\225\366\336H\271y\266\306\2317b\t\331r'\031\260"
+	.string	"\260"
+	.string	"\274"
+	.ascii	"\277\342k\335L\345<\353L\210~\344\261\263h\351\354B\236\271\335"
+	.ascii	"{q^\362\203\363\345\357\004\314\227\366\002\314\227|\254!f\337"
+	.ascii	"\313\3661\021s\333\217T\367\310\260$\344\334\275\027\330A\370"
+	.ascii	"w{<\367*\321gz'\317,mW\"\376\222/\030\"\207\032\213>c?\267\003"
+	.ascii	"\314\325\226t\330\fI[p\030\325\036\217\007\b\323\323O\005QLN"
+	.ascii	"\347\251-9\331_U2&U\263\351%\215\021\311\376\356\275>#\215j\355"
+	.ascii	"\005\254$Bh\214G\266\233t\221\275\310\222\216\332\327z9u\366"
+	.ascii	"\026\305\364\364\312\343\271\367rE\215Lg\337\231\331\213\231"
+	.ascii	"}\230\315`'\370U/\331'\0304\205*\352Q\376!u\021\327\024\t\224"
+	.ascii	"O\031\036\371]\024\026\004\326\214\374\307\344?y\330\017\277"
+	.ascii	"\212\203^\324\243/\314\2276Tq\305z\3075%\242"
+	.string	"vk\035\363\321\250\366\024\363\037$o\024n)f\033\263r\315\217\347\323V\346\331\312fY\271\264\225\255\255\334\266r\355\312/\340+\223%G\356\336\033wenZ)6\344\307\237\371`-\026\227\304\253\305\304p@\206\271\335\311\320\233\360\221=8\273\271\227\314Ld\257\327\265UUkWs\016\256\344\324z\256\241o\361X\207[d\262\360\243\r\211\007\204\227\254\341|y#\225\303\001m\303/O\220\276\275\361\354\231\027\333\024\222N\311\323\244hhf\35553\024\256\313\023\244V\322\2124\251\225\263\245L\252\224=\305\335\265\211[e\\\272)$\235X\304\265\214\360\220\243\352K-K\355\262\362\352\"\033k\272\263\262%\3147q+yT\351\230\231\304\317Jx\310\001\325\343\352\336\243\nO\231\201n\326\323\006\212\344\214l\\\335{w\260\274\314\204\220\371\362\315 \231\305\377\372\265~\306\231]2n>\271\250\013\366"
+	.string	"f]e5\224\2049\373_\377\025k\035\003H\245\264[\226\217\247f\234\377x\fPE\255\333#Q5\305\252\251XL\234\377\352U\2024T\367\026\217\362\251\234,\274b\206\020\005\320\360\204\311;\022|\204\025\204\021&\350\004\030\236\203:BA2\210B! \214\025*\206-R"
+	.ascii	"\201\206>?\300 Q\b\250\203\200\203\\\b\211@\030AAD\240\357X|"
+	.ascii	"K-\371\231\332\245\025\333H\312LOq\017\354\264\351f\2538?[\211"
+	.ascii	"\307\314\2637\260\035U:\264\250\263y\212\265\356\366\336{{6\375"
+	.ascii	"\343\1779?\333\346F\t\213\327vG\341\376c\232\315\353#\3650\252"
+	.ascii	"wLgv\201\244\223oN\355@5k\272lf\020!&@\361\307\304\030\300bz"
+	.ascii	"\032\304\225]\221h\023\327\314\025\232\025\\\214FR\241@\177\353"
+	.ascii	"\351-Tn5\2753\2066\335\311? \271.W\317\200\217\250qH\307\fD2"
+	.ascii	"#I$I\222t\260\002\031\251\252y\022\300\205E\317\224\021\022\233"
+	.ascii	"\302z\324i\016\267\320~\2474\226\340[\245\273mWM\"Jc\220\361"
+	.ascii	"\033\233\365s\203,\330\017\237M\363j\324\375\324\013>9\310\225"
+	.ascii	"A\214)-\245jZR\214e,&l\226\316\002\317\235\307\245<\023\023\264"
+	.ascii	"\006|\226S\t\"\214\256\360\237\374\330l\275\020\223\316\330\271"
+	.ascii	"\330\221\313\374L\344\256\033SE\335\274\313\341f\321\225\353"
+	.ascii	"\321B8\022\223\236\330\362\024\245\242\3100\247\027\f[\305\016"
+	.ascii	">fye\311\221\021\017\335)5\\\206W\351F\001\320\376\n\375\240"
+	.ascii	"\2539v\265=\350\370`\263\242qq\266\213=\253\3602x\344tV\336\352"
+	.ascii	"UG\353\374\270\3739\312<C$\252\240\322\206D\267\263\034T;h\022"
+	.ascii	"\n\254\361KI\315\326w\304=`a\223\003\034\261Ct\256+\375!\222"
+	.ascii	"jF\236\210\332\365*gx\366\226O\202A\347F\3051\026\300\371(8\021"
+	.ascii	"B\235\031e\220\374\025\372_\224k\254\377\233\234\353\017"
+	.text
+	.section	.gnu.lto_filterServos.134.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\234\b\325-"
+	.string	"\nO$\021CP\246N\007Kq\242\032\f\002D,l\216a\361\343"
+	.string	"X\001\242\362\301\226\344g\006\272\377\344\337\220\232=QL\353\244\036\002\222&\"\272\005\002m\355\360\023R\336\257\240\240\242G$\210!F\233\354\275SJ)\001\001\355"
+	.string	"\377"
+	.string	"\335\354gn0$XG\303q{\321q$\3122\355\336\033|v\221\300\305\251\340\354\311\275\237:\272\013\323e\270I\261&8Q\2561\250V\231\002\333\352\361\353\215\203\255\036\201<\237O\360\242m\034<n\031\267\2347,\304Y]\332\036\023\336\023w\032\267\223\203LzO\255\326km7\231\216\315\002c\303<\177\340\335{\235Z\345&\266Uc\037u\321\332j\032l\231\361\264\323\354\376\312xt\301\355\335{\245\276lH\344b\247\316f5m[h\030\024\022Y\340\252\246\305\367\226\373G\005T\206e\265\320\2217#>\\v\260\223\313\0266\024l\354\n\030\021'\376\250\232\210!i\326\2214\320"
+	.string	"\231X\221^\323\177s\206l\030\306\225NX\226\265i\347\226\253AV\204t\312\n\351\342\025\260\"hf\376mm"
+	.string	"\n6\226\032\357\275\215\326\356\025\246\345\376\243\272\367\262+\303\304\232\207\232\271\247\230\271\212\371\307\027\3214h\324o8;f\021mf\004{\357\235\342\246\3532%L\2348\361\300\265vv\007\221;\002\275\336\367\274\2276&-}&w\377\334\252\274\025\237\t\216\325\037\253\311\364\034\016\356(\214\242\252jm\325\177hGD(W\004J\344z\303\343\031\271\366\247p\273\333r?\314\254\242\345\220\354\275[S\334b:\256\005w\224V\331\352\205\267\262U\356\027k\253\375HN\326\222\036e#=I\370\362\256\3671;\265\374\231\314M\340G\033\030?\023f\250\246\243q\251\331\232\225\272\331\234\364\316\002\3349\200;#\2753"
+	.ascii	"w>zg#w.zg\242w\036\002:\027Yg\342\317y\310:\013\275\263\220u"
+	.ascii	"\016zg\340\317\231u\347\337\352\274\276\263\252:\247\355\326"
+	.ascii	"\374\251\263\277sG\r\310\262"
+	.string	"\034+\353\361t\234\027H\364\317\255S\347\250\264[7[\007~\357\315\"6}\263)}\023\323\327\031t\350\365\332\346\221\031\037\327S\346\025\177\350\037\256+P\322\211XZ-\336\312\342\033\267>\213\017\270\320\017\267\020\337\270\003\217\006\202<\035\372i\206g(|\241O3\364\035;\302o3vsC95<\276\345\036\373L\366w\352n\353\r\317\261\2561\253S\033\337\213\033\370\314\306\261\326)`\306\007\255\373K\016\313\372L\006\336\245\307W\357\212N\235\364^\305f\2725\351-\244Q\262$\246Jz_\367\275\367\252\307\357f\033\223\336\307O\235\364\307o\256\245\226G9\301\227\221\003\036\324\242\265j;>\213\201\037\364\036\307\205\027\247m\262\334\320\206S\301\302\205\013k\253\300\237`77\\B\227<\375\337\263\317\254\201\203\267\222\215\\\237\305\334nh\030\265\222\2317t\233\016\017\352\334{#\254i6\036>\200"
+	.string	"\261\266\312~+\207\254\377{\217S\177\375\356\n\224\364\354\"\007r\205\f+\024+GhP\205\234B2p\020Ed\325\254\"\252\306\325\r,d\r)\033.ZX\301`!%\303\252*\206\224\n\254\032RQJ|5\003\211%e\343\352\nK*\350L\3663a\345\324\324%_\213\205\236\231\340.\b\365\234\n\377\227\226\336:uC\346\226\336{\357\020\352\333m\351\241\n|\321A\005\374\216\266I4\333je^\200\027\360N\327\300\213\376\350\221\220\264J\274\225\001\036\300#1\006\317j\233\254_"
+	.ascii	"\317d7g\364GK:\020RF\030@\177\214\036\202\223/Au`\276\264\221"
+	.ascii	"\350\213\336\3450\333\017\362\215\364\027f\f\315\327\226y\001"
+	.ascii	"\266\250\333WZ\237\336k\235\264PZ)\336\312\226\312\332*\321w"
+	.ascii	"\234\335Z?\203|\364"
+	.string	"\252\360\341\005\365\221\265\227&\202{\006\362q\266\347\373)\2243\363o\362\324\364\004\237\311\356N\335o\315\356\351M!:\365\013\237\271\340\t\333\364\234\002\215\257\364^<\247\225\332:\355\243\364\315\326\035\200\262\250a4e\035c#\"\242 I\nR\030\016\200\002\231\251\"\363\022\340\205A\313\025\211\204\222$\245e?\003\267(\272\377\017c\334l\022\320[\274\022\344\t\001\226\220kov\232SRF(Tb\345\367\364v/\206\006\313QrR)\202Yw\275<\306\200u\235C\220e\211@\332\035?\323\274\260\217\364\262wo\b\271V\231\342\326db\255R\254\0322t8\013\317\240\304GX\220\n\244)\310\3445\"I<\007\276\f\357\247Y`\313\371\023.*y\036\320\262)\227\002P\247c\262\346\226\377&I\0334\261ya\016\032w[\212\367\007\025\260\375\314\320S\350[\231\345\250\331\324\350\221\201\300\237\233\033"
+	.string	"\231\201\025\3441@Zn\303q\240zD\364\033\265j\002u\333\b\316\002\363\205-\206\272\272\237i\264*\256\206Z?\ta\220\271\217\030\345\355\022\335^\032m[\307\260\361\336\366\307\343o\2657\006\035\367'\261"
+	.ascii	"\2121ht\227;\231\306i5\310\340\205U|\037V\027\204P\257\366\273"
+	.ascii	"N\256\275x`\230VA\266!\025-\344\353\307\371\013Pb\244\035\037"
+	.ascii	"3(q\025\245\211q;)bB\332\n\312\317O\037p\303|h\373!\354\013\016"
+	.ascii	"B)E\346:\3414y\214\236\227\207\311\260\232.\216^>6w\304\255\317"
+	.ascii	"D\353\301\204\t\361\243\357\017"
+	.text
+	.section	.gnu.lto_writeServos.135.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`T\005M\""
+	.string	"\246\275\326I\200\332Q:\275\376]WA\202C\237?Xo\330\021\272!\202}\036\326r\3224>^\372}\371\244\n\370\203\246K\307:\305\216i\260wGH\312<i\006d\255rz(1\326\371\203\343\b\336*\277\365mO\032\331D\356$\003\305"
+	.string	"\270"
+	.string	"\277"
+	.string	"\214\373\371z\327\231\004\237r\025\236Sz\200\213\354\230\344\336{\001\275\345}w\336\232\3179o\177\304\0360h\020\374\221\006\217)\275R\f\270\312\216g\367\246@\267\214"
+	.string	"\275\345 \363\231\247A\356\301\210\f\233\234\335{{\235\305\365\336L\317\270\032|\016w\263\241\265\323\232]\203|\257\037X\002\006\212\310\364\234Y{\222\032r\263)\036\346\020\032\232\261'\207\025\007\204\252\3527\003\266\032\321\025\325\216\243fS:L\336\326T\261\326jD\311\333,\2614WTU?q\304\032\325\362\356\275O\325Ds\274M\004VYn\350\210M\346\256\313\2172\367z\215\":\325Z#\272\367r\205\"R\235q\316\314d\230\371\003\263\265\001#\220b\234*\0323'\035\212\017\275\327\311\001?\354OL\360\205\334\262\022\212z\250[>\212\363\366=@\253KX\323Xgy\032\347\217\357\251e\221"
+	.string	"l\302\226j\200\204|\bk\033\326\2551\263U\346_\213z(\34655\023\353\260\231Z\252\271\265\rs\332T\333\310\374\241 hh\270\261\230{xvvge\235\263r\316\221g\335\217\3519\367\263\362\255V\266\235\225Q[\271fV>ke[+\233]\271\273r\255\225\357S"
+	.ascii	"\215\025\217\254$\r&\275Rinn\231\035#r\344\177\374\3237\363\177"
+	.ascii	"\310\036\360\277\370I\306\375\\A^\"\204c\230\343\231\007\364"
+	.ascii	"\366_r\257O\315\304O;W9s\255\323\\\207E\236~\232\340\271\346"
+	.ascii	"i\323L\r+\235\262\207\331\275\220\371\nC\333\310@\344\030\247"
+	.ascii	"\212\206~Y\2265\230\225'b\255\215\254\033B\031*\355\275N!\353"
+	.ascii	"8T\366\235\034\247\243\230w}\344y\266w\375\341\033\241\225\223"
+	.ascii	"e\320`dt\336\332\006\240U|\362\346\221\253{}\303R\nN\377x&\022"
+	.ascii	"\036O@\nG\231\360l#\337w\232\215\323\305\341T\306>"
+	.string	"\305\003\210\020!\372elO\276\334\3306\362\217\316\356>c\376\350\254\335\375a\261\251\2461_\354Q\216\370BX\004\022\322y[\373Q\264\212\302\232\366\034\033Ogf\033\371\027J\352\330\352\306\342\276\357|\007J\217\341#\261\242\302\215\207\026 \371\034\370\024\b\005\t\360\275H\201\324\301\350\007\364\311\320qR\320\322\017\006\320\267\324sq\302\204R\212\022\275\025JH*zI\300\245^\220\017\377X\370\200=\027\277\037\260\207K\205o,T\251\244L\330M\27162\316\230[O?\371\"0\261\241\362\334\265\256\243\330\274\341\232k\250<\201\236\353(]\337Z\002\027[\337\314\202Llm+\n\215\312\\\355#o\3366\362\214\034\266\235\256F\226oP\236\306\365\364\221\272\356\351\037\211T\225\031\256\237\326\033\3329X\236\353\234\235\235Z\243}3g\327F\234K\004\364\336;\304\327\362-\022&\024\025\235\267g\367\264\306"
+	.string	"l\331|*\320u\232\331\002\206z(.\037\001m\250A$\346\230S\n\215H \"\243\211\n\035P\002A\212\254\316\001\021\320\245u5I\332\rf-\266\320\370a\306\215\b\007c\244l\330#Prx\003\037)\t\302\033\357\024\177\377\246\005;\263Q\333\203'D\020\3774\354\326 \300\001z\250\330+x^\b\004\230B\353\254\026S\361\0314\204u\303\223\345a\267\002z\261\253\371>\261\234\t\031\225lC\352R\034\272\267E\3409W\264I:c\214\304-zZ\333$\231\274\357y\277o\233\222\306\340\341\361 ^\022\264Q1=\211\342\355"
+	.string	",1D\367\360\273\226NX\355Dyr\026\243\026N\257U-f\362o?mX\034\220\377\r\260\234\037]%"
+	.ascii	"i3s\324\310\200\0048R\244q\316\2042\273\b\326\224,\251f\022\036"
+	.ascii	"\364\350|\202Y\025gu6nD\325\237\233\346Pr4\234\245\006"
+	.text
+	.section	.gnu.lto_servoMixer.136.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`-#]\207"
+	.string	"\272\330\024/F\020@n\245\003{W\006d!\216\027\323F\030X\373\252\275\314\311\276K!\360\241\376\206\350\377U\370h\022\275\321L\322~!\236\202\261\315\210\247\330\256\304\031\260_\272\204\336\364\2406\317\376\355\366\207\226D\356\235RJ\001\304\002\251\002\n\003,Cu\316R\235\023\270\3161\2563\226\352\fCuF\300:\037p\235_Xg\027\326\271\305ufq\235WXg\025\326\331\200\353\\@\221s\212\353|e\235QXg\253\353|\302:WYg\023\327\231"
+	.string	"\353\\\302:\017p\235\005\260\316$\2543\325\221s"
+	.string	"Eg"
+	.string	"\212\316#\256\263\321:\213\270\316!\254\363\224u\226\272\316 \256s\224u\206\272\316\037\254\363\223u\366p\235\235\256s\223u\356p\235\231\2543\007\353\274t\235\225\256s\222\352\214\244:\037\0319\253\327\331\250\310\271\350:\337\353\\\274\316\366:\247\327\031\275\316_t\366\242s;\333\325\234[\233\026=\357\347n-K<\264\356I\235r\355\354v\323\375\246;N\267^w^w\232.2\367_\002^"
+	.ascii	"\335\331\300O\211\034\323H\317\341\356\263\372\002\310\315\f"
+	.ascii	"\035t]\263\242]\354J\324YYo:F\372\311\317\032\253\022\315D\f"
+	.ascii	"\211cs\206:e\2556>\022T\356\3263,;\202\250\f\255\270\331p\357"
+	.ascii	"5\234\226\303*U\2418G\214_K+\030\res\035(\r`\221\3547G\214_w"
+	.ascii	"k\331\007~ww7n\247$\234\264i\030\222\355\346hT\336\255f6\354"
+	.ascii	"\2541c\250\306\355t\311\251\374\254a\265S*@\306\260\2455\254"
+	.ascii	"yh\216\252\216\025\367\013\334jX\245\372\263b\316\343\347\375"
+	.ascii	"2\273zl\0029p;\265\215\307*\325\236U\337\265\013\311N\223\344"
+	.ascii	"\256qhh\t\024\264\256kU\247,\343v\212Vi\247\027\250\322X\265"
+	.ascii	"3\267\231\266K\366\031\206\303E\353ZG.\316\272\256Vl\342vjl'"
+	.ascii	"\333)\332\035l\247\314I\346\032\372\216\271\266^\236\261<C\353"
+	.ascii	"\272^\275\226(\243\321\211\227\032\275k^B\223\r\"\n\352\303\223"
+	.ascii	"\007)\247\246\016L\034\246\226\224\222\220\216T\243\242[\264"
+	.ascii	")\372\236\344\206R\b\314O\233\263\257\006Q\206\357\213G\221i"
+	.ascii	"\250\017u\375\204F\265\200\222\340\223s\017dZ\n-.)\373\322\200"
+	.ascii	"ff\320\0277\br\366\232\246;\025edA\363\322M\035\212\\\310\006"
+	.ascii	"\301\241ui&.\250Q\316\026\347\300\255\364\322S\350\363\251\003"
+	.ascii	"\327\200fv(\226\233\226<\255\346\315\227\262\2401[IM\233xc\310"
+	.ascii	"\314!\034\032\263\223\220\334\372\210J\2071ks\225\255\215\330"
+	.ascii	"\360zD\030\263)^4\342\242&\334\360<q\342s\005P1\351l,\214\331"
+	.ascii	"\232[\343\272\256\352\231\230\247\200fR\324\263%\2166\034\232"
+	.ascii	"\224~\324\251\354\3132\351,\f5!HN\241\306k';\003s/\312X\327\225"
+	.ascii	"}y\206\326\034\242\231\035\0063\2031\217\340\021\036\236\234"
+	.ascii	"\336\303\247O+\247\307\022dkJ\373\320\341\233>\315\253j$k\035"
+	.ascii	"\276\351\252\270S\n\223\2275\336\021\211\371\324\374\\\022rx"
+	.ascii	"\246G\021Qy1\260\252\227\2369Y\227,\343\275\344\360F\261\377"
+	.ascii	"b\245_\372to,\321Uz\254\246\323\235j\200EIN\275D\372\244\357"
+	.ascii	"\261D\217\364\351\236\030\341\375\243\367\347X\242$8\211\335"
+	.ascii	"\244\215\013\367\225\274!r \241<\305#V\375\017|\263\001O0\314"
+	.ascii	"o\260\363\261#w]\303Z\260/q\261$\032\005f\314\260\235\252\237"
+	.ascii	"\026&\326\235Qzb\313\0214c?N\275\323Gk\364\017\207\3677\345\337"
+	.ascii	"%,3\215\007\274\227F\337~\375W\234\206\322 \266\350\273\242\334"
+	.ascii	"\310<A\005\336\313\242\207Q%\354\277\370\b\016\342=\204x\377"
+	.ascii	"\312\260h\310\206\342\257(\264\204\b\273\360\002\fn\334\260\235"
+	.ascii	"\332\277\032Td\303\234<4\375\301\036\354@5\360\323v\232\376\212"
+	.ascii	";\250\025\"\253\376#\210>\213\246\337?\336Q\211\211\032.\t\225"
+	.ascii	"\236x\242g8\336u]_p\313\320}ppw\351\2249\310\221\303v\372\277"
+	.ascii	"B\320y\004\247\017\260\t\312 \f\317:\254\177\bx\177\302\374\006"
+	.ascii	"\366\265u\330~\377\036[\003\363D\346\326\323{tpw\341\035Z\336"
+	.ascii	"\313N\271\265l\247\375S\3155\245'\262\322\034\300&D\353!\341"
+	.ascii	"\352\210\314w`\376q\314\035B\2054f\374X\230}\212\257\265\233"
+	.ascii	"f\217\322g\272\375I\277i\366\264\216\323\354hnv\235\275\211\363"
+	.ascii	"\235{\205v6\267\230\326k\3560\235\327\334`\346\344\276x\351\302"
+	.ascii	"eK\223\251%K\034\226+pV\252\274\271Qic\233\"eM\r\311\271\243"
+	.ascii	"@y\222\206vfV\346D\205&\252s\223]\347^Z\347N\201I\222s\217\211"
+	.ascii	"]\347^b\235;\254\235\033\314:\267\322:\367\227\221s\257\3269"
+	.ascii	"i\235\221H\316J\2563\n\252s\022\325\371\204\353|\274\316HT\347"
+	.ascii	"#\252\263\t\327\331\310u\366R\235\213\250\316]\327\271\204\353"
+	.ascii	"LDu\036\242:\013\271\316A\2563\t\252\363\b\252\263\b\327\231"
+	.ascii	"\353:\003Q\235\177\250\316>\256\363\326u\356\241:\363P\235C\270"
+	.ascii	"\316Z\327\031\004\325y\207\352\374\301u\326q\235=P\235s\250\316"
+	.ascii	"\035\\g\016\256\363\006\2523\016\325Y\203\353|\343:g\240:c\240"
+	.ascii	":\333\270\316\027\\g\013T\347\nTg\n\256\363\004\327Y\002\325"
+	.ascii	"9\002\325\031\202\353\374\300u\256\241:\323P\235\035\270\316"
+	.ascii	"\r\\g\006T\347\031\252\363\002\327Y\201\353\001HD\027)\277\225"
+	.ascii	"\207C\"B&&\277\276l\247J\036K\360L\313\351nB\007Ja\233\272C\016"
+	.ascii	"\037\307=\365X\270\370G\311\247\374\377I\252\"c\345\f=p+\230"
+	.ascii	"\227"
+	.string	"\241t\304F\327u]\227>\356;\257\215\312n0\357S\322\364(i\373\267\243\022\363\251\274[\022lIrl\314v\352\3047\350\371\020\332\rR\252\212QE\251\246Q:8>=(\260yH\362(\234\360I\216\177\202\322\321\017\211\232\323\221Gb\302\0371\362&$\031\351\363Jk*\362^]_\344\255a\t\337\205T\302\223HY\207!OD\310\017\t\362B\216\202\360\221@\3064\302\223 \302\217\300\365\"\250\\r\200\214q\370\361@|\374\217\255\367a\264\205\246\307\203-=y|\217\020\236\307\333A\255\017\241H\353\223\330\201\220\250\264\343A\370\340w\350\370\017\256\2162\036 \2529\336\203\016>\007\007\337A\221\203\272\rl0\302\361\033h\3608n\274\006\366\306\230\f\n\2130\370\fl<\006o\373\\\3606\322\013\376HgA\240\273W\301[@\301W\360\266\317\004O\001:\301\037\305H@C\3210\202\227"
+	.ascii	"\202\217\340\213\203\017<\004\312~\340;\rL\215@\273G\343k8\360"
+	.ascii	"4\336\3765\360\016x\003\177|c@\206\364o\3063\260\300\317x\213"
+	.ascii	"H\201_\240\025x%Td\354A\233\237\317%a\326\313\360;\235\300g\275"
+	.ascii	"\035\024s\213\361\tL9\307\370$|lX(\032\357\210\004\343\261\236"
+	.ascii	"\020\226\346\262\b<\214o17\260G\200\335\317\355\3603\231\002"
+	.ascii	"\317\3419\266\323\003\276\3254\327\016\223\236LB\205~\327$\002"
+	.ascii	"\t9\007!\275x\"\271\370\027\217>\275M;\233NbR\202\241\026.X|"
+	.ascii	"\213G\373\220y\234c\026\023NR\315E\340\033\026\237\325\374[\361"
+	.ascii	"n\216T\374\212G\377\306\022\035\340O\b\205&\3050$\207\f(K\236"
+	.ascii	"y/U<\272\256\375\027\027"
+	.string	"\360\006<:\230\346y\307\254@\346$\024\177!\251\206\325\242S\3664\216\227\224\302\226\244B\305vZ\300g\t\236q\3369\3728\366\"\356\243u+i_\214\332\371\275\302\2231s\212\024^\354\244\025\313\234\274\222\214\363^\246x\025~Wv#P\374\225\025\n++\276\023u\306\252?a\242\252\001\231\220C"
+	.string	"\235\210\022O\300"
+	.string	"%N\f\200F"
+	.string	"0!H\274"
+	.string	"\377{T$NxU3'\233I.\336K\252?R%\314\216P\037m\227\251'&\241\272^aKR\021\252\006\360\355|4/\351\305\231I\271,\256%\t&)&I\227\244\263\235\006\360=\247\251$\306\207\211\321\307\0016"
+	.string	"\357px\177F<"
+	.string	"~e\304\263\020\\\2433Z\221\022\361\306G\021I\211\370\026\003&\204\033\210\251\017\361\250\241\324\324\033A\274\024\210w\361\0265%\n\352\243>\335\363\263\366"
+	.ascii	"\365=\206\312\0075\250\247\377"
+	.string	"\340*tU\007\f\004\311V\017!\\;\254\327\326\217.-/\033dH\227\017\264\307\226\027W\020.\t\216\270\332\313\b\021!\\)\277(@k\253\305V\n\025(\2302\350\341\314\003E\221!&tm\025\271\362\002\362\203\213\004\037WB\270\264\202\\\361\350*r\205\002\004\017!\262\325u\3455dH\327\225z\247\354\307\3028\374\366(\037\214\223\240\353\n\227\325i\272\361\232\203\2404\236\b\342\343\270\370\007\312\315\376\377HUu\213\021\303\347\2142\373v\212y7\213\3627WH(\367=\367\376l.\375\245\345\276t\371\366\"\346\003!\353\204\340\251a\260\313\273h\3321\342s\307\016\227\367>tO\003\262\356\331\344\230v\376\b\366\226\357\275:\252\241]\025\277:\317\246\237\031\230\337\315o-\314\367gk\211\373\316\"C\fq\257\324t\216y>\310\272\b\276\324\331\243\247\311\223\020\244CW\246\217N\033\217\372\306"
+	.ascii	"\026Ba\371\303s\345\033\013\\_)\363v\374\352\300Ya\313c\023h"
+	.ascii	"\347\303\307Uy:G'\346\323\r\227\204o\337U\376\363\304\362\270"
+	.ascii	"\365[\0300\273\347c8YL'\022M\214\3008/\007\351\002\0362/\317"
+	.ascii	"\255\333\276\251|\332GLP\237\232\2671\237kO\037\327m\337\205"
+	.ascii	"w\324\007\005\220\355\273\355\256{\3127\333\373S\214\f\230\224"
+	.ascii	"\236\362v\355[\312\233\275\265\217\321t*\243|\253\275\017\352"
+	.ascii	"=\fH6\036x\001\344f\246\3630+Y\3736H\030\\\204\013\211xu\314"
+	.ascii	"\254y6\310=8H9|Q\036E\363L\343\351\346\353\242\3031s\207\202"
+	.ascii	"\214\020\341\376\232)O/\221\023>\205-\346\033\017_\337>c\346"
+	.ascii	"\016\t=H=\026V\2674\371\332\377\237\251*2\0163"
+	.string	"#O?\371\206\362y\257\006\031\b\371D\366\365=\371\2425e\230o=?\353;\264tZ\373\326\013\363\276\266\246\215\004\337\356\274\351\343\322>M\243}\247}\237\241\265\331\367\331;\"\031\232\237\266\313\276\315\036\312P\214\214\223.{\273\347\304\357\321\034[/\360\f\022\261\3250\355T\370\326\023l\362\377\267\374&\003\364e\216\227L\n}Q\276\335\264Q\311\344=\312\373\236X\036\033\356O\276\301z\354\017\251\207\311\033\307\376\213\371\307\360\260b.Y@\362\351\276\025\236\016\031C\037\244\037\244\237\261\357e\224%\337b\205z\311\0279\225\236\030\366R\312o\260O\237b\202\n\265\362K\374\211\205\371\372\026|0\310@\235\2109\207D\354Cr\275~'j\236Q\322\231\035\022\246}\277\241\341\275 \003\261\350\202D\274\342\222\006\006\020\355;N\357\030\374&2P\013&\023\211\270\"P\213\243\375\223\340\031:o\334\341\343"
+	.ascii	"\361\270\255\017\307It\324\372\260O\333!\246\344w\341\t\322p"
+	.ascii	"\3443#\013\221\206\336\313\344\033\225<\362\333\020i\303cA\036"
+	.ascii	"bM\371+\001\203\020\250\262\220%PB\250fDDD\223$\205\346\"\f\020"
+	.ascii	"\n\003\255\204\222\335\022\340\223-\211\362,\033\032IRT\220\f"
+	.ascii	"{\007v\201\360q\240\t\030'\213\201\256~\260\311\033\271\261("
+	.ascii	"\324A_\277`\023\226\215]\005\031\0073\275\034P\n\317\237\306"
+	.ascii	"\224\262\275X\3327\315\250e1\211\325\326\250\250\300?\356x\001"
+	.ascii	"\235\270'\344\302\f\b\240\b2\032cj|\327\031\253\031SN\2201D\245"
+	.ascii	"\232\230}\360^|cH\0271\300\001\\\273\225-\267\017\254\246\220"
+	.ascii	"\232\227\037\350|a\203\354\301H\365]J\251\031\177\363\244\260"
+	.ascii	"\346\304X\032\275\230F\261\271w\200Y\272\tVu.\344P\323jXA\252"
+	.ascii	"yI\223\344\267\001\254\207\213\207\244\013^\215\242\333\232d"
+	.ascii	"\22756\337\254f3\345\303\240[\001\232"
+	.string	"\207\277h\340ztM\3108\036\2639t\365\"\247\205)\036u|c\034\016\220\277+\254 \366\022\246\3231D\233\270n\t(\335$\311&*\034\r\251\373\304\365\333\347h\021\2572\256\001Q2H\351\t3\030\353\231\315|o\334oE\224\271\032\252;\001\364\004\204\032Gv}\r5\252\"\rJ\037\263/\230\362\243\235\223\025\300\250\3677\233\377\362\033'\242\034\327\371\354\265\252\247mE\276\217Q)\355a\350\202\2508>\016\200\316\b\360\017r\350]\317\275:\351S\0359\320<\271\263\310/e4\257\274\367\303a\305\312\204\021.8g\217\276\207f\341\2510)\002q\323\263I\2548\200z\320lkH4\311\224\2778\302\364.>LAQ?\004\203$\343\003\376\303\265B}\321\223\304^\t\263n\214o\331xP\256\025\311\362/\374\317\313.\204\253\372m\242\216\002\016\243f\342\032C\231\to\224Di\357\035\300_"
+	.string	"\022\nR\231T\273\274\357\206}P\004C\343\204\237\311D\275\3100\241\206}\210\225\354Uy\214\306N(\214\367\221\003\007e!\362/T\214J\350\003\226\235\304B2\261\202\372\267\n1n\027\272\342\344}z\310p\247@\335\261-\277Q\251\361e\252\t\r \255\334\350\330\264\346\363\234\300\307\245XPe\255&\016\213\302B)u\3650\363\300\024\246\306\024\030\237\201fa\225\212\272X<\032\013\265\320j\306e\322L B\220\257S\321F\367\227\021\301!\306\344\322,\240\202V\033\237\201fa\225\212\272X<\032\013\265\320\212-\t\272\201\351\270\007:\002 \fRI\210\3039Q<Z\250s\344\346\344\007\235\220\232`\234\001\275B\304\230-\020\301\211\351\363\201\351\340\244\274~\304\376\035\002\362\350\026\"\205\355\302\260D\220\2007"
+	.string	"\220\305\2319\342\365\266\t#{\201\305<h{\371\215\317>D\330%\035\241L\323\roD\353\2440\214^\\\210J'(\345F\257"
+	.string	"\016\260\375$ ,j\277\320\217\266\264j:j\233\217\351\335\252\353\324x\023TC\244\245\344\376\354\232\242\303\206\205\330\350(\277\203\240e\254\375HF\3457\307\215@z\373\326\241\3772\222{\304\013\017\"h\r\203\003$\b*Fi\3401F\001\032\005U#5\006!B\206\303\007\b\006*\n\321"
+	.ascii	"H\200\305R\004\036\3775\327\204\\j\350\f\360\017\332\261\202"
+	.ascii	"\356\244\211\013\342\347\324\fJ\271\363v\217L\270\243\302\"\203"
+	.ascii	"E\351\360z$^\323\234\207\330\fV\3671\204\006e\210\004\006AE\320"
+	.ascii	"\275\036\263\224\223\375$\370!\\\311Xn\232j\231\342\225\024\373"
+	.ascii	"\373\251\244\372!o\266I\256\205M\370\303\213x\301&1\023\234\322"
+	.ascii	"#\016\241y\032A\036\331\353yh\236)+|\200\351J\270\204\232\202"
+	.ascii	"R!\b\342_;\254\034"
+	.string	"B\277\251\314\023\371\370\301\024\311\202U\253G49\206\361\247I\220\304(\2162 t\2144\346\237\364E\306\030o\021\212\032\332\300*X\320I\341\262\272+\300\245dKR\353?\272J\375U\245\274_q0Y\f\242~\276\314\212<\363B\322(\211Y\350<&\271V\300\224\347|\322CY\223\346\203\322w\315ba\234N1a.\310\315\372\033\025-Y\354\245\217lm\371=\240\324\013r]9\270b*\373\025\263"
+	.string	"\353`=\336O#\313\321\226\344\034*\022,\356h%~\367\2377^\024\351\374A\"H\206w\202\317N\276BV\325\354\017\211\344\3464Z*o]\266\326u\320\020\327)++@\224\227\365,\030\3047\303\374L\364\334 \026a\317I\302Q\330\227\361\354V\253\037"
+	.string	"vEU\320\002\241\251\224\306\351\240\263\260&\301\312\250\200N\320\024\315\036\257\335\006\337W;v\007s\220\037\334b`hge"
+	.ascii	"\363(\001sI6\361\332\016\361\300:\360n\333\2337\237\013\234\b"
+	.ascii	"\377t\037\242\321\247\003\251\002\375\t,E\255\005\201\177=\212"
+	.ascii	"\026\270vE3OA\333\2407f\267\200$\367\247\365\331o\020\304L\256"
+	.ascii	"O\277q\246\202\033mQ9\007\314\001\254\240D\230X5\215pI\332"
+	.text
+	.section	.gnu.lto_processServoAutotrim.137.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\r\004M\034"
+	.string	"Fs\264F\240\232Qc\376\372x\247\205a\324\300JXu\307c\366\274\277\217\342k\3430o\200\377\253\233\263\270@nOh;B\261\007(2\002\202\030\005\243\340P\003N\341u\035y9\237\341\342B~\3179m\267\335RJ\231R\231"
+	.string	"\231"
+	.string	"\240"
+	.string	"\272G\371j\334\025\215UP\3121\367\336\007\267v0\336\322~#\336\326\017\020o\357\013u\366\314:[\314I!\367U%\021U\327\275\267F\203\350t:\327W\362\026\255\356#L\264\261J\247\316\207\361\304|\277\335\307\004L9\216\016\253"
+	.ascii	"\266\236\220l~D5\007\370d\353\244\214)\312\212\354\270\035w<"
+	.ascii	"V\035(e\031\235\374\274\361#\2527\\\200\2049\324\023\030)\002"
+	.ascii	"\316z\336\321\251\315\257Wi\367\336C}\322\370\r\315\t\343\271"
+	.ascii	"\367z\372~9n\331m\037\261\r\303\246V\001\273j3\355\233\317\274"
+	.ascii	"\317\224\356&5\013\361t\304\020Lozy6\017\374\204h\247\300\315"
+	.ascii	"\373Ns\226ztg\003D| \035\0310\232Ytt\2713\215M\016M\032\264_"
+	.ascii	"/m\262g\217\272+l\232\212\323\323N\337\006\201\017.?L\356\305"
+	.ascii	"Q\252\271[\254\325\220G\275N:\251}\307\270\224?eyL!\271\367\316"
+	.ascii	"l\353\352mr\253\223\226.a\027\203$\2359?\214\361%\276\302py:"
+	.ascii	",x)g(\211pk\f\343\255\202R\347R\027\316n\027\\\035\373\244\237"
+	.ascii	"\344J\002\257tF?Cih\226\246YXe\027Jm\r\277\002a\023.)\t\357\275"
+	.ascii	";\247"
+	.string	"\252\262\241\026\220*\207?\204V\247\302\241\203\207\017\342-\214\312W\2067\313\026\237\002b\274\367V\360\243\\J\b\337\351\326.D\210\020o)=\024.+\336,\355\017\177\362\261 \231\213f\214\200\036Lw\352\003\266\210\326\324\3702S\351\207\247\361f\032\237\374\215\264~YFI\236,\r\372\267\025\0318\210\304h\223\347m\342\244\271!Woz\331w\362*\233\357d\030=\326\357\021o'%\300u\304\233\245\001`}\005\024\204~|\200r6\330\216\220\211\033\n\233\350\037 \233\350\n\023zn;7\t98\002^\334J\250\310 3\t\234 \\\213\334-\250&\364\343\003\204\302DM\005PO\212\032\211\\P\r\347\200q+n\271\232\020\016\227\253\315H\336\353i\323\250\225\264\205G\207\246\35760\317n~\2154x\233\250\345\346\313\231C\3755\264\2000\032\264\013$;\243\026Ll\322\020+=\371\231W\217"
+	.ascii	"@\254,\271\361V\206\265$K\262\367\225\270\300\306\025+\2762\255"
+	.ascii	"G\336_\221O\214\2670\250%\336\005,L\327~1\361\360f\232\323'\340"
+	.ascii	"\023/\342\214>\3524\b\001S\250Q0\304\224Q\214\314L0\"B\332\244"
+	.ascii	"\r`\002)d\306\016\021\360)f\322\244X\177\003\304\202&\354\321"
+	.ascii	"Ui\222p\237\303\030D,[\347\344\351\366\237\244\027\016\204K'"
+	.ascii	"\367\020\333vJOL\260\230v\275\1778a\027Q\027lKW\230\016\225~"
+	.ascii	"\231d\367$\272\271A\373\223,Z\322E\260j\250\002\205\370A\216"
+	.ascii	"\205\022\254)'@\270\371\341\255\237@\024\342\2276SKyk\334\261"
+	.ascii	"\222&9~\261B\001\311V\020jM+0\304\243N\024\354\005\244CV\330"
+	.ascii	"?r\377\310\034\313g\356\224\352\302u\255\334\317\234\213\337"
+	.ascii	"\364\252?\274~$\223x\026O4\272\201\341\017"
+	.text
+	.section	.gnu.lto_isServoOutputEnabled.138.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\001"
+	.string	"\025\007"
+	.string	"\022\21625@o\222\016\200\3640p\344\346\031c\214h\016\0269\322\261T\302\373\273\205.f\377\233\336,\273\242\020~\321<\3160LL\260?\205\324\221\312\177\316X[\333D\246c.\032F\221e\264\267yp\320@4<\t\rC\304\303d\332\273\f\214Md\262\267\301\260\354][\266J<!\026\20004B\213\210\025\241B.\365\r\251\310&\227c\316(\327Q\255;\n\240VQ`\303\004r\251/\213t,\277}\034^|\253\314\314\361\364\273\321\271[\021x\244pH2I\251\226D\261J:\376\316_'(t\366t\323 \265\303$\032Q\311\334\036f\324S\347\271\005i\365\261r2*}\352\002\0262s7*Ut\354o\360\037\374\030\001\007"
+	.ascii	"2\241U\037\b\004L8s\215^B\344p\347L\355|\002"
+	.text
+	.section	.gnu.lto_setServoOutputEnabled.139.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`6"
+	.string	"\225\b"
+	.string	"&\320<:0%'\035\036\266O-\025JG\233\325\037\210\307f\222\206\205\316a\f\262\264K`\333P\013\023\032"
+	.string	"\024vWC[\001%\005)\003\247\032z\b\243\347\343\204r\215A\310\226)\005)"
+	.string	","
+	.string	"+"
+	.string	"\307\374\3312\237$\373\224\020\223\312fwe\034\371w\375\374\237\234"
+	.string	"<\221\256\002\024\273k\005O\037w\274m\005\333\025\266Q\002\2776\242\354\207\277\252\372\030\202\n\314\250f\327\243\005`Y\030\213\211\355s\354\004\020\251j?D|\0179\fN3C\227\335\311\340\205\201\026+\254R\354\360\243\237\372t\213_\342\221Wz\360\230\357U\300\261\2033\3611\252L\001J\332\262\276\244bVo\354I\322(b\007\236p\3206\211\255\001\"+\370h!\317\345N\346q\033\335\346I\321\305\007\024\362\310\f\220\206!;\235'\263\003s\032['E\034\327I\316\334_\033Q\001\n"
+	.ascii	"\226Ie&\236\362\2439d\216xi\302\2051~\260\344\245&\203\273\274"
+	.ascii	"h'\031"
+	.text
+	.section	.gnu.lto_isMixerUsingServos.140.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`"
+	.string	""
+	.string	"\r\007"
+	.string	"\242\31515Po\322\001\200\233j\326\240-\021\016\017\306*\360\340\017\027\206eX*[\335\032j\021g\324\226\231"
+	.string	"\342[\023\231\231#\256\376\357\255\024\204\006\245\262\204\020)S\n\316`\2607\0015\230\34340l\034\026\034\304F\341\301e \3460\001~\021\032\3508\357Aw\305\275\226T\t@\032\262/`]U/\"\t\345f\037\344!\022~\207):y\355\225\337\261^]\0016.@\271\371\302\330d\261\343'\325d\237Z-\331Nk\246O\r\224\240T\230\354\216\266\226=\251FN\266=\366\345\003\004\217\263G\215\321O\034\"\021\225\335\3504\343\3313\363\377q\312c%E#}\236\227\204\335uj$\213[o\273\300\266\201mS\b"
+	.ascii	"2\001?8\343\001/@\327\360\307\b\267\204 \341\316\231\332\371"
+	.ascii	"\004"
+	.text
+	.section	.gnu.lto__reset_template_73.6.142.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375 4\241\001"
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\030\001\177\005\001\006\035\001"
+	.string	"\005\001\006\031\001"
+	.string	"?\202\210\200(\177}\274\001{\274\001y\275\001w\274\001u\273\001"
+	.text
+	.section	.gnu.lto_getServoCount.part.0.182.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\273"
+	.string	"\225\n"
+	.string	"\226\024G>0\213(\035\203\027\317\210\210\b\276h]{\374\362D\363\225\313\336\357\276\256go\322\346\377\367\331\017\013\324\310\030D\232\007\374v\021\t\035\312D\030\310C$\037\206U~[P$d\357$S\n7"
+	.string	"2"
+	.string	"6"
+	.string	"\020\020\210|J\201(d\2101b\206\022\246X\206\317\020\226\341\017\230\363\363qu\206D"
+	.string	"|w\206\243\004\030B\"\002\316\211\337e\2111\326a\344B\267\275hK\321\032#1\306\336\324>{=k=\0133\373\236\375\263\231Y?L,T1\nX\251\242\001haA\353\216\323J\352\216k%\206\0178\003\332\326);\340\332\013/\277u\177\030\274\303\t!\357\023(R\205\363\277?\005<\317\033\264\241\216`\t[\255\240\"\233t\310\260\336X\206>\005E\352\344\252\356\374\032\224bj\310\237\372\347\027\003\275T\266lD\303l\230\206c#\323\241\201}d2<\260\213\266a\225\210f \030\r\323d\231\206I\332\246o\232\244\365\353\001\332^\257\245sO\377\237\332\276\n\361\245\302\007\025"
+	.string	"Cg\254X\bAf.\b\034`\001\355V\205z\247!\247\254d(["
+	.ascii	"y`D\271\004\2343v\347\035h\f\247\213\351\271 RXh\266\364\204"
+	.ascii	"2\006"
+	.text
+	.section	.gnu.lto_processServoAutotrim.part.0.196.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\022\021eI"
+	.string	"jr\024\031@@dN:KI\b\310\274h1%_p\316(\203\247\377\247+g\223\312\346e\020\222\207V+R}\375\357\023\330\001;\024v\250\260%\007l\254\271\3526w\373\3649\320\376\266f\304\022B\366N2x\001p\001{\001uk\352\372(\335\350\370\030\351\202\274s\017\332\036\265\307\311}\256\211\r\367V\326\214K\320\004\371\270\267\365\341\236\307I\036<\355\224\322Z\312ZZ\016\305Y\261W\023\204\301\275\265\363\331+\177I\230\264\034\354\355\034\271\234~\235\343W\03659\347\2534\323\311)\032\240?7\177\f\326 \361=\235#\237\323N\021Y\351\345"
+	.ascii	"\257M\362&\302\325\026\301\266\375M\337\355\252\245\264\326r"
+	.ascii	"\027\027\202@\344\333\336\354\263%\310\310\356\263\365\327\016"
+	.ascii	"'\3718\355d\261\270\330<pW\372r\316\017\256\266\003\366\252\324"
+	.ascii	"\241\326\253\351\235\326\253}\265#\301~\363\252\233\330o&\273"
+	.ascii	"\211W\337\246"
+	.string	"\273\257\270\272\223\335\210\276f\226\177\247\335r\373\3139O]\305]Vb\247O\327\336\3074\371'\247&\246\245\243Q\251H\034\n\331\340\252\246\370B%\373A*\004\177\217\226]X\177rJ\035\364\3119\202\202\002f\371\346\227\333\304\204\366%3\274\261{\344\342\205\345F,WB\273r\213\217rY\201V\271D.^b\037\006\251\240/\221\246\246\210\351%v\341\331\0012\\a\227=\300\364\002{0-\352\225\251b\354\332J-\204\275\351\335\r\311]\203Tc\276\256\262_O\243\\h\251T\363\227I\227\326\305^\300\206]Y\353R\316\371L.\264\3646\035*H\225s\356+\323\336Q\357~\234\356\346\322}\034\013\253\023\326,s=\345\255\264*}\227I\177\254\373.\35727\220Br'u\337\255\253\304F\037\255q\344\270_\346X\257\036\013\301\224\267\355\342\263L4\337\300\213\313\032C=\315xK7{\273"
+	.string	"{\233\300"
+	.string	"\341m\001\370v"
+	.string	"|\033"
+	.string	"\276\035\365\350\033\212\275\375\304\336vbo71\341\333K\370\366Qx\333\210o+\375\371.\342\333D|{\310\336\026\262\267Y\366vp\025\336V\337\366N\331\333\230\275}\203\267_\001@\002?9Ci#e2u.\314\333~\271?\356\177\376v\277\237?\372#\372\017\375~\277\244?\322\221X\035i+&\002\274\033`\315\314\213Ky\325A\250\262\224 I\337\264\326\036\334|\261\206t\020\254\004\211R\213\205\254\265\251\253\275\306\036\273\337\217$\351\223\002!\331\001\376\245)h\202|\244\373\365\001\037\250\300I $;2\366\252\2020\300\277/i-\230#F\375F*\225\266\274\017w\332>\277E\212Z\344\375\024)\310\212\356\300\265}\207\020=Q\023\373\212o\257\216 \344\017=\332\347\273\241<C\205"
+	.ascii	"\343\272\024\361\355\221I[r\367AC.\250\257\027\344\243\367\227"
+	.ascii	"w%oH\224\rQ\274@\t\364 \037\r\324'\320\034\334[\337\335\220n"
+	.ascii	"\342\363~\372v\377S\327\207\216\217\023\272GJ\2303\363\215\032"
+	.ascii	"\344\237w\366\351\036i#f\324\263%\342\346\227~\377\207u\210\211"
+	.ascii	"l\2068\302\031X\340]\316Y\210\313\256\225\013\257\330Y,T\303"
+	.ascii	"\002v\335\370|\304\342\262>\032\003u\267\3145\363\341L2M\232"
+	.ascii	"\365j\004B\214\242\236tA\334W\314\035\223\\\223l\223l&\233vK"
+	.ascii	"?\251\333\335"
+	.string	"\301\303\3752\210/F\226\205\261\372\315\377\353\351\f\342\262.RE]q\220/\275L:\305M\330\020\333,\305}\030H6l2\337\316\365r\017B\311\224s\007\001\310\314 \2560\251\224W\255m\037\255+~\033\204\247x\305O2\206\005=\333<\370\331\007\b\204\272\\\263\020#J\224X\257f0cT\340\251\026Uq\227\231\210`\326W\313\335r\002\205\n\025\353\325U\322\322\257Y\334,-\260\231\231\277179ka\020r\311\\\\\003pZ6,nr\316\032\256\366\035\273X^\364\321\2566\214\030V\353U\025\177\317\331\033\345\351\374n'\346\351\271\003\354S\3329\211@f\256\363&\2679\223\232HZ\224o`\247\370t.\245\274\201}\267\337\312\263\371\266m\035\251\275\226sN[\306\212\361\311\260\361i]H\235^\306z1\306\337\002\313\272m\367\r\273Ud\314\250\252Z\257^\274\340\354\351\231\346:\371"
+	.string	"3wXWR\343\037\343\262\376\352K\345N!\344\3257\312\273\372.\263\2236b\236\364\205\322\210\330\234\261>\326\267\021\030\200\324\250\322\021c\315p\001Y\301\302\004 5\252t\304X)\374\210\021\354\0338b\254\255\201\202\214*\fU\023,Hh\"RE\203\307\210a\317\220`\325C\310\217*\253) 7l\340\320Qc\212\007\016\031;\246f\374\260\232\222@\240{\370\250\3721\005\244G\217\037S\304\247\307[\330?W\356\2248\253\357\362M\225>\341\333X\377\020\350\363%\nJ\027\315\016\306\374Hq*\260G"
+	.string	"\027\200\022\300\013\366\240\316)7B\345\232\236\324A\32705\270\335\3110\3111\367\313\226*"
+	.string	"\035\023\375\342\263\300\n\024\313\322\3238"
+	.string	"\013\275(\335\264CA\341&|z\210Q\234\210\036\\D\246L\364\020] \3160\243O\324\266\200\307\001\370Q(<@\017\032\026\025\200\367\2308\202\306L\306\360Az\\\244\002\344\356\\\2205"
+	.string	"\026\200\003\344mM\312\373\361.lT\0277\350)\304\364\356\244\267\005\205\237w)"
+	.string	"8\n\007\300O\302&\017"
+	.ascii	"\374\274=\260\025\027\356-\n\237\356l\016\357\037\203\212]\255"
+	.ascii	"m\001\215\023r\316JxK\037\343\236\\\263>\341G\331\3768\341&\374"
+	.ascii	"\204\237DL\035'\274`\017\254\t\007\201R)\016\231p\220Ox\323^"
+	.ascii	"\304L\032\355E|\350\227\337\317\365\362\333\375\201\026\361\237"
+	.ascii	"\030P\333\372\021\231\360\237E\314\324F\261\034\267#V\302Kxm"
+	.ascii	"d\304G\374\255Il&\3308'\222eT\0301\207\263\032w\355\003\253\246"
+	.ascii	"\204!\354\315A\273\242\271m[\277!.K\273\202>\201\221\250q@\306"
+	.ascii	"\030bFDDD$I\222t\201\005\304 \346\240;\017\021\360$t\020\215"
+	.ascii	"\214\210H\222\202\244\320f\344\216]\030\304\350\352X\022\375"
+	.ascii	"\253=\201\264M:\276W\334\344\247\206zqT\t\240\2124\207\206\024"
+	.ascii	"9\273\321\363\322\n\372\336X\314\365{c7\310c\222\335\021\031"
+	.ascii	"\334\220\306A8-\322\200\247\370\343\230\337T6/\350\240`\031"
+	.string	"z#E\213&\355\311\317\2766\277\354-\276\"\261y!\377d>\004\213\302\331F\007~\033\272X\263\030\236\037\007\233S\242\207\023}\006\222\005\233\232H\317\314\315z-\006\022T(\313Q@-\030\275{qP\025\372\326r:\340\323?\244TrExT\026\242\263A%^\\\265\321\253\351uw\360\253%`\026t\326\340\216\274\255\225\253\203\373.gG\032\335\362ndcP\303\005n\335\005\274\204\356\331\211U\352\3258\365\252\233[\352p\347\214\361\311\205St\373\276\3617\021\305\275\333\0357$i\355\260l%W\177o/\013L\315\236\032\305\344\207\330M\354+\3434Y\233N\357\245:\352p\242TBD\345\234?:\313\342D\270a\250\321\007\023\034\025C\250\247Z\340\223b2\205N\317\275\225\nLc\343\350\256ls>\315.\221X\303fp\217\340Ur\333\331\234$\232\330\016\350v\217%\036F\341\236T1"
+	.ascii	"\025j\023Q\244\357Wq\214d]\020wP"
+	.string	"n\272\204\320\027\371<r%\325\250\367\274\021E\033W\245\373\306s\023\202\361\221s"
+	.string	"m=\274\237\"\370\211uYmBV\350\r\357\035\352A\324\276\214\376\246A9V\247\226\350\254\351\375\245YY)\201n\026$\272\024\352\013\316\306?\241i\352M\t\323?B\367S\321N\002E\367\211\246\350^O?p\262\376 \225\2232\274\203vpr\204\263\004\023\340\315\242(\340Zh=\007\023\355Z|:\322/t\273\264\336\266\002\212\367\343\213\022+\262\235J\306\315\2620\260\243G\3354C\027\373i?P\334\217\260\246z"
+	.string	"\342\207'=\272\321\222\004\340C\332\246\206\275\223\252\201\031u\212\315\001]\001\240\t\251dRH\227\357\324\273\223\017\224\241\257\265\211\243w\374=}5\251\023\371\252P\265'\373\253\204B\313\240U\256\036\376\252\300\212\022?\327\005\017\310\223o\262\360U<\303\243\340=\360M=\301\365\360w\347\364q9\240\211P\363\342\222\021F\302\347#\0307LJ\371\266\016\371A\0378B\304+\324\224I\3722\2727\313\032\335#e\275H\247\332"
+	.ascii	"\245\234\203h\\\307s'\024\201\372\300<8\337\007QX\314\251\021"
+	.ascii	"\3651w\235\350k\334\231j\360/\370\351\333P\320\021\377>\3444"
+	.ascii	"\001\261E\214\002\021&<E\254d\0060\236iH\032"
+	.text
+	.section	.gnu.lto_.symbol_nodes.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\211\006\335\031"
+	.string	"vi\231HpZN:+S\325\263\260\337#\226\211\230\360\221\0369\263\2355\315\225\240v\f3\322W6\210\r\013p\205j\306\216w{T\t\355E\375\037\006\200\001`!\375\237\371W\314F\325\006\220)\333\035\340Q\301\207$Z\222$\003\204"
+	.string	"\211"
+	.string	"\202"
+	.ascii	"\021\356\301 \260\036\372\340~u\300}(\324}\321"
+	.string	"\350\326\340^\306\311\340J\320F>}\rm\244\323\325\232\236\306t\036KG\262\340~y*\261\232$^\2032\263\001\265X\024k\273QUUE\272g;9y\304vF\234'd6RE\367\201*\3406('\023\260\034\312\314?\265X4\266\021\335\3238\233\371+\362\347;\320\235\244\0272\b.3\317b\234\033\363e\306b|P\230\322x\340r\232\223\231q\300\002I\254\356\305\252\356\177P\335\217M\335\003\221\272\017rf>U\243\312\034\354\213\272\017{\n\236C\301t(\363\324\327\224\325\327\225\327\t\2563\301fJ\360\031\224\004\337\241\3140\210_^X\303+b\324\260\213\277\302\215`4\250\210{\035!\356s\200\270\307q~\270\277\341\341j\207\243q\370\331\206\227i\370\0204\303\205`\270\267q^8Y\222\032\037\323\302}\215\263\221\025\230\217\002\357M\270\237!\201\313\240\005\270\211\016\321\251q\001\255s\024"
+	.ascii	"\3248J\037\240\356i\337\\\306\372\236\024\371\364oe\362"
+	.string	"\351\027\177\346\364\364N{FV\255\347/\252\252*\001\233\310\236\b\330.\226\0372\353\"\266\004\354\240\366\r\346N\212\235\260\233\2075\352\346Y\177\346\236Y\363\250;\007\251\033\207=7\337\262\274%u\377\3307s\312\031Y\321\273\353\236\b\327}\221\255{#-\356\217,\356\315\264\356\331\254\373#X\367=V\334\033\207\367LT\334/\271\272\017\374;\376\004\n\365\333\337\260R\250O9\026O\230\366\373\326\363\336\230\2625Ni?\217\375\361\256\264\355=\245\375:v\256\225c\303\264T\330(\255\033\313\326Ba\235\264M\330\2656\215Ek\177dc\264\310\264_\260^m2m\342R\2316\327\222\213\335b\267V\2555\253\035\266\303%WI\233*\270\376\020X\366\fX\205i\353\264o4-MF\246\255\303\036\200\336\0268^\246\035`\207\375\305\324)\2554\005\033\252\203\001u\250!\f\217\202Hd\202H\322\224\036"
+	.string	"\003\241!j\016\021p\034\b\031\203\002\221@$\220\200$\310\003>\330\005H\357\253\320`)\213e\333\266m\333\266\215u0\374\024\267\337\007\247=A\272wz\374\032\331\366\200}p\313\226\343\026\2266\310o?\332.\242\210\2323-\221&\220|\217\024\030\237\372$i*M6>\366\274\356{\335\367\272\357u\337\0137\317\207B\211V\002l\034x\025\"9\021\rq|\004\rQ\230#\013\334\264.\f/\304"
+	.string	"\034c~\f\027\270\032)%\201\361\202\306lS\211=emB\013P.e\234\355\376H\231\241\005\265bF\355w"
+	.ascii	"\266\213\236\305y\344\330\005\032\016B/I;L\320&\252\2708\310"
+	.ascii	"O\004\250\317\275\334\270\027\243\002"
+	.text
+	.section	.gnu.lto_.refs.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\030\001\275\013"
+	.string	"\306\035V> O\233t\210\005h\360\020\f"
+	.string	"\245/\036\342D\016PS\"\220\020\n\301        @3\210\370xbL\036p}\373\361\177\273\337\261c\007\032\0322\372\266\210\bQ\223\266e\n?"
+	.string	"B"
+	.string	"E"
+	.string	"\033\326{\250\357\304\316\261\372\306\322\253\252S\225\036\341G\250\3178\345:\232>\245'\271\202\327\023\274G"
+	.string	"\377\003\177{]#\311\265\367Y\324\251\367\223$\207\356_\344\243\350\323\r\305af\373y\t{\244\316\221>3\365\214\3511\314W\230\177Y\036\221\272\233zb\315\210'6F\327\\=\203o\271:\005\276\004~\021=\212\022\324?BD\354\203\200}\017\326\337\241\3725X\376@\325C\336\203T\337a\365\r\361\372,\004\374'H\004\3709\270?\003\347\265\315_\235\267:_\351<e\373\311\366\222\355!\316\032\333\037\322k\336_\246\247\270\237P\3776k\"_d\272\245\365\n\366\321+"
+	.string	"w\b\326?\330{d9\007&\003\177$H\272\374@M\003\211I\017\350\354H\230\034\320\231y\243CZ\013\364\324&\3205b\267`\267T^\212\017p\347\207\r\030.X\250@a\202\204\b\327'\204\367\371"
+	.ascii	"~:\300>\033\274\236\f\262\317\005\357\333\302\223w\205\212\024"
+	.ascii	"&\262\017\017\004\0012\005\345d2\236\002.(\006\244\345\206g\001"
+	.ascii	"\002.\260h(\262\245|P\244"
+	.text
+	.section	.gnu.lto_.decls.fae46121b84a2488,"e",@progbits
+	.string	"(\265/\375`\277D\2354\001\312\027\372sT JQ9\351[<]\206c(\236\242?Vt\277~\374\263\305;\007\377@\034\211\217\374G\323\370\304S\363\307\367\316K\204L'w\241\022\343\032\204\210\221\003m\333&IS\3246i\212\232V\324u\314WZ\306\377Q;\236!\362\275\003\024\325\255\t\331[\356\024)\006%\007c\007^\204tW\177Y\345X\017\027\252\276;4\037w\306\304\364\250mBSD\271\212\n\317X\316\371\177\027\351!M\244\203\324e\013\351\037\255\314\337\240\2054Wm\023\232Rfd\317\227\235\032y#\214FT"
+	.ascii	"'\312\321\347v\262\201\324\245Q{\305Q\325\360\321\367\226\r\217"
+	.ascii	" W\243\363\177\325\350\274U\303\267Y\360\255\025|+\005\3372\301"
+	.ascii	"\177\363\330\272y\242P\271\321\367o\035\357\255\277w\264Vm\253"
+	.ascii	"C<t\204\365\355\\\213N\0175\303\3319\220\336:N?;2\226}\207p\330"
+	.ascii	"*.$p\372\376\357\032-\243\221M\243\261\332Fg\365\214\272\354"
+	.ascii	"\033}\365\206\3211n4\345\330.\204\2009{\371\215\265U\273\020"
+	.ascii	"\252R\202\310S\355\372F\265S\363T8-e\266\321\223\005F\256f\006"
+	.ascii	"\370\213\363W\273\276Q\357j\236\275\202\fAN\306\235_\375\253"
+	.ascii	"t\025N+[\271+\036yd9+\277A\337\350\027\225N\350\250\314X'\372"
+	.ascii	"x\344\361\365\215:\247\362\tU)s\226\317W\f\036y|9g\243\021\246"
+	.ascii	"\035*o\202`\270\255\254E\247\210\232\341\274\265\201o\255\360"
+	.ascii	"\273\016\356\251\246\252K\021]\245\034\002\266\321\343Z\366}"
+	.ascii	"\333\341W\021\347\220\210\363\235\006\277\323\360{\n\376\\-:"
+	.ascii	"\353\235\212\247.o\246\366]9$D\247\305nI\337\367\022\374z3\347"
+	.ascii	"\b\352\315\234o/\\\367*\235\272<[\255\363\252W\305\034X\245\314"
+	.ascii	"e9\347\241!2{]j}\337:0\213\234s\256g;{\376\376\376\376\352\331"
+	.ascii	"\316w\025\2765\303Y\363\376*\247\306yZ''\3504x?\370\372\326/"
+	.ascii	"H\257x\031N\244\2262/s\316CVm\214U_\337W<\030\250f8\211j\206"
+	.ascii	"\363ppD\004\331iCE\366\206N\312\230\257e\337J\327u\256\326\275"
+	.ascii	"\322U7?\201\342@U\225\356\346<U\353\007\241Z?\230laSY\316\373"
+	.ascii	"\272\207\377\332F\016\bIFy\327\367\033\230\2211\345\f\353\257"
+	.ascii	"j\352\232\032W\323T\270\312\246.\253\\=\363\212\246\276\275\225"
+	.ascii	"9W\345\234_\275\244\325\310r\002E\225\253e\325\314*\307z\270"
+	.ascii	"\b\321Bs\253a\254R\r\277\3202\343.g\345\253\230\037\351U\256"
+	.ascii	"\262\3256\253T\313UTk\001\370:\203&\205/"
+	.string	"\347<b\204\321\210\021#F\004\325Q\323k#t\257V\213N\237\232\341|\265\202_[\300\257@p\035S\311\324\345\206Z&\017\325\274\"TY}_\267\260\br\256\033\316\372\367W7\234\257V\330C-:\253Z\005S\227!\352\332\353\227\212vsJ\231\2259+\207\372H\236.Y\372>\004\3705\304i\377\376j\210\363M\230\250\026\235]3\234&j\321y\013\340\252\245n\251\313\016\265\213r(\310\017\212\037\236\276/\001\003%\275r9\005S\031\3057\340\327\016g\375\253\035\316\367\340/k\321\371W,\033\262\362B\317\0230]C\372\376\365\312_\245\324)Ui\257f$\3632_)/\324*1/X\372\326*\325\312\253\262R\371\t\024\267G,yJ\316\271*9H\346<U\225C}9O\r\325\372\241\326\0177\312\227\230\331y\337\370\312Zt\342\232\341\374\233I+\251k\226\304_\277\354\210\277\305\254"
+	.string	"Nl\360\006\003 VD\035ak\034\211\337j\371\353[=\343\206\177\333\344\257* PK\260\035\372\207\303\347n\006HT\340o`_\t\374\025\003\024\033\254\210\277\"\261\265\016\340\377\\\233\003\340\267Y0H\n\361\333"
+	.string	"\364\027\013\342\2578\376\016\200\375\360W\022\376:\302_\037"
+	.ascii	"\306z\370\253\212\277\202\370\353\bj\324\337h\254\005\1775\376"
+	.ascii	"\225\305_\213\177W`+\370[\315_y\330\016\177\263\261\034,\005"
+	.ascii	"\030h6\013\200\277\351\376\256\253\302\277)\b\376\275\341Z\r"
+	.ascii	"\237\300\032\331\237\246\377$\274\351\277$\376z&\213-z;\\\275"
+	.ascii	"V\303_1\320D6\303_\221\330\232\301C\314\375\303\177)\370\333"
+	.ascii	"\206\305\220A\373\260\027\202X\242Fb\207\376\212\366\3274+\364"
+	.ascii	"W\242.\033\364\327$ob\317\200\005\372\237\301\377\020\377\347"
+	.ascii	"\376\023\277\315\300\337s\352\003~\373\363W\b\214\240\312_\363"
+	.ascii	"\321\372\274M\031Y\340)\370o\317_\313X\373\277Km[\362W<\266;"
+	.ascii	"\351\257Hl\335\300\341\177\227c\370\357\320_\223\376\032\200"
+	.ascii	"\277\036\340\257\n\360\253\030\3745\203\277r\211i:\177\035q\243"
+	.ascii	"\337\376]^\364[;\377Q\340\373\375-\336\337w\376\266\363_\211"
+	.ascii	"\342\374m\nltzo\311\337s\376Z\302_'`\367\037\003\007\376vC\233"
+	.ascii	"\365\250\242\343p\371\017\367_\356\277\232\377o\377\323\374_"
+	.ascii	"\363\267\007\376\367\374\227\315\337%\374M\201\277S\370\373\204"
+	.ascii	"\277'\3607\n\177[\340\257bp\376N\300\337\022\370\233\2047\377"
+	.ascii	"\207\376\273\367w\335\337m\376\216\373\373\355\3571\177\257\375"
+	.ascii	"\215\366w\331\337V\376f\362\267\222\277\307"
+	.string	"\376\016\373\233\310\337B\376\346\372\373\306\3374\376\006\301\337\037\370\273\3707\372\367\322\337\031\370\373\002\177k\3607\211\277C\374U\315\337\027\374\375\341o\013\376\246\340\357\r\177O\360w\321\337\027\376\016\372\373\347o\340\337=\177\233\177\333\277\353_\333\376\352\367\327\276\277\362\375u\316_\361\376j\367\3277\177\235\373k\233\277\306\375\365\355\257g\376\352\366W\266\277\256\375U\355\257K\376\232\344\257b\177\r\373\353\214\277\032\371\217\302_\027\360W\016\376\372\365\327\023\177E\372+\220\277\n\340\177\231\277\032\375\265\353\257\\\177\365\361\327\373W\036\377I\370\353\216\277\346\370k\215\277N\375\237\373\337\345\257\307\277~\340\257-\376\332\201\277r\340\257N\177U\341\257\032\370\353\004\376\372\301\177\025\177E\361\327\r\376\237\360W\r\376J\342\257#\376\272\341\257\031\376\277\371_\367\237\315\377+\377\225\377=\360\337\314\177\t\376\376\376\376~\340"
+	.ascii	"\376\0376\277\211\037\001\030\304Y\322\355\035\236\r\202\217"
+	.ascii	"H|\026\026\343\356g\016\376\317\032\fB.\3516\216\215\263v\275"
+	.ascii	"\344\346%Q\316a4\306\302\340\377(1\b2I\267u6\316\276\351\255"
+	.ascii	"\005\300@\002\243\374i\001\377\207\007.\312I\267s\257K;\327."
+	.ascii	"DHN\331\270 \t\336\2239|9\227!\021\024E\314\305\214\276\367\261"
+	.ascii	"\303 \254$Y\271j\331\304\3316\326\013\037\221x-\f\306\335\032"
+	.ascii	"|\2372\370\325z\235p6\016\316\206\235 \230\250\261qjl\030\336"
+	.ascii	"`\345\316\314\363\222&\255\357}\262\340\373\020\301\035\272\222"
+	.ascii	"n\337\336\252Y%\312Trnc[\270\203\221\244\3333g\252\231Q>\346"
+	.ascii	"y\2202\346#\003\237\214u#c\3332\310\271*\223X\310\254\205\024"
+	.ascii	"\221\301X\031\353V\306\266\211p\324@f\254\323X\305\315\365mc"
+	.ascii	"\273M\352\250$\351{`\036|\340\034\346\340%\351VL]Z1\226\255\275"
+	.ascii	"2\216\373\n\303C\216\354@b\331\232\200mU\275\365=P\rs\200\223"
+	.ascii	"t\273\266\264k\275\205\001\031\302\327\331]Fj\221\b\342j\243"
+	.ascii	"v\326\367@3\334AK\322m\223\272\264M\254\032\002\244\250Y\265"
+	.ascii	"\337:\261O"
+	.ascii	"lZ\317\241\3035\327\027\r\1771\362\365\244\357\201R\360\353\224"
+	.ascii	"\037\211\212\331]\265\213\322Cm\n\224*gHS\314zG\226\267\263;"
+	.ascii	"+N\314\356r\316dul\314\331]\316Y\312\323\204\2009\227\221\242"
+	.ascii	"\226\273X.\366\314z\261[\254\231\375b\313\354\262.\255\026\253"
+	.ascii	"\274\275b\261\374j\261U\236V\341\226\371\007F\022O\037Y\316\371"
+	.ascii	"GK\355jN\303=\220\fw\262\026\235\027\200\341\003\207\340\003"
+	.ascii	"\277\360\201I| \027>\220\007>p\007>\020\007>0\013_p\201.0\005"
+	.ascii	"q\222n\227\274.\355\022\2334\302\222\217=r5\264H\220\260\372"
+	.ascii	"\321\326\367\300\214;\250%\335&\371O\240\250K\233\244\322\031"
+	.ascii	"\345#\236\t)pJ\022\307r0\007\027I\267b\257K+f\271\354U\316Y\001"
+	.ascii	"\220\203\324\"q\342\2602g\316\031\214\301\032$HlX>\342q\200\227"
+	.ascii	"\221\"\376\357\335\206\231qLZ0\353{\234\206C\344\020\"\304\032"
+	.ascii	"\321J\312\"v\367S$\354\206\034\260[#\035\267\205\325V\344?P\310"
+	.ascii	"\306\017\032wE\210\b\331\261M\325\001\3030\272te\r\351\037BQ"
+	.ascii	"\304\304\\\364=\206b\277\230\204p\021\323\367x\f[ AF\316P\301"
+	.ascii	"\365=\356\201m\027\020\\2\006\226\276\3078\224Bw\344\260\352"
+	.ascii	"\364\265>l&cc\246\357\261\225\345\001L\362\3102\325\367=~\330"
+	.ascii	"nq\360K\272\335Q\227v\207=\002\257r\266\301\001\024$\222\304"
+	.ascii	"{\340\340\337\352\310\241wg\f\230\2768\360 \301\242\321\367="
+	.ascii	"n\370\277\265Q\227\366\206E*\363q\314\336\260YOCr\262\271\303"
+	.ascii	"\323g\223\\\231\001v\357{\310\360{\206\340\020uI\025J\265U\267"
+	.ascii	"4l\215\006\203\263\232\tr[w\031\211\203\304{n\340\020]"
+	.string	"\222\254\013ku\373\342/\354\f\234s>*3\226Q\022\270:o|YKK\004\320o\007\362\210\214\333\031\267\003\312\034N8@h\224\351\373=\033\343?\320\007-\313\031_\f\030-\360\351\210\242\3261\232\3605\251K{\325\\\224\331\350\242ae\260\276?\315\340\377\365\375\237\331\206\251\314jT@\347__\315W\021\177P\265\025\304\377\233\363;\244\220\363\021\316\\\316\271\3169\335\274v\314\361\220s>&\221\027\256r\316Y\351\225u\341\252\314\013yU\345\265\243^\225ye]\225y\035\373\352\314T\0262{\035qNf\345\252\234\361\325T\316e\311\254\013WU9\353\252,#\177\224^9+\275\216X9\205\3149O\325+\245W\362\252\312+\353\302U\225WV.\363\312\252We\031\231\2532\022\303U\316Y\271\314\013\257^e/\344UY2\353B\256\202r\347\212\216\216\254\232\246\306\205K\315UU\256\001"
+	.ascii	"\262\252$\022\356J\231\254j9\037\227V\031Y\2259{\345\354#\371"
+	.ascii	"A\255\252\205\243\032\025\\\215\036\255*e\3169\037\267hP}%\201"
+	.ascii	"J\252\fw\305$\351d\225\363\\\246\301\301\261\036\2259\347\027"
+	.ascii	"\231\352Xs\266R\"s\246Jn@+\347\234\223u\315\013d\016\312US3\250"
+	.ascii	"\276\222@VT\311\027\231\t\220\232s\316YWe_I$0[\312\3062\225\362"
+	.ascii	"X\257f$\363X\236\363B\342\262\2432_\345\234\253^P\03546|}\177"
+	.ascii	"\002\301\277\245\312I\277$u\372\376v\312\036\177\376\300\300"
+	.ascii	"`\311s{\374\333\257\377l\266uM\316\3040\022J\342\242\206__ e"
+	.ascii	"\037\322;OP\031\"w}-\300c\364\246\017\315\333\035\276\037\263"
+	.ascii	"1=\264\276qZOh\212(\347\026\276\330\351:u\331|o\276\336k:\025"
+	.ascii	"\256\310\215be\303\210k\306\367\345"
+	.string	"v\336\246\363\036\033b\256\254\365\375\311\205_\321\344\234\345\365\234\306\253\313\326\273\030\273\332&d\346\234\364\242\327w>`\311<-\276\021\305*B\360\340{\363\017\337\264\203o\356\341\233v\370o8!\252\302\234MyS\007$\343\306\214W\337\377G\342\241\301\371\242\233\35325i\326\372\366\334\337m\332Mm\253@^\342\322\270\372\336d-:_V3\234\275\006\351\315\306\254\253\323\223\353\373A.n\005-\255*};\256\255&s^j!\343\321\267\341\220\336j\020p$H\224\2766\315\033\320\023=\031vm}\246\321\264\231v\253\313~\3532l\225\316*\307z\266|\211AR\263\033C\226s>\21212\356\336\232L\177U8\255|\3043\221$i7\206\317\313[\207\251a*\\\221<u\364 \t\234\335\030\276\234\225>_\252\376\314\200\356M-\370f\013\370&\020|S\013\337t\201\177\351\360\337k`\310"
+	.ascii	"\311A\246\257\232\262*\347l\204\355\236t\331\351\373{\006\277"
+	.ascii	"\212)3\323Y\272\240\271C\353\264\366\322f}V\227\375\245\271\274"
+	.ascii	"\227\325\313\227\356r\033\333R\315\204\216D\231J\256\314X\316"
+	.ascii	"\312\243\370\322Z\252\331W\333]\316\312S/\r\016-\240\373\253"
+	.ascii	"\206\317\232\341\374\315\202\177\233\340_0\374\373\205E4\226"
+	.ascii	"+v\306\025Z\235+\177?i\262V\3366-; }\255\\\240+|G\362\364\375"
+	.ascii	"\275\201_\305Hy\232P\025Q\226\341\242\253JO\251\313\246\322Q"
+	.ascii	".\225\206\3624{\005)\201\025\233\037w9\347\021F#\206^\320\311"
+	.ascii	"3\347\274\2771\360\355\035|\213\207q\315N\232\234\311 eN\372"
+	.ascii	"\202\031\r!\377\220w\230,\351)2\347\310\326\222\277\305z\254"
+	.ascii	"\225\264\320\r;Y\332\364\355$\025\214\314\021\254\357-\035\276"
+	.ascii	"\271\026\235W\266\020ffq\2132\325\267\303~\261$\203\354\224\016"
+	.ascii	"4iH:\f)u\320\br\304\b>~q\321\353\013\246\\\346\234\215\272\013"
+	.ascii	"N\230&}o\317\340\327G\300\334\\c\253\271H[\362K\t&\003H\337\027"
+	.ascii	"\235\341\n\340\266l1\3218<Q\303sr59\013b~\271\211\226\346\223"
+	.ascii	"\004cDM_\263\213\351\245F\261\212+cz1\317\346H\361\253\201\343"
+	.ascii	"G\315\307\236\234\231E\366\360Q\247\327\327\\>\355\212\0200q"
+	.ascii	"}M.OC\2732w\244\t\376 v\345\277b\226U,\031\253v\231\252+\303"
+	.ascii	"\347S\325EE\225\345f\231O\035\221\254;}M,\325\314b\251\341aR"
+	.ascii	"\303XY\2425\244\357\213\254\360\007-\246\223\233d\246\023\323"
+	.ascii	"\212m\223\346\366\304\306\317\025\031W\324H\271i\345f\225\023"
+	.ascii	"(\036\207\314I\233\251\276&\225\013i\241Y\273\353{s\212\317\022"
+	.ascii	"!eO\372^\003\214EGVV_3\n\22383\360\372\232P\316\006\244\345\206"
+	.ascii	"\217\210\371\344\017W\260\205\t\223\244<7?\310\244\270\241\221"
+	.ascii	"\026\006W\360E\211\022\033V\261d,#3I\350\270\361\231u0\324X\365"
+	.ascii	"\275\006(\270\0021bb\346\330\311e-\356\022\271C\245\316\034\263"
+	.ascii	"A\354l%\363\354\300\037p\200\201\231aF8S\311\262\2743\313\274"
+	.ascii	"P\311Ar3\314\356\336\271\250\302\323\327<b~\275\341\211C\366"
+	.ascii	"5\215\3240^\336\242\274i\027\347\033V\337\235\276\327@\205=\330"
+	.ascii	"!r\"\246\220J\244\244\222;\033\313YK\304\320\035\033wG<\354\241"
+	.ascii	"\255\253\313\024\302\001J\022O\037\220\233\2738n\202\334\024"
+	.ascii	"\362\237@\3614\240\253\251=*}\315\244\371\365\0378\364\325\205"
+	.ascii	"N\207\371ez\201\tRd\n\r\250\257G\236\033\023\210UZ&^Q\340\322"
+	.ascii	"`\017Xr\334\334\221\303\344\252{U\231\265\222\307<\f\272\334"
+	.ascii	"\244T\251jQ\210\230i\335\344\272\351\343\004\212\237\251\322"
+	.ascii	"\205J\214\2767y\230=~\340P\337\227't}\237\201"
+	.string	"\b\276\271\265$\311V\231\276\357\fAB"
+	.string	"\241\331\302\004\315\324\221\201\013{\360J\372ob\231X\346\215\212%ci"
+	.ascii	"\223\027\005\007_\316Z\"|\344l\344\305\2316n\336\260\2023'\256"
+	.ascii	"\257\231\205\361t\261\262\246\257\211\3541\363\366\325\305\366"
+	.ascii	"\037xs\200\221\202\246\3571\360\341\017l\222\376_\277\233S\177"
+	.ascii	"]^?\223\206\225\003\312G,\031\253\347,\312\023\033|\371JK\204"
+	.ascii	"\220\f9^B\372\376\346\213\2334n\3168\201\342q\206C\266l\351k"
+	.ascii	"\312x\005\323\333r\325\367&\f3\306\017\004&\201\343\305\257\357"
+	.ascii	"1\264a\363J\003\256;@\372L\253\246\261\326\204\253\257\351\342"
+	.ascii	"r\376\003\203\274\\)\342\243\357\367\314\252\377@\373\366%G\325"
+	.ascii	"\327\244Z{\321\305L\337cX\303f\276y\374\201\300\265\037B\274"
+	.ascii	"\372\036"
+	.string	"\203\031\376\357\337\017\3541k\323c\254\3571h\301\307P\005s\230\221\364\333w\373,\227Q\033\236\002\343$N\337c\b\303\034\272\346\374\336\231s\333N\344\006\362Y\237\235 <-s\266\364\275|\327N\035:{\030\2640\007!n~\361\256\233\233'\342\314Unx.\332\031\"n\222\260U\251\365\275v\367N(L\215\031Q\372\376\312)\022\027\326\244o\307\371)\343\002\244\256\357/\234:\204\354\214_\337\3377?}6\346\256\364\275u\330\nC\214\020\035\370\221D\306\334o\335\177\351\252\337\007\376\362\324\351\033T3\234U\016\322\357\334\317\333\230;+}\177\301\016sX\222\364\313\206\215=\346\351\241\363\361F\266\2069lA\363+\207\346\266\251`\005\254\3635\343.#}\220\360y\003d\rW\337\253\346\306\301\3354\367\355\302\023\314!L\322\257\0313\226M\004\242\234\277\314\250e\244\026\t *,\257e\337_"
+	.string	"\2029\264I\252P\352\025\373\235r\305n\033\022U\236\202rA\0235\037$z\360\330\214\321\351[\246\275\350\341\251\351\373\0138\360\353\024*\327\n\335\235\362V\341@u%\302\224\271,WK\205+\262"
+	.ascii	"'h\356\220\256\334*B\307\0139\007I3\006\346\222\271c\256\230"
+	.ascii	"\273v\331\352\362\206\271[\320n\230\213e\001S\336\356rV\206\271"
+	.ascii	"\\nZ\205\323\"\312Uhq\356|bx\301q\t]*\217\303\201\352J\204*o"
+	.ascii	".\332U\253\313\233v#e\316\313\233v\227\367\313\317\027,D\252"
+	.ascii	"\360\345\254\034\261aDP\336\232\271\036\347\375\357\227\353\305"
+	.ascii	"\213\222\210^\337{\326\243\265\303\214\034\376o\227\272\274f"
+	.ascii	"x\217\f\f\236"
+	.string	"8\377\201?d\214|\301\341\023\271\341\023}\301\267\f\263\271\343z\353{\".\370DY\360\211\252\340\0239\301'J\202\377k\345V)s\233\363v\253T\263\226C3\203\252\357\211\302\360%\273Q\256\224\0378\004\345\313\321E\337\023\t\301\277P\376\003I0\222\346\254\357\255g;\257\223\337'?\260\213l\215\321\353{\242$\376er\233\374\300!\344\\\026\323\367DZ\370w\311\177`S\026\226\222\276W\t\266\"\222\021\302$\013;\033\223\344WIUn \310\207\222 B\372\3361\244\337$[f\200\034\351\373S3\234\037\242\203A\270\b\373\r\273DD\310E{\311\035G)r\030\004\362\202]\260{$\215k\313-F\230k\344\367\310\005\203\223\343\r\335\177 P\f\033a~\364\375\320\027\f\002l\310\357\220KD\204\\\244\2271\f\2741\262K\244\322\001\223,\371\232\321\367Cd\270\002\253\244\337\257\373u\203"
+	.ascii	"\257r\210d\235\2672\031\211$q\203\330\034Z\352\204\035\373~\310"
+	.ascii	"\013\367\034I\372\005\002\344l\"$\247\262LP9\253\252D1\322\367"
+	.ascii	"C4\260\004x\222~\271\226\227\353v5\226|\034:C\346i\3418?\030"
+	.ascii	"t\372\336\037\357e\365\262\301'\355L+\253\357\205\352\340\013"
+	.ascii	"\331\341\t\332$\375\366\350\321u\215%\037/\240\206\216\033\231"
+	.ascii	"\322KI\345\013\276\200\225\364\273\265\325q\036\232d\351\251"
+	.ascii	"\tQY\"\251\353{\241!\270\310N\322\357\216\273\003\212\032+v%"
+	.ascii	"&\326\367B:\360\0057n\334\034x\340\352\274\361\ri\361\323\342"
+	.ascii	"vq\374\346\230R\266\206F\337\357=\355?\2606A\203b\326\367B2p"
+	.ascii	"OW\322/\326\362b\335,\021\311)/\017\226 \355\306\f\2359\311\361"
+	.ascii	"u\221\335s\345+\206\233\276\017\312\203\037T\2071 \243\361K\303"
+	.ascii	"\206\341l\264w\306Q\276\260\322\367Ao\270\003\216\244_\0312\252"
+	.ascii	"\231\211\0363\252\266\273 4\334\001F\322/\214\013\343l\"\344"
+	.string	"\251,\023P\356\352\274\361\005I\301\031Ly\361\373\302\206\341l\004F\tdE'\f\230\276\017\032\303\034\220$\375\272\270.\354\261f\345<\245\205\200$\312\312\206M\307\216\276\017\262\2013\340q\251.\225\rkS\313i\202\310\351{\240<\230\203^\222\375\253\367x\217P\324\200\354\360k5;;\274I\272\365\363\353+\030\220$P\315\335\001\301\341\f\324\334\271c\373\376\356\252\333U\027\r<\267}R\326\224;\264\340\f\370\350\320\261|\027P\031\363!B(F\035\031j\352\334\362\325\266\26167\200\364\375^5\373\0174\277\350\300I\353{\2401\fBN\322\255\336\234VB\243\306]Ff\022\007\342\201\0174\025\350\223\n\301TJ\005\206\013w:B\213Ri\020]\321\363\244BPX\f\256\240\364\024T\201\370\324\204A\212:`\205&\363NGF\224\211\b\245\264T,\261\264bC\003(0\002\n)>Pj"
+	.string	"\b\022P\241\224\302\004\245\023F\270\2006\r\203&\370\334\351\210E\261\004\213b\006\007\260P\272"
+	.string	"\225z\nR E\035\220bI\330D|\222\200\203\242;\035\021\225\240X\210\362P\001(\026\242\202R\324\b\205B\235%\226VL\320b\2050%\222\3004\374"
+	.string	"]!h\314`,\022\323\340\223T\221X,6\200I\030\265\341NG(\2240-a,\242+\b\213L\302\247'!\324\031B\t\021H\205\303\0212\264x\212\212\372\340\302Sp\311\230\nU(!5l\322\200\205\324P\370\244\001\007\035(u\340\001\213\022Kh\224\321\303pEO\212\243^\221\016\205\305\247\363NGF\2474\b5\024\006\213\251qH\\\002\336\351\250i(,\246\306\022(\223\324\323\322PX\242h\224*!\301\323\223\324pH\034\366\244J\350\007\204\306\2238\354Y\021D\237n\213\250%(\024\352l\021ELA\244\341\3014\310\224\242\306 \024("
+	.ascii	"@\213(b\n%cz\247\243()b\261I\251\210\246(T\260\030\214*q\301"
+	.ascii	"\322P\352g\270\242M\243RS\024P\2524l\2122\207MQ\026\375\200\320"
+	.ascii	"x\215F\264\310\304\024\354i\021E\\\272\3054\3122\241\303&\341"
+	.ascii	"S\260\207\t5J]c\317\213JMQ@-\212\251Q\330\204\232\240\301\330"
+	.ascii	"4\024\032S0\n1\030\213\204\032\230P4\352\004\r\251\222\261\210"
+	.ascii	">I5\240\be\222J\205i\032\304w:b\022F\2010B\tF!\213`\317\235\216"
+	.ascii	"\214O\304b:$.)-q`\032\006\241\240\210)\226\212@\224\211\250b"
+	.ascii	"\310'\305`DSa\221\205\037#jLa\210\t}R!8l@*\025\225JI@8\034\301"
+	.ascii	"\350\323!\005S\220\370\244\001}\2222!\310X$\246K\301\020\232"
+	.ascii	"\206\302\247\340\322\th*\025\005EL\001\200\020R\264IC\221\211"
+	.ascii	"\t\202\220\216\322\017\230\320\2648Dt\342\bJji\351\003\f\027"
+	.ascii	"68\212\222\352\300R\220\001*2\334"
+	.string	"\351hI\t\205\022\246C\251b\211\245\025\026\030\233\202O!4\r\205P\305\340\017\220\203\243\037\r'DQ0\024B\005\261@\231\206#\260\bB\005\005\2318J\213\301\250\243t(EL\2016ih\021,\026?\230\300LO\264h\246\240\224\007\204*\b\231P\241\221T\350\023*4R\260O\004\033\211E\237`\321H-\372\207Xl\321tS\364\004\343\bPhjlq\002\006#\220\261(U2\252@\225\3204\230\236"
+	.string	"%,\246\304T\352\003\ri\252\3044\002\013\242\n=\351\020-\026\245\226.\244w:ZQbH\204\202\".\241i05\232F\245\"\232>\tCH\205P\302\b\240i\260x\001\303\227\214'@\021S\243\324\222\3220\204\0245\242&4EQ\360%a\021\035\242M\370\034t\240A\007\036\260\350\271\007\0060a"
+	.string	"\023\347=0"
+	.string	"\022\222\001:@\302\357"
+	.ascii	"\311vp\264\001\001\224\3204\370\024\005\205\246JJ\032X\b\026"
+	.ascii	"\355\235\216\244\240\204FOO\304\342uZJ\205Q&\013\301\026\326"
+	.ascii	"\210J"
+	.string	"=\005W8\357tTDY\b\241\202\230\320\264\210\2560\\B\213B\020\212\304\224\b%\001\032\325\002\005\250\"qE\032|\212\0022F\005\237B0\006\235p\212\032\321b\tL\250\360)**\210\001}j\032~\340\264\224\nK\030\262@\004\001}JSb\321\t\205\241P\005\013+(H\231F\030\022\205\251\220iH\\\3721*\025Q\026B\025O\350p\030tJ\021\204.\025\245\210'\244RQC\341\017\023\212F\031\315t(4*\005\323 S0EU\f\261\b\252@\237\202KF\334\223\002\235h\032,^\243\022T\260\030\034\n\241,\213 \224E\237\230\230\204P\347\235\216\210\305\026M%\214E\242q\210\032\215J\304b\213\246\223\t\375\200\360)(L\205C\341O\2126\025\203\251P\252tb\003\024J\230F\021\211\021\020\202\"\016Q\020\214Ft\211X,\201I\0305\204\256 L\227>(\242+VH1"
+	.string	"C\252dL\001\237\220\032\203OD\251\022\2240\3751\246\200B\tQ\b\246O(\b\350S\024T\320xaE\n\020> \026[4\341'\"\221\001J\346\235(81\n-\226H\211\304b\211\037\243R\223p\305\220\030\204\032\237\244J(\242\351\020MA\204\246A\023\240X(\001\250\307\003hq\205\222\321\030\214b\201\370\244\224*u\200\224\016\205R8E\215+V\020\225X \026\235R\245!\261\210F\005\237V\024=\021\227\210)\261\030\245$\224*y\220\016\205R=\367"
+	.string	")\210v\200\232\330\340\b\303\013P\200\024\036R \301\001x\351\310X\"uj\022>\255(1\024\006\241J,\025\215%\216"
+	.ascii	"@\\\241\210\032\225\230P\250bp(\245$,\246\027\212A\247\245\373"
+	.ascii	"\377D\242\244\305j\210\355\035\261A\254\230\232;G#cf\322\232"
+	.ascii	"<\001\263^\335\205\205\310\231\276\"j\b9\213\b9\211\350Q\375"
+	.ascii	"\r\371I\304\02692dH_\030\234\207.\225\333\r\037_hg\020&^\312"
+	.ascii	"\274n\220>J\211\343\006\310Z\017\21696`\222o=p\330\b\322u\273"
+	.ascii	"F\360\r\301\362\303\214\303\213B\007\tW\233+q\346\214\351\253"
+	.ascii	"\366\243\013\216\036c\200]Hp\254\341a\326\315%\205\314\350{\356"
+	.ascii	"8\265~n\375\334\352s\313\376\375\235T\326p9u\230e-\007\306\224"
+	.ascii	"\0329\332\005\356b\007'\003\307\315\372\311Zrg\352\306\r\013"
+	.ascii	"\366'F\317\006\327\351W\207\006\235,S\b&\242\344\355\007\322"
+	.ascii	"\f\253C\254|\031\303R\363\241\263\033\023S#\251\347\004\013\013"
+	.ascii	"\2154;y\3108\351\253\004\302\302:\222\224aZ\021\202\263\362\007"
+	.ascii	"\326W\304\331\351\342\214q\2728a\\P\225\263Un\321\202\234\335"
+	.ascii	"\335i\365\023\306y5\246L\027\261\363\352|\001\354\343\212A\006"
+	.ascii	"\0342\304M\276\202\377\263\252m\350\253\005*iT}|nl`\364\375\317"
+	.ascii	")\033\326e\253\310W_\021F\314\276\363h\366\235\271\"\221y \344"
+	.ascii	"\376j\344\361e-\034\"~3\317\317l\376\331:2)^\346\237\351\327"
+	.ascii	"s\354j\343Sf$jc\322&h\202K\370\tc\"\304J_\223\317\264\363\343"
+	.ascii	"\231\320R&\3151wZA\372\276\036\357\034A=\336\371\233u\330\204"
+	.ascii	"\366\252p\301C\307\032i\313\322\202\327\234\233{Cy:\200\364\350"
+	.ascii	"k\346\231zO\306\314\350\372\276.\037\307n\t\234\265*}\315;\023"
+	.ascii	"\257\310X\2270r\356\220|L\370\352\344\2304zjH\3013\304"
+	.string	"n\206O\232\215\267\033q\270:\215\032\036\027&\234\233\207fGf\255\257\207\031ssf\035\221\270;w|Ail\244e\321\335\254\013\332\323\002We\002$\266`\315\032\263\315\t\026W\207I\235\223\365E\313ds\263M+\361\021\223\307\b\230\004k\260\005fppf\034\035&dBrCb\310Ps3\216n\210\252\t\222/\266G\020Y\0346[}/\001\031\266 Y\246\214\371\246\201m*\n\216-\274\037hn\276\261\365(\241;\206\3655\317\234-\271%m\253\257i\346l<\210\3348\353k\272\265I\020\206-\240#F\2149\306(y\304\273`\317+/\017\207\362\315\026\223\355\346\030\271\026\342\330\350\373=\021C1\266\320\241\352{\t^`\013b\250\251\231k\032\302(\221\203\003\307\261\301&\204\232\250\263\221#rH4\213Q$\213!\247\bSj\206J\232\0033\025@ P<\"\023Lj\253=\023"
+	.ascii	"\004N,e9P\203L\251\231\031I\nR\351\241\311\362d/b\234\371\352"
+	.ascii	"\315+K\363l\2154zc-n\311Cm\210\265\236?\201\225\266.\212\032"
+	.ascii	"\261\300<}+,e\240cwRD\322\007\001Y.2y[\334=\037s3\241\376\344"
+	.ascii	"\232Z\320\251\277\f;\200|\260\037\347Tx|#b2\227\345frP\224\235"
+	.ascii	"Dh%\2768\260B<\362}\034\253#\220U\210~c_\306'z\353\250\245\013"
+	.ascii	"4WJP\320\331k\031O\350\027\311\237\257\377\001\n\321\322\261"
+	.ascii	"\"{P\200kW\321\266cr\035\025\265\220\364N\026\035\200X\321\254"
+	.ascii	"\025\304\203 %Q1X\256T\230\004\243\223\317\002\234\232\207U@"
+	.ascii	"\340\305\206k\035O\312\322\244\r\241D0\230=3\025\023\317\\\b"
+	.ascii	"^\371v\310I\026\013\274\003H\244\231@\201+\\8\263\022\315~\323"
+	.ascii	"8Jw\263\266\37480k\201\217\310\241\271\031&6\202\342\225\353"
+	.ascii	"w\261\324\347(\026\033\210\022m.kkS~\260\003\273!4]\261\223\322"
+	.ascii	"r\037\343&e\236\t\374~\033\032=\261\233Y\350\1771\331\302B\027"
+	.ascii	"\373_\025`\362<iH\217\367\251\357\253C\266#\302\321\005\024\037"
+	.ascii	"\020\225g9\310%\304\265:\233]\316+pwP\243\204\237\007\240v\270"
+	.ascii	"]\350M\2504\213\026\364\r\027\274\310S\032Jj\247\226\213\241"
+	.ascii	"\230\f\205D\353\232L\346#}6z\356\345\235\236+L\320#7O\261\307"
+	.ascii	"\001bv\340j\372\013\356\351u\314o\237\326{\225\2542\213C\350"
+	.ascii	"c\t\021\356\340\347\266\364D\317F\231:\267\025q\240l\212\216"
+	.ascii	"\376P\253h\230\022\"_\310f\302\344\313-\230\246\3339\327r\305"
+	.ascii	"}[\244]W\327\022\037\203\225\300\245\3336\246H\333\207|\222Q"
+	.ascii	"\245#\242\255)a\032\325h(a\177\004TKd\304&\024\372\"`}X\357\354"
+	.ascii	"+\362\325\211\026\353\003\213\305\347I[\374\246c\203[d\253w="
+	.ascii	"\235\320\350S\3738`\003\006\305"
+	.ascii	"\305\223\227+\353@\230\302{l\236\200\270\211\032\360\022\316"
+	.ascii	"T1\3245d\275\222\332%\310`\254[f\031\020\262pAcd\335\027\324"
+	.ascii	"\322\234\327\330\035o\353oc\204\006\215\311\374\\3\253\177B9"
+	.ascii	"]#\310\370\200\246JQ\264GF\205\033m\372\017\301\214\277\304\214"
+	.ascii	"=\207"
+	.string	"\201\327\233\301\250\nO\372\034\231\254\327\232\001>\314\0356\016Yw^\366\025H\203<\342\233\257\337\364\202\274\372\317\241\200o\217p\r\2737q('\347\277g\271\320\030b\020\365R\t\366\215\203\273(\256\003\271\337\t\005\022hs{\354\0228<\033\037\225\257+\027*\223O\034$T\355\365O\324\307F\002ACD\272\210\345\nz\243\351u\270\201\035\346\271I\251oI\035Y\303Y\302A\241\251\330nO\250\252 \352\334\013\030\210M\214\030q`\370d\253]\250\231\231\210\231\300M\226\312\2106\013Xd\265\t\026Pb\323\006\336\003\311\300\354\317\317\321\323\327\007\"\346\3206V\325\036\355\213\264B!\272\341m\341n\366\333\237\177\335\347\211\276x+t\365\004\326\034|L\346\005\037\f\3566\tl|,7\375Q\006\242\004@\001\315\314\354\370\024Sk\205>o\336\271\032\227u^\202\336\021\003!\204\316[C\2138\214"
+	.string	"R0\230\350(\317s\237t\021\013\234|w\314l\235\256 1\206\211'\210\206\3263R\240d\337\300\221\233\327\340\374RUTO\251t\0348\351\t\346{\356\367\262Y.\003\266p{$\272?<H\316\236\033\354\260\211o\267\364\221PO\241K\276\367|\322\244\234\240\004\300lT\267i\244{\225\231\353\347@\270\005\006+h<\367k\340\350Q"
+	.ascii	".t..\276\352\226\237sh\344\305_\364'\027\201??\212B6\306\374"
+	.ascii	"\323\373\007I=w\330\337\203\034\177\207\315V\234@{\305\217\261"
+	.ascii	"&\023H\r\203\336\260\220m\017\305B&6\216L\241@7\321\025\223\312"
+	.ascii	"\364#\352\272\333&U\227\323\372\303t\375\261\233\306\250:iw:"
+	.ascii	"n~\213/\353\355\364M\331\204c\366\364\177~\243\306\322\031;\262"
+	.ascii	"?\207\013\220\350\006\352\354\b\307o=\205\213\355\202e\276\317"
+	.ascii	"\0302\344^V\021\301yh)RF\253\261\005\316@\213oW\331L'\330\323"
+	.ascii	"\354b\\D\370F&\020\017\250\200\017\366]\310\300?\030\321<?i\304"
+	.ascii	"[ \212\322\344\225\320;\250\322|1@\346\036\377\3431Z\026\020"
+	.ascii	"l@\366)ltZo\317be\224d\036c\016\330\007t\242?*,\366\246\304X"
+	.ascii	"K\223\364:\274\373.\337\312\270b\315\311BsX\001\027\322\212D"
+	.ascii	"\202\274V\225<\241\277\226\210\035\271E\222t\252\340\350\341"
+	.ascii	"\234\306\027\350\372\275?\235#\036\347\005\3016dm^\306xbV\025"
+	.ascii	"h\257+\n\013\262\275\207D\235\355Z\n\346\261\201_\t\n\240\361"
+	.ascii	"\210\224\270\241"
+	.string	"\315\007p4\236\246\266=J\013-\027\353\216U^0\3034\264\004\320\031T!7!(\235\217\244\245%\"\303\324\263\3332\001\021'>\215\244q\377W\2066\342\177#]R\321\314N;\252z!'R\300\2625\273j_j\217\372\314 B\265R\261(\324H\036I\247_\316r\300\337\343\353/`Q\304\371\224\227B\323\036\223\257\223CsD @.\303\375\370*\352\342\337 \244Qz\201\2548\342\346>d3\355S\215c\264\265k\207\351'\032\331RA1:\037\333\017\006\034M\322\023\227^\313x\003\344\250\337\316OY%\246\003\006\244\266\271\214\206\243\237\220\322\376\210\330\241m\211g1@\243<\364\352\344\221\232\313\225\202\006g\271\372\027\263\002G*\252T\244Z\207\216\233H\351Q\373\021\226\265!,\351I!4\003I4\002\001&\220\251\204\332\231\357\223\023\330\251b}\bP\236\367\025B\362K\004[a5"
+	.string	"\257\305\363\344`\231\236\365\247\212\362Ce\346\221\374\231\363VM\2674\023\264\356\264B\220FIp\036u\242\213H\336\341?\200\224\330\260\314\230V/T\204\365\310\200\225\377\217Q\226"
+	.string	"z\345g\364*X\236.\217\351\325\323\001Mn\247kty9^\270\3448\335%\374{[\324\365\316\322\346"
+	.string	"\210\353\367\317\230D$\205_\355xcs\2539h\264\2646\266\213\007\344\t\200\313\341E,\200\210<"
+	.string	"\307T\206)\331\036\004v\030\361n?f\201\212\337\223\254\233B\250\251\340[\362\324\347\306\276\007\021\020\"p\371\323\353\355$\374\t\210\257\t\331\377\326\237\246\t{\373\204\371\340%\263\310\362\027\001+\t\266\336\005re\331\330\322\327\202Y}v\nT\031\217\352\373Wp\024\306\374\303{%\215\225\302\236\257\255\275\361iA\221\304\241\264\025]\327\2226E$\3331&\223\263\"\336f\242k\004\257\312\272\353V\354>\237:OL\242\222!I\030\033ms\346\355Qx\274\324\370\226\005\355\365\320~\233\320\370\245\261IC"
+	.string	"}\020\\)\352\242\265\227\307\350\034\2006\377u\003t\024\367\373\332\002l\245W\224 \nb\373\230\024\337\326D\256b\266B\262,\251~\013\310\363\256\337|\256\3757\374\376\305Aj\200_\202d\321\037\202\243\344\201 c0\024\017\204\b\266\200\007\251\310\372^\377@;\017\313\254.l\323\027T\316\216za\036\357\322\3464\265\251hC0\341\022\3240\201G}\235:\350!]\037\252\226\342\241\026\220\375\005im\031\250\031K\243\3542P\0260;\374\337\341\302\\\245k\314B\033\364\031C\030\243\027\267\204\213\177Z\217\f\022h\2167\237\361z\224I\234yA8\300|\336\002\033D\013[>\366\223\367\334\353\2032,\341yX\207\fj-?l\317N\311\300W\b\201x\351\250\366t\r\032-"
+	.ascii	"D,>\226\206\202\037\225\273\t\027\300\235\003`\376\372\352\022"
+	.ascii	"\322\326'bd\204[h\301{\271`f\t+\002\263F{`\333\002+\243\336\266"
+	.ascii	"`\350C\207\200c\220\277\245>\217\0161j\265CA\267^8\251\273j\027"
+	.ascii	"\340\355}~j\254S\257\361\304\237\213O\346\361\304\322w\375\304"
+	.ascii	"'\032\032\325X\264l _?\354\375\007\377acq>\027\273\300\376 \362"
+	.ascii	"e\352\235%K\263=\327\342\316M\377w\t#\333\020\274E\344\356\271"
+	.ascii	"\376\251\312Y\206y\227\327OT\312\366\007WL\371\227\350\213$\335"
+	.ascii	"-\307t\252\347\256\233\206`2\331w\020\274^\375\201\346\233\303"
+	.ascii	"C\345\277\344\312>\243\016P\267\247\376\273k\315\275\375\310"
+	.ascii	"\356\b\250\354@?\247\374\254\362\001\343\007 &`\275.\262K\021"
+	.ascii	"]\177\030\\\274\313\263V>\270\"ni\220\375\204~\300\264\276\374"
+	.ascii	"'\344n tKP\266\306\275_\367\332\026\246\037\207\367\315\377\r"
+	.ascii	"\337|T\355h\244}\300u\025\007\013\333\323o\226>\f\304l\220\007"
+	.ascii	"\352\352\322\217\341G]\333\004^$\367\301\332\257\357\215\342"
+	.ascii	"\341\013o\226\335F\262\237\364Y\323\362\257\313;\213o`\235U\031"
+	.ascii	"w\302\277\347\031\322\215m\224-.t\347m}\316jB\355\205\222\035"
+	.ascii	"@\341+\350c)\006\323\277\256\271X\225\373*\342\322G*\205\256"
+	.text
+	.section	.gnu.lto_.symtab.fae46121b84a2488,"e",@progbits
+	.string	"pgResetFn_servoParams"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\001"
+	.string	""
+	.string	"pgResetFn_customServoMixers"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\214\001"
+	.string	""
+	.string	"servoConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\001"
+	.string	""
+	.string	"servo"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"servoParams_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\325\001"
+	.string	""
+	.string	"getFlaperonDirection"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\001"
+	.string	""
+	.string	"servoComputeScalingFactors"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\374\001"
+	.string	""
+	.string	"getServoCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\001"
+	.string	""
+	.string	"loadCustomServoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003\002"
+	.string	""
+	.string	"customServoMixers_SystemArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"servosInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"writeServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\002"
+	.string	""
+	.string	"servoMixer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\002"
+	.string	""
+	.string	"processServoAutotrim"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"isServoOutputEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\002"
+	.string	""
+	.string	"setServoOutputEnabled"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\002"
+	.string	""
+	.string	"isMixerUsingServos"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"-\002"
+	.string	""
+	.string	"servoParams_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Y\002"
+	.string	""
+	.string	"servoParams_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\002"
+	.string	""
+	.string	"customServoMixers_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\002"
+	.string	""
+	.string	"customServoMixers_CopyArray"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\002"
+	.string	""
+	.string	"pgResetTemplate_servoConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\002"
+	.string	""
+	.string	"servoConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"z\002"
+	.string	""
+	.string	"servoConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"|\002"
+	.string	""
+	.string	"gyro"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\263\001"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\001"
+	.string	""
+	.string	"mixerConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\002"
+	.string	""
+	.string	"flightModeFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\027\002"
+	.string	""
+	.string	"rcCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"axisPID"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\033\002"
+	.string	""
+	.string	"attitude"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\037\002"
+	.string	""
+	.string	"mixerThrottleCommand"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\002"
+	.string	""
+	.string	"constrain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"lrintf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\002"
+	.string	""
+	.string	"biquadFilterApply"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"biquadFilterReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"biquadFilterInitLPF"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\255\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"pidResetErrorAccumulators"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"saveConfigAndNotify"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"pwmWriteServo"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"rateLimitFilterApply4"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"logicConditionGetValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\002"
+	.string	""
+	.string	"rxGetChannelValue"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\002"
+	.string	""
+	.string	"scaleRange"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"gvGet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.fae46121b84a2488,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,10594 @@
+	.file	"wind_estimator.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/common/axis.h"
+	.file 6 "./src/main/drivers/adc.h"
+	.file 7 "./src/main/fc/runtime_config.h"
+	.file 8 "./src/main/flight/imu.h"
+	.file 9 "./src/main/io/gps.h"
+	.file 10 "./src/main/flight/wind_estimator.c"
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 12 "./src/main/common/maths.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	wind_estimator.c.37282a38
+	.weak	wind_estimator.c.37282a38
+wind_estimator.c.37282a38:
+	.long	0x66f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x15
+	.long	.LASF1557
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1435
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1436
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1437
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1438
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1439
+	.uleb128 0x3
+	.long	.LASF1440
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1441
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x5
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1442
+	.uleb128 0x3
+	.long	.LASF1443
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1444
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1445
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1446
+	.uleb128 0x3
+	.long	.LASF1447
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1448
+	.uleb128 0x3
+	.long	.LASF1449
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1450
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1451
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF1452
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1453
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x3
+	.long	.LASF1454
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x5
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1455
+	.uleb128 0x5
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1456
+	.uleb128 0x3
+	.long	.LASF1457
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x11
+	.long	0xb5
+	.uleb128 0x3
+	.long	.LASF1458
+	.byte	0x4
+	.byte	0x21
+	.byte	0x12
+	.long	0xe5
+	.uleb128 0xd
+	.long	.LASF1503
+	.byte	0xa
+	.byte	0x4
+	.byte	0x49
+	.long	0x17f
+	.uleb128 0x1
+	.long	.LASF1459
+	.byte	0x4
+	.byte	0x4b
+	.byte	0xe
+	.long	0xcd
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1460
+	.byte	0x4
+	.byte	0x4d
+	.byte	0xd
+	.long	0xc1
+	.byte	0x2
+	.uleb128 0x8
+	.string	"day"
+	.byte	0x4
+	.byte	0x4f
+	.byte	0xd
+	.long	0xc1
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1461
+	.byte	0x4
+	.byte	0x51
+	.byte	0xd
+	.long	0xc1
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1462
+	.byte	0x4
+	.byte	0x53
+	.byte	0xd
+	.long	0xc1
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1463
+	.byte	0x4
+	.byte	0x55
+	.byte	0xd
+	.long	0xc1
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1464
+	.byte	0x4
+	.byte	0x57
+	.byte	0xe
+	.long	0xcd
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1465
+	.byte	0x4
+	.byte	0x58
+	.byte	0x3
+	.long	0x117
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x5
+	.byte	0x14
+	.long	0x1a3
+	.uleb128 0xe
+	.string	"X"
+	.byte	0
+	.uleb128 0xe
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0xe
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0xf
+	.long	0xf1
+	.long	0x1b2
+	.uleb128 0xc
+	.long	0x37
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x6
+	.byte	0x16
+	.long	0x1dc
+	.uleb128 0x4
+	.long	.LASF1466
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1467
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1468
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1469
+	.byte	0x3
+	.uleb128 0x4
+	.long	.LASF1470
+	.byte	0x4
+	.byte	0
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x7
+	.byte	0x6c
+	.long	0x2a1
+	.uleb128 0x4
+	.long	.LASF1471
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1472
+	.byte	0x2
+	.uleb128 0x4
+	.long	.LASF1473
+	.byte	0x4
+	.uleb128 0x4
+	.long	.LASF1474
+	.byte	0x8
+	.uleb128 0x4
+	.long	.LASF1475
+	.byte	0x10
+	.uleb128 0x4
+	.long	.LASF1476
+	.byte	0x20
+	.uleb128 0x4
+	.long	.LASF1477
+	.byte	0x40
+	.uleb128 0x4
+	.long	.LASF1478
+	.byte	0x80
+	.uleb128 0x7
+	.long	.LASF1479
+	.value	0x100
+	.uleb128 0x7
+	.long	.LASF1480
+	.value	0x200
+	.uleb128 0x7
+	.long	.LASF1481
+	.value	0x400
+	.uleb128 0x7
+	.long	.LASF1482
+	.value	0x800
+	.uleb128 0x7
+	.long	.LASF1483
+	.value	0x1000
+	.uleb128 0x7
+	.long	.LASF1484
+	.value	0x2000
+	.uleb128 0x7
+	.long	.LASF1485
+	.value	0x4000
+	.uleb128 0x7
+	.long	.LASF1486
+	.value	0x8000
+	.uleb128 0x6
+	.long	.LASF1487
+	.long	0x10000
+	.uleb128 0x6
+	.long	.LASF1488
+	.long	0x20000
+	.uleb128 0x6
+	.long	.LASF1489
+	.long	0x40000
+	.uleb128 0x6
+	.long	.LASF1490
+	.long	0x80000
+	.uleb128 0x6
+	.long	.LASF1491
+	.long	0x100000
+	.uleb128 0x6
+	.long	.LASF1492
+	.long	0x200000
+	.uleb128 0x6
+	.long	.LASF1493
+	.long	0x400000
+	.uleb128 0x6
+	.long	.LASF1494
+	.long	0x800000
+	.uleb128 0x6
+	.long	.LASF1495
+	.long	0x1000000
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1496
+	.byte	0x7
+	.byte	0x8c
+	.byte	0x11
+	.long	0xd9
+	.uleb128 0xf
+	.long	0xf1
+	.long	0x2c1
+	.uleb128 0xc
+	.long	0x37
+	.uleb128 0xc
+	.long	0x37
+	.byte	0
+	.uleb128 0xf
+	.long	0xa9
+	.long	0x2d0
+	.uleb128 0xc
+	.long	0x37
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1497
+	.byte	0x8
+	.byte	0x2a
+	.byte	0xe
+	.long	0x2ad
+	.uleb128 0xb
+	.long	0x30
+	.byte	0x9
+	.byte	0x50
+	.long	0x2fa
+	.uleb128 0x4
+	.long	.LASF1498
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1499
+	.byte	0x1
+	.uleb128 0x4
+	.long	.LASF1500
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1501
+	.byte	0x9
+	.byte	0x54
+	.byte	0x3
+	.long	0x2dc
+	.uleb128 0x5
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1502
+	.uleb128 0xd
+	.long	.LASF1504
+	.byte	0xc
+	.byte	0x9
+	.byte	0x6a
+	.long	0x341
+	.uleb128 0x8
+	.string	"lat"
+	.byte	0x9
+	.byte	0x6b
+	.byte	0xd
+	.long	0xb5
+	.byte	0
+	.uleb128 0x8
+	.string	"lon"
+	.byte	0x9
+	.byte	0x6c
+	.byte	0xd
+	.long	0xb5
+	.byte	0x4
+	.uleb128 0x8
+	.string	"alt"
+	.byte	0x9
+	.byte	0x6d
+	.byte	0xd
+	.long	0xb5
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1505
+	.byte	0x9
+	.byte	0x6e
+	.byte	0x3
+	.long	0x30d
+	.uleb128 0x17
+	.byte	0x7
+	.byte	0x9
+	.byte	0x73
+	.byte	0x5
+	.long	0x3b2
+	.uleb128 0x1
+	.long	.LASF1506
+	.byte	0x9
+	.byte	0x74
+	.byte	0xd
+	.long	0x306
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1507
+	.byte	0x9
+	.byte	0x75
+	.byte	0xd
+	.long	0x306
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1508
+	.byte	0x9
+	.byte	0x76
+	.byte	0xd
+	.long	0x306
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1509
+	.byte	0x9
+	.byte	0x77
+	.byte	0xd
+	.long	0x306
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1510
+	.byte	0x9
+	.byte	0x78
+	.byte	0xd
+	.long	0x306
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1511
+	.byte	0x9
+	.byte	0x79
+	.byte	0xd
+	.long	0x306
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1512
+	.byte	0x9
+	.byte	0x7a
+	.byte	0xd
+	.long	0x306
+	.byte	0x6
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1513
+	.byte	0x3c
+	.byte	0x9
+	.byte	0x72
+	.long	0x45b
+	.uleb128 0x1
+	.long	.LASF1514
+	.byte	0x9
+	.byte	0x7b
+	.byte	0x7
+	.long	0x34d
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1515
+	.byte	0x9
+	.byte	0x7d
+	.byte	0x12
+	.long	0x2fa
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1516
+	.byte	0x9
+	.byte	0x7e
+	.byte	0xd
+	.long	0xc1
+	.byte	0xc
+	.uleb128 0x8
+	.string	"llh"
+	.byte	0x9
+	.byte	0x80
+	.byte	0x13
+	.long	0x341
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1517
+	.byte	0x9
+	.byte	0x81
+	.byte	0xd
+	.long	0x2c1
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1518
+	.byte	0x9
+	.byte	0x82
+	.byte	0xd
+	.long	0x2c1
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1519
+	.byte	0x9
+	.byte	0x84
+	.byte	0xd
+	.long	0xa9
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1520
+	.byte	0x9
+	.byte	0x85
+	.byte	0xd
+	.long	0xa9
+	.byte	0x2a
+	.uleb128 0x8
+	.string	"eph"
+	.byte	0x9
+	.byte	0x87
+	.byte	0xe
+	.long	0xcd
+	.byte	0x2c
+	.uleb128 0x8
+	.string	"epv"
+	.byte	0x9
+	.byte	0x88
+	.byte	0xe
+	.long	0xcd
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF1521
+	.byte	0x9
+	.byte	0x8a
+	.byte	0xe
+	.long	0xcd
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1522
+	.byte	0x9
+	.byte	0x8c
+	.byte	0x10
+	.long	0x17f
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1523
+	.byte	0x9
+	.byte	0x8e
+	.byte	0x3
+	.long	0x3b2
+	.uleb128 0x10
+	.long	.LASF1524
+	.byte	0x9
+	.byte	0x97
+	.byte	0x1a
+	.long	0x45b
+	.uleb128 0x2
+	.long	.LASF1525
+	.byte	0x2d
+	.byte	0xc
+	.long	0x306
+	.uleb128 0x2
+	.long	.LASF1526
+	.byte	0x2e
+	.byte	0xe
+	.long	0x1a3
+	.uleb128 0x2
+	.long	.LASF1527
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1a3
+	.uleb128 0x2
+	.long	.LASF1528
+	.byte	0x30
+	.byte	0xe
+	.long	0x1a3
+	.uleb128 0xa
+	.long	.LASF1529
+	.byte	0xb
+	.byte	0x3e
+	.byte	0xf
+	.long	0xf1
+	.long	0x4b5
+	.uleb128 0x9
+	.long	0xf1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1530
+	.byte	0xb
+	.byte	0x40
+	.byte	0xf
+	.long	0xf1
+	.long	0x4cb
+	.uleb128 0x9
+	.long	0xf1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1531
+	.byte	0xb
+	.byte	0x3b
+	.byte	0xf
+	.long	0xf1
+	.long	0x4e6
+	.uleb128 0x9
+	.long	0xf1
+	.uleb128 0x9
+	.long	0xf1
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1558
+	.byte	0x9
+	.byte	0xa3
+	.byte	0x5
+	.long	0x306
+	.uleb128 0xa
+	.long	.LASF1532
+	.byte	0xb
+	.byte	0x8f
+	.byte	0xe
+	.long	0xf1
+	.long	0x508
+	.uleb128 0x9
+	.long	0xf1
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1533
+	.byte	0xc
+	.byte	0xa1
+	.byte	0x7
+	.long	0xf1
+	.long	0x523
+	.uleb128 0x9
+	.long	0xf1
+	.uleb128 0x9
+	.long	0xf1
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1559
+	.byte	0xa
+	.byte	0x4e
+	.byte	0x6
+	.long	0x5ec
+	.uleb128 0x11
+	.long	.LASF1549
+	.byte	0x4e
+	.byte	0x23
+	.long	0x10b
+	.uleb128 0x2
+	.long	.LASF1534
+	.byte	0x50
+	.byte	0x15
+	.long	0x10b
+	.uleb128 0x2
+	.long	.LASF1535
+	.byte	0x59
+	.byte	0xb
+	.long	0x1a3
+	.uleb128 0x2
+	.long	.LASF1536
+	.byte	0x5a
+	.byte	0xb
+	.long	0x1a3
+	.uleb128 0x2
+	.long	.LASF1537
+	.byte	0x5b
+	.byte	0xb
+	.long	0x1a3
+	.uleb128 0x2
+	.long	.LASF1538
+	.byte	0x5d
+	.byte	0xb
+	.long	0x1a3
+	.uleb128 0x2
+	.long	.LASF1539
+	.byte	0x5e
+	.byte	0xb
+	.long	0x1a3
+	.uleb128 0x2
+	.long	.LASF1540
+	.byte	0x5f
+	.byte	0xb
+	.long	0x1a3
+	.uleb128 0x2
+	.long	.LASF1541
+	.byte	0x6c
+	.byte	0x11
+	.long	0xff
+	.uleb128 0x2
+	.long	.LASF1542
+	.byte	0x7b
+	.byte	0xb
+	.long	0xf1
+	.uleb128 0x12
+	.uleb128 0x1a
+	.string	"V"
+	.byte	0xa
+	.byte	0x88
+	.byte	0xf
+	.long	0xf1
+	.uleb128 0x2
+	.long	.LASF1543
+	.byte	0x95
+	.byte	0xf
+	.long	0xf1
+	.uleb128 0x2
+	.long	.LASF1544
+	.byte	0x96
+	.byte	0xf
+	.long	0xf1
+	.uleb128 0x2
+	.long	.LASF1545
+	.byte	0x97
+	.byte	0xf
+	.long	0xf1
+	.uleb128 0x2
+	.long	.LASF1546
+	.byte	0x99
+	.byte	0xf
+	.long	0x1a3
+	.uleb128 0x2
+	.long	.LASF1547
+	.byte	0x9e
+	.byte	0xf
+	.long	0xf1
+	.uleb128 0x2
+	.long	.LASF1548
+	.byte	0x9f
+	.byte	0xf
+	.long	0xf1
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1554
+	.byte	0x3e
+	.long	0xf1
+	.long	0x629
+	.uleb128 0x11
+	.long	.LASF1550
+	.byte	0x3e
+	.byte	0x31
+	.long	0x629
+	.uleb128 0x2
+	.long	.LASF1551
+	.byte	0x40
+	.byte	0xb
+	.long	0xf1
+	.uleb128 0x2
+	.long	.LASF1552
+	.byte	0x41
+	.byte	0xb
+	.long	0xf1
+	.uleb128 0x12
+	.uleb128 0x2
+	.long	.LASF1553
+	.byte	0x43
+	.byte	0xf
+	.long	0xf1
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.byte	0x8
+	.long	0xcd
+	.uleb128 0x13
+	.long	.LASF1555
+	.byte	0x39
+	.long	0xf1
+	.long	0x649
+	.uleb128 0x11
+	.long	.LASF1556
+	.byte	0x39
+	.byte	0x21
+	.long	0x7c
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF1560
+	.byte	0xa
+	.byte	0x32
+	.byte	0x5
+	.long	0x306
+	.uleb128 0x1d
+	.long	.LASF1561
+	.byte	0x4
+	.byte	0x33
+	.byte	0x1b
+	.long	0xff
+	.uleb128 0x14
+	.string	"a"
+	.byte	0x2e
+	.long	0x10b
+	.uleb128 0x14
+	.string	"b"
+	.byte	0x3a
+	.long	0x10b
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0x21
+	.sleb128 2
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0x21
+	.sleb128 51
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 13 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 14 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xe
+	.file 15 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 16 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x10
+	.file 17 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.file 18 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF488
+	.file 20 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 21 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF542
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 24 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF615
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF633
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF656
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF542
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF716
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF720
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF721
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF784
+	.byte	0x4
+	.file 31 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.file 32 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x20
+	.byte	0x4
+	.file 33 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x4
+	.file 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 35 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF918
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF919
+	.byte	0x4
+	.byte	0x4
+	.file 38 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 39 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x28
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1200
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF615
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1227
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 48 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 49 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x31
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4
+	.file 50 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 51 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 52 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0x4
+	.file 53 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x35
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.file 54 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1411
+	.byte	0x4
+	.file 55 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1412
+	.byte	0x4
+	.file 56 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x8
+	.file 57 "./src/main/common/vector.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x39
+	.byte	0x4
+	.file 58 "./src/main/common/quaternion.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF405
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF424
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF447
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF464
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF485
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF487
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF489
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF491
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF492
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF493
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF494
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF495
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF496
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF499
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF500
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF501
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF502
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF503
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF504
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF505
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF506
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF507
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF508
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF510
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF513
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF514
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF515
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF520
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF526
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF528
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF535
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF525
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF536
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF538
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF541
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF547
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF553
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF600
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF612
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF614
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF632
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF641
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF643
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF645
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF647
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF649
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF651
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF653
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF671
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF713
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF715
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF719
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF783
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF797
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF816
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF833
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF834
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF862
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF864
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF865
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF901
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF866
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF903
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF909
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF914
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF487
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF643
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF645
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF647
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF649
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF651
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF653
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF655
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF798
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF817
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF835
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF837
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF916
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF487
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1192
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1199
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1221
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1226
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1229
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1231
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1246
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1246
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1256
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1259
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1259
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1259
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1259
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1259
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1247
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1248
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1249
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1250
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1269
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1270
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1279
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1280
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1281
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1282
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1283
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1320
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1331
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1334
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1357
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1367
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1369
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1372
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1408
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1410
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1415
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1426
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1434
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF1562
+	.long	.LASF1563
+	.long	.LASF1564
+	.long	.LASF1565
+	.long	.LASF1566
+	.long	.LASF1567
+	.long	.LASF1568
+	.long	.LASF1569
+	.long	.LASF1570
+	.long	.LASF1571
+	.long	.LASF1572
+	.long	.LASF1573
+	.long	.LASF1574
+	.long	.LASF1575
+	.long	.LASF1576
+	.long	.LASF1577
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3b
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1578
+	.byte	0xc
+	.long	.LASF1579
+	.byte	0xc
+	.long	.LASF1580
+	.byte	0xc
+	.long	.LASF1581
+	.byte	0x2
+	.long	.LASF1582
+	.byte	0x2
+	.long	.LASF1583
+	.byte	0x4
+	.long	.LASF1584
+	.byte	0x5
+	.long	.LASF1585
+	.byte	0x6
+	.long	.LASF1586
+	.byte	0x7
+	.long	.LASF1587
+	.byte	0x6
+	.long	.LASF1588
+	.byte	0xc
+	.long	.LASF1589
+	.byte	0x2
+	.long	.LASF1590
+	.byte	0xf
+	.long	.LASF1591
+	.byte	0xa
+	.long	.LASF1592
+	.byte	0x9
+	.long	.LASF1593
+	.byte	0x8
+	.long	.LASF1594
+	.byte	0x10
+	.long	.LASF1594
+	.byte	0xf
+	.long	.LASF1595
+	.byte	0xc
+	.long	.LASF1596
+	.byte	0xf
+	.long	.LASF1597
+	.byte	0xf
+	.long	.LASF1598
+	.byte	0xc
+	.long	.LASF1599
+	.byte	0xc
+	.long	.LASF1600
+	.byte	0xe
+	.long	.LASF1601
+	.byte	0xc
+	.long	.LASF1602
+	.byte	0xd
+	.long	.LASF1603
+	.byte	0xd
+	.long	.LASF1604
+	.byte	0xc
+	.long	.LASF1605
+	.byte	0xc
+	.long	.LASF1606
+	.byte	0xc
+	.long	.LASF1607
+	.byte	0x10
+	.long	.LASF1608
+	.byte	0x9
+	.long	.LASF1609
+	.byte	0x9
+	.long	.LASF1610
+	.byte	0x10
+	.long	.LASF1611
+	.byte	0xf
+	.long	.LASF1612
+	.byte	0xb
+	.long	.LASF1613
+	.byte	0xb
+	.long	.LASF1614
+	.byte	0xf
+	.long	.LASF1615
+	.byte	0xf
+	.long	.LASF1616
+	.byte	0xc
+	.long	.LASF1617
+	.byte	0xc
+	.long	.LASF1618
+	.byte	0xc
+	.long	.LASF1619
+	.byte	0xc
+	.long	.LASF1620
+	.byte	0xc
+	.long	.LASF1621
+	.byte	0xc
+	.long	.LASF1622
+	.byte	0xc
+	.long	.LASF1623
+	.byte	0xc
+	.long	.LASF1624
+	.byte	0x1
+	.long	.LASF1625
+	.byte	0x1
+	.long	.LASF1626
+	.byte	0x3
+	.long	.LASF1627
+	.byte	0x2
+	.long	.LASF1581
+	.byte	0x4
+	.long	.LASF1628
+	.byte	0x5
+	.long	.LASF1629
+	.byte	0x4
+	.long	.LASF1630
+	.byte	0x4
+	.long	.LASF1631
+	.byte	0x5
+	.long	.LASF1632
+	.byte	0x2
+	.long	.LASF1633
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF448:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF869:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF954:
+	.string	"__DECL_SIMD_logf "
+.LASF421:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1300:
+	.string	"MATH_ERREXCEPT 2"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1187:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF847:
+	.string	"USE_BARO "
+.LASF1525:
+	.string	"hasValidWindEstimate"
+.LASF451:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1170:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF827:
+	.string	"_WCHAR_T_DEFINED "
+.LASF471:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF555:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1063:
+	.string	"__DECL_SIMD_sinh "
+.LASF1375:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF582:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF854:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF487:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF991:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF663:
+	.string	"__SQUAD_TYPE long int"
+.LASF1466:
+	.string	"ADC_BATTERY"
+.LASF1414:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF543:
+	.string	"__USE_MISC 1"
+.LASF472:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1127:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF1107:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF964:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF403:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1335:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1067:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF606:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1183:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1168:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF452:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1476:
+	.string	"ANTI_WINDUP"
+.LASF1440:
+	.string	"__uint8_t"
+.LASF717:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1502:
+	.string	"_Bool"
+.LASF1089:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF922:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF855:
+	.string	"USE_UART8 "
+.LASF891:
+	.string	"U_ID_2 2"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1549:
+	.string	"currentTimeUs"
+.LASF1232:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1131:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF559:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1462:
+	.string	"minutes"
+.LASF1059:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1352:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1558:
+	.string	"isGPSHeadingValid"
+.LASF1409:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1556:
+	.string	"axis"
+.LASF546:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF902:
+	.string	"FAST_CODE "
+.LASF1146:
+	.string	"__DECL_SIMD_erff16 "
+.LASF864:
+	.string	"USE_USB_MSC"
+.LASF510:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1526:
+	.string	"estimatedWind"
+.LASF908:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1216:
+	.string	"__f32x(x) x ##f32x"
+.LASF1434:
+	.string	"HDOP_SCALE (100)"
+.LASF1421:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1060:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF968:
+	.string	"__DECL_SIMD_expf64 "
+.LASF819:
+	.string	"__WCHAR_T__ "
+.LASF1388:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF398:
+	.string	"USE_SERIAL_RX "
+.LASF1550:
+	.string	"angle"
+.LASF1134:
+	.string	"__DECL_SIMD_acoshf "
+.LASF939:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF455:
+	.string	"USE_CMS "
+.LASF1112:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1065:
+	.string	"__DECL_SIMD_sinhl "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF927:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF580:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1472:
+	.string	"GPS_FIX"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF952:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1452:
+	.string	"uint16_t"
+.LASF965:
+	.string	"__DECL_SIMD_expl "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF1384:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF713:
+	.string	"__FD_SETSIZE 1024"
+.LASF671:
+	.string	"__STD_TYPE typedef"
+.LASF1233:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1546:
+	.string	"wind"
+.LASF1362:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1538:
+	.string	"fuselageDirection"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF946:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF483:
+	.string	"USE_CLI_BATCH "
+.LASF1347:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1295:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF921:
+	.string	"_MATH_H 1"
+.LASF897:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF773:
+	.string	"WINT_MAX (4294967295u)"
+.LASF789:
+	.string	"_T_PTRDIFF_ "
+.LASF393:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF751:
+	.string	"INT_FAST8_MAX (127)"
+.LASF660:
+	.string	"__U32_TYPE unsigned int"
+.LASF935:
+	.string	"__DECL_SIMD_sinl "
+.LASF1518:
+	.string	"velNED"
+.LASF858:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1310:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF675:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF770:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1403:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF508:
+	.string	"__USE_MISC"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF859:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1473:
+	.string	"CALIBRATE_MAG"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF818:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF956:
+	.string	"__DECL_SIMD_logf16 "
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF499:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF778:
+	.string	"UINT8_C(c) c"
+.LASF728:
+	.string	"INT16_MAX (32767)"
+.LASF618:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF680:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1217:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1012:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF955:
+	.string	"__DECL_SIMD_logl "
+.LASF1460:
+	.string	"month"
+.LASF709:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF578:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF704:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF443:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1192:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF810:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1539:
+	.string	"fuselageDirectionDiff"
+.LASF871:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1412:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF963:
+	.string	"__DECL_SIMD_exp "
+.LASF1524:
+	.string	"gpsSol"
+.LASF1173:
+	.string	"__DECL_SIMD_erfc "
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1333:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1247:
+	.string	"_Mdouble_"
+.LASF1450:
+	.string	"int32_t"
+.LASF1479:
+	.string	"COMPASS_CALIBRATED"
+.LASF1195:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF557:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1490:
+	.string	"ROVER"
+.LASF842:
+	.string	"USE_IMU_FAKE "
+.LASF1293:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1147:
+	.string	"__DECL_SIMD_erff32 "
+.LASF919:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF829:
+	.string	"___int_wchar_t_h "
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF490:
+	.string	"__USE_ISOC11"
+.LASF1509:
+	.string	"validVelD"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF863:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF437:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF882:
+	.string	"USE_RX_PPM"
+.LASF601:
+	.string	"__always_inline"
+.LASF1029:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1201:
+	.string	"__HAVE_FLOAT16 0"
+.LASF1062:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1061:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1488:
+	.string	"AIRPLANE"
+.LASF725:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1248:
+	.string	"__MATH_PRECNAME"
+.LASF1098:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF718:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF478:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1530:
+	.string	"sinf"
+.LASF1258:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1030:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF876:
+	.string	"USE_1WIRE_DS2482"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1251:
+	.string	"_Mdouble_ float"
+.LASF1536:
+	.string	"groundVelocityDiff"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF747:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF690:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1235:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF439:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF584:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF803:
+	.string	"_T_SIZE_ "
+.LASF845:
+	.string	"USE_FAKE_GPS "
+.LASF1241:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1402:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1135:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1284:
+	.string	"__MATHCALL_NARROW"
+.LASF574:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF614:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF440:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF635:
+	.string	"__stub_chflags "
+.LASF1269:
+	.string	"__MATHDECL_1"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1501:
+	.string	"gpsFixType_e"
+.LASF1261:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1144:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF774:
+	.string	"INT8_C(c) c"
+.LASF1349:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF814:
+	.string	"_GCC_SIZE_T "
+.LASF639:
+	.string	"__stub_setlogin "
+.LASF1205:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF893:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1087:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF641:
+	.string	"__stub_stty "
+.LASF1351:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF642:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1116:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1457:
+	.string	"timeDelta_t"
+.LASF1011:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF1419:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1023:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1236:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF776:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF465:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1041:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF798:
+	.string	"__need_ptrdiff_t"
+.LASF404:
+	.string	"USE_ADC_AVERAGING "
+.LASF1296:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF659:
+	.string	"__S32_TYPE int"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1152:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1197:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1369:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1461:
+	.string	"hours"
+.LASF613:
+	.string	"__attribute_copy__"
+.LASF811:
+	.string	"_SIZE_T_DECLARED "
+.LASF475:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF643:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF724:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1338:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF430:
+	.string	"USE_OPFLOW "
+.LASF1513:
+	.string	"gpsSolutionData_s"
+.LASF415:
+	.string	"USE_PITOT "
+.LASF875:
+	.string	"USE_1WIRE"
+.LASF1399:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1360:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1080:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF594:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1048:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF887:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF820:
+	.string	"_WCHAR_T "
+.LASF1408:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1124:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF654:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1422:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF982:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1342:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1493:
+	.string	"MOVE_FORWARD_ONLY"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1541:
+	.string	"timeDelta"
+.LASF795:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1341:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF756:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1441:
+	.string	"__int16_t"
+.LASF1077:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1547:
+	.string	"prevWindLength"
+.LASF1443:
+	.string	"__uint16_t"
+.LASF1220:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF913:
+	.string	"false 0"
+.LASF1049:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1016:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1507:
+	.string	"gpsHeartbeat"
+.LASF1560:
+	.string	"isEstimatedWindSpeedValid"
+.LASF531:
+	.string	"__USE_POSIX 1"
+.LASF494:
+	.string	"__USE_POSIX"
+.LASF830:
+	.string	"__INT_WCHAR_T_H "
+.LASF1094:
+	.string	"__DECL_SIMD_log10f "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1019:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1306:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1519:
+	.string	"groundSpeed"
+.LASF625:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF988:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF816:
+	.string	"__size_t "
+.LASF754:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1395:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1050:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF910:
+	.string	"_STDBOOL_H "
+.LASF1158:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1305:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF951:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF644:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF979:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1020:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF611:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1298:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1370:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1037:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF650:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF442:
+	.string	"USE_OLED_UG2864 "
+.LASF1313:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF459:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF482:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1282:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF738:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1435:
+	.string	"unsigned char"
+.LASF721:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF895:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF980:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1111:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF626:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1226:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1410:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1339:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF796:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1387:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF409:
+	.string	"USE_NAV "
+.LASF358:
+	.string	"__k8 1"
+.LASF903:
+	.string	"NOINLINE "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1455:
+	.string	"float"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF492:
+	.string	"__USE_ISOC95"
+.LASF491:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF901:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF775:
+	.string	"INT16_C(c) c"
+.LASF1271:
+	.string	"__MATHDECL"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1145:
+	.string	"__DECL_SIMD_erfl "
+.LASF1085:
+	.string	"__DECL_SIMD_atan2l "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF720:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1006:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF788:
+	.string	"_PTRDIFF_T "
+.LASF622:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF501:
+	.string	"__USE_XOPEN2K"
+.LASF497:
+	.string	"__USE_POSIX199506"
+.LASF1322:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF562:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF420:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1102:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF920:
+	.string	"_STRINGS_H 1"
+.LASF1371:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF1071:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF521:
+	.string	"_DEFAULT_SOURCE"
+.LASF407:
+	.string	"USE_GPS "
+.LASF743:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1359:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF600:
+	.string	"__wur "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF918:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF563:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF402:
+	.string	"USE_SERIALRX_FPORT "
+.LASF996:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1299:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1523:
+	.string	"gpsSolutionData_t"
+.LASF831:
+	.string	"_GCC_WCHAR_T "
+.LASF888:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1255:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1292:
+	.string	"FP_NORMAL 4"
+.LASF522:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF826:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF682:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF470:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1243:
+	.string	"_Mdouble_ double"
+.LASF561:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1018:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF1553:
+	.string	"horizontalWindAngle"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF560:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF722:
+	.string	"__intptr_t_defined "
+.LASF730:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF741:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF616:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1044:
+	.string	"__DECL_SIMD_coshf "
+.LASF1483:
+	.string	"NAV_CRUISE_BRAKING_BOOST"
+.LASF1125:
+	.string	"__DECL_SIMD_atanhl "
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF573:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF664:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1117:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF637:
+	.string	"__stub_gtty "
+.LASF1176:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF504:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1265:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF886:
+	.string	"USE_ITCM_RAM"
+.LASF758:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1069:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1206:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF542:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1245:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1076:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF840:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF624:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF932:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF780:
+	.string	"UINT32_C(c) c ## U"
+.LASF1095:
+	.string	"__DECL_SIMD_log10l "
+.LASF511:
+	.string	"__USE_GNU"
+.LASF879:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1423:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF734:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1511:
+	.string	"validEPE"
+.LASF874:
+	.string	"USE_PITOT_ADC"
+.LASF972:
+	.string	"__DECL_SIMD_expf128x "
+.LASF446:
+	.string	"USE_DJI_HD_OSD "
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1118:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1208:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF777:
+	.string	"INT64_C(c) c ## L"
+.LASF1278:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF513:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF670:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1188:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF714:
+	.string	"_BITS_TIME64_H 1"
+.LASF753:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF1082:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF694:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF586:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1331:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1101:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1004:
+	.string	"__DECL_SIMD_asinf "
+.LASF432:
+	.string	"USE_OPFLOW_MSP "
+.LASF506:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF801:
+	.string	"_SIZE_T "
+.LASF602:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF658:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1327:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF597:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1275:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1246:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1259:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF587:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1534:
+	.string	"lastUpdateUs"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1128:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF924:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF517:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF914:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1203:
+	.string	"__HAVE_FLOAT64 1"
+.LASF813:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1312:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF808:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1400:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF412:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1532:
+	.string	"sqrtf"
+.LASF696:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1451:
+	.string	"uint8_t"
+.LASF1533:
+	.string	"atan2_approx"
+.LASF636:
+	.string	"__stub_fchflags "
+.LASF422:
+	.string	"USE_RX_UIB "
+.LASF662:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1268:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1540:
+	.string	"fuselageDirectionSum"
+.LASF1249:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1416:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF498:
+	.string	"__USE_XOPEN"
+.LASF989:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF520:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1181:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1163:
+	.string	"__DECL_SIMD_asinh "
+.LASF1055:
+	.string	"__DECL_SIMD_expm1l "
+.LASF880:
+	.string	"USE_ADC"
+.LASF540:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF629:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1542:
+	.string	"diffLengthSq"
+.LASF1316:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF535:
+	.string	"__USE_XOPEN2K 1"
+.LASF1191:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF666:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF900:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF695:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF621:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF990:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1537:
+	.string	"groundVelocitySum"
+.LASF376:
+	.string	"unix 1"
+.LASF1289:
+	.string	"FP_INFINITE 1"
+.LASF1279:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1280:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1281:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF933:
+	.string	"__DECL_SIMD_sin "
+.LASF1510:
+	.string	"validMag"
+.LASF427:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF787:
+	.string	"_ANSI_STDDEF_H "
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF524:
+	.string	"__USE_ISOC99 1"
+.LASF834:
+	.string	"_BSD_WCHAR_T_"
+.LASF1129:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF1091:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1199:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF865:
+	.string	"USE_SERVO_SBUS"
+.LASF620:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF806:
+	.string	"_SIZE_T_ "
+.LASF1535:
+	.string	"groundVelocity"
+.LASF881:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF817:
+	.string	"__need_size_t"
+.LASF599:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1481:
+	.string	"PWM_DRIVER_AVAILABLE"
+.LASF976:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1007:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1224:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF428:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1045:
+	.string	"__DECL_SIMD_coshl "
+.LASF1321:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1250:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1263:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1427:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF785:
+	.string	"_STDDEF_H "
+.LASF1130:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF844:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF768:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1277:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1026:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF784:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF783:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF500:
+	.string	"__USE_UNIX98"
+.LASF961:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1430:
+	.string	"LON 1"
+.LASF1252:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF566:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1356:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1346:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF997:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF417:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1079:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1391:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF708:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1120:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF1056:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF416:
+	.string	"USE_PITOT_ADC "
+.LASF735:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF710:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF748:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1517:
+	.string	"magData"
+.LASF1557:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF781:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1198:
+	.string	"__f128(x) x ##f128"
+.LASF1136:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1254:
+	.string	"_Mdouble_ long double"
+.LASF936:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF736:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1390:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1177:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1401:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1088:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1005:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1184:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF548:
+	.string	"__GNU_LIBRARY__"
+.LASF1459:
+	.string	"year"
+.LASF544:
+	.string	"__USE_ATFILE 1"
+.LASF533:
+	.string	"__USE_POSIX199309 1"
+.LASF1407:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1552:
+	.string	"yWindSpeed"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF883:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF925:
+	.string	"__DECL_SIMD_cosl "
+.LASF1043:
+	.string	"__DECL_SIMD_cosh "
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF745:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1237:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF1355:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF836:
+	.string	"NULL"
+.LASF1471:
+	.string	"GPS_FIX_HOME"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1253:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF473:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF687:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1344:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF554:
+	.string	"__PMT"
+.LASF832:
+	.string	"_WCHAR_T_DECLARED "
+.LASF431:
+	.string	"USE_OPFLOW_CXOF "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF418:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1151:
+	.string	"__DECL_SIMD_erff64x "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1104:
+	.string	"__DECL_SIMD_log2f "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1478:
+	.string	"NAV_MOTOR_STOP_OR_IDLE"
+.LASF904:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF556:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF949:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1153:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1426:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF953:
+	.string	"__DECL_SIMD_log "
+.LASF1531:
+	.string	"atan2f"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1196:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1394:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF479:
+	.string	"USE_VTX_TRAMP "
+.LASF1413:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF655:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF607:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF661:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF414:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1325:
+	.string	"UNIT_TESTED "
+.LASF957:
+	.string	"__DECL_SIMD_logf32 "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF1520:
+	.string	"groundCourse"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF762:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF550:
+	.string	"__GLIBC__ 2"
+.LASF1093:
+	.string	"__DECL_SIMD_log10 "
+.LASF1543:
+	.string	"theta"
+.LASF749:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1002:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF729:
+	.string	"INT32_MAX (2147483647)"
+.LASF1468:
+	.string	"ADC_CURRENT"
+.LASF824:
+	.string	"_WCHAR_T_ "
+.LASF1357:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF1001:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF564:
+	.string	"__P(args) args"
+.LASF1212:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1486:
+	.string	"AIRMODE_ACTIVE"
+.LASF1363:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF761:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF739:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1343:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF802:
+	.string	"_SYS_SIZE_T_H "
+.LASF686:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1454:
+	.string	"uint64_t"
+.LASF1262:
+	.string	"_Mdouble_ _Float128"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1172:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1119:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF512:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1484:
+	.string	"NAV_CRUISE_BRAKING_LOCKED"
+.LASF399:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1058:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1428:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1485:
+	.string	"NAV_EXTRA_ARMING_SAFETY_BYPASSED"
+.LASF697:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1528:
+	.string	"lastFuselageDirection"
+.LASF727:
+	.string	"INT8_MAX (127)"
+.LASF1494:
+	.string	"SET_REVERSIBLE_MOTORS_FORWARD"
+.LASF1115:
+	.string	"__DECL_SIMD_log1pl "
+.LASF503:
+	.string	"__USE_XOPEN2K8"
+.LASF769:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1042:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1548:
+	.string	"windLength"
+.LASF1498:
+	.string	"GPS_NO_FIX"
+.LASF947:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF698:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF838:
+	.string	"__need_NULL"
+.LASF839:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1283:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF516:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF433:
+	.string	"USE_PITOT_MS4525 "
+.LASF1264:
+	.string	"_Mdouble_ _Float32x"
+.LASF541:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1467:
+	.string	"ADC_RSSI"
+.LASF505:
+	.string	"__USE_LARGEFILE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1064:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1227:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1009:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF977:
+	.string	"__DECL_SIMD_powf32 "
+.LASF571:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1108:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF993:
+	.string	"__DECL_SIMD_atan "
+.LASF1039:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF771:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1270:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1420:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF425:
+	.string	"USE_RANGEFINDER "
+.LASF1397:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF1376:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF755:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1027:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF570:
+	.string	"__END_DECLS "
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1010:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1113:
+	.string	"__DECL_SIMD_log1p "
+.LASF915:
+	.string	"_STRING_H 1"
+.LASF1185:
+	.string	"__DECL_SIMD_tanl "
+.LASF1040:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF683:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1499:
+	.string	"GPS_FIX_2D"
+.LASF453:
+	.string	"USE_LOG "
+.LASF1334:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1449:
+	.string	"int16_t"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF835:
+	.string	"__need_wchar_t"
+.LASF1436:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1489:
+	.string	"MULTIROTOR"
+.LASF1439:
+	.string	"signed char"
+.LASF1213:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF958:
+	.string	"__DECL_SIMD_logf64 "
+.LASF941:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF460:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1057:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF799:
+	.string	"__size_t__ "
+.LASF1365:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF1286:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1377:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF828:
+	.string	"_WCHAR_T_H "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF590:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1137:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1141:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1373:
+	.string	"sq(x) ((x)*(x))"
+.LASF937:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF1109:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF763:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF634:
+	.string	"__stub___compat_bdflush "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF426:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1274:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF489:
+	.string	"_FEATURES_H 1"
+.LASF1215:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF807:
+	.string	"_BSD_SIZE_T_ "
+.LASF608:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF592:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF866:
+	.string	"USE_DASHBOARD"
+.LASF480:
+	.string	"USE_VTX_FFPV "
+.LASF1429:
+	.string	"LAT 0"
+.LASF1317:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1105:
+	.string	"__DECL_SIMD_log2l "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF633:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF684:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1204:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF450:
+	.string	"USE_ANTIGRAVITY "
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF711:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF894:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF628:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1256:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1374:
+	.string	"FAST_MATH "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1239:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1337:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1166:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF906:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1301:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF396:
+	.string	"USE_I2C_PULLUP "
+.LASF1022:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF959:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1081:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF841:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1320:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1503:
+	.string	"_dateTime_s"
+.LASF1308:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1361:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1506:
+	.string	"hasNewData"
+.LASF1424:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1234:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF623:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF750:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF401:
+	.string	"USE_SERIALRX_IBUS "
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF950:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1411:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1139:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1214:
+	.string	"__f32(x) x ##f32"
+.LASF678:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1290:
+	.string	"FP_ZERO 2"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1332:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF677:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF966:
+	.string	"__DECL_SIMD_expf16 "
+.LASF877:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF435:
+	.string	"USE_1WIRE_DS2482 "
+.LASF627:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF568:
+	.string	"__ptr_t void *"
+.LASF873:
+	.string	"USE_PITOT_MS4525"
+.LASF1110:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF667:
+	.string	"__SLONG32_TYPE int"
+.LASF1522:
+	.string	"time"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF733:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF1496:
+	.string	"stateFlags"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF526:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF457:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF493:
+	.string	"__USE_ISOCXX11"
+.LASF1366:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1446:
+	.string	"long int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1106:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1554:
+	.string	"getEstimatedHorizontalWindSpeed"
+.LASF519:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF461:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF723:
+	.string	"INT8_MIN (-128)"
+.LASF1142:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF731:
+	.string	"UINT8_MAX (255)"
+.LASF581:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF884:
+	.string	"USE_RCDEVICE"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1379:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF565:
+	.string	"__PMT(args) args"
+.LASF792:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF553:
+	.string	"_SYS_CDEFS_H 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF740:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF791:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1070:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1238:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1417:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF700:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF782:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1073:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1447:
+	.string	"__uint64_t"
+.LASF1244:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1453:
+	.string	"uint32_t"
+.LASF805:
+	.string	"__SIZE_T "
+.LASF705:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1218:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1311:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1103:
+	.string	"__DECL_SIMD_log2 "
+.LASF1529:
+	.string	"cosf"
+.LASF1406:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF688:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1122:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1464:
+	.string	"millis"
+.LASF804:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1561:
+	.string	"cmpTimeUs"
+.LASF1219:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1273:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1132:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF532:
+	.string	"__USE_POSIX2 1"
+.LASF1161:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF583:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF577:
+	.string	"__flexarr []"
+.LASF1221:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF518:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF973:
+	.string	"__DECL_SIMD_pow "
+.LASF656:
+	.string	"_BITS_TYPES_H 1"
+.LASF1438:
+	.string	"long unsigned int"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF744:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF485:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1307:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1326:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF579:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF647:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1354:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF821:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF456:
+	.string	"CMS_MENU_OSD "
+.LASF737:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF529:
+	.string	"_POSIX_C_SOURCE"
+.LASF942:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF833:
+	.string	"__DEFINED_wchar_t "
+.LASF1336:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1319:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF411:
+	.string	"USE_TELEMETRY_LTM "
+.LASF405:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF752:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF477:
+	.string	"USE_VTX_CONTROL "
+.LASF1448:
+	.string	"char"
+.LASF1276:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF679:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF640:
+	.string	"__stub_sigreturn "
+.LASF1159:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1207:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF929:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1386:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1096:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF657:
+	.string	"__S16_TYPE short int"
+.LASF1013:
+	.string	"__DECL_SIMD_hypot "
+.LASF1229:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1418:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF701:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1053:
+	.string	"__DECL_SIMD_expm1 "
+.LASF530:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF596:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF463:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF928:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1100:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF992:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1330:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF719:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF612:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1396:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF467:
+	.string	"USE_RX_MSP "
+.LASF1404:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF912:
+	.string	"true 1"
+.LASF1551:
+	.string	"xWindSpeed"
+.LASF930:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF603:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1555:
+	.string	"getEstimatedWindSpeed"
+.LASF429:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF984:
+	.string	"__DECL_SIMD_acosf "
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF691:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF809:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF970:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1167:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1309:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF716:
+	.string	"__STD_TYPE"
+.LASF1392:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF702:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF746:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF674:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF668:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1202:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF917:
+	.string	"__need_NULL "
+.LASF1072:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1372:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1179:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1008:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF837:
+	.string	"NULL ((void *)0)"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF916:
+	.string	"__need_size_t "
+.LASF1164:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1140:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF400:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1465:
+	.string	"dateTime_t"
+.LASF726:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF589:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1323:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF630:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF843:
+	.string	"USE_FAKE_BARO "
+.LASF619:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1358:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1180:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF1034:
+	.string	"__DECL_SIMD_exp10f "
+.LASF967:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1425:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF604:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1364:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF760:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1223:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF790:
+	.string	"_T_PTRDIFF "
+.LASF998:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1190:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1133:
+	.string	"__DECL_SIMD_acosh "
+.LASF1500:
+	.string	"GPS_FIX_3D"
+.LASF1189:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF408:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF371:
+	.string	"__linux 1"
+.LASF1285:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1497:
+	.string	"rMat"
+.LASF552:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1318:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1288:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF632:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1210:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF462:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1090:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF419:
+	.string	"USE_GYRO_KALMAN "
+.LASF1046:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1143:
+	.string	"__DECL_SIMD_erf "
+.LASF1304:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF1383:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF538:
+	.string	"_ATFILE_SOURCE 1"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF605:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1178:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF572:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF983:
+	.string	"__DECL_SIMD_acos "
+.LASF515:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1480:
+	.string	"ACCELEROMETER_CALIBRATED"
+.LASF1054:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1078:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF960:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1348:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF507:
+	.string	"__USE_FILE_OFFSET64"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF413:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1148:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1516:
+	.string	"numSat"
+.LASF1315:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1456:
+	.string	"double"
+.LASF870:
+	.string	"USE_RANGEFINDER"
+.LASF1477:
+	.string	"FLAPERON_AVAILABLE"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF986:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF689:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1242:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1156:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF699:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1160:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF825:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1031:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF395:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1474:
+	.string	"SMALL_ANGLE"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF742:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1487:
+	.string	"ESC_SENSOR_ENABLED"
+.LASF899:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF591:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1303:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1444:
+	.string	"__int32_t"
+.LASF1230:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1297:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1445:
+	.string	"__uint32_t"
+.LASF994:
+	.string	"__DECL_SIMD_atanf "
+.LASF488:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1171:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF495:
+	.string	"__USE_POSIX2"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1068:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF878:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1482:
+	.string	"NAV_CRUISE_BRAKING"
+.LASF458:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF985:
+	.string	"__DECL_SIMD_acosl "
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF665:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF502:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1508:
+	.string	"validVelNE"
+.LASF1200:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF757:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF397:
+	.string	"USE_RX_PPM "
+.LASF441:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1121:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF974:
+	.string	"__DECL_SIMD_powf "
+.LASF822:
+	.string	"_T_WCHAR "
+.LASF815:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF732:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1149:
+	.string	"__DECL_SIMD_erff128 "
+.LASF707:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF786:
+	.string	"_STDDEF_H_ "
+.LASF715:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF797:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1003:
+	.string	"__DECL_SIMD_asin "
+.LASF672:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1491:
+	.string	"BOAT"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1272:
+	.string	"__MATHCALL"
+.LASF1097:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1165:
+	.string	"__DECL_SIMD_asinhl "
+.LASF1475:
+	.string	"FIXED_WING_LEGACY"
+.LASF779:
+	.string	"UINT16_C(c) c"
+.LASF609:
+	.string	"__restrict_arr __restrict"
+.LASF454:
+	.string	"USE_STATS "
+.LASF846:
+	.string	"USE_MAG "
+.LASF765:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1150:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1123:
+	.string	"__DECL_SIMD_atanh "
+.LASF853:
+	.string	"USE_UART6 "
+.LASF1432:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1231:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF496:
+	.string	"__USE_POSIX199309"
+.LASF767:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1035:
+	.string	"__DECL_SIMD_exp10l "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1367:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1527:
+	.string	"lastGroundVelocity"
+.LASF793:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF823:
+	.string	"__WCHAR_T "
+.LASF648:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1052:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1014:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF948:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF794:
+	.string	"___int_ptrdiff_t_h "
+.LASF971:
+	.string	"__DECL_SIMD_expf64x "
+.LASF999:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1291:
+	.string	"FP_SUBNORMAL 3"
+.LASF1209:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1294:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF1266:
+	.string	"_Mdouble_ _Float64x"
+.LASF1458:
+	.string	"timeUs_t"
+.LASF890:
+	.string	"U_ID_1 1"
+.LASF889:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1092:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF712:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1545:
+	.string	"costheta"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF978:
+	.string	"__DECL_SIMD_powf64 "
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF944:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1194:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1469:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF651:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1000:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF394:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF527:
+	.string	"_POSIX_SOURCE"
+.LASF1028:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1368:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF569:
+	.string	"__BEGIN_DECLS "
+.LASF1024:
+	.string	"__DECL_SIMD_exp2f "
+.LASF481:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF940:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF1470:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF486:
+	.string	"_STDINT_H 1"
+.LASF523:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1222:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF424:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF1193:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF449:
+	.string	"USE_D_BOOST "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF534:
+	.string	"__USE_POSIX199506 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF892:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF1257:
+	.string	"_Mdouble_ _Float32"
+.LASF638:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF610:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF867:
+	.string	"USE_OLED_UG2864"
+.LASF676:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1328:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1114:
+	.string	"__DECL_SIMD_log1pf "
+.LASF484:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF905:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF860:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1504:
+	.string	"gpsLocation_s"
+.LASF1505:
+	.string	"gpsLocation_t"
+.LASF536:
+	.string	"__USE_XOPEN2K8 1"
+.LASF576:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1051:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF468:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF645:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF558:
+	.string	"__LEAF , __leaf__"
+.LASF1162:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1033:
+	.string	"__DECL_SIMD_exp10 "
+.LASF539:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF706:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1047:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1021:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1138:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1398:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF938:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF537:
+	.string	"_ATFILE_SOURCE"
+.LASF474:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF434:
+	.string	"USE_1WIRE "
+.LASF1154:
+	.string	"__DECL_SIMD_tanhf "
+.LASF631:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1186:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF547:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF652:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1211:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1038:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF981:
+	.string	"__DECL_SIMD_powf64x "
+.LASF931:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF585:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1324:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF861:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF528:
+	.string	"_POSIX_SOURCE 1"
+.LASF995:
+	.string	"__DECL_SIMD_atanl "
+.LASF1381:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF1174:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1405:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF764:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF911:
+	.string	"bool _Bool"
+.LASF907:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1126:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1492:
+	.string	"ALTITUDE_CONTROL"
+.LASF703:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1032:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1099:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1066:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF923:
+	.string	"__DECL_SIMD_cos "
+.LASF406:
+	.string	"USE_BLACKBOX "
+.LASF987:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1495:
+	.string	"FW_HEADING_USE_YAW"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1074:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF410:
+	.string	"USE_TELEMETRY "
+.LASF975:
+	.string	"__DECL_SIMD_powl "
+.LASF549:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF693:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF772:
+	.string	"WINT_MIN (0u)"
+.LASF1157:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF438:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF862:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1260:
+	.string	"_Mdouble_ _Float64"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF885:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1267:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF812:
+	.string	"__DEFINED_size_t "
+.LASF447:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1433:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF848:
+	.string	"USE_UART1 "
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1380:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF593:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF445:
+	.string	"USE_FRSKYOSD "
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF896:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF509:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1314:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF856:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF374:
+	.string	"__unix 1"
+.LASF615:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1015:
+	.string	"__DECL_SIMD_hypotl "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF926:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF469:
+	.string	"USE_SERIALRX_SUMH "
+.LASF595:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1521:
+	.string	"hdop"
+.LASF436:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF759:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF849:
+	.string	"USE_UART2 "
+.LASF514:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF649:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF766:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1431:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF1340:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1083:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1382:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF945:
+	.string	"__DECL_SIMD_sincosl "
+.LASF692:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1228:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1225:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1442:
+	.string	"short int"
+.LASF1512:
+	.string	"validTime"
+.LASF1389:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF685:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1025:
+	.string	"__DECL_SIMD_exp2l "
+.LASF962:
+	.string	"__DECL_SIMD_logf128x "
+.LASF850:
+	.string	"USE_UART3 "
+.LASF1385:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1240:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF909:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF800:
+	.string	"__SIZE_T__ "
+.LASF1345:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF476:
+	.string	"USE_RCDEVICE "
+.LASF1393:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF681:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF575:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1559:
+	.string	"updateWindEstimator"
+.LASF567:
+	.string	"__STRING(x) #x"
+.LASF872:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1378:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF545:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1437:
+	.string	"unsigned int"
+.LASF851:
+	.string	"USE_UART4 "
+.LASF1017:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1182:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1287:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF588:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF653:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF598:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1084:
+	.string	"__DECL_SIMD_atan2f "
+.LASF943:
+	.string	"__DECL_SIMD_sincos "
+.LASF1155:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF464:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF673:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF551:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1353:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1036:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF423:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF934:
+	.string	"__DECL_SIMD_sinf "
+.LASF466:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1086:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF969:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF23:
+	.string	"_LP64 1"
+.LASF852:
+	.string	"USE_UART5 "
+.LASF669:
+	.string	"__S64_TYPE long int"
+.LASF1515:
+	.string	"fixType"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF444:
+	.string	"USE_TELEMETRY_SIM "
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1175:
+	.string	"__DECL_SIMD_erfcl "
+.LASF868:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1329:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF617:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF898:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1544:
+	.string	"sintheta"
+.LASF1350:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF646:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF525:
+	.string	"__USE_ISOC95 1"
+.LASF1302:
+	.string	"M_E 2.7182818284590452354"
+.LASF1514:
+	.string	"flags"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF857:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1169:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1463:
+	.string	"seconds"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1075:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1415:
+	.string	"MAX_NAME_LENGTH 16"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1629:
+	.string	"io_types.h"
+.LASF1623:
+	.string	"mathcalls-helper-functions.h"
+.LASF1615:
+	.string	"math.h"
+.LASF1601:
+	.string	"long-double.h"
+.LASF1613:
+	.string	"__locale_t.h"
+.LASF1591:
+	.string	"platform.h"
+.LASF1588:
+	.string	"mathcalls.h"
+.LASF1593:
+	.string	"target.h"
+.LASF1582:
+	.string	"axis.h"
+.LASF1617:
+	.string	"libm-simd-decl-stubs.h"
+.LASF1595:
+	.string	"libc-header-start.h"
+.LASF1610:
+	.string	"stdbool.h"
+.LASF1575:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1614:
+	.string	"strings.h"
+.LASF1579:
+	.string	"stdint-intn.h"
+.LASF1581:
+	.string	"time.h"
+.LASF1574:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1577:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1602:
+	.string	"stubs.h"
+.LASF1569:
+	.string	"src/main/target/SITL"
+.LASF1568:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1600:
+	.string	"cdefs.h"
+.LASF1573:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1628:
+	.string	"config.h"
+.LASF1585:
+	.string	"imu.h"
+.LASF1611:
+	.string	"string.h"
+.LASF1597:
+	.string	"features-time64.h"
+.LASF1578:
+	.string	"types.h"
+.LASF1616:
+	.string	"math-vector.h"
+.LASF1619:
+	.string	"floatn-common.h"
+.LASF1618:
+	.string	"floatn.h"
+.LASF1584:
+	.string	"runtime_config.h"
+.LASF1565:
+	.string	"src/main/drivers"
+.LASF1576:
+	.string	"/usr/include"
+.LASF1562:
+	.string	"src/main/build"
+.LASF1608:
+	.string	"sanity_check.h"
+.LASF1596:
+	.string	"features.h"
+.LASF1567:
+	.string	"src/main/flight"
+.LASF1604:
+	.string	"typesizes.h"
+.LASF1563:
+	.string	"src/main/common"
+.LASF1564:
+	.string	"src/main/config"
+.LASF1599:
+	.string	"timesize.h"
+.LASF1605:
+	.string	"time64.h"
+.LASF1580:
+	.string	"stdint-uintn.h"
+.LASF1570:
+	.string	"src/main/target"
+.LASF1630:
+	.string	"rx_pwm.h"
+.LASF1620:
+	.string	"flt-eval-method.h"
+.LASF1571:
+	.string	"src/main"
+.LASF1587:
+	.string	"wind_estimator.c"
+.LASF1625:
+	.string	"debug.h"
+.LASF1606:
+	.string	"wchar.h"
+.LASF1622:
+	.string	"fp-fast.h"
+.LASF1631:
+	.string	"stats.h"
+.LASF1586:
+	.string	"gps.h"
+.LASF1566:
+	.string	"src/main/fc"
+.LASF1592:
+	.string	"common.h"
+.LASF1633:
+	.string	"quaternion.h"
+.LASF1589:
+	.string	"maths.h"
+.LASF1621:
+	.string	"fp-logb.h"
+.LASF0:
+	.string	"./src/main/flight/wind_estimator.c"
+.LASF1572:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1612:
+	.string	"locale_t.h"
+.LASF1594:
+	.string	"stdint.h"
+.LASF1624:
+	.string	"build_config.h"
+.LASF1607:
+	.string	"stddef.h"
+.LASF1603:
+	.string	"stubs-64.h"
+.LASF1632:
+	.string	"vector.h"
+.LASF1598:
+	.string	"wordsize.h"
+.LASF1609:
+	.string	"common_post.h"
+.LASF1583:
+	.string	"adc.h"
+.LASF1626:
+	.string	"parameter_group.h"
+.LASF1590:
+	.string	"stdc-predef.h"
+.LASF1627:
+	.string	"filter.h"
+	.text
+	.section	.gnu.lto_.profile.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375 \360\305\003"
+	.string	"T\005\344"
+	.string	"\t"
+	.string	"\330\216\311\314\016\002\002"
+	.string	"\002"
+	.string	"\001\352\263\360\321\b\002\305\224\260\330\001\002\002\001\002\002\003\222\241\246\302\004\004\376\212\201\336\001\006\003\002\003\005\255\201\222\254\005J\002\004\002\004\002"
+	.string	"\002\005\006\001\002\007\b\t"
+	.string	"\002"
+	.string	"\t\n\240\342\234\212\n\013\240\342\234\212\n"
+	.string	"\016"
+	.string	"H\023ZC"
+	.string	"S\331\020\225\002+\004Z "
+	.ascii	"\324\3139\006\264\003&\200\213][\321\\\005\006m"
+	.text
+	.section	.gnu.lto_.ipa_sra.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375 <\r\001"
+	.string	"\2000"
+	.string	"\004"
+	.string	""
+	.string	"\003\002\001\003\004"
+	.string	"\002"
+	.string	""
+	.string	"\005\001\006"
+	.ascii	"\271\rI\325u\271Ze\260\314P6\200\005"
+	.text
+	.section	.gnu.lto_.inline.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375`U"
+	.string	"\255\005"
+	.string	"b\211\036'\200K\322\001\234MXl8\353\025\313Y\215\025\254;\264\217\236i\210\217\277\0012R\030\230\301\251\332~\305\325\332\336r\247\377O5\264C\311,\307\231\016\275H0\236s\f]aWX\317\247\362\n\013`\336$\264\261ad\356</\374d\232\0075`\253W'\2555\t\372\261\247\210\260\211;\"\n\251D\026\2023\361\227z\337xA\367\277\327\212\276\320\366\317\302\326Z\313\317o\020\026"
+	.string	"My\360\342"
+	.string	"\006A\030\002`yx\242"
+	.string	"#8\200\306q\316\002\323d\203\221\210\366\303\016\031\326\256m\234\242\207\013XY\271I"
+	.ascii	"\247h\232)\236\3454\027[\013\340\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375 e\205\001"
+	.string	"\260Y"
+	.string	"\004"
+	.string	""
+	.string	""
+	.string	"\002\001\001\003\177\002\n\004\003\002\005\013\002\004"
+	.string	""
+	.string	"\013"
+	.string	"?7\200\352"
+	.string	"\204C\331"
+	.ascii	"v\2401\234\"\270\013t\022V\271i\003X"
+	.text
+	.section	.gnu.lto_.pureconst.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375 \021\211"
+	.string	""
+	.string	"\r"
+	.string	""
+	.string	""
+	.string	"\004"
+	.ascii	"\204\004\002\204\004\004\232\004\005\232\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375 \231%\003"
+	.string	"RE\021\034\2405\351\377\377g\301\372\0176\277\241\252j\002\267"
+	.string	"\231\355\326\333\326x\273D\232\224)7K\360\312\263\032sVc\317\251\312U\223N\244\375\350\274\362kJ\314w\317\2152@T\224\023\345/4v\016\345\350\007\004\013"
+	.string	"[\020\276\304\024S\210\257T8\273a"
+	.ascii	"9\334\304\372bbgge\200\001\024\001"
+	.text
+	.section	.gnu.lto_.lto.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_estimatedWind.46.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375 >\215\001"
+	.string	"d\0021"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001#\002"
+	.string	""
+	.string	""
+	.string	"\317"
+	.string	"\005\001\006\025\001\002?\202\210\200\030\1773\276\0014\275\001\274\001\273\001"
+	.string	"\003"
+	.string	",\031\220i\352"
+	.ascii	"\340"
+	.text
+	.section	.gnu.lto_isEstimatedWindSpeedValid.49.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375 \361\305\006"
+	.string	"\262\214/4Po\322\030\200\342}n\245\322D\357\301u-\036\252c\261[}\217\372fQ\353y \021A.0P\255\323\314\314\212VG{1\353\fc\230\210D\220\2242\005k0\227\205e8\017\363l\032\034:\217\302a\021\020O\342\301u^\206\3434\227\307a.[\023\233\313a\226u\271j[\324R\352\201H-\036Ep$\033?\256\370$jH\215\237"
+	.string	"\244R\t<4Dy\272\332\330d\371-\224\312\361\b\260Z\372\363\324\201\224\202\223\335\321\251eQ(\023\220\037\364\325\n\013\2403\203\0135\2310HVv7\247\035\230af#\206\340\245DE#\2050\005\030v\367\324H\031\270\342\217\360'\374\243\b"
+	.ascii	"2\001\0038\003X\034\240k\270[\304@B\344q7:\355$\003"
+	.text
+	.section	.gnu.lto_getEstimatedWindSpeed.50.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375`V"
+	.string	"U\t"
+	.string	"\226\021B< \005)\035"
+	.string	"\\$\200\001\315\005\337\fS\251X\275\007\300\367\314\006\n\2301\240>\374\317\273\372\035\301$\357\004\330k\251"
+	.string	"\004\213\005\204\326\317y\246\241\035C\312\220q\264\376M\366N)0"
+	.string	"/"
+	.string	"0"
+	.string	"\263\007\016\316\343\246\203\305fw\253\347\006\234\323\355\005\234\3239\362\361r\364\037;C\310\f\253\245\272\fp\330]KV\013\344\236\267\275`\033\3026L\322\363\260_n\004-\0072\273\037\265"
+	.string	"KCi%\366e\243\315\331\003(\241\313\307\016s\214\005v]./\273\333\340O\347\324\266o\362\223\321\016;_szVsC\343+\236uvW\344\247\\\005\303'95*%\317:\365S3\241\206\266\2225s\256\225"
+	.string	"l\231JN\021\373\333\316\227-\003\026\201\274\217\350\023\002u\b\247/\303\333<\352BP\364J\237x\"EH\230>T\025+(>\213\211j\372\274R\035\205\247\332)\030\274 \205U\004\301\260r\262\375\026\013"
+	.string	"\246\023\241Lh\354\013\334\212\202\214\305k1a\271\206\0231\341N\0256"
+	.ascii	"jL\347\232d"
+	.text
+	.section	.gnu.lto_getEstimatedHorizontalWindSpeed.51.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375`Z\004\275\034"
+	.string	"\366\364\270H\240\230Q:\300\365\205\230\310\026\013v\276\227\231\340\245\353\320\200\034:\3714\316\306\360\270O\365\021\372\030\372\277\237\330\227\332t\203\032x\371\207\234\347\303\353\340\303\006s\006%=\2206\356\355s\022\325X)\217f\t\331r\247\024\244"
+	.string	"\232"
+	.string	"\246"
+	.string	".aFN\236\222\371"
+	.string	"T\244\336\210\035\026\\\037a)hG\342)\327.\305\200_\026\t/\265V\005\037-\301U\226\241}\3327\362#E\027\212x\200Z\227\264P\325*\314\361\216\353\243\205.\333\376\220\023)\262\247\"\030\225'\322\034\r\307\324Zg\262\013 ?\322\337\220\037\027\307\213N\216tg\221\377\341\251\020\030V\200\301\335\311W\320\305\307\026\2474\301\025\033\\bA#Z@\211\n\213W\371\346\322\003YU\200\304\202?\212 \251\006\324\207\237H\301\336\234-\007\265VO`P\305\335\272m \333;\233\326\002\344\307\327\032\320\322\2047\213>\324'\210\301\372\222W"
+	.ascii	"\223\245\340\177\272\2147\315x\022\203Xu\232\261\205\275\271"
+	.ascii	"7\354\323\272K6\235\266\251\211]\370\303\350tI\247_\247\272["
+	.ascii	"t\232\244\323#\235\246\343\364\322\351I\247\177\303C$P\254\025"
+	.ascii	"E\361L\275\032\233\3508\325o\037\026\203\346*\227\260$\252\243"
+	.ascii	",$\234K*\252\265s\032s(\2734\321\211\376\222\326\316IH\255\265"
+	.ascii	"\374\370\344\313\221\006V\204\266\363ODWb\253\b\020T\220\311"
+	.ascii	"\371\350\333\223\020\331\345\307\265\213\374\246\017\003\305"
+	.ascii	"\023hL\320hP,\206\371\316%\261\374\246\364fQI\2555\326\332\357"
+	.ascii	"h\365\353\321\233E\037\255u\300\033k<\365\247\2430W\325\244\257"
+	.ascii	"V\036Nlk\226F\375\224z\263\350\030q\206\275\314\250\301D\247"
+	.ascii	"lO\234\330\352\232\250\300\2102b{\252\313x\363\265\345\332\033"
+	.ascii	"\202\346\201\261}\f\032F\273\363\253\376\022\304\0273\210UB\312"
+	.ascii	"Z\004\t[\fM[|\263\214'\261E\271G\302d\205\224\235\363(PJ\251"
+	.ascii	"\250\005?\223\025X\257\275\323?\374\223~\301\253\005\267\362"
+	.ascii	"\224\253\326J\363\235\374I\316g\372\350\016B\363@\2416\240\037"
+	.ascii	"\334\003\240\332\020.\027\342\246\313i\270\021\272}\250\321\017"
+	.ascii	"/\037\233\215\203\004\037\334\215\002\210\227i<\265\035\332\016"
+	.ascii	"\003\036\235\0026\240\037\\mt\217\216.7T\013\272\r\t\331.\370"
+	.ascii	"\340n\036fC\032~n@\031f\270[-h\326\243\023\232\351\3408\307\301"
+	.ascii	"\246\233\r\345r\272Y)\344\235\326]\262Y\031o{\256\231\344\332"
+	.ascii	"=\266y\240\315\312|\273\363\270t\311=\226\237R\271\345\216\333"
+	.ascii	"\352\362\332\327\322]4\277\036\275\341_\304 \344\336\360\\\342"
+	.ascii	"\221\206\326\354\374\301\303\310\306\266\265H\366\256?%\303\017"
+	.ascii	",\013\323\201_\346\356\316\341\257\no\006Q\250Q8e\030C\006\231"
+	.ascii	"\300$\220@f&-6\260\242!\302u\021\2401c\205a\212\205\375\317X"
+	.ascii	"`\332R\277\235/\024\b\237\257GB\306\220\225!\365\007\215D\350"
+	.ascii	"s\\\345\333\0361\2403\350\323\020$\007\270\213_Y0g\276\362f\001"
+	.ascii	"1\365l\030j\222\025o\226\302\367\003\205a\377u\013\336\022\007"
+	.ascii	"\377\366{\362\016\305\231M\036bxZ\036-\360I\315Z+\332\331%:\266"
+	.ascii	"[D\022\366\0265\325&\254\301j\343\363Ax75'@\033\241\224\242A"
+	.ascii	"\004\260\266\223\243\f%\356\254\366\333\273!f\337\021=\211\021"
+	.ascii	"C\304IUrP\300\312N\342d \324"
+	.text
+	.section	.gnu.lto_updateWindEstimator.52.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375`\335\033\235h"
+	.ascii	"\312\246\334$I L\323\351\305`\322\266\217\232\221\013v\027\201"
+	.ascii	"\315\331\361J\312w\320\006\206\306\341q\247\276mr\316\344\344"
+	.ascii	"w\0200\210\023E\240\350\033\233[\225\003\323\350\231+\213&3_"
+	.ascii	"\007\315\024R\250\320\352.\352\276\272\021\331mwK)\245+\002\007"
+	.ascii	"\002Q\002\316\034\256s\322u\336p\235\221\256\263\206\353|t\235"
+	.ascii	"\215\256s\206\353\214\341:\027]\347\013\327\231\350:[\270\316"
+	.ascii	"C\327Y\b\351\034t\235\201\256\363\317uV^\347$\353\214\274\316"
+	.ascii	"\227uf\257\363\221u^\217\316\352\321\331xt\376\325\331W\347\356"
+	.ascii	"\366\0017=u\216\246m\213d\252BK\250\002^\3515\335\204\335o\272"
+	.ascii	"\341t\307\351\226\323\375\245Ug\231;\331&\305l\272M\273i\303"
+	.ascii	"6\241\017{\016'\223Q9j[\244\304\251\"\215\203ceJ\335\233+na\n"
+	.ascii	"\207\264orl\201\204\354g\244H\035\334\005l\326\224\031\272X\253"
+	.ascii	"aN\262\220\016\344.\241\323\034\377\350li\3336\211\346\314!\232"
+	.ascii	"3w\246l\253f\312\020\221\032\253\2405\212YK\354\242\247m\357"
+	.ascii	"\232ZU\266\221jo3B\272\f\021\243\2736\255\273\314A\262\201\036"
+	.ascii	"7\254\240\020\346d\253\336x\235\327a\232\257\373\332\257\377"
+	.ascii	"\232\f'\221y\200r\201c\306p\361\222\206\204\271+p\304\320\265"
+	.ascii	"\325\331\033\262$\023j\333'up]\306\266\212T\001L\3539{\204!\254"
+	.ascii	"\330\231\f7v^\204\312d\231\b\024\260bg\354\336\0235Xl\253\311"
+	.ascii	"4\251\276k/\316\376\302~\254\330\031\006\250\033>\211m\3336\265"
+	.ascii	"\312\017\260\255.\215\310+R\355\314\335\245\351\234]G\244\207"
+	.ascii	"\332\026\n\337\230\266\275sb&\333*\337u\321\332*\333Dk\253\354"
+	.ascii	"d\246\323wR\332\306\213\226\345\351i\333\366\351\243\264\263"
+	.ascii	"\205\202\200~\224I\344e\217\253j|wr#\321\304Z(\210Lwp\222&\245"
+	.ascii	"\201\216RN\322\242\375\323\301IZ[+\013\317\332\214\313\266m{"
+	.ascii	"Nw\220\2361\361\244QD\342\037\236.<\213\032\213\220X1k\351\031"
+	.ascii	"\233#\377\004,w\003\266\013\317\324Zz\266\346G\346\006\211]\026"
+	.ascii	"\235\2445\351\265L-b4\212\210\252\311 \211Ff,j\363\344\004 4"
+	.ascii	"\250\277Q\tJ\223E \2641\3432\raY\223i7\202\006u?J\265m\313n\206"
+	.ascii	"\226\326<\324\314}\304\354y\314Fv\002?\377\3410N\251\266F\207"
+	.ascii	"\330\027\346\366t>\274\204\375>\304q%C\226\222x\006.^\304\360"
+	.ascii	"6\213\361\037\016\261$\317\320\324\260\255\"?\351F\034\003?\342"
+	.ascii	"\027x\263\340\332*\222\355V`\001\237\023\373\327\311\241^\304"
+	.ascii	"\311X\327[;>3\273\230?\331\217-r&\264\004\352F.\261-\3226\261"
+	.ascii	"sa[%\303~\234\242\325\345\363\217\357}\240\211O\237\216\350\351"
+	.ascii	"\f\020)\230i\364\n6\224\342\364Y\037\304\024\300\343\222\025"
+	.ascii	"T\330\203g\275\343`\354\260\336\"`\340Q\tf\360\267@\253XY\325"
+	.ascii	"\257q$\016G\363\331\263\250.2\342S\354L\375\267\024\332\370,"
+	.ascii	"\216\\a\316\321y\27220\353h<S\027\244\264m{\342N+.\300\375A\253"
+	.ascii	"\334\200\003\336f\016\274\332\246\214\\\335\333\222-Oc\327\372"
+	.ascii	"\317\343\b\025<9d\276\207-83\217\b\274\315\376\177"
+	.string	"\240f\b\307^\254{\017\007\323\021\236\251V\177\037x\207d\276\207\205\232j\355\367\3572\2651\23727b\323\241\342\376\200\253\232\336f\255r7\327V\3733LQ{\372\224\327\300\302\326\371p\223i$\230\277\302\326\3710\337\215\265\261m\333\326\377\215\271\215m\333\266\374P\230\225\316_Ig\257\244sW\257i\006\322\204\315X\375\246\371\252\34147;N\263U\313i\246\352/\315=\222\316<\272\256\033\202\353\274\343:O]g\005\256\263\216\353\234\300u\316q\235\021\270\3168\256\363\215\353l\343:\327\270\3164\256\363\001\327y\306u\226q\235c\\g\030\327\371\305u6\340:\273\270\316R\327\271\305ufq\235W\\\347\002\2563\001\327Y\305u\036\340:\247\270\316(\256\363\211\353,\300u6q\235K\\g\346u\216\272\316P\327\371\351:\223\270\316N\327y\304un\272\316\"\256s\210\353\314t\235A\\\347"
+	.string	"\256\363\207\353\274t\235=\\g"
+	.string	"\256s\207\353\274\274\316J7Q\3266k~\230ro\320\352;N/I\274\323[}\367\201\3025\371\320\023\221\370\225\256\311\221>\211\212\263\212\267\231\323G\340V\344\305\030\211\346\307^l\212,\003\024\202\367qj\371\211s>r'8\234/\n\216\300\223gNmK\376\210\277&;wT\013\232\354D$\326\2313*\372\021\021\021\245\013\201H\307nM\b9&9s\364\234\230\264\2000!\216\035\\\230N\002\342\217y\320h\026\252o9\001\374\207\247\372\356\003E\303\344=\002\370d\0357&_zf'\026g\234\267\331\207_\222\275\030{x"
+	.string	"~\351\335\020\032Uz\245\367\360M\202Pi\207_>"
+	.ascii	"\177d\b\215&}\322w\370\r\212H\217\364\313_\005\241\3221,J\205"
+	.ascii	"n\270\030\331\376\234\034\376\370J\277\016\022\262\341\300\226"
+	.ascii	"\244f\320\b\335\360\367\223~\035Dsf\203ro\r\251\214\031.u\376"
+	.ascii	"\234\032\376\370H\277\016\006\222\321\360\255w\b8\247\373\202"
+	.ascii	"=\r\220TP8K\372\365\2239_\b[n1\235\352!k\333\247\207\036\357"
+	.ascii	"\003o\315^\222\036\337_zy\364F\337\343{\020\032-\372\242?z\247"
+	.ascii	">\2504\303cx\243\327 \b\215\022=\321g\370\244>P\351\320\017="
+	.ascii	"\006\351X\236\"\2771g.<\320\027\365\211\271`\207(\314\236\027"
+	.ascii	"'\013\377\363Dz`,\324\031\302\023\241.\261\025\233\302G\304M"
+	.ascii	"\350\225?\364+\242\027\366c\335\316\357\206\314\255\255\n}\223"
+	.ascii	"\300F\211"
+	.string	"\212\232+\310c\tI:\247\226;\307~G\271,\3169o\263c\231\020\\\213S\013\373\023\347 \260\237\361;\320\341\034\213S\013\373\001;\345\234stk\253WM\260\260\265\222a\n\023\245\336\037S\037\036(\327XX\245m\n\326\257o:xk\310|O?\325YA\201%\262\006\275\017\274C\327\243\373\372\026\001M7\231\276w\346\356\026\023\275\376\353\215\024\273\236\307{}C\341\306|\312A\337\365\r\301\363x\r\212e+<}\312\255\246\325\251\2234}\021\313D\263\330\t\372F\323K\b\276\315\364\322\247\270\007D\302\234vN\273\265\325\240\347p\250&\007\324A\024\272W\002\345\211\023\240,?M\334^\314\251\215\t[\314%\253\255,!k\024\324\322\312\214\"bFA-i\205Ma`F]`FA-e`FA-\0211\243\240\226\204\030hu+\353\213\245\002kb\201}qU\261\306\006&hzI"
+	.ascii	"\204\364\321\214E\342i\213KK\213\253\352\210\252\201,h\205M\r"
+	.ascii	"\001\313\252\342\n\322d\300j+\214\313\353\307\320\320\325U\026"
+	.ascii	"\214\"\255\260\251-\256,\260\252\246W\026\214\346\017\252 \315"
+	.ascii	"\257\260\253\013T`A\2320\232ZY`\267k\n\013\354\307V\363\306\325"
+	.ascii	"U\226\225\222S\224\240b\246`\242(AB\303\327\002M\255\254\035"
+	.ascii	"`[M/\257\260\252\037\256\"\341\305\005F\245\225\005\366\325\214"
+	.ascii	"\300j+K\310\023\030\326\217\254 WO[YTZOU^_O$<0\227\004M\257'"
+	.ascii	"0..\257\247\344\335\263\215\355Ca\251\347\217\271\320\362\271"
+	.ascii	"|.\237\313\347\362"
+	.ascii	"\251\0043HH\030\370\0040\350\3378\212\333\032\232\005\355\376"
+	.ascii	"\224z:\237\006\372\267\356Z\371\245\037\327\305l\316\266\266"
+	.ascii	"\265U%)w\370\260<\034_\223\237\035o\245\312\324+\360;V\374\324"
+	.ascii	"\213W\200M\307O\221\222\300\347x\035*>\001\251\317\261\206\300"
+	.ascii	"Ca\277$)O^\321,\005\034\177\343\021\370c\237\0308qn&\036\307"
+	.ascii	"\033\r\332Y\023C\310\342o\374\332\007\225\002\361i\240*\3113"
+	.ascii	"\202\362\337\030\310\333x\257=\030\260\336F\224/\t\220\35755"
+	.ascii	"\200\320\370\003\276\306\377\212_\3614\036\311p\306\313\370\003"
+	.ascii	"\376\230\247\342U\374\214724\361&^\306\253\206S\254o\302^>=\006"
+	.ascii	"\326/a\274\001\037\343\215y/\376\305\303\370\020\210P\3513a{"
+	.ascii	"\361.\306\305\267x\003\376H\021\032\225z\251w\361\033\006\235"
+	.ascii	"~MM\352\233\315! \213g\361-~\311+i\302\342O\034\002>\373\254"
+	.ascii	"HKbW\300\257\370\243<\002~\304\027\020\342\tx\025"
+	.string	"qQ\005\006H\2668\r\360*R|\323\017\200\342S\234x\001\036E\224\351O\200x\001\362\230x\2637Rf(\247bq3el\333\247\207\022o\342\225\004\241R\346\213\370\022\257\366A\341\250>\352\231\257\"B\245P\377\364Q\257a\260\371L\017\365H\212P\351\325\203\370\247?\336\331\263s\365\375\206\203+6\315o8n\365\346\f\202U\250\002\2015JI\206\024)\021\021\221$I\322\032r\f\210q\230\225T\232\007\022 \223\201\022G\0314C\001\215$IR\231\016\252\315\224\312\204:R\0261\350\\\363N\365\366\325rT\205x%Rz0\256\316A\353\326\315\027\216)\254#A\323\t?FgoZ;\305\255\254m\365I\310I\375O\264\315\222~\3216\314H\257\315LW\354%)\251\035\336\344\360c|B\034\016\253\367\351\335\022O\237K\344\0256&0!dv\264\t\337\020\023m\244\367t\312\363\210k"
+	.ascii	"\255\262\3700VI\363\353\325\326\365<\202\333h=\271\315N+E'I\333"
+	.ascii	"\320p=w\275+\254\264\360\200\200\310\335c\323\242\302T\253v#"
+	.ascii	"\246\335\334V~\307\032\267s\212+\313\033\371\305T\220\203OaL"
+	.ascii	"}d\t\313\330v\354\211\316\277\277\004\206\300\276\0334\217\342"
+	.ascii	"\240:\304\344\312k\201\tY\025\227.\335-Z\t\013\207\\\225\317"
+	.ascii	"I0\266\345\254\213\251\303KqC\371\322\342\364q\252\334\033\320"
+	.ascii	"\341Q\330\326\246\3041\337\304\036\354\017\326\273(\002^\t\347"
+	.ascii	"\264\321\314c\310\007\007\320\222\207~7\204t\317\223\205ko\353"
+	.ascii	"36\237\322%\370\234^\204x.N\335G\225:\310\302\030\247\366\356"
+	.ascii	"\326cU(\351_\365\232\341PF\2264\243\326\\4|*\267-\355\221\362"
+	.ascii	"Ep\311O\232\366&\354\356\365\nx\267\277\245j\243sU\034O\324\267"
+	.ascii	"\365\327\020?\274>\325y\310\327\253\251\331\312\260D\332U\333"
+	.ascii	"I-\b!w\313\001[G\232\301\310\336\027c\341\n\364'\215\002\361"
+	.ascii	"\211n\215\351\001\230\277\020\346\337iEI\372-<\364\033\333{["
+	.ascii	"I\203\fRM\034\251\217k(h\030\374\334\320F\314\301\325M&\310\255"
+	.ascii	"\202\207\321e\021H_\275w7\222\004\260\b\215\3738\220\227\342"
+	.ascii	"k\305\306\bp\260M\367sL_8\202\377\217\004\226\310\301x\2728\b"
+	.ascii	"\246\346\220\244F\002,\264\213J\t\023\251I\016\303\036\003\034"
+	.ascii	"\242\003v#\024\214\371\003d6\300w5eT\341\250\324\375\321q\336"
+	.ascii	"W\341}\274T\360\036|\364\207\277\2430\232\354c\261\362*\364u"
+	.ascii	"\376\304\223\346\263\257x3\320#\353\250\":z\224\004<c\301s\335"
+	.ascii	"\205(\327\370\202zIpA\005 \231\210\214\242\037o0\324\327=\233"
+	.ascii	"\361\t\032\372\342\200\360\0020\004\222\271\342\241\374\343\201"
+	.ascii	"\260\202\353\002\273\030\t_0]\303r\242L\003\032x\226\230\363"
+	.ascii	"\327\222\361\227Q\265\r\203\2243v\226e8Q\177O\254\013\352\245"
+	.ascii	"\216A\366\226\320q\302\230\312\363\032\002\260\231V\005\360c"
+	.ascii	"\321\323Y\276\224\035\362\300\334\360\227\370:p\204\2117\207"
+	.ascii	"m\205n\024m\034\340R\221\366\003\327\243\206\216\261\0161\226"
+	.ascii	"3V\200\307\331\0231Q:\347+b\347B\b\375\031 \003v\035|\0366\001"
+	.ascii	"\204m\330\233\365\236a\250\312\341\017\t\225\213\347\316\271"
+	.ascii	"\275#%$\242\001\234\244{1\032\2241\025\024\275S\222\033\n\265"
+	.ascii	"\n\200R%\256T\030eX*\315%\003\210}\f\371T\325\300\205\254}\024"
+	.ascii	"\007\313\023\311\220\367\367zd*\337\241v\2552\006\264\351\023"
+	.ascii	"\254C\253x4x\220,\266n\350\363Ff>\214)\030\207\352WU\312\310"
+	.ascii	"nf\245\227\270\345\0017\350\325\353'\311\214\3458\311\257\364"
+	.ascii	";]\206\201L\316G\226\367\315j\356\360\325\330y\302\254vx\210"
+	.ascii	"\324IN\252\214\231-\344Ue\013r\204y\263o\376\234\026T\260\234"
+	.ascii	"Ir\225\231dz)\353\247#h\016[Z\321\300\330yQ\346\310h\211&\004"
+	.ascii	"\224\"\215\276j\007\255\365\254\225:\214%>p+\355\272\342\350"
+	.ascii	"\244\004\237\360\315\333\003\256\224\306P\017\2226"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375`\301"
+	.string	"\305\006"
+	.string	"\244\t\275\001"
+	.string	""
+	.string	""
+	.string	"\0021\177\024\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\272\220\202\002"
+	.string	""
+	.string	""
+	.string	"\005-\025\300\204\001"
+	.string	""
+	.string	"\003\0022\177\026.\0273\177\030\0024\177\0317\032`"
+	.string	""
+	.string	""
+	.string	"\0059\033:\034;\035\0050\036/\037\0016\177 \377\037"
+	.string	""
+	.string	"\200\220\200\0015\177!>\177\"=\177#<\177$8\177%\003\004\r\331\214\342\221\002\001\304\n\003\004\f\204\023\003\005\021\310\377\241\372\001\001\304\001\003\005\f\220\357\253\n\001\304v\344v\003\005\020\244\246\001\304\017\247\001\003\005\016\244\252\272\276\001"
+	.string	"\032"
+	.string	"\256-\206\260\0304\005\310\200\025.4\300\325[\244\271\233A\201z"
+	.string	"p"
+	.string	"p"
+	.string	"p\370"
+	.ascii	"A\375\322\224\021\f\227\037\030\215\225]\024\246\201k*\255\344"
+	.ascii	"\352\313\200\016\340b\221O\225\001"
+	.text
+	.section	.gnu.lto_.refs.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375 \307]\004"
+	.string	"r\t\035'`e\222\016@\315"
+	.string	"\333\215*\007\020e\207a\302Y\231 \b\202 \300\314T\004(\020)\022\271&\233\260\337\354&2\005_P{?\254\3273I\327\233\301\\\356k\251PZ\357D\222\275\221\354\007"
+	.string	"\204\332\337\2318\371oZ_\323:\244\365GvG\366Fv\006\353\013\366\212\365\210\365\207\365\006\374\002>\001?\361\027\376\t\216\022\017\356\243;\240V\247\372\375\245\f\004\001@\200\002\027\024\270\240"
+	.ascii	"\007\f@ \030\212\321\311\001"
+	.text
+	.section	.gnu.lto_.decls.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"(\265/\375`\240\026\235s"
+	.string	"\212\307\320+R0T\312I\007\013\337\336\372\335\374"
+	.ascii	"c^\256A\206s,}8N\201\001F\216\244\271\373n\n\310\262\2539\330"
+	.ascii	"{\317L\255\373\nq\016\225U\226\371\275\226\317\030\246\030\013"
+	.ascii	"\215\325\240\351-\240q\375\020f\354l\257-!\037K4\206\372\267"
+	.ascii	"-\371\204H\231\002W\002\244\002\257\002i\337\035\327\373%\245"
+	.ascii	"LQJ\243\357)\313C\327l6\233\374\263\364\re\321\026b\337M\366"
+	.ascii	"\207O\244r?\333\3413\206c\235\224\017[\314\344l\312m\226\347"
+	.ascii	"\360\021\314T\301t\330-JS\024\233\225\341^V\221r\263\311*\322"
+	.ascii	"3\232=\227\261\3471vE\033\217Y7)x\013LM[\243g.\366\234&\204\224"
+	.ascii	"\2540h\330\214O\361\3476\245Y\222\205\026\304\024.\"\260\316"
+	.ascii	"\250\351\304\256\252h\360\032\017\301c\347Zf\177pI\322\306g\277"
+	.ascii	"\214\177\306\003\274\306d\330\314\271f\335\2464b^,\333|\211\203"
+	.ascii	"\273w]\303j\330\bn\303l\314\206\213`&\257q\232\263\031\217y\257"
+	.ascii	".R\234Gt\231\265\375\240g#\366\034\304\236\235\354g\260\207\301"
+	.ascii	"\246`\262+\224l\020\243H\271\f\377\300L\003\030\210\263\350u"
+	.ascii	"\271J\314e\231\213k\364>{6 \345&\033\220\036\005\033\243\004"
+	.ascii	"\3732F\221\366\360\2114FYP\211:j\232\266\310\306\322#Nq\314F"
+	.ascii	"\271\013{af\013\006s\366\3420\3471\256w\275w5\321S\356x\341\322"
+	.ascii	"\350\017\243H\377\201\345\r\375_.\300\020\367\201[{n\221\236"
+	.ascii	"\315&\267\020\013\353a\b\022d\243\347\260\237\277\030\354d\255"
+	.ascii	"\274\367x\357\035\240\317\304a\002\327\350\325\030E\312\343\023"
+	.ascii	"){\3118s9\221&\251\326k\342,#\343C\256\321\336\3623\017\314\305"
+	.ascii	"]'\362Iy\273\334\273\002\351x s\325\245Q\356j\356\201\327s\027"
+	.ascii	"k\371\214\007"
+	.string	"\316;^\256{W\356B\35752\263\360af\301sF\305\310%E\337\366+\243H-\237HI\200\362\344g('M\226\r\374\217\373y\201\237\023\370Y\306\317,\254~\316\241\254R\362\337\204\024-\222\260\221\323\370\273\353g\036E8\206)\006\306\376\3637\226\277\247\034\375\273\212\377\306\372Y\352\347\344\317A~v\372Y\206\237{\374\254\364\363\n?\377~\366\375\\\364s\357g\242\237O\370\231\204\237w\374\034\302\317\037\374<\301\177:?s\3603\216\377a\376\347\370\017\366\277\207\2375\370/\302\317\027\374\\\301\317\024\374l\343g\b\376\223\375\037\373\037\366\337\203\377\353\177\006\376\243\375O\233\315f\363o\364GU\374@\304I\276\267J\021y\215\305\037\344]^\344z\357\317qY\004r\225Q@\310/e\024\362\313\030\005\204<.\223w\275I\276]\224\367~\031\243\006@\036\225E\344\272\214b\344\327=\322<\342"
+	.ascii	"5@\323\251i\205<^\"\004l\035\225I5\344\252\344\262{\213]|\334"
+	.ascii	"$\257\367.\357U\242dQv\254R,kR#\242\243:\256EF2\244\351J\271"
+	.ascii	"[\233\256\032RK\231\344\343^\266;d\250\310\305\365\336\373\343"
+	.ascii	"6\025\371^\037k\362\336&e\nTJ&\342G\362\226\270G\343S\323\225"
+	.ascii	"\222\347\243I\371\343jYq\024\362\353J)CL\330W\326mZ\213\234u"
+	.ascii	"\331\226I\373U\\/\362\336\313rJ\320\031[\203k"
+	.string	"\364\213O\231\2642 l6\250\273\354\324\310Y\322\345\214\355\257\006c\346\321:\354>k\300\336Xi\364'\031\373\031\370h\\\332\013\271\002\361\021\013\214W\243\275\366\226\267Ww\335\366\032R\336kl/\023r\367\032M0\263`f\201\356p\205\365%E\177\212\261\177\367p44\207\263\243\225\026\256(\315\325\253\321\346\372{\207\346\201\303zW\266F\352J\243\255d\024\251\002\235E\205\016\213\230\252'\275\325Z\247\233&P?\270\352<\265\271Q\265\215yc8'C\262\032\253uh\034\372Jci*=\245\253\364\rm\245s`fku\224\267\224\266A\253\223M\303\271%i\277p\271\323ZM\325KV\243\342I\023\007&\007\252\255\265\330\007~s\256e\0348)\021\323Z\f\007\254\206\266\326\342f\0239\267$9XC\266\305\211c9\037\343\317\275N\202d\201\265VC\315e\335i-\236c9V\213r\027"
+	.string	"r]\350\236\270x]!"
+	.ascii	"=)8\273\222\300\235Q\002\347\001&n\246\314\266\226\274\2312\333"
+	.ascii	"\252j\243l\253\206\322O\272I;\351+f\366\362o#}\344\214VC\235"
+	.ascii	")\263\255^6\022\356b5\252{\246\261\263\272p\321\243\344j!\371"
+	.ascii	"A\177j\331\237P\354O%\366\247\224\375\t\304\376\274\366}\204"
+	.ascii	"}\267Y\033\214\"\325\361\211\264\2134\021\266 k\322\330\216j"
+	.ascii	")f\366\324Q/\345\375\272w-q\032\215\244\221\005\245&\202\322"
+	.ascii	"7\232}\3730\2047\004K\316-\314\376o!\r\244\2030\263\237\372\007"
+	.ascii	"\272\336{\344B\246\321\360\321N>\307\237{\274B\313\272\367\236"
+	.ascii	"\323\372\251\213\355\304j].z\025\304\224\331\226\013\027.\230"
+	.ascii	"\371\344\2067\213\276\251\330w\225}'\261m\354&f\376\254\217\357"
+	.ascii	"\313\001\314)3\035\034\333\220 m\354\216\371\364\223\310\323"
+	.ascii	"\231\264\340\336\247{\036/\223\270,\026\253R\245\354L\376\204"
+	.ascii	"\342\345P\004\203u\016Y\263\273+?~\006\371q:\265\021\274[\374"
+	.ascii	"Y\233\322 \263tE\200\241\001\322\350\t\004\251fwUC\367\347\361"
+	.ascii	"\274\247\223\220\016\016\033\035;p\027\251$\210\304\245a\355"
+	.ascii	"\351t\372Y\314\b4c\032=\233\336nE\254\241y5z\032\337mI\246\330"
+	.ascii	"h\235\305\177\307\213\022\204\020nf\354ug\266\007\031\367\307"
+	.ascii	"\365\034{]\250\002\200H\306\275\005\371`Y\021q\273\363\236\373"
+	.ascii	"Q+6$P\032m\271\223}l\013\333\224\353\250\330\235\333\020\234"
+	.ascii	"\267\0348]\247\333x\267\350u\241t\300\321\261\263u\221TA<.%K"
+	.ascii	"\346\336\336u\336pg\032\235;oG4\235\177gB.\f\2265s\354{\216\025"
+	.ascii	"\034\220\374\220\272\265\340\245\205i\215\235\354\312X\226/\215"
+	.ascii	"v\234\267\333\277\333\2311q\2624\242\355\337\351\276\250I\222"
+	.ascii	"\325\350\3235\373\364\214\335\001\031z\273q\303a\ft\257\361L"
+	.ascii	"\026\030\273+2\364f\303&\314Mu\260=;\f\265\032n\266V\3535-fA"
+	.ascii	"\023\362\032\227CWn*\305>\255\301\236[,\345)\033z\2571{\255\271"
+	.ascii	"P/\245\233\024O\334\0345k\344\254-b\350\235\346\314\3544\315"
+	.ascii	"D\275n\321\007\fk\312\f\356^\252\027;\256!Qw\346X\036\253\241"
+	.ascii	"7\032f6\232\366\202Ci\224R`\314\372\306\f\334\275?\274\360\241"
+	.ascii	"\362\006\245\345\213\355\271JK\3533LU\001\027&m=B\214\3137!\336"
+	.ascii	"g\3364UY\234&-\306qK\246\256\016\226D\033 \016D\243\331\253\306"
+	.ascii	"kj\243S4\363F3\261\203\324\0238L\306\203\006N\213\255\321\363"
+	.ascii	"\030\261vn\210\263p\227af\227\341\260\024\353-\352\230j\311\027"
+	.ascii	"\347AZ\036\326\230&3\246\317p\024\341$K\274\241\261\021k\037"
+	.ascii	"\336g'\343}\321\322\374\241\321\317\371\331\377\035J\203\030"
+	.ascii	"\036\322\334\254\2253\304]\334b\230\331b\270\213\327\013\245"
+	.ascii	"\023R\226\\_\034M\263</C\r\246\303\274\307\230=\326d8\326\013"
+	.ascii	"\305T\224i\334\340.\025U\320\031\345\244\205\316\2347Y\027\357"
+	.ascii	"\026\260\303\301\312\325S\243G\253\354\337\177z\215\311{\257"
+	.ascii	"\024\317z\313\232x)\363"
+	.string	"\234\203\376\022|2\002'\t\367\026\277\340\336R3\313#o_q\355\275N|\277\224\367^c\021\b\271*\243\200\266\216\313(\344\3272\352\007\211\\\266!\277Ve\361~\335\344\n%\362\032\225\311\373\265\fjO\b<\342!\356XR*\332\251D=\025\350\273A\002)\3703\352\371p\350"
+	.string	"a\003\342\017\350(=\n\376\210\250J\f\n\213x\216\210\302\"\224"
+	.string	"\036\302\341\322R\217hF\260\247\366x@`\257(I\355)\t\021\325\237\nBLA$\007x0\005\177@\007\206j\020\325\260\301C\310g\304\004,\n\376\204\206D&!\241\"\337\022qE\360H\207\001\214vA8LR\205A\335Q\317\007D\217\324!\013D\236\036\352\257H\b\364\215\260\001"
+	.string	"E\276\341\357\206\017\251\007\364\021\2314@\301\213\001\203\270c\207J\354\001}\236\004\203I\351\227B\355y0D\323'\301@\372\035\005\205EDA\246\241P\321\001\032\370\324\236J\354\031\n\227\230N"
+	.string	"{jP\370\302o(\304q\200\257\204\352CBA\354%\005\360\004F\370\221`\344\313\200\370S\361\242\337\320\027\364!\331\017\325p\240\206\r\036\272\333\220 \206\0041\322\333\220@\206\f\tj\310\260\257!\343TU\"\342\016;\354%\025\241D\"&\240P\007q\t\t\310\005_\016b/\251G\355\371TP\207=\037\216\021zn"
+	.string	"}#\354\220z\036d"
+	.ascii	"B\006\326\350\007\354\265\260#\"\365\200G<>\"\r\210KH<\337R\017"
+	.ascii	"\021x\374\216tjO\207\022S0U\237\004\203\270\204$$\374\005\240"
+	.ascii	"\002{'\221((\374\251\275\"a\007\304%\244\022j\017x\252D3h\004"
+	.ascii	"\205\3003\t\b<{j\357\006ROIw#\203\034@_\013\251\221\317\267\244"
+	.ascii	"\203\204\316G\0342\t10\n2\t\207H\274\244%\337\331\302\222\357"
+	.ascii	"\\\022\032%\241j\317\223`\b\005\205JJ\302\"\025\027.\371\206"
+	.ascii	"B\252P8\024\"A\374\001\201?\245\224H\344S\372\211\340S{FD$\206"
+	.ascii	"=_\0174I\r\n\225xz\364\214N\342\220I\230\304C\364\251L\301\237"
+	.ascii	"\222N%\262\241#\032\005\205E>\242\316\247\364SQ\225\250\206\f"
+	.ascii	"5\370c\262\267A\2437\303\306\f\bh\300 \340\021D\200\301\212\035"
+	.ascii	"96\260E0\206B\265\247\364S\211>\"\243\340\317\005!5\t\351\007"
+	.ascii	"<\022\n\376zJBEC\242\020\f\004\200B\341\005D<_\337\326`I\201"
+	.ascii	"r:yi\306i\363\344L\372\204\235\231\331\322\350\311\316&)\274"
+	.ascii	"\224V?=]X\230q\212\\\211\365\350\220\345\312\331\222)\007j\016"
+	.ascii	"\316\212\354\002\267''J/\326\313\0335!\215\236K\316\031\344\356"
+	.ascii	"5\236K\372\254:\231\374\\r\023:\266-\2441Eyg'\325\251\344\244"
+	.ascii	":\223\354Z`#$\007\270KU$\350?k\370\231\344<\302\263\003\006%"
+	.ascii	"N\243'\222\026#\362\203\2100\033\3444b\242\314\234\252\2629\373"
+	.ascii	"\2374\324\341\271\241\261\341J\2219+\306\255f\243;5\247\324)"
+	.ascii	"\325d\354$\201\260\250\2410f\2343\"\"32\"I\222\244\003!\005\204"
+	.ascii	" \350\244e\035\021 -\204jhF\222\244\224\2355\225\344\215\377"
+	.ascii	"6y\346\215\277\312O\036\305c\306\023MI\315@x\34426\302\362\340"
+	.ascii	"t\204\277\253\241\374\276\354\333\033D\371D\230>B\210\261\213"
+	.ascii	"\266\013"
+	.string	"\177\361\034\361x\372\320\202\367Z@\367|9z\001C\034\243\321\317\202\025I\330N\330\247\002J\310l\320\230's\342\361y\b\030e\307M\374\241D5\361\230\326\001\rWk\336\314\242v\335\253\310\374E\233p=c\224\261\271\340\033*&\332\b\220\204j\362\260\224\232w\204\"K3Y\305\314\327\340\002\325\r\306v\3377\222$B\313\n\320WG\303\004\246u\037,,F7\250a\037\024\277e\357\355\350\201\251b\334\336\367z\005C\235\022QGp\b\202\337\2013\334`\202\323\345\215\202\335\220`\037\b\377\225\ro\266\302\002e&\324\023<\034\206\232\362\027Z\314\226\306\224\027\332\370\b\267\244\2749\002\003n\231\036k\336G/\317\213O\340^\221,\361XA\221\005\224\t/M\202)G\262\200Ce\237b\270\030\032\233o<Za\364\242\035X\351$\3247\225\362\231A\177\221\341\037I\234^\"\016w\"\277\203\255"
+	.string	"w\322\337\004k%\317\311\377\t\364\b|\220\t\361\320)%k\314\320\321\201\214\023\347\255\276\223\233pB\204\272\315\260\332+\373\251?`\001\346\207\243\310w\244P\345\005\277l\004lUn`I\030\201\235p\004bt\220w\315\222l@{\032\220\3729\373\206\235\003\343\232\222\346\032:\001\345\36427'\212%\343\262uJ@N\253\346\224\330\013o\2656\364\332\217\316\013E\035\205\333I\322}\005\244\361\bgJu\016u-\370\270_\274]\2775%l\306!)H\260\220\024\346\"*\013\022\2405\202\375\005\337\r\271"
+	.string	"\371?]\251\274\246\363X)\204dHk;\325\323\334\036Ft\035\232\253"
+	.ascii	"<\2202\0350>\034\322w\233>\242"
+	.string	"\246\354\2320\204Ah\027\362K\335\312\234s\322\335\271\005\007B\226<\25020n\003\370\353tQ\312\376\211\021C\312m\201\216\225\"\301\361\202a&\261\033\232\013\370$&(\334\037\301\3748|Q\311\236Qkn\364Z\361\n&J\303\330cT\236u\206C\n]\001\215C\016z\373\277\002\fd7\027\325A\240\326\233!\254E\205F\b\243\354\2104\006\006\031?{\325^\314Y\200\234\376\261C#\334o\321\35405\374\\\307H\021FT_\013\317\244\367v\235\313\355E\334\023\r\201\376ka\341\373\034\377\240\367|\245^@\203x\361@\t\024\\\216xc\020\022\332p:\3023[s\340\221\357@\031\371:\017\322\333\303\335\270\217g\265\303\201\350\262\310\245\336i\312\377\016\032\233\330\315\007\362\367\207\245\360\n`\333\313g\335\234\2642\375\205^\240i!\376\035\372\001Pa\013\363y\031\322\212-\003\302P\357\230&\340"
+	.ascii	"6\351\311\350\362\327O\323X\264\253\357Gd\276\360\036\371\206"
+	.ascii	"B\317\352G\232/\203\233\350\341e_\261\376X;\221\3765\257\360"
+	.ascii	"\377\241\270\340\3300\377Qzz\373>x\332e\305O\303m\251\2132\277"
+	.ascii	"\242Z\3028\274\236\016\366\311e\373\245\032u\276\360O\211\247"
+	.ascii	"\340\326\035A\354\027\360\334{\203U"
+	.text
+	.section	.gnu.lto_.symtab.ab6edbcd5d34ecaa,"e",@progbits
+	.string	"isEstimatedWindSpeedValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\001"
+	.string	""
+	.string	"getEstimatedWindSpeed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\001"
+	.string	""
+	.string	"getEstimatedHorizontalWindSpeed"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"[\001"
+	.string	""
+	.string	"updateWindEstimator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"a\001"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\001"
+	.string	""
+	.string	"rMat"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\001"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"~\001"
+	.string	""
+	.string	"cosf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"sinf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\212\001"
+	.string	""
+	.string	"atan2f"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\001"
+	.string	""
+	.string	"isGPSHeadingValid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ab6edbcd5d34ecaa,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,11051 @@
+	.file	"beeper.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/sensors/sensors.h"
+	.file 6 "./src/main/io/gps.h"
+	.file 7 "./src/main/drivers/adc.h"
+	.file 8 "./src/main/fc/config.h"
+	.file 9 "./src/main/fc/rc_modes.h"
+	.file 10 "./src/main/fc/runtime_config.h"
+	.file 11 "./src/main/io/beeper.h"
+	.file 12 "./src/main/io/beeper.c"
+	.file 13 "./src/main/drivers/time.h"
+	.file 14 "./src/main/sensors/diagnostics.h"
+	.file 15 "./src/main/io/statusindicator.h"
+	.file 16 "./src/main/sensors/battery.h"
+	.file 17 "./src/main/config/feature.h"
+	.file 18 "./src/main/fc/rc_controls.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	beeper.c.4e65ad7b
+	.weak	beeper.c.4e65ad7b
+beeper.c.4e65ad7b:
+	.long	0xb67
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF1510
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1246
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1247
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1248
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1249
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1250
+	.uleb128 0x5
+	.long	.LASF1251
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x5
+	.long	.LASF1252
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1253
+	.uleb128 0x5
+	.long	.LASF1254
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x5
+	.long	.LASF1255
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1256
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1257
+	.uleb128 0x5
+	.long	.LASF1258
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1259
+	.uleb128 0x7
+	.long	0xa2
+	.uleb128 0x5
+	.long	.LASF1260
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x5
+	.long	.LASF1261
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x5
+	.long	.LASF1262
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0x7
+	.long	0xc6
+	.uleb128 0x5
+	.long	.LASF1263
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF1264
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0x5
+	.long	.LASF1265
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1266
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1267
+	.uleb128 0x5
+	.long	.LASF1268
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x12
+	.long	0xe3
+	.uleb128 0x7
+	.long	0x109
+	.uleb128 0x5
+	.long	.LASF1269
+	.byte	0x4
+	.byte	0x21
+	.byte	0x12
+	.long	0xef
+	.uleb128 0xd
+	.long	.LASF1291
+	.byte	0xa
+	.byte	0x4
+	.byte	0x49
+	.long	0x18e
+	.uleb128 0x2
+	.long	.LASF1270
+	.byte	0x4
+	.byte	0x4b
+	.byte	0xe
+	.long	0xd7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1271
+	.byte	0x4
+	.byte	0x4d
+	.byte	0xd
+	.long	0xc6
+	.byte	0x2
+	.uleb128 0xb
+	.string	"day"
+	.byte	0x4
+	.byte	0x4f
+	.byte	0xd
+	.long	0xc6
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1272
+	.byte	0x4
+	.byte	0x51
+	.byte	0xd
+	.long	0xc6
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1273
+	.byte	0x4
+	.byte	0x53
+	.byte	0xd
+	.long	0xc6
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1274
+	.byte	0x4
+	.byte	0x55
+	.byte	0xd
+	.long	0xc6
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1275
+	.byte	0x4
+	.byte	0x57
+	.byte	0xe
+	.long	0xd7
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1276
+	.byte	0x4
+	.byte	0x58
+	.byte	0x3
+	.long	0x126
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1277
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x5
+	.byte	0x14
+	.long	0x1dd
+	.uleb128 0x1
+	.long	.LASF1278
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1279
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1280
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1281
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1282
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1284
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1285
+	.byte	0x7
+	.byte	0
+	.uleb128 0x9
+	.long	0xae
+	.long	0x1ed
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1286
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x6
+	.byte	0x50
+	.long	0x212
+	.uleb128 0x1
+	.long	.LASF1287
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1288
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1289
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1290
+	.byte	0x6
+	.byte	0x54
+	.byte	0x3
+	.long	0x1f4
+	.uleb128 0xd
+	.long	.LASF1292
+	.byte	0xc
+	.byte	0x6
+	.byte	0x6a
+	.long	0x252
+	.uleb128 0xb
+	.string	"lat"
+	.byte	0x6
+	.byte	0x6b
+	.byte	0xd
+	.long	0xba
+	.byte	0
+	.uleb128 0xb
+	.string	"lon"
+	.byte	0x6
+	.byte	0x6c
+	.byte	0xd
+	.long	0xba
+	.byte	0x4
+	.uleb128 0xb
+	.string	"alt"
+	.byte	0x6
+	.byte	0x6d
+	.byte	0xd
+	.long	0xba
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1293
+	.byte	0x6
+	.byte	0x6e
+	.byte	0x3
+	.long	0x21e
+	.uleb128 0x1d
+	.byte	0x7
+	.byte	0x6
+	.byte	0x73
+	.byte	0x5
+	.long	0x2c3
+	.uleb128 0x2
+	.long	.LASF1294
+	.byte	0x6
+	.byte	0x74
+	.byte	0xd
+	.long	0x1ed
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1295
+	.byte	0x6
+	.byte	0x75
+	.byte	0xd
+	.long	0x1ed
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1296
+	.byte	0x6
+	.byte	0x76
+	.byte	0xd
+	.long	0x1ed
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF1297
+	.byte	0x6
+	.byte	0x77
+	.byte	0xd
+	.long	0x1ed
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1298
+	.byte	0x6
+	.byte	0x78
+	.byte	0xd
+	.long	0x1ed
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1299
+	.byte	0x6
+	.byte	0x79
+	.byte	0xd
+	.long	0x1ed
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1300
+	.byte	0x6
+	.byte	0x7a
+	.byte	0xd
+	.long	0x1ed
+	.byte	0x6
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1301
+	.byte	0x3c
+	.byte	0x6
+	.byte	0x72
+	.long	0x36c
+	.uleb128 0x2
+	.long	.LASF1302
+	.byte	0x6
+	.byte	0x7b
+	.byte	0x7
+	.long	0x25e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1303
+	.byte	0x6
+	.byte	0x7d
+	.byte	0x12
+	.long	0x212
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1304
+	.byte	0x6
+	.byte	0x7e
+	.byte	0xd
+	.long	0xc6
+	.byte	0xc
+	.uleb128 0xb
+	.string	"llh"
+	.byte	0x6
+	.byte	0x80
+	.byte	0x13
+	.long	0x252
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1305
+	.byte	0x6
+	.byte	0x81
+	.byte	0xd
+	.long	0x1dd
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF1306
+	.byte	0x6
+	.byte	0x82
+	.byte	0xd
+	.long	0x1dd
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF1307
+	.byte	0x6
+	.byte	0x84
+	.byte	0xd
+	.long	0xae
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1308
+	.byte	0x6
+	.byte	0x85
+	.byte	0xd
+	.long	0xae
+	.byte	0x2a
+	.uleb128 0xb
+	.string	"eph"
+	.byte	0x6
+	.byte	0x87
+	.byte	0xe
+	.long	0xd7
+	.byte	0x2c
+	.uleb128 0xb
+	.string	"epv"
+	.byte	0x6
+	.byte	0x88
+	.byte	0xe
+	.long	0xd7
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF1309
+	.byte	0x6
+	.byte	0x8a
+	.byte	0xe
+	.long	0xd7
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1310
+	.byte	0x6
+	.byte	0x8c
+	.byte	0x10
+	.long	0x18e
+	.byte	0x32
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1311
+	.byte	0x6
+	.byte	0x8e
+	.byte	0x3
+	.long	0x2c3
+	.uleb128 0x14
+	.long	.LASF1432
+	.byte	0x6
+	.byte	0x97
+	.byte	0x1a
+	.long	0x36c
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x7
+	.byte	0x16
+	.long	0x3ae
+	.uleb128 0x1
+	.long	.LASF1312
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1313
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1314
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1315
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1316
+	.byte	0x4
+	.byte	0
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x8
+	.byte	0x26
+	.long	0x4a9
+	.uleb128 0x1
+	.long	.LASF1317
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1318
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1319
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1320
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1321
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1322
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1323
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1324
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF1325
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF1326
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF1327
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF1328
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF1329
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF1330
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF1331
+	.value	0x4000
+	.uleb128 0x6
+	.long	.LASF1332
+	.value	0x8000
+	.uleb128 0x4
+	.long	.LASF1333
+	.long	0x10000
+	.uleb128 0x4
+	.long	.LASF1334
+	.long	0x20000
+	.uleb128 0x4
+	.long	.LASF1335
+	.long	0x40000
+	.uleb128 0x4
+	.long	.LASF1336
+	.long	0x80000
+	.uleb128 0x4
+	.long	.LASF1337
+	.long	0x100000
+	.uleb128 0x4
+	.long	.LASF1338
+	.long	0x200000
+	.uleb128 0x4
+	.long	.LASF1339
+	.long	0x400000
+	.uleb128 0x4
+	.long	.LASF1340
+	.long	0x800000
+	.uleb128 0x4
+	.long	.LASF1341
+	.long	0x1000000
+	.uleb128 0x4
+	.long	.LASF1342
+	.long	0x2000000
+	.uleb128 0x4
+	.long	.LASF1343
+	.long	0x4000000
+	.uleb128 0x4
+	.long	.LASF1344
+	.long	0x8000000
+	.uleb128 0x4
+	.long	.LASF1345
+	.long	0x10000000
+	.uleb128 0x4
+	.long	.LASF1346
+	.long	0x20000000
+	.uleb128 0x4
+	.long	.LASF1347
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1511
+	.byte	0x7
+	.byte	0x4
+	.long	0x30
+	.byte	0x12
+	.byte	0x18
+	.byte	0xe
+	.long	0x51c
+	.uleb128 0x1
+	.long	.LASF1348
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1349
+	.byte	0x1
+	.uleb128 0x1f
+	.string	"YAW"
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1350
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1351
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1354
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1355
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1356
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1357
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1358
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1359
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1360
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1361
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1362
+	.byte	0xf
+	.byte	0
+	.uleb128 0xc
+	.long	0x30
+	.byte	0x9
+	.byte	0x1c
+	.long	0x62a
+	.uleb128 0x1
+	.long	.LASF1363
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1364
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1365
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1366
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1367
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1369
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1370
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1371
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1372
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1373
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1374
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1375
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1376
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1377
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1378
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1379
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1380
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1381
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1382
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1383
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1384
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1385
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1386
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1387
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1388
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1389
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1390
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1391
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1392
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1393
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1394
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1395
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1396
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1397
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1398
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1399
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1400
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF1401
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF1402
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF1403
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1404
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1405
+	.byte	0x2a
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1406
+	.byte	0x9
+	.byte	0x48
+	.byte	0x3
+	.long	0x51c
+	.uleb128 0xf
+	.long	0xa9
+	.uleb128 0xc
+	.long	0x30
+	.byte	0xa
+	.byte	0x6c
+	.long	0x700
+	.uleb128 0x1
+	.long	.LASF1407
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1408
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1409
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1410
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1411
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1412
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1413
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1414
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF1415
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF1416
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF1417
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF1418
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF1419
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF1420
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF1421
+	.value	0x4000
+	.uleb128 0x6
+	.long	.LASF1422
+	.value	0x8000
+	.uleb128 0x4
+	.long	.LASF1423
+	.long	0x10000
+	.uleb128 0x4
+	.long	.LASF1424
+	.long	0x20000
+	.uleb128 0x4
+	.long	.LASF1425
+	.long	0x40000
+	.uleb128 0x4
+	.long	.LASF1426
+	.long	0x80000
+	.uleb128 0x4
+	.long	.LASF1427
+	.long	0x100000
+	.uleb128 0x4
+	.long	.LASF1428
+	.long	0x200000
+	.uleb128 0x4
+	.long	.LASF1429
+	.long	0x400000
+	.uleb128 0x4
+	.long	.LASF1430
+	.long	0x800000
+	.uleb128 0x4
+	.long	.LASF1431
+	.long	0x1000000
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1433
+	.byte	0xa
+	.byte	0x8c
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0xc
+	.long	0x30
+	.byte	0xb
+	.byte	0x16
+	.long	0x7ae
+	.uleb128 0x1
+	.long	.LASF1434
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1435
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1436
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1437
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1438
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1440
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1441
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1442
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1443
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1444
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1445
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1446
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1447
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1448
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1449
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1450
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1451
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1452
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1453
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1454
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1455
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1456
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1457
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1458
+	.byte	0x18
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1459
+	.byte	0xb
+	.byte	0x34
+	.byte	0x3
+	.long	0x70c
+	.uleb128 0x9
+	.long	0xd2
+	.long	0x7ca
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x7
+	.long	0x7ba
+	.uleb128 0x3
+	.long	.LASF1460
+	.byte	0x40
+	.byte	0x16
+	.long	0x7ca
+	.uleb128 0x9
+	.long	0xd2
+	.long	0x7ea
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.long	0x7da
+	.uleb128 0x3
+	.long	.LASF1461
+	.byte	0x44
+	.byte	0x16
+	.long	0x7ea
+	.uleb128 0x3
+	.long	.LASF1462
+	.byte	0x48
+	.byte	0x16
+	.long	0x7ea
+	.uleb128 0x3
+	.long	.LASF1463
+	.byte	0x4c
+	.byte	0x16
+	.long	0x7ea
+	.uleb128 0x9
+	.long	0xd2
+	.long	0x820
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.long	0x810
+	.uleb128 0x3
+	.long	.LASF1464
+	.byte	0x50
+	.byte	0x16
+	.long	0x820
+	.uleb128 0x3
+	.long	.LASF1465
+	.byte	0x54
+	.byte	0x16
+	.long	0x7ca
+	.uleb128 0x3
+	.long	.LASF1466
+	.byte	0x58
+	.byte	0x16
+	.long	0x7ca
+	.uleb128 0x3
+	.long	.LASF1467
+	.byte	0x5d
+	.byte	0x16
+	.long	0x7ca
+	.uleb128 0x9
+	.long	0xd2
+	.long	0x861
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x12
+	.byte	0
+	.uleb128 0x7
+	.long	0x851
+	.uleb128 0x3
+	.long	.LASF1468
+	.byte	0x61
+	.byte	0x16
+	.long	0x861
+	.uleb128 0x9
+	.long	0xd2
+	.long	0x881
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x8
+	.byte	0
+	.uleb128 0x7
+	.long	0x871
+	.uleb128 0x3
+	.long	.LASF1469
+	.byte	0x65
+	.byte	0x16
+	.long	0x881
+	.uleb128 0x9
+	.long	0xd2
+	.long	0x8a1
+	.uleb128 0xa
+	.long	0x37
+	.byte	0xe
+	.byte	0
+	.uleb128 0x7
+	.long	0x891
+	.uleb128 0x3
+	.long	.LASF1470
+	.byte	0x69
+	.byte	0x16
+	.long	0x8a1
+	.uleb128 0x3
+	.long	.LASF1471
+	.byte	0x6d
+	.byte	0x16
+	.long	0x7ea
+	.uleb128 0x3
+	.long	.LASF1472
+	.byte	0x71
+	.byte	0x16
+	.long	0x7ea
+	.uleb128 0x9
+	.long	0xd2
+	.long	0x8d7
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x6
+	.byte	0
+	.uleb128 0x7
+	.long	0x8c7
+	.uleb128 0x3
+	.long	.LASF1473
+	.byte	0x75
+	.byte	0x16
+	.long	0x8d7
+	.uleb128 0x3
+	.long	.LASF1474
+	.byte	0x79
+	.byte	0x16
+	.long	0x7ea
+	.uleb128 0x3
+	.long	.LASF1475
+	.byte	0x7d
+	.byte	0x16
+	.long	0x7ca
+	.uleb128 0x9
+	.long	0xd2
+	.long	0x90d
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x7
+	.long	0x8fd
+	.uleb128 0x3
+	.long	.LASF1476
+	.byte	0x81
+	.byte	0x16
+	.long	0x90d
+	.uleb128 0x3
+	.long	.LASF1477
+	.byte	0x85
+	.byte	0x16
+	.long	0x820
+	.uleb128 0x9
+	.long	0xc6
+	.long	0x938
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1478
+	.byte	0x8b
+	.byte	0x10
+	.long	0x928
+	.uleb128 0x3
+	.long	.LASF1479
+	.byte	0x92
+	.byte	0x10
+	.long	0xc6
+	.uleb128 0x3
+	.long	.LASF1480
+	.byte	0x95
+	.byte	0x11
+	.long	0xd7
+	.uleb128 0x3
+	.long	.LASF1481
+	.byte	0x97
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0x3
+	.long	.LASF1482
+	.byte	0x99
+	.byte	0x11
+	.long	0xe3
+	.uleb128 0xd
+	.long	.LASF1483
+	.byte	0x18
+	.byte	0xc
+	.byte	0x9d
+	.long	0x9b0
+	.uleb128 0x2
+	.long	.LASF1484
+	.byte	0xc
+	.byte	0x9e
+	.byte	0xd
+	.long	0xc6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1485
+	.byte	0xc
+	.byte	0x9f
+	.byte	0xd
+	.long	0xc6
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF1486
+	.byte	0xc
+	.byte	0xa0
+	.byte	0x14
+	.long	0x9b0
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1487
+	.byte	0xc
+	.byte	0xa1
+	.byte	0x11
+	.long	0x636
+	.byte	0x10
+	.byte	0
+	.uleb128 0xf
+	.long	0xd2
+	.uleb128 0x5
+	.long	.LASF1488
+	.byte	0xc
+	.byte	0xa2
+	.byte	0x3
+	.long	0x96f
+	.uleb128 0x7
+	.long	0x9b5
+	.uleb128 0x9
+	.long	0x9c1
+	.long	0x9d6
+	.uleb128 0xa
+	.long	0x37
+	.byte	0x17
+	.byte	0
+	.uleb128 0x7
+	.long	0x9c6
+	.uleb128 0x20
+	.long	.LASF1512
+	.byte	0xc
+	.byte	0xa6
+	.byte	0x25
+	.long	0x9d6
+	.uleb128 0x3
+	.long	.LASF1489
+	.byte	0xc2
+	.byte	0x22
+	.long	0x9f2
+	.uleb128 0xf
+	.long	0x9c1
+	.uleb128 0xe
+	.long	.LASF1275
+	.byte	0xd
+	.byte	0x1d
+	.byte	0xa
+	.long	0x109
+	.uleb128 0x10
+	.long	.LASF1491
+	.byte	0x14
+	.uleb128 0xe
+	.long	.LASF1490
+	.byte	0xe
+	.byte	0x1c
+	.byte	0x5
+	.long	0x1ed
+	.uleb128 0x15
+	.long	.LASF1495
+	.byte	0x9
+	.byte	0x77
+	.long	0x1ed
+	.long	0xa2a
+	.uleb128 0x16
+	.long	0x62a
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1492
+	.byte	0x16
+	.uleb128 0x10
+	.long	.LASF1493
+	.byte	0x15
+	.uleb128 0xe
+	.long	.LASF1494
+	.byte	0x10
+	.byte	0x8d
+	.byte	0x9
+	.long	0xc6
+	.uleb128 0x15
+	.long	.LASF1496
+	.byte	0x11
+	.byte	0x1e
+	.long	0x1ed
+	.long	0xa57
+	.uleb128 0x16
+	.long	0xe3
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF1497
+	.byte	0x8
+	.byte	0x6a
+	.byte	0xa
+	.long	0xe3
+	.uleb128 0x17
+	.long	.LASF1498
+	.value	0x191
+	.byte	0x5
+	.long	0x7c
+	.uleb128 0x18
+	.long	.LASF1499
+	.value	0x189
+	.byte	0xd
+	.long	0x636
+	.long	0xa8c
+	.uleb128 0x19
+	.string	"idx"
+	.value	0x189
+	.byte	0x29
+	.long	0x7c
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF1500
+	.value	0x181
+	.byte	0xe
+	.long	0x7ae
+	.long	0xaa9
+	.uleb128 0x19
+	.string	"idx"
+	.value	0x181
+	.byte	0x2a
+	.long	0x7c
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF1501
+	.value	0x178
+	.byte	0xa
+	.long	0xe3
+	.uleb128 0x21
+	.long	.LASF1513
+	.byte	0xc
+	.value	0x167
+	.byte	0xd
+	.uleb128 0x11
+	.long	.LASF1503
+	.value	0x12a
+	.long	0xae2
+	.uleb128 0x1a
+	.long	.LASF1502
+	.value	0x12a
+	.byte	0x1c
+	.long	0x11a
+	.uleb128 0x12
+	.string	"now"
+	.value	0x143
+	.byte	0x14
+	.long	0x115
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1504
+	.value	0x112
+	.long	0xafa
+	.uleb128 0x13
+	.uleb128 0x12
+	.string	"i"
+	.value	0x116
+	.byte	0x11
+	.long	0xc6
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF1505
+	.value	0x100
+	.long	0xb29
+	.uleb128 0x1a
+	.long	.LASF1506
+	.value	0x100
+	.byte	0x26
+	.long	0xc6
+	.uleb128 0x12
+	.string	"i"
+	.value	0x102
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0x22
+	.long	.LASF1507
+	.byte	0xc
+	.value	0x103
+	.byte	0x9
+	.long	0x7c
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1514
+	.byte	0xc
+	.byte	0xee
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF1515
+	.byte	0xc
+	.byte	0xca
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF1484
+	.byte	0xc
+	.byte	0xca
+	.byte	0x1a
+	.long	0x7ae
+	.uleb128 0x3
+	.long	.LASF1508
+	.byte	0xd1
+	.byte	0x1f
+	.long	0x9f2
+	.uleb128 0x13
+	.uleb128 0x26
+	.string	"i"
+	.byte	0xc
+	.byte	0xd2
+	.byte	0x13
+	.long	0xe3
+	.uleb128 0x13
+	.uleb128 0x3
+	.long	.LASF1509
+	.byte	0xd3
+	.byte	0x23
+	.long	0x9f2
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 15
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 19 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 20 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 21 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.file 22 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 24 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 25 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 28 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 30 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1e
+	.file 31 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1b
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 35 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 36 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF740
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF776
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 41 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF818
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF819
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF820
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF697
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF822
+	.file 46 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF823
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF840
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF853
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF858
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x37
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x38
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF862
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x39
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF879
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF880
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x3b
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF881
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 60 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x3c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF893
+	.byte	0x4
+	.file 61 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF900
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x4
+	.byte	0x4
+	.file 63 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF905
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x40
+	.byte	0x4
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x4
+	.file 66 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x42
+	.file 67 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 68 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x44
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 69 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x45
+	.byte	0x4
+	.file 70 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x4
+	.file 71 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x47
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 72 "./src/main/drivers/sound_beeper.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x48
+	.file 73 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4
+	.file 74 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4a
+	.file 75 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1171
+	.byte	0x4
+	.file 76 "./src/main/rx/rx.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4c
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1208
+	.byte	0x4
+	.file 77 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4d
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1209
+	.byte	0x4
+	.file 78 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1213
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x9
+	.file 79 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x4f
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1245
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF735
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF749
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF768
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF775
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF797
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF803
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF827
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF829
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF835
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF852
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF857
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF860
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF874
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF878
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF892
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF896
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF904
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1012
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1013
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1036
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1038
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1075
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1083
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1112
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1114
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sound_beeper.h.27.4fa3fdb3505f282e8dcaf0b08ad11304,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1117
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1127
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1150
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1160
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.battery.h.24.51677ced5cbab253fc0b310fcbed170d,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1166
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.42.8e2e5ec4be4bbc896da78d2242718f91,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1170
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1199
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1207
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1212
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1217
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1227
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1238
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF1516
+	.long	.LASF1517
+	.long	.LASF1518
+	.long	.LASF1519
+	.long	.LASF1520
+	.long	.LASF1521
+	.long	.LASF1522
+	.long	.LASF1523
+	.long	.LASF1524
+	.long	.LASF1525
+	.long	.LASF1526
+	.long	.LASF1527
+	.long	.LASF1528
+	.long	.LASF1529
+	.long	.LASF1530
+	.long	.LASF1531
+	.long	.LASF1532
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x50
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1533
+	.byte	0xd
+	.long	.LASF1534
+	.byte	0xd
+	.long	.LASF1535
+	.byte	0xd
+	.long	.LASF1536
+	.byte	0x2
+	.long	.LASF1537
+	.byte	0x8
+	.long	.LASF1538
+	.byte	0x6
+	.long	.LASF1539
+	.byte	0x4
+	.long	.LASF1540
+	.byte	0x5
+	.long	.LASF1541
+	.byte	0x5
+	.long	.LASF1542
+	.byte	0x5
+	.long	.LASF1543
+	.byte	0x6
+	.long	.LASF1544
+	.byte	0x6
+	.long	.LASF1536
+	.byte	0x4
+	.long	.LASF1545
+	.byte	0x8
+	.long	.LASF1546
+	.byte	0x6
+	.long	.LASF1547
+	.byte	0x8
+	.long	.LASF1548
+	.byte	0x3
+	.long	.LASF1549
+	.byte	0x5
+	.long	.LASF1550
+	.byte	0x10
+	.long	.LASF1551
+	.byte	0x11
+	.long	.LASF1552
+	.byte	0x11
+	.long	.LASF1552
+	.byte	0x10
+	.long	.LASF1553
+	.byte	0xd
+	.long	.LASF1554
+	.byte	0x10
+	.long	.LASF1555
+	.byte	0x10
+	.long	.LASF1556
+	.byte	0xd
+	.long	.LASF1557
+	.byte	0xd
+	.long	.LASF1558
+	.byte	0xf
+	.long	.LASF1559
+	.byte	0xd
+	.long	.LASF1560
+	.byte	0xe
+	.long	.LASF1561
+	.byte	0xe
+	.long	.LASF1562
+	.byte	0xd
+	.long	.LASF1563
+	.byte	0xd
+	.long	.LASF1564
+	.byte	0xd
+	.long	.LASF1565
+	.byte	0x10
+	.long	.LASF1566
+	.byte	0x11
+	.long	.LASF1567
+	.byte	0xd
+	.long	.LASF1568
+	.byte	0xd
+	.long	.LASF1569
+	.byte	0xd
+	.long	.LASF1570
+	.byte	0xd
+	.long	.LASF1533
+	.byte	0xf
+	.long	.LASF1571
+	.byte	0xc
+	.long	.LASF1572
+	.byte	0xc
+	.long	.LASF1573
+	.byte	0xc
+	.long	.LASF1574
+	.byte	0xc
+	.long	.LASF1575
+	.byte	0x10
+	.long	.LASF1575
+	.byte	0xd
+	.long	.LASF1576
+	.byte	0xd
+	.long	.LASF1577
+	.byte	0xd
+	.long	.LASF1578
+	.byte	0xd
+	.long	.LASF1579
+	.byte	0xf
+	.long	.LASF1579
+	.byte	0xd
+	.long	.LASF1580
+	.byte	0xc
+	.long	.LASF1581
+	.byte	0xc
+	.long	.LASF1582
+	.byte	0xc
+	.long	.LASF1583
+	.byte	0xc
+	.long	.LASF1584
+	.byte	0xd
+	.long	.LASF1585
+	.byte	0xd
+	.long	.LASF1586
+	.byte	0xd
+	.long	.LASF1587
+	.byte	0xd
+	.long	.LASF1588
+	.byte	0xd
+	.long	.LASF1589
+	.byte	0xd
+	.long	.LASF1590
+	.byte	0x10
+	.long	.LASF1591
+	.byte	0xd
+	.long	.LASF1592
+	.byte	0xd
+	.long	.LASF1593
+	.byte	0xb
+	.long	.LASF1594
+	.byte	0xa
+	.long	.LASF1595
+	.byte	0x9
+	.long	.LASF1596
+	.byte	0xa
+	.long	.LASF1597
+	.byte	0xa
+	.long	.LASF1598
+	.byte	0x2
+	.long	.LASF1599
+	.byte	0x4
+	.long	.LASF1600
+	.byte	0x4
+	.long	.LASF1601
+	.byte	0x3
+	.long	.LASF1602
+	.byte	0x1
+	.long	.LASF1603
+	.byte	0x7
+	.long	.LASF1604
+	.byte	0x4
+	.long	.LASF1605
+	.byte	0x5
+	.long	.LASF1606
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF810:
+	.string	"__nlink_t_defined "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF1174:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF892:
+	.string	"__ONCE_ALIGNMENT "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF1192:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF878:
+	.string	"__fsfilcnt_t_defined "
+.LASF943:
+	.string	"USE_OPFLOW "
+.LASF829:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF771:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF888:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF779:
+	.string	"__HAVE_FLOAT64 1"
+.LASF915:
+	.string	"USE_SERIALRX_FPORT "
+.LASF806:
+	.string	"__ino_t_defined "
+.LASF1091:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF784:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF935:
+	.string	"USE_RX_UIB "
+.LASF1214:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF844:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF791:
+	.string	"__f64(x) x ##f64"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF986:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1445:
+	.string	"BEEPER_RX_SET"
+.LASF956:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1320:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF1460:
+	.string	"beep_shortBeep"
+.LASF1223:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF1216:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF847:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1346:
+	.string	"FEATURE_OSD"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF819:
+	.string	"__clockid_t_defined 1"
+.LASF1149:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF489:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1234:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1261:
+	.string	"int32_t"
+.LASF1198:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF940:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF909:
+	.string	"USE_I2C_PULLUP "
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1193:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1317:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF1428:
+	.string	"ALTITUDE_CONTROL"
+.LASF833:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF1377:
+	.string	"BOXNAVLAUNCH"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1385:
+	.string	"BOXGCSNAV"
+.LASF1440:
+	.string	"BEEPER_ARMING"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1189:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF768:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF1006:
+	.string	"_PTRDIFF_T_ "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1505:
+	.string	"beeperConfirmationBeeps"
+.LASF1013:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF743:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF916:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1074:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF395:
+	.string	"true 1"
+.LASF1037:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF1146:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1188:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF1155:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1157:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF923:
+	.string	"USE_TELEMETRY "
+.LASF1462:
+	.string	"beep_armedBeep"
+.LASF786:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1121:
+	.string	"UNIT_TESTED "
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1347:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF814:
+	.string	"__id_t_defined "
+.LASF1147:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF866:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF854:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1303:
+	.string	"fixType"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF982:
+	.string	"USE_SERIALRX_SUMH "
+.LASF476:
+	.string	"__P(args) args"
+.LASF822:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF994:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF887:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1430:
+	.string	"SET_REVERSIBLE_MOTORS_FORWARD"
+.LASF1396:
+	.string	"BOXOSDALT2"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF969:
+	.string	"CMS_MENU_OSD "
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF816:
+	.string	"__daddr_t_defined "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1167:
+	.string	"CALIBRATING_BARO_TIME_MS 2000"
+.LASF981:
+	.string	"USE_SERIALRX_SUMD "
+.LASF857:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF1416:
+	.string	"ACCELEROMETER_CALIBRATED"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1308:
+	.string	"groundCourse"
+.LASF728:
+	.string	"_WCHAR_T_DEFINED "
+.LASF793:
+	.string	"__f64x(x) x ##f64x"
+.LASF1015:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF869:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1007:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF778:
+	.string	"__HAVE_FLOAT32 1"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF1400:
+	.string	"BOXUSER1"
+.LASF1401:
+	.string	"BOXUSER2"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1183:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF1270:
+	.string	"year"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF730:
+	.string	"___int_wchar_t_h "
+.LASF1503:
+	.string	"beeperUpdate"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1402:
+	.string	"BOXFPVANGLEMIX"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF825:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1245:
+	.string	"BEEPER_TABLE_ENTRY_COUNT (sizeof(beeperTable) / sizeof(beeperTableEntry_t))"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF820:
+	.string	"__time_t_defined 1"
+.LASF1102:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1292:
+	.string	"gpsLocation_s"
+.LASF1293:
+	.string	"gpsLocation_t"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1204:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF996:
+	.string	"USE_CLI_BATCH "
+.LASF1035:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF947:
+	.string	"USE_1WIRE "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1340:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1431:
+	.string	"FW_HEADING_USE_YAW"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1451:
+	.string	"BEEPER_ARMED"
+.LASF1064:
+	.string	"U_ID_1 1"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1251:
+	.string	"__uint8_t"
+.LASF1057:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF880:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1043:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1494:
+	.string	"getBatteryCellCount"
+.LASF876:
+	.string	"__blkcnt_t_defined "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF767:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1228:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF1363:
+	.string	"BOXARM"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF1327:
+	.string	"FEATURE_TELEMETRY"
+.LASF773:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1418:
+	.string	"NAV_CRUISE_BRAKING"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF914:
+	.string	"USE_SERIALRX_IBUS "
+.LASF824:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1295:
+	.string	"gpsHeartbeat"
+.LASF1130:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1510:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1257:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF838:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF858:
+	.string	"__sigset_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1425:
+	.string	"MULTIROTOR"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1312:
+	.string	"ADC_BATTERY"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1126:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1456:
+	.string	"BEEPER_CAM_CONNECTION_CLOSE"
+.LASF942:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF1452:
+	.string	"BEEPER_SYSTEM_INIT"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1224:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF1111:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1438:
+	.string	"BEEPER_RX_LOST_LANDING"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1097:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF827:
+	.string	"__PDP_ENDIAN 3412"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1185:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF1243:
+	.string	"BEEPER_CONFIRMATION_BEEP_GAP_DURATION 20"
+.LASF1206:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF755:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1040:
+	.string	"USE_DASHBOARD"
+.LASF1439:
+	.string	"BEEPER_DISARMING"
+.LASF1284:
+	.string	"SENSOR_INDEX_OPFLOW"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF718:
+	.string	"__need_size_t"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1127:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1391:
+	.string	"BOXAUTOTUNE"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1080:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1158:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1333:
+	.string	"FEATURE_LED_STRIP"
+.LASF864:
+	.string	"__NFDBITS"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF1458:
+	.string	"BEEPER_PREFERENCE"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF802:
+	.string	"EXIT_SUCCESS 0"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF893:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF1313:
+	.string	"ADC_RSSI"
+.LASF1213:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF1250:
+	.string	"signed char"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF863:
+	.string	"__suseconds_t_defined "
+.LASF1262:
+	.string	"uint8_t"
+.LASF1200:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1441:
+	.string	"BEEPER_ARMING_GPS_FIX"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF978:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1349:
+	.string	"PITCH"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1306:
+	.string	"velNED"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1163:
+	.string	"VBAT_SCALE_MAX 65535"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1129:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1205:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1444:
+	.string	"BEEPER_GPS_STATUS"
+.LASF952:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1036:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF1280:
+	.string	"SENSOR_INDEX_BARO"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1379:
+	.string	"BOXTELEMETRY"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF823:
+	.string	"_ENDIAN_H 1"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1246:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1413:
+	.string	"FLAPERON_AVAILABLE"
+.LASF1498:
+	.string	"beeperTableEntryCount"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1107:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1226:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1220:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF1329:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1465:
+	.string	"beep_lowBatteryBeep"
+.LASF1022:
+	.string	"USE_UART1 "
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF865:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1081:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1453:
+	.string	"BEEPER_USB"
+.LASF924:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1077:
+	.string	"NOINLINE "
+.LASF1124:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1070:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF870:
+	.string	"NFDBITS __NFDBITS"
+.LASF891:
+	.string	"__LOCK_ALIGNMENT "
+.LASF867:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1024:
+	.string	"USE_UART3 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF933:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF856:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF813:
+	.string	"__pid_t_defined "
+.LASF1371:
+	.string	"BOXNAVRTH"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1142:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1373:
+	.string	"BOXMANUAL"
+.LASF1380:
+	.string	"BOXBLACKBOX"
+.LASF1286:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF808:
+	.string	"__gid_t_defined "
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF737:
+	.string	"NULL"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF912:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1032:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF1369:
+	.string	"BOXHEADADJ"
+.LASF899:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1169:
+	.string	"CALIBRATING_GYRO_TIME_MS 2000"
+.LASF1259:
+	.string	"char"
+.LASF1128:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF775:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF698:
+	.string	"__need_wchar_t "
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1240:
+	.string	"BEEPER_COMMAND_REPEAT 0xFE"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1496:
+	.string	"feature"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF879:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF697:
+	.string	"__need_size_t "
+.LASF1339:
+	.string	"FEATURE_AIRMODE"
+.LASF950:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1063:
+	.string	"U_ID_0 0"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1254:
+	.string	"__uint16_t"
+.LASF1094:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1054:
+	.string	"USE_ADC"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1412:
+	.string	"ANTI_WINDUP"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1018:
+	.string	"USE_FAKE_MAG "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF875:
+	.string	"__blksize_t_defined "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF799:
+	.string	"__lldiv_t_defined 1"
+.LASF1087:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1076:
+	.string	"FAST_CODE "
+.LASF1448:
+	.string	"BEEPER_READY_BEEP"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1500:
+	.string	"beeperModeForTableIndex"
+.LASF700:
+	.string	"__size_t__ "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1513:
+	.string	"beeperProcessCommand"
+.LASF1066:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF789:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1291:
+	.string	"_dateTime_s"
+.LASF1302:
+	.string	"flags"
+.LASF759:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF766:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF907:
+	.string	"I2C1_OVERCLOCK false"
+.LASF1160:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF795:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF794:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1131:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF760:
+	.string	"__W_CONTINUED 0xffff"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF967:
+	.string	"USE_STATS "
+.LASF1139:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF958:
+	.string	"USE_FRSKYOSD "
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1420:
+	.string	"NAV_CRUISE_BRAKING_LOCKED"
+.LASF985:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1324:
+	.string	"FEATURE_GPS"
+.LASF1203:
+	.string	"LON 1"
+.LASF868:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF845:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1114:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1301:
+	.string	"gpsSolutionData_s"
+.LASF1311:
+	.string	"gpsSolutionData_t"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1225:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF731:
+	.string	"__INT_WCHAR_T_H "
+.LASF925:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1237:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1275:
+	.string	"millis"
+.LASF721:
+	.string	"_WCHAR_T "
+.LASF937:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1463:
+	.string	"beep_disarmBeep"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF911:
+	.string	"USE_SERIAL_RX "
+.LASF862:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF913:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF993:
+	.string	"USE_VTX_FFPV "
+.LASF818:
+	.string	"__clock_t_defined 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1515:
+	.string	"beeper"
+.LASF1044:
+	.string	"USE_RANGEFINDER"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF1370:
+	.string	"BOXCAMSTAB"
+.LASF1281:
+	.string	"SENSOR_INDEX_MAG"
+.LASF1093:
+	.string	"STR_HELPER(x) #x"
+.LASF903:
+	.string	"alloca"
+.LASF1299:
+	.string	"validEPE"
+.LASF1219:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1239:
+	.string	"MAX_MULTI_BEEPS 20"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF1315:
+	.string	"ADC_AIRSPEED"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1166:
+	.string	"MAX_BATTERY_PROFILE_COUNT 3"
+.LASF1404:
+	.string	"BOXMSPRCOVERRIDE"
+.LASF800:
+	.string	"RAND_MAX 2147483647"
+.LASF1202:
+	.string	"LAT 0"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1141:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF733:
+	.string	"_WCHAR_T_DECLARED "
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF965:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF979:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF811:
+	.string	"__uid_t_defined "
+.LASF1090:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF1407:
+	.string	"GPS_FIX_HOME"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1137:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF738:
+	.string	"NULL ((void *)0)"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1088:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1244:
+	.string	"BEEPER_ENTRY(a,b,c,d) a,b,c,d"
+.LASF1038:
+	.string	"USE_USB_MSC"
+.LASF769:
+	.string	"_BITS_FLOATN_H "
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1153:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1442:
+	.string	"BEEPER_BAT_CRIT_LOW"
+.LASF1029:
+	.string	"USE_UART8 "
+.LASF785:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF1507:
+	.string	"cLimit"
+.LASF1106:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF843:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF783:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1447:
+	.string	"BEEPER_ACTION_FAIL"
+.LASF968:
+	.string	"USE_CMS "
+.LASF1105:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF777:
+	.string	"__HAVE_FLOAT16 0"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1110:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF927:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1321:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF960:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1426:
+	.string	"ROVER"
+.LASF873:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1511:
+	.string	"rc_alias"
+.LASF742:
+	.string	"WUNTRACED 2"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1258:
+	.string	"__uint64_t"
+.LASF1031:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1499:
+	.string	"beeperNameForTableIndex"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1249:
+	.string	"long unsigned int"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF928:
+	.string	"USE_PITOT "
+.LASF1390:
+	.string	"BOXAUTOTRIM"
+.LASF1422:
+	.string	"AIRMODE_ACTIVE"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF752:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1073:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1071:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1098:
+	.string	"UNUSED(x) (void)(x)"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1125:
+	.string	"EXTENDED_FASTRAM "
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF850:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1502:
+	.string	"currentTimeUs"
+.LASF1383:
+	.string	"BOXAIRMODE"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1086:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF699:
+	.string	"__need_NULL "
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1170:
+	.string	"CALIBRATING_ACC_TIME_MS 500"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF744:
+	.string	"WEXITED 4"
+.LASF999:
+	.string	"_STDDEF_H "
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF1309:
+	.string	"hdop"
+.LASF984:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1201:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1186:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1211:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1108:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF804:
+	.string	"_SYS_TYPES_H 1"
+.LASF1016:
+	.string	"USE_IMU_FAKE "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1084:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF849:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1030:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF948:
+	.string	"USE_1WIRE_DS2482 "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1008:
+	.string	"___int_ptrdiff_t_h "
+.LASF796:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF955:
+	.string	"USE_OLED_UG2864 "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF991:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1392:
+	.string	"BOXCAMERA1"
+.LASF1003:
+	.string	"_T_PTRDIFF_ "
+.LASF1019:
+	.string	"USE_FAKE_GPS "
+.LASF1236:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1409:
+	.string	"CALIBRATE_MAG"
+.LASF1508:
+	.string	"selectedCandidate"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1033:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1472:
+	.string	"beep_2longerBeeps"
+.LASF513:
+	.string	"__always_inline"
+.LASF1459:
+	.string	"beeperMode_e"
+.LASF1323:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF921:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF988:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF926:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF765:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1168:
+	.string	"CALIBRATING_PITOT_TIME_MS 2000"
+.LASF853:
+	.string	"_SYS_SELECT_H 1"
+.LASF1341:
+	.string	"FEATURE_VTX"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1067:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1450:
+	.string	"BEEPER_DISARM_REPEAT"
+.LASF1089:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF1148:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF890:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1334:
+	.string	"FEATURE_DASHBOARD"
+.LASF781:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1256:
+	.string	"__uint32_t"
+.LASF992:
+	.string	"USE_VTX_TRAMP "
+.LASF1427:
+	.string	"BOAT"
+.LASF1283:
+	.string	"SENSOR_INDEX_PITOT"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF817:
+	.string	"__key_t_defined "
+.LASF1266:
+	.string	"long long int"
+.LASF1316:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF719:
+	.string	"__wchar_t__ "
+.LASF901:
+	.string	"__have_pthread_attr_t 1"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF837:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF788:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF997:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1480:
+	.string	"beeperPos"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF1434:
+	.string	"BEEPER_SILENCE"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF1133:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF983:
+	.string	"USE_SERIALRX_XBUS "
+.LASF706:
+	.string	"__SIZE_T "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1482:
+	.string	"armingBeepTimeMicros"
+.LASF1227:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1366:
+	.string	"BOXNAVALTHOLD"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1058:
+	.string	"USE_RCDEVICE"
+.LASF832:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF466:
+	.string	"__PMT"
+.LASF1433:
+	.string	"stateFlags"
+.LASF971:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1115:
+	.string	"BEEP_TOGGLE do {} while (0)"
+.LASF946:
+	.string	"USE_PITOT_MS4525 "
+.LASF1319:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF848:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1282:
+	.string	"SENSOR_INDEX_RANGEFINDER"
+.LASF1209:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1406:
+	.string	"boxId_e"
+.LASF774:
+	.string	"__f128(x) x ##f128"
+.LASF836:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1241:
+	.string	"BEEPER_COMMAND_STOP 0xFF"
+.LASF1429:
+	.string	"MOVE_FORWARD_ONLY"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1208:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1277:
+	.string	"float"
+.LASF1298:
+	.string	"validMag"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1001:
+	.string	"_ANSI_STDDEF_H "
+.LASF1274:
+	.string	"seconds"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1481:
+	.string	"beeperNextToggleTime"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF358:
+	.string	"__k8 1"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1191:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF780:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF770:
+	.string	"__HAVE_FLOAT128 1"
+.LASF851:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1493:
+	.string	"warningLedDisable"
+.LASF757:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF1276:
+	.string	"dateTime_t"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1248:
+	.string	"unsigned int"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF1490:
+	.string	"isHardwareHealthy"
+.LASF957:
+	.string	"USE_TELEMETRY_SIM "
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1469:
+	.string	"beep_armedGpsFix"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1476:
+	.string	"beep_camOpenBeep"
+.LASF735:
+	.string	"_BSD_WCHAR_T_"
+.LASF1161:
+	.string	"VBAT_SCALE_DEFAULT 1100"
+.LASF1210:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1048:
+	.string	"USE_PITOT_ADC"
+.LASF1467:
+	.string	"beep_txLostBeep"
+.LASF1466:
+	.string	"beep_critBatteryBeep"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1497:
+	.string	"getBeeperOffMask"
+.LASF1218:
+	.string	"BOXID_NONE 255"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF1136:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1221:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF1177:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF974:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF1004:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1417:
+	.string	"PWM_DRIVER_AVAILABLE"
+.LASF1100:
+	.string	"BIT(x) (1 << (x))"
+.LASF1002:
+	.string	"_PTRDIFF_T "
+.LASF1491:
+	.string	"warningLedEnable"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1278:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1184:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1061:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF976:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1181:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF1461:
+	.string	"beep_armingBeep"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF932:
+	.string	"USE_GYRO_KALMAN "
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF908:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1152:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF852:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF396:
+	.string	"false 0"
+.LASF1486:
+	.string	"sequence"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1432:
+	.string	"gpsSol"
+.LASF1273:
+	.string	"minutes"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1199:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF1395:
+	.string	"BOXOSDALT1"
+.LASF1397:
+	.string	"BOXOSDALT3"
+.LASF1479:
+	.string	"beeperIsOn"
+.LASF1468:
+	.string	"beep_sos"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1504:
+	.string	"beeperGpsStatus"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1332:
+	.string	"FEATURE_RSSI_ADC"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF751:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1514:
+	.string	"beeperSilence"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF750:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1375:
+	.string	"BOXLEDLOW"
+.LASF1304:
+	.string	"numSat"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF787:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF764:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF963:
+	.string	"USE_ANTIGRAVITY "
+.LASF1408:
+	.string	"GPS_FIX"
+.LASF739:
+	.string	"__need_NULL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF1322:
+	.string	"FEATURE_UNUSED_1"
+.LASF1325:
+	.string	"FEATURE_UNUSED_3"
+.LASF1326:
+	.string	"FEATURE_UNUSED_4"
+.LASF1330:
+	.string	"FEATURE_UNUSED_5"
+.LASF1331:
+	.string	"FEATURE_UNUSED_6"
+.LASF1335:
+	.string	"FEATURE_UNUSED_7"
+.LASF1342:
+	.string	"FEATURE_UNUSED_8"
+.LASF1343:
+	.string	"FEATURE_UNUSED_9"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1017:
+	.string	"USE_FAKE_BARO "
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF798:
+	.string	"__ldiv_t_defined 1"
+.LASF1414:
+	.string	"NAV_MOTOR_STOP_OR_IDLE"
+.LASF1009:
+	.string	"_GCC_PTRDIFF_T "
+.LASF922:
+	.string	"USE_NAV "
+.LASF550:
+	.string	"__stub_revoke "
+.LASF859:
+	.string	"____sigset_t_defined "
+.LASF1020:
+	.string	"USE_MAG "
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1242:
+	.string	"BEEPER_CONFIRMATION_BEEP_DURATION 2"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF729:
+	.string	"_WCHAR_T_H "
+.LASF975:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1028:
+	.string	"USE_UART7 "
+.LASF980:
+	.string	"USE_RX_MSP "
+.LASF1389:
+	.string	"BOXTURNASSIST"
+.LASF964:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF839:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF902:
+	.string	"_ALLOCA_H 1"
+.LASF906:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1162:
+	.string	"VBAT_SCALE_MIN 0"
+.LASF1403:
+	.string	"BOXLOITERDIRCHN"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1421:
+	.string	"NAV_EXTRA_ARMING_SAFETY_BYPASSED"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1050:
+	.string	"USE_1WIRE_DS2482"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1475:
+	.string	"beep_hardwareFailure"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF934:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1000:
+	.string	"_STDDEF_H_ "
+.LASF1045:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1143:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF977:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1217:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF855:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF1132:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1010:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1112:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1055:
+	.string	"USE_VCP"
+.LASF987:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF762:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF724:
+	.string	"__WCHAR_T "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF840:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF732:
+	.string	"_GCC_WCHAR_T "
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1085:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1113:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF745:
+	.string	"WCONTINUED 8"
+.LASF748:
+	.string	"__WALL 0x40000000"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF860:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1229:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF970:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1042:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1365:
+	.string	"BOXHORIZON"
+.LASF1338:
+	.string	"FEATURE_TRANSPONDER"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1267:
+	.string	"long long unsigned int"
+.LASF1506:
+	.string	"beepCount"
+.LASF1135:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1382:
+	.string	"BOXNAVWP"
+.LASF1305:
+	.string	"magData"
+.LASF761:
+	.string	"__WCOREFLAG 0x80"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1116:
+	.string	"BEEP_OFF do {} while (0)"
+.LASF815:
+	.string	"__ssize_t_defined "
+.LASF1263:
+	.string	"uint16_t"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1005:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF962:
+	.string	"USE_D_BOOST "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1119:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1014:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF821:
+	.string	"__timer_t_defined 1"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1495:
+	.string	"IS_RC_MODE_ACTIVE"
+.LASF1164:
+	.string	"CURRENT_METER_SCALE 400"
+.LASF1285:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF756:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF807:
+	.string	"__dev_t_defined "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1489:
+	.string	"currentBeeperEntry"
+.LASF1307:
+	.string	"groundSpeed"
+.LASF1117:
+	.string	"BEEP_ON do {} while (0)"
+.LASF1328:
+	.string	"FEATURE_CURRENT_METER"
+.LASF1287:
+	.string	"GPS_NO_FIX"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1318:
+	.string	"FEATURE_VBAT"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1026:
+	.string	"USE_UART5 "
+.LASF1144:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF954:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF897:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF722:
+	.string	"_T_WCHAR_ "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1075:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF717:
+	.string	"__size_t "
+.LASF872:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF830:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF953:
+	.string	"USE_DASHBOARD "
+.LASF1386:
+	.string	"BOXKILLSWITCH"
+.LASF1180:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF1398:
+	.string	"BOXNAVCRUISE"
+.LASF961:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF736:
+	.string	"__need_wchar_t"
+.LASF1454:
+	.string	"BEEPER_LAUNCH_MODE_ENABLED"
+.LASF1478:
+	.string	"beep_multiBeeps"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF841:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF1437:
+	.string	"BEEPER_RX_LOST"
+.LASF826:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1399:
+	.string	"BOXBRAKING"
+.LASF905:
+	.string	"__COMPAR_FN_T "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF881:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1182:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF945:
+	.string	"USE_OPFLOW_MSP "
+.LASF723:
+	.string	"_T_WCHAR "
+.LASF740:
+	.string	"_STDLIB_H 1"
+.LASF1021:
+	.string	"USE_BARO "
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF1423:
+	.string	"ESC_SENSOR_ENABLED"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1300:
+	.string	"validTime"
+.LASF1252:
+	.string	"__int16_t"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1165:
+	.string	"CURRENT_METER_OFFSET 0"
+.LASF920:
+	.string	"USE_GPS "
+.LASF482:
+	.string	"__END_DECLS "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF944:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF917:
+	.string	"USE_ADC_AVERAGING "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1443:
+	.string	"BEEPER_BAT_LOW"
+.LASF874:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF726:
+	.string	"_BSD_WCHAR_T_ "
+.LASF895:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1464:
+	.string	"beep_disarmRepeatBeep"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF812:
+	.string	"__off_t_defined "
+.LASF1156:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF938:
+	.string	"USE_RANGEFINDER "
+.LASF1310:
+	.string	"time"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1060:
+	.string	"USE_ITCM_RAM"
+.LASF1092:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1436:
+	.string	"BEEPER_HARDWARE_FAILURE"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF990:
+	.string	"USE_VTX_CONTROL "
+.LASF1059:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF727:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1488:
+	.string	"beeperTableEntry_t"
+.LASF1233:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1474:
+	.string	"beep_launchModeBeep"
+.LASF1350:
+	.string	"THROTTLE"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF772:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1178:
+	.string	"MIDRC_MIN 1200"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1271:
+	.string	"month"
+.LASF1411:
+	.string	"FIXED_WING_LEGACY"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1235:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1140:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF861:
+	.string	"__timeval_defined 1"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1027:
+	.string	"USE_UART6 "
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF725:
+	.string	"_WCHAR_T_ "
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1172:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1173:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF835:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1079:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF930:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF776:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1230:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1501:
+	.string	"getArmingBeepTimeMicros"
+.LASF1512:
+	.string	"beeperTable"
+.LASF790:
+	.string	"__f32(x) x ##f32"
+.LASF1360:
+	.string	"AUX10"
+.LASF1361:
+	.string	"AUX11"
+.LASF1362:
+	.string	"AUX12"
+.LASF1487:
+	.string	"name"
+.LASF1134:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1051:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1424:
+	.string	"AIRPLANE"
+.LASF1288:
+	.string	"GPS_FIX_2D"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF746:
+	.string	"WNOWAIT 0x01000000"
+.LASF1197:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF1294:
+	.string	"hasNewData"
+.LASF1336:
+	.string	"FEATURE_BLACKBOX"
+.LASF1150:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1171:
+	.string	"HW_SENSOR_IS_HEALTHY(status) (status == HW_SENSOR_NONE || status == HW_SENSOR_OK)"
+.LASF1176:
+	.string	"PWM_PULSE_MIN 750"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1159:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1253:
+	.string	"short int"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1083:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF828:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1265:
+	.string	"uint64_t"
+.LASF1484:
+	.string	"mode"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1485:
+	.string	"priority"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF918:
+	.string	"USE_64BIT_TIME "
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1047:
+	.string	"USE_PITOT_MS4525"
+.LASF846:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1345:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF941:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF1260:
+	.string	"int16_t"
+.LASF1231:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF939:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1122:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1212:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1151:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1289:
+	.string	"GPS_FIX_3D"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1012:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1123:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1509:
+	.string	"candidate"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1072:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1435:
+	.string	"BEEPER_RUNTIME_CALIBRATION_DONE"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF1082:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF720:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF741:
+	.string	"WNOHANG 1"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF1470:
+	.string	"beep_readyBeep"
+.LASF1419:
+	.string	"NAV_CRUISE_BRAKING_BOOST"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF383:
+	.string	"SITL 1"
+.LASF1471:
+	.string	"beep_2shortBeeps"
+.LASF1078:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF734:
+	.string	"__DEFINED_wchar_t "
+.LASF803:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF792:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1099:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1415:
+	.string	"COMPASS_CALIBRATED"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1120:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1374:
+	.string	"BOXBEEPERON"
+.LASF898:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF763:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF896:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF1446:
+	.string	"BEEPER_ACTION_SUCCESS"
+.LASF1376:
+	.string	"BOXLIGHTS"
+.LASF1393:
+	.string	"BOXCAMERA2"
+.LASF1394:
+	.string	"BOXCAMERA3"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1095:
+	.string	"EXPAND_I(x) x"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF889:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF842:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1062:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF929:
+	.string	"USE_PITOT_ADC "
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1104:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1195:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF1290:
+	.string	"gpsFixType_e"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF834:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF951:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF936:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1364:
+	.string	"BOXANGLE"
+.LASF1053:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1268:
+	.string	"timeMs_t"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF749:
+	.string	"__WCLONE 0x80000000"
+.LASF1207:
+	.string	"HDOP_SCALE (100)"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1023:
+	.string	"USE_UART2 "
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1179:
+	.string	"MIDRC_MAX 1700"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1138:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1368:
+	.string	"BOXHEADFREE"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF900:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF1384:
+	.string	"BOXHOMERESET"
+.LASF1264:
+	.string	"uint32_t"
+.LASF1297:
+	.string	"validVelD"
+.LASF1272:
+	.string	"hours"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF754:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF1492:
+	.string	"warningLedRefresh"
+.LASF831:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF1405:
+	.string	"CHECKBOX_ITEM_COUNT"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF758:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF1232:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1049:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1034:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF1410:
+	.string	"SMALL_ANGLE"
+.LASF1041:
+	.string	"USE_OLED_UG2864"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1372:
+	.string	"BOXNAVPOSHOLD"
+.LASF1039:
+	.string	"USE_SERVO_SBUS"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1449:
+	.string	"BEEPER_MULTI_BEEPS"
+.LASF1068:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1052:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1238:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1056:
+	.string	"USE_RX_PPM"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1187:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF376:
+	.string	"unix 1"
+.LASF1269:
+	.string	"timeUs_t"
+.LASF1247:
+	.string	"short unsigned int"
+.LASF995:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1348:
+	.string	"ROLL"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF973:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1351:
+	.string	"AUX1"
+.LASF1352:
+	.string	"AUX2"
+.LASF1353:
+	.string	"AUX3"
+.LASF1354:
+	.string	"AUX4"
+.LASF1355:
+	.string	"AUX5"
+.LASF1356:
+	.string	"AUX6"
+.LASF1357:
+	.string	"AUX7"
+.LASF1358:
+	.string	"AUX8"
+.LASF1359:
+	.string	"AUX9"
+.LASF747:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF809:
+	.string	"__mode_t_defined "
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1222:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF753:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1194:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF1337:
+	.string	"FEATURE_UNUSED_10"
+.LASF1344:
+	.string	"FEATURE_UNUSED_11"
+.LASF894:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1145:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1483:
+	.string	"beeperTableEntry_s"
+.LASF1387:
+	.string	"BOXSURFACE"
+.LASF1314:
+	.string	"ADC_CURRENT"
+.LASF1011:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1473:
+	.string	"beep_runtimeCalibrationDone"
+.LASF966:
+	.string	"USE_LOG "
+.LASF910:
+	.string	"USE_RX_PPM "
+.LASF1255:
+	.string	"__int32_t"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF919:
+	.string	"USE_BLACKBOX "
+.LASF801:
+	.string	"EXIT_FAILURE 1"
+.LASF1101:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF1109:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF797:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1025:
+	.string	"USE_UART4 "
+.LASF1096:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF989:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1381:
+	.string	"BOXFAILSAFE"
+.LASF1065:
+	.string	"U_ID_2 2"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF1103:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1175:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1069:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1367:
+	.string	"BOXHEADINGHOLD"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF805:
+	.string	"__u_char_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1118:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1388:
+	.string	"BOXFLAPERON"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1296:
+	.string	"validVelNE"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF871:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF998:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1215:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF904:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF1196:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1457:
+	.string	"BEEPER_ALL"
+.LASF1477:
+	.string	"beep_camCloseBeep"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1378:
+	.string	"BOXOSD"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF931:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1455:
+	.string	"BEEPER_CAM_CONNECTION_OPEN"
+.LASF1190:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF972:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1154:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1046:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF949:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1279:
+	.string	"SENSOR_INDEX_ACC"
+.LASF877:
+	.string	"__fsblkcnt_t_defined "
+.LASF959:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1581:
+	.string	"__sigset_t.h"
+.LASF1588:
+	.string	"struct_mutex.h"
+.LASF1597:
+	.string	"common_post.h"
+.LASF1559:
+	.string	"long-double.h"
+.LASF1580:
+	.string	"sigset_t.h"
+.LASF1590:
+	.string	"alloca.h"
+.LASF1522:
+	.string	"src/main/rx"
+.LASF1519:
+	.string	"src/main/drivers"
+.LASF1547:
+	.string	"battery.h"
+.LASF1553:
+	.string	"libc-header-start.h"
+.LASF1530:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1575:
+	.string	"endian.h"
+.LASF1585:
+	.string	"thread-shared-types.h"
+.LASF1534:
+	.string	"stdint-intn.h"
+.LASF1549:
+	.string	"rc_controls.h"
+.LASF1529:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1532:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1544:
+	.string	"beeper.c"
+.LASF1524:
+	.string	"src/main/target/SITL"
+.LASF1543:
+	.string	"beeper.h"
+.LASF1571:
+	.string	"clock_t.h"
+.LASF1521:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1605:
+	.string	"stats.h"
+.LASF1528:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1540:
+	.string	"config.h"
+.LASF1565:
+	.string	"stdlib.h"
+.LASF1555:
+	.string	"features-time64.h"
+.LASF1586:
+	.string	"pthreadtypes-arch.h"
+.LASF1533:
+	.string	"types.h"
+.LASF1570:
+	.string	"floatn-common.h"
+.LASF1574:
+	.string	"timer_t.h"
+.LASF1569:
+	.string	"floatn.h"
+.LASF1542:
+	.string	"runtime_config.h"
+.LASF1563:
+	.string	"time64.h"
+.LASF1551:
+	.string	"stdbool.h"
+.LASF1531:
+	.string	"/usr/include"
+.LASF1583:
+	.string	"struct_timespec.h"
+.LASF1573:
+	.string	"time_t.h"
+.LASF1516:
+	.string	"src/main/build"
+.LASF1548:
+	.string	"feature.h"
+.LASF1554:
+	.string	"features.h"
+.LASF1594:
+	.string	"common.h"
+.LASF1562:
+	.string	"typesizes.h"
+.LASF1584:
+	.string	"pthreadtypes.h"
+.LASF1517:
+	.string	"src/main/common"
+.LASF1572:
+	.string	"clockid_t.h"
+.LASF1518:
+	.string	"src/main/config"
+.LASF1537:
+	.string	"sensors.h"
+.LASF1541:
+	.string	"rc_modes.h"
+.LASF1535:
+	.string	"stdint-uintn.h"
+.LASF1577:
+	.string	"byteswap.h"
+.LASF1525:
+	.string	"src/main/target"
+.LASF1598:
+	.string	"utils.h"
+.LASF1546:
+	.string	"statusindicator.h"
+.LASF1526:
+	.string	"src/main"
+.LASF1567:
+	.string	"waitflags.h"
+.LASF1595:
+	.string	"target.h"
+.LASF1523:
+	.string	"src/main/sensors"
+.LASF0:
+	.string	"./src/main/io/beeper.c"
+.LASF1568:
+	.string	"waitstatus.h"
+.LASF1557:
+	.string	"timesize.h"
+.LASF1604:
+	.string	"rx_pwm.h"
+.LASF1536:
+	.string	"time.h"
+.LASF1545:
+	.string	"diagnostics.h"
+.LASF1600:
+	.string	"io_types.h"
+.LASF1564:
+	.string	"wchar.h"
+.LASF1603:
+	.string	"rx.h"
+.LASF1538:
+	.string	"gps.h"
+.LASF1520:
+	.string	"src/main/fc"
+.LASF1591:
+	.string	"stdlib-bsearch.h"
+.LASF1560:
+	.string	"stubs.h"
+.LASF1606:
+	.string	"bitarray.h"
+.LASF1589:
+	.string	"struct_rwlock.h"
+.LASF1527:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1596:
+	.string	"sanity_check.h"
+.LASF1558:
+	.string	"cdefs.h"
+.LASF1579:
+	.string	"select.h"
+.LASF1552:
+	.string	"stdint.h"
+.LASF1602:
+	.string	"build_config.h"
+.LASF1566:
+	.string	"stddef.h"
+.LASF1561:
+	.string	"stubs-64.h"
+.LASF1593:
+	.string	"platform.h"
+.LASF1556:
+	.string	"wordsize.h"
+.LASF1578:
+	.string	"uintn-identity.h"
+.LASF1599:
+	.string	"sound_beeper.h"
+.LASF1587:
+	.string	"atomic_wide_counter.h"
+.LASF1582:
+	.string	"struct_timeval.h"
+.LASF1539:
+	.string	"adc.h"
+.LASF1601:
+	.string	"parameter_group.h"
+.LASF1576:
+	.string	"endianness.h"
+.LASF1550:
+	.string	"stdc-predef.h"
+.LASF1592:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`\274"
+	.string	"5\n"
+	.string	"\324\017\260\001"
+	.string	"%"
+	.string	"\214\357\302\202\n\016\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\003\002\003\002\004\002\004\001\317\323\360\370\002\002\352\263\360\321\b\003\004\005\215\363\257\265\006\b\002\004\002\004\001\002\001\006\007\353\274\351\225\013"
+	.string	"\b\270\237\273\274\017"
+	.string	"\t\335\334\312\362\016\026\005\002"
+	.string	"\006\002\006\n\230\231\221\213\r\006\002\002\002\007\013\240\342\234\212\n\f\340\322\240\313\001\f\002\002\b\017\304\301\210\254\004\036\020\021\345\322\317\302\r\022\211\372\223\346\t\t\023\207\372\345\304\006\002\002\n\002\t\024\347\256\357\227\007"
+	.string	"\025\362\357\223\326\007\026\215\267\341\311\f\027\224\260\200\211\016\030\221\217\266\271\r\031\323\225\203\251\017\032\232\371\351\226\t\033\255\373\374\314\t\034\337\357\214\246\006\035\272\216\231\221\013\036\037\245\306\341\224\002 \277\333\373\341\b!\353\255\212\335\b\"\226\324\227\272\017#\342\300\207\245\b$\347\350\265\322\001%\215\213\324\275\003&\372\214\227\221\002"
+	.string	"\035"
+	.string	"\312T\211KD\361\332U\321\264\033*\306\321\007\266-\320\343\0053p\300\t\234\b\340\206k+\004"
+	.ascii	"E\303R\367\357\304\235\220\305\315\003\254\242\341\364\30624"
+	.ascii	"f\224\020\251n\340\214AcR\304}Ia\245-\r\f\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375 \200E\002"
+	.string	"\004\002t"
+	.string	"\f"
+	.string	"\001\001\005"
+	.string	"\001\007\001\b\t\001\n\001"
+	.string	"\001\001"
+	.string	"\001\017\021"
+	.string	"\003\022\003\023\024"
+	.string	"\003"
+	.string	"\020"
+	.ascii	"*\203\213^\002B\001\271\003f\022\341*\306\315C\246\232\271,\301"
+	.ascii	"\t\320\fP\t\027sX.\362K\030\033\300\002"
+	.text
+	.section	.gnu.lto_.inline.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`-\002\305\f"
+	.string	"\306\321@; \345*\215\001\307\333\202\245\030\346\311L\232Db!P8\352\226\206\\\235R\3422DB3n\004RA"
+	.string	"\002\213\226@ \003\004\304\200@\303\tS\336\007\3347\217NN\376\336R\246/"
+	.string	"0"
+	.string	"6"
+	.string	"\020G\327\212\311K\301\233\216\232\274?\355\234s~\2215\347\344\254\371\337\267\024w\273]"
+	.string	"\357\303\r\321\331n\t\373\032.\214\316v\033=xD\bwV\336\243\"\313#F\253\251\210|\030\314\031\245\371S0\336`\241\177\337\237ie4\215\332g\201\245\304\234s\365\362\367\254r\250g#T\345y6\244\210\261\021K\331p'\214\242\202! \025s\0272%\013\203\30283\213q)\244\366\004\300\253\345`\260\264\324\245j3p\255\231(\376\340\352\272\252\026\005\327\232\205\002\377q\021\013L6\242\035J\342\002\222\333L\360\311%i\377>\253\203vB\037\251\203\367\331\207w=\355k\316\271y\340\337}5\305\220<? P\"3u\347\001\240)`#\240\271;\f0\bxF\3326\203\253\032\364v\rH\370&f~\004L\356\004H\322}\274\f\300\202\030g\307-\024'\f\330b\200\345"
+	.ascii	"R\n\346\0052\004|\036\\\212\203\332\333\211\345\314pu\217\253"
+	.ascii	"% S\200\300g\036\016\177\257\324\255\336\270?H{\266!\033\216"
+	.ascii	"\372K\263\262\340\034n\004\205\354\266^\314\274\256\"\3148\200"
+	.ascii	"\331\324J\013>\355c\017l\323S\325\320\352\340\323`\301\200\326"
+	.ascii	"\200\247\311\270\326{(J\341\334"
+	.text
+	.section	.gnu.lto_.jmpfuncs.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375 \366]\004"
+	.string	"B\305\022\036\240'\351?\370\377+g"
+	.string	""
+	.string	"b\034`\236\005"
+	.string	""
+	.string	"\214\333\377\267\366\323\332\377'\2374)S\277\"a@\374a\241(\325`\233N\301\350`\373#3D\030T1\t\276%\343\264\277\335\335\321,\323,\374\023\323"
+	.string	"\240\232 \344\350G\033"
+	.string	"\252\301\006\273\ba\356\300\005\212=\233\301\2127\006.\223:\3443\b\002\305\241u\335\035\004\273i\022\234\200v@\t\203\223%\330\201\306\2008\234\347|\232@g\363\027\2745\355\331"
+	.ascii	"\026"
+	.text
+	.section	.gnu.lto_.pureconst.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\231\004\005\230\004\007\230\004\b\230\004\t\231\004\n\230\004"
+	.ascii	"\f\230\004\017\231\004\021\204\004\022\200\004\023\200\004\024"
+	.ascii	"\200\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375 \300e\003"
+	.string	"\364\003\264"
+	.string	"\n"
+	.string	"\001\274\006"
+	.string	""
+	.string	""
+	.string	"\002\002"
+	.string	""
+	.string	"\001\002"
+	.string	"\001"
+	.string	"\002\022\001"
+	.string	""
+	.string	"\003\023"
+	.string	"\001\002\023\001"
+	.string	"\002\020"
+	.string	"\001\002\020\001"
+	.string	""
+	.string	""
+	.string	"\005\007\b"
+	.string	"\t\002\n"
+	.string	"\f\002\002\024\001\021\001\022\001@"
+	.string	"\023"
+	.string	"\023"
+	.ascii	".[\200$\234\005@\007\202\345\\wa\022Q\005\006\r\261\206\341\266"
+	.ascii	"\362\354\347\020\200\020\027\001\356Z,\360\252\2051\265\330@"
+	.ascii	"\033"
+	.text
+	.section	.gnu.lto_.lto.e1eead161ea8018c,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_beeperTable.81.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`\356\006\365$"
+	.string	"\212@\314\016G`^n\016\263K\023jq\312\r\314\300\fZP*\356]g\364\016'\307\260\001?v\250\035\037,\3536w\360\243\340O\362}m\221\265\255\347\234 \373,\370\213\3003\013\264C\322h:\236\266\032\242\364\277#\237\245$\003\337"
+	.string	"\331"
+	.string	"\324"
+	.string	"~\206h\245P M\323\226\303d\321\331\267R?\213\312\274n\006\3663\261\317\025AX\002\311\030\317.6&\033\022\235]+\365\023@\230\271\330\273"
+	.string	"\360`\017L\024p\216\t\246!\3653"
+	.string	"\227.\261c\t\340\301\336\226\247\tv\232-:_H\375\024`\345\365+\260c\211]\212"
+	.string	"\345\262J\324\276\303\214\200\316R\251\237FP^\217\002\273\224\330\231\030Ip\017\320=\221\332w\232S\350\\L\375<R\362\372\022\330\231\304.w\344A*\n)Y\222\252\263+\217\311V\001\235\033\244~\"\305\311\305\356\206d\304\002\260\311\004\263Bg\005\351Q\317Og{\275\rv\267\330\3376p0\2005\"\313\201\237\003\200\036\354\320\363S\373\232\207\337Y3\017\314\016\026\326\354[~\312\350\374\251\237\332\227Z\367\270\002\357\323\200_,\376\257^\230<\243"
+	.string	"\235\f\031m\3375\351\244~\376x\275\037\003\376\257\370_\374\210\311gIt0d\033\033\017\007:{]\352\347\267x\337\005\374/\342O\201\216\311g\004\236\205\\\266\361\232;\320\331\311\244~\002\375\211\367Q\300\237\"\376-\240\340\233\220\333\366\233,\251\237A#\336'\001\377V\374 \202\314\3443\002\"\236\366\033\217\222\372\351\373\254\367\265\340\007\021;\036\337\217\245\322\177\220\3216\034!\350\354o\251\237?;\257\337\201\035O\354\315_\332r\256\023\265\341"
+	.ascii	"I\375\024\212\363\272\034\330\233\261\267\021\222\325\344\265"
+	.ascii	"$28r\333\216\303|Cg\317\221\3729\224\367:\033\330\333\304^7\244"
+	.ascii	"\016\223\350\260\260\262\360\242v\234\246{\245~\022\251y}\r\354"
+	.ascii	"uq\304u\257L\353v\002\322\016\347E\374\210#\361&\356\304\247"
+	.ascii	"8\025\317\342Z\334\213\177q1>\306\3218\235\333\371\235\273\361"
+	.ascii	"7>\307\351x\236\307\372\020??\327\227x\025\277\342\273\032<\330"
+	.ascii	"\207}\215\267\361d_\366=\376\354\203\274\220'\362k\017\307\340"
+	.ascii	"\217,\220\265z\340\336\310\373q\360\313\305\377\246C\310\"\020"
+	.ascii	"|\021\251\215\346\343\332\336w\203\377-~5'!\237)\261\311m\273"
+	.ascii	"\356\323\322\336g\302\257\026?\332s\r\221\313v\335\367H\375\354"
+	.ascii	"\371\361>\020\370\321\3427\3531!\243P\362!\253\330v"
+	.string	"L\026\350\374a\251\237>;\336\347\001\277Y\374c>.\226A2\035r\327\266kz\241\363\257H\375<q\274\237\003\376\261\370\305\316\257%\220\356\306\323\276c~oF\372\210d\223\352^b\213\352\320]\215l\362\250\334Fz\335\312\345\003\237F\211G\265\350&[d\321\205\332E\272\351\310\006\351\037\r\3052\271MG\326\270U\"v\017\205\364\022Yt\223\352\022\252[eRM\266n\353\324\344\323\311\265u\241\366\217n\333u8T\266D\272\310\252L\352OG\021\325u\373t\353\264\256K.\233,*\215?\235TW\247u\273\306\255\266,qH\023W\343V{:\311\036Y\327\270&\333\250\366\247\227Z\245{D\376\350\225\2104\272\017\206G\245Z\374\351\343\352\2044\322\304\265E\026\207\356\021\311&\207\353\361\210\034\272Fu\210\244\213E\325GO%\270\242\302@E5AhU%\274P%eA8u\005\013\023"
+	.string	"\265\025\006\252+a\006+\253+\241O\007\200\210\2501<\203\240tf\b\225\221\222d9 #\221)\316\001\020(\004\231\334\2441\204Z\211H\316\\47>\320j$\374\f\363\364`7\256\303A\340\247\332R\237\352\222\321\270\351\315X_\na@y\365"
+	.string	"\033uB\266Gw\214\257q\201\227\320i\314\262\t\231\255\327\345 \204(\033Ra?jp\305\275\"-\225v\247'\360\032\2602\253\346\233\275\002\206pCE\230\253\222\320n_\026opVp\260\350!\031C\267\027@\361\330\016\021\027\301 \354\263\031\204$\006\013\333|\372\210d\302\216qG\330\323|\212\221\001\3315m\357\002\253\227%%B>7\373\370Y\215\223\211\357^\312\325\021g\326\321\325]\371VM"
+	.ascii	"*S\204F\020^\363d\214\321\b\027%1\240\333q\366\256\314\35338"
+	.ascii	"\020v\203\223b\203\024\345\302\t"
+	.text
+	.section	.gnu.lto_beeper.83.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`\343\001%\022"
+	.string	"\326b}H\3200'\035\300\024r9@\351\262)\355A`\276\316\006f3\207\271\330\242B\371P\331\021\320\231\264s~\241c\337\236\016\335{_ZA\251\2560\232\344%W\353*\266\034{a\226`W\236\036\303\277\367\2466B\310\2262\245l"
+	.string	"d"
+	.string	"f"
+	.string	"\367\\\263\243>\212\230O\321\301&ij\316\031.PMk_\201\237'Wk>\210\316\366\325gv\016\036 \2222\332\321\223\263\363O\2068*\206Fn\214Xb\351j\324\313\240R\242H-\351h\351ldIN\b\307\322\321\350J\224\017M:-\335M\226\274"
+	.ascii	"Q\343\273\353\215\256F\025\\\231sZq\272\234\373\343\2665\330"
+	.ascii	"~`\237*_\240\034L+\274>\366\217~\320SK\251\336U\353\252/\022"
+	.ascii	"3N\341`\3404g\256\212j>yLC\266o\037E\215e\222\224b\177\347\217"
+	.ascii	"7Q\373\211\230\317\032\234\217\334\214 \2519\307\224{n\260\272"
+	.ascii	"\347qeB\224r"
+	.string	"=\222o\364\022\265\037\311\370c\316\036\022,\346\034\r\270\300\352\336\311K\276{\362$_\366K\324\343\344\202HK\240\310\206\f\017\303\267\013 D\210\352e\237\035\253\240\307\355~-xh\326\246\036mwS\320\323\215\334\037_\366\351j\317\016jd\316\313\276\257.\230d\263s\323*\257\324\276\360\242\307}\357\201\347\266\266+\207\030BPk\231\017\\\226\035\r\032\345\341\357\016\242D\004cj\017{\264\351\376\330\001\"\214\013\026\203\265\270\034\300D\230\227hA|\t`\226\0050W\002\005\"\002\025\001\"l&\223~\251\320D\027Qd\tg\261\260%\346\222\205/\332K\2502\3003\027\221\026\302\314f\264\2205\316\257\314\354me\242\340\332\020\"\350q\226ks\316Ih\004[F$jK\230\240\307\371\344\2666\207(\025}G\307g\303\367S\370\344\266\242v.D4  \240\002\031\272\353\002\0259\264\030\021*"
+	.ascii	"\251\201@\264\227\270-\210\306\366\260\365\266@EC\262\233\260"
+	.ascii	"\3277v\261\317\002\207\033\262\223,\032\241A\206\211\270\267"
+	.ascii	"\343\335\263\317\202\374\n\306\223e\274\021\244x\351\363z]\225"
+	.ascii	"%\213\352h\024"
+	.text
+	.section	.gnu.lto_beeperSilence.84.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`\252"
+	.string	"\025\n"
+	.string	"6\021A;0\345(\035\300p\337\364\341\345\215Qtj\276-\205\021\305\020\235\254\023\265\250g\200\032\332>f\001?\312o\332\0061\211LU\026\0064FT\375Cx\263d\360.\265.i{\247\024+"
+	.string	"4"
+	.string	"0"
+	.string	"\035\266\2771h\273\\d\355]*\026\"\262\335\255s\343\340%\350\337\343\003\241\352t\031\320\260\273\226\241\n\343\236\267\215`;\301\276C\346\244LpP`S\332\024\025\362\241\017R\363d\371:\201),dt\002\354\ff\345\214-\236\344\324\260\257\331\271\262\005\300\226,\3060\356^\214"
+	.string	"\226E3\t2\034\365]\037\341 \272\216^\343\264\304B\324\007yHH\344y\364\232\201|\255\300N\242\376\307E\222\317\341\222I>\274\346\233\350\265\016+\006%\307\336<\0377\342\270\207\352u5\242\003\211\352\366\225\252\207\300\336\210\373\252\204\347}u#\356\347J3\266f/\250\231\262\377\241>\311K>\240m\243\327\nX\001\032"
+	.string	"3\001G\320\214/\364\002\260\rd\b\262"
+	.ascii	"\311\201\305 \027\310\027$\007\026\203\254\233\016\231\033\356"
+	.ascii	"\203rs\356\b\224\005`\"\2451\313J.\344i\301\216\227!\300\245"
+	.ascii	"[\264\363\t"
+	.text
+	.section	.gnu.lto_beeperConfirmationBeeps.85.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`\216\002M\024"
+	.string	"\006\345\201I\320\360(\035\262H\007\300\203\376\317\033\237\225\034I\206M\317$\246\331\236D[$\230k}\261\303\023J\035\311?\332\337/\031\211r\305[\201\035\340\001:\345\241o{y1?q\367l\220C6\366P-\032$\242\t!R\246\024g"
+	.string	"m"
+	.string	"k"
+	.ascii	"\027\020\036\374\036 <h\247j(\2526\202\224\330"
+	.string	"\203`\3369{d\034\315I\036p\001\361\240c\266\216\223\271y#\0139D;\346\234\253\375\340\323?\362^\215\375\003Wc\376w?\331n\262\177\"$p\007\277\217\332N\b\324\215\366\251,%\225\337]un5\335\361\206\273~\254\3149\255\266\033\317\035\3366\313\266\003[\313\273D9=f\332d-9\230\204x\230i\030\311\240%\206\336T&\233\224\351\376\330W\311-%y}lU\243F\361d\320\017\356\207nU\365CFt7\030\314\230s\247\211\307D\002K\021'\377\241\253\375\263\370\316 \251\333\220y*\232\310\244\001\331F4\020\017\2466\240\\w\241\330I\363D\331\005\321\005\220N\322\234\323\344\240Y\304\203\252;.\213\r\232.\231\204'\005I\314c\300\030\337\342\272#\212\336\204\205\266+\334\bV\222\233s\252\370E\177Q\343\2038\350\t6z\333A\337&<H \247$\252\f\\W\334\345\341\364"
+	.string	"(O|\367\2614\321\233\253LF\355\312L\231\376\3159\347\232$\\\324\236\bG\351\246C\270'\257\232\335\274\360\033\356q\340\224\270\321&\203\373\255\323\264`Z\017^B\273,\210\320\222\242\200\225\340d\204&\246\306\305r\362\313\311\213%\303b\271\254\\\255UL\253\005f\365\362\232Y\235\f\260K\206\365Z\321\270\\\257\025\b9\237\003\247\333q\027\202\020\322lo|\322\220\273B[\302\214\336f\025me\326rEo6Q8\rX\352\250$\247\244\342\333\037\377[T\243v\003\327\3079p:p\\\177jr]\035\333F\0058 `\0021Cx\033\307"
+	.ascii	"Ei1\0367p\376\230\277\335\0332\276\"\\\016\265`\301\227\256j"
+	.ascii	"1\301n_\375M\"s\305\307d\334C\036\224[]\n\205\215\225~%\202\t"
+	.ascii	"\333v5\030\242\r\345\346\344e\335\354K\261og\241^\333\214K\236"
+	.ascii	"\b\351\231\2033/\372\312\336\361\272J\360~~\353\200_!\264CeK"
+	.ascii	"\b\327\023X\360\032oN;\034\230Y\332eN\204e\311\335\263\313\214"
+	.ascii	"{\251<"
+	.text
+	.section	.gnu.lto_beeperGpsStatus.86.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`\234\003u\031"
+	.string	"\306\256\243G\260ZM:\020fY\374\343q\203)\037\316r\255^\214\030\333\031ma\336\226W\357wPv\354\263y\352\262\325\255\262\323\362s\270E\223M\266\205\362\237\201f\372"
+	.string	"f\242\261s\273\322\251\212\251\2725K\b\331dK\231d\221"
+	.string	"\207"
+	.string	"\216"
+	.ascii	"<\007\377vA\370\357{#\263]\326\316v\243\316C\252o\262\303\326"
+	.ascii	"t\246\326\372j\035+~\362\276\223g\017A\272\372\246\330<\333'"
+	.ascii	"\350=\335p@\017O+:\b\352,\035DR\21719\206\212N\001\004\231\361"
+	.ascii	"\325\354$L\2342\350\210$]\210\f\033\374M\252d\004\245\006\027"
+	.ascii	"4/\364\240\224\276s\3013\234q\021\247\326z!2\214\270\347M\f\037"
+	.ascii	"\267\032\234m6\020#\305\314\227\316B\270\0323\250Sk]\276\341"
+	.ascii	"\206\276\254\357\256\222\335\305\260\333C\001B8\272t\347\376"
+	.ascii	"C\271y\230\276\264`4\313\377\241o\356\333\212j\\\356\236w$?{"
+	.ascii	"\036\253\202\005\377\366o\317\202\376{\023\360RD\343r\231\264"
+	.ascii	"\262\2452\325.\017\210;\267\373s\331M\001\263}\264\353\262iM"
+	.ascii	"\336\325\344\025\2337\274\356\013N^:y\277\346m\346e\346=\001"
+	.ascii	"\0015\264lx\2525F\231\246f\371\310\037\327\375\273\277\t\303"
+	.ascii	"\340Gn\204u\023\305`\367\273\2150av\335\030V \240\223$\037bj"
+	.ascii	"\r\335\203R\262\361M\021\335X\271\3729\032Q\342\n\r\370H]\255"
+	.ascii	"\341\213\001\262\314JvR\nu\261\213\314\367\221\356\356\212C\031"
+	.ascii	"\017 \325Z-\354\237\274\327\003\0331\202\376S\200$\325\352\257"
+	.ascii	"o\253\262\351\353\216C\373H[m\323]&\350F\215\313\255!\307|\367"
+	.ascii	"\277 \237Z\255Cc*\236\265\326:;\267\377\366\232\242H\211}\264"
+	.ascii	"\363#\355\346\035LXv}\316d\fk\255\024\366M_Rb\317\343\337\236"
+	.ascii	"\210\305\350\277n\b^v4.o\024\313"
+	.string	"SA\304\316\004\n0\t9\001|\276=92X\n\030\214\347\025\363y\241\360\3319\361\352\221\251x\345\024\330X\n\230\354\265\"\026\223\275X\274\372>Z\016DYh]\013\367\206w;x\370\322uj\r\264DS\2653`\347\226?W\317O9\030\200m\376\201\356\206\330\341\337\026\247E\003m\213,\267\324\322\304\257X9\200$E\025\201\304\253\214\006\234\020\344\\\354U\037l\261\233\212\255\252EN\321V*\362\003\306\252\2176\354\356C1aypW\207\375!O\234\202\252j\\>J\250A8\304\f2P\221\221\221hd\306 9\240\002\241\232*\017\020hw\223\2441\277M\243\314*\364\007\030\334X\216{:\240\244\206\347\004o\210\324\250\023[\366\345)\231\256\272\365\242\245\243\342\232\264\\\262\323,q\002\210\016\232a\303\037a\r\370\377\377#0|\253\311n[\001\2255\272\2455\203\225\241\313\n8\366l"
+	.ascii	"c\333\216\274\007\3351\353{\232\316\3109\255\t*\300\312`\224"
+	.ascii	"m\3056\030D\b\002*\321\242\001\316yP\332\036\343\347\242\251"
+	.ascii	"\357Z\222ef\307\3728\267\324\260\370\003"
+	.text
+	.section	.gnu.lto_beeperUpdate.87.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`D\007}'"
+	.string	"\312A\254\016H\200\234\326\030?\320\315F\302/H\215\250\223\276L\326\305\313\315=\3406\274\207ICl\\\301\037c\362\217\241%h9\327\030#\342R\304\344$\377\206\352Hf\0317XK4F\0328"
+	.string	"r\227lw\t\221RJ\231RJ\001\326"
+	.string	"\304"
+	.string	"\327"
+	.string	"\252M:\024\333ign\257\376r\033\214E\007\337W\207\327\330\3736s\030A\333*7{\270\266\3326\315\332*\273\314\\\272y\365\266\030\032\223\2221\357\373\026\337\252\335\026\006\201?_\217\267\323\345ZvU\323w\227\373\250\205,\317T\023\217\016\002\257\374\267l_z \215J\213"
+	.ascii	"f2\312{\313\033\316\203&\227\314\244\r\337A\2238\232\231\204"
+	.ascii	"r]\252 J\312\214\206&k\244\3034*-\235Kw\204\270`\322\320\344"
+	.ascii	"S\272\023{\333jg\033`&yxk`\252\311\251\331f&\235`(\231|\245\321"
+	.ascii	"\252NI\243S\237\262Ej\363\276\357N\251\344\237*\360B&\306\247"
+	.ascii	"\\J\2071| \333\331\376B\231\344\316\362\274\357\313\216T65\323"
+	.ascii	"4s\3730s\005\346u\031G\354+#c'_D\256\322\257Z\322\376G\241\367"
+	.ascii	"\333?+3\b o\244\177\004^\331\021h_\305y\031{\025k\177\220\263"
+	.ascii	"M\311\343\330\347\2736\256\314\"\206\274\221\375\r\244\224\376"
+	.ascii	"\210\333\331\033\240\306\340\276\274N\206\271y\344_\305\334\037"
+	.ascii	"\215F\243\374:\230;\254\031\247\301\272oXgb\353<\3249\327\344"
+	.ascii	"\234iZg\341\352\034d\235\201\254\363/u\366\345\234{\2543\257"
+	.ascii	"u\336\351\234u9\347\\\353\334\262\316\354\352\274\252\316j\352"
+	.ascii	"\234\276\363\277\263\277s\347\350\\E\331XF\371\265\346\033#Z"
+	.ascii	"\346\265\242"
+	.string	"6\371\321a\335N\336\r\315v\272\331H\334\016[a\243\324|\225\035\316\316\274\306\274osA\253<\241\355/j\350\276\375\335\367R\220\334\353\276\231\316tZC\335\254\037\256\226\326\332j\356\031\260mu\025\227\253}_\245\007\334e)\334!m\217V\333/\300\006\306\325R\210Wax\317-$S\354\313\356\253\270\335\256\225=k(n\227\021\367\313\375Z[e\237\307\246\005\365\031j2\324t_\3058\277~\220\223\212Y?\177\334#==k\253\353\027x>Aq\276\303\332\006\311\311\260\3728\357jLg\330,\315b\275y\365U%KE\222<\312C- T@\222\254\345\276\212\215\326\364\203\234l\334cMf\304\335\203%\370\250\334>O`\351\204\344Q\366\262h\353o\354\017pf\n\026\274\221\377\016\244\274\314\r\272\006\360]_X\2311d\240q\242\016\235\231\203\007o$\333$}FED\317A\020B"
+	.string	"9x`\334\321\021\232\330`$1\244\341\004\221\361xD!\324c!\235\243\261\204\321\030T,\032*\022\r\001\221(\n\035M\024u"
+	.ascii	"pQ\t\343\261x\242\250\350X\3345\337N_\036\244OJ\337\367}\205"
+	.ascii	"O\376D\006\226`\034\024\034\024\303T\006\337\363\r\250\326D\r"
+	.ascii	"\304\232\027\376\220\346k\276\341h\336\204nh\355\006\346\027"
+	.ascii	"|0?7z\032\371\345\346\203\237\2721\235!\242\345|0]\370\276\n"
+	.ascii	"\370\275\3039\245\343~\017|\326\314RT\022\216\356\342b\005\375"
+	.ascii	">\007\206\344\321-\276\317"
+	.string	"\271\231\301\021\333\300t\351e\255\275O\220e\325\326{\226\313\254\313\211\330$\007\021lH\365\374\202z\3700U\363\354\312qf\327\312]z#\231\203\324sH\216\331Z\025\036\326\312\373\243\263\355\312\b\027\213\333\345Z[\345}\007\200\231\250\201,\007\221CU\"\")H\nRh\fp\002\031\2413z\021\020=\210\030\262\321\246\262\254\001\263O\225\277\217\r}\026\0022@\304\f\312\006r\tO\242}?\314\216\267|\274\316u\317\026\b\217g\220\227\006\033v\202\002\017\245X\243?\246`B5\203\rCaY\245\203r4\332s\304X\210\"`\361\005o\020\026o\226`nh\3370@\366\030\363[\216\350J\r\033\207_\023i\343\256]L\346bu\334\202)tt\353\272\262~f\200\305\237\030|\303\337/\266 \3017y\220\2113RP\301\271\337z\036r\244\333\326\320~\367\3320\301\325\204\026\327\216\223\327*Z"
+	.ascii	"rT\234\367\300M\330Q\361\272_\205!\326\360\203\273\240\364[\277"
+	.ascii	"\237\313\216\250\231l\262.g-\344\36281W)\260\302\222\326\034"
+	.ascii	"5FT\035&\201`\020\304\025i\243\314\2351*H<\002K\322\031\022n"
+	.ascii	"\274\255\251\345\267\310s\025'\354\365\325\301\217p(\263\267"
+	.ascii	"V\036\277\345\341\300h\374\211\342\307\217\332\206Le\235\223"
+	.ascii	"\331T\260q3\305\227\272\213\031Q\025T<\002\244|\360\321\237H"
+	.ascii	"\323\302\021\366\013T+\351\356\031X\r"
+	.text
+	.section	.gnu.lto_beeperProcessCommand.88.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`\304\002\375\023"
+	.string	"6\244}G\340\360&\035\363\003Y7\220Tg\365_|\303c\202\320A\256\200\344O\306W\202?\036\307\007@\b\322\225|\366C\217\201\245\317KU\315\231\003\030$B3\254a\020b\3008\017\330"
+	.string	"\342\024\364\206\326\326,\331\233H\231Rg"
+	.string	"^"
+	.string	"n"
+	.string	"\346V\275\252\326\253/@DE\322\211\2119+\2047&R4\352`\373*\303\3302n\3230\273\rD3A4\346\234\336f8\314;\031\271U\030\377=G}`\314\273\232\313HS\201\024\224\353H\346\234)\260\346\313!\250\265\270\300\002e\270\220$\234\030\357\271\322\2003\325\216d\316i\375@\013\367\351\266[l\033\260\267@\017N\342u\232S&\201o\223"
+	.ascii	"\341\304\363\"\037uQ?2\r\355\373\374\347\305\347\361\nL\377="
+	.ascii	"\3720\371\370\035\240d#\323\320"
+	.string	"z\373\360b\252\r\333\026\243\253c\177\3030\f\2759\366\252A\244\372C\252=:uG\247fE5\207\252W\234Z\265\352\224\252QW\237\244\272\213j\251\352\310i\001\324f`\242\377\272=x#\362s\0273\237!\t@\355\006'\372\317\004f\033\343\325m\204\227\226p\214b8\201U#B\213\230\222n\270\325i\311\023!0f\254n!\316\341\253!\355\352\274\351(Rn\n\220\222\214\326\260/\344\202\342\277\344\243\334\323`\220i\270qO\0031\323\320\273\334~\246\t\350%Z*.\375\347\222\217\273\007\224l\034V\031\211\271Z\\\256\024\017\366\362X^\255\025O%\026\301\033\0211\254\305\025\363\\`\260\230\247\262\315sssL\216\220d;\343\346\234\263\003Y\026\377[2\265 \253G\264\332\254\350c\375\333W(XPR\302\364-yl\267\037\033\207h\265\216\365H\335G\222\265\035\033\231h\0368\226%\344"
+	.ascii	"\205C\265\250]\245V\225\"\265G\261S\304\202\":\355\203vl\002"
+	.ascii	"= \300\002\0211\243\007\263B'I\340\271\256\240\225\032\202\023"
+	.ascii	"\260\032\270\3005OG\216\315\330\221\325\354b\230\035\244\213"
+	.ascii	"\\\303\342\177\327x\206S\205o\242M3\324\200l\300\203+\235\253"
+	.ascii	"\302X\004\351r6\230\023\031\256\332\024j\361\253\200\270A\201"
+	.ascii	"\222po\3271\354\305\257\207\262\030\235\335\255\023\276b\231"
+	.ascii	"]\033\214Q\273\302\302\220$\241\325q$\2775\303\356\ta\2015\035"
+	.ascii	"\347t\210\320|\031\355,\350Q\316%\373o\327\036"
+	.text
+	.section	.gnu.lto_getArmingBeepTimeMicros.89.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375 \367\315\006"
+	.string	"RM04Pm\222\016\26092C(\031\210.\365\341k\212~\214\317\030\007\036\177\261l\355n\207\327\032\270P\263k\200\230\231V\205}&\367iCS\226\307\326\032\3312\005g0\230\265\261\254\204wi\336\202\006A\341e0\206\207\261|m,\3545\\\027\366\252-\353B\350.\037\367\360\005\351\226]\215\0358X\255\323\345P\235\320\005dL|ptU\221\250\362\233\007\235\305W\312\314\334\205~\034\235%\005\345`$3b\264\222'\023\311\306\337\371\352v\324\243s&m\030 JD\004\021\"\312\334\336\245\003T'\251\002T'w\321\254\230\335~T\3420)\321@\236\"\200Af\216\032H\242\273\376\005?\301O\021\007"
+	.ascii	"2\001/8\003Z\034\340]\363\262\020d\270+\246v\222\001"
+	.text
+	.section	.gnu.lto_beeperModeForTableIndex.90.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"\005\f"
+	.string	"\366WTA q\223\016sDb\263kV\231\013\203\0071\037\2411\0028`SQ\210R\016Q@\374\222~#\250\t\r=\024\241\210\235N\335\003"
+	.string	"\fp\244\344\324\270\223R\\\202\335{\340\326\375'{o)S\nA"
+	.string	"?"
+	.string	"D"
+	.string	"\316^w\302Q*6\220\230j\354vU\346\227x\370^ \036j\210g\177\232\231O\245\250\300\020q\332_"
+	.string	"\316\303U"
+	.string	"\267\275\314\356\376\304\263\204\033\311\244 \354\256S\304u\270\341mK\260\375\300~\204v\247\245\222\354\277U\023\333\351\370\322\377\234\326\227NM\2372\360A\306\204\026\273\034N86\006\\A\302\266\210m\261/ \022d\276d\026\006\260;r\221\262\273\n\214\240\343\320\266_\342&D\002&\217\257\234\354n\033\333\030\236\342\372\f\225\335\315\001\212\243Xx\037qh\220\220x\321\241\037\022\017S\277\"\242\024\312\323sw5U\2221\327\020\257\003F(/\266\264\341\247\327\244A\222#\224'[F\2337\002\3564\370p\030l\254\005\032\002\031> \265G\203Y\037\226\325\251.PU\001\304\361\250<\030H\245\301\370\372\260\260\352\302ua\225\305\266\273\275\2328\323\317\242j\211m\325LHG\236;\355)I\243\0360\331\024\036\020"
+	.ascii	"\217I\312Q\323\r\025\026\314\320X\320\273aFl\006\241\032r\022"
+	.ascii	"\023\210k\"{\026\032c\302$\200\312\030\263\235\241DoW)\003"
+	.text
+	.section	.gnu.lto_beeperNameForTableIndex.91.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`\321"
+	.string	"U\f"
+	.string	"F\230WC\020\261$\035c\264\214\205\255QV\020\361\225\251[\354\360\276\333\304\270\030n\234 \302.\031\177\033\"o\037\371\003\267?\007\244\2010\003\257\252\252\306)9\362Z`67 \210\304\211\205\265\330Z#{K\231RF"
+	.string	"@"
+	.string	"D"
+	.string	"\235\017\033\\jpvc\345x\002\324\241\347\002\250C\355p\355OS\363\035`PA3#\005\307\362\347\301i\270\276\217\223\315\005"
+	.string	"\334\366BB\230r^\342\t\303\265dv\036\354\256\363\205\213\271\341mG\260\335\300>\204*c;\r\037\177u:5}\352.\"\316\215\313f7C\247cc\300\026 l\213l\220=\240C\220i\177\346$D\217~\341\317.\351f\305\356\206\370\200\347\320\300\263\355\213\370\b\221\265\002\321\024\023G1\3412h\354n\fN\274&\345\335\303\241+\250P\1779\364U\250C\250\237\231Qv\317\032&N7\252%\203\334\002u\r@\242\201\261e\016\253^\023\207\313\216Qv\006\2216s\354\310\222Z\262\377vw\035&Y`2\242@\304J\020\372X1\271\324%\241\314B\261,\222\n\273*\t\327\310IU\222\245T!\020c(VVQ\300\260\254\002\305\275\3128\323\327\250T\250\2510\332a\301a\244-\357i\311'?a\267a\332\335Dl\257\004\017"
+	.ascii	"\211I\005\253\320&\035@\262\020\003\246\234\270\300\333\214L"
+	.ascii	"UD\342\0021\327\354\233L\020p\"\222jP\246\240\032\227\202\002"
+	.text
+	.section	.gnu.lto_beeperTableEntryCount.92.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375 \330%\006"
+	.string	"bK+4`k\323\001@GJ\356M\324\177AvA\307O\021\341\234!!]\206\300At$Z\326)sw\272@\020<\n*\260\315"
+	.string	""
+	.string	"l\333/2\310Z\333{\247\024\236$*+);qRQ\200\342\004\304\211\016D\211\342YI\032\t\346\2441\322\366/\253\334\033\244Q(x\006\216\026\326}\330\232\345\036\203}\270\273\353\227\331\316\222\301\001\200\261\213\020\002\262\033\317E\204\355jG\376\304)\252\275A\315\001;\304\303\201\205\307\356\306\313'\320\037x\t\364\3475\274\336U\377\025\207\022\035\032\027f\335E6\273kwa\t\367\273\355\214m\214m+\007"
+	.ascii	"2\003&:C\023\002\233k\236\026\202\020w\305\324N2"
+	.text
+	.section	.gnu.lto_beeper.part.0.104.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`\274\005]$"
+	.string	"JAD\016I\200\332Q:)\t \342\303\236\317\024ri~\333 \265\234\003\210F\270\255\263\241d\264\373\213*\2163\177\233g_\315M\177\273\344\216x\320\376\330m#\303t\337\327\231\213\032\352\336\243a\364\265\363'\244\177\333\223F\366\336;\311\317"
+	.string	"\305"
+	.string	"\320"
+	.string	"Azj}\261O\344[\276\027\021\321\264\234\257\264\2249\027\033\034\267\002\364\230\347\004\316\343\373\234\363\270\373B\272{I\330\276n0/\322\310?\262pJB\226s\306\035\333\031\275\363[|\317\252\357\266\032\r\235\235\370\332z\363\365kC\022\267%\250\2353\272\306\\E\2658\355:\360a\242\353M!\213k[\202\206\307\217S\025\275\365\370U\342M\241\324\225"
+	.ascii	"\204F\331\223Luv\t`\211\361\345M\341\324]P\025\226\342\347e\260"
+	.ascii	"\205\007\213\233a\323\315\231r\262\345\313'\330!\224\252\270"
+	.ascii	"\006u\254\370\275<`W\234n\206%.\002\031/\322|\371\3724\004V\373"
+	.ascii	"\344\027h}\005\207+^q~\233\001\345\234\373?\2527\200w7\227\356"
+	.ascii	"\016\352\306E\001J\347\215\367Y\375jY\377x\ff\204i\310\344ZV"
+	.ascii	"-\261\355\255BY\301a\244\255\214\356\333\215o\033\256]\303\265"
+	.ascii	"i\250\255=;_\374\361Y\373\342\332\366\312w=\362}\234\034\bT9"
+	.ascii	"C\265"
+	.string	"Y\223\255\360\223\0347\376\310_y\333\375>\362\312\376\262m\275\324\344J\372\311^\222\204\222\020\242L\304j\350\200\365\034\371&\375\256\260.'Qb6.\240\307:\312\2367\271\261\317d\311dI\022\017\260\230\207\031\264\224C\310,\240\307\357\033\227\372\307\266\365\322\221(\325\235b\216\022\336\350\263\035\353$\351\351~\222\376\221s\371\216D\351\271IH\203\022\303\022\223s\261\347\270'\240\307]D{\351ED\334b\036\nu\002;\234\245\n\231\321\2634ie9\306de\235\226X\3132\263e\253\275\331\247\276\366\026\265O\177\362\231\355q\215\365\255\374\212R?\253\207\322\372`z\036\317\354\315\230\324\230\227\3018#\205O{\344y~\366\264o\252b\252m\004x!\275\232\031\213\027\252\252l\257\372\006\tv1VK#\327\022\033\333k{\\]\200UM[{\355\235\330t{x\330\016g\201\002$g\340\017\030Q"
+	.string	"\036^d\314O\261\266"
+	.string	"\326\326\r)\245~\205\325/\212\022\356\301\356\036\361/\"\t\\r\006F\360:\224\242\373\254\343\346\2018\037<\356\2038\217\253\275T\202*~\265M\177\371\237@~5\355\255\227#G)\326\022\273\273\237t\036y\r\311\337\036W\003\314X\365\003)RN\267\323\031\345\206h\273\247H9\335Ng\224\243\240K\221\206\322\017i\b\001-\004A\227{\360\223:\360\301Iu\274\242\333C>\275\364(M\205p\274\035\316h\227+\302\r\365B\340|\n4\357(\355\341\220x\274\036\316V<\320\3172\025m\226\310|?\314\305$i\330\260\341<>@\343G3\350\354{\371\227 \016\035j\207\3638"
+	.ascii	"\2272=\306\f`I\325\244\216f\376\215.\252\030\265\253$\333+TK"
+	.ascii	"\032e7\243\242\\\320,\261\202\030\226Sr\366'\257\347\315\342"
+	.ascii	"\233\265\331\254\020\327\330\361\265\344\224\315\336x&\331\030"
+	.ascii	"\023\265\304~\240uO\213\265\352\231\277}\332\241\360*\024^\315"
+	.ascii	"l\201~7\347\234g\226\3305K\263=\2560`U\263e\207\236yD\3245\373"
+	.ascii	"3\266\225\273\226u\250a4\303\220S\006\321\210\310L\2306\303\001"
+	.ascii	"`\002\231*\263:\020`G&I\206\003\022\263\352\023\003\310\205e"
+	.ascii	"}\330\243Vq'\300\270\027k\244\275t\\\233x+\271\n\227\004\016"
+	.ascii	"f\206<lP\311\355\002\024z|\322`\0215p\333\374!\020`\020l\032"
+	.ascii	"\372\303\275\252R\2209\361^p\370\277\350\"\255\303\021\016\253"
+	.ascii	"\201\351\212\327\241Y{\250q\002$\n4\374y\001i\272i\214\235\267"
+	.ascii	"\270\256b6@\304\035\371K\367\b\327p\001\216-[z\022\017!\371\322"
+	.ascii	"TQL\330\320\372y\016N\340\031\253\352\023\340\310BU\302\257\311"
+	.ascii	"wg\213\007w\230iWC\264\216a\007\r\337&\303\t\346\223\330\262"
+	.ascii	"\"\206\3439<\241\347\275\346\020:!\3138*\326\226\272X\020[\351"
+	.ascii	"8\206\271y\313\252o\r\035gh@\311\374\252o\241\257\324\245\004"
+	.ascii	"t\017\357\363\365\351\353?o\311`\370\003"
+	.text
+	.section	.gnu.lto_beeperGpsStatus.part.0.105.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`\207"
+	.string	"\335\t"
+	.string	"\266RC; \345*\035"
+	.string	"&L80\021"
+	.string	""
+	.string	"df\352\371\221\0043\216\022I\b\324\272c<\343\3611\306\300\021\025\030\235S8\020"
+	.string	"@h\206g\351\255\377\020q\025\245\337\204{\373\t\221;\2450"
+	.string	"2"
+	.string	"2"
+	.string	"\251\226C\233\366\261c\177\362\201a\362\262\273\363\234r<\274\312-\364/>`\345R]\005\\\257K\316\267\314\302\356Z\223qs\267-\262\255`\177\023\227\241\354Q\215\313juZ>\237]\364\307\016\355c\177tH\024^\206\322\254H\006\305\003\304ew48\347\002\315\271\373b\312\356|1\264\273s\037\261\035\262\273\004\306\236\240\220_\331s\241*oT^,+\001H\215Y\267o\273\273V\230\255\003\241\332.+@m7\270\224\220\317~\373\376\354$~\211;\247\002&%4\214D\b\336\001\210c\272K \320;y\036i~\246\371`\0329\314\022\b1A\004\376N\0368#\276\017\234\235m\371m\025f\006\215\225\n\265\260\252\306lc\002\021"
+	.string	"~Q\241X\321\360 \021\204A"
+	.ascii	"y`\304\\Ba*\317\246\246KU\001u\206\262\231\267\323\002p\355\305"
+	.ascii	"\224\323r\372\265e\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`@\003\215\021"
+	.string	"v\233hI\320\322(\035\310\303\020G\b\n43\321\030\263\302\356>\033\263\302\326W\3152\003 \357\016\006\316\265c\224\001\005\004\341[\341\005W\330#\215R\017\243\224\232!\360\323UU#\305OF\254h\3142\260\327\275\377\307\315\326r\313\024R"
+	.string	"X"
+	.string	"T"
+	.string	"0\261\246%\224>\221W\277\317\325\263\333\355v'}\032\361@\237G\344\021@nC\006\3721b\201\007\311\377\361s\231\020\251\265V\002}\\\034\360!\001\027\222,K\375\266\340,\300a\310\377)\365\373^=\177\377B\256\215\037r<3"
+	.ascii	"\375\035\361\277H+\377cu\325\037\245\325\327\2612\177\021s\027"
+	.ascii	"\026\316\002\246U\201\206\302k\023\256B\302\177\"\304@\250yp"
+	.ascii	"\231\203\247x\221q\231a\235\326\362\331\352-\244\352+$K\277h"
+	.ascii	"\245"
+	.string	"\177C\245o#6\350\327`p\333\202\376\214\250\340G\032\022\\'7D\201\363\201\240/#\345@\0019>A-'\236\264=\023\223\210\233<\261\315\034\341\t\223}\262\247\333\r\361\332\361 '{\340\236\234\370\021\262L\336\332\276\210\204Q\007\325d\016\033u\216xz\254&o(yw$\337\364\303\f}$\233~\022\206\276\322\205>\216\232~\016\232~n\246o\264\001\307\241m|!\201H:Q\306\0017\254PN\325T(\247@\026e\223pYDJ\271\025\345\251\233\224'\350B\331\243M\312\336\267\307\371\224\210\241\350\306\232\226l*\3127\313/\224K`\273:Cr\204\214\240\270\344\333\003\375\330\202L\024S\330$a\022p7\027D\250a\210\343qK\002\231Y\220\324,\214\001\320\002\261\251q\003\021\220\030\351\252\t)LF\013:\327\337)\365jy+\334m\f\235\030\002}j\370\242\313|@K\202\334\264"
+	.ascii	"\211t\233hp\250\273{^\253\362\345>\342\306A\006gu\036\365\211"
+	.ascii	"\001\252\247\324O\bs\275fr\001,\3474\243\313FK\037\235\313q\236"
+	.ascii	"\0367\236'L\0376\355#pOui|\240\353&\216a\337A\026\024\374\271"
+	.ascii	"\233!\245\346@\006}\331\025\373\005\204\032"
+	.text
+	.section	.gnu.lto_.refs.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375 \341-\005"
+	.string	"\202M&(pi\222\016\374\377\377\377\377\377\377\377\377\177N\350!\200\036\241@5\204\326V\244\215f\261\315\376\377\243\375A#mo)So\334\341\306#\274\217!\234\242~\"q\211\007\217\350C\324W\352\243\304\241\364\2179\232\243\343\224\343\316\361\306\361\245\361e\f\220\206\216O\216G\216M\035\025\207\214;\365\220\342V\337\276`v\2243\212\237\361E\342b\f]\250B\023\212\320k\245\0075h\324kA)\205J\320\201>\025\350\244\2222\340\007\343\016\305\033\312\037\276\244\337\360\031v\346\257\b\002"
+	.ascii	"\330U@\r\203p\006"
+	.text
+	.section	.gnu.lto_.decls.e1eead161ea8018c,"e",@progbits
+	.string	"(\265/\375`B-%\312"
+	.ascii	"\032E\271GV JI;\035N\215%\202\231H\267l\346\335M\013\331\254"
+	.ascii	"v\204o\022\204v#\020\020\340\210\313\0028\254\244b"
+	.string	"\316\247\312\301Y<\336\345.\037\226\207\031Jw]\327\265IU\024\327QRRE\3336\255Je\025\207\326\177\327\275.k\343\302\227F\ry\233H\231R\n\355\003O\004\216\004Q\357B\302\354J\202O\304x\033I\373\351\360\215\3034m\270\377E\367\267\360+/\345\317\230):\264\271\277n\345\247\337\205\215;\222\002\f\032N?\f?\324G9\264\303;]\213\r%)\035X\0049{\207\324\003\003\275C\332\377\304\375X\270\357\2540\006{\337\002?\023\007\037S\233\262\367\267\277\211\333\371\264t}\341\3659\233\r\363&+A\221\361\225e\017\007\030\257-\\\266`p@\257\301\377\354\032\207U\244\305\270\002\350X\234\315\357\254\262\205\242#\312l,\347\225\351a>\351\227>\277\222\007:\324\001\375K;\025\327\353_5\340`k\b2\267ws\333\361p{\035\366.\356\347P\036\367\322n\305\361:\230\264\346\365q"
+	.ascii	"\272\245\315\341v\236\324\006\006:O\332>\004\267\263\341\366"
+	.ascii	"4\314\341\fc\020\206{\\\007\336\300w\322w\033\270\343|'\025z"
+	.ascii	"N\272\201\347\2447\276\223v\373\024)3|2\344\250\376\266C\361"
+	.ascii	"(\316\326B\316\023X70n\317\277\376\345;\251\004\236\223:\r?\355"
+	.ascii	"OrR\247\325\232\333\2062v0\255\376\356xN\032]eh\310\221\345\344"
+	.ascii	"\257"
+	.string	"Z\032\346\n-\255IO\215\227)JcLx\360R\22173;\013\326\027,h|\335\022\035^I<~\211\2224\r*E\327\337$+\207kDM\316\312\337v\027\270;X\213a\343\nb\304\351\034\211\027q\250\037q\267v!\376\326\034\326\234\227r\316~6\203\317\255\340rs\263\356\237#\016\304\325<H\341\224qbj\333\313ym\004t\377t\203\350\300\217x\233\263\331\365++A\231\363A\013\303V\304/\347U\003\016\032h\240A\320\307\0223&\341\355\3669\271a\031U\215\034y(#\367%\314\305_\207s\"\355q>${\034\007\317\234\223<n\b&\347\244\241\273\007w\017\367\307\226\227\220\364v\021\356!\354\034J\340F\001\347\2320da\276\374m\021p\267\253\271\231Gm\363\351\231\333r^q\354\2123.D\376z\020_\035j\201\2475\210\016\3322\241\253Y\316\353\220&*\n\307\363o;"
+	.string	"\323\020\273\321z\0034w\3203\270\335\202\324\003\335\202\264\037\337\254\276\223b\317I\327b\272m\207#;\335\177\245\333^\340\201Z\216\304s\200\253g\272\255\004<\253o\267\025\3619\033h\n\272\255\005\037\223\366\0344\340\364\025d\240\2737tw\0010\360\030h\016\272\255\002\274\204\277\300\213\226\240\333N\360QZ\330m\t\360\026\370\n<\013\215\323mg\272}\371+t\373\322\227x\031\022\335_\243\302\223\002\335]A\267w\320\335<=A\367W\351\366\023\237\302\243\320\375't\277\t\037\201\356/\341Gx\021\272\177\304\203\320\375\020\370\007\274\003\272\277\001\317\200\356_@\367\177\360\t\350\376\020\217\200\356\007\321\375?\335\277\301\373t\377\207\356?\300k\320\375\006\350\376\236\f\272\177"
+	.ascii	"\335/\200\356\367\320\375\030t7]w\027\351\356#\335=\327\321\356"
+	.ascii	"\017@\367_\320\335\017\350\376-\335oA\367w\350~\t\272_\247\373"
+	.ascii	"o\272\337\246\373\205\335\037\323\375\301\356\267\335\337\335"
+	.ascii	"\376\327\355]\272\235K\267c\351v)\335\376"
+	.string	"\244\333\235t\273]\267+\351\366#\335\016\327\355o\335\036\355\366\262n\037\353\366\036\335\236\243\333\273\272\235\253\333\263\272}F\267cu\273U\267\277\350v\247n\247\352\366\251n\207\352\366\247nG\352\366f\2673u{R\267\217\240\333C\320\355(\272\375\205n?v\267\227\356N\322\355E\335n\354v\265\273Kt\273Pw\257u{\013\335\276\201n\327@\267\257\320\335R\272\333Iw7\351n&\335m\267\244\273\225t\367\210\356\256\353n\233\300\300\300\300\356 Xw\fN\267\007\243\317\244\251\f\212\2545,\361\3139\t\321F\007\227\2503!x\303\030\261-\025\324R\271\224\23653\205L1\234\304N\177\340\235?\247\323N\2715i\234z\224\305Y\251\266S\301\262\271\265\312\331\202[5X!\362\267S-\274\023\006\005\025\203\203\210\212?\277NY\330\025\366\311\256\260L;O\234\354\223\223e\302L\267\033W\204\334"
+	.ascii	"\304\035\234\2027\244\021m\n\267M\207\332\246\263\371\232\243"
+	.ascii	"\204L7\352\330R\t\272\210v\251\355\222e\302\271\211\035\2227"
+	.ascii	"\006\327}m\231\202O\300v\b\031\2027(!\332\3546\311\2416\351\365"
+	.ascii	"\356M^\342\362\372\032\303\355\257\227n\200#>\240\177 \364\003"
+	.ascii	"\375\357\327\354\024r\351\330\361\227\346\340\021\377\317\037"
+	.ascii	"\f\364\301\370\022\016k\236\332\300\266b%v0\006n\367%iN\035\321"
+	.ascii	"\311\374\375\240\357\367^HX33\207\013\316\211E\fF\265\204\331"
+	.ascii	"\271\222a^\230\346X\024n-Z\276/\315\331\327g\2243[9{$\340A\374"
+	.ascii	"\275\347\353\337\3625@\177\313\367af\316\3145G9\033\f\025\177"
+	.ascii	"~\331\312\252\207\0055%(.\375}\215\205&\347\n\204aR\360\275\375"
+	.ascii	"\355\276\247\241\273e6\320\303\261\343o\007\233\270\357\037\356"
+	.ascii	"\3664O\005\327\034\247D\223z\260\275\247\273\306\255\013 \333"
+	.ascii	"\356\356\260\\3\023.\n\227t\211V\025\227\306 w\316\314\247\023"
+	.ascii	"\247\271F\265\234\315%\255*oF\265\244\232Q-\3467\355\222\244"
+	.ascii	"\234Y\213\211\363S\n7\223r\216>\263\324\314\252\225\363\252\305"
+	.ascii	"\304k\22237W\255'NsIK\312\233\321\354\314K\331\271\241\231\263"
+	.ascii	"T\216j\361y3k9\233\321\247\024N^\222\201\254\211G%\3451\332\326"
+	.ascii	"\302\344\232K\031\212\202\261\245\247\363\256\271>=.gf[\212\354"
+	.ascii	"\3645g\255\234\261\236\036\342\226v0\343\224\356\240b\254\226"
+	.ascii	"V\246_\261P\332z\312\254J\371\256\t\366$J\221s^f\301\001\323"
+	.ascii	"\231k\316YEVbz\316)Vg\316J\317\026\254\236\036E\2053\327\344"
+	.ascii	"\245\244'\245\255'M\n\245\247\212\f\226\345R\315\350\326\363"
+	.ascii	"Gn-\372\225\225V\246\177\345<-'\2162\327\334\334R\323\005N\212"
+	.ascii	"\337_"
+	.string	",6H\230\3045\245\341*oE\346\t#-\251\254J\317S\221\231\262EF[\017\374S\354\b~\312\177\336\343\365O\351u\030\2237\326LJ\357?y(\016\355\272\217\3226T\324\260\310\320\205{\004\336uN\376\256\312\251\307\324\337\276XN\232\370\234\347}\311\260c\362vkW`\\\177\373\225\374\222\257\243\371*\247\251,\177\223`\266\267\365\310\337\f\262\357\244wE\362\323\237\004?\305|l\375\235\340\217\374\334\025\032Q*\314\246\236\232+\254\364X\274\024\027\013\270\037\362tO\344\213\274\221\177{\267\237\341\205\274\334\3079\364\347~\255\237\355\333\346\376\306{Y4'\026\222\006\370s\337\343W\277\263\nB\371\262\367\024\265\367s^\345S\3305.\002LX{y?\367*\324`\354\375\334_\275\r\213\346\214\200\224\346^\316\371\233\250\376\205M\322M\316\\+\336\351\347\276+\314\327;\315}\325\277\360;\033\231"
+	.ascii	"M\032\304<\245A\303(\270\226\001w\005\231\337\226\037Y:0\273"
+	.ascii	"Re7V\206\245\312n\354\354\305\254T\331\001\371"
+	.ascii	" \257\366\321\207~\332\2439\364\327\356\377z\036\355Y\306^\314"
+	.ascii	"K\225\335\330\257/\303\213\375U\331\t\2612\330\325\315m\033\210"
+	.ascii	"\333j\301m\361p[&\270-\035n\373\206_\354?\354}\364\213=\030\315"
+	.ascii	"R~\261\353\036l\334=\004\215\350HJKo[5\334\266\f\267\r\303\036"
+	.ascii	"\370N\032\3439\351\357x\250\274\025Tl\340\307\3619\034\372:\372"
+	.ascii	"B\2379\232\363Zc\223^0!\322\223\016{\322\266O\334\366*\006\032"
+	.ascii	"\026^`\264\374m\353\204\271~\353i8\364k|V\277\325;\3655\323b"
+	.ascii	"\362\365|\030l\226n\362\322V\335\227\363}\215\217\3610\370]["
+	.ascii	"\276[vUvc9g\177\253\221\203\013\276\375Zp\177\024\334\177\207"
+	.ascii	"\037\353e8\264\215\374\214~\030\316\3272Kk\016X=hp\375\2759~"
+	.ascii	"\372\352\b^\325e\341\370;sq\33004r^\276\246n\334.\233<\030`\\"
+	.ascii	"\376\366\355\352\2761\\\033\036\267\204"
+	.string	"\013\t\324_\177\372N\252\023\344\247o\215\231\267:@/.\253%F\222\"I4\356\326\360\007\027\r\025wki\006\315\t\0302\255\254!\214,\256\0257+N\006\316\306\215\275\373\2740\004\321\2325\b\2710\304\321\334p\321\302\311_\035\0271b\\\031\r\340\313\2627f\003\245\306\n'\254\2762\206Ja9\206\\\251\031\273\"\345j\n\326i\262\262\272WhX\254\322\2653\263\244+\0362l=\365\300:J/^\240y\030\036Mj\262pN\027\007\343`.\025\207\247\305\223\323\303\032\2731\374\235\351Q\335\0262^\256\236\200wJ\210\213\215\016\020\353 q:mVOY\026\036\f\341\f\036R\201tX\007\372\364t\241b\240\001J\223\032'SD\244.\213\276Pb5}jw@^/m\022\005\346\357o\323xa\035\261\246\246\273\202\303\223\311\227A\021\271's6\211\t`\327]\341l3T\244\306\316"
+	.ascii	"\261\316\227\n\025\226\251\355R\236\241\343\353\206U\201\336"
+	.ascii	"U\301:7\210L\227\311294G\271\032\r@\300z\206-\254D\225\376\366"
+	.ascii	"\314\030\336 \203x\231~\225\256\022\027\213\231\0323Y<\026\214"
+	.ascii	"\213:\245\277\033\246\2106\214\337\f\275\331\206\341j\232qb\033"
+	.ascii	"\346g\232x\206hL\236a\035hJ\302\373\333\026\320\331Z\220\221"
+	.ascii	"!\343\211\322_\313\366\323\026L\236\224\234\213\2778xD\353\347"
+	.ascii	"\366\357\317K_\026\036\333\202.\216\354\357\360\217h\373\334"
+	.ascii	"v\351bu\267\204\307\001A\340\234\177o\270\210V\213[.\\\254\026"
+	.ascii	"\267\021\305V\313\013\203\360\314\220\005\301\343\022\235\332"
+	.ascii	"\353\262|\321\032,t\253\216\277\026\354\247\355\036\003p\320"
+	.ascii	"\370\361\027\247\006\321Zq\213\005j\261X+\034\224|ak\345\205"
+	.ascii	"O\236a\n\274\0353\242{ySj\177\333V\351\266T\254\236\263\035 "
+	.ascii	"\n\013?\337I\207x?m\363\002\003\213t\375\2651#Z(n\245H\241\""
+	.ascii	"\204\0226y\322&>\275\247\2778<\210\366\316\355\223'L\272\360"
+	.ascii	"\361\faP\3617\345\357\220\b\3212q\353\304IS\346\311\315\027\321"
+	.ascii	".qkg\227C\006NF\b\217]\202\304\212\217\2777eD\213\304\255\022"
+	.ascii	"%c2a2<xj\306\242<\266\374\305IA\264tn\217@\355\021K\307a\310"
+	.ascii	"\023[\272\227y\3013C\2056\003+u+\313\263E\272\255\234\235{%+"
+	.ascii	"~C\376v\233\357\2442e?m\343\240\020\351\333\361w\230\205hgp\013"
+	.ascii	"\007\367$\223B&\363\310hm\2351\377\3360\021\255\233\3337\250"
+	.ascii	"}\263n\216\265\207\255\333c=\236\2303\034=\276D\315\371\200\361"
+	.ascii	"\267m[\267e\363,\316\346SH\264\274\376\006='}\030?m\327.\215"
+	.ascii	"\032\242z\374\275\231B\264P\267Q\250\215Zh\217\033\r\330B\037"
+	.ascii	"\017\341IS\220\321\255Egx\304=\211\375m\213\326m\203\330\325"
+	.ascii	"\331Zx\362=\261\361\327\255|'\315\361\234\324\236\375\264\005"
+	.ascii	"\"\343\366W\003\311\337\r"
+	.string	"\236\223\336\254\021-\231\333\262\262\26332\036\241\026\213&\277\2778Z\210V\314\355\030\324\216Y1\277\311y\013\360\213\006\266b\217\237<1]\370\224PEe\336\312\300\236\376\332\260n\013\346[\234-\351u\265\366\327zN\212cG\264_n{@m\017\373\345kf\316\244]\241\"6^\302\366\353c\300\360\340&\250\276\026\321 \232\322\033\331\337\266^64\246\030\201\362\367[\374\264\335\361g5\2327\376\352@\301\201\303\346\320\321\245\342\317/\270\344B\206\217\034m\344\206\351\235\361\230\202u\262\304\020\203\355\322q\205\251\322\376\236l\264\355\3629)8\314\340\360\316\323VoY\256\377\212a\033\322\264\227\255\260zZ\310\303#B\243-\327\323\020\244\002\245\321l#\327\205\\\031\0231\274\363|\332,\022\3227\277a\225\f8\310\262^\317\352\371\270\363\372\33313\360\206(3f\274\336]\263\224\220\213,\246\t\357"
+	.string	"\201\001\303b-\t.\301U\271\305h\213\365Vq|4^\212\177\221\321\"\203\301\251\037\261\255U;\324Z}\226\013\315L\0335\257*;\277\234\255\2102f,\244"
+	.string	"\373\260M&\266}\361\342\365H\bM\364A\251\n!\215\200\202F\260PB\t\021\020"
+	.string	"\032\021\002\n&"
+	.ascii	"\211P\001\210D\t8A\306\245\022y\034*\032\205<\240 Z\026\025U"
+	.ascii	"\022HP\032q\216#n\224I\365\005cR\210\202%"
+	.string	"\220\322\004\237 \023\035P\026M0a\002\205\233&\372\340S\201\232DZ\026U\0231M\364\301\005\037e\022\251<\252J\013\212\212T\021\352P\216\322\030B\023}H\"\227\305 \243\320\321\250D\362A\0321 R\252I\023\252\nB\352\004\206\216\306c\262\370\001\034%\262H\204Q1\b\013\257z\204\202Q1Hg(\034\006S\242\240#RQH\330\327E\365HUa'P(\324\027\205PQM\006\006qp\030\304\301\033\274CeR\035:\"\213p\002\203\003\030\352\004\225 \202I$\221\322\346\003\310\242\234@\020\035,\212\244\272\\\026AX\032\223A\017\302\216 \244\032%\2137\201\027\f\203\301\3400\030\224\t\006/\b\032%\213J\243Pp\030\034\006\225H%\016\024\241G\330\323#\314Q\"'pb\031\b\002\204U\223HE\306\242\bj\262\370\001\241d\221\b(P(\264\352\021\031B\322\005cQQ\004\020"
+	.ascii	"\002\205:1\313#\022R\304\216Q\361\204\023\252\320\261\004\244"
+	.ascii	"\b\020X\252C\023(\221\311 \243\tCG\243Q\262\250s\264B\332D\037"
+	.ascii	"\206\202\200\216HI\237 \023\001\020A]\026\227J\241qY\204d\004"
+	.ascii	"\2444J\032M\034\221\"&\020:\026\215\214\220\"\224J5\b\231La\250"
+	.ascii	"DZ\026\227$\224G#HpDAY\202\260\310H\242hh\bYbyB=AG\211LA\006"
+	.ascii	"\204\345QM&\221\2026\314\244\033|X&\213G\037j:\310\230T\217\352"
+	.ascii	"\020n\016B\034 \204\007'b\332\203\0176\370`\203\264=\370\340"
+	.ascii	"\347\347\203\020?\270C\374\330\245\n$T\302\t\244\0131K \345\n"
+	.ascii	"X\005R\205\220&\320(\201\220\212\220$\224GC8\037POP\026\211\204"
+	.ascii	"\313\242\352\3022YTI`A\030B\221\312\202\314P\321\204\021)\214"
+	.ascii	"\300EH$\b@A!cQ\361\005\031\345P\261\310DP\005\022Ay4D\243\036"
+	.ascii	"\241(q\302h\"fY$a\204tL\227M\364Ay4\344\2034\352,\213\212V\t"
+	.ascii	"tD\032\227\305 \344\004\224G"
+	.string	"C5\313b\221]\002\201@\300\021Yd\211\212\212lqY\fa\250h\024\023\302\210\023\212\324\027R!U=\"\021\243*\223HH\021BG$dr\210\206\350H\265/\034\251\366\b)Dt\227\302&\372\340sD\032\031!\203:(\215EEF\243T\t\244\032\031K\250\313\242\020\320\314\022(\304\017N\026U\024\227hyD\032\005Q\024\205\2542\211\204$\n*\325%\322\321h\024\243\024:\"\203Te\214jd\\\336\345\004\215<R\223>K$2\3513\223,\022\005]\325\250x\274J \024\311\345q\204Z\344B\261\204*\2044\272(\226\306$\322\230<\302K \017\226G#RL\273\220"
+	.string	"\241b\007!T\016>lh\005(@\004\006+\2340\002\016\372\220T\217T\325\005\037\244\321\347h,\032\371\004%\225>\037$P\203\216*\222\007T%\356u\306\2529\004\210\223\367\022\302\211\235\221&\227\252\216H\230\017&W hy\342\262\223\301\367\243\206\034+\026\322#\252\265\344\263\304l\211\n\343\247\304\377\322*\246/oI^\017\273a\271sB\342l\017\205\311\223\322\221\357\023\256\371\250\322f\3042\271]\331\330\242[\261c\235c*r\241\206yO\256\2479\233\3254\003\313\027\271/\017\314p\232\305Y(\334\fL\037D.\334\224\032@\232\374\355\013w\207\314"
+	.string	"\003U\214'\177\335\316\020\306\213S\333\233\020&\247\035\323\337\276B\002\275\270<\375\265r?}\335\226\250\204\354\270m\226.\352KK\354\262\335\265\032jB\\\374\355\273\326}\303\256\032\b\002\001\273\374\355<\337I\337\352\247o\264\311\221\275 i\027\n$\305C\312\337\276\3206@\035NN\376\376\327O_\264\013\206\030\221[\255\330\fJ\230\230A\200l9\251p] uJ\240|9\263VZ\230\222\212\232\225\241E\265"
+	.string	"\373\333\267\254\373\346\270?@<u\305\360\267\223\370N\352T~\372\222\245c\315/?\306\256\217|W\343\311\337\276>\272-\3367\377)\206U\226\2777\354\247\257\330{\265\325\325\375\255\001\223\241\246OoK\305\225!m.i\201\365\270<n_\024&\227\207\0248-6\276\334\366\232\214\221y\355x\301\204v\365\267\357\216\232\203\304\250b\321@\210\322\224R\306\314\320\210\2144I\032\003\242\n\020\206\302i\034\367\262\033\022@$M\221*\350\214\210\314H\222\324\030\306\246\t"
+	.string	"4Xr^Q`\033TA\223\216dq\314r`\2233\363\023\270\256\340\312\205\321\200\365\324\322\361Pc\253\017jS\005RA\0345\025-0\200\267(\303\rM\323\036\210th\343\271<)\326\033b\256\201\003\207\262\n{\211\352\f\360\017\035\222b\272\303V\357\025\026?\222\323\353\tv\030\224\210\222"
+	.string	"\255"
+	.string	"\354x\362\377\024\344*4\353V\016\262\224M\027|\2039~\001\372\311K\227\263\241\201\351H\302\023\231\220\252\0322\200\205F\311\324\336\245:\243\243\241\251\251\326>\206\232\355\351\225\232:\351/_n\353\3318\342\177\222\217\355\340\026k\210\016\264\241x"
+	.ascii	"\235\347z\312\001\035\025\237 w}e,\227k\230+q\300r\270\201x\232"
+	.ascii	"\260\365\351\326\203}}\204/&\350\027\205\335~\204\020\007\373"
+	.ascii	"!\264\300\311y\353\033\363\204er\212@L\211)(\243\327\322\\\\"
+	.ascii	"w|\201;\236"
+	.string	"\276s>8\346;j\277\004e\370\277Hv\270\204x\263\322\201\373\321~\323\353\320\007\315\313\035\t\371\355\325\212\253\2330X\310\360\252\307\223\f\344\324\255~\022\f\374\253\020o<s\314X\372;\315J\017\230!!\273n\375\220U\305{\026\233\253\213\274W\215\216\331%\026\360\251\207\030\232\323D\2148\300\t\307\264\216.\262\340->>\001\270\022\330\034\244B\035\n\244\310\236D\027\032n@\320\230+\1770\366\247\027\300H.:\270s\313\024\346\226\276\262\327\213\222\025\214|\335wt\364\311\315SU\316{\365\021\211\322\222\216\241X;\374\226\030\307\224c\342\031bIo^\265\033\321N\276q6\236\334\223\273\305\027BY\004\033}r\363\370\225\371L\007\330~:\224r\0060\310\324\344\274\377+\217\305\"2\355\027\304\007\3642\033q\220\261\225}{\273\361\020\237\276\360`>\277\216pS\347\246\350\225\224\"\323\310vp"
+	.ascii	"{)\254%\3122\021J\255xI\252\b<\367\335~\030,\346\376\230Z\261"
+	.ascii	"\343\007\227o\225\316!?\021\330E\372\200#\263L\202V\333a\350"
+	.ascii	"\330\203g\fu\321\f\003\207I\334\213\\V\243J.\262n\0039\341Y%"
+	.ascii	"\0064\373\254\311y\336,\304]\003W\2447\205\254r`\323\275\026"
+	.ascii	"\020\256\031\331n\302\200\020\204S\2349L2\215\374\"\213\017t"
+	.ascii	"}UT\375;\304\233\262\351W\335\275\r\226?q!\330\271jq\333-k\212"
+	.ascii	"Tj\360t\005\333\264\215\365K\370\017\031\236\030\300f\272\252"
+	.ascii	"\203K2\305\351\324\177i\312\212Q\024\214\237}\200\220\023,\312"
+	.ascii	"|\302\2310Q\3502\306N\340\031\222.\3351\036\013\007\264L\306"
+	.ascii	"\344\236\022\207\022\374Z\306\341\007\244v\332\300\305\210k\341"
+	.ascii	"\005[\261M}\370\032\331\321K<\b\313!\2066\302\322\"\253\025\037"
+	.ascii	" \344'vUC\177T\2776\306\320\177b\311\312%4\025\013\031\r\266"
+	.ascii	"nt9\313\342\214\316\244\231\222\306\307\212Q\024v\314\364I\231"
+	.ascii	"D#b<\254\375X\030<>\334\271[\322\302[\b\226Qe\360\233-\330\214"
+	.ascii	"m[\214r \302\031\342v\003\300pF\t\204\2105\240\235\"\b\237\211"
+	.ascii	"u\341\256\200\233\232\204\260\030\0216A3B@\026\312\340\354t\276"
+	.ascii	"\340\316\217\332wsq\032\tMa\3756x\031IS\004\337\020\355\253\242"
+	.ascii	"\251W\241[\220\024\227\237\b\207\321h\036\2254.\b^\236\242\366"
+	.ascii	"\265i*V(\3052\227\257\260\203I\261\311u\276\254\2037K:\347\221"
+	.ascii	"b9l\267\315\250\024\324\201Z\246\320\2254\3730\262N\320A\312"
+	.ascii	"G\215\037\366\310\347\242V\021\325P\030\250\335\307\307\324*"
+	.ascii	"\221\027\027_a\333\366\002r\334\230s\024\177\214\327@JuJ\004"
+	.ascii	"pN\037\232~\2450\"U6i\247\311\r<]T6\317\343"
+	.string	"\316\342\026Cf\353\324\342v\233z\272*\230 t\f\300\225b\314\002\354H\037\332\322\335<~\320\020\214\315R30?\303\211\314\034\315H\"FT\246\326\333\2104\250s9\b\005>U6v\350\210\210\354*5%Ts\302i\375\250\310\311\263\267\346\371(+\270\235\rw%\217S\026\025\240\354\213\367\245\230\b\017\210\346\211\307V\020\265\3327$\017\036W\305lE\002l\261}\300\372\327\230`\020Q\320\306o\240\020\360\350\332N\001\261\026\236sk\0052\364]\t\351\210\200y8\270\261\344\271\241\345B?\020\237\326IP\002\037\005P\340_=\004\300wS#\342\035@\204\323\336\003#sP\301\bMi\236\201 ,\243\n\253\262\270\337\021\276\027\242\004\366Oq\"\236\217\214Ex;l/\240\315`\023%\375H\0139n\364\020\2466\234\243\300n\260\276|v\374l\324&j\3771\315Y\246\036\357\\\370\277]\216"
+	.string	"\201\311\277\360|\220\200\263QD@M8\022\017\261t\3123\235=\320v\004\342\224\345,#\226H\241\217\005\266\3542\3423\275>ss\366\013\345l\200\f\354>xa\237\243o"
+	.ascii	"\352\023\237\313r7hY\210\251\t\344!\236\320\366\236H2\262\230"
+	.ascii	"`\033\022\026\322p\227\373o\fR\274P\275\347)\241"
+	.string	"\214Q\t\013#\213&\243\017\342D)Xu\013X\\7L\313\n\177\205a"
+	.string	"\004\217e\341M\331\377\334\344\305\021\2627.f\317\2602\013[#\305\006\337\314\301\335\251r\332u\226J\311\242\246]0\017\224\251\304\277\337\377\303\316\022X\031a\256\264:\265\265~\013\fA3>\004\303\361\326\266\230\201\264R\354\035S\035\030\224\256\323`\2130\355\242?seL/\323\032\247\244\335]Z\307\353y\220\304\\6\250\304\277;\335\200\364\312@\342\302\267\371\270\004\214&\256\177n\306\0300\207\237V#8\362\031\200\205\215\030\034&m*\366\f\236\031\034"
+	.ascii	"\240\271@\272\314\357\017\313\217\221\332\254\341\220P\036%["
+	.ascii	"'Ow0\037L\332\277\376B~\277\335$\273\310t\030\357\211\222\006"
+	.ascii	"a\322\007\202\343c3\231\036\003\036y\013\311\023^\313\343wy\020"
+	.ascii	"]\306\333 \357\016\206\232\204\311\2270N\306\377<z\234\275\257"
+	.ascii	"a7\267\330\3126t\377Y\357aw4w\t8T\204C\317\317\256\352nn\247"
+	.ascii	"&\343\335c^D\232\030\321\327\266\3754\341\330\372{\354\262\234"
+	.ascii	"=mw'\270\361\363t\330a'7MB\216#[\305\373\f]a\246F\335\240\374"
+	.ascii	"/\340\316t\257y?\254\231\3749M\324\177ctt\344\027\3546O\233\n"
+	.ascii	"x\346\332\216\335j\277\016'\342\377H\377O<\177\313\242Z\362\217"
+	.ascii	"ru\365\275\"\375!\234y\335\205\351\275r\365\206\201#\254\203"
+	.ascii	"\246\031\020\247\227\270\251\361@\373\177\343\021\262\007<\236"
+	.ascii	"q\353X\374\251\333\003\360\362#j\005c\377\025\263]\327\024~\301"
+	.ascii	"_\365\303\223\032\357 \257t\030\321\322\005\030\016\332\334="
+	.ascii	"i]\332N\305\364\356\006\312^\0057gpj\307\307\004\337\013\\N-"
+	.ascii	"\2541Nje:\352p"
+	.text
+	.section	.gnu.lto_.symtab.e1eead161ea8018c,"e",@progbits
+	.string	"beeperTable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\001"
+	.string	""
+	.string	"beeperSilence"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\001"
+	.string	""
+	.string	"beeper"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\001"
+	.string	""
+	.string	"beeperConfirmationBeeps"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\222\001"
+	.string	""
+	.string	"beeperGpsStatus"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\001"
+	.string	""
+	.string	"beeperUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\234\001"
+	.string	""
+	.string	"getArmingBeepTimeMicros"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"beeperModeForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\001"
+	.string	""
+	.string	"beeperNameForTableIndex"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"beeperTableEntryCount"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\001"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\001"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\230\001"
+	.string	""
+	.string	"warningLedRefresh"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\002"
+	.string	""
+	.string	"warningLedDisable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\002"
+	.string	""
+	.string	"getBatteryCellCount"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\002"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\016\002"
+	.string	""
+	.string	"getBeeperOffMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\020\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\024\002"
+	.string	""
+	.string	"warningLedEnable"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\026\002"
+	.string	""
+	.string	"isHardwareHealthy"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\002"
+	.string	""
+	.string	"IS_RC_MODE_ACTIVE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\035\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.e1eead161ea8018c,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
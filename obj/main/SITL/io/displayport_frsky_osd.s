@@ -0,0 +1,11834 @@
+	.file	"displayport_frsky_osd.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/drivers/display.h"
+	.file 5 "./src/main/drivers/osd.h"
+	.file 6 "./src/main/drivers/display_canvas.h"
+	.file 7 "./src/main/drivers/display_font_metadata.h"
+	.file 8 "./src/main/io/frsky_osd.h"
+	.file 9 "./src/main/io/displayport_frsky_osd.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	displayport_frsky_osd.c.b52db5eb
+	.weak	displayport_frsky_osd.c.b52db5eb
+displayport_frsky_osd.c.b52db5eb:
+	.long	0x196a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1a
+	.long	.LASF1217
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1004
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1005
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1006
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1007
+	.uleb128 0xa
+	.long	.LASF1009
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1008
+	.uleb128 0xa
+	.long	.LASF1010
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x10
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1011
+	.uleb128 0xa
+	.long	.LASF1012
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xa
+	.long	.LASF1013
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x10
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1014
+	.uleb128 0x1c
+	.byte	0x8
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1015
+	.uleb128 0x13
+	.long	0x8c
+	.uleb128 0xa
+	.long	.LASF1016
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0xa
+	.long	.LASF1017
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xa
+	.long	.LASF1018
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0xa
+	.long	.LASF1019
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0xa
+	.long	.LASF1020
+	.byte	0x4
+	.byte	0x19
+	.byte	0x1f
+	.long	0xd9
+	.uleb128 0x13
+	.long	0xc8
+	.uleb128 0x14
+	.long	.LASF1028
+	.byte	0x40
+	.byte	0x5
+	.byte	0x3c
+	.long	0xf3
+	.uleb128 0x3
+	.long	.LASF1030
+	.byte	0x5
+	.byte	0x3d
+	.byte	0xd
+	.long	0x9c0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1021
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x118
+	.uleb128 0x8
+	.long	.LASF1022
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1023
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF1024
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1025
+	.byte	0x4
+	.byte	0x25
+	.byte	0x3
+	.long	0xfa
+	.uleb128 0xa
+	.long	.LASF1026
+	.byte	0x4
+	.byte	0x2b
+	.byte	0x11
+	.long	0xa4
+	.uleb128 0xa
+	.long	.LASF1027
+	.byte	0x4
+	.byte	0x41
+	.byte	0x20
+	.long	0x13c
+	.uleb128 0x14
+	.long	.LASF1029
+	.byte	0x18
+	.byte	0x6
+	.byte	0x37
+	.long	0x197
+	.uleb128 0x3
+	.long	.LASF1031
+	.byte	0x6
+	.byte	0x38
+	.byte	0x22
+	.long	0x79f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1032
+	.byte	0x6
+	.byte	0x39
+	.byte	0xb
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1033
+	.byte	0x6
+	.byte	0x3a
+	.byte	0xe
+	.long	0xb0
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1034
+	.byte	0x6
+	.byte	0x3b
+	.byte	0xe
+	.long	0xb0
+	.byte	0x12
+	.uleb128 0x3
+	.long	.LASF1035
+	.byte	0x6
+	.byte	0x3c
+	.byte	0xd
+	.long	0xa4
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1036
+	.byte	0x6
+	.byte	0x3d
+	.byte	0xd
+	.long	0xa4
+	.byte	0x15
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1037
+	.byte	0x4
+	.byte	0x42
+	.byte	0x26
+	.long	0x1a3
+	.uleb128 0x14
+	.long	.LASF1038
+	.byte	0x4
+	.byte	0x7
+	.byte	0x8
+	.long	0x1ca
+	.uleb128 0x3
+	.long	.LASF1039
+	.byte	0x7
+	.byte	0x9
+	.byte	0xd
+	.long	0xa4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1040
+	.byte	0x7
+	.byte	0xa
+	.byte	0xe
+	.long	0xb0
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1041
+	.byte	0x4
+	.byte	0x43
+	.byte	0x24
+	.long	0x1db
+	.uleb128 0x13
+	.long	0x1ca
+	.uleb128 0x14
+	.long	.LASF1042
+	.byte	0x98
+	.byte	0x4
+	.byte	0x56
+	.long	0x2df
+	.uleb128 0x3
+	.long	.LASF1043
+	.byte	0x4
+	.byte	0x57
+	.byte	0xb
+	.long	0x3b2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1044
+	.byte	0x4
+	.byte	0x58
+	.byte	0xb
+	.long	0x3b2
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1045
+	.byte	0x4
+	.byte	0x59
+	.byte	0xb
+	.long	0x3b2
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1046
+	.byte	0x4
+	.byte	0x5a
+	.byte	0xb
+	.long	0x3b2
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1047
+	.byte	0x4
+	.byte	0x5b
+	.byte	0xb
+	.long	0x3cb
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1048
+	.byte	0x4
+	.byte	0x5c
+	.byte	0xb
+	.long	0x3f8
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1049
+	.byte	0x4
+	.byte	0x5d
+	.byte	0xb
+	.long	0x420
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1050
+	.byte	0x4
+	.byte	0x5e
+	.byte	0xb
+	.long	0x452
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1051
+	.byte	0x4
+	.byte	0x5f
+	.byte	0xb
+	.long	0x466
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1052
+	.byte	0x4
+	.byte	0x60
+	.byte	0xb
+	.long	0x3b2
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF1053
+	.byte	0x4
+	.byte	0x61
+	.byte	0xc
+	.long	0x476
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF1054
+	.byte	0x4
+	.byte	0x62
+	.byte	0x10
+	.long	0x48a
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF1055
+	.byte	0x4
+	.byte	0x63
+	.byte	0x18
+	.long	0x49e
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF1056
+	.byte	0x4
+	.byte	0x64
+	.byte	0xb
+	.long	0x4bc
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF1057
+	.byte	0x4
+	.byte	0x65
+	.byte	0xb
+	.long	0x4df
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF1058
+	.byte	0x4
+	.byte	0x66
+	.byte	0xb
+	.long	0x4f3
+	.byte	0x78
+	.uleb128 0x3
+	.long	.LASF1059
+	.byte	0x4
+	.byte	0x67
+	.byte	0xc
+	.long	0x508
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF1060
+	.byte	0x4
+	.byte	0x68
+	.byte	0xc
+	.long	0x476
+	.byte	0x88
+	.uleb128 0x3
+	.long	.LASF1061
+	.byte	0x4
+	.byte	0x69
+	.byte	0xb
+	.long	0x526
+	.byte	0x90
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1062
+	.byte	0x20
+	.byte	0x4
+	.byte	0x45
+	.long	0x388
+	.uleb128 0x3
+	.long	.LASF1031
+	.byte	0x4
+	.byte	0x46
+	.byte	0x20
+	.long	0x388
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1032
+	.byte	0x4
+	.byte	0x47
+	.byte	0xb
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1063
+	.byte	0x4
+	.byte	0x48
+	.byte	0xd
+	.long	0xa4
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1064
+	.byte	0x4
+	.byte	0x49
+	.byte	0xd
+	.long	0xa4
+	.byte	0x11
+	.uleb128 0x3
+	.long	.LASF1065
+	.byte	0x4
+	.byte	0x4a
+	.byte	0xd
+	.long	0xa4
+	.byte	0x12
+	.uleb128 0x3
+	.long	.LASF1066
+	.byte	0x4
+	.byte	0x4b
+	.byte	0xd
+	.long	0xa4
+	.byte	0x13
+	.uleb128 0x3
+	.long	.LASF1067
+	.byte	0x4
+	.byte	0x4e
+	.byte	0x9
+	.long	0xf3
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1068
+	.byte	0x4
+	.byte	0x4f
+	.byte	0x9
+	.long	0xf3
+	.byte	0x15
+	.uleb128 0x3
+	.long	.LASF1069
+	.byte	0x4
+	.byte	0x50
+	.byte	0xc
+	.long	0x98
+	.byte	0x16
+	.uleb128 0x3
+	.long	.LASF1070
+	.byte	0x4
+	.byte	0x51
+	.byte	0xc
+	.long	0x98
+	.byte	0x17
+	.uleb128 0x3
+	.long	.LASF1071
+	.byte	0x4
+	.byte	0x52
+	.byte	0x16
+	.long	0x124
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1072
+	.byte	0x4
+	.byte	0x53
+	.byte	0xe
+	.long	0xb0
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x4
+	.long	0x1d6
+	.uleb128 0xa
+	.long	.LASF1073
+	.byte	0x4
+	.byte	0x54
+	.byte	0x3
+	.long	0x2df
+	.uleb128 0x13
+	.long	0x38d
+	.uleb128 0xe
+	.long	0x70
+	.long	0x3ad
+	.uleb128 0x1
+	.long	0x3ad
+	.byte	0
+	.uleb128 0x4
+	.long	0x38d
+	.uleb128 0x4
+	.long	0x39e
+	.uleb128 0xe
+	.long	0x70
+	.long	0x3c6
+	.uleb128 0x1
+	.long	0x3c6
+	.byte	0
+	.uleb128 0x4
+	.long	0x399
+	.uleb128 0x4
+	.long	0x3b7
+	.uleb128 0xe
+	.long	0x70
+	.long	0x3f3
+	.uleb128 0x1
+	.long	0x3ad
+	.uleb128 0x1
+	.long	0xa4
+	.uleb128 0x1
+	.long	0xa4
+	.uleb128 0x1
+	.long	0x3f3
+	.uleb128 0x1
+	.long	0x124
+	.byte	0
+	.uleb128 0x4
+	.long	0x93
+	.uleb128 0x4
+	.long	0x3d0
+	.uleb128 0xe
+	.long	0x70
+	.long	0x420
+	.uleb128 0x1
+	.long	0x3ad
+	.uleb128 0x1
+	.long	0xa4
+	.uleb128 0x1
+	.long	0xa4
+	.uleb128 0x1
+	.long	0xb0
+	.uleb128 0x1
+	.long	0x124
+	.byte	0
+	.uleb128 0x4
+	.long	0x3fd
+	.uleb128 0xe
+	.long	0xf3
+	.long	0x448
+	.uleb128 0x1
+	.long	0x3ad
+	.uleb128 0x1
+	.long	0xa4
+	.uleb128 0x1
+	.long	0xa4
+	.uleb128 0x1
+	.long	0x448
+	.uleb128 0x1
+	.long	0x44d
+	.byte	0
+	.uleb128 0x4
+	.long	0xb0
+	.uleb128 0x4
+	.long	0x124
+	.uleb128 0x4
+	.long	0x425
+	.uleb128 0xe
+	.long	0xf3
+	.long	0x466
+	.uleb128 0x1
+	.long	0x3c6
+	.byte	0
+	.uleb128 0x4
+	.long	0x457
+	.uleb128 0xb
+	.long	0x476
+	.uleb128 0x1
+	.long	0x3ad
+	.byte	0
+	.uleb128 0x4
+	.long	0x46b
+	.uleb128 0xe
+	.long	0xbc
+	.long	0x48a
+	.uleb128 0x1
+	.long	0x3c6
+	.byte	0
+	.uleb128 0x4
+	.long	0x47b
+	.uleb128 0xe
+	.long	0x124
+	.long	0x49e
+	.uleb128 0x1
+	.long	0x3c6
+	.byte	0
+	.uleb128 0x4
+	.long	0x48f
+	.uleb128 0xe
+	.long	0xf3
+	.long	0x4b7
+	.uleb128 0x1
+	.long	0x4b7
+	.uleb128 0x1
+	.long	0x3c6
+	.byte	0
+	.uleb128 0x4
+	.long	0x197
+	.uleb128 0x4
+	.long	0x4a3
+	.uleb128 0xe
+	.long	0x70
+	.long	0x4da
+	.uleb128 0x1
+	.long	0x3ad
+	.uleb128 0x1
+	.long	0xb0
+	.uleb128 0x1
+	.long	0x4da
+	.byte	0
+	.uleb128 0x4
+	.long	0xd4
+	.uleb128 0x4
+	.long	0x4c1
+	.uleb128 0xe
+	.long	0xf3
+	.long	0x4f3
+	.uleb128 0x1
+	.long	0x3ad
+	.byte	0
+	.uleb128 0x4
+	.long	0x4e4
+	.uleb128 0xb
+	.long	0x508
+	.uleb128 0x1
+	.long	0x3ad
+	.uleb128 0x1
+	.long	0x118
+	.byte	0
+	.uleb128 0x4
+	.long	0x4f8
+	.uleb128 0xe
+	.long	0xf3
+	.long	0x521
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x3c6
+	.byte	0
+	.uleb128 0x4
+	.long	0x130
+	.uleb128 0x4
+	.long	0x50d
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x6
+	.byte	0x20
+	.long	0x549
+	.uleb128 0x8
+	.long	.LASF1074
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF1075
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF1076
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1077
+	.byte	0x6
+	.byte	0x24
+	.byte	0x3
+	.long	0x52b
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x6
+	.byte	0x26
+	.long	0x579
+	.uleb128 0x8
+	.long	.LASF1078
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1079
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF1080
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF1081
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1082
+	.byte	0x6
+	.byte	0x2b
+	.byte	0x3
+	.long	0x555
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x6
+	.byte	0x2d
+	.long	0x5af
+	.uleb128 0x8
+	.long	.LASF1083
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1084
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF1085
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF1086
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF1087
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1088
+	.byte	0x6
+	.byte	0x33
+	.byte	0x3
+	.long	0x585
+	.uleb128 0xa
+	.long	.LASF1089
+	.byte	0x6
+	.byte	0x35
+	.byte	0x26
+	.long	0x5cc
+	.uleb128 0x13
+	.long	0x5bb
+	.uleb128 0x1d
+	.long	.LASF1090
+	.value	0x118
+	.byte	0x6
+	.byte	0x40
+	.byte	0x10
+	.long	0x79f
+	.uleb128 0x3
+	.long	.LASF1091
+	.byte	0x6
+	.byte	0x41
+	.byte	0xc
+	.long	0x7b4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1092
+	.byte	0x6
+	.byte	0x42
+	.byte	0xc
+	.long	0x7b4
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1093
+	.byte	0x6
+	.byte	0x43
+	.byte	0xc
+	.long	0x7b4
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1094
+	.byte	0x6
+	.byte	0x44
+	.byte	0xc
+	.long	0x7c9
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1095
+	.byte	0x6
+	.byte	0x45
+	.byte	0xc
+	.long	0x7e8
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1096
+	.byte	0x6
+	.byte	0x46
+	.byte	0xc
+	.long	0x802
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1097
+	.byte	0x6
+	.byte	0x47
+	.byte	0xc
+	.long	0x802
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1098
+	.byte	0x6
+	.byte	0x48
+	.byte	0xc
+	.long	0x817
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1099
+	.byte	0x6
+	.byte	0x49
+	.byte	0xc
+	.long	0x82c
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1100
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xc
+	.long	0x7b4
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF1101
+	.byte	0x6
+	.byte	0x4c
+	.byte	0xc
+	.long	0x850
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF1102
+	.byte	0x6
+	.byte	0x4d
+	.byte	0xc
+	.long	0x850
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF1103
+	.byte	0x6
+	.byte	0x4e
+	.byte	0xc
+	.long	0x860
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF1104
+	.byte	0x6
+	.byte	0x4f
+	.byte	0xc
+	.long	0x884
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF1105
+	.byte	0x6
+	.byte	0x50
+	.byte	0xc
+	.long	0x8ad
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF1106
+	.byte	0x6
+	.byte	0x51
+	.byte	0xc
+	.long	0x8d1
+	.byte	0x78
+	.uleb128 0x3
+	.long	.LASF1107
+	.byte	0x6
+	.byte	0x52
+	.byte	0xc
+	.long	0x8fa
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF1108
+	.byte	0x6
+	.byte	0x53
+	.byte	0xc
+	.long	0x802
+	.byte	0x88
+	.uleb128 0x3
+	.long	.LASF1109
+	.byte	0x6
+	.byte	0x54
+	.byte	0xc
+	.long	0x802
+	.byte	0x90
+	.uleb128 0x3
+	.long	.LASF1110
+	.byte	0x6
+	.byte	0x55
+	.byte	0xc
+	.long	0x928
+	.byte	0x98
+	.uleb128 0x3
+	.long	.LASF1111
+	.byte	0x6
+	.byte	0x56
+	.byte	0xc
+	.long	0x928
+	.byte	0xa0
+	.uleb128 0x3
+	.long	.LASF1112
+	.byte	0x6
+	.byte	0x57
+	.byte	0xc
+	.long	0x928
+	.byte	0xa8
+	.uleb128 0x3
+	.long	.LASF1113
+	.byte	0x6
+	.byte	0x58
+	.byte	0xc
+	.long	0x850
+	.byte	0xb0
+	.uleb128 0x3
+	.long	.LASF1114
+	.byte	0x6
+	.byte	0x59
+	.byte	0xc
+	.long	0x850
+	.byte	0xb8
+	.uleb128 0x3
+	.long	.LASF1115
+	.byte	0x6
+	.byte	0x5a
+	.byte	0xc
+	.long	0x850
+	.byte	0xc0
+	.uleb128 0x3
+	.long	.LASF1116
+	.byte	0x6
+	.byte	0x5b
+	.byte	0xc
+	.long	0x850
+	.byte	0xc8
+	.uleb128 0x3
+	.long	.LASF1117
+	.byte	0x6
+	.byte	0x5c
+	.byte	0xc
+	.long	0x850
+	.byte	0xd0
+	.uleb128 0x3
+	.long	.LASF1118
+	.byte	0x6
+	.byte	0x5d
+	.byte	0xc
+	.long	0x850
+	.byte	0xd8
+	.uleb128 0x3
+	.long	.LASF1119
+	.byte	0x6
+	.byte	0x5f
+	.byte	0xc
+	.long	0x860
+	.byte	0xe0
+	.uleb128 0x3
+	.long	.LASF1120
+	.byte	0x6
+	.byte	0x60
+	.byte	0xc
+	.long	0x95d
+	.byte	0xe8
+	.uleb128 0x3
+	.long	.LASF1121
+	.byte	0x6
+	.byte	0x61
+	.byte	0xc
+	.long	0x977
+	.byte	0xf0
+	.uleb128 0x3
+	.long	.LASF1122
+	.byte	0x6
+	.byte	0x62
+	.byte	0xc
+	.long	0x977
+	.byte	0xf8
+	.uleb128 0x17
+	.long	.LASF1123
+	.byte	0x63
+	.long	0x98c
+	.value	0x100
+	.uleb128 0x17
+	.long	.LASF1124
+	.byte	0x65
+	.long	0x860
+	.value	0x108
+	.uleb128 0x17
+	.long	.LASF1125
+	.byte	0x66
+	.long	0x860
+	.value	0x110
+	.byte	0
+	.uleb128 0x4
+	.long	0x5c7
+	.uleb128 0xb
+	.long	0x7b4
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x579
+	.byte	0
+	.uleb128 0x4
+	.long	0x7a4
+	.uleb128 0xb
+	.long	0x7c9
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0xf3
+	.byte	0
+	.uleb128 0x4
+	.long	0x7b9
+	.uleb128 0xb
+	.long	0x7e8
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x579
+	.byte	0
+	.uleb128 0x4
+	.long	0x7ce
+	.uleb128 0xb
+	.long	0x802
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	0x7ed
+	.uleb128 0xb
+	.long	0x817
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x30
+	.byte	0
+	.uleb128 0x4
+	.long	0x807
+	.uleb128 0xb
+	.long	0x82c
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x5af
+	.byte	0
+	.uleb128 0x4
+	.long	0x81c
+	.uleb128 0xb
+	.long	0x850
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	0x831
+	.uleb128 0xb
+	.long	0x860
+	.uleb128 0x1
+	.long	0x521
+	.byte	0
+	.uleb128 0x4
+	.long	0x855
+	.uleb128 0xb
+	.long	0x884
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0xb0
+	.uleb128 0x1
+	.long	0x549
+	.byte	0
+	.uleb128 0x4
+	.long	0x865
+	.uleb128 0xb
+	.long	0x8ad
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0xb0
+	.uleb128 0x1
+	.long	0x579
+	.uleb128 0x1
+	.long	0x549
+	.byte	0
+	.uleb128 0x4
+	.long	0x889
+	.uleb128 0xb
+	.long	0x8d1
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x3f3
+	.uleb128 0x1
+	.long	0x549
+	.byte	0
+	.uleb128 0x4
+	.long	0x8b2
+	.uleb128 0xb
+	.long	0x8fa
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x3f3
+	.uleb128 0x1
+	.long	0x579
+	.uleb128 0x1
+	.long	0x549
+	.byte	0
+	.uleb128 0x4
+	.long	0x8d6
+	.uleb128 0xb
+	.long	0x928
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x4
+	.long	0x8ff
+	.uleb128 0xb
+	.long	0x956
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x956
+	.uleb128 0x1
+	.long	0x956
+	.uleb128 0x1
+	.long	0x956
+	.uleb128 0x1
+	.long	0x956
+	.uleb128 0x1
+	.long	0x956
+	.uleb128 0x1
+	.long	0x956
+	.byte	0
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1126
+	.uleb128 0x4
+	.long	0x92d
+	.uleb128 0xb
+	.long	0x977
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x956
+	.uleb128 0x1
+	.long	0x956
+	.byte	0
+	.uleb128 0x4
+	.long	0x962
+	.uleb128 0xb
+	.long	0x98c
+	.uleb128 0x1
+	.long	0x521
+	.uleb128 0x1
+	.long	0x956
+	.byte	0
+	.uleb128 0x4
+	.long	0x97c
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x5
+	.byte	0x2d
+	.long	0x9af
+	.uleb128 0x8
+	.long	.LASF1127
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1128
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF1129
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1130
+	.byte	0x5
+	.byte	0x31
+	.byte	0x3
+	.long	0x991
+	.uleb128 0x13
+	.long	0x9af
+	.uleb128 0x1e
+	.long	0xa4
+	.long	0x9d0
+	.uleb128 0x1f
+	.long	0x37
+	.byte	0x3f
+	.byte	0
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x8
+	.byte	0x9
+	.long	0x9e8
+	.uleb128 0x8
+	.long	.LASF1131
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF1132
+	.byte	0x2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1133
+	.byte	0x8
+	.byte	0xc
+	.byte	0x3
+	.long	0x9d0
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x8
+	.byte	0xe
+	.long	0xa18
+	.uleb128 0x8
+	.long	.LASF1134
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1135
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF1136
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF1137
+	.byte	0x3
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1138
+	.byte	0x8
+	.byte	0x13
+	.byte	0x3
+	.long	0x9f4
+	.uleb128 0x11
+	.long	0x30
+	.byte	0x8
+	.byte	0x15
+	.long	0xa4e
+	.uleb128 0x8
+	.long	.LASF1139
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1140
+	.byte	0x1
+	.uleb128 0x8
+	.long	.LASF1141
+	.byte	0x2
+	.uleb128 0x8
+	.long	.LASF1142
+	.byte	0x4
+	.uleb128 0x8
+	.long	.LASF1143
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF1144
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x3
+	.long	0xa24
+	.uleb128 0x18
+	.long	.LASF1145
+	.byte	0x22
+	.byte	0x16
+	.long	0x38d
+	.uleb128 0x19
+	.long	.LASF1146
+	.value	0x1c0
+	.byte	0x24
+	.long	0x5c7
+	.uleb128 0x19
+	.long	.LASF1147
+	.value	0x1f3
+	.byte	0x22
+	.long	0x1d6
+	.uleb128 0x12
+	.long	.LASF1148
+	.byte	0x2f
+	.uleb128 0x12
+	.long	.LASF1149
+	.byte	0x1f
+	.uleb128 0x7
+	.long	.LASF1150
+	.byte	0x8
+	.byte	0x2c
+	.long	0xaa9
+	.uleb128 0x1
+	.long	0x30
+	.uleb128 0x1
+	.long	0x30
+	.uleb128 0x1
+	.long	0x3f3
+	.uleb128 0x1
+	.long	0x124
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1151
+	.byte	0x8
+	.byte	0x2d
+	.long	0xac9
+	.uleb128 0x1
+	.long	0x30
+	.uleb128 0x1
+	.long	0x30
+	.uleb128 0x1
+	.long	0xb0
+	.uleb128 0x1
+	.long	0x124
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1152
+	.byte	0x8
+	.byte	0x2e
+	.long	0xf3
+	.long	0xaed
+	.uleb128 0x1
+	.long	0x30
+	.uleb128 0x1
+	.long	0x30
+	.uleb128 0x1
+	.long	0x448
+	.uleb128 0x1
+	.long	0x44d
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1153
+	.byte	0x7
+	.byte	0x19
+	.long	0xf3
+	.long	0xb07
+	.uleb128 0x1
+	.long	0x4b7
+	.uleb128 0x1
+	.long	0x4da
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1154
+	.byte	0x8
+	.byte	0x23
+	.long	0xf3
+	.long	0xb21
+	.uleb128 0x1
+	.long	0x30
+	.uleb128 0x1
+	.long	0xb21
+	.byte	0
+	.uleb128 0x4
+	.long	0xc8
+	.uleb128 0x15
+	.long	.LASF1155
+	.byte	0x8
+	.byte	0x24
+	.long	0xf3
+	.long	0xb40
+	.uleb128 0x1
+	.long	0x30
+	.uleb128 0x1
+	.long	0x4da
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1156
+	.byte	0x27
+	.byte	0xa
+	.long	0x30
+	.uleb128 0x16
+	.long	.LASF1157
+	.byte	0x26
+	.byte	0xa
+	.long	0x30
+	.uleb128 0x16
+	.long	.LASF1158
+	.byte	0x1e
+	.byte	0x5
+	.long	0xf3
+	.uleb128 0x7
+	.long	.LASF1159
+	.byte	0x8
+	.byte	0x20
+	.long	0xb72
+	.uleb128 0x1
+	.long	0x9e8
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1160
+	.byte	0x21
+	.uleb128 0x7
+	.long	.LASF1161
+	.byte	0x8
+	.byte	0x31
+	.long	0xb89
+	.uleb128 0x1
+	.long	0xa18
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1162
+	.byte	0x8
+	.byte	0x32
+	.long	0xb9a
+	.uleb128 0x1
+	.long	0xa18
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1163
+	.byte	0x8
+	.byte	0x33
+	.long	0xbab
+	.uleb128 0x1
+	.long	0xa18
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1164
+	.byte	0x8
+	.byte	0x34
+	.long	0xbbc
+	.uleb128 0x1
+	.long	0xf3
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1165
+	.byte	0x8
+	.byte	0x35
+	.long	0xbd7
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0xa18
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1166
+	.byte	0x8
+	.byte	0x36
+	.long	0xbed
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1167
+	.byte	0x8
+	.byte	0x37
+	.long	0xc03
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1168
+	.byte	0x8
+	.byte	0x38
+	.long	0xc14
+	.uleb128 0x1
+	.long	0x30
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1169
+	.byte	0x8
+	.byte	0x39
+	.long	0xc25
+	.uleb128 0x1
+	.long	0xa4e
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1170
+	.byte	0x8
+	.byte	0x3a
+	.long	0xc36
+	.uleb128 0x1
+	.long	0xa18
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1171
+	.byte	0x8
+	.byte	0x3c
+	.long	0xc56
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1172
+	.byte	0x8
+	.byte	0x3d
+	.long	0xc76
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1173
+	.byte	0x3e
+	.uleb128 0x7
+	.long	.LASF1174
+	.byte	0x8
+	.byte	0x3f
+	.long	0xc9c
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0xb0
+	.uleb128 0x1
+	.long	0xa4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1175
+	.byte	0x8
+	.byte	0x40
+	.long	0xcc1
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0xb0
+	.uleb128 0x1
+	.long	0xa18
+	.uleb128 0x1
+	.long	0xa4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1176
+	.byte	0x8
+	.byte	0x41
+	.long	0xce1
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x3f3
+	.uleb128 0x1
+	.long	0xa4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1177
+	.byte	0x8
+	.byte	0x42
+	.long	0xd06
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x3f3
+	.uleb128 0x1
+	.long	0xa18
+	.uleb128 0x1
+	.long	0xa4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1178
+	.byte	0x8
+	.byte	0x43
+	.long	0xd1c
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1179
+	.byte	0x8
+	.byte	0x44
+	.long	0xd32
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1180
+	.byte	0x8
+	.byte	0x45
+	.long	0xd5c
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1181
+	.byte	0x8
+	.byte	0x46
+	.long	0xd86
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1182
+	.byte	0x8
+	.byte	0x47
+	.long	0xdb0
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1183
+	.byte	0x8
+	.byte	0x48
+	.long	0xdd0
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1184
+	.byte	0x8
+	.byte	0x49
+	.long	0xdf0
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1185
+	.byte	0x8
+	.byte	0x4a
+	.long	0xe10
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1186
+	.byte	0x8
+	.byte	0x4b
+	.long	0xe30
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1187
+	.byte	0x8
+	.byte	0x4c
+	.long	0xe50
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1188
+	.byte	0x8
+	.byte	0x4d
+	.long	0xe70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.uleb128 0x1
+	.long	0x70
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1189
+	.byte	0x4f
+	.uleb128 0x7
+	.long	.LASF1190
+	.byte	0x8
+	.byte	0x50
+	.long	0xea0
+	.uleb128 0x1
+	.long	0x956
+	.uleb128 0x1
+	.long	0x956
+	.uleb128 0x1
+	.long	0x956
+	.uleb128 0x1
+	.long	0x956
+	.uleb128 0x1
+	.long	0x956
+	.uleb128 0x1
+	.long	0x956
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1191
+	.byte	0x8
+	.byte	0x51
+	.long	0xeb6
+	.uleb128 0x1
+	.long	0x956
+	.uleb128 0x1
+	.long	0x956
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1192
+	.byte	0x8
+	.byte	0x52
+	.long	0xecc
+	.uleb128 0x1
+	.long	0x956
+	.uleb128 0x1
+	.long	0x956
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1193
+	.byte	0x8
+	.byte	0x53
+	.long	0xedd
+	.uleb128 0x1
+	.long	0x956
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1194
+	.byte	0x55
+	.uleb128 0x12
+	.long	.LASF1195
+	.byte	0x56
+	.uleb128 0x16
+	.long	.LASF1196
+	.byte	0x2a
+	.byte	0xa
+	.long	0x30
+	.uleb128 0x16
+	.long	.LASF1197
+	.byte	0x29
+	.byte	0xa
+	.long	0x30
+	.uleb128 0x7
+	.long	.LASF1198
+	.byte	0x4
+	.byte	0x8b
+	.long	0xf15
+	.uleb128 0x1
+	.long	0x3ad
+	.uleb128 0x1
+	.long	0x388
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF1199
+	.byte	0x8
+	.byte	0x1d
+	.long	0xf3
+	.long	0xf2a
+	.uleb128 0x1
+	.long	0x9af
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1200
+	.byte	0x9
+	.value	0x209
+	.byte	0x10
+	.long	0x3ad
+	.long	0xf48
+	.uleb128 0x6
+	.long	.LASF1201
+	.value	0x209
+	.byte	0x3c
+	.long	0x9bb
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1061
+	.byte	0x9
+	.value	0x1e9
+	.byte	0xc
+	.long	0xf3
+	.long	0xf72
+	.uleb128 0x6
+	.long	.LASF1202
+	.value	0x1e9
+	.byte	0x27
+	.long	0x521
+	.uleb128 0x6
+	.long	.LASF1203
+	.value	0x1e9
+	.byte	0x44
+	.long	0x3c6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1125
+	.value	0x1b8
+	.long	0xf8a
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x1b8
+	.byte	0x29
+	.long	0x521
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1124
+	.value	0x1b1
+	.long	0xfa2
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x1b1
+	.byte	0x2a
+	.long	0x521
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1123
+	.value	0x1aa
+	.long	0xfc4
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x1aa
+	.byte	0x28
+	.long	0x521
+	.uleb128 0x2
+	.string	"r"
+	.value	0x1aa
+	.byte	0x3d
+	.long	0x956
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1122
+	.value	0x1a3
+	.long	0xff2
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x1a3
+	.byte	0x27
+	.long	0x521
+	.uleb128 0x2
+	.string	"sx"
+	.value	0x1a3
+	.byte	0x3c
+	.long	0x956
+	.uleb128 0x2
+	.string	"sy"
+	.value	0x1a3
+	.byte	0x46
+	.long	0x956
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1121
+	.value	0x19c
+	.long	0x1020
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x19c
+	.byte	0x2b
+	.long	0x521
+	.uleb128 0x2
+	.string	"tx"
+	.value	0x19c
+	.byte	0x40
+	.long	0x956
+	.uleb128 0x2
+	.string	"ty"
+	.value	0x19c
+	.byte	0x4a
+	.long	0x956
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1120
+	.value	0x195
+	.long	0x1080
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x195
+	.byte	0x25
+	.long	0x521
+	.uleb128 0x2
+	.string	"m11"
+	.value	0x195
+	.byte	0x3a
+	.long	0x956
+	.uleb128 0x2
+	.string	"m12"
+	.value	0x195
+	.byte	0x45
+	.long	0x956
+	.uleb128 0x2
+	.string	"m21"
+	.value	0x195
+	.byte	0x50
+	.long	0x956
+	.uleb128 0x2
+	.string	"m22"
+	.value	0x195
+	.byte	0x5b
+	.long	0x956
+	.uleb128 0x2
+	.string	"m31"
+	.value	0x195
+	.byte	0x66
+	.long	0x956
+	.uleb128 0x2
+	.string	"m32"
+	.value	0x195
+	.byte	0x71
+	.long	0x956
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1119
+	.value	0x18e
+	.long	0x1098
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x18e
+	.byte	0x27
+	.long	0x521
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1118
+	.value	0x187
+	.long	0x10d8
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x187
+	.byte	0x36
+	.long	0x521
+	.uleb128 0x2
+	.string	"x"
+	.value	0x187
+	.byte	0x49
+	.long	0x70
+	.uleb128 0x2
+	.string	"y"
+	.value	0x187
+	.byte	0x50
+	.long	0x70
+	.uleb128 0x2
+	.string	"w"
+	.value	0x187
+	.byte	0x57
+	.long	0x70
+	.uleb128 0x2
+	.string	"h"
+	.value	0x187
+	.byte	0x5e
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1117
+	.value	0x180
+	.long	0x1118
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x180
+	.byte	0x30
+	.long	0x521
+	.uleb128 0x2
+	.string	"x"
+	.value	0x180
+	.byte	0x43
+	.long	0x70
+	.uleb128 0x2
+	.string	"y"
+	.value	0x180
+	.byte	0x4a
+	.long	0x70
+	.uleb128 0x2
+	.string	"w"
+	.value	0x180
+	.byte	0x51
+	.long	0x70
+	.uleb128 0x2
+	.string	"h"
+	.value	0x180
+	.byte	0x58
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1116
+	.value	0x179
+	.long	0x1158
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x179
+	.byte	0x32
+	.long	0x521
+	.uleb128 0x2
+	.string	"x"
+	.value	0x179
+	.byte	0x45
+	.long	0x70
+	.uleb128 0x2
+	.string	"y"
+	.value	0x179
+	.byte	0x4c
+	.long	0x70
+	.uleb128 0x2
+	.string	"w"
+	.value	0x179
+	.byte	0x53
+	.long	0x70
+	.uleb128 0x2
+	.string	"h"
+	.value	0x179
+	.byte	0x5a
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1115
+	.value	0x172
+	.long	0x1198
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x172
+	.byte	0x2d
+	.long	0x521
+	.uleb128 0x2
+	.string	"x"
+	.value	0x172
+	.byte	0x40
+	.long	0x70
+	.uleb128 0x2
+	.string	"y"
+	.value	0x172
+	.byte	0x47
+	.long	0x70
+	.uleb128 0x2
+	.string	"w"
+	.value	0x172
+	.byte	0x4e
+	.long	0x70
+	.uleb128 0x2
+	.string	"h"
+	.value	0x172
+	.byte	0x55
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1114
+	.value	0x16b
+	.long	0x11d8
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x16b
+	.byte	0x27
+	.long	0x521
+	.uleb128 0x2
+	.string	"x"
+	.value	0x16b
+	.byte	0x3a
+	.long	0x70
+	.uleb128 0x2
+	.string	"y"
+	.value	0x16b
+	.byte	0x41
+	.long	0x70
+	.uleb128 0x2
+	.string	"w"
+	.value	0x16b
+	.byte	0x48
+	.long	0x70
+	.uleb128 0x2
+	.string	"h"
+	.value	0x16b
+	.byte	0x4f
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1113
+	.value	0x164
+	.long	0x1218
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x164
+	.byte	0x29
+	.long	0x521
+	.uleb128 0x2
+	.string	"x"
+	.value	0x164
+	.byte	0x3c
+	.long	0x70
+	.uleb128 0x2
+	.string	"y"
+	.value	0x164
+	.byte	0x43
+	.long	0x70
+	.uleb128 0x2
+	.string	"w"
+	.value	0x164
+	.byte	0x4a
+	.long	0x70
+	.uleb128 0x2
+	.string	"h"
+	.value	0x164
+	.byte	0x51
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1112
+	.value	0x15d
+	.long	0x1272
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x15d
+	.byte	0x31
+	.long	0x521
+	.uleb128 0x2
+	.string	"x1"
+	.value	0x15d
+	.byte	0x44
+	.long	0x70
+	.uleb128 0x2
+	.string	"y1"
+	.value	0x15d
+	.byte	0x4c
+	.long	0x70
+	.uleb128 0x2
+	.string	"x2"
+	.value	0x15d
+	.byte	0x54
+	.long	0x70
+	.uleb128 0x2
+	.string	"y2"
+	.value	0x15d
+	.byte	0x5c
+	.long	0x70
+	.uleb128 0x2
+	.string	"x3"
+	.value	0x15d
+	.byte	0x64
+	.long	0x70
+	.uleb128 0x2
+	.string	"y3"
+	.value	0x15d
+	.byte	0x6c
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1111
+	.value	0x156
+	.long	0x12cc
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x156
+	.byte	0x2b
+	.long	0x521
+	.uleb128 0x2
+	.string	"x1"
+	.value	0x156
+	.byte	0x3e
+	.long	0x70
+	.uleb128 0x2
+	.string	"y1"
+	.value	0x156
+	.byte	0x46
+	.long	0x70
+	.uleb128 0x2
+	.string	"x2"
+	.value	0x156
+	.byte	0x4e
+	.long	0x70
+	.uleb128 0x2
+	.string	"y2"
+	.value	0x156
+	.byte	0x56
+	.long	0x70
+	.uleb128 0x2
+	.string	"x3"
+	.value	0x156
+	.byte	0x5e
+	.long	0x70
+	.uleb128 0x2
+	.string	"y3"
+	.value	0x156
+	.byte	0x66
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1110
+	.value	0x14f
+	.long	0x1326
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x14f
+	.byte	0x2d
+	.long	0x521
+	.uleb128 0x2
+	.string	"x1"
+	.value	0x14f
+	.byte	0x40
+	.long	0x70
+	.uleb128 0x2
+	.string	"y1"
+	.value	0x14f
+	.byte	0x48
+	.long	0x70
+	.uleb128 0x2
+	.string	"x2"
+	.value	0x14f
+	.byte	0x50
+	.long	0x70
+	.uleb128 0x2
+	.string	"y2"
+	.value	0x14f
+	.byte	0x58
+	.long	0x70
+	.uleb128 0x2
+	.string	"x3"
+	.value	0x14f
+	.byte	0x60
+	.long	0x70
+	.uleb128 0x2
+	.string	"y3"
+	.value	0x14f
+	.byte	0x68
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1109
+	.value	0x148
+	.long	0x1352
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x148
+	.byte	0x30
+	.long	0x521
+	.uleb128 0x2
+	.string	"x"
+	.value	0x148
+	.byte	0x43
+	.long	0x70
+	.uleb128 0x2
+	.string	"y"
+	.value	0x148
+	.byte	0x4a
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1108
+	.value	0x141
+	.long	0x137e
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x141
+	.byte	0x2a
+	.long	0x521
+	.uleb128 0x2
+	.string	"x"
+	.value	0x141
+	.byte	0x3d
+	.long	0x70
+	.uleb128 0x2
+	.string	"y"
+	.value	0x141
+	.byte	0x44
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1107
+	.value	0x13a
+	.long	0x13cc
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x13a
+	.byte	0x2d
+	.long	0x521
+	.uleb128 0x2
+	.string	"x"
+	.value	0x13a
+	.byte	0x40
+	.long	0x70
+	.uleb128 0x2
+	.string	"y"
+	.value	0x13a
+	.byte	0x47
+	.long	0x70
+	.uleb128 0x2
+	.string	"s"
+	.value	0x13a
+	.byte	0x56
+	.long	0x3f3
+	.uleb128 0x6
+	.long	.LASF1205
+	.value	0x13a
+	.byte	0x6e
+	.long	0x579
+	.uleb128 0x6
+	.long	.LASF1206
+	.value	0x13a
+	.byte	0x91
+	.long	0x549
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1106
+	.value	0x133
+	.long	0x140e
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x133
+	.byte	0x29
+	.long	0x521
+	.uleb128 0x2
+	.string	"x"
+	.value	0x133
+	.byte	0x3c
+	.long	0x70
+	.uleb128 0x2
+	.string	"y"
+	.value	0x133
+	.byte	0x43
+	.long	0x70
+	.uleb128 0x2
+	.string	"s"
+	.value	0x133
+	.byte	0x52
+	.long	0x3f3
+	.uleb128 0x6
+	.long	.LASF1206
+	.value	0x133
+	.byte	0x71
+	.long	0x549
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1105
+	.value	0x12c
+	.long	0x145e
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x12c
+	.byte	0x30
+	.long	0x521
+	.uleb128 0x2
+	.string	"x"
+	.value	0x12c
+	.byte	0x43
+	.long	0x70
+	.uleb128 0x2
+	.string	"y"
+	.value	0x12c
+	.byte	0x4a
+	.long	0x70
+	.uleb128 0x2
+	.string	"chr"
+	.value	0x12c
+	.byte	0x56
+	.long	0xb0
+	.uleb128 0x6
+	.long	.LASF1205
+	.value	0x12c
+	.byte	0x70
+	.long	0x579
+	.uleb128 0x6
+	.long	.LASF1206
+	.value	0x12c
+	.byte	0x93
+	.long	0x549
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1104
+	.value	0x125
+	.long	0x14a2
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x125
+	.byte	0x2c
+	.long	0x521
+	.uleb128 0x2
+	.string	"x"
+	.value	0x125
+	.byte	0x3f
+	.long	0x70
+	.uleb128 0x2
+	.string	"y"
+	.value	0x125
+	.byte	0x46
+	.long	0x70
+	.uleb128 0x2
+	.string	"chr"
+	.value	0x125
+	.byte	0x52
+	.long	0xb0
+	.uleb128 0x6
+	.long	.LASF1206
+	.value	0x125
+	.byte	0x73
+	.long	0x549
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1103
+	.value	0x11e
+	.long	0x14ba
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x11e
+	.byte	0x30
+	.long	0x521
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1102
+	.value	0x117
+	.long	0x14fa
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x117
+	.byte	0x28
+	.long	0x521
+	.uleb128 0x2
+	.string	"x"
+	.value	0x117
+	.byte	0x3b
+	.long	0x70
+	.uleb128 0x2
+	.string	"y"
+	.value	0x117
+	.byte	0x42
+	.long	0x70
+	.uleb128 0x2
+	.string	"w"
+	.value	0x117
+	.byte	0x49
+	.long	0x70
+	.uleb128 0x2
+	.string	"h"
+	.value	0x117
+	.byte	0x50
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1101
+	.value	0x110
+	.long	0x153a
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x110
+	.byte	0x29
+	.long	0x521
+	.uleb128 0x2
+	.string	"x"
+	.value	0x110
+	.byte	0x3c
+	.long	0x70
+	.uleb128 0x2
+	.string	"y"
+	.value	0x110
+	.byte	0x43
+	.long	0x70
+	.uleb128 0x2
+	.string	"w"
+	.value	0x110
+	.byte	0x4a
+	.long	0x70
+	.uleb128 0x2
+	.string	"h"
+	.value	0x110
+	.byte	0x51
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1100
+	.value	0x109
+	.long	0x155e
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x109
+	.byte	0x32
+	.long	0x521
+	.uleb128 0x6
+	.long	.LASF1207
+	.value	0x109
+	.byte	0x56
+	.long	0x579
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1099
+	.value	0x102
+	.long	0x1582
+	.uleb128 0x6
+	.long	.LASF1204
+	.value	0x102
+	.byte	0x31
+	.long	0x521
+	.uleb128 0x6
+	.long	.LASF1208
+	.value	0x102
+	.byte	0x5b
+	.long	0x5af
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1098
+	.byte	0xfb
+	.long	0x15a1
+	.uleb128 0x5
+	.long	.LASF1204
+	.byte	0xfb
+	.byte	0x2d
+	.long	0x521
+	.uleb128 0xc
+	.string	"w"
+	.byte	0xfb
+	.byte	0x45
+	.long	0x30
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1097
+	.byte	0xf4
+	.long	0x15c9
+	.uleb128 0x5
+	.long	.LASF1204
+	.byte	0xf4
+	.byte	0x32
+	.long	0x521
+	.uleb128 0xc
+	.string	"x"
+	.byte	0xf4
+	.byte	0x45
+	.long	0x70
+	.uleb128 0xc
+	.string	"y"
+	.byte	0xf4
+	.byte	0x4c
+	.long	0x70
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1096
+	.byte	0xed
+	.long	0x15f1
+	.uleb128 0x5
+	.long	.LASF1204
+	.byte	0xed
+	.byte	0x34
+	.long	0x521
+	.uleb128 0xc
+	.string	"x"
+	.byte	0xed
+	.byte	0x47
+	.long	0x70
+	.uleb128 0xc
+	.string	"y"
+	.byte	0xed
+	.byte	0x4e
+	.long	0x70
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1095
+	.byte	0xe6
+	.long	0x1624
+	.uleb128 0x5
+	.long	.LASF1204
+	.byte	0xe6
+	.byte	0x27
+	.long	0x521
+	.uleb128 0xc
+	.string	"x"
+	.byte	0xe6
+	.byte	0x3a
+	.long	0x70
+	.uleb128 0xc
+	.string	"y"
+	.byte	0xe6
+	.byte	0x41
+	.long	0x70
+	.uleb128 0x5
+	.long	.LASF1205
+	.byte	0xe6
+	.byte	0x59
+	.long	0x579
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1094
+	.byte	0xdf
+	.long	0x1645
+	.uleb128 0x5
+	.long	.LASF1204
+	.byte	0xdf
+	.byte	0x30
+	.long	0x521
+	.uleb128 0x5
+	.long	.LASF1209
+	.byte	0xdf
+	.byte	0x43
+	.long	0xf3
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1093
+	.byte	0xd8
+	.long	0x1666
+	.uleb128 0x5
+	.long	.LASF1204
+	.byte	0xd8
+	.byte	0x34
+	.long	0x521
+	.uleb128 0x5
+	.long	.LASF1205
+	.byte	0xd8
+	.byte	0x58
+	.long	0x579
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1092
+	.byte	0xd1
+	.long	0x1687
+	.uleb128 0x5
+	.long	.LASF1204
+	.byte	0xd1
+	.byte	0x2b
+	.long	0x521
+	.uleb128 0x5
+	.long	.LASF1205
+	.byte	0xd1
+	.byte	0x4f
+	.long	0x579
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1091
+	.byte	0xca
+	.long	0x16a8
+	.uleb128 0x5
+	.long	.LASF1204
+	.byte	0xca
+	.byte	0x2d
+	.long	0x521
+	.uleb128 0x5
+	.long	.LASF1205
+	.byte	0xca
+	.byte	0x51
+	.long	0x579
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1210
+	.byte	0xba
+	.byte	0x18
+	.long	0xa18
+	.long	0x16c3
+	.uleb128 0x5
+	.long	.LASF1205
+	.byte	0xba
+	.byte	0x3e
+	.long	0x579
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1060
+	.byte	0xb3
+	.long	0x16d9
+	.uleb128 0x5
+	.long	.LASF1203
+	.byte	0xb3
+	.byte	0x2e
+	.long	0x3ad
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1059
+	.byte	0xa4
+	.long	0x1705
+	.uleb128 0x5
+	.long	.LASF1203
+	.byte	0xa4
+	.byte	0x2d
+	.long	0x3ad
+	.uleb128 0x5
+	.long	.LASF1206
+	.byte	0xa4
+	.byte	0x52
+	.long	0x118
+	.uleb128 0x18
+	.long	.LASF1211
+	.byte	0xa8
+	.byte	0x22
+	.long	0x9e8
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1058
+	.byte	0x9b
+	.byte	0xc
+	.long	0xf3
+	.long	0x1720
+	.uleb128 0x5
+	.long	.LASF1203
+	.byte	0x9b
+	.byte	0x23
+	.long	0x3ad
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1057
+	.byte	0x93
+	.byte	0xc
+	.long	0x70
+	.long	0x1751
+	.uleb128 0x5
+	.long	.LASF1203
+	.byte	0x93
+	.byte	0x2e
+	.long	0x3ad
+	.uleb128 0x5
+	.long	.LASF1212
+	.byte	0x93
+	.byte	0x41
+	.long	0xb0
+	.uleb128 0xc
+	.string	"chr"
+	.byte	0x93
+	.byte	0x5d
+	.long	0x4da
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1056
+	.byte	0x87
+	.byte	0xc
+	.long	0xf3
+	.long	0x1783
+	.uleb128 0x5
+	.long	.LASF1213
+	.byte	0x87
+	.byte	0x33
+	.long	0x4b7
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x87
+	.byte	0x52
+	.long	0x3c6
+	.uleb128 0x22
+	.string	"chr"
+	.byte	0x9
+	.byte	0x8b
+	.byte	0x14
+	.long	0xc8
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1055
+	.byte	0x7d
+	.byte	0x19
+	.long	0x124
+	.long	0x17a9
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x7d
+	.byte	0x46
+	.long	0x3c6
+	.uleb128 0x18
+	.long	.LASF1215
+	.byte	0x81
+	.byte	0x16
+	.long	0x124
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1054
+	.byte	0x77
+	.byte	0x11
+	.long	0xbc
+	.long	0x17c4
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x77
+	.byte	0x32
+	.long	0x3c6
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1052
+	.byte	0x71
+	.byte	0xc
+	.long	0x70
+	.long	0x17df
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x71
+	.byte	0x25
+	.long	0x3ad
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1053
+	.byte	0x68
+	.long	0x17f5
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x68
+	.byte	0x23
+	.long	0x3ad
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF1216
+	.byte	0x62
+	.long	0x180b
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x62
+	.byte	0x2b
+	.long	0x3ad
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1051
+	.byte	0x5c
+	.byte	0xc
+	.long	0xf3
+	.long	0x1826
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x5c
+	.byte	0x36
+	.long	0x3c6
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1050
+	.byte	0x55
+	.byte	0xc
+	.long	0xf3
+	.long	0x1867
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x55
+	.byte	0x24
+	.long	0x3ad
+	.uleb128 0xc
+	.string	"x"
+	.byte	0x55
+	.byte	0x39
+	.long	0xa4
+	.uleb128 0xc
+	.string	"y"
+	.byte	0x55
+	.byte	0x44
+	.long	0xa4
+	.uleb128 0xc
+	.string	"c"
+	.byte	0x55
+	.byte	0x51
+	.long	0x448
+	.uleb128 0x5
+	.long	.LASF1215
+	.byte	0x55
+	.byte	0x66
+	.long	0x44d
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1049
+	.byte	0x4d
+	.byte	0xc
+	.long	0x70
+	.long	0x18a8
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x4d
+	.byte	0x25
+	.long	0x3ad
+	.uleb128 0xc
+	.string	"x"
+	.byte	0x4d
+	.byte	0x3a
+	.long	0xa4
+	.uleb128 0xc
+	.string	"y"
+	.byte	0x4d
+	.byte	0x45
+	.long	0xa4
+	.uleb128 0xc
+	.string	"c"
+	.byte	0x4d
+	.byte	0x51
+	.long	0xb0
+	.uleb128 0x5
+	.long	.LASF1215
+	.byte	0x4d
+	.byte	0x65
+	.long	0x124
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1048
+	.byte	0x45
+	.byte	0xc
+	.long	0x70
+	.long	0x18e9
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x45
+	.byte	0x27
+	.long	0x3ad
+	.uleb128 0xc
+	.string	"x"
+	.byte	0x45
+	.byte	0x3c
+	.long	0xa4
+	.uleb128 0xc
+	.string	"y"
+	.byte	0x45
+	.byte	0x47
+	.long	0xa4
+	.uleb128 0xc
+	.string	"s"
+	.byte	0x45
+	.byte	0x56
+	.long	0x3f3
+	.uleb128 0x5
+	.long	.LASF1215
+	.byte	0x45
+	.byte	0x6a
+	.long	0x124
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1047
+	.byte	0x3f
+	.byte	0xc
+	.long	0x70
+	.long	0x1904
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x3f
+	.byte	0x2c
+	.long	0x3c6
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1046
+	.byte	0x37
+	.byte	0xc
+	.long	0x70
+	.long	0x191f
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x37
+	.byte	0x26
+	.long	0x3ad
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1045
+	.byte	0x30
+	.byte	0xc
+	.long	0x70
+	.long	0x193a
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x30
+	.byte	0x27
+	.long	0x3ad
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1044
+	.byte	0x2a
+	.byte	0xc
+	.long	0x70
+	.long	0x1955
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x2a
+	.byte	0x23
+	.long	0x3ad
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1043
+	.byte	0x9
+	.byte	0x24
+	.byte	0xc
+	.long	0x70
+	.uleb128 0x5
+	.long	.LASF1214
+	.byte	0x24
+	.byte	0x20
+	.long	0x3ad
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 10 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.file 13 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 15 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 16 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 26 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1a
+	.file 27 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.file 28 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x1c
+	.file 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.file 30 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x1e
+	.byte	0x4
+	.file 31 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x4
+	.file 32 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x20
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x4
+	.file 33 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x21
+	.file 34 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 35 "./src/main/io/displayport_frsky_osd.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x23
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF802
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF821
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF838
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF839
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF840
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF842
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF844
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF867
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF906
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF908
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF914
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF943
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF953
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF976
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF989
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display_font_metadata.h.14.56086b7130ef570dd7a1c0e2b33205f6,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF992
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.27.28b361a2d50a4296db906c23e9f22923,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1003
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xe
+	.long	.LASF1
+	.long	.LASF1218
+	.long	.LASF1219
+	.long	.LASF1220
+	.long	.LASF1221
+	.long	.LASF1222
+	.long	.LASF1223
+	.long	.LASF1224
+	.long	.LASF1225
+	.long	.LASF1226
+	.long	.LASF1227
+	.long	.LASF1228
+	.long	.LASF1229
+	.long	.LASF1230
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x24
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1231
+	.byte	0x9
+	.long	.LASF1232
+	.byte	0x9
+	.long	.LASF1233
+	.byte	0x9
+	.long	.LASF1234
+	.byte	0x4
+	.long	.LASF1235
+	.byte	0x4
+	.long	.LASF1236
+	.byte	0x4
+	.long	.LASF1237
+	.byte	0x4
+	.long	.LASF1238
+	.byte	0x5
+	.long	.LASF1239
+	.byte	0x5
+	.long	.LASF1240
+	.byte	0xc
+	.long	.LASF1241
+	.byte	0xd
+	.long	.LASF1242
+	.byte	0xd
+	.long	.LASF1242
+	.byte	0xc
+	.long	.LASF1243
+	.byte	0x9
+	.long	.LASF1244
+	.byte	0xc
+	.long	.LASF1245
+	.byte	0xc
+	.long	.LASF1246
+	.byte	0x9
+	.long	.LASF1247
+	.byte	0x9
+	.long	.LASF1248
+	.byte	0xb
+	.long	.LASF1249
+	.byte	0x9
+	.long	.LASF1250
+	.byte	0xa
+	.long	.LASF1251
+	.byte	0xa
+	.long	.LASF1252
+	.byte	0x9
+	.long	.LASF1253
+	.byte	0x9
+	.long	.LASF1254
+	.byte	0x9
+	.long	.LASF1255
+	.byte	0x8
+	.long	.LASF1256
+	.byte	0x7
+	.long	.LASF1257
+	.byte	0x6
+	.long	.LASF1258
+	.byte	0xd
+	.long	.LASF1259
+	.byte	0x7
+	.long	.LASF1260
+	.byte	0x7
+	.long	.LASF1261
+	.byte	0x2
+	.long	.LASF1262
+	.byte	0x3
+	.long	.LASF1263
+	.byte	0x1
+	.long	.LASF1264
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1143:
+	.string	"FRSKY_OSD_OUTLINE_TYPE_LEFT"
+.LASF787:
+	.string	"USE_CLI_BATCH "
+.LASF1029:
+	.string	"displayCanvas_s"
+.LASF1027:
+	.string	"displayCanvas_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF955:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF706:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1151:
+	.string	"frskyOSDDrawCharInGrid"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF771:
+	.string	"USE_RX_MSP "
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF777:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF853:
+	.string	"USE_UART1 "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1062:
+	.string	"displayPort_s"
+.LASF1073:
+	.string	"displayPort_t"
+.LASF1115:
+	.string	"fillStrokeRect"
+.LASF711:
+	.string	"USE_GPS "
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF766:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1154:
+	.string	"frskyOSDReadFontCharacter"
+.LASF975:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF489:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1096:
+	.string	"setPixelToStrokeColor"
+.LASF1093:
+	.string	"setStrokeAndFillColor"
+.LASF1147:
+	.string	"frskyOSDVTable"
+.LASF1210:
+	.string	"frskyOSDGetColor"
+.LASF700:
+	.string	"USE_I2C_PULLUP "
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1064:
+	.string	"cols"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1187:
+	.string	"frskyOSDFillEllipseInRect"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1208:
+	.string	"outlineType"
+.LASF825:
+	.string	"_WCHAR_T "
+.LASF719:
+	.string	"USE_PITOT "
+.LASF748:
+	.string	"USE_TELEMETRY_SIM "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1203:
+	.string	"instance"
+.LASF844:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF1137:
+	.string	"FRSKY_OSD_COLOR_GRAY"
+.LASF707:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF905:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF859:
+	.string	"USE_UART7 "
+.LASF868:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF922:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF1026:
+	.string	"textAttributes_t"
+.LASF986:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF947:
+	.string	"UNIT_TESTED "
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF951:
+	.string	"EXTENDED_FASTRAM "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1134:
+	.string	"FRSKY_OSD_COLOR_BLACK"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF912:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF805:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF937:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1067:
+	.string	"useFullscreen"
+.LASF714:
+	.string	"USE_TELEMETRY "
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1200:
+	.string	"frskyOSDDisplayPortInit"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF772:
+	.string	"USE_SERIALRX_SUMD "
+.LASF739:
+	.string	"USE_1WIRE_DS2482 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF832:
+	.string	"_WCHAR_T_DEFINED "
+.LASF761:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF846:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF987:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF798:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1183:
+	.string	"frskyOSDStrokeRect"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF819:
+	.string	"_GCC_SIZE_T "
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1092:
+	.string	"setFillColor"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1214:
+	.string	"displayPort"
+.LASF699:
+	.string	"I2C2_OVERCLOCK false"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF809:
+	.string	"_T_SIZE "
+.LASF933:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF866:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1129:
+	.string	"VIDEO_SYSTEM_NTSC"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1105:
+	.string	"drawCharacterMask"
+.LASF1191:
+	.string	"frskyOSDCtmTranslate"
+.LASF1157:
+	.string	"frskyOSDGetGridRows"
+.LASF831:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF998:
+	.string	"OSD_CHARACTER_COLOR_BLACK 0"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF895:
+	.string	"U_ID_1 1"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1174:
+	.string	"frskyOSDDrawCharacter"
+.LASF752:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1038:
+	.string	"displayFontMetadata_s"
+.LASF1037:
+	.string	"displayFontMetadata_t"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF874:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF790:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1116:
+	.string	"strokeEllipseInRect"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF1076:
+	.string	"DISPLAY_CANVAS_BITMAP_OPT_ERASE_TRANSPARENT"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF807:
+	.string	"_SYS_SIZE_T_H "
+.LASF705:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1028:
+	.string	"osdCharacter_s"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF956:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1098:
+	.string	"setStrokeWidth"
+.LASF1217:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF990:
+	.string	"FONT_CHR_IS_METADATA(chr) ((chr)->data[0] == 'I' && (chr)->data[1] == 'N' && (chr)->data[2] == 'A' && (chr)->data[3] == 'V' && (chr)->data[4] == 1)"
+.LASF1014:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1168:
+	.string	"frskyOSDSetStrokeWidth"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1126:
+	.string	"float"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF893:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF958:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF733:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1131:
+	.string	"FRSKY_OSD_TRANSACTION_OPT_PROFILED"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF942:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1005:
+	.string	"short unsigned int"
+.LASF1213:
+	.string	"metadata"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF760:
+	.string	"CMS_MENU_OSD "
+.LASF871:
+	.string	"USE_DASHBOARD"
+.LASF1156:
+	.string	"frskyOSDGetGridCols"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1048:
+	.string	"writeString"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF971:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF911:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1112:
+	.string	"fillStrokeTriangle"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1198:
+	.string	"displayInit"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1081:
+	.string	"DISPLAY_CANVAS_COLOR_GRAY"
+.LASF1040:
+	.string	"charCount"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF731:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF962:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1008:
+	.string	"signed char"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF953:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1017:
+	.string	"uint8_t"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1110:
+	.string	"strokeTriangle"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF769:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1138:
+	.string	"frskyOSDColor_e"
+.LASF1202:
+	.string	"canvas"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF915:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF784:
+	.string	"USE_VTX_FFPV "
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF743:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1172:
+	.string	"frskyOSDClearRect"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF867:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1004:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1182:
+	.string	"frskyOSDFillStrokeTriangle"
+.LASF1036:
+	.string	"gridElementHeight"
+.LASF1052:
+	.string	"heartbeat"
+.LASF1216:
+	.string	"updateGridSize"
+.LASF715:
+	.string	"USE_TELEMETRY_LTM "
+.LASF908:
+	.string	"NOINLINE "
+.LASF901:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1152:
+	.string	"frskyOSDReadCharInGrid"
+.LASF981:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF753:
+	.string	"USE_D_BOOST "
+.LASF855:
+	.string	"USE_UART3 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF1061:
+	.string	"getCanvas"
+.LASF875:
+	.string	"USE_RANGEFINDER"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF886:
+	.string	"USE_VCP"
+.LASF1021:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF1035:
+	.string	"gridElementWidth"
+.LASF813:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF841:
+	.string	"NULL"
+.LASF1130:
+	.string	"videoSystem_e"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF978:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF723:
+	.string	"USE_GYRO_KALMAN "
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1085:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_RIGHT"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1103:
+	.string	"resetDrawingState"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1087:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_LEFT"
+.LASF991:
+	.string	"FONT_METADATA_CHR_INDEX 255"
+.LASF1070:
+	.string	"grabCount"
+.LASF741:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1075:
+	.string	"DISPLAY_CANVAS_BITMAP_OPT_SOLID_BACKGROUND"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1101:
+	.string	"clipToRect"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1012:
+	.string	"__uint16_t"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1079:
+	.string	"DISPLAY_CANVAS_COLOR_TRANSPARENT"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1043:
+	.string	"grab"
+.LASF1135:
+	.string	"FRSKY_OSD_COLOR_TRANSPARENT"
+.LASF1099:
+	.string	"setLineOutlineType"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF898:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1106:
+	.string	"drawString"
+.LASF1063:
+	.string	"rows"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF897:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1003:
+	.string	"OSD_CHARACTER_GRID_BUFFER_SIZE (OSD_CHARACTER_GRID_MAX_WIDTH * OSD_CHARACTER_GRID_MAX_HEIGHT)"
+.LASF1001:
+	.string	"OSD_CHARACTER_GRID_MAX_WIDTH 30"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF879:
+	.string	"USE_PITOT_ADC"
+.LASF1024:
+	.string	"DISPLAY_TRANSACTION_OPT_RESET_DRAWING"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF698:
+	.string	"I2C1_OVERCLOCK false"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1102:
+	.string	"clearRect"
+.LASF907:
+	.string	"FAST_CODE "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF1041:
+	.string	"displayPortVTable_t"
+.LASF758:
+	.string	"USE_STATS "
+.LASF749:
+	.string	"USE_FRSKYOSD "
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF1142:
+	.string	"FRSKY_OSD_OUTLINE_TYPE_BOTTOM"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1022:
+	.string	"DISPLAY_TRANSACTION_OPT_NONE"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF845:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF974:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF835:
+	.string	"__INT_WCHAR_T_H "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF822:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF709:
+	.string	"USE_64BIT_TIME "
+.LASF728:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1204:
+	.string	"displayCanvas"
+.LASF1160:
+	.string	"frskyOSDCommitTransaction"
+.LASF702:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF704:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF1158:
+	.string	"frskyOSDIsReady"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF856:
+	.string	"USE_UART4 "
+.LASF1162:
+	.string	"frskyOSDSetFillColor"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1169:
+	.string	"frskyOSDSetLineOutlineType"
+.LASF1072:
+	.string	"maxChar"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF864:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF394:
+	.string	"bool _Bool"
+.LASF924:
+	.string	"STR_HELPER(x) #x"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1010:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF830:
+	.string	"_BSD_WCHAR_T_ "
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF726:
+	.string	"USE_RX_UIB "
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF756:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF1124:
+	.string	"contextPush"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF770:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF950:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF921:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF934:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1188:
+	.string	"frskyOSDFillStrokeEllipseInRect"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF988:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF963:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1009:
+	.string	"__int8_t"
+.LASF842:
+	.string	"NULL ((void *)0)"
+.LASF919:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF869:
+	.string	"USE_USB_MSC"
+.LASF896:
+	.string	"U_ID_2 2"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF860:
+	.string	"USE_UART8 "
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF804:
+	.string	"__size_t__ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF759:
+	.string	"USE_CMS "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF751:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF785:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1000:
+	.string	"OSD_CHARACTER_COLOR_WHITE 2"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF964:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF703:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1023:
+	.string	"DISPLAY_TRANSACTION_OPT_PROFILED"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF904:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF781:
+	.string	"USE_VTX_CONTROL "
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF960:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF808:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1175:
+	.string	"frskyOSDDrawCharacterMask"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF902:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF833:
+	.string	"_WCHAR_T_H "
+.LASF929:
+	.string	"UNUSED(x) (void)(x)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1049:
+	.string	"writeChar"
+.LASF716:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1215:
+	.string	"attr"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1140:
+	.string	"FRSKY_OSD_OUTLINE_TYPE_TOP"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF1209:
+	.string	"inverted"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF1211:
+	.string	"frskyOpts"
+.LASF775:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF939:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF847:
+	.string	"USE_IMU_FAKE "
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1199:
+	.string	"frskyOSDInit"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1196:
+	.string	"frskyOSDGetPixelHeight"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF738:
+	.string	"USE_1WIRE "
+.LASF1192:
+	.string	"frskyOSDCtmScale"
+.LASF1194:
+	.string	"frskyOSDContextPush"
+.LASF861:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF799:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF782:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF794:
+	.string	"_T_PTRDIFF_ "
+.LASF850:
+	.string	"USE_FAKE_GPS "
+.LASF1114:
+	.string	"fillRect"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF817:
+	.string	"__DEFINED_size_t "
+.LASF985:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF797:
+	.string	"_PTRDIFF_T_ "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF712:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1146:
+	.string	"frskyOSDCanvasVTable"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF996:
+	.string	"OSD_CHAR_VISIBLE_BYTES (OSD_CHAR_WIDTH * OSD_CHAR_HEIGHT * OSD_CHAR_BITS_PER_PIXEL / 8)"
+.LASF717:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF826:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF969:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF920:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1020:
+	.string	"osdCharacter_t"
+.LASF1013:
+	.string	"__uint32_t"
+.LASF783:
+	.string	"USE_VTX_TRAMP "
+.LASF878:
+	.string	"USE_PITOT_MS4525"
+.LASF811:
+	.string	"_SIZE_T_ "
+.LASF977:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1113:
+	.string	"strokeRect"
+.LASF823:
+	.string	"__wchar_t__ "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF1033:
+	.string	"width"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1082:
+	.string	"displayCanvasColor_e"
+.LASF724:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF968:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1077:
+	.string	"displayCanvasBitmapOption_t"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF1177:
+	.string	"frskyOSDDrawStringMask"
+.LASF959:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF774:
+	.string	"USE_SERIALRX_XBUS "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF965:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1059:
+	.string	"beginTransaction"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF889:
+	.string	"USE_RCDEVICE"
+.LASF732:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF466:
+	.string	"__PMT"
+.LASF737:
+	.string	"USE_PITOT_MS4525 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1207:
+	.string	"outlineColor"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF914:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF792:
+	.string	"_ANSI_STDDEF_H "
+.LASF1197:
+	.string	"frskyOSDGetPixelWidth"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1212:
+	.string	"addr"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF358:
+	.string	"__k8 1"
+.LASF1171:
+	.string	"frskyOSDClipToRect"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF872:
+	.string	"USE_OLED_UG2864"
+.LASF1051:
+	.string	"isTransferInProgress"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1069:
+	.string	"cursorRow"
+.LASF1083:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_NONE"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1006:
+	.string	"unsigned int"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1190:
+	.string	"frskyOSDCtmSet"
+.LASF1119:
+	.string	"ctmReset"
+.LASF1047:
+	.string	"screenSize"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1206:
+	.string	"opts"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF788:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1176:
+	.string	"frskyOSDDrawString"
+.LASF837:
+	.string	"_WCHAR_T_DECLARED "
+.LASF979:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF1104:
+	.string	"drawCharacter"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF954:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF765:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF795:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF931:
+	.string	"BIT(x) (1 << (x))"
+.LASF793:
+	.string	"_PTRDIFF_T "
+.LASF1173:
+	.string	"frskyOSDResetDrawingState"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF892:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF767:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1189:
+	.string	"frskyOSDCtmReset"
+.LASF816:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF396:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF395:
+	.string	"true 1"
+.LASF801:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1058:
+	.string	"isReady"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1153:
+	.string	"displayFontMetadataUpdateFromCharacter"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1185:
+	.string	"frskyOSDFillStrokeRect"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1045:
+	.string	"clearScreen"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF952:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1141:
+	.string	"FRSKY_OSD_OUTLINE_TYPE_RIGHT"
+.LASF1167:
+	.string	"frskyOSDSetPixelToFillColor"
+.LASF754:
+	.string	"USE_ANTIGRAVITY "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF843:
+	.string	"__need_NULL"
+.LASF989:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF818:
+	.string	"___int_size_t_h "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF848:
+	.string	"USE_FAKE_BARO "
+.LASF815:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF800:
+	.string	"_GCC_PTRDIFF_T "
+.LASF713:
+	.string	"USE_NAV "
+.LASF550:
+	.string	"__stub_revoke "
+.LASF747:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF851:
+	.string	"USE_MAG "
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1015:
+	.string	"char"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF806:
+	.string	"_SIZE_T "
+.LASF718:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF876:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1161:
+	.string	"frskyOSDSetStrokeColor"
+.LASF755:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1165:
+	.string	"frskyOSDSetPixel"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF967:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF849:
+	.string	"USE_FAKE_MAG "
+.LASF1065:
+	.string	"posX"
+.LASF863:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF888:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1060:
+	.string	"commitTransaction"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1100:
+	.string	"setLineOutlineColor"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1149:
+	.string	"frskyOSDUpdate"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF810:
+	.string	"__SIZE_T "
+.LASF917:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF780:
+	.string	"USE_RCDEVICE "
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF943:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF778:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1016:
+	.string	"int8_t"
+.LASF828:
+	.string	"__WCHAR_T "
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF941:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1125:
+	.string	"contextPop"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF916:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF697:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1050:
+	.string	"readChar"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1032:
+	.string	"device"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF873:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1108:
+	.string	"moveToPoint"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF383:
+	.string	"SITL 1"
+.LASF936:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF814:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF938:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF913:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1018:
+	.string	"uint16_t"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF796:
+	.string	"__PTRDIFF_T "
+.LASF1164:
+	.string	"frskyOSDSetColorInversion"
+.LASF973:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1170:
+	.string	"frskyOSDSetLineOutlineColor"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1139:
+	.string	"FRSKY_OSD_OUTLINE_TYPE_NONE"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1148:
+	.string	"frskyOSDClearScreen"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1144:
+	.string	"frskyOSDLineOutlineType_e"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1094:
+	.string	"setColorInversion"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1111:
+	.string	"fillTriangle"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1095:
+	.string	"setPixel"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF857:
+	.string	"USE_UART5 "
+.LASF970:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF745:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1084:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_TOP"
+.LASF821:
+	.string	"__size_t "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1091:
+	.string	"setStrokeColor"
+.LASF744:
+	.string	"USE_DASHBOARD "
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1055:
+	.string	"supportedTextAttributes"
+.LASF1080:
+	.string	"DISPLAY_CANVAS_COLOR_WHITE"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF840:
+	.string	"__need_wchar_t"
+.LASF1117:
+	.string	"fillEllipseInRect"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF812:
+	.string	"_BSD_SIZE_T_ "
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1039:
+	.string	"version"
+.LASF736:
+	.string	"USE_OPFLOW_MSP "
+.LASF827:
+	.string	"_T_WCHAR "
+.LASF976:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF762:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF982:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF735:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF779:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF708:
+	.string	"USE_ADC_AVERAGING "
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1074:
+	.string	"DISPLAY_CANVAS_BITMAP_OPT_INVERT_COLORS"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF829:
+	.string	"_WCHAR_T_ "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF1205:
+	.string	"color"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF891:
+	.string	"USE_ITCM_RAM"
+.LASF725:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1118:
+	.string	"fillStrokeEllipseInRect"
+.LASF890:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1150:
+	.string	"frskyOSDDrawStringInGrid"
+.LASF945:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF928:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1086:
+	.string	"DISPLAY_CANVAS_OUTLINE_TYPE_BOTTOM"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF966:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF820:
+	.string	"_SIZET_ "
+.LASF957:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF1178:
+	.string	"frskyOSDMoveToPoint"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF858:
+	.string	"USE_UART6 "
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF729:
+	.string	"USE_RANGEFINDER "
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF910:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF721:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF925:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF883:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1180:
+	.string	"frskyOSDStrokeTriangle"
+.LASF1128:
+	.string	"VIDEO_SYSTEM_PAL"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF885:
+	.string	"USE_ADC"
+.LASF999:
+	.string	"OSD_CHARACTER_COLOR_TRANSPARENT 1"
+.LASF881:
+	.string	"USE_1WIRE_DS2482"
+.LASF734:
+	.string	"USE_OPFLOW "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF882:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF906:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF918:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1011:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1184:
+	.string	"frskyOSDFillRect"
+.LASF1201:
+	.string	"videoSystem"
+.LASF1066:
+	.string	"posY"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF997:
+	.string	"OSD_CHAR_BYTES 64"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF993:
+	.string	"OSD_CHAR_WIDTH 12"
+.LASF1068:
+	.string	"cleared"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF730:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF948:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1046:
+	.string	"drawScreen"
+.LASF1120:
+	.string	"ctmSet"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1179:
+	.string	"frskyOSDStrokeLineToPoint"
+.LASF1078:
+	.string	"DISPLAY_CANVAS_COLOR_BLACK"
+.LASF803:
+	.string	"__need_ptrdiff_t"
+.LASF836:
+	.string	"_GCC_WCHAR_T "
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF984:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF949:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF746:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF903:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF926:
+	.string	"EXPAND_I(x) x"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF824:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1071:
+	.string	"cachedSupportedTextAttributes"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1056:
+	.string	"getFontMetadata"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF909:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF838:
+	.string	"__DEFINED_wchar_t "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF930:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF946:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF742:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF852:
+	.string	"USE_BARO "
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF1121:
+	.string	"ctmTranslate"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1109:
+	.string	"strokeLineToPoint"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1042:
+	.string	"displayPortVTable_s"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1090:
+	.string	"displayCanvasVTable_s"
+.LASF1089:
+	.string	"displayCanvasVTable_t"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF720:
+	.string	"USE_PITOT_ADC "
+.LASF834:
+	.string	"___int_wchar_t_h "
+.LASF935:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF923:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF727:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF884:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1193:
+	.string	"frskyOSDCtmRotate"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF854:
+	.string	"USE_UART2 "
+.LASF1057:
+	.string	"writeFontCharacter"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF839:
+	.string	"_BSD_WCHAR_T_"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1088:
+	.string	"displayCanvasOutlineType_e"
+.LASF768:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1019:
+	.string	"uint32_t"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1127:
+	.string	"VIDEO_SYSTEM_AUTO"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1159:
+	.string	"frskyOSDBeginTransaction"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1044:
+	.string	"release"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF880:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF865:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF894:
+	.string	"U_ID_0 0"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF870:
+	.string	"USE_SERVO_SBUS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF899:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1107:
+	.string	"drawStringMask"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF887:
+	.string	"USE_RX_PPM"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF1002:
+	.string	"OSD_CHARACTER_GRID_MAX_HEIGHT 16"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF786:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1054:
+	.string	"txBytesFree"
+.LASF764:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1166:
+	.string	"frskyOSDSetPixelToStrokeColor"
+.LASF1163:
+	.string	"frskyOSDSetStrokeAndFillColor"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF862:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF992:
+	.string	"FONT_METADATA_CHR_INDEX_2ND_PAGE 256"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1186:
+	.string	"frskyOSDStrokeEllipseInRect"
+.LASF1097:
+	.string	"setPixelToFillColor"
+.LASF1155:
+	.string	"frskyOSDWriteFontCharacter"
+.LASF994:
+	.string	"OSD_CHAR_HEIGHT 18"
+.LASF1195:
+	.string	"frskyOSDContextPop"
+.LASF980:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF773:
+	.string	"USE_SERIALRX_SUMH "
+.LASF802:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF757:
+	.string	"USE_LOG "
+.LASF701:
+	.string	"USE_RX_PPM "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF710:
+	.string	"USE_BLACKBOX "
+.LASF940:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF972:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF791:
+	.string	"_STDDEF_H_ "
+.LASF1133:
+	.string	"frskyOSDTransactionOptions_e"
+.LASF927:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1181:
+	.string	"frskyOSDFillTriangle"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1136:
+	.string	"FRSKY_OSD_COLOR_WHITE"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF1031:
+	.string	"vTable"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF961:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF900:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF944:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1025:
+	.string	"displayTransactionOption_e"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1053:
+	.string	"resync"
+.LASF1030:
+	.string	"data"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF995:
+	.string	"OSD_CHAR_BITS_PER_PIXEL 2"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1132:
+	.string	"FRSKY_OSD_TRANSACTION_OPT_RESET_DRAWING"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF789:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1123:
+	.string	"ctmRotate"
+.LASF932:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF776:
+	.string	"USE_SERIALRX_CRSF "
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF722:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1122:
+	.string	"ctmScale"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1007:
+	.string	"long unsigned int"
+.LASF763:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1145:
+	.string	"frskyOSDDisplayPort"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1034:
+	.string	"height"
+.LASF877:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF740:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF983:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF750:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1249:
+	.string	"long-double.h"
+.LASF1255:
+	.string	"platform.h"
+.LASF1257:
+	.string	"target.h"
+.LASF1243:
+	.string	"libc-header-start.h"
+.LASF1241:
+	.string	"stdbool.h"
+.LASF1228:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1235:
+	.string	"osd.h"
+.LASF1232:
+	.string	"stdint-intn.h"
+.LASF1227:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1230:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1234:
+	.string	"display.h"
+.LASF1223:
+	.string	"src/main/target/SITL"
+.LASF1222:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1238:
+	.string	"frsky_osd.h"
+.LASF1226:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1239:
+	.string	"displayport_frsky_osd.c"
+.LASF1245:
+	.string	"features-time64.h"
+.LASF1264:
+	.string	"displayport_frsky_osd.h"
+.LASF1231:
+	.string	"types.h"
+.LASF1247:
+	.string	"timesize.h"
+.LASF1221:
+	.string	"src/main/drivers"
+.LASF1229:
+	.string	"/usr/include"
+.LASF1236:
+	.string	"display_canvas.h"
+.LASF1218:
+	.string	"src/main/build"
+.LASF1259:
+	.string	"sanity_check.h"
+.LASF1244:
+	.string	"features.h"
+.LASF1256:
+	.string	"common.h"
+.LASF1252:
+	.string	"typesizes.h"
+.LASF1253:
+	.string	"time64.h"
+.LASF1220:
+	.string	"src/main/config"
+.LASF0:
+	.string	"./src/main/io/displayport_frsky_osd.c"
+.LASF1233:
+	.string	"stdint-uintn.h"
+.LASF1224:
+	.string	"src/main/target"
+.LASF1261:
+	.string	"utils.h"
+.LASF1225:
+	.string	"src/main"
+.LASF1254:
+	.string	"wchar.h"
+.LASF1250:
+	.string	"stubs.h"
+.LASF1219:
+	.string	"src/main/common"
+.LASF1248:
+	.string	"cdefs.h"
+.LASF1242:
+	.string	"stdint.h"
+.LASF1263:
+	.string	"build_config.h"
+.LASF1258:
+	.string	"stddef.h"
+.LASF1251:
+	.string	"stubs-64.h"
+.LASF1246:
+	.string	"wordsize.h"
+.LASF1260:
+	.string	"common_post.h"
+.LASF1237:
+	.string	"display_font_metadata.h"
+.LASF1262:
+	.string	"parameter_group.h"
+.LASF1240:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\255\n"
+	.string	"\344\020\276\001"
+	.string	"<"
+	.string	"\300\265\356\337\r"
+	.string	"\001\002\003\004\300\331\242\247\b"
+	.string	"\005\303\222\273\220\b"
+	.string	"\006\344\201\256\204\b\006\002"
+	.string	"\002\001\002\002\007\203\214\247\213\n\b\327\260\254\202\003"
+	.string	"\t\n\257\261\347\347\017"
+	.string	"\013\304\276\253\347\002"
+	.string	"\f\r\270\230\265\373\017"
+	.string	"\016\017\247\314\202\355\006"
+	.string	"\020\021\022\023\024\025\026\027\030\031\032\356\323\324\331\004"
+	.string	"\033\261\352\221\352\r"
+	.string	"\034\324\276\260\330\007"
+	.string	"\035\317\326\323\301\b"
+	.string	"\036\037 !\"#$%&\370\206\215\341\r"
+	.string	"'\315\255\347\267\002"
+	.string	"(\232\347\367\226\001"
+	.string	")*+,\234\255\250\243\016"
+	.string	"-\330\354\353\355\007\004\002\003\002.\356\226\237\361\n"
+	.string	"/\253\276\271\365\016"
+	.string	"0\213\340\303d"
+	.string	"1\355\213\276\330\003"
+	.string	"2\242\236\324\246\001\004\002\002\002\005\002\006\002\0063\255\250\243\350\004"
+	.string	"4\330\232\361\332\n"
+	.string	"5\260\300\353\275\f"
+	.string	"6\335\247\230\205\f"
+	.string	"78\341\321\342\223\006"
+	.string	"9\240\342\234\212\n:\257\331\210\327\001;\210\316\306\356\016"
+	.string	""
+	.string	"\037"
+	.ascii	"\207\312\304\373]/\214\003\203Q\031\002\206\\a\034\030L5\204"
+	.ascii	"d\306\201\301`\210\3460\034\306ya00De\334V\203\201!`\034\030"
+	.ascii	"\f\f\2412\270Q\203\003\243V\031\352\335\030`\b\030We\234\002"
+	.ascii	"\f\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\256\004M\013"
+	.ascii	"\202K%)0q\222\016\300\300\300R\255RPPPP"
+	.string	"P(\325\342P\213C-\016\26584\376\377\377\177\277}\362\033i\204\020\262\267L\001\377\267\270H\3579\310G\317z\254\216r@\377H\324\006j\214d\340xb\270\177R\333\213g\311\342\212N\321\333\t\t\214\030\342!\273rhH\206\005\205>& \034\030\024\020\2707\r85\255\316\004\002\022\240\3238m\243\311`.\221\352\262T\372\254\277\372\252\237\254\215\362\372\210\315I\277?B\256\367A\266Tb\263\035\335C^%\001o\250\221I7J\241\355\320\002\241\251m\036\022\300\263,\006\205 \202\304\031\023\t$\2444y=\007_\360\211{\3443\222\371v\275Fuh\374\346\035o\037\024\340XPlK%?\364\312e\326\334$4(Z\335%\212$F\003#\310\017T\200\250\201\033\267\265(\211\211\326\216:\211\023{\214\022<\236\207\f\256\203~W\342\354\274T\202\343A\355\375\322\021\260\265\374x\225\374\324\242\314"
+	.ascii	"\236\n8NB/>\345(\336\313$\255o\313T &(\261|\017\346\312c\260"
+	.ascii	"\326\254j\343\224\217\324_\261\323Z0\024\346\312{]ue<\324u(C"
+	.ascii	"\024\201Y\021y\322~\364s\362Y\360hZ\002q\254%\370\304p\274\222"
+	.ascii	"L*\013XX\373\023\211\022\345jU\372"
+	.text
+	.section	.gnu.lto_.inline.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\201\013\265\024"
+	.string	"\226\225J?@\347$\035\303\234\260\312*\371\244\205$\321\253\330v*\372\271\263\234\213P\264\327\020\346P\007@\355\023\254\272\212\217\355\017+\254\260\202&\376\344\223O>\371\304AZk\244\021B\310&[\312\224\0024"
+	.string	":"
+	.string	"9"
+	.string	"\234g\316K=u\314yW\221\222v\2272va\027)\264\325I=\355\356e\207t\244\004v\027s\244\240\346\355\2146\316\356\346\330i\277\313\335]\265a\234\335\004\036e\033\024\355N\327r(\253\374\225\247@\337\367}\337\242\255\224\271\363[\254\262\006j\203\335\365X\"\002\342\301\241\201aA!A\203\266?\324(-\203>\321\266V\215\222\344\311\0344\232e\246\037\301\337\335\376\026\263\264\271\226v7\363\210H\b\310\237\333\377\017\265\355\201\226;\215\252\232\036\035\034\033\032\031\030\027\026\232\0250\257?\360\233\016)\240\302{\023\346\0026\347\375\nJ\017\n`\216\261_\\Z\224%\017\341\n|>S\345\256\354N\003$(\r\270\"\bX"
+	.string	"A\363)\005C\311\350\235\230\270\3134"
+	.string	"\006\016\f\\.Q\022\211\245\331\232\311\264\346\200\240\250\021mf\243M2\354\031\200\002\021\031\"\262\016\022@\3234\203\201$\001# \206\b\214\300\020\201A\2040CD\"2\"6t\033\336\264\031of \250\231\221\0235\004^vaZU\253\202\250\343^m\265\234\007;|E\257\245l\341\026\212\370\030\354\036\330\3557\227"
+	.string	"V0\0228\223\323!7\272E\304\213\303p\300C\377/\017\235\210w\347k\003\201}3\223\212'y~\331\254\241\016A\274\032\206\"\036%Y\263\327\311\036\026I\377\322y\237\021~\351?2\273R8\360\310\202\007\2440'D$\206G&\370\300S\030L\017\327\245P\222\324P\362\350\253\032\035%r\337\306_@\023\315\300\"\322\352_"
+	.ascii	"\305G\004\211\347~\t\320<[\207\205\200|\240k;\263<\310Jv\366"
+	.ascii	"\301ZP\253q\305\223\241\\\350\277\276!\242\233<\313\244\370\274"
+	.ascii	"\374\243\022\304 \277j\300\320-\302\273Lu\313y`\371K\303\336"
+	.ascii	"Bs\300\0136'\374\274\020\003^4?wfi1\021}\324-\b2M\2720\020i\001"
+	.ascii	"\324\001\337\223u\203\255\226bU\210\254r\261\262\035\215c\364"
+	.ascii	"\317\034\bSZE;\216C\n\317BfS/3A\207\303\2530\260\2010\346_sT"
+	.ascii	"\244s^\301\030~\315\267\360e\361\022T\022\313m~;}\366\020r\343"
+	.ascii	"\322L("
+	.text
+	.section	.gnu.lto_.jmpfuncs.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\355\t\365\022"
+	.string	"\366\024C6PK\224\016\200\030g733\371\323\265\310n333(\263\233I$Df\274N\3234M\323ul\334\266m\363\342"
+	.string	"\376\333\377\366?\233\221\222O\366&r\247\224\002."
+	.string	"5"
+	.string	"8"
+	.string	"\033\333\r\006\035\336\302\2338l\334\030\323\361\316qW\266\327\302xw\334~#\373\222\242\216Z\352\365q\331g\020u\267\250\373\336\332\325PID\316O\200:=\330\034\257\224\216\037"
+	.string	"uZq\204\264\211:]\261\272b\367\302[R\034\333\021\202\3310\211\213\245BaS\233H\"\220\207\343\026\372<\365y\034=\240\324\013M\270\212eJn)#\241\245\"\030\302\375\356\333\017\332s0\035/\323k\300\240-hU\375\305\321\357d_\001k\3768\001\202\003\221\201H\201R\231\215\300"
+	.ascii	"\214\200\006-\225\231\351^"
+	.string	"\276\341\226\257\016\257|]\233\001C\357B\335\261\320h#*\034^\b\233\223\216(\367\344f\034\031P\207\202A\330\037\234yh\r\2635\354.\376\002\200\230\250p\326\220$I\222\341\200\002\221!\253u\003\022\240\001\211\216\242I\034CH\200\214@(\220HB\221@D\002\t\206\222\302\rA(H\301\004\266\027\363\305H8\307t\216!\0347\342\275B\340Y+\203\307v\360=3<\363\305\001\362\306\353\f\364\244\260\036\243\350A\222\367,\316\330`\271\0076t\021\216\335\037l8\366\346\200\203\200\325\bc:\300\201\374\320h\344&\204\357E*5p1\365\t}l\002\260U$\371\240;\033\345\244;\343\360UH,w\250P\n\352\352\022\225\214\n\232\347\310\2752Qn\302!\260\346\213u\037\016J\377\215\227\371z\215{\313+\316\360=\217\212\201\276\344(O\267\017|\024Q\251\024\217\036\017\223\210ZsC\0068\033"
+	.string	"HUH\340\203\022\236>\212Xbv\2406!\334c\363\356\240o\330\245\206c\030\006\022\206\031\375\317[\320\322c\254P\262\032c(\006\240\351^\343\372\353\345\262QH\247\033\222\240\235A\211\003\312\250\204\331\022\237 \025\240#\027\230)\240\253%\266\033M\235|\215\002\225I)[\222\006.\216\340\272\300"
+	.ascii	"\035\240\301\211\214S\260R\201\314\353k\234\027E\217\031\322"
+	.ascii	"\317-\n&\\\360\031\301\366\002,"
+	.text
+	.section	.gnu.lto_.pureconst.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375 \257\375\003"
+	.string	"\362\312\036#P\205\265\0060\3656fV2333330\317\030cPUUUUUU\353\314\314\314\254\372FC\006\232\201\023\370\200\013x\200\003\370\314M\3461\207\371\313]n-g\371\312U\236r\224\237\334\344%'\371\310E\036r\220\177\334\343\035\347\370\3065\236q\3151~q\213W\234\342\023\227x\304!\376p\2077\234\341\013Wx\302\r\341;\370\364\031|\005\037\301\347\n\234s\007\001"
+	.text
+	.section	.gnu.lto_.ipa_modref.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`Q\002\235\b"
+	.string	"\302J'0PO\222\016 ;333S\213\271\231FTU\303\252\252\252\252j$\022\\ \201\004\022Hc=,Zk?\374 \r\244\221\265\226\020b\211\224)\217\262I\tIF~%\022\362\335\335\361O\331\013\362\341\301\016\320K\024Ry\346B\216\357.CO\271\302\215\027K\253\301\f\214\213ZT\214\241\2308I\200\032\001\241\332\003\035>/O\347_\234\206\304\260\240\360,\001\341\300\240\340\024\301"
+	.string	"\023\b\370\233"
+	.string	"\356F\223\271\265\266ch\323\243\243\347\274\323\316)\313Z\272\024&\225\227\237\234R\002F\250a`\224\316\302\260g \003!\323t\020\030EF\312jr\fxX\317D\232\234"
+	.string	"\373\220\3125'@\203\245\312\026r\225g\272\002\304*\261\362\230\260\220\0343\004U#w\\7\025/=\035D\357\037\246)\232g\2547\230\002y\376\253\3725\210\325\022\222\324_vt\245\354#\006\265\003\201\023"
+	.ascii	"3\2247bp\363\231\213\247\317\305\271@~\363C\352\006\n"
+	.text
+	.section	.gnu.lto_.lto.987001d55aa12290,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_grab.17.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"-\b"
+	.string	"R\217880q\323\001\200\3004\024\262\252\032\3238\331\225\034\234\350\335\tu"
+	.string	"\315\372x\323\235p\315\202\326\260\241\254\337W\007.B\t\\6\334Nx\310\203\374\340C\343\247FvJ\001\326F\231\266}2\r+\370\350|\270,\3026o\202H\021\036\205"
+	.string	"}tv\244\220D\347q\233\234\234\244\340B\023RD=\211!xv#*\2779\251\274\352\336N8\203\207\005u\341wx8d6\326\330\265\024\251\017\373\325R';^\030\0033\273\03276\013c\271\210\330\006\355\313\376\3048<\3327\371\t\370Z\361\200\335\323J\313nUp\326\271\345\332\261\355\223\274\004\264_\252\032\022.\260d\250\320\354\256$\270\207s\253\272"
+	.string	"\347\026\005r\360\021\364\217r\203\224\033SXz\004h\330]GS\270qS\267}`[\263=\022\f"
+	.ascii	"HUM<\035\312\\\b\220QeT\245u\027r\023\263v\202\261\007\355\032"
+	.ascii	"))\235k\222\001"
+	.text
+	.section	.gnu.lto_release.18.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`C"
+	.string	"-\b"
+	.string	"R\21788@o\323\001@\265\220\341\303\335\024\021\230\356\241\206Q g\211\335\300\202\324\024{\001gK\2667\241\242\320\350\377|\020\326\353\301\275\247\245\024\032\0062\034-\213\357FvJ\001\336B\332\306u\264-#"
+	.string	"\351t\270\f\312\270ozD\020\037}\360\200tz\242O\204\367u\234\234\235\234\350>\022\022D?\231\035xz!*\3019\251\274\352\336F\370\202F\005e\341\207` /\033g\354:\212\324\206\375j)\223\035/\030\254e\027\243\206f],\025\017\333\241}\331\235\223\206G\373$/\t_)\036\260kBI\331\255\t\3268\267\\9\266}\221\217\204\366JU;J\n,\027'\231\335\225\003\3076\267\252\013lnQ\034\017\037C\377&/8\305\220J\243G"
+	.string	"\206\335u$\2252n\352\266\rlo\266?\002\f"
+	.ascii	"HUM<\035\312\\\b\220QeT\245u\027r\023\263v\202\261\007\355\032"
+	.ascii	"))\235k\222\001"
+	.text
+	.section	.gnu.lto_clearScreen.19.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\325\b"
+	.string	"\246\320=8@\217\322\001@\265:\314\224g$\203>4,\377\223\372\016\302Gt\267\215?\032dec\2677\241\242\260\337?.\221~,-\177\226\361\232\022\350\260S\374>j\204\354\235R,"
+	.string	"-"
+	.string	","
+	.string	"\013-\030&.\273+9\337d\236a\037\310<\213\035\377\016?\377%7`\261\244T\247C\200\206\3355L\2514\356x\333\007\266;\333\254\03110\253\222\241\200\330\376l\315\356|8\034\332\0379\311\367jq\201\335U\353d\267*\230\323<s\325\330\366C.\362\331.\254z\250\002R\253{;\341\f\033\027\021\345\247`\3206U\300\247\314A\305\223\377\332\270V\026\276\330\365\004#\207}lw\327qe\307\200\027Ak7\356D\\\027\352p\335VP\242\363A3h\013y\323c\212\360(\204\247D'\311\364\221 y\243\220\234#I1\372LH\020\365\344\206\340I\022QY\232\223\006\f"
+	.ascii	"HUM<\035\312\\\b\310\224`t\316\006TD\227k\336\t&\036\3345R\255"
+	.ascii	"t\204I\006"
+	.text
+	.section	.gnu.lto_drawScreen.20.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"\335\b"
+	.string	"f\220=9@\217\322\001@\221\260\214_\370\327\323y\232\f\330\212x\035\311\321Xn(m4\310\312\306noBEa\277\177\\\"\375XZ\376,\3435%\320!b\013j\250\021\262wJ\001+"
+	.string	","
+	.string	"-"
+	.string	"0\030&\257\335\225\236w6\317\260\017l\236E\217\177\207\237\377\222\033\270^V\254\324!@\303\356\032\256X\032w\274\355\003\333\235\355\2234\333\222\251\200\330\376l\315\376l8\034\332\0379\311\367jq\201\335\026J\312nU0\307y\346\312\261\355\207\\\344\263W\260\372\301Z\bTjuo'\234\201\343\"\252\374\027\006mT\005\374\312\036UL\3712\235\030\227\2053vM\301\330a\037\333\330\262c"
+	.string	"\013\201k7\243&\356H\\7\372p\335Vp\242\363A\263h\033y\023\204\212\360(\004\350D\247\t\025\2220y\245\221\234%IQ\nMH\021\365\344\206\340i\"Qy\2323\r"
+	.ascii	"HUM<\035\312\\\b\310\224`t\316\006TDw\r7\261h'\230xp\327H\265"
+	.ascii	"\322\021&\031"
+	.text
+	.section	.gnu.lto_screenSize.21.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\221"
+	.string	"\005\n"
+	.string	"F\223E90\221\322\001\217\250\245\200\226\243\347&Z:0\211\303\261Y<\210\302;\370\317\375\037\265\f\243A\346<\346\274\355\265:p\021J\340R\326\253\264B\305\b\177\336F\b!R\312\0244"
+	.string	"3"
+	.string	"3"
+	.string	"$\341/\323D\220\027\302\330B\231u\267\354\250"
+	.string	"\247\233\246\001\234n\374\241\241nx\325\023\335`\033-\256\227J\267S\350\356\257\353\205\241g\375\357\371\357\375\247\t{\336\375\356^7\234\006\314\200J\367\3058\323/\033K\310\377\360\347\374\006\263\005\335_K\324$T\261B\001\272c.+\335b\301A\033\335.n\376_G4\2543w\254\255\232\325\216_Vf\326d\026\"\254\035%\226\225c\377\t\212U\227rB\007\213U\347`\233\222\021\323+\363\213\252e\217_\265\346\330\317\373n\003\367J \217t"
+	.string	"\362>\004\250o2p>\372\220\300\031J9\200_C\b\365\315SJ\364p\002M$9M2\302$\202\220\243\017\224\037\317\347\251\364I\324\234\237\344\210\255\177\307\235\025\007\017"
+	.ascii	"HUM<\035\312\\\b\310\002\007#\240E\315E\320\304\260\322\246\013"
+	.ascii	"\343Kf\344\005c\0044a\244\244\230\256I\006"
+	.text
+	.section	.gnu.lto_writeString.22.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`'\001\365\f"
+	.string	"\006XWB\020q\224\016\203\306"
+	.string	""
+	.string	"\0052\3468f\221h\217?p\354\033f\362\364\255U\2306P\264\233G\r9\276\363!\220\271\256\216z\355w\210 \002"
+	.string	"\255\321\322F'\303\212\223\004\372B\352Y\220\266\311\2262\245A"
+	.string	"M"
+	.string	":"
+	.string	"\333\031\360\346\272\345\356\262\355\233\370\t\316\226\361:\017)\214\311\302i\305\216\335\305D>"
+	.string	"\336z\027"
+	.string	"oi\207sO\316?\213\277\022\030f\240R\245'\006\301\356:Q\251\013\267\336\366\210\355\023\373\025\002#n\204\350\330UyqY\033\026\f\020\2669;c\223\324h\201@C\024\203\363V\021B@\226\202\212\017\013Z\260\240\034dM9TB*\216\246]\262\341\256B\261\356fp\371\\\267HHp\236\366Q<\005\367n\302\003\354\256\270x\261\001zi\252\252\035\037\344Q\0269i\311P\325\322|z\375\251GJ\276\030\206\310\225\006\034\233<\354\256\224\312\301\376[]\261\277\372\257\253~x\226\337z\313\377`Za:5}"
+	.string	"0\331\266u\236v\322%\334\236\320\306\003*\331x4\004\266,&\310\370\243\001i\321\204\304@\313\024\230lY\034\221:\rF\232\b\204E\021\346@\3249\301>\231\206iF\034G\241\f\333b\314\260L\267\267\013\374\300\206\0245\031\212\370\310\007\032"
+	.ascii	"HUM<\035\312\\\b\310\3500\252\020\032\006\317uy\177Ex\327\360"
+	.ascii	"c\331\200|\0238(\374\35220\002\302\340Ba0\f\004\001\n\203a\200"
+	.ascii	"\n\266B\r\001'\236T+&a\222\001"
+	.text
+	.section	.gnu.lto_writeChar.23.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`B\001m\r"
+	.string	"\226\031[C\020q\224\016s\212\001"
+	.string	"\311\216\340s\2108\034C\0301y\020@\344\017\024\304\013Y\333\204>o\374\310\361\235O\244\227L\030\365\332\357\020A\004"
+	.string	"\224T\241\253)\031\005\312\362=\267\244\025\"d\357-eJ\001F"
+	.string	"O"
+	.string	">"
+	.string	""
+	.string	"vMZX\354v\006\334\271\016\335]\266}\023?\301\331.^'be\2418\244R\334\330]Ls\001\361\360=@<\324\020\347\236\234\377\025\177%4\300P\255NO+\301\356:U+\f\267\336\366\207\355\021\373\037\002/d\f\260\261{\341E\307\306\200.$ls6\306\346l`\211\3202\312p\225\253\340\276\"!3[\0015\202\301u\230I\216*\205\344\231E\321\260 \272\0169\247\020M\033\244\303\035\205\304\272\333\001\007\350:<P#\344i\037\305O\270w\024\036\372\324\316 \344U\326\244\364\344K\237\245\0325\241^\237\332Q\222/\216.\251r2c3\207\335\235RA\330\177\273\273V\023\373(\377\365\224\337\372\312\037\317\362\303\230~1\255\232NM\037\023\003\332\266y\036\350\246O\270?\242\316'\004\322\371l\blZ\246"
+	.string	"c\320&T\312DL\rJ\332\002\221M\313H&\217\003Ri\024\302\262\021\366`\344\031\301@Z\t\333|8#\2114l\3132\r\303t{\273\300\021x(Q\224c\013\217\274\246j\032"
+	.ascii	"HUM<\035\312\\\b\310\3760j\023\032\006\317\201\347\272\274\277"
+	.ascii	"\"\374p\315AX!\202j\340\n\230\203`\227p\025S\243p,\r\255\001"
+	.ascii	"\035\0035D\205\032\002N<\251VL\302$\003"
+	.text
+	.section	.gnu.lto_readChar.24.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\t\001u\f"
+	.string	"\226\227UB\020q\233\016\363p "
+	.string	"\214\2773"
+	.string	"\244\244a;\304s\207\003V\216\017A\202,v\351\361\346\321\373?c^#\341\372Os~\353\266"
+	.string	"P\001p4\001"
+	.string	"\006\302\235\352$\2508\275\273\341[7!R\246\024A"
+	.string	"J"
+	.string	":"
+	.string	"'%P\354\306\002\316,\257\034\037\300ze9"
+	.string	"\353\225m\213d!\213\0361\224\\$\r%\0213v#\246\027.z\212\374\2178\325\201\302\t\223\311\350y\031\330]\247\311d\302\255\267\rb\373c_AW\372\034V\f\026\003d\354\226\254\330\330\025\225\312\006\333!\033c\207\244\320\254Sg\302\243\242U)\016\004tl\204\020\031\022\220@\371\336\261$\027\022:Q\243\362\361\263\356V\240\261Y^\205p\3202\355{\370\207\320A@\270\307nj\3515\325\376\300\274\351\242\037%\035\231\322\324\253^\377\242t\203$Wl\301\310\223\212\026\2335\3548J\265`\237\332\335\265\236\330N_~\372\257\247\374\326\343O\035\345\327+\235\001\234\347i\250\355\337\037\334\233N\266\341\210d\233\f\001\217\203\0070\3362\234\016\216|\013:\016\301\210\307A\320\247a"
+	.string	"\352<\034\fz\260\006\036\315\007\333\270\016\313\200\030\202:\034\346A\310a\230\270\367E?H\224d\216\274\002\026"
+	.ascii	"HUM<\035\312\\\b\310:\206F\276\240Zi>\270\360\274\215\355\240"
+	.ascii	"P\250\313\300\b\b\203\013\205\3010\020\004(\f\206\001\215\234"
+	.ascii	"\204{\220PcL\327$\003"
+	.text
+	.section	.gnu.lto_isTransferInProgress.25.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`?"
+	.string	"]\b"
+	.string	"\302O;:@o\323\001\203\013H\326$\307{\231X\206xA\034\2161\370\005\276\tmIj\323\257\021gK\2667\241\242\320\350\377|\020\326\353\263f?3\264\350\216\020q/\243&vo\231\002\347B\033\327u6N+\bmu\310\016\322:\260zD\020\240}\360\204\266~\242O\304\007z\035\255\036\235\360>\022\024dA\252\035\274~!K\303Z-\315n\363xM\221\325G\305$\375\242Y\021\bI\255bZ\312\374w$\247\306\317\233\356\356\317\323/\027Z\005C\360\322]\252\231\351\224\225\342\361_\374\263_!\243A\312\237Q<\"2\t\005\003t\237\\P\272o\3027\016[\277<p\261\305\341\200\213\255\377\357l\342G\276\034%\214\204\2620Qu_:7xd9\236\271\204\r@TXZNL#\226\030Cw_^\2300\370\223\377#\374\347\376w\004\n"
+	.ascii	"HUM<\035\312\\\b\220\265\232\265\004\373,6\3215/\341!\314\353"
+	.ascii	"\232d"
+	.text
+	.section	.gnu.lto_updateGridSize.26.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\320"
+	.string	"\315\n"
+	.string	"\346\324J=\020Q\234\016\177Y,"
+	.string	"\360q\006F\3425\275~\007\020Vu\326x\fR\220\364Z\370\257\357d\024\243\312\202/\363Gx\022\001E\224\334\204.\276=\224#\212\301q;\202\260nB\244L)7"
+	.string	"6"
+	.string	":"
+	.string	"\373\031p\344q\312\337\003T\247\036\357\250N\271\263_\374\023\255\265\001\305\247D\214\335\205\332\341\335\263\363/\342\033\036\210\363\264\024\354\256\323\003U\270\365\266\t\330\306\354'\b\234T\016\366\247\335]k\310\376\350\2674=eZ5\235\231\376eah!\200\305.\205\322\214%Q*>\330\376e\303\322\202\247}\020\017\321}\2649\307nhE\212\r\223\332\331M\250N\027\275\220jcN\">v\027\201?B\213"
+	.string	"@\344\341\224\277\251N\335\203qMM\032\237\032\235,\271J[\302\204\274w\3454x\224\343<a\301\305\246\f\373\013\306,\021\254r \202A\006d\266\330\3402\005R\341\242Ds\3416\007\222\314\0265\315\344\201\306e\025\0303\b!\233` e\343 \244\200\243f\331`&\306\r^\337~Z\r\231A\006RG=\016\021"
+	.ascii	"HUM<\035\312\254\206\361b\370ZJ\360\013\024\016\234\200pP\f\024"
+	.ascii	"w\255\306(^\254N\227\261\277\325hp\227\027\355$\003"
+	.text
+	.section	.gnu.lto_resync.27.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\265\b"
+	.string	"\346P>9@\345&\035\200\206?7\307\302\316\220\236\336\254\031\200L\376\0048\374,]\006\243\033dn\276m\367\206v##f\305\201@\275,\350\363\314L9\313N8\\4b\t\331;\245+"
+	.string	"."
+	.string	"-"
+	.string	"\037\300\334\362g\267\274\202\354\325\221\2421\342\262\2732~\374;\374\374\243\036 \032\205\016/\206\3355\024\2158\356x\333\b\2667\333\246'\225\002\223\335\215"
+	.string	""
+	.string	"6e\241\204\330\276\375\372\331\230-Y\032\016\217\362K7}?Y\\`\227Tr\262[\025\254en\271\236"
+	.string	"s+\023X\335W\033I\016\250\324E\304p\005a\264A\025\360\"\033d\304\220\257\022$\021YY\370b\327\020\214\036\366\253\335]G\222\375\323\017\253+\336:\332\306-h[v\360\241\363\0013'\343\274\251\001Ex\024B\363\241\323\003\332Hx\274\216\223\263\223\024\335fBr\250'\263\004OO\207\312\317\234T\006\t"
+	.ascii	"HUM<\035\316\254\016\376\302b\214\214\225;A\227\211\340\316-"
+	.ascii	"\332\371\004"
+	.text
+	.section	.gnu.lto_heartbeat.28.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"E\b"
+	.string	"\222O98@o\323\001@\265:`\340\"\366\314@\376u\260\273\310[\216\247\364\034r\202\317^\300\331\332\355M\250(4\372?\037\204\365\372\254\375\215W\255h*+\275\255\237\032\331)\005\346B\033\327!l\234V \242\223!3H\353\300\351\0319\200\264\301#\242\363\033}\036>\320\353\344\364d\204\367\201\220 \nJ\255\343\371\205\250\024\315IeV\367\266\301\0230&\252\222\261\225X\222z\3318cWR\2542\354[[\241\354\210\261\270\f\244v+jh\266\345B\341\260\035\332\231-S\026\036\355\207\\$|\2258\300.\312\344d\267\036x\343\374r\345\330\366?\016\022\332*V\3358a\245\030\n\022\231\335\225\004\027\330\374\262\036\260\371Ui<|\f\375\217\334\362\270\2001\235H\217\230\302\356:\232N\026wu\333\035\333\234\355\216\f"
+	.ascii	"HUM<\035\312\\\b\220Uet\245M\027\306\0263q\2031\002\232xRRL\327"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_txBytesFree.29.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`Q"
+	.string	"\025\t"
+	.string	"\246P@<0\3456\035\300\360\374\007\246\302\203\221\230pxb\361>=\342\222\f\371a"
+	.string	"{\345\032f\272\017\341\276\005M\25044z_\035\030\032`\r\002\313@0\224\320\004\3358f\326\215\354-S."
+	.string	"."
+	.string	"0"
+	.string	"\033(\254\356K\021\330 c\354b\202\214\261\031\302\"K\361\314'\254@\022\300\364\242R\"\261\334@t\367%G\351\203?\371?\303\377\356\277*"
+	.string	"\272\005c\031\371?\372\265\237\246\"\244\374\331\204W#\276\030<\320}\202Y\351\276\r\3478\214\375r\376\237KX5\272x]\221R\200)&T\273\315W\317\323\377\013\214\3438\262\230\315T\013\22515\276\241q)Xy\264fZ\326\374\227$'\310\317W\317\323/\037P,\231\203\224\356\2161\357@\\\3479p\335\226\020\262UB\373g\363\302\332\021Q\204v\242\023\262\025\024y*\300\360\363h\375\350\305\347\261\240\037\033\322m\341\025\004Y\032\252\325\006\013"
+	.ascii	"HUM<\035\312\254\016\370v\260,\352\302\310\305\f\337`\214\200"
+	.ascii	"&\214\224\224\3275\311"
+	.text
+	.section	.gnu.lto_supportedTextAttributes.30.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\237"
+	.string	"}\n"
+	.string	"\346RH> \345*\035\340\331\344\220\200\031\201\fpL>g\221\020d\266\332-\327/\033\320\240>\316\267\230R@\211\205\017\370\311\025]!\020\002\340\323=@z\207VeH\021\027\320\026\362\t!d\313\0243"
+	.string	"8"
+	.string	"7"
+	.string	"!\017\200\374\375?H\\\275\344K{\005\200\004\300\260\325t_\332\211p\311\263<s\215\275\022\232\214\013\306\342\271a\350\356O\027,\306\357\370\277\347?\304\317`"
+	.string	"\372\345s\031\371\277:\327\336\241\037!\276e\330$\033\026[\306L\367E\340\357\245\220\306Bs\376l\302'+F\251(\020\350\213\024\215\226\356\233p1\344\357\227\t@\376\002\354u7\273\n+\310Z\235\305\347\255\003\344\230\013\262\326m\203K\220/;\310Z\023wNl\256\344bz\342\376\313\232]\310\317^w\367\273\331?9\0360\0064\335\257\\\226$G\336I'\221d\002\211\244\317\001ikC\347\245\217i\254\"U\304h\037D\244\255)\325H\"5\242L\264\242(\005j4AKv\244\037\317k\352d)Y\253\245\235\333\001\021"
+	.ascii	"HUM<\016M\277Zaw\030\314r 0 \005\210\213s\006\b\330\317Q+\327"
+	.ascii	"\3175/c\341pB2\023\225\031S;\311"
+	.text
+	.section	.gnu.lto_getFontMetadata.31.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\314\001M\021"
+	.string	"\366\341wH\340\320(\035rmI\212<\006\030\003\207J\2570uy\b\304{J\316IgB\025 z\261\2769\360\"{\355i\206m9\304\302we.\207+\342\n\004\361\2156\232\003Ckw\206\216\363l\037\347\320L>\331D\356\224\002`"
+	.string	"_"
+	.string	"g"
+	.ascii	"\003vg\202zv\307\006.y\237\036\017\322}z"
+	.string	"'\320}\332\366H\311\345\327\307\232\231(6\213\251\341\330\035A\r\361\327'\247\362\345\277\366\351#\342\206\214\006\373\3648\234\013\331\335\217\026\223\312-\260\305\020\372\240\301p 3\023\262\327.eh/R\212\"\354\256\245\214\246\341\356n\233\202\355\320\276P2\207=\302\244\322\330\347vw\2553\266\245\277\337\374\242)\255\322\0070\362\231\241`gwv\323\261?\323\347\304u~\333\345\327\374\221\204Hl\3738\317q]g\305[\024\022b\035l\273\031D>\215\342}r{\220\216\024D\242#K\001\001\013\2233\242\202\367I\372!\221\322>\213\333\270~\323\362J\002gG\006w\030\227\252\332\220#\200H\355SJ^&\325\203\247\305OLa\177\315\220\255G\225\306~uW\005\221S\003F\016\331C\336\305k*O\366\333\023t\366I\212\274\354\372\300CLa\226<6\334^\245\263\303\277P\361v\327\201\277\263b}"
+	.string	"\225\370\364[\272O\003@6\\\344\315\243\025#\025\222'\005\215\r\342\205\223\266\304p\302g\223T\311\0045R2!\0350\265L(S+\225\342\371DB\261\302\022\226\023\226h\241\244%\206+\026\023\312\212\245B\201\241\n\304\2402\245\200'\221\005\222\0208\\\245D\260\025\206\"\370\215{nu\306\222\023\271T\006W\225\261\375i\210\213\276x\205\333\375"
+	.string	"\301\206#oV\375\3641;\\\344\255\233J\363\034"
+	.ascii	" \363]\264\340\026\254e\331:*\273\026\326\350\220i\r\310\f\003"
+	.ascii	"+\004[\206Y\3674\315\330\272F\"D\340XaU\256\255\264\231\013\346"
+	.ascii	"\362\306\344\333\252\022kA\301e\240y\022:\307\b\227V5\271r!\313"
+	.ascii	"\232P"
+	.text
+	.section	.gnu.lto_writeFontCharacter.32.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\312"
+	.string	"\205\013"
+	.string	"\266\025P@\020O5\035\303\203FPd/\230\003DY\3031g0\022\250\312\276\024\001hY\222C\337\337\324\237GV=\331/\220\242RX\""
+	.string	""
+	.string	"\200\n\246\355\007\330)\260\303\201k\032\016\376\366c\333{\247\024:"
+	.string	"@"
+	.string	"<"
+	.string	"ef\333\317p\r\244-\242\226\026J\017\321i\264R\261\273\333\344\031\216c\365\030\216c\264\302\311O\322\177\353\365\302\251E*y>\037\006v\327\223T\222p\323\333\246\330\316\330\037\020/\026K\002\013\201\262M\332\021[[Y*\253\201\206dC\251\r_vL\303`\241\036\236\"\257r0%\033\002A8\220\035\223L\re\371\264\317\341\035\310\227\017~\261kr\201\330-\005\270\222\035s/0\341CA\206\240\310f\245\2476\203q\236\344\211\210z<\351\351G->\363e\210k~\030ab\347\n\273\364LJ\301~]j\262\317\372\353U\377\304\246\357\200\244(\001\340\304n\204b\246\243\242\347q\325\230\257\202\361\bT0\332\306\327i8\316\250\0013w\2327\206\227N\202QDp\341\210\341\246\303)\330\214\240\267\205\340\246\001\271\005['\216\233Fq\270\371\304\215\023\206\342\026)\367v\200\022"
+	.ascii	"]TA\231\f\001\231\026\214\002\251FV\304tM\254\333\202@M\350P"
+	.ascii	"x\023\206\003\341;5\n\216\345\251F\200\210'u\305\324N2"
+	.text
+	.section	.gnu.lto_isReady.33.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\330"
+	.string	"\025\f"
+	.string	"vWVA o\\8\317\300\021\226\222\264\217\201 7j\3209\350[6\220B\\\0313\3651\273\337\212\204\3367\366\261"
+	.string	"c\253\373K\216\375\337\317\t \005\213\310\020X\216\016N"
+	.string	"h\025\303\030\235\220\b\2212\245D"
+	.string	"@"
+	.string	"B"
+	.string	"\266=\270\217\305\217\033H4B:\210\210X\355\216\233j\270xKS\364A\267T\345D\n\325\t\251\344j}\204\254."
+	.string	" \211\254\216\025\021\025G=GH\241L\r\220\335u\216H\026\356\353\266\027\330\266\3307\020\232\301\276\265\273k5\331?\375X\372Y\203\322\252\005\002\325.\311\f\030\213\342*\301\301\366\307\346\260\265\022\005\231\366=\374\303\347'\n\017\260kBI\355\216\t\314e\277<~"
+	.string	"\366+\273"
+	.string	"\354\227\003\372\213X\352\210\355T\203T\320\220\265!#%KLm\ta~d\002\"\005\271\343$F\212U\251SI-b\327.\004\013Q\256\370J{\202'?\272~\224B\n\362Qg`\"\345Be\363\205=\2022\3564\\\227\361\340:\255\200\006\263\271t\302\215\227\031\243e\302\317\342y\020\202\016,\035\360\343x.\0208\241\227\331>o\333x\227\b\033\006\f7\355\200?\216\006\334:\337\007n\034\343^M\306V\2140!\221\007\361\243\236\030LP\002\016"
+	.ascii	"]\264`\034\030\366T\374m\330+\265\307+,\006\276\274\356\235\031"
+	.ascii	"V\351\202w\336\202\312\230\025\251\322\241\250UP"
+	.text
+	.section	.gnu.lto_beginTransaction.34.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\037\0025\021"
+	.string	"\226\337oF\360\222(\035\300ds$J\226\232\202\204\251\245jY\031\b\017\370\004\365\274\177*\nti\b\346\2602\037\350\005x]\274\252\247\211\231,ths\231Q\331\242h\036\241\230\351\301\373?\214\030i=,\371do)S\nX"
+	.string	"X"
+	.string	"^"
+	.string	",XoQ\341\003vitj\354~#\233l\217\376^@{\334N@{4\313\346\371W\263\037\030\r\030Y\220\335\345T\304Y\327\"\324d\371\037\024P\314\253u\255\303\343\005\013\tg\256\001^.(\332\335\313\2362\257\227\314\017\312\356:c^\033\356\317m\267\330>\331\271 \233=\366\327J\205\331\207\273\273V\032[\373\315\037\341c\267\302t\302\364A!\034\035\t|\354f(Bdw\"N\211\307~\373\22794\022rb\307V[K\303\206#\303\361c\367C\360\350\222G<'\371\335\005\3537\024\240\200u\205\030\361`{\024\301\021\217\223\247\375\025\017\"\227\266l@M\323\307.\372\214\253j\232:03#3\025Qa\276M\016\t\275\214gM\016\206<\214\253\312\304xf^v"
+	.string	"\263\024\252(.Pa\016Ff(rw[\2520\237D\273\222^\364p\345\020\377$Z\324\353\201\300xx\311\"\316\331\211\2574\016 \\\262\307!\0239\373\260#\236\n\325"
+	.ascii	"\344\251P\0354\251dBbQ`B*1PZ9\251\250\274\223i\363J\t\213\327"
+	.ascii	"\245\254Z\274\024\204\024U\252C\255T\"\240<\023\013\327\231\270"
+	.ascii	"\223IE\002\267\222\362\270\222\003\356P\245\024\247\352\272\024"
+	.ascii	"\027\372\366p\225\306\227\035d\223\223#jj\bU!\203\033;.\372\342"
+	.ascii	"OB\265\275\t\371\030\007, \240\202\251\300\3241\200\302j\026"
+	.ascii	",\225uCYa!,\032\301u\t&k\361 \003\233\013\226\333+\205\302E\302"
+	.ascii	"\275+U\372\034\346ha]<*\013\316\347>\337aaq\340}\3003\302\005"
+	.ascii	"\237\256g\315\252\242\024\212\247\340\036\307\024\236\3612|\327"
+	.ascii	"\250\217\361]\323BA\fHqg!3\312kl\227(\003"
+	.text
+	.section	.gnu.lto_commitTransaction.35.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`B"
+	.string	"}\b"
+	.string	"F\320<7PM\324\001\260&q80\372:N\250>aq\002b\211\341\235\365\216Z\334G\324\305n\352\262A;ii\371\253\212$\242\233\303\376\031\030"
+	.string	"\274N\340\223\177B\366\226)*"
+	.string	"/"
+	.string	"+"
+	.string	"\034}\374O\370\264hL\307D\242C\245\273m\255\340\221\351xf\016\316\224\034\222)&\241\273OK\016\005\277\362\377\202\377\326\177\214uB\031\241J\272'ZX\372\023\205\\\374\347\351\327| 0\3759\2035F\336\200`\200n\323\003\322}j^I\034\375d\201\013G\022\007\\\002\341\275\237\235\316f\250\253y\205\224OD\335\034\242\277\370@\271\374\300\246\222\237<\324C\204\244\351\312\177\222\264v~\206\272\273_\315?\307\266\n\323\016*\214\"\330\262\356\n\301\216\223\236Q\032x-\221\001\374\026\254\360\273\236x5x \247\331\313\331\216\273\034l\366\201\2262\370\365\266\317\006\t"
+	.ascii	"]TA\031\326\270\2678\334\032+b\322e\220o5\032\334\345E;\311"
+	.text
+	.section	.gnu.lto_setStrokeColor.37.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\301\001\025\017"
+	.string	"\326\233cD"
+	.string	"\257(\035\034#\260\t@\201\331\004\300\013\253\2632\302oA\240\202\204q\350\375|(?\255\375\332\377\342\202\245F\260\216{p\376[\237\365\377\355O\227\270#\274a\373\031\004\244\357d\240\273o\242\311&R\246\024L"
+	.string	"O"
+	.string	"Q"
+	.string	"'\260[\362\222b\027\3748\244=\032\274\201\354Q{\201\354\321)[\346\340\207\3058!\271\360j\261\273\233\236<uL3\345\277\345"
+	.string	"\\\237\352\330\346\333p\345|,\314\263\273\235\257\225\211\321`w\235\256O\303\035o\333\201\355\bvn\00243\217\236U\326\270\203\222.#Xl\326\330 +\325\304>\266\273k-\261\261t\324\264\236\345\317\254\243\262\202\001\314n\206\320\305\306D\025!l\237c\1778\210\022\374J\352,\"\330\200my"
+	.string	"q\322\036=\330\347\023=\355\243<%u\225\n\001\366\264T\365\267|\343\222\022\263\312\032\024'0\0236\210-\223\256M\360\370|\221\273\253R5q>#S\325\227V\322X@\030\206\3413\262TU\247\205\016\254\f\235\372\322T#Z\211\023\222\231]P\301G\204(\363/\037\374\n\310YD>\242\301\274\002\035\267\301\225\242I\247\020\311\264 D\002\035\360F\024:F\242"
+	.ascii	".\201L\036\247\021\"\301\353 h|t\234G\310h\303\303C\2316\016"
+	.ascii	"\265u\240F\034[\251\3636\020\002s\036\247n\373\340\270n\343\200"
+	.ascii	"\253k\252\261\3649\262\250\030\036\220\210Y)\313ZF\265'xyW\""
+	.ascii	" p\202\241\272\361\001\352\325\020\3530`!@V,\373!Y\273\306\034"
+	.ascii	"\213;\274\021p\237\355\262\334\317L\334XLkK\303\2050\021\243"
+	.ascii	"\004\344\370\320\236\220\275\223T/$q\346\353\303?\240\371\030"
+	.ascii	"\206\357<\3321\276jZ$9v\362\327\336'`2"
+	.text
+	.section	.gnu.lto_setFillColor.38.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\301\001\035\017"
+	.string	"\326\333cE\020\217(\035\f\376f\324\235s\214\216Wv\373`\314\320\b^\204\202\200\037&\036\001\270U\371G\326\366\352\321r(BhD\264:h\177\023"
+	.string	"\250\b\n\246\260\\\205\026[V\244\312\347\336\340jN\020\331D\312\224\002L"
+	.string	"O"
+	.string	"Q"
+	.string	"'\260{\362\222b\027\354\360g{4x\003\332\343\366\002\332\243Q\266\314\301\017\253\361J\271"
+	.string	"\203\261\273\234\276\216z\246\211\362\317r"
+	.string	"-W\352\231\306\265\341\272q\255\262\316\356r\\\254L\215\006\273\353l\2714\334\361\266\035\330\216`\247&1f\036;\252\214\231\263\"[\\^l\306lp\225\212b?\333\335\265\236\330Y:jZ\277\362\247\306a\341\202\201\313n\206P\306\306D\025 l\177cs\304@\t^\005\365\225\222l\300\262<t(m\217\235\214c\006\364\264/\342#P'Q!\356\2604\365\263\\\323\362\022\243\312\030\212\023\231\t{\304\226\311\326&x|\316\310\335M\251\2428\277\241\251*\f+cX@\030\206\3417\264TU\247\005\016\253\f\235\n\333R&[\211W\312\314.\250\240#\004(\3630\037\274\312\310WJn\262\265\200\005^\367\321\215\242E\245\217\210\264\340#\362\034\370B\024BB\240"
+	.ascii	"\036yH_\347A\"\341\363 x\210x\335\211$\364q\372L$\2563q!\246"
+	.ascii	"\020\b7\362>\316\203\300\335\251\344q\"]\347q\033PuMu\226>\210"
+	.ascii	"\026\025\303\003\230\030\225\256\274eT{\302\227o\005\" p\202"
+	.ascii	"\241\272\361\001\352\325\020\3530`!@V,\373!Y\273\306\034\213"
+	.ascii	";\274\021p\237\355\262\334\317L\334XLkK\303\2050\021\243\004"
+	.ascii	"\344\370\320\236\220\275\223T/$q\346\353\303?\240\371\030\206"
+	.ascii	"\357<\3321\276jZ$9v\362\327\336'`2"
+	.text
+	.section	.gnu.lto_setStrokeAndFillColor.39.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\301\001\035\017"
+	.string	"\326\333cE\020\217(\035\214\326b\t\b\240\3533A\013d8~ \"xl(H\332\322\030\310\270\237\275O\326\366\352\321r(BhD\264:h\177\023"
+	.string	"\250\b\n\246\022~\211\215\023#-@C\327a}'\210l\"eJ\001L"
+	.string	"O"
+	.string	"Q"
+	.string	"'\260{\362\002\305.\330\341\317\366h\360\006\264\307\355\005\264G\243l\230\203\036V\343\225r\001&\263\273\234\276\216z\246\211\362\317r"
+	.string	"-W\352\231\306\265\341\272q\255\262\316\356r\\\254L\215\006\273\353l\2714\334\361\266\035\330\216`\247&31\217\035U\306\314\221\311\026\030.6c6\270JE\261\237\355\356ZO\354,\0355\255_\371S\343\314\264`\340\262\233!\224\261/1\305\007\333\337\330\034*@\t^\005\365\225\222l\300\262:\244\224\266\307N\306\341\002z\332\017q\021\250\217\250\020\356\2604\365\263\\\323\022\343E\225\261\023&\262\022\366\210\r\223\255M\360\370\234\221\273\233REq~CS\325\025\254\234\261\2000\f\303oh\251\252N\013\034V\031:\025\266\245L6\022\257\224\230]PA\007\bP\346a>x\225\221\257\224\334dc\001\013^\367\321\215\242E\245\217\210\264\340#\362\034\370B\024BB\240"
+	.ascii	"\036yH_\347A\"\341\363 x\210x\335\211$\364q\372L$\2563q!\246"
+	.ascii	"\020\b7\362>\316\203\300\335\251\344q\"]\347q\033PuMu\226>\210"
+	.ascii	"\026\025\303\203\330\213JW\3362\252=\341\313\267\002\" p\202"
+	.ascii	"\241\272\361\001\352\325\020\3530`!@V,\373!Y\273\306\034\213"
+	.ascii	";\274\021p\237\355\262\334\317L\334XLkK\303\2050\021\243\004"
+	.ascii	"\344\370\320\236\220\275\223T/$q\346\353\303?\240\371\030\206"
+	.ascii	"\357<\3321\276jZ$9v\362\327\336'`2"
+	.text
+	.section	.gnu.lto_setColorInversion.40.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\203"
+	.string	"=\n"
+	.string	"\226SIA\020\307j:\007\327&P\002/\362\262@9x\206S\300k\331W\316\204O\210\004\254\006\013\021\255\355\353\353W\263\251\204\206I2$\"\231"
+	.string	"\004@\022\201ez\314\016WN\220I\031\005\331H\263{\247\0243"
+	.string	"8"
+	.string	"5"
+	.string	"\3335\327/\\\256mW\270\\si'x%Y\314KE\005@\301\356r\364\365\362\263\364\277\362\203\025\013\365\211\231\330]\317\025\353\343\246\267\375`[d\373@t\372\232\246U@\"\300\256\307\214\301\3124\002&\266\237\2617'\036:\355NW\276j\2742\264b\260\030\270]\333\224x>\355\303\216R>e\343\t\273.\004\003vk\204\273\\\246\356-K]\246\020\221\245(\207/\363\324\306\310\230_\271\241\203\242<\351\351U\rRsfM\310\024"
+	.string	"b`\347\002\273\242&\035\261o\331\3355u\331\257\377\f\037X\032A\323(\334\f\002;\320\327\351@\034\007\3223\215<\017\202C\234\217\024?'\013r\254\370\224F\221t\362.Hd\370qb\310\215BO\304\205F\222\343@X$\201#W\022\3051\013"
+	.ascii	"JUC<\035\312\254^\277\305\306\255\267\"|]\243\304\302\b\020\352"
+	.ascii	"6\270\226\027\302$\003"
+	.text
+	.section	.gnu.lto_setPixel.41.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\030\002\245\020"
+	.string	"&_mE"
+	.string	"\317&\035\234\206\376|\227\323 \216\"\361\350E#\032\312\374\203\374}\301\242L\260\207\034\fc\234\331\242\030\020~\021\352I\241v\022Tw\227t\227\373\021\304G\030\370X\340\237\264\370e;\367t\267\266\267\224)\005U"
+	.string	"X"
+	.string	"Z"
+	.string	"\247\247}\231\233X\375\204\205\017\330m\201\345\354z\035\376\020=\332{\001\320\243\350\004@\217^\331<\367@l\350E\305\005\024=\273\233\351\313W\207\232+\3777\037\275:\225\303\214n\303\225\324\265\240iw\003t\256\314\020\203\335u\276:\rw\274\355\006\266O\354|\020!^l\306l\257\225\352b\037\356\356Z[\354\230\016\275\346\217\247\371!L\353m\376\024\225H\270X\360\355\262|?\273\023Y\300\330>\311\346\340pR\033U\211\024K\215u\240\200u}\300\020A\364\310\261rJ\3573\253\323X\307\243]\017>9\273\333a\022\321\243\tn\304\0026\255\250\312\177\363\f\330\210\035V\306V\300`\n\233\263y\362\265\b\036\2371rwUT]\234\327"
+	.string	"\251j\013W\372\270\364}\337w\rP\252\252s\245C+?\247\342\230\\\336v\nd`lt\304\2344\217\343{\237\341n\243\202\336v\377\201\311\221\351y4\2612\346\222\210\204\005\233f\242\211D\325+\334!$\037!#\t>B<\fp(\n'\250\023"
+	.ascii	"\213x\214p\032\210\252\204\333 \200\244l\032\212\ne\202\302\245"
+	.ascii	"F2-\225\235\244P\0222\221\215\313<\016XC!\331\262\024M\3332\222"
+	.ascii	"\307:\\m\2615\3250\375\022PH38\210\331ai\313\243\fiT\250\266"
+	.ascii	"6!\377\n' p\202!B\362\030J\325\020\3430\370\325\307\264k\212"
+	.ascii	";\256\333\331*\035\017\fn/\200\355\365\262\020\267\213\303\206"
+	.ascii	"\252\341b\030\013Q\fr|h?\321\336\320\212\037\274\261\206\311"
+	.ascii	"a\233k\3616ulA\205C\227\271\031!\\\315\031\035\0361<\301W\255"
+	.ascii	"\210$G\237\374\265\367\t\230\f"
+	.text
+	.section	.gnu.lto_setPixelToStrokeColor.42.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\235\n"
+	.string	"\246\023JA \307*\035"
+	.string	"\213\f\310\321\305\341Q\006\361\3559\241iMD\"@\204A\217\254\t\377\013t5Z\364\212\344Z\f\240\032\\\262m\211\002l"
+	.string	"\260\013\210\251\031\242\252\005(\310\021\007>\"\264\311\336)\0053"
+	.string	"9"
+	.string	"6"
+	.string	"\335\253\3137`^\2733`^M\332\b^\242l\006&`d\246`w=\n;\371I\372\237\375\200\345Z}f&v\327\223\345\"\271\351m?\330\276\260\237\020\f\366Vk)\266\257\261;\006d%\026\335kg@h\226w!\037\263\215S\330\020\223\026mw=6u\257\034\256\003 \364i_\345+\344Y<\276\260\373:@\333-=\006\005K_\246\260\335>(\210\353\244tR\233c\234g\231#BW\336\324\346KK\201\235\013\354r5\351\211}nw\327\364e_\366\323\307\376Y7\001\bH$\330m5\b\343;\356\221\t4*E\200F\037\007\361\333@}!\004\223>%\021\024\215\030bX!R\205`j\3742R\342\251\344\201'\017u\3724<R(z\037\b\203)S\350\251@0\3644\345\236\013\020"
+	.ascii	"JUC<\035\312\254\226\240\213\303-\267\"\274]\243\034\314x\300"
+	.ascii	"\b\310w\250\341\201\030\340\004\237j\005\234\344\3055\311"
+	.text
+	.section	.gnu.lto_setPixelToFillColor.43.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\255\n"
+	.string	"\246\223JB\020\347*\035"
+	.string	"\327\206\274\272\367\034\001\257\234\311\310\225\357Zp\035\212\bNuC\004J\r\266\b\366\037\247\343\241\026\005\250V\220\377\237!\002\024`\031\004\311\324\030+\026\034\220@s\0347?\332d\357\224\0023"
+	.string	"9"
+	.string	"7"
+	.string	"\335\253\3137l^\2733l^M\332\005^\252,GF`\244\246`w=*;\371I\372\257\375\340\005s}r&v\327\363\0053\271\351m?\330\276\260\237\020\f\366ViXl\277c\203bh'\026\335+\250\2054\313\313\220\237\271\206S\330\020\024\022\333\356\206\234\352^?\034h\205\364i\337\345/\344a<\276\260\033\033`\333-C\036\005Kc\246Hp\373\240 \256\223\322Im\216q\376\345\217\bu\331s`\316"
+	.string	"\020\260s\201]\272&M\261\317\355\356\232\306\354\323~\372\331?\253\007A"
+	.string	"\t\003\273%\r\002\343;nSjdBE\214L\"\007\361\333X}$\004\237D(\021,\215\030bXQj\205 k\3742X\242\n\345\201*o\245\3724\274S(z\"\b\203\254T\350\265@0\364:\345\236\013\020"
+	.ascii	"JUC<\035\312\254\226\240\213\303-\267\"\274]\243\034\314x\300"
+	.ascii	"\b\310w\250\341\201\030\340\004\237j\005\234\344\3055\311"
+	.text
+	.section	.gnu.lto_setStrokeWidth.44.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\265\t"
+	.string	"&\322C:0\257\322\001#\251\231b\227{\306\211\301J\243\245\324Xb\305\260\030\361\215\322\213}\334E\232\206"
+	.string	"T\353*\332\222`\246\2008/\210o\370\232\220?\320\202\261l~\264\311\336)\005/"
+	.string	"4"
+	.string	"1"
+	.string	"\007\233\323\356\006\233S\213v\314\307\220\345\320n\030(2\273['\355\342\245\350\377\344"
+	.string	"1\331\353\222\363\260\273\2261Y\307=o;\3016\312\366K\273Q3\2636\272\"b\373\035\373\343!\222\343M\304\327\026\270\201\205}h\234\272S\017\367\311\020]\332\0379\211\370\222\212\023\354\316XTvG\006\207\272S\217\017\343\236\33393\204\314f1/L\245\234v\313%\037\263\0076_\026\240\221)7\227\2257{|\311\tb\237\333\335\365\234\331\257\375\222+\340hq\200\331\255\233t\n\221L\r!\022\b!\364(T\236(\300%\220)\374F\256\210\020D\215X\340\267ry\022\2530e\252_\252\252R\336D-\201a\005)\370[\235\300\312\372>\260v\002\016"
+	.ascii	"JUC<\035\312\254V\277\305\343\326X\0213\256\241\3150\033\b\337"
+	.ascii	"\251Qp\214O5\rN\362\342\232d"
+	.text
+	.section	.gnu.lto_setLineOutlineType.45.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\205"
+	.string	"%\n"
+	.string	"\306RG> \3458\035"
+	.string	",D\002\200w\027\t"
+	.string	"t\025m\323\006@\240u\3064N\371\007\252\326>\020{`c\020\005\261\232\212 l\027r\005\224E@\203^\234h\325\007p\307\023@\005>i{\247\0241"
+	.string	"7"
+	.string	"3"
+	.string	"\347\0176\337:7\330|si\323\374,Y\216\211\271\341\002`w\271J\362\362\264\364\337r\001\323\305:\3454\354\256\251\351\352\270\353m'\330\016m\317\0041\0160\273\034\003\004\254l\213\235\330\276\307\016\325\220\350y\226\362\260\013\215`[\"(^\347\033H\013\315H\247\366S\256R~\005\343\005\273\257\331\313\356\271\340Q\347\233\003+\020\0249\317\271\327\266\276\374\020\"\313\250\032\336(\255\266\005Io\032\324\252,\177>h\314Cfi"
+	.string	"\373d\321:b_\333\335u}\331\207\375T\373\200\004^HBx\252/\265\242"
+	.string	"=6y#\023\212ad\022!\214]\205\252#\r\370$B\215`\211\224\030\305\210\322J\004C\262K\205\343\207\342\300\217S}\335\004w\022GN\244`0\364D.\016"
+	.ascii	"JUC<\035\312\254V\277\305\343\326X\0213\256\241\3150\033\b\337"
+	.ascii	"\251Qp\214O5\rN\362\342\232d"
+	.text
+	.section	.gnu.lto_setLineOutlineColor.46.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"-\n"
+	.string	"\326\222G? \345*\035"
+	.string	",\004XbB\301#\021lW\206\325\240\266\006\303\343\242G\024\341\020\037c\216\206=\2500\013+Vz\f\245\021vA\bc\201\001+&\034%\325%0\342!\355\0255B\366N)2"
+	.string	"8"
+	.string	"3"
+	.string	".\257\2209\267yB\346\234I{\300\313\222\325\230\204x\314\b\354nGIN~\222\376[N\320r\255>5\020\273\353\331r\201\334\364\266\031l[\330\016\020\035XL\004\314\356\307\001\003[\343h(\266\317\261?/\336,\317B^\246\261\035,K\344\004\334\234\363l\237\231\367i\037\366\030\371\225\215#\354\276\004\270\354\226\016\016m\316\005\240\330\245j\025;N\271\337\226\276,\021\253q\320\016ssR;C5\337\262\207EW\356\250LZ\n\200\235\005\354r5\351\210\375mw\327\364e_\366\317-b5U\017<\205\246\324E-\360\b\f\215J\017\241\021ha\3740N\237g`\022\2504V\221\212b\024'D)\261\242T\237\t5\206\245\256\206\335)\374*:\2228v\240\006WT\016"
+	.ascii	"JUC<\035\312\254V\277\305\343\326X\0213\256\241\3150\033\b\337"
+	.ascii	"\251Qp\214O5\rN\362\342\232d"
+	.text
+	.section	.gnu.lto_clipToRect.47.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\265\013"
+	.string	"\266\225O@ M&\035\340$"
+	.string	"\200c\031;\320\037\312j\200\002\007"
+	.string	"\241\217\341\001\nF'\206\356[\033\232\305\231\021\302\211G\261\2336\334`\021\b\203\004\b\214\260\005G\353\225\251\325\237[\363\n\372\233\354\235R9"
+	.string	"@"
+	.string	":"
+	.string	"!b\273e\305\027\356\325\3453\034\257\3341\034\257&m\023/U\373X\251J\035N\354nG1\234\374$\375{8\304t\"}>\004\354\256\247\3514\341\246\267\275a\373c\277@)jK\2532\226\355Gl\n\013\266\362\244^\024\276\n.\3176\213}p!\302\001\356\225r\302\314\362\034\310\267<3d\327B-\266\273\025w\270\327\311F\201\200\371\264\237\341\032\310o`\360\213]T#h\r\250\003\327Y\351F)\235\324\036\215\363&OJ\224d\t\210)\233\225\330\211\302.I\223\246\354o\273\273\246(\373\260\277\376\365ow\375\364\255\177>$\"H\f\370\260+!\b>\372\370\005\267\246s\321p\002\\4\026\r\321S"
+	.string	"\3620\025\336X8\"\230\031=bh #\n\301\320\350}B\342\307\351\300\257\003}^\202n\023\212\235\005\200\301P'\354D \030v\221r\277-E\231@\027"
+	.string	"JUC<\035\312\254\006\243\213\203[oExt\rx4C\201a \013\230\003\201\001# \037\030\006\202"
+	.ascii	"\346\f5<\020\003\234\340S\255\200\223\274\270&\031"
+	.text
+	.section	.gnu.lto_clearRect.48.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\275\013"
+	.string	"\266\325O@"
+	.string	"O6\035@\023't\002\0226>u\017H\265\017\2419T};\2542\320/\362\234z\f\026b"
+	.string	"l0-\200\n\213i\204\262\351u\017\250b\027\b\214\207\027\360\250n\353\257IL\374\335\366N)9"
+	.string	"A"
+	.string	":"
+	.string	"$\\\273%\305\226\355\325\345\0054^\267\007h\274z\264S\274<\255\203\003\212\264\222\355.G7|\374\034\375\213\370\203,\215>\035\007v\327\223,Y\270\351m\023\260\355\261\257 /\\l\254\276P\266\017\261'*Z\247\016\n\326\005\257\204\3120-c)d \031l\257\223\021\227Y\036\304\370\224a~\354b\230\271v\227b\316\366*\321&\253\313\247\375\016\3670\376C\204\003\3305\005-b\022\350\004\327Y\251F)\235\324\026\211\363\244%$:r\204\305|\2558\261sf\227\243I5\330\327vwMM\366[\177=\353\327\256\372\351S\377tDd&\020\204\330\255\020\r.\272x\bw\206c\311l\fX2\225\001a\367\340\323]0\254\251l\302\017#vBp\001&\004~ \261\363\200Bo\303}\036\367\361:\007\234\006\f\271J\001\177 \016\310\205\276\017\344 \345^[jr\202\027"
+	.string	"JUC<\035\312\254\006\243\213\203[oExt\rx4C\201a \013\230\003\201\001# \037\030\006\202"
+	.ascii	"\346\f5<\020\003\234\340S\255\200\223\274\270&\031"
+	.text
+	.section	.gnu.lto_resetDrawingState.49.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\255\b"
+	.string	"&\220=:0\3456\035"
+	.string	"\360\347\262\310\330W\234F\203)\0366Y\b\222\217\256\217M\355\374\361U\021\020m\033\232\251ic\364\232\032\244TE\215R\254C\240\320\025\030\271\216\370\366\255\355\235R*"
+	.string	"."
+	.string	","
+	.string	"\267,\332.\037?6\003r\2728y\331]:=.^\212\376M\036@*\211.3\f\273kI*e\334\363\266\017ls\266G\002\363\332XiH\355b\244\002,\312J\021\261\375\215\235\020\302\271\264O\362\022\361\247\212\017\354\232ZPvG\005g\232[\036O\200\271\245\371\205\t\241Z?\272\031\367\325N\223\0358P\026s\344J\332!\205<\311\005\243)\362\245!UJ,+\001\330\243H\316\016\373\325\356\256\247\311\016\336>\331\306-d\033f"
+	.string	"j\023 \215#`\017\306\201\265\023B\200\337C'\364U/\324\"<\260\343h\355(\250\323$\250\347\003)\206\340\352}>\032\n"
+	.ascii	"JUC<\035\312\254\306\275\305\341\326X\021\223.\203|\253\321\340"
+	.ascii	"./\332I\006"
+	.text
+	.section	.gnu.lto_drawCharacter.50.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`<\001\305\r"
+	.string	"VZ^D q\223\016\263\036@\006P#\310q\360\021\345\360\376\310\360\343\373\242\334\034\"\022\302\344\201\r\032\262\250\332\250b\211P\023\f\315\335\314\330\007\213`q\n\270\320"
+	.string	"\245\f\347E\242\221\017\3653\"\215l\"eJ\001G"
+	.string	"R"
+	.string	"B"
+	.ascii	"5\266\247}\023?\361\035\205\204\013\330]\305\200\331\005G\334"
+	.ascii	"\301\036\r~\300\365\210}s=\372\263o\034\374\260\031\020.R*t\354"
+	.ascii	"\256\246\036\376="
+	.string	"?\377-\236\251VN\317\f\202\335u\252V,\334z\333\005l\237\330\317\020\231>\200\r\211\031\tr\354V\by\254\214\370B\204\355\177\330\"\0276\353\005\305F\t\366(2a\313\025g\361\335\305\224\232UA\205\030a\217\232\f[\034ciV\205\003\005\006\330c\b\216-\301\247\370\316\342\030g\273\033B\230\335\035\261\b{\004\261B\002\031\275\324>\361\362*\203\244\364dKS\237\3515\325#%C?<\312\245\232\2513\205\001\225\2417#\022\206\006\032\233;l\360\224\332\301\276\265\273k]\3311\235\275\345\317\234\345\277\356\362[\177\3715\323\031^\211\304Y]\003\220\232\036\341\376\210:\237\320\201\316\207C\300\363@0\361l\001\f\342\204<\216\304\344\300\353\026\220\224:\216d\362< y\243\220\306\2154\223\221\247D\003u\236\3061`\216$\352\264\022\307u\332\007\270\267VWVPBF\212\242\214\34555\030"
+	.string	"JUC<\035\312\254\006\245\213\211[/\006Ik\324\306J\233\204\013\307\250\r\323F\241\023.\023jb\b_\017\243p\331\023\206"
+	.ascii	"\346\f5<\020\003\234\340S\255\200\223\274\270&\031"
+	.text
+	.section	.gnu.lto_drawCharacterMask.51.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\260\002u\023"
+	.string	"F\244}F\360\316(\035\232\336m\31133\275p5 n\006\272"
+	.string	"\247\3637O\367\re\b\237\301z\277\265Ommcp.\\h?\351\360\275\226:Bs\320q\342\365\312fm\035\312\364\374\231$\031\b>\"\371d\023)S\ne"
+	.string	"f"
+	.string	"j"
+	.string	"]\307\3266\264\344v\367\303\253\357\261\324\2310\240\236\366e>#\373\210\t\027\260\373\362\223\333\305}8\344{4\356\003\274\307\357\036\336\243e6\320q\035V\344a\205\315&hwO\312\341\262w\2322\377:\327`\271\255\274\333\270]\270\216n\264\256\264\273"
+	.string	"n\265L\221\202\335u\262\334,\334\361\266\027\330V\261\363E\2510\366\273\335]\353\213\375\245I\242\364\3505\277\306i\376\3577\277\310K{\307\371\343s~\315tf\372\034\036<-\030\300\330\255\020\016\255O\344\211\261\375\221m\332A\305\234\024\230\0170\033T\207\243\362\323\372\036M\"PY\342&d\277\211e\307\326h X\337cG\306\324dx\360=\232`P\211;\t\331i\214\"\031\376:\337\350\331\361\231\245\220\212\024\335\t\273e\003%\313\032x|\312\310\335]Q\205q\336\344y\252,j\031\303\001\3020\fo\362\242z\352\244\240!j\256T\303\355-\201\216\317\201\217\020\250.\237k\341\366\366\241\230\234L\320ci\226B\036\351\3256c\226\241\037>\305S\035\251\323\346B\313\320\036\271\354\231q\261)d\343h\0010\024\027\330\275@\023P\025_\020T\032\273\204{d\0252B\202 d\004\204"
+	.ascii	",\025\341$\205\342\260\n\204\004\006\212\304J`/\007\"(/\320\025"
+	.ascii	"K\231\270`,\222\023\310:\235\260R\255\223\352\005;\201\0240\350"
+	.ascii	"Z\275N( \370:\215p\263kTw\351\257<\222\2664\350\361\231)\315"
+	.ascii	"\244\274\2224UC?\265Y%y\026w\353\242+\026i\352m3f\0014 \240\002"
+	.ascii	"\031\262\262\003\352\325\020\317ax!\220\325\224\375\221`\345"
+	.ascii	"\212M,\351z8\270z\361e\257\333BT;\223\330P4\\\020\246\206(%r"
+	.ascii	"<n\256\244!\022\313\352\257\030\272\350\026W\356Q\223\365e\346"
+	.ascii	"\03231#;\"\374a.\354\200\342a\b\256]5\367+D\303-|\275Q]\3660"
+	.ascii	"$sd6\232\330\201u\202\357\264\"\227\034t\362\245\275O0d"
+	.text
+	.section	.gnu.lto_drawString.52.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\037\001\035\r"
+	.string	"\306\330YC\020\221\223\016\343K\302\257\255\340\203\266\013\266\300?\374\240\200\001P\301'\312"
+	.string	"\210\234\fS\272G\210\240{uz\203X9\177\361\263F\271"
+	.string	"E\004(\032"
+	.string	"\222j\372\366=\236\212\023E\360\205\021K\366\2262\245C"
+	.string	"M"
+	.string	">"
+	.ascii	"\037\016\242{\b\t\007\260\213J\001\263\373\211\330c=\372{\200"
+	.ascii	"\352\321:\247ztg\317\370\267"
+	.string	"a5\034b\230H\334\330\335K5\274{v\376K|sZ\361\236\032\004\273\353<\255T\270\365\266\t\330\326\354{\001\231\376\206C\203E\202\027\273\024R3+\023Mx\260\375\016\333\200\207\301\227\023\030%60u)\t\370X\225\021\035D2Z\034\003?V\005\303\004\006\326c\210\013,\277\213\350\316\342\030ov/\314\300\354\256\210C\326#\b\fA\201=\355\007\225F\205j?\340\362'\203\230\324\263\245WS\016\224L\371\251\237T\251\226:M\026R2e\316\212<\241\242\305&\016\373\363R3\330\207\273\273V\224\035\323\326]\376\352-\177<\313\017\377\362g\034i\244A\356\245G\270?!\317\007t\300\363\351\f\3402\b&\031\346a\222\016\210\323FJ%\334\266`\204\264i\243R\326`\304\211@\227&\272LD\231\203\213d\343\256N\001k\243\320v\2214m\273:\276=\\EYA\r\031\024M\261\225\327\027"
+	.ascii	"JUC<\035\312\254.\244;\004\373\332Zk\254\210\t\270F,\3320a\024"
+	.ascii	"\n\3412\241#\204\020\006\024v\3030\020\0040g\250\341\201\030"
+	.ascii	"\340\004\237j\005\234\344\3055\311"
+	.text
+	.section	.gnu.lto_drawStringMask.53.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\223\002\345\022"
+	.string	"\006\343zG\340\360&\035\016\217\032o0?\031\211~Iz\363\222\214\200s\r\316!\232Y*PY\3521(\3611\333Q\005\353F\254k<f-\315\334E,\303\021\033h\002\001\334\347F\317\240\206k\365\177\201mN,\331{\313\224\002a"
+	.string	"e"
+	.string	"h"
+	.ascii	"\030~v\027\304*\356\023%=2xW\37367\001\373\t\013'\260+#\364\263"
+	.ascii	"\013\202X\204\3734\370\002\333'\367\216\355\3230\233\350\240"
+	.ascii	"\210-\321\030\275\250(\332\335.\2068\3542*\314\177\317\001\320"
+	.ascii	"j.\227\246\032\207\307SM&Q\273+\2406S-5\330]+\255\266\341\236"
+	.ascii	"\267\355\3006\213\255,\0023V\217lP\246q\306\276\334\335u\224"
+	.ascii	"\2619\365\251\2446]\347\347\236\363\227\216\363o\233z~\347\227"
+	.ascii	"\347\371U\325\337\350\250!\343A\214]\230\020i\207&P\215\355\237"
+	.ascii	"l\017\024\336\344a\231\241\231@\302\223;-0Nh\274\250\3632\300"
+	.ascii	"\261\263\024#V\037r`$p\237\036\035<\005\177\003;\216]H\216\235"
+	.ascii	"\201\b=7\005%\r\305\364\350E\013\t\344\024\233Hi\233\340\363"
+	.ascii	"\232\244\273\353\022\343\214\365\037\333\214Qh\246F\036\020\206"
+	.ascii	"a\370\217M\306\031\255\027<\310\350\203\232\201[c\260B\001H\t"
+	.ascii	"O\352}|\3607)\337i\221\340\326\216T\363cS\364\211\212\351\221"
+	.ascii	"M\361\361\245FLC?<\313\246\321\024\255/12\r\335\201\244A4\002"
+	.ascii	"\256\025\326'[\037\312W2]\177\275\302M\242\022!1Y B\022r\300"
+	.ascii	"\225\242\240\222\362\002\270$\304\304\365\215\274N\\\255\b#+"
+	.ascii	"\255\217\365J\241\260\\+\223\356[u*\253TJW\322ru!\b\374\261T"
+	.ascii	"\255n\345\373Z\335\t\214=\312h\251\276j;E\r\020\302\241X\224"
+	.ascii	"yC\037O\221\213\245\270E{u\242\247YnLt\261\357\363\0071 \240"
+	.ascii	"\202\031\262\352\001\352\325\020\317ax!\220}\224\375g\264bK\272"
+	.ascii	"\037\004\027/\276\337\353\260\020\303N$6*\003s\206\233)u\363"
+	.ascii	"\360\272r\213D.\026G\357\203\317\320J\314\0227\360\372\316\306"
+	.ascii	"\035\221\3740\027v@\3610\004\027\256\232\370\025\321\271Ba\250"
+	.ascii	"\260\313\260A0\267\314\006\023+0'\370\252\025\271\344\310\223"
+	.ascii	"/\355}\002%\003"
+	.text
+	.section	.gnu.lto_moveToPoint.54.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\315\n"
+	.string	"\026\324KC\020\311*\0358O#+;\bx7\367\2347"
+	.string	"\335\037\017\216\300*\270\337\272\330\030\261c\345=\271\201\320<h\031\241"
+	.string	"\325\344\222m\313P\036"
+	.string	""
+	.string	"\220\t K\b\013\322\220\210\254\321.\\\331\320&{\247\0245"
+	.string	":"
+	.string	"8"
+	.string	"\016q\257.\017\221y\345\376\220y5i?x\t`5\001LJd\021v\327\2431'?I\377\262oZ.\326\247\206bw=[\256\224\233\336\266\204\355\f\373\f\001\365\200"
+	.string	"\333\347\330\035\204\230i[\303\216\274\234`p\257\235\003\321,o\200<\3144ov](\314v\367\343\023\367\352\331\272\005\242O\373\003N\200|\001\220;\354\276\024\314v\313O\364\345\212\226Z\b\025q\235\224Nj{\214\363-{H(\313\235\225\211@\245\301N\tv\311\232\024\306\376\266\273k\372\262\037\373\351a\377\254\035\026\006\026\tvQ*L\330Z\343?n\322)D2M\204H\240\b\361\353H}\242\005\227@&\021\034\215\032bx1Z\205\240j\3746T\"\312\344\201(/\205\3728\274R(z\240\316\240\352\024z+\020\f=N\271\3376\017"
+	.ascii	"JUC<\035\312\254\226\240\213\303-\267\"\274]\243\034\314x\300"
+	.ascii	"\310\241&\006\002\203\023|\252\025p\222\027\327$\003"
+	.text
+	.section	.gnu.lto_strokeLineToPoint.55.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\245"
+	.string	"\245\n"
+	.string	"\246SJB \307*\035"
+	.string	"\213"
+	.string	"1!\261\035\370.\016\226\231\235\026\345~9\243H\260\346"
+	.string	"\205\032\316\007\272\032-zEr-\006P\r.\331\266D\245\f"
+	.string	"\360\003\340\003\310=\244\n\346\240\305\362\"\033\332d\357\224\0023"
+	.string	"9"
+	.string	"6"
+	.string	"\334\253\313;h^\2717h^M\332\013^\262\354\246\345dd\306`w=\272r\362\223\364?;B\313\305\372\334H\354\256g\313er\323\333\206\260}a_!\016\266V\013\270\330>\307\356\006\310P,\270\327\016&\232\345\005\220\217\331\300\266\260!)$\264\335\375\370\304\275z\266\356E\364i\037\300a\344\003x\234a\367\245\200\266[~\034\nK_\236\230\251}P\020\327I\351\2446\3078\337\262G\204\262\334\211\231\007`\022\354l`\227\254IU\354o\273\273\246/\373\262\237>\366\317\332\221A@A`\267\344A\343;n\322)D2E\204H\240\007\361\333H}\242\004\227@&\021\034\215\030bX1Z\205\240j\3742T\"\312\344\201(/\205\3724\274R(z\240\316\240\352\024z+\020\f=N\271\337\002\020"
+	.ascii	"JUC<\035\312\254\226\240\213\303-\267\"\274]\243\034\314x\300"
+	.ascii	"\b\310w\250\341\201\030\340\004\237j\005\234\344\3055\311"
+	.text
+	.section	.gnu.lto_strokeTriangle.56.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`P\001-\r"
+	.string	"\226\227WE\020o\234\016\200\r\020\002\304\347\251\037p\334\376\240\304\203\256\243\037\002X\375\376\035\311\233!\222\201)\301A\364\007\024\217\020,\274\322\246=\"\333\257\252:\350\004\030\340\257\232\030\373\007"
+	.string	"\375k"
+	.string	"<5\332d\313\224\002@"
+	.string	"L"
+	.string	"="
+	.string	"\017\001\341\001v]+Nv\307\215A\333\247\307\017\310>\267\013\310>-\332+\037AV\013\3110a\304\213\335\345$\207\213W\321\177\211[Z\037\254\253v`w\255\255\217\n\267\274m\003\2669\354\207\004W\013&\205E\002\022\273\0363d\254\3124\321\301\366/\266\006\203I\212\312\243\344\345`\373\324t\274<\240`\220\200l\254\214XX\260}f\\\204t\274\b\361\"F\201\001\330\016\r\024Nvwc\323\366I"
+	.string	"\313\244\b]\355\1778\b1\322e\004*T\"H\t\236\252\311LN\211I)U\332\017B}\313\330^\220,cP\024\345D\213\325\030\366\310R\271\301>\266\273k\351\262o\362k/\371\263\277\376y\222\037\373\310//\362\237P?+\365\204\352Yi'\324\316J=2\201F%\017h\304)"
+	.string	"v\034\250.\244a\022\247\004z\242p\003\374\024\210T\237\227\n;\006)\360T\342\274\023\207:u\r8\322\007r\034\215\275\224\351\343T\236\367q\227q\217m\037"
+	.ascii	"JUC<\035\312\254~\245\213\215[oE\270\340\032\347`\215\007\214"
+	.ascii	"\200|`\030\b\002\314\201\314\300\200\300\b\310\007\206\201 \300"
+	.ascii	"\034\310\f\214\200p\3000\220\305P\303\0031\300\t>\325\n8\311"
+	.ascii	"\213k\222\001"
+	.text
+	.section	.gnu.lto_fillTriangle.57.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`P\001=\r"
+	.string	"\306WXD"
+	.string	"q\234\016\277\"n\003j\274\022~\237N\225\326\264\252\332\016\274\306\366<\332\212\254\202\353\202\206^\007AGP8B6\240_\2647D\032>\375\177JPa\206\307\232\0176\007H\203\037\005yj\264\311\226)\005@"
+	.string	"M"
+	.string	">"
+	.string	"\037\221\360"
+	.string	"\273\257\027*\273\343\306\240\355\323\343\007d\237\333\005d\237\026m\031\037G\254\026\"bA\305\215\335\345\244\210\213W\321\377\212_\\ \255\253\226`w\255.\020\r\267\274m\003\266?\354\207\004\231\0320\026\264\354fh\311\261,\263E\t\333\307\330\2321\205\305\312\004\312\b\004\022'\")\017&\035P\033J\274\202\001\330\n 04\330>5\027B:>\205x\022\257\370\262\373a\207\312\356nl\332>\t`\007t\204\256\366O\034\205\030\nl\260L\220\024<U\223\231\234\022\223R\252\264#\204z\227\261\345 [\316\320P\0273b\254\342\260\307\226\312\020\366\261\335]\313\227\375\224_;\312\237\375\344\2377\371\261\227\374\362$\277^\002\237P?,\365\204\352ai'\324\016K=2\201F%\017h\304)"
+	.string	"v\037\251.\344a\022\247\004z\242\020\005~\fD\253\317S\205\235\003\025x*q\336\211K\235\272\007\034\351\0039\016\002{*\323\307\255<\357\3430\343\036[\371r\037"
+	.ascii	"JUC<\035\312\254~\245\213\215[oE\270\340\032\347`\215\007\214"
+	.ascii	"\200|`\030\b\002\314\201\314\300\b\b\007\f\003Y\300\034\b\f\030"
+	.ascii	"\001\371\3000\020\0040g\250\341\201\030\340\004\237j\005\234"
+	.ascii	"\344\3055\311"
+	.text
+	.section	.gnu.lto_fillStrokeTriangle.58.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`P\001\345\f"
+	.string	"V\327VD\020o\234\016\300\017P)\231b<\351\013\314*U\255\253\332i\021\204\344\234"
+	.string	"\023,\325\313x\350_\f\321\037P<B\260\360\340\233\370W\327!"
+	.string	"\300\222"
+	.string	"\203>6q\363\257\243\334@1@\237\032m\262eJ\001?"
+	.string	"K"
+	.string	"="
+	.string	"!\"<\300n\213\305kw\314\330\263}z\374\200\354s\273\200\354\323\242\335\342\243\207\325<B*\220\274\330]Nv\270x\025\375\217x\205\265\261\272j\bv\327\312\332\340\270\345m\033\260\255a\337#\"\277V.\030R(p\261{!%\306\242L\022\037\266o\2611+\\(R'N\\\017^& '\222\222\017&\020#\033\030l\237\230\217\217\216\027!^\304%0"
+	.string	"K\241\303\302kw3&m\237\0040L\307\347j\037\344!\342\003+[N\220\001E\202\234\340\251\232\314\344\224\230\224R\245\r!\324\263\214\255\006\271\362\205CM\244\250X\205a\217+\225\034\354c\273\273\226-\373\256_\373\311\237\335\344\237/\371\261\217\374\362\001\235P;*\345\204\312Q\351&\324\215J\035\"yB#\216'\244)"
+	.ascii	"v\032\247\356\223a\221f\004z\240\320\004~\013@\251\317C\205]"
+	.ascii	"\003\024X\032q^\211;\225:\007\234\350\0039\315\001{(\322\307"
+	.ascii	"\245<\357\343,\343\036\013  `\303\214\253\001\212\325\020\233"
+	.ascii	"C\351\325\257\271\330\314zC\341\202q\234\203\361\030\231o\230"
+	.ascii	" \346df$\034\303\262\230\023\230\021\371\206\t\302\234d6&6\260"
+	.ascii	"\236\340\243V`\222\027\227%\003"
+	.text
+	.section	.gnu.lto_strokeRect.59.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\325\013"
+	.string	"\366\025QA\020O&\035\200;\220\006\324}\002\353j\245\026\021\302p \2113\217\276k\b96}\332\217\210\276qv\004q\202m\212k\224\025\334\004"
+	.string	"\320\325uE\036\225\343H0\3224 \227\340\202\376&{\247\024;"
+	.string	"A"
+	.string	";"
+	.string	"\254\023\261\335\362\342\f\367\352\362\034\217W\356\033\217W\223\366\212\227\027\026\222\201DJ\004\213\335\355\250\205\223\237\244\377\021\217\250V\247O\210\200\335\365T\255 \334\364\266+\266E\3667\001;\253%4\330\276\304\2668\200a\bq\257\026\324+\302\327\302e\331\226\261\f(4(\300\275Vh\232Y>\004\371\226e\216\354N\250\305v\367b\020\367J\331**4\237\366=\374\003y\020\n\256\261\033\263\005\024\345:+\335(\245\223\332\246q^eJ\212\236<\3310MHH\261\323\205]\236&\255`\177\333\3355e\331\207\375\365\257\177\273\353\247o\375\0232\341\200bC\333}\360\242\026\006n\372\370\004w\007\224\351|\002d:\230\016\321C0\3624\030\366`>\"\310\031CbH\200S\nA\322\350\211H\342\367\351\300\257\033}\336\201\316\023\212\035\006\200A\022(\354J \030v\222r\277-ey@\207\026"
+	.ascii	"JUC<\035\312\254\006\243\213\203[oExt\rx4C\201a \0130\n\230\003"
+	.ascii	"\231\201\021\020.0g\250\341\201\030\340\004\237j\005\234\344"
+	.ascii	"\3055\311"
+	.text
+	.section	.gnu.lto_fillRect.60.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\325\013"
+	.string	"\266\225PB M5\035\320cpP\300\323\243`\237S\237\367\277&\274\220Q\006\263\023\202\264#0\247\237G4\255\323C#\330~}\306c\207C\020\002\301\275\002Q\234|\205\333\370'\322\232s\353\377\374\270\311\336)\005:"
+	.string	"A"
+	.string	":"
+	.string	" b\273\245\305\230\355\325\3457 \257\3335 \257&m\024/+l\304\002\tS\207\024\273\333Q\n'?I\377\036.9\241J\237\221\217\335\365<\241\036\334\364\2669\333 \373\001\002-X\354\254\212X\331\376\304\346>\300\"|8\274 |\027\\\226i\030\313 \325\200\300\366\312\2552\263\374\006\362-\313,\331\225\240\"\266\273\026{\266\327\212\306\2452\237\3663\\\003yV\202g\354\252\002!f\n\350\002\327Y\251F)\235\324&\215\363'WL\264d\nk\216\300`b\347\n\273,M:\301\276\266\273k\252\262\017\373\353_\277v\327O\337\372g\204\022+!\340\304\256\203\005N\372x\004\367\306\203\331t<0\233\013\207\350\035\by\231\013s.\035\021\324\214\0371\034\240\031\205\240h\364@\"\361\353t\340\327\205>\317@\307\t\305\356\322aP\344\t\273\021\b\206\335\244\334kKU\006\020\027"
+	.string	"JUC<\035\312\254\006\243\213\203[oExt\rx4C\201a \013\230\003\201\001# \037\030\006\202"
+	.ascii	"\346\f5<\020\003\234\340S\255\200\223\274\270&\031"
+	.text
+	.section	.gnu.lto_fillStrokeRect.61.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\325\013"
+	.string	"\206\225PC m\225\016\260\030"
+	.string	"H\br\305\243\316V\206\306\r\033\035\004\3248\211-C\304;SG\213\323\320,\215\245a"
+	.string	"\365/\232\304\2668\264\335+"
+	.string	"\356H\306\205\223\357\360\327j-(q\365\237\370\321&{\247\0249"
+	.string	"B"
+	.string	"9"
+	.string	"\263\3352\343\r\367\352\362\032\222W\356\031\222W\223\366\210\227\016v\362@\204\312B\211\335\355h\203\223\237\244\377\013\257X\265P\237\023\217\335\365\\\265\022\334\364\2661\266G\366A\002\254\024(\266V1D\260}\212\215A \203 \342^1\251\230\202\317\004\2145\302\275^Hpf\371\n\344_\316\260]\254\201\005\007f\273\233q\210{\265l\227\020\234O\373\022>\201<\005\002\307\330uu\b\264Z\001\232r\235\225n\224\322I\355\3238\277\262EEQ\256p\230\0326\200\330y\302.Q\2232\260\277\355\356\232\272\354\313\376\372\330\277\035\366\323\277\3769\251x\370\020B\333\r"
+	.string	"~\372\370\001\267'\264\361\200:6\036\315\206\350\t y\034\013\1774 \021\354\214\"1\024\351\230B\2604z\243\222\370\201:\360\353H\237\027\240\373\204b\247\3410X\n\205\235\t\004\303\216R\356\267\245.\177\004\027"
+	.ascii	"JUC<\035\312\254\006\243\213\203[oExt\rx4C\201a \0130\n\230\003"
+	.ascii	"\231\201\021\020\016\030\006\262\030jx \0068\301\247Z\001'yq"
+	.ascii	"M2"
+	.text
+	.section	.gnu.lto_strokeEllipseInRect.62.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\305\013"
+	.string	"F\225OC\020mL:l\023M\210\b\351'\030\206Z\202\002 J\20620T\215X\222\201\351\264\354'\017B\373\340\373\2078\3618\272\267[\326e\004"
+	.string	"@X\300\200%\274\203\243q\200\240T\315\022@\304\277\311\336)\0058"
+	.string	"@"
+	.string	"9"
+	.string	"\273\345\305\031\356\325\3451\"\257\334/\"\257&m\017/\035\254\204\025\342d\001\304\356v\264\301\311O\322\377\205O\240R\246OI\307\356z\242R\nnz\333\032\266C\366?\002\273\tJ\324\226V3\264l\177b[0\304 \200*\300X\337\203\327\202\020\356\325\322\322\314\362\024\310\273\254a\253\330\003*\004\262\335\275\370\303\275V6\213J\363i?\302%\220\237@\340\026\273\253\016\262\036$h\005\250\001\327Y\351F)\235\324.\215\363(WN\324d\212\2109\373\300a\347\b\2734M\312\300\376\266\273k\272\262\037\373\353a\377\366\327O\357\372\247\204R\333\260\231\005"
+	.string	"^\372\370\0017\347\223\341x82\034L\206\350\t\020y\032\nw0\036\021\334\214 1\004\331\220Bp4z\241\221\370y:\360\353D\237\027\240\353\204b\207\33108\372\204\035\t\004\303nR\356\267\245+\007\030"
+	.string	"JUC<\035\312\254\006\243\213\203[oExt\rx4C\201a \013\230\003\201\001# \037\030\006\202"
+	.ascii	"s \263\241&\006\002\203\023|\252\025p\222\027\327$\003"
+	.text
+	.section	.gnu.lto_fillEllipseInRect.63.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\315\013"
+	.string	"\206UPC m\225\016\260\030"
+	.string	" I\276\0228\303\334\347\217\037\035\031P\271\036&\305c\005\\\321\312\026\247\241Y\032K\303"
+	.string	"jZQ'\266\305~X%"
+	.string	"\372H\306\205\223\357h\365\0307*r\365\237\370\321&{\247\0249"
+	.string	"B"
+	.string	"9"
+	.string	"\264\3352\343\r\367\352\362\032\222W\356\031\222W\223\366\210\227\020v\"\241\300*C\211\335\355\350\203\223\237\244\177\r\257`\265R\237\023\217\335\365d\265\022\334\364\2667l\223\354\203\004\bR\240\330Z\3450\301\366)6\346\300\214\302\210{\305\250d\021>\0231\227\b\367z!\301\231\3451\220\207\271\303v\261\004\032\030\240\355n\306!\356\325\262]Bp>\355W\270\005\362\027\004\034c\367%\"\fj\003\250\312uV\272QJ'\265Q\343<\313\226\025M\271\262`zP"
+	.string	"b\347\t\273LM\352\300\376\266\273k\372\262?\373\353e\377\366\330O\017\373\347\244\342\372 \332\260\033\242\243>>\300\355\tm<\240\216\215Gs\021="
+	.string	"%\217c\341\217\006$\202\235q$\206!\235S\b\232F\217d\022?P\007~]\351\363F\272O(v\032\016\203\246P\330\235@0\354(\345~[\372\362G\027"
+	.ascii	"JUC<\035\312\254\006\243\213\203[oExt\rx4C\201a \0130\n\230\003"
+	.ascii	"\231\201\021\020\016\030\006\262\030jx \0068\301\247Z\001'yq"
+	.ascii	"M2"
+	.text
+	.section	.gnu.lto_fillStrokeEllipseInRect.64.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\367"
+	.string	"\245\013"
+	.string	"F\225NA\020M6\0350\021\bD\260\316*[\033M\f\003\210\275\376\230\203R=K$\230\263\341 \314L_\203\357\337\0050\263\036\217mv\006"
+	.string	""
+	.string	"L"
+	.string	"\270\257\222\330p\300@p\034\367p\032F\377n{\247\0247"
+	.string	"?"
+	.string	"9"
+	.string	"\273\345\304\225\355\325\3451\034\257\333/\034\257&\355\331\313\324>\"\224F\031D\354nG!\234\374$\375o\370\004\311$\372|"
+	.string	"\330]O\222\251\301Mo;\303v\307\276\200\273\245\022$VV;\250l\037bs\034`,\016\206\227\352[\271R\004\266WNe\231\345/\220o\331\203V\261\fN\016b\273;\361f{\225h\334\311\362i\277\302-\220g%\270\305.j\026\013\001V2\005t\201\353\254T\243\224Nj\207\306y\222%#*rd\302\374 !\304\316\021v)\232\364\201}mw\327\024e\037\366\327\277~\355\256\237\276\365\317G\204\002\210OC\005\036\372x\0047fS\301h6*\030\n'z\007<\236\205\302\031\212F\004/#G\f\007\\@!\370\031\275\316G\3744\035\370u\236\3173\320eB\261\243h\030\374l\302\016\004\202a\007)\367\332R\224\003\030"
+	.string	"JUC<\035\312\254\006\243\213\203[oExt\rx4C\201a \013\230\003\201\001# \037\030\006\202"
+	.ascii	"s \263\241&\006\002\203\023|\252\025p\222\027\327$\003"
+	.text
+	.section	.gnu.lto_ctmReset.65.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\235\b"
+	.string	"&\020=8@o\323\001@\265\345T\357]=\301\n0d\273P>\207\372x_g>\215\275\b_\347w\241\231r5F\337\245\253\242'\254\361y3w\230\276\213\257~\370\366\255\355\235R*"
+	.string	"."
+	.string	","
+	.string	"\277,\332.\0377V\303\201A1\362\262\273tj\\\274\024\375\213\034\340\204*]j\024v\327\362\204\272\270\347m\033\330\346l{\004\263\223\302\322\255v-V1\253\272N:l\237c{*>\227\366?\016\">D\342\002\273)\222\222\335\021\301\331\346\227\307\023d~m>\220\t\244Z?\312\031\367\326\316\224\027TT\023\323dK\332a\204\374\311\005\246Yr\007E\256\230\264\254\204\261\307\222\234\031\366\255\335]\317\224\035\336D\331\306%d\033\346\0015\210\221\366\tp\b\343\300\n\n\033\300\217\001D\372\252\027j\016\036\330q\264vt\324i\0174\364\201\024;p\365D\037\r\n"
+	.ascii	"JUC<\035\312\254\306\275\305\341\326X\021\223.\203|\253\321\340"
+	.ascii	"./\332I\006"
+	.text
+	.section	.gnu.lto_ctmSet.66.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`V\001\025\r"
+	.string	"\346WXD"
+	.string	"\2216\035p\314\331\274\f\316\030\034\254\f\003\240\261\202\350l\361\313\033\305\314\341w\345\211-\301\350y\321S\335\243.k\214\2115f8=\003TU \360\243=\242\242\202a\013\ff\013\003\236}\353M\344N)A"
+	.string	"M"
+	.string	"="
+	.ascii	"\340CHx\200]S\214\314n\bb\217\346\322\341\007T\227\232\013\250"
+	.ascii	".\r\332/\036\242\254\245\242B\201D\215\335\275t\303\301G\320"
+	.ascii	"\177\3147\245\023\322\243u`w\035K'\030n\275\355\002\266#\330"
+	.ascii	"O\t_\371\343\346C\306\n\0054v/\344\300\2613\322\004\007\333\357"
+	.ascii	"\26091`\\|-^J8H\341\342\241\301\251\005e\216`\361\211\002\260"
+	.ascii	"\025L,l\035>1\274\b\360+>y\263{\302\206\314\356\202X\244\271"
+	.ascii	"\344P\234\224\317\243\375\017\007\021{j\325d\0043f&\250\211e"
+	.ascii	"\264\264R\251\224\252F\265!|\361%S\233AI\376\200\021Q\250`\261"
+	.ascii	"\361\206\035\222\242j\260O\355\356ZM\366a~\353/\177u\227_\276"
+	.ascii	"\345\247\316\362kY\310T,dj\226M\305\262\251\0316\025\303\246"
+	.ascii	"\032$\362\200B\231\007\324!\340i\017H\264\217\207G:!\217\023"
+	.ascii	"\371\026x]\002\221\222\216\033}\032\203\221\267\205.n\273H6m"
+	.ascii	"^#\235wu\f\230\033\211\272\253\204\343\272\253#\f  `\303\214"
+	.ascii	"\253\001\212\325\020\233C\351\325\257\271\330\314zC\341\202q"
+	.ascii	"\234\203\361\030\231o\230 \346df$\034\303\262\230\023\230\021"
+	.ascii	"\371\206\t\2029\231;b4\206\236\340\243V`\222\027\227%\003"
+	.text
+	.section	.gnu.lto_ctmTranslate.67.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"\215\n"
+	.string	"\206\023I> \345*\035"
+	.string	"-\004\""
+	.string	"\245\321a\302\001\247k\241\271 H\036Y"
+	.string	"\331\231\316\037\213\256\026\207\322\003\022\f\240\332\360\350\332DB\020`)"
+	.string	"\215\206\r\003\272\022\256\035\373\344\333'd\357\224\0023"
+	.string	"9"
+	.string	"4"
+	.string	"\367|\036As\217\363\003\315=\233\266\314O\223\335\234\3146l"
+	.string	"v\367\253%7OM\377\266\013\274`\255\323\215\303\356\232\276`\261\273\336\366\202m\t\373\004\001\037\003\004,\316kA\261\375\216\375\021\251\215Dt\214\350\371\025\3634\263t\005\353\341\342\270\355.\310(\316\275O\227\220\033\235\332\237=\305\274\n\306\rve/\267\335\023d\021'\335V\231\037Bp\031\325e\217\326J\253mQ\322\277\374\321\250-{@\250K.fi"
+	.string	"\373l\321Jb\277\333\335u\225\331\257\375\365\264\237z\236\030\214jf7%I/H\352\022JT:5\210J!\205\021\254X\201\243\001\233B\2471$\225\252Q\204 \221b\310*\301\t\326\230:}a\352[\245@\212\317$\216_\210\301!\013%~d\030\212_\347\334\007\021"
+	.ascii	"JUC<\035\312\254\226\240\213\303-\267\"\274]\243\034\314x\300"
+	.ascii	"\b\310\007\206\r\025.\020\030\234\340S\255\200\223\274\270&\031"
+	.text
+	.section	.gnu.lto_ctmScale.68.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"\315\n"
+	.string	"6\324KB0\247*\035"
+	.string	"\305\226\034\317\376\315\027qz\b{\260\330\344\225\017\351\274\357iI\214\203\227-e\246\243\341\035\334:B"
+	.string	"v\035QD[\242RR`\237!\235\221\205\223\264K\242\332\322\324\264h\223\275S\n5"
+	.string	"9"
+	.string	"8"
+	.string	"\366p\257&\377Py\345\356Py\365hC8\t`-\001\022\204\304\"\354nGS>~\216\376c\277\260Z\252O\013\305\356z\262Z%7\275\355\b\333\030\366\027\002U\201"
+	.string	"\333\307\330\032\0070\227\033\303\212\254F.\270W\315\3543\311#\030\377r\351\313\356\202\232lw9&q\257\233MS~>\355\027\270\201\361\007<\336\260\353*e\273$'\324\345\n\002\264\017\272r\235\224Njs\210\363,o@\250\312\231\22393i\260S\202M\252&E\261\277\355\356\232\272\354\303~\372\327?kf"
+	.string	"\003\323\203]\222\t\265\245\005b8;\302\351\020\311\023\032MxB\035\210\320\3338y\037\005\213:\243\360\003\211\031!h\001J\201\037J\364L\250\2604\352\276Rw*y\032\235\b\f\273\216\204?\024\t\354R\337\007v\030r\277m\017"
+	.ascii	"JUC<\035\312\254\226\240\213\303-\267\"\274]\243\034\314x\300"
+	.ascii	"\310\241&\006\002\203\023|\252\025p\222\027\327$\003"
+	.text
+	.section	.gnu.lto_ctmRotate.69.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\265\t"
+	.string	"\226RD9@\255\322\001\374:\236\345\322\236\021c\250j\242YX\330\032\366];\rB\002\023f\001\372V\020;X\214\305pCt\216\342\016i\211?\371\310\250\022\202)\f\303\266M\366N)1"
+	.string	"3"
+	.string	"3"
+	.string	"\343\007,\247\230\013XN-\332&\037/\366\"\003\221\3508\331\335:-.^\212\3769\236y\301\\\227\027\204\335\265|\301(\356y\333\005\266O\266K\002)\233\243\037\030\266\257\2619\263\220\034\277!\336f\017gvq*\267\335\365\330\2049\355t\034Y\350\322>\355\031\342k\016\017\330\215\341n\273\243\307 \314\251\003\373ng\314\t\032\271\207\ta*\345\264\033Z\362/w\"\246\313\033\232\f\231\221\254D\261G\227\234\025\366\273\335]\317\230}\333/\273Mm$%\262;\261\022\340=2\201F\245\003\320\350C\020z\f*/\004`\322\247\024~\242\226B\b\236D,\360[\265\274\205U\210*\325\017UU(/UI`X?\006\376V&\260\262\276\017\254\2321\r"
+	.ascii	"JUC<\035\312\254^\277\305\343\326X\0213\256\241\3170;\020\003"
+	.ascii	"\234\340S\255\200\223\274\270&\031"
+	.text
+	.section	.gnu.lto_contextPush.70.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\225\b"
+	.string	"\006\320<9@o\323\001@\265\345{M2-"
+	.string	"\351\001\343 \037^s\320\200\227\245\251\305\330\213\360u~\027\032\254)6\372\256\270\242"
+	.string	"@Z\2321s\307)h\236\342\035\315\276\375\275S\n)"
+	.string	"-"
+	.string	"+"
+	.string	"\226E\273\345#\307n:X,H\\v\227\316\215\213\227\242\377\221\003\230N\244\313\r\303\356Z\232N\030\367\274m\004\333\233\355\217(*]j\367\"\006fW\226\211\207\355w\354\202\214\317\245}\220\207\210\027\241\270\300.JU\262;*\030\343\334\362x\002\315-\316\0074\017\265~\2643\356'\312\r)\253\212YrF\332\341\204\274\311\006\245I\262G%OR++_\354\221$\247\206\375\314\356\256'\312\236\236\326D\230\266-`\332u"
+	.string	"f\022]\366\tp\350\332\300\n\n\037\300\317\0014\372\252\027f\020\036\310m\264r\264\343\262\b\032\372@z%\270z\242\217\216\002\n"
+	.ascii	"JUC<\035\312\\8+\034\341l\254\264I\027L\276\325hp\227\027\355"
+	.ascii	"$\003"
+	.text
+	.section	.gnu.lto_contextPop.71.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\235\b"
+	.string	"&\020=:0\3456\0358\365\373BJi\35180\030\310\241b3h\301\245"
+	.string	"'\345\375\307\306\034@\264mh\246\246\215\321k\306\203\002L\035\230A\007`\321\330',uE\263om\357\224\002)"
+	.string	"."
+	.string	"+"
+	.string	"\267\034\332,\03796\323\201\272 A\355.\235\033\017/C\377#\017 \225\304\313L\303\356Z\222J\031\367\274\355\004\333\233\355\217\223\343\242RKv1\002\274\354\311:\361\260\375\215m"
+	.string	"\240si\037\344!\341E*>\260kB1\331\035\027\214iny|\001\346\226\346\004\230\242Z=\272\031\367\325N\223\035R'\2139r%m\220B\236\344\203\321\024\315A\311\224\226\225\225){\024\345\324\260_\355\356z\232\354\326@\230\2661`\332\205\360e\023\241\254#\340\317\265}\325\003B|\336\203G\344\325\016\314\"\272\217\333h\345h\210\313$\350\307\373\350\245\340\332\201<\032\n"
+	.ascii	"JUC<\035\312\254\306\275\305\341\326X\021\223.\203|\253\321\340"
+	.ascii	"./\332I\006"
+	.text
+	.section	.gnu.lto_frskyOSDCanvasVTable.72.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\326\001\025\017"
+	.string	"\366\232hG\340\026\251\003\024`\216\005+ci\221\0374\206~\311\372,\217'\2272}\360\007\331\202\305\2033,\036\306\205\t\036\020\020\266f\252\321\177\231\025\376z\005n\0369\031\306\301\ng\214\372\274q\2060\306\030\307*\245\200i\007V"
+	.string	"T"
+	.string	"U"
+	.string	"\242\036aW\202\250\303\320N\020\311\032^\n\263k\314\216f\177\261K\232=\312liJPvY\246\244=\326\302\0340\323\323\362\375\371\\\027.\300\370c3\300t\370s=\230\376fV\303\251\351l\3037\230\344r\370\256\242\314\221)(T\f\207\340\326\fh\032"
+	.ascii	"\024\001\226\305W)\246n\213w!\251\312\276x\332\237\352\302\b"
+	.ascii	"I\021\214\021\222 xe\374\214\036W\226\306\327\220ue\343\253\004"
+	.ascii	"qn\314\256,K3\233\262n\315K\332\262o\203\240\305\326M\240@R\227"
+	.ascii	"]\300\240\253\3536p\320\343\313>\b5\370\272\020B\222\302l\204"
+	.ascii	"L\370\2077a \356\204\203\370\023^9\024\306\361\221Y\036\205["
+	.ascii	".\205\2058\025\036\342U\230\310w\340\234\227a\327{\340\327\317"
+	.ascii	"0\354Ap\370\"X\347G\360\316\223\340\"_\202y\336\004\307\376\004"
+	.ascii	"\313\376\373\024\002tP\037b\016h\257\342k\2177w\305\327\016S"
+	.ascii	"\001Z\t\264\342q\243S\213\327U\030\275t\234\351D\272`\362\346"
+	.ascii	"\312\306\315\r\303$\271l\245\316\333@\0054\316\304\322m/\034"
+	.ascii	"\327m\0044\246\361\034\306\341/\256\361\220s\370\016\3338\017"
+	.ascii	"\353p\031\357p\037\346\341F\270\207#\341\033\237q\312EV\271\022"
+	.ascii	"\006}\t\373\360# \220\243\255\006\305\024\223b\246\305\b\025"
+	.ascii	"-\354R1c\245\304\273\354\262R\004\225\302ALRH!\005)\244 \205"
+	.ascii	"\224\244\220BJRHI\n\321\245$\205\224\244@t\270\024C\352P\341"
+	.text
+	.section	.gnu.lto_getCanvas.73.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`Y\001\375\r"
+	.string	"\306\232`D"
+	.string	"\261\266p/\\a\306\353i\\\343\013|\364~?8\f#\r\022\271\325\026\002\224\002\237\377~Wd\214+4\334K\326\353\3770\337F\b\235@UU\275\353\341\370\006\230g;,N\256\3006R\332D\312\224\002K"
+	.string	"L"
+	.string	"M"
+	.string	"\"\016\203zL\312\005\354\262Z\270\330\035\027\330\243\035\363\370\220\354\230\366\001\3311\333\036\361\240\234\372\350\262\362X\315\260\230\270\331\0357\345\360\3243\345\237\304\021|\270\241\201\206\212\026\325\323\243\301\356:\305\226\013\267\336\266\002\333&\366\307*\271\303\006B\324\204\344\274\340\330l\346\330\243*u\203\375kw\327\312\262\037\363gX\372\272\322\212\245\363J\037\300sX\270\261\201\212\261\273\332\201cg`0<\330F\331\037\266H\213D\307S\201"
+	.string	";A\246\302\003\355\230\310\fI\246\375.9\013\325K\263\365Q-\031\221js_\321]\264\271\246\246\f\026\035 iC\360\362\342\325A\206\025U9i`j\236\242D\300e\227\302E\377\304Q\234\\(\245\354b\351{\211\222\266\273\f|\0310\004\251\321\341\230\237\222\035\313\226\210!\242n\304\231\302\221\247\031$\362\200B#\036P\347@\310I\030q]\346\256\023\n\277\317\351$\004M>&\360#\235\270\b\244\320\013m\237\267\215<\016e\353\300p\353$\360G\022\201\233\351\373\300\355\303\266\307\375\265\312\362S\231\202\300yQ\321\025'\315\213K\035\027"
+	.string	"\304\320\212e\343ah-\005\004\003B\001\270\300F\tw9&p6\344x\005\177F\260^\270\245T\253\320\305HM"
+	.ascii	"\261\211\313\022\250\272f_L\350\2400$\324\234\3275\311"
+	.text
+	.section	.gnu.lto_frskyOSDVTable.74.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\242"
+	.string	"\245\t"
+	.string	"\224\020b\001"
+	.string	""
+	.string	"4"
+	.string	"\005\001\212\001\202\200\200\374\342\203\307\230\024\002\177}\370\306\230t{y\270\306\230rwu\370\305\230Psq\270\305\230vom\370\304\230pki\270\304\230\220\001ge\370\377\307\005ca\270\377\367\003{_\370\376\247\005][\270\376\327\007YW\370\375\227\005US\270\375\247\005QO\370\374\307\005MK\270\374\267\005IG\330\367\007]E\367\307\005]C\366\207\005]A\366\327\003]\277\177"
+	.string	"?\202\210\200\330\002\275\177\273\177\315\001\271\177\314\001\267\177\313\001\265\177\312\001\263\177\311\001\261\177\310\001\257\177\307\001\255\177\306\001\253\177\305\001\251\177\304\001\247\177\303\001\245\177\302\001\243\177\301\001\241\177\300\001\237\177\277\001\235\177\276\001\233\177\275\001\231\177\274\001\227\177\273\001"
+	.string	"\013/root/repo"
+	.string	"&./src/main/io/displayport_frsky_osd.c"
+	.string	"\023"
+	.string	"\240hP\264VE\003R"
+	.string	")@J\022H\001\244"
+	.string	"R"
+	.string	")@\212\022\210\001\244"
+	.string	"R"
+	.string	")\200\224\230\244\240I\326"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_frskyOSDDisplayPortInit.75.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`\360"
+	.string	"\265\f"
+	.string	"&\330XC"
+	.string	"\221(\035\240#\275\346\007\260\212Z\027\326\223\322\021y\304\333\222~.*0\037\342\323\307\030\242\275\265z\255b\363\0262\327-\365\337\202\326\377\356\322S\205\005q@\306;x\002j\260\373\237\0067\331R\246\024F"
+	.string	"A"
+	.string	"D"
+	.string	"'\035\261\220B\351P1\271\200b\306n\207\271\373"
+	.string	"\370+s\001\360\227~\370\351O\363\344k8\324_\206\303\365!`y\001\023\200[=\002-\035B\274\365$\341T\231"
+	.string	"<v\327\311\3424\334\327m{lg\366=\001\177\253)\266\323\360\335\377\234NM\237#{)\311\300\035\003\314n\311\215\230uq\275\210\260\177\302do\354\002+\236\314\267\374\0227az'b\216]\224\230\026\273.\t\334\311\374\352x\266\375\225\263\230\034J\242\366H\251\352i\322\026\305<\013\252*\312O-\301\"9\262:\331]\005y\027\023\022+\324%x\315Z`\254\262\206a>\265'T\310\263\256\fNV\212\362[\327\244\3300\202\206\214M\033v\247J\365`\007\316@\235\354\263\240\223q\f\210@\244\255\324 \202>!\n\033\207p>[\374(=\3304\007\037$-\216J \020F[\350\203\305\020\026!\004\"\302B\264\r\343\034p\034\2014\214\024\243\206m\272\3245%\023C\005\204\n\026\351\237\240\025j\006\022"
+	.string	""
+	.ascii	"\322\212T`\030*\016\b\263p1\013\353\260\302U\035\204Z\024\034"
+	.ascii	"\006\261\302oX\305\205\021'cz^\231\006M\210R\002\233\272\232"
+	.ascii	"\306\240\240"
+	.text
+	.section	.gnu.lto_frskyOSDDisplayPortInit.part.0.134.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`]\002\r\023"
+	.string	"\246bzI\340\360&\035\220[\016\301\343H\324A\347\343\275\321\033\332|m?\205$$\343%%e*\341\345\332\312W\370\r\241\034\300\242\033\254p\264\302\305\332\237\211\301\002\206\371i \376@\344H\b#8\260;f\243M\272m\262wJ\001c"
+	.string	"d"
+	.string	"a"
+	.string	"\363&\374\022'[\016$\032\300n\216\r\243\335\022\304#\334\353i\233$X<z\220=4\031l\373?\217\265x\24421\257\234\223\017\207\n2\244]\322{5y\003\245W\356\005J\257\224\347\343\351\334F\177\302f\\N/\373fdS\364\"chF\303g\3077\016\222\3355Ws\327\333^`;\305\236<\001\233\217\007\0017\273\030n\330X\234\252\002\304\313\337\276\037t\"\273\363\312g\376\220\210\r\n\244\335\355^\205N\033\267\265!\227\306\364b\201\366\361\352\315(\361\274\320\312i\243\007\2714\337\320\201\214\201\274:\305\005\255\334/Y|\231;\333,\007\022O=\037\257~\331bw\257\236`q\312\300\340\354\256\202\003?%4C\347\216~\266\006\215\235\375\205\213\013\375\204\032Q\333\231\344"
+	.ascii	"\363\263\267hq\273\024V\234\305\203\215\325*\265J\257\237=\305"
+	.ascii	"\310\355\276\016\363\213n\204\342\177x\3657\316\303\306\322\253"
+	.ascii	"\035!\234\207\371\024C]|\331\t\320j\"j;\351\316\211\277\374\234"
+	.ascii	"I>\320\377\232I\246\033\335\261\277-\325\261=\375\032.\360c\320"
+	.ascii	"\031\265\032A\251DFP!\bPV\256Pl\360\255T,\t\235S!\252\3603\021"
+	.ascii	"[!\350\300\304\005~*\342\t\004\225\220\245\362>\226\227\302:"
+	.ascii	"A\361R`\350\205$\360\247\262\002=\327\367\201^\367m\251N\307"
+	.ascii	"\364wz\201\232\344E_\250\251\206\2664\307\250_\366\2113 \306"
+	.ascii	"Hg\312\243\233\030\f\242\223\024\fu1G\214\350\246\240\020\265"
+	.ascii	"2 \200\242!\243\363\305\314\001\304:{\215\335\256l\353`\345t"
+	.ascii	"|\210\264j\3576TX\361\0057\261\332\267+\310\362\013\026\032\235"
+	.ascii	"\211/t\006\302'U\267\016\206\260*\004g\016\255'\341p\034\342"
+	.ascii	"\203\003\226\257[\312\242_D\320MD\"c3\b<\314\037\036R\177W[\276"
+	.ascii	"\260\270\370\246\316\330<\373\254l\005M\206\222S\007\273_\244"
+	.ascii	"\256\335\n\0066;\365\3320\006"
+	.text
+	.section	.gnu.lto_.symbol_nodes.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375`@\r\r\031"
+	.string	"&\351\224A`\032Kc?\260\277qA\312R\256RS\226rU\023y\334\341\f\177A\031}c&\017\276M\030\307\306$Y\307\036\260O,\254QK\354\023\373\007p\025M\013\225h]h]h\027\326\305\240$2\005}"
+	.string	"\177"
+	.string	"}"
+	.string	"_Zp&\2617)\270S\202?!8\324\201?\303\036\005v\251\257Oy\235\252\353U\\\267\332\372\025\364XZ\317\312\272\026\326\241W\337\262:W\325\273\250\3565\365/\251\203E=\354y\247A\335jO\367\232\323\315\326t\2671\335nK\367[S\351\206k^\333N\323\222\034\007\203t\313\035]\310\350AE\007\"z\317\320m\234\253TJ\205b\337\276+\263"
+	.ascii	"\326u]\205^\323\264=\343\025\211.n\304\026\367!\213\333p\305"
+	.ascii	"]\250\342&Lq\017FoA\024w\340\330\rx\342\3763q\373\225\270\373"
+	.ascii	"H\334|#\356=\021\267^\210;\017\304M\375p\337\255e\253=\224\351"
+	.ascii	"\341\306\263\266\233\322\262(\035n\272&\217\347`vh`l\023\255"
+	.ascii	"R\351\0224\016\267d\033~\243\3418\031\256\203\341;\027\316c\341"
+	.string	"C\025ND\3419\023\376#\341Eeh\021\356\003\341F\017~\344\340I\r\256\304 6p5o4n\006\332f\330\n\254\021P\223q\332\2000\0017\032\340:\317\234\327\2369\257\222\273.\311m\207\344\316<r\1771r{!\273\273\024\271\271L\357-DnL\351\255\305\016\271\257\330\365\306\362;\213\220\333J\220\273\n\220\233\312\217{\212\217\373\262\307m\311\343\256\334qS\352\270's\334\2228\356\310\0337\244\215\373\261\306\355H\343n\234q3\312\270\2531\356E\030\267\342\213;\266f\326\2661y\022\007\355\272b\226]\225\320\353\\\203RjMfIb][\215\274\202\264\272\316\251\265N0/\251v\254z\254\272v\332Hu\355t\352F\247\356\230\324\265f\326\216T)M\236QW\2141\352\332\305\347\025\253>\257\214\"\324\215&>!:]g\365\260\311\220\351\332i\341\322uV\t\225\006\223\004\221\002\217"
+	.ascii	"\215\376\212\374\210\372\206n\224O\350\332\275\240\033\323\246"
+	.ascii	"\007\344\274\237\033sF\365\301\353\271\343\261\333\251\323\241"
+	.ascii	"\313\231\303\221\273\211\013\200\254\250!\b\214\204M9I\273\001"
+	.ascii	"p\203$I\322\001\021 \b\002B\024\t\215\240\b#\346; \202\333\242"
+	.ascii	"\202\330\213\007\337\264D\244_\"\027\337D\177\033\021\354\274"
+	.ascii	"\021\315@\364\003d\331E/\352p \372s\372gC\375\304`\376\bA\375"
+	.ascii	"V0\377q\376c\376\343\374\307\374\335\216\271\321-\"\025-R\373"
+	.ascii	"\210\360W_\345\247\374\227\377\253 0`\003J\206`\332R\027\037"
+	.ascii	"O]|<u\361\361\324\305\307S\027\037O]||\362\360h\225\360\223["
+	.ascii	"\321\215\342\2375Z\370C\322\306\262\177\306\"7k\306\230\026\250"
+	.ascii	"\350|\035\367\356]\263f\315\2325k\326\254Y\263f\315\2465\262"
+	.ascii	"_;k\331\023\034)\022\372\264\240\304\350^X\n\032@U"
+	.text
+	.section	.gnu.lto_.refs.987001d55aa12290,"e",@progbits
+	.string	"(\265/\375 \215\245\003"
+	.string	"\322\b\034$ \257\2465"
+	.string	"\f"
+	.string	"\f"
+	.string	"\f"
+	.string	"\f \226\375\355\303\256~\031s\373db\333\346:\346:\\\213\266\330\235\210\f'u\370\020\342D\212\216m\304\350\025-^\224\2101#\364f\326U\330\243\260\327\262\327\260\032\355\021\222\032)9Y\245\254\264\274\264bfjnrvz~\002\f(p \301\202\006\257\007\021&T\270\220a\303\351\272h*Aw\267\021"
+	.text
+	.section	.gnu.lto_.decls.987001d55aa12290,"e",@progbits
+	.ascii	"(\265/\375`\026W\305F\001\n\022\352sS N\271\225t\3133\310N\032"
+	.ascii	"\006\031p\260\241\001#\305\211\227+\351\005\035\260o\016\271"
+	.ascii	"\b\355]R\024\345U\024\273\312n_\037\003mEM\244'\364\270\337\223"
+	.ascii	"c.\356\031\246:\305\252\274\237E\032\272\030\311\332\227Wm\226"
+	.ascii	"!b\222&N#\322\b\331[\356\024\t\006\017\007y\007gZM~\247\326\037"
+	.ascii	"J=\223mP&W\215\373\251\342\b\342q\330\270\241P\350\206,\2355"
+	.ascii	"\356\247\353\004\354\347G\343v*\333\213Bj\334I-\303\215J/NF7"
+	.ascii	"\221!\325\270\021-\3139\273\240\3305~%5n\245^z3u\214\233\263"
+	.ascii	"\243\231\026\360\314Y\247\231\\\034s\326q\261\366\003k?\300c"
+	.ascii	"P\2557\025\377>\255m\324HmN\246#G\rCM{\272q5\376u\036]\021\005"
+	.ascii	"\001QH\254\0327Q\322\207O\224\257\361{p\355\027\rd\321\202Z\350"
+	.ascii	"x\3073\253\345\034e\271:1\206\3205\366\300\276\2508Fu\211\214"
+	.ascii	"\214\214\2641\352{\310\372\266[m\356\236v\301B\267\224\267\326"
+	.ascii	"\270]\264\235\231\3155\356\035\313f\375\302\210,i\334::\326\367"
+	.ascii	"\326j\213\032\372\350\330\302'\0066\324x\353\310\362\004IY\264"
+	.ascii	"\261}b\331R\250\324\204 \033[F\226\247\265\031i\215\355\342\361"
+	.ascii	"\356\223\215\216\251\261u\322D\261\213V\373\264\035\324\267\213"
+	.ascii	"\365\326q\265[\204\353\255\336j\243<\004\225\250f\202:_\201\267"
+	.ascii	"JZ|d!\371jl\001-\233K\215'Y\216\215m\222\343\2514Q\301\200kl"
+	.ascii	"\221\034omt\323\361\327\330\0369^r\217\b4\n\017'\331\221\r\321"
+	.ascii	"Zm]\215>\276\225\302\276*h\221[>\224FD+\252\306\226\210es\321"
+	.ascii	"\"\324\033kl\207\250CoYO\032[!\247[\223\2645A6\266{kX\340\324"
+	.ascii	"cc\033\344t)\032\r;\277\306V/j\265|\266\203z{\204\347\303\345"
+	.ascii	"\311\031\230Rc\353#%-\261HNc\333#hJ1\261\261\265;\235\313\034"
+	.ascii	"\032\340\225\375Y\355\241\355\240\376vN.\345F\331\330P\334\255"
+	.ascii	"\234*\303\312Idc\013\207}\366\372\2144\276\342\351\376\243\330"
+	.ascii	"\2579\261\267\306\177\301\372[\2676|GXW\305\343\266\355\0271"
+	.ascii	"\342\205+9\227\345\234;H\037\245\344\036\033_\321\262\375Gy\300"
+	.ascii	"TV\\\343\337\262\375\226\314\226\331\265\353\fz\346\266\234\243"
+	.ascii	"\034P\316v\b\2515V\263pPb2\032\037g\375o\321l\232\335\221a\\"
+	.ascii	"\234?\024y\032\037\305\272\202\302m\364\034\350\344\021oY\337"
+	.ascii	"kg\333A\355\"\333A}\324\276\250\253\355\240:\377f\336\255\276"
+	.ascii	"\326\243d\034\376t\206\277\307n\326\377\350\177\203\260z\006"
+	.ascii	"\353\307\374\033\305\337*\376\266\371{\371\367\013\177\247\340"
+	.ascii	"\357\232\277W\374\r\303\3371\374\315\342"
+	.string	"\357\023\374\215\363\267\362\357\233\277i\376\236\371[\346o\024\374\315\354\025x\240\003-P\340\204\021\177_\225\020\202\001:\350\340\222b\202\377#~\034\370\333.\313\365[\021\035\265M\026\353\006\370\017B\306\340O\355oc\374\266\005\277-\372-\r\277=\372-\214\337\346\337\316\360\333\237\337\272\370\355\322o\201~\313\363\333\234\337\372\374\266\206\337\276\340\267;\277]\301o\225~\353\202\337\312\360[\025\374v\350\267B\277\355\371-\321ou~k\364\333\240\337\276\370-\013~\233\364\333\026\277u\376\266\311\256\2603V\004\326\204\305\200\245\2005\301\036\300z`\323;^\311\371\356\343ro\373\017\202?M\323v\222k<(\177\267\375\355\366\337\033.T\346zX\376\226\273W>.\177\003\271V\3775\340\344\320{?\035\374^\274\374\001y@\022\264\001\240\020\007\177\367\335\031C \376\356\2733\210\002\240X\364\301\337Ln\225\321"
+	.string	"\376fr\253\216\n\320\2200@\370\373\361W\n\351"
+	.string	")6>$\211\360_\016T\037b$`\203\032\226\305E\304[\376\224\204\377z@\343\267,V\304R\210\0010)\240"
+	.ascii	"M#\376\356\233\361\377\204\214\006\210`;8\235\360\337\020\320"
+	.ascii	"\337n\340\351\001\377\0351\365\037\004(\024L\210\222\300\337"
+	.ascii	"\217R\377O\\\375S\nH\340\371\023R$\376K\"\312\252x\362O-\240"
+	.ascii	"\002t\005\026f\264\360\337\364\277!@\375\367\351\277\267i`\340"
+	.ascii	"\357\035C5\\\370o\t\246\313\201\337Rm\340\212`\351\267~V\205"
+	.ascii	"\007\376k\002\245\377 \374\204\337Q\376\224\004\377\235\211\361"
+	.ascii	"_\024\3747\t\351\267H\224\\\030\277e\354\254\r\177Z\002K\026"
+	.ascii	"9\302c\013\032\377FI\271\002\301o\211\330\273\276\016\374\276"
+	.ascii	"\362\247&X\200\031\377\233\202#\255\253\374)\212\377\322`$bK"
+	.ascii	"\346\277/(\"\363{\312\237\316\264\031\321\377\023\214_\377T\004"
+	.ascii	":]\312\277w\f\375\326\357\351\237\246\370\255\037v\362[\277\367"
+	.ascii	"\217\025\377+\364\337\237\377\362\374W\347\277\371\2775\374w"
+	.ascii	"\371\337\030\376K\363_\024\377\035\301\177A\360_\017\374\327"
+	.ascii	"\304\1773\360\337\013\374\227\205\377\252\360\337\024\376;\201"
+	.ascii	"\377:\340\277&\374\227\001\377\025\361_\021\376\013\302\177\013"
+	.ascii	"\360\337\001\374\367\203\377~\370/\006\377U\371\357\377\206\374"
+	.ascii	"\233\361o'\177+\376=\370\267\222\277\001\377F\362\367\337\337"
+	.ascii	"~\177\357\375\255\367w\335\337s\177\273\375\275\366w\332\337"
+	.ascii	"\321\277\317\376\026\373\233\354o\257\277\273\376\346\372{\353"
+	.ascii	"o\255\277\263\376\306\372\373\306\337W\177[\375]\3657\325\337"
+	.ascii	"5\376\246\361\367\214\277\241\177O\375-\365\367\363\357\250\277"
+	.ascii	"\241\376~\372\333\351o\031\1777\375\315\364\367\322\337J\177"
+	.ascii	"\307\370;\351o\244\277a\374}\364\267\321\337E\177\023\375=\364"
+	.ascii	"\267\320\337A\177\003\375\375\342\357\237\277\235\177\373\374"
+	.ascii	"\335\363\267\213\277y\376\336\371[\347\357\374\367\013\376v\301"
+	.ascii	"\337-\370\233\005\177\257\340o\025\374V\311o\373~+\343\2678\376"
+	.ascii	"\236\341\357\346\337\377-\344o\037\177\353\370\333\r\374\366"
+	.ascii	"\303\377\023\3775\360[\306\337\222\375v\352\267N~\253\342\267"
+	.ascii	"\"~\353\362\037\204\337v\370-\223\337\n\376\326\357\2679~\013"
+	.ascii	"\366\333\257\337:\375\017\372\277\367\037\002\221\221\221\221"
+	.ascii	"\377\212\217_\245\360\227@\n\001vB\250\202bp\026\nO\324\005\005"
+	.ascii	"\311\222\247\266\306W\301[\335\326\037_a\253!Q\252\303\252c\253"
+	.ascii	"[\226v\005\n)\251p\255?\246\252\221\001\335\221\016\032\3075"
+	.ascii	"\326%9*\305\306X\n\317\320j\f\"\207g`h\241\031\020C%9\t\264\363"
+	.ascii	"\003\307\324=\3222\232\334Q=[\372\202\272d<\243\222}cX\215\311"
+	.ascii	"\257*('\215\257\"\365\344\204\022\204\260(H\306\261\023\336\231"
+	.ascii	"\020h^c\334\204\235P\034P\2151S{\265\314 \032{\202\227\234\204"
+	.ascii	"\365\340X\302JI\230\320\2555\262$\221U\305\210q\023U%6\270\236"
+	.ascii	"\306W\031B\202\261\002D\257H\360\350\030F\007\332+\266&]*=\353"
+	.ascii	"\217\2130\221\313\021\274\307/<tL\344H\247s\325\030\013a'\221"
+	.ascii	"\016\304\253\273\230GFc\257\361S\024\327\037\003\341\027)V\212"
+	.ascii	"6\036\361\317\361\213\356a\304\254\254\361\025\261\223\211-\312"
+	.ascii	"F\343\037;\261O\r*?\245\276;$/\220\032\343\236k\227\364A\"\364"
+	.ascii	"j\374\024#+\212M\361\261f\020\004\205\343|\213\206\363\365c!"
+	.ascii	"\232sT\334\244\274\306\026sQ\221\bOaZ\377\033y\313~\202^DA\266"
+	.ascii	"\227\222\213F\270G\307~\342yJjLc\b\252\3755~\312\213'\214.}\203"
+	.ascii	"FS,:"
+	.ascii	"R\220a\215\257\223\003\234\251%5>\212\341m\242x\231$\261\373"
+	.ascii	"\321\370\377]b\321.\223\233x\313\344\026^D\313\267\224I\260\313"
+	.ascii	"\n\022\226s\206\t!)6\3067\204\361Q\330\326\377\036\376\"\376"
+	.ascii	"\315\343\022^\350\t<\240 \026\325q5\276\206!~\017;\250EK\321"
+	.ascii	"\334\306\003i\251\257\261\004l\007\365(h+\316\203\202@\212\034"
+	.ascii	"\2515V\002\263\242\367v\203\253\361Q\256V\300\373\307\224\344"
+	.ascii	"\006Z\264\013x\217t4g\265\256?\004\340E\322^-:\321\\\224L\223"
+	.ascii	"\242\202\204\t\201e\0162\207\013\025\177U\\\277\026Y\277\346"
+	.ascii	"\255\3775\342\007\311\206h\326\270\217e\fJn\260\361W\267\365"
+	.ascii	"\266l\354\226%\232\3605\342\215\351\260\306\tM\350)B\3511B\304"
+	.ascii	"\243\355Bot+\311\003*\343\020\357R\335:\023z\212P\216v\206\334"
+	.ascii	"\244\240`\213W\f\357\336\265\327\215\326\255>iWPk\035x\243[I"
+	.ascii	"6hT\232\332\335\321\222\263!\357\030\261\261u\315\316\356\216"
+	.ascii	"\022\276\214\240`\2139\347\267\020[\007\022\300\253\017\n\266"
+	.ascii	"\030\344\362\335\274\013\344\352\335\037w\310\335\273E\256\217"
+	.ascii	"K\344\n\261h\027\357\332\275\205\334\036x\027.\347 .\300+\007"
+	.ascii	"\n\026\302\005\342R:\372\200\277B\327\316\366E\375\232\264\376"
+	.ascii	"\267\356\322\005\301\202Rj<\267\272\005\032yj\3745g\225\273q"
+	.ascii	",\2208\374\b\327'\001\327'\215\254O\022Y\237\324[a\354\213\372"
+	.ascii	"$\334\372d\332\372\244\330Z\202}Q\257\216\033\265h0\027\315\305"
+	.ascii	"\372\355\f95~\262k}A\2660\352#-\214\372\244\215\325\004\373\242"
+	.ascii	"\222\255C\200h\2145~Ri\275\312\270\276.\f\204K4\206\320\214\034"
+	.ascii	" \360\334\301\225\201\335\257>5\303\272\306j0iS\214\245\252\306"
+	.ascii	"\267e5N\330\301\216\223\0050\306\303\256\031\355\325\222\346"
+	.ascii	"\374l\334\272Z\227F{Y>\033\023({rx\241\260.\264\345\346\f\365"
+	.ascii	"\330B\"F\\\255\033u\241\226o\t\002c\216\207\\w\353z\335\256\213"
+	.ascii	"\343fY\264\253ew\374^\335\033Z\227\352Za@\227\r\017\323\301 "
+	.ascii	"F\226\264\340\253IV\033\265/*\314\265\272UJ1h|\335\246\250J\222"
+	.ascii	"\231\020\350\265\321\211-\214U]|\215\257\362\255W\365\326\253"
+	.ascii	"w\353\325\270\365>\257\224E\003q\247\242.,\220b\220\215\215\257"
+	.ascii	"\252\255\267 T\033iA\250W\275\326\030\373\242\376\367\311I\204"
+	.ascii	"\027]`\215\377\353te\264^\021\275\027\215oS\224'\347\f\243\026"
+	.ascii	"^9\267\032_}Z\t\255\241\025\034\353\251\206\266U\225Y+\362\031"
+	.ascii	"\036\206\0351\354\270\020[\377Uj\310k\324\214\027\306E\2729\275"
+	.ascii	"x_\334\236\313t\203\256\213\253s\235\375\344\346\313\323\216"
+	.ascii	"w\251#\333I7^\242;t}n\321\335\271GW\350\002\365\343\215\321M"
+	.ascii	"\356\217E\273I\235\370^\322L\016\023\315\231'\347\234g\201\330"
+	.ascii	"\2766\272\037\026\317\ro\257{\210\316\354\233\235\203\343\321"
+	.ascii	"r\355\203\251\325z\355i\253\325\232\315\n:\t\031\322=C\207\210"
+	.ascii	"VP\254\205\020\351?\241-#v\320\n6 \032\002\261\343\212\f\017"
+	.ascii	"\303\226XH\373\230\305\243\255\343\232\b\013\255 \331a\242\025"
+	.ascii	"\fk\237vv\317\025\336\217\016\262\264\204\211}\324\312\263~\326"
+	.ascii	"M\207\215\314\351\236\033[SW-fc\313\236Y\035\326\355\204:\303"
+	.ascii	"\303\260#H\2720D\324\3600\314\247\177Z\312j+\347\350\025\360"
+	.ascii	"\367X\232u\203\212\354l\037\261\350\352,\336\2335b\377\254\240"
+	.ascii	"\345[\332\220y\322\314\266z\214\254wX\276\245h>R\300\241\341"
+	.ascii	"aX\316\321\333\262?\304M\352\303\216c\021\364\314?>;/\256\216"
+	.ascii	"\250\241\330b\316\321\020B\b!\004\230\020\222\177gKW,\340\247"
+	.ascii	"}+\207\250}Q{\311vP\237\302\255O\313\326\247Z\353S\246\365\357"
+	.ascii	"B\3025\311\217\037\201\215\233P=\224\"\2126n\301\"\246\235\237"
+	.ascii	"\300\027GwP\215;\260\033\260\225\274\003;\311E\214\370\nO.\313"
+	.ascii	"9\332\2018g\035k?h\261\366\203\024\017K'M\305Oa\254Os\326\r\177"
+	.ascii	"F\354\234\356\230\032\267\021K\230\247x\243q\367a\035G&\262\306"
+	.ascii	"\315w\274\2569\302\252\306]\344x,FA?bxq=\366[=\260\035\324\343"
+	.ascii	"\271\365\357 \255\3474\025\006\324\270\365z`\030\r6\356<\313"
+	.ascii	"\226C\324\344F\343+\306\270\274`k\262\323\370X\307Z\202\217;"
+	.ascii	"\245\"u\213=\336w(RW\211f\215\333n%\253\353\310I\235\312\221"
+	.ascii	"\343#\341\\\323=\203\332\236\215\217g\314a\2438\270\224&u4\002"
+	.ascii	"\337\336p\267I\023?\255\306\355f\331\374\254\254\020\033_q\005"
+	.ascii	"\tR\256G\343\337\307\365\321\304\365\027p}\335\217\365\357\035"
+	.ascii	"h7\253\017\220F\343F\263\nL\322j\334:P^\370\300\3655\356\263"
+	.ascii	"\025i\220\312E\3436\263\177Z9]\215\273\254\275Rj4R\301\265\255"
+	.ascii	"\347\023\3530\225\347\021\304\242\316\361\016\303Oj8\315\032"
+	.ascii	"7\230\317\017\276\262\306\375\345\002(\307I\343\306q\2745\t\256"
+	.ascii	"\210\222\306\215\325^9{d]\215;\253\265,\032\b\275\365\346\352"
+	.ascii	"\256\247:\321\034\3159\352\322W\217ni\2157\330\027\265m\007\365"
+	.ascii	"W\307z\013\202z##-\bj\337\300Z\377\266\252J\301\363bkb\343]\305"
+	.ascii	"\302\327\235U\343\246\262l-\2049:3\032w\r;x\003\212\260q\323"
+	.ascii	"h\034a\210\320\306=\243e\004Y\215U\245\225\2447+\272\306j\214"
+	.ascii	"\366\262{3\232P5V\223\020\327\r\320T!"
+	.string	"UH=\372i\351C\262\330\243\032]=*D\322\271q\327X-:\036]\222\022\264\261Jt\274\034Z\206b\215\325\241\2261\346G\005Ed\335\240O\325QuT\240\027J\236xq\352\213\253@\205*{C4\322\032\253?\307KB\201\200\3754V\235\307k\311;t\262j\254\372\264\214\255\033[|\215\325\035\265\007\253.\212\250\261\352\302\266\005)\301h|\016s*\317\205B\233\f\3225>\207\034\353\207\0365\2539\205\004\342c:\322\325\370\034\240\353\007\247\306\306\0242(\032C\310\343S\310\267*\275\306\306\251#\207\237\365C\027#c\252(\304\322\330\203F\217\306\337\220\270~\020\342\304I\2528t\235\304\226\3604\376\206!+\007=\205\205\251\"\021K\341\031\332\023&O\025\271\200\3108j\234.I\023S\304C\303\035+\007[\203\203KI\253\036B\204Z+\007uJ\2240\251\200\3179\035\215\277\001j\345"
+	.ascii	"\0200\365k\302n.j\324h\374\r>k\007EH\220\244~2l\342\2144\272"
+	.ascii	"\306w\021\\;\330\372\373K\375\234\362|\36495\276\213\335\332"
+	.ascii	"A\335\220!\251\337\323_]\336b\332\367\324\2571\210*\252q\312"
+	.ascii	"\227\026I\211p\255\035\034\356\355\245iQ\315'#\251\306wy\256"
+	.ascii	"\0354\351\321#\325\263\261\225\214,\332\363I\201<\325{\032\274"
+	.ascii	"\321\3238\315K\177\244x\251\217\364\316\305h\005\361\254\253"
+	.ascii	"K\347\252X\212\230\206\\8\256 \300\340\340\3229\253\324\316I"
+	.ascii	"H\225\334\323\271\310\265\267\253\306i\234\340\n\"\216\007\217"
+	.ascii	"\324\355*\t\366\204\306#m{\352VX\246\366'\244\267\202\030\262"
+	.ascii	"\266\226\246\331\r\321\035#X\353\326\337a\220\265\025\204\221"
+	.ascii	"\035;\3224\230\257\276\024C!5\2404?\034Yo]+\b&\321hz\366\313"
+	.ascii	"\223\241\364\266r^\212q\241\321u\267\243\361[\234V\020\201(\374"
+	.ascii	"O\315n\226\236\331\035\231H\205"
+	.string	"\223J<Z\314y)F\205\361\013\253\254\361\331/bD\214\031\216%\205\215\317\242d\375\327WJ\246\346l\243O\242\242_\361)\231\312\340\023\330Zc"
+	.string	"X\201\245c`\251\3307\350\344\274\2233\224\r\025\206\321R\314\006\210\2159\322\260\247b\330\231|Z\244\373IsP\275%\252\344\360\024&6>K\217\365,^\253\210( @"
+	.string	"E\360\344\345\031n\205\260\001\007\207\355\214\b\225\220$-\r\273)\300\256\204\032dd\030m\204\235\327X\230\035\024\024\256A\2645\302\023'\341$\354\344\001\256\020\201ww\030\217\b\261HWz\243\013\277\260\271h\001d9#\27002\3020J\310\343\362\032[$A1\255J\253\360\213\023\244\3162cM\200\036\016\302A\230\350H\\\002\322\260\013\354\002\2778\"\230"
+	.string	"\037D\304\206kB"
+	.ascii	"\222\303\303\206\253\332B\300\232\241a\303\205!`F#i$M8\003\242"
+	.ascii	"\327X\030\"\021\"md\316m\310\220!R{{\355bP\004\235\037?Z/I#\021"
+	.ascii	"9\271\276{\021\302X[[\3031=ac\2631\266\266f\225h\035`*-\315\266"
+	.ascii	"\235\021!#k4\271\230\241\253\253\016\023\002B\034\024\332U\202"
+	.ascii	"\220??\375\f|\322\303\351\3741@\215\234"
+	.string	"\234v\261T\200\270\316\235\243\022!!\263\b\260\304\204\211u4\003\222\230\0307\200%D\304= \206\206J\004\260TX(\310\bdp\320\271\364\367g\225\020}\220\375\374l\033\224\007O @,\037V\342\217\037ejuu\326\007\334\324\333\233\225\013\022\200\027V\207\325a\3336\344\035\302\300\255\274T\024\003\200\304VlE\333\306\003k\3610/\025\305dp\004\005+fS\235[\264T\347\312\b\201\230\303B\264\002\240mo\017\023A\f\321hT\024C\302\216\r\033\330j)\347,!\200\016;\257\261E\022\252n\334\300[\235s\316[\3117\250\341!\tj^^\370\013\005#\257\261\260\022\200r\344\300b\r@\363\032\013\033\323\323\2739C\005\331\312KH1\"\360P\300\214\370\311q\220\007\301_k\3169'\232\211\222?h^c\213y\t)\346\267\357_\315Gi4\327\355\254\250\277\275Moc~\026{\255"
+	.ascii	"\376\343\234\357\200\025r\336\241[\3149[&j\220)%&\036\344\377"
+	.ascii	"\357\234s\236E\034\2349\347\034\2352\342\340T\233*r\362L)Y\247"
+	.ascii	"\332\224\221Sm*\247\235Bt\214\212\362T\316\232\237F\231'\347"
+	.ascii	"\325\251\223\263\332\323\210\203\223'\0339\325r\221Jt*\347\350"
+	.ascii	"T\316\032\325)\3129\353Xgt\352\351\344\2312\342\340\344\2312"
+	.ascii	"\312jSF\326\251\226\2132O.\302\300\231\263QV\233B\264\316<U\344"
+	.ascii	"T{\032q\310<K\210\374$!\002\303>\035\316\221I9y\362\320\2070"
+	.ascii	"\236g\021\2373\372\264u9\347\264\365\344\"\033\315y*g\247\347"
+	.ascii	"\007u<Y9u;|C\311%\236\034&\241\035\350\023%\272\223\371\2348"
+	.ascii	"\236*zr\006\314B\013\310\2619\321\234\263O\336\311\2619\367D"
+	.ascii	"\213r\336y\236`)\347\234\237\366\317\247(\263d\036\235\240\035"
+	.ascii	"\350"
+	.string	"s\245g\347\351\223qH\331\234s6r\252A\237!\354\330\324\266\362N4\307:\203\236y+\003N\025\255j9\321\354\3149\333%,N\346\216,6\306\321\026>\301\245\246\306_\021\2023@D\301\212Y\254s\213\206u0\023\024g\316H\007x\344B\022a\016\305k'1F\343)#\214\324\007\005\013\033\203\302ThP\2600\0369\360\030\"\024,,\r\277\231\335\341\0379\270\240`\21370\327\224\007bR>A\270\b\221\207\027\006;!\007\n\026\004\203}!\216\331\300WP\017\304\270|\\`\240\007\344@\3010\037\016\304\204x\t6\202\023\261\022\\\210\223\340A\214\210\373\360!F\202\r\361\021\374\207\375\260\240E\303\2007\356x\007\363ta\240\022\304\214\240`\213B\340p\217\262\255<\f\006\304\b\n\026\226\204\237N\260\203\202\351a\260\034(X\030\031\336\321\007\005\013\003\304{\270H\007;\316\254#\205"
+	.string	"2#u\310\r\275\301\030\374\343\"D\222\216>\211EC\216\211\324\371\311\3115\306B,[OR\036\352\261~En\375\312\332\372\025\261\365+Y?\360\360\336\242\231\023\037\307x-BbA~\240=\354,\022 \211_u\307vjO\227\021YcL\227R\375\365\f5\306s+\324\313\t`c,\247\202A\226]5\306q-\303F\361a\205)\275\271\261"
+	.string	"\235\271\220k;vK\211\":\363\321\030\363Xu\212\224\0256\306l\366Q\251\260\2521^\303:\322\314\212\032c\265\366Jc\340\021\362\224\375G\351`q\216Oh\007\232E\003t2\212\036\2435\021-\361i\214u`\247J\021\240!A\215\361\331\205&#\223\020\3654\306f\027\n\270t\210\2431.\273\220);\220\2161\"\251\312\024#\033\177\205gL\254\tcT1\354X\314\366=Y\3531\004\373R\333\336\274\034q\034\177I\340\211\024wd\275\n\221\365\307\\xK\035\032\034\204\302X\307[X+K\034\033\034\022M\345\n57-\2544knZP!\321\002CS\263\\\341\246\205\02242\312\022+p\226*x\300"
+	.string	" h\301\2059\003N\211\016L\033\034\02245\313\025\232\312\025\224(\230\035T"
+	.string	"\206\204\t\023 Lp`B\311\242\206\023$J\304\300\224q!\005\227\030\2302.\244\340\202\t\025>\2500\243,\301\301\006*\004\200\304\006\016*\230-H`\360r\025\037V\320\300C\t#4\2272,Fh\326\334\264"
+	.string	""
+	.ascii	"\245\njL\320\324,WP6ehX\264h\311\34035K\345\2152\305\372\005"
+	.ascii	"0 \001\f0\201\206\344Mp@\t\016(A\275\t\016\b\021\302\001\f\b"
+	.ascii	"\261\236\001!\256\022\305\ne\223Y\203\t\034%M\215\f,Me\n\224"
+	.ascii	"\027d\226)\260\222)\243\264Q.\223*J\025\324\230HQY\312\250 \201"
+	.ascii	"\"\243\\\256L\246r\231\002g\311\201\233\026\226J\030\2305\031"
+	.ascii	"4e\224/4\2272J\025(3750\225K\265\211B\204\002\224\312\245\nL"
+	.ascii	"e\263\206\n\320\320Tazh*S\2704opTP6k\2263`P\003\215\214\262\004"
+	.ascii	"\263&yS\223B\371\302\206f\315\212\02583\034Zn\200\024R0\261\201"
+	.ascii	"\016M\345\rNMs"
+	.string	"F\346*F\240a\342l\300DA\303\304i\221i\312\320\340\346\n\024\315\033\034\030P\210\260\224Q1\203\302D!\323\224\241\221i*]h\336\340\250\220l^\305\b \2262*H\320 \263\"\311D\301\322l.q8\320\2019\003\316\0223mpfp\b\2308,\260\b\2308,\360\215R\271\234a\332\330\264PA\311l\301B\243L\316\200Sb\211\303\\\266\230AQ\2337-pH\274 \263L\201\322D\321\334\300T6[\274P\263l6)\320\244Ay\202F\331\\\342\260`\321\302\004\215R\305\214\314\f\b\0268\310\240*gjdP\322\250*\232453\244M\025)j\224*\324&\n\023\23275-\222\315\033\345\n\245\215\005hj\226)64\257b\204\031\024\314\245R\206\232%\r\001\216\303B\271$\241\211\203\263$A\205\005N\n\023\205\322\346\005\231\023\037xi*\231+47\024x\261\301\301\251"
+	.ascii	"\212\364\006\247\206\271T\312p\323BS\311\344\260\276\330\330"
+	.ascii	"\324\250\200s\302FIC\r\007\232Jf\007\025M\232"
+	.ascii	"\032\0204\225\314\026%\n%\213\032N|P\262\250\341\004\006\312"
+	.ascii	"\233\032\233f\213\r(oj2\320T2;4g\224%pN\260\250\261\231Ii\316"
+	.ascii	"(K,e\22463(\312\246L\323D\212\233\232\031d\226)4\225L\345\222"
+	.ascii	"\003K\023\005\003B4ojZ\25410e"
+	.string	"\\X*\23332K\031\025$f\220Y\322pHY\312\250\230\301J\024K\034\033\034\022\0314Q\334\340\3244Yl\200\205\314\212fM\0058\210\201)\343B\212\233\232e\323\304\f2K\232\026\031pV\2504ojp8\200sByS\223\001\016\314\026\033\233\032\030V\2246)ndj\226'0`\246\330\330\324\300\2606g\224%Z\230\035llj`\340\320\234Q\226\270iA\311dQccc\001e\f8\313\246\t\033\233\032\030<4\225Le\211\025\315\231\265\2514\261\2429\243*\23326\314\033\231\345\211\025\315\231\025\245\215\314\214\211\025\315\231U\331\224i\342\224X\321\234Ai2Q0ed\270\221!\341\362\027\224#^\240\0211\342\205\021>\370\t'\220\360\300\003\032Xa\235\031\201\206\211\203\242\206\030\230K\030P4\2278,j\220\261a\301\254\241!\001\247\206\204\233\032\231\025$\314,\231$\214P"
+	.ascii	"\025\314\026\034h\322\240l\336\340\314\250"
+	.string	"\374Ora&-}rRV\311\255\344\017W\023 -2\226\255(\022#YI\241\024\237\3007,,7\227\031K\215n7\346\260#\243\363y\225\352%\213D\271eY\245\212.Y|Q\211U@\351\331!\330\223\215\243\266\202\n\353\243R\233\032\350\017GY\r)\024!\033>F4R\277+E\307\274\031]\251R\234Z\032T\005\373\261T\0307\225B.m\344EIE##\327\336\236\252Z\337P\"\214\212R\257\220\354\210\3645N\200\215\244\214$TRF\362i\211\007E\244\222NO>\375\"F\250=HGoA\036\210\254\177\262I\275+K\313\311LA*\220\030Dc\251\b\036s\372\203SR\377T\200v\272\260\2221\222HiRc\221\274d\222*\230Lr\027I\346\222%\350B\fF\"\t\300\276\256\216TF\030\022y\020\031%\263:\343\fH\217\2423\024\263\256-D\2424\315\215\311\006\2641"
+	.string	"\222\222@I\240\244\220]\342\321\"J\216\242\274\223\fzR\210\245\216\251\020\207\335\n\"\262\247'\371cwd\"\023\\P\260\260&2\006)\227t>\371\263R\366$G\252q\322\007;\243EL9\352\240\266\252\276\326\326\f\036yx\004]\022\237r"
+	.ascii	"i|\017\\\353\313NR'\251\223\004\361n\357p\251\361=L\255/?\215"
+	.ascii	"\215\311,d\253%\214\217G+\362\311\f5DH\257\261\n\031\263\246"
+	.ascii	"\264\303\254\261\372\030\263\016\t\362t\324Xu\364\360\263\276"
+	.ascii	"T1a\2422\302\331%\036-ZH\036Mk\213W\031\321\264\242\320\306\252"
+	.ascii	"\223\230\276\275\254\252\306j\223\030\213\250\203FTcU1q}q#$T"
+	.ascii	"\023a\236W\260/\361(\254\t:\344\205x5\021\355hLGc\3650f-o\320"
+	.ascii	"Hc\3250&\345\247\311\260\247\261Z\270\267j\340\203\004\211*\b"
+	.ascii	"\363\274\201\\\211G\030\356F\234\023%W\005]~\246\206"
+	.string	"\2044V\003c\224\300\240\312\200C<x\376T@5\311\032\230S\260Qkp\314\260\3615@[_\b\373\372\324?\230\347MbD\005\031f\324\347ve\344\352\337\222nI[c\325\017\317`s\222i\320\264jPC\210\020\265\b\332\006\30419\225\310\325\"yL\204\032\253Cb\\\350\260\004\263\"W\r~\350\351\251A,U\037T\235\323\215\306j\020./hP\343\277\030\256\032\300\345\345\245gs.I|<\3654\376\313\336\252AT\305S\361\3223\325\r1\362\253K\257\361_x\254\032\364\315\315\251wm5\234LE\252=\256\336\0252Yey\331\321\001\255\0256V\353\036\020\330\006\327\370/Vt/F\253\006\211qqi\032\314\363\006\032%\036\205=\373\346\260\032?\003'\253\006\213oo\352U \016\306\300\"|\253\207\237\2666\365JI\226V\236\032\334\352\241\211\215M\275\022DA\242\216\271\306\317"
+	.string	"k\365p\265c\207\252\006\363\274\204h\211Ga(\205\320&~j\332U\265\252\301$A\030\253\207\262\26225J\350\304\0212\206\216\253\321AF&\316\306\352\031\re[U\215U\263\343\001j\035\331\221\201\316\352!ol,\205,\274"
+	.string	"\021\265\035\177\253\007\302\260\260\024\322p\213G\316\373\321\370\035\332V\230\035\0348T\260\305\225\211\316*\206\372u\025,\210N\340_\007\256\025\006\t\013K\355bd\331{\342L\302u\265\353F\211\216\306-&$w6\032\253Z\331V9\216\0015~\007%5\313q\205\241QU\245^=\351\242\027sP\252\325\325\253@3:\030\215\257\030\201\036F(\276\025\006\214\212\312q%\022\250\316Nn\205\371A\203F\352\367\310\322\303\347\310\020\331\n\323\004\nM\323 \231\354\\\375h|\f\244V\030G\325IuR\245\"-\216\256\267\303\347U\251\001"
+	.string	"\341\363k\254F\255\331\206\214\"\215U\250\343\251\320\305\260\361\330X}j\257\226'\267\260$\f\200\326\r\234\220\220\324&\247\006\336\004{0]mZ\351\221\303\350\243\261\272\264\n1K\013\206\351\250\223A\025\232d\330\031$\235S#2\222$I\032\003s\030 \b\bG\023I\221d{\023@\205\f\211&UP3\3141\"#\"\"I\nR\2501\314\001\303G:\346]\035\007\323\337l_"
+	.string	"\230"
+	.ascii	"\2140_X\b\366KM\266\320\020b\205\350/\275\275\005`\263\316\243"
+	.ascii	"E3\262`}\2359\371b\235\241\\\272|\222s\343\023\322\023\021\177"
+	.ascii	"\343\270;\325\304Ky\322\242\255>}\244\2673\245V;,\320(NW\364"
+	.ascii	"x\370\341s\346\305\220\023\3638\235\367\373\237\n\035\346\347"
+	.ascii	"\375\324\270\264\036\2735\200\225\037\342.\f\226\311F\200\241"
+	.ascii	"\351\217\264n\200q[:\257\360\037\342\036\207G\224C\353\230\342"
+	.ascii	"!f\366$\262\220z\r\201r\033\317\352\270M\244\350&\205\274D\240"
+	.ascii	"\231\270\225\251*&e\032\210\276\337\352\td\354\207\330\351\272"
+	.ascii	"\340\303\002B\325"
+	.string	"t\276\273\002iW\3572\245h\035\310-\005\263\002y(\315\037\222\306\030\240E\313R\030(\300\354h\020\215\310\241\217\307Z\373\341aZ\373\366e\365\351\210b\301\305\023<\355w\254\200$y\2753\f7\321\356\310\025\f\345\306\360\341\032\273\301\013z\\8:)\034?fT\363\234\272\"_\243t1\254\217\235oh\316\342?;k\222\2342\211\264Q\220\327\221\017L/\037\013\370\032y\030\217\341\325#_T\250\341\213\263i\255 \037+\304\346Bo\321\f\366\3675\202\353u\243\217h\243?\341U\331\177\3164\323\027\033\211T\350\306\251[\332\364D\3458\376\302\354\310x\376\316\bxg4\302F@|\256s$\013\200\375\265\253`\020\332\364E\227\237A\330\233Z\316&\222\317\312\305\314\210\343\323\222\273\363\006\342`y\240!\376\222k\227A\346\342]\344_\t*M`\375b\344\375\333\266{\260\342\236\245\342#\361%"
+	.string	"\344\303\372@\372\001\335[\326.\216\324\247\305\353|\035\250\256\030\203\021n\307\037\002\272\323\251\345=\244\303u\026\b\210A?\r\026"
+	.ascii	"\022\303\365\332\204\374\274:\027`\300\230\031z\2223=h\025\243"
+	.ascii	"$\232\253SG\177\r\345+\273P\021"
+	.string	"\220\177\244}\2421c\031\212\2152\317\274[\346\033\022b\247\271\324<\2055pR\337U\021UuPO\373\032\350\306\006\251\340\253"
+	.string	"\225\256{wA\375\265\371|8\036,\026\0366\004\2024\225c\226\325t\334{\214\256\301\301@\333'\327\251\251T\002\354b@C\373\356\025\210P5\374\244\322\373u\2379u\2056\326=\367)\340-\013\3729\223\247tN\361\200\363\320\374\316W<?\261\f\364zB\336J\300\300\252\265\300\017\261Y\b\337y#\356\0176\026 \n_\004\036-\037\3114\326\245A\252\301XD\275\377"
+	.string	"$\353-\270\035\324C\200[\252J\223\246\306\254\226\211\017j^?0@p\261\336;\313`|\3327\244 \203`\275\036\312\353a\340G\212w\352\027\315\300P\250\303\222\022"
+	.ascii	"\246u<\361{\033w\201\037a\222\327\331\231-Tb\306\217\250MA\006"
+	.ascii	"\274>\377\277a\232\306]BCTF0\003\n\265\200\244\342\261\257&/"
+	.ascii	"Z\013C\377\003.\210\017\002l=\362w\235\346p\371\356*\234\004"
+	.ascii	"\310\333\350X\343\201J\3428y\201\3430\331/\217\211\320\024\230"
+	.string	"M\235\2216\225\225\207\365\203Y[\352\236\255\250\310\251\234\342\b\300\345\220\306#T\261\213M\02061\251D\207^\370\007\325~(6\006\021\376\264\3723\303w.\235e\341m\236\201\023]\223\236;\274ib9\336F\020\217],\275?`\316q/\327[\021\221M,\305A\235\2620\360|M\\|.\252qQ\007\253\305\330e\332Ll\325\263\243\214\002\013\361\244e\372t\377\227\0262E{\306\276t5u\b\246\252\277\223\3450^\242ep\363\312\022\212\ny\2702\377\310\244z\b\377j5\t\310j \260\"\fb\024rd+$JH\326\007\007\342\373\231\336{\005\354\016\222\273\367\246\345\230o\2330\"\261V\217\306\376\266\234\264c\272\365\353\266|\236\310}\300\324F\317n\360R\235}0\232\016=\215\275\370_D-\b\324K\223\025?\304\302\214O\221\023\216\027:/\270\223\034l_\202b\223\236g\232\355\307"
+	.ascii	"\022v\360A,\271\004\337\357\255I\2457\024\275\322=\250\227{~"
+	.ascii	"za\303);\332\230\367\017\212\225\250Y\327\200\316I\360Pz\210"
+	.ascii	"\016W\264\373^\017 \375\341\274\225\034&\232\257\3248k\035\370"
+	.ascii	"\016\214[\206\250\324\371\210\006\327\333\346\204u\352\222r\007"
+	.ascii	"\t\020i\255\023t\034\277\026\217\242\353y'F#\022=[\232\371P\377"
+	.ascii	"hn$\364\374\262\311\321\254\353\215\214@\324+\320\032\272\240"
+	.ascii	"\244\243A\277\312\200\345\270\001\3073\203W\312!V\036\334\020"
+	.ascii	"\237pQ\320\016\226\t\365\025\344#\231\226A\306\207\233\266$O"
+	.ascii	"\241.\354O\260\331\201\265y\351\2469\022,\013a\310\240\r\317"
+	.ascii	"6\211MY\372A(\254\267\330!\340\351\331\272\2274\340\336\207T"
+	.ascii	"\257l8C\252\026s\222\257\213"
+	.string	"_z\333;\310k\265\217V \240&\251\377I_\237\204Y\036\347\022\342\264\333\017_z\261\210\210\332\363Fz1\026r\307\240\366\346\254AI1\344b4\274zKP0H\263\231\232\231\027\312bM\212\bq\242W\336\245\245|z\375\0075\2640\326\260(\214:\232\031\004ZF\262o\250\337\"\005<\t\261\364G\321\350\216\344\003\330\034\013\331x\004\351\0322\034\322Wkz\246\215\246\033\b\237\255\267\270\f\024\2731.\265V\271\203\\\256\341mI[JE\032R\224\341\211SL\303\027\217\245*z$yE\250\240n\327\024_\340C\013\230&Z.\340*\375]\303\324T;w\237\036\227\022\246\336\005\2140S\034~\264\347\\\352\226^\235\353\006\202\320\216#?Z\030\214\344\304.\304\213\274G\374n\240O\201^F\016;\024\001\226xv\300!\270\372\344U\222(\021\207i\253\260\3416\030\202\322\372\037sD\216\025"
+	.string	"M\232\341\t\002\370)R\322\205"
+	.ascii	"\247\033g\036\024\210L\023\256\350g\026X\360\300\321\253\267"
+	.ascii	"f\247\225\f\2542X\342\215(\016\324\335\2719\036A\264\007\342"
+	.ascii	"\231\2614\227\210zB\3423R\024\242\371\354t*\263N]\227\017\031"
+	.ascii	"\305\004\211v\035\325\325\237a]\024\352\265\222Hv\371]\026T\n"
+	.ascii	"`7\022\244\310v2)\266i\b\215\332ko\274|\367\356\346\212\302X"
+	.ascii	"\377Q\325\344\305\374\216/\233\005\036R\003f\004\353\341\220"
+	.ascii	"\376e<\340\223O\262sX\312\336\267\201\307\276\307a\006\374*\220"
+	.ascii	"L\226\323u\364\213\035\304=a\360\327>V\311\374w\325\030y\250"
+	.ascii	"f\326\276\326\264\371\216\200S4\250\215\025\020{\260\321\346"
+	.ascii	"}\370\013X]\311\313\343\265 K\"\006\333\206\247N\232\273\244"
+	.ascii	"\343\365\233N\265\264\252\354Z\260\206\013>\006\237<O~\020{\244"
+	.ascii	"\021\r\341\360\026,\031(\201\342\026\303Tc9]n1\237X\265\226?"
+	.ascii	")\223\367\bQ(:.\346\323\311\330]\006\037[\365H\201Lz\f\265\005"
+	.ascii	"%\027\333i\326{\205\f\302{Or\b\255\317\264\311\230\020~l\253"
+	.ascii	"\031\2101w\006 m9J[\271N\2476\341\353\276)\003\215i#\257\313"
+	.ascii	"\272:*\213\310cX\311\001\252\311\004\007\t\353'\300\256_\027"
+	.ascii	"\r\243\236k\323\254\265<<s\2158G\235M\026z\016m \322\322\177"
+	.ascii	"\300\204\311h\0047\267\202A\241\300\"*\f\301\214\362\n\003\204"
+	.ascii	"s\352\034\357\331@\237\214\214=w\303*\212\330w\bI\345\335\344"
+	.ascii	"\335\346K\305\202\324r\377gu\273\205\320:\352\375\330A\236n\003"
+	.ascii	"L\312\241\034\215jI\3649T\227\tG\361\254R\024\224\221\022\371"
+	.ascii	"\301\344quV\367\031\244\336\300\344\027\246\"\0215\217\310^\264"
+	.ascii	"\367\024\013+\333\217\243@\204\321\363\033-\220\036%-\375\"~"
+	.ascii	"X\016\221\2638Wr\037\266y\275\320\375\235-\021HS\3320\216;\325"
+	.ascii	"\325R\343\t\272\205\f\301NI"
+	.string	"\321h\351\341z\206\225\217i\034_\211\256\242x\001\021\b\256\001RaX\241\363\252\273HY\263\277\372\234\350n\255\314Qj\351\264\200\217>\226\305V\361;\317H\320k\363\313f\313\002\307\377\322\376\363,\372\363I9?v`\373\027{\200C\342{Q\022\262I\004\271\234\f\016\017\245\372\226y\272\n\257PF\360C,\362d\207\367W(\355\346d\027>8l\2013O\227\347\222:;y\t\n><\n\342f$%\344@\246\371i$@0\036a\246\227\327\003\026rg\325\347\1779\354U\227/\013\277E\321\002\302\301}\210\026\321>8-\n)g\034y\022i\245\234j\350,wZF\250\022{=\277\261\"\254h,\241\216=F\254f\372\232\265\"\fy2X#\264\200y{C\363\244E\365R\356ZC\220\343v\226\227\300\007\271T\036\366\245oZ\335\326\022\363\345\241A\341\024/\356P\\\376\232|\230\226\b"
+	.ascii	"\316r%Z\314X\313R?\325\223{\345_\004\241Mr\253_`8\031\25341|"
+	.ascii	"\306\273\263\215d\267l\241\320\260\r\004P\255\253\335\013\211"
+	.ascii	"'f\222\246\034\315\372\323\3534\346'4u\225\222\355\261\265\001"
+	.ascii	"\2412\022b\340\335pV\256F\270i\252\3767z2'\275\264\261\315\025"
+	.ascii	"\026x\350\226\344\222\247\252\272\006\351\274s%/ub\002\260\332"
+	.ascii	"\304\213y\311\230;3\263\332Q\271\262\311cYX\271\312\177\250\256"
+	.ascii	"\324\372\f\322\243x\331}\331\375G[~Sv\231.C\347m\257\3254\r_"
+	.ascii	"&q@\372\254+mq\342\352\231\277\374J\222\373Z&C\3515\202G\240"
+	.ascii	"\345\321V\352jM)\032"
+	.ascii	"-\321\324\274\245\036N\3377\362sa\362\021\035\217\340\371)Nd"
+	.ascii	"\207F{\n\360<\265\033\314\313#\037\203\261#\016'\342\317}\315"
+	.ascii	"\335\321\263\313\377\315?75\367U\326I\205\366(\302\242N\034m"
+	.ascii	"\266;3\\\237\352c\241\307D\364\245izL\314_\362\315\3265\333\016"
+	.ascii	"D\257a\026\212\270U7p\2558\352%\362\203\312\3161\240\265\030"
+	.ascii	"8\017\255\035K\324#R\375 \016{\025C\267\352\372\224\254.\205"
+	.ascii	"\266G9G\2072+\372\023C\335I\220\336\204\324\231\234,^\262\326"
+	.ascii	"U\177j^\347Gu\nh\"\203\217\341o\345\217\321\377\374\007?\355"
+	.ascii	"\025\336+\254u\016\026\254\"\300\265[d\310X\366\373\375\220\377"
+	.ascii	"\251\245\317\266g\031q|In\377p}\307\206_\301G2\354\307\"\373"
+	.ascii	"~a\354}\226k\234exo\353b[\373\375[\266\006|\025\267G\004ON\275"
+	.ascii	"v\322+\331r\277\222\027\021<*\025\377\253+\213\266q|\177\256"
+	.ascii	"\202\314\034%\215\262d\006\034\371\213'>\330o\221\264\034\030"
+	.ascii	"\276A48\222\364\340\377\236U\020\277\262\262\363:.!\356,\017"
+	.ascii	"\2507]&\023\365\026\357IOl\370\367fY\303s\356\326\277\313\375"
+	.ascii	"\022\3454\273\255\003\236\265\327?2^\205\365\007\227WB\375\247"
+	.ascii	"\372\326\315\033Ao\246\360\001X\322\361}\"\267`\367E`C\366\016"
+	.ascii	"@\307c\330\337n\215\377v\005\r\317T\237\013\263\035jwW\364\275"
+	.ascii	"\005\3670\265\236D\362=\f\035b\372\334\374\261\033\262\241qF"
+	.ascii	"\202\331\023e\005\021\270\333d\350\224\345w}\363\300sB\317\366"
+	.ascii	"\017bOk\020\314Gh~\363sF\362\323v\317\247\335*y\365?\310\303"
+	.ascii	"\013\016T\366\314Cu\322\241\224\341\232\316\256"
+	.text
+	.section	.gnu.lto_.symtab.987001d55aa12290,"e",@progbits
+	.string	"frskyOSDDisplayPortInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\271\002"
+	.string	""
+	.string	"frskyOSDGetPixelHeight"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"frskyOSDGetPixelWidth"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\002"
+	.string	""
+	.string	"frskyOSDContextPop"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\303\002"
+	.string	""
+	.string	"frskyOSDContextPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\305\002"
+	.string	""
+	.string	"frskyOSDCtmRotate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\002"
+	.string	""
+	.string	"frskyOSDCtmScale"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"frskyOSDCtmTranslate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\002"
+	.string	""
+	.string	"frskyOSDCtmSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\331\002"
+	.string	""
+	.string	"frskyOSDCtmReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"frskyOSDFillStrokeEllipseInRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"frskyOSDFillEllipseInRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"frskyOSDStrokeEllipseInRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\002"
+	.string	""
+	.string	"frskyOSDFillStrokeRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\350\002"
+	.string	""
+	.string	"frskyOSDFillRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\352\002"
+	.string	""
+	.string	"frskyOSDStrokeRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\354\002"
+	.string	""
+	.string	"frskyOSDFillStrokeTriangle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\365\002"
+	.string	""
+	.string	"frskyOSDFillTriangle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\367\002"
+	.string	""
+	.string	"frskyOSDStrokeTriangle"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\371\002"
+	.string	""
+	.string	"frskyOSDStrokeLineToPoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\376\002"
+	.string	""
+	.string	"frskyOSDMoveToPoint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\003"
+	.string	""
+	.string	"frskyOSDDrawStringMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"frskyOSDDrawString"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\022\003"
+	.string	""
+	.string	"frskyOSDDrawCharacterMask"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\032\003"
+	.string	""
+	.string	"frskyOSDDrawCharacter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"frskyOSDResetDrawingState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"#\003"
+	.string	""
+	.string	"frskyOSDClearRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"%\003"
+	.string	""
+	.string	"frskyOSDClipToRect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"'\003"
+	.string	""
+	.string	"frskyOSDSetLineOutlineColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"+\003"
+	.string	""
+	.string	"frskyOSDSetLineOutlineType"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"2\003"
+	.string	""
+	.string	"frskyOSDSetStrokeWidth"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"frskyOSDSetPixelToFillColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"8\003"
+	.string	""
+	.string	"frskyOSDSetPixelToStrokeColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	":\003"
+	.string	""
+	.string	"frskyOSDSetPixel"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"frskyOSDSetColorInversion"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"D\003"
+	.string	""
+	.string	"frskyOSDSetStrokeAndFillColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"F\003"
+	.string	""
+	.string	"frskyOSDSetFillColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"H\003"
+	.string	""
+	.string	"frskyOSDSetStrokeColor"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"J\003"
+	.string	""
+	.string	"frskyOSDCommitTransaction"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"frskyOSDBeginTransaction"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"S\003"
+	.string	""
+	.string	"frskyOSDGetGridCols"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"U\003"
+	.string	""
+	.string	"frskyOSDGetGridRows"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"frskyOSDIsReady"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"Z\003"
+	.string	""
+	.string	"frskyOSDWriteFontCharacter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"displayFontMetadataUpdateFromCharacter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\003"
+	.string	""
+	.string	"frskyOSDReadFontCharacter"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"k\003"
+	.string	""
+	.string	"frskyOSDReadCharInGrid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"frskyOSDDrawCharInGrid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\003"
+	.string	""
+	.string	"frskyOSDDrawStringInGrid"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"frskyOSDUpdate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\003"
+	.string	""
+	.string	"frskyOSDClearScreen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\204\003"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"frskyOSDInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.987001d55aa12290,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,8644 @@
+	.file	"displayport_hott.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/drivers/display.h"
+	.file 5 "./src/main/cms/cms.h"
+	.file 6 "./src/main/telemetry/hott.h"
+	.file 7 "./src/main/io/displayport_hott.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	displayport_hott.c.15377ace
+	.weak	displayport_hott.c.15377ace
+displayport_hott.c.15377ace:
+	.long	0x77a
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x16
+	.long	.LASF1183
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1081
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1082
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1083
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1084
+	.uleb128 0x4
+	.long	.LASF1086
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1085
+	.uleb128 0x4
+	.long	.LASF1087
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1088
+	.uleb128 0x4
+	.long	.LASF1089
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x17
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF1090
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1091
+	.uleb128 0x18
+	.byte	0x8
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1092
+	.uleb128 0xb
+	.long	0x8c
+	.uleb128 0x4
+	.long	.LASF1093
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x4
+	.long	.LASF1094
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x4
+	.long	.LASF1095
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x4
+	.long	.LASF1096
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x3
+	.long	0x93
+	.uleb128 0x4
+	.long	.LASF1097
+	.byte	0x4
+	.byte	0x19
+	.byte	0x1f
+	.long	0xde
+	.uleb128 0xb
+	.long	0xcd
+	.uleb128 0xc
+	.long	.LASF1105
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1098
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x108
+	.uleb128 0x7
+	.long	.LASF1099
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1100
+	.byte	0x1
+	.uleb128 0x7
+	.long	.LASF1101
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1102
+	.byte	0x4
+	.byte	0x25
+	.byte	0x3
+	.long	0xea
+	.uleb128 0x4
+	.long	.LASF1103
+	.byte	0x4
+	.byte	0x2b
+	.byte	0x11
+	.long	0xa4
+	.uleb128 0x4
+	.long	.LASF1104
+	.byte	0x4
+	.byte	0x41
+	.byte	0x20
+	.long	0x12c
+	.uleb128 0xc
+	.long	.LASF1106
+	.uleb128 0x4
+	.long	.LASF1107
+	.byte	0x4
+	.byte	0x42
+	.byte	0x26
+	.long	0x13d
+	.uleb128 0xc
+	.long	.LASF1108
+	.uleb128 0x4
+	.long	.LASF1109
+	.byte	0x4
+	.byte	0x43
+	.byte	0x24
+	.long	0x153
+	.uleb128 0xb
+	.long	0x142
+	.uleb128 0x10
+	.long	.LASF1129
+	.byte	0x98
+	.byte	0x56
+	.long	0x243
+	.uleb128 0x2
+	.long	.LASF1110
+	.byte	0x57
+	.byte	0xb
+	.long	0x309
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1111
+	.byte	0x58
+	.byte	0xb
+	.long	0x309
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1112
+	.byte	0x59
+	.byte	0xb
+	.long	0x309
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1113
+	.byte	0x5a
+	.byte	0xb
+	.long	0x309
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1114
+	.byte	0x5b
+	.byte	0xb
+	.long	0x322
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF1115
+	.byte	0x5c
+	.byte	0xb
+	.long	0x34a
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF1116
+	.byte	0x5d
+	.byte	0xb
+	.long	0x372
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF1117
+	.byte	0x5e
+	.byte	0xb
+	.long	0x3a4
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF1118
+	.byte	0x5f
+	.byte	0xb
+	.long	0x3b8
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF1119
+	.byte	0x60
+	.byte	0xb
+	.long	0x309
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF1120
+	.byte	0x61
+	.byte	0xc
+	.long	0x3c8
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF1121
+	.byte	0x62
+	.byte	0x10
+	.long	0x3dc
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF1122
+	.byte	0x63
+	.byte	0x18
+	.long	0x3f0
+	.byte	0x60
+	.uleb128 0x2
+	.long	.LASF1123
+	.byte	0x64
+	.byte	0xb
+	.long	0x40e
+	.byte	0x68
+	.uleb128 0x2
+	.long	.LASF1124
+	.byte	0x65
+	.byte	0xb
+	.long	0x431
+	.byte	0x70
+	.uleb128 0x2
+	.long	.LASF1125
+	.byte	0x66
+	.byte	0xb
+	.long	0x445
+	.byte	0x78
+	.uleb128 0x2
+	.long	.LASF1126
+	.byte	0x67
+	.byte	0xc
+	.long	0x45a
+	.byte	0x80
+	.uleb128 0x2
+	.long	.LASF1127
+	.byte	0x68
+	.byte	0xc
+	.long	0x3c8
+	.byte	0x88
+	.uleb128 0x2
+	.long	.LASF1128
+	.byte	0x69
+	.byte	0xb
+	.long	0x478
+	.byte	0x90
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF1130
+	.byte	0x20
+	.byte	0x45
+	.long	0x2df
+	.uleb128 0x2
+	.long	.LASF1131
+	.byte	0x46
+	.byte	0x20
+	.long	0x2df
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1132
+	.byte	0x47
+	.byte	0xb
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF1133
+	.byte	0x48
+	.byte	0xd
+	.long	0xa4
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF1134
+	.byte	0x49
+	.byte	0xd
+	.long	0xa4
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF1135
+	.byte	0x4a
+	.byte	0xd
+	.long	0xa4
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF1136
+	.byte	0x4b
+	.byte	0xd
+	.long	0xa4
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF1137
+	.byte	0x4e
+	.byte	0x9
+	.long	0xe3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF1138
+	.byte	0x4f
+	.byte	0x9
+	.long	0xe3
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF1139
+	.byte	0x50
+	.byte	0xc
+	.long	0x98
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF1140
+	.byte	0x51
+	.byte	0xc
+	.long	0x98
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF1141
+	.byte	0x52
+	.byte	0x16
+	.long	0x114
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF1142
+	.byte	0x53
+	.byte	0xe
+	.long	0xb0
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x3
+	.long	0x14e
+	.uleb128 0x4
+	.long	.LASF1143
+	.byte	0x4
+	.byte	0x54
+	.byte	0x3
+	.long	0x243
+	.uleb128 0xb
+	.long	0x2e4
+	.uleb128 0x6
+	.long	0x70
+	.long	0x304
+	.uleb128 0x1
+	.long	0x304
+	.byte	0
+	.uleb128 0x3
+	.long	0x2e4
+	.uleb128 0x3
+	.long	0x2f5
+	.uleb128 0x6
+	.long	0x70
+	.long	0x31d
+	.uleb128 0x1
+	.long	0x31d
+	.byte	0
+	.uleb128 0x3
+	.long	0x2f0
+	.uleb128 0x3
+	.long	0x30e
+	.uleb128 0x6
+	.long	0x70
+	.long	0x34a
+	.uleb128 0x1
+	.long	0x304
+	.uleb128 0x1
+	.long	0xa4
+	.uleb128 0x1
+	.long	0xa4
+	.uleb128 0x1
+	.long	0xc8
+	.uleb128 0x1
+	.long	0x114
+	.byte	0
+	.uleb128 0x3
+	.long	0x327
+	.uleb128 0x6
+	.long	0x70
+	.long	0x372
+	.uleb128 0x1
+	.long	0x304
+	.uleb128 0x1
+	.long	0xa4
+	.uleb128 0x1
+	.long	0xa4
+	.uleb128 0x1
+	.long	0xb0
+	.uleb128 0x1
+	.long	0x114
+	.byte	0
+	.uleb128 0x3
+	.long	0x34f
+	.uleb128 0x6
+	.long	0xe3
+	.long	0x39a
+	.uleb128 0x1
+	.long	0x304
+	.uleb128 0x1
+	.long	0xa4
+	.uleb128 0x1
+	.long	0xa4
+	.uleb128 0x1
+	.long	0x39a
+	.uleb128 0x1
+	.long	0x39f
+	.byte	0
+	.uleb128 0x3
+	.long	0xb0
+	.uleb128 0x3
+	.long	0x114
+	.uleb128 0x3
+	.long	0x377
+	.uleb128 0x6
+	.long	0xe3
+	.long	0x3b8
+	.uleb128 0x1
+	.long	0x31d
+	.byte	0
+	.uleb128 0x3
+	.long	0x3a9
+	.uleb128 0x11
+	.long	0x3c8
+	.uleb128 0x1
+	.long	0x304
+	.byte	0
+	.uleb128 0x3
+	.long	0x3bd
+	.uleb128 0x6
+	.long	0xbc
+	.long	0x3dc
+	.uleb128 0x1
+	.long	0x31d
+	.byte	0
+	.uleb128 0x3
+	.long	0x3cd
+	.uleb128 0x6
+	.long	0x114
+	.long	0x3f0
+	.uleb128 0x1
+	.long	0x31d
+	.byte	0
+	.uleb128 0x3
+	.long	0x3e1
+	.uleb128 0x6
+	.long	0xe3
+	.long	0x409
+	.uleb128 0x1
+	.long	0x409
+	.uleb128 0x1
+	.long	0x31d
+	.byte	0
+	.uleb128 0x3
+	.long	0x131
+	.uleb128 0x3
+	.long	0x3f5
+	.uleb128 0x6
+	.long	0x70
+	.long	0x42c
+	.uleb128 0x1
+	.long	0x304
+	.uleb128 0x1
+	.long	0xb0
+	.uleb128 0x1
+	.long	0x42c
+	.byte	0
+	.uleb128 0x3
+	.long	0xd9
+	.uleb128 0x3
+	.long	0x413
+	.uleb128 0x6
+	.long	0xe3
+	.long	0x445
+	.uleb128 0x1
+	.long	0x304
+	.byte	0
+	.uleb128 0x3
+	.long	0x436
+	.uleb128 0x11
+	.long	0x45a
+	.uleb128 0x1
+	.long	0x304
+	.uleb128 0x1
+	.long	0x108
+	.byte	0
+	.uleb128 0x3
+	.long	0x44a
+	.uleb128 0x6
+	.long	0xe3
+	.long	0x473
+	.uleb128 0x1
+	.long	0x473
+	.uleb128 0x1
+	.long	0x31d
+	.byte	0
+	.uleb128 0x3
+	.long	0x120
+	.uleb128 0x3
+	.long	0x45f
+	.uleb128 0x3
+	.long	0x482
+	.uleb128 0x19
+	.uleb128 0xf
+	.long	0x30
+	.byte	0x5
+	.byte	0x9
+	.long	0x4bf
+	.uleb128 0x7
+	.long	.LASF1144
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF1145
+	.byte	0x1
+	.uleb128 0x7
+	.long	.LASF1146
+	.byte	0x2
+	.uleb128 0x7
+	.long	.LASF1147
+	.byte	0x3
+	.uleb128 0x7
+	.long	.LASF1148
+	.byte	0x4
+	.uleb128 0x7
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1150
+	.byte	0x6
+	.uleb128 0x7
+	.long	.LASF1151
+	.byte	0x7
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF1152
+	.byte	0x5
+	.byte	0x12
+	.byte	0x3
+	.long	0x483
+	.uleb128 0x1a
+	.long	.LASF1184
+	.byte	0x5
+	.byte	0x15
+	.byte	0xc
+	.long	0xe3
+	.uleb128 0x1b
+	.long	.LASF1185
+	.byte	0x7
+	.byte	0x1d
+	.byte	0xf
+	.long	0x2e4
+	.uleb128 0x1c
+	.long	.LASF1170
+	.byte	0x7
+	.byte	0x6d
+	.byte	0x22
+	.long	0x14e
+	.uleb128 0x1d
+	.long	.LASF1161
+	.byte	0x5
+	.byte	0x1f
+	.byte	0x10
+	.long	0x304
+	.uleb128 0x12
+	.long	.LASF1158
+	.byte	0x5
+	.byte	0x26
+	.long	0x50c
+	.uleb128 0x1
+	.long	0x4bf
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1155
+	.byte	0x5
+	.byte	0x21
+	.byte	0x6
+	.uleb128 0xd
+	.long	.LASF1153
+	.byte	0x1e
+	.byte	0x5
+	.long	0xe3
+	.long	0x529
+	.uleb128 0x1
+	.long	0x304
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1154
+	.byte	0x18
+	.byte	0x5
+	.long	0xe3
+	.long	0x53e
+	.uleb128 0x1
+	.long	0x304
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1156
+	.value	0x1f6
+	.uleb128 0x13
+	.long	.LASF1157
+	.value	0x1f7
+	.uleb128 0x1f
+	.long	.LASF1159
+	.byte	0x6
+	.value	0x1f8
+	.byte	0x6
+	.long	0x569
+	.uleb128 0x1
+	.long	0xa4
+	.uleb128 0x1
+	.long	0xa4
+	.uleb128 0x1
+	.long	0x8c
+	.byte	0
+	.uleb128 0xd
+	.long	.LASF1160
+	.byte	0x23
+	.byte	0x6
+	.long	0x83
+	.long	0x583
+	.uleb128 0x1
+	.long	0x304
+	.uleb128 0x1
+	.long	0x47d
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1162
+	.byte	0x6
+	.value	0x1f5
+	.byte	0x5
+	.long	0xe3
+	.uleb128 0x12
+	.long	.LASF1163
+	.byte	0x4
+	.byte	0x8b
+	.long	0x5a6
+	.uleb128 0x1
+	.long	0x304
+	.uleb128 0x1
+	.long	0x2df
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1186
+	.byte	0x7
+	.byte	0x92
+	.byte	0x6
+	.long	0x5c9
+	.uleb128 0x5
+	.long	.LASF1164
+	.byte	0x92
+	.byte	0x1c
+	.long	0xa4
+	.uleb128 0x5
+	.long	.LASF1165
+	.byte	0x92
+	.byte	0x29
+	.long	0xe3
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1166
+	.byte	0x8a
+	.uleb128 0x14
+	.long	.LASF1167
+	.byte	0x85
+	.uleb128 0x22
+	.long	.LASF1168
+	.byte	0x7
+	.byte	0x7b
+	.byte	0x10
+	.long	0x304
+	.uleb128 0x9
+	.long	.LASF1171
+	.byte	0x65
+	.byte	0xc
+	.long	0x70
+	.long	0x607
+	.uleb128 0x5
+	.long	.LASF1169
+	.byte	0x65
+	.byte	0x27
+	.long	0x304
+	.uleb128 0xe
+	.string	"cnt"
+	.byte	0x67
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1172
+	.byte	0x5f
+	.byte	0xc
+	.long	0x70
+	.long	0x622
+	.uleb128 0x5
+	.long	.LASF1169
+	.byte	0x5f
+	.byte	0x24
+	.long	0x304
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1173
+	.byte	0x59
+	.byte	0x11
+	.long	0xbc
+	.long	0x63d
+	.uleb128 0x5
+	.long	.LASF1169
+	.byte	0x59
+	.byte	0x36
+	.long	0x31d
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1181
+	.byte	0x7
+	.byte	0x54
+	.byte	0xd
+	.long	0x655
+	.uleb128 0x5
+	.long	.LASF1169
+	.byte	0x54
+	.byte	0x27
+	.long	0x304
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1174
+	.byte	0x4b
+	.byte	0xc
+	.long	0x70
+	.long	0x670
+	.uleb128 0x5
+	.long	.LASF1169
+	.byte	0x4b
+	.byte	0x29
+	.long	0x304
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1175
+	.byte	0x45
+	.byte	0xc
+	.long	0xe3
+	.long	0x68b
+	.uleb128 0x5
+	.long	.LASF1169
+	.byte	0x45
+	.byte	0x3a
+	.long	0x31d
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1176
+	.byte	0x3b
+	.byte	0xc
+	.long	0x70
+	.long	0x6c0
+	.uleb128 0x5
+	.long	.LASF1169
+	.byte	0x3b
+	.byte	0x2b
+	.long	0x304
+	.uleb128 0x15
+	.uleb128 0xe
+	.string	"row"
+	.byte	0x3d
+	.byte	0xe
+	.long	0x70
+	.uleb128 0x15
+	.uleb128 0xe
+	.string	"col"
+	.byte	0x3e
+	.byte	0x12
+	.long	0x70
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1177
+	.byte	0x33
+	.byte	0xc
+	.long	0x70
+	.long	0x705
+	.uleb128 0x5
+	.long	.LASF1169
+	.byte	0x33
+	.byte	0x2b
+	.long	0x304
+	.uleb128 0xa
+	.string	"col"
+	.byte	0x33
+	.byte	0x40
+	.long	0xa4
+	.uleb128 0xa
+	.string	"row"
+	.byte	0x33
+	.byte	0x4d
+	.long	0xa4
+	.uleb128 0xa
+	.string	"s"
+	.byte	0x33
+	.byte	0x5e
+	.long	0xc8
+	.uleb128 0x5
+	.long	.LASF1178
+	.byte	0x33
+	.byte	0x72
+	.long	0x114
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1179
+	.byte	0x2a
+	.byte	0xc
+	.long	0x70
+	.long	0x74a
+	.uleb128 0x5
+	.long	.LASF1169
+	.byte	0x2a
+	.byte	0x29
+	.long	0x304
+	.uleb128 0xa
+	.string	"col"
+	.byte	0x2a
+	.byte	0x3e
+	.long	0xa4
+	.uleb128 0xa
+	.string	"row"
+	.byte	0x2a
+	.byte	0x4b
+	.long	0xa4
+	.uleb128 0xa
+	.string	"c"
+	.byte	0x2a
+	.byte	0x59
+	.long	0xb0
+	.uleb128 0x5
+	.long	.LASF1178
+	.byte	0x2a
+	.byte	0x6d
+	.long	0x114
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF1180
+	.byte	0x25
+	.byte	0xc
+	.long	0x70
+	.long	0x765
+	.uleb128 0x5
+	.long	.LASF1169
+	.byte	0x25
+	.byte	0x30
+	.long	0x31d
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1182
+	.byte	0x7
+	.byte	0x1f
+	.byte	0xc
+	.long	0x70
+	.uleb128 0x5
+	.long	.LASF1169
+	.byte	0x1f
+	.byte	0x2a
+	.long	0x304
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 8 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xa
+	.file 11 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xc
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 13 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 14 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0xe
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 17 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 19 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x13
+	.file 20 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x10
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 24 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 25 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 28 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 29 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1d
+	.file 30 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 31 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x1f
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 32 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x20
+	.byte	0x4
+	.file 33 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.file 34 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x4
+	.file 35 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x23
+	.file 36 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 37 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 38 "./src/main/cms/cms_types.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF830
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF831
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF847
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF848
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF849
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF850
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF892
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF893
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF894
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF895
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF896
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF912
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF949
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF959
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF982
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF995
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1005
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms_types.h.76.f409de0df71f87830fec3704c0be05e5,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1042
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cms.h.40.31bdd40ae9c102f26f76054bc92a3e78,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1050
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.hott.h.29.1942f734bb6d6d9b029e5a3a18c24c78,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1080
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF1187
+	.long	.LASF1188
+	.long	.LASF1189
+	.long	.LASF1190
+	.long	.LASF1191
+	.long	.LASF1192
+	.long	.LASF1193
+	.long	.LASF1194
+	.long	.LASF1195
+	.long	.LASF1196
+	.long	.LASF1197
+	.long	.LASF1198
+	.long	.LASF1199
+	.long	.LASF1200
+	.long	.LASF1201
+	.long	.LASF1202
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x27
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1203
+	.byte	0xc
+	.long	.LASF1204
+	.byte	0xc
+	.long	.LASF1205
+	.byte	0xc
+	.long	.LASF1206
+	.byte	0x5
+	.long	.LASF1207
+	.byte	0x2
+	.long	.LASF1208
+	.byte	0x9
+	.long	.LASF1209
+	.byte	0x6
+	.long	.LASF1210
+	.byte	0xf
+	.long	.LASF1211
+	.byte	0x10
+	.long	.LASF1212
+	.byte	0x10
+	.long	.LASF1212
+	.byte	0xf
+	.long	.LASF1213
+	.byte	0xc
+	.long	.LASF1214
+	.byte	0xf
+	.long	.LASF1215
+	.byte	0xf
+	.long	.LASF1216
+	.byte	0xc
+	.long	.LASF1217
+	.byte	0xc
+	.long	.LASF1218
+	.byte	0xe
+	.long	.LASF1219
+	.byte	0xc
+	.long	.LASF1220
+	.byte	0xd
+	.long	.LASF1221
+	.byte	0xd
+	.long	.LASF1222
+	.byte	0xc
+	.long	.LASF1223
+	.byte	0xc
+	.long	.LASF1224
+	.byte	0xc
+	.long	.LASF1225
+	.byte	0xf
+	.long	.LASF1226
+	.byte	0x10
+	.long	.LASF1227
+	.byte	0xb
+	.long	.LASF1228
+	.byte	0xb
+	.long	.LASF1229
+	.byte	0xf
+	.long	.LASF1230
+	.byte	0xa
+	.long	.LASF1231
+	.byte	0x8
+	.long	.LASF1232
+	.byte	0x7
+	.long	.LASF1233
+	.byte	0x8
+	.long	.LASF1234
+	.byte	0x8
+	.long	.LASF1235
+	.byte	0x3
+	.long	.LASF1236
+	.byte	0x4
+	.long	.LASF1237
+	.byte	0x1
+	.long	.LASF1238
+	.byte	0x3
+	.long	.LASF1239
+	.byte	0x2
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF1173:
+	.string	"hottTxBytesFree"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF815:
+	.string	"USE_CLI_BATCH "
+.LASF1106:
+	.string	"displayCanvas_s"
+.LASF1104:
+	.string	"displayCanvas_t"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1075:
+	.string	"HOTT_TEXTMODE_DISPLAY_ROWS 8"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1186:
+	.string	"hottSetCmsKey"
+.LASF734:
+	.string	"USE_SERIALRX_FPORT "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1166:
+	.string	"hottCmsOpen"
+.LASF1062:
+	.string	"HOTT_EAM_OFFSET_M3S 120"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1054:
+	.string	"HOTTV4_BUTTON_DEC 0xB"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF805:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1130:
+	.string	"displayPort_s"
+.LASF1143:
+	.string	"displayPort_t"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF739:
+	.string	"USE_GPS "
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF1064:
+	.string	"HOTT_GPS_ALTITUDE_OFFSET 500"
+.LASF794:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF882:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF981:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF489:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF754:
+	.string	"USE_RX_UIB "
+.LASF842:
+	.string	"_WCHAR_T_H "
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1051:
+	.string	"HOTTV4_RXTX 4"
+.LASF728:
+	.string	"USE_I2C_PULLUP "
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF1134:
+	.string	"cols"
+.LASF971:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1015:
+	.string	"OSD_BACK_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_Back, 0 })"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF747:
+	.string	"USE_PITOT "
+.LASF1076:
+	.string	"HOTT_TEXTMODE_DISPLAY_COLUMNS 21"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF850:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF735:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF865:
+	.string	"USE_UART7 "
+.LASF874:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF978:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1000:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1103:
+	.string	"textAttributes_t"
+.LASF992:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF957:
+	.string	"EXTENDED_FASTRAM "
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF918:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1180:
+	.string	"hottScreenSize"
+.LASF943:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF1137:
+	.string	"useFullscreen"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1147:
+	.string	"CMS_KEY_LEFT"
+.LASF800:
+	.string	"USE_SERIALRX_SUMD "
+.LASF767:
+	.string	"USE_1WIRE_DS2482 "
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF841:
+	.string	"_WCHAR_T_DEFINED "
+.LASF789:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF892:
+	.string	"USE_VCP"
+.LASF852:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF993:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF826:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1169:
+	.string	"displayPort"
+.LASF727:
+	.string	"I2C2_OVERCLOCK false"
+.LASF975:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF939:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1023:
+	.string	"OSD_UINT8_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, 0 })"
+.LASF1027:
+	.string	"OSD_UINT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC })"
+.LASF1052:
+	.string	"HOTTV4_TEXT_MODE_REQUEST_ID 0x7f"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF872:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF766:
+	.string	"USE_1WIRE "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1068:
+	.string	"HOTT_TELEMETRY_VARIO_SENSOR_ID 0x89"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1019:
+	.string	"OSD_BOOL_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_Bool, 0 })"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF901:
+	.string	"U_ID_1 1"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF780:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF1016:
+	.string	"OSD_BACK_AND_END_ENTRY ((OSD_Entry){ \"BACK\", {.func = NULL}, NULL, OME_BACK_AND_END, 0 })"
+.LASF894:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF1108:
+	.string	"displayFontMetadata_s"
+.LASF1107:
+	.string	"displayFontMetadata_t"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF880:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF818:
+	.string	"_STDDEF_H "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF799:
+	.string	"USE_RX_MSP "
+.LASF1171:
+	.string	"hottRelease"
+.LASF513:
+	.string	"__always_inline"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF733:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1105:
+	.string	"osdCharacter_s"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF962:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1183:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1091:
+	.string	"long int"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF958:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF899:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF964:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF761:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1160:
+	.string	"cmsMenuExit"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF1018:
+	.string	"OSD_FUNC_CALL_ENTRY(label,fn) ((OSD_Entry){ label, {.func = fn}, NULL, OME_Funcall, 0 })"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF788:
+	.string	"CMS_MENU_OSD "
+.LASF877:
+	.string	"USE_DASHBOARD"
+.LASF1010:
+	.string	"READONLY (1 << 4)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1071:
+	.string	"HOTT_TELEMETRY_GAM_SENSOR_ID 0x8d"
+.LASF1115:
+	.string	"writeString"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF977:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF1073:
+	.string	"HOTT_EAM_SENSOR_TEXT_ID 0xE0"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF917:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1163:
+	.string	"displayInit"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF1162:
+	.string	"hottTextmodeIsAlive"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1040:
+	.string	"OSD_SETTING_ENTRY_TYPE(name,setting,type) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, 0, type)"
+.LASF960:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF759:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1031:
+	.string	"OSD_INT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC | READONLY })"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF968:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF1085:
+	.string	"signed char"
+.LASF959:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1094:
+	.string	"uint8_t"
+.LASF1038:
+	.string	"MENU_CHAIN_BACK (-1)"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF797:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1012:
+	.string	"OSD_LABEL_DATA_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, 0 })"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1021:
+	.string	"OSD_BOOL_FUNC_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_BoolFunc, 0 })"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF771:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1061:
+	.string	"HOTT_EAM_OFFSET_M2S 72"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF873:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1081:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1043:
+	.string	"CMS_STARTUP_HELP_TEXT1 \"MENU: THR MID\""
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF859:
+	.string	"USE_UART1 "
+.LASF1119:
+	.string	"heartbeat"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF948:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF743:
+	.string	"USE_TELEMETRY_LTM "
+.LASF914:
+	.string	"NOINLINE "
+.LASF907:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF987:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1170:
+	.string	"hottVTable"
+.LASF861:
+	.string	"USE_UART3 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1128:
+	.string	"getCanvas"
+.LASF1177:
+	.string	"hottWriteString"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1098:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF719:
+	.string	"NULL"
+.LASF1017:
+	.string	"OSD_SUBMENU_ENTRY(label,menu) ((OSD_Entry){ label, {.func = NULL}, menu, OME_Submenu, 0 })"
+.LASF731:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF984:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF911:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF928:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1059:
+	.string	"HOTTV4_BUTTON_PREV 0x7"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF698:
+	.string	"__need_size_t "
+.LASF1140:
+	.string	"grabCount"
+.LASF769:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1174:
+	.string	"hottHeartbeat"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1089:
+	.string	"__uint16_t"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1002:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1032:
+	.string	"OSD_STRING_ENTRY(label,str) ((OSD_Entry){ label, {.func = NULL}, str, OME_String, 0 })"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1025:
+	.string	"OSD_UINT8_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_UINT8, 0 })"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1110:
+	.string	"grab"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF700:
+	.string	"__size_t__ "
+.LASF1133:
+	.string	"rows"
+.LASF944:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF903:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1039:
+	.string	"OSD_SETTING_ENTRY_STEP_TYPE(name,setting,step,type) { name, NULL, &(const OSD_SETTING_t){ setting, step }, OME_Setting, type }"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1009:
+	.string	"OPTSTRING (1 << 3)"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1101:
+	.string	"DISPLAY_TRANSACTION_OPT_RESET_DRAWING"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF963:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF913:
+	.string	"FAST_CODE "
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1041:
+	.string	"OSD_SETTING_ENTRY_STEP(name,setting,step) OSD_SETTING_ENTRY_STEP_TYPE(name, setting, step, 0)"
+.LASF786:
+	.string	"USE_STATS "
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF777:
+	.string	"USE_FRSKYOSD "
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF804:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1099:
+	.string	"DISPLAY_TRANSACTION_OPT_NONE"
+.LASF1074:
+	.string	"HOTT_GPS_SENSOR_TEXT_ID 0xA0"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF851:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF980:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1048:
+	.string	"CMS_EXIT_SAVEREBOOT (2)"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF844:
+	.string	"__INT_WCHAR_T_H "
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF718:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF737:
+	.string	"USE_64BIT_TIME "
+.LASF756:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF730:
+	.string	"USE_SERIAL_RX "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF732:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF862:
+	.string	"USE_UART4 "
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF812:
+	.string	"USE_VTX_FFPV "
+.LASF1142:
+	.string	"maxChar"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF870:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF394:
+	.string	"bool _Bool"
+.LASF1020:
+	.string	"OSD_BOOL_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_Bool, 0 })"
+.LASF930:
+	.string	"STR_HELPER(x) #x"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1087:
+	.string	"__uint8_t"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF839:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1176:
+	.string	"hottClearScreen"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF784:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF1144:
+	.string	"CMS_KEY_NONE"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1026:
+	.string	"OSD_UINT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, 0 })"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF798:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF956:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF927:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF940:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF994:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1086:
+	.string	"__int8_t"
+.LASF1151:
+	.string	"CMS_KEY_SAVEMENU"
+.LASF925:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF875:
+	.string	"USE_USB_MSC"
+.LASF902:
+	.string	"U_ID_2 2"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF849:
+	.string	"__need_wchar_t"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1184:
+	.string	"cmsInMenu"
+.LASF866:
+	.string	"USE_UART8 "
+.LASF1045:
+	.string	"CMS_STARTUP_HELP_TEXT3 \"+ PITCH UP\""
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1149:
+	.string	"CMS_KEY_ESC"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1013:
+	.string	"OSD_LABEL_DATA_DYN_ENTRY(label,data) ((OSD_Entry){ label, {.func = NULL}, data, OME_Label, DYNAMIC })"
+.LASF1007:
+	.string	"PRINT_LABEL (1 << 1)"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF787:
+	.string	"USE_CMS "
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF947:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF726:
+	.string	"I2C1_OVERCLOCK false"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF779:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF970:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1100:
+	.string	"DISPLAY_TRANSACTION_OPT_PROFILED"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF910:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF966:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF908:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF935:
+	.string	"UNUSED(x) (void)(x)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1116:
+	.string	"writeChar"
+.LASF744:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1178:
+	.string	"attr"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF699:
+	.string	"__need_NULL "
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1056:
+	.string	"HOTTV4_BUTTON_SET 0x9"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF945:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF853:
+	.string	"USE_IMU_FAKE "
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF921:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1148:
+	.string	"CMS_KEY_RIGHT"
+.LASF1014:
+	.string	"OSD_LABEL_FUNC_DYN_ENTRY(label,fn) ((OSD_Entry){ label, {.func = NULL}, fn, OME_LabelFunc, DYNAMIC })"
+.LASF1030:
+	.string	"OSD_INT16_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, DYNAMIC })"
+.LASF867:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF827:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF953:
+	.string	"UNIT_TESTED "
+.LASF1035:
+	.string	"OSD_TAB_CALLBACK_ENTRY(label,cb,val) ((OSD_Entry){ label, {.func = cb}, val, OME_TAB, 0 })"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF810:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF822:
+	.string	"_T_PTRDIFF_ "
+.LASF856:
+	.string	"USE_FAKE_GPS "
+.LASF1155:
+	.string	"cmsMenuOpen"
+.LASF969:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1053:
+	.string	"HOTTV4_BINARY_MODE_REQUEST_ID 0x80"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF825:
+	.string	"_PTRDIFF_T_ "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1077:
+	.string	"HOTT_TEXTMODE_START 0x7B"
+.LASF740:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF745:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF835:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF904:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF926:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1097:
+	.string	"osdCharacter_t"
+.LASF1090:
+	.string	"__uint32_t"
+.LASF1167:
+	.string	"hottDisplayportRegister"
+.LASF884:
+	.string	"USE_PITOT_MS4525"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF983:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF1067:
+	.string	"HOTT_TELEMETRY_NO_SENSOR_ID 0x80"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF832:
+	.string	"__wchar_t__ "
+.LASF1028:
+	.string	"OSD_UINT16_RO_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT16, DYNAMIC | READONLY })"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF752:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF974:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1044:
+	.string	"CMS_STARTUP_HELP_TEXT2 \"+ YAW LEFT\""
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF837:
+	.string	"__WCHAR_T "
+.LASF965:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF802:
+	.string	"USE_SERIALRX_XBUS "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1126:
+	.string	"beginTransaction"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF895:
+	.string	"USE_RCDEVICE"
+.LASF760:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF466:
+	.string	"__PMT"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF765:
+	.string	"USE_PITOT_MS4525 "
+.LASF1165:
+	.string	"keepCmsOpen"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1154:
+	.string	"cmsDisplayPortRegister"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF920:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF820:
+	.string	"_ANSI_STDDEF_H "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1029:
+	.string	"OSD_INT16_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT16, 0 })"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1005:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF358:
+	.string	"__k8 1"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF878:
+	.string	"USE_OLED_UG2864"
+.LASF1118:
+	.string	"isTransferInProgress"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1139:
+	.string	"cursorRow"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1083:
+	.string	"unsigned int"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF776:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1114:
+	.string	"screenSize"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF885:
+	.string	"USE_PITOT_ADC"
+.LASF883:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF816:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF742:
+	.string	"USE_TELEMETRY "
+.LASF846:
+	.string	"_WCHAR_T_DECLARED "
+.LASF985:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF793:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF823:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF937:
+	.string	"BIT(x) (1 << (x))"
+.LASF821:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF898:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF795:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF751:
+	.string	"USE_GYRO_KALMAN "
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1111:
+	.string	"release"
+.LASF997:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF396:
+	.string	"false 0"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1049:
+	.string	"CMS_POPUP_SAVE (3)"
+.LASF395:
+	.string	"true 1"
+.LASF829:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1072:
+	.string	"HOTT_TELEMETRY_EAM_SENSOR_ID 0x8e"
+.LASF1060:
+	.string	"HOTT_EAM_OFFSET_HEIGHT 500"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1112:
+	.string	"clearScreen"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1181:
+	.string	"hottResync"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF782:
+	.string	"USE_ANTIGRAVITY "
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF995:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF834:
+	.string	"_WCHAR_T "
+.LASF1168:
+	.string	"displayPortHottInit"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF854:
+	.string	"USE_FAKE_BARO "
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1080:
+	.string	"HOTT_VARIO_MSG_TEXT_LEN 21"
+.LASF828:
+	.string	"_GCC_PTRDIFF_T "
+.LASF741:
+	.string	"USE_NAV "
+.LASF775:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF857:
+	.string	"USE_MAG "
+.LASF1092:
+	.string	"char"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF746:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1008:
+	.string	"DYNAMIC (1 << 2)"
+.LASF783:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF973:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF855:
+	.string	"USE_FAKE_MAG "
+.LASF869:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF991:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1127:
+	.string	"commitTransaction"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF753:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1082:
+	.string	"short unsigned int"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF923:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1070:
+	.string	"HOTT_TELEMETRY_AIRESC_SENSOR_ID 0x8c"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF949:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1003:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF806:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1093:
+	.string	"int8_t"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF1063:
+	.string	"HOTT_EAM_OFFSET_TEMPERATURE 20"
+.LASF1164:
+	.string	"hottKey"
+.LASF845:
+	.string	"_GCC_WCHAR_T "
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1069:
+	.string	"HOTT_TELEMETRY_GPS_SENSOR_ID 0x8a"
+.LASF922:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1037:
+	.string	"CMS_DATA_TYPE_OFFSET (4)"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF725:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1117:
+	.string	"readChar"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF1172:
+	.string	"hottGrab"
+.LASF1132:
+	.string	"device"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF879:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF967:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF383:
+	.string	"SITL 1"
+.LASF942:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF919:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1095:
+	.string	"uint16_t"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF824:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF979:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF781:
+	.string	"USE_D_BOOST "
+.LASF951:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF998:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF863:
+	.string	"USE_UART5 "
+.LASF976:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF773:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF912:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF717:
+	.string	"__size_t "
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF1122:
+	.string	"supportedTextAttributes"
+.LASF1079:
+	.string	"HOTT_TEXTMODE_ESC 0x01"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1153:
+	.string	"cmsDisplayPortSelect"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1159:
+	.string	"hottTextmodeWriteChar"
+.LASF1146:
+	.string	"CMS_KEY_DOWN"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF813:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF721:
+	.string	"__need_NULL"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF999:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1179:
+	.string	"hottWriteChar"
+.LASF764:
+	.string	"USE_OPFLOW_MSP "
+.LASF836:
+	.string	"_T_WCHAR "
+.LASF982:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1065:
+	.string	"HOTT_TEXT_MODE_REQUEST_ID 0x7f"
+.LASF790:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF988:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF1006:
+	.string	"PRINT_VALUE (1 << 0)"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1057:
+	.string	"HOTTV4_BUTTON_NIL 0xF"
+.LASF763:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF807:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF811:
+	.string	"USE_VTX_TRAMP "
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF736:
+	.string	"USE_ADC_AVERAGING "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1047:
+	.string	"CMS_EXIT_SAVE (1)"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1011:
+	.string	"OSD_LABEL_ENTRY(label) ((OSD_Entry){ label, {.func = NULL}, NULL, OME_Label, 0 })"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF838:
+	.string	"_WCHAR_T_ "
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF757:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF897:
+	.string	"USE_ITCM_RAM"
+.LASF929:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF809:
+	.string	"USE_VTX_CONTROL "
+.LASF896:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF840:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF803:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF934:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF1125:
+	.string	"isReady"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1055:
+	.string	"HOTTV4_BUTTON_INC 0xD"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF972:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF864:
+	.string	"USE_UART6 "
+.LASF1042:
+	.string	"OSD_SETTING_ENTRY(name,setting) OSD_SETTING_ENTRY_STEP(name, setting, 0)"
+.LASF916:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF749:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF931:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF889:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1161:
+	.string	"cmsDisplayPortGetCurrent"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF891:
+	.string	"USE_ADC"
+.LASF1033:
+	.string	"OSD_TAB_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, 0 })"
+.LASF887:
+	.string	"USE_1WIRE_DS2482"
+.LASF762:
+	.string	"USE_OPFLOW "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF888:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1058:
+	.string	"HOTTV4_BUTTON_NEXT 0xE"
+.LASF924:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1004:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1088:
+	.string	"short int"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1182:
+	.string	"hottDrawScreen"
+.LASF1036:
+	.string	"OSD_END_ENTRY ((OSD_Entry){ NULL, {.func = NULL}, NULL, OME_END, 0 })"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1135:
+	.string	"posX"
+.LASF1136:
+	.string	"posY"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1156:
+	.string	"hottTextmodeGrab"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF772:
+	.string	"USE_DASHBOARD "
+.LASF1138:
+	.string	"cleared"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF758:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1034:
+	.string	"OSD_TAB_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_TAB, DYNAMIC })"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF954:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1113:
+	.string	"drawScreen"
+.LASF996:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF831:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF990:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF955:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF774:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF909:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF833:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1150:
+	.string	"CMS_KEY_MENU"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1141:
+	.string	"cachedSupportedTextAttributes"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1123:
+	.string	"getFontMetadata"
+.LASF1066:
+	.string	"HOTT_BINARY_MODE_REQUEST_ID 0x80"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF915:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF847:
+	.string	"__DEFINED_wchar_t "
+.LASF1078:
+	.string	"HOTT_TEXTMODE_STOP 0x7D"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF936:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF952:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF770:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF858:
+	.string	"USE_BARO "
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1145:
+	.string	"CMS_KEY_UP"
+.LASF932:
+	.string	"EXPAND_I(x) x"
+.LASF1129:
+	.string	"displayPortVTable_s"
+.LASF1109:
+	.string	"displayPortVTable_t"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1175:
+	.string	"hottIsTransferInProgress"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF748:
+	.string	"USE_PITOT_ADC "
+.LASF843:
+	.string	"___int_wchar_t_h "
+.LASF941:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF755:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF890:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF860:
+	.string	"USE_UART2 "
+.LASF1124:
+	.string	"writeFontCharacter"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1022:
+	.string	"OSD_INT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_INT8, DYNAMIC })"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF848:
+	.string	"_BSD_WCHAR_T_"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF796:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1096:
+	.string	"uint32_t"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF886:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF871:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF900:
+	.string	"U_ID_0 0"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF876:
+	.string	"USE_SERVO_SBUS"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF905:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF893:
+	.string	"USE_RX_PPM"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF814:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1157:
+	.string	"hottTextmodeExit"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1121:
+	.string	"txBytesFree"
+.LASF792:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF961:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF868:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF881:
+	.string	"USE_RANGEFINDER"
+.LASF986:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF801:
+	.string	"USE_SERIALRX_SUMH "
+.LASF830:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF785:
+	.string	"USE_LOG "
+.LASF729:
+	.string	"USE_RX_PPM "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1024:
+	.string	"OSD_UINT8_DYN_ENTRY(label,val) ((OSD_Entry){ label, {.func = NULL}, val, OME_UINT8, DYNAMIC })"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF738:
+	.string	"USE_BLACKBOX "
+.LASF1046:
+	.string	"CMS_EXIT (0)"
+.LASF1001:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF946:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF819:
+	.string	"_STDDEF_H_ "
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF933:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF808:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF1131:
+	.string	"vTable"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1185:
+	.string	"hottDisplayPort"
+.LASF906:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF950:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1102:
+	.string	"displayTransactionOption_e"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1120:
+	.string	"resync"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF817:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF938:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF1158:
+	.string	"cmsSetExternKey"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF750:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1084:
+	.string	"long unsigned int"
+.LASF791:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1152:
+	.string	"cms_key_e"
+.LASF768:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF989:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF1050:
+	.string	"CMS_POPUP_SAVEREBOOT (4)"
+.LASF778:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1215:
+	.string	"features-time64.h"
+.LASF1219:
+	.string	"long-double.h"
+.LASF1228:
+	.string	"__locale_t.h"
+.LASF1230:
+	.string	"platform.h"
+.LASF1232:
+	.string	"target.h"
+.LASF1213:
+	.string	"libc-header-start.h"
+.LASF1211:
+	.string	"stdbool.h"
+.LASF1200:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1207:
+	.string	"cms.h"
+.LASF1189:
+	.string	"src/main/common"
+.LASF1204:
+	.string	"stdint-intn.h"
+.LASF1199:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1202:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1206:
+	.string	"display.h"
+.LASF1188:
+	.string	"src/main/cms"
+.LASF1193:
+	.string	"src/main/target/SITL"
+.LASF1192:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1198:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1229:
+	.string	"strings.h"
+.LASF1209:
+	.string	"displayport_hott.c"
+.LASF1239:
+	.string	"cms_types.h"
+.LASF1203:
+	.string	"types.h"
+.LASF1217:
+	.string	"timesize.h"
+.LASF1191:
+	.string	"src/main/drivers"
+.LASF1201:
+	.string	"/usr/include"
+.LASF1187:
+	.string	"src/main/build"
+.LASF1233:
+	.string	"sanity_check.h"
+.LASF1214:
+	.string	"features.h"
+.LASF1231:
+	.string	"common.h"
+.LASF1222:
+	.string	"typesizes.h"
+.LASF1227:
+	.string	"locale_t.h"
+.LASF1190:
+	.string	"src/main/config"
+.LASF1223:
+	.string	"time64.h"
+.LASF1205:
+	.string	"stdint-uintn.h"
+.LASF1194:
+	.string	"src/main/target"
+.LASF1235:
+	.string	"utils.h"
+.LASF1196:
+	.string	"src/main"
+.LASF1238:
+	.string	"time.h"
+.LASF1195:
+	.string	"src/main/telemetry"
+.LASF0:
+	.string	"./src/main/io/displayport_hott.c"
+.LASF1220:
+	.string	"stubs.h"
+.LASF1197:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1225:
+	.string	"string.h"
+.LASF1218:
+	.string	"cdefs.h"
+.LASF1212:
+	.string	"stdint.h"
+.LASF1237:
+	.string	"build_config.h"
+.LASF1224:
+	.string	"wchar.h"
+.LASF1221:
+	.string	"stubs-64.h"
+.LASF1216:
+	.string	"wordsize.h"
+.LASF1226:
+	.string	"stddef.h"
+.LASF1234:
+	.string	"common_post.h"
+.LASF1208:
+	.string	"hott.h"
+.LASF1236:
+	.string	"parameter_group.h"
+.LASF1210:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375 \274=\005"
+	.string	"4\t\260"
+	.string	"\022"
+	.string	"\300\265\356\337\r"
+	.string	"\001\355\320\326\201\t\004\002"
+	.string	"\002\001\003\263\373\315\215\002"
+	.string	"\004\300\331\242\247\b"
+	.string	"\005\204\222\352\026"
+	.string	"\006\264\244\366\333\b"
+	.string	"\007\217\342\200\251\002\b\355\213\315\371\006\003\002"
+	.string	"\002\003\t\260\242\246\356\002\002\002\004\002\003\n\262\346\234\276\003\013\355\357\374i"
+	.string	"\f\240\342\234\212\n\r\322\354\235\261\007\b\002\005\002\006\002\007\002\006\002"
+	.string	"\016\353\320\220\346\b\017\267\306\262\336\f"
+	.string	"\020\333\217\257\360\005\002\002\007\002\007\022\227\254\264\234\n\002\002\007\002\007"
+	.string	"\007"
+	.ascii	"\355\306q\271\366\225\225\340\332\347Dp\327\002\f\332"
+	.text
+	.section	.gnu.lto_.ipa_sra.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375 \364\255\003"
+	.string	"rE\017\030\260%\351\f\3030\f\3400\f\303\340\331\332\326.k\033i\255\021)S\n\356\252\302\003\301\006"
+	.string	"\277\363\330\221\242\261n\325\372\033Q\024\227\030\0261\362\264B\363\204\037U\244\237\341\270\343!\027"
+	.ascii	"\271\202\241\027`\215\f\322\f\264\304\375\f\226\013n\206\032"
+	.ascii	"\213\357\261\354\005\301\022\220\\H\241\335\031\274\034\270i"
+	.ascii	"\032\3274@\f\032\252\b\366s\"\225`7\320\006"
+	.text
+	.section	.gnu.lto_.inline.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`%\003\245\016"
+	.string	"V\324E>@\211(\215\001[{\313\362R\355Sr\315+\316{\344m5\333\350\232\361\t\362\350\304s\324\016\023R\030\203\002\257\250~\373\313\235[v\315Q\234\320L\352@\343[\311\347\266\233\304\356-e\n."
+	.string	"9"
+	.string	"8"
+	.string	"\233\272\007\241&\002\034\"q\311sJ\331\243C\270\276\337\332\311\353\3248\327\r5\327\023\244\250|\265\376bw1^??\272\273\353\376\362s\b\"\205\260 C"
+	.ascii	"\374\221\202|xtT(\024@\203\355\202e\230\331\023i\004\007\247"
+	.ascii	"\220\250yJ\350\200\021\013\006(_k\233\373\263\0275'\232\316\235"
+	.ascii	"!'aw\257-L\177-:\201\340@\2362*\351\257d\330\344\257\034YQ-\316"
+	.ascii	"N\246\t\017\036\306|\234\025\322\r\006\024\n\\_\3266\013Ha<S"
+	.ascii	"a\245\335\225\034\327\266D\335I\267\223\327\354\005\177~\321"
+	.ascii	"@\b7\357i\366c\3469\303b\266a3\373r\367\307\321T\200T\351\r\207"
+	.ascii	"\034\225\365f\007i\306\343V\253U\005\311\021\026\246$\005\031"
+	.ascii	"\265\"A\306V\250\341P\005\315\210\314\314\224\264\325`\002!T"
+	.ascii	"u\035\022\200\005Q\347\2542\024^8i\226YX\036 \022Sk\251\256\346"
+	.ascii	"\214\203Q[W\237\313-E\266\375\254\355\370\003w%7\310g\310\r\351"
+	.ascii	"\375\357\375\331\214\222\315?\013\246\264\351\017\034\003<\212"
+	.ascii	"\"\017a_0\276\003F2\313=3\334\267\303\267\256|ph\371\2068\037"
+	.ascii	"\013\373\217\222\250\204H\222\035Sk=\243?\215\350\2538/\357l"
+	.ascii	"\216\233~6\223qj\3335\375\025\007\351NxL\347\224dB1\025\202\361"
+	.ascii	"&\322\235\301\033`=g\211\033\347\266\211\352k\314\351\262\205"
+	.ascii	"\033^\027 \360\352L!\231\371\\\254-8\277..\006"
+	.text
+	.section	.gnu.lto_.jmpfuncs.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`G\001}\007"
+	.string	"\322\214\"&\220'I\007\370\353\214l\366&|\334\356\356\306"
+	.ascii	"Q\2361\372\3031a;\034\024T\314~\373\326\354\177b\367\226)\005"
+	.ascii	"\352\022\263)\274z\271\212H\225\230\255\341\370\021\250\017\247"
+	.ascii	"\016\307\250\340\017\006\366\312\250Tq\206_x\2130e\r\306\244"
+	.ascii	"\035\372\205\221\310>\230\355\360\r/1\3048\304l\n\030\200\347"
+	.ascii	"\211\215\300\\0vh\036\261\302x\236\230\237\230m\302j\371\205"
+	.ascii	"0\323\263Z\274\226\325SE{\257\270\210\336\223~\232\276\017g\020"
+	.ascii	"* \200\202\021\243\263\003\360m4\331\232(\013(Z\006\212\223)"
+	.ascii	"\305`\240\2766f\310\2531U\214c5Q\025#X\323D{X\026\013>,\310\206"
+	.ascii	"d\\\366\343)j&\t\302fWoD3\342\316\\I\227\035\326\261h\227\034"
+	.ascii	"t\205\223\001J \rG\021\252\305\346\300b\327\342\334a\275a\241"
+	.ascii	"XE\031\002"
+	.text
+	.section	.gnu.lto_.pureconst.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375 5\251\001"
+	.string	"1"
+	.string	""
+	.string	""
+	.string	"\020"
+	.ascii	"\200\004\001\205\004\002\200\004\003\200\004\004\200\004\005"
+	.ascii	"\230\004\006\230\004\007\271\004\b\231\004\t\232\004\n\232\004"
+	.ascii	"\013\230\004\r\230\004\017\230\004\020\230\004\022\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`&"
+	.string	"]\004"
+	.string	"r\205\022\036\260%\351@\347a\024\202\220\206\201\3045Ti\030\n#%\255\265KZ\333\204\020\322\244L\001\037\302]\237J5\262\312\343\264q\206\306\004\354\216\003\324X\254\362\300\353\337"
+	.string	"\2529\233BT\035\331\234\317\223\362/\005\362r5\001\001\033"
+	.string	"8\321z\006\330\305"
+	.ascii	"\001u\210\3718\270\325h\013C\264\244zW\021\024&\320O\003p\021"
+	.ascii	"3\340p\032F\n\2012\203A\030\b\2063\270\233D\300>\227\315\220"
+	.ascii	"Z\341\247m \353\002\f\001"
+	.text
+	.section	.gnu.lto_.lto.dde8472c27092f3d,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_hottDrawScreen.21.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"\r\b"
+	.string	"\002\21777@U\322\001\200i\263B\212\353\354j\310n\230"
+	.string	"#\374\211\342\021*o\220m\240\231I\356\302"
+	.string	"\323k\004Q\f\306Ec\247i\307\226\311_\314m\nL\032k\204\354\235R&i\331h\364"
+	.string	"\341\200\031ttV\\\326\260\256\233\031\027\035\235\\G\246\301\2256\f97\311\261e\033R\243%\211!xr$*\2739\251\274\352\336^\270\204\311G\004\361KD$:\013{\354j\202\361\304~\265\021e\303"
+	.string	"\226\202\231]\221\037\237\315\261jTl{\366e\013\354L\034\332\177y\312{\365\370\300.\n\207f\2672\270!t\3135d\333o\271\213g\333T5\345\213H\205\310\360\354\256<\270\bt\253:\001\350VD\271w\350\371\207yB\314\315\3513\035\002P\354\256\341\351\033\271\343m+\330\266\260\275\022\f"
+	.ascii	"Cy\375\233Yd\332\006FP\025I\345\"\327p\023\213v\202\211\007w"
+	.ascii	"\215T+\035a\222\001"
+	.text
+	.section	.gnu.lto_hottScreenSize.22.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`\265"
+	.string	"\305\n"
+	.string	"\206\324JA \311\270p\307"
+	.string	"/\204\314\274\004OB9\202\360/\370.\030\fM\212\t\033@\246&n\275\370\277\261\003CP9\006\036\313\277\007@\n\004\210\360\3419\203\373\220\020/\021\260`\321\304\322\222-eJ\0017"
+	.string	"5"
+	.string	"7"
+	.string	"\266O\340\005B\373\301%\002Pu0@)\260\260\273]\346\021\331\261\353\017\3311\215y\370\f\375\037\270\205\2041\245\"=\265\217\335u\246T.\267\336v\205\355\020\373\027\001\326.\376\231\246\257L\253\2463\323\337\270\023D\205\335\226\021\303F\300\034\b\260\035\332\234\335"
+	.string	"\301\343i\237u\003\341\305\321\035vW\023\032\354\212\032cl\307,n\016\247\001\246\034\255z\241|\201\252\246\305\272\246\036\225\301\026=A\312\266\313\302\341#\370T\266"
+	.string	"\307\374Qv\354*\321b\225r4\367\262y\301\026I\2510\366\257\325\225\255\031\376x:\034\216\306F\306f\002\374<\020\316\236\r\bz$\"\340\347\205V:%!\021h\244\363@\335\t\250c\322y>Q\267\241\260\027\372|\035\350y_\307\211{[\323LIM\2764US\245\020\020"
+	.ascii	"Cy\375\233Yd\332\006#\274\2300\300\346\236\312\347\022\273\322"
+	.ascii	"X'M\030\256\211gY\350\023L\020p\302H\265\322\021&\031"
+	.text
+	.section	.gnu.lto_hottWriteChar.23.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`?\001\275\r"
+	.string	"&\031[D"
+	.string	"\223\223\016\240\210H\252\335\253SM\253\262\200\037~\311`_\242\345L\237\f\351\217\241xB\253Q\203O\001 \231|\003\255R\204\304\223T\002"
+	.string	"%\375# TJ\242\r\223\213\201\333\022S\264\215\354-eJ\001E"
+	.string	"O"
+	.string	"@"
+	.string	"\002v[n\334\354v\"N\3409t\347\261\355\267\270\013\316\266\361:\024\252\0068Xd~\354\3565\272\310:|\037`\035\252\313\271'\347\337\346\006fhR\252\323\263\363`w\235)\025\210[o\373\200\355\n\366]\002\373!'\310\356\2005T\330\247\301\331\037\033\264\262\231\241!G\266B\206?s\032\3565)\031\332\016\250\027\314s\030JP\n\231\030\225\207\026\325c\204\204\022%\232\217\341\005#\334aT\254\273$p\"x\016A!J\236\207\341\257\376\202{\307\341\001j\307\f\371\224G\036\364\344\216>KU\257\251\"P\257\317\007\013\316J\346\370\253\263\020\275\360\330\004bw\247\324\023\366\337j\213}\230\277\363\230\337z\315\0175\3754\255\232N+}"
+	.string	"\001D\210tl\332\266a/{J\324\364$fj\223\f#!a0\242\200D`\323\"\204\2173\322\266E\013\0236-\2326`'&\224\022\205+\226.\f%\354\302\225i(\027\251\200\243\311D\273\266\030\265\353\323\355m\004w`bEQ\376MH\246\252\276\037"
+	.ascii	"Cy\375\233Yd\332\006#\b\026\211)\334\341B\236\316\234\275\214"
+	.ascii	"\002\207U\032r!\027\2355X4\226\300.h\b\004\003#\020W\023a-a\024"
+	.ascii	"\216\261\241\033X\002\b\006\303\006\025\254\207\032\002N\030"
+	.ascii	"\251V:\302$\003"
+	.text
+	.section	.gnu.lto_hottWriteString.24.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`E\004\345\033"
+	.string	"\2661\256I\260\226Q:L\004\237\363\"\245A\234.\201G\323\t\361a\360\257\t\270\302\020V5\304\353\353\fj\0228\344\340\237N;\202W?\206\343\357\253\347#\355\332\377\316\213R{3\323\023\370\201t\336s_\bx\345\320Z\262\345N)\232"
+	.string	"\233"
+	.string	"\224"
+	.string	"K9RjG\031%\352\024\210\251<C\220hP\222^l`\"\333i;\260\341}\270\363\230\352{\362\243\241<\t3\"\373\264\217t!\274\013Q\\@\255BTP\265\n\031\270\246<ia\371 ?\342\331F*$\n\336L\361!\202\245\326\032\233\271L\353$\375\200\326\311\245a:y'\351N\236\357\032\002\f\2468I]=*p\274\004{\350\r\3261\352\305O\240\240o\322\251' *\001u\004}_|\002\037V\200\301\240O\327\254\326\352\t\f\256\270[\267\355\301\366\315\246 \002"
+	.string	"N\374\313\017\177\327\2117\371\341M\313\351\335\351\271\323\027"
+	.string	"\303\202@\224ZUt\321R\233\220Q9\374\246O\351\316\344\027\271\221\037\271\222/1\360\243\250\326\372\222B\222Z\312\251q)\031\361\236\244\004\255D\263\036F?\352HtOR\342B\371\273\362\241<\0313?\240\005\225T\003*i\247\306E\364\361Dk\013Y\f\331\316?\331\201\215\356\303\235\002\023\2648\315|?\025\212\246\034k\025.8\371\022$\373\274\223\356B\024\373ca\007\223\343I\277Ig\277N\336\346\331/\033\226%\267\020\363@\317\3746\205wa\366>\\zHFS\317"
+	.ascii	"\304\252.yy\325\343\311\251r\374\337\245>\231L(\200@t\343\347"
+	.ascii	"\314\202\372\374\323={\331;\321\235\260\375\360\337i\321\205"
+	.ascii	"-\335\362\203\021`\277/\342\303\2457\273\370\265'\276\301\311"
+	.ascii	"}m\253\352\307\3037\273\370L l|S\021\214\243\237G\330\306\363"
+	.ascii	"\320\0317\216G53\275\231e[\325*I\365\004\3272TVuf\331B\337\334"
+	.ascii	"!\3737DXG\257\220\275\3230\027\376/\260'\375\001^_\372\003\265"
+	.ascii	"\347v;\032\325]\007\227[\021\270\332\332V\243E\210\360\300\246"
+	.ascii	"\001\315\201]\016w\341\345\032\315n\207\373\300"
+	.string	"a\227\303\341\234\240\211\300\321\335:\304p\267\030\211\033mD\254\226\323\305h\020\030\207c\313\305v8\\.\366\022\366\276B\013.AFo}\226\271\"w\310/\236\201\321\276\312%\027\350\305c\240Reak:]K\027\310\266\265v)H\341\231X\366\235\354l\245\r_g\017\344\342\212\312\252\016\311\235I\031\241\236>\323s\372\213/\241T5\351\321Zk\245;dU'\314~\347\372S\001[\250QD\205\034b\002\nj$\2200\222\2469\200\002\231\272b\007\020P\307F\223$\255\001C\271\374\\Cv\2503\004\320\324dC\306C\020\270jW\177\021>\330\312@\323\372;(r\214J\032\325\340U,MW\354\036B\037\2351\027\002}\273\247<1zt\242.\200\360\301#\256\350\231y\331\324\311\230g9\272p\201\242\\$mH\002'\301Hm\212\335\274X'uj\273\020\312\326E\013c\307\365D\3731"
+	.ascii	"\262\273\306\357\002f1<\324\240y\275\262\322+\364c\031\311\315"
+	.ascii	"?}}\333\\\206H7\320=3\2222C\317\344\210\323:!\233\002\320\313"
+	.ascii	"\nA\036\352aN\004\212nV0\357\3221\364\017"
+	.text
+	.section	.gnu.lto_hottClearScreen.25.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`"
+	.string	"\005\035\036"
+	.string	"F\365\270K\240\226U:\026F\336\346;\265Dc\205d:\004\235\266\271O\004\214\370\031n\263\001\263\375g\256\b,\3133\211\017y<1\234\274/\344g\213{\030\243\20589+\230\323\035\226x\326q9\247\273\301JP\231\304\030Ado\271\223\f\236"
+	.string	"\251"
+	.string	"\237"
+	.string	"H\025zT\021\357\275\257[\336\360#\0343\353\366\3149f\026\263\331\"v\312\374\336}\344\356\263y\200{}\220,\335\353[\300/\345-\373J\036\357\221c\036V\037\020\017\306\230\003\224r\357\205\271>\200\274\255\027@\336\366\214\312?\276\372\316d\347\276*I[\233\346\370FO`\004\334M\ty%\276*y^\346"
+	.ascii	"\217`(\005\013J\256\270\255\253\033\0248Z\274\233\nS$2\035\351"
+	.ascii	"t\207\267\243U\210\347}\340\007\364\216\246\204\274\025\247\253"
+	.ascii	"\230{/S\035\236\212\363\312\231Y\0073\177`\256\303\344\177g["
+	.ascii	")\327\025\345\256\224\351\212\362\001\364NN\220\300\324\275("
+	.ascii	"\216Tn\224e\nz\360\377\361\217\016\205{\020\276\220\0179\221"
+	.ascii	"\033\371\323\001\037,\247a\255\3474\254\275\254\202E\2632w\246"
+	.ascii	"\232z\201b\210\232\370K/\202;S\r\206\022\207JV\336\002\240\027"
+	.ascii	"@*\375j(\375n/+ 9r\017\336\352e\021{\021\253\364I\334\340\001"
+	.ascii	"\356\301[\201\tT\2041\273\023\026t\030\211\367\372^\267-\236"
+	.ascii	"\330\351\205\270\373l\372\304\205\241#\304[S(\306\007\302G\032"
+	.ascii	"\n\032\251\302\241\2745\177b\374\037|\240)#\366\037\017\353\r"
+	.ascii	"\013\230\364j\025\214\373\340\353\275\367\326V?\250\340d\267"
+	.ascii	"\3728.v\364\310\275\243J\352:5)%\335\245\243\306G\351\226\244"
+	.ascii	"X\250\353<$W\272\245\371P\"Nz\035v\341t\t~\257\b\352\032vH\335"
+	.ascii	"\247\227O\210\226\360k\344\235\\\257!\337dS:\rB;P\342<\351\034"
+	.ascii	"\303\352\013OvK\263\330^i\246:T:z\344#\275\204r\224\272\324\330"
+	.ascii	"\035|\272\3415\277&\364\350\200\257D0\036\2644\205\352R#\263"
+	.ascii	"oG\373\207\371d\361\030\304\355\303\3342+\345\226\373~V\245\274"
+	.ascii	"\362\34094\233MVg\017q\316\232\304Ik\226\231\311\"Dp\360\200"
+	.ascii	"\201\213\001\033\355\304\300\342\231\213\315v\202\350`\243\235"
+	.ascii	"47Y\b\232\332\214\007\3309\003\0331#\023\001\233\321j0\027\004"
+	.ascii	"|\322\310\320`\266\363\244"
+	.string	"\301X>\335\333\207%\364\350z\3077z\006\241\236U\377\360\313\366a\263\310\232\335M\350\353\326v\355;\351\2562_\322\255\200F\024\333\377Q\210Q|A\232\375\237m\023x\326\r#\205\001*\022m\377\260\331\244[mk\224\257\223\275C\026\217\222\230\240E~\323~N\025\035=^\311\255\274\367B\340G\201\230\261aC\336\276\003m\250Q<\246\034s\202\021\221\021\3214)t\200\002!:\252m\0210I\251\214\266$\225\306C\277\374H\215\277\311\377\221\345,\312b\370\225V\240{t\022\016\277[;5\362`\022#\211\241\036\"`\373\006R~L\302$\327\0162\257k\252Q\244\217\0256\261\002\221\022\323\001n\241\0221\253L\375:W\217\377U\344\251\233\304\032\362\347\267\254H]\277\271\024J\307z@\325z\315\374\023\232\276+;M\361@\267\367\037\256\353V\267\304RJj\315\222\025\361:\035x\345\353[p"
+	.ascii	"LF\030O\306\207\032;\245{D2ga\263\312\345\244\304\265[\243\257"
+	.ascii	"\276ge|\207)\037\016Wl\263!{8\255.\210\250P\013\025\201\201\210"
+	.ascii	"\305OZ\023\222\271\346\250\262b\251\\\361S\211\020\034\332\224"
+	.ascii	"\320?"
+	.text
+	.section	.gnu.lto_hottIsTransferInProgress.26.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"E\b"
+	.string	"r\217::@s\322\001"
+	.string	"F\252\330\006\370A4\253\317{\"\360\335\307\301\231\353\3646\211\2736\004\274\221}\027F\376\336\" \351\273\\\314w\247+Z\207\nI\032\035\334\336\b\221\266\267L\001\027u\\(\364\0011l\006\266R\b\355\335f-\245\220\260\225~\030\\\3057\362&&\365\346\205\307Y\314\256\216\346vp\372\211\352\264\224\326\251\335\346\020\223&\254\224\206,\035K\305\f\250fX5\035q\376K\2122\344\347Nw\367%\352\217\037\217\025M\201M\267\251\225\3230\327K\311\177\360\327~\200\226C\214?\2370\n\310)\031\034\320\215\272q\351\276\n_\360\360\365\313\004\030_\036\026\300\370\372\377\006\020\370\220\357\210)+ul\254\254\272\357\224\"\034r\f\317\254\302\b\252\026\020\031\226\023\211c\366\320\335\217\034\247\017\276\344\377\t\377#\376\223\004\n"
+	.ascii	"Cy\375\233Yd\332\006F\264\006\260\204\370,!\3215/\341!\314\353"
+	.ascii	"\232d"
+	.text
+	.section	.gnu.lto_hottHeartbeat.27.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`\307"
+	.string	"e\013"
+	.string	"f\025O@\020Q\234\016\360\266\003>\315{\223\022Rk\004\347\275;\375\032'\372j\346\306C\306m\316H\236\220\225\346}\216\330u\007>\b\b*\024\241p\201\333\003`\002r\227cVT{-\264d\357-S\n:"
+	.string	">"
+	.string	":"
+	.string	"\226S\254Oy\020\3533\2068w\031\225\363\177\272$\341a\305\007v\227\035\036e"
+	.string	"\025\213\034\027\030\222\024\221\210\357\247\353\006\320S\215$\330]\353\007r\270\347m+\260\315\300~%\217X/fTl\354\212z\360X\031\263\305\b\333\234}\331\223\032\b\256\366O\034\005\367\360\302?vI1R\273\341"
+	.string	"\023\220|:\224\330\366M/\301\3310dX\002#\336\007\r*t\354.\0268\254\031m\n\037\375gK\206\330y\2022\361\322J\225\212\266`=:Hq#\244+O\265+\200\364\337#f\344\305\316\2122\321X\335a\207\235F\020\366\345F\222\375\360\237\252\016\346l4\231\214\001L\201K\310\246e\013.o.\333\226Ah\260i\231\007\244\211\340\371t\036`Y\007\233\320\321H\3006\332\007\273"
+	.string	"p\346\341h\330\226e\032v\205{[\300\017\2140D\317\212r!%\372;\021"
+	.ascii	"Cy\375\233Yd\332\006#H,\3703H\026T\002\203\202ZC\274\013\341"
+	.ascii	"\271\206ch\361\2562\361\340n$\325\240U\"M)\024\024"
+	.text
+	.section	.gnu.lto_hottResync.28.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`%"
+	.string	"\235\007"
+	.string	"\242\31655Pu\032\003"
+	.string	"\240\212\371\017O\241C\271\354\003J\262@I\032\210\332NY;\240\372\336\234\372\356'\366E\340F\375\354\350\016f\003E\020\235\350\3154\262\273I\231R\025iY(\304\320\260\200\031t\334\214\270\252a]7+&:n\21622\213\021i\243\220s\223\030[v!5\216$\261\203\316\221\210\223\335\234\234\274\276\333\363\210*\304Lj#r\024\262\304\324\034\346\264_\tF\221\326\236\377oD\265\320\222\241)\270\371=vt\236\252`L\332\372j\003Z\034\f[\237\030\305s\212\206\005~\224\313\313\377%T\001\344\252\237\t,W \017X\256\352\2656\376H\376\t)\351X\301\371/\343\210=C\257\266\212\001L\247\222\341\347\341\177\241\351\364\341F\267Eh+\321\026$\t"
+	.ascii	"Cy\375\233Yd\354\211\236\2658k\3512\310\267\032\r\356\362\242"
+	.ascii	"\235d"
+	.text
+	.section	.gnu.lto_hottTxBytesFree.29.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`G"
+	.string	"\235\b"
+	.string	"\362\017<:0q\323\001"
+	.string	"\205\221\212VJ\013&\035,|F\\\336\220oH\371K\024\200\334\207\231N\002\327\3501\266\233\266\221\244\003#( \361\203'p\243\320\304oA\301[7\262\267L\001\007q\233\246AD<d\b\340g)\260s\031\bZ\f\013\360\263\036\307\226\341\205\272\213j\273\272\321m\032\225\373B5S\270\365@_\005\255\375*v\233\177\201\262,K\026/\232\222*y\320\217_dM\001J)\225\323S\347\277\242II~\256\232\222\376\251\241H\234\003\231n\221r\247i\254\230\223\377\341\217\375\001&\2119\177f\341\226\220o\007\017t\223nP\335\267\341\016\037\266~?\377\317+|\n/V\327d\004\030\251\200\274\220\335\267&\260\301\305V\305\004\027[\264\204E\236\342\231]x\30143\262\201\031E<=\023\335\375\0312\216\360)\377g\370_\361\377\024\f"
+	.ascii	"Cy\375\233Yd\332\006F\364*\030KH\256\341\\,\306\r&\b8a\244Zy"
+	.ascii	"\t\223\f"
+	.text
+	.section	.gnu.lto_hottGrab.30.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`|"
+	.string	"\365\t"
+	.string	"\366\022F> \005)\035"
+	.string	",\024\006\b\234\025\340E\240\377\013\2038\006p\352rGH\347\032pYo\033\266\233*\022\310\304\212\262z\t\016\b\b\247\200\215\035\265F\f;\007#dL\325\b\331d\357\224\0022"
+	.string	"2"
+	.string	"4"
+	.string	"6\3156\246\270:V\354C\026`w+\350\005\334\351v\002\356t\242\\\274\024\375\277\234\276JjZ.\325e'\261\273\226-W\310=o;\3016\205\355\2340\373\343?i\367\272\371\314vAj\003\326\206\316\254\330\026m\217-\360\212\270\264\357\362\230\3701\365\201]X\214\314\356\270`\206\316\251\307\216m\237\345-b\376A\316\336\270\f\354\354.\204\017\323\301a@S9\365S\334)\002\r\300J\326\334\215l\322Fy\310\267\fbM\225\345L\004g\245"
+	.string	"{T\311yb\177\333\031.\221F\"\221\303CC\350\023~\336\204\307\244P\030z\027\025\341\347\235P#\214\023h\262\250\236\251j\230F\031\225\364\2015t`\357T\372j\350y_\365\214{[\341'1YMV\r"
+	.ascii	"Cy\375\233Yd\332\006#\362F<M\023A\235\027\273&\262\261\3107\230"
+	.ascii	" \340\304\223j\305$L2"
+	.text
+	.section	.gnu.lto_hottRelease.31.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`\317"
+	.string	"\345\013"
+	.string	"&\026RC\020O5\035\200\215\013\210@\030\350\320\305\240\335\027\257\2530\324\271\002[\007N"
+	.string	"0\312\231#\"\314\332\007R>,\267\372\257\310I"
+	.string	"\001\320\021\336\331fHj\3351\206\271\016\246i\204\274n\023\021\262wJ\001<"
+	.string	"?"
+	.string	"?"
+	.string	"\232\313\316\266?\342$F\333\225\225'\022':1A\005cw?\3119\266k\3317\266kt\303\307\317\321\177\352\231\210\013*F$\362\223+\260\273\236#\222\205\233\336\366\207\355\004\366\r\004KM\366\313\177n\\\b\026\221\027\273\024b1v\205\226\242\203\355\321O\331\363`\227\243\354\352\310\n\335*C\353\265\273\223kF\320y\257\313\247\375\02271\276\004]c\327\324B\261[\206\030@\367\"J\232\373\300\315Im\217\203\371\221%\022(\351\311\3620\371Q\257\224B\377l\366\203\257>\335\356\016\360U\020\"t\2348\\\363A\3335\220\223\213\320\214y\2620\264\330\t\263KrR\r\366\263\"\007\244\316\200\030\213\245\" "
+	.string	"%\"\206\365\200g\220\"\212\225\201\0021\254\235\017\246A\307\243Y\360U\315\307\321`6\037\030z>\212\207k'\023~b\255\341\347\225{{r\002\245\020\025\231\003\2211\355M\r\023"
+	.ascii	"Cy\375\233Yd\332\006#2&R\316+;[\301#\f\300\307W56\327\330\341"
+	.ascii	"\232\b\320\"\257,\310Q\250\233\250\202\200\023O\252\025\2230"
+	.ascii	"\311"
+	.text
+	.section	.gnu.lto_hottVTable.32.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375 \376\005\006"
+	.string	"T\n\303"
+	.string	""
+	.string	""
+	.string	"/"
+	.string	"\005\001\212\001\202\200\200\374\342\203\374\301\005\177}\370\367\361\003{y\270\367\241\005wu\370\366\321\007sq\270\366\241\005om\370\365\301\005ki\270\365\261\005ge\330\364\001wc\364\301\005wa\357\201\005w_\357\321\003w]"
+	.string	"?\202\210\200\330\001[Y\305\001W\304\001U\303\001S\302\001Q\301\001O\300\001M\277\001K\276\001I\275\001G\274\001E\273\001"
+	.string	"\013/root/repo"
+	.string	"!./src/main/io/displayport_hott.c"
+	.string	"\013"
+	.string	"\240h(\332\nE\003R"
+	.string	")\200\024@\n %&)f\222:"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_displayPortHottInit.33.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`%\001=\f"
+	.string	"\306\324NE\020\213j:G\264v\343\031\267@a\373\003\255g\353.\371\265N\247\200\234\"\356r\004\250n\217C\225\r1t\\\324Y\203\201\352\037\342\302M\001"
+	.string	"\001"
+	.string	"\025\201\004\353at\220S\027\305\200Ab\351\331\210\354\224\0027"
+	.string	":"
+	.string	"<"
+	.string	"\030\237\301\033\220LN\234f\352r\262\001h\321v\317\352\363\032\357\335\367\b\357\035w\340\344)\351\337\301+\013LX\211*\235Z:v\327\264D\245n\356\2665lW\373\254\273\273\341\257~\216|\004\357|B\322\227\357|\322{Wa~0\321\2333\253Wm\266\324f\237%\312\031\260_Y\256\200m\361P@\363`\261a7\300\r\304\306\272\013\tl\223\354\265\331\017zv\310)\200\02328XB\310.\364\252K\b}\273)/}\b\217\360\251\204!/\344\275\273\352-\362\3335\275dYTB_\372\002\205+9\263\212\325\333&\177\340\016\022f\356l\3061\024\371\030\305\0204\342\214\200D H\r\301J\002r>\265#\212\352\006\303!\310#\3261\f\305\2129\367\032`\034\004L\334\311\3245@\303y\006\f\324%@\366\335\343\331\235\277<\025(,l\037"
+	.ascii	"2\003\302p\334\206\tn\340\265I\003\213\231AJ \002\334\001\306"
+	.ascii	"\255\352\t\260\b\266\263*\231\321x\246\272\260a\020\300\272U"
+	.ascii	"H<1\031\272\020\f\356\360\205\251 \020@\257\273\325\330\256\211"
+	.ascii	"\254\021X\013\221\211\273bj'\031"
+	.text
+	.section	.gnu.lto_hottDisplayportRegister.34.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375 \365\225\006"
+	.string	"\242\f.3Pm\222\016\2602 \026"
+	.string	"\2421\321aM\214\205\bxQ\362F\250\217\370\243\335\320\fj\233(\373\314\307;:\243\tbj\335\004\270\310\364\216\215\376'[\246s4U\365\024\016\252\351I\235\315\202DE\b\356E\256!\33208\316D9\215\300OJ\230\\\365\336\3440Y\266\201\f:B \232\347\013\266=\345\200\305\316D\264\353\n~\347\001\213\265e<\355\032?.F\022O>\273\260a|+\331@_\274\226"
+	.string	"\016\021\202\222L\212\024\224\f\261\200l\374\305l=I3\215lhB\"d\222\231\256e\324*Z\267\036\005\300>W\361R\220\231#\366\251\350\255\377\300\357~\213\b"
+	.ascii	"3\001\0238c`|\241k8]\b\3762.\270t\213v>\001"
+	.text
+	.section	.gnu.lto_hottCmsOpen.35.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`R"
+	.string	"\025\t"
+	.string	"\346\020?:0\345(\035"
+	.string	"\270\252<\254)J\036\005\233B\017\242\340@C\247\2615L*(MA\327~\303\266\007,\222\306\033\351j\373\220\031\004\210\036\224\366\355\201)&I\002\372do\231R-"
+	.string	"-"
+	.string	"/"
+	.string	"\217P;\377\252\017x\337\350Q@\3430&\304\\.\231\317\024\rN \336UW\214\257\244\032\240\260\273V\357\313\270\265\333^\260-m\277\002#\205\035\366\343B\224}\3655\202V\n\002\312\356i\026`a\332+\304\366\355\217tv\306\235\335\362Uj\317\342\270`\275\354\256\204\036\357\002\026z\317\020\216\236\222\305Z\320\"\314\241\203\t\213Ie\366I^\"\362?\f\n\351\275k~\bs\355\260`e\203\2443\353\211\210\312*"
+	.string	"{\025\346h8nF4p\333\364\2006\022\236O\347A\316\216\244\350l&$g\373H\315\201\247\007b\223\334\234\233\314\254\366q!\312\f.\030\t\226\"F\355\212\r"
+	.string	"3\241\261/\306\325Pf\330\013\250\366A*\211\270v\206"
+	.ascii	"]\303\t\206\360\304\245\213\331\016\rLA\001"
+	.text
+	.section	.gnu.lto_hottSetCmsKey.36.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`G\004]\027"
+	.string	"\026'\217I\240\024Vc\f\234'Y\004\224#^h\033\277x\315\234\3660\353\203\006\250u\314\0223X\033\257!\254 C\321V}\\\275T1f9\2042\301Z\360>8\005\366\202_\023\334\266H\360\3644\337X\370\377\375\377\357\275\245L)}"
+	.string	"s"
+	.string	"x"
+	.ascii	"Q\367\"\017\030\001\354\247\205v\326\221A\367MB5MB\356\2756K"
+	.ascii	"\342\302\317RY\f\366BO\323V\241_\207\270\210\305\341g8\214\322"
+	.ascii	"\023\331\257nx~t#\242\306\224\260\002N\257\020GM\024\255\031"
+	.ascii	"Aj\305\032s\200\215\tbZ\244\251\347\211\302\310\274\212?0\022"
+	.ascii	"m\375\340\360\334\346\310\304\310\2123:\250LJH\352?7;h}5\270"
+	.ascii	"\367\272\022\21387\355\266\261lW\260\355V.\374\0271W\342"
+	.string	"\235IQ\304\344\267x\375\005\375i\204\262\277\302v\026\354\336\341{*\311\245i\242\322\272>\327\300\317\323\232\324\324#\256\311\033W\267v\331\310\341\315k\215\366\315k\201\354/\375\265\037\377\323\254\256\266\372\001\322\343\016\024\035\367\332,\213\\\253\223\006\221\355\247v\252\264\024$p N\307\251\b\260\237\351\021\203Zm\005*\302\037_l\357\3559\006\270\031;4\255\332\027t\365\304jMb\354\320$\311\256\022\017JH\2505:\210\336\376\207\tK\246\022\261_\3436\202~\t\267\354\352\211?\375\035\372\363\226\204G\016L]\272\226\034\322\364Y\222\353\374Q}(?Kn\231\262\034\260\372k@\355\337\206z\242Md\354\320\265d\325\235.\243\262\032V#\226\022\222\n\2622\374\250\332\023\224\017\203\226Tt}\236\374d:Tto.\271\036\204\337\316A/\227kI\235\303\335VV\026\250$H)\t\346X^\306\245"
+	.string	"\201<\f\024\200>^/x\313\320\373\351,\330x:\233\213\356\266\263\341|?[\312\211y\275\234\317\006\344\361|\266\024yo\201X\224\254`l\214].\227[\2634\251\352J$\344i\034N\244\002\252-a\202r\204\314\032\247^Ky\354\016\213\317\224:\261\024\204\251\374\020\3433e\007Xz\343\345\013@\375\335\003\255\326\276\005\\\250QT\252\230*\031%IQJ\035\020\003\221\251u\021\240D\352\234\242\244R\320b_\331\276\253S\314\365w/\254\034\227KMQU\346\345\320h\260\251j\301[\362\356{\037^9\373'\326\224#T\312\3479\007\374\375\004\254\256\213\360~\224xAK\346_\272Z*I\200\323?\222\374\b\362\332g\341\215UD\276O\342\241\3621v\275<q\275<i\314\355e\305}]3\242ER5\324\252\031\365\232\212\340\223o< B\206\377\223"
+	.string	"\352\277\213Q\350\320"
+	.string	"\226o\263"
+	.ascii	"\317slZ\032\031\250\221\027'w\t\313\302\016\244j6\307\223\006"
+	.text
+	.section	.gnu.lto_hottCmsOpen.part.0.51.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`]"
+	.string	"\345\b"
+	.string	"\206\320;8@\305(\035\200\327\220\037IX\204\324\236\343\300\212\335pH\234\231\035z\001\266\300~C\306_3\b\351\254*)\350+U\025v\022\0168nT\017\020\215\206\352\206\366\226;\245)"
+	.string	","
+	.string	"+"
+	.string	"\034\373\024\306DJew\345\243n\234\273>\310\371?]\240\033\201\256\325\310\342\017shA\330]_.\356x\333\007\266\245m\224\036\0301\235\354[yZ\262\302\303U\222\r1\006\031\273\024\001"
+	.string	"\254F,\361\260\177\372\330\226\177\342l\353\361&\333\237\nsv\312Q\001%\333\325\2639S\244 W\037\226w\220\213t.\273\241w>\352!\232\337\361h\210\316{\367\350w\002\036mO\304{g\002\t\005\005\336d\266m6(l\331\304<\032\007L\273\026\344\274\344\303\245\341\310M\246\311L\201'\306\220\311m\316LZ\266\337\341*\311\t$&!\025YU\003\021"
+	.ascii	"u\023\030\017\347\016\223\272\272\242^5\b\236\002d.s\026\306"
+	.ascii	"\354\234\006tZh3e\247\001\340\332\213)\247\345\364k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`\323\002\205\013"
+	.string	"&\220>8@\253\246\003\017\036\224/;}\270\325\271\340VV.\326\200\260\b\"\343\210}\326(\312\026\343(\356\365\001d\345\373\276\357\373\276o\357\2472\320\321f\243\"\201L2\222H\031-"
+	.string	"/"
+	.string	"0"
+	.string	"\257\224\267h\256\327\303\344\343\201\312\325\"/\216\227\210\237HN\211\274\fOB\036\321h\255\253\210\335\357f\234\030\200RJ\301\207\330\356\266F\377p\336az\242\273\226\327\346\036\326|\223\220\031a\256\301.\317`]\341]\262\335\305\352i\302r\f\233\026\035$\333\335\013\255\025%Q\271\001%\217\346\006\307\2437Gs&7\306\306\002C\030\320\232\031j\315)f\225\253\265\002\2636e]z\001\351\004\243\213D\347\204^\002\235\364y\310sP'\373]x\347\370\265"
+	.string	"wn\347\226\002\277\336L.Q\024\020\224\257\265e9\260T\345\327\\\271\201V\230x\215\320yd'r\315&\327\246\255\371\f5 "
+	.ascii	"\003\031\"\325\001(\354\342\222\264\261\013nZX\341\252Q\300\341"
+	.ascii	"\200\006\0061\b\003\243`,\242)I\036\276$\223f\222\t\231A\370"
+	.ascii	"\220\372nG\005&kj\027t@\007\350\200.\350\202.\350\002:\257\220"
+	.ascii	"m,E7\301\230=Nn\003s\256\327N>\bH\223\254\2377\240\fj\207C\355"
+	.ascii	"\326\254\035\327\3338\236Q\017\352\241\036\353\261\036\251A\263"
+	.ascii	"\325\t"
+	.text
+	.section	.gnu.lto_.refs.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375 M\315\001"
+	.string	"\322D\r\022\220\267\205\003\377\377\277\213\310\315\304\354w\367\367O2\005Z\034\022\344\207\003\221\001\007\376\262Y\373Y\360\260A\270\3550y&\313$1\226l\237\n\343\233\220Z\b"
+	.text
+	.section	.gnu.lto_.decls.dde8472c27092f3d,"e",@progbits
+	.string	"(\265/\375`H!}\221"
+	.ascii	"z\344\3342Q@PJ\352\273\272\256\262;\321\275{{w]\317\307\325\314"
+	.ascii	"\366"
+	.string	"\326\377c\347+\352\316\265\214N\004\200!\"\300\351\372dK\006\330\"\376\306\b\360\003\262\263%\314\205\3553P\322\337\307\331\031`\013\273\305\224[\024\226\365H$\317\200\376\377)\221\270eJ)\274\002!\003\036\003|\022Dq\342\202k\274 \271\243'm\356\206\004zc\nA\267\211\251\3079\335\211\240\2460Ii4-\362\346nP\033JQ>/\237\272\025\317\273-\032\026\002\243JSs\351m\253\202bP\035S_\202\346Jl\2208Y)\327\243\212,\211+\t*\247\224\242|\356\204\315\2456\3106\037\001\241OJ\321=\007\343Y\\\213oq,\316\347\\\374\213\353\271\027\357\342b>\365\272v;\257\3229m\316\313\234sC\360\200\004>u)\356v\333\252\254\224KC`\231\247\204\304\227s\273@\316\002\227HHSR\001\252_\361;\027K\300\361\332[/\3221\3116\267O\025\206\f\354\325\376&\334\236"
+	.string	"\360\376\375y\002\300\376#\374\331="
+	.string	"C<\222\316\347l\332\200<5\275J\245\305dU\344r\340a1\227\363)m\316\251\361\273\232\202\343\tnW\303\355e\270]\f\267\027\301\355\\\030J\215\037\021?0W\270=\b\316\201\302!\244\357M|\255]\352Lh\226.UsN\272\213\260q\027\021#\005\222\004\003\252\3557p\273\022\036\341C\330\20127s\261\034?\3137>Ei\204\343\325\366$\266!\377y\016\260c\340\023\356\001\350`\036\346b \034I? A_\244\221\314\225s{\203\337\210xh\275\332-0\215\212\366#\315\"*K\320!p;\b\240\3779\b`?\306q\017\300\367\016@\0344\367"
+	.string	"t.\020\227Y\364\314c9\267"
+	.string	"\334\264L4v\274\332\255{"
+	.string	"b\357"
+	.string	"\214\211\241\255\316\251\350\265"
+	.ascii	"\335w(\332\301\356[\354\366\004Ft\273V^W\r\323(\216w\327\335"
+	.ascii	"|\215\323}g\350v\244n\237\321\355G\335\276\324\355J\335>\324"
+	.ascii	"\355I\335\316\354v\241n\007\352v\243no\322\301\276p\201B\t9 "
+	.ascii	"t\267\001\335\327D\023\022J\210\351\231\356K\354n,\335}\346C"
+	.ascii	"\256\264H1\002\017\020\272}\314J\267\227Uia\367]q\273\257\007"
+	.ascii	"\037\250\202\350t\373\367\221\266\351\276-t{\232]\267{\313t_"
+	.ascii	"\025\272\333Kw\347\365\t\335\375\241q\367E\321\337}1\350\366"
+	.ascii	"\272n\237\353\366\270n\227\322\355m\335\316\326\355k\335\336"
+	.ascii	"\244\333\325\272\335\254\333\311\272=\254\333\277\272=\253\333"
+	.ascii	"\273\272}\253\333\243\335n\325\355B\272=H\267\003\351v\252n\237"
+	.ascii	"\352v\251n\347\321\355\320n\207\352v\035\335\256vw_\267\337\350"
+	.ascii	"vgw\367t;Mw#\351\356&x\335.\323\355\302n\307\335\036\354v`\267"
+	.ascii	"\307t\373\355\3560\335\315\325\335%\272\033Jw\007\360\367\367"
+	.ascii	"\367\327\255\342t\307l\320\235C%\3166'\001\345\236(E\201o?\236"
+	.ascii	"\334\215P\336d\260O(K\363\"\373&\035m\312\331\331\253\017\346"
+	.ascii	"\346\240\032\331\350\346?/#4\302^\365\363\262'\"@f\230\357\273"
+	.ascii	"a"
+	.string	"\256\355-\371p\036\356\230*\270c\342p\307Hq\307$\331\333\242B\341\353\352\242\245\177\213\r\r\"mC\257~a\231:\035[\026,\275\376iP\016H[\257~\3363IQ\t2z\365\361\334\rj\325\305\356\325\277s7\340\020?\256+\277t\035p@\242VU\354j\210\274\200\316\352\372\355ZF\307\221W\223W\237\356\231pR\nW\336\253?\347na\232\362\246^}*\356\366\005\326\325|\365\345b\230\244xK\037\373\300\247\004n*\016\316\213\330\341@\222\322\017'\264q\244E\350\325\217\362LR\210\336\336\334-\370Ww\024\364\352\273\271\233\235sz\365\352\267=\024\031\245_\037\023\024\317k\002\002S\366D\212k\357\357\211\217\251CE3t<\261\003kR\314\305K\273\327\244_\032\367\345H\320\2531Dji\300\261$V}h\375i\030<\227\314b\220\270[\365\213Y\031\320\350\356\356i\254\277\354\223"
+	.ascii	"\323\334\244\212^\035\361d\302e\233\303\204tZr\214a\301s\270"
+	.ascii	"\321\216\204\331\274\265RS\260\3760\037\213\311\241\n\215\246"
+	.ascii	"W\317\212\264\002,I\372\372\352o\035;\317\244\366^}\"\357E\023"
+	.ascii	"\004L\333\231\327w\345u\261\351\275\312\025$R"
+	.string	"\256]e\341\255\327\312\177\203\013\023)(\334{\037\265\211+\312\341F4+\030\247\005\004L\020k\352\251\013\022n\270++a\033^\263(\207~+\251\227\033\324\311\253/\344\231T/\350\325\323\253_\345y6;\216\264\276\004\231\351\022\r\272\n\202\303L\335\226%G^\005Rck\212\351\325V\223\370\307S\001\233\304\312\202\264\340\276pS=h\330\2364\257H\365\367p\251S\211q\311\201\r\367\264\177\007\364fN\032\006+\252\037Z\323\267$I\365\352C=\323\321\027\026\252\247\223-\036P^}\035\nx\205\325\350\302\177\343q\270\330?u\177\016w\322\252\221g\016\313\271\255\271I\246\267%\257\252>\002x\343#\200}\177\340\356wz\247\214\217\275\036a\232\372\235\235G\223?\274\232\\\027\327\253\275\367L\356$\246\243\007S\215\033\244\2464\365\3310\241\233\261\364\352/y]Ph\t\317\352\325\2766\260g\357"
+	.string	"\364\246w"
+	.ascii	"\n[\347=\302B'*\372\213\332\305\276\350\201>h3\362\202\256&-"
+	.ascii	"\276\334t2\240*\315\340"
+	.string	"\244o4GGT\317\031.\rn\255A\307\206b~|\241b\305l\274G\026\311z\"\224Ss\245\357-J\320\003\321\370\211a\351\312ZOgw\257v\377\362\225[K7\374h\205i`\260j\274\372\371\221\375I\377\373d\004\317\234\223\237\274\351\3139y\343.\302]\204\252\005\r\222\004\250\366\263\371\205\211\273C\212z\265\257]&\241\374\242Ip;\227\021\037\233\001\363\241\024\rb\227,\347y\253\b\201\372Esv\216\250\3119\264\f\215\365%s\023.\337\212\034\275z\221<\023\r\027:hY\353\225U\321\240\223\30337\024)r\303|\034\301L\325\270`}\303\362\204\236\306\260^\275F\260\237\221\323\362\325\336s\351\214$&OR,,S\321\367K\354~\271\324\215\344\243 P\032\324\217/g6\006>\f\f\352\005\013\317,\351\352\256\233\2053\r\032/]\224\350r\340\031\251\n\255\326\272[8\313(\301"
+	.ascii	"\325\250\360-m=\323\314]\216!G^m<\204\033\353F\261n\0260go\237"
+	.ascii	"G\315\031\262!7:\344fa\244\037\261\341\034as\245N\231\245\367"
+	.ascii	"\372fM\271\302!\311\253\035\f\203;h\005\323\bYY}\332W\034\236"
+	.ascii	"\211\023\"\344\323\316\232\264\242R\\C\024$\310\247\2019\202"
+	.ascii	"kZ @~\212\257\004\261\260\r\020\325\375A\365v\030i@[\223VT\n"
+	.ascii	"\323H\247\246>\r\211\362\3064\350\204i\242\244\244\276\354\253"
+	.ascii	"\202I\240D\246\301!L\323\305\203\307;\1774i\361\371a\232)\024"
+	.ascii	"\372Rw\346+G\243I+:\207m\222@A\375\226\017r\3167\347\247\263"
+	.ascii	"\252\354l\216h\340\032\266\231Sqs\334\247\276:\372\352\3704\234"
+	.ascii	"s>\361\345\\\032\321@$\270\273\333\2019)\246\315hJ\232\366\230"
+	.ascii	"\032\277~@w\2539\333\2203\262.\272\005\330\026\325\264\345C\344"
+	.ascii	"\317\031\371l\002\300l\303\242\232\314eT\2233\303"
+	.string	"\242\220\230aQ\310g\272%\221\2329\n\211\363\023\t3\2239\207=3\322L\033\225s\033\205\304m\262\231\231m\324\023"
+	.string	"\3462\n\311\231a\271\231\227\271\031"
+	.string	"3g\244\034\026\205\305\2319\252\311\f{\"\001\220\227D\2240\265x!\271\331\024\211\023\024s\231\215\n\210.\237M8f\373t\264\234\221cA\271\031\2253\216\247\b\264%\016H4%\234Q\320\271l\221\356DC\t}\n[e\206c^=]\004\345l\227iD\200t\244PV\"=\347\240\266\231\263\362\351\202\363\351T\204\232\271&/\223EJ\350\223&H\371\024\312WP\216\304\f\203>M\244\211\205Uee\213\364\252l\027\325\304a\31063s\316\256\245\246\213\2229\276W\357\r\24049\265\342\2746\204r*\234\210\277Q\273\330\033]g"
+	.string	"`oK\fP\021Z)\2630\275\312\343\206\237R\242\024\215b\r\371\"fJ\230\374\332\227\223)_\245\313.\313\357m\211!y3\031e\222$\033\277c\211\222%cJ\321\250\227W\013\202e\344\217\330(\313\224\242|IJ\357\304\266\2744.\322m\272B\227\351\032\335\244Kt\233\267\306\005\272Kw\306U\272C\227y\203\356\221\213\335\"\237\322\177\364M\261\263w\n*\311\224\242|vV\036\013W\025\227Ws8'N^\202iU\345\334vy5\"<|\374\325\231\t\276W\213*E\243\357\204\355\343>(\231Y\005\363R\212F\037\251\350\277\\\245\303\005\354\317j4\302@\301\256\036\344\310XA\3701\256l\f\016\330u\305\321\207x3\300\fK\\{\326\025G\037\242"
+	.string	"88\036\332\005\211\0222\214\354\352\263\366\254\354\207U\006\236\236\f\216)\326\235\242O\007\226'\006\007G\037\342\214\214\025\204u\305\321\207\350\001\306\317\032\302O\n\343\312\036yZ\254&\020\300\362\374\244`\331\342\0073\016\220`\215\303\027$~\326\027#\034}P\004\300bh\364"
+	.string	"\2330\203\342F\205\017jN0!E\316\212\rl\232\310c\\\177\326\026\270#\230\240\201\tN\304\b\366\t\013\034\260\300\001`\237\260\300\204\t\013&0\201{\002\023w\325\221\261\302\240s\364!\nY\235\233\343P\206\237!\nvm!T\327\343p\355Y\215\301\231\0253\f\215;2+\r<+dZ\374\360\030\331\0253\302\341j\304\307\343jlQ4\222\360\223\302\270\276p\344\021\200\035\256,X\343pu!$\376\3108\256F \253\363"
+	.string	"\004\353j\354\340\270\26224\210\301\316\034\t`\217:\036\206\354pg\310\256!\260k\213\033\366\250\263s,\332\030W\2268d\177\212\035\254,\217q\206"
+	.string	"d\354\fW\023\216<\301U\347\305\b\005\374\360\264XY\340\374\024yX\342\360\37034\236\300\362\370\370\024\211"
+	.string	"\310\264\210\rn\214C\027D\225m\027$\216\306U\006\036\343\016\210.\276X\215%\330b\321Xb\206\325\231\300\0046\016]\240\2101\364\t\036uj\330\243N\n\254\261HB\207\265\207\305\360\004\031\200+\221G\206u\007x\234\241hT\217=E\242\272\002\214 \013\307\342\013\365g]\215\304cO\017\214\016\326#\214\232\236bQ\003\235\230\235\3258\\{\210\301\031\212&\030\213G#\f\242\220\3259\301\376\360"
+	.ascii	"\331\037\030E\024,\206\306\026BV\207\305\351\2258\244\200\002"
+	.ascii	"\b$0A\342CWP\001\212\020(\210\340\001&\222`\331\242\013\035\031"
+	.ascii	"\303\236\027G\236\235\022E\236\022?<C\237\022D\343\261\004\211"
+	.ascii	"\020\307\225\205\301\202\307\310\262\031\2601\326\023vV\326X"
+	.ascii	"|\361\002\306\212\235\325\005qH\0041\235\373.\\|D\321\333\252"
+	.ascii	"\251j\351\344\362\2563\356\f\312\307\305\273Rr\b\341Btw\263\310"
+	.ascii	"\234z@_\275B&\267\205\346\303\212\231\006Y\212xT\271jw\031fc"
+	.ascii	"\357U\241^]\335\335\312\301\231\013\355k\n\204h\350\007\026\202"
+	.ascii	"\221\223\273sd6>\360j\354\240\322w\356\352%Mk\\\034Py\251\013"
+	.ascii	"\007\226\231\212\213CB\375\370n\2468\221\213\276\332"
+	.string	"2@x\246\351\346v\245\344<\357\334\r\245h\364\243h\371\235E\351+\205\206\353\013\022\352\325\373\366L\301\266\351\224E\367T5\205\345\005\313\024\265\265\335\221M\243L6+xXf\211\215\355{\270T\034\324\217\317\231\210\234\270\261a\031\257\265\265<\232'}L\200\220`\231#M\232\334,\307i\225zzUAg\237\322h\b\2261S\242\344\252\345\340\334\265\204oz\363\204\312\"J\353\253F\203\005\bI\373\352E{\037`\316\266W\357\022w+\353\332#K~\236\333\032\364\325\026>\361\214\262\254\354\232y\b\223\346\203\211\317C\217\035B\314\204XA\213\364\260L\025\025b\035\202\353\2502\031-\212\363\n\021!\022\021\221$I\322\001\342\n\020\004\243q\240\307\350\006\022\200TA\3249\347f$I\n\222}\266\003\225\336\3258\001?\327\262\364\254\r\366\243q\232\276\240\27022\033@\024W*\301\233\241ka"
+	.string	"\261#re\024\352\001^\250\030\376\326v\230T\337\332j_\0022\275-\220\017\273\336\037\207\365YBR\215\227\332\237~\350\367\nLN\002\b\"\254\002\360G\204\017\330\345\272\242\337\213|\241\201<\211\205O\003"
+	.string	"Ou$.\341yb\027\350N\366\321t\332\241\242\303I_\261\210fS\264/\r\261[\331\356\212\231\271\307\3407\314\263\353\202z\220X\332\322\206\274xzN\313vS\261\317\t\301K\373\332\316\320\220\317fHh\230\f|\305sP\016\021FU\213\230\024\021\306\023\243P\340>\274\327\344U\241\272n+\233+y\006\315\007\260\013h\263I\216\376\374\246\026W\225\371@\026\3435`zZ\211\036\013\025\3431@\017\333\374\005\020\r\355\262,E\016\314\254\370{\326>\307\255\261\240\304B\331:\226\225\025\004\337\203\305\003\245\035\342\354\204\316a\b\327\203\306\310\265cF\325\004%\260\350\030\276\332\250\030Z\213M\361\341\325\002\264\243mS\242\337\226x\301/l\221\346|\347\302o\252\240\331\357M\255%\242\003\333\275\037\321\311\347s\324\323JT_\023\f(\212\017\256\311\341jF$\021\356\320\207\345"
+	.string	"\027\336\257O\352\366\217v\344\307L\003\347\036\"\026\333x\303F\223X$\020\245_\350\210\013\302\277\245@\243\247\"\207\322@4\034LW\372\303;\327\021\326\207Pf\254\004\\\3728\235qf\301\364FLY_\322\033u\321mbTHh\022\225\245$#^\030\"\307\013\027p\322\017\252\036\016\221C\270\305YK{\033\225\264\021\223\256\211\332\271\345-\361\374\334\273\237 \031g\353\360\230O\362\235\"\244@x\263\307f\355p\336\244M/+\247\332\323\324\026v\265\003\376\243\bn\377p\001>T\262\2211\262\225v\310*\344\266\324\020\304\270\272\023\026*\244P\f\021Z\024JeP\246V5\320H\024\212\031\355x\"\360\356\026\364\001\257\234o\240\206G\267\277\320\272q\370`AY\350\373\205\262q\205\212\270x\232\235*\313\361D"
+	.string	"7\214\310F\003X\b\227\211\272\304\315\202\355\211\036'dL\231A\250\r6\307\f;\345c\210\345\2244\217\245\213\035\212g;S?F\322\221a\305\371\001\263\034M\027\t\362k"
+	.ascii	"\220\013\r\227\247\215\300\002\276\243X3$`b\003\324\367G\323"
+	.ascii	"x\353\210\305\302\367\213\300\004W\220\r\212##o\2248\261%=\247"
+	.ascii	"\376\342#-\024\343\231\021\234^\363\246\037\002"
+	.string	"\224\245\rI\242\006\b\356\307\216\316!\307\023\243\b\177,\221\032n\316\177\346;\361\016\331\372\303\027\346h\237\200\005\350\243p\334;\315\353\226\222\235\207\005$G\303\340}\006\026\320\333x\305\251\002Z?\313\020j2(\016\352\030k\005>B\334\227(\211\353O4Z\023\313\020 \017\004\17788\f\342|\344\303\317\353\221a.%D\214\t\322\026\0302\317\276:I\tcl_(1\230\212\017l\353\332i\331>\377\216\r\263\236\275\206\347\273\245|\260\250\032\013\237\236\034L\0055\202\362\030W\266\037\321\025O@@\t\213\214A\271eH\247\346'\350h\365v\225\255\217\b\177\037\366"
+	.string	"\204g\340?\216\253\242wE\254|\307\023\005\203\337\024\312\337K\262v\315\373\323\304:\253}D\350\\'\360\363\350`\312\342\340\264c8\254Sh\025 \200\212@4\210\243\002\260K\004\343\227,\375\2054\232\321\t\345b\225-\241\344\255\207(\320\307Y`\2229\365\331\024\240aX%\034E\211"
+	.ascii	"\221\\\016\313P\001\r\t\334M\b\320\264\273\352>\002Z@pV\325\246"
+	.ascii	"\260y\355\244\f\353\250\305\r\004\276\363C;\252\221\016\271\312"
+	.ascii	"\332!)\224\031\307\271^\016\001\034G\233\271\214\337[M\365A\364"
+	.ascii	",\233\322\366\273& FEH\227\023\217\346\201n\313\210\302\261\260"
+	.ascii	"\332\300\336\201T[\341E\376\372\345,\n\255n\340\317A\273V\033"
+	.ascii	"\266\017\232P?k\267 |0\243 \005\372(J\b*KtZ\261K\003S\277\355"
+	.ascii	"\344:\226\271\325\216\360\365\226\265\231\247F\232\325\035!\241"
+	.ascii	"\257\274\364\353\263\347\037\334H\027J!\314\f\005\254i\003b\352"
+	.ascii	"\225\274\r\311\nuQ_r\n\241&\177r\326\034\301C\315\300\333sR\264"
+	.ascii	"\00744~\303\360>\377\225\321)\377V\030\343G\342\334\214\201\366"
+	.ascii	"\253\375\271\300\023\313\333aP(\271\007\302.\252\216\023^\332"
+	.ascii	"\273L\362\266\013?\255\037\263 '\315\337A\265\317qJ\305\267\303"
+	.ascii	"\264C\266\354^\r\303\372\357dd\333\262\371\017\352)\311f\220"
+	.ascii	"_x\272q/\031!zs\021s\b9\247\210\036\322-\277\371}\363Ghj~\006"
+	.ascii	"\376\360S\247QSss%\340\023\304\017\337\347\200K\204\307b\276"
+	.ascii	"\365\027H\203\254\233\344\013\352\2240n\013\337\036\217A\364"
+	.ascii	"\241\376\374\337\335\376',\260\346\r\232N\316\034\223\037\256"
+	.ascii	"\215\323\326\360\365\361P\277c\362\306fY\301\021\375u\372\007"
+	.ascii	"\231\337j`\331\353V0W/m"
+	.text
+	.section	.gnu.lto_.symtab.dde8472c27092f3d,"e",@progbits
+	.string	"hottDisplayPort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\f\001"
+	.string	""
+	.string	"displayPortHottInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\001"
+	.string	""
+	.string	"hottDisplayportRegister"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\001"
+	.string	""
+	.string	"hottCmsOpen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"hottSetCmsKey"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\001"
+	.string	""
+	.string	"cmsInMenu"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"cmsMenuExit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"hottTextmodeIsAlive"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\001"
+	.string	""
+	.string	"hottTextmodeWriteChar"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\322\001"
+	.string	""
+	.string	"hottTextmodeExit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\001"
+	.string	""
+	.string	"hottTextmodeGrab"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\326\001"
+	.string	""
+	.string	"cmsDisplayPortSelect"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\001"
+	.string	""
+	.string	"cmsMenuOpen"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\337\001"
+	.string	""
+	.string	"cmsDisplayPortRegister"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\341\001"
+	.string	""
+	.string	"cmsSetExternKey"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\001"
+	.string	""
+	.string	"cmsDisplayPortGetCurrent"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.dde8472c27092f3d,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,12289 @@
+	.file	"displayport_msp.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 5 "./src/main/drivers/display.h"
+	.file 6 "./src/main/drivers/resource.h"
+	.file 7 "./src/main/io/displayport_msp.c"
+	.file 8 "/usr/include/string.h"
+	.file 9 "./src/main/msp/msp_serial.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	displayport_msp.c.2bf578c9
+	.weak	displayport_msp.c.2bf578c9
+displayport_msp.c.2bf578c9:
+	.long	0x8ef
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x15
+	.long	.LASF1913
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1780
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1781
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1782
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1783
+	.uleb128 0x5
+	.long	.LASF1785
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1784
+	.uleb128 0x5
+	.long	.LASF1786
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1787
+	.uleb128 0x5
+	.long	.LASF1788
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x5
+	.long	.LASF1789
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1790
+	.uleb128 0x17
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1791
+	.uleb128 0xc
+	.long	0x8c
+	.uleb128 0x5
+	.long	.LASF1792
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x5
+	.long	.LASF1793
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xc
+	.long	0xa4
+	.uleb128 0x5
+	.long	.LASF1794
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x5
+	.long	.LASF1795
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x77
+	.uleb128 0x5
+	.long	.LASF1796
+	.byte	0x4
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x4
+	.long	0x93
+	.uleb128 0x4
+	.long	0xa4
+	.uleb128 0x5
+	.long	.LASF1797
+	.byte	0x5
+	.byte	0x19
+	.byte	0x1f
+	.long	0xf4
+	.uleb128 0xc
+	.long	0xe3
+	.uleb128 0xd
+	.long	.LASF1805
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1798
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x5
+	.byte	0x21
+	.long	0x11e
+	.uleb128 0x1
+	.long	.LASF1799
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1800
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1801
+	.byte	0x2
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF1802
+	.byte	0x5
+	.byte	0x25
+	.byte	0x3
+	.long	0x100
+	.uleb128 0x5
+	.long	.LASF1803
+	.byte	0x5
+	.byte	0x2b
+	.byte	0x11
+	.long	0xa4
+	.uleb128 0x5
+	.long	.LASF1804
+	.byte	0x5
+	.byte	0x41
+	.byte	0x20
+	.long	0x142
+	.uleb128 0xd
+	.long	.LASF1806
+	.uleb128 0x5
+	.long	.LASF1807
+	.byte	0x5
+	.byte	0x42
+	.byte	0x26
+	.long	0x153
+	.uleb128 0xd
+	.long	.LASF1808
+	.uleb128 0x5
+	.long	.LASF1809
+	.byte	0x5
+	.byte	0x43
+	.byte	0x24
+	.long	0x169
+	.uleb128 0xc
+	.long	0x158
+	.uleb128 0x12
+	.long	.LASF1829
+	.byte	0x98
+	.byte	0x56
+	.long	0x259
+	.uleb128 0x3
+	.long	.LASF1810
+	.byte	0x57
+	.byte	0xb
+	.long	0x31f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1811
+	.byte	0x58
+	.byte	0xb
+	.long	0x31f
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1812
+	.byte	0x59
+	.byte	0xb
+	.long	0x31f
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1813
+	.byte	0x5a
+	.byte	0xb
+	.long	0x31f
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1814
+	.byte	0x5b
+	.byte	0xb
+	.long	0x338
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1815
+	.byte	0x5c
+	.byte	0xb
+	.long	0x360
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1816
+	.byte	0x5d
+	.byte	0xb
+	.long	0x388
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1817
+	.byte	0x5e
+	.byte	0xb
+	.long	0x3ba
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1818
+	.byte	0x5f
+	.byte	0xb
+	.long	0x3ce
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1819
+	.byte	0x60
+	.byte	0xb
+	.long	0x31f
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF1820
+	.byte	0x61
+	.byte	0xc
+	.long	0x3de
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF1821
+	.byte	0x62
+	.byte	0x10
+	.long	0x3f2
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF1822
+	.byte	0x63
+	.byte	0x18
+	.long	0x406
+	.byte	0x60
+	.uleb128 0x3
+	.long	.LASF1823
+	.byte	0x64
+	.byte	0xb
+	.long	0x424
+	.byte	0x68
+	.uleb128 0x3
+	.long	.LASF1824
+	.byte	0x65
+	.byte	0xb
+	.long	0x447
+	.byte	0x70
+	.uleb128 0x3
+	.long	.LASF1825
+	.byte	0x66
+	.byte	0xb
+	.long	0x45b
+	.byte	0x78
+	.uleb128 0x3
+	.long	.LASF1826
+	.byte	0x67
+	.byte	0xc
+	.long	0x470
+	.byte	0x80
+	.uleb128 0x3
+	.long	.LASF1827
+	.byte	0x68
+	.byte	0xc
+	.long	0x3de
+	.byte	0x88
+	.uleb128 0x3
+	.long	.LASF1828
+	.byte	0x69
+	.byte	0xb
+	.long	0x48e
+	.byte	0x90
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF1830
+	.byte	0x20
+	.byte	0x45
+	.long	0x2f5
+	.uleb128 0x3
+	.long	.LASF1831
+	.byte	0x46
+	.byte	0x20
+	.long	0x2f5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1832
+	.byte	0x47
+	.byte	0xb
+	.long	0x8a
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1833
+	.byte	0x48
+	.byte	0xd
+	.long	0xa4
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1834
+	.byte	0x49
+	.byte	0xd
+	.long	0xa4
+	.byte	0x11
+	.uleb128 0x3
+	.long	.LASF1835
+	.byte	0x4a
+	.byte	0xd
+	.long	0xa4
+	.byte	0x12
+	.uleb128 0x3
+	.long	.LASF1836
+	.byte	0x4b
+	.byte	0xd
+	.long	0xa4
+	.byte	0x13
+	.uleb128 0x3
+	.long	.LASF1837
+	.byte	0x4e
+	.byte	0x9
+	.long	0xf9
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1838
+	.byte	0x4f
+	.byte	0x9
+	.long	0xf9
+	.byte	0x15
+	.uleb128 0x3
+	.long	.LASF1839
+	.byte	0x50
+	.byte	0xc
+	.long	0x98
+	.byte	0x16
+	.uleb128 0x3
+	.long	.LASF1840
+	.byte	0x51
+	.byte	0xc
+	.long	0x98
+	.byte	0x17
+	.uleb128 0x3
+	.long	.LASF1841
+	.byte	0x52
+	.byte	0x16
+	.long	0x12a
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1842
+	.byte	0x53
+	.byte	0xe
+	.long	0xb5
+	.byte	0x1a
+	.byte	0
+	.uleb128 0x4
+	.long	0x164
+	.uleb128 0x5
+	.long	.LASF1843
+	.byte	0x5
+	.byte	0x54
+	.byte	0x3
+	.long	0x259
+	.uleb128 0xc
+	.long	0x2fa
+	.uleb128 0x7
+	.long	0x70
+	.long	0x31a
+	.uleb128 0x2
+	.long	0x31a
+	.byte	0
+	.uleb128 0x4
+	.long	0x2fa
+	.uleb128 0x4
+	.long	0x30b
+	.uleb128 0x7
+	.long	0x70
+	.long	0x333
+	.uleb128 0x2
+	.long	0x333
+	.byte	0
+	.uleb128 0x4
+	.long	0x306
+	.uleb128 0x4
+	.long	0x324
+	.uleb128 0x7
+	.long	0x70
+	.long	0x360
+	.uleb128 0x2
+	.long	0x31a
+	.uleb128 0x2
+	.long	0xa4
+	.uleb128 0x2
+	.long	0xa4
+	.uleb128 0x2
+	.long	0xd9
+	.uleb128 0x2
+	.long	0x12a
+	.byte	0
+	.uleb128 0x4
+	.long	0x33d
+	.uleb128 0x7
+	.long	0x70
+	.long	0x388
+	.uleb128 0x2
+	.long	0x31a
+	.uleb128 0x2
+	.long	0xa4
+	.uleb128 0x2
+	.long	0xa4
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0x12a
+	.byte	0
+	.uleb128 0x4
+	.long	0x365
+	.uleb128 0x7
+	.long	0xf9
+	.long	0x3b0
+	.uleb128 0x2
+	.long	0x31a
+	.uleb128 0x2
+	.long	0xa4
+	.uleb128 0x2
+	.long	0xa4
+	.uleb128 0x2
+	.long	0x3b0
+	.uleb128 0x2
+	.long	0x3b5
+	.byte	0
+	.uleb128 0x4
+	.long	0xb5
+	.uleb128 0x4
+	.long	0x12a
+	.uleb128 0x4
+	.long	0x38d
+	.uleb128 0x7
+	.long	0xf9
+	.long	0x3ce
+	.uleb128 0x2
+	.long	0x333
+	.byte	0
+	.uleb128 0x4
+	.long	0x3bf
+	.uleb128 0x13
+	.long	0x3de
+	.uleb128 0x2
+	.long	0x31a
+	.byte	0
+	.uleb128 0x4
+	.long	0x3d3
+	.uleb128 0x7
+	.long	0xc1
+	.long	0x3f2
+	.uleb128 0x2
+	.long	0x333
+	.byte	0
+	.uleb128 0x4
+	.long	0x3e3
+	.uleb128 0x7
+	.long	0x12a
+	.long	0x406
+	.uleb128 0x2
+	.long	0x333
+	.byte	0
+	.uleb128 0x4
+	.long	0x3f7
+	.uleb128 0x7
+	.long	0xf9
+	.long	0x41f
+	.uleb128 0x2
+	.long	0x41f
+	.uleb128 0x2
+	.long	0x333
+	.byte	0
+	.uleb128 0x4
+	.long	0x147
+	.uleb128 0x4
+	.long	0x40b
+	.uleb128 0x7
+	.long	0x70
+	.long	0x442
+	.uleb128 0x2
+	.long	0x31a
+	.uleb128 0x2
+	.long	0xb5
+	.uleb128 0x2
+	.long	0x442
+	.byte	0
+	.uleb128 0x4
+	.long	0xef
+	.uleb128 0x4
+	.long	0x429
+	.uleb128 0x7
+	.long	0xf9
+	.long	0x45b
+	.uleb128 0x2
+	.long	0x31a
+	.byte	0
+	.uleb128 0x4
+	.long	0x44c
+	.uleb128 0x13
+	.long	0x470
+	.uleb128 0x2
+	.long	0x31a
+	.uleb128 0x2
+	.long	0x11e
+	.byte	0
+	.uleb128 0x4
+	.long	0x460
+	.uleb128 0x7
+	.long	0xf9
+	.long	0x489
+	.uleb128 0x2
+	.long	0x489
+	.uleb128 0x2
+	.long	0x333
+	.byte	0
+	.uleb128 0x4
+	.long	0x136
+	.uleb128 0x4
+	.long	0x475
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x6
+	.byte	0x16
+	.long	0x583
+	.uleb128 0x1
+	.long	.LASF1844
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1845
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1846
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1847
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1848
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1850
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1851
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1852
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1853
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1854
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1855
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1856
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1857
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1858
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1859
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1860
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1861
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1862
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1863
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1864
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1865
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1866
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1867
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1868
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1869
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1870
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1871
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1872
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1873
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1874
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1875
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1876
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1877
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1878
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1879
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1880
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1881
+	.byte	0x25
+	.byte	0
+	.uleb128 0xe
+	.long	0x30
+	.byte	0x6
+	.byte	0x43
+	.long	0x60d
+	.uleb128 0x1
+	.long	.LASF1882
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1883
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1884
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1885
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1886
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1888
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1889
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1890
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1891
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1892
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1893
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1894
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1895
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1896
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1897
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1898
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1899
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1900
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1901
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1902
+	.byte	0x14
+	.byte	0
+	.uleb128 0x4
+	.long	0xb0
+	.uleb128 0x4
+	.long	0x617
+	.uleb128 0x18
+	.uleb128 0xb
+	.long	.LASF1903
+	.byte	0x29
+	.byte	0x16
+	.long	0x2fa
+	.uleb128 0x19
+	.long	.LASF1914
+	.byte	0x7
+	.byte	0x2b
+	.byte	0x10
+	.long	0xa4
+	.uleb128 0xb
+	.long	.LASF1904
+	.byte	0x8f
+	.byte	0x22
+	.long	0x164
+	.uleb128 0x14
+	.long	.LASF1905
+	.byte	0x8
+	.byte	0x2b
+	.byte	0xe
+	.long	0x8a
+	.long	0x65a
+	.uleb128 0x2
+	.long	0x8a
+	.uleb128 0x2
+	.long	0x612
+	.uleb128 0x2
+	.long	0xcd
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF1906
+	.byte	0x8
+	.value	0x197
+	.byte	0xf
+	.long	0xcd
+	.long	0x671
+	.uleb128 0x2
+	.long	0xd9
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF1907
+	.byte	0x9
+	.byte	0x70
+	.byte	0x5
+	.long	0x70
+	.long	0x691
+	.uleb128 0x2
+	.long	0xa4
+	.uleb128 0x2
+	.long	0x60d
+	.uleb128 0x2
+	.long	0x70
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1915
+	.byte	0x9
+	.byte	0x71
+	.byte	0xa
+	.long	0xc1
+	.uleb128 0x1c
+	.long	.LASF1916
+	.byte	0x5
+	.byte	0x8b
+	.byte	0x6
+	.long	0x6b4
+	.uleb128 0x2
+	.long	0x31a
+	.uleb128 0x2
+	.long	0x2f5
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF1917
+	.byte	0x7
+	.byte	0x9f
+	.byte	0x10
+	.long	0x31a
+	.uleb128 0x8
+	.long	.LASF1821
+	.byte	0x89
+	.byte	0x11
+	.long	0xc1
+	.long	0x6db
+	.uleb128 0x6
+	.long	.LASF1908
+	.byte	0x89
+	.byte	0x32
+	.long	0x333
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1820
+	.byte	0x7
+	.byte	0x83
+	.byte	0xd
+	.long	0x6f3
+	.uleb128 0x6
+	.long	.LASF1908
+	.byte	0x83
+	.byte	0x23
+	.long	0x31a
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1818
+	.byte	0x7d
+	.byte	0xc
+	.long	0xf9
+	.long	0x70e
+	.uleb128 0x6
+	.long	.LASF1908
+	.byte	0x7d
+	.byte	0x36
+	.long	0x333
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1816
+	.byte	0x74
+	.byte	0xc
+	.long	0x70
+	.long	0x75e
+	.uleb128 0x6
+	.long	.LASF1908
+	.byte	0x74
+	.byte	0x25
+	.long	0x31a
+	.uleb128 0xa
+	.string	"col"
+	.byte	0x74
+	.byte	0x3a
+	.long	0xa4
+	.uleb128 0xa
+	.string	"row"
+	.byte	0x74
+	.byte	0x47
+	.long	0xa4
+	.uleb128 0xa
+	.string	"c"
+	.byte	0x74
+	.byte	0x55
+	.long	0xb5
+	.uleb128 0x6
+	.long	.LASF1909
+	.byte	0x74
+	.byte	0x69
+	.long	0x12a
+	.uleb128 0xf
+	.string	"buf"
+	.byte	0x76
+	.byte	0xa
+	.long	0x75e
+	.byte	0
+	.uleb128 0x10
+	.long	0x8c
+	.long	0x76e
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1815
+	.byte	0x60
+	.byte	0xc
+	.long	0x70
+	.long	0x7cb
+	.uleb128 0x6
+	.long	.LASF1908
+	.byte	0x60
+	.byte	0x27
+	.long	0x31a
+	.uleb128 0xa
+	.string	"col"
+	.byte	0x60
+	.byte	0x3c
+	.long	0xa4
+	.uleb128 0xa
+	.string	"row"
+	.byte	0x60
+	.byte	0x49
+	.long	0xa4
+	.uleb128 0x6
+	.long	.LASF1910
+	.byte	0x60
+	.byte	0x5a
+	.long	0xd9
+	.uleb128 0x6
+	.long	.LASF1909
+	.byte	0x60
+	.byte	0x73
+	.long	0x12a
+	.uleb128 0xf
+	.string	"buf"
+	.byte	0x64
+	.byte	0xd
+	.long	0x7cb
+	.uleb128 0xf
+	.string	"len"
+	.byte	0x66
+	.byte	0x9
+	.long	0x70
+	.byte	0
+	.uleb128 0x10
+	.long	0xa4
+	.long	0x7db
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x21
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1814
+	.byte	0x5b
+	.byte	0xc
+	.long	0x70
+	.long	0x7f6
+	.uleb128 0x6
+	.long	.LASF1908
+	.byte	0x5b
+	.byte	0x2c
+	.long	0x333
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1813
+	.byte	0x55
+	.byte	0xc
+	.long	0x70
+	.long	0x81c
+	.uleb128 0x6
+	.long	.LASF1908
+	.byte	0x55
+	.byte	0x26
+	.long	0x31a
+	.uleb128 0xb
+	.long	.LASF1911
+	.byte	0x57
+	.byte	0xd
+	.long	0x81c
+	.byte	0
+	.uleb128 0x10
+	.long	0xa4
+	.long	0x82c
+	.uleb128 0x11
+	.long	0x37
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1812
+	.byte	0x4e
+	.byte	0xc
+	.long	0x70
+	.long	0x852
+	.uleb128 0x6
+	.long	.LASF1908
+	.byte	0x4e
+	.byte	0x27
+	.long	0x31a
+	.uleb128 0xb
+	.long	.LASF1911
+	.byte	0x50
+	.byte	0xd
+	.long	0x81c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1811
+	.byte	0x47
+	.byte	0xc
+	.long	0x70
+	.long	0x878
+	.uleb128 0x6
+	.long	.LASF1908
+	.byte	0x47
+	.byte	0x23
+	.long	0x31a
+	.uleb128 0xb
+	.long	.LASF1911
+	.byte	0x49
+	.byte	0xd
+	.long	0x81c
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1810
+	.byte	0x42
+	.byte	0xc
+	.long	0x70
+	.long	0x893
+	.uleb128 0x6
+	.long	.LASF1908
+	.byte	0x42
+	.byte	0x20
+	.long	0x31a
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1819
+	.byte	0x38
+	.byte	0xc
+	.long	0x70
+	.long	0x8b9
+	.uleb128 0x6
+	.long	.LASF1908
+	.byte	0x38
+	.byte	0x25
+	.long	0x31a
+	.uleb128 0xb
+	.long	.LASF1911
+	.byte	0x3a
+	.byte	0xd
+	.long	0x81c
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1912
+	.byte	0x7
+	.byte	0x2d
+	.byte	0xc
+	.long	0x70
+	.uleb128 0x6
+	.long	.LASF1908
+	.byte	0x2d
+	.byte	0x22
+	.long	0x31a
+	.uleb128 0xa
+	.string	"cmd"
+	.byte	0x2d
+	.byte	0x37
+	.long	0xa4
+	.uleb128 0xa
+	.string	"buf"
+	.byte	0x2d
+	.byte	0x45
+	.long	0xde
+	.uleb128 0xa
+	.string	"len"
+	.byte	0x2d
+	.byte	0x4e
+	.long	0x70
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x13
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 16
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 10 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 11 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 12 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xc
+	.file 13 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 14 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 15 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 16 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x10
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 21 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF722
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF723
+	.byte	0x4
+	.byte	0x4
+	.file 28 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 29 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF725
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.file 32 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x20
+	.file 33 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 34 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x22
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 35 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x23
+	.byte	0x4
+	.file 36 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x4
+	.file 37 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x25
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.file 38 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x26
+	.file 39 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 40 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 41 "./src/main/fc/fc_msp.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x29
+	.file 42 "./src/main/msp/msp.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2a
+	.file 43 "./src/main/common/streambuf.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x4
+	.file 44 "./src/main/io/displayport_msp.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2c
+	.byte	0x4
+	.file 45 "./src/main/msp/msp_protocol.h"
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 46 "./src/main/msp/msp_protocol_v2_common.h"
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 47 "./src/main/msp/msp_protocol_v2_sensor.h"
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 48 "./src/main/msp/msp_protocol_v2_inav.h"
+	.byte	0x3
+	.uleb128 0x14b
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x9
+	.file 49 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x31
+	.file 50 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x4
+	.file 51 "./src/main/io/serial.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x33
+	.file 52 "./src/main/drivers/serial.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x34
+	.file 53 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x35
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1382
+	.byte	0x4
+	.file 54 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.file 55 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.file 56 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1779
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF698
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF731
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF733
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.46a70d544f77cb07ab69aafc19a8be6f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF791
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF884
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF897
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF898
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF914
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF915
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF916
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF720
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF917
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF940
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF941
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF942
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF943
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF945
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF946
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF947
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF948
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF949
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF950
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF951
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF952
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF953
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF954
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF955
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF956
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF957
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF958
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF959
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF960
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF961
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF962
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF963
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF979
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF944
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF981
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF987
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1016
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1026
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1049
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1118
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1131
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp.h.22.d396ff4ca7f12b7696f36a44fa5aa886,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1133
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol.h.60.df1a5c043e2e4ca2e25f4ac4c907ab71,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x12b
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1313
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol_v2_common.h.18.b86f8d7f853153e98d87360103e37a68,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1327
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol_v2_sensor.h.18.18fe88d41ea597d5df13b783c778426d,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1330
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_protocol_v2_inav.h.21.d7220ba697f30312e07cad49a55b0841,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1371
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1381
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1384
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1404
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1772
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.msp_serial.h.25.0ada13d95b5e41eba59a17ad8f6583ca,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1778
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF1918
+	.long	.LASF1919
+	.long	.LASF1920
+	.long	.LASF1921
+	.long	.LASF1922
+	.long	.LASF1923
+	.long	.LASF1924
+	.long	.LASF1925
+	.long	.LASF1926
+	.long	.LASF1927
+	.long	.LASF1928
+	.long	.LASF1929
+	.long	.LASF1930
+	.long	.LASF1931
+	.long	.LASF1932
+	.long	.LASF1933
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x39
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1934
+	.byte	0xc
+	.long	.LASF1935
+	.byte	0xc
+	.long	.LASF1936
+	.byte	0xc
+	.long	.LASF1937
+	.byte	0x10
+	.long	.LASF1938
+	.byte	0x4
+	.long	.LASF1939
+	.byte	0x4
+	.long	.LASF1940
+	.byte	0x6
+	.long	.LASF1941
+	.byte	0xf
+	.long	.LASF1942
+	.byte	0x7
+	.long	.LASF1943
+	.byte	0xf
+	.long	.LASF1944
+	.byte	0x10
+	.long	.LASF1945
+	.byte	0x10
+	.long	.LASF1945
+	.byte	0xf
+	.long	.LASF1946
+	.byte	0xc
+	.long	.LASF1947
+	.byte	0xf
+	.long	.LASF1948
+	.byte	0xf
+	.long	.LASF1949
+	.byte	0xc
+	.long	.LASF1950
+	.byte	0xc
+	.long	.LASF1951
+	.byte	0xe
+	.long	.LASF1952
+	.byte	0xc
+	.long	.LASF1953
+	.byte	0xd
+	.long	.LASF1954
+	.byte	0xd
+	.long	.LASF1955
+	.byte	0xc
+	.long	.LASF1956
+	.byte	0xc
+	.long	.LASF1957
+	.byte	0xc
+	.long	.LASF1958
+	.byte	0xb
+	.long	.LASF1959
+	.byte	0xb
+	.long	.LASF1960
+	.byte	0xf
+	.long	.LASF1961
+	.byte	0xf
+	.long	.LASF1962
+	.byte	0xc
+	.long	.LASF1963
+	.byte	0xc
+	.long	.LASF1964
+	.byte	0xa
+	.long	.LASF1965
+	.byte	0x9
+	.long	.LASF1966
+	.byte	0x8
+	.long	.LASF1967
+	.byte	0x9
+	.long	.LASF1968
+	.byte	0x9
+	.long	.LASF1969
+	.byte	0x2
+	.long	.LASF1970
+	.byte	0x3
+	.long	.LASF1971
+	.byte	0x1
+	.long	.LASF1972
+	.byte	0x3
+	.long	.LASF1973
+	.byte	0x5
+	.long	.LASF1974
+	.byte	0x7
+	.long	.LASF1975
+	.byte	0x2
+	.long	.LASF1976
+	.byte	0x6
+	.long	.LASF1977
+	.byte	0x7
+	.long	.LASF1978
+	.byte	0x7
+	.long	.LASF1979
+	.byte	0x7
+	.long	.LASF1980
+	.byte	0x7
+	.long	.LASF1981
+	.byte	0x4
+	.long	.LASF1981
+	.byte	0x2
+	.long	.LASF1982
+	.byte	0x6
+	.long	.LASF1982
+	.byte	0x4
+	.long	.LASF1983
+	.byte	0x4
+	.long	.LASF1984
+	.byte	0x4
+	.long	.LASF1985
+	.byte	0x4
+	.long	.LASF1986
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1764:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1259:
+	.string	"MSP_ANALOG 110"
+.LASF847:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF947:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF820:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1456:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1594:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1005:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF796:
+	.string	"USE_RX_PPM "
+.LASF1494:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF925:
+	.string	"USE_BARO "
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF850:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1426:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF908:
+	.string	"_WCHAR_T_DEFINED "
+.LASF870:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1303:
+	.string	"MSP_SENSOR_STATUS 151"
+.LASF1237:
+	.string	"MSP_SET_FILTER_CONFIG 93"
+.LASF832:
+	.string	"USE_PITOT_MS4525 "
+.LASF1520:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1771:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF932:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF784:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF1538:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF727:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1342:
+	.string	"MSP2_INAV_MC_BRAKING 0x200B"
+.LASF871:
+	.string	"USE_SERIALRX_CRSF "
+.LASF770:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF753:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF1667:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1069:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF1094:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1799:
+	.string	"DISPLAY_TRANSACTION_OPT_NONE"
+.LASF726:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1027:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1406:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1649:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF851:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1786:
+	.string	"__uint8_t"
+.LASF1206:
+	.string	"MSP_PID_CONTROLLER 59"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1831:
+	.string	"vTable"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1809:
+	.string	"displayPortVTable_t"
+.LASF1798:
+	.string	"_Bool"
+.LASF1275:
+	.string	"MSP_LED_STRIP_MODECOLOR 127"
+.LASF1613:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF969:
+	.string	"U_ID_2 2"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF747:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1385:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1806:
+	.string	"displayCanvas_s"
+.LASF1804:
+	.string	"displayCanvas_t"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1044:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1755:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1383:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1728:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1701:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1288:
+	.string	"MSP_SET_SERVO_CONFIGURATION 212"
+.LASF778:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF953:
+	.string	"USE_1WIRE"
+.LASF942:
+	.string	"USE_USB_MSC"
+.LASF1407:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1691:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1129:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1637:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF1656:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1183:
+	.string	"MSP_FEATURE 36"
+.LASF1396:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF900:
+	.string	"__WCHAR_T__ "
+.LASF1221:
+	.string	"MSP_FAILSAFE_CONFIG 75"
+.LASF1297:
+	.string	"MSP_RESERVE_1 251"
+.LASF797:
+	.string	"USE_SERIAL_RX "
+.LASF854:
+	.string	"USE_CMS "
+.LASF1309:
+	.string	"MSP_SERVO_MIX_RULES 241"
+.LASF1599:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1583:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF1381:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF979:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1664:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1707:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1678:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1052:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF1211:
+	.string	"MSP_SET_RX_MAP 65"
+.LASF1868:
+	.string	"OWNER_LED"
+.LASF951:
+	.string	"USE_PITOT_MS4525"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1767:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1232:
+	.string	"MSP_VTX_CONFIG 88"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1204:
+	.string	"MSP_SET_VOLTAGE_METER_CONFIG 57"
+.LASF880:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1794:
+	.string	"uint16_t"
+.LASF1893:
+	.string	"RESOURCE_SPI_SCK"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1067:
+	.string	"PG_RX_CONFIG 24"
+.LASF1329:
+	.string	"MSP2_SENSOR_RANGEFINDER 0x1F01"
+.LASF1699:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1376:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1133:
+	.string	"MSP_VERSION_MAGIC_INITIALIZER { 'M', 'M', 'X' }"
+.LASF882:
+	.string	"USE_CLI_BATCH "
+.LASF773:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF1039:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF1666:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1424:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF735:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1917:
+	.string	"displayPortMspInit"
+.LASF1467:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1287:
+	.string	"MSP_SET_HEAD 211"
+.LASF889:
+	.string	"_T_PTRDIFF_ "
+.LASF792:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1705:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1612:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF1283:
+	.string	"MSP_SET_MISC 207"
+.LASF1434:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1642:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1108:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF936:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1235:
+	.string	"MSP_SET_ADVANCED_CONFIG 91"
+.LASF1546:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1327:
+	.string	"MSP2_COMMON_SET_SETTINGS 0x100E"
+.LASF1251:
+	.string	"MSP_RAW_IMU 102"
+.LASF1306:
+	.string	"MSP_GPSSTATISTICS 166"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1525:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1338:
+	.string	"MSP2_INAV_RATE_PROFILE 0x2007"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1533:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF937:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1008:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF899:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1419:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF1247:
+	.string	"MSP_SET_TX_INFO 186"
+.LASF1449:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF771:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF1498:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1818:
+	.string	"isTransferInProgress"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1227:
+	.string	"MSP_SET_TRANSPONDER_CONFIG 83"
+.LASF1731:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1882:
+	.string	"RESOURCE_NONE"
+.LASF1624:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1687:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1418:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1759:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF842:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1427:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1772:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF1030:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1004:
+	.string	"BIT(x) (1 << (x))"
+.LASF949:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1435:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1558:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1586:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1452:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1057:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1602:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1891:
+	.string	"RESOURCE_I2C_SCL"
+.LASF1304:
+	.string	"MSP_UID 160"
+.LASF920:
+	.string	"USE_IMU_FAKE "
+.LASF1112:
+	.string	"PG_INAV_END 1023"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1278:
+	.string	"MSP_SET_PID 202"
+.LASF723:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1745:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"___int_wchar_t_h "
+.LASF1873:
+	.string	"OWNER_SPI_PREINIT"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1681:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1398:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1198:
+	.string	"MSP_SET_RSSI_CONFIG 51"
+.LASF1780:
+	.string	"unsigned char"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF941:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1779:
+	.string	"MSP_OSD_MAX_STRING_LENGTH 30"
+.LASF836:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1064:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF1158:
+	.string	"CAP_EXTAUX ((uint32_t)1 << 5)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF960:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF1892:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1134:
+	.string	"MSP_PROTOCOL_VERSION 0"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1475:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1001:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1518:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1076:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF877:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF980:
+	.string	"FAST_CODE "
+.LASF1315:
+	.string	"MSP2_COMMON_SET_TZ 0x1002"
+.LASF1280:
+	.string	"MSP_SET_RC_TUNING 204"
+.LASF1805:
+	.string	"osdCharacter_s"
+.LASF1797:
+	.string	"osdCharacter_t"
+.LASF1505:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF954:
+	.string	"USE_1WIRE_DS2482"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1626:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1577:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1168:
+	.string	"MSP_NAV_POSHOLD 12"
+.LASF1231:
+	.string	"MSP_OSD_CHAR_WRITE 87"
+.LASF1840:
+	.string	"grabCount"
+.LASF838:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1265:
+	.string	"MSP_BOXNAMES 116"
+.LASF772:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF923:
+	.string	"USE_FAKE_GPS "
+.LASF774:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF998:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1325:
+	.string	"MSP2_COMMON_SET_RADAR_ITD 0x100C"
+.LASF839:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1661:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1135:
+	.string	"API_VERSION_MAJOR 2"
+.LASF1734:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1861:
+	.string	"OWNER_USB"
+.LASF1138:
+	.string	"MULTIWII_IDENTIFIER \"MWII\";"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF734:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF396:
+	.string	"false 0"
+.LASF1881:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1041:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1674:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1724:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1216:
+	.string	"MSP_DATAFLASH_SUMMARY 70"
+.LASF1136:
+	.string	"API_VERSION_MINOR 4"
+.LASF1333:
+	.string	"MSP2_INAV_ANALOG 0x2002"
+.LASF1803:
+	.string	"textAttributes_t"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1194:
+	.string	"MSP_SET_LED_COLORS 47"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF864:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1605:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1324:
+	.string	"MSP2_COMMON_SET_RADAR_POS 0x100B"
+.LASF1905:
+	.string	"memcpy"
+.LASF1643:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1589:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF803:
+	.string	"USE_ADC_AVERAGING "
+.LASF1778:
+	.string	"MSP_MAX_HEADER_SIZE 9"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1240:
+	.string	"MSP_SENSOR_CONFIG 96"
+.LASF982:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1277:
+	.string	"MSP_SET_RAW_GPS 201"
+.LASF1597:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1395:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1906:
+	.string	"strlen"
+.LASF1684:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF874:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1863:
+	.string	"OWNER_OSD"
+.LASF1182:
+	.string	"MSP_SET_MODE_RANGE 35"
+.LASF1301:
+	.string	"MSP_V2_FRAME 255"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1849:
+	.string	"OWNER_SERVO"
+.LASF1007:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF746:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1302:
+	.string	"MSP_STATUS_EX 150"
+.LASF1374:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1199:
+	.string	"MSP_ADJUSTMENT_RANGES 52"
+.LASF737:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1153:
+	.string	"CAP_NAVI_VERSION_BIT_2 ((uint32_t)1 << 29)"
+.LASF1189:
+	.string	"MSP_MIXER 42"
+.LASF1714:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF965:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF901:
+	.string	"_WCHAR_T "
+.LASF1300:
+	.string	"MSP_DEBUG 254"
+.LASF1370:
+	.string	"MSP2_INAV_OPFLOW_CALIBRATION 0x2032"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF1880:
+	.string	"OWNER_IRLOCK"
+.LASF1220:
+	.string	"MSP_SET_LOOP_TIME 74"
+.LASF1838:
+	.string	"cleared"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1103:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF730:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1837:
+	.string	"useFullscreen"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1349:
+	.string	"MSP2_INAV_OSD_SET_ALARMS 0x2015"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1727:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1466:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF895:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1033:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1433:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1500:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1659:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1788:
+	.string	"__uint16_t"
+.LASF1229:
+	.string	"MSP_SET_OSD_CONFIG 85"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1848:
+	.string	"OWNER_MOTOR"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1517:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF971:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1816:
+	.string	"writeChar"
+.LASF1401:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1737:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF911:
+	.string	"__INT_WCHAR_T_H "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1201:
+	.string	"MSP_CF_SERIAL_CONFIG 54"
+.LASF1550:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1214:
+	.string	"MSP_REBOOT 68"
+.LASF1405:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1677:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1436:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1157:
+	.string	"CAP_NAVCAP ((uint32_t)1 << 4)"
+.LASF1285:
+	.string	"MSP_SET_WP 209"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF767:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF789:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1845:
+	.string	"OWNER_PWMIO"
+.LASF1148:
+	.string	"BOARD_HARDWARE_REVISION_LENGTH 2"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF841:
+	.string	"USE_OLED_UG2864 "
+.LASF1553:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF858:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF881:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF992:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF763:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF1871:
+	.string	"OWNER_RX_SPI"
+.LASF775:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1482:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1410:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1128:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF760:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1161:
+	.string	"MSP_FC_VERSION 3"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1496:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1114:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1384:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF1031:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF1579:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF896:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1616:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1263:
+	.string	"MSP_MISC 114"
+.LASF1312:
+	.string	"MSP_RTC 246"
+.LASF808:
+	.string	"USE_NAV "
+.LASF1850:
+	.string	"OWNER_SOFTSERIAL"
+.LASF1633:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF358:
+	.string	"__k8 1"
+.LASF1789:
+	.string	"__uint32_t"
+.LASF981:
+	.string	"NOINLINE "
+.LASF1777:
+	.string	"MSP_STREAM_MIN_FRAME_SIZE 64"
+.LASF1284:
+	.string	"MSP_RESET_CONF 208"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1056:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF1432:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1819:
+	.string	"heartbeat"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1522:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF780:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1415:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1912:
+	.string	"output"
+.LASF1387:
+	.string	"IOCFG_OUT_OD 0"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF888:
+	.string	"_PTRDIFF_T "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1474:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1017:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1272:
+	.string	"MSP_3D 124"
+.LASF1808:
+	.string	"displayFontMetadata_s"
+.LASF1807:
+	.string	"displayFontMetadata_t"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF819:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1096:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF810:
+	.string	"USE_TELEMETRY_LTM "
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1479:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF806:
+	.string	"USE_GPS "
+.LASF1088:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF1740:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1373:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF512:
+	.string	"__wur "
+.LASF1709:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1105:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1311:
+	.string	"MSP_SET_PASSTHROUGH 245"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF801:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1680:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1540:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1820:
+	.string	"resync"
+.LASF1876:
+	.string	"OWNER_1WIRE"
+.LASF966:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1567:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1087:
+	.string	"PG_INAV_START 1000"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF907:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1545:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1050:
+	.string	"PG_CF_START 1"
+.LASF1634:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF869:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF986:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1855:
+	.string	"OWNER_RANGEFINDER"
+.LASF1730:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1676:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1184:
+	.string	"MSP_SET_FEATURE 37"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF843:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1519:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF376:
+	.string	"unix 1"
+.LASF1822:
+	.string	"supportedTextAttributes"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1615:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1598:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1253:
+	.string	"MSP_MOTOR 104"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1113:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF964:
+	.string	"USE_ITCM_RAM"
+.LASF1481:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1548:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF740:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1252:
+	.string	"MSP_SERVO 103"
+.LASF1147:
+	.string	"BOARD_IDENTIFIER_LENGTH 4"
+.LASF1269:
+	.string	"MSP_SERVO_CONFIGURATIONS 120"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1195:
+	.string	"MSP_LED_STRIP_CONFIG 48"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF918:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1750:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1679:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1075:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF865:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1896:
+	.string	"RESOURCE_SPI_CS"
+.LASF1171:
+	.string	"MSP_SET_CALIBRATION_DATA 15"
+.LASF1317:
+	.string	"MSP2_COMMON_SET_SETTING 0x1004"
+.LASF1904:
+	.string	"mspDisplayPortVTable"
+.LASF957:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1762:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1690:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF952:
+	.string	"USE_PITOT_ADC"
+.LASF1416:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF779:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF845:
+	.string	"USE_DJI_HD_OSD "
+.LASF1721:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1484:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1156:
+	.string	"CAP_FLAPS ((uint32_t)1 << 3)"
+.LASF1218:
+	.string	"MSP_DATAFLASH_ERASE 72"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1710:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF827:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1326:
+	.string	"MSP2_COMMON_SETTINGS 0x100D"
+.LASF1515:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1360:
+	.string	"MSP2_INAV_SET_SERVO_MIXER 0x2021"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1026:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1430:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1314:
+	.string	"MSP2_COMMON_TZ 0x1001"
+.LASF1743:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF831:
+	.string	"USE_OPFLOW_MSP "
+.LASF786:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1895:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1865:
+	.string	"OWNER_MPU"
+.LASF1022:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1756:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1015:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1735:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1095:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1400:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1570:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1875:
+	.string	"OWNER_TEMPERATURE"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1575:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1152:
+	.string	"CAP_NAVI_VERSION_BIT_3 ((uint32_t)1 << 30)"
+.LASF1146:
+	.string	"FLIGHT_CONTROLLER_VERSION_MASK 0xFFF"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1866:
+	.string	"OWNER_INVERTER"
+.LASF1796:
+	.string	"size_t"
+.LASF811:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1331:
+	.string	"MSP2_INAV_STATUS 0x2000"
+.LASF759:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF1733:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1793:
+	.string	"uint8_t"
+.LASF1480:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1478:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1668:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1196:
+	.string	"MSP_SET_LED_STRIP_CONFIG 49"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF821:
+	.string	"USE_RX_UIB "
+.LASF1145:
+	.string	"FLIGHT_CONTROLLER_VERSION_LENGTH 3"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1722:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1000:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1830:
+	.string	"displayPort_s"
+.LASF1843:
+	.string	"displayPort_t"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF1081:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1298:
+	.string	"MSP_RESERVE_2 252"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1604:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1119:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF1738:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF958:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF912:
+	.string	"_GCC_WCHAR_T "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1885:
+	.string	"RESOURCE_IO"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF978:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1672:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1267:
+	.string	"MSP_WP 118"
+.LASF1585:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF698:
+	.string	"__need_size_t "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF826:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF887:
+	.string	"_ANSI_STDDEF_H "
+.LASF1477:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1610:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF1813:
+	.string	"drawScreen"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF915:
+	.string	"_BSD_WCHAR_T_"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1907:
+	.string	"mspSerialPush"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF943:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF959:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1833:
+	.string	"rows"
+.LASF718:
+	.string	"__need_size_t"
+.LASF1847:
+	.string	"OWNER_PPMINPUT"
+.LASF1354:
+	.string	"MSP2_BLACKBOX_CONFIG 0x201A"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF898:
+	.string	"__need_ptrdiff_t"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1250:
+	.string	"MSP_STATUS 101"
+.LASF852:
+	.string	"USE_LOG "
+.LASF1003:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1746:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1501:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF885:
+	.string	"_STDDEF_H "
+.LASF1689:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF922:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1014:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1353:
+	.string	"MSP2_INAV_DEBUG 0x2019"
+.LASF1757:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1686:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1600:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1704:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF736:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF1646:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1062:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF1369:
+	.string	"MSP2_SET_PID 0x2031"
+.LASF1197:
+	.string	"MSP_RSSI_CONFIG 50"
+.LASF1274:
+	.string	"MSP_SENSOR_ALIGNMENT 126"
+.LASF1371:
+	.string	"MSP2_INAV_DATAFLASH_STREAM 0x2033"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1048:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1038:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1445:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF816:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1468:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1169:
+	.string	"MSP_SET_NAV_POSHOLD 13"
+.LASF1093:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF769:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF1514:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1264:
+	.string	"MSP_MOTOR_PINS 115"
+.LASF1815:
+	.string	"writeString"
+.LASF728:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1013:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF815:
+	.string	"USE_PITOT_ADC "
+.LASF1492:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1682:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1246:
+	.string	"MSP_DISPLAYPORT 182"
+.LASF1768:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1628:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1663:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1913:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1341:
+	.string	"MSP2_INAV_OUTPUT_MAPPING 0x200A"
+.LASF1106:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF1299:
+	.string	"MSP_DEBUGMSG 253"
+.LASF1255:
+	.string	"MSP_RAW_GPS 106"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1281:
+	.string	"MSP_ACC_CALIBRATION 205"
+.LASF1903:
+	.string	"mspDisplayPort"
+.LASF1110:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF1708:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1337:
+	.string	"MSP2_INAV_SET_BATTERY_CONFIG 0x2006"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1344:
+	.string	"MSP2_INAV_MIXER 0x2010"
+.LASF1448:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1192:
+	.string	"MSP_SET_RX_CONFIG 45"
+.LASF1539:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1366:
+	.string	"MSP2_INAV_GVAR_STATUS 0x2027"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1248:
+	.string	"MSP_TX_INFO 187"
+.LASF1723:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1178:
+	.string	"MSP_SET_RTH_AND_LAND_CONFIG 22"
+.LASF1574:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1580:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF837:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1874:
+	.string	"OWNER_COMPASS"
+.LASF1266:
+	.string	"MSP_PIDNAMES 117"
+.LASF1162:
+	.string	"MSP_BOARD_INFO 4"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1403:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF765:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF1417:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1650:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1439:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1726:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1711:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1185:
+	.string	"MSP_BOARD_ALIGNMENT 38"
+.LASF1348:
+	.string	"MSP2_INAV_OSD_ALARMS 0x2014"
+.LASF1702:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1588:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1648:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1552:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1555:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1107:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF961:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF849:
+	.string	"USE_ANTIGRAVITY "
+.LASF1888:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1451:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1391:
+	.string	"IOCFG_IPU 0"
+.LASF1908:
+	.string	"displayPort"
+.LASF1915:
+	.string	"mspSerialTxBytesFree"
+.LASF1047:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1137:
+	.string	"API_VERSION_LENGTH 2"
+.LASF719:
+	.string	"NULL"
+.LASF1117:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF783:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF1573:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1320:
+	.string	"MSP2_COMMON_SETTING_INFO 0x1007"
+.LASF1887:
+	.string	"RESOURCE_UART_TX"
+.LASF782:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF1856:
+	.string	"OWNER_SYSTEM"
+.LASF872:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1352:
+	.string	"MSP2_INAV_SELECT_BATTERY_PROFILE 0x2018"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1036:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF938:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF466:
+	.string	"__PMT"
+.LASF1413:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF913:
+	.string	"_WCHAR_T_DECLARED "
+.LASF830:
+	.string	"USE_OPFLOW_CXOF "
+.LASF1901:
+	.string	"RESOURCE_RX_CE"
+.LASF1858:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1151:
+	.string	"CAP_NAVI_VERSION_BIT_4_MSB ((uint32_t)1 << 31)"
+.LASF817:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1826:
+	.string	"beginTransaction"
+.LASF1102:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1629:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1747:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1122:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF1529:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1844:
+	.string	"OWNER_FREE"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1632:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1224:
+	.string	"MSP_BLACKBOX_CONFIG 80"
+.LASF1551:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1898:
+	.string	"RESOURCE_ADC_CH2"
+.LASF1565:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1339:
+	.string	"MSP2_INAV_SET_RATE_PROFILE 0x2008"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1245:
+	.string	"MSP_SET_OSD_VIDEO_CONFIG 181"
+.LASF1476:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF878:
+	.string	"USE_VTX_TRAMP "
+.LASF547:
+	.string	"__stub_chflags "
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF762:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1706:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF994:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1228:
+	.string	"MSP_OSD_CONFIG 84"
+.LASF1549:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF813:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1020:
+	.string	"UNIT_TESTED "
+.LASF1055:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1346:
+	.string	"MSP2_INAV_OSD_LAYOUTS 0x2012"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1061:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF1149:
+	.string	"CAP_PLATFORM_32BIT ((uint32_t)1 << 31)"
+.LASF905:
+	.string	"_WCHAR_T_ "
+.LASF1319:
+	.string	"MSP2_COMMON_SET_MOTOR_MIXER 0x1006"
+.LASF788:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF1049:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF973:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1083:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1377:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1035:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF744:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1028:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1239:
+	.string	"MSP_SET_PID_ADVANCED 95"
+.LASF1431:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF781:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1409:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1720:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1177:
+	.string	"MSP_RTH_AND_LAND_CONFIG 21"
+.LASF1839:
+	.string	"cursorRow"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1914:
+	.string	"cliMode"
+.LASF798:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1541:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1493:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1651:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1155:
+	.string	"CAP_DYNBALANCE ((uint32_t)1 << 2)"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF743:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF1131:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1051:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1188:
+	.string	"MSP_SET_CURRENT_METER_CONFIG 41"
+.LASF1693:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1827:
+	.string	"commitTransaction"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF721:
+	.string	"__need_NULL"
+.LASF917:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF748:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF1125:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1441:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF1692:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1090:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1422:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1276:
+	.string	"MSP_SET_RAW_RC 200"
+.LASF1399:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF757:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF1068:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1483:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1225:
+	.string	"MSP_SET_BLACKBOX_CONFIG 81"
+.LASF1507:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1775:
+	.string	"MSP_PORT_OUTBUF_SIZE 512"
+.LASF1086:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF989:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1180:
+	.string	"MSP_SET_FW_CONFIG 24"
+.LASF1126:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1859:
+	.string	"OWNER_SDCARD"
+.LASF1512:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF697:
+	.string	"_STRING_H 1"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1751:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1140:
+	.string	"BETAFLIGHT_IDENTIFIER \"BTFL\""
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1834:
+	.string	"cols"
+.LASF1144:
+	.string	"FLIGHT_CONTROLLER_IDENTIFIER_LENGTH 4"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF916:
+	.string	"__need_wchar_t"
+.LASF1781:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1559:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1784:
+	.string	"signed char"
+.LASF1527:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF859:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1308:
+	.string	"MSP_SET_ACC_TRIM 239"
+.LASF1766:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF700:
+	.string	"__size_t__ "
+.LASF1268:
+	.string	"MSP_BOXIDS 119"
+.LASF1222:
+	.string	"MSP_SET_FAILSAFE_CONFIG 76"
+.LASF1462:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1748:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF909:
+	.string	"_WCHAR_T_H "
+.LASF1572:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1800:
+	.string	"DISPLAY_TRANSACTION_OPT_PROFILED"
+.LASF1749:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1622:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF825:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1322:
+	.string	"MSP2_COMMON_SERIAL_CONFIG 0x1009"
+.LASF1883:
+	.string	"RESOURCE_INPUT"
+.LASF1657:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1576:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1219:
+	.string	"MSP_LOOP_TIME 73"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1223:
+	.string	"MSP_SDCARD_SUMMARY 79"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF1862:
+	.string	"OWNER_BEEPER"
+.LASF1675:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1091:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF944:
+	.string	"USE_DASHBOARD"
+.LASF879:
+	.string	"USE_VTX_FFPV "
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1802:
+	.string	"displayTransactionOption_e"
+.LASF1571:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1362:
+	.string	"MSP2_INAV_SET_LOGIC_CONDITIONS 0x2023"
+.LASF1425:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1392:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF761:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1099:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF1215:
+	.string	"MSP_BF_BUILD_INFO 69"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1911:
+	.string	"subcmd"
+.LASF1230:
+	.string	"MSP_OSD_CHAR_READ 86"
+.LASF1910:
+	.string	"string"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF972:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1488:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1345:
+	.string	"MSP2_INAV_SET_MIXER 0x2011"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1825:
+	.string	"isReady"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1029:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1852:
+	.string	"OWNER_SERIAL"
+.LASF984:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF795:
+	.string	"USE_I2C_PULLUP "
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1879:
+	.string	"OWNER_PINIO"
+.LASF835:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1499:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1060:
+	.string	"PG_PID_PROFILE 14"
+.LASF1715:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1226:
+	.string	"MSP_TRANSPONDER_CONFIG 82"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF1382:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF919:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1447:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF1234:
+	.string	"MSP_ADVANCED_CONFIG 90"
+.LASF1375:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1154:
+	.string	"CAP_NAVI_VERSION_BIT_1_LSB ((uint32_t)1 << 28)"
+.LASF1104:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF1454:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1181:
+	.string	"MSP_MODE_RANGES 34"
+.LASF1872:
+	.string	"OWNER_VTX"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF800:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1491:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1397:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1485:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF1608:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1282:
+	.string	"MSP_MAG_CALIBRATION 206"
+.LASF1010:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF749:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF1561:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1072:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF754:
+	.string	"isascii(c) __isascii (c)"
+.LASF1212:
+	.string	"MSP_BF_CONFIG 66"
+.LASF1864:
+	.string	"OWNER_BARO"
+.LASF1203:
+	.string	"MSP_VOLTAGE_METER_CONFIG 56"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF787:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1618:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1389:
+	.string	"IOCFG_AF_OD 0"
+.LASF1367:
+	.string	"MSP2_INAV_TASK_TIMING 0x2028"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1440:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1043:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF955:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1423:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1591:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1358:
+	.string	"MSP2_INAV_TEMPERATURES 0x201E"
+.LASF1621:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1032:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1886:
+	.string	"RESOURCE_TIMER"
+.LASF1130:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF1073:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1465:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF1404:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF856:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1697:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1380:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1790:
+	.string	"long int"
+.LASF1526:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1065:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1350:
+	.string	"MSP2_INAV_OSD_PREFERENCES 0x2016"
+.LASF1627:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1363:
+	.string	"MSP2_INAV_GLOBAL_FUNCTIONS 0x2024"
+.LASF1100:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF860:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1544:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1853:
+	.string	"OWNER_PINDEBUG"
+.LASF1471:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF1034:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF962:
+	.string	"USE_RCDEVICE"
+.LASF975:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1357:
+	.string	"MSP2_INAV_SET_TEMP_SENSOR_CONFIG 0x201D"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1773:
+	.string	"MAX_MSP_PORT_COUNT 3"
+.LASF892:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF1208:
+	.string	"MSP_ARMING_CONFIG 61"
+.LASF1002:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1635:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF891:
+	.string	"__PTRDIFF_T "
+.LASF1450:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1842:
+	.string	"maxChar"
+.LASF1497:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1603:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF824:
+	.string	"USE_RANGEFINDER "
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1698:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1902:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF1170:
+	.string	"MSP_CALIBRATION_DATA 14"
+.LASF999:
+	.string	"EXPAND_I(x) x"
+.LASF1318:
+	.string	"MSP2_COMMON_MOTOR_MIXER 0x1005"
+.LASF862:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1141:
+	.string	"CLEANFLIGHT_IDENTIFIER \"CLFL\""
+.LASF1846:
+	.string	"OWNER_PWMINPUT"
+.LASF1504:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1795:
+	.string	"uint32_t"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1712:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1578:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1243:
+	.string	"MSP_SET_SPECIAL_PARAMETERS 99"
+.LASF1340:
+	.string	"MSP2_INAV_AIR_SPEED 0x2009"
+.LASF1469:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1310:
+	.string	"MSP_SET_SERVO_MIX_RULE 242"
+.LASF1379:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1832:
+	.string	"device"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1611:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF1884:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1361:
+	.string	"MSP2_INAV_LOGIC_CONDITIONS 0x2022"
+.LASF1356:
+	.string	"MSP2_INAV_TEMP_SENSOR_CONFIG 0x201C"
+.LASF1671:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF914:
+	.string	"__DEFINED_wchar_t "
+.LASF926:
+	.string	"USE_UART1 "
+.LASF489:
+	.string	"__flexarr []"
+.LASF1262:
+	.string	"MSP_ACTIVEBOXES 113"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF995:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1200:
+	.string	"MSP_SET_ADJUSTMENT_RANGE 53"
+.LASF884:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1021:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1079:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF829:
+	.string	"USE_OPFLOW "
+.LASF1046:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF902:
+	.string	"_T_WCHAR_ "
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1256:
+	.string	"MSP_COMP_GPS 107"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF855:
+	.string	"CMS_MENU_OSD "
+.LASF1487:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF752:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF1562:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1854:
+	.string	"OWNER_TIMER"
+.LASF1429:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1124:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1717:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1473:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1670:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1700:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF814:
+	.string	"USE_PITOT "
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF1236:
+	.string	"MSP_FILTER_CONFIG 92"
+.LASF804:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF751:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF876:
+	.string	"USE_VTX_CONTROL "
+.LASF1791:
+	.string	"char"
+.LASF1543:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1164:
+	.string	"MSP_INAV_PID 6"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1741:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1817:
+	.string	"readChar"
+.LASF1502:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1388:
+	.string	"IOCFG_AF_PP 0"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1132:
+	.string	"MSP_V2_FRAME_ID 255"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF764:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF927:
+	.string	"USE_UART2 "
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1089:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF1159:
+	.string	"MSP_API_VERSION 1"
+.LASF1025:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1115:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1139:
+	.string	"BASEFLIGHT_IDENTIFIER \"BAFL\";"
+.LASF1560:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF866:
+	.string	"USE_RX_MSP "
+.LASF1606:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF991:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF395:
+	.string	"true 1"
+.LASF1294:
+	.string	"MSP_SET_SENSOR_ALIGNMENT 220"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1098:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF828:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1581:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1763:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF834:
+	.string	"USE_1WIRE_DS2482 "
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1511:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF717:
+	.string	"__size_t "
+.LASF699:
+	.string	"__need_NULL "
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1174:
+	.string	"MSP_WP_MISSION_LOAD 18"
+.LASF1878:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1530:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1458:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1074:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1175:
+	.string	"MSP_WP_MISSION_SAVE 19"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF720:
+	.string	"NULL ((void *)0)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF997:
+	.string	"STR_HELPER(x) #x"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1774:
+	.string	"MSP_PORT_INBUF_SIZE 192"
+.LASF1078:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF799:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1508:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1359:
+	.string	"MSP2_INAV_SERVO_MIXER 0x2020"
+.LASF1018:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1669:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1242:
+	.string	"MSP_SPECIAL_PARAMETERS 98"
+.LASF921:
+	.string	"USE_FAKE_BARO "
+.LASF1464:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1372:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1486:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1524:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1607:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1890:
+	.string	"RESOURCE_EXTI"
+.LASF1378:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1461:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF890:
+	.string	"_T_PTRDIFF "
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF807:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1683:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF371:
+	.string	"__linux 1"
+.LASF738:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF1592:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1713:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1244:
+	.string	"MSP_OSD_VIDEO_CONFIG 180"
+.LASF1814:
+	.string	"screenSize"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1595:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF861:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF818:
+	.string	"USE_GYRO_KALMAN "
+.LASF1528:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1143:
+	.string	"RACEFLIGHT_IDENTIFIER \"RCFL\""
+.LASF1305:
+	.string	"MSP_GPSSVINFO 164"
+.LASF739:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF1569:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1744:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF768:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF1428:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1752:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1279:
+	.string	"MSP_SET_BOX 203"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1542:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1563:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF731:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1644:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1118:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF1472:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1271:
+	.string	"MSP_NAV_CONFIG 122"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1584:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1328:
+	.string	"MSP2_IS_SENSOR_MESSAGE(x) ((x) >= 0x1F00 && (x) <= 0x1FFF)"
+.LASF1040:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF1142:
+	.string	"INAV_IDENTIFIER \"INAV\""
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1719:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF812:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1811:
+	.string	"release"
+.LASF1336:
+	.string	"MSP2_INAV_BATTERY_CONFIG 0x2005"
+.LASF1617:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF745:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF1289:
+	.string	"MSP_SET_MOTOR 214"
+.LASF1792:
+	.string	"int8_t"
+.LASF1660:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF948:
+	.string	"USE_RANGEFINDER"
+.LASF1516:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF790:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF1176:
+	.string	"MSP_WP_GETINFO 20"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF729:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1421:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1408:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1009:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1828:
+	.string	"getCanvas"
+.LASF1444:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF732:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1694:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1053:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF1257:
+	.string	"MSP_ATTITUDE 108"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1286:
+	.string	"MSP_SELECT_SETTING 210"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF906:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1191:
+	.string	"MSP_RX_CONFIG 44"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF794:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1869:
+	.string	"OWNER_RX"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1457:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF977:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1810:
+	.string	"grab"
+.LASF1332:
+	.string	"MSP2_INAV_OPTICAL_FLOW 0x2001"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1564:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1801:
+	.string	"DISPLAY_TRANSACTION_OPT_RESET_DRAWING"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1503:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1638:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1673:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1066:
+	.string	"PG_IMU_CONFIG 22"
+.LASF1330:
+	.string	"MSP2_SENSOR_OPTIC_FLOW 0x1F02"
+.LASF1443:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF956:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1718:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1463:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1716:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF857:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1860:
+	.string	"OWNER_FLASH"
+.LASF1414:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF1753:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1071:
+	.string	"PG_GPS_CONFIG 30"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF1909:
+	.string	"attr"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1213:
+	.string	"MSP_SET_BF_CONFIG 67"
+.LASF1652:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1355:
+	.string	"MSP2_SET_BLACKBOX_CONFIG 0x201B"
+.LASF1150:
+	.string	"CAP_BASEFLIGHT_CONFIG ((uint32_t)1 << 30)"
+.LASF1824:
+	.string	"writeFontCharacter"
+.LASF990:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF840:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF1270:
+	.string	"MSP_NAV_STATUS 121"
+.LASF733:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF903:
+	.string	"_T_WCHAR "
+.LASF777:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1316:
+	.string	"MSP2_COMMON_SETTING 0x1003"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1506:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1531:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF886:
+	.string	"_STDDEF_H_ "
+.LASF1402:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1420:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1769:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1438:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1523:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1639:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1292:
+	.string	"MSP_SET_RC_DEADBAND 218"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1754:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1647:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1870:
+	.string	"OWNER_TX"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1070:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF756:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF1347:
+	.string	"MSP2_INAV_OSD_SET_LAYOUT_ITEM 0x2013"
+.LASF853:
+	.string	"USE_STATS "
+.LASF924:
+	.string	"USE_MAG "
+.LASF1877:
+	.string	"OWNER_AIRSPEED"
+.LASF1556:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1587:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1166:
+	.string	"MSP_NAME 10"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1658:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF776:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1111:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1916:
+	.string	"displayInit"
+.LASF1351:
+	.string	"MSP2_INAV_OSD_SET_PREFERENCES 0x2017"
+.LASF1442:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1620:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1509:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF893:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF904:
+	.string	"__WCHAR_T "
+.LASF1295:
+	.string	"MSP_SET_LED_STRIP_MODECOLOR 221"
+.LASF1092:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1630:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1080:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF1510:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF742:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF1568:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1187:
+	.string	"MSP_CURRENT_METER_CONFIG 40"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF894:
+	.string	"___int_ptrdiff_t_h "
+.LASF1455:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1233:
+	.string	"MSP_SET_VTX_CONFIG 89"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1012:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1006:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF968:
+	.string	"U_ID_1 1"
+.LASF1760:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF967:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1654:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1631:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1393:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1640:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1459:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1260:
+	.string	"MSP_RC_TUNING 111"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF793:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1101:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1655:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1011:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1063:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF823:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF741:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF1082:
+	.string	"PG_VTX_CONFIG 54"
+.LASF1736:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF848:
+	.string	"USE_D_BOOST "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF1823:
+	.string	"getFontMetadata"
+.LASF755:
+	.string	"toascii(c) __toascii (c)"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1249:
+	.string	"MSP_IDENT 100"
+.LASF970:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1054:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1695:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF945:
+	.string	"USE_OLED_UG2864"
+.LASF1557:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF1023:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF883:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF983:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1335:
+	.string	"MSP2_INAV_SET_MISC 0x2004"
+.LASF1897:
+	.string	"RESOURCE_ADC_CH1"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1899:
+	.string	"RESOURCE_ADC_CH3"
+.LASF1900:
+	.string	"RESOURCE_ADC_CH4"
+.LASF867:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1582:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1601:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1273:
+	.string	"MSP_RC_DEADBAND 125"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF1254:
+	.string	"MSP_RC 105"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF1829:
+	.string	"displayPortVTable_s"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF1167:
+	.string	"MSP_SET_NAME 11"
+.LASF724:
+	.string	"_STRINGS_H 1"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1470:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF873:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF833:
+	.string	"USE_1WIRE "
+.LASF1696:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1241:
+	.string	"MSP_SET_SENSOR_CONFIG 97"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1590:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1453:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1291:
+	.string	"MSP_SET_3D 217"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1537:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1758:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1120:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF1179:
+	.string	"MSP_FW_CONFIG 23"
+.LASF996:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1217:
+	.string	"MSP_DATAFLASH_READ 71"
+.LASF1623:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1019:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF939:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF933:
+	.string	"USE_UART8 "
+.LASF1313:
+	.string	"MSP_SET_RTC 247"
+.LASF1776:
+	.string	"MSP_STREAM_MAX_FRAMES_PER_CALL 4"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1127:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF394:
+	.string	"bool _Bool"
+.LASF985:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1296:
+	.string	"MSP_EEPROM_WRITE 250"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1437:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF758:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF1547:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1016:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1460:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1202:
+	.string	"MSP_SET_CF_SERIAL_CONFIG 55"
+.LASF805:
+	.string	"USE_BLACKBOX "
+.LASF1343:
+	.string	"MSP2_INAV_SET_MC_BRAKING 0x200C"
+.LASF1619:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1411:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1293:
+	.string	"MSP_SET_RESET_CURR_PID 219"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF809:
+	.string	"USE_TELEMETRY "
+.LASF1495:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1513:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1554:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1386:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1123:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF940:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF963:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1334:
+	.string	"MSP2_INAV_MISC 0x2003"
+.LASF1321:
+	.string	"MSP2_COMMON_PG_LIST 0x1008"
+.LASF750:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF1307:
+	.string	"MSP_ACC_TRIM 240"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1662:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF1835:
+	.string	"posX"
+.LASF1836:
+	.string	"posY"
+.LASF766:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF1812:
+	.string	"clearScreen"
+.LASF1205:
+	.string	"MSP_SONAR_ALTITUDE 58"
+.LASF846:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1894:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF1857:
+	.string	"OWNER_SPI"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1739:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1084:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF1625:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1685:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF785:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1534:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1841:
+	.string	"cachedSupportedTextAttributes"
+.LASF844:
+	.string	"USE_FRSKYOSD "
+.LASF1536:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1490:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1085:
+	.string	"PG_CF_END 56"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF974:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1364:
+	.string	"MSP2_INAV_SET_GLOBAL_FUNCTIONS 0x2025"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF1821:
+	.string	"txBytesFree"
+.LASF1165:
+	.string	"MSP_SET_INAV_PID 7"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1636:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1521:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF934:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF868:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1238:
+	.string	"MSP_PID_ADVANCED 94"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1186:
+	.string	"MSP_SET_BOARD_ALIGNMENT 39"
+.LASF1783:
+	.string	"long unsigned int"
+.LASF1394:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1867:
+	.string	"OWNER_LED_STRIP"
+.LASF1653:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF791:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF988:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1258:
+	.string	"MSP_ALTITUDE 109"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1116:
+	.string	"PG_ID_INVALID 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF725:
+	.string	"_CTYPE_H 1"
+.LASF1732:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1593:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1770:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1645:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1190:
+	.string	"MSP_SET_MIXER 43"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF722:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1761:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF1163:
+	.string	"MSP_BUILD_INFO 5"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1059:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1077:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1207:
+	.string	"MSP_SET_PID_CONTROLLER 60"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1566:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1365:
+	.string	"MSP2_INAV_LOGIC_CONDITIONS_STATUS 0x2026"
+.LASF928:
+	.string	"USE_UART3 "
+.LASF1210:
+	.string	"MSP_RX_MAP 64"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1641:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF987:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1785:
+	.string	"__int8_t"
+.LASF1109:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1412:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1614:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF993:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF1037:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF875:
+	.string	"USE_RCDEVICE "
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1193:
+	.string	"MSP_LED_COLORS 46"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF950:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1209:
+	.string	"MSP_SET_ARMING_CONFIG 62"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1160:
+	.string	"MSP_FC_VARIANT 2"
+.LASF1782:
+	.string	"unsigned int"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF929:
+	.string	"USE_UART4 "
+.LASF1058:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1097:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1172:
+	.string	"MSP_POSITION_ESTIMATION_CONFIG 16"
+.LASF1765:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1261:
+	.string	"MSP_PID 112"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1665:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF935:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1703:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1489:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1323:
+	.string	"MSP2_COMMON_SET_SERIAL_CONFIG 0x100A"
+.LASF863:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1045:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1851:
+	.string	"OWNER_ADC"
+.LASF1787:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF822:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1173:
+	.string	"MSP_SET_POSITION_ESTIMATION_CONFIG 17"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1725:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1532:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1742:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF23:
+	.string	"_LP64 1"
+.LASF930:
+	.string	"USE_UART5 "
+.LASF1688:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1368:
+	.string	"MSP2_PID 0x2030"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1889:
+	.string	"RESOURCE_UART_TXRX"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF946:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1024:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1446:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF976:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1729:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF897:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1042:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1609:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1290:
+	.string	"MSP_SET_NAV_CONFIG 215"
+.LASF1596:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1390:
+	.string	"IOCFG_IPD 0"
+.LASF1121:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF931:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF802:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1535:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1975:
+	.string	"streambuf.h"
+.LASF1952:
+	.string	"long-double.h"
+.LASF1959:
+	.string	"__locale_t.h"
+.LASF1964:
+	.string	"platform.h"
+.LASF1921:
+	.string	"src/main/drivers"
+.LASF1946:
+	.string	"libc-header-start.h"
+.LASF1931:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1962:
+	.string	"endian.h"
+.LASF1919:
+	.string	"src/main/common"
+.LASF1935:
+	.string	"stdint-intn.h"
+.LASF1966:
+	.string	"target.h"
+.LASF1930:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1933:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1938:
+	.string	"display.h"
+.LASF1925:
+	.string	"src/main/target/SITL"
+.LASF1942:
+	.string	"msp_serial.h"
+.LASF1923:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1986:
+	.string	"io_def_generated.h"
+.LASF1924:
+	.string	"src/main/msp"
+.LASF0:
+	.string	"./src/main/io/displayport_msp.c"
+.LASF1960:
+	.string	"strings.h"
+.LASF1948:
+	.string	"features-time64.h"
+.LASF1934:
+	.string	"types.h"
+.LASF1929:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1984:
+	.string	"io_types.h"
+.LASF1978:
+	.string	"msp_protocol_v2_common.h"
+.LASF1950:
+	.string	"timesize.h"
+.LASF1944:
+	.string	"stdbool.h"
+.LASF1932:
+	.string	"/usr/include"
+.LASF1918:
+	.string	"src/main/build"
+.LASF1967:
+	.string	"sanity_check.h"
+.LASF1947:
+	.string	"features.h"
+.LASF1965:
+	.string	"common.h"
+.LASF1955:
+	.string	"typesizes.h"
+.LASF1958:
+	.string	"locale_t.h"
+.LASF1982:
+	.string	"serial.h"
+.LASF1920:
+	.string	"src/main/config"
+.LASF1956:
+	.string	"time64.h"
+.LASF1936:
+	.string	"stdint-uintn.h"
+.LASF1926:
+	.string	"src/main/target"
+.LASF1969:
+	.string	"utils.h"
+.LASF1940:
+	.string	"displayport_msp.c"
+.LASF1927:
+	.string	"src/main"
+.LASF1976:
+	.string	"displayport_msp.h"
+.LASF1980:
+	.string	"msp_protocol_v2_inav.h"
+.LASF1939:
+	.string	"resource.h"
+.LASF1981:
+	.string	"time.h"
+.LASF1972:
+	.string	"parameter_group_ids.h"
+.LASF1957:
+	.string	"wchar.h"
+.LASF1985:
+	.string	"io_def.h"
+.LASF1922:
+	.string	"src/main/fc"
+.LASF1983:
+	.string	"io.h"
+.LASF1979:
+	.string	"msp_protocol_v2_sensor.h"
+.LASF1953:
+	.string	"stubs.h"
+.LASF1928:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1974:
+	.string	"msp.h"
+.LASF1941:
+	.string	"string.h"
+.LASF1977:
+	.string	"msp_protocol.h"
+.LASF1951:
+	.string	"cdefs.h"
+.LASF1945:
+	.string	"stdint.h"
+.LASF1971:
+	.string	"build_config.h"
+.LASF1937:
+	.string	"stddef.h"
+.LASF1954:
+	.string	"stubs-64.h"
+.LASF1973:
+	.string	"fc_msp.h"
+.LASF1961:
+	.string	"ctype.h"
+.LASF1949:
+	.string	"wordsize.h"
+.LASF1968:
+	.string	"common_post.h"
+.LASF1970:
+	.string	"parameter_group.h"
+.LASF1963:
+	.string	"endianness.h"
+.LASF1943:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375 \332\335\004"
+	.string	"\264\007\316"
+	.string	"\016"
+	.string	"\355\320\326\201\t\004\002"
+	.string	"\002\001\001\300\265\356\337\r"
+	.string	"\002\332\203\361\244\007\002\002"
+	.string	"\002\002\003\336\222\247\362\007"
+	.string	"\004\301\276\341\353\001\006\002\003\002\003\002"
+	.string	"\002"
+	.string	"\006\276\221\317\233\r"
+	.string	"\007\254\276\254\200\003\b\275\204\200\365\016\t\304\340\230\337\004\n\317\354\237\363\t\f\002"
+	.string	"\002\004\004\013\277\352\350\373\003\006\002\005\002\006\002\006\f\221\330\213\225\007\r\240\342\234\212\n\016\342\204\237\314\005"
+	.string	"\f"
+	.ascii	"{\b\232\271|7\0363\b\273\316\203\243\330<\212\236\367_\2111g"
+	.ascii	"\374]H\033\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375 \332\235\003"
+	.string	"\222\205\017\026\260%\351\f\303\220\013`\030\206a\016\300\320\266\315\222\326\332\3362\245\356XSZ\267\222\2610\007\210\326\361K\307\233Y("
+	.string	"\223\020\205\226\361\003\315\371\ra\361gXy\301\027G\266-\007\001\026"
+	.string	"5\203 \025\205\013\330\003\020&"
+	.string	"\257\b\201\233\230}\270\025h\276ya\210C\001\020pM2`\\\235\204\301`,\304\305\234f\251"
+	.ascii	"*an\240\r"
+	.text
+	.section	.gnu.lto_.inline.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`\243\001\315\007"
+	.string	"\202\312 (\2205I\007\227\357\202\376\331N\224?\307\201\210-\375\315\017i\177\353\006^\375\377cc\374\037\377\223\326\032i\255\021\"w\n\343\337\266{\023\030\250\253\210Nq\375MQ\255Q\321\326\007\335\023\254\335\223ZX4`\222\b\030\016N\303\230\335kjy\374\201\362G\205\fL"
+	.ascii	"\r\327#\251\210\372\025;R\356#\244\306Ot\306\356z]D33\0135\031"
+	.ascii	"\231\331xft\214\251f\305;F\235d\346\362\355>\0022 `\"2\246<\004"
+	.ascii	"\b\260-\\\016`\334\334\221#\214\r\262X\3619\342L\t\250\206i\351"
+	.ascii	"\004\320\330B\240\035[\253q\002\364\355\322p\030\226\300\214"
+	.ascii	"\253\304\2210E\027\320A\336\026v\337\0201\026\253Z\375\344\020"
+	.ascii	"\371\006\216\265\203[\206\3005\316\204\002\177\367\260\030\224"
+	.ascii	"\242\270\323\307\026Kt\245\032)\272\036\354\256K\334\256!\355"
+	.ascii	"*I\310\211\206\307F+\356\020"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`\270\001\335\007"
+	.string	"b\214#'\200)I\007<\030\b\226\234\301U\324`\001&1r\240\035\334TnI\202&x*1\314\377\250\021bm\333\226l\231d\024h\0314\240eH\345\300f"
+	.string	"\364O\237\323k\364N*P\023\006&\204U\235I\024\250_O\023\250\275\236$Pk\004\373\024\201\272\241\021(,\313\262\360}J\245E=\324k9\344\305i0\206\274\303\r'\234g\332\336\267\202{;\354\035\326y5\021\222|l\"\363\307|\260Z\r\253\275\372^\362\277\254\247\3022\004, `\002\231\262\252\033\3514\216+\330$\254\345"
+	.string	"H\004H\210\031z\013\016\002\007\r\024\013\231\222q?\\HD\244\"@QG\001\b\027\340Mgf\0308\364\005\260\004r\027\220\3713/\031\261<R\230Nr\033\025j"
+	.ascii	"\341\037B\0244w\212{\316[Y.\227\003\326\374\260D\3143\004\367"
+	.ascii	"-\300\213\213\210\272\3346\034\242\340n"
+	.text
+	.section	.gnu.lto_.pureconst.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375 )I\001"
+	.string	"%"
+	.string	""
+	.string	""
+	.string	"\f"
+	.ascii	"\205\004\001\200\004\002\232\004\003\230\004\004\230\004\006"
+	.ascii	"\230\004\007\230\004\b\230\004\t\230\004\n\230\004\013\230\004"
+	.ascii	"\f\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375 \326\335\003"
+	.string	"\322D\022\037\260%\351\f\303\212 0\322\220\265\2708\247\262\007$9O@\2705AZk\204\020B\332\226)+\001\267\234\033k"
+	.string	"\307\322\353\034h x\307(TJ\207\242\032\342\314\004;\"\024\261M\325w\357\367\304\376\306\320\327\310_\b\024"
+	.string	"c\b\2000\202Gl\020B+\231\0072^\350\002YQP"
+	.string	"\274:\037\0019\227\300\236\332)\325\020\224\342\001Lq\026Tl\374i\333"
+	.ascii	"\212"
+	.text
+	.section	.gnu.lto_.lto.ce0c9735be8c4cc3,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_heartbeat.25.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`\331\002-\026"
+	.string	"&)\221I\320\322\2521`\301\"\030\227Qu\241BM\230\343\277\371\247\375?#\022\320\323\202\200\002\324\2706o\\\033wj'\204t\277\341\251\312\3003P\262G\2423l\f,\230\372\252\020\234\t)\017\0250,\322\022\001\326\356\275\245L)y"
+	.string	"\177"
+	.string	"z"
+	.ascii	"7\345\rbP\002\351x\257\216\344\246)\230PC\253W\373(^d{\212s\324"
+	.ascii	"\275\274\026\305{\323\004FM7\235\232l\373&~\302f\033\225\351"
+	.ascii	"\207]\n\222\347\207\274\367\242\252\247\316\233\345\005\2347"
+	.ascii	"\255\207\333^\332j\363\357\373HRn\227\363\322\002{\344v@\267"
+	.ascii	"\245\001\336\006 \";\\\251:\262\301s\343\253\317N\247\326\022"
+	.ascii	"\313\275\3275\267\313p\233\267\335b[\306\266\004\002#\304{1$"
+	.ascii	"\203\\\033\346\013\021\357\375\366\375\337\215\366\311\265\247"
+	.ascii	"\360U|\305[\274\2702\343\336{\262\2257\350\340\346 \326\356\302"
+	.ascii	"F\327\231\200'n\314\220\305\354hu\326\017Y\314N\035\200\035\r"
+	.ascii	",a\220V\\\231\365B\237\240\324\036\244\rhP\243\202\351&\220\005"
+	.ascii	"\327\363`\004\362xoJr\023\365[\275\036X{\212c{Z\200h\034o\372"
+	.ascii	"\277\232}\272\315\367\371\204\n\261\262\355\023\024\333{\001"
+	.ascii	"\247U\021\332\2619N\035\035\211C2hM;M\313\362\361\320\251H\366"
+	.ascii	"c\\\006\315\007\341\327\254>7;o\2326dG\320a\030?\241\350\306"
+	.ascii	"-\336\344\303\004\216\222\237\370\223P\212\373`\007t\334{\237"
+	.ascii	"\373\360D\247\235\027Z{\340U\267\232\344T\362\246^@\360\336E"
+	.ascii	"v\350n5\351\324\217\033\267&\331)\256\332\016\366\313{\357\265"
+	.ascii	"\345\331fu\311\254>K\325\346\323\337\006P\260\023>\r\314\214"
+	.ascii	"\215\261a\331\227W\213e3;\255\322JY\200\022\303:1)P#\203I8\271"
+	.ascii	"e\022\233\275,\324\310`\261\232\313Ll\346zAa.\224\306\345\362"
+	.ascii	"B[\262\031j\2422,\006#Ck`0\031z\262\355\364\366\362Z\236K?5\354"
+	.ascii	"io<\204\037\024\225\344%\353c\273dU7\213\363My\357\320\312\261"
+	.ascii	"W\223\366\211C\341\357{IB\350V\206\324\222G(B\022\335F\247ot"
+	.ascii	"\311\324\347\0027 \200\002\031\262\263\r.\b\002\346;\323w\363"
+	.ascii	"Zr\265\025\341\t\377\316K$0H\300l\230\001mY\0021F\030MU/\342"
+	.ascii	"\332\377\030\307\013\251rh\375\300l@\200\261]\337\0176L?\t\354"
+	.ascii	";$cB\340\306\362\206\215\354s\031\357K\260L\220\270\0023\013"
+	.ascii	"3<Y\356\235\245O'\031\335\004/\213\017\327\217\222&{\271.\026"
+	.ascii	"qH\262\241!k/Q\373\332\005\224\002\305Ch\332\f\005"
+	.text
+	.section	.gnu.lto_grab.26.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`M"
+	.string	"\305\b"
+	.string	"\246\320=90\345(\035"
+	.string	"n801\b\013\336`AF\223z\224\330s\013\023\256\303q\264~\\\007\324\220\307\246\343+\365\006d\210$"
+	.string	"\317tz\021\344!q\324O\242\366\357\275eJ\001+"
+	.string	","
+	.string	","
+	.string	"\233\252%\263\273\321s\001\315\341{\200\346\320\205\\\273j\376S\376H8b\266\025\352\272a\330]\353\266\332\270\335m\027\330v\260\335\n"
+	.string	"\366\005\262\214\330\326\354\313\356\250\026\256\366O\216\242}^\274\263\313RY\331\235\006\216\234CO\216m\277\344&\232\335\362\246\310j\223\n~\316\203\341R\206\252\316\2668\351\267\347@\036\031\016\345\353cu\306\236(u \366\337:\226\255\352\367\371+\324t\300\f\270\354j\004\b\006\211\024\022\020& \016>\004\246L6\\\026}\260\022\351\301\224I\354\024\242\300J\243\210(G\261b\024\"EQV\212\037\217%&\221E\223\224Y\274\346\336\001\013"
+	.ascii	"BMm\233^d\256\006P\324+\373\\\303\361\261x7\230xp\367I\265b\022"
+	.ascii	"&\031"
+	.text
+	.section	.gnu.lto_release.27.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`\347\002U\026"
+	.string	"V\351\221J\320\322\2521\240B\351}@*U\235\026\362\366\360\307&*Z6\222\234\3509B\256\220\336\215\333\202\262\267\323+\231\020\322\375\330,\024\2101\302\003b$v\343\020\250\177\350 4\255"
+	.string	"\252\237\020CC\340'\250\336{\357-eJ\001y"
+	.string	"~"
+	.string	"}"
+	.string	"7Dy\264Ahx\357\r\345\243!\230$3R\257\366M\374\304\354i\316K\356\315%\001\357M\017\3704?:5m\373E7\232\331Lb\352\001W\326\200zx=\356\275'\352&\344G\361\001\310\217\266\303g\027m\235\371\337\275\n\tm8\235\213\266\267\303\206\013\272\025\013\3440\370\030\301\325D\224PF\317\203\257>\270\235ZK\006\367^W\033\256\302=\336\266\213\355\031\333\236\004\027\250)\310\2251\256"
+	.ascii	"q\335o\337\347=h\237,;\n\377\350)\256t\340\225^\334{O3S\347f"
+	.ascii	"^\033K\262\2530\323of\317\350\312\374\222Pa\212\254\377%\241"
+	.ascii	"\344-\204\347\202\312\207\024\003\246\306z\237WXdG\212\tP\020"
+	.ascii	"#\202\371\261wyn!=5\240\341\275)\312\307\022^\352\365=\331\323"
+	.ascii	"\034K\241A\020\214\341G\237'\263O\237\371;\237Ht\244l{\205ev"
+	.ascii	"\035\216\031\266e\210\307\352\330D\370\037\031\232\220\254c\344"
+	.ascii	"hU\273\034;\365\207\375\026w\021\363?\270\205\326\333P\362\343"
+	.ascii	"hEpX8\213\340\037\234\240q\2017y\024\325H\371\227~\032B\361\235"
+	.ascii	"\353\344\306\275\367\266\377N\364\030y\237\265\357\035E\253@"
+	.ascii	"\\{#p\352\004\003\327}\004\307\215V\233\\{\"h\334\n\304Nk\325"
+	.ascii	"r\260/^\233\263\307\352r\254&\313\352\361\351o\001\220$f\f8\272"
+	.ascii	"\001"
+	.string	"\177M\f\215\225\271QY\230\326Ju\203\222nY%@\300\"\243ZQ!`\003s98y\245\362B[\022l`\256\227\354\205\346\205\262`N\027\353\254a\275\264\316\025\f=UPv\275b`\247\215\313\005;O\266\235\322ns.\177bX\322>x\227\037\023\025\345\245\365\261]Z\024\315\326\214#\336\253a\301PW\233\354/\375|\377\356b\211!\232(RS\036\022T\352At3\221~\2205So#\0038 \220\002\031\252\263\rF\020D\316G\266\333.$[\332\350D(\335\367_\250\020\213\3370\013\332\362\004\202\2140ZU1\213k\300\306\210^\310\225C\253\007&\003\006\213\355\350~\330a\324\363K\272\303o\"r\240\210\301\033\317+\260\344\234\301~\r!\363\341v[f\026f8T\364\262\255\334&\231[\037(,\357^A\212:\204;\3262\211F\223\027q\331}\211\257\217\334H:8l\036\215"
+	.ascii	"\241"
+	.text
+	.section	.gnu.lto_clearScreen.28.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`\347\0025\026"
+	.string	"\226i\221I\320\322\2521\240B\351\376"
+	.string	"\225\252f\371\371'|>\3723\376\023\025oH\0076\346W0\317\236\324\350\355\364J&\204t?6\013\005b\214\360\200\030\211\3358\004\352\037:\bM+\200\352'\304\320\020\370\t\252\367\336{K\231Rz"
+	.string	"~"
+	.string	"{"
+	.string	"\345\375@\236\320P\224to\r\345\242!\224$F\247W\373$^\"v4\347%\367\336z\276{\321\0036\313\213FK\333\276\321G\304l`\210\026\331\310\331P\217\256\307\275\3274\335d\274\030>\300x\321rx\354\241\2551\377\271W\241\0264\233\316C\233\356\240\331\200n\303\002\267\013>Fl\263\320\2044\243\347\277W\037\333N\255$\203{\257+\315f\341\026o\333\305\366\214mO\002\301{+\004\203\334\031\"\013\017\307\375\366}\335\177v\311\260\233\360O\034\305U\334w`\320\275\267\024+uj\345\275\321\203}\205\201\257\225\351\210+\303Kq\"\235\306z^\212s\254\205\360\b\241vG/\337I\254\337y\205\005\366\243\227"
+	.string	"\0052\"\224\027\323\313S\013\351\231\r%\335\213\242\\,\321\235^\237\302\216\346X\n\r\200b$]\364u0\273\364\230\237s\211$=\331\366\nK\3548\234-D<V\307&H\377\201!xd\375\032E\213\312\351\330\251?\354\2778\214\227\337\301\253\263\236v\216\027E+\222#\350.~\177P\242\306\365\275\344ad#\345\357\275Dd\3429\326\t\216{\357i\347\035\304_\343w\326>\275IV\201\270\246@\234:\301\300q\037\311Q\223\325\240k\372\253q+\020\033\235U\273\301~x\357\275\2667[\254&\305\352\221\254\026\217\376\026\300\370\202\306\200\365514V\346\006eaV)\324\3159\272%\225"
+	.ascii	"\001\213\fjE\205\200\215\213\345\240\344\224J\353\\I\260q\261"
+	.ascii	"Z\260\027\232\326\251\2021Y*\263F\365\2622S\256\323T1\231\325"
+	.ascii	"\212q\2316,\226\313,\3316*\273\275\231\374\221aG\373\337]~HT"
+	.ascii	"\224\223\326\3076iM2;3Nxo\206\005I\270\032\264\337\343\355\376"
+	.ascii	"\334C\021D\262P\244\246<\344\007\f\001\342\006\216\376O5SO\033"
+	.ascii	"m7 \220\002\031\252\263\rF\020D\316G\266\333.$[\332\350D(\335"
+	.ascii	"\367_\250\020\213\3370\013\332\362\004\202\2140ZU1\213k\300\306"
+	.ascii	"\210^\310\225C\253\007&\003\006\213\355\350~\330a\324\363K\272"
+	.ascii	"\203\362\023\2037\230Wd\351\271\005\373'\204\214\207\332iYY\224"
+	.ascii	"aP\321\313\346r\373d\265>XX\036{\005\027u\034\356\370eR\032M"
+	.ascii	"/\342\322\373\022Yo\271\221~p\330<\032\001B\001"
+	.text
+	.section	.gnu.lto_drawScreen.29.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`\347\002M\026"
+	.string	"V\251\221J\300\322Uc\240\312\203\344C\216E\314"
+	.string	"\2120g\216\017T\365\031\020\361LQ\260\234\371{\203\337\325\003v\016\326v2\016\205\3206\nRFj\317\327\211\331\005X\024,!<\003\230\n\257\201N\n\307\246,\347\261\367\336[\312\224\002y"
+	.string	"~"
+	.string	"|"
+	.string	"W\204\271\324\201\210xo\016\345\244!\234$\024T\257\366\221\236T{\232\363\222{w(\204\367\246\007\214\236'\235\236\266}\243\037\325l\2471\005\2413oC=\276\036\367^4u\223\362\344\370"
+	.string	"\345I\373\341\265\217\266\326\374\367^3\364p:\235\217\366\227\003\247\003\272\035\013\3544\370\030\321\335\306\324S\214\236\017_}t;\265\232\f\356\275\2568\335\205\233\274m\027\3333\266=\t\327B1\310\215A\246 :\357\267\357\373>\264Q\246]\311_z\211\237\270\360-\202\356\275\250\332\251\223;o\215&\332Q\330\351\271\363wte\202&dO\252\262>hBV\346Bx0\254\200L3\241\212\254\007z\205\205v\246\231"
+	.string	"\005/\"\234'\177\227'\027\322s\033\"\336\233\242\234,\361\251^\377\243=\315\261\025\032"
+	.string	"\271 \236\364}4\033\365\232\3373\212$\247\262\355\025\226\332y8g\266E\210\307\352\330\344\351?6\024\231\254g%iW=\034;\365\207\375\025g1\363C\330%\253\307\311\312\223\244\025\271\021t\025\303?H\232q\205?u\030\321H\371\233\216\022Rz\357ub\343\336{\334\203/\372\254<\320\332\377\236\262U \256?\0358u\202\201\363>r#g\253E\327\037\214\031\267\002\261\323[\265\036\354\217\327\356l\262\332$\253K\263\232|\372["
+	.ascii	"\345\016\031\003x\334"
+	.string	"\343kbh\254\314\315\312\302\270X\253\033Y\351\026V\002\004,2\253\025\025\0026\261\227\003\224Y*0\231K\202M\354\005\243\275\320\300d-\030\364\325BkZ/.\224\025\223\241*)\277`11\324\346\365\212\241(\333Nm\267;\233?/li?\274\313\017RE\271i}l\2336e\2637\343\214\367rX@\344\325\242\375\246 \360\357}$!d\033Ej\312C\206-F\024\335N\245?l\315\324\343\3128 \220\002\031\252\263\rF\020D\316G\266\333.$[\332\350D(\335\367_\250\020\213\3370\013\332\362\004\202\2140ZU1\213k\300\306\210^\310\225C\253\007&\003\006\213\355\350~\330a\324\363K\272\303o\"r\240\210\301\033\317+\260\344\234\301~\r!\363\341v[f\026f8T\364\262\255\334&\231[\037(,\357^A\212:\204;\3262\211F\223\027q\331}\211\257\217\334H:8l\036\215"
+	.ascii	"\241"
+	.text
+	.section	.gnu.lto_screenSize.30.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`\266"
+	.string	"\305\n"
+	.string	"\346TKA \2138\035\207\023\022\002\264\030\b\"N \320\377r\266\322\255\204b\213\007\007\b\036`\375<\354\353\303\034c\354`\343\304]\004~"
+	.string	"\302\003`\354\361i\214\334\227q\030w\23201"
+	.string	"\202\210\b\2212\2458"
+	.string	"6"
+	.string	"8"
+	.string	"\266_\272\003\320\276P\205\nF\030\250\024\232\360aw\243\345\024\327\255\352\023\327-Mp\360\t\372\207\360\ne\240\203h\344yb\036\273\353\024\215\n\334z\333\026\266A\354o\001i\354\341\177i\272\312\264j:3\375\354Bi\250l\330%\220Bm\006\313\002\003\333\240\255\331\021\034:\236\366M\177"
+	.string	">\354\\b\227\204\241\302nxq\314n9\314\034\r@\231\262j\205r\n\252\227\223\351\232\372P\b\373\273\204\224lW@\206\037\301\003\220\355\356\027\334\362;\327\255k\305\311\364\311\224\265\003\233 \354\320\223\212\300~\265J\2625\346\310lh`\224\210\\l\025\216\307}h\316l\335\267\t\341x\\\027"
+	.string	"c\322}\232\221\310i\342\211\006\263\211\031\357\213\233\305\\G\342E\016\307yQ\013\3676\246\226\217\202\\i*\246\352a@\017"
+	.ascii	"BMm\233^d\256\006(\274\030;\300\346\236\312\347\022\033\224\n"
+	.ascii	"\3205\034^\026\360\006\023\017\356>\251VL\302$\003"
+	.text
+	.section	.gnu.lto_writeString.31.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`\342\004]\037"
+	.string	"\206\271\306I\240\230Q:\30038i\215t\275\337\321\346GQ\004\376R\245\240\223U\242\037\253\252\t\030\271w\025\375f\364o\277N\333\277l\"\033p\035;\306\3435x\343U\266\256J\211\031:N\272\031y\233\001\276\373\\~K\210\334)\005\261"
+	.string	"\257"
+	.string	"\253"
+	.ascii	"B\0054\247\333\251l4\217\204f\024\215\252\256Z+\316K\1770i7\246"
+	.ascii	"@d\001R\272\221Q\"\n\314T$\"?6\250(\302\373L\375Eq\221\301|I"
+	.ascii	"+q[j\357\360\364\376\304\363\326\252\024\346\202\371RF\314\355"
+	.ascii	"\324\376\220;\365N$q\232Z\231\212V\265\022sl3_\232h\332\366\201"
+	.ascii	"<H\3176\222\304\246a\3547\225\004\325\245\326j\253\375\006\366"
+	.ascii	"\222\274\r\354\345\332x\357\344\322\236\377\342\251\222\221\340"
+	.ascii	"\360\350\344Fq\t\016W|\311\004L1\274\310\f\177d\355\370$\351"
+	.ascii	"\307S\023C$Jc\021j\255\246\301a\212\273\274m\n\266C\330%\201"
+	.ascii	"4'\376\264?\375\263\027\371eK\035;\325\r{\324_.\365\312\250\251"
+	.ascii	"\214\372\004bYP\016\024kE\361\025\246>)\261r\234\352\257\362"
+	.ascii	"\257~\264g6\272\225\237\344J\276\344L\356\265\244\326:\333\252"
+	.ascii	"TnK\277et\241\031\025\244I\216V\325y\274\231\364ZU'L(\003"
+	.string	"\2760f\361\314\252#&eu[z\243wx\214\236\305+\360\300\211\316|\211U\201BY\322o\252\253V\"\316K\032\250\333\351\261\214N$\261%&\254h\322\365\322\2772\262g\357\371F^\364\214\266\343v\344Hz\257\322\231U\207\004\032G\272j\025\342\274\364i\276\244\001/\177D\331o\275g\311\352E\r\013\254\\\213\307y\260\033_\243\355\261\250<\266\273\237\002T\372%\231\241t\313\275\325\255\2342M\301*/\362\006\274$}p\364A\327\200K\367Ic\234\254#d\266\\\364%\020\331\332\316\271\001\303\347c\317\203\331f\360\"/@S\255\325\201L\223\327\213\007 \325c# \270\2150\330\306\366P@\257\037\3752\225\212\001\333S\275\346\243`\374\205\355\221$\215\361\321/\013\240\345\332\036\202\350\203_\bKH{\344\030\214X\013*\305\202\253R06\361G\267\206}\262\326Z\275L\366R\333,u\r"
+	.ascii	"\352\034\206p\013\004\342g\211:\bmn\267\363!=\020\005\345v:\230"
+	.ascii	"\2103\267B'n\335\203s\320\200\007\350gG\307\300."
+	.string	"wV\230\031\247S\244\033\332\260\313\235E#|\204\212tA\034lg\220\215(\310g\310\206\313\351l:5\237E\035r\266\335y\346l3\242\357d]&\307N8\331\232\375\361\024N\f\2418\267Y\023\266m\266\346\333\237ud\2553 \274\352\357z\242_Z\306\277x\322\307\222\217\274\241\273\262+\257.<\374\343\005\f\364\301\232\355Y\002\356\221o\216\377\"\343kj\245\234f\177\210`A\242_\354k\371\026\236\217\303\031N\372\340\t{I\263\001\256\264\310:\336\202\023We\022b\250aH\206\220q\204D(\220H\204$i\016\200\242\231:\353\020@\312FT(\f\007Br\331\234\306\336\252\316\222\262\034\217\260\330\250\003Wqd\020\031\274F\036\037a`\346\330t\273\262\026\364S\306<L\237\215\003\252\365_\357dql\275\362\177\240\030\31426at\311o\271{\255\301\244%5\3069\257q\216\322i0\252"
+	.ascii	"\355\225a\300\202D\030V\016\245\035r\\5\034 \314:\233\373\025"
+	.ascii	"\371\202\273\346P\301\216\342\365\317\342\022\250\271\315\006"
+	.ascii	"\237\203\207|\206$M]\r}\334\002\256\241\031y\033\001\036u\320"
+	.ascii	"j\220$\272:!j:\013]\307\275\224\347?\212>e\177\210 ~/9\300G\035"
+	.ascii	"N\006\002Z!U-\222T\343 4T\250\001"
+	.text
+	.section	.gnu.lto_writeChar.32.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`\304\001U\020"
+	.string	"V_mE\360\262h8\260\271[r;\272\207+\021\374\203\022\013\367\237w\250\327\001\177\325]:\363\337\245z\346o&n\377[.b\207I\003\243j\246\216\221MpN\361\3254k\226\245\221.n5\2738\364K\310\336R\246\024W"
+	.string	"]"
+	.string	"T"
+	.string	"\273!H\003\356\233\247\241\364\264os\024\342G\n\007\260[3k\261;\226\370\343\276y\344l\373&~B\264]hc\214&\364\302!\243\002\310\356~$\027"
+	.string	"\372\246="
+	.ascii	"\350\233\202\270\370\024\375\317\256\225\340\360\002F\343z\206"
+	.ascii	"\026\354\256\023F\203\341\326\333.`;e\247\201\317\3717Mk\232"
+	.ascii	"VMg(\375Q\350\307\f\002:vg~\206\254\214\215G\304w~[\364g\356"
+	.ascii	"<\236\222\275\303\342v\004g!E\216\236\335\013\007\276\031\305"
+	.ascii	"y2\035\027\030&\233\257\270L|\316K\216\266\302+\204\n\367m\224"
+	.ascii	"\036\t\034\230\217\366Uc\306A\254\244i\233"
+	.string	"\234\210\277\201\261n*R[\005\346a\236j\233A]\356T\323\217\250\352e|D4}\274\005d\273\304\213\365H\031\217\253m\004\237\265\210b\273\213r\330\216M\257\267!\343\023\223?\016\365\244,\006\215M!\366\350J\375`_[\255\2615\355}\374E\277\371\273\343\374#\327\371E\002(\227\025\r[-\223v\372\013\030*\013xR\247\234P\022\234\240VLH\003Z!\310\240\363\211\264b\251TZ!\270\232`bY\261R\017>0\365IH\231T\337)d}$\022\203+\b\341\327\002\301\360\353\306\275\355iJ\207\030}\231\245\355zP\320s\223?\3562\365,>\213\360\335\330\335\303T\265$ \260\"*\263\035bS\333\344E\254v(Tk\353\002\263E\233\355\230\006\027\306\343R\016\343\032\341\030X]x\233\0325o#\037lb\207%v&\220\354LhT\363\312\271\005\273\344\252\244\321\216\245\267\266\216\215"
+	.ascii	"\032B\305!<\361\304VL\302\"\003"
+	.text
+	.section	.gnu.lto_isTransferInProgress.33.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`3"
+	.string	"=\b"
+	.string	"bO:9@s\322\001\f\243\333\321F\370C\224\b\334\347\251\270\300x\034v\032\367\206I\255Y\244\316\266%\205E\3272\"\371.\302L\377\214\016\357\326\241)\272\250-N7\013a{\247\024~\350\034\032D\031\026!\356\300\004R\211\315\035\367\225H\025&\220~\034#\215\257\344]L\352\315\roD\232\035X\232\\\202\351\207\001N\023\245\340\334\352>\324dJ\354$%U\016`\315\024\274lb8\033u\354\212\212R\304>\300\356\256\245\313\216\023,\330\rB\316\356\252gge\262\030\023\333'{\263\005R\0201\332W\371\312\351,\035\037\330u\325\300\354V\006O\3203\327\033h\317@'\320\236\331vHtr\370J\262\372\250x<\\`\273u\312\221\207\217\241\377\327\025PZBh^Z\250\307O\304\356:~\264@ny\333\013\266)l\227\004\n"
+	.ascii	"BMm\233^d\256\006P\264\032\260\004\373,6\3215/\341!\314\353\232"
+	.ascii	"d"
+	.text
+	.section	.gnu.lto_resync.34.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\215\t"
+	.string	"F\222C:0\221\322\001"
+	.string	"\253h\320\256D*\322\020y\0243_\325\"\356.\026>9\235\323[\303\346R\334&\006\342}\274\372\223\203\217F\310\303)\267\206\201S=b\226\353\021\313m\367N)/"
+	.string	"0"
+	.string	"2"
+	.string	"\005\335\251\367\201\356\324\242\255\363Q\266\240X\tI\215gw\353d\271x)\372\247\035\300\365b]\202(v\327\322\365:\271\347m+\330\276\260\215\0130\373\263_\322"
+	.string	"\225\233\205\333\256I\256gm\324\306\305\366\355\217\242\035\262E\267\211\313\323\374\227\303\210\237\255.\260\013\243\251\331\035\031\\\275S\217\017#F\370x-EtUg\203\\F\345\355\356\203\037\023\"B \333\335\267\234\372\253\356\324 g\247%s\2263(8+q\366\310\2223f\377\263\273\353\031\226(E@8pd4\214\016R\341g\021ri\004\242N\030\251\360\003U\244\016\020e\322\250\237\251z\230H\247Z\nQu\224\340\017\334\bk\352\373\302\032\032\367\237\235\260\212\025[k\006\f"
+	.ascii	"BMm\233^f\366]\270\232\365I\004\227?\345\r\030\253\252\356\006"
+	.ascii	"]&\202;\267h\347\023"
+	.text
+	.section	.gnu.lto_txBytesFree.35.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`N"
+	.string	"\335\b"
+	.string	"V\020>:0%5\035"
+	.string	"\256\036\274B&]\364\222\213v\211u\216C5|c-uh\f\246\033%S\270N\206\215\317\200\221\3763\274LqDg\332\253)Z\206\037\241\"X4\322\266\224),"
+	.string	"-"
+	.string	"-"
+	.string	"\034,8\335ub[\320\331\212Z\202\316V2d\303\345\360\273+K\235FlF\222\270\034\360\320\335\347\221\344\261\227\373\377\340\177\304\377\226=S\305\220\374\007\377\353\027xq`\3767eU\300\255\032;\320]\272\201\351\256\t\237\236\255^=\377\277'\213\002>\244\252\b\3112}\004{)\261\r9z\305\177\206\210w\224\362\0032\222\342\255\023\273\224\3244\347\374Udi\372\227jY\372\317\227\224eB\203 \323\335\021"
+	.string	"@\377h\r\f\013\026\023\n\231\301\327Q\210\353Z\306y!\211\257\243\234\bt\301y\033\305\244\333\304\330@\241\251u\336\314\260S\256\242\233\037\245\335\274j\007\f"
+	.ascii	"BMm\233^d\256\006(.B\033+b\272&\236\261\300/\230 \340\204\221"
+	.ascii	"j\305$L2"
+	.text
+	.section	.gnu.lto_mspDisplayPortVTable.36.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`\022"
+	.string	"\245\006"
+	.string	"T\013\330"
+	.string	""
+	.string	""
+	.string	"."
+	.string	"\005\001\006\177\001"
+	.string	"\005\001\212\001\202\200\200\374\342\303\335\302\005}{\270\335\362\003yw\370\334\242\005us\270\334\322\007qom\274\236\270\225*ki\370\326\302\005ge\270\326\262\005ca\330\325\002u_\325\302\005u]\370\324\202\005u[\324\322\003uY"
+	.string	"?\202\210\200\350\001WU\307\001S\306\001Q\305\001O\304\001M\303\001K\302\001I\301\001G\300\001E\277\001C\276\001A\275\001\277\177\274\001\275\177\273\001"
+	.string	"\013/root/repo"
+	.string	" ./src/main/io/displayport_msp.c"
+	.string	"\f"
+	.ascii	"?K\001D\373,\032\220\022\223\024\231\304\240\356\020B\001\244"
+	.ascii	"\304$\345L\302\006P\004"
+	.text
+	.section	.gnu.lto_displayPortMspInit.37.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`\231\001\r\017"
+	.string	"F\332aG\360\262&\035"
+	.string	"\\\327\217c.\311i2\030\r\260L`\246mm\rDp\240\327\361\2164H\n\275\204\255u\362\214\262\361K\213X\213\252Q\237S\031\023m&2b\2274\345\360PY\252\341'\351\210k\020D6!;\245F"
+	.string	"O"
+	.string	"M"
+	.string	"\227\356\270K\277\205\262\347\345\355\024{\372,>\223\342\324H]\251BXZ Z\360\354\326\316\365\003\266K\356\001\266\313\f\305S\217)\3774\327dbn\204-*\217 \021v\3271lQ\335\331m\037\260M\301\216"
+	.string	"\002\361\241A,\231\212\343\215\210\330F\037\273\256\304\354\204}m3\023\266\234/9\022\330\354\206\370\371\2618d\216\n\277\365\027\352,\277F\202\016\231\335\235\227\256\327O\333\227\272\252\222\024<\b.Ev@\310\342]\250\327o\244\256\352.\253\0323\n\0029(\002V\273\333"
+	.string	"\207"
+	.string	"\217\0350\376\370\257\207\300H\304j\316\355\340\254\350\361q\326e\304\270\353 p\304\214g\035\006\345v?\300~\223A#\321\215n\227g\375\305\307\355\202\017}\027\267\341\340\307\\\332\364\305\207\227\376\267]\332\035<\004&\021=p\300"
+	.ascii	"\203\205\005\241\002'\217\226L\213B%\023\251\302\311\243\245"
+	.ascii	"\317DC\3114\272\320\321Q\267adB\352D\236\251\013\201LK'^w\242"
+	.ascii	"\324\353f\005oC\207\004\006\314V<]~\232O\320\201\351\351\001"
+	.ascii	"F\037\033\020\235\306\214\b+\021\0239\312\366\227O\036% \200"
+	.ascii	"\002\2312\325\001BS\333\354E\\M(Z1P\213\275\2032\264\356\235"
+	.ascii	"0_\016\270\\j<4\256\345I#[\254\013\270TP\341\220@\033\3272Q\301"
+	.ascii	"\230(\231\304\353:\340\370\210\306\303=\033\354\017\355$\252"
+	.ascii	"V\020W'\215\017\261\356O\205k\220\2106]\206\f"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`R\001\375\006"
+	.string	"d\tN\002"
+	.string	""
+	.string	""
+	.string	"\002\036\177\022\200\200\200\200\004\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006!\177\023\"\177\024#\177\025\031\177\026\005(\027`\032\177\030\035\177\031\034\177\032\033\177\033\002\037\177\034 \177\035%\177\036\272\220\202\005\027\016\300\204\001"
+	.string	""
+	.string	"\003\005$\017\001'\177\037\377\037"
+	.string	""
+	.string	"\200\220\200\001)\177 +\177!*\177\"&\177#\003\003\017d\003\004\020\310\377\241\372\001\001\304\007\003\006\004B\003\007\b\t\n\204\001\003\n\021\204\013\003\n\244\022\003\013\n\342\006\003\f\023D"
+	.ascii	"  \020\003\031*m\003\206\306\320\004\231\3448\024Cf\346o\031"
+	.ascii	"\366\365\036\220G=\033\234\332\005\035@\347\204\fc\251\325\026"
+	.ascii	"\f\310\217>\024h\340\036\016kG_\347\312P\017\365P5d,\251\214"
+	.ascii	"\365X\217\253A\263\303\t"
+	.text
+	.section	.gnu.lto_.refs.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375 Q\305\001"
+	.ascii	"\"D\013\017\260Uc\f\003Y\002J\271%\333$\261I\246\002\277\270"
+	.ascii	">\233}L.\007\247#\272-W\216+O\373\215L\3014\205\214\362\230\242"
+	.ascii	"\324!\003\004\002@\300MI\002"
+	.text
+	.section	.gnu.lto_.decls.ce0c9735be8c4cc3,"e",@progbits
+	.string	"(\265/\375`\373\037\255\216"
+	.string	"\252\34643R0\022\322I\007}\234V\332\227\036\245SzF\037\214T3\364\316\363\257\262\365Pf\307\211Y&\221\233\031z&9\360{\264\350\263\347\323\035\320\364e\346\241\025\214yTVE\020gf\b\202BY\326\253F\263"
+	.ascii	"\240"
+	.string	"\022gj\224\374\232y\"\211dK\231\002\273\002,\003 \003\215\276\213\334d\270\003\350\260\3352m\215\362\360\274\221$\322\245\324z\313\304\374\230\\\351\033x\003\370$\003v\273\250\316\354\032\375\0310M\234]S\263\321\277\325\250\250\np\253L=\1775\341\262\020cA\234\234},\266\344\370\202\373\335\321\034S\026-\354\366\304j\007O\036\3071]\213\243\245\315\215\344R\036\2237v\263\322\341\344\354\013\343<\016\303xvMS\221\306\204\250\2551\233]\265\202O\253\036y\214\226\306Sr\220\"nr\356\207\026\0243\236\022L\002qr\366\361\025,\314\226\203\\/SjE\345\344<\373q\031\326c3L\206\373\230\217\321\360\030\376\201\317\360\223\363\370\313\271\216\301\334\304z\257\321\275\367\023\374,\366\257`\301y\314\205\335\354\252u\223sj\013\030\335\335H\323w\357\352\200\t\007l\222\221\250\033\005\240,\206\355\370\311"
+	.ascii	"\337\235Wf\362\232\242\365\256-$\r\224\261F\3378\3243\003\251"
+	.ascii	"\r\fd\006\322\267\222\332\227K\244(8\220\216\275\344h\311\242"
+	.ascii	"\212j\264\313\252B\0013\307C\214\372\3449\226[\257\t\034@\247"
+	.ascii	"\334\324\025\365\234\246\236\241\250g2\365,\246\236\273\3246"
+	.ascii	"\034@.@\277#\3529K5\321CE\301\326\\\205\255\234\331\230\312\215"
+	.ascii	"\021\263\241\367\0261\247\310aNQ\303\226U4\226\242\347\034\352"
+	.ascii	"\271I\335a$U\202(,\205\237&\370\354\352\260\\ri\252\321\363U"
+	.ascii	"w\270\201l\"}\rj\013.\221\362\030\223\361\363"
+	.string	"\004?\371\n\026\267\310&\367\353\336UG}K\272\352j\364C\365\306\305\331\311a\024]\026G\241\236O\244\034\310'\322\267*\202K\244\315$R\021i\\\"\365\342\257\023Vi\203y\313\356]G\350\254PJ>4\372\225K\244*\223H9\216o\357:\277\005\3729\352\347\035??\375\234\343g\252\237\227~\346\361\263\323\317S?\337\370\271\351g\246\237\245~\256b\035\212?\323\320\003C\002+\374\\\302\377\004~\373\301\317J\314\274@\001\313\204W\371o\177K\302\3174p\320\371\315o}\364\334\354^\b^\200\337\n\377\377\360\037O\375\355\bY0\020\211\241H\317\317/\300\360\364\267.\374\f&\346\200\237\275\374W\201\303\374\314\307\371\355\213\237\345~~\373y\355\347\260\237\227\374\354\374\331\310\317Z?\027\371\231\310\317Y?\017\371Y\310\317@~\376\3613\326\317>~\276\372\017\370\377\357\347\346\317\002\374|\363s"
+	.string	"O\376\337\375\f\300\317#~\026\3613\316\317\352\317\375?\360\177\232\377_\377\025\370\337\366?'000\360\267O\277\345\373\t\020\006\301?\2442K\233tk\203\323\344\316\316\032\265<\330\032G8\356\222\255a{\bk\242D\326\250\222\243Pq\245K\026\311\036\351(\255\354\031\001\252f\324\327\214Q_\363E}M\233\372\232\264@@\264\255\017\354L\2327`\216\022\227\226\036\032u\342\207\206\351\260\224I\362\303\033\315\321\221&\257F\273\257\2315X]\216\226\032\3553\252\025\2223u\2156\037\273\245J"
+	.string	"\277\366\032\007\367\200\313\332\342\322+\203\223\024\306\303\031\231w\231\203\350\301\024\226\327L\265\210\313\027^\243=\206\323D\341\001i\264\361\330\r\025\033\003[6\332w\214W\003\305vg\304e\007\364M\201+\"&\f3\251\233j\002\363\016c\243\203I\017\251\321\256k&\227\244\267/\354\026\f\374\302t\324h\323\261[\235T\236\263\321\356\322^@$\001\377\240\2740^\024\017~Q\346n\260\276\366\002\347\270\254\007\0335z\370P%\200\343\242\362\375\260\356mys\211C\343\344\250\321\232&\267\266\264\314\f\311\237\226w\233\006\314')5H\352\327\232k\205-]\262\263\243Z{\263u\225T\315\r\313F\243;M\305\306h\275d6tz<\312\316\250b\324\247\241\365\224\267\025+\357\354=\245\254\346\b\030\245\250F\251D1\013"
+	.string	"\355\206\030\224\267\031\253RgX{\215\366X\227\335\024\361\323rV\366\244\361\300\260\214i\364\031LJZq\202\251N\232\354\366\016>*XX\352\367\272IN\234\215#;\2320\t\306ue\371\005\223"
+	.ascii	"\241:\023\245\036.\f\314F\313\335\322\306\327\033\214-\314\315"
+	.ascii	"\352J\243\355\325L4\314\312I\325hw1^\216\017L]h\270B\234\331"
+	.ascii	":rrm\205\370b\006\315I\243Kpx\001\201j\364\250RU\322I\322\250"
+	.ascii	"g\224\243\037\324[:$Gn\260dY\2121\362>\302l,\344\311w\304nQ\237"
+	.ascii	"G$K\307\013[\232$C\336Y8\177hEB\032m!\315d\022##$\310\025\257"
+	.ascii	"\253\266F\033H\003ad8\306\324\276j\037\374\354\037\177c\361\225"
+	.ascii	"\243M\230\227\354\336\025\307\026A\275\2415\212\356\244:\274"
+	.ascii	"\223\336\036\261j\202\b\262\367#M\325\273y\274\233{@\257\315"
+	.ascii	"\201}5\372\275f\376\267\341\034\317\036?\230=|`\311E\375\345"
+	.ascii	"P\241\253\361\324hS\361\227 \322\323\235e\252|\231D\312K&\221"
+	.ascii	"\332\254R6I\275\221r\361\206:?\033\212\003EX;K\224s\353.\227"
+	.ascii	"\017\274\333p<y=\371\030b\243\346\227"
+	.string	"\004G\243m\353\327\r\023\223\020\346\215\232!h\272 iZ\246O\250\214i5\372^\266\222\f\367\256i\025\223,\266FW\360\274\231\322\255*U?<{I\351\003%;\3044\332Im\343\255\3245Z\211\002\346\275E\255\244\363wo\221\016s\n\346\024h\227U\021\263\024}[Q\377\356\241\225b@\210xi\364\255\374\373\250\221\214@@I\351Ui\264\227\\\"M\200I\244m\304\363\346\241&L\030\275\271FS\274\223]\204.Q\021\243\022YI\032m>[j\315~\327JkIx4j\241|\214\024&?\246l\331\026\253\271d\243\326\211}\362\363m\366\311s\326\220\240\264\035Q\277\003\277-\265Mn\307~\033\2335\252\253f\020&ft;\264\256\324\007\251\324\0332\\\\6\314\204z\301\254\352\362\246t0}Y\260\333\260\272\252\273\266F\355\227\245\033\242\366\327\250\355\262^8\201h\002\311\274\332\311\326"
+	.ascii	"3\203\326\350\367\316\206C\315\353\255\321\007\227*N\223\013"
+	.ascii	"%J\354\022\023L$\231\035\260\345\031+}\367J\355\244\3171]XK\252"
+	.ascii	"\3300K\340\212lQq\234Hn\221X\247zA\360 &\265c\271\360Y\335}\357"
+	.ascii	"\326\331\314\020v<\2248\211\242\346,\331\331u\031\273\034\274"
+	.ascii	"6\323f\032M\331ZQ\021\223\210!H$\225\226\016\237\275\366fi\211"
+	.ascii	"\350\263I\233\354\266'\311\032y7V.n\205<\255\020v3\241\336\257"
+	.ascii	"\264\266\274{\261<\020\204\013\303\233\032SG8ey\226nSo\213\276"
+	.ascii	"UM\255\331Z+hv\225#\357\212\375q\245\233*\362*\tG\357\355\255"
+	.ascii	"\271\260\324\265si\244\236vt\332\\X\037\354\325\373\357\177\r"
+	.ascii	"(\302\275\327Kj\271\363\367\237\336\0335\353MK\336\234k\316;"
+	.ascii	"?\016[N\340?zo\016\367\"\277\3740\223jiF\2319\212\373_$s9B\271"
+	.ascii	"\2225\227J\243f\024+\311\232MJ\262&\262\225nEM"
+	.string	"\313\333D\252\227\331\244*\213\356%c\336\246\020k\363\336\265\211T\327\242\345U\256M\346\b\245Q\263\211\225dwy\215\356\022"
+	.string	"\345\275M\227\254I\206\225\267\271T\2221\233F\\#.3\245\236\222&\226\222\366$*Nit\227\n\3302b.\341\224+\223\323\356E\226\035\335e\363\336)f\2124#\"\310\264$\334RP\312hEr\016\245\244\025\323fM^8\245\223)\343\350\336\272\253D\001\222\221H7\211\344{\217\326\345\275I\246\fRL\356\202\264\2748\327\250\310F\322\212ys\224d\"]g\0257)\311\254\230<jO2\255\233\\\221\254u\353\232K\225\f\271^\345\275\227\365p\316L\361\322\327\350M\021\027\314\305-u~\266\224m\212\260^$"
+	.string	"NzD9\373\356\362\351\201.6H\222e\240\032-\242\325H\24689\267\304\326\216\"\005K\2775\234X\\\333\265\036X]\377u\240WZ\253\265\025\020I\263)\037\232\b\032\226\316R\346\344\334J\266[\0211)\215\226\223\214\342\344\354\233j\036m\205e\311F\331\035\266\3126Y\246\225\262S\026\207\325a{X&Ke\237,\017\353do\330\245\315\301O\013\305r\357\034\255#\255\257\264U0\t\305\311\331W\327f\332\357K\353\266\033\303I\211\270Fc]Z\367\256\026\331n\\E\332\331ag<\266\250\335\266\234\234[\035\327r-\346\200\244\362\242caN\316\255\336\001e\215\254\022\303I\255\367F:\227\305\311\231\276\r\311b\267\243dm\004G\242\241#\0211\r1,\022\005\025\217\306\3642\"0\252\030\376\020\005\371\b\001\251(\032\211T\b\020\024D$$D\024\n\036{\2068"
+	.string	"\031S\033\210E\031G\242Pp\006\3410\b\2451\3443c8#\225a$:\301\3303d\234q\200\nAB\240\342\360\305\021H\310\305\220\221\004"
+	.string	"\206?D\022\200\202|\202\367\001*\016\205\2061\324SP\001\004\025\264\270!\370\026\030H\200\201\004\351[`\300\303\203A\005<\352+\340\261\307\036\035\243\260\006!a\007\307a\f\033th\024\016\203\206\305`\210\0276\b\213? \2068"
+	.string	"\275"
+	.string	"\021C\b\250x|\021\302F8,\252F\343\260\030\203X<A\310Eq8\203\021(\200\243p\b\343X\024\016e\330\370\b\3210\016\213\351\261g\305\004\303a\021\004\343\360H\203\203\033\216!\214\003\034\215=%\204G\341\217\3608$\3418\214\241s4\366\374\030\2119\305\341\321Gx\024\"\2020<\002\025m"
+	.string	"\200\306\217p\230\202\021(8\354\0312\241"
+	.string	"!\240\030C\030\"\204\210@G\037\241QHXT\341\b4c\006\321gD"
+	.string	"G\341\301\220qFNQ(\303\007=^F\004\306\342\260\006\240\342\317\211\023\207\206E\025G\"\261\250\"\304\261\247\002\036\265(\224\321\301\r\302\031Ac\017\316\321\330\303\302\261H<\201\3040\b\206P\205\032\322\241\017P\r\303\237\324h\003\261\210\032\203\210>h\013DA\027\214\304!Th8,\372\030\203\202\210@\030\032\211p\202\210D\016zj~\206E\3410\310'h\0031\205\"\321X$\362\2619\366\2648\n\001\245G!\"b\0070\204\305\0306\307\236\243\210_\340\323\302\002\0263\300X\021\201\001\277\340\202\016P\254PB\b\252O\004C\306\031=4\204ACF\240\037\025D \025B@\302\031*|\212F\025\021 `\034\036\211`"
+	.ascii	"\025\217\307\r\2167\fU\370\031\036\213\304\241!\242\027?C\031"
+	.ascii	">B\237\023g\2329qgUA\370\344\232\207\021\276\244\275%:=P\341"
+	.ascii	"\371\351\335\232\321)\003U\265\243QK\306\226Y\242e\006\346wx"
+	.ascii	"H\354\326\302\032\265cl\236\316\017-(T>\346yK\235>g_\030\274"
+	.ascii	"\265\340\222\227\237\217\273\2674"
+	.string	"&\261\247\265\263aGO\317\277FGp\331.V\214\355b\303\264x\263`n\303\250)\241\003k\324\3265\363\nR\307\223F\355\027\255\2700@\032\265^,\235\222\221\242't\354\326so6\222y*\016\017.\\\254\0347\271L\354d\207\223\263\267t\001\236\331\270[\271\233/4\310\252F-\\3\203\3532\307\022\246;\225\026\220$]\324\033-Un\261T\261o\266\214*\305D\222\311\200\255\017\347L\007\0273\313\355\333\255\333\n\026\266l\211\255\311\327\250m\313\221z[\313\323b\321\220\\\221-i\364\0204\201jj\302\241\263\304/\211\256Q{\345v,\214\355h\256Qk\345\226\211\217%8962C\240\202pQ\037\304\242\336t\255\267d\253]\263s7\027\331\3442\005\243l\001\336\350\273J\251\235\234\2441\315\253(\267k\267j+X\374N\310\307\363\331\250M\273E\003\242\367TN\261hF\354\244"
+	.string	"r\251\366\f\002\036h\252\376\244\374\220\013\202\242\250\342\0309\b\364J\031\231\022\021\031I\222t\002\013\020\004\203i\240\326\352\006\022\200dA\221*\347\204D\222$\251\327\326\030\225"
+	.string	"\034djB\013\233\320\256\025\300\022vt\304.\222AS\376\207b}c\337@\367\036\253\217\030k\237\212\017\316~\\\223\274\216\301E\0211^\264\235\003\323fc\336\033\246u\224u|\234\020\355\311\303sG\344|,CQ%9\004\230\2278aC<\026\371\376\365@\264u\331\366\004\247M\354\017\023=\207=fC%\032\331\r\352\231\277\371\025g\367\nxF^\003\333\004\330\314\326\205\223#\177BjK\037\372^v./\230\347\027\024\356NH\226\202\tT\245L\314\355\030~\245\227A\321\026R\262Y5\264W\237\003\341\223\003\226\316H\005\206\326N\031l&\036\374W3\342\263\3648p\275 \007\264-$e\307m\034\2607`mA?\307j\022\363\2248\276\234\235\036\253oF1\245\203\003.D\335<\336\265\\\005\262-\220\264\337\016(AK\366H\231\007\254.LR\231\373b\r\241\223R\211\327-T)\005"
+	.string	"\346DO"
+	.string	"Mzm\323\013\322\210\303\227U\231\367Bj\312\013G\025\377\016~\321%t\321\001\324#\200\325h]\2473\366\202\251\370\312\020\371I\031K\312\032\346}\325\302\202\374TV\271\037\257\001\261\342\201\324\030i`E\021\202\304\215\375g2#'{\234\216\332\271\307\267\264\220R,f\t\"\223\2759\277pm\244\223P/l\336b<\211\254\003\034\234x)'\333X6\016\350\353|Y\360\316\210\300\236<7\004\312\227\237\356I.\016E\031\002\323T\333]\242%J9h\bjp\231\212\323\023i\234\206\377\327IJ[z5\275+|\3124b\206\225\027\342\260\311v(Ab\360*\312\005$\324\316.B[\0010\202\032\264H\302a\003_\314\212c\013G\330\271\035\361\005\016\374\241\244Y\3660\324\252\224AHWT\177D\016; \213\031\250\330\241\013\034,y\251\200\320\244\224!k\030!7\301r\275.\0253"
+	.string	")\224\205.v\271$\264*\367\223\310\250w\3564\b\324\311\261\251e\302\207\227\303\024\350\251&\013X\317\362m2\024R"
+	.ascii	"\n\266]\2073b\262\324{!\324\201\331 \322\b\031T\237`\216@\270"
+	.ascii	"\245c\327\256\237\364k\360$:\220\f\030\343\213\346t\001\005c"
+	.ascii	"\343N\244fK\352g\307\024\211\346dj\203\306\022\212\035\234\374"
+	.ascii	"c\362\026\203\bQOy\231[n\205P\221W\221\271\270\223\030\361\353"
+	.ascii	"\231\336s4\341&\031\260;\007\203\025U^\333\032\357q\031\227\313"
+	.ascii	"SI\347\371+"
+	.string	"P\206\371\255\366\344\321\237\350\264\264\026R\350\375&\365\016\323\006\252\241qs\2720\300\251ES\344\013\351\207\350!\230$\3366\212_\341<T\370\036\020p\315\265l\016w\316\260m\300\322}\300\233\205\002\213\343u\301\365\214\017J\246{\004YnS\310\321/\356\0201\317\205\350\nSM\250\320\236o\303?\225{q\322p\323\247\227\310\236C\336B\234w\267M\357*\372\375\260\030;L\351l\236\024\206\362\210$I\202\261~\005\026\374\232\214p\022\316R\345\2204\304`f\213*\323G\320[\270\254\027h"
+	.string	"A\210g~\325\270\027\306i\231.\017\r\214Q"
+	.string	"\245\223\224\275&\252^\206N\346~\275+\313\240n0k\262r\270wn]\334cI@:\374\021\324\n4;:\325\213\265E`\200\020-*d\350\237\211"
+	.string	"\347W\fUtT\303~\n\240\236\033\216\322\240\307U\271\fB\347\246\262\261E\344nSig_Y\312\34084cP\246N\224%\003*\314\271\351\336\245%\227\305\261[\365\200\202\264\367\370\272\317\276O\311\342\306-?K5\027\353y\310KS\315\347"
+	.string	"_\212\234]>]8\007\321\235\253\206\023\303\230\205\270\315y\300\r\036\305?\003\030g9DA){8\366\020\273\350\212\373\025\033\365\266;C\350]K\356#\032G\3331\224\225<\265\202E\005-)\341ec\250\251\b&\266&\020\324\3325\216!9\316b\245;\320\3562p9\021J\256\315y\021\374\244\231b\2443\231\007\362\273\024W5q\n\037d\031\351\334\324\216\344\242\214;\311\352\365\246\366\271\372\322\3465\301mK\266Y|>S\352\r\327a\323\360Y0\177\246t\2079)\022\371G\351\236\30534\334EO\024\307\302\236\341\323\352\020!\370*\317\243"
+	.ascii	"0bd\310\241\363\320\r0\360a\236\021W\256\3373\346\253\304\201"
+	.ascii	"\211\213\225\347\360{\265\226\251\241>K\202\277\235\314\n1\323"
+	.ascii	"\375\357\344c9\237D\356elk\377UV\211\030k\021\266+\201\375[\205"
+	.ascii	"\251?\356\307\367t\376\245\342\016u\260\214\352\364\305\373\331"
+	.ascii	"\364E%7\207\252U\334\316\261\025"
+	.text
+	.section	.gnu.lto_.symtab.ce0c9735be8c4cc3,"e",@progbits
+	.string	"displayPortMspInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\001"
+	.string	""
+	.string	"cliMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\001"
+	.string	""
+	.string	"mspSerialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\267\001"
+	.string	""
+	.string	"mspSerialPush"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\001"
+	.string	""
+	.string	"displayInit"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ce0c9735be8c4cc3,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,17011 @@
+	.file	"frsky_osd.c"
+	.file 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/log.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/drivers/display.h"
+	.file 7 "./src/main/drivers/osd.h"
+	.file 8 "./src/main/io/frsky_osd.h"
+	.file 9 "./src/main/drivers/resource.h"
+	.file 10 "./src/main/drivers/serial.h"
+	.file 11 "./src/main/io/serial.h"
+	.file 12 "./src/main/io/frsky_osd.c"
+	.file 13 "/usr/include/string.h"
+	.file 14 "./src/main/common/uvarint.h"
+	.file 15 "./src/main/common/crc.h"
+	.file 16 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	frsky_osd.c.bb85edf3
+	.weak	frsky_osd.c.bb85edf3
+frsky_osd.c.bb85edf3:
+	.long	0x1e58
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x26
+	.long	.LASF1932
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1480
+	.uleb128 0x6
+	.long	.LASF1486
+	.byte	0x1
+	.byte	0xd6
+	.byte	0x1b
+	.long	0x35
+	.uleb128 0xf
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1481
+	.uleb128 0x27
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1482
+	.uleb128 0xf
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1483
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1484
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1485
+	.uleb128 0x6
+	.long	.LASF1487
+	.byte	0x2
+	.byte	0x26
+	.byte	0x17
+	.long	0x43
+	.uleb128 0xf
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1488
+	.uleb128 0x6
+	.long	.LASF1489
+	.byte	0x2
+	.byte	0x28
+	.byte	0x1c
+	.long	0x4a
+	.uleb128 0x6
+	.long	.LASF1490
+	.byte	0x2
+	.byte	0x2a
+	.byte	0x16
+	.long	0x51
+	.uleb128 0x28
+	.byte	0x8
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1491
+	.uleb128 0x12
+	.long	0x8c
+	.uleb128 0x6
+	.long	.LASF1492
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x5f
+	.uleb128 0x12
+	.long	0x98
+	.uleb128 0x29
+	.long	0x98
+	.uleb128 0x6
+	.long	.LASF1493
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x72
+	.uleb128 0x6
+	.long	.LASF1494
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x7e
+	.uleb128 0x9
+	.long	0x93
+	.uleb128 0x9
+	.long	0x98
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x51
+	.byte	0x4
+	.byte	0x15
+	.byte	0xe
+	.long	0x126
+	.uleb128 0x1
+	.long	.LASF1495
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1496
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1497
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1498
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1499
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1501
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1502
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1503
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1504
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1505
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1506
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1507
+	.byte	0x4
+	.byte	0x23
+	.byte	0x3
+	.long	0xd0
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1508
+	.uleb128 0x6
+	.long	.LASF1509
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x12
+	.long	0xba
+	.uleb128 0x6
+	.long	.LASF1510
+	.byte	0x6
+	.byte	0x19
+	.byte	0x1f
+	.long	0x156
+	.uleb128 0x12
+	.long	0x145
+	.uleb128 0xb
+	.long	.LASF1606
+	.byte	0x40
+	.byte	0x7
+	.byte	0x3c
+	.byte	0x10
+	.long	0x171
+	.uleb128 0x3
+	.long	.LASF1608
+	.byte	0x7
+	.byte	0x3d
+	.byte	0xd
+	.long	0x1bf
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1511
+	.uleb128 0x6
+	.long	.LASF1512
+	.byte	0x6
+	.byte	0x2b
+	.byte	0x11
+	.long	0x98
+	.uleb128 0x9
+	.long	0xae
+	.uleb128 0x9
+	.long	0x178
+	.uleb128 0x9
+	.long	0x151
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x51
+	.byte	0x7
+	.byte	0x2d
+	.byte	0xe
+	.long	0x1b3
+	.uleb128 0x1
+	.long	.LASF1513
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1514
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1515
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1516
+	.byte	0x7
+	.byte	0x31
+	.byte	0x3
+	.long	0x193
+	.uleb128 0x10
+	.long	0x98
+	.long	0x1cf
+	.uleb128 0x11
+	.long	0x35
+	.byte	0x3f
+	.byte	0
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x51
+	.byte	0x8
+	.byte	0x9
+	.byte	0xe
+	.long	0x1e9
+	.uleb128 0x1
+	.long	.LASF1517
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1518
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1519
+	.byte	0x8
+	.byte	0xc
+	.byte	0x3
+	.long	0x1cf
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x51
+	.byte	0x8
+	.byte	0xe
+	.byte	0xe
+	.long	0x21b
+	.uleb128 0x1
+	.long	.LASF1520
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1521
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1522
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1523
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1524
+	.byte	0x8
+	.byte	0x13
+	.byte	0x3
+	.long	0x1f5
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x51
+	.byte	0x8
+	.byte	0x15
+	.byte	0xe
+	.long	0x253
+	.uleb128 0x1
+	.long	.LASF1525
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1526
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1527
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1528
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1529
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1530
+	.byte	0x8
+	.byte	0x1b
+	.byte	0x3
+	.long	0x227
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x51
+	.byte	0x9
+	.byte	0x16
+	.byte	0xe
+	.long	0x351
+	.uleb128 0x1
+	.long	.LASF1531
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1532
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1533
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1534
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1535
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1537
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1538
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1539
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1540
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1541
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1542
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1543
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1544
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1545
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1546
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1547
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1548
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1549
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1550
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1551
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1552
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1553
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1554
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1555
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1556
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1557
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1558
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1559
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1560
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1561
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1562
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1563
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1564
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1565
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1566
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1567
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1568
+	.byte	0x25
+	.byte	0
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x51
+	.byte	0x9
+	.byte	0x43
+	.byte	0xe
+	.long	0x3dd
+	.uleb128 0x1
+	.long	.LASF1569
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1570
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1571
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1572
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1573
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1575
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1576
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1577
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1578
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1579
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1580
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1581
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1582
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1583
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1584
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1585
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1586
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1587
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1588
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1589
+	.byte	0x14
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF1593
+	.long	0x51
+	.byte	0x1a
+	.long	0x3fe
+	.uleb128 0x1
+	.long	.LASF1590
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1591
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1592
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1593
+	.byte	0xa
+	.byte	0x1e
+	.byte	0x3
+	.long	0x3dd
+	.uleb128 0x21
+	.long	.LASF1594
+	.long	0x51
+	.byte	0x20
+	.long	0x45b
+	.uleb128 0x1
+	.long	.LASF1595
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1596
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1597
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1598
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1599
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1600
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1601
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1602
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1603
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1604
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1605
+	.byte	0x20
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1594
+	.byte	0xa
+	.byte	0x34
+	.byte	0x3
+	.long	0x40a
+	.uleb128 0xb
+	.long	.LASF1607
+	.byte	0x10
+	.byte	0xa
+	.byte	0x37
+	.byte	0x10
+	.long	0x48f
+	.uleb128 0x3
+	.long	.LASF1608
+	.byte	0xa
+	.byte	0x38
+	.byte	0x14
+	.long	0x48f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1609
+	.byte	0xa
+	.byte	0x39
+	.byte	0x9
+	.long	0x3c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	0xa4
+	.uleb128 0x6
+	.long	.LASF1610
+	.byte	0xa
+	.byte	0x3a
+	.byte	0x3
+	.long	0x467
+	.uleb128 0x12
+	.long	0x494
+	.uleb128 0x6
+	.long	.LASF1611
+	.byte	0xa
+	.byte	0x3c
+	.byte	0x10
+	.long	0x4b1
+	.uleb128 0x9
+	.long	0x4b6
+	.uleb128 0x14
+	.long	0x4c6
+	.uleb128 0x4
+	.long	0xae
+	.uleb128 0x4
+	.long	0x8a
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1612
+	.byte	0xa
+	.byte	0x3d
+	.byte	0x10
+	.long	0x4d2
+	.uleb128 0x9
+	.long	0x4d7
+	.uleb128 0x14
+	.long	0x4ec
+	.uleb128 0x4
+	.long	0x48f
+	.uleb128 0x4
+	.long	0x3c
+	.uleb128 0x4
+	.long	0x8a
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1613
+	.byte	0x60
+	.byte	0xa
+	.byte	0x3f
+	.byte	0x10
+	.long	0x5d7
+	.uleb128 0x3
+	.long	.LASF1614
+	.byte	0xa
+	.byte	0x41
+	.byte	0x24
+	.long	0x693
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1615
+	.byte	0xa
+	.byte	0x43
+	.byte	0xd
+	.long	0x98
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1616
+	.byte	0xa
+	.byte	0x44
+	.byte	0x10
+	.long	0x3fe
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1617
+	.byte	0xa
+	.byte	0x45
+	.byte	0x13
+	.long	0x45b
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1618
+	.byte	0xa
+	.byte	0x47
+	.byte	0xe
+	.long	0xba
+	.byte	0x14
+	.uleb128 0x3
+	.long	.LASF1619
+	.byte	0xa
+	.byte	0x49
+	.byte	0xe
+	.long	0xba
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1620
+	.byte	0xa
+	.byte	0x4a
+	.byte	0xe
+	.long	0xba
+	.byte	0x1c
+	.uleb128 0x3
+	.long	.LASF1621
+	.byte	0xa
+	.byte	0x4b
+	.byte	0x17
+	.long	0x698
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1622
+	.byte	0xa
+	.byte	0x4c
+	.byte	0x17
+	.long	0x698
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1623
+	.byte	0xa
+	.byte	0x4d
+	.byte	0xe
+	.long	0xba
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1624
+	.byte	0xa
+	.byte	0x4e
+	.byte	0xe
+	.long	0xba
+	.byte	0x34
+	.uleb128 0x3
+	.long	.LASF1625
+	.byte	0xa
+	.byte	0x4f
+	.byte	0xe
+	.long	0xba
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1626
+	.byte	0xa
+	.byte	0x50
+	.byte	0xe
+	.long	0xba
+	.byte	0x3c
+	.uleb128 0x3
+	.long	.LASF1627
+	.byte	0xa
+	.byte	0x52
+	.byte	0x1e
+	.long	0x4a5
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1628
+	.byte	0xa
+	.byte	0x53
+	.byte	0xb
+	.long	0x8a
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF1629
+	.byte	0xa
+	.byte	0x55
+	.byte	0x23
+	.long	0x4c6
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF1630
+	.byte	0xa
+	.byte	0x58
+	.byte	0xe
+	.long	0xba
+	.byte	0x58
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1631
+	.byte	0x68
+	.byte	0xa
+	.byte	0x5b
+	.byte	0x8
+	.long	0x68e
+	.uleb128 0x3
+	.long	.LASF1632
+	.byte	0xa
+	.byte	0x5c
+	.byte	0xc
+	.long	0x6c3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1633
+	.byte	0xa
+	.byte	0x5e
+	.byte	0x10
+	.long	0x6dc
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1634
+	.byte	0xa
+	.byte	0x5f
+	.byte	0x10
+	.long	0x6dc
+	.byte	0x10
+	.uleb128 0x3
+	.long	.LASF1635
+	.byte	0xa
+	.byte	0x61
+	.byte	0xf
+	.long	0x6f0
+	.byte	0x18
+	.uleb128 0x3
+	.long	.LASF1636
+	.byte	0xa
+	.byte	0x64
+	.byte	0xc
+	.long	0x705
+	.byte	0x20
+	.uleb128 0x3
+	.long	.LASF1637
+	.byte	0xa
+	.byte	0x66
+	.byte	0xb
+	.long	0x719
+	.byte	0x28
+	.uleb128 0x3
+	.long	.LASF1638
+	.byte	0xa
+	.byte	0x68
+	.byte	0xc
+	.long	0x72e
+	.byte	0x30
+	.uleb128 0x3
+	.long	.LASF1639
+	.byte	0xa
+	.byte	0x6a
+	.byte	0xc
+	.long	0x74e
+	.byte	0x38
+	.uleb128 0x3
+	.long	.LASF1640
+	.byte	0xa
+	.byte	0x6c
+	.byte	0xb
+	.long	0x719
+	.byte	0x40
+	.uleb128 0x3
+	.long	.LASF1641
+	.byte	0xa
+	.byte	0x6e
+	.byte	0xb
+	.long	0x762
+	.byte	0x48
+	.uleb128 0x3
+	.long	.LASF1642
+	.byte	0xa
+	.byte	0x71
+	.byte	0xc
+	.long	0x772
+	.byte	0x50
+	.uleb128 0x3
+	.long	.LASF1643
+	.byte	0xa
+	.byte	0x72
+	.byte	0xc
+	.long	0x772
+	.byte	0x58
+	.uleb128 0x3
+	.long	.LASF1644
+	.byte	0xa
+	.byte	0x75
+	.byte	0xc
+	.long	0x791
+	.byte	0x60
+	.byte	0
+	.uleb128 0x12
+	.long	0x5d7
+	.uleb128 0x9
+	.long	0x68e
+	.uleb128 0x9
+	.long	0xa9
+	.uleb128 0x6
+	.long	.LASF1645
+	.byte	0xa
+	.byte	0x59
+	.byte	0x3
+	.long	0x4ec
+	.uleb128 0x12
+	.long	0x69d
+	.uleb128 0x14
+	.long	0x6be
+	.uleb128 0x4
+	.long	0x6be
+	.uleb128 0x4
+	.long	0x98
+	.byte	0
+	.uleb128 0x9
+	.long	0x69d
+	.uleb128 0x9
+	.long	0x6ae
+	.uleb128 0x1c
+	.long	0xba
+	.long	0x6d7
+	.uleb128 0x4
+	.long	0x6d7
+	.byte	0
+	.uleb128 0x9
+	.long	0x6a9
+	.uleb128 0x9
+	.long	0x6c8
+	.uleb128 0x1c
+	.long	0x98
+	.long	0x6f0
+	.uleb128 0x4
+	.long	0x6be
+	.byte	0
+	.uleb128 0x9
+	.long	0x6e1
+	.uleb128 0x14
+	.long	0x705
+	.uleb128 0x4
+	.long	0x6be
+	.uleb128 0x4
+	.long	0xba
+	.byte	0
+	.uleb128 0x9
+	.long	0x6f5
+	.uleb128 0x1c
+	.long	0x171
+	.long	0x719
+	.uleb128 0x4
+	.long	0x6d7
+	.byte	0
+	.uleb128 0x9
+	.long	0x70a
+	.uleb128 0x14
+	.long	0x72e
+	.uleb128 0x4
+	.long	0x6be
+	.uleb128 0x4
+	.long	0x3fe
+	.byte	0
+	.uleb128 0x9
+	.long	0x71e
+	.uleb128 0x14
+	.long	0x748
+	.uleb128 0x4
+	.long	0x6be
+	.uleb128 0x4
+	.long	0x748
+	.uleb128 0x4
+	.long	0x3c
+	.byte	0
+	.uleb128 0x9
+	.long	0x74d
+	.uleb128 0x2a
+	.uleb128 0x9
+	.long	0x733
+	.uleb128 0x1c
+	.long	0x171
+	.long	0x762
+	.uleb128 0x4
+	.long	0x6be
+	.byte	0
+	.uleb128 0x9
+	.long	0x753
+	.uleb128 0x14
+	.long	0x772
+	.uleb128 0x4
+	.long	0x6be
+	.byte	0
+	.uleb128 0x9
+	.long	0x767
+	.uleb128 0x14
+	.long	0x78c
+	.uleb128 0x4
+	.long	0x6be
+	.uleb128 0x4
+	.long	0x78c
+	.uleb128 0x4
+	.long	0x3c
+	.byte	0
+	.uleb128 0x9
+	.long	0x4a0
+	.uleb128 0x9
+	.long	0x777
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x51
+	.byte	0xb
+	.byte	0x20
+	.byte	0xe
+	.long	0x851
+	.uleb128 0x1
+	.long	.LASF1646
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1647
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1648
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1649
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1650
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1651
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1652
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1653
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF1654
+	.byte	0x80
+	.uleb128 0x15
+	.long	.LASF1655
+	.value	0x100
+	.uleb128 0x15
+	.long	.LASF1656
+	.value	0x200
+	.uleb128 0x15
+	.long	.LASF1657
+	.value	0x400
+	.uleb128 0x15
+	.long	.LASF1658
+	.value	0x800
+	.uleb128 0x15
+	.long	.LASF1659
+	.value	0x1000
+	.uleb128 0x15
+	.long	.LASF1660
+	.value	0x2000
+	.uleb128 0x15
+	.long	.LASF1661
+	.value	0x4000
+	.uleb128 0x15
+	.long	.LASF1662
+	.value	0x8000
+	.uleb128 0x17
+	.long	.LASF1663
+	.long	0x10000
+	.uleb128 0x17
+	.long	.LASF1664
+	.long	0x20000
+	.uleb128 0x17
+	.long	.LASF1665
+	.long	0x40000
+	.uleb128 0x17
+	.long	.LASF1666
+	.long	0x80000
+	.uleb128 0x17
+	.long	.LASF1667
+	.long	0x100000
+	.uleb128 0x17
+	.long	.LASF1668
+	.long	0x200000
+	.uleb128 0x17
+	.long	.LASF1669
+	.long	0x400000
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1670
+	.byte	0xb
+	.byte	0x39
+	.byte	0x3
+	.long	0x796
+	.uleb128 0xd
+	.byte	0x5
+	.long	0x3c
+	.byte	0xb
+	.byte	0x52
+	.byte	0xe
+	.long	0x8b9
+	.uleb128 0x2b
+	.long	.LASF1671
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF1672
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1673
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1674
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1675
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1676
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1678
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1679
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1680
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1681
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1682
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1683
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1684
+	.byte	0xb
+	.byte	0x60
+	.byte	0x3
+	.long	0x85d
+	.uleb128 0xb
+	.long	.LASF1685
+	.byte	0xc
+	.byte	0xb
+	.byte	0x73
+	.byte	0x10
+	.long	0x921
+	.uleb128 0x3
+	.long	.LASF1686
+	.byte	0xb
+	.byte	0x74
+	.byte	0xe
+	.long	0xba
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1615
+	.byte	0xb
+	.byte	0x75
+	.byte	0x1c
+	.long	0x8b9
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1687
+	.byte	0xb
+	.byte	0x76
+	.byte	0xd
+	.long	0x98
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1688
+	.byte	0xb
+	.byte	0x77
+	.byte	0xd
+	.long	0x98
+	.byte	0x9
+	.uleb128 0x3
+	.long	.LASF1689
+	.byte	0xb
+	.byte	0x78
+	.byte	0xd
+	.long	0x98
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1690
+	.byte	0xb
+	.byte	0x79
+	.byte	0xd
+	.long	0x98
+	.byte	0xb
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1691
+	.byte	0xb
+	.byte	0x7a
+	.byte	0x3
+	.long	0x8c5
+	.uleb128 0x12
+	.long	0x921
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x51
+	.byte	0xc
+	.byte	0x33
+	.byte	0x1
+	.long	0xa96
+	.uleb128 0x1
+	.long	.LASF1692
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1693
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1694
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1695
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1696
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1698
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1699
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1700
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1701
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1702
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1703
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1704
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1705
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1706
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1707
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1708
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1709
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1710
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1711
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1712
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1713
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1714
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1715
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF1716
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF1717
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF1718
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF1719
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF1720
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF1721
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF1722
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF1723
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF1724
+	.byte	0x31
+	.uleb128 0x1
+	.long	.LASF1725
+	.byte	0x32
+	.uleb128 0x1
+	.long	.LASF1726
+	.byte	0x33
+	.uleb128 0x1
+	.long	.LASF1727
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF1728
+	.byte	0x35
+	.uleb128 0x1
+	.long	.LASF1729
+	.byte	0x36
+	.uleb128 0x1
+	.long	.LASF1730
+	.byte	0x37
+	.uleb128 0x1
+	.long	.LASF1731
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF1732
+	.byte	0x39
+	.uleb128 0x1
+	.long	.LASF1733
+	.byte	0x3a
+	.uleb128 0x1
+	.long	.LASF1734
+	.byte	0x3b
+	.uleb128 0x1
+	.long	.LASF1735
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF1736
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF1737
+	.byte	0x51
+	.uleb128 0x1
+	.long	.LASF1738
+	.byte	0x52
+	.uleb128 0x1
+	.long	.LASF1739
+	.byte	0x53
+	.uleb128 0x1
+	.long	.LASF1740
+	.byte	0x54
+	.uleb128 0x1
+	.long	.LASF1741
+	.byte	0x55
+	.uleb128 0x1
+	.long	.LASF1742
+	.byte	0x56
+	.uleb128 0x1
+	.long	.LASF1743
+	.byte	0x57
+	.uleb128 0x1
+	.long	.LASF1744
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF1745
+	.byte	0x64
+	.uleb128 0x1
+	.long	.LASF1746
+	.byte	0x65
+	.uleb128 0x1
+	.long	.LASF1747
+	.byte	0x6e
+	.uleb128 0x1
+	.long	.LASF1748
+	.byte	0x6f
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1749
+	.byte	0xc
+	.byte	0x75
+	.byte	0x3
+	.long	0x932
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x51
+	.byte	0xc
+	.byte	0x77
+	.byte	0xe
+	.long	0xad4
+	.uleb128 0x1
+	.long	.LASF1750
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1751
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1752
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1753
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1754
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1755
+	.byte	0x5
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1756
+	.byte	0xc
+	.byte	0x7e
+	.byte	0x3
+	.long	0xaa2
+	.uleb128 0xb
+	.long	.LASF1757
+	.byte	0x11
+	.byte	0xc
+	.byte	0x80
+	.byte	0x10
+	.long	0xb8a
+	.uleb128 0x3
+	.long	.LASF1758
+	.byte	0xc
+	.byte	0x81
+	.byte	0xd
+	.long	0xb8a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1759
+	.byte	0xc
+	.byte	0x82
+	.byte	0xd
+	.long	0x98
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1760
+	.byte	0xc
+	.byte	0x83
+	.byte	0xd
+	.long	0x98
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1761
+	.byte	0xc
+	.byte	0x84
+	.byte	0xd
+	.long	0x98
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF1762
+	.byte	0xc
+	.byte	0x85
+	.byte	0xd
+	.long	0x98
+	.byte	0x6
+	.uleb128 0x3
+	.long	.LASF1763
+	.byte	0xc
+	.byte	0x86
+	.byte	0xd
+	.long	0x98
+	.byte	0x7
+	.uleb128 0x3
+	.long	.LASF1764
+	.byte	0xc
+	.byte	0x87
+	.byte	0xe
+	.long	0xae
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1765
+	.byte	0xc
+	.byte	0x88
+	.byte	0xe
+	.long	0xae
+	.byte	0xa
+	.uleb128 0x3
+	.long	.LASF1766
+	.byte	0xc
+	.byte	0x89
+	.byte	0xd
+	.long	0x98
+	.byte	0xc
+	.uleb128 0x3
+	.long	.LASF1767
+	.byte	0xc
+	.byte	0x8a
+	.byte	0xd
+	.long	0x98
+	.byte	0xd
+	.uleb128 0x3
+	.long	.LASF1768
+	.byte	0xc
+	.byte	0x8b
+	.byte	0xe
+	.long	0xae
+	.byte	0xe
+	.uleb128 0x3
+	.long	.LASF1769
+	.byte	0xc
+	.byte	0x8c
+	.byte	0xd
+	.long	0x98
+	.byte	0x10
+	.byte	0
+	.uleb128 0x10
+	.long	0x98
+	.long	0xb9a
+	.uleb128 0x11
+	.long	0x35
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1770
+	.byte	0xc
+	.byte	0x8d
+	.byte	0x1b
+	.long	0xae0
+	.uleb128 0x12
+	.long	0xb9a
+	.uleb128 0x18
+	.byte	0x40
+	.byte	0x91
+	.byte	0x5
+	.long	0xbce
+	.uleb128 0x3
+	.long	.LASF1771
+	.byte	0xc
+	.byte	0x92
+	.byte	0x11
+	.long	0xbce
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1772
+	.byte	0xc
+	.byte	0x93
+	.byte	0x11
+	.long	0xbde
+	.byte	0x36
+	.byte	0
+	.uleb128 0x10
+	.long	0x98
+	.long	0xbde
+	.uleb128 0x11
+	.long	0x35
+	.byte	0x35
+	.byte	0
+	.uleb128 0x10
+	.long	0x98
+	.long	0xbee
+	.uleb128 0x11
+	.long	0x35
+	.byte	0x9
+	.byte	0
+	.uleb128 0xb
+	.long	.LASF1773
+	.byte	0x42
+	.byte	0xc
+	.byte	0x8f
+	.byte	0x10
+	.long	0xc16
+	.uleb128 0x3
+	.long	.LASF1774
+	.byte	0xc
+	.byte	0x90
+	.byte	0xe
+	.long	0xae
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1608
+	.byte	0xc
+	.byte	0x94
+	.byte	0x7
+	.long	0xbab
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1775
+	.byte	0xc
+	.byte	0x95
+	.byte	0x1b
+	.long	0xbee
+	.uleb128 0x12
+	.long	0xc16
+	.uleb128 0xb
+	.long	.LASF1776
+	.byte	0x3
+	.byte	0xc
+	.byte	0x9e
+	.byte	0x10
+	.long	0xc58
+	.uleb128 0xc
+	.string	"gx"
+	.byte	0x9f
+	.byte	0xd
+	.long	0x98
+	.byte	0
+	.uleb128 0xc
+	.string	"gy"
+	.byte	0xa0
+	.byte	0xd
+	.long	0x98
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1777
+	.byte	0xc
+	.byte	0xa1
+	.byte	0xd
+	.long	0x98
+	.byte	0x2
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1778
+	.byte	0xc
+	.byte	0xa3
+	.byte	0x1b
+	.long	0xc27
+	.uleb128 0xb
+	.long	.LASF1779
+	.byte	0x3
+	.byte	0xc
+	.byte	0xa5
+	.byte	0x10
+	.long	0xc84
+	.uleb128 0x1d
+	.string	"x"
+	.byte	0xa6
+	.long	0x3c
+	.byte	0
+	.uleb128 0x1d
+	.string	"y"
+	.byte	0xa7
+	.long	0x3c
+	.byte	0xc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1780
+	.byte	0xc
+	.byte	0xa8
+	.byte	0x1b
+	.long	0xc64
+	.uleb128 0xb
+	.long	.LASF1781
+	.byte	0x3
+	.byte	0xc
+	.byte	0xaa
+	.byte	0x10
+	.long	0xcb0
+	.uleb128 0x1d
+	.string	"w"
+	.byte	0xab
+	.long	0x3c
+	.byte	0
+	.uleb128 0x1d
+	.string	"h"
+	.byte	0xac
+	.long	0x3c
+	.byte	0xc
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1782
+	.byte	0xc
+	.byte	0xad
+	.byte	0x1b
+	.long	0xc90
+	.uleb128 0xb
+	.long	.LASF1783
+	.byte	0x6
+	.byte	0xc
+	.byte	0xaf
+	.byte	0x10
+	.long	0xce4
+	.uleb128 0x3
+	.long	.LASF1784
+	.byte	0xc
+	.byte	0xb0
+	.byte	0x15
+	.long	0xc84
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1785
+	.byte	0xc
+	.byte	0xb1
+	.byte	0x14
+	.long	0xcb0
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1786
+	.byte	0xc
+	.byte	0xb2
+	.byte	0x1b
+	.long	0xcbc
+	.uleb128 0xb
+	.long	.LASF1787
+	.byte	0x9
+	.byte	0xc
+	.byte	0xb4
+	.byte	0x10
+	.long	0xd1f
+	.uleb128 0xc
+	.string	"p1"
+	.byte	0xb5
+	.byte	0x15
+	.long	0xc84
+	.byte	0
+	.uleb128 0xc
+	.string	"p2"
+	.byte	0xb6
+	.byte	0x15
+	.long	0xc84
+	.byte	0x3
+	.uleb128 0xc
+	.string	"p3"
+	.byte	0xb7
+	.byte	0x15
+	.long	0xc84
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1788
+	.byte	0xc
+	.byte	0xb8
+	.byte	0x1b
+	.long	0xcf0
+	.uleb128 0xb
+	.long	.LASF1789
+	.byte	0x4
+	.byte	0xc
+	.byte	0xba
+	.byte	0x10
+	.long	0xd50
+	.uleb128 0xc
+	.string	"p"
+	.byte	0xbb
+	.byte	0x15
+	.long	0xc84
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1790
+	.byte	0xc
+	.byte	0xbc
+	.byte	0xd
+	.long	0x98
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1791
+	.byte	0xc
+	.byte	0xbd
+	.byte	0x1b
+	.long	0xd2b
+	.uleb128 0xb
+	.long	.LASF1792
+	.byte	0x6
+	.byte	0xc
+	.byte	0xbf
+	.byte	0x10
+	.long	0xd8d
+	.uleb128 0xc
+	.string	"p"
+	.byte	0xc0
+	.byte	0x15
+	.long	0xc84
+	.byte	0
+	.uleb128 0xc
+	.string	"chr"
+	.byte	0xc1
+	.byte	0xe
+	.long	0xae
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1777
+	.byte	0xc
+	.byte	0xc2
+	.byte	0xd
+	.long	0x98
+	.byte	0x5
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1793
+	.byte	0xc
+	.byte	0xc3
+	.byte	0x1b
+	.long	0xd5c
+	.uleb128 0xb
+	.long	.LASF1794
+	.byte	0x7
+	.byte	0xc
+	.byte	0xc5
+	.byte	0x10
+	.long	0xdbf
+	.uleb128 0xc
+	.string	"dc"
+	.byte	0xc6
+	.byte	0x20
+	.long	0xd8d
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1795
+	.byte	0xc
+	.byte	0xc7
+	.byte	0xd
+	.long	0x98
+	.byte	0x6
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1796
+	.byte	0xc
+	.byte	0xc8
+	.byte	0x1b
+	.long	0xd99
+	.uleb128 0xb
+	.long	.LASF1797
+	.byte	0x4
+	.byte	0xc
+	.byte	0xca
+	.byte	0x10
+	.long	0xdf0
+	.uleb128 0xc
+	.string	"p"
+	.byte	0xcb
+	.byte	0x15
+	.long	0xc84
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1777
+	.byte	0xc
+	.byte	0xcc
+	.byte	0xd
+	.long	0x98
+	.byte	0x3
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1798
+	.byte	0xc
+	.byte	0xce
+	.byte	0x1b
+	.long	0xdcb
+	.uleb128 0xb
+	.long	.LASF1799
+	.byte	0x5
+	.byte	0xc
+	.byte	0xd0
+	.byte	0x10
+	.long	0xe2e
+	.uleb128 0xc
+	.string	"p"
+	.byte	0xd1
+	.byte	0x15
+	.long	0xc84
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1777
+	.byte	0xc
+	.byte	0xd2
+	.byte	0xd
+	.long	0x98
+	.byte	0x3
+	.uleb128 0x3
+	.long	.LASF1795
+	.byte	0xc
+	.byte	0xd3
+	.byte	0xd
+	.long	0x98
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1800
+	.byte	0xc
+	.byte	0xd5
+	.byte	0x1b
+	.long	0xdfc
+	.uleb128 0x18
+	.byte	0xc1
+	.byte	0xd9
+	.byte	0x5
+	.long	0xe5c
+	.uleb128 0x3
+	.long	.LASF1608
+	.byte	0xc
+	.byte	0xda
+	.byte	0x11
+	.long	0xe5c
+	.byte	0
+	.uleb128 0xc
+	.string	"pos"
+	.byte	0xdb
+	.byte	0x11
+	.long	0x98
+	.byte	0xc0
+	.byte	0
+	.uleb128 0x10
+	.long	0x98
+	.long	0xe6c
+	.uleb128 0x11
+	.long	0x35
+	.byte	0xbf
+	.byte	0
+	.uleb128 0x18
+	.byte	0x86
+	.byte	0xdd
+	.byte	0x5
+	.long	0xec1
+	.uleb128 0x3
+	.long	.LASF1801
+	.byte	0xc
+	.byte	0xde
+	.byte	0x11
+	.long	0x98
+	.byte	0
+	.uleb128 0xc
+	.string	"crc"
+	.byte	0xdf
+	.byte	0x11
+	.long	0x98
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1802
+	.byte	0xc
+	.byte	0xe0
+	.byte	0x12
+	.long	0xae
+	.byte	0x2
+	.uleb128 0x3
+	.long	.LASF1803
+	.byte	0xc
+	.byte	0xe1
+	.byte	0x11
+	.long	0x98
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1608
+	.byte	0xc
+	.byte	0xe2
+	.byte	0x11
+	.long	0xec1
+	.byte	0x5
+	.uleb128 0xc
+	.string	"pos"
+	.byte	0xe3
+	.byte	0x11
+	.long	0x98
+	.byte	0x85
+	.byte	0
+	.uleb128 0x10
+	.long	0x98
+	.long	0xed1
+	.uleb128 0x11
+	.long	0x35
+	.byte	0x7f
+	.byte	0
+	.uleb128 0x18
+	.byte	0x2
+	.byte	0xe9
+	.byte	0x9
+	.long	0xef4
+	.uleb128 0x3
+	.long	.LASF1804
+	.byte	0xc
+	.byte	0xea
+	.byte	0x15
+	.long	0x98
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1805
+	.byte	0xc
+	.byte	0xeb
+	.byte	0x15
+	.long	0x98
+	.byte	0x1
+	.byte	0
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0xed
+	.byte	0x9
+	.long	0xf17
+	.uleb128 0x3
+	.long	.LASF1806
+	.byte	0xc
+	.byte	0xee
+	.byte	0x16
+	.long	0xae
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1807
+	.byte	0xc
+	.byte	0xef
+	.byte	0x16
+	.long	0xae
+	.byte	0x2
+	.byte	0
+	.uleb128 0x18
+	.byte	0x10
+	.byte	0xe5
+	.byte	0x5
+	.long	0xf61
+	.uleb128 0x3
+	.long	.LASF1808
+	.byte	0xc
+	.byte	0xe6
+	.byte	0x11
+	.long	0x98
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1809
+	.byte	0xc
+	.byte	0xe7
+	.byte	0x11
+	.long	0x98
+	.byte	0x1
+	.uleb128 0x3
+	.long	.LASF1810
+	.byte	0xc
+	.byte	0xe8
+	.byte	0x12
+	.long	0x139
+	.byte	0x4
+	.uleb128 0x3
+	.long	.LASF1811
+	.byte	0xc
+	.byte	0xec
+	.byte	0xb
+	.long	0xed1
+	.byte	0x8
+	.uleb128 0x3
+	.long	.LASF1812
+	.byte	0xc
+	.byte	0xf0
+	.byte	0xb
+	.long	0xef4
+	.byte	0xa
+	.byte	0
+	.uleb128 0x18
+	.byte	0x10
+	.byte	0xf2
+	.byte	0x5
+	.long	0xf83
+	.uleb128 0x3
+	.long	.LASF1774
+	.byte	0xc
+	.byte	0xf3
+	.byte	0x12
+	.long	0xae
+	.byte	0
+	.uleb128 0xc
+	.string	"chr"
+	.byte	0xf4
+	.byte	0x19
+	.long	0xf83
+	.byte	0x8
+	.byte	0
+	.uleb128 0x9
+	.long	0x145
+	.uleb128 0x2c
+	.long	.LASF1813
+	.value	0x178
+	.byte	0xc
+	.byte	0xd8
+	.byte	0x10
+	.long	0xff2
+	.uleb128 0x3
+	.long	.LASF1814
+	.byte	0xc
+	.byte	0xdc
+	.byte	0x7
+	.long	0xe3a
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1815
+	.byte	0xc
+	.byte	0xe4
+	.byte	0x7
+	.long	0xe6c
+	.byte	0xc2
+	.uleb128 0x1a
+	.long	.LASF1816
+	.byte	0xf1
+	.byte	0x7
+	.long	0xf17
+	.value	0x148
+	.uleb128 0x1a
+	.long	.LASF1817
+	.byte	0xf5
+	.byte	0x7
+	.long	0xf61
+	.value	0x158
+	.uleb128 0x1a
+	.long	.LASF1818
+	.byte	0xf6
+	.byte	0x13
+	.long	0x6be
+	.value	0x168
+	.uleb128 0x1a
+	.long	.LASF1819
+	.byte	0xf7
+	.byte	0x9
+	.long	0x171
+	.value	0x170
+	.uleb128 0x1a
+	.long	.LASF1820
+	.byte	0xf8
+	.byte	0xe
+	.long	0x139
+	.value	0x174
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF1821
+	.byte	0xc
+	.byte	0xf9
+	.byte	0x3
+	.long	0xf88
+	.uleb128 0x2d
+	.long	.LASF1801
+	.byte	0xc
+	.byte	0xfb
+	.byte	0x18
+	.long	0xff2
+	.uleb128 0x2e
+	.long	.LASF1889
+	.byte	0x7
+	.byte	0x47
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF1822
+	.byte	0xd
+	.value	0x197
+	.byte	0xf
+	.long	0x29
+	.long	0x1029
+	.uleb128 0x4
+	.long	0xc6
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1823
+	.byte	0x7
+	.byte	0x4a
+	.byte	0xb
+	.long	0x184
+	.long	0x1044
+	.uleb128 0x4
+	.long	0x51
+	.uleb128 0x4
+	.long	0x51
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1632
+	.byte	0xa
+	.byte	0x78
+	.long	0x105a
+	.uleb128 0x4
+	.long	0x6be
+	.uleb128 0x4
+	.long	0x98
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1824
+	.byte	0xa
+	.byte	0x7a
+	.byte	0xa
+	.long	0xba
+	.long	0x1070
+	.uleb128 0x4
+	.long	0x6d7
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1825
+	.byte	0xe
+	.byte	0x20
+	.byte	0x5
+	.long	0x3c
+	.long	0x1090
+	.uleb128 0x4
+	.long	0xba
+	.uleb128 0x4
+	.long	0xcb
+	.uleb128 0x4
+	.long	0x29
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1826
+	.byte	0xd
+	.byte	0x2b
+	.byte	0xe
+	.long	0x8a
+	.long	0x10b0
+	.uleb128 0x4
+	.long	0x8a
+	.uleb128 0x4
+	.long	0x748
+	.uleb128 0x4
+	.long	0x29
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1827
+	.byte	0xf
+	.byte	0x1c
+	.byte	0x9
+	.long	0x98
+	.long	0x10cb
+	.uleb128 0x4
+	.long	0x98
+	.uleb128 0x4
+	.long	0x43
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1828
+	.byte	0xa
+	.byte	0x79
+	.byte	0xa
+	.long	0xba
+	.long	0x10e1
+	.uleb128 0x4
+	.long	0x6d7
+	.byte	0
+	.uleb128 0x22
+	.long	.LASF1829
+	.byte	0x4
+	.byte	0x2f
+	.long	0x10fd
+	.uleb128 0x4
+	.long	0x126
+	.uleb128 0x4
+	.long	0x51
+	.uleb128 0x4
+	.long	0xc6
+	.uleb128 0x30
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1635
+	.byte	0xa
+	.byte	0x7e
+	.byte	0x9
+	.long	0x98
+	.long	0x1113
+	.uleb128 0x4
+	.long	0x6be
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF1933
+	.byte	0x10
+	.byte	0x1d
+	.byte	0xa
+	.long	0x139
+	.uleb128 0x13
+	.long	.LASF1830
+	.byte	0xb
+	.byte	0x9a
+	.byte	0xf
+	.long	0x6be
+	.long	0x1153
+	.uleb128 0x4
+	.long	0x8b9
+	.uleb128 0x4
+	.long	0x851
+	.uleb128 0x4
+	.long	0x4a5
+	.uleb128 0x4
+	.long	0x8a
+	.uleb128 0x4
+	.long	0xba
+	.uleb128 0x4
+	.long	0x3fe
+	.uleb128 0x4
+	.long	0x45b
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF1831
+	.byte	0xb
+	.byte	0x8f
+	.byte	0x15
+	.long	0x1169
+	.long	0x1169
+	.uleb128 0x4
+	.long	0x851
+	.byte	0
+	.uleb128 0x9
+	.long	0x921
+	.uleb128 0x19
+	.long	.LASF1832
+	.value	0x3d9
+	.uleb128 0x19
+	.long	.LASF1833
+	.value	0x3d4
+	.uleb128 0x8
+	.long	.LASF1834
+	.value	0x3cf
+	.long	0x1192
+	.uleb128 0x2
+	.string	"r"
+	.value	0x3cf
+	.byte	0x1e
+	.long	0x132
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1835
+	.value	0x3c6
+	.long	0x11c0
+	.uleb128 0x2
+	.string	"sx"
+	.value	0x3c6
+	.byte	0x1d
+	.long	0x132
+	.uleb128 0x2
+	.string	"sy"
+	.value	0x3c6
+	.byte	0x27
+	.long	0x132
+	.uleb128 0xa
+	.long	.LASF1836
+	.value	0x3c8
+	.byte	0xb
+	.long	0x11c0
+	.byte	0
+	.uleb128 0x10
+	.long	0x132
+	.long	0x11d0
+	.uleb128 0x11
+	.long	0x35
+	.byte	0x1
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1837
+	.value	0x3bd
+	.long	0x11fe
+	.uleb128 0x2
+	.string	"tx"
+	.value	0x3bd
+	.byte	0x21
+	.long	0x132
+	.uleb128 0x2
+	.string	"ty"
+	.value	0x3bd
+	.byte	0x2b
+	.long	0x132
+	.uleb128 0xa
+	.long	.LASF1836
+	.value	0x3bf
+	.byte	0xb
+	.long	0x11c0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1838
+	.value	0x3b3
+	.long	0x125e
+	.uleb128 0x2
+	.string	"m11"
+	.value	0x3b3
+	.byte	0x1b
+	.long	0x132
+	.uleb128 0x2
+	.string	"m12"
+	.value	0x3b3
+	.byte	0x26
+	.long	0x132
+	.uleb128 0x2
+	.string	"m21"
+	.value	0x3b3
+	.byte	0x31
+	.long	0x132
+	.uleb128 0x2
+	.string	"m22"
+	.value	0x3b3
+	.byte	0x3c
+	.long	0x132
+	.uleb128 0x2
+	.string	"m31"
+	.value	0x3b3
+	.byte	0x47
+	.long	0x132
+	.uleb128 0x2
+	.string	"m32"
+	.value	0x3b3
+	.byte	0x52
+	.long	0x132
+	.uleb128 0xa
+	.long	.LASF1836
+	.value	0x3b5
+	.byte	0xb
+	.long	0x125e
+	.byte	0
+	.uleb128 0x10
+	.long	0x132
+	.long	0x126e
+	.uleb128 0x11
+	.long	0x35
+	.byte	0x5
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1839
+	.value	0x3ae
+	.uleb128 0x8
+	.long	.LASF1840
+	.value	0x3a8
+	.long	0x12b3
+	.uleb128 0x2
+	.string	"x"
+	.value	0x3a8
+	.byte	0x2a
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x3a8
+	.byte	0x31
+	.long	0x3c
+	.uleb128 0x2
+	.string	"w"
+	.value	0x3a8
+	.byte	0x38
+	.long	0x3c
+	.uleb128 0x2
+	.string	"h"
+	.value	0x3a8
+	.byte	0x3f
+	.long	0x3c
+	.uleb128 0x5
+	.string	"r"
+	.value	0x3aa
+	.byte	0x14
+	.long	0xce4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1841
+	.value	0x3a2
+	.long	0x12f1
+	.uleb128 0x2
+	.string	"x"
+	.value	0x3a2
+	.byte	0x24
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x3a2
+	.byte	0x2b
+	.long	0x3c
+	.uleb128 0x2
+	.string	"w"
+	.value	0x3a2
+	.byte	0x32
+	.long	0x3c
+	.uleb128 0x2
+	.string	"h"
+	.value	0x3a2
+	.byte	0x39
+	.long	0x3c
+	.uleb128 0x5
+	.string	"r"
+	.value	0x3a4
+	.byte	0x14
+	.long	0xce4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1842
+	.value	0x39c
+	.long	0x132f
+	.uleb128 0x2
+	.string	"x"
+	.value	0x39c
+	.byte	0x26
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x39c
+	.byte	0x2d
+	.long	0x3c
+	.uleb128 0x2
+	.string	"w"
+	.value	0x39c
+	.byte	0x34
+	.long	0x3c
+	.uleb128 0x2
+	.string	"h"
+	.value	0x39c
+	.byte	0x3b
+	.long	0x3c
+	.uleb128 0x5
+	.string	"r"
+	.value	0x39e
+	.byte	0x14
+	.long	0xce4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1843
+	.value	0x396
+	.long	0x136d
+	.uleb128 0x2
+	.string	"x"
+	.value	0x396
+	.byte	0x21
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x396
+	.byte	0x28
+	.long	0x3c
+	.uleb128 0x2
+	.string	"w"
+	.value	0x396
+	.byte	0x2f
+	.long	0x3c
+	.uleb128 0x2
+	.string	"h"
+	.value	0x396
+	.byte	0x36
+	.long	0x3c
+	.uleb128 0x5
+	.string	"r"
+	.value	0x398
+	.byte	0x14
+	.long	0xce4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1844
+	.value	0x390
+	.long	0x13ab
+	.uleb128 0x2
+	.string	"x"
+	.value	0x390
+	.byte	0x1b
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x390
+	.byte	0x22
+	.long	0x3c
+	.uleb128 0x2
+	.string	"w"
+	.value	0x390
+	.byte	0x29
+	.long	0x3c
+	.uleb128 0x2
+	.string	"h"
+	.value	0x390
+	.byte	0x30
+	.long	0x3c
+	.uleb128 0x5
+	.string	"r"
+	.value	0x392
+	.byte	0x14
+	.long	0xce4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1845
+	.value	0x38a
+	.long	0x13e9
+	.uleb128 0x2
+	.string	"x"
+	.value	0x38a
+	.byte	0x1d
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x38a
+	.byte	0x24
+	.long	0x3c
+	.uleb128 0x2
+	.string	"w"
+	.value	0x38a
+	.byte	0x2b
+	.long	0x3c
+	.uleb128 0x2
+	.string	"h"
+	.value	0x38a
+	.byte	0x32
+	.long	0x3c
+	.uleb128 0x5
+	.string	"r"
+	.value	0x38c
+	.byte	0x14
+	.long	0xce4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1846
+	.value	0x384
+	.long	0x1441
+	.uleb128 0x2
+	.string	"x1"
+	.value	0x384
+	.byte	0x25
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y1"
+	.value	0x384
+	.byte	0x2d
+	.long	0x3c
+	.uleb128 0x2
+	.string	"x2"
+	.value	0x384
+	.byte	0x35
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y2"
+	.value	0x384
+	.byte	0x3d
+	.long	0x3c
+	.uleb128 0x2
+	.string	"x3"
+	.value	0x384
+	.byte	0x45
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y3"
+	.value	0x384
+	.byte	0x4d
+	.long	0x3c
+	.uleb128 0x5
+	.string	"t"
+	.value	0x386
+	.byte	0x18
+	.long	0xd1f
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1847
+	.value	0x37e
+	.long	0x1499
+	.uleb128 0x2
+	.string	"x1"
+	.value	0x37e
+	.byte	0x1f
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y1"
+	.value	0x37e
+	.byte	0x27
+	.long	0x3c
+	.uleb128 0x2
+	.string	"x2"
+	.value	0x37e
+	.byte	0x2f
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y2"
+	.value	0x37e
+	.byte	0x37
+	.long	0x3c
+	.uleb128 0x2
+	.string	"x3"
+	.value	0x37e
+	.byte	0x3f
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y3"
+	.value	0x37e
+	.byte	0x47
+	.long	0x3c
+	.uleb128 0x5
+	.string	"t"
+	.value	0x380
+	.byte	0x18
+	.long	0xd1f
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1848
+	.value	0x378
+	.long	0x14f1
+	.uleb128 0x2
+	.string	"x1"
+	.value	0x378
+	.byte	0x21
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y1"
+	.value	0x378
+	.byte	0x29
+	.long	0x3c
+	.uleb128 0x2
+	.string	"x2"
+	.value	0x378
+	.byte	0x31
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y2"
+	.value	0x378
+	.byte	0x39
+	.long	0x3c
+	.uleb128 0x2
+	.string	"x3"
+	.value	0x378
+	.byte	0x41
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y3"
+	.value	0x378
+	.byte	0x49
+	.long	0x3c
+	.uleb128 0x5
+	.string	"t"
+	.value	0x37a
+	.byte	0x18
+	.long	0xd1f
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1849
+	.value	0x372
+	.long	0x151b
+	.uleb128 0x2
+	.string	"x"
+	.value	0x372
+	.byte	0x24
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x372
+	.byte	0x2b
+	.long	0x3c
+	.uleb128 0x5
+	.string	"p"
+	.value	0x374
+	.byte	0x15
+	.long	0xc84
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1850
+	.value	0x36c
+	.long	0x1545
+	.uleb128 0x2
+	.string	"x"
+	.value	0x36c
+	.byte	0x1e
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x36c
+	.byte	0x25
+	.long	0x3c
+	.uleb128 0x5
+	.string	"p"
+	.value	0x36e
+	.byte	0x15
+	.long	0xc84
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1851
+	.value	0x361
+	.long	0x1593
+	.uleb128 0x2
+	.string	"x"
+	.value	0x361
+	.byte	0x21
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x361
+	.byte	0x28
+	.long	0x3c
+	.uleb128 0x2
+	.string	"s"
+	.value	0x361
+	.byte	0x37
+	.long	0xc6
+	.uleb128 0x7
+	.long	.LASF1790
+	.value	0x361
+	.byte	0x4a
+	.long	0x21b
+	.uleb128 0x7
+	.long	.LASF1777
+	.value	0x361
+	.byte	0x59
+	.long	0x98
+	.uleb128 0x5
+	.string	"cmd"
+	.value	0x363
+	.byte	0x2b
+	.long	0xe2e
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1852
+	.value	0x357
+	.long	0x15d5
+	.uleb128 0x2
+	.string	"x"
+	.value	0x357
+	.byte	0x1d
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x357
+	.byte	0x24
+	.long	0x3c
+	.uleb128 0x2
+	.string	"s"
+	.value	0x357
+	.byte	0x33
+	.long	0xc6
+	.uleb128 0x7
+	.long	.LASF1777
+	.value	0x357
+	.byte	0x3e
+	.long	0x98
+	.uleb128 0x5
+	.string	"cmd"
+	.value	0x359
+	.byte	0x27
+	.long	0xdf0
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1853
+	.value	0x351
+	.long	0x1624
+	.uleb128 0x2
+	.string	"x"
+	.value	0x351
+	.byte	0x24
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x351
+	.byte	0x2b
+	.long	0x3c
+	.uleb128 0x2
+	.string	"chr"
+	.value	0x351
+	.byte	0x37
+	.long	0xae
+	.uleb128 0x7
+	.long	.LASF1790
+	.value	0x351
+	.byte	0x4c
+	.long	0x21b
+	.uleb128 0x7
+	.long	.LASF1777
+	.value	0x351
+	.byte	0x5b
+	.long	0x98
+	.uleb128 0x5
+	.string	"dc"
+	.value	0x353
+	.byte	0x24
+	.long	0xdbf
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1854
+	.value	0x34b
+	.long	0x1667
+	.uleb128 0x2
+	.string	"x"
+	.value	0x34b
+	.byte	0x20
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x34b
+	.byte	0x27
+	.long	0x3c
+	.uleb128 0x2
+	.string	"chr"
+	.value	0x34b
+	.byte	0x33
+	.long	0xae
+	.uleb128 0x7
+	.long	.LASF1777
+	.value	0x34b
+	.byte	0x40
+	.long	0x98
+	.uleb128 0x5
+	.string	"dc"
+	.value	0x34d
+	.byte	0x20
+	.long	0xd8d
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1855
+	.value	0x346
+	.uleb128 0x8
+	.long	.LASF1856
+	.value	0x340
+	.long	0x16ac
+	.uleb128 0x2
+	.string	"x"
+	.value	0x340
+	.byte	0x1c
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x340
+	.byte	0x23
+	.long	0x3c
+	.uleb128 0x2
+	.string	"w"
+	.value	0x340
+	.byte	0x2a
+	.long	0x3c
+	.uleb128 0x2
+	.string	"h"
+	.value	0x340
+	.byte	0x31
+	.long	0x3c
+	.uleb128 0x5
+	.string	"r"
+	.value	0x342
+	.byte	0x14
+	.long	0xce4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1857
+	.value	0x33a
+	.long	0x16ea
+	.uleb128 0x2
+	.string	"x"
+	.value	0x33a
+	.byte	0x1d
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x33a
+	.byte	0x24
+	.long	0x3c
+	.uleb128 0x2
+	.string	"w"
+	.value	0x33a
+	.byte	0x2b
+	.long	0x3c
+	.uleb128 0x2
+	.string	"h"
+	.value	0x33a
+	.byte	0x32
+	.long	0x3c
+	.uleb128 0x5
+	.string	"r"
+	.value	0x33c
+	.byte	0x14
+	.long	0xce4
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1858
+	.value	0x334
+	.long	0x170e
+	.uleb128 0x7
+	.long	.LASF1859
+	.value	0x334
+	.byte	0x32
+	.long	0x21b
+	.uleb128 0xa
+	.long	.LASF1790
+	.value	0x336
+	.byte	0xd
+	.long	0x98
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1860
+	.value	0x32e
+	.long	0x1732
+	.uleb128 0x7
+	.long	.LASF1861
+	.value	0x32e
+	.byte	0x3b
+	.long	0x253
+	.uleb128 0xa
+	.long	.LASF1862
+	.value	0x330
+	.byte	0xd
+	.long	0x98
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1863
+	.value	0x328
+	.long	0x1754
+	.uleb128 0x7
+	.long	.LASF1806
+	.value	0x328
+	.byte	0x26
+	.long	0x51
+	.uleb128 0x5
+	.string	"w"
+	.value	0x32a
+	.byte	0xd
+	.long	0x98
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1864
+	.value	0x322
+	.long	0x177e
+	.uleb128 0x2
+	.string	"x"
+	.value	0x322
+	.byte	0x26
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x322
+	.byte	0x2d
+	.long	0x3c
+	.uleb128 0x5
+	.string	"p"
+	.value	0x324
+	.byte	0x15
+	.long	0xc84
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1865
+	.value	0x31c
+	.long	0x17a8
+	.uleb128 0x2
+	.string	"x"
+	.value	0x31c
+	.byte	0x28
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x31c
+	.byte	0x2f
+	.long	0x3c
+	.uleb128 0x5
+	.string	"p"
+	.value	0x31e
+	.byte	0x15
+	.long	0xc84
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1866
+	.value	0x316
+	.long	0x17df
+	.uleb128 0x2
+	.string	"x"
+	.value	0x316
+	.byte	0x1b
+	.long	0x3c
+	.uleb128 0x2
+	.string	"y"
+	.value	0x316
+	.byte	0x22
+	.long	0x3c
+	.uleb128 0x7
+	.long	.LASF1790
+	.value	0x316
+	.byte	0x35
+	.long	0x21b
+	.uleb128 0x5
+	.string	"sp"
+	.value	0x318
+	.byte	0x18
+	.long	0xd50
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1867
+	.value	0x310
+	.long	0x1801
+	.uleb128 0x7
+	.long	.LASF1868
+	.value	0x310
+	.byte	0x24
+	.long	0x171
+	.uleb128 0x5
+	.string	"c"
+	.value	0x312
+	.byte	0xd
+	.long	0x98
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1869
+	.value	0x30a
+	.long	0x1823
+	.uleb128 0x7
+	.long	.LASF1790
+	.value	0x30a
+	.byte	0x34
+	.long	0x21b
+	.uleb128 0x5
+	.string	"c"
+	.value	0x30c
+	.byte	0xd
+	.long	0x98
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1870
+	.value	0x304
+	.long	0x1845
+	.uleb128 0x7
+	.long	.LASF1790
+	.value	0x304
+	.byte	0x2b
+	.long	0x21b
+	.uleb128 0x5
+	.string	"c"
+	.value	0x306
+	.byte	0xd
+	.long	0x98
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1871
+	.value	0x2fe
+	.long	0x1867
+	.uleb128 0x7
+	.long	.LASF1790
+	.value	0x2fe
+	.byte	0x2d
+	.long	0x21b
+	.uleb128 0x5
+	.string	"c"
+	.value	0x300
+	.byte	0xd
+	.long	0x98
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1872
+	.value	0x2f8
+	.uleb128 0x1e
+	.long	.LASF1873
+	.value	0x2ef
+	.long	0x171
+	.long	0x18b4
+	.uleb128 0x2
+	.string	"x"
+	.value	0x2ef
+	.byte	0x25
+	.long	0x51
+	.uleb128 0x2
+	.string	"y"
+	.value	0x2ef
+	.byte	0x31
+	.long	0x51
+	.uleb128 0x2
+	.string	"c"
+	.value	0x2ef
+	.byte	0x3e
+	.long	0x184
+	.uleb128 0x7
+	.long	.LASF1874
+	.value	0x2ef
+	.byte	0x53
+	.long	0x189
+	.uleb128 0x5
+	.string	"val"
+	.value	0x2f1
+	.byte	0xe
+	.long	0xae
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1875
+	.value	0x2e1
+	.long	0x1904
+	.uleb128 0x2
+	.string	"x"
+	.value	0x2e1
+	.byte	0x26
+	.long	0x51
+	.uleb128 0x2
+	.string	"y"
+	.value	0x2e1
+	.byte	0x32
+	.long	0x51
+	.uleb128 0x2
+	.string	"chr"
+	.value	0x2e1
+	.byte	0x3e
+	.long	0xae
+	.uleb128 0x7
+	.long	.LASF1874
+	.value	0x2e1
+	.byte	0x54
+	.long	0x178
+	.uleb128 0xa
+	.long	.LASF1876
+	.value	0x2e3
+	.byte	0xf
+	.long	0x184
+	.uleb128 0x5
+	.string	"val"
+	.value	0x2e4
+	.byte	0xe
+	.long	0x51
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1877
+	.value	0x2bd
+	.long	0x198f
+	.uleb128 0x2
+	.string	"x"
+	.value	0x2bd
+	.byte	0x28
+	.long	0x51
+	.uleb128 0x2
+	.string	"y"
+	.value	0x2bd
+	.byte	0x34
+	.long	0x51
+	.uleb128 0x7
+	.long	.LASF1878
+	.value	0x2bd
+	.byte	0x43
+	.long	0xc6
+	.uleb128 0x7
+	.long	.LASF1874
+	.value	0x2bd
+	.byte	0x5a
+	.long	0x178
+	.uleb128 0xa
+	.long	.LASF1879
+	.value	0x2bf
+	.byte	0xe
+	.long	0x51
+	.uleb128 0xa
+	.long	.LASF1880
+	.value	0x2c0
+	.byte	0x11
+	.long	0xc6
+	.uleb128 0xa
+	.long	.LASF1876
+	.value	0x2c1
+	.byte	0xf
+	.long	0x184
+	.uleb128 0x5
+	.string	"p"
+	.value	0x2c2
+	.byte	0x11
+	.long	0xc6
+	.uleb128 0x5
+	.string	"xx"
+	.value	0x2c3
+	.byte	0xe
+	.long	0x51
+	.uleb128 0x5
+	.string	"cmd"
+	.value	0x2d9
+	.byte	0x24
+	.long	0xc58
+	.uleb128 0xe
+	.uleb128 0x5
+	.string	"val"
+	.value	0x2c5
+	.byte	0x12
+	.long	0x51
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1887
+	.value	0x2b2
+	.long	0x19ef
+	.uleb128 0x2
+	.string	"cmd"
+	.value	0x2b2
+	.byte	0x32
+	.long	0x98
+	.uleb128 0x7
+	.long	.LASF1881
+	.value	0x2b2
+	.byte	0x43
+	.long	0x748
+	.uleb128 0x7
+	.long	.LASF1882
+	.value	0x2b2
+	.byte	0x52
+	.long	0x29
+	.uleb128 0x7
+	.long	.LASF1883
+	.value	0x2b2
+	.byte	0x6a
+	.long	0x748
+	.uleb128 0x7
+	.long	.LASF1884
+	.value	0x2b2
+	.byte	0x77
+	.long	0x29
+	.uleb128 0xa
+	.long	.LASF1885
+	.value	0x2b4
+	.byte	0xd
+	.long	0xec1
+	.uleb128 0xa
+	.long	.LASF1886
+	.value	0x2b8
+	.byte	0x9
+	.long	0x3c
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1888
+	.value	0x2a6
+	.long	0x1a33
+	.uleb128 0x2
+	.string	"x"
+	.value	0x2a6
+	.byte	0x2d
+	.long	0x51
+	.uleb128 0x2
+	.string	"y"
+	.value	0x2a6
+	.byte	0x39
+	.long	0x51
+	.uleb128 0x2
+	.string	"chr"
+	.value	0x2a6
+	.byte	0x45
+	.long	0xae
+	.uleb128 0x7
+	.long	.LASF1874
+	.value	0x2a6
+	.byte	0x5b
+	.long	0x178
+	.uleb128 0xa
+	.long	.LASF1885
+	.value	0x2a8
+	.byte	0xd
+	.long	0x1a33
+	.byte	0
+	.uleb128 0x10
+	.long	0x98
+	.long	0x1a43
+	.uleb128 0x11
+	.long	0x35
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1b
+	.long	.LASF1890
+	.value	0x2a1
+	.byte	0xa
+	.long	0x51
+	.uleb128 0x1b
+	.long	.LASF1891
+	.value	0x29c
+	.byte	0xa
+	.long	0x51
+	.uleb128 0x1b
+	.long	.LASF1892
+	.value	0x297
+	.byte	0xa
+	.long	0x51
+	.uleb128 0x1b
+	.long	.LASF1893
+	.value	0x292
+	.byte	0xa
+	.long	0x51
+	.uleb128 0x1e
+	.long	.LASF1894
+	.value	0x282
+	.long	0x171
+	.long	0x1aa5
+	.uleb128 0x7
+	.long	.LASF1895
+	.value	0x282
+	.byte	0x29
+	.long	0x51
+	.uleb128 0x2
+	.string	"chr"
+	.value	0x282
+	.byte	0x4d
+	.long	0x18e
+	.uleb128 0x5
+	.string	"c"
+	.value	0x288
+	.byte	0x19
+	.long	0xc16
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF1896
+	.value	0x26c
+	.long	0x171
+	.long	0x1ae4
+	.uleb128 0x7
+	.long	.LASF1895
+	.value	0x26c
+	.byte	0x28
+	.long	0x51
+	.uleb128 0x2
+	.string	"chr"
+	.value	0x26c
+	.byte	0x46
+	.long	0xf83
+	.uleb128 0xa
+	.long	.LASF1774
+	.value	0x272
+	.byte	0xe
+	.long	0xae
+	.uleb128 0x5
+	.string	"ok"
+	.value	0x278
+	.byte	0x9
+	.long	0x171
+	.byte	0
+	.uleb128 0x8
+	.long	.LASF1897
+	.value	0x258
+	.long	0x1b34
+	.uleb128 0xe
+	.uleb128 0x5
+	.string	"crc"
+	.value	0x25e
+	.byte	0x11
+	.long	0x98
+	.uleb128 0xa
+	.long	.LASF1898
+	.value	0x25f
+	.byte	0x11
+	.long	0x1b34
+	.uleb128 0xa
+	.long	.LASF1899
+	.value	0x260
+	.byte	0xd
+	.long	0x3c
+	.uleb128 0x23
+	.long	0x1b25
+	.uleb128 0x5
+	.string	"ii"
+	.value	0x261
+	.byte	0x12
+	.long	0x3c
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.string	"ii"
+	.value	0x264
+	.byte	0x17
+	.long	0x51
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.long	0x98
+	.long	0x1b44
+	.uleb128 0x11
+	.long	0x35
+	.byte	0x3
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1900
+	.value	0x247
+	.uleb128 0x8
+	.long	.LASF1901
+	.value	0x238
+	.long	0x1b6f
+	.uleb128 0x7
+	.long	.LASF1777
+	.value	0x238
+	.byte	0x3c
+	.long	0x1e9
+	.uleb128 0xe
+	.uleb128 0x5
+	.string	"p"
+	.value	0x23b
+	.byte	0x19
+	.long	0xc84
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF1902
+	.value	0x228
+	.uleb128 0x1b
+	.long	.LASF1903
+	.value	0x223
+	.byte	0x5
+	.long	0x171
+	.uleb128 0x1e
+	.long	.LASF1904
+	.value	0x20d
+	.long	0x171
+	.long	0x1bc4
+	.uleb128 0x7
+	.long	.LASF1905
+	.value	0x20d
+	.byte	0x20
+	.long	0x1b3
+	.uleb128 0xa
+	.long	.LASF1906
+	.value	0x212
+	.byte	0x1f
+	.long	0x1bc4
+	.uleb128 0xe
+	.uleb128 0xa
+	.long	.LASF1907
+	.value	0x215
+	.byte	0x17
+	.long	0x45b
+	.uleb128 0xa
+	.long	.LASF1818
+	.value	0x216
+	.byte	0x17
+	.long	0x6be
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0x92d
+	.uleb128 0x1f
+	.long	.LASF1911
+	.value	0x201
+	.byte	0x10
+	.long	0x98
+	.long	0x1bf2
+	.uleb128 0x7
+	.long	.LASF1874
+	.value	0x201
+	.byte	0x34
+	.long	0x178
+	.uleb128 0xa
+	.long	.LASF1908
+	.value	0x203
+	.byte	0xd
+	.long	0x98
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1909
+	.value	0x1f6
+	.long	0x1c18
+	.uleb128 0x5
+	.string	"now"
+	.value	0x1f8
+	.byte	0xe
+	.long	0x139
+	.uleb128 0xe
+	.uleb128 0xa
+	.long	.LASF1910
+	.value	0x1fa
+	.byte	0x11
+	.long	0x98
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF1921
+	.value	0x1f1
+	.long	0x171
+	.uleb128 0x1f
+	.long	.LASF1912
+	.value	0x1df
+	.byte	0xc
+	.long	0x171
+	.long	0x1c70
+	.uleb128 0x2
+	.string	"cmd"
+	.value	0x1df
+	.byte	0x2c
+	.long	0x98
+	.uleb128 0x7
+	.long	.LASF1608
+	.value	0x1df
+	.byte	0x3d
+	.long	0x748
+	.uleb128 0x7
+	.long	.LASF1785
+	.value	0x1df
+	.byte	0x4a
+	.long	0x29
+	.uleb128 0x7
+	.long	.LASF1913
+	.value	0x1df
+	.byte	0x59
+	.long	0x139
+	.uleb128 0x5
+	.string	"end"
+	.value	0x1e5
+	.byte	0xe
+	.long	0x139
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1914
+	.value	0x1d9
+	.long	0x1ca0
+	.uleb128 0x2
+	.string	"cmd"
+	.value	0x1d9
+	.byte	0x2e
+	.long	0x98
+	.uleb128 0x7
+	.long	.LASF1608
+	.value	0x1d9
+	.byte	0x3f
+	.long	0x748
+	.uleb128 0x7
+	.long	.LASF1785
+	.value	0x1d9
+	.byte	0x4c
+	.long	0x29
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1928
+	.value	0x1cd
+	.uleb128 0x1f
+	.long	.LASF1915
+	.value	0x1b8
+	.byte	0xc
+	.long	0x171
+	.long	0x1ce9
+	.uleb128 0xa
+	.long	.LASF1885
+	.value	0x1ba
+	.byte	0x14
+	.long	0x48f
+	.uleb128 0xa
+	.long	.LASF1916
+	.value	0x1bb
+	.byte	0x9
+	.long	0x3c
+	.uleb128 0x5
+	.string	"ok"
+	.value	0x1bc
+	.byte	0x9
+	.long	0x171
+	.uleb128 0xe
+	.uleb128 0x5
+	.string	"cmd"
+	.value	0x1c0
+	.byte	0x11
+	.long	0x98
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF1917
+	.value	0x174
+	.byte	0xc
+	.long	0x171
+	.long	0x1d64
+	.uleb128 0x2
+	.string	"cmd"
+	.value	0x174
+	.byte	0x2f
+	.long	0xa96
+	.uleb128 0x7
+	.long	.LASF1885
+	.value	0x174
+	.byte	0x40
+	.long	0x748
+	.uleb128 0x7
+	.long	.LASF1785
+	.value	0x174
+	.byte	0x50
+	.long	0x29
+	.uleb128 0x5
+	.string	"ptr"
+	.value	0x176
+	.byte	0x14
+	.long	0x48f
+	.uleb128 0x23
+	.long	0x1d3b
+	.uleb128 0xa
+	.long	.LASF1918
+	.value	0x186
+	.byte	0x2b
+	.long	0x1d64
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.string	"chr"
+	.value	0x1a6
+	.byte	0x28
+	.long	0x1d69
+	.uleb128 0xe
+	.uleb128 0xa
+	.long	.LASF1919
+	.value	0x1aa
+	.byte	0x8a
+	.long	0x35
+	.uleb128 0xa
+	.long	.LASF1920
+	.value	0x1aa
+	.byte	0xdd
+	.long	0x35
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.long	0xba6
+	.uleb128 0x9
+	.long	0xc22
+	.uleb128 0x24
+	.long	.LASF1922
+	.value	0x16f
+	.long	0x171
+	.uleb128 0x16
+	.long	.LASF1923
+	.value	0x136
+	.long	0x1d91
+	.uleb128 0xe
+	.uleb128 0x5
+	.string	"c"
+	.value	0x139
+	.byte	0x11
+	.long	0x98
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1924
+	.value	0x129
+	.long	0x1da9
+	.uleb128 0x7
+	.long	.LASF1818
+	.value	0x129
+	.byte	0x2e
+	.long	0x6be
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1925
+	.value	0x11a
+	.long	0x1e0a
+	.uleb128 0x2
+	.string	"cmd"
+	.value	0x11a
+	.byte	0x29
+	.long	0x98
+	.uleb128 0x7
+	.long	.LASF1885
+	.value	0x11a
+	.byte	0x3a
+	.long	0x748
+	.uleb128 0x7
+	.long	.LASF1785
+	.value	0x11a
+	.byte	0x4a
+	.long	0x29
+	.uleb128 0xa
+	.long	.LASF1926
+	.value	0x11c
+	.byte	0x9
+	.long	0x3c
+	.uleb128 0x5
+	.string	"rem"
+	.value	0x11e
+	.byte	0x9
+	.long	0x3c
+	.uleb128 0x5
+	.string	"ptr"
+	.value	0x123
+	.byte	0x14
+	.long	0x48f
+	.uleb128 0xe
+	.uleb128 0x5
+	.string	"ii"
+	.value	0x124
+	.byte	0x11
+	.long	0x29
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF1927
+	.value	0x110
+	.long	0x1e2c
+	.uleb128 0x2
+	.string	"crc"
+	.value	0x110
+	.byte	0x2f
+	.long	0xcb
+	.uleb128 0x2
+	.string	"c"
+	.value	0x110
+	.byte	0x3c
+	.long	0x98
+	.byte	0
+	.uleb128 0x20
+	.long	.LASF1929
+	.value	0x10b
+	.uleb128 0x20
+	.long	.LASF1930
+	.value	0x102
+	.uleb128 0x32
+	.long	.LASF1931
+	.byte	0xc
+	.byte	0xfd
+	.byte	0x10
+	.long	0x98
+	.uleb128 0x25
+	.string	"crc"
+	.byte	0xfd
+	.byte	0x29
+	.long	0x98
+	.uleb128 0x25
+	.string	"c"
+	.byte	0xfd
+	.byte	0x36
+	.long	0x98
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 9
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0xd
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x6b
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xb
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x18
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 17 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x2
+	.uleb128 0x12
+	.file 19 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF450
+	.file 21 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 22 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF504
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 25 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF577
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF595
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1b
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF618
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF504
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF678
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF682
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF683
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF746
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF750
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF751
+	.byte	0x4
+	.byte	0x4
+	.file 35 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 36 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x24
+	.file 37 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x4
+	.file 38 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x26
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 39 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x27
+	.byte	0x4
+	.file 40 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0xf
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x4
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x1
+	.byte	0x4
+	.file 41 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 42 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x2a
+	.file 43 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.file 44 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x2c
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 45 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0xb
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xc
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0xe
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x8
+	.byte	0x3
+	.uleb128 0x6
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xa
+	.file 46 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1069
+	.byte	0x4
+	.file 47 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 48 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.file 49 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1479
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF397
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF399
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF400
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF401
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF406
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF407
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF408
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF409
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF410
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF411
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF412
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF413
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF414
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF415
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF416
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF417
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF418
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF419
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF420
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF421
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF422
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF423
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF425
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF426
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF441
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF442
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF451
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF452
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF453
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF454
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF455
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF456
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF457
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF460
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF461
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF462
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF463
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF464
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF465
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF466
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF467
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF468
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF469
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF470
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF471
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF472
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF473
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF474
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF475
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF476
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF477
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF482
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF488
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF490
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF497
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF487
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF453
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF498
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF500
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF503
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF509
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF514
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF515
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF526
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF544
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF574
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF576
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF594
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF603
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF605
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF607
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF609
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF611
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF613
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF615
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF617
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF631
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF633
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF675
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF677
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF681
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF745
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF450
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF605
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF607
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF609
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF611
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF613
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF615
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF617
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF749
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.158.bfed30416c9480cd13bc4a25427d538f,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF443
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF445
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF748
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF845
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF868
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF869
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF870
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF871
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF873
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF874
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF875
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF876
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF877
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF878
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF879
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF880
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF881
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF882
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF883
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF884
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF885
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF886
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF887
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF888
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF889
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF890
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF891
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF907
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF872
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF909
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF915
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF920
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF931
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF954
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF982
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.log.h.15.8d55807db36c763d7ee3c8fe49873932,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1034
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1044
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.display.h.46.31a4f689ddaf415b718b33079f0baef7,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1057
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.osd.h.27.28b361a2d50a4296db906c23e9f22923,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1068
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1071
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1079
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1091
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1459
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xf
+	.long	.LASF1
+	.long	.LASF1934
+	.long	.LASF1935
+	.long	.LASF1936
+	.long	.LASF1937
+	.long	.LASF1938
+	.long	.LASF1939
+	.long	.LASF1940
+	.long	.LASF1941
+	.long	.LASF1942
+	.long	.LASF1943
+	.long	.LASF1944
+	.long	.LASF1945
+	.long	.LASF1946
+	.long	.LASF1947
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x32
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1948
+	.byte	0xe
+	.long	.LASF1949
+	.byte	0xa
+	.long	.LASF1950
+	.byte	0xa
+	.long	.LASF1951
+	.byte	0x2
+	.long	.LASF1952
+	.byte	0x2
+	.long	.LASF1953
+	.byte	0x4
+	.long	.LASF1954
+	.byte	0x4
+	.long	.LASF1955
+	.byte	0x5
+	.long	.LASF1956
+	.byte	0x4
+	.long	.LASF1957
+	.byte	0x4
+	.long	.LASF1957
+	.byte	0x5
+	.long	.LASF1958
+	.byte	0x5
+	.long	.LASF1959
+	.byte	0xd
+	.long	.LASF1960
+	.byte	0x2
+	.long	.LASF1961
+	.byte	0x2
+	.long	.LASF1952
+	.byte	0x4
+	.long	.LASF1962
+	.byte	0xd
+	.long	.LASF1963
+	.byte	0xe
+	.long	.LASF1963
+	.byte	0xd
+	.long	.LASF1964
+	.byte	0xa
+	.long	.LASF1965
+	.byte	0xd
+	.long	.LASF1966
+	.byte	0xd
+	.long	.LASF1967
+	.byte	0xa
+	.long	.LASF1968
+	.byte	0xa
+	.long	.LASF1969
+	.byte	0xc
+	.long	.LASF1970
+	.byte	0xa
+	.long	.LASF1971
+	.byte	0xb
+	.long	.LASF1972
+	.byte	0xb
+	.long	.LASF1973
+	.byte	0xa
+	.long	.LASF1974
+	.byte	0xa
+	.long	.LASF1975
+	.byte	0xa
+	.long	.LASF1976
+	.byte	0xa
+	.long	.LASF1977
+	.byte	0x9
+	.long	.LASF1978
+	.byte	0x9
+	.long	.LASF1979
+	.byte	0xd
+	.long	.LASF1980
+	.byte	0x8
+	.long	.LASF1981
+	.byte	0x7
+	.long	.LASF1982
+	.byte	0x6
+	.long	.LASF1983
+	.byte	0x7
+	.long	.LASF1984
+	.byte	0x7
+	.long	.LASF1985
+	.byte	0xe
+	.long	.LASF1986
+	.byte	0x3
+	.long	.LASF1987
+	.byte	0x1
+	.long	.LASF1988
+	.byte	0x2
+	.long	.LASF1989
+	.byte	0x2
+	.long	.LASF1990
+	.byte	0x4
+	.long	.LASF1991
+	.byte	0x4
+	.long	.LASF1992
+	.byte	0x4
+	.long	.LASF1993
+	.byte	0x4
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1786:
+	.string	"frskyOSDRect_t"
+.LASF1689:
+	.string	"peripheral_baudrateIndex"
+.LASF875:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF781:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1549:
+	.string	"OWNER_BEEPER"
+.LASF1857:
+	.string	"frskyOSDClipToRect"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF938:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF971:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1181:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1739:
+	.string	"OSD_CMD_CTM_SCALE"
+.LASF1727:
+	.string	"OSD_CMD_DRAWING_STROKE_TRIANGLE"
+.LASF811:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1113:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1743:
+	.string	"OSD_CMD_CTM_SHEAR_ABOUT"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF435:
+	.string	"_WCHAR_T_DEFINED "
+.LASF831:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF517:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF793:
+	.string	"USE_PITOT_MS4525 "
+.LASF1152:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1207:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1001:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF544:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF860:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF449:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF1749:
+	.string	"osdCommand_e"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF632:
+	.string	"__U64_TYPE unsigned long int"
+.LASF625:
+	.string	"__SQUAD_TYPE long int"
+.LASF1225:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1638:
+	.string	"setMode"
+.LASF505:
+	.string	"__USE_MISC 1"
+.LASF1301:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF1463:
+	.string	"FRSKY_OSD_PREAMBLE_BYTE_1 'A'"
+.LASF832:
+	.string	"USE_SERIALRX_CRSF "
+.LASF1865:
+	.string	"frskyOSDSetPixelToStrokeColor"
+.LASF1354:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1525:
+	.string	"FRSKY_OSD_OUTLINE_TYPE_NONE"
+.LASF763:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1876:
+	.string	"entry"
+.LASF932:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF1707:
+	.string	"OSD_CMD_DRAWING_SET_STROKE_AND_FILL_COLOR"
+.LASF568:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF812:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1487:
+	.string	"__uint8_t"
+.LASF679:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF1068:
+	.string	"OSD_CHARACTER_GRID_BUFFER_SIZE (OSD_CHARACTER_GRID_MAX_WIDTH * OSD_CHARACTER_GRID_MAX_HEIGHT)"
+.LASF1614:
+	.string	"vTable"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1355:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF1511:
+	.string	"_Bool"
+.LASF1885:
+	.string	"payload"
+.LASF1721:
+	.string	"OSD_CMD_DRAWING_DRAW_CHAR"
+.LASF861:
+	.string	"USE_UART8 "
+.LASF1777:
+	.string	"opts"
+.LASF1300:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF897:
+	.string	"U_ID_2 2"
+.LASF1897:
+	.string	"frskyOSDFlushSendBuffer"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1072:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1503:
+	.string	"LOG_TOPIC_POS_ESTIMATOR"
+.LASF1744:
+	.string	"OSD_CMD_CTM_MULTIPLY"
+.LASF521:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1462:
+	.string	"FRSKY_OSD_PREAMBLE_BYTE_0 '$'"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1780:
+	.string	"frskyOSDPoint_t"
+.LASF1442:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1070:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1415:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1520:
+	.string	"FRSKY_OSD_COLOR_BLACK"
+.LASF1242:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1076:
+	.string	"IOCFG_AF_OD 0"
+.LASF995:
+	.string	"LOG_V(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, fmt, ##__VA_ARGS__)"
+.LASF1626:
+	.string	"txBufferTail"
+.LASF1595:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF870:
+	.string	"USE_USB_MSC"
+.LASF1094:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF472:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1378:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1055:
+	.string	"TEXT_ATTRIBUTES_HAVE_BLINK(x) (x & _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1324:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF914:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1343:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1649:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF1892:
+	.string	"frskyOSDGetGridCols"
+.LASF1914:
+	.string	"frskyOSDSendAsyncCommand"
+.LASF1083:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF427:
+	.string	"__WCHAR_T__ "
+.LASF1014:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF758:
+	.string	"USE_SERIAL_RX "
+.LASF1504:
+	.string	"LOG_TOPIC_VTX"
+.LASF1812:
+	.string	"viewport"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF815:
+	.string	"USE_CMS "
+.LASF916:
+	.string	"_STDBOOL_H "
+.LASF1286:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF349:
+	.string	"__amd64 1"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1039:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1419:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF990:
+	.string	"LOG_BUFFER_E(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, buf, size)"
+.LASF1394:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1365:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF624:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1555:
+	.string	"OWNER_LED"
+.LASF879:
+	.string	"USE_PITOT_MS4525"
+.LASF542:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF1667:
+	.string	"FUNCTION_FRSKY_OSD"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1758:
+	.string	"magic"
+.LASF1493:
+	.string	"uint16_t"
+.LASF1580:
+	.string	"RESOURCE_SPI_SCK"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF536:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1010:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF675:
+	.string	"__FD_SETSIZE 1024"
+.LASF633:
+	.string	"__STD_TYPE typedef"
+.LASF1217:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1386:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF523:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1701:
+	.string	"OSD_CMD_TRANSACTION_BEGIN"
+.LASF843:
+	.string	"USE_CLI_BATCH "
+.LASF1766:
+	.string	"tvStandard"
+.LASF944:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF417:
+	.string	"_SIZE_T_DEFINED "
+.LASF1111:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF903:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1154:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF397:
+	.string	"_T_PTRDIFF_ "
+.LASF753:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF713:
+	.string	"INT_FAST8_MAX (127)"
+.LASF622:
+	.string	"__U32_TYPE unsigned int"
+.LASF1121:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1329:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1738:
+	.string	"OSD_CMD_CTM_TRANSLATE"
+.LASF864:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1233:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1755:
+	.string	"RECV_STATE_DONE"
+.LASF1029:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1728:
+	.string	"OSD_CMD_DRAWING_FILL_TRIANGLE"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1220:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF865:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF974:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1807:
+	.string	"height"
+.LASF983:
+	.string	"LOG_LEVEL_ERROR 0"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF426:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1772:
+	.string	"metadata"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1106:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1844:
+	.string	"frskyOSDFillRect"
+.LASF1828:
+	.string	"serialRxBytesWaiting"
+.LASF1929:
+	.string	"frskyOSDResetSendBuffer"
+.LASF690:
+	.string	"INT16_MAX (32767)"
+.LASF580:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF642:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1015:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF493:
+	.string	"__USE_POSIX 1"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1345:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1418:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF1569:
+	.string	"RESOURCE_NONE"
+.LASF1311:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1374:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1787:
+	.string	"frskyOSDTriangle_s"
+.LASF1788:
+	.string	"frskyOSDTriangle_t"
+.LASF1446:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF671:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1651:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF450:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1725:
+	.string	"OSD_CMD_DRAWING_MOVE_TO_POINT"
+.LASF1767:
+	.string	"hasDetectedCamera"
+.LASF1114:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF1877:
+	.string	"frskyOSDDrawStringInGrid"
+.LASF418:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF970:
+	.string	"BIT(x) (1 << (x))"
+.LASF877:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1623:
+	.string	"rxBufferHead"
+.LASF717:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1122:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1273:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1139:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF1924:
+	.string	"frskyOSDStateReset"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1289:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF1686:
+	.string	"functionMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1578:
+	.string	"RESOURCE_I2C_SCL"
+.LASF848:
+	.string	"USE_IMU_FAKE "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF1642:
+	.string	"beginWrite"
+.LASF751:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1776:
+	.string	"frskyOSDDrawGridStrHeaderCmd_s"
+.LASF1778:
+	.string	"frskyOSDDrawGridStrHeaderCmd_t"
+.LASF1560:
+	.string	"OWNER_SPI_PREINIT"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF1368:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF452:
+	.string	"__USE_ISOC11"
+.LASF964:
+	.string	"STR_HELPER(x) #x"
+.LASF1856:
+	.string	"frskyOSDClearRect"
+.LASF1570:
+	.string	"RESOURCE_INPUT"
+.LASF1189:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF869:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1889:
+	.string	"osdCharacterGridBufferClear"
+.LASF1775:
+	.string	"frskyOSDCharacter_t"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1826:
+	.string	"memcpy"
+.LASF888:
+	.string	"USE_RX_PPM"
+.LASF563:
+	.string	"__always_inline"
+.LASF1579:
+	.string	"RESOURCE_I2C_SDA"
+.LASF1809:
+	.string	"minor"
+.LASF1628:
+	.string	"rxCallbackData"
+.LASF1590:
+	.string	"MODE_RX"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1836:
+	.string	"values"
+.LASF687:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF968:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1497:
+	.string	"LOG_TOPIC_BARO"
+.LASF1663:
+	.string	"FUNCTION_RANGEFINDER"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF965:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1466:
+	.string	"FRSKY_OSD_GRID_BUFFER_ENCODE(chr,attr) ((chr & FRSKY_OSD_GRID_BUFFER_CHAR_MASK) | (attr << FRSKY_OSD_GRID_BUFFER_CHAR_BITS))"
+.LASF1841:
+	.string	"frskyOSDFillEllipseInRect"
+.LASF680:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF838:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1344:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1851:
+	.string	"frskyOSDDrawStringMask"
+.LASF1858:
+	.string	"frskyOSDSetLineOutlineColor"
+.LASF1606:
+	.string	"osdCharacter_s"
+.LASF1510:
+	.string	"osdCharacter_t"
+.LASF1192:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF882:
+	.string	"USE_1WIRE_DS2482"
+.LASF1269:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1900:
+	.string	"frskyOSDCommitTransaction"
+.LASF709:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1264:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1065:
+	.string	"OSD_CHARACTER_COLOR_WHITE 2"
+.LASF652:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1059:
+	.string	"OSD_CHAR_HEIGHT 18"
+.LASF799:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF1653:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF1185:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1507:
+	.string	"logTopic_e"
+.LASF411:
+	.string	"_T_SIZE_ "
+.LASF851:
+	.string	"USE_FAKE_GPS "
+.LASF1028:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1162:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF800:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1829:
+	.string	"_logf"
+.LASF1348:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF597:
+	.string	"__stub_chflags "
+.LASF1813:
+	.string	"frskyOSDState_s"
+.LASF1821:
+	.string	"frskyOSDState_t"
+.LASF1421:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1548:
+	.string	"OWNER_USB"
+.LASF1519:
+	.string	"frskyOSDTransactionOptions_e"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF1458:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF919:
+	.string	"false 0"
+.LASF1568:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF736:
+	.string	"INT8_C(c) c"
+.LASF946:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1361:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF422:
+	.string	"_GCC_SIZE_T "
+.LASF1863:
+	.string	"frskyOSDSetStrokeWidth"
+.LASF601:
+	.string	"__stub_setlogin "
+.LASF1411:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1591:
+	.string	"MODE_TX"
+.LASF1016:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1075:
+	.string	"IOCFG_AF_PP 0"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF603:
+	.string	"__stub_stty "
+.LASF1843:
+	.string	"frskyOSDFillStrokeRect"
+.LASF948:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1512:
+	.string	"textAttributes_t"
+.LASF1664:
+	.string	"FUNCTION_VTX_FFPV"
+.LASF1849:
+	.string	"frskyOSDStrokeLineToPoint"
+.LASF1837:
+	.string	"frskyOSDCtmTranslate"
+.LASF738:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF825:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1058:
+	.string	"OSD_CHAR_WIDTH 12"
+.LASF1292:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1330:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1915:
+	.string	"frskyOSDDispatchResponse"
+.LASF1276:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF764:
+	.string	"USE_ADC_AVERAGING "
+.LASF1495:
+	.string	"LOG_TOPIC_SYSTEM"
+.LASF1842:
+	.string	"frskyOSDStrokeEllipseInRect"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF621:
+	.string	"__S32_TYPE int"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1137:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1700:
+	.string	"OSD_CMD_SET_OSD_ENABLED"
+.LASF1816:
+	.string	"info"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF1454:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1304:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF1284:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1082:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF575:
+	.string	"__attribute_copy__"
+.LASF1822:
+	.string	"strlen"
+.LASF1371:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1241:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1435:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF419:
+	.string	"_SIZE_T_DECLARED "
+.LASF835:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF605:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF686:
+	.string	"INT16_MIN (-32767-1)"
+.LASF935:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1536:
+	.string	"OWNER_SERVO"
+.LASF973:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1025:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1037:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1853:
+	.string	"frskyOSDDrawCharacterMask"
+.LASF988:
+	.string	"LOG_LEVEL_MAXIMUM LOG_LEVEL_DEBUG"
+.LASF1401:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF893:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF428:
+	.string	"_WCHAR_T "
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1034:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF616:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF984:
+	.string	"LOG_LEVEL_WARNING 1"
+.LASF1683:
+	.string	"SERIAL_PORT_IDENTIFIER_MAX"
+.LASF1567:
+	.string	"OWNER_IRLOCK"
+.LASF1197:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1391:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1862:
+	.string	"type"
+.LASF1439:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF939:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1414:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1153:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF403:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1827:
+	.string	"crc8_dvb_s2"
+.LASF1120:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF718:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF394:
+	.string	"_STDDEF_H_ "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF735:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1346:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF1805:
+	.string	"columns"
+.LASF1489:
+	.string	"__uint16_t"
+.LASF1619:
+	.string	"rxBufferSize"
+.LASF1535:
+	.string	"OWNER_MOTOR"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1204:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF899:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1654:
+	.string	"FUNCTION_BLACKBOX"
+.LASF358:
+	.string	"__k8 1"
+.LASF1088:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF456:
+	.string	"__USE_POSIX"
+.LASF1581:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF1424:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF438:
+	.string	"__INT_WCHAR_T_H "
+.LASF803:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1237:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF994:
+	.string	"LOG_BUF_I(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, buf, size)"
+.LASF1702:
+	.string	"OSD_CMD_TRANSACTION_COMMIT"
+.LASF1703:
+	.string	"OSD_CMD_TRANSACTION_BEGIN_PROFILED"
+.LASF587:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1364:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF489:
+	.string	"_POSIX_SOURCE"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1625:
+	.string	"txBufferHead"
+.LASF716:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1616:
+	.string	"mode"
+.LASF1123:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1069:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1867:
+	.string	"frskyOSDSetColorInversion"
+.LASF538:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF996:
+	.string	"LOG_BUF_V(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_VERBOSE, buf, size)"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1773:
+	.string	"frskyOSDFontCharacter_s"
+.LASF606:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF573:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1869:
+	.string	"frskyOSDSetStrokeAndFillColor"
+.LASF927:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1532:
+	.string	"OWNER_PWMIO"
+.LASF1229:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF612:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF802:
+	.string	"USE_OLED_UG2864 "
+.LASF1461:
+	.string	"FRSKY_OSD_SUPPORTED_API_VERSION 1"
+.LASF1240:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF819:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1762:
+	.string	"gridRows"
+.LASF959:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF1279:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1558:
+	.string	"OWNER_RX_SPI"
+.LASF700:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1420:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1024:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1661:
+	.string	"FUNCTION_OPTICAL_FLOW"
+.LASF1477:
+	.string	"FRSKY_OSD_DEBUG(fmt,...) LOG_D(OSD, \"FrSky OSD: \" fmt, ##__VA_ARGS__)"
+.LASF1482:
+	.string	"unsigned char"
+.LASF683:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF1760:
+	.string	"versionMinor"
+.LASF710:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF588:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1071:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF936:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF808:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF404:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1013:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF1303:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1912:
+	.string	"frskyOSDSendSyncCommand"
+.LASF772:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF769:
+	.string	"USE_NAV "
+.LASF1819:
+	.string	"initialized"
+.LASF1537:
+	.string	"OWNER_SOFTSERIAL"
+.LASF1320:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF636:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1266:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF909:
+	.string	"NOINLINE "
+.LASF1508:
+	.string	"float"
+.LASF1615:
+	.string	"identifier"
+.LASF1919:
+	.string	"_left0"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF454:
+	.string	"__USE_ISOC95"
+.LASF453:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF907:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF373:
+	.string	"linux 1"
+.LASF737:
+	.string	"INT16_C(c) c"
+.LASF437:
+	.string	"___int_wchar_t_h "
+.LASF1834:
+	.string	"frskyOSDCtmRotate"
+.LASF1639:
+	.string	"writeBuf"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1278:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1879:
+	.string	"charsUpdated"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1659:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1719:
+	.string	"OSD_CMD_DRAWING_DRAW_BITMAP"
+.LASF682:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF396:
+	.string	"_PTRDIFF_T "
+.LASF584:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF1875:
+	.string	"frskyOSDDrawCharInGrid"
+.LASF463:
+	.string	"__USE_XOPEN2K"
+.LASF1161:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF459:
+	.string	"__USE_POSIX199506"
+.LASF922:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF1643:
+	.string	"endWrite"
+.LASF1646:
+	.string	"FUNCTION_NONE"
+.LASF524:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF780:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1413:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1370:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF483:
+	.string	"_DEFAULT_SOURCE"
+.LASF1166:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1847:
+	.string	"frskyOSDFillTriangle"
+.LASF1916:
+	.string	"remaining"
+.LASF767:
+	.string	"USE_GPS "
+.LASF705:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1427:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1913:
+	.string	"timeout"
+.LASF1559:
+	.string	"OWNER_VTX"
+.LASF562:
+	.string	"__wur "
+.LASF1396:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1270:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF525:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF762:
+	.string	"USE_SERIALRX_FPORT "
+.LASF1367:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1227:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1563:
+	.string	"OWNER_1WIRE"
+.LASF894:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1706:
+	.string	"OSD_CMD_DRAWING_SET_FILL_COLOR"
+.LASF1751:
+	.string	"RECV_STATE_SYNC"
+.LASF484:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF434:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1232:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF644:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF830:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1726:
+	.string	"OSD_CMD_DRAWING_STROKE_LINE_TO_POINT"
+.LASF1542:
+	.string	"OWNER_RANGEFINDER"
+.LASF1736:
+	.string	"OSD_CMD_CTM_RESET"
+.LASF1417:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF519:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1852:
+	.string	"frskyOSDDrawString"
+.LASF522:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF684:
+	.string	"__intptr_t_defined "
+.LASF985:
+	.string	"LOG_LEVEL_INFO 2"
+.LASF692:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF703:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF578:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF804:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1206:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1880:
+	.string	"updatedCharAt"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF535:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1850:
+	.string	"frskyOSDMoveToPoint"
+.LASF376:
+	.string	"unix 1"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1302:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF626:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1824:
+	.string	"serialTxBytesFree"
+.LASF1116:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF466:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1644:
+	.string	"writeBufChunks"
+.LASF892:
+	.string	"USE_ITCM_RAM"
+.LASF1168:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1468:
+	.string	"FRSKY_OSD_CHAR_ATTRIBUTE_SOLID_BACKGROUND (1 << 1)"
+.LASF720:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1235:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1254:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1730:
+	.string	"OSD_CMD_DRAWING_STROKE_RECT"
+.LASF1030:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF436:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1692:
+	.string	"OSD_CMD_RESPONSE_ERROR"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1636:
+	.string	"serialSetBaudRate"
+.LASF1004:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF846:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1437:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF586:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1366:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF1007:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF826:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1583:
+	.string	"RESOURCE_SPI_CS"
+.LASF1502:
+	.string	"LOG_TOPIC_TEMPERATURE"
+.LASF742:
+	.string	"UINT32_C(c) c ## U"
+.LASF1627:
+	.string	"rxCallback"
+.LASF885:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1449:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF696:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF880:
+	.string	"USE_PITOT_ADC"
+.LASF1688:
+	.string	"gps_baudrateIndex"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1140:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1926:
+	.string	"required"
+.LASF681:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF806:
+	.string	"USE_DJI_HD_OSD "
+.LASF1020:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1855:
+	.string	"frskyOSDResetDrawingState"
+.LASF1621:
+	.string	"rxBuffer"
+.LASF1771:
+	.string	"bitmap"
+.LASF739:
+	.string	"INT64_C(c) c ## L"
+.LASF1620:
+	.string	"txBufferSize"
+.LASF1599:
+	.string	"SERIAL_PARITY_NO"
+.LASF1509:
+	.string	"timeMs_t"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF475:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF1397:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF788:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF676:
+	.string	"_BITS_TIME64_H 1"
+.LASF508:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF715:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1202:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF656:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF1694:
+	.string	"OSD_CMD_READ_FONT"
+.LASF548:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF931:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF556:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1406:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1861:
+	.string	"outlineType"
+.LASF1797:
+	.string	"frskyOSDDrawStrCommandHeaderCmd_s"
+.LASF1798:
+	.string	"frskyOSDDrawStrCommandHeaderCmd_t"
+.LASF1895:
+	.string	"char_address"
+.LASF1074:
+	.string	"IOCFG_OUT_OD 0"
+.LASF792:
+	.string	"USE_OPFLOW_MSP "
+.LASF1785:
+	.string	"size"
+.LASF468:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF409:
+	.string	"_SIZE_T "
+.LASF1582:
+	.string	"RESOURCE_SPI_MISO"
+.LASF564:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1093:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF620:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1552:
+	.string	"OWNER_MPU"
+.LASF1443:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF559:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF981:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1422:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1307:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF549:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1198:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1087:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1257:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1817:
+	.string	"recvOsdCharacter"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1262:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF479:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1562:
+	.string	"OWNER_TEMPERATURE"
+.LASF989:
+	.string	"LOG_E(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)"
+.LASF1810:
+	.string	"nextRequest"
+.LASF1894:
+	.string	"frskyOSDWriteFontCharacter"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF421:
+	.string	"___int_size_t_h "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF416:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF1605:
+	.string	"SERIAL_BIDIR_NOPULL"
+.LASF1553:
+	.string	"OWNER_INVERTER"
+.LASF1769:
+	.string	"contextStackSize"
+.LASF1486:
+	.string	"size_t"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1594:
+	.string	"portOptions_t"
+.LASF615:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1918:
+	.string	"resp"
+.LASF658:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1492:
+	.string	"uint8_t"
+.LASF1165:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF598:
+	.string	"__stub_fchflags "
+.LASF782:
+	.string	"USE_RX_UIB "
+.LASF1729:
+	.string	"OSD_CMD_DRAWING_FILL_STROKE_TRIANGLE"
+.LASF1409:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1465:
+	.string	"FRSKY_OSD_GRID_BUFFER_CHAR_MASK ((1 << FRSKY_OSD_GRID_BUFFER_CHAR_BITS) - 1)"
+.LASF1008:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1870:
+	.string	"frskyOSDSetFillColor"
+.LASF967:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF460:
+	.string	"__USE_XOPEN"
+.LASF1171:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF482:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1714:
+	.string	"OSD_CMD_DRAWING_SET_LINE_OUTLINE_COLOR"
+.LASF1291:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1045:
+	.string	"_TEXT_ATTRIBUTES_BLINK_BIT (1 << 0)"
+.LASF1903:
+	.string	"frskyOSDIsReady"
+.LASF886:
+	.string	"USE_ADC"
+.LASF502:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF591:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF439:
+	.string	"_GCC_WCHAR_T "
+.LASF1518:
+	.string	"FRSKY_OSD_TRANSACTION_OPT_RESET_DRAWING"
+.LASF576:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1572:
+	.string	"RESOURCE_IO"
+.LASF637:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF732:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF695:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF906:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF583:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1359:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1496:
+	.string	"LOG_TOPIC_GYRO"
+.LASF1774:
+	.string	"addr"
+.LASF1840:
+	.string	"frskyOSDFillStrokeEllipseInRect"
+.LASF748:
+	.string	"__need_size_t "
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF787:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF395:
+	.string	"_ANSI_STDDEF_H "
+.LASF1164:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1297:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF486:
+	.string	"__USE_ISOC99 1"
+.LASF1673:
+	.string	"SERIAL_PORT_USART2"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1183:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF871:
+	.string	"USE_SERVO_SBUS"
+.LASF1764:
+	.string	"pixelWidth"
+.LASF414:
+	.string	"_SIZE_T_ "
+.LASF887:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1804:
+	.string	"rows"
+.LASF1695:
+	.string	"OSD_CMD_WRITE_FONT"
+.LASF425:
+	.string	"__need_size_t"
+.LASF1534:
+	.string	"OWNER_PPMINPUT"
+.LASF1098:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF1670:
+	.string	"serialPortFunction_e"
+.LASF406:
+	.string	"__need_ptrdiff_t"
+.LASF1886:
+	.string	"uvarintSize"
+.LASF1907:
+	.string	"portOptions"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF566:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF921:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1433:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1709:
+	.string	"OSD_CMD_DRAWING_SET_PIXEL"
+.LASF1188:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF393:
+	.string	"_STDDEF_H "
+.LASF1376:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF850:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1765:
+	.string	"pixelHeight"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1718:
+	.string	"OSD_CMD_DRAWING_RESET"
+.LASF1117:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1444:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1373:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF1287:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF746:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1216:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF745:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF1452:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1313:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF528:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1668:
+	.string	"FUNCTION_DJI_HD_OSD"
+.LASF953:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF943:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1132:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF599:
+	.string	"__stub_gtty "
+.LASF1526:
+	.string	"FRSKY_OSD_OUTLINE_TYPE_TOP"
+.LASF1505:
+	.string	"LOG_TOPIC_OSD"
+.LASF1460:
+	.string	"FRSKY_OSD_BAUDRATE 115200"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF670:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1155:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1201:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1799:
+	.string	"frskyOSDDrawStrMaskCommandHeaderCmd_s"
+.LASF1800:
+	.string	"frskyOSDDrawStrMaskCommandHeaderCmd_t"
+.LASF979:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF776:
+	.string	"USE_PITOT_ADC "
+.LASF1179:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF697:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1101:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF672:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1650:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF1369:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1455:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1315:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1350:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1932:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF743:
+	.string	"UINT64_C(c) c ## UL"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF698:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1195:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1704:
+	.string	"OSD_CMD_TRANSACTION_BEGIN_RESET_DRAWING"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1151:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1814:
+	.string	"sendBuffer"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1135:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1226:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF1896:
+	.string	"frskyOSDReadFontCharacter"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1410:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF987:
+	.string	"LOG_LEVEL_DEBUG 4"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF1261:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1267:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1561:
+	.string	"OWNER_COMPASS"
+.LASF1041:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1717:
+	.string	"OSD_CMD_DRAWING_CLEAR_RECT"
+.LASF1090:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1337:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1887:
+	.string	"frskyOSDSendAsyncBlobCommand"
+.LASF510:
+	.string	"__GNU_LIBRARY__"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF506:
+	.string	"__USE_ATFILE 1"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1398:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1658:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF1033:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1389:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1275:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1335:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1239:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1652:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1056:
+	.string	"TEXT_ATTRIBUTES_HAVE_INVERTED(x) (x & _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF889:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF810:
+	.string	"USE_ANTIGRAVITY "
+.LASF1575:
+	.string	"RESOURCE_UART_RX"
+.LASF797:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF707:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1716:
+	.string	"OSD_CMD_DRAWING_CLEAR_SCREEN"
+.LASF1138:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF543:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1078:
+	.string	"IOCFG_IPU 0"
+.LASF952:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF444:
+	.string	"NULL"
+.LASF1260:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1574:
+	.string	"RESOURCE_UART_TX"
+.LASF1464:
+	.string	"FRSKY_OSD_GRID_BUFFER_CHAR_BITS 9"
+.LASF1543:
+	.string	"OWNER_SYSTEM"
+.LASF833:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1647:
+	.string	"FUNCTION_MSP"
+.LASF649:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF941:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF866:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF516:
+	.string	"__PMT"
+.LASF1100:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF440:
+	.string	"_WCHAR_T_DECLARED "
+.LASF791:
+	.string	"USE_OPFLOW_CXOF "
+.LASF1588:
+	.string	"RESOURCE_RX_CE"
+.LASF1545:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF778:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF1690:
+	.string	"telemetry_baudrateIndex"
+.LASF1838:
+	.string	"frskyOSDCtmSet"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF955:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1906:
+	.string	"portConfig"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1859:
+	.string	"outlineColor"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1316:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1434:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF1048:
+	.string	"TEXT_ATTRIBUTES_NONE 0"
+.LASF1893:
+	.string	"frskyOSDGetGridRows"
+.LASF1531:
+	.string	"OWNER_FREE"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1459:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF744:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1319:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1061:
+	.string	"OSD_CHAR_VISIBLE_BYTES (OSD_CHAR_WIDTH * OSD_CHAR_HEIGHT * OSD_CHAR_BITS_PER_PIXEL / 8)"
+.LASF1238:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1252:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1205:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1472:
+	.string	"FRSKY_OSD_SEND_BUFFER_SIZE 192"
+.LASF1163:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1756:
+	.string	"frskyOSDRecvState_e"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF839:
+	.string	"USE_VTX_TRAMP "
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF569:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF1127:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1293:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1393:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF1835:
+	.string	"frskyOSDCtmScale"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF961:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1236:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF623:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF774:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF925:
+	.string	"UNIT_TESTED "
+.LASF881:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF724:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF512:
+	.string	"__GLIBC__ 2"
+.LASF1318:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF711:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF691:
+	.string	"INT32_MAX (2147483647)"
+.LASF432:
+	.string	"_WCHAR_T_ "
+.LASF1931:
+	.string	"frskyOSDChecksum"
+.LASF1871:
+	.string	"frskyOSDSetStrokeColor"
+.LASF1245:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF954:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF901:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF1474:
+	.string	"FRSKY_OSD_CMD_RESPONSE_ERROR 0"
+.LASF526:
+	.string	"__P(args) args"
+.LASF1872:
+	.string	"frskyOSDClearScreen"
+.LASF1757:
+	.string	"frskyOSDInfoResponse_s"
+.LASF1770:
+	.string	"frskyOSDInfoResponse_t"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1040:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF723:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF701:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF940:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1832:
+	.string	"frskyOSDContextPop"
+.LASF410:
+	.string	"_SYS_SIZE_T_H "
+.LASF648:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1130:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1118:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1096:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1407:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1607:
+	.string	"serialBufChunk_s"
+.LASF1610:
+	.string	"serialBufChunk_t"
+.LASF474:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1734:
+	.string	"OSD_CMD_DRAWING_FILL_ELLIPSE_IN_RECT"
+.LASF759:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1228:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1180:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1517:
+	.string	"FRSKY_OSD_TRANSACTION_OPT_PROFILED"
+.LASF1338:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1795:
+	.string	"maskColor"
+.LASF659:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF689:
+	.string	"INT8_MAX (127)"
+.LASF1723:
+	.string	"OSD_CMD_DRAWING_DRAW_STRING"
+.LASF1754:
+	.string	"RECV_STATE_CHECKSUM"
+.LASF1057:
+	.string	"TEXT_ATTRIBUTES_HAVE_SOLID_BG(x) (x & _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF465:
+	.string	"__USE_XOPEN2K8"
+.LASF731:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1551:
+	.string	"OWNER_BARO"
+.LASF1108:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1380:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF660:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF446:
+	.string	"__need_NULL"
+.LASF447:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1067:
+	.string	"OSD_CHARACTER_GRID_MAX_HEIGHT 16"
+.LASF1051:
+	.string	"TEXT_ATTRIBUTES_ADD_SOLID_BG(x) ((x) |= _TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1128:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF478:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1748:
+	.string	"OSD_CMD_DRAW_GRID_STR"
+.LASF998:
+	.string	"LOG_BUF_D(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, buf, size)"
+.LASF1921:
+	.string	"frskyOSDShouldRequestInfo"
+.LASF503:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF884:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF467:
+	.string	"__USE_LARGEFILE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1109:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1499:
+	.string	"LOG_TOPIC_PWM"
+.LASF533:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1884:
+	.string	"blobSize"
+.LASF1592:
+	.string	"MODE_RXTX"
+.LASF1086:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF495:
+	.string	"__USE_POSIX199309 1"
+.LASF733:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF853:
+	.string	"USE_BARO "
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1170:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF785:
+	.string	"USE_RANGEFINDER "
+.LASF1023:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF1089:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF1194:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF532:
+	.string	"__END_DECLS "
+.LASF956:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1052:
+	.string	"TEXT_ATTRIBUTES_REMOVE_BLINK(x) ((x) &= ~_TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF1546:
+	.string	"OWNER_SDCARD"
+.LASF1199:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1846:
+	.string	"frskyOSDFillStrokeTriangle"
+.LASF540:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1438:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF1878:
+	.string	"buff"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF813:
+	.string	"USE_LOG "
+.LASF1820:
+	.string	"nextInfoRequest"
+.LASF747:
+	.string	"_STRING_H 1"
+.LASF1136:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF910:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1483:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1246:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1485:
+	.string	"signed char"
+.LASF1214:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF820:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF407:
+	.string	"__size_t__ "
+.LASF497:
+	.string	"__USE_XOPEN2K 1"
+.LASF1149:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1003:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1403:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1321:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1259:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF552:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1920:
+	.string	"_right1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1274:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF1596:
+	.string	"SERIAL_INVERTED"
+.LASF617:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1712:
+	.string	"OSD_CMD_DRAWING_SET_STROKE_WIDTH"
+.LASF999:
+	.string	"sq(x) ((x)*(x))"
+.LASF1309:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF725:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF596:
+	.string	"__stub___compat_bdflush "
+.LASF1064:
+	.string	"OSD_CHARACTER_COLOR_TRANSPARENT 1"
+.LASF1609:
+	.string	"count"
+.LASF1866:
+	.string	"frskyOSDSetPixel"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1053:
+	.string	"TEXT_ATTRIBUTES_REMOVE_INVERTED(x) ((x) &= ~_TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF1263:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF451:
+	.string	"_FEATURES_H 1"
+.LASF1930:
+	.string	"frskyOSDResetReceiveBuffer"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF415:
+	.string	"_BSD_SIZE_T_ "
+.LASF570:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1362:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF554:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF962:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF840:
+	.string	"USE_VTX_FFPV "
+.LASF1648:
+	.string	"FUNCTION_GPS"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1095:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1112:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1079:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF1640:
+	.string	"isConnected"
+.LASF1833:
+	.string	"frskyOSDContextPush"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF1791:
+	.string	"frskyOSDSetPixel_t"
+.LASF595:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1731:
+	.string	"OSD_CMD_DRAWING_FILL_RECT"
+.LASF1451:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF646:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF1681:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF1682:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF1528:
+	.string	"FRSKY_OSD_OUTLINE_TYPE_BOTTOM"
+.LASF582:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1341:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF673:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF900:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF590:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1746:
+	.string	"OSD_CMD_CONTEXT_POP"
+.LASF1617:
+	.string	"options"
+.LASF1175:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1801:
+	.string	"state"
+.LASF1000:
+	.string	"FAST_MATH "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF638:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF934:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1539:
+	.string	"OWNER_SERIAL"
+.LASF912:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF504:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1830:
+	.string	"openSerialPort"
+.LASF756:
+	.string	"USE_I2C_PULLUP "
+.LASF520:
+	.string	"__LEAF , __leaf__"
+.LASF1471:
+	.string	"FRSKY_OSD_CHAR_TOTAL_BYTES (FRSKY_OSD_CHAR_DATA_BYTES + FRSKY_OSD_CHAR_METADATA_BYTES)"
+.LASF1566:
+	.string	"OWNER_PINIO"
+.LASF796:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1353:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1436:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1186:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1143:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1402:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF801:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF847:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1665:
+	.string	"FUNCTION_ESCSERIAL"
+.LASF1038:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1104:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1141:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF585:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF712:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF761:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1178:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1084:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1295:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF1119:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF976:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF1630:
+	.string	"rxIrqCount"
+.LASF1248:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF640:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF639:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1305:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1602:
+	.string	"SERIAL_BIDIR"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF883:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1110:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF589:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1680:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1666:
+	.string	"FUNCTION_TELEMETRY_SIM"
+.LASF1308:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF530:
+	.string	"__ptr_t void *"
+.LASF949:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1573:
+	.string	"RESOURCE_TIMER"
+.LASF629:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF1672:
+	.string	"SERIAL_PORT_USART1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF1674:
+	.string	"SERIAL_PORT_USART3"
+.LASF1675:
+	.string	"SERIAL_PORT_USART4"
+.LASF1676:
+	.string	"SERIAL_PORT_USART5"
+.LASF1677:
+	.string	"SERIAL_PORT_USART6"
+.LASF1678:
+	.string	"SERIAL_PORT_USART7"
+.LASF1679:
+	.string	"SERIAL_PORT_USART8"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF1633:
+	.string	"serialTotalRxWaiting"
+.LASF1091:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF817:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF455:
+	.string	"__USE_ISOCXX11"
+.LASF1384:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1043:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1480:
+	.string	"long int"
+.LASF740:
+	.string	"UINT8_C(c) c"
+.LASF1213:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1102:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF481:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF821:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF685:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF693:
+	.string	"UINT8_MAX (255)"
+.LASF1231:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1540:
+	.string	"OWNER_PINDEBUG"
+.LASF1158:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF890:
+	.string	"USE_RCDEVICE"
+.LASF1425:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF527:
+	.string	"__PMT(args) args"
+.LASF400:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF969:
+	.string	"UNUSED(x) (void)(x)"
+.LASF702:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1662:
+	.string	"FUNCTION_LOG"
+.LASF1742:
+	.string	"OSD_CMD_CTM_SHEAR"
+.LASF399:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF1258:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1184:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1290:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF662:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1385:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF1589:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF515:
+	.string	"_SYS_CDEFS_H 1"
+.LASF966:
+	.string	"EXPAND_I(x) x"
+.LASF1234:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1379:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1325:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1191:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1494:
+	.string	"uint32_t"
+.LASF1612:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF413:
+	.string	"__SIZE_T "
+.LASF667:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1792:
+	.string	"frskyOSDDrawCharacterCmd_s"
+.LASF1793:
+	.string	"frskyOSDDrawCharacterCmd_t"
+.LASF1265:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF1624:
+	.string	"rxBufferTail"
+.LASF1530:
+	.string	"frskyOSDLineOutlineType_e"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1299:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1156:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1032:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF1042:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF650:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF666:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1298:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF1571:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1696:
+	.string	"OSD_CMD_GET_CAMERA"
+.LASF1358:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF1933:
+	.string	"millis"
+.LASF412:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1901:
+	.string	"frskyOSDBeginTransaction"
+.LASF1637:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF494:
+	.string	"__USE_POSIX2 1"
+.LASF441:
+	.string	"__DEFINED_wchar_t "
+.LASF1478:
+	.string	"FRSKY_OSD_ERROR(fmt,...) LOG_E(OSD, \"FrSky OSD: \" fmt, ##__VA_ARGS__)"
+.LASF539:
+	.string	"__flexarr []"
+.LASF480:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF545:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF618:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF706:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1733:
+	.string	"OSD_CMD_DRAWING_STROKE_ELLIPSE_IN_RECT"
+.LASF845:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF926:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF1732:
+	.string	"OSD_CMD_DRAWING_FILL_STROKE_RECT"
+.LASF541:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF609:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF951:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF429:
+	.string	"_T_WCHAR_ "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF816:
+	.string	"CMS_MENU_OSD "
+.LASF1174:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF699:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1036:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF491:
+	.string	"_POSIX_C_SOURCE"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1249:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1541:
+	.string	"OWNER_TIMER"
+.LASF933:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1281:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1050:
+	.string	"TEXT_ATTRIBUTES_ADD_INVERTED(x) ((x) |= _TEXT_ATTRIBUTES_INVERTED_BIT)"
+.LASF1763:
+	.string	"gridColumns"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1160:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1357:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1387:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1469:
+	.string	"FRSKY_OSD_CHAR_DATA_BYTES 54"
+.LASF771:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1333:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF765:
+	.string	"USE_64BIT_TIME "
+.LASF1873:
+	.string	"frskyOSDReadCharInGrid"
+.LASF1392:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF714:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF837:
+	.string	"USE_VTX_CONTROL "
+.LASF1473:
+	.string	"FRSKY_OSD_RECV_BUFFER_SIZE 128"
+.LASF1322:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1491:
+	.string	"char"
+.LASF1501:
+	.string	"LOG_TOPIC_IMU"
+.LASF1230:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF641:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF602:
+	.string	"__stub_sigreturn "
+.LASF1167:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1428:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1314:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF610:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF905:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF561:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF619:
+	.string	"__S16_TYPE short int"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF663:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1741:
+	.string	"OSD_CMD_CTM_ROTATE_ABOUT"
+.LASF1923:
+	.string	"frskyOSDUpdateReceiveBuffer"
+.LASF1890:
+	.string	"frskyOSDGetPixelHeight"
+.LASF1126:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF492:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF558:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF823:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1134:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF1388:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF930:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1142:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1671:
+	.string	"SERIAL_PORT_NONE"
+.LASF1927:
+	.string	"frskyOSDProcessCommandU8"
+.LASF1925:
+	.string	"frskyOSDSendCommand"
+.LASF1022:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF827:
+	.string	"USE_RX_MSP "
+.LASF1922:
+	.string	"frskyOSDIsResponseAvailable"
+.LASF958:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF918:
+	.string	"true 1"
+.LASF1790:
+	.string	"color"
+.LASF565:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1523:
+	.string	"FRSKY_OSD_COLOR_GRAY"
+.LASF789:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF653:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF730:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1268:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1811:
+	.string	"grid"
+.LASF1450:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF795:
+	.string	"USE_1WIRE_DS2482 "
+.LASF775:
+	.string	"USE_PITOT "
+.LASF1470:
+	.string	"FRSKY_OSD_CHAR_METADATA_BYTES 10"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF678:
+	.string	"__STD_TYPE"
+.LASF1018:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF1761:
+	.string	"versionPatch"
+.LASF664:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF708:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF920:
+	.string	"__bool_true_false_are_defined 1"
+.LASF630:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF424:
+	.string	"__size_t "
+.LASF749:
+	.string	"__need_NULL "
+.LASF1565:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1669:
+	.string	"FUNCTION_SERVO_SERIAL"
+.LASF1145:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF790:
+	.string	"USE_OPFLOW "
+.LASF1066:
+	.string	"OSD_CHARACTER_GRID_MAX_WIDTH 30"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF445:
+	.string	"NULL ((void *)0)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1898:
+	.string	"buffer"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF760:
+	.string	"USE_SERIALRX_SBUS "
+.LASF688:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1860:
+	.string	"frskyOSDSetLineOutlineType"
+.LASF551:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF923:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1356:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF849:
+	.string	"USE_FAKE_BARO "
+.LASF1035:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF581:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1722:
+	.string	"OSD_CMD_DRAWING_DRAW_CHAR_MASK"
+.LASF1173:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1211:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1294:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1577:
+	.string	"RESOURCE_EXTI"
+.LASF443:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF722:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1148:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF398:
+	.string	"_T_PTRDIFF "
+.LASF518:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF498:
+	.string	"__USE_XOPEN2K8 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF997:
+	.string	"LOG_D(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)"
+.LASF1768:
+	.string	"maxFrameSize"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1888:
+	.string	"frskyOSDSendCharInGrid"
+.LASF607:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF768:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1209:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1745:
+	.string	"OSD_CMD_CONTEXT_PUSH"
+.LASF371:
+	.string	"__linux 1"
+.LASF1400:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1336:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF514:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1282:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1522:
+	.string	"FRSKY_OSD_COLOR_WHITE"
+.LASF592:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF594:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF822:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1063:
+	.string	"OSD_CHARACTER_COLOR_BLACK 0"
+.LASF779:
+	.string	"USE_GYRO_KALMAN "
+.LASF1215:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1710:
+	.string	"OSD_CMD_DRAWING_SET_PIXEL_TO_STROKE_COLOR"
+.LASF1685:
+	.string	"serialPortConfig_s"
+.LASF1691:
+	.string	"serialPortConfig_t"
+.LASF1009:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF1256:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1431:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF500:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1377:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1115:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1097:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1453:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF567:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF1598:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1711:
+	.string	"OSD_CMD_DRAWING_SET_PIXEL_TO_FILL_COLOR"
+.LASF1360:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1250:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1740:
+	.string	"OSD_CMD_CTM_ROTATE"
+.LASF534:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF992:
+	.string	"LOG_BUF_W(topic,buf,size) _logBufferHex(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, buf, size)"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1720:
+	.string	"OSD_CMD_DRAWING_DRAW_BITMAP_MASK"
+.LASF1159:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF477:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1839:
+	.string	"frskyOSDCtmReset"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF628:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1271:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF945:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF469:
+	.string	"__USE_FILE_OFFSET64"
+.LASF980:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF773:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1806:
+	.string	"width"
+.LASF1046:
+	.string	"_TEXT_ATTRIBUTES_INVERTED_BIT (1 << 1)"
+.LASF1347:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1747:
+	.string	"OSD_CMD_DRAW_GRID_CHR"
+.LASF876:
+	.string	"USE_RANGEFINDER"
+.LASF1203:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1475:
+	.string	"FRSKY_OSD_INFO_INTERVAL_MS 1000"
+.LASF1789:
+	.string	"frskyOSDSetPixel_s"
+.LASF651:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF975:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1131:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF1381:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1660:
+	.string	"FUNCTION_UAV_INTERCONNECT"
+.LASF661:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1779:
+	.string	"frskyOSDPoint_s"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF488:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF433:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1212:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1845:
+	.string	"frskyOSDStrokeRect"
+.LASF755:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1556:
+	.string	"OWNER_RX"
+.LASF704:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1144:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1905:
+	.string	"videoSystem"
+.LASF553:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1399:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1247:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1251:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1601:
+	.string	"SERIAL_UNIDIR"
+.LASF1490:
+	.string	"__uint32_t"
+.LASF473:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1190:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1395:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF457:
+	.string	"__USE_POSIX2"
+.LASF1608:
+	.string	"data"
+.LASF1928:
+	.string	"frskyOSDClearReceiveBuffer"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1908:
+	.string	"frskyOSDAttr"
+.LASF1223:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1405:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1150:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1550:
+	.string	"OWNER_OSD"
+.LASF1641:
+	.string	"isIdle"
+.LASF818:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1524:
+	.string	"frskyOSDColor_e"
+.LASF1547:
+	.string	"OWNER_FLASH"
+.LASF1618:
+	.string	"baudRate"
+.LASF1440:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF470:
+	.string	"__USE_MISC"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF1684:
+	.string	"serialPortIdentifier_e"
+.LASF627:
+	.string	"__SWORD_TYPE long int"
+.LASF1874:
+	.string	"attr"
+.LASF1426:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1339:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF719:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1285:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF757:
+	.string	"USE_RX_PPM "
+.LASF1917:
+	.string	"frskyOSDHandleCommand"
+.LASF1054:
+	.string	"TEXT_ATTRIBUTES_REMOVE_SOLID_BG(x) ((x) &= ~_TEXT_ATTRIBUTES_SOLID_BG_BIT)"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF1687:
+	.string	"msp_baudrateIndex"
+.LASF1622:
+	.string	"txBuffer"
+.LASF430:
+	.string	"_T_WCHAR "
+.LASF1724:
+	.string	"OSD_CMD_DRAWING_DRAW_STRING_MASK"
+.LASF423:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1351:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF694:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1193:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1883:
+	.string	"blob"
+.LASF1467:
+	.string	"FRSKY_OSD_CHAR_ATTRIBUTE_COLOR_INVERSE (1 << 0)"
+.LASF1218:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF669:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1713:
+	.string	"OSD_CMD_DRAWING_SET_LINE_OUTLINE_TYPE"
+.LASF1049:
+	.string	"TEXT_ATTRIBUTES_ADD_BLINK(x) ((x) |= _TEXT_ATTRIBUTES_BLINK_BIT)"
+.LASF677:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF1107:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1456:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1125:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF634:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1210:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF657:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1326:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1441:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1334:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1557:
+	.string	"OWNER_TX"
+.LASF741:
+	.string	"UINT16_C(c) c"
+.LASF872:
+	.string	"USE_DASHBOARD"
+.LASF571:
+	.string	"__restrict_arr __restrict"
+.LASF1169:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF814:
+	.string	"USE_STATS "
+.LASF852:
+	.string	"USE_MAG "
+.LASF1564:
+	.string	"OWNER_AIRSPEED"
+.LASF1243:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF727:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1794:
+	.string	"frskyOSDDrawCharacterMaskCmd_s"
+.LASF1796:
+	.string	"frskyOSDDrawCharacterMaskCmd_t"
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1498:
+	.string	"LOG_TOPIC_PITOT"
+.LASF442:
+	.string	"_BSD_WCHAR_T_"
+.LASF991:
+	.string	"LOG_W(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_WARNING, fmt, ##__VA_ARGS__)"
+.LASF1513:
+	.string	"VIDEO_SYSTEM_AUTO"
+.LASF458:
+	.string	"__USE_POSIX199309"
+.LASF729:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1902:
+	.string	"frskyOSDUpdate"
+.LASF1331:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1753:
+	.string	"RECV_STATE_DATA"
+.LASF1044:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1129:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF986:
+	.string	"LOG_LEVEL_VERBOSE 3"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1196:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1187:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF401:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF431:
+	.string	"__WCHAR_T "
+.LASF1317:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1631:
+	.string	"serialPortVTable"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF1255:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1815:
+	.string	"recvBuffer"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF1597:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1500:
+	.string	"LOG_TOPIC_TIMER"
+.LASF402:
+	.string	"___int_ptrdiff_t_h "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1593:
+	.string	"portMode_t"
+.LASF978:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF972:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF896:
+	.string	"U_ID_1 1"
+.LASF1447:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF895:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF674:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1655:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1080:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1327:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1146:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1783:
+	.string	"frskyOSDRect_s"
+.LASF1404:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF613:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF754:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF531:
+	.string	"__BEGIN_DECLS "
+.LASF841:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1342:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF977:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF448:
+	.string	"_STDINT_H 1"
+.LASF485:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF784:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF1611:
+	.string	"serialReceiveCallbackPtr"
+.LASF1423:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF809:
+	.string	"USE_D_BOOST "
+.LASF496:
+	.string	"__USE_POSIX199506 1"
+.LASF1737:
+	.string	"OSD_CMD_CTM_SET"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF1060:
+	.string	"OSD_CHAR_BITS_PER_PIXEL 2"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF898:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF600:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF572:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1382:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF873:
+	.string	"USE_OLED_UG2864"
+.LASF928:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF844:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF911:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF1584:
+	.string	"RESOURCE_ADC_CH1"
+.LASF1585:
+	.string	"RESOURCE_ADC_CH2"
+.LASF1586:
+	.string	"RESOURCE_ADC_CH3"
+.LASF1587:
+	.string	"RESOURCE_ADC_CH4"
+.LASF828:
+	.string	"USE_SERIALRX_SUMD "
+.LASF608:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1092:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF1288:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1544:
+	.string	"OWNER_SPI"
+.LASF1603:
+	.string	"SERIAL_BIDIR_OD"
+.LASF1697:
+	.string	"OSD_CMD_SET_CAMERA"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF546:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF501:
+	.string	"__WORDSIZE 64"
+.LASF1635:
+	.string	"serialRead"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF668:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF752:
+	.string	"_STRINGS_H 1"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1157:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1705:
+	.string	"OSD_CMD_DRAWING_SET_STROKE_COLOR"
+.LASF499:
+	.string	"_ATFILE_SOURCE"
+.LASF834:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF794:
+	.string	"USE_1WIRE "
+.LASF1383:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF593:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF509:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1027:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1277:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1062:
+	.string	"OSD_CHAR_BYTES 64"
+.LASF1613:
+	.string	"serialPort_s"
+.LASF1645:
+	.string	"serialPort_t"
+.LASF1533:
+	.string	"OWNER_PWMINPUT"
+.LASF614:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1781:
+	.string	"frskyOSDSize_s"
+.LASF1782:
+	.string	"frskyOSDSize_t"
+.LASF1224:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1445:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF1634:
+	.string	"serialTotalTxFree"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF1808:
+	.string	"major"
+.LASF963:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF547:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1310:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF924:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF867:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF490:
+	.string	"_POSIX_SOURCE 1"
+.LASF1476:
+	.string	"FRSKY_OSD_TRACE(fmt,...) "
+.LASF1604:
+	.string	"SERIAL_BIDIR_PP"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1506:
+	.string	"LOG_TOPIC_COUNT"
+.LASF1085:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1031:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1881:
+	.string	"header"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF786:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF726:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF917:
+	.string	"bool _Bool"
+.LASF913:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1904:
+	.string	"frskyOSDInit"
+.LASF1479:
+	.string	"FRSKY_OSD_ASSERT(x) "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1124:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF574:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF665:
+	.string	"__TIMER_T_TYPE void *"
+.LASF1390:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1657:
+	.string	"FUNCTION_RCDEVICE"
+.LASF982:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1147:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1848:
+	.string	"frskyOSDStrokeTriangle"
+.LASF766:
+	.string	"USE_BLACKBOX "
+.LASF1012:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF829:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1306:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1002:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1831:
+	.string	"findSerialPortConfig"
+.LASF1698:
+	.string	"OSD_CMD_GET_ACTIVE_CAMERA"
+.LASF770:
+	.string	"USE_TELEMETRY "
+.LASF1182:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF511:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1200:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF655:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF734:
+	.string	"WINT_MIN (0u)"
+.LASF1818:
+	.string	"port"
+.LASF1073:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1750:
+	.string	"RECV_STATE_NONE"
+.LASF798:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF868:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1017:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF891:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1899:
+	.string	"lengthSize"
+.LASF1752:
+	.string	"RECV_STATE_LENGTH"
+.LASF1349:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF420:
+	.string	"__DEFINED_size_t "
+.LASF1026:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1105:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1103:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF807:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1735:
+	.string	"OSD_CMD_DRAWING_FILL_STROKE_ELLIPSE_IN_RECT"
+.LASF854:
+	.string	"USE_UART1 "
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1825:
+	.string	"uvarintEncode"
+.LASF1006:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1312:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1372:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF555:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1221:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1629:
+	.string	"rxFrameCallback"
+.LASF805:
+	.string	"USE_FRSKYOSD "
+.LASF1600:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1177:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1340:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF1244:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1868:
+	.string	"inverted"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF902:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF471:
+	.string	"__USE_ATFILE"
+.LASF461:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1323:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1656:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1208:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF862:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF374:
+	.string	"__unix 1"
+.LASF577:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1864:
+	.string	"frskyOSDSetPixelToFillColor"
+.LASF557:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1481:
+	.string	"long unsigned int"
+.LASF1081:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1554:
+	.string	"OWNER_LED_STRIP"
+.LASF1891:
+	.string	"frskyOSDGetPixelWidth"
+.LASF721:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF855:
+	.string	"USE_UART2 "
+.LASF1272:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF476:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF611:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF728:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF937:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1911:
+	.string	"frskyOSDEncodeAttr"
+.LASF1280:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1457:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF1823:
+	.string	"osdCharacterGridBufferGetEntryPtr"
+.LASF1332:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF750:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1448:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF1802:
+	.string	"expected"
+.LASF654:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1005:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1632:
+	.string	"serialWrite"
+.LASF1021:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF647:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1784:
+	.string	"origin"
+.LASF908:
+	.string	"FAST_CODE "
+.LASF1715:
+	.string	"OSD_CMD_DRAWING_CLIP_TO_RECT"
+.LASF856:
+	.string	"USE_UART3 "
+.LASF1011:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1328:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF915:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1099:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF960:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF408:
+	.string	"__SIZE_T__ "
+.LASF942:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1527:
+	.string	"FRSKY_OSD_OUTLINE_TYPE_RIGHT"
+.LASF842:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF836:
+	.string	"USE_RCDEVICE "
+.LASF1019:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF643:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF537:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF529:
+	.string	"__STRING(x) #x"
+.LASF1910:
+	.string	"version"
+.LASF878:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1803:
+	.string	"expectedShift"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1529:
+	.string	"FRSKY_OSD_OUTLINE_TYPE_LEFT"
+.LASF507:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF1484:
+	.string	"unsigned int"
+.LASF462:
+	.string	"__USE_UNIX98"
+.LASF857:
+	.string	"USE_UART4 "
+.LASF1708:
+	.string	"OSD_CMD_DRAWING_SET_COLOR_INVERSION"
+.LASF777:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1363:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF550:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF957:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF1352:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF560:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF863:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1699:
+	.string	"OSD_CMD_GET_OSD_ENABLED"
+.LASF1176:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF824:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1909:
+	.string	"frskyOSDRequestInfo"
+.LASF635:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF513:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF1515:
+	.string	"VIDEO_SYSTEM_NTSC"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF950:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1538:
+	.string	"OWNER_ADC"
+.LASF1488:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF783:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1412:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1408:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1219:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1429:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF23:
+	.string	"_LP64 1"
+.LASF858:
+	.string	"USE_UART5 "
+.LASF1375:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1882:
+	.string	"headerSize"
+.LASF1854:
+	.string	"frskyOSDDrawCharacter"
+.LASF631:
+	.string	"__S64_TYPE long int"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1576:
+	.string	"RESOURCE_UART_TXRX"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF993:
+	.string	"LOG_I(topic,fmt,...) _logf(LOG_TOPIC_ ## topic, LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)"
+.LASF1430:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF645:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF874:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF929:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1172:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF579:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1133:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF904:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF1521:
+	.string	"FRSKY_OSD_COLOR_TRANSPARENT"
+.LASF1516:
+	.string	"videoSystem_e"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1416:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF405:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF947:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1296:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1693:
+	.string	"OSD_CMD_INFO"
+.LASF487:
+	.string	"__USE_ISOC95 1"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1283:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1077:
+	.string	"IOCFG_IPD 0"
+.LASF1759:
+	.string	"versionMajor"
+.LASF1047:
+	.string	"_TEXT_ATTRIBUTES_SOLID_BG_BIT (1 << 2)"
+.LASF1514:
+	.string	"VIDEO_SYSTEM_PAL"
+.LASF604:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1432:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF859:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1253:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1222:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1991:
+	.string	"io_types.h"
+.LASF1939:
+	.string	"src/main/target/SITL"
+.LASF1978:
+	.string	"__locale_t.h"
+.LASF1980:
+	.string	"platform.h"
+.LASF1982:
+	.string	"target.h"
+.LASF1964:
+	.string	"libc-header-start.h"
+.LASF1985:
+	.string	"stdbool.h"
+.LASF1940:
+	.string	"src/main/target"
+.LASF0:
+	.string	"./src/main/io/frsky_osd.c"
+.LASF1954:
+	.string	"osd.h"
+.LASF1976:
+	.string	"stdint-intn.h"
+.LASF1944:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1947:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1953:
+	.string	"display.h"
+.LASF1958:
+	.string	"frsky_osd.c"
+.LASF1938:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1955:
+	.string	"frsky_osd.h"
+.LASF1943:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1970:
+	.string	"long-double.h"
+.LASF1979:
+	.string	"strings.h"
+.LASF1966:
+	.string	"features-time64.h"
+.LASF1949:
+	.string	"types.h"
+.LASF1968:
+	.string	"timesize.h"
+.LASF1937:
+	.string	"src/main/drivers"
+.LASF1946:
+	.string	"/usr/include"
+.LASF1934:
+	.string	"src/main/build"
+.LASF1983:
+	.string	"sanity_check.h"
+.LASF1965:
+	.string	"features.h"
+.LASF1981:
+	.string	"common.h"
+.LASF1973:
+	.string	"typesizes.h"
+.LASF1977:
+	.string	"locale_t.h"
+.LASF1957:
+	.string	"serial.h"
+.LASF1936:
+	.string	"src/main/config"
+.LASF1974:
+	.string	"time64.h"
+.LASF1950:
+	.string	"stdint-uintn.h"
+.LASF1975:
+	.string	"wchar.h"
+.LASF1988:
+	.string	"utils.h"
+.LASF1951:
+	.string	"log.h"
+.LASF1941:
+	.string	"src/main"
+.LASF1989:
+	.string	"maths.h"
+.LASF1961:
+	.string	"crc.h"
+.LASF1956:
+	.string	"resource.h"
+.LASF1960:
+	.string	"uvarint.h"
+.LASF1952:
+	.string	"time.h"
+.LASF1945:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1992:
+	.string	"io_def.h"
+.LASF1990:
+	.string	"io.h"
+.LASF1971:
+	.string	"stubs.h"
+.LASF1935:
+	.string	"src/main/common"
+.LASF1942:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1959:
+	.string	"string.h"
+.LASF1969:
+	.string	"cdefs.h"
+.LASF1963:
+	.string	"stdint.h"
+.LASF1987:
+	.string	"build_config.h"
+.LASF1948:
+	.string	"stddef.h"
+.LASF1972:
+	.string	"stubs-64.h"
+.LASF1967:
+	.string	"wordsize.h"
+.LASF1993:
+	.string	"io_def_generated.h"
+.LASF1984:
+	.string	"common_post.h"
+.LASF1986:
+	.string	"parameter_group.h"
+.LASF1962:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`w\005\245\031"
+	.string	"T%k\006"
+	.string	"D"
+	.string	"\232\245\374\327\r\030\002"
+	.string	"\002\001\002\002\003\002\001\002\004\002\001\001\240\342\234\212\n\002\203\270\355\363\f\004\002\005\002\005\002\006\002\001\003\236\214\277\024L\002"
+	.string	""
+	.string	"\002"
+	.string	"\002\003\002\001\004\303\253\312\223\005\b\007\005\355\254\266\262\t\022\002"
+	.string	"\b\b\006\363\220\261\265\004\020\t\002\t\007\304\354\204\322\t\f\002"
+	.string	"\002\n\n\002\n\b\367\222\257\265\017\002\002\013\002\013\t\334\206\272\266\f\n\002\006\n\346\306\350\331\007\006\002\f\013\246\340\271\310\001\002\002\r\002\016\f\276\253\351\313\t\002\r\250\254\220\214\013"
+	.string	"\016\242\361\351\373\003\b\017\320\244\245\312\013\002\020\273\236\371\210\f\021\212\305\304\222\007\022\212\357\346\365\005\002\023\314\245\311\243\024\205\274\327\265\f\024\002\017\020\002\021\021\025\277\305\257\340\005\004\026\304\362\311\343\017\006\002\022\002\022\027\231\203\227\236\005"
+	.string	"\030\346\232\206\224\0172\023\001\001\002\002\023\004\024\025\031\335\206\330\221\016\016"
+	.string	"\002\001\032\333\353\303\263\001\033\255\275\207\250\r\002\002\003\002\001\034\365\227\272\335\f\016\002"
+	.string	"\002\001\035\351\220\340\257\005\004\036\326\365\240\200\006\016\002\002\037\334\207\307\347\002\b\002\026\002\002\027 \264\363\214\237\002!\320\205\221\277\004\"\273\354\261\240\005#\315\247\371\207\b$\236\370\370\346\013%\355\246\221\327\003\b\002\f\002\030"
+	.string	"\002\030&\341\372\332\360'\355\224\371\237\t(\306\234\236\335\t)\354\364\230\250\005*\315\370\267\332\002+\251\233\310\370\006\n\002\f\002\031\032\031\002\031,\373\261\377\261\017-\327\227\343\300\016"
+	.string	".\264\255\310\214\n\033\002\002\033\002"
+	.string	"\002\033/\266\207\344\303\t\034\002\002\034\002"
+	.string	"\034\002\0340\321\277\314y\035"
+	.string	"\002\0351\367\252\274T\036"
+	.string	"\036\002\0362\214\302\317\240\b3\332\350\302\2454\240\352\362\364\016\016\002\f\002\037\037\002\0375\265\340\240J6\271\257\377\370\t7\317\354\211H8\307\271\346\260\0079\370\322\336\341\r:\257\312\325\345\004;\331\201\272\303\001<\222\221\257\327\016=\223\350\303\255\017"
+	.string	">\322\222\222\354\t\016\002 \002!!\002!?\237\271\322\227\006\006\002 \002\"\"\002\"@\377\216\357\201\rA\245\370\337\006"
+	.string	"B\356\233\213\343\016"
+	.string	"C\343\375\312\215\007"
+	.string	""
+	.string	"r\250\341<\202\004\310\252\241\231\244ZX\003\240\2023D\233\007\021"
+	.string	"1\222\306\021\221\021\031\005\311a76\021\222|>\215\361\211f\356q\216\235`V\271B\301{Bvf\325N\235\233\2222\310|\321c\003\276we\356e\372\030E\323\373\013\370\007:H\266\321b\007\032Gr\343\376\016&We\246\327\013z9DQ}\213_6,\332\230\211M$\3613\310\202\\:\245\n\"Y'\273p\326\335\333Z\274kK\302\364~\367[\037\302\202\267:\206\021-\204$uI\2761\331H\203$\362wfo\f\226\306\257\307\320h\316\345O\370\264\376\344\035\026\354\033]-\366\201\332\235\035\341dY\334\037(\263\350l\347.8\301#\3149\326,\314\250\334'G\341\035\217"
+	.ascii	"\f2\276Uz\006\314\363\214\234\016"
+	.text
+	.section	.gnu.lto_.ipa_sra.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\376\003U\f"
+	.string	"RN*-PU\322\030033333333\005\364\317\314\314\314L\025v=\224\364P\322CI\017%=\224\364\240\020[H$\204\020)wJ\001\356vn\366m\366UC\263G3210/.-\373\261\254\250\354Q\312B\331\327\311&\357}\226\254Jv\222\375FDB\366\003\371\360\350\3309\366\215\335420.,(=\217d\345\025SL\254D\004\304>\350"
+	.string	"ES{\3032,[\260OA?M0\021\314\003\323\300\254\n&x\300\0248`\n\300\263.[\017g[\247\317\262\205\246]\332-\032\322\177\235\272\251\271\336\216\227\023\200\204\250\260R\255\322n\260\002\"*\316\003\021@!2\\\321hiJ\356\031"
+	.string	"=j\331\301N2\230cL\351j\025UX\001\224W\003\254\325\371\301r\227\211x\352\004\032\244S\304\214\370\004\270\256\374\235\330T\223\322Z\016\263\006\025\032[\370\307\246$Q b\003U\331\333AJ\321)x\363\235\"\203\207\225t;\342F\256\261\227Y\240\317\"\234\335\200\263\352a2\023\022!\232\305\324\\n\354C\307\245O\316\303w\304\232\\\214\300#Z\n$\262E\201<\3119\005\225\345\023\263ek~f\304)\260\266\357T\376s\314\331\320\214\035\361`\340 \254\222\266\330\177|(\354\264CX\301\333G\231\211m\2434\265\356\255\203O\035\026$\270\321\371YYhT\260@\312f\"\227\007\221\f"
+	.ascii	"b\244\317\325\001"
+	.text
+	.section	.gnu.lto_.inline.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\257\026m7"
+	.string	"\306\276\327G\200XN:\377\377\3775\260:\244\037\363uP6e?\033\266L\264\032\223\201]\374\323E\300\241\016\202{)\267\370\274I\037\315\364\260G\261\025\373'a\210\bN\323\371\231\317\364Fe\016\253\264\314p-\210%do)S\267"
+	.string	"\277"
+	.string	"\307"
+	.string	"Yg\347\211}$p\0225V=\317T5\355\336\333c\372~\374[\276\275T\203\251S\213\2014\324\334|\256\252\\cdt@?oLr\216\371W5Z\330\2140A\375U\247\026F4\315\337T\034\333\366m\243\232\005\025\025M\372\351-U\035\222\003n\013j\376\3675\0135\363\325\351k\254\327\263U\277Q1\353\021\274=\3777\177\3269q\354\371s\352\2731\371\333\237s\314\033\223\374\363M\225\252{{{\313\363\257\252z6\344\2700X\210\312\0056\026\346z\257\300c]s\007\266v\323<\362\336\210"
+	.string	"\337\375>\366\371O\325{\357\025\366\317S\325\355\336\253\363k\370OY\215\006\306\322+\347\304\371[\265\322\r\355\253\3112\020^c\363lUK\244]\361\322T{xv"
+	.ascii	"Hu\037k\3325\207\267\303w\235\016\333:+\003*\241F\rZ\36096E\207"
+	.ascii	"\305\243\307\326*\313\203;_$\361\333\2666f7\276:\263\261y6\207"
+	.ascii	"w\306s\234\377H\3637?\363\357\373\277c\243\205\344\206\234\220"
+	.ascii	"_\177\314\032\024\267\237\003\331\242?\326\363\250\371\315F\347"
+	.ascii	"\213\214\316\243\306z\233\250\0233%\255\277\237\026\333\035\330"
+	.ascii	"\332\016U\213\211\022\343\t\017\333\334\230\2741Yo\353\031D\245"
+	.ascii	"\273\367\376\360E\377z\224\357\321\250\276\367j\365\371\036Y"
+	.ascii	"o^D\366\217\250\331\250\271\213\232o\371\0077\007pvv[\301\017"
+	.ascii	"\333\336\333\241\277\2265\272\370\036R\247\017\355\344\304\212"
+	.ascii	"\245\211\016\357S\177-i\230\341\243\350\205B"
+	.string	"aZ\024\275Ol|\024\205\252bsxo\366\177\352s\247\351\275N\225m\331C\006?-\336\373\024\252\225\300P\333K\243\232\207\330\334\227\363\303{\217\354\236.\3427\324+\025\353\225\"0\r\205iRR3\202f\245fFj6\022$\255,\227\326\027\341\"h}\\\034\023\373\212\203p\326\215\223\330XD8\025\001\307C-\242\227\347P\217\030\302H=\2429\313\354D\352\253\007%\225qw\267\273\220o\362\007\211\366\335|P\273$\f\215\027\332yi\306X\341y\360\326\230\274\316\t\325J=:\256~\361S\001\327\300\031\216\241X\321\013Uh\241\002\205\tM\022\"X\b\017\034\264iO\034\233\006\f\026TS\001#\321\024\367\336\3242U_\202^\222r\357\365\035\201\322\317}V\253\343\336\013<\223\226\220\024\034\025\031\025\265M%\236\315\324\374Jf\211\022\f\t\035\370\322e\003yfI\226\374>$\273\367\356"
+	.string	"\370[\201+\223p\231\023\026\355\221\301\262#\330A\007\366\257\201]W|\300\265\360\3512k\304\244\t\235"
+	.ascii	"\262\342\310\221\245\316\207\313I\334\213\340\007\2449\323\245"
+	.ascii	"\316w\001 \332\353H\025%\316\201\370\312\261;0\241\230\013!r"
+	.ascii	"@\017pc\362\347\377_\017\360)[\276N\025mF\2266\276\265h\323\335"
+	.ascii	"\247f\262F\315\026sh-d&T\360Q\333\267X\374\207\016\201\266\250"
+	.ascii	"QM\206f\204$IA\322\032\341\004\0049\007!;\363"
+	.string	"\022\340\3430\t\242\230QJ)CFD\002\021\021\t$\220HR\220\244\r\300\321gw<\234\235L8\036\236\b\273R`\302\252\352o[\\%B\221\212\016\310\021w\2148\302M\007\370c\336\t\244\217\031\313ask\353\254\245W\017\017\2314E:C\310\263&'\276>\356P2\n\200\226\244\201\346\302\210\312\323\t\264~#\334\274\361\232\034\320*S>7\311\251\356\205\350Q\017\325\337\030/j\302\326\003\247\364_xf\305\b\360~\007\037]\372\020\253W\237I54\303e\323\352\365\214Z\337\350\365\031\"-\365(\020\265\242\017\025\370WD\030_\343\343\345\264\222\206\330n\224\246\301\236\277V$M\221\021\350\331\302\230\356\020\b%\005\023\022\340 \033.@\205\327\354\345AU\267\273}~\n6J\273\303g\270\035Da:\355\213\370\t3u\377\352\312\271\216\354L\fi\027\203\3026d\275\366u\345X\310\200\212"
+	.ascii	"I;\2265\177flM*U\362\276GJV\301\314\013\212@\233\343\256\360"
+	.ascii	"\271Wh.\304'(W\262\245\326\303B\213\377`\350\235"
+	.string	"bi\233\034\r\370A\007\"a\202*\016\352\020|\300\375\275\224\316\301\202\3049)D\375\322Tr\253[:I\255\266,]\360\002\201\301M*\004Z\320\240J\367\263P\\I\377\203\317\3629\311\343\211~\273D^\320\362\333\274\317\037\"c\b\314V{\227\375c\347p\220\265F\024\020\324xB\275\332\233u\020\235\323\235\2115\353\0279U\246\321\201\037\231z6\035.d\026\366\322\253\272}\352\032\305/\016\310\247\303{,A\264\2467\251\036&sH\270c\022\315\031\007gKN0\232vV\220k+X3\\\322b\320\021E\f\310\2127\243\004\245;A\n7\341\315\310\257\351\362\205\224lE*\261\f\346\222\203=\032v&\310\310\310`&\232a/6w\264\236Y\214+L\215\201T\353\316\375\276r\255\256\235\263N\333Km\261L\223\326%\215\355\022\013\341\270\215i\344~\325\266\336\f\207i\271\365\312\227j\306\371"
+	.ascii	"\275\344\235\2423Y\327\035\207\304|\033\241\"~\272\346\256V1"
+	.ascii	"\320\002:\026,h\2501F\3215#\254q[Sr\3461\310\344\346\350\356"
+	.ascii	"l\276\260\245\362\fI\204\241\227\374\023\361\371_\302^\241\267"
+	.ascii	"\003z\342\220\251s\342\335r\034\004\366\002\0325\036\340\315"
+	.ascii	"\360\315\026\204\253\315\210\001Z\264\304\266\"\323e>\372\330"
+	.ascii	"\3475\311`\246\370\332\201r\224(\257\001\231\277ko\024\003\245"
+	.ascii	"\252|\033\223\005I\360Db\035h\004\364U\340&H\304\0253U\356\241"
+	.ascii	"B3\007F\270f%\270\030\236`\377\304\317G\353\257\210\227s\224"
+	.ascii	"\333\241\007q\344>K\004@\007L\350\022P\007\374\335\212\3279\204"
+	.ascii	"\022\374\326T\204\376\310B\302\032\006\352\234\354\330\341\353"
+	.ascii	"\355So\310=K\264\226\362{\2558\265`bb\370\370\3262\332\3764\252"
+	.ascii	"\216\362\2179``\t$\253\376\313\337\004)N\025\241|n\273W\\\nq"
+	.ascii	"\375_\032[\337\341\007\371\224#\217\275;\324\277\355\313\254"
+	.ascii	"\n\266\244\035w\3555\350<\240\035\334\001\210\017\305\325\346"
+	.ascii	"\273\345'\200$?\245\270\357\304\351\247u\232\305\007@\367ts\310"
+	.ascii	"\216\302\373@\210\233x\203:\245_\252h\335\334\305\237I\262\004"
+	.ascii	"\202J\221\326<"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\022\030\3457"
+	.string	":A\020\016J\240\232M:p\247#\216\030!\205\310\003\242AV\376\234z<\360\340u8\305I\257\210\325q\306;\371\337n\351o\2709\370\2034"
+	.string	"^c\342e\f4\305`r\374\bS\274\252\246\355rO\200\271\376?\272\327>\261m\t\221I\006\260"
+	.string	"\313"
+	.string	"\340"
+	.ascii	"\265\371^\300\323\0010\377\346\340\256\332EEaxs3\024\343\377"
+	.ascii	"\277:\352y\326?\263\321\2732\263L\3774\301`0\370+rxE\346o\375"
+	.ascii	"5\276^Y\262TZ_[\255\357\203\377/\302X\250\357Q\337Y_\007\377"
+	.ascii	"\303z\333V\317\365\376\203\257\354\303\307\201\b\t\235\235\\"
+	.ascii	"u\210\332\"\363K"
+	.string	"\234\365\205\365\245\371[\344\337\357\034\2456\207\301\027#PW\013\231m5&\276\307\317\3430F`\323\267\376\035\357\031~\360\367\2771j\237\261\356\214\021\370Z(\212\267\325\346X\354\227F\355\221\371\266\310\305\027\271\316\334\314\341R\337\360g)\356\016\31497\0020+0+?~\034\275\307\013\315A!\027.\327\352R[\253{\264\320\267\006\304|\265\214@q\007km\031\201\"\215\t}\205\372\277\362\343e\004\206U\304-\037f\356a\346\371\030\366\320\"\3278\345T\264\276\360m\260V\230\263\317\342\257\0179c\251\177\205\017r1#0\224!n\361\216Vp\004\366\223\256\301\\3&F\340\245\f\340\242#\357zb\004\036G}\315H$\343\241!\035\361\246/\315k\375\234\261k\335\007C@\344\213L3\366\230\027\271\221wu\305h}k\0060\3430\3370\3330\327\330\330\260\200+6\016N\222\037\311\273\246&"
+	.ascii	"\363\314\225\274S\324\276*j3\f\305\017\206\342\367\273\242\""
+	.ascii	"\275Em\346\372\375~]\004\250\317\226\246\210\323\314\231\032"
+	.ascii	",\224\204\r\031l\026\210\r)\205%\256RE\212\n\225\bM\232\340 "
+	.ascii	"0\277_\234\t\223\007\343\330K\2268(\361\272\375\032\270\026o"
+	.ascii	"\377\207\353\360\266\007\334\003\\\377\266\3055\337f\\\277\262"
+	.ascii	"\022%\270\006I\2220\210\212\212Z\260`\001\024\024\224\002\005"
+	.ascii	"\n\236\236\236\022$\020\023 @\200@\006\305\235\234\252\223\214"
+	.ascii	"LSSP\360\257MLLLKKKD.SR\212u)\365\241\374}EQ\210,)i\326]I0\230"
+	.ascii	"\210\204t\353k\203\005\221*\230\360\266m\326}[f\353\367\3556"
+	.ascii	"\353k\273\035U0'\"2\252\325fK*\n\n\272\021\001\001)\r\375\374"
+	.ascii	"\324l>>\265\320HO\317\001Q\b\017O\022mg\007IH&\233\351\350\030"
+	.ascii	"(\362\234\234[\201_\210\375m\003\314\373\341\322\264:\311\251"
+	.ascii	"\034\232\265\301\246L<D\205\236\350I\352\314\324\362h6[\242>"
+	.ascii	"_\211\201}4[\242"
+	.string	"\244N\267\313\331]\317\232<tw\3053S\213\236\026k)\t%\243\330B\005\b\326\b\213fS\363\203\316\207\332\334IE\352lyZ\221\"\320\263<S*,\037\215\001\317\312\304:\257\254\021\272;y\251\311\301\336J\223\304iE\236\275\023=\24585{92%\253r\266\207\356\246z\273\nC\234\232SS\276\017\226\264U\275s\004\211\223g\247v\266$wVY\344\2255\255J\224\254\262\275\032JJ`\036\025z\226)\231\343\235\022\354\315G\263\f\n\244\27345\255\316\307\003\2213\253\244\236\230\354\221\245M\315\336\024i}4k\366\262>\330\322\354\345\314+,3\201\316\250!UffDDD\222\202$i\ra\005\204(&\231+\363\022\300\261\221\f\343 \250\2302\214\004#\"\022\314\210\004\"R\220\032\206\003(w\321\006`\241\030\327\313\324\257\325\272\247\317l\312?\201H\f\262\265\252K\036du\352"
+	.string	"a\036\323\2416\300\326\025kn\235//F'\242\315\323\246\177\274q\220\213\236\230\327g\260B\231j\337\347\313o\204\tg\330;\223\177\336,\261\264q<\261_h\331\235\200\346f4\030\301\237,\rc\030\034\317\203\fG\301\007C\250\3623\211\342\236\315\226\362!X\024\364f\340b\006\356\265\240\343\321\204o\213\204\002l\310\334\247T\231-\331.\242\327"
+	.string	"\t\270N\374i!\b\224\025G\320\033K\225\252\007\273\357\235`\357\217\340\367N\300\314\336\207\247\246l\203;\303\023\004U\366\002\216\352\366\354\n\367\342\006\013\343\270\202\261\202\205\214\324\221\365\3741\232\320\033\2443\374\215\326o\034?\244\370<\231@Y\211\302,7\217\004S\250v\013\305\210\357\035{:\207\232\307Im]\"\220<\251;\304I\r\337\313\351\223\266\242\3000`\323X\373\225@0E\341"
+	.ascii	"\001\332\215\251\303\334\211\"E\227\335\004#\251\212\013\177"
+	.ascii	"\240\355\330\377\372\246\242am\200\036:]a\213\351/\300\013\244"
+	.ascii	"\307\036C\017\245\201\346\363\017jW0\355\231\275\3702\225\001"
+	.ascii	"\336'`\347$\243\027\0267\016\351\002\333\022\256\350\275\303"
+	.ascii	"^\262,\324h\3739\315j\037[\341?-\233B\037\025\266vD\234\356\304"
+	.ascii	"FJ`o\032INi\r\367\002m\357\276\235\025\360-\240\312\363U`g2v"
+	.ascii	"\371~4\247O\007\305\235\364\320'\265v\273\237\373\240\351\222"
+	.ascii	"\036\006)\315\206#\344\235\021\r\346\206\226\212?\217\260\\\031"
+	.ascii	"\302&\002\375\307\377u\253J'T\031\305\201\244H\266\251~\004\251"
+	.ascii	"\"Dj\210&~\216\3138\237*\004\005z\362\252\354\2025\222\266<\332"
+	.ascii	"\203\024\354\264 \t\354\031\267\213\\\320\240T~`\364\340\274"
+	.ascii	"'0\366\342\262,o.[T\273oUf\310qo{R\317\326\3740\244\036\303Y"
+	.ascii	"A\323J\230:\244\343\245%\211?0U\234T\316\253\334\360\233\244"
+	.ascii	"\260\020h?\001\320\362\335\357\037gb\212\020>O\213(\201\313\213"
+	.ascii	"\241\262Y\006\300\274\266\034\317\343u\334\237\2553I\315\256"
+	.ascii	"Bj>\231\341\341\207\363\335\030\306\364\004w95\320\032L\327\276"
+	.ascii	"`z\240\221\275\311\351*z\322;`,g&o.LX\352QN\3348E\214\025B\227"
+	.ascii	"\313\226\036\3467.\303Z\177A\314u\"~\214@9|\003\307\344%I\320"
+	.ascii	"7\220\321\362\337%r\305\370\320\236\236\334_a5+\031\214\364\264"
+	.ascii	"\217K\320Q\334y\215\301?\210^\267^\3565\332\033\025\267\n\n\326"
+	.ascii	"\035\016V\235\272Y2\220\265\272\331\216\r0\225\005\264\243\033"
+	.ascii	"\215\201\t \264-\023BL\220\243Y\322V\346>G\337\377a\304Z\354"
+	.ascii	"\211\330)\252\204\375\2031\025HF\216\200\363\201\237F\230)\r"
+	.ascii	"av\022\343\370s\334\240TE\032\247\247\264\235r\037\272\006W\322"
+	.ascii	"/\205n\2516\002\271\032?\371D\036\032\b\346\034!\375!\207\344"
+	.ascii	"\302\262\020\375\310\270C@;\233P\341\316k\206\034\207\037\304"
+	.ascii	"\310\200\220\b\317\2027\230(b`\250_`\376\331="
+	.text
+	.section	.gnu.lto_.pureconst.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375 \316\345\004"
+	.string	"\342\f&+0s\322\030\300\200\004\006\006\245\266\203\206\362\017\006\006\006\006\006%\020e\272\377\377\377\377\377\377\377\377\377\377fffff\326R{;Ny\214\303\370\213\273x\213\263\370\212\253x\212\243\370\211\233x\211\223\370\210\213x\210\203\370\207{x\207s\370\206kx\206c\370\205[x\205S\370\204Kx\204Cx\017\236\203\327`\305\340\013\256\340\t\036\202w\340\006\266\002\033\201m@& \013\220\001\310Nn\362\222\223\224\031y\"\0179\310?\356\361:\316\261i\265\3614\276\250\265\326L"
+	.text
+	.section	.gnu.lto_.ipa_modref.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\021\003\325\f"
+	.string	"\306\221:70q\222\016"
+	.string	"gF\212\201Q=\206'#\"\b\034Z\320\017\030\030):8\3705\372\220\375\020]\017\206\375\377\3773JmF\251\315\241\370\214HnF\354\266\2264\271S'"
+	.string	"+"
+	.string	"-"
+	.string	"\3034\0052\300\2459\300@\264\211o\377\323>8\241\263\317\236n\333g\236\232\253Z\330\327\354\377\376\251j\3162\350\263\235\252rp\227\250\273d\n\363\305>cX\270\031\204\237\315\253\3014\330?\205\273\204|\265\272\020\302w\315\017\f\340_"
+	.ascii	"\232\340c\232\001s\274q\267\306\031c|\261\305\025\024\334\361"
+	.ascii	"E\232;\361\022\231\322\311\271\2111\306\326Z\254\346\0271\304"
+	.ascii	"?8\334P\312W=_z\222\332\003s3\254\221g\224\t\265b\231\264o\371"
+	.ascii	"WV9e\224O6\271\344\324$\217,r\310 \177\214\372\224\257\270)_"
+	.ascii	"\361\322\244G{,\272#j\250\341\250\213\2526)\264\033\360\002\231"
+	.ascii	"\252m\003\0208sH\245Z9\204/\377L\322\030\356\034\235\205\322"
+	.ascii	"\322\177\024\234\220\335c+Az\276T\2057\227\237\344\301 YB\276"
+	.ascii	"=\022(\b\274\251\f\240MU\002,\335\203\037\216H\357CH04\243\252"
+	.ascii	"\354S(\013\237\007\356RN\201\357r\347Qq\030\211\001\262\365@"
+	.ascii	"iL\023\022\017\216\021\3546\206P\315s\351\360x\r\223\031\253"
+	.ascii	"}\177(\226\"LV\356A\031\341!\335`\240\027\303re\035\206\301\352"
+	.ascii	"\036\035v\354\3658\005\036\\\017\255h\002\215\242Ik\356V\240"
+	.ascii	"\263\bH\310\345\372WA\003"
+	.text
+	.section	.gnu.lto_.lto.3455d1153e8ca6ee,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_frskyOSDProcessCommandU8.27.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\024\002M\022"
+	.string	"&c{H\320\362&\035\303B\324{2\351\376\336\316G\250\345q\nep1\031\3758\2728\302-\030\023Ab\340\355u\r\333O\340\b?w\f\203\232\317\264#_:\362aO\327d\030\215\344\031k\371Y\003v\357\242\021\262\267\224)\005h"
+	.string	"a"
+	.string	"b"
+	.ascii	"\341M\270\313\324\007p\227\206\331=\036\006\315\256D\020\315"
+	.ascii	"(\310\234\323[\022^\205\235\223\261[\205\371(IG\037\030;\367"
+	.ascii	"\3412\032\320a#\205\n\324\211(!~\222Nt\335\001g\032\005\240\360"
+	.ascii	"y\027\273\031\217\t\025(\213+\267'\233\bH\323=\321\243\n\244"
+	.ascii	"\245\017\364\271v\017\346\234\326\017\354\271S\267\255c;\202"
+	.ascii	"\255\016\002\266\0309\246\n\261\303\230n\315\376J\320\355\311"
+	.ascii	"\013d\177\350W=\374G8u\267j\216S\313\250\216\253^\251\326\250"
+	.ascii	">I\311\023\016\t0\346\344\031\0025\231\244\355\204\355\213\330"
+	.ascii	",?\253U[\201\n\354\341\215wN\021P\020R\227,\036VW\373+\316\002"
+	.ascii	"\366!\234\223\314\ttCi\316p\345\004\251K\007"
+	.string	"zs\t\r\022\335\215k\267\270\350?\237\314\220\\\304\0050\262\273\247E\251m\306\366,\305\255\371\337\243\245\031\330\271\305\351\252SQ\223Lo\016\240_\333\202\214\376\323m0B\2661\33337\322\220\232s2\360\213\336\202\306\027\272\264\253F\377]\3725\334\345\027A\323P\216\016\361\252\247D\306\343\234s\2565\255{A\314\013\214\312\n\213\225b\322z\265\326\255\224\027\033W\313\206\031\233W\214\347\222\361.\310\270\320x\255\227\215\227R\300.\f0//\203\313\365\362D\302\371\005\232\340\203)g9p[\263\335\355\b\217\003\371~\020\320]nm\n\025\364_\267'\263\215Y.\267jD\213\362_\260nRBrw\307\016\b[\215\003\035\224\230\344\326p8\325\262\212\234d\001$ `\002\021cx\003\244\254\b\242\351\347\3666\310E\343Mk\026\222\031\207\353#\n\276aP\275XA\3050\220\337\303\266\270;\314"
+	.ascii	"Hw\260\354b\360\\C\362\313\bq\216q\341\004L+\2046J\276\310\244"
+	.ascii	"^\003\313\020 6;\2707o%\211\360\246\313\0309\302t\0312"
+	.text
+	.section	.gnu.lto_frskyOSDSendCommand.28.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\005\006\235$"
+	.string	":B\204\016K\200\030R:\237\"\020\316\341\001(h\256\264\005\241\2064\242\3556\300^\366\344\340VSS\t\251\213z\240]~\255<f\374\275F\272Q\337\215\304\3353\277\374rN\325A!B\177\263\261?/o\016k\n\307\3367B\b!{'\031\320"
+	.string	"\300"
+	.string	"\334"
+	.string	"U\316h\316\031C{U'\215\356\272\241E\317I\246\233\022\n\255h\316\317\006W\333B\367\266v\351\017#\234"
+	.ascii	"\031y\365T\241\275\332{\356\360\355\276\363>\214\1776\226\317"
+	.ascii	"\344,\245F\341y\233\365j{\001\353\325\036\216\335\275\335\020"
+	.ascii	"x\214\267*6\316\271\211\304+\347\347\256\027\264W\333\330}\345"
+	.ascii	"O\252\314V\361H\002\322%\347\314\3031\2147}\276\333k\374\255"
+	.ascii	"e\327\024_c\237\365A\260\325\246\\\036\375\226\262'\226h\234"
+	.ascii	"\214\211\231\366\250E\301\376\225t\333\0030\232\234\316\262>"
+	.ascii	"_W\253\266\262D59}]\3614e\020\375\332b\263DC\371.\344\305\271"
+	.ascii	"e2\325\3119_\353Wi\211t/\353\223s\356\253\\6\275a"
+	.string	"\336\3353\272;\250[5\013}1\r\376O\264\036_\374d\023\351\266\365\f>\306\\I_\216\267\255/X\032Y\276k\335O\244\213\247\272\337C\245\026m,\325}\350[\227\363\347\217s\253\377\346X\357\232g\275i\376\343\237\271\327;w\350[\246\275\035so\343\332\3330\355\355\333\275\335\266\267\331\366\366\312\336V\331\333i{\033\263\267/{\373\005\0044\233TX\222\363R\233\227\314D\005\253q\257\037\372c\375YO\273\337\363\262\353o\365\277\032\327c\3632RVm\375\264\357\352\3065\361[\235>q\3129\343\256\366\271\210\335\270\253\367@>\344Z\215\353\035\311j1\035d\200\214\254\262\262\261\341I\220\0131\036\253\305\332#\2466H7\3143s\306\204\265\300X\210\221\023K\026O\031\255\367\372\005\250\343\327\323\034Q\231\211\203\017=\007\250c\030\213\033\334\335#^V$@\225s\356\351\346p)\035n\312\242"
+	.string	"e\240\360\230\271Xq\213U\266\244/,vB\326\344\312\263\342\272b\026\253l\311&\222\222\342n\f\230 \311\212wfN\255g`B\245\235\2553\267\337\345\341\347^\331\030\037\335\246z4\323\027W\214\201\256\246\274\353\247\212\202\206K\352\310iZb\302\226:\025=v`<\3255\230\006\003])A^\265\276`m5\370X*\256I\361\237'ZU\254ZI\332\3008\305\277\221\342\204\262\356\337\213"
+	.string	"%P\345\234%\020\271X\260/\343j\207\020\272W\n\255W1\236`\346\244\361B\226\301\326h\360\263\256s\274k\001\301\340\365\375\206\301\"\242\337\260\025\372\r\361\220\304\020\376\231\b\022S\337\217PD\211\237!\266#|\360\375xz\200\200vl|BA\270\203v|D\241\207\022!\210\303\017<a\2207\"\370#\304\013\032\022y;\003Z8\364\033\362H\b\205C\036\356y<\226j\255\267a/\230\0341\322\rO\365m\n\233\203\325\247\365f\317a\245\177\035\006\215\331\305\352\360\265~\273\301t\2568X\006+5\316a\nI\220W--J\346\336\265\316a\237\343]{\232s\316\255\016\037\372\3402X\207#\007\337\3537Zs8\007\247h\311\246\203\024\314\030\020\357R4\300\245\203n\013\020"
+	.string	"\032\233\362\354Z|\032Z\031\375\242\365j\ff\271\224\236n\030\207\3271\230,E^\024\250"
+	.string	"\313\222\3370\f^\307\254\024yU\200\n\250\004u\250Q,e\221C\344\210\214\210\024$IZ\r\260\002\021*\232m\021\240\271CS*i\266\003$\321X\353,M\213Z4K>\243\361v-?j\346\364\265\204l\236\347W\232\232\210-\243U\212\350Z\252\3473B\303\3316Y\027\225;r(P\270\356\036b\345\036\030T\312\370\376\222Gn\242\020q\334\361\330;G\216B\361m\375\032\024E\256Il\305\323/\306~i6fD\237\304\343Of\272%\254\246\243\256\333 ]pCg\340\3077\b~\374\201\333\026m\327*d\270\372\220\307Y\216\313"
+	.ascii	"\315\376\340\237CH\t|\213L$\031+(i\211\202\237J\3665\245\205"
+	.ascii	"\006\202QW\261\216\024\024\245L\347\005l\267yl\326N-\007\373"
+	.ascii	"\321\313J\364\232 P@H\233\350\313i\255v\0241\305\222\376D\274"
+	.ascii	"O\212\215\366\337\335}\246\024\243\315\353j"
+	.text
+	.section	.gnu.lto_frskyOSDStateReset.29.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\250\003=\023"
+	.string	"\306\336sJ\260\226Uc(\363\301&\036W\343\034\025bx\n\017\006\334\230\023\017\004\354\277\236\221\275\374f\221y\304\220%\225$>\231t\200]\327\345\256\350\355Qg\215\357\215rW|\363\322o\213\365\333j\325o[g\264\254\343\336{\313\224\002V"
+	.string	"["
+	.string	"e"
+	.string	"\252\227\276\214\036[\365\322\252\354\007C\254[\3731nd\373\221\317\001\334\253K\332qo\272\300\nT^:\375\312|\251\362"
+	.ascii	"\346K\333l\342\323\335M!\002\"\342\367t\357=G\025\267\335\332"
+	.ascii	"\374\363\276\202\013\nq\233\002\341\336k\213\013\"q\217\267}"
+	.ascii	"\300v\313&c\002\037Xv\367\336\230\031\247A\363W\2744\b\036{\034"
+	.ascii	"\217\371\362e\347t\263Q~\357)\365\204\360Z\250\003\251%\206+"
+	.ascii	"\241\026\305\246k\241\354\364\307\216)\354\223w\324\331?\372"
+	.ascii	"\315\226\347\322'&\231\340\275#\242\242\\\245Rea\373\276\357"
+	.ascii	"\277\332S\223"
+	.string	"D\023\276\232\375^\317SgX\nJ`x\026\236\004\311:s\344e\005\032\331\027nD\346\262\2631\274\210\206\226\325\033>\234\021\026\375\314\341J?w8\021\232\244\377\236R\213\204\276\037H}1\344=\005\204Q\363!B\202\270p\375G\320G\002\024\260\327\2010\025\tf\315\335\370{\216]G\016\034\006\254*$\274\314|\3179\267!sY{F_#f\200s\363j\340\300\306\206\265\332\231\241:\244]\254\033\032JS\313\241\315pN4vz\210\325\310N\327\214v\262\b\030\325y\315\316\035\024\235\235\252\364v\362\216:\227\271\264\310\3446\376\330o\231v\204Ci\025\007\254As\264%\374\211\017\213\023\001DC=&\334\251I\023\023\202\035\022\217\333\024\276\004V\240\302\2112K\001P\250Ah\247\220\232\241ISPZi\003\020\003\231\231\2521\021\320 t\212\030\345\356\302t-\256\2045:\244*@\322\204"
+	.string	"\207\222"
+	.ascii	"b\276!\217\333\263\345q\334'\251\374\351u\275\267\371\f\007Q"
+	.ascii	"\263\307\277\331uB\304\017\326\226\233n\207\3053w&\347-\215\210"
+	.ascii	"\024\336\005R;\354\212\350\216\377*J\225uV\246!\322\034\260\210"
+	.ascii	"\247z\270h\242@\347\222\343\321\332\241\352\255\317\272\231\254"
+	.ascii	"E\350\356\366\"\225\254$\212\2305\031\020f}\303\240\337\243\025"
+	.ascii	"@\351\242\250j"
+	.text
+	.section	.gnu.lto_frskyOSDUpdateReceiveBuffer.30.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\353\023\215P"
+	.ascii	"\352}T\034A0\240R\007\227\217t\"\347\320P\253A'@n{JB\020\235"
+	.ascii	"@\230d\340\214t1\260.\177\230\207\325\321\214\375\345\336\362"
+	.ascii	"\243\\:\371\360F\334\274\320i\377\202m\242\322F\341\233\201\330"
+	.ascii	"\275\267\224)\005\261\001\232\001\267\001\236t\265#a\355B\256"
+	.ascii	"\366\243Q\273\321\325\016\303\332_W\273\013k\327\257\366\377"
+	.ascii	"\260\304%\216\210\305yF[\0244\003\276g\246<\366\371\356\312\214"
+	.ascii	"y2I\263\275D\247~\301\273\022\026\352\031\203\240\261\373<\261"
+	.ascii	"\317\372\203\3710I\263?-xX><\254\033\367\277\373\"\307c\331\031"
+	.ascii	"M\002\231\302\271D\n`\022\270\372\357\234\301\003\261\377\"\177"
+	.ascii	"vF{8:\301\271\304y\316.\370\3273\330\211\271'\277\356\306g\375"
+	.ascii	"MC\007G\002\3779\177\272\tf\t\030<\210>V>\316T\214b\256\333\302"
+	.ascii	"y\316&\370\327\017\034\377\365\357r\303=\371\357\233\364\250"
+	.ascii	";\341g\255\263\361J(\275K\234\347\231j;q&\035\375%&f\022\322"
+	.ascii	"\221Q\021\321rH\231D\n\035\215\360\353n\035\365\327\177{\246"
+	.ascii	"\325\261_r\215fho\037H\235\342Z\001*<\363r\257wT\3134\323Y\232"
+	.ascii	"\226g&\331TIr\2238\267E\252\373\257\036\271q\033@\351\007R\241"
+	.ascii	"\270OL\222l\237h\243\"\027\201U\023"
+	.string	"\0311,\241\332\322\326~(\220\212\304\215\347y^\323J\275\244\213\240\220\317\317\007R\217\270Jho\323\207\243\032\321H\267)\220\372\346\026\200\243\026\321Bt\357\236Q\2238\267=\362=\201\2740s[\343\007R\325\222U\251\206\221Pr\030\266\245\275\375\353*\305Y\222gY5s\021\254\271\001\362t\017\005G}\323n\224k\222o\243\0229CVq\300BiL\362\034\252\215\372f\334/\367\035\006\023\r\333\322\264\2746b\230\347\331\365\264\232\366\016\340\335\177\216\273\367q?\202\003V\344\374R[E(\211\326h\332\207\356!\344V\005p{x\034\241w\350\251\326Q\205\204\226\3523m&\225\004\353J\223a\3511=?\t\"\001\364\317\347&^q\220sH\220\223>c\344e\370\371\034\305oe&\237\247\370D\347\320\237\001V>|\217<C\304\314\037\373T\331\266\210L\355\020\004\201\256\230\031\267\233\327i\203"
+	.ascii	"\376R\373"
+	.string	"\003N\322V_\206\021\345(\301C\347\222\325P\201\225OR\337\"\263Zv\367n7\217z\031n\356\207\263\273\203C\003\362\244\276\355\377=\222\037\3001=\310\353xd\321s\365\370\023\276j\356\370\343q\351\354\370\013n-OG\253\305\361\017|\327\323y\207\016*3\333\033\1778Nx\234\347\261_\363w\202\377M\232\245\327@\205\357\306\177MO\347\003\360\225YM+\272;\212g#WY=\305\257q.\020\374W\215\336UWe_\237\346~\354\307d:\220\027\351\337\356YZ\372\247\315\035\343\330c\356\376\3744a\307y\236!\370\367=\032\026\376Q\376\365.\027\372\247.\340\177\1773\007\261dz\321\237\356\237G\037\342\306\3633K\333\256\373\f\003g\035\310=[\246\267\233\373[Y\001%\372f\342\016k\2672j\257\202\265Cx\354{Sk' \244\035\352\325\036\273\332\237\\\355\003\\\355N\256v\001\260\366"
+	.string	"\260\366&\243v"
+	.string	"F\355L\260\366%W;\023\326\256\344jOr\265#\301\332\217`\355F\260\366\"W;\321Q\373\022\326>d\324\256tuJ\233\371\346\317\215R\222\273\237\320l\344\246\225{t\213^\023\225\213R\343\\\362\2730\250V\264\221\266\361O\252x\264\323\310Uh\234S}\317\347\213\366\3216\376\235\255\215\320|r\225\031\347T\231\242]5\210%C\254\363K\255!\321vs=\344\276\f'\305(\367\3130\201\275\303\235\300\326\223\245\3048\235\254yjdz\321]n7M\210\350gh3Qn}hw\207\315\033\227M\004\360g'\217r\204\306\003sGB\333\311^\352\222\350\262+M\207\205\355\202\304\204\226\343\262\305\210\236\243\320Y\364<\205\306\242\343\364\304\b\320\366A\351\237\337\333\300D\373\263\032.J\347@p\236\317~\232\341x\306\241i"
+	.ascii	"F\276\006\330\235\203\007\375Swg\265=\346\312M\264_\252(@K\247"
+	.ascii	"\324^\367\222\333\315\177~,X\271?\320\356\rS\333E\352JU\013r"
+	.ascii	"\273\271\027\274\204\323\334\313\255\007I\025\311\266\fm(\362"
+	.ascii	"\223\253\361eXh\017m\370\356l\255,\213r7\301\212\022ts.Y\231"
+	.ascii	"\374\364\260j\033\267R\351O\n$\271\253\024\221\373\270\223\333"
+	.ascii	"8\346L\220\320F\356'\241\333\344'cU\342\374/\202lB\373\311\\"
+	.ascii	"\261F\373\270\237\356\231c\244\212\213F\333\265T\255\354J#\301"
+	.ascii	":b\304\270\243\006\261q\0206\0219J\315\2714\304\3553=\214\311"
+	.ascii	"\366\376\351\036\031\307\nu[\030@\273\033\336\376e@\204\320?"
+	.ascii	"\205\260#\260\231\3551\3772\217,\263H\346\205\330\026\315l\021"
+	.ascii	"\307\274\326\201\374\035\303\273aw\023\032\210\374{?\234\027"
+	.ascii	"\322\336\375{\203\330\346v\367{'U\324\006\236\005\226\265\025"
+	.ascii	"C\237`\\Y[O0\255\247\214\032\317\030a\361\326sF\327S\353Y\202"
+	.ascii	"\201\177=\301\304V\260\210\321\265\005\315\322\372\352\332\020"
+	.ascii	"O\205\025\210+@A\275\240\320g\f#\354\313\205\326\263\205\225"
+	.ascii	"C\237\\\\a+\342\254\270\005X\027\2158\254@\374\264"
+	.string	"\321\365\025sy\305[Y^/\304\262d\304\317\027[1\262Z\304`\315\030Y\032b\t\033\256F\304b.\256\240\0356hA\265\2667\340\332z>\260Z\261bJI\353]kj\353\313K\205\230\213/(\027\225W\027U\214\256,\030TZ\320/\252\251&\367\222\361\204R\201yyA\251\222Y\262\227\003$\333e\205K\321+\f\265\265\037\004:\336\356Q)\321)\372\247P;\002\333.\262\211\304\273y\305\276\334\377[\237\241\313\264\335\332\274c\370\036\314\270\247\375\331=$ZEA\324\312\361\354\355\232\377\352\355\353)\037K\237\366\373\345\371\245_\222\337\273\177\354\264]\335\002\270\205Zr'\004i\304F\363\261{\220\330;\344\351\326q\265\245Xg\333\314\304.\333d{\254\316Q\350\305:O\241\025\007\325e\231~C\004l\247= P4n*\232\345x\366\323\346\277\356\033\200\365\224'\262\307\274\271\0074m\247"
+	.string	"[\300\326z\376\310Zk\365\343\324{\202}\002l\255\275b\375~<\t\036\306\0355w\023\242\274\300z\350|\0224l\332\013\256~\325\301_j\027\215\266\333\230\337#K\021:\235\364LY\3710\265\333\300\242\355\346"
+	.ascii	"6\323 \036,\013w\234\017\006\001l\013\203\330\245\315dG\226\252"
+	.ascii	"\343t\242\263\264\245\376X\311\t\214\203w\227\205-i3\267\177"
+	.ascii	"\236U^\030\274\327\177\027\201\230\250a@'\2252#\"\"\022D\222"
+	.ascii	"$I\007\321\005\204\030%YY\007\021\360$c\312(5C\222\024$\205\302"
+	.ascii	"\306\030q\001L[\222/\237\250\236z8H+\371`E\252D\301PU\025p\226"
+	.ascii	"6\261\322\205\3645\034`\324=u\362\313\351 /\346lR\310\256!g\265"
+	.ascii	"\177\256@\r\352\372\264*$\336R\232\212\n}9\310\306\323\260\201"
+	.ascii	"M\345\303\271\t4\204\307\350\340\322\257\336\240)\004\275\372"
+	.ascii	"\250\301#\220\321\247V\217@V\037\311\370\021\\\225\2630\200\335"
+	.ascii	"y3\240t\215\255d\300V\016\200^\273\214$\260X\247\262n\277\267"
+	.ascii	"l\223k\337"
+	.ascii	"\275\224\355\325/\247\f\324\200\033c\023\204\366\024.\354\031"
+	.ascii	"\347\035\203\231\241g\223\324M;\324]Ov\0024j\274\342:\247\327"
+	.ascii	"\374\210\207\362\005\214\224\277\377\210\f\201\2638\347\212\242"
+	.ascii	"\243\362\021\"\021\270y|\r\334\340nT\342oj[:;\321}\356F\035("
+	.ascii	"N]'L%\b&\001j/\3421\371S_\303\370\364\224\274`y\276\372{\344"
+	.ascii	"\350\261\025\347\336\225\304\006p\323}\343m\233=\036\267\234"
+	.ascii	"s\375!\254|\337PlF\311\371\252\017\265\260\230-\330\3544\241"
+	.ascii	"dg\267.\201\324;\304\2428\350x&\270\f\002Y\212$\340$\024mO\367"
+	.ascii	"\204L\023GnV\225Im2\013z\350\376\001\245i>/l@W\227Pb\211\312"
+	.ascii	"\237i\210\235\261\324\216\244\357\f\232\204\262H\\\374\346x\f"
+	.ascii	"1\022\316\275\267\363\236\004\034\302\370w\247\306q\225\341\354"
+	.ascii	"\205\004\345\2141\266&9\030\370\022\277H\335}\260Bs@\003\234"
+	.ascii	"lwI\220l,\273\206n\254]&\244s(\304N\341\353\327F\353<R\220\243"
+	.ascii	"o|\320G\230\3508yD\2269\322V\301d\214m\022L\302xN\207\1774\343"
+	.ascii	"/?\371\226\340\356Q\350\356\222\217\005\271=\\\225\005\201\013"
+	.ascii	"\206t\032.EL0pBSE\232\\\003\346\002\375ofs\341\344\227t\203\250"
+	.ascii	"\336\361\033\242\020\251\035\245\322\264x\343\262V!.K8M\2671"
+	.ascii	"\264\021\327\210\2606q\b+\325O\310\251\270\212\230\325\221\311"
+	.ascii	"\225\0057I\032\336$I\270\311\013\022cX<I\032nq\245g*\213ia2\315"
+	.ascii	"\001\t'\317O\222\020s\3669\007\b\352\345\310aH\365\n\276\355"
+	.ascii	"\207\240\217\256\225<k\233\267\3765\327\244\314\241\357\306\230"
+	.ascii	"Q\204!\002\273v\023\224{\354\020\027G\371\032n\221+\001}\343"
+	.ascii	"\250\350\360\270\317\037N\237\031\2706\341V\t\025s\024\347)\347"
+	.ascii	"\232,\250bk=\271\250\257{\245^\b\376\307\302\033y$\331\2542\216"
+	.ascii	"\3445\034\314\356^\232\350\212\221K8w\310\036\200\210\300j\r"
+	.ascii	"6\177\r|\347|(s\272\307!\213e3s\375h\232\354V0l\231\221%\217"
+	.ascii	"\251\371\254\006n1\177\206,I\214}\363\246BI\003"
+	.text
+	.section	.gnu.lto_frskyOSDHandleCommand.32.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`p\020\rO"
+	.string	"\n\2028\035P0\016\323\351n4\344'\2466\013\301\375\263!\322\204\006e\021\031\360\324C\313-\016\313=\354g\240\230#\314\377\357\365\017\245\023\002 #DB\355\204 \200t\022*\f\242NX\201\243\302\227&\"\\\210\347\336\352#\024\243\203\264\333u\357-SJ\001\274\001\241\001\300\001P\300\214(I\203\3154\363\326\337\f\331N\205c\242$\345\331@\24541G\024\3602`]\256\033\330J\177k\377\342`<L\373\325\006\305\td\230\276;\225\315\374c\205\322\343"
+	.ascii	"\254!~\217S:\\\353u\210#\203u/\256\326\344NYaaE\337\260}\367"
+	.ascii	"\322'P(]\255\311\233y\313\323\372\330\322\336x\227\034\356\326"
+	.ascii	"$\234\330\201\245\345\234\231\303v\266\3666\245%\\\220i&\322"
+	.ascii	"\314?\034\355n/\355\r\005\354\226\034\355Z\224\335@W\277\273"
+	.ascii	"G\373Z\003\225\276\206\335Y\242<_-u\264\264\362\366rn\232p\265"
+	.ascii	"%`\225\270\206\351\025\035e0XW\225<\030\342\246W\351\341+\264"
+	.ascii	"^\207\236le\345\003\027\254\253\335d\017\210\016\377\273=\315"
+	.ascii	"\247\364p\265\016Z'\347\261:/97\207M\202u\325u\240\325\325\324"
+	.ascii	"5\254\256vw\237@\321\243_o\226m\345h\341aay\223s3\t'\361\327"
+	.ascii	"\177|zx\204;A`\253\303\346\254j\212\377mo\271\246\374\307\307"
+	.ascii	"\2024cz\236ekN\3043\001^3-*L\r\300\343\362r\3502,\005\002\311"
+	.ascii	"+\343O':[\202\375NN\213.\236\036\021\303\026LK\234-\231mN\004"
+	.ascii	"]\032y\240S\225\340\355\021LZ\224\261\037^\256S\204\205.\211"
+	.ascii	"\344\244%\366\276\264\021ra\245@g\313\256_\333\374}p]\245n\316"
+	.ascii	"\331\317\226^\257fP\207\227\026\035\373\301\3644E\332\373\322"
+	.ascii	"\306\241K\257\324gkI\226\257\371kqY=f~y\320rU\255\3012M\274|"
+	.ascii	"l\351\245~N\213\234s\177\026\327\017o\r\336\3559\272\235\202"
+	.ascii	"naX\256\346`\177c\276\017\020\025\230\260k\276\264\256\370\325"
+	.ascii	"\206\336\267\224\342\016NR\331\212S\234\201\243\372?\007\200"
+	.ascii	"\0046dr0YW\361\245U\215\301\352\341\034\271\233\245\241\262\234"
+	.ascii	"\255Vt\303\3606\020\2609[\245\340{\321\"\340p\207\\]U\361\020"
+	.ascii	"\023N\370\f\343\342\376D\370\374*\240\253\255\314\332C\347m\356"
+	.ascii	">\236C\354\334\370e\031U7\310\365\005\375\343\024;\233\253\211"
+	.ascii	"qt\227\363\225gU\300^\3210\022`m\375\202\265[\006\006\357Y\235"
+	.ascii	"f\"x\2521N\3238\306!\350\264\274\034?~7\2548\355h^\264%\326\204"
+	.ascii	"\366\250\325U\307C~Z^T\377\327\033\344\242\320\374}BgB\254\244"
+	.ascii	"\256c5\302>f\205\214\325\303i\241\234\033h\246s\247\262|\263"
+	.ascii	"7\365~]\246I\227\0336\323~\327y)\330\200\031\301/\264\303\360"
+	.ascii	"h\354Zh\207\372\235\030\231\366\272\316c\275\203\325UV\202\\"
+	.ascii	"\307\226F\302\307tw\236\207'eS\016\326y\237\225I\270Z\204\335"
+	.ascii	"\253\217\323/'\003t\004\366,.C\214\352\373\332\327\274\202)v"
+	.ascii	"Q5\371\373\272\233U\217\311\272\035\377\375\375\3515F"
+	.string	"\322\355W\334\215\\\315\275\310Wp\037\321\337D=\337.\317\267\210\235\357!\341w\210\366\033D\373-\324~\177\b~{h\277;\264\337A\3557\207\366\033\250\2775\354|\377\354|\373\004\277{\202\337<\301oa\360{\247\375\016\266\337\300\340w\333~\353\004\277\331\340wN\360{\r~\253\355w\032\374\306\355\367\007\277]\205\212g\244\376\236K\361h\352\267\274UZB\340\243\247\237\013\356k\316\302 \327\214\356`2g\234\027\367.\376\242I~\263\307\342\037\213\377\0257\321.\367b\275 \\\341\251\036z#\347-\0317\320\034\306Y>7\313\350\232\254cu\247\273\355\255\267z\234\toZ\335\213\273T]\334\313\332\230A\335\034\210ef\027]\363aO\351\273_\021\336-\267\nO\265\2239\367\242j\262\277k\363\r*\243Rt\307\206\016\bs\300A\270\003\376\200\2050\b\354n?\345\345z\201\260W\316\202\221"
+	.string	"\353\027\236\352\035\fB\210\205<\340\017o\220\217\342\001\177\035S\315\007w\370\301A=\230\003\017\006\222\203~\fbV\301w\325\200\375\035\362h/\353D\003\016:\343\374\351\372&gf(\250X\212\374\2227\311\017N\212\363\371z\023\336\260\021#\274\222\367H\t\314\324\217\354\223\274I|0\322\227\036\346\223!92\226\246Q\362b=xx\206\n\317\t\017\3264T\306\344\277^\263\240;#ERg\223\357\342\301GS\204N~\210\220 \357\223\007\"\224\262\203\273\337(\317\325\024t\327\375J\371\345;\005\250,\347\234\302\325~\037\277\365R\351V\300\305{\226\213\325U\314\227\245\206\201\017a\211\335\301\0010\325\250\376\217\345\213kF\325\260Z\350\210"
+	.string	"}\316\273\205\373\213\241{\022\245}:\321\301@\267\317z\361"
+	.string	"{\345aF\256\372\236\273\236w\341\251Vq\020;V\234\026\003\037k\351\261\\\271_\213\037\013\023\216\305:VK\357\374\252wc\361;\231pO\263\022ozo:l\276\264\346\340\240\307\371\274\344o\177\276\366\336\3165\004@\335\260qL\316\310\031"
+	.ascii	"\252\206\021\307\214\265\223F\250\"1I\274Qt\241\234\2205\\&\243"
+	.ascii	"S\224\013\205|A\242\231\216I\033\356QT\321\216\250\"\026J\034"
+	.ascii	"\306\035\307'\367\b)\252\310uB\036\225I\243\005.\022\223\221"
+	.ascii	"\203#\016\342\021\352\350\242\035x\241\200k\303\351\bU4>\355"
+	.ascii	"0\272G;\212\334\244\221FS\224\223[<\332 6\271LG\034\304\r\234"
+	.ascii	"\216+:\252\310er\"65!\213.\022\3125*\235\220\256\323\321\335"
+	.ascii	"qb\200\"7\211L&\215\256\023\321e2np4\026\215\023\270J\013\304"
+	.ascii	"\210\300\345\241A\214d\003\t$o\0241\021\212\310\224>)\215\311"
+	.ascii	"4\t\365\204\215\034\034\225)\023\021\211\203\007\361)\247\013"
+	.ascii	"\250\301dD\261\202\006\r$ \246\246\"\356\"\022\223\0229\203\207"
+	.ascii	"\006\312d\215$\3441\311\351HlJ*&\225IH\037\032\371dL&A!\221\311"
+	.ascii	"$`\223\312\323\214\221\f\275\326\326\332\177\002\003\215\337"
+	.ascii	"\332\233\317Wq\"\254\325\335D\370qU\277_\372S\306I\030cc\363"
+	.ascii	"\021B\203B\360\377t\021\3305#u\006\001\261~\350\f6\347\214\346"
+	.ascii	"[\220J\303\272- \245\347b\225/K\310\327\021UxV\267\224\fOFj\r"
+	.ascii	"\013\021\330\237\316\201/KH\364\237\256\344\034\343\306\272*"
+	.ascii	"\354\023\003\376\215y\317\255JZ^L\317\375\262?\013\353j\353D"
+	.ascii	"\254\201\2711\241\024\240\331l\bwK\361\275\334\033Vt\027\346"
+	.ascii	"\255r\272I\271\371\2707\311\303\275hRQ\366\270\272:\204\223\230"
+	.ascii	"jsb\334\315\304\250\346\276\326H\031\241\007\223u\025\341\\\020"
+	.ascii	"0Y\272\320\361\314q\371\334\277I\365I\371\261Wo\304\310\325\227"
+	.ascii	"\342\256\347\033\236\177>x[\366\204\3055D\201M\250a0\007\021"
+	.ascii	"c\210FD\202$I\n\031\016q\005\004\031&!\273\016\021 1TP\315H\233"
+	.ascii	"B\007\347T\017>\347]'J\342\347`\367\225\362\001\367\364X\200"
+	.ascii	"U\222\177\002\0164<\273;\221k\311wJ+\301\032R\244&p\24549?-."
+	.ascii	"|\363\323L\224n\032\250*\212~\246@\017XNV,\241\312&!\256\254"
+	.ascii	"\211\203\240\243X\342TbO\273\217"
+	.string	"\235!m\346\247m\232\322\257S\224\352i\030\215\\c\r^\321\232d\211\020J*\005\370\354\326\246\034\303\326cOI4\024[!F(\017v\226\030\3461\002\237\312\253\271q\310\360\0244\201\254\254\305\021g\251\032\342\326\327\262\265'\256\001\311d\276\031\314gh\003K\237\230n \356\331\366\315rm\337\b\343\035\354\336U\025\336\367\222\217\234\373C\227\200\0222\211\224;\223\tP\240\201\336\211\n\342\341H5\345\305\303\275\223\203R\341\264\253\371\355\360\303\347:\237e5\233\305\016\367\236\353\202\375\333\177\004\025\007\354\345\375\211>r\372\2158-\265"
+	.ascii	"\321\305\013\002<\366;\326$=\233\265\266\351\356\370\021\341"
+	.ascii	"k\365>j\321\270\020d\363m\t\024=\354H]d\004\r\322\267\327\240"
+	.ascii	")9tQ\230,\200HaR\232~\275J*uG\342`\354\243\215\b7\245\020\030"
+	.ascii	"\200/\351\337o\206*\2047Z\201\210\223\256\207\351-A\373/m4\362"
+	.ascii	"\201(4\304\316\032\225\317\211\212\376\021{\301\026U\265#\234"
+	.ascii	"\360^\013\354\340v\367\374\233l\2333\b,s\272]\207\321:\352\322"
+	.ascii	"\242B\245\r\263\251\b\224\256>H\312\312\2615\222\312^\214\222"
+	.ascii	"\356\320\304\b\350!\by\361VxMy-oZ%\025\231\177\372\340\357\352"
+	.ascii	"\027]\034\365\237H\214\311g}0\254\3215\"\016k\260+^G\270\261"
+	.ascii	"\255)\344\341\362\027\256&\016\\\036\211$T\262E\270\\\033J\344"
+	.ascii	"?\240\221\374\220I\252#\225y\267\272@\213\013\236S\354\005\034"
+	.ascii	"\303\301\363%\030dq*\020\210:\323\230$\n4\2121MC\\\226\3550("
+	.ascii	")\246\026Y\033\220\023\262\003(\202 0HI\342w q{\004\034\234K"
+	.ascii	"i\216\340]@\263\267\304\370P\033\376\244\004,\311A\352\020r\357"
+	.ascii	"\025\017\233\243\032\\\347\240VxV\371|\265\024\222o\253\247\027"
+	.ascii	";\235\232\221\030\312\211\032\255\202\223\215\032A|i\262\233"
+	.ascii	"\246b-F\257^\036\350c\361a\367\371\303dX<\377\001"
+	.text
+	.section	.gnu.lto_frskyOSDDispatchResponse.33.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`o\005\215!"
+	.string	"\206:\323Hp\032R:\003\332@\231\301H\247H\031\302\020\013\336O\206\377\267<\017qYdT1d\227l\314h\374\206\275\033w\262\b\267\245vU\373F\342\f\n\020}\003\335T\360\250\032\007\003{,\377\222\213\3727\177\020B\366N2\267"
+	.string	"\263"
+	.string	"\303"
+	.string	"\320\356]\037\257\245\325'\232\251g\316yw\265\237u\354\336]\275\335M\375*\307r\254\336\005M\311r\253\246_\331xV\356"
+	.string	"\020\225\243-\355D\233\263\372\271\225_iz\333`,T\333"
+	.ascii	"M\314\223J\316\371C\356*{\236\365jz\002\353\325\240\256\237?"
+	.ascii	"\221\254S\233\245*\240\221='\\\355\b\271\253]\341BS#\337VI\355"
+	.ascii	"\344`[b\261\345"
+	.string	"\334\366\260\222#\277\252)\276\310\376\261\236R\211\206a6\235\276\366\270*\240yCy\323\334\217\343TBZ\027:\337\372\325\321|Jy\244\2340\217\365\033\325\204\272w\247C\316\271/\263\311\343\275\363\356F\352\356$\335*\212:Ld\325\006\352\2665\317\230WT\r\271\376y\274#\ne\300\030T\207\337\236=\326\341s-\341\272g\034\214\211\302\027\243\036/\307\024\226XI\336\270\276au\312\336e\250\247*\347\344\231\335\276{\375zU\035|\227\221\217Y\316\031\003\327\271\b\373L\256\366\321\360\2369\\\257\376\3521\234\311\353\326<c\316\250Z\276n\335\355\323\305T\335O3F\322\315\273\326{\367\366\255\373\363\275\346n\253};\335\271\215\327\333W\275\375\002\034\336L\025i\022\305k\332,\025\367\226\311\324\257'\327\372\237\177{\334\375 2?}-\375\255\336\005\205i1\261`k[\344\036\006\240\035<\033\243"
+	.string	"UfB\006Ur\016\275\356KHY\326ss\232\316\350\032\326ubRV\334!\271&\270<\254\2521\341\300,g\345\231(rJ\030\017 \254\272\253X\273W\b\3353;\315A\324\2458dQ\265\fdhRT0O\261\202\347\223{\361\267\374\314\220\272\274b#\303\270\373E\214{f\212Y%v\352\035\306\370K\270$\276\370gK\270$\2202\036\320u\230\207/\230r\352\351\3065O\314\307\267\334\314P\356a/\363\033\202\276\317V\360\304z\224\355\360\265.\344L\212\371\030\031\007\314\230d\335\306zu\207/W\324\220o\3758\304\232e\257jK\363J1\325\261\2164ph0\246\352\t\017\035\201M\n*\035\211X\240\017\004v\311\207\005\022}\303a\361\307\002\2035\200D\037\r\342\022[Tb\203K@\326\030,*Z\"b\215\210B\240\321\367K\022\206`7\204\020R\301\036\217\204\214#R"
+	.ascii	"\207"
+	.string	"?\f\364\025k\034}H;FDa\320\b\240-\024\001\203\0274\020\021\001\361\034\025o\377\200\200I\305\241\343Q\222\261\250W\024\366\210B\337\260\3673&\365\200\020t\021)h\354)\025\213\306\336\256M>\315\030I\t)\034\313\256\364G\256k\223\267e\027>\230\2578\252\273W\034\344L\342'\027k\316\250\332\214\277\271\265EA^9[\035:\016\216\200\360\3605\020jqz\314\214\270\371\241-\342hp\316\026\334/\"e\231i=\264I\274\rSh\250A<\306\0203\306\021\021\022\021IA!\035\200\002\221)+;\020H\247h&I\213\001\023w\252)%\332\330w \203\265x\240\335\244\263\212\376\273E2HE\370<lYKZy\375\214!\365\026\022 \023\241\022:\241\031-\255\030u\344[\353D\030\315\036u\272\230c\251;\007\337}\326R\370\362\221\342\222D\352j\321\341qF\275\250>J\370V\241"
+	.ascii	"\004 (^\020\030p\316\327w\324 bxP\210\212\3471e\361\375\027\222"
+	.ascii	"\231G\266\344,\022\224k-\206\367\216\363wN\215\206\fH\357^\230"
+	.ascii	")\032\026\322\362\020\314C%[\340\274H\345\233\342-\315\234\005"
+	.ascii	"\007\323\250\025\333_TL\021\327D6l]\343\233\246Ah\005T\232A\312"
+	.ascii	"\376\330\031Rvt\235\020\220u7\t\376\032q\307&\004\317\241j"
+	.text
+	.section	.gnu.lto_frskyOSDClearReceiveBuffer.34.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`V\003]\026"
+	.string	"\006f\216M\240\024R:4\247\016Z\274_Ky\326\217\317Gw\260\fJ\375!7i\346`\375c\263\274p\nb,d\367\272\350\017\306\030\352\271\002+\304\212\213\207\264\360\371q\264t$\205\221\244"
+	.string	"H\360FA\334#\\\222\226\355\035\226\020\262w\222\001u"
+	.string	"q"
+	.string	"{"
+	.string	"\257\034:\2009\335oun\324XDS\354d\377H\247;v\362\306z\247\033\310\201\276\374*\n\342%i\345\234O\254\342;/\311\021\337\235\376\357\002\206\271\227oo\242\20445\203\005:92\270\3021d\306\356\306"
+	.string	"?-z1\326\347\2160\026\350xT\361\32121c{F\031\027\217\352\277_\020\254\356\336\327\203\234s\337\036\033\342\375zw\327t\267\206n\234\013S?z.W?\330\265\313@i\276`\333\036#5)\346\234\033\300x\022M\237\305\311\256Q\357{jy\262\304\264\025-\317\355\352\007\017\033.I\035x\222 \277\253-,\232\360u\273o8\367\2756u8\327\227\370B*\337\"\335@\335\305D\335\0373\036\352\306\267\313\361\366\305\267?\243\021\243pDr\376\3512\222{\220\302\242\356~\037\370`\316\215:\350I\261m\333\233R"
+	.ascii	">&\232OH{\230\220\304\321I\262X\241-,\031\361i\300\275\370F_"
+	.ascii	"\262\200R\314y\367^\013\311nA\202\223\343\025\224\260_(\2731"
+	.ascii	"d\340\341\\\037_|\336\021\031\321\351\273(%(\022-\217? Yu\273"
+	.ascii	"\274\006\212\342\353\266])=\241q\2142;1\304#\212\202Qc\311\355"
+	.ascii	"~\201\221\021\231\272\352F+\2041\021y\264,\361\177/A\262J\201"
+	.ascii	"\025}Cop1&\316\001s\303M\352\301\\\321\231\031\234\030\023\355"
+	.ascii	"\220\2425t5m6\251\314\nS\273\245+\246\203\225\226\n&\216\246"
+	.ascii	"e\215\240\322\265\024\231\233\372\202\243\271\2553\247\232\236"
+	.ascii	"6)L\315Y[og\n\201V9\240\353y\243\252\353\031\003\362\034\017"
+	.ascii	"\375\016!\353j\353\212\007\353J\227\027\253|\270\220p\252))\004"
+	.ascii	"(\316R\276\355\t\347\301B\2042P\f\242\360\247\035N\005\256\260"
+	.ascii	"\204\215\277\355\332\207\001C\250AD\204\rA\212\311\214\024\224"
+	.ascii	"\024\2649\300\002\031\2521\017\0208\307FF\333\026\003\"\006'"
+	.ascii	"hv\035\364\224-\270\031ow,w\023a\333!3\330\206\034WPtK\275\207"
+	.ascii	"\177;P\304\354\0373~T\247\320\034X\343H\302Qi2\234\246\330\026"
+	.ascii	"\365\371\233F\244\233QT\303\001\336\021Ii%\346T\365\t\247\353"
+	.ascii	"\036V\037\204\323P\357\322\241\220\200\310X\225\216\207'n\240"
+	.ascii	"\202n\f\326j>\3417\317\361T\013h\252LIj\274_\243\373*"
+	.text
+	.section	.gnu.lto_frskyOSDSendSyncCommand.36.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`-\005}\""
+	.string	"\006\276\336Ip\226R:\243\rd\302{\027=\357e\371d\001)]\350KK\031"
+	.string	"\035\331\313\033\354\261\210\271q(\004\353^\314A-Q6M\333"
+	.string	"\214\307u\301xz\341\242H\363s\317\362\253\031\333\007\223\024\310"
+	.string	"\332\377\244\021B\366N2\313"
+	.string	"\267"
+	.string	"\314"
+	.ascii	"P:\216th\277\022U&\305uL\305\200a\206\"\233\241\241\375\n$VT"
+	.ascii	"o\367\221\\\254\351\321\236;\200\234\263\364*D\177\303~m\037"
+	.ascii	"\200\375\n\324U\304\367`L\215s\266\301\246\226s\264\330\n\332"
+	.ascii	"\257\r\0364u\363\321-)\237\224X\224\02219G\215\230G\377\272\305"
+	.ascii	"\315\007\201\277V\350cgV\025\337f\337\371\340\217\336\027\240"
+	.ascii	"\333\324\f\027\367\227\243J\306\333\253\013A\350E\241q_\215K"
+	.ascii	"\243.\373\254\222\361\031UB\230\027\327\335\246\260T<V\266\026"
+	.ascii	"\244z\336\365\322\253E\310\320\201\341\345\250\272\272ju\254"
+	.ascii	".\240s\022\206\206\nJ\275\221\n\002\375\364\367\005\325\323\275"
+	.ascii	"\276\t9\347\276P\252\2527\315\273;\257\273ct\253R\001w<W\303"
+	.ascii	"+\304A|\334Md\364\304\316\006\342\343G\225q\272{\315\003c\346"
+	.ascii	"v\227H\336C\233\370\204\235\315c\345v\351\205\360\246\360\354"
+	.ascii	"\362\315\353\216>]\254\325}\003S\271\255\306Y\335\300\3338\300"
+	.ascii	"\33367{\017\277\344\257\371\330/|\364\017\036\354\007\366\355"
+	.ascii	"\365w[\355\333\370w\373\342\333/\360<:1u-\312r\226\332#\223\261"
+	.ascii	"\254O\204\334\354\357~?\355S\345\317:\004\\\232\262\373h\335"
+	.ascii	"\301N\361\263\306k]\274r\316\301\257}&)\272\203_owS_\332A\240"
+	.ascii	"\267b\267\031\263uN\265e\323&t9G\031|m!\240\265\"\233\344J\232"
+	.ascii	"\276\204\251\016so\032a\273\233G\232_4m]"
+	.string	"\377\362Q\347\303Z\375&\213\361\365r\340v7\305(\334C1~\330s\322\260\356X\254\325?\226be\255\315\340\254^\317\304\342\340K\017\340-\214\363\356M\016\255+\374\n\323\316\026Z_\270\225\f6ql8x\207\013\355\3005(m\335\027\335\220\r\302\266\033n\370\215\313\330\331z\333\260\360\315Nt\272y]\203/\036\342\203y\332x\272{\235s\273;x\270\207^<\204\343\t;\325\324O?`\354\374\275\355@\303gbmp\021\331\026\250;\246?\355\240Oa\322\211\233\266\320\245\204\250\331\3129\377@y\224\241\376\217\257-b\304=t\004\373\325\006\353\310!\371\364\337\202\003\343\226o^\360i$\343\005}D\236H\022\035\021\203\210\215d&)Q0\221K\242Q\322\022\223\250\244\314@\214`!\310\003q\311D\320\022\203\201c\022\022+\251P\"\221\222J>$\213$S%R\":\252\355\340\350\210|"
+	.ascii	"TT\344ssD2\302m\344sd*I,\231`.\217\214\312\2441)I\204d4Z2\215"
+	.ascii	">9\255D\201\\\032\225\224\312\2451\030u:\316jv\356J\331\024\370"
+	.ascii	",\277\364\034\346\250\224M"
+	.string	"}\177\223]\361\013\334\023\234\360\023W0lK\023\310\216\220\366\271\242\347\353\265\374o\277\311S\303\263\323\261\n\363\002b\255\036b\025\277\b\031\033\324\035\243b\b8\004\264a]\3159\347\337\217[\225\036-\201*;'!M\033\221\236\373\263\3035\273\020\304\345\374<\264I\244}\016\365$`\201\001^\250A \3041\206\bI 2\"C\f\222t`\002\2219\245\036\020@\311d8\031\016\335\016>,QI\361\033K4g\332i\312\0012b[FZ\322\314\252s\002\316;vE}\315\232nS(}\323\215\267x3\336v\207\210b$\351\376\242a\254M\016\006\030.\210\270~4\351\224\331\370\236\324/\266\003\034~?\b<\226\320\022\206\352\f\371P\224\300\223\367\300\217\006\315\222\326=\"\354\207\254\207\360\261\332\3553\037\226\030\321,\317\024y\211\0202\300_\261\213\265%\210\033\022o\032|g%C$(\267"
+	.ascii	"\360\271J\034\243\r\366\034\266'v\361a5\240\035\356\244^\033"
+	.ascii	"\300[rP\373\005\376\177;u\224\252\214U\216\246\371r)\250\342"
+	.ascii	"\343\007M\371]\r"
+	.text
+	.section	.gnu.lto_frskyOSDShouldRequestInfo.37.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`$\001\r\016"
+	.string	"\346\032_D"
+	.string	"\261&\035A5nI\260\335\037\224\321\207\323\371\366\006\0202\024\322W\033\305:\2716S\207\354\177\364\323m\241\213[\342\210E!\325F\251\271\252\252\025\004\2243n\025{\343\033-\251\347J,\322\310\336R\246\024M"
+	.string	"G"
+	.string	"M"
+	.string	"\tDP\f\372\347R\352\224P**R\273\237\246!\016z\204\232 \377\247C\026+\006\251Ky\304L\207\035\335\006\370\261\273Y7J\205\036\245\022\244\216N\004\r\340\260\260\361\323s\245\033ev\032\354\256\223\324q\270\257\333~`\273\200}S\367\216\335x\230\261\271r\320\341D*'\003\261\271\262?Qj\213}\270\312b;\215\305\364\005\323\252\351\324\3649\006\270\260\321P\263[j\335X\031\261\205\t\333\367_\356\235\034\205\265\246F\352\321\1779\261\263\307\333(v\346\237\241`\356zL\025\021\341ei\227\230\350M\037D\232\222wQ\341\320\250A\256K\177z\200\225\312&\347\0065J\225\357)\370\367\030\020lw\031\370)\016\263\371$\036\357]\340\362\244\307\234\271i\\\217"
+	.string	"\356q=^J"
+	.string	"E\023\312\226\003\366\204H\3406\b\031J\270\317\004m#\321*\220D0\321<\037N\013\021\340\315\302\310G\303\260m\037-\373B\207\253,N=\360\204\b\256\272b\033\323\217\220\212\254\212\351UX\241l]Q[\256#`d^@\275\236\025\003\303\366|\305\310\002_&\032"
+	.ascii	"L\204\036\347\206g\266\032o\204}\021@la\316\020\005\302\322\270"
+	.ascii	"S\243\203\335\366\310\261\005\n\313a\253\217=je{\256\260/eI\027"
+	.ascii	"\306\220\030\333B-\032\203Y\340\215\030A\320\252&\367\256\002"
+	.ascii	"\005"
+	.text
+	.section	.gnu.lto_frskyOSDRequestInfo.38.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\005\004\235\033"
+	.string	"\246p\255I\240XU:\305Sj\312\035r\364<\b\325\213;\202\364\215k\210P7\322J\364\224\220E\214\372\025D\030\321\261\266Vb\220~I\306o\003Q\216\302;%\272\036\007?\t\3560k\311Z\200[\256\016\370\215_\362\t\331{'\031\222"
+	.string	"\225"
+	.string	"\230"
+	.ascii	"\254\241\374\030\233\361\342\243|`\354|ps{\221Y\366\020\025\023"
+	.ascii	"\2423\304\356 \206\362#\037\211\0173\353c\375\217Y\023\322\274"
+	.ascii	"\336\373\221\333}?%\316F\231D\251H\354F\033|\344\005\345G\327"
+	.ascii	"[\344\307{\002\344G\2761\1779\312k\025\321\027\031G\305\356\206"
+	.ascii	"Y \277\235\034\257\2557\376\177\007p\356p'W\273\034\037q\374"
+	.ascii	"\306\020\302\250\3662 B)#`\007t[AB\316\377^i\354t\265\252.t7"
+	.ascii	"\327s'tV\235\231g\314\034\202\371\306\002M]\245\230Q]\265?\230"
+	.ascii	"o\3234M\331\372`\006Pyu\337\231,+\327\262\362\005(\230\312\362"
+	.ascii	"\"\355\016J\3214\323\270D\364\242\337\367\312|\376\322\205*n"
+	.ascii	"\304\252\251\035K*\230Y\0172\263\330\347F\374$wr%\253#\r+\351"
+	.ascii	"\211\355\306\213\254Ozb#\215x(o\267w\240-DA\306k\254o\302W\362"
+	.ascii	"%>g\302`\016\240-\364)\016h\211td\272ph\007U\230\"\366\2121\251"
+	.ascii	"\327\255G\342\0077>?2\217v\320{RJz\305n\364\3651\235\304G\372"
+	.ascii	"\201\277D\206\f\324_\271\211\237\027\036=\007\347\007?\200\250"
+	.ascii	"?\331\005dq\234\240\030\374\nKTS+\275\204\212\262af\f[!\237t"
+	.ascii	"\bCF\007\212\210\300;\337\344\256\\\225\037i\030\365\233\344"
+	.ascii	"\213^\300\211\314\201\177\215!\324yg\210Ak\177X\035\340\025\030"
+	.ascii	"\365\f3\2178\225\237\226\0233\211O\301\031\300\353n\tQ.%\207"
+	.ascii	"\037\344#\357\310\352O\031\371\361\266\365\344\313\325\224\353"
+	.ascii	"p\fi\357\273+W\2458@e\236\235\250?I+bHgq\\\207a\0022\0273\333"
+	.ascii	"\315Y\221\303syP\354\330\036\332\314V\223\261P1\204\022<\262"
+	.ascii	"\233\230\216\216M\253\005\255\307\362\216\r\217\215\206c\236"
+	.ascii	"\260\325J\300h3X\317,\007\005l\247f\203\331 `Z\nY\r\266\202F"
+	.ascii	"\253\301Xh\356\267\255\217\337\313a\312\224\263\272\333\335M"
+	.ascii	"\232\267\273\207\005b\221}r\302\341r\217N1*\247\377\220\244\255"
+	.ascii	"\366B\001\361\320\225Z\322\240\0311cM\345\0133h\260\0267\201"
+	.ascii	"\t\f\221{\223\\Y\035`\227\013y\303\233\314\032'!sx\226\016L+"
+	.ascii	"[\363\344\023\376\274-P,\240\"\255\240\330\024U\250a(h\020\203"
+	.ascii	"\n\315\004\023\214\266\2404\035`\002\0312\253\033\020`H$\205"
+	.ascii	"Is$\3672_\336\034&\337\302>mLW\277wp{K\023\232`\327Z\222T\r\322"
+	.ascii	"w\200\304.\213\n\370\212C\223\024\2474\234\221\350\244>\211\n"
+	.ascii	"\026\251\233-\001\220\330Xv\325?\320C)\346\216N\303_\307\212"
+	.ascii	"\3672V\261\006\356C\363\036\341\344\025\006\264\031Fb\372c\267"
+	.ascii	"s\\`\267\021H\001G\211\220D\303\002\377\210O\214\233\364\001"
+	.ascii	"\035e\210\225\215\311\261e\302]\374\273\324\366\303\312\0178"
+	.ascii	"_\272\202\210!\310\244 =[e\265\274!>\211\277\305\t\314)\\\013"
+	.ascii	"/\277\371\267s\330d1j"
+	.text
+	.section	.gnu.lto_frskyOSDInit.40.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\207\002\345\025"
+	.string	"\206\352\226I\300\224Nc(G8\275r\023\365\342t\264h\347\rlb\306q\204\363\232\321\315-\341j8\270\266\362\002\232nG\342RO\220p\347\244\225\332\325\272\033,\013@\211u\021\205\374\250'\237/l\205\311\030P\244M\366\336R\246\024\201"
+	.string	"{"
+	.string	"\202"
+	.string	"7\323V\253}\250\337\360y\224\007\317\356U\201\366\270\367l\340\005\344\305\225\253\214\027\303\247\214\027m\333\201\315\307\275\237,\212\b\374\224B"
+	.string	"\301\356=k\266\351\275\217bhk\317\377\371x\364\341\017\023Z[H\254\314\243\213\344\321\303\220\345\004\215+"
+	.string	"\246/4pD\307\023\315\374Pm\230`K\353\351\350+\221\351\013\025\240Hq\365\251\327!3\250V\231\313\275\327U\3104\272e\267\215c\273\306\256M\001\351\247~BE\242+\314\353\3261\373\374\251v\205}\033\f\006\203\266L\366\201\367\354R\267\314\325u\254>\312\214Q\021\221y\021_\367\026\005\233\334\"\242\017\031\007\376R\257\366o-l~\016\237\352\250i7'\233]\265\023^t\302\017\306\f\030\362\342\255\006\220\007\352\027\003\003y\361\266\217?e\332M\311f\333?\217\303\347R=\002nzo6\3719u\335{2\270h\n\344E\237dK\302B\236qfw(THKa^3{\340WR\352\261n\0173\312|\367\032\306\332\375\230\361V\277\265ef\352\205f6@\326M\262?\266s\337aC\336\353\203\340c\345\350\310\027\027ooI\242\200j\320GS\"\351w\306W=f\t7\004\375"
+	.string	"4\025\222V3\035\021\304\366\2142\213\233R\342\253bfI\201\310\354\245\276\002T\307|R}\336\373\233\321.9\324\013\311\354m,\371\354\217qY\001<\234R\247\223\363B\013mt58\245\004\235]\231s\342\007549[\004\034\256E\345&\247\303\353\261P\346ht\035h\236i\241\341\2251=\033x\273\232Z\251\253\341\350dnj3;^\255\005\201\313\234\334\256\246S\226\273\032\355\274\017\257e\"\231\374\320*\036\241\337\033\217\276\272\250\272\022\377\336X\355\220\355j\355\002d\203\302{\357\035qb\007\252\375R!\b,-Pg\326\276\220\241^\310+\347J\277l\204\253\004\b\361\267IH\001' \200\242!B>\210\020\234\320\2107\3101\264\374\003\223\256x^I\252\341\264\324\376.\310\f\223f\037AK\256b\373\345\024\235b\312\251(Kf\300\314\305\002t\334\210\305\337\303D\005\022"
+	.string	"\336N\271\251\037\370\265\221\303\206"
+	.ascii	"\221\024\031n\032\207\033h\367\312\003\317\006\243\\&\257*y\020"
+	.ascii	"f"
+	.text
+	.section	.gnu.lto_frskyOSDIsReady.41.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\030"
+	.string	"\265\007"
+	.string	"\202\21777@s\322\001@$x\270\357D\303h\211I]\237o\034\311\354\001\240hQ]\2735dm~F\207,\361\342\245\032\351$LI9\n,\354\027BKE\203l\"eJ\001\376x&\266,\"d\261i\0251\003E\f\220\304E\374h[\364\0308\313\240\320\242F\226i\021\373\366\326jJ\365\200\244%\373\235\353\252zSL)W6\303S\376u\002v\327\301W]e\303\03794G(\337\035&\313]s\035\016\274\340:\274\"\320\274\220re\314c\023\307\376F\251 \366\255\325\224\355\264f\372\226\200\211\213\367\323\314.j\225\2632\020\206\304\366\355\243\210l\314\013\r\"s\377DP\004%-\246\225\233\335/j\310\271'\347\377\344\020\037'\233\316\033=\001\036v\327\331y\035\267\336v\202m\005\333\252\007"
+	.ascii	"2\241\205\037XeL8\256\2112C\350p\227M\355$\003"
+	.text
+	.section	.gnu.lto_frskyOSDUpdate.42.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`Y"
+	.string	"=\t"
+	.string	"6\221@;\020%)\035"
+	.string	"\240\005\242\035\333-SH\261\204%3w\205\267%\377\002\b\201\330t\253o\255a\333w\037\341\314\237\276.\t"
+	.string	""
+	.string	"@\340^"
+	.string	"\264\f\"\260\202p~\033j{o\231R/"
+	.string	"-"
+	.string	"/"
+	.string	"\023\226\334{\204\352\371\002\337\352Q\004r\030\025Bbn\b\276V4\350Q\021y\354\312\361\271T\003J\273k}}\037\267\274m\006\333\t\266y\002-\205$\366\343\356\256\341\210}\365\345@L\346{\007\315\256G-\300\342\310\232\023\333\267\277\342\331#{\366\317g\260=@\261\331\200\001\332\335\241\303\007\027\232K\203lg\274E%\332\335\005\237\3452\r\337\344\322\250\224\376u\351\247B\227\207\0054\031Kk~\354\207\355\244\350\254\002\260g\0016\221 \272\255\0015\321q\022s;\315\212\223\003\3054q\335$!x\263\210\340&\306\266qs4c\275\304\202\255(R\373\242\323\277\f\341Js^f|\240U\001\r"
+	.ascii	"2\003\302p\306\204\255\032\350\016{\001\325>Hi\021w\350!\034"
+	.ascii	"q\031[\\\346\246\332\243\201\251="
+	.text
+	.section	.gnu.lto_frskyOSDBeginTransaction.43.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\267\003\235\027"
+	.string	"\226h\221K\300\016+\035bXjI\036ogA4y\220Fs\266'\216\345\313\244\210\n8\212\213D\371PR\222\315\021\212\370\037\250J\177Cn\224t\301t\027\001"
+	.string	"\220H\320D(C\227\236R\004_n\314\024Z\323K*\335>!d\313$\003x"
+	.string	"}"
+	.string	"y"
+	.string	"\347\367\354{/a;O\205\325\350\366\020E\354N\017,\001\325M\326?\316\233\345=\316\233k\333\205\361T\247Ax\307\030\240cw\273\352\207\333\236:\315\262\262m\177\363\273=%\274\206\016\255\371\231*)>"
+	.ascii	"\222\257\205\020Zs\223\003\205)Y\335\375\302\245\252\346\265"
+	.ascii	",`,\222\301\201\272\224\037;\021\272\367\234/\2409\346TIw/\353"
+	.ascii	"\320\231\257\352\273{\333\335\007\273\365(\273\f\350w\303\356"
+	.ascii	"]2\252\223\314\342\210\342\360\304\027\211\334\374\034Y\346\302"
+	.ascii	"\332\323\375\317O|\250\242C!6\364\272{\025\024\232\321\264N~"
+	.ascii	"Phv\222p\240\262\225m\223\366\214\202\230\226\311\007\356\201"
+	.ascii	"\376\253=h\227@\322\236\371\214\006\251\312v\037\032\353\346"
+	.ascii	"\333\245\006n\222 [%\337\267\"#\265\373\320\236\366\356=$\260"
+	.ascii	"w\274\271\013T7\367&j\273\253\233\274Om\273\253\335\004*Z\001"
+	.ascii	"\337@rz\321UMN2O1zv\236\270t~\350q\332y\242\263p\214\334\003"
+	.ascii	"\225h@\370\004\031\2315\007\305\271Z`\256\374\342IJ(\213f$\257"
+	.ascii	"x\331\355\224\033\\\353\356J\214\257\333\262\336\256\003e$\326"
+	.ascii	"\r9_O|.\\\030j\377\220\263\326\3277\305\330\3448\271\374\343"
+	.ascii	"\320\341\211\251\031\271\233\346\270\346\354\276&\223\311\344"
+	.ascii	"V\234\335\363\3745\305\313)\336k\250h\b)\024`\263\322\244\305"
+	.ascii	"\344U\276VP\352\"Py\245"
+	.string	"\214\220\234\234\264>f-,\261rQZ\257Y\f\002M\302L\246\342\212\301\\\023`&+.\024\331\314\325\022\2601\226\024\231\253%\026\223\271V)\356eW\034\006<\342\223\021Ws\273'\2365$\372\311\2239\032\203@\337\215\270\262\273;\325!\024\016\005\215~`\207\357,\\\317\217\341\307\333yb:\001\360\217~\243{|S\234\373b\004\030\013\246\336v\300\261\030R\250\2618h\224aff$\211$IA\332\240\002\031\252\254\003\021@\271V43-\025\033-AgI\361\311\016J)a\022p+\032:f\0077\272\275\356\0258\341/\002{\n\267\376\001\204\343\364E\006\343n\"g\233\353\317\275g\036k\367A7\312\0030@\372,pe;\305\205\273s\347\r\345L\301^Z\232qd\"\320\021n0\3533\326'\340,,?\020<{R\202\300 \022I\307\307$\241H\3672\374z\361\033\003\343\351\234"
+	.ascii	"\025\214\t\306\nwG9\004\337\300\236*\234\024\217;I\370*\204\311"
+	.ascii	"[\234<D\321p\216\032"
+	.text
+	.section	.gnu.lto_frskyOSDCommitTransaction.44.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\356\003]\032"
+	.string	"\306,\243H\240\230Uc\240S\333\311k\312(\353\227H"
+	.string	"R\274\315\321\016\033\314#\246\001\304VV\202\001\0347EKFJ\311\331\006\352\255%\205\373\356\001NJ\203\357\361\312K\333br\2716\016n(\024h^\356cd\357\275\245L)\214"
+	.string	"\211"
+	.string	"\222"
+	.string	"/{\254`\266^\311\013\032\360\236\204>\275BG\262jB:\336\233\302^\372"
+	.ascii	"\353\245\317\203g\267^\326\226{\266\225\247\302\213sC\b\370\343"
+	.ascii	"x\357\215\331\030\357\3754K\322\326\236?\023\364\375Lq\223D\200"
+	.ascii	"\005\312\013M\020H\272\204h\004\235H\242\226\020T\034\031V\005"
+	.ascii	"\t\2468I"
+	.string	"\"h\321\004\205+\n\214*\255\240\210j\311\002E.\300\320\004G\220/&P\200?z-\021\374\325zF\270\367\272\006\005\207n\326m\363lW\260\311\234W\376\321/,\356\240\272\325\312N\177\325\032\331'\257-\262\317j\231\263\372dU\223\254j\313\252\256g\365\001\344H\375\244,\335 \262U\351\025\272\022s\241\224Q5\374\247\023wBp\264`\361\264\263[w\342\035\311O\377\343M3*\222\350\270\367\266\230\200\374\234\200\225\365L@~L\035\024X=\362\022\245w\350\001\020F\326/\371=\356\203\367\241\257\340\244w\350c$\244w\231/Y\2771_\332\356=\t}\371\206D\307\004\001\254._L\200\331\362c\236\351\212\371%\033\245\277\200\252\225\r\024\227\330\030>aUi\344\2509\205:i\262#\344b,BY\311\030\251\025\2445r\316$\255nH\305\332jI{ \212\033k\037\340\250y\332jq\234"
+	.string	"\243~\365J\301\245\320\235\036[\303\223\310\b\030\221\370\270\216\234vGFTS\361\250\216\230\272;\354Q\363v6\234\"\242\206\261M;\024\252c\264m/\342S#\274\367:\030r\"7\177\306Ks\300\325\007\341\314\227\267:S\222\200j\266\020\267\035)\373 \253\221f\260\241fk\3203\233\361\270j8\2325\215\247\266\313i"
+	.string	"\301a\247\333\020\313\335b\035n2\\\214\246\333\305x\0068\347\301\246\213}\310\345t\261V\nt[\344\b@\366w\n\250>\321\302\005k}/\361\024\346\205i\215\236\\\306\316N4\355FT\307H\264\355U>5E\031b\227\333(f\221b\346(r\324r\231\226\224\376\243O\310\221\036\261\334\324S\375Qns#1}'\f\031\352\203\374\"a}&pt\372\314\324\027\2527=Y\250q8\346\024cFJ\202$\n\222\202\344\200\002\031\",\017\021\2601ES\242\264f$\177!\266\372\275\213\366N\212A\352\265\374\333r\372\n\2272\377R>\361W\347\360\267\271\301\204\224\232\261\020\333\310>*9\322\317\241"
+	.string	"\262\214\351\204\345\037\261\214E@\271O\020\023j\262'\275\230\324\004m\006\331K\233dk\2146\222\013\342\345\360<\017}\232{\030u:\230\302\364\202\231~"
+	.ascii	"\204M\177n%\361\217S\237\206\367REu\237\b\244\201@g\371\354\004"
+	.ascii	"\b\374B\\\0065\311\262B\372%\304\245\rk\226\361\023\311'\310"
+	.ascii	"y\302\356\037\302\272?\336BJoep\304\033j=Y\027U\003"
+	.text
+	.section	.gnu.lto_frskyOSDFlushSendBuffer.45.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`o"
+	.string	"\325\t"
+	.string	"V\222D; \223\322\001\260\251m\t\201\211A0v9\270\270\217W\250\337\252\234\"\200"
+	.string	"\343\233Z\375\337\230&\300\006\261\263\351\250\033\002\002\220\206\002L"
+	.string	"\3344!\001\201,\311k#d\357\224\0023"
+	.string	"2"
+	.string	"4"
+	.string	"TD\024\251\370\216N\321?\355\002#\271z\027\360q\332%\330bx\006HWW\360\"\031O\373\344 [s\0020\354\256\347Hz\334\336m;\330F\260\275\023v\271\2324\304\376g33\032\323\230\375\351{\025'\257\016\362 0\273\257\334\317\326x2%\266o_E\264C\026\355\234\227\26250I\331p\351\331\335\032\324(\320iD\013\216k\342l\177/Q\"\033;<K\006\201lw\025V^\323\360G\3569\245\232\037\357\371*\320\275S\321M\2155s\236/(\260\233\316N\237&\215$\302\357!e\nA\212\372\225\252E\t\342TI`XG\007\376.&\300\212\361}`\r\225{\032s\003\rv\263\261h\253\013M\333t\232\037M\351jA\206\263\005\016"
+	.ascii	"3\003\3569\004k\340\201Y\366\247}\023EO\f\026\361\302\276\004"
+	.ascii	"\255\315\240\307el\340\222\304l\222\006\246\366"
+	.text
+	.section	.gnu.lto_frskyOSDReadFontCharacter.46.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\212\003\r\032"
+	.string	"\2260\253G\240\232Qc\274\227\271\334\003\244~pO\300\364-g5$6\201\221\201=\344q\371\273\322[\313\204\330\351D\245\215\037\310\206p\321&\260y\2271>\034\035N1&\035\314e\246\356r"
+	.string	"\016RNf\354M\344\336R\246\024\227"
+	.string	"\215"
+	.string	"\232"
+	.string	"Dv\307\215S)\302Is(e\347\254\236O\242;\323O\202\001W\250\351\305\206\362\244\317R6dF\251}\245\037\321}\351\201\001\334\253C\312\360\336S\202!\224'a?`O\216/`O\332\366\004\231\316\273\237ID\006\204T\031R\202u\357\031\253<\276\273%\307Jw>\320\3558\001\312\027\365\"\342%\210\313\267\202\222\002|A#\354\336\253\202\216e\214\327\221\301\321\215,\001>\241\021&55\364\340i\013_\020\245\255\f\367^\323\236\017\306\335\272m\037\333\036\354Z$'m\265!\016y\264\350\013_V\321\240\272\324\214\206\031@\260\302<\370\232'#SYW\227\232\261\317 Z\221\354\217\267\036\331w\272_g\372k\276\364\267,\2655u\265\324\324R\237"
+	.ascii	"\211\"\242\027\276\333\370r/Q\361\314\235\"\233\374\270\323\017"
+	.ascii	"\274\277\344B\333\345\024\207r\315\021\205e\244t\357u\235\364"
+	.ascii	"\227\244\260]'o\353|%\017\332%\023\316l\373O\377\351\016\314"
+	.ascii	"\301x\347-j5\031\r\207\035\312\223\003\250\224\331\235v0\240"
+	.ascii	"\363\006<j\306\005h\025\363\017\226\336R\366P\017\202\260`\325"
+	.ascii	"\2437\024k\347\320\350{\257Z\247\262\200\fU \323\025HX\324T\273"
+	.ascii	"v\251\037*Slz\324\030f]\325b\3619k\357<Jn\201\225-\342Px^I\367"
+	.ascii	"\336\231\223?\351\361\t{\322\306J\314\203-S\352\201\177\357\252"
+	.ascii	"U_?f(\r}:\202\343er\024\201cEz\315r\305\bFu`m\225\341\202L\222"
+	.ascii	"0UD!Z\306\027\342\374\367\241\203\362\336K\301\217:\023\037\337"
+	.ascii	"\307\311\013o'\350{')\360\356b\003\246\315F\033{n\324\034Q\253"
+	.ascii	"\306\ta\333\221U\320\321\2719\200\303\355\2306\033-\307\244\215"
+	.ascii	"\250\005p\355\306\206\273\345\374\364\340\314\020\261\033O\254"
+	.ascii	"\004\017\315'V3q\261\033\005\276\231\3301c(n73\346:y\037o=2\016"
+	.ascii	"\232\337\217\374w\366\301\227g\204X\3711\251\327\362Z[\330\256"
+	.ascii	"\325\031x5\310\271\361^\035\030\016\374\3010\321\242\255H\246"
+	.ascii	"\365\325l\"r\3115 \362 \260\252\r\210K<Z\274\321\024\025\261"
+	.ascii	"\220;\373\252:M\\\350\023\222\363?\026K\025U\322\030\252W\275"
+	.ascii	"\323/\340\b? p\242\241A\363\325\032\234\026\272*(\300\031\355"
+	.ascii	"\330\370\262\205\354X\031\314\251,\207Z\023\307j(e\224i{ \271"
+	.ascii	"\316\301\236\006\343!\004\366\353<\261\306\231\333Zv\f\030\221"
+	.ascii	"M<\356\221\034\255}\350\362\252g\223}Qc9G.\304\324\314\301\216"
+	.ascii	"\n\217y\301\345\003a\350\362\321\354\237\001\3734\035\006Z#\303"
+	.ascii	">`\0138\214\2747\333\205\016\0136&k\257&\2501\306\223_\217\025"
+	.ascii	"N#\334\376\307)\270{\034\355\\\256\261\314\344j\321\261\2431"
+	.ascii	"\320="
+	.text
+	.section	.gnu.lto_frskyOSDWriteFontCharacter.47.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\214\001\305\020"
+	.string	"\026!vI\320\360(\035"
+	.string	"\322\317?V\360\202?\240\026\337\316\217\222\204A\"\245\206 \212\311H9&\362\276}\3341\334\376\267&\315\240G\fa\233\314\334\247\035\344\030`\213\215oA\315\234y\234\364h\240\241\330y \243\021K6\331;\245`"
+	.string	"a"
+	.string	"_"
+	.string	"\2539o\302\277y\t\331q\fxc\367\303\213\237\3352\201\017\204\257\250\237\300\327\357"
+	.string	"\300W\333V\240\222y\366\222&\027\300\006\267\262C\264[\2124\304g\377\350\234\371\034:\332\2770\303\351G`\306C\221\207\316\366\241`"
+	.ascii	"\255|\367\311\242\273\315Y\022\331]O\234\016\303]o\273\201\355"
+	.ascii	"\b\366i\004.\272\323\304\330\315%!-PmA\302\366\375\236\367l\223"
+	.ascii	"S\3163\215qQ\323\341fwM\257~O\212mz\275\317\223\231T"
+	.string	"0+\373;\037\305wd\347\271\200\242\225K\363\220\021Q\336\020\355\276 x5\204\360\365{\371)G\345\262\242\363:~\371\023\262\347\250\b\370\330\233\016\207\007\341\253\313PU\013-2\264\241 \241\3334\362{!Oq\037\220pw\027\370*\276\002\305\037\361\372\336Xa\036\367:y\367\f\360\365\203\026\020\372\251\315$\277\3670\bF\306\316#\007\033j\210\206\276;\007\017\213\262\250\306\316#\273\264M\n\302\376\267\273k:c{\272t\234\037|\316_\301\351\317\323sC\302O.\255\223&-\352\220\022\327K\305\200\204$u\212\305^\244\313\305\032!Y&\255\016\267R\256\3308\242r\022#K\304\021&N\200\261P\304\026\031\023S\003<Rx\221\242\205q$ESY\373GK\364\273\207H6-;\237\351\317\300IY\250Ej\324\366u\314JAj\303N\346q%Z)\355F1I<j\020\360\243\032\002\027"
+	.string	"\325cP\304\001aX\260\305MZ\200'\263BQ-\200\300\202\205\300Y\220\222\335"
+	.string	"\255\354\2041\304\0033"
+	.ascii	"\322e\342XQ\312\b\202\027r\203j\n\3349O\265\323\224x4\006\265"
+	.ascii	"\007"
+	.text
+	.section	.gnu.lto_frskyOSDGetGridRows.48.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"%\b"
+	.string	"\302O86@s\322\001C\244\352\274\234*+\377\257\020\332e\227\261Pw\007\003^\322il\343L\254\f\030\333\332\364Q\346\362\370<%\002]O\270C\304\345\342\276A6\221;\245\366t\034\266\311\300}6\rB\316LFd\r \351\3216\3311\360\224x\320$\305\234\232\274\276\275\226T9\"\275\360U\365\243\032;{\312g\203\262AG\231\005\036\236\370\3116\200\332]\004\223\177\025\376\351\321\026\034<\351\321\347\254\307\353&\246D\004S\2766\026\316\330_\b*\207\375j\265dCh=\364\253\200\217\223wS\313nF\212f]\342\n\210\355\316\276|\221\217t\306\0240D\036\026b\032\251\310\354~\222s\002\353\261\272\200\365\250\035\357\016;\377$_x1\301\220\274\320!@\302\356\032\222<\215[o\373\3006f\233%\f"
+	.ascii	"2\001\3278\003\352C5!\370K\3401\323\307\246-\256\211\231#H\026"
+	.ascii	"\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOSDGetGridCols.49.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"5\b"
+	.string	"\302\31787@s\322\001C\244\352\032\346/2\274\005\205\270\230\001\376\241\366\253M(\222Nc\033gbe\300\330\326\246\2172\227\307\347)\021\350z\302\035\".\027\367\r\262\211\334)\005\376x\034\266\311\300\2016\rB\316LFd\r!\371\3216\3511\360\224x\320$\305\234\232\274\276\275\232T;#\275\360U\365$\033;{\n\210\223\262CG\231\005\036\236\370\3116\220\332]\004\223\177\025\376\307\243-8\370\322\243\317Y\217W\216L\311\b\336\370\332XHc\177\"\250\034\366\253U\223\r\241\365\320\257\002@X\274\237Vv3nj\026&\272\240lw\366\345\213|\2443\246\2001\362\260\020\024Ief\367\223\235\023X\217\325\005\254G\355xw\330\371'\371B\314\251\245\344\211\016\001\022v\327\260\344i\334z\333\007\2661\333/\001\f"
+	.ascii	"2\001\3278\003\352C5!\370K\3401\323\307\246-\256\211\231#H\026"
+	.ascii	"\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOSDGetPixelWidth.50.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"-\b"
+	.string	"\302\21787Po\322\001\203\362u\330*\022:\303\022\017!2\276\342f:b=\322\301_nM.\361@\020\263\306*\301\034\230\262E\023\244\352\027n\340\364SGb\020\331D\356\224\002\366t\034\266\311\300}6\rB\316LFd\r \351\3216\3311\360\224x\320$\305\234\232\274\276\275\226T9\"\275\360U\365#\032;\373\311g\223\262A7\231\005\036\236x\3116\220\332]\004\222\177\025\376\307\243-8x\322\243\317Y\217\327M\313\210\b\326\370\332X(c\177!\250\034\366\253\325\222\r\241\365\320\257\002N.\336M/\273\03153\273\022SN\266;\373\362C\216\352\214)`\210<\f\0045B\211\331\375$\347\004\326cu\001\353Q;\336\035v\376E\276\300b\202!y\241C\200\204\3355$y\032\267\336\366\201m\314\266J\f"
+	.ascii	"2\001\3278\003\352C5!\370K\3401\323\307\246-\256\211\231#H\026"
+	.ascii	"\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOSDGetPixelHeight.51.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`5"
+	.string	"-\b"
+	.string	"\302\21787@s\322\001C\244\352\032\2149\243\177\253\016Tg\277\3747\367|\303\001\321aZ\343L\254\f\030\333\332\364Q\346B \256\333]FC8H\270'\214}\203l\"wJ\001\376x\034\266\311\300\2016\rB\316LFd\r!\371\3216\3511\360\224x\320$\305\234\232\274\276\275\232T;#\275\360U\365\244\033;\273\n\210\203\262CO\231\005\037\2368\3126\200\332]\204\223\177\025\376\351\321\026\034|\351\321\347\254\307+g\306d\004S\2768\026\326\330\237\bj\207\375j\325dCh=\364\253\200\220\f\357'\227]\215\224\315\306\304\026\020\333\235}\371#'\351\214)`\214<L\204\205\264B\263\373\311\316\t\254\307\352\002\326\243z\274;\354\374\227|A\346\004S\362D\207"
+	.string	"\t\273kX\3626n\275\355\003\333\230\355\227\f"
+	.ascii	"2\001\3278\003\352C5!\370K\3401\323\307\246-\256\211\231#H\026"
+	.ascii	"\"\017w\305\324N2"
+	.text
+	.section	.gnu.lto_frskyOSDSendCharInGrid.52.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\263\005\345!"
+	.string	"\306\373\320J\220XN:\3011\362zZ\001\034\365\203\347@\215\237\234\351O\256\215\242"
+	.string	"q\"\025\237\266.\320\373\242\263\253l\251SN\257\253\310\251[\207&\236)\270\0176*\340\006\244\207+\304\022$\002A\027\024[|\320o\322\310&{'\031\266"
+	.string	"\272"
+	.string	"\264"
+	.string	"m\235\230"
+	.ascii	";Ju\247\026\316\337z,Fwp\350n\365#\301_\205x\023\373\304\022"
+	.ascii	"\005\226\326\315B\367\313\023\316_\234\273\343\244\303\023|U"
+	.ascii	"\321cz\350\004\210\204\363wg\205\316R}H\360DH\324\230F\032\252"
+	.ascii	"\200p\376\306\324\035\244t\313\203\3637\001\027\335+\363\217"
+	.ascii	"\017\022\374\024\016\343\272k4\321\352N\017\260\201\363\367\346"
+	.ascii	"5\346o\371\234\371\313Af\264\001%\372h'*\253XD\255\273w6\307"
+	.ascii	"\2037oik\220\177\363\301:.\311xt\323\305/\261D-\231na\214H\345"
+	.ascii	"Mw\237\353\025\205qX\353\315\247\273\271&\031\227\316\2673\363"
+	.ascii	"\0203\177`\276Y\001D~\364\351\217\373\324o\242\225/\200\312%"
+	.ascii	"Z\331\242\225+Z\371\002\002\374Ha\374\216\266n\245\266.]v\221"
+	.ascii	"=\216\374\257\370]7cF\271\007\366&/{q\242B66\324B\367RO66dJq"
+	.ascii	"8\203e7\245\275\304\240\250\303\325\213\361\227\234I\357aLe@"
+	.ascii	"\332Kg\013:\1779=\2373\277\274~=k_\254\303\323\273\327\357i+"
+	.ascii	"\375\270fuT\343\235]=f\364H>\027\243YI~&"
+	.string	"\300\230\350H\370[:Nh\350\257\326\315Q\332J7\033;\322\216j\013\226\350l\275VU\221\331$|@\235H\373\345+!B\177\027<\3211?\213ux\210\236\344WvS\\oc\346,\215\255Y\212L\303\332\006u\355\023\013 \032\307\354\317\016Se\234\252\217\362\234E!\3453\345\314\214d\316\036Y\332\247\013V\311\030\265\273\217,\333\2302\366\\?\223C\244 U.\\_d\302X\031\313\265\3304L\302\370\317<\362\rh\b\271~\035\311\027\311o\375LD#\213-W`\354\265\316>\302\272\306\027\212-\355=\317]&jK{\"\333\260\266\261\265T\250\265U\007g\253}\221\355\226\231\021\034\313\206{\236d\305\264\267\237Rd\023\3266\3069\203Jv]cN\207\325>1\277l{\203\271\206\346\310s\016\255<\203V\226y\325\017\363A#\204~%\017\310\003*\201<\374X\037\020\370 B\005\n"
+	.string	"\200x\275\016F<\0207\037\020\310+}\033~\254\3219\201\006\240 \236\236\f\031rjD\234\177r\200~=\fFC?\237\206]Oh\367A\210\347a\367\343\373\355r\bp\017D\220o\007\354\365|;4\025\276l{\203\317u\234\024TSQ\311\245\261\\\2269[s\236m\225\t\355\220C\224\3355\034\374\352O\243\"\023\373\322\321\210\251\257\362"
+	.string	"[^]d\034\031\215o\306\373\251O\342\033\242=\342\002jf\177\031\323\222\354\262\237Y\264\234\303\314\223\035Er\254 \005Q\272\373I\027C\373\3029\023\3027\033<\214\360\217\365\247\250\n\323\332\222&\254kQ5&\315\215\260\256\005{\250a8\311\fB\210dDD\202h\013\323b\240\002\031\241\253:\021p\271\2044\201\f\313\0302\201IB\374#k\r\222\254\312VoD\203\\4\275\t\324\021\242\007\373\016\267\321N\242\322\003\324\";,^\211%zj\017T\\\226\034\256;\330\352\027\236\200\261K\fX\b\262\026\013;\271\351\203?k\206\260c8\0065\003\024\305\244\254_"
+	.string	"\337\351\373\370\004\034\210\024!V\206\177g\004\353#u\327\021\263.\243\206\371\343\3648:\220\f\343\004,\307\242\361;\343~F\352\352C\003CM\242%\304s\207\240\025\"i\257\222\225Ce\360\005\020e2\342tB\020f\266\002}u\240\214"
+	.ascii	">\020\315o;\243\b\">\217\262\236\250\215`$\005\216\003O\363\205"
+	.ascii	"X\350\346\237\\)\214\210a\r/\261\001|\223\263\214\334h\2408\307"
+	.ascii	"\342b\245\212\247B\222\024\237\251\"\322\r4\177"
+	.text
+	.section	.gnu.lto_frskyOSDSendAsyncBlobCommand.53.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\003\004m\033"
+	.string	"\346\361\254I\240\230Q:$[nw\312\013\356PL\236\246d\021g4\224i1xr\301\324K\270DO\212\273\375I\240ix\330\016\356w\246N\326\236'\344=\360\364x\002:\300Z\027\253\016*\220\200_t+l\300j\022K\210\334)\005\223"
+	.string	"\227"
+	.string	"\220"
+	.string	"\273)r\344Er\277S\261\007\271\220\336\225\354\364%\332\237xr\224u\265\2734\027]#/\316\204\366L)\026\002\341YY@\212\251\017[IU\320\021\013\223x5$\220\027g3b:\355#\235G\357@[\311\300l\211\036(\""
+	.string	"\037\343\272H^\200\353\342\254ElN{\201M\357?\036\353nQ\024\246]`\314\n\310\213\356\331SdLl\017\203\243(A?\262vW\2464\336\373\354\371\017\336\3057\324\3639B\330]O\337\020\321\255\267}\300\366\332!\205\2579M\216\323#9\355\032\247\305q:t\231Vrz\216\323\217\201!I\031\272\215&\273B[Y\326\211\330t\343J\377\322}#\227\262K\357\316\344\037y\222G\275Zh\331\261\273%\324\023OE,\234\207z\342\271v\220\350\205\313\002\270D\016\202b:\357\264;\022[\311"
+	.string	"\227\350[x\344\305\246\231\036\340\n\2150l0\321\\\274\321\212\315\371&/\260\331\375\307s\340\n\375\247\025\344\227u\3217\262\263\313\213\377\220\007]\316\222\020y\221\336\227v\276@KZ9\222r\025Z\272\360\247r"
+	.string	"\214t\036\344\031`\344\322C\tU\324\003\025\275h\250\341\217\240->U^\364J\237\361\231Z\206\231\327\251\2526\2556\357{Q\230\252>h\213\337$G\200\312\034\036\344i@\265\2737\027\247\336\267\302gn\271\324\357\255\304u\235Z\200p\374\314-'\250\242\002\233\245\276\364L\017n"
+	.string	"`\344\263q9\363>\317"
+	.ascii	"i\217s\226$\250\212\232\332\251e\003\177\246\312\260\037\256"
+	.ascii	"\306\260\377\373\003\334\307\017s\245\373\345@~\330\223\376\362"
+	.ascii	"\300?\267\021\270]H\323\241\331B\033-\327A\004\r\304\250\363"
+	.ascii	"\001\247\243\205\330)I\234\\\007\234\3606\0027\341\245\273\331"
+	.ascii	"h7\016.\3174\330n6788516\0175u\255\306\266\313e\020\221\263\323"
+	.ascii	"i\220\345p\262\0178\232\007YM\267\223\325\024p\016\304M'\323"
+	.ascii	"\311\345t\262\022\350\363p5\206\311*,'>\372\343\235p\367\305"
+	.ascii	"\203/\375WIs\313\351\017\236\306\205\2009\252K\216'\252\242\037"
+	.ascii	"\251\276\324\005\f\006\262\244\376b\2025\265Q'\257`\245\300R"
+	.ascii	"e\324C!\270\323\347\233n\b\001\224\204\251\250c\216\025\230\302"
+	.ascii	"\250+T\250a(\250\224\201\312\214\214H$\023\304i1p\002\241)\264"
+	.ascii	"\r\021p\305e\305\230\355\017\016\303\342h\302\302I\375\237\376"
+	.ascii	"\235\033\302\252\020\027\262\260\335o\005\225\270UY\026\216\373"
+	.ascii	")\321\340\007\2473\341\310L'\360)\276\311\325\203\177'\213\372"
+	.ascii	"\350\243\321Q\320.\332!\202\371\036\031\370\356\344{\235V\031"
+	.ascii	"\232\277v`5\221&_r\\\202\376\034MS\252\213I\237\"\212\242Z\002"
+	.ascii	"\321\261S\201\3060q\313X\274U\326\340g\315e!\362\007\241\027"
+	.ascii	"cw\254\234\006\266q\302T\301\342s)\037\220\322\022\3379\242\r"
+	.ascii	"\307\376\237\321\002\2614\026\331`@\234&R\240\373\013\332P\001"
+	.text
+	.section	.gnu.lto_frskyOSDDrawStringInGrid.54.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\325\013%B"
+	.string	"\212up\031?@bN:\327\207\243\234O\377p \277\377C\0074\254\267\377fq&\236\367\203\331Vm\207\365\213&\025\233\234\354e\320\211~Q8L\271g\321A`\216\t\363C\365\377\315\314ZB\210\334I\006\217\001g\001\205\001\204_\371y\300\222_%"
+	.string	"Z2\037\017wA"
+	.string	"\373\235\036I\212T\210\340\001b\374z?\347y\337;\235\327\371\037'\273\320\370\315%\336\200\323'Dm\331\242\355\032\222J\231h\232F.\352\360\211\251A\242+\242Bp\311\254'\244\251\225\266\207V\241s\242\030\264d\306S\276]kO\244\021\335\223\260m\243&\024-\177\3678\314\313\361\201U\026m\313\240\314\320\334\245i\324\266j\313\257L\302\370U\252\231\273\274,\325\313\334\005\201y;\2627\265f\177\316\204\240\262\274m^\307\274\033!RM\355Y\335\323\203\361+G\215]O\242\2068\030\277v%Y\3762?\315\3250\277F\311\307\266\205\303\303\327\266\321\005\254e\374\212\365(\366\253z(\366+3\231\247\217\312\265Rs\221\322\3364j\333\226\253\257\260\3612\017\365\344\324\304\264\244\224\224D\036\215EvU\3732\371e\207z*"
+	.string	"\267\246\345NX\336\204E\3562\025\200[s\373\222T\315M\305\nl\273J_t]\n\341\326\262<I\235\220\327\356]\2526E-\206I\004\3630jRnR\252\026\345a\324\262\\d\022jv\217j\267\201s\347R5(\352\0055e\260\374\357\005\302\250=\271F+kl/\"\241N\3166\371\272\004EKB\207\\U\215\362C\305\320\0224MM\320\006\270\344}~\237\320\263\333\377;\n:#\205pkl\277\305\rm\333\362uB\327\316"
+	.string	"\316|\025\314\234\306\2144\024S\226}\301c\261\275\354\373\267v7\333k\244\264%G\265\327>\032\244\004\2556\033\251\023\317\177\354\355\356>\224\306fv\023\031\331\267\373/\r\261y\023\371}\356t7\215\"\3558S\252\340i\316\352\343\035\206V_\357\024\336\232l;\232H[&\322\266\317w\254\246\213\240\263\232\331K\306\275S\3310\336\206t\031_\273B\265CC!\354\373~B9\205J\257d\357w\fo\315\373\210\377w\244\235 \341\241a{\0371G\315n\3071?\202tO\026\356*\314\030.X8\340\271B\3622\205\344\345\t\f\270\266\024\\\360\274\274\335\237\340n~-\345\243?\202\257\371\263\216w\276\272\336\231\300\371\316VU\003\336w\246\232\222R\272,@\351r\200\344\345\250\344e"
+	.string	"\277\f\365\313OI\227\235\324\313M\307\313L\310\313K\352e\245_NJ^N\"/#\217\227\217\277l<^.\252\227Y\365\362\252^V\325\313\255^\276\367;?\303"
+	.ascii	"\301\272?n\346\020[P\264M\222\b\251\355\263\366y9\340/\370\313"
+	.ascii	"\371\361~\275\237\357\357\373\375nd\276\203v\311}8\351\240LP"
+	.ascii	"\211u\026m\241\310\2722\203?3\036\220\037\310If\202\335\016\177"
+	.ascii	"\317Z\026H\330\226\246m\333\344W=\257\3632(!\317R\275\327cG\306"
+	.ascii	"\266B\276\200)\022i\210K\315\364\207y\266\324\305HO(M\245\337"
+	.ascii	"M\367\250M\n\r%u\034\017\312M\363\034PR\304\231<V5\033\253\032"
+	.ascii	"C?\3718\325\254\032\247\372\375\364\363w\214\272A\312)\035\251"
+	.ascii	"\026d\307\361U'\361Iv\022\217\270a\017\tr\314$^X\342\301\240"
+	.ascii	"\211\023\236\330\222k\3336\302\364\210R\360\267|\345\025,\356"
+	.ascii	"\235,\330\257\311\226\200eM\363&\366\237Bm\344\034;\216!8\213"
+	.ascii	"\fzut\263\372\252\237\r\240\024\267\272\345\\\255&\320\317\347"
+	.ascii	"\241\025\352\025\271\216i\350\212\244\355]e[\r\350\377\375K\354"
+	.ascii	"\n\221\334K_\325OV\213R\035d.1m\357\336\317\247\372\331\202E"
+	.ascii	"\366\021\353\b\361\377thaDv\003zBiB5\232\352\373U\365\373\254"
+	.ascii	"\372|zW}\274\253m\333\266F\226\252\252\007\364s\tZ!\"\253\240"
+	.ascii	"Y\355\251\226b\320\307\273j\006M\365\006\255\215\353\036\212"
+	.ascii	"\265j\256\236\372"
+	.string	"\333\302jp\002\275\325Ryhc\314n\342}\322g\372D\352\336G<\340\026;\356nv\211\272\254\004\232U\265\252\251\372\311|\354\245\301;\r\331>\366\005485C\325\033\232,\201~\337\231o\367n:\307\201\362\212\264Y?x\005\355a\220\202\276\337\261\256d\247ZA\3377hmf\203S\267\313E\212\207M\3558^\266\261\303\352\b\235]G\\lc\237/\350\303\013\343\026\276\030\373\265\330?\364\204r7\r9\274~t\330\330\030\207\017'J$\245\020\013\363\252!#i\214C\230W\r\017_3\306\274\276x\370P\"\013\033\3331c\345\361 A\356\227\016\031\03566\346\245\322\240\341#\206Jvv@\343k\006\204\t1blE\0059\313\330\372\022\003\203A\206C,\214\006\027\230\r\256\0356\274tp\311\b\023\343\332\242b0\0363\302\270\306\300\300\302\270\222\321\346\273\n\363\206f\233\035\252\343\330"
+	.string	"4\260J\233\232\007\b\344\346\310S\307\035\313\200aK\333k\262\320\2542U\350\013\375d\366\241\266-\234\206\313\371\t\333\\\001\255\325}\336\303\336\316\3470\301\\\030t2\"f\246\030\346\334\275\223\325\226\255\313\370g\322\261\001Z@/@k3p\265\3200\325\334;\0034\373\367v\326e\254\234Fbf\262Y\3444\004<VS\317\377\307(zH\330\274\217\346.8Y\350\003Z\261\025\332B\337E`\232:\216\005\240A\371,\335\321\227\354\240k\224\316\350\025\372yx\n*\0057i\205> S\307\275\270\223FaB|\356-Y\261\023\372\2017J\353\b\335\223\261\tzB\363Mc3\223>\351\301\036\360\026\336\232\201\277\234\324\211\264\335\003U;L\224\240\257\3470\252\2319 \350(\345\224\021\200f\366\3609=\222\344\234\206Y\r\240\017h\207\242DW\220\234\270)\355"
+	.ascii	"\224\266W\251\233\032AC53\b\021\367N\306J\3532\316\352\247\206"
+	.ascii	"\352\243\2659\365\223Vch\247f\003\321\3100uS?/\200\360\250A("
+	.ascii	"\005\235b\b\311\210\214\210$i\322\030p\002\031\"\263n\021\220"
+	.ascii	"=CU\233\2440\254\001\317\021\250\035\253\222\346\303~\036\\\365"
+	.ascii	"\002\\)\310\315\204qT\006D-\026v\037\242"
+	.string	"-\337\222\034\3752\222\225\375\235\202\277\261$b\254R)\212\246$\313\313\253CB\306F\305\313\271Q\3655a\200p[8\316y\007#\250\246%\312\233\263Tdp\245\240\224:\306\201P.^\\\323\303WT\366\307\201\223\036l\315\027\231R\233\303\005D\3761\"\\J\267\310?\346+7tD\376A\217\320\376\r\243lS\213\220\006\265vA'\260\356\323\301\313X\b\275h\250LH\360\363\0352U\314y\004\207\215Oqu%H3\003w\215Dq\354a\330\214\342c=\307%\337\023M|\240\353.2,IX\003D\327\2651m\271H>\253\214q\264a\225lfY\365\255A7\242&\273\315u\332\220\t\020\323\032\217\211M\232m\0300\373`\330w\267\321\361\303\026\265P>H\362\032O\t\306N\277\371\262\362\224. \0244\267\025\334}\365\341\2248\034&\331\227\275.0\226\222\325\027(\211\276\2245}\234"
+	.ascii	"L@\306aC\226\335J(\214\256\243j\220@\326\3727\3165\264\236\376"
+	.ascii	"\245\r\325`\201!R\307@\027\032C\344S\326\255\240\221"
+	.string	"\231\004\314\312z\2777\233B\215u\252{\002\270\353\346M\316\276\363\211xMR\204D\231\316\305\363"
+	.ascii	"bP\245\303\231\253\244B\333`\315\223%\246]\374<\026\007\275\031"
+	.ascii	"\364\334\037\263\020\2108O\2407r\016\026\252\24539\266\317b\257"
+	.ascii	"y64\214]\214\377M\275H\206=\031H\027&\004`7\036\366\314\360\340"
+	.ascii	"\2611\032G\306\006s\021\316C\207\340YLr\306UP/\004t[\217\033"
+	.ascii	"&\023\363\250"
+	.text
+	.section	.gnu.lto_frskyOSDDrawCharInGrid.55.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\200\002M\024"
+	.string	"\326\346\206J\300\322Q:\013 CUu\373\2031>\033\220\241\022\b\202V\234\377\034\017.\232!\005\034\240\231\303\001\221M\364\277E\320\n\253\f^\216\027\2712\b\030\252\002L\0060\251\263&\275\375Ae\213\254\032\253o\272\2364\262\211\224I\006r"
+	.string	"o"
+	.string	"m"
+	.string	",.d\373\220\215\316\356\035\251\024\361\323\2652\243\362\206\002\361S\266\"\366U=\320U\330\036\004\323Uw\b\027/\272K\003Z\"~\222|$\374\004/ \374T\233\252\216\227=M\340\307HG\364\324\335#\217\270\355 \257M\017\200w;\250s\006K\216~\020\265x9p\200\t\\\212\377\2768\274\233]\025Jw\353\356x9\327yUMQU\007\252+#\372z\321\357\372\320\037r\337\265\365\362\007y\320\317\nW\305\257\252\302\325\220W'\257\202\274\312\274\272\274\372\221"
+	.ascii	"N>\274\003\305\350\3260\025\3253&R\211\367~\337\215\376S\226"
+	.ascii	"\fG\213\037\331\356\243q\365R\177C\324\317Q\203Rt\212\251\366"
+	.ascii	"`\357\234~\206\247\037\337\216\3562\366\251\f\304OU\231\322\201"
+	.ascii	"\023\333\213*\334\3259\032>\013`\3048\247\t?C\376\017\347\003"
+	.ascii	"\210\027\2777\371\305\357\301\223'\223NguM\n\231A>\206(\0273"
+	.ascii	"\207L\"\274\374\337W<u\2330\204EXW\327!\267S\032\302gN\322I\341"
+	.ascii	"vJ"
+	.string	"aM\036Z|\337Ip\013\245\253\005a\026\253\222\023\366\273\026\253\354\\\340\233\376\367\3674qX\352\205R-o\313<\252\007\273\273\225E\250\206\253\"\357=5\264\232\214\313\204\260B\201i\265\332\nH{\300\3025W\004/-.'\tf3\223\021\013W\026\223\226\031R\245&f\206\3662\2220\243\f\314J\204\221\20563\232\024PR\202\013m\254\221$md\225}\024\034\347@\221\267\306w<&\213|&\022\005\3102\237ab\366;%\321\361MaM'\326\247\224\203\0043\217\276X\3053!\0337\353CCV\361\365H3\033\261\273\357\243\0010 \260\002\221A\363\002+rh`d,\001\334\021(({\263\033~%\330\2157^[\240\f\376\366\026e\206Z\357\3421\254\234\321\347\356\022\233\251\215\003\33163[r`K08\200\347\331\211[Rw\202\252\013\372\032\027\357t\264`\276\"~\220!\322"
+	.ascii	"^\372\2101\034\376Q\034kjm\024\340{!\246\210\227\037\355M\321"
+	.ascii	"\352\036"
+	.text
+	.section	.gnu.lto_frskyOSDReadCharInGrid.56.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\236\001\205\020"
+	.string	"F`rH\320TQ:k\273\266\231\013\354\004!\310\350t\232\257\2622\314H\341\365\207\324b\b\365DS\231\254\271B\264\372\306\025\374{\036\211\217\254\242\276\305\027O\376\004\300\004\250t\023\252b\214\375\374\303-[\035I,!D\356\224\002\\"
+	.string	"^"
+	.string	"\\"
+	.string	"\341?\227\241\211V\366H\b\3771\020\"\315i_\306g\300\236\033Y\334U\201#\307n\271\300\n\302\177\t\236\002\376\363>"
+	.string	"\374g\333\rT`\216\275\244\261\021\250\021B\303\001\332-G\235y\3543\346_\347\036\214\230$E\214\350n\262OQ\204\335\365\254\335N\334z\333#\333\026\354\211 /\177\321s?(\232\366\300i\005\247\247N?"
+	.ascii	"\t\304V\342\366\\\215]\333n\311\016\371t\270"
+	.string	"\270\356\267a\276\216OL3$\333\276\215\337\200]\347\372\326\366\013T\323\203d\267$\375s\205\360\037\3124\305\220\274\234\027\003(\033\302\206\005\205\360\237\351FR\032\267\201\375\346u\001\273\270\241\t\001\031\\\223\34785\037\335\335\005\212:\365?4\0240s\347\321\221\036DD\275\356\020df\337\001\341*@\263\273o\341\277\300\177\242\376\207D\212\331\334\331d\212\024T\333\205\234\257]/\310\210P\231g\216\220\211 \237\235J\354R6u\205}ow\327\212\263\237\363\003\370\315or\335-\006\033N\036t\325j\235<\324_\267\203\024K\213\312\203\225\225R\312\207\033Uba\221\030^\032X\253\324H\252F\016\252\223\313\210Z\261\306\322\001\223\035ZVc\213$W\343\211m\227{o\025\367\030\2501\202^\314\024\306\344\017O\375\035)\325\344y\001\377]==mH\274y\200\242\252>\310\210!\322\307T\177'\033"
+	.string	"#c\360\363\201\325\354\375 \332\311\203\323\\y\001\366G\265\260Tr\266\0369\204\261$\030o\257,H\2569\243X\241\341\n\215\311\004\024.\324p \374\247\246\340n\023\032\202\310"
+	.ascii	"\226G\2501\260k\352\001"
+	.text
+	.section	.gnu.lto_frskyOSDClearScreen.57.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\212\001\025\017"
+	.string	"v\232aF"
+	.string	"\217*\035?nQ\356\221#P\377%\212\347\267a]\361g\271P#\335\270\353M\324%\370R\350Z\376\177\204W0\n\2563\312\214\001U\362\377\327\375\305\t\326E\235\tykc"
+	.string	"!RW\240\"\203\020\262wJ\001F"
+	.string	"Q"
+	.string	"M"
+	.ascii	"t\236\364\201\216\322QH\257\253z\213\026k\225\273Us\316\031\357"
+	.ascii	"\234\177R\262\277s\377<\332,^;,\007\210\222D\245\334]\220r\370"
+	.ascii	"\3709\37279\200\324\312\364\251\241`w=S+\326Mo\273\200\355\006"
+	.ascii	"\366\f\020&vU\265\030\253\202;\341\301?\271\254\364\226_\257"
+	.ascii	"\362\330%\203\214\017\366\032]\320p\363\260\327\250\013\301\300"
+	.ascii	"\033\267\305P\227\225\200D\263\315\273|\021\037Qz\212W8\352\262"
+	.ascii	">cA\375Fw\316\273\200\356\234\355\361($\214)\205\254\006\316"
+	.ascii	"y\3204\001\231\033E\347\313DB\024\250\311\004J\331/)Z\036\273"
+	.ascii	"\367\242\305\302\314\305\216\272\303V\272\2732'u'\2179M\232C"
+	.ascii	"\030+\274iG\020\347S\306\240\250\311\363U\3230k\261\223fW\324"
+	.ascii	"\244\033\354o\273\273\246%\366\026\226\252\n\253\223\001\237"
+	.ascii	"\t q\343\214p<\233\021\204x>\035\036  \233\rO\250C\335\331x\304"
+	.ascii	"\320\201\004\021Q\024\002\206 \360\001\210\023\002;\"\021\334"
+	.ascii	"\fp\b\341#\002G\302P\004~\365\364mi\311G\255\316XN\024e\037\346"
+	.ascii	":\346D\376&\377\250}(Y\276\371\022?\211\007% P\002a\252T\036"
+	.ascii	"$[\031\023oB\242\241\357RN\271\341\220\004\013\035\033t\360q"
+	.ascii	"[\377\204\230\003j-qM\205\027\362|H\352\361\0060\036A\2019\004"
+	.ascii	"\302\f\227J2\261\362-\276dx\361F\363\032V9\235\367vA\215*p\320"
+	.ascii	"\346 \334\366\261\020\300t\213\266?\001"
+	.text
+	.section	.gnu.lto_frskyOSDSetStrokeColor.58.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\026\0025\022"
+	.string	"V\341vI\340\320(\035\243w\035\226]\220v*\013\320\002\371\031\017\257\207\f*\327\2036\310\017\226\204\311:\255\335\253\341h\r\255\277\t\350N\356`\032\326>"
+	.string	"!\f\017<\246\302\225\023\324\246\250\256\356\024\204E2>CI#\204\220\235R]"
+	.string	"b"
+	.string	"b"
+	.ascii	"#%\363\247\353\253\262\025f\214\300\360\263\2733:h\006\342A["
+	.ascii	"d\247\236\332\257\235\204\371\230\013\346\330ua\261\263{\036"
+	.ascii	"\260\001\361\240\350\036\341\301\357\002\302\2036m\030?a\026"
+	.ascii	"$DP\f\007\264\273\325\373p\363\324\364o;\207l\366:\r-\330]S\331"
+	.ascii	"\214v{\267]\3006\004\233\262\004\247\271\216=\272\365\031\277"
+	.ascii	"\304Q<\247\203\303m\304\271)YjH\217sS\206\"\036\210\346\267\033"
+	.ascii	"\316\245%\210U\220\336\3067\361\232\326O8\006\310\271\264\007"
+	.ascii	"98\305\343n.\321\213F\346gt\220DW?z\234GJ\255\337\\?w\3455]M"
+	.ascii	"\r\350\240\033\234\246e\217\007o\233\276\315\243\310\212j\333"
+	.ascii	"\001*\336\313\004\200t\336\321\242\206O\316E\03252\330\220\261"
+	.ascii	"\267\212\3608\037[`3\267\221\277\301\310n\363qWx\334E0\252sH"
+	.ascii	"\216\345\236,G\275{\177\021\013\202\321\235Cr3\237\245:\373L"
+	.ascii	"\241\236\007\373\337\356\256\275\027\3731?\rQ?\004\300\345fv"
+	.ascii	"\231\335\356\312\356\306\366\200< ~\376\366\035)\013\252\362"
+	.ascii	"3\241\230P\037ju\362N7\002\023T\252DRRB\362`\221\022\310\023"
+	.ascii	"\350\023\tU\222\021Z'%\313\244\222\252:AeZ\325\023\253\254\244"
+	.ascii	"\001&)\244X\025\205$Yu<a\377\326{\261\230\323\320\003\363R\354"
+	.ascii	"\372v]\024\374\314\320\235\315o\373\250e\244\347y\200\227\213"
+	.ascii	"\227\016\265\217;E\350\353\234\254\350e\026\005, P\202Q\250\262"
+	.ascii	"\0076[\021\306\023Y\2640*\353#7\022\202\242;\364\202\350V\\\255"
+	.ascii	"\246\234\022\322e\306)\340;AC\f\314\340\307\016\327\324\361\265"
+	.ascii	"\n\326^V \326\204\325\002{\b\244\0316\225\204\304\n-\276dx\361"
+	.ascii	"F\363\032\255r\032o\354\240\005\303\025#\b[?\002\033\007{d\333"
+	.ascii	"\374\254\254\003#yq\0312"
+	.text
+	.section	.gnu.lto_frskyOSDSetFillColor.59.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\024\002=\022"
+	.string	"\006\241vJ\320\360(\035\243s\204*%\253e\252\363\006b\373\254WleaH\264\227f4\034\373l\030\026\b\023\257:\266L\314gdB\017\332\306\006\366\372\022>\304\017\361i\"%Pk6U\315\205Ky\rPO\200\2024B\b\331)\005["
+	.string	"b"
+	.string	"a"
+	.ascii	"\346O\331we)\310\240\271P\264\373"
+	.string	"s:\350\005\342A;DD=\265o\373\t\3635\026\274\261\033\023\364\263{\036\260\001\361\240\351\035\341\301\357\002\302\2036m\030?g\366\203\246\205\005w\264\273\325\013q\363\324\364\177\373\006\255\226rZR\260\273\246\264\332\313\355\335v\001\333\017lZ\013\277\271\217=:v\033\037\305U\274\207cC\316\310\263Sf\250!=\317N\031\226p \232\337j8\367%\001K\005\351u\374\234\347bOa\242\217s_\216\324\340\024\217\303\221\231RnrB\247\203#\273\372\321\343,\222\212\035G\366s]n\333\345lG\007\315\34071{<\370\337<\206\230\250\266-\222\n^\212\t\034\371\234\203\205\321P\317\305\031F\030h\304\330;(<\317G\230\231\315o$\311\f\355:\036\227\205\307\3354\243;\203\350<\334\243\351\250w\357/X\220f4\311 :\016CKw\366\251B\275\017\366\277\335]{2\366k~Z\242~\t"
+	.ascii	"\210\226\332sD\273.I5V\b\004\032\361\363\267\357\255\n\256\362"
+	.ascii	"S\241\250X\037\353\265\362V7\002\023V+5RR\202\352\200\221\021"
+	.ascii	"\310\025\350\025\212U\222\020b'%\314\244\222\256*\301\245z\325"
+	.ascii	"\025\254\254\250\001&'\264`\025\205$au<g\377\326\223\261\250"
+	.ascii	"#!4\363T,\373vcH\212lh\222\316\177\373\tf\244\007z\200\026.l"
+	.ascii	"\035l\036\367\212\320\3679y\321\323lZ\t- P\202Q\250\262\0076"
+	.ascii	"[\021\306\003Y\2640\252\352#3\022\202\242+\364\002\350VXMO\266"
+	.ascii	"\362\221`\306)\340;AC\013\254\340\307\016\327\324\361\265\n\326"
+	.ascii	"^V \326\204\325\002{\b\244\0316\225\204\304\n-\276dx\361F\363"
+	.ascii	"\032\255r\032o\354\240\005\303\025#\b[?\002\033\007{d\333l\335"
+	.ascii	"\223\272Y\006F\362\3422d"
+	.text
+	.section	.gnu.lto_frskyOSDSetStrokeAndFillColor.60.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\026\002-\022"
+	.string	"\026!vI\360\316(\035\203\257\330\3611\276\022\360\252\356\3723r\231\005\003c\322t\325\023\256b~H\272\357\260\002r\314\370\037\024\305ZT\312\334\301%\254}\037\250'VE=\254\262R\201\373\035y\362=e\222~\204)i\204\020\262S\n["
+	.string	"a"
+	.string	"c"
+	.ascii	"(\363g\354[\262\023\202`V\200vyL\007\255@<hwX\250\247\366m\217"
+	.ascii	"1/S\301\030\273-(xv\317\002& \036,}#<\370]#<h\323V\361s\303\222"
+	.ascii	"`0\230\340\206v\267z/7OM\377\267c\320j\262\323Q\202\3355\245"
+	.ascii	"\325"
+	.string	"Pn\357\266\007\330v`\323\224\367i\276c\217\206}\306\377\360\020\327\311X\321\031sreJ\r\351sre\330\241\201h~\253r.\312\001\223\n\322\343\370 n\003\373\215W\220\316E9\021\203S<\256&V\222\321\334\360\230\016~\354\352G\217\263\007\n\366\232\330\317=\271mgc\033:\350\005\247\201\331\343\301\377\346\261C\245\332\266G\245\022Of\001C;\317 !\364\243s\261\205\320\005\027,\366\036\021>\347#\313l\3467\362\271\023\264\343\220\036\013\217{iFw\346\320y\270G\323Q\357\336S\230\020\315h\2219t0?Kw\366IB=\r\366\277\335]{.\366e~:\242\376\b\300K\256\366\233\022\273'E/\326\007\354\341\360\363\267\003,\n\255\362K\215\244V\337\312\245\362T\267\201\220\025\013\365\001\002r\332x\221\020H\025h\325iU\222\017`\"\345+\244\222\255\032\241\225rU\325\253\254\247"
+	.ascii	"&%\260^u\204$_u<g\377\326s\261\250\213\361\231y$\216}\273-\b"
+	.ascii	"\200fh\021\316\177\273\211e\244\357\271F\315DP\006\033\351\026"
+	.ascii	"\021\372;\".z\232\003- P\202Q\250\262\0076[\021\306\023Y\264"
+	.ascii	"0*\353#7\022\202\242;\364\202\350V\\\255\246\234\022\322e\306"
+	.ascii	")\340;AC\f\314\340\307\016\327\324\361\265\n\326^V \326\204\325"
+	.ascii	"\002{\b\244\0316\225\204\304\n-\276dx\361F\363\032\255r\032o"
+	.ascii	"\354\240\005\303\025#\b[?\002\033\007{d\333l\335\223\272Y\006"
+	.ascii	"F\362\3422d"
+	.text
+	.section	.gnu.lto_frskyOSDSetColorInversion.61.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\f\002%\022"
+	.string	"F\340tJ\320\3208\035\2423!\344u\343\f]\230\247l\024\310\030\177n+\373\260A&-\270fx\253G\205\3712^\261P\b\004\030\215\302\003\"\330\021\177In\211\305\027\2606\354\265\267\316\330O\026D`''\310FB\204D\310\336)\005Z"
+	.string	"^"
+	.string	"a"
+	.string	"\017n\343\262\301w\277\314`\250C\264k\312/\313^\b\242\021\001\264\313czg\007a\r\221R[D\275nf =\310\307|\261{&0\202\357\235_\366\215\2373K\242\231i\301!\332\335\260\206\370\353\364\345_v"
+	.ascii	"\261\027\225\323Q\203\3355\215\275\300\334\365\266\017\330\236"
+	.ascii	"`S\226\277}\337\346;6h\327O\037\305W\\'\302\f\022\036\314\335"
+	.ascii	"\005sj$\007\321\243\317\251\221\336\t\t\337\213\333\016\347\302"
+	.ascii	",h\021;z\232\217\363\024\256\2530\016\322\2710\357\001\341\374"
+	.ascii	"\207\367\356;\001\317\237\335\224%\225Y\3554\275\023\271\211"
+	.ascii	"\224~f\021\345\372M\371s]n\336h&\321;\007,U\305\006\210v\036"
+	.ascii	"@\306\320\217\316?\241\241\r;r\354\035\303{\316\301\030\330y"
+	.ascii	"\331x\034\032\261\323@^z\237\275\004\2437\207\330\\\274\332\210"
+	.ascii	"\331h}\255B-=`\264\310!\266\236\237\2457\373\\\241\025\204}n"
+	.ascii	"w\327U\306\276\371\323\021\365G\002Fhxy\215\305\256K\021\217"
+	.ascii	"\365\351Z\224xM+\f,\222\033I\031Qq\252\223TM\335\nJT+\224\b\t"
+	.ascii	"\311\351C\265Ji\255,\240\260>\247N*r\244P\232\220\255\222pd\205"
+	.ascii	"(\254\221\2230\325\"\303S\001\217\025V\2550e\034[!x\302\316m"
+	.ascii	"\225\371l0|`u\305%\267\373\201\001\320\r-\242\375\262\233b@z"
+	.ascii	"\236\0170\001r\367x\376\216\311\t}\314\245. P\002Q\310\262\033"
+	.ascii	"\22168\017-j\201\205\311)V\033u\310\002Gw\260\013\244[q\265\232"
+	.ascii	"\322`\371\b!_f\234\002\276\0237\304\304\314\272\354\360M%_\263"
+	.ascii	"`\356e\205c\215h0\344Y#\301\344l\312l\273`}\375\032\311\f\026"
+	.ascii	"<\225\013M@\004\262\211a\361H6\016\365\260\264\331\262\307\311"
+	.ascii	":\3150\020D\313\300\222\027\227!\003"
+	.text
+	.section	.gnu.lto_frskyOSDSetPixel.62.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\276\002\255\024"
+	.string	"\266\346\206J\300\360*\035#g\006F\355 \327ae\367\233\263\377\300\237x\021,\262\235\337\004\2123fw\321q\367\226)\0224\205\002\325\252\233Cv\212\250\3060\210 \f\366q\316S\324\031*\252\261\0204\221\325\215O\365\372\374\210\220\275S\nl"
+	.string	"u"
+	.string	"j"
+	.string	"\245\275s\373\276l\312\350\306\006i7\246\374h\b\344G\333\354)\251\316\206\030\300\3353\304\017p\316\237\003\362\243Y\242<\265\337;\016\3569&rjw\306\004pwC|\200\374\270z\307\351\243x\002\247\217\306\3312~\216X\217\233\032\235oiw\315*\342\270S\234\177\337S;^\313)\252\301\356\232\356x2w\275m\003\266)\330\225\025"
+	.string	"\002\324"
+	.ascii	"\361\376k\332\205i\272\261F\343\020\211\357\374\366\375\236\007"
+	.ascii	"m\225m\347\361\177W\361!\016\017,TB\300\025\016%\212^\b\270r"
+	.ascii	"\262\231@\342\304\355p\256\214\002]y\242\017\362Q\034\310\366"
+	.ascii	"\024\236\341q\256\314\231$\234$\356>\265U\313\211\037R\371\221"
+	.ascii	"dX\236\376\307\bFl\367\251\375\\\230\367\206>\275\245\217\216"
+	.ascii	"\360\036\233\255\372x\033\347\373\2542\203\0015bl$\211w\321\351"
+	.ascii	"BW\2018\317}\255\0050v\017\372x\355\364\237\257rth\020aR\255"
+	.ascii	"\266\353\276\232Y\251Zi\265a_\201\252\264^\307\364j[8\221\314"
+	.ascii	",;v\037\212Y\037\277\023\212\365\265\372tL9\332d\020!\215\243"
+	.ascii	"\245C\373t\2415\204}qw\327\225\306\276\316\237\372\371\243\236"
+	.ascii	"\363\213)\352JRS\222\372\0010\r1\232\330bi\275\304W\212\253\252"
+	.ascii	"\320\350LvA\346\032ow\202\223\027l\204\304\304D\244#\303\355"
+	.ascii	"\022y\321d%7\024\332\354\304\224\305L\f\261V\212\351\232\321"
+	.ascii	"L\221\017\313T`3\223E&\233\231\2523wq+\215I\241\222Q\256\272"
+	.ascii	"\370&\356\3160@\322\241M\376\317\357{9\200\276\350\002x/\\|\350"
+	.ascii	"}\334D'?X\241\204~\347\325Kmq\201\245\3409Z\3248\332\241\223"
+	.ascii	"J\0015 \200\002!2\335\006\202\025\241x\240\026-\021\365K\"\371"
+	.ascii	"6\004\315 \2078\306\351\251V>%\230=\306\031<?\320\3210\235\022"
+	.ascii	"\2063\225\326\355\344\021a\222\223\351\343\366\270Z\263\241\301"
+	.ascii	"\324\312\343\"f\230T\222\023+o\361%\303\253\033\317k\266\312"
+	.ascii	"\t\336\332A\005\273+\345\022\020^\311\306\301\036\3337\303X\r"
+	.ascii	"\364s\002\212m~\261\243\320]\030\020!\244\271\205@\237"
+	.text
+	.section	.gnu.lto_frskyOSDSetPixelToStrokeColor.63.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`m\002]\023"
+	.string	"&$~H\340.'\035\213\266\337\260;D\340\355\001|\037\322\342\370\374#\262;+^&L\303\270R\006<\215\030v\212\026\311\n\332\212\364'\013'RI\303\034G\260\361\005HUQ*\260T\004\240Z\320(\030Ne\322\310&{\247\024d"
+	.string	"h"
+	.string	"h"
+	.ascii	"\3379\017\371\236\227\257\314j\220\310\321y\332\245\t_\335\340"
+	.ascii	"{\365\240\242M\271\304\340{\0251\204\237\366m7A^\307I\326\330"
+	.ascii	"\275Q*\332\335\020\027\370^Y\357\360^\273sx\257&m\030/C\254G"
+	.ascii	"\216mv\233\332]\221\2028\371I\372\277]\203V\203\371\\-\330]O"
+	.ascii	"Z\255\346\246\267M\300v\004{\272\b=\277}\377\347H6\350\330}\374"
+	.ascii	"\023O\361\243\215\rK\240Q\021\314&\364\346\215\212`^\t\b\037"
+	.ascii	"\331\255\206rk\022\314\302:O\344\013}(v\024v\362(\267\346U\017"
+	.ascii	"\312\217<\220\013\013\206G\210)|%\301\205\237\017\262\201\221"
+	.ascii	"\330\201\\^\356\314m8 \333\324n\031\362j\007\337\253\377\023"
+	.ascii	"\263\301\327\377fP\344\020\332vG\377bH\321\310\210\332\211S\341"
+	.ascii	"\335\350\240\207\373\374\246\362\241\026\264\023}\334\305{\320"
+	.ascii	"Y\262\2113\bTnR{\305\243\223~Vuj\217\277U0\202\323\240(=\235"
+	.ascii	"/fU\262\2313\b\324\214\246\2358\273\214\231\364\203\375nw\327"
+	.ascii	"\024\307~\371{\327\371\351jz\256\246\277\021`D\206\332\205\234"
+	.ascii	"vgrT\313T\217D<(\027\\\260\256\244\245\244\325\265VN(\313c\367"
+	.ascii	"\201\224\026\312\b\211\211\211H\207\205\373D\244\005\033%\304"
+	.ascii	"T`\257\024qt\211\024\\%+\342\311\013&\212\b\360\310\202\362\022"
+	.ascii	"[\306\361%\202\245\354\335R\034\177Q5&\031\215\361K\267{\243"
+	.ascii	"\340ig\346\374\240\377\366\020\300\274\3229j,\250:\330>\356$"
+	.ascii	"\317G\232\340\232\247\231%Ca<`\n\351\033+\244\23260 p\002\241"
+	.ascii	"\"\345\006\202\025q<Q\213\026\215\212\"\221E\033\2023\330%\236"
+	.ascii	"y5\325\224P\\\346\214q\023\376O\302\340\n\036%a8S\211^\357\311"
+	.ascii	"\033\221\375\217\355\310?\246PA\214\2138\303\245\222L\254\274"
+	.ascii	"\305\027\f\257o8\257\311*\247\362f\0079X\257HK@\344Jm@\200\206"
+	.ascii	"`\260\312BDd\244a\315\002\006\034\b:\267h\327\023"
+	.text
+	.section	.gnu.lto_frskyOSDSetPixelToFillColor.64.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`m\002u\023"
+	.string	"&\344~I\340\360&\035\303n\027k{\205q\006\204\\\302L\275\355\36075\b\215\271\207L\224\017\345-PGIY\364\3332\262\337R\261\3526&\312\307\017\210\201\022D\030\235\240L\251\036\"\020i\215\336\003\"\344\210\016\031d\223\275S\nd"
+	.string	"h"
+	.string	"i"
+	.ascii	"\3779\020\371 \231o\315~\360\364\330\240vo\302W?\370^E\250\030"
+	.ascii	"\243t\341\340{\025\231\302O\373\264\243 \357\343%\177\354\352"
+	.ascii	"\034\335v\267\304\007\276W\325C\274\327\356\003\274W\2236\215"
+	.ascii	"\227$V\244\307HV\213\332\335\221\2168\371I\372\257\375c\2063"
+	.ascii	"\363\351\321`w=g897\275m\003\266'\330SFA\277}\177\350J6h\330"
+	.ascii	"\205|\243\257x\022\210\207'\020\351\366\322\020z\363H\267\227"
+	.ascii	"wB"
+	.string	"\302Gv\273\241\334\234\005\262\260\316\037\371)n\203]\205k\210\224\233s\251\b\345G\236(F5\003d\273\205\257'\271\360\363EF`\002;Q\314\313\2659-GD\213\332-K^\r\341{\365\207`6\370\372\327\f\212\270\320\266\003I\377p\344\270\321\201\333\231k\341\035\351`\210\013\275\326\362!\030\263\037\215<\306{\321U\261\2313\t\256\303\244\266\213G'\275L\352\324n\275v\301\n>\273A\351\351\234!\223\212\315)\223\34088\355\314\331%\315\244\"\354w\273\273\246;\366\313\337\273\317O=\246\247\307\364A\002\230\260\341\334\306\264k3\265c\233jR\211\007+\031X\257\016\005\006e\325\255\\T\350\313aw\002\226\325\212\311IJ\212\030\202\341V\021W\257\026\005X\313\313\3052\266X\243\005\026\212\313\250\342z\215\"\001\267^V\\#L\253\345\032\3012\366n\351\216?\334\207\246\030\245\261L\267\253\303"
+	.ascii	"\352gN\371E\177\355!\200y\026\027`\343\211\007\004m\344^\362"
+	.ascii	"|\245\n\254\371\231U5t\306\005\242\224\016\362\"\207\323\006"
+	.ascii	"0 p\002\241\"\345\006\202\025q<Q\213\026\215\212\"\221E\033\202"
+	.ascii	"3\330%\236y5\325\224P\\\346\214q\023\376O\302\340\n\036%a8S\211"
+	.ascii	"^\357\311\033\221\375\217\355\310?\246PA\214\2138\303\245\222"
+	.ascii	"L\254\274\305\027\f\257o8\257\311*\247\362f\0079X\257HK@\344"
+	.ascii	"Jm@\200\206`\260\312BDd\244a\315\002\006\034\b:\267h\327\023"
+	.text
+	.section	.gnu.lto_frskyOSDSetStrokeWidth.65.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\026\0025\022"
+	.string	"\026avI\360\316(\035\203\257(\273zc<p\275\250f\337\034\257\\\007h\322?\230W\036\025\211\2168\030\263\256\266n\374\017\342Q5*ev\274C{}\032\356\230\351\022\027\373\2549x\236\203^9\252\311\200X\007)i\204\020\262S\n\\"
+	.string	"a"
+	.string	"b"
+	.string	"(\363g\354k\262\025\\\304\230\b\332\3451\0354\003\361\240}\222\251\247\366k\2271?Sr\306n\313\016\317\356y\300\006\304\203\244o\204\007\277\013\b\017\332\264W\374|Y\216\230\022'\267\241\335\255^\207\233\247\246\177\3333h)\262\323\321\202\3355\245\245\250\334\336m\027\260\r\301\246+\001\367k\236\263G\303N\343\207\370\210\357hh"
+	.string	"\032q:\345J\r\351q:e\b\342\201h~\233\341\\\225\004'\025\244\317\361E\374\006v\034\263\3408W\345D\016N\3617\233\030IV\203;M\007?v\365\243\277\331\003\005\273M\354\347\242\274\266\273\251\r\035t\203\327\300\354\361\340o\363x\302\251\266\355\021$\023Of\002C\271k\240\020\372\331\271\370B\b\003\f\335\336'\302\343>\262\314hn#o\363B{N\307c\341o'\315\350\316%\035\314=Z\013\352\335;\320\t\321\214\026\271\244\373\360\263tg\237%\324\343`\377\333\335\265\347b\177\346\247#\352\217"
+	.ascii	"\300\\H9.\267\213R\024c}\300\036\017?\177;,\013\255\362K\215"
+	.ascii	"\244V\337\312\245\362Hn\004!+\026\352\003\004\344\264!ad\325"
+	.ascii	"\"\001\255:\255J2\002L\244|\205T\262U'\264R\256\252z\225\365"
+	.ascii	"4\300$\005\326\253\216\220\344\253\216\347\354\337z.\026u1>3"
+	.ascii	"\257\304\261o\267EA\020\r-\312\371m7\261\214\364=\017 K\241b"
+	.ascii	"C\255\343&\021\3729\021\027=\315\001- P\202Q\250\262\0076[\021"
+	.ascii	"\306\023Y\2640*\353#7\022\202\242;\364\202\350V\\\255\246\234"
+	.ascii	"\022\322e\306)\340;AC\f\314\340\307\016\327\324\361\265\n\326"
+	.ascii	"^V \326\204\325\002{\b\244\0316\225\204\304\n-\276dx\361F\363"
+	.ascii	"\032\255r\032o\354\240\005\303\025#\b[?\002\033\007{d\333l\335"
+	.ascii	"\223\272Y\006F\362\3422d"
+	.text
+	.section	.gnu.lto_frskyOSDSetLineOutlineType.66.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\037\002}\022"
+	.string	"\246\241xI\340\3566\035B\323\350\335\200\222Jb^Y\230t6j\262\037Y\210\347\201\210\270:y\264\270C\324C&\317\177F\320\243\253\230;4\206\204\301\271I\006X\210 \206\t\376\220\314\355o\207\337x0@4d\250\364\324\204\354\224\002]"
+	.string	"b"
+	.string	"e"
+	.string	"\346\030\321\247\256o\312J8\232)2\332\365A\335\363\002\360\236\235\2720\276\332\217\375\003z\032\n\276\330\205\261\371\354\246\006\\"
+	.ascii	"\274wz\306w\257\273\200\357\236Q\373\304\323\r\2531"
+	.string	"#\2442K\332]\221\323p\364\025\365/\373\005\214\345\344\265\244`w]a,-7w\333\004l;\260\253K\277}\337\346=v\350\3635>\316E\234\007\003\303QH\3331]\306\257\236\266c~\035\032\200h\267\026\322mA\2402z\365:>\210\347\234\017a\024\032\351\266\274\205G\n~v\343:\235\330\320\214P\367:lcW?3\307x\376\306\365tW\036\263\345\304\222\356\231\301mN;\274\367\313\034\246dF\333\001#$\3650\237R\270\023\233\222z\216!\204D\304sP\005R\205\025\265\275I|\247=|y\325\\V\036\247\bv\035\323]\337g?\275\252\315\033\265\021\347`)*w\356&TZ\274\352\315\033\265\037\242\2556;E\251\234\214\375nw\327\\\214}\232\277\226\252_\002\340a\207\345\264\333\356\312\215\305\016y@\034\236\006\344\204\225\331}\264>T\235\212$\204#M\316V\347\003\"*r\354"
+	.ascii	"\001Ie\220&\247\007Y\262\202\320\212P\206\016I\251\314\362\301"
+	.ascii	"9b\262D\304r%\226\254>H\304\020\226)\246\006\2704!Yb\253,Yb\230"
+	.ascii	"\276\336-\027c\260\0264\364\342P\354\352va\022\030\325\324\233"
+	.ascii	"\316/;\352%\254\007z\200\237\0221\031b\246;\350\363{\002- P\202"
+	.ascii	"Q\250\262\007\3046(\f-\262\300`T\326Gn$\004Ew\350\005\321\255"
+	.ascii	"\270ZM9%\244\313\214S\300w\202\206\030\230\301\217\035\256\251"
+	.ascii	"\343k\025\254\275\254@\254\t\253\005\366\020H3l*\t\211\025Z|"
+	.ascii	"\311\360\342\215\3465Z\3454\336\330A\013\206+F\020\266~\0046"
+	.ascii	"\016\366\310\266\331\272'u\263\f\214\344\305e\310"
+	.text
+	.section	.gnu.lto_frskyOSDSetLineOutlineColor.67.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`!\002\235\022"
+	.string	"\206\341xJ\340\356(\035\243i\324\264\303=\303\t\330\263\b\322\264&\205\007z\ny\212\344\b\276\241\214t"
+	.string	"\332\214\311\363\232EP\261\004_\316\304\215\"\254\372,D$\030AN\205"
+	.string	"\375~\3148t\351\034\016H\331\306\023\2034B\b\331)\005]"
+	.string	"b"
+	.string	"d"
+	.ascii	" )\364)\355\233\262\023^\314\b\021\355\372\234\036\272\301\370"
+	.ascii	"\320\376(R\275\332\307\375\003z\232\n\316\330\205Q\341\263\233"
+	.ascii	"~\370\300\370\320\364\r\361!\370\001\342C\243\266\320S\231\345"
+	.ascii	"\230Y\241\242;\332\335\362\343p\364\025\365\237{\306\215\245"
+	.ascii	"\366ZZ\260\273\2567\226\226\373\273m\003\266E\354\352\022\366"
+	.ascii	"}\233\367\330\244g\257\361A\\\304w\032\031\214H\236\235\323E"
+	.ascii	"%\326\363\354\234\242\007\b#\n.\206t[\022\250\250\302"
+	.string	"z\035\037\3479\263\207\360\020G\272-Gz\220\216\327\335\320L5\233\035\320\351aHO\005\326\353\f\222\232\375\206\366tW\216\353\345\340\216\036\332\301mf6\371\360\317\231D\325T\266\035\277\331\224\362\325\\\340\250\347\032&\214\202v\037\213\214.\300\340\355MB<\317\311\027[\315s\346qdn\327\3518M\274\356&[\355\331\203w\342\337\315E\375\376\235\205\n\222\255&\331\203W\"hk\317NQ\352\267\301>\270\273\353/\306>\315_K\325/\005\240\261\300\362\335\320\356JR\214\005\n\177:<\375\003.\n\257\023\\\311V-\260\005c}\254\320\bHZ\256T\310\310\bj#f\232\230\f\\'/\023\231\004\023\200Y\250\326i\212\314J\316\030Ii\276\312\223\327\nV\262bg\211\"`3\202+V\312L3V\222\251\355\340~1\036y-\200l\037\212i\340.\214\002\242\232\232\244\363\347~z!\353\177."
+	.ascii	"E\n\234\006\\\307=B\364{J`5. P\002Q\252\262\007\357\220\252m"
+	.ascii	"P\034ZD\002\203QY\037\271\221\020\024\335\241\027D\267\342j5"
+	.ascii	"\345\224\220.3\246@\357D\r\2614\203\037;\\S\307\327*X{Y\201X"
+	.ascii	"\023V\013\354!\220f\330T\022\022+\264\370\222\341\305\033\315"
+	.ascii	"k\264\312i\274\261\203\026\fW\214 l\375\bl\034\354\221m\263u"
+	.ascii	"O\352\3062@\311\213\253\223\001"
+	.text
+	.section	.gnu.lto_frskyOSDClipToRect.68.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`!\003\235\025"
+	.string	"f\250\213J\300\020)\035\013\261\373%\305`\337\024\301\033x\372y\272\233\213\025\240+\260\323\377\033q\252\b\034\206\332\037\255`\313\"\370\022aM\305\231\204\376w*\013S\220\025\315B\361\331\035\256\355\207\301\273\334\215\030\375\213Z\221F\b\331;\245t"
+	.string	"x"
+	.string	"n"
+	.string	"n\301\230^\266}\026o\301{\320\313Wf?L\354L=\355\322\274N:\202y\362@\t\033\002\331\2000\364\263\364\300\347\024:0O\302N\274N\355\003\317\303{\217\207\376\330\305\3411\332]\230\r\230']\027)O\216\017)O\232g\337\370\251\263#;<|+\242v7VI\234w\312\363\037\374\307\257\006\346t\325`wM\17756w\275\355\002\266+\330\365&\324\027"
+	.ascii	" \205\260\346EL\2733US\333D\036\225x\320o\337\037\272\222\335"
+	.ascii	"\362\356B\276\213\303x\022\353\206*jw[C\244\334\207WI?D\312\225"
+	.ascii	"((\230\274qA\234k\243\300\367\"\351\217\374\242\033\355\376\302"
+	.ascii	"8F\316\2659\325\204\323\344]\250s\301\250(2z\235D)\276NOd\004"
+	.ascii	"&\273\013u?w\346\300b\0200j\367\204\235\264\004\363\244?\264"
+	.ascii	"\263['\377`\037\276%\342B\017\246,\320\331\335\377~t]y\242\273"
+	.ascii	"z\264h\022bq\254\266\354L u\254\325\236]F\355A\f"
+	.string	"\254Zi\265m_2+\255\367Q\275\332,\217\301\301'v\313\2037\237\234\374/\007Y_)\r\037U\217V\231\204(\345\264\264h\2371\264\216\260?n\315\261\017\364\203\374\347g\375\374\315\367\374\344\212z\\Q\327\0255]\0055\017\266\334(s\221\321FZ\313\254\342\236\341\272\357\356\004+\264\232\t\212\212J\211H\207{VB\313\335Rv,9\334J\354f\213i\260\311Zb3\\.V2\300\267\r5\\\314\345v\303\305Zg\357\343\326\034\233\304\036M\275\032\343\227q\027\207\301\323\017\255\362\211\376\340_!\364N\017\340SCG\b \311=,}%\013\027\350\177v\311T\030\023\210R:k\006\224\323&\335\334\001E#E,\357\2452< \300\002\241)\343\006\022\2602\031\017D\302\345\225\2410%\250v\003\320\fr\021\307rzB+\237\t\346\035\343\b\236\033\310\250\240\\\251H\265\006\035>C\020\315"
+	.ascii	"a\322\221\351\300\355\265\232\0272\347\243=\030\002)\303\245"
+	.ascii	"\222(\261\022\026_0\274\276\241\274\206V9\345};h\260\277\"!\002"
+	.ascii	"\242+\265\001\341\r\301l\025\b\021)#\303\314b\316\300\0301\237"
+	.ascii	"a\006a\316\231\301`\263\241//\332L\006"
+	.text
+	.section	.gnu.lto_frskyOSDClearRect.69.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`!\003\305\025"
+	.string	"\246h\215J\240\024R:\211\263a\032oB#\233\263\321\017\327n\362}\b\346\267\0270[\230\023\342f&O(\1772e~\230eO6\354\337\340\247j_\326\306|;R\234\205Y\001K\257\230eQ\232y\264\201\006\351\211Z\221F\b\331;\245v"
+	.string	"z"
+	.string	"p"
+	.string	"?3\333>\215\327"
+	.string	"\376\250\346\213\263$/\206\204V\273;\263\223\226`\236DP\322|\214\200D\020Q\244\003\202y\222vs&=0O\036\320\232\235\332\037>\006\360D.\232d\027h\330\264\2734\0330O\312~R\236\034oR\2364\320\026\362ShQ\206@\344\314\310\332\335Zeq\340)\320?\361$B\036\233\323\227\203\3355\025\362\364\334\365\266\013\330\266`\327\023\001\246/\352\013"
+	.ascii	"\340#\004\317\245\230vu\272\216,\025\351\344\342G\277}?\351Q"
+	.ascii	"v\314\277#\3716\216\343P0\024\261\342So\304\254\244/>\365J\030"
+	.ascii	"\025L\340\270%\316\355Y\2203#\351\235|\2467\375~\303CP\316\355"
+	.ascii	"9\027\205\323\004^\311'\263\221!u\316N\272l\315N\277\344\004"
+	.ascii	",\277+\371~\256\316\207[G\303\254\335\223v\322\023\314\223~\322"
+	.ascii	"\317\216\235\374\211\216\321\002\305\307T\034\351\304\027\006"
+	.ascii	"B\273{\341\235T\356+\277tY\220n9\345\312g\254\266\355=J\352X"
+	.ascii	"\253}\373\216\334\211\031`\265\322j\353>eVZ\237\303\365j\313"
+	.ascii	"<G\007\267\3303'\356\334r\362B\"d}\245?r\270\202\264\313)W$\252"
+	.ascii	"\226n\331\347\r\255+\354\217\273\273\256A\366\215\376\222\027"
+	.ascii	"\375\260\237\277y\242\237|Q\217/\352\372\242\001\271\017\272"
+	.ascii	"\336h\243\261\341F\334\314\255\362\256\341\276\377n\0051\270"
+	.ascii	"\034\213\013\f\314\312\211\207\373\266\202\353\355^~2=^Lm\247"
+	.ascii	"\253m\320\331fj7^\257\2662\300;\0169^\215f\267\343\325bg\360"
+	.ascii	"\343\326 \233W&\250\202\365\3065\343.P\003\253\"\332\345/\375"
+	.ascii	"\304\317L\350\253\036\340'H\213\024C\225\273X\372Q\0270\320\013"
+	.ascii	"-\303\2516&\220\025u\030\017\254\252\205\272i\004kG\253HyO\225"
+	.ascii	"\017; \300\002!\"\343\006\222[\031\210\007\"\341\362\312P\230"
+	.ascii	"\022T\273\001h\006\271\210c9=\241\225\317\004\363\306x\006\317"
+	.ascii	"\f\3442(\327TR\327F\207\317\020D3@\230Td\372\271\375V\213&4\305"
+	.ascii	"7\021_\344\f+\225\344\304\212Z|\301\360\372\206\362\032[\345"
+	.ascii	"\024\357\354 \203\331\025\t! \270\002\033\020\252!\230V\031!"
+	.ascii	"\"2n\330,\316\tL#\362u\024s\316\f\206\237\r}y\321\0362"
+	.text
+	.section	.gnu.lto_frskyOSDResetDrawingState.70.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`u\001\235\016"
+	.string	"\346\231_F"
+	.string	"\217*\035\243x\t\033\274\\\346\264\2718\215\\3.8cmCld\031\201\023~\020\302<\r@\3435\204\360*\n\rj(\336\245~GTU\273l\252\310\237e\216 d%&\002\305\352\200B\030\331d\357\224\002D"
+	.string	"M"
+	.string	"M"
+	.ascii	"?)\275\256\352\257\233\354U\333\255\234S\033\360N}\023\223\235"
+	.ascii	"9\275\377\022\355\214E\373\304+\207\305p\211\204\244\324v\367"
+	.ascii	"\233\033.^\212\376]\017\220Z\235.\001(\330]\313\324\212u\317"
+	.ascii	"\333.`\273\201\375\025\001\237\231\376\362\353S.\303dX)\331\335"
+	.ascii	"\314\250B\272\300\241\362\243\n\251+a\340\211\334b\250\313J\020"
+	.ascii	"\302\341\344c\376\207\2030\035\305-\030uYo\261\240\376\242;\365"
+	.ascii	".\240;\265-\376\244\2449\241\260\3206\247\0327\316\224\207\371"
+	.ascii	"@\206)\233{D\347\317$\204\362)k,\314\223\t\324f\307\220p1q\331"
+	.ascii	"=\025.#\266\024K\352>\266t\217m^\352\016\273\006%o\226ckm(V\336"
+	.ascii	"\354\n\"\247\006\373\334N\022{N\360\240\022Y\235\345eW\365\302"
+	.ascii	"bKP\021\035|\223\241\n\242\220\363|x@\234\021t\200B\031\032\034"
+	.ascii	"\034\235\013\220\307g\372\323\001\205\240\003\n\017\302Q\307"
+	.ascii	"\007\212>\b\"\217\307\367\031\205_g\200\301\b\241\321\367\001"
+	.ascii	"\202\243/SQ\347v\222l\264Fl4\324\004\261?\306`\277\353\033\255"
+	.ascii	"\255\321<\371\225?\304\003\" `\0021T\252\003\244Y\231\306\363"
+	.ascii	"_\264\351]J\211\310 T\202\340\234)\337@\377\021\327\200\322\""
+	.ascii	"]x8\023s\021\"]<\002\004\313\020\2102l*\t\211\025f\361%\303\213"
+	.ascii	"7\220\327\260\312\351\274\265\013bT\361A\232\273\220\333\206"
+	.ascii	"qy!,2"
+	.text
+	.section	.gnu.lto_frskyOSDDrawCharacter.71.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\373\0025\026"
+	.string	"&\252\221J\260PR:ct9\214\224\243\304/\210\003"
+	.string	"\232 \007\0231\341F\372\337\340E\226;7\371\034\200\271\030\212\334\206\251\242~N \271\272\331\3260\345\215\223\363\025,\034\343\316\206\264\252\350\bx\237\241\340\367|\223xB\310\336)\005z"
+	.string	"}"
+	.string	"t"
+	.ascii	"\2737\263\223\206`\236<P\322\210#$\301#\001\357\2613+6<(\"zQ"
+	.ascii	"\360F0&wwZ8\355\236\"v`\236\364\2404\022'\261\201y\222\3463;"
+	.ascii	"\265\037t\241\340\207\034e\216]\236$\247\335\025\261\001\363"
+	.ascii	"\244\354\037\345\311\361\002\312\223\016\332.~\216X\020 \017"
+	.ascii	"5G\\\273k\253\"\036<\r\372\037\236C\210\023s\272\301`wM\2058"
+	.ascii	"9w\275\355\002\266)\330\225%5\326\212|\362\271\322o\337gz\321"
+	.ascii	"\216\371\367%\337\351Q\247\202\351\020\177v7"
+	.string	"6%\325\302a\266A?%\325R\376L0\203\343v87'A\315\254\244\207\362O\374\351w\024~\001rn\316\275$\234\346\211M@YLQ\221jv\322\244kvz\242GH~o\002\376\\\233\007u%\005q\235t\004\363\244\317\364\263c'\377\241c\264\252\231m?\351&\202Wz\371\322,l\007HG+S\217\355|\351\303\233\002\026\273{\341\241j\007\226'^&C\273\034\262%\004\2536\356C\240Ym\335\2070.\341\370@\253m\341)\312J\353k\274^\355\335\253x.\261U>\\q\311\311\013a\324\372:\036\325x\311\320/\207l\001]-\355\262\317\031ZC\330\037ww]{\354#\375\260\033\375\346\317\277\374\320_MjjR\277\243\003+\013\347E\254]\233\257:\r;\337xs\271\345\306\334\n\256\342r\324\347\302\302\033{\027p\025x#H\311\351HLPPj\037\031n\\-\347\343\235"
+	.string	"U|\275\024\033og\303\260\273\255\330p=\237\2556\300<\026]\317\346\302\343\365l\261S\346\343\326\036\233[%\254d\352\214_\306]\236\005ZD\364\313'\376\303\317\002\320_\035"
+	.ascii	"N\026\027\210\240\332\035U\372\305\n'\364B\313hj\214\tp\025\017"
+	.ascii	"S1\343j\251n\312\230qC#FyW\225\0178 \200\002!*\355\202\025!\036"
+	.ascii	"U\243%\242\222ed`B\220\fr\211c\235\236j\345S\202\331c\234\301"
+	.ascii	"3\004r\013\312\231\212\333\305\314\226\333\250\254\235N\246\023"
+	.ascii	"\267\367j\320c\363\020H\031>\225\244\304JY|\301\360\372F\363"
+	.ascii	"\032V9\2357;\310\301\340\n\215\020>\354\bl\034\324#\241\013@"
+	.ascii	"\335\322\020\"S\342\225-\305xZ\206\303`O<4<\262;\001\003\"\204"
+	.ascii	"4\267\020\350\023"
+	.text
+	.section	.gnu.lto_frskyOSDDrawCharacterMask.72.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`m\003%\030"
+	.string	"f\254\232I\260\230QcA]\311\251\227\027\210x\013\275Hc\2654\261\334 \370\2630\307\306\235\274/\017\372Js\221P\220\320G\273\356\250\211Zk\371\340\336\223\302\303\312\232\037\232A\241=v\357\033\\{\215L\321Z\313mdo)S\n\206"
+	.string	"\205"
+	.string	"~"
+	.ascii	"\020\306\2136\252\230\01745\266#\325\336r\211\220\034=\030/\306"
+	.ascii	"\334\322\352\b\n[n\207\024$\034L\261\361\033\266\343\020\262"
+	.ascii	"x\357\211'\274{S\0317\030/\266\324rI\nd0^,\203\345\253}\335i"
+	.ascii	"\330^\303K^\335\213\"\211w\357\2251\202\361b\353.\251\213\341"
+	.ascii	"\007\244.\332f;y\332\342\276\034\271\300\345p\272\367\232\226"
+	.ascii	"\305m\2576\377\273\257rEC\257\252\005\367^\327\\\221\321mo\373"
+	.ascii	"\200\355\035\333"
+	.string	"\016\t\3771\335\013\"\352\312\r\212?b<\351\267\357\3738\320&\215\276\207\377\343L\377\261J\364f\334{I\237\220SD9\326\373\204\234\251\031\025F[xG\244\327H\001\256T\325\367| \017\202~\311O^\322kt\250\234t\274\022\257\326\032\272\361+/\332<\225\257W2M\rz^\355\351\005q\335\023\222\316\351\242q\306\213\276\017\324&/\376;\2231#\312\3578\017\333\223\200~=\\\226\214\243\027P\356\rQ^t=\276\223p\323\"\367\236\371Z\352Jo\335\352\223a\232|\326\3329\337\325\354b\261\226\264\366\204'\251\255\254M\341H\204\354Z\221\250\326\326\271\221\240\312V{\034\324\255\375z\221\036\273l\330\211\310\354\262\360\335\314\256\213\317E\t\355m\230\004\007u\253Q\206ib:r\353\223\235\022U\273\302~x\255\n\373:~\226#\375\344q\374\253\247\277\3525\376\220UmW\325uU}\001"
+	.ascii	"\230\300(\n2\01634|\375\274ba\254\007fa\261\212\376\370\234!"
+	.ascii	"\355\314p\302D\332\005\230\r\272\023\360\304d56;;3.\033n\330"
+	.ascii	"L\f=u\2020\2404\036\363\234\231\032f\257\036\023FC\315\231\002"
+	.ascii	">}d4\363\347<i&\231\336\036^\253\302c\0230x\263D\006\n\357Eq"
+	.ascii	"\003\305F\215\352\375\273\227\004\352\225<\200\221&2L\350\314"
+	.ascii	"{)\345\003#\340\324\347\334\362`\207l\300\txV\221*G\356\357#"
+	.ascii	"\225*!\254HQ\335\300\324}'O<C\250Q0j\fB\214\tH$\032\021m\223"
+	.ascii	"\016\200\002\231)\264\r\021\240\271\204#Q\235\326\202_,\320\277"
+	.ascii	"\020L,qg\302\361f\001G\225\362\030\322I/\237\351\371\tw\317\202"
+	.ascii	"\316\bCS\363o\363\300s<\013\266p\367\3775-Vts\031h\363a\\\376"
+	.ascii	"\337\376cg&\245\216\2643\325d\252l_\036\271\316\032\031\001p"
+	.ascii	"\232\252\200\320\363\311\231\347\320<\345@\246\243\2169\260\312"
+	.ascii	"0\0168$+p\020\343m\321\b\002+p\356\360\203\345\363\316`\320\025"
+	.ascii	"\204\375\205b\250"
+	.text
+	.section	.gnu.lto_frskyOSDDrawString.73.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\300\001e\020"
+	.string	"\326\237oG\340\322&\035J]Ir&E\260\336`\276\353\357N\2001\\CD\030\303\347\204\035\247\370\3271\372\363\265%\263e\312T6\251!X\333ukb\214;\303L\n\ni\276\264\r|\344\206\346+@\314\266\222L6\221;\245W"
+	.string	"Z"
+	.string	"\\"
+	.ascii	"A\273\243\311\017\272O\217\235w3\272p\320}z2\357\322\276\316"
+	.ascii	"w\302\363X\310!\2735;A\273k\362\201\356\263\300M\270\317\355"
+	.ascii	"%\334\247C\333\306\307\233\035\220\203C\243\202\307\356~Z\342"
+	.ascii	"\341e\350\177\366\0201\006\273\004\320`w-\305\030\210[o\333\200"
+	.ascii	"\355\t\266\204\020\273V\033\373>?\351?\377\350\343\337\235\347"
+	.ascii	"\237\234\364\306I\353\224\226S\372$#"
+	.string	"7h\304>\264b\327C\355\307\022M\0308\007\372\355\177f\021\017\310\263\201`\2763;\322\311AQ\264\373\301\373\264\004{:\tN\302\377\274\254\273\262 \021Nx\262\347)\302\373p\270\200]\233\031\001\033Ba\376U8\325MM32\031Y\363\210$\251\255\262 /\252rC#:(\314%\032\220\221\332\253\317^$&D\364\220j\267\374E\247\262D\333q\265Yo\221!\200\r~\206\201t\263\273\013>/\342\230z}\r\232 1\262f\r:J\264\0341V\372\260G\230T\022\366\267\335)\026J]/.\340\346\372\353V\300\222R\2350XY9\231l\270Q\247\224\013Ly\265\270Z,\037\270\372.\254TX\037\252\345\372N\004\f\272\250Z\337\013\b\266>\221q\277\255\332\270\243\325\210bT\3060\333n\rJQ\217\254\271DnJ\322\355\036\342\316\3423\n(2D\004\267\020gWH\221\027\275\005\037"
+	.ascii	"\002Vd\306\273*Z<j\241\025B)H\354+n\034\303p`\004\270\f`C\253"
+	.ascii	"\032Y\335\tzyYjEx\343\232\223\264+G\214l\020\341\330p\251P#@"
+	.ascii	"\214@\f8\361\204\206 2\340\004\f\205\020\\s\013a>\001"
+	.text
+	.section	.gnu.lto_frskyOSDDrawStringMask.74.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`$\002-\022"
+	.string	"v\343{H\300\226M:\024u\376.f\221\374\213\351\276r\326\351d@\371q\253h\b\210oN\201\242\t>t\377\fj\272s*^\027\360\202\013\335\302\177#\372\377T\222\247Y^x|\210\224\271\337q\305\221G\235K\006\331D\356\224\002c"
+	.string	"g"
+	.string	"f"
+	.string	"\222\3516\3047\2018\313.\022\022\251\335\361\305\023\274O\217\236\313\217\321\207\004\357\323E\352\273\264O\3435\304/y\312\253\335#(\251\335}\261\002\357\023\301[\272O\356\004\272O\213v\325\307\2445\240\004Et\243\311\356\202\352\342\342\245\350\277\366\325\254Hv\231\022aw-gE#n\275\355\004\266/\330\362(o\372[w\372U\376\364\263>\376\253/\375\235'==i.EZ;i\331I\177\200"
+	.string	"&\264\242\007\351\261\033\342\006e\251&\017\030\247\375\366_3\353\033\372l\3738\036%\236\326\363\035Z"
+	.ascii	"F\224\242\222\354\212\370>m\301\373tM\333\305\t\203\030\361O"
+	.ascii	">_\331 \"3*T}\352\364\303\255\254\020\213\022\024\212|\001\377"
+	.ascii	"\206\216\323\251/C)\202\344\315,\262\245\266\314\214\374\214"
+	.ascii	"\323n\311\n!\225\331e\213\241j\277TTU\nQ\301R\333\3465\237\326"
+	.ascii	"\213\023(\244\332\034\276c\245\322e3q\265q\256#\246b\347\274"
+	.ascii	"\246\023 iw\035|~\246\244\323\353\217\020E\001\2227\373\030\271"
+	.ascii	"l$\206\254|b\2172\251-\354s\273\273V$;5:/\215\361\354\204\034"
+	.ascii	",\354\020\276f\354?w\203\233\032\233\230\007440-\037\356\027"
+	.ascii	"LM,\224\371\311\211\301n\300\020\007\364\2003\243\003\276`1\020"
+	.ascii	"\346\200\303\035\033\030\310\023\2060\2205\356\271U${6\031T@"
+	.ascii	"\032\344\036n\367\b\302i\177\022&ys\0019\265\245\363\006\322"
+	.ascii	"=\307k\030\356\2244[pOuv\006\r\3623sk\2442\007% \320\002\241"
+	.ascii	"\271\316\001\222\2632\307\3035\2344eh\2153\366\357\263\305\312"
+	.ascii	"U\272\327/\037\037c\356\227\201\r\235\032\371\235\356\345\271"
+	.ascii	"\324$\334\362\316\001\335\3517\321\266\220\0057Es\023\206Ka\341"
+	.ascii	"\260\341\032\270'\236\033\212lN\300\030\b\201\232[\b\360\t"
+	.text
+	.section	.gnu.lto_frskyOSDMoveToPoint.75.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`k\002m\023"
+	.string	"Vd\177I\3200'\035\303M\311BU\261\030}B|1\024\272\016\221\177\310\\\322\026\226\265K\275\r\022j\312\336M\347\264([\330\031\027\rQ\213\361\250\311\325\n\350\320[\250\237\022\001H&\035\035(kF,\364\243\2314\262\311\336)\005e"
+	.string	"j"
+	.string	"i"
+	.ascii	"\376\317\201\310\007\311|k\266\303\004O\223\324\356M\370\352"
+	.ascii	"\007\337+\b\025)Q\0329\370^EB\204\237\366k\357!\357\343%w\354"
+	.ascii	"\352\370 \355\356\210\017|\257\254\177x\257\335\007x\257&m\250"
+	.ascii	"\227#\026\204\007\306\3146\265\273\"\025q\362\223\364o{\007\r"
+	.ascii	"g\346s\325`w=i897\275m\003\266'\330SF$\036\364\333\367\207\256"
+	.ascii	"d\203\216]\310W\361\026O\362\350\020\005\336\220`\033Bo\376\206"
+	.ascii	"\004\363NH\370\310n9\224\233\243`\026\326\371#\177\305Y\304n"
+	.ascii	"\344(\220rsN\025\241\374\310\023\305\260f\200\230\234\302\327"
+	.ascii	"\223\\\370\371\"\227\230\304N\024\363rm^\313\021\325\246v\313"
+	.ascii	"\221WC\370^\375\241\230\r\276\3766\203\"(B\333\001I\377l\340"
+	.ascii	"nn\324\330\231{\341\375v\360\303\205nkY\020cwO\373Q\311c\274"
+	.ascii	"\027\235%\2339\207\340RLj\273xt\322\317\250N\355\361\266\013"
+	.ascii	"Np\032\rJO\347\214\031\225lV9\004\327\363\2643g\2274\223\202"
+	.ascii	"\260\337\355\356\232\356\330/\177\357>?]M\317\325\364=\002\340"
+	.ascii	"\320\200s\246\250]\233\252\034\353T\223\002+\031\\\260\016\005"
+	.ascii	"\006\245\325\265\\T\350\313c7\002\226\326\212\311IJ\n\311\007"
+	.ascii	"\206[\205\244\005\033)\304Z`/\026qt\211\026\\(.\242\312\013&"
+	.ascii	"\222\020\360\370\262\362\022a\306\361%\202\245\354\335\322\035"
+	.ascii	"\177\270\233\223\214\322X\246\333\325a \3653\253\374\242\337"
+	.ascii	"\366\020\300\274\213\013\270A\345\360P+\271\227<_\251\202k\236"
+	.ascii	"fV\r\235q\201)\245{4\341\2366/ p\002\241\"\345\006\202\025q<"
+	.ascii	"P\213\026\215j\"\221C\033\2023\310%\216yz\252\225O\b\346\214"
+	.ascii	"q\023\336O\302\270\005\345L%z\275'oD\366?\266#\377\230B\0051"
+	.ascii	".\342\f\227J2\261\362\026_0\274\276\341\274&\253\234\312\233"
+	.ascii	"\035\344`\275\"-\001\221+\265\001\001\032\202\301*\013\021\221"
+	.ascii	"\221\2065\013\030p \350\334\242]O"
+	.text
+	.section	.gnu.lto_frskyOSDStrokeLineToPoint.76.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`m\002e\023"
+	.string	"&d~H\340.'\035\303\360\2737\377\tA\320R6u\276\313\037*\377\221\331\037\024W\004O|s\201\232R\363\377\3656\310\n\332\022\bO\026N\244\222\2069\216`\343\013\220\252\322B`#\007\201\250`\221q?\025R\311&{\247\024e"
+	.string	"h"
+	.string	"h"
+	.ascii	"\3779\020\371\240\230/\315n\360\364@I\355\332\200\257n\340\275"
+	.ascii	"z\320\020\232\222\211\201\367\n2\003\374\264?{\b\362>^\362\306"
+	.ascii	"n\216QmwE\f\342\275\256\336\321\275r\037\320\275\232\264[\274"
+	.ascii	"\334Y\217\236\0251\332\324\356\206\324\303\311O\322?\355\033"
+	.ascii	"\262\033\231O\215\005\273\353)\273\301\271\351m\033\260\035\301"
+	.ascii	"\236P\001A\277}\177\350J\366\347\327\205\374\0217\361$\016\r"
+	.ascii	"1>\244\332\210\001\354\346\221jc\007\002\202Gr\233\241\\\234"
+	.ascii	"\0041\260\316\037\371$n\364z\tGy\224\213s\252\007\245G\236\b"
+	.ascii	"f%\003\324T\003_Mn\340\347\213|\240\344u\"\230\227[\363\331\215"
+	.ascii	"h6\265[\212\274\332\201\367\352\017\275\354\357\365\247\371\013"
+	.ascii	"\261\001m;I\367`\330ld\274\330yc\352\216\364\217\303\205Nc\271"
+	.ascii	"\320\216\354G$\207\351^\364\025l\336\374ac\232\324n\351\350\244"
+	.ascii	"\217Q\235\332\342i\025\214\3402\027\224\236N\0261*\330\254\362"
+	.ascii	"\207\r\305\323\316\233]\316L\332\301>\267\273k\252c\277\374\273"
+	.ascii	"\373\374TczjL\237#\300\315\350\346M*vk\252f\254SM\372\360*\027"
+	.ascii	"Z#w\362r\302\342X-)\324\345\257\233d\205\245Rb\202\2022\322a"
+	.ascii	"\341N\031a\215\242\204\027\313\350Z\t\305VH\241u\322\022\246"
+	.ascii	"\270\306p\204\200E\027\025W\370\"\212\256\360+a\347\226\352\330"
+	.ascii	"\263\245p\202\321\031\307p\2739\n\244~f\225_\364\323\016\002"
+	.ascii	"\230?q\001\"\242x6\314H\356\245\316W\232\320\232\227yECe\\`J"
+	.ascii	"\351\034M\266\247\r0 p\002\241\"\345\006\202\025q<Q\213\026\215"
+	.ascii	"\212\"\221E\033\2023\330%\236y5\325\224P\\\346\214q\023\376O"
+	.ascii	"\302\340\n\036%a8S\211^\357\311\033\221\375\217\355\310?\246"
+	.ascii	"PA\214\2138\303\245\222L\254\274\305\027\f\257o8\257\311*\247"
+	.ascii	"\362f\0079X\257HK@\344Jm@\200\206`\260\312BDd\244a\315\002\006"
+	.ascii	"\034\b:\267h\327\023"
+	.text
+	.section	.gnu.lto_frskyOSDStrokeTriangle.77.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\312\003\245\027"
+	.string	"Fk\230L\240\022V:K\024\fDde\346\242\364\253\3769\313m\355\357\261\221\327^\300\353\245\\\031\007>Ir\330IA\277\321,&C\017\273k\276\372\377\205^/\342\300\232|@)z\334~\334z_o\230\326s\\\f\306\333'\204\220\275\223\f\204"
+	.string	"\201"
+	.string	"{"
+	.ascii	"0\231\215\331W\234E\357N=o\240v]!\r\361\321-\244\362\223\037"
+	.ascii	"\264~\262\320%;\n=8 6q\321,\351\f\"44`Z\302bpB)\307\202\243\325"
+	.ascii	"\250\240\365Sf4\273e~\360(zO\342\"\273\272\213T\020\273{\205"
+	.ascii	"e\255\237\261\237\240?\315\013@\177r\217\231\307\327\022\215"
+	.ascii	"\202\224\3741%\273\233vI\274w\333\343\177x\027p\310\3476M\320"
+	.ascii	"\335l\201CD\347{f6\300\314\023\230M\004\001hj\371L-\233\251\345"
+	.ascii	"\233Z\266\251\345\017 Yn\030\272\025Tw\320\222H_\235RGw\372\231"
+	.ascii	"\317\207\372\221\031\306\352\237\370R\177\361\252\327\207\"0"
+	.ascii	"#\025\217\303\f\2657R\361P\023\022Z=\263;\254Mt\3407;\355\247"
+	.ascii	"\370-\356B}\221{\240\254M\364\254\bk\253w\342N\314'\205\325\252"
+	.ascii	"\362sF9\273}"
+	.string	"\024\273\304\250'\356|\355\240\007\225\302`\262{]\371\311\020\016\2452\303~\376C\016BXA\\\347#z\343a!\376\364\241\215\006Gw\037\370)\230\357\240\217z\314g\225\234\202D\2427L.z\326\300\225\334\323\244Ar\315+\203\302\310\275\3662\347n\365\272\366\376\227\365\313\214s\030\027X\2069\347C\035\313\374<\020Hz\177/\323/\313g\227\234\202\0242\243\255\222y\375\261w\004\363\315\356n\276F\314\027\376&o\372K\276\364\223\\\351\037\371\372\277\236\364\247\251\3458\f9\236Y\323\251\335\314[\216\355\352\374E\265/<\326E\265.<\266E\265\374rs\303\305\314\330\330\260\234\264\360X\266\261\334x\272\032\025\207\267\273\241\351r\264\n\271Z\016\315\266\343\321X\b\260\316\002nG\323\321\351v4\330\352\273\331\327\210[H\254+\337\375\341\036\263\273\210\346N\277\017%\273d\276q\3521~\324?\274J"
+	.ascii	"{\035\007\360\243\307\016\020A\230s\021\345\037kj\366@\216\001"
+	.ascii	"]\037.\220<\376\025\0039\243\253\336\022\202\fN\250Ah\306\004"
+	.ascii	"C4#\241H\322\264\351\360\002\031\"\233\003\0210=u,\235B\033\007"
+	.ascii	"\233\373\245\bh\373\215$\022`\260\005;b\212\316\247u\f?\2772"
+	.ascii	"3\363<\3213\340\3433Xl$\267\270$\371\354\355%\321G\027\227l\241"
+	.ascii	"O\214t\337?\335\327\3165\320\230C\220\324\352\004\226\202\201"
+	.ascii	"\013\377\365\234\3050\030'\236\017\221\203\233\222\201x\f\266"
+	.ascii	"@\024k\240A\314\376G\310\243\b:\031\033\253\215\315s\361\345"
+	.ascii	"\027r\343\f\006[\201\364\013\245\246\001"
+	.text
+	.section	.gnu.lto_frskyOSDFillTriangle.78.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\312\003}\027"
+	.string	"\006\253\226J\260\022Vc#\234)\241c\343jJ\313{\364\216\316\230\021>X7\234\372\005^\\{\205\017\203\r\314o\rM`\003i\313\275\252\375\253\377\337G\341\003:<\016\335\241\341\231Y\200J\326:\302=\274v@hb\367\336[\312\224\002\202"
+	.string	"\200"
+	.string	"{"
+	.string	"*\034bOq\025\275\023w~}n+\312h\303\324\275@+7\r\201u\323\303\226J\317\320\307\262\344j"
+	.string	"\361\363\200j)\351@G\022\217\006RHP\f^\244L\013X7S\210\261W\373\302\033\365~\344\243[\367\022\235h\272\367\262X\205u\023\366\223\363f\371"
+	.ascii	"\347M\367\354\035OG\\\024\023W?%\252{\257\314\212x\357\265\347"
+	.ascii	"\277\370\0260\310\363\212*\270\367\272\002\203A\267\275\355\002"
+	.ascii	"\266)\330\345\201\325&Z]\242\325\026\255\256h\365\005\220\020"
+	.ascii	"\021\203\207J\336\373\223\034r\243L\026$N\374\355\373L\177\262"
+	.ascii	"_\346}\205\317\342/\036\3035\224\364B\302\330\t\305\316z$\214"
+	.ascii	"\335Yb\002\253W^\017\351\r2\360\213\231\365N~\213\273\340\375"
+	.ascii	"h\036(\351\r\372\225\204\224\325{S\016\214\007\005\324\324\312"
+	.ascii	"M\031\253\330\353\215~\231\361\336\224\363\364\376\\h5\024R\335"
+	.ascii	"\233\262\334t\2043\361\354\327\315\277\350WA\200\204\370h\335"
+	.ascii	"O\347\221\177}\370\212\027k\bp\334{\017\274"
+	.string	"\323\3549\347\215\207\371\252\225S\252\204\316\033&\3664m\334J\254Y\326\030\261\245\245QA\304\332jm\334\241\\\266\332\377\256nm\233\313\300\340\030\373\346\305\234cn\036\330\003\265\267V\351w\345\253I\247T\005\245n\265\262\323\236jC\330/\257-\262?\374M\276\364\227<\351\0379\322/\362\364w\375\350G\321\352\023\r\267\f\270]I\303\241\331J\333M\315\342\034\206Wat\352\013\257\276\350T\027^5L\215\3556\223\241\241i9q\321\251\256\265\330v\271\031\236\315NW#\313\341d\026p\264\033YM\267\223\265\fp\356\302M'\303\311\345t\262W\352{ym\221YU\035\242|\266\307;\345\275D\tN\374\247\220j\322>\322\3510\337\370\027\277\002\240>\307I\214?\212\206\204\263\373x\372O3\264z\240a>\226\307\004\250\236\356\232\021D\352\3068\013HO\250Ah\306\004C4#\241H\322\264\351"
+	.string	"\003\231!\233\003\021@9u,\235B\033\007\233\362\213\027\320\376\2334$\300\300\025,\212\2519\037\334\361\371\274\226y2\257\036\035"
+	.ascii	">?\207\305\"\351\231C\306\307O/\211>\336\034d\001}\342H/\375"
+	.ascii	"\201\3350=\215\2246\260(\206p\250\324\t,\005\001\027\376\353"
+	.ascii	"\032\213!0N<\035\022%7%\003\361\350l\201)\326B\203\234\375\327"
+	.ascii	"\326\243\211\246!<\373\303s\366\334\376\207g2\300`V\220\370E"
+	.ascii	"\347\323"
+	.text
+	.section	.gnu.lto_frskyOSDFillStrokeTriangle.79.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\314\003\265\027"
+	.string	"Vk\230I\260\226Uc\025,?7\2360\264N\316m\t\201\366\221\003j\243+\355M\341\026-So\343\220\026\215D\370\247\200(yt\327GY\352R\177\271\302Zc\2149\257\244\177\342\305\225d\005\367- %\271\241\211\335{o)S\n\204"
+	.string	"\204"
+	.string	"}"
+	.string	"\261\333\370\215\336\237\204~\213.\353\310\324\241\311\275H27\035au\323B\026l\205p\t\302\b'\023\313\226\273\241\004\207\007\037fTq\260\272\t\0036)i\220L\2010X\3354"
+	.string	"%\366j?x\246\336a\230h\326\275$\206P\367\336\031\037X\335|\035\346\274Y>\300y\323={\311S\0257\206\311\350Gc\352\336+\263)\336{\355\371\037\236\005L\032zE\027\334{]\201IJ\267\275\355\002\266+\330e\202\325&Z]\242\325\026\255\256h\365\005"
+	.ascii	"@a\224t$L\356=JR\271GS\007\213?\375\366\375\0347\332.\363\216"
+	.ascii	"\303\327\361\036\377\321\nQ\303U\364\261\363\020;\353\213>v\347"
+	.ascii	"\013\n\253^yA\244W\t\301/f\326K\371;\316\203w\242\231\304\244"
+	.ascii	"W\351U\023\322U\357P@\257!\031H\21627s\220\261\327G\331\006\207"
+	.ascii	"w(\240\247\367\350A\24408uo:s\323\022\236\203g\273n\376C\273"
+	.ascii	"`.\002Q\244 My\302\272\215\347\213w\2158\216\017kwRq\357=\360"
+	.ascii	"R\263\003\235\217\372\313W\221\206Q\2118\217\274\330\3234rk\261"
+	.ascii	"fY\204\305\226v\210\205\025k\253\265q\027\322\262\325\376Wuk"
+	.ascii	"\367\034H\006\317l\237\017s\236\335<\320\tjo-\215_\225\257&\r"
+	.ascii	"\243Z\"r+\322N\211\252=a\277\274\326\204}\341\377r\247\277\345"
+	.ascii	"3~\2267\375+O\377\326a\374(Z}\242\0017\r\270]I\373\241\331J\233"
+	.ascii	"O\315\376\374\206Wo\202\252\r\257\332\004\325\032^\365\r\217"
+	.ascii	"\355\206\223\263\263C\003S\023T]\243\261\355r:\274\236\235\216"
+	.ascii	"G\226\303\311.\340h>\262\232n'\243\031\340\034\206\233N\366\223"
+	.ascii	"\313\351d\256\324\367\362Z\023^Q\2658\372,\221\205\312{I(\370"
+	.ascii	"\323\337\244\251&\355\027\245\376\362\243\376\341e\\\352\223"
+	.ascii	"\334%\006\224`\210\340\354&\236\276Q\207V\017\364\253\310\016"
+	.ascii	"\231\300\224\361\255 R\210\334\037_\005N\250Ad\306\004\243\320"
+	.ascii	"\214\304L\322\264\351\360\002\031\"\233\003\021@9u,\235B\033"
+	.ascii	"\007\233\373\245\236h\377\215\030\022`p%\273\216\312x\250{\f"
+	.ascii	"=\277Rs\203n\376\004\370\364\334\026\033\311k6E>\177{I\364\261"
+	.ascii	"\315\246P\350\023#\335\365Ov\347\3644R\332\300\352 \302!+&\360"
+	.ascii	"\025D.\\\257K>C\300\2358\037$N9%[\361\370l\201)\326B\203\234"
+	.ascii	"\375\257 DQd0RV\021\273\003#n\026Z\016\fcX\201\360\213\256\246"
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_frskyOSDStrokeRect.80.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`!\003\275\025"
+	.string	"v\250\214K\300\020)\0353P\222\354\230l\360\243\214\240\024\352\202\307\001\2251\240W\034N\001J\205\316'\206c\377\240\033\221U\213\340K\2045\025g\022\372\337\251,LAV4\013\311\001w\277\253&\331I\215B\2659fZ'\215\020\262wJ\001t"
+	.string	"y"
+	.string	"o"
+	.string	"~\2258\305l\373,\336\242\367\241\231\257\315~\220\020\356L\355\342\304N\372\201y\262@Y\242$T\303\001QPS\203\363$20O\226\230\210\235\332\017^\330;\220\213\376\330\355\021\"\355\356\211\t\230'a\037)O\216\027)O\272g\333\370)bI\204\037~+\252vWV\177\336;\355\371\037\376\003\230Cs\332Z\260\273\246\300\034\235\273\336\366"
+	.ascii	"\333\023\354\272\023\324\007\020\362C\314\271\324\323\356MV\217"
+	.ascii	"\205\"\223F|\350\267\357\027\235\311~\231w\"\377\3500\276\344"
+	.ascii	"\3429\252\332\335WQI\327!V\322\027\225t\345\t\tfo\\\017\347\352"
+	.ascii	" \370\305H\372$\337\305\221x\177\341\033$\347\352\034+\302i\366"
+	.ascii	"N\334\301hTH!\305N\262\\\305Nod\003)\274\023w?\367\346\301\253"
+	.ascii	"\241`\325\356yr\322\020\314\223~\021\317~\235\374\207\001\305"
+	.ascii	"\277@\234\350\303\226\0044v\367\300'\255|W\336\3500\037\275\262"
+	.ascii	"\211U\212\261\332\263?\201\324\261V\233v\031\266\017-\270j\245"
+	.ascii	"\325\276\275\311\254\264\376\207\365j\303<\206\006\253\3301\037"
+	.ascii	"\342\254r\362@\034d}\2453~X>\232e\023+\024QK\257\354\263\206"
+	.ascii	"\326\020\366\307\255>\366\205~\220\007\375\256\237\277y\240\237"
+	.ascii	"lQ\217-\352\332\242\246\2556\0167\3358\223\231\325\306Z\f\255"
+	.ascii	"\346~\341\273\363\356\003/5[\n\213\213\013\312\310\206\233\206"
+	.ascii	"R\323\341Zx0\272\334\213\fw\223a\270\315bd\264\234N\206\022\300"
+	.ascii	"\270\f\266\234L\006\207\313\311^\247\357\343V\037\233VB(_\255"
+	.ascii	"\361\314\270\333\243`*\210f\371F\377\3601\021\372\250\207\224"
+	.ascii	"\240\242\342\t\256\334\305\322g\242P\201\036h\230M\245\261\200"
+	.ascii	"*\246\273\234vD\355\322M\035;px\344(\357\246\362\001< \300\002"
+	.ascii	"!\"\343\006\222[\031\210\007\"\341\362\312P\230\022T\273\001"
+	.ascii	"h\006\271\210c9=\241\225\317\004\363\306x\006\317\f\3442(\327"
+	.ascii	"TR\327F\207\317\020D3@\230Td\372\271\375V3E\346|\264\007C e\270"
+	.ascii	"T\022%V\302\342\013\206\3277\224\327\330*\247xg\007\031\314\256"
+	.ascii	"H\b\001\301\025\330\200P\r\301\264\312\b\021\221q\303fqN`\032"
+	.ascii	"\221\317a\202h\016\231\301\250\263\241//\332C\006"
+	.text
+	.section	.gnu.lto_frskyOSDFillRect.81.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`!\003\255\025"
+	.string	"\366(\215J\300\020)\0353d\231\235\020\210yx\037\271t\027Hz@e\f\020-H|\252\271\3703s%\235p\233$`\313\"\370\022aM\305\231\204\376w*\013S\220\025\315B\371\225U\033u\215\345\240F\241\332\0343\255\223F\b\331;\245v"
+	.string	"z"
+	.string	"o"
+	.string	"$91\333~\213\273\360]\b\346;\263\036(|HL\355\332\304N\032\202y\322@I\362!(\352\001\rP\223\003\363$\311\357\034j`\236$P\214\235\332\357\271\217\357?&\332cWG\005\322\356\232\270\200y\022v\221\362\344\370\220\362\244}\266\215\237<;\342\303\003dQ\334]Y\035q\337\251\317\377\360\036Aa\314i\213\301\356\232\006\2057w\275\355\001\266)\3305D\324\007"
+	.string	"R\202Fx\251\243\335\232\254\035\373D&\235\270\320o\337':\223\375r\357C\376\213\307\370\222\013\207X\334\335\027Qi\347!V\322\023\225ve\212\t\246o\\\020\347\336$"
+	.string	"\306H\372$\377\350H\275\303\360\215\221so\216%\3414}/\342\301bVH\235\261\223\263\253\330\351\215|"
+	.string	"\245\367\"\336\317\255y\317\225POq\36749\351\b\346I\237\250g\277N\376C\277\002\257\234\017}\250\242 jw\037|\322\354\274\362F\207\375\350\225K\254\230\306j\323N\343\243\216\265\332\265\313\270}x\301U+\2556\356Nf\245\365@\254W\273\345M\033\234b\273|\230s\312\311\007q\220\365\225\326"
+	.ascii	"b\375h\226K\254\210PK\257\354S\206V\021\366\307\335]\327\035"
+	.ascii	"\373A\377\307\201~\327\317\337\374\317O\266\250\307\026umQ\323"
+	.ascii	"V\267\016\270\335H{\241\331F\233K\255\352\216\341\274\367n\004"
+	.ascii	",\266\033\312le\345D\204\303];\261\355r*\275\226\235\216E\226"
+	.ascii	"\303\3112\340h.\262\232n';\t\340\234\206\233N\366\222\313\351"
+	.ascii	"d\257\363\367q\353\216M\253\246\247_\2251\314\270\253\263`\n"
+	.ascii	"\210f\371F\377\360\261\020z\250\203\b\251L\340\364\314nb\351"
+	.ascii	"3U\260@\0374l\246\306X@\221\351\256\031UP\273t\223\252\312FG"
+	.ascii	"\216\362v*O|: \300\002!\"\343\006\222[\031\210\007\"\341\362"
+	.ascii	"\312P\230\022T\273\001h\006\271\210c9=\241\225\317\004\363\306"
+	.ascii	"x\006\317\f\3442(\327TR\327F\207\317\020D3@\230Td\372\271\375"
+	.ascii	"V\243\006\233\206@\316\260RIN\254\250\305\027\f\257o(\257\261"
+	.ascii	"UN\361\316\0162\230]\221\020\002\202+\260\001\241\032\202i\225"
+	.ascii	"\021\"\"\343\206\315\342\234\3004\"_G1\347\314`\370\331\320\227"
+	.ascii	"\027\355!\003"
+	.text
+	.section	.gnu.lto_frskyOSDFillStrokeRect.82.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`#\003\245\025"
+	.string	"\306\250\214J\300\020)\0353P>\341\300?\235\333\232\261\036T9D\tU~\240#\323\327?\013<P\\\202\217\350M\022h\337\"\370\022aM\305\231\204\376w*\013S\220\025\315B9b\325\336|R\027k\366s\032\377\274V\244\021B\366N)u"
+	.string	"y"
+	.string	"o"
+	.string	"C\273B\2120\333\376\211\243\340\375\347\345\033\263\034#xv\240vg`'\375\300<y\240\fQ\022>9 \362aj <\225\030\230'CH\300N\355\007\317\303{\217\211\346\330\275\031\026\355\356\210\r\230'_\377(O\216\367(O\232g?\375\314Y\020\036\235\237\211\251\335\215\325\020\347\235\362\374\017\317\001\244\351\235\262\026\354\256)\220\246\346\256\267]\300\366\004\273\332\004\224E\375"
+	.string	""
+	.string	"t\204h\356t\265+suc\233H#\021\377\371\355\373AO\262]\336\035\310'\372\212#\265lZL\355\256\213x\224\353"
+	.ascii	"+\351\211G\271rG\202\311\033\327\303\2715(?\030Io\344\247x\321"
+	.ascii	"\356*,\003\344\334\232[E8M\336\205t\257^\t'(\330\311\223*\330"
+	.ascii	"\351\207\214\240dw!\335\317\225y\260\352'8\265{\216\2344\004"
+	.ascii	"\363\244\037\264\263]'\377\345\211w}8\320\207)\027\346\354\356"
+	.ascii	"\2017B\271\256\374\320_>Ze\021\252\250\261\332\2623u\324\261"
+	.ascii	"V{v\027\265\017-\264j\245\325\266}\311\254\264\376g\365j\263"
+	.ascii	"\234\205\006\233\330-\037\336lr\362@\032d}\2451~V>ze\021\252"
+	.ascii	"\031\305\245U\366\tC+\b\373\343V\034\373\302\277\343>\177\353"
+	.ascii	"\347o\276\347'Y\324#\213\272\262\250\0035\016\266\334(s\221\321"
+	.ascii	"FZ\313\254\342~\341\272\357\356\004+\264Z\311\211\212\n\311\307"
+	.ascii	"\206{FB\313\335Rv,9\334J\354f\213a\260\311Zb3\\.F2\300\267\f"
+	.ascii	"5\\\314\345v\303\305\\\247\357\343V\034\233TRM\276\n\343\227"
+	.ascii	"q\367F\001\224\017\275\262O\364\207\376\341a\036\364\305\013"
+	.ascii	"\350I\301\260\t\242\334\304\322O\242P\201\036\350WL\355\231\300"
+	.ascii	"T\322[/j\024\027\351\246T\215\031\033Q\345\275\024; \320\002"
+	.ascii	"!\"\253\003\222[\031\210'\"\341\372J\2414%0\315a\027\361\314"
+	.ascii	"WS\231\022\212\313\2541\016\301\365\002A\b\3655\225\364\332\320"
+	.ascii	"\341\231\005a\206\b\223\212L?\267\337j\316\310\234\217\366|\b"
+	.ascii	"\244\f\223J\242\304\212Y|\301\360\372\206\363\032Z\345\204\367"
+	.ascii	"\355\240\202\201+\022B@\274b\033\020\252!\230V\271\020\22136"
+	.ascii	"l\226\346\004\266\021\371\f#Hs\317\fF\235\rty\321\0362"
+	.text
+	.section	.gnu.lto_frskyOSDStrokeEllipseInRect.83.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`#\003\305\025"
+	.string	"\306(\215J\300\020)\035\013\253c\332\306\fz\3258q\351.\207\352\210\312\030h\304;\325\364\022Nl\221\340\227 T#\262j\021|\211\260\246\342LB\377;\225\205)\310\212f\241\274\354\016\327~@\035\277,TX\331\241_\244\021B\366N)u"
+	.string	"z"
+	.string	"o"
+	.string	"91\333>\213\377\364\016\004\363\235\331\216\023;<R\2735\261\223\216`\236DP\212\210\360)B\250\351\241\361\300<)2s290O\032\270\212\235\332\027~\247w\036\023\335\261\213Sd\264\273$>`\236\204\035\244<9\376\243<\351\236]\343\247\316\206\354\b\177+\252vWVK\274w\332\363?|\0070\030s\332j\260\273\246\300\240\315]o\273\200\355\nv\275\t\017"
+	.string	""
+	.ascii	"\305\207\340\241\242vi\262\256\326\211<2q\240\337\276/t%\373"
+	.ascii	"e\336\203\374\242\277x\222\353\246\251jw_D$\035\210XIOD\322\225"
+	.ascii	")(\230\275qC\234k\263\340\027#\351\217\374\0267\342\335\205\243"
+	.ascii	"B\316\2659\326\204\323\354}h\007\213Q\001\345\024;\211R\214\235"
+	.ascii	"\236\310\tLx\037\332\375\\\232\013\213@\302\252\335\223\344\244"
+	.ascii	"%\230'}!\236\375:\371\017\375\022\t\257\021\017\372P\345?:\273"
+	.ascii	"{\340\217R\276+Ot\230\217\026=b\2255V{\366&\217:\326j\323\316"
+	.ascii	"d\373\020\203\253VZ\355\333\227\314J\353\177X\257v\313ap\360"
+	.ascii	"\211\355\362!\316''\017\264A\326W:\343\207\345\243Y\036\261\312"
+	.ascii	"\361\264\264h\2372\264\222\260?n\315\261\357\363{\274\347w\375"
+	.ascii	"\374\315\363\374d\213zlQ\327\0265mQ\0076\0177\3358{\231\325\306"
+	.ascii	"\232\013\255\346\236\341\273\363n\005,5\233\t\312\312J\tH\207"
+	.ascii	"\233VR\323\341Tx-\272\034\213\fw\223i\270\315\\d\264\234NV2\300"
+	.ascii	"\270\r\266\234\354\005\207\313\311^\247\357\343\326\034\233\305"
+	.ascii	"\240\223\257\312\030f\334\305a \325C\263|\242\177\370\330\007"
+	.ascii	"\375\323\005\310\230\272\272\021\246\334\304\322W\262p\201\036"
+	.ascii	"h\330L\2151\201*\245\273bP=m\322\315)\252\032\0347\312{\251<"
+	.ascii	"\361\001; \300\002!\"\343\006\222[\031\210'\"\341\372\312P\232"
+	.ascii	"\022t\273\001h\006\273\210g\271\232\302\224\320.\363\306x\006"
+	.ascii	"\327\f\0043\324\327TR\327F\207\317\020D3@\230Td\372\271\375V"
+	.ascii	"3E\346|\264\007C e\270T\022%V\302\342\013\206\3277\224\327\330"
+	.ascii	"*\247xg\007\031\314\256H\b\001\301\025\330\200P\r\301\264\312"
+	.ascii	"\b\021\221q\303fqN`\032\221\257\243\230sf0\374l\350\313\213\366"
+	.ascii	"\220\001"
+	.text
+	.section	.gnu.lto_frskyOSDFillEllipseInRect.84.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`#\003\265\025"
+	.string	"\206h\214K\260\022R:\203\333s\037\250\266H[\244m\030bd\347F\230\001\262\317\022\017\312\213T\352_\341/\335t\254\212\r\033\350\313\224\321\r\277\027_\273s\307\370qe\357&\360\303Y\336\263\216Zf,\235p\001j\267#\226\020\262wJ\001t"
+	.string	"x"
+	.string	"n"
+	.string	"v\225@\301l\373Cw\301{p\346k\263 '~\206R\2738\260\223\206`\236<P\226\320\020\252z\200\024\204\303A\360dj`\236,\001\202\235\332\007\376\207w \023\r\262\3133<\332\335\023\0330O\276>R\236\034/R\2364\317\316\361\323gI~\210|-\250v7VK\234w\312\363/<\310/\207\346\224\305`wM\1779:w\275\355\002\266)\330u'\324\017"
+	.string	""
+	.ascii	"\3050\347QM\2737W?\326\211D2\361\340o\337/\372\222\355\362\356"
+	.ascii	"D\376\213\313\270Rk\007\212jw]\304\244\234\007XIOL\312\225*&"
+	.ascii	"\230\274q?\234\253\243\300\007#\351\221|\030?\332=\206u\220\234"
+	.ascii	"\253s+\t\247\311\373P\367\242a\021u\004;\271R\204\235\336\310"
+	.ascii	"\bRv\037\352~\356\315\201\305 \220j\367<9\351\b\346I\277hg\273"
+	.ascii	"N\376\302w\2158\321\205-\037\362\331\335\377\216\304r]y\243\277"
+	.ascii	"z\264h\223b\210\261\332\2627\205\324\261V{\366\032\265\013/\264"
+	.ascii	"j\245\325\266\235\311\254\264\336g\365j\303|\306\006\253\330"
+	.ascii	"1\027\336\254r\362\277\035d}\2457|V=ze\223\"\210\247\245E\373"
+	.ascii	"\254\241\225\204\375qk\217}\241?\344A\177\353\347o\036\350'Y"
+	.ascii	"\324#\213\272\262\250)+\265\016\266\334(\223\221\321FZ\314\254"
+	.ascii	"\342\216\341\272\357\356\004/\264Z\312\212\213\013\312\b\207"
+	.ascii	"{\206B\313\335Zv09\334K\354f\213e\260\311bb3\\.\2062\3007\r5"
+	.ascii	"\\L\346v\303\305\\g\357\343\326\036\233E\021N\275Z\343\231q\227"
+	.ascii	"g\201T\020\275\362\215~\341a\"\364O\027\260\302G\212\035 \313"
+	.ascii	"M,\375\245\n\026\350\177~\331T\032\023\240Zz\313\306\324\323"
+	.ascii	"*\335\3541\205S\305\243\274\231\312\023\003< \300\002!\"\343"
+	.ascii	"\006\222[\031\210'\"\341\372\312P\232\022t\273\001h\006\273\210"
+	.ascii	"g\271\232\302\224\320.\363\306x\006\327\f\0043\324\327TR\327"
+	.ascii	"F\207\317\020D3@\230Td\372\271\375V3E\346|\264\007C e\270T\022"
+	.ascii	"%V\302\342\013\206\3277\224\327\330*\247xg\007\031\314\256H\b"
+	.ascii	"\001\301\025\330\200P\r\301\264\312\b\021\221q\303fqN`\032\221"
+	.ascii	"\317a\202h\016\231\301\250\263\241//\332C\006"
+	.text
+	.section	.gnu.lto_frskyOSDFillStrokeEllipseInRect.85.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`#\003\255\025"
+	.string	"\306\350\214K\260\022R:\203G\0369\237\020\327\224\030<[]\036\242\274\017\301l\177<\to 8A?X\n\345\243\275\233u\033\350\313\224\321\r\277\027_\273s\307\370qe\357&\344or\230\254k\300\213\323\017>\001o\331\"\215\020\262wJ\001u"
+	.string	"y"
+	.string	"n"
+	.string	"B\273L|`\266}\026o\301;\021\315\367fCJ"
+	.string	"=Q\355\346\300N\372\201y\322@i\002\034\272r\360A\210\330\340w\342``\2364Y\330\251\375\340\201x\017\362\320!\273<OJ\273\213\342\002\346\311\327I\312\223\343G\312\223\346\331:~\372l\tP\f\337\n\342\356\306\352\210\363Ny\376\205\017\371\351\324\234\262\026\354\256\351Og\347\256\267M\300\366\004\273\002\003\224E\375"
+	.string	""
+	.ascii	"~:\350|*i\027\347*\310F\221K$N\364\333\367\215\356d\273\274{"
+	.ascii	"\221\357\3420\336\324\002N\021w\3275d\312y\200\225\364C\246\\"
+	.ascii	"\211B\202\311\033\027\304\271;\t|0\222~\311O\272\322\356/\274"
+	.ascii	"\243\344\334\235[E8M\336\217t\257\032\025S'\354$K\021vz$\037"
+	.ascii	"P\331\375H\367sq\036,\022\005\211\273'\312IC0O\372F;\333u\362"
+	.ascii	"\017\256\020/\272\320\345H7v\367\277/\265\\W\036\351\257\036"
+	.ascii	"-\372\244\3703V[\366\032\"u\254\325\236}F\355B\013\255Zi\265"
+	.ascii	"m\2072+\255\367Y\275\3321\227\241\301+\266\314\2057\257\234\374"
+	.ascii	"\217\007Y_\251\r\237U\217^\371\244xBji\321>mh\025a\177\334\335"
+	.ascii	"u\355\261?\364\213\\\350o\375\374\315\007\375$\213zdQW\026u5"
+	.ascii	"\016\266\334(\233\221\321F\232\314\254\342~\341\272\357n\004"
+	.ascii	"0\264\232\n\313\313K\n\311\206{\226B\313\335\\v19\034L\354f\213"
+	.ascii	"a\260\311db3\\.\226\"\300\267\f5\\l\346v\303\305\\g\357\343\326"
+	.ascii	"\036\233\305\024Q\275jc\232q\227G\001\225\020\275\362\221~\341"
+	.ascii	"a#\364R\0371\361#\0070\330r\017K\337\211B\005\372\237_7\265\306"
+	.ascii	"\003\210No\321\250\222\332\246\233>\252r\200\364(o\250\362\303"
+	.ascii	"\007; \300\002!\"\343\006\222[\031\210'\"\341\372\312P\232\022"
+	.ascii	"t\273\001h\006\273\210g\271\232\302\224\320.\363\306x\006\327"
+	.ascii	"\f\0043\324\327TR\327F\207\317\020D3@\230Td\372\271\375V\243"
+	.ascii	"\006\233\206@\316\260RIN\254\250\305\027\f\257o(\257\261UN\361"
+	.ascii	"\316\0162\230]\221\020\002\202+\260\001\241\032\202i\225\021"
+	.ascii	"\"\"\343\206\315\342\234\3004\"\237\303\004\321\0342\203QgC_"
+	.ascii	"^\264\207\f"
+	.text
+	.section	.gnu.lto_frskyOSDCtmReset.86.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`v\001\235\016"
+	.string	"\306\031_F\020\215*\035\003,\252"
+	.string	"\256\372\004\212 )\232\316l\003\025\037v=\323\013\bf\366y)\260\346\315\356ei\026cu\205\304=(\251\246~w\021"
+	.string	"D\370j#\323=-\301\231 \024\327\2050\032O\"\331d\357\224\002D"
+	.string	"L"
+	.string	"L"
+	.string	".\037\320(\375\204\364\272\251\263F\030\213\266[7\247.\320\235\372\255\222\2359}\306\241]\342\225\303f\264ZDRh\273\353\315\r\017/C\377&\007\200R\231.-\024\354\256%J\265\272\347m\023\260\335\300\376\030\035\374\326c\245\263\374\372\224\303.2\240(\331\335\214\2502\272\260\241\362\242\312\210+a\320\205\333b\250\273J \262\331\344_\276\207\177(\035\305/\031uW_\261\240\036\203;\355\036\200;\265\035\376\204\2441\241\270\314\f\234n\214\233)\037+\267\b\316\217I"
+	.string	"\345Q\326T\230&\017\240\305~\321\002C\342\260w)`Fj'v\304]|\341\376\272\346\264r\022w\3275'9Z\212\262\255\231X9\3325DN\r\366\267\235$\366$\261\244,\250\356\022\263\233\212Q\261#(K \n!p\353\200t>\233\021x|@\032\033\035\035\034\214\317\207g\332\303\371\200\237\203\t\017@\221\207\367\205<\b\241\316\207\347\021\201\036G\200\277\b \221\007\362}\"/SO\337v\222p\310Fj\263\323\f\261/\276\\\277\3119dK\233u\362!~\020w# `\0021E\252\003$Y\031\305\373g4j.%Dh\022Ripv\np\240\377\bnPaM\2725\034\214\2670\221\316\236"
+	.ascii	"\254e\bD\0316\225\204\304\n\263\370\222\341\305\033\310k\260"
+	.ascii	"\312)\274\263\013ZT\201\2035\007\001m\337\b\001K\267h\351\023"
+	.text
+	.section	.gnu.lto_frskyOSDCtmSet.87.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`]\003E\026"
+	.string	"\246\247\215K\260\020V:*\244^yHz\364\213\370\266\357kP\335(\264\031\231\312\204\377\023V\260\225M\033(\204*8g\271M\202\343\232\235\201\244\255\202\321c\373\n\232;(\327\347\013\374.l\r\375t\232\216\302\231\252\213\215hB\b\331)\005w"
+	.string	"u"
+	.string	"u"
+	.ascii	"\277E\241xjH\355\336\224\334\364\003\364\346S\327H\320\220\t"
+	.ascii	"\007)\204,,Cv\003\215M\203\023@V\fB\370<-\350\220\026)@o\216"
+	.ascii	"h\200\275\332\007\236\207\367\036\013\375\261KTa\264\2730\033"
+	.ascii	"@o\276.r\336,/\340\274i\236\035\365\264\304\272xh\324\004U\355"
+	.ascii	"n\214$q\336+\317\177\360\037>\234\231W\217\004\273\353\352\303"
+	.ascii	"\371\335\344m\027\260\355b\223?\001\346\021\212\023\375\366}"
+	.ascii	"\341\215v\313\273\027\371G\177q%V\216\216\235\335m\025\211/\034"
+	.ascii	"`\036\365E\342\313\271#\001\345\225\353!\335\337\201\032\330"
+	.ascii	"Y\237\344"
+	.string	"\267\270\213\335\221l\303\225\356\357;TR\224w\243\230\327\314O\024\261\344f\312\021f\326\017=C\331\335(\346\351\332\034x\034\002V\355\246\260\233\206\200\336\364\205;\273u\363\017\27252\204}\305Y\360N$\363\r3&Pe<\013\006\025\323*\035\235\242\272\311\201\303u\033\317\027\337\002\361\242\007q1'\337\223\376\352\r\037s~\370W\257\036Mr\234\002\231a\262\200\250\f\362$c\324r\366QI\333\262\007-t\n\200\247\017\275ze\222\243\221i\353\321Ni*9\302~\271\244\216\375\241\037\344B?\353@?z\237\377|\372\227\357\371kH\200\036(\234G5\355\332\\Y\355R6\f-\272\222\006C\253\225\265\333\n\251\263Y\230@\273p\316Nn\244\354\344F\316f7R6\273\221\263\023\226\232\r%EE\305DD&\273\221^1\251\351p\021v.\272\034K\f\327\022\243\320B\273\305Vr\272\230\311"
+	.ascii	"\343*\330r1\030\034.\027k\245\275\227K\352\030=R-\365H\032\313"
+	.ascii	"\224\273\"\020H\371\324+\373\305\017\377\340KZ\365Mo\335\240"
+	.ascii	"r\312\001zx#\235\276\321\345V\357\363+\003\031M\250Qpf\004SD"
+	.ascii	"\"Q\024\027(m\360\002\021\242\242\003\021P\271\206\242\320\266"
+	.ascii	"\003}\230$\220\316\265P\317\210J\270\337\0360{\350\237d\257P"
+	.ascii	"\007\203~\335\331\373+5\005\2515\245\310Gl\307M\3027\177\366"
+	.ascii	"\t\202\f\317S\013xF\312\201\002Q;\364\316\220\225\007\242\215"
+	.ascii	"\034m\352\004\231\022\215\013\205\313Y7-\306I\205@\344d\234Z"
+	.ascii	"\206\330\331\f\002\253\032\266\367O\302Di\377\205^E\301p1r,\027"
+	.ascii	"\371\n\030u\005jZ\3140\r"
+	.text
+	.section	.gnu.lto_frskyOSDCtmTranslate.88.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`M\002\r\023"
+	.string	"\266\342{J\300\3608\035\253oF\325\271\347\177\353\322\273\266\r\fI\326\264!:@\026\205\271\316\200\305\235\"\203\315s\214\022;:\007\232\332@)\306\2428\364|~C\020\001\301\030~\323\262\212\261\002 ;H\004r`Vi\274\231\210\220\235R_"
+	.string	"f"
+	.string	"g"
+	.ascii	"\337\332\236\206\306\315\016i\227&u\320\f\304\203FE\224\fth\201"
+	.ascii	"x\0205\244z\265o\373\315y\034\343l\332}q\013\332]\022\023\020"
+	.ascii	"\017\236\036\022\036\374\036 <\350\323\256q\324\304\212\334\354"
+	.ascii	"\220I\225v\227\364J\374|=\375\2477\321j`^=\024\354\256+\255\246"
+	.ascii	"v{\267\215\262\r\301\256i\366\375\236\347\354\321\346y|\025g"
+	.ascii	"\361\240\217\020#\016\250e\203\312\243\036\007\324\022\246xp"
+	.ascii	"~\333\001\335\032\002\031UX\377c~\205\217D\320\255}\311\201\350"
+	.ascii	"\363>.'\030\235#\243\324A\226N\005\326\337\\bb\336\307\345\350"
+	.ascii	"\316\334\246\363\261)\355\242$\007\335\340=\246=\036\374S\217"
+	.ascii	"(\033*\333~\316u\316\357\274\004\036\214\007(\345\376\001#\251"
+	.ascii	"h\203.\342H\242\311qC\274\207\302\343>\2128\317\323\362\200\021"
+	.ascii	"\355??\315\204\356\022\376\366\323\254\352<\262\304\341+1U\317"
+	.ascii	"v\201\247\306\231\0052\343\303\254\356<\242\333\025m\325\331"
+	.ascii	"hL\365H\330\377vw\355\331\330G\377\3578\177\025\001\304\320P"
+	.ascii	"\363\243\244\335\231\235\216%\002\205P|\347\017/\f*\261\257%"
+	.ascii	"k\271>\027\013\212\027{U\220\320\262\020\232\262j\003)\256\227"
+	.ascii	"\t\353\344d\025rAV\215\262r\305\312\b\346J\f\226B\226*\344\004"
+	.ascii	"\225\026\013\211\002\213\221+\001.)\274`\244\254,a\344\210\316"
+	.ascii	"\376\255gcq\311\003\321\314\213\361\313\267;\"\001RN\335\375"
+	.ascii	"\366\247O\215\365.\016\222\323q\002\204\315Bw\213\320\317\255"
+	.ascii	"\260\324\323|\312\0200 \200\002\0312\335\006\033[\021\212\027"
+	.ascii	"j\321\022Q\031$2eC\220\ft\313d\235\246j\005T\242\031\307\270"
+	.ascii	"\301u\002\221\025fEQ\024\210\n=\251\275\242a\232\335\214\370"
+	.ascii	"'\364\274\354!\2202L*\211\022c1\303\312\303Jf\262\240!o\275\346"
+	.ascii	"\207\n4\2241\241\300\302-\344H^\223r`\332&\"\034\032\331\234"
+	.ascii	"\200q\020B\232[\b\364\t"
+	.text
+	.section	.gnu.lto_frskyOSDCtmScale.89.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`M\002\r\023"
+	.string	"&#}J\320\3606\035\206\272%\302^\366\321\004\031\306\320s\335HV\222\030\211\337!\303\316Jf\310\316\256-7\001ie\370j\024q\366\030\303\251\034\301\366\224\361I\350\b\207\037t\270\361\267\300\361\032\340<\230\027\201\027v\271\207\210\220\235Ra"
+	.string	"g"
+	.string	"i"
+	.ascii	"B3_\332\036\307\306O\316m\027\207\344\240\031\210\007\215\212"
+	.ascii	"\252\035\324\266@<\250\352\260z\265_"
+	.string	"{\317y\037\333\214\332\205\321\223\264\273%& \036L=$<\370=@x\320\247}\343\350\316\212\374h\260Iq\273Kz#~\276\236\376\323\243d3\232W\017\005\273\353*\233\321n\357\266U\266!\3305\r\276Ot%{4\354C\276\212\263x\322\307\007$\236\335\035mH0\033V\036\3656$\230\220\347\301\371m\016\2724\0046\253\260\376\b\366\025\306!\202.\355:\007\242\317\027\311\244h\202p7\222\203)\271\025Xo\344\023\024\330\213d\216\356\315k\271\242\032n\027-9\350\006'\202\331\343\301?\365\250:\261\262\355\003=\350|\031<\032\017\300)\375C\206S\323&]\324\341\204\263#\207x\307\bo\373\b\342CO\313\0034d?z*\266t\231\360FO\305j\316#:\024\337\t\252z\266\013<\265\315) 58\304\352\316#:\023M[s6ZS=\021\366\277\335]{:\366\321\377\273\317_E"
+	.ascii	"3H\314\216\333\355\336\354\236\226\tlQ\342B\277\003.\f-\346\307"
+	.ascii	"\212a\265\276\326\313\212g\272*H`Y\baf\265\001\226\226\013%E"
+	.ascii	"E\305$\344\202Y\275b\3222\313\b0\027\363\305B\226-\344\204\026"
+	.ascii	"\326\013\271\3622I\023\001.)\270^dLY\276\310\021\215\335\323"
+	.ascii	"\261\250K\301\024\363j<\363\355\206Hp\241\377\006Tw7\372\323"
+	.ascii	"\223\214\365/\0162{\272y\250y\351v\021\372J./\3652\247\002. "
+	.ascii	"\200\002\231:\326\001\033[\021\023Z\200\034\227\020\222\"\301"
+	.ascii	"H\016ze2NS\264\002\"\321\3741~p\235@\344\204YQ\024\005Qa'\264"
+	.ascii	"W\035\246\365\315\2161\302`\210\262&\301D\331\260-#\312\003\312"
+	.ascii	"k\262\212\021\033\235\346\007\022h\030cb\201\206[\310\221|L\312"
+	.ascii	"1\323\232\210\344\220\310r\002FE\bin!\230'"
+	.text
+	.section	.gnu.lto_frskyOSDCtmRotate.90.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\265\001\345\017"
+	.string	"6\334fG\360\216j:(\270\032\300\342\345S\256\313\214\250\200\375\236`\364g[\026\326\3412\344x\265!\266\371\237\375w\036B\020a\035\203J\353#/\260&\007^\005\226O|\0250`b0\244\017\361y\321\343N\245\223\232\220\235RK"
+	.string	"T"
+	.string	"T"
+	.string	"\367\036\332\035\250\361\324~\353 \316\243\270\2045\273(P\\vK<|"
+	.string	"\274'~\343\273\327}\300w\317\247\315\342\365d9\\&\250\225\332\356\222\\\207\237\247\247\177\3275)\225\351\024\300\202\3355M\251V7w\333\035\266\037\330\264\023~\210\217\270L\303\204\026\306Z\314\013\343G\037k1\277\017\016\300\263[\fuW\nP\243G\017\363W.\242t\026\267\340\250\273\372\255A\005\317\253\220D\323k\2466\336\353\330\306\216\376e\004\234\322UH\257K\362\226\r\326\252\355V\217{f"
+	.string	"\336\363SJv\030)\213\0268\223\013\324f\327P!\023\263\262\203/dJf\\tw\212\357\261\207\032^\3572\t\316I\352\260\213'\332I\337_\027O\324f\003\267\0231Kmv\035\241\034\007\373\335\356\2569\226\315\tX!S\035\006\313.\311\214\030\013\343\231\360\340\247|Vz\r\241\n\"\263\363\210x@\035(\344\3039\001\b(\304\351||l6F\367g\0032K\b\244\b\346\b\204,E\244\004\221'\204\374\214LrC\300\345\204\320\210\024)\313\021\031\326\323\273\345X\006o/0'n\344\257\337\365QC\357\362"
+	.ascii	"\033d\2602\264L\273_>\177VR\240\017( `\2021d\333\001\202\025"
+	.ascii	"y<\312Fc\"\342\024\226\263\345-\243quu\212\350o3\216q\203\357"
+	.ascii	"\004*\020|U\242D\013M>/\265\320\002$\236F\201\035\002q\206M%"
+	.ascii	"\231Xy\213/\f/\337p^\303*'\361\326\016:\030_\t@@\344\212m@\260"
+	.ascii	"\301o\222\002sy\321\0322"
+	.text
+	.section	.gnu.lto_frskyOSDContextPush.91.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`v\001\245\016"
+	.string	"\326\231_F"
+	.string	"\217*\035\203\342@\276\370\361_\271\255\2738o\177P\361\031\3266\225\222\305\335\326\231\254\216l\230\260\203!$\2065\020\rj(\336\245~GTU\273l\252\310\237e\216\020\360\006g\226bu\210!\214l\262wJ\001E"
+	.string	"M"
+	.string	"M"
+	.ascii	"g\031\301\006\351(\243\327E}5\272V\264\335\2529\265\201\356\324"
+	.ascii	"?!\331\230\323c\034\332*^?\254\006\013\304\210\nmw\275\351\341"
+	.ascii	"\341e\350\337\344\001N\251\322%\200\005\273kyJ\251\356y\333\005"
+	.ascii	"l;\260?\006\324D\b\377\344"
+	.string	"/\322W~\275\312]\030\034P\224\354.F\\\021i\320PyqE\304\2254\350\302m7\324U)\030\321l\362-_\304G\220\236\342\230F]\325]0\250\317\340N\273\013\340Nm\207G\031eJ)/\260\003\247\034\243f\312$\356\226\373\004\347\277&\200\362'g.\314\222\t\320^\307`qIq\327\273\231K\206\032\213\025q\027c\334[\317\230Z>\342\316z\306$GKq\006\253\255X9\332UD\316\016\366\267\235$\366\264\300\202\302\220\372Kl\027\365\242\305\302\002\237\n p\343\204p<\233\023|x>\033\034\036\036\233\f\017Hg\272\263\361\200\337\003\n\020\300\320\207\367\201\274\b \016\210\327\t\201\336f\200?\t\237\220\027\362}!\017SM\337v\222\270c&\253\311LS\304\276\330b\375&\357\230\301h\262N\276\304\037# `\202a\212V\007$Y\021\305\373\227hYxJ\230\226\272\312\203\363S"
+	.ascii	"\006z\216@\203\352k\322\254\341c\274\265\211\264\354\t\210\265"
+	.ascii	"\206@\224aSIH\2540\213/\030^\337\270\274f\253\234\346\275]PD"
+	.ascii	"\025\037ds\020n\373-\004,\335\242\245O"
+	.text
+	.section	.gnu.lto_frskyOSDContextPop.92.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`v\001\225\016"
+	.string	"vY^F\020\217(\035\003\\\026PF\217\2060\236\201$\237l\251\021\276\266\320t\021>\202&n$\342\377^\325,\354\027[\261\325\224\2409G.\332W\002"
+	.string	"PL1\221i\024=\373HY\250K\021\220\323N\020\331d\357\224\002C"
+	.string	"L"
+	.string	"K"
+	.string	">\340Q\372\n\351uSg\215/\226\270[7\247.\260\235\372*%;s\372\214?\273\305\253\207\355h\2050i\021w\227\233\035\376]~\376S\016"
+	.ascii	"\2452]j(\330]K\224ju\317\333&`\273\201\3751\273\202"
+	.string	"\232\370\340\253\034V:\313\257o\371kcC\212\f\3502\312\260\241\362\240\313H\003\301`\373\262\325Pw\225\300d\223\311\273|\021\037Q:\213a:\352\256.cA=\207v\272=\200vj\373\373\nIcb1p\3721n\246|+$\356\227\373\204\346\303$x\362(k,L\223\007\210\260o\250\bY\374\365\rF\210!\366bG\332A\030\355\256kN/'io]s\222\243%\030\242\304\\\254\034\355Z\"'\007\373\331\316\023{V\020S\027T\037Q\354\246f\304\b \n!/\353\220t>\231\021\210|@\036\037!!\034\216\317\210g\332\303\371x\235\203\t\017<\221\b\327\2058\b\241\316\b\347\021y\034G\200\273\b \021G\322u\".SO\317v\236\030$\254\261\230\323,\261\017\272Z\177\312AB\0241f\223/\361\007$ `\202a\212T\007$Y\021\305\373\247hQxF\2306u\225\2033S"
+	.ascii	"\005\372\217\340\006\025\327\244[\303\301x\013\023)\354\r\210"
+	.ascii	"=B,c\b\344\f\237Jbb\305Z|\311\360\312\215\3465X\345T\336\331"
+	.ascii	"\005!\252\360A[\001\301\t\377\306@./\204E\006"
+	.text
+	.section	.gnu.lto_frskyOSDFlushSendBuffer.part.0.113.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`A\0065$"
+	.string	"\232@\324\rF\220\\Q:\260H \343\346\325\264\216\300<\221\261z)\255\220R1\206\034\016\224\266\375\244\332uE]o\034K\206A&\210\221&HU\020\001Q\027a\237\206\006O\342\342l\317\305\002,\005\247\231-\371\204l\271S\n\307"
+	.string	"\301"
+	.string	"\310"
+	.string	"\243\220\236\252,2^\227\352o@\371\254\024km\312P~\264\331\b\262\217\305\267\362\037\322\2578\213F\343W\235^G\206\374\252@\370\350\007\345G\332\013\220\037\351\007\220\037\247?ud\313\374)$[\366\221\212\355\243&$;\316\177\275j\3007\245\206\226;\265\326\332\307MbJ\251\377;\375\335\257E:\254|\221#\335\031C\362\247\316\200\007'i\bt\232q\330\202\247\035\274\227\364\245\244\243\311\265\232\200\320!\256\242\360b\226\346+\006\345\307\311\362\307G\352\263\345\013\362\343\244D'\360\202[\377\362\211\303)i\322\311\004\245\307\367_N\243\360\332d\031\002\235z|\nx\354u\241\326\352\357\202\334\262\333\016\332\356`\223\002\002\316\"\375\024\244]\304b\236\3114\245\235\341{\371sl\221z\202gN\235y\346Fyc\037\352q\025\275P69=\243\323?\3434"
+	.ascii	":\355##\247ct\032v\341]\276\310i\222N\217\307\272\351\201\367"
+	.ascii	"\216\323\223N?\001\365\231\231\021\251UG\227\236jd\024:y\360"
+	.ascii	"\357\362\003\177\254_x_(&\214\0037\325\372\213\n\2720\f\2220"
+	.ascii	"\016\252\370\202\305Z\177\300c"
+	.string	"\371_,\363\321\255N\345wy\360^\216\216\216~\305\006\035\337\225\255G\320\201\267\362\271\330x\\\256\234\365\272\243\376F\317\307\245Xk\345 '\350V\237\362\261\274\352[\204\212[,A\b\351Zt\264\002\241\340\243zR+\030\r\345\003\017@\034\nY+2JN\344\270P\226\231\331\327\216K&\204\323\305\261\273\030\324\320\230\\y\236\350^\330M^p\253G_{\254\323\"\234\356k\277D$ivy$\016yh\221{0\367\222\242\034\227\334\3031\214\007ue\255uh\\!%\302\335\354\362\211C\037?\233#o\244v\243lC\3400\3654\344\241Ug\036\357\036\370\027Fv3\217\tLz\237!\217\365\240\007\013=\246\271\366\007\020\363L\273\264\245\235\273Y5\366\330!\256FG\241g\213x\232\033\020\261\326j;s48\237\311G\227\310\3153\345\310\217_\nJ\250J4\375j\253K\313\327\221\017\236"
+	.string	"\221\316nv\231\224Z\343+\317:)\365\273\023\233\r\036\271\334\274\031\335\326\bGD\364b\004\351\tD$pBC#F"
+	.string	"\025\300\305\310m0\341\242\204\n\034\212\230o@$Z\024\205\320\235haDT+\312\325T\344D\244\250\335\214Z\324\200\016\270h\005\316\250\346\242\250\310\2506\277P\376\324oc(e\315n\223`\033e[F\027\035\255\365\311B\021K\231\333\321! \326\271\315zt\024\364\250\324\331>\353?;\333\327\330\023\374\317\302\200\354fW\200\253a\021\255r\243<\003\222\262\035\271F\343"
+	.ascii	"\260\345\316%Y\320\370,\200"
+	.string	"}Qg\353\325Zmrn\021\342\370\254M\t\325\350\243\334\013i\255\265\2766\312\266l/<\355\016\310re\2575C^l?\006\2661\025w\243{\025\321\336p\"\207\n\275\341-h\013\266\257r#&\200\200\250Q(\210\030c\b\215\210\314h\n\223\026\003\200\002\031\2629n\021P5\204jF\332J\245\003\262\306\366\020\326\305c\2622\222\013H\b\023\277U4\263\236\206\\*\271a-N \345\246\233\337\307\223[\347\355;\220\3754\317\220\255\025\334/H\311\032!\233R\224/gb\246\214;4]%\341\251\335\323\304\245M\350d\216\021\371r\267[\013\223[]\202\344\221j\317?k\360\302\366\214\333\215\"\270\017\"\241\201\261\r\251ww|\205\203\300\t\204\215\204\252\336\016_\201\376\342\370\207\254?V`\310\001\021\250z\223Xc\231\211\243&D\357<a1a>\201Jr\310j\324*\005\032\332\241~\177"
+	.string	"^\312\202%\221\350\302P\205\"\314gBP\214\032\365\355\205!\361\212\310\353N\301\235\255K\254\3162\324\002\342\310L\002\212s\265\321V\2656>7\247%"
+	.ascii	"\336M\207\035\322\304\304\361<&\267\006\301O\313%\017\240C\244"
+	.ascii	"\0023\263\"\346=*"
+	.text
+	.section	.gnu.lto_frskyOSDUpdate.part.0.139.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\246\001\r\020"
+	.string	"&\\gG\360\220*\035\360\241\2213\034VG\303t2\275\276\246\230\362xy\247e\250i\242\322[\032d\005;(\r\r\320\275\272\036fw\342\270\b\03376F6\221-\242\315SdL\361\273\021\023\216|\243\n\\#d\357-S\nT"
+	.string	"P"
+	.string	"S"
+	.string	")\273\306kH\013\214P\321\022\203\243\224~\237\321\303S\357\246\214\353\245\374\316K\365N\303\247<p\243\301\341\361\242 \t\270B\264XVn\353\225\341Q\216\260\3408x\274X\022@\256\005\306i\337\n\257\325\256\200{^\t\245\324\234\r7\347\266Sl\207\330+\003\336%\215\035\354\270^\271~ga\013XP\352\272\331Ac\023\205\210\022\376\220\240l\002Q\325\320u\230\013\325\005GY\025\301\207\344d\323k\350R\320\002\347\202\243\264~\276\377\362zz\315\037\230\215\277\234\356\323P\266\307\247\245l\317\347g\266Q\030\034\247}a\026H\270\260\261\315`m\316\257\016]F\364\021VG\370\211\321"
+	.string	"\031\224\322\00417q\342\203\3704\n\270o}\372`\367\371\370\361\241\266\2627~}\247&\005\347\306\354\226\303&T\363\326.\251\354[\006YE\225O\373C\333\354\005]\035\033e\216\001\016\211<(\201&\246\223\022\t\302\007\216\276\224\021\b\345\013\221J\237\210\001\203\022D\244o\002\b\222>\217\355}\311J\\u\fTV<\314\335ff\224\371\246n\243\003\030\032\254\3155"
+	.string	"\355[\033Gb!\266\032\031`m\023\220\214\215&\3361fj\261\030e\236\027u\217\001* `\002\031t\346\001`\304\247"
+	.ascii	";\201LG\004\273/\214\263\356)\271\264\231\026\t\\\340\210b\201"
+	.ascii	"n\20538\340\210\367\\8\340\222\255\366\222\006DdE\031\326m\203"
+	.ascii	"\3579\ng\343\272mXa\002\264\331\003\333c\263\346\006Z\033\311"
+	.ascii	"^\372*\333o\351\nc\362\"\\\215\262\n\306\240\335\270w\2051"
+	.text
+	.section	.gnu.lto_frskyOSDWriteFontCharacter.part.0.144.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`I\002\235\023"
+	.string	"\346d\201J\300\322Q:\302q\252\204Bv\320\251\230\214`e\227\352N\003\016w\310`\216Av\030C0Rh\211& \"T\277zY\0041g\376"
+	.string	"\332\336\270\377\2460Y\024\025w\351\206\325\030\237F\201(0ow}\270!B\366\336)\005i"
+	.string	"n"
+	.string	"j"
+	.string	"\252\331\207X\265\334\033\\K\306E\347K\237\305[\320>\3042\200]\235\032L\273e\311?/P\375\033\271\b\370\257\376"
+	.ascii	"\370\317\276\220OZ3\234m\237\264h\256\275\314\331 \370\271\321"
+	.ascii	"\024\355\330-\303\177\364\304k\247\263\326\374y\273\261\235\276"
+	.ascii	"\367\n\204\263\364\224\003\351\006\304\247\201W\020\224\335\265"
+	.ascii	"*\304\375\335\366\003\333\023\354\351\023uEp\240O9&]\320\316"
+	.ascii	"\224$\344w:\320\320M\373\276\322\227\354\225\311'\231\232p\362"
+	.ascii	"\311\321\355\356J\211\364}\336\314\357y\345\331\217b\214;\217"
+	.ascii	"\266\372\327\302q\331G\362\215\016\203\366\243\230\021[\2716"
+	.ascii	"\001;(J\335\216]\034\311?KP\375\253\270\213\354<+\367\203\007"
+	.ascii	"W\235/\362w'\242\335\005\206\004\004v\206\210D\004\325?\227\001"
+	.ascii	"\267a\262\371\233Gh\250\315.:V\224\020\2456\205\367Zhnw]\277"
+	.ascii	"IMJ\351q\320\374\b\362gh\020\301\246;\275\370)\374\036\214\177"
+	.ascii	"\3737/\202\377^\203#3"
+	.string	"\247\354\002\344\262\342\306{\017y\321\264<\244v\366\230\264\307\264\276.\345\261=]A\246\351\313\177\276\350\177H\375\311\r\310\331\265\231\362\261%>\031*\316{\214\260\217,0j\006+1Y\313\201\212\212\211\bI\312\306X\354\2252\276X`\001\f3\211\221bJ\206\027r\\\t\305\226\260B\313\013&\204\215dh\242\300\242\005\331\030^\020\3051\\\275.\345\231#\214x\363\257\201\225\326P\243\310\320\r\216\251\273:\020\316\373u\354\346\224\351\353\356.\245=\266YQC\005&\b\324S@\357n\033\340\223\336{5\200\272\225\004. p\242rG\363\3252h\301\030\\\004\336>\222\271\027\217<\307\254\211\205\331\334U\001?\"O\334\033\021B\374\364\346\204\036\340J{\nd\2169\310\322\264-m\273\304\320\215\213\2417\"G\204\271\271\235\213z\312W\274\347\250cE\n+\220\347\253\0303\270\0307\tA\\A2"
+	.string	"[\307\374"
+	.ascii	"\225aT\003Q\030\330t\352\265a\f"
+	.text
+	.section	.gnu.lto_frskyOSDBeginTransaction.part.0.149.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\223\005-\036"
+	.string	"\306s\265I\240\326Uc\024O\251\360\177\024r,\t\224\317z\305\232\214\264!\357t\302\035\316\372\013\234\\\234f\373"
+	.string	";\302C\252\365H[\354e\256\007\227z\205\327A\227q\221\377\340]\222\\\256!\207\207{\b\004A_\264\261\367\2262\245\227"
+	.string	"\246"
+	.string	"\234"
+	.string	"G\257\317\203\311\244\340Q\202\353\246\237CW\372\302\235\r\363\205<\033\346\335q\200(\321\373\363\311\004\221\325z\324\267\361\033\274\343"
+	.string	"a"
+	.string	"\367\272\210\302t/\252\340\246\021\270n\306\356r\336,\337r\336\264_\303\366\316g\236\235\344\350\320}\001\036y\216\216\367\336\331M\013\343\274\233\245\255'\317\0370\324\271)|\355\371\245x\371\251W\026JF\306\035?\024\267e\202\264\351I\200_\210\322\305GF\317\211\257#~;\265\262\374T\211p\357\265K\305\255r\3334\333\030l\263)S\212\254\250\374\252\027o|\261P*\032\222\n\371\224o\227\362\203\237\255\242(\242w/b\263\216O\246({\324\205>\224\214Qf\037\312\037r\"\274\027\261\375\212\270"
+	.string	"\254\200\311\364^\337\005\327\315\027\373\226S\310\315\206=9\375\307\201\304\254\310q\254\2763\351n\344#]\351>\354O)\006P\360\336\013[\352qsB\246R\277\324\343\346,\262\340\332\225\367\007\275&\034\360\310\316z\036~\322u\350\276\303J^\320k\342S*\240\256\267\234\273\037\345\304t\214|\320\340\361^\024\346f\203\244\314\254\037:\206\201\356G9\001\365\007\316\333j\353\023\317\317N\3352\rJ\361^\305|#?\361%Q\320J}\372\225*\244\024(\310r?\235~V\206\231\372\036\307DX\035\0338f\375%\245U\274Xw9\321\362!\231\330\033\352\374\325\027\004I\235H;\322P\317\217\260<\347\274\221\307z5\351'\031\221\305W\215\313\257\2356\207\023k\226)\200\325\244W\267|\342Ob\330\202\006r\311\255\311j\205l\317\227\327\276\260_\325\365\350\377WITB"
+	.string	"\320\275>[Qn\220\3514\343Q\277\375,)\377\310\257\216\025\363\0236\257\371P\313\2253834%\215\215f\275`\003M\r\203\006\0324\310\\r86\267\3224\031M\356\226A\327!\207\3330\273\325f\036j3\266\031\r\227\233\311\b\370fS\203\233\341\334n\270\031\354\345\265/<\001\310\204L{v\307\376\217\307\234\232~\002}\307t\211\307\360\027\376$\206@\032\310\264W\223\246\255\274\327\005\204G\255\244\302\272UZ\241b\025\325?u\nD\367\230\036\177\255\303XY\031o\316\027\255\344|\025\f\325c\275\251\177\350\t\260xa<@*$\023\243\224\342\207\240\244L\326\n\331>pV\2133B\022\242Bqo\250\201H\206\220BC2\"i\024$\251\016`\002\231\252\263:\022"
+	.ascii	"\226a\210\021M\031\005\332\377\217\003-Sy\025\244\275SFZ\230"
+	.ascii	"\"\316\024\273R^V\b-\250o\356j\315\006\275\221U\340\032S\231"
+	.ascii	"4\177\312\360\f\274\351\365t\357\267W\210\020\265\006}\036\244"
+	.ascii	"\271]a\r\2306j\214\255k^j\232\020\330-\263\337\3333$\213K\220"
+	.ascii	"\373>\265\326\273\260\204u\310\006\251\303\312\360\212>8\232"
+	.ascii	"A#\211\303\247X4\314\013\340\365\177\207\2168\305\246\333\315"
+	.ascii	"H\234\t\246\020\254t\306\357\316\320\316\225P\n\031hi?o\032\317"
+	.ascii	"\207\351=\200\354\330\204F\004\333\207\b\002\212\003\310\263"
+	.ascii	"\3231\231+\350p\211\350Z\\4\3546\247Q.\320'I[\367\201\320\261"
+	.ascii	"\340\022\306i:\212;\230\2734/\310\372\333\025b\344c\216\360\243"
+	.ascii	"\353\315<\365 j\n"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\030\f%%"
+	.string	"\226z\322BP\246N\007\020@(\005\022\036d{R\363\3313"
+	.string	"\330\346fI,Qc\024\310\257\253\237\227\302\035\272\335z\356\377\177\177U\325T"
+	.string	""
+	.string	""
+	.string	"\b\260\037p\216\365\257\257\353\201.\263\216\247\221\261\322Z\332)\005\306"
+	.string	"\270"
+	.string	"\303"
+	.string	"\254\366\317s\224<\247%yFC\362\214<\362,\307\3103[\344\371\214\310\363:\344\331L\310sY\220\347"
+	.ascii	"\3447\374x\r>>C\217\307\300\343/\354\370\b:\276\2159\036B\252"
+	.ascii	"\0344\206\343\017\334\370\0026^\252\3067\027\215'`\336\315\370"
+	.ascii	"(\031o!\306_i\275UU\313\207\f\306We\375\204\027/\301\305S\265"
+	.ascii	"\370\251&\303C\366\306\342\037\254x\007*\276A\212g`\252F7(~\301"
+	.ascii	"\211\357+\276\267\267\267g\342\023\224\370\n$\236\202"
+	.string	"9\342\207QDU\375\022\361\234\207\027\342\235\314\2531=D \376\311\374\360\bLg\356b\031\326\322\217\231/QU\215m\230\237\271\315\330>\"\221H\364\360\251\311\314FI\001?Wj}?G\305\372i\212[\034\243\371\374.y\216\317[L\315\347]f\311r\334\233\f{d\331Pu\206\324\370Xf\261\r\340\315L\222\221\356Jl\263Y\327\2325Fs\357b;Z\236&U8\315\275\331\3561=<7fM\017{&\004\346\271\356\313\363 /\317~\272<\377\341\362\274\334\362\034H\313\263\240,\317tX\236\343\300\236\347\256<\313}=\267M4\022\231\241\332\3123\240\256\362\334\307\353\231\217\361y\017\225g=S\236\341\244<\347\351z~\343z\306\023\345\371\016\224g;O\236\3538y\246\263\365\354\326\344YY|nc\362\314\246>'\227<\2575\361\003\001\354\324\360l\250\227\311a\254KL&\241\260\242"
+	.string	"\261\226R\336)O\261vB\003v\306H&\277+\235%%G\3276\223\200\354\314\234\003\274\203\333"
+	.ascii	"7r,J\362!\313\206J\204\005\f+\223|\306\261}`yvg\2227\313nI?$"
+	.ascii	"G:vs\255\351\205\375\216<\250\266\227Y2Fw\217<x\266\335gV4\270"
+	.ascii	"k\344\215\0329\332\002\203\216\036\233\003\325}mq\320\317b\233"
+	.ascii	"^m\027\034\263\005]\253-\350\267mQ?:\266U\334]\232\037\320Q\365"
+	.ascii	"\002\275C;\263@?Ro\221\237\354-\256\025\271V\262\310\225\216"
+	.ascii	"\367\004\216\201\363\345w\035\253\325\265\237\243m\267\234\230"
+	.ascii	"Bk|?GZ\275|\001|\266\372U\315\270\314/\007?\333\r~U\r\0310\\"
+	.ascii	"\260p\345"
+	.string	"\250UU\005\017R\230\340\247\004GU*?Y\252\242)\277\312)G\217\021\374l!\370U\0378p\364\330@\212\201\337v\201\002?\217\t\374Dp\300@\001\277\355%\340\r\025\345wM\241\364\302\354\245\245O.\200\355\341\027\0346HK\244b\367\2333y\214L\205m^\0165\245>WhU\363\324O\226\331\324O\265\201sd\222\277\324{\275\251g\rS?\227\335[rI?\214\034\016\207\246\034\313V'tr,\027\372=6\323\271\305\tk\022\232B?W\240\320\217XF6ypejr!\313v:\364&\f'\231\\\207X\007\200\304\250\201 DM\243\221\024$\205\302\260\006\320\002\231\242q:\021p\024\345\234q\204(\022\210H\224'\035\224jwA3\360\237,\372\016N\007^\334V7N\353U0\035v\322\233\310\321\255\374\330\324\n-\317j\013s\245\027\253>\333!\270\247\365&-g%M\253"
+	.string	"\t\\1\352nD\2204\024\336@!\f\r\242\264\376c\346]\357\365\245\263K\032\202\244\312\036\376\374\255\325\247T\264\237\361/o\301\245&\360JKX\322q!+F\374\2138\347H\325R\263\205={\324\\\212Sc\2173\204J\020\315\ba\373\020\205\3525\342\241$\327\024k,\230\007W\032\220\227$\260\3540\013m \332"
+	.ascii	"5\0228\337\254\2029Q\\\375\222\254\322hh\265Z\032m\215&\r\250"
+	.ascii	"\252\234I\240\371-C\315\322r\261)\270+\327\302\275p\026\334\225"
+	.ascii	"k\341^\340\372K\3318\310\304q,IK\234\t\257\302\350_=\230\330"
+	.ascii	"Y\021S26+\241\201\323\354\247#5\373\302\030{\250\232\243\360"
+	.ascii	"\r\354\211M:\320:W\035\314\212lB\241\261\344V1eE\037R\363p\n"
+	.ascii	"s\266PC\335I}\266f;\212\232\360\204\331V\370d\034g\234\253\301"
+	.ascii	"/\200\347\342\bK\361\321\357\363\241\347\323\022\rZ\253"
+	.text
+	.section	.gnu.lto_.refs.3455d1153e8ca6ee,"e",@progbits
+	.string	"(\265/\375`\025\001\265\t"
+	.string	"\366\2211/pmZ\0030\312\327\222\210e\217\342L\256\252\252\212\215,"
+	.string	""
+	.string	""
+	.string	""
+	.string	"$\242\240\025\2755\276>\352\245\206\277;\262\233u#I\366\336[n\231R\037"
+	.string	"'"
+	.string	"$"
+	.ascii	"\004o\346\247\235HZ\253\333\326\314^\317\313y\013\336\315\253"
+	.ascii	"y\005\336\367^o\365\272\027\243\r\013)('&%$#! \037\036\253\035"
+	.ascii	"\034\033\032\031\257\030o\304\013\361:\254\245\265\341\025\255"
+	.ascii	"\b/\350\375\274\235\327\340\r-@/\017\340lfJ\255er\364&\274\241"
+	.ascii	"\325k+k\264f\253e)\347s\315-\326+(\336'VT\002\3526$v@\275\005"
+	.ascii	"\265\275lf}\364\254\202\242&\246s\251\310\205>l\351ex\027^\322"
+	.ascii	"s\236\022\273\031\320`\0332 \200\242SBw\237\005\276\313\206\f"
+	.ascii	"\303\306\267N\266\302\371\001jX\277\027a.\373\345zHqS&\233\250"
+	.ascii	";h\017\375\247\030G\316\201A\303\212x7m\372\351B\275\327\256"
+	.ascii	"\325\315\206\270\244d\013\027#\002R\266\211\270\325\247\351D"
+	.ascii	"\025g0 D\022\007\203\225\206\204\343\300`-\244qb\260\206`\243"
+	.ascii	"\2123\230!\030\r\230\372\ng\t<"
+	.text
+	.section	.gnu.lto_.decls.3455d1153e8ca6ee,"e",@progbits
+	.ascii	"(\265/\375`\031p\235\254\001Z\276\"\230U LA+\351R;?\244\221\341"
+	.ascii	"\364L6;$\242Y4iT\320\244\311\205\264c\202n\240\n8\332\t\323\222"
+	.ascii	"x\272E\347 \236\246\346)\376\230T?h\233\215^\222\376rb\027\247"
+	.ascii	"\325F\257\217\341W\320b\037Wh\274\272\016bb*]1\264\t!{\313\235"
+	.ascii	"\002$\bO\t\336\t}\344w\377m*\222\247'b\372\236\320\006gJ\020"
+	.ascii	"-,}og\340\323u\021\016\220\352\340\226\364\375\233\211o\034\251"
+	.ascii	"\005\366\365\342\327F:H\315l\243\366\371=\331\025\3263\257\352"
+	.ascii	"\244\302\351,\233\031\n\345\n|\262+|\322^U\256\326\241P\212\262"
+	.ascii	"\231\321\007(\230s\263\332\265W\235R\373\252\036\325\206\214"
+	.ascii	"\324\367\307\3149\267W\357\350\254%\314\234s#\265W\313h+\035"
+	.ascii	"\243f^\326\276\270'\273\302\256\376j\"=\244\301:H\013\251k\355"
+	.ascii	"\325[o \315u\237f=\363\252Mj\233\016R3K\245m\205Ov\20597E\370"
+	.ascii	"\210\030\001\217%x\033n\207f\355A\273\020\r\356\254\246\321>"
+	.ascii	"\224\230\370\033\251\263zFYk\365\217\272\326Y\177_\265\016\244"
+	.ascii	"\033,{C\320\240\367o\254\267\217\277\221\232\207\206\277\272"
+	.ascii	"#k\372v\217\2377\326MRZ\220\253\276\365\254\362\2409\2018g\251"
+	.ascii	"\366\240\265I\343\350\252\236\352\033M\3259\352ZR+\275\233?m"
+	.ascii	"\3254\032Jg\271!g\2567f\2153\246\r&\314(7f\316\315\367\322\337"
+	.ascii	"LV=\003.K[\265\324\2146'\20297}D\354`\361\265\201\321\271o?\374"
+	.ascii	"\346\202\337W\360[\016\377\375\364\206\372\233\251\233j\031\020"
+	.ascii	"\344\214\224s\356\220#\305g\367\324\267\235~\336O<h\024U3;\311"
+	.ascii	"9\357\340\370 \002\025\245\357\017+\017\372v\3038\257\341\232"
+	.ascii	"+\017\032\242\366\240o%\0303k\017Z\225*\017Z\233\225\007}\375"
+	.ascii	"\002\246\002rya\346\234\377\367Q/\353a\347\272\246\256\265\321"
+	.ascii	"m\243:X\317\330&\023+\365]\021\3149\377D\232\271\312\344\377"
+	.ascii	"y\033U\303\332f\233D\341\2676*\20297\333\250\252y\343\222\023"
+	.ascii	"!B\004>Sf\005-\347\276\217\340\367\027~g\341\237\020S\313\350"
+	.ascii	",7\344\243><&\232ZX\327\352\231f\316\271\304\211z\246\232\251"
+	.ascii	"el\223\231\302qY\021\314\271)\302G\204\206$qj\266\240\367\275"
+	.ascii	"\003\3271\225L]\373P\t_\342\304\355\022mG\303\032\2625\206}\337"
+	.ascii	"8\360\353\007\264\036\326\017\350\333\t\277\227\360k\2260\225"
+	.ascii	"O\307hCF\222\221\205\tX\377pS\033\226\277\n\326\300\272V\001"
+	.ascii	"\337\315\234\325r\316\"D\370\240X\\nN\350}\033\341WC\374*\006"
+	.ascii	"\237\256\366\240\257\177\270\233\257]"
+	.string	"*\227\272V\373\376zW\245\334\247\231s\\\316\371u\311\377\323W\251\324<\024JQ6O\\a\004sn\336\304\377\363\332W\365*\237m\322e\244$\255\021\366\356\236v\024\346\334\364\021!\302\003&\033X\350\255Z\352\226\272\306A\335{\305R\263\3744j\346f\316\315\235\026\242\306-\315\f\277r\200\332\303\303\312\001\372:\2067\324\036\264\363\256\254\211-\201\351\213\007\026FI`\337W/+\265\212\017\232\203\rN\251\357\253\025~\235\302\257I\270\346\332\203n\250<h\323U\236\272\032\305Ry\302\023\322\027\312\265\202\263\253\322\3671\360\377\272V\351\352\\3\373\344\360\330\262\352\353{\027\360Y\340\326\253<h\205\353\372V\343^\341\252\333K\234x\016R^\222s\263\302\335\234\215j\005\241S+\210\363\216\210Q\032z\017\002\374\025\270\242\325\264\272\026\242\262\2756+\223\333 5\263Z\316\315\035\241\2556\273\276\217"
+	.string	"\3169\361\277\203Q>\361\t\360k\bt\347\360\360\360\260\206@\337\370V\036\264\005+\017\232A\355A\313\352\222\017v\211\006Vv\222s\223\303Ns\312\351G\3377k\017\212+\017z\016\354\nx'\331%v\n\202\377\002\375\215\243\201\003\302<\334\0227\035\352\262j\320J\356\007jf2\303V\004\264P\370\315\237\246\330A\002\0076pu\200\f`\300N\245\0368\245\0304u`\342\221\261\223\204s\224\246\313\324\316pX\002C\017\374M\201\277+\260\302\337\033n\007F\360\177\202\0375\223\344B\244e\003'\240p5pD\3630\320\013`\3007p/\220\204\305\223\025\177\217\320\"\374}B\305\367\356\363\243g\025\370\233\304\337\036\214\350\023\337\303"
+	.string	"\230]\301\307\004v\254\360\267\207\277\003\360\367\006\177\203\b\361\367\206K\001\tT9\240\311\246\220\241\200\031H\200\001\306\006\021\320\242\253\302\337<\177\275\361\327\251\277)\370{\303\323\225\300\212\363\374\250\321\216\360\200\b\013\204\250\200\207\023\332\rP\025r\016\017\377\232\346a\257\310\337\fk\2212\347\337\337u\377\205\300M\301\246\371\255\232\377>\340\257f\177=\373k\363o\270\213\302\3773b\267\376\267\377{\3029\200\344\377\006\327\0015\355\034\274"
+	.string	"\377\351g\351n\212\252t\0166Pu\354N\257\244\333"
+	.string	"\244\2578\207\377\254\372\037\370\207\007f\312\3773~u'\354\233\373m\0067\001\027\001\177{\201\320\360\243)~\313S\213\334\022\316W5h-\240\340GM\234\3609\377Y\202\2527&\357\360\237nV.\t\3779\350\026\256\363\237I,N\0071\334\346G{z\013\372\237kR\032\354\216\360\333/W\204\277\n\261\203\177']\024\177\265\372k\006*S\357\202\377l\36257"
+	.string	"RN\"\177\345\240\252\326o\300A\330\316\177\266\370\357\001\376\316\n\341o.\313uO\374}vs\232\311\331,\005\"~\264"
+	.string	" \374\315\243\215\\\023b_Q\342\277:\377\360\243\030|\360w\016{/\211\277\236P\352\240\377\033\260)\210\037\335\371\357\210\337j\371o\210\277\002\376\365\357\257\202\177\243\377\315\340?\337\337\351\345\340\\\376j\200\377]\376V\273\033\034^\002\324.\177\365\240^\371^\265\3627\213\212\227\345\377\341_\363\376\253\251[\370\376;\200\277z\021\300\3375\256\006\377\005\361\327\301\276\251~7"
+	.ascii	"]\374\033\212\363u?\\\017\325\307*\371/\006\177\317`\313\376"
+	.ascii	"{\201M\273\026\374\265\203\333\341\377\006\377=\334\236\253\363"
+	.ascii	"\016\376\363\305_=\370\377\366\300\377\200\177\355\377\177\377"
+	.ascii	"\317\3747\363\327\377/\374\353\210\277\326J\301_{\376\312S;\374"
+	.ascii	"\265\202Z\200\277Zp7\374W\347\2571<\203\377$V\001\3745\203\277"
+	.ascii	"\221\334\234\277j\360W\021\177\005qm\376f\322@_\261\326\364\333"
+	.ascii	"\263\213\177\353\344\267n\377M-\221\213\376\265\203\277\253\356"
+	.ascii	"y\016\276\242\226\340\357\262\377=\377\t\303\177\357\177\373"
+	.ascii	"\267j~+\346\267`~\253\345\267P~\013\367[\267\337\252\375\266"
+	.ascii	"\371\333\262\337~\375\266\353\267[\277\325\372\255\217\337\356"
+	.ascii	"\370\355\325o\247~\353\364\333\246\3372\375V\306o\223~{\364\333"
+	.ascii	"\345og\370m\t~;\202\337&\177K\364\333\343oY\374\026\350\267\030"
+	.ascii	"\370\355\n\277\235\300o%\360[\007\3746\305o\025\360[\022~+\302"
+	.ascii	"oA\370\355\210\337\212\370m\210\337n\360[\020\277\325\340\267"
+	.ascii	"\026\374\226\202\337j\370\355\315oq~\233\376\366\374\373\360"
+	.ascii	"o5\177\227\371\233\314\337\177\177\203\371\333\357\357\276\277"
+	.ascii	"\231\374\315\3677\336\337[\376\326\373\373\312\337R\376\266\373"
+	.ascii	";\356\357\265\277\317\376.\373[\354\357\260\277\231\177\333\374"
+	.ascii	"\325\313\337A\376\n\366w\325\377\t\374\355\365\327\301\277\271"
+	.ascii	"\376"
+	.string	"\316\372\317\3667\217\277\352\374m\365w\216\277k\374\355\364\367\214\277f\340\257\035\370k\n\1775\341\357\244\277\215\376\236\341o\031\376\206\361\267\362o\344_c\370{\350\377\212\377o\177\033\377\037\377f\361\327\023\177\027\377n\341\377\336\177\016\376{\370k\332\337@\377\t\377\346\300\337\031\370\257\302\337*\376N\341\357\006\374]\302\337?\177\213\370\273"
+	.string	"\177W\360w\316\3378\177\337\374U\314_\375\376\252\366\327&\177M\362\327\"\177e\376\365\352\2579\376\252\364\327\244\277\206\360\327\345_K\360W\022\374\037\372\353\b\376*\303_?\370+\211\377K\376\373\370\217\367\337\204\303\303\303\303\337\347\203\177G\354OA"
+	.string	"\001\350\207\312\203\236?~~n\235bSUD\372z8}\374\324\372[\356\314J\323\327E\253o\347\332\203\236X??}h\240\302%\3307"
+	.string	":~\366\370\317\035'\017'I\226\310\364\265T\265\0075Qy\320;\346\347\247\216>:$\343\3217"
+	.ascii	"kN\274m\274\256\265\215\323\352\001\315\274\324\221a\370dW\230"
+	.ascii	"\243\242\fpVY+19\300\360\177\342\370I\365\237Sg\016\303%\302"
+	.ascii	"\302\276W\260\366\240\227\253<\350y\343\347'\016\246&'<\372\376"
+	.ascii	"I\324O\033\377)u\326\260bE\264\300\374\365\265z\265\007-\241"
+	.ascii	"\362\240'\324\317\317(\2335uz^\372\222p\322\370\371\364\3374"
+	.ascii	"\247\023\3462\314:\372^\252\332\203\3322??i\204\361r[\366\375"
+	.ascii	"\317\245\223\351\234a\305@ps\006\211]\222\276\355\244\366\240"
+	.ascii	"\005\250<\350)\343\347\347\222\330\034_\222\276!*\017z&\351\224"
+	.ascii	"i\"\234bu\"\235F8K$@1}\257\201\306\271T\3633\377w\315=\304\331"
+	.ascii	"\352\301D\257\357\305\252=\350\325\322\374\374\252\331\241#T"
+	.ascii	"c\353\373\264\302_\303\377\236\271h\254X\326\262\024\327\327"
+	.ascii	"6k\017\212\242\362\240\327\314\317o\241\332\327\022Y\337\003"
+	.ascii	"T\2362R8q\203\3144b~\t\377;\346\222\261b @\2435#M_\033U{\320"
+	.ascii	"\022\225\007\275\203?\277bR\276(P\246\364\375\251<(\340\r\274"
+	.ascii	"vxe\206\364\275\206% \230\033\306+\215\222\246>0^\256_uB#\207"
+	.ascii	"\215)^\2328t<\334n\364\275\\\220\n\353\224\336\370\356\026\022"
+	.ascii	"\374\234\300\365}\016\021|\265\334\032M\345\315\365\275y\027"
+	.ascii	"K];\336\315\362\346\216N\024\031nx}\237\003\004\277\036\017\235"
+	.ascii	"\241\036\017\375\357\025\274j\027he\215\225_<'kh\356t\364-\361"
+	.ascii	"\363k\005\035\263\363q\246\n\025\"K$\300\273_*\377\225r\247|"
+	.ascii	"\256\261\316:/KV}k\263\366\240>\225\007\265H?\277w^\244\240\340"
+	.ascii	"\260\253;\371\3224\347\350n\224\013\245\256\335\272+w\347,\032"
+	.ascii	"\333#\016\220\371\344J\3751\353.\\\240\b\024\311\023.Trl\340"
+	.ascii	"\347D\341\3478\341\347\314xc\253q\327G\245\357+\223\033&D0\347"
+	.ascii	"&\233\027\233%\013\"\350v\333\256\223\272v\331\256\332]\263H"
+	.ascii	"\275$\302\247\336\270\302S\302|\370\277i\315\03452\035<\3726"
+	.ascii	"\257\230n\323\222\351`\346\334lr\321\352\332m^&\367\2546+\223"
+	.ascii	"\266\323\241\243\n\275hfKp\f\227~\340(\273J\352\332]r\223\334"
+	.ascii	"\261Kf\237\314\335%7\214\013\352\002\261sw\311=r\305l\223\311"
+	.ascii	"\202\214'AlCJ\232\030z\323\312\203\342ha$WFZ\024\\\337\343,\341"
+	.ascii	"\343$\341\337\030\032)\242\2237\265f\t\363~]\260\272v\213\334"
+	.ascii	"!\227\310\005b\347n\021K\306U\204kI\360\026\251T\332\230t\300"
+	.ascii	"r\234q\301WOH\0174\310\333\217\271 \267k\313\021\033Q\372\336"
+	.ascii	"\204\226\027\301\313u\275\352\332\355\272?\356\326\005b\347\230"
+	.ascii	"\272.\325\315\262Mf\004\222\374\004m \232\036\034z\321\312\203"
+	.ascii	"B\301\277y\303>\356\025\246[*\335\365\375M\031\276\211*<\301"
+	.ascii	"\234\363\216\213U\327n\217ku\257\372\3202\365\270m\322)r\267"
+	.ascii	"\362\004/\217\333\343\352\270\"\230\272\2151\303\302\3677d8\b"
+	.ascii	"\376M\027\376\215V\216)\234-\203\207~}\343\342\250kw\352\326"
+	.ascii	"\2706j\2632\271S\027\352J\331&3\002[\206\202Lw\352>\245\021<"
+	.ascii	"\317\206(\001A\357M\024\276Q>:ZYw3\372\376&\343\333\254\301\267"
+	.ascii	")\304\377u\272J\\Z\236l\321\020[jr\250H`qh\267\351\316\330\242"
+	.ascii	"$\212Z\337\313\204\t\367jH\365\275\r\037\276\211\253T\365\272"
+	.ascii	"\256R\323\270IU\217\352\3442D\360\312\270Ku\355*Y2\226\320\226"
+	.ascii	"\261f\2260\240\331\022\013z\377\337\243\213T\327n\322o\222=\274"
+	.ascii	"FA\230s\177\267\335${\306\246\321Y6\363\362fK\310\223]\241\b"
+	.ascii	"\0347.A'\350\375\357\362\327\350\267j\354\032\213\265T\310\327"
+	.ascii	"\367\346\237\337\345\215\222)\203k\372\236\310\303\226Y{\320"
+	.ascii	"\020\254aa\375\262\023f\353-K_\213\346\347\326\020\351\306\333"
+	.ascii	"W_\233\312\203\336\306\016\337T\036\364F\325\036\364h6K\306X"
+	.ascii	"1M\310C\260O\314 \016\303,S\360v\276\300$\221\365\375o\003\353"
+	.ascii	"\232\025\254U\254`\323\260\200U\217*\223\200\"\344\306X\316\331"
+	.ascii	"GDJ\246D\357\351\336\337\376\335\002\376mf\301\330\fF\321\025"
+	.ascii	"\351k\303\374\334\376\325\266\033TZ\372*\240\362\2407\177\261"
+	.ascii	"~k\256\222\272\372zqR\271\246\004\013\373\336\246\t\277\227\240"
+	.ascii	"\320x\253b\346\334\314b\355\354\335\026\0233\347\374\343f\305"
+	.ascii	"d\252\233a\331\332\256\254\350`\316\3219i\261[,\237\355b\363"
+	.ascii	",\236\275b\365l\237\305b\367,\227\272f\263X)v\212\245b\2530\211"
+	.ascii	"\322\364\005\216\352I\026+\267\365$\230s\323f\261q\225\317\252"
+	.ascii	"1\261\2145(\301\234\270.ia\027\334c4\270.\325\036\224C\345A\361"
+	.ascii	"\336]-\223\004\253b\353{\234\207\217\351\360q\032>\026\303\307"
+	.ascii	"D\360\007>0\212\332\203\036O\341\343\031\370\351!~\372\207\357"
+	.ascii	"%\325\303\027\\Sc\2421\243G_\233\206\363\232\266\224\364}:\207"
+	.ascii	"\177\213v6\345\310KZ\337\233(;;\241\204\213\023\246eb\233\266"
+	.ascii	"I]\263gv\2115;\263d\226\213\333\223\335\230\217\b[\266\214\222"
+	.ascii	"\2262\361S\"\370i\020\374t\013\377v,I\331\r C\362\216\r\024C"
+	.ascii	"$8\372\332#\026\311\255\230\r\313V\f\004\261\235\253D\013\354"
+	.ascii	"\r\275O\261\360o\215T>4G\222!\\\021\246\f\301'S\372\2025\221"
+	.ascii	"r\316>6E\216@\331\353\373\324\t\377\267B,\021\353e\273\354\020"
+	.ascii	"\033\244\256\331/\273u\013\244\331~\2339#\325/<\n\033\213\325"
+	.ascii	"\262M\242\360\334\321\237\340\016\2563\366\313\376\b#h{`\355"
+	.ascii	"\0052\355\227\365Q\313T=\252\274\034\004\301L\317\214\225\302"
+	.ascii	"z\205\f\033\024\235{4\017\347T\036\364\350\033>j\206mVUk\363"
+	.ascii	"2\354{\024\b>z\003\0375\302wR{\320\237~\370Tt\334^\335I\375\r"
+	.ascii	"\366\265U\326\252\256\331\253g\r8[tN\214\372\306\3109\347\372"
+	.ascii	";4\375\035\372[*;E8\003\314\255\357MDY(\235\026\232HIr\026\207"
+	.ascii	"\315Q\327\354\224\225\2626\372\3202\2756\363\222]\2627~g\227"
+	.ascii	"\354\224\245a\241<l\251yIikN\320N\3356\025-\345%\001\250d\021"
+	.ascii	">\"D\240k{O\344\360\375m\215\337\346&\317L\025\263\357\317-\370"
+	.ascii	"g\024\374\223\016['\373t\013u.\365,\324U\303\312\331\310B\331"
+	.ascii	"\303"
+	.ascii	"49\033\355\324\n\242V\020\350\026\033M\276\320\373S\016\377v"
+	.ascii	"F\037Z\246\017\034\030\244\022\353[\261\374\334\316\260tR\224"
+	.ascii	"\322\364\365\251=hN\355A\177+\243\241\3225\035YM%\233\364eK."
+	.ascii	"\351\b\251\227j"
+	.string	"\215)Y`}\317\237\333\243\373\243\f\224\021kd\227Uo\254\007\263\357o\363\355R\r\320\256I\244o\037\376\334\346\022\204\374P\322\327\256)\323{y4\216\324\204\320p\246\313\321X\232\n\227\226I\321rb\210\346\324\201\225\243\2409s\306\rIT_(V\350\372\230}\337luVfg\275\206B)\312\006*-\210 \2238\036L\270\036lN\372M\007iCF\322\352\252wwPrQ\032J\323\336U\275\263\253\252wR\272\312\236\223_ci\323j\312\322{(\224\242ll\0341\2311\371\037\n\245(\033\245=!]\306\214\204\365\222\032{D\272\355I\277\331&Q\270-m\207`\230\006\323\177m\246\3114a\227\351/\335\327b\272\260\007{L\013\266\227\016l\300\272\326~u\356\315\327\\\356\303\346\327V:\357\210\206`\313\371\365\\C\361p\264\224\215\262J\bk\202\211R\230sS\304M*\022\204o"
+	.ascii	"\367'\020\214\346\332\203^oo\213\223&a\2764\215\364\315\201\265"
+	.ascii	"\226\326c\262\327e\245\357O\034\370\347\023\376y\204o\230\233"
+	.ascii	"\326\340\225\306\323\321\245\214\251\357o!\376\035\203o\310\314"
+	.ascii	"\270"
+	.string	"\034\366m*=\345\242ai\320i\032\363cK\337_.\3707\017\377\332\341\3376\374\253\004\377\026\301\177C9\335\311\004C\373\353\253\267\223\263\246l\317G\337\337.\234A\345A\177\257\360\357\023\376]\266\233M\2271;\234\364\275-\304\267`\360\007\225\007\275^\355Ik5\264\233TW\327\025%\r\r\335b\226\331\232\274\321v\210\310i\371\321\267\233\225\017\347P\356\312]\033\276\035\303oV\036\264\313t\312\266\322\312\372\336Z\341\327\265VB\226\242\341\301\325\034{\223\375%N\0340'\347%9g\017v\371\345\b[\337F\322I\376\333\23002\302\226\244\305f\230\221\231\353\333\314\201\202\022\202\3257-\304.G\030\006J\030\204\0324\264TM\017L\2241[\006\352H\216\264\247j7\252\240\0011\304 \230ffi\023\345JKr\003\273\r.1;{\332\254e\256\\A\371\3227e\022\002\237\223\224\276'\374"
+	.string	"F\216/\213\024\fB\013\223\231\226U\264\fU\341\306\204\241)l&`\022\264\260\247eO\225\2248q@\"mur}\237\216\245d\277\315M\224%XV\337_ \206S\2614I\026\334\336\215\276\277"
+	.string	"\f\247HFT\031B\345J\337\247G\376\333L H\026\270\276\327\310\025\334\371Z\246\365\365M\213\204xbG\204F\337\333\261%`}X\2740\b\270 A\322\257\212\226\241\024\020\005&\312X\316T!l\234|4\261J\211<\375\352\267\255\275!Z}O\230\016i.3\340\220T\210\215\2300`\220t\216\256\230\\}\177\301\r\254\201\215\023\377S.\256\264\253\242e(\264\255\016LLa\316T!.\027\032\263/}\323\256\332v\246\nK\215\030\254\001\340\326\326)\246"
+	.string	"\262'\273\261\313\004KPF\026\254\001\241\226\326)6\204\t\225D%\303a\r\322\364\350\221\372\350\301\334r\242\006\353\251\217^\242\306\347D\206\005P#\335\221\356H\257\316\236l\314\212|}\365\275\005]X"
+	.string	"t)UJ\225^\231\251i\034zrq\251\325\323\253\303\2657!}\323*\033X"
+	.string	"kR\250\024*\235B"
+	.string	"\230'\2731\233\326\006\005\226\342x:\265#\314\020\245\276\351\215\317=\275}\241\351\233\332\370\\\237\023\2535}\323\032\237\033\363\313R\3237\225\372\\\223-([\372\246Q\237\333\221k\342E\310\234\034\331[\337[\200\204\007"
+	.string	"\350\344t\212a\261Y\323\304\211K\337\373\214\301\003 lj\242r\003\265P\205\365\275O\035&@X\312\2242\241qo\030x*S\325\367>d\230"
+	.string	"\203\251\214T\006\032g\266\004\r\n\334\016\274\001X\322\323$4\256\346l\366u\277\352\332\244\372\336G\to\360\227\036\245Gf];bU\205q}\337\201\020s $]\246K3\253\354g\225\373\276\303\026\314\201\337\341!jhF#\247\nJ\2076\034\242\211\0325\250a\331\232.d`g}\337\301\b.@\025\0312\250aY!\206\002\333r\005\315QC*W5\372\242g~\267c\355GZ_\264\360wXlsU}Q3e\b;\\\341\002\f\212\021\203\222\225}\231\323\021\246\252\357;,\261\210+AA\224\354\n\223\213G\226\220?,b\315\213\027\024\320\r/\375\361i\375\035\005\304\301{\332J\353\213\206I\265\250\2101\365E\301\350L\021\324\021\244/\372\305\216\241\314!L\275\276\250\237\024l"
+	.string	"\033Z\264\240]\300j\350\3451\365E\273\350\3340\032R\327\027\345\303s8rh\365E\367~w&\001\013$\353\213n\261c;J\266p\361H\303\006\270\253R\005\315\342\3054be\005\006\313\321,Q\226g\354\372\242yW\314\322\276\372\242Wrp\274\005\231\353\213\342U\276\212\367\243\fW_\324\312\375\202C\204\256\007\224\027\356\340G\224(\350\024\022\256\236\354\306n\322\326\364\300\244\034\235\""
+	.string	"*z[\372\242w\271\353*K_\324nn\252KM_\264\256\362\351\354p\033\303Q\201\r\334A\037\035\n\205\356\024\2539\352\tc\205y\tr\006w"
+	.ascii	"('W\266\304d\363\"u\325\367=}\330\203!mmh\034\2324\013*L\016"
+	.ascii	"\270\243q\2064\270z\364E\337~g\305e\003\256/\352\366;C\2673\276"
+	.ascii	"\276\250\223\036;\354"
+	.string	"\301\027t\r]C\201T\2620PL\247\2631<\342\251I\0234\r\313\231\204\244)\006\355h\332\361\313\231\341_U\227\236\035x\204\02133\364\214\212Ns\212)\212\311\3213+F~|3\330\312\034\365}\217\022\036aWV\206\222\275\341\370m-\325}\301#\326\210\211\241dK\356rKU\333\330Q\2627\257*\206}\321$)\036\026\255\036}Oxq@)\313\353{\n\3420\211.&\023=\"\302\327\223\335\330\275\373{\222\025v\364HN\2303d\226\372\242Fb,az\365E\213\374\316\013\030\027\2642L\"\313\220!\350W\027S\214\225!\032\221\243_^ap\200\251p3j\324\361\360\201?X\006\tb\305\314TT!@x\253\361\325\367\024\034\341\017\264\320.\264\013\005R\311h0\241,\275y\365=\017 \376`\355\307\321\037(\020\234\223\254\211\243\2414\206n\035\005b\375\314\346l|\371o\223"
+	.string	"\2453<\372\236g\312\025\232u\205\372"
+	.ascii	"a\f\252\003\315Bu\240>\360\211\0313|M\r\301:\352\343\026\231"
+	.ascii	"B\306\251/\332#\304\034\0210_}O\210\36203\246t\204\007\272\003"
+	.ascii	"\247\217\314\334\232\006\034e^S}\317\263\004\237\307\n\237\330"
+	.ascii	":1\365)\264\ng\n\302\256\340\273.<\035}\177\224\352h\025S\326"
+	.ascii	"\323\225\276h\216\020\032\276\330\340\312yOmH|}\317\2231\n-("
+	.ascii	"(\364\006\324\231\215\2437\214\376\236\374\350\213\326\250en"
+	.ascii	"\310\f\275\240\364E\245\036(\367DI\\_4\352\352\265\032aY`\233"
+	.ascii	"\225&R|}?\201\027,\002\226\223\323)\006\266c\202'(\023\332\204"
+	.ascii	"2\235b\2013\320&t\306)\206\227E\250\330\340\t\252\321\352\373"
+	.ascii	"\t\230\340O\320\205E"
+	.string	"\340Be\2402\316\260\277\302\t\240\260\b~\350\022]\242IMaP\244\243ILtga}\321\243\333E\003\223\341\030\"}Q\2433\370\203\276\303\303S\314'I\241\021\265\260\276\347\300\005\177"
+	.string	"XXx\252I\222e\347)\311\023\2664?\325\234Mj(9\353{\032\326\265)a\366\372\236hn\230\254\002\225\372\236g\254\221\233\2435i\246\326\270\226\020\036\366=\0079\374s\244L\2313\356"
+	.ascii	"nOvcx4\264\252\372\236C\022\\\002)0\360$C\005\211\032\301LE\025"
+	.ascii	"\242\216e#Yc~\2229y\3449U\351{\212\261k9\320\314\372\236\203"
+	.ascii	"8\317\312\216\032}OA;V{\350\021\031\343\201AH\373\373sK\207\204"
+	.ascii	"\315\311\365=\007\031\030\20490`\2260u\324v\004\016b\020\360"
+	.ascii	"\374\374\316>\0330\246\222\222\274<\fB_\227.g\237\315r0\004\222"
+	.ascii	" 6\257\031v\330\267\357/q\"\204\331\2211\200n8\0045\276\363\235"
+	.ascii	"b8\207AipK\362+\353\373\r`8\2042[\316\275-g\330\003~\340\236"
+	.ascii	"\354\3062\025U\210\323\214\013-M\337o\350\201\017`t\002\313\261"
+	.ascii	"\234z8SPdG\f\200hgY~\352i\240\253\002<\322\367\204\347\321\177"
+	.ascii	"\233\016\270\336\304\364\375\206\032T\316+TN\274\020\340\252"
+	.ascii	"\234W\252\234xE\nS\261\246\224\225\237xhU\220\257\260\275\377"
+	.ascii	"67sMk\200}\277s\006\177\247\n>\200\030)RN\261@\300\2355l\002"
+	.ascii	"JN\356\264+\001\311\027\346i\207\221\210\341q\325\367\214\262"
+	.ascii	"\243twfL\337\023\212N\026\224\035\314\276'\335\325\303xK2\246"
+	.ascii	"\276\347\\\0276\021\330\326v\306\235\220\203\373\031\327\004"
+	.ascii	"\254\251\325\367|\013\361\337&G\013\336\227W\337\323-\304\340"
+	.ascii	"\331V\217\276\247\223\3127u\367\207\324\367\204V\355\277\215"
+	.ascii	"\207B9\275\276\337\221\302$x5ir\256)y\262+T\373\271f\"\213\036"
+	.ascii	"\217\276g\032ZEK\360\260\357\211\366\300\3776\032\342\232t\351"
+	.ascii	"\350{\302\253\367\337\306b\321\332;\352{\0355\370f\347\231\331"
+	.ascii	")\206\346\\\233XPQ\231**\304\t>&\347\031\223S\f/}\302\306\236"
+	.ascii	"\354\n3\025U\210\233%>+s}\257\303\005_\207\r\2270cl\354,\243"
+	.ascii	"\312\326\257\353\311n\354T\362\263\254\236\031\236y\353{\222"
+	.ascii	"\365\032\034v2\300\224\371osj\225\t3G\004\217p\006\t\222S\314"
+	.ascii	"\013P\354\334r\344\353\255\357u\2440\n*#F\3160\234s^63T\n\345"
+	.ascii	"\367dWx\206U8\233\"aZ4\372^\203\031L\202\324\211s\310I\344\347"
+	.ascii	"\327\317\257\223\3319\347\314L\333\274\252\bf\252\250\020\377"
+	.ascii	"\t\366\223y\003\344j\271\244\357\tk\335\177\033\033\2752e\234"
+	.ascii	"\364\275\006>\374\277\276\1774\3278\233\231\356(\007\375\353"
+	.ascii	"\353\371\032\342\327Pm\325\340\377=\t\036h\346\243\274!9\347"
+	.ascii	"J\006\265\222\225\203L\006\371\377;\347%V\024\207\245\234snf"
+	.ascii	"IqXR\313\212ZB\312\312Q\227\324\262\244\226\324\262\226\275t"
+	.ascii	"\305H**g-q\306\222\312H9\343%\243\234\325\260\2448,!e\251%\265"
+	.ascii	"\034\205\323\314\312\271\231\265\304M\243\250\234\263Q]jfa-!"
+	.ascii	"eIqXB\312\222\312jYRuI-Ge\244\0345\301R\316RY-k\260.\345\254"
+	.ascii	"\250%5,)\016\031\311L\023\023\340\230\215:FE.\313\340\022R~\272"
+	.ascii	"`\f\t+Jo\251\211U\351r^:Q\312Q\265\231sV\316:\260@\320!}-\351"
+	.ascii	"\216\364\236R*\244e\225\323\221\026\226M\363(\353-\035\301r\241"
+	.ascii	"\224\263\227\354\004\302\262.\2339g\031\371hYsVjF\345|\204\005"
+	.ascii	"\002\252\234s\306\252|2\242\262\206\214dD\343H\013+G\351\bKF"
+	.ascii	">\342\243\346\234\263\324\222\232\026\326\017\02465f>j.\353\022"
+	.ascii	"\r\254\314\314^\262\242\260\332\262\231\227r\316u\214\0063r\\"
+	.ascii	"\n\3736\323&\201tvg\220\323\253w \355\300qN\201Q\343\333\372"
+	.ascii	"\331\365\237@N.+/O>\372"
+	.string	"V/\265'J \2452\251T2\240\005\342\220\221\370\002\003\212R\300\300\347\005\214\"\027\202\212.0H*W\210!\251<:@YD\301\230D\001D1\t\203\350\036\213CIe\021*t4\262\240@\305\261H\204\324\271\213\021E$\212B0\206\202\216F\022\311\"\030$*\030\032\202q<\"\217)\f\310\244\013%\362\230\262 \026\207n\fDA/\212/\320\273\030\341\241(\204\f::@y4&\211/\300\320P,&OX\301\001G\210xs\027#\202\222A%\212\200ZxA\b\bEP2\b\347.F\264@\016\2218\"_\274@\006\371(\211/\222H\026(\013\345\321\230$BY\264@\016\001\235-\216F\245\221\210\201\242\2422\206\006\304`\341.F\024_\030\225E\306\241!\343\013\224\b\351\242\b\306\n)\212J\242\022\311\002\207\342\0201HEQI\034z\241\244@YT\361B\231\342\2052\305\206"
+	.string	"\f\r\031O8\246P,\"2\016\r9@\031Td!\250\310\302\320\220\361\004eP\221\205\t.\030\0322\236P\301\321(\001\344\212\342\013H\025\\(\"\252\220,*\203\210-\216F\030\210I\0238(\203\212, W\020\031\207RL\240,\252\250"
+	.string	"\003\344\212\r\307\024,\020:2\340\303\320\220\361\004\n\212. \223J\025\312\242\212\013\212Jc\022\003B\304\"\013\026\004\035cP!t,\252\350\240\343\"HI$*2\232\340S\034\022:\022\037p,\026\223A*\222\304\342P\n\036!b\221\205\nZ\034\215I\245\n\030\210I\023PX\241\247h\b\231\002\005e\021\005\245\361\305\013d\212\030\204\210E\026\212RP\032\217)\344\370\034\215-\212\r\b@\013\310\241\006\004\035c(b\200\320\261\250B\310\230D\341\230B\222\350\342XT\361\301\be\222H4B\205\213\"\030C'"
+	.string	""
+	.string	"\205\005\212\212\212A\310\344\n>BD\026\300"
+	.ascii	"\311\342\230\202\320\020\f\244\013\025\312bQ\221\205\007\031"
+	.ascii	"\223\305c\261\005>\b!x\020\002\212\030\351Q\214\360\301\b\037"
+	.ascii	"\240G1\302\317\317\b!\374\340\207\360c\225'PP\004zQT\026\305"
+	.ascii	"\240\002Y\0242\276\240\241\b\024d$B\256h\201\034\272)\002\025"
+	.ascii	"\211bXQ<\032\207\2240(P<\032%`A\021\250\b$T\204\314)\022\213"
+	.ascii	"\216\304\344\n\017J \264\b\2508\324\342H4"
+	.string	"&W\374\020u\t\2426A\324\004\020:\022_\274@\246H*U\200p\241\210\250\2022H\250\223\310!d\n\027\212\210/l` &M\270\240\bH\031Td\341hlaL\"Q\245\213Z\004T\224\301\250\003C-\312`,\272E@C\305\030\306\025\224E\025\023(\211j\0229\204\f:\225<D\304\027Jc\013(QI\024\"*\213/\260\362\210<\241\303]\214\020*B\026e0\252p!\210\250T\241\214QT\036\221A\033\212\200\212EG$QQ\005A\306\026! &\221G\243\n.\202\224\304\025\216HcQ\262\370BN\021\fH\026\204\214\311\0268\205\2201\331\002\307\205R\310\210\201\233\007\f\025c\030\211p\204\222D\241#Q\251\342\005\345\r1Y|AL\241,\232PDt\301\241(\203Q\005\361E\216\022\250\250\250\204\321\2021\251T2@\031\243\250\334P\004$\364\"E\262\250T!dL\242"
+	.string	"\0031i\002"
+	.ascii	"b\264"
+	.ascii	"\350\030Zt\221\222\by\223D\027AW\2114v\210!\251,\276(\016\025"
+	.ascii	"\225\035\212\200Z\030Y\034\221)&p\241\210\250\302\021iT\006\035"
+	.ascii	"a\260\310)\002\245P\001Q\321\213\"\242\026\034b\024\205\216)"
+	.ascii	"\024\225\304\244\020\fb\013@C\304d\321\005\2211Y$\362\021*\272"
+	.ascii	"\020D$B\213\200\224G#r\205\0305\206z\027#H\024%\213/\030\223"
+	.ascii	"B\036\224G\030\310\024\"H\246\020#ys\201\r\305\241\026\210+^"
+	.ascii	"@\223E#\013\243\362X\0242\336(\201\212BH\025\224I$\321MQ\b\371"
+	.ascii	"\342*\201(\240L\"\2114\024\035\221F%\0212-*\211,\b\301 \266\200"
+	.ascii	"\2132\030U\024e0\252\300J,"
+	.string	"D,> \231#D,>@\tT\302\304\220\221\270\"\2062'\251\\\301\347\206\250$\232\020#\251\223T\256P|\301X\f*\262\360\301\205 b\013CC\304\024\305\027\304\344\t1\222;E@E%Q\251\302\004\025\024\330\021:\026\213n\212J\242\262\350\fJ\006Y\254dat\241B\250\250\f*\022\305(j *\211B\267\bId\223E\026,`4\340\205\240b\362&\211\f\001\361\305\231D\036\215/Ne\214\342\021\247\b\006d\362*\201P(\217F\030i\321\361\005\214!dP*dL\266\270.\224BF\030N\245\213\026\306\242\013T\231D\022\301P4\276\200\221,\216\306\373\013\216$*&I(\221\310$\t\034%P\b?\312\243\021\006N\n\t\021\257\262\b\b\251\223t\021d\223Ee\0201It\221B\250\210\002/\004\025\223\033\224E@\312$r\205!\2421Y,\312Q&\221Dw\b\211l"
+	.string	"\320)T\224\3018D4*\215G#\216\022\250H\205\342\013\243\022\337\004\013\241\342\t\024-\2640\242\347\"\210\220\"\003\013L"
+	.string	"\005\0344B\250\b\t\024\203\013EI\026$\220F\022G#\361\005\211\240d\021\211\021\026(\213\2120DPd\001\311\342\230\2022F\361\270\363\037oab\224\005&\326X\313?\3344g\203X\364nR{\335\220\252\222\345,\373\263\262\244\t\306\202\363\352`3\260\013_\0214\262\222\353\373"
+	.string	"\374\300?\306\303V\212\034.\371\352\213\253\240\207~7\316\364="
+	.string	"\326\340\037S\301S\364\250\314\235\365\305R\032G\323Ra\337\003\340\n\376\361\035\266C\323\230YR\270\256\222\205\231\001\322\367"
+	.string	"0\303?\216r\305\260\031&\177cP0\335\033\0207\275\276x\356\254\362\245\003K\337\003\340\013\377X\016?9i$\201[\202\343p\322\366\322\260\372\036"
+	.string	"W\370\307p\230\r\215J\315\333i\227\263v\030E\312-UC\007u\306\346\344\214c!\246\r\n\267a\243'u\205`\372\3425k\326\207\226)')\316GU\337\177H\203\177\254\226Ba\200\036T\230\276\007pk\3424\334\304h5G\211\311\240\b\323\215&\307hK\306`\345\017~\370\307g\250\217\253D\007\037\234\017#+<3\364\206\006@.\261\247%x\350\222\264e.;\2317[\200W\230J\300\324\2500\301+d\251\030\235\266\302\263\2521\255\n\247'\350$\311\211\201\354\365 \023K\273,\336\034\222$Hz\\1\270+]\216\2045@\f\215\255\276#"
+	.string	"\032\301aF\316\260\0074ey\202\177\\\344\244\332\321TE\r\023Mb3Z#\205\277\216\301\304L\371\270\352\213\207`\"I\230o~}_\327\376\007\030\026&\n\223\2768\b\026\322\305t\253{\340\005\243v\n\217\024~\361J\265\244Oe\206@\272\316\246\033\367\345$\220\353\\C\345f\314\300\002\344i\313\212\221T\337\026\203+;B\343\207\215z\204\f\\\231\226\005\274[:\224\370\262\260\217>)6\240tN\036\2214S\372\242\020\354\201\261z\234k`d\037\216\340\037\363\270\204LRd"
+	.ascii	"\351\035\3270\347\013\0163\201:\316\214fQc\005uU\246\201\213"
+	.ascii	"\213!\241U\252V\242\013\323\251/\246\002\001+g#\234\003W\035"
+	.ascii	"S\275\211\251v\322\354\324\n\242\303\342l\254Ao\tJj\340\251\032"
+	.ascii	"\030Gg\254\234\231\351\233\f5\202\370\3061\216\264\307\232"
+	.string	"\027\247\276\330F-s\003&\020/\312\007-\\\302\220(,\025\265!\037\371]1?4\341\022\302\360\023\206\302O\247\030^z\315\360 \210\177\354t\212\271Uui\365\3053\354\f\207\207\207xFc\032\270\351x\306wR/cKF(S\263\267\006\251$-\271\351\020\362H\002DF\372uC\245\346+O\351\264rJ\202\305\251o\00630\022F:\305\240\004\363\227-v8\003\257\303Cl\344\203\265\034\354 \314\207\220\037Q\f\361\362\330\310\310\305Sb2\245/\316!\234\360H\222e\004gP\203\314\323B2\251\032+\006\347e3Sa-\007\021pg\250\341\211\025\031\326\231\247j\236\246)q\342\352=\335e\225\351\233\032^\207*/\212`\337\247hn\302\266\324\222\364\275\007\030mJJ\312\216\355$1l\352\32275\203\303\344Ni\257oZ\246\002y\322\333B\370\333\344\f\016\231\n\322\367\036\210\340{"
+	.ascii	"\2025\250\373\373K\305\370`-\305\200P'\250!\b\216/\031\200O\305"
+	.ascii	"\244\203f\232\240tI\007S\301+qM\\\300r\316\326\232*\201i\240"
+	.ascii	"\335\302\340o\351\311\251\364D\013\333\223\276\367 \2055\350"
+	.ascii	"\261\267\227\202\361\301Z\016\2260\005\313\214\225\t<\331H\277"
+	.ascii	"<\005S\353\210\334\220R\3227\365\263ZQ\226\220\364M\275\234J"
+	.ascii	"8dqv\207}\323\276^\273*;$\3237\355\362?43-\206}S.\375\226*A\241"
+	.ascii	"\303\3217\345\353<\277\2502}O\330U\312\266\240\361\322\367\036"
+	.ascii	"\2140\210\250\272\247S\352R-v/'/\3212T\nWv&V\230\227\250B\350"
+	.ascii	"4\005fmYy\252\345\251^\211\023\377\003\302\306\3267\315\362\352"
+	.ascii	"5\206m\251\357\323\274\024\313ocS$L\334\232\276\307`\017\247"
+	.ascii	"W<\330\201\306G\232\276O\361\272\266\020A\322\267\253\374\257"
+	.ascii	"\235\242 \331\3217\245\222\336=\225\362\333\330D\341\261\225"
+	.ascii	"\325\367\030\340\341?\265\373m\322\267.W\314\276\307@\n>\006"
+	.ascii	"s8\003\301'OR(^Gev\205;{khE\350\236B\371\335\214\246\257&}\323"
+	.ascii	"\271~#\274\032\353\233\312\365\232\263\020j\311\307\017\234\201"
+	.ascii	"\0258\270\364\353\203\232e\260\245\241\021\314\231*\004\232\247"
+	.ascii	"\305\004\327\367\030\324\300\031\250\261\261\245n>8\233\245\025"
+	.ascii	"\n\232\321R\204.u\362\324\215Ka\032\246\276i[\255\013\207\316"
+	.ascii	"\250C\302szT,\305(\007\031R\310\020\315\220&i\f3\026@ H8\"\224"
+	.ascii	"M\206\275\273\001\023\300\303\nju\201\246\006\025s\006\231\021"
+	.ascii	"\021\021\021\tD$\005I\222\306\326S\030\210\353\"\254\350\316"
+	.ascii	"\340\007\036G\266\302\253\035\244[\177\332SrW\223\244=*\324c"
+	.ascii	"7*T\250@~x\245\340\374\247\2134s\035\0057\351\216~\310\254j\362"
+	.ascii	"\033\033\244\362\217\273<\251\2145\307Y\204^n\360m'\234\243\222"
+	.ascii	"2\254B:!\nL\265g-\177{8=\261\256\277R\b\275hGZ\372\354\002-\330"
+	.ascii	"\202*$\366;;\300z.\200yX\323j\bWG\206\307\304L\212\r\340\331"
+	.ascii	"j\350\374\361\004m!\033\202l\344S4\336\t\330\236\013Wo\036\324"
+	.ascii	"\177\017\216s\243/\225\330\3601B\221Q\375\203\315i\257\224-\267"
+	.ascii	"I\021k\213p\334\325\200\351\006\025\323\324;\371\037\220\363"
+	.ascii	"\377\323\004"
+	.string	"_\304u\257\r\teL\020@\001\346;\333$y+\330\007G\231Hjx8 y\351\317~\331N|P\234\303\362\231\374Z\021B0*\267\364BG\230\247\246DS\214 \374CR'\356@\327\205q\242#\352[\271^\022h9x\344\333\257\3122\242\334\247;\311\311G\2705\212\310\331\316\341,HS4\304.\237\322,l06\255\217\213\324\004\033V#h}\304\266\204\223Pu\026\211\350\325Z\036\2044\200\365\340\316\303*lx\300F\315\\\337\261\374\034CP\252=\310\315.>@\033\253\367r\241\213\366#4\023?\352\367V\302\205\375\261\226\323\r\024\034\r\253\034>/N$\311\377\371\333\355\231\020\254EFA6\302\305;\271\311\006&S\233\032\030N\204\2761\324\236\224\006\221t\034\2111t\264"
+	.ascii	"\2271\257\375\241?^\243v\273\rnu\312\313\377\277\324\3050@Z\030"
+	.ascii	"\256`\332\300\211}\026\312V\346WJ\033\360S\202AJ\f\006\204Q\322"
+	.ascii	"x5(0\006\005\037-\306\005\"\027\2129\032\226\236`NB\237_\353"
+	.ascii	"?\032,m\203\306rc\203\030X\371\306}|\210s\361\370K\021\361Z\256"
+	.ascii	"\177\224\267\n\317Q\206\340\205\344\036_\326\310\356\nG\r\354"
+	.ascii	"%\nN_|]I\217\266\374W\036x\304\001\223\250\263 \260\350\376$"
+	.ascii	"=\344v\317Jc\002\021\304\240\230t\307\007\344=\315R\356\332Y"
+	.ascii	",\210\315~|\271/-\003\211\324\005\342?\376"
+	.string	"\017\027\275\0370L\3070C\220\212.P\225E\007U\351\0223\223\260\341\374\3513\372\317b\"\003\341\264L\305\357\333@\260\305\214^\264\374-^\260't\317\263\275\305\261\020s;\2202P\213\"=\375D\266\247AnC:\241\177&\273F\226\030W4\\\2744\304\037f\273\351\006\220?\025]\022O\355\214\310\236\235]QiX|k\206\20375rW\342\327e\221G\"\024\3534\217\376\203:\274\223\270\353\242\244\240\322\264\301\371\b\301\340\305]\262\353%\336\325\373Y\336\233\317\325\261\334\245\324+U8:Q\337V\n\247\024<2\202\346\205\354\341\236\315\331\2047H\001`H-\247\b\221S\024\240\265\276\304\007\206\222\013\264\247\312\2454\202s\260\024\236\214\3112:\037d\344{\362\225\352\325\264\232l\203#[\201mI\310\302s\003\375\025L\017\310\034\233\324\031x\305\316\233\246\206\325\214J\327\302~u\201\224:"
+	.string	"\343\265d\225\344_\203\354\360\017\336\220d\310G\364\t\n\357\370\214QV\255\376\322\243\004_\316\350\205\240\313\355\203 \f\270i\004JH5\340/\022\352\316h\230\rr1\266\3448xoo\2068{\251M[ }\202H\220\344\242*\375^@\263g\321/\247\313\313e\235\017\300\304\013&\306\2717>\327)?0b\t\225<\231\373{\256\330,\024*\351{)\317\373a\206\356\250:W\306\026\234\357\211\224\023\2408\036\023i\304F\3405"
+	.string	"8\354\244D\020I\330K\312v`\n\222\316W1\036 \272\267\211e\325)>&\344\200\034\326\221\216pG\311\330\217\025\256 \023@\202N\372\034o\241\314o+\273\350\013a$W)\357\030\333Y\323H\350\031\237\034\257j1/\211V\276\252g\022F\013B\245>`\2324\333\004\337\365\351\3218\250A\266\272\017\377\326%\230\234\220\247_\255\f\314\004\350P\2722\330b6\035\267\240\251\016SF\365\332s\237\306s=m\211\244S\037\276i\206\305x\361\027P\345\260;\301YLe\370pr\021\033\344g\326m\305\260y\226\317\262#\213\313\315\013\352\237\271\031\311\317\301:\037\030\037Q\262<!o(%b\032\341\363\234\342\004\355 \251\331Y\261\276\330\r#\344v("
+	.ascii	"r\305\235\365\022(9\032gg\364Y\332\001\345SF\035\302\350\301"
+	.ascii	"\365^BFsJ\316o)\017DWvy\263\200\001\037\213.\267\375'\025\320"
+	.ascii	"N\261\251"
+	.string	"LM\261\346$\265\232\343q6\311TS\264\273%l\261\006\351\304b\306o\200c\270\311\362\216\326\013\275S\301oyb!.VH\376\262\002\201\232>\33287\343l\230\b\017s\250\005\257!\300\3109\336[TB\377\267e\271\021\207\247\006&\3540\361\365(\013\013D3\317\252\311,\246\274q\345c\005]\254?\257\333\225\244\204o\376a\353\271y\335y\357\243\347\271o\317\361\224\"\336$v\326\242\273\b\2407L\b7\273XP1r\261\313ag\022j7}p\357{\006\366\035\373,\243(nr\330gS\265\360\212\210\003\273|\337\251\177)]=\"z<\270\366J\376\037\307\031\212{\327\207\202\247{&d\271Y}\325\270t\271\363VN\252\377\024\335\262A\366\270\271\310\031fjKr^\257\022\003\031Q\354\252\366\237\267\262\237\3155V\245'\311\355K\214\035(\004\266\036w&\302J\006\214\005\221\302\252\236"
+	.string	"\222\324\225\345\251$\331\235\332|\242\320|\004\306\203\032\261\205\301&\f\024\347y\004t*\246\220\023\036\330\237\210\361\312\273\"\371\032\306"
+	.string	"\333\214\263\376\313S\2635\200Ne@(\022\013\355\333\276?\374i\035!\371\301\311\253O\271\344h\037F\ry\003CTyY\004\030d\210\203\213\202pd\312\031"
+	.string	"\031ZSX\330X\013<\253\315\213{)\321\262\335}\004Z\274\023\3729\333\233v\207\244\325\177\265Xiq\270\366\373\220s\275\357\363\244\372\233\371^\225\201\210l\324\"$\021u\241\3707\004\231\364g8j#\031\037zb\366\360\\?\346DU\034\315V\316\f\207\267\t\361D\177\270\235?\b\316T\0349?y\270\253\376\305\247\357\311\351A3\235b\033\355>\200\bA\003)\261\240\231\347]l(\336p\257\262/\031\372\340^\027{\377\321,<m\373\235\272\274\004\366\332\302o0$\360\330\n\021\320\004\312\260\211\236\235\336g\203\276?j\227 \323\223\203\240\300\263$\320\r\310b\255\275bF\266\374\243\361\n\252\357(9\267\036\\\023\206w\023ab\357v~\246\301jF"
+	.string	"\331^$\264@y/\317"
+	.string	"+B\226\013\303\034[\276\237\356$\275\257\354_$\"3[\002\205\335t\337\310\337\310\312\310$\230(\316|\337*R\301^\370\024\030\274\254z\023@\255\361\007\ng2\371w\262\275\021\276<b08\205\b\355\377#\351?hpvohl\203\301\270\274\203\321\002\214|h\233\264\300\256\235\247W+}b\232{0\n\360\235\241\235\362\223}\327r\023\002f\344{{-3g\236K\036\275O\262\004\263\206\2173\177\255%\027\314\203h\352\222\305R~X\304\346\222\210\314\\2\214\305\025\266\220\020x\361)\023\311Qb\036%\245\2757\320\371wG\0348"
+	.ascii	"\350\316X\332\223\234p\353xp\2104\336\314A(i\333 6\006\337\260"
+	.ascii	"t\340a\305,\036\245lU\340$\3768\177\001U\354\013o\304}\t\024"
+	.ascii	"\356\314H\250\252\267\264\325V>\273z&t!\217\345x~\232F\336\316"
+	.ascii	"\212U\r\220\255\264X[*NzK\374\205b\216\270!\204\233S\313?q\260"
+	.ascii	"M\213\211#W\2665)3\251\226\333\202Ey\344\354\274U\312\026\016"
+	.ascii	"?\001%\237m\355\245\206(\310a\361n\255p\210\220c\373\334K\007"
+	.ascii	"W2C\025\253\333I\346\374@\034)\302:\2162r=|\004@\034\316\330"
+	.ascii	"u\201=7\342\254w\223]\\j\357\tl{\304\233J\232\r0h\2368\330(}"
+	.ascii	"\212\352={%\235e\314\r0\303\177%:\311"
+	.ascii	"#\212\244\245?\223\320r\027\337:\205\227>\214\243\202\264\007"
+	.ascii	"&sE\3402/\324\317X\017\023\206y\200ICc\214\"\216\336\264\r\200"
+	.ascii	"\027D\2371\024AXrzS\325\035\257\332\004%S\235\312\351\0211[\365"
+	.ascii	"\335\355A<P\266r\254\302<\324E<\347\364\366\236\350\243h~\364"
+	.ascii	"\216\217{\361\332}\365\274Q\303\364\314X^\021\021l\223\2026\200"
+	.ascii	"\266\337\004\210\006 .\2721WS\0379@\255\362(wVA/\200\246\241"
+	.ascii	"\033J\371SV\023\346\247\341\204\215\342\0018\t)\313\340\221F"
+	.ascii	"\234\221(\347\376\023?\001V\213\265\007\220\337\351>7\343 1\246"
+	.ascii	"\360,:\212k\272p\351\260XS6\325,\222TK\204b\376\330\323\275\267"
+	.ascii	"\375$\006\235"
+	.string	"\r`\335\321\223Y\232\324\006S\345\343\034\377+\221d\r7{\235\005T\307\251\017h\226i\251H\354Mz\0161a\302\270g]\365\236\275\304\023M\350\314\324P\317\323\332FL\031\354?\361\200ku\025\001G\210bnP\223\230!\375\356\304\330\357\017\262F\267\006\262xE\321\024\311\371\200\031<\221\254\213Xm#\201ky\323%Z\231/M\324GJj\243\276\335%\371L\330\335G\311\353\245\323\032\332\340n\325y\244e\347\r,B\340\005\036\013\001\244\326\340S\tb\240\305\254\366\331\354\227\264\371\360\360\034\207v\r=W\242 \244DG\333\226\232\264)\0012\326\002p4tK\214\375\304\001\225\212s\f|\257\256Ts\262\n&\364\335\376\321\f\3513\263A\320\327\026\035x\322\366A\024Z\370:&.\323\313\320\247myf\236\310 \200>\233\276\021\020\323\177i\265\025'\322\f\023N\332A$\270\004\210fX"
+	.string	"~\020\n\240\213\340)>\244)z\304$\tS\215\343\320f\256\360\031>J\017\r\344w\350\254w\037z\245}\323u\210\303.\350\237$"
+	.string	",RQ\240\2301\225\323\323\211\347\037,\245j\371\273b2\\\241=\336(Af\355h\377\3023i\326\004\023\363!\376\307\027\340\f\350\217\230\367\367\t\243\366\321\346\f\272`*$z^U[Y\374B\277\247\n\354\351\307^\335\r\352\257\202\032\241\334\343\026s\030\027\031\215\263@\321\215\025!*\202\371\310\214\247\365\022w3\255\273\300\204\215r\024T\030\005kj\002\311\024\314\202C\0054\241\312S`q\211u\b\225\230\353b\312\f\274\030]\370\025\026*\016\340}y\204Hvxu4\031\214\r\324\027\205g\324N\2751\202k\025\207,\224\356S\233\024p\"\003\031\352I\376\310%\221hyK\036\265\352\367\022 %q\2349\273*\256\340\344hel\021\3060$\350\242X,\314\275}\371\256GT\340[\246\237A\370<\240bcd\262\210\255\036\361\274\262\216;\251|\340"
+	.string	"\243U\231\nx\333\364\006\b*\005\253\352\317\240Ox\314\003DW7\306\311 \026\300U\364\346\347cS\033\332NzY\276\326\230\235yS\317>\035\024\305Q\"p\274y\367\026\256\fb\\\272`\215\321\001a\367\256a\253 \"R1Ji\\\204\364\214"
+	.string	"\t\370\2179\230\002\f5\277\270\004\205\005\353\2408\230\362\304B\224\016\021w\272\017\235\226\024E\214G\255\214\347\243\355\004\320\354|.\303N\037\245P\025N\"\357\022\270\035n\201\021i\n\354&\272\276\024\362;^\335 (5?\0379\350\264\301\274(\367B\007w\271\366k\336'\315\244\326m\343\317\244[\246\306\307\331\342~q\276\273\263\232~\254\344e\232a\304\270\024<\007$\246b\313\313\222\371o\215\263\335x\232\252\227\366\006[-\356c\221\372\214\020\361\353\226\275\020b\034V\201\315\316Y\206O\237"
+	.ascii	"\017\240\217\377\225\371j\013\224o\272\354(L\342n\274\034\271"
+	.ascii	"\250[E_\3314N\202sG\213\307I\t\256\322IY\2510_+\310j\n2\226["
+	.ascii	"\005YQ\017\362q\224\351\361\230\224\024\244,\223+\372x\275k\231"
+	.ascii	"\375\2254\330b8JN\376\024^\202g\266\207\333\343\321n\003\256"
+	.ascii	"\250\354F\315\026\304Iq\037\006\\\247@\233\306y]\332\241\301"
+	.ascii	"\\\017t\2368\236%\347`\320\314\375\262\343\266\347\350\333\252"
+	.ascii	"\360\307\233\276\304{i\206\312\026\204\035h\210\205\262L\227"
+	.ascii	"\035^NLe\223Z\016R\357.f\356\257L~\216\fr\342\302\252\347\347"
+	.ascii	"\354\325\307\321\221\254\377\221\222 \207D\357\362t\030\307d"
+	.ascii	"\320\235\315k\327`oG.,3$\363_\234\214\270\253O\275\242i\r\210"
+	.ascii	"I\227\322{\241\351M\217n\370\263J\355.\226[\211\3173\355\235"
+	.ascii	"\252t\222\225\336\224\315\027)\254\212#\271^\365\255\361\364"
+	.ascii	"\300\203\224\371$N\261\243]8\356\307U\017&mv\270o\212\327\337"
+	.ascii	"H\315\021\213\017\216\270 \323\307\231x\026\310c\327\347\225"
+	.ascii	"\rn\336hyH\257v\334.\200\307tQ\033\215\327\342<!\206\036\244"
+	.ascii	"\\]\356\270\017_\001c\370\376\003'\016\313\333$\270\256\t\354"
+	.ascii	"\212\343\261^lVU\230\017i\3136:#h\277I\f{\305]\2511t\213\334"
+	.ascii	"\033\311y\307\017*\373\007\345${\026\031E`\373\347\224\215t\313"
+	.ascii	"\361\243$-\022\363\020\363\354N\303\234\247\377\341\256\264\342"
+	.ascii	"O\013\261\020\307\254\003<\272\033\343\361[\264\217\314\374I"
+	.ascii	"n\313\310Q\220X\237\003\216\237cD\335\355N\262v\372\271x\"h8"
+	.ascii	"\257\331\216\315\223\373\360\023+s\212\373\306r\237\322\372\345"
+	.ascii	"\306\267`$v6\353\353\205g\263\354\354"
+	.string	"\364\207\f;\350\260\003i\377`6\377\311\355\313\3568\323\313\316\347\337l/\260kh\016\333\247\352vK\354\300{\317\367\206\262:\2237\256;O\374\273\314\222\341\355\311\235\303\350\315\325x\304\t.)\277\270\236\342\300d\216\365\244\274\270w\201\023>*\216\201A\321\215W\227\f}\2445,\206\322\003w\257^\335)d\302\207\t\350M\271\351\221\304\242\300\253E\235\363\344\275\313\005\\\361\0168\177Z\262\320\241\"W\224\200I\242\0369m\206\370\306\030Z?\2737\023\307\245\327#\211\261\230\355=\257^\340=\227\356\024\235\ff\222\nS\006\277\224f\005\355g\323w\\\266\212Mz\373\273|\3610\315/\375\177/c\377\362\304_\337\316\204{\215\300\243\334_U\340\250\212W\r\0171r\037\330\352\336%_\273\322\267\304\361\205\020\007\260\364\250\310\266a\205O\302\333\336\017\241\031s\356'\017\017H\333<m\313>\315\367"
+	.ascii	"\340\265\006\315\325\002&\211\256"
+	.text
+	.section	.gnu.lto_.symtab.3455d1153e8ca6ee,"e",@progbits
+	.string	"frskyOSDInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\002"
+	.string	""
+	.string	"frskyOSDIsReady"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\342\002"
+	.string	""
+	.string	"frskyOSDBeginTransaction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\333\002"
+	.string	""
+	.string	"frskyOSDCommitTransaction"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\002"
+	.string	""
+	.string	"frskyOSDFlushSendBuffer"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"frskyOSDGetGridRows"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\347\002"
+	.string	""
+	.string	"frskyOSDGetGridCols"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"frskyOSDGetPixelWidth"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\002"
+	.string	""
+	.string	"frskyOSDGetPixelHeight"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.string	"frskyOSDDrawStringInGrid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\002"
+	.string	""
+	.string	"frskyOSDDrawCharInGrid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\366\002"
+	.string	""
+	.string	"frskyOSDReadCharInGrid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\375\002"
+	.string	""
+	.string	"frskyOSDClearScreen"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\377\002"
+	.string	""
+	.string	"frskyOSDUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\n\003"
+	.string	""
+	.string	"frskyOSDReadFontCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\031\003"
+	.string	""
+	.string	"frskyOSDWriteFontCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"!\003"
+	.string	""
+	.string	"frskyOSDSetStrokeColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"frskyOSDSetFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"(\003"
+	.string	""
+	.string	"frskyOSDSetStrokeAndFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"frskyOSDSetColorInversion"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	".\003"
+	.string	""
+	.string	"frskyOSDSetPixel"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"frskyOSDSetPixelToStrokeColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"9\003"
+	.string	""
+	.string	"frskyOSDSetPixelToFillColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	";\003"
+	.string	""
+	.string	"frskyOSDSetStrokeWidth"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"?\003"
+	.string	""
+	.string	"frskyOSDSetLineOutlineType"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"C\003"
+	.string	""
+	.string	"frskyOSDSetLineOutlineColor"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"E\003"
+	.string	""
+	.string	"frskyOSDClipToRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"L\003"
+	.string	""
+	.string	"frskyOSDClearRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"N\003"
+	.string	""
+	.string	"frskyOSDResetDrawingState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"P\003"
+	.string	""
+	.string	"frskyOSDDrawCharacter"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"W\003"
+	.string	""
+	.string	"frskyOSDDrawCharacterMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"_\003"
+	.string	""
+	.string	"frskyOSDDrawString"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\003"
+	.string	""
+	.string	"frskyOSDDrawStringMask"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"n\003"
+	.string	""
+	.string	"frskyOSDMoveToPoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"p\003"
+	.string	""
+	.string	"frskyOSDStrokeLineToPoint"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"r\003"
+	.string	""
+	.string	"frskyOSDStrokeTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\003"
+	.string	""
+	.string	"frskyOSDFillTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\003"
+	.string	""
+	.string	"frskyOSDFillStrokeTriangle"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\177\003"
+	.string	""
+	.string	"frskyOSDStrokeRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\201\003"
+	.string	""
+	.string	"frskyOSDFillRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\203\003"
+	.string	""
+	.string	"frskyOSDFillStrokeRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\205\003"
+	.string	""
+	.string	"frskyOSDStrokeEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\207\003"
+	.string	""
+	.string	"frskyOSDFillEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\003"
+	.string	""
+	.string	"frskyOSDFillStrokeEllipseInRect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\213\003"
+	.string	""
+	.string	"frskyOSDCtmReset"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\003"
+	.string	""
+	.string	"frskyOSDCtmSet"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\226\003"
+	.string	""
+	.string	"frskyOSDCtmTranslate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\233\003"
+	.string	""
+	.string	"frskyOSDCtmScale"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\235\003"
+	.string	""
+	.string	"frskyOSDCtmRotate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\003"
+	.string	""
+	.string	"frskyOSDContextPush"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\003"
+	.string	""
+	.string	"frskyOSDContextPop"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\250\003"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"_logf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\003"
+	.string	""
+	.string	"crc8_dvb_s2"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\300\003"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\003"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\003"
+	.string	""
+	.string	"serialTxBytesFree"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\313\003"
+	.string	""
+	.string	"uvarintEncode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\321\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\362\003"
+	.string	""
+	.string	"osdCharacterGridBufferGetEntryPtr"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\002\004"
+	.string	""
+	.string	"osdCharacterGridBufferClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\004"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3455d1153e8ca6ee,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,18920 @@
+	.file	"gps.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/config/parameter_group.h"
+	.file 5 "./src/main/common/time.h"
+	.file 6 "./src/main/common/axis.h"
+	.file 7 "./src/main/common/vector.h"
+	.file 8 "./src/main/drivers/io_types.h"
+	.file 9 "./src/main/drivers/resource.h"
+	.file 10 "./src/main/drivers/bus.h"
+	.file 11 "./src/main/drivers/sensor.h"
+	.file 12 "./src/main/drivers/compass/compass.h"
+	.file 13 "./src/main/drivers/serial.h"
+	.file 14 "./src/main/fc/runtime_config.h"
+	.file 15 "./src/main/sensors/sensors.h"
+	.file 16 "./src/main/io/serial.h"
+	.file 17 "./src/main/io/gps.h"
+	.file 18 "./src/main/io/gps_private.h"
+	.file 19 "./src/main/drivers/adc.h"
+	.file 20 "./src/main/fc/config.h"
+	.file 21 "./src/main/io/gps.c"
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 23 "./src/main/common/maths.h"
+	.file 24 "./src/main/config/feature.h"
+	.file 25 "./src/main/drivers/system.h"
+	.file 26 "./src/main/navigation/navigation.h"
+	.file 27 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	gps.c.88dacc37
+	.weak	gps.c.88dacc37
+gps.c.88dacc37:
+	.long	0x1b2d
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2b
+	.long	.LASF2637
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2052
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2053
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2054
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2055
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2056
+	.uleb128 0x3
+	.long	.LASF2057
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF2058
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2059
+	.uleb128 0x3
+	.long	.LASF2060
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2061
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF2062
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2063
+	.uleb128 0x3
+	.long	.LASF2064
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x2d
+	.byte	0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2065
+	.uleb128 0x3
+	.long	.LASF2066
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF2067
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF2068
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xd
+	.long	0xc3
+	.uleb128 0x2e
+	.long	0xc3
+	.uleb128 0x3
+	.long	.LASF2069
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF2070
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xd
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF2071
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x96
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2072
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2073
+	.uleb128 0x3
+	.long	.LASF2074
+	.byte	0x4
+	.byte	0x19
+	.byte	0x12
+	.long	0xd9
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x4
+	.byte	0x21
+	.long	0x14b
+	.uleb128 0x6
+	.long	.LASF2075
+	.value	0xfff
+	.uleb128 0x6
+	.long	.LASF2076
+	.value	0xf000
+	.uleb128 0x6
+	.long	.LASF2077
+	.value	0xfff
+	.uleb128 0x1
+	.long	.LASF2078
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2079
+	.value	0x8000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2080
+	.byte	0x4
+	.byte	0x2a
+	.byte	0xf
+	.long	0x157
+	.uleb128 0xf
+	.long	0x162
+	.uleb128 0x4
+	.long	0xa2
+	.byte	0
+	.uleb128 0x20
+	.byte	0x8
+	.byte	0x4
+	.byte	0x32
+	.byte	0x5
+	.long	0x181
+	.uleb128 0x21
+	.string	"ptr"
+	.byte	0x33
+	.byte	0xf
+	.long	0xa2
+	.uleb128 0x21
+	.string	"fn"
+	.byte	0x34
+	.byte	0x16
+	.long	0x181
+	.byte	0
+	.uleb128 0x7
+	.long	0x14b
+	.uleb128 0x9
+	.long	.LASF2088
+	.byte	0x28
+	.byte	0x4
+	.byte	0x2c
+	.byte	0x10
+	.long	0x1e2
+	.uleb128 0xc
+	.string	"pgn"
+	.byte	0x4
+	.byte	0x2d
+	.byte	0xb
+	.long	0x110
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2081
+	.byte	0x4
+	.byte	0x2e
+	.byte	0xe
+	.long	0xd9
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2082
+	.byte	0x4
+	.byte	0x2f
+	.byte	0xe
+	.long	0x1e2
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2083
+	.byte	0x4
+	.byte	0x30
+	.byte	0xe
+	.long	0x1e2
+	.byte	0x10
+	.uleb128 0xc
+	.string	"ptr"
+	.byte	0x4
+	.byte	0x31
+	.byte	0xf
+	.long	0x1e7
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2084
+	.byte	0x4
+	.byte	0x35
+	.byte	0x7
+	.long	0x162
+	.byte	0x20
+	.byte	0
+	.uleb128 0x7
+	.long	0xc3
+	.uleb128 0x7
+	.long	0x1e2
+	.uleb128 0x3
+	.long	.LASF2085
+	.byte	0x4
+	.byte	0x36
+	.byte	0x3
+	.long	0x186
+	.uleb128 0xd
+	.long	0x1ec
+	.uleb128 0x3
+	.long	.LASF2086
+	.byte	0x5
+	.byte	0x1e
+	.byte	0x12
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF2087
+	.byte	0x5
+	.byte	0x21
+	.byte	0x12
+	.long	0xf6
+	.uleb128 0x9
+	.long	.LASF2089
+	.byte	0xa
+	.byte	0x5
+	.byte	0x49
+	.byte	0x10
+	.long	0x27e
+	.uleb128 0x2
+	.long	.LASF2090
+	.byte	0x5
+	.byte	0x4b
+	.byte	0xe
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2091
+	.byte	0x5
+	.byte	0x4d
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0xc
+	.string	"day"
+	.byte	0x5
+	.byte	0x4f
+	.byte	0xd
+	.long	0xc3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2092
+	.byte	0x5
+	.byte	0x51
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2093
+	.byte	0x5
+	.byte	0x53
+	.byte	0xd
+	.long	0xc3
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2094
+	.byte	0x5
+	.byte	0x55
+	.byte	0xd
+	.long	0xc3
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2095
+	.byte	0x5
+	.byte	0x57
+	.byte	0xe
+	.long	0xd9
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2096
+	.byte	0x5
+	.byte	0x58
+	.byte	0x3
+	.long	0x215
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x6
+	.byte	0x14
+	.long	0x2a3
+	.uleb128 0x1c
+	.string	"X"
+	.byte	0
+	.uleb128 0x1c
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x1c
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x12
+	.byte	0x24
+	.byte	0x7
+	.byte	0x20
+	.byte	0x9
+	.long	0x2b8
+	.uleb128 0xc
+	.string	"m"
+	.byte	0x7
+	.byte	0x21
+	.byte	0xb
+	.long	0x2b8
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.long	0x102
+	.long	0x2ce
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x2
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2097
+	.byte	0x7
+	.byte	0x22
+	.byte	0x3
+	.long	0x2a3
+	.uleb128 0x3
+	.long	.LASF2098
+	.byte	0x8
+	.byte	0x7
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x3
+	.long	.LASF2099
+	.byte	0x8
+	.byte	0x8
+	.byte	0xf
+	.long	0xa2
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x16
+	.long	0x3e3
+	.uleb128 0x1
+	.long	.LASF2100
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2101
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2102
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2103
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2105
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2106
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2107
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2108
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2110
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2111
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2112
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2113
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2114
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2115
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2116
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2117
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2118
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2119
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2120
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2121
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2122
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2123
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2124
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2125
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2126
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2127
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2128
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2129
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2130
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2131
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2132
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2133
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2134
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2135
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2136
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2137
+	.byte	0x25
+	.byte	0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x43
+	.long	0x46e
+	.uleb128 0x1
+	.long	.LASF2138
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2139
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2140
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2141
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2142
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2143
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2144
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2145
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2146
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2147
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2148
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2149
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2150
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2151
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2152
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2153
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2154
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2155
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2156
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2157
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2158
+	.byte	0x14
+	.byte	0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2159
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x3a
+	.long	0x4a0
+	.uleb128 0x1
+	.long	.LASF2160
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2161
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2162
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2163
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2164
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2165
+	.byte	0xa
+	.byte	0x40
+	.byte	0x3
+	.long	0x475
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x4b
+	.long	0x5e5
+	.uleb128 0x1
+	.long	.LASF2166
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2167
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2168
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2169
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2170
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2171
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2172
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2173
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2182
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2183
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2184
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2185
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2186
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2187
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2188
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2189
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2190
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2191
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2192
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2193
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2194
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2195
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2196
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2197
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2198
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2199
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2200
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2201
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2202
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2203
+	.byte	0x25
+	.uleb128 0x1
+	.long	.LASF2204
+	.byte	0x26
+	.uleb128 0x1
+	.long	.LASF2205
+	.byte	0x27
+	.uleb128 0x1
+	.long	.LASF2206
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2207
+	.byte	0x29
+	.uleb128 0x1
+	.long	.LASF2208
+	.byte	0x2a
+	.uleb128 0x1
+	.long	.LASF2209
+	.byte	0x2b
+	.uleb128 0x1
+	.long	.LASF2210
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2211
+	.byte	0x2d
+	.uleb128 0x1
+	.long	.LASF2212
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF2213
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF2214
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2215
+	.byte	0x31
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2216
+	.byte	0xa
+	.byte	0x94
+	.byte	0x3
+	.long	0x4ac
+	.uleb128 0x22
+	.byte	0xa6
+	.uleb128 0x9
+	.long	.LASF2217
+	.byte	0x18
+	.byte	0xa
+	.byte	0x9f
+	.byte	0x10
+	.long	0x669
+	.uleb128 0x2
+	.long	.LASF2218
+	.byte	0xa
+	.byte	0xa0
+	.byte	0xc
+	.long	0xa2
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2219
+	.byte	0xa
+	.byte	0xa1
+	.byte	0xf
+	.long	0x4a0
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2220
+	.byte	0xa
+	.byte	0xa2
+	.byte	0x17
+	.long	0x5e5
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2221
+	.byte	0xa
+	.byte	0xa3
+	.byte	0xd
+	.long	0xc3
+	.byte	0x10
+	.uleb128 0xc
+	.string	"tag"
+	.byte	0xa
+	.byte	0xa4
+	.byte	0xd
+	.long	0xc3
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2222
+	.byte	0xa
+	.byte	0xa5
+	.byte	0xd
+	.long	0xc3
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2223
+	.byte	0xa
+	.byte	0xb3
+	.byte	0x7
+	.long	0x5f1
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2224
+	.byte	0xa
+	.byte	0xb4
+	.byte	0xd
+	.long	0x2da
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2225
+	.byte	0xa
+	.byte	0xb5
+	.byte	0x3
+	.long	0x5f3
+	.uleb128 0xd
+	.long	0x669
+	.uleb128 0x22
+	.byte	0xbc
+	.uleb128 0x9
+	.long	.LASF2226
+	.byte	0x28
+	.byte	0xa
+	.byte	0xb7
+	.byte	0x10
+	.long	0x6e5
+	.uleb128 0x2
+	.long	.LASF2227
+	.byte	0xa
+	.byte	0xb8
+	.byte	0x23
+	.long	0x6e5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2219
+	.byte	0xa
+	.byte	0xb9
+	.byte	0xf
+	.long	0x4a0
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2221
+	.byte	0xa
+	.byte	0xba
+	.byte	0xe
+	.long	0xe5
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2222
+	.byte	0xa
+	.byte	0xbb
+	.byte	0xe
+	.long	0xe5
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2223
+	.byte	0xa
+	.byte	0xc9
+	.byte	0x7
+	.long	0x67a
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2224
+	.byte	0xa
+	.byte	0xca
+	.byte	0xa
+	.long	0x2e6
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2228
+	.byte	0xa
+	.byte	0xcb
+	.byte	0x10
+	.long	0x6ea
+	.byte	0x20
+	.byte	0
+	.uleb128 0x7
+	.long	0x675
+	.uleb128 0x7
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF2229
+	.byte	0xa
+	.byte	0xce
+	.byte	0x3
+	.long	0x67c
+	.uleb128 0x7
+	.long	0xcf
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xb
+	.byte	0x1a
+	.long	0x743
+	.uleb128 0x1
+	.long	.LASF2230
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2231
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2232
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2233
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2234
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2235
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2237
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2238
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2239
+	.byte	0xb
+	.byte	0x24
+	.byte	0x3
+	.long	0x700
+	.uleb128 0x3
+	.long	.LASF2240
+	.byte	0xb
+	.byte	0x33
+	.byte	0xf
+	.long	0x75b
+	.uleb128 0x7
+	.long	0x760
+	.uleb128 0x17
+	.long	0x46e
+	.long	0x76f
+	.uleb128 0x4
+	.long	0x76f
+	.byte	0
+	.uleb128 0x7
+	.long	0x774
+	.uleb128 0x9
+	.long	.LASF2241
+	.byte	0x48
+	.byte	0xc
+	.byte	0x18
+	.byte	0x10
+	.long	0x7d0
+	.uleb128 0x2
+	.long	.LASF2242
+	.byte	0xc
+	.byte	0x19
+	.byte	0x13
+	.long	0x819
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2243
+	.byte	0xc
+	.byte	0x1a
+	.byte	0x1a
+	.long	0x74f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2244
+	.byte	0xc
+	.byte	0x1b
+	.byte	0x1a
+	.long	0x7d0
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2245
+	.byte	0xc
+	.byte	0x22
+	.byte	0x7
+	.long	0x7fc
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2246
+	.byte	0xc
+	.byte	0x23
+	.byte	0xd
+	.long	0xc3
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2247
+	.byte	0xc
+	.byte	0x24
+	.byte	0xd
+	.long	0x81e
+	.byte	0x42
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2248
+	.byte	0xb
+	.byte	0x34
+	.byte	0xf
+	.long	0x75b
+	.uleb128 0x20
+	.byte	0x24
+	.byte	0xc
+	.byte	0x1e
+	.byte	0x9
+	.long	0x7fc
+	.uleb128 0x23
+	.long	.LASF2249
+	.byte	0x1f
+	.byte	0x16
+	.long	0x2ce
+	.uleb128 0x23
+	.long	.LASF2250
+	.byte	0x20
+	.byte	0x1c
+	.long	0x743
+	.byte	0
+	.uleb128 0x12
+	.byte	0x28
+	.byte	0xc
+	.byte	0x1c
+	.byte	0x5
+	.long	0x819
+	.uleb128 0x2
+	.long	.LASF2251
+	.byte	0xc
+	.byte	0x1d
+	.byte	0xd
+	.long	0x46e
+	.byte	0
+	.uleb128 0x2f
+	.long	0x7dc
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.long	0x6ef
+	.uleb128 0x13
+	.long	0xab
+	.long	0x82e
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2252
+	.byte	0xc
+	.byte	0x25
+	.byte	0x3
+	.long	0x774
+	.uleb128 0x24
+	.long	.LASF2256
+	.long	0x30
+	.byte	0x1a
+	.long	0x85b
+	.uleb128 0x1
+	.long	.LASF2253
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2254
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2255
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2256
+	.byte	0xd
+	.byte	0x1e
+	.byte	0x3
+	.long	0x83a
+	.uleb128 0x24
+	.long	.LASF2257
+	.long	0x30
+	.byte	0x20
+	.long	0x8b8
+	.uleb128 0x1
+	.long	.LASF2258
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2259
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2260
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2261
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2262
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2263
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2264
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2266
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2267
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2268
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2257
+	.byte	0xd
+	.byte	0x34
+	.byte	0x3
+	.long	0x867
+	.uleb128 0x9
+	.long	.LASF2269
+	.byte	0x10
+	.byte	0xd
+	.byte	0x37
+	.byte	0x10
+	.long	0x8ec
+	.uleb128 0x2
+	.long	.LASF2270
+	.byte	0xd
+	.byte	0x38
+	.byte	0x14
+	.long	0x6fb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2271
+	.byte	0xd
+	.byte	0x39
+	.byte	0x9
+	.long	0x7c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2272
+	.byte	0xd
+	.byte	0x3a
+	.byte	0x3
+	.long	0x8c4
+	.uleb128 0xd
+	.long	0x8ec
+	.uleb128 0x3
+	.long	.LASF2273
+	.byte	0xd
+	.byte	0x3c
+	.byte	0x10
+	.long	0x909
+	.uleb128 0x7
+	.long	0x90e
+	.uleb128 0xf
+	.long	0x91e
+	.uleb128 0x4
+	.long	0xd9
+	.uleb128 0x4
+	.long	0xa2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2274
+	.byte	0xd
+	.byte	0x3d
+	.byte	0x10
+	.long	0x92a
+	.uleb128 0x7
+	.long	0x92f
+	.uleb128 0xf
+	.long	0x944
+	.uleb128 0x4
+	.long	0x6fb
+	.uleb128 0x4
+	.long	0x7c
+	.uleb128 0x4
+	.long	0xa2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2275
+	.byte	0x60
+	.byte	0xd
+	.byte	0x3f
+	.byte	0x10
+	.long	0xa2f
+	.uleb128 0x2
+	.long	.LASF2276
+	.byte	0xd
+	.byte	0x41
+	.byte	0x24
+	.long	0xaeb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2277
+	.byte	0xd
+	.byte	0x43
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2278
+	.byte	0xd
+	.byte	0x44
+	.byte	0x10
+	.long	0x85b
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2279
+	.byte	0xd
+	.byte	0x45
+	.byte	0x13
+	.long	0x8b8
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2280
+	.byte	0xd
+	.byte	0x47
+	.byte	0xe
+	.long	0xe5
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2281
+	.byte	0xd
+	.byte	0x49
+	.byte	0xe
+	.long	0xe5
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2282
+	.byte	0xd
+	.byte	0x4a
+	.byte	0xe
+	.long	0xe5
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2283
+	.byte	0xd
+	.byte	0x4b
+	.byte	0x17
+	.long	0xaf0
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2284
+	.byte	0xd
+	.byte	0x4c
+	.byte	0x17
+	.long	0xaf0
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2285
+	.byte	0xd
+	.byte	0x4d
+	.byte	0xe
+	.long	0xe5
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2286
+	.byte	0xd
+	.byte	0x4e
+	.byte	0xe
+	.long	0xe5
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2287
+	.byte	0xd
+	.byte	0x4f
+	.byte	0xe
+	.long	0xe5
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2288
+	.byte	0xd
+	.byte	0x50
+	.byte	0xe
+	.long	0xe5
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2289
+	.byte	0xd
+	.byte	0x52
+	.byte	0x1e
+	.long	0x8fd
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2290
+	.byte	0xd
+	.byte	0x53
+	.byte	0xb
+	.long	0xa2
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2291
+	.byte	0xd
+	.byte	0x55
+	.byte	0x23
+	.long	0x91e
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2292
+	.byte	0xd
+	.byte	0x58
+	.byte	0xe
+	.long	0xe5
+	.byte	0x58
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2293
+	.byte	0x68
+	.byte	0xd
+	.byte	0x5b
+	.byte	0x8
+	.long	0xae6
+	.uleb128 0x2
+	.long	.LASF2294
+	.byte	0xd
+	.byte	0x5c
+	.byte	0xc
+	.long	0xb1b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2295
+	.byte	0xd
+	.byte	0x5e
+	.byte	0x10
+	.long	0xb34
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2296
+	.byte	0xd
+	.byte	0x5f
+	.byte	0x10
+	.long	0xb34
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2297
+	.byte	0xd
+	.byte	0x61
+	.byte	0xf
+	.long	0xb48
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2298
+	.byte	0xd
+	.byte	0x64
+	.byte	0xc
+	.long	0xb5d
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2299
+	.byte	0xd
+	.byte	0x66
+	.byte	0xb
+	.long	0xb71
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2300
+	.byte	0xd
+	.byte	0x68
+	.byte	0xc
+	.long	0xb86
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2301
+	.byte	0xd
+	.byte	0x6a
+	.byte	0xc
+	.long	0xba6
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2302
+	.byte	0xd
+	.byte	0x6c
+	.byte	0xb
+	.long	0xb71
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2303
+	.byte	0xd
+	.byte	0x6e
+	.byte	0xb
+	.long	0xbba
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2304
+	.byte	0xd
+	.byte	0x71
+	.byte	0xc
+	.long	0xbca
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2305
+	.byte	0xd
+	.byte	0x72
+	.byte	0xc
+	.long	0xbca
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2306
+	.byte	0xd
+	.byte	0x75
+	.byte	0xc
+	.long	0xbe9
+	.byte	0x60
+	.byte	0
+	.uleb128 0xd
+	.long	0xa2f
+	.uleb128 0x7
+	.long	0xae6
+	.uleb128 0x7
+	.long	0xd4
+	.uleb128 0x3
+	.long	.LASF2307
+	.byte	0xd
+	.byte	0x59
+	.byte	0x3
+	.long	0x944
+	.uleb128 0xd
+	.long	0xaf5
+	.uleb128 0xf
+	.long	0xb16
+	.uleb128 0x4
+	.long	0xb16
+	.uleb128 0x4
+	.long	0xc3
+	.byte	0
+	.uleb128 0x7
+	.long	0xaf5
+	.uleb128 0x7
+	.long	0xb06
+	.uleb128 0x17
+	.long	0xe5
+	.long	0xb2f
+	.uleb128 0x4
+	.long	0xb2f
+	.byte	0
+	.uleb128 0x7
+	.long	0xb01
+	.uleb128 0x7
+	.long	0xb20
+	.uleb128 0x17
+	.long	0xc3
+	.long	0xb48
+	.uleb128 0x4
+	.long	0xb16
+	.byte	0
+	.uleb128 0x7
+	.long	0xb39
+	.uleb128 0xf
+	.long	0xb5d
+	.uleb128 0x4
+	.long	0xb16
+	.uleb128 0x4
+	.long	0xe5
+	.byte	0
+	.uleb128 0x7
+	.long	0xb4d
+	.uleb128 0x17
+	.long	0x46e
+	.long	0xb71
+	.uleb128 0x4
+	.long	0xb2f
+	.byte	0
+	.uleb128 0x7
+	.long	0xb62
+	.uleb128 0xf
+	.long	0xb86
+	.uleb128 0x4
+	.long	0xb16
+	.uleb128 0x4
+	.long	0x85b
+	.byte	0
+	.uleb128 0x7
+	.long	0xb76
+	.uleb128 0xf
+	.long	0xba0
+	.uleb128 0x4
+	.long	0xb16
+	.uleb128 0x4
+	.long	0xba0
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x7
+	.long	0xba5
+	.uleb128 0x30
+	.uleb128 0x7
+	.long	0xb8b
+	.uleb128 0x17
+	.long	0x46e
+	.long	0xbba
+	.uleb128 0x4
+	.long	0xb16
+	.byte	0
+	.uleb128 0x7
+	.long	0xbab
+	.uleb128 0xf
+	.long	0xbca
+	.uleb128 0x4
+	.long	0xb16
+	.byte	0
+	.uleb128 0x7
+	.long	0xbbf
+	.uleb128 0xf
+	.long	0xbe4
+	.uleb128 0x4
+	.long	0xb16
+	.uleb128 0x4
+	.long	0xbe4
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x7
+	.long	0x8f8
+	.uleb128 0x7
+	.long	0xbcf
+	.uleb128 0x31
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xe
+	.byte	0x15
+	.long	0xcbb
+	.uleb128 0x1
+	.long	.LASF2308
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2309
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2310
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2311
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2312
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2313
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF2314
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF2315
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF2316
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF2317
+	.value	0x4000
+	.uleb128 0x6
+	.long	.LASF2318
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF2319
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF2320
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF2321
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF2322
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF2323
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF2324
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF2325
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF2326
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF2327
+	.long	0x1000000
+	.uleb128 0x5
+	.long	.LASF2328
+	.long	0x2000000
+	.uleb128 0x5
+	.long	.LASF2329
+	.long	0x4000000
+	.uleb128 0x5
+	.long	.LASF2330
+	.long	0x8000000
+	.uleb128 0x5
+	.long	.LASF2331
+	.long	0xfffff80
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2357
+	.byte	0xe
+	.byte	0x47
+	.byte	0x11
+	.long	0xe5
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xe
+	.byte	0x6c
+	.long	0xd8d
+	.uleb128 0x1
+	.long	.LASF2332
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2333
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2334
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2336
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2337
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2338
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2339
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2340
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2341
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2342
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF2343
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF2344
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF2345
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF2346
+	.value	0x4000
+	.uleb128 0x6
+	.long	.LASF2347
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF2348
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF2349
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF2350
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF2351
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF2352
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF2353
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF2354
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF2355
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF2356
+	.long	0x1000000
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2358
+	.byte	0xe
+	.byte	0x8c
+	.byte	0x11
+	.long	0xe5
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x14
+	.long	0xdd6
+	.uleb128 0x1
+	.long	.LASF2359
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2360
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2361
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2362
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2363
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2364
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2365
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0x7
+	.byte	0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0xf
+	.byte	0x30
+	.long	0xe21
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2375
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2376
+	.value	0x200
+	.byte	0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x20
+	.long	0xedb
+	.uleb128 0x1
+	.long	.LASF2377
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2378
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2379
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2380
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2381
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2386
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2387
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2388
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF2389
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF2390
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF2391
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF2392
+	.value	0x4000
+	.uleb128 0x6
+	.long	.LASF2393
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF2394
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF2395
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF2396
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF2397
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF2398
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF2399
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF2400
+	.long	0x400000
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2401
+	.byte	0x10
+	.byte	0x39
+	.byte	0x3
+	.long	0xe21
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x10
+	.byte	0x3b
+	.long	0xf5a
+	.uleb128 0x1
+	.long	.LASF2402
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2403
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2404
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2405
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2406
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2407
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2408
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2409
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2410
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2411
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2412
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2413
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2414
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2416
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2417
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2418
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2419
+	.byte	0x10
+	.byte	0x4d
+	.byte	0x3
+	.long	0xee7
+	.uleb128 0x13
+	.long	0xf1
+	.long	0xf71
+	.uleb128 0x32
+	.byte	0
+	.uleb128 0xd
+	.long	0xf66
+	.uleb128 0xa
+	.long	.LASF2420
+	.byte	0x10
+	.byte	0x4f
+	.byte	0x17
+	.long	0xf71
+	.uleb128 0x8
+	.byte	0x5
+	.long	0x7c
+	.byte	0x10
+	.byte	0x52
+	.long	0xfdd
+	.uleb128 0x33
+	.long	.LASF2421
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2422
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2423
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2424
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2425
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2426
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2427
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2428
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2429
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2430
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2431
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2432
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2434
+	.byte	0x10
+	.byte	0x60
+	.byte	0x3
+	.long	0xf82
+	.uleb128 0x9
+	.long	.LASF2435
+	.byte	0xc
+	.byte	0x10
+	.byte	0x73
+	.byte	0x10
+	.long	0x1045
+	.uleb128 0x2
+	.long	.LASF2436
+	.byte	0x10
+	.byte	0x74
+	.byte	0xe
+	.long	0xe5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2277
+	.byte	0x10
+	.byte	0x75
+	.byte	0x1c
+	.long	0xfdd
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2437
+	.byte	0x10
+	.byte	0x76
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2438
+	.byte	0x10
+	.byte	0x77
+	.byte	0xd
+	.long	0xc3
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2439
+	.byte	0x10
+	.byte	0x78
+	.byte	0xd
+	.long	0xc3
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2440
+	.byte	0x10
+	.byte	0x79
+	.byte	0xd
+	.long	0xc3
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2441
+	.byte	0x10
+	.byte	0x7a
+	.byte	0x3
+	.long	0xfe9
+	.uleb128 0x9
+	.long	.LASF2442
+	.byte	0x64
+	.byte	0x10
+	.byte	0x7c
+	.byte	0x10
+	.long	0x1079
+	.uleb128 0x2
+	.long	.LASF2443
+	.byte	0x10
+	.byte	0x7d
+	.byte	0x18
+	.long	0x1079
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2444
+	.byte	0x10
+	.byte	0x7e
+	.byte	0xd
+	.long	0xc3
+	.byte	0x60
+	.byte	0
+	.uleb128 0x13
+	.long	0x1045
+	.long	0x1089
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2445
+	.byte	0x10
+	.byte	0x7f
+	.byte	0x3
+	.long	0x1051
+	.uleb128 0xd
+	.long	0x1089
+	.uleb128 0xa
+	.long	.LASF2446
+	.byte	0x10
+	.byte	0x81
+	.byte	0x17
+	.long	0x1089
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x11
+	.byte	0x22
+	.long	0x10dd
+	.uleb128 0x1
+	.long	.LASF2447
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2448
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2449
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2450
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2451
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2452
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2453
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2454
+	.byte	0x11
+	.byte	0x2a
+	.byte	0x3
+	.long	0x10a6
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x11
+	.byte	0x2c
+	.long	0x111a
+	.uleb128 0x1
+	.long	.LASF2455
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2456
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2457
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2458
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2459
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2460
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2461
+	.byte	0x11
+	.byte	0x33
+	.byte	0x3
+	.long	0x10e9
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x11
+	.byte	0x37
+	.long	0x1157
+	.uleb128 0x1
+	.long	.LASF2462
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2463
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2464
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2465
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2466
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2467
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2468
+	.byte	0x11
+	.byte	0x3e
+	.byte	0x3
+	.long	0x1126
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x11
+	.byte	0x40
+	.long	0x117c
+	.uleb128 0x1
+	.long	.LASF2469
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2470
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2471
+	.byte	0x11
+	.byte	0x43
+	.byte	0x3
+	.long	0x1163
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x11
+	.byte	0x45
+	.long	0x11a1
+	.uleb128 0x1
+	.long	.LASF2472
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2473
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2474
+	.byte	0x11
+	.byte	0x48
+	.byte	0x3
+	.long	0x1188
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x11
+	.byte	0x4a
+	.long	0x11cc
+	.uleb128 0x1
+	.long	.LASF2475
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2476
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2477
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2478
+	.byte	0x11
+	.byte	0x4e
+	.byte	0x3
+	.long	0x11ad
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x11
+	.byte	0x50
+	.long	0x11f7
+	.uleb128 0x1
+	.long	.LASF2479
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2480
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2481
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2482
+	.byte	0x11
+	.byte	0x54
+	.byte	0x3
+	.long	0x11d8
+	.uleb128 0x9
+	.long	.LASF2483
+	.byte	0x18
+	.byte	0x11
+	.byte	0x58
+	.byte	0x10
+	.long	0x126c
+	.uleb128 0x2
+	.long	.LASF2484
+	.byte	0x11
+	.byte	0x59
+	.byte	0x13
+	.long	0x10dd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2485
+	.byte	0x11
+	.byte	0x5a
+	.byte	0x10
+	.long	0x111a
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2486
+	.byte	0x11
+	.byte	0x5b
+	.byte	0x15
+	.long	0x117c
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2487
+	.byte	0x11
+	.byte	0x5c
+	.byte	0x13
+	.long	0x11a1
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2488
+	.byte	0x11
+	.byte	0x5d
+	.byte	0x13
+	.long	0x11cc
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2489
+	.byte	0x11
+	.byte	0x5e
+	.byte	0x9
+	.long	0x46e
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2490
+	.byte	0x11
+	.byte	0x5f
+	.byte	0xd
+	.long	0xc3
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2491
+	.byte	0x11
+	.byte	0x60
+	.byte	0x3
+	.long	0x1203
+	.uleb128 0xd
+	.long	0x126c
+	.uleb128 0xa
+	.long	.LASF2492
+	.byte	0x11
+	.byte	0x62
+	.byte	0x14
+	.long	0x126c
+	.uleb128 0xa
+	.long	.LASF2493
+	.byte	0x11
+	.byte	0x62
+	.byte	0x39
+	.long	0x126c
+	.uleb128 0x9
+	.long	.LASF2494
+	.byte	0xc
+	.byte	0x11
+	.byte	0x6a
+	.byte	0x10
+	.long	0x12ca
+	.uleb128 0xc
+	.string	"lat"
+	.byte	0x11
+	.byte	0x6b
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0xc
+	.string	"lon"
+	.byte	0x11
+	.byte	0x6c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0xc
+	.string	"alt"
+	.byte	0x11
+	.byte	0x6d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2495
+	.byte	0x11
+	.byte	0x6e
+	.byte	0x3
+	.long	0x1295
+	.uleb128 0x12
+	.byte	0x7
+	.byte	0x11
+	.byte	0x73
+	.byte	0x5
+	.long	0x133b
+	.uleb128 0x2
+	.long	.LASF2496
+	.byte	0x11
+	.byte	0x74
+	.byte	0xd
+	.long	0x46e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2497
+	.byte	0x11
+	.byte	0x75
+	.byte	0xd
+	.long	0x46e
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2498
+	.byte	0x11
+	.byte	0x76
+	.byte	0xd
+	.long	0x46e
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2499
+	.byte	0x11
+	.byte	0x77
+	.byte	0xd
+	.long	0x46e
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2500
+	.byte	0x11
+	.byte	0x78
+	.byte	0xd
+	.long	0x46e
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2501
+	.byte	0x11
+	.byte	0x79
+	.byte	0xd
+	.long	0x46e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2502
+	.byte	0x11
+	.byte	0x7a
+	.byte	0xd
+	.long	0x46e
+	.byte	0x6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2503
+	.byte	0x3c
+	.byte	0x11
+	.byte	0x72
+	.byte	0x10
+	.long	0x13e5
+	.uleb128 0x2
+	.long	.LASF2221
+	.byte	0x11
+	.byte	0x7b
+	.byte	0x7
+	.long	0x12d6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2504
+	.byte	0x11
+	.byte	0x7d
+	.byte	0x12
+	.long	0x11f7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2505
+	.byte	0x11
+	.byte	0x7e
+	.byte	0xd
+	.long	0xc3
+	.byte	0xc
+	.uleb128 0xc
+	.string	"llh"
+	.byte	0x11
+	.byte	0x80
+	.byte	0x13
+	.long	0x12ca
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2506
+	.byte	0x11
+	.byte	0x81
+	.byte	0xd
+	.long	0x81e
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2507
+	.byte	0x11
+	.byte	0x82
+	.byte	0xd
+	.long	0x81e
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2508
+	.byte	0x11
+	.byte	0x84
+	.byte	0xd
+	.long	0xab
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2509
+	.byte	0x11
+	.byte	0x85
+	.byte	0xd
+	.long	0xab
+	.byte	0x2a
+	.uleb128 0xc
+	.string	"eph"
+	.byte	0x11
+	.byte	0x87
+	.byte	0xe
+	.long	0xd9
+	.byte	0x2c
+	.uleb128 0xc
+	.string	"epv"
+	.byte	0x11
+	.byte	0x88
+	.byte	0xe
+	.long	0xd9
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2510
+	.byte	0x11
+	.byte	0x8a
+	.byte	0xe
+	.long	0xd9
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2511
+	.byte	0x11
+	.byte	0x8c
+	.byte	0x10
+	.long	0x27e
+	.byte	0x32
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2512
+	.byte	0x11
+	.byte	0x8e
+	.byte	0x3
+	.long	0x133b
+	.uleb128 0x12
+	.byte	0x10
+	.byte	0x11
+	.byte	0x90
+	.byte	0x9
+	.long	0x142f
+	.uleb128 0x2
+	.long	.LASF2513
+	.byte	0x11
+	.byte	0x91
+	.byte	0xe
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2514
+	.byte	0x11
+	.byte	0x92
+	.byte	0xe
+	.long	0xe5
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2515
+	.byte	0x11
+	.byte	0x93
+	.byte	0xe
+	.long	0xe5
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2516
+	.byte	0x11
+	.byte	0x94
+	.byte	0xe
+	.long	0xe5
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2517
+	.byte	0x11
+	.byte	0x95
+	.byte	0x3
+	.long	0x13f1
+	.uleb128 0xa
+	.long	.LASF2518
+	.byte	0x11
+	.byte	0x97
+	.byte	0x1a
+	.long	0x13e5
+	.uleb128 0xa
+	.long	.LASF2519
+	.byte	0x11
+	.byte	0x98
+	.byte	0x18
+	.long	0x142f
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x12
+	.byte	0x21
+	.long	0x1478
+	.uleb128 0x1
+	.long	.LASF2520
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2521
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2522
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2523
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2524
+	.byte	0x12
+	.byte	0x26
+	.byte	0x3
+	.long	0x1453
+	.uleb128 0x12
+	.byte	0x40
+	.byte	0x12
+	.byte	0x28
+	.byte	0x9
+	.long	0x152a
+	.uleb128 0x2
+	.long	.LASF2525
+	.byte	0x12
+	.byte	0x29
+	.byte	0x19
+	.long	0x152a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2526
+	.byte	0x12
+	.byte	0x2a
+	.byte	0x1c
+	.long	0x152f
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2527
+	.byte	0x12
+	.byte	0x2b
+	.byte	0x14
+	.long	0xb16
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2528
+	.byte	0x12
+	.byte	0x2d
+	.byte	0xe
+	.long	0xe5
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2529
+	.byte	0x12
+	.byte	0x2f
+	.byte	0x10
+	.long	0x1478
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2530
+	.byte	0x12
+	.byte	0x30
+	.byte	0x13
+	.long	0x1157
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2531
+	.byte	0x12
+	.byte	0x31
+	.byte	0x13
+	.long	0x1157
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2532
+	.byte	0x12
+	.byte	0x32
+	.byte	0xd
+	.long	0xc3
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2533
+	.byte	0x12
+	.byte	0x34
+	.byte	0xe
+	.long	0x1fd
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2534
+	.byte	0x12
+	.byte	0x35
+	.byte	0xe
+	.long	0x1fd
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2535
+	.byte	0x12
+	.byte	0x36
+	.byte	0xe
+	.long	0x1fd
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2536
+	.byte	0x12
+	.byte	0x37
+	.byte	0xe
+	.long	0x1fd
+	.byte	0x38
+	.byte	0
+	.uleb128 0x7
+	.long	0x1278
+	.uleb128 0x7
+	.long	0x1095
+	.uleb128 0x3
+	.long	.LASF2537
+	.byte	0x12
+	.byte	0x38
+	.byte	0x3
+	.long	0x1484
+	.uleb128 0xa
+	.long	.LASF2538
+	.byte	0x12
+	.byte	0x3a
+	.byte	0x1a
+	.long	0x1534
+	.uleb128 0x13
+	.long	0xf5a
+	.long	0x155c
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2539
+	.byte	0x12
+	.byte	0x3c
+	.byte	0x13
+	.long	0x154c
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x13
+	.byte	0x16
+	.long	0x1593
+	.uleb128 0x1
+	.long	.LASF2540
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2541
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2542
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2543
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2544
+	.byte	0x4
+	.byte	0
+	.uleb128 0x8
+	.byte	0x7
+	.long	0x30
+	.byte	0x14
+	.byte	0x26
+	.long	0x168f
+	.uleb128 0x1
+	.long	.LASF2545
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2546
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2547
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2548
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2549
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2550
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2551
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2552
+	.byte	0x80
+	.uleb128 0x6
+	.long	.LASF2553
+	.value	0x100
+	.uleb128 0x6
+	.long	.LASF2554
+	.value	0x200
+	.uleb128 0x6
+	.long	.LASF2555
+	.value	0x400
+	.uleb128 0x6
+	.long	.LASF2556
+	.value	0x800
+	.uleb128 0x6
+	.long	.LASF2557
+	.value	0x1000
+	.uleb128 0x6
+	.long	.LASF2558
+	.value	0x2000
+	.uleb128 0x6
+	.long	.LASF2559
+	.value	0x4000
+	.uleb128 0x6
+	.long	.LASF2560
+	.value	0x8000
+	.uleb128 0x5
+	.long	.LASF2561
+	.long	0x10000
+	.uleb128 0x5
+	.long	.LASF2562
+	.long	0x20000
+	.uleb128 0x5
+	.long	.LASF2563
+	.long	0x40000
+	.uleb128 0x5
+	.long	.LASF2564
+	.long	0x80000
+	.uleb128 0x5
+	.long	.LASF2565
+	.long	0x100000
+	.uleb128 0x5
+	.long	.LASF2566
+	.long	0x200000
+	.uleb128 0x5
+	.long	.LASF2567
+	.long	0x400000
+	.uleb128 0x5
+	.long	.LASF2568
+	.long	0x800000
+	.uleb128 0x5
+	.long	.LASF2569
+	.long	0x1000000
+	.uleb128 0x5
+	.long	.LASF2570
+	.long	0x2000000
+	.uleb128 0x5
+	.long	.LASF2571
+	.long	0x4000000
+	.uleb128 0x5
+	.long	.LASF2572
+	.long	0x8000000
+	.uleb128 0x5
+	.long	.LASF2573
+	.long	0x10000000
+	.uleb128 0x5
+	.long	.LASF2574
+	.long	0x20000000
+	.uleb128 0x5
+	.long	.LASF2575
+	.long	0x40000000
+	.byte	0
+	.uleb128 0x12
+	.byte	0x18
+	.byte	0x15
+	.byte	0x3e
+	.byte	0x9
+	.long	0x16cd
+	.uleb128 0x2
+	.long	.LASF2576
+	.byte	0x15
+	.byte	0x3f
+	.byte	0x10
+	.long	0x85b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2577
+	.byte	0x15
+	.byte	0x40
+	.byte	0x18
+	.long	0x46e
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2578
+	.byte	0x15
+	.byte	0x41
+	.byte	0xc
+	.long	0x16cd
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2579
+	.byte	0x15
+	.byte	0x42
+	.byte	0xc
+	.long	0x16cd
+	.byte	0x10
+	.byte	0
+	.uleb128 0x7
+	.long	0xbee
+	.uleb128 0x3
+	.long	.LASF2580
+	.byte	0x15
+	.byte	0x43
+	.byte	0x3
+	.long	0x168f
+	.uleb128 0x15
+	.long	0x1540
+	.byte	0x46
+	.byte	0x13
+	.uleb128 0x15
+	.long	0x1447
+	.byte	0x47
+	.byte	0x11
+	.uleb128 0x15
+	.long	0x143b
+	.byte	0x48
+	.byte	0x13
+	.uleb128 0x15
+	.long	0x155c
+	.byte	0x4b
+	.byte	0xc
+	.uleb128 0x13
+	.long	0x16d2
+	.long	0x170a
+	.uleb128 0x14
+	.long	0x37
+	.byte	0x5
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2614
+	.byte	0x4d
+	.byte	0x20
+	.long	0x16fa
+	.uleb128 0xa
+	.long	.LASF2581
+	.byte	0x15
+	.byte	0x76
+	.byte	0x1a
+	.long	0x1278
+	.uleb128 0x15
+	.long	0x127d
+	.byte	0x76
+	.byte	0x41
+	.uleb128 0x15
+	.long	0x1289
+	.byte	0x76
+	.byte	0x5f
+	.uleb128 0xa
+	.long	.LASF2582
+	.byte	0x15
+	.byte	0x76
+	.byte	0x89
+	.long	0x1f8
+	.uleb128 0x34
+	.long	0x172f
+	.byte	0xb0
+	.uleb128 0x35
+	.long	0x1715
+	.byte	0x78
+	.byte	0x13
+	.uleb128 0xe
+	.long	.LASF2583
+	.byte	0xe
+	.byte	0xa3
+	.byte	0x5
+	.long	0x46e
+	.long	0x175e
+	.uleb128 0x4
+	.long	0xe5
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2294
+	.byte	0xd
+	.byte	0x78
+	.long	0x1774
+	.uleb128 0x4
+	.long	0xb16
+	.uleb128 0x4
+	.long	0xc3
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2297
+	.byte	0xd
+	.byte	0x7e
+	.byte	0x9
+	.long	0xc3
+	.long	0x178a
+	.uleb128 0x4
+	.long	0xb16
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2584
+	.byte	0xd
+	.byte	0x79
+	.byte	0xa
+	.long	0xe5
+	.long	0x17a0
+	.uleb128 0x4
+	.long	0xb2f
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2585
+	.byte	0xd
+	.byte	0x80
+	.long	0x17b6
+	.uleb128 0x4
+	.long	0xb16
+	.uleb128 0x4
+	.long	0x85b
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2586
+	.byte	0x10
+	.byte	0xa5
+	.long	0x17c7
+	.uleb128 0x4
+	.long	0xb16
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2587
+	.byte	0x16
+	.byte	0x9f
+	.byte	0xe
+	.long	0x102
+	.long	0x17dd
+	.uleb128 0x4
+	.long	0x102
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2588
+	.byte	0x17
+	.byte	0x9f
+	.byte	0x7
+	.long	0x102
+	.long	0x17f3
+	.uleb128 0x4
+	.long	0x102
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2589
+	.byte	0x17
+	.byte	0xa0
+	.byte	0x7
+	.long	0x102
+	.long	0x1809
+	.uleb128 0x4
+	.long	0x102
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2603
+	.byte	0x19
+	.byte	0x2b
+	.byte	0x5
+	.long	0x46e
+	.uleb128 0x16
+	.long	.LASF2590
+	.byte	0xe
+	.byte	0xa5
+	.long	0x1826
+	.uleb128 0x4
+	.long	0xe5
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2591
+	.byte	0x18
+	.byte	0x1e
+	.byte	0x5
+	.long	0x46e
+	.long	0x183c
+	.uleb128 0x4
+	.long	0xe5
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2592
+	.byte	0x12
+	.byte	0x4c
+	.byte	0xd
+	.uleb128 0x10
+	.long	.LASF2593
+	.byte	0x12
+	.byte	0x4f
+	.byte	0xd
+	.uleb128 0x10
+	.long	.LASF2594
+	.byte	0x12
+	.byte	0x4e
+	.byte	0xd
+	.uleb128 0x10
+	.long	.LASF2595
+	.byte	0x12
+	.byte	0x48
+	.byte	0xd
+	.uleb128 0x10
+	.long	.LASF2596
+	.byte	0x12
+	.byte	0x47
+	.byte	0xd
+	.uleb128 0x10
+	.long	.LASF2597
+	.byte	0x12
+	.byte	0x4b
+	.byte	0xd
+	.uleb128 0x10
+	.long	.LASF2598
+	.byte	0x12
+	.byte	0x4a
+	.byte	0xd
+	.uleb128 0xe
+	.long	.LASF2599
+	.byte	0x10
+	.byte	0x9a
+	.byte	0xf
+	.long	0xb16
+	.long	0x18a8
+	.uleb128 0x4
+	.long	0xfdd
+	.uleb128 0x4
+	.long	0xedb
+	.uleb128 0x4
+	.long	0x8fd
+	.uleb128 0x4
+	.long	0xa2
+	.uleb128 0x4
+	.long	0xe5
+	.uleb128 0x4
+	.long	0x85b
+	.uleb128 0x4
+	.long	0x8b8
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2600
+	.byte	0x10
+	.byte	0x8f
+	.byte	0x15
+	.long	0x18be
+	.long	0x18be
+	.uleb128 0x4
+	.long	0xedb
+	.byte	0
+	.uleb128 0x7
+	.long	0x1045
+	.uleb128 0x16
+	.long	.LASF2601
+	.byte	0x18
+	.byte	0x20
+	.long	0x18d4
+	.uleb128 0x4
+	.long	0xe5
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2602
+	.byte	0x5
+	.byte	0x6d
+	.byte	0x5
+	.long	0x46e
+	.long	0x18ea
+	.uleb128 0x4
+	.long	0x18ea
+	.byte	0
+	.uleb128 0x7
+	.long	0x27e
+	.uleb128 0x1d
+	.long	.LASF2604
+	.byte	0x5
+	.byte	0x66
+	.byte	0x5
+	.long	0x46e
+	.uleb128 0x10
+	.long	.LASF2605
+	.byte	0x1a
+	.byte	0x29
+	.byte	0x6
+	.uleb128 0x16
+	.long	.LASF2606
+	.byte	0xe
+	.byte	0xa4
+	.long	0x1914
+	.uleb128 0x4
+	.long	0xe5
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2095
+	.byte	0x1b
+	.byte	0x1d
+	.byte	0xa
+	.long	0x1fd
+	.uleb128 0x1e
+	.long	.LASF2607
+	.value	0x1d7
+	.long	0x46e
+	.uleb128 0x1e
+	.long	.LASF2608
+	.value	0x1d2
+	.long	0x46e
+	.uleb128 0x18
+	.long	.LASF2609
+	.value	0x1c3
+	.byte	0x5
+	.long	0x46e
+	.long	0x1953
+	.uleb128 0x25
+	.string	"mag"
+	.value	0x1c3
+	.byte	0x1c
+	.long	0x1953
+	.byte	0
+	.uleb128 0x7
+	.long	0x82e
+	.uleb128 0x18
+	.long	.LASF2610
+	.value	0x1bb
+	.byte	0x5
+	.long	0x46e
+	.long	0x1975
+	.uleb128 0x19
+	.long	.LASF2611
+	.value	0x1bb
+	.byte	0x1a
+	.long	0x1953
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2612
+	.value	0x1b5
+	.byte	0x5
+	.long	0x46e
+	.long	0x1992
+	.uleb128 0x19
+	.long	.LASF2611
+	.value	0x1b5
+	.byte	0x1a
+	.long	0x1953
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2616
+	.value	0x1ab
+	.long	0x19b6
+	.uleb128 0x19
+	.long	.LASF2613
+	.value	0x1ab
+	.byte	0x22
+	.long	0x209
+	.uleb128 0x11
+	.long	.LASF2615
+	.value	0x1ad
+	.byte	0x15
+	.long	0x209
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2617
+	.value	0x18f
+	.long	0x19d8
+	.uleb128 0x19
+	.long	.LASF2618
+	.value	0x18f
+	.byte	0x29
+	.long	0xb16
+	.uleb128 0x1b
+	.string	"c"
+	.value	0x19a
+	.byte	0xa
+	.long	0xa4
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2619
+	.value	0x14c
+	.long	0x46e
+	.uleb128 0x18
+	.long	.LASF2620
+	.value	0x147
+	.byte	0xa
+	.long	0xd9
+	.long	0x1a00
+	.uleb128 0x19
+	.long	.LASF2510
+	.value	0x147
+	.byte	0x24
+	.long	0xe5
+	.byte	0
+	.uleb128 0x18
+	.long	.LASF2621
+	.value	0x142
+	.byte	0xa
+	.long	0xd9
+	.long	0x1a1d
+	.uleb128 0x25
+	.string	"epe"
+	.value	0x142
+	.byte	0x23
+	.long	0xe5
+	.byte	0
+	.uleb128 0x36
+	.long	.LASF2638
+	.byte	0x15
+	.byte	0xff
+	.byte	0xc
+	.long	0x46e
+	.long	0x1aa8
+	.uleb128 0x1b
+	.string	"lat"
+	.value	0x10c
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0x1b
+	.string	"lon"
+	.value	0x10d
+	.byte	0x14
+	.long	0xb7
+	.uleb128 0x1b
+	.string	"now"
+	.value	0x10f
+	.byte	0xe
+	.long	0x1fd
+	.uleb128 0x11
+	.long	.LASF2622
+	.value	0x110
+	.byte	0xe
+	.long	0xe5
+	.uleb128 0x37
+	.uleb128 0x11
+	.long	.LASF2623
+	.value	0x112
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x11
+	.long	.LASF2624
+	.value	0x113
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x11
+	.long	.LASF2625
+	.value	0x114
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x11
+	.long	.LASF2626
+	.value	0x115
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x11
+	.long	.LASF2627
+	.value	0x116
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x11
+	.long	.LASF2628
+	.value	0x117
+	.byte	0x11
+	.long	0xb7
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2629
+	.byte	0xcc
+	.long	0x1ad4
+	.uleb128 0x1a
+	.long	.LASF2630
+	.byte	0xdf
+	.byte	0x1a
+	.long	0x18be
+	.uleb128 0x1a
+	.long	.LASF2530
+	.byte	0xe6
+	.byte	0x9
+	.long	0x7c
+	.uleb128 0x1a
+	.long	.LASF2278
+	.byte	0xf2
+	.byte	0x10
+	.long	0x85b
+	.byte	0
+	.uleb128 0x27
+	.long	.LASF2631
+	.byte	0xc6
+	.uleb128 0x28
+	.long	.LASF2634
+	.byte	0xb8
+	.uleb128 0x27
+	.long	.LASF2632
+	.byte	0x96
+	.uleb128 0x1f
+	.long	.LASF2633
+	.byte	0x8f
+	.long	0x1afc
+	.uleb128 0x29
+	.long	.LASF2536
+	.byte	0x8f
+	.byte	0x25
+	.long	0x1fd
+	.byte	0
+	.uleb128 0x28
+	.long	.LASF2635
+	.byte	0x88
+	.uleb128 0x1f
+	.long	.LASF2636
+	.byte	0x82
+	.long	0x1b18
+	.uleb128 0x29
+	.long	.LASF2529
+	.byte	0x82
+	.byte	0x1d
+	.long	0x1478
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF2525
+	.byte	0x11
+	.byte	0x62
+	.byte	0x6a
+	.long	0x152a
+	.uleb128 0x2a
+	.long	.LASF2526
+	.byte	0x10
+	.byte	0x81
+	.byte	0x79
+	.long	0x152f
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x17
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 0
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 10
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 21
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x32
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x33
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x34
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x35
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x36
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x37
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 28 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 29 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 30 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x1e
+	.file 31 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x20
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 33 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 34 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x22
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 37 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 39 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x27
+	.file 40 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 44 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xed
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF730
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x30
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF731
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 49 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x32
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1045
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1072
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x38
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 57 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x39
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 58 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3a
+	.file 59 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x3b
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 60 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x3c
+	.file 61 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 62 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x3e
+	.byte	0x4
+	.file 63 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.file 64 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 65 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x41
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x5
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 66 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x42
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.file 67 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xc
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x7
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0xb
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x9
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1571
+	.byte	0x4
+	.file 68 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x44
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1572
+	.file 69 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x45
+	.byte	0x4
+	.byte	0x4
+	.file 70 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x46
+	.file 71 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x47
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1585
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 72 "./src/main/drivers/light_led.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xd
+	.file 73 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.file 74 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x4a
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 75 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF2001
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x1b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x30
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 76 "./src/main/sensors/compass.h"
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0x4c
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x33
+	.uleb128 0x10
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x34
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x35
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x37
+	.uleb128 0x1a
+	.file 77 "./src/main/common/filter.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x4d
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x18
+	.byte	0x4
+	.file 78 "./src/main/flight/failsafe.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x4e
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x3b
+	.uleb128 0x14
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2042
+	.byte	0x4
+	.file 79 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4f
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2043
+	.byte	0x4
+	.file 80 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x50
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF2049
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF2051
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF703
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF705
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.a617e65eb66869c389e597be8bb95a7c,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.241.7270a880a9a032c7121aef6d31a9a9f4,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1037
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1044
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1066
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1071
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1074
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1076
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1091
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1091
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1101
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1104
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1104
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1104
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1104
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1104
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1114
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1116
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1124
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1126
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1128
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1165
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1290
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1307
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1308
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1313
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1336
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1345
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1356
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1357
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1358
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1359
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1375
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1377
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1383
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1420
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1430
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1432
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1468
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1471
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1499
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1568
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1570
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1584
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1602
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.light_led.h.20.ee45acdfc1bcd9ce748b7901bfda3b6c,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1612
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1620
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1632
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF2000
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2012
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.sensors.h.42.8e2e5ec4be4bbc896da78d2242718f91,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2016
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2024
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps_private.h.24.b24872bc41c5679001c816204a4672e9,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2025
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2026
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2027
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2030
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.failsafe.h.22.140e1ec7a9053e418edf91ed9225abd7,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2038
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.navigation.h.45.0f10867a279ad1b6ab87c1e7e207ac26,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF2041
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2046
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x14
+	.long	.LASF1
+	.long	.LASF2639
+	.long	.LASF2640
+	.long	.LASF2641
+	.long	.LASF2642
+	.long	.LASF2643
+	.long	.LASF2644
+	.long	.LASF2645
+	.long	.LASF2646
+	.long	.LASF2647
+	.long	.LASF2648
+	.long	.LASF2649
+	.long	.LASF2650
+	.long	.LASF2651
+	.long	.LASF2652
+	.long	.LASF2653
+	.long	.LASF2654
+	.long	.LASF2655
+	.long	.LASF2656
+	.long	.LASF2657
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x51
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2658
+	.byte	0xf
+	.long	.LASF2659
+	.byte	0xf
+	.long	.LASF2660
+	.byte	0xf
+	.long	.LASF2661
+	.byte	0x3
+	.long	.LASF2662
+	.byte	0x2
+	.long	.LASF2663
+	.byte	0x2
+	.long	.LASF2664
+	.byte	0x2
+	.long	.LASF2665
+	.byte	0x5
+	.long	.LASF2666
+	.byte	0x5
+	.long	.LASF2667
+	.byte	0x5
+	.long	.LASF2668
+	.byte	0x5
+	.long	.LASF2669
+	.byte	0x4
+	.long	.LASF2670
+	.byte	0x5
+	.long	.LASF2671
+	.byte	0x6
+	.long	.LASF2672
+	.byte	0xa
+	.long	.LASF2670
+	.byte	0x8
+	.long	.LASF2673
+	.byte	0x8
+	.long	.LASF2674
+	.byte	0x8
+	.long	.LASF2675
+	.byte	0x5
+	.long	.LASF2676
+	.byte	0x6
+	.long	.LASF2677
+	.byte	0x8
+	.long	.LASF2678
+	.byte	0xf
+	.long	.LASF2679
+	.byte	0x2
+	.long	.LASF2680
+	.byte	0x3
+	.long	.LASF2681
+	.byte	0x5
+	.long	.LASF2682
+	.byte	0x9
+	.long	.LASF2662
+	.byte	0x5
+	.long	.LASF2683
+	.byte	0x12
+	.long	.LASF2684
+	.byte	0x13
+	.long	.LASF2685
+	.byte	0x13
+	.long	.LASF2685
+	.byte	0x12
+	.long	.LASF2686
+	.byte	0xf
+	.long	.LASF2687
+	.byte	0x12
+	.long	.LASF2688
+	.byte	0x12
+	.long	.LASF2689
+	.byte	0xf
+	.long	.LASF2690
+	.byte	0xf
+	.long	.LASF2691
+	.byte	0x11
+	.long	.LASF2692
+	.byte	0xf
+	.long	.LASF2693
+	.byte	0x10
+	.long	.LASF2694
+	.byte	0x10
+	.long	.LASF2695
+	.byte	0xf
+	.long	.LASF2696
+	.byte	0xf
+	.long	.LASF2697
+	.byte	0xf
+	.long	.LASF2698
+	.byte	0x12
+	.long	.LASF2699
+	.byte	0xf
+	.long	.LASF2700
+	.byte	0xf
+	.long	.LASF2701
+	.byte	0xe
+	.long	.LASF2702
+	.byte	0xe
+	.long	.LASF2703
+	.byte	0x12
+	.long	.LASF2704
+	.byte	0xf
+	.long	.LASF2705
+	.byte	0xf
+	.long	.LASF2706
+	.byte	0xf
+	.long	.LASF2707
+	.byte	0xf
+	.long	.LASF2708
+	.byte	0xf
+	.long	.LASF2709
+	.byte	0xf
+	.long	.LASF2710
+	.byte	0xf
+	.long	.LASF2711
+	.byte	0xf
+	.long	.LASF2712
+	.byte	0xd
+	.long	.LASF2713
+	.byte	0xc
+	.long	.LASF2714
+	.byte	0xb
+	.long	.LASF2715
+	.byte	0x13
+	.long	.LASF2716
+	.byte	0xc
+	.long	.LASF2717
+	.byte	0xc
+	.long	.LASF2718
+	.byte	0x1
+	.long	.LASF2719
+	.byte	0x1
+	.long	.LASF2720
+	.byte	0x2
+	.long	.LASF2721
+	.byte	0x3
+	.long	.LASF2722
+	.byte	0x5
+	.long	.LASF2723
+	.byte	0x5
+	.long	.LASF2724
+	.byte	0x5
+	.long	.LASF2725
+	.byte	0x5
+	.long	.LASF2726
+	.byte	0x5
+	.long	.LASF2727
+	.byte	0x5
+	.long	.LASF2728
+	.byte	0x5
+	.long	.LASF2729
+	.byte	0x5
+	.long	.LASF2669
+	.byte	0xa
+	.long	.LASF2730
+	.byte	0x2
+	.long	.LASF2731
+	.byte	0x7
+	.long	.LASF2732
+	.byte	0x5
+	.long	.LASF2733
+	.byte	0x6
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1756:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1992:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1221:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF2439:
+	.string	"peripheral_baudrateIndex"
+.LASF1343:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF799:
+	.string	"__DECL_SIMD_logf "
+.LASF1194:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1684:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1004:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1822:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1032:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1170:
+	.string	"USE_RX_PPM "
+.LASF1317:
+	.string	"USE_FAKE_BARO "
+.LASF1722:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1321:
+	.string	"USE_BARO "
+.LASF1224:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1015:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF2332:
+	.string	"GPS_FIX_HOME"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1301:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1244:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF908:
+	.string	"__DECL_SIMD_sinh "
+.LASF1693:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF2566:
+	.string	"FEATURE_TRANSPONDER"
+.LASF1435:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1587:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF1546:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF2125:
+	.string	"OWNER_RX"
+.LASF1328:
+	.string	"USE_UART7 "
+.LASF2444:
+	.string	"reboot_character"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF836:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF758:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF2540:
+	.string	"ADC_BATTERY"
+.LASF2045:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1766:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2300:
+	.string	"setMode"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF699:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF2001:
+	.string	"EXTI_CALLBACK_HANDLER_COUNT 1"
+.LASF1245:
+	.string	"USE_SERIALRX_CRSF "
+.LASF744:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF725:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF2606:
+	.string	"sensorsSet"
+.LASF2582:
+	.string	"gpsConfig_Registry"
+.LASF972:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF952:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF809:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2127:
+	.string	"OWNER_RX_SPI"
+.LASF698:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1398:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF912:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1634:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1028:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1013:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1225:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF2337:
+	.string	"ANTI_WINDUP"
+.LASF2057:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2358:
+	.string	"stateFlags"
+.LASF2276:
+	.string	"vTable"
+.LASF1434:
+	.string	"FAST_MATH "
+.LASF2314:
+	.string	"ARMING_DISABLED_NAVIGATION_UNSAFE"
+.LASF1896:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2159:
+	.string	"_Bool"
+.LASF767:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1841:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF2490:
+	.string	"gpsMinSats"
+.LASF1365:
+	.string	"U_ID_2 2"
+.LASF719:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF2522:
+	.string	"GPS_RUNNING"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2613:
+	.string	"currentTimeUs"
+.LASF1077:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF976:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF818:
+	.string	"__DECL_SIMD_pow "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2093:
+	.string	"minutes"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF2484:
+	.string	"provider"
+.LASF2051:
+	.string	"FAKE_GPS_GROUND_COURSE_DECIDEGREES 300"
+.LASF904:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF956:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF2607:
+	.string	"isGPSHeadingValid"
+.LASF1747:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1569:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF2453:
+	.string	"GPS_PROVIDER_COUNT"
+.LASF1956:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1929:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2364:
+	.string	"SENSOR_INDEX_PITOT"
+.LASF2320:
+	.string	"ARMING_DISABLED_BOXKILLSWITCH"
+.LASF1512:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF752:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF2258:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF2514:
+	.string	"errors"
+.LASF1555:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF2211:
+	.string	"DEVHW_PCA9685"
+.LASF1338:
+	.string	"USE_USB_MSC"
+.LASF1635:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1101:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1919:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1377:
+	.string	"NOINLINE "
+.LASF1599:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF1865:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1382:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1884:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2380:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF2238:
+	.string	"CW270_DEG_FLIP"
+.LASF2577:
+	.string	"hasCompass"
+.LASF2310:
+	.string	"ARMING_DISABLED_FAILSAFE_SYSTEM"
+.LASF813:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1293:
+	.string	"__WCHAR_T__ "
+.LASF1717:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1448:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1988:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF950:
+	.string	"__DECL_SIMD_log2l "
+.LASF2454:
+	.string	"gpsProvider_e"
+.LASF2363:
+	.string	"SENSOR_INDEX_RANGEFINDER"
+.LASF784:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF2593:
+	.string	"gpsHandleNAZA"
+.LASF1228:
+	.string	"USE_CMS "
+.LASF2483:
+	.string	"gpsConfig_s"
+.LASF2491:
+	.string	"gpsConfig_t"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1425:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF2244:
+	.string	"read"
+.LASF2471:
+	.string	"gpsAutoConfig_e"
+.LASF1828:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1141:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF1502:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF2124:
+	.string	"OWNER_LED"
+.LASF772:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2333:
+	.string	"GPS_FIX"
+.LASF2398:
+	.string	"FUNCTION_FRSKY_OSD"
+.LASF2236:
+	.string	"CW90_DEG_FLIP"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2555:
+	.string	"FEATURE_TELEMETRY"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF2604:
+	.string	"rtcHasTime"
+.LASF1254:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF2069:
+	.string	"uint16_t"
+.LASF2149:
+	.string	"RESOURCE_SPI_SCK"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF1444:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF1078:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2419:
+	.string	"baudRate_e"
+.LASF1758:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2228:
+	.string	"scratchpad"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF2458:
+	.string	"SBAS_MSAS"
+.LASF2329:
+	.string	"ARMING_DISABLED_INVALID_SETTING"
+.LASF1906:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1361:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF930:
+	.string	"__DECL_SIMD_atan2l "
+.LASF2174:
+	.string	"DEVHW_MPU6000"
+.LASF747:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF1410:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF2615:
+	.string	"GPSLEDTime"
+.LASF1140:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF766:
+	.string	"_MATH_H 1"
+.LASF707:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1371:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1695:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1263:
+	.string	"_T_PTRDIFF_ "
+.LASF1166:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF2245:
+	.string	"magAlign"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1700:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF780:
+	.string	"__DECL_SIMD_sinl "
+.LASF2507:
+	.string	"velNED"
+.LASF1870:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1523:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1332:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF782:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1774:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1540:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF2126:
+	.string	"OWNER_TX"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1753:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF2025:
+	.string	"GPS_HDOP_TO_EPH_MULTIPLIER 2"
+.LASF1581:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1463:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1019:
+	.string	"__DECL_SIMD_erfcf "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2443:
+	.string	"portConfigs"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1761:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1333:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1491:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF2334:
+	.string	"CALIBRATE_MAG"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1292:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF801:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1647:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1755:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF1669:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF2584:
+	.string	"serialRxBytesWaiting"
+.LASF1604:
+	.string	"LED0_TOGGLE do {} while (0)"
+.LASF1838:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1792:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1662:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1677:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF745:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF1062:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2503:
+	.string	"gpsSolutionData_s"
+.LASF898:
+	.string	"__DECL_SIMD_expm1 "
+.LASF1886:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF857:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1959:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2246:
+	.string	"magSensorToUse"
+.LASF2138:
+	.string	"RESOURCE_NONE"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1733:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1852:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1915:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF800:
+	.string	"__DECL_SIMD_logl "
+.LASF1074:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1987:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2091:
+	.string	"month"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF2382:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1216:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1037:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1655:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1620:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2311:
+	.string	"ARMING_DISABLED_NOT_LEVEL"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF932:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1487:
+	.string	"BIT(x) (1 << (x))"
+.LASF2118:
+	.string	"OWNER_BEEPER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2043:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF2603:
+	.string	"isMPUSoftReset"
+.LASF1202:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF2285:
+	.string	"rxBufferHead"
+.LASF808:
+	.string	"__DECL_SIMD_exp "
+.LASF2518:
+	.string	"gpsSol"
+.LASF1018:
+	.string	"__DECL_SIMD_erfc "
+.LASF1680:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF2047:
+	.string	"FAKE_GPS_INITIAL_LAT 509102311"
+.LASF883:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF900:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1507:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1092:
+	.string	"_Mdouble_"
+.LASF2067:
+	.string	"int32_t"
+.LASF1418:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1040:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2436:
+	.string	"functionMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2147:
+	.string	"RESOURCE_I2C_SCL"
+.LASF2351:
+	.string	"ROVER"
+.LASF1938:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1138:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF1562:
+	.string	"PG_INAV_END 1023"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2304:
+	.string	"beginWrite"
+.LASF2217:
+	.string	"busDeviceDescriptor_s"
+.LASF2225:
+	.string	"busDeviceDescriptor_t"
+.LASF992:
+	.string	"__DECL_SIMD_erff32 "
+.LASF731:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF2193:
+	.string	"DEVHW_IST8308"
+.LASF1303:
+	.string	"___int_wchar_t_h "
+.LASF2129:
+	.string	"OWNER_SPI_PREINIT"
+.LASF810:
+	.string	"__DECL_SIMD_expl "
+.LASF2537:
+	.string	"gpsReceiverData_t"
+.LASF1909:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF2499:
+	.string	"validVelD"
+.LASF2139:
+	.string	"RESOURCE_INPUT"
+.LASF1730:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF1836:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1048:
+	.string	"__HAVE_FLOAT64 1"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF2006:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1337:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF1514:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF935:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1356:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF2148:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2290:
+	.string	"rxCallbackData"
+.LASF2470:
+	.string	"GPS_AUTOCONFIG_ON"
+.LASF2253:
+	.string	"MODE_RX"
+.LASF907:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF2249:
+	.string	"externalRotation"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF2349:
+	.string	"AIRPLANE"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1485:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1746:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2394:
+	.string	"FUNCTION_RANGEFINDER"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF2181:
+	.string	"DEVHW_BMP280"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1526:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF1093:
+	.string	"__MATH_PRECNAME"
+.LASF943:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1123:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1376:
+	.string	"FAST_CODE "
+.LASF1203:
+	.string	"USE_OPFLOW "
+.LASF2077:
+	.string	"PGR_SIZE_MASK"
+.LASF1103:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1125:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF875:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF2219:
+	.string	"busType"
+.LASF1096:
+	.string	"_Mdouble_ float"
+.LASF2417:
+	.string	"BAUD_2000000"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1185:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1925:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1805:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1347:
+	.string	"USE_PITOT_MS4525"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1080:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1212:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF2384:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF1726:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF746:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF1277:
+	.string	"_T_SIZE_ "
+.LASF2205:
+	.string	"DEVHW_DS2482"
+.LASF1319:
+	.string	"USE_FAKE_GPS "
+.LASF1086:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1462:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF2457:
+	.string	"SBAS_WAAS"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF980:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1129:
+	.string	"__MATHCALL_NARROW"
+.LASF2063:
+	.string	"long int"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF2476:
+	.string	"GPS_DYNMODEL_AIR_1G"
+.LASF1827:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1703:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF2175:
+	.string	"DEVHW_MPU6050"
+.LASF1213:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF2473:
+	.string	"GPS_AUTOBAUD_ON"
+.LASF1889:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1114:
+	.string	"__MATHDECL_1"
+.LASF1336:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF2474:
+	.string	"gpsAutoBaud_e"
+.LASF1075:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF2117:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF706:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF1999:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF396:
+	.string	"false 0"
+.LASF2137:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1412:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1256:
+	.string	"USE_CLI_BATCH "
+.LASF1288:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1952:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2254:
+	.string	"MODE_TX"
+.LASF1050:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1367:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1654:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1616:
+	.string	"IOCFG_AF_PP 0"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2376:
+	.string	"SENSOR_TEMP"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1482:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2517:
+	.string	"gpsStatistics_t"
+.LASF723:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF1563:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF961:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF2235:
+	.string	"CW0_DEG_FLIP"
+.LASF856:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2005:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF868:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF1238:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF886:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1833:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1272:
+	.string	"__need_ptrdiff_t"
+.LASF1871:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2197:
+	.string	"DEVHW_LM75_0"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF2199:
+	.string	"DEVHW_LM75_2"
+.LASF2200:
+	.string	"DEVHW_LM75_3"
+.LASF2201:
+	.string	"DEVHW_LM75_4"
+.LASF2202:
+	.string	"DEVHW_LM75_5"
+.LASF2203:
+	.string	"DEVHW_LM75_6"
+.LASF2204:
+	.string	"DEVHW_LM75_7"
+.LASF2534:
+	.string	"lastLastMessageMs"
+.LASF1088:
+	.string	"_Mdouble_ double"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1366:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1678:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF2369:
+	.string	"SENSOR_BARO"
+.LASF970:
+	.string	"__DECL_SIMD_atanhl "
+.LASF2578:
+	.string	"restart"
+.LASF1995:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2464:
+	.string	"GPS_BAUDRATE_38400"
+.LASF2594:
+	.string	"gpsRestartNAZA"
+.LASF1530:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF1042:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF2024:
+	.string	"HDOP_SCALE (100)"
+.LASF1432:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF2403:
+	.string	"BAUD_1200"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF2092:
+	.string	"hours"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF1912:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1782:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1976:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF2288:
+	.string	"txBufferTail"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2533:
+	.string	"lastStateSwitchMs"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF2564:
+	.string	"FEATURE_BLACKBOX"
+.LASF1401:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF2546:
+	.string	"FEATURE_VBAT"
+.LASF2312:
+	.string	"ARMING_DISABLED_SENSORS_CALIBRATING"
+.LASF2298:
+	.string	"serialSetBaudRate"
+.LASF2105:
+	.string	"OWNER_SERVO"
+.LASF1490:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF718:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1459:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1423:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1585:
+	.string	"SPIDEV_COUNT 4"
+.LASF925:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF1509:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF1156:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF893:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF826:
+	.string	"__DECL_SIMD_powf64x "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1538:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF2526:
+	.string	"serialConfig"
+.LASF1468:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF969:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF2433:
+	.string	"SERIAL_PORT_IDENTIFIER_MAX"
+.LASF2136:
+	.string	"OWNER_IRLOCK"
+.LASF1521:
+	.string	"PG_GPS_CONFIG 30"
+.LASF1142:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1932:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF2449:
+	.string	"GPS_I2CNAV"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1553:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF827:
+	.string	"__DECL_SIMD_powf128x "
+.LASF702:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1768:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1656:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF2318:
+	.string	"ARMING_DISABLED_HARDWARE_FAILURE"
+.LASF1955:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2231:
+	.string	"CW0_DEG"
+.LASF1137:
+	.string	"FP_NORMAL 4"
+.LASF1969:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1269:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1404:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1661:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF918:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1728:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1610:
+	.string	"LED2_TOGGLE do {} while (0)"
+.LASF2058:
+	.string	"__int16_t"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1887:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF2405:
+	.string	"BAUD_4800"
+.LASF2060:
+	.string	"__uint16_t"
+.LASF1065:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2620:
+	.string	"gpsConstrainHDOP"
+.LASF2630:
+	.string	"gpsPortConfig"
+.LASF2281:
+	.string	"rxBufferSize"
+.LASF2104:
+	.string	"OWNER_MOTOR"
+.LASF894:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF2525:
+	.string	"gpsConfig"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2162:
+	.string	"BUSTYPE_I2C"
+.LASF861:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF2497:
+	.string	"gpsHeartbeat"
+.LASF2385:
+	.string	"FUNCTION_BLACKBOX"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1629:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1965:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1304:
+	.string	"__INT_WCHAR_T_H "
+.LASF1586:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF939:
+	.string	"__DECL_SIMD_log10f "
+.LASF2234:
+	.string	"CW270_DEG"
+.LASF837:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1778:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1543:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF864:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1036:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1151:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1633:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1905:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF833:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2287:
+	.string	"txBufferHead"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2411:
+	.string	"BAUD_230400"
+.LASF1522:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF2567:
+	.string	"FEATURE_AIRMODE"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF1666:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF895:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1880:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1664:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF991:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2472:
+	.string	"GPS_AUTOBAUD_OFF"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1689:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1003:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF796:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF2586:
+	.string	"waitForSerialPortToFinishTransmitting"
+.LASF865:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF2467:
+	.string	"GPS_BAUDRATE_COUNT"
+.LASF2487:
+	.string	"autoBaud"
+.LASF2415:
+	.string	"BAUD_1000000"
+.LASF1577:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF763:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF2374:
+	.string	"SENSOR_GPS"
+.LASF2101:
+	.string	"OWNER_PWMIO"
+.LASF1061:
+	.string	"__f32x(x) x ##f32x"
+.LASF2186:
+	.string	"DEVHW_BMP388"
+.LASF882:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1113:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1593:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1215:
+	.string	"USE_OLED_UG2864 "
+.LASF1820:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1158:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1781:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF2634:
+	.string	"gpsResetSolution"
+.LASF2048:
+	.string	"FAKE_GPS_INITIAL_LON -15349744"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1476:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF737:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF1127:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1786:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF749:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1973:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF349:
+	.string	"__amd64 1"
+.LASF2392:
+	.string	"FUNCTION_OPTICAL_FLOW"
+.LASF2052:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF734:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF825:
+	.string	"__DECL_SIMD_powf32x "
+.LASF2549:
+	.string	"FEATURE_MOTOR_STOP"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF874:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1564:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF1570:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF1807:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1270:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1447:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF1844:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF2330:
+	.string	"ARMING_DISABLED_PWM_OUTPUT_ERROR"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1163:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1182:
+	.string	"USE_NAV "
+.LASF2106:
+	.string	"OWNER_SOFTSERIAL"
+.LASF1861:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF358:
+	.string	"__k8 1"
+.LASF1872:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF1511:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF2072:
+	.string	"float"
+.LASF2277:
+	.string	"identifier"
+.LASF1694:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF2532:
+	.string	"autoConfigStep"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1506:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF1660:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF2028:
+	.string	"GPS_BAUD_CHANGE_DELAY (100)"
+.LASF1375:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1663:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1750:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2301:
+	.string	"writeBuf"
+.LASF754:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF990:
+	.string	"__DECL_SIMD_erfl "
+.LASF2039:
+	.string	"NAV_BLACKBOX "
+.LASF2396:
+	.string	"FUNCTION_ESCSERIAL"
+.LASF2515:
+	.string	"timeouts"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2390:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1615:
+	.string	"IOCFG_OUT_OD 0"
+.LASF1544:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF1130:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF2580:
+	.string	"gpsProviderDescriptor_t"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF851:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1262:
+	.string	"_PTRDIFF_T "
+.LASF2088:
+	.string	"pgRegistry_s"
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF2313:
+	.string	"ARMING_DISABLED_SYSTEM_OVERLOADED"
+.LASF2622:
+	.string	"delta"
+.LASF2551:
+	.string	"FEATURE_SOFTSERIAL"
+.LASF1385:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2305:
+	.string	"endWrite"
+.LASF2377:
+	.string	"FUNCTION_NONE"
+.LASF1155:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF2365:
+	.string	"SENSOR_INDEX_OPFLOW"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1351:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF947:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF2230:
+	.string	"ALIGN_DEFAULT"
+.LASF1907:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1470:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF916:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1707:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1600:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF2079:
+	.string	"PGR_SIZE_PROFILE_FLAG"
+.LASF1180:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1968:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1022:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1933:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF2128:
+	.string	"OWNER_VTX"
+.LASF512:
+	.string	"__wur "
+.LASF1505:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1937:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2009:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1811:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1175:
+	.string	"USE_SERIALRX_FPORT "
+.LASF841:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1144:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF2243:
+	.string	"init"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2512:
+	.string	"gpsSolutionData_t"
+.LASF2558:
+	.string	"FEATURE_UNUSED_5"
+.LASF2559:
+	.string	"FEATURE_UNUSED_6"
+.LASF2563:
+	.string	"FEATURE_UNUSED_7"
+.LASF2132:
+	.string	"OWNER_1WIRE"
+.LASF2571:
+	.string	"FEATURE_UNUSED_9"
+.LASF1362:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1991:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1100:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2317:
+	.string	"ARMING_DISABLED_ARM_SWITCH"
+.LASF1537:
+	.string	"PG_INAV_START 1000"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1209:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1466:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1653:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF1862:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2407:
+	.string	"BAUD_19200"
+.LASF1826:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF2111:
+	.string	"OWNER_RANGEFINDER"
+.LASF2631:
+	.string	"gpsPreInit"
+.LASF863:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2282:
+	.string	"txBufferSize"
+.LASF1314:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF2459:
+	.string	"SBAS_GAGAN"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1652:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1594:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF1115:
+	.string	"__MATHDECL_ALIAS"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF1358:
+	.string	"USE_RCDEVICE"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF889:
+	.string	"__DECL_SIMD_coshf "
+.LASF2447:
+	.string	"GPS_NMEA"
+.LASF2344:
+	.string	"NAV_CRUISE_BRAKING_BOOST"
+.LASF2416:
+	.string	"BAUD_1500000"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1825:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF2401:
+	.string	"serialPortFunction_e"
+.LASF987:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1739:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF962:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1843:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1054:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2393:
+	.string	"FUNCTION_LOG"
+.LASF1171:
+	.string	"USE_SERIAL_RX "
+.LASF1657:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1135:
+	.string	"FP_ZERO 2"
+.LASF1021:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF867:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF2207:
+	.string	"DEVHW_SRF10"
+.LASF2306:
+	.string	"writeBufChunks"
+.LASF1110:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF979:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1360:
+	.string	"USE_ITCM_RAM"
+.LASF1709:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1776:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF2324:
+	.string	"ARMING_DISABLED_CMS_MENU"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2075:
+	.string	"PGR_PGN_MASK"
+.LASF1795:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1860:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF2278:
+	.string	"mode"
+.LASF1051:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1090:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF2247:
+	.string	"magADCRaw"
+.LASF921:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2628:
+	.string	"lonDelta"
+.LASF1239:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF2046:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF2297:
+	.string	"serialRead"
+.LASF1316:
+	.string	"USE_IMU_FAKE "
+.LASF1978:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF2485:
+	.string	"sbasMode"
+.LASF2625:
+	.string	"latCmDelta"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF777:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF2152:
+	.string	"RESOURCE_SPI_CS"
+.LASF1613:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF940:
+	.string	"__DECL_SIMD_log10l "
+.LASF2289:
+	.string	"rxCallback"
+.LASF1399:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1436:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF1353:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1990:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1918:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2501:
+	.string	"validEPE"
+.LASF1348:
+	.string	"USE_PITOT_ADC"
+.LASF2438:
+	.string	"gps_baudrateIndex"
+.LASF817:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1608:
+	.string	"LED1_OFF do {} while (0)"
+.LASF753:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF1177:
+	.string	"USE_ADC_AVERAGING "
+.LASF2616:
+	.string	"updateGpsIndicator"
+.LASF1712:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2283:
+	.string	"rxBuffer"
+.LASF2272:
+	.string	"serialBufChunk_t"
+.LASF1053:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1904:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF768:
+	.string	"__DECL_SIMD_cos "
+.LASF2262:
+	.string	"SERIAL_PARITY_NO"
+.LASF2086:
+	.string	"timeMs_t"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1443:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1743:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF927:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF2340:
+	.string	"COMPASS_CALIBRATED"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF946:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1939:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF849:
+	.string	"__DECL_SIMD_asinf "
+.LASF1971:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF2596:
+	.string	"gpsRestartUBLOX"
+.LASF2608:
+	.string	"isGPSHealthy"
+.LASF1205:
+	.string	"USE_OPFLOW_MSP "
+.LASF2081:
+	.string	"size"
+.LASF760:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF1793:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF2361:
+	.string	"SENSOR_INDEX_BARO"
+.LASF2151:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2121:
+	.string	"OWNER_MPU"
+.LASF1390:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1498:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1120:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2441:
+	.string	"serialPortConfig_t"
+.LASF1963:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1091:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1104:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF1545:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF816:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1628:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1798:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF973:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF807:
+	.string	"__DECL_SIMD_logf128x "
+.LASF769:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1803:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2131:
+	.string	"OWNER_TEMPERATURE"
+.LASF1982:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF913:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2562:
+	.string	"FEATURE_DASHBOARD"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF802:
+	.string	"__DECL_SIMD_logf32 "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1157:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1667:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1282:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2268:
+	.string	"SERIAL_BIDIR_NOPULL"
+.LASF2122:
+	.string	"OWNER_INVERTER"
+.LASF1154:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF2257:
+	.string	"portOptions_t"
+.LASF733:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1961:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2080:
+	.string	"pgResetFunc"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2068:
+	.string	"uint8_t"
+.LASF1079:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1706:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1592:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1195:
+	.string	"USE_RX_UIB "
+.LASF1764:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1950:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1494:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1094:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1484:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2629:
+	.string	"gpsInit"
+.LASF2002:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF2362:
+	.string	"SENSOR_INDEX_MAG"
+.LASF2331:
+	.string	"ARMING_DISABLED_ALL_FLAGS"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF834:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF2452:
+	.string	"GPS_MTK"
+.LASF1579:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF2460:
+	.string	"SBAS_NONE"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1026:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF988:
+	.string	"__DECL_SIMD_erf "
+.LASF1832:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF2222:
+	.string	"param"
+.LASF1984:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1354:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF2579:
+	.string	"protocol"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1305:
+	.string	"_GCC_WCHAR_T "
+.LASF1300:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2141:
+	.string	"RESOURCE_IO"
+.LASF1790:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1287:
+	.string	"___int_size_t_h "
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1380:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1374:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1900:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2226:
+	.string	"busDevice_s"
+.LASF2229:
+	.string	"busDevice_t"
+.LASF1813:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF376:
+	.string	"unix 1"
+.LASF1134:
+	.string	"FP_INFINITE 1"
+.LASF1124:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF888:
+	.string	"__DECL_SIMD_cosh "
+.LASF1126:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF778:
+	.string	"__DECL_SIMD_sin "
+.LASF2500:
+	.string	"validMag"
+.LASF1200:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1687:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF1705:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF2611:
+	.string	"magDev"
+.LASF2371:
+	.string	"SENSOR_RANGEFINDER"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF2423:
+	.string	"SERIAL_PORT_USART2"
+.LASF791:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF2195:
+	.string	"DEVHW_MAG3110"
+.LASF1724:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF2208:
+	.string	"DEVHW_HCSR04_I2C"
+.LASF1044:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1339:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1280:
+	.string	"_SIZE_T_ "
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1355:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1627:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1291:
+	.string	"__need_size_t"
+.LASF2103:
+	.string	"OWNER_PPMINPUT"
+.LASF2098:
+	.string	"ioTag_t"
+.LASF2493:
+	.string	"gpsConfig_Copy"
+.LASF1618:
+	.string	"IOCFG_IPD 0"
+.LASF2342:
+	.string	"PWM_DRIVER_AVAILABLE"
+.LASF821:
+	.string	"__DECL_SIMD_powf16 "
+.LASF852:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF2000:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF1069:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1201:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF2610:
+	.string	"gpsMagRead"
+.LASF890:
+	.string	"__DECL_SIMD_coshl "
+.LASF1384:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1974:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1095:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1108:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1729:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1259:
+	.string	"_STDDEF_H "
+.LASF1917:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF975:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1318:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1497:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1658:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1985:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1122:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1914:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF871:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF2007:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF1055:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF708:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF2602:
+	.string	"rtcSetDateTime"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF806:
+	.string	"__DECL_SIMD_logf64x "
+.LASF2020:
+	.string	"LON 1"
+.LASF2372:
+	.string	"SENSOR_PITOT"
+.LASF1854:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1683:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2612:
+	.string	"gpsMagInit"
+.LASF1097:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1702:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF2399:
+	.string	"FUNCTION_DJI_HD_OSD"
+.LASF1369:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1597:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF1409:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1673:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF1190:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF924:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1451:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF2168:
+	.string	"DEVHW_ADXL345"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1696:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2170:
+	.string	"DEVHW_LSM303DLHC"
+.LASF2632:
+	.string	"gpsProcessNewSolutionData"
+.LASF1285:
+	.string	"_SIZE_T_DECLARED "
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF2251:
+	.string	"useExternal"
+.LASF743:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF1045:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1742:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF901:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF700:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1496:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1189:
+	.string	"USE_PITOT_ADC "
+.LASF1720:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1642:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2381:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF2096:
+	.string	"dateTime_t"
+.LASF1898:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF2161:
+	.string	"BUSTYPE_NONE"
+.LASF1856:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1602:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF2004:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1891:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2637:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1614:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1043:
+	.string	"__f128(x) x ##f128"
+.LASF981:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1099:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1698:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2270:
+	.string	"data"
+.LASF1560:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF1936:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1692:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1676:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1450:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1767:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2406:
+	.string	"BAUD_9600"
+.LASF2064:
+	.string	"__uint64_t"
+.LASF1951:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1461:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF2617:
+	.string	"gpsEnablePassthrough"
+.LASF1802:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF933:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF2461:
+	.string	"sbasMode_e"
+.LASF1427:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF850:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1631:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF739:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF1645:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1029:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1878:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF2090:
+	.string	"year"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF2368:
+	.string	"SENSOR_ACC"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1133:
+	.string	"FP_NAN 0"
+.LASF922:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2389:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF2082:
+	.string	"address"
+.LASF1467:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1106:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1902:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF1453:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF1816:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1876:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1780:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2383:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF1372:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1357:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF2624:
+	.string	"cmDelta"
+.LASF770:
+	.string	"__DECL_SIMD_cosl "
+.LASF2144:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1679:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1248:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1082:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1310:
+	.string	"NULL"
+.LASF2032:
+	.string	"MILLIS_PER_TENTH_SECOND 100"
+.LASF1567:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF2547:
+	.string	"FEATURE_TX_PROF_SEL"
+.LASF2488:
+	.string	"dynModel"
+.LASF757:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF1098:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF2143:
+	.string	"RESOURCE_UART_TX"
+.LASF756:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF1290:
+	.string	"__size_t "
+.LASF2112:
+	.string	"OWNER_SYSTEM"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1407:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF466:
+	.string	"__PMT"
+.LASF1641:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1479:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF697:
+	.string	"_CTYPE_H 1"
+.LASF1204:
+	.string	"USE_OPFLOW_CXOF "
+.LASF2157:
+	.string	"RESOURCE_RX_CE"
+.LASF2114:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1191:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF2440:
+	.string	"telemetry_baudrateIndex"
+.LASF2523:
+	.string	"GPS_LOST_COMMUNICATION"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF2187:
+	.string	"DEVHW_DPS310"
+.LASF1472:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1552:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1857:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF2171:
+	.string	"DEVHW_L3GD20"
+.LASF2412:
+	.string	"BAUD_250000"
+.LASF1150:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2378:
+	.string	"FUNCTION_MSP"
+.LASF2100:
+	.string	"OWNER_FREE"
+.LASF949:
+	.string	"__DECL_SIMD_log2f "
+.LASF2308:
+	.string	"ARMED"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2339:
+	.string	"NAV_MOTOR_STOP_OR_IDLE"
+.LASF2357:
+	.string	"armingFlags"
+.LASF2456:
+	.string	"SBAS_EGNOS"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF1111:
+	.string	"_Mdouble_ _Float64x"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF998:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2012:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1779:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF2153:
+	.string	"RESOURCE_ADC_CH1"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2078:
+	.string	"PGR_SIZE_SYSTEM_FLAG"
+.LASF1136:
+	.string	"FP_SUBNORMAL 3"
+.LASF2315:
+	.string	"ARMING_DISABLED_COMPASS_NOT_CALIBRATED"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1041:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1922:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1970:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2489:
+	.string	"ubloxUseGalileo"
+.LASF974:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1415:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1252:
+	.string	"USE_VTX_TRAMP "
+.LASF2044:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF736:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1296:
+	.string	"_T_WCHAR "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF2189:
+	.string	"DEVHW_AK8963"
+.LASF1934:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF2450:
+	.string	"GPS_NAZA"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1478:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1294:
+	.string	"_WCHAR_T "
+.LASF1777:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1081:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF1388:
+	.string	"UNIT_TESTED "
+.LASF2591:
+	.string	"feature"
+.LASF1349:
+	.string	"USE_1WIRE"
+.LASF2605:
+	.string	"onNewGPSData"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2486:
+	.string	"autoConfig"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1859:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF847:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF2542:
+	.string	"ADC_CURRENT"
+.LASF1298:
+	.string	"_WCHAR_T_ "
+.LASF2478:
+	.string	"gpsDynModel_e"
+.LASF2531:
+	.string	"autoBaudrateIndex"
+.LASF1817:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF762:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF1420:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF846:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2049:
+	.string	"FAKE_GPS_GROUND_ARMED_SPEED 350"
+.LASF476:
+	.string	"__P(args) args"
+.LASF1533:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF2598:
+	.string	"gpsRestartNMEA_MTK"
+.LASF1057:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF1501:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF1603:
+	.string	"LED_NUMBER 3"
+.LASF2347:
+	.string	"AIRMODE_ACTIVE"
+.LASF2319:
+	.string	"ARMING_DISABLED_BOXFAILSAFE"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1406:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF716:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF1276:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2071:
+	.string	"uint64_t"
+.LASF1107:
+	.string	"_Mdouble_ _Float128"
+.LASF1071:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF755:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1017:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1637:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF2027:
+	.string	"GPS_SHORT_TIMEOUT (500)"
+.LASF1948:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2509:
+	.string	"groundCourse"
+.LASF2269:
+	.string	"serialBufChunk_s"
+.LASF712:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF964:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1455:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1946:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2345:
+	.string	"NAV_CRUISE_BRAKING_LOCKED"
+.LASF1172:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1542:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF1721:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2018:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1879:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF2346:
+	.string	"NAV_EXTRA_ARMING_SAFETY_BYPASSED"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF715:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF2355:
+	.string	"SET_REVERSIBLE_MOTORS_FORWARD"
+.LASF960:
+	.string	"__DECL_SIMD_log1pl "
+.LASF842:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2573:
+	.string	"FEATURE_PWM_OUTPUT_ENABLE"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF2360:
+	.string	"SENSOR_INDEX_ACC"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF887:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2479:
+	.string	"GPS_NO_FIX"
+.LASF792:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1312:
+	.string	"__need_NULL"
+.LASF965:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF720:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF2014:
+	.string	"CALIBRATING_PITOT_TIME_MS 2000"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1128:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1206:
+	.string	"USE_PITOT_MS4525 "
+.LASF1109:
+	.string	"_Mdouble_ _Float32x"
+.LASF1469:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF2541:
+	.string	"ADC_RSSI"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1072:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1986:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF854:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1650:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF822:
+	.string	"__DECL_SIMD_powf32 "
+.LASF2463:
+	.string	"GPS_BAUDRATE_57600"
+.LASF1595:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF953:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2255:
+	.string	"MODE_RXTX"
+.LASF838:
+	.string	"__DECL_SIMD_atan "
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF1759:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF729:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF2250:
+	.string	"onBoard"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2309:
+	.string	"WAS_EVER_ARMED"
+.LASF2084:
+	.string	"reset"
+.LASF2248:
+	.string	"sensorMagReadFuncPtr"
+.LASF1198:
+	.string	"USE_RANGEFINDER "
+.LASF1457:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF2165:
+	.string	"busType_e"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1757:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF872:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1735:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1536:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF1473:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1601:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF855:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2115:
+	.string	"OWNER_SDCARD"
+.LASF1161:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF958:
+	.string	"__DECL_SIMD_log1p "
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF2468:
+	.string	"gpsBaudRate_e"
+.LASF2587:
+	.string	"ceilf"
+.LASF1030:
+	.string	"__DECL_SIMD_tanl "
+.LASF885:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1979:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2480:
+	.string	"GPS_FIX_2D"
+.LASF1226:
+	.string	"USE_LOG "
+.LASF1145:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1397:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF2213:
+	.string	"DEVHW_UG2864"
+.LASF2066:
+	.string	"int16_t"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF984:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1378:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF2053:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2350:
+	.string	"MULTIROTOR"
+.LASF1787:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2056:
+	.string	"signed char"
+.LASF1058:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF803:
+	.string	"__DECL_SIMD_logf64 "
+.LASF786:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1233:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF902:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF1273:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1131:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1588:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1619:
+	.string	"IOCFG_IPU 0"
+.LASF1690:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1437:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1944:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1302:
+	.string	"_WCHAR_T_H "
+.LASF2568:
+	.string	"FEATURE_SUPEREXPO_RATES"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1977:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF2560:
+	.string	"FEATURE_RSSI_ADC"
+.LASF2212:
+	.string	"DEVHW_M25P16"
+.LASF2481:
+	.string	"GPS_FIX_3D"
+.LASF986:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1433:
+	.string	"sq(x) ((x)*(x))"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF2271:
+	.string	"count"
+.LASF1199:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1119:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1232:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1885:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1804:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1488:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF2176:
+	.string	"DEVHW_MPU6500"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1060:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1281:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF2327:
+	.string	"ARMING_DISABLED_SERVO_AUTOTRIM"
+.LASF2323:
+	.string	"ARMING_DISABLED_CLI"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1340:
+	.string	"USE_DASHBOARD"
+.LASF1253:
+	.string	"USE_VTX_FFPV "
+.LASF1573:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF1162:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1636:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF997:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1607:
+	.string	"LED1_TOGGLE do {} while (0)"
+.LASF735:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF1284:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1518:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF2370:
+	.string	"SENSOR_MAG"
+.LASF1930:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2431:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2432:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF1223:
+	.string	"USE_ANTIGRAVITY "
+.LASF1882:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1370:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1578:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1368:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF2279:
+	.string	"options"
+.LASF1716:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2529:
+	.string	"state"
+.LASF1499:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1935:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF2328:
+	.string	"ARMING_DISABLED_OOM"
+.LASF1251:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1744:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1400:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF2108:
+	.string	"OWNER_SERIAL"
+.LASF1011:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1261:
+	.string	"_ANSI_STDDEF_H "
+.LASF2446:
+	.string	"serialConfig_System"
+.LASF2599:
+	.string	"openSerialPort"
+.LASF1146:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF2119:
+	.string	"OWNER_OSD"
+.LASF794:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1187:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF2135:
+	.string	"OWNER_PINIO"
+.LASF1863:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1894:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2076:
+	.string	"PGR_PGN_VERSION_MASK"
+.LASF1510:
+	.string	"PG_PID_PROFILE 14"
+.LASF1943:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1895:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF926:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF1183:
+	.string	"USE_TELEMETRY "
+.LASF2134:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2550:
+	.string	"FEATURE_UNUSED_1"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF2553:
+	.string	"FEATURE_UNUSED_3"
+.LASF1315:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF2554:
+	.string	"FEATURE_UNUSED_4"
+.LASF2595:
+	.string	"gpsHandleUBLOX"
+.LASF2089:
+	.string	"_dateTime_s"
+.LASF1153:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1532:
+	.string	"PG_VTX_CONFIG 54"
+.LASF1424:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF2496:
+	.string	"hasNewData"
+.LASF2570:
+	.string	"FEATURE_UNUSED_8"
+.LASF2010:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1070:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF1539:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF819:
+	.string	"__DECL_SIMD_powf "
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2013:
+	.string	"CALIBRATING_BARO_TIME_MS 2000"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1174:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1719:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1625:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF795:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF897:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF2448:
+	.string	"GPS_UBLOX"
+.LASF954:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF798:
+	.string	"__DECL_SIMD_log "
+.LASF1059:
+	.string	"__f32(x) x ##f32"
+.LASF2292:
+	.string	"rxIrqCount"
+.LASF721:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF1789:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1402:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF726:
+	.string	"isascii(c) __isascii (c)"
+.LASF2120:
+	.string	"OWNER_BARO"
+.LASF2556:
+	.string	"FEATURE_CURRENT_METER"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1395:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF761:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1846:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1617:
+	.string	"IOCFG_AF_OD 0"
+.LASF1582:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF2265:
+	.string	"SERIAL_BIDIR"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF2215:
+	.string	"DEVHW_IRLOCK"
+.LASF1329:
+	.string	"USE_UART8 "
+.LASF811:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1414:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF1208:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1819:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2430:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF2397:
+	.string	"FUNCTION_TELEMETRY_SIM"
+.LASF1849:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF2191:
+	.string	"DEVHW_IST8310_0"
+.LASF2192:
+	.string	"DEVHW_IST8310_1"
+.LASF2574:
+	.string	"FEATURE_OSD"
+.LASF1217:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1611:
+	.string	"LED2_OFF do {} while (0)"
+.LASF2083:
+	.string	"copy"
+.LASF2142:
+	.string	"RESOURCE_TIMER"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF1927:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF2316:
+	.string	"ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED"
+.LASF2511:
+	.string	"time"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2422:
+	.string	"SERIAL_PORT_USART1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF2424:
+	.string	"SERIAL_PORT_USART3"
+.LASF2425:
+	.string	"SERIAL_PORT_USART4"
+.LASF2426:
+	.string	"SERIAL_PORT_USART5"
+.LASF2427:
+	.string	"SERIAL_PORT_USART6"
+.LASF2428:
+	.string	"SERIAL_PORT_USART7"
+.LASF2429:
+	.string	"SERIAL_PORT_USART8"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2295:
+	.string	"serialTotalRxWaiting"
+.LASF1632:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF2321:
+	.string	"ARMING_DISABLED_RC_LINK"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF2521:
+	.string	"GPS_INITIALIZING"
+.LASF1429:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF2190:
+	.string	"DEVHW_AK8975"
+.LASF1754:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF1515:
+	.string	"PG_SERVO_MIXER 21"
+.LASF2530:
+	.string	"baudrateIndex"
+.LASF1266:
+	.string	"_PTRDIFF_T_ "
+.LASF2166:
+	.string	"DEVHW_NONE"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF951:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1591:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF2475:
+	.string	"GPS_DYNMODEL_PEDESTRIAN"
+.LASF1643:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1996:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1580:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF1234:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF914:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1772:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2109:
+	.string	"OWNER_PINDEBUG"
+.LASF1699:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF1727:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF963:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1966:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF2016:
+	.string	"CALIBRATING_ACC_TIME_MS 500"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1439:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF2036:
+	.string	"PERIOD_OF_30_SECONDS 30 * MILLIS_PER_SECOND"
+.LASF2636:
+	.string	"gpsSetState"
+.LASF2008:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF2017:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1659:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1193:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1486:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF2375:
+	.string	"SENSOR_GPSMAG"
+.LASF1265:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF2177:
+	.string	"DEVHW_BMI160"
+.LASF915:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1799:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1725:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1083:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1275:
+	.string	"_SIZE_T "
+.LASF1831:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1926:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2158:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1474:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1483:
+	.string	"EXPAND_I(x) x"
+.LASF1775:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1920:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1682:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1866:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF2102:
+	.string	"OWNER_PWMINPUT"
+.LASF1732:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1089:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2070:
+	.string	"uint32_t"
+.LASF2274:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF1279:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1364:
+	.string	"U_ID_1 1"
+.LASF1489:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1783:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2286:
+	.string	"rxBufferTail"
+.LASF1327:
+	.string	"USE_UART6 "
+.LASF1063:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF2538:
+	.string	"gpsState"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF2015:
+	.string	"CALIBRATING_GYRO_TIME_MS 2000"
+.LASF1840:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2184:
+	.string	"DEVHW_LPS25H"
+.LASF2462:
+	.string	"GPS_BAUDRATE_115200"
+.LASF948:
+	.string	"__DECL_SIMD_log2 "
+.LASF1697:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1306:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1345:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF955:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF2519:
+	.string	"gpsStats"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1839:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF2140:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF936:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1949:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF967:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2095:
+	.string	"millis"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1064:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1118:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1513:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF977:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2299:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF1640:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF1006:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1910:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1322:
+	.string	"USE_UART1 "
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF1393:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1066:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2508:
+	.string	"groundSpeed"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF2227:
+	.string	"descriptorPtr"
+.LASF1258:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1152:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1389:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1529:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1417:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1295:
+	.string	"_T_WCHAR_ "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1229:
+	.string	"CMS_MENU_OSD "
+.LASF1715:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1422:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF2180:
+	.string	"DEVHW_BMP085"
+.LASF787:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF2302:
+	.string	"isConnected"
+.LASF1824:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1381:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1241:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2110:
+	.string	"OWNER_TIMER"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF717:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF2037:
+	.string	"PERIOD_RXDATA_FAILURE 200"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1701:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1500:
+	.string	"PG_CF_START 1"
+.LASF2477:
+	.string	"GPS_DYNMODEL_AIR_4G"
+.LASF2163:
+	.string	"BUSTYPE_SPI"
+.LASF1928:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1184:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1874:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1178:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2240:
+	.string	"sensorMagInitFuncPtr"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF2019:
+	.string	"LAT 0"
+.LASF1962:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2627:
+	.string	"latDelta"
+.LASF2065:
+	.string	"char"
+.LASF1121:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF944:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1771:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF858:
+	.string	"__DECL_SIMD_hypot "
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1983:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1307:
+	.string	"__DEFINED_wchar_t "
+.LASF1052:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1708:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF2548:
+	.string	"FEATURE_BAT_PROFILE_AUTOSWITCH"
+.LASF1855:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF774:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1373:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF2210:
+	.string	"DEVHW_MS4525"
+.LASF941:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2164:
+	.string	"BUSTYPE_SDIO"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF2099:
+	.string	"IO_t"
+.LASF1704:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF738:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF2575:
+	.string	"FEATURE_FW_LAUNCH"
+.LASF2520:
+	.string	"GPS_UNKNOWN"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF906:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1651:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF814:
+	.string	"__DECL_SIMD_expf128 "
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1236:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF773:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF945:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF2178:
+	.string	"DEVHW_ICM20689"
+.LASF1565:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF2421:
+	.string	"SERIAL_PORT_NONE"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1590:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1456:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF1240:
+	.string	"USE_RX_MSP "
+.LASF1834:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1475:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1464:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF395:
+	.string	"true 1"
+.LASF1557:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF775:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1548:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF2583:
+	.string	"sensors"
+.LASF2242:
+	.string	"busDev"
+.LASF829:
+	.string	"__DECL_SIMD_acosf "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1283:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2539:
+	.string	"gpsToSerialBaudRate"
+.LASF1220:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF815:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1012:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1188:
+	.string	"USE_PITOT "
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1452:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF2576:
+	.string	"portMode"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF2173:
+	.string	"DEVHW_MPU3050"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1047:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF971:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF824:
+	.string	"__DECL_SIMD_powf128 "
+.LASF917:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1471:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1311:
+	.string	"NULL ((void *)0)"
+.LASF2400:
+	.string	"FUNCTION_SERVO_SERIAL"
+.LASF1686:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF910:
+	.string	"__DECL_SIMD_sinhl "
+.LASF741:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF1524:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1024:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF853:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF2196:
+	.string	"DEVHW_LIS3MDL"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2418:
+	.string	"BAUD_2470000"
+.LASF2237:
+	.string	"CW180_DEG_FLIP"
+.LASF1800:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1009:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF985:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1481:
+	.string	"STR_HELPER(x) #x"
+.LASF1394:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1770:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1034:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1528:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF2264:
+	.string	"SERIAL_UNIDIR"
+.LASF2451:
+	.string	"GPS_UBLOX7PLUS"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1736:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1386:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1897:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF2395:
+	.string	"FUNCTION_VTX_FFPV"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1421:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1025:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF879:
+	.string	"__DECL_SIMD_exp10f "
+.LASF812:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2373:
+	.string	"SENSOR_OPFLOW"
+.LASF1691:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2011:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1714:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1752:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1801:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1143:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2146:
+	.string	"RESOURCE_EXTI"
+.LASF1309:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF2565:
+	.string	"FEATURE_UNUSED_10"
+.LASF1623:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF2572:
+	.string	"FEATURE_UNUSED_11"
+.LASF934:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF1264:
+	.string	"_T_PTRDIFF "
+.LASF843:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1035:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1875:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF978:
+	.string	"__DECL_SIMD_acosh "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1230:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF1589:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1181:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1911:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF371:
+	.string	"__linux 1"
+.LASF710:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF2621:
+	.string	"gpsConstrainEPE"
+.LASF1941:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1609:
+	.string	"LED1_ON do {} while (0)"
+.LASF1877:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1823:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF1681:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1235:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1903:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF1556:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF905:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1192:
+	.string	"USE_GYRO_KALMAN "
+.LASF891:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF2592:
+	.string	"gpsHandleMTK"
+.LASF1837:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1149:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF2232:
+	.string	"CW90_DEG"
+.LASF2435:
+	.string	"serialPortConfig_s"
+.LASF2466:
+	.string	"GPS_BAUDRATE_9600"
+.LASF2569:
+	.string	"FEATURE_VTX"
+.LASF711:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1797:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1972:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF2239:
+	.string	"sensor_align_e"
+.LASF742:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF2172:
+	.string	"DEVHW_L3G4200"
+.LASF804:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1638:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1980:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2581:
+	.string	"pgResetTemplate_gpsConfig"
+.LASF1994:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2261:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1023:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1495:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1428:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF1791:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF703:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1568:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF1576:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF828:
+	.string	"__DECL_SIMD_acos "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1612:
+	.string	"LED2_ON do {} while (0)"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF1806:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF2341:
+	.string	"ACCELEROMETER_CALIBRATED"
+.LASF899:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1396:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF2408:
+	.string	"BAUD_38400"
+.LASF1812:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF805:
+	.string	"__DECL_SIMD_logf32x "
+.LASF2619:
+	.string	"gpsUpdate"
+.LASF1411:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1493:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF835:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1847:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF2585:
+	.string	"serialSetMode"
+.LASF1947:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1186:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1068:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF993:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2505:
+	.string	"numSat"
+.LASF1160:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1845:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF2241:
+	.string	"magDev_s"
+.LASF2252:
+	.string	"magDev_t"
+.LASF1888:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF2073:
+	.string	"double"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF2338:
+	.string	"FLAPERON_AVAILABLE"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF831:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF764:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF2034:
+	.string	"PERIOD_OF_1_SECONDS 1 * MILLIS_PER_SECOND"
+.LASF1626:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF928:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1067:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF2325:
+	.string	"ARMING_DISABLED_OSD_MENU"
+.LASF2026:
+	.string	"GPS_TIMEOUT (1000)"
+.LASF701:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1087:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF1649:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1454:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF2033:
+	.string	"MILLIS_PER_SECOND 1000"
+.LASF1492:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1672:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF704:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1001:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF2391:
+	.string	"FUNCTION_UAV_INTERCONNECT"
+.LASF2626:
+	.string	"lonCmDelta"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF1796:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1005:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF1749:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1299:
+	.string	"_BSD_WCHAR_T_ "
+.LASF876:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1442:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1168:
+	.string	"I2C2_OVERCLOCK false"
+.LASF2552:
+	.string	"FEATURE_GPS"
+.LASF2335:
+	.string	"SMALL_ANGLE"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2623:
+	.string	"speed"
+.LASF2524:
+	.string	"gpsState_e"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1313:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2455:
+	.string	"SBAS_AUTO"
+.LASF1148:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1940:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1788:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2061:
+	.string	"__int32_t"
+.LASF2469:
+	.string	"GPS_AUTOCONFIG_OFF"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF2062:
+	.string	"__uint32_t"
+.LASF839:
+	.string	"__DECL_SIMD_atanf "
+.LASF1583:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1016:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF2601:
+	.string	"featureClear"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF2506:
+	.string	"magData"
+.LASF1901:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF2638:
+	.string	"gpsFakeGPSUpdate"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1572:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF2420:
+	.string	"baudRates"
+.LASF2224:
+	.string	"irqPin"
+.LASF2179:
+	.string	"DEVHW_MPU9250"
+.LASF1671:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1352:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF2223:
+	.string	"busdev"
+.LASF2343:
+	.string	"NAV_CRUISE_BRAKING"
+.LASF2414:
+	.string	"BAUD_921600"
+.LASF2303:
+	.string	"isIdle"
+.LASF1231:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF2116:
+	.string	"OWNER_FLASH"
+.LASF830:
+	.string	"__DECL_SIMD_acosl "
+.LASF1517:
+	.string	"PG_RX_CONFIG 24"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF1675:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2434:
+	.string	"serialPortIdentifier_e"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF2031:
+	.string	"FAILSAFE_POWER_ON_DELAY_US (1000 * 1000 * 5)"
+.LASF1967:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2498:
+	.string	"validVelNE"
+.LASF1008:
+	.string	"__DECL_SIMD_asinh "
+.LASF1173:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1197:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1246:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1084:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1214:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF966:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2437:
+	.string	"msp_baudrateIndex"
+.LASF705:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2284:
+	.string	"txBuffer"
+.LASF1250:
+	.string	"USE_VTX_CONTROL "
+.LASF751:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF1289:
+	.string	"_SIZET_ "
+.LASF1981:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1892:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1503:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1210:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1260:
+	.string	"_STDDEF_H_ "
+.LASF1630:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2492:
+	.string	"gpsConfig_System"
+.LASF848:
+	.string	"__DECL_SIMD_asin "
+.LASF1997:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF2218:
+	.string	"devicePtr"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1751:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF2050:
+	.string	"FAKE_GPS_GROUND_UNARMED_SPEED 0"
+.LASF1867:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF2352:
+	.string	"BOAT"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1117:
+	.string	"__MATHCALL"
+.LASF942:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1558:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF1010:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2557:
+	.string	"FEATURE_REVERSIBLE_MOTORS"
+.LASF2336:
+	.string	"FIXED_WING_LEGACY"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF2528:
+	.string	"hwVersion"
+.LASF1520:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF728:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF1710:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1227:
+	.string	"USE_STATS "
+.LASF1320:
+	.string	"USE_MAG "
+.LASF2133:
+	.string	"OWNER_AIRSPEED"
+.LASF1549:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF1784:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1164:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF2442:
+	.string	"serialConfig_s"
+.LASF2445:
+	.string	"serialConfig_t"
+.LASF995:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF968:
+	.string	"__DECL_SIMD_atanh "
+.LASF781:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1308:
+	.string	"_BSD_WCHAR_T_"
+.LASF2022:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF750:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF1076:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF2513:
+	.string	"lastMessageDt"
+.LASF880:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1561:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF957:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1430:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1670:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1848:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1737:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1850:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1267:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1297:
+	.string	"__WCHAR_T "
+.LASF1165:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF2410:
+	.string	"BAUD_115200"
+.LASF1858:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2259:
+	.string	"SERIAL_INVERTED"
+.LASF2618:
+	.string	"gpsPassthroughPort"
+.LASF2293:
+	.string	"serialPortVTable"
+.LASF1738:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF714:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF1596:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF859:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1740:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1033:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF793:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF2260:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2379:
+	.string	"FUNCTION_GPS"
+.LASF844:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1993:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF2256:
+	.string	"portMode_t"
+.LASF748:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF1139:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF2087:
+	.string	"timeUs_t"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF996:
+	.string	"__DECL_SIMD_erff64x "
+.LASF1363:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF937:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF1519:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF1605:
+	.string	"LED0_OFF do {} while (0)"
+.LASF2183:
+	.string	"DEVHW_MS5607"
+.LASF823:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2386:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF789:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2074:
+	.string	"pgn_t"
+.LASF2465:
+	.string	"GPS_BAUDRATE_19200"
+.LASF1621:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1868:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1039:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2040:
+	.string	"NAV_ACCEL_CUTOFF_FREQUENCY_HZ 2"
+.LASF2543:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1426:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1945:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF2169:
+	.string	"DEVHW_MMA8452"
+.LASF845:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1167:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF873:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1431:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF869:
+	.string	"__DECL_SIMD_exp2f "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF1551:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF785:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF2544:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF2198:
+	.string	"DEVHW_LM75_1"
+.LASF1413:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2482:
+	.string	"gpsFixType_e"
+.LASF1038:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2273:
+	.string	"serialReceiveCallbackPtr"
+.LASF1964:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1222:
+	.string	"USE_D_BOOST "
+.LASF2182:
+	.string	"DEVHW_MS5611"
+.LASF1278:
+	.string	"_T_SIZE "
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF2035:
+	.string	"PERIOD_OF_3_SECONDS 3 * MILLIS_PER_SECOND"
+.LASF923:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF727:
+	.string	"toascii(c) __toascii (c)"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF2209:
+	.string	"DEVHW_VL53L0X"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF2404:
+	.string	"BAUD_2400"
+.LASF1102:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1648:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1504:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF1923:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1341:
+	.string	"USE_OLED_UG2864"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1391:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF959:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1419:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1809:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF1257:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF2590:
+	.string	"sensorsClear"
+.LASF1334:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF2494:
+	.string	"gpsLocation_s"
+.LASF2495:
+	.string	"gpsLocation_t"
+.LASF2154:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2155:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2156:
+	.string	"RESOURCE_ADC_CH4"
+.LASF896:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF903:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF1810:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1829:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1830:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2322:
+	.string	"ARMING_DISABLED_THROTTLE"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1007:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2214:
+	.string	"DEVHW_SDCARD"
+.LASF878:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1049:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2516:
+	.string	"packetCount"
+.LASF892:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF866:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF2194:
+	.string	"DEVHW_QMC5883"
+.LASF983:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1458:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF783:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF709:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1247:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1207:
+	.string	"USE_1WIRE "
+.LASF999:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1924:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1731:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1031:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF2042:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF2588:
+	.string	"sin_approx"
+.LASF1818:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF713:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF2275:
+	.string	"serialPort_s"
+.LASF2307:
+	.string	"serialPort_t"
+.LASF2220:
+	.string	"devHwType"
+.LASF1056:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1765:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2402:
+	.string	"BAUD_AUTO"
+.LASF1350:
+	.string	"USE_1WIRE_DS2482"
+.LASF2296:
+	.string	"serialTotalTxFree"
+.LASF2597:
+	.string	"gpsHandleNMEA"
+.LASF776:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1480:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1851:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1387:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1335:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF840:
+	.string	"__DECL_SIMD_atanl "
+.LASF2267:
+	.string	"SERIAL_BIDIR_PP"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2023:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1734:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF2216:
+	.string	"devHardwareType_e"
+.LASF1441:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1465:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1574:
+	.string	"DMA_NONE (0)"
+.LASF1975:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF2038:
+	.string	"PERIOD_RXDATA_RECOVERY 200"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1268:
+	.string	"___int_ptrdiff_t_h "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF938:
+	.string	"__DECL_SIMD_log10 "
+.LASF1665:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF884:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF2353:
+	.string	"ALTITUDE_CONTROL"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF732:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF994:
+	.string	"__DECL_SIMD_erff128 "
+.LASF877:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2388:
+	.string	"FUNCTION_RCDEVICE"
+.LASF1958:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF911:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1688:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1179:
+	.string	"USE_BLACKBOX "
+.LASF1446:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF832:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF2356:
+	.string	"FW_HEADING_USE_YAW"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1639:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF2600:
+	.string	"findSerialPortConfig"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF919:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF2167:
+	.string	"DEVHW_BMA280"
+.LASF1525:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF2354:
+	.string	"MOVE_FORWARD_ONLY"
+.LASF820:
+	.string	"__DECL_SIMD_powl "
+.LASF2185:
+	.string	"DEVHW_SPL06"
+.LASF1741:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF2160:
+	.string	"BUSTYPE_ANY"
+.LASF2633:
+	.string	"gpsSetProtocolTimeout"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1571:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF797:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF1808:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1002:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF2545:
+	.string	"FEATURE_THR_VBAT_COMP"
+.LASF1176:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1211:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1921:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1027:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1105:
+	.string	"_Mdouble_ _Float64"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1359:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF1541:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF1219:
+	.string	"USE_DJI_HD_OSD "
+.LASF722:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF1908:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF1883:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1890:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF2367:
+	.string	"SENSOR_GYRO"
+.LASF1112:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1286:
+	.string	"__DEFINED_size_t "
+.LASF1460:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1646:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1815:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF740:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF1644:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1942:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2280:
+	.string	"baudRate"
+.LASF2150:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF2113:
+	.string	"OWNER_SPI"
+.LASF2561:
+	.string	"FEATURE_LED_STRIP"
+.LASF1440:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1534:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF1853:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1913:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF759:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1762:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2291:
+	.string	"rxFrameCallback"
+.LASF1218:
+	.string	"USE_FRSKYOSD "
+.LASF2263:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1718:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1344:
+	.string	"USE_RANGEFINDER"
+.LASF1769:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1785:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF989:
+	.string	"__DECL_SIMD_erff "
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1606:
+	.string	"LED0_ON do {} while (0)"
+.LASF724:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF1550:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1159:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1864:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2387:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1745:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF1330:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1598:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF860:
+	.string	"__DECL_SIMD_hypotl "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF771:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1242:
+	.string	"USE_SERIALRX_SUMH "
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2510:
+	.string	"hdop"
+.LASF2055:
+	.string	"long unsigned int"
+.LASF1622:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2123:
+	.string	"OWNER_LED_STRIP"
+.LASF1881:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF765:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF1323:
+	.string	"USE_UART2 "
+.LASF1575:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF2589:
+	.string	"cos_approx"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF1566:
+	.string	"PG_ID_INVALID 0"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2021:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2130:
+	.string	"OWNER_COMPASS"
+.LASF1403:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1960:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1821:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1554:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF1998:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF1535:
+	.string	"PG_CF_END 56"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1873:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1748:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF790:
+	.string	"__DECL_SIMD_sincosl "
+.LASF730:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1989:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1073:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF2366:
+	.string	"SENSOR_INDEX_COUNT"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF2326:
+	.string	"ARMING_DISABLED_ROLLPITCH_NOT_CENTERED"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2059:
+	.string	"short int"
+.LASF2294:
+	.string	"serialWrite"
+.LASF2502:
+	.string	"validTime"
+.LASF1527:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF1449:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1773:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1794:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF870:
+	.string	"__DECL_SIMD_exp2l "
+.LASF2041:
+	.string	"RADAR_MAX_POIS 5"
+.LASF1324:
+	.string	"USE_UART3 "
+.LASF1445:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1085:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1869:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1531:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF1383:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1559:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF1169:
+	.string	"USE_I2C_PULLUP "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF2097:
+	.string	"fpMat3_t"
+.LASF1842:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1477:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1274:
+	.string	"__SIZE_T__ "
+.LASF1408:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1255:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1249:
+	.string	"USE_RCDEVICE "
+.LASF1237:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1685:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2413:
+	.string	"BAUD_460800"
+.LASF909:
+	.string	"__DECL_SIMD_sinhf "
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF2188:
+	.string	"DEVHW_HMC5883"
+.LASF1346:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF2348:
+	.string	"ESC_SENSOR_ENABLED"
+.LASF1711:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1723:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1438:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2409:
+	.string	"BAUD_57600"
+.LASF982:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF2054:
+	.string	"unsigned int"
+.LASF2359:
+	.string	"SENSOR_INDEX_GYRO"
+.LASF1325:
+	.string	"USE_UART4 "
+.LASF862:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1835:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF2030:
+	.string	"GPS_BOOT_DELAY (3000)"
+.LASF1547:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF2536:
+	.string	"timeoutMs"
+.LASF1668:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1243:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1379:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1132:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF2003:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF1624:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF2535:
+	.string	"lastMessageMs"
+.LASF1893:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF929:
+	.string	"__DECL_SIMD_atan2f "
+.LASF788:
+	.string	"__DECL_SIMD_sincos "
+.LASF1931:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1000:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF2266:
+	.string	"SERIAL_BIDIR_OD"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF2029:
+	.string	"GPS_INIT_DELAY (500)"
+.LASF2635:
+	.string	"gpsUpdateTime"
+.LASF1416:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2107:
+	.string	"OWNER_ADC"
+.LASF881:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1116:
+	.string	"__MATHDECL"
+.LASF1196:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF779:
+	.string	"__DECL_SIMD_sinf "
+.LASF2085:
+	.string	"pgRegistry_t"
+.LASF931:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF1584:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1953:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1760:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2527:
+	.string	"gpsPort"
+.LASF1899:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1326:
+	.string	"USE_UART5 "
+.LASF1916:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1508:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1516:
+	.string	"PG_IMU_CONFIG 22"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF2504:
+	.string	"fixType"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2145:
+	.string	"RESOURCE_UART_TXRX"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1020:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1814:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1342:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1392:
+	.string	"EXTENDED_FASTRAM "
+.LASF1954:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1713:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2233:
+	.string	"CW180_DEG"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1674:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1046:
+	.string	"__HAVE_FLOAT16 0"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1957:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1271:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1405:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF2206:
+	.string	"DEVHW_MAX7456"
+.LASF2609:
+	.string	"gpsMagDetect"
+.LASF1147:
+	.string	"M_E 2.7182818284590452354"
+.LASF2221:
+	.string	"flags"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1331:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1014:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2614:
+	.string	"gpsProviders"
+.LASF2094:
+	.string	"seconds"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF920:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1763:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2732:
+	.string	"rx_pwm.h"
+.LASF2705:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2656:
+	.string	"/usr/include"
+.LASF2711:
+	.string	"mathcalls-helper-functions.h"
+.LASF2700:
+	.string	"endianness.h"
+.LASF2707:
+	.string	"floatn-common.h"
+.LASF2685:
+	.string	"stdint.h"
+.LASF2639:
+	.string	"src/main/build"
+.LASF2653:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2684:
+	.string	"stdbool.h"
+.LASF2662:
+	.string	"time.h"
+.LASF2689:
+	.string	"wordsize.h"
+.LASF2667:
+	.string	"bus.h"
+.LASF2682:
+	.string	"navigation.h"
+.LASF2649:
+	.string	"src/main/target/SITL"
+.LASF2717:
+	.string	"common_post.h"
+.LASF2652:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2686:
+	.string	"libc-header-start.h"
+.LASF2731:
+	.string	"failsafe.h"
+.LASF2712:
+	.string	"platform.h"
+.LASF2657:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2730:
+	.string	"filter.h"
+.LASF2666:
+	.string	"resource.h"
+.LASF2645:
+	.string	"src/main/flight"
+.LASF2726:
+	.string	"light_led.h"
+.LASF2683:
+	.string	"stdc-predef.h"
+.LASF2664:
+	.string	"vector.h"
+.LASF2703:
+	.string	"math.h"
+.LASF2699:
+	.string	"endian.h"
+.LASF2677:
+	.string	"gps.c"
+.LASF2687:
+	.string	"features.h"
+.LASF2651:
+	.string	"src/main"
+.LASF2646:
+	.string	"src/main/io"
+.LASF2642:
+	.string	"src/main/drivers/compass"
+.LASF2641:
+	.string	"src/main/config"
+.LASF0:
+	.string	"./src/main/io/gps.c"
+.LASF2688:
+	.string	"features-time64.h"
+.LASF2669:
+	.string	"compass.h"
+.LASF2671:
+	.string	"runtime_config.h"
+.LASF2676:
+	.string	"config.h"
+.LASF2709:
+	.string	"fp-logb.h"
+.LASF2674:
+	.string	"gps_private.h"
+.LASF2696:
+	.string	"time64.h"
+.LASF2714:
+	.string	"target.h"
+.LASF2728:
+	.string	"io_def.h"
+.LASF2724:
+	.string	"bus_spi.h"
+.LASF2679:
+	.string	"maths.h"
+.LASF2721:
+	.string	"parameter_group_ids.h"
+.LASF2697:
+	.string	"wchar.h"
+.LASF2690:
+	.string	"timesize.h"
+.LASF2640:
+	.string	"src/main/common"
+.LASF2655:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2723:
+	.string	"rcc_types.h"
+.LASF2733:
+	.string	"stats.h"
+.LASF2673:
+	.string	"gps.h"
+.LASF2715:
+	.string	"stddef.h"
+.LASF2710:
+	.string	"fp-fast.h"
+.LASF2644:
+	.string	"src/main/fc"
+.LASF2706:
+	.string	"floatn.h"
+.LASF2722:
+	.string	"bus_i2c.h"
+.LASF2713:
+	.string	"common.h"
+.LASF2694:
+	.string	"stubs-64.h"
+.LASF2693:
+	.string	"stubs.h"
+.LASF2661:
+	.string	"parameter_group.h"
+.LASF2729:
+	.string	"io_def_generated.h"
+.LASF2680:
+	.string	"feature.h"
+.LASF2720:
+	.string	"utils.h"
+.LASF2672:
+	.string	"sensors.h"
+.LASF2704:
+	.string	"math-vector.h"
+.LASF2727:
+	.string	"io.h"
+.LASF2660:
+	.string	"stdint-uintn.h"
+.LASF2647:
+	.string	"src/main/navigation"
+.LASF2675:
+	.string	"adc.h"
+.LASF2692:
+	.string	"long-double.h"
+.LASF2719:
+	.string	"debug.h"
+.LASF2691:
+	.string	"cdefs.h"
+.LASF2708:
+	.string	"flt-eval-method.h"
+.LASF2678:
+	.string	"mathcalls.h"
+.LASF2695:
+	.string	"typesizes.h"
+.LASF2701:
+	.string	"locale_t.h"
+.LASF2668:
+	.string	"sensor.h"
+.LASF2716:
+	.string	"sanity_check.h"
+.LASF2725:
+	.string	"dma.h"
+.LASF2650:
+	.string	"src/main/target"
+.LASF2663:
+	.string	"axis.h"
+.LASF2681:
+	.string	"system.h"
+.LASF2643:
+	.string	"src/main/drivers"
+.LASF2670:
+	.string	"serial.h"
+.LASF2698:
+	.string	"ctype.h"
+.LASF2718:
+	.string	"build_config.h"
+.LASF2648:
+	.string	"src/main/sensors"
+.LASF2659:
+	.string	"stdint-intn.h"
+.LASF2702:
+	.string	"__locale_t.h"
+.LASF2658:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2665:
+	.string	"io_types.h"
+.LASF2654:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+	.text
+	.section	.gnu.lto_.profile.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\266\001\345\f"
+	.string	"V\023K= \3214\006\303\t\263dg\301,\322\270\271bv\031\317\324\2203z*\301\027\353\200\210\325\340.I\f\020\004\020\004\020\004\b\030\005\220\344\256\001\370;\330ku\357\275\245\334[n\271\223\224\0018"
+	.string	":"
+	.string	"8"
+	.string	"\345\357\363\361\225\301X\n\371\231e3\224!mz\323\203X\300\367#y\374{|\225l9\210"
+	.string	"G\233}5\273\334\267\253&\274\335\361\367\277\267\367`\222\017\215\006\253\262\267\b+h\273j\302\333'\275E\237U\347\212Gc\363\250&\261\334K\275E\220\226\211tg;\342\363\376\3477\302mA\034\3614\321\016\027\230ok\375}}\363\270\314\330\370\241\230e\371&k\306pf\022\245\033\214\t9\031\345YJk'\322?}t\323K\337\353I\243\347\213\036p\375\320\327\203\376\271'\375\276>\300\017N\036\303\fFH_\375I\025\334\217\030v\273j\302\233A\271Z\211\301\024\214@Z/\207\340\036gM\221\360\252PYR\327\322\215\f\220O\255\037\321\321wQ\362 pu\347%\202%\245\177B\235\204nZO\246\20329\206\036\305S0 `\202C6\306\003\204\t"
+	.string	"\375\324\262\021\2636\022T\203.\026}5\313\001\016]\226\0170J(\264\301\360\226\374\250;\247\004\016\201\347\305\275\031#\027\206\020\002\321\262\313\240-\237*\004\316\004\250\301\201l\031}\22489[e\354I2\216\0353\311\260\013\346\032\325\207$\333\0220"
+	.ascii	"!\f\374\026\352\275\026\254\213mv\270^-i`\b"
+	.text
+	.section	.gnu.lto_.ipa_sra.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\f"
+	.string	"\005\004"
+	.string	"\302\004\016\026\220E\351\377\377\377\377\2772B\b\370\360A\216\332\267\377\023\271S\n\352$\314\201\202?pX\247\360\326\200r6\314\\N\253\214\234\t\242\306\204\016\273g[!\362Z\223\033\037"
+	.string	"<\023"
+	.string	"\346a\314f`9P\230I\205\001\302\201\t\232\027\300\234\312\205\225&\233\013`M\304\310!u\301\250\246Up\314\264p'\203PBu\026\fp\311\r"
+	.ascii	"w\260\220\2412\330\346\r\0243:[\322\300\020"
+	.text
+	.section	.gnu.lto_.inline.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\244\003M\017"
+	.string	"\246\021B? \247L\032\003\001\0043\302\f\3471\335\3448\260~\031\366&\211\240q*\230\253\267\006\213%3\235\215\004\232\206\020*\340\264 \t\020*"
+	.string	"A\200\254\016 \247E\231\374I\030\301\237\330\210\224;\005'"
+	.string	"/"
+	.string	"9"
+	.string	"8p\312\307\037L\245\354)\346K\251\373\330\335o\245\330\335\360\365\3143\242\362\246\334\335\325\344GS\232\354.\370\234\275V\243UF?\242R\300H\203\007\361\"_S\332\002Q@2\202\301]}\351\351v\327\362e\210L\375A\031\217\307\222^\256\374\305\360;eH\314\025\034\030\r\177n\013h\263N\332\n\234\034\370\254\220\020\362\3048ZY\376\r\246BY\031\006f\017)%"
+	.ascii	"\300\225\340\332\034R\352\b\361\224\036\267\235\314\001\245\f"
+	.ascii	"v\261\016\2065\007\333v\303\016l7\334,\n\275j5\325E#\300\006"
+	.ascii	"\r\244\"%9\007\236A\251\032`\301\302\2740)E\3613\243\223bF\275"
+	.ascii	"\227PX\356\205\373L\250\254\025f\250\241\271BBR\023Ke9P\"\"\246"
+	.ascii	"\222\036\022\340d9\304Y\204\004Rb\201\004\222\304\260\317n\223"
+	.ascii	"\036\200\224QI_\t\321\307y]v\351\nr\330w\0032\016F\016\314(#"
+	.ascii	"9\212\\\341D\020\347\016s\262E\2441\364dg\235Q\007\3546+\323"
+	.ascii	"\245\354o7\327\225s\377\335\245PX|\205G\257\032Lm\236\302\221"
+	.ascii	"L\2629\232\227\320\201\225\310\301\3529\302\361\240\300z\013"
+	.ascii	"!\252\376eh\036\033U\030\352\3024|\247\f\367\367\320:$:o\225"
+	.ascii	"#\020\3333\271.\234\325\373M\2320Sx\304\227w\264\331\245\305"
+	.ascii	"\313\246 \031:\367\242\023\021:\244\247\250\315A\033d\320\246"
+	.ascii	"\270\222:\375\n\033\322p\210\202\360\357\212;\341\007\225%-_"
+	.ascii	"n\245kI\305\365\274\303\004\311\360\017\224K_\362"
+	.text
+	.section	.gnu.lto_.jmpfuncs.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`S\002m\t"
+	.string	"\302K&,\200K\322\0013PgC\320;\2240\220\006\316\f\002\370\246\025\206\325$\230%\340\255\210\360I\300\210Y\255\371\346}\363\215\310-wJ)\035h\037\3458\002\007x\337\335\353\3745\277\333M"
+	.string	"\300s\261\206\177K\340%\255\265f\204\206;'\360\277\223\002\337\364\261F*\0306\344I7\f\361\020\301V{k9\020\374^^V\300\337\307\230\210\211\234\025\370\267\205\324\340\321\002\207\203m\253\322N\013\274\313\360c\024\037s\333\274H(3\232\220\336\236z&;\251\267\366\333Z\232\026\002= @\002b +\363\"L\250\214q+\201%MY\240p\315\344\3107A\213\b\270\227\230\030\300\262"
+	.string	"\034g\t\017\006A\205\241\032@\003\221#\316\b\307\001\030yI\025\007\217(\230\236\303\230\3006\350\025\021/\327\262\330\211\225\202\004\273\234\022\222\030\221\341\246\023>m\211YhaqI)\330\307\230i\364AL\026\b2\226\335\212\017|\t\216\373"
+	.string	"\253\353(\270"
+	.ascii	"\026`U\201\023X\250!\033F\212\241\017M\230S\2336D\301u\317\f"
+	.ascii	"\306\302\002\f\001"
+	.text
+	.section	.gnu.lto_.pureconst.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375 A\315\001"
+	.string	"\022D\r\026\260\2511\f\204\275C\030\303\2005:[3\272:$5\020\213e2\016y\217\313\361\306\211\361\305S\274DI9\342\207\033^8\341\203\013\256+\360"
+	.string	"7efQ"
+	.text
+	.section	.gnu.lto_.ipa_modref.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`M\001\335\b"
+	.ascii	"BM$(\200K2\03430\003\310\220\tU.\242\t\232Xb8\266m\333\266v\344"
+	.ascii	"\267\361l(\"A\210h\365I-jd\357$S\252:\347\021t\036\034\203l\274"
+	.ascii	"\243(F\017\246\306t\342\f\232\211\3138\342\363:\214\335\305\323"
+	.ascii	"bW\261\243x'v\022\317\210\035\304N-\005\352\021\350|\0309$I\322"
+	.ascii	"\255\347\3325\317f4\340|\236\200\302.\341}\002\230'3\347E\324"
+	.ascii	"-&\327Z\222\364\341\234\225g\303\253<@\310\320VG\3311\354\026"
+	.ascii	"F:O\345\035\001= `\002)v\306\003\005Hl\217!\013\354\275\017["
+	.ascii	"c\025\217\226\263%Z\023j\277\231\035!8c\276f\020\304\335\"\234"
+	.ascii	"\307T\334\233`Pe\340a\272\2021\310\233\274\376\026\365\034\210"
+	.ascii	"j\2011\3072Qm\307\213;D\304\322\217\f\325ro\2068\337\215\036"
+	.ascii	"\313\222\357\007\002\013\326\005\240\2210$\021\037\260m\030\266"
+	.ascii	"\266,\273\342]\351\212\345\352|\t\\T#\347%\302\016X\233\020\303"
+	.ascii	"X\204<\2203\271X\030\003\027w\b"
+	.text
+	.section	.gnu.lto_.lto.bdb3b23f144523e5,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_gpsToSerialBaudRate.50.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375 U%\002"
+	.string	"\024\003H"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006\177\001\004\005\001\006\025\177\001\005\003\006\002\007\b?\202\210\200(}3\302\0014\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\007"
+	.ascii	"M\211\200;\320\030\020\361r#\245!\f\024\001"
+	.text
+	.section	.gnu.lto_gpsProviders.51.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\245\007"
+	.string	"\204\013X\001"
+	.string	""
+	.string	"\""
+	.string	"\005\001\212\001\202\200\200\374\342\303\357\321\013\177}\250\034\177{"
+	.string	"\005\001\006y\001w\001\003\005\001?\202\210\200 us\276\001q\275\001o\274\001m\273\001\005\001\006\025\001\005\274\236\340\216Z\177ki"
+	.string	"\302\001m\301\004\244\216N\177g\350\026\177ey\001w\310\001q\307\001o\306\001m\305\003\005\001\006\177"
+	.string	"\314\313\001m\313\002\274\215\320\001m\317\001\240\215[\177c\027\310\323\001m\3220a3\324\0014\321\001\316\001\315\001\312\001\311\001\304\001\303\001\300\001\277\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"\032"
+	.string	"5\205\300=\310xX\355\202\326NSh\320\020\024\006&\301eP\304\307d\r\003\211\220\220\262\373\205\3419X\002\210\202\302\300\220\261vL\2041\025!]\212Ef\222:"
+	.ascii	"8"
+	.text
+	.section	.gnu.lto_gpsConfig_Registry.55.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375 \216%\004"
+	.string	"d\007`"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	"\005\001\212\001\206\200\200\374\342\203\367\241\037\006\177}"
+	.string	"\005\001?\202\210\200\b{y\273\001\005\001\006w\001\202\200\200\350\307\006us\250\345\005uq"
+	.string	"\005\001\006'\001\030\036?\202\210\2000om\301\001k\300\001i\277\001g\276\001e\275\001c\274\001"
+	.string	"\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"\004"
+	.ascii	")\"\301$\236\242\356\033@\021"
+	.text
+	.section	.gnu.lto_pgResetTemplate_gpsConfig.57.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375 R=\002"
+	.string	"\"\304\016\030\240\033:$\t\377\017\327\376\177\377\375\367_"
+	.string	".\254\276\352\246\007^\222\001\274\"\266\212/c\3548C\326\2227e\t$j\022\236\271\333\033\347\271\373\320]\036\335\275\201\273\234\344\020\003"
+	.ascii	"@\204\224\333\006P\004"
+	.text
+	.section	.gnu.lto_gpsSetState.58.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\200"
+	.string	"\345\t"
+	.string	"\226\023F: \261\322\001\260\202\224\b\374\026@F\311CG<'\024(L\030\\\276+(\226\n\375\r[\b\032\224E\224\355G\024\3000"
+	.string	"\003|'0\363\2007\224\207f[\325\376&{\247\0242"
+	.string	"3"
+	.string	"7"
+	.string	"!\200\323\204\033tN\273\023tN\035\3325\037K\36661\303v\263\273u\222<\274\f\375\327\376\021a\255K\317\303\356Z\2120\216{\336v\3106\311>B~\267\273\353)\263O\373\247\224\276' &\243\020\263\273\221\313Y\034\205A\261}\373ch\203\354\221\306\302\345k~\312g\341i,\177vEf/\273#\203\0036\037i\177\026\363\035!\257\331\262\274}\314i\203ga\t\320\354\356\310W\371\312\205\177rj\214\225\274x\352\257:\247\007&1\227\314Y\336<fV\342\330cK\316\021\007vh\360\274R\004\211$\0320\251J*\220\332\023\201(\211\372\235j\305\251DQ\275\024XE\005\376P\246TU}_\252\202\306}\267S\006\001\202s\315\227?\355\323]&Z:\233\030\f"
+	.ascii	"\200)e&^\007EK\177\267\302&\214\020\262\004.S-\237Y\t\030]\346"
+	.ascii	"\200\273\274h'\031"
+	.text
+	.section	.gnu.lto_gpsUpdateTime.59.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\247"
+	.string	"\335\n"
+	.string	"&TJB0\213(\035\300v\314\316$\3609\302\232\301\3377\306\331\272\306L\363\333\231O\241\337\321\366\022\330\376O\260\005\003\305?*Y\374U,\325\324"
+	.string	"\302z\201\344\340\b\257\036\374\210`\202\304\210 \237l)S\n8"
+	.string	"5"
+	.string	"9"
+	.string	"\307\242f\347g\031\211\017\364\216E\bx\214\035\034*t\250"
+	.string	"M\361\342\204\340\323\300R\252\006\232\"\306\356~\365\004"
+	.string	"\2222\263\314\356:?0\300m\271\355\020\333\032\3663\002\t\302\016\275\324\224\375\270\273kE\331O\353\323\317&\030`\340\240\260{z\205X\027f!\201\355\333o\320\331\232;{\303C\325f\251\001+\022<\354\356\246\005\336\005\027\273\363\007\334\206jw?\034<<\361\017\0343(\204\371!\3131\325\213\201\326(_\317\335\365\324\"\313u$\202\206R~pL;E%\377]=\b\220\324sNP\220a\003\326`@\236\315\306q6\023\216Hg\323|@\033\306\302\234\207\344\263\241p\334g\323\302\275\242\f\262r\215\224\204Q\244\275\341\344?\253z\366\005\326\002U<\353\252o\331%\207 \n\023"
+	.ascii	"3\003\3369\344j\250\230\355\245\207V`\025p\246\013h^:\331\334"
+	.ascii	"d\253]`K\353\336sa=r\3010\270\374\300(\252\232\266]\245\f"
+	.text
+	.section	.gnu.lto_gpsSetProtocolTimeout.60.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\335"
+	.string	"]\013"
+	.string	"\006UMC \2138\035\300\022\270K(\241g\316\314\366I^\337%^\357\237@(\255\267x9$\031\315\006\0164\204\250a\006\263V\277\247R\302\244B 1@\206\214\217\313\221\3646\272S<\214\331x+\376[\3332\2456"
+	.string	"9"
+	.string	":"
+	.string	"\273\344\306\232\3133\214[T\236a\247\250<\263h{8i`_\0068)C\354\3566\013\\\274\212\376\027\\\033Q\245\253\345cw\255#*\345\236\267\255\261\355a\377\013\254\n\033VE\330dI'\001\373\330\356\256g\312\376\352\267\250ZU}\r\203AC\006\204]\224\327\210ue\024\020\330~\306\336\370\260\271\332Op\005\342W\241\265\335\001\255\t\001\021&\007\214\332 O?\352\f\005\234f\311\312\262\360i\227\374A(\321\241\304\312\021\204\r\336Ax\331]\016\237\301\033\214\374\003\317lB\322\217\317|R\345\331\347F\2652\351\313\032\356\320\3408\217H\247\303\231"
+	.string	"CD#\357\003\352D\2329\016\030\032\331\274n#\351<\240\215\373\300\215Sa/\364\3716\221\347}[\206\334c;S\006\311\3402\315\223-\323\356\336\222p\241\002pA'+\024"
+	.string	"\244)E&\236\035\215\026\027*\030\242\0169#\303[D#\033\026\003\261"
+	.ascii	"\211\025\201,\f\r\301{\223\022\202P1\030.\030Z\253)\340./\332"
+	.ascii	"I\006"
+	.text
+	.section	.gnu.lto_gpsProcessNewSolutionData.61.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`l\004\255\031"
+	.string	"\026k\230G\300\030Q:\320W\301\204tw\354"
+	.string	"!F\220bt\004+\210f\300\210\333\272\334\022\310\362|9\353'W\355\243\371\035\r\242\fZZ\220\025$u\b\226!8\217\202\351\240\371\017\267\201P\302\326o_\321>!D\312\224\002{"
+	.string	"~"
+	.string	"\210"
+	.string	"\237\032\265j\232O=\263\352\323\252M\253\016W\r\256\372S\365\252Z\257\276\200\fHI^\020\224s\232(\311L$P\227\303\366Q\036\355-\017\312\315\017\341\250\r%\3159\305\245\361\361!\370\255\216>\2120=\017W\034\004uG\263+D\267\025\377\b\3149Q7\232\356\207\340\205\024\025\253\333\210\017"
+	.string	"\025\031Y\016\344Z\3426S59\230sZm7\024\267\351\266?\330.`\177F\001\267\341\013\0300\204\007\277\265\331\261H\021\201\251b'#L\374|\213\363\256\256\376\020\232\222\341F4\234\346\2441\360\207^d\003NNNxp\367E\354\016\027\322!\242+\3768l/\220vq\372\235\360\313AhGS1\266=|\310\316i\316\311\300\027r\240\227o\343\240C\300\364\266\203>,<\370\255\331\001\311\2644\313\311\t%\336\3241v\320L\027g\377\233;\303\006\325+P\255\372\324\251;F\036#\217\360\340i\017\370\030\2453\240&\362\243\217\320\036\201\214BhA\306!=n\324~"
+	.string	"a\266=F\375\004\320\317\273B;\202\004\275\315\004h\333c-rQ%4M\251)\313r\351\2560\\\323\276\306b\246\245\245\204)&<\n\224'7d\257\350v\335m\no\302dI\256W>\026\332\025\256$fC\332\302\215Z5\344\301$\006\310\336\322\346\304tQ\002\202\213\3446\236\336\025~\013\356k*f?r\"\227\003\306Y"
+	.string	"\003\321A|\351\210\037t6\354\2108<0q\001\313/\0209<\242\210\327\213GD\005\311\376\315\235!\341\bI\2663\257v)\306\"\311\264T\344\230]\262\361T\273Z\005\265\0260\256\024\023sI\255\004\2710\252\025}\216\214\224x\217\305x/\306\372\322R\361\006\220\275\"&\251\265G\031\3572\342V\344\226s\031i\370\2145jX\261\361vfS{\022?4\213\272\361,Xh\266\301\016\350\2643\033j\251\225\221i\231\343\273\321\307\225\223\243\2161d\250Q@G\031\")\322\024\244\240R\030\016\240\002\221\031+z\021 =\310L\rm4\214\001C\025\233\334\202#g\004\t{\211\202I"
+	.string	"_\341A\347\274wA\311\326\355\0204Dx\367r#\232d\3066\235\356Pd\370\210\352E\206\224.U\207`$\260\355`\264{\211\357zS\266]q\243\203\026\314m\276\310\n\276?\0324\360\370\262wo$<)\212<\223\276\354\307u\022=\364\020f\006\314\3074\b\2730\212'\234\217b\340\325\336\210\364.\337E\270\244\266}\266>\215\274\026\224XK#;\320\253\032\026\346d\200\032\340\371\347\030\332E\250\331\350E\016\307\303\325w\003\027\247\354\313\250;\322\r1\360\370\340\253\244\275_\243\002\365\322\315\264\262"
+	.ascii	"\252\006"
+	.text
+	.section	.gnu.lto_gpsResetSolution.62.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\224\001%\013"
+	.string	"\226\021C=\020\005+\035"
+	.string	"\334d\247 \032~\371\241\375\037\031\rY\243\354\004\250\273;\257\326\277\\%\376\327\232\333\227#\337\236\031\0214\204\002"
+	.string	"\212(\212PhJ\004\017\307\021\304\207,K\202\366N)."
+	.string	"1"
+	.string	"2"
+	.string	"\236\355\303\366=V\3315'e\333\211\345,f\271\335\255\264\343\252O\225\177\220\007\264^\253\317\316\302\356z\266^\0277\275\355\004\333\b\366d\b\017\271\310\204\357q\317\024\251\371\326=?\365\335\003e6\254\271\363\244\335\320\354\324\331\344j\322\230}\316\356\256)\314\026 \330\230\251\265]\327.\300\336\002\267CW\251\225\262\362%~\266\3504\021\364\303QF\367N\016p\273\227>{\274IiV\240;y\373\364\022\022"
+	.string	"\245\353\250\317\226\370\bj"
+	.ascii	"\267\273\n\016\016?'\222\250\216b\205\020A\243\032\232N\365\003"
+	.ascii	"z$\205L5b\034M\325C\3569Ka\r\0347\026\255p\270L\f\214\006\350"
+	.ascii	"/.-\031\341YVl\006\270\022#%* 0\003\031m\215\0013\241\217d`\016"
+	.ascii	"o\031\3038\036\f\204lf\2673\344qP\231\020\272G\021Ph\335\022"
+	.ascii	"\007c\232a\3069\230.t\340\001\371\240:4\347\240\200\311\226N"
+	.ascii	"\230\361\335\256d\367\004-X\r\276\271\251a\334cl\272\006y\035"
+	.ascii	"\002|\272E;\236"
+	.text
+	.section	.gnu.lto_gpsPreInit.63.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`X"
+	.string	"\r\t"
+	.string	"6P>< \3458\035"
+	.string	"\274\366}\020\315-\0030A\236,{\002\345h'\304\315\244\341"
+	.string	""
+	.string	"@>G.\220R\017\001\217.\235\030)\364"
+	.string	"\200\004\200\bI\026\364\023  p\226\265\366\273\355\235R)"
+	.string	"/"
+	.string	","
+	.string	"\327\374\3311\037M{\024\021\305\311\314\356\326\271\361\357\362\363\177z\2008\232\270\314\020v\327R\034]\334\363\266\007l\033\330f\005\231\213t\324/Z\205\220:Zr\345\343e%"
+	.string	"{\f\345\324\260\217\355,\331s\003\342r\360\332\265x\005\330\026\312\342a\373\2268\312Y\206J\013\027\375\222\247>\033\307iNm\357\343\303f\265\273\005\376\310I |\216SG\204\344\305S?\2449\375\351\004\241*\005\223\302\002\345\313\001f\350p<\320B\335<\265\301\223\360\251\235\316\253\034\001o \205\256:l[W\265\021<\266\263\204\2650\\2\340\f}\221\233p\264BdRA\355\202\001\016"
+	.ascii	"\300Io\206\265\375\027~i\204\003\003+R\tc\032Z\261\3365\034f"
+	.ascii	"\210GT\340\313e\3402/\332I\006"
+	.text
+	.section	.gnu.lto_gpsInit.64.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\364\n\3658"
+	.string	"\352^@\025BPdR\007\003+?\354*\235\237\204\247\234\007\324\231v\r\377u\301\320\222\267\337\307@\376\240\257V%\347\222\371\026$\214\343\237\024\001D\344$\b8\344\366H\305\034\374\360\307\bjF\266n\273\367\226)\245:\0016\001F\001\030\264\250\355l\336\326\035\354\037\276\326\036e\271"
+	.ascii	"m\225\345\234\203\316v\367\233\317\344\365\212\230\2712\352\222"
+	.ascii	"\021\006\353;\232\037~\246\307\n\315O aoe\324\234\241\017\234"
+	.ascii	"\355\023\316\366\243;\350\354\352hN\306\325:8\241K\0317\363z"
+	.ascii	"Z\020\317U\316\037\02264\017\256\263\ru'\230A;n\r\314\255.\347"
+	.ascii	"\314\344:;\341\f\003/s\263\327\317\206\270SN7\312\364S\2273\264"
+	.ascii	"\201\263\215\300u\026\311\005\264\316\256\036\240u\266\337nA"
+	.ascii	"\016\r\313\316\246\305T\243\346\234\217\030\254Y_\241\336\300"
+	.ascii	"\177\2358\024\006\201?\327\327\262+\376\267}\312\211m\236\024"
+	.ascii	"VWV"
+	.string	"\035\242A\205>uB\351\342\324\372\340\n\214S#\365\2513k\235P\245\013\027\346\003\017P\271z\342?\2608v^WY\356\256\027\314\302\210\371\324\351d\305e\330\344\274\213\263\311\373\034Lj\347u\365\304[_\224\013\273V\230\223\005\016\361Y\265\266R\326\200\005\237D~\205@6WV\365\272\332r\274J\370RD\r\361I\265\006\321\024\032s5\177\253\347\362\337\227!\347\334\337|^y\027\275\333\207\335]\325\rD\021U\274\036\255\2739\222\362\365\232Xg\301\373\350\374\035\363\362\202\241\302SM\2343E\360\335/\231\323{\263\221\226x\252\337M\3164\217w\277f\316g\317\200w\213\233\272\206\266\373Es<\032\356\370tC\207\017\037Zg\215\350\b\031\363\234nnG\304\003\340\242g\351\207\216\327\001\021B\204\210\021.gG\234\245\324\214\257\352\005 \020SI\0221\274\374zm\304\253\253\336\251\3617(^"
+	.ascii	"\\\232\2311e9+\275\331\356\306\345J\230@\201\242M\341mV\020\351"
+	.ascii	"r\316K\355p\316\206E\373\025g\273\305\213\367\346\213\326YW\363"
+	.ascii	"\005c\322%\237\350\235\362\367\032h\346\225\306\001\034\212^"
+	.ascii	"\035\351\203\347j~\002o\256z\227_\257\033\272|\374\325\355\216"
+	.ascii	"E\245\311"
+	.string	"Z\343)\335~\346\235t\344i\336\006\206\337F\303ocQ\361\273H\374&\016\277\207\300o\241C\275\203\3567\320\367\375\023~\273\302o\037\360\273\r~\263\300\357\365\367\215\335\357\367}\273\322\013\245\332U\030\224s\222\275Cy\216\205\323\342g\356P\3674\307\335\376&5!G\355\300\246\025\345k\355\223\"\245\362\360\265\0169\003\217\260C\035\311\201\027\341#\354U[\313\337\003\020(\t\327c,&ii~\253\257\b\007\261U7Q\352\305\207\237/\323\210\356\235\315\273 \366\341U\0173\021Q:6\200\314\355\314\305_\335\342\025C\261\270\305\255\0323Q\262\320#IV\335\247\342\220\324c\261\247\265\2137\222D\344\3667\337*\2717\365.\2278\201\030\234P\312\005Wa\203\325\3645\200\323\245|\231D\236\3712\005\204}U\002:B\305\255\227B\001DG\366\245-*\371\354R\254\340\237\274\306\006i\r\274\364i"
+	.string	"{\232\205\177\177\255\216\274I\336\233\006\260{\351\242\332k*\033\262C+\221J\341=\273\006\254w\211\320\255\320\224"
+	.ascii	"\334\234(vj1\206a\246\017\325\033b\342\210\234\226\302\272"
+	.string	"\201\370\241\327\311\200\260\2343\223!\327{\263^(/\327{\363\345j\235\305xI\354L\371{Q\234\372Jqs\246Zj/$\344\375r\257\354h\235}\354 o\207K\310\361Q\2373\"\241i^]\265\316\b\203\371\335;f\267\2525\357\032|\373\333k\345\305\362\3364\302\276\244+\232\365\307\375\255_-.\250G #1-\177s`\324\211\324U\254\351\n]\243\206\022\016\244\r\250\246\250\001MRH\251(\226\206\215\0319\2366HA=\221\210\322Ac\350\243IF\016\020MRH(\031<\2200\206M!B\214\030H\031LLJ\305&\031ONk\307P\212\322A\343\370d\343\230\303\006\322\351\030\003*\352\250d\354'\035MPG\251\247'\250c\020\252t<%\203\022/\273\035\215\357m\251\326)\331\210F\f\366c^L\233\361\307\334\333\372\325\362_\336K[\324\3218\222\262\020\034'\237\252a\235\235"
+	.ascii	"rm\266\b\221m\321\210h\256zW\224\363[\220Z>\257yW\342\333\223"
+	.ascii	"v\332$<\304GoO\336i_\351D<I=\357\315\"^\363\023<\305\347\253"
+	.ascii	"$\373\024\b#b\237\333\302\3223>,\371\207\251\237\312\203%\003"
+	.ascii	"\255\235\034\324L\332\265\316\016\261\357\021\203\313\361S\244"
+	.ascii	"\bqqn\013\013\234\\\022\3663/\321\245|=\274\2172\304\323\350"
+	.ascii	"n|\327\353D\001\335s%a\343C\301\361~\0011\005\261\317\332\361"
+	.ascii	"\344\207\225\342\246.\356N\346}\223\227\371L\226\274LW\211\213"
+	.ascii	"\037\210\235I\321\300\004\361W[\250\362;\302\303h\333\300\213"
+	.ascii	"\260\025\353\035\327\026\341\r~\250\336\220\007.\257\"\234A\371"
+	.ascii	"z\276\346\034\200\337\250A((\231R\214\310\210\210H\222$\351\240"
+	.ascii	"\002\021\241\262\316\001\021\020\261d\252HD\223\224\024\262\034"
+	.ascii	"\347\323\323\347\364\377\r\224\276\224\326%\240\006\301\204\220"
+	.ascii	"\030\233mf/\n\365\rvp\027\364\273\n\004P\242\307\r\273\253\245"
+	.ascii	"D\371x\300Y\236\340\312a\006-\r\312LC.@\f\036\210l\377\371\236"
+	.ascii	"#A\361\004\241\033st\331|F\034F\271d\334J\356\277\036\n\345\305"
+	.ascii	"IBI\267\370\003\264.\367\250\230\334K\212\016\272\237\333\224"
+	.ascii	"\034Z\352b\266\336\032\307\200\312\211\034\005\r\342^\260\276"
+	.ascii	"'2{\352/\267H)\220\020\211,q\003m\357\230,\002\343\003|\321\276"
+	.ascii	"\271\303\342\265l\340\353\0252\204#\225\273\242?\342\263\321"
+	.ascii	"f\320\366_\265\266s\261\f\257\221\347\311L-\256\344\262\003\210"
+	.ascii	"\374V[\021\301\n\336\241\243\364\r\340\351u\027\024\377\224\264"
+	.ascii	"\n\207\002DX\267\377\376\375\236\376\271+\325\216\226-\031@\374"
+	.ascii	"/\177\253\375\267\007\227(0\362\206\321>\262\004u0:Q\264\016"
+	.ascii	"\271X\221\3223c\245\261\212\034\347\307\2151\356QK\352\201\215"
+	.ascii	"A\232@M\260\231\2409\372\222\313\021\320\231\202&\224\327\237"
+	.ascii	"\033L1$\367S\013b\347\241kq\034\"\332\244{cvj\316\025\214\001"
+	.ascii	"\256$\231e\n\2438\347\322J\272\263\332\036x\364\214~\216\216"
+	.ascii	"6\311iv%\244\266\237\200_\256\211F_\277\341\331\006\264z<\207"
+	.ascii	"\335\253\242\220\234\374\262+\346\321\231\267}\016l8m52\233\240"
+	.ascii	"\\\264\245+\255\320UF\347\2514d\324\214\213\312\017\0075\bxa"
+	.ascii	"\302\360V\232\336\322P/U\207\351\350\027\336>\003\375\315\024"
+	.ascii	"O\243\225\220s\262{E3U\003"
+	.text
+	.section	.gnu.lto_gpsFakeGPSUpdate.65.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\377\016\205@"
+	.string	"jkP\027AP\344\316\030\243+m|$\307D(0\203\001X\250a:\354\020"
+	.string	"p\352\256\t\243\307(\322T^\3450\307\213\344\"\242G"
+	.string	"\004\241\200\221\342"
+	.ascii	"}\007\324\355D\266\325)\212!,\264\211\2242\245\224\002[\001D"
+	.ascii	"\001k\001\316A\2553P\353\234l\235\333\326\031\331:\037[gc\353"
+	.ascii	"\314\266\316k\353\254\"\235\037\351\354H\347\026\361\264\207"
+	.ascii	"M\310\\\215o\003}\317\026\367\274gV\351\222\346\353\366\353\006"
+	.ascii	"\354\016\354\026\354\316\353\206\366\321\215\216dn\356\275\346"
+	.ascii	"\302\374\3030z\0137\241R\334\033\266\273^\245\203\\\312&\364"
+	.ascii	"E\213\240\227x\227\370\340F\024\353-\205\321\203\\*\364E\233"
+	.ascii	"!\267\345N\252W\346\"\023\305m\205\273\257\377\372Jc\351,\035"
+	.ascii	"\255*\243\005\311\n7\202tZw\002\353F0\001\223t\310\341\347\245"
+	.ascii	"\304\356}\337\f\307^\255\200\360y\005\316-9|\337w\302\261W\356"
+	.ascii	"=\030\314?\27563\rn\275\256\302?U}P\031\312\346\320\333\234k"
+	.ascii	"\263\223p\354\265j0\252\357\032\217F\347}\035\303t\034\377\256"
+	.ascii	"\310\035\276/tA\257\354t\354U\331Gl\257j\027\261\275\262\003"
+	.ascii	"+\032\3546T\356\314\350\\t\366%\276/t\371q\3556\362hdW\365\335"
+	.ascii	"\345\016k\244\221\202\232\027Us\227\247\310\216\265>6s\255\215"
+	.ascii	"?hNg\325\244\036\247\232F\243CM\245\032K\024\322Q2_\323ZmF\307"
+	.ascii	"\374\203\320\234\252\362}\337\256\322n\206&\346n\244\360\276"
+	.ascii	"/{\031\332\216\346\266\231Y\216\231c0\007\021\006\274"
+	.string	"\374\343\253v\300,\277\005\215\277|\317BV\206}\365\215M\242\255\207\215\232\357\313tZ\237\375&\0133\365\353\257\205d\207P\257\276\232\205\3540)\365\002\365\255\245?\2701]Q]\037\316[\375\267\376b\377?o\317\215\332_\254\377\177;\325zL\223\371\342\256\343\017WWl\257\376Osj\035\355\276!-D\343\357\373\206\275\232\376b\247\336\304^\231\246\353a\227\022N}\347\365K\375\324\267\0352;1_df\020\rF\306\361}\337\007\334^\372\213\b\356\272^\231D\t\357\262\022l\257\375\t\346\362\230\276\310.\035\224\372\206\266\222\351\212<\344\314XY\336eR/\302M\354\303\230(\217h\n\232\256\322W<\240y\350\274\256\310\f\025k\365}\337\327\037\216\271\325\367}_\3767f\244\363U\3635[\265_sU\0036Su`s\203\026l^v^\363TC\233\245\3309*\351\f\205t~B:'"
+	.string	"rF\320:\037h\235\235\200\234\r\264\316\005Zg%\2203\201\244sS\322\231)\351\274\224t\036\300\316\002\330Y\211\235\003\264\316I\2553\322\217\363\321\217\263Q\353\\\324:\023\265\316"
+	.ascii	"~\234\207~\234\205\332tIr\357\373F`v\215x\232\013\327\243\300"
+	.ascii	"\033\370/T\276\372\005^-\354\240\374^#\\\253k\227.\316\317\\"
+	.ascii	"\272\034MS\304\037\004\346\374\206K\347f\004\322\0264\263\233"
+	.ascii	"\304m\324p'\217\246%>\326t1B4v\231x\230\327\321\224]'\376\272"
+	.ascii	"Oz]\374\2762:\213l\273\317(\275\307}*&M\021\371x\273x,\263K\245"
+	.ascii	"\023]<\241\351\235\306\343\352U\260`\201\355uI\016Q\261\tq\313"
+	.ascii	"\352\231\276\211\316\026S\236\245?\3542:U?\340\227\276\311\330"
+	.ascii	"\340t\034/\027\0300\260\275\016\370 C5\255\037v\275\206x\006"
+	.ascii	"x|\270v6f\207O\343\303Y}\b\2704{\206M\327\323\202?\316\034\262"
+	.ascii	"\017\307\256.\350\307KS\362^\246\271\220\205z3\227\025\360/\224"
+	.ascii	">\300\013x\347\343T\0233\354\252Wz\225\214S\352\305B}\200w2\316"
+	.ascii	";\2619V\337|Io\205\224t\364HF\177T\364FT_d\246\352\333\217\350"
+	.ascii	"\253\226\034\3003k\360\300v\031\321+\207\036\300\377\032g\037"
+	.ascii	"\346`\347(c\033\323\003O\212\335\313\354M\241\037zv\rY\230\240"
+	.ascii	"\027\372v\366i\360A\257\026\222\241\372\006\004z\252\344\037"
+	.ascii	"\037\210C2)\025\323\340;\260\375\006\310?~\333D\3119\332dcoP"
+	.ascii	"\225\271\203\007\3572\3447\023\267\346\207\005Z]X]\\\353\t-\255"
+	.ascii	"\026\\k\226\261\013k\205\005\026[*\332.,\025\307\013,\266T\034"
+	.ascii	"al\261x\206@\225\225\205u\"B\204)!\254.\025Z'V\316\232\342j\201"
+	.ascii	"b\271\225b\311\"\005\326\212e\326\013\256\345\224\021o\265\320"
+	.ascii	"z\261\354\332\332z\261\374\2012[}\377\215\215\206{\376\242G\217"
+	.ascii	"\333`\370\374\213\032\333MG\275\0313G=S`\276\030\262(\261;\332"
+	.ascii	"\3075mvy\016\257\276\215\273\221a\250\3665\227\253\35747\017"
+	.ascii	"\f\222\246\233\013\203\031:\033\256\240\251\257A\232\023\302"
+	.ascii	"\344\322m\340\032a\207\030t\313S\207\213mi\321\235\rn\234\266"
+	.ascii	"\f8`r\232t\346\224\311\340\314`v\300\360\024\215\261\340\375"
+	.ascii	"\366\027\313\f\246\b\306\307\273\214\225b\236~\214\367\027\233"
+	.ascii	"\340\237\276\235=\034\314\027w\035\203-^%x$C50\n\302\274K!\227"
+	.ascii	"B!1\037\334\022m\"\374v\237c.\350>\261\004N\007\371\234\016\370"
+	.ascii	"\347\236\371-M\365\2366|\317}Zq\317\2520M\361\204\364\314<\317"
+	.ascii	"MC\222\303\341x\356\331\035\023\225(h>\345\371t\323x8\0247\355"
+	.ascii	"\t\222\\\224\037\356\244\t\223'k\276DI\022\002N\342\202"
+	.string	"8\035\2229&h\336v\207\370\021\027\251\315\341\\\"o\007\246m\314\316\346D\334\332\274W&9\304!\b\244\\H\020 \007\036\201\323\253\177\200\203S\020\003\317\314\f\334\207\033\201?\250aH\007\021#3\"#A\222$Is\001\006\204\020\005\241q\003\021\360,e\312\f\315\314\244\240R\330X\003\003p\347\031L&\314\004\366(`\245\177\250;u\227\221\033\236\326S\374\031hhy\226\235r/M\242xP\252\311\307\234\265\272`\255\311QV\223\376\254V\346\253\032\005\250;x\231\177\225\"N\023\304I(\256U\002\266\273\313\002\314\320\252\356\204Pvx\305\235\021x\261\006\266\240\026\251\246\354\265\004\376\355xg\016\276\205\b9\204\305\3044,>7\033\020T\023%\342\315\265\037\020\377\316\252\020\370\004\205\201N\266w\237]\340v\017k\212\001\2479\315\177\n\204\240}\272\003\344\2552\326\364\002C\230tn\202K"
+	.ascii	"\003\264\351\224"
+	.string	"Fa\230\373\314Q\202\231>\343\360\270\022\205\206\tl\312\243$\207\330P\334G\nS\375\254\324\306\371\314\324,B}\352i\001\022\177~\\\212T\035f\360\005\370 _$\377\240\002\230\225yb\3350)\240\373\235xv\202\034h\001 \204\277\306\321\2208\f\3653-j/>`q\004\343\304d|\020\240\355\023\031\0060\r\036\206\260+\n\220*\206p\222\227\006\243#G\336!>\344\200o\021FI\340\267\b<\370L\016\306\305\260*\343\331\235C\311aO\202&l\363 \017\261\013T\370\321&\372\022 \034\013LO\353\262\b\024\340\351D\336If\231\2513\343\211\016\r7\026/3.0\254\350\251\372\244`m\030\245\265>\"\347\245\202(\256\304\251\345\362H\036RL\216\030\374<a\024U\373@-\260#e\330/\341\241\013_AS\257b\177\243\270\241\276\023\361hT\331(\376C\275\272\247V\225v\017\025\335"
+	.ascii	"mD\330\027v$\272 \232\340\236\313\237,\300b\322w\210\021\344"
+	.ascii	"\252<%}\305\006\005\016\302\034*"
+	.ascii	"\374\245\330%\367u\343]\007\371sa\265#\362P\304\026\324\334`"
+	.ascii	"S%\254\rz\007\267\301\246\nr\005c\214\304\224*m\336c\366\322"
+	.ascii	"\203]x\362\217\341'\005\377j\304\247\031\214\303\004g\333\203"
+	.ascii	"X\273\205-\233\b\227\313\350M\003\325"
+	.text
+	.section	.gnu.lto_gpsConstrainEPE.66.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`9"
+	.string	"}\b"
+	.string	"\206P<80\345(\035\036\256!b\364X(\212\322y\320`\034-\202\370/\006\264\373|\267\265\372\275\370\330\013\353\203\217\234\343`\320\n|!\302@0R\241\303F\204\260A6\2212\245*"
+	.string	"-"
+	.string	"*"
+	.string	"\247\026\314n\204\005G\310\376\362\006\331\237z|\364\034\371/\371S\251\270\240V\244g\200\304\356:Q+\215[o{\3016\204m\224"
+	.string	"\226\345\245\200\330\026\331\232\375\240b\310\264?r\022\321c\310\003\273,\327\311nl\260\202\300_\006\263\355\207\\D\344Q\306\017U\346B\005\245|\331&\251\207\262\324+\326\312x1\345\313\032k3\306\216\244\324\016\373\330*\207\355\264>\376\251\351\277\204\215\226\211\225\335\324+\216p\340\270\r\205F\263\021p<\0345\267\201<\025\260\353\300\213\316\306\002r\037\020\334\016\334y8\037\210\321u\037\250\305\275U3%5\371\252\372S\200\n"
+	.ascii	"v\221'3 \f3\022\256vMd\310\202\230`\202\200\023F\252\025\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_gpsConstrainHDOP.67.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`:"
+	.string	"\215\b"
+	.string	"\226\320<80\345(\035\036\256\001xpj\255y\340\2368\243)xJ\2447\030\260\215\246[\366\353\367\342c/\254\037\327\354\013CA\243\224\377\346\022\260\375\005f\256`\364 \233H\231R+"
+	.string	"."
+	.string	"+"
+	.string	"\255\325\210\314n\204\005G\320\376\362\006\332\237j\374\364<\371\027\371{\265\244\260\\\250g\200\303\356:Y\256\327\255\267\275`\273c{%\255\030\200uy,\034\266M\366fs`\0302\355\203<\304\364X\362\300.\314De76XA\340O\223\331\366=\376a\362)\343\306\205V\022_\005He\314Fi\275\244\245^\263\023\213\030U\306\274\3016g\354\210J\315\260\237\255b\330N\353\343\237\232\376K\350xy \331\r\356p8\356\003\362x6\004\242\016$\221\231\333\220D\021\260\013A\212\320g\002r#\022\334\034\270\023A\214`E\327\215\340\026\367V\325\244T\345\253j\n"
+	.ascii	"\177\221'3 \f3\022\256vMd\310\202\230`\202\200\023F\252\025\223"
+	.ascii	"0\311"
+	.text
+	.section	.gnu.lto_gpsUpdate.68.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`O\002\215\022"
+	.string	"\346`wH\3200'\035\370\210\227P\366C4\224\323\017\334\313o@\240\251\30240\002D\214\237\366Pal\243\252\302-\377fm\337\306\312\037\201\033\266x\223\033\016r\213\346\265"
+	.string	"\005P\253G\341\227N\250fd\005!\204\220-eJ\001f"
+	.string	"Z"
+	.string	"c"
+	.string	"Ws\336\304\335\360\327C\360\363:\271\372\362a\017\023\240h!\002K\203\r\316\301\316IJ\352\223\bd\256r\036US\223\034Y\263\025-\332L\275\01755\t2\347\264\240\335c8\227k\305dcQ\202v\363\225\006t\234nZ4\031\351\001e\213q\241\353\005\232L\365#\231sZG\232\315\r\340\2661\330\016\2615\026\017\214^\304h\226=\375\374\213gS\250\240\037\277#;1\013\363\205\316"
+	.ascii	"\304\024\026\325\324\032\366\r\246\333c_\316\345\261\255\356"
+	.ascii	"\260:T5\250\352O\325\236\325\235\252\245\252\327\352\177|\tw"
+	.ascii	"E\243d\306\23449\033\363\251S\002\262\rc\267|`\004\306\257\337"
+	.ascii	"|h\336!gv\024YS8o{\210\336\005P\033%E?v;\262#[\230=B<i\222\025"
+	.ascii	"T\206n{~\234\255hIr41\311=\372H% \227\313\335\370\213\267+\367"
+	.ascii	"\263\232Ls\366G\274\350\305\367`\225\225\316_\361\336\355~\270"
+	.ascii	"\250\3054\347\017\245\250P?t\333%A?\032\204\243))\352?\243\316"
+	.ascii	"\323\372\345}\003>\021qaI\021]*b\004\025\023\b\342I\213\213("
+	.ascii	"B\300.\026\224\026q\202\313\325\"\266n\363r.\217\277\231\241"
+	.ascii	"\031\022\330\261\027\372\002\030\034H \311\023=\334\031\333\341"
+	.ascii	"\232$\266\262\260\244c\025\004\341\200\234\206~\300*\360\304"
+	.ascii	"\215\376-h\342\233R\021\025\202c\253\372\n\004\275\201\347\355"
+	.ascii	"e\030\245\030\240\266\003\023\375\350\355\353>\0011 \220\002"
+	.ascii	"\0211k\007\344\021\232\311R\370o\271\327\240\205}]#\214\311\033"
+	.ascii	"%\031M\b7~*\273\004\007\267\2143\013\301ga\325DS\322\3172n\227"
+	.ascii	"I3\361\320\234\260\252\3131\231A\264\215k\301\002\346\302nK\313"
+	.ascii	"C\232\335m\352g\t\251\006\342\302\240\005\350\207\267\222\200"
+	.ascii	"D\022\204p\237\301\326\020\017\031n\342\200\213q\3145\306t\264"
+	.ascii	"\242+C\001"
+	.text
+	.section	.gnu.lto_gpsEnablePassthrough.69.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`=\004m\031"
+	.string	"\326l\235F\260\332*\035P\243\301\366u\006h\313\331\324\360\346Rq\327\363\017\300L\266\253\353-`\245\315\200\302\256\342\2776\216\365_b\006-H\317\006yz\t\336\367\311r.j\346\254\322\307GJ\266\255\021B\b\331\204H)S\210"
+	.string	"|"
+	.string	"\215"
+	.string	"+\036\303U<\235\345\177\225\354\222\330\352|6@\2558/Uj\3359\270\002r\305\357\366\206\256H\356"
+	.string	"\272\342c\377\230\335\001\251\333\343Asr\246\326\232\352\037\2477;\266\345I\216\324\024\233c\337\365\021\244cK"
+	.string	"Gn\354\271#\001\022[\016&\023\364\b\022\332q\2016!\032S\363vcM\326\261\242\215\355\220\201\221\0253\246\333,\274\001\"R[\3362\215\233\f\346\361B\255\365\\\273\005\355I\373?\311\377\f\177\370 \377U\254\023\037\262\326\252\363%\332&+\276CV\274\253\005om\305o\013\272\342v\251\213\301G_\336\232>,\300\312j\376\235\214;\367\357n\261\ty\343\376\325\355\242\226\177\242|\223\310/\205|\022\345\237\"\337\\~\031\362\311\345\217!\237\206\374\260\371\275|^\376\036(\200\004L\n(\265\002\035\255\251E\342\225\"\377wy?U=\235\b\022b\273\203AV#\343\223^\022\243Zk\203jF\017\224\354\027\221\030\002<\366\017\"\004o\215\354\nC?-\303rel\007AH>4@3\3002\354#\003\204\240\352\201\363e7\254\265V\332\271] i\214\252\230\342"
+	.string	"\246\315\375\213\030q\016\315Z\366\245\262\335\264\3070\264\032\354\373\375I\226\242\356\334\377\0054\354\022D\301\037Ns\336\005\264;\354P\013MH\006\037\375'\261\275\325\224\027,r\210\017]\261\333@PJ\024\356\233 N\027\024N\226\022o\377\255\035\336\332\021\374\264,\254\375\004\025\213\2652A\201B\316\251\347\345\352\200\242\345\302\365B\321\003\203\255:\300xZ\002\316\312\201\361\264R\256\235\024\213\235\325\212\024\353\005K\345\240\356\3429\361J\365\270\\\257\3249~\033g\352\023\230\242S\227\272R\233~;L\240J\375\301\364\313\361\303Qv\356\273\314e\006t\344l\234\226%\241H\244\237\215\0026\322"
+	.string	"\237\215\352?\203\206Y\313n\366\331Kks\304$\005\214\031\273[\013C1\270\354\177\003\007\336\232\331\b\272p)\033\0254\371\330x\370`\362\005V\250Q<(\241\031\222\200$\210\302$%\311\001\220\002\031\251R\017\0208\211\206F\325\312\001\325\355\327\026\254\262\323\367c J\233-\025\340'\202\242k\320\233\235]~@d\201\235\247\217\304@\0334\204\202\310\246\204\254\013\231"
+	.string	"\371\215\246\3434\257G\032\336\250\2562\344g\213\221NB\2445\221\217\301\003\017M*G\212\370\245\230\346\023Y\303\341F\373_9\340\301\210\273i\004\213\257ZN\240\354\b\t\350\247n\302a\312\2006\363\323\276\2761\301\265\375,\213S\301\236\352"
+	.ascii	"\235\323\374\022\246\376\271\347\001\022F\256wn\262\266\311\314"
+	.ascii	"2\007\017g\252\177njO\211\353\017"
+	.text
+	.section	.gnu.lto_updateGpsIndicator.70.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\361"
+	.string	"\305\f"
+	.string	"\346\330XC\020s\223\016@\026\bE\005\200w\211\316\225\021P\203\304$\202\257Xq\323\300T\340X\252\362,6j(\335a\037:H\332\201\354\264\246\344\001@A\261\376\020\250|i\005\330\nf\004\026f?\331[\312\224\002D"
+	.string	"A"
+	.string	"E"
+	.ascii	"\326#\346\006\254Gs\366\216\177"
+	.string	"%\366\250T\351\005\217\335\275\224\304\271CM\316\377\351\231\316\033\035bP\2560A\212\r\224\001\336\t\\\3402B\307OO\017\036)\023\344\263\273\316\316\003q\307\333\226`\373c\337B\207\273\273V\223\375\226\337\212\351\250i\250i\205\351\324\364\001lh\270\210r\354~X\375XU\234\201\"\323\376\307\331\032\273#\302\301\363'\237\345+\270\267\224\274\300\256\tF\214\335\257\201\025`\036\375\035A]\212Ju\205\301\243^pq\343${\030j\324\243T\257P\337!\005)WNU}\351\305g\361\026%\276\ts\330\362\335\243\277Y\217\251\231\020\226^!\252\364b\222+oX2\245\002\307\246\017\373\033\245\256\330\001~\320\301\260\020\f\036\017\207\300F\001$\nM \021\001i\332\006L\2001\3166\222\341\312B\227H(Dta\332vq\0168\033\001i\027I\226i\227\346\333\303US\205\032*\023%\031\202J\004\225"
+	.string	")\0310\223\226\332\231\206|g\250\243\347\211\023"
+	.ascii	"\200S\340Lh3\n\354\340\035\3213\f\326p\214\274\204\312\352#x"
+	.ascii	"\270\271\313\316a\013\025\343K\250\225\353\327e\340\351\002\212"
+	.ascii	";\027U;40\005\005"
+	.text
+	.section	.gnu.lto_gpsMagInit.71.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\027"
+	.string	"\345\007"
+	.string	"r\017980\221\322\030"
+	.string	"\376O9/\245\330(^\034n\034\325P\365\332\330\301"
+	.string	"\233\304$F\303\026?\374+\373\277}\244\226\202\202\204<\242\214\346\341\215\214H}G\033#\261{\313\024/\210\272\216\3640\032\205\002\"J\016&\022\212\273\013\261T&\351\235d\352DB\311n\305\222!\202=Ui%!<o%=\377s\225\2631\266~\\\034\241\205LD\212\013d0\237\026\031\215f\241\315O\027\214\033\257\234\335\335c\354\241\272`\314fR5\273\257\233\332\276l, \177\353=/\2528\200\360\265DMZz\"\241\002\2731\222\225\335\2110\250\243\333S?\234n\035\035\340t\373OPh\375\351\354x\351\207\214E\312lw\312\310\241\237\302oU\024\005\211\3244bT`.\205"
+	.string	"\r\273;\274\200e\350Q\177\203\237\341\367\b\007"
+	.ascii	"\022#\360\36514!\024KHu\315Kx\b\363\272&\031"
+	.text
+	.section	.gnu.lto_gpsMagRead.72.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\272\001\235\r"
+	.string	"\226WVC"
+	.string	"s\224\016,\001N\367:\254H\bp\313b*\210\210\216\251\250\357\221(\220s\351#\314\027\237r\024\221m\310\241\375\037\301\263\345cH\377\273*)\250\355\373\002D\265\334l \307\221\324n\353\271\255\224)\005A"
+	.string	"="
+	.string	"G"
+	.string	"\255\0201vC\315\n0\217\016\277\311\0361/\220=\332\266\007\302\312\337C\023\222\177\200qH\321\262\033n\352\341\337\363\363O\342\027\037-) K\344\t`\302\356:AV\311\255\267\315\300\266\004;+\004\031s\256\300xl\302\354P$\265\203\375\313\356\256\265e;\235\271\353\217\232VM\247\246\037"
+	.string	"A\311\016\257\307.I\f\310\352\210/\020\266W\266\306\366\2604\310\264/\342#Vw\205\234\300n\227q\0323^\267J,\025\306\013\355.Z\260\310 \327\025\335\001\322SL\030\025\251\013\002XPB\262GU\001\177\330vp\024\235\006\262\275\2370-0\331\335O\211\233@\371(\217\316\240\312\203\217\276*{\274j'\257\221\216\360\200\343B\026@\240\316"
+	.string	"\r\"\n\243P\227\231\353\240J\243\315#m\030H\241n\343N\250\255c\300^It\332R\236w\3324\341\376\262\332\312h\202\021\335`\233\373\312\307\371\330\242\343\030mnd\224s\342\312\301R\265Q#' \300\242\241\322\016\tI\221\215\007\226\321\272\rE`\rf#\037\322z\334F\031\222q<\3500\377\020\343>\330\376\3555\326^F\253\265\251\020\215\243\243\3033\032\307\301tR\020^"
+	.ascii	"\301\273#7k]\244v\006cG\0048\342S\374\231\204\202f\266t\177D"
+	.ascii	"\323%\236"
+	.text
+	.section	.gnu.lto_gpsMagDetect.73.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\345\002\315\026"
+	.string	"v*\227I\240VN:\224\233q\3124\245\005\007"
+	.string	"\035\276\311Q\220\273\275c\346\030\227\\\266\\\201\257\300r\353m\307\324\332\031k\366<\321\334z\343\036\266\313\364\032\257\004\347%\360\261\025(D\336e\274\235O\335\0329\236\330\275\211\334)\005\207"
+	.string	"x"
+	.string	"\200"
+	.ascii	"\300\307\320O\361/\364\323\266g\024\024y<\360I\3510\220\216\250"
+	.ascii	"\234\324\n\234-\213\217W\021ct\206+G?w\025ZX\024\250\260\025"
+	.ascii	"L&.n\223\253&.\035=\021\217\205\tf\200\270\372\326R\211Pf\325"
+	.ascii	"$\206\254w$ih\240\204\325\220\226\336\207\360\205kF\023R\357"
+	.ascii	"H\316\353L<\364\320\322\333\311\r\013\240\020\"B\3263\nc\214"
+	.ascii	"4!\371\3572\251\267\2232fSk\265\344\365\230\356\225\333^a\233"
+	.ascii	"f\357\003\013"
+	.string	"ZH\351d\360\322\007\023#*\326#\375\352L\035\331\311'^\221\257\357\2416n\203<\357K\243b\2679\377w\034\260\2540%UB\261\2019\271>\373\033\f\006\203^'\373R\177\213\245E*\035\233\322\324\3223\224\016Wz-}\2273\251N\300\204\270jU\nF\251E\346\017\030\266\213l\231=SE@J\373P\217*\272\024\321]ju\202\312\252\025x\300\003\304O\007R\376\001\265!D\220\347\305\226\216\370\211\272\323A\327\347 JWg\312K\302\177\004\321\236|\340\004x\312\242Kk\021\263d\351D\214\242\256\346\372\276\271$_U\341\372l|n\006{\302\261\306cu\331\035~\2053\353\252\265\326\3548\017\n\025r\344y9\364s\356\261\274,\334\352\202X\353\216\346\347\020\252\335\305\020\375\f\367T\266m\257\032\022k\2554\377\306\251v|\027\237\346\271M\377F?w\003\246A`\263\3250\324\324\310"
+	.string	"\340\251\365\254m2@><3\334m\246\341V\353\231\331~\200f20\306\371\354\374\3148\340p?3\031\260>\254\353d\372\225\002G\017\361\037\351\177\277\371J\302\321#\274\215\213\213d[\\\333\350\326(\254\265V\025\251\365\2431\326\270\2201JjEm\215?\0060]\265\352\316\263\033<\210\003 :7,OD\364\363Rx$<\205i\211\206\310\242%c\313E\300^\204\210\255\317\007\242\261\335'S^\002\0025 \240\"\2213;\366\345\215\021\332\332\304\343\312\3026s7\013\327\005C^\r\364@\302O,7\262.Z\341\226G\254\226 +kj\304\322;\312Y\354\224\342\206_\3160m\243X\250\355\272\226\244\246\030\001,'n\317\207\256e\016\372%OK\262G\023\216\205TA\303\021\306\205\366"
+	.string	"\264\300\013\207W"
+	.ascii	"@/0|<\331\0346&P\r\361\220\\\273|=\013?\236\242\2525P"
+	.text
+	.section	.gnu.lto_isGPSHealthy.74.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375 \313\365\005"
+	.string	"T\nv"
+	.string	""
+	.string	""
+	.string	"\""
+	.string	""
+	.string	""
+	.string	"'"
+	.string	""
+	.string	""
+	.string	"\001\003"
+	.string	"\001\222\221\212\002"
+	.string	"\200\200\200@\007\002\001\201\221\312\347\243\326\267#\001\273\001\001"
+	.string	"\177\002\001\177\001\247\003/\300\200\200\370\305\207\252\257\001\217\250\300\001\177"
+	.string	"}52"
+	.string	"\013"
+	.string	""
+	.string	"}"
+	.string	""
+	.string	""
+	.string	"\257\322\005\340\200\374\377\217\200\200\337z\361\370\320\365\001\002"
+	.string	""
+	.string	"\244\003\200\004\001"
+	.string	""
+	.string	"\245\003\002\201\300"
+	.string	""
+	.string	"\373\002\200\262\371P"
+	.string	"\203\003\202\260\371\270\003\006\177\001"
+	.string	"\244\003\001\200\300\013/root/repo"
+	.string	"\024./src/main/io/gps.c"
+	.string	"\b"
+	.ascii	"`\b\330\350\220D\b\3145</b0!r\270s\257v>\001"
+	.text
+	.section	.gnu.lto_isGPSHeadingValid.75.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`v\001\215\r"
+	.string	"FZY@0\215\223\016CK-\016v \203\201\312\315\035\f\234XG\255\001g\267\270F=p\362O;[\263\244?\021\334\216o\301\335\3178/\016\006\371(t;\035\023\3470\270\016\330\315\210%{o)S\nI"
+	.string	"D"
+	.string	"D"
+	.ascii	"6\306\006\016x\370s\f\003\310M\246\321\t\305.\006\365\302?\247"
+	.ascii	"\236k\232\037\237\312P\020b\345\003\351\262NU\370\033\245\223"
+	.ascii	"\220\rs\211R\001\\\023\332\305\356^\303\363\343\neR\031\273\353"
+	.ascii	"$]\024n\313m\207l\017\260"
+	.string	"\177\n\273k\251?\357jAbRB\224)\\\345\367\361\331\017<y\3225\201\005\221Z\306\210l\256\330\230\225:b\277\255\226l\247+\227~-\3554\3352\255\231\376E\300\t\022\021PvA2\025\233\342@\230l{\004\273\353\3343\257\251\2320\031a38J\306\262\273\b\374\323O4~\311\23576\233w\327\364'*\033@\231\351[|\252)\222\217/U\365\243\220Pf\366\261s\210~\2119\034\316\347xw\251P%\004\224\3313\326`x:60r\240\003N\246\001\324t<\020#\200c\307F\007B\210\261\0031\330^K\316G\340\351\n\374\351\207\355J/@\032\362\323J?Z\001\312\354B\351\210ESv\255\247%g\206k<\247\026$\013\356A\243\203\323\213p\306\002  \320\202\031\031\355\314\004Lx\343\271d\221\220q\016'!\213\253\220\204\\\241\234((;J\246\306\216\3212\n<z\260\340"
+	.ascii	"\026\320\037b4\206bM\214\332\201\265\020\250\215L\270\317s\234"
+	.ascii	"\315b\354\206\352F\301\351\355\312e"
+	.text
+	.section	.gnu.lto_gpsUpdateTime.part.0.110.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`I"
+	.string	"=\b"
+	.string	"\242\017770\217\222\016\260\\XJC\035\230hM\341\004}\030w5(fa\363T\3511d\367\323\201\222\327\324\227\242\303``\025\023$'\001\\\265n \003\376\260\2364Bd\n\203>\245\221C\314B\361!\304 \212 R)~\006\316F\r\244\030\221e\244\310\371]\261|\253\027Z+\251W\361{\217\365o\\Iz\"\352\270d\246\272}V\023\b\002\227\314Lx\265\244tA\n\2270\271n\205\327\004P\370\023\024\256\333\005\026\017u'E\204%]\214{\254\037V,\337\352\237\347`$\023cF&;\240J\310\327uz\316ui\317)l\353?e\254\375K_\037\251aq\\\240\300df,|\036\325\372\034\246\335\272*\260\251P}\033\225F\235\247\230F!3\017\330\350\260?\302o\360\267\004\020"
+	.string	"n\023\030\017\007p\2307\233\241"
+	.string	"\362\300\bW\f\013\023a\316"
+	.string	":\003\264\231\262\323"
+	.ascii	"p\355\305\224\323r\372\265e\f"
+	.text
+	.section	.gnu.lto_updateGpsIndicator.part.0.116.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`$\001\225\r"
+	.string	"\266\231[D\020s\223\016\360\027\346\007P\276\343\t\357\001\352s\332R\320\206\006\321P\213h\240xxxx\b\r}\264\277N\377\b\"i(\256\226BJ\036\n"
+	.string	"\024\347)\202)\217\320\204\200\373\f\360\356M\032\331[\312\224\002C"
+	.string	"F"
+	.string	"F"
+	.string	"\326\243}\025\266I-\356l\035\377L\354a\2504\304\370\330]\354QK\274;\324\214\235\257\361l<\223\312az\246\017\327"
+	.string	"&\026\230`w\237zn0\2252\007<j<\273\353\013\304m\335\266\004\333\036\373^'\033\246\365\337\237\232\276\346"
+	.string	"\204\032\273\034VAvD\234q\302\366\355\247H6\307Ou6\307\244\243F\b\276\355\3202\022\202A\346?\177\305a\272\243F\027\260{\222\211\261\373-x\264\202\353\321\337\rX\217\327\t\004\037Y\251\252p&\203\210R\256\034\242B\341\330\004b}\356\256\212\252\013\374f]\025\005\013\033,\371\3036\350.\266kw\033\370-\036\203\301\177ytH\224\367\036}\221\365x\025\311\261#\005\314J\256R]\254\361p5v0\222e%\026HH:\"!\n\037\2206!\345\344\303q\242\f\200\263N\b\345\002\266i\330\211V\002\3022.\204u\nxC\371pX\312\266q\030\347p\365T\201\306\215\025-\371A\004\022!*\031P\325\227\371\213\221\377b\315\304\304z\314\031\257\307\306\003\217\032"
+	.ascii	"\200#\320\202bLR\340\032\037O5\236\302\032\300\320\262\271\226"
+	.ascii	"\270\312\214\344L\303\036\317M\203\340)@\3462'M\263\275\004+"
+	.ascii	"x\3269\237\001l&\3574;\\{E\341\322\324\224\340\326k\313\030"
+	.text
+	.section	.gnu.lto_.symbol_nodes.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`\247\006\375\030"
+	.string	"v\347\223J\200VR:\240\315\002\360\260\203!}@\324\203L8A\375\203\357r\345\366H\365x\361\272\017\002\216\3709&\244V0G\2707Qn\377R\201\002\n(\240\200\b\314\314\f\023\351\363\223H]J\2308_\2439$}#M\222\235\002\200"
+	.string	"{"
+	.string	"~"
+	.string	"_\236i\307!$\372b#\372J\021\375$g\210~\362\004\361&\372\241\307\303\020\355p*\227\207\020\037K\016}\260\r\235@\303\016\232\301\007C\037\235\027\356\304\302\265\240\025\236E\211\302\335\320\t\375\260SB\033E\320A\217]\020\232\350d\260\007\227C{8\350\2079\211]\204\323\240\357\205A\177\35442\273\026\364\225\\6\254"
+	.string	"\017\372\177\267\032\215G$\177\377e\307\253[\327uU\320H\347\177\236V\375-W}.2\372q1\372U`\364\333^\364\255\024\373hV}(U\3753\027\375\226\252\177\245E\037\313T\277\214E\377\311\212~\023\251>\363\030\3257\203\352\263\251\350Oy\352Kq\352\2575\365\2430\365\325\356\312\\\177\002)\372i\027\305\017\372_U\025\255\240\236\226\202\320\177\251\270\304Tl\262j\252Jz\242\372e\305\224\206\320\244>\223\023}2\236\233\233\2333\321_R\242\003C\225i\332\3731h^e~T\23336\262\241\312i+T\271g\354\251\314K^\345\031c\357\307\276$\372c\037\233\363\343T\251\363\343\253\325f\031{)\2672'\3456\242)\337P\352\244,\325\356\244\034\245\274\027+\314\2161\236\224mj\220=)\323\260;)\373\332{\256\353\212\203'\345\313\246|\221=\276\254\020"
+	.string	"\337\344}\363\353\310\226\016\001\312\304\003:\266\321\357R\243\377F\243\0177#'^\335\272\256+\022\016\357\332{\177\254,\331\317\r\023/\013\335\360.\353\236\273\001l#@YC3\024\344\231\226(X\024d\036\362~\331l3\n\362E2\035\005\331g\274'\021\266/\256\024\310=\3445\200\245\005\006\b\310<\345\275[d\2760\205@\346\261\3674\023\343\026$\bx\271t"
+	.string	"i\003\002\n\001y\212\275_;\276\345\020\252\034\305\336"
+	.string	"j\315\"C\225\235\332{98/#>*\327\2607\215[\227\001n\250a\024\345TN\024\026\244$\245B\007\340\002\031\032\243\016\021\240\f\307\2202\002)\022\210DSA\036\r\2041\030\273A+\244NGX\002\2100Y\247PmUJ\253*\233\235\007\264\252?\350g\321 \372C7\347\237\004\260\361X_\270\345\203gv\370\r\276\b\026\025\204\272\371\003\245\031?\036\373|\343}\366\361\315\373\330\347[1<\365q\275\357\303\rH\006-%o\306"
+	.ascii	"v\210`\033\005\017`P\265\235Bm\344\273a\261\b\262\rvC\200\272"
+	.ascii	"1p\300\334\017L\241\215u\241]0!z\345\216:\030\370\26049\215p"
+	.ascii	"@\314o\311\320J\252\006c\002G\217\017\333\303@\270f\374\304\371"
+	.ascii	"\346'\360\267\0133\356\330\316g\035\366W\003\260?"
+	.text
+	.section	.gnu.lto_.refs.bdb3b23f144523e5,"e",@progbits
+	.string	"(\265/\375`'\001\025\013"
+	.string	"\226XG;@\207(\351\2341\346\2141g\2149;U\373\206\225\241\360\005+\212\242(\n\304\213\242(\212\242(B\330-\260s\b\033\342\001\005xdB\350\177\324\366\204}\324v\333o\244m\231\002/"
+	.string	"?"
+	.string	"5"
+	.string	"O$o\345\021\317WvHvj\314]e\307\354\205WV\307]\257\320\365H\377\352W}\354\224\273\322Ni\227\264c\355\220v\327\216\355\327\343'\355\037\255{\362;\371\227\327\265\367\353\327\373*{W\251\334\213\354\265\310~\204\327\207\360\376\007\016\0320X\240 \001\202\003\006\n\020\030 \340\303\243c\343\224a*\265O\242\364\n\312SL\372\304\344"
+	.ascii	"8N\232_#\363\233\266\277\224?)\373\030\371\022\331!2\377\220"
+	.ascii	"\235\263\375&_\223\035\223]\242uL\353W\206_\331\035\346\262\355"
+	.ascii	"2\334e-\370\250]\324\017\005+\340\0073\\\240\266\372\356\355"
+	.ascii	"\241\316(\374!\236\333C\266wy\247\332YszD&\337\312\023\2521\257"
+	.ascii	"[\336\347\353\326{\343\034\0204\302\006\024!\003\206\020\204"
+	.ascii	"\033\366\001\002# 0#\333\264\001\227;<\037\245\231\030k\327\333"
+	.ascii	"=\324\262\205\263\"\313B1HI#Cl\302\2161&\355\2141a\307X\023;"
+	.ascii	"\306\230\260k\314\204\035cL\262\013\330\212V[\374\013w\177\211"
+	.ascii	"Y\343\035"
+	.text
+	.section	.gnu.lto_.decls.bdb3b23f144523e5,"e",@progbits
+	.ascii	"(\265/\375`tOe[\001\312RV\201T \fY*\351^\353\b\221\302\n=\354"
+	.ascii	"Y\313\375 W)\272t\300\231\363\322p\335\342\215\007\3350\035\372"
+	.ascii	"\377\343\333\354V@Mh\274U$Xq\200\320b\027\374l\3271\216\215%"
+	.ascii	"*R\205`x\026N?h\255)\336\362\270\021&9\314j\333\221\220\275\345"
+	.ascii	"N\001\321\006\027\bZ\bl\266\234\364\355)\317\322M\006\257\007"
+	.ascii	"_\337\333:\3706\rF\366Z\265\243s'F\337\333.H\233\0057X\315`b"
+	.ascii	"@\0057\262f09\250\200\217TA\203\nq>\202\224q\365\240q\021ss2"
+	.ascii	"\243\224\002\346,\252\357\337M\232\314\302\001\222e\325\3675"
+	.ascii	"M\016\026\0325^w9#\323\264\251q\306h\374\235B\033\351%}\244\225"
+	.ascii	"4\223&\322B\272H\017\351$\215\244&\233\254\201\274\307:\bY_5"
+	.ascii	"\r\273v\304+H\361k\262>v\217Z\347U\332\341\271\253i\330d\335"
+	.ascii	"5Ye\253v\026\t\027\001\252\257\273\234\263Z\223\3253St\3345Y"
+	.ascii	"\255\323Uv\355\030\0014WwQ\376\232\006\257\352\tE\021\345<&\203"
+	.ascii	"lM\223\265U\036\262\234\221uN\223\325\275\252W\353\206\344\003"
+	.ascii	"\304\350\320\241\203Q\207\036,)lN\002pm]\315`6\240\026\231\267"
+	.ascii	"c\370\365\255\213\017\316K\016\007:\340l\311\231\345\2103b\307"
+	.ascii	"\233-9\263\376j\036-\326a\r\326?\332GMv\217\277kt\326\353\025"
+	.ascii	"\034v\266\344\314\272Gk5W\255\363\312\326\356\316\226\234Y\316"
+	.ascii	"\310\016\035|\276r\223\034D\367V\007\276\245\201o\243\360\233"
+	.ascii	"\017\277\345\340w\032\334\\\3356\372\306\233\253\267.\202\203"
+	.ascii	"\003M5\327\3159\252V\002\b\325J\200r\356H\224\024\363\276\353"
+	.ascii	"\360\233\013~\303a\0235\203\331S\213\314\306\352\032kd\260\351"
+	.ascii	"\373\226\202;F\313\250\311\236\361\313\006\226\333rF\006\331"
+	.ascii	"(\034b\262\364}\345`\016q0\337h\370\335\244\251\200h$\351\313"
+	.ascii	"\353\373\016\202\377\267TCuTM\366T\375{\245S\327\374\"_\323:"
+	.ascii	"\213\031\221\247\372\tM\021\345)\2610d9\347\020\357\251j\247"
+	.ascii	"\372\325:\267|\305\350\266\344\314r\316F\035:t\250V\202\2440"
+	.ascii	"\007\3377\r\374\372\207_\361\340z\247\342\251\311\317\325\276"
+	.ascii	"W\276\372v\340\0242\267\021\351\002E\244\357\253\036\206\221"
+	.ascii	"s\316\365sf\317\337\337\337_\375\234\371*\007_7\030\310\016\023"
+	.ascii	"\325"
+	.string	"\"\363\257y\257z\177\275\253m5N\005\243\240gk\313\232\\\337*%\304k^\221y\364Bf\267\234\363\220\205\343R\325\327\367\225\016\233\265\310|\205\303\325M}S\223\032*\234<T\363\206Hi\365}u\303&\310\271j0\353\337_\325`\276\242\341W\025\360\353\230\340\013j\221\371\273\232\301|E\202\315\030U\263)i\356\372\276\212\341\327\267,D\310\242\310U+BPDY\312\216\007\331\025,F\322\276$\201\213\353\251\"\346c\304\037\342\025L\325R\273X$\034\266\222\262\343.g\344k\233\b\016*\230:\245Z\261H\262,e\027\247A\330\225*x\370rF\376\257cj\230J\246\226\251bj]\245\253\311\n\246zyE\326\26572\347\251\234s\007#KGM\356\216\350\376\005>\bp\335R\347j2\203\312\345UJ\215\3622\n\231\2219#\207\332\210_RJ\337\007\361k\006\246\375\373\253\031\230\347"
+	.ascii	"\376\005\360I"
+	.string	"\300F5\203\371\t\340\013j\006\363'0\207\232\301\254Tj\225\232\264\240\256p\021\034\334B\261\345\264\234\221CAy\236\344\301\323\367\r\300@\036\376_0\2239\370\020~\265\300\254\177\325\002\363=\030D\315`v-2\337\370p5\203\351S\213L\020\265\310$\252\031\314\277B\371+ZM\313\300^a\201e\267\234\221\026\360\224\026+i}\217\254\031L\\\213LK\365\r$U\r\375\266\202\277\231\256\376\206\372\317_\332\277\212 \201\221[\321_jU\032.\376\252\001k\365\327\246:\364\371\352\rm\030\374e\214\277\026\300\004\004\374\317\253\304Zt\361\364\bn\235\277\251l\325o\2516\360\333\250\277eT\005\375\226\005\324o1\220m\007N\360\333\022L\360\267\004\376\356\351\265\022\374\365G\213g\320p\177w\340\002\370\313\027\215\303\204\021\254\212\277R\221\240\243`\370\313\022\244\241\360?\203\263\337\277|\372k\017\033\266"
+	.string	"\235\017\346\377\230\377u\377\351\376\223\371\037\346fj\005\034\376\347\375\025\304_E\364_\377\327\372\327\004\374\265\264#\370\255\b~K\"\001(\374\235c\354F\377[\374_\361_\305\377\f\336W_t\245\370\313\017\177\375\361\333\007\300\370\253\233\277\332\375\335\344o'\366\204\n\366\3275\377WXRy\330\020\3766\341\305o\0170\034\"\233\322\243\342\201\373\353\333_\251\372\210}\372k\330_\371j\031\022t\321_\373\346l\332\033\332H\211\201\257\277\316Y\343}\376\222\305_+(@Q\r\361W\017\377\271\334\302\177\335\374\365\202\277\n\340\257Y\212\266\3306,\361\357l\013`\0170\374\353\206\277\022\340\257\003\250T\326\251\017\320c5\203\377+\374\365\350\257@\b\370\206\277\372<\304_\212\360W 9\376:\326\\\t\370+\236\277\241j\005\177\335\340\257\026\374\355\3026\375\215\303\204\316\365\257=\354"
+	.ascii	"@\360W\035\177;Y\341\377\f\376\032u\240\277\264\340\257m\177"
+	.ascii	"\245\362W\266\277J\371+\362\257k\177\235\202\366W\025\376\312"
+	.ascii	"\344\257I\376j\344B\177\371\344\357\276\337\366o\353\337\177"
+	.ascii	"\177\373\375\366\277\275\177\2171\375\335\346o<\177\337\371\233"
+	.ascii	"\356C\277\371\3637\221\205\240\006\376\r\364\267\317\337A\177"
+	.ascii	"\017\375m\376\265(\303\211\3762X\364\277\377\362\374\355\322"
+	.ascii	"o\317\337&\375\326\003\277\315\300o[\374\226\002\277\225\300"
+	.ascii	"oG\370\255\b\277\205\300oK\374\226\304o=\374\266\303o\021\360"
+	.ascii	"\333\002\374\366\202\337\n\340\267\033~\233\341\267E\277\265"
+	.ascii	"\360\333\241\337\006\375\366\347\267\300\337\366\374\266\374"
+	.ascii	"\233\356o\267\277\251\374\335\366w\325\337l\177G\371;\355\357"
+	.ascii	"\263\277\313\376^\3627\331\337H\3766\3627\221\277\205\374=\366"
+	.ascii	"\267\330\337?\376\366\361\367\327\3379\376\356\372\233\353\357"
+	.ascii	"\343\3375\376\226\361\267\325\337\371o\250\277K\360\367\b\376"
+	.ascii	"~\372\253\006\376\312\201\2779\360W\276\277\312\371[\303\337"
+	.ascii	"\001\370\273\347\257}\177\023\375\035\202\277n\371\253\t\376"
+	.ascii	".\376=\374\337\367\267\323_\207\377\341\374\265\350\257@\377"
+	.ascii	"\271\374\355\342o\017\376\036\361\267\t\177}\361\327\250\277"
+	.ascii	"\231\376\252\301\337K\377\315\374\225\352\357\244\277\221\376"
+	.ascii	"\356\300\337\036\370\373\202\277\007\360\267\005\177o\370\273"
+	.ascii	"\202\2771\374}\341o\013\177\365\373\353\334_\357\374\325\316"
+	.ascii	"_\271\374U\313_\335\376\263\370\253\220\277\006\371+\372\327"
+	.ascii	"\020\374\265\370W\342_K\374\225\203\277\222\370\353\210\377i"
+	.ascii	"\377M\360?\314\177\r\177\177\177\177\277\317\007~\240\266\177"
+	.ascii	"\001\020\b\331*KA\325\234\253\220\307\234\245\300>\340\225s\316"
+	.ascii	"`\365\214\3251\007\345\251(,)10\240*)0\253\334\344G\3159g\255"
+	.ascii	"\25361\260\020qT\332\310\262\024\022\252^a\201e\262\274&\354"
+	.ascii	"\210\333\240\220\371*\347\\\365\202\352\274\241\341\353\213\354"
+	.ascii	":\303s\322\367\336\031\225G\276\230\250\365\275\020\031l\211"
+	.ascii	"\360PK\241\357\205\0034&\254\214\\\337\013a\301m\256\033:3\366"
+	.ascii	"\272\364\275\220\031n\303\246\332-A\322dG\337\r\336x\370E\363"
+	.ascii	"\232\274h\256\032\340U\316["
+	.ascii	"\036\230@\241\345\361\345\243\227\006\300+\263+y}o\032\241.b"
+	.ascii	"\340b\364\275P\020|!\037\370\226\271fj\362a\256\335\221CBl\246"
+	.ascii	"\304a\322\367B8\360\353\303\230'\250\017c\376\267\256\275\370"
+	.ascii	"\byS\233#3\246\374\002\313rc\304\330I:9\366\225\001\006N\r\031"
+	.ascii	"\024\035wHn\023\023UG`\226\224\"wo*\364H+\363\241\346\304V\r"
+	.ascii	"!{S\313J\273h&\252\216\300\031v;\356\242\344\270C^)4.\026[f\306"
+	.ascii	"\224\2334Qu\004\332\220\212\321fG\016\307D\325\021Xe\267\202"
+	.ascii	"\331\r\023\273)\230\250:\002\267\354\216\230\361\200\273Yn\334"
+	.ascii	"\rs\275\334/\027\314}\273V.\227Kw\347n\227\273\345^\271Z\256"
+	.ascii	"\\M^,\366j\315\305r\333\356\025\026\226\373\344\242\2055\200"
+	.ascii	"\311\232\234\274K\245\244\310\031\f\356\203\342\340\377&\335"
+	.ascii	"\334\326\336\264\271K\324dI\322\367V\271T\314(vC\300\364}\220"
+	.ascii	"\030\374 .\370Aq\330\347\t\0244\177lwm\206\036\0203}\037$\005"
+	.ascii	"?\b\r?h\t~\320\030~\220\027~P\026\376/\332\031Y\02268}\353\206"
+	.ascii	"\200\362\240\331\375\350\373\240*| ;\370@o\360\201\310\340\003"
+	.ascii	"\311-\271L\224\\*-Z\206<Y\242\3044\003%S!\373U2t\344\255\f\220"
+	.ascii	"\2767I\355\362\363\367F7\007\204\004\037\310\3075BD\bmL\nZ\337"
+	.ascii	"\003A\341\327\344-r\211\364\334\351!\0049\344\227\bT\233&T\372"
+	.ascii	"\336\261+\344?pD\324\022*Bn\020\031P\346d\351\213\004\312\312"
+	.ascii	"2\002\326\367\002yuR\003K^\337\357\035\316\177\340O\227\"bc\372"
+	.ascii	"\376\007\017\037\356\3760s\347\264\340\340]\260\353\243\337\236"
+	.ascii	"\230\241\375\372\370\177[\325`G\023\r\334\224\230\036\327J\005"
+	.ascii	"\277\035v<\354\235\365\313\333\253\372\332\201\217~j[p\374\356"
+	.ascii	"\370o\327\365\272:\032\357\210\"\367us\3001\0227\326\367?ip\005"
+	.ascii	"\253\031L\f\265\310\254|!~q\\ t\262\226\334\033\227\353r]\033"
+	.ascii	"\355w\267\256\026\220\007\023+$}\377\233\177\265\376\013u\243"
+	.ascii	"\356\021\350'\214\034*W}o\226\317\230\022d\227\276\377y\303\027"
+	.ascii	"\353R\335\253,<\264<>)\353g\242\352\b\264\222\212qe\\\032w\306"
+	.ascii	"\255Q\223\027\353F\027\353N5\227E\222\365\274I]\335]\254\033"
+	.ascii	"\303\372m\220\272\312Q?@(\371\201\226g\341\024\361\022\343s\377"
+	.ascii	"C\206/\223\244\030^\337ku\253\204\276\322\240\305\350\373\237"
+	.ascii	"1\374\237/\374\037-\374\237\030\030\230k\006\263\036k\221i\377"
+	.ascii	"B\374\3465Zq7\372\226y\374j\030\266\033C\374\372n2\307\020\261"
+	.ascii	"\275\232\264}\217S\232i\202d\005<6\355\216\235\013]F\260\254"
+	.ascii	"\035\313\227\206\013\024\257\276\307 \232\334\244\357\236\005"
+	.ascii	"c\361\354\332Q\205\224\237\365b\367\354\034:\266NM\332=[\343"
+	.ascii	"6\317\352\375\032\tui\361\302c\336\373\360a\023\354L\230[\274"
+	.ascii	"\337z\261_\354\035\021)U_\372\312\271\332\201\265\325\367>h\360"
+	.ascii	"\177\353\306\302\261l\354\032\373\306\266\251I\033\307\246\251"
+	.ascii	"kb\370\312\3303v\355\210\263H\301\261tj\354\334\305\261hl\225"
+	.ascii	"];\342*R\336\334\3311d\344\220\305\261u\031\n\217\004\2242eg"
+	.ascii	"\225n\016\2258\241{\037'\370>a\370>7\254]m\253B\004O\337\003"
+	.ascii	"\363X3\317A?cpnQ}\017\324\303\007\226\301\007f\301w+\303\367"
+	.ascii	"R3\230]#\304m\030\001`\231\213\353{`\021l\326\331.\\\250\310"
+	.ascii	"\240R\307e\256\013\n\036#8\2209\350\356\262\354\026+\247f\027"
+	.ascii	"5\325\367u\315\n)\220i\261q6\213\205\253I+\367\3279\366\355\212"
+	.ascii	"\025[5f\204\314\312Y,\265\213P\024Q\236\242\"B&g\257\330\252"
+	.ascii	")E\200g\306\316\354\371\334\232k\006\363\300/|\340\r| \026>0"
+	.ascii	"\343\337&\255\333\217V\233\030G;\305V\261Rl\233]\263l\226JMZ"
+	.ascii	"7\313u\253f\221E\232\313\024\213\262%\207f\243\370\330=\331\222"
+	.ascii	"\343\253s\254\233%\"\246\266%\307\267&\211]\222Ff\304\"\261\203"
+	.ascii	"\362\246\202=\223:s\263Ll\331\217\030\332\226\034_\316H\037?"
+	.ascii	"(ZT\210nE\326\f\246Q-2\323,\024\261&`<\362\322\330\230\331'\370"
+	.ascii	"\310\024:*c\314\346\232X'KM\222lS\232\234Y%\345\231/U\346\372"
+	.ascii	"\036\247\200-\231\230=\322\223D\263\221\326\367\370\206M\001"
+	.ascii	"c\341\367\364\341\367\340\341\337\016\341`'\215\224Y\337\337"
+	.ascii	"\n\371\3520\276%Q}_\337\370\342\250\355u\035!`\316ar\310\346"
+	.ascii	"\330)[\225&&\004\r\273\265A\352\n\005\037\230;+\213\265A\352"
+	.ascii	"\n\205\2270o\335\307\246\246\261_\215\247Zis\22732M\337\351:"
+	.ascii	"io\322\344\376\253un'\270\254\371\2626\254\327\006\251+\024y"
+	.string	"_\356\354\230\rbuX\037\026\314\376\260=\354\016\013\304\206Y1\313\243&\355\327\337f6\307\215\2209O\315\261PV\252\326\271\235\200#s\247f\277\332N\327\021\232Bf\255\036,py\274\360\3318?\354\342\002po\266^\266\353\317\nM\205\2768\032I\033.r\334nX. \016\025\322\254\220\206\337\263dK+\350\f\031\036i}\217\310<\244IV\216\276\357\021\3036\313\326\300QuV\245\357{\270\360{\254\360o\261\354\f/5\302\030\351+\343\352\260\262\345K\337\233w\260\215a\257\200z\214\351P\323\367&\034|\023\215\245\002\246\321\343\341\326\367&\035\276)\207\365l\024\236\266\0321\372\336\254\202o\256\341\233L\374:\317\317\220062\372\336\034\3633m\340\233S\370e\036~Y\207_\312a\016M\0079\2444VeK\337\227I\374R\r\377=GO/\357a\356\222\271\251\037x\026\f!q\320"
+	.ascii	"r'G\n+\217\252o\034\354F\215JL\337\227e8D\230\026\003f\246\217"
+	.ascii	"\257\315\334t\232{v\345M\257\3516\255\246\3414\233\232l7\255"
+	.ascii	"\345}\246\321\334\250\316i7\235\326p\225\r\230\231>\2761m\347"
+	.ascii	"\243\346\330fn\372I\265\"\004\205\314Y=D\310\314\364\361\271"
+	.ascii	"i\271\006S\353\274\220yK\250\n\031\262C\007+E\b\025.B\367e\n"
+	.ascii	"\370\"k\006\363nv7\023\202\034\036Y\372\226\361I\322P[\353\373"
+	.ascii	"\022\f\3275\231\23762r\234\276/\271\360K\032tK\374\332\202\364"
+	.ascii	"\375\345\303\277z\375\245\313\317\033\033\272$}\177\307\340\327"
+	.ascii	"d{\351\342#\267&O\r\227w\027.\240\234\323r\316\033,\031\031\270"
+	.ascii	":}\277\327s\377\201@c\310f\374\230\333b&F\022K\337\3775\331["
+	.ascii	"Z\0132\033\005Y\021\303W\247\357\357\034\376\205\303\037\001"
+	.ascii	"\327o\r8\203\222\245\343j\362\254\321~\337\340\336Wj\235\333"
+	.ascii	"]\222\274\3139w0\352\200\313$\251\003\305\274\277m\370#\256\264"
+	.ascii	"Z\263\325:\267\023|nwX\332JM\366\225+-\245W\370\251rg\246\217"
+	.ascii	"/\347\334AC\007\340\2255(+\346\355\344\245\221$\005\274\276\277"
+	.ascii	"7\252\324d\273\271u[S\021\232Bf\250\022I\037y|=_\344\224\341"
+	.ascii	"\273P:JO\001\302\005 \346\230\231\231H#0(\274\006t\371Qv\246"
+	.ascii	"\242\206\r:\265\233H\213u\204K\353\254\257\031\305\236\031\222"
+	.ascii	"\273r\322\327\204r\337<\271\262\345\257\257\231v\233\340\035"
+	.ascii	"h\177s\372\232hAlP\312\340\351k\236\365T\305\301\335\350k>\271"
+	.ascii	"W\377\201"
+	.string	"\016`s\244s\245\374\240\231\271\263\246\357)\340\303!\244\224\225\231A\222Qy\350\360\001\3055\221\021\325\367\024\274\341\017U\220\334l\202\304,RAEf/0(<\023]\356\334\351\343\313W_\034.\r\2756r\372\232Kn2\371\201=j\320\204a\353{\np`\223\354\246\222\037X\356\260\341\246I\337S\240\205\1773\311\017\004\032B7&\257\357)\230\201O\001\025\376\240\227B\nf\221J\204\224B\343F\206\241\326\270\232\334\301\037\304\230C\314!f\221\r]\362\350\344\321"
+	.string	"\033\222<\223\310\315\"\317R\253\264)\243%\313\333\223\025\372\036"
+	.string	"[\260\b) @\314 \225-gi\200MH\231\331\017\035\031zWc7\203\\;\2654k"
+	.string	"\220\304!\360\204\205\331>+[z:\370~t\350\321\251\351{"
+	.ascii	"xa\021\\\365K\375b\202\231U\344\344\334\271B\356@i\323\327\004"
+	.ascii	"\353:vr\200\371\365\r!\247\307{\224]F`\326\356M\306\0223+\246"
+	.ascii	"N\0214y8\304\226\256.\363\253\262\345\254*&F\306\222\366\252"
+	.ascii	"\222<\262\343\346\227\006g[m\246\016\0138\361\"g\3520s\224\331"
+	.ascii	"\213\3432\363\025\006N\211\351U\275\370\340\321\345\305\016\203"
+	.ascii	"H\273q\343\013\270\347F\217\f\027\f\242\315\206\r\037%\331\234"
+	.ascii	"81n\030\304\025-\255\036\370\353\311\221\"O0\210-YY^AM\200h)"
+	.ascii	"+\202A\320\321\240\221\365\223d*\207\031\035\030\304\231\031"
+	.ascii	"3l_%BJ\331\355 \313\331\213C\371\305G\327\217\276\317\200\205"
+	.ascii	"A\274\361\360\337\214a\306\260}F`Px$\230\200\345\361\302\227"
+	.ascii	"\263\027\207\036\032]\254\244\365=\006;\370h\210\207\233V\246"
+	.ascii	"\325\225\303\201(g15\270|\364\322`\b\357\312\336\216\276\307"
+	.ascii	"\320\006\037\241\215y\271\246\317\032\255&\3131&U\b\251\034\205"
+	.ascii	"\344\002(e\200v\334Y\343\321\327\234\352+zxe\372\036\203\030"
+	.ascii	"\374\232\306\246t\303\346M\331"
+	.string	"f\203\324\025\212\2645rJ\274Z7\004\002eb\356\340\224m\204\240,\344\f\204\f\231\237)eF\231\271\314cB\325d\371W\346E)\377\3128\265K\255\033\002\201\2641\345_\251W\342\251u^Dy\352\r\316]\316YFX\035\017\241\313\346p6H]\241\210\342\246\274S\366\325d\211\307\255\304S\316)\355\374`a\263\273\323\320!(\357\314\232\035\346\375K;/\371\256 \205\350\365-\353\364xu\205\241\352{\f)\340\277\334\253\311\222\016\3363\213\303\203\201\b>\0061|\f8\312;\214\346\216\307\230\276\307p\304\307\200\205\217\301\n\277\350\017\277\350\016\376K7e\23360s\306\224m\254\330\211\301\222\352\373\":\270DS\252\031z\202\005\212\252\357\3134\377\201*\212\220\261\322\367\236\351!9\270\350\365}i7t\\\223\315,ie-\351[\226\301UEl2(\315\216X\341R\367\262\314\203\276\226"
+	.ascii	"\031\353[\222\t\361\262\256\314\021\346\207\221\276?\265\310"
+	.ascii	"|\021\027|\264\266\302K\272\025\354\034\n\257\274\345A\355\370"
+	.ascii	"\245\301\320\331\23238\372\226^J0e\230\037(\244\245\006\326Y"
+	.ascii	"\337\027\275\341\227_\376\003}\206\2309\342\244o\327\317\231"
+	.ascii	"%\227\227]~\340O[\225\037m\372\276(\211_n)"
+	.string	"\347~`\rbF\227\247\357\213\326\360K-}[k\326\372\226r\270\252\210I\006&\364P2\303\312K\271\277\274Rb)\343>\220E\360\347W\247o\231\245\204{\031W\276\3452\216\004X\316Qe\334P_\316QC\265\022\240V\002\3343\261$+\230\367EH\360\327\324\ff\020\235\020/\255\374\214\341r\247\326\367E\\X\004X\351V\272\225]{x\300<r\326\254\372\276(\n\2130RR)\251\224]{?\320\362\314\314$r\312\340\366\260\210\262\266\267]<8g\300\033\302\2616&\327\367\027\326\340\021eHd\311\246\301\214\203\317U\214<ok/\331|\202\354\200J\303\372\017\004\326\321\241\343\326\367\027\264\340\021^\242D)\27320Y\373!\322\203\210\232\276\277\220\304#\354\322\322\31237Yd\331\353\213\003\020\024^\214\"}\177\301\f\223\310\245YiV\236%@\311\017K\345g\207\245oyV\273"
+	.string	"i\200\365\241U\375\007\232c\262\372\356\364\375\205!X"
+	.ascii	"t<\274l\322\244,c\202\367\245\001\016B\305\006J\351\244RAJ\331"
+	.ascii	"\322\027\211\301K\205\032=\360\006zKj\262\\rw\370\034E\220\332"
+	.ascii	"q\227\217^\032\270 b\346\325\367\027d\340#\031\036\352\223Z\222"
+	.ascii	"\325dIv\265\200W9s]\300$\356\250\301-\370a\002\350\360\360\362"
+	.ascii	"\310k\262<R\"A\001\226\267\032\020\247Uv\306\227\263\227\006"
+	.ascii	"?f]j~e\031\337\f;}o\201\r\346`Hi\2444b\373\210\262\224\232/\262"
+	.ascii	"\354\345\305!H\n\023\2540e0\007[\210\020\301\003\nrg\005H\337"
+	.ascii	"[\340\2027@\343\341\245\220\232,\205\\\274\362*G-\301@\t^\235"
+	.ascii	"/Tl}o\001\013>\372\341\341\345\330k\262\034\273r*\220s\224\027"
+	.ascii	"\006P\256\234#f?\372\336B\032\346\240N\354b\266\017\347\2712"
+	.ascii	">u\214\330\311\352{\013a\270\002\032\036^\376\370\241\205M\350"
+	.ascii	"\310\234,(}o\241\013\223x\342\241\344QK\037v\252\337\005SDy\212"
+	.ascii	"\b\0172-\f\243\313\361X?g\2228\342\241\324Q\313\257\322\253\346"
+	.ascii	"\251~7\273\345\250\255\0206\326\262\006\2670\003\327\2742Zj\352"
+	.ascii	"\347L\rh\036^\346\250\3112\207\255B\001\026\265\205\201\222<"
+	.ascii	"!e|9{\321 \350,\t\025\031L\202\007\216\343(\273j\316 \376\360"
+	.ascii	"\376\275\227]@%L"
+	.string	"\304\260\372\236\350\rs\220\306\303\326\267J.\234\215\264\340\225w\264\334\330x\311\345\323\206*\351V\347?P\b\314\232\326\231\276'2\303\033\214\361\360\362X\223\345\361\306QR\306|\273\003eG\337\023%\301%\242\260\312,\254\262\206Q\334\217\213F\345\311\232\276e\215/+\262\252\276\337\263R\377\201\226\207\223dT\337\023\211\341\021D<\274\214QZ\2252\356\231\232\253\216\300\031G\304\334\345#R\203\023y\341\023\315(\245J\253R\252\254\032\2615UZ\225Se\025\206\322\020F\211\027\007\253\345&kGI\365\262\252\275\340\360\200\234\301\303\303F\356\373!>\374\2411\370\177%\324\237\3553s\256H\260\254c\366:r\340\240\257\314%T\231\217Z\340\360\207\320\260\b/~~\225\214\022\264<\263\354\345\305A\250\256mI\032\031\026\261W\247\316\305\203s\316P\310\234\225AL\334\027\207\237,7\240\234\271w~\361"
+	.string	"\261y\262w\355\374\007R\220\206\247v\355\\>S\355K\031\2308VB\302\270\372~h\fs"
+	.string	"\306\303\325\273s~\367\276g\373\310x\0359|\210\013\377\257\357\337\314[%2\303I\001\231\177}-\203\252\255\005\370\177\355\035\220\002\231\245\346\244\220s\256sL0a]s.\310\377\3379C\201\035-\\\345\23432L\313\302U[\330\361j*\254\253^\265\205i]\265\205A\365\025]\224\3261\207A\341\f\246\225\247r\306WQ9\267\201iY\270\232\312ZWm\371\370\203\f\313\031\031\006\205\221Q\307\234sT\275B\206\201]M\205iY\270\232\n\323\312maZ\365\252-\037\363T>^\270\312Y+\267\205\341\325\253\034v\274j\003\323\262\220\247\360\270\211Q\207\317F\035\343%\013\032\336\325T\256\021"
+	.ascii	"\263)"
+	.string	"\260c\335\025\022\254\302\345\f\345V\225\217\025\231sX\316_`\004\200\233B\002\005'UW\243\307k\n*\007\r)10 R*\327]5\001c\252\312yM\246A\002\252B!s\016\250\221\210\016O\264gi(LS\241\023:\f\032[0\241\302\2410\004b\013#1\204T\030<\341"
+	.string	"'\213\240\245\2410\025\0061\200\236)\n\036\300 A)\350s\246B#\006~z\316t\204\246.\210,,\260\"\005*\024\002R\032\n]``1<\213D\2413\035\031\203g\323\007\247\361)\r\236.\200\316t\20465\005\223\320TX\302\207\247\341\322\0060\236\206\302\246\rH\224@*a\002\306\207S\351\251)i(\374`D\237>|8\201hdJ\211\303\036\027\301\263\351\246\350\220\230T\272h\022\236I%JL\3629\323\021\312\224\006\235`\020\215\305b\020i(D}\322\223\005\352s\246\243%\341\213\340\320"
+	.string	"\3014x\202\305\n\021N8U\f\211@\0018\235\204-\320 \212\244\324\350s\"=Y$\245F!\t\264H\001\324\301\006:\350`\003\035\250 A(\003\024\230\200\007\026\030\352"
+	.string	"\204\024*\316&\245a\020\005Z\\\n\222@\213\024H\035\200\220BEj\f\246\027P(\022?\020J\317tT|\"\032\227\220\214gz:\005\215\301\342\007\f\222\206O!\374\f]t\211\"-\025\201R\244\341R\261\034.\025\355)\002!zQ\3644*)\005{P(\022\223\2561-\332\003\241`LQ\341\322I\002\322\005\245\263G\351D\237\356\211\366<\230\006\225\322\023=\215HK\305 c\220)\351\"\235i\260\251\350t\266HO\364$a\251\250AI\330\024\274\300\322P\250d\001\005\246\264)x\242`\261B\004T\b\224&\235\351y\002\210i\351\211hdJQ4\270\342l*!8\004\001-.a"
+	.string	"\256\240\300\t\024D \254"
+	.string	"a(\f\032St\b\005\262 \266@\213KE(PQ*\034\216 \034\216p\372\240Ng\212\242\300\202(\230\006O\234p\252@\3213I\203O\210\243!\261\251\024q\224\006\233\3123\035%!\235N\302t\370d\374\220\344b"
+	.string	"\350R\260)\204\245\241\320\311\030\374a\261B\204\323\204`\bhq\211\250\305\212\f\370d\201\026\227~|@\034\235N\302\026'@\230"
+	.string	"\213\025\""
+	.string	"]0\022\323`\222Pi8\002Z\024\341IC\020\210\243\324\030,\036\025-\200\026\2270(\005O\022\322\023%z\222\320x\016\317%|\022%6(a\002F\317M0"
+	.string	"\004\003@\2307\301\200\020!\030P\"\004~\211\0206EB\223\204)*\034J\215hq\311\302\211\024\002\206\324L\221P\013\204\3008\002\f\243\317\005\210\316\246\022\202-^\230\247\022\321\351\246H\024H\215\304b\020:$\n\323\"\261\007\237\"\020\2628E d\201Sl\004R\n\236(\232\204\301\026\306\323\205\213'\017`\244@\306t\205\221O0\r\236\200a\0242\246+\316\027\3023\351$\301\002\023\222\202%45\005?8\235\202\306\020`\030\207J\360I\221\214\304\264(4&\241\347\t\n\236\324DL\"\246Dc\021\247H\251\221X\304\037\030\203)z\032{\214g\232\0244\006\231\222\220R\"\261\204\323H\224\236\351\210\002\024\214\351\351t6\235)\005(\322\005\023\320`\212!Q\230&\r\237\\"
+	.string	"\235H#"
+	.string	"\300x\n]\b\323\341\251$\364)\242Nhq\311\002RS\320x2\025\205\306\263h\204\246Fb\361'=\201\032\211F\343i\242\351\0231\035>\021?HO\023\222\202\305\237\023i\005Z\\\n2\236J\302\027Dc\021\237H>\247\0221\005\032,\001\305'\322\220\317\211\324\001Z\\\n\302'\322\t\264\270\024\324t*\021S\fQP\302\304\263I\330\024\024\341D-"
+	.ascii	"\203\330T\302\323\020\232\006Y\f\205)\320\342R\032|!4\026\221"
+	.ascii	"6\244(\322\017Z\\\002\246(\222P\212\"\245F\342\212\246\240\320"
+	.ascii	"x\242@\251\221\270\002-.\365\244H\"F\f\211B\324x^\340\004&\340"
+	.ascii	"\211\204\026\227|\3164\230\242e\tA'\322\231\006IPz\nz\200\026"
+	.ascii	"\227\202`\234J\303\021\3164hTz\nz@L\237\202\026\212g\312"
+	.string	"bI\350bH\374\200\230>\005\205\320\024LI\251\360\004\026g\032LYL E\203M\026\320\024\347R\020E\317\024)\032l\nJ\221\320\024\247\2230\305h\212\364\211x:\tS`zB\220\204\017Nt\260\024t\002\246(\322\231$\374yq\236@\237J0S\341p\204T8\024^c\272\"i\370\024\202R\360$a)\230\002\003\212\364\342<\261\024t\302J\301\323xA8\321\247\2373\035\241\301\242\0231\351\003j<_\b\215J\007H\221F\244\301\024E\027\370LGFb\232t\276\250\300\251\246D\022\232\202C\343\231\3028\211N\244\341\222\260)\210\204\n)\031\203D\017\206\304\236\341\222\260\251\203\245\240\023>Q\013\020[\030\211\350\360d\261\024t\022B\221\202i\360\304\220(L\237\232\210,\320\342\222\205`\032<q\302\251\002\r2\371\244\301\263\204\324\030<Q\240\305% \020T4\235\027\3609\321t^"
+	.string	"\270\024L\001\302\n\020p\023\221\350\001Ry:\t[(\t\233\202/\200\350R\260\311Ey\"\205\200\026\227\200\316\"\n-`\b]\364\244A\026NOC3=\023\206\264)hQ\244!Q\230\006\223\210\023@\213KAi\260\311\246H\"F\244Ca\317\220\330d\231\232\232l0\r\236X\n:\365\234"
+	.ascii	"AE\323\371\302T:\317\"\213\236\0235>\021?P\032>\021\215K@L\305"
+	.ascii	"\323\276(\236\266HTb\272\251\317\231\216N'a\372aHtr\"&i8\261"
+	.ascii	"x\032?\244D\242\361\303\017*lj\022:\231(\322\351$"
+	.string	"lq\246A%\244\237\024\251D\210t(|\302\306\340\211\302eJ\207D\247\022\205\240\222E\215OD\246\022=\323\247\241\320\251'E2\221\016\205O=W\300\210\244\244\240\222\t\023GC_\300\002>\270\300\002*D\300IGhq\351\003Q\370a(\f:}H2\242\037\216\212P\245!1\351D{N'az\377\367\3040\277\202\322\350\236D\271\272x\200\346\320\210\241\261*\253|D\265\351\251\272g\312\2368\231\353\333#eO\360\367\367\367\327\227sT\217T\367P\365L\275G\352C=k\314\256\242\314\373\367Dm\331\353\241B\020(/\"\322\220\321\350\311c\274\374\220\210\3713\355\364\364\332\330\362\224l>cq\350\310\374\314,k\300\306\260\372\252_\222\032I\366\220s\330$!r\247\210O\362\017\357\215\035\023ydrG\307W\226\001\365 B\225\246\216YE\250\n\237Z\016:%\022\2531`\360\372\226"
+	.ascii	"B\303\334\243a\316\371\205\250\234\245r\356\341\003\2038\255"
+	.ascii	"\262\2639v+\f\032\262N\337\022^\326\206\251gm\230y\365x,!e\205"
+	.ascii	"-9\276\354\305\305!\317z)\301q\346\016\336\305\273X\244h\254"
+	.ascii	"\271+\271\202\220y\236\270\221c\006\271mo\354\370\231ql\025N"
+	.ascii	"\306\251\233a\302Q\243\227\225\207\257\357k\322|Svy\220\2075"
+	.ascii	"\346\306\004\263a\2628Q\241\315\2153\204\226\305\342\230l\256"
+	.ascii	"\234!C\254H\351{\344\246F\215\231\245\262\345,\f_\226\b)\343"
+	.ascii	";\213\221\306G\337k\200\202?\224\241AS\262\305\225\235\231\351"
+	.ascii	"\230B\206J\337k\350\302\037\300\352\352L;#"
+	.string	"\234\241L\271\302\352k\3332\315\334\264;\223%\326\243\257Y\306bM\351e\321q\325\207\327\206I\337k\210\201?\310"
+	.ascii	"\003\306\034#\305\316\035\215\037k:L17\307\330\2521\273\024\304"
+	.ascii	"L:$T\216Cg\206\001\346\275q3%$\265\203LH\337\033\315\301Gs\270"
+	.ascii	"p1\275\200\250\331\212\212X\236;:YM\272\314.7\275T+\\_\330\202"
+	.ascii	"\030\261\301Gc\31483\316\334b\244\006%'\257N\031%p\246\226\233"
+	.ascii	"[0\032\276\276\030}M\2716\262\245\213I\337\357U+\377\201\245"
+	.ascii	"\030\2357Y\304`\020A\260`1\263\030\201Y5f\362\3201\013\"\263"
+	.ascii	"\225E\353\355f\226\240\275)uQ\214\3460\210\030V\254\224]F\230"
+	.ascii	"\210\335a\251]\351\322\367FD0\210\033\311\244\321\0279!eAI&S"
+	.ascii	"Z}o\364\205C\fa;\233Y\305\b\f*\217\204\026\274\2623\276\"7\220"
+	.ascii	"XI\271Y\305\244\022TgF\\\032*7\247\320]\231\201F\316X\236/r\332"
+	.ascii	"l\232\n\340\\a\271o\260\224\241\202\245\357\215\254p\205s\250"
+	.ascii	"\323\261srT\262\244\030\n\304\030c\210)\032\032%\215\001\323"
+	.ascii	"\025@@HP \224)\333&\037\023@\204\f\354\244\211\244vL\251\231"
+	.ascii	"\221$I\241\322v\226\352z\023gD\376)WgtCI\215\353\032q\303}\306"
+	.ascii	"\rD\247\003\341D\372\326Z)\033\222X\315c\016\t,L\355\"\313q\240"
+	.ascii	"y\372\320\351\242\264\f\373J\321\334\321\342\270\255\243P1k7"
+	.ascii	"\236\254p@xD\372|\240\314@\310\365\267\261i\332K^\004\372hb\023"
+	.ascii	"\235\316\0278\342J\343\305\262\200V\322\206\276p\346\302-\342"
+	.ascii	"7NF\362\252\353\374\211X \236\331u\300\037\324-\273\363\346c"
+	.ascii	"\371\030\233/pop\303\247\255S\372d\326\235Y\214g4\376\013\340"
+	.ascii	"E\247P!\367d\017\026\265k-\320\030\310\252\302\371\342\311\352"
+	.ascii	"n\332\201\331\033!\2221\330\262\016\223\332$\216\340\221\333"
+	.ascii	"\037\275v\007a+8\031AV\021\367o\211\346mx\337\367`\260\362\312"
+	.ascii	"\006\373\325t\206\251\002\243\007\336\217I\330\346\276\2247b"
+	.ascii	"2\355~oZ#J\263\341\254\240\001\354\336\246\354\207~\026\2532"
+	.ascii	"\307=]\372\316\307o\377\215>\220\370\224\201\335d\302'\354(\205"
+	.ascii	"[\272\251\342\026\254`\276\030\207\255\322|\361\274\222\263\331"
+	.ascii	"\352\232~X\262\241\234+\013_\276IW\300/\034"
+	.string	"\002\340Xvx\360y\253\212\"D\006\327\2221\320\034O\343do\277\261\261%\r\367\f\323\234\257?\342}\"\371%\376GQ\0315\226&\367\316\365;i\357\013\023\013\360\003\370\210\031Js\360\346\376\210|\365\323\323\177P\350P\343\210\244/~\027\2578C\202\235\316\212\033\213\244\213\261;-\2223\027a\256\363\321\233P\214@\300\037\343pyui@\270\356\024\n\365\002/\351.\376\211\243\021)\225h\367\261`\275\361\005\310Q\303\325s\277\001F\317\350\334Uo^\243dtVQ\257n\202\367=\f@\334,J_-\002+=,!\252\003\227\037\257\230\356\365c\340\007\370\270\020\220\253\247C\374-U\255\306\256\033\346@\303\307w\250OG\307\003h\242,\004\313iHU>\254\025\265B\\M}\035\314\372\2537\2715\353\270\201l>\343\335w\027\003\304V\310\222-\240:\356\236wa\213\313\216\265\002\036h\324"
+	.ascii	"RK\313\235\311jP\354X\325\241\265\310tV\242\006\331\320\216\024"
+	.ascii	"\242\273\250\300\031\207\345d5\017\212k\352U\037\300D\216\233"
+	.ascii	"\017\340_\304\fH\001tL8\314o\216\206\024\350\\\3540bL\t2IF\320"
+	.ascii	"\343\210\202\274m\036\247\253\272\375F\360\036-\311\030\2504"
+	.ascii	"\242i\331\315\260\021@x&\270\230:\276\205\253\354\031\335<\217"
+	.ascii	"s\350\306Zp<Z\0374\341\322\255o\366\347\331\243\035\340\351\367"
+	.ascii	"\225\335\\\017i\346\216\324\215ZQD\255\3218\203O\300#N"
+	.string	"|CH%\023\201\024&x\240}6\247d\210\006@/N\310\035M\335z\271\342\345w\320\323\264)Vq\020\343Y'\325\226[\214\215\3141c\373\037pW\030i\035j\275 \372\203\245\3112\271\210\026\346\363\322p\226\245@\330=\260c\242\202T!K\f0\226\247\037\306\247\230\302\346\027\207\207S\255m\274\304\005\240\351-\024[\270cw\350\230\274\337\256\3302\271\034'>\t\\\306\203\353\307\273@u& \241,\007\247,\355\256\234t\001\343\036\221\217i\366\350\367{\214\342\033sG\337\274\235n\365\245_Yu\305:=\340\343\006R\2452_KM\b\376\331\341\022/\210\261\265s\255\347o\020\200\201;\244\006u\377\343H\"LX\037$\252\356\005\3023\023\262\304\034\334\203^6\031\204\320\370\247\264\223\223\3373\212al \020\226\220$\225\225\255U\244\255Bi\221\204?\264\263\267L\032\245\242\305\253g(\373"
+	.ascii	"\362\221\215\272\260h\215,7i\013\217 k\252\210r\212F\004\374"
+	.ascii	"\346{\206\363\363\232\223q\363kM\030\352\033<\354'\231\206\263"
+	.ascii	"&$E\225\216\314!\213\371\216\361\252I\253C%\004y\fg\373\317\315"
+	.ascii	"\315\317^\312d\365\266\247)\217\030\216T\216J\306\273\323MQ("
+	.ascii	"\370}v\177a\312\2079\260\r\324M[\354\350\307\364\217 \252\262"
+	.ascii	"M,\357\2559O\334\312\251>\340\217\203\\\340\357a\202\201\275"
+	.ascii	"\340gM|\223\350.\201\316gx\253\330\254\334_\334(\364S\333\001"
+	.ascii	"\316s\216\325\177\033\252\002\220\213\033\3429\223\211#\2442"
+	.ascii	"\377\237[>\345\244A\345\301\340\025\330\303\345\002.\263\216"
+	.ascii	"\0322\243\\.\306^P\327`2\233\237\027F\034\334\214\340\376(<i"
+	.string	"\323\212\024\212\362\254\215\233\210\fj\331]\304\342\0060r\345q\334\343\034Y\204~\215\2518k\272\3218\352\004\360'\344L\210\221\361]@\246J%\3077\301\304\357\314\351\007LR\006\001\230\\\020\321\232\316\026\364$i`\347\244\256~>hf\202\271\363t\306\364h-\257\323 \257\335\225\253\262\2156\001%\024h\006\241Onv\355\320\275\3473\265\365<o\377\252O$\253\352V\025s/\350X\303` I0\344\317(\3551#\214\230-a\264\222\225\273\020\342V,$\353\022)\031\351oRi\225\275\314$\217(P\033w\3551\260L/D\354\027\374\247\034\211\221\214\221\007$\246\347|\223Eb\346n\262\330\263\261p\206`Xf\271T\365;+\215\370\035B;\254\251\255\224`mW\223NW\203\271\340\\\374\272\333\323\017\320\237\347\374)\344\347\331W<\271\370v\205fz\327\r\260g\212\374\325\274Z\226`"
+	.string	"\266\341\003\375\363\267it|nn\253\324\357i\bg\345,\270\276\345\034\360]\350*\314\177\001\317\227\312\035\326\233X\366\347\250\276"
+	.string	"\235\351\252c\3546\331\367\004\rV]bD\2164\\q`\366\211!6\221\272S\202\231\322\017\326\021`\273\225\224\360Q\245R\220OL\356\252\314\002\006\227\224 ]\320UCs\252\301\276\226\337\241<31\207\376\241\311`\001[\311\033\217\325\307\312]\001\233\224\304mex\373\322\361x4\261g\352\025\023i="
+	.ascii	"\216^\230\0211\237\262\355j\006)\300XE\315\233\331\234\2273\247"
+	.ascii	"d\313] L\037\235\250\274?\201\226\243\0363g\3551\2357\177\335"
+	.ascii	"\206\270\234Q\320\216\341\257o\275\316\314\3411A\037\247\315"
+	.ascii	"\231\305\347\231XH\003\023\240\037\246\303\r\370\311b\220\315"
+	.ascii	"Z\035\205\226\371\344\2708\273"
+	.string	"o\t\234h ]\232\204\262\335\022\3642\374=\027t\255\304\262\204\277k5>\347\006\001\007\036:\333\275R\321\247\203\326@\260U\332v\205\206\242\022\377\333=\234M\017lp\333\316\303f\350{QG\364\334|D3\303\263\221bQ]\213\300\202]=\302\027\2421\244\310\004\234\240j\375\006\\\372g\340\1778\354\030O\326\211K\006\201B\357\345\355!\361c\031\347\233moJ\3114\004\327\001_\261\007\276\005\212\007\030\204\375H\253\217"
+	.string	"x\251D\307\300\n\343\362\271}\300\"ebm\007\320\363w\332<\002\375u\256\211]\264\220!~\320\200/\247\255R\243\336oD\231_\030\264B\317\300\342\023\n\222\323\224\324\306\346\304\364Y\tR\337\233\244\250\324>\267\264\340\nA\300\030\2243\235\255\\\377(\3074\322\017Z~4\345\374\013\323"
+	.string	"\002`\3601\352\317\245\243`c\316\203\220J\020\363`\036["
+	.ascii	"\n\256\303S\326\306\020\342\371\347\t\237)l\325)\224\346\260"
+	.ascii	"\205!\202\037\357\351\244\bg\307\213\265m\302\372\254/\361\224"
+	.ascii	"cwN\247/\036\214\350E\216\364\317\030D\306\322\365\373.g\212"
+	.ascii	" Y\230\b\202C<o\273\025\214_\265\344\\\375'\332,)im\321+-\230"
+	.ascii	"o\320\277a\345\320\025\355!\234\r\030\f\243\030iQz\227}\230\353"
+	.ascii	"v\017\252y`G\373\360\254\r\362\222\237\005A\350\027\340\241\251"
+	.ascii	"\337%y\247\203C\037e\252\\\022\034\367\013H\324\031\373#\314"
+	.ascii	"\217\250\f\fV\340bP\3407\020\253\224\325\232\35113\252\006"
+	.string	"\302\\\214\007\b\352\027s\276\300cd\3031\035\326\240\310\0360\224\230\302\275\321z\252*Cz\274\376\2772\313\320\356GI|\216u%\035q\006\375e\374B\rgs\354\206\362I#OtSg\006\004uE\231\312\031E<H\n#\016d\200\231\372\242\350\375\310\030\225B\202\316K\034xL\221\300\253\024\213\370#\257\320\fi\232\370hw\341\033DK\341\035v\255G\020\251F\246\375}\003\2669\t\234r\035{\360\007\037\2044\3058\362\003\310B\201\333\322\200\035\306EFH\203U\177T\216\207\330\225P\202\374\362G#)\360\252_\217\373\0264g\357O\211d\250\034\270k\304f\275\322?m\217\275\360\\f3\036\001P\210\357\334\2456\211%\267\317\323M\237\374\275\273\206P\244\255W\002\232\223\023\354\235e\372\234\217\335\206\016\247\263\234\212\177\306\003\315f\333z\333\0321$ Rk\257\037a\200\376\310\001\034\247"
+	.ascii	"u\366|\322\311\034\217v\351B\241=1\2677\251\352\016\220y\001"
+	.ascii	"dhT\311\347\316\223O\n\253q\360\320m\222\027\222\210\343\301"
+	.ascii	"\222>\361M\r\036o\351\366\313\241\333\241\036(\271\213%\250\277"
+	.ascii	"'\352E\223\215\232\251\352\213\344\303\264+\0354\0317\300\025"
+	.ascii	"\332\344\026L\374'm\340C\271\005\275\275\020y\274\346\231\206"
+	.ascii	"W\355\255>m \376\307G?\231\221=\007\033>\332\361z\354_\r}\267"
+	.ascii	"\206\3029\361N\320\337A\251c\241\377\347\207\021\350\304\b\210"
+	.ascii	"1\006\2577\332R\325I\364,\234\336C\375\357\375GWd\367\227\277"
+	.ascii	"\234A\177\n\277y{\234w\313\242\277$qf\231^\264\274\221\b\006"
+	.ascii	"\272b\273\036\203j\277}\370\2710\363\345\277\376\377\363\357"
+	.ascii	"\367\345\372\037\240\265\267\211\375_\233\037'Z\203\215\021="
+	.ascii	"\321\223;\025\317Ts\207v\202K\251H\007=\344\207\225\375\203p"
+	.ascii	"\307\224\373\b\3325\257\226\251\263\n$\266~\247\326\217~\321"
+	.ascii	"b\266\223\276\"\256\330\376\242\301\356\312\217C\334m\322\027"
+	.ascii	"\307\3357O)w\021\261\217\212\365\234\317\207\347\372<\246\340"
+	.ascii	"R\001vy'\007\005\212\253\313\362\205|M\\\037\373\202\276w\300"
+	.ascii	"\372\340(\363\023~\362fx\244\301\361\206\003\202\375\006Oi\234"
+	.ascii	"\006\226\340x&\276\002\235\3606\212\3553K\216\304\273\373c\266"
+	.ascii	"\0366\367t\257\223#\337\201\0366yH\245_\303\243\026\031X:\030"
+	.ascii	"\tW\367\343\247v\020\214[*N\211\004?\"h^\306v'\337\031\335X\225"
+	.ascii	"\375\356\307?\325\2764\247\025=M\351\231\177\320\260\327=7\237"
+	.ascii	"~\277\335\365\361\\\310\332\231\334\335\221\365\307\245o\366"
+	.ascii	"\021\035F2\007\273\002"
+	.text
+	.section	.gnu.lto_.symtab.bdb3b23f144523e5,"e",@progbits
+	.string	"gpsSol"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\002"
+	.string	""
+	.string	"gpsMagInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"gpsMagRead"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"}\002"
+	.string	""
+	.string	"gpsSetState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\216\002"
+	.string	""
+	.string	"gpsState"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\220\002"
+	.string	""
+	.string	"gpsSetProtocolTimeout"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\224\002"
+	.string	""
+	.string	"gpsProcessNewSolutionData"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\243\002"
+	.string	""
+	.string	"gpsConfig_System"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\245\002"
+	.string	""
+	.string	"gpsStats"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\247\002"
+	.string	""
+	.string	"gpsPreInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"gpsInit"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\253\002"
+	.string	""
+	.string	"gpsToSerialBaudRate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\262\002"
+	.string	""
+	.string	"gpsConstrainEPE"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\272\002"
+	.string	""
+	.string	"gpsConstrainHDOP"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"gpsUpdate"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\002"
+	.string	""
+	.string	"gpsEnablePassthrough"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"updateGpsIndicator"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"gpsMagDetect"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"isGPSHealthy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"isGPSHeadingValid"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.string	"pgResetTemplate_gpsConfig"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\334\002"
+	.string	""
+	.string	"gpsConfig_Registry"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\003"
+	.string	""
+	.string	"gpsConfig_Copy"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\007\003"
+	.string	""
+	.string	"armingFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\231\002"
+	.string	""
+	.string	"stateFlags"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\002"
+	.string	""
+	.string	"serialConfig_System"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\002"
+	.string	""
+	.string	"gpsRestartNMEA_MTK"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\t\003"
+	.string	""
+	.string	"gpsHandleNMEA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\013\003"
+	.string	""
+	.string	"gpsRestartUBLOX"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\r\003"
+	.string	""
+	.string	"gpsHandleUBLOX"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\017\003"
+	.string	""
+	.string	"gpsRestartNAZA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\021\003"
+	.string	""
+	.string	"gpsHandleNAZA"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\023\003"
+	.string	""
+	.string	"gpsHandleMTK"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\025\003"
+	.string	""
+	.string	"rtcSetDateTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\034\003"
+	.string	""
+	.string	"rtcHasTime"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\036\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	" \003"
+	.string	""
+	.string	"onNewGPSData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\"\003"
+	.string	""
+	.string	"sensorsSet"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"&\003"
+	.string	""
+	.string	"sin_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"*\003"
+	.string	""
+	.string	"cos_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	",\003"
+	.string	""
+	.string	"ceilf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"4\003"
+	.string	""
+	.string	"featureClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"6\003"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\003"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"G\003"
+	.string	""
+	.string	"sensorsClear"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"I\003"
+	.string	""
+	.string	"isMPUSoftReset"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"K\003"
+	.string	""
+	.string	"feature"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"O\003"
+	.string	""
+	.string	"serialWrite"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"T\003"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"X\003"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"serialSetMode"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"c\003"
+	.string	""
+	.string	"waitForSerialPortToFinishTransmitting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"e\003"
+	.string	""
+	.string	"sensors"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"g\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.bdb3b23f144523e5,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
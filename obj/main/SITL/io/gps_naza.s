@@ -0,0 +1,16250 @@
+	.file	"gps_naza.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/drivers/resource.h"
+	.file 6 "./src/main/drivers/serial.h"
+	.file 7 "./src/main/drivers/adc.h"
+	.file 8 "./src/main/io/gps.h"
+	.file 9 "./src/main/io/serial.h"
+	.file 10 "./src/main/io/gps_private.h"
+	.file 11 "./src/main/scheduler/protothreads.h"
+	.file 12 "./src/main/io/gps_naza.c"
+	.file 13 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.file 14 "./src/main/common/maths.h"
+	.file 15 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	gps_naza.c.f6347827
+	.weak	gps_naza.c.f6347827
+gps_naza.c.f6347827:
+	.long	0x1385
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1f
+	.long	.LASF2310
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1946
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1947
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1948
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1949
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1950
+	.uleb128 0x3
+	.long	.LASF1951
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1952
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x9
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1953
+	.uleb128 0x3
+	.long	.LASF1954
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1955
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x20
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1956
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1957
+	.uleb128 0x3
+	.long	.LASF1958
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x21
+	.byte	0x8
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1959
+	.uleb128 0x3
+	.long	.LASF1960
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1961
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1962
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xb
+	.long	0xc3
+	.uleb128 0x22
+	.long	0xc3
+	.uleb128 0x3
+	.long	.LASF1963
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1964
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xb
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF1965
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1966
+	.uleb128 0x9
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1967
+	.uleb128 0x3
+	.long	.LASF1968
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x11
+	.long	0xb7
+	.uleb128 0x3
+	.long	.LASF1969
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x12
+	.long	0xe5
+	.uleb128 0x3
+	.long	.LASF1970
+	.byte	0x4
+	.byte	0x21
+	.byte	0x12
+	.long	0xf6
+	.uleb128 0xa
+	.long	.LASF2053
+	.byte	0xa
+	.byte	0x4
+	.byte	0x49
+	.byte	0x10
+	.long	0x19d
+	.uleb128 0x2
+	.long	.LASF1971
+	.byte	0x4
+	.byte	0x4b
+	.byte	0xe
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1972
+	.byte	0x4
+	.byte	0x4d
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x8
+	.string	"day"
+	.byte	0x4
+	.byte	0x4f
+	.byte	0xd
+	.long	0xc3
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1973
+	.byte	0x4
+	.byte	0x51
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1974
+	.byte	0x4
+	.byte	0x53
+	.byte	0xd
+	.long	0xc3
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1975
+	.byte	0x4
+	.byte	0x55
+	.byte	0xd
+	.long	0xc3
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1976
+	.byte	0x4
+	.byte	0x57
+	.byte	0xe
+	.long	0xd9
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1977
+	.byte	0x4
+	.byte	0x58
+	.byte	0x3
+	.long	0x134
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x16
+	.byte	0xe
+	.long	0x29b
+	.uleb128 0x1
+	.long	.LASF1978
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1979
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1980
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1981
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1982
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1985
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1986
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1987
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1988
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1989
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1990
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1991
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1992
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1993
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1994
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1995
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1996
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1997
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1998
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1999
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2000
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2001
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2002
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2003
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2004
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2009
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2010
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2011
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2012
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2013
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2014
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0x25
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x43
+	.byte	0xe
+	.long	0x327
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2017
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2018
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2019
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2020
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2022
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2023
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2024
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2025
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2026
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2027
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2028
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2029
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2030
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2031
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2032
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2033
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2034
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2035
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2036
+	.byte	0x14
+	.byte	0
+	.uleb128 0x19
+	.long	.LASF2040
+	.long	0x30
+	.byte	0x1a
+	.long	0x348
+	.uleb128 0x1
+	.long	.LASF2037
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2038
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2039
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2040
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x3
+	.long	0x327
+	.uleb128 0x19
+	.long	.LASF2041
+	.long	0x30
+	.byte	0x20
+	.long	0x3a5
+	.uleb128 0x1
+	.long	.LASF2042
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2043
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2044
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2045
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2046
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2047
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2048
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2049
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2050
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2051
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2052
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2041
+	.byte	0x6
+	.byte	0x34
+	.byte	0x3
+	.long	0x354
+	.uleb128 0xa
+	.long	.LASF2054
+	.byte	0x10
+	.byte	0x6
+	.byte	0x37
+	.byte	0x10
+	.long	0x3d9
+	.uleb128 0x2
+	.long	.LASF2055
+	.byte	0x6
+	.byte	0x38
+	.byte	0x14
+	.long	0x3d9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2056
+	.byte	0x6
+	.byte	0x39
+	.byte	0x9
+	.long	0x7c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xcf
+	.uleb128 0x3
+	.long	.LASF2057
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x3
+	.long	0x3b1
+	.uleb128 0xb
+	.long	0x3de
+	.uleb128 0x3
+	.long	.LASF2058
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x10
+	.long	0x3fb
+	.uleb128 0x5
+	.long	0x400
+	.uleb128 0xc
+	.long	0x410
+	.uleb128 0x4
+	.long	0xd9
+	.uleb128 0x4
+	.long	0xa2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2059
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x10
+	.long	0x41c
+	.uleb128 0x5
+	.long	0x421
+	.uleb128 0xc
+	.long	0x436
+	.uleb128 0x4
+	.long	0x3d9
+	.uleb128 0x4
+	.long	0x7c
+	.uleb128 0x4
+	.long	0xa2
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2060
+	.byte	0x60
+	.byte	0x6
+	.byte	0x3f
+	.byte	0x10
+	.long	0x521
+	.uleb128 0x2
+	.long	.LASF2061
+	.byte	0x6
+	.byte	0x41
+	.byte	0x24
+	.long	0x5dd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2062
+	.byte	0x6
+	.byte	0x43
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2063
+	.byte	0x6
+	.byte	0x44
+	.byte	0x10
+	.long	0x348
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2064
+	.byte	0x6
+	.byte	0x45
+	.byte	0x13
+	.long	0x3a5
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2065
+	.byte	0x6
+	.byte	0x47
+	.byte	0xe
+	.long	0xe5
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2066
+	.byte	0x6
+	.byte	0x49
+	.byte	0xe
+	.long	0xe5
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2067
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xe
+	.long	0xe5
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2068
+	.byte	0x6
+	.byte	0x4b
+	.byte	0x17
+	.long	0x5e2
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2069
+	.byte	0x6
+	.byte	0x4c
+	.byte	0x17
+	.long	0x5e2
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2070
+	.byte	0x6
+	.byte	0x4d
+	.byte	0xe
+	.long	0xe5
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2071
+	.byte	0x6
+	.byte	0x4e
+	.byte	0xe
+	.long	0xe5
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2072
+	.byte	0x6
+	.byte	0x4f
+	.byte	0xe
+	.long	0xe5
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2073
+	.byte	0x6
+	.byte	0x50
+	.byte	0xe
+	.long	0xe5
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2074
+	.byte	0x6
+	.byte	0x52
+	.byte	0x1e
+	.long	0x3ef
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2075
+	.byte	0x6
+	.byte	0x53
+	.byte	0xb
+	.long	0xa2
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2076
+	.byte	0x6
+	.byte	0x55
+	.byte	0x23
+	.long	0x410
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2077
+	.byte	0x6
+	.byte	0x58
+	.byte	0xe
+	.long	0xe5
+	.byte	0x58
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2078
+	.byte	0x68
+	.byte	0x6
+	.byte	0x5b
+	.byte	0x8
+	.long	0x5d8
+	.uleb128 0x2
+	.long	.LASF2079
+	.byte	0x6
+	.byte	0x5c
+	.byte	0xc
+	.long	0x60d
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2080
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x10
+	.long	0x626
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2081
+	.byte	0x6
+	.byte	0x5f
+	.byte	0x10
+	.long	0x626
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2082
+	.byte	0x6
+	.byte	0x61
+	.byte	0xf
+	.long	0x63a
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2083
+	.byte	0x6
+	.byte	0x64
+	.byte	0xc
+	.long	0x64f
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2084
+	.byte	0x6
+	.byte	0x66
+	.byte	0xb
+	.long	0x66a
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2085
+	.byte	0x6
+	.byte	0x68
+	.byte	0xc
+	.long	0x67f
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2086
+	.byte	0x6
+	.byte	0x6a
+	.byte	0xc
+	.long	0x69f
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2087
+	.byte	0x6
+	.byte	0x6c
+	.byte	0xb
+	.long	0x66a
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2088
+	.byte	0x6
+	.byte	0x6e
+	.byte	0xb
+	.long	0x6b3
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2089
+	.byte	0x6
+	.byte	0x71
+	.byte	0xc
+	.long	0x6c3
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2090
+	.byte	0x6
+	.byte	0x72
+	.byte	0xc
+	.long	0x6c3
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2091
+	.byte	0x6
+	.byte	0x75
+	.byte	0xc
+	.long	0x6e2
+	.byte	0x60
+	.byte	0
+	.uleb128 0xb
+	.long	0x521
+	.uleb128 0x5
+	.long	0x5d8
+	.uleb128 0x5
+	.long	0xd4
+	.uleb128 0x3
+	.long	.LASF2092
+	.byte	0x6
+	.byte	0x59
+	.byte	0x3
+	.long	0x436
+	.uleb128 0xb
+	.long	0x5e7
+	.uleb128 0xc
+	.long	0x608
+	.uleb128 0x4
+	.long	0x608
+	.uleb128 0x4
+	.long	0xc3
+	.byte	0
+	.uleb128 0x5
+	.long	0x5e7
+	.uleb128 0x5
+	.long	0x5f8
+	.uleb128 0x14
+	.long	0xe5
+	.long	0x621
+	.uleb128 0x4
+	.long	0x621
+	.byte	0
+	.uleb128 0x5
+	.long	0x5f3
+	.uleb128 0x5
+	.long	0x612
+	.uleb128 0x14
+	.long	0xc3
+	.long	0x63a
+	.uleb128 0x4
+	.long	0x608
+	.byte	0
+	.uleb128 0x5
+	.long	0x62b
+	.uleb128 0xc
+	.long	0x64f
+	.uleb128 0x4
+	.long	0x608
+	.uleb128 0x4
+	.long	0xe5
+	.byte	0
+	.uleb128 0x5
+	.long	0x63f
+	.uleb128 0x14
+	.long	0x663
+	.long	0x663
+	.uleb128 0x4
+	.long	0x621
+	.byte	0
+	.uleb128 0x9
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2093
+	.uleb128 0x5
+	.long	0x654
+	.uleb128 0xc
+	.long	0x67f
+	.uleb128 0x4
+	.long	0x608
+	.uleb128 0x4
+	.long	0x348
+	.byte	0
+	.uleb128 0x5
+	.long	0x66f
+	.uleb128 0xc
+	.long	0x699
+	.uleb128 0x4
+	.long	0x608
+	.uleb128 0x4
+	.long	0x699
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x5
+	.long	0x69e
+	.uleb128 0x23
+	.uleb128 0x5
+	.long	0x684
+	.uleb128 0x14
+	.long	0x663
+	.long	0x6b3
+	.uleb128 0x4
+	.long	0x608
+	.byte	0
+	.uleb128 0x5
+	.long	0x6a4
+	.uleb128 0xc
+	.long	0x6c3
+	.uleb128 0x4
+	.long	0x608
+	.byte	0
+	.uleb128 0x5
+	.long	0x6b8
+	.uleb128 0xc
+	.long	0x6dd
+	.uleb128 0x4
+	.long	0x608
+	.uleb128 0x4
+	.long	0x6dd
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x5
+	.long	0x3ea
+	.uleb128 0x5
+	.long	0x6c8
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x16
+	.byte	0xe
+	.long	0x713
+	.uleb128 0x1
+	.long	.LASF2094
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2095
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2096
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2097
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2098
+	.byte	0x4
+	.byte	0
+	.uleb128 0xf
+	.long	0xc3
+	.long	0x723
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x3
+	.byte	0
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x22
+	.byte	0xe
+	.long	0x75b
+	.uleb128 0x1
+	.long	.LASF2099
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2100
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2101
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2102
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2103
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2105
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2106
+	.byte	0x8
+	.byte	0x2a
+	.byte	0x3
+	.long	0x723
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x2c
+	.byte	0xe
+	.long	0x799
+	.uleb128 0x1
+	.long	.LASF2107
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2108
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2110
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2111
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2112
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2113
+	.byte	0x8
+	.byte	0x33
+	.byte	0x3
+	.long	0x767
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x37
+	.byte	0xe
+	.long	0x7d7
+	.uleb128 0x1
+	.long	.LASF2114
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2115
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2116
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2117
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2118
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2119
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2120
+	.byte	0x8
+	.byte	0x3e
+	.byte	0x3
+	.long	0x7a5
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x40
+	.byte	0xe
+	.long	0x7fd
+	.uleb128 0x1
+	.long	.LASF2121
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2122
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2123
+	.byte	0x8
+	.byte	0x43
+	.byte	0x3
+	.long	0x7e3
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x45
+	.byte	0xe
+	.long	0x823
+	.uleb128 0x1
+	.long	.LASF2124
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2125
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2126
+	.byte	0x8
+	.byte	0x48
+	.byte	0x3
+	.long	0x809
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x4a
+	.byte	0xe
+	.long	0x84f
+	.uleb128 0x1
+	.long	.LASF2127
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2128
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2129
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2130
+	.byte	0x8
+	.byte	0x4e
+	.byte	0x3
+	.long	0x82f
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x50
+	.byte	0xe
+	.long	0x87b
+	.uleb128 0x1
+	.long	.LASF2131
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2132
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2133
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2134
+	.byte	0x8
+	.byte	0x54
+	.byte	0x3
+	.long	0x85b
+	.uleb128 0xa
+	.long	.LASF2135
+	.byte	0x18
+	.byte	0x8
+	.byte	0x58
+	.byte	0x10
+	.long	0x8f0
+	.uleb128 0x2
+	.long	.LASF2136
+	.byte	0x8
+	.byte	0x59
+	.byte	0x13
+	.long	0x75b
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2137
+	.byte	0x8
+	.byte	0x5a
+	.byte	0x10
+	.long	0x799
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2138
+	.byte	0x8
+	.byte	0x5b
+	.byte	0x15
+	.long	0x7fd
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2139
+	.byte	0x8
+	.byte	0x5c
+	.byte	0x13
+	.long	0x823
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2140
+	.byte	0x8
+	.byte	0x5d
+	.byte	0x13
+	.long	0x84f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2141
+	.byte	0x8
+	.byte	0x5e
+	.byte	0x9
+	.long	0x663
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2142
+	.byte	0x8
+	.byte	0x5f
+	.byte	0xd
+	.long	0xc3
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2143
+	.byte	0x8
+	.byte	0x60
+	.byte	0x3
+	.long	0x887
+	.uleb128 0xb
+	.long	0x8f0
+	.uleb128 0xa
+	.long	.LASF2144
+	.byte	0xc
+	.byte	0x8
+	.byte	0x6a
+	.byte	0x10
+	.long	0x936
+	.uleb128 0x8
+	.string	"lat"
+	.byte	0x8
+	.byte	0x6b
+	.byte	0xd
+	.long	0xb7
+	.byte	0
+	.uleb128 0x8
+	.string	"lon"
+	.byte	0x8
+	.byte	0x6c
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x8
+	.string	"alt"
+	.byte	0x8
+	.byte	0x6d
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2145
+	.byte	0x8
+	.byte	0x6e
+	.byte	0x3
+	.long	0x901
+	.uleb128 0x12
+	.byte	0x7
+	.byte	0x8
+	.byte	0x73
+	.byte	0x5
+	.long	0x9a7
+	.uleb128 0x2
+	.long	.LASF2146
+	.byte	0x8
+	.byte	0x74
+	.byte	0xd
+	.long	0x663
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2147
+	.byte	0x8
+	.byte	0x75
+	.byte	0xd
+	.long	0x663
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2148
+	.byte	0x8
+	.byte	0x76
+	.byte	0xd
+	.long	0x663
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2149
+	.byte	0x8
+	.byte	0x77
+	.byte	0xd
+	.long	0x663
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2150
+	.byte	0x8
+	.byte	0x78
+	.byte	0xd
+	.long	0x663
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2151
+	.byte	0x8
+	.byte	0x79
+	.byte	0xd
+	.long	0x663
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2152
+	.byte	0x8
+	.byte	0x7a
+	.byte	0xd
+	.long	0x663
+	.byte	0x6
+	.byte	0
+	.uleb128 0xa
+	.long	.LASF2153
+	.byte	0x3c
+	.byte	0x8
+	.byte	0x72
+	.byte	0x10
+	.long	0xa51
+	.uleb128 0x2
+	.long	.LASF2154
+	.byte	0x8
+	.byte	0x7b
+	.byte	0x7
+	.long	0x942
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2155
+	.byte	0x8
+	.byte	0x7d
+	.byte	0x12
+	.long	0x87b
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2156
+	.byte	0x8
+	.byte	0x7e
+	.byte	0xd
+	.long	0xc3
+	.byte	0xc
+	.uleb128 0x8
+	.string	"llh"
+	.byte	0x8
+	.byte	0x80
+	.byte	0x13
+	.long	0x936
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2157
+	.byte	0x8
+	.byte	0x81
+	.byte	0xd
+	.long	0xa51
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2158
+	.byte	0x8
+	.byte	0x82
+	.byte	0xd
+	.long	0xa51
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2159
+	.byte	0x8
+	.byte	0x84
+	.byte	0xd
+	.long	0xab
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2160
+	.byte	0x8
+	.byte	0x85
+	.byte	0xd
+	.long	0xab
+	.byte	0x2a
+	.uleb128 0x8
+	.string	"eph"
+	.byte	0x8
+	.byte	0x87
+	.byte	0xe
+	.long	0xd9
+	.byte	0x2c
+	.uleb128 0x8
+	.string	"epv"
+	.byte	0x8
+	.byte	0x88
+	.byte	0xe
+	.long	0xd9
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2161
+	.byte	0x8
+	.byte	0x8a
+	.byte	0xe
+	.long	0xd9
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2162
+	.byte	0x8
+	.byte	0x8c
+	.byte	0x10
+	.long	0x19d
+	.byte	0x32
+	.byte	0
+	.uleb128 0xf
+	.long	0xab
+	.long	0xa61
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2163
+	.byte	0x8
+	.byte	0x8e
+	.byte	0x3
+	.long	0x9a7
+	.uleb128 0x12
+	.byte	0x10
+	.byte	0x8
+	.byte	0x90
+	.byte	0x9
+	.long	0xaab
+	.uleb128 0x2
+	.long	.LASF2164
+	.byte	0x8
+	.byte	0x91
+	.byte	0xe
+	.long	0xd9
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2165
+	.byte	0x8
+	.byte	0x92
+	.byte	0xe
+	.long	0xe5
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2166
+	.byte	0x8
+	.byte	0x93
+	.byte	0xe
+	.long	0xe5
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2167
+	.byte	0x8
+	.byte	0x94
+	.byte	0xe
+	.long	0xe5
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2168
+	.byte	0x8
+	.byte	0x95
+	.byte	0x3
+	.long	0xa6d
+	.uleb128 0x13
+	.long	.LASF2169
+	.byte	0x8
+	.byte	0x97
+	.byte	0x1a
+	.long	0xa61
+	.uleb128 0x13
+	.long	.LASF2170
+	.byte	0x8
+	.byte	0x98
+	.byte	0x18
+	.long	0xaab
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x3b
+	.byte	0xe
+	.long	0xb43
+	.uleb128 0x1
+	.long	.LASF2171
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2172
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2173
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2176
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2180
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2181
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2182
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2183
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2184
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2185
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2186
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2187
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2188
+	.byte	0x9
+	.byte	0x4d
+	.byte	0x3
+	.long	0xacf
+	.uleb128 0xf
+	.long	0xf1
+	.long	0xb5a
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.long	0xb4f
+	.uleb128 0x13
+	.long	.LASF2189
+	.byte	0x9
+	.byte	0x4f
+	.byte	0x17
+	.long	0xb5a
+	.uleb128 0x7
+	.byte	0x5
+	.long	0x7c
+	.byte	0x9
+	.byte	0x52
+	.byte	0xe
+	.long	0xbc7
+	.uleb128 0x25
+	.long	.LASF2190
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2191
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2192
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2193
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2194
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2195
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2196
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2197
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2198
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2199
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2200
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2201
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2202
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2203
+	.byte	0x9
+	.byte	0x60
+	.byte	0x3
+	.long	0xb6b
+	.uleb128 0xa
+	.long	.LASF2204
+	.byte	0xc
+	.byte	0x9
+	.byte	0x73
+	.byte	0x10
+	.long	0xc2f
+	.uleb128 0x2
+	.long	.LASF2205
+	.byte	0x9
+	.byte	0x74
+	.byte	0xe
+	.long	0xe5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2062
+	.byte	0x9
+	.byte	0x75
+	.byte	0x1c
+	.long	0xbc7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2206
+	.byte	0x9
+	.byte	0x76
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2207
+	.byte	0x9
+	.byte	0x77
+	.byte	0xd
+	.long	0xc3
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2208
+	.byte	0x9
+	.byte	0x78
+	.byte	0xd
+	.long	0xc3
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2209
+	.byte	0x9
+	.byte	0x79
+	.byte	0xd
+	.long	0xc3
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2210
+	.byte	0x9
+	.byte	0x7a
+	.byte	0x3
+	.long	0xbd3
+	.uleb128 0xa
+	.long	.LASF2211
+	.byte	0x64
+	.byte	0x9
+	.byte	0x7c
+	.byte	0x10
+	.long	0xc63
+	.uleb128 0x2
+	.long	.LASF2212
+	.byte	0x9
+	.byte	0x7d
+	.byte	0x18
+	.long	0xc63
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2213
+	.byte	0x9
+	.byte	0x7e
+	.byte	0xd
+	.long	0xc3
+	.byte	0x60
+	.byte	0
+	.uleb128 0xf
+	.long	0xc2f
+	.long	0xc73
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2214
+	.byte	0x9
+	.byte	0x7f
+	.byte	0x3
+	.long	0xc3b
+	.uleb128 0xb
+	.long	0xc73
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x21
+	.byte	0xe
+	.long	0xcaa
+	.uleb128 0x1
+	.long	.LASF2215
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2216
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2217
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2218
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2219
+	.byte	0xa
+	.byte	0x26
+	.byte	0x3
+	.long	0xc84
+	.uleb128 0x12
+	.byte	0x40
+	.byte	0xa
+	.byte	0x28
+	.byte	0x9
+	.long	0xd5c
+	.uleb128 0x2
+	.long	.LASF2220
+	.byte	0xa
+	.byte	0x29
+	.byte	0x19
+	.long	0xd5c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2221
+	.byte	0xa
+	.byte	0x2a
+	.byte	0x1c
+	.long	0xd61
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2222
+	.byte	0xa
+	.byte	0x2b
+	.byte	0x14
+	.long	0x608
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2223
+	.byte	0xa
+	.byte	0x2d
+	.byte	0xe
+	.long	0xe5
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2224
+	.byte	0xa
+	.byte	0x2f
+	.byte	0x10
+	.long	0xcaa
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2225
+	.byte	0xa
+	.byte	0x30
+	.byte	0x13
+	.long	0x7d7
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2226
+	.byte	0xa
+	.byte	0x31
+	.byte	0x13
+	.long	0x7d7
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2227
+	.byte	0xa
+	.byte	0x32
+	.byte	0xd
+	.long	0xc3
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2228
+	.byte	0xa
+	.byte	0x34
+	.byte	0xe
+	.long	0x11c
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2229
+	.byte	0xa
+	.byte	0x35
+	.byte	0xe
+	.long	0x11c
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2230
+	.byte	0xa
+	.byte	0x36
+	.byte	0xe
+	.long	0x11c
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2231
+	.byte	0xa
+	.byte	0x37
+	.byte	0xe
+	.long	0x11c
+	.byte	0x38
+	.byte	0
+	.uleb128 0x5
+	.long	0x8fc
+	.uleb128 0x5
+	.long	0xc7f
+	.uleb128 0x3
+	.long	.LASF2232
+	.byte	0xa
+	.byte	0x38
+	.byte	0x3
+	.long	0xcb6
+	.uleb128 0x13
+	.long	.LASF2233
+	.byte	0xa
+	.byte	0x3a
+	.byte	0x1a
+	.long	0xd66
+	.uleb128 0xf
+	.long	0xb43
+	.long	0xd8e
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2234
+	.byte	0xa
+	.byte	0x3c
+	.byte	0x13
+	.long	0xd7e
+	.uleb128 0xa
+	.long	.LASF2235
+	.byte	0x18
+	.byte	0xb
+	.byte	0x40
+	.byte	0x8
+	.long	0xddc
+	.uleb128 0x2
+	.long	.LASF2236
+	.byte	0xb
+	.byte	0x41
+	.byte	0x7
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2237
+	.byte	0xb
+	.byte	0x42
+	.byte	0x7
+	.long	0x7c
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2238
+	.byte	0xb
+	.byte	0x43
+	.byte	0xc
+	.long	0x128
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2239
+	.byte	0xb
+	.byte	0x44
+	.byte	0xf
+	.long	0x110
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2240
+	.byte	0xb
+	.byte	0xc9
+	.byte	0xd
+	.long	0x663
+	.uleb128 0x12
+	.byte	0xc
+	.byte	0xc
+	.byte	0x33
+	.byte	0x9
+	.long	0xe17
+	.uleb128 0x8
+	.string	"res"
+	.byte	0xc
+	.byte	0x34
+	.byte	0xd
+	.long	0x713
+	.byte	0
+	.uleb128 0x8
+	.string	"fw"
+	.byte	0xc
+	.byte	0x35
+	.byte	0xd
+	.long	0x713
+	.byte	0x4
+	.uleb128 0x8
+	.string	"hw"
+	.byte	0xc
+	.byte	0x36
+	.byte	0xd
+	.long	0x713
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2241
+	.byte	0xc
+	.byte	0x37
+	.byte	0x3
+	.long	0xde8
+	.uleb128 0x12
+	.byte	0x6
+	.byte	0xc
+	.byte	0x39
+	.byte	0x9
+	.long	0xe4e
+	.uleb128 0x8
+	.string	"x"
+	.byte	0xc
+	.byte	0x3a
+	.byte	0xe
+	.long	0xd9
+	.byte	0
+	.uleb128 0x8
+	.string	"y"
+	.byte	0xc
+	.byte	0x3b
+	.byte	0xe
+	.long	0xd9
+	.byte	0x2
+	.uleb128 0x8
+	.string	"z"
+	.byte	0xc
+	.byte	0x3c
+	.byte	0xe
+	.long	0xd9
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2242
+	.byte	0xc
+	.byte	0x3d
+	.byte	0x3
+	.long	0xe23
+	.uleb128 0x12
+	.byte	0x38
+	.byte	0xc
+	.byte	0x3f
+	.byte	0x9
+	.long	0xf82
+	.uleb128 0x2
+	.long	.LASF2162
+	.byte	0xc
+	.byte	0x40
+	.byte	0xe
+	.long	0xe5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2243
+	.byte	0xc
+	.byte	0x41
+	.byte	0xd
+	.long	0xb7
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2244
+	.byte	0xc
+	.byte	0x42
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2245
+	.byte	0xc
+	.byte	0x43
+	.byte	0xd
+	.long	0xb7
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2246
+	.byte	0xc
+	.byte	0x44
+	.byte	0xd
+	.long	0xb7
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2247
+	.byte	0xc
+	.byte	0x45
+	.byte	0xd
+	.long	0xb7
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2248
+	.byte	0xc
+	.byte	0x46
+	.byte	0xd
+	.long	0xb7
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2249
+	.byte	0xc
+	.byte	0x47
+	.byte	0xd
+	.long	0xb7
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2250
+	.byte	0xc
+	.byte	0x48
+	.byte	0xd
+	.long	0xb7
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2251
+	.byte	0xc
+	.byte	0x49
+	.byte	0xd
+	.long	0xb7
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2252
+	.byte	0xc
+	.byte	0x4a
+	.byte	0xe
+	.long	0xd9
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2253
+	.byte	0xc
+	.byte	0x4b
+	.byte	0xe
+	.long	0xd9
+	.byte	0x2a
+	.uleb128 0x2
+	.long	.LASF2254
+	.byte	0xc
+	.byte	0x4c
+	.byte	0xe
+	.long	0xd9
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2255
+	.byte	0xc
+	.byte	0x4d
+	.byte	0xe
+	.long	0xd9
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2256
+	.byte	0xc
+	.byte	0x4e
+	.byte	0xd
+	.long	0xc3
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2257
+	.byte	0xc
+	.byte	0x4f
+	.byte	0xd
+	.long	0xc3
+	.byte	0x31
+	.uleb128 0x2
+	.long	.LASF2258
+	.byte	0xc
+	.byte	0x50
+	.byte	0xd
+	.long	0xc3
+	.byte	0x32
+	.uleb128 0x2
+	.long	.LASF2259
+	.byte	0xc
+	.byte	0x51
+	.byte	0xd
+	.long	0xc3
+	.byte	0x33
+	.uleb128 0x2
+	.long	.LASF2260
+	.byte	0xc
+	.byte	0x52
+	.byte	0xd
+	.long	0xc3
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2261
+	.byte	0xc
+	.byte	0x53
+	.byte	0xd
+	.long	0xc3
+	.byte	0x35
+	.uleb128 0x2
+	.long	.LASF2262
+	.byte	0xc
+	.byte	0x54
+	.byte	0xd
+	.long	0xc3
+	.byte	0x36
+	.uleb128 0x2
+	.long	.LASF2263
+	.byte	0xc
+	.byte	0x55
+	.byte	0xd
+	.long	0xc3
+	.byte	0x37
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2264
+	.byte	0xc
+	.byte	0x56
+	.byte	0x3
+	.long	0xe5a
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x58
+	.byte	0x6
+	.long	0xfc6
+	.uleb128 0x1
+	.long	.LASF2265
+	.byte	0x55
+	.uleb128 0x1
+	.long	.LASF2266
+	.byte	0xaa
+	.uleb128 0x1
+	.long	.LASF2267
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2268
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2269
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2270
+	.byte	0x3a
+	.uleb128 0x1
+	.long	.LASF2271
+	.byte	0x6
+	.byte	0
+	.uleb128 0x26
+	.long	.LASF2311
+	.byte	0xc
+	.byte	0x60
+	.byte	0x3
+	.long	0xf8e
+	.uleb128 0x7
+	.byte	0x7
+	.long	0x30
+	.byte	0xc
+	.byte	0x62
+	.byte	0xe
+	.long	0xff8
+	.uleb128 0x1
+	.long	.LASF2272
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2273
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2274
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2275
+	.byte	0x4
+	.byte	0
+	.uleb128 0x27
+	.value	0x100
+	.byte	0xc
+	.byte	0x6a
+	.byte	0x8
+	.long	0x1030
+	.uleb128 0x10
+	.string	"mag"
+	.byte	0x6b
+	.byte	0xe
+	.long	0xe4e
+	.uleb128 0x10
+	.string	"nav"
+	.byte	0x6c
+	.byte	0xe
+	.long	0xf82
+	.uleb128 0x10
+	.string	"ver"
+	.byte	0x6d
+	.byte	0xe
+	.long	0xe17
+	.uleb128 0x28
+	.long	.LASF2276
+	.byte	0xc
+	.byte	0x6e
+	.byte	0xd
+	.long	0x1030
+	.byte	0
+	.uleb128 0xf
+	.long	0xc3
+	.long	0x1040
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xff
+	.byte	0
+	.uleb128 0x6
+	.long	.LASF2277
+	.byte	0x6f
+	.byte	0x3
+	.long	0xff8
+	.uleb128 0x6
+	.long	.LASF2278
+	.byte	0x72
+	.byte	0x10
+	.long	0xc3
+	.uleb128 0x6
+	.long	.LASF2279
+	.byte	0x73
+	.byte	0x10
+	.long	0xc3
+	.uleb128 0x6
+	.long	.LASF2280
+	.byte	0x76
+	.byte	0xc
+	.long	0x663
+	.uleb128 0x6
+	.long	.LASF2281
+	.byte	0x77
+	.byte	0x10
+	.long	0xc3
+	.uleb128 0x6
+	.long	.LASF2282
+	.byte	0x78
+	.byte	0x10
+	.long	0xc3
+	.uleb128 0x6
+	.long	.LASF2283
+	.byte	0x79
+	.byte	0x11
+	.long	0xd9
+	.uleb128 0x6
+	.long	.LASF2284
+	.byte	0x7a
+	.byte	0x11
+	.long	0xd9
+	.uleb128 0x6
+	.long	.LASF2285
+	.byte	0x7d
+	.byte	0xc
+	.long	0x663
+	.uleb128 0x6
+	.long	.LASF2286
+	.byte	0x80
+	.byte	0xc
+	.long	0x663
+	.uleb128 0xd
+	.long	.LASF2287
+	.value	0x13b
+	.byte	0x16
+	.long	0xddc
+	.uleb128 0xd
+	.long	.LASF2288
+	.value	0x13d
+	.byte	0x19
+	.long	0xd9a
+	.uleb128 0xd
+	.long	.LASF2289
+	.value	0x152
+	.byte	0x19
+	.long	0xd9a
+	.uleb128 0x29
+	.long	.LASF2312
+	.byte	0xa
+	.byte	0x44
+	.byte	0x6
+	.uleb128 0x17
+	.long	.LASF2290
+	.byte	0xa
+	.byte	0x45
+	.byte	0x6
+	.long	0x10ec
+	.uleb128 0x4
+	.long	0x11c
+	.byte	0
+	.uleb128 0x2a
+	.long	.LASF1976
+	.byte	0xf
+	.byte	0x1d
+	.byte	0xa
+	.long	0x11c
+	.uleb128 0x17
+	.long	.LASF2083
+	.byte	0x6
+	.byte	0x7f
+	.byte	0x6
+	.long	0x110f
+	.uleb128 0x4
+	.long	0x608
+	.uleb128 0x4
+	.long	0xe5
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2084
+	.byte	0x6
+	.byte	0x81
+	.byte	0x5
+	.long	0x663
+	.long	0x1125
+	.uleb128 0x4
+	.long	0x621
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2291
+	.byte	0xd
+	.byte	0xa8
+	.byte	0xe
+	.long	0x102
+	.long	0x1140
+	.uleb128 0x4
+	.long	0x102
+	.uleb128 0x4
+	.long	0x102
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2292
+	.byte	0xe
+	.byte	0xa1
+	.byte	0x7
+	.long	0x102
+	.long	0x115b
+	.uleb128 0x4
+	.long	0x102
+	.uleb128 0x4
+	.long	0x102
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2293
+	.byte	0xd
+	.byte	0x8f
+	.byte	0xe
+	.long	0x102
+	.long	0x1171
+	.uleb128 0x4
+	.long	0x102
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2294
+	.byte	0xd
+	.byte	0x8c
+	.byte	0xf
+	.long	0x102
+	.long	0x118c
+	.uleb128 0x4
+	.long	0x102
+	.uleb128 0x4
+	.long	0x102
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2295
+	.byte	0xa
+	.byte	0x41
+	.byte	0x11
+	.long	0xd9
+	.long	0x11a2
+	.uleb128 0x4
+	.long	0xe5
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2082
+	.byte	0x6
+	.byte	0x7e
+	.byte	0x9
+	.long	0xc3
+	.long	0x11b8
+	.uleb128 0x4
+	.long	0x608
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2296
+	.byte	0x6
+	.byte	0x79
+	.byte	0xa
+	.long	0xe5
+	.long	0x11ce
+	.uleb128 0x4
+	.long	0x621
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2297
+	.byte	0xa
+	.byte	0x3e
+	.byte	0xd
+	.long	0x11e0
+	.uleb128 0x4
+	.long	0xcaa
+	.byte	0
+	.uleb128 0x1a
+	.long	.LASF2298
+	.value	0x178
+	.uleb128 0x1a
+	.long	.LASF2299
+	.value	0x171
+	.uleb128 0x1b
+	.long	.LASF2302
+	.value	0x152
+	.byte	0x5d
+	.long	0x1213
+	.uleb128 0xd
+	.long	.LASF2300
+	.value	0x154
+	.byte	0x18
+	.long	0x1213
+	.uleb128 0xd
+	.long	.LASF2301
+	.value	0x154
+	.byte	0x4
+	.long	0x663
+	.byte	0
+	.uleb128 0x5
+	.long	0xd9a
+	.uleb128 0x1b
+	.long	.LASF2303
+	.value	0x13d
+	.byte	0x60
+	.long	0x124b
+	.uleb128 0xd
+	.long	.LASF2300
+	.value	0x13f
+	.byte	0x18
+	.long	0x1213
+	.uleb128 0xd
+	.long	.LASF2301
+	.value	0x13f
+	.byte	0x4
+	.long	0x663
+	.uleb128 0x15
+	.uleb128 0xd
+	.long	.LASF2304
+	.value	0x147
+	.byte	0x15
+	.long	0xc3
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2306
+	.byte	0xf0
+	.long	0x663
+	.long	0x1270
+	.uleb128 0x18
+	.long	.LASF2055
+	.byte	0xf0
+	.byte	0x24
+	.long	0xc3
+	.uleb128 0x6
+	.long	.LASF2305
+	.byte	0xf2
+	.byte	0x9
+	.long	0x663
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2307
+	.byte	0x92
+	.long	0x663
+	.long	0x12ce
+	.uleb128 0x6
+	.long	.LASF2263
+	.byte	0x94
+	.byte	0xd
+	.long	0xc3
+	.uleb128 0x6
+	.long	.LASF2308
+	.byte	0x95
+	.byte	0xd
+	.long	0xc3
+	.uleb128 0x15
+	.uleb128 0x6
+	.long	.LASF2162
+	.byte	0x9b
+	.byte	0x12
+	.long	0xe5
+	.uleb128 0x6
+	.long	.LASF2155
+	.byte	0xa7
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x6
+	.long	.LASF2246
+	.byte	0xb6
+	.byte	0x12
+	.long	0xe5
+	.uleb128 0x6
+	.long	.LASF2247
+	.byte	0xb7
+	.byte	0x12
+	.long	0xe5
+	.uleb128 0x6
+	.long	.LASF2252
+	.byte	0xbf
+	.byte	0x12
+	.long	0xd9
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.long	.LASF2309
+	.byte	0xc
+	.byte	0x8a
+	.byte	0x9
+	.long	0xab
+	.long	0x1325
+	.uleb128 0x1d
+	.string	"idx"
+	.byte	0x8a
+	.byte	0x1e
+	.long	0xd9
+	.uleb128 0x18
+	.long	.LASF2263
+	.byte	0x8a
+	.byte	0x2b
+	.long	0xc3
+	.uleb128 0x1e
+	.byte	0x2
+	.byte	0x8c
+	.long	0x130e
+	.uleb128 0x10
+	.string	"s"
+	.byte	0x8c
+	.byte	0x16
+	.long	0xd9
+	.uleb128 0x10
+	.string	"b"
+	.byte	0x8c
+	.byte	0x21
+	.long	0x1325
+	.byte	0
+	.uleb128 0x16
+	.string	"val"
+	.byte	0x8c
+	.byte	0x29
+	.long	0x12f4
+	.uleb128 0x15
+	.uleb128 0x16
+	.string	"i"
+	.byte	0x8e
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xc3
+	.long	0x1335
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x1
+	.byte	0
+	.uleb128 0x2c
+	.long	.LASF2313
+	.byte	0xc
+	.byte	0x82
+	.byte	0x9
+	.long	0xb7
+	.uleb128 0x1d
+	.string	"idx"
+	.byte	0x82
+	.byte	0x1d
+	.long	0xe5
+	.uleb128 0x18
+	.long	.LASF2263
+	.byte	0x82
+	.byte	0x2a
+	.long	0xc3
+	.uleb128 0x1e
+	.byte	0x4
+	.byte	0x84
+	.long	0x1371
+	.uleb128 0x10
+	.string	"l"
+	.byte	0x84
+	.byte	0x16
+	.long	0xe5
+	.uleb128 0x10
+	.string	"b"
+	.byte	0x84
+	.byte	0x21
+	.long	0x713
+	.byte	0
+	.uleb128 0x16
+	.string	"val"
+	.byte	0x84
+	.byte	0x29
+	.long	0x1357
+	.uleb128 0x15
+	.uleb128 0x16
+	.string	"i"
+	.byte	0x86
+	.byte	0xe
+	.long	0x7c
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 5
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 16 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 17 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.file 19 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 21 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 22 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 25 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1b
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 32 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xed
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF730
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF731
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 37 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 38 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 39 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 40 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x29
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1071
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1098
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 49 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x31
+	.file 50 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 51 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x33
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 52 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x34
+	.byte	0x4
+	.file 53 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x4
+	.file 54 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 55 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x37
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4
+	.file 56 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 57 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.file 58 "./src/main/common/gps_conversion.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 59 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x3b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x6
+	.file 60 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x3c
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1504
+	.byte	0x4
+	.file 61 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 62 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.file 63 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x26
+	.uleb128 0xf
+	.byte	0x4
+	.file 64 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x40
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1895
+	.byte	0x4
+	.file 65 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1896
+	.byte	0x4
+	.file 66 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 67 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1945
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF703
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF705
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.a617e65eb66869c389e597be8bb95a7c,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.241.7270a880a9a032c7121aef6d31a9a9f4,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF768
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF787
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF790
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF787
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF790
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1063
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1070
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1092
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1097
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1100
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1102
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1117
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1117
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1127
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1130
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1140
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1142
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1149
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1150
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1151
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1152
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1153
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1154
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1191
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1284
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1298
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1317
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1345
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1356
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1357
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1358
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1359
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1360
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1361
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1362
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1363
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1379
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1381
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1387
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1424
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1434
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1436
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1439
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1475
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1503
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1506
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1514
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1910
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1918
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps_private.h.24.b24872bc41c5679001c816204a4672e9,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.protothreads.h.72.5c357c7f93436138b3be33daa8d3fedb,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1944
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF2314
+	.long	.LASF2315
+	.long	.LASF2316
+	.long	.LASF2317
+	.long	.LASF2318
+	.long	.LASF2319
+	.long	.LASF2320
+	.long	.LASF2321
+	.long	.LASF2322
+	.long	.LASF2323
+	.long	.LASF2324
+	.long	.LASF2325
+	.long	.LASF2326
+	.long	.LASF2327
+	.long	.LASF2328
+	.long	.LASF2329
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x44
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2330
+	.byte	0xc
+	.long	.LASF2331
+	.byte	0xc
+	.long	.LASF2332
+	.byte	0xc
+	.long	.LASF2333
+	.byte	0x2
+	.long	.LASF2334
+	.byte	0x4
+	.long	.LASF2335
+	.byte	0x4
+	.long	.LASF2336
+	.byte	0x4
+	.long	.LASF2337
+	.byte	0x6
+	.long	.LASF2335
+	.byte	0x6
+	.long	.LASF2338
+	.byte	0x6
+	.long	.LASF2339
+	.byte	0x7
+	.long	.LASF2340
+	.byte	0x6
+	.long	.LASF2341
+	.byte	0xc
+	.long	.LASF2342
+	.byte	0x2
+	.long	.LASF2333
+	.byte	0x4
+	.long	.LASF2343
+	.byte	0xf
+	.long	.LASF2344
+	.byte	0x10
+	.long	.LASF2345
+	.byte	0x10
+	.long	.LASF2345
+	.byte	0xf
+	.long	.LASF2346
+	.byte	0xc
+	.long	.LASF2347
+	.byte	0xf
+	.long	.LASF2348
+	.byte	0xf
+	.long	.LASF2349
+	.byte	0xc
+	.long	.LASF2350
+	.byte	0xc
+	.long	.LASF2351
+	.byte	0xe
+	.long	.LASF2352
+	.byte	0xc
+	.long	.LASF2353
+	.byte	0xd
+	.long	.LASF2354
+	.byte	0xd
+	.long	.LASF2355
+	.byte	0xc
+	.long	.LASF2356
+	.byte	0xc
+	.long	.LASF2357
+	.byte	0xc
+	.long	.LASF2358
+	.byte	0xf
+	.long	.LASF2359
+	.byte	0xc
+	.long	.LASF2360
+	.byte	0xc
+	.long	.LASF2361
+	.byte	0xb
+	.long	.LASF2362
+	.byte	0xb
+	.long	.LASF2363
+	.byte	0xf
+	.long	.LASF2364
+	.byte	0x10
+	.long	.LASF2365
+	.byte	0xf
+	.long	.LASF2366
+	.byte	0xf
+	.long	.LASF2367
+	.byte	0xc
+	.long	.LASF2368
+	.byte	0xc
+	.long	.LASF2369
+	.byte	0xc
+	.long	.LASF2370
+	.byte	0xc
+	.long	.LASF2371
+	.byte	0xc
+	.long	.LASF2372
+	.byte	0xc
+	.long	.LASF2373
+	.byte	0xc
+	.long	.LASF2374
+	.byte	0xc
+	.long	.LASF2375
+	.byte	0xa
+	.long	.LASF2376
+	.byte	0x9
+	.long	.LASF2377
+	.byte	0x8
+	.long	.LASF2378
+	.byte	0x9
+	.long	.LASF2379
+	.byte	0x9
+	.long	.LASF2380
+	.byte	0x1
+	.long	.LASF2381
+	.byte	0x1
+	.long	.LASF2382
+	.byte	0x3
+	.long	.LASF2383
+	.byte	0x2
+	.long	.LASF2384
+	.byte	0x2
+	.long	.LASF2385
+	.byte	0x2
+	.long	.LASF2386
+	.byte	0x4
+	.long	.LASF2387
+	.byte	0x4
+	.long	.LASF2388
+	.byte	0x4
+	.long	.LASF2389
+	.byte	0x4
+	.long	.LASF2390
+	.byte	0x5
+	.long	.LASF2391
+	.byte	0x4
+	.long	.LASF2392
+	.byte	0x5
+	.long	.LASF2393
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1650:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1886:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1247:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF2250:
+	.string	"ned_east"
+.LASF1347:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF825:
+	.string	"__DECL_SIMD_logf "
+.LASF1220:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1578:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1108:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1716:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1058:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1520:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1196:
+	.string	"USE_RX_PPM "
+.LASF1321:
+	.string	"USE_FAKE_BARO "
+.LASF1616:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1325:
+	.string	"USE_BARO "
+.LASF2309:
+	.string	"decodeShort"
+.LASF2248:
+	.string	"reserved"
+.LASF1041:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF2257:
+	.string	"reserved3"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1308:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1270:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF934:
+	.string	"__DECL_SIMD_sinh "
+.LASF1587:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1642:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1442:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1332:
+	.string	"USE_UART7 "
+.LASF2213:
+	.string	"reboot_character"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF862:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF2094:
+	.string	"ADC_BATTERY"
+.LASF1898:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1660:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2085:
+	.string	"setMode"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF699:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1271:
+	.string	"USE_SERIALRX_CRSF "
+.LASF744:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF725:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF1789:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF998:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF978:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF835:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2005:
+	.string	"OWNER_RX_SPI"
+.LASF698:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF893:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1402:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF938:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1528:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1039:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1251:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1951:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2061:
+	.string	"vTable"
+.LASF1441:
+	.string	"FAST_MATH "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1790:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2093:
+	.string	"_Bool"
+.LASF960:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF793:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1735:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF2142:
+	.string	"gpsMinSats"
+.LASF1369:
+	.string	"U_ID_2 2"
+.LASF719:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF2217:
+	.string	"GPS_RUNNING"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1507:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF2261:
+	.string	"reserved5"
+.LASF1002:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF844:
+	.string	"__DECL_SIMD_pow "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1974:
+	.string	"minutes"
+.LASF2136:
+	.string	"provider"
+.LASF930:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1877:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1505:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF2105:
+	.string	"GPS_PROVIDER_COUNT"
+.LASF1850:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2313:
+	.string	"decodeLong"
+.LASF2305:
+	.string	"parsed"
+.LASF752:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2073:
+	.string	"txBufferTail"
+.LASF2042:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF2165:
+	.string	"errors"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1301:
+	.string	"_WCHAR_T "
+.LASF1529:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF2259:
+	.string	"reserved4"
+.LASF2262:
+	.string	"reserved6"
+.LASF1381:
+	.string	"NOINLINE "
+.LASF1713:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1759:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1386:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1778:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1918:
+	.string	"HDOP_SCALE (100)"
+.LASF2227:
+	.string	"autoConfigStep"
+.LASF1905:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF931:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF839:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1300:
+	.string	"__WCHAR_T__ "
+.LASF1611:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1455:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1882:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1313:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2106:
+	.string	"gpsProvider_e"
+.LASF1005:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1213:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF810:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF2298:
+	.string	"gpsHandleNAZA"
+.LASF1254:
+	.string	"USE_CMS "
+.LASF983:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF2143:
+	.string	"gpsConfig_t"
+.LASF1705:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1429:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1854:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2123:
+	.string	"gpsAutoConfig_e"
+.LASF1253:
+	.string	"USE_STATS "
+.LASF1722:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1167:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF2002:
+	.string	"OWNER_LED"
+.LASF798:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2295:
+	.string	"gpsConstrainEPE"
+.LASF2138:
+	.string	"autoConfig"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1936:
+	.string	"ptSpawn(name) do { ptRestart(ptGetHandle(name)); ptWaitThread(name); } while (0)"
+.LASF823:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1280:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1963:
+	.string	"uint16_t"
+.LASF2027:
+	.string	"RESOURCE_SPI_SCK"
+.LASF1010:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF373:
+	.string	"linux 1"
+.LASF1451:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF2188:
+	.string	"baudRate_e"
+.LASF1652:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1821:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2110:
+	.string	"SBAS_MSAS"
+.LASF1829:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1800:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF817:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF956:
+	.string	"__DECL_SIMD_atan2l "
+.LASF747:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF1414:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1166:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF792:
+	.string	"_MATH_H 1"
+.LASF707:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1375:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1589:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1289:
+	.string	"_T_PTRDIFF_ "
+.LASF1192:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1827:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1813:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1594:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF806:
+	.string	"__DECL_SIMD_sinl "
+.LASF2158:
+	.string	"velNED"
+.LASF1764:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1336:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1668:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1059:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1647:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1929:
+	.string	"ptRestart(handle) do { (handle)->returnCode = 0; (handle)->line = 0; } while(0)"
+.LASF1919:
+	.string	"GPS_HDOP_TO_EPH_MULTIPLIER 2"
+.LASF1470:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF2263:
+	.string	"mask"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1655:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1471:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF1337:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1054:
+	.string	"__DECL_SIMD_tan "
+.LASF1495:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1299:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF827:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1541:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1649:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2296:
+	.string	"serialRxBytesWaiting"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF745:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF1088:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2153:
+	.string	"gpsSolutionData_s"
+.LASF1780:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF883:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1853:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2016:
+	.string	"RESOURCE_NONE"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1627:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF1746:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1809:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF826:
+	.string	"__DECL_SIMD_logl "
+.LASF1881:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1972:
+	.string	"month"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF2247:
+	.string	"v_acc"
+.LASF1242:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1063:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1549:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF2055:
+	.string	"data"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF780:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1491:
+	.string	"BIT(x) (1 << (x))"
+.LASF1996:
+	.string	"OWNER_BEEPER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1896:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1228:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF2070:
+	.string	"rxBufferHead"
+.LASF834:
+	.string	"__DECL_SIMD_exp "
+.LASF2169:
+	.string	"gpsSol"
+.LASF2244:
+	.string	"latitude"
+.LASF1044:
+	.string	"__DECL_SIMD_erfc "
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF909:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF926:
+	.string	"__DECL_SIMD_expm1l "
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1118:
+	.string	"_Mdouble_"
+.LASF1961:
+	.string	"int32_t"
+.LASF1422:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1066:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2205:
+	.string	"functionMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2025:
+	.string	"RESOURCE_I2C_SCL"
+.LASF1940:
+	.string	"ptStop(retCode) do { currentPt->returnCode = retCode; currentPt->line = (-1); return; } while (0)"
+.LASF1832:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1320:
+	.string	"USE_IMU_FAKE "
+.LASF1164:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2089:
+	.string	"beginWrite"
+.LASF1018:
+	.string	"__DECL_SIMD_erff32 "
+.LASF731:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1310:
+	.string	"___int_wchar_t_h "
+.LASF2007:
+	.string	"OWNER_SPI_PREINIT"
+.LASF836:
+	.string	"__DECL_SIMD_expl "
+.LASF2232:
+	.string	"gpsReceiverData_t"
+.LASF2253:
+	.string	"vdop"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF2149:
+	.string	"validVelD"
+.LASF2017:
+	.string	"RESOURCE_INPUT"
+.LASF1624:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1341:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1360:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF2026:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2075:
+	.string	"rxCallbackData"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2122:
+	.string	"GPS_AUTOCONFIG_ON"
+.LASF2037:
+	.string	"MODE_RX"
+.LASF933:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1885:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1489:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1640:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1119:
+	.string	"__MATH_PRECNAME"
+.LASF969:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF2307:
+	.string	"NAZA_parse_gps"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1702:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1380:
+	.string	"FAST_CODE "
+.LASF1229:
+	.string	"USE_OPFLOW "
+.LASF1129:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1151:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF901:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1354:
+	.string	"USE_1WIRE_DS2482"
+.LASF1704:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1122:
+	.string	"_Mdouble_ float"
+.LASF2186:
+	.string	"BAUD_2000000"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF1819:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1699:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF2054:
+	.string	"serialBufChunk_s"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1106:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1238:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF2274:
+	.string	"FIX_3D"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1620:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF746:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF773:
+	.string	"_T_SIZE_ "
+.LASF1323:
+	.string	"USE_FAKE_GPS "
+.LASF1112:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF2231:
+	.string	"timeoutMs"
+.LASF2109:
+	.string	"SBAS_WAAS"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1006:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1155:
+	.string	"__MATHCALL_NARROW"
+.LASF1957:
+	.string	"long int"
+.LASF974:
+	.string	"__DECL_SIMD_log2 "
+.LASF2128:
+	.string	"GPS_DYNMODEL_AIR_1G"
+.LASF1597:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1239:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1146:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2125:
+	.string	"GPS_AUTOBAUD_ON"
+.LASF1783:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1104:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1140:
+	.string	"__MATHDECL_1"
+.LASF1848:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2126:
+	.string	"gpsAutoBaud_e"
+.LASF1756:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1856:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1995:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF706:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF1893:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF1132:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF2015:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1416:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1796:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF784:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1846:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2038:
+	.string	"MODE_TX"
+.LASF1076:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1371:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1548:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1510:
+	.string	"IOCFG_AF_PP 0"
+.LASF2306:
+	.string	"gpsNewFrameNAZA"
+.LASF958:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1486:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2168:
+	.string	"gpsStatistics_t"
+.LASF987:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1968:
+	.string	"timeDelta_t"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1903:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF894:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1264:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF912:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1727:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF2235:
+	.string	"ptState_s"
+.LASF1765:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1236:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1711:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1149:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1203:
+	.string	"USE_ADC_AVERAGING "
+.LASF2229:
+	.string	"lastLastMessageMs"
+.LASF1114:
+	.string	"_Mdouble_ double"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1370:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1572:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF2286:
+	.string	"_new_speed"
+.LASF1023:
+	.string	"__DECL_SIMD_erff128x "
+.LASF2116:
+	.string	"GPS_BAUDRATE_38400"
+.LASF2299:
+	.string	"gpsRestartNAZA"
+.LASF1068:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1436:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF2172:
+	.string	"BAUD_1200"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1973:
+	.string	"hours"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1806:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1676:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1870:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF781:
+	.string	"_SIZE_T_DECLARED "
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2228:
+	.string	"lastStateSwitchMs"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1405:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2100:
+	.string	"GPS_UBLOX"
+.LASF2083:
+	.string	"serialSetBaudRate"
+.LASF1983:
+	.string	"OWNER_SERVO"
+.LASF1494:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF718:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1466:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1427:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF951:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF709:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1847:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF919:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1365:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2135:
+	.string	"gpsConfig_s"
+.LASF2221:
+	.string	"serialConfig"
+.LASF1475:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF995:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF2202:
+	.string	"SERIAL_PORT_IDENTIFIER_MAX"
+.LASF2014:
+	.string	"OWNER_IRLOCK"
+.LASF1632:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1880:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2132:
+	.string	"GPS_FIX_2D"
+.LASF2273:
+	.string	"FIX_2D"
+.LASF2101:
+	.string	"GPS_I2CNAV"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1581:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF853:
+	.string	"__DECL_SIMD_powf128x "
+.LASF702:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1662:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1550:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1777:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1588:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1295:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1408:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1555:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1622:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1952:
+	.string	"__int16_t"
+.LASF948:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1781:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF2174:
+	.string	"BAUD_4800"
+.LASF1954:
+	.string	"__uint16_t"
+.LASF1091:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2066:
+	.string	"rxBufferSize"
+.LASF1982:
+	.string	"OWNER_MOTOR"
+.LASF920:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF2220:
+	.string	"gpsConfig"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1639:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF887:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2147:
+	.string	"gpsHeartbeat"
+.LASF1523:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1859:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1311:
+	.string	"__INT_WCHAR_T_H "
+.LASF965:
+	.string	"__DECL_SIMD_log10f "
+.LASF828:
+	.string	"__DECL_SIMD_logf32 "
+.LASF863:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1672:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF890:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1177:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1799:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF859:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF786:
+	.string	"__size_t "
+.LASF2072:
+	.string	"txBufferHead"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2180:
+	.string	"BAUD_230400"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF2278:
+	.string	"_ck_a"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF921:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1558:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1849:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2124:
+	.string	"GPS_AUTOBAUD_OFF"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1583:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1029:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF822:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF850:
+	.string	"__DECL_SIMD_powf128 "
+.LASF891:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF2119:
+	.string	"GPS_BAUDRATE_COUNT"
+.LASF2139:
+	.string	"autoBaud"
+.LASF2184:
+	.string	"BAUD_1000000"
+.LASF763:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1979:
+	.string	"OWNER_PWMIO"
+.LASF1087:
+	.string	"__f32x(x) x ##f32x"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1241:
+	.string	"USE_OLED_UG2864 "
+.LASF1714:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1184:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1675:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1258:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1281:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1480:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF737:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF1153:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1680:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF749:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1867:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1532:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1946:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF734:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF851:
+	.string	"__DECL_SIMD_powf32x "
+.LASF982:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF900:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1741:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1506:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1296:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1454:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF1941:
+	.string	"ptEnd(retCode) ptStop(retCode); FALLTHROUGH; default: return; }"
+.LASF1738:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1211:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1208:
+	.string	"USE_NAV "
+.LASF1984:
+	.string	"OWNER_SOFTSERIAL"
+.LASF1755:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF358:
+	.string	"__k8 1"
+.LASF1701:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1966:
+	.string	"float"
+.LASF2062:
+	.string	"identifier"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF1554:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1379:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1557:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1644:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2086:
+	.string	"writeBuf"
+.LASF754:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1945:
+	.string	"NAZA_MAX_PAYLOAD_SIZE 256"
+.LASF2256:
+	.string	"satellites"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2166:
+	.string	"timeouts"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1509:
+	.string	"IOCFG_OUT_OD 0"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF877:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1288:
+	.string	"_PTRDIFF_T "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1596:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1389:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2090:
+	.string	"endWrite"
+.LASF1664:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1181:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF973:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF791:
+	.string	"_STRINGS_H 1"
+.LASF1438:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF942:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1601:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2185:
+	.string	"BAUD_1500000"
+.LASF1206:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1862:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2006:
+	.string	"OWNER_VTX"
+.LASF512:
+	.string	"__wur "
+.LASF1831:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1907:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1201:
+	.string	"USE_SERIALRX_FPORT "
+.LASF867:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1170:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1556:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2163:
+	.string	"gpsSolutionData_t"
+.LASF2010:
+	.string	"OWNER_1WIRE"
+.LASF2246:
+	.string	"h_acc"
+.LASF1366:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1126:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1930:
+	.string	"ptIsStopped(handle) ((handle)->line < 0)"
+.LASF1163:
+	.string	"FP_NORMAL 4"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1235:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1473:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF2283:
+	.string	"_payload_length"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1165:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1269:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2176:
+	.string	"BAUD_19200"
+.LASF1989:
+	.string	"OWNER_RANGEFINDER"
+.LASF889:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2067:
+	.string	"txBufferSize"
+.LASF2111:
+	.string	"SBAS_GAGAN"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1546:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1141:
+	.string	"__MATHDECL_ALIAS"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2279:
+	.string	"_ck_b"
+.LASF2099:
+	.string	"GPS_NMEA"
+.LASF1641:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF996:
+	.string	"__DECL_SIMD_atanhl "
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1719:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1633:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF988:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1737:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1720:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF1197:
+	.string	"USE_SERIAL_RX "
+.LASF1551:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1047:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1563:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF2091:
+	.string	"writeBufChunks"
+.LASF1136:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1364:
+	.string	"USE_ITCM_RAM"
+.LASF1603:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1670:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1895:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1689:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1932:
+	.string	"ptLabel() do { currentPt->line = __LINE__; FALLTHROUGH; case __LINE__:; } while (0)"
+.LASF2063:
+	.string	"mode"
+.LASF1077:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1116:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF2260:
+	.string	"fix_status"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF947:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2082:
+	.string	"serialRead"
+.LASF1872:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF2137:
+	.string	"sbasMode"
+.LASF1801:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF803:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF2030:
+	.string	"RESOURCE_SPI_CS"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF966:
+	.string	"__DECL_SIMD_log10l "
+.LASF2074:
+	.string	"rxCallback"
+.LASF396:
+	.string	"false 0"
+.LASF1357:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1884:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1812:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2151:
+	.string	"validEPE"
+.LASF1352:
+	.string	"USE_PITOT_ADC"
+.LASF2207:
+	.string	"gps_baudrateIndex"
+.LASF843:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1538:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF753:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF1245:
+	.string	"USE_DJI_HD_OSD "
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1606:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2068:
+	.string	"rxBuffer"
+.LASF2057:
+	.string	"serialBufChunk_t"
+.LASF1079:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1798:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF794:
+	.string	"__DECL_SIMD_cos "
+.LASF2046:
+	.string	"SERIAL_PARITY_NO"
+.LASF1969:
+	.string	"timeMs_t"
+.LASF2236:
+	.string	"line"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1450:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1637:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF953:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1398:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF972:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1833:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF875:
+	.string	"__DECL_SIMD_asinf "
+.LASF1865:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1231:
+	.string	"USE_OPFLOW_MSP "
+.LASF760:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF771:
+	.string	"_SIZE_T "
+.LASF2029:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1999:
+	.string	"OWNER_MPU"
+.LASF1394:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1502:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF2282:
+	.string	"_msg_id"
+.LASF2210:
+	.string	"serialPortConfig_t"
+.LASF1857:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1117:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1130:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF842:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1522:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1692:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF999:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF833:
+	.string	"__DECL_SIMD_logf128x "
+.LASF795:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1697:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2009:
+	.string	"OWNER_TEMPERATURE"
+.LASF2304:
+	.string	"newChar"
+.LASF1876:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1074:
+	.string	"__HAVE_FLOAT64 1"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF783:
+	.string	"___int_size_t_h "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1183:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1561:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF778:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2052:
+	.string	"SERIAL_BIDIR_NOPULL"
+.LASF2000:
+	.string	"OWNER_INVERTER"
+.LASF1180:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2041:
+	.string	"portOptions_t"
+.LASF733:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1855:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1962:
+	.string	"uint8_t"
+.LASF1105:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1600:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2292:
+	.string	"atan2_approx"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1221:
+	.string	"USE_RX_UIB "
+.LASF1658:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1844:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF1139:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1498:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1120:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1488:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1900:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF758:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF860:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF2104:
+	.string	"GPS_MTK"
+.LASF2112:
+	.string	"SBAS_NONE"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1052:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1034:
+	.string	"__DECL_SIMD_asinh "
+.LASF1726:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1878:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1358:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1312:
+	.string	"_GCC_WCHAR_T "
+.LASF1307:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2019:
+	.string	"RESOURCE_IO"
+.LASF1684:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1062:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1384:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1378:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1794:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF861:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1261:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1707:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF376:
+	.string	"unix 1"
+.LASF1160:
+	.string	"FP_INFINITE 1"
+.LASF1150:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF914:
+	.string	"__DECL_SIMD_cosh "
+.LASF1152:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF804:
+	.string	"__DECL_SIMD_sin "
+.LASF2150:
+	.string	"validMag"
+.LASF1226:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1599:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1732:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF2192:
+	.string	"SERIAL_PORT_USART2"
+.LASF1935:
+	.string	"ptWaitThread(name) do { ptLabel(); name(); if (!ptIsStopped(ptGetHandle(name))) { return; } } while (0)"
+.LASF1000:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1618:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1070:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1343:
+	.string	"USE_SERVO_SBUS"
+.LASF776:
+	.string	"_SIZE_T_ "
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1359:
+	.string	"USE_VCP"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1521:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF787:
+	.string	"__need_size_t"
+.LASF1981:
+	.string	"OWNER_PPMINPUT"
+.LASF1512:
+	.string	"IOCFG_IPD 0"
+.LASF1298:
+	.string	"__need_ptrdiff_t"
+.LASF847:
+	.string	"__DECL_SIMD_powf16 "
+.LASF878:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1894:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF1095:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1944:
+	.string	"ptSemaphoreSignal(sem) do { sem = true; } while (0)"
+.LASF1227:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF916:
+	.string	"__DECL_SIMD_coshl "
+.LASF1388:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1868:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1121:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1134:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1623:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1285:
+	.string	"_STDDEF_H "
+.LASF1811:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1001:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1322:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1501:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1552:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1879:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1148:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1808:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF897:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF2271:
+	.string	"LEN_MAG"
+.LASF1826:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1133:
+	.string	"_Mdouble_ _Float128"
+.LASF708:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF832:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1914:
+	.string	"LON 1"
+.LASF1887:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1748:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1123:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1373:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1663:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1413:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1567:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF868:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1216:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF950:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1458:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1590:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2312:
+	.string	"gpsProcessNewSolutionData"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1754:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF1803:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF743:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF1071:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1636:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF927:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF700:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1500:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1215:
+	.string	"USE_PITOT_ADC "
+.LASF1614:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1536:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1977:
+	.string	"dateTime_t"
+.LASF1804:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1890:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1750:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1902:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1785:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2310:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1928:
+	.string	"ptGetHandle(name) (&name ##_protothreadState)"
+.LASF1069:
+	.string	"__f128(x) x ##f128"
+.LASF1007:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1125:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1592:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1822:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1830:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1586:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1570:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF2241:
+	.string	"naza_ver"
+.LASF1661:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2175:
+	.string	"BAUD_9600"
+.LASF1048:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1845:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2287:
+	.string	"semNewDataReady"
+.LASF1696:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF959:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF2113:
+	.string	"sbasMode_e"
+.LASF1431:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF876:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1525:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF739:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF1539:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1055:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1772:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1971:
+	.string	"year"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1400:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF1020:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1474:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1686:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1460:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF1710:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1770:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1674:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1677:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1376:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1361:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF796:
+	.string	"__DECL_SIMD_cosl "
+.LASF2022:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1573:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1274:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF788:
+	.string	"NULL"
+.LASF2140:
+	.string	"dynModel"
+.LASF757:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF1124:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF2308:
+	.string	"mask_mag"
+.LASF2021:
+	.string	"RESOURCE_UART_TX"
+.LASF756:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF1990:
+	.string	"OWNER_SYSTEM"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1411:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF466:
+	.string	"__PMT"
+.LASF1535:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1483:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF697:
+	.string	"_CTYPE_H 1"
+.LASF1230:
+	.string	"USE_OPFLOW_CXOF "
+.LASF2251:
+	.string	"ned_down"
+.LASF1992:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1217:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF2209:
+	.string	"telemetry_baudrateIndex"
+.LASF2218:
+	.string	"GPS_LOST_COMMUNICATION"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF2208:
+	.string	"peripheral_baudrateIndex"
+.LASF1476:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1022:
+	.string	"__DECL_SIMD_erff64x "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1751:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1869:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF748:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF2181:
+	.string	"BAUD_250000"
+.LASF1176:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF1978:
+	.string	"OWNER_FREE"
+.LASF975:
+	.string	"__DECL_SIMD_log2f "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2108:
+	.string	"SBAS_EGNOS"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1024:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1910:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1673:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF2031:
+	.string	"RESOURCE_ADC_CH1"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1687:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1162:
+	.string	"FP_SUBNORMAL 3"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1067:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1816:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1864:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2141:
+	.string	"ubloxUseGalileo"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1419:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1278:
+	.string	"USE_VTX_TRAMP "
+.LASF1752:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF736:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1303:
+	.string	"_T_WCHAR "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1828:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF2102:
+	.string	"GPS_NAZA"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1482:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2239:
+	.string	"delayTime"
+.LASF1671:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2290:
+	.string	"gpsSetProtocolTimeout"
+.LASF1392:
+	.string	"UNIT_TESTED "
+.LASF1353:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2160:
+	.string	"groundCourse"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1753:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF964:
+	.string	"__DECL_SIMD_log10 "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF873:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF2096:
+	.string	"ADC_CURRENT"
+.LASF2255:
+	.string	"edop"
+.LASF1305:
+	.string	"_WCHAR_T_ "
+.LASF2130:
+	.string	"gpsDynModel_e"
+.LASF2226:
+	.string	"autoBaudrateIndex"
+.LASF2242:
+	.string	"naza_mag"
+.LASF1424:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF872:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF476:
+	.string	"__P(args) args"
+.LASF1933:
+	.string	"ptWait(condition) do { ptLabel(); if (!(condition)) { return; } } while (0)"
+.LASF1083:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1430:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1410:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF716:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF772:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1965:
+	.string	"uint64_t"
+.LASF1897:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1553:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1097:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF755:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1043:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1531:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1921:
+	.string	"GPS_SHORT_TIMEOUT (500)"
+.LASF1842:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2270:
+	.string	"LEN_NAV"
+.LASF712:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF990:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1462:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1840:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1198:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2201:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF1517:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1615:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1912:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1773:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF2285:
+	.string	"_new_position"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF715:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF986:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1943:
+	.string	"ptSemaphoreWait(sem) do { ptWait(sem); sem = false; } while (0)"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF824:
+	.string	"__DECL_SIMD_log "
+.LASF913:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2131:
+	.string	"GPS_NO_FIX"
+.LASF818:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2258:
+	.string	"fix_type"
+.LASF991:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF720:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1154:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1232:
+	.string	"USE_PITOT_MS4525 "
+.LASF1135:
+	.string	"_Mdouble_ _Float32x"
+.LASF2240:
+	.string	"ptSemaphore_t"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF2095:
+	.string	"ADC_RSSI"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF1576:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2129:
+	.string	"GPS_DYNMODEL_AIR_4G"
+.LASF1098:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF880:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1544:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF848:
+	.string	"__DECL_SIMD_powf32 "
+.LASF2115:
+	.string	"GPS_BAUDRATE_57600"
+.LASF979:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2237:
+	.string	"returnCode"
+.LASF864:
+	.string	"__DECL_SIMD_atan "
+.LASF910:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1653:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF729:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1904:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1605:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1224:
+	.string	"USE_RANGEFINDER "
+.LASF1464:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1651:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF898:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1629:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1477:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF881:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1993:
+	.string	"OWNER_SDCARD"
+.LASF1187:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF984:
+	.string	"__DECL_SIMD_log1p "
+.LASF2120:
+	.string	"gpsBaudRate_e"
+.LASF766:
+	.string	"_STRING_H 1"
+.LASF1056:
+	.string	"__DECL_SIMD_tanl "
+.LASF911:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1873:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1252:
+	.string	"USE_LOG "
+.LASF1171:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1401:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1960:
+	.string	"int16_t"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1571:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1382:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1947:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF2252:
+	.string	"pdop"
+.LASF1681:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1950:
+	.string	"signed char"
+.LASF1084:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF829:
+	.string	"__DECL_SIMD_logf64 "
+.LASF812:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1259:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1802:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF928:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF769:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1157:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1368:
+	.string	"U_ID_1 1"
+.LASF1584:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1444:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1838:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1309:
+	.string	"_WCHAR_T_H "
+.LASF1694:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF2238:
+	.string	"startTime"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1871:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF790:
+	.string	"__need_NULL"
+.LASF2272:
+	.string	"NO_FIX"
+.LASF2043:
+	.string	"SERIAL_INVERTED"
+.LASF1008:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1012:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1440:
+	.string	"sq(x) ((x)*(x))"
+.LASF808:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF2056:
+	.string	"count"
+.LASF1225:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1145:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1598:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1779:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1698:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1492:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1086:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF777:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1797:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1344:
+	.string	"USE_DASHBOARD"
+.LASF1279:
+	.string	"USE_VTX_FFPV "
+.LASF1188:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1530:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1547:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF976:
+	.string	"__DECL_SIMD_log2l "
+.LASF735:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF750:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF1824:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2200:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2212:
+	.string	"portConfigs"
+.LASF1249:
+	.string	"USE_ANTIGRAVITY "
+.LASF1776:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1374:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1372:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1127:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1610:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2224:
+	.string	"state"
+.LASF1503:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1277:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1404:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1986:
+	.string	"OWNER_SERIAL"
+.LASF1037:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1287:
+	.string	"_ANSI_STDDEF_H "
+.LASF1172:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF1997:
+	.string	"OWNER_OSD"
+.LASF820:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2013:
+	.string	"OWNER_PINIO"
+.LASF1757:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1788:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1621:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF830:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1837:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF952:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF2012:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1319:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1191:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2053:
+	.string	"_dateTime_s"
+.LASF1179:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1428:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF2146:
+	.string	"hasNewData"
+.LASF1908:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1096:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF845:
+	.string	"__DECL_SIMD_powf "
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF2264:
+	.string	"naza_nav"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1200:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1613:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1519:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF821:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1730:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF980:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF2302:
+	.string	"gpsProtocolStateThread"
+.LASF2077:
+	.string	"rxIrqCount"
+.LASF721:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF1683:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1406:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF726:
+	.string	"isascii(c) __isascii (c)"
+.LASF1998:
+	.string	"OWNER_BARO"
+.LASF1161:
+	.string	"FP_ZERO 2"
+.LASF2277:
+	.string	"_buffernaza"
+.LASF1399:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF761:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1740:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1511:
+	.string	"IOCFG_AF_OD 0"
+.LASF2049:
+	.string	"SERIAL_BIDIR"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1562:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1333:
+	.string	"USE_UART8 "
+.LASF837:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1418:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1355:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1234:
+	.string	"USE_1WIRE_DS2482 "
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2199:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1743:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1351:
+	.string	"USE_PITOT_MS4525"
+.LASF1243:
+	.string	"USE_TELEMETRY_SIM "
+.LASF981:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF2020:
+	.string	"RESOURCE_TIMER"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF2162:
+	.string	"time"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2191:
+	.string	"SERIAL_PORT_USART1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF2193:
+	.string	"SERIAL_PORT_USART3"
+.LASF2194:
+	.string	"SERIAL_PORT_USART4"
+.LASF2195:
+	.string	"SERIAL_PORT_USART5"
+.LASF2196:
+	.string	"SERIAL_PORT_USART6"
+.LASF2197:
+	.string	"SERIAL_PORT_USART7"
+.LASF2198:
+	.string	"SERIAL_PORT_USART8"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2080:
+	.string	"serialTotalRxWaiting"
+.LASF1526:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF2004:
+	.string	"OWNER_TX"
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF2216:
+	.string	"GPS_INITIALIZING"
+.LASF1433:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1648:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF2225:
+	.string	"baudrateIndex"
+.LASF1292:
+	.string	"_PTRDIFF_T_ "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF977:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1537:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1260:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF1342:
+	.string	"USE_USB_MSC"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF1013:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF940:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1666:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1987:
+	.string	"OWNER_PINDEBUG"
+.LASF1593:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF989:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1860:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1446:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF2297:
+	.string	"gpsSetState"
+.LASF1906:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1911:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1219:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF383:
+	.string	"SITL 1"
+.LASF2177:
+	.string	"BAUD_38400"
+.LASF1490:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1291:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF941:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1693:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1619:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1109:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1925:
+	.string	"PROTOTHREAD(name) static struct ptState_s name ##_protothreadState = {0, 0, 0, 0}; void name(void)"
+.LASF1725:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1901:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1820:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2036:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1478:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF944:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1487:
+	.string	"EXPAND_I(x) x"
+.LASF1669:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1814:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1760:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1958:
+	.string	"__uint64_t"
+.LASF1115:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1964:
+	.string	"uint32_t"
+.LASF2059:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF775:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1700:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF2071:
+	.string	"rxBufferTail"
+.LASF1331:
+	.string	"USE_UART6 "
+.LASF1089:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF2233:
+	.string	"gpsState"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1734:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2114:
+	.string	"GPS_BAUDRATE_115200"
+.LASF1591:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1349:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1317:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2170:
+	.string	"gpsStats"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1733:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF2018:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1514:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF962:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF714:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF993:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1976:
+	.string	"millis"
+.LASF774:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2311:
+	.string	"naza_protocol_bytes"
+.LASF1090:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1144:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1003:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2084:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF1032:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1934:
+	.string	"ptWaitTimeout(condition,timeoutMs) do { currentPt->startTime = (timeUs_t)millis(); currentPt->delayTime = (timeoutMs); ptLabel(); if (!(condition) && ((timeDelta_t)(millis() - (currentPt)->startTime) <= (currentPt)->delayTime)) { return; } } while (0)"
+.LASF1326:
+	.string	"USE_UART1 "
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1092:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2159:
+	.string	"groundSpeed"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF1949:
+	.string	"long unsigned int"
+.LASF762:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1284:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1178:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1393:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1626:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1421:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1302:
+	.string	"_T_WCHAR_ "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1255:
+	.string	"CMS_MENU_OSD "
+.LASF1609:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1426:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF813:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF2087:
+	.string	"isConnected"
+.LASF1718:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1385:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1267:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1988:
+	.string	"OWNER_TIMER"
+.LASF985:
+	.string	"__DECL_SIMD_log1pf "
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1595:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1792:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1210:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1768:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1204:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF723:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1913:
+	.string	"LAT 0"
+.LASF1922:
+	.string	"GPS_BAUD_CHANGE_DELAY (100)"
+.LASF1959:
+	.string	"char"
+.LASF1147:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF970:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1665:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1030:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1078:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1602:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1863:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1469:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF1749:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF800:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1377:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF967:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF884:
+	.string	"__DECL_SIMD_hypot "
+.LASF1457:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF738:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF1100:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2215:
+	.string	"GPS_UNKNOWN"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF932:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1545:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF924:
+	.string	"__DECL_SIMD_expm1 "
+.LASF2301:
+	.string	"ptYielded"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1262:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF799:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF971:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1397:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1577:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2190:
+	.string	"SERIAL_PORT_NONE"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1513:
+	.string	"IOCFG_IPU 0"
+.LASF1463:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF1266:
+	.string	"USE_RX_MSP "
+.LASF1728:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1479:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1314:
+	.string	"__DEFINED_wchar_t "
+.LASF395:
+	.string	"true 1"
+.LASF1763:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF801:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2121:
+	.string	"GPS_AUTOCONFIG_OFF"
+.LASF855:
+	.string	"__DECL_SIMD_acosf "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF779:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2234:
+	.string	"gpsToSerialBaudRate"
+.LASF1703:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF841:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1038:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1250:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1214:
+	.string	"USE_PITOT "
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1459:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1073:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1736:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF768:
+	.string	"__need_NULL "
+.LASF943:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1439:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1580:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF936:
+	.string	"__DECL_SIMD_sinhl "
+.LASF741:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF1050:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF879:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF789:
+	.string	"NULL ((void *)0)"
+.LASF767:
+	.string	"__need_size_t "
+.LASF1035:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1011:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1485:
+	.string	"STR_HELPER(x) #x"
+.LASF1060:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2048:
+	.string	"SERIAL_UNIDIR"
+.LASF2103:
+	.string	"GPS_UBLOX7PLUS"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1630:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1390:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1791:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1927:
+	.string	"ptBegin(name) struct ptState_s * currentPt = ptGetHandle(name); bool ptYielded = true; (void) ptYielded; switch (currentPt->line) { case 0:"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1425:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1051:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF905:
+	.string	"__DECL_SIMD_exp10f "
+.LASF838:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1909:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1608:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1646:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1729:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1169:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2024:
+	.string	"RESOURCE_EXTI"
+.LASF1316:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2064:
+	.string	"options"
+.LASF1094:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1290:
+	.string	"_T_PTRDIFF "
+.LASF869:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1061:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1004:
+	.string	"__DECL_SIMD_acosh "
+.LASF2133:
+	.string	"GPS_FIX_3D"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1256:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1207:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1823:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1805:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF371:
+	.string	"__linux 1"
+.LASF710:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF1156:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1835:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1771:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1189:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1708:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1575:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1159:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1081:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1182:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF961:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1218:
+	.string	"USE_GYRO_KALMAN "
+.LASF917:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF1939:
+	.string	"ptYield() do { ptYielded = false; ptLabel(); if (!ptYielded) { return; } } while (0)"
+.LASF1014:
+	.string	"__DECL_SIMD_erf "
+.LASF1175:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF2204:
+	.string	"serialPortConfig_s"
+.LASF2118:
+	.string	"GPS_BAUDRATE_9600"
+.LASF711:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF1691:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1866:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1107:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF742:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1874:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1937:
+	.string	"ptDelayMs(delay) do { (currentPt)->startTime = (timeUs_t)millis(); (currentPt)->delayTime = (delay); ptLabel(); if ((timeDelta_t)(millis() - (currentPt)->startTime) <= (currentPt)->delayTime) { return; } } while (0)"
+.LASF1888:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2045:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1049:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1499:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1432:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1685:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF703:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF854:
+	.string	"__DECL_SIMD_acos "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF925:
+	.string	"__DECL_SIMD_expm1f "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1706:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF831:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1415:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1497:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1841:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF2187:
+	.string	"BAUD_2470000"
+.LASF2280:
+	.string	"_skip_packet"
+.LASF1212:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1019:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2156:
+	.string	"numSat"
+.LASF1186:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1739:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF1282:
+	.string	"USE_CLI_BATCH "
+.LASF1782:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1967:
+	.string	"double"
+.LASF2293:
+	.string	"sqrtf"
+.LASF1638:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF857:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF764:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF1493:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1246:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1920:
+	.string	"GPS_TIMEOUT (1000)"
+.LASF701:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1113:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF1543:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1461:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1496:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1566:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF704:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1027:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF2269:
+	.string	"ID_VER"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF2291:
+	.string	"fmodf"
+.LASF1031:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1306:
+	.string	"_BSD_WCHAR_T_ "
+.LASF902:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1449:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1194:
+	.string	"I2C2_OVERCLOCK false"
+.LASF2003:
+	.string	"OWNER_RX"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1579:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2219:
+	.string	"gpsState_e"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2107:
+	.string	"SBAS_AUTO"
+.LASF1174:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1834:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1682:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1955:
+	.string	"__int32_t"
+.LASF1101:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1168:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1956:
+	.string	"__uint32_t"
+.LASF865:
+	.string	"__DECL_SIMD_atanf "
+.LASF423:
+	.string	"__USE_GNU"
+.LASF908:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1042:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF2157:
+	.string	"magData"
+.LASF1795:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF939:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2189:
+	.string	"baudRates"
+.LASF1565:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1437:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1356:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1318:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1585:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2183:
+	.string	"BAUD_921600"
+.LASF2300:
+	.string	"currentPt"
+.LASF2088:
+	.string	"isIdle"
+.LASF1257:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1994:
+	.string	"OWNER_FLASH"
+.LASF856:
+	.string	"__DECL_SIMD_acosl "
+.LASF1875:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF1569:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2203:
+	.string	"serialPortIdentifier_e"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1861:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2148:
+	.string	"validVelNE"
+.LASF1774:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1223:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1272:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1110:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1240:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF992:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2206:
+	.string	"msp_baudrateIndex"
+.LASF705:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2069:
+	.string	"txBuffer"
+.LASF1276:
+	.string	"USE_VTX_CONTROL "
+.LASF751:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF785:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1786:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1628:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF882:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1286:
+	.string	"_STDDEF_H_ "
+.LASF1524:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2243:
+	.string	"longitude"
+.LASF874:
+	.string	"__DECL_SIMD_asin "
+.LASF1891:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1560:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1645:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1761:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1143:
+	.string	"__MATHCALL"
+.LASF968:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1931:
+	.string	"ptGetReturnCode(handle) ((handle)->returnCode)"
+.LASF1769:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1036:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2127:
+	.string	"GPS_DYNMODEL_PEDESTRIAN"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF2223:
+	.string	"hwVersion"
+.LASF728:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF1604:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF2276:
+	.string	"bytes"
+.LASF1324:
+	.string	"USE_MAG "
+.LASF2011:
+	.string	"OWNER_AIRSPEED"
+.LASF1678:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1190:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF2211:
+	.string	"serialConfig_s"
+.LASF2214:
+	.string	"serialConfig_t"
+.LASF1021:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF994:
+	.string	"__DECL_SIMD_atanh "
+.LASF807:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1315:
+	.string	"_BSD_WCHAR_T_"
+.LASF1916:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF1103:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF1926:
+	.string	"STATIC_PROTOTHREAD(name) static struct ptState_s name ##_protothreadState = {0, 0, 0, 0}; static void name(void)"
+.LASF2164:
+	.string	"lastMessageDt"
+.LASF906:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1766:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF2254:
+	.string	"ndop"
+.LASF1434:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1742:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1631:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1085:
+	.string	"__f32(x) x ##f32"
+.LASF1293:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1304:
+	.string	"__WCHAR_T "
+.LASF2179:
+	.string	"BAUD_115200"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1721:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF2078:
+	.string	"serialPortVTable"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF923:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1690:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF885:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1634:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF819:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF2044:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2039:
+	.string	"MODE_RXTX"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2040:
+	.string	"portMode_t"
+.LASF1080:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF2289:
+	.string	"gpsProtocolStateThread_protothreadState"
+.LASF1137:
+	.string	"_Mdouble_ _Float64x"
+.LASF1970:
+	.string	"timeUs_t"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1367:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF963:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2268:
+	.string	"ID_MAG"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF849:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2288:
+	.string	"gpsProtocolReceiverThread_protothreadState"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF815:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2117:
+	.string	"GPS_BAUDRATE_19200"
+.LASF1515:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1762:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1065:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2097:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1839:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF871:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1193:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF899:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1435:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF895:
+	.string	"__DECL_SIMD_exp2f "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF811:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF2098:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF2284:
+	.string	"_payload_counter"
+.LASF1093:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1417:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2134:
+	.string	"gpsFixType_e"
+.LASF1064:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2058:
+	.string	"serialReceiveCallbackPtr"
+.LASF1858:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1248:
+	.string	"USE_D_BOOST "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF949:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF727:
+	.string	"toascii(c) __toascii (c)"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF2173:
+	.string	"BAUD_2400"
+.LASF1128:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1542:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1817:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1345:
+	.string	"USE_OLED_UG2864"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1395:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1017:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1423:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1283:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1383:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1338:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF2144:
+	.string	"gpsLocation_s"
+.LASF2145:
+	.string	"gpsLocation_t"
+.LASF2032:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2033:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2034:
+	.string	"RESOURCE_ADC_CH4"
+.LASF922:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF929:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1527:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF1723:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1387:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1724:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2050:
+	.string	"SERIAL_BIDIR_OD"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1033:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF904:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1075:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2167:
+	.string	"packetCount"
+.LASF918:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF892:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1009:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1465:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF809:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1273:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1233:
+	.string	"USE_1WIRE "
+.LASF870:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1025:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1818:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1625:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1057:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1468:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1712:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF713:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF2060:
+	.string	"serialPort_s"
+.LASF2092:
+	.string	"serialPort_t"
+.LASF1980:
+	.string	"OWNER_PWMINPUT"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1082:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1659:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2171:
+	.string	"BAUD_AUTO"
+.LASF2081:
+	.string	"serialTotalTxFree"
+.LASF852:
+	.string	"__DECL_SIMD_powf64x "
+.LASF802:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1484:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1745:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1391:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1339:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF866:
+	.string	"__DECL_SIMD_atanl "
+.LASF2051:
+	.string	"SERIAL_BIDIR_PP"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1917:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1448:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF1045:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1472:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1518:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1294:
+	.string	"___int_ptrdiff_t_h "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1559:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF997:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF732:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF2249:
+	.string	"ned_north"
+.LASF903:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1942:
+	.string	"ptSemaphoreInit(sem) do { sem = false; } while (0)"
+.LASF1852:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF937:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1582:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1205:
+	.string	"USE_BLACKBOX "
+.LASF1453:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF858:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1443:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1533:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF945:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1899:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1209:
+	.string	"USE_TELEMETRY "
+.LASF846:
+	.string	"__DECL_SIMD_powl "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1635:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1767:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1504:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1508:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1028:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1202:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1237:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1815:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1340:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1131:
+	.string	"_Mdouble_ _Float64"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1363:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF722:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF1574:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1784:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1138:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF782:
+	.string	"__DEFINED_size_t "
+.LASF1467:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1540:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1709:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF740:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF2245:
+	.string	"altitude_msl"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1836:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2065:
+	.string	"baudRate"
+.LASF2028:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF1991:
+	.string	"OWNER_SPI"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1447:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1747:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1807:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF759:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1656:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2076:
+	.string	"rxFrameCallback"
+.LASF1244:
+	.string	"USE_FRSKYOSD "
+.LASF2047:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1612:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1348:
+	.string	"USE_RANGEFINDER"
+.LASF1679:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1015:
+	.string	"__DECL_SIMD_erff "
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF724:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1185:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF2275:
+	.string	"FIX_DGPS"
+.LASF1758:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1643:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1334:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF886:
+	.string	"__DECL_SIMD_hypotl "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF797:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1268:
+	.string	"USE_SERIALRX_SUMH "
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2161:
+	.string	"hdop"
+.LASF1889:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1516:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2001:
+	.string	"OWNER_LED_STRIP"
+.LASF1775:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF765:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF1327:
+	.string	"USE_UART2 "
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1915:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2008:
+	.string	"OWNER_COMPASS"
+.LASF1407:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF954:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1715:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1892:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF2267:
+	.string	"ID_NAV"
+.LASF816:
+	.string	"__DECL_SIMD_sincosl "
+.LASF730:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1883:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1099:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1953:
+	.string	"short int"
+.LASF2079:
+	.string	"serialWrite"
+.LASF2152:
+	.string	"validTime"
+.LASF915:
+	.string	"__DECL_SIMD_coshf "
+.LASF1456:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1667:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1688:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF896:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1328:
+	.string	"USE_UART3 "
+.LASF1452:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1111:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF2265:
+	.string	"HEADER1"
+.LASF2266:
+	.string	"HEADER2"
+.LASF1195:
+	.string	"USE_I2C_PULLUP "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1534:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1717:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1481:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF770:
+	.string	"__SIZE_T__ "
+.LASF1412:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1275:
+	.string	"USE_RCDEVICE "
+.LASF1362:
+	.string	"USE_RCDEVICE"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2182:
+	.string	"BAUD_460800"
+.LASF935:
+	.string	"__DECL_SIMD_sinhf "
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1350:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1403:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1617:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1445:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1199:
+	.string	"USE_SERIALRX_SBUS "
+.LASF2178:
+	.string	"BAUD_57600"
+.LASF1948:
+	.string	"unsigned int"
+.LASF1329:
+	.string	"USE_UART4 "
+.LASF1744:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF888:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1924:
+	.string	"GPS_BOOT_DELAY (3000)"
+.LASF1053:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1695:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1158:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF2230:
+	.string	"lastMessageMs"
+.LASF1787:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF955:
+	.string	"__DECL_SIMD_atan2f "
+.LASF814:
+	.string	"__DECL_SIMD_sincos "
+.LASF1825:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1026:
+	.string	"__DECL_SIMD_tanhl "
+.LASF2303:
+	.string	"gpsProtocolReceiverThread"
+.LASF1263:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1938:
+	.string	"ptDelayUs(delay) do { (currentPt)->startTime = (timeUs_t)micros(); (currentPt)->delayTime = (delay); ptLabel(); if ((timeDelta_t)(micros() - (currentPt)->startTime) <= (currentPt)->delayTime) { return; } } while (0)"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1923:
+	.string	"GPS_INIT_DELAY (500)"
+.LASF1420:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1985:
+	.string	"OWNER_ADC"
+.LASF907:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1142:
+	.string	"__MATHDECL"
+.LASF1222:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF805:
+	.string	"__DECL_SIMD_sinf "
+.LASF1265:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF957:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF840:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1016:
+	.string	"__DECL_SIMD_erfl "
+.LASF1843:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1654:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2222:
+	.string	"gpsPort"
+.LASF1793:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1330:
+	.string	"USE_UART5 "
+.LASF1810:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2294:
+	.string	"powf"
+.LASF2281:
+	.string	"_step"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF2155:
+	.string	"fixType"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2023:
+	.string	"RESOURCE_UART_TXRX"
+.LASF1102:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1046:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1564:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1346:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1396:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1607:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1568:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1072:
+	.string	"__HAVE_FLOAT16 0"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1851:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1297:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1409:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1731:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1173:
+	.string	"M_E 2.7182818284590452354"
+.LASF2154:
+	.string	"flags"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF2035:
+	.string	"RESOURCE_RX_CE"
+.LASF1335:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1040:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1975:
+	.string	"seconds"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF946:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1657:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2387:
+	.string	"io_types.h"
+.LASF2374:
+	.string	"mathcalls-helper-functions.h"
+.LASF2366:
+	.string	"math.h"
+.LASF2352:
+	.string	"long-double.h"
+.LASF2362:
+	.string	"__locale_t.h"
+.LASF2375:
+	.string	"platform.h"
+.LASF2341:
+	.string	"mathcalls.h"
+.LASF2317:
+	.string	"src/main/drivers"
+.LASF2383:
+	.string	"axis.h"
+.LASF2368:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2346:
+	.string	"libc-header-start.h"
+.LASF2327:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2359:
+	.string	"endian.h"
+.LASF2331:
+	.string	"stdint-intn.h"
+.LASF2377:
+	.string	"target.h"
+.LASF2379:
+	.string	"common_post.h"
+.LASF2326:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2329:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2353:
+	.string	"stubs.h"
+.LASF2380:
+	.string	"build_config.h"
+.LASF2321:
+	.string	"src/main/target/SITL"
+.LASF2338:
+	.string	"gps_private.h"
+.LASF2319:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF2340:
+	.string	"gps_naza.c"
+.LASF2325:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2390:
+	.string	"config.h"
+.LASF2388:
+	.string	"io_def.h"
+.LASF2363:
+	.string	"string.h"
+.LASF2348:
+	.string	"features-time64.h"
+.LASF2330:
+	.string	"types.h"
+.LASF2367:
+	.string	"math-vector.h"
+.LASF2370:
+	.string	"floatn-common.h"
+.LASF2369:
+	.string	"floatn.h"
+.LASF2350:
+	.string	"timesize.h"
+.LASF2344:
+	.string	"stdbool.h"
+.LASF2328:
+	.string	"/usr/include"
+.LASF2339:
+	.string	"protothreads.h"
+.LASF2314:
+	.string	"src/main/build"
+.LASF2378:
+	.string	"sanity_check.h"
+.LASF2358:
+	.string	"ctype.h"
+.LASF2347:
+	.string	"features.h"
+.LASF2376:
+	.string	"common.h"
+.LASF2355:
+	.string	"typesizes.h"
+.LASF2315:
+	.string	"src/main/common"
+.LASF2335:
+	.string	"serial.h"
+.LASF2316:
+	.string	"src/main/config"
+.LASF2384:
+	.string	"gps_conversion.h"
+.LASF2356:
+	.string	"time64.h"
+.LASF2332:
+	.string	"stdint-uintn.h"
+.LASF2357:
+	.string	"wchar.h"
+.LASF2385:
+	.string	"utils.h"
+.LASF2323:
+	.string	"src/main"
+.LASF2391:
+	.string	"rx_pwm.h"
+.LASF2371:
+	.string	"flt-eval-method.h"
+.LASF2322:
+	.string	"src/main/target"
+.LASF2333:
+	.string	"time.h"
+.LASF2360:
+	.string	"endianness.h"
+.LASF2381:
+	.string	"debug.h"
+.LASF2373:
+	.string	"fp-fast.h"
+.LASF2392:
+	.string	"stats.h"
+.LASF2337:
+	.string	"gps.h"
+.LASF2318:
+	.string	"src/main/fc"
+.LASF2386:
+	.string	"io.h"
+.LASF2342:
+	.string	"maths.h"
+.LASF2372:
+	.string	"fp-logb.h"
+.LASF2324:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2351:
+	.string	"cdefs.h"
+.LASF2361:
+	.string	"locale_t.h"
+.LASF2345:
+	.string	"stdint.h"
+.LASF2365:
+	.string	"strings.h"
+.LASF2364:
+	.string	"stddef.h"
+.LASF2354:
+	.string	"stubs-64.h"
+.LASF0:
+	.string	"./src/main/io/gps_naza.c"
+.LASF2349:
+	.string	"wordsize.h"
+.LASF2393:
+	.string	"runtime_config.h"
+.LASF2389:
+	.string	"io_def_generated.h"
+.LASF2320:
+	.string	"src/main/scheduler"
+.LASF2336:
+	.string	"adc.h"
+.LASF2382:
+	.string	"parameter_group.h"
+.LASF2334:
+	.string	"resource.h"
+.LASF2343:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375`\271\002\315\t"
+	.string	"$\n\255\003"
+	.string	"\027"
+	.string	"\206\260\235\354\013\344\001\002"
+	.string	"\002"
+	.string	"\002\001"
+	.string	"\002\003\004\002\003\005\006\002\003\007\007\007\b\007\t\t\b\001\240\342\234\212\n\002\004\005\006\202\376\266\205\rL\004"
+	.string	"\n\002\013\t\002\t\007\b\t\n\013\f\016\343\351\202\314\002\f\002\005\r\002\016\r\002\016\017\350\261\325\313\007\021\022\357\251\377\234\006.\017\002\016\002\020\002\021\002\022\002\016\002\023\002\024\002\n\002\025\026\t\002\t\023\026\364\200\230N"
+	.string	"\027\261\371\360\245\007\n\030\322\345\335\217\001\n\b\031\266\237\277\221\003\n\005\032\357\375\377\340\f\004\033\240\342\234\212\n"
+	.ascii	"E\250\341\315\300&\225\2442\214\001\240\002\023\"\233\007\022"
+	.ascii	"`\003*\020\307\004F\240\004\306(\303X8\023*,\357\026\003z\221"
+	.ascii	"\200\327\t\024\311\311\311\366:\373Gd\315\217\317c}\375\236\252"
+	.ascii	"\273\007\032j\246r\316\244\031s\311\207\236\"|\341v\240h\355"
+	.ascii	"N4\214\240\305\367\365\341g\226\335sA\223\262\345%\222\217\372"
+	.ascii	"5\252)\036q\337@\306;n\355\262\3709\b\036\363\237O\026\023\337"
+	.ascii	"\323\301r\215w\006\341\245\2026\2643\343\357\221\237-L\246X\003"
+	.ascii	"\275\002\250\305E\001"
+	.text
+	.section	.gnu.lto_.ipa_sra.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375 m\325\001"
+	.string	"\360a"
+	.string	"\t"
+	.string	""
+	.string	"\003"
+	.string	"\006\001\003"
+	.string	""
+	.string	"\016"
+	.string	"\001\022"
+	.string	"\001\001"
+	.string	""
+	.string	"\026\027\002\003\030\031"
+	.string	"\001\032\f"
+	.string	"R\025\342\262\210\263\020\3230L#`A.\007\030"
+	.ascii	"VfZ\030t\275\001,"
+	.text
+	.section	.gnu.lto_.inline.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375`\220\001\365\013"
+	.string	"V\222D>\020\005+\215\001"
+	.string	""
+	.string	"M\326\301\n<!Z\330\362B\271\351\327\013\207N\335\263F\350\355c\235\254J\375\036"
+	.string	"\312@\212Z\357GP\200\004\240\b"
+	.string	""
+	.string	"DK"
+	.string	"\305~ \302\2406\202\310\226;\005."
+	.string	"5"
+	.string	"7"
+	.string	"\254=O\024\335\211\351dL\376\315\2718\316\037\244\213\2438\356\037\362^\211\255\265\266\276_-\006)\233\321\227}\272\332\021R6\333\326\013\274\256\177J\013\243\263\231\355\242E\017K\323\201\242\262\223&\225v\206#h\255\325\002D\321\215\333\315kj\004\374\341\316G[1\1776|'3\\\026m\0027\035\276p\003\265V\317\007\342\370\004\231h\255\204\345\226\222C\266@\250\026F\262\223y\345\202'HM\213\243\341j\337\2476"
+	.string	"N\316ca\177\256\366\0036c\2420\301\300z{%\357O\273\\p\210\200\257\\\f"
+	.ascii	"\360\204\323\202N\324Vk\375<J\255\315\245\213\245\266\306\245"
+	.ascii	"\213\205FP-HY\356\fje\271\013\035\376\254\337S\374\376D\321\220"
+	.ascii	"- P\"3v|\211\203\036\0038z\3752\230\305\210^0\0072\204\247\227"
+	.ascii	"|\240\355\370\240\360\013\324\312\232[\266\306+v\345fi\004\210"
+	.ascii	"%\222\305\206\222\r\344/f\r{\024\326O3\267\310p\004\rv\342Q\203"
+	.ascii	"\322E\303y\031!oN\250\340k\375\f.\337\264\211\3217\206\225I\017"
+	.ascii	"\202\005l\200a\241\f\346\202lOsC"
+	.text
+	.section	.gnu.lto_.jmpfuncs.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375`\236"
+	.string	"\245\005"
+	.string	"\342\307\031!\240)\303\001?~\004\301\2118\226\377}B\337\330\374\377\266\253\032\224\365\3372\341\242\355n\267\267\224)\377_x\302*k\232Uf(c\310.\204\210\0300Ke\2510\241\332_\300#k\340U\206H\205\356\350(\004!\037d\204\342h\320Q\323Q%\357\356\230\236\231\036~[\352\022N\3327\213\326\024\207\246\0370\031\001  p\002\221t\325\001\316\344\310]\\\2332\302\321\222c\\\200\230\340\345j\001+ [`mB\204\f\214l\030\340v\326x%0\036q\016\353\342\232\264b!k\303\236\003"
+	.ascii	" \236\220\235\330\242\305\005\013 !\230\b\266\272\270C"
+	.text
+	.section	.gnu.lto_.pureconst.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375  \001\001"
+	.string	"\034"
+	.string	""
+	.string	""
+	.string	"\t"
+	.ascii	"\230\004\006\230\004\016\270\004\022\271\004\026\230\004\027"
+	.ascii	"\200\004\030\200\004\031\230\004\032\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375 \357\r\004"
+	.string	"\322\306\024\037\220)\351\377\307'\352\356\016R\356\356N\3473\231\001\377\321\377\250AKU\345\220\240\266\223L\001N$\245\316\240[\220\360*\362\204\354\036O\307\256\261\023\\\214\335\242l\006\250\016\234\2473\3053\261C<\033\r\240\212\345\241<\272\364L\273\303\353\220\214z\t\022"
+	.string	"3W\354\330\031=\201 \320\005\027\343\310\024EP\325u]\0233\004\023 DU\247\233j\004V\255&+y\332H\261b"
+	.ascii	"E"
+	.text
+	.section	.gnu.lto_.lto.ea77469017ae99c6,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_decodeLong.41.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375`P\002\235\023"
+	.string	"\226d\201I\320\360(\035j\217\026<\025'B\033\230 \342\363\346\252\372\362\024\244\230\205\024\t,\324\003P\323\341\206R\022"
+	.string	"7\024,#\2123I\340\325\307A\344j\006Z\030\223\033@t\376\247Lx'6\216\037\bS\361\277\021\262\345N)j"
+	.string	"l"
+	.string	"j"
+	.string	".\276\263\261j\027\327\"i\227g\300$\251\213_q\0267\306\231<\235m\314\325x~9v\367%\362\001\343\305\371"
+	.string	"\343E=\341\371\311\273\247\304\2718U\342\370\276\317\235nX\263\345\\\234 \301\241\237\020\233\206\211rC\n\036x\331c\323\221S\310\347z\340\013\350p\324l>\227(\226\335\265\254\331>\334\343m\317l?\260\345N\267$\253\t\233u\336\277\262\264\352\273\037\365\337=Q\322:J\313Q\372!\037)f\2204\355v\030\356X\031\242\022\212\377\376\336\245\375\326\016\327\215^\264j\361"
+	.string	"\376\274d\364\343\340 u\361~\321\315\252e\303e\337\327\233I\345xH\305\310mx\332\335\222\213n\320BrMy\"\237 \2709\257\306\272\013\304\264 u\261E\344\222\362\0014)\374\334\335\235,\375\357\"\256Oe\351w\200lp\n\243vc\245W\251\342\022O\b\0359\264m\232\277\250\031\321\355\356\212\355r\337K\353\342u$H\351 p+\205\2527\244\240\220\272\344\377=A\t\232\024\372\300O\025\270\021(\265e\367\331\200\350v7\205\025$\202&\207\376\370\221G7\032+\2056/Gj\316\276\203C\001\261W\200\321\250\313\f\3662\255r\262\242r"
+	.string	"%e\202\211\200\013\021b\352\026\023\030\006\030\f\204Y\f\205\227,\366\202\211\301^^-2\263\227\t\001\313b$\310\274,\310d2\257\025oo\253T\204\246:\236\231\2738\005\357\375O=9\264\252J\317\323#\265\273)\252"
+	.ascii	"j\354|\3778\"!j\316(&e\251:\311\222O\355\361\3228\225\201S\006"
+	.ascii	"\251\243i*K- `\002)ue\033\033o\021m\343\021\337-\\\326\001dh"
+	.ascii	"\020\024/\235C\312\005\"\210\264\273\263`?B\023\205\341+\r\354"
+	.ascii	"\354\030\242\332\030\202\230P\254\252x\317\316,\233\271\025S"
+	.ascii	"l8\032\361}mi\236\203\033\230\3150s\267\"\232\343v@\321a\002"
+	.ascii	"g,\203\341v\007\360\374\034;%\002aC\304{\305z\274/\221\316\325"
+	.ascii	"\237"
+	.text
+	.section	.gnu.lto_decodeShort.42.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375`\\\002\025\024"
+	.string	"Fe\204J\300\322Q:BM\003a`\203\023\2045o\034B\224\n\272\f}U\006\013x\367~*\005K/`_\2763\3517\324)2O\251\314\311\272\203\t"
+	.string	""
+	.string	"\200\016\204\224\3109\214\371\350%\373@\305\351S\213\375\306\2244B\266\224I\006l"
+	.string	"n"
+	.string	"m"
+	.ascii	"{\246\357rT\354>\332Eu\363\020\250\001\362\342U|\005Mu\226\227"
+	.ascii	"\3643\346\210z\234ztw)\340$\343\305\375\200\361\"\217\320\375"
+	.ascii	"\344]\347\352\\\234\274:z\337\347N7\264\335v.N\022%\023K#\267"
+	.ascii	"\016\023%\b\025\343\300\257\317\215g\347\222\320\371\300\243"
+	.ascii	"\350x\330nB\337\325Kw\353\332n@\327\361\252:SU\t\252\013\024"
+	.ascii	"\252\255\363~\226\256\206|\367\257\376\273\316\325*\217\253;"
+	.ascii	"\256~D$\352\306\201\251\356\020C mC\224*\361\337\337\373\252"
+	.ascii	"\336%\342\365\027ob\271\210\200z"
+	.string	"\247\273\240\375\247Ar\347\207\3749\031E /\226\314\353\233h,\027\210\227\352}=\033\262\243\310\241\\\221\216\356N\271\250\020L\250Z\350\312\002\332y8\312\335F4\034\220\027Mj\2748\237\335\335\263\305\377\275\344\365\311-\276\007\243\034\034C\331v\260\370\274,\006{\206xv\250\252zs\0308'I\335\355\242\032s\237\214\353\342\371D'\365 \\\257\2207H\"\207\017\326\224\377w\006G\265\025\352\201\237'p,V\254*\273/\007@Rw\263\264tE\265\035\252H\212}B\201\243W\250\312\333Y\316\251\376J2\202>(#\005\261c\200\335p\314\f&3\265e\305\245EA\002\026\013*\0044P\210\261\302\250\3006\300f&\314h.\224\262X9\023\203\311\22405\263R\245\200\312h*\324\224\031d\262\232\222\305\3533R\b\227\324\230Gmf7\256\301{\277\216\336\016\2259\204\337\023\204\354n\026\346"
+	.ascii	"T;\337E\236\230D\316\351j\006\267\230\2536\345\223}\366\032\034"
+	.ascii	"'?\250\342\260?\246&\277\324V\030. P\002Q\n\355\006\033o\021"
+	.ascii	"m\2334\256\220H\331\017+\243\351\320}\351\034\3112\214\345\345"
+	.ascii	"\3568\354\267i\2550\336\245\321\236\335\205(\n\343\022s\305\252"
+	.ascii	"\213\367|f\211\031[1m\303\371\210\357kK\363\034\334\300l\206"
+	.ascii	"\231\323\267\226\217^'*n\315-\316\200\013\303\322\206\203\032"
+	.ascii	"\033\376?a\252\006\002\207\b\354\025\253\361\336D:\227y\002"
+	.text
+	.section	.gnu.lto_NAZA_parse_gps.43.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375`\3109\325\263"
+	.ascii	"\232\023q<Q HY:\303\001#9\372${\331\332\224\276(\237x\304\b\004"
+	.ascii	"I\254\206\263O\264\030A9\263\013\254G"
+	.string	"g.\0036\343s\361\267\017\321\227\247\226\336E\303\256\260\025\244k\216\332>\307a\2060\264fr*\272\344\026\272\202\013\263\350\310\210\b\331R&\031\242\003o\003\275\003S\216\346\337\373\247\277\233\237\316_\347\277\363\027\376\207\177\342\231\352\354<[\235\207\234\263\316G\316Zg\2563\330\031z\026;G\317f\347\263\377\356\307\373\327\376\266\217\330\375\3312\232\331\362\2242\226r\314\332+\214.\223\211-\217\2051\224#\364\rC\227\2350\330r\023\376b&G\350\033\346Z\356b\255\345-V\302K\216\320>9>\262\214\004\314\027\034g-\033\201\372q\305X\307\254\304B\275!\313D\254\226\205\244\300U\3077D5v.?\231j9\bOq\363\370vX\230\270\274\036\356\021\361<\317\361\355P\255poxgOh\347\203G(a!\340\337\353\354\005W\271P\247\263\017\\%\034.L\2472\346\203\205\3179B\t\325"
+	.string	"\207\350"
+	.string	"W\006\r\037U\306\344\224i\022\242\222\256XC[\216\214|9e\232~\205\264\013\253\n\034\312s\364\277\373\355\343\034\306\361A\304\317\307\036N\235\243\335\303\361q.Le\302\204\004\256\353\352f\3377\335\267Ys6\fx\005\356\325\345\276\267\347[\345B\035\315>\315B\375x\336~\205\237a\300\213\205\257\265u]\225z\322\265H\034\275\225A\343\307\333\236.]\213\374\312\356\315\224Y\200L\214\n\276\243#\337L\031'\226\256W'D\305\024\275\270LG\216\366\322=\335\303\\\314\307\234\214\n$xMrpZ\002\037"
+	.string	"v'\027f\027\310\200(vs\026p\005\352uMBT@+U\030\035\016\266\034\355.\324\347\2346\230R(\315"
+	.ascii	"\371\342\220\326\321\345\016\267\007\263\005f\357\345q?\376e"
+	.ascii	"\363\220RW\3108\270\257\300\013\220/\n\251{\270\037\312\027\207"
+	.ascii	"\210\034\355\276\313~\313\337~\234\013\020\241)\351zu*\3215k"
+	.ascii	"\205\353\272V\200|\021\350\034\214/\3625\030_\\\356B\355\331"
+	.ascii	"\356\266\312\024\210mOBR@k\263\257\354l\002\344\213*R8\372\332"
+	.ascii	"\023r=;\306\205I\t\\W)\321\213\313\002\371\242\f\032P\313\274"
+	.ascii	"t\254\3101\b\331\023\256p]\245F-V\304\3141B\004\t\241PUu\210"
+	.ascii	"\231[,\1772\254zU\3725\3660O\003i\206\214\243\030F0\212^\020"
+	.ascii	"\271h\301b\305\220\212\024(N\230\020*A\"h\204\210\020 >x\350"
+	.ascii	"\300a\203\206\f\030\200~|z\226\312\344\005\344\321XT\233\231"
+	.ascii	"{\251\323h\200-\r\340\221|\260\232,\360\f\037\254\246*\344&\207"
+	.ascii	"e\254I\217\342\364\251\341\030~7z\237\337a\360\235/\r\027\355"
+	.ascii	"\375\005\337]D\367Nt\274\241R\311\022\270f\b\315\372\273\013"
+	.ascii	"\225\003\031\025\264O\257\316\250.\362\352\354\030\311\n\334"
+	.ascii	"B\357,\220\\\305\027\0324K\357+\354\210\324\361P\230\253 \022"
+	.ascii	"\346)\350\370)\307(\346~\202\237s7\001\206W7\026\372\362\022"
+	.ascii	"\274~9\211\266\033\256q\020\333G\334\220\355\"\264\\\020\013"
+	.ascii	"\207\310r\020\027\314\362\017\036:L\241re\306\034\324\276Au\361"
+	.ascii	"\225\346\310\247WRT\016l\234\260p2e\254!\nY\2243\220\035\003"
+	.ascii	"\031\331\201\306\234|\361\017\223\3738a\362\236O\257\274\272"
+	.ascii	"\270xi\002JV\327\225]?\0264\253\353I\023\027\2167\262\266\216"
+	.ascii	"T\205\246WZ\252\020\231\233\240r\265\204\217\352\362M\332\226"
+	.ascii	"\017\326S\235\241E\367\306\n+\b\033\321\222\274\210v\036\023"
+	.ascii	"\327\204#\207\225\344*\003\276\377\016\275BCe\004Z\3275\211\325"
+	.ascii	"T\371xc]\327\345*\254\254o\322w\325\025v\327\204]\032&\004\310"
+	.ascii	"\276\320\243\221\255\346\035\366X\3668ja4"
+	.string	"g\364\370\356\306>\206\320F<\323\020\372xF\250\016\241\215\207N\304f\036\264\330\273L6.\363\324a\214\351\306y\017\374\3401\031\b$\240\200\002\343\213\rX%\350\300\237\214j\027\373\317%P\255\266\332\367D4\204\352\343}\t\354\254\214\243\374d~\301\215\2313\303@&u]\241\016\260\331\037\370\306\211\213\204\352\2378mS\234\310\344\330a{<Sdv\377\251D\317\321V\233g\314\321\020\374Qq\005\324@s4\237\251Ff\363\331\205^<G3\373\316\257'\250T\327U\t6{G_\252\213y\317$MN\\6\333\215\222\362\334\323\212\261u]\027`\263U\342)\025\f\215\275\331+\242cn\004zV$:\237\241]\265\002\225\363\232\256f\213\203\2474-\307z\242][S\236\224\323\222r\244\233;0\303\026\270\354{c\212\361l7G\271\320\005\374\245iD\334\222\221\227\356\021q\bw\364\333\316"
+	.string	"\330\324f\300]\236J\354j\300\\\226\202\374\326uMzqy\013\277u\260/{q\023\240"
+	.ascii	"\005\030_\334\321?\321\266\245\\\013\254\302\315\254\205\201"
+	.ascii	"R|\270o\322\264\304\250\035f\345{C\212\017\367\347\276\263\253"
+	.ascii	"\265\356\260\266e"
+	.string	"\267\235\323nV\210\241eyM(K\341\232\332\n\246\266\214e\347 \201\036d|\021\211\301\032E\272\246\306Wvw\016\211\262\257\256u\225\372\327\316\341\252\265\205P\020F\334\3454\256\362\264/[\017r\360\253r\030_|_X2\305\211\233\344K\236\231\336\355\033\344I\r\005W\306\263+mr\207\355\276\265\350\336H\267\237\354\342\215\271\023c\367\275\357\303\324\371\360\236nN\016\314\227\273\371>\316\013\\\027.\257\363\375\333\026\251[\333\013\277g[\323\222\005\313\023\277WS\341\212\225*\354\374>\215\n\332\331\024\036\362\275\331\222\367R\312\242\220\361\221\357\243cbP\302\2360\327\367N\240M\300\230|y1\364\373\256#\357\271\224\274\337jJ\361\331\227\251\344\205\372\335\027\bG\277?\222\274NI\336\246\022\230\230\327\007\363\216 \302\361\276=\216\367\r\201\243_\036o\373\356\340\263o\216\257}?\370\332\327\203\345E"
+	.string	"\363v\260\274\034,\357\222\017\357\006>\274\032\034y\017\340\303\233\301\222\027\203%\357\005G^\013~xq\374\360\032\340\207\267\202#o\001~x\225~x\t\360\303K\301\017\357\004G^\t\216\274\021\374\360B\220\344\035@\222\367\201%\357\r\037^\007\226\274\r\364\3602\320\303k\243\207W"
+	.ascii	"=\274\001\350\341\005\200\017\357\002=\2745zx\223zxi\364\360"
+	.ascii	"\"\371\360\316\350\341\225\321\303{\344\303\033#\311k\264\344"
+	.ascii	"\205\241\344-Z\362\276P\362\022-y](y[,yY\370\360\256P\362\016"
+	.ascii	"\035yU\370\360\246P\362\2428\362\236\360\3415\241\344\025:\362"
+	.ascii	"\226P\362\2228\362\006)yG\034yE$yC\034yA\364\360~\350\341\365"
+	.ascii	"\240\344\355p\344\345\240\344\335p\344\325\240\344\315p\344\305"
+	.ascii	"\260\344\005Z\362\376$y}\222\274=I\336e\222W\231\344M&y/$y\221"
+	.ascii	"I\336c\222\327\230\344-&yU%o'y\317T$\n\277\272\302\2424\034\351"
+	.ascii	"Z$1\317\272\2468&R+*BV\2508Z\367_\n\242\337\314\214\210Y\363"
+	.ascii	"\220!\264\346!f}\264\263\026\234rf\265\013\005\355@\253Ub!ST"
+	.ascii	"\f!b\2658X\210\220\252\024\206\232QP\321CV\r\310\202\034\025"
+	.ascii	"\206)\212:\216\037\034\025:\005;y\212\245\316\230J\005\016\222"
+	.ascii	"\342\304\257t\377"
+	.ascii	"\231 \372\323\322\236i\315N\024W\232\235i\375+V\272M\025+L\265"
+	.ascii	"\013\265\244\3310\325*q\220*'\330\311O\252\305\301A8\b7y\nE\263"
+	.ascii	"\324\211F\321\3357\244\371\230h5\366\226h\2449\3215\b\247&zw"
+	.ascii	"_\364\031f\021\017\273L\254\326c\032\371\361[a\255M<\021O\005"
+	.ascii	"\002\325\200\035\256!\232(q-\335\177$\210~55^\023\205\264\364"
+	.ascii	"\023\325\372Z\2624\031,Y\016w\241\210\364\230\303U:\"\226\022"
+	.ascii	"\211\274\036.\216#\"\346\301#\324\257@\211\026\352\356C\322v"
+	.ascii	"L\264\032a\226h\324\225\350\032\203[\372u\205vZ\b\274\263\205"
+	.ascii	"\220\304\210K\273\377D\020\375ll\206\205A\322~![_\352\326`\332"
+	.ascii	"\334\356\354BQu\334\235U:a\333\210B\303;\213\343\204\204\203"
+	.ascii	"vH\364[\bj\022J\272\013\227\267 5S/}\273/\201\325\001\334[s:"
+	.ascii	"^\036(\002\304\341\272\377>\020\375oo\027\254\023\002\256_\347"
+	.ascii	"\255\017\327\245\333\270t9\235\335\023*\320k\247\263J\017\344"
+	.ascii	"B\005D\207\355\353\\\220\316\342x\340\003?\347\200#\372rD\364"
+	.ascii	"\b\255\306\302DKR[BRAD'\355}\330*iz/\352\334\272x\340\263)y\035"
+	.ascii	"\016\301\370:\364\241\374X\341-\027\2715P\016L/\343.\223\253"
+	.ascii	"\2430\2758\370\221\221\030\263\3433ww\302\017\213\331\206?\031"
+	.ascii	"\201\264\t\\\342,\347\334\246@\372w\027\232\n\321@\232\353\236"
+	.ascii	"I\232LZ\354\251\b\312\322\212\260\020]\304d\2726i'P\246\224n"
+	.ascii	"\362\241At\3039\371\354\016\266H\252u\235B\341\241?\364\235g"
+	.ascii	"\232\\\355\241A\3249\003\243aO\304\210m\365\271\266\3064`\340"
+	.ascii	"\321\375\007D\364\037?\310~4G3\360h\216\376h\036M\335\345\324"
+	.ascii	";\272Il7\352\252\267\304V\211\307\2340D\311\304\026\007\217\215"
+	.ascii	"A\t\353\320\374"
+	.string	"\204Cwp\322J\222 \341\300\325$\254\215daA\277\274\244``\375&`M\200|\316\244\373\257\207\350\357\352r\322\325\f\375a\322\f\355\3523\371\352!^_`\273P^\332\nl\225\270\211\227O\207-\324\t\330\342\340&M\230|mh\366\322\320\033\304\032\205~\266S\203\326t,\332TL4\016~Q\272\311\224\322SpU\202\314\245$\211\237\236\226X\177\254\377DD\212m\365(\017\245\373/Id\265a~'\252\032'\315\\K(\315\\w\322\207\022\326\210O\302\264v\241\3248\217\326*\361\326\023\356z\362\311\335\032CAe\207-_\030\241O\346\026\204\271=\355\220>\272\203\266\342\352\322Z\034\274\265\265D\311\367F\206\346$\030:Cw\336\0246d\242%\215\025.!\215\021b\350\244h\233\222)P\032\017:\331i!O\314\235\214?\r\324F8\347W\t\3753g\244\004\020%\370Xa:s"
+	.string	"y\357=\355\303\324=sXL\034\230z\304\236\361\260\003\025\370/\216\237\232\354\260\276/{\204\356\272e\203\340\013\035\366'\243\262}t\3279\277J\374\311\230l\245\b\235l\343\341\023q\212\023?C\213\316\017\t\3557\\\220\0172\"\373\320^~.i&\212"
+	.string	"$B\033\001\357.`a6k\324\354U\t\376\374\311\030\023\330\321\243y\370\350\021\001\225\007\t@6\230@\217\006\034\035P\004\001\004\0359$P$\201i\007\tj\217\217\240C\002\255n\r\031\013\324@\232\221\324"
+	.string	"\030\033B\320\341#\207\bM:| \027\004\030:(\240\003\0029\232H\b\301\210\251\207\021\004z\350\360a\004\202\tMF0@,\023\t<L0\212"
+	.ascii	"\023\223\tFJ\351\324\373\311\336\355+\320\304\305!\251W(\200"
+	.ascii	"C\027g\327\252\341\021\200\200\346n\356\033\r<g\211\252\341\341"
+	.ascii	"\320\322\316\nRW\231 H\035\266\252\3419h\b\360\200"
+	.string	"\341\240=\374Zto\324f\234i\\j\006p)\\\352e\034<W\206\202lZtud,\355\260\264\250w\006\355l\240\n\326\t\324\2403\350\r\016\320\032\264\021\016iA\037\240\217{\316<7:\203.\002\342\231\3225 \013r\334\254Q#\235\316\365\351\246m\346\332\034\031]\256\373\017\006\321\037\027\327\347&\206\\\337M\\_\016L\303\231\266\371\002f\272{B\240\3327m\363\305\310M\337\264M\0336k0\350\253aS\247N6\330D\305%\255\301\240m\030N\361\232\217Y\304\203_\224\233\272\3074\242\246\331\273\220\236\031;\204@\216fL\037o\314\323\300x\361\273\356?\"\242?L\230\363\355q\025\335\365\367\302\364\357\304\364\nv\375A_\314\321\354\2360U\3134\237\306n\356\305\367\316\207f\231\317\247y\232\237\321\273\240of\213\212\347dcLT\\\322\335\005m#\332\366A[\320\r\370D\234\"\374"
+	.string	"G\177\320\004h\034\035\342\360\231\244\202Vj\003\364\237G\n\320\0254\211\275c\004]\200n\001\347\314\203T\352 @\n\032\202&@\037\367\236GH\270\016\343\004M\201\004=A\203\030,z\004-A\337\231'\202\006\001\367D\254k\b.<\021\203\214\003\350\327\r\240\377L\322\fs\017\372\2016\3569\021\233-x\320_\273\321\0364\347EqQ\347\234\206\306\340T\271\250\270\024`n\364P\264\255\316t\315r\016\243f\215\024\037\022\355\030\\\023\007&\252\256\303\330\216A1\206\202j\027\025\216\0315\027U\027Ug|\321\203\236\235\372\266E\232w\247\266\261\255\225\360\303S\257|7\nO\315\202Em\314\316\235q7*O\265\302\354\340\027eF\255\022\245\227\226\302\317\216\233\003hT4f\221\263\006\332\001\006\272\201\356C'\337\024\233\0176\366\030`\363A"
+	.string	"m\243\213{\316\257&\221\303!`\016$&\336\t@\013\240\203\016\235g\232"
+	.string	"\350"
+	.string	"\364\210A'\025\f\370\250\221\330D\265\341W\001\240\257\007\266\f\243e\201>u\214Y\344G\254F/\320\335\347\3443"
+	.string	"'\305\211\222\303\257\252A\243etR\367\240\363\253\211DcF#\365q\260H\2052\213\234L\023\246\221\323\201\315\350\223\211\216Q\342\265\373\252\036\321\211\252\303\257\222\321BAZjc\364Q\253}\316@\265\213Y\244\206\312\3054b\344\267\025\243kD\307LY1jA]\362\244\344\260J0jPE\362\364B=\2624\244\0321\352\027\321\266\2514\030\204*\326U\021\f5\205\177K\027\241\2750T\207\b\351#z\221|\223\361^\232\250y\320\231\245\311\304\005\036\025\005\247\037\365\tX%\370"
+	.ascii	"\267\350\335\250D\246\024\277\312E\013Q\265T\213\346\303'b\030"
+	.ascii	"/)\3759>rU\304\215\232@ YR\334\\\260xY\367\337\n\242?\332\203"
+	.ascii	"\177\024I\264\371\b\247yu\361jQ\326|$\332/\213\322SdQ\262v\241"
+	.ascii	"\312\324\265\311F\230A\310N\367GF\307\342\b\022\266\351\232\265"
+	.ascii	"\314'\033q\312b\344I9,XG\272\301\273:3\236e\321\\$\205>tJ\312"
+	.ascii	"\263\204\204\207E'%NW\364\2356,$d*\275bH\n(\004\204\235\250\263"
+	.ascii	"Av\321T\016\263\214\231\022\021I\222\244\320\030\223\031 \030"
+	.ascii	"\310\3438Qc\347\001\023@\r\311c\311L\017r(U\312\224\310\fM\371"
+	.ascii	"\244\220\345\343\024\341\310\034 \373\032\343\345\202\341\246"
+	.ascii	"\221\203\034Z\304\225\353i\206\\\033\334/\364\264\217\033B&T"
+	.ascii	"\350<\316\272\273:3~Lq\203\252()\034\027\2530m\330\235\256Ez"
+	.ascii	"\370%BS\372\323w\356\313\206\256"
+	.string	"\214\304i7\324\237Ma\"\320\256U>\216\205\325:6/\302C\351&\\\264\327\312\350\2666\271\320\217F\223_\207\326\253\322Y=\361\304V\201r\025k\321\313\027\360k\017j\243\252\340E\371:y3\3178\240%\020\213{.\206\257\r)\310\001\204^'\321\314\030\237QC\025\300\314\302z\257iM\230\221o7\370c\257^w\347\273V!.\344b&l\030\253\027\200v\226\261}\t\257\004\037\375\232`\326\313\201\211|\322*\024\246\034\245S\230>K\225'r\232\244\"v\256.\3149\250%\n\251'u(\320\250\002H\263J\024FiJ\263\354\263\324K\236\325~|\326,Y90\360\fu\002\3001\216t\370\\-\207\1776`\"*\b'\275F\345\373M\303Z\031\300!\\\243\321T\271l%\n\277\033\234z\365\026\004\024\370q}V\021%\343\276\326v\316H\024\313\344\210\376\314\023V"
+	.ascii	"\0358X\346J\352\004\266\376\260\270\032\301Z\241\315\277\340"
+	.ascii	"\334\3249\203\221ENu\344\021\272\007\023c\354\b<\250H\n\346W"
+	.ascii	"\341YP\377\0215\227\022\257t\372\003\251\205\005\002g\003\221"
+	.ascii	"F\264\270\247F\367 H\241\245\007\256\332J\202`\353}\3377\306"
+	.ascii	"\177\201\305@bp3H^~b\033\276&\002\020\362\371\304r\371\323h:"
+	.ascii	"1\353\027!\031\333\356\310\255\006\350\035\363\254\370\306d\004"
+	.ascii	"\326\243\350:\357Z\374\336\336\303P\003\\\006\f\277\304\215\\"
+	.ascii	"\\\246\2677P\233\262TWv\271\277\203\324\033\227\272ku\301:\371"
+	.ascii	"#\002x\026eY0\237\004waj\363\3021Qn\302\311\306}CT/\345.\022"
+	.ascii	"\315Y\314\216\177Dr\302`\315b\003\374\2104V'\251\n\215>\237\276"
+	.ascii	"\023Q\257\252\023\202\261&\f?\354\0032\313\360?\024\232\304\024"
+	.ascii	"@\206\212D\231#\264\255\374W\266\235\361R\016\005;Vb\t3P\271"
+	.ascii	"\340^\025\022\266\022\305\246\253=\033\217-\344\033k\322`\233"
+	.ascii	"\370\310wP\037\334\241\032`P9\253{\007R\023&[a\003\0355o\222"
+	.ascii	"\256\017\264\027\207\370\255\212\254\272\303\210GC\206\224\013"
+	.ascii	"\226\245\033y\016\341\211\227\240-\371\037\035RP\226\037\364"
+	.ascii	"\377p\r\255WI\303CF\354\fC\027L\037\212\"\360\021\375<\305\026"
+	.ascii	"\212\032\024Z\027m\333p\2614\f*rIp\347\243\004J\275\016x\374"
+	.ascii	"h.\377H\332\330\006\232\344\n\321\217Z\273\354c04\325\273C\245"
+	.ascii	"\304\354}D8`e\204\222\"\031*d\3202\316EhL\013\365\353$\315\314"
+	.ascii	"\017N\fVy\t\317\2359\303\035\272!\007\025\323\272_<%a\262\215"
+	.ascii	"\221\3747\200\201\223J,\017c\312\265\2676\317\017\243bM!8*J\372"
+	.ascii	"\022/\020>\007\232t\240\005*\334\346\001\314\376A\322\245\374"
+	.ascii	"x\254\253#\321\341\245\261V?p\276a\215Z\257\222\255\n\320\236"
+	.ascii	"^R\301\231\222N\214\272\030\301\023\266\231\331\327'b\177\235"
+	.ascii	"L\325\006\311\372\213c\261JA\270\351\225>\027D\342\247\024\341"
+	.ascii	"\373>\270k\207\242\245\253\304\257\"\007\212>\234\013\025\226"
+	.ascii	"jHM\362\202\332V\247\233h4%\307\277\363X\212\371 8\020\246o\235"
+	.ascii	"\374\331n\264\201H\324\023\351\177\0045a\257\222\001?\214s\266"
+	.ascii	"1\250\022!\343~g0u\r\333\315,\371\314\206\3704\241\304\361\270"
+	.ascii	"\306\213j6\274i\003\266}Y\342\310\026|\332\240\243\376\250\204"
+	.ascii	"$\342|xT\206\212\350\312_O?k<N\3109.\244\301m\342\021\357\301"
+	.ascii	"\350\245<\213\376\340\322\215\237\rn3`[7\331\270\215\032\370"
+	.ascii	"V\024\374U\241\375\024N}\"J\337\t\241\321\352\363\223\367\333"
+	.ascii	"\216\313\002\313\004?\301\t\025\0310\t\"\204\306R\244I\300\366"
+	.ascii	"Z\261\226\213*\316c\320\260\246\t\255\037\300\232\032\274\002"
+	.ascii	"i\fV\371If\037\215+\257\310\267`\265!Hr6\270\315\004x\243\224"
+	.ascii	"_\2126\371\206v\213\373\360\265\367\0378-94\267o\324\016pv/\017"
+	.ascii	"\006\320\335\363\034\272\342\017\312\212;\316\f\361\220\t\347"
+	.ascii	"\227\205Jp\266\231\372\234\252\362"
+	.string	"\337\207\023\352\021\021`\303\215\370\023\224\244\r\3256L\313\200\206\216\351\204\002=\\8\346\036\031\201\316\032<\241\314<<*\0031\335`\332\365\352\345\302$\342l\003,\212Ai\332\036v,\220#(\300\327\274\313\246\226\241\031\245\215\211aC\221\233\256B\332\3356\224\023D\250M7\016\343`!;O\002+\327\031*E?\312\244\243\227\025\275\002\355\212I\231\013 P/\255\237\334B\372\322\360\202n\353C\263^\3709\365}\245\355\177\005\360\254\210\016+\270\203\002\214z\003\335\340P\376\204\306\270\204ze\2241%Z\371\023\340\220\314`\350#-o\254Y\026\337\214\034\240h\b\234!\246\002\300\235B\374L\222\"\311\b\031Vj\001\b\252\302\341\235\347\237h]\026\0054\233\036\250^\371\227.*\240\244\t?z6J)\n\344\273\377sjA['a\254\252\275\200\020(y9\311\226\313\031\307\237k\367\356c]"
+	.string	"\275\213\201:\320\336q\330\207\253e\313[\237\341A\355\221\003\223\034V\3049\004\221\230\004be\354\006\313|\234\037\366\340\202\212]q\"P\313'\254\005h\371\263\227{ DS.\324\273\"\232z!\326\345]v:\364.\302\005$:\342!}P\265<\025\2120*\235\314\306|\320_\376@`\336D[.\250]\330\245\236N\254\013\242\205\027h]\247\321\332\307\t\314\206\016D\370A\377\316\036c[\314\325\267?\016:\273\374l\231\321\242\355\037v\202\216\023\241\345\304\376i:\265\355\270\341\025\231\2679A5\f\220\226\334\253\023}\346B\320\367\207\355o\316*\370\005\370d\346\231\352\216s-\354j\034GI\342\344]\260\027P\\\351\270~'\f\230\236\265\024F\307/\211\022V\261xD\262\303\254\223v\275\200_\364\307\230_\251N"
+	.ascii	"-\312\r6\357\264\t\200D\274}\265\314\004\340\336\327\334\036"
+	.ascii	"@\350\214\257ti\215\022\237\361\205H\034\026\333\024\230\241"
+	.ascii	"=\372\017\347\037~\244\017\360u\304\277\342\354\340\003\242\013"
+	.ascii	"\001\366u\256Q\217r}\370q\310\333\377P\233\025\037~\024\360 "
+	.ascii	"\335\223'5\275A\305<\005\313\303\"\2764\205\216\324X[\n\363F"
+	.ascii	"\312\260\216;\372\253\0351\214\206\301\310\373\342\242h\301\357"
+	.ascii	"\215\336\t\241\256^\027\016J\017\374\336\343\321\002\275\364"
+	.ascii	"4[\225Cag~\254\257\257\207Y\"-\243\311\001\246$U\247G\366\242"
+	.ascii	"^\314\263\343\024O9hh2\0239(\326k)j\0038\205\020\225nh\006\215"
+	.ascii	"\253*w\"\016t\001"
+	.text
+	.section	.gnu.lto_gpsNewFrameNAZA.44.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375`,\f\2552"
+	.string	"\372Nt\021F`\034R:\307\r5\225\260f\327\245\202\376i\272\036i3\235\252\326x\320Unt\256\330r{\212\3107-\016/\236\023\026\312Kr\270\260\300\323\373\321\243\323\211\242\243\342\372\362\"eU\366\213\377j?!dK\231\002\004\001\346"
+	.string	"\r\001\3755\355\253i?M\3736\355\363\205\004q\224Y^P;\207y\255\242}\256\232\352l\302K\376\177\343<v\237\2018\016\376\245\024\201)\346\265\202\2604\023k\300\3525\030@s`\233\305\242n\357U\2161\273\227\351\340\nx\254\376?\204\t7.\305\314/\253]\221\255H\026w/S\311z\261\024\017\205\301\"\242!\241  \320\317\367\323\343\355V5\265-u\266\\\372L\3610\254\205\251\320*\314\310kG&)\203\2672z|Hb\007}\264m)Z\242\244\211\206\200H\"X\013\005i5\260\300V\017%\003\255\035\225c\\"
+	.ascii	"\312\221H\377|\004\240\034\207\364\217\207;=\f_\232<\365"
+	.string	"*J\234\023\006y\305\273\265c\262\330\353\025\253)\003%\033\037@$1\025\2769R\207\307\270w st\332al\223|e\t\341\255#V\025\216\225w\357\375A\022y\275\313p\357}\033\221=\370F\3743\226\377\036~\237\200[\2408\232\317\201\315\2645\356\302<\306)\235Y\334\333T\323\235y\357Mm\027\027~\206\251\246;\263\355#\205\212\035k\273\316hg5\353\23081+g\316h\324/\317\263\231\264\211\331\271\214\265*;\223\351\267\361\3520:\ts\026\303<\021w,\215\230\225[\304\313\371\313\335x\367N\261\362,`e5x\253\274\332\336\230\354\277\033\263\362\377\335\332x\027\244\027\253\353~\326\302[\242\316K\3764\243\331\310\352y\306\312*\333^\222\252\243\017\3221Yj\345%\333\243\234\023\252\236\273\020\335\227\034\334\355\271\2379\325\266\353g\033\215F\243\267\\?\2131'\361\222\217\364\376\321\373"
+	.string	"\326\276\321\332\037\256}\341\332\017\246\375\242\265O\264\366\207\322\276\220\332\017R\373@\333\007R\373\277\264\357K\373?i\277\227\366yj\177\227\006\326\007\031\320vY\225\222(\007\374U42\352\200\205\237D\037K\f\370\272\367R`\365\315\243\255L\234\227\260\372\023(P\254\254R\200f\375,\220M\317\212uy\200\242\314\264\376\322\316|z\307\317\036"
+	.string	"K\336\361\265\216\037\333\263\276.\376\364:\007\317\366\232\310\263\343\344\237\323\315o\355\353D\363\325\361\316\211\206i\245cJ\341\324l$2\003tV\331\3313\037\236cjrrZw\326\266\025\353\246\254q-T\233\332U\217j\205\320dj\361\260\265\251\345*%\261\243\207\263v"
+	.string	"4\031\345\371\366\244\311?\247\326\017\021\267\025\303!I\266N\2134#\\\222\245\343B"
+	.string	"4\013\313\214-\310\030\3769\177\364\200\316\25329gF8\240\023\311\0136\351\326\242V8Fls;NBGn\r\f\377\232{\324V\333uV\353<F8\252\216\236\271\242W\016\216\311\3474n#\365\002\006\214\225\325\244/<M7k\267\347T\333\3653\216Z\223,o\005*V\320\200j\222\261\276\002\004\013\025$D\240\300\342A\260\251F\223\212\364N\017\232l4\305`\242!\243\205\322\223\013\245\030.\232`(9A\321Pzp\364'\031+\240\224j<=A)\371\230\227S\266\\\007\352h+6\205\255\305\253\027\235b\3232\223\221\354\216\377H\366B\021*K<\217q\t\255+\007\207dy\311\317@\265\344"
+	.string	"Wk\324\232.\035\036%\365\277\201C\263\361\310\222(B\264S\007>wAz\020\021\332."
+	.string	"W"
+	.string	"\330`\031#[eiHeh\215lZ\326\241\245D\031\332!t\371\314\022|V\021>q\322\\\034\264\302\260%\036\223\340\224\242\242VRd\215\240\311(q\032L\310\206\347\371$\r\377\236ZDD\326k)"
+	.string	"\033\022^Z\207,\221M\311\376\241\217,\361\336Fz\013D\210\021#VV\207l"
+	.ascii	"\350\262\013\213)\007\307R\3539\255\225\317 CB\235%d\215\236"
+	.ascii	"?\320Z\310\363\352\214\177O\244\320\231N\316\005\005Y\240\033"
+	.ascii	" A\026\001X\222*\201\026\250qH\351\020C2\"RPR\220$\303\001\301"
+	.ascii	"\005\304\030\247$+\017\021\3200\312\234\231\241\231\024$i\f$"
+	.ascii	"\375]_\303\255\375\246o\213D\375\342T\355\345\322\250m\217\345"
+	.ascii	"\225\257\235\217\240\244\374\002\371R\263C\030\254\027\336>\022"
+	.ascii	"\332/\001\277%s\225\013h\376\013\032\2779L?\005\371\206\204\354"
+	.ascii	"_\345|\\\030\225\365"
+	.string	"\305\367\324dD\031\371\022\3744\206\345\016>-\306\343\233\017%\t\301\254\224\bC\237/\261\331\213~Cv\311C\f\204H\344$InV\351\340J<Jf\376k0\\\220\371\231\260\243\2264@\254E\277O\227\247\020\020\211-\311\0233Xz:\276\005+\3479\323\334X\2146\016\337b|fI\256\271\353c\326\264^\250SRH\013\304\200Ke\310'\333\217\3556\026r\365\037`\212\202\370D\250\357\345\327O'GE)\206\371\017i\206\033\373\260\026\027`\347\352\b\2162\246\357 \353P\210\031\025.\206N9\310\246\034?\032]\305\033o\210A\006\224\214\335\312@\330\243\326\221\252r\036\016!u?\022>\nz]\026P\240+\366\017$\350\220X?\371\234J\206WR\002\217\212T_D\274!\024\271\001\320\324\023\214\251\222\225\004g\013\203\023\367@\243\024\023\247\207>}9[d\310\204\002\263>q\337\364\267"
+	.ascii	"\340\201f;U\375\301D\2504\333\207\315\373\255\"\221\0341\277"
+	.ascii	"\372;\343\200\212{\fz\356\261\364\\c\026\0019\307-F\0360T\306"
+	.ascii	"E\354\222Q\222\207>\351\f\021\362\2735>\304TE\302\335\037\366"
+	.ascii	"\200zDp<:\252X\337WHx[~\221\024K\360\375U1h\003\246\203JT\220"
+	.ascii	"66\301\332K\212\204U\030\0316\264\017\241\344I\321G\t\007\232"
+	.ascii	"\032\315\226\221\335*[\277D\255\253'~\252FX\031\371k\004\272"
+	.ascii	"@t\314G\005"
+	.text
+	.section	.gnu.lto_gpsProtocolReceiverThread_protothreadState.46.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\333"
+	.string	"\001"
+	.string	"?\202\210\200 \177},{,y\273\001w,"
+	.text
+	.section	.gnu.lto_gpsProtocolReceiverThread.47.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375`\261\004\025\037"
+	.string	"vw\306G\200ZN:5\372(\217fn|O\237\371\366u\340X\237>\312G\262\337\230\237\226\255\033?\177\376G\3417\277\305g\226\351\375\266\027\361\205\032\311\232\216\203V\373*\222\300+\263\002\027I\215\371\037\035\324\b!\233\310\235d\263"
+	.string	"\245"
+	.string	"\262"
+	.ascii	":?\304\213\375\211\323\217L=(\035\265\310\321\250\266\341\370"
+	.ascii	"\236\3636\275\200\363\366gIPP\005\247\033\233\314\213u\273-\213"
+	.ascii	"\234Q\356\336#\204[v\220\336\262\023\363[\001\251\013\f\332\001"
+	.ascii	"'\207\231\334\275\227\327F\030\255NO\321\335\231c\315\256N|\340"
+	.ascii	"\323\0355Pc\257SUR\025=\273\372\016\355\225\335D\353\222\026"
+	.ascii	"Tc\3653\200\327\325sL\faN\270\316F\025\304l\262(i/{\235:\303"
+	.ascii	"Q\255\033\025\020\323\347\336\373\261+\370\242\302\252f\316\331"
+	.ascii	"\217wTN\025\324\331s$\211\344C*\254\256h\357\336\3135X\345\343"
+	.ascii	"\254sf6c\346\022\314\246\216\300g\325\340}\240$\214\252q\230"
+	.ascii	"9\306\255p2\275\367\nU"
+	.string	"yGX\212=\325:V\032\252\230\373\272o:o|\215%\034\346\276.\205\211A\333\275O\017\362\241<\n\022\277\353\226\225\230\352\203\267|\246\363\366\307+\t\237\352\033\376\330Gh\301\315\305\335\372\206\371\b\254]d\376\211[Ut\334D\346#\317<g\345\324VF_\3714+[[\331<+\267\255\\\315\312\357\221 \314\022\302\025\247\317\034o\217:\272\273f\321\224\034\3713\377\307\030\304'\343\227\261\316O\030\322\206\017\360x{\230P\013\221\336\376a\037\343<}\344}\006T\263\231\207N\324\007y\332GL\030\263\023,_\366\363Pj\261\361\021\370\036\203\206\214\212\355\"\2438\273w\276\220\313\250\352\206\003\324\332\314DE\365\301nTK\030\325@f\366\335\313\f\265wia\364\342\305y[\273B\341\022C\255D\234I&\303\263\237`BNc\326\204\213\331\305+9\211`+\271\240\215\315S\255c\022\031\206"
+	.string	"\224WlUi\305\3666\303,\257\260\245n\rX\341\234\217R\027b\373r\244\273\310h\374-\374\226V\3449y\336*\350]3H\246\340\256P\013G\340\2674\335\272W2\037\0133\277\365\262\213.\313xo?\"\027\032h\370\216\320%\020KG\276\337oF\321\216-\004]\260@a\202\020\013\240\001+|+`\370\214\206\226\222v\\\004Dt\203\350(\205\214\244\026<$#\336\221\021Q\f^\321O\006\017\310"
+	.string	"#%\371~\274%$\244\037O\347x\337{j\250\377H\002\0067\027w\345\334\003\246`\236\266\00674\355\020\302e\033\332@K\261\217}G\304km.\316\274\367^\264\213lwM,\202\t\347\342\206\206\035N>\231\227\351\300\357b\017\037>\234\267\r\266\330\240\030^%\330\001,C\326\234]\344\277\247\f!\246\3454\261\351<\373C\244\033\201j\233Y\304\210\372\340\331><m\273^\311\021gG\351\025[\250!(\2109\206\2143\"\201\214\314$I:p\002!1,\017\020XgD-\035\221\206D \026p?\023\036\267\315\262\033\227\316\222\204\375\001\223\025\334\204\367\3717\365\321\337\312=;\377\225\240\\(7\ruXG\032\2564\300\t\254\305\027\277\031\265c\2424^\t\202of+]\205\221\257=d\267I(I"
+	.ascii	"\004&5\344\200\265\030\350)F\244\032\257+j\314\177\244M\231\340"
+	.ascii	"~\273q\300\246\212\247g!W\033h$\312\270\227j\310\001*\226\b\345"
+	.ascii	"B:\312u\256K\326\345 fn<\226SU\316\301j\377K\221\206\223\277"
+	.ascii	",\271\321D\364\273A\021\341Om\242\032S\020\357\305\366%\341\230"
+	.ascii	"\3623\222\340-l\341?"
+	.text
+	.section	.gnu.lto_gpsProtocolStateThread_protothreadState.48.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\333"
+	.string	"\001"
+	.string	"?\202\210\200 \177},{,y\273\001w,"
+	.text
+	.section	.gnu.lto_gpsProtocolStateThread.49.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375`r\t51"
+	.string	"\372P\034\022DP\244N\007\323\034'\244\200.\004!\333\220P\215\002 \214xAD\301\026\tq1*/\210x\021\213M\355\217'a\211\204\374\246"
+	.ascii	"*\r\021@\016B\204\237\322<\035\033\362\346\247\303D\310\336{"
+	.ascii	"\357-SJ\001\003\001\003\001\016\001\035\300\375\0060\374\006"
+	.ascii	"r\277\177\334\357\242\373Md\277\207\351\267\353~\267\3557\313"
+	.ascii	"~\257\353\267\252~\247\376\215\323\357\307\337n\3645\277\301"
+	.ascii	"\277\027x9')\334\223\363\32494g\363\267&*\310\343m\356\366\272"
+	.ascii	"3*i\212\310\2179\233iB8}hu\265\365\240\325\325\005V\024(\\x\275"
+	.ascii	"9$\315]\031G\327\3445\007svBp\265\033\264\256\366\333\335WT\225"
+	.ascii	"\217F\263(W]\006s\316F\f\305_\377)\022\207n\313\256j\212\377"
+	.ascii	"m?\372O\332\235\\\223\360,\353\313\213\351P\2223\244o\301Z\222"
+	.ascii	">\3603s\207\030%\013\314\207l\3222\353\313\335\004\313,/o\241"
+	.ascii	"X^)\202\234\263\032V\330\263\\\276B\261\272\254^M\037\210\331"
+	.ascii	"i\021\223U\351P\2331:\376\346\t\240Xa\237\016\223Z\216\301\256"
+	.ascii	"\250\206\311\251\265\250W\345\313\227Xa\352\263I9\347~d2\313"
+	.ascii	"\033\310\273\033Ow\237\350v\017\004\230\345RR\341cw\303\360;"
+	.ascii	" l\334.\206\f%\245\325\325\307\357e\257m\325\263ae\013[\222\361"
+	.ascii	"\025L\351c\364\252(S\314lW\323\317\002di\016D\003\245\276\260"
+	.ascii	";\\x:<\250\013.\307\370\005:5y\307\347\343\255W\305K\016?\333"
+	.ascii	"\351\344\3448b\326\370e\345\\\373\031\273\343Y\221\246_\231v"
+	.ascii	"\271\356k\277\316\373\271\272\232 )\2731C\363\313\312\270\216"
+	.ascii	"\320}mK\226\235\256\333\305tw\037\336;\033\024k\346|t\261Gf\007"
+	.ascii	"<\224V\337\247\273\227\034L?\333\2343\206/\216#\354\265I}a\363"
+	.ascii	"X\316 T\313>d\365\246\007I\023A\250\346]\242\030Ds\226rd;\234"
+	.ascii	"saj\227\342j\337\210zG\272\332\036\265\272\352N\347\241\224z"
+	.ascii	"=\355o\316\302\212\223\0200\277\236n\347\3611\263\333\323\214"
+	.ascii	"\235t\373\267Q\372]\344~\023\265\337\004\330\357!\374-\204\277"
+	.ascii	"\203\210\337\003\210\337\002\206\037d\272\322\260\230\331\336"
+	.ascii	"\275\364D\372\351|W.H\026\310n\365\233\356\227\371T/\024\367"
+	.ascii	"B\366SO\262@)<K \334\375\226\375\3615+\020\375\234\362!\001\177"
+	.ascii	"0\020N\371\\\365q\360\335/\332K\345\035\371\203\375\214r\n\037"
+	.ascii	"\233\303\222\216\260\210\371\220\020\212\356\201\203\004T\275"
+	.ascii	"\301J\304E\\\304\307jn\352\013\333\275\301:\304D\\\364\264\022"
+	.ascii	"\233\032$\201g\210\215{m\004\3560\370\026\273\270\373\265\362"
+	.ascii	"byG6\202\252@ v\\\\l'\377{\265 \265\327q\277w-}\331^\267\365"
+	.ascii	"u[]mq\206\2629\251/|r>\017H\355s\234\316\007\020!\336\221!VW"
+	.ascii	"Y\354qes#|\217Dt\305\376,\322\tB[\315W!\221\325\304\252b\032"
+	.ascii	"\335%\034\216\2116g*\f\355o~\240h\245\370X]U\261"
+	.string	"\201n\025\016\365\321&\305BO\367\007\235\200\257\266\234\\T\314\354!+\306@K89T\237\247\207\376qw\013\027\357H\034P'\240v0==\371Xr;\003\005\244\f\026*`\260q$T\203\251F\016&\034.\240\234\334^:R\022\242\264CF\017\247\033\306&\034\306\0358\224t\030\227\236z\030\217\214\272\311\211\351\311\b\325\324\364d$:\263'I\341)\327\232\262\226G\b\030\306;\t\243]\001\303\345G\307\032\026R\362U\302\264\226F\b\250a\371n\255O>N4p\210\267T\321r`\256\220)bf;\236\033a =89?\366N\336\255v)\375r\275^\357\265\272j\204\235\257\254+,\306\212\347nh|e\013\324\212\223\205\370l\322\317\005Qe\004\262\300\026uV\210\324\252\206\230\371l\324\3370&o\223\257\013\203\036i\023\027u\031<\021.z\260\377*J\361]\317E\264\342\267^\213"
+	.string	"\366\270w\354\263>9T\227\224\220\347\255\331b\246\020\016\302DgpwI^(H\2040\026\334k\033\200\203\360\021\034\001\030"
+	.string	"\036\200\335*-"
+	.string	"\026\2005\334]\3651\362\232\265E\002`lW\326\006"
+	.string	"\003m\021\315$\211JX;f|\370\347\026\200\315\250a \312A\206\206fD\024$\005I\322\001\220\002\031!\243\252\003\021@\271d\310F\251\n\035\221]IgQL\020\004T4J~\331\311\r\260,\320\250\226\273\rf6(\320T-\314\033\355v\rS\371\2201%\227\335\271\222\200\025\240\201\204\243H\b\004/\"\355\205i\314X\204\273\232\241W@\223o3\364\r\365\371\036c\261*`\302I\242x\022.5\001w\210\r\354\020\312\024\236bT$\227\004\213\256\336\234&\327?\2735\257k\222\260\277\231\373}\020\336\345\373\362\b\027\300\017Fr\306\237\0337(|*\332\234\346\256J\234)\036\241\2170\362"
+	.ascii	"J\006 $\177\260\263\335fg\237\365A\327\006\307\306\tx;\020\304"
+	.ascii	"\031\301\305\2749,\252^\037\216\273\335\364\013E\n\313+\0369"
+	.ascii	"\245\224\3478,\215\304\274$D\027H\203\326\b\203hj\365\026\033"
+	.ascii	" \243\030I\016\003u\260%>\024\271]\026\362\361\372\020\f\345"
+	.ascii	"\0136}\026\366\353~\316\004\206s\3056\356\025\276\314r\217?&"
+	.ascii	"(\335g\221\245\347<\323~\034V\201\020\237\322\241\031\205X\025"
+	.ascii	"8\375\203K\277\371\340\217\277\016\277L\031\334\245t\310\372"
+	.ascii	"\270\214\204\352f\211.N\031v\316\371'HR\324\234>r\236&\253\322"
+	.ascii	"BI\370\214\036(\007\346.!W}\002\350\025\221\345{e\177t-DY\001"
+	.ascii	"2\221F;A\222\322C\314?@\276e\031e\3608/\374\2606nd\3264\204\207"
+	.ascii	"p\317\356}]=\236\251\212\370\222\006\\\2546\177"
+	.text
+	.section	.gnu.lto_gpsRestartNAZA.50.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375`\340"
+	.string	"u\n"
+	.string	"f\021B= \345*\035"
+	.string	"\275Pl\242\313\263\214"
+	.string	"\345H\316\304f\037\017\t\322\235\020\351@ \037\030\027\376\367\237\272y\234\f$\001Q\003\307\250\003"
+	.string	"1\0363\376\013E\024\223\300\342\365I\320\336)\005,"
+	.string	"1"
+	.string	"2"
+	.string	"-\036\266\337\361\311\2269\331\332\307b2`\266\335\255\264\343\247\317\223\177\221\007\214*\324'\247aw=G\325\306Mo\273\300\266\201\3751\276\313\027\246\371\361\235o\362\336\021\264hR3\347\204\225\300\353\343V\333\t\300&Q\223r\330\337\354\356\232\262l\316_3\333\314\203lW#\027`g]\207\321\246\314\005&<\212\313\343Z\260yB\363B\016nO\334\304%\003mw\025|\222\227\214|\327;W\220H\336\273\247\220\267\032\302\352%\317\177}\244\024\376x>\213/\0041\022I\324\020TC\240\017\254\037qT=\003\016E\021b\245\bC\261v\310\375f)\313\016/\263\024\305`q\371\232\030x\034\310\212\313\005\0250\034"
+	.ascii	"2\241\035i`\\`\300QP\030\310\002\f\204\314\346`\022\024\006Y"
+	.ascii	"\b1F\036Fz\270\240\252\302\200`T\245\213\203\264\262\272y\253"
+	.ascii	"\fj%.*\326F\225\020\226@\3552\310\313\020\340\322-\332\371\004"
+	.text
+	.section	.gnu.lto_gpsHandleNAZA.51.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"u\013"
+	.string	"\306\324L?\020Q\225\016\177N\222!/\033\341\374jI\272\224>\024\220i\205\346\325\r\026\304\311\302\350\030b\330F\350s\300\001V&\310&t\025\252"
+	.string	""
+	.string	"\024\022Q>\313(\262\221\032=\353\037?\331R\246\024;"
+	.string	"5"
+	.string	":"
+	.string	"\271\371_\035@\347q\307$\246CX\300c\303\013\2127\202\226\223\2534\361D\2510\266F$\212\027\202\002T 1\276zf\360D\231\034\nv\327\331y\032\356\310m3\260m\300\376\202\366\307\245\246\354\303\335]+\312~:\237\276\304R\362\300\244\330%\205\324\330\016L\305\007\333\267/b\263'\336l\030\377T{\024/\f'^\273\033\225\303\267cP\003\277:`\271D\tb\233\363\022f!\331]\004>\211\177\231\337\341\230%h\371\356\230\257E\216]\023\270\030\001\312\020WnP\250\274`\332\025.\344;\023\b)\347l\315h\261I#\326\\2\0262\035\214\346\201\020\263M\354l2\234\250\371h\3612\300\231\347\301'N\310\262O\234|{\270\212j`\352"
+	.string	"i\b\333\250r>}\254\360"
+	.string	"S\003\2000\301\212\220z\031O\033!T\037\252\251\003\001\027"
+	.string	"3\241\267h`\254n\301\036\331X@\273>#\004\256NB!\260\017\030\006Y 1\324\304\335\200\031_\231i"
+	.ascii	"4\313\271M\235\r\223\013\336\343\231\207\320\244Q1\025\005"
+	.text
+	.section	.gnu.lto_gpsHandleNAZA.part.0.82.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"=\007"
+	.string	"\"\315/5@o\222\016@\201\237\n^\231n\371\272\n\321E`AL\204F\230\341\032\343o\376\004\260M\255\300\263~\311LQ<\371LP^\025\262\235L\022\"\333\332&2\005o4V\205\325q\370x \336\305y\035\216\025\3616\330\347i\016\276<\017\330\223\270.\354U\277\353\2248\272\341\203\345\0021\020I?\345\260\023\231\247\260p\025\215\220\201\241\tT\264\226t/\016I\343\324)q\364h\220\260\222\271\021\003\223 T\312\310w\003}u\267\354\253R-\371A\034g\357R\023\221,JI\343\244\224\231\257\024\2064+\272)\273\335* \322B\305\001\255\243\256\240\023"
+	.string	"Cf\036\340\321\251\376\013\277\302O\022\017"
+	.ascii	"?\023\030\027\f\226\"\017\020\005\303\\\341,L\3309\003\350\f"
+	.ascii	"\320f\312N\003\300\265\027SN\313\351\327\2261"
+	.text
+	.section	.gnu.lto_.symbol_nodes.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375`\373\002\235\017"
+	.string	"\364\026\367\003"
+	.string	""
+	.string	""
+	.string	"\002+\177+\300\346\314\231\003\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\271\220\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005$,\300\204\001"
+	.string	""
+	.string	"\003\005\037-9.`'/(0\002,\1771\377\377\377\377#2\"3 4!5%6&788\002/\1779\374\221\250\244\001.:5;\005-<\0021\177=\200\200\200\200\0040>\300"
+	.string	"?\301"
+	.string	"@\002\322"
+	.string	"\177A\224\202\202\200 )\177B\320\231\263\346"
+	.string	"\272\220\202\002*\177C\210\223\323\252\0012\177D3\177E\005\036F\301"
+	.string	"\001>\177G\037"
+	.string	""
+	.string	"\200\220\200\001=\177H<\177I;\177J:\177K6\177L7\177M\305"
+	.string	"\177N\304"
+	.string	"\177O\302"
+	.string	"\177P\303"
+	.string	"\177Q?\177R\3774\177S\377\003"
+	.string	" \344\376\002\377\242\003\003"
+	.string	"\037\246\304\247\003\003"
+	.string	"\036\204\252\003\003"
+	.string	"\035\253\003\003"
+	.string	"\034\256\003\003\006"
+	.string	"\235\222\227\007\001\202v\003\016!\324\266\305\355"
+	.string	"\001\304\013\003\016\"\312\302\353\343\003\001\304\016\003\016\006\302\017\003\016!\344\023\003\022'\240\263\346\314\001\001\244\013\003\022%\210\377\232\331"
+	.string	"\001\244\022\003\022&\026\003\022&\330\230\316\277\001\001\304\033\003\022%\274\301\372-\001\304b\003\022$\350\315\341\215\001\001\204c\003\022#\316\266\311\320"
+	.string	"\001\344k\003\026(D\003\032\016B\003\032\022\202\001\003\032\026\255\323\371\236\002\001\302\006"
+	.string	"? \340\002)\032\323\006\030\244\016r\315\243l\230q\212\214W\037d~dx@[\314\n\303\236\3339\357\340\256\333gdE\340\214"
+	.string	"\211A\372&"
+	.ascii	".\005M\300%\200#8\200#8\020\034N /\226bH\230\rK$C_\004\004\035"
+	.ascii	"\274\240y\fF\276\0029\342 \033\350+\321K6\256bD\206\355\376<"
+	.ascii	"6\243\031p\031\326\354\207m\361\031#c\232qd\30626\303\310\211"
+	.ascii	"\037\330\211\331v\214Y.\003"
+	.text
+	.section	.gnu.lto_.refs.ea77469017ae99c6,"e",@progbits
+	.string	"(\265/\375`R\001\265\f"
+	.string	"\006[R@\020\221\222t\205\021\200@\357T\246/\017\n\203'\220"
+	.string	"\202\200\202m\364@\340`\247pu\227\t"
+	.string	""
+	.string	""
+	.string	""
+	.string	"@\021\200\363\313\375\301\335\n4O"
+	.string	"\341\311\035\315\bjl\2615\333H#\266\221Md\nF"
+	.string	"A"
+	.string	"?"
+	.ascii	" Z\317\017\036XV:\250\244\240\344\347\211\006\366\231!{\232\354"
+	.ascii	"\230\201Q\242\205\205=[\311\316Lj\300\230pi!1\"{9\260\257J\016"
+	.ascii	"\034-\330\377\211\311>\212\354$\331\037d\027\311>\261\177\354"
+	.ascii	"[\177\344\231\205Cp\275\301\324\027l\272\002\251'\220\336\363"
+	.ascii	":\202\367!\256\203\264\017\220\272\200\327;\256_\256\177\270"
+	.ascii	"N\271\276\211zsk<\267\rPo)\2557\024\350\333I\373\206!{\273\240"
+	.ascii	"c\306\314\213\210\020P\317\273\370\007\200=\360C\254\336\201"
+	.ascii	"\177\301\257\252\356\252=4\177#\372m\320\220\021\343\205\364"
+	.ascii	"\273\370P}\026\324/\023\365c\336\277\"\205\353\237\330\3740S"
+	.ascii	"\377\205\365\t\323\227H\235Dz\t\257\217\274\003\037\305\327T"
+	.ascii	"\007`W\261S\261\277\236V;\320\177\254\276\214\365\253\210\360"
+	.ascii	"w\271\276\002\347)\300/\211\037!\276\203\330\031\304.\022\273"
+	.ascii	"\007\366\003\360\r\300/p=\b\347\t\3009\360=b\003( \360\"\275"
+	.ascii	"\305\001I\330\342\n\370v%\223f\207\261\313`\336.\0021$L\264\353"
+	.ascii	"\031\203\232\200\355~\346\030c\322Nc\330D\262\213\255Tsn\254"
+	.ascii	"\tv\214e\242\3145\0061\t\332\001c\262I\273\315\031\333D\267b"
+	.ascii	"X\342\t"
+	.text
+	.section	.gnu.lto_.decls.ea77469017ae99c6,"e",@progbits
+	.ascii	"(\265/\375`\357<m\006\001J\232qZW LQ:\215\001j)@\235\243\177"
+	.ascii	"3\005\256\260\370v\232JT\231C\220w%\222B\n\315x\0242e\021\005"
+	.ascii	"q\243\031\242\033>\256\261\353\241(<\214Ze\233\310M\323y4Y*\022"
+	.ascii	"\333/\265x\370\246I\005\274\252\253\317\357\004\262osKw$*\255"
+	.ascii	"m)\245L\001\322\004\233\005\334\005d\310\346N*\243c\207\026w"
+	.ascii	"\207F\377\232!r\2318W\312/\263\233/\3236\255\031n2%p\205\345"
+	.ascii	"y\231\326\355^\355\030]a^\346\305\272Z;EmCn\220+\344nY\347e>"
+	.ascii	"\373\\\246mb\255\354+7\246\005=9d2l\270\370\345\013\344\327\243"
+	.ascii	"\207\035\334\027}\022;\3240\257\217\373\303:o\226}\373\225\323"
+	.ascii	"a\353v\320\275\227k\262.\017[g\337x<\340\213MO\207\236\036\214"
+	.ascii	"\203-\213\222\316\277t\372WN\377\306\351_-\272g7\364\256\025"
+	.ascii	"S\233\251+lv\216\307\026\270\254/bl`\271K@\230oZ~<\315\234\251"
+	.ascii	"\301<+c\353v\2122l\243$\325\321U\302aJ\275d,)\256K\017\022^n"
+	.ascii	"\234\025\275\020\201\316\226\341&\323\267\344\n\307\363\353B"
+	.ascii	"Y4\266\0167\3234\322\030\215\247\315\362\217\020\341BY.\266l"
+	.ascii	"\007\231a'\341|0\367n\372\\#\245k\343./\fw\306\255\272Rw\352"
+	.ascii	"\342\2705.\325\215q\231\256\362:]\030\367\305m\2722\356\323"
+	.string	"\215\2724\254\363B\375\266\315^yn\356mt\223Kl\246\316l\033\247\213\204\001\306n\306\227\315k\262x\277Pw\3335;F\031\266\321\025\023s\357\335\243wT\311e\205\310\277Q\364uq\221\254\023\304M\272\351R\306F\331\315\277L\364-\210\036\017\210\336\257\022\375\353\245\177\205\350_,\375\213C\377\316\320\277J\375\353Bg\260x\332\336\3314\326\3715\253\3467F\315Mf{PA\3668\243Y\370\354\327z\267`\364\255\234\276\335\242\237\346\246\355\030\373\264\316\016,\231\3330V\356hQs7o\026\236\331\330\315\267R\364m\007=\234\227g;\350\335>\321\327n\350yx\222\351\333.}\273\2453\354\320\035\250\364-\224\006\221\244A\260\034z \330\r=\023\226C\357\326Hc\023vC\317V\351\240\253\320\2251\201\276E{\022\206D\024\253\266\203\367\266\002\303\264_\277\317\232\225b\3250H\356mec"
+	.string	"a\\\234mw{\357)\226\315R\261N\273\366[&\366\354\266\331\323\323\323\341\316y\0051\242\363[\320_A\337\252\375\326\211E#\323\021#\245\t\344f\233\346s\013e\204\254\034]7\343\nh\017\226C/K@\377\315r\350\345X\263\337&\261`\266L\004{\033\355\275\005\220\303\024\321R\272\331\216Y2\353\314\300.\371\b\021\216\221b\373k\357&\217N\233#m\326\334|\022tN\317\177"
+	.string	"Xm\021\256\365\363l\006=\033\346s+\266\241\247\234jn\236\234\245\245-37\333\274\2533l\313\241w\267E\362[/\373\225\001N\202\261\334e{75\3604\245\230r\334\374\246\345\320\323v\003\030\254\321\fH\375\350\211\377~\224\003\377\215\201}n\270\367_\022\\0\372\337-8\3777\307\177\2610\266*q50\342\277s\370\346\375\357\200\b\376\313\341\277&\\\001?\332"
+	.ascii	"\b\264\371o\021\336\177\251\260\211\262\346\277\tP\243\344\003"
+	.ascii	"\370\321\017~\033\366[\262\337\216\375\266y\364G}\376\273\246"
+	.ascii	"\371\355\326o\201@\335\375v\304\377\262\333%=\374\250\357\267"
+	.ascii	"G\277=\300o\225~\353\301oA\374\026\204\337~\200\202\337\246\340"
+	.ascii	"\267F\277-\372\255\362\267\373\267QI\320\3746\306\177\225\234"
+	.ascii	"\371\257\227\231\337.\375\026\206\337:\375\326I\031[\301oy\354"
+	.ascii	"\213\337\002\177\273\363\333\337ou~\373\364[\343o=\374V\350\267"
+	.ascii	"\001\370m\320o3\3746\305oa\374\366\205\337\002\300Z\340\267,"
+	.ascii	"\374V\205\337b\340\267\027\370m\005~\333\364\333\023u\326\202"
+	.ascii	"\337f\360[\237\337j\360[\021d\376;\346\177\207\377+\214\360\237"
+	.ascii	"?\177\371\355\325ok\374\326*\207\007\260\t\277u\300\177(\277"
+	.ascii	"m\300\377\016\376c\360[\022\256\346?N\230\377\322\3757\356\277"
+	.ascii	"p\377\305\362_+\377e\373\257\224\377\242\375\227\311\177\235"
+	.ascii	"\377\005\373\357\327\177\203\374\267\307\177\177\374\266\352"
+	.ascii	"\267>\376\253\343\277V\377]\376\367\306\177\251\376K\343\277"
+	.ascii	"S\377\225\372o\324\177\235\376\313\364\337\027\377U\372/\322"
+	.ascii	"\177\217\376\233\374o\n\376{\202\377\232\340\277-\376\273\342"
+	.ascii	"\277D\377M\361\337\240\377\036\377\353\201\377\n\340\267E~\333"
+	.ascii	"\365_\022\374\027\347\277E+\366[\025\377\035\372\255\376/\006"
+	.ascii	"\377\345\371o\200\377d\376/\371\357\013\377\035\301\177\205"
+	.string	"\376\033\374/\360\277\037\370o\b\376\013\202\377\216\360\337\234\337*\371\255\220\337\356\370\255\216\337b\375v\306o\247\376\237\370\255\214\337J\375\366\001\277%\361\377\353\277\013\377\333\376\347\344\345\345\345\375\275\3777i\177\b\236Hx\r\276\313\311\254\224\213\262QF\3424y\343<\353\304j\260\231\3433\030\315;\234\251\301^p\230$\f58\013\326\202A2i\027Y\2150$LK-\037m\371\340\302A\376\215S\367\336n\216\224\251+\013\003\343\245\231\205\310=\tB\006?\337K\002\307\303\n\017\375\233*\375\033)\235\207\230]\221\001\203\277Pu\361R\272\3717/\364o\\\350\337\021$qy7\3439,\267\363\242L\216-w\372\372\251\257\345\364\265\025}\355D_\223i\301o\314 ba\336xr\332x\301i/}\255\245\257\253\3645\f\372\032I\263\341*T\362Q\224(<\304\260Q\351mA\262\235S\216\251\360"
+	.ascii	"A\323\222\343f\274f\353p\362\320\256\254\301\351\373\244\350"
+	.ascii	"7\355\206\036N\333\361\302\032\363\212A?ASscG\023;9F\273\030"
+	.ascii	"\214\364B\304y3f\202\233\220(\022\342lr\266\204\304\314\223\346"
+	.ascii	"W\216\223S\326\362fl\3665[\244\311I\335\303\340P\361q\205\345"
+	.ascii	"\346\373t\350\247a\247\230)\247\266\233\307\260\021\354e\302"
+	.ascii	"\205\362\006)\371\342\371\3655\373V\206\002\334\222\030V\202"
+	.ascii	"\311p\230u\3421\234\344\030\f7\337\001\217\b\216\001\216\004"
+	.ascii	"\036\303H\276\206\301\226R\r\324\335\2216\0314~\331v\350\331"
+	.ascii	"\351\367\352\364{r\032s\341#\326\3716\334\365\035:%b\206`\321"
+	.ascii	"O\201}[\357=)\270\b\017\22538\322\312\364{I\206l\371\300\340"
+	.ascii	"\212\214\316z\374\020\202\231X\013\007\261N\274\205\2014\361"
+	.ascii	"q\225\260\262\230x\013\3778\352\261\205\263\256\222}+\333EO&"
+	.ascii	"\326\226r\312\273\033.X\\\316\374\262\335=\246~\257\207~o\251"
+	.ascii	"\337\203\201\007\b\2354]\222\\;\354|^S\256\312t`Y6)\267\245\233"
+	.ascii	"s\340+l\205\261\232\267\b\246Zba\033\266\356\205\022*\337\021"
+	.ascii	"5:\224\364r\001\320\360\rl\205o\340*\032ni\236l\301\313\343\252"
+	.ascii	"{%'\206\017\027w7c\034\266n\307\206\031W\214^\222~\317\205>\246"
+	.ascii	"jj\260\242\304q\363\b\237\343\032=.)UihX\3403\002\005\207\216"
+	.ascii	"\031c\3201+]ES\035h\243(g_X\006\216\302ar8!}\271\301\3702e\212"
+	.ascii	"\355^\301bzn'\334\204c`%\206\001Ka\030x\t3\341\027\030\n?Y'\216"
+	.ascii	"\302H\307IX\tG]1\227\f\2231<\034u\313`\244}\233B\341\326\234"
+	.ascii	"Qqz\342\250"
+	.ascii	"{t\245\340f\032\005\216"
+	.string	"\250\236Yp\324]SB\343\211\243\356\226\013\006\207))\020\227\364\304r\337\260\226p\324\r\323\006G]-\367m\247\250\271\221\030Pn\037\2141\261\"\027d\374f9\364F@\315\250!a\307\255y\212\200\227&\247\344b\363F\242M\003\360\306.\360\021Nb#\\d\235\030i\261\334nI\243\224Sra\3445s\355HX6\177T\233\310\214\f\371(\235>zE\037\205\242\217.\321G\223\350\243E\364\265\273\027\315\275\263\316kw\317\344\0305\257]\336\273\310\332\017;\326~@\327\200\024\215\365\362\321 \372(\226>\212C\373\354\206\336}\336\246\271%:\250;Fl\331\324\301ERn\350\222>\232\374\222\303\024\204M\335\031Mw\345\356\234u^/7.\177uqcri\363\361r\341\232\373\211\001M9%WOO\217=\323\361\303\214\316\317W\3643\232~f\242\237\235\372YL?w\351\337\267+v)"
+	.ascii	"\037\224\2240\265\233m\030\237\337,8m\212\0136C\364\363\016}"
+	.ascii	"\253\\+\326i\301m\253\343\221|\272\371\031\207F\301\336\326\202"
+	.ascii	"\236\315\313\263\026\364\236\241\364s\223~^\322\317G:\212\345"
+	.ascii	"R\322\345\251FI\017\271%6\230[\310\262\230\004\211s\236\335\262"
+	.ascii	"\032O\237\263;f\313v|W@p(\357\366n>\271Mn\332U\273h\027\312u"
+	.ascii	"b\235\367\354\232\375\212Y3\030\r\230\3323C>\256\242\217\235"
+	.ascii	"\350\3432},\246\217\223\350c.}\314\324\307<\364/\254\031#\215"
+	.ascii	"\023\252\233\177\223\\$\267IV\304,m\357\335\2741\234)\201aAO"
+	.ascii	"\317\215\242\266FF/\033\240H\3175r\271~\217\\$\316{\344~i\344"
+	.ascii	"\336\310\346v\352a-!A\335\355)*\020\030\252\211L\325\315\367"
+	.ascii	"\313\256\311\331\033\003\353\303\213\b\227\233o\327U\302k^6\330"
+	.ascii	"n\376\031[\206^\241\001\363\344\346c\033\372\277\177o\027)\367"
+	.ascii	"\336Phs\247%snQ\035\213\237\261\b\314\275\211<\315\364\254X\311"
+	.ascii	"0s\363~\300\336,$\031Y)5$\221\025!5\274hZ=%\221Y=i\330M1\031"
+	.ascii	"\233,\307\336IFK\344-\332\315\375\224a\033Y="
+	.string	"\351]\364Ljn\245\206\335,R\332m\245L*+BjH\"\263B&\221-\2374$5\255\236\266\321Fj#\261\275\215\226O\032\270\232V;\211\254\350)C\022\331\022\031\344\t\204\211C\233#0d\222\321n\272\200\313h\251|Kj.m\332\336\3102\027[i\233{[\355M\265\374\220f\244\205LK\2765\371\246\214\232H;\203)y\265\274i&\367[\022\221\245\220\213\275\3476S\bH\213l\356\275\221v\022i\367v\321T\356\235\\\212`ji\271 )\267\3166*\202\221\274Z\346\270H.\2216\221*\373\224Dv\265\364\201\342$c\356d\023i\231{\316J\251\003V\302\236\270t\321\037\324\254XA\245:l\205\201u\335\275uQ\262\321Do`5\345\237\202\262\201`7\222\363\252\315\023\243q\"\"\203\312Q\266\262\037\fU\304td\253\277\241AS\026\2467\340JKC\245tX\"\311\200"
+	.string	"{\322R\273a\252\n\243\021\345\250\224\253\224\203\005\367\343\nU\313i\"\267\0305\024\312M\035\230/F\311\032\314\035?\364\0060\2324A\321:,\221u\034l=\201uI\240\n\233:'G\321l\035\323\222\215\327U\352aqb\243\206Jk@\246\354(\2232\364\353f\341\275\231v#-\211\243z\352/Me\244\334\214\232\311\320\032\264\205\035\035\013C\235\367\031EM\316\027\225\2156dG\235G\225`7;<3b"
+	.string	"x\322\0324\223\374IP0+\266\2350\250\002\025\344\n\210\235 UMu`\177\256\232\233\261\203Nk\200\325\263u\264\310\026\372e\231lsO-\221dL\264-e\325\335\355\244)\020v\211\306\215\0135r\364\353\250\327\b\021\376D\b\262I\220#h\027\033'F\350\266\364Q\256<dk\006\233\006\255\016r\334\234D\320nFc\370\023\036\264\260\271\254'hG\230\334\214\0169J\344\277\271Q\273\201e\245C\377\250\220\377\306\307\244K\rf\225\276\206\032\232"
+	.string	"\316\236\243ZNT\013\r\222\233\373\351\247\214\315\003\034\035g\226P\320 \032\220\364\006r?~\240R_\350\220\240\270v\232\272\344p\334\351\363\340\201J\365\366\266\315\245\223r\203\267\036\250\017\264\007*\245\221\366\354n\n\004\017X^\025\234\027\375\fk:"
+	.ascii	"Yz\216\346\310\201\352Ha\271\241F\030Rw\245\346no*\017\264\216"
+	.ascii	"#:$(\226u6\307\244\334\334\254`\312H\323\020=\200\246\236\243"
+	.ascii	"V\326\211Z\345\271,\266\221\2771a\350\032\255*Gn~\006\034\372"
+	.ascii	"\203s\271\264\323\033\210\271qCD\026\317\233\376\240\325s\224"
+	.ascii	"\212*\327\341\230\255\341I\323\027\324\365\034\245a\235(\215"
+	.ascii	"\374\354 \266\221;O\252\300\272\364\033\032\234\321\022\375\241"
+	.ascii	"\253\307\036\261\350\324\255\023\235\302cW\303\336EG\322x\250"
+	.ascii	"4\007S1b\240R#\224\360P)t\013\021-\236\"\315a\254\347\350\323"
+	.ascii	"\255\023}B\243RX\026\r\361@e\373\360\336bh\335\214B5A\201P\r"
+	.ascii	"\001\253\323\337\241\323\037\230z\216:9\331\272\253\206M\177"
+	.ascii	"(\3529\312\344D\231l\335mn\345\357*\r\022\324]\231\3660\245\347"
+	.ascii	"\350\213\027\266\314~a\212i\017g=G\225P%/HPw_\332\203\226\236"
+	.ascii	"\243HH\327\016\004\337\222\244\230g\020\355\001L\317\321#\364"
+	.ascii	"h\314N\017\315\301\031\212<\212D\223vjc\2719$(.\264\350hRgmF"
+	.ascii	"\f5vf\350\017W=\317yy\327\256\303\306qIHP\\M\372\303T\3173\036"
+	.ascii	"\336\265\363%\361v\266\346`\244\347y\315\2553\257\311bRX\356"
+	.ascii	"(\020k\317)\017n\276\230\236\360\322h\017\315\236\3474\316\234"
+	.ascii	"\3462Shn\344O\026\245\007\327\t\243=\330\365<\3339\263\235-\263"
+	.ascii	"\315\355\364K\336)\233\036\\'Ns\360\314f\236\315\3443z\373\216"
+	.ascii	"|(A\374?\363|\346\332\335l\r\271\2021\245\211&\237lb\334\234"
+	.ascii	"\311\354`0\261\270\033e:\217\311\301b\245E-\006\235\303\354P"
+	.ascii	"qKS\312\001\346mY\310\232Q\325\027/hG\270\274n\276\227\377.\225"
+	.ascii	"\275\2704#7\2729%\036X\236\3733\227\034\227\345\256\256\221D"
+	.ascii	"\215\352f-\271\013N\230,(X3\264]Z\016\275\n\354\206\236u\342"
+	.ascii	"\363\f\227s\240q\022\262E\213\226\374\226\245r\226L\226\261\270"
+	.ascii	"\371\234K\3167\267|E\006\2225Y?\2323\256<\235nf\313V\362\224"
+	.ascii	"L%K\311k\271\212u\346\266\354\003-\311\265\343\300\310\233\234"
+	.ascii	"\362\356IVC\200\021\245\234\362\256-G\331H2!\030y\312)\357\316"
+	.ascii	"\306\262\363\213\t\226\305\340\220\240\235e\264\256\347Wn\313"
+	.ascii	"K2\023\250\020\2140\345\224?<$O\316\f\371:Mi\031\312\025\221"
+	.ascii	"\245\215\233\257\263\323\354\232d'\032\210\222+N0M\340\262Y\020"
+	.ascii	"\0213\261(eedY\t\312\245\312\222\265\256L\266\225\303|f^Q_W\315"
+	.ascii	"\034\032\3729KH\256\325\235\220\"\264'1Y\232\262r\347fo\2531"
+	.ascii	"\314\033W\311\355*\363\270\263\202#[\261\265\305\240\313B2\f"
+	.ascii	"\266\314\276M\215\320\345\345\031\225\225_`f\344\251)sYH\356"
+	.ascii	"\221\2650H&\245PW\305+\177ef.\222c\310F2\221\274\225\273"
+	.string	"2W>\222\207Xg\026\222\203\340\321\3106\354[\331\tiY\262\220\f\225\225\031\b\024\260.,\246\n\016\312\0059?k\001\311C\3622r\363\217\253\345e\312\030-Y\331\307\215\224\221.L\326\364q\316x\344\035\\\262\330\370\272YGS\363 \3424\343Kc\345\034:R.\272\226"
+	.string	"\321\307YZ\345*\266\246\266\254\274\264i\234I\251\222\227\330L\316\r,\032rS\3728M\231\352\256!k\302I\326\300\323\377\215\3112pxX\321-i\311R\277'\372\277\246\376OK\377G\245\377k\312N@XK\244\334\374\337\221\376\315\032\375g\246\f\203j\271\3252\214\374\"\215Y\021\345\315y)[I\223c\212\321\267gp4\324\244`+Nc>\236hn7\276\256\340h\273J<\230hqN`\266`-/\340j\340q\231\321\005\323\3011\371`5X\314\213\347\030\\&*\251\204\325\242<\214\0138;.\274\244\fC\201\202\003\222\005\213\r<\314\006\267\311I\371(\273\310\001\351\032\\O\254\351\211\026\253q\b\205U8\244\022\203G\027T\341"
+	.ascii	".\024bMOhX\211\212kzB5\006qP\323\037\240\340/\210(\\\205\301"
+	.ascii	"\r\224\300\242\205\nP`\001\005\2420x\\Ub\321\204"
+	.string	"\024+\212\306\234b=\222@E/`Q<\032\215A\340\bbp\r\346\f\207\301\037\24158$B]\205(D\020\021\203>`AD\024\016?\b\241\004\260\204\t\026\"R \242\341\017Q(\342\250\022\211\020\361\223\032U\017\304\024>\023B\334\025E\242/E0\035\346\024@\305\241\024(pX\374\331\220\266\240\032\203vt@\b\261\036\203\306\020C b0\005\001\2507'\212.\250\306\240\r\035\004\240\005P0ma(Uy\322\024\330\343\302\261\370c\301\nT\177\204\253*T\327\340\252\217\351O\006\2415\210\230\016\201@\301\342\260E\320\b\344A\021\004\276\360\003D\201F\341\013*0\307\230\256*\020]\221\256\240\376\204j\321\b\\\221\022\201:\303b\017\005\020\007H\b\fR\207\200>\325\030\004L\325c\320\b\204@\007 \260\302\316\nL\217E!cp(=\261\032uV\340qM\201?u\r\236 \nU"
+	.string	"\262pL\201\204*\212G\243N\201?5\210B\325)\220\347\227\002!\240S\340\tCb\013 ]L\207\302aP\002\251\232\001\026\305!\n\"\2365\250Bx4\002U \216j\f\272YU\340\216j\f\362\021\213B\365\230j`\205\320M\372KQ\024:)\220E\nD\234@\272\006\217@D\301\0224\030\323\365D\2200\005\261hBq%\n\356\250*\b\375\254\302\025',\240AUa\005\252*\250*\254D\305\233\365B!D\250\307T\205\360\b\204\001\t\216\023`q\374\251\300\034\r\254\307\"\013\031\322!\212\240\013*z\307T\230B\270\022S \341o\005\246@E\025~)P\361\002\353\261h\324Q\215E_\272\006["
+	.string	"\"\n\242\320i\t\204'\364\252\2179@\3014\205\2410\350\3021M\221\202\250\004\026k\316qe\241\303\217\305q\347\270\262\220\252\020\246?i\013\303\240\360\230\252\031\274\360\023D1\034\006MH\207\202\307\b\2608\362"
+	.ascii	"\005\323\243\320Z\\\213G\243\210c:$\002J\205~T\016T`\272\006"
+	.ascii	"\327\023\253\361&%\n\2079\005*\232@<\022\255\351\361\267\002"
+	.ascii	"\325\f\350\365\030\\\325\233\025\030\\\207\351\t8-\202\303\024"
+	.ascii	"\350f=!\r\n\252j\252\302\252\006\207:\352\261x<\246=u%*\352"
+	.string	"\225HT4aM_\370\t\032q\326cQ\350\004\216jU \321\260xB5\006iX\221\256\240\006\205~k0E\261\036\203i\n\032\370\2350L5p\023\024T\001\005\026P\320\303b\261\004 \n$\034\006U\334\250A\301a\n4\005F@5\006\345\244\306\026.\260\020\246\360\255\301\023CD\304\336z\241\020\025\254\303 V\201\304\242p\r\376\024-\240\032\203t\326\340\020\023\213C,4\034\342\340\032<!(8\344;\001\205\025\206\251\212\036P\232\032O\340\244\352\221\250h\002\020\221\250x\f\312\0212\246X\2051\305\306\"\220P^\177\027\n!\202X\034\032*\376\250\302\341P8\324S\201\351\220\320\205t\r\002\001q\216\301\264E\026Z\211\305!\264E\020\b\253G\242\242\020\252\246+\021Q8\344S\201\210\305\237T\365\005\021\213\026H\201\212?)\320\357?\302cJL\203\364C(\361A\t\023,|7\261"
+	.string	"\020\026"
+	.string	"B\357&\026\340\343\263\200\022>\372%|\360\320\242(\201ea[\330\240\340\020V\021$\276\240\006\207r:$\\s\020\2618\274\t\016\365P\035\002\246@D\253p\035\006s\204\320\237\237 P\005\252\205\326c\221x\263\252\301t\005\216 \261\022\205>\342\212\"\020\020(%\032Udc\021\210\230W`\t\037m,\002\245YMW\341p\230\256A\365G\"5\266Xu\b*\321\032\\U \013a\212\237\b%\200R\025\307TM\2177*\202D|LU"
+	.ascii	"\365-x\321\230\036E\254\305\342Q\004\316\n\241\253\246G\274\""
+	.ascii	"\305=\246*\360\n4\261\022\205D\276'`\204\211\004\204@\242D\212"
+	.ascii	"\020\025\\\001\n0\301C\006V\220\200\376\t\021,A\220\bT\215A\""
+	.ascii	"\212B\021DapH\304\317Q\025\021\242\203\232\256-P\240Ja|\\\311"
+	.ascii	"\022\323K\2222\233\301\343\252\207\204E\247\331\346\310\227\236"
+	.ascii	"\0134\016\267=)b\244w\004\207\205\030M\035\365\214t\334\350q"
+	.ascii	"\324\245\227D\351\322\254\301\220\346\346\336\306)`\263wQo\337"
+	.ascii	"^Q\017\371\336\276\265\037|s\\IE\275\274\\wq\030Qz\266A\2238"
+	.ascii	"n]\236L\360P\266\021]\230Ll\244\374\246\360\264\334\326<y\274"
+	.ascii	"\366\225\0305\371L\tu0\260\322\240Q\331I\222i\356\316\326\365"
+	.ascii	"d\034\2559\263\003\363\r)\342\312C\343\314\251\323\342\243\310"
+	.ascii	"\231\257\035\347\232\22503(\032O\022\2150\034e\262\030_\031\247"
+	.ascii	"6wh\235-\203s\203\221\274\031}\206\260\334\273\b\035\203\222"
+	.ascii	"9\372|\023}\362\260\341\261\366\303\035\322$\252M/o\200\366\345"
+	.ascii	"\013\032\306\027D\013X\327\035\016\024\222\217;0G\303\240THL"
+	.ascii	"\027\331\006\266Q\304\254H\211\326\300\t\225C\345P\272\n\240"
+	.ascii	"\340\314\241)\3411w\224\316N'M\312\007\332\206\036\372\003\230"
+	.ascii	"\313\3442A\343zK\324\272\276\356\362\0165H\274\334\214\306ee"
+	.ascii	"\232\031K\274\233?\334\275\275\241p$\220\321R\343\312a\203\322"
+	.ascii	"t\262\345(\234\357\031\305\354\353fTK\266\372\023,V\300\260\321"
+	.ascii	"\037\254\\\271\202b\261\031\232I8&&\217ZT\233$\267\243X\274\034"
+	.ascii	"\231\225)\003\205\034\250\343\"\344\211HZbN!\206\230\021\242"
+	.ascii	"\321$\351C\025@PhP$\023\016\266Y\037\023\200\023\311\243\301"
+	.ascii	"\236F!3%#\005)HA\241\260\265\006\347\003h\227\366\025\271S\351"
+	.ascii	"\004\2148n\n\344e\250\027\3600\370\324g_&\277\036\305\232\025"
+	.ascii	".\253T\251\211\303\311\257\337\212X\233\257f\306|\b\274\233("
+	.ascii	"\215\222\027\242#Zb\236\300n\271\013;9\226\344\361p\251'\255"
+	.ascii	"\013.R\3731\247\310\335i#Yg\257\301\3267\316\253\bD\217\276\306"
+	.ascii	"'\035\027\324\3413\354\363\2244\202\226\337\355\365OB\275\270"
+	.ascii	"|%\264Sf5\234\270s\252\204\235\273I\314y\324$\200#<\277\356O"
+	.ascii	"\336\247\243#z\255)\230\307\345"
+	.ascii	"\323\306.t\217\271\302\001>\212z;\033\251j\330;\334\3772\224"
+	.ascii	"\274\216|\037\240~pf\246[\b\343\205(\210\313\315\376\277h\020"
+	.ascii	"E\376\177\202\020 '\352\203*\274\354\266\022\013\241\020J\002"
+	.ascii	"\244\262\336\265\243\001\307\n\002\240$'8\275\370\377\001\272"
+	.ascii	"I\r\357B\034\262\2017\037\252\243\357\335\034.\253\252\321\326"
+	.ascii	"-\303\342\361\t6\3659Z\231J\322=U\217Zk\263\031\311\370\037\364"
+	.ascii	"j\340!\366\361\2302S\226\031\350\251X\325\300B\031\221MB\002"
+	.ascii	"\"\356bF,\t\035]i\fD'y\307\220\304\005\300\317\231\256\230\211"
+	.ascii	"n*\r\220\251jS"
+	.string	"\363j\n&\374z\002\250On\233\350\260=rnI_}\275%\331k\006\237#\252\311\353\267l\355\003\007\330\206\312*8\224\240\241\371\035\\\221\221\235W_\017\004@\331\302\260\031^\255u\"\370\366\232(\007\030\2264\216\274\027)d\225#\211K\200\345d\321\345\206\263\342\372\371\243Q\363\273\n\231\204\003A\2740:\255\306=<}\236\233\263\354\375\321\224\343V^u\243\nP\t\304\320'/A\340\235\003g\2702Kd\337'\001\274\004\355\246\232'\013\307\021Z\210\263\213(\016`\3456\334N\034c^\300\232^\004\303\214\377h\345Rs\325\241)^\323\363\272\373\3153d\373\323\024\035\262\267\240\257\201\234\211\035C]f\031\322\356\274B\033\203w\352\325\213a\355_P\016\250L\007ro_S\n\376\\\204\272\376<d\017\320\023\0247`\032[\375\337\005-k\222g\033\267\301yD\202\305\267\346qJ\217\323Y"
+	.string	"\360\r\033\372\fV\316\337\356\302O,\246oL\313$EN\207\2638\fuG>vYv\237\270\354\340\267\264\262\347\300z\255\020\\\274\034\003^\307\312\275\253\234Cd/\030\222\273\205\330-\r\267X\246\266\234\237"
+	.string	"\031\202\340r\245\254.\315\313\021!H\335GC@R\270v\260\316D;Y\226\223\fe:\212\0224v"
+	.ascii	"\266g\336\350\273\366\365\005\311\266.\bn\235\0044\202G\237\024"
+	.ascii	"`\020\217r\202"
+	.string	"+\031O\253y3X\233\222\266H\022FA\b\321\205Z\337\252\355\211Iu\310\261\025\3513\252\f\005~(\352\2713\241W\035\2434fB\274\241\322VK\267\364\310E\006W\310\245K\2533_\034N\336\302\\z\373\001OZ\246$\210\241\334,\017\241\204\272fe\007\210_2\020cKE\351\n^\013K\345\306-\2701l\202\226\321\020\026!x \335_\f&~\222i\212I\304\301\377D\227\003\250\377\222\002\317d\301\022\013\346\004=\322\022Z#\001\243\025p\264n+\364s\310D\374\327\244\355\013\312\032d\232\t\367\323\271A\355\246c-__h$\212\030\213\214nY\024]\343\016i\371\007R\361\220\321B\217V\020K\260\250\267\234\022\314\030\311\204\204\305\033\006\341\361\017\036\201\263w\364\362\362\206\223\321$\327\\3CV\336\235\262\300\231\261`\236 \241P.=\371\216w\2430{\t\003\260\r\031\231\352\177)"
+	.string	"\352:\363\016\207\025\3730\307\007\372'<\310\207\031q\243q\337e\025\2036\237\314\005\031QG\026%Y\254`;Lki\253J!\213\215\355\005~\232\211\376w\022e\330\213\272o"
+	.string	"n,\327\177\360\337\221\230u\343$\356\036\255\316\270\2379\360x.\342\240\262\364\374\317\257\245 \213\323\353\335\001p\256}`ESa\254\310#[P>D$\315\030\b\360\231\321\331\261\222\351\242\3505\315\"\302j\332\021\210\214\001c\366\270\304\205p+G\255\363JG\341\366\002\245\370\342\376Q\232\377\003\251\035L\337s\336\315\2100[\373\301\234\273U\252\327\224\336\212\212W!\241w\r\303~\310\334\327E\220N^$\365X\301\276*\267lU\3216\3578\256*KQ\b\367\271\205\250cUY\334}z\310\323\013\223`\026\334-|1\2428[\314:\362\202\271\310\335\f\023\215\213\230\311v#_\210!\025]"
+	.string	"C\022B\340\322a\n\330 "
+	.string	"\177=\340)\371\036\n\330\262\002\347\034\007\f\031\023t\203]\313\264nQ\216\314(\r\002\370\234\276\326\346\336\013\345$\032\200Y\302*\245s\315\335S\211cvOc\022\205\213A!\256\204\354\217S\033L8E\037\034\233\003\004^RP5\224 a\257&\353\355\343w,\006o5b\233!I\341\277\226\240+h\370T\357\254G=\220]\t\377\236\030\020\013\3125\242aw\002\031\231\346\035\3047\006&\355\320\031\364UC{\202\236\310\321\323L\214\360\337-\301'\223\204PX\300\331\006\243A\302\0131\334\200\361\026\3340?$SH\t\332\230\340\177.e\311|\324\226\026\261 \206xRa\320\231Q_W\243\264\235\340\342\b\226KC\"js\347\366\216\207\272|$3"
+	.ascii	"\212\027H\023\350S\021\314\367\271\00495k\037`\026;\006\273\f"
+	.ascii	"n\r\320\360\3117P`\312U4\270\321\001pC)\231\013\025\346\343\242"
+	.ascii	"\213pd\005\004\037\373\006P\256\004Gg\300>Y\241^\252\207\022"
+	.ascii	"\257\030\314o\221\306\314\\\247BH\204{[Qn`\332\326\210\217X\213"
+	.ascii	"rb\311\003\353'\274\206+\024V/#@\377\275a\325\235\257g\310\005"
+	.ascii	"R\317\253d\032\312\205-W86\230K\277]\fjO\250\312N\256\261]\246"
+	.ascii	"\3364k\204\223\330\035\210\361\357$S\326N?^\017\333\243\367\250"
+	.ascii	"7Oj\337\317SY\324$\276\004\230\337>Z\002\340\236\331\264HQ\326"
+	.ascii	"\017R\212r\303\017\241\355K&\3741wyp\273\035\242\237\017n\005"
+	.ascii	"\256\264BW\346\367\271\260\260\027\f\007\202\277\037<\255\375"
+	.ascii	"\324\374\204\030\201\233\310,\223\033\261\3628\204\354\2404\315"
+	.ascii	"\020\205\236!h\332~S\264\324U\004\335=d\270[MI\3751\306\226\250"
+	.ascii	"E\346=s\f\220\030\206\317\374\204G\0068\260AW\243\370\"t/\214"
+	.ascii	".\f\313\026\347\215\212e\242Uzg\r\227\265\211\261\035\264\201"
+	.ascii	"\031\376(2\256+\t\200A\325#\341q\331\3722\257\374\264\205\260"
+	.ascii	"D\353\035\324g(6\277k\242n\f}\257\001\305\333\224N\337\323\251"
+	.ascii	"\206>2\330\306\206\331\336\2058\273\302\233F\237\023\223mye8"
+	.ascii	"=_\244\264\261?\240\"s\3455A\244\217u\353N\201?\031V`\305\211"
+	.ascii	"\361`\"R+\330fN\035\356s\3173\310\255\236\320\033\211F\2234\271"
+	.ascii	"q\242\316D\024.\201\365qk\303\335\221\231J(\300\345^dA\021\344"
+	.ascii	"\256o\217\275\200\356\023\245+\341\025\207\226j}~\230m\345O\016"
+	.ascii	"C\354\b\222\312^\271\260\274\306!\272t\202!\002\300|\245=\372"
+	.ascii	"\365\221\0175?-V\376\277\327\374;pEp\254\361`\031\307\270\226"
+	.ascii	"\"\313\224\247\310\241\240\233\242\205X%\233\037\377\"\275\320"
+	.ascii	"\346>;\b,\350b\3652\2723\023C\006;\226@\366\254\355\223\0206"
+	.ascii	"\215\355L\370E\203a\2272W\202\306W\344y\316\227\256\307\"\250"
+	.ascii	"\264\342\367K/57\337\260\004\201\247Y\206\323\232\322\001\t\266"
+	.ascii	"\316\377YW\217-\250\356\320\305\340}(\224\274\271\220\315S\303"
+	.ascii	"\271\3118$\374\330:\330\321\303\350\250Opa\357\333\265?\367b"
+	.ascii	"\255$\315\275T\006\251\\\366-\340\240Lt\236\371W\0260\374W\372"
+	.ascii	"\357\020\013R\301=sQ\246\314d\374\313E\314Ql\221; \360o\277n"
+	.ascii	"(\267\032\266\017\373\226m\226\224\375\031O\226\226]\215\203"
+	.ascii	"\234\030\207\223d\342Q\027\241\273\336*.,\200!'\372^\023)\300"
+	.ascii	"\027\277=\255"
+	.string	"C\b\247\243A\252\302\227s"
+	.string	"\335\256\035\227t\003\002\310[4\350\007.2%\315 A\036F'2\307\251\241\265\0035\311\244\255\324\224Ps\003a\264\020\002\236X\226~M\215\375\311||T\250r\025\263\310P\337d\024\246\267W\316~\021>j\342bf\360~\027\344p\354\352\331\352\206\362\327\217\324N$X\004\251\260"
+	.string	"X>T\224e\260\0171*\312\345\346u\003.\335\305\321M\rf\262\003\270cN\f{\350\234\205\322f|\203E\371\344\325"
+	.ascii	"\334\262\335\223x\346\227\013\220\2557\343\322>Pt\022\312_\243"
+	.ascii	"\214\362\277U\370zx\347y\270\313\210\"<C\374\027n\361\257?\307"
+	.ascii	"\331< L\221\234\342\364\364:J6\316\217\311\337_>`\264/\350\255"
+	.ascii	"\242r\213\333Y\202\344\344\312\361I\373\360\275\356sa\013\305"
+	.ascii	"\243v\303SI\227\217\201\311\362ze\336\036\362\270\330\304O\006"
+	.ascii	"\254\0166;\215\260\323\347Gz){\002|\370\306\250\352\037w\251"
+	.ascii	"\213\365b\354\373\036Y\346\351\331_+I\370\027\223\313s\351\276"
+	.ascii	"-y\263\026\257\002\277Z\314\235\356{\367\226\367:\207\323@,\227"
+	.ascii	"\301\2749\031\033(\177\335\354\277\035Y\336\305\335#\377\300"
+	.ascii	"\346)]\236\311\016NwJ\020\277\270]x\360=v\370\333i\305k\270%"
+	.ascii	"p\340'\256\006\226\354\354\202\337\261{\350\020\360\270\345\351"
+	.ascii	"6\254\265\245\345\221\232\373g'\247\342\306\365\201\240\365\n"
+	.ascii	"\254\217\026\216\346^s\225\260\210\017\246\033\230\256\2724\207"
+	.ascii	"4\236\256"
+	.text
+	.section	.gnu.lto_.symtab.ea77469017ae99c6,"e",@progbits
+	.string	"decodeLong"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"<\001"
+	.string	""
+	.string	"decodeShort"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\241\001"
+	.string	""
+	.string	"gpsRestartNAZA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\254\002"
+	.string	""
+	.string	"gpsHandleNAZA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\002"
+	.string	""
+	.string	"naza_protocol_bytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\257\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"{\002"
+	.string	""
+	.string	"gpsStats"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"gpsState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\232\002"
+	.string	""
+	.string	"gpsToSerialBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\242\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\002"
+	.string	""
+	.string	"fmodf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\002"
+	.string	""
+	.string	"atan2_approx"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\002"
+	.string	""
+	.string	"sqrtf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\306\002"
+	.string	""
+	.string	"powf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\312\002"
+	.string	""
+	.string	"gpsConstrainEPE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\002"
+	.string	""
+	.string	"gpsProcessNewSolutionData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\332\002"
+	.string	""
+	.string	"gpsSetProtocolTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\002"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\343\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\345\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\351\002"
+	.string	""
+	.string	"gpsSetState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\355\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.ea77469017ae99c6,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,15717 @@
+	.file	"gps_nmea.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/drivers/resource.h"
+	.file 6 "./src/main/drivers/serial.h"
+	.file 7 "./src/main/drivers/adc.h"
+	.file 8 "./src/main/io/serial.h"
+	.file 9 "./src/main/io/gps.h"
+	.file 10 "./src/main/io/gps_private.h"
+	.file 11 "./src/main/scheduler/protothreads.h"
+	.file 12 "./src/main/io/gps_nmea.c"
+	.file 13 "./src/main/common/gps_conversion.h"
+	.file 14 "/usr/include/string.h"
+	.file 15 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	gps_nmea.c.45646385
+	.weak	gps_nmea.c.45646385
+gps_nmea.c.45646385:
+	.long	0x1120
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x1b
+	.long	.LASF2285
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1949
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1950
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1951
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1952
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1953
+	.uleb128 0x3
+	.long	.LASF1954
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x3
+	.long	.LASF1955
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x5d
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1956
+	.uleb128 0x3
+	.long	.LASF1957
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF1958
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x7c
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x3
+	.long	.LASF1959
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1960
+	.uleb128 0x3
+	.long	.LASF1961
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x1d
+	.byte	0x8
+	.uleb128 0x5
+	.long	0xa9
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1962
+	.uleb128 0xa
+	.long	0xa9
+	.uleb128 0x3
+	.long	.LASF1963
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x51
+	.uleb128 0x3
+	.long	.LASF1964
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x70
+	.uleb128 0x3
+	.long	.LASF1965
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x45
+	.uleb128 0xa
+	.long	0xcd
+	.uleb128 0x1e
+	.long	0xcd
+	.uleb128 0x3
+	.long	.LASF1966
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x64
+	.uleb128 0x3
+	.long	.LASF1967
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x83
+	.uleb128 0xa
+	.long	0xef
+	.uleb128 0x3
+	.long	.LASF1968
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x96
+	.uleb128 0x5
+	.long	0xb0
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1969
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1970
+	.uleb128 0x3
+	.long	.LASF1971
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x11
+	.long	0xc1
+	.uleb128 0x3
+	.long	.LASF1972
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x12
+	.long	0xef
+	.uleb128 0x3
+	.long	.LASF1973
+	.byte	0x4
+	.byte	0x21
+	.byte	0x12
+	.long	0x100
+	.uleb128 0x9
+	.long	.LASF2056
+	.byte	0xa
+	.byte	0x4
+	.byte	0x49
+	.byte	0x10
+	.long	0x1ac
+	.uleb128 0x2
+	.long	.LASF1974
+	.byte	0x4
+	.byte	0x4b
+	.byte	0xe
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF1975
+	.byte	0x4
+	.byte	0x4d
+	.byte	0xd
+	.long	0xcd
+	.byte	0x2
+	.uleb128 0xc
+	.string	"day"
+	.byte	0x4
+	.byte	0x4f
+	.byte	0xd
+	.long	0xcd
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF1976
+	.byte	0x4
+	.byte	0x51
+	.byte	0xd
+	.long	0xcd
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF1977
+	.byte	0x4
+	.byte	0x53
+	.byte	0xd
+	.long	0xcd
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF1978
+	.byte	0x4
+	.byte	0x55
+	.byte	0xd
+	.long	0xcd
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF1979
+	.byte	0x4
+	.byte	0x57
+	.byte	0xe
+	.long	0xe3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF1980
+	.byte	0x4
+	.byte	0x58
+	.byte	0x3
+	.long	0x143
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x16
+	.long	0x2a9
+	.uleb128 0x1
+	.long	.LASF1981
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1982
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1983
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1985
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1987
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1988
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1989
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1990
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1991
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1992
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1993
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1994
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1995
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1996
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1997
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1998
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1999
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2000
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2001
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2002
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2003
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2004
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF2008
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF2009
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2010
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF2011
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2012
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2013
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2014
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF2017
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2018
+	.byte	0x25
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x43
+	.long	0x334
+	.uleb128 0x1
+	.long	.LASF2019
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2020
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2021
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2022
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2023
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2025
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2026
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2027
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2028
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2029
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2030
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2031
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2032
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2033
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2034
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2035
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2036
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2037
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2038
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2039
+	.byte	0x14
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2043
+	.long	0x30
+	.byte	0x1a
+	.long	0x355
+	.uleb128 0x1
+	.long	.LASF2040
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2041
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2042
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2043
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x3
+	.long	0x334
+	.uleb128 0x17
+	.long	.LASF2044
+	.long	0x30
+	.byte	0x20
+	.long	0x3b2
+	.uleb128 0x1
+	.long	.LASF2045
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2046
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2047
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2048
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2049
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2050
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2051
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2052
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2053
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2054
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2055
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2044
+	.byte	0x6
+	.byte	0x34
+	.byte	0x3
+	.long	0x361
+	.uleb128 0x9
+	.long	.LASF2057
+	.byte	0x10
+	.byte	0x6
+	.byte	0x37
+	.byte	0x10
+	.long	0x3e6
+	.uleb128 0x2
+	.long	.LASF2058
+	.byte	0x6
+	.byte	0x38
+	.byte	0x14
+	.long	0x3e6
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2059
+	.byte	0x6
+	.byte	0x39
+	.byte	0x9
+	.long	0x7c
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xd9
+	.uleb128 0x3
+	.long	.LASF2060
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x3
+	.long	0x3be
+	.uleb128 0xa
+	.long	0x3eb
+	.uleb128 0x3
+	.long	.LASF2061
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x10
+	.long	0x408
+	.uleb128 0x5
+	.long	0x40d
+	.uleb128 0xd
+	.long	0x41d
+	.uleb128 0x4
+	.long	0xe3
+	.uleb128 0x4
+	.long	0xa2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2062
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x10
+	.long	0x429
+	.uleb128 0x5
+	.long	0x42e
+	.uleb128 0xd
+	.long	0x443
+	.uleb128 0x4
+	.long	0x3e6
+	.uleb128 0x4
+	.long	0x7c
+	.uleb128 0x4
+	.long	0xa2
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2063
+	.byte	0x60
+	.byte	0x6
+	.byte	0x3f
+	.byte	0x10
+	.long	0x52e
+	.uleb128 0x2
+	.long	.LASF2064
+	.byte	0x6
+	.byte	0x41
+	.byte	0x24
+	.long	0x5ea
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2065
+	.byte	0x6
+	.byte	0x43
+	.byte	0xd
+	.long	0xcd
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2066
+	.byte	0x6
+	.byte	0x44
+	.byte	0x10
+	.long	0x355
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2067
+	.byte	0x6
+	.byte	0x45
+	.byte	0x13
+	.long	0x3b2
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2068
+	.byte	0x6
+	.byte	0x47
+	.byte	0xe
+	.long	0xef
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2069
+	.byte	0x6
+	.byte	0x49
+	.byte	0xe
+	.long	0xef
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2070
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xe
+	.long	0xef
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2071
+	.byte	0x6
+	.byte	0x4b
+	.byte	0x17
+	.long	0x5ef
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2072
+	.byte	0x6
+	.byte	0x4c
+	.byte	0x17
+	.long	0x5ef
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2073
+	.byte	0x6
+	.byte	0x4d
+	.byte	0xe
+	.long	0xef
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2074
+	.byte	0x6
+	.byte	0x4e
+	.byte	0xe
+	.long	0xef
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2075
+	.byte	0x6
+	.byte	0x4f
+	.byte	0xe
+	.long	0xef
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2076
+	.byte	0x6
+	.byte	0x50
+	.byte	0xe
+	.long	0xef
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2077
+	.byte	0x6
+	.byte	0x52
+	.byte	0x1e
+	.long	0x3fc
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2078
+	.byte	0x6
+	.byte	0x53
+	.byte	0xb
+	.long	0xa2
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2079
+	.byte	0x6
+	.byte	0x55
+	.byte	0x23
+	.long	0x41d
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2080
+	.byte	0x6
+	.byte	0x58
+	.byte	0xe
+	.long	0xef
+	.byte	0x58
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2081
+	.byte	0x68
+	.byte	0x6
+	.byte	0x5b
+	.byte	0x8
+	.long	0x5e5
+	.uleb128 0x2
+	.long	.LASF2082
+	.byte	0x6
+	.byte	0x5c
+	.byte	0xc
+	.long	0x61a
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2083
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x10
+	.long	0x633
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2084
+	.byte	0x6
+	.byte	0x5f
+	.byte	0x10
+	.long	0x633
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2085
+	.byte	0x6
+	.byte	0x61
+	.byte	0xf
+	.long	0x647
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2086
+	.byte	0x6
+	.byte	0x64
+	.byte	0xc
+	.long	0x65c
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2087
+	.byte	0x6
+	.byte	0x66
+	.byte	0xb
+	.long	0x677
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2088
+	.byte	0x6
+	.byte	0x68
+	.byte	0xc
+	.long	0x68c
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2089
+	.byte	0x6
+	.byte	0x6a
+	.byte	0xc
+	.long	0x6ac
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2090
+	.byte	0x6
+	.byte	0x6c
+	.byte	0xb
+	.long	0x677
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2091
+	.byte	0x6
+	.byte	0x6e
+	.byte	0xb
+	.long	0x6c0
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2092
+	.byte	0x6
+	.byte	0x71
+	.byte	0xc
+	.long	0x6d0
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2093
+	.byte	0x6
+	.byte	0x72
+	.byte	0xc
+	.long	0x6d0
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2094
+	.byte	0x6
+	.byte	0x75
+	.byte	0xc
+	.long	0x6ef
+	.byte	0x60
+	.byte	0
+	.uleb128 0xa
+	.long	0x52e
+	.uleb128 0x5
+	.long	0x5e5
+	.uleb128 0x5
+	.long	0xde
+	.uleb128 0x3
+	.long	.LASF2095
+	.byte	0x6
+	.byte	0x59
+	.byte	0x3
+	.long	0x443
+	.uleb128 0xa
+	.long	0x5f4
+	.uleb128 0xd
+	.long	0x615
+	.uleb128 0x4
+	.long	0x615
+	.uleb128 0x4
+	.long	0xcd
+	.byte	0
+	.uleb128 0x5
+	.long	0x5f4
+	.uleb128 0x5
+	.long	0x605
+	.uleb128 0x12
+	.long	0xef
+	.long	0x62e
+	.uleb128 0x4
+	.long	0x62e
+	.byte	0
+	.uleb128 0x5
+	.long	0x600
+	.uleb128 0x5
+	.long	0x61f
+	.uleb128 0x12
+	.long	0xcd
+	.long	0x647
+	.uleb128 0x4
+	.long	0x615
+	.byte	0
+	.uleb128 0x5
+	.long	0x638
+	.uleb128 0xd
+	.long	0x65c
+	.uleb128 0x4
+	.long	0x615
+	.uleb128 0x4
+	.long	0xef
+	.byte	0
+	.uleb128 0x5
+	.long	0x64c
+	.uleb128 0x12
+	.long	0x670
+	.long	0x670
+	.uleb128 0x4
+	.long	0x62e
+	.byte	0
+	.uleb128 0x8
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2096
+	.uleb128 0x5
+	.long	0x661
+	.uleb128 0xd
+	.long	0x68c
+	.uleb128 0x4
+	.long	0x615
+	.uleb128 0x4
+	.long	0x355
+	.byte	0
+	.uleb128 0x5
+	.long	0x67c
+	.uleb128 0xd
+	.long	0x6a6
+	.uleb128 0x4
+	.long	0x615
+	.uleb128 0x4
+	.long	0x6a6
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x5
+	.long	0x6ab
+	.uleb128 0x1f
+	.uleb128 0x5
+	.long	0x691
+	.uleb128 0x12
+	.long	0x670
+	.long	0x6c0
+	.uleb128 0x4
+	.long	0x615
+	.byte	0
+	.uleb128 0x5
+	.long	0x6b1
+	.uleb128 0xd
+	.long	0x6d0
+	.uleb128 0x4
+	.long	0x615
+	.byte	0
+	.uleb128 0x5
+	.long	0x6c5
+	.uleb128 0xd
+	.long	0x6ea
+	.uleb128 0x4
+	.long	0x615
+	.uleb128 0x4
+	.long	0x6ea
+	.uleb128 0x4
+	.long	0x7c
+	.byte	0
+	.uleb128 0x5
+	.long	0x3f7
+	.uleb128 0x5
+	.long	0x6d5
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x16
+	.long	0x71f
+	.uleb128 0x1
+	.long	.LASF2097
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2098
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2099
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2100
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2101
+	.byte	0x4
+	.byte	0
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x8
+	.byte	0x3b
+	.long	0x792
+	.uleb128 0x1
+	.long	.LASF2102
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2103
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2105
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2106
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2107
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2108
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2110
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2111
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2112
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2113
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2114
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2115
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2116
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2117
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2118
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2119
+	.byte	0x8
+	.byte	0x4d
+	.byte	0x3
+	.long	0x71f
+	.uleb128 0xf
+	.long	0xfb
+	.long	0x7a9
+	.uleb128 0x20
+	.byte	0
+	.uleb128 0xa
+	.long	0x79e
+	.uleb128 0x10
+	.long	.LASF2215
+	.byte	0x8
+	.byte	0x4f
+	.byte	0x17
+	.long	0x7a9
+	.uleb128 0x6
+	.byte	0x5
+	.long	0x7c
+	.byte	0x8
+	.byte	0x52
+	.long	0x815
+	.uleb128 0x21
+	.long	.LASF2120
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2121
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2122
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2123
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2124
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2125
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2126
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2127
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2128
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2129
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2130
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2131
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2132
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2133
+	.byte	0x8
+	.byte	0x60
+	.byte	0x3
+	.long	0x7ba
+	.uleb128 0x9
+	.long	.LASF2134
+	.byte	0xc
+	.byte	0x8
+	.byte	0x73
+	.byte	0x10
+	.long	0x87d
+	.uleb128 0x2
+	.long	.LASF2135
+	.byte	0x8
+	.byte	0x74
+	.byte	0xe
+	.long	0xef
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2065
+	.byte	0x8
+	.byte	0x75
+	.byte	0x1c
+	.long	0x815
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2136
+	.byte	0x8
+	.byte	0x76
+	.byte	0xd
+	.long	0xcd
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2137
+	.byte	0x8
+	.byte	0x77
+	.byte	0xd
+	.long	0xcd
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2138
+	.byte	0x8
+	.byte	0x78
+	.byte	0xd
+	.long	0xcd
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2139
+	.byte	0x8
+	.byte	0x79
+	.byte	0xd
+	.long	0xcd
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2140
+	.byte	0x8
+	.byte	0x7a
+	.byte	0x3
+	.long	0x821
+	.uleb128 0x9
+	.long	.LASF2141
+	.byte	0x64
+	.byte	0x8
+	.byte	0x7c
+	.byte	0x10
+	.long	0x8b1
+	.uleb128 0x2
+	.long	.LASF2142
+	.byte	0x8
+	.byte	0x7d
+	.byte	0x18
+	.long	0x8b1
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2143
+	.byte	0x8
+	.byte	0x7e
+	.byte	0xd
+	.long	0xcd
+	.byte	0x60
+	.byte	0
+	.uleb128 0xf
+	.long	0x87d
+	.long	0x8c1
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2144
+	.byte	0x8
+	.byte	0x7f
+	.byte	0x3
+	.long	0x889
+	.uleb128 0xa
+	.long	0x8c1
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x22
+	.long	0x909
+	.uleb128 0x1
+	.long	.LASF2145
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2146
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2147
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2148
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2149
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2150
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2151
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2152
+	.byte	0x9
+	.byte	0x2a
+	.byte	0x3
+	.long	0x8d2
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x2c
+	.long	0x946
+	.uleb128 0x1
+	.long	.LASF2153
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2154
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2155
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2156
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2157
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2158
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2159
+	.byte	0x9
+	.byte	0x33
+	.byte	0x3
+	.long	0x915
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x37
+	.long	0x983
+	.uleb128 0x1
+	.long	.LASF2160
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2161
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2162
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2163
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2164
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2165
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2166
+	.byte	0x9
+	.byte	0x3e
+	.byte	0x3
+	.long	0x952
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x40
+	.long	0x9a8
+	.uleb128 0x1
+	.long	.LASF2167
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2168
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2169
+	.byte	0x9
+	.byte	0x43
+	.byte	0x3
+	.long	0x98f
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x45
+	.long	0x9cd
+	.uleb128 0x1
+	.long	.LASF2170
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2171
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2172
+	.byte	0x9
+	.byte	0x48
+	.byte	0x3
+	.long	0x9b4
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x4a
+	.long	0x9f8
+	.uleb128 0x1
+	.long	.LASF2173
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2174
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2175
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2176
+	.byte	0x9
+	.byte	0x4e
+	.byte	0x3
+	.long	0x9d9
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0x9
+	.byte	0x50
+	.long	0xa23
+	.uleb128 0x1
+	.long	.LASF2177
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2178
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2179
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2180
+	.byte	0x9
+	.byte	0x54
+	.byte	0x3
+	.long	0xa04
+	.uleb128 0x9
+	.long	.LASF2181
+	.byte	0x18
+	.byte	0x9
+	.byte	0x58
+	.byte	0x10
+	.long	0xa98
+	.uleb128 0x2
+	.long	.LASF2182
+	.byte	0x9
+	.byte	0x59
+	.byte	0x13
+	.long	0x909
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2183
+	.byte	0x9
+	.byte	0x5a
+	.byte	0x10
+	.long	0x946
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2184
+	.byte	0x9
+	.byte	0x5b
+	.byte	0x15
+	.long	0x9a8
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2185
+	.byte	0x9
+	.byte	0x5c
+	.byte	0x13
+	.long	0x9cd
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2186
+	.byte	0x9
+	.byte	0x5d
+	.byte	0x13
+	.long	0x9f8
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2187
+	.byte	0x9
+	.byte	0x5e
+	.byte	0x9
+	.long	0x670
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2188
+	.byte	0x9
+	.byte	0x5f
+	.byte	0xd
+	.long	0xcd
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2189
+	.byte	0x9
+	.byte	0x60
+	.byte	0x3
+	.long	0xa2f
+	.uleb128 0xa
+	.long	0xa98
+	.uleb128 0x9
+	.long	.LASF2190
+	.byte	0xc
+	.byte	0x9
+	.byte	0x6a
+	.byte	0x10
+	.long	0xade
+	.uleb128 0xc
+	.string	"lat"
+	.byte	0x9
+	.byte	0x6b
+	.byte	0xd
+	.long	0xc1
+	.byte	0
+	.uleb128 0xc
+	.string	"lon"
+	.byte	0x9
+	.byte	0x6c
+	.byte	0xd
+	.long	0xc1
+	.byte	0x4
+	.uleb128 0xc
+	.string	"alt"
+	.byte	0x9
+	.byte	0x6d
+	.byte	0xd
+	.long	0xc1
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2191
+	.byte	0x9
+	.byte	0x6e
+	.byte	0x3
+	.long	0xaa9
+	.uleb128 0x14
+	.byte	0x7
+	.byte	0x9
+	.byte	0x73
+	.byte	0x5
+	.long	0xb4f
+	.uleb128 0x2
+	.long	.LASF2192
+	.byte	0x9
+	.byte	0x74
+	.byte	0xd
+	.long	0x670
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2193
+	.byte	0x9
+	.byte	0x75
+	.byte	0xd
+	.long	0x670
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2194
+	.byte	0x9
+	.byte	0x76
+	.byte	0xd
+	.long	0x670
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2195
+	.byte	0x9
+	.byte	0x77
+	.byte	0xd
+	.long	0x670
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2196
+	.byte	0x9
+	.byte	0x78
+	.byte	0xd
+	.long	0x670
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2197
+	.byte	0x9
+	.byte	0x79
+	.byte	0xd
+	.long	0x670
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2198
+	.byte	0x9
+	.byte	0x7a
+	.byte	0xd
+	.long	0x670
+	.byte	0x6
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2199
+	.byte	0x3c
+	.byte	0x9
+	.byte	0x72
+	.byte	0x10
+	.long	0xbf9
+	.uleb128 0x2
+	.long	.LASF2200
+	.byte	0x9
+	.byte	0x7b
+	.byte	0x7
+	.long	0xaea
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2201
+	.byte	0x9
+	.byte	0x7d
+	.byte	0x12
+	.long	0xa23
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2202
+	.byte	0x9
+	.byte	0x7e
+	.byte	0xd
+	.long	0xcd
+	.byte	0xc
+	.uleb128 0xc
+	.string	"llh"
+	.byte	0x9
+	.byte	0x80
+	.byte	0x13
+	.long	0xade
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2203
+	.byte	0x9
+	.byte	0x81
+	.byte	0xd
+	.long	0xbf9
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2204
+	.byte	0x9
+	.byte	0x82
+	.byte	0xd
+	.long	0xbf9
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2205
+	.byte	0x9
+	.byte	0x84
+	.byte	0xd
+	.long	0xb5
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2206
+	.byte	0x9
+	.byte	0x85
+	.byte	0xd
+	.long	0xb5
+	.byte	0x2a
+	.uleb128 0xc
+	.string	"eph"
+	.byte	0x9
+	.byte	0x87
+	.byte	0xe
+	.long	0xe3
+	.byte	0x2c
+	.uleb128 0xc
+	.string	"epv"
+	.byte	0x9
+	.byte	0x88
+	.byte	0xe
+	.long	0xe3
+	.byte	0x2e
+	.uleb128 0x2
+	.long	.LASF2207
+	.byte	0x9
+	.byte	0x8a
+	.byte	0xe
+	.long	0xe3
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2208
+	.byte	0x9
+	.byte	0x8c
+	.byte	0x10
+	.long	0x1ac
+	.byte	0x32
+	.byte	0
+	.uleb128 0xf
+	.long	0xb5
+	.long	0xc09
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2209
+	.byte	0x9
+	.byte	0x8e
+	.byte	0x3
+	.long	0xb4f
+	.uleb128 0x14
+	.byte	0x10
+	.byte	0x9
+	.byte	0x90
+	.byte	0x9
+	.long	0xc53
+	.uleb128 0x2
+	.long	.LASF2210
+	.byte	0x9
+	.byte	0x91
+	.byte	0xe
+	.long	0xe3
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2211
+	.byte	0x9
+	.byte	0x92
+	.byte	0xe
+	.long	0xef
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2212
+	.byte	0x9
+	.byte	0x93
+	.byte	0xe
+	.long	0xef
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2213
+	.byte	0x9
+	.byte	0x94
+	.byte	0xe
+	.long	0xef
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2214
+	.byte	0x9
+	.byte	0x95
+	.byte	0x3
+	.long	0xc15
+	.uleb128 0x10
+	.long	.LASF2216
+	.byte	0x9
+	.byte	0x97
+	.byte	0x1a
+	.long	0xc09
+	.uleb128 0x10
+	.long	.LASF2217
+	.byte	0x9
+	.byte	0x98
+	.byte	0x18
+	.long	0xc53
+	.uleb128 0x6
+	.byte	0x7
+	.long	0x30
+	.byte	0xa
+	.byte	0x21
+	.long	0xc9c
+	.uleb128 0x1
+	.long	.LASF2218
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2219
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2220
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2221
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2222
+	.byte	0xa
+	.byte	0x26
+	.byte	0x3
+	.long	0xc77
+	.uleb128 0x14
+	.byte	0x40
+	.byte	0xa
+	.byte	0x28
+	.byte	0x9
+	.long	0xd4e
+	.uleb128 0x2
+	.long	.LASF2223
+	.byte	0xa
+	.byte	0x29
+	.byte	0x19
+	.long	0xd4e
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2224
+	.byte	0xa
+	.byte	0x2a
+	.byte	0x1c
+	.long	0xd53
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2225
+	.byte	0xa
+	.byte	0x2b
+	.byte	0x14
+	.long	0x615
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2226
+	.byte	0xa
+	.byte	0x2d
+	.byte	0xe
+	.long	0xef
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2227
+	.byte	0xa
+	.byte	0x2f
+	.byte	0x10
+	.long	0xc9c
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2228
+	.byte	0xa
+	.byte	0x30
+	.byte	0x13
+	.long	0x983
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2229
+	.byte	0xa
+	.byte	0x31
+	.byte	0x13
+	.long	0x983
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2230
+	.byte	0xa
+	.byte	0x32
+	.byte	0xd
+	.long	0xcd
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2231
+	.byte	0xa
+	.byte	0x34
+	.byte	0xe
+	.long	0x12b
+	.byte	0x2c
+	.uleb128 0x2
+	.long	.LASF2232
+	.byte	0xa
+	.byte	0x35
+	.byte	0xe
+	.long	0x12b
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2233
+	.byte	0xa
+	.byte	0x36
+	.byte	0xe
+	.long	0x12b
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2234
+	.byte	0xa
+	.byte	0x37
+	.byte	0xe
+	.long	0x12b
+	.byte	0x38
+	.byte	0
+	.uleb128 0x5
+	.long	0xaa4
+	.uleb128 0x5
+	.long	0x8cd
+	.uleb128 0x3
+	.long	.LASF2235
+	.byte	0xa
+	.byte	0x38
+	.byte	0x3
+	.long	0xca8
+	.uleb128 0x10
+	.long	.LASF2236
+	.byte	0xa
+	.byte	0x3a
+	.byte	0x1a
+	.long	0xd58
+	.uleb128 0xf
+	.long	0x792
+	.long	0xd80
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x10
+	.long	.LASF2237
+	.byte	0xa
+	.byte	0x3c
+	.byte	0x13
+	.long	0xd70
+	.uleb128 0x9
+	.long	.LASF2238
+	.byte	0x18
+	.byte	0xb
+	.byte	0x40
+	.byte	0x8
+	.long	0xdce
+	.uleb128 0x2
+	.long	.LASF2239
+	.byte	0xb
+	.byte	0x41
+	.byte	0x7
+	.long	0x7c
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2240
+	.byte	0xb
+	.byte	0x42
+	.byte	0x7
+	.long	0x7c
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2241
+	.byte	0xb
+	.byte	0x43
+	.byte	0xc
+	.long	0x137
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2242
+	.byte	0xb
+	.byte	0x44
+	.byte	0xf
+	.long	0x11f
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2243
+	.byte	0xb
+	.byte	0xc9
+	.byte	0xd
+	.long	0x670
+	.uleb128 0x9
+	.long	.LASF2244
+	.byte	0x24
+	.byte	0xc
+	.byte	0x58
+	.byte	0x10
+	.long	0xe6a
+	.uleb128 0xc
+	.string	"fix"
+	.byte	0xc
+	.byte	0x59
+	.byte	0x9
+	.long	0x670
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2245
+	.byte	0xc
+	.byte	0x5a
+	.byte	0xd
+	.long	0xc1
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2246
+	.byte	0xc
+	.byte	0x5b
+	.byte	0xd
+	.long	0xc1
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2202
+	.byte	0xc
+	.byte	0x5c
+	.byte	0xd
+	.long	0xcd
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2247
+	.byte	0xc
+	.byte	0x5d
+	.byte	0xd
+	.long	0xc1
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2248
+	.byte	0xc
+	.byte	0x5e
+	.byte	0xe
+	.long	0xe3
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2249
+	.byte	0xc
+	.byte	0x5f
+	.byte	0xe
+	.long	0xe3
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2207
+	.byte	0xc
+	.byte	0x60
+	.byte	0xe
+	.long	0xe3
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2208
+	.byte	0xc
+	.byte	0x61
+	.byte	0xe
+	.long	0xef
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2250
+	.byte	0xc
+	.byte	0x62
+	.byte	0xe
+	.long	0xef
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2251
+	.byte	0xc
+	.byte	0x63
+	.byte	0x3
+	.long	0xdda
+	.uleb128 0x7
+	.long	.LASF2252
+	.value	0x109
+	.byte	0x16
+	.long	0xdce
+	.uleb128 0x7
+	.long	.LASF2253
+	.value	0x10b
+	.byte	0x19
+	.long	0xd8c
+	.uleb128 0xf
+	.long	0x10c
+	.long	0xe9e
+	.uleb128 0x11
+	.long	0x37
+	.byte	0x4
+	.byte	0
+	.uleb128 0x7
+	.long	.LASF2254
+	.value	0x123
+	.byte	0x15
+	.long	0xe8e
+	.uleb128 0x7
+	.long	.LASF2255
+	.value	0x12b
+	.byte	0x19
+	.long	0xd8c
+	.uleb128 0x7
+	.long	.LASF2256
+	.value	0x187
+	.byte	0x19
+	.long	0xd8c
+	.uleb128 0x22
+	.long	.LASF2286
+	.byte	0xa
+	.byte	0x44
+	.byte	0x6
+	.uleb128 0x13
+	.long	.LASF2257
+	.byte	0xa
+	.byte	0x45
+	.byte	0x6
+	.long	0xedc
+	.uleb128 0x4
+	.long	0x12b
+	.byte	0
+	.uleb128 0x23
+	.long	.LASF1979
+	.byte	0xf
+	.byte	0x1d
+	.byte	0xa
+	.long	0x12b
+	.uleb128 0x13
+	.long	.LASF2258
+	.byte	0x6
+	.byte	0x82
+	.byte	0x6
+	.long	0xeff
+	.uleb128 0x4
+	.long	0x615
+	.uleb128 0x4
+	.long	0x10c
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2086
+	.byte	0x6
+	.byte	0x7f
+	.byte	0x6
+	.long	0xf16
+	.uleb128 0x4
+	.long	0x615
+	.uleb128 0x4
+	.long	0xef
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2087
+	.byte	0x6
+	.byte	0x81
+	.byte	0x5
+	.long	0x670
+	.long	0xf2c
+	.uleb128 0x4
+	.long	0x62e
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2259
+	.byte	0xa
+	.byte	0x41
+	.byte	0x11
+	.long	0xe3
+	.long	0xf42
+	.uleb128 0x4
+	.long	0xef
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2260
+	.byte	0xa
+	.byte	0x42
+	.byte	0x11
+	.long	0xe3
+	.long	0xf58
+	.uleb128 0x4
+	.long	0xef
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2261
+	.byte	0xd
+	.byte	0x12
+	.byte	0xa
+	.long	0xef
+	.long	0xf6e
+	.uleb128 0x4
+	.long	0x10c
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2262
+	.byte	0xe
+	.byte	0x9c
+	.byte	0xc
+	.long	0x7c
+	.long	0xf89
+	.uleb128 0x4
+	.long	0x10c
+	.uleb128 0x4
+	.long	0x10c
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2085
+	.byte	0x6
+	.byte	0x7e
+	.byte	0x9
+	.long	0xcd
+	.long	0xf9f
+	.uleb128 0x4
+	.long	0x615
+	.byte	0
+	.uleb128 0xe
+	.long	.LASF2263
+	.byte	0x6
+	.byte	0x79
+	.byte	0xa
+	.long	0xef
+	.long	0xfb5
+	.uleb128 0x4
+	.long	0x62e
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2264
+	.byte	0xa
+	.byte	0x3e
+	.byte	0xd
+	.long	0xfc7
+	.uleb128 0x4
+	.long	0xc9c
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2265
+	.value	0x1b2
+	.uleb128 0x15
+	.long	.LASF2266
+	.value	0x1a6
+	.uleb128 0x16
+	.long	.LASF2270
+	.value	0x187
+	.byte	0x61
+	.long	0xffa
+	.uleb128 0x7
+	.long	.LASF2267
+	.value	0x189
+	.byte	0x18
+	.long	0xffa
+	.uleb128 0x7
+	.long	.LASF2268
+	.value	0x189
+	.byte	0x4
+	.long	0x670
+	.byte	0
+	.uleb128 0x5
+	.long	0xd8c
+	.uleb128 0x15
+	.long	.LASF2269
+	.value	0x17a
+	.uleb128 0x16
+	.long	.LASF2271
+	.value	0x12b
+	.byte	0x60
+	.long	0x102b
+	.uleb128 0x7
+	.long	.LASF2267
+	.value	0x12d
+	.byte	0x18
+	.long	0xffa
+	.uleb128 0x7
+	.long	.LASF2268
+	.value	0x12d
+	.byte	0x4
+	.long	0x670
+	.byte	0
+	.uleb128 0x16
+	.long	.LASF2272
+	.value	0x10b
+	.byte	0x60
+	.long	0x105e
+	.uleb128 0x7
+	.long	.LASF2267
+	.value	0x10d
+	.byte	0x18
+	.long	0xffa
+	.uleb128 0x7
+	.long	.LASF2268
+	.value	0x10d
+	.byte	0x4
+	.long	0x670
+	.uleb128 0x18
+	.uleb128 0x7
+	.long	.LASF2273
+	.value	0x115
+	.byte	0x15
+	.long	0xcd
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.long	.LASF2287
+	.byte	0xc
+	.byte	0x67
+	.byte	0xc
+	.long	0x670
+	.long	0x10dd
+	.uleb128 0x19
+	.string	"c"
+	.byte	0x67
+	.byte	0x21
+	.long	0xa9
+	.uleb128 0xb
+	.long	.LASF2274
+	.byte	0x69
+	.byte	0x1a
+	.long	0xe6a
+	.uleb128 0xb
+	.long	.LASF2275
+	.byte	0x6b
+	.byte	0xd
+	.long	0xcd
+	.uleb128 0xb
+	.long	.LASF2276
+	.byte	0x6c
+	.byte	0x14
+	.long	0xcd
+	.uleb128 0xb
+	.long	.LASF2277
+	.byte	0x6c
+	.byte	0x1f
+	.long	0xcd
+	.uleb128 0xb
+	.long	.LASF2278
+	.byte	0x6c
+	.byte	0x2b
+	.long	0xcd
+	.uleb128 0xb
+	.long	.LASF2279
+	.byte	0x6d
+	.byte	0x11
+	.long	0x10dd
+	.uleb128 0xb
+	.long	.LASF2280
+	.byte	0x6e
+	.byte	0x14
+	.long	0xcd
+	.uleb128 0xb
+	.long	.LASF2281
+	.byte	0x6e
+	.byte	0x24
+	.long	0xcd
+	.uleb128 0x18
+	.uleb128 0xb
+	.long	.LASF2282
+	.byte	0xc5
+	.byte	0x19
+	.long	0xcd
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.long	0xa9
+	.long	0x10ed
+	.uleb128 0x11
+	.long	0x37
+	.byte	0xf
+	.byte	0
+	.uleb128 0x25
+	.long	.LASF2283
+	.byte	0xc
+	.byte	0x43
+	.byte	0x11
+	.long	0xef
+	.uleb128 0x19
+	.string	"src"
+	.byte	0x43
+	.byte	0x23
+	.long	0xa4
+	.uleb128 0x26
+	.long	.LASF2284
+	.byte	0xc
+	.byte	0x43
+	.byte	0x30
+	.long	0xcd
+	.uleb128 0x1a
+	.string	"i"
+	.byte	0x45
+	.long	0xef
+	.uleb128 0x1a
+	.string	"tmp"
+	.byte	0x46
+	.long	0xef
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 16 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 17 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 18 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.file 19 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 21 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 22 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x16
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 25 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1b
+	.file 28 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x18
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 32 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xed
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF730
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF731
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 37 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.file 38 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 39 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x27
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x28
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1071
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1098
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x2e
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x2f
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 49 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x31
+	.file 50 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 51 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x33
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.file 52 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x34
+	.byte	0x4
+	.file 53 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x4
+	.file 54 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x36
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 55 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x37
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4
+	.file 56 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 57 "./src/main/common/axis.h"
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xd
+	.byte	0x4
+	.file 58 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 59 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3b
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x6
+	.file 60 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x3c
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1504
+	.byte	0x4
+	.file 61 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 62 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.file 63 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0xf
+	.byte	0x4
+	.file 64 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x40
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x7
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1895
+	.byte	0x4
+	.file 65 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1896
+	.byte	0x4
+	.file 66 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 67 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x8
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1948
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF703
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF705
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.a617e65eb66869c389e597be8bb95a7c,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.241.7270a880a9a032c7121aef6d31a9a9f4,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF768
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.cbb642e1ccd385e8aa504b15cb7fb086,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF786
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF787
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF790
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF787
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF790
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1063
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1070
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1092
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1097
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1100
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1102
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1117
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1117
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1127
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1130
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1130
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1118
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1119
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1120
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1121
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1139
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1140
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1141
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1142
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1149
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1150
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1151
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1152
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1153
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1154
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1191
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1284
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.9b0338ccd4bac9fc60bf60e6477ae0d3,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1290
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1298
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1314
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1315
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1316
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF789
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1317
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1339
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1345
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1356
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1357
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1358
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1359
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1360
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1361
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1362
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1363
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1379
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1381
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1387
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1401
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1424
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1432
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1434
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1436
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1439
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1475
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1479
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1503
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1506
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1514
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1894
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1910
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1918
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps_private.h.24.b24872bc41c5679001c816204a4672e9,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1924
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.protothreads.h.72.5c357c7f93436138b3be33daa8d3fedb,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1944
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF2288
+	.long	.LASF2289
+	.long	.LASF2290
+	.long	.LASF2291
+	.long	.LASF2292
+	.long	.LASF2293
+	.long	.LASF2294
+	.long	.LASF2295
+	.long	.LASF2296
+	.long	.LASF2297
+	.long	.LASF2298
+	.long	.LASF2299
+	.long	.LASF2300
+	.long	.LASF2301
+	.long	.LASF2302
+	.long	.LASF2303
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x44
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2304
+	.byte	0xc
+	.long	.LASF2305
+	.byte	0xc
+	.long	.LASF2306
+	.byte	0xc
+	.long	.LASF2307
+	.byte	0x2
+	.long	.LASF2308
+	.byte	0x4
+	.long	.LASF2309
+	.byte	0x4
+	.long	.LASF2310
+	.byte	0x4
+	.long	.LASF2309
+	.byte	0x6
+	.long	.LASF2311
+	.byte	0x6
+	.long	.LASF2312
+	.byte	0x6
+	.long	.LASF2313
+	.byte	0x7
+	.long	.LASF2314
+	.byte	0x6
+	.long	.LASF2315
+	.byte	0x2
+	.long	.LASF2316
+	.byte	0xf
+	.long	.LASF2307
+	.byte	0x4
+	.long	.LASF2317
+	.byte	0xf
+	.long	.LASF2318
+	.byte	0x10
+	.long	.LASF2319
+	.byte	0x10
+	.long	.LASF2319
+	.byte	0xf
+	.long	.LASF2320
+	.byte	0xc
+	.long	.LASF2321
+	.byte	0xf
+	.long	.LASF2322
+	.byte	0xf
+	.long	.LASF2323
+	.byte	0xc
+	.long	.LASF2324
+	.byte	0xc
+	.long	.LASF2325
+	.byte	0xe
+	.long	.LASF2326
+	.byte	0xc
+	.long	.LASF2327
+	.byte	0xd
+	.long	.LASF2328
+	.byte	0xd
+	.long	.LASF2329
+	.byte	0xc
+	.long	.LASF2330
+	.byte	0xc
+	.long	.LASF2331
+	.byte	0xc
+	.long	.LASF2332
+	.byte	0xf
+	.long	.LASF2333
+	.byte	0xc
+	.long	.LASF2334
+	.byte	0xc
+	.long	.LASF2335
+	.byte	0xb
+	.long	.LASF2336
+	.byte	0xb
+	.long	.LASF2337
+	.byte	0x10
+	.long	.LASF2338
+	.byte	0xf
+	.long	.LASF2339
+	.byte	0xf
+	.long	.LASF2340
+	.byte	0xc
+	.long	.LASF2341
+	.byte	0xc
+	.long	.LASF2342
+	.byte	0xc
+	.long	.LASF2343
+	.byte	0xc
+	.long	.LASF2344
+	.byte	0xc
+	.long	.LASF2345
+	.byte	0xc
+	.long	.LASF2346
+	.byte	0xc
+	.long	.LASF2347
+	.byte	0xc
+	.long	.LASF2348
+	.byte	0xc
+	.long	.LASF2349
+	.byte	0xa
+	.long	.LASF2350
+	.byte	0x9
+	.long	.LASF2351
+	.byte	0x8
+	.long	.LASF2352
+	.byte	0x9
+	.long	.LASF2353
+	.byte	0x9
+	.long	.LASF2354
+	.byte	0x1
+	.long	.LASF2355
+	.byte	0x1
+	.long	.LASF2356
+	.byte	0x3
+	.long	.LASF2357
+	.byte	0x2
+	.long	.LASF2358
+	.byte	0x2
+	.long	.LASF2359
+	.byte	0x2
+	.long	.LASF2360
+	.byte	0x4
+	.long	.LASF2361
+	.byte	0x4
+	.long	.LASF2362
+	.byte	0x4
+	.long	.LASF2363
+	.byte	0x4
+	.long	.LASF2364
+	.byte	0x5
+	.long	.LASF2365
+	.byte	0x4
+	.long	.LASF2366
+	.byte	0x5
+	.long	.LASF2367
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1650:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1886:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1247:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF2138:
+	.string	"peripheral_baudrateIndex"
+.LASF1347:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF825:
+	.string	"__DECL_SIMD_logf "
+.LASF1220:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1578:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1108:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1716:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1058:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF1520:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1196:
+	.string	"USE_RX_PPM "
+.LASF1321:
+	.string	"USE_FAKE_BARO "
+.LASF1616:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1325:
+	.string	"USE_BARO "
+.LASF1250:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1041:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1308:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1270:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF934:
+	.string	"__DECL_SIMD_sinh "
+.LASF1587:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1642:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1442:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1332:
+	.string	"USE_UART7 "
+.LASF2143:
+	.string	"reboot_character"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF862:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF1947:
+	.string	"FRAME_RMC 2"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF2097:
+	.string	"ADC_BATTERY"
+.LASF1898:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1660:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2088:
+	.string	"setMode"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF699:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1271:
+	.string	"USE_SERIALRX_CRSF "
+.LASF744:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF725:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF1789:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF998:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF978:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF835:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2008:
+	.string	"OWNER_RX_SPI"
+.LASF698:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1402:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF938:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1528:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1039:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1251:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1954:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2064:
+	.string	"vTable"
+.LASF1441:
+	.string	"FAST_MATH "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1790:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2096:
+	.string	"_Bool"
+.LASF960:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF793:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1735:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF2188:
+	.string	"gpsMinSats"
+.LASF1369:
+	.string	"U_ID_2 2"
+.LASF719:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF2220:
+	.string	"GPS_RUNNING"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1507:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1103:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1002:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF844:
+	.string	"__DECL_SIMD_pow "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF1977:
+	.string	"minutes"
+.LASF2182:
+	.string	"provider"
+.LASF930:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1877:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1505:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF2151:
+	.string	"GPS_PROVIDER_COUNT"
+.LASF1850:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1823:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF752:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2076:
+	.string	"txBufferTail"
+.LASF2045:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF2211:
+	.string	"errors"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1301:
+	.string	"_WCHAR_T "
+.LASF1529:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1813:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1381:
+	.string	"NOINLINE "
+.LASF1713:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1759:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1386:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1778:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1918:
+	.string	"HDOP_SCALE (100)"
+.LASF2230:
+	.string	"autoConfigStep"
+.LASF1905:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF931:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF839:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1300:
+	.string	"__WCHAR_T__ "
+.LASF1611:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1455:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1882:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF1313:
+	.string	"_WCHAR_T_DECLARED "
+.LASF2152:
+	.string	"gpsProvider_e"
+.LASF1005:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1213:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF810:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1254:
+	.string	"USE_CMS "
+.LASF983:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF2189:
+	.string	"gpsConfig_t"
+.LASF1705:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1429:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1854:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2169:
+	.string	"gpsAutoConfig_e"
+.LASF1722:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1800:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF2005:
+	.string	"OWNER_LED"
+.LASF798:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2259:
+	.string	"gpsConstrainEPE"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF1936:
+	.string	"ptSpawn(name) do { ptRestart(ptGetHandle(name)); ptWaitThread(name); } while (0)"
+.LASF823:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1280:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF1966:
+	.string	"uint16_t"
+.LASF2030:
+	.string	"RESOURCE_SPI_SCK"
+.LASF1010:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF373:
+	.string	"linux 1"
+.LASF1451:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF2119:
+	.string	"baudRate_e"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1821:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2156:
+	.string	"SBAS_MSAS"
+.LASF1829:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF817:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1365:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF956:
+	.string	"__DECL_SIMD_atan2l "
+.LASF747:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF1414:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1166:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF792:
+	.string	"_MATH_H 1"
+.LASF707:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1375:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1589:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1289:
+	.string	"_T_PTRDIFF_ "
+.LASF1192:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1827:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1594:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF806:
+	.string	"__DECL_SIMD_sinl "
+.LASF2204:
+	.string	"velNED"
+.LASF1764:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1336:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1668:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2007:
+	.string	"OWNER_TX"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1647:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1929:
+	.string	"ptRestart(handle) do { (handle)->returnCode = 0; (handle)->line = 0; } while(0)"
+.LASF1919:
+	.string	"GPS_HDOP_TO_EPH_MULTIPLIER 2"
+.LASF1470:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2142:
+	.string	"portConfigs"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1655:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1471:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF1337:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1054:
+	.string	"__DECL_SIMD_tan "
+.LASF1495:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF1299:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF827:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1541:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1649:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2263:
+	.string	"serialRxBytesWaiting"
+.LASF1065:
+	.string	"__HAVE_FLOAT128 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF745:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF1088:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2199:
+	.string	"gpsSolutionData_s"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1780:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF883:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1853:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2019:
+	.string	"RESOURCE_NONE"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1746:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1809:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF826:
+	.string	"__DECL_SIMD_logl "
+.LASF1881:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1975:
+	.string	"month"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1242:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1063:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1549:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF1514:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF2058:
+	.string	"data"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF780:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1491:
+	.string	"BIT(x) (1 << (x))"
+.LASF1999:
+	.string	"OWNER_BEEPER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF1896:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF1228:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF2073:
+	.string	"rxBufferHead"
+.LASF834:
+	.string	"__DECL_SIMD_exp "
+.LASF2216:
+	.string	"gpsSol"
+.LASF2245:
+	.string	"latitude"
+.LASF1044:
+	.string	"__DECL_SIMD_erfc "
+.LASF1574:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF909:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF926:
+	.string	"__DECL_SIMD_expm1l "
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1118:
+	.string	"_Mdouble_"
+.LASF1964:
+	.string	"int32_t"
+.LASF1422:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1066:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2135:
+	.string	"functionMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2028:
+	.string	"RESOURCE_I2C_SCL"
+.LASF1940:
+	.string	"ptStop(retCode) do { currentPt->returnCode = retCode; currentPt->line = (-1); return; } while (0)"
+.LASF1832:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1320:
+	.string	"USE_IMU_FAKE "
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2092:
+	.string	"beginWrite"
+.LASF1018:
+	.string	"__DECL_SIMD_erff32 "
+.LASF731:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1310:
+	.string	"___int_wchar_t_h "
+.LASF2010:
+	.string	"OWNER_SPI_PREINIT"
+.LASF836:
+	.string	"__DECL_SIMD_expl "
+.LASF2235:
+	.string	"gpsReceiverData_t"
+.LASF1803:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF2195:
+	.string	"validVelD"
+.LASF2020:
+	.string	"RESOURCE_INPUT"
+.LASF1624:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1341:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1360:
+	.string	"USE_RX_PPM"
+.LASF513:
+	.string	"__always_inline"
+.LASF2029:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1072:
+	.string	"__HAVE_FLOAT16 0"
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2168:
+	.string	"GPS_AUTOCONFIG_ON"
+.LASF2040:
+	.string	"MODE_RX"
+.LASF933:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1885:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1489:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1640:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1119:
+	.string	"__MATH_PRECNAME"
+.LASF969:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1702:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1380:
+	.string	"FAST_CODE "
+.LASF1229:
+	.string	"USE_OPFLOW "
+.LASF1129:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1627:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF901:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1354:
+	.string	"USE_1WIRE_DS2482"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1122:
+	.string	"_Mdouble_ float"
+.LASF2117:
+	.string	"BAUD_2000000"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1699:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1106:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1238:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1620:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF746:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF773:
+	.string	"_T_SIZE_ "
+.LASF1323:
+	.string	"USE_FAKE_GPS "
+.LASF1112:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF2234:
+	.string	"timeoutMs"
+.LASF2155:
+	.string	"SBAS_WAAS"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1006:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1155:
+	.string	"__MATHCALL_NARROW"
+.LASF1625:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF2174:
+	.string	"GPS_DYNMODEL_AIR_1G"
+.LASF1597:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF854:
+	.string	"__DECL_SIMD_acos "
+.LASF1239:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1468:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF2171:
+	.string	"GPS_AUTOBAUD_ON"
+.LASF1783:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF1104:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1140:
+	.string	"__MATHDECL_1"
+.LASF2172:
+	.string	"gpsAutoBaud_e"
+.LASF1856:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1998:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF706:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF1893:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF1132:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF2018:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1416:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1796:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF784:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1846:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2041:
+	.string	"MODE_TX"
+.LASF1076:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1371:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF1548:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1510:
+	.string	"IOCFG_AF_PP 0"
+.LASF958:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1486:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2214:
+	.string	"gpsStatistics_t"
+.LASF987:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF1971:
+	.string	"timeDelta_t"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF1903:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF894:
+	.string	"__DECL_SIMD_exp2 "
+.LASF1107:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1264:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF912:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1727:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF2238:
+	.string	"ptState_s"
+.LASF1765:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1236:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1711:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1197:
+	.string	"USE_SERIAL_RX "
+.LASF1203:
+	.string	"USE_ADC_AVERAGING "
+.LASF2232:
+	.string	"lastLastMessageMs"
+.LASF1167:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1370:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1572:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1023:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1889:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2162:
+	.string	"GPS_BAUDRATE_38400"
+.LASF1068:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1436:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF2103:
+	.string	"BAUD_1200"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF1976:
+	.string	"hours"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1806:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1676:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1870:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1164:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF2231:
+	.string	"lastStateSwitchMs"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1405:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2146:
+	.string	"GPS_UBLOX"
+.LASF2086:
+	.string	"serialSetBaudRate"
+.LASF1986:
+	.string	"OWNER_SERVO"
+.LASF1353:
+	.string	"USE_1WIRE"
+.LASF718:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1939:
+	.string	"ptYield() do { ptYielded = false; ptLabel(); if (!ptYielded) { return; } } while (0)"
+.LASF1466:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1427:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF951:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF709:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1847:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF919:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF852:
+	.string	"__DECL_SIMD_powf64x "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF2181:
+	.string	"gpsConfig_s"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1475:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF995:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF2132:
+	.string	"SERIAL_PORT_IDENTIFIER_MAX"
+.LASF2017:
+	.string	"OWNER_IRLOCK"
+.LASF1632:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1880:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2178:
+	.string	"GPS_FIX_2D"
+.LASF2147:
+	.string	"GPS_I2CNAV"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1581:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF853:
+	.string	"__DECL_SIMD_powf128x "
+.LASF702:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1662:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1550:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF2256:
+	.string	"gpsProtocolStateThreadNMEA_protothreadState"
+.LASF1777:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1588:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1295:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1408:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1555:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1622:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1955:
+	.string	"__int16_t"
+.LASF948:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1781:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF2105:
+	.string	"BAUD_4800"
+.LASF1957:
+	.string	"__uint16_t"
+.LASF1091:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2260:
+	.string	"gpsConstrainHDOP"
+.LASF2069:
+	.string	"rxBufferSize"
+.LASF1985:
+	.string	"OWNER_MOTOR"
+.LASF920:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF2223:
+	.string	"gpsConfig"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1639:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF887:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2193:
+	.string	"gpsHeartbeat"
+.LASF1523:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1859:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1311:
+	.string	"__INT_WCHAR_T_H "
+.LASF965:
+	.string	"__DECL_SIMD_log10f "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF863:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1672:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF890:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1177:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1527:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1799:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF2258:
+	.string	"serialPrint"
+.LASF859:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF786:
+	.string	"__size_t "
+.LASF2075:
+	.string	"txBufferHead"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2111:
+	.string	"BAUD_230400"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF921:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1558:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1849:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF2170:
+	.string	"GPS_AUTOBAUD_OFF"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1583:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1029:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF1176:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF822:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF850:
+	.string	"__DECL_SIMD_powf128 "
+.LASF891:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF2165:
+	.string	"GPS_BAUDRATE_COUNT"
+.LASF2185:
+	.string	"autoBaud"
+.LASF2115:
+	.string	"BAUD_1000000"
+.LASF763:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1982:
+	.string	"OWNER_PWMIO"
+.LASF1087:
+	.string	"__f32x(x) x ##f32x"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1241:
+	.string	"USE_OLED_UG2864 "
+.LASF1714:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1184:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1675:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1258:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1281:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1480:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF737:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF1153:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1680:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF749:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1867:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1532:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1949:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF734:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF982:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF900:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1741:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1506:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1296:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1454:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF1941:
+	.string	"ptEnd(retCode) ptStop(retCode); FALLTHROUGH; default: return; }"
+.LASF1494:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1945:
+	.string	"NO_FRAME 0"
+.LASF1211:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1208:
+	.string	"USE_NAV "
+.LASF1987:
+	.string	"OWNER_SOFTSERIAL"
+.LASF1755:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF358:
+	.string	"__k8 1"
+.LASF1701:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1969:
+	.string	"float"
+.LASF2065:
+	.string	"identifier"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF1554:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1379:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1557:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1644:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2089:
+	.string	"writeBuf"
+.LASF754:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF1016:
+	.string	"__DECL_SIMD_erfl "
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2212:
+	.string	"timeouts"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1509:
+	.string	"IOCFG_OUT_OD 0"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF1579:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF877:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1288:
+	.string	"_PTRDIFF_T "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1596:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1389:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2093:
+	.string	"endWrite"
+.LASF1664:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1181:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF973:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF791:
+	.string	"_STRINGS_H 1"
+.LASF1438:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF942:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1601:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF2116:
+	.string	"BAUD_1500000"
+.LASF1206:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1862:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF2009:
+	.string	"OWNER_VTX"
+.LASF512:
+	.string	"__wur "
+.LASF1831:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF1907:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1201:
+	.string	"USE_SERIALRX_FPORT "
+.LASF867:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1170:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1556:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2209:
+	.string	"gpsSolutionData_t"
+.LASF2013:
+	.string	"OWNER_1WIRE"
+.LASF1366:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1126:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF1930:
+	.string	"ptIsStopped(handle) ((handle)->line < 0)"
+.LASF1163:
+	.string	"FP_NORMAL 4"
+.LASF2277:
+	.string	"offset"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1235:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1473:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1756:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1149:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1114:
+	.string	"_Mdouble_ double"
+.LASF2107:
+	.string	"BAUD_19200"
+.LASF1992:
+	.string	"OWNER_RANGEFINDER"
+.LASF889:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2070:
+	.string	"txBufferSize"
+.LASF2157:
+	.string	"SBAS_GAGAN"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1546:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF915:
+	.string	"__DECL_SIMD_coshf "
+.LASF2145:
+	.string	"GPS_NMEA"
+.LASF1641:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF996:
+	.string	"__DECL_SIMD_atanhl "
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1719:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1633:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF988:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF729:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF1720:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF1551:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1047:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF1446:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF893:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1563:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF2094:
+	.string	"writeBufChunks"
+.LASF1136:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1364:
+	.string	"USE_ITCM_RAM"
+.LASF1603:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1670:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1895:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1689:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1932:
+	.string	"ptLabel() do { currentPt->line = __LINE__; FALLTHROUGH; case __LINE__:; } while (0)"
+.LASF2066:
+	.string	"mode"
+.LASF1077:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1116:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF947:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2085:
+	.string	"serialRead"
+.LASF1872:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF2183:
+	.string	"sbasMode"
+.LASF1801:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF803:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF2033:
+	.string	"RESOURCE_SPI_CS"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF966:
+	.string	"__DECL_SIMD_log10l "
+.LASF2077:
+	.string	"rxCallback"
+.LASF396:
+	.string	"false 0"
+.LASF1357:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1884:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1812:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2197:
+	.string	"validEPE"
+.LASF1352:
+	.string	"USE_PITOT_ADC"
+.LASF2137:
+	.string	"gps_baudrateIndex"
+.LASF843:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1538:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF753:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF1245:
+	.string	"USE_DJI_HD_OSD "
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1606:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2071:
+	.string	"rxBuffer"
+.LASF2060:
+	.string	"serialBufChunk_t"
+.LASF1079:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1798:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF794:
+	.string	"__DECL_SIMD_cos "
+.LASF2049:
+	.string	"SERIAL_PARITY_NO"
+.LASF2278:
+	.string	"parity"
+.LASF2239:
+	.string	"line"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1059:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1450:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1637:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF953:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1398:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF972:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1833:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF875:
+	.string	"__DECL_SIMD_asinf "
+.LASF1865:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1231:
+	.string	"USE_OPFLOW_MSP "
+.LASF760:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF771:
+	.string	"_SIZE_T "
+.LASF2032:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2002:
+	.string	"OWNER_MPU"
+.LASF1394:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1502:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1146:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2140:
+	.string	"serialPortConfig_t"
+.LASF1857:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1117:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1130:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF842:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1522:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1692:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF999:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF833:
+	.string	"__DECL_SIMD_logf128x "
+.LASF795:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1697:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF2283:
+	.string	"grab_fields"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2012:
+	.string	"OWNER_TEMPERATURE"
+.LASF2273:
+	.string	"newChar"
+.LASF1876:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1074:
+	.string	"__HAVE_FLOAT64 1"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF783:
+	.string	"___int_size_t_h "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1183:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1561:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF778:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2055:
+	.string	"SERIAL_BIDIR_NOPULL"
+.LASF2003:
+	.string	"OWNER_INVERTER"
+.LASF1180:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF2044:
+	.string	"portOptions_t"
+.LASF733:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1855:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1965:
+	.string	"uint8_t"
+.LASF1105:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1600:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1221:
+	.string	"USE_RX_UIB "
+.LASF1972:
+	.string	"timeMs_t"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1844:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF1139:
+	.string	"__MATHDECL_1_IMPL"
+.LASF1498:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1120:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1488:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF1900:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF758:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF860:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF2150:
+	.string	"GPS_MTK"
+.LASF2158:
+	.string	"SBAS_NONE"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1052:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1034:
+	.string	"__DECL_SIMD_asinh "
+.LASF1726:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF2276:
+	.string	"param"
+.LASF1878:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1358:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1312:
+	.string	"_GCC_WCHAR_T "
+.LASF1307:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2022:
+	.string	"RESOURCE_IO"
+.LASF1684:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1062:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1384:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1378:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1794:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF861:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1261:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1707:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF376:
+	.string	"unix 1"
+.LASF1160:
+	.string	"FP_INFINITE 1"
+.LASF1150:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1151:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1152:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF804:
+	.string	"__DECL_SIMD_sin "
+.LASF2196:
+	.string	"validMag"
+.LASF1226:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1599:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1732:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF2122:
+	.string	"SERIAL_PORT_USART2"
+.LASF1935:
+	.string	"ptWaitThread(name) do { ptLabel(); name(); if (!ptIsStopped(ptGetHandle(name))) { return; } } while (0)"
+.LASF1000:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1618:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1070:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1343:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF776:
+	.string	"_SIZE_T_ "
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1359:
+	.string	"USE_VCP"
+.LASF1165:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1521:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF787:
+	.string	"__need_size_t"
+.LASF1984:
+	.string	"OWNER_PPMINPUT"
+.LASF1512:
+	.string	"IOCFG_IPD 0"
+.LASF1298:
+	.string	"__need_ptrdiff_t"
+.LASF847:
+	.string	"__DECL_SIMD_powf16 "
+.LASF878:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1894:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF1095:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1944:
+	.string	"ptSemaphoreSignal(sem) do { sem = true; } while (0)"
+.LASF1227:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF916:
+	.string	"__DECL_SIMD_coshl "
+.LASF1388:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1868:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1121:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1134:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1623:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1285:
+	.string	"_STDDEF_H "
+.LASF1811:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1001:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1322:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1501:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1552:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1879:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1148:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1808:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF897:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1826:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF1133:
+	.string	"_Mdouble_ _Float128"
+.LASF708:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF832:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1914:
+	.string	"LON 1"
+.LASF1887:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1748:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF2270:
+	.string	"gpsProtocolStateThreadNMEA"
+.LASF1123:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1373:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1413:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1567:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF868:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF1216:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF950:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1458:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1590:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2286:
+	.string	"gpsProcessNewSolutionData"
+.LASF781:
+	.string	"_SIZE_T_DECLARED "
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1754:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF743:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF1071:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1636:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF927:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF700:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1500:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1215:
+	.string	"USE_PITOT_ADC "
+.LASF1614:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1536:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1980:
+	.string	"dateTime_t"
+.LASF1804:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1890:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1750:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1902:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1785:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2285:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1928:
+	.string	"ptGetHandle(name) (&name ##_protothreadState)"
+.LASF1069:
+	.string	"__f128(x) x ##f128"
+.LASF1007:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1125:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1592:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1822:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1830:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1586:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1570:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1457:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1661:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2106:
+	.string	"BAUD_9600"
+.LASF1048:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1845:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF2252:
+	.string	"semNewDataReady"
+.LASF1696:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF959:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF2159:
+	.string	"sbasMode_e"
+.LASF1431:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF876:
+	.string	"__DECL_SIMD_asinl "
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1525:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF739:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF1539:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1055:
+	.string	"__DECL_SIMD_tanf "
+.LASF2281:
+	.string	"gps_frame"
+.LASF1772:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1974:
+	.string	"year"
+.LASF1848:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1400:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF1474:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1686:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2205:
+	.string	"groundSpeed"
+.LASF1710:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1770:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1674:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1677:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1361:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF796:
+	.string	"__DECL_SIMD_cosl "
+.LASF2025:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1573:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1097:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF1274:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF788:
+	.string	"NULL"
+.LASF2186:
+	.string	"dynModel"
+.LASF757:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF1124:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF2024:
+	.string	"RESOURCE_UART_TX"
+.LASF1993:
+	.string	"OWNER_SYSTEM"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1810:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1411:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1738:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF466:
+	.string	"__PMT"
+.LASF1535:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1483:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF697:
+	.string	"_CTYPE_H 1"
+.LASF1230:
+	.string	"USE_OPFLOW_CXOF "
+.LASF2038:
+	.string	"RESOURCE_RX_CE"
+.LASF1995:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1217:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF2139:
+	.string	"telemetry_baudrateIndex"
+.LASF2221:
+	.string	"GPS_LOST_COMMUNICATION"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1476:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF1022:
+	.string	"__DECL_SIMD_erff64x "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1751:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF1869:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF748:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF2112:
+	.string	"BAUD_250000"
+.LASF1651:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1981:
+	.string	"OWNER_FREE"
+.LASF975:
+	.string	"__DECL_SIMD_log2f "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF2154:
+	.string	"SBAS_EGNOS"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1024:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1910:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF1673:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF2034:
+	.string	"RESOURCE_ADC_CH1"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1687:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1805:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1067:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1816:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1864:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2187:
+	.string	"ubloxUseGalileo"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1419:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1278:
+	.string	"USE_VTX_TRAMP "
+.LASF1752:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF736:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1303:
+	.string	"_T_WCHAR "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1828:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF2148:
+	.string	"GPS_NAZA"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1482:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2242:
+	.string	"delayTime"
+.LASF1671:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2257:
+	.string	"gpsSetProtocolTimeout"
+.LASF1392:
+	.string	"UNIT_TESTED "
+.LASF828:
+	.string	"__DECL_SIMD_logf32 "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2184:
+	.string	"autoConfig"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1753:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF964:
+	.string	"__DECL_SIMD_log10 "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF873:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF2099:
+	.string	"ADC_CURRENT"
+.LASF1305:
+	.string	"_WCHAR_T_ "
+.LASF1658:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF2176:
+	.string	"gpsDynModel_e"
+.LASF2229:
+	.string	"autoBaudrateIndex"
+.LASF762:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF1424:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF872:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF476:
+	.string	"__P(args) args"
+.LASF1933:
+	.string	"ptWait(condition) do { ptLabel(); if (!(condition)) { return; } } while (0)"
+.LASF2265:
+	.string	"gpsRestartNMEA_MTK"
+.LASF1083:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1430:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1410:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF716:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF772:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1968:
+	.string	"uint64_t"
+.LASF1897:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1345:
+	.string	"USE_OLED_UG2864"
+.LASF1553:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF755:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1043:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1531:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1921:
+	.string	"GPS_SHORT_TIMEOUT (500)"
+.LASF1842:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2057:
+	.string	"serialBufChunk_s"
+.LASF712:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF990:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1462:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1840:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1198:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1663:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1517:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1615:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1912:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF1773:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1272:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF715:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF986:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1943:
+	.string	"ptSemaphoreWait(sem) do { ptWait(sem); sem = false; } while (0)"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF914:
+	.string	"__DECL_SIMD_cosh "
+.LASF824:
+	.string	"__DECL_SIMD_log "
+.LASF913:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF2177:
+	.string	"GPS_NO_FIX"
+.LASF818:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF790:
+	.string	"__need_NULL"
+.LASF991:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF720:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1154:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1232:
+	.string	"USE_PITOT_MS4525 "
+.LASF1135:
+	.string	"_Mdouble_ _Float32x"
+.LASF2243:
+	.string	"ptSemaphore_t"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF2098:
+	.string	"ADC_RSSI"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF1576:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2175:
+	.string	"GPS_DYNMODEL_AIR_4G"
+.LASF1098:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF880:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1544:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF848:
+	.string	"__DECL_SIMD_powf32 "
+.LASF2161:
+	.string	"GPS_BAUDRATE_57600"
+.LASF979:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2240:
+	.string	"returnCode"
+.LASF864:
+	.string	"__DECL_SIMD_atan "
+.LASF910:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1653:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1141:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1904:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1605:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1224:
+	.string	"USE_RANGEFINDER "
+.LASF1464:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF898:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1629:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1477:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF881:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1996:
+	.string	"OWNER_SDCARD"
+.LASF1187:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF984:
+	.string	"__DECL_SIMD_log1p "
+.LASF2166:
+	.string	"gpsBaudRate_e"
+.LASF766:
+	.string	"_STRING_H 1"
+.LASF1056:
+	.string	"__DECL_SIMD_tanl "
+.LASF911:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1873:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1252:
+	.string	"USE_LOG "
+.LASF1171:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1401:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1142:
+	.string	"__MATHDECL"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1571:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2275:
+	.string	"frameOK"
+.LASF1950:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1681:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1953:
+	.string	"signed char"
+.LASF1084:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1456:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF829:
+	.string	"__DECL_SIMD_logf64 "
+.LASF812:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1259:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF928:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF769:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1157:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1584:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1444:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1838:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1309:
+	.string	"_WCHAR_T_H "
+.LASF1694:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF2241:
+	.string	"startTime"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1871:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF1709:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2046:
+	.string	"SERIAL_INVERTED"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF1012:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1440:
+	.string	"sq(x) ((x)*(x))"
+.LASF808:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF2059:
+	.string	"count"
+.LASF1225:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1145:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1779:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1698:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2244:
+	.string	"gpsDataNmea_s"
+.LASF2251:
+	.string	"gpsDataNmea_t"
+.LASF1492:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1086:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF777:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1797:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1344:
+	.string	"USE_DASHBOARD"
+.LASF1279:
+	.string	"USE_VTX_FFPV "
+.LASF1188:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1530:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1547:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF976:
+	.string	"__DECL_SIMD_log2l "
+.LASF735:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF750:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF1824:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2130:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2131:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF1249:
+	.string	"USE_ANTIGRAVITY "
+.LASF2279:
+	.string	"string"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1374:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1372:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF1127:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1610:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2227:
+	.string	"state"
+.LASF1503:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1277:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1404:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1989:
+	.string	"OWNER_SERIAL"
+.LASF1037:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1287:
+	.string	"_ANSI_STDDEF_H "
+.LASF1172:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF2000:
+	.string	"OWNER_OSD"
+.LASF820:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2016:
+	.string	"OWNER_PINIO"
+.LASF1757:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1788:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1621:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF830:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1837:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF952:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF2015:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1319:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1191:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2056:
+	.string	"_dateTime_s"
+.LASF1179:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1428:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF2192:
+	.string	"hasNewData"
+.LASF1908:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1096:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF845:
+	.string	"__DECL_SIMD_powf "
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1200:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1613:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1519:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF821:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1730:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF980:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF1085:
+	.string	"__f32(x) x ##f32"
+.LASF2080:
+	.string	"rxIrqCount"
+.LASF721:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF1683:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1406:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF726:
+	.string	"isascii(c) __isascii (c)"
+.LASF2001:
+	.string	"OWNER_BARO"
+.LASF1161:
+	.string	"FP_ZERO 2"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1399:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF761:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1740:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1511:
+	.string	"IOCFG_AF_OD 0"
+.LASF2052:
+	.string	"SERIAL_BIDIR"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1562:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1333:
+	.string	"USE_UART8 "
+.LASF837:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1418:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1355:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1234:
+	.string	"USE_1WIRE_DS2482 "
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2129:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1743:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1351:
+	.string	"USE_PITOT_MS4525"
+.LASF1243:
+	.string	"USE_TELEMETRY_SIM "
+.LASF981:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF2023:
+	.string	"RESOURCE_TIMER"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF2208:
+	.string	"time"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2121:
+	.string	"SERIAL_PORT_USART1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF2123:
+	.string	"SERIAL_PORT_USART3"
+.LASF2124:
+	.string	"SERIAL_PORT_USART4"
+.LASF2125:
+	.string	"SERIAL_PORT_USART5"
+.LASF2126:
+	.string	"SERIAL_PORT_USART6"
+.LASF2127:
+	.string	"SERIAL_PORT_USART7"
+.LASF2128:
+	.string	"SERIAL_PORT_USART8"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2083:
+	.string	"serialTotalRxWaiting"
+.LASF1526:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1256:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF2219:
+	.string	"GPS_INITIALIZING"
+.LASF1433:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1960:
+	.string	"long int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1648:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF2228:
+	.string	"baudrateIndex"
+.LASF1292:
+	.string	"_PTRDIFF_T_ "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF977:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1537:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF1260:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF1342:
+	.string	"USE_USB_MSC"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF1013:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF940:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1666:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1990:
+	.string	"OWNER_PINDEBUG"
+.LASF1593:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF989:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1860:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2264:
+	.string	"gpsSetState"
+.LASF1906:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1911:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1219:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF383:
+	.string	"SITL 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1490:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1291:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF941:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1693:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1619:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1109:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1925:
+	.string	"PROTOTHREAD(name) static struct ptState_s name ##_protothreadState = {0, 0, 0, 0}; void name(void)"
+.LASF1725:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF1901:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1819:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1820:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2039:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1478:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF944:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1487:
+	.string	"EXPAND_I(x) x"
+.LASF1669:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1814:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF1760:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1961:
+	.string	"__uint64_t"
+.LASF1115:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1967:
+	.string	"uint32_t"
+.LASF2062:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF775:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1368:
+	.string	"U_ID_1 1"
+.LASF1700:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF2074:
+	.string	"rxBufferTail"
+.LASF1331:
+	.string	"USE_UART6 "
+.LASF1089:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF2236:
+	.string	"gpsState"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1734:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2160:
+	.string	"GPS_BAUDRATE_115200"
+.LASF974:
+	.string	"__DECL_SIMD_log2 "
+.LASF1591:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1349:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1317:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2217:
+	.string	"gpsStats"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1733:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF2021:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF962:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF714:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF993:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1979:
+	.string	"millis"
+.LASF774:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1090:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1144:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF1003:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2087:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF1032:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1934:
+	.string	"ptWaitTimeout(condition,timeoutMs) do { currentPt->startTime = (timeUs_t)millis(); currentPt->delayTime = (timeoutMs); ptLabel(); if (!(condition) && ((timeDelta_t)(millis() - (currentPt)->startTime) <= (currentPt)->delayTime)) { return; } } while (0)"
+.LASF1326:
+	.string	"USE_UART1 "
+.LASF489:
+	.string	"__flexarr []"
+.LASF1092:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1284:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1178:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1393:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1626:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1421:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1302:
+	.string	"_T_WCHAR_ "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1255:
+	.string	"CMS_MENU_OSD "
+.LASF1609:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1426:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF813:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF2090:
+	.string	"isConnected"
+.LASF1718:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1385:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1267:
+	.string	"USE_SERIALRX_SUMD "
+.LASF1991:
+	.string	"OWNER_TIMER"
+.LASF985:
+	.string	"__DECL_SIMD_log1pf "
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF1948:
+	.string	"NMEA_BUFFER_SIZE 16"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1595:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1792:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1210:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1768:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1204:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF723:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1913:
+	.string	"LAT 0"
+.LASF1922:
+	.string	"GPS_BAUD_CHANGE_DELAY (100)"
+.LASF1962:
+	.string	"char"
+.LASF1147:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF970:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1665:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1030:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1078:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1602:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1863:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1469:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF1749:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF800:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1377:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF967:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF884:
+	.string	"__DECL_SIMD_hypot "
+.LASF1598:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF738:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF1100:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2218:
+	.string	"GPS_UNKNOWN"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF932:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1545:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF924:
+	.string	"__DECL_SIMD_expm1 "
+.LASF2268:
+	.string	"ptYielded"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1262:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF799:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF971:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1397:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1577:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2120:
+	.string	"SERIAL_PORT_NONE"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1513:
+	.string	"IOCFG_IPU 0"
+.LASF1463:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF1266:
+	.string	"USE_RX_MSP "
+.LASF1728:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1479:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1314:
+	.string	"__DEFINED_wchar_t "
+.LASF395:
+	.string	"true 1"
+.LASF1763:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF801:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2167:
+	.string	"GPS_AUTOCONFIG_OFF"
+.LASF855:
+	.string	"__DECL_SIMD_acosf "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF779:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2255:
+	.string	"gpsProtocolStateThreadMTK_protothreadState"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2237:
+	.string	"gpsToSerialBaudRate"
+.LASF1703:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF841:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1038:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1214:
+	.string	"USE_PITOT "
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1459:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF1073:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1736:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF768:
+	.string	"__need_NULL "
+.LASF943:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF1439:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1580:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF936:
+	.string	"__DECL_SIMD_sinhl "
+.LASF741:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF1050:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF879:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF789:
+	.string	"NULL ((void *)0)"
+.LASF767:
+	.string	"__need_size_t "
+.LASF1035:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1011:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1485:
+	.string	"STR_HELPER(x) #x"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2224:
+	.string	"serialConfig"
+.LASF2051:
+	.string	"SERIAL_UNIDIR"
+.LASF2149:
+	.string	"GPS_UBLOX7PLUS"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1630:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1390:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF1791:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1927:
+	.string	"ptBegin(name) struct ptState_s * currentPt = ptGetHandle(name); bool ptYielded = true; (void) ptYielded; switch (currentPt->line) { case 0:"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1425:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1051:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF905:
+	.string	"__DECL_SIMD_exp10f "
+.LASF838:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1909:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1608:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1646:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1729:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1169:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2027:
+	.string	"RESOURCE_EXTI"
+.LASF1316:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2067:
+	.string	"options"
+.LASF1094:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1290:
+	.string	"_T_PTRDIFF "
+.LASF869:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1061:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF1004:
+	.string	"__DECL_SIMD_acosh "
+.LASF2179:
+	.string	"GPS_FIX_3D"
+.LASF1060:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1207:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1679:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF371:
+	.string	"__linux 1"
+.LASF710:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF1156:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1835:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1771:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1189:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1708:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1575:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1159:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1081:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1182:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF961:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1218:
+	.string	"USE_GYRO_KALMAN "
+.LASF917:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF2269:
+	.string	"gpsHandleMTK"
+.LASF1014:
+	.string	"__DECL_SIMD_erf "
+.LASF1175:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF2134:
+	.string	"serialPortConfig_s"
+.LASF2164:
+	.string	"GPS_BAUDRATE_9600"
+.LASF711:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF1691:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1866:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF742:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1874:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF1937:
+	.string	"ptDelayMs(delay) do { (currentPt)->startTime = (timeUs_t)millis(); (currentPt)->delayTime = (delay); ptLabel(); if ((timeDelta_t)(millis() - (currentPt)->startTime) <= (currentPt)->delayTime) { return; } } while (0)"
+.LASF1888:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2048:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1049:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1499:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF1432:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1685:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF703:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1008:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF925:
+	.string	"__DECL_SIMD_expm1f "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1706:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF831:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1415:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1497:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1841:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF2118:
+	.string	"BAUD_2470000"
+.LASF1212:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1019:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2202:
+	.string	"numSat"
+.LASF1186:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF756:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF1739:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF1282:
+	.string	"USE_CLI_BATCH "
+.LASF1782:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1970:
+	.string	"double"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1638:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2247:
+	.string	"altitude"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF857:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF764:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF1493:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1246:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1920:
+	.string	"GPS_TIMEOUT (1000)"
+.LASF701:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1113:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF1543:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1461:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1496:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1566:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF704:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1027:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1031:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1306:
+	.string	"_BSD_WCHAR_T_ "
+.LASF902:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1449:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1194:
+	.string	"I2C2_OVERCLOCK false"
+.LASF2006:
+	.string	"OWNER_RX"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2248:
+	.string	"speed"
+.LASF2222:
+	.string	"gpsState_e"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF2153:
+	.string	"SBAS_AUTO"
+.LASF1174:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1834:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1682:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1958:
+	.string	"__int32_t"
+.LASF1101:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1168:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF1959:
+	.string	"__uint32_t"
+.LASF865:
+	.string	"__DECL_SIMD_atanf "
+.LASF423:
+	.string	"__USE_GNU"
+.LASF908:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1042:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF2203:
+	.string	"magData"
+.LASF1795:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF2250:
+	.string	"date"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF939:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2215:
+	.string	"baudRates"
+.LASF1565:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1437:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1356:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1318:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1585:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2114:
+	.string	"BAUD_921600"
+.LASF2267:
+	.string	"currentPt"
+.LASF2091:
+	.string	"isIdle"
+.LASF1257:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1997:
+	.string	"OWNER_FLASH"
+.LASF856:
+	.string	"__DECL_SIMD_acosl "
+.LASF1875:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF1569:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2133:
+	.string	"serialPortIdentifier_e"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1861:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2194:
+	.string	"validVelNE"
+.LASF1774:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1199:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1223:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF2078:
+	.string	"rxCallbackData"
+.LASF1110:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1240:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF992:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2136:
+	.string	"msp_baudrateIndex"
+.LASF705:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2072:
+	.string	"txBuffer"
+.LASF1276:
+	.string	"USE_VTX_CONTROL "
+.LASF751:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF851:
+	.string	"__DECL_SIMD_powf32x "
+.LASF785:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1786:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1628:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF882:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1286:
+	.string	"_STDDEF_H_ "
+.LASF1524:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2246:
+	.string	"longitude"
+.LASF874:
+	.string	"__DECL_SIMD_asin "
+.LASF1891:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1560:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1645:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1761:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1143:
+	.string	"__MATHCALL"
+.LASF968:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1931:
+	.string	"ptGetReturnCode(handle) ((handle)->returnCode)"
+.LASF1769:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1036:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2173:
+	.string	"GPS_DYNMODEL_PEDESTRIAN"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF2226:
+	.string	"hwVersion"
+.LASF728:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF1604:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1253:
+	.string	"USE_STATS "
+.LASF1324:
+	.string	"USE_MAG "
+.LASF2014:
+	.string	"OWNER_AIRSPEED"
+.LASF1678:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1190:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF2141:
+	.string	"serialConfig_s"
+.LASF2144:
+	.string	"serialConfig_t"
+.LASF1021:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF994:
+	.string	"__DECL_SIMD_atanh "
+.LASF807:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1315:
+	.string	"_BSD_WCHAR_T_"
+.LASF1916:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1382:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF1926:
+	.string	"STATIC_PROTOTHREAD(name) static struct ptState_s name ##_protothreadState = {0, 0, 0, 0}; static void name(void)"
+.LASF2210:
+	.string	"lastMessageDt"
+.LASF906:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1766:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1434:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1742:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1631:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1744:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1293:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1304:
+	.string	"__WCHAR_T "
+.LASF2110:
+	.string	"BAUD_115200"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1721:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF2081:
+	.string	"serialPortVTable"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF923:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1690:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF885:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1634:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF819:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF2042:
+	.string	"MODE_RXTX"
+.LASF1162:
+	.string	"FP_SUBNORMAL 3"
+.LASF2043:
+	.string	"portMode_t"
+.LASF1080:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF1137:
+	.string	"_Mdouble_ _Float64x"
+.LASF1973:
+	.string	"timeUs_t"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1367:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF963:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF849:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2253:
+	.string	"gpsProtocolReceiverThread_protothreadState"
+.LASF1776:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF815:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2163:
+	.string	"GPS_BAUDRATE_19200"
+.LASF1515:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF2254:
+	.string	"mtkBaudInitData"
+.LASF1762:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2100:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1839:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF871:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1193:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF899:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF1963:
+	.string	"int16_t"
+.LASF1435:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF895:
+	.string	"__DECL_SIMD_exp2f "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF811:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF2101:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF1093:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1417:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2180:
+	.string	"gpsFixType_e"
+.LASF1064:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2061:
+	.string	"serialReceiveCallbackPtr"
+.LASF1858:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1248:
+	.string	"USE_D_BOOST "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF949:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF727:
+	.string	"toascii(c) __toascii (c)"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF2104:
+	.string	"BAUD_2400"
+.LASF1128:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1542:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1817:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF2282:
+	.string	"checksum"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1395:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1017:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1423:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1283:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1383:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1338:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF2190:
+	.string	"gpsLocation_s"
+.LASF2191:
+	.string	"gpsLocation_t"
+.LASF2035:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2036:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2037:
+	.string	"RESOURCE_ADC_CH4"
+.LASF922:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF929:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1704:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1723:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1724:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2053:
+	.string	"SERIAL_BIDIR_OD"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1033:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF904:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1075:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF2213:
+	.string	"packetCount"
+.LASF918:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF892:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF1009:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1465:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF809:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1273:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1233:
+	.string	"USE_1WIRE "
+.LASF870:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1025:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1818:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1057:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1712:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF713:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF2063:
+	.string	"serialPort_s"
+.LASF2095:
+	.string	"serialPort_t"
+.LASF1983:
+	.string	"OWNER_PWMINPUT"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1082:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1659:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2102:
+	.string	"BAUD_AUTO"
+.LASF2084:
+	.string	"serialTotalTxFree"
+.LASF2266:
+	.string	"gpsHandleNMEA"
+.LASF802:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1484:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1745:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1391:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1339:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF866:
+	.string	"__DECL_SIMD_atanl "
+.LASF2054:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1917:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF1448:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF1045:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1472:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF1946:
+	.string	"FRAME_GGA 1"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1294:
+	.string	"___int_ptrdiff_t_h "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1559:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF997:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF732:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF1020:
+	.string	"__DECL_SIMD_erff128 "
+.LASF903:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2108:
+	.string	"BAUD_38400"
+.LASF1942:
+	.string	"ptSemaphoreInit(sem) do { sem = false; } while (0)"
+.LASF1852:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF937:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1582:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF1205:
+	.string	"USE_BLACKBOX "
+.LASF1453:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF858:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1443:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1533:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF945:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1899:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1209:
+	.string	"USE_TELEMETRY "
+.LASF846:
+	.string	"__DECL_SIMD_powl "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1635:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1504:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1508:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1028:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1202:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1237:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1815:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1340:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1131:
+	.string	"_Mdouble_ _Float64"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1363:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF722:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF1802:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1784:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1138:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF782:
+	.string	"__DEFINED_size_t "
+.LASF1467:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1540:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF740:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1836:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2068:
+	.string	"baudRate"
+.LASF2031:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF1994:
+	.string	"OWNER_SPI"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF2047:
+	.string	"SERIAL_STOPBITS_1"
+.LASF1447:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1747:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1807:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF759:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1656:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2079:
+	.string	"rxFrameCallback"
+.LASF1244:
+	.string	"USE_FRSKYOSD "
+.LASF2050:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1612:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1348:
+	.string	"USE_RANGEFINDER"
+.LASF1460:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1015:
+	.string	"__DECL_SIMD_erff "
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF724:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1185:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1758:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1643:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1334:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF886:
+	.string	"__DECL_SIMD_hypotl "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF797:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1268:
+	.string	"USE_SERIALRX_SUMH "
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2207:
+	.string	"hdop"
+.LASF1952:
+	.string	"long unsigned int"
+.LASF1516:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF2004:
+	.string	"OWNER_LED_STRIP"
+.LASF1775:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF765:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF1327:
+	.string	"USE_UART2 "
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1915:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2011:
+	.string	"OWNER_COMPASS"
+.LASF1407:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF954:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1715:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1892:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF2274:
+	.string	"gps_Msg"
+.LASF2284:
+	.string	"mult"
+.LASF1767:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF816:
+	.string	"__DECL_SIMD_sincosl "
+.LASF730:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1883:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1099:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1956:
+	.string	"short int"
+.LASF2082:
+	.string	"serialWrite"
+.LASF2198:
+	.string	"validTime"
+.LASF2261:
+	.string	"GPS_coord_to_degrees"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1667:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1688:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF896:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1328:
+	.string	"USE_UART3 "
+.LASF1452:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1111:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1387:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1195:
+	.string	"USE_I2C_PULLUP "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1534:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1717:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1481:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF770:
+	.string	"__SIZE_T__ "
+.LASF1412:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1275:
+	.string	"USE_RCDEVICE "
+.LASF1362:
+	.string	"USE_RCDEVICE"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2113:
+	.string	"BAUD_460800"
+.LASF935:
+	.string	"__DECL_SIMD_sinhf "
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1350:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1403:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1617:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1445:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2109:
+	.string	"BAUD_57600"
+.LASF1951:
+	.string	"unsigned int"
+.LASF1329:
+	.string	"USE_UART4 "
+.LASF888:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1924:
+	.string	"GPS_BOOT_DELAY (3000)"
+.LASF1053:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1269:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1695:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1158:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1518:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF2233:
+	.string	"lastMessageMs"
+.LASF1787:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF2271:
+	.string	"gpsProtocolStateThreadMTK"
+.LASF955:
+	.string	"__DECL_SIMD_atan2f "
+.LASF814:
+	.string	"__DECL_SIMD_sincos "
+.LASF2262:
+	.string	"strcmp"
+.LASF1825:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1026:
+	.string	"__DECL_SIMD_tanhl "
+.LASF2272:
+	.string	"gpsProtocolReceiverThread"
+.LASF1263:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF1938:
+	.string	"ptDelayUs(delay) do { (currentPt)->startTime = (timeUs_t)micros(); (currentPt)->delayTime = (delay); ptLabel(); if ((timeDelta_t)(micros() - (currentPt)->startTime) <= (currentPt)->delayTime) { return; } } while (0)"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1923:
+	.string	"GPS_INIT_DELAY (500)"
+.LASF1420:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1988:
+	.string	"OWNER_ADC"
+.LASF907:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1737:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1222:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF805:
+	.string	"__DECL_SIMD_sinf "
+.LASF1265:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF957:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF840:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF2249:
+	.string	"ground_course"
+.LASF1843:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1654:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2225:
+	.string	"gpsPort"
+.LASF1793:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1330:
+	.string	"USE_UART5 "
+.LASF2287:
+	.string	"gpsNewFrameNMEA"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF2201:
+	.string	"fixType"
+.LASF2280:
+	.string	"checksum_param"
+.LASF2026:
+	.string	"RESOURCE_UART_TXRX"
+.LASF1102:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF1046:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1564:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1346:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1396:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1607:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2206:
+	.string	"groundCourse"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1568:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1376:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1851:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1297:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1409:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1731:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF1173:
+	.string	"M_E 2.7182818284590452354"
+.LASF2200:
+	.string	"flags"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1335:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1040:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1652:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1978:
+	.string	"seconds"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF946:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1657:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2361:
+	.string	"io_types.h"
+.LASF2347:
+	.string	"mathcalls-helper-functions.h"
+.LASF2339:
+	.string	"math.h"
+.LASF2326:
+	.string	"long-double.h"
+.LASF2336:
+	.string	"__locale_t.h"
+.LASF2349:
+	.string	"platform.h"
+.LASF2348:
+	.string	"mathcalls.h"
+.LASF2291:
+	.string	"src/main/drivers"
+.LASF2357:
+	.string	"axis.h"
+.LASF2341:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2320:
+	.string	"libc-header-start.h"
+.LASF2301:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2333:
+	.string	"endian.h"
+.LASF2305:
+	.string	"stdint-intn.h"
+.LASF2351:
+	.string	"target.h"
+.LASF2353:
+	.string	"common_post.h"
+.LASF2300:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2303:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2310:
+	.string	"adc.h"
+.LASF2295:
+	.string	"src/main/target/SITL"
+.LASF2312:
+	.string	"gps_private.h"
+.LASF2293:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF2345:
+	.string	"fp-logb.h"
+.LASF2299:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2364:
+	.string	"config.h"
+.LASF2362:
+	.string	"io_def.h"
+.LASF2338:
+	.string	"strings.h"
+.LASF2322:
+	.string	"features-time64.h"
+.LASF2304:
+	.string	"types.h"
+.LASF2340:
+	.string	"math-vector.h"
+.LASF2343:
+	.string	"floatn-common.h"
+.LASF0:
+	.string	"./src/main/io/gps_nmea.c"
+.LASF2342:
+	.string	"floatn.h"
+.LASF2324:
+	.string	"timesize.h"
+.LASF2318:
+	.string	"stdbool.h"
+.LASF2302:
+	.string	"/usr/include"
+.LASF2313:
+	.string	"protothreads.h"
+.LASF2288:
+	.string	"src/main/build"
+.LASF2352:
+	.string	"sanity_check.h"
+.LASF2367:
+	.string	"runtime_config.h"
+.LASF2321:
+	.string	"features.h"
+.LASF2350:
+	.string	"common.h"
+.LASF2329:
+	.string	"typesizes.h"
+.LASF2289:
+	.string	"src/main/common"
+.LASF2309:
+	.string	"serial.h"
+.LASF2290:
+	.string	"src/main/config"
+.LASF2315:
+	.string	"gps_conversion.h"
+.LASF2330:
+	.string	"time64.h"
+.LASF2306:
+	.string	"stdint-uintn.h"
+.LASF2296:
+	.string	"src/main/target"
+.LASF2359:
+	.string	"utils.h"
+.LASF2314:
+	.string	"gps_nmea.c"
+.LASF2297:
+	.string	"src/main"
+.LASF2358:
+	.string	"maths.h"
+.LASF2344:
+	.string	"flt-eval-method.h"
+.LASF2308:
+	.string	"resource.h"
+.LASF2365:
+	.string	"rx_pwm.h"
+.LASF2307:
+	.string	"time.h"
+.LASF2355:
+	.string	"debug.h"
+.LASF2331:
+	.string	"wchar.h"
+.LASF2346:
+	.string	"fp-fast.h"
+.LASF2366:
+	.string	"stats.h"
+.LASF2311:
+	.string	"gps.h"
+.LASF2292:
+	.string	"src/main/fc"
+.LASF2360:
+	.string	"io.h"
+.LASF2327:
+	.string	"stubs.h"
+.LASF2298:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2316:
+	.string	"string.h"
+.LASF2325:
+	.string	"cdefs.h"
+.LASF2335:
+	.string	"locale_t.h"
+.LASF2319:
+	.string	"stdint.h"
+.LASF2354:
+	.string	"build_config.h"
+.LASF2337:
+	.string	"stddef.h"
+.LASF2328:
+	.string	"stubs-64.h"
+.LASF2332:
+	.string	"ctype.h"
+.LASF2323:
+	.string	"wordsize.h"
+.LASF2363:
+	.string	"io_def_generated.h"
+.LASF2294:
+	.string	"src/main/scheduler"
+.LASF2356:
+	.string	"parameter_group.h"
+.LASF2334:
+	.string	"endianness.h"
+.LASF2317:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`\233\002\205\n"
+	.string	"\244\n\217\003"
+	.string	"\026"
+	.string	"\243\273\227\315\b\006\002"
+	.string	"\001\322\256\261\357\007\252\001\002"
+	.string	"\002\002\003\002\004\005\002\004\001\002\004\002\006\007\006\007\002\b\004\002\001\002\t\n\002\t\006\005\002\t\013\007\t\006\352\263\360\321\b\003\004\005\240\342\234\212\n\006\007\b\013\220\353\235\371\b\020\002\003\002\f\r\002\016\005\002\005\f\350\261\325\313\007\016\017\264\216\200\261\017|\017\002\016\002\020\002\021\022\002\016\002\023\002\024\002\007\002\025\026\002\027\030\031\002\021\032\005\005\020\023\246\354\375\327\017\024\245\223\222\314\013.\025\026\364\200\230N"
+	.string	"\027\030\357\375\377\340\f\004\031\032\254\231\365\245\n\016"
+	.ascii	"U\250\320N*H\fi\f\200\202bD\325\001\022\200\3431\224\211\fB\b"
+	.ascii	"\031\ff\266\264Z\277\003\227\242\026\247\013\350'\3122\331'G"
+	.ascii	"\177\377C +i\201\024[\220\032$\007\321\020v\363\330\202\017~"
+	.ascii	".\243\013:\347LB'\214\321\034<<\3463\2142\207\021\200\305\310"
+	.ascii	"\365\370v\3660,'\327#\205\372\261rG'Q\310\267\305\241!\233-\361"
+	.ascii	"wO[I\367T2\261\302\240\026\022v\rm<\343\277%\006m|\255\016\276"
+	.ascii	"\016\332\230\272L\311\256~\\\247\315\267k\037\330\227\351>\343"
+	.ascii	"9\256\235\251'I\r\241t"
+	.text
+	.section	.gnu.lto_.ipa_sra.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375 \264-\002"
+	.string	"\340\250"
+	.string	"\n"
+	.string	"\002"
+	.string	"\003\001\001\003\013"
+	.string	"\001\017"
+	.string	"\001"
+	.string	"\001"
+	.string	"\024\026\027\030\031\032"
+	.string	"\001"
+	.string	"\022"
+	.string	"\200\204%"
+	.ascii	"\304\241\004\203\031\204\247\001\226C\320\234\262\214*,v}sw\360"
+	.ascii	"$&\007`\346_\2265\200#0\300\002"
+	.text
+	.section	.gnu.lto_.inline.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`\271\003U\017"
+	.string	"\006\227RA"
+	.string	"S\225\306H\344\361\220r'O\214:\007q\364\377LM\034/i\324\237\305\366=\252"
+	.string	"\273\2417\017\006j\243$M\322$ \323X\270K\267\372UUU\003\272bT\240\204}\223\317\241\265\007\331R\246?"
+	.string	"A"
+	.string	";"
+	.ascii	"\013\242G!\2149K\232\322z\255\250w\236\221\224\207\207\227\214"
+	.ascii	"\270\345\016\3720\311\201![\327\221\356\256*\276Ic!@\214\370"
+	.ascii	"d\177G3\377d\020;zJ=MP\304\247b\007\347/g'\002\2325!\270\273"
+	.ascii	"\251\370\366\326@oh\200\305\320"
+	.string	"9\313:\200?z\224\240\342\334\266s\241U67\327\251HH\005\ni\342m\357v#!~\204\335Ey4AZ\300X\254H\217\236~\005\t>\231\277d'\371-\340S\244_\211\257\025\277\0047\265\032A\240\237&\375\240\203\204u`Lj0\327\271\317d /\327^\203\377\271\272\331ZV\263\"H\262\213\342\254\255\215`\b\f\022)\322uw\320\305\356\006\320\313\034\003\235\322\230p\001\205\246B)\211io\n|.\t\262v\027\300\004Z\257\021\221\370$\b\222bc\006\247\031\\*5~\361\200A\336 O\307\350\020%v\262\242\236J\007\016j\341\001\334\200\303$A\250aAbF\202\nJAAi\241\260\034p\0021Cu\035\022 \0245I\363\2341\301\314\004\023M\354\344\233P\241\315\020\355\315\217\224=\006\252\266m\023t\206\n\317\301\214\003\270b\344\306\025o\340%Z\326\343B\250\220<\222(\027"
+	.string	"\356\036\267\340d\276c\342\346\325L> 7e\300\300!\f\237\200:"
+	.ascii	"m\356\316<]\222\352z:\240\303M\274\345.*f\273\027\003\031\327"
+	.ascii	"pw(\314\006\241d\214\262\352\353\364\316y\224Dp\322\023\215N"
+	.ascii	"\224\006\0303]\004{O\312\240\300B\360&"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`h\005\035\r"
+	.string	"FP:6`U\223\016!(u,c\217\264\035\214\256\006AJ$\2444\203\177I\020@*\214\031\006\204Py\270J#{,\266\205Z\316\221\376]\247I\n\322\t7\332[\246\024'"
+	.string	"&"
+	.string	"/"
+	.string	"\246X\3116Gy\255\326{~\216S\236Oy\373\250\006\270\003\371\016t{\027\226\266\377\nK\275\264\372\327\223A\354"
+	.ascii	"\214Q\350\324\343\355\332\256\350\351\332\002"
+	.string	"\221J\242\213\221\262O\332\332\262{\003x\207\337w\374\237\333\267|\351\257\367_o\037\034\354\371\322Hl\260g;\001\341\340!7pk\247\032\021\367\217\027l\255\265\336YlH\3313~Q1\321\361H\331\025\351G\312$\223\346\242P\236(\207Y\211\022Fx\271x\242\254\206\007\t-\t1+\023\312\230\261$\224\321\032\360D]s\2422\263\022\243\204q\316\210\216\206\303@\200\301\260MQ\250\001M\250\314\266\240\244Ph7\300\002\231\233\215\033\022`2!\214\3438\022\"1c\2140\204\004\306\b&\240\230\231\320\370\340\367|\025?j\013\211\b\326)\244\201q\017\326\276\034b \355\311\002\211\365e\201\361\234(\321\2276g\233(\367[ cp\256\221t\263\263\233\022|U^\375D\275-\033C\247\367\262UA\364\327\307\342\242\005\027\243\037\034\320\3543\275\033\206`\346'\277S\305\001F\310\025f\034\\0_"
+	.ascii	"\336\n\007i\f\243\022\346\214V*B\307z%hf\357d\312#~\375<\220"
+	.ascii	"\356\26794\256\253=\267\030\357r:\306\313\271\331\256\0019\276"
+	.ascii	"\376\213\024"
+	.text
+	.section	.gnu.lto_.pureconst.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\037"
+	.string	""
+	.string	""
+	.string	"\n"
+	.ascii	"\232\004\001\230\004\013\270\004\017\271\004\024\271\004\026"
+	.ascii	"\230\004\027\230\004\030\230\004\031\230\004\032\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`\206"
+	.string	"\025\005"
+	.string	"\222\007\027\"\200K\322\001\310\220\t\231\220\t\231Pe`\006\346\026Hl\333\326ulU\210\204\321\024bG\333v\222)\214\305\024&D\fp\320\025\347\271\331i\236\231\035fw\331Y.+;\312\316pMv\2222\035P-\254\213\236\321.\362\204\224\356\361t\354\032\317\364\204\247\n>\220g\007\256\023\034"
+	.ascii	"Q\r\274\221P\264\f\200u5\207qf\r\353\031X\215\365\332\314\276"
+	.ascii	"\342\f\002E<x\303\003 \034 v\307\362:\324\212hY\023Ix\n\366 "
+	.ascii	"nW\247\257\252\2155\325.e\273\305X\035\361\005\030\002"
+	.text
+	.section	.gnu.lto_.lto.3410eeed5302ff03,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_grab_fields.30.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`\311\004\245\037"
+	.string	"F9\310J\260\324Q:Y\"\247\034\\$\210\221\001\335+\016+d\216\275f\371\217\247qhw\035H\316S\3709\221\f\264\346\227\356E\034=@X\303\373\306\316\316\036W\222\313\255B\275\002\345\255yP0q\371\325\207\366\177B6!R&\031\266"
+	.string	"\250"
+	.string	"\261"
+	.string	"&N/g\344]\004;C\347\341a\273V&'\020\314\2237Xr\230w\257\343;\206>\374p\227Z\237~`\325:<\260\004\314\223;4\217\3439\206\2267\016a\004cN?_\325\225Z\2079\233\013\240'\307\277\320\223\375bc\314\273,\0063KJ\216\315\274=\321e[@\024F\034\273q\221\264t\330\267\200'\210\2771o\232\222\224^n\001\225F\033\376\005}LM\234\034\035\0201\201D\013\202\0309\306\223\256\327"
+	.string	"\242\340q,\300t\244\004-x4\nX\342\024E\026\354q\237x\322\t\251\253)i\351\\>\250\265.\207\b&}g\337\335\254\335\235\260;\252\b\253s J\353\335\324\223\036{\355\354\244\321\\-\240\274\272\205V\r\370\\q\036=\325\035\260(\342,KS\234\370\bK[\225\263\354\016\211\270\205\273/\2405\303j\373i\227fF\346<\376\030\334\207?\314\362\276\334N\365u\261\375\374\326J^\032\363\002\240\2743\222WF\362\306L^\230\311k\226\274%\363R\312K2\357Hy\233\344e\222\3675\364\310\022\230&\265\"\025\265T%\244\220\031\247\372\317\363\356\320\276\352\304\225\341"
+	.ascii	"O\236M\317V{N#\240$\230'q\224rN\3053\211\200&q\212\304\224Z\207"
+	.ascii	"\006Nn\204\261\346+\337W\321\020*\304(\\e\013\367\304\233W\242"
+	.ascii	"\230H\\\357\330\266\256\365\017v\035\205\365n\n\311\261\256\243"
+	.ascii	"f\303\3126"
+	.string	"\273\221\370\276\366W; \263\354\377\226\310\206i\332?\262Qk\262\271\312\3675;\203\310\364\251n\023;\217\336Z\246\317uT\303\210\213\027q\356\250\365\203\242&HE\214\320\026\002\321\375\025\007\240\0010d\354?\320\2235N\252t\303\364\330\314\344\310\006w\367q\375\230~\363\026\337W\021\0277\300\211\243E\017\243,\262\205{\0174\246\337D;\245p\375\3636E\347Q[\343\372V\216\230\214\270\270\2643\352/\264\264\254\214-\f=\377\361\021j\241\f\033|\306\335a\220`\201\202\005;\nt\002\360\354\202zyt*\\\360\321@!\350\007CN\327\223\323\320S\301'\307\263\013\312\351\340V\367sa\227\023\322\351v9\331\260\276\237\226c\267\376\221J2\336\372\304\303\240\244t\230\267\372\313Ks\033\365\220\2150\227\356@C\312\255\177\245\027\214\246\333\007\337\352\266\376\0019\255\2775\005\245\307^\026h\263\206i"
+	.string	"\266\23653\031\273\232l\315Y\366\366\261\326Zc4>^k\232\232s\005w\226\020\353\006\354I\212\251\234i\241\250/*\323.\375\243\235Gk\275\233J\322c\257,\227>\2259S+\026\213X\347QY\317\310t\254e\001c\250A$\345\020s\n\021\211\210\220\246\240\2301\200\002\221\252\243\007\020hX\332f3\033)\301\326\204!k\366\214\230&1\301\214\337{\023,3\262\347V\260_\276\355\373+K&\233u\365\253\367\327\364\246\360c_k\345\244N\361\3161\237\"`\020\ba"
+	.ascii	"?^\036\311$\202\033I\353\n\355q\374\275\n\375'\033\022]\2243"
+	.ascii	"\r\253A1Ye\003>\207\240\330\020\326\201?\213\302\367=\310\267"
+	.ascii	"\341*\346\341\314\264\343\2420\003\002\\\201R:,\305\235\330\312"
+	.ascii	"Y)a\360\330\302E\316\246\240\253\225\024\370uU\226\013P\231b"
+	.ascii	"}\371\005\301h\327w\030T\361\367\016-\230[H\321\216\245\341-"
+	.ascii	"\353\355\005\327&\253\bS\330\215\036\212 \t\363\202\242)\023"
+	.ascii	"\245\177"
+	.text
+	.section	.gnu.lto_gpsNewFrameNMEA.31.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`\200'\215\215"
+	.string	"J\327\234/I \020\333\031\003S\353\365\013^\261*\361j7S\240Y\230\364\321\366\005\362\343\226\370\021\300\336\230\201|\222\034\n\327\002\271\200\301l\274\0245\357\223\356\270\356\367,\021\013u\270Q\005f\214\261g ,n\315\230\020)eJ)\005\311\002\272\002\362\002A\3161\220\3160\220\316\f\270\316/\336y\201wV"
+	.string	"\351\234"
+	.string	"\322y\313uF\340\235\017xg\003\220\316ZH\347\002\\g\027H\347\254wn\361\316\004\274\363"
+	.ascii	"\354,@\353\034@\353\f\200\353\314\302u^\321:\253h\235\261Z\347"
+	.ascii	"+w\266j\235S\2743\212w>\321:\233x\347\252w\246r\347\022\255\363"
+	.ascii	"T\353,\325:G\265\316P\255\363S\353L\302uvB:7\271\316LH\347\021"
+	.ascii	"@\316\"\200\234\227\200\234\225\\\347$\327\031\351\235\217\\"
+	.ascii	"\347\244\353\034\002\351\f\002\351l\344:\027\265\316\037\\g\""
+	.ascii	"w\036zg\241w\366\340\316\035\336\231\203\353\034\364\316@\357"
+	.ascii	"\214tg\367\235[\327\371\247u\366y\347\343;\033\337\231}\347\265"
+	.ascii	"uV\337\371[g\3573LtjiWRx\030\234o\223i\ro\234\265\017\256\315"
+	.ascii	"\364\217op\037?\272\321Yo\273^\335\207\271\227\240Q\334N\356"
+	.ascii	"3\374\263\304\306\214\227R\230\363mBdL\224n\317\326\261\327f"
+	.ascii	"\376\200\373\216\177\226\304\242\230\355\274\216\357\027c\336"
+	.ascii	"\025\301:\357\353\224\352\225[(\031F\2757\335\027\377\373\252"
+	.ascii	"\255a\363\276o\t~:\366\312\314\214\342\352\003V\266\323\255\211"
+	.ascii	"q\f\272\304\333\363\276\316\252\317\322\312f\261B\005\326\225"
+	.ascii	"U\n\024'LTQ\225\230\222\212\202z\"\341\324\3044B\304\222R\022"
+	.ascii	"\322Q2\004\b\243\242\017DCB\036:p\b\002B\272\355\317\006\237"
+	.ascii	"\243\221]\325w%\267:F\r\"\323,\254Y\254\330\343*\216\314\340"
+	.ascii	"X[Y\022\373\312\230e\225\"\304\362\215\2356'\317F\021\203\237"
+	.ascii	"\220\201\320M\030\263bdQc\247\315IaWQ\301\351\022jT\2356zZN\331"
+	.ascii	"\033u\250\211\027\346\240OEWx\276\024\035A\217\202R\241\237\002"
+	.ascii	"Sp\022N\320n\342;\263\347L\205=BU:\323Kr\312\236'\270\b(\275"
+	.ascii	"d\314\202\322Jk\324x\222!\222\fG\321\344`\b\273:\272n++\303\266"
+	.ascii	"/\310U\341\245\266\262\273\025\304\236\321\252\007\246\310\267"
+	.ascii	"\354\241\233\373@d\314\032\362\262\024W\326\305\205<l\361\016"
+	.ascii	"Mo`8\004\251Qj+@i9ew\352\020\013W\350t\\\231\233\003\311hV\261"
+	.ascii	"\323\346\344\256\221sc\340\270hy[Sc\215L\322\346|\\2V\330!-\177"
+	.ascii	"[\272\255\354\356\333\245\237\264\rU\320\334\007\250\205\032"
+	.ascii	"\354\2649I\353#\025#\322l\031Wv\346\254\234\2624U\311\225\230"
+	.ascii	"\221\371\332b\211\255\032\263\356zD\033=h`\3203\203\322\217d"
+	.ascii	"\203\331\230\036\033\364\276o\267\225\031\252n\314z\337\227\235"
+	.ascii	"i\346\244\031\200fVs0\363\017\346\021Z\002\3078\344O\275\331"
+	.ascii	"1\351\225i>7\275 \277\376b\335\367)\207\373:zq\237\004a\037\222"
+	.ascii	"\336\\Y'\365J\210\003\204\244\027\246}f\027\316E\313\311\355"
+	.ascii	"}_,v-\276\345\200\016\266\266\330^\327<\314\303\237oCx;\335\315"
+	.ascii	"\263\274\200\341\315\374\371n\303v\344\303\030IO\216I\327xY}"
+	.ascii	"\023\035\001y\205\035\213\317\223\215]\204\243\032+\354j\306"
+	.ascii	"-Q\2721U\330\321X/S\330\317V-P\330\243\250kf\354N\330\360\370"
+	.ascii	"}\204\004\355K\023\366%"
+	.string	"L\232g\352\203\360E&\322C[6\r\347\236:a.\215\372\323\202\202\253\204}\211\367Q\027'\335\030\007\201=I\367\221\013\275\314\346\222:N\306\314\206]\366:_(\325\027\371\210\317\373\234!\365\246\264\356a\323\366}\337\237\343\277\335\224\207\264\206\343w\236\243\361\373\205D\n\020\365\030\277\203\017K\251\217\027{\230D\224\227h\342}\337#\373\257\245\216\r\303B\366[\260\215\337d\251^\277\343\212\274\235\035\003\215\343\373\2225\263\306\221l\006\211^\333\331\321\033\307\367\025k&\f\354\200\ro\346\3727\330\220|\030\013\345!\272\320\343(\212G(/O\213\351t\312~S\375nCCx\304i`9\352\177 <\273\363\3052\263\007\r\347k(\372\276\357\n\356\301~\023\0017\227^\031\310\215\033l\257Hnx\374\377{\271(\350?Dxf\207\257\333\274\301\265\373\337\367\rS\221y\202\201]\201\200C\210\334"
+	.ascii	"\3214\267\233\376\363\342\346\302Epx3{\345\306\301"
+	.string	"\366:\024\305#\346SF\346\375\365\263\215}q\302\\\312\323\351t\372\337d\346\276)(7\0336l\304\2501\303\023\270\367\330\360\3104\343USC7\346}_(\2753\267\277\330<n5l\370x)l\350/\266Wv\346\273d~i<~\337\260Vc\303\243\333\213\342\216\355\205\352\325\310+-}\221\215l\350\344\274d<o\216\333\213m\273\016\200M\314\025\331(F\216P\231\262\304\303\327\025\231\235a\375\323\351T\321\277\311\334?\235N\025\371\2610\263s\233i3\315\315\246:\367\232\352\334j\252s[Q\235;\255\351\272\215\250\316ETg\"m\327<\244\355\232\205\264\316]\255s\220\326\031\310;o\320:\377h\235}\270\316=\\g\r\220\316\031 \2351@:\363h\235/p\235w\270\316\026\264\316:\\\347\n\\\347\034\2553\005\2563\016\327y\202\326\371\206\353,\201\353\034A\353\f\201\353l\303u~"
+	.string	"\351\354"
+	.string	"\322\271\001\327\271\206\353\314\345:\323\br\236\201t\226\021\337\207u\277F\251F\200w\232\013 \312\233\340\225\024M\363x\312)T\224hhl\257\252\224\031\346\317x\035\337L"
+	.ascii	"o\365f\307WB\333u?aK\362\205y\272F\306\031\331\304@\247\276\311"
+	.ascii	"w\354K\226k\276\216=\t\225/\177\005\200'\003\300\373\234\201"
+	.ascii	"a\361c\224pH\321\022z\305\263\370\325\312\223\240\204;~\334\313"
+	.ascii	")\327\224\"(\257(\257\260\275\256x$B;\"\2765)\250V{$\235\235"
+	.ascii	"7O\275\366ET|Q\361IV\330\276\315\264R\221'\362\315\366\277w\214"
+	.ascii	"b\323^,\326\267\032\326K\315a\241\326\264\027{\365\275\366I\251"
+	.ascii	"\325_\375S\341\372\364Mv\247N{oj+O\344\225\360\bmU\342\271l\261"
+	.ascii	"\372\306\243\222x\267N\361\235\206\342S\3148\361(>\211w\342C"
+	.ascii	"\314q\247\240\366bM|[\251z\023\237\224.\027\025\240\372\2527"
+	.ascii	"\222\226x\252/*l\372&;\373\213-\361H\273o>\226\022oE\330w\246"
+	.ascii	"\033\n\037\032\023\363}9\253\233\367\300Y\363e\304T\fG\234\006"
+	.ascii	"\021~L\275\020!\037\025\023\272\345\213\022'\314\245\"\276\271"
+	.ascii	"\3265\325Gl\324K}/\245\244uE}R\210\317\214\335\324\215\321\262"
+	.ascii	"\364\315;_\345\007\223\333S*u&/P\t\332F\220O\305?\033\362L\204"
+	.ascii	"z)}\247I<\3247\231\332\230O\037\n\211\037z;{\"\"\351v\351\373"
+	.ascii	"\276cI\203N\315w\362fRM\2308}\317\t\036v\362\031\210\004\330"
+	.ascii	"\224\345\2250\231\276\351\331\301\007\341\227L\337\203\177u:"
+	.ascii	"\371\364;j3\342\355\217\374\230\210\037\361\353\340r\321\030"
+	.ascii	"]z\021o$%#\363t\326\274\002\253\364K_\224'\351\225\246\213I\337"
+	.ascii	"ww\206\235|\326%\313 mqE%\034\r\177\314Co\376c\333\351\210z\220"
+	.ascii	"\346\350\364\217\2308\307"
+	.string	"4mf!\356\260c\241c\207]\004\302\031\330\325\336\024\262'\021d\237a\230-\364\004\343 \320\216\272x\fZN\204\311?\202cC|\362\213\244dqc/\314\t\361\335\206J['\237S\214\236Q@\200q9J9\0266\264R\2165z\020\337dqc>\345\2427\372\365o\352\315`\321\367\034\033\222\347\223\265N>\315\212\246\037\302\270\n^N\201D\377\341\3279\313E\227\352v: \n\3129e\031o&\321w\035\033\022iZ\267\013\200l\022\353|\340\2766\216\005\220-\361\220H\3112+\353\234O9\265G\025\305c\307\341Hx2\364M\023\375\305\016\275\321[3\004\207J'\365\006\205\204>\317\004\017/\364\354`\0324\036\002="
+	.string	"\366\027\333\301y\327\001PJ'\365\376:\370qxf\345\235\327i9\321\255\322\240\347@f.\350\333\257\315\223N\352\335q"
+	.string	"\022\2435\025\246\231\207\017\364\354\037\331\241\234V\254\005\203+\306\026\313Z0\270f\304\330b\331\305\326\326\214-\026H\007E~\354\340\241\301\216\343\013\031<\200\350 \202\201\221\257V\244\300\262\302\272\262\242\022\332\321\274\203J\007\017 Ar\024\021\222AUW\217\252 =t"
+	.string	"\251\332A\244H\025\225\021w\t\341A\244\212\203\256.\"U?\316\267\325\367\2610\253WB\336xEp\tU\033M\017y%f^I\354\307\314|\317Y.n\350\2632\344\263\304Xt\251*\004\371\247\357\372\276k\237\245\024#\377\364\354j\nA\036\351\355\214\250o\312\n ("
+	.ascii	"y\"\3023\261\276(F~\004\325\315\327\207\250\352\327\364\226\346"
+	.ascii	"\3437\370\241\266\031\342\343\177\374\347!S\033\203NU|\223\221"
+	.ascii	"\355\305\372\030\344\363\361\311\2673$T\232\246\227@\025\343"
+	.ascii	"`}\223+K\225%\264\252\357\364\013.\363F4\232\026\362J\230\221"
+	.ascii	"\320D\365\204\037w\335L\240\210B\276\355\332]\361\252\307\257"
+	.ascii	"Q\325|\230\326\340{\274:\007\314O5A\305\323\200\bj'Jm\005(V~"
+	.ascii	"h\316\200!\232\301\202\372\255c\334\024S@\377\324;\325\256\016"
+	.ascii	"\313\r\217X]\006\200j\031\245\034\2319\207\323\030|\006<\036"
+	.ascii	"\203\357\345\031\327\363x\026o\271(V\346\202@UL\030\022v\374"
+	.ascii	"\005\317\356Y\360;\336\b\217\353-\370\242\2759\035\202j\034\230"
+	.ascii	"/\025\274\216g\367r|\005o\364\327l\256\317\361E{%P0\250z\351"
+	.ascii	"\302\005\307S\360\253t\202\307\361F\177\003\034qr\375\004o\224"
+	.ascii	"\206\271\001G}s\313\"\301\337\370\2650\202\227\200\371\312\""
+	.ascii	"xc\241\034\004,\250X\274\256\264\331x\b~}\340m|Q\036\262>\025"
+	.ascii	"\255i\374\003o\224\222\221\001\343@\013*\233Rn\312m\216\272\006"
+	.ascii	"\006C\223\032\020\233\006\336\201\032\337\300\027\025\272P\343"
+	.ascii	"\215y\310\372\306\240k\321\020\334\240\370&\253S\232\353}q\213"
+	.ascii	"ZE\tG\205\353\005 \264{6hYN\320h\252R\224pQh\274\223\225\031"
+	.ascii	"\204\352\023\260\302$\325I!\363P\306\317\310\242\226\251Md\274"
+	.ascii	"\2127;\350\224\0302\250!\200\025&\251K`|\214\3577\225\251\224"
+	.ascii	"S\223\300HB\243\274]\023A\237\230HB\315fP\227dH\334\246v\324"
+	.ascii	"1\245\223*\006\206\230\244\206YE\361H\253\026\245yTC$u\250\276"
+	.ascii	"\311\fv\347\025\225S`y\236\0060\304\304\253(\0368\f$>\242\236"
+	.ascii	"\027\f,\360/\024\370\005\022x\005\356\034&0\270\245\370uf\300"
+	.ascii	"C@\272u\300#\340{\332\200?\340\213\244Zo\3007\035\031\264\276"
+	.ascii	"\323\b\026\360\314`\323'T\312E\367\230\207-\334\305\230\022\211"
+	.ascii	"7\263\200W\312z\027?G)\347B\3267^`\213\345\313a!N\227\1773\330"
+	.ascii	"\302\217\200$/\250B\340\003\242@@\233\001"
+	.string	"\224\274\033-\022\254\f\341\375\224M\232\242\275\366\255s\230\317F\013:\300c\021\332\335y+\237\230\375\t\312'MO7$\2762q_\340\224p\277\026 \203W\250\342`)\020Z\210\210DD\024$I\222a\r\002\f\020\b\302HXJ\310\033\022\240C9\007\204\3209d\"\222\264 \205\016\325\024Z\"y\232\361\246\362\321Q)]\226\335{SZw\204z\320\303\031h\225\277kD \022\320\301\234;\245\2715\3073\245\366\352]\177o\305*\367\201\017\352\236\271\013\375%\246]\330\311&\n\001k\356\334\214\251\251\224\334\0168T\356~N|\366h\322\263\331\233\376\001.#\324\365\037McQ\3039\006 \371\345/\310/s!\313\3557\027\216\372Y\215\350\205\177\256\2308\005\3276\345\276\003t\372cn\2156\332\230\0020\300\365\251M\216\270\231\3616E\004V 9\227}A[\225TFX\342\350\221 \374\277"
+	.string	"\317\210\234C\337d,L\213\334\215E\227)Q\313\005\2433z\254\221\241\304\371a\312\251H\304\375M\237\243\254:\210@\366Sq2\343y\200Dt\374\221\246\362\\}Rf\241\215\025\337\267\253\"\253\307\272\344^\307\363C\202\360\305M\315\340\311(\032\022i\234P\327\244\233\372\342\227\350\331\032\234\307l\002"
+	.string	"\312\261y\271`\327\013d?K\351ZU\265\277\023a\206\225V\022[\234\267\315\214\325\342\200-\017F\213;\236\212\271\366K\223\343\344\f\334i\305\355\tI\212u\n\217\2268\004\364aDR\0071\3465d\n\"\216b\261:.\344\247\242\220\007a\242\225G\020\313I\177\003\361_O\264s\256\230 \341\027 ^/\305>\254U\215;b\351\177\251L8(\352p\357\303\310\006\005\231\226%\224t\234Z\351TG\374\355!@\017\001\213\211\031\00170O\251\344\371\324\314#\377wvT\304\003\261\233\354Q<x\337/O\bU\002\\\212$\357k\3339\364\324\334\223*\300\204\034\214^D\255\357\306."
+	.string	"\035k\r\263\260b\354\247\251\275x\262\267\275\207\260\023C/\201\027\b\0131\225\300K\210\207\305\237\215\211*\236\335!\022\311&\004\313\211\341\013\003\317i\\\313M\nj\204\031\234\037\235\216ui\320+\352Y\263\207\244\220\225\253\337A\224\031\315\017\3106A\356\355\036\372|#\276\f\270\036\267Q[\262Q\315\177Zg\371D\214}\250\2224L^\3720\357\200q\306\215\233\252G\274\fr%k\320>\034E\032g\231\f\210f=9{\274]\244\355\013x\177\333\001\013\266K\313\342\254=\256\026u*\366{\3456\216\372\204\201%\315\213\345\n\307w\004\t\216L\013\320\240\220\235\315\355[5\260\224\374'F\016\314\233-\"\325\006\333g\377\274"
+	.string	"[pb\300\240\023\210j\206U\032-\0174\2135,\032"
+	.string	"\277\337\022 \"\033*\004M\001\322e\323\206\332\216\357\305\265\273\007\037\367\016\205\274#\254\227\246\205W\274kidB\371\223\243\371\006\312h\212\351\2632\316\352n`\307\275\204&a*#p\312"
+	.string	"1\272"
+	.ascii	"\251\345u\343\303\375c\351\031\025U\005Hh)\272l\\\b5\210\327"
+	.ascii	">\235\217@\204b\205\023\001\323\223\350\273\260u`\265C\354\306"
+	.ascii	"\213O\370jD\247kc\351\247n\200FXB%\231\023T\367X\231\360/K\031"
+	.ascii	"\312\371I\311\341\245\335\"|a\377\366h[\313_\317\376\025\271"
+	.ascii	"\200M\342\025j\360B9U8\322\343\003lP\207\215&\240n;l\0060\005"
+	.ascii	"A\226J\274\276yN\225\317\267\0208\264[\020\331\024\340\331\006"
+	.ascii	"\252]c(\241\024YP\2423R\217\360y\022\204\035M\021\205\314\r\360"
+	.ascii	"\211\213\nB"
+	.string	"\321\377\001\007\026\205"
+	.string	"1\244\316L\330t\212\203\203p(^\213\2245x\272\006J\b\347\201\323\303"
+	.string	"\320\202\253\300*r1\2730Y)\020\240\204Cs\352\nC\275\260\023\003\355\373\371c]\317\255'\362\320HeZ%];#)4\231\317\246\244\321\324Y\327\317V\317O\037\250M\025\215,+E\034d\352\211#\016BA(\037\024f\0054eH\341\376\222x\024\242AE\306($\263\341\030sCDu\017\362\001C\364\022\306\004\211'\030X\021\301\303\303\037 \332\321\030i\b\365\024\361\024\b\004&|W\020\031\212D\246y\226\262s\320\005\035\212\002\311\340\241\346\2715-\001`7\002\311\271$\370I\356\315\325fq\304\216l\274\\\340\322 \001u\\2\313\340+j\303nN\"G\274\016\240\242\322\315S\222`\303\031Y\206$\220\366B\b\022\311^\270\031\251M\251\240\217pn\3569\240<\003-<\022{\247\003\024,\222\330[\375\363\ra\360\026\032\237\313"
+	.string	"vX\335\353T\337x\035\320\246\005\b'\276\032_\332\237\262\2311\300\306j\224\"\331\177QE\326F\261<\312\2434\375lA.\232\332\330~\2162\305\210Q\267\276\201\252%\304\357.v\030\204\366\257\345\3436]\270\246~\276fR\351\030\302\"\004\331r\213\223XQE\301T,l\325\376hF@\210,\336\b\240\354\335Uc\354)HC\205F\337|\206V\347\310n\035C\207\363\301\213\332\032\212\002\202\362\365\036eF32X\344\260`\371\tW\360\"\347FU\365h\036\230\201\230\350\273\207\3323*\223\f#s\311q\007\024\020\261P\030\233(fN\006\206\327PDC\245\307\333leq\216\304)!\267\004\b\017\370\032{V\303hL\351\307F\345\006\002\376M\351\267 \351,\217\212\350\303\263\243\333\036\002r\321\334"
+	.ascii	"a\333\240\255\301Qn\214\177S\247K\233!\325\251\302Z&3u\236Y\002"
+	.ascii	"8f\033\204mQ\374h\363\244\334\216)3\323\002"
+	.text
+	.section	.gnu.lto_gpsProtocolReceiverThread_protothreadState.33.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\333"
+	.string	"\001"
+	.string	"?\202\210\200 \177},{,y\273\001w,"
+	.text
+	.section	.gnu.lto_gpsProtocolReceiverThread.34.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`I\005U!"
+	.string	"\306\272\321Hp\032R:%n\333/q\270\001W\f\245c\007\021\360\3619t\357\362\2053\306\247\301\206\030r')T\355\336\003\335\321a\267H\255'\253d\213\016(5\240\321\217\n\355\316\226@F\244\277\022\256\003\360\237\220\275\311\336I\006\274"
+	.string	"\256"
+	.string	"\276"
+	.ascii	"5@H9J\177\177\262\237\365\316\216\311\313n\006\274Q\252W\025"
+	.ascii	"\243\0021\216m\261`\374\017\376M\337\203\177w\307\241!\"\340"
+	.ascii	"\307\246\316\314\225\3552\312r\354M\316F\007\277\315 \375m`\367"
+	.ascii	"\033\320U\016\016\311\330\001C\355M\316\231g\2034Z\201OQ\035"
+	.ascii	"\326\271\247\255\300~\360)\017\\\325\331\353\214\254\253\212"
+	.ascii	"\262m]\207\366\322~\"\247\264\t\341\264\216\003 \331\272\316"
+	.ascii	")\201\254\t\330\225X:N\213\366\244\355i\2573\330^\324\353\206"
+	.ascii	"\225\343\334\345\234\177v\004aX\\\365\324a\273qk\245\223U\205"
+	.ascii	"\177\204$\207\234\210\305e+\332\3139w\025f\331x\357\274\273\325"
+	.ascii	"\272\373C\367\335\005i\372\225\257\245\373V\272\373\3152\213"
+	.ascii	"r]c9\007\337U\205\271\001\324\320\252\316\351n\024\247\322\311"
+	.ascii	"4\347\\4\3456\210YFU\347\032\212H\242\031\226?\205?\366\026G"
+	.ascii	".4\303"
+	.string	"\016EJ\3012g\252\013\373N\376\204\251O\344\267\235\244\352\205\277})\374{\343\241\206T5N\377\354\035\264\326\232q\271\306\3516\006\253-v\377^_Yrm\275\272\177|\367\340\332\272[;}m\364\254\215\321\332\367\326>qm{k\327\263\366\201\024\f\273x\200\361\260h\214\271\306\234\\\036s\221F~\374\273\277\2732\324G\353\247\365\316n\355\350b\0274\346^S\030\265'\036\335\200*\266\335G\034\352\205\250\335]\213\355{\354\265\265\n\2149<H0=\366\307\357~\352i\273= \325\013{\354NL\230\323\036`>\355\247\201\364\242\264d\322\240I\271\266\330!\260\265<aG\246U\205\323\002j\265\335#\222\352\205\326\242>\206V6\330\335J\357\262b\313\271\370L,-\341\337j\253\023\2602T\213\003N*!\262\035'\031\266\032\265%YN[\274\226N\032\370J&X\266\241\252s\355a\002\021"
+	.ascii	"\022\213\262\"\315\224wC\274r\"\244\330\230`\225\3636^\275H\351"
+	.ascii	"E\210\265\305F\366\261\364[Z\263\336I\374\213\240\227\317\200"
+	.ascii	"\201\255\311\303\265\016\352\267\277\244\023F,|Mh\324\206\250"
+	.ascii	"&\337\357\267BI\327D\021\036\024A(\"\202 \344S\302W\"\205o\t"
+	.ascii	")\352I\327JBI>\246\246\021*\236L\360\234\226xMKIL<\245\237\n"
+	.ascii	"\236\020\201vz\362\375xQNN?\336\2161\277Ge\253~\243\310\326\232"
+	.ascii	"f\\\225w/\230~\271\316\032\271\245:{4\214\203K\255\020\263\354"
+	.ascii	"g\327\375\300al\306\2359\347\214\332b_\235\365*n\r\233qHD\240"
+	.ascii	"\030\356\253\371\033P\254O\244\201d@\263z!\320\f\377.\020A\364"
+	.ascii	"A\262\241\3604n\314\240/8\245\362\335FG3e`\331\025~\306\302\200"
+	.ascii	"e\231\233\301\220A\203\006\374\033\264l\343\203\024S\300J\017"
+	.ascii	"6\330\026\373\267Qzx\265\351\330h\2501$\2111\206\020C#\221\310"
+	.ascii	"L\222\244\003p\002!)$\017\020@\307\2104\2056\221F\211\351\350"
+	.ascii	"\020pBx\204aO\251;\t\321\255s8\372\006\206\372<~\024\034\317"
+	.ascii	"q\003p\224\017\033\203zgT\264\247!K\037\201\300\322f\322\204"
+	.ascii	"\205\310\020\263\027@\314\033F\272\2463\225D\ty\272\005d&\251"
+	.ascii	"\033Q`$\364G\352\214\224\356%A\343\317\261\245\317av\023HH\273"
+	.ascii	"u\202r\301\013\346B8\003\256\207Q\2538I\345\254u\253\231\337"
+	.ascii	"X\032j\260.y7\002\312\252\351\210\346q\245\201\370\257\310\342"
+	.ascii	"\261OY\203j\"Db\02055\272\206\305\356\365M\234\275B^\256\253"
+	.ascii	"\240\027E\324o\201\234\316|tI1\232\b\277+\024}\376\bN\006c1\374"
+	.ascii	"\366be'<R~F\023\216\013\353\341\017"
+	.text
+	.section	.gnu.lto_mtkBaudInitData.35.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`2"
+	.string	"M\007"
+	.string	"d\f\226"
+	.string	""
+	.string	""
+	.string	"\220"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\256\224\311\315\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'<\206\b{\370\347Ty\276\003\005\001'Q\230\347\004y\301\002\005\001'f\330\346\004y\304'{\206\bw\230\346\004u\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"\023$PMTK251,9600*17\r\n"
+	.string	"\013/root/repo"
+	.string	"\031./src/main/io/gps_nmea.c"
+	.string	"\02419200*22\r\n3847576C\r\n"
+	.string	"\025115200*1F\r\n"
+	.string	"\016"
+	.ascii	"\2404\b\006\334\005a\3404\270u-\306\t\371\200}`?\220\037\330"
+	.ascii	"\317g~\r*\223\001\300\001"
+	.text
+	.section	.gnu.lto_gpsProtocolStateThreadMTK_protothreadState.36.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\333"
+	.string	"\001"
+	.string	"?\202\210\200 \177},{,y\273\001w,"
+	.text
+	.section	.gnu.lto_gpsProtocolStateThreadMTK.37.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`\244\033=\\"
+	.string	"j\217\200 O0P\332\351J\223\311\007o\212G\373\177\003\257\326\"\334E\374(\t@\034\362\2303\342\267bJ-\306\224=\374\3410\020H\275\365\235\017\327\262,a"
+	.string	"@\245b\005\004b+"
+	.string	")\"\213\016\265\3504\177y\023\345M\321LDD\310\336;\245\224\002\320\001\325\001\001\002\2523SuFj\347#\325\331Hu.R:\237X\235\211\332\331\204\352<\244:\227hg\022\252\363Ru\036\021\343,bu\026R\235C\030\235\203\212\316@D\347\237w\366y\347\236\2443O\322y\007\351\f\302\350\374\001\351\254ct\316Q\235q\214\3167Eg\033\242sM;\323\250\3163\252\263\207\243\263\f\321\271\203\321Yit\216!:'Ug\244\321\371Xt6\022\235\213\355LT\235Y\326y]\235\325v~\325\331\337\271\373\366\333\275!\020\001\276{}\034\346p\257\254tE\032\332J\030\371\203\325n\375\3266\\\216\247\251\035\036\004\256\r\217"
+	.string	"\270\266a{-6\r\333\353\317\027\223\271\324v\033\b\352\345\272?\2152m\273\341^8\023\2752\211b\257\3342\377\345P\335(&\217<+&7\334{\215\236H\267\035\"\b\350\307\247\207g\007\304\007\235\034\234\033\233\032\232\031\0172\035\2241I\344\321X$\262\253\372\336rGu\b4+xm\205gXN:(\211\023\n\020\361\t\005\254'\375\343\244}\322\234o\352\317\275\267\307\255y\240;m\r\342C\222\326Y\313A\3228l7gm\223B\215Y\323H\235E\312|&\315\211\202\207g\313\220u"
+	.string	"k\245\324\371\366\3451^\235l\251\323+\315)\347\310\256>\226`\004\022\303\002\322E\325G\bXa\2479\271\324\237\274+V\304\255fU\033\037g\315\226:MP\207"
+	.ascii	"\247xA^U\371\252\016}U\371\201\274\242Rm\260\004\331\322J"
+	.string	"\032H\352\224s\365x\365\243\377\211[[\022$gfO\260. V:\216WS\254*v\305\243\305\234r\035\234\370t\357eo^a5\0135\263\007273\347\020\t?\006\246\211\257Lc\211O\004\363&\016\347\301\276G!f\301\210\032\231\322\254\032\334sG\027\"\235[q\264\307\253DL\t\033X!\226\254\243\"\355\341\272)\260\006\260\353O\300L\200O\031P\274W\007\023\273\224\007\007\024\315n\260\275\256\317\303\214\200\337\033\207\352\327x]\235\024\351OXi1Y\177\214A`\377\225bq6\350p\0348\307\375\231_\300\360n\376\023\267\302t|\0243/\320\2068\n\033\207\006\034\210\021\203\355\325\337]\350sc\rU\260P/1\030\232\355\n\343%bWN\365\307\270\277pt\207\314\213\317\224\260\305\222\327M\221v\027\261\027z\251\216\355J\224\203i\206\213\352\240\253\035N\376\307\270\007\271\t\007\345\264"
+	.string	"\3360@\356@-y~\334\177|s\2006pk\221B\341\343\236\356\275\241\321\300\235%\217\r\r\013\267\024\357\362\225!\261\302\275W\027BY\036w\225\27120@<n*K\242\316B\020\0010\312m\347\306\336\274<\302\240\321q\327\255P\303s\013\340\034\267\024\376+:Zs\224\355\025\350\351\316\360\234\002\336\260(L\304\177\305\"\331m;\346\226c\346\277\357+\322\366\325voT\177y\363\226P\376\270d\036\206\231\037\350'\034-\336{\231\234\364\023\365\271I\371!s \026AaZ7\bl\267\365\007h\005\024\246]7dn&9FL\357\225\352&w\\/\201\200\333\254W\226 \207w\263W\356\034l\257\r\327\034\204I\271!\267\222^\240KJ\241\340uCf\270\250V\357\275\327\177\214\271\325{\357\345\027\302\334\316O\355\334Buf\241:\257hg"
+	.ascii	"Tg\025\252s\212vvR\235\233Tg\024\355\314\244:/\251\316J\355\234"
+	.ascii	"\024SCN\274\317O\335x)\242\277\261\323\033\222\n\n\316\230\030"
+	.ascii	"2q\030fH\217o\310\323\203\225\034\f\357\n[*\253bUW-{-\341\245"
+	.ascii	"K\2117\332E{\354\274\260\310\220X\222\020\f\\\312\320\254\032"
+	.ascii	"\213+i\267C\036\227?\273\267n\301\267\264<\226\323{\253\272\331"
+	.ascii	"\206P\254z\261\354uD\037\216\351\2107Bw\346\236H\224?\306\335"
+	.ascii	"\372`E\264#x\226\326G\313\202\210\031nH\205\276\306\355\326R"
+	.ascii	"4\211\333\212)\341A\037\302\367\334J\210O\366\271\265y\225\274"
+	.ascii	"\240\326\315\251\340\001\331E\177T\220*\271hq%\177\314\347{\036"
+	.ascii	"\347"
+	.string	",N\257\256\315*:\335\177\227>7\236\357\371\242,;\377\341y\276\253\320@\374\316;\351Y\205\221\322n\025\347@\374Wy\272}x\245\026r\312\0252\2138x\327\307\300\026\266\256hA\342\275\300\321\366\223\353.d\204D-\246\201\271\275r'mV\273@\346.D\311\b\245\276\350h9\223vkg\272D\365k\n\346\274\316\253`\254\302$9s\333\325zy7s\276\353\302\246>\212W\334p\335<\016\334\033\216\002\016m\273a\300\223\254\331\034a\241\306.\353\247\n/\310\221f\206F-m&\006%O\322D0F\321\212\320\344p\3442\357\341\2046\210\031\2162\017o\214\300\237\030\020q\262v\214\211\264O\177\262\275\312|\262\217N\312\017\313|\314EQH\207o\361E\371b.j\246~B\226\246\340\332$\330\230W~\016\230*\272)?\344n\022l\362c>'Z\3655\345\345\302\204\344\033\365\271\321"
+	.string	"JK\370\361\221\317\334\026iU\360n\362\017\025\020\034\\\310Or\006NB\253\326\304\376\303\265Z#\352\221v\215m\327\330^\217\217\202g8V\313\326\304\356\364\253\026\332\276\005\340\335\f\200\355\325\370\035\345I'\200\367p1B\361;\232\254\333s\362A\362\214+\006|\214\031"
+	.string	"\351\210It\304d\316\3601F"
+	.string	"\244\243\001\222\220\230DHG.\230CHDIHI\314\241#\"\024N2|\214ib\016\035!\021\035\021)!%\035\240"
+	.string	"\002\t\b)\331H\300\306\f\0315j\334\240\300\310KMILJLKJE5\025\310\250 \003\031\0278`c\003#SP$\201\f\rf@\320\301\006\026\030\321\270\300h\306\005\022h`DA\215\016\214\212t\230\306\0062j\030\331\240A\243\206\021\022\356\366\013a~\222\372)n%\335?R\200\002\026\nBi~\372\274B*aBh"
+	.string	"\r;\300\231\241\264@\371\311\200\302\025\n6\024\027\326\212\363M\t\217{b0\204\252\206\270\005=\275\262\206\317\373*P\\\270\315\030*\020j\020j\220\355\365\351\333\357\311E\364z`\257\337\004\233\205\206\371}\351\235\001\rR\341\250\320\364\361\210\310\b\357pb\240\372q\341\304iC}a\231\241\n\241\f\375\356\315In\204\030j\360i\301\242E\035\035\013.2\230y\351\321\003(e\356H\224\277e\257+\240<Ya\304\251\251\313\257\t\017"
+	.ascii	"\257LS\001\300\023\301\2320Q\361\036%\013F\324\310\226f\325\006"
+	.ascii	"\243\332\224\354\370\305q\264\247\005\021\r\254H\336\201\301"
+	.ascii	"A\201YB\035\026\253:o\331k\nh[\212\344\235\027K\001T+\004\341"
+	.ascii	"\324\344\264\206\244\251\317\311K\223\270\0176\260`\344NK\r\312"
+	.ascii	"\262W\024h8\212\240x\243\362.\353\005N\026\250\241\016\323\022"
+	.ascii	"\223Y\331R\rGvKz\344\360=\311\016\207\254-{U\n\"\246\004F\252"
+	.ascii	"d\302\326\004'\351\225Rf\322\023\217<\330\1771\337\347\272b\350"
+	.ascii	"Agh"
+	.string	"\226\r\006B\276\033\032L\350\372\002\204l\331+\022\tZH]^@\267\200\331\034\275Rjt\364\304#\217\365WF\357s]1\364\240W\232e;{#\254\301\362>8*\364=\226\020,\240\264\013|\021Z\252\023[\313^\213\236\307\357(R\332\355y\0351\243Y\273\235bO|\215\250\247j\003\202\037\250r\2105\316\303hHD$\210$I\222\326\322\f\b2\216:\t\255\003\022\340\021\201\020\347iJ!kDD\223\2422\n\351"
+	.string	"`\330`y\321\275l\313"
+	.string	"\363\242\t\032$\360\222\334g\231\004-r\240\n\334\242\2052\033\b\217\234\205\356\002@\263\230=\322\023\2341f\020L<\006\034\307\331\0049\021\020I\364.U\004?\2106\324M\205\203\003\tb\177[i\222\211rb\322*\221\245\307\235\033,\264O|<8\332^\256\332/\003\202\251\333\354\220\270\351\006[&{\235fZ\306\030$\2254\254\013\033\321\233&\371\347\316G\371z\313\320|\245%\312\224<\003\326Qj\212\260G\tB\320\374A\223JL\265\207\270"
+	.ascii	"xC\275\351\202\236\020mC/\266p\204\325D\317\323\t\314\335r1\036"
+	.ascii	"c\322aw\215\341\030-\202\213\n\332H\322I\373f\364\245\227\f\324"
+	.ascii	"W2\327T\270cI#\n\327p\213\024^X\206\325~\b\024\375\352E\2046"
+	.ascii	"*\236gs\311B\274\366xK\0248\270a:\263\205\300\343r\013sN\372"
+	.ascii	"\371h\0175F\275L\312\031\n\333&\202\005!4\353\226\026\243\225"
+	.ascii	"\212\333\304\005\242\024@\324\352\357*/\373\270)f=\r\033\222"
+	.ascii	"\200l\257\002\310\223\021\241\013\263\233\006a\344~!\333\bXd"
+	.ascii	"\352f\321#\346\214:\211\236\364t\266\257\263"
+	.string	"\337q\026\177s)\352Y\025\003\026y\316b\363\206\272]j$\234RE\251a\352\200N@\r\307\246\202\224\202\312\202@\340}\003]{\224\t\371\265o\207\202\356\224@\272\350\362;\343x\006\331\266\253\242\304\322\026\342\306!\200FtI\343(\004 \016\310\224\315\226\361d>W\335so\233\202?\314\346\223\260#l3vTDD\230\244\206\206\320\303;\252a3&\021\265m\334\022A\205\316j\316\231G\021\352Y`!WG\\\016\302`\017\275%\332\004\275h\304^>\314\203+!\322\214^\304\0138\3371\364a&\036\220%cM\342\001\"\2562]\nP\207\264R1#\2720\260)!C:\202\336@f\365P\002\212\253}w\350\207h\265n\275\204$\260\235bU\345{\337\261\2122\2277\211dH\376\013U\001\311\356Q\306\326\231T\244\350w\205u\205\032n\211\313v\023\226\023u\333J\351\320\324\372\030\203"
+	.string	"O\232\357\035m\322i\270<\210ZE\245\036\031\267=\270] \204}\233-\031\227&\276 wg!=\3200wRJ\273\030E,\213F\272P\002\220\302'\f\271\215\312\006\311al\177\375\240\240\205*}+\261lWx\001\265'\3403_=BZ\235\374\213\264N\316\331\276\220c@\246\261\031\250\304\207\245\243/#>\222#?\205A#\207\353\243rH%{\317\326x$\003\252\337\302\030,\261\327\257w..\224Lm\022\024\206\262\335zm\243\211\\\225j\313@\332\337\017\3369\032\252\346+\nJ\f\034\323q\270\2101\035\325\207<\241h\030\264'e\2571\242\274\tT\370A\t\371u\032\0046d\371+"
+	.ascii	"\203\3205d7\263yYk\343H\005s/Q\341'@\037Nn\244n\376|\353\037"
+	.ascii	"8\355\206\310\344'\244+dX\b\264<\341\205\244PX\241`\212\316!"
+	.text
+	.section	.gnu.lto_gpsHandleMTK.38.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"e\013"
+	.string	"v\324K>\020Q\225\016\030\210\035\nK\002\1778\360\356i\311S"
+	.string	"\231Vh\256\250\305\002\253\243`\275\f1l#\364}(\316\316\004\331\371_\214\021"
+	.string	"\240@T8\212s\242$\230\034\360\337\323\310\2262\245;"
+	.string	"5"
+	.string	"9"
+	.string	"\233\377\324\003t\036w,\262\341\020\036\340\3600c\342\211 \245\304\322 \361B\2510\256D\243\211\007\202\003P\256\032O=3x\241L"
+	.string	"\fv\327\331y\244\033r\333\016l#\260\337 \351a\177\\\352\311>\\5\331O\347\323\217P8pX`\354\216>^\333\302Z\214\260}\373&6[\342\315\246\361\017\265g\341\302\260\302\306\356F\375\360\355\030\324\f\t~\205\240b\205\322e{\363\024~\021\331]\005>\212\177\231\037\342\230'h\371\356\230\257A\216]\027\3108\361\311\017SH\025\b\274`\332\026.\344;\033"
+	.string	")\347\\y\304\330\306T.\231\r\307\242u\"\304L\0239\232\313&b<Z\254\024p\326\311x\"\205,\363D\311\267W\323\203\016\255\217\2020\215*\347R\207\013\0210U"
+	.string	"\t\025*\t\251\177\201x\336(\201\352P=\005\030"
+	.ascii	"3\001\363\337\f\254n\301\036\331X@\273>#\004\256NB!\260\017\030"
+	.ascii	"\006Y 1\332D\260\200E\\\231\271\033\024\221s\261:\333paD\031"
+	.ascii	"\254\036\317<\204&\215\212\251("
+	.text
+	.section	.gnu.lto_gpsProtocolStateThreadNMEA_protothreadState.39.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\333"
+	.string	"\001"
+	.string	"?\202\210\200 \177},{,y\273\001w,"
+	.text
+	.section	.gnu.lto_gpsProtocolStateThreadNMEA.40.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`r\t\0051"
+	.string	"\232P"
+	.string	"\022CP\236N\007\373\036\t&\025?\036\216\032\225\2406"
+	.string	"t2\027\211\243\271\301\267\357qE\211\215(\324\264\327jd\236y\327Ek"
+	.string	"2\230\306\001ho\361\362C\3043\266\276|N\233\247&\264\311\336;\245\224\002\004\001\002\001\f\001\001\212\316"
+	.ascii	"\214\316>E\347\236\2423\262\350|$:\033S\347b\321\231e\235\211"
+	.ascii	"D\347uuVU\347\264\235?u\366w\356d\343=\t\3458a\271W\353\020\317"
+	.ascii	"M\243\3321\351\267\226\343c\221^\303u\\\333\317)\245\252\036"
+	.ascii	"n\366t#\343\341\331Ak\253l\377\254\255\026"
+	.string	"\371M\230p\324\266\033\217\364\202\335\217\366eq#\274\367\371\240Uf\300\266\312-\363\337\320\325UNX\242\225u\205\360\336\233|$\335v\017\362h,\262\304UM\337[ne\367\260\275!t+\\\343\022kd\032\244\265\266l*[CR\007\200`\352\034\223p\215\265\221\250\344\344\022\353b\002'WX\263{[a)\202{\257\223-2'~\365\272\267\005\206\345j\352\240\314L\327\221y\225\006\351\231\301i\271N\260\267E\346\251\221\331\325?\226eedV\255H\2766\261vn\221\251NT\272\367\262/\231\\\315>\315\314\203\314L\202\271X\024_M\253W23\213>\243\243L\233i\341biim\325\337\261\364\301\255w0\254odN/\275\2165\273\013_[3\3753n<\206\032@#S\024\025\244\362C\326p\344yS\366\232\216\263K\037\345\265\245Q\272a3_[X\335C\271\305\020\271m\350\342"
+	.ascii	"o\323\216\373\216\251\\\003\222\006\370\205\273\216\377\330\377"
+	.ascii	"\321\f][M\240t\325,\031\002x\233t\f\201\377X\026\355\266\030"
+	.ascii	"\346\346\302\314\177\337\007E\255\314\355^e\227\371\3626\260"
+	.ascii	"\321\304\362<\314\314\324Z\030\312\336{\221\262\364C\350\203"
+	.ascii	"\243\362C\266\341|Q\350\3446\217\265\335z\007\333\207B'}ejA\364"
+	.ascii	"^\252^r\317\265\225&n\265VY\306\224\367\262U\356\251\265\325"
+	.ascii	"~\266\215&\225\337\341\226\353\024w[\205\201\327\3570?\225\376"
+	.ascii	"g\314\235\3367\302\334\316D\251\363P\321Y\210u&@t\016zg\240w"
+	.ascii	"\3769:\0178:\0130:\007q^\300\310\020\377\214\233\231\311{0\264"
+	.ascii	"\375\262\232\016\232 \321\213\3270\267gn\325\"i,h^\005E\023\244"
+	.ascii	"\032t\372\244\271\262Ub \3527\365[\006\366\274\317\247\206Yy"
+	.ascii	"\0328s\313\244m\342\275\354\371\276kV\275\22238\363\356\220o"
+	.ascii	"\030\002(\212\207\3152Pm\006\353\361\221?d\210eW\345\207\334"
+	.ascii	"\315`5\376\361\207\240XeU\204!\006\215\237\354\203+P\267\300"
+	.ascii	"\331/>s\373\244\215\342\275d\004W\202:\346\024\037\311P-\247"
+	.ascii	"\235\222\304\035\247\001\333*i\373\326\306\255m\334\332*\373"
+	.ascii	"\026\322\354\250\3740\252\3756$q\277i8\034:x\360^zX[%~\323\245"
+	.ascii	"\331\201\350\276\020\321\365\033\212\314\213\333c<\261\303\036"
+	.ascii	"\353\210U}\030\314\"\232\315\b\366^+$\35659J\260j8\326V\325?"
+	.ascii	"\300|\242\367p\350\245\017\344yU\366$|\226\327\323\212\372g\314"
+	.ascii	"c\375\367q\316\271\261r;\034\344\376\314*Vx/\377\211\001R$\244"
+	.ascii	"j4EE\341`*\362Q\022\005\244\nHG\025\214\200"
+	.string	"b4\305\230\321\344\264B\n\252\310LFKM4j\270\270\001%#\371\344\224\254\341\264D#\311\024u#iD\304OPMQI\251\247\247\250\344\361y[\211\352\253\272k\t\036[a\340\226f\245g\002E\213\225\036\032c\322$1[!Mx\2670\360\202\263\365Z\217x\233\250\240\021\215\363\004\327i\201\342\005\371g\334h\232\350}\370\346\334\270\231\033i\275\270\325\270\375j\303<lm\225\350\333/\r\214\254\305\212\246\343\302\364\372&\330\325F\312\021Z\204\241\n\242M\bh\202*\016\013\340\2712\376\231\023\243\335\222\021i\213x\336\340\036\020=\272hq\201\013\375\220\217\271\330\220\t\007\363/!\024\356\345]\004\276\351Z3\347rfP\231\bv\344\334\330?\003\372\237\027Z\233;\243\325\"\t\002\364O\247\017n\300\377\274\021\033\001\017\340\007|c\261\005x\001\177\341LV\236\037\255\022\326G\200\1773ip"
+	.ascii	"\336\307\353\b\206y\024B\234\003\246\215r\002\200\315\250a$\351"
+	.ascii	" CD3\022\024$\005I\322\001\200\002\031!\253\252\003\021P\265"
+	.ascii	"d\310F\251\n\035\221F\211\361H'\b2*L\225_1\031\304\226\365aT"
+	.ascii	"\003m\303\\4J\204*\322y\006\273\215\303)\377d[\027\n\323\255"
+	.ascii	"\244\327\372[\355\302\221%\004b\026\221yVV\335\241\317\335\215"
+	.ascii	"\200+vD\315\f\245\032\252\357\330\212X\2340*Gq\335\204\013\230"
+	.ascii	"\200\002b\203vhe:#\034\275w\n\001D\333\3769K\216_vm[\267\t\302"
+	.ascii	"8e\350w:\341\341\254\227\267r\301qX\244t\034\253\261\201BP\021"
+	.ascii	"\3514\370\325\341J\221\204\256\347\320\262\352\016\320\220\274"
+	.ascii	"\300\256~q1\237\254\013tmElJ\205G\007\"\2346\367\345\272X$\254"
+	.ascii	"\026\374>\034q;\322mJ\020\320\241\b\346\024%\317\361Y\032\216"
+	.ascii	"94D\333H\323'\207!?\265\332b\n\3104\214\234\303\202:\340\306"
+	.ascii	"\2677\007\336H+\216\024tS\036\213\333;w\037\3669q\230\335\025"
+	.ascii	"\035\031+<\362G,\226\222\030K\237\007,ew\354\366\234p\004\272"
+	.ascii	"C\245{5\223\211\t@\345\317\231\361\315\007\177\256\351T\267\227"
+	.ascii	"QP\244\273\256\177\316~i:q\264X\265\030r\356\262 \272\2556\366"
+	.ascii	"\225\363\374X\325\026J\306g\212@=,\331\342|E\022p\335y,o*\203"
+	.ascii	"G\327\372\312$\220\246\204\267\\II\217u\376\311|\2232j\327\261"
+	.ascii	"\334\371\261\03272n\336\302\305p!\356\326\256>\236[E.8\237\021"
+	.ascii	"\330\201\377"
+	.text
+	.section	.gnu.lto_gpsHandleNMEA.41.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`\337"
+	.string	"m\013"
+	.string	"\206\024L=\0203T:\030\013S#\213"
+	.string	"\236\373\277\265\210\205\202\377o;r\004+\005\241\323\214\240<@k\204\376=\202\217))`\\!B"
+	.string	""
+	.string	"\b\201@Y\255\275\200\023P\362\324\336\222-eJ\001<"
+	.string	"5"
+	.string	":"
+	.string	"\233\377\323\003t\036w,\342\341\020\036X}\3201\361B\260\300(\325A\342\201Ra\264\021\022M\274\017\034`j\361\370\351\271\301\003e\002`\260\273\316\316\343pCn\333\201m\004\366\033\004\351\303\376\270\324\222}\270J\262\237\316\247\037\241\304XQx\355\212^\256Ua3F\330\276\375\024\233-\361f\357\370g\332\277\200\241\301E\217\335\215\n\342\3331\250\031\t~\215\200J\201\262e[s\026\256\021\331]\005\376\212\177\231\037\342\230+h\371\356\230\257A\216]\027\344P\341\311\227)(.PJ\300\2641d\310w6\360Q\316y\203\004\216\r\276T,\030\315\006\202\306\221\020\263L\334d,\232x\351h\261B\300\031\007\323\211\026\262\254\023%\337\036\256\222\036\310Py\364\203eT9\217X4D\300T\001&Z\240&\244\336\365\374q\302\304R-\005\030"
+	.string	"3\241\267h`\254n\301\036\331X@\273>#\004\256NB!\260\017\030\006Y 1\324\304\335\200\031_\231i"
+	.ascii	"4\313\271M\235\r\2730\242\fV\217g\036B\223F\305T\024"
+	.text
+	.section	.gnu.lto_gpsRestartNMEA_MTK.42.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`P\001\025\013"
+	.string	"f\221C=\020\005+\035 \255\232i\257iFLP\350\237\343\357\342\016\342C"
+	.string	"\332\242\0253"
+	.string	""
+	.string	"K\035\364\277\377\305\256\274?\311\2202\023U"
+	.string	""
+	.string	"\200\322\263\207\2458\207\324\002\001\335\301 Ad\247\024-"
+	.string	"2"
+	.string	"3"
+	.string	"6\016\333\377\270e\323\334,\367,3\026\265\336\356Vp\343\255\323\226\377\217{`1\327i@\303\356\232\302b\0307x\333\005\266\r\354\337\004 \017Y\3714S\260\350a\017}\226\370\220\240\254y\321\237\023d\0027\323\307[\212c\233.\nj\330\357,8\263=\307e\364v&\334\356\305/gsa)>\031PF\035\215\271\311\2207\361y"
+	.ascii	"e\215\226\350\304\216\203\333\021'\361\271\240\333]\005_\344"
+	.ascii	"#)\237\366\320\023*\225\370\360'/>\036\202\354+\321\017\026\201"
+	.ascii	"B\243\321\364\220:AT\222TM\244\320XE\250T\005\r\230<\215PU\202"
+	.ascii	"$Q\365c\356;\013\316\034lr/\260\302\006Sri)\225\273\025\237\017"
+	.ascii	"\2402\326<\002' \340\002!9ss\241\3753\360\364\253\036\327a3q"
+	.ascii	"q\343W|\307\261\257p\334Si6\013\371\312l\326\244\302L\0216\310"
+	.ascii	"\336\374Fz\027T\013G0Z\351b\244\225u\363&\203\332\342\"\254\215"
+	.ascii	"\272\020*Pc\242\033\002~\036\002V\272E{\236"
+	.text
+	.section	.gnu.lto_gpsHandleMTK.part.0.68.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"E\007"
+	.string	"\"\r05@o\222\016"
+	.string	"\301\276Q2\246[\276\256Bt\021T\025\365\346\354I\352\251\3617\237\004\275\251u\274\247}Wr\030\036\343\003\240|\375\223\310\314!!\324\310&2\005s4\233\316\007\364 \nA<\313\363@\236\315\347q.\321\323 l\205:\327\213\260\254\353U\177\253K<\355\340\301R\201\026\210!?\325\260\022"
+	.string	"?A\321Z:\341\002I\027\254t\264d\213i\0302\272\272\304\323\343\201\302Gf\306\214L\202P*$\337l\364\325\315\260\257J\325\344\037i\214\275KOF\262)0\030(/\231\371J\241H\261bs\330m\326\201\222\211T$0m\264\031\324\0054d\346\002\034\235\352\317\360/\374%\001\017"
+	.ascii	"?\023\030\027\f\226\"\017\020\005\303\\\341,L\3309\003\350\f"
+	.ascii	"\320f\312N\003\300\265\027SN\313\351\327\2261"
+	.text
+	.section	.gnu.lto_gpsHandleNMEA.part.0.69.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`\037"
+	.string	"=\007"
+	.string	"\"\315/5@o\222\016@\265\345$%\177\022\216\007\n\232g\342A\020\375\331\223\324S\343o>\tzS\353xO\373n\220\216\341\301q\212\362|$\320\362!!\324\310&2\005o2\032\216\347\363\020\002A<\253\363>\035\215\347m\256\320\313 l\2018\327\213\260\254\353U\177\253K4\355\200\262R\201\026\210\247\237jX\t\200\237\240h%\235p\201\243\013T2\226l/\rO\243\253K4=\0360tdf\304\300\244\007\225\022\362\315D_\335\f\373\252TG~\221\306\330\267\224\004$kr\202Q\342\222\231\257\024~\024+6\207\335f\035 \225FE\202\322F\233A]@Cf.\300\321\251\376\013\277\302/\022\017"
+	.ascii	"?\023\030\027\f\226\"\017\020\005\303\\\341,L\3309\003\350\f"
+	.ascii	"\320f\312N\003\300\265\027SN\313\351\327\2261"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`\216\004\r\030"
+	.string	"\006\350\230J\200\226R\007`~"
+	.string	"\270\202\214\257\303e>\302\276q\376-iaRq\"\207\013I\\\255{]\004\034\034J\346N\3146\304&@P\\\223H"
+	.string	"?\374\360\303\217\373j\021\004_\003j\255F\220r\025\355\247\366\023\305\333\221vJ\001\213"
+	.string	"\177"
+	.string	"\202"
+	.string	"\375%\"\033\b\221{@d\006\037r\003\017Y\310\325\243\332\375{;\344!\347\220y6\344\001\250\361\270\245!\0233\344\006\003\252F#\r\f\271[\364\302\216\205,\240B\220BqB\221\004a\213\252\252j\204<D\221\200;\b\005\216r\234\355!\225\345A\326A\035\034\330u\267\n\243\240\"P\321\017\321\002\034\005C\t\204\020\354\276\333Wf\220\317\356\337\367\255\003\312?\027\325h<\n\351\316\335\317\243\363\234Y\025\371\311>\264\273w2\002L\345\323\225 ~\036\353\335\"\245\216A\374\275\365\307{\254\346\274\207i\375\237\2709\215"
+	.string	"y\317k\275\337\300\260\310~\274\367)\256\333j\343\357l\254\243\313 Nn\374\035ilr\302@2\031\375\245EJ\265\277\013\347\222\232\022\262\375\177n"
+	.string	"\326[\232\264%q\374eX\177\211q\035@\353@UU}\376xu\243\367}}\376o\212L"
+	.ascii	"E\356\346{\"\033\231\310\315|Kd\"\022\271\235#r\254\367\240t"
+	.ascii	"\325y\255\356S\326Fm\261\016\0036$,\353\031\307\266l\335\327"
+	.ascii	"%E\207\025\353E ^qA\374\356\243\365\033\252\254*!~O\262\336L"
+	.ascii	"\266\2442\210?\267\356+\243J\023\342ob\275\210\266T\203\370\231"
+	.ascii	"Z\277Q\242\324\022\342\177\341:\f\\\215\251!\376%\327\333i\003"
+	.ascii	"\315\215\210\277EK\304"
+	.string	"\317\302u\240\223\031\217!\376$\327\273)\266\234\021\304\357[\205\370{\255\377\264\224_C\3742\255w\335\253Ikj\336\305\351h\216\271%?fh\336\215\230\346\217x4\275G\332\231y%\327{L\f\353\231\223\376\212\325\035*-I\233N\372I\255\367\3205\271\206\351\333\264\356^\317)3b\3723\304\364cXo&7\336\247a\352H\326\256v\004\323G\221\256\013\235\222Dr\360;\335\352}\004\212lM\007\277cY\275\317\252\344\242\252\260\016\204\343-\fn\365\266\022\203\253\031\205\365\036\243r5\307\266z\220\\\330\227ZT\250a\fMR&\260\231hD\222\322\244\305\020\003\241\342t\021\340\230\343\f\205\"2\265 \205\035z\020l\260\326\223\352q\177\240\244\372\220CE\275\346\261\261\356z5<\376\323\003\037\232\277c\345U\377S\353EZ\n\203K\211\350Z\025f\023)!\275\365\324\267i\\\254\322\224@"
+	.ascii	"\016\266\374\034\325\217\001\300\364Z\275\274\274\360r}8MM\274"
+	.ascii	"/ ?\252\345\262\307\322zv\235U\b\200\207\312Ys7\244\360\243\231"
+	.ascii	"\2555\342N\013\232\025\265B\201\253`x\216\360\036{\226\331\035"
+	.ascii	"~"
+	.text
+	.section	.gnu.lto_.refs.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`\252\002U\020"
+	.string	"F\344nE\340.%\351[\245\030>\333d\035\244\356\257\r\236=\224\177\347\345\221_\017\n\363\202\301\207\031\276\0263\" \306\030c\2141\306\030c,<[0\027\2771y`>$g\rc\3266\333\260\314\332\326Z\263m\313\024Z"
+	.string	"d"
+	.string	"Y"
+	.string	"\026\262\336\226\354\245\220\337\t\\\357\n\324\f'\031LKJHFDC1-_\bv\002\210\353\373p\177\217\366\357p]E\313S\270\036\201\373\023\355M\270\356@\313E\266g\260\365\020-\007\321\362\003[\377\320\362\001Z\356\261\365"
+	.string	"\371Q\353\033\331\267R\035f]#\333\221>\243\t-V\347Xkt'N\252\347M\352\023D\367Y\243\365\364\220\365\354\220}\316t=7\250z\312\250>5\304\300\274\\hY\365d\211zj\212\001c\311\005\213$\244#\243\242\241\030\fE\320\217O\211\036\022<:#rV\275\"\270o\210\355{\243\352\265Q}kfb\264o\206\356\373\222\352\305\220\372\272t\275\001\034d`\276\336\027\227\n\360\313\022\365\324\304\324b\205R\222\212\243\242\357\217\t\301\276>\020\374\177^\277\217\3537\001\177\036\370)_?\201\017a\343\037\3007\201\275\004>\t\374\006\257\037q\275\b\374\020\370\005>\016\370\336\327\271\357\026\312#\360\027x=\301\252#X\365\016\370\021~\037\277\276\361\365V\3540vU\317\274zpw\261#\357\276\337X\013\310O\341y?P\354\357\300_\347\365*\256\227"
+	.string	"\037%\376I\374\222\330Ib\037\211]\001\354 \360\r\274\376\303\365\004\340\261sq\016"
+	.string	"\347\212\327\013\345}\235^(\035\021\305`A=:986\037h\002W\250\021Pg**\247\240\240\222\003`\223m\306\020\3604\007\265\331\250\216\323Y\244\237$\r4G\2029\265 \205\004\203\024W\325!\216"
+	.ascii	"R\210\244\026\f\254_i z\315\374Y'\210:&\261\320\216\\\300\b\200"
+	.ascii	"Q`\253)\225a\253"
+	.text
+	.section	.gnu.lto_.decls.3410eeed5302ff03,"e",@progbits
+	.string	"(\265/\375`\332;M\375"
+	.string	"J\216iWV LI9\351\257\356T\305L\344DO\315\317\354\336\355\376\355\337T]Q\242\272\315\334\314~\025\0215\242\357\236\355\373\377}v\331\205\241VU\261OG\031\246\3533\033M\021f"
+	.ascii	"_\247\rw\370\231]\314bh\367\375\275\204\026\004\343i^\035 \242"
+	.ascii	"mK\310\336r\247\212\004w\005\241\005\275\254#5\340\324\355h\034"
+	.ascii	"\315\243\217\255\243{t\216\212\354\033m\343-\325S\357\016:\350"
+	.ascii	"\300\302\201\242\266\334p\337X\360\233\f\277\303\360"
+	.string	"\373\013\277\233\340\017J\360\273\b&Q=\234\357,\374\264\352\341\324\251\035\316\017:FGA\201[jZ[\002b\344o\030\r\325N\375T\221\035E\205\tH\221\255\216\352\027\265\315giCnzA$\250\243\272)\231\253zcZVH_\034\220\2707:\367\235\361\253\035~]\342\3278\374\267\022\211\036;2L^\2359\300Mkg\310<\272\336\223,Ydxv\275\031\307)/}\037\002\230\257zV\245\252\3714m\310MYf[_\300\320\3148\231S\335T8\265\256\312\251w\365M\255\241\306\251m*\262\332\325\345\353\232\312\3467\231s\223\233\027(As\025.\353\3112\347\374\nV\355\252\226\332f\223i\370)\214,\256\312\331\344VoJ\026\262\256U\273\212\245\252\331(F<%\254l\231s\362!\374A?\b&\252]=S\351lr+3\301U\001e\241\305\270\253\3139\371\241\203\323L\230\r-"
+	.ascii	"\334>V\017\347\210\272\205+]\3274UMEV\272\212\206\247\251\322"
+	.ascii	"\335*\302\247V\021&\333\221\245\260\363\276j\341\327 \370u\007"
+	.ascii	"~\235\201\353\230J\246\"A\3242=xM\360\344\304\300\257 \316\232"
+	.ascii	"WA\234\257M\270\276\3250\025y\266*\246\022\321\242D\244\357M"
+	.ascii	"\200[\364\316v\276\210o\204\377\303\037l\251\\*\222\203\332\345"
+	.ascii	"\225\255f\271\271\224\314\311.rW\026\326\367,\340W\016N\233\227"
+	.ascii	"W98\237\001\274\241z8;\005\374\267\352\341\254VjZE\222\250W^"
+	.ascii	"\251T\264\373\232\222Y,\347\344\217\217L\233\035d}_\002~%qV\022"
+	.ascii	"\347!\200CT\017\347\255\035\316\020fed\202\200}\351\373ZV\311"
+	.ascii	"\252\262\205\234\251\344\234\003\340\353!C\0161}k\256\036\316"
+	.ascii	"\r\265\303Y\307\202^\245t8\215W\311\374s\342\331\305 \353\373"
+	.ascii	"S;\234\177\025\003\361\223\254!\365\243\357+\262\206U\260\252"
+	.ascii	"\264P2\216\231,\347$\207\0234\3448\323\267&k\224We\205r\020L"
+	.ascii	"\334*)32\347\\\225\"\034s^\252\312\23799/\375\324*\242V\021\327"
+	.ascii	"IV\022\263\363~\001\370\311\352\341\304\265\303\3113\342\365"
+	.ascii	"\311}\304d\023o\374\364\363\367\0246\347o\366\276\363\233O'p"
+	.ascii	"\352I\301\027\360_9y\1773\325\021\004\317\363\233\346\337EkZ"
+	.ascii	"\311\362o5}\232h3\214\356od\232\022\324(h\376\216\341\357\026"
+	.ascii	"g\344\376\212\343\376fb\346\356\257v\177\227\371\357\201\256"
+	.ascii	"\340\257S\376\372\346)\374\027\256\f\231\277\307\374\035\346"
+	.ascii	"\357\267\277\277\374\355\345\177\357\2775pi\004l\371\373\210"
+	.ascii	"\226&\222\345\257sl\375\302\t\360\337\342_a\370k\322_\2117\377"
+	.ascii	"\253\345\257\346_/\360\327\f\376z\301_A\374u\203\277\n\340\257"
+	.ascii	"\032\374\025\203\277z\340\257\"\376\372\373+\360\257\007\370"
+	.ascii	"k\212\277\252\360W\024\376\n\202\277\246\360\327\026\376\372"
+	.ascii	"\201\332\201\277e`\371+\t\177"
+	.string	"\035\341\257\n\370+\007\376\332\200\277\206\340\257\021\370+\013k\177\365\375-\244\366_\316\377\032\376\307\371\337\346\377\234\377o\376w\371\357\346\357\0134\233\377p\376\333\375\027\3637\b\376N\373\333\312\312\337Y\177WAk*\377?\374\377\300\177\003d\320B\b\276\201\377~\340o\263\n\376s\360+\377}\377\265\361\267\330\337\312\277\275\376\356\372{\353o$\177k\375\375\343\357\031\177S\375-\365w\324\337N\177/\375\375\3647\323\337)\370\373\004\177\227\340o\027\177'\375]\374{\004\177\017\3776\372\373\205\277\203\177\263\370{\350\357\026\376\016\301\337\034\370[\003\177\257\3607\006\376N\300\337(\374\255\301\337\003\370\373\303\337\027\374M\201\277O\374m\302\337=\177-\373+\321_\205\177\227\360?\315\337\022\370\353\327\337\021\370\277\342\257\351_\253\374-\302\177\262\277\037\360\327(\177\223\360\267\211\277K\374\217\362\277\314\337\006\370\273"
+	.string	"\177\217\370\233"
+	.ascii	"\177o\360w\006\177c\360w\207\2779\374\355\363\367\206\277\177"
+	.ascii	"\376J\367W\260\277\306\360\327\241\277\n\375\325\205\277\352"
+	.ascii	"\374\365\377\363\376\343\375\277\373\257\342\177\331\377\260"
+	.ascii	"\377\312\377\"\370\337\366\377'///\357\357\221\370}[\277\007"
+	.ascii	"l\002\2775\256\215{\243q\01605\035\367j'M\221+@\226\340j\001"
+	.ascii	"\225\240_\032\367\007\034*.\031\356\214;\303\212\354VY8\327x"
+	.ascii	"\251\244\300\220\362v\251\356\324\216\215/9E\276$\233\352\r\267"
+	.ascii	"%\325\205qe\\\250\033u\235\356\323\215Q\221W\312\272]4\273\254"
+	.ascii	"tg\026\230\025\262\356*\335&\035\270&V\310\272+u_@\261B\326\255"
+	.ascii	"\275\261u\310\2555\326\r\334\027\332\335\315N\226W\312\332\331"
+	.ascii	"9;YO\254\220:w_UR"
+	.string	"6\334\357h]\246\254\256\343\016\035wig\006\236\315\303G\306\334v\240\360\362p\034+\207\250\253L\251&N\034\034[\203\031\307e\n[\026\013\007\315\266\351\225=\231\201\204\302F\207\006|\235 j\032\253\216k\t-\214n\013,i\225>\276\234\261\324l\245U5/l\266K]\227+\026\313\226\266)sqVJ\225\253oW\016pbf9f\225H4g\326,\213\234\215\263m\366-\003&\250\023\330pIc\351\254\030[\306\312\3319K\306\302Y4\326\214=c\307T\244\215\263a\376a\n\025k\245\276\221\231\220\006\306\306Y1\253<r\205\213\313\322\371\200\273\202\301\275\267o`\362\236\2360\351\373\245\221\230\311\242\346\316\213u\363\325`B\306l\r\276\257L\027\313%\016\314\016d\337-I<\244\213\352\306\026\254\305f\351\251\341\344dJ\031\276\017\211\305\256m\231j+\202\3148\316\260pQ\263Axx"
+	.string	"\301Q\246\013\337\247e\253\264\034\261\251\250\036h\276\033\370\276\030\266lg\b\326\034\214;K\206\317\340c7|l\206\217\275\360\261\026\266Q\206\200L\301\342\003\037\333\200\002f\3528f5\260/\273\262%\306\276\310\333%\255\314V\337c\030\370u\215\006\016'+\203*Lk\211F\305\003l\252\307\226\324\220-4\033Tg2\330\0311\340rL\251q\343\312\346\200\223\262F\3541\206\017\013d\006S\224m\262/\236\306\t\216\210\227]\307\261LVpG\214;\2266\211Eb\267\254\023\313\304z\331&\366\210\325\262K\354\023\333ei\260Jl\021\313eg\250Hk\304\006\271\025b\207\374\303\2325bu\330\036L2\214\330*;#\003&\250\274\204\345"
+	.ascii	"%\311<'\367\305\fZq#\356{b\360\231\337zl@~\220EAc&y\271\312X"
+	.ascii	"I\222e\261~\202\301\r\351\"\206\337\373\302\357q\341\253\244"
+	.ascii	",k\r\017\273C\007\231'QB\360{XX\247\311\327\230\274\276\026\207"
+	.ascii	"\275\341\023\243\315\0171}\337\223\001\277'\003\277\307\204\177"
+	.ascii	"\302\301?\347\360\3177\374\333\031\326j+\2112M\337\267\037\036"
+	.ascii	"\274'p>\264\340\237f\370\347\027\376\271\205\177fa\0306F\324"
+	.ascii	"}\261\2666\244\357O\0300\242N1_Y\212\205\272\215\3729R%\314\217"
+	.ascii	"\276\366\251\266\355\344Uqc\313\3037\227\035N\273\344\363\004"
+	.ascii	"H\330\0235\374\212\264J6\307\341!$\231w\233O\307\2233\260Jf\272"
+	.ascii	"\244\364\3559\215\027\302\022\227\024\274;\030_n\254\364M\"y"
+	.ascii	"\250\250\212\034\373\266\234\263\325%Shl\372\376\315\323\354"
+	.ascii	"h\321\3122\225\370iutWTm}\337\364\\\247!\301\311\350{b\212\261"
+	.ascii	"\244;[}#;\001\007\303M\327\320p\272ME\366\233^\276\3274\233\177"
+	.ascii	" \323rp2\336\264\232\263e0\203\321L\234\272\234\263m\322f\003"
+	.ascii	"\207\316\255\037\314\031\370\346\024\276\311\204\333L\237\251"
+	.ascii	"\310\2675\232\373\314\215\321)\211\203\237\202\372\266\363w\331"
+	.ascii	"e~\264\274\351\221\326\3677\016\377v\301\027\364\230\\\351\021"
+	.ascii	"$\016\314\f\353\342d\t\016\214M\363\203\352\t\254\210\214e\326"
+	.ascii	"\217\261\253\251\016\322Z@\244\2269\347\266\356\322a\332\255"
+	.ascii	"\337ZLo\351,\315\245\265\364\227\366R\221\r\246\327\336X\232"
+	.ascii	"\255\301\364W'\315\302\356\032L\2075Z}\2732\341\344\2545\020"
+	.ascii	"\252e\203\251X\032\313&\323.\360B\307\262\301\214\341X6\230\346"
+	.ascii	"j\244\215b\274\300\030\250e\226#\235$\003\201\261\006\246\306"
+	.ascii	"\341m\201\351\255NR\337\206\344\002Du\320\223\021\246\\\202\301"
+	.ascii	"\265\016\270dR\352\254\220^S\324\230(K\223\205\214\316\n\351"
+	.ascii	"e\206\346\254\251\264Z_i+\235\326U*\262\321Z\371\332\3061;+\244"
+	.ascii	"\027Z\213U\272\372v\225-\\\034+\244\227\216\216\334uc\303\375"
+	.ascii	"\375\302\277[\370\027\b\376\315\201\177\255\360o\024\276\315"
+	.ascii	"\303\267v\230\204\352\341\354\325\016gC\351)9\030shp\203\375"
+	.ascii	"*\217=v\251\206\027+qOx\244\222\314a\223\0057i&\355U\221\355"
+	.ascii	"\244\227\274g\250kM4x\331\352\252pm[hNZI\205\253od\371f\271Y"
+	.ascii	"!\275r\316\365,\210\0217\370\336\252\341[1|\233\304\267H|\353"
+	.ascii	"\205y\266\360;\311\337F\252[k\325c\316M=+,Q\324\372V\266\240"
+	.ascii	"7\022\233\226\305i\016\021|\332\035\270\205\364\220\212\274\240"
+	.ascii	"\211\260\031\302T\325\367\226\006FA\316\365\202\263\346\345\325"
+	.ascii	"\013\316[(|\333\204o3\376\262z8}|\250^cd\226}\337o\360+\232\025"
+	.ascii	"\221\255,46d&\270\035[\306\252\"WIz\206\f=\226}\243k\344XV\267"
+	.ascii	"\276\321TU\316G"
+	.string	")\231\251\002\026\\\331\221\25326\204\311M/\272\236\264\032ZU*H\303 \314\270\270\314.\251\037\265\031xPJnv\231yQF\246\364\351\022\245*\316\t\006\241\334\332\272s\037f\210\302\305U\367F&j\307\021o\020e\3447b\"\371\240\346')YxK\013\207\252\313\306\221\233H\344td\340\242\fb\261\374\r\016\0342\032x\203\036A\202\230Z\037\216JkH@1\3469\361I\371\210\202\203\310M-\036 pF\262\314!O*e\272!\246\020\037\0334g\232|\230rl\t\351\373\n2\326\200\216\306\315\034&\r\363\207M\203\257\216Jk>\320b\226\204\253.C]\221\350}\251\302\303k\307\315\0377\263@0q\266^\331\034\f4}M\254\233>\210\264\221\002u4}\374>\337\fh\250\340\205\301f\217\004\364\2168>\346\360\320\031\"\346\310\222\276]\317v\232:v\210\214\255]\2317n\342"
+	.ascii	"cs\202\343\202M\0337\257\202L\275\211\301\202\177\263\306\357"
+	.ascii	"\343Yc\244\206\226\025|\016dX\203-UU\346\214\252\314T\347\030"
+	.ascii	"V\221\253\2720a\274\356\254n\316P@\r-ln\217\037&rbp\240\302\032"
+	.ascii	"(\251\250L\251\272!\311\004\007c\253\247\306\207\231\026\036"
+	.ascii	"\326\300\310\210\0301L\251\017G%6#f\250\"Q\001.s\330\2302nJ\265"
+	.ascii	"\371\244\216s\236\250\235_\250\346\304\241\303\033L1\243\314"
+	.ascii	"\250;\227\306\314V\347\030r\244F\333\013\363\351E\025'\363\311"
+	.ascii	")\3334U\246\272\274\252\024.\031]h\370\033\274\360\225\224\356"
+	.ascii	"\334\231sM\036\251\214\033\344\231K&\223\271t\347j6\346|\365"
+	.ascii	"\200\2638\313|uE\3024\253\321\006\252\3577\024\301\337`\003\203"
+	.ascii	"\240!/\357\347\f\336\200\355\356\356\b\325O\032\006\301CNE^9"
+	.ascii	"7\353\204dV\332!r6\325U\367\223\304?5\324p\355N8f+\007(Y#g\253"
+	.ascii	".g\035\036\340 /\346\276n]\225\222\f\303\322\267^IZp\305d\212"
+	.ascii	"\007\026@\036\361\373\246\"\357\233\213\343*\263\222\216\232"
+	.ascii	"(\246\034$\\\232\364\375\017\f\fB\253M\03308\204\323\2325m>c"
+	.ascii	"8\0038#~\325 \257\232+V\313n\370,\301\030\304\215\370M\363\212"
+	.ascii	"\274in\362\2032+\371X\361\301\305U\207\337\252\3005\365\275\217"
+	.ascii	"\021\fbiDmR\357\231W\344=\323o\232C\316KM\322|\224p\210\"rrw"
+	.ascii	"Ni\r\bQ9\356\234)\246\013\211Y\031\374\001\314\210_2\257\310"
+	.ascii	"K\346*\253\261\346\\e,\311\322\207\224\252\272{\303\037\316\214"
+	.ascii	"\370\025\203\274bn\334U\346\031>/\274\254\220u9_y\320\273{\243"
+	.ascii	"\201\244\357\205\243b\036\321\241\004J\032~\317\024,\242\311"
+	.ascii	"\210_0og=^\370=Bp\210\032F\374v\371Er\333\256\227\232\255\214"
+	.ascii	"*\204qYfc\366\340\272iq9\221\351\373\236\033\370=U\370=OX\204"
+	.ascii	"\230\226-U\016\347\255\336\032\323\227\345\035>\317\032,\"\013"
+	.ascii	"\013[\233\031|\2360X\304\325\025\265*\027\302\346\314\003JZ\027"
+	.ascii	"|\236+X\204\324\210K\245\336*\027\311\265R\345B\3540\271\031"
+	.ascii	"\223\036\234\347\f\237'\f\277V\271SD\0322\262{VcLuy\231\375\236"
+	.ascii	"\251\235`Ye\204\364\275e5\354\332\331\250r#gf\301A\303\303\244"
+	.ascii	"\032\217:d\364]\013\333\321\3267\311\264\234C\243\357\r\363\261"
+	.ascii	"P\224cx\020\3017\212\217\026/iQ6\360\205\362\005+\f\317\013\374"
+	.ascii	"\013\366_\344\375\362\351\241T^\365\255\306\352\341\254\300I"
+	.ascii	"\320\357\023\237\252&cf}9\334&U\331\302\t\325\204\325\325\367"
+	.ascii	"2\t\372\365\222\253\272B\243\257I\303]2\005FfL\337\337%\377U"
+	.ascii	"r\273\252\262\205\312\244\024\304K_+B\355p\336\031\202~\271|"
+	.ascii	"`@\246\334\364\r\241v8E \031\361;\344\"\271IjY\3150\214>\263"
+	.ascii	",/\313l4z\360\035<\034\342\313\210K\344j\375\026\371-r\217\340"
+	.ascii	"\2343\223\225\251\256\272|e$\361_#\277Gj\277\241\271\373R\225"
+	.ascii	"M\347\226%\213\016\277\3773[\231\311\234\306\304SI\374=\325\326"
+	.ascii	"\001\344\374\277\004\213d^\272s\343\346\354\202e\303M\210\374"
+	.ascii	"g\245\243\221\003TR\f\313\b\325\204e\243B\211aUA\211a)5\224\333"
+	.ascii	"R\2251c)\341|\254\302PK9\213\035s\325N\022+\347$\226\022N.\031"
+	.ascii	"3T\022\353\310\001\252\t\253\252B\211ecn\312\306\n\240r\256\312"
+	.ascii	"bXk*T\3062B\211\035\2538\344&0;\242\300\334\254\252\235\334Y"
+	.ascii	"\233*\250\246<\205\201W\323\321\370\006\225<\326\264\234\225"
+	.ascii	"\310\234\262\021+g\035G\021iMH\224\322\230\336\246zWMI\245zC"
+	.ascii	"\212)\353\350K2\3457\250\256c\221S\316rYJ\004\245\252\364\224"
+	.ascii	"\231\224j\316NIc\316L\307\026\256\2165\356\311\230{r\323\222"
+	.ascii	"\f\246\254#\217\023\323\361)w\371\250UPbY\307\240+R"
+	.string	"\304\2662SR\251ne9,#\026SJf\2506=5T\031S\227\304\377\025b\361\202\304\001\362\267q\2615\371\370\221\305\243\334\022c$\353\277>.\326\355\301c\272\211\222\252\353\333$\356\261G\225\333\332\341\326\343\362x\"C\020#\276+r\226\320\330quTi\342\365\244\357u\\\255\217\306sLZ\223\227\0348\214wP\260\364\375\305\361h\nLU\244\250\212\027\001a\220\242*8\244GAb\212\035\027)\222\321\2114hT<\002\022W\024\203\002H\223\206)\352\241\210\n\r\001u\210\216\202i\020\270\201\"\232\272\230@\213\025,x\021P\tt(I(t\024,A,&\225"
+	.string	"\200P\230tt4<\352\3050<\352\261"
+	.string	"\242\302\213\022\223\220.\222\221\320\213\200\216\206\301\243\241\020\001\212(J$B\207~\303\3647D\034\016\205~*RT\300\202\024\0300\341\204\r'R\2348\n\002\211i\361hX\002\n+P\374\320\025\212HD\025\364X\360\001PJ\004\"\001\241\260\002\005*\034:\002\236\340\001\006i\360\310\002/\244F?\001(\372T\fW\024\221\210:\240\260\002\205\213! \272\202\021Z\374A\321_\007+\210C\241\013\204\3033\375\025\205\202i1X\304>\037"
+	.string	"\375\214\222\212/\b\241EB\033\322^\020\020Q\021\205\017\004 \026\277S\004 \027i\220\bD\302\247\t\240\024-\262`1\304\346\b@F@\"\020\251W\034\022\242A\026?\027\200(qX\204\0044BU\244H=i\372#\236\0228\201B\205\030P\025.\024$\242G(\021\276\b#$`\004\022Z\364N\002\003>`\300\007\347I`@P\020\003F\b\302\037!\310\206"
+	.ascii	"Dt\024$\246:\305\024\250\342(\210\342\227\202\210\016\005a\030"
+	.ascii	"\022\2210\372\323)\002](b\364\367\243\203\376$\200\321\337\221"
+	.ascii	"\213!<D\205A!\260\002hQ\003-\206B\027\222~R \fA\"R\361\267SD"
+	.ascii	"\"\362\245\305\237O\021\211\250w4\f\026\211(\0131\024\371\320"
+	.ascii	"\237N\321t\241\007\375\265@\207\216,\200\246@\342P\022p\002\034"
+	.ascii	"\220\320T\005Q\220\305\321\260\204a\232\004\364)\242(\022J\203"
+	.ascii	"1\250H\201C\021E\372+\242(\242H\223\206\276\364E@%\212D\024\206"
+	.ascii	" q(\203\021\020-\320\202\250S\374\361\260\220\022\207)6\240B"
+	.ascii	"\027\200+`8\211h\220E0=B\207\202:\351\017\035\032\242\320A\207"
+	.ascii	"\206F7\375a %\016\221z\212H\303\036\232\002W\030J\002\272\200"
+	.ascii	"Q\022\004U\340\024\023y\206\200\350\t\302 p\005\021e\301\"i\002"
+	.ascii	"-R\036b\232\342\203N\013\242\0171M\201\302\020D\205\320\025\204"
+	.ascii	"\300 \021-\202xA\b\350\202P\b,\0015\002\022)\320\202\3703\004"
+	.ascii	"D\211E\3510\035\022\221J\020Qa\322\020Z$T\034Q\374\241)0U\221"
+	.ascii	"\"\371\320\243\240\360\242C\303\022\216\210I)J\324I\177E\r\340"
+	.ascii	"\224\bL\213\276\364\007L\205\250\t;.\200Bt\310W\374%\t\207*\212"
+	.ascii	"HD\034b@U(\002\213tR \352BJ\004\242'\260\240c\202\020e\301G\004"
+	.ascii	"Dq\"\305\t<\024\024\002a\360\025\211\200B\026&\372\243@\021\211"
+	.ascii	"\210\007Er\261\242E\220E/\025\002m\361w4\f\246@\241a\n)Ph\217"
+	.ascii	"\206B[$\024Z\"\240Q\317\204\023*\bQ\030N\025;%\360\024!\241\026"
+	.ascii	"\006$\324\246:/\002*q442\032\n\025\203Ba\320\350,\376P\243\340"
+	.ascii	"\212\337\016\021\210\272\270E\351\321\320\310t\001\034\262Ef"
+	.ascii	"\021M\223\216\202F\275\342\320\321P\b-\366^\004dAj\002J\004,"
+	.ascii	"\026Q\024i\021(\354)\022\207D\"z\026\323\244!N\217\222\206%\244"
+	.ascii	"\350\013B@\244\235_\360!\022J,\221\016\207\304\022;\305\037\020"
+	.ascii	"5R\001\230\002M(\"\021\365\b\207\303\t"
+	.string	"\374\314\026A\026\026(\304DGC\241/\375\221\320K\201*\214\222\216\316\036:\224\224\006S!\020\017\241(R\321D\213\304\244\241\320o\350(iH$\352I\177#\004!\r\207\212.j\024Lo\372\003!\204\364(\230\204\321\0248t\211\300\"\241{\023$\2040\202\b#\230\020\001\310\202/`\001%\204\320\200\n\025\300B@@\324\350\350WD\"*1\f\2268\n\002\215J\b\021\213%\200>\264!\263ZnE\350\330\314\335\262\033C\262\326t\365$\361\232\234Y\202\335\261\261\031\214jL1\333fe\t\023:\363\313\0076\367%C\032Si\271\232\256^\240\271v<\210\274 c\2361\275\354\330d\260\353k\312\331\024\230rm\2321\347n\312\275V\021=9/\250\245\263\214I\306\307\313\006\233I\3467\343\3141=R\306\226\342\372\326!\325\303\351\241F\320M8\214\227e\212\210\230\233a\344pt\231a\272"
+	.ascii	"\3212\325\327t\013\272\371\266s\326v\227\004\214\371\245\352"
+	.ascii	"H\\\\\337\233_~\323\315\364B#c9\365\255W\325\303\331\001\031"
+	.ascii	"t\263\255,N\020-]\256X\017&QK.\367\210\217\316\f\322n\213\211"
+	.ascii	"\004\0042[RZL-\235\253;$^\262\334\344\223\234E\307fJ\375@\341"
+	.ascii	"\210\322\003\213\262\327\206\n\257n-\356\2421I\311\251\235\365"
+	.ascii	"\030\333\034\275\256\\/\246V\021'pi\346\f\036-[\322\314\254\334"
+	.ascii	"&=o\314d=U1\177\374\210!!r\303D\253rp^d0\3655\317\33243\251\334"
+	.ascii	"<{\322<\333`\316\017\216\263-\\\347\335`\211\024"
+	.string	")&Y/I\030.\256\272\035\253'\255\272)7\311L\035O[NV\354\216%e\035\200`\020n}\325W\246\330\0245']uWH\234/3\177sS\314*\355n\034\357\372\202\310\203\002\305TF`\231\347\304\213g\313\225$Z\224\233\312\345Z\031\262\257\231\264XzV\276tAS\207A\3109qb~}\300\371k\f\306\362\234c\352\221\206\274\371\345c\254\2214\353k>\261Xx\316\246\344\211A\2035\250A\003\r\246W\204\356\250\363\342\343\201L\\b\f)\205\230\031\232\021\022\24513\025@PX\\\"\024Nw\325\036\023\200\222\351\303\251\232'\025CLFDDA\222\224\224\nm\0077\243\304\276\013\032\033i\013|?M\376\t\032\203\005\230Lc@k\003\316B\356\242A\312\225\312\223>o\253\324\301\200\232`%\373\220\350\304\013\315\224*Fv%b2-\220\347\237\276b\364\206\002\227}\232O"
+	.string	"5\004.\"\336d\240\351W\225\371\267\033A<\327^\200\017\323\350\237\276\t\305\253\271\253\267(\351\354\326`\274a2o\374\366V\231C\203\275\252\355{\016\003\354\303\006Jg\021\220\r\031w\243n\204y\035lw(\333\006\222a-\r}\331\355\n\261;\332\032\3245\331\023\352\206\315<\236\216\266\356\216\254\303\035~v\332\017u\002\233\244Og\2042\023\n\374\200"
+	.string	"(\306\345\233\002\211\004\030\324Xtx\362\177,a\252|N@\365\201\0207p!\346/\315\025\244\362\304\316PI\b \222[\332\006\025\332\347\0176\341<\252\034.\035-T\026\016)\265\254\025\016\216tfk\221>"
+	.ascii	"`|\030\200\177\n\231W\212CT\361B\223Z\267\223\004k\t\241*\307"
+	.ascii	"V\334\301i\376iq\352\034\200\265\354\241NT\217\023-N\366T\025"
+	.ascii	"\202\002\363@\303\271\312\024YIhg\242G\r@JU\3360\021\024\025"
+	.ascii	">d\357\007\351\020]\324%\367\242\207WrC\277-\017\371"
+	.string	"\201\370P\333L`\307;a\231\317\332\033)\340&\270\016s\277\205\342W\225/\"s\300\232\343s\005yq\230\361\244\202e\201O\334\200z\016\n\314v0\212P<\346<\252\342I\004\266.\247hR\233\\\337\202\310\264s\321\033uw\367\207R\321D\225w\342\237x\225x\007v\352 \212\336GX5\217c\316\206\\Q\276\242\321"
+	.ascii	"B\337\344\251[L\253z\254-Y\2037H\200\233YV\362Mm\266\262U\246"
+	.ascii	"5\002\345\274\003\356$4\260\221\370\272{\024\337\215D\332A/\236"
+	.ascii	"\262\033\340!\030k\332kX\370\323\331cQ\365\025\230\b{\251f\t"
+	.ascii	"0\250\207xS#\340\256\371b\350\023\242nz\360\227\365\022\365\017"
+	.ascii	"X\365 \366M\207\270\252\25672\f\200\363\335T)nni{Z\332\321|\307"
+	.ascii	"\227\256k\335\323\354\006\024\307\317"
+	.string	"\223G\204HC\360\306Z\307\366'\237\266F~\355J\340#\005H\276\232I:\356\375\016\344\272\b\271.\204a\007;,\351m\327\244\337Q\304\310\306P\310\207\223e\032\024{4JW\330\"fzG\0216\340i\233\336O\322i\301\334\367\343}\2103\357\333\347\323\204vP\002\215\206\227\r\016p\237<3\356\243\245\306\2278\034\341\250]\026\341\016\303\272$B(\021\245\2102\005\323x\340\360\244\300\315\344P\320x\234[K\"\250b\356\037;Z\3740\377\024#\020XS\234\320\315I\321W\224\025\356s{v\305n\256\216\376\257`\212wh\251\254\200\343S\364if9sz\261\205\257\235\216\240i.\300\312\252\207\250\314\236\367\240\371%\212L\267\240k,K\303p\246f\200\2668\252]\346\242\366#%\315m\0045\207/1\fx\027i\\*$\331\006Q.\350K\211\324Lp+-\317/\222LN\022R\377\361"
+	.string	"B\200\r\364YwS<\035Z\376]#\307\033[jO\020\177gB\354\234\367\205\213\356\004wm\271\b\330u\332c\025\215s\305\322\243\244bH\215\224\236p\247\3529\025n\241\020\324\245\023\213\212.\263\346\221\371\251E\003\031k\273J\300\275k\211\r\314\326\205ui\347\342&\202\001D\375\347\260\266\026\341\022\013w\007\312)\214\334\252\326\313#\352\374\365\033\004\304\363\270\326\016\272\\\202#N6\330a\022\017\331\376V=\322+\200\251\274\261\242\352\205\202V\023\272\3566\372K\213\004}\303\273\351\355\256\355\222a]\316\307{\241\205y]\261\330\03415"
+	.string	"'\017n\003;\205LO\364\241\016Y,\212\274\346\324~\340\206!=4\371~\217'\307=\353nk\356\033<\276h{\217\375\333\325\276o}v&4\351^\255\3152\255\331\242X]@\362[\374\301\027\275{|=F9\327\022]\234w\333|\276 \023\315\374/\337UJ^\311K\343\007\017j\323I\002\024\222*LPD\002\363\226\216\\\220\255D~\nA0\352\372HJ\250\266P\355\246T]0\334A)"
+	.string	"\340(\321\333\301\016[y\266k\"\230\003\260\324\331>G$\212\345D\312Z\242\340\206(\263\317eT\002_\202\037T\345\372\327\207(\332\327_\352T#\366\"\222{\256\340\032\241e<\321p\330\344\374\003\237\252\313\017Iz\034C\013\246"
+	.string	"Cs\316Lk=/\035B\035\273\227\317\264\365p_\212\200b\377'&=\331Gn4 Sx\301\322\351h\\\232\311E1V\372J\267\343\207\304{\354\213\322\251\242\231\263;\270A\023\004\026}\2125\276ZN\265\270\351\0056\333\322y\036\037\325\372`\020\t+\224\245\026\221py\327\333\020\016|\326E\034\013A\333S\256\323\276\b\203\205>v\353\033\317\304\205K{\b\027\346c&!\365\203&\340PG-\t\"^,\214\022\036\020Hs\351G\253\310\336WD\034\271\355A\222\373\265\244\027U\336\312\020k\f\351M4\004\237\"\367\302\202\247"
+	.string	"W\372MV\2201\257\312\254y`\246\f\026A\220V\276D!b\333K\230\320X\366[\364\"\267`\330\037\b\217>\262\373\230\230\221\316\204\311\f\220\031\006\363\240\364\022\254\331\313\027\365*\223F\200$D\200Q\025\021\303\020"
+	.string	"\355\302\346@\357o>*\256\235\024?\245e\215\206\3333Ri\355\332\227\b\324\f\364n\307\213\331\245\320R\245\243\"\355L\321"
+	.string	"H\325\3109\373Y\344\241|i)&\260\345\364'\"\270 \322\202\2514\241o\227\342\271\264\275\340\307\366Z\237\f\nde\262E\254\020(f"
+	.string	"N\273\2754I.\0318\2036a\"O\317=\275\301\017\n\b2u/"
+	.string	"\005)(\213\216:\351\351y\214g3\036(\025\360\314\0023<\374\036\361\035\026\016-5\020\224\375e\021\315\031\370s]6\341\016~2\220/%^gv\004\246\r\032\303w|\255\264\003\275$\276\347\263\"u\236\004\3620.Z\252\007\205K\324d\214Q\251\334\261\220\324\235\327d\017\336\211\301\330\207\301\301\233\027>`c\372P\314\317\315\251P\302rB\\\311\371\317k\232\222\227\211k\026\225\365\257\224\2013\362T\377\016:(\310\r\307\275\243\325+}%\221\316X`\203Jf\252e\276B_\002~\rA\021Og\363\n\363\261S\240!<5\223Ai,\214a\277\231\343\251&\215\357J\306\257\314P\225\033\252Y\357z\345\024\027W\361"
+	.ascii	"\353`L\200\035q\233%\365_A\236X\276\276\215\221\272\207\206$"
+	.ascii	"\315\204A\250-\2130\0052?\231l]\306\220<S?:k\325\033\352\216"
+	.ascii	"\376N\037\203r\351\253\201#\032\203\216\005"
+	.string	"\fFc\346Z\276`\233M<\215\227 \335\236lq}\005\205#\001`^\244\035d\225j\346@o\361\326\277\2348\326\356\256\360I\264\343\265{\326\305\247\334\352i/\222\221\275W\250/\330\355BA\031<\341\325\"\204*\253~\003\350V\013\\\2045\246\213\364t\2173\276\333\231'\341\r%O\332A\005_\223\"+\227\241\231\265\001, \034\334\265\200\t\225\360\2379M\340\002VQ\367M\202M\303\004\317!\354\204\030\330 \211\340\316\316\312\373\0359\323\373\304\314\373\374w\327E\231\363\277\335)\b\355\215r\n\033g\341\215m\305\266\034S\255\220hI\371.\334\270@\374!O\304U\257\357\247\320\264\224\211C\rj^\321\\X \362\t\001\241\346\3561|Ij\tE]\033P\221\266XP\361\240\016f\374\353\034\325?\326\350\340sn\213\357\333\345Z\200\322x~\027'\200\270\272\254\306\215\275q\225\377\315\331\033"
+	.string	"C"
+	.ascii	"\272\217 \334eTbzG\246\"M\203c\341L=\376\255J\233\305Q\354\332"
+	.ascii	"\226_{Q*^g\3349\341s\271H\002X\2428|\372`6\352z\306\306r\202"
+	.ascii	"4\362e\216\336j\345G5Q\203\235\r\254\206w0\345\372&\377\347\020"
+	.ascii	"d\364\"b\372\f\306\244\t\r\213DT\212\321\220\232g\024\347\201"
+	.ascii	"\t\b(\341\016MvK\277\2440\002c\370\220\344\bs\246y\200\366\360"
+	.ascii	"\354\257\206\275\345\253\370}\277\355\243s\n\372\371s\256$_\356"
+	.ascii	"\317\212\261E\314\366\340\220\373\351t\234\315%4\250\315\342"
+	.ascii	"\223\022\323\031\262\334G\336\211./\b\355Lu<b\306$\007`\364<"
+	.ascii	"\261\276\361N2\324k\334\177\224f\210\337;\204\277\300\277(|\020"
+	.ascii	"\366;q\302\354.\341\021\266oEx\365\312wl\n\216-\b\274\251sn\262"
+	.ascii	"\335\250\317\276\337T\034\224\330\327\230\373@\2159W?\266\246"
+	.ascii	"\256\200\261b\372\376Tse\035\256\357:\212\253\266\335"
+	.ascii	"A\207\205bF!\377\232{\f\350?,\254\272|\342\325\275\304\033\224"
+	.ascii	"\217\245N\301\351 y\2718\2738*\353\225\340\240\353\360\362\025"
+	.ascii	"\201\233\031Y\264?\211~cj\371\222\3346F{\006\201\267\361\337"
+	.ascii	"\024\351\273a\376K\355\242\344Y\366\234F\366\376\3663\267F\364"
+	.ascii	"u\323\030g\276\026\237#\304\324\327\037\200y!\270\257G\f\026"
+	.ascii	"\227a\245\341\3575+pi\324\320\025"
+	.text
+	.section	.gnu.lto_.symtab.3410eeed5302ff03,"e",@progbits
+	.string	"gpsHandleMTK"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\202\002"
+	.string	""
+	.string	"gpsHandleNMEA"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\206\002"
+	.string	""
+	.string	"gpsRestartNMEA_MTK"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\211\002"
+	.string	""
+	.string	"gpsStats"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"d\002"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"f\002"
+	.string	""
+	.string	"gpsState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"m\002"
+	.string	""
+	.string	"gpsToSerialBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"u\002"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"y\002"
+	.string	""
+	.string	"gpsConstrainEPE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\215\002"
+	.string	""
+	.string	"gpsConstrainHDOP"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\217\002"
+	.string	""
+	.string	"GPS_coord_to_degrees"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\223\002"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\252\002"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\002"
+	.string	""
+	.string	"gpsProcessNewSolutionData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\002"
+	.string	""
+	.string	"gpsSetProtocolTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\264\002"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\002"
+	.string	""
+	.string	"serialPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\275\002"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\302\002"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\002"
+	.string	""
+	.string	"gpsSetState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\002"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.3410eeed5302ff03,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,19231 @@
+	.file	"gps_ublox.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/common/axis.h"
+	.file 6 "./src/main/drivers/resource.h"
+	.file 7 "./src/main/drivers/serial.h"
+	.file 8 "./src/main/drivers/adc.h"
+	.file 9 "./src/main/io/serial.h"
+	.file 10 "./src/main/io/gps.h"
+	.file 11 "./src/main/io/gps_private.h"
+	.file 12 "./src/main/scheduler/protothreads.h"
+	.file 13 "./src/main/io/gps_ublox.c"
+	.file 14 "./src/main/common/typeconversion.h"
+	.file 15 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	gps_ublox.c.dbc398af
+	.weak	gps_ublox.c.dbc398af
+gps_ublox.c.dbc398af:
+	.long	0x1c1f
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x23
+	.long	.LASF2575
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2090
+	.uleb128 0x24
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2091
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF2092
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF2093
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF2094
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF2095
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2096
+	.uleb128 0x3
+	.long	.LASF2097
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x3e
+	.uleb128 0x3
+	.long	.LASF2098
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x72
+	.uleb128 0xb
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF2099
+	.uleb128 0x3
+	.long	.LASF2100
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x45
+	.uleb128 0x3
+	.long	.LASF2101
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x29
+	.uleb128 0x3
+	.long	.LASF2102
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x4c
+	.uleb128 0x3
+	.long	.LASF2103
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x22
+	.uleb128 0x25
+	.byte	0x8
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF2104
+	.uleb128 0xd
+	.long	0xab
+	.uleb128 0x3
+	.long	.LASF2105
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x66
+	.uleb128 0x3
+	.long	.LASF2106
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x85
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF2107
+	.uleb128 0x6
+	.long	0xdb
+	.uleb128 0x26
+	.uleb128 0x3
+	.long	.LASF2108
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x5a
+	.uleb128 0xd
+	.long	0xdc
+	.uleb128 0x27
+	.long	0xdc
+	.uleb128 0x3
+	.long	.LASF2109
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x79
+	.uleb128 0x3
+	.long	.LASF2110
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x91
+	.uleb128 0xd
+	.long	0xfe
+	.uleb128 0x3
+	.long	.LASF2111
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0x9d
+	.uleb128 0x6
+	.long	0xb2
+	.uleb128 0xb
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF2112
+	.uleb128 0xb
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF2113
+	.uleb128 0x6
+	.long	0xdc
+	.uleb128 0x3
+	.long	.LASF2114
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x11
+	.long	0xc3
+	.uleb128 0x3
+	.long	.LASF2115
+	.byte	0x4
+	.byte	0x1e
+	.byte	0x12
+	.long	0xfe
+	.uleb128 0x3
+	.long	.LASF2116
+	.byte	0x4
+	.byte	0x21
+	.byte	0x12
+	.long	0x10f
+	.uleb128 0xf
+	.long	.LASF2199
+	.byte	0xa
+	.byte	0x4
+	.byte	0x49
+	.byte	0x10
+	.long	0x1c0
+	.uleb128 0x1
+	.long	.LASF2117
+	.byte	0x4
+	.byte	0x4b
+	.byte	0xe
+	.long	0xf2
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2118
+	.byte	0x4
+	.byte	0x4d
+	.byte	0xd
+	.long	0xdc
+	.byte	0x2
+	.uleb128 0x7
+	.string	"day"
+	.byte	0x4
+	.byte	0x4f
+	.byte	0xd
+	.long	0xdc
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2119
+	.byte	0x4
+	.byte	0x51
+	.byte	0xd
+	.long	0xdc
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2120
+	.byte	0x4
+	.byte	0x53
+	.byte	0xd
+	.long	0xdc
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2121
+	.byte	0x4
+	.byte	0x55
+	.byte	0xd
+	.long	0xdc
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2122
+	.byte	0x4
+	.byte	0x57
+	.byte	0xe
+	.long	0xf2
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2123
+	.byte	0x4
+	.byte	0x58
+	.byte	0x3
+	.long	0x157
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x5
+	.byte	0x14
+	.byte	0xe
+	.long	0x1e6
+	.uleb128 0x18
+	.string	"X"
+	.byte	0
+	.uleb128 0x18
+	.string	"Y"
+	.byte	0x1
+	.uleb128 0x18
+	.string	"Z"
+	.byte	0x2
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x6
+	.byte	0x16
+	.byte	0xe
+	.long	0x2d8
+	.uleb128 0x2
+	.long	.LASF2124
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2125
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2126
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2127
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2128
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2129
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2130
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2131
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF2132
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2133
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2134
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2135
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2136
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2137
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF2138
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2139
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF2140
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2141
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2142
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2143
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2144
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2145
+	.byte	0x15
+	.uleb128 0x2
+	.long	.LASF2146
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2147
+	.byte	0x17
+	.uleb128 0x2
+	.long	.LASF2148
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2149
+	.byte	0x19
+	.uleb128 0x2
+	.long	.LASF2150
+	.byte	0x1a
+	.uleb128 0x2
+	.long	.LASF2151
+	.byte	0x1b
+	.uleb128 0x2
+	.long	.LASF2152
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2153
+	.byte	0x1d
+	.uleb128 0x2
+	.long	.LASF2154
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2155
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2156
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2157
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2158
+	.byte	0x22
+	.uleb128 0x2
+	.long	.LASF2159
+	.byte	0x23
+	.uleb128 0x2
+	.long	.LASF2160
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2161
+	.byte	0x25
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x6
+	.byte	0x43
+	.byte	0xe
+	.long	0x364
+	.uleb128 0x2
+	.long	.LASF2162
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2163
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2164
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2165
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2166
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2167
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2168
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2169
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF2170
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2171
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2172
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2173
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2174
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2175
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF2176
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2177
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF2178
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2179
+	.byte	0x11
+	.uleb128 0x2
+	.long	.LASF2180
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2181
+	.byte	0x13
+	.uleb128 0x2
+	.long	.LASF2182
+	.byte	0x14
+	.byte	0
+	.uleb128 0x1d
+	.long	.LASF2186
+	.long	0x4c
+	.byte	0x1a
+	.long	0x385
+	.uleb128 0x2
+	.long	.LASF2183
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2184
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2185
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2186
+	.byte	0x7
+	.byte	0x1e
+	.byte	0x3
+	.long	0x364
+	.uleb128 0x1d
+	.long	.LASF2187
+	.long	0x4c
+	.byte	0x20
+	.long	0x3e2
+	.uleb128 0x2
+	.long	.LASF2188
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2189
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2190
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2191
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2192
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2193
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2194
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2195
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2196
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2197
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2198
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2187
+	.byte	0x7
+	.byte	0x34
+	.byte	0x3
+	.long	0x391
+	.uleb128 0xf
+	.long	.LASF2200
+	.byte	0x10
+	.byte	0x7
+	.byte	0x37
+	.byte	0x10
+	.long	0x416
+	.uleb128 0x1
+	.long	.LASF2201
+	.byte	0x7
+	.byte	0x38
+	.byte	0x14
+	.long	0x416
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2202
+	.byte	0x7
+	.byte	0x39
+	.byte	0x9
+	.long	0x29
+	.byte	0x8
+	.byte	0
+	.uleb128 0x6
+	.long	0xe8
+	.uleb128 0x3
+	.long	.LASF2203
+	.byte	0x7
+	.byte	0x3a
+	.byte	0x3
+	.long	0x3ee
+	.uleb128 0xd
+	.long	0x41b
+	.uleb128 0x3
+	.long	.LASF2204
+	.byte	0x7
+	.byte	0x3c
+	.byte	0x10
+	.long	0x438
+	.uleb128 0x6
+	.long	0x43d
+	.uleb128 0x11
+	.long	0x44d
+	.uleb128 0x4
+	.long	0xf2
+	.uleb128 0x4
+	.long	0xa9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2205
+	.byte	0x7
+	.byte	0x3d
+	.byte	0x10
+	.long	0x459
+	.uleb128 0x6
+	.long	0x45e
+	.uleb128 0x11
+	.long	0x473
+	.uleb128 0x4
+	.long	0x416
+	.uleb128 0x4
+	.long	0x29
+	.uleb128 0x4
+	.long	0xa9
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2206
+	.byte	0x60
+	.byte	0x7
+	.byte	0x3f
+	.byte	0x10
+	.long	0x55e
+	.uleb128 0x1
+	.long	.LASF2207
+	.byte	0x7
+	.byte	0x41
+	.byte	0x24
+	.long	0x61a
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2208
+	.byte	0x7
+	.byte	0x43
+	.byte	0xd
+	.long	0xdc
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2209
+	.byte	0x7
+	.byte	0x44
+	.byte	0x10
+	.long	0x385
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2210
+	.byte	0x7
+	.byte	0x45
+	.byte	0x13
+	.long	0x3e2
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2211
+	.byte	0x7
+	.byte	0x47
+	.byte	0xe
+	.long	0xfe
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2212
+	.byte	0x7
+	.byte	0x49
+	.byte	0xe
+	.long	0xfe
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2213
+	.byte	0x7
+	.byte	0x4a
+	.byte	0xe
+	.long	0xfe
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2214
+	.byte	0x7
+	.byte	0x4b
+	.byte	0x17
+	.long	0x61f
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2215
+	.byte	0x7
+	.byte	0x4c
+	.byte	0x17
+	.long	0x61f
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2216
+	.byte	0x7
+	.byte	0x4d
+	.byte	0xe
+	.long	0xfe
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2217
+	.byte	0x7
+	.byte	0x4e
+	.byte	0xe
+	.long	0xfe
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF2218
+	.byte	0x7
+	.byte	0x4f
+	.byte	0xe
+	.long	0xfe
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF2219
+	.byte	0x7
+	.byte	0x50
+	.byte	0xe
+	.long	0xfe
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF2220
+	.byte	0x7
+	.byte	0x52
+	.byte	0x1e
+	.long	0x42c
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2221
+	.byte	0x7
+	.byte	0x53
+	.byte	0xb
+	.long	0xa9
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF2222
+	.byte	0x7
+	.byte	0x55
+	.byte	0x23
+	.long	0x44d
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF2223
+	.byte	0x7
+	.byte	0x58
+	.byte	0xe
+	.long	0xfe
+	.byte	0x58
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2224
+	.byte	0x68
+	.byte	0x7
+	.byte	0x5b
+	.byte	0x8
+	.long	0x615
+	.uleb128 0x1
+	.long	.LASF2225
+	.byte	0x7
+	.byte	0x5c
+	.byte	0xc
+	.long	0x64a
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2226
+	.byte	0x7
+	.byte	0x5e
+	.byte	0x10
+	.long	0x663
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2227
+	.byte	0x7
+	.byte	0x5f
+	.byte	0x10
+	.long	0x663
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2228
+	.byte	0x7
+	.byte	0x61
+	.byte	0xf
+	.long	0x677
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2229
+	.byte	0x7
+	.byte	0x64
+	.byte	0xc
+	.long	0x68c
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2230
+	.byte	0x7
+	.byte	0x66
+	.byte	0xb
+	.long	0x6a7
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2231
+	.byte	0x7
+	.byte	0x68
+	.byte	0xc
+	.long	0x6bc
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2232
+	.byte	0x7
+	.byte	0x6a
+	.byte	0xc
+	.long	0x6d6
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF2233
+	.byte	0x7
+	.byte	0x6c
+	.byte	0xb
+	.long	0x6a7
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2234
+	.byte	0x7
+	.byte	0x6e
+	.byte	0xb
+	.long	0x6ea
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF2235
+	.byte	0x7
+	.byte	0x71
+	.byte	0xc
+	.long	0x6fa
+	.byte	0x50
+	.uleb128 0x1
+	.long	.LASF2236
+	.byte	0x7
+	.byte	0x72
+	.byte	0xc
+	.long	0x6fa
+	.byte	0x58
+	.uleb128 0x1
+	.long	.LASF2237
+	.byte	0x7
+	.byte	0x75
+	.byte	0xc
+	.long	0x719
+	.byte	0x60
+	.byte	0
+	.uleb128 0xd
+	.long	0x55e
+	.uleb128 0x6
+	.long	0x615
+	.uleb128 0x6
+	.long	0xed
+	.uleb128 0x3
+	.long	.LASF2238
+	.byte	0x7
+	.byte	0x59
+	.byte	0x3
+	.long	0x473
+	.uleb128 0xd
+	.long	0x624
+	.uleb128 0x11
+	.long	0x645
+	.uleb128 0x4
+	.long	0x645
+	.uleb128 0x4
+	.long	0xdc
+	.byte	0
+	.uleb128 0x6
+	.long	0x624
+	.uleb128 0x6
+	.long	0x635
+	.uleb128 0x16
+	.long	0xfe
+	.long	0x65e
+	.uleb128 0x4
+	.long	0x65e
+	.byte	0
+	.uleb128 0x6
+	.long	0x630
+	.uleb128 0x6
+	.long	0x64f
+	.uleb128 0x16
+	.long	0xdc
+	.long	0x677
+	.uleb128 0x4
+	.long	0x645
+	.byte	0
+	.uleb128 0x6
+	.long	0x668
+	.uleb128 0x11
+	.long	0x68c
+	.uleb128 0x4
+	.long	0x645
+	.uleb128 0x4
+	.long	0xfe
+	.byte	0
+	.uleb128 0x6
+	.long	0x67c
+	.uleb128 0x16
+	.long	0x6a0
+	.long	0x6a0
+	.uleb128 0x4
+	.long	0x65e
+	.byte	0
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2239
+	.uleb128 0x6
+	.long	0x691
+	.uleb128 0x11
+	.long	0x6bc
+	.uleb128 0x4
+	.long	0x645
+	.uleb128 0x4
+	.long	0x385
+	.byte	0
+	.uleb128 0x6
+	.long	0x6ac
+	.uleb128 0x11
+	.long	0x6d6
+	.uleb128 0x4
+	.long	0x645
+	.uleb128 0x4
+	.long	0xd6
+	.uleb128 0x4
+	.long	0x29
+	.byte	0
+	.uleb128 0x6
+	.long	0x6c1
+	.uleb128 0x16
+	.long	0x6a0
+	.long	0x6ea
+	.uleb128 0x4
+	.long	0x645
+	.byte	0
+	.uleb128 0x6
+	.long	0x6db
+	.uleb128 0x11
+	.long	0x6fa
+	.uleb128 0x4
+	.long	0x645
+	.byte	0
+	.uleb128 0x6
+	.long	0x6ef
+	.uleb128 0x11
+	.long	0x714
+	.uleb128 0x4
+	.long	0x645
+	.uleb128 0x4
+	.long	0x714
+	.uleb128 0x4
+	.long	0x29
+	.byte	0
+	.uleb128 0x6
+	.long	0x427
+	.uleb128 0x6
+	.long	0x6ff
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x8
+	.byte	0x16
+	.byte	0xe
+	.long	0x74a
+	.uleb128 0x2
+	.long	.LASF2240
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2241
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2242
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2243
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2244
+	.byte	0x4
+	.byte	0
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0x9
+	.byte	0x3b
+	.byte	0xe
+	.long	0x7be
+	.uleb128 0x2
+	.long	.LASF2245
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2246
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2247
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2248
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2249
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2250
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2251
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2252
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF2253
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2254
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2255
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2256
+	.byte	0xb
+	.uleb128 0x2
+	.long	.LASF2257
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2258
+	.byte	0xd
+	.uleb128 0x2
+	.long	.LASF2259
+	.byte	0xe
+	.uleb128 0x2
+	.long	.LASF2260
+	.byte	0xf
+	.uleb128 0x2
+	.long	.LASF2261
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2262
+	.byte	0x9
+	.byte	0x4d
+	.byte	0x3
+	.long	0x74a
+	.uleb128 0xa
+	.long	0x10a
+	.long	0x7d5
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0xd
+	.long	0x7ca
+	.uleb128 0x14
+	.long	.LASF2358
+	.byte	0x9
+	.byte	0x4f
+	.byte	0x17
+	.long	0x7d5
+	.uleb128 0x9
+	.byte	0x5
+	.long	0x29
+	.byte	0x9
+	.byte	0x52
+	.byte	0xe
+	.long	0x842
+	.uleb128 0x29
+	.long	.LASF2263
+	.sleb128 -1
+	.uleb128 0x2
+	.long	.LASF2264
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2265
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2266
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2267
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2268
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2269
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2270
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2271
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF2272
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2273
+	.byte	0x1e
+	.uleb128 0x2
+	.long	.LASF2274
+	.byte	0x1f
+	.uleb128 0x2
+	.long	.LASF2275
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2276
+	.byte	0x9
+	.byte	0x60
+	.byte	0x3
+	.long	0x7e6
+	.uleb128 0xf
+	.long	.LASF2277
+	.byte	0xc
+	.byte	0x9
+	.byte	0x73
+	.byte	0x10
+	.long	0x8aa
+	.uleb128 0x1
+	.long	.LASF2278
+	.byte	0x9
+	.byte	0x74
+	.byte	0xe
+	.long	0xfe
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2208
+	.byte	0x9
+	.byte	0x75
+	.byte	0x1c
+	.long	0x842
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2279
+	.byte	0x9
+	.byte	0x76
+	.byte	0xd
+	.long	0xdc
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2280
+	.byte	0x9
+	.byte	0x77
+	.byte	0xd
+	.long	0xdc
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2281
+	.byte	0x9
+	.byte	0x78
+	.byte	0xd
+	.long	0xdc
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2282
+	.byte	0x9
+	.byte	0x79
+	.byte	0xd
+	.long	0xdc
+	.byte	0xb
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2283
+	.byte	0x9
+	.byte	0x7a
+	.byte	0x3
+	.long	0x84e
+	.uleb128 0xf
+	.long	.LASF2284
+	.byte	0x64
+	.byte	0x9
+	.byte	0x7c
+	.byte	0x10
+	.long	0x8de
+	.uleb128 0x1
+	.long	.LASF2285
+	.byte	0x9
+	.byte	0x7d
+	.byte	0x18
+	.long	0x8de
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2286
+	.byte	0x9
+	.byte	0x7e
+	.byte	0xd
+	.long	0xdc
+	.byte	0x60
+	.byte	0
+	.uleb128 0xa
+	.long	0x8aa
+	.long	0x8ee
+	.uleb128 0xc
+	.long	0x22
+	.byte	0x7
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2287
+	.byte	0x9
+	.byte	0x7f
+	.byte	0x3
+	.long	0x8b6
+	.uleb128 0xd
+	.long	0x8ee
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0xa
+	.byte	0x22
+	.byte	0xe
+	.long	0x937
+	.uleb128 0x2
+	.long	.LASF2288
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2289
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2290
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2291
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2292
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2293
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2294
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2295
+	.byte	0xa
+	.byte	0x2a
+	.byte	0x3
+	.long	0x8ff
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0xa
+	.byte	0x2c
+	.byte	0xe
+	.long	0x975
+	.uleb128 0x2
+	.long	.LASF2296
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2297
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2298
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2299
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2300
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2301
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2302
+	.byte	0xa
+	.byte	0x33
+	.byte	0x3
+	.long	0x943
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0xa
+	.byte	0x37
+	.byte	0xe
+	.long	0x9b3
+	.uleb128 0x2
+	.long	.LASF2303
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2304
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2305
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2306
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2307
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2308
+	.byte	0x5
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2309
+	.byte	0xa
+	.byte	0x3e
+	.byte	0x3
+	.long	0x981
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0xa
+	.byte	0x40
+	.byte	0xe
+	.long	0x9d9
+	.uleb128 0x2
+	.long	.LASF2310
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2311
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2312
+	.byte	0xa
+	.byte	0x43
+	.byte	0x3
+	.long	0x9bf
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0xa
+	.byte	0x45
+	.byte	0xe
+	.long	0x9ff
+	.uleb128 0x2
+	.long	.LASF2313
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2314
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2315
+	.byte	0xa
+	.byte	0x48
+	.byte	0x3
+	.long	0x9e5
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0xa
+	.byte	0x4a
+	.byte	0xe
+	.long	0xa2b
+	.uleb128 0x2
+	.long	.LASF2316
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2317
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2318
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2319
+	.byte	0xa
+	.byte	0x4e
+	.byte	0x3
+	.long	0xa0b
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0xa
+	.byte	0x50
+	.byte	0xe
+	.long	0xa57
+	.uleb128 0x2
+	.long	.LASF2320
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2321
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2322
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2323
+	.byte	0xa
+	.byte	0x54
+	.byte	0x3
+	.long	0xa37
+	.uleb128 0xf
+	.long	.LASF2324
+	.byte	0x18
+	.byte	0xa
+	.byte	0x58
+	.byte	0x10
+	.long	0xacc
+	.uleb128 0x1
+	.long	.LASF2325
+	.byte	0xa
+	.byte	0x59
+	.byte	0x13
+	.long	0x937
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2326
+	.byte	0xa
+	.byte	0x5a
+	.byte	0x10
+	.long	0x975
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2327
+	.byte	0xa
+	.byte	0x5b
+	.byte	0x15
+	.long	0x9d9
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2328
+	.byte	0xa
+	.byte	0x5c
+	.byte	0x13
+	.long	0x9ff
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2329
+	.byte	0xa
+	.byte	0x5d
+	.byte	0x13
+	.long	0xa2b
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2330
+	.byte	0xa
+	.byte	0x5e
+	.byte	0x9
+	.long	0x6a0
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2331
+	.byte	0xa
+	.byte	0x5f
+	.byte	0xd
+	.long	0xdc
+	.byte	0x15
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2332
+	.byte	0xa
+	.byte	0x60
+	.byte	0x3
+	.long	0xa63
+	.uleb128 0xd
+	.long	0xacc
+	.uleb128 0xf
+	.long	.LASF2333
+	.byte	0xc
+	.byte	0xa
+	.byte	0x6a
+	.byte	0x10
+	.long	0xb12
+	.uleb128 0x7
+	.string	"lat"
+	.byte	0xa
+	.byte	0x6b
+	.byte	0xd
+	.long	0xc3
+	.byte	0
+	.uleb128 0x7
+	.string	"lon"
+	.byte	0xa
+	.byte	0x6c
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x7
+	.string	"alt"
+	.byte	0xa
+	.byte	0x6d
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2334
+	.byte	0xa
+	.byte	0x6e
+	.byte	0x3
+	.long	0xadd
+	.uleb128 0x8
+	.byte	0x7
+	.byte	0xa
+	.byte	0x73
+	.byte	0x5
+	.long	0xb83
+	.uleb128 0x1
+	.long	.LASF2335
+	.byte	0xa
+	.byte	0x74
+	.byte	0xd
+	.long	0x6a0
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2336
+	.byte	0xa
+	.byte	0x75
+	.byte	0xd
+	.long	0x6a0
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2337
+	.byte	0xa
+	.byte	0x76
+	.byte	0xd
+	.long	0x6a0
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2338
+	.byte	0xa
+	.byte	0x77
+	.byte	0xd
+	.long	0x6a0
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2339
+	.byte	0xa
+	.byte	0x78
+	.byte	0xd
+	.long	0x6a0
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2340
+	.byte	0xa
+	.byte	0x79
+	.byte	0xd
+	.long	0x6a0
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2341
+	.byte	0xa
+	.byte	0x7a
+	.byte	0xd
+	.long	0x6a0
+	.byte	0x6
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2342
+	.byte	0x3c
+	.byte	0xa
+	.byte	0x72
+	.byte	0x10
+	.long	0xc2d
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0xa
+	.byte	0x7b
+	.byte	0x7
+	.long	0xb1e
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2344
+	.byte	0xa
+	.byte	0x7d
+	.byte	0x12
+	.long	0xa57
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2345
+	.byte	0xa
+	.byte	0x7e
+	.byte	0xd
+	.long	0xdc
+	.byte	0xc
+	.uleb128 0x7
+	.string	"llh"
+	.byte	0xa
+	.byte	0x80
+	.byte	0x13
+	.long	0xb12
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2346
+	.byte	0xa
+	.byte	0x81
+	.byte	0xd
+	.long	0xc2d
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2347
+	.byte	0xa
+	.byte	0x82
+	.byte	0xd
+	.long	0xc2d
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF2348
+	.byte	0xa
+	.byte	0x84
+	.byte	0xd
+	.long	0xb7
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2349
+	.byte	0xa
+	.byte	0x85
+	.byte	0xd
+	.long	0xb7
+	.byte	0x2a
+	.uleb128 0x7
+	.string	"eph"
+	.byte	0xa
+	.byte	0x87
+	.byte	0xe
+	.long	0xf2
+	.byte	0x2c
+	.uleb128 0x7
+	.string	"epv"
+	.byte	0xa
+	.byte	0x88
+	.byte	0xe
+	.long	0xf2
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF2350
+	.byte	0xa
+	.byte	0x8a
+	.byte	0xe
+	.long	0xf2
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0xa
+	.byte	0x8c
+	.byte	0x10
+	.long	0x1c0
+	.byte	0x32
+	.byte	0
+	.uleb128 0xa
+	.long	0xb7
+	.long	0xc3d
+	.uleb128 0xc
+	.long	0x22
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2352
+	.byte	0xa
+	.byte	0x8e
+	.byte	0x3
+	.long	0xb83
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0xa
+	.byte	0x90
+	.byte	0x9
+	.long	0xc87
+	.uleb128 0x1
+	.long	.LASF2353
+	.byte	0xa
+	.byte	0x91
+	.byte	0xe
+	.long	0xf2
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2354
+	.byte	0xa
+	.byte	0x92
+	.byte	0xe
+	.long	0xfe
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2355
+	.byte	0xa
+	.byte	0x93
+	.byte	0xe
+	.long	0xfe
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2356
+	.byte	0xa
+	.byte	0x94
+	.byte	0xe
+	.long	0xfe
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2357
+	.byte	0xa
+	.byte	0x95
+	.byte	0x3
+	.long	0xc49
+	.uleb128 0x14
+	.long	.LASF2359
+	.byte	0xa
+	.byte	0x97
+	.byte	0x1a
+	.long	0xc3d
+	.uleb128 0x14
+	.long	.LASF2360
+	.byte	0xa
+	.byte	0x98
+	.byte	0x18
+	.long	0xc87
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0xb
+	.byte	0x21
+	.byte	0xe
+	.long	0xcd1
+	.uleb128 0x2
+	.long	.LASF2361
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2362
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2363
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2364
+	.byte	0x3
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2365
+	.byte	0xb
+	.byte	0x26
+	.byte	0x3
+	.long	0xcab
+	.uleb128 0x8
+	.byte	0x40
+	.byte	0xb
+	.byte	0x28
+	.byte	0x9
+	.long	0xd83
+	.uleb128 0x1
+	.long	.LASF2366
+	.byte	0xb
+	.byte	0x29
+	.byte	0x19
+	.long	0xd83
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2367
+	.byte	0xb
+	.byte	0x2a
+	.byte	0x1c
+	.long	0xd88
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2368
+	.byte	0xb
+	.byte	0x2b
+	.byte	0x14
+	.long	0x645
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0xb
+	.byte	0x2d
+	.byte	0xe
+	.long	0xfe
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2370
+	.byte	0xb
+	.byte	0x2f
+	.byte	0x10
+	.long	0xcd1
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2371
+	.byte	0xb
+	.byte	0x30
+	.byte	0x13
+	.long	0x9b3
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2372
+	.byte	0xb
+	.byte	0x31
+	.byte	0x13
+	.long	0x9b3
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2373
+	.byte	0xb
+	.byte	0x32
+	.byte	0xd
+	.long	0xdc
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2374
+	.byte	0xb
+	.byte	0x34
+	.byte	0xe
+	.long	0x13f
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2375
+	.byte	0xb
+	.byte	0x35
+	.byte	0xe
+	.long	0x13f
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2376
+	.byte	0xb
+	.byte	0x36
+	.byte	0xe
+	.long	0x13f
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF2377
+	.byte	0xb
+	.byte	0x37
+	.byte	0xe
+	.long	0x13f
+	.byte	0x38
+	.byte	0
+	.uleb128 0x6
+	.long	0xad8
+	.uleb128 0x6
+	.long	0x8fa
+	.uleb128 0x3
+	.long	.LASF2378
+	.byte	0xb
+	.byte	0x38
+	.byte	0x3
+	.long	0xcdd
+	.uleb128 0x14
+	.long	.LASF2379
+	.byte	0xb
+	.byte	0x3a
+	.byte	0x1a
+	.long	0xd8d
+	.uleb128 0xa
+	.long	0x7be
+	.long	0xdb5
+	.uleb128 0xc
+	.long	0x22
+	.byte	0x4
+	.byte	0
+	.uleb128 0x14
+	.long	.LASF2380
+	.byte	0xb
+	.byte	0x3c
+	.byte	0x13
+	.long	0xda5
+	.uleb128 0xf
+	.long	.LASF2381
+	.byte	0x18
+	.byte	0xc
+	.byte	0x40
+	.byte	0x8
+	.long	0xe03
+	.uleb128 0x1
+	.long	.LASF2382
+	.byte	0xc
+	.byte	0x41
+	.byte	0x7
+	.long	0x29
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2383
+	.byte	0xc
+	.byte	0x42
+	.byte	0x7
+	.long	0x29
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2384
+	.byte	0xc
+	.byte	0x43
+	.byte	0xc
+	.long	0x14b
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2385
+	.byte	0xc
+	.byte	0x44
+	.byte	0xf
+	.long	0x133
+	.byte	0x10
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2386
+	.byte	0xc
+	.byte	0xc9
+	.byte	0xd
+	.long	0x6a0
+	.uleb128 0xa
+	.long	0x10a
+	.long	0xe1f
+	.uleb128 0xc
+	.long	0x22
+	.byte	0x5
+	.byte	0
+	.uleb128 0xd
+	.long	0xe0f
+	.uleb128 0x1e
+	.long	.LASF2387
+	.byte	0x46
+	.byte	0x17
+	.long	0xe1f
+	.uleb128 0xa
+	.long	0x11b
+	.long	0xe3f
+	.uleb128 0xc
+	.long	0x22
+	.byte	0x4
+	.byte	0
+	.uleb128 0x1e
+	.long	.LASF2388
+	.byte	0x4a
+	.byte	0x15
+	.long	0xe2f
+	.uleb128 0x8
+	.byte	0x8
+	.byte	0xd
+	.byte	0x53
+	.byte	0x9
+	.long	0xe95
+	.uleb128 0x1
+	.long	.LASF2209
+	.byte	0xd
+	.byte	0x54
+	.byte	0xd
+	.long	0xdc
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2389
+	.byte	0xd
+	.byte	0x55
+	.byte	0xd
+	.long	0xdc
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2390
+	.byte	0xd
+	.byte	0x56
+	.byte	0xd
+	.long	0xdc
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2391
+	.byte	0xd
+	.byte	0x57
+	.byte	0xd
+	.long	0xdc
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2392
+	.byte	0xd
+	.byte	0x58
+	.byte	0xe
+	.long	0xfe
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2393
+	.byte	0xd
+	.byte	0x59
+	.byte	0x3
+	.long	0xe4a
+	.uleb128 0x8
+	.byte	0x3
+	.byte	0xd
+	.byte	0x5b
+	.byte	0x9
+	.long	0xed1
+	.uleb128 0x1
+	.long	.LASF2394
+	.byte	0xd
+	.byte	0x5c
+	.byte	0xd
+	.long	0xdc
+	.byte	0
+	.uleb128 0x7
+	.string	"id"
+	.byte	0xd
+	.byte	0x5d
+	.byte	0xd
+	.long	0xdc
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2395
+	.byte	0xd
+	.byte	0x5e
+	.byte	0xd
+	.long	0xdc
+	.byte	0x2
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2396
+	.byte	0xd
+	.byte	0x5f
+	.byte	0x3
+	.long	0xea1
+	.uleb128 0x8
+	.byte	0x6
+	.byte	0xd
+	.byte	0x61
+	.byte	0x9
+	.long	0xf0e
+	.uleb128 0x1
+	.long	.LASF2397
+	.byte	0xd
+	.byte	0x62
+	.byte	0xe
+	.long	0xf2
+	.byte	0
+	.uleb128 0x7
+	.string	"nav"
+	.byte	0xd
+	.byte	0x63
+	.byte	0xe
+	.long	0xf2
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0xd
+	.byte	0x64
+	.byte	0xe
+	.long	0xf2
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2398
+	.byte	0xd
+	.byte	0x65
+	.byte	0x3
+	.long	0xedd
+	.uleb128 0x2a
+	.byte	0x3c
+	.byte	0xd
+	.byte	0x67
+	.byte	0x9
+	.long	0xf51
+	.uleb128 0x19
+	.long	.LASF2399
+	.byte	0x68
+	.byte	0xd
+	.long	0xf51
+	.uleb128 0x19
+	.long	.LASF2400
+	.byte	0x69
+	.byte	0xe
+	.long	0xe95
+	.uleb128 0x2b
+	.string	"msg"
+	.byte	0xd
+	.byte	0x6a
+	.byte	0xd
+	.long	0xed1
+	.uleb128 0x19
+	.long	.LASF2395
+	.byte	0x6b
+	.byte	0xe
+	.long	0xf0e
+	.byte	0
+	.uleb128 0xa
+	.long	0xdc
+	.long	0xf61
+	.uleb128 0xc
+	.long	0x22
+	.byte	0x3b
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2401
+	.byte	0xd
+	.byte	0x6c
+	.byte	0x3
+	.long	0xf1a
+	.uleb128 0x8
+	.byte	0x6
+	.byte	0xd
+	.byte	0x6f
+	.byte	0x9
+	.long	0xfb8
+	.uleb128 0x1
+	.long	.LASF2402
+	.byte	0xd
+	.byte	0x70
+	.byte	0xd
+	.long	0xdc
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2403
+	.byte	0xd
+	.byte	0x71
+	.byte	0xd
+	.long	0xdc
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2404
+	.byte	0xd
+	.byte	0x72
+	.byte	0xd
+	.long	0xdc
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2405
+	.byte	0xd
+	.byte	0x73
+	.byte	0xd
+	.long	0xdc
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2406
+	.byte	0xd
+	.byte	0x74
+	.byte	0xe
+	.long	0xf2
+	.byte	0x4
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2407
+	.byte	0xd
+	.byte	0x75
+	.byte	0x3
+	.long	0xf6d
+	.uleb128 0x8
+	.byte	0x42
+	.byte	0xd
+	.byte	0x77
+	.byte	0x9
+	.long	0xfe8
+	.uleb128 0x1
+	.long	.LASF2408
+	.byte	0xd
+	.byte	0x78
+	.byte	0x10
+	.long	0xfb8
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2409
+	.byte	0xd
+	.byte	0x79
+	.byte	0x11
+	.long	0xf61
+	.byte	0x6
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2410
+	.byte	0xd
+	.byte	0x7a
+	.byte	0x1b
+	.long	0xfc4
+	.uleb128 0x8
+	.byte	0x28
+	.byte	0xd
+	.byte	0x7c
+	.byte	0x9
+	.long	0x1018
+	.uleb128 0x1
+	.long	.LASF2411
+	.byte	0xd
+	.byte	0x7d
+	.byte	0xa
+	.long	0x1018
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2369
+	.byte	0xd
+	.byte	0x7e
+	.byte	0xa
+	.long	0x1028
+	.byte	0x1e
+	.byte	0
+	.uleb128 0xa
+	.long	0xab
+	.long	0x1028
+	.uleb128 0xc
+	.long	0x22
+	.byte	0x1d
+	.byte	0
+	.uleb128 0xa
+	.long	0xab
+	.long	0x1038
+	.uleb128 0xc
+	.long	0x22
+	.byte	0x9
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2412
+	.byte	0xd
+	.byte	0x7f
+	.byte	0x3
+	.long	0xff4
+	.uleb128 0x8
+	.byte	0x1c
+	.byte	0xd
+	.byte	0x81
+	.byte	0x9
+	.long	0x10a9
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0xd
+	.byte	0x82
+	.byte	0xe
+	.long	0xfe
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2413
+	.byte	0xd
+	.byte	0x83
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2414
+	.byte	0xd
+	.byte	0x84
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0xd
+	.byte	0x85
+	.byte	0xd
+	.long	0xc3
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2416
+	.byte	0xd
+	.byte	0x86
+	.byte	0xd
+	.long	0xc3
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2417
+	.byte	0xd
+	.byte	0x87
+	.byte	0xe
+	.long	0xfe
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2418
+	.byte	0xd
+	.byte	0x88
+	.byte	0xe
+	.long	0xfe
+	.byte	0x18
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2419
+	.byte	0xd
+	.byte	0x89
+	.byte	0x3
+	.long	0x1044
+	.uleb128 0x8
+	.byte	0x10
+	.byte	0xd
+	.byte	0x8b
+	.byte	0x9
+	.long	0x111a
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0xd
+	.byte	0x8c
+	.byte	0xe
+	.long	0xfe
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2420
+	.byte	0xd
+	.byte	0x8d
+	.byte	0xd
+	.long	0xdc
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2421
+	.byte	0xd
+	.byte	0x8e
+	.byte	0xd
+	.long	0xdc
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2422
+	.byte	0xd
+	.byte	0x8f
+	.byte	0xd
+	.long	0xdc
+	.byte	0x6
+	.uleb128 0x7
+	.string	"res"
+	.byte	0xd
+	.byte	0x90
+	.byte	0xd
+	.long	0xdc
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2423
+	.byte	0xd
+	.byte	0x91
+	.byte	0xe
+	.long	0xfe
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2424
+	.byte	0xd
+	.byte	0x92
+	.byte	0xe
+	.long	0xfe
+	.byte	0xc
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2425
+	.byte	0xd
+	.byte	0x93
+	.byte	0x3
+	.long	0x10b5
+	.uleb128 0x8
+	.byte	0x34
+	.byte	0xd
+	.byte	0x95
+	.byte	0x9
+	.long	0x120d
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0xd
+	.byte	0x96
+	.byte	0xe
+	.long	0xfe
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2426
+	.byte	0xd
+	.byte	0x97
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2427
+	.byte	0xd
+	.byte	0x98
+	.byte	0xd
+	.long	0xb7
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2420
+	.byte	0xd
+	.byte	0x99
+	.byte	0xd
+	.long	0xdc
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2421
+	.byte	0xd
+	.byte	0x9a
+	.byte	0xd
+	.long	0xdc
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2428
+	.byte	0xd
+	.byte	0x9b
+	.byte	0xd
+	.long	0xc3
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2429
+	.byte	0xd
+	.byte	0x9c
+	.byte	0xd
+	.long	0xc3
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2430
+	.byte	0xd
+	.byte	0x9d
+	.byte	0xd
+	.long	0xc3
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2431
+	.byte	0xd
+	.byte	0x9e
+	.byte	0xe
+	.long	0xfe
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2432
+	.byte	0xd
+	.byte	0x9f
+	.byte	0xd
+	.long	0xc3
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2433
+	.byte	0xd
+	.byte	0xa0
+	.byte	0xd
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2434
+	.byte	0xd
+	.byte	0xa1
+	.byte	0xd
+	.long	0xc3
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0xd
+	.byte	0xa2
+	.byte	0xe
+	.long	0xfe
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0xd
+	.byte	0xa3
+	.byte	0xe
+	.long	0xf2
+	.byte	0x2c
+	.uleb128 0x7
+	.string	"res"
+	.byte	0xd
+	.byte	0xa4
+	.byte	0xd
+	.long	0xdc
+	.byte	0x2e
+	.uleb128 0x1
+	.long	.LASF2437
+	.byte	0xd
+	.byte	0xa5
+	.byte	0xd
+	.long	0xdc
+	.byte	0x2f
+	.uleb128 0x1
+	.long	.LASF2438
+	.byte	0xd
+	.byte	0xa6
+	.byte	0xe
+	.long	0xfe
+	.byte	0x30
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2439
+	.byte	0xd
+	.byte	0xa7
+	.byte	0x3
+	.long	0x1126
+	.uleb128 0x8
+	.byte	0x24
+	.byte	0xd
+	.byte	0xa9
+	.byte	0x9
+	.long	0x1298
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0xd
+	.byte	0xaa
+	.byte	0xe
+	.long	0xfe
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2440
+	.byte	0xd
+	.byte	0xab
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2441
+	.byte	0xd
+	.byte	0xac
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2442
+	.byte	0xd
+	.byte	0xad
+	.byte	0xd
+	.long	0xc3
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2443
+	.byte	0xd
+	.byte	0xae
+	.byte	0xe
+	.long	0xfe
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2444
+	.byte	0xd
+	.byte	0xaf
+	.byte	0xe
+	.long	0xfe
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2445
+	.byte	0xd
+	.byte	0xb0
+	.byte	0xd
+	.long	0xc3
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0xd
+	.byte	0xb1
+	.byte	0xe
+	.long	0xfe
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2446
+	.byte	0xd
+	.byte	0xb2
+	.byte	0xe
+	.long	0xfe
+	.byte	0x20
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2447
+	.byte	0xd
+	.byte	0xb3
+	.byte	0x3
+	.long	0x1219
+	.uleb128 0x8
+	.byte	0xc
+	.byte	0xd
+	.byte	0xb5
+	.byte	0x9
+	.long	0x1316
+	.uleb128 0x7
+	.string	"chn"
+	.byte	0xd
+	.byte	0xb6
+	.byte	0xd
+	.long	0xdc
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2448
+	.byte	0xd
+	.byte	0xb7
+	.byte	0xd
+	.long	0xdc
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2343
+	.byte	0xd
+	.byte	0xb8
+	.byte	0xd
+	.long	0xdc
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2449
+	.byte	0xd
+	.byte	0xb9
+	.byte	0xd
+	.long	0xdc
+	.byte	0x3
+	.uleb128 0x7
+	.string	"cno"
+	.byte	0xd
+	.byte	0xba
+	.byte	0xd
+	.long	0xdc
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2450
+	.byte	0xd
+	.byte	0xbb
+	.byte	0xd
+	.long	0xdc
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2451
+	.byte	0xd
+	.byte	0xbc
+	.byte	0xd
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2452
+	.byte	0xd
+	.byte	0xbd
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2453
+	.byte	0xd
+	.byte	0xbe
+	.byte	0x3
+	.long	0x12a4
+	.uleb128 0x8
+	.byte	0xc8
+	.byte	0xd
+	.byte	0xc0
+	.byte	0x9
+	.long	0x136d
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0xd
+	.byte	0xc1
+	.byte	0xe
+	.long	0xfe
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2454
+	.byte	0xd
+	.byte	0xc2
+	.byte	0xd
+	.long	0xdc
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2455
+	.byte	0xd
+	.byte	0xc3
+	.byte	0xd
+	.long	0xdc
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2456
+	.byte	0xd
+	.byte	0xc4
+	.byte	0xe
+	.long	0xf2
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2457
+	.byte	0xd
+	.byte	0xc5
+	.byte	0x1c
+	.long	0x136d
+	.byte	0x8
+	.byte	0
+	.uleb128 0xa
+	.long	0x1316
+	.long	0x137d
+	.uleb128 0xc
+	.long	0x22
+	.byte	0xf
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2458
+	.byte	0xd
+	.byte	0xc6
+	.byte	0x3
+	.long	0x1322
+	.uleb128 0x8
+	.byte	0x14
+	.byte	0xd
+	.byte	0xc8
+	.byte	0x9
+	.long	0x1415
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0xd
+	.byte	0xc9
+	.byte	0xe
+	.long	0xfe
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2459
+	.byte	0xd
+	.byte	0xca
+	.byte	0xe
+	.long	0xfe
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2460
+	.byte	0xd
+	.byte	0xcb
+	.byte	0xd
+	.long	0xc3
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2117
+	.byte	0xd
+	.byte	0xcc
+	.byte	0xe
+	.long	0xf2
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2118
+	.byte	0xd
+	.byte	0xcd
+	.byte	0xd
+	.long	0xdc
+	.byte	0xe
+	.uleb128 0x7
+	.string	"day"
+	.byte	0xd
+	.byte	0xce
+	.byte	0xd
+	.long	0xdc
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2461
+	.byte	0xd
+	.byte	0xcf
+	.byte	0xd
+	.long	0xdc
+	.byte	0x10
+	.uleb128 0x7
+	.string	"min"
+	.byte	0xd
+	.byte	0xd0
+	.byte	0xd
+	.long	0xdc
+	.byte	0x11
+	.uleb128 0x7
+	.string	"sec"
+	.byte	0xd
+	.byte	0xd1
+	.byte	0xd
+	.long	0xdc
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2462
+	.byte	0xd
+	.byte	0xd2
+	.byte	0xd
+	.long	0xdc
+	.byte	0x13
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2463
+	.byte	0xd
+	.byte	0xd3
+	.byte	0x3
+	.long	0x1389
+	.uleb128 0x8
+	.byte	0x54
+	.byte	0xd
+	.byte	0xd5
+	.byte	0x9
+	.long	0x15b1
+	.uleb128 0x1
+	.long	.LASF2351
+	.byte	0xd
+	.byte	0xd6
+	.byte	0xe
+	.long	0xfe
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2117
+	.byte	0xd
+	.byte	0xd7
+	.byte	0xe
+	.long	0xf2
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2118
+	.byte	0xd
+	.byte	0xd8
+	.byte	0xd
+	.long	0xdc
+	.byte	0x6
+	.uleb128 0x7
+	.string	"day"
+	.byte	0xd
+	.byte	0xd9
+	.byte	0xd
+	.long	0xdc
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2461
+	.byte	0xd
+	.byte	0xda
+	.byte	0xd
+	.long	0xdc
+	.byte	0x8
+	.uleb128 0x7
+	.string	"min"
+	.byte	0xd
+	.byte	0xdb
+	.byte	0xd
+	.long	0xdc
+	.byte	0x9
+	.uleb128 0x7
+	.string	"sec"
+	.byte	0xd
+	.byte	0xdc
+	.byte	0xd
+	.long	0xdc
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2462
+	.byte	0xd
+	.byte	0xdd
+	.byte	0xd
+	.long	0xdc
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2459
+	.byte	0xd
+	.byte	0xde
+	.byte	0xe
+	.long	0xfe
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2460
+	.byte	0xd
+	.byte	0xdf
+	.byte	0xd
+	.long	0xc3
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2420
+	.byte	0xd
+	.byte	0xe0
+	.byte	0xd
+	.long	0xdc
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2421
+	.byte	0xd
+	.byte	0xe1
+	.byte	0xd
+	.long	0xdc
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF2464
+	.byte	0xd
+	.byte	0xe2
+	.byte	0xd
+	.long	0xdc
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF2437
+	.byte	0xd
+	.byte	0xe3
+	.byte	0xd
+	.long	0xdc
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF2413
+	.byte	0xd
+	.byte	0xe4
+	.byte	0xd
+	.long	0xc3
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF2414
+	.byte	0xd
+	.byte	0xe5
+	.byte	0xd
+	.long	0xc3
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF2415
+	.byte	0xd
+	.byte	0xe6
+	.byte	0xd
+	.long	0xc3
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2416
+	.byte	0xd
+	.byte	0xe7
+	.byte	0xd
+	.long	0xc3
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF2417
+	.byte	0xd
+	.byte	0xe8
+	.byte	0xe
+	.long	0xfe
+	.byte	0x28
+	.uleb128 0x1
+	.long	.LASF2418
+	.byte	0xd
+	.byte	0xe9
+	.byte	0xe
+	.long	0xfe
+	.byte	0x2c
+	.uleb128 0x1
+	.long	.LASF2440
+	.byte	0xd
+	.byte	0xea
+	.byte	0xd
+	.long	0xc3
+	.byte	0x30
+	.uleb128 0x1
+	.long	.LASF2441
+	.byte	0xd
+	.byte	0xeb
+	.byte	0xd
+	.long	0xc3
+	.byte	0x34
+	.uleb128 0x1
+	.long	.LASF2442
+	.byte	0xd
+	.byte	0xec
+	.byte	0xd
+	.long	0xc3
+	.byte	0x38
+	.uleb128 0x1
+	.long	.LASF2444
+	.byte	0xd
+	.byte	0xed
+	.byte	0xd
+	.long	0xc3
+	.byte	0x3c
+	.uleb128 0x1
+	.long	.LASF2445
+	.byte	0xd
+	.byte	0xee
+	.byte	0xd
+	.long	0xc3
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2435
+	.byte	0xd
+	.byte	0xef
+	.byte	0xe
+	.long	0xfe
+	.byte	0x44
+	.uleb128 0x1
+	.long	.LASF2446
+	.byte	0xd
+	.byte	0xf0
+	.byte	0xe
+	.long	0xfe
+	.byte	0x48
+	.uleb128 0x1
+	.long	.LASF2436
+	.byte	0xd
+	.byte	0xf1
+	.byte	0xe
+	.long	0xf2
+	.byte	0x4c
+	.uleb128 0x1
+	.long	.LASF2456
+	.byte	0xd
+	.byte	0xf2
+	.byte	0xe
+	.long	0xf2
+	.byte	0x4e
+	.uleb128 0x1
+	.long	.LASF2465
+	.byte	0xd
+	.byte	0xf3
+	.byte	0xe
+	.long	0xf2
+	.byte	0x50
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2466
+	.byte	0xd
+	.byte	0xf4
+	.byte	0x3
+	.long	0x1421
+	.uleb128 0x8
+	.byte	0x2
+	.byte	0xd
+	.byte	0xf6
+	.byte	0x9
+	.long	0x15e1
+	.uleb128 0x1
+	.long	.LASF2394
+	.byte	0xd
+	.byte	0xf7
+	.byte	0xd
+	.long	0xdc
+	.byte	0
+	.uleb128 0x7
+	.string	"msg"
+	.byte	0xd
+	.byte	0xf8
+	.byte	0xd
+	.long	0xdc
+	.byte	0x1
+	.byte	0
+	.uleb128 0x3
+	.long	.LASF2467
+	.byte	0xd
+	.byte	0xf9
+	.byte	0x3
+	.long	0x15bd
+	.uleb128 0x9
+	.byte	0x7
+	.long	0x4c
+	.byte	0xd
+	.byte	0xfb
+	.byte	0x6
+	.long	0x16af
+	.uleb128 0x2
+	.long	.LASF2468
+	.byte	0xb5
+	.uleb128 0x2
+	.long	.LASF2469
+	.byte	0x62
+	.uleb128 0x2
+	.long	.LASF2470
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2471
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2472
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2473
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2474
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2475
+	.byte	0xf0
+	.uleb128 0x2
+	.long	.LASF2476
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2477
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2478
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2479
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2480
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2481
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2482
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2483
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2484
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF2485
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2486
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2487
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2488
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF2489
+	.byte	0x12
+	.uleb128 0x2
+	.long	.LASF2490
+	.byte	0x21
+	.uleb128 0x2
+	.long	.LASF2491
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2492
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2493
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2494
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2495
+	.byte	0x24
+	.uleb128 0x2
+	.long	.LASF2496
+	.byte	0x16
+	.uleb128 0x2
+	.long	.LASF2497
+	.byte	0x3e
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2504
+	.value	0x11a
+	.long	0x15ed
+	.uleb128 0x1a
+	.long	0x4c
+	.value	0x11c
+	.long	0x16ea
+	.uleb128 0x2
+	.long	.LASF2498
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2499
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2500
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2501
+	.byte	0x3
+	.uleb128 0x2
+	.long	.LASF2502
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2503
+	.byte	0x5
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2505
+	.value	0x123
+	.long	0x16ba
+	.uleb128 0x1a
+	.long	0x4c
+	.value	0x125
+	.long	0x1707
+	.uleb128 0x2
+	.long	.LASF2506
+	.byte	0x1
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2507
+	.value	0x127
+	.long	0x16f5
+	.uleb128 0x1a
+	.long	0x4c
+	.value	0x129
+	.long	0x1730
+	.uleb128 0x2
+	.long	.LASF2508
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2509
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2510
+	.byte	0x2
+	.byte	0
+	.uleb128 0x17
+	.long	.LASF2511
+	.value	0x12d
+	.long	0x1712
+	.uleb128 0x5
+	.long	.LASF2512
+	.value	0x130
+	.byte	0x10
+	.long	0xdc
+	.uleb128 0x5
+	.long	.LASF2513
+	.value	0x131
+	.byte	0x10
+	.long	0xdc
+	.uleb128 0x5
+	.long	.LASF2514
+	.value	0x134
+	.byte	0xc
+	.long	0x6a0
+	.uleb128 0x5
+	.long	.LASF2515
+	.value	0x135
+	.byte	0x10
+	.long	0xdc
+	.uleb128 0x5
+	.long	.LASF2516
+	.value	0x136
+	.byte	0x10
+	.long	0xdc
+	.uleb128 0x5
+	.long	.LASF2517
+	.value	0x137
+	.byte	0x11
+	.long	0xf2
+	.uleb128 0x5
+	.long	.LASF2518
+	.value	0x138
+	.byte	0x11
+	.long	0xf2
+	.uleb128 0x5
+	.long	.LASF2519
+	.value	0x13a
+	.byte	0x10
+	.long	0xdc
+	.uleb128 0x5
+	.long	.LASF2520
+	.value	0x13b
+	.byte	0x10
+	.long	0xdc
+	.uleb128 0x5
+	.long	.LASF2521
+	.value	0x13c
+	.byte	0x10
+	.long	0xdc
+	.uleb128 0x5
+	.long	.LASF2522
+	.value	0x13d
+	.byte	0x10
+	.long	0xdc
+	.uleb128 0x5
+	.long	.LASF2523
+	.value	0x140
+	.byte	0xc
+	.long	0x6a0
+	.uleb128 0x5
+	.long	.LASF2524
+	.value	0x143
+	.byte	0xc
+	.long	0x6a0
+	.uleb128 0x5
+	.long	.LASF2525
+	.value	0x146
+	.byte	0xc
+	.long	0x6a0
+	.uleb128 0x2c
+	.byte	0x42
+	.byte	0xd
+	.value	0x156
+	.byte	0x8
+	.long	0x1806
+	.uleb128 0x10
+	.long	.LASF2526
+	.value	0x157
+	.byte	0x11
+	.long	0xfe8
+	.uleb128 0x10
+	.long	.LASF2399
+	.value	0x158
+	.byte	0xd
+	.long	0x1806
+	.byte	0
+	.uleb128 0xa
+	.long	0xdc
+	.long	0x1816
+	.uleb128 0xc
+	.long	0x22
+	.byte	0x39
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2527
+	.value	0x159
+	.byte	0x3
+	.long	0x17e3
+	.uleb128 0x2d
+	.value	0x100
+	.byte	0xd
+	.value	0x15c
+	.byte	0x8
+	.long	0x18a3
+	.uleb128 0x10
+	.long	.LASF2528
+	.value	0x15d
+	.byte	0x14
+	.long	0x10a9
+	.uleb128 0x10
+	.long	.LASF2529
+	.value	0x15e
+	.byte	0x14
+	.long	0x111a
+	.uleb128 0x10
+	.long	.LASF2530
+	.value	0x15f
+	.byte	0x16
+	.long	0x120d
+	.uleb128 0x10
+	.long	.LASF2531
+	.value	0x160
+	.byte	0x14
+	.long	0x1298
+	.uleb128 0x1b
+	.string	"pvt"
+	.value	0x161
+	.long	0x15b1
+	.uleb128 0x10
+	.long	.LASF2532
+	.value	0x162
+	.byte	0x14
+	.long	0x137d
+	.uleb128 0x1b
+	.string	"ver"
+	.value	0x163
+	.long	0x1038
+	.uleb128 0x10
+	.long	.LASF2533
+	.value	0x164
+	.byte	0x15
+	.long	0x1415
+	.uleb128 0x1b
+	.string	"ack"
+	.value	0x165
+	.long	0x15e1
+	.uleb128 0x10
+	.long	.LASF2399
+	.value	0x166
+	.byte	0xd
+	.long	0x18a3
+	.byte	0
+	.uleb128 0xa
+	.long	0xdc
+	.long	0x18b3
+	.uleb128 0xc
+	.long	0x22
+	.byte	0xff
+	.byte	0
+	.uleb128 0x5
+	.long	.LASF2534
+	.value	0x167
+	.byte	0x3
+	.long	0x1822
+	.uleb128 0xa
+	.long	0xe8
+	.long	0x18cf
+	.uleb128 0xc
+	.long	0x22
+	.byte	0x23
+	.byte	0
+	.uleb128 0xd
+	.long	0x18bf
+	.uleb128 0x5
+	.long	.LASF2535
+	.value	0x192
+	.byte	0x16
+	.long	0x18cf
+	.uleb128 0xa
+	.long	0xe8
+	.long	0x18f0
+	.uleb128 0xc
+	.long	0x22
+	.byte	0x3b
+	.byte	0
+	.uleb128 0xd
+	.long	0x18e0
+	.uleb128 0x5
+	.long	.LASF2536
+	.value	0x19b
+	.byte	0x16
+	.long	0x18f0
+	.uleb128 0x5
+	.long	.LASF2537
+	.value	0x2b7
+	.byte	0x19
+	.long	0xdc1
+	.uleb128 0x5
+	.long	.LASF2538
+	.value	0x32d
+	.byte	0x16
+	.long	0xe03
+	.uleb128 0x5
+	.long	.LASF2539
+	.value	0x32f
+	.byte	0x19
+	.long	0xdc1
+	.uleb128 0x5
+	.long	.LASF2540
+	.value	0x344
+	.byte	0x19
+	.long	0xdc1
+	.uleb128 0x15
+	.long	.LASF2541
+	.byte	0x7
+	.byte	0x7b
+	.byte	0x6
+	.long	0x194d
+	.uleb128 0x4
+	.long	0x645
+	.uleb128 0x4
+	.long	0x416
+	.uleb128 0x4
+	.long	0x29
+	.byte	0
+	.uleb128 0x2e
+	.long	.LASF2576
+	.byte	0xb
+	.byte	0x44
+	.byte	0x6
+	.uleb128 0x2f
+	.long	.LASF2122
+	.byte	0xf
+	.byte	0x1d
+	.byte	0xa
+	.long	0x13f
+	.uleb128 0x15
+	.long	.LASF2542
+	.byte	0x7
+	.byte	0x82
+	.byte	0x6
+	.long	0x1978
+	.uleb128 0x4
+	.long	0x645
+	.uleb128 0x4
+	.long	0x11b
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2229
+	.byte	0x7
+	.byte	0x7f
+	.byte	0x6
+	.long	0x198f
+	.uleb128 0x4
+	.long	0x645
+	.uleb128 0x4
+	.long	0xfe
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2543
+	.byte	0xb
+	.byte	0x45
+	.byte	0x6
+	.long	0x19a1
+	.uleb128 0x4
+	.long	0x13f
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2230
+	.byte	0x7
+	.byte	0x81
+	.byte	0x5
+	.long	0x6a0
+	.long	0x19b7
+	.uleb128 0x4
+	.long	0x65e
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2544
+	.byte	0xe
+	.byte	0x1e
+	.byte	0x5
+	.long	0x29
+	.long	0x19cd
+	.uleb128 0x4
+	.long	0x11b
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2545
+	.byte	0xb
+	.byte	0x42
+	.byte	0x11
+	.long	0xf2
+	.long	0x19e3
+	.uleb128 0x4
+	.long	0xfe
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2546
+	.byte	0xb
+	.byte	0x41
+	.byte	0x11
+	.long	0xf2
+	.long	0x19f9
+	.uleb128 0x4
+	.long	0xfe
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2228
+	.byte	0x7
+	.byte	0x7e
+	.byte	0x9
+	.long	0xdc
+	.long	0x1a0f
+	.uleb128 0x4
+	.long	0x645
+	.byte	0
+	.uleb128 0x13
+	.long	.LASF2547
+	.byte	0x7
+	.byte	0x79
+	.byte	0xa
+	.long	0xfe
+	.long	0x1a25
+	.uleb128 0x4
+	.long	0x65e
+	.byte	0
+	.uleb128 0x15
+	.long	.LASF2548
+	.byte	0xb
+	.byte	0x3e
+	.byte	0xd
+	.long	0x1a37
+	.uleb128 0x4
+	.long	0xcd1
+	.byte	0
+	.uleb128 0x1f
+	.long	.LASF2549
+	.value	0x3a2
+	.uleb128 0x1f
+	.long	.LASF2550
+	.value	0x39b
+	.uleb128 0x12
+	.long	.LASF2555
+	.value	0x344
+	.byte	0x5d
+	.long	0x1a84
+	.uleb128 0x5
+	.long	.LASF2551
+	.value	0x346
+	.byte	0x18
+	.long	0x1a84
+	.uleb128 0x5
+	.long	.LASF2552
+	.value	0x346
+	.byte	0x4
+	.long	0x6a0
+	.uleb128 0x20
+	.uleb128 0x5
+	.long	.LASF2553
+	.value	0x37f
+	.byte	0x45
+	.long	0x29
+	.uleb128 0x5
+	.long	.LASF2554
+	.value	0x37f
+	.byte	0x74
+	.long	0x29
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.long	0xdc1
+	.uleb128 0x12
+	.long	.LASF2556
+	.value	0x32f
+	.byte	0x60
+	.long	0x1abc
+	.uleb128 0x5
+	.long	.LASF2551
+	.value	0x331
+	.byte	0x18
+	.long	0x1a84
+	.uleb128 0x5
+	.long	.LASF2552
+	.value	0x331
+	.byte	0x4
+	.long	0x6a0
+	.uleb128 0x20
+	.uleb128 0x5
+	.long	.LASF2557
+	.value	0x339
+	.byte	0x15
+	.long	0xdc
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2558
+	.value	0x2b7
+	.byte	0x53
+	.long	0x1ae1
+	.uleb128 0x5
+	.long	.LASF2551
+	.value	0x2b9
+	.byte	0x18
+	.long	0x1a84
+	.uleb128 0x5
+	.long	.LASF2552
+	.value	0x2b9
+	.byte	0x4
+	.long	0x6a0
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2571
+	.value	0x25d
+	.byte	0xc
+	.long	0x6a0
+	.long	0x1b0a
+	.uleb128 0xe
+	.long	.LASF2201
+	.value	0x25d
+	.byte	0x25
+	.long	0xdc
+	.uleb128 0x5
+	.long	.LASF2559
+	.value	0x25f
+	.byte	0x9
+	.long	0x6a0
+	.byte	0
+	.uleb128 0x30
+	.long	.LASF2577
+	.byte	0xd
+	.value	0x1e4
+	.byte	0xc
+	.long	0x6a0
+	.uleb128 0x1c
+	.long	.LASF2565
+	.value	0x1d7
+	.uleb128 0x12
+	.long	.LASF2560
+	.value	0x1ca
+	.byte	0xd
+	.long	0x1b37
+	.uleb128 0xe
+	.long	.LASF2561
+	.value	0x1ca
+	.byte	0x24
+	.long	0xf2
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2562
+	.value	0x1ba
+	.byte	0xd
+	.long	0x1b67
+	.uleb128 0xe
+	.long	.LASF2394
+	.value	0x1ba
+	.byte	0x22
+	.long	0xdc
+	.uleb128 0x22
+	.string	"id"
+	.value	0x1ba
+	.byte	0x31
+	.long	0xdc
+	.uleb128 0xe
+	.long	.LASF2395
+	.value	0x1ba
+	.byte	0x3d
+	.long	0xdc
+	.byte	0
+	.uleb128 0x12
+	.long	.LASF2563
+	.value	0x1af
+	.byte	0xd
+	.long	0x1b8c
+	.uleb128 0xe
+	.long	.LASF2329
+	.value	0x1af
+	.byte	0x23
+	.long	0xdc
+	.uleb128 0xe
+	.long	.LASF2564
+	.value	0x1af
+	.byte	0x35
+	.long	0xdc
+	.byte	0
+	.uleb128 0x1c
+	.long	.LASF2566
+	.value	0x1a6
+	.uleb128 0x1c
+	.long	.LASF2567
+	.value	0x18a
+	.uleb128 0x12
+	.long	.LASF2568
+	.value	0x17b
+	.byte	0xd
+	.long	0x1bbf
+	.uleb128 0x5
+	.long	.LASF2569
+	.value	0x17d
+	.byte	0xd
+	.long	0xdc
+	.uleb128 0x5
+	.long	.LASF2570
+	.value	0x17d
+	.byte	0x15
+	.long	0xdc
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2572
+	.value	0x172
+	.byte	0x10
+	.long	0xdc
+	.long	0x1be8
+	.uleb128 0xe
+	.long	.LASF2573
+	.value	0x172
+	.byte	0x22
+	.long	0x6a0
+	.uleb128 0xe
+	.long	.LASF2574
+	.value	0x172
+	.byte	0x34
+	.long	0xdc
+	.byte	0
+	.uleb128 0x31
+	.long	.LASF2578
+	.byte	0xd
+	.value	0x169
+	.byte	0x6
+	.uleb128 0xe
+	.long	.LASF2201
+	.value	0x169
+	.byte	0x20
+	.long	0x12e
+	.uleb128 0x22
+	.string	"len"
+	.value	0x169
+	.byte	0x2e
+	.long	0xdc
+	.uleb128 0xe
+	.long	.LASF2569
+	.value	0x169
+	.byte	0x3c
+	.long	0x12e
+	.uleb128 0xe
+	.long	.LASF2570
+	.value	0x169
+	.byte	0x4b
+	.long	0x12e
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 3
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 17
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 13
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x24
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x25
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x26
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x28
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x29
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x2a
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2b
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2c
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2d
+	.uleb128 0x17
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0x5
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x2f
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x30
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x31
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0x5
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xd
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 16 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 17 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 18 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF399
+	.file 20 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x14
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 21 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x15
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF453
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 24 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF526
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF544
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x1a
+	.file 27 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 28 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF610
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF646
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF526
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 33 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF674
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF675
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x17
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF453
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF735
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF749
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF750
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF751
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF752
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF567
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF753
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF754
+	.file 40 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF755
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2a
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF772
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 45 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF785
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x2f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF790
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.file 49 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x31
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF793
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x32
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF794
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF811
+	.file 52 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x34
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF812
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF813
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF825
+	.byte	0x4
+	.file 55 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 56 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF832
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF833
+	.byte	0x4
+	.byte	0x4
+	.file 57 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x39
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF837
+	.file 58 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x3a
+	.byte	0x4
+	.file 59 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x3b
+	.byte	0x4
+	.byte	0x4
+	.file 60 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x3c
+	.file 61 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 62 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3e
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF842
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF905
+	.byte	0x4
+	.file 63 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.file 64 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xed
+	.uleb128 0x40
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF931
+	.file 65 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x41
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF932
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.file 66 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 67 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x43
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 68 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x44
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 69 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x45
+	.file 70 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x46
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.file 71 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x47
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1246
+	.byte	0x4
+	.file 72 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.file 73 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.file 74 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x4a
+	.byte	0x4
+	.file 75 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x4a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x4a
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x4b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x4a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 76 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x4c
+	.file 77 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x4d
+	.byte	0x7
+	.long	.Ldebug_macro59
+	.byte	0x4
+	.file 78 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x4e
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro60
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro61
+	.byte	0x4
+	.file 79 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x4f
+	.byte	0x4
+	.file 80 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x50
+	.byte	0x7
+	.long	.Ldebug_macro62
+	.byte	0x4
+	.byte	0x4
+	.file 81 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x51
+	.byte	0x7
+	.long	.Ldebug_macro63
+	.byte	0x4
+	.file 82 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x52
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro64
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4
+	.file 83 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x53
+	.byte	0x7
+	.long	.Ldebug_macro65
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro66
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro67
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro68
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0xe
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1570
+	.byte	0x4
+	.file 84 "./src/main/common/gps_conversion.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x54
+	.byte	0x4
+	.file 85 "./src/main/common/maths.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x55
+	.byte	0x7
+	.long	.Ldebug_macro69
+	.byte	0x4
+	.file 86 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x56
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x1c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro70
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x7
+	.file 87 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x57
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x6
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1635
+	.byte	0x4
+	.file 88 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x58
+	.byte	0x7
+	.long	.Ldebug_macro71
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro72
+	.file 89 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x59
+	.byte	0x7
+	.long	.Ldebug_macro73
+	.file 90 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x5a
+	.byte	0x7
+	.long	.Ldebug_macro74
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0x4
+	.file 91 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0x5b
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x8
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2026
+	.byte	0x4
+	.file 92 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF2027
+	.byte	0x4
+	.file 93 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5d
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro75
+	.byte	0x4
+	.file 94 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x5e
+	.byte	0x7
+	.long	.Ldebug_macro76
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2d
+	.uleb128 0x9
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro77
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro78
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x31
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro79
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF2076
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF2077
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2078
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF2079
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF2080
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF2081
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF2082
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF2083
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF2084
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF2085
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2086
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF2087
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF2088
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF2089
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF463
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF464
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF523
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF525
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF543
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF604
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF605
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF638
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF645
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF667
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF673
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF732
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF734
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.40.492512a14a2010d5ca50e9de957e6b26,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF748
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF759
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF771
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF784
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF795
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF806
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF810
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF824
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF828
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF836
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF904
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.23.c805eb1c9d1e071571a14d314e366ed6,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF930
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.241.7270a880a9a032c7121aef6d31a9a9f4,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF966
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1240
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1245
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1248
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1250
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1265
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1266
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1265
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1266
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1275
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1266
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1266
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1266
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1278
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1266
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1266
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1278
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1266
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1267
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1268
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1269
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1287
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1288
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1289
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1290
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1297
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1298
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1299
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1300
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1301
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1302
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1307
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1308
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1309
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1311
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1313
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1336
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1338
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1339
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro59:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1340
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1342
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1343
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1344
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1345
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1346
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1347
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1348
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1349
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1350
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1351
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1352
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1353
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1354
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1355
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1356
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1357
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1358
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1359
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1375
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1377
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1383
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1394
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1397
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1420
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1430
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1432
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro60:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1445
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1446
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1447
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro61:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1468
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1469
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1470
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1471
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1472
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1473
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1474
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1475
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1476
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1477
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1478
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1479
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1480
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1481
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1482
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1483
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1484
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1485
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1486
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1487
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1488
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1489
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1490
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1491
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1492
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1493
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1507
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1509
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro62:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1474
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1511
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1471
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1517
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro63:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1519
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1528
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro64:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1531
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro65:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1554
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro66:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1564
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro67:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1566
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.axis.h.26.03844dd33672840e25bc5e25cd77ee3c,comdat
+.Ldebug_macro68:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro69:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1606
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro70:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1634
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro71:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1637
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro72:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1645
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro73:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1657
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro74:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1887
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1888
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1900
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1901
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1918
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1919
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1920
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1921
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1922
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1923
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1924
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1925
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1926
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1927
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1928
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1929
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1930
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1931
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1932
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1933
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1934
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1935
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1936
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1937
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1938
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1939
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1940
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1941
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1942
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1943
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1944
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1945
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1946
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1947
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1948
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1949
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1950
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1952
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1953
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1954
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1955
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1956
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1957
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1958
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1959
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1960
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1961
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1962
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1963
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1964
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1965
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1966
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1967
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1968
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1969
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1970
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1971
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1972
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1973
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1974
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1975
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1976
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1977
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1978
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1979
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1980
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1981
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1982
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1983
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1984
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1985
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1986
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1987
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1988
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1990
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1991
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1992
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1993
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1994
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1995
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1996
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1997
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1998
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1999
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF2000
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF2001
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF2002
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF2003
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF2004
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF2005
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF2006
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF2007
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF2008
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF2009
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF2010
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF2011
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF2012
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF2013
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF2014
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF2015
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF2016
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF2017
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF2018
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF2019
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF2020
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF2021
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF2022
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF2023
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF2024
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF2025
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro75:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2028
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2029
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2030
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro76:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF2031
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF2032
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2033
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF2034
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF2035
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF2036
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2037
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF2038
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF2039
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF2040
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF2041
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps.h.26.a0254bba9ba01ba4767a34ee666f49e1,comdat
+.Ldebug_macro77:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF2042
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2043
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2044
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2045
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF2046
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF2047
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF2048
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF2049
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.gps_private.h.24.b24872bc41c5679001c816204a4672e9,comdat
+.Ldebug_macro78:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF2050
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF2051
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF2052
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF2053
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF2054
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF2055
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.protothreads.h.72.5c357c7f93436138b3be33daa8d3fedb,comdat
+.Ldebug_macro79:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF2056
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF2057
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF2058
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF2059
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF2060
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF2061
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF2062
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF2063
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF2064
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF2065
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF2066
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF2067
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF2068
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF2069
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF2070
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF2071
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF2072
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF2073
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF2074
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF2075
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF2579
+	.long	.LASF2580
+	.long	.LASF2581
+	.long	.LASF2582
+	.long	.LASF2583
+	.long	.LASF2584
+	.long	.LASF2585
+	.long	.LASF2586
+	.long	.LASF2587
+	.long	.LASF2588
+	.long	.LASF2589
+	.long	.LASF2590
+	.long	.LASF2591
+	.long	.LASF2592
+	.long	.LASF2593
+	.long	.LASF2594
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x5f
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2595
+	.byte	0xc
+	.long	.LASF2596
+	.byte	0xc
+	.long	.LASF2597
+	.byte	0xc
+	.long	.LASF2598
+	.byte	0x2
+	.long	.LASF2599
+	.byte	0x2
+	.long	.LASF2600
+	.byte	0x4
+	.long	.LASF2601
+	.byte	0x4
+	.long	.LASF2602
+	.byte	0x4
+	.long	.LASF2601
+	.byte	0x6
+	.long	.LASF2603
+	.byte	0x6
+	.long	.LASF2604
+	.byte	0x6
+	.long	.LASF2605
+	.byte	0x7
+	.long	.LASF2606
+	.byte	0x6
+	.long	.LASF2607
+	.byte	0x2
+	.long	.LASF2598
+	.byte	0x4
+	.long	.LASF2608
+	.byte	0xf
+	.long	.LASF2609
+	.byte	0x10
+	.long	.LASF2610
+	.byte	0xf
+	.long	.LASF2611
+	.byte	0xc
+	.long	.LASF2612
+	.byte	0xf
+	.long	.LASF2613
+	.byte	0xf
+	.long	.LASF2614
+	.byte	0xc
+	.long	.LASF2615
+	.byte	0xc
+	.long	.LASF2616
+	.byte	0xe
+	.long	.LASF2617
+	.byte	0xc
+	.long	.LASF2618
+	.byte	0xd
+	.long	.LASF2619
+	.byte	0xd
+	.long	.LASF2620
+	.byte	0x10
+	.long	.LASF2621
+	.byte	0xc
+	.long	.LASF2622
+	.byte	0xc
+	.long	.LASF2623
+	.byte	0xc
+	.long	.LASF2624
+	.byte	0xc
+	.long	.LASF2595
+	.byte	0xe
+	.long	.LASF2625
+	.byte	0xc
+	.long	.LASF2626
+	.byte	0xc
+	.long	.LASF2627
+	.byte	0xb
+	.long	.LASF2628
+	.byte	0xb
+	.long	.LASF2629
+	.byte	0xb
+	.long	.LASF2630
+	.byte	0xb
+	.long	.LASF2631
+	.byte	0xf
+	.long	.LASF2631
+	.byte	0xc
+	.long	.LASF2632
+	.byte	0xc
+	.long	.LASF2633
+	.byte	0xc
+	.long	.LASF2634
+	.byte	0xc
+	.long	.LASF2635
+	.byte	0xe
+	.long	.LASF2635
+	.byte	0xc
+	.long	.LASF2636
+	.byte	0xb
+	.long	.LASF2637
+	.byte	0xb
+	.long	.LASF2638
+	.byte	0xb
+	.long	.LASF2639
+	.byte	0xb
+	.long	.LASF2640
+	.byte	0xc
+	.long	.LASF2641
+	.byte	0xc
+	.long	.LASF2642
+	.byte	0xc
+	.long	.LASF2643
+	.byte	0xc
+	.long	.LASF2644
+	.byte	0xc
+	.long	.LASF2645
+	.byte	0xc
+	.long	.LASF2646
+	.byte	0xf
+	.long	.LASF2647
+	.byte	0xc
+	.long	.LASF2648
+	.byte	0xc
+	.long	.LASF2649
+	.byte	0x10
+	.long	.LASF2649
+	.byte	0xf
+	.long	.LASF2650
+	.byte	0xc
+	.long	.LASF2651
+	.byte	0xf
+	.long	.LASF2652
+	.byte	0xb
+	.long	.LASF2653
+	.byte	0xb
+	.long	.LASF2654
+	.byte	0xf
+	.long	.LASF2655
+	.byte	0xf
+	.long	.LASF2656
+	.byte	0xf
+	.long	.LASF2657
+	.byte	0xc
+	.long	.LASF2658
+	.byte	0xc
+	.long	.LASF2659
+	.byte	0xc
+	.long	.LASF2660
+	.byte	0xc
+	.long	.LASF2661
+	.byte	0xc
+	.long	.LASF2662
+	.byte	0xc
+	.long	.LASF2663
+	.byte	0xc
+	.long	.LASF2664
+	.byte	0xa
+	.long	.LASF2665
+	.byte	0x9
+	.long	.LASF2666
+	.byte	0x8
+	.long	.LASF2667
+	.byte	0x9
+	.long	.LASF2668
+	.byte	0x9
+	.long	.LASF2669
+	.byte	0x1
+	.long	.LASF2670
+	.byte	0x1
+	.long	.LASF2671
+	.byte	0x3
+	.long	.LASF2672
+	.byte	0x2
+	.long	.LASF2673
+	.byte	0x2
+	.long	.LASF2674
+	.byte	0x2
+	.long	.LASF2675
+	.byte	0x4
+	.long	.LASF2676
+	.byte	0x4
+	.long	.LASF2677
+	.byte	0x4
+	.long	.LASF2678
+	.byte	0x4
+	.long	.LASF2679
+	.byte	0x5
+	.long	.LASF2680
+	.byte	0x4
+	.long	.LASF2681
+	.byte	0x5
+	.long	.LASF2682
+	.byte	0x5
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF1119:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF2017:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1395:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF2441:
+	.string	"ned_east"
+.LASF668:
+	.string	"__ldiv_t_defined 1"
+.LASF2281:
+	.string	"peripheral_baudrateIndex"
+.LASF1477:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF1002:
+	.string	"__DECL_SIMD_logf "
+.LASF1111:
+	.string	"__DECL_SIMD_sinh "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1709:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1207:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1847:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1235:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1525:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1344:
+	.string	"USE_RX_PPM "
+.LASF1451:
+	.string	"USE_FAKE_BARO "
+.LASF820:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF1747:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1455:
+	.string	"USE_BARO "
+.LASF1647:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF544:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF2456:
+	.string	"reserved2"
+.LASF1218:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF1120:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF598:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1418:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF466:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF763:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF1718:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1773:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1573:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF1295:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF493:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1462:
+	.string	"USE_UART7 "
+.LASF2286:
+	.string	"reboot_character"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF398:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF2316:
+	.string	"GPS_DYNMODEL_PEDESTRIAN"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF682:
+	.string	"__SQUAD_TYPE long int"
+.LASF2240:
+	.string	"ADC_BATTERY"
+.LASF2029:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1758:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF2231:
+	.string	"setMode"
+.LASF1380:
+	.string	"USE_PITOT_MS4525 "
+.LASF454:
+	.string	"__USE_MISC 1"
+.LASF757:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1419:
+	.string	"USE_SERIALRX_CRSF "
+.LASF945:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF926:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF1311:
+	.string	"FP_NORMAL 4"
+.LASF2465:
+	.string	"reserved3"
+.LASF1155:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF1012:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF2151:
+	.string	"OWNER_RX_SPI"
+.LASF744:
+	.string	"__pid_t_defined "
+.LASF756:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1070:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1166:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1115:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1659:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF517:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF1231:
+	.string	"__DECL_SIMD_tan "
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1216:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF616:
+	.string	"WNOWAIT 0x01000000"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1781:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF2097:
+	.string	"__uint8_t"
+.LASF839:
+	.string	"_BITS_WCHAR_H 1"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2207:
+	.string	"vTable"
+.LASF1572:
+	.string	"FAST_MATH "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1921:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2239:
+	.string	"_Bool"
+.LASF2409:
+	.string	"payload"
+.LASF970:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF528:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1866:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF2331:
+	.string	"gpsMinSats"
+.LASF1499:
+	.string	"U_ID_2 2"
+.LASF920:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF2363:
+	.string	"GPS_RUNNING"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1638:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF1251:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF1179:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF1021:
+	.string	"__DECL_SIMD_pow "
+.LASF470:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF2120:
+	.string	"minutes"
+.LASF2325:
+	.string	"provider"
+.LASF1107:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF510:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF2008:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1772:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1636:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF2294:
+	.string	"GPS_PROVIDER_COUNT"
+.LASF2488:
+	.string	"MSG_PVT"
+.LASF1954:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF2087:
+	.string	"UBX_VALID_GPS_DATE(valid) (valid & 1 << 0)"
+.LASF2559:
+	.string	"parsed"
+.LASF953:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF457:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2219:
+	.string	"txBufferTail"
+.LASF2188:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF2354:
+	.string	"errors"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1472:
+	.string	"USE_USB_MSC"
+.LASF2464:
+	.string	"reserved1"
+.LASF421:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1275:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF2467:
+	.string	"ubx_ack_ack"
+.LASF1511:
+	.string	"NOINLINE "
+.LASF1844:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1890:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1516:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1554:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF2049:
+	.string	"HDOP_SCALE (100)"
+.LASF2373:
+	.string	"autoConfigStep"
+.LASF1789:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF1108:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF1016:
+	.string	"__DECL_SIMD_expf64 "
+.LASF590:
+	.string	"__WCHAR_T__ "
+.LASF1742:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF610:
+	.string	"_STDLIB_H 1"
+.LASF2013:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2295:
+	.string	"gpsProvider_e"
+.LASF1182:
+	.string	"__DECL_SIMD_acoshf "
+.LASF1361:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF987:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1402:
+	.string	"USE_CMS "
+.LASF2324:
+	.string	"gpsConfig_s"
+.LASF2332:
+	.string	"gpsConfig_t"
+.LASF2511:
+	.string	"ubx_ack_state"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1559:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1985:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF2312:
+	.string	"gpsAutoConfig_e"
+.LASF1401:
+	.string	"USE_STATS "
+.LASF1853:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1315:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF2148:
+	.string	"OWNER_LED"
+.LASF975:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF2489:
+	.string	"MSG_VELNED"
+.LASF2546:
+	.string	"gpsConstrainEPE"
+.LASF2412:
+	.string	"ubx_mon_ver"
+.LASF1210:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF2458:
+	.string	"ubx_nav_svinfo"
+.LASF2067:
+	.string	"ptSpawn(name) do { ptRestart(ptGetHandle(name)); ptWaitThread(name); } while (0)"
+.LASF1000:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1428:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF2109:
+	.string	"uint16_t"
+.LASF2173:
+	.string	"RESOURCE_SPI_SCK"
+.LASF768:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF1121:
+	.string	"__DECL_SIMD_cbrt "
+.LASF373:
+	.string	"linux 1"
+.LASF1582:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF732:
+	.string	"__FD_SETSIZE 1024"
+.LASF690:
+	.string	"__STD_TYPE typedef"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF1252:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF2262:
+	.string	"baudRate_e"
+.LASF1783:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1952:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF472:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF2299:
+	.string	"SBAS_MSAS"
+.LASF1960:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF1931:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1495:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF1133:
+	.string	"__DECL_SIMD_atan2l "
+.LASF948:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF1544:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF2406:
+	.string	"length"
+.LASF1314:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF969:
+	.string	"_MATH_H 1"
+.LASF908:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1505:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1581:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF1720:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1292:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF742:
+	.string	"__uid_t_defined "
+.LASF1340:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1944:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF872:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1018:
+	.string	"__DECL_SIMD_expf32x "
+.LASF679:
+	.string	"__U32_TYPE unsigned int"
+.LASF983:
+	.string	"__DECL_SIMD_sinl "
+.LASF2347:
+	.string	"velNED"
+.LASF1895:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1466:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF985:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1799:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1236:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1778:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF891:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2060:
+	.string	"ptRestart(handle) do { (handle)->returnCode = 0; (handle)->line = 0; } while(0)"
+.LASF1033:
+	.string	"__DECL_SIMD_acosl "
+.LASF2050:
+	.string	"GPS_HDOP_TO_EPH_MULTIPLIER 2"
+.LASF1601:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF1222:
+	.string	"__DECL_SIMD_erfcf "
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF2285:
+	.string	"portConfigs"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1786:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF628:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF1467:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF741:
+	.string	"__nlink_t_defined "
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1626:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF589:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF1004:
+	.string	"__DECL_SIMD_logf16 "
+.LASF414:
+	.string	"__USE_XOPEN2K8"
+.LASF1780:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF410:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2547:
+	.string	"serialRxBytesWaiting"
+.LASF1817:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF849:
+	.string	"INT16_MAX (32767)"
+.LASF529:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF699:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF946:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF2461:
+	.string	"hour"
+.LASF663:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF2342:
+	.string	"gpsSolutionData_s"
+.LASF1101:
+	.string	"__DECL_SIMD_expm1 "
+.LASF2450:
+	.string	"elev"
+.LASF2484:
+	.string	"MSG_NMEA_VGS"
+.LASF1886:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF1911:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1060:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF2162:
+	.string	"RESOURCE_NONE"
+.LASF1715:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1877:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1940:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF1003:
+	.string	"__DECL_SIMD_logl "
+.LASF2012:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF2118:
+	.string	"month"
+.LASF728:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF489:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1095:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF1437:
+	.string	"_T_PTRDIFF_ "
+.LASF1390:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1240:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1680:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF2504:
+	.string	"ubx_protocol_bytes"
+.LASF2201:
+	.string	"data"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF2025:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF581:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1622:
+	.string	"BIT(x) (1 << (x))"
+.LASF2142:
+	.string	"OWNER_BEEPER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF947:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF1376:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF2216:
+	.string	"rxBufferHead"
+.LASF1011:
+	.string	"__DECL_SIMD_exp "
+.LASF2359:
+	.string	"gpsSol"
+.LASF2414:
+	.string	"latitude"
+.LASF1508:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF2287:
+	.string	"serialConfig_t"
+.LASF1705:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF1086:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF785:
+	.string	"_SYS_SELECT_H 1"
+.LASF2106:
+	.string	"int32_t"
+.LASF1552:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF641:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2278:
+	.string	"functionMask"
+.LASF2433:
+	.string	"ecef_y_velocity"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF2171:
+	.string	"RESOURCE_I2C_SCL"
+.LASF2071:
+	.string	"ptStop(retCode) do { currentPt->returnCode = retCode; currentPt->line = (-1); return; } while (0)"
+.LASF797:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1963:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1450:
+	.string	"USE_IMU_FAKE "
+.LASF893:
+	.string	"WINT_MIN (0u)"
+.LASF1312:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2235:
+	.string	"beginWrite"
+.LASF2439:
+	.string	"ubx_nav_solution"
+.LASF2423:
+	.string	"time_to_first_fix"
+.LASF932:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1998:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF600:
+	.string	"___int_wchar_t_h "
+.LASF2153:
+	.string	"OWNER_SPI_PREINIT"
+.LASF1013:
+	.string	"__DECL_SIMD_expl "
+.LASF2378:
+	.string	"gpsReceiverData_t"
+.LASF1934:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF1700:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF401:
+	.string	"__USE_ISOC11"
+.LASF1651:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF2163:
+	.string	"RESOURCE_INPUT"
+.LASF1755:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF2027:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF508:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1471:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF770:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF1815:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF539:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1490:
+	.string	"USE_RX_PPM"
+.LASF512:
+	.string	"__always_inline"
+.LASF2172:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF2221:
+	.string	"rxCallbackData"
+.LASF890:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF2311:
+	.string	"GPS_AUTOCONFIG_ON"
+.LASF2183:
+	.string	"MODE_RX"
+.LASF2500:
+	.string	"FIX_2D"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF1109:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF1531:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1660:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF2419:
+	.string	"ubx_nav_posllh"
+.LASF846:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1620:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF2428:
+	.string	"ecef_x"
+.LASF921:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF2497:
+	.string	"MSG_CFG_GNSS"
+.LASF1267:
+	.string	"__MATH_PRECNAME"
+.LASF1146:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF840:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1833:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1510:
+	.string	"FAST_CODE "
+.LASF1377:
+	.string	"USE_OPFLOW "
+.LASF2390:
+	.string	"maxSBAS"
+.LASF1277:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF1074:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF1299:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1078:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1484:
+	.string	"USE_1WIRE_DS2482"
+.LASF1270:
+	.string	"_Mdouble_ float"
+.LASF2260:
+	.string	"BAUD_2000000"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF2533:
+	.string	"timeutc"
+.LASF868:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1830:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF2200:
+	.string	"serialBufChunk_s"
+.LASF709:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1254:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1386:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF772:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF495:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1751:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2401:
+	.string	"ubx_payload"
+.LASF574:
+	.string	"_T_SIZE_ "
+.LASF1453:
+	.string	"USE_FAKE_GPS "
+.LASF2208:
+	.string	"identifier"
+.LASF949:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF1600:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF781:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF2298:
+	.string	"SBAS_WAAS"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF1183:
+	.string	"__DECL_SIMD_acoshl "
+.LASF789:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF2091:
+	.string	"long int"
+.LASF485:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF2317:
+	.string	"GPS_DYNMODEL_AIR_1G"
+.LASF1852:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1728:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF1039:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF1387:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1599:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF2314:
+	.string	"GPS_AUTOBAUD_ON"
+.LASF1914:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF546:
+	.string	"__stub_chflags "
+.LASF1288:
+	.string	"__MATHDECL_1"
+.LASF2573:
+	.string	"fixValid"
+.LASF1470:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF2315:
+	.string	"gpsAutoBaud_e"
+.LASF1987:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF2141:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF907:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF2024:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF667:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF627:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF2161:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF895:
+	.string	"INT8_C(c) c"
+.LASF1546:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1927:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF585:
+	.string	"_GCC_SIZE_T "
+.LASF550:
+	.string	"__stub_setlogin "
+.LASF1977:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2184:
+	.string	"MODE_TX"
+.LASF651:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1501:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2532:
+	.string	"svinfo"
+.LASF1679:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1641:
+	.string	"IOCFG_AF_PP 0"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF552:
+	.string	"__stub_stty "
+.LASF1617:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF2357:
+	.string	"gpsStatistics_t"
+.LASF1164:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF2114:
+	.string	"timeDelta_t"
+.LASF1059:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF2034:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF1071:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF2338:
+	.string	"validVelD"
+.LASF897:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1412:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF1089:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1858:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF2381:
+	.string	"ptState_s"
+.LASF1896:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1545:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1842:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1643:
+	.string	"IOCFG_IPD 0"
+.LASF1297:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF1351:
+	.string	"USE_ADC_AVERAGING "
+.LASF2375:
+	.string	"lastLastMessageMs"
+.LASF1262:
+	.string	"_Mdouble_ double"
+.LASF624:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1500:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1703:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF1173:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1791:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2524:
+	.string	"_new_speed"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF2020:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF2305:
+	.string	"GPS_BAUDRATE_38400"
+.LASF2063:
+	.string	"ptLabel() do { currentPt->line = __LINE__; FALLTHROUGH; case __LINE__:; } while (0)"
+.LASF643:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1566:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF2246:
+	.string	"BAUD_1200"
+.LASF924:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF2119:
+	.string	"hours"
+.LASF524:
+	.string	"__attribute_copy__"
+.LASF1937:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1807:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF2001:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF582:
+	.string	"_SIZE_T_DECLARED "
+.LASF456:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF2374:
+	.string	"lastStateSwitchMs"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF845:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1535:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF2289:
+	.string	"GPS_UBLOX"
+.LASF2229:
+	.string	"serialSetBaudRate"
+.LASF2129:
+	.string	"OWNER_SERVO"
+.LASF1625:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF919:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1597:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1557:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1128:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF910:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF505:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1978:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF1096:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF767:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF591:
+	.string	"_WCHAR_T "
+.LASF2367:
+	.string	"serialConfig"
+.LASF1606:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF1172:
+	.string	"__DECL_SIMD_atanhf "
+.LASF2493:
+	.string	"MSG_CFG_RATE"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF2275:
+	.string	"SERIAL_PORT_IDENTIFIER_MAX"
+.LASF1491:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF2160:
+	.string	"OWNER_IRLOCK"
+.LASF1707:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1763:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2011:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF2321:
+	.string	"GPS_FIX_2D"
+.LASF1957:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF2290:
+	.string	"GPS_I2CNAV"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1712:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF2318:
+	.string	"GPS_DYNMODEL_AIR_4G"
+.LASF1228:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF760:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1793:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1353:
+	.string	"USE_BLACKBOX "
+.LASF835:
+	.string	"alloca"
+.LASF1908:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1980:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1719:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF793:
+	.string	"__timeval_defined 1"
+.LASF2499:
+	.string	"FIX_DEAD_RECKONING"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1538:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1489:
+	.string	"USE_VCP"
+.LASF877:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1130:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF2098:
+	.string	"__int16_t"
+.LASF894:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1912:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF2248:
+	.string	"BAUD_4800"
+.LASF2100:
+	.string	"__uint16_t"
+.LASF666:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF2545:
+	.string	"gpsConstrainHDOP"
+.LASF2397:
+	.string	"meas"
+.LASF2212:
+	.string	"rxBufferSize"
+.LASF2128:
+	.string	"OWNER_MOTOR"
+.LASF1097:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF2366:
+	.string	"gpsConfig"
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF2487:
+	.string	"MSG_SOL"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF2336:
+	.string	"gpsHeartbeat"
+.LASF358:
+	.string	"__k8 1"
+.LASF1654:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF442:
+	.string	"__USE_POSIX 1"
+.LASF405:
+	.string	"__USE_POSIX"
+.LASF2492:
+	.string	"MSG_CFG_PRT"
+.LASF1990:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF601:
+	.string	"__INT_WCHAR_T_H "
+.LASF739:
+	.string	"__gid_t_defined "
+.LASF1005:
+	.string	"__DECL_SIMD_logf32 "
+.LASF1040:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1803:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF1067:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1239:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF1044:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1658:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF536:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1930:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF786:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF438:
+	.string	"_POSIX_SOURCE"
+.LASF587:
+	.string	"__size_t "
+.LASF2218:
+	.string	"txBufferHead"
+.LASF875:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2254:
+	.string	"BAUD_230400"
+.LASF1135:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF803:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF2512:
+	.string	"_ck_a"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF2209:
+	.string	"mode"
+.LASF780:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1905:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF1689:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1194:
+	.string	"__DECL_SIMD_erff16 "
+.LASF2313:
+	.string	"GPS_AUTOBAUD_OFF"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF1714:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF637:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF1206:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF999:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF1027:
+	.string	"__DECL_SIMD_powf128 "
+.LASF1068:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF2462:
+	.string	"valid"
+.LASF522:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF2308:
+	.string	"GPS_BAUDRATE_COUNT"
+.LASF2328:
+	.string	"autoBaud"
+.LASF2258:
+	.string	"BAUD_1000000"
+.LASF964:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF2449:
+	.string	"quality"
+.LASF2125:
+	.string	"OWNER_PWMIO"
+.LASF662:
+	.string	"__f32x(x) x ##f32x"
+.LASF1085:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1287:
+	.string	"__MATHDECL_1_IMPL"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1389:
+	.string	"USE_OLED_UG2864 "
+.LASF1725:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1332:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1806:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1406:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1429:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1611:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF938:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF1301:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1811:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF950:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF859:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF2560:
+	.string	"configureRATE"
+.LASF349:
+	.string	"__amd64 1"
+.LASF1558:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1076:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2093:
+	.string	"unsigned char"
+.LASF842:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF2535:
+	.string	"default_payload"
+.LASF935:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF869:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1159:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF537:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF1077:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1872:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1637:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF873:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1444:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1585:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF2072:
+	.string	"ptEnd(retCode) ptStop(retCode); FALLTHROUGH; default: return; }"
+.LASF740:
+	.string	"__mode_t_defined "
+.LASF1359:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF1356:
+	.string	"USE_NAV "
+.LASF2130:
+	.string	"OWNER_SOFTSERIAL"
+.LASF1063:
+	.string	"__DECL_SIMD_hypotl "
+.LASF693:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF1832:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF2112:
+	.string	"float"
+.LASF2394:
+	.string	"class"
+.LASF2400:
+	.string	"sbas"
+.LASF2553:
+	.string	"_left0"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF1884:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF403:
+	.string	"__USE_ISOC95"
+.LASF1685:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF402:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1509:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1688:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF896:
+	.string	"INT16_C(c) c"
+.LASF1775:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2232:
+	.string	"writeBuf"
+.LASF955:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF2437:
+	.string	"satellites"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF2355:
+	.string	"timeouts"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF1640:
+	.string	"IOCFG_OUT_OD 0"
+.LASF605:
+	.string	"_BSD_WCHAR_T_"
+.LASF753:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF1054:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1436:
+	.string	"_PTRDIFF_T "
+.LASF1704:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF533:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF765:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF412:
+	.string	"__USE_XOPEN2K"
+.LASF1727:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF408:
+	.string	"__USE_POSIX199506"
+.LASF1519:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2236:
+	.string	"endWrite"
+.LASF1795:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1329:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF473:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1150:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF2410:
+	.string	"ubx_message"
+.LASF2574:
+	.string	"ubloxFixType"
+.LASF1568:
+	.string	"FLIGHT_DYNAMICS_INDEX_COUNT 3"
+.LASF492:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF783:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1732:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1354:
+	.string	"USE_GPS "
+.LASF864:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF2494:
+	.string	"MSG_CFG_SET_RATE"
+.LASF1993:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1225:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF2152:
+	.string	"OWNER_VTX"
+.LASF511:
+	.string	"__wur "
+.LASF1962:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF2038:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1836:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF474:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1349:
+	.string	"USE_SERIALRX_FPORT "
+.LASF626:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF1318:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1687:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF2352:
+	.string	"gpsSolutionData_t"
+.LASF2156:
+	.string	"OWNER_1WIRE"
+.LASF2558:
+	.string	"gpsConfigure"
+.LASF1496:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1274:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2081:
+	.string	"UBX_DYNMODEL_PEDESTRIAN 3"
+.LASF1645:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF749:
+	.string	"__clock_t_defined 1"
+.LASF433:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF597:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1604:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF2517:
+	.string	"_payload_length"
+.LASF701:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1313:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF2418:
+	.string	"vertical_accuracy"
+.LASF2250:
+	.string	"BAUD_19200"
+.LASF2135:
+	.string	"OWNER_RANGEFINDER"
+.LASF1066:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2300:
+	.string	"SBAS_GAGAN"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF468:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF796:
+	.string	"__NFDBITS"
+.LASF673:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF843:
+	.string	"__intptr_t_defined "
+.LASF1289:
+	.string	"__MATHDECL_ALIAS"
+.LASF851:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF862:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF527:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF2513:
+	.string	"_ck_b"
+.LASF2288:
+	.string	"GPS_NMEA"
+.LASF629:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF2259:
+	.string	"BAUD_1500000"
+.LASF484:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1850:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF1190:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1764:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF1165:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF1868:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF836:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF683:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF1345:
+	.string	"USE_SERIAL_RX "
+.LASF1682:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1224:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF415:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF716:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF1909:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF1694:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF2237:
+	.string	"writeBufChunks"
+.LASF752:
+	.string	"__timer_t_defined 1"
+.LASF1284:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1494:
+	.string	"USE_ITCM_RAM"
+.LASF1734:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF879:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1801:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF2026:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF1820:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1562:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF652:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF599:
+	.string	"_WCHAR_T_H "
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1264:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF2421:
+	.string	"fix_status"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF725:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF2522:
+	.string	"_ack_waiting_msg"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF791:
+	.string	"____sigset_t_defined "
+.LASF2030:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF2228:
+	.string	"serialRead"
+.LASF755:
+	.string	"_ENDIAN_H 1"
+.LASF2003:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF2326:
+	.string	"sbasMode"
+.LASF1932:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF963:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF980:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF2176:
+	.string	"RESOURCE_SPI_CS"
+.LASF901:
+	.string	"UINT32_C(c) c ## U"
+.LASF1143:
+	.string	"__DECL_SIMD_log10l "
+.LASF2220:
+	.string	"rxCallback"
+.LASF396:
+	.string	"false 0"
+.LASF1487:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF2015:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF855:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1943:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2340:
+	.string	"validEPE"
+.LASF1482:
+	.string	"USE_PITOT_ADC"
+.LASF2280:
+	.string	"gps_baudrateIndex"
+.LASF1020:
+	.string	"__DECL_SIMD_expf128x "
+.LASF1669:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF954:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF1393:
+	.string	"USE_DJI_HD_OSD "
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1737:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2214:
+	.string	"rxBuffer"
+.LASF634:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF654:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF1929:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF898:
+	.string	"INT64_C(c) c ## L"
+.LASF2213:
+	.string	"txBufferSize"
+.LASF2192:
+	.string	"SERIAL_PARITY_NO"
+.LASF2115:
+	.string	"timeMs_t"
+.LASF2382:
+	.string	"line"
+.LASF2520:
+	.string	"_class"
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF837:
+	.string	"__COMPAR_FN_T "
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF689:
+	.string	"__U64_TYPE unsigned long int"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF733:
+	.string	"_BITS_TIME64_H 1"
+.LASF824:
+	.string	"__ONCE_ALIGNMENT "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF874:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1768:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1408:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF2474:
+	.string	"MSG_CLASS_UBX"
+.LASF1256:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF713:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF497:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1528:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF1149:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1964:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF1698:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1052:
+	.string	"__DECL_SIMD_asinf "
+.LASF620:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF1996:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF2550:
+	.string	"gpsRestartUBLOX"
+.LASF1379:
+	.string	"USE_OPFLOW_MSP "
+.LASF961:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF417:
+	.string	"__USE_LARGEFILE64"
+.LASF1994:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF2471:
+	.string	"CLASS_ACK"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF754:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF2175:
+	.string	"RESOURCE_SPI_MISO"
+.LASF513:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF2438:
+	.string	"res2"
+.LASF677:
+	.string	"__U16_TYPE unsigned short int"
+.LASF2145:
+	.string	"OWNER_MPU"
+.LASF777:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF2563:
+	.string	"configureNAV5"
+.LASF1633:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1294:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF2283:
+	.string	"serialPortConfig_t"
+.LASF1988:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF2476:
+	.string	"MSG_VER"
+.LASF1278:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF498:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF1019:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1653:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1823:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1176:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF1010:
+	.string	"__DECL_SIMD_logf128x "
+.LASF972:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1828:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF2155:
+	.string	"OWNER_TEMPERATURE"
+.LASF2557:
+	.string	"newChar"
+.LASF2007:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF649:
+	.string	"__HAVE_FLOAT64 1"
+.LASF1666:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF584:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1100:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1331:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF1692:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF579:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2198:
+	.string	"SERIAL_BIDIR_NOPULL"
+.LASF2146:
+	.string	"OWNER_INVERTER"
+.LASF1328:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF766:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF2187:
+	.string	"portOptions_t"
+.LASF934:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1986:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF715:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1981:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF2108:
+	.string	"uint8_t"
+.LASF1253:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF1731:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF547:
+	.string	"__stub_fchflags "
+.LASF1369:
+	.string	"USE_RX_UIB "
+.LASF459:
+	.string	"__GNU_LIBRARY__"
+.LASF681:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1770:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2569:
+	.string	"ck_a"
+.LASF607:
+	.string	"NULL"
+.LASF1629:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1268:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF825:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF1619:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF2031:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF959:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF2080:
+	.string	"UBLOX_SBAS_MESSAGE_LENGTH 16"
+.LASF409:
+	.string	"__USE_XOPEN"
+.LASF1037:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF2293:
+	.string	"GPS_MTK"
+.LASF2301:
+	.string	"SBAS_NONE"
+.LASF431:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1024:
+	.string	"__DECL_SIMD_powf16 "
+.LASF1229:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1191:
+	.string	"__DECL_SIMD_erf "
+.LASF1103:
+	.string	"__DECL_SIMD_expm1l "
+.LASF1857:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF2009:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1488:
+	.string	"USE_ADC"
+.LASF738:
+	.string	"__dev_t_defined "
+.LASF451:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF540:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF602:
+	.string	"_GCC_WCHAR_T "
+.LASF525:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF2165:
+	.string	"RESOURCE_IO"
+.LASF1098:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF2432:
+	.string	"ecef_x_velocity"
+.LASF694:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF631:
+	.string	"__WCOREFLAG 0x80"
+.LASF685:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF854:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1514:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF532:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1925:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF1038:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1409:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1838:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF376:
+	.string	"unix 1"
+.LASF1308:
+	.string	"FP_INFINITE 1"
+.LASF1298:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1091:
+	.string	"__DECL_SIMD_cosh "
+.LASF1300:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF981:
+	.string	"__DECL_SIMD_sin "
+.LASF2339:
+	.string	"validMag"
+.LASF1374:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF826:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1730:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1863:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF435:
+	.string	"__USE_ISOC99 1"
+.LASF2265:
+	.string	"SERIAL_PORT_USART2"
+.LASF2066:
+	.string	"ptWaitThread(name) do { ptLabel(); name(); if (!ptIsStopped(ptGetHandle(name))) { return; } } while (0)"
+.LASF994:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1749:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF645:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1473:
+	.string	"USE_SERVO_SBUS"
+.LASF531:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF577:
+	.string	"_SIZE_T_ "
+.LASF720:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF1424:
+	.string	"USE_VTX_CONTROL "
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF1652:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF588:
+	.string	"__need_size_t"
+.LASF2127:
+	.string	"OWNER_PPMINPUT"
+.LASF2483:
+	.string	"MSG_NMEA_RMC"
+.LASF1446:
+	.string	"__need_ptrdiff_t"
+.LASF769:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF1055:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1243:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF2075:
+	.string	"ptSemaphoreSignal(sem) do { sem = true; } while (0)"
+.LASF1375:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1093:
+	.string	"__DECL_SIMD_coshl "
+.LASF1518:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1999:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1269:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF1282:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1754:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1433:
+	.string	"_STDDEF_H "
+.LASF1942:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF1178:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1452:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF1949:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF889:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1632:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1683:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF2010:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF1075:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1939:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF2384:
+	.string	"startTime"
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1456:
+	.string	"USE_UART1 "
+.LASF905:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF909:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF904:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF411:
+	.string	"__USE_UNIX98"
+.LASF1009:
+	.string	"__DECL_SIMD_logf64x "
+.LASF2018:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1570:
+	.string	"FTOA_BUFFER_SIZE 13"
+.LASF2425:
+	.string	"ubx_nav_status"
+.LASF1271:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF477:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF1186:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF1503:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1543:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1265:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF592:
+	.string	"_T_WCHAR_ "
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF548:
+	.string	"__stub_gtty "
+.LASF1364:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF1127:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1589:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF727:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF788:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1721:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF2454:
+	.string	"numCh"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF2576:
+	.string	"gpsProcessNewSolutionData"
+.LASF1885:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF944:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF646:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1767:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF1104:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1363:
+	.string	"USE_PITOT_ADC "
+.LASF2505:
+	.string	"ubs_nav_fix_type"
+.LASF856:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1667:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF729:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF2123:
+	.string	"dateTime_t"
+.LASF1935:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF2021:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1881:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF2033:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF1916:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2575:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF902:
+	.string	"UINT64_C(c) c ## UL"
+.LASF2059:
+	.string	"ptGetHandle(name) (&name ##_protothreadState)"
+.LASF644:
+	.string	"__f128(x) x ##f128"
+.LASF1184:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF809:
+	.string	"__fsblkcnt_t_defined "
+.LASF2417:
+	.string	"horizontal_accuracy"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF857:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1723:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF2167:
+	.string	"RESOURCE_UART_TX"
+.LASF1961:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF764:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1701:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1588:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1792:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF2249:
+	.string	"BAUD_9600"
+.LASF2103:
+	.string	"__uint64_t"
+.LASF1976:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF810:
+	.string	"__fsfilcnt_t_defined "
+.LASF2538:
+	.string	"semNewDataReady"
+.LASF611:
+	.string	"WNOHANG 1"
+.LASF1195:
+	.string	"__DECL_SIMD_erff32 "
+.LASF1827:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF1136:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF2302:
+	.string	"sbasMode_e"
+.LASF1561:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF819:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1656:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF940:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF1670:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1232:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF952:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF1903:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF441:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF2426:
+	.string	"time_nsec"
+.LASF2117:
+	.string	"year"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF1530:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF455:
+	.string	"__USE_ATFILE 1"
+.LASF966:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF2453:
+	.string	"ubx_nav_svinfo_channel"
+.LASF1197:
+	.string	"__DECL_SIMD_erff128 "
+.LASF1605:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1280:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF1841:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1901:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1805:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1808:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1506:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1273:
+	.string	"_Mdouble_ long double"
+.LASF1142:
+	.string	"__DECL_SIMD_log10f "
+.LASF973:
+	.string	"__DECL_SIMD_cosl "
+.LASF2168:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF866:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF2564:
+	.string	"fixMode"
+.LASF750:
+	.string	"__clockid_t_defined 1"
+.LASF1422:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF2534:
+	.string	"_buffer"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1498:
+	.string	"U_ID_1 1"
+.LASF613:
+	.string	"WSTOPPED 2"
+.LASF1753:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF2329:
+	.string	"dynModel"
+.LASF958:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF807:
+	.string	"__blksize_t_defined "
+.LASF2506:
+	.string	"NAV_STATUS_FIX_VALID"
+.LASF2061:
+	.string	"ptIsStopped(handle) ((handle)->line < 0)"
+.LASF833:
+	.string	"__have_pthread_attr_t 1"
+.LASF957:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF614:
+	.string	"WEXITED 4"
+.LASF2136:
+	.string	"OWNER_SYSTEM"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF1941:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF2444:
+	.string	"speed_2d"
+.LASF2457:
+	.string	"channel"
+.LASF706:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF471:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF1468:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1869:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF465:
+	.string	"__PMT"
+.LASF1169:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF1614:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF603:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1378:
+	.string	"USE_OPFLOW_CXOF "
+.LASF2442:
+	.string	"ned_down"
+.LASF2138:
+	.string	"OWNER_I2C"
+.LASF2113:
+	.string	"double"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1365:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF823:
+	.string	"__LOCK_ALIGNMENT "
+.LASF2282:
+	.string	"telemetry_baudrateIndex"
+.LASF2364:
+	.string	"GPS_LOST_COMMUNICATION"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1607:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1260:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF623:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF2000:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2255:
+	.string	"BAUD_250000"
+.LASF1324:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2124:
+	.string	"OWNER_FREE"
+.LASF1152:
+	.string	"__DECL_SIMD_log2f "
+.LASF800:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF2297:
+	.string	"SBAS_EGNOS"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF903:
+	.string	"INTMAX_C(c) c ## L"
+.LASF1201:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF2041:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF2568:
+	.string	"sendConfigMessageUBLOX"
+.LASF1804:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF2177:
+	.string	"RESOURCE_ADC_CH1"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF2443:
+	.string	"speed_3d"
+.LASF1441:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1818:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1310:
+	.string	"FP_SUBNORMAL 3"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF642:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1947:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1995:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF2330:
+	.string	"ubloxUseGalileo"
+.LASF1177:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1549:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1426:
+	.string	"USE_VTX_TRAMP "
+.LASF743:
+	.string	"__off_t_defined "
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF2445:
+	.string	"heading_2d"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF518:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF937:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF1771:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF776:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1959:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF2291:
+	.string	"GPS_NAZA"
+.LASF615:
+	.string	"WCONTINUED 8"
+.LASF1613:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF2385:
+	.string	"delayTime"
+.LASF1802:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF680:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF2543:
+	.string	"gpsSetProtocolTimeout"
+.LASF1522:
+	.string	"UNIT_TESTED "
+.LASF1483:
+	.string	"USE_1WIRE"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF2327:
+	.string	"autoConfig"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF883:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF461:
+	.string	"__GLIBC__ 2"
+.LASF1774:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF870:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF1050:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF850:
+	.string	"INT32_MAX (2147483647)"
+.LASF2242:
+	.string	"ADC_CURRENT"
+.LASF595:
+	.string	"_WCHAR_T_ "
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF2319:
+	.string	"gpsDynModel_e"
+.LASF818:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF2498:
+	.string	"FIX_NONE"
+.LASF1049:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF2509:
+	.string	"UBX_ACK_GOT_ACK"
+.LASF475:
+	.string	"__P(args) args"
+.LASF2064:
+	.string	"ptWait(condition) do { ptLabel(); if (!(condition)) { return; } } while (0)"
+.LASF658:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF2372:
+	.string	"autoBaudrateIndex"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1560:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF882:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF860:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1540:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF917:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF573:
+	.string	"_SYS_SIZE_T_H "
+.LASF705:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF2111:
+	.string	"uint64_t"
+.LASF2028:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1281:
+	.string	"_Mdouble_ _Float128"
+.LASF1245:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF956:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1220:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1662:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF2052:
+	.string	"GPS_SHORT_TIMEOUT (500)"
+.LASF1973:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF822:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF913:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF1167:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1593:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF423:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1971:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1346:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF2389:
+	.string	"usage"
+.LASF1794:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1648:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1746:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF2043:
+	.string	"GPS_DBHZ_MAX 55"
+.LASF795:
+	.string	"__suseconds_t_defined "
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF2503:
+	.string	"FIX_TIME"
+.LASF2523:
+	.string	"_new_position"
+.LASF848:
+	.string	"INT8_MAX (127)"
+.LASF812:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF916:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF804:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF1163:
+	.string	"__DECL_SIMD_log1pl "
+.LASF1045:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF2074:
+	.string	"ptSemaphoreWait(sem) do { ptWait(sem); sem = false; } while (0)"
+.LASF758:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1001:
+	.string	"__DECL_SIMD_log "
+.LASF2144:
+	.string	"OWNER_BARO"
+.LASF2320:
+	.string	"GPS_NO_FIX"
+.LASF995:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF787:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF717:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF2420:
+	.string	"fix_type"
+.LASF1168:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF2565:
+	.string	"configureSBAS"
+.LASF2507:
+	.string	"ubx_nav_status_bits"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF2396:
+	.string	"ubx_msg"
+.LASF1302:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF1117:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1283:
+	.string	"_Mdouble_ _Float32x"
+.LASF2415:
+	.string	"altitude_ellipsoid"
+.LASF2386:
+	.string	"ptSemaphore_t"
+.LASF452:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF2241:
+	.string	"ADC_RSSI"
+.LASF416:
+	.string	"__USE_LARGEFILE"
+.LASF1296:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF1112:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1246:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF1057:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1675:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF1025:
+	.string	"__DECL_SIMD_powf32 "
+.LASF2304:
+	.string	"GPS_BAUDRATE_57600"
+.LASF2460:
+	.string	"nano"
+.LASF1156:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2383:
+	.string	"returnCode"
+.LASF1041:
+	.string	"__DECL_SIMD_atan "
+.LASF2085:
+	.string	"UBX_FIXMODE_3D_ONLY 2"
+.LASF444:
+	.string	"__USE_POSIX199309 1"
+.LASF1784:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF2490:
+	.string	"MSG_TIMEUTC"
+.LASF930:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF2035:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF1736:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1372:
+	.string	"USE_RANGEFINDER "
+.LASF1595:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF876:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1782:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF1064:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1760:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF481:
+	.string	"__END_DECLS "
+.LASF1608:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF1058:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF2139:
+	.string	"OWNER_SDCARD"
+.LASF1335:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF1161:
+	.string	"__DECL_SIMD_log1p "
+.LASF2309:
+	.string	"gpsBaudRate_e"
+.LASF967:
+	.string	"_STRING_H 1"
+.LASF2525:
+	.string	"capGalileo"
+.LASF1233:
+	.string	"__DECL_SIMD_tanl "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF2004:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF702:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1400:
+	.string	"USE_LOG "
+.LASF1319:
+	.string	"MATH_ERREXCEPT 2"
+.LASF2427:
+	.string	"week"
+.LASF2105:
+	.string	"int16_t"
+.LASF535:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1187:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1325:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF2452:
+	.string	"prRes"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF2496:
+	.string	"MSG_CFG_SBAS"
+.LASF2094:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1812:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2096:
+	.string	"signed char"
+.LASF659:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF1006:
+	.string	"__DECL_SIMD_logf64 "
+.LASF989:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1407:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF2019:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1105:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF570:
+	.string	"__size_t__ "
+.LASF446:
+	.string	"__USE_XOPEN2K 1"
+.LASF1305:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF2398:
+	.string	"ubx_rate"
+.LASF1110:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF1575:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1969:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1887:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF1825:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF2078:
+	.string	"MAX_UBLOX_PAYLOAD_SIZE 256"
+.LASF501:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF2554:
+	.string	"_right1"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF609:
+	.string	"__need_NULL"
+.LASF751:
+	.string	"__time_t_defined 1"
+.LASF779:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF771:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF1840:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF2189:
+	.string	"SERIAL_INVERTED"
+.LASF2322:
+	.string	"GPS_FIX_3D"
+.LASF1189:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1571:
+	.string	"sq(x) ((x)*(x))"
+.LASF2529:
+	.string	"status"
+.LASF884:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF545:
+	.string	"__stub___compat_bdflush "
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF2202:
+	.string	"count"
+.LASF1373:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1293:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1524:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF1910:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1829:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1623:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF832:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF400:
+	.string	"_FEATURES_H 1"
+.LASF661:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF2388:
+	.string	"baudInitDataNMEA"
+.LASF578:
+	.string	"_BSD_SIZE_T_ "
+.LASF519:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1928:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF503:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1474:
+	.string	"USE_DASHBOARD"
+.LASF2447:
+	.string	"ubx_nav_velned"
+.LASF2407:
+	.string	"ubx_header"
+.LASF1336:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF2501:
+	.string	"FIX_3D"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF811:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF619:
+	.string	"__WCLONE 0x80000000"
+.LASF1200:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1678:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF2491:
+	.string	"MSG_SVINFO"
+.LASF1153:
+	.string	"__DECL_SIMD_log2l "
+.LASF936:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF2016:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF2470:
+	.string	"CLASS_NAV"
+.LASF806:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF635:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF1955:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF703:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2273:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2274:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF1397:
+	.string	"USE_ANTIGRAVITY "
+.LASF1907:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF730:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1504:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1502:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF2459:
+	.string	"tAcc"
+.LASF1741:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2370:
+	.string	"state"
+.LASF1634:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF1425:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1534:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF2132:
+	.string	"OWNER_SERIAL"
+.LASF1214:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1435:
+	.string	"_ANSI_STDDEF_H "
+.LASF453:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF1320:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF2143:
+	.string	"OWNER_OSD"
+.LASF997:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF2472:
+	.string	"CLASS_CFG"
+.LASF2159:
+	.string	"OWNER_PINIO"
+.LASF1046:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF1888:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1919:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF2002:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF1752:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1007:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1968:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1920:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF1129:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF2158:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF2572:
+	.string	"gpsMapFixType"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1586:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1449:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1339:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2199:
+	.string	"_dateTime_s"
+.LASF1327:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF2451:
+	.string	"azim"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF2335:
+	.string	"hasNewData"
+.LASF2039:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1244:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF1022:
+	.string	"__DECL_SIMD_powf "
+.LASF534:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF871:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1348:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1744:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1650:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF998:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF487:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF748:
+	.string	"__key_t_defined "
+.LASF1157:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF2555:
+	.string	"gpsProtocolStateThread"
+.LASF2223:
+	.string	"rxIrqCount"
+.LASF922:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF1814:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1536:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF2387:
+	.string	"ubloxScanMode1"
+.LASF927:
+	.string	"isascii(c) __isascii (c)"
+.LASF1309:
+	.string	"FP_ZERO 2"
+.LASF774:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1529:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF696:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF962:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1871:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1642:
+	.string	"IOCFG_AF_OD 0"
+.LASF2526:
+	.string	"message"
+.LASF2195:
+	.string	"SERIAL_BIDIR"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1693:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1463:
+	.string	"USE_UART8 "
+.LASF1014:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1548:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1485:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1382:
+	.string	"USE_1WIRE_DS2482 "
+.LASF538:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2272:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF1874:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF479:
+	.string	"__ptr_t void *"
+.LASF1481:
+	.string	"USE_PITOT_MS4525"
+.LASF1984:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF1391:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1158:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF2166:
+	.string	"RESOURCE_TIMER"
+.LASF686:
+	.string	"__SLONG32_TYPE int"
+.LASF2351:
+	.string	"time"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2264:
+	.string	"SERIAL_PORT_USART1"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF2266:
+	.string	"SERIAL_PORT_USART3"
+.LASF2267:
+	.string	"SERIAL_PORT_USART4"
+.LASF2268:
+	.string	"SERIAL_PORT_USART5"
+.LASF2269:
+	.string	"SERIAL_PORT_USART6"
+.LASF2270:
+	.string	"SERIAL_PORT_USART7"
+.LASF2271:
+	.string	"SERIAL_PORT_USART8"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2226:
+	.string	"serialTotalRxWaiting"
+.LASF1657:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1383:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF404:
+	.string	"__USE_ISOCXX11"
+.LASF2362:
+	.string	"GPS_INITIALIZING"
+.LASF1084:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF1563:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF1779:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF2371:
+	.string	"baudrateIndex"
+.LASF1440:
+	.string	"_PTRDIFF_T_ "
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF1154:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1668:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF430:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF2463:
+	.string	"ubx_nav_timeutc"
+.LASF844:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF852:
+	.string	"UINT8_MAX (255)"
+.LASF1797:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF2133:
+	.string	"OWNER_PINDEBUG"
+.LASF1724:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF2245:
+	.string	"BAUD_AUTO"
+.LASF1991:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF2405:
+	.string	"msg_id"
+.LASF1577:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF2548:
+	.string	"gpsSetState"
+.LASF816:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF2037:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF476:
+	.string	"__PMT(args) args"
+.LASF2042:
+	.string	"GPS_DBHZ_MIN 0"
+.LASF1684:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1367:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF383:
+	.string	"SITL 1"
+.LASF2251:
+	.string	"BAUD_38400"
+.LASF1621:
+	.string	"UNUSED(x) (void)(x)"
+.LASF861:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1879:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1030:
+	.string	"__DECL_SIMD_powf128x "
+.LASF1439:
+	.string	"__PTRDIFF_T "
+.LASF794:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF672:
+	.string	"EXIT_SUCCESS 0"
+.LASF1118:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1824:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1750:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1257:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF2056:
+	.string	"PROTOTHREAD(name) static struct ptState_s name ##_protothreadState = {0, 0, 0, 0}; void name(void)"
+.LASF1856:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF2032:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF719:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1950:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1951:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2182:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1609:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF464:
+	.string	"_SYS_CDEFS_H 1"
+.LASF482:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1618:
+	.string	"EXPAND_I(x) x"
+.LASF1800:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1945:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF2566:
+	.string	"configureGalileo"
+.LASF1891:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1036:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF1757:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1263:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF2110:
+	.string	"uint32_t"
+.LASF2205:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF576:
+	.string	"__SIZE_T "
+.LASF2479:
+	.string	"MSG_NMEA_GGA"
+.LASF724:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF1053:
+	.string	"__DECL_SIMD_asinl "
+.LASF1624:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF1497:
+	.string	"U_ID_0 0"
+.LASF2217:
+	.string	"rxBufferTail"
+.LASF2086:
+	.string	"UBX_FIXMODE_AUTO 3"
+.LASF1461:
+	.string	"USE_UART6 "
+.LASF664:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF2379:
+	.string	"gpsState"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF432:
+	.string	"_DEFAULT_SOURCE"
+.LASF1865:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF2303:
+	.string	"GPS_BAUDRATE_115200"
+.LASF1151:
+	.string	"__DECL_SIMD_log2 "
+.LASF1722:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1479:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF2422:
+	.string	"differential_status"
+.LASF2431:
+	.string	"position_accuracy_3d"
+.LASF707:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF723:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1864:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF2164:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF2541:
+	.string	"serialWriteBuf"
+.LASF1139:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF1974:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1170:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF2122:
+	.string	"millis"
+.LASF575:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF2544:
+	.string	"fastA2I"
+.LASF2446:
+	.string	"heading_accuracy"
+.LASF665:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF798:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF1180:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2230:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF2578:
+	.string	"_update_checksum"
+.LASF2571:
+	.string	"gpsNewFrameUBLOX"
+.LASF778:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF443:
+	.string	"__USE_POSIX2 1"
+.LASF604:
+	.string	"__DEFINED_wchar_t "
+.LASF2065:
+	.string	"ptWaitTimeout(condition,timeoutMs) do { currentPt->startTime = (timeUs_t)millis(); currentPt->delayTime = (timeoutMs); ptLabel(); if (!(condition) && ((timeDelta_t)(millis() - (currentPt)->startTime) <= (currentPt)->delayTime)) { return; } } while (0)"
+.LASF2468:
+	.string	"PREAMBLE1"
+.LASF2469:
+	.string	"PREAMBLE2"
+.LASF494:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF488:
+	.string	"__flexarr []"
+.LASF2436:
+	.string	"position_DOP"
+.LASF429:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF2348:
+	.string	"groundSpeed"
+.LASF675:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF865:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1432:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1326:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1523:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF490:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF792:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1551:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2502:
+	.string	"FIX_GPS_DEAD_RECKONING"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1403:
+	.string	"CMS_MENU_OSD "
+.LASF1740:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF858:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1556:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF440:
+	.string	"_POSIX_C_SOURCE"
+.LASF990:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF2233:
+	.string	"isConnected"
+.LASF1849:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1515:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF670:
+	.string	"RAND_MAX 2147483647"
+.LASF1415:
+	.string	"USE_SERIALRX_SUMD "
+.LASF2134:
+	.string	"OWNER_TIMER"
+.LASF678:
+	.string	"__S32_TYPE int"
+.LASF2424:
+	.string	"uptime"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1726:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1923:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1953:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF1358:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1899:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1352:
+	.string	"USE_64BIT_TIME "
+.LASF1266:
+	.string	"_Mdouble_"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1958:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF2044:
+	.string	"LAT 0"
+.LASF2053:
+	.string	"GPS_BAUD_CHANGE_DELAY (100)"
+.LASF2104:
+	.string	"char"
+.LASF817:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1147:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1796:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF698:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF551:
+	.string	"__stub_sigreturn "
+.LASF1209:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF653:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1733:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF636:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF1880:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF977:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF2536:
+	.string	"galileo_payload"
+.LASF1507:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF1144:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF2477:
+	.string	"MSG_ACK_NACK"
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF676:
+	.string	"__S16_TYPE short int"
+.LASF1061:
+	.string	"__DECL_SIMD_hypot "
+.LASF1729:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF939:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF1248:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF2361:
+	.string	"GPS_UNKNOWN"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF572:
+	.string	"_SIZE_T "
+.LASF612:
+	.string	"WUNTRACED 2"
+.LASF2528:
+	.string	"posllh"
+.LASF1676:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF1017:
+	.string	"__DECL_SIMD_expf128 "
+.LASF2552:
+	.string	"ptYielded"
+.LASF507:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1410:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF976:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF1148:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1527:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1708:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2263:
+	.string	"SERIAL_PORT_NONE"
+.LASF841:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1813:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF2473:
+	.string	"CLASS_MON"
+.LASF1644:
+	.string	"IOCFG_IPU 0"
+.LASF1594:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF1414:
+	.string	"USE_RX_MSP "
+.LASF1859:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF906:
+	.string	"_CTYPE_H 1"
+.LASF1602:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF395:
+	.string	"true 1"
+.LASF1861:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF978:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF514:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF2561:
+	.string	"measRate"
+.LASF2310:
+	.string	"GPS_AUTOCONFIG_OFF"
+.LASF1032:
+	.string	"__DECL_SIMD_acosf "
+.LASF710:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF580:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF2485:
+	.string	"MSG_POSLLH"
+.LASF2380:
+	.string	"gpsToSerialBaudRate"
+.LASF1834:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF2448:
+	.string	"svid"
+.LASF1215:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF1398:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1362:
+	.string	"USE_PITOT "
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF735:
+	.string	"__STD_TYPE"
+.LASF1590:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF2531:
+	.string	"velned"
+.LASF721:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF867:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF2435:
+	.string	"speed_accuracy"
+.LASF2077:
+	.string	"GPS_VERSION_RETRY_TIMES 2"
+.LASF687:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF648:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1174:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF1867:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF569:
+	.string	"__need_NULL "
+.LASF2530:
+	.string	"solution"
+.LASF2083:
+	.string	"UBX_DYNMODEL_AIR_4G 8"
+.LASF2542:
+	.string	"serialPrint"
+.LASF1569:
+	.string	"ANGLE_INDEX_COUNT 2"
+.LASF1711:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1113:
+	.string	"__DECL_SIMD_sinhl "
+.LASF942:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF2510:
+	.string	"UBX_ACK_GOT_NAK"
+.LASF1227:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF1056:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF1438:
+	.string	"_T_PTRDIFF "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF608:
+	.string	"NULL ((void *)0)"
+.LASF567:
+	.string	"__need_size_t "
+.LASF1212:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF1188:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF1616:
+	.string	"STR_HELPER(x) #x"
+.LASF831:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1237:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF2194:
+	.string	"SERIAL_UNIDIR"
+.LASF2292:
+	.string	"GPS_UBLOX7PLUS"
+.LASF847:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1761:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF500:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF1520:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF1822:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1922:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF530:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF2058:
+	.string	"ptBegin(name) struct ptState_s * currentPt = ptGetHandle(name); bool ptYielded = true; (void) ptYielded; switch (currentPt->line) { case 0:"
+.LASF892:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF790:
+	.string	"__sigset_t_defined 1"
+.LASF1555:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF2480:
+	.string	"MSG_NMEA_GLL"
+.LASF1082:
+	.string	"__DECL_SIMD_exp10f "
+.LASF1015:
+	.string	"__DECL_SIMD_expf32 "
+.LASF2040:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF1739:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1777:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF515:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1860:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1317:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2170:
+	.string	"RESOURCE_EXTI"
+.LASF606:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF881:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF2210:
+	.string	"options"
+.LASF1137:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF2101:
+	.string	"__int32_t"
+.LASF467:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF447:
+	.string	"__USE_XOPEN2K8 1"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF2360:
+	.string	"gpsStats"
+.LASF1181:
+	.string	"__DECL_SIMD_acosh "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF1404:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1355:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1845:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1443:
+	.string	"_GCC_PTRDIFF_T "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1936:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF371:
+	.string	"__linux 1"
+.LASF911:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF1304:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1966:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1902:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF463:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1337:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1848:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1706:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF1307:
+	.string	"FP_NAN 0"
+.LASF541:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF543:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF656:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1330:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF745:
+	.string	"__id_t_defined "
+.LASF1138:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1366:
+	.string	"USE_GYRO_KALMAN "
+.LASF1094:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF2070:
+	.string	"ptYield() do { ptYielded = false; ptLabel(); if (!ptYielded) { return; } } while (0)"
+.LASF1323:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF829:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF2519:
+	.string	"next_fix_type"
+.LASF2277:
+	.string	"serialPortConfig_s"
+.LASF2307:
+	.string	"GPS_BAUDRATE_9600"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF912:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF1579:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF1259:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF1997:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF449:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1255:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF2562:
+	.string	"configureMSG"
+.LASF943:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF1681:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF828:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF1663:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF2005:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2068:
+	.string	"ptDelayMs(delay) do { (currentPt)->startTime = (timeUs_t)millis(); (currentPt)->delayTime = (delay); ptLabel(); if ((timeDelta_t)(millis() - (currentPt)->startTime) <= (currentPt)->delayTime) { return; } } while (0)"
+.LASF1512:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF747:
+	.string	"__daddr_t_defined "
+.LASF516:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2191:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1226:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF1303:
+	.string	"__MATHCALL_NARROW"
+.LASF1630:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF618:
+	.string	"__WALL 0x40000000"
+.LASF1816:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF483:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF761:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF775:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF1031:
+	.string	"__DECL_SIMD_acos "
+.LASF426:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF1702:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1831:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF1610:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1427:
+	.string	"USE_VTX_FFPV "
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF1102:
+	.string	"__DECL_SIMD_expm1f "
+.LASF1126:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF1837:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF1541:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF1008:
+	.string	"__DECL_SIMD_logf32x "
+.LASF2082:
+	.string	"UBX_DYNMODEL_AIR_1G 6"
+.LASF814:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF1628:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF418:
+	.string	"__USE_FILE_OFFSET64"
+.LASF630:
+	.string	"__W_CONTINUED 0xffff"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1972:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF2261:
+	.string	"BAUD_2470000"
+.LASF2514:
+	.string	"_skip_packet"
+.LASF1360:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF1242:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1196:
+	.string	"__DECL_SIMD_erff64 "
+.LASF2345:
+	.string	"numSat"
+.LASF1334:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1870:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF918:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF1430:
+	.string	"USE_CLI_BATCH "
+.LASF1913:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF674:
+	.string	"_SYS_TYPES_H 1"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1769:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF1034:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF965:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF1596:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF1131:
+	.string	"__DECL_SIMD_atan2 "
+.LASF708:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF1394:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF2051:
+	.string	"GPS_TIMEOUT (1000)"
+.LASF759:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1261:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF1674:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF1592:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1661:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1627:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1697:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF762:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1204:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF718:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1208:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF2577:
+	.string	"gpsParceFrameUBLOX"
+.LASF437:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF596:
+	.string	"_BSD_WCHAR_T_ "
+.LASF1079:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1580:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1342:
+	.string	"I2C2_OVERCLOCK false"
+.LASF669:
+	.string	"__lldiv_t_defined 1"
+.LASF2149:
+	.string	"OWNER_RX"
+.LASF863:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1710:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF2365:
+	.string	"gpsState_e"
+.LASF502:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1447:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF2296:
+	.string	"SBAS_AUTO"
+.LASF1322:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1965:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF821:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF2508:
+	.string	"UBX_ACK_WAITING"
+.LASF1249:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1316:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2102:
+	.string	"__uint32_t"
+.LASF1042:
+	.string	"__DECL_SIMD_atanf "
+.LASF422:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1219:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF625:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF406:
+	.string	"__USE_POSIX2"
+.LASF2346:
+	.string	"magData"
+.LASF1926:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF888:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF1116:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2404:
+	.string	"msg_class"
+.LASF2358:
+	.string	"baudRates"
+.LASF1851:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1696:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1567:
+	.string	"XYZ_AXIS_COUNT 3"
+.LASF1486:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF1448:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1080:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF1716:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2257:
+	.string	"BAUD_921600"
+.LASF2551:
+	.string	"currentPt"
+.LASF2234:
+	.string	"isIdle"
+.LASF1405:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF2140:
+	.string	"OWNER_FLASH"
+.LASF2211:
+	.string	"baudRate"
+.LASF2006:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF419:
+	.string	"__USE_MISC"
+.LASF2084:
+	.string	"UBX_FIXMODE_2D_ONLY 1"
+.LASF1399:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2276:
+	.string	"serialPortIdentifier_e"
+.LASF684:
+	.string	"__SWORD_TYPE long int"
+.LASF568:
+	.string	"__need_wchar_t "
+.LASF1992:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF413:
+	.string	"__USE_XOPEN2KXSI"
+.LASF2337:
+	.string	"validVelNE"
+.LASF1211:
+	.string	"__DECL_SIMD_asinh "
+.LASF1347:
+	.string	"USE_SERIALRX_SBUS "
+.LASF1371:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF878:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF1420:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF1258:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1388:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF808:
+	.string	"__blkcnt_t_defined "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2279:
+	.string	"msp_baudrateIndex"
+.LASF617:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF2215:
+	.string	"txBuffer"
+.LASF593:
+	.string	"_T_WCHAR "
+.LASF2549:
+	.string	"gpsHandleUBLOX"
+.LASF1028:
+	.string	"__DECL_SIMD_powf32x "
+.LASF586:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1917:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF853:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1759:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF1384:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF1745:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF726:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1434:
+	.string	"_STDDEF_H_ "
+.LASF1655:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF734:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF2413:
+	.string	"longitude"
+.LASF1051:
+	.string	"__DECL_SIMD_asin "
+.LASF2022:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1691:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF691:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1776:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF1892:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1291:
+	.string	"__MATHCALL"
+.LASF1145:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF2062:
+	.string	"ptGetReturnCode(handle) ((handle)->returnCode)"
+.LASF1900:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1213:
+	.string	"__DECL_SIMD_asinhl "
+.LASF2150:
+	.string	"OWNER_TX"
+.LASF900:
+	.string	"UINT16_C(c) c"
+.LASF2369:
+	.string	"hwVersion"
+.LASF815:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF929:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF1735:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF834:
+	.string	"_ALLOCA_H 1"
+.LASF1454:
+	.string	"USE_MAG "
+.LASF2157:
+	.string	"OWNER_AIRSPEED"
+.LASF1809:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF886:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1338:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF2284:
+	.string	"serialConfig_s"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF1198:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1171:
+	.string	"__DECL_SIMD_atanh "
+.LASF984:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF2399:
+	.string	"bytes"
+.LASF2047:
+	.string	"SBAS_MODE_MAX SBAS_GAGAN"
+.LASF951:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF1250:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF407:
+	.string	"__USE_POSIX199309"
+.LASF2057:
+	.string	"STATIC_PROTOTHREAD(name) static struct ptState_s name ##_protothreadState = {0, 0, 0, 0}; static void name(void)"
+.LASF2353:
+	.string	"lastMessageDt"
+.LASF1083:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1897:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1221:
+	.string	"__DECL_SIMD_erfc "
+.LASF1160:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1564:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1695:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1873:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1762:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF2079:
+	.string	"UBLOX_BUFFER_SIZE MAX_UBLOX_PAYLOAD_SIZE"
+.LASF660:
+	.string	"__f32(x) x ##f32"
+.LASF2537:
+	.string	"gpsConfigure_protothreadState"
+.LASF594:
+	.string	"__WCHAR_T "
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF697:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2253:
+	.string	"BAUD_115200"
+.LASF1883:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1686:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF2306:
+	.string	"GPS_BAUDRATE_19200"
+.LASF736:
+	.string	"__u_char_defined "
+.LASF1238:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF2224:
+	.string	"serialPortVTable"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF915:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF1821:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1062:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF1765:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF996:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF799:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF2190:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2185:
+	.string	"MODE_RXTX"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF2186:
+	.string	"portMode_t"
+.LASF655:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF2540:
+	.string	"gpsProtocolStateThread_protothreadState"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1882:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF2116:
+	.string	"timeUs_t"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF2481:
+	.string	"MSG_NMEA_GSA"
+.LASF1199:
+	.string	"__DECL_SIMD_erff64x "
+.LASF2107:
+	.string	"long long unsigned int"
+.LASF737:
+	.string	"__ino_t_defined "
+.LASF1140:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF731:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF2516:
+	.string	"_msg_id"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF2036:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF1026:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2539:
+	.string	"gpsProtocolReceiverThread_protothreadState"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF992:
+	.string	"__DECL_SIMD_sincosf "
+.LASF2482:
+	.string	"MSG_NMEA_GSV"
+.LASF1646:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1893:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF640:
+	.string	"__HAVE_FLOAT128 1"
+.LASF2393:
+	.string	"ubx_sbas"
+.LASF2243:
+	.string	"ADC_AIRSPEED"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF2411:
+	.string	"swVersion"
+.LASF1970:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1048:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1341:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF2045:
+	.string	"LON 1"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF1904:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF1565:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF480:
+	.string	"__BEGIN_DECLS "
+.LASF1072:
+	.string	"__DECL_SIMD_exp2f "
+.LASF520:
+	.string	"__restrict_arr __restrict"
+.LASF988:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF2244:
+	.string	"ADC_FUNCTION_COUNT"
+.LASF899:
+	.string	"UINT8_C(c) c"
+.LASF838:
+	.string	"_STDINT_H 1"
+.LASF434:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF2518:
+	.string	"_payload_counter"
+.LASF1241:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1547:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF2323:
+	.string	"gpsFixType_e"
+.LASF639:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2204:
+	.string	"serialReceiveCallbackPtr"
+.LASF1989:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1396:
+	.string	"USE_D_BOOST "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF445:
+	.string	"__USE_POSIX199506 1"
+.LASF928:
+	.string	"toascii(c) __toascii (c)"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF2247:
+	.string	"BAUD_2400"
+.LASF1276:
+	.string	"_Mdouble_ _Float32"
+.LASF549:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF521:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1673:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1948:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1475:
+	.string	"USE_OLED_UG2864"
+.LASF695:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF621:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF1162:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1553:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1431:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1513:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF782:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF2333:
+	.string	"gpsLocation_s"
+.LASF2334:
+	.string	"gpsLocation_t"
+.LASF2178:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2179:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2180:
+	.string	"RESOURCE_ADC_CH4"
+.LASF1099:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1106:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1835:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1854:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1855:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2196:
+	.string	"SERIAL_BIDIR_OD"
+.LASF469:
+	.string	"__LEAF , __leaf__"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF2527:
+	.string	"send_buffer"
+.LASF1081:
+	.string	"__DECL_SIMD_exp10 "
+.LASF650:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF450:
+	.string	"__WORDSIZE 64"
+.LASF2475:
+	.string	"MSG_CLASS_NMEA"
+.LASF638:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF2356:
+	.string	"packetCount"
+.LASF968:
+	.string	"_STRINGS_H 1"
+.LASF1069:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF746:
+	.string	"__ssize_t_defined "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1272:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF986:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF448:
+	.string	"_ATFILE_SOURCE"
+.LASF1421:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1381:
+	.string	"USE_1WIRE "
+.LASF1047:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1202:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1717:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF1756:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF542:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1234:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF805:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1672:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1843:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF491:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF914:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF2206:
+	.string	"serialPort_s"
+.LASF2238:
+	.string	"serialPort_t"
+.LASF2126:
+	.string	"OWNER_PWMINPUT"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF657:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1790:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF827:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF2227:
+	.string	"serialTotalTxFree"
+.LASF1029:
+	.string	"__DECL_SIMD_powf64x "
+.LASF979:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1615:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF496:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1876:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1521:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF1469:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF439:
+	.string	"_POSIX_SOURCE 1"
+.LASF1043:
+	.string	"__DECL_SIMD_atanl "
+.LASF2197:
+	.string	"SERIAL_BIDIR_PP"
+.LASF813:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF2048:
+	.string	"GPS_BAUDRATE_MAX GPS_BAUDRATE_9600"
+.LASF2402:
+	.string	"preamble1"
+.LASF2403:
+	.string	"preamble2"
+.LASF1603:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF2408:
+	.string	"header"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF2391:
+	.string	"scanmode2"
+.LASF885:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1442:
+	.string	"___int_ptrdiff_t_h "
+.LASF2434:
+	.string	"ecef_z_velocity"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1141:
+	.string	"__DECL_SIMD_log10 "
+.LASF1690:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF1087:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF523:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF722:
+	.string	"__TIMER_T_TYPE void *"
+.LASF2521:
+	.string	"_ack_state"
+.LASF933:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF2440:
+	.string	"ned_north"
+.LASF2429:
+	.string	"ecef_y"
+.LASF2430:
+	.string	"ecef_z"
+.LASF2073:
+	.string	"ptSemaphoreInit(sem) do { sem = false; } while (0)"
+.LASF1983:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF1114:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1713:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF971:
+	.string	"__DECL_SIMD_cos "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1584:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF1035:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1574:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1664:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF773:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF1122:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1357:
+	.string	"USE_TELEMETRY "
+.LASF1023:
+	.string	"__DECL_SIMD_powl "
+.LASF460:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF802:
+	.string	"NFDBITS __NFDBITS"
+.LASF2092:
+	.string	"long long int"
+.LASF712:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF2567:
+	.string	"pollVersion"
+.LASF2486:
+	.string	"MSG_STATUS"
+.LASF1635:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1639:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1205:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF671:
+	.string	"EXIT_FAILURE 1"
+.LASF1350:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF1385:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1946:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF632:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1230:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1279:
+	.string	"_Mdouble_ _Float64"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1493:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF923:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF1933:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1915:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1286:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF583:
+	.string	"__DEFINED_size_t "
+.LASF1598:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1671:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF941:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF2416:
+	.string	"altitude_msl"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF2455:
+	.string	"globalFlags"
+.LASF1967:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2392:
+	.string	"scanmode1"
+.LASF2174:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF2137:
+	.string	"OWNER_SPI"
+.LASF622:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF1578:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1878:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1938:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF960:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF504:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1787:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2222:
+	.string	"rxFrameCallback"
+.LASF1392:
+	.string	"USE_FRSKYOSD "
+.LASF2193:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1743:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1478:
+	.string	"USE_RANGEFINDER"
+.LASF1810:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1192:
+	.string	"__DECL_SIMD_erff "
+.LASF1532:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF925:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF420:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1333:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1889:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1368:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1464:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF2089:
+	.string	"UBX_VALID_GPS_DATE_TIME(valid) (UBX_VALID_GPS_DATE(valid) && UBX_VALID_GPS_TIME(valid))"
+.LASF830:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF374:
+	.string	"__unix 1"
+.LASF526:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF974:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1416:
+	.string	"USE_SERIALRX_SUMH "
+.LASF633:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF506:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF2350:
+	.string	"hdop"
+.LASF2090:
+	.string	"long unsigned int"
+.LASF2570:
+	.string	"ck_b"
+.LASF2147:
+	.string	"OWNER_LED_STRIP"
+.LASF1906:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF880:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF1457:
+	.string	"USE_UART2 "
+.LASF425:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF887:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF2046:
+	.string	"GPS_DEGREES_DIVIDER 10000000L"
+.LASF2154:
+	.string	"OWNER_COMPASS"
+.LASF1537:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF1631:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF714:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1846:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF2023:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1898:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF2088:
+	.string	"UBX_VALID_GPS_TIME(valid) (valid & 1 << 1)"
+.LASF993:
+	.string	"__DECL_SIMD_sincosl "
+.LASF931:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF2014:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF711:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1247:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF2225:
+	.string	"serialWrite"
+.LASF2341:
+	.string	"validTime"
+.LASF1092:
+	.string	"__DECL_SIMD_coshf "
+.LASF2495:
+	.string	"MSG_CFG_NAV_SETTINGS"
+.LASF1587:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF704:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1798:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1819:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF1677:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF1073:
+	.string	"__DECL_SIMD_exp2l "
+.LASF1090:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF1458:
+	.string	"USE_UART3 "
+.LASF1583:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF2478:
+	.string	"MSG_ACK_ACK"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1894:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF1517:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1124:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF1343:
+	.string	"USE_I2C_PULLUP "
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1665:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1612:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF571:
+	.string	"__SIZE_T__ "
+.LASF1542:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1423:
+	.string	"USE_RCDEVICE "
+.LASF1492:
+	.string	"USE_RCDEVICE"
+.LASF2466:
+	.string	"ubx_nav_pvt"
+.LASF1591:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF700:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF2256:
+	.string	"BAUD_460800"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF486:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF478:
+	.string	"__STRING(x) #x"
+.LASF1480:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1533:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1748:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1576:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2252:
+	.string	"BAUD_57600"
+.LASF1185:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF1175:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF2095:
+	.string	"unsigned int"
+.LASF1459:
+	.string	"USE_UART4 "
+.LASF1875:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF1065:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF784:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF2055:
+	.string	"GPS_BOOT_DELAY (3000)"
+.LASF2377:
+	.string	"timeoutMs"
+.LASF1417:
+	.string	"USE_SERIALRX_XBUS "
+.LASF1826:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1306:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1649:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF499:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF2203:
+	.string	"serialBufChunk_t"
+.LASF2376:
+	.string	"lastMessageMs"
+.LASF1918:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF509:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF1132:
+	.string	"__DECL_SIMD_atan2f "
+.LASF991:
+	.string	"__DECL_SIMD_sincos "
+.LASF1956:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1203:
+	.string	"__DECL_SIMD_tanhl "
+.LASF2556:
+	.string	"gpsProtocolReceiverThread"
+.LASF1411:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF2069:
+	.string	"ptDelayUs(delay) do { (currentPt)->startTime = (timeUs_t)micros(); (currentPt)->delayTime = (delay); ptLabel(); if ((timeDelta_t)(micros() - (currentPt)->startTime) <= (currentPt)->delayTime) { return; } } while (0)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF692:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF462:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF2054:
+	.string	"GPS_INIT_DELAY (500)"
+.LASF1550:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF2131:
+	.string	"OWNER_ADC"
+.LASF2099:
+	.string	"short int"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1290:
+	.string	"__MATHDECL"
+.LASF1370:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF982:
+	.string	"__DECL_SIMD_sinf "
+.LASF1413:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1134:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1125:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF2395:
+	.string	"rate"
+.LASF1193:
+	.string	"__DECL_SIMD_erfl "
+.LASF1785:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF2368:
+	.string	"gpsPort"
+.LASF1924:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1460:
+	.string	"USE_UART5 "
+.LASF1285:
+	.string	"_Mdouble_ _Float64x"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF2515:
+	.string	"_step"
+.LASF688:
+	.string	"__S64_TYPE long int"
+.LASF2344:
+	.string	"fixType"
+.LASF801:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF2169:
+	.string	"RESOURCE_UART_TXRX"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1223:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1839:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1476:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1526:
+	.string	"EXTENDED_FASTRAM "
+.LASF1979:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1738:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2349:
+	.string	"groundCourse"
+.LASF1088:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1699:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF647:
+	.string	"__HAVE_FLOAT16 0"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1982:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1445:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1539:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF1862:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF436:
+	.string	"__USE_ISOC95 1"
+.LASF1321:
+	.string	"M_E 2.7182818284590452354"
+.LASF2343:
+	.string	"flags"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF1975:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF2181:
+	.string	"RESOURCE_RX_CE"
+.LASF1465:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1217:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF1766:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF553:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF2121:
+	.string	"seconds"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1123:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF2076:
+	.string	"GPS_CFG_CMD_TIMEOUT_MS 200"
+.LASF1788:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2607:
+	.string	"typeconversion.h"
+.LASF2641:
+	.string	"thread-shared-types.h"
+.LASF2591:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2658:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2593:
+	.string	"/usr/include"
+.LASF2662:
+	.string	"mathcalls-helper-functions.h"
+.LASF2635:
+	.string	"select.h"
+.LASF2624:
+	.string	"floatn-common.h"
+.LASF2649:
+	.string	"stdint.h"
+.LASF2579:
+	.string	"src/main/build"
+.LASF2590:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2609:
+	.string	"stdbool.h"
+.LASF2675:
+	.string	"io.h"
+.LASF2598:
+	.string	"time.h"
+.LASF2621:
+	.string	"waitflags.h"
+.LASF2586:
+	.string	"src/main/target/SITL"
+.LASF2640:
+	.string	"pthreadtypes.h"
+.LASF2668:
+	.string	"common_post.h"
+.LASF2614:
+	.string	"wordsize.h"
+.LASF2672:
+	.string	"gps_conversion.h"
+.LASF2589:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2611:
+	.string	"libc-header-start.h"
+.LASF2630:
+	.string	"timer_t.h"
+.LASF2606:
+	.string	"gps_ublox.c"
+.LASF2664:
+	.string	"platform.h"
+.LASF2594:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2600:
+	.string	"resource.h"
+.LASF2605:
+	.string	"protothreads.h"
+.LASF2628:
+	.string	"clockid_t.h"
+.LASF2680:
+	.string	"rx_pwm.h"
+.LASF2670:
+	.string	"debug.h"
+.LASF2608:
+	.string	"stdc-predef.h"
+.LASF2656:
+	.string	"math.h"
+.LASF2631:
+	.string	"endian.h"
+.LASF2677:
+	.string	"io_def.h"
+.LASF2612:
+	.string	"features.h"
+.LASF2588:
+	.string	"src/main"
+.LASF2584:
+	.string	"src/main/io"
+.LASF2657:
+	.string	"math-vector.h"
+.LASF2651:
+	.string	"ctype.h"
+.LASF2581:
+	.string	"src/main/config"
+.LASF2613:
+	.string	"features-time64.h"
+.LASF2655:
+	.string	"strings.h"
+.LASF2645:
+	.string	"struct_rwlock.h"
+.LASF2633:
+	.string	"byteswap.h"
+.LASF2679:
+	.string	"config.h"
+.LASF2660:
+	.string	"fp-logb.h"
+.LASF2604:
+	.string	"gps_private.h"
+.LASF2626:
+	.string	"time64.h"
+.LASF2654:
+	.string	"string.h"
+.LASF2666:
+	.string	"target.h"
+.LASF2619:
+	.string	"stubs-64.h"
+.LASF2673:
+	.string	"maths.h"
+.LASF2622:
+	.string	"waitstatus.h"
+.LASF2583:
+	.string	"src/main/fc"
+.LASF2650:
+	.string	"wchar.h"
+.LASF2615:
+	.string	"timesize.h"
+.LASF2580:
+	.string	"src/main/common"
+.LASF2592:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2681:
+	.string	"stats.h"
+.LASF2603:
+	.string	"gps.h"
+.LASF2629:
+	.string	"time_t.h"
+.LASF2620:
+	.string	"stddef.h"
+.LASF2661:
+	.string	"fp-fast.h"
+.LASF2623:
+	.string	"floatn.h"
+.LASF2665:
+	.string	"common.h"
+.LASF2643:
+	.string	"atomic_wide_counter.h"
+.LASF2618:
+	.string	"stubs.h"
+.LASF2671:
+	.string	"parameter_group.h"
+.LASF2678:
+	.string	"io_def_generated.h"
+.LASF2674:
+	.string	"utils.h"
+.LASF2634:
+	.string	"uintn-identity.h"
+.LASF2632:
+	.string	"endianness.h"
+.LASF2597:
+	.string	"stdint-uintn.h"
+.LASF2627:
+	.string	"clock_t.h"
+.LASF0:
+	.string	"./src/main/io/gps_ublox.c"
+.LASF2602:
+	.string	"adc.h"
+.LASF2617:
+	.string	"long-double.h"
+.LASF2616:
+	.string	"cdefs.h"
+.LASF2659:
+	.string	"flt-eval-method.h"
+.LASF2663:
+	.string	"mathcalls.h"
+.LASF2625:
+	.string	"typesizes.h"
+.LASF2667:
+	.string	"sanity_check.h"
+.LASF2652:
+	.string	"locale_t.h"
+.LASF2587:
+	.string	"src/main/target"
+.LASF2599:
+	.string	"axis.h"
+.LASF2582:
+	.string	"src/main/drivers"
+.LASF2636:
+	.string	"sigset_t.h"
+.LASF2601:
+	.string	"serial.h"
+.LASF2648:
+	.string	"stdlib-float.h"
+.LASF2682:
+	.string	"runtime_config.h"
+.LASF2610:
+	.string	"stdlib.h"
+.LASF2639:
+	.string	"struct_timespec.h"
+.LASF2669:
+	.string	"build_config.h"
+.LASF2638:
+	.string	"struct_timeval.h"
+.LASF2596:
+	.string	"stdint-intn.h"
+.LASF2646:
+	.string	"alloca.h"
+.LASF2653:
+	.string	"__locale_t.h"
+.LASF2595:
+	.string	"types.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF2644:
+	.string	"struct_mutex.h"
+.LASF2647:
+	.string	"stdlib-bsearch.h"
+.LASF2676:
+	.string	"io_types.h"
+.LASF2642:
+	.string	"pthreadtypes-arch.h"
+.LASF2585:
+	.string	"src/main/scheduler"
+.LASF2637:
+	.string	"__sigset_t.h"
+	.text
+	.section	.gnu.lto_.profile.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`m\007=\021"
+	.string	"\224\020a\b"
+	.string	"("
+	.string	"\331\275\274\342\001\366\001\002"
+	.string	"\002"
+	.string	"\002\001\002\001\002\002\002\003\004\005\002\003\006\002\003\002\005\002\005"
+	.string	"\007\007\005"
+	.string	""
+	.string	""
+	.string	""
+	.string	"\004\003\007"
+	.string	""
+	.string	"\005\b\002\t\005\001\240\342\234\212\n\002\004\005\006\007\t\n\013\f\257\315\357\331\007n\004\002\004\b\002\n\005\002\005\r\016\017\020\021\023\024\242\203\272\261\f\f\002\002\002\013\f\002\t\f\002\t\025\350\261\325\313\007\026\027\322\342\267\037\030\002\r\016\002\016"
+	.string	"\030\031\324\236\305\366\016\f\017\002\017\032\333\211\374'\f\033\247\216\345\227\017\026\020\002\t\002\021\002\022\b\002\023\034\231\363\243L\035\272\310\375\025\b\017\002\017\036\216\361\362\327\006\354\002\024\002\022\025\002\022\026\005\002\022\002\002\013\037 \343\326\300\276\003p\027\030\002\t\002\031\002\032\002\b\002\033\034\002\035\036"
+	.string	"\b\005!$\313\370\315\240\017%\364\200\230N"
+	.string	"&\257\336\213\322\005\n'\266\237\277\221\003\n(\357\375\377\340\f\004)*+,\240\342\234\212\n"
+	.string	"\200\237\250\021>1\t*\005\255s\220\002\032\"\2536\022@\343\031\024\353\210\302f\206\242\226\226\244T\2579\340\241\214K\002\215\273b\213Ft\003<s\322\223,\274\001\302\262B2_\210\271\303\250\3379+\202I&J\013\357\317/\260\207\207\242\275\r\360\022\032\355\200\334N\016G\022\332\325\335\243\223$\333\213{\337\201A\363\356;8\233)\026^\355\274\322[\034\242\0337\224J\317jB_\3601\251\223\351cB\343\244\365|.\331\207WJ\360rG\372\311\003\355\002K\240\340\310Hr^\310\f\007O\377*\r\366\371"
+	.string	"\253\347\023\212\022\237\361\363s\270\321\202i\034\fZ\320\215\350\264\216\216\325\017\024F3>:|\236#\215x\273\323\006`\021\025\315\261RJ\325\222\272\257\0216|C\343\326\2250\0162\346\2553D\214\243\273ho\361\250\254\375\034\020?w\237\215\260q\267\2660a\364\274k\325.\317\361\302\001\030\030\234\372\205\277O\342\372@,\203x\250\323\321\335<\334}\346\215"
+	.ascii	"\303\243\2526\241"
+	.text
+	.section	.gnu.lto_.ipa_sra.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375 \354\355\002"
+	.string	"\304\002\340"
+	.string	"\016"
+	.string	""
+	.string	"\003"
+	.string	"\f\001\003"
+	.string	""
+	.string	"\024"
+	.string	"\001\027"
+	.string	"\001"
+	.string	"\001\031\002\001"
+	.string	"\001\032\001"
+	.string	"\001\033\035\036\001 "
+	.string	""
+	.string	"%&\004\001'"
+	.string	"\001(\024"
+	.ascii	"C(\232\223\2001\204Y\002\302\b\211)\007&p\001\264*\216\271\023"
+	.ascii	"+\361\246r\006V\240,\362S\020\231\304\354\244\0223\300\340\350"
+	.ascii	"\r`\001"
+	.text
+	.section	.gnu.lto_.inline.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`\227\003\375\017"
+	.string	"&\024NE\360\350L:"
+	.string	"i\210l\331\221/\364+\357:\365h_\237{\256"
+	.string	"\202\035\373\270c\223~\334\372S\f\034\375/\223\327y\222\037\262\031\326\277\221\211\200&r\007\236+\233\372\262\206\313\322vad\222\277\344\220-e\n6"
+	.string	"?"
+	.string	":"
+	.string	"%/\201-\031\265\023\371\277"
+	.ascii	"vC,\031\365\360kb\325\017\306\372\203\223&\272\377\311\312g\017"
+	.ascii	"\356n\225\370\233j+\347G\2535\374/\b\303\264\202\263\365\375"
+	.ascii	"\237\207\253:\215\023\373l<"
+	.string	"]\371\206\335%1\216\006'c\t\275\034KE\b\277\254,\030@q\006\017?\034\205\357\2743b\224WJ\305\007\035\304\301,\0037\036_\364\216s,U\001\001\316\231E \376\017\242\255i\232:p\201\240\222\013w4\231\233\025\367>\361\261\351n\317%jD\r\035\342\243\2221\335=\376a\334\022\210_\353n\362\0167\321\377&Z\377/\204-\376'\236\331x\001OP\222\022#\317\234\202 \371\f\256u\216\361\223\036\256\211]\300\330m\224\271\2008!\336\215\320}~~1\322\335\251\277T\025nq\023%19\220\362I\360\245[\006\260\002\r&l\313\003T\250q\245cd\314\266\240\250R,\006\200\"\232\242\252\003\022\340\003M\003d\006A\203\020\242\211f(,\357r9\257\200\300Y\215\023\216\263\204\270\330\024\030\235\220\n6\213\334M\240\275Q\326(\304\257\313\310r\002\227\363\002\f\224\343\250-\203-\002X"
+	.string	"\223\026\275U.\336\036EF\374\003\035w\270\001\251\224hnx\336t\314\342\337H'\233\205N*)\003\\K)\222k\033\316\362\317\034K\020Q\007F}\002j\3147\350Mum.\270\342lu#N\356o$"
+	.ascii	"\336\255\3140\"\316w(\025\223_\036\020\262\246\005\317 q\201"
+	.ascii	"\343\032]e}q\326\307(Z\032j\272>\345I\365\361\237\310-\351s\242"
+	.ascii	"\342\025&"
+	.text
+	.section	.gnu.lto_.jmpfuncs.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`\234\002\245\n"
+	.string	"\342N./`k\222\016\260\001\b\026\r&\326:\240\243\355_\242.\b\002,\024%\270\3740 \035\206\201\007\320\201\370>\026%\333u\252\341o\244\021\262\223\fm\333\262V!:\214\242\303\363_%\244Q\002\341\341<\234Hf\346\212A\033hs\260\226b\370 \033\237\252\246\2323\231\233\343UK\235\324\031'\326\235\244\255A\333\202.\020L\016#\177\003\312\341\001r=\326\re\376\3453.\005V`\245\224\264Z\201s\2746\240\223\303\364"
+	.ascii	"\230S\373\216\217J\304l\255\361}&[\235\255;e\256Z\017\037-\326"
+	.ascii	"\335\206SM\262j\267\305\213-\210QJ\213\026\274 \246\224\237t"
+	.ascii	"m\243&\210F\250\201\265U$\023\226\232\332\016p\002\021dT\036"
+	.ascii	"\021\2008\206\020#\312\224\r-*\326\232\003&\262J\345\370\234"
+	.ascii	"\277\275\315\234\364x\273\314u\f\241\277\376\253\006pD\367\006"
+	.ascii	"\204\353\026\271\201\252l\005\356\360I \370\322\001\027Y>\026"
+	.ascii	"o\301?>G\317 \377\225\037H\356\325Y\360$\221|\236%R%G\274\235"
+	.ascii	"\377tH'o\345\335\247\315\261\227b3(\364\254.\247\203\276{0\333"
+	.ascii	"\033\26480\246\217\335\266X\bg\225\356\326u5q i\213\034\036\316"
+	.ascii	"\246\243\321\325\342\240"
+	.text
+	.section	.gnu.lto_.pureconst.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375 /y\001"
+	.string	"+"
+	.string	""
+	.string	""
+	.string	"\016"
+	.ascii	"\230\004\f\230\004\024\270\004\027\231\004\031\232\004\032\230"
+	.ascii	"\004\033\231\004\035\232\004\036\231\004 \271\004%\230\004&\232"
+	.ascii	"\004'\230\004(\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`b"
+	.string	"5\005"
+	.string	"RG\026\037\200M\206\00330\00330\003\310\220\215\002"
+	.ascii	"\200@@\023O\247+\224\337<\202\214\275\223L\001\352\026\272B\325"
+	.ascii	"\363\350\036\202\234M\264\022\"|e\236\230\335\345i\331Uv\224"
+	.ascii	"\227\034\325\203\272\311N\242\f\205E\236\220]`\302\343\r\024"
+	.ascii	"L\317i\216\247\264k<\031\037\001\234&! \200\002\":\353\243\025"
+	.ascii	"\273vjB \200\\V3\342\313~Bg/W\020\231\264\002\2612\350\376\357"
+	.ascii	"\027\326\337\257[\236<:4\344J\r1\347\274\320\272\305\207\201"
+	.ascii	"wl\\2\373v6\367\027\201\003O\240\225x\025\213\013>\004"
+	.text
+	.section	.gnu.lto_.lto.516425ac3a7cf03,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_ubloxScanMode1.41.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375 eu\002"
+	.string	"t\003X"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\005\001\006(\001\025\001\005\200\003\004\204\b\003\204\300\023\002\321\020?\202\210\2000\1773\273\0014\303\001\302\001\301\001\300\001\277\001\276\001\275\001\274\001\273\001"
+	.string	"\t"
+	.ascii	"@\004\270\001\355\306\024\b\206\301\274\366\322.e=\f\300\001"
+	.text
+	.section	.gnu.lto_baudInitDataNMEA.42.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`{"
+	.string	"\305\007"
+	.string	"\304\f\230"
+	.string	""
+	.string	""
+	.string	"\327"
+	.string	"\005\001'\002\206\b\177\005\001\212\001\206\200\200\374\314\320\301\232\002}\273\001"
+	.string	"\005\001\006\025\001\004\005\001'K\206\b{\270\317Qy\276\003\005\001'n\330\316\001y\301\002\005\001'\221\001\230\316\001y\304'\264\001\206\bw\330\315\001u\306\001"
+	.string	"?\202\210\200(s3\307\0014\305\001\303\001\302\001\300\001\277\001\275\001\274\001"
+	.string	"!$PUBX,41,1,00031,9600,0*16\r\n"
+	.string	"\013/root/repo"
+	.string	"\032./src/main/io/gps_ublox.c"
+	.string	"\"19223\r\n3846576D\r\n"
+	.string	"#1151E\r\n"
+	.string	"\021"
+	.ascii	"m\030\006\370\032\f\003\326\005\3030ZI\023\3020&<\004\224\205"
+	.ascii	"P\310\002\254\326j\027\2205\330\332g\326\r*\277\001\024\001"
+	.text
+	.section	.gnu.lto__update_checksum.63.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`S\002\345\022"
+	.string	"VbyH\320\322(\035\234P\306)Y\302q\274#\r\004W]\327\217RK\211\256\016\224\215U\325\fuX\034\222\022\330-\177>.U\357\002\3704R\374\020\036\342S\345\254\030hQ\213a\306\001\2731p\265\267\036l\304\222\275\245L)b"
+	.string	"c"
+	.string	"c"
+	.string	"SG\006\321\234\241\002'\370.\035\236\304\273\374^\300\273\264\314Fz\3103?\303\006\207\\\2209'\270%\374\335cxG\225]\306U\231\257FC\265\333\314e<\325\334\234\bp\253\211+\245\244\242\347\256\266\033Mc\n\234\357s\217+n\340\250\335p\256'\2239\247\265v\003q{\267\355b\233\202\255\035\002\277\200\003\375"
+	.string	"P\017\177\221\343\376\220\207\367\351\270\333\213j\031\3251\2527\2525\252O\240\204(\207\005\335\2347;\246y$\213P\330\217!\263G\354U\210\234\220\214\201\001\223&\210\304\204\357r\345!\b\210IB\223j\3650\314\300\201\354a\314;g\216Q\204\357\362\201\017\325\365/\374\237\273\220\035'\363\324\f\377 \242\307S]\362iMfq\3169cj\217;\202\231.y\301\275M\355{\330\250\240\375\310\223\270\273\362$\366\305\222\026\273\250\035\257\375\320\375\356\276\311&\207\006\323\325\032\376PJ\3543\341\313x\227\337\333F\314tg\224\216\305\016\351jnk\325\365\350\230\272d\2073\272;\366W<JI^\035;u\241(,\026Wl\261X\\\321E\245e}\241\265\202\320\300\205\222\242\"i\305\264R\242]\252\r\257\026\024\r,\230\027\f\340k\005tYie"
+	.ascii	"]0\030Pu\300\257\027\025\030\030\363z\301\300\221p~u*\3208\232"
+	.ascii	"-M\356\216\233|p\213\022\331\323\332\236\373\007\304\007iS\353"
+	.ascii	"\250!\353\255\315\260 \0364\252d\324>\374\3561\357\264\250\347"
+	.ascii	"\0364 \200\002\221\203\305\r-\255\310\321\224s\337\033\344\232"
+	.ascii	"fLS\313\346Df\227\3157\212\271\214e\203\356\232\262\3620\213"
+	.ascii	"\221e\262\346\327-\214\201@\247\003x\002\332\345\3640}\301\371"
+	.ascii	"\303\343\036\206\345\303\f\315\271w\312N\205\240\026\314\025"
+	.ascii	"tq\325l3e\266w\032\245\025\3413g\252p\312,h\310s\007\207\020"
+	.ascii	"\343\331\313\275\204,\004\023\224\337\f\246l\272\336\023"
+	.text
+	.section	.gnu.lto_sendConfigMessageUBLOX.65.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`\030\b\215)"
+	.string	"\372Fh\017C`\250M:{\204.\020\023Zuo`\230\020\021E\332\212\372\271\036<S\345\367o\245\230\264\304\r\033\206O\347'\330\361\376\342\205h\347\275\331\267xB\332R\303\362$\026\036\365*Jo\341\220F\b\3312\311\341"
+	.string	"\323"
+	.string	"\343"
+	.ascii	"\367\352\320\214G\320\214(\227\263\243\024\220\263#\234Y\231"
+	.ascii	"\312\333Z\257\227\022\312\354\233q\204\250\254\227\251_\257\327"
+	.ascii	"\215$\230\265N\206e^%\353\375\272P\307\215\021\256\202 (\333"
+	.ascii	"G\362\307\234L\326\311\260\220\326\373u\"s\314\214p\367\256O"
+	.ascii	"?\031\304z\003\350\317\364\004\320\237|1Y\314\272\237\177\230"
+	.ascii	"\217\261\256B\224\243\312\263\367"
+	.string	"\2021I\323!\375Y!\013T\204(\255\033\325\364^\311\235\021S\276\335\273:\370\311\r\322\237\254\305\f\350k\330\315\211\305\r\221p\367\336\236\225\302_\336\\\317fk\3754mk\361\307\336H\320\204ng\305\255\237f\316\207W\025\001E\037\246T\242\2675O{w\025\205mb1r\373\264+\330\362\207\214\333Y\321\310;\247\341\336\313M,~\235\3213\263\016f6\301\234~\b,~\247\305\313\354\370NV\347\227\201\316\355\313\366\034\341\024\271\215\352q\340\274q\263\334r\025e\256\372\232\212 \311l\3656\276%\216q6\277\002a\367^\nj\276f\006\237\312O\256\001\354\023\201\350\317\007\311B\301^r\263)\257\306\302I\360*\372\34318\tv\0347[\\\333\3558\346U\330\026\n\363\245\302\022\275\261}\302\254\340\307?\201\023\257\351fg\246%\264Y\tm\336\241\315IG\236\221\320\346\001\271f\001fs"
+	.string	"\263\371\350l\326\231\315"
+	.ascii	"\314f\243\2639\275\361\2343\233Q\263\371\374\361l\242\315\026"
+	.ascii	"m\356\263\371\013vW\356P\271\335\353\265Tt\355\234k\254\034\371"
+	.ascii	"\233\375\306\377x\223\371|1Oc\326q\326W~\231\233\371\231\243"
+	.ascii	"IA\346\345\006G\241\346\"z\013\236\026\n\317\031\252Y%\021N}"
+	.ascii	"\344\f\325\306\376AL9T\353\253\235\227*\301\034m\223\265L\266"
+	.ascii	"\353i\377 Fg\250f\227,\233\375\365o\201jL\205\320\342\004\314"
+	.ascii	"\210d\273\230\231\311^\221\341\323\243\023q\023/\270\274\212"
+	.ascii	"2\331\246\017I\322\005"
+	.string	"\311\036\311do\366\356\033\315{\3575\227\354\221\020\216d\227\354\377pi\t\243dot\262;\253\004fg\177<\217g\223\354\316^\311\005&\274\037\022*\237\n\037\013\375\231d{\255k\311\021\333\027[\306\346\243h-\224\264\003`\353\322v\321|\n\f\021D\204n\030\264\367\030VJ\374\331\273\343\330Z\r\301\365I\254N\336\033<\021\317\335\324\007R*\256g\212A\236>\257\241?\217\274\316\274\212\266\265\366\\`\302^\362m\333$C\303E\314\0016|4l\225\216\252\027f\025\214*)\013\022\254\\\274\2002\340\202j\206\225\311VP<\2004\\\354\240\312q#F\017\370\353\331\370U\325\350Y]\345\350A\355\030x\303w\325\323\001\004^\365tk\360\246\223\315\331.6M\2365W`\261\023\264\302N\262\241@X\241&\003,\337O\037\341\200\325\206\210\203<t\0215*\254\277|O\311.\376\030$\233\310"
+	.string	"\0335\205\311R\007\260_{\b\210TE\013\231\232\220\f\302,bD\237\310<.\273\305\314%\032\b\216\264\207\375\303\304\t\024}\"\n\364\247"
+	.string	"ktL\217l"
+	.string	"\373\244\263G\335\243\305\327Z\350{Z\007\177/\323[:\373\265$9\031_.R\346\214,\200\324\032\331'j1\001\221\357\t\356\307\340Pj'\034i\273\226\231\257nH=Ph\252"
+	.string	"\241\\\036\342 \364\264\250\315!O\213\242\031.\332}\265]\2643\036\013\200\257\250a4\346\030chdFA\n\322\024Z\003\260\002\221\241\252y\021 \255d\f\215ML\255\001\276\206Z[C\330\2159\030\034\315\226\364E=\323\261\266e[\353\370\261\027\341\246Z\345mq\017]\203\334\360\271\304\020\362\2160\266\261\342\007\275\365\202"
+	.ascii	"6\036\306o\261\344{\241\202\032\tSr\002\237\t$Jlb\007)a\365["
+	.ascii	"-q\202\336\204\021\312\031l'wj<\030\022\246&\234\363\247\t]\026"
+	.ascii	"Z\t\370B\001\240\256H\247\214h\320\355N0\262\007O\334\367\303"
+	.ascii	":z^\017\324\303\277\364\353x^\321\256Q\3214k.\311\221n\222`S"
+	.ascii	"\336y%\376d\271\022~\203\332\206\211&\277\203\363\227\002\032"
+	.ascii	"E\374e\025\3214\206\332\006\336\372oS\211\2025\"U\021\365-\230"
+	.ascii	"\367\002\365^E.\220\223?\335Y{'\334\300u+\377\223\274\226c\225"
+	.ascii	"\227\024\233\226T\320\210d\325\245\361\033\333\344\004\346Kb"
+	.ascii	"\327\205\361\2477/\226\310V\357\240\022\222\rT=\322\247\355\275"
+	.ascii	"Pj\314\312\177h\033\006\321\214\335\357\3230\207\223\341\215"
+	.ascii	"\363:\373i\201dB=\250pr\021B\356\3408\222z\231o\344^\"\351\""
+	.ascii	"\013\206\312\023\210ZdL[i\241\272\322\007\b\370\352\350\037"
+	.text
+	.section	.gnu.lto_configureGalileo.69.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`-\001\315\013"
+	.string	"F\224KC \307*\035"
+	.string	"\213\"@\002\203\317d"
+	.string	"\367.~\236\344mN\004\237z\321\nLZ.\b,\225\001\033\375\325]\327\233.+\007#\261\350\352\241"
+	.string	"\003\020\224b~rT\202\203P\347\r\334|B\b!{\247\0246"
+	.string	"9"
+	.string	"="
+	.string	"\013N\273\335\217]\204\315}\tLl_\343\227\335\340gm\303\022\003\036\270\007\273;V\222\277N_\376o\317\2303\330iH\261\273\246\346,\344\256\267\375`\273d_$F\035\246t\320\331\031?W\rf\375ec\241\266\273\022-w\351\360m\377\334r\321\233\377|\027\370/\242\346 Fw\246\nN\030,\205`\2370ZG\354{[iv\310a\t[i\241[.VeV\240v\250\202\336tGVa\346\254\210(\204\307?p\004#\337\346\026\t|\t\374\227\001Q\001\235\004m\323\013\220\004\006\bH\231\270x"
+	.string	""
+	.ascii	"\270\030\217\016\005|\t:\277\357\004\021\254\376D{\337\210U\364"
+	.ascii	"\350\357\377\2767\242\303\216\r2\351\303Q\236,X\242U\3124\226"
+	.ascii	"\344\210A\216P#I\265\032?\f.S%\325\250Q\226\252Qs\356\275  \340"
+	.ascii	"\002)\013\234\007\2201qDAl\354]\252^\013\207\253;wa\344H\006"
+	.ascii	"d\037 mq\024\032\202\357\3018d=\302^\207!\217\363\301\242\262"
+	.ascii	"\261\023\027$\365\301\204\310\307\032\212a\"\031\002\376\031"
+	.ascii	"\002\226n\321\216'"
+	.text
+	.section	.gnu.lto_configureNAV5.70.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`>\002\005\020"
+	.string	"\266\232cH\340\262(\035 \203\024YX&\003\277\266a\254Vk\313\362\235'\022\303x\234\377A\276#?\007\365n\214\327^[\026Q\031\370Us\367\356\343\024\004A\2179\352\321\205\377\224Y\276\260b\211/\024\b)x\322\270\307\226)\005I"
+	.string	"N"
+	.string	"T"
+	.string	"\266?\262M\243M\016\b\337\247\251\007\211\252M\302`\366\032\231\345n\210\034\235\335\333\210\023|\237\236\331:~\263m\250\204n\303\315\217\335\r\345\210\317\2563\377'.\252\311\320\256\241\007\273k\255\311x\270\345m#\260\315b\353\2072\317\316\360\033\231\001 [\345+\304\002\326p\025\260"
+	.string	"\266\3355\241x\212\026\237\346\323.1}\355\323\217y\237#6\0370:Zs3~V\201\3307\232J\021\366CV\316\330\267\371\277\327\374\336Hd\207\217\213\305.\2071\310\356\246\f\023\001\366\004\n\372\232\017\304H\2325\247\373\244\355\322q\374\370\234v\272\036i\343=2\260\304\256\360\033\026H\027\236;\361\354\350\215#\001B\204\007\203J"
+	.string	"}\032\307\231\3704vAyOy\237\242\016;,\317^=\006K\007\306\213\032\244\326s\\\264\300\001\201p\336\003\266m\033\307\201\257\300*\0079\310\323\006\001H9\216\244\227\026J\310(\250\222\006\013R'\252\222\200\224\225J\214\340\212\251>\247J/b\312I\213\tl\205\025\212\255\320\325B\251\204\251\027,,\021\260\270\262z\205,\242\370\nG\267\275\2349\361\330\301\310\030\017\3203 \360\002\221\222\242\007\356\261\264\021\232`P\221085`\004iFvr\003x\213\211\305\367@\034{\310\031L\r\214Oe\207\2752\036\221\204\250\242H\034\373!\234\013\t\343\rY\030\262\262H_>\330\034m\3628\007\243J\271\3570\356\301x\210\250\304;vEh7\354(\371X\r\3059Q\235\006\222\030O\021:n"
+	.ascii	"\233\007:\267h\317\023"
+	.text
+	.section	.gnu.lto_configureRATE.72.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`(\002]\016"
+	.string	"\326\027[F\340\326(\035\024\2018B\213\005\021Q[1\002IR\321\230rR\220$0\362\222\317\027N\220S<\220\306lC\322\036\324^\365\304\366\323 #\222\215\302\025\303\021q\350\373\212\230\211\243\030\210\323\b`\255}[\357\235RA"
+	.string	"C"
+	.string	"P"
+	.ascii	")\343UD\327]\026>ZvK\220!t^\007\374\263\275\316\023\330^=\332"
+	.ascii	"L^\316\226\203\242\342\004K\223\335\345\250\213\217\237\243\377"
+	.ascii	"\225\007 c\256O\216\205\335\365$c)nz\333\fl_\260\247\214\"\033"
+	.ascii	"\277\301\362c\274\272Dk\236|\365[\333+hf\363\2327\236\264\031"
+	.ascii	"5;\235\330\245k\322\026\366\001\354\356\232\312\354\253\374U"
+	.ascii	"@\002\030\232\226\314.\212\233';S\203\240\330\276\307\026\301"
+	.ascii	"\2200\247\375\032\017\336\360%J\222\324\320\b9\207\323\220\034"
+	.ascii	"1R$B\315\306\245R\273\303\211\210\016<<f\324\240;\214\3672\004"
+	.ascii	"\364b\305\212\270\331\337]\304\026 ?R:\245\367\340\261C\307\203"
+	.ascii	"\032\215\355\247\3156\235\345\244\240f\243\236\003D`\022\307"
+	.ascii	"\021\026\230\355n\016\321Q\2500\301#\201\b}\276U\207!\354>T\307"
+	.ascii	"^\310\004(\202\304\032\205\251\022\007\232\270\021\246\016\305"
+	.ascii	"y\252\220\013\0350\230\372T\334\n\004U\234\247\334S\231?\304"
+	.ascii	"\314\274(\314\006\246\235A\303<\351\0050\352\362\244\275\310"
+	.ascii	"\334\001/ @\003\021\022\347\2213(1\340\031i\206T\030\336\261"
+	.ascii	"\006s\210\343\036,\330R\265\200'\215\345\204k\310\343\034\354"
+	.ascii	"\020\345\034o\267\035rz_#\334=\230t\207\305gf\033{\310q+#\302"
+	.ascii	"\035\343\036\314\207\210J$\307\256\nm\r;F>\026C\211\331\320\326"
+	.ascii	"h4\324\345E;\310"
+	.text
+	.section	.gnu.lto_configureSBAS.73.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`\211\003m\023"
+	.string	"\346\340xI\260TN:.\207\034b%\264A\217\375\257\226\203\313\322^\207\377\351J\272\025I\351\030\345Z\216!\207\344w5;r\254mg0\340\323}\344\025_\224\316\241\363\022\017\371K\376,\342Nds\371Jk\240\007m#do\231R]"
+	.string	"c"
+	.string	"k"
+	.ascii	"tM\347z\356z\277>\200\023\234\336\007\242ZE\374\216T%\320\310"
+	.ascii	"\307\366KL\332O\347\355\324\226\217O\210\241\252Z\2538U\234<"
+	.ascii	"\235K\372\255\225Z\353\177NR\356p\2478\237T\301\211#\034\223"
+	.ascii	"\235\r\025\320K\341\364\237\357\315N\267\333Z\251\265z\313\335"
+	.ascii	"\210\033\274\355\026\333\tlj\022\024nT\343:\216\027U\260\020"
+	.ascii	"\333\227\261\360\340'\214'\310\312uYh\303\334\206\254\006\215"
+	.ascii	"\031T\003bN$c(\006\212o*\374-\264e\376\342v\342\263g\347a(\340"
+	.ascii	"\231\013\215\001vj\2550\240\007m\360{\016\272f\333\227\007}["
+	.ascii	"x0eG*\267?/R\324R],\233\207\333"
+	.string	"\251c\237\326\231c\007\341K\226\360\340\234*<FI;3x\221'\"NC\304\337\231n7x\223/\210\013\220\037\257\254\331\362\245\236R\022R\212O\n\213N\333\301\217n\b\036\334\007\204\003\021\336\303\205\307\016\022\023\271\375Q:uv\213\246z(\346\314\001\377\022\356\\!0\232t{e[\302u\274\270j\325\301\374\034 &\270zj\302\203;Ux\202\354\226\275:\214\031.\330b5\032\031q\234\211\032f03\242\214V\023_\004<\322\304\320D\016\343H\023Kx\3653\307;\317\364m\242\272\261\373[H\347M\254\204Rn\332\030emr\005\311b_\332\200\315\304y\223HL\233l\361+\322\205U\025\225\0210\253\204\312\355\317\303\245\310\037W\255\272\005>\324\243H J\n\261\004I\250\021\340\2212\310\020\225\244\214\024\244\360 \003\021\221\241\007\021\2404\207\0202\312<\367\r\204Ay#;\275\227w"
+	.string	",\240\220J\222.!\370e\204\271'P\025\032"
+	.string	"\201\232Nm-\227\020!\242\310\250\351\252ae\335\214\221[\303\024\353Y\2534<\224\334^\307n(/S\255\017\311\r\302?\033/\352\270\305\373/:\300\035\361\241\202\264\026Q/\357\322\353]\345\211\n\211U\177\273"
+	.ascii	"\r\204\357\247\220\223\352\224\220U\001"
+	.text
+	.section	.gnu.lto_gpsParceFrameUBLOX.74.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`\237,\275\216"
+	.string	"*\327\0240K \222\322\3519\303\035\277\353\210K\230O\345#\243\024\262:.\310,\272\235{\206$r<f\365\357Q\224\227\371\353\375\026\314\205033\b\300\256\200\211\231\021\021\021\021\001u\327\367\341.\372\f<\t\307\2438\324\211*\331[\246\224R\273\002\323\002\n\003=Rg\021Rg\036\251s\b\354\f\002\216\363\007\252\263\324;{\220:w0t\346\340\2357xg\rR\347\035\251s\006\2513\006\251\363\005\251\263\005C\347\nRg\n\206\316\023\250\316\022\f\235#\030:C\240:?\240:;0tn@uf@u^ uV\200\350\234\300;G\2753\002D\347\003\336\031\352\235\r :\027\360\316\004\274\263\016\242\363"
+	.string	"\357,\300;\347 :\343x\347\033\357\374\364\316N\357\334\364\3166\336\271\306\215s"
+	.ascii	"\354\f@\352\\L\235\231\206\316K\357\254\364\3164R\347\031\251"
+	.ascii	"sR\352\214\224:\037\245\316FCg\031\251s\021\3219\306;\303 :\023"
+	.ascii	"\275\363\020\321Y\350\235_\020\235\203\336\031\350\235]\020\235"
+	.ascii	"[\250\316,\206\316+T\347\237\241\263O\352\334\303\316*R\347\024"
+	.ascii	"\2513\nv>\221:\233H\235yn\234wR\347\022Cg\035\3259Gu\306\031"
+	.ascii	":\023U\347\033\325y\370\316\352;\247\357|\337\371S\347\356\037"
+	.ascii	"\332\356\210$aev_\206\331j\025\016\266z)\020eu?4\226\034nfsq"
+	.ascii	"-\227\303\215\267\372\312\f\275\306\315\354\267!\027\334\230"
+	.ascii	"$km\333\346Xi\032\361\2544\215_\032`\246\3526v\250\212\331j\341"
+	.ascii	"\030\324\243\321\351\r-5\336\333\215k8\315\320ml3[\255\306A\314"
+	.ascii	"\226\265\245N9\351\246Sn\266\031\230s:}f*\346\034\256\341D\305"
+	.ascii	"l3\223ZC\255\272#\\\233\266e\026\277I\263McF\022\322\221\221"
+	.ascii	"\214\242\0300\210\206\204^\004\001\271h\301b\305\217O\217\212"
+	.ascii	"\024(N\230\340\331)\241\223\203C\274\031\252\351}g\271\253\232"
+	.ascii	"\306\320\3715\210\3273v\270\256\206\360\244+0\216t\244\305\215"
+	.ascii	"\262\270\214\242/u\036\003\213\303\030B\021\321\365\020\235\013"
+	.ascii	"\315\335!)[n\376\342\332\020\322&L'\211\343\230\226\262\325\346"
+	.ascii	"A\013\350\240\365e-\020\310\305Z\267PKs\026\313^\261D\363\237"
+	.ascii	"\262+K\367\351\031B\251\200\"e\353\211\247x\"\314\265%\212\302"
+	.ascii	"4k\201'\224mB\231t\236\023K\212\214\365\316X\022/!67\346:D9w"
+	.ascii	"ho\353\013\230\343T \246\315W\023o\215\032\300 {o\353\353\226"
+	.ascii	"\370\333\001\257\245ly\371\315\235\221\204\b\034zo\253\353\366"
+	.ascii	"\024\241\303\021]\327DR\266\276|8\204\272R\b\267\254\005.)\362"
+	.ascii	"\245\325\034:\335\341\032r\207\332\266m\265\366,.!~\035\257\337"
+	.ascii	"\t\017=\204\261\035\203\374\320K\266\354T\365\314\313\016\207"
+	.ascii	"\353\n\307\207Pm\333\262cq\025iVj\346\357\200\2313`N\342\013"
+	.ascii	"r(\276\343T|\303\261\275\212\024\337lF\234i\274\341\306z\265"
+	.ascii	"\245\370\033G|\315\330}H\\\215\365j2i(\276\373\376\212h\317S"
+	.ascii	"\243\363H\245Z\305\207\027\31157\200Q\275@\277\234Gr+a#$zY\263"
+	.ascii	"\340v\303M]?\220\325w\3242\3546\252\255\366Yd\335j\337\302\033"
+	.ascii	"T'\017oO\355\317<\212\3457\324tD2Qf`\032+\027\304\321\361\222"
+	.ascii	"7t\262fF|\244\233u\247-\323~\351^\302\020\2211\333\272y"
+	.string	"$7\2536\332\373\350&h\357w\307.o\243\312\363\335\344\357\335\021\210\253\272\336\301\306\f\364k\2614Q\t\033Y\340\037\317\367\017\355.\310'\276\351\232\241\254\220\177\342[\255S\330\035\t\205h\023\337\310g?v]\201y\017\306'(\254\222\342\023\023\377\004m\263\022s\036\214]f\314\225\254\222\036\223\364$\317w\031h\033\030\274\366</zU\036\035\002\211\222\005\372\271X\263#}\007V\007\026\351\215\305\"\325N\177\236k\272\250;M\\\007V\331\263\244K\374\316?\231#\341N\036\027\026u|g\251Q-\361-\274\031\021\304\223\3601\326\311T\211\017\202v\2715\2532\263P<\214\365y\262e\016\306F\371\022z\256a\3239\363.$9:^C\343|\016K\305q\210zr#<\230\274\b\316?\251\021\253\370\026\273\344yj9\031\030~\363\314,\033\353\346\215E\374\241 _\3058\035\245\016\377\346\375"
+	.string	"\317\212z\302\342\301Dd\370OK\365\231\025\360\243\017q!8\315wj\372\352\253\200C\322\256\030p+\257\3626\255r\237\331\201&\214\016B\320I\004\266\271T\376\231%h$\244z\236\0244\240\005<\177\275\006\203\035\033l"
+	.string	"\207\345\307\334A\253\221RJ2\203\320ix\024=\333\266}:\323hzp?\351\224\177"
+	.ascii	"\001\242v\372\257\244l\323\311;\333\353/\335j\235\006\246i\223"
+	.ascii	"\246\312\2436\274\352\370\356#\2674CUy\224\273?J\020\204\203"
+	.ascii	"o\206\373\b\"\"sOn(\2126d\270\371\206Y\314=n\247Z\310\314\343"
+	.ascii	"\326\273-\344\265\364\210\340\016\363\204_\326\320Z20\334C\370"
+	.ascii	"M\005\355`\2335\264\266\025\202\333K\333\320\205;\b>s\323Aj\247"
+	.ascii	"\335d\355\331\227YK\326&5\027f>\323u\203I\302\332\266\252\223"
+	.ascii	"\234q\2546\351\266`N\310"
+	.string	"\334YZ\213\221\373\t\2270\345\2155\245v\332O\354\262\362Bn\265\336\021\250\027\350\327\272 3\363\312\037\311\334_XX\250\206\237\t3\335\234\\\034\334\2257+M\246[\033\333\232Z\332\022\215\235\273\t\222\235Kxg\022\330\031\b;\217\220:\377H\235}\244\316\001l\325\rP\177\300?\031\003\036\352\3250Pn\rRJYk\323\350y\261\fp\032)\340\322p\217w\b\001_\200\216'\240\354\006\271W\327J\207\223k\200\245\333\026\022\n\360\003\344x\001>\215\016I\213\362\203RFO\301\265Y\364I\344x#h!\216o\363lV6<H\334x\034\377vG\302\247\277\361*\334\331\257\371\363{\212:}\232G\363g\374\252\233\336\351\3250C\322\256\250\374\021f\214h\022\264\361\3172|U~\214s\317F`\215\327\373<\013^\314\362\211\2202z\342\255\315\242\347\0205\336\b\332\306&\200\377/\254\322K"
+	.string	"\377pGB@\272\277\263\342\326aqHX\254\230\223\233\223\373\211\203{"
+	.ascii	"\276\343\230\276\341\256\2741}[\001\340\333\355\312\003P\374"
+	.ascii	"\276\242\366]\214NI \326f1\311\245\370N\3126\266\327b\3541n\237"
+	.ascii	"em\266\030;\246\3571\320\2771\215\264\247\306\307\f\313\017t"
+	.ascii	"x=o/\307\002\305\261Q\340\214\222k\274,\301\375\233\225\265\210"
+	.ascii	"\236o*\375\322_\270#!\001A\2304^\351\325\350\220\264+\271o\223"
+	.ascii	"jz\262\255P\245\347\032\215o\202v\231A\367iK4,\357\003\225)3"
+	.ascii	"\270$\331\275\224(f\327N\313\367`t\202\262B\227\236$\275\223"
+	.ascii	"\033\022\227\347A\231\214v\371\035\214M\310\025\252\304\004\351"
+	.ascii	"\233\330\216\356~\211\022\262>/\237\304X\024[\241GaG_T3\002\363"
+	.ascii	"_F\257\256(\336\347`lJ\036Y\241JI\034\214\276I\271\224\021\346"
+	.ascii	"\213\260K\240\344\232\367\\k\021=[\017\270:\377\006vY|\332\260"
+	.ascii	"B\217\276\006\031_\204\266=\367\252\234\230\022&\204\212G\366"
+	.ascii	"\333\373\275A\211\350\242\357\267\225\314c\031\205\3262Od\205"
+	.ascii	"\376$\237\206\242\027\242bD#"
+	.string	"\355\235\245\2103\322\376\020v5\303\"}\306\372>\310_\275Ur\215\330\036\257h\276-d\243\020\026=\327\200\305\370@\037\024L\002\306\307P\343l\220"
+	.ascii	"\204\341E\264\344\177~j\206\236\350\317\321\234\351\033\372%"
+	.ascii	"%\022\241gf%7\303V\375$\333\266\305\301\274\002\272\021+\033"
+	.ascii	"\036\350\213\027\372\277;\022Z\005z\031\251\245$\037"
+	.string	"{\224\361$\363\342\227\224G\202\004\335\311V\355}\037\226\037\320\007\375g\331r\361@\277\242oH\332\325\032\365<)\035O1\354\321)\031\306\305\353\200\032i\361\314k\241\343\261U<C\260\370\026W\376%\212))\304\275\260G\243\247\020,\236I\331f\265\307U\246=\257P\257\312\243(\362\242+\210x\020]\372~\262V\370\374\317{\364Hhe\203oa\227:\222ZX\257\3423\213\317\353P\n\366hy\235\221\007\013\227\323\031\225\346X\257\"\271\236W\202\266\005\236x$Z\303])43\261SbN\307\247t[\261\002h\305J\034\\\341\026\317N\223\331\214\302,\341\326\366*\276\335\312\032\305w\333\\@V\220!\203\030\246\026\320a\022z\340\310a\343\207\217\021\230zF\230:\241\207\0061L\221p\303?\230bP\341\004\0370\360pa\205\022\212*L\025S\230\352\201B\361G\013.\024\231Z\260\n+"
+	.string	"i\241\370\202\n*\264P\314aZ\365m\237\t\333(\223\223\233\341b7\203gI9-\357f]\002\227\360\376W\314P\227\006\2254f\351\232\233\245\205\341,N\252\204\314"
+	.string	"\362Qh@\376\007\332\325|g^vI#\3700\302\353@\273\342\250l\251\343;\003C*\233\262<\372\361>\244\3740+\353\301\207Q\217'=\252"
+	.string	"\321H|Td<rJ\363"
+	.ascii	"\3047v3\304\rN\212Dx\036\357H$\241S\"|_\201\232Iw0\026\220d\252"
+	.ascii	"\276\024I\205F\007\023\036_\200\262-\306#9\204%F5S!<\020\264"
+	.ascii	"\213O\354\256\221\370\300`<\222}\210F\363|\t)5\t\237\305\f\302"
+	.ascii	"\223Q\375\261H\022\036\204o\225\350\221w\317\f\221\241g\322&"
+	.ascii	"\250\037\244^\251\230\t}G\005\230\206Q\261\351\272$\330\232\325"
+	.ascii	"q\311/b\247\037|\337)\201\260\362\302N\221\204\341\t=\222o\232"
+	.ascii	"\302\216R\245\376\371\336\304\004\361$\216H\005\2469D\371\244"
+	.ascii	"8\244G\250\004\251\242T\205\336XT\205j\247\027\016\313\317\203"
+	.ascii	"\227\372>\022\262\336ki\221\365JF\262m\255\032\213y\025\222r"
+	.ascii	"\255\307'\"\351\326\232\325\224j\361j\303\252\345\215\345\301"
+	.ascii	"\367\021\262~\362\031\301\351a\351\303\213G2N\033\325\016\322"
+	.ascii	",#\327T\007\357\243\354r\n\212i$g`\320\230YJD'n,=\376\374\001"
+	.ascii	"\245B\322 \351\225"
+	.string	"3\214\213\264*mo\241\023\f\0077z\007\257\340\006\317\301\273\265\006\277\201\221\033(\305\364l\2636/\033\r\236\311y\267\343\002\3365\367\357\310Uc,\246Y\233\027\315\216/:\273dp\373\356\021\327\f\222\0135\026\237ks\251L\006_\344\202\001\227Kf\2143\352u\21302\351\255M\245<\f\236\311\355\202\273\033\206\b\274>\260\013\306\270\364em\036]/\027\374\222\223\315\0020\367\356\006q\273\210].F\246-kS\351j\261\340\231\234\025\204\271v\354\362\326],\200c\227\216].=\347\326\346\321S\256\202_\202\266\365\rq`\314@\277\026+~\256\370\320}\326\032\005\337kJ.\2341(y\257\254\315\237\344}\243\340\203\224m\316*\267y\231\327\315yv\331\356\332UsF\271\313\213v\253\214Mp\251\334)\022L\020\301K\360\036\325\341Fa\227Nfk\263X\026\301;\211Apv\241<y"
+	.string	"\002\007\376\001\344U&\2338"
+	.ascii	"\326@\225\213\274L\030h`\201g\340\035\260"
+	.string	"\311U\022\325\364$[\233L\317\261\005\276\t\352\245\300\025\273a\312\373e4\362Z\233E]\n\274\021\222\004\004o\016G\242>\201\377\250^#\360Q\277\342\316\3115\"u#Ydm^.\004\376\206\322y\344\200\253\025\203\226\250\242XEPR\210fDD$IA\ni\f\322\f\2101\nB\007\325u\022\240\002-\207\302$*\0316\"\"M\222\f\373g\313\262=\262\363\261\377sc\325\034\341\205\333\236\267\230\310]Z&@ZY.\331\300\356\245\317\216\376\364\016a\034\247d\020\b\263\215\327\261?\220l\353s\233S\270\3434\267x5\0344k\270Gb\355f\377\220\326\356\310\231\262\254g;\031\356\023\303\036Q\204\f\236\306P\343\345rK\251\332\335\262\321\2152\202\0024\263\n\306W\320\201\323-\205y\264\311\312\321\\\346\226Av \232\207\277\231_\307\027\317\203T#\340\024\021j\370q%\b\003\034\246\306"
+	.ascii	"X\362>+\227\202\273\354"
+	.string	"G\262\305\276\307\375\235\351-\334\361K\237Xu\310\340\2471\356;m\030\201#A\236\327c\333\317408\352.\255\266\013\212\222\373\202\b&0d\205@x\322)\341\310\246\346\375\204\356\007\360\237\326O\253\254\372\003!u\004\303\320\276\224\t~\340\340f\037\037\202\276\205\262\003\374\257a\315\2250\006h\276R\202\330\325t\256\216w\213W\246.o\017\201\205 \253\233\357\225\304\301P\326\31789\331\331U(F1\321\344]\375\"\221p1\304\217\361\262\313,\241R\307\221\307\013\376\216t8\242\032A\217\024\251[\367\374\027^ay.\201N\243\207\323[Y\300\b\303\021\304%\272*}!CmpU\207l}\215^J\251\202\241.\177\336\256\1773\246B=\214\324\326\354\313\332Tj\356J\332 \303\256R\231\261\346\316\326=\016\336\370~\271t6\336n7\t\201-\345\226\305u\007\020H\326\267U\322\356A\026\202"
+	.ascii	"#GI\367)MO\230GR\234h\217;Wn\212+(\204;U\220\035\311\276\356"
+	.ascii	"y}\300\307\221\307\337\202\"\030\0376$\0337O\005\365\357\247"
+	.ascii	"\262|E-\227r\231F\335/\257\331\3444\241\206\262}\250OR\267Z\301"
+	.ascii	"*\207\035\246\264VZ\335\005J3~\232\373\030"
+	.string	"<\373\025\255Ht\265\247\245\220%\\\260\317\t\244\2167\255\345\\\340\3103\321\236\270\027c\243x\352)|\307\257b$\342\306\242vO\221\337\262\0221\016\300)\rI`\334n\273\230@\230\263)\211Z\327\036>\342\261\r\204\375e\3217\305\372\354\370\331m\0350\263\275b\025\024(\326\020C\rA\006\013\211\231\336\021{\254\335`N]\262H\200\261h\0229\366\353\333r\356\307\025\3057tS\261\r)W\2236\260(%\355=\177\264,\025!}\326\234=\216m\037R\313\026\366\265\211\023_\341l\371\234x\026\267\316\376\263\205\372\230T\375\272\231!I\002\204\351\004\205\006\013\3104\350\001\016\002\037\037\3709\327\367\310\351T3\020\245\216:\036\"\232\370\332?\262\t:\f\320#\252\273\025\260\315l\354\220E\365,\001&\004\r\253M=\234\364\332\b\224b\n\340$ ;u\256\244A6\001\305\257\002_\263*\002\f"
+	.string	"\353\241\335\373)G\351\357\242\377f\3160h\304p\0309\001\341\303\023\255\2118\331\201\030e#\211\344J"
+	.string	"\240qb \330\240\031j"
+	.ascii	"\246\333\214G\221\301\f\325\212\261\345\213Lx\211\324\355B\332"
+	.ascii	"h\342\212\342/\275\0209\243~o ?\f\304B)\346\024\250<\305\016"
+	.ascii	"+\274\027\367N=\332?\215\024c\246\242z\344\265\306Ur\334!\201"
+	.ascii	"\037\r\340zF)"
+	.string	"\003\324\177\300\305\224\006\335\374&,d%\231\356\032}u\0033\244)}\267{<\037\034\2414\221\272\030qz"
+	.string	"\t\025H\371\352Y\f\342\033\232\310\246\035B\337{\233\361\367\235\302\231\275%M\212\306\312;\b\023\""
+	.string	"\326 \372\256|mm8>\201\253_t\362\360\rr\357\253K5\311\"\253\343\305\265\033\232\326\023\251\022\335H\377N\354\b{\036\233\037\217\212\345\212\257\365\302a98S\372\0049\315a\204\230\340\332J\204\030\315\t\312dn\3620\317!%\2623E\265t\351\203\243*;\311\361\002B\027I\276\266B\025P\243\375IX\311\207x\217\n\037\317\\Y\226\022\311\013\bm\006\253\240.c\026\003\025|f\250\030\260Q\362\321zA\271\253\363\361-\252\310\013\330&\311I\227\nEsX\374\312\256\004\245\311Q\272\345\260c/HM\371s\353\224\020\234}[\352\003\202\271\022\353"
+	.string	"\344d#Y\304\227\375\325E\371\013\rN\334\332M\22381\262\t\310(\320\244~\033\023\2551\004\271\263\033=\254\b2(\030~u1?\370\302Q\204"
+	.ascii	"\306\302\f_\317\217\335\177\370\365\267I\2036\301@\364\205ez"
+	.ascii	"\303\342e\260\204`\233\272\377\202\t\272!q\371\367\375\031\024"
+	.ascii	"\245\215\353\277}\016\030\337~\2411B\201\263\013;\323&\247@\332"
+	.ascii	"K\0212\321\211\245\330!v=\260\273\037!M\024\234\335\210\2579"
+	.ascii	"\370N\026<KP\366\340\354\022)\f\"\214f\024\300\317P\fs\300\222"
+	.ascii	"@\275p\345\224t\301\ne\356Q\243\202\266B\234\234\274\357\"\357"
+	.ascii	"/{\316!\246\207z\366\370\227#\027!\351\331I\303\310\301\034\326"
+	.ascii	"a@.M!\230+\001`p*$\2051\335\261l>\204\222\322,\260H(\370'\020"
+	.ascii	"u\232L4R\311\275-\307\203)\254\214\241\260\215\210\276\203\243"
+	.ascii	"!P`\202/q\3652\244WT\315\3405\260\212\f\214\375\251\326\314\\"
+	.ascii	"\271\335\243\021W\255\307\230\006\350(\275(L\016\207\021\266"
+	.ascii	"\200N1l\335I\235\"\242\312d\334\207\222\267C\b\204\037T\252\035"
+	.ascii	"\300\026N\271\312\236\333\236\032c/V5\005j-\023\b8\273\323\002"
+	.text
+	.section	.gnu.lto_gpsNewFrameUBLOX.75.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`\253\020\305>"
+	.string	"\372_H\025BP\236\326\030\377\236\017\374\2123\266\023\347T\246\2410\300\322\b\215\343\201\001\355\242^*\341\303\220%\276a\207@\201\346\340\r\301\246\001\320\200\2730\212I\330\354\300\317\b/#e\024\270k\233H)SJ)E\001\037\001O\001F\326\231\207u.\262\316D\326\331e\235[\326\231e\235\237un\020\3149pi\256H\337\276\217\372\3668\274\363\362\265_\230\364[7s3\363\r\356)\037\033\024F1\277e15\251o\017\367ll\320\r\252[\236\320"
+	.ascii	"0\352\275\335\260\370\3377JW\367\276\324\003\354T\354\226\231"
+	.ascii	"YA\203\033\234U\204\243\t\210@J\245\013\313\340\373R\245\336"
+	.ascii	"Hg\365\021\323\250h\251L\022\r\t\005\001\375 }z\216F\236\"\321"
+	.ascii	"m\331\367,\356\007bs\234}s\320f\037Mq&\233\354\261\304\253\253"
+	.ascii	"O)\354\023\034\2739G\250\323\215\304\372\234EmQ|\251DB\235O\236"
+	.ascii	"K<I\234\262p\226$\013\221Z\017U\237jI\\\250\211\210\017$\035"
+	.ascii	"\204d\332MO\236G\034\350\007\tu\nq\244\361,\315\247\372\214\262"
+	.ascii	"L\357\373\366\223g\231\367\374\035\205\300\031?Z\206\207xVF\247"
+	.ascii	"\350!\314\r\\\337\034\364\253\211\325'X\227\273_\335\262OQ3?"
+	.ascii	"\220P'\233Ds\326\246\247\355:\2408\234\365)\375L\224\244"
+	.string	"\221\215\2115\221g\030\327\226\353J\303\350\214P\247\321\211S\357\373\262{A}4#5\263/1s\006\346\037\007\001\326-\257\303\355\327\027\244\332q\335\323\256\320f6\b\247\351\205\013\302\270\260a\037\355J\363T\323\013\271\373\013\237I\004\377\321\270\367\270\371\212jrnQ\314p\353\021\333\362\270\311\270k\3210\334bZ\303;n0,a\035\267\335\267\241\343\356\342m\366J\367\232\314qo\351\306\361eT\267(\257Y\026n9~S|\337fG\271\223\334n\233\246^5\32298\215\205\231\337tG\231\231\337\270\327\353\304\276cn\310\334V\032\016\213[\215\257bx{u\313\035\303\355\266\237\007L\313\017\331\343\332\236\235\345\366[\377\223\260\211\226\333a\347b\033$\f|\335\0163\265\351\217\306\334\177xx\b\310_\204\271\335\272\023\364[3\024;?\261\263\223\353l\300u.\340:\023p\235\007\260\316\002\\\347"
+	.string	"\2563"
+	.ascii	"\326\271\251ufz\347\245wVj\235\223\336\031\351\235\217Zg&\353"
+	.ascii	"l\304:\027\261\316K\326Y\351:']g\242\326y\250u\026j\235\203Z"
+	.ascii	"g \326\371\207uF\262\316>\254sO\353|d\235\003\322\242\245;Q\376"
+	.ascii	"\322\231(\257\3231\335rW*@DWc\353a#\025\373A\322C\3275\022\356"
+	.ascii	"\221\016U\336^Rd\331\265\215\\\307\222\217F\205\344W\244\233"
+	.ascii	"\312%\372\344\263X\270\242\374\301\207P\025\337\367u\300.\304"
+	.ascii	"\315Bp\253u\313\"F\214p\273%z$\353\333\325\210\013\033\251\217"
+	.ascii	"\277M\302\035:\263\345u\200\f=\231\320\007\375\320w\327\0171"
+	.ascii	"\241Wj\003.\320\007}s\335q\002=\213\345\372\365\023\004\371>"
+	.ascii	"\377\003\004\351\363\325\363>\320\236+4\257\307!^a\217\235\343"
+	.ascii	"\263\357p\036$JTU\271\307\1777]\206\204F\367\342\371\342\033"
+	.ascii	"=\007O\321\271\210_\364-\"\2350\256%\370%\316\021\320\337\023"
+	.ascii	"V\262=\327\320\252}\366\335;\355'\255`\354\327\351\177\366\233"
+	.ascii	"+\352\364C\036\374W\262\202\351\335\315)\343%\317(F\216\225^"
+	.ascii	"\240\212$+^\202\207\263By\204L\313\017\357\352\336\330q\231\362"
+	.ascii	"P\241k\2037\245\310V\305r\255K\277\265\2465M\236D\256^\245U-"
+	.ascii	"\335r}N\370\334"
+	.string	"G\343f\343\202^\201Dqmu\204\201\324\346N\323j\262X\270p\341v\273\224&G\256/\254\372\272\235 (da\332\265\306r\023|\023\201\013(\254f\310\250\202\341r\212\252\007\020\026\2340\201\"*YE\243\n\005\313'\242l\\\2650Q\243\304\f\030*\244\256VH\275XQ\345B\352\204\214\031RQL\276\202a%C\212\306\325\225\f\251#\365m\366\375\"\334|k~]^\230\276\245QH\247]^\276\251\r\365:\230\031\352!\230i\275\223{\332\3068=*a \324OQ\377\354\370\274\220=zbr\346\b\022\274\275\236\376\203\231\363\233\323v/-\b\363\321\234\3268=\021\233\201OC\245\254\026x\003\317\322Qp>\252\342^\201WZ\337\244Fe\004\364\314\fx\002d\362\006\374\215\025\t\020c%\340/\354\352xI?9\177@\316t\313\375}-\357\n\003\330\3259\221\006\360\001\272P\025\351"
+	.ascii	"\210\351,\227;\215\317]\t\225\t\276\351*\327\364K+\235=\217\023"
+	.ascii	",\023\207\257\351\205I@\246\277\302\364\357\206+\352\334#2\343"
+	.ascii	"U\312\f=\032/=RT+\375R\322+}w\031N\223\336\201\025\f\351Y\274"
+	.ascii	".\303<!\346\013N\005k)\215\331\202\273a@J\353\226]\212O\321\260"
+	.ascii	"\201\003\007\267[\006V2\346\037\375\013v\031\336\005\365a\223"
+	.ascii	"p\231z[^\207\331\230?\340\b\330\325\316\310\327\212~\371F\036"
+	.ascii	"\201\205\250\201T\251P\315\210\210\024\024\244 \205\f\007!\006"
+	.ascii	"\204\030\206\256\252\003\021\320,\350\034\232!\222\024$I\007"
+	.ascii	"-\366e\206\274jW\237zT\272\265\001\343*[\215\224\255\001\200"
+	.ascii	"Z\276\333\304t3\244"
+	.string	"\240QT01\300\252\200\265\306j\2343c\370S\315~\022&~\3462\252\211\257kV\335\335\201\365sj\n\016\2576\350E/%\027)\331\205KZ\220\225\350\246\304\3743v\231\212`\2532\b2W&o\025\275Dz\373M`S\323\305\271{v\237\335\230\224\241B5\237B\275V\b\277e\003\263\333<\274\234\004[b^\002\266\313,n\366\216\250,9\240;\276\003\220\256\355\257\033\314\3240\303\204\221\244-\023Oa\200\245r\"\243\326&/\337E\r<<\215{\352\203\236\332\210>\202\0339\206\b\236Xu\005v\266\257\311/\245\371\240\343\006\002\006;f\360\313\020\326\001I\032k\300\331\342*>\265\260W\310\224\212E0aHi0\215\362\002\rK\352\253\315z\346\357\233q>*QT\203\270Ci\332\277\034VY\356\363\\\233\023\362\024\310u6d2\212\346\177\357qC\220\234H t\251#\013\232w"
+	.ascii	"\245\037\2145G\375\241\365"
+	.string	"Jf\205\026\036R\006\316\217v0\257\366\301\326\216\035y\017\377\350\212$+\375^\bu6\214\343\240\353\025\244QM\230\220\274k\220K\3704\n\341\375B\230\340R\275yl\355!|s\017\034\325;\267#\221!1\006\367\266Z\350V\263\350'..[U$1Y7\013\234\023\350\204\232S\326\214L\320f\346\n\276\227$\304\340/\215\245\200\276\316|\017\306`WzM\305\247\317\250\241g\037\2359\361J\272\244\220\273|@L\005P\207\264\215\001'\207h\352e\206\311\240\365\n6\0078\306\235\003\261Z(\0179\246\025s\347\200\330ox8g\207\363\306\264|3=\024\243\276\246\031%E`H\226\306\234^\232\221\220\346D9\035y\267f\231!$K\357*@\347`\333\021\230\3779Tz\266\265BC\002\330\027\230\016\323\221\212\345\345E\303q\032\320\212\213\223r\222p\331]B6\343\254\b\305H\336\362\034\331"
+	.string	"\214\200\031\235v\030\221\202\310\017\024[\315E\030\212q.\023\365\3025\013\200\21378\025\237[Lv\270\353"
+	.ascii	"(\202"
+	.ascii	"L\207_*\271\020%QB\242\245h\254\355\350@\233\n"
+	.text
+	.section	.gnu.lto_gpsConfigure_protothreadState.76.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\333"
+	.string	"\001"
+	.string	"?\202\210\200 \177},{,y\273\001w,"
+	.text
+	.section	.gnu.lto_gpsConfigure.77.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`!`\225\303"
+	.string	":\034\325@X0\nAK\035g\344S\bN\030\025/\320\212&\024\215`\376o\204\313\tF\b5x\357D^"
+	.ascii	"\177U\030\031`\0269/\344\232\363\253\331R\363A\332J\210p\337"
+	.ascii	"\351\365z\275\276\361\371\036\306\341\3618\221\200\234\332:n"
+	.ascii	"F\367\031Z\355\306\216\264\332\374\264\275\367\336R\246\024\320"
+	.ascii	"\003\327\003\001\004\376I\357:\t(\350\317y\327\037\205\367\335"
+	.ascii	"\317\372\016\020\r5\326_\353M\204\254\031\377\362f\215u\317\""
+	.ascii	"\352\335t\377v\236\347\331\267\016wW;\fW;\f\212v\013P\264\277"
+	.ascii	"8\321\356\302D{\213X;\213X\373\313\211\366\025&\332]^\273\212"
+	.ascii	"\327\236\342\325\216\302\325~\302\325n\002E{\t\024\355-'\332"
+	.ascii	"I\230h\037\021k\257 \326N\301\211v\021&\332Yb\355!L\264\257\b"
+	.ascii	"\265\203x\265\177\210\265{\210\265w\210\265s\210\265O\020k\337"
+	.ascii	"\020k\327\020kW\211\265g\210\265c\210\265_\210\265[\210\265K"
+	.ascii	"\020k\217 \326\236b\242\275\202P;\312\253\375$\326n\022k\027"
+	.ascii	"\306\332\343X;\034k\177c\355n\254\275\205\265\357W\273v\265\277"
+	.ascii	"\276\371P\267\225\204+\312o/\311\232w\262\2013\233\033er\367"
+	.ascii	"w\352\320M\275#\006\225\2109\244\211tQ\fj\322\022H+uP\f\352T"
+	.ascii	"\322G\343\320?1\250U\244Q\0375O\f\252U\247\206\266\241o\304\240"
+	.ascii	"\006\342\324h\033}\263\217jS\272\250g\364P\023\367Q\255\232\r"
+	.ascii	"|\301\037\334G5+`\337\373\375\337"
+	.string	">\252\005^\363^\357\367\366q\355i\255{\273\277\333\307\265\2519\270\217{\271}\\\203{K\362\325W\262\217k{mj\277\366l\373X%JC\362g\217\266\217\325\244i\331K\377\310>V\247\242cO\366E\366\261Z\005\373r\343<g\245\3700\367\023\007\301\003\361\027\362C\236H\214\352\236P\325<\317'`_g`_\200\022\360\352\032\363\352\212B ~\327\335?\bWL;'\347\031<\024I\226\374`l\275p\365\007q\0270 x\256\230\357\271#sy\327\033\020\277\353\277\005\002\367\223w1\270\313\376V\257\345'0^\177\365X\362g\241\340\001\361F\033eU\231}\020\277\353Y\257\362\276\033?\206\367]\230\262\027\356\356.`\344\257J\201e&k\336y\"\223W\225\337<g\245x\327O\304\357\272\354n\267g\262\031HE\324\235M\020\277y\236_\266\363\345\367\254\0168\330@\203\f\002\200\301\005"
+	.ascii	"\200\001c\301\013\027-X\274\254pQ\221\002\305\t\023%ZH\214\250"
+	.ascii	"\200\002\021,!V@|\360\320\201\303\004\0334\250d\300p\301\202"
+	.ascii	"\004\021\244T@91\021\306\360\353\266[\313\3763\357Y\034t)\227"
+	.ascii	"z\230F7\337A\226\203\354\240\336@\3605\310\006\352\f\262OF\254"
+	.ascii	"\016@\213B(\255G\245\315\210N\003\223x\2431hIP\001\036y7#`\333"
+	.ascii	"A\b\315\321k\275\210'\343\237\276\300\357\001p\007\203\311c\367"
+	.ascii	"0uo\301\bTHxL\236\272\177\341f\244{2\316i\027m\b\035C\177\357"
+	.ascii	"f\244kY\320\330l\376\311(\247[\304\261\200\373\027\226y\236W"
+	.ascii	"\250\275\013UE\332\247@Cq\366'\220\2300\373\022c-bO\"l\004\221"
+	.ascii	"\257\240\035\301&\315\361n\306\265\326\303\320\321\022\n\276"
+	.ascii	"^\304\020\026\257\017\201\265r\365 \254>T\275\207\037\035|<\007"
+	.ascii	"\252\t\246~\003\230\206\366\005\215_\320\273\031\227Z\024@\233"
+	.ascii	"\352?\031\231\264\212R\206\244\307\200t\341\350-@%x~\004C)B_"
+	.ascii	"a\211\022\364'J\023\240\027\266*;K9\357f\314\321\242\260\026"
+	.ascii	"\341{\255oq0\2117:\026\301\344I>L\005\366\356)\275\234\343\317"
+	.ascii	"\273\257\365\0060\232\232\346\034\177\276\255)\276*GR$\223#\315"
+	.ascii	"\336\202~vpjigfbD\276\274\256\252|L%\035=\205\202\200\236iL\232"
+	.ascii	"\034\211\257\356\232\322d`\022o8h\330\203y\236]\347\034y\336"
+	.ascii	"\005\360\356n\216\273W\300=\002)\002-U\234\265b\306\304&\201"
+	.ascii	"V+\325\366\330\303\341\323\323gL*[\250'\247\246\226\251\345Y"
+	.ascii	"\266JIHG-t\250u\306\264<\213\332\035\315\266);u\264F\331#h[$"
+	.ascii	"#\021\r\265BJm\220\022\250\315\221t\231\251\375I\272\354\324"
+	.ascii	"\342H\272\034\325\372\264=\311\037\034\333\247G\017\250o*\002"
+	.ascii	"\270=\302V+~Pd)W\355N\253\243\246\004\312\301\266T\2665rpnZ\033"
+	.ascii	"\271eK\323\026[b;lg\226\331\345\340Rp\031\210]\376-\375\226}"
+	.ascii	"|\313\275\245\3362\017oy\267\264[\326\321-\203\224\372c^\r\224"
+	.ascii	"\203j\342\003\373\254\360\306\275>B \371q\205\362c\311\233\031"
+	.ascii	"\321\220P\0233\251\334I\334\332d'\333\032\225\231\306Dc\236!"
+	.ascii	"aN\231G\232[*;\313\214d\217\240\273\210\214D6&&\350\243\264\211"
+	.ascii	"\3040\301\230_C\260C"
+	.string	"\257\231.3\355.\246\020f\020.f\021\321\263\f\207\236e(\364,\303\351I\020\021\307\211\317\273@\\)\021Y0/\223\251,,\023\242F\377Z_\200\353\354g\035j\254\303h\327N\371G\316A\3343\256\325|\224\273\352\207\017\252)\027dr\271{D\361\200zR\001U;\376\374\320n\212iy\026m&\331hDs/\311N\245$\227\270\240\354\313H\320\r\225\221\236\316\035\202n>\257\264u\0301\213J\300\241a\335>\346\325N\227\231\266PL\b\270y\236a8\355\245\f\365A;]\216\332A\262T\206\347<\3170\336\365\r\264\2252\225\313?d+\331\352}\327\345\251\235o\202\366\347\266\343\343\353\032\321\237^\362u\323?\346\325:\236\305\3721\2576z\226\241\306\272\td\032\360\355\254Z0g\215\335\236E\374\n@\220D\302\335\364\217y\333\235\302\334\222+j@\367\215\334=1\376I.c\t@"
+	.string	"\357\273\355\376j\\r\250\263\376b3x\255\230K\036\377*\211f\264\340\233"
+	.string	"\264\222\305:\352\335A\330G\227~xnc\b\270\275\241\316z\0070&\354\244\340\247\330\311f\350\rz\337\245\257r\370\357e\367\343\232\320\263\242]\336\345\335\t`"
+	.string	"\232=\343\017g\207\334\3057\301\350o\034\334\215v\337\370\306\321;M\233\306w\215\377\0077M\233\350\356v\036\204$\347\252T\r\353L4\237xw\3576\001{F\001\361<\027a\370\236C\260\200x\236\347O\242\361\276\273w\b\367\030z\220F\240\026l\200\003\036\360\200\367]\2755d`\320m\326X\307\240\367\336G\340u\237"
+	.ascii	"\005\364\3478Kq\317\270\211\271?\267\253~\372\327lN\217mF\013"
+	.ascii	"\276g\021?\203\325\324s\357\246\356s\355\347TyR\215Y\347y\317"
+	.ascii	"\365u(\203\037\025\226\025\317u\336\233\244\232\262s}\367\352"
+	.ascii	"P\tY\347\\\323\2759T@p\256\343^\033\252\035%\256\337\336\"\225"
+	.ascii	"\r7\327I\336\031*\2345\327l\203\203M3Q\232k*\026\213\304\365"
+	.ascii	"Y\337]\323<\037q=\325\233k\232g#\256\313\254pM\363L\346\272H"
+	.ascii	"\035\265i\236\303\\\213\311\2355\315\363\227k\260%U\2511\353"
+	.ascii	"<w\271\366b\363\342r\035\204j\245\345\032\310\231\217+\327XS"
+	.ascii	"\246\037\256\253\312\222\246\\S\025\371'\232\245\240MQ\256{\270"
+	.ascii	"]\354\202\275K\337w\333\036\024\036RJ\353L\004\345*\334.\026"
+	.ascii	"\341\0011)\352\317\352\256\235\334\335\016\216\006\325M\315\363"
+	.ascii	"\314"
+	.ascii	"\013\351\234y\236\347\371\304\273\277Szf\037z\320\335A\320L."
+	.ascii	"\215\347y\206\261\364[E\334\325Pg\275\003\314Yc\275\002\377)"
+	.ascii	"\274_\365\037h\032j\254\037\340\357I#\241\320\0027\317\303\317"
+	.ascii	"q\r\325G\"\004_Cd\247\027\334\365oA\336\270\336\266\336\200h"
+	.ascii	"\275a\275]5a+\331Y\365#{\004\205\251d\244))\270\207\022\314\003"
+	.ascii	"\352\tv\3727\227\231`\246\177s\331\t^\3727\227\243`%8\351\337"
+	.ascii	"^I\365\223\274\033\026.\302\314#\241\262S\236\216T\3206\034\245"
+	.ascii	"v\214H{\302N\2768\270%Y\2429%\254\303\210Y\004\023\311-a\241"
+	.ascii	"e\220\022\006\032\202\2231-\317\"\370\247\t\343\220\235>pO\366"
+	.ascii	"\b\n\363\310HG#\274\243\004\337\260Q\003\316\3719\227\231\340"
+	.ascii	"\233\237s\331\t\266\3719\227\243\340\032\230\346\347^.\356\341"
+	.ascii	"~\311\325M\033\031\034\254 \303Ny\332R+j@\377\354\307\274\030"
+	.ascii	"v\206\3755BD\235\205\207\030\314\272\230M\024 \201\347\254\232"
+	.ascii	"]\035\235 \233\325\032h\305Z\001\255\177~h\377V>\353\325\272"
+	.ascii	"g\325\313\263Z\255w\315\327Nv\326\321e\217\240\257\234\214\024"
+	.ascii	"\007\367.Qz\225T\223\274nou\231\351e{\253\313N\357\332[]\216"
+	.ascii	"z\325^\352[\377\356\355\340::*\216\334\215\210\013g\027\244\\"
+	.ascii	"C|X\216\230M\217\350\345\341\t\022]_\250\377k\331\325\3105z-"
+	.ascii	"B\366\364\177\025\273\206]\211\\\301\276\256^\327\256\253\220"
+	.ascii	"k\020\256+\220\253\3265\013\353ju\255\272\376\360q\235\272J]"
+	.ascii	"{D\375\365\367L>\346}=\021\037\363~\336\343IMl\214u!,\274N\026"
+	.ascii	"\242+UP8+F^\246w\211\354\375\276\357\371\260\326\007T\276HG\320"
+	.ascii	"\347\353|s\226oS\207\021\363-\032z\207bZ\236E\257P\363]\312\316"
+	.ascii	"\240W\231=\202\2769d\244\344\317\213C\351\355A\362\274\307\007"
+	.ascii	"t\231\351\335y@\227\235^\235\007t9\352\275\361\332x\300\377\363"
+	.ascii	"\273\3601\357\367=\037\326 `\033\b\t^\034\t\306V\214\212\330"
+	.ascii	"\370@\366\332\2745>^\360\003\037\213\315\372\254\217\362%\276"
+	.ascii	"\303w\346\235\263.\310\241\245+\030\210\225\235\200\177Cn_L\313"
+	.ascii	"\223\257\351^e\347\236\336g]\206\272x2\222\365\316N\311\245\233"
+	.ascii	"\223\213\373\354\222\317\276}VI\365\263?\370\202\3172\374\300"
+	.ascii	"\307R\275%\253\036\"p\213\200\b\b3\260\032\035\302\330\326x\f"
+	.ascii	"gf\254\261\250t\323\320\316\220\270f\305#Ei\261\254h$Z$+\216"
+	.ascii	"\025\305\212aD\212_\305!E\257\256b\220\""
+	.string	"Wq\013H1\253\210U\274\262*\022\207\3172\234\231\2410\020*y\222pH\331)O\356\217\224\375o0\262\001\322\250!\377By\270\372d'\370r\251\\\272\342N\221x\300\0062\204ljh\376\265\376m\b\371c\373\303\361Q\272Q<\240\236\\'\271\245\313\264\244\224\344\"\371\f\271\320\230\226g\221\373l\272N\331\271\303mf\217\240\256\221\214\304,r\211\224\\\241e\220\253\304q\231\311\315\201\343\262\223\233\304q9\312\375qq\340\334\330<\313\260\206\306\353n\3516k,,E\235nh\231w/\357\274\025\366\356\261E\275\341\"\345\035\236\n\373\271\342\256\206:\373q\215\021\232\006\031\371\242\354\020\266\342\\>\272;2\022\003({\005\352\336pm\234l\025\250\f\240\273\237]#M\252b\342\342\230\b\371z>3t\2716n\215\f\243\215\0329V\035\245Kt\207\356\214;g\335^\353\b\352\004\352`u"
+	.string	"\377t\372t\370\232\355Uv\356\351\351\340\351Xu\356\354t\350t\346t\344\342t\226\350\274\351(\251\352\334\260\341\326\310\311\332\260\316\030\204m\302\255\2607%\027\270\326\324"
+	.string	"\217\306\235,$\022\ry\206D\2024\233\372x\215\224\"\313\220F\220\321\"\3101\244X\263\r\223\235D\300\262G\320v\210\214\344\325\325\nQj\271\266\200\264ZH\227\231Z,\244\313N\355\025\322\345\250\326\252\255B\362\034[\343\316\237q\311\312B\034$\234"
+	.string	"\302\214v\204\0224\r\032 h@\004\367\004\006\234`\002\t3fx@\004\241["
+	.string	"\204\0130x!B\b#\254P\031\201\204\0214@B\t\0208\201\003B\027a\305\007dh \004\017P\200\006\007.\360\"\243\204\027\023J"
+	.string	"a\003/\"\314\240\361\262\242\203\313\340"
+	.string	"\t3^N\220!c\306\313\211\273{\326\360\267\016\367`\270\211\376Z\217\200\037f\323\273\007;\233\315\322y\360\3306\227\276<\331\340\366^\231\342\335e\346\204j.U\241\216\320\213\302\300\345\211\004\352"
+	.string	"\306\206\331!\216\320\316`\354\226\317\202\r\2639\270\276\330-\266\005.\366\213\375A\235\331\324\305n\251-\366\205\034&S\303/\016Xl\r|/\233E\331\313\326wQ\327\276)\337\233H9\364X\2276\350\213\272\364\337\212\330\375\255\215\311\374}\020\2611\275\025Dd\0047\200\265T\227\275b\267u.\373\2616\240!$SG#HO\3516\235\252\321`7]\270\365*\366"
+	.string	"\204A\204BR\360Or\231;\031<\031\274\367]\025{E\\2%i5\224\301n\372\247\360\246\330!l\311\351\t\201\310\\\345\243\024\033D\\\026\r!\026\212\235\301\204\236\217\373\241\t\360*"
+	.string	"'\266\211\275\002\270E-j@\267\222\371\253:\261\333\275\270\022\333\304\346@\332\262G\354\022\373k\232\210:\353$v\313\376\300\207\214`,\244\332\355\024z5b_8\022\021\367\214\256p\306T\305\240\202\255\341\r&>\005\273\202\036\024l]\007M\236,\251&k0\226\336\233X\211\240\231\202\273`\217\207K\277\n\007E\367\334\303cN\205F\357.\323't\222\371\353\340)l\nC\023\261\335e\260\302%\031A\0258\241\322\026\314\311\033\352\254\263l\021\273\r\263\031\034\352\254{\240\335\345\031\231\250?\207e\277\024\021q\317\f\272\315.\323\314\b\304n\024\2579\013"
+	.string	"!\204\317\020\326\226\03351\030x\302\035\302f\036\036\314{\315HK\031\323Rb\201\006\332\2532\216\\\343\275\362\246\032[\315z\341\366\374\312\336r[j\302!\241\320\312\376.\350\240\235\230\213\026\204PY"
+	.string	"\020\302\034\302\344\207\031eyF\266\005\260\035;Zx\020\372x\250\203\331\261\223\203\205\235\020)\344\231Q\3456\203=\313\320+\310\277\326\033"
+	.ascii	"I\346\027\246\024\356\350\334\260!\254\021\333-\2058765B\232"
+	.ascii	"!!1\246\345Y$\0346\2053\262S8g\303\004\303\002\303\260\200a~"
+	.ascii	"a}a|\3270\275\260\2740<k\030\0210\026\037\363\276W\220\274\037"
+	.ascii	"\233\005\356\b\336K\207\270\256\203\034\327\235\337\212\271x"
+	.ascii	".\226\233\301\203lL\254\013i\214*\343%oJ\252q\222h[\224-\272"
+	.ascii	"\026U\243F\321\242gQ$Q\263iT\032-\213\032\211F\311\242cQ\261"
+	.ascii	"\260(X\364+:\304+Z\204\354Y\206cbyPRd.\034\204pXb\365\354R\001"
+	.ascii	"\307\265%$-3\3026U\306YX\315\370JvZ\305US\037S\252\351\324T\252"
+	.ascii	"\307\224\307\024j\3724uj\232.M\225\246IHS\350\3649u\306;\246"
+	.ascii	".3\305:\246.;\305FS\227\243bf\\4=\"}\226a\231\221e\326:\224b"
+	.ascii	"\202xh\202\352\312\216(\035\024J\342e\034\224<Cb\326\224\246"
+	.ascii	"\214s$\177p\304>\313\030\311s4\306;C\361\215\230\226gQl"
+	.string	"\243\031\327\220\23591N\232\313\320\330FF\252\241\211\213J\3610\236\211\347l\232`Z`\032\0260\r\355\354Y\206H\314~\340\002\337Nl\360\333\320\006\242m\246\317\204\033\337u\006\317\232\032\265\3538\267%\225p\036\236Uv\336\331\321\265\315\265\311\265\305\301\265\275\265)i\302U\331\231\304-{\004\205\331d\24455\230\252\004\243\235!\201\315\332\\f\202\217\264\271\354\004K\333\\\216\202\313`#mlkj\324\274\243\321\220\261\022\032\340\"\032\324>\350\240\001\265\254\301c\260X`5\211[\226\354-\251\204\301\002\206\241\250#\221\tr\234\206\312\220\210\210\210$I\222\306\323\034\020b\220uP\242\261\r\023"
+	.ascii	"\311e\362\340L$N2E\204\r!\310\b\206\214L$\221T\262\347\250\252"
+	.ascii	"\257A\304b\246\020lGt65\366c\234\365h@\253pF\307\270\027(\275"
+	.ascii	"&\216\002\275\031[\200\003\267\226\366\360L\371\2641\035\006"
+	.ascii	"t]h9\320sw^u\327\266s\352\376\227_\245\214\252\376\r\324rQUf"
+	.ascii	"D\3268\246\241\317\275SLkY[\032\035\220\373\\\335\212\223G\032"
+	.ascii	"\356\220u\013\376\242\273U\376B\222<\036\177z\220g).o\teX\206"
+	.ascii	"\027p"
+	.string	"9}\226\240\216\211\037e\303 %\030K\312\376\002\207\027&bu\005l\237W\220L\025\226hT\315lp^R\256:\213v\363\254\275\356\332\330\327G\216\373@\221p`l\022\242\340\016W\256\211\016\277\273+\021\353V\302E.\272\262Zi\374\231]\354\b\237LtE_\323\023\234\302\317\023h\352\356K\375\223f\034\016\020\205\016\257\f\f=6\017\266\274\231\272\340\001^cee\234dM\037\272\205\2120V\234N\355D^\013\3071\322\337\374\036\257\334\234&\325ji\366\211f\\\364;\270\257\347w\341E\257\306\206\020\331\227+>\246klV\376tL}}\276\315J\254' \222H@qt\332j\325r\346\020X\215\374c`\305\373\304Q=-\224F\t\313\211\273m\251\020n\322\331\272\220\021h\271T\213q<\350j\211\222Mq\203PQ\023u\250Q\264\025U\224M\026\003\247\037\311\367\244;(\224\2647"
+	.string	"\206J\272+\314U\322Uq\024\177\240\330:q\324\340\316v\033\222\235\241U\231\362K4w\373\217\324-\340\bz\220\325;m\260I\356\266"
+	.ascii	"5[\025\030\270w\213iBRl\025\234\230 %pa]d]\270\300\005\357\302"
+	.ascii	"\025J\205\212\277\311\315\344BDSn\247(\215Di\312/\376\263\224"
+	.ascii	"B"
+	.string	"\2414k\007\372\306~\007\377\272[\357\351\b\233\225,gK\222\355\277\201gc\326J`n\026\327hG\317}\354?u\273\312}[\206\332\366\3727\3314\260\230:1\324pIs\033dh<\212S~q\237\b\202@3+_\326J\320\264\r\365\272E\\\266pU\275\301@\322\207\332\220\360k~c`\305\326\221\260\005#\230\266\333\240\314:\215\035\341&j\275*2g\263\211pG\007\331\2058\247\n\215D'\311>A\331L\253-\316\030\035$\240\003\r\315\343C\211e\201\266a\365r\227+@g\222|O\252\202B\251=\003>\177\317\001I\345\026PbMk\177\260\rX_D\326\335v\242\257\252\252NQ\\\354\335O\003\313g\3425IRJ\020\264Dz[\273r\024\035\256<\235\215\377b\036\353\245|\333be'A}`\273\203\365j\2715\300\353\230|\260\302\025\035\341\361\032F\377i\003f7\233\b"
+	.ascii	"\265\235\215\205\240P\025\225\225\326\213\336\365H\022\354$\361"
+	.ascii	"\026\003%l\226A,\317|\253KL\266F\375\326\335:?2\234+\245 4L\037"
+	.ascii	"\250\3117\304\243\223\276\212\327n\347rmk\315\355\351\362\237"
+	.ascii	"&\fv\263\210\005^\331\331XH\001\311\261\331h\271K\255\255B\343"
+	.ascii	"\324\252\016 \027\242\370@<l\377z:\202\370\006`T\242\017\362"
+	.ascii	"\035\302AY\277\342)z\306\340\325\2047&Vlo\034\325\333B\225\300"
+	.ascii	"R\303\205\205\362\023\026\f\272l\273\302\\\256\b\374(\372\270"
+	.ascii	"f\336\343:\240=\254\214/X\352\316,\237v#z\237\220\315\262\020"
+	.ascii	"0 \356t`\257\030\342\022.\350\212\024(g\221f\321\260E\255[\211"
+	.ascii	"\213\333&\242cUUMS\324L\0302^\0070\037\355F%mk\250Y\320\240\325"
+	.ascii	"\"FH\336\022@R\241\213g\243\221m\274\263\032v\025\340\340\006"
+	.ascii	"&\235gY\003Y\017\237\024\225;\216\026\304\325r\262\013\367\270"
+	.ascii	"%\310\020\334\375\220\r"
+	.string	"e\23305^\027\363\263<|\215\372\335N\372\276\214\037\211y\326\"\346\220d\237\345\267\233\3211\335>&\267l\266\034v\356\263\275\2010h\322-y\205\3364Xi\362\217\301\026\253#\246\376ZP\025J\254!p\253\2504p\303!\177/\2675\177Y\302\3102\220\227\242{\344\356p0\020n\345o\234j\3756\276\3213\227\225F\021\351\204m\230\354O\273\210\371\207\351\330~1\3075\\\355\245nR\253\221V\320\337\260\327\255\304\305m\023\321\335\341 {\001\373s\366,\022\222\256E\025R\374\354(\232c\252c\035V\306\315\205-\037L\212\2656D\363>K\225\205\266p\334\264\316\020q\213\240n\305#;\251\326&U\346\217\306d\207=\251\243L\255\241\362\312\237\021Xl\037\227\372\026\300XIW\363(\306\222\270\324_\207>X\037WP\025H\t>N\367\266JZ\004\253m\241\020\327?\270\200\3257\355B"
+	.string	"[\212J,\220 \275\006\320p\252[\361T\373\211Vwm\330\0366\377i\202`7\233\b"
+	.ascii	"\265\235\215\205\240\230\206\271\374\275\244.\301\250\266\311"
+	.ascii	"\370(\212Y1\267\267~6b\327\345Z\325\231\345\245U@\336\021\177"
+	.ascii	"\261f\302\017N\235\016\354\325E\\b\t]\265@\265\2134\213\206-"
+	.ascii	"j\335J\\\3346\021\335\035\016\262\027pf\345\351\250\"\301\273"
+	.ascii	"M\354\230>&\241\207m\345\271@S>\26394\210\252K\236\036\370l\177"
+	.ascii	"\031w\351\022\nM\316\273Xhr\216\0010\365\333B\255 q!\001\333"
+	.ascii	"F\030{\n\301\201\020M% \326=\337\340m\324q\032mX\013Q\214\314"
+	.ascii	"\261\272\233\203\244<\231\013\306\327\374\215\301+\353um[\302"
+	.ascii	"&\355\265P\347=g\013\343\341\016\201\266"
+	.string	"\271\302\361o\275\r\234jH\222U\004\025\232\252\253h\200x\270(\350\366tuHp\310\310\002\322i?\017\037\311Ph\360\352iYan\252\231\t\327\247\251\023\245\270\227,\372\013m\300cIl\233\371\006j}\355\022KZ\373\331\374O\276\r$\273\256\314\272e\325\2133\265V\210\361\320\033\342Z*\004\341\215\0078q>\322\275\272\320\217\237,\221\372V\"H\222L\305\007\252\3446\340a\3569\022n6Tw\013\271O\223\374!cBg\206\250Q\261h\321\205\320\317!d\361\202\246\204\251\016\305\303\307\003!S\256\225#\371\032\307\274\023\3333N\331x\215 \037\370E\t\260\373\367\266+\374F-\214\352aoO#\003\344\2308\336\304\205b\222\364{C3\220\222v\315B\204N\356rE\264\002\333\206\266\013\326\271\260k\316\224{\305\345X\347\031N\033\203\311\031\302x\335\213\354Q\013\363\250\375\350o!7p"
+	.string	"\220\333\302\362\r=\210\350i\312\0274"
+	.ascii	" \316\031L2D\026\236F\224\203X\b\327V$\034\255\310\271\365\""
+	.ascii	"\341h\"\307\255\023\021Q\244\017pM\n\3508\351\"?\262\300&Y0G"
+	.ascii	"Wh\261"
+	.ascii	"\212\026+\031C\256J\320\204\200\f\0069\311\266\242\373*5nX\370"
+	.ascii	"\371\357\232\376\347>\201\027\001\336B\322\347\377\272\363\377"
+	.ascii	"\356\374\177w\222\377\343\356\274\377\203w\347\377\356\361\361"
+	.ascii	"\235\251Z\200\274\332\235>\354\312\307\272\362jw\372\260+\037"
+	.ascii	"\357\312\253\335\371\303\256\374\3072o\215\205I#\303\352e\256"
+	.ascii	"\312\353y\324\240>\230\310b\371\232\004\023983\2047M|TD\f\236"
+	.ascii	";\bGhM\371\350BN\365O\023\356/8\310\246s\262\224\270\312\001"
+	.ascii	"7\227(\032\3268\246?w]\307\254:\315\321\222\313H\315\361T!\305"
+	.ascii	"v\022\242\305lB\bHuf\257=\201\277\275]\363\270\332J.\f\240Rx"
+	.ascii	"I\332md\025\220\376\271\271\375}\316\3422\330Z$'~\336+J\276_"
+	.ascii	"\364\300\366\216\236\336\306\300\325\0011\376\363NU\365\035B"
+	.ascii	"\240\3643e\331\330w%+4\362\207\360Wpj0k\222\250C\251\206\210"
+	.ascii	"\032%zJ<\266\363\260\344\030\336!]"
+	.text
+	.section	.gnu.lto_gpsProtocolReceiverThread_protothreadState.79.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\333"
+	.string	"\001"
+	.string	"?\202\210\200 \177},{,y\273\001w,"
+	.text
+	.section	.gnu.lto_gpsProtocolReceiverThread.80.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`\276\004\205\037"
+	.string	"\0068\311H\200\332Q:_\033\245\202\b\034^s\271\370\027\267_\034\326\031O\270\255\022\347W}\247\007wM\347\310td\250\t\212\214\364\301\362\221\354\234\321\231\005\203\270[Md\326\205\230\323*@\213V\016&\333\324\326\b\331\233\354\235d\265"
+	.string	"\247"
+	.string	"\270"
+	.string	":@9\336u(OO\233\202\2005*V\312\205\246!=\017\376EO"
+	.string	"\377\002\001\371\221"
+	.string	"\364t.'\335/\3157\016$\033\343r\223s\n\341\267\037\240\277\375\324\335f\363\225\354C\267\025F*\314M\316yg\203\364Y\237\216\2368\234\273\246\255O\375\337\321"
+	.ascii	"j\200^\2576\246f\324\323L\307qg\020\3307`\225\225\t\252\241:"
+	.ascii	"\026\240D\307s\246\205'N\204<M\330\303\264_bg\007{\265aF\243"
+	.ascii	"^6!\017S\227s\276\327\025h\twT3gVu\033\225\233\002b\236!H\"'"
+	.ascii	"\nw\330z\006\345\234\273\006\247p\274u\336\335a\335=\242\333"
+	.ascii	"\244\n?\270r\376\375G\r\346\007J\303\250:\247\273]\274J#\321"
+	.ascii	"\234\363\004*\267\021\326\272\240\352[+\021O,\265\362\235\360"
+	.ascii	"\271\036#I\206\245\326\307\232\030$s\206z\260\037\345b\275~\221"
+	.ascii	"\337Vj\252\017\376\366\233\360"
+	.string	"\357\323+\r\241*\234\276\327sbV\302\245[\256p\272\323_\265\306\356\277\2305\025\247m\261\373\307\367\016\256\215\336\332\347kc\263\366\275\265M\\\333\336\332\325\254}\236\003a@5\260\255\244-\223\346\033oq\262\230\213\005\311\217\177\367\201\214\374\364\277\372`\255\003t\344(C\007\253L\b\375\375\237\334\253\003s\222J6;\366\307\353\nT\323v\017\221\250\017\356X]\0300\246M\260v\260\017H*\225i\235\376n\325\314|M\271\326\330%\260\265\001\264\216kQ\365M\013\250\325v\023\025\325\007\255=\257\206Q\366\327\335\274waB;\027\025G,X\340\337jk\024!]'\225\020F21;^2l4aM\264\230\326\370-\215D\220\205\\\220\\\003U\337Z\004\361\002qL\351%\315\201\362,\355l\210e\307h\312,b~U\316;\235\361\ti^\206Xkl,\375,\335\206b&o$\3765\253"
+	.string	"\214\331B\223&\017\257t\204nC\321\254\334\243\326}\262\356n\373\201\2513\305>\242\025\030`\360\220\316\245\017KH<\237\217\251\b\327)\210(T\370)Ba\344\303c\3043j\301;\032ZJ\302u\221O\214^\013\024L&^$\251\330\365\216vHGD.vE\276\027;\237\236\356%\361|\273\245^\317\267\323I\363m\261;\b\312\002w\302\304\224\b\227nV\336A?\364\313Q\213\201\355D-\210\341Z\362\264>k]\367\372\253\244\256\362\322\315\3149\347\323\032\373\342\272\200\330U\272t\033\"r\300\3751'\303\241_\244;x\360\200\177\033d\255)A\254c\3126=dVJl\215\375[)V\305\263\234-:alO<\262\031\250\327v\013\205\250\017b\253\333\261\327V+R\001\\\250!4\250\034C\210\311H \243I\n\222\016p\002\031\261,\017\020Xg4\315r\242o\311\035\321\360"
+	.string	"\341,\336+\005\346\204\233\223\300/cB\202\233\230?\025\327\202|\003\270l\tL\233\220V\224\212\207\306R\\\2427)"
+	.string	"\312\214\365a`h\312\237>)\027\030\344<\002y\272\006\336\270\356\246\341 \247\322\020\312\346\021\372A\331Z\324\223\366b\377\332I\033\356\377\300\266\252\274J\307\337H@~\305^\264\264\203\345Hj\325H\270\354\312\002X\252!\222\206\276\224\303\",\270XC\204\274S\346.U;\007\253\027aP*\215L\356>b\372\244\024Se|D\372\223%\251\202M\215\177\306\372\235p\230\262\033\221"
+	.ascii	"\007\330\n\177"
+	.text
+	.section	.gnu.lto_gpsProtocolStateThread_protothreadState.81.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375 #\031\001"
+	.string	"\026"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\005\001\006\333"
+	.string	"\001"
+	.string	"?\202\210\200 \177},{,y\273\001w,"
+	.text
+	.section	.gnu.lto_gpsProtocolStateThread.82.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`\031\027\265^"
+	.string	"*\220d O0R\322\351\376\026.\221M\265m\243\345H\265)\345\336\341A\247\374\341\2313Svm\203"
+	.string	"\343^\375\343\203z\373Un(\002\302\002\323\300"
+	.string	"\314\237;\236\347}wf^"
+	.string	"DH\022e\246\362iU\005iEP\025M4\022\021\021\262\367N)\245\333\001\334\001\374\001B\347\0246\316(l\234O\030\235M\250\316\001"
+	.string	"\235\001\020:\227\b:\007\r\235\201\332\371\007\350\354\003t\356\021:\223\b:\363\f\235G\f\235E\f\235w\206\316:\251\3631u\316\251q\306\251q\276):\207\020:\203(:\333\b\235\215\355\\\003t.\002\235\211D\347\341\320Y\bt\016\n\235\201A\347\265\235U\240s\272:\277\352\354\251s\213\360\323F&\246\214\t\365q\316;\344\357\207\013\247jy\302M\326e\314DN\241k\340W\313\373\262\n\273\367\022[\345&K\201\231\330j\267X[a\242\f\265n\366\030\333N 6\224Xp-gX\027\006\234}\\[\r6\316\332\252\f\267\0300\004`;l\205 $\347\035\322J]\352\302\320\334\353\024j\225W\004[e\226\231\356o\332\245\222\301\024\322t\005\315\275\267\350\2274\333?>=$xF\210\330\3219\346\340\334\204"
+	.string	"ac\254)\022\207\302 pU\323w\226\033\251\177\034N\254\313\316\211\024\263}\252$\305z\302\232\004\263yN\214"
+	.ascii	"k\021A\315$\023\337IO<\223_)O\225\344\023\327qrLY\324\251\351"
+	.ascii	"\365\\\322Iz\034\342\344\251J\262\211\347pIu5\016\223\276y&\253"
+	.ascii	"py\b\020R\222K\233,\251\2536\002mdImuM\225Z\223\027\235H%ib\312"
+	.ascii	"\302\252m\252\347\222T\3511\214V\031)\311\246\017\221\264\260"
+	.ascii	"\253$\217\004KpI\031i\340\252\325\006\027\026\315\222J\322k\n"
+	.ascii	"\244\344*J\214\n\222\006}\201kj+]\342\231l\272\372B\247\317\244"
+	.ascii	"U\032t\357m+\355-D-\371\207\201u]!1\3024\214RZ\201.$\001\353"
+	.ascii	"\254dS\350@\033\367^\366\247(\251f\240f\366\f\230\231\003\346"
+	.ascii	"#\005\001FAg\n\276\221\217\\\211\335\242\301\216\344I,\223\264"
+	.ascii	"\t\373d}\262\266\n\374\032\021\364\037\033\205\006\267_\247a"
+	.ascii	"\275\330),\025\226\312\332\352\372\235eKKC\367\252\236M\235c"
+	.ascii	"f\354\007\340+Y\346\312\314\2025\037\313\334YF\207\240y'\030"
+	.ascii	"y\226p\225\256\331\261\225\031\201\004\274\2378\250\317\366\212"
+	.ascii	"<\t\370\025l\177{\353+\271WX\3257J\361\361\364\231\025`\300\373"
+	.ascii	"I}\340\025\326\322#1\263\003\215gt\207&\327\004\022\271\261\266"
+	.ascii	"S\262\324z\365\302\342\226\253\355R_\311]\307\355\317\322\207"
+	.ascii	"\023\320<\013j\024\315\300n\317\227\335\230\364\225,\301\372"
+	.ascii	"\337\001\331\334\222\36313\004]F\202\340\275K3\270{P\201\202"
+	.ascii	"`\327\217\265\325\177\037\346\033-\367#\256\241\025Xp\301\005"
+	.ascii	"k\253\3769*\364\274\236g\262n\226\026\240\016\311\375\232\235"
+	.ascii	"JM\303N\314\331\277\222{\f7\231\251\"\032\261\256\272\213\025"
+	.ascii	"\206\373)\244G\211X\0220\334o@\026\216_bF\352\356\375\302\335"
+	.ascii	"\246W\034\303\244\253\273X]\270\275\2309\3261\335Zn.s\351T1\217"
+	.ascii	"\311V\247\205{\013\323\005W\270\346vm\265\231.\022\n\2556g\032"
+	.ascii	"\0171]0\270\274<b\230[\007f\246k\237\2503pHm\345Ow\205q\352\""
+	.ascii	"\3614"
+	.string	"\314\234A\347\300m\360\336;\003\207\376!\271f\222\377\261Q\326\006Q)\267WX;\254Q\200\262@TJ\237\001A\001\2757\251\237\270\261\264\231\006\334]\2552\016 \336O@\326V\333\331FXI\336\307m\245\207fQ\340\242w\327\373\230\235J\235\336W2wz_\ts;\307H\235a\b\235_\3308\273H\235\213Rg\242\032\347\0265\316CEg!\2413\013\241\363\212\242\263\212{\310(2\272\266\332b\231W\326C60u\013\026\032<(_\325\223\217\252\t\347\225H\277>7\203\364\313\201\2261\001\315\343+\202\2642#\377\\\216E\312\201:\364g\251\302\024\020\332*R/\254\341\026\177\266\f\2751\030\004[\005z\301J\262\003Be\314\305\3607\207c=\f\267\034\264\344\274Q\311{\257\020\337\b\266\032\2246\016\025V\222\332\376=\177n\300\322w\3032\255&X%oc\231\330/\023\316\366\303K"
+	.string	"{}\007\234\215\341\205(\361"
+	.string	"p1j\001\370\242\034\333\364-ZJ\330\360\264,Ah9"
+	.ascii	"\341\201\370\361\371q\033\374\314\207\315\346\213c\361+'\264"
+	.ascii	"=\215DN\342{j\260\322\363\305\006|\254I\342\007x\300\303\234"
+	.ascii	"\311\363\215\266\005\3665\342\273US\252IE|\221\207),38\203\210"
+	.ascii	"\037`k\365rv6\025w^\n\313\3548h\224~\272\323\371\235\007B\013"
+	.ascii	"b\345NX"
+	.string	"\2467\321\371\216\003:\333;r@\032\327\035\361\225|\374\234\337i\222\2711a\235\270\216\377{rM\234\317\371\242+7\017\342q\276\203@Q\362?\016\3617O\200_S\232%\013\025\\\022\342\037\314V\023\304\033\253\210^\216\020\251\200}k=\214\202\261\353\203a\330E\t\267\355\003Tko\231W\305c\232\333&\307b\235\032m\351Wk\313\274?\233\026\274\212\205\372\201&Q\321\236\356\214o\363\252[S\032\032\316\314F\261D\274\237\214\337_\260\224\036\211+`R\200\342\026\321A\370\3123]\363\306g\261\346\201T\334\210\027)\276g\241\312\300Ml\207^\231M\315hoZe\301\326_\340\326\204O\245\200\346\341\250 \353\204\031\004\360\341\023\213\260G\242\214\222\304\027\362p\027v\270\020\207b\251\270\212\275\362\253\265\325\341\033\345b\360'\226\351$\374\306\262\325\264\"r\340\007\237\231U\262K\230<H/|\204"
+	.ascii	"\302\216#\034@\027>>\320\301\003\307\352c\002\037$\3508:\372"
+	.ascii	"\221C\310\037p@\203\200\0309:\360\200\350\350\201\016\017x\350"
+	.ascii	"\330q\201\217\022\204\234\203\b\205\036<:\370\201\303\204\022"
+	.ascii	"@(\352\261\243\210\204\035\034\214P\224\343\310\204\"\"\036\356"
+	.ascii	"Q\202\216\243\"\037=z\034\025\021\235I\235\364J7W\314\326n\364"
+	.ascii	"\016\255\331\306/9\225\375\375\324\230\265P\242wjE\2636-z\267"
+	.ascii	"ee\306\275e\335h\001\305\313\316'\306\033y \233\373\257\007C"
+	.ascii	"n\341\356bd\213\\[[[\215\361mf\313\210\006\353[\217\211\351U"
+	.ascii	"\254\235\254TY\365\274\262i\340\326\004t\312\3202\317\310\313"
+	.ascii	"S\005.$T\360\251\035\341\264,`-\317+Y\250a\374\317\035\331[\024"
+	.ascii	"n\203P`|\272\203\215W\026#\275\030\361\274\214S\210/\300\265"
+	.ascii	"\221\210^\332\024\331\2100M\270u.\313.w\203\346\r\251\f\253\210"
+	.ascii	"\334\340\332Z\257\204\232\031\371\345\227p;\003*\203\006n@\256"
+	.ascii	",\371\300j\200\201\322'\342\305\273\236\022\026I\353\305\033"
+	.ascii	"\320@=|i\331\371 \355\342]\217\314-\006\244\037\226\213\357Q"
+	.ascii	"\241|^\352\016PJt\212\236\350{\322\274\325W\025}\332n\265x\242"
+	.ascii	"/\300m\350Y|\013\241\037\372\032\355S\261P\217D\210\305\333\020"
+	.ascii	"\361\036:2N\307W\362\\\257\370\035\031\310\344\276\b\213\024"
+	.ascii	"|\030V\274\247\221k\022\305V\277\341\337\233[\017\335\326\302"
+	.ascii	"\270\310r\300\374\024\267]\346\211\344E\255{}\366I\326\251\315"
+	.ascii	"~H\333\247\342\241X(\237\027\222\372\245x\025\257\242\245\370"
+	.ascii	"^\343\213\362D"
+	.ascii	"\361NH?\235g\341\304\243\370\224\3143!\375~\351\304\353\264\013"
+	.ascii	"fju\321\273\t\234\273\f\031\006)"
+	.string	"\306\331\306\342\310\374E\306\375\245\361\023K\345\234/\212f\317\331\230\303\036<\017\351\007\0045\343xH\037z\272\214\221v~\207\304\313Y\336{g\264\312^\347v\3103\310\201\374\250a<\351\230B#\"\"\"I\n\2224\006\261\005\204\020\305\234+\363\022\300s=J\243L\221Q\243I\n\245\2555\242\264\032zb\275\210\247\262 I\022o\373J\274\273\216\\\312A\3526\251\\rq2O\253\022\375\370\313\214\224\304\355]\377\343#\375\236\323F\357\313\341n\256?\2601\233\366\b\275\213\320\234\356\240*\315\261Nr\215\317#\334\271\345E>c\243Hl\266\324\332\230Z\001\314\007\177\232e\003\314\035\371X\267\023^h\227\177\t\340\f\003\240$\261(\352\250\233i(N$t\177\346UC\036\0169$-\177\216\335\026\355\337p\330q\3715\371i\3460\355<R\323\035\026\201\271\263\212\266\035\222R\310I\344\317\267\210"
+	.string	"1\\\234G\023\330\324"
+	.string	"\264v\224\356\\\311LR\332\364\027\354\336\006i\021\031\035\253y@\337\006\276d\027\314.\253G%\261\034;Y\207h\220K\262f\365b\235\035\341LX\233\025\361p+=\342\345T\020\265\364N\002\032D So\301\371\356\302\330\306\221'z\r\024\226\321\002\270CX\177|\232\200\241\374"
+	.ascii	"\226<D\t\3448\270Kb\276H^}\027\020\253g\270=\036\021\312L\371"
+	.ascii	"\212Ua\0330\207\230\357\302\361\373\"\0011%\033\244\245(\317"
+	.ascii	"K{Y|/\023\351\371~\276\320\213\032b\331\221\026\217\311\326\260"
+	.ascii	"\307@82\244L?5_P`\315\224r\335'R\204A\224\324Q\214B7\247\256"
+	.ascii	"\305\247@T\357\300#\036\367b\357\346\260/\310\271\310\346-\364"
+	.ascii	"\332B\365x!\027deIa\354WT\225\f\266\234<\275\331\254eag\274\265"
+	.ascii	"\221"
+	.string	"\262B)I\325$\222\331T,\317=E\007\t\233\n{\313e\366\334\246\241\374\367\367OG\273\250\302fi(\304`\350\003\376\246\245\317\013?\372Fvi\004\367\230[\254\fV\203W|\310\200\230\264X\265\272_'5y\270,\2570\314/\240\277\202\220\241u]\301q\200\226T^\326\003\24766\022\b\367\244\222f\3550\003\256\254\353\013\270\240P`\316Z\3116?\261\223\251\221\200\221f\346\211\356E;\351\342\b\354?\234\330\005:a\206\334\036\304\343{[\322\265u\343q\227\355\024\216\020i\235\273\024!\317c\371\301\235.\217\345\30202K\207gm\037c\005Z'\341\315i\b\266\203\n4km\310|\r\306~R\007x\225p\252\237W<B\334\250u\241\022\025\202u\264\bE\215\344\210\262\305\270cC\003W\274B\2314A\300\234`\275v\204\017\364\227}~/\317r\243-PUTf\026\031\0239\336"
+	.string	"\320\032\tZ\331\237\324\021R\023Dzu\020\202\225\210.\324Z\273q\266 \231\310\203=d\003\367\006W\261\2533\342\267A_!\236v\274\357\360u\241M\326\306\230\355\353Z\362h\003D^EC\241\361\363\022\022\bS\345Q\334\253\020\240\030Q\035\357\201{o.\240\267ID\275\375s\001ao~@\266\311,\320\342\213\246\257\016\356/\227\232\242\264t\250\257\213"
+	.ascii	"\273.\343\256Q\b>\340\"\327y|\027f\330\305\020a]pr\207}\324<"
+	.ascii	"z\\>dw\347j\030\240J\256$e\321a~\022\344\2634\261h\356\236\034"
+	.ascii	" 6\203\351\340%<\007H\217\214\204\341\036\304\032\202\372\266"
+	.ascii	"\374\263\312p$i\202\007P\023W\341\345\022\200\347E?+ k\214$\325"
+	.ascii	"Qh\232\365'Q\211\334\367|S\347\313T\372\363\324K#\372\030=V\343"
+	.ascii	"WYR32\235*\357O\017\375\r?`b\362\230i\270\300\360\311\037"
+	.text
+	.section	.gnu.lto_gpsRestartUBLOX.83.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`\345"
+	.string	"\215\n"
+	.string	"vQB: \261\322\001\34026\002\032\353HU\320\240\335\240\262\347\213\320\233\322\r\001\2101\307\352\364\037\272k\325&W\211\r\"\356A@@(G\216\221\037\2236\274\002:\363\210\004\355\235R-"
+	.string	"2"
+	.string	"2"
+	.string	"+\035\266\337\261\312\206\271M\266\0025\032\306mfw+\345\270\352S\345\237\366\200\026\271\372\3440\354\256g\213\324\270\351m\027\330\366\330w\005 '\177fTj\276u\320O\205\007\td1\254\3713\002l\342XTx\273\235=\333\266\232t\303\376fi\314\346\2402^.\362/.\273\257_\315\346\300\342o:\017\315\257e|\211\313\373d\267I\242\013?`\006\267)>\342rA\267\273\t~\310EH\376\354\240K&Sx\360\270\034ow"
+	.string	"\373)\364k\017\006},F\211\207R\003I\024Q\307P\235\b9\210\0254\"\325\317\200G\021\304\250V\214\343\250vl\373\315\322\230\001zd\216E/R\\^\006E\274\317\343\304\245\202I\035"
+	.string	"2\241%i`\\\300\301QP\030\310\002\f\204\314\346`\022\024\006Y\b1F\314\214\366pAU\205\001\301\250J'\207\270\206\0202W\031\334\252]T\326VU\223-\353\273\220\317\005;^\206"
+	.ascii	"\227n\321\316'"
+	.text
+	.section	.gnu.lto_gpsHandleUBLOX.84.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`\343"
+	.string	"\245\013"
+	.string	"\306\324M@\020S\224\016lX\300j\bN\214u\362\177@`\245\321\265\370i|\004W\3132\341\303\330\207J\3557B\365\351\006\364LU\203\340\262(\003"
+	.string	" F\"N\027O\212d\004\270R\017\022Y\262\245L)<"
+	.string	"7"
+	.string	":"
+	.string	"\271\371W\035@\347q\277\260\016\207\320\300\r\020\"\025\217\004-&\026\007\2127J\205\261\006\251T\361Dp@\212d\307U\317\f\336(\023D\301\356:;o\303=\271m\006\266/\366\027\004\331\262?.\025e\037\256\236\354\247\363\351c\002Nh\360.bc\267T\342cC.\031$l\337\276\212\315\246x\263u\374K-\201\02510\300\350\261\273QC|\373\0055\250\003\277fV\254Q\222\330\346\334\205i`\273\213\300o\361/\363E\3742\005-\337\375\362\265\311\257k\202\034,BYbP\211\017\350\003L\373\002(\337\271\200H9_Z\036pl\326`,d\0222\237\006Z\007B\3146q\302\306\001'j<Z\304X\234u\036xb\205,\363D\312\267\207\253'\254\225\"$\244\242k\243\312\33142c\004L\r`\342\305*B\352y<\177\240H\215\250\006\030"
+	.string	"3\241\275h\340\254\256\301\036\331X@\273>#\004\256NB!\260\017\030\006Y 1\324\304\335\200\031_\232i"
+	.ascii	"4\313\271M\235\r\2730\352\fV\217g\036B\223F\305T\024"
+	.text
+	.section	.gnu.lto_gpsHandleUBLOX.part.0.124.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`#"
+	.string	"]\007"
+	.string	"b\31505@o\222\016"
+	.string	"\253-'\211:S/WS\2046\257\027\213\227\233\214\257\337\032\177\363\201\302\250\235\0338\324\317\257\242h\370\303\337\356C\300\205\313F\206~k\233\310\024{:\026\027D\003\305B\b\364\360\256\317\223\3700D<\017\026z\235\202/\220\003\366&\256\013{\326\357J%\232\346l(0\031\250\201x\372+\207\255\330\374\005\206+i\203\r\034\335\226\355$&\335\346\3604R\245\022M\217N$!$\263\243\206&G\252\027\223\257&z\353j\331[\255\252\362\213<\316^\246+%I\240\271p\260\314d\346k\205$\315\212\216\312n\265\006\220J\243\242@\351\243n\240\024\200Bf\316\001\351U\177\204\377\340O\t\017"
+	.ascii	"B\023\030\027x\230\"\017\020\005\303\\\3412L\3309\003\350\f\320"
+	.ascii	"f\312N\003\300\265\027SN\313\351\327\2261"
+	.text
+	.section	.gnu.lto_.symbol_nodes.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`\025\006m\035"
+	.string	"\3461\272B`\250m\016\205\225\245\034\206\367+\356\034(e L\034/\r\336\201#\236\033D?\264\360~\177l\372\311v]%\023\177\\WUUUUUU$B\234`3\203\byp\246y\357\342\320\354\004\322N)\260"
+	.string	"\243"
+	.string	"\247"
+	.string	">\344\201\020\bA\234\312\366\002\022\241\374\221\273\217\217\334c\244\372\333\352\2219\240\251\252v\341\221\373\215\334\341@G\033\312\321\205J\034\275\247\274\221\233\217\215\316S\326\310\255\207Fn:3\032\2242r\337\211\221\333\016\t M\323\024F\356:\f4H\005\037\261\275\310\355E\272h\260\026\035\346\300\240\2267\026\271\305\310\025\025T4\240\024>\024O'$\230\230P\202\002\211\334x\310\021\026DH\205\310"
+	.string	"\242\375|\210\362\200\241\303\005\016P=6tY\202\r\345w\373\332\245\241Wv7R\252\252?\255\356\334\r\366\363?\036\217m\031r\177\221\335\215\023\020R\274\234\370\231\330\023?\201\326uB.g|\370wI\246\353H\207\322\262\024\300\217[\235\027'+\350\303\217$D\360I\356\222\201\307\t\317\002\317\264R8\177\300\373\304\373"
+	.string	"B%\336\357Z\177\242\232\360k\002\357\223Z\3575:X}\236x\357jX/\315\202_Z\351\311\253\325M+-,\247~g\344n\255/\002N\275\021\372w\253\371z/L\0364\t\375Or\017\235\344&6\311M\210Inw*\367\331\222\334fJr\277Ir\243!\311\375\347Hn2#\271\003\025\311-\310\323_\332\315t$\222{Pj\352\022~\035\242\326\225\354\244]D\325wa^g\256\320\311\342\333e"
+	.ascii	"\277\216\253u\001x"
+	.string	"\252\252|\370uX\254\243i~\332N\374:*\327M*p\304\334X\317\035\331\314\270\256\347\322\336\320N\374JnX\317Q\335\t;\272\216\333\303.R\304:9f4r\271nZAT\345\304\377V\254\233T~kE\327s\306G\206\324X\317\241\201y\267\\\317\215\331B<\361\223iX\307\301\031Df\\\335\274\"h\350\303\357n\256\233X\330R\"\353\346\317*\216\033\327M1\215\262N\374\316\262nn\025\203'\376)\327\223\310\004\215$t\262\214\24316\n\232\336U\264\351?\360\232>\204\005\005\357j\253;\265y\323V\001}w\201\336baZC\037\372\316%\364f$\326e\016F\337\257\200~ \321\231\0254m\017}\247rO\364\243\254\216\277\352\024}\350C\201B\377\311\222\026H\353M\250\255\350\245\207>\006\372\202\364\013X\017\375\245\325[\217\031U\033\205>\001\240\024\372\003V\347\255\311y\203B?"
+	.string	"\320\033\224\035\033\371\320\337\001\275\207i\206k\242\320\337U\275nf\251_\257QE\200_Wl\035"
+	.string	"Y\326\024\267\327ueW\357\333\303\257\013k\250!\020\215\241\316X\220\224\224\026T\332\360\002\271\251\351\021\340,\250\321H \"\221HP\330\016`a\253\277\374\262\330*\313L\222\325\362\352F\252\226\272\340B\302\345\243\237\214\007\252\364m\002\003<\f\360X\"L\200@>\023\301\b\024\013\025\242t\240\025u\343\206\026\365\222K\332st2\234_\343o3\301\225\312\261\235Lw\341l\036\245\263y_\370\261k\"9\223\017X\345\230\271\232.\361\200,G\375\223F\022\036\003\306\330"
+	.ascii	"\327\262\246cS\"\207$Z\206\365\036\002\272\353\221rM\344y7\257"
+	.ascii	"\205x\2762+\020\321\300\316\002\354\312b\346\346z\025\325\376"
+	.ascii	"[\005\243~h\006\233w/\353\353\311\005\252\001"
+	.text
+	.section	.gnu.lto_.refs.516425ac3a7cf03,"e",@progbits
+	.string	"(\265/\375`\264\007]!"
+	.string	"\272@\270\fD\240^I\206\003\320*\375K\330Ovv\2079W\255i\231\274\2410\321#cM\342\251&O\333\b\257\303\353\360:\274\016\257\303\353\360:\274\022\246\223\323\332i\021\3350\363\377\331l[hA\"i\2555\262e\n\277"
+	.string	"\243"
+	.string	"\306"
+	.string	"P\262\227OE\210\b\371\001v\331\303\347%\017\035\340\313\033=]:\311\370\272\204!\345\262\005\355en\326\245\nY\227(L\220\b\261\004B\311\003\007\257\313\244\260<xv_v\346\310\201\343\206K\r\232-2ZY`\276\\Ym\321r\245\312T\224'RQK\224 \201z*\022\353\255\341$\003\206\213\246\334\212\024(L\224\030!\202i\351\203\327\253$\277I`\263\376\356\253\216WW\2347m\330\2449\263%&K\367\305\213\327\347\022\353;\221\277\224|\r^\267\020\353\t\344#\311?\222\365\321\353\004b_\344u\"\257\017\311\027\362z\220\374\232\327C\371>^\007\345\177^\247\311\227\375\361\374\027$K\230\375\301|\007\263\017\230\362\236\371\264\331e\263\001\302\021|o4\324\211\276\307}_\303u\032n\241\331M\001\364=q\273}E\334z\231n\266\257\207\2607)\fl\007\324\267CG\316\2335h\312"
+	.string	"\370\307h\331\3760\265>\230\332\217e\005\240\277%\354k\271\365\261\334~*A\375\251\240\037\212\315V\353\033j\237!\354\025\202\272\004[\207`\373\007\265\356\240\366\r\302\276\240]\201\255#\331\036A\255\037\250\275Q\330\013\330:\201Z/\242u\242\260\343\302~\013{\030v\037\240\036\013\377\231\260\214b\222d\3662-\232r#\300\217}"
+	.ascii	"\333}\325\361\352Z\263\245\303\272\262\252\242\232r\002\365d"
+	.ascii	"\204\210\020 8\300\367h\210\335k\312\251@\341y\036\362xu\305"
+	.ascii	"y\323\206\r\0310UTY\256T\231\322\004\211\020 >\346\216\0342X"
+	.ascii	"\210S\004\323T\002\373\276w>7f\312\214\321\312\322m\261\362D"
+	.ascii	"*jI\022\250 <\304^\247\0311^\314\336\026s\202\337%q\356\276\352"
+	.ascii	"xq\201\242\016\353\312\252j\366\251\200b\2770{\205\331'\314\036"
+	.ascii	"\241\b\3007 v\240\357i\342\005:\204@l\334\354B\003\3766\273m"
+	.ascii	"v\240\331\177\276\213@\001\263\177f\007g\377f\237\315\036\233"
+	.ascii	"]\316\022\315^\n\354\033|\272\206\371\030\246\374\302\367\024"
+	.ascii	"\346\001\377\215?\303\325\306\036\216\275\247{CE\222]\252\241"
+	.ascii	"\241\257\024%\342\267\b\020\037b\257\016\0345\306\361\373\"\227"
+	.ascii	"b\354=1~\275L\035&\236;\037\027\2335j\266\276\361;\372\257\214"
+	.ascii	"\376.UT_?\313\367W\2212\376M\306\236a\354\027\306\376\340{\006"
+	.ascii	"cO\360=\322\201\217\216~4z\361\353\363\373\333\330\177\276\247"
+	.ascii	"\215\033\220\360\254)'\366\331\211\021\342\317\226\300\237q\b"
+	.ascii	"\003\353\352y\031\034\2564\342\313\266\302\350\260\260LE)\371"
+	.ascii	"^v$H\216\0336\234f\304X\001\276\254\204\330eJ\035\222\302\300"
+	.ascii	"vr\270\312\214\321\312\322ai\241\"\025\265$\t\324\323\017\035"
+	.ascii	"b\217\315\210\361\"\201\037\2501\270\023\t)H\313H%\255\001\201"
+	.ascii	"F\210\210\244n\021\320\2535\355\031d\250\200\344IM5\377n/\222"
+	.ascii	"x)e9\365\317\2700\316\270\177\203\364hY\364\205\237o\333\247"
+	.ascii	"DB\210\324\361\013aC\364;{&\363\217\342~\002^j\b\225\374\303"
+	.ascii	"\237\b\254\353&\202{hS\306\033\\\033\370\272\006\204\t0\356\226"
+	.ascii	"\254WV\262\360\301\007V\3445-\013\2732\017%\017\357\364\350\001"
+	.ascii	"\002\306\302\374\n\266\fqm\212\305NMp\251\277\2014[\216[\367"
+	.ascii	"j-^\230\034]\365tSX\347\ff0[\337\305\377~\037\310S\241\216Ee"
+	.ascii	"V\235J9\320\030\262\037\262\033\352\034\232\372\3302\006V\303"
+	.ascii	"\332\2040\202\024\321\353\243.\031\335\b\026\023XNO\201I\202"
+	.ascii	"\321\371|\035\022\rR\342\200Q&\002\266\221\265\325\272\n\370"
+	.ascii	"\n8Q\fB\274\372h\036L0\b\313k*\031J1\240*"
+	.text
+	.section	.gnu.lto_.decls.516425ac3a7cf03,"e",@progbits
+	.ascii	"(\265/\375`\336_\025\214\001\332\231f\217U LQ:\215\001t\032\300"
+	.ascii	"\006\326\375&\026\204+\254\240\252\177\305\n\f\017\225\023=\016"
+	.ascii	"\365\233\370\256\027\335\207\202\212\314\262+\023Y\267U\320@"
+	.ascii	"a\324*\333D\316\341\327\034\346\366:JQ\352\267+\303\231\301>"
+	.ascii	"\356\274\023\213\366?\345\336t\367u\223[n)\245L\001\223\007\371"
+	.ascii	"\bF\t\332\2035\375[\246\177\303\364/\227~r(\377ni\263\253\022"
+	.ascii	"\345o\251C\331J\371\301aD\t\025\213\177\253t\322\352\250t7\311"
+	.ascii	"\246\247\322\254\226\266kG]\225MZ\257\027K\233t\261|b\321l\024"
+	.ascii	"\013\305\236U\245M\376\326\206\335J\332/kv\317\216\025\230\202"
+	.ascii	"\261\334{\177\340q\203\203\214\213\017\376m\217[\263\337\342"
+	.ascii	"\2609\254\023\333\025\304e\306\314\224\305\266\214\347I\235\024"
+	.ascii	"\033\026\337\276\321\267]atz\3105H!t\2206\211]b\311,\023\213"
+	.ascii	"\304*\261Gl\223\252\264c\277-R\345,\227\035\263>l\020\251:kb"
+	.ascii	"yH;f\215\364\3502\204n\216\035\263Dz\260Y\356\235\254NklO\032"
+	.string	"\360\355\032\355s\247o\351\364\255\030}\333E\337j\321\267W\264\375a\301\252\262\203\005\322\006\f\n\313\342[\2456\301\336\265C\256{{\265C\276=\323\226\207\321m\217|gN\225\232\305AL\364\355\021}\373C{\250D\3716\207\366\240\022e\237]\211rMfi\237d%\312U\255\016e[\003MZ\2326\213o_\350\377\226\206\215\241*m\326o\235\354\323k2\313R\331+ '\241\275\277\354 \303\374\365-\313\036\355\214\233DF \312\235\345\336\233\303\207\0176\016\334\226(\031\377V\306\355\214\337FY)\033#\357\021yce\261\3052\272\225\321\023E\203\212\230\305\276:\224o\267\376\355\213\333\253\337\266\260S6\206U\263e\026\304bkea\334\306\260U\333\306 \321\265\367\223\215\021Tg\357\247\240Z5\250U\003\334\344\213\b\225\214_\365\264uat\373\002\210\211S\0161\2131\300\323uY\211r"
+	.ascii	"\352P>[%\312<u(\277\252\3216Y\211\262\207:\224\353\036\007\253"
+	.ascii	"#\254\255\312\342W0\272\276\271\tR\337\276\350\370\340\257op"
+	.ascii	"`\313;5\257\326\251vj\234*\247\322\251o*\234:\247*\253\336_\267"
+	.ascii	"T\267\343\344\253\334oT\365\352\230J\007\364$\264\243\246p\264"
+	.ascii	"\261\261\\\373\353\233\027 a\304\344@\306\351U0g\332\017\256"
+	.ascii	":5\025\357\236\035uZ\332\326r\357\344k\331o\364\252W\355j\032"
+	.ascii	"\240(\241\035\365\343\006\362\003\207\017\031\212\22746\024\340"
+	.ascii	"\327.\3725\213\256k*\233\252\364P\227\311 \237\03179\324,~\235"
+	.ascii	"\242_=\344 \017\371\025M\3273\365\256*\357V\321\274\232\251u"
+	.ascii	"\367E%7\332\336;\250\002\351\342\004\304\342\3272\275b\357\275"
+	.ascii	"\353\335\362\271\267\267\267W\357\226_\227\350\f*Q\306u(W2u\256"
+	.ascii	"*9\250e\314\247\344N\356\235\f\262av\246D\261\370UL\277r"
+	.string	"\220\357\336^\345 \277\002\321\227\373\322_\352\320\317\333\322\257Y\372U\206\026\252C\231C%\312\257/t\355\252DyC\035\3125\013\007\037\030\025\230\223\3057\201\376\007W\252\032\220\223\320\206\252\313C\356\235\374\210\337\350\027\361A\305R\255T\265\233Dn\2509-\013\030C\247\024\223\267w\362\177m\253lUY\261\374\225J]{M\356\235\334{\177\370\300\001H\013\335\221,\343\237\3207\241\237\202\026\252D\331B1\253O\252\032\b\366\216\332{W\200\325$\021saq\215R\321\252\022\203\232v\021\037\374:A\331e{'\203~\3560\271\243g\361G\320>E\257R\256\001\312\376\340Z\277b\220\353^\305 \3273\243W(C\371\250\225\334j{\357 \237\027/\212\274\261\270\356\325\241|\253\205v%\312vW'\177%\253e\030\\*\253\256\255\266w2CP2\013\006\017\213\237\254DY\327\241\374_9\277\205"
+	.string	"^\300\177\211\344\377\374\375\227\210\227\324[\270\317\177z\340\277<H`Mp\236\377\024\301\177\315p\335\256\r\374O\333\340\277'\334`\005\204Y\r\374\367\016\213"
+	.string	"\206C\360a9\360\333\005\33458\001\034\374\227\005\036\034\254\b\"l\370o\007\030\204k\340?MH\341\277+`\022\377\025\001\036\361\337.X\204\026l\364\333\016L\331\344\001\360\237=A\277%A\b>\374\330\203\337\302P\00218\304\f\f\342\267\0378\300\217;\020\363[\271\337\216\371m\235\337\316\t\2570\002\376\253\341\277\006\370q\321\334oG\340\017\230\203\377\033\310\340\n\375\267\003l\200\236O\340?\033\360[\030~[\202\337\222\340\267,~;\202\021\376\233\001\234\301oC\360W\267\377j6\305\t\260"
+	.string	"\376\227\301\001\370\357\006T\334\364\034\\P\324\340\317tg\373k\227\377Y\352\206\277\002\375\366\003i\265\002\214A\025\376\365\004\177-\301_\223\376\312\364\327\021\374\325\370W\342_Y\374\025\206\277\256\370\253\b\376\352\302_\321\277\246\177u\372+\t\376\232\342\257\303\277\356\277*\3755\370\327,\177\205\372\355\320_\353\376\273\371k\231\377r\376j\367_\357\257w\377\353\374\325\314\1778\177=\363?\316_\351~K\200\277\246\371?\347\277\235\277\306\375\337\263\035~[\301_\261\376\372\342\267\031\374\025\316_c\374\326\303_\251~\373\341\257\007\370k\325_\275\374u\306o\007P}\374V"
+	.string	"\177%\362\327#\177\365\372\353\333_\223\3745\371W\263\277r\371+\332\177Q\030\340\267\331n\370m\001~K\364\333\003\374\025\313o7X\303\027\374\325J\275\363\327*\177\265\363\327)\177\255\363[\r~[\377\353\001\f\200\277R\371\217\346\257p\177m\373\353\227\377\246p7P\177,\346 \r[`{\376[\375\271H\232\377\313\377j\375\327\006&\372\355\335o\327\374V\315o\317\374\326\316o\227\267"
+	.ascii	"6\003\347\340\277\027\374\267\203{\370\317\016\362~+\347\267"
+	.ascii	"s~\273\367[\2752\347\360\237\007\260w~\353\346\277\346\177\355"
+	.ascii	"\2177\374X\303;\374\247\006\377\215\302A?\006\372\361\317\217"
+	.ascii	"{\376\373c\263\374O\373\206\377\024\341\277B\253\345\277`~\314"
+	.ascii	"\203}\277\355\300\177U\300\372\277<\326\315\266\375v\313\177"
+	.ascii	"\357o\273\374\327\367\337\223\002I\003\374o!\355\031\374g\005"
+	.ascii	"\377/x\232\222\377\346\177.\375\327\204\037\237?\316?\266?\256"
+	.ascii	"\377\265\363\337:\377\317\377\314\300\177m\374\257\377\371\301"
+	.ascii	"\177\363\376\373\346\277l\376\213\346\277f\376[\346\277r\377"
+	.ascii	"\r\363\337\267\377n\371\357\225\377V\371\257\332\177\321\376"
+	.ascii	"{\366_\263\377\222\375W\354\277c\377U\362_\"\377\r\373/\220\377"
+	.ascii	"\372\370/\217\377z\375\267\353\277\\\377\305\361\337\255\377"
+	.ascii	"f\375\227\306\177\217\377\255\372\257\213\377N\375W\352\277O"
+	.ascii	"\377\335\377%\301\177a\370\357\212\377\252\370o\372\337\342\177"
+	.ascii	"\207\377\025\3767\004\377U\372o\212\377\"\375\027\305\177A\360"
+	.ascii	"\337\017\374w\003\377\325\300\177K\370\257\t\377m\300\177\035"
+	.ascii	"\360\337\023\377e\341\267\303\337\032\377k\201\377\"\340\277"
+	.ascii	"\372\277+\3746\371_\025\376\267\360\333\021\374\026\002\277\035"
+	.ascii	"\361\277\314\177y\376K\201\337*\377+\201\277\016\375U\303_\267"
+	.ascii	"\3747\205\277V\360?\355\277'\3747\002\377-\361\337\021\376\373"
+	.ascii	"\200\377*\340\277!\3747\001\377\005\341\277\037\374\227\304\177"
+	.ascii	"G\374\267\203\377\206\370/\210\377\376\374\327\347\277=\277="
+	.ascii	"\373\255\t~"
+	.string	"\353\302o\201\277\365\340\267!~\013\342\267\035\374\026\001\277-\372\177\342\257`\376\227\375O\377\177\371\277aooo\357\357!\361\377h\375(\330u\310\255\255\265*\023+\204\026G\337U\224 \313:\032\\e3t eT<0d\035\216+\033\246V\b-\216\276\252\271\033\313\0336r\230]s0L\244\331\243\312\207\031$\204\026G\337\f(\027k/\256&\204\026G_\213\271!cT\266\351\"\204\026G\237\214\271!1T\274(9\226\346\021\323\210\211\30443\311\3142\323\211Y\304\0243\231\230O\3141\263\211\271\304$b*1\223T\245\211\304Qn\206\231B\316A\316D\232;L\036PVH3\313\324\272"
+	.ascii	"\212j?y1\340\310\231\036\027\226*\022\244\314\006\370A8t\276"
+	.ascii	"\234\031\004\210\332Y\232;l\244\016\013\021\213M0\363G6\233\003"
+	.ascii	"\203\263\370AU\372AQ\372@s4>2\345\013\357\313\364\302a\206\314"
+	.ascii	"\205\305\007Z\243\017tF\3630qB\267g\261\251\303\344\002\252r"
+	.ascii	"\303\203\214\305\007\372\242\017\244E\037\210\212>\220\023} "
+	.ascii	"\244>\320\017\375\233Zf\r$\021(j\344\202|\356\220\315\355\260"
+	.ascii	"\370@\\\372@X\372@Q\372?r\364\177\356\256\314c\f,\245E\013X\333"
+	.ascii	"U\214L\306\311V\302\270\031#h\310\2251<,6\255*]\317\336\2258"
+	.ascii	"7\245\376\317\022\223\n\210\254G\0242\213\377cC\277*\315)\263"
+	.ascii	"\005\035\256\037I\251\233-\276\306g_p\235\356\220(-6\237\314"
+	.ascii	"\250\377\276\021OF\224\026\377f\224\t\365"
+	.string	"\302\311\033,I\237\253\253\260.\213M\247\273\375\367\325$1\254\264\261\370p\256\346\277\257\247K\220\2570\026\377\307\305^\2355ZW_,\256\203\227\370M\b-\216\276)\250\252%\234\273U95\023\346^\350\341;\330\016\246S\225\270\016\226s\234\207\347\250\301l\346\254\226up\234\273]P\004\253N+o\357\315\344K\215-\036\\\223\225(s\250C\371>p\372>n\372>T4\306\303m\252\362_\260\233'\203\200\316HYs\304\342\373\234\351\327\177\311'\250\377\222\357\263\004\257\t\352\002G\007\233\305\367\t\323\367\331\241\177\234\346\356\311\334S\224\305\257rsB\220h\360\031\\\207\355\252\022\337U)\023\206\304w\330L\245\003r\207\351*\336\005v\370\312\364(\003\207\007\337g\206\276\217\225\276\017\224~\217\034\375c2]\254W\236\221'\213_\353\222\254A\032\301H\200|{{\261A\332c\305\003\243\206\255\\"
+	.ascii	"E\205B\036\034\024\234v\001\024\025\no_\230\234Y\342.x\214\001"
+	.ascii	"M\356\226`$UN\255DY\232\245\023\\V\345\324Jp\261\353\202\257"
+	.ascii	"`-\027@Q\241\320\306\313R\016\217\301n\030\016\177\301q\330\013"
+	.ascii	"\346\202\305`08\f~\253J\334\345\267kx\3139\230\341\263*\247V"
+	.ascii	"\202ML\027\254\004#9\255\264\231\275\311\273kv\314\265Y\2001"
+	.ascii	"\326\222eo\212l\211\305mV\354\216\013\233+l\030\213/k\211\031"
+	.ascii	"*\026\277\007\212~\317\230\376\261\225*e\304\344(\263x-\271\301"
+	.ascii	"\220\\\331\260\370=@4\025<\345'\253E\2234\213\337\263\245\337"
+	.ascii	"\003C\3778M\371\026"
+	.string	"\343K\230\305R\360\326\332\026/\026\277g\353\377U\211\321p\224\377\233\253\307V\235\033}\0364Op\322\352\241\305p!\367\004N\237\247\212n\202\311z\300\274\316\274\260\370<fMx\204\350\363\344\320\347\251\322\367\315\321\367\241\301G\220z\244m\261\370>2\372\2767\375\343\"\036~\346\230\201\032Cv8\227\264\351\360AD\312\214\002\327\344I\314\352$\343\362\2456\204\003\035\245e\255\314\342\037\013\301`W\r\217\253\2516Vl\244hI\375\326\r\317\006\351\001c\211y\340/\034\004\367\300@p\030\336\201u`/\334\205\177`\037U\211\3010\216\343\034\230\013\fG\341\251{v\324T\242\330\301`V\fgU9-sNoy\265\304`\265\315Us\223l\022\220\302\261d\303`w\315\026\006\273y\370\351\236\035%@G\265\264non\034\240'\241\275{\274@b0\f5w\007\203]97\016\320Sr;Y"
+	.string	"k\237VQ\240$\261"
+	.string	"_\271J\224\031P\207\362}J\375Zw\365"
+	.ascii	"\247.G\274\257\345\230\214\266\257\345\030\326\230\257\345\330"
+	.ascii	"\214\006\234}-\3070\r\034\003\276\201\267\260\026\266\201kT%"
+	.ascii	"\316\3721\225\215{\355\212\201\365\265\034\303Y\330\005\266\002"
+	.ascii	"rJ\356\253\007\354\370Z\216\355\235\374\300\203c#\261!\204\357"
+	.ascii	"#\323\367\211\351\373\276\364}6\364}G}\337\224\306V\026Wa\030"
+	.ascii	"U\211\255\360\213\213\370\340>Q\330\n\357\375T\253\006@\265j"
+	.ascii	"`\272\ry\212\222\361}N\372Z\216>\353P\306-l\f\273\027g,\276\276"
+	.ascii	"\303R\307P\272~\356S\026\030,\026_\223\321\327_\260\223\017"
+	.string	"\f\"u\332X|mE\377\277{\327\316\275S\225x_\275:`\220t\276\276\324\341}\347\3244@Q\311\215\265\200\263\257\345\330\207\272\346C\310\033\215\257\221\350k\037\372\332K_s\351\353-}-C\377\027\316o\234\377\272\261\\6H=el9\313bq\245b\364\013\347\262qiQ\307\342\353*\235\353P\376\271\247\177\266\321?\327\350\237w\372'\235N3&\305\314\322\342\237p\372\265\356\216\001\202\\\233\313\201\354\222\373\n\273sD\226{'\215\312\324/\035\313[&\312\215\345\336\3112WLU\253rZ\333\t\217D\022\266;\307<\273Kw\317\\4\267\356\336]3Uy\313\\2\2677\316\223,K!\374\223\211\3769D\377\374\241\177\352\320?k\350\377\206\271q\035\364\240b\260\270n\251n7\256r\261\373\236\035'\020V\205\313}\273`\256\333\335r\265\\\270\353\345v\271_\252\362\306\335\270\253v\263"
+	.ascii	"E\t\355\035\346\004y\343\356\324\245\241v\343n\215\253\344\236"
+	.ascii	"\035'\260\366$\256V\251Zn\022\251_\204Y\271qw\354J\271gG\337"
+	.ascii	"Z\225\331\215\253\311:\345&\221'\204]\271q\026\312j\335$R\002"
+	.ascii	"ak7\316\336\260\312{v\234@\025\225\033g\247\334(\240\250\344"
+	.ascii	"v\342\t\2332\225\225\267\367\376\320!\250\206\335\2164\n\360"
+	.ascii	"m\3231x\271bg\361O*\375Z\306E\313\013\214e]\227\253\267\030#"
+	.ascii	"^|\251BN\261pV\310\2757\333\275r\255\\,\227\312]\273U\252\362"
+	.ascii	"N\371\257\362\246E\331\260-2\304\204\360O']\345*Q\276\240\016"
+	.ascii	"\345\213\306\341$\242&K\317\342\3476\372\226\3536\321\261\274"
+	.ascii	"L\200,\273\254\030\256eYm\203\303\312\321\345(\273Z`e\227,\210"
+	.ascii	"\223\013\345\232\335(\367\354>\271\311\252\274w\311qr\357*{o"
+	.ascii	"\0367euX\204\3603\032\375\334E?K\321\317f\272\356J\224o\222;"
+	.ascii	"59@,~\036\242\3054\301a\266\274D.\362\212\335\0377\310\365q{"
+	.ascii	"\334!\367\310-r\301n\330Er\277.\220\313\343\n\251\312k\344\277"
+	.ascii	"1\334\254\034N\342,\030+\313\353uei\335\256\026]\225\033O\226"
+	.ascii	"Fj\033\261\245\016\262\245\233\021{\205\312\355\032\343*[\272"
+	.ascii	"]#\266\212\2245\033S\220[j\310k\344\356\350A\344\032\261rL\352"
+	.ascii	"W\214-L6\300\317`\372\231K?\333\320\3172\364s\225~\216\3227\331"
+	.ascii	"\350\233b\364M,\372\346\023}\223L\3374\242oW%\312$\352P\2763"
+	.ascii	"\332\304\031Cb\361\315/\235\245\307}qc\\\027\327\352\302\270"
+	.ascii	"2n\325\275\272\307\252\274X\377\225\272-\216k\033\270\272-_\226"
+	.ascii	"\366\312\231K\325#L}k\223\"FKM\323"
+	.string	"#n\351f\245\342I\271[\356\235\274X\026\213\035r\357\375\201\203=Z\245\331\262\001\337\334\3227gh\333U\211\362\006u(_\250z\303\fR\314\342\233S\232M\313\027d}\373RE\312K\231\233\227+H2pdH\313f\267\300!\305\214-\345\270x\261kU\316 \335l\2277\243\252\306\fyE\f\222Nli\331\262\304-\367\336u\f\221%W\030*\365\315\256\305\201a\202\334;iT\3358A\356\235\254opV\226vM\307\335\262\332=A\256a\t\263\264T\350\354\034\232\245\234\032\262\276\321Y1S\220t\365K\023\353\366\206\005i\331\332j\232\037`\226{\357\377\026\215]c\351\3302V\216Mc\315X8\367\311\332\261zv\216\255\263{\226\315u\262m\254\033{\306\336Y56\317.\357\266w\254\235\305\263u\354\033\033\247*-\335o\323\254\232]\263t\326J\305\263C\356\235\3049\220\300\025q"
+	.ascii	">\266\243\257V\211\362\337\336\350\3433\372X\214>\336\242C\250"
+	.ascii	"D\371\230\212>>\323\307b\372x\207>\206\241\177\365t\006x\372"
+	.ascii	"\327N\377\212\321\277\\\002>p\232O.N\034\2654M\342\212\215"
+	.string	"\355\334\302\241\313\t\317\303\023,=.\037\214\035g[Z~n\251x>=\346\204|Y|8g\226\377>\237\244\323^\223\345l\363\265I\203&\n\b\352\006\362\207\021=b\356\312\225\263J\025JB\315\271@\356\255\345\341\004/u\332x\351\021V\250P9\253p\350rj\263A\221\035foN6;\250\004Y\373Y\245\322\371`t\325!\303\373\357\313a\256\352\320\261\370\035\260\364\210%E\377O\345\225\247Z\205\262\257\352\217\271\037M\362\366\326\362\220s<\225II\373\251\346V\345 y\023\004\355\277/h\211^\225\031:\335\001\221\242\237Q\242\234hM\200\354\\M\201\203\226EwpW\3643\231<\317\326\316\332\252\300\234\235i\020SE?\23589\315\260\320\216\002\202\005\271\217oEg\016#b\314\206h\020\310\242\237M\252\362lr\222\341\344\306\n\202y+\002\322\341v\205\354$\343\240C\2230\033\033k"
+	.string	"Ye+\313\223a\3619\\\351\004\330\025\0259\227\0249\225\324}\334[k_4^\246\262\306\266\226\226\007|l\202\204\314\342\377L\362S\211\236\343\241\244\205\305'\022\240#b\206\\Y|\036\251jX\310\346\354\260\3704\222a\314\230\321E\304\342\303\3110\376\373.\22428O,~\005w\364\207\f9\245\362\3365\331uu\334ZG\017$\226\210\235DN\261SJ;qpBE\313\203\251E\245\n\034\213_\001\033\375\n\274\350\013\236\204U\345\031\226\225($\267S\317\327V\005j:\b\256\350'\030\330\t\004\205\256-\203\001G\332\350\261\345\355\215\243H\373\220:\343\344\264Q\225\311([,~\005>4"
+	.ascii	"\222\024\375\364Q\225\247\217\374\004C\331N<l\316\314\336\230"
+	.ascii	"zb^\230X\374\ndh\021=x\360\270\323$\244xy\335 Af\245E\213p\352"
+	.ascii	"\352\242 \211\376\240\214\213k\013\001I\330\200\351\004X\341"
+	.ascii	"\3001\344\n\0055\364\005<\264\264\316-\017\311\355\3243\027\203"
+	.ascii	"F\321i\303\372\270\332\214E\2618\271AkI\f\213O\001\225\006\241"
+	.ascii	"FV\326)E\004IG\203\300%C\306I\203\315\326\214\2374.\230 G\320"
+	.ascii	",>\034\374\344\210\226\017\213O\224F\203Pw\3028a\234G\241\r\245"
+	.ascii	"F\f\362\274\372y\304e\364^`\261\370\214\301\203\206\315\227,"
+	.ascii	"Dat\002\266\316\252\263\352\224\n\323#J\323\"`\024"
+	.string	"\375tq\272\310my\263\030c\002fI\264D\213\260QT\231\324sJyN\341:6\303\336OL\330\210\254\364\007.\316\2503\352\224\272\320\336\033jo.\034\0310\021sJ\231d\220\210Q\261\370\033\332\350\020PE?\237\316\247\2741\272\203\216\242\347;\257\312|\347\334(t=\035\311\240\213\323\327\362\264#\027\203\230\305y\257\312\020\034G\236X\374\rm\372\033\3244\b9E\317u\224\271N\245\263\311}\344\001\302fL\203H+z\246C\347\f\322\210\006AV\364\234\227g'D\203\320R\364\034'\016\266\362\340Ls\221f\251C\203\020S\364\374\346\215\232\r6\364\007c\226\313\334Fk;\341yp\304I\306{n\363\343fC\311\r\213\017\247\252\375\367\231_q\322`\261\370\033\250t\210#E\317k\326T\265*\264\241\316\330A\312\321!~\024=\247ISg*+/\215\016\321\245\350\371\356.\306\030\r"
+	.ascii	"\033E\317v\257\312l\227\261p\200\262\235\200\260\3540{\243\345"
+	.ascii	"\256\314EY\374\2417\035\342F\321\263\0313zm:\304Z\321s\2312\330"
+	.ascii	"\212\303\276h\252\246\262\306\224:\304\223\242g2d\260\325YE5"
+	.ascii	"\246C\\\025=\313\311\321\t\242;\314(z\216S\346\270\034\006\205"
+	.ascii	"\256=\303\203\033\236V\221\257\f\006\226\035\2133\030\240.`\330"
+	.ascii	"\\X\374!-\375!,\r\002M\3213\334/\342\203\252\314pU\255&\367\025"
+	.ascii	"\217\2135\311\242\017\271\320 \274(\312n\231\313s\227\347.\371"
+	.ascii	"M\357\275\257\252Le\345m\255\243\207\374\206\255|E\216|YY|\r"
+	.ascii	"q\364_o\377\274e\230\311\315\006\345\223\377\372j\276z\370\177"
+	.ascii	"\352\255\003\370\217\177\023\303\344\216Z\203d\357]\337d8\257"
+	.ascii	"\032o2\330\377o\367v\352:f\240\332{\357\244\027V\006*4\257#U"
+	.ascii	"\224W\215J\205\346\205E\205\346\345d\251\342\236\260\216\333"
+	.ascii	"\313I\357.\254\035\265\267\246z\332\033\255\013+\003U\324\306"
+	.ascii	"\242B\333\307\236\244\327\336I/'\235|:\356\275\237*U\322\253"
+	.ascii	"\213*\312\013+\003U\224\027\326F\363\302\252Th\373\270\243\366"
+	.ascii	"Q\003\325\336X\033\315\013\257Rm\257#\025Z\027V\206-uc\310\013"
+	.ascii	"%uhT8;-I\260\250\242v\f\013\306\242\272\216rT\311\256\312\266"
+	.ascii	"\267\223Z\213}\254\311\275\275\366\306\321\245\001[\224\230\023"
+	.ascii	"\033\224\\\214S+\312\311\006\f\250\257._\022j\313Q!\351Rj\261"
+	.ascii	"\267\335\206A\302\251:%\367\336S\033\312\251\356\335\"y\334\033"
+	.ascii	"\252\013\004Z{\357\335U\313L\035\367\317\216z\262\202\372\352"
+	.ascii	"\362i\001\3255\265\221\354\250{\357\215E\205\366\325e\324\246"
+	.ascii	"DCn\250\244S\245\262\352\332\310m\347u\324hN\311M\265\367\256"
+	.ascii	"n~\344\\\241\313\263XK\224\034_,6\241\226ub\2608Y\217]8\254,"
+	.ascii	"\316l@\367\t\024:.\213\257!\212\316W\302x\215\311b\3615\024\321"
+	.ascii	"\036d\025=W\251\312\\%\273@Ah\3570&\310\036\372\317kv\206\324"
+	.ascii	"1N\312b\243#E\317\312<\345\306\241\220\334N.`\231\312\312\333"
+	.ascii	"\307c\3215\344\320\177V\263\221\246\364\201\202$#D\231\321|\272"
+	.ascii	"\336\270\200\221'\005\255\332!s\304\241E!\243\341CH\233^\222"
+	.ascii	"\030\240\344\263+L\306\310\236\317\360l\327\221\216-\nL\362\211"
+	.ascii	">\332y\262\245\354\371I6\263\372\206Y\026\034\331\211\232\260"
+	.ascii	"\266\036\026_\203\f]\315\030=\227\361\210se\204\254I\023&\270"
+	.ascii	"\311X\fK\376\005\033q\213\332\241dG\022,$Gx\222d\330\302\214"
+	.ascii	"<\037y\305\263@cYWg,\316E\214\236\215\330a\265\305`\261Y\207"
+	.ascii	"\362\237\2219\007\221,v*_(\345\304\206\364\324p\242"
+	.ascii	"\027\326\226\264\021\267\274\262\370\177\006\222\303\362\217"
+	.ascii	"\f\226{d\0379HUf!\030\013\256\273\302V\033,\031\363\265\314\353"
+	.ascii	"\312_\bX\202\365\265\314\313B2\217%x_\313<9\032\271F\031\362"
+	.ascii	"\230g\3149\251\303\221u4)\313B\262V\276Q\345\324\366\223\f\022"
+	.ascii	"K\212|-\363\366N\362\330q\202\245\024\302\3270\265#{}!\351\312"
+	.ascii	"1g\3072G\346\322C\244\304)\351r\304\345\255$$S\240T\261q\226"
+	.ascii	"\263\3142^\322\334,~\206#9\206 Y\3069\205lF\231\305\317\200#"
+	.ascii	"ce\230\241\237\001J\3779\206\215A\225\314P\243\210T\201\002\243"
+	.ascii	"\252\33190VP\331*\273\220\263#\r\314\342\354\242&\315\264\261"
+	.ascii	"evaR\311TUNk\027\021\231\312\032\253\312/\2522\273\370M5sJ\007"
+	.ascii	"\037\255(\247\273\214\363\024\024\232.,\026_H\216\276\345\222"
+	.ascii	"2\277d\250\213\206\224\300\327\234\334\"GUe\226\272\tg\252\231"
+	.ascii	"S^\223\233J\312\\3\337.\032R\002Py\313\312\205J\231\225q~\352"
+	.ascii	"\340SFj\310\234\305\027B\243\377\347m\3321\357\230{U\231\235"
+	.ascii	"\262\223\031\306\254s\223l'D\371\222\235j\322|\363\226\235L:"
+	.ascii	"\023\357\236\035}SQ\274,\263S\275b\226\271I\344\t_p\313\275w"
+	.ascii	"\207\017\037>|\340\331na\352x\260\251G5\206\343\312\342\013\221"
+	.ascii	"\321\037a\306\241RW\333T:\250*rL8ks\314<\223NU\232r\314!`1\236"
+	.ascii	"h|!0\372B^\364o\272\271\371\346f\223\037fB,6\333\030\335t\343"
+	.ascii	"\273\243E\316\316\342\005\324\241l.9\230X\220"
+	.string	"D--\276\020\233~]\253\023\373\300nH\032\363\214\032\023\215\311\306\\c\336U\245\231F\315\f\021\344\336\3114\346\016!\310\275\223\366\r\234\231\033>\370BJ}\241\244\276\320\230\276\220\230\276\020\020m\316\331\245\271\362d\361\205v\350\217\250V\312\220`\234 \327\304\230a\314\344\3141&\231\2524\305\374f\\\355\022\345Cd.\013\212\306\027\302\241/dC\337:\224/\204\245\177\323\313\357\343\001#\307\006\322\342\013\275\320f\227K\247\244\214\216\305\017\332\323\257uf\233\311\226f\211\305\256K\0254H+w\310\275\223f\233\231\334W\347\327\231\251\254<.\346\026S\213\231\305t\253J\263\3556i\306I#S\363\301\017\312\323\017Z\243\037TF?\bN?H\213~P\025\375 4\215\217\225(\037\212\362f\332oF1\321\252\032\b0\231^\223\"\026\233R\214n*\361Rj\206\034\213E\250C\371\262U\242\254"
+	.string	"(g&\216\256\235\345,9gJ\222\243\305R0\034[Cb\320XD1 \024\022\231zN8a\302\207\th\302\310\224\364\323\223\016\203\305\025zX\244LK&\244\301%\343\020Xl\301\030\004@\212\236\310\360\002\252\202\321\210\036\265\260B\212\23602%\021\245h\"\001M\203\305\f \001y2`DS\026$\254`a\203\t+\230\020\264B\005J\2400\f\002\213\251Q\350J T\f\211G(\023\013\002\244 b\204\324\bLq\376\204\304\243\025(\2324\030Q4\t\031\323 \212\337P\320R\223\321\205#T\351\350\207\246@$\246\246\237\020\220\007 \322\"\220\t\204\020i\bD\301\310\224D4\202\t&T"
+	.string	"\246\300\022ip\230\002R\023\020\205\0201X\201\321w\202\330\202\221)i\210\003\n0@\213M>BF\300\243\023@'F \341\204\t-\214\300\302\007\030\030A\005\264\330t\364\2034D\215\024\260@\002\242,,\241\306\240\337\207\026\204\304#b\332\241\210\246\303&\342\221P\3723\036\005Sc0\310\370\013B\001\374\271p\3643\323\037S\320\005\343\317\207\tM\215?\363\005T\005#S\222P\222q\351\2274\f\246A\340\013B<L\300#\036\235y~/\240\303\337\317\nt\370\223\346\337\251\201\nP\200\204\013\034\025\201+\030\231\2224\374(XD\207h\222>\t\020:"
+	.string	"!\204\025\347CP\200\007\n\360 ?\004\005\030\031)"
+	.ascii	"\004#}\020\214n\372C\213D%&\340\022z\"e\372I\213F\246\244\fH"
+	.ascii	"C\324\330\203\342w\242?\036c\n<1\f\232\370\255`dJ\372)\242HA"
+	.ascii	"\025\304\"\223F\177<(\022\321\204\021\210\302\250\321_\020\017"
+	.ascii	"\372\033\301\310\224\364\243\321_\t#S\322\217\020E\"\232\030"
+	.ascii	"\262@\322DT\030\024\002O@\215\027\b\372\255@\321\324\203\246"
+	.ascii	"\300\242\021\210.a\025\300\3415\002Q\030\177+P4i#4\thl2O\214"
+	.ascii	"@\302\211\025\300\245S\004\212D\\\032\002\217\214>#\020\205\021"
+	.ascii	"'\031\227~+P4\235h\n,b\244\240E\002\022\205,\200L'\322o\005\212"
+	.ascii	"&\036\2454i\210\n\263\221\bT\210b\t\210\026\231|\277$\343\222"
+	.ascii	"\017)\370K2.\345\"\212\004D\225\362\322y%\020!\214ETE\260\210"
+	.ascii	"$\202b\n+\212<\030\020B\205(\200-\250\310E4\230\"\230\016Q\244"
+	.ascii	" O\372C\221\210&\322\"\221\211\007E\".\341\364W\201\264Hd\372"
+	.ascii	"1\016\211\301\224\211x\242\320(\f\301\023(\f\301\023:\325E\037"
+	.ascii	"$ \212\2020\bl\241\210\246H\321D\302\212\324\247\230\256\300"
+	.ascii	"\201\007\230\002K\254(\002\025\323\025P\025A\364\be\001\003\027"
+	.ascii	"\216\200(\204B`\t\350\022\260\030\201\025\305\240+\2010\"\001"
+	.ascii	"\321\242RJL\211E\246\020ET\330\204\204*\035\03170\376\230|\350"
+	.ascii	"0(\304(\022\261\204a\261)E\213<\351\317x\001t)\330BZ\004\246"
+	.ascii	"F_\372\003\246B\264\004\272\024L{\320\245`\013,\200B\024\311"
+	.ascii	"\227\2260\026\211\305\"\232\215i\0231\0356\021KHQ\027\216\200"
+	.ascii	"L=W\002\201\246@\025\301\"\323\357\202\324\370\35312%\371R\343"
+	.ascii	"\017(5\376\322\"q\005!0XD\215>i\221\270\202\221)\351D\177F\246"
+	.ascii	"$\0364\005\246F\023\305\017\372CS \013HM@\022\214LI?+P\244a\n"
+	.ascii	"h\n,\"5\001I \246M\300\fLhz\")\230bH,\201\2306\001\201\214&\224"
+	.ascii	"\216\322\340\013'\320\024\230\236\240@j\004\n3\030M\240I@\243"
+	.ascii	"\0215\221\032\201\302\237\364g4\201.\005Sm4\2216\021\215?`\n"
+	.ascii	",q\302\310\224\224\001\230\002K\274\200\252`\004*\361\244@\024"
+	.ascii	"EZ\004\242(\030\231\222|LPA\210b\200\247\204\020\305\200/\th"
+	.ascii	"\302\204\025L\320B\"\221\204\237\211.\005[\360\241\277\b\030"
+	.ascii	"\231\222|P&\026-\254\b\2468S\340\211\245\246aN\257\004bC*\004"
+	.ascii	"^#\360\210H\001#S\322O\n\024\336!Qx\225\204\302\013L\201%\222"
+	.ascii	"\200Kg\t\023T\020\242*2\022\2122\235\350A\215\305&b\tH\303&b"
+	.ascii	"1\311G\211\t\275*\230\320\313DDR\302)\317\225@\240K\3014\304"
+	.ascii	"\220\270\264D<\n\n\205\301\245l\374\241K\301\026\320\024\210"
+	.ascii	"\364\3531\026\233\210J\246\021M\233\206\301\245\323\2104$\036"
+	.ascii	"\241\306SI(4\022\2312\272\024L\231\232\262\020\030L\207h\021"
+	.ascii	"M\221\"\2104\264\"\230\342\227\032\213\301\024?b\232!\013\211"
+	.ascii	"0\242E|\204\032\207?t)\230\372\\@\321\027\360\n\026\031i\304"
+	.ascii	"o\303\n\026,\322\340\021Q\210\252\370\301\360K\201\036\241AF"
+	.ascii	"\264x\207\304`\332$$\"\215@\207BTENU0\365\214@\231X\244\277\025"
+	.ascii	"\301\024\332\330\224\002S\343oE0\005\217\221\021"
+	.ascii	"M\203B!\232\002\215<IC\242\320\007\024"
+	.string	"j\244 \321\310\024\024\nQ\rB\343\322\017EjJ\203\251\020\350\223\016\2110\004\213D\245!!\360(\230\026Q\025\031\224\322\"q\350K\215@t\370\002\021\351\207\204\0165\222\b\215$\202\007\tE\231\214@,\216\200\305\246\243#\340/i\030D\002\242JB+T\240\304oH\f\246A#\221\311'U\301t\201~\024\030Q\026\212L\346P\351\350\"\005U\030\2611\t(La\262H\203B`\223\bN\342\360\350\252@\205\350\271\024\204\001\210\205\350p\bT::\225JXj\032\232\306$\2400\002B \n\2420\251G\004\022\252\242\210\032\321\242\217\230b\030Ta\314ET\305oH\\R\362\025\201JGxH\f\032\213(\006^0\372\212\250\212\237\n\340\360\267\002ES\020RP\bTa\242K\301\243\243\021R\234\376D\214H\207\301\2238\004\016q\372\003\301(\035\006\233t\021\210\262\300J\351\220\270d\262"
+	.string	"\"\335b\023Q\t\017\203K\367\b5\336\243\264\t]\n\246\247\013G\300\237\013G\300\337\n\024M=\267\340D&\264\030\"%\022\213!z\222\214K\327h\004\n\217L\027\216\2007\375\205\220\016\203M\347S"
+	.string	"C\020a\304\021\n$\020D\027A\204\0222\270\200\n'\350#\020+\210B\024M?#SR\bb0\3040\b\\\nqT4\206"
+	.string	"\321\301\210\246,P\230\377uY\336\r\022\027\266\206\354\215\317\354\214\023\032M\320\\#QZRLN >\\@\244\314\214\261\231\343Fc\216\305\t\230\241D/\321JN)\355\264\205\004"
+	.string	"\f\375\353$\271M\307\022\027K$\271\r\0303K*G\336D\230A\302\320F\316-Zv\304\300X\234\314J\204L\265i\344)\367\005K\222%DN\032nkN`\026\333\032M\360\222\350!G71\314\276X\374\023\365\366\303I\330Y&y\207\t\032\2135\330=\301\336\336\336^\235\275\2374\230\325A4\220k\260\007\235vcTO\031\203\260\304K\377\320^\332\207v\032BG\367\270\366\341\203\023\303\2325\026k\036UMF\221\255-\213\365\027"
+	.string	"\266\376\365\216\374FB\033\253\036]\347\306V\240`\330\351\250t\271\206\224\336\032\227\3322\017\016Z\216\263J\020\325\326\231\016\215#\214\233\253;y\026'\340\211\256\241o\350\032z\213\247\352\216\206\207_\333\270\336\352!\363d\326\306b\255\205\255\202\266(\251\213\262\240\215\376u\326\271uEL\357\311\204\002\201\030\267\244\035\032U\215\005\271\254\236(kb\222`]\313\250gO\232X\254\245\214\256\261\246\250\350\034\217\247\324\024\033`_\026\233P \330;\350\353\352\315I\355\332]z\356\307W\234\305\032\3061P\273\242!\305\352\215\215\343\272c\247\312L\253Jr\371\241_\234a\260Z\225\030\344h\027X\366\327\032\252)\255\344\0341\035u=\365k)\335\002;\025\351Rf\261\325\252D\231"
+	.string	"u(\353mt\035uJ\301\003\2635\224~\302\\\346\334\200\262w\375\364\353\255\2352\026\262\262\031\026\333c%\312\003\250C\371\3243\372\271g\336\335\271\231\273s\332\261JSE\212\316O;\377\251w\326\2611@ \225\267\334\263\330RU\242\254A\035\312\326\315\350'\035}\026\247%\312b\022=\342\3049\363N\"c\314\336\310\230\n\222'\347g\036\216)d\013|vs$\231\362dF\213\030\203\207w\276\341\240\267\023)/\226\371\f\224\01667?\337"
+	.string	"\035\263\222T,>\333\340\264\265\264=2pz\304\0165jN6\025\312\276\332\320\206\245\307\225\327cwE\n\330\232\237l~\330\262\202\\1\323\"\362\354\354N4\025\312\276z"
+	.ascii	"\236\036\327\230\317[[\322\312\335O4\347R\313\2242\213\3173'"
+	.ascii	"\2260pi,\020\242EX1c\346\224\262B\312\231q\221\303\342[ C\217"
+	.ascii	"\270:\311\234d\3162\034\212\264\231\275\t\3122\343\016\325\334"
+	.ascii	"\3172wRS\324\220\300\235a\225\251\243E\270\335\271;w\312U(\373"
+	.ascii	"*\247i!\"\003\377\240\343\344\316b9\214d\216\215.;\026\213(\002"
+	.ascii	"\007w\206\341\240\267\223(z\313\275\265<\350-Qe?\300\374\f\363"
+	.ascii	"\343cN\226\034\026\237q8\355\n\216\231#\026\237_\314\250\237"
+	.ascii	"=:{hn1\264\221\201\311\242G\314\341\302\345|\363\240\356)\345"
+	.ascii	"\327\235\345\215s\205\244F\227\237oj<4\274@\t\206\247\250\203"
+	.ascii	"\002\204j@\222R\030\306\224b\306(4D\303Icc\025@0XL \223\013\306"
+	.ascii	"I\347\001\023\200\002Jkd\312&\306\030r\204FDDZ\220\222R\2459"
+	.ascii	"l`\302!e\372\372\324V+v4\212$\262\356\320\246\003*\357\235\005"
+	.ascii	"\246Q\343\024V\356\253\344\222\234\336Sf!\220\\Y>\344W.\215\235"
+	.ascii	"\262O"
+	.string	",&\001\362\025U\207\273\035\026G\032\030l0&\001v\263\223d\236\315\026_\230C\205U\216\033I\247\200\b\021<m$\334\274\211\264%\033@x@B\006\336.\251\362\245r\307\367\333\005\240\324\332\030\341\f\260l)\031\346\323\247\300rW\214\374\360\032\344\353G\003D\212\261\305Q\0308NX4\345\341\307\375:\377\213\213\312G\030\212\220fS\200l\2465\344\363j\266\tO\373\274\305\204Ls\351g\232\327Cj0\201\315\026\242\311\b\267\364\344\022\335\243\302\375\036\315u\205\317\242=\341s\227/WB5bg\354\221n3\344m\rn\024\022\323\365\363\202j$\3042\217j}B\027b\243\364F\220\030\345N\323\247q\362\201\013\205qY6\340\327\005\330\013\276\260C]=\241\266 -\364\2366\253o\013\247\374wl'Q\306\033zpN\353\220J\251\003\353\320\257\f\203\260\250\340\317$\023\205}\2646\344\004"
+	.string	"\332\345m\2666\313\022\330\031t\207L\t\004\214\215"
+	.string	"\017\252\236\025\310DW\362r\022\252+\275\323.\254+\315\252\357\3121!\332:q\370\035\316\355\2126\277?R\264j\205z\373\2454\250\353\253kL,!\203\225\321\235O[\216R}3\2202\373\332\201#\342(p\377?\261O\354&G\316\354\214\377[4\251:M\317\242D\251\336\031\222L\243_ T\001\002\342}\235ji$\302x\206\271]6\336\355\350\373?\255\033\254J\221\365m\267\260\3368"
+	.string	"IN\025,\330y7\301\342oH#\213\200,\251^c\224\215\362i6\374*B\315\313\207\332\213@\024<\225\021\035\30089.\365\nr\035\203l\nDv\211\367?\001,\034\307\\\226\344SQ\004E=\262ij\":Zx\"\225\220\217\367\376\325\247\220\b\361\375\364\245<\237w\355\035\345\345\201\256\221\207\305|\003\263\\\006\326T\0165\240\265{\264\270@\311^\201\373\300\030\252s\273\334\r\006\235Ka\256\272\312\325\274\254\272\340\271\016\272$\241\b0\201-\201\314\022HU\273PO\302\261\n\313Vf\330\302\277^\204 \367\373\332\002\366\226\355\030\204R\317E\\\333\034~w\301>9\215%\362"
+	.ascii	"\177|\312/y8\026\036\344\225W\214\257\337=<\336\204\364,.og\344"
+	.ascii	"\336\323\r\226\340\220\227\002\371<n9g\201\206\353\247)\206H"
+	.ascii	"\177\nV&\347\234\030B\021E\247\350\333#\351\003 &\020\377\311"
+	.ascii	"\227`1\243\3255\360qH\201\032@\204'\351\310\361\371\276\313\347"
+	.ascii	"\240\273\314\217\356\337\257NP\263u\201\323(\340\354\271\245"
+	.ascii	"\240|\247\323G\346}$\323\\\244\241"
+	.string	"\024C\232K\245\2475A\345\275\246\255!\247Q\266_\316{\275\300\360<\365\207\210AW \017\201"
+	.string	",\031@&\273\nK\321\32703\204\212\315\2365\016T\221}\b\277\t.T|\001N\232\310O\r\302\310\241\307\026\036\302\336\216H\363\303\036\"\307\337\243\264<O\342\365\002_Ho\224\347\003\202\256\212\220\016Z\"\314o'\013\234k/\210\377C\266\266!\233\037\316\216qE#Z\337"
+	.string	"n`\225EF6\264\200\"A\3413_\026N\252A\017\nV\"f_\341Y,c\310\260)\212\272\260\262\226\347\001%I-\224(\003\300D\235[w\265"
+	.string	"\027\007\"\323p\024\201\007\350\ff\222B\013:^}\300\246\317Tmf\250\034\375'\223\314\211\326\027\343c\352\353\034\034\225\f\255\315\204Wm\230\035\017\277\035Z\245>\234-|u\302\255\355\200G\375R\177\210=\003Bf\002H\337\334L~\356jx\202J\204\344\233$EE\254l\002\254}tWcz\304\215\277c)E\301\226\360\363\325\253\273\003\020\270\234[\326\370\024\316`\251\022\003\305\216\n\235\205\200dR\344|\342\232\307\362[\361|\305X!\245,#s\345,\255\0277\332\fN\373!_\276W5\251\374\334\016\344\003\"\334\001\201\227\206\306\267\025\037\252\027\023\300(\255\275\222\221t\034\2442C4eEG\216\003Z\277i\200f.{\202\336\275\314\232\331a&R\326\227\361\225\274"
+	.string	"\310t\200\r\177\322\004\365\267\"P\200\275f?\200V\004\363\362\246\001\315\302T\327\356\032\327\235^\272\353D\r\022;\354\013+\346\2537\345CK\332\232(vN\357\311\263\"\276\227\355\n\023M\364\217\217\016\253;C9 L\263\033 \370\255\035\323\324m\237\017\211\352\247\3061\3227UEs\006\24192\260\376,\347\222\347\2704\016kX\270\206I\271C\232 z\210\006\241Ilg\255V\t\216P?\217\231\264k\331\177\322\331\003\360/:\033\213\021u\253x\246e\r\360Px\267\206d~\336\313\344\324\300\301\313{\305\226\343\240\310(\210\353\276\302\357\243V\211C\376\203\247\t\355\202\304\037\233\344|&\006\"1l\001\030J\323\210\340\227\325(\034"
+	.ascii	"f\023|t\304\241\033\325[\205\246o\201\214\0164\217e\\\213C\347"
+	.ascii	"N##\361\271\337o\020\001\346\206hQ\243\211\223@\004\342jX\313"
+	.ascii	"MVm\254\267I\331\330\021-\351\255?\357\321=\t\353\242\\x\030"
+	.ascii	"&\343\266\377J\023\374Y\210H\036\232\223Tv\351\344\035$\240\316"
+	.ascii	"C\261\fV\300\\\220\307d6ks8\200\350mP\360)g\241;p\346\354O\360"
+	.ascii	")\262*\007\234;\260'<\021Hoe\2014\235\223%\347n\235S\364U\201"
+	.ascii	"\020?\350\021\365\222A>k\002T.,\216\0254\204\t\317\334\240\220"
+	.ascii	"\373A\021\365w\306\030\247\304s\3229\336\036\360\276\263\241"
+	.ascii	"\004\301\213\211\373\202\224\376\"$i0\036i\224\220\243vwI\f\032"
+	.ascii	"az\001\205\200\377\200"
+	.string	"B\372X>A\340\313\312A2<\003p9\207,N}\034U\374\273\274\276\373\347@?\360\317\025\224\250\004\264k\361\312\365\271\203\371\243\200\346fC\204\023/\013P\233\304\313GT\230\242[+\325\361\351F'|8\334m\352\375\t\031;x\207\263\367\2038=s\271\213\021P\344#\275\206\357\222f\321+\312U\027\\nw\240^s59`\334\300\341N\367q\363\311t\305u\273\206^\256\322\363\350\022\221\322\214 \270ZB\025M7b\b\270C\255\004\220\253\375\364\231m\246\356h\260\260\245\\\374\226bM\340\307\355-\246K\302\370\357S\250T\221\202\375\326\224\246\311*-\017?\252\362\267x\276\260\265\275u\022rM\004\202\024Xw\203\265\261\f\013\004\316\276\\+\021\340>\227|\257\006\331\226\302!}&hQ)\302X[\301\214-\236\333\2153O1\246:\357h\233\232\035\304\344/\314\344\030\227\002\216:h"
+	.string	"\021\213\267v\300Bl\353K\211\376\225\\vH\335\335`\313\204\314\021\334\003\274\217\345\266,T\330,\033\350\233\260p\374j\343\0073\316\225G\337z\303$e\344\316\034\306\016Y)P\347t\235\233d\024\244\"\335\272\2316\232H\320\302\016xs\027\356\006\261\351)#\035\372b/7a\031\263\335\215y<Xs\365\263\226\375\246\036\306\221k\017\304X,\315f\344tu\177]\304$\227tt\253\017@s\360O\233\337ae\222\034\026p\bS\373&\204\351\213\n\356\260\f\004\343"
+	.string	"Su\\\222\243\343\377\253l\017\230\366\356\370\247\026\005\346\265\237\b\"\362\301\265\330\207\237\234H|\320\3107\026\256\\\374q+\3238\177\214[\201\211Q\372\207<\035\275^*K^\225\022\320\316\205\005\367*\177c\f\306\037\215Rqp\334\3513\252\272\372\251\251!\354\006\005\213+\344\340i\340\234*\233\366\222i\021\344)\322\374\240\224r\362'\272`\341\244]\274\2051%\261\003\263\177KG^\021\337\271&\323\253:\020\025\302%&!\023\310\2430N\362\233\247V\004\317\312\352\f"
+	.string	"\342\t;\216\335\202\017\311N\323"
+	.ascii	"W\177\275\271&\025\177\373\372>\031\001,\203\037\230\206\242"
+	.ascii	"\316\302q\276\201\310\301\356\177\rb\003\221\033P\200\346W\335"
+	.ascii	"\302\251w~\2672\305\354\327\345dk;\245(.\246>\370\251\2248fj"
+	.ascii	"\030\203\310eEbT\314\263\023(\034\344\2648\202\320\304-T\213"
+	.ascii	"\235\221\217o\221\365n\262\312x_`ZU\2519\177\245}(OB\246e\361"
+	.ascii	"\264\206\203\\\006@)\270.\030\321P\235"
+	.string	"\246\001r[\034x-\243I\350\307\273)\211a\227\001A\326a\211\327L\320@\027\207\334\323\017\253\202}p\006\212<\024\340-\320\017\bm\365\267\016c\207\3478\215\2177\224)\325\3267\335X\330S\3421\226l\310\235\266a\316\264\033\376\240\370n+\263\373\013\207@T\023\356\242\203-\372\263\tA4fZ\250+\322\034\337\022\314\205\020\267\276\252\020\"\206A\346?j\020\330\204\355x\3624\356\370\221\325\025\021\236\032\362<\351\205\253\356<BC2y\221\035\204\373\370\343\2613\177\361by\231\357\021\341\001>\374\023\250\217\006\356\362>?~\n\353X\365\030'A\300\357\243\241\356\030\230\261:\303)\326\304\351\340O \310Gio\322\222\254=\333\252x6/\227\335s\273z$\266\255\334\017\232\363\353Z\256\370\352v*\354L\302qL\211\030=<A^\233\201\310\204.Cr\037^\222\3372~\004\220\370\251\013\340"
+	.string	"\244\037\256\324\311\344\333Ob\201\364\021\236$\037\361?\013c\214e\357\024\327HI\364.^E\217"
+	.string	"\t\361\303\"\273\250\247\020\207z\223\337\f\032\300-\214\207\003\370\314\3670\022\003\333Dp\2558j\225\005\312\213/\310\031\363E\375\235\327\307\241\201\217\306\252\322\020\275\320@\f\\O#K\rR P#\311\026\351&\372{J\332K\214+\221\001b}p\0250\365\005fD\234\032dA\376\002\315\306\354\273\343<W\341#\312\365j\221\3430\240\313\353\034\006i\013p\240u\245\021\255\245\337\261\200xN\b\017\371\224\357\021\330\275\256\331\256/D\0346PZ\033\322\2156HM\205\353\205\031\t\275\005\022\345\275D\"_6\342c\355Oz&m\361\321\355WE\326u\363@\001\2113\300\247GK\345\033t\341K!0j"
+	.ascii	"\301{ \221\207;\220\026\225\366\351u\376\316\f;+\245\244\036"
+	.ascii	"\222"
+	.string	"\226\303[\205\354/\034$\203C\037yU\032\302eL\017\n\2267\214`\245N\3240\301\264\271\326E\031\f-\276\246\331\341\275'\373\252Uh%\017\017\375g\317\363N\304y\276[iE\016\250\365\"\302\350\027\346v\303\243+\271\270H4\235Zw\246\204\347=\200\330\017-\036\275\310\243I\034\0234\352\363\207G\033h0&\f>\266\330\337Z+@S-\026\363)\373\t \320-\247|\022Gm \343\216\312\033\r\267\rq\0256\300\367eN\016\007\250\373\2549\340\0202\034C\n\343e\212I\304U\355\024\367l\266\017\027\217\243\264\374va\001%\300|\253\257\021\262\342\034n\376\367\326\003\256E(\356/I\345.VY\242t\244\005\300\271\222@\023\244\253\004\003\275\\;\007*\214\306\023\005\222\367?k\334?\223Z\244~I\3118\032\003\026\373\"`"
+	.string	"\315\326\251)"
+	.string	"\244\254\312\342\215;\216H\202\226\232\215K\002o|\254H2\320\265\236\224\361\372L\220\024\266;y\217\0254\332\2008\303]\323U\241\022/\226;\017\215x\177\321i\266pey\354\003\271\250\007,\214\254\3655\032\342\3300w9\235\314\025\267\"q*\016\365\334T\242q\037z\323\265)[\207{y*(\016\3761\237\201?\211\344$\212\036\304\372\331\350\037\327J\326|\250\026\260\210\377\237\345pEK\3206\022\205?F\363\033h=\3468\007\b\354#\312k\t87"
+	.string	"x\377\245\223\013\177\273\003\267\376\377\331\317+\036\004\317\267h\243x\244T\267}\006\373\204\263\323'\360d\207\251\347o\345\035\255}\303<\261\343\347\234\214\247{0\356\376\232\236\362Z9\355G\361n.p\371s\325\n\003\213\371\033\221n>p\207\033\372.\201_\223Poz\234\256\374\236F\364\346j<S\361\275\\\327\0173\362>\r\364\273\r\316`~\256\227\016\030\362\247\2173KI\237)\374\256\362\252\333N\027b9\233\206S\377NfY\003\3134\233\201p\367\272w\300p\002\333^\254\367\026\3306\347\251\227\361\272]W5\272z\312@\367\362\316GjN/,o*\361\330\343\352\205\020\371\235;K\303wL\357h:\363\271\245\331\240\251/7"
+	.ascii	"\257\362\340@\205\254\2013\366\036\243\271\302\276(\373\355\235"
+	.ascii	"C\r\350\327\032\276\314\003\360d\304\274!\030!\016\232w\023\373"
+	.ascii	"DT\243\272\373\"w\207|\323\201\363#\3763\355E\231)/;\034\346"
+	.ascii	"w\260sw\267\031\221c\233\305\201\023\352b=\366\341K0\226\303"
+	.ascii	")q\355G\325\025"
+	.text
+	.section	.gnu.lto_.symtab.516425ac3a7cf03,"e",@progbits
+	.string	"_update_checksum"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\003"
+	.string	""
+	.string	"gpsRestartUBLOX"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\270\003"
+	.string	""
+	.string	"gpsHandleUBLOX"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\256\003"
+	.string	""
+	.string	"ubx_ack_state"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\273\003"
+	.string	""
+	.string	"ubx_nav_status_bits"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\276\003"
+	.string	""
+	.string	"ubs_nav_fix_type"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\301\003"
+	.string	""
+	.string	"ubx_protocol_bytes"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\304\003"
+	.string	""
+	.string	"gpsSol"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"^\003"
+	.string	""
+	.string	"gpsState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"h\003"
+	.string	""
+	.string	"gpsStats"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\200\003"
+	.string	""
+	.string	"gpsToSerialBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\246\003"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\003"
+	.string	""
+	.string	"fastA2I"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\310\003"
+	.string	""
+	.string	"gpsConstrainHDOP"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\314\003"
+	.string	""
+	.string	"gpsConstrainEPE"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\316\003"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\324\003"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\330\003"
+	.string	""
+	.string	"serialWriteBuf"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\336\003"
+	.string	""
+	.string	"millis"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\340\003"
+	.string	""
+	.string	"gpsSetProtocolTimeout"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\344\003"
+	.string	""
+	.string	"gpsProcessNewSolutionData"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\346\003"
+	.string	""
+	.string	"serialSetBaudRate"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\353\003"
+	.string	""
+	.string	"isSerialTransmitBufferEmpty"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\357\003"
+	.string	""
+	.string	"serialPrint"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\364\003"
+	.string	""
+	.string	"gpsSetState"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\370\003"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.516425ac3a7cf03,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
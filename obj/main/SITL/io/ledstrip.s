@@ -0,0 +1,6939 @@
+	.file	"ledstrip.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	ledstrip.c.68875659
+	.weak	ledstrip.c.68875659
+ledstrip.c.68875659:
+	.long	0x6c
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2
+	.long	.LASF1112
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1102
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1103
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1104
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1105
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1106
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1107
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1108
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1109
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1110
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1111
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.file 1 "./src/main/io/ledstrip.c"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 2 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 4 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x4
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.file 5 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF399
+	.file 6 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 7 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x7
+	.file 8 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF453
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.file 10 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xa
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 11 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF526
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF544
+	.file 12 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xc
+	.file 13 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0xd
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.file 14 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF610
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x12
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF646
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF526
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 19 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF674
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF675
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF453
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF735
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x17
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF749
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF750
+	.byte	0x4
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x19
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF751
+	.byte	0x4
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF752
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF567
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x9b
+	.uleb128 0x1b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF753
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF754
+	.file 28 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF755
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x1e
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF772
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.file 33 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF785
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x23
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF790
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x24
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x4
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF793
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x26
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF794
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF811
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF812
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF813
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF825
+	.byte	0x4
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x2b
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x2c
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF832
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF833
+	.byte	0x4
+	.byte	0x4
+	.file 45 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x2d
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF837
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x2e
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x2f
+	.byte	0x4
+	.byte	0x4
+	.file 48 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x30
+	.file 49 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x8
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x33
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF842
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF905
+	.byte	0x4
+	.file 52 "/usr/include/string.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 53 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xac
+	.uleb128 0x35
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF907
+	.file 54 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x36
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF908
+	.byte	0x4
+	.byte	0x4
+	.file 55 "/usr/include/strings.h"
+	.byte	0x3
+	.uleb128 0x1ce
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.file 56 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 57 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x39
+	.file 58 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.file 59 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x3b
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.file 60 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x3c
+	.byte	0x4
+	.file 61 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF427
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF431
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF432
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF438
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF439
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF440
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF446
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF436
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF402
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF448
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF449
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF450
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF452
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF454
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF458
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF459
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF463
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF464
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF465
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF511
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF512
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF523
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF524
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF525
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF527
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF543
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF545
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF552
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF568
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF583
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF587
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF604
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF605
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF619
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF625
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF627
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF628
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF632
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF633
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF638
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF645
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF667
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF673
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF690
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF695
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF696
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF732
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF734
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.40.492512a14a2010d5ca50e9de957e6b26,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF748
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF759
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF763
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF767
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF771
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF784
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF789
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF792
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF795
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF806
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF810
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF824
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF828
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF836
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF399
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF553
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF554
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF555
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF556
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF557
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF558
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF559
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF560
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF561
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF562
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF563
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF564
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF565
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF566
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF841
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF904
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.23.93403f89af7dba8212345449bb14b09d,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF398
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.string.h.31.e39a94e203ad4e1d978c0fc68ce016ee,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF567
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF569
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.e19404c7e1259e8e5fb3f9b7fddfda02,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.strings.h.19.a259f126920b1bb5ef76bc62b3984a3c,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdarg.h.31.b55da1089056868966f25de5dbfc7d3c,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF911
+	.byte	0x6
+	.uleb128 0x22
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF923
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1016
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1029
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1030
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF588
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF606
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF608
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1031
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1044
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1045
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1060
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1061
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1062
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1063
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1064
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1065
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1066
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1067
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1068
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1069
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1070
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1071
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1072
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1073
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1074
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1075
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1076
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1093
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1101
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0xb
+	.long	.LASF1
+	.long	.LASF1113
+	.long	.LASF1114
+	.long	.LASF1115
+	.long	.LASF1116
+	.long	.LASF1117
+	.long	.LASF1118
+	.long	.LASF1119
+	.long	.LASF1120
+	.long	.LASF1121
+	.long	.LASF1122
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x3e
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1123
+	.byte	0x1
+	.long	.LASF1124
+	.byte	0x9
+	.long	.LASF1125
+	.byte	0xa
+	.long	.LASF1126
+	.byte	0x9
+	.long	.LASF1127
+	.byte	0x6
+	.long	.LASF1128
+	.byte	0x9
+	.long	.LASF1129
+	.byte	0x9
+	.long	.LASF1130
+	.byte	0x6
+	.long	.LASF1131
+	.byte	0x6
+	.long	.LASF1132
+	.byte	0x8
+	.long	.LASF1133
+	.byte	0x6
+	.long	.LASF1134
+	.byte	0x7
+	.long	.LASF1135
+	.byte	0x7
+	.long	.LASF1136
+	.byte	0xa
+	.long	.LASF1137
+	.byte	0x6
+	.long	.LASF1138
+	.byte	0x6
+	.long	.LASF1139
+	.byte	0x6
+	.long	.LASF1140
+	.byte	0x6
+	.long	.LASF1141
+	.byte	0x8
+	.long	.LASF1141
+	.byte	0x6
+	.long	.LASF1142
+	.byte	0x6
+	.long	.LASF1143
+	.byte	0x6
+	.long	.LASF1144
+	.byte	0x5
+	.long	.LASF1145
+	.byte	0x5
+	.long	.LASF1146
+	.byte	0x5
+	.long	.LASF1147
+	.byte	0x5
+	.long	.LASF1148
+	.byte	0x6
+	.long	.LASF1149
+	.byte	0x9
+	.long	.LASF1149
+	.byte	0x6
+	.long	.LASF1150
+	.byte	0x6
+	.long	.LASF1151
+	.byte	0x6
+	.long	.LASF1152
+	.byte	0x6
+	.long	.LASF1153
+	.byte	0x8
+	.long	.LASF1153
+	.byte	0x6
+	.long	.LASF1154
+	.byte	0x5
+	.long	.LASF1155
+	.byte	0x5
+	.long	.LASF1156
+	.byte	0x5
+	.long	.LASF1157
+	.byte	0x5
+	.long	.LASF1158
+	.byte	0x6
+	.long	.LASF1159
+	.byte	0x6
+	.long	.LASF1160
+	.byte	0x6
+	.long	.LASF1161
+	.byte	0x6
+	.long	.LASF1162
+	.byte	0x6
+	.long	.LASF1163
+	.byte	0x6
+	.long	.LASF1164
+	.byte	0x9
+	.long	.LASF1165
+	.byte	0x6
+	.long	.LASF1166
+	.byte	0x6
+	.long	.LASF1167
+	.byte	0xa
+	.long	.LASF1167
+	.byte	0x9
+	.long	.LASF1168
+	.byte	0x6
+	.long	.LASF1169
+	.byte	0x6
+	.long	.LASF1170
+	.byte	0x9
+	.long	.LASF1171
+	.byte	0x5
+	.long	.LASF1172
+	.byte	0x5
+	.long	.LASF1173
+	.byte	0x9
+	.long	.LASF1174
+	.byte	0xa
+	.long	.LASF1175
+	.byte	0x4
+	.long	.LASF1176
+	.byte	0x3
+	.long	.LASF1177
+	.byte	0x2
+	.long	.LASF1178
+	.byte	0x3
+	.long	.LASF1179
+	.byte	0x3
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF850:
+	.string	"INT32_MAX (2147483647)"
+.LASF824:
+	.string	"__ONCE_ALIGNMENT "
+.LASF966:
+	.string	"USE_1WIRE_DS2482 "
+.LASF690:
+	.string	"__STD_TYPE typedef"
+.LASF810:
+	.string	"__fsfilcnt_t_defined "
+.LASF961:
+	.string	"USE_OPFLOW "
+.LASF451:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF641:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF649:
+	.string	"__HAVE_FLOAT64 1"
+.LASF933:
+	.string	"USE_SERIALRX_FPORT "
+.LASF737:
+	.string	"__ino_t_defined "
+.LASF654:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF776:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF661:
+	.string	"__f64(x) x ##f64"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF1004:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF938:
+	.string	"USE_GPS "
+.LASF551:
+	.string	"__stub_sigreturn "
+.LASF415:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF513:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF779:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF527:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF750:
+	.string	"__clockid_t_defined 1"
+.LASF488:
+	.string	"__flexarr []"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF953:
+	.string	"USE_RX_UIB "
+.LASF896:
+	.string	"INT16_C(c) c"
+.LASF1108:
+	.string	"signed char"
+.LASF958:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF927:
+	.string	"USE_I2C_PULLUP "
+.LASF459:
+	.string	"__GNU_LIBRARY__"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF788:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1081:
+	.string	"U_ID_0 0"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF946:
+	.string	"USE_PITOT "
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1031:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF613:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF934:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF395:
+	.string	"true 1"
+.LASF1055:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF941:
+	.string	"USE_TELEMETRY "
+.LASF622:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF865:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF502:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF798:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF735:
+	.string	"__STD_TYPE"
+.LASF786:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF791:
+	.string	"____sigset_t_defined "
+.LASF475:
+	.string	"__P(args) args"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF754:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF819:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF571:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF987:
+	.string	"CMS_MENU_OSD "
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF703:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF747:
+	.string	"__daddr_t_defined "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF999:
+	.string	"USE_SERIALRX_SUMD "
+.LASF903:
+	.string	"INTMAX_C(c) c ## L"
+.LASF606:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF1086:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF663:
+	.string	"__f64x(x) x ##f64x"
+.LASF1033:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF801:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF640:
+	.string	"__HAVE_FLOAT128 1"
+.LASF1025:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF648:
+	.string	"__HAVE_FLOAT32 1"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF900:
+	.string	"UINT16_C(c) c"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF587:
+	.string	"__size_t "
+.LASF844:
+	.string	"INT8_MIN (-128)"
+.LASF729:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF687:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF463:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF875:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF926:
+	.string	"I2C2_OVERCLOCK false"
+.LASF757:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF490:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF575:
+	.string	"_T_SIZE "
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF853:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF874:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF765:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF1014:
+	.string	"USE_CLI_BATCH "
+.LASF1053:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF965:
+	.string	"USE_1WIRE "
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF418:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF908:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF830:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF405:
+	.string	"__USE_POSIX"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF607:
+	.string	"NULL"
+.LASF1082:
+	.string	"U_ID_1 1"
+.LASF733:
+	.string	"_BITS_TIME64_H 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF979:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF1095:
+	.string	"NOINLINE "
+.LASF1075:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF891:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF547:
+	.string	"__stub_fchflags "
+.LASF1061:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF826:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF712:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF637:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF429:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF409:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF414:
+	.string	"__USE_XOPEN2K8"
+.LASF998:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF512:
+	.string	"__always_inline"
+.LASF573:
+	.string	"_SYS_SIZE_T_H "
+.LASF932:
+	.string	"USE_SERIALRX_IBUS "
+.LASF756:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF425:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF815:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF461:
+	.string	"__GLIBC__ 2"
+.LASF923:
+	.string	"__va_list__ "
+.LASF1112:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1103:
+	.string	"long int"
+.LASF453:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF770:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF790:
+	.string	"__sigset_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF430:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF447:
+	.string	"__USE_XOPEN2K8 1"
+.LASF718:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1080:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF960:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF426:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF732:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF759:
+	.string	"__PDP_ENDIAN 3412"
+.LASF717:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF881:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF711:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF710:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF509:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF510:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF582:
+	.string	"_SIZE_T_DECLARED "
+.LASF477:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF625:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1058:
+	.string	"USE_DASHBOARD"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1101:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF498:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF888:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1098:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF659:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF398:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF491:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF672:
+	.string	"EXIT_SUCCESS 0"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF825:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF468:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF423:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF472:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF667:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF570:
+	.string	"__size_t__ "
+.LASF768:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF677:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF479:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF996:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF692:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF526:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF970:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF708:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1054:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF736:
+	.string	"__u_char_defined "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF581:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF584:
+	.string	"___int_size_t_h "
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF435:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF476:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF650:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF866:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1063:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1040:
+	.string	"USE_UART1 "
+.LASF583:
+	.string	"__DEFINED_size_t "
+.LASF797:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF942:
+	.string	"USE_TELEMETRY_LTM "
+.LASF817:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF1088:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF799:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1042:
+	.string	"USE_UART3 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF951:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF744:
+	.string	"__pid_t_defined "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF845:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1073:
+	.string	"USE_VCP"
+.LASF805:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF520:
+	.string	"__restrict_arr __restrict"
+.LASF545:
+	.string	"__stub___compat_bdflush "
+.LASF579:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF930:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF719:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF422:
+	.string	"__USE_GNU"
+.LASF457:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF861:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF831:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF499:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF859:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF645:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF568:
+	.string	"__need_wchar_t "
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1032:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1100:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF550:
+	.string	"__stub_setlogin "
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF567:
+	.string	"__need_size_t "
+.LASF968:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF680:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF702:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF532:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF517:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF437:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF631:
+	.string	"__WCOREFLAG 0x80"
+.LASF905:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF412:
+	.string	"__USE_XOPEN2K"
+.LASF485:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF734:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF617:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF413:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1036:
+	.string	"USE_FAKE_MAG "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF669:
+	.string	"__lldiv_t_defined 1"
+.LASF515:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF444:
+	.string	"__USE_POSIX199309 1"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF1084:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF872:
+	.string	"INT_FAST8_MAX (127)"
+.LASF860:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF890:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF901:
+	.string	"UINT32_C(c) c ## U"
+.LASF636:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF880:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF407:
+	.string	"__USE_POSIX199309"
+.LASF851:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF925:
+	.string	"I2C1_OVERCLOCK false"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF665:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF664:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF630:
+	.string	"__W_CONTINUED 0xffff"
+.LASF1094:
+	.string	"FAST_CODE "
+.LASF870:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF985:
+	.string	"USE_STATS "
+.LASF976:
+	.string	"USE_FRSKYOSD "
+.LASF462:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF411:
+	.string	"__USE_UNIX98"
+.LASF1003:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF814:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF428:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF800:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF696:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF681:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF955:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF726:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF921:
+	.string	"_VA_LIST_DEFINED "
+.LASF929:
+	.string	"USE_SERIAL_RX "
+.LASF794:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF931:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF820:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF1043:
+	.string	"USE_UART4 "
+.LASF484:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF728:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF1011:
+	.string	"USE_VTX_FFPV "
+.LASF749:
+	.string	"__clock_t_defined 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF913:
+	.string	"__GNUC_VA_LIST "
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF394:
+	.string	"bool _Bool"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF596:
+	.string	"_BSD_WCHAR_T_ "
+.LASF822:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF670:
+	.string	"RAND_MAX 2147483647"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF877:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF983:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF497:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF878:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF777:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF608:
+	.string	"NULL ((void *)0)"
+.LASF1056:
+	.string	"USE_USB_MSC"
+.LASF1083:
+	.string	"U_ID_2 2"
+.LASF507:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF609:
+	.string	"__need_NULL"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF445:
+	.string	"__USE_POSIX199506 1"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF1047:
+	.string	"USE_UART8 "
+.LASF655:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF448:
+	.string	"_ATFILE_SOURCE"
+.LASF686:
+	.string	"__SLONG32_TYPE int"
+.LASF893:
+	.string	"WINT_MIN (0u)"
+.LASF775:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF707:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF653:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF986:
+	.string	"USE_CMS "
+.LASF401:
+	.string	"__USE_ISOC11"
+.LASF452:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF796:
+	.string	"__NFDBITS"
+.LASF841:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF842:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF802:
+	.string	"NFDBITS __NFDBITS"
+.LASF555:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF978:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1012:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF638:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF612:
+	.string	"WUNTRACED 2"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1049:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF884:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF709:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF675:
+	.string	"_BITS_TYPES_H 1"
+.LASF852:
+	.string	"UINT8_MAX (255)"
+.LASF818:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF889:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF438:
+	.string	"_POSIX_SOURCE"
+.LASF1091:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF436:
+	.string	"__USE_ISOC95 1"
+.LASF536:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF549:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF574:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF783:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1089:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF489:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF943:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF795:
+	.string	"__suseconds_t_defined "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF471:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF569:
+	.string	"__need_NULL "
+.LASF400:
+	.string	"_FEATURES_H 1"
+.LASF433:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF738:
+	.string	"__dev_t_defined "
+.LASF469:
+	.string	"__LEAF , __leaf__"
+.LASF416:
+	.string	"__USE_LARGEFILE"
+.LASF1002:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF501:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF713:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1034:
+	.string	"USE_IMU_FAKE "
+.LASF658:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF691:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF781:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF910:
+	.string	"_STDARG_H "
+.LASF1048:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1026:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF839:
+	.string	"_BITS_WCHAR_H 1"
+.LASF666:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1009:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1021:
+	.string	"_T_PTRDIFF_ "
+.LASF1037:
+	.string	"USE_FAKE_GPS "
+.LASF420:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1051:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1024:
+	.string	"_PTRDIFF_T_ "
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF614:
+	.string	"WEXITED 4"
+.LASF939:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF727:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF944:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF635:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF785:
+	.string	"_SYS_SELECT_H 1"
+.LASF592:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF529:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1085:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF406:
+	.string	"__USE_POSIX2"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF832:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF588:
+	.string	"__need_size_t"
+.LASF1010:
+	.string	"USE_VTX_TRAMP "
+.LASF1065:
+	.string	"USE_PITOT_MS4525"
+.LASF577:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF748:
+	.string	"__key_t_defined "
+.LASF1104:
+	.string	"long long int"
+.LASF618:
+	.string	"__WALL 0x40000000"
+.LASF589:
+	.string	"__wchar_t__ "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF543:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF604:
+	.string	"__DEFINED_wchar_t "
+.LASF838:
+	.string	"_STDINT_H 1"
+.LASF769:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF883:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF524:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF594:
+	.string	"__WCHAR_T "
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1001:
+	.string	"USE_SERIALRX_XBUS "
+.LASF474:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF505:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF523:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1076:
+	.string	"USE_RCDEVICE"
+.LASF764:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF465:
+	.string	"__PMT"
+.LASF922:
+	.string	"_VA_LIST_T_H "
+.LASF964:
+	.string	"USE_PITOT_MS4525 "
+.LASF827:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF780:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF644:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF624:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF871:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF449:
+	.string	"_ATFILE_SOURCE 1"
+.LASF682:
+	.string	"__SQUAD_TYPE long int"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF894:
+	.string	"WINT_MAX (4294967295u)"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF673:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF540:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1019:
+	.string	"_ANSI_STDDEF_H "
+.LASF782:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF358:
+	.string	"__k8 1"
+.LASF535:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1059:
+	.string	"USE_OLED_UG2864"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF627:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1107:
+	.string	"unsigned int"
+.LASF833:
+	.string	"__have_pthread_attr_t 1"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF975:
+	.string	"USE_TELEMETRY_SIM "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF466:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1066:
+	.string	"USE_PITOT_ADC"
+.LASF1064:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1015:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF419:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF603:
+	.string	"_WCHAR_T_DECLARED "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF446:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF720:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF679:
+	.string	"__U32_TYPE unsigned int"
+.LASF992:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF1022:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF496:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1020:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF500:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF835:
+	.string	"alloca"
+.LASF522:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF548:
+	.string	"__stub_gtty "
+.LASF590:
+	.string	"__WCHAR_T__ "
+.LASF863:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF716:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF856:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1079:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF994:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF602:
+	.string	"_GCC_WCHAR_T "
+.LASF693:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF950:
+	.string	"USE_GYRO_KALMAN "
+.LASF511:
+	.string	"__wur "
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF784:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF396:
+	.string	"false 0"
+.LASF745:
+	.string	"__id_t_defined "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF789:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF895:
+	.string	"INT8_C(c) c"
+.LASF741:
+	.string	"__nlink_t_defined "
+.LASF1028:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF685:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF731:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF460:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF695:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF704:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF621:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF721:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF528:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF620:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF478:
+	.string	"__STRING(x) #x"
+.LASF1099:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1105:
+	.string	"unsigned char"
+.LASF525:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF657:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF634:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF981:
+	.string	"USE_ANTIGRAVITY "
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF989:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF591:
+	.string	"_WCHAR_T "
+.LASF651:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1035:
+	.string	"USE_FAKE_BARO "
+.LASF907:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1027:
+	.string	"_GCC_PTRDIFF_T "
+.LASF940:
+	.string	"USE_NAV "
+.LASF974:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1038:
+	.string	"USE_MAG "
+.LASF1110:
+	.string	"char"
+.LASF473:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF534:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF572:
+	.string	"_SIZE_T "
+.LASF599:
+	.string	"_WCHAR_T_H "
+.LASF993:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1046:
+	.string	"USE_UART7 "
+.LASF982:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF858:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF771:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF924:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF493:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1050:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF855:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF952:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1106:
+	.string	"short unsigned int"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF576:
+	.string	"__SIZE_T "
+.LASF995:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF755:
+	.string	"_ENDIAN_H 1"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF403:
+	.string	"__USE_ISOC95"
+.LASF886:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF402:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1005:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF410:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF632:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF772:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF480:
+	.string	"__BEGIN_DECLS "
+.LASF867:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF873:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF508:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF615:
+	.string	"WCONTINUED 8"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF792:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF843:
+	.string	"__intptr_t_defined "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF988:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1060:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF918:
+	.string	"__va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF723:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1111:
+	.string	"long long unsigned int"
+.LASF383:
+	.string	"SITL 1"
+.LASF656:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF404:
+	.string	"__USE_ISOCXX11"
+.LASF580:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF746:
+	.string	"__ssize_t_defined "
+.LASF1092:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF1023:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF980:
+	.string	"USE_D_BOOST "
+.LASF864:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF1102:
+	.string	"long unsigned int"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF787:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF752:
+	.string	"__timer_t_defined 1"
+.LASF441:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF626:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF504:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF408:
+	.string	"__USE_POSIX199506"
+.LASF758:
+	.string	"__BIG_ENDIAN 4321"
+.LASF897:
+	.string	"INT32_C(c) c"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF902:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1044:
+	.string	"USE_UART5 "
+.LASF972:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF829:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF917:
+	.string	"va_copy(d,s) __builtin_va_copy(d,s)"
+.LASF610:
+	.string	"_STDLIB_H 1"
+.LASF450:
+	.string	"__WORDSIZE 64"
+.LASF1093:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF804:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF598:
+	.string	"_WCHAR_T_DEFINED "
+.LASF911:
+	.string	"_ANSI_STDARG_H_ "
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF552:
+	.string	"__stub_stty "
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF971:
+	.string	"USE_DASHBOARD "
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF486:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF688:
+	.string	"__S64_TYPE long int"
+.LASF539:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF773:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF578:
+	.string	"_BSD_SIZE_T_ "
+.LASF483:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF595:
+	.string	"_WCHAR_T_ "
+.LASF837:
+	.string	"__COMPAR_FN_T "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF813:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF963:
+	.string	"USE_OPFLOW_MSP "
+.LASF593:
+	.string	"_T_WCHAR "
+.LASF1039:
+	.string	"USE_BARO "
+.LASF678:
+	.string	"__S32_TYPE int"
+.LASF854:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF619:
+	.string	"__WCLONE 0x80000000"
+.LASF601:
+	.string	"__INT_WCHAR_T_H "
+.LASF962:
+	.string	"USE_OPFLOW_CXOF "
+.LASF892:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF906:
+	.string	"_STRING_H 1"
+.LASF1006:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF812:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF935:
+	.string	"USE_ADC_AVERAGING "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF898:
+	.string	"INT64_C(c) c ## L"
+.LASF806:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF455:
+	.string	"__USE_ATFILE 1"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF639:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF904:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF743:
+	.string	"__off_t_defined "
+.LASF956:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1078:
+	.string	"USE_ITCM_RAM"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF1008:
+	.string	"USE_VTX_CONTROL "
+.LASF1077:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF846:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF823:
+	.string	"__LOCK_ALIGNMENT "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF642:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF546:
+	.string	"__stub_chflags "
+.LASF793:
+	.string	"__timeval_defined 1"
+.LASF586:
+	.string	"_SIZET_ "
+.LASF722:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1045:
+	.string	"USE_UART6 "
+.LASF742:
+	.string	"__uid_t_defined "
+.LASF1017:
+	.string	"_STDDEF_H "
+.LASF767:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF538:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1097:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF715:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF948:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF533:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF646:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF516:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF421:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1070:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF840:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF660:
+	.string	"__f32(x) x ##f32"
+.LASF506:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1072:
+	.string	"USE_ADC"
+.LASF629:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1068:
+	.string	"USE_1WIRE_DS2482"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1069:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF876:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF481:
+	.string	"__END_DECLS "
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF616:
+	.string	"WNOWAIT 0x01000000"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF454:
+	.string	"__USE_MISC 1"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF847:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1109:
+	.string	"short int"
+.LASF464:
+	.string	"_SYS_CDEFS_H 1"
+.LASF916:
+	.string	"va_arg(v,l) __builtin_va_arg(v,l)"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF760:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF431:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF519:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF808:
+	.string	"__blkcnt_t_defined "
+.LASF936:
+	.string	"USE_64BIT_TIME "
+.LASF848:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF778:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF494:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF807:
+	.string	"__blksize_t_defined "
+.LASF959:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF957:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF531:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF683:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF652:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF1030:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF611:
+	.string	"WNOHANG 1"
+.LASF542:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF674:
+	.string	"_SYS_TYPES_H 1"
+.LASF492:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF973:
+	.string	"USE_OLED_UG2864 "
+.LASF700:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1074:
+	.string	"USE_RX_PPM"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1090:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF495:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF684:
+	.string	"__SWORD_TYPE long int"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF503:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF697:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF442:
+	.string	"__USE_POSIX 1"
+.LASF885:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF882:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF689:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1096:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF541:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF662:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF920:
+	.string	"_VA_LIST "
+.LASF997:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF969:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF633:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF676:
+	.string	"__S16_TYPE short int"
+.LASF828:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF751:
+	.string	"__time_t_defined 1"
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF821:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF774:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF915:
+	.string	"va_end(v) __builtin_va_end(v)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF514:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF899:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF947:
+	.string	"USE_PITOT_ADC "
+.LASF600:
+	.string	"___int_wchar_t_h "
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF766:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF954:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1071:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF530:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF714:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF518:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF705:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF647:
+	.string	"__HAVE_FLOAT16 0"
+.LASF668:
+	.string	"__ldiv_t_defined 1"
+.LASF432:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF585:
+	.string	"_GCC_SIZE_T "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1041:
+	.string	"USE_UART2 "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF605:
+	.string	"_BSD_WCHAR_T_"
+.LASF914:
+	.string	"va_start(v,l) __builtin_va_start(v,l)"
+.LASF862:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF761:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF434:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF694:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF857:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF869:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF482:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF763:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF439:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF443:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF706:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF628:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF537:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF849:
+	.string	"INT16_MAX (32767)"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1067:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1052:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF698:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF740:
+	.string	"__mode_t_defined "
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF699:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1057:
+	.string	"USE_SERVO_SBUS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF945:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF467:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF753:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1013:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF834:
+	.string	"_ALLOCA_H 1"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF991:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF372:
+	.string	"__linux__ 1"
+.LASF456:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF725:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF912:
+	.string	"__need___va_list"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF623:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1062:
+	.string	"USE_RANGEFINDER"
+.LASF1000:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1029:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF739:
+	.string	"__gid_t_defined "
+.LASF984:
+	.string	"USE_LOG "
+.LASF928:
+	.string	"USE_RX_PPM "
+.LASF487:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF544:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF937:
+	.string	"USE_BLACKBOX "
+.LASF671:
+	.string	"EXIT_FAILURE 1"
+.LASF470:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF701:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1018:
+	.string	"_STDDEF_H_ "
+.LASF424:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF1007:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF417:
+	.string	"__USE_LARGEFILE64"
+.LASF643:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1087:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF811:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF762:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF371:
+	.string	"__linux 1"
+.LASF597:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF909:
+	.string	"_STRINGS_H 1"
+.LASF803:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF553:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1016:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF836:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF879:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF730:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF887:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF816:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF919:
+	.string	"_VA_LIST_ "
+.LASF440:
+	.string	"_POSIX_C_SOURCE"
+.LASF949:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF724:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF868:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF990:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF521:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF967:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF809:
+	.string	"__fsblkcnt_t_defined "
+.LASF977:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1155:
+	.string	"__sigset_t.h"
+.LASF1162:
+	.string	"struct_mutex.h"
+.LASF1129:
+	.string	"features-time64.h"
+.LASF1133:
+	.string	"long-double.h"
+.LASF1172:
+	.string	"__locale_t.h"
+.LASF1175:
+	.string	"platform.h"
+.LASF1177:
+	.string	"target.h"
+.LASF1159:
+	.string	"thread-shared-types.h"
+.LASF1127:
+	.string	"libc-header-start.h"
+.LASF1125:
+	.string	"stdbool.h"
+.LASF1120:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1113:
+	.string	"src/main/io"
+.LASF0:
+	.string	"./src/main/io/ledstrip.c"
+.LASF1148:
+	.string	"stdint-intn.h"
+.LASF1119:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1122:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1134:
+	.string	"stubs.h"
+.LASF1171:
+	.string	"locale_t.h"
+.LASF1114:
+	.string	"src/main/target/SITL"
+.LASF1161:
+	.string	"atomic_wide_counter.h"
+.LASF1131:
+	.string	"timesize.h"
+.LASF1:
+	.string	"/root/repo"
+.LASF1132:
+	.string	"cdefs.h"
+.LASF1118:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1126:
+	.string	"stdlib.h"
+.LASF1173:
+	.string	"strings.h"
+.LASF1123:
+	.string	"ledstrip.c"
+.LASF1141:
+	.string	"types.h"
+.LASF1149:
+	.string	"endian.h"
+.LASF1139:
+	.string	"floatn.h"
+.LASF1144:
+	.string	"clock_t.h"
+.LASF1156:
+	.string	"struct_timeval.h"
+.LASF1157:
+	.string	"struct_timespec.h"
+.LASF1146:
+	.string	"time_t.h"
+.LASF1154:
+	.string	"sigset_t.h"
+.LASF1140:
+	.string	"floatn-common.h"
+.LASF1176:
+	.string	"common.h"
+.LASF1142:
+	.string	"typesizes.h"
+.LASF1158:
+	.string	"pthreadtypes.h"
+.LASF1137:
+	.string	"waitflags.h"
+.LASF1145:
+	.string	"clockid_t.h"
+.LASF1128:
+	.string	"features.h"
+.LASF1143:
+	.string	"time64.h"
+.LASF1169:
+	.string	"stdint-uintn.h"
+.LASF1151:
+	.string	"byteswap.h"
+.LASF1115:
+	.string	"src/main/target"
+.LASF1147:
+	.string	"timer_t.h"
+.LASF1164:
+	.string	"alloca.h"
+.LASF1160:
+	.string	"pthreadtypes-arch.h"
+.LASF1138:
+	.string	"waitstatus.h"
+.LASF1174:
+	.string	"stdarg.h"
+.LASF1116:
+	.string	"src/main"
+.LASF1168:
+	.string	"wchar.h"
+.LASF1165:
+	.string	"stdlib-bsearch.h"
+.LASF1121:
+	.string	"/usr/include"
+.LASF1163:
+	.string	"struct_rwlock.h"
+.LASF1170:
+	.string	"string.h"
+.LASF1178:
+	.string	"sanity_check.h"
+.LASF1117:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1153:
+	.string	"select.h"
+.LASF1167:
+	.string	"stdint.h"
+.LASF1136:
+	.string	"stddef.h"
+.LASF1135:
+	.string	"stubs-64.h"
+.LASF1130:
+	.string	"wordsize.h"
+.LASF1152:
+	.string	"uintn-identity.h"
+.LASF1179:
+	.string	"common_post.h"
+.LASF1150:
+	.string	"endianness.h"
+.LASF1124:
+	.string	"stdc-predef.h"
+.LASF1166:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.201029da735867cb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.201029da735867cb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.201029da735867cb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.201029da735867cb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.201029da735867cb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.201029da735867cb,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.201029da735867cb,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.201029da735867cb,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.201029da735867cb,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.201029da735867cb,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.201029da735867cb,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\001"
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.symtab.201029da735867cb,"e",@progbits
+	.text
+	.section	.gnu.lto_.ext_symtab.201029da735867cb,"e",@progbits
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
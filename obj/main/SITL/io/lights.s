@@ -0,0 +1,8077 @@
+	.file	"lights.c"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	lights.c.c400d36d
+	.weak	lights.c.c400d36d
+lights.c.c400d36d:
+	.long	0x73
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x2
+	.long	.LASF1302
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1291
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1292
+	.uleb128 0x1
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1293
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1294
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1295
+	.uleb128 0x1
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1296
+	.uleb128 0x3
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1297
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1298
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1299
+	.uleb128 0x1
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1300
+	.uleb128 0x1
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF1301
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.file 1 "./src/main/io/lights.c"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 2 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0x2
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 3 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x1
+	.uleb128 0x3
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 4 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x2
+	.uleb128 0x4
+	.file 5 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x5
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 6 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x6
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 7 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x7
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 8 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x8
+	.file 9 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 10 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 11 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0xb
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 12 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 13 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0xd
+	.file 14 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.file 15 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0xf
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0xa
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 16 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x10
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 17 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 19 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x13
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.file 20 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x14
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 21 "/usr/include/stdlib.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x15
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x6
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.file 22 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF740
+	.file 23 "/usr/include/x86_64-linux-gnu/bits/waitflags.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h"
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0x18
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.file 25 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x38
+	.uleb128 0x19
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.file 26 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x1a
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF776
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0xc
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 27 "/usr/include/x86_64-linux-gnu/sys/types.h"
+	.byte	0x3
+	.uleb128 0x18b
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h"
+	.byte	0x3
+	.uleb128 0x7e
+	.uleb128 0x1c
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF818
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h"
+	.byte	0x3
+	.uleb128 0x80
+	.uleb128 0x1d
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF819
+	.byte	0x4
+	.file 30 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h"
+	.byte	0x3
+	.uleb128 0x81
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF820
+	.byte	0x4
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h"
+	.byte	0x3
+	.uleb128 0x82
+	.uleb128 0x1f
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF821
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF697
+	.byte	0x3
+	.uleb128 0x90
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF822
+	.file 32 "/usr/include/endian.h"
+	.byte	0x3
+	.uleb128 0xb0
+	.uleb128 0x20
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF823
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x21
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x22
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.file 35 "/usr/include/x86_64-linux-gnu/bits/byteswap.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h"
+	.byte	0x3
+	.uleb128 0x24
+	.uleb128 0x24
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF840
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x4
+	.file 37 "/usr/include/x86_64-linux-gnu/sys/select.h"
+	.byte	0x3
+	.uleb128 0xb3
+	.uleb128 0x25
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF853
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/select.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF858
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h"
+	.byte	0x3
+	.uleb128 0x4
+	.uleb128 0x28
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h"
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x29
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF861
+	.byte	0x4
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x2a
+	.byte	0x5
+	.uleb128 0x3
+	.long	.LASF862
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h"
+	.byte	0x3
+	.uleb128 0xe3
+	.uleb128 0x2b
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF879
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x2c
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF880
+	.file 45 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h"
+	.byte	0x3
+	.uleb128 0x2c
+	.uleb128 0x2d
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF881
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x9
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.file 46 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h"
+	.byte	0x3
+	.uleb128 0x2e
+	.uleb128 0x2e
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF893
+	.byte	0x4
+	.file 47 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h"
+	.byte	0x3
+	.uleb128 0x4c
+	.uleb128 0x2f
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 48 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h"
+	.byte	0x3
+	.uleb128 0x59
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF900
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF901
+	.byte	0x4
+	.byte	0x4
+	.file 49 "/usr/include/alloca.h"
+	.byte	0x3
+	.uleb128 0x24b
+	.uleb128 0x31
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF905
+	.file 50 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h"
+	.byte	0x3
+	.uleb128 0x34e
+	.uleb128 0x32
+	.byte	0x4
+	.file 51 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h"
+	.byte	0x3
+	.uleb128 0x40c
+	.uleb128 0x33
+	.byte	0x4
+	.byte	0x4
+	.file 52 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x5
+	.uleb128 0x34
+	.file 53 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.file 54 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x36
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.file 55 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x37
+	.byte	0x4
+	.file 56 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x38
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.byte	0x4
+	.byte	0x4
+	.file 57 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x7
+	.uleb128 0x39
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.file 58 "./src/main/drivers/time.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x3a
+	.file 59 "./src/main/common/time.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x3b
+	.file 60 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x3c
+	.file 61 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x17
+	.uleb128 0x3d
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x4
+	.file 62 "./src/main/drivers/lights_io.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x3e
+	.byte	0x4
+	.file 63 "./src/main/rx/rx.h"
+	.byte	0x3
+	.uleb128 0xc
+	.uleb128 0x3f
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.file 64 "./src/main/fc/config.h"
+	.byte	0x3
+	.uleb128 0xe
+	.uleb128 0x40
+	.file 65 "./src/main/drivers/adc.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x41
+	.file 66 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x42
+	.byte	0x7
+	.long	.Ldebug_macro52
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1186
+	.byte	0x4
+	.file 67 "./src/main/drivers/rx_pwm.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x43
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1187
+	.byte	0x4
+	.file 68 "./src/main/fc/stats.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x44
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro53
+	.byte	0x4
+	.file 69 "./src/main/fc/rc_controls.h"
+	.byte	0x3
+	.uleb128 0xf
+	.uleb128 0x45
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1191
+	.byte	0x4
+	.file 70 "./src/main/fc/rc_modes.h"
+	.byte	0x3
+	.uleb128 0x10
+	.uleb128 0x46
+	.file 71 "./src/main/common/bitarray.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x47
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro54
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro55
+	.byte	0x4
+	.file 72 "./src/main/fc/runtime_config.h"
+	.byte	0x3
+	.uleb128 0x11
+	.uleb128 0x48
+	.byte	0x7
+	.long	.Ldebug_macro56
+	.byte	0x4
+	.file 73 "./src/main/scheduler/scheduler.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x49
+	.byte	0x7
+	.long	.Ldebug_macro57
+	.byte	0x4
+	.file 74 "./src/main/config/feature.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x4a
+	.byte	0x4
+	.file 75 "./src/main/config/parameter_group_ids.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x4b
+	.byte	0x7
+	.long	.Ldebug_macro58
+	.byte	0x4
+	.file 76 "./src/main/io/lights.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x4c
+	.byte	0x4
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.29.dde59e751a3b6c4506ba901b60a85c87,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF697
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF699
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.185.882514a1a6169ceba9142f401cbe27c6,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF701
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF703
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF705
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF717
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF729
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF730
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF731
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF734
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF735
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitflags.h.25.33c1a56564084888d0719c1519fd9fc3,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF749
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.waitstatus.h.28.93f167f49d64e2b9b99f98d1162a93bf,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF761
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.44.de490c7fb444141d2d41184184bda172,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF765
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF768
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF775
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF797
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdlib.h.72.de5e691360230fc4ee32b7e80b84f95c,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF803
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.23.8c135527049415ffe7efcf8247fa202f,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF817
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.237.1f61be91cef0ba0db0d8c26bca1f54cc,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF827
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF829
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF831
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.27.4c4f94262c4eaee2982fe00ed1b4f173,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF835
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.byteswap.h.24.5363c019348146aada5aeadf51456576,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF839
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.39.30a606dbd99b6c3df61c1f06dbdabd4e,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF852
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.25.df647f04fce2d846f134ede6a14ddf91,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF857
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.__sigset_t.h.2.6b1ab6ff3d7b8fd9c0c42b0d80afbd80,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF860
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.select.h.44.887a4ff60aa97fcd9c1be017735e1675,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF863
+	.byte	0x6
+	.uleb128 0x34
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF874
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.186.489a4ed8f2d29cd358843490f54ddea5,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF878
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.pthreadtypesarch.h.25.6063cba99664c916e22d3a912bcc348a,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF892
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_mutex.h.20.ed51f515172b9be99e450ba83eb5dd99,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF896
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.struct_rwlock.h.21.0254880f2904e3833fb8ae683e0f0330,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF899
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.19.edefa922a76c1cbaaf1e416903ba2d1c,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.alloca.h.29.156e12058824cc23d961c4d3b13031f6,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1d
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF904
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF998
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.d045698d061bdaf9245f5033b3abee66,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1011
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1012
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF718
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF736
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF738
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1013
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1036
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1037
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1038
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1039
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1041
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1042
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1043
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1044
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1045
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1046
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1047
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1048
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1049
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1050
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1051
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1052
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1053
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1054
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1055
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1056
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1057
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1058
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1059
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1066
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1071
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1072
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1074
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1075
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1040
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1076
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1077
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1037
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1083
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1092
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1093
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1094
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1101
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1104
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1112
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1113
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1114
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1115
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1116
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1122
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1123
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1124
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1125
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1126
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1127
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1128
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1145
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1155
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rx.h.26.a5405e8fec121a10c06389447ac5178e,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1165
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1183
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro52:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1185
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.config.h.28.6f554fefa230fd4f6a53aa0ff764aed2,comdat
+.Ldebug_macro53:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1190
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bitarray.h.31.657d1270815df3fa6d5f921d8e15def7,comdat
+.Ldebug_macro54:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1195
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.rc_modes.h.26.432f7ce6649546fde8178141012aa1d0,comdat
+.Ldebug_macro55:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1205
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.runtime_config.h.63.0cbb8fabb906472b838c0ba05aa60442,comdat
+.Ldebug_macro56:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1216
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.scheduler.h.35.d0d785404ac74fe33f68f976f92c394d,comdat
+.Ldebug_macro57:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1221
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group_ids.h.19.215a154d975422c7de427a04a2006d7d,comdat
+.Ldebug_macro58:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1258
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1271
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1290
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x12
+	.long	.LASF1
+	.long	.LASF1303
+	.long	.LASF1304
+	.long	.LASF1305
+	.long	.LASF1306
+	.long	.LASF1307
+	.long	.LASF1308
+	.long	.LASF1309
+	.long	.LASF1310
+	.long	.LASF1311
+	.long	.LASF1312
+	.long	.LASF1313
+	.long	.LASF1314
+	.long	.LASF1315
+	.long	.LASF1316
+	.long	.LASF1317
+	.long	.LASF1318
+	.long	.LASF1319
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x4d
+	.long	.LASF0
+	.byte	0
+	.long	.LASF1320
+	.byte	0x6
+	.long	.LASF1321
+	.byte	0x10
+	.long	.LASF1322
+	.byte	0x11
+	.long	.LASF1323
+	.byte	0x11
+	.long	.LASF1323
+	.byte	0x10
+	.long	.LASF1324
+	.byte	0xd
+	.long	.LASF1325
+	.byte	0x10
+	.long	.LASF1326
+	.byte	0x10
+	.long	.LASF1327
+	.byte	0xd
+	.long	.LASF1328
+	.byte	0xd
+	.long	.LASF1329
+	.byte	0xf
+	.long	.LASF1330
+	.byte	0xd
+	.long	.LASF1331
+	.byte	0xe
+	.long	.LASF1332
+	.byte	0xe
+	.long	.LASF1333
+	.byte	0xd
+	.long	.LASF1334
+	.byte	0xd
+	.long	.LASF1335
+	.byte	0xd
+	.long	.LASF1336
+	.byte	0xd
+	.long	.LASF1337
+	.byte	0xd
+	.long	.LASF1338
+	.byte	0xd
+	.long	.LASF1339
+	.byte	0x10
+	.long	.LASF1340
+	.byte	0x11
+	.long	.LASF1341
+	.byte	0xd
+	.long	.LASF1342
+	.byte	0xd
+	.long	.LASF1343
+	.byte	0xd
+	.long	.LASF1344
+	.byte	0xd
+	.long	.LASF1333
+	.byte	0xf
+	.long	.LASF1345
+	.byte	0xc
+	.long	.LASF1346
+	.byte	0xc
+	.long	.LASF1347
+	.byte	0xc
+	.long	.LASF1348
+	.byte	0xc
+	.long	.LASF1349
+	.byte	0x10
+	.long	.LASF1349
+	.byte	0xd
+	.long	.LASF1350
+	.byte	0xd
+	.long	.LASF1351
+	.byte	0xd
+	.long	.LASF1352
+	.byte	0xd
+	.long	.LASF1353
+	.byte	0xf
+	.long	.LASF1353
+	.byte	0xd
+	.long	.LASF1354
+	.byte	0xc
+	.long	.LASF1355
+	.byte	0xc
+	.long	.LASF1356
+	.byte	0xc
+	.long	.LASF1357
+	.byte	0xc
+	.long	.LASF1358
+	.byte	0xd
+	.long	.LASF1359
+	.byte	0xd
+	.long	.LASF1360
+	.byte	0xd
+	.long	.LASF1361
+	.byte	0xd
+	.long	.LASF1362
+	.byte	0xd
+	.long	.LASF1363
+	.byte	0xd
+	.long	.LASF1364
+	.byte	0x10
+	.long	.LASF1365
+	.byte	0xd
+	.long	.LASF1366
+	.byte	0xd
+	.long	.LASF1367
+	.byte	0xb
+	.long	.LASF1368
+	.byte	0xa
+	.long	.LASF1369
+	.byte	0x9
+	.long	.LASF1370
+	.byte	0xa
+	.long	.LASF1371
+	.byte	0xa
+	.long	.LASF1372
+	.byte	0x2
+	.long	.LASF1373
+	.byte	0x4
+	.long	.LASF1373
+	.byte	0x2
+	.long	.LASF1374
+	.byte	0x3
+	.long	.LASF1375
+	.byte	0x1
+	.long	.LASF1376
+	.byte	0x4
+	.long	.LASF1377
+	.byte	0x7
+	.long	.LASF1378
+	.byte	0x5
+	.long	.LASF1379
+	.byte	0x4
+	.long	.LASF1380
+	.byte	0x4
+	.long	.LASF1381
+	.byte	0x4
+	.long	.LASF1382
+	.byte	0x5
+	.long	.LASF1383
+	.byte	0x5
+	.long	.LASF1384
+	.byte	0x5
+	.long	.LASF1385
+	.byte	0x2
+	.long	.LASF1386
+	.byte	0x5
+	.long	.LASF1387
+	.byte	0x8
+	.long	.LASF1388
+	.byte	0x3
+	.long	.LASF1389
+	.byte	0x3
+	.long	.LASF1390
+	.byte	0x6
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF810:
+	.string	"__nlink_t_defined "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF892:
+	.string	"__ONCE_ALIGNMENT "
+.LASF948:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1266:
+	.string	"PG_RANGEFINDER_CONFIG 1006"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF878:
+	.string	"__fsfilcnt_t_defined "
+.LASF943:
+	.string	"USE_OPFLOW "
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF771:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF888:
+	.string	"__SIZEOF_PTHREAD_CONDATTR_T 4"
+.LASF779:
+	.string	"__HAVE_FLOAT64 1"
+.LASF915:
+	.string	"USE_SERIALRX_FPORT "
+.LASF806:
+	.string	"__ino_t_defined "
+.LASF1091:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF784:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF1192:
+	.string	"BITARRAY_DECLARE(name,bits) bitarrayElement_t name[(bits + 31) / 32]"
+.LASF844:
+	.string	"le16toh(x) __uint16_identity (x)"
+.LASF791:
+	.string	"__f64(x) x ##f64"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF986:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF956:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF920:
+	.string	"USE_GPS "
+.LASF1201:
+	.string	"MODE_STEP_TO_CHANNEL_VALUE(step) (CHANNEL_RANGE_MIN + CHANNEL_RANGE_STEP_WIDTH * step)"
+.LASF1259:
+	.string	"PG_INAV_START 1000"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF847:
+	.string	"be32toh(x) __bswap_32 (x)"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF819:
+	.string	"__clockid_t_defined 1"
+.LASF1144:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF489:
+	.string	"__flexarr []"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1212:
+	.string	"ENABLE_FLIGHT_MODE(mask) enableFlightMode(mask)"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1223:
+	.string	"PG_FAILSAFE_CONFIG 1"
+.LASF909:
+	.string	"USE_I2C_PULLUP "
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF1177:
+	.string	"MAX_AUX_CHANNEL_COUNT (MAX_SUPPORTED_RC_CHANNEL_COUNT - NON_AUX_CHANNEL_COUNT)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF856:
+	.string	"__FD_CLR(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] &= ~__FD_MASK(d)))"
+.LASF1063:
+	.string	"U_ID_0 0"
+.LASF833:
+	.string	"BIG_ENDIAN __BIG_ENDIAN"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF1173:
+	.string	"RSSI_MAX_VALUE 1023"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF768:
+	.string	"WIFCONTINUED(status) __WIFCONTINUED (status)"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1274:
+	.string	"PG_LIGHTS_CONFIG 1014"
+.LASF1013:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF743:
+	.string	"WSTOPPED 2"
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF916:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1074:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF373:
+	.string	"linux 1"
+.LASF1028:
+	.string	"USE_UART7 "
+.LASF1037:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF1141:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1172:
+	.string	"DELAY_5_HZ (1000000 / 5)"
+.LASF1150:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1290:
+	.string	"PG_ID_LAST PG_INAV_END"
+.LASF923:
+	.string	"USE_TELEMETRY "
+.LASF752:
+	.string	"__WSTOPSIG(status) __WEXITSTATUS(status)"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF925:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1142:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF866:
+	.string	"__FD_ELT(d) ((d) / __NFDBITS)"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF854:
+	.string	"__FD_ZERO(s) do { unsigned int __i; fd_set *__arr = (s); for (__i = 0; __i < sizeof (fd_set) / sizeof (__fd_mask); ++__i) __FDS_BITS (__arr)[__i] = 0; } while (0)"
+.LASF351:
+	.string	"__x86_64 1"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF476:
+	.string	"__P(args) args"
+.LASF822:
+	.string	"__BIT_TYPES_DEFINED__ 1"
+.LASF887:
+	.string	"__SIZEOF_PTHREAD_COND_T 48"
+.LASF701:
+	.string	"__SIZE_T__ "
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1106:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF969:
+	.string	"CMS_MENU_OSD "
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF816:
+	.string	"__daddr_t_defined "
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF981:
+	.string	"USE_SERIALRX_SUMD "
+.LASF736:
+	.string	"__need_wchar_t"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF728:
+	.string	"_WCHAR_T_DEFINED "
+.LASF793:
+	.string	"__f64x(x) x ##f64x"
+.LASF1015:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF869:
+	.string	"FD_SETSIZE __FD_SETSIZE"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1007:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF778:
+	.string	"__HAVE_FLOAT32 1"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF715:
+	.string	"_GCC_SIZE_T "
+.LASF1235:
+	.string	"PG_FEATURE_CONFIG 19"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF1211:
+	.string	"DISABLE_FLIGHT_MODE(mask) disableFlightMode(mask)"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1285:
+	.string	"PG_RESERVED_FOR_TESTING_1 4095"
+.LASF825:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF705:
+	.string	"_T_SIZE "
+.LASF820:
+	.string	"__time_t_defined 1"
+.LASF1102:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF996:
+	.string	"USE_CLI_BATCH "
+.LASF947:
+	.string	"USE_1WIRE "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF898:
+	.string	"__PTHREAD_RWLOCK_ELISION_EXTRA 0, { 0, 0, 0, 0, 0, 0, 0 }"
+.LASF1283:
+	.string	"PG_GLOBAL_VARIABLE_CONFIG 1023"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1234:
+	.string	"PG_SYSTEM_CONFIG 18"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1228:
+	.string	"PG_GYRO_CONFIG 10"
+.LASF1064:
+	.string	"U_ID_1 1"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF1227:
+	.string	"PG_MOTOR_CONFIG 6"
+.LASF1057:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF880:
+	.string	"_THREAD_SHARED_TYPES_H 1"
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1043:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF876:
+	.string	"__blkcnt_t_defined "
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF767:
+	.string	"WIFSTOPPED(status) __WIFSTOPPED (status)"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF980:
+	.string	"USE_RX_MSP "
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF513:
+	.string	"__always_inline"
+.LASF703:
+	.string	"_SYS_SIZE_T_H "
+.LASF914:
+	.string	"USE_SERIALRX_IBUS "
+.LASF824:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1125:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1302:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF1297:
+	.string	"long int"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF838:
+	.string	"__bswap_constant_32(x) ((((x) & 0xff000000u) >> 24) | (((x) & 0x00ff0000u) >> 8) | (((x) & 0x0000ff00u) << 8) | (((x) & 0x000000ffu) << 24))"
+.LASF858:
+	.string	"__sigset_t_defined 1"
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF1121:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF1127:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF942:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF700:
+	.string	"__size_t__ "
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF374:
+	.string	"__unix 1"
+.LASF1238:
+	.string	"PG_IMU_CONFIG 22"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1111:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1097:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF827:
+	.string	"__PDP_ENDIAN 3412"
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1248:
+	.string	"PG_COMPASS_CONFIG 40"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF755:
+	.string	"__WIFSTOPPED(status) (((status) & 0xff) == 0x7f)"
+.LASF1040:
+	.string	"USE_DASHBOARD"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1169:
+	.string	"DEFAULT_SERVO_MAX 2000"
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF1122:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1080:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF789:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF864:
+	.string	"__NFDBITS"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF802:
+	.string	"EXIT_SUCCESS 0"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF893:
+	.string	"_BITS_ATOMIC_WIDE_COUNTER_H "
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1131:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF1191:
+	.string	"AIRMODE_THROTTLE_THRESHOLD 1300"
+.LASF1295:
+	.string	"signed char"
+.LASF863:
+	.string	"__suseconds_t_defined "
+.LASF1263:
+	.string	"PG_MODE_ACTIVATION_OPERATOR_CONFIG 1003"
+.LASF836:
+	.string	"_BITS_BYTESWAP_H 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF978:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF1210:
+	.string	"ARMING_FLAG(mask) (armingFlags & (mask))"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1161:
+	.string	"PWM_PULSE_MAX 2250"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF1240:
+	.string	"PG_RC_CONTROLS_CONFIG 25"
+.LASF1217:
+	.string	"TASK_HISTOGRAM_BUCKET_COUNT 16"
+.LASF952:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1036:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF805:
+	.string	"__u_char_defined "
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1101:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF1291:
+	.string	"unsigned char"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF1275:
+	.string	"PG_PINIOBOX_CONFIG 1015"
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1204:
+	.string	"MAX_MODE_RANGE_STEP ((CHANNEL_RANGE_MAX - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF1198:
+	.string	"CHANNEL_RANGE_MIN 900"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1022:
+	.string	"USE_UART1 "
+.LASF713:
+	.string	"__DEFINED_size_t "
+.LASF1244:
+	.string	"PG_TELEMETRY_CONFIG 31"
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF865:
+	.string	"__NFDBITS (8 * (int) sizeof (__fd_mask))"
+.LASF1081:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF924:
+	.string	"USE_TELEMETRY_LTM "
+.LASF1077:
+	.string	"NOINLINE "
+.LASF1070:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF867:
+	.string	"__FD_MASK(d) ((__fd_mask) (1UL << ((d) % __NFDBITS)))"
+.LASF1024:
+	.string	"USE_UART3 "
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF933:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF1044:
+	.string	"USE_RANGEFINDER"
+.LASF813:
+	.string	"__pid_t_defined "
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF1137:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF1055:
+	.string	"USE_VCP"
+.LASF873:
+	.string	"FD_ISSET(fd,fdsetp) __FD_ISSET (fd, fdsetp)"
+.LASF1301:
+	.string	"_Bool"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF709:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF737:
+	.string	"NULL"
+.LASF1180:
+	.string	"RSSI_VISIBLE_VALUE_MIN 0"
+.LASF912:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF899:
+	.string	"__PTHREAD_RWLOCK_INITIALIZER(__flags) 0, 0, 0, 0, 0, 0, 0, 0, __PTHREAD_RWLOCK_ELISION_EXTRA, 0, __flags"
+.LASF1298:
+	.string	"char"
+.LASF1123:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF775:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF698:
+	.string	"__need_wchar_t "
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1082:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF697:
+	.string	"__need_size_t "
+.LASF950:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF1094:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1152:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF747:
+	.string	"__WNOTHREAD 0x20000000"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF1018:
+	.string	"USE_FAKE_MAG "
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF799:
+	.string	"__lldiv_t_defined 1"
+.LASF1087:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1202:
+	.string	"CHANNEL_VALUE_TO_STEP(channelValue) ((constrain(channelValue, CHANNEL_RANGE_MIN, CHANNEL_RANGE_MAX) - CHANNEL_RANGE_MIN) / CHANNEL_RANGE_STEP_WIDTH)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF895:
+	.string	"__PTHREAD_MUTEX_HAVE_PREV 1"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF1107:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF1066:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1218:
+	.string	"TASK_PERIOD_HZ(hz) (1000000 / (hz))"
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF766:
+	.string	"WIFSIGNALED(status) __WIFSIGNALED (status)"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF907:
+	.string	"I2C1_OVERCLOCK false"
+.LASF795:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF794:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1126:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF760:
+	.string	"__W_CONTINUED 0xffff"
+.LASF1076:
+	.string	"FAST_CODE "
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF1271:
+	.string	"PG_TIME_CONFIG 1011"
+.LASF967:
+	.string	"USE_STATS "
+.LASF958:
+	.string	"USE_FRSKYOSD "
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF985:
+	.string	"USE_SERIALRX_CRSF "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF1264:
+	.string	"PG_OSD_CONFIG 1004"
+.LASF882:
+	.string	"__SIZEOF_PTHREAD_MUTEX_T 40"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF868:
+	.string	"__FDS_BITS(set) ((set)->__fds_bits)"
+.LASF845:
+	.string	"htobe32(x) __bswap_32 (x)"
+.LASF1185:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1194:
+	.string	"BITARRAY_CLR_ALL(array) bitArrayClrAll(array, sizeof(array))"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF1203:
+	.string	"MIN_MODE_RANGE_STEP 0"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF731:
+	.string	"__INT_WCHAR_T_H "
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1215:
+	.string	"ENABLE_STATE(mask) (stateFlags |= (mask))"
+.LASF718:
+	.string	"__need_size_t"
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF937:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF911:
+	.string	"USE_SERIAL_RX "
+.LASF862:
+	.string	"_STRUCT_TIMESPEC 1"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF913:
+	.string	"USE_SERIALRX_SBUS "
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF993:
+	.string	"USE_VTX_FFPV "
+.LASF818:
+	.string	"__clock_t_defined 1"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1033:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1093:
+	.string	"STR_HELPER(x) #x"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1197:
+	.string	"MAX_MODE_ACTIVATION_CONDITION_COUNT 20"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF726:
+	.string	"_BSD_WCHAR_T_ "
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF800:
+	.string	"RAND_MAX 2147483647"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF1136:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF965:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF979:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF1119:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF1090:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF738:
+	.string	"NULL ((void *)0)"
+.LASF1088:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF1245:
+	.string	"PG_ACCELEROMETER_CONFIG 35"
+.LASF1038:
+	.string	"USE_USB_MSC"
+.LASF1065:
+	.string	"U_ID_2 2"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF883:
+	.string	"__SIZEOF_PTHREAD_ATTR_T 56"
+.LASF1260:
+	.string	"PG_PITOTMETER_CONFIG 1000"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1148:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1029:
+	.string	"USE_UART8 "
+.LASF785:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1219:
+	.string	"TASK_PERIOD_MS(ms) ((ms) * 1000)"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF843:
+	.string	"be16toh(x) __bswap_16 (x)"
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF783:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF968:
+	.string	"USE_CMS "
+.LASF1105:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1236:
+	.string	"PG_MIXER_CONFIG 20"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF927:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF870:
+	.string	"NFDBITS __NFDBITS"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF960:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF994:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF742:
+	.string	"WUNTRACED 2"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF1133:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1171:
+	.string	"DELAY_10_HZ (1000000 / 10)"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1294:
+	.string	"long unsigned int"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF886:
+	.string	"__SIZEOF_PTHREAD_MUTEXATTR_T 4"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF928:
+	.string	"USE_PITOT "
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF19:
+	.string	"__pie__ 2"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF1073:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF1252:
+	.string	"PG_BATTERY_METERS_CONFIG 45"
+.LASF704:
+	.string	"_T_SIZE_ "
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF782:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF1071:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF1273:
+	.string	"PG_DISPLAY_CONFIG 1013"
+.LASF1098:
+	.string	"UNUSED(x) (void)(x)"
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1120:
+	.string	"EXTENDED_FASTRAM "
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1186:
+	.string	"ADC_AVERAGE_N_SAMPLES 20"
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF359:
+	.string	"__k8__ 1"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1086:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF1229:
+	.string	"PG_BATTERY_PROFILES 11"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF699:
+	.string	"__need_NULL "
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1165:
+	.string	"CHANNEL_VALUE_TO_RXFAIL_STEP(channelValue) ((constrain(channelValue, PWM_PULSE_MIN, PWM_PULSE_MAX) - PWM_PULSE_MIN) / 25)"
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF744:
+	.string	"WEXITED 4"
+.LASF999:
+	.string	"_STDDEF_H "
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF984:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF1241:
+	.string	"PG_REVERSIBLE_MOTORS_CONFIG 26"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1257:
+	.string	"PG_CF_END 56"
+.LASF1170:
+	.string	"DELAY_50_HZ (1000000 / 50)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF1189:
+	.string	"ONESHOT_FEATURE_CHANGED_DELAY_ON_BOOT_MS 1500"
+.LASF1108:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF804:
+	.string	"_SYS_TYPES_H 1"
+.LASF1016:
+	.string	"USE_IMU_FAKE "
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF1084:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF1286:
+	.string	"PG_RESERVED_FOR_TESTING_2 4094"
+.LASF849:
+	.string	"htobe64(x) __bswap_64 (x)"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1030:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1008:
+	.string	"___int_ptrdiff_t_h "
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF796:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF1116:
+	.string	"UNIT_TESTED "
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF991:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF1256:
+	.string	"PG_TEMP_SENSOR_CONFIG 56"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF1003:
+	.string	"_T_PTRDIFF_ "
+.LASF1019:
+	.string	"USE_FAKE_GPS "
+.LASF1214:
+	.string	"DISABLE_STATE(mask) (stateFlags &= ~(mask))"
+.LASF1132:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1278:
+	.string	"PG_RCDEVICE_CONFIG 1018"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF1006:
+	.string	"_PTRDIFF_T_ "
+.LASF780:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF921:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF926:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF765:
+	.string	"WIFEXITED(status) __WIFEXITED (status)"
+.LASF853:
+	.string	"_SYS_SELECT_H 1"
+.LASF722:
+	.string	"_T_WCHAR_ "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF1067:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF1089:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF1143:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF890:
+	.string	"__SIZEOF_PTHREAD_BARRIERATTR_T 4"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF900:
+	.string	"__ONCE_FLAG_INIT { 0 }"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF992:
+	.string	"USE_VTX_TRAMP "
+.LASF1047:
+	.string	"USE_PITOT_MS4525"
+.LASF707:
+	.string	"_SIZE_T_ "
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF817:
+	.string	"__key_t_defined "
+.LASF1299:
+	.string	"long long int"
+.LASF1222:
+	.string	"PG_CF_START 1"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF719:
+	.string	"__wchar_t__ "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF837:
+	.string	"__bswap_constant_16(x) ((__uint16_t) ((((x) >> 8) & 0xff) | (((x) & 0xff) << 8)))"
+.LASF788:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1181:
+	.string	"RSSI_VISIBLE_VALUE_MAX 100"
+.LASF1224:
+	.string	"PG_BOARD_ALIGNMENT 2"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF724:
+	.string	"__WCHAR_T "
+.LASF1128:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF983:
+	.string	"USE_SERIALRX_XBUS "
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1134:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1205:
+	.string	"IS_RANGE_USABLE(range) ((range)->startStep < (range)->endStep)"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF1058:
+	.string	"USE_RCDEVICE"
+.LASF832:
+	.string	"LITTLE_ENDIAN __LITTLE_ENDIAN"
+.LASF466:
+	.string	"__PMT"
+.LASF971:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1247:
+	.string	"PG_BAROMETER_CONFIG 38"
+.LASF946:
+	.string	"USE_PITOT_MS4525 "
+.LASF1158:
+	.string	"PWM_RANGE_MAX 2000"
+.LASF848:
+	.string	"le32toh(x) __uint32_identity (x)"
+.LASF1187:
+	.string	"PPM_RCVR_TIMEOUT 0"
+.LASF774:
+	.string	"__f128(x) x ##f128"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF901:
+	.string	"__have_pthread_attr_t 1"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1083:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1001:
+	.string	"_ANSI_STDDEF_H "
+.LASF850:
+	.string	"htole64(x) __uint64_identity (x)"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1155:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF358:
+	.string	"__k8 1"
+.LASF1268:
+	.string	"PG_PID_AUTOTUNE_CONFIG 1008"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF770:
+	.string	"__HAVE_FLOAT128 1"
+.LASF851:
+	.string	"be64toh(x) __bswap_64 (x)"
+.LASF1231:
+	.string	"PG_SERIAL_CONFIG 13"
+.LASF757:
+	.string	"__WCOREDUMP(status) ((status) & __WCOREFLAG)"
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1293:
+	.string	"unsigned int"
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF957:
+	.string	"USE_TELEMETRY_SIM "
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1188:
+	.string	"MAX_PROFILE_COUNT 3"
+.LASF1048:
+	.string	"USE_PITOT_ADC"
+.LASF1046:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF997:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF420:
+	.string	"__USE_MISC"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1196:
+	.string	"BOXID_NONE 255"
+.LASF733:
+	.string	"_WCHAR_T_DECLARED "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF974:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF1004:
+	.string	"_T_PTRDIFF "
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1100:
+	.string	"BIT(x) (1 << (x))"
+.LASF1002:
+	.string	"_PTRDIFF_T "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1035:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF903:
+	.string	"alloca"
+.LASF1168:
+	.string	"DEFAULT_SERVO_MIDDLE 1500"
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1061:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF976:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF1281:
+	.string	"PG_ESC_SENSOR_CONFIG 1021"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF932:
+	.string	"USE_GYRO_KALMAN "
+.LASF712:
+	.string	"_SIZE_T_DECLARED "
+.LASF512:
+	.string	"__wur "
+.LASF908:
+	.string	"I2C2_OVERCLOCK false"
+.LASF1147:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF852:
+	.string	"le64toh(x) __uint64_identity (x)"
+.LASF396:
+	.string	"false 0"
+.LASF814:
+	.string	"__id_t_defined "
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF857:
+	.string	"__FD_ISSET(d,s) ((__FDS_BITS (s)[__FD_ELT (d)] & __FD_MASK (d)) != 0)"
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1183:
+	.string	"REMAPPABLE_CHANNEL_COUNT (sizeof(((rxConfig_t *)0)->rcmap) / sizeof(((rxConfig_t *)0)->rcmap[0]))"
+.LASF395:
+	.string	"true 1"
+.LASF1010:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF751:
+	.string	"__WTERMSIG(status) ((status) & 0x7f)"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF750:
+	.string	"__WEXITSTATUS(status) (((status) & 0xff00) >> 8)"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF940:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF787:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1280:
+	.string	"PG_GLOBAL_FUNCTIONS 1020"
+.LASF764:
+	.string	"WSTOPSIG(status) __WSTOPSIG (status)"
+.LASF963:
+	.string	"USE_ANTIGRAVITY "
+.LASF739:
+	.string	"__need_NULL"
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF714:
+	.string	"___int_size_t_h "
+.LASF721:
+	.string	"_WCHAR_T "
+.LASF781:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF1017:
+	.string	"USE_FAKE_BARO "
+.LASF711:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF1009:
+	.string	"_GCC_PTRDIFF_T "
+.LASF922:
+	.string	"USE_NAV "
+.LASF859:
+	.string	"____sigset_t_defined "
+.LASF1020:
+	.string	"USE_MAG "
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF885:
+	.string	"__SIZEOF_PTHREAD_BARRIER_T 32"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF702:
+	.string	"_SIZE_T "
+.LASF729:
+	.string	"_WCHAR_T_H "
+.LASF975:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF1237:
+	.string	"PG_SERVO_MIXER 21"
+.LASF1176:
+	.string	"NON_AUX_CHANNEL_COUNT 4"
+.LASF1230:
+	.string	"PG_CONTROL_RATE_PROFILES 12"
+.LASF1225:
+	.string	"PG_MOTOR_MIXER 4"
+.LASF964:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF839:
+	.ascii	"__bswap_constant_64(x) ((((x) & 0xff00000000000000ull) >> 56"
+	.ascii	") | (((x) & 0x00ff000000"
+	.string	"000000ull) >> 40) | (((x) & 0x0000ff0000000000ull) >> 24) | (((x) & 0x000000ff00000000ull) >> 8) | (((x) & 0x00000000ff000000ull) << 8) | (((x) & 0x0000000000ff0000ull) << 24) | (((x) & 0x000000000000ff00ull) << 40) | (((x) & 0x00000000000000ffull) << 56))"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF902:
+	.string	"_ALLOCA_H 1"
+.LASF906:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1032:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1232:
+	.string	"PG_PID_PROFILE 14"
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF1272:
+	.string	"PG_OPFLOW_CONFIG 1012"
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF934:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF1000:
+	.string	"_STDDEF_H_ "
+.LASF1045:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1138:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF706:
+	.string	"__SIZE_T "
+.LASF977:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF823:
+	.string	"_ENDIAN_H 1"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1195:
+	.string	"BITARRAY_FIND_FIRST_SET(array,start_bit) bitArrayFindFirstSet(array, start_bit, sizeof(array))"
+.LASF855:
+	.string	"__FD_SET(d,s) ((void) (__FDS_BITS (s)[__FD_ELT(d)] |= __FD_MASK(d)))"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1175:
+	.string	"MAX_SUPPORTED_RC_CHANNEL_COUNT 18"
+.LASF1112:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF1153:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF987:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF762:
+	.string	"WEXITSTATUS(status) __WEXITSTATUS (status)"
+.LASF1226:
+	.string	"PG_BLACKBOX_CONFIG 5"
+.LASF773:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF840:
+	.string	"_BITS_UINTN_IDENTITY_H 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF1269:
+	.string	"PG_STATS_CONFIG 1009"
+.LASF1110:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF732:
+	.string	"_GCC_WCHAR_T "
+.LASF1270:
+	.string	"PG_ADC_CHANNEL_CONFIG 1010"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1085:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1184:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF745:
+	.string	"WCONTINUED 8"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF860:
+	.string	"_SIGSET_NWORDS (1024 / (8 * sizeof (unsigned long int)))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1207:
+	.string	"isArmingDisabled() (armingFlags & (ARMING_DISABLED_ALL_FLAGS))"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF970:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1042:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF935:
+	.string	"USE_RX_UIB "
+.LASF1103:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1300:
+	.string	"long long unsigned int"
+.LASF383:
+	.string	"SITL 1"
+.LASF786:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF761:
+	.string	"__WCOREFLAG 0x80"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1242:
+	.string	"PG_LED_STRIP_CONFIG 27"
+.LASF710:
+	.string	"_SIZE_T_DEFINED "
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF815:
+	.string	"__ssize_t_defined "
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF1005:
+	.string	"__PTRDIFF_T "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF962:
+	.string	"USE_D_BOOST "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF803:
+	.string	"MB_CUR_MAX (__ctype_get_mb_cur_max ())"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1014:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF821:
+	.string	"__timer_t_defined 1"
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF1206:
+	.string	"ARMING_DISABLED_EMERGENCY_OVERRIDE (ARMING_DISABLED_NOT_LEVEL | ARMING_DISABLED_NAVIGATION_UNSAFE | ARMING_DISABLED_COMPASS_NOT_CALIBRATED | ARMING_DISABLED_ACCELEROMETER_NOT_CALIBRATED | ARMING_DISABLED_ARM_SWITCH | ARMING_DISABLED_HARDWARE_FAILURE)"
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF756:
+	.string	"__WIFCONTINUED(status) ((status) == __W_CONTINUED)"
+.LASF807:
+	.string	"__dev_t_defined "
+.LASF1254:
+	.string	"PG_VTX_CONFIG 54"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF1267:
+	.string	"PG_WAYPOINT_MISSION_STORAGE 1007"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF1289:
+	.string	"PG_ID_FIRST PG_CF_START"
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF826:
+	.string	"__BIG_ENDIAN 4321"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF1253:
+	.string	"PG_SERVO_CONFIG 52"
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1026:
+	.string	"USE_UART5 "
+.LASF1139:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF954:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF897:
+	.string	"_RWLOCK_INTERNAL_H "
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF1075:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF717:
+	.string	"__size_t "
+.LASF872:
+	.string	"FD_CLR(fd,fdsetp) __FD_CLR (fd, fdsetp)"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1255:
+	.string	"PG_ELERES_CONFIG 55"
+.LASF953:
+	.string	"USE_DASHBOARD "
+.LASF1164:
+	.string	"RXFAIL_STEP_TO_CHANNEL_VALUE(step) (PWM_PULSE_MIN + 25 * step)"
+.LASF961:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF1258:
+	.string	"PG_VTX_SETTINGS_CONFIG 259"
+.LASF748:
+	.string	"__WALL 0x40000000"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF841:
+	.string	"htobe16(x) __bswap_16 (x)"
+.LASF708:
+	.string	"_BSD_SIZE_T_ "
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF905:
+	.string	"__COMPAR_FN_T "
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF881:
+	.string	"_BITS_PTHREADTYPES_ARCH_H 1"
+.LASF1166:
+	.string	"MAX_RXFAIL_RANGE_STEP ((PWM_PULSE_MAX - PWM_PULSE_MIN) / 25)"
+.LASF945:
+	.string	"USE_OPFLOW_MSP "
+.LASF723:
+	.string	"_T_WCHAR "
+.LASF740:
+	.string	"_STDLIB_H 1"
+.LASF1021:
+	.string	"USE_BARO "
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF749:
+	.string	"__WCLONE 0x80000000"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1159:
+	.string	"PWM_RANGE_MIDDLE (PWM_RANGE_MIN + ((PWM_RANGE_MAX - PWM_RANGE_MIN) / 2))"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF944:
+	.string	"USE_OPFLOW_CXOF "
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF988:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF917:
+	.string	"USE_ADC_AVERAGING "
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF874:
+	.string	"FD_ZERO(fdsetp) __FD_ZERO (fdsetp)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1250:
+	.string	"PG_SERVO_PARAMS 42"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF769:
+	.string	"_BITS_FLOATN_H "
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF725:
+	.string	"_WCHAR_T_ "
+.LASF812:
+	.string	"__off_t_defined "
+.LASF938:
+	.string	"USE_RANGEFINDER "
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1060:
+	.string	"USE_ITCM_RAM"
+.LASF1092:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF1261:
+	.string	"PG_POSITION_ESTIMATION_CONFIG 1001"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF990:
+	.string	"USE_VTX_CONTROL "
+.LASF1059:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF727:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF891:
+	.string	"__LOCK_ALIGNMENT "
+.LASF1114:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF772:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1162:
+	.string	"MIDRC_MIN 1200"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1213:
+	.string	"FLIGHT_MODE(mask) (flightModeFlags & (mask))"
+.LASF1135:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF861:
+	.string	"__timeval_defined 1"
+.LASF716:
+	.string	"_SIZET_ "
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF1027:
+	.string	"USE_UART6 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF811:
+	.string	"__uid_t_defined "
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1156:
+	.string	"STICK_CHANNEL_COUNT 4"
+.LASF1182:
+	.string	"RSSI_VISIBLE_FACTOR (RSSI_MAX_VALUE/(float)RSSI_VISIBLE_VALUE_MAX)"
+.LASF835:
+	.string	"BYTE_ORDER __BYTE_ORDER"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF1079:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF930:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF776:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF1052:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF790:
+	.string	"__f32(x) x ##f32"
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1054:
+	.string	"USE_ADC"
+.LASF759:
+	.string	"__W_STOPCODE(sig) ((sig) << 8 | 0x7f)"
+.LASF1050:
+	.string	"USE_1WIRE_DS2482"
+.LASF1129:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF1051:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1243:
+	.string	"PG_GPS_CONFIG 30"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF746:
+	.string	"WNOWAIT 0x01000000"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF1145:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1160:
+	.string	"PWM_PULSE_MIN 750"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1287:
+	.string	"PG_RESERVED_FOR_TESTING_3 4093"
+.LASF1282:
+	.string	"PG_RPM_FILTER_CONFIG 1022"
+.LASF1154:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1296:
+	.string	"short int"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF1265:
+	.string	"PG_BEEPER_CONFIG 1005"
+.LASF1251:
+	.string	"PG_RX_CHANNEL_RANGE_CONFIG 44"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF828:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF918:
+	.string	"USE_64BIT_TIME "
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1157:
+	.string	"PWM_RANGE_MIN 1000"
+.LASF846:
+	.string	"htole32(x) __uint32_identity (x)"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF875:
+	.string	"__blksize_t_defined "
+.LASF941:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1209:
+	.string	"ENABLE_ARMING_FLAG(mask) (armingFlags |= (mask))"
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF939:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1221:
+	.string	"isSystemOverloaded() (averageSystemLoadPercent >= 100)"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF1117:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF1246:
+	.string	"PG_ADJUSTMENT_RANGE_CONFIG 37"
+.LASF1190:
+	.string	"MAX_NAME_LENGTH 16"
+.LASF1146:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF1012:
+	.string	"__need_ptrdiff_t"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF741:
+	.string	"WNOHANG 1"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1118:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF955:
+	.string	"USE_OLED_UG2864 "
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1072:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF720:
+	.string	"__WCHAR_T__ "
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF1284:
+	.string	"PG_INAV_END 1023"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF1279:
+	.string	"PG_GENERAL_SETTINGS 1019"
+.LASF1078:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF734:
+	.string	"__DEFINED_wchar_t "
+.LASF1140:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF792:
+	.string	"__f32x(x) x ##f32x"
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1099:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF1115:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF951:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF763:
+	.string	"WTERMSIG(status) __WTERMSIG (status)"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF896:
+	.string	"__PTHREAD_MUTEX_INITIALIZER(__kind) 0, 0, 0, 0, __kind, 0, 0, { 0, 0 }"
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1095:
+	.string	"EXPAND_I(x) x"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF889:
+	.string	"__SIZEOF_PTHREAD_RWLOCKATTR_T 8"
+.LASF842:
+	.string	"htole16(x) __uint16_identity (x)"
+.LASF1062:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF929:
+	.string	"USE_PITOT_ADC "
+.LASF1199:
+	.string	"CHANNEL_RANGE_MAX 2100"
+.LASF730:
+	.string	"___int_wchar_t_h "
+.LASF1104:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF1179:
+	.string	"MAX_INVALID_RX_PULSE_TIME 300"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF834:
+	.string	"PDP_ENDIAN __PDP_ENDIAN"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF936:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF1053:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1220:
+	.string	"TASK_PERIOD_US(us) (us)"
+.LASF798:
+	.string	"__ldiv_t_defined 1"
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1023:
+	.string	"USE_UART2 "
+.LASF777:
+	.string	"__HAVE_FLOAT16 0"
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1163:
+	.string	"MIDRC_MAX 1700"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF735:
+	.string	"_BSD_WCHAR_T_"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF829:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF1208:
+	.string	"DISABLE_ARMING_FLAG(mask) (armingFlags &= ~(mask))"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF754:
+	.string	"__WIFSIGNALED(status) (((signed char) (((status) & 0x7f) + 1) >> 1) > 0)"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF831:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF349:
+	.string	"__amd64 1"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF758:
+	.string	"__W_EXITCODE(ret,sig) ((ret) << 8 | (sig))"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF1049:
+	.string	"USE_1WIRE"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1034:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF809:
+	.string	"__mode_t_defined "
+.LASF1041:
+	.string	"USE_OLED_UG2864"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF1039:
+	.string	"USE_SERVO_SBUS"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1068:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1216:
+	.string	"STATE(mask) (stateFlags & (mask))"
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF1056:
+	.string	"USE_RX_PPM"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF376:
+	.string	"unix 1"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF1292:
+	.string	"short unsigned int"
+.LASF995:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF973:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF1124:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1031:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF1200:
+	.string	"CHANNEL_RANGE_STEP_WIDTH 25"
+.LASF753:
+	.string	"__WIFEXITED(status) (__WTERMSIG(status) == 0)"
+.LASF1178:
+	.string	"MAX_MAPPABLE_RX_INPUTS 4"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1239:
+	.string	"PG_RX_CONFIG 24"
+.LASF894:
+	.string	"_THREAD_MUTEX_INTERNAL_H 1"
+.LASF1167:
+	.string	"DEFAULT_SERVO_MIN 1000"
+.LASF982:
+	.string	"USE_SERIALRX_SUMH "
+.LASF1011:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF808:
+	.string	"__gid_t_defined "
+.LASF966:
+	.string	"USE_LOG "
+.LASF910:
+	.string	"USE_RX_PPM "
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF919:
+	.string	"USE_BLACKBOX "
+.LASF801:
+	.string	"EXIT_FAILURE 1"
+.LASF1151:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF1109:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF797:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1025:
+	.string	"USE_UART4 "
+.LASF1096:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF989:
+	.string	"USE_RCDEVICE "
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF1130:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF1069:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF879:
+	.string	"_BITS_PTHREADTYPES_COMMON_H 1"
+.LASF1249:
+	.string	"PG_MODE_ACTIVATION_PROFILE 41"
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF1113:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF830:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF371:
+	.string	"__linux 1"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1233:
+	.string	"PG_ARMING_CONFIG 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1276:
+	.string	"PG_LOGIC_CONDITIONS 1016"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF871:
+	.string	"FD_SET(fd,fdsetp) __FD_SET (fd, fdsetp)"
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF998:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1193:
+	.string	"BITARRAY_SET_ALL(array) bitArraySetAll(array, sizeof(array))"
+.LASF904:
+	.string	"alloca(size) __builtin_alloca (size)"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF884:
+	.string	"__SIZEOF_PTHREAD_RWLOCK_T 56"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF931:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1174:
+	.string	"MAX_SUPPORTED_RC_PPM_CHANNEL_COUNT 16"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF972:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF1262:
+	.string	"PG_NAV_CONFIG 1002"
+.LASF1149:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1277:
+	.string	"PG_LOG_CONFIG 1017"
+.LASF949:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1288:
+	.string	"PG_ID_INVALID 0"
+.LASF877:
+	.string	"__fsblkcnt_t_defined "
+.LASF959:
+	.string	"USE_DJI_HD_OSD "
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF1355:
+	.string	"__sigset_t.h"
+.LASF1362:
+	.string	"struct_mutex.h"
+.LASF1371:
+	.string	"common_post.h"
+.LASF1330:
+	.string	"long-double.h"
+.LASF1367:
+	.string	"platform.h"
+.LASF1309:
+	.string	"src/main/rx"
+.LASF1306:
+	.string	"src/main/drivers"
+.LASF1359:
+	.string	"thread-shared-types.h"
+.LASF1324:
+	.string	"libc-header-start.h"
+.LASF1322:
+	.string	"stdbool.h"
+.LASF1317:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF1349:
+	.string	"endian.h"
+.LASF1304:
+	.string	"src/main/common"
+.LASF1337:
+	.string	"stdint-intn.h"
+.LASF1369:
+	.string	"target.h"
+.LASF1316:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF1319:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF1331:
+	.string	"stubs.h"
+.LASF1384:
+	.string	"rc_modes.h"
+.LASF1375:
+	.string	"build_config.h"
+.LASF1311:
+	.string	"src/main/target/SITL"
+.LASF1361:
+	.string	"atomic_wide_counter.h"
+.LASF1308:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF1382:
+	.string	"stats.h"
+.LASF1315:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF1376:
+	.string	"lights_io.h"
+.LASF1378:
+	.string	"config.h"
+.LASF1339:
+	.string	"stdlib.h"
+.LASF1326:
+	.string	"features-time64.h"
+.LASF1360:
+	.string	"pthreadtypes-arch.h"
+.LASF0:
+	.string	"./src/main/io/lights.c"
+.LASF1333:
+	.string	"types.h"
+.LASF1390:
+	.string	"lights.h"
+.LASF1380:
+	.string	"io_types.h"
+.LASF1343:
+	.string	"floatn.h"
+.LASF1328:
+	.string	"timesize.h"
+.LASF1345:
+	.string	"clock_t.h"
+.LASF1318:
+	.string	"/usr/include"
+.LASF1357:
+	.string	"struct_timespec.h"
+.LASF1347:
+	.string	"time_t.h"
+.LASF1303:
+	.string	"src/main/build"
+.LASF1354:
+	.string	"sigset_t.h"
+.LASF1344:
+	.string	"floatn-common.h"
+.LASF1368:
+	.string	"common.h"
+.LASF1334:
+	.string	"typesizes.h"
+.LASF1358:
+	.string	"pthreadtypes.h"
+.LASF1341:
+	.string	"waitflags.h"
+.LASF1356:
+	.string	"struct_timeval.h"
+.LASF1346:
+	.string	"clockid_t.h"
+.LASF1325:
+	.string	"features.h"
+.LASF1335:
+	.string	"time64.h"
+.LASF1338:
+	.string	"stdint-uintn.h"
+.LASF1351:
+	.string	"byteswap.h"
+.LASF1312:
+	.string	"src/main/target"
+.LASF1372:
+	.string	"utils.h"
+.LASF1348:
+	.string	"timer_t.h"
+.LASF1364:
+	.string	"alloca.h"
+.LASF1305:
+	.string	"src/main/config"
+.LASF1388:
+	.string	"feature.h"
+.LASF1342:
+	.string	"waitstatus.h"
+.LASF1387:
+	.string	"scheduler.h"
+.LASF1313:
+	.string	"src/main"
+.LASF1381:
+	.string	"rx_pwm.h"
+.LASF1373:
+	.string	"time.h"
+.LASF1389:
+	.string	"parameter_group_ids.h"
+.LASF1336:
+	.string	"wchar.h"
+.LASF1377:
+	.string	"rx.h"
+.LASF1386:
+	.string	"runtime_config.h"
+.LASF1307:
+	.string	"src/main/fc"
+.LASF1365:
+	.string	"stdlib-bsearch.h"
+.LASF1385:
+	.string	"bitarray.h"
+.LASF1363:
+	.string	"struct_rwlock.h"
+.LASF1314:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF1370:
+	.string	"sanity_check.h"
+.LASF1329:
+	.string	"cdefs.h"
+.LASF1353:
+	.string	"select.h"
+.LASF1383:
+	.string	"rc_controls.h"
+.LASF1323:
+	.string	"stdint.h"
+.LASF1320:
+	.string	"lights.c"
+.LASF1340:
+	.string	"stddef.h"
+.LASF1332:
+	.string	"stubs-64.h"
+.LASF1327:
+	.string	"wordsize.h"
+.LASF1352:
+	.string	"uintn-identity.h"
+.LASF1310:
+	.string	"src/main/scheduler"
+.LASF1379:
+	.string	"adc.h"
+.LASF1374:
+	.string	"parameter_group.h"
+.LASF1350:
+	.string	"endianness.h"
+.LASF1321:
+	.string	"stdc-predef.h"
+.LASF1366:
+	.string	"stdlib-float.h"
+	.text
+	.section	.gnu.lto_.profile.3d2ccbd925b61af0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.3d2ccbd925b61af0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.3d2ccbd925b61af0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.inline.3d2ccbd925b61af0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.jmpfuncs.3d2ccbd925b61af0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.pureconst.3d2ccbd925b61af0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.ipa_modref.3d2ccbd925b61af0,"e",@progbits
+	.string	"(\265/\375 \016E"
+	.string	""
+	.string	"\020\002"
+	.string	"\001"
+	.ascii	"\034\300\002"
+	.text
+	.section	.gnu.lto_.lto.3d2ccbd925b61af0,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.3d2ccbd925b61af0,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.refs.3d2ccbd925b61af0,"e",@progbits
+	.string	"(\265/\375 \005)"
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.decls.3d2ccbd925b61af0,"e",@progbits
+	.string	"(\265/\375 \035\351"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	""
+	.string	""
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\377\377\377\377\001"
+	.string	""
+	.string	""
+	.string	"\333"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.symtab.3d2ccbd925b61af0,"e",@progbits
+	.text
+	.section	.gnu.lto_.ext_symtab.3d2ccbd925b61af0,"e",@progbits
+	.ascii	"\001"
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
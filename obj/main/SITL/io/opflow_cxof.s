@@ -0,0 +1,13711 @@
+	.file	"opflow_cxof.c"
+	.file 1 "/usr/include/x86_64-linux-gnu/bits/types.h"
+	.file 2 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h"
+	.file 3 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h"
+	.file 4 "./src/main/common/time.h"
+	.file 5 "./src/main/drivers/resource.h"
+	.file 6 "./src/main/drivers/serial.h"
+	.file 7 "./src/main/io/serial.h"
+	.file 8 "./src/main/drivers/opflow/opflow.h"
+	.file 9 "./src/main/drivers/opflow/opflow_virtual.h"
+	.file 10 "./src/main/io/opflow.h"
+	.file 11 "./src/main/io/opflow_cxof.c"
+	.file 12 "./src/main/common/maths.h"
+	.file 13 "./src/main/drivers/time.h"
+	.section	.gnu.debuglto_.debug_info,"e",@progbits
+.Ldebug_info0:
+	.hidden	opflow_cxof.c.48afd053
+	.weak	opflow_cxof.c.48afd053
+opflow_cxof.c.48afd053:
+	.long	0xb39
+	.value	0x5
+	.byte	0x1
+	.byte	0x8
+	.long	.Ldebug_abbrev0
+	.uleb128 0x17
+	.long	.LASF2158
+	.byte	0xc
+	.long	.LASF0
+	.long	.LASF1
+	.long	.Ldebug_line0
+	.long	.Ldebug_macro0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x8
+	.long	.LASF1920
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x7
+	.long	.LASF1921
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x7
+	.long	.LASF1922
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x7
+	.long	.LASF1923
+	.uleb128 0x4
+	.long	.LASF1925
+	.byte	0x1
+	.byte	0x25
+	.byte	0x15
+	.long	0x4a
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1924
+	.uleb128 0x4
+	.long	.LASF1926
+	.byte	0x1
+	.byte	0x26
+	.byte	0x17
+	.long	0x22
+	.uleb128 0x4
+	.long	.LASF1927
+	.byte	0x1
+	.byte	0x27
+	.byte	0x1a
+	.long	0x69
+	.uleb128 0x6
+	.byte	0x2
+	.byte	0x5
+	.long	.LASF1928
+	.uleb128 0x4
+	.long	.LASF1929
+	.byte	0x1
+	.byte	0x28
+	.byte	0x1c
+	.long	0x29
+	.uleb128 0x4
+	.long	.LASF1930
+	.byte	0x1
+	.byte	0x29
+	.byte	0x14
+	.long	0x88
+	.uleb128 0x18
+	.byte	0x4
+	.byte	0x5
+	.string	"int"
+	.uleb128 0x4
+	.long	.LASF1931
+	.byte	0x1
+	.byte	0x2a
+	.byte	0x16
+	.long	0x30
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x5
+	.long	.LASF1932
+	.uleb128 0x4
+	.long	.LASF1933
+	.byte	0x1
+	.byte	0x2d
+	.byte	0x1b
+	.long	0x37
+	.uleb128 0x19
+	.byte	0x8
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x6
+	.long	.LASF1934
+	.uleb128 0x4
+	.long	.LASF1935
+	.byte	0x2
+	.byte	0x18
+	.byte	0x12
+	.long	0x3e
+	.uleb128 0x4
+	.long	.LASF1936
+	.byte	0x2
+	.byte	0x19
+	.byte	0x13
+	.long	0x5d
+	.uleb128 0x4
+	.long	.LASF1937
+	.byte	0x2
+	.byte	0x1a
+	.byte	0x13
+	.long	0x7c
+	.uleb128 0x4
+	.long	.LASF1938
+	.byte	0x3
+	.byte	0x18
+	.byte	0x13
+	.long	0x51
+	.uleb128 0xa
+	.long	0xdb
+	.uleb128 0x1a
+	.long	0xdb
+	.uleb128 0x4
+	.long	.LASF1939
+	.byte	0x3
+	.byte	0x19
+	.byte	0x14
+	.long	0x70
+	.uleb128 0x4
+	.long	.LASF1940
+	.byte	0x3
+	.byte	0x1a
+	.byte	0x14
+	.long	0x8f
+	.uleb128 0xa
+	.long	0xfd
+	.uleb128 0x4
+	.long	.LASF1941
+	.byte	0x3
+	.byte	0x1b
+	.byte	0x14
+	.long	0xa2
+	.uleb128 0x6
+	.byte	0x4
+	.byte	0x4
+	.long	.LASF1942
+	.uleb128 0x6
+	.byte	0x8
+	.byte	0x4
+	.long	.LASF1943
+	.uleb128 0x4
+	.long	.LASF1944
+	.byte	0x4
+	.byte	0x1c
+	.byte	0x11
+	.long	0xcf
+	.uleb128 0x4
+	.long	.LASF1945
+	.byte	0x4
+	.byte	0x21
+	.byte	0x12
+	.long	0x10e
+	.uleb128 0xa
+	.long	0x134
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x16
+	.long	0x236
+	.uleb128 0x1
+	.long	.LASF1946
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1947
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1948
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1949
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1950
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1951
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1952
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1953
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1954
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1955
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1956
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1957
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1958
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1959
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1960
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1961
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF1962
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF1963
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF1964
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF1965
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF1966
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF1967
+	.byte	0x15
+	.uleb128 0x1
+	.long	.LASF1968
+	.byte	0x16
+	.uleb128 0x1
+	.long	.LASF1969
+	.byte	0x17
+	.uleb128 0x1
+	.long	.LASF1970
+	.byte	0x18
+	.uleb128 0x1
+	.long	.LASF1971
+	.byte	0x19
+	.uleb128 0x1
+	.long	.LASF1972
+	.byte	0x1a
+	.uleb128 0x1
+	.long	.LASF1973
+	.byte	0x1b
+	.uleb128 0x1
+	.long	.LASF1974
+	.byte	0x1c
+	.uleb128 0x1
+	.long	.LASF1975
+	.byte	0x1d
+	.uleb128 0x1
+	.long	.LASF1976
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF1977
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF1978
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF1979
+	.byte	0x21
+	.uleb128 0x1
+	.long	.LASF1980
+	.byte	0x22
+	.uleb128 0x1
+	.long	.LASF1981
+	.byte	0x23
+	.uleb128 0x1
+	.long	.LASF1982
+	.byte	0x24
+	.uleb128 0x1
+	.long	.LASF1983
+	.byte	0x25
+	.byte	0
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x5
+	.byte	0x43
+	.long	0x2c1
+	.uleb128 0x1
+	.long	.LASF1984
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF1985
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF1986
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF1987
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF1988
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF1989
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF1990
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF1991
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF1992
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF1993
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF1994
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF1995
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF1996
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF1997
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF1998
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF1999
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2000
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2001
+	.byte	0x11
+	.uleb128 0x1
+	.long	.LASF2002
+	.byte	0x12
+	.uleb128 0x1
+	.long	.LASF2003
+	.byte	0x13
+	.uleb128 0x1
+	.long	.LASF2004
+	.byte	0x14
+	.byte	0
+	.uleb128 0x11
+	.long	.LASF2008
+	.long	0x30
+	.byte	0x1a
+	.long	0x2e2
+	.uleb128 0x1
+	.long	.LASF2005
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2006
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2007
+	.byte	0x3
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2008
+	.byte	0x6
+	.byte	0x1e
+	.byte	0x3
+	.long	0x2c1
+	.uleb128 0x11
+	.long	.LASF2009
+	.long	0x30
+	.byte	0x20
+	.long	0x33f
+	.uleb128 0x1
+	.long	.LASF2010
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2011
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2012
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2013
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2014
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2015
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2016
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2017
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2018
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2019
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2020
+	.byte	0x20
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2009
+	.byte	0x6
+	.byte	0x34
+	.byte	0x3
+	.long	0x2ee
+	.uleb128 0xc
+	.long	.LASF2026
+	.byte	0x10
+	.byte	0x6
+	.byte	0x37
+	.byte	0x10
+	.long	0x373
+	.uleb128 0x2
+	.long	.LASF2021
+	.byte	0x6
+	.byte	0x38
+	.byte	0x14
+	.long	0x373
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2022
+	.byte	0x6
+	.byte	0x39
+	.byte	0x9
+	.long	0x88
+	.byte	0x8
+	.byte	0
+	.uleb128 0x5
+	.long	0xe7
+	.uleb128 0x4
+	.long	.LASF2023
+	.byte	0x6
+	.byte	0x3a
+	.byte	0x3
+	.long	0x34b
+	.uleb128 0xa
+	.long	0x378
+	.uleb128 0x4
+	.long	.LASF2024
+	.byte	0x6
+	.byte	0x3c
+	.byte	0x10
+	.long	0x395
+	.uleb128 0x5
+	.long	0x39a
+	.uleb128 0x7
+	.long	0x3aa
+	.uleb128 0x3
+	.long	0xf1
+	.uleb128 0x3
+	.long	0xae
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2025
+	.byte	0x6
+	.byte	0x3d
+	.byte	0x10
+	.long	0x3b6
+	.uleb128 0x5
+	.long	0x3bb
+	.uleb128 0x7
+	.long	0x3d0
+	.uleb128 0x3
+	.long	0x373
+	.uleb128 0x3
+	.long	0x88
+	.uleb128 0x3
+	.long	0xae
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2027
+	.byte	0x60
+	.byte	0x6
+	.byte	0x3f
+	.byte	0x10
+	.long	0x4bb
+	.uleb128 0x2
+	.long	.LASF2028
+	.byte	0x6
+	.byte	0x41
+	.byte	0x24
+	.long	0x577
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2029
+	.byte	0x6
+	.byte	0x43
+	.byte	0xd
+	.long	0xdb
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2030
+	.byte	0x6
+	.byte	0x44
+	.byte	0x10
+	.long	0x2e2
+	.byte	0xc
+	.uleb128 0x2
+	.long	.LASF2031
+	.byte	0x6
+	.byte	0x45
+	.byte	0x13
+	.long	0x33f
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2032
+	.byte	0x6
+	.byte	0x47
+	.byte	0xe
+	.long	0xfd
+	.byte	0x14
+	.uleb128 0x2
+	.long	.LASF2033
+	.byte	0x6
+	.byte	0x49
+	.byte	0xe
+	.long	0xfd
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2034
+	.byte	0x6
+	.byte	0x4a
+	.byte	0xe
+	.long	0xfd
+	.byte	0x1c
+	.uleb128 0x2
+	.long	.LASF2035
+	.byte	0x6
+	.byte	0x4b
+	.byte	0x17
+	.long	0x57c
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2036
+	.byte	0x6
+	.byte	0x4c
+	.byte	0x17
+	.long	0x57c
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2037
+	.byte	0x6
+	.byte	0x4d
+	.byte	0xe
+	.long	0xfd
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2038
+	.byte	0x6
+	.byte	0x4e
+	.byte	0xe
+	.long	0xfd
+	.byte	0x34
+	.uleb128 0x2
+	.long	.LASF2039
+	.byte	0x6
+	.byte	0x4f
+	.byte	0xe
+	.long	0xfd
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2040
+	.byte	0x6
+	.byte	0x50
+	.byte	0xe
+	.long	0xfd
+	.byte	0x3c
+	.uleb128 0x2
+	.long	.LASF2041
+	.byte	0x6
+	.byte	0x52
+	.byte	0x1e
+	.long	0x389
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2042
+	.byte	0x6
+	.byte	0x53
+	.byte	0xb
+	.long	0xae
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2043
+	.byte	0x6
+	.byte	0x55
+	.byte	0x23
+	.long	0x3aa
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2044
+	.byte	0x6
+	.byte	0x58
+	.byte	0xe
+	.long	0xfd
+	.byte	0x58
+	.byte	0
+	.uleb128 0xc
+	.long	.LASF2045
+	.byte	0x68
+	.byte	0x6
+	.byte	0x5b
+	.byte	0x8
+	.long	0x572
+	.uleb128 0x2
+	.long	.LASF2046
+	.byte	0x6
+	.byte	0x5c
+	.byte	0xc
+	.long	0x5a7
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2047
+	.byte	0x6
+	.byte	0x5e
+	.byte	0x10
+	.long	0x5c0
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2048
+	.byte	0x6
+	.byte	0x5f
+	.byte	0x10
+	.long	0x5c0
+	.byte	0x10
+	.uleb128 0x2
+	.long	.LASF2049
+	.byte	0x6
+	.byte	0x61
+	.byte	0xf
+	.long	0x5d4
+	.byte	0x18
+	.uleb128 0x2
+	.long	.LASF2050
+	.byte	0x6
+	.byte	0x64
+	.byte	0xc
+	.long	0x5e9
+	.byte	0x20
+	.uleb128 0x2
+	.long	.LASF2051
+	.byte	0x6
+	.byte	0x66
+	.byte	0xb
+	.long	0x604
+	.byte	0x28
+	.uleb128 0x2
+	.long	.LASF2052
+	.byte	0x6
+	.byte	0x68
+	.byte	0xc
+	.long	0x619
+	.byte	0x30
+	.uleb128 0x2
+	.long	.LASF2053
+	.byte	0x6
+	.byte	0x6a
+	.byte	0xc
+	.long	0x639
+	.byte	0x38
+	.uleb128 0x2
+	.long	.LASF2054
+	.byte	0x6
+	.byte	0x6c
+	.byte	0xb
+	.long	0x604
+	.byte	0x40
+	.uleb128 0x2
+	.long	.LASF2055
+	.byte	0x6
+	.byte	0x6e
+	.byte	0xb
+	.long	0x64d
+	.byte	0x48
+	.uleb128 0x2
+	.long	.LASF2056
+	.byte	0x6
+	.byte	0x71
+	.byte	0xc
+	.long	0x65d
+	.byte	0x50
+	.uleb128 0x2
+	.long	.LASF2057
+	.byte	0x6
+	.byte	0x72
+	.byte	0xc
+	.long	0x65d
+	.byte	0x58
+	.uleb128 0x2
+	.long	.LASF2058
+	.byte	0x6
+	.byte	0x75
+	.byte	0xc
+	.long	0x67c
+	.byte	0x60
+	.byte	0
+	.uleb128 0xa
+	.long	0x4bb
+	.uleb128 0x5
+	.long	0x572
+	.uleb128 0x5
+	.long	0xec
+	.uleb128 0x4
+	.long	.LASF2059
+	.byte	0x6
+	.byte	0x59
+	.byte	0x3
+	.long	0x3d0
+	.uleb128 0xa
+	.long	0x581
+	.uleb128 0x7
+	.long	0x5a2
+	.uleb128 0x3
+	.long	0x5a2
+	.uleb128 0x3
+	.long	0xdb
+	.byte	0
+	.uleb128 0x5
+	.long	0x581
+	.uleb128 0x5
+	.long	0x592
+	.uleb128 0xe
+	.long	0xfd
+	.long	0x5bb
+	.uleb128 0x3
+	.long	0x5bb
+	.byte	0
+	.uleb128 0x5
+	.long	0x58d
+	.uleb128 0x5
+	.long	0x5ac
+	.uleb128 0xe
+	.long	0xdb
+	.long	0x5d4
+	.uleb128 0x3
+	.long	0x5a2
+	.byte	0
+	.uleb128 0x5
+	.long	0x5c5
+	.uleb128 0x7
+	.long	0x5e9
+	.uleb128 0x3
+	.long	0x5a2
+	.uleb128 0x3
+	.long	0xfd
+	.byte	0
+	.uleb128 0x5
+	.long	0x5d9
+	.uleb128 0xe
+	.long	0x5fd
+	.long	0x5fd
+	.uleb128 0x3
+	.long	0x5bb
+	.byte	0
+	.uleb128 0x6
+	.byte	0x1
+	.byte	0x2
+	.long	.LASF2060
+	.uleb128 0x5
+	.long	0x5ee
+	.uleb128 0x7
+	.long	0x619
+	.uleb128 0x3
+	.long	0x5a2
+	.uleb128 0x3
+	.long	0x2e2
+	.byte	0
+	.uleb128 0x5
+	.long	0x609
+	.uleb128 0x7
+	.long	0x633
+	.uleb128 0x3
+	.long	0x5a2
+	.uleb128 0x3
+	.long	0x633
+	.uleb128 0x3
+	.long	0x88
+	.byte	0
+	.uleb128 0x5
+	.long	0x638
+	.uleb128 0x1b
+	.uleb128 0x5
+	.long	0x61e
+	.uleb128 0xe
+	.long	0x5fd
+	.long	0x64d
+	.uleb128 0x3
+	.long	0x5a2
+	.byte	0
+	.uleb128 0x5
+	.long	0x63e
+	.uleb128 0x7
+	.long	0x65d
+	.uleb128 0x3
+	.long	0x5a2
+	.byte	0
+	.uleb128 0x5
+	.long	0x652
+	.uleb128 0x7
+	.long	0x677
+	.uleb128 0x3
+	.long	0x5a2
+	.uleb128 0x3
+	.long	0x677
+	.uleb128 0x3
+	.long	0x88
+	.byte	0
+	.uleb128 0x5
+	.long	0x384
+	.uleb128 0x5
+	.long	0x662
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x20
+	.long	0x73b
+	.uleb128 0x1
+	.long	.LASF2061
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2062
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2063
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2064
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2065
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2066
+	.byte	0x10
+	.uleb128 0x1
+	.long	.LASF2067
+	.byte	0x20
+	.uleb128 0x1
+	.long	.LASF2068
+	.byte	0x40
+	.uleb128 0x1
+	.long	.LASF2069
+	.byte	0x80
+	.uleb128 0x8
+	.long	.LASF2070
+	.value	0x100
+	.uleb128 0x8
+	.long	.LASF2071
+	.value	0x200
+	.uleb128 0x8
+	.long	.LASF2072
+	.value	0x400
+	.uleb128 0x8
+	.long	.LASF2073
+	.value	0x800
+	.uleb128 0x8
+	.long	.LASF2074
+	.value	0x1000
+	.uleb128 0x8
+	.long	.LASF2075
+	.value	0x2000
+	.uleb128 0x8
+	.long	.LASF2076
+	.value	0x4000
+	.uleb128 0x8
+	.long	.LASF2077
+	.value	0x8000
+	.uleb128 0xb
+	.long	.LASF2078
+	.long	0x10000
+	.uleb128 0xb
+	.long	.LASF2079
+	.long	0x20000
+	.uleb128 0xb
+	.long	.LASF2080
+	.long	0x40000
+	.uleb128 0xb
+	.long	.LASF2081
+	.long	0x80000
+	.uleb128 0xb
+	.long	.LASF2082
+	.long	0x100000
+	.uleb128 0xb
+	.long	.LASF2083
+	.long	0x200000
+	.uleb128 0xb
+	.long	.LASF2084
+	.long	0x400000
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2085
+	.byte	0x7
+	.byte	0x39
+	.byte	0x3
+	.long	0x681
+	.uleb128 0xd
+	.byte	0x7
+	.long	0x30
+	.byte	0x7
+	.byte	0x3b
+	.long	0x7ba
+	.uleb128 0x1
+	.long	.LASF2086
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2087
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2088
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2089
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2090
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2091
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2092
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2093
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2094
+	.byte	0x8
+	.uleb128 0x1
+	.long	.LASF2095
+	.byte	0x9
+	.uleb128 0x1
+	.long	.LASF2096
+	.byte	0xa
+	.uleb128 0x1
+	.long	.LASF2097
+	.byte	0xb
+	.uleb128 0x1
+	.long	.LASF2098
+	.byte	0xc
+	.uleb128 0x1
+	.long	.LASF2099
+	.byte	0xd
+	.uleb128 0x1
+	.long	.LASF2100
+	.byte	0xe
+	.uleb128 0x1
+	.long	.LASF2101
+	.byte	0xf
+	.uleb128 0x1
+	.long	.LASF2102
+	.byte	0x10
+	.byte	0
+	.uleb128 0x10
+	.long	0x109
+	.long	0x7c5
+	.uleb128 0x1c
+	.byte	0
+	.uleb128 0xa
+	.long	0x7ba
+	.uleb128 0x12
+	.long	.LASF2134
+	.byte	0x7
+	.byte	0x4f
+	.byte	0x17
+	.long	0x7c5
+	.uleb128 0xd
+	.byte	0x5
+	.long	0x88
+	.byte	0x7
+	.byte	0x52
+	.long	0x831
+	.uleb128 0x1d
+	.long	.LASF2103
+	.sleb128 -1
+	.uleb128 0x1
+	.long	.LASF2104
+	.byte	0
+	.uleb128 0x1
+	.long	.LASF2105
+	.byte	0x1
+	.uleb128 0x1
+	.long	.LASF2106
+	.byte	0x2
+	.uleb128 0x1
+	.long	.LASF2107
+	.byte	0x3
+	.uleb128 0x1
+	.long	.LASF2108
+	.byte	0x4
+	.uleb128 0x1
+	.long	.LASF2109
+	.byte	0x5
+	.uleb128 0x1
+	.long	.LASF2110
+	.byte	0x6
+	.uleb128 0x1
+	.long	.LASF2111
+	.byte	0x7
+	.uleb128 0x1
+	.long	.LASF2112
+	.byte	0x14
+	.uleb128 0x1
+	.long	.LASF2113
+	.byte	0x1e
+	.uleb128 0x1
+	.long	.LASF2114
+	.byte	0x1f
+	.uleb128 0x1
+	.long	.LASF2115
+	.byte	0x1f
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2116
+	.byte	0x7
+	.byte	0x60
+	.byte	0x3
+	.long	0x7d6
+	.uleb128 0xc
+	.long	.LASF2117
+	.byte	0xc
+	.byte	0x7
+	.byte	0x73
+	.byte	0x10
+	.long	0x899
+	.uleb128 0x2
+	.long	.LASF2118
+	.byte	0x7
+	.byte	0x74
+	.byte	0xe
+	.long	0xfd
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2029
+	.byte	0x7
+	.byte	0x75
+	.byte	0x1c
+	.long	0x831
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2119
+	.byte	0x7
+	.byte	0x76
+	.byte	0xd
+	.long	0xdb
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2120
+	.byte	0x7
+	.byte	0x77
+	.byte	0xd
+	.long	0xdb
+	.byte	0x9
+	.uleb128 0x2
+	.long	.LASF2121
+	.byte	0x7
+	.byte	0x78
+	.byte	0xd
+	.long	0xdb
+	.byte	0xa
+	.uleb128 0x2
+	.long	.LASF2122
+	.byte	0x7
+	.byte	0x79
+	.byte	0xd
+	.long	0xdb
+	.byte	0xb
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2123
+	.byte	0x7
+	.byte	0x7a
+	.byte	0x3
+	.long	0x83d
+	.uleb128 0x5
+	.long	0x8aa
+	.uleb128 0x1e
+	.long	0x5fd
+	.uleb128 0xc
+	.long	.LASF2124
+	.byte	0x14
+	.byte	0x8
+	.byte	0x20
+	.byte	0x10
+	.long	0x8e4
+	.uleb128 0x2
+	.long	.LASF2125
+	.byte	0x8
+	.byte	0x21
+	.byte	0x11
+	.long	0x128
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2126
+	.byte	0x8
+	.byte	0x22
+	.byte	0xd
+	.long	0x8e4
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2127
+	.byte	0x8
+	.byte	0x23
+	.byte	0xd
+	.long	0xc3
+	.byte	0x10
+	.byte	0
+	.uleb128 0x10
+	.long	0xcf
+	.long	0x8f4
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x2
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2128
+	.byte	0x8
+	.byte	0x24
+	.byte	0x3
+	.long	0x8af
+	.uleb128 0xc
+	.long	.LASF2129
+	.byte	0x18
+	.byte	0x9
+	.byte	0x1d
+	.byte	0x10
+	.long	0x935
+	.uleb128 0x2
+	.long	.LASF2130
+	.byte	0x9
+	.byte	0x1e
+	.byte	0xb
+	.long	0x8a5
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2131
+	.byte	0x9
+	.byte	0x1f
+	.byte	0xb
+	.long	0x8a5
+	.byte	0x8
+	.uleb128 0x2
+	.long	.LASF2132
+	.byte	0x9
+	.byte	0x20
+	.byte	0xb
+	.long	0x949
+	.byte	0x10
+	.byte	0
+	.uleb128 0xe
+	.long	0x5fd
+	.long	0x944
+	.uleb128 0x3
+	.long	0x944
+	.byte	0
+	.uleb128 0x5
+	.long	0x8f4
+	.uleb128 0x5
+	.long	0x935
+	.uleb128 0x4
+	.long	.LASF2133
+	.byte	0x9
+	.byte	0x21
+	.byte	0x3
+	.long	0x900
+	.uleb128 0x12
+	.long	.LASF2135
+	.byte	0xa
+	.byte	0x20
+	.byte	0x1e
+	.long	0x94e
+	.uleb128 0x9
+	.long	.LASF2136
+	.byte	0x2d
+	.byte	0x17
+	.long	0x5a2
+	.uleb128 0x9
+	.long	.LASF2137
+	.byte	0x2e
+	.byte	0x1d
+	.long	0x97c
+	.uleb128 0x5
+	.long	0x899
+	.uleb128 0x10
+	.long	0xdb
+	.long	0x991
+	.uleb128 0x13
+	.long	0x37
+	.byte	0x9
+	.byte	0
+	.uleb128 0x9
+	.long	.LASF2138
+	.byte	0x2f
+	.byte	0x10
+	.long	0x981
+	.uleb128 0x9
+	.long	.LASF2139
+	.byte	0x30
+	.byte	0xc
+	.long	0x88
+	.uleb128 0x1f
+	.byte	0x9
+	.byte	0xb
+	.byte	0x32
+	.byte	0x9
+	.long	0xa0c
+	.uleb128 0x2
+	.long	.LASF2140
+	.byte	0xb
+	.byte	0x33
+	.byte	0xd
+	.long	0xdb
+	.byte	0
+	.uleb128 0x2
+	.long	.LASF2141
+	.byte	0xb
+	.byte	0x34
+	.byte	0xd
+	.long	0xdb
+	.byte	0x1
+	.uleb128 0x2
+	.long	.LASF2142
+	.byte	0xb
+	.byte	0x35
+	.byte	0xd
+	.long	0xc3
+	.byte	0x2
+	.uleb128 0x2
+	.long	.LASF2143
+	.byte	0xb
+	.byte	0x36
+	.byte	0xd
+	.long	0xc3
+	.byte	0x4
+	.uleb128 0x2
+	.long	.LASF2144
+	.byte	0xb
+	.byte	0x37
+	.byte	0xc
+	.long	0xb7
+	.byte	0x6
+	.uleb128 0x2
+	.long	.LASF2145
+	.byte	0xb
+	.byte	0x38
+	.byte	0xd
+	.long	0xdb
+	.byte	0x7
+	.uleb128 0x2
+	.long	.LASF2146
+	.byte	0xb
+	.byte	0x39
+	.byte	0xd
+	.long	0xdb
+	.byte	0x8
+	.byte	0
+	.uleb128 0x4
+	.long	.LASF2147
+	.byte	0xb
+	.byte	0x3a
+	.byte	0x3
+	.long	0x9a7
+	.uleb128 0x20
+	.long	0x95a
+	.byte	0xb
+	.byte	0x8c
+	.byte	0x17
+	.uleb128 0xf
+	.long	.LASF2148
+	.byte	0x7
+	.byte	0x8f
+	.byte	0x15
+	.long	0x97c
+	.long	0xa36
+	.uleb128 0x3
+	.long	0x73b
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2149
+	.byte	0x7
+	.byte	0x9a
+	.byte	0xf
+	.long	0x5a2
+	.long	0xa6a
+	.uleb128 0x3
+	.long	0x831
+	.uleb128 0x3
+	.long	0x73b
+	.uleb128 0x3
+	.long	0x389
+	.uleb128 0x3
+	.long	0xae
+	.uleb128 0x3
+	.long	0xfd
+	.uleb128 0x3
+	.long	0x2e2
+	.uleb128 0x3
+	.long	0x33f
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2150
+	.byte	0x6
+	.byte	0x79
+	.byte	0xa
+	.long	0xfd
+	.long	0xa80
+	.uleb128 0x3
+	.long	0x5bb
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2151
+	.byte	0xc
+	.byte	0x87
+	.byte	0x5
+	.long	0x88
+	.long	0xaa0
+	.uleb128 0x3
+	.long	0x88
+	.uleb128 0x3
+	.long	0x88
+	.uleb128 0x3
+	.long	0x88
+	.byte	0
+	.uleb128 0xf
+	.long	.LASF2049
+	.byte	0x6
+	.byte	0x7e
+	.byte	0x9
+	.long	0xdb
+	.long	0xab6
+	.uleb128 0x3
+	.long	0x5a2
+	.byte	0
+	.uleb128 0x21
+	.long	.LASF2159
+	.byte	0xd
+	.byte	0x1b
+	.byte	0xa
+	.long	0x134
+	.uleb128 0x22
+	.long	.LASF2160
+	.byte	0xb
+	.byte	0x56
+	.byte	0xc
+	.long	0x5fd
+	.long	0xb23
+	.uleb128 0x23
+	.long	.LASF2021
+	.byte	0xb
+	.byte	0x56
+	.byte	0x2c
+	.long	0x944
+	.uleb128 0x9
+	.long	.LASF2152
+	.byte	0x58
+	.byte	0x15
+	.long	0x134
+	.uleb128 0x9
+	.long	.LASF2153
+	.byte	0x59
+	.byte	0x14
+	.long	0x140
+	.uleb128 0x9
+	.long	.LASF2154
+	.byte	0x5b
+	.byte	0x9
+	.long	0x5fd
+	.uleb128 0x9
+	.long	.LASF2155
+	.byte	0x5c
+	.byte	0x12
+	.long	0x8f4
+	.uleb128 0x14
+	.uleb128 0x15
+	.string	"c"
+	.byte	0x5f
+	.byte	0x11
+	.long	0xdb
+	.uleb128 0x14
+	.uleb128 0x15
+	.string	"pkt"
+	.byte	0x6d
+	.byte	0x20
+	.long	0xb23
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.long	0xa0c
+	.uleb128 0x16
+	.long	.LASF2156
+	.byte	0x46
+	.long	0x5fd
+	.uleb128 0x16
+	.long	.LASF2157
+	.byte	0x3c
+	.long	0x5fd
+	.byte	0
+	.section	.gnu.debuglto_.debug_abbrev,"e",@progbits
+.Ldebug_abbrev0:
+	.uleb128 0x1
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x2
+	.uleb128 0xd
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x38
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x4
+	.uleb128 0x16
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x5
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 8
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x6
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0xe
+	.byte	0
+	.byte	0
+	.uleb128 0x7
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x8
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x5
+	.byte	0
+	.byte	0
+	.uleb128 0x9
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xa
+	.uleb128 0x26
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0x6
+	.byte	0
+	.byte	0
+	.uleb128 0xc
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xd
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xe
+	.uleb128 0x15
+	.byte	0x1
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0xf
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x10
+	.uleb128 0x1
+	.byte	0x1
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x11
+	.uleb128 0x4
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3e
+	.uleb128 0x21
+	.sleb128 7
+	.uleb128 0xb
+	.uleb128 0x21
+	.sleb128 4
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 6
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 14
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x12
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x13
+	.uleb128 0x21
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x2f
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x14
+	.uleb128 0xb
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.uleb128 0x15
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0x8
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x16
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0x21
+	.sleb128 11
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0x21
+	.sleb128 12
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x17
+	.uleb128 0x11
+	.byte	0x1
+	.uleb128 0x25
+	.uleb128 0xe
+	.uleb128 0x13
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x1f
+	.uleb128 0x1b
+	.uleb128 0x1f
+	.uleb128 0x10
+	.uleb128 0x17
+	.uleb128 0x79
+	.uleb128 0x17
+	.byte	0
+	.byte	0
+	.uleb128 0x18
+	.uleb128 0x24
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3e
+	.uleb128 0xb
+	.uleb128 0x3
+	.uleb128 0x8
+	.byte	0
+	.byte	0
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0
+	.uleb128 0xb
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x1a
+	.uleb128 0x35
+	.byte	0
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1b
+	.uleb128 0x26
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1c
+	.uleb128 0x21
+	.byte	0
+	.byte	0
+	.byte	0
+	.uleb128 0x1d
+	.uleb128 0x28
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x1c
+	.uleb128 0xd
+	.byte	0
+	.byte	0
+	.uleb128 0x1e
+	.uleb128 0x15
+	.byte	0
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x1f
+	.uleb128 0x13
+	.byte	0x1
+	.uleb128 0xb
+	.uleb128 0xb
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x20
+	.uleb128 0x34
+	.byte	0
+	.uleb128 0x47
+	.uleb128 0x13
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.byte	0
+	.byte	0
+	.uleb128 0x21
+	.uleb128 0x2e
+	.byte	0
+	.uleb128 0x3f
+	.uleb128 0x19
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x3c
+	.uleb128 0x19
+	.byte	0
+	.byte	0
+	.uleb128 0x22
+	.uleb128 0x2e
+	.byte	0x1
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x27
+	.uleb128 0x19
+	.uleb128 0x49
+	.uleb128 0x13
+	.uleb128 0x1
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.uleb128 0x23
+	.uleb128 0x5
+	.byte	0
+	.uleb128 0x3
+	.uleb128 0xe
+	.uleb128 0x3a
+	.uleb128 0xb
+	.uleb128 0x3b
+	.uleb128 0xb
+	.uleb128 0x39
+	.uleb128 0xb
+	.uleb128 0x49
+	.uleb128 0x13
+	.byte	0
+	.byte	0
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"e",@progbits
+.Ldebug_macro0:
+	.value	0x5
+	.byte	0x2
+	.long	.Ldebug_line0
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xb
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF2
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF3
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF4
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF5
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF6
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF7
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF8
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF9
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF10
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF11
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF12
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF13
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF14
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF15
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF16
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF17
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF18
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF19
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF20
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF21
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF22
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF23
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF24
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF25
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF26
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF27
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF28
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF29
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF30
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF31
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF32
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF33
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF34
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF35
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF36
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF37
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF38
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF39
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF40
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF41
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF42
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF43
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF44
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF45
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF46
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF47
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF48
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF49
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF50
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF51
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF52
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF53
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF54
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF55
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF56
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF57
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF58
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF59
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF60
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF61
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF62
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF63
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF64
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF65
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF66
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF67
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF68
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF69
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF70
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF71
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF72
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF73
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF74
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF75
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF76
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF77
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF78
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF79
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF80
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF81
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF82
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF83
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF84
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF85
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF86
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF87
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF88
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF89
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF90
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF91
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF92
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF93
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF94
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF95
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF96
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF97
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF98
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF99
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF100
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF101
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF102
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF103
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF104
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF105
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF106
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF107
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF108
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF109
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF110
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF111
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF112
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF113
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF114
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF115
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF116
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF117
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF118
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF119
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF120
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF121
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF122
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF123
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF124
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF126
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF127
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF128
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF129
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF130
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF131
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF132
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF133
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF135
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF136
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF137
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF138
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF139
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF140
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF141
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF142
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF143
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF144
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF145
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF146
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF147
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF148
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF149
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF150
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF151
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF152
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF153
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF154
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF155
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF156
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF157
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF158
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF159
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF160
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF161
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF162
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF163
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF164
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF165
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF166
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF167
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF168
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF169
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF170
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF171
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF172
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF173
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF174
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF175
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF176
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF177
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF178
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF179
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF180
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF181
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF182
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF183
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF184
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF185
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF186
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF187
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF188
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF189
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF190
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF191
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF192
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF193
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF194
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF195
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF196
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF197
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF198
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF199
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF200
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF201
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF202
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF203
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF204
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF205
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF206
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF207
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF208
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF209
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF210
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF211
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF212
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF213
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF214
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF215
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF216
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF217
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF218
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF219
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF220
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF221
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF222
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF223
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF224
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF225
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF226
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF227
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF228
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF229
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF230
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF231
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF232
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF233
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF234
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF235
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF236
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF237
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF238
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF239
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF240
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF241
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF242
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF243
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF244
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF245
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF246
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF247
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF248
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF249
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF250
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF251
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF252
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF253
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF254
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF255
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF256
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF257
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF258
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF259
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF260
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF261
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF262
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF263
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF264
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF265
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF266
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF267
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF268
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF269
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF270
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF271
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF272
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF273
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF274
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF275
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF276
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF277
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF278
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF279
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF280
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF281
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF282
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF283
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF284
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF285
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF286
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF287
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF288
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF289
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF290
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF291
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF292
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF293
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF294
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF295
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF296
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF297
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF298
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF299
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF300
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF301
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF302
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF303
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF304
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF305
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF306
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF307
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF308
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF309
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF310
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF311
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF312
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF313
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF314
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF315
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF316
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF317
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF318
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF319
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF320
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF321
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF322
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF323
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF324
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF325
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF326
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF327
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF328
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF329
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF330
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF331
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF332
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF333
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF334
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF335
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF336
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF337
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF338
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF339
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF340
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF341
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF342
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF343
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF344
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF345
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF346
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF347
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF348
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF349
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF350
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF351
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF352
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF353
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF354
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF355
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF356
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF357
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF358
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF359
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF360
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF361
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF362
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF363
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF364
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF365
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF366
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF367
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF368
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF369
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF370
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF371
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF372
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF373
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF374
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF375
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF376
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF377
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF378
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF379
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF380
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF381
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF382
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF383
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF384
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF385
+	.byte	0x5
+	.uleb128 0
+	.long	.LASF386
+	.file 14 "/usr/include/stdc-predef.h"
+	.byte	0x3
+	.uleb128 0
+	.uleb128 0xe
+	.byte	0x7
+	.long	.Ldebug_macro2
+	.byte	0x4
+	.file 15 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0xf
+	.byte	0x7
+	.long	.Ldebug_macro3
+	.byte	0x4
+	.file 16 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x10
+	.file 17 "/usr/include/stdint.h"
+	.byte	0x3
+	.uleb128 0x9
+	.uleb128 0x11
+	.byte	0x7
+	.long	.Ldebug_macro4
+	.file 18 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h"
+	.byte	0x3
+	.uleb128 0x1a
+	.uleb128 0x12
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.file 19 "/usr/include/features.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x13
+	.byte	0x7
+	.long	.Ldebug_macro5
+	.file 20 "/usr/include/features-time64.h"
+	.byte	0x3
+	.uleb128 0x188
+	.uleb128 0x14
+	.file 21 "/usr/include/x86_64-linux-gnu/bits/wordsize.h"
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 22 "/usr/include/x86_64-linux-gnu/bits/timesize.h"
+	.byte	0x3
+	.uleb128 0x15
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro7
+	.file 23 "/usr/include/x86_64-linux-gnu/sys/cdefs.h"
+	.byte	0x3
+	.uleb128 0x1e9
+	.uleb128 0x17
+	.byte	0x7
+	.long	.Ldebug_macro8
+	.byte	0x3
+	.uleb128 0x231
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.file 24 "/usr/include/x86_64-linux-gnu/bits/long-double.h"
+	.byte	0x3
+	.uleb128 0x232
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro9
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1f9
+	.long	.LASF545
+	.file 25 "/usr/include/x86_64-linux-gnu/gnu/stubs.h"
+	.byte	0x3
+	.uleb128 0x201
+	.uleb128 0x19
+	.file 26 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h"
+	.byte	0x3
+	.uleb128 0xa
+	.uleb128 0x1a
+	.byte	0x7
+	.long	.Ldebug_macro10
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro11
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF568
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x16
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF454
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro12
+	.file 27 "/usr/include/x86_64-linux-gnu/bits/typesizes.h"
+	.byte	0x3
+	.uleb128 0x8d
+	.uleb128 0x1b
+	.byte	0x7
+	.long	.Ldebug_macro13
+	.byte	0x4
+	.file 28 "/usr/include/x86_64-linux-gnu/bits/time64.h"
+	.byte	0x3
+	.uleb128 0x8e
+	.uleb128 0x1c
+	.byte	0x7
+	.long	.Ldebug_macro14
+	.byte	0x4
+	.byte	0x6
+	.uleb128 0xe2
+	.long	.LASF628
+	.byte	0x4
+	.file 29 "/usr/include/x86_64-linux-gnu/bits/wchar.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x1d
+	.byte	0x7
+	.long	.Ldebug_macro15
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x15
+	.byte	0x7
+	.long	.Ldebug_macro6
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x2
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF632
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x3
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF633
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro16
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF696
+	.byte	0x4
+	.file 30 "/usr/include/ctype.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x1e
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF697
+	.file 31 "/usr/include/x86_64-linux-gnu/bits/endian.h"
+	.byte	0x3
+	.uleb128 0x27
+	.uleb128 0x1f
+	.byte	0x7
+	.long	.Ldebug_macro17
+	.file 32 "/usr/include/x86_64-linux-gnu/bits/endianness.h"
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0x20
+	.byte	0x7
+	.long	.Ldebug_macro18
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro19
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro20
+	.file 33 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h"
+	.byte	0x3
+	.uleb128 0xed
+	.uleb128 0x21
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF730
+	.file 34 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x22
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF731
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro21
+	.byte	0x4
+	.file 35 "/usr/include/math.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x23
+	.byte	0x7
+	.long	.Ldebug_macro22
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x12
+	.byte	0x7
+	.long	.Ldebug_macro23
+	.byte	0x4
+	.file 36 "/usr/include/x86_64-linux-gnu/bits/math-vector.h"
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x24
+	.file 37 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x25
+	.byte	0x7
+	.long	.Ldebug_macro24
+	.byte	0x4
+	.byte	0x4
+	.file 38 "/usr/include/x86_64-linux-gnu/bits/floatn.h"
+	.byte	0x3
+	.uleb128 0x2b
+	.uleb128 0x26
+	.byte	0x7
+	.long	.Ldebug_macro25
+	.file 39 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h"
+	.byte	0x3
+	.uleb128 0x78
+	.uleb128 0x27
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF1045
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x18
+	.byte	0x5
+	.uleb128 0x15
+	.long	.LASF527
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro26
+	.byte	0x4
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro27
+	.file 40 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h"
+	.byte	0x3
+	.uleb128 0x98
+	.uleb128 0x28
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1072
+	.byte	0x4
+	.file 41 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h"
+	.byte	0x3
+	.uleb128 0xcc
+	.uleb128 0x29
+	.byte	0x7
+	.long	.Ldebug_macro28
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro29
+	.file 42 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h"
+	.byte	0x3
+	.uleb128 0xf7
+	.uleb128 0x2a
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro30
+	.file 43 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h"
+	.byte	0x3
+	.uleb128 0x138
+	.uleb128 0x2b
+	.byte	0x4
+	.file 44 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h"
+	.byte	0x3
+	.uleb128 0x139
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro31
+	.byte	0x3
+	.uleb128 0x149
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x14a
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro32
+	.byte	0x3
+	.uleb128 0x18e
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x18f
+	.uleb128 0x2c
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro33
+	.byte	0x3
+	.uleb128 0x1e1
+	.uleb128 0x2b
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro34
+	.byte	0x4
+	.file 45 "./src/main/platform.h"
+	.byte	0x3
+	.uleb128 0x1e
+	.uleb128 0x2d
+	.file 46 "./src/main/target/common.h"
+	.byte	0x3
+	.uleb128 0x3f
+	.uleb128 0x2e
+	.byte	0x7
+	.long	.Ldebug_macro35
+	.byte	0x4
+	.file 47 "./src/main/target/SITL/target.h"
+	.byte	0x3
+	.uleb128 0x40
+	.uleb128 0x2f
+	.file 48 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x30
+	.byte	0x7
+	.long	.Ldebug_macro36
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro37
+	.byte	0x4
+	.file 49 "./src/main/target/sanity_check.h"
+	.byte	0x3
+	.uleb128 0x41
+	.uleb128 0x31
+	.byte	0x4
+	.file 50 "./src/main/target/common_post.h"
+	.byte	0x3
+	.uleb128 0x42
+	.uleb128 0x32
+	.byte	0x7
+	.long	.Ldebug_macro38
+	.byte	0x4
+	.byte	0x4
+	.file 51 "./src/main/build/build_config.h"
+	.byte	0x3
+	.uleb128 0x20
+	.uleb128 0x33
+	.byte	0x7
+	.long	.Ldebug_macro39
+	.byte	0x4
+	.file 52 "./src/main/build/debug.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x34
+	.byte	0x3
+	.uleb128 0x12
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro40
+	.byte	0x3
+	.uleb128 0x1f
+	.uleb128 0x4
+	.file 53 "./src/main/config/parameter_group.h"
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x35
+	.byte	0x7
+	.long	.Ldebug_macro41
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro42
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro43
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x23
+	.uleb128 0xc
+	.byte	0x7
+	.long	.Ldebug_macro44
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x25
+	.uleb128 0x7
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x6
+	.file 54 "./src/main/drivers/io.h"
+	.byte	0x3
+	.uleb128 0x13
+	.uleb128 0x36
+	.byte	0x3
+	.uleb128 0x19
+	.uleb128 0x5
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1469
+	.byte	0x4
+	.file 55 "./src/main/drivers/io_types.h"
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x37
+	.byte	0x7
+	.long	.Ldebug_macro45
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro46
+	.file 56 "./src/main/drivers/io_def.h"
+	.byte	0x3
+	.uleb128 0x56
+	.uleb128 0x38
+	.file 57 "./src/main/common/utils.h"
+	.byte	0x3
+	.uleb128 0x3
+	.uleb128 0x39
+	.byte	0x3
+	.uleb128 0x14
+	.uleb128 0x30
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro47
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro48
+	.file 58 "./src/main/drivers/io_def_generated.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3a
+	.byte	0x7
+	.long	.Ldebug_macro49
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x28
+	.uleb128 0x9
+	.byte	0x3
+	.uleb128 0x1b
+	.uleb128 0x8
+	.file 59 "./src/main/drivers/sensor.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3b
+	.file 60 "./src/main/drivers/bus.h"
+	.byte	0x3
+	.uleb128 0x18
+	.uleb128 0x3c
+	.file 61 "./src/main/drivers/bus_i2c.h"
+	.byte	0x3
+	.uleb128 0x21
+	.uleb128 0x3d
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF1888
+	.file 62 "./src/main/drivers/rcc_types.h"
+	.byte	0x3
+	.uleb128 0x1c
+	.uleb128 0x3e
+	.byte	0x4
+	.byte	0x4
+	.file 63 "./src/main/drivers/bus_spi.h"
+	.byte	0x3
+	.uleb128 0x22
+	.uleb128 0x3f
+	.file 64 "./src/main/drivers/dma.h"
+	.byte	0x3
+	.uleb128 0x16
+	.uleb128 0x40
+	.byte	0x7
+	.long	.Ldebug_macro50
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1901
+	.byte	0x4
+	.byte	0x7
+	.long	.Ldebug_macro51
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x29
+	.uleb128 0xd
+	.byte	0x4
+	.byte	0x3
+	.uleb128 0x2a
+	.uleb128 0xa
+	.file 65 "./src/main/sensors/opflow.h"
+	.byte	0x3
+	.uleb128 0x1d
+	.uleb128 0x41
+	.byte	0x4
+	.byte	0x4
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1919
+	.byte	0x4
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdcpredef.h.19.88fdbfd5cf6f83ed579effc3e425f09b,comdat
+.Ldebug_macro2:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF387
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF388
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF389
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF390
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF391
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF392
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdbool.h.29.4a1c88fe569adb8d03217dd16982ca34,comdat
+.Ldebug_macro3:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF393
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF394
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF395
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF396
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.23.022efde71688fcb285fe42cc87d41ee3,comdat
+.Ldebug_macro4:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF398
+	.byte	0x5
+	.uleb128 0x19
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.19.67b74adf279e022f366935a82649fdd2,comdat
+.Ldebug_macro5:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF401
+	.byte	0x6
+	.uleb128 0x7e
+	.long	.LASF402
+	.byte	0x6
+	.uleb128 0x7f
+	.long	.LASF403
+	.byte	0x6
+	.uleb128 0x80
+	.long	.LASF404
+	.byte	0x6
+	.uleb128 0x81
+	.long	.LASF405
+	.byte	0x6
+	.uleb128 0x82
+	.long	.LASF406
+	.byte	0x6
+	.uleb128 0x83
+	.long	.LASF407
+	.byte	0x6
+	.uleb128 0x84
+	.long	.LASF408
+	.byte	0x6
+	.uleb128 0x85
+	.long	.LASF409
+	.byte	0x6
+	.uleb128 0x86
+	.long	.LASF410
+	.byte	0x6
+	.uleb128 0x87
+	.long	.LASF411
+	.byte	0x6
+	.uleb128 0x88
+	.long	.LASF412
+	.byte	0x6
+	.uleb128 0x89
+	.long	.LASF413
+	.byte	0x6
+	.uleb128 0x8a
+	.long	.LASF414
+	.byte	0x6
+	.uleb128 0x8b
+	.long	.LASF415
+	.byte	0x6
+	.uleb128 0x8c
+	.long	.LASF416
+	.byte	0x6
+	.uleb128 0x8d
+	.long	.LASF417
+	.byte	0x6
+	.uleb128 0x8e
+	.long	.LASF418
+	.byte	0x6
+	.uleb128 0x8f
+	.long	.LASF419
+	.byte	0x6
+	.uleb128 0x90
+	.long	.LASF420
+	.byte	0x6
+	.uleb128 0x91
+	.long	.LASF421
+	.byte	0x6
+	.uleb128 0x92
+	.long	.LASF422
+	.byte	0x6
+	.uleb128 0x93
+	.long	.LASF423
+	.byte	0x6
+	.uleb128 0x94
+	.long	.LASF424
+	.byte	0x6
+	.uleb128 0x95
+	.long	.LASF425
+	.byte	0x6
+	.uleb128 0x96
+	.long	.LASF426
+	.byte	0x6
+	.uleb128 0x97
+	.long	.LASF427
+	.byte	0x6
+	.uleb128 0x98
+	.long	.LASF428
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF429
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF430
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF431
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF432
+	.byte	0x6
+	.uleb128 0xeb
+	.long	.LASF433
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF434
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF435
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF437
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF438
+	.byte	0x6
+	.uleb128 0x11f
+	.long	.LASF439
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF440
+	.byte	0x6
+	.uleb128 0x121
+	.long	.LASF441
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF442
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF443
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF444
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF445
+	.byte	0x5
+	.uleb128 0x151
+	.long	.LASF446
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF447
+	.byte	0x6
+	.uleb128 0x156
+	.long	.LASF404
+	.byte	0x5
+	.uleb128 0x157
+	.long	.LASF437
+	.byte	0x6
+	.uleb128 0x158
+	.long	.LASF403
+	.byte	0x5
+	.uleb128 0x159
+	.long	.LASF436
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF448
+	.byte	0x6
+	.uleb128 0x15e
+	.long	.LASF449
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF450
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wordsize.h.4.21825217995af4880cdf0ea22ad93ab2,comdat
+.Ldebug_macro6:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x4
+	.long	.LASF451
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF452
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF453
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.features.h.395.fedd9c9c2907d1b340fa60d7f5a74c86,comdat
+.Ldebug_macro7:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF455
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF456
+	.byte	0x5
+	.uleb128 0x1af
+	.long	.LASF457
+	.byte	0x5
+	.uleb128 0x1b9
+	.long	.LASF458
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF459
+	.byte	0x6
+	.uleb128 0x1db
+	.long	.LASF460
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF461
+	.byte	0x5
+	.uleb128 0x1e0
+	.long	.LASF462
+	.byte	0x5
+	.uleb128 0x1e1
+	.long	.LASF463
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF464
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.20.d13119a82209af2f0bb8316a396922fa,comdat
+.Ldebug_macro8:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF465
+	.byte	0x2
+	.uleb128 0x23
+	.string	"__P"
+	.byte	0x6
+	.uleb128 0x24
+	.long	.LASF466
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF467
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF468
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF469
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF470
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF471
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF472
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF473
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF474
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF475
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF476
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF477
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF478
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF479
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF480
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF481
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF482
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF483
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF484
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF485
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF486
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF487
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF488
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF489
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF490
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF491
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF492
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF493
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF494
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF495
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF496
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF497
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF498
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF499
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF500
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF501
+	.byte	0x5
+	.uleb128 0x14c
+	.long	.LASF502
+	.byte	0x5
+	.uleb128 0x14d
+	.long	.LASF503
+	.byte	0x5
+	.uleb128 0x155
+	.long	.LASF504
+	.byte	0x5
+	.uleb128 0x15f
+	.long	.LASF505
+	.byte	0x5
+	.uleb128 0x16c
+	.long	.LASF506
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF507
+	.byte	0x5
+	.uleb128 0x182
+	.long	.LASF508
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF509
+	.byte	0x5
+	.uleb128 0x18f
+	.long	.LASF510
+	.byte	0x5
+	.uleb128 0x198
+	.long	.LASF511
+	.byte	0x5
+	.uleb128 0x1a1
+	.long	.LASF512
+	.byte	0x6
+	.uleb128 0x1a9
+	.long	.LASF513
+	.byte	0x5
+	.uleb128 0x1aa
+	.long	.LASF514
+	.byte	0x5
+	.uleb128 0x1b3
+	.long	.LASF515
+	.byte	0x5
+	.uleb128 0x1c5
+	.long	.LASF516
+	.byte	0x5
+	.uleb128 0x1c6
+	.long	.LASF517
+	.byte	0x5
+	.uleb128 0x1cf
+	.long	.LASF518
+	.byte	0x5
+	.uleb128 0x1d5
+	.long	.LASF519
+	.byte	0x5
+	.uleb128 0x1d6
+	.long	.LASF520
+	.byte	0x5
+	.uleb128 0x1f1
+	.long	.LASF521
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF522
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF523
+	.byte	0x5
+	.uleb128 0x216
+	.long	.LASF524
+	.byte	0x6
+	.uleb128 0x21c
+	.long	.LASF525
+	.byte	0x5
+	.uleb128 0x220
+	.long	.LASF526
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.cdefs.h.618.aa66ffd9944c5208c2ff171a52d6bbbe,comdat
+.Ldebug_macro9:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x26a
+	.long	.LASF528
+	.byte	0x5
+	.uleb128 0x26b
+	.long	.LASF529
+	.byte	0x5
+	.uleb128 0x26c
+	.long	.LASF530
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF531
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF532
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF533
+	.byte	0x5
+	.uleb128 0x271
+	.long	.LASF534
+	.byte	0x5
+	.uleb128 0x272
+	.long	.LASF535
+	.byte	0x5
+	.uleb128 0x27d
+	.long	.LASF536
+	.byte	0x5
+	.uleb128 0x27e
+	.long	.LASF537
+	.byte	0x5
+	.uleb128 0x290
+	.long	.LASF538
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF539
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF540
+	.byte	0x5
+	.uleb128 0x2a6
+	.long	.LASF541
+	.byte	0x5
+	.uleb128 0x2b3
+	.long	.LASF542
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF543
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF544
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stubs64.h.10.7865f4f7062bab1c535c1f73f43aa9b9,comdat
+.Ldebug_macro10:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF546
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF547
+	.byte	0x5
+	.uleb128 0xc
+	.long	.LASF548
+	.byte	0x5
+	.uleb128 0xd
+	.long	.LASF549
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF550
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF551
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF552
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF553
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.37.e7d4b6f4649b40d3e0dce357ae78234f,comdat
+.Ldebug_macro11:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.types.h.109.56eb9ae966b255288cc544f18746a7ff,comdat
+.Ldebug_macro12:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF569
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF570
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF571
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF572
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF573
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF574
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF575
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF576
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF577
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF578
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF579
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF580
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF581
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF582
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF583
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.typesizes.h.24.ccf5919b8e01b553263cf8f4ab1d5fde,comdat
+.Ldebug_macro13:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF584
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF585
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF586
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF587
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF588
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF589
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF590
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF591
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF592
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF593
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF594
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF595
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF596
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF597
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF598
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF599
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF600
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF601
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF602
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF603
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF604
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF605
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF606
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF607
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF608
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF609
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF610
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF611
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF612
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF613
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF614
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF615
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF616
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF617
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF618
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF619
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF620
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF621
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF622
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF623
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF624
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF625
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time64.h.24.a8166ae916ec910dab0d8987098d42ee,comdat
+.Ldebug_macro14:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF626
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF627
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.wchar.h.20.510818a05484290d697a517509bf4b2d,comdat
+.Ldebug_macro15:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF629
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF630
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF631
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stdint.h.88.7e8071bbba3b822ff5b29420f80324ec,comdat
+.Ldebug_macro16:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF634
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF125
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF134
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF635
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF636
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF637
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF638
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF639
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF640
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF641
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF642
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF643
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF644
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF645
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF646
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF647
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF648
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF649
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF650
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF651
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF652
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF653
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF654
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF655
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF656
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF657
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF658
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF659
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF660
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF661
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF662
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF663
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF664
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF665
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF666
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF667
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF668
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF669
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF670
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF671
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF672
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF673
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF674
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF675
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF676
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF677
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF678
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF679
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF680
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF681
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF682
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF683
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF684
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF685
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF686
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF687
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF688
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF689
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF690
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF691
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF692
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF693
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF694
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF695
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.20.efabd1018df5d7b4052c27dc6bdd5ce5,comdat
+.Ldebug_macro17:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF698
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF699
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF700
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF701
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endianness.h.2.2c6a211f7909f3af5e9e9cfa3b6b63c8,comdat
+.Ldebug_macro18:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2
+	.long	.LASF702
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF703
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.endian.h.40.9e5d395adda2f4eb53ae69b69b664084,comdat
+.Ldebug_macro19:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF704
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF705
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.43.a617e65eb66869c389e597be8bb95a7c,comdat
+.Ldebug_macro20:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF706
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF707
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF708
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF709
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF710
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF711
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF712
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF713
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF714
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF715
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF716
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF717
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF718
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF719
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF720
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF721
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF722
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF723
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF724
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF725
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF726
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF727
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF728
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF729
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.ctype.h.241.7270a880a9a032c7121aef6d31a9a9f4,comdat
+.Ldebug_macro21:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF732
+	.byte	0x5
+	.uleb128 0xf4
+	.long	.LASF733
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF734
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF735
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF736
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF737
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF738
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF739
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF740
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF741
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF742
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF743
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF744
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF745
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF746
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF747
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF748
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF749
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF750
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF751
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF752
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF753
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF754
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF755
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF756
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF757
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF758
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF759
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF760
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF761
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF762
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF763
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF764
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF765
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.24.808d6e83a8b3b11b5fa9117392e0d6ca,comdat
+.Ldebug_macro22:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF766
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF399
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libcheaderstart.h.31.045646cfd09d1c615866e08d91c4f364,comdat
+.Ldebug_macro23:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1f
+	.long	.LASF400
+	.byte	0x6
+	.uleb128 0x25
+	.long	.LASF554
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF555
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF556
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF557
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF558
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF559
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF560
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF561
+	.byte	0x6
+	.uleb128 0x5a
+	.long	.LASF562
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF563
+	.byte	0x6
+	.uleb128 0x60
+	.long	.LASF564
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF565
+	.byte	0x6
+	.uleb128 0x69
+	.long	.LASF566
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF567
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.libmsimddeclstubs.h.34.70d39999a9be1e0e0e3916021c6182d5,comdat
+.Ldebug_macro24:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF767
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF768
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF769
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF770
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF771
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF772
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF773
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF774
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF775
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF776
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF777
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF778
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF779
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF780
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF781
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF782
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF783
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF784
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF785
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF786
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF787
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF788
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF789
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF790
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF791
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF792
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF793
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF794
+	.byte	0x5
+	.uleb128 0x41
+	.long	.LASF795
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF796
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF797
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF798
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF799
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF800
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF801
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF802
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF803
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF804
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF805
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF806
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF807
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF808
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF809
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF810
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF811
+	.byte	0x5
+	.uleb128 0x54
+	.long	.LASF812
+	.byte	0x5
+	.uleb128 0x55
+	.long	.LASF813
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF814
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF815
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF816
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF817
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF818
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF819
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF820
+	.byte	0x5
+	.uleb128 0x5e
+	.long	.LASF821
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF822
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF823
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF824
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF825
+	.byte	0x5
+	.uleb128 0x63
+	.long	.LASF826
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF827
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF828
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF829
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF830
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF831
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF832
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF833
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF834
+	.byte	0x5
+	.uleb128 0x6d
+	.long	.LASF835
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF836
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF837
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF838
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF839
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF840
+	.byte	0x5
+	.uleb128 0x74
+	.long	.LASF841
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF842
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF843
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF844
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF845
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF846
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF847
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF848
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF849
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF850
+	.byte	0x5
+	.uleb128 0x7f
+	.long	.LASF851
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF852
+	.byte	0x5
+	.uleb128 0x81
+	.long	.LASF853
+	.byte	0x5
+	.uleb128 0x82
+	.long	.LASF854
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF855
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF856
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF857
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF858
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF859
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF860
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF861
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF862
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF863
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF864
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF865
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF866
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF867
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF868
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF869
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF870
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF871
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF872
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF873
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF874
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF875
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF876
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF877
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF878
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF879
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF880
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF881
+	.byte	0x5
+	.uleb128 0xa1
+	.long	.LASF882
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF883
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF884
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF885
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF886
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF887
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF888
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF889
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF890
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF891
+	.byte	0x5
+	.uleb128 0xac
+	.long	.LASF892
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF893
+	.byte	0x5
+	.uleb128 0xae
+	.long	.LASF894
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF895
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF896
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF897
+	.byte	0x5
+	.uleb128 0xb3
+	.long	.LASF898
+	.byte	0x5
+	.uleb128 0xb4
+	.long	.LASF899
+	.byte	0x5
+	.uleb128 0xb5
+	.long	.LASF900
+	.byte	0x5
+	.uleb128 0xb6
+	.long	.LASF901
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF902
+	.byte	0x5
+	.uleb128 0xb8
+	.long	.LASF903
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF904
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF905
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF906
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF907
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF908
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF909
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF910
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF911
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF912
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF913
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF914
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF915
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF916
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF917
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF918
+	.byte	0x5
+	.uleb128 0xca
+	.long	.LASF919
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF920
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF921
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF922
+	.byte	0x5
+	.uleb128 0xce
+	.long	.LASF923
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF924
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF925
+	.byte	0x5
+	.uleb128 0xd1
+	.long	.LASF926
+	.byte	0x5
+	.uleb128 0xd2
+	.long	.LASF927
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF928
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF929
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF930
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF931
+	.byte	0x5
+	.uleb128 0xd8
+	.long	.LASF932
+	.byte	0x5
+	.uleb128 0xd9
+	.long	.LASF933
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF934
+	.byte	0x5
+	.uleb128 0xdb
+	.long	.LASF935
+	.byte	0x5
+	.uleb128 0xdc
+	.long	.LASF936
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF937
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF938
+	.byte	0x5
+	.uleb128 0xe0
+	.long	.LASF939
+	.byte	0x5
+	.uleb128 0xe1
+	.long	.LASF940
+	.byte	0x5
+	.uleb128 0xe2
+	.long	.LASF941
+	.byte	0x5
+	.uleb128 0xe3
+	.long	.LASF942
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF943
+	.byte	0x5
+	.uleb128 0xe5
+	.long	.LASF944
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF945
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF946
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF947
+	.byte	0x5
+	.uleb128 0xea
+	.long	.LASF948
+	.byte	0x5
+	.uleb128 0xeb
+	.long	.LASF949
+	.byte	0x5
+	.uleb128 0xec
+	.long	.LASF950
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF951
+	.byte	0x5
+	.uleb128 0xee
+	.long	.LASF952
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF953
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF954
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF955
+	.byte	0x5
+	.uleb128 0xf2
+	.long	.LASF956
+	.byte	0x5
+	.uleb128 0xf3
+	.long	.LASF957
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF958
+	.byte	0x5
+	.uleb128 0xf6
+	.long	.LASF959
+	.byte	0x5
+	.uleb128 0xf7
+	.long	.LASF960
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF961
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF962
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF963
+	.byte	0x5
+	.uleb128 0xfb
+	.long	.LASF964
+	.byte	0x5
+	.uleb128 0xfc
+	.long	.LASF965
+	.byte	0x5
+	.uleb128 0xfd
+	.long	.LASF966
+	.byte	0x5
+	.uleb128 0xfe
+	.long	.LASF967
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF968
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF969
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF970
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF971
+	.byte	0x5
+	.uleb128 0x104
+	.long	.LASF972
+	.byte	0x5
+	.uleb128 0x105
+	.long	.LASF973
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF974
+	.byte	0x5
+	.uleb128 0x107
+	.long	.LASF975
+	.byte	0x5
+	.uleb128 0x108
+	.long	.LASF976
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF977
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF978
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF979
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF980
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF981
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF982
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF983
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF984
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF985
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF986
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF987
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF988
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF989
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF990
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF991
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF992
+	.byte	0x5
+	.uleb128 0x11b
+	.long	.LASF993
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF994
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF995
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF996
+	.byte	0x5
+	.uleb128 0x11f
+	.long	.LASF997
+	.byte	0x5
+	.uleb128 0x121
+	.long	.LASF998
+	.byte	0x5
+	.uleb128 0x122
+	.long	.LASF999
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1000
+	.byte	0x5
+	.uleb128 0x124
+	.long	.LASF1001
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1002
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1003
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1004
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1005
+	.byte	0x5
+	.uleb128 0x129
+	.long	.LASF1006
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1007
+	.byte	0x5
+	.uleb128 0x12c
+	.long	.LASF1008
+	.byte	0x5
+	.uleb128 0x12d
+	.long	.LASF1009
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1010
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1011
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1012
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1013
+	.byte	0x5
+	.uleb128 0x132
+	.long	.LASF1014
+	.byte	0x5
+	.uleb128 0x133
+	.long	.LASF1015
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1016
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1017
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1018
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1019
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1020
+	.byte	0x5
+	.uleb128 0x13a
+	.long	.LASF1021
+	.byte	0x5
+	.uleb128 0x13b
+	.long	.LASF1022
+	.byte	0x5
+	.uleb128 0x13c
+	.long	.LASF1023
+	.byte	0x5
+	.uleb128 0x13d
+	.long	.LASF1024
+	.byte	0x5
+	.uleb128 0x13e
+	.long	.LASF1025
+	.byte	0x5
+	.uleb128 0x13f
+	.long	.LASF1026
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1027
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1028
+	.byte	0x5
+	.uleb128 0x143
+	.long	.LASF1029
+	.byte	0x5
+	.uleb128 0x144
+	.long	.LASF1030
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1031
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1032
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1033
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1034
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1035
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1036
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1037
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatn.h.20.80c7cf8a8dfad237004b28d051d5afda,comdat
+.Ldebug_macro25:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1038
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1039
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1040
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1041
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1042
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1043
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1044
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.floatncommon.h.34.7e1840d7dfb19e9bdb51aeb077d76637,comdat
+.Ldebug_macro26:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1046
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1047
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1048
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1049
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1050
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1051
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1052
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1053
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1054
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1055
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1056
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1057
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1058
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1059
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1060
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1061
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1062
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1063
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1064
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1065
+	.byte	0x5
+	.uleb128 0xb7
+	.long	.LASF1066
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.48.5dafc6157c80230c0414aa9de5e109ba,comdat
+.Ldebug_macro27:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1067
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1068
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1069
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1070
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1071
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.fplogb.h.23.f264b61801f4cf347bed2d0fad7232d9,comdat
+.Ldebug_macro28:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1073
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1074
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.207.154fc91142a9a5fbf7efb31ec64eb6b5,comdat
+.Ldebug_macro29:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xcf
+	.long	.LASF1075
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1076
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.276.0ce1639e4fd0f75af1ac8728ad903714,comdat
+.Ldebug_macro30:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1077
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1078
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1079
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1080
+	.byte	0x5
+	.uleb128 0x120
+	.long	.LASF1081
+	.byte	0x5
+	.uleb128 0x123
+	.long	.LASF1082
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1083
+	.byte	0x5
+	.uleb128 0x128
+	.long	.LASF1084
+	.byte	0x5
+	.uleb128 0x12a
+	.long	.LASF1085
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1086
+	.byte	0x5
+	.uleb128 0x131
+	.long	.LASF1087
+	.byte	0x5
+	.uleb128 0x134
+	.long	.LASF1088
+	.byte	0x5
+	.uleb128 0x135
+	.long	.LASF1089
+	.byte	0x5
+	.uleb128 0x136
+	.long	.LASF1090
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1091
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.314.55d9bc10b03e05989ad6400842f5a189,comdat
+.Ldebug_macro31:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x13a
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x13b
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x13c
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x13d
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x145
+	.long	.LASF1096
+	.byte	0x5
+	.uleb128 0x146
+	.long	.LASF1097
+	.byte	0x5
+	.uleb128 0x147
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x148
+	.long	.LASF1091
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.331.a75427efad95ca361cbcd39e72516aa4,comdat
+.Ldebug_macro32:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x14b
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x14c
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x14d
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x14e
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1099
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1100
+	.byte	0x5
+	.uleb128 0x18b
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x18c
+	.long	.LASF1091
+	.byte	0x5
+	.uleb128 0x18d
+	.long	.LASF1101
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.401.6bdb6458b6d78f00f8450a35891b9a64,comdat
+.Ldebug_macro33:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x191
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x192
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x193
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x194
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1ba
+	.long	.LASF1102
+	.byte	0x5
+	.uleb128 0x1bb
+	.long	.LASF1103
+	.byte	0x5
+	.uleb128 0x1bc
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1bd
+	.long	.LASF1104
+	.byte	0x6
+	.uleb128 0x1c4
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x1c5
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x1c6
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x1c7
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1cb
+	.long	.LASF1105
+	.byte	0x5
+	.uleb128 0x1cc
+	.long	.LASF1106
+	.byte	0x5
+	.uleb128 0x1cd
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1ce
+	.long	.LASF1104
+	.byte	0x6
+	.uleb128 0x1d5
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x1d6
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x1d7
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x1d8
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1dc
+	.long	.LASF1107
+	.byte	0x5
+	.uleb128 0x1dd
+	.long	.LASF1108
+	.byte	0x5
+	.uleb128 0x1de
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1df
+	.long	.LASF1104
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.math.h.486.a7407a4b77ad0f3687700042629bc5bf,comdat
+.Ldebug_macro34:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x1e6
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x1e7
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x1e8
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x1e9
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1109
+	.byte	0x5
+	.uleb128 0x1ee
+	.long	.LASF1110
+	.byte	0x5
+	.uleb128 0x1ef
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x1f0
+	.long	.LASF1104
+	.byte	0x6
+	.uleb128 0x1f7
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x1f8
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x1f9
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x1fa
+	.long	.LASF1095
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1111
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1112
+	.byte	0x5
+	.uleb128 0x200
+	.long	.LASF1098
+	.byte	0x5
+	.uleb128 0x201
+	.long	.LASF1104
+	.byte	0x6
+	.uleb128 0x208
+	.long	.LASF1092
+	.byte	0x6
+	.uleb128 0x209
+	.long	.LASF1093
+	.byte	0x6
+	.uleb128 0x20a
+	.long	.LASF1094
+	.byte	0x6
+	.uleb128 0x20b
+	.long	.LASF1095
+	.byte	0x6
+	.uleb128 0x21f
+	.long	.LASF1113
+	.byte	0x6
+	.uleb128 0x220
+	.long	.LASF1114
+	.byte	0x6
+	.uleb128 0x221
+	.long	.LASF1115
+	.byte	0x6
+	.uleb128 0x222
+	.long	.LASF1116
+	.byte	0x6
+	.uleb128 0x223
+	.long	.LASF1117
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1118
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1119
+	.byte	0x5
+	.uleb128 0x228
+	.long	.LASF1120
+	.byte	0x5
+	.uleb128 0x229
+	.long	.LASF1121
+	.byte	0x5
+	.uleb128 0x22b
+	.long	.LASF1122
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1123
+	.byte	0x6
+	.uleb128 0x34d
+	.long	.LASF1124
+	.byte	0x6
+	.uleb128 0x34e
+	.long	.LASF1125
+	.byte	0x6
+	.uleb128 0x34f
+	.long	.LASF1126
+	.byte	0x6
+	.uleb128 0x350
+	.long	.LASF1127
+	.byte	0x6
+	.uleb128 0x351
+	.long	.LASF1128
+	.byte	0x6
+	.uleb128 0x352
+	.long	.LASF1129
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1130
+	.byte	0x5
+	.uleb128 0x37a
+	.long	.LASF1131
+	.byte	0x5
+	.uleb128 0x381
+	.long	.LASF1132
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1133
+	.byte	0x5
+	.uleb128 0x3ac
+	.long	.LASF1134
+	.byte	0x5
+	.uleb128 0x3af
+	.long	.LASF1135
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1136
+	.byte	0x5
+	.uleb128 0x3b5
+	.long	.LASF1137
+	.byte	0x5
+	.uleb128 0x3c7
+	.long	.LASF1138
+	.byte	0x5
+	.uleb128 0x3cf
+	.long	.LASF1139
+	.byte	0x5
+	.uleb128 0x3e2
+	.long	.LASF1140
+	.byte	0x5
+	.uleb128 0x3ea
+	.long	.LASF1141
+	.byte	0x5
+	.uleb128 0x3f3
+	.long	.LASF1142
+	.byte	0x5
+	.uleb128 0x405
+	.long	.LASF1143
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1144
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1145
+	.byte	0x5
+	.uleb128 0x418
+	.long	.LASF1146
+	.byte	0x5
+	.uleb128 0x47a
+	.long	.LASF1147
+	.byte	0x5
+	.uleb128 0x47b
+	.long	.LASF1148
+	.byte	0x5
+	.uleb128 0x47c
+	.long	.LASF1149
+	.byte	0x5
+	.uleb128 0x47d
+	.long	.LASF1150
+	.byte	0x5
+	.uleb128 0x47e
+	.long	.LASF1151
+	.byte	0x5
+	.uleb128 0x47f
+	.long	.LASF1152
+	.byte	0x5
+	.uleb128 0x480
+	.long	.LASF1153
+	.byte	0x5
+	.uleb128 0x481
+	.long	.LASF1154
+	.byte	0x5
+	.uleb128 0x482
+	.long	.LASF1155
+	.byte	0x5
+	.uleb128 0x483
+	.long	.LASF1156
+	.byte	0x5
+	.uleb128 0x484
+	.long	.LASF1157
+	.byte	0x5
+	.uleb128 0x485
+	.long	.LASF1158
+	.byte	0x5
+	.uleb128 0x486
+	.long	.LASF1159
+	.byte	0x5
+	.uleb128 0x519
+	.long	.LASF1160
+	.byte	0x5
+	.uleb128 0x51a
+	.long	.LASF1161
+	.byte	0x5
+	.uleb128 0x51b
+	.long	.LASF1162
+	.byte	0x5
+	.uleb128 0x51c
+	.long	.LASF1163
+	.byte	0x5
+	.uleb128 0x51d
+	.long	.LASF1164
+	.byte	0x5
+	.uleb128 0x51e
+	.long	.LASF1165
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common.h.23.1139363c6676238c3d175d277c9a782f,comdat
+.Ldebug_macro35:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1166
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1167
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1168
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1169
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1170
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1171
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1172
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1173
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1174
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1175
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1176
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1177
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1178
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1179
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1180
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1181
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1182
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1183
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1184
+	.byte	0x5
+	.uleb128 0x40
+	.long	.LASF1185
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1186
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1187
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1189
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1190
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1191
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1192
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1193
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1194
+	.byte	0x5
+	.uleb128 0x52
+	.long	.LASF1195
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1196
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1197
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1198
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1199
+	.byte	0x5
+	.uleb128 0x5b
+	.long	.LASF1200
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1201
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1202
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1203
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1204
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1205
+	.byte	0x5
+	.uleb128 0x64
+	.long	.LASF1188
+	.byte	0x5
+	.uleb128 0x65
+	.long	.LASF1206
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1207
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1208
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1209
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1210
+	.byte	0x5
+	.uleb128 0x6c
+	.long	.LASF1211
+	.byte	0x5
+	.uleb128 0x6e
+	.long	.LASF1212
+	.byte	0x5
+	.uleb128 0x6f
+	.long	.LASF1213
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1214
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1215
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1216
+	.byte	0x5
+	.uleb128 0x75
+	.long	.LASF1217
+	.byte	0x5
+	.uleb128 0x76
+	.long	.LASF1218
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1219
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1220
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1221
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1222
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1223
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1224
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1225
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1226
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1227
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1228
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1229
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1230
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1231
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1232
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1233
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1234
+	.byte	0x5
+	.uleb128 0x90
+	.long	.LASF1235
+	.byte	0x5
+	.uleb128 0x91
+	.long	.LASF1236
+	.byte	0x5
+	.uleb128 0x92
+	.long	.LASF1237
+	.byte	0x5
+	.uleb128 0x93
+	.long	.LASF1238
+	.byte	0x5
+	.uleb128 0x94
+	.long	.LASF1239
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1240
+	.byte	0x5
+	.uleb128 0x98
+	.long	.LASF1241
+	.byte	0x5
+	.uleb128 0x99
+	.long	.LASF1242
+	.byte	0x5
+	.uleb128 0x9a
+	.long	.LASF1243
+	.byte	0x5
+	.uleb128 0x9b
+	.long	.LASF1244
+	.byte	0x5
+	.uleb128 0x9c
+	.long	.LASF1245
+	.byte	0x5
+	.uleb128 0x9d
+	.long	.LASF1246
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1247
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1248
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1249
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1250
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1251
+	.byte	0x5
+	.uleb128 0xa5
+	.long	.LASF1252
+	.byte	0x5
+	.uleb128 0xa6
+	.long	.LASF1253
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1254
+	.byte	0x5
+	.uleb128 0xaa
+	.long	.LASF1255
+	.byte	0x5
+	.uleb128 0xab
+	.long	.LASF1256
+	.byte	0x5
+	.uleb128 0xaf
+	.long	.LASF1257
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1258
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.stddef.h.39.14c6052d10f67a5d7cb73ea4beacde53,comdat
+.Ldebug_macro36:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1259
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1260
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1261
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1262
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1263
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1264
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1265
+	.byte	0x5
+	.uleb128 0x88
+	.long	.LASF1266
+	.byte	0x5
+	.uleb128 0x89
+	.long	.LASF1267
+	.byte	0x5
+	.uleb128 0x8a
+	.long	.LASF1268
+	.byte	0x5
+	.uleb128 0x8b
+	.long	.LASF1269
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1270
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1271
+	.byte	0x6
+	.uleb128 0x9e
+	.long	.LASF1272
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1273
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1274
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1275
+	.byte	0x5
+	.uleb128 0xbc
+	.long	.LASF1276
+	.byte	0x5
+	.uleb128 0xbd
+	.long	.LASF1277
+	.byte	0x5
+	.uleb128 0xbe
+	.long	.LASF1278
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1279
+	.byte	0x5
+	.uleb128 0xc0
+	.long	.LASF1280
+	.byte	0x5
+	.uleb128 0xc1
+	.long	.LASF1281
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1282
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1283
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1284
+	.byte	0x5
+	.uleb128 0xc5
+	.long	.LASF1285
+	.byte	0x5
+	.uleb128 0xc6
+	.long	.LASF1286
+	.byte	0x5
+	.uleb128 0xc7
+	.long	.LASF1287
+	.byte	0x5
+	.uleb128 0xc8
+	.long	.LASF1288
+	.byte	0x5
+	.uleb128 0xc9
+	.long	.LASF1289
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1290
+	.byte	0x6
+	.uleb128 0xed
+	.long	.LASF1291
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1292
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1293
+	.byte	0x5
+	.uleb128 0x10d
+	.long	.LASF1294
+	.byte	0x5
+	.uleb128 0x10e
+	.long	.LASF1295
+	.byte	0x5
+	.uleb128 0x10f
+	.long	.LASF1296
+	.byte	0x5
+	.uleb128 0x110
+	.long	.LASF1297
+	.byte	0x5
+	.uleb128 0x111
+	.long	.LASF1298
+	.byte	0x5
+	.uleb128 0x112
+	.long	.LASF1299
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1300
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1301
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1302
+	.byte	0x5
+	.uleb128 0x116
+	.long	.LASF1303
+	.byte	0x5
+	.uleb128 0x117
+	.long	.LASF1304
+	.byte	0x5
+	.uleb128 0x118
+	.long	.LASF1305
+	.byte	0x5
+	.uleb128 0x119
+	.long	.LASF1306
+	.byte	0x5
+	.uleb128 0x11a
+	.long	.LASF1307
+	.byte	0x6
+	.uleb128 0x127
+	.long	.LASF1308
+	.byte	0x6
+	.uleb128 0x15d
+	.long	.LASF1309
+	.byte	0x6
+	.uleb128 0x18f
+	.long	.LASF1310
+	.byte	0x5
+	.uleb128 0x194
+	.long	.LASF1311
+	.byte	0x6
+	.uleb128 0x19a
+	.long	.LASF1312
+	.byte	0x5
+	.uleb128 0x19f
+	.long	.LASF1313
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.target.h.34.d7d153eaeb313ad53cbaf9f80a19cc8d,comdat
+.Ldebug_macro37:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1314
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1315
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1316
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1317
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1318
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1319
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1320
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1321
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1322
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1323
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1324
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1325
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1326
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1327
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1328
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1329
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1330
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1331
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1332
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1333
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1334
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1335
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1336
+	.byte	0x6
+	.uleb128 0x41
+	.long	.LASF1337
+	.byte	0x6
+	.uleb128 0x42
+	.long	.LASF1338
+	.byte	0x6
+	.uleb128 0x43
+	.long	.LASF1339
+	.byte	0x6
+	.uleb128 0x44
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x45
+	.long	.LASF1341
+	.byte	0x6
+	.uleb128 0x46
+	.long	.LASF1342
+	.byte	0x6
+	.uleb128 0x47
+	.long	.LASF1343
+	.byte	0x6
+	.uleb128 0x48
+	.long	.LASF1344
+	.byte	0x6
+	.uleb128 0x49
+	.long	.LASF1345
+	.byte	0x6
+	.uleb128 0x4a
+	.long	.LASF1346
+	.byte	0x6
+	.uleb128 0x4b
+	.long	.LASF1347
+	.byte	0x6
+	.uleb128 0x4c
+	.long	.LASF1348
+	.byte	0x6
+	.uleb128 0x4d
+	.long	.LASF1349
+	.byte	0x6
+	.uleb128 0x4e
+	.long	.LASF1350
+	.byte	0x6
+	.uleb128 0x4f
+	.long	.LASF1351
+	.byte	0x6
+	.uleb128 0x50
+	.long	.LASF1352
+	.byte	0x6
+	.uleb128 0x51
+	.long	.LASF1353
+	.byte	0x6
+	.uleb128 0x52
+	.long	.LASF1354
+	.byte	0x6
+	.uleb128 0x53
+	.long	.LASF1355
+	.byte	0x6
+	.uleb128 0x54
+	.long	.LASF1356
+	.byte	0x6
+	.uleb128 0x55
+	.long	.LASF1357
+	.byte	0x6
+	.uleb128 0x56
+	.long	.LASF1358
+	.byte	0x6
+	.uleb128 0x57
+	.long	.LASF1359
+	.byte	0x6
+	.uleb128 0x58
+	.long	.LASF1360
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1361
+	.byte	0x5
+	.uleb128 0x5d
+	.long	.LASF1362
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1363
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1364
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1365
+	.byte	0x5
+	.uleb128 0x77
+	.long	.LASF1366
+	.byte	0x5
+	.uleb128 0x78
+	.long	.LASF1367
+	.byte	0x5
+	.uleb128 0x79
+	.long	.LASF1368
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1369
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1370
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1371
+	.byte	0x5
+	.uleb128 0x7d
+	.long	.LASF1372
+	.byte	0x5
+	.uleb128 0x7e
+	.long	.LASF1373
+	.byte	0x5
+	.uleb128 0x80
+	.long	.LASF1374
+	.byte	0x5
+	.uleb128 0x87
+	.long	.LASF1375
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.common_post.h.24.57ce87e49db1cb1e2cadae768de7b37e,comdat
+.Ldebug_macro38:
+	.value	0x5
+	.byte	0
+	.byte	0x6
+	.uleb128 0x18
+	.long	.LASF1340
+	.byte	0x6
+	.uleb128 0x19
+	.long	.LASF1341
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1376
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1377
+	.byte	0x6
+	.uleb128 0x3d
+	.long	.LASF1337
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1378
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1379
+	.byte	0x5
+	.uleb128 0x44
+	.long	.LASF1380
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1381
+	.byte	0x5
+	.uleb128 0x46
+	.long	.LASF1382
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1383
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.build_config.h.20.1837b5a96d526a691c4a05bcdd27e230,comdat
+.Ldebug_macro39:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x14
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1385
+	.byte	0x5
+	.uleb128 0x1e
+	.long	.LASF1386
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1387
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1388
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1389
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1390
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1391
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1392
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1393
+	.byte	0x5
+	.uleb128 0x37
+	.long	.LASF1394
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.22.4ce71bac8f6b0b307ef3e171fab30193,comdat
+.Ldebug_macro40:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x16
+	.long	.LASF1395
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1396
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1397
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.parameter_group.h.62.4f92e4b7aa6ff0ed137c85a6ba31abea,comdat
+.Ldebug_macro41:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1398
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1399
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1400
+	.byte	0x5
+	.uleb128 0x5c
+	.long	.LASF1401
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1402
+	.byte	0x5
+	.uleb128 0x62
+	.long	.LASF1403
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1404
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1405
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1406
+	.byte	0x5
+	.uleb128 0x86
+	.long	.LASF1407
+	.byte	0x5
+	.uleb128 0x8f
+	.long	.LASF1408
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1409
+	.byte	0x5
+	.uleb128 0xa2
+	.long	.LASF1410
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1411
+	.byte	0x5
+	.uleb128 0xad
+	.long	.LASF1412
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1413
+	.byte	0x5
+	.uleb128 0xbf
+	.long	.LASF1414
+	.byte	0x5
+	.uleb128 0xd0
+	.long	.LASF1415
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1416
+	.byte	0x5
+	.uleb128 0xe4
+	.long	.LASF1417
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1418
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1419
+	.byte	0x5
+	.uleb128 0xf5
+	.long	.LASF1420
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.time.h.34.6e4f39f1aa9c0f701a86ab3017043312,comdat
+.Ldebug_macro42:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1421
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1422
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1423
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1424
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1425
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1426
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1427
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1428
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1429
+	.byte	0x5
+	.uleb128 0x5a
+	.long	.LASF1430
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.debug.h.34.02be8ed0fa9bcb1c8378b37312c73898,comdat
+.Ldebug_macro43:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1431
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1432
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.maths.h.24.c45f0e1ca532e048fd65c8d84ec0dda2,comdat
+.Ldebug_macro44:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1433
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1434
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1435
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1436
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1437
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1438
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1439
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1440
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1441
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1442
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1443
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1444
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1445
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1446
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1447
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1448
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1449
+	.byte	0x5
+	.uleb128 0x35
+	.long	.LASF1450
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1451
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1452
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1453
+	.byte	0x5
+	.uleb128 0x3b
+	.long	.LASF1454
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1455
+	.byte	0x5
+	.uleb128 0x3d
+	.long	.LASF1456
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1457
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1458
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1459
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1460
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1461
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1462
+	.byte	0x5
+	.uleb128 0x51
+	.long	.LASF1463
+	.byte	0x5
+	.uleb128 0x53
+	.long	.LASF1464
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1465
+	.byte	0x5
+	.uleb128 0x59
+	.long	.LASF1466
+	.byte	0x5
+	.uleb128 0xa3
+	.long	.LASF1467
+	.byte	0x5
+	.uleb128 0xa4
+	.long	.LASF1468
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_types.h.11.9bafc00ebc9f0ad520c1fd2c443235d7,comdat
+.Ldebug_macro45:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0xb
+	.long	.LASF1470
+	.byte	0x5
+	.uleb128 0xe
+	.long	.LASF1471
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io.h.34.73ce89487fa85a56180db4b16fdddebc,comdat
+.Ldebug_macro46:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1472
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1473
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1474
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1475
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1476
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1477
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1478
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1479
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.utils.h.23.88ddef76e90a9f7147c6e3c170fa5b92,comdat
+.Ldebug_macro47:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1480
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1481
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1482
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1483
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1484
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1485
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1486
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1487
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1488
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1489
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1490
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1491
+	.byte	0x5
+	.uleb128 0x29
+	.long	.LASF1492
+	.byte	0x5
+	.uleb128 0x2f
+	.long	.LASF1493
+	.byte	0x5
+	.uleb128 0x32
+	.long	.LASF1494
+	.byte	0x5
+	.uleb128 0x34
+	.long	.LASF1384
+	.byte	0x5
+	.uleb128 0x36
+	.long	.LASF1495
+	.byte	0x5
+	.uleb128 0x38
+	.long	.LASF1496
+	.byte	0x5
+	.uleb128 0x3e
+	.long	.LASF1497
+	.byte	0x5
+	.uleb128 0x3f
+	.long	.LASF1498
+	.byte	0x5
+	.uleb128 0x47
+	.long	.LASF1499
+	.byte	0x5
+	.uleb128 0x48
+	.long	.LASF1500
+	.byte	0x5
+	.uleb128 0x49
+	.long	.LASF1501
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1502
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1503
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1504
+	.byte	0x5
+	.uleb128 0x70
+	.long	.LASF1505
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1506
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1507
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def.h.7.b833e5bf4ce4d53cb7bd5041b4a060bb,comdat
+.Ldebug_macro48:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x7
+	.long	.LASF1508
+	.byte	0x5
+	.uleb128 0x8
+	.long	.LASF1509
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1510
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1511
+	.byte	0x5
+	.uleb128 0x10
+	.long	.LASF1512
+	.byte	0x5
+	.uleb128 0x11
+	.long	.LASF1513
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1514
+	.byte	0x5
+	.uleb128 0x17
+	.long	.LASF1515
+	.byte	0x5
+	.uleb128 0x1a
+	.long	.LASF1516
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1517
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1518
+	.byte	0x5
+	.uleb128 0x1d
+	.long	.LASF1519
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.io_def_generated.h.9.91a7042725ac8789f3da9f2b2fd47855,comdat
+.Ldebug_macro49:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x9
+	.long	.LASF1520
+	.byte	0x5
+	.uleb128 0xa
+	.long	.LASF1521
+	.byte	0x5
+	.uleb128 0xf
+	.long	.LASF1522
+	.byte	0x5
+	.uleb128 0x12
+	.long	.LASF1523
+	.byte	0x5
+	.uleb128 0x13
+	.long	.LASF1524
+	.byte	0x5
+	.uleb128 0x18
+	.long	.LASF1525
+	.byte	0x5
+	.uleb128 0x1b
+	.long	.LASF1526
+	.byte	0x5
+	.uleb128 0x1c
+	.long	.LASF1527
+	.byte	0x5
+	.uleb128 0x21
+	.long	.LASF1528
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1529
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1530
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1531
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1532
+	.byte	0x5
+	.uleb128 0x31
+	.long	.LASF1533
+	.byte	0x5
+	.uleb128 0x33
+	.long	.LASF1534
+	.byte	0x5
+	.uleb128 0x39
+	.long	.LASF1535
+	.byte	0x5
+	.uleb128 0x3a
+	.long	.LASF1536
+	.byte	0x5
+	.uleb128 0x3c
+	.long	.LASF1537
+	.byte	0x5
+	.uleb128 0x42
+	.long	.LASF1538
+	.byte	0x5
+	.uleb128 0x43
+	.long	.LASF1539
+	.byte	0x5
+	.uleb128 0x45
+	.long	.LASF1540
+	.byte	0x5
+	.uleb128 0x4a
+	.long	.LASF1541
+	.byte	0x5
+	.uleb128 0x4b
+	.long	.LASF1542
+	.byte	0x5
+	.uleb128 0x4c
+	.long	.LASF1543
+	.byte	0x5
+	.uleb128 0x4d
+	.long	.LASF1544
+	.byte	0x5
+	.uleb128 0x4e
+	.long	.LASF1545
+	.byte	0x5
+	.uleb128 0x4f
+	.long	.LASF1546
+	.byte	0x5
+	.uleb128 0x50
+	.long	.LASF1547
+	.byte	0x5
+	.uleb128 0x56
+	.long	.LASF1548
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1549
+	.byte	0x5
+	.uleb128 0x58
+	.long	.LASF1550
+	.byte	0x5
+	.uleb128 0x5f
+	.long	.LASF1551
+	.byte	0x5
+	.uleb128 0x60
+	.long	.LASF1552
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1553
+	.byte	0x5
+	.uleb128 0x68
+	.long	.LASF1554
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1555
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1556
+	.byte	0x5
+	.uleb128 0x71
+	.long	.LASF1557
+	.byte	0x5
+	.uleb128 0x72
+	.long	.LASF1558
+	.byte	0x5
+	.uleb128 0x73
+	.long	.LASF1559
+	.byte	0x5
+	.uleb128 0x7a
+	.long	.LASF1560
+	.byte	0x5
+	.uleb128 0x7b
+	.long	.LASF1561
+	.byte	0x5
+	.uleb128 0x7c
+	.long	.LASF1562
+	.byte	0x5
+	.uleb128 0x83
+	.long	.LASF1563
+	.byte	0x5
+	.uleb128 0x84
+	.long	.LASF1564
+	.byte	0x5
+	.uleb128 0x85
+	.long	.LASF1565
+	.byte	0x5
+	.uleb128 0x8c
+	.long	.LASF1566
+	.byte	0x5
+	.uleb128 0x8d
+	.long	.LASF1567
+	.byte	0x5
+	.uleb128 0x8e
+	.long	.LASF1568
+	.byte	0x5
+	.uleb128 0x95
+	.long	.LASF1569
+	.byte	0x5
+	.uleb128 0x96
+	.long	.LASF1570
+	.byte	0x5
+	.uleb128 0x97
+	.long	.LASF1571
+	.byte	0x5
+	.uleb128 0x9e
+	.long	.LASF1572
+	.byte	0x5
+	.uleb128 0x9f
+	.long	.LASF1573
+	.byte	0x5
+	.uleb128 0xa0
+	.long	.LASF1574
+	.byte	0x5
+	.uleb128 0xa7
+	.long	.LASF1575
+	.byte	0x5
+	.uleb128 0xa8
+	.long	.LASF1576
+	.byte	0x5
+	.uleb128 0xa9
+	.long	.LASF1577
+	.byte	0x5
+	.uleb128 0xb0
+	.long	.LASF1578
+	.byte	0x5
+	.uleb128 0xb1
+	.long	.LASF1579
+	.byte	0x5
+	.uleb128 0xb2
+	.long	.LASF1580
+	.byte	0x5
+	.uleb128 0xb9
+	.long	.LASF1581
+	.byte	0x5
+	.uleb128 0xba
+	.long	.LASF1582
+	.byte	0x5
+	.uleb128 0xbb
+	.long	.LASF1583
+	.byte	0x5
+	.uleb128 0xc2
+	.long	.LASF1584
+	.byte	0x5
+	.uleb128 0xc3
+	.long	.LASF1585
+	.byte	0x5
+	.uleb128 0xc4
+	.long	.LASF1586
+	.byte	0x5
+	.uleb128 0xcb
+	.long	.LASF1587
+	.byte	0x5
+	.uleb128 0xcc
+	.long	.LASF1588
+	.byte	0x5
+	.uleb128 0xcd
+	.long	.LASF1589
+	.byte	0x5
+	.uleb128 0xd4
+	.long	.LASF1590
+	.byte	0x5
+	.uleb128 0xd5
+	.long	.LASF1591
+	.byte	0x5
+	.uleb128 0xd6
+	.long	.LASF1592
+	.byte	0x5
+	.uleb128 0xdd
+	.long	.LASF1593
+	.byte	0x5
+	.uleb128 0xde
+	.long	.LASF1594
+	.byte	0x5
+	.uleb128 0xdf
+	.long	.LASF1595
+	.byte	0x5
+	.uleb128 0xe6
+	.long	.LASF1596
+	.byte	0x5
+	.uleb128 0xe7
+	.long	.LASF1597
+	.byte	0x5
+	.uleb128 0xe8
+	.long	.LASF1598
+	.byte	0x5
+	.uleb128 0xef
+	.long	.LASF1599
+	.byte	0x5
+	.uleb128 0xf0
+	.long	.LASF1600
+	.byte	0x5
+	.uleb128 0xf1
+	.long	.LASF1601
+	.byte	0x5
+	.uleb128 0xf8
+	.long	.LASF1602
+	.byte	0x5
+	.uleb128 0xf9
+	.long	.LASF1603
+	.byte	0x5
+	.uleb128 0xfa
+	.long	.LASF1604
+	.byte	0x5
+	.uleb128 0x101
+	.long	.LASF1605
+	.byte	0x5
+	.uleb128 0x102
+	.long	.LASF1606
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1607
+	.byte	0x5
+	.uleb128 0x10a
+	.long	.LASF1608
+	.byte	0x5
+	.uleb128 0x10b
+	.long	.LASF1609
+	.byte	0x5
+	.uleb128 0x10c
+	.long	.LASF1610
+	.byte	0x5
+	.uleb128 0x113
+	.long	.LASF1611
+	.byte	0x5
+	.uleb128 0x114
+	.long	.LASF1612
+	.byte	0x5
+	.uleb128 0x115
+	.long	.LASF1613
+	.byte	0x5
+	.uleb128 0x11c
+	.long	.LASF1614
+	.byte	0x5
+	.uleb128 0x11d
+	.long	.LASF1615
+	.byte	0x5
+	.uleb128 0x11e
+	.long	.LASF1616
+	.byte	0x5
+	.uleb128 0x125
+	.long	.LASF1617
+	.byte	0x5
+	.uleb128 0x126
+	.long	.LASF1618
+	.byte	0x5
+	.uleb128 0x127
+	.long	.LASF1619
+	.byte	0x5
+	.uleb128 0x12e
+	.long	.LASF1620
+	.byte	0x5
+	.uleb128 0x12f
+	.long	.LASF1621
+	.byte	0x5
+	.uleb128 0x130
+	.long	.LASF1622
+	.byte	0x5
+	.uleb128 0x137
+	.long	.LASF1623
+	.byte	0x5
+	.uleb128 0x138
+	.long	.LASF1624
+	.byte	0x5
+	.uleb128 0x139
+	.long	.LASF1625
+	.byte	0x5
+	.uleb128 0x140
+	.long	.LASF1626
+	.byte	0x5
+	.uleb128 0x141
+	.long	.LASF1627
+	.byte	0x5
+	.uleb128 0x142
+	.long	.LASF1628
+	.byte	0x5
+	.uleb128 0x149
+	.long	.LASF1629
+	.byte	0x5
+	.uleb128 0x14a
+	.long	.LASF1630
+	.byte	0x5
+	.uleb128 0x14b
+	.long	.LASF1631
+	.byte	0x5
+	.uleb128 0x152
+	.long	.LASF1632
+	.byte	0x5
+	.uleb128 0x153
+	.long	.LASF1633
+	.byte	0x5
+	.uleb128 0x154
+	.long	.LASF1634
+	.byte	0x5
+	.uleb128 0x15b
+	.long	.LASF1635
+	.byte	0x5
+	.uleb128 0x15c
+	.long	.LASF1636
+	.byte	0x5
+	.uleb128 0x15d
+	.long	.LASF1637
+	.byte	0x5
+	.uleb128 0x164
+	.long	.LASF1638
+	.byte	0x5
+	.uleb128 0x165
+	.long	.LASF1639
+	.byte	0x5
+	.uleb128 0x166
+	.long	.LASF1640
+	.byte	0x5
+	.uleb128 0x16d
+	.long	.LASF1641
+	.byte	0x5
+	.uleb128 0x16e
+	.long	.LASF1642
+	.byte	0x5
+	.uleb128 0x16f
+	.long	.LASF1643
+	.byte	0x5
+	.uleb128 0x176
+	.long	.LASF1644
+	.byte	0x5
+	.uleb128 0x177
+	.long	.LASF1645
+	.byte	0x5
+	.uleb128 0x178
+	.long	.LASF1646
+	.byte	0x5
+	.uleb128 0x17f
+	.long	.LASF1647
+	.byte	0x5
+	.uleb128 0x180
+	.long	.LASF1648
+	.byte	0x5
+	.uleb128 0x181
+	.long	.LASF1649
+	.byte	0x5
+	.uleb128 0x188
+	.long	.LASF1650
+	.byte	0x5
+	.uleb128 0x189
+	.long	.LASF1651
+	.byte	0x5
+	.uleb128 0x18a
+	.long	.LASF1652
+	.byte	0x5
+	.uleb128 0x191
+	.long	.LASF1653
+	.byte	0x5
+	.uleb128 0x192
+	.long	.LASF1654
+	.byte	0x5
+	.uleb128 0x193
+	.long	.LASF1655
+	.byte	0x5
+	.uleb128 0x19a
+	.long	.LASF1656
+	.byte	0x5
+	.uleb128 0x19b
+	.long	.LASF1657
+	.byte	0x5
+	.uleb128 0x19c
+	.long	.LASF1658
+	.byte	0x5
+	.uleb128 0x1a3
+	.long	.LASF1659
+	.byte	0x5
+	.uleb128 0x1a4
+	.long	.LASF1660
+	.byte	0x5
+	.uleb128 0x1a5
+	.long	.LASF1661
+	.byte	0x5
+	.uleb128 0x1ac
+	.long	.LASF1662
+	.byte	0x5
+	.uleb128 0x1ad
+	.long	.LASF1663
+	.byte	0x5
+	.uleb128 0x1ae
+	.long	.LASF1664
+	.byte	0x5
+	.uleb128 0x1b5
+	.long	.LASF1665
+	.byte	0x5
+	.uleb128 0x1b6
+	.long	.LASF1666
+	.byte	0x5
+	.uleb128 0x1b7
+	.long	.LASF1667
+	.byte	0x5
+	.uleb128 0x1be
+	.long	.LASF1668
+	.byte	0x5
+	.uleb128 0x1bf
+	.long	.LASF1669
+	.byte	0x5
+	.uleb128 0x1c0
+	.long	.LASF1670
+	.byte	0x5
+	.uleb128 0x1c7
+	.long	.LASF1671
+	.byte	0x5
+	.uleb128 0x1c8
+	.long	.LASF1672
+	.byte	0x5
+	.uleb128 0x1c9
+	.long	.LASF1673
+	.byte	0x5
+	.uleb128 0x1d0
+	.long	.LASF1674
+	.byte	0x5
+	.uleb128 0x1d1
+	.long	.LASF1675
+	.byte	0x5
+	.uleb128 0x1d2
+	.long	.LASF1676
+	.byte	0x5
+	.uleb128 0x1d9
+	.long	.LASF1677
+	.byte	0x5
+	.uleb128 0x1da
+	.long	.LASF1678
+	.byte	0x5
+	.uleb128 0x1db
+	.long	.LASF1679
+	.byte	0x5
+	.uleb128 0x1e2
+	.long	.LASF1680
+	.byte	0x5
+	.uleb128 0x1e3
+	.long	.LASF1681
+	.byte	0x5
+	.uleb128 0x1e4
+	.long	.LASF1682
+	.byte	0x5
+	.uleb128 0x1eb
+	.long	.LASF1683
+	.byte	0x5
+	.uleb128 0x1ec
+	.long	.LASF1684
+	.byte	0x5
+	.uleb128 0x1ed
+	.long	.LASF1685
+	.byte	0x5
+	.uleb128 0x1f4
+	.long	.LASF1686
+	.byte	0x5
+	.uleb128 0x1f5
+	.long	.LASF1687
+	.byte	0x5
+	.uleb128 0x1f6
+	.long	.LASF1688
+	.byte	0x5
+	.uleb128 0x1fd
+	.long	.LASF1689
+	.byte	0x5
+	.uleb128 0x1fe
+	.long	.LASF1690
+	.byte	0x5
+	.uleb128 0x1ff
+	.long	.LASF1691
+	.byte	0x5
+	.uleb128 0x20a
+	.long	.LASF1692
+	.byte	0x5
+	.uleb128 0x20b
+	.long	.LASF1693
+	.byte	0x5
+	.uleb128 0x20c
+	.long	.LASF1694
+	.byte	0x5
+	.uleb128 0x213
+	.long	.LASF1695
+	.byte	0x5
+	.uleb128 0x214
+	.long	.LASF1696
+	.byte	0x5
+	.uleb128 0x215
+	.long	.LASF1697
+	.byte	0x5
+	.uleb128 0x21c
+	.long	.LASF1698
+	.byte	0x5
+	.uleb128 0x21d
+	.long	.LASF1699
+	.byte	0x5
+	.uleb128 0x21e
+	.long	.LASF1700
+	.byte	0x5
+	.uleb128 0x225
+	.long	.LASF1701
+	.byte	0x5
+	.uleb128 0x226
+	.long	.LASF1702
+	.byte	0x5
+	.uleb128 0x227
+	.long	.LASF1703
+	.byte	0x5
+	.uleb128 0x22e
+	.long	.LASF1704
+	.byte	0x5
+	.uleb128 0x22f
+	.long	.LASF1705
+	.byte	0x5
+	.uleb128 0x230
+	.long	.LASF1706
+	.byte	0x5
+	.uleb128 0x237
+	.long	.LASF1707
+	.byte	0x5
+	.uleb128 0x238
+	.long	.LASF1708
+	.byte	0x5
+	.uleb128 0x239
+	.long	.LASF1709
+	.byte	0x5
+	.uleb128 0x240
+	.long	.LASF1710
+	.byte	0x5
+	.uleb128 0x241
+	.long	.LASF1711
+	.byte	0x5
+	.uleb128 0x242
+	.long	.LASF1712
+	.byte	0x5
+	.uleb128 0x249
+	.long	.LASF1713
+	.byte	0x5
+	.uleb128 0x24a
+	.long	.LASF1714
+	.byte	0x5
+	.uleb128 0x24b
+	.long	.LASF1715
+	.byte	0x5
+	.uleb128 0x252
+	.long	.LASF1716
+	.byte	0x5
+	.uleb128 0x253
+	.long	.LASF1717
+	.byte	0x5
+	.uleb128 0x254
+	.long	.LASF1718
+	.byte	0x5
+	.uleb128 0x25b
+	.long	.LASF1719
+	.byte	0x5
+	.uleb128 0x25c
+	.long	.LASF1720
+	.byte	0x5
+	.uleb128 0x25d
+	.long	.LASF1721
+	.byte	0x5
+	.uleb128 0x264
+	.long	.LASF1722
+	.byte	0x5
+	.uleb128 0x265
+	.long	.LASF1723
+	.byte	0x5
+	.uleb128 0x266
+	.long	.LASF1724
+	.byte	0x5
+	.uleb128 0x26d
+	.long	.LASF1725
+	.byte	0x5
+	.uleb128 0x26e
+	.long	.LASF1726
+	.byte	0x5
+	.uleb128 0x26f
+	.long	.LASF1727
+	.byte	0x5
+	.uleb128 0x276
+	.long	.LASF1728
+	.byte	0x5
+	.uleb128 0x277
+	.long	.LASF1729
+	.byte	0x5
+	.uleb128 0x278
+	.long	.LASF1730
+	.byte	0x5
+	.uleb128 0x27f
+	.long	.LASF1731
+	.byte	0x5
+	.uleb128 0x280
+	.long	.LASF1732
+	.byte	0x5
+	.uleb128 0x281
+	.long	.LASF1733
+	.byte	0x5
+	.uleb128 0x288
+	.long	.LASF1734
+	.byte	0x5
+	.uleb128 0x289
+	.long	.LASF1735
+	.byte	0x5
+	.uleb128 0x28a
+	.long	.LASF1736
+	.byte	0x5
+	.uleb128 0x291
+	.long	.LASF1737
+	.byte	0x5
+	.uleb128 0x292
+	.long	.LASF1738
+	.byte	0x5
+	.uleb128 0x293
+	.long	.LASF1739
+	.byte	0x5
+	.uleb128 0x29a
+	.long	.LASF1740
+	.byte	0x5
+	.uleb128 0x29b
+	.long	.LASF1741
+	.byte	0x5
+	.uleb128 0x29c
+	.long	.LASF1742
+	.byte	0x5
+	.uleb128 0x2a3
+	.long	.LASF1743
+	.byte	0x5
+	.uleb128 0x2a4
+	.long	.LASF1744
+	.byte	0x5
+	.uleb128 0x2a5
+	.long	.LASF1745
+	.byte	0x5
+	.uleb128 0x2ac
+	.long	.LASF1746
+	.byte	0x5
+	.uleb128 0x2ad
+	.long	.LASF1747
+	.byte	0x5
+	.uleb128 0x2ae
+	.long	.LASF1748
+	.byte	0x5
+	.uleb128 0x2b5
+	.long	.LASF1749
+	.byte	0x5
+	.uleb128 0x2b6
+	.long	.LASF1750
+	.byte	0x5
+	.uleb128 0x2b7
+	.long	.LASF1751
+	.byte	0x5
+	.uleb128 0x2be
+	.long	.LASF1752
+	.byte	0x5
+	.uleb128 0x2bf
+	.long	.LASF1753
+	.byte	0x5
+	.uleb128 0x2c0
+	.long	.LASF1754
+	.byte	0x5
+	.uleb128 0x2c7
+	.long	.LASF1755
+	.byte	0x5
+	.uleb128 0x2c8
+	.long	.LASF1756
+	.byte	0x5
+	.uleb128 0x2c9
+	.long	.LASF1757
+	.byte	0x5
+	.uleb128 0x2d0
+	.long	.LASF1758
+	.byte	0x5
+	.uleb128 0x2d1
+	.long	.LASF1759
+	.byte	0x5
+	.uleb128 0x2d2
+	.long	.LASF1760
+	.byte	0x5
+	.uleb128 0x2d9
+	.long	.LASF1761
+	.byte	0x5
+	.uleb128 0x2da
+	.long	.LASF1762
+	.byte	0x5
+	.uleb128 0x2db
+	.long	.LASF1763
+	.byte	0x5
+	.uleb128 0x2e2
+	.long	.LASF1764
+	.byte	0x5
+	.uleb128 0x2e3
+	.long	.LASF1765
+	.byte	0x5
+	.uleb128 0x2e4
+	.long	.LASF1766
+	.byte	0x5
+	.uleb128 0x2eb
+	.long	.LASF1767
+	.byte	0x5
+	.uleb128 0x2ec
+	.long	.LASF1768
+	.byte	0x5
+	.uleb128 0x2ed
+	.long	.LASF1769
+	.byte	0x5
+	.uleb128 0x2f4
+	.long	.LASF1770
+	.byte	0x5
+	.uleb128 0x2f5
+	.long	.LASF1771
+	.byte	0x5
+	.uleb128 0x2f6
+	.long	.LASF1772
+	.byte	0x5
+	.uleb128 0x2fd
+	.long	.LASF1773
+	.byte	0x5
+	.uleb128 0x2fe
+	.long	.LASF1774
+	.byte	0x5
+	.uleb128 0x2ff
+	.long	.LASF1775
+	.byte	0x5
+	.uleb128 0x306
+	.long	.LASF1776
+	.byte	0x5
+	.uleb128 0x307
+	.long	.LASF1777
+	.byte	0x5
+	.uleb128 0x308
+	.long	.LASF1778
+	.byte	0x5
+	.uleb128 0x30f
+	.long	.LASF1779
+	.byte	0x5
+	.uleb128 0x310
+	.long	.LASF1780
+	.byte	0x5
+	.uleb128 0x311
+	.long	.LASF1781
+	.byte	0x5
+	.uleb128 0x318
+	.long	.LASF1782
+	.byte	0x5
+	.uleb128 0x319
+	.long	.LASF1783
+	.byte	0x5
+	.uleb128 0x31a
+	.long	.LASF1784
+	.byte	0x5
+	.uleb128 0x321
+	.long	.LASF1785
+	.byte	0x5
+	.uleb128 0x322
+	.long	.LASF1786
+	.byte	0x5
+	.uleb128 0x323
+	.long	.LASF1787
+	.byte	0x5
+	.uleb128 0x32a
+	.long	.LASF1788
+	.byte	0x5
+	.uleb128 0x32b
+	.long	.LASF1789
+	.byte	0x5
+	.uleb128 0x32c
+	.long	.LASF1790
+	.byte	0x5
+	.uleb128 0x333
+	.long	.LASF1791
+	.byte	0x5
+	.uleb128 0x334
+	.long	.LASF1792
+	.byte	0x5
+	.uleb128 0x335
+	.long	.LASF1793
+	.byte	0x5
+	.uleb128 0x33c
+	.long	.LASF1794
+	.byte	0x5
+	.uleb128 0x33d
+	.long	.LASF1795
+	.byte	0x5
+	.uleb128 0x33e
+	.long	.LASF1796
+	.byte	0x5
+	.uleb128 0x345
+	.long	.LASF1797
+	.byte	0x5
+	.uleb128 0x346
+	.long	.LASF1798
+	.byte	0x5
+	.uleb128 0x347
+	.long	.LASF1799
+	.byte	0x5
+	.uleb128 0x34e
+	.long	.LASF1800
+	.byte	0x5
+	.uleb128 0x34f
+	.long	.LASF1801
+	.byte	0x5
+	.uleb128 0x350
+	.long	.LASF1802
+	.byte	0x5
+	.uleb128 0x357
+	.long	.LASF1803
+	.byte	0x5
+	.uleb128 0x358
+	.long	.LASF1804
+	.byte	0x5
+	.uleb128 0x359
+	.long	.LASF1805
+	.byte	0x5
+	.uleb128 0x360
+	.long	.LASF1806
+	.byte	0x5
+	.uleb128 0x361
+	.long	.LASF1807
+	.byte	0x5
+	.uleb128 0x362
+	.long	.LASF1808
+	.byte	0x5
+	.uleb128 0x369
+	.long	.LASF1809
+	.byte	0x5
+	.uleb128 0x36a
+	.long	.LASF1810
+	.byte	0x5
+	.uleb128 0x36b
+	.long	.LASF1811
+	.byte	0x5
+	.uleb128 0x372
+	.long	.LASF1812
+	.byte	0x5
+	.uleb128 0x373
+	.long	.LASF1813
+	.byte	0x5
+	.uleb128 0x374
+	.long	.LASF1814
+	.byte	0x5
+	.uleb128 0x37b
+	.long	.LASF1815
+	.byte	0x5
+	.uleb128 0x37c
+	.long	.LASF1816
+	.byte	0x5
+	.uleb128 0x37d
+	.long	.LASF1817
+	.byte	0x5
+	.uleb128 0x384
+	.long	.LASF1818
+	.byte	0x5
+	.uleb128 0x385
+	.long	.LASF1819
+	.byte	0x5
+	.uleb128 0x386
+	.long	.LASF1820
+	.byte	0x5
+	.uleb128 0x38d
+	.long	.LASF1821
+	.byte	0x5
+	.uleb128 0x38e
+	.long	.LASF1822
+	.byte	0x5
+	.uleb128 0x38f
+	.long	.LASF1823
+	.byte	0x5
+	.uleb128 0x396
+	.long	.LASF1824
+	.byte	0x5
+	.uleb128 0x397
+	.long	.LASF1825
+	.byte	0x5
+	.uleb128 0x398
+	.long	.LASF1826
+	.byte	0x5
+	.uleb128 0x39f
+	.long	.LASF1827
+	.byte	0x5
+	.uleb128 0x3a0
+	.long	.LASF1828
+	.byte	0x5
+	.uleb128 0x3a1
+	.long	.LASF1829
+	.byte	0x5
+	.uleb128 0x3a8
+	.long	.LASF1830
+	.byte	0x5
+	.uleb128 0x3a9
+	.long	.LASF1831
+	.byte	0x5
+	.uleb128 0x3aa
+	.long	.LASF1832
+	.byte	0x5
+	.uleb128 0x3b1
+	.long	.LASF1833
+	.byte	0x5
+	.uleb128 0x3b2
+	.long	.LASF1834
+	.byte	0x5
+	.uleb128 0x3b3
+	.long	.LASF1835
+	.byte	0x5
+	.uleb128 0x3ba
+	.long	.LASF1836
+	.byte	0x5
+	.uleb128 0x3bb
+	.long	.LASF1837
+	.byte	0x5
+	.uleb128 0x3bc
+	.long	.LASF1838
+	.byte	0x5
+	.uleb128 0x3c3
+	.long	.LASF1839
+	.byte	0x5
+	.uleb128 0x3c4
+	.long	.LASF1840
+	.byte	0x5
+	.uleb128 0x3c5
+	.long	.LASF1841
+	.byte	0x5
+	.uleb128 0x3cc
+	.long	.LASF1842
+	.byte	0x5
+	.uleb128 0x3cd
+	.long	.LASF1843
+	.byte	0x5
+	.uleb128 0x3ce
+	.long	.LASF1844
+	.byte	0x5
+	.uleb128 0x3d5
+	.long	.LASF1845
+	.byte	0x5
+	.uleb128 0x3d6
+	.long	.LASF1846
+	.byte	0x5
+	.uleb128 0x3d7
+	.long	.LASF1847
+	.byte	0x5
+	.uleb128 0x3de
+	.long	.LASF1848
+	.byte	0x5
+	.uleb128 0x3df
+	.long	.LASF1849
+	.byte	0x5
+	.uleb128 0x3e0
+	.long	.LASF1850
+	.byte	0x5
+	.uleb128 0x3e7
+	.long	.LASF1851
+	.byte	0x5
+	.uleb128 0x3e8
+	.long	.LASF1852
+	.byte	0x5
+	.uleb128 0x3e9
+	.long	.LASF1853
+	.byte	0x5
+	.uleb128 0x3f0
+	.long	.LASF1854
+	.byte	0x5
+	.uleb128 0x3f1
+	.long	.LASF1855
+	.byte	0x5
+	.uleb128 0x3f2
+	.long	.LASF1856
+	.byte	0x5
+	.uleb128 0x3f9
+	.long	.LASF1857
+	.byte	0x5
+	.uleb128 0x3fa
+	.long	.LASF1858
+	.byte	0x5
+	.uleb128 0x3fb
+	.long	.LASF1859
+	.byte	0x5
+	.uleb128 0x402
+	.long	.LASF1860
+	.byte	0x5
+	.uleb128 0x403
+	.long	.LASF1861
+	.byte	0x5
+	.uleb128 0x404
+	.long	.LASF1862
+	.byte	0x5
+	.uleb128 0x40b
+	.long	.LASF1863
+	.byte	0x5
+	.uleb128 0x40c
+	.long	.LASF1864
+	.byte	0x5
+	.uleb128 0x40d
+	.long	.LASF1865
+	.byte	0x5
+	.uleb128 0x414
+	.long	.LASF1866
+	.byte	0x5
+	.uleb128 0x415
+	.long	.LASF1867
+	.byte	0x5
+	.uleb128 0x416
+	.long	.LASF1868
+	.byte	0x5
+	.uleb128 0x41d
+	.long	.LASF1869
+	.byte	0x5
+	.uleb128 0x41e
+	.long	.LASF1870
+	.byte	0x5
+	.uleb128 0x41f
+	.long	.LASF1871
+	.byte	0x5
+	.uleb128 0x426
+	.long	.LASF1872
+	.byte	0x5
+	.uleb128 0x427
+	.long	.LASF1873
+	.byte	0x5
+	.uleb128 0x428
+	.long	.LASF1874
+	.byte	0x5
+	.uleb128 0x42f
+	.long	.LASF1875
+	.byte	0x5
+	.uleb128 0x430
+	.long	.LASF1876
+	.byte	0x5
+	.uleb128 0x431
+	.long	.LASF1877
+	.byte	0x5
+	.uleb128 0x438
+	.long	.LASF1878
+	.byte	0x5
+	.uleb128 0x439
+	.long	.LASF1879
+	.byte	0x5
+	.uleb128 0x43a
+	.long	.LASF1880
+	.byte	0x5
+	.uleb128 0x441
+	.long	.LASF1881
+	.byte	0x5
+	.uleb128 0x442
+	.long	.LASF1882
+	.byte	0x5
+	.uleb128 0x443
+	.long	.LASF1883
+	.byte	0x5
+	.uleb128 0x447
+	.long	.LASF1884
+	.byte	0x5
+	.uleb128 0x461
+	.long	.LASF1885
+	.byte	0x5
+	.uleb128 0x462
+	.long	.LASF1886
+	.byte	0x5
+	.uleb128 0x463
+	.long	.LASF1887
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.dma.h.31.f12434bd7e7ee69de054810024391bd7,comdat
+.Ldebug_macro50:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x1f
+	.long	.LASF1889
+	.byte	0x5
+	.uleb128 0x20
+	.long	.LASF1890
+	.byte	0x5
+	.uleb128 0x22
+	.long	.LASF1891
+	.byte	0x5
+	.uleb128 0x23
+	.long	.LASF1892
+	.byte	0x5
+	.uleb128 0x24
+	.long	.LASF1893
+	.byte	0x5
+	.uleb128 0x57
+	.long	.LASF1894
+	.byte	0x5
+	.uleb128 0x61
+	.long	.LASF1895
+	.byte	0x5
+	.uleb128 0x66
+	.long	.LASF1896
+	.byte	0x5
+	.uleb128 0x67
+	.long	.LASF1897
+	.byte	0x5
+	.uleb128 0x69
+	.long	.LASF1898
+	.byte	0x5
+	.uleb128 0x6a
+	.long	.LASF1899
+	.byte	0x5
+	.uleb128 0x6b
+	.long	.LASF1900
+	.byte	0
+	.section	.gnu.debuglto_.debug_macro,"eG",@progbits,wm4.bus.h.37.c9de9b4e35315018422e2d4df8c80e22,comdat
+.Ldebug_macro51:
+	.value	0x5
+	.byte	0
+	.byte	0x5
+	.uleb128 0x25
+	.long	.LASF1902
+	.byte	0x5
+	.uleb128 0x26
+	.long	.LASF1903
+	.byte	0x5
+	.uleb128 0x27
+	.long	.LASF1904
+	.byte	0x5
+	.uleb128 0x28
+	.long	.LASF1905
+	.byte	0x5
+	.uleb128 0x2a
+	.long	.LASF1906
+	.byte	0x5
+	.uleb128 0x2b
+	.long	.LASF1907
+	.byte	0x5
+	.uleb128 0x2c
+	.long	.LASF1908
+	.byte	0x5
+	.uleb128 0x2d
+	.long	.LASF1909
+	.byte	0x5
+	.uleb128 0x2e
+	.long	.LASF1910
+	.byte	0x5
+	.uleb128 0x30
+	.long	.LASF1911
+	.byte	0x5
+	.uleb128 0xd7
+	.long	.LASF1912
+	.byte	0x5
+	.uleb128 0xda
+	.long	.LASF1913
+	.byte	0x5
+	.uleb128 0xed
+	.long	.LASF1914
+	.byte	0x5
+	.uleb128 0x100
+	.long	.LASF1915
+	.byte	0x5
+	.uleb128 0x103
+	.long	.LASF1916
+	.byte	0x5
+	.uleb128 0x106
+	.long	.LASF1917
+	.byte	0x5
+	.uleb128 0x109
+	.long	.LASF1918
+	.byte	0
+	.section	.gnu.debuglto_.debug_line,"e",@progbits
+.Ldebug_line0:
+	.long	.LELT0-.LSLT0
+.LSLT0:
+	.value	0x5
+	.byte	0x8
+	.byte	0
+	.long	.LELTP0-.LASLTP0
+.LASLTP0:
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0xf6
+	.byte	0xf2
+	.byte	0xd
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0
+	.byte	0
+	.byte	0x1
+	.byte	0x1
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x11
+	.long	.LASF1
+	.long	.LASF2161
+	.long	.LASF2162
+	.long	.LASF2163
+	.long	.LASF2164
+	.long	.LASF2165
+	.long	.LASF2166
+	.long	.LASF2167
+	.long	.LASF2168
+	.long	.LASF2169
+	.long	.LASF2170
+	.long	.LASF2171
+	.long	.LASF2172
+	.long	.LASF2173
+	.long	.LASF2174
+	.long	.LASF2175
+	.long	.LASF2176
+	.byte	0x2
+	.uleb128 0x1
+	.uleb128 0x1f
+	.uleb128 0x2
+	.uleb128 0xb
+	.uleb128 0x42
+	.long	.LASF0
+	.byte	0
+	.long	.LASF2177
+	.byte	0xc
+	.long	.LASF2178
+	.byte	0xc
+	.long	.LASF2179
+	.byte	0xc
+	.long	.LASF2180
+	.byte	0x2
+	.long	.LASF2181
+	.byte	0x5
+	.long	.LASF2182
+	.byte	0x5
+	.long	.LASF2182
+	.byte	0x6
+	.long	.LASF2183
+	.byte	0x4
+	.long	.LASF2184
+	.byte	0x4
+	.long	.LASF2183
+	.byte	0x6
+	.long	.LASF2185
+	.byte	0x6
+	.long	.LASF2186
+	.byte	0x2
+	.long	.LASF2180
+	.byte	0x5
+	.long	.LASF2187
+	.byte	0xf
+	.long	.LASF2188
+	.byte	0x10
+	.long	.LASF2189
+	.byte	0x10
+	.long	.LASF2189
+	.byte	0xf
+	.long	.LASF2190
+	.byte	0xc
+	.long	.LASF2191
+	.byte	0xf
+	.long	.LASF2192
+	.byte	0xf
+	.long	.LASF2193
+	.byte	0xc
+	.long	.LASF2194
+	.byte	0xc
+	.long	.LASF2195
+	.byte	0xe
+	.long	.LASF2196
+	.byte	0xc
+	.long	.LASF2197
+	.byte	0xd
+	.long	.LASF2198
+	.byte	0xd
+	.long	.LASF2199
+	.byte	0xc
+	.long	.LASF2200
+	.byte	0xc
+	.long	.LASF2201
+	.byte	0xc
+	.long	.LASF2202
+	.byte	0xf
+	.long	.LASF2203
+	.byte	0xc
+	.long	.LASF2204
+	.byte	0xc
+	.long	.LASF2205
+	.byte	0xb
+	.long	.LASF2206
+	.byte	0xb
+	.long	.LASF2207
+	.byte	0xf
+	.long	.LASF2208
+	.byte	0xc
+	.long	.LASF2209
+	.byte	0xc
+	.long	.LASF2210
+	.byte	0xc
+	.long	.LASF2211
+	.byte	0xc
+	.long	.LASF2212
+	.byte	0xc
+	.long	.LASF2213
+	.byte	0xc
+	.long	.LASF2214
+	.byte	0xc
+	.long	.LASF2215
+	.byte	0xc
+	.long	.LASF2216
+	.byte	0xc
+	.long	.LASF2217
+	.byte	0xa
+	.long	.LASF2218
+	.byte	0x9
+	.long	.LASF2219
+	.byte	0x8
+	.long	.LASF2220
+	.byte	0x10
+	.long	.LASF2221
+	.byte	0x9
+	.long	.LASF2222
+	.byte	0x9
+	.long	.LASF2223
+	.byte	0x1
+	.long	.LASF2224
+	.byte	0x1
+	.long	.LASF2225
+	.byte	0x3
+	.long	.LASF2226
+	.byte	0x5
+	.long	.LASF2227
+	.byte	0x5
+	.long	.LASF2228
+	.byte	0x5
+	.long	.LASF2229
+	.byte	0x2
+	.long	.LASF2230
+	.byte	0x5
+	.long	.LASF2231
+	.byte	0x5
+	.long	.LASF2232
+	.byte	0x5
+	.long	.LASF2233
+	.byte	0x5
+	.long	.LASF2234
+	.byte	0x5
+	.long	.LASF2235
+	.byte	0x5
+	.long	.LASF2236
+	.byte	0x5
+	.long	.LASF2183
+	.byte	0x7
+.LELTP0:
+.LELT0:
+	.section	.gnu.debuglto_.debug_str,"eMS",@progbits,1
+.LASF916:
+	.string	"__DECL_SIMD_sinhf64x "
+.LASF1879:
+	.string	"DEFIO_TAG_E__PG14 DEFIO_TAG_E__NONE"
+.LASF1221:
+	.string	"NAV_AUTO_MAG_DECLINATION_PRECISE "
+.LASF2121:
+	.string	"peripheral_baudrateIndex"
+.LASF1343:
+	.string	"USE_PWM_SERVO_DRIVER"
+.LASF799:
+	.string	"__DECL_SIMD_logf "
+.LASF1194:
+	.string	"USE_UAV_INTERCONNECT "
+.LASF299:
+	.string	"__FLT64X_HAS_QUIET_NAN__ 1"
+.LASF1798:
+	.string	"DEFIO_TAG_E__PF3 DEFIO_TAG_E__NONE"
+.LASF1082:
+	.string	"__MATHCALLX(function,suffix,args,attrib) __MATHDECLX (_Mdouble_,function,suffix, args, attrib)"
+.LASF39:
+	.string	"__FLOAT_WORD_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF1709:
+	.string	"DEFIO_REC__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1032:
+	.string	"__DECL_SIMD_tanf32 "
+.LASF2046:
+	.string	"serialWrite"
+.LASF1317:
+	.string	"USE_FAKE_BARO "
+.LASF1609:
+	.string	"DEFIO_TAG_E__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1321:
+	.string	"USE_BARO "
+.LASF1224:
+	.string	"NAV_FIXED_WING_LANDING "
+.LASF1015:
+	.string	"__DECL_SIMD_asinhf32x "
+.LASF917:
+	.string	"__DECL_SIMD_sinhf128x "
+.LASF222:
+	.string	"__FLT32_DIG__ 6"
+.LASF1301:
+	.string	"_WCHAR_T_DEFINED "
+.LASF1244:
+	.string	"USE_SERIALRX_JETIEXBUS "
+.LASF467:
+	.string	"__glibc_has_attribute(attr) __has_attribute (attr)"
+.LASF1206:
+	.string	"USE_PITOT_MS4525 "
+.LASF1580:
+	.string	"DEFIO_REC__PA10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(10) - 1)) + 0)"
+.LASF1635:
+	.string	"DEFIO_TAG__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1435:
+	.string	"M_PIf 3.14159265358979323846f"
+.LASF2033:
+	.string	"rxBufferSize"
+.LASF494:
+	.string	"__ASMNAME(cname) __ASMNAME2 (__USER_LABEL_PREFIX__, cname)"
+.LASF1971:
+	.string	"OWNER_RX"
+.LASF1328:
+	.string	"USE_UART7 "
+.LASF237:
+	.string	"__FLT64_MANT_DIG__ 53"
+.LASF399:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION "
+.LASF836:
+	.string	"__DECL_SIMD_acosf64x "
+.LASF161:
+	.string	"__FLT_MAX_10_EXP__ 38"
+.LASF582:
+	.string	"__U64_TYPE unsigned long int"
+.LASF575:
+	.string	"__SQUAD_TYPE long int"
+.LASF1653:
+	.string	"DEFIO_TAG__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF2052:
+	.string	"setMode"
+.LASF455:
+	.string	"__USE_MISC 1"
+.LASF699:
+	.string	"__LITTLE_ENDIAN 1234"
+.LASF1245:
+	.string	"USE_SERIALRX_CRSF "
+.LASF744:
+	.string	"__isprint_l(c,l) __isctype_l((c), _ISprint, (l))"
+.LASF725:
+	.string	"toupper(c) __tobody (c, toupper, *__ctype_toupper_loc (), (c))"
+.LASF1137:
+	.string	"FP_NORMAL 4"
+.LASF972:
+	.string	"__DECL_SIMD_atanhf32 "
+.LASF952:
+	.string	"__DECL_SIMD_log2f32 "
+.LASF809:
+	.string	"__DECL_SIMD_expf "
+.LASF234:
+	.string	"__FLT32_HAS_INFINITY__ 1"
+.LASF1176:
+	.string	"COMMON_DEFAULT_FEATURES (FEATURE_TX_PROF_SEL)"
+.LASF698:
+	.string	"_BITS_ENDIAN_H 1"
+.LASF1398:
+	.string	"PG_PACKED __attribute__((packed))"
+.LASF912:
+	.string	"__DECL_SIMD_sinhf32 "
+.LASF1521:
+	.string	"DEFIO_PORT_A_USED_COUNT BITCOUNT(DEFIO_PORT_A_USED_MASK)"
+.LASF518:
+	.string	"__fortify_function __extern_always_inline __attribute_artificial__"
+.LASF309:
+	.string	"__DEC64_MIN_EXP__ (-382)"
+.LASF240:
+	.string	"__FLT64_MIN_10_EXP__ (-307)"
+.LASF1013:
+	.string	"__DECL_SIMD_asinhf64 "
+.LASF1225:
+	.string	"USE_AUTOTUNE_FIXED_WING "
+.LASF356:
+	.string	"__ATOMIC_HLE_RELEASE 131072"
+.LASF1643:
+	.string	"DEFIO_REC__PB15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF88:
+	.string	"__PTRDIFF_MAX__ 0x7fffffffffffffffL"
+.LASF1926:
+	.string	"__uint8_t"
+.LASF629:
+	.string	"_BITS_WCHAR_H 1"
+.LASF1335:
+	.string	"TARGET_IO_PORTB 0xffff"
+.LASF45:
+	.string	"__WCHAR_TYPE__ int"
+.LASF2028:
+	.string	"vTable"
+.LASF1434:
+	.string	"FAST_MATH "
+.LASF2:
+	.string	"__STDC__ 1"
+.LASF1783:
+	.string	"DEFIO_TAG_E__PE14 DEFIO_TAG_E__NONE"
+.LASF2060:
+	.string	"_Bool"
+.LASF934:
+	.string	"__DECL_SIMD_atan2f128 "
+.LASF767:
+	.string	"_BITS_LIBM_SIMD_DECL_STUBS_H 1"
+.LASF529:
+	.string	"__LDBL_REDIR(name,proto) name proto"
+.LASF1728:
+	.string	"DEFIO_TAG__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1365:
+	.string	"U_ID_2 2"
+.LASF719:
+	.string	"ispunct(c) __isctype((c), _ISpunct)"
+.LASF144:
+	.string	"__UINT_FAST16_MAX__ 0xffffffffffffffffUL"
+.LASF316:
+	.string	"__DEC128_MIN_EXP__ (-6142)"
+.LASF2153:
+	.string	"currentTimeUs"
+.LASF1077:
+	.string	"__SIMD_DECL(function) __CONCAT (__DECL_SIMD_, function)"
+.LASF976:
+	.string	"__DECL_SIMD_atanhf64x "
+.LASF471:
+	.string	"__LEAF_ATTR __attribute__ ((__leaf__))"
+.LASF904:
+	.string	"__DECL_SIMD_expm1f128 "
+.LASF956:
+	.string	"__DECL_SIMD_log2f64x "
+.LASF177:
+	.string	"__DBL_MAX_10_EXP__ 308"
+.LASF511:
+	.string	"__attribute_warn_unused_result__ __attribute__ ((__warn_unused_result__))"
+.LASF1870:
+	.string	"DEFIO_TAG_E__PG11 DEFIO_TAG_E__NONE"
+.LASF1634:
+	.string	"DEFIO_REC__PB12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1470:
+	.string	"IOTAG_NONE ((ioTag_t)0)"
+.LASF1843:
+	.string	"DEFIO_TAG_E__PG2 DEFIO_TAG_E__NONE"
+.LASF1816:
+	.string	"DEFIO_TAG_E__PF9 DEFIO_TAG_E__NONE"
+.LASF1670:
+	.string	"DEFIO_REC__PC8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF752:
+	.string	"isalnum_l(c,l) __isalnum_l ((c), (l))"
+.LASF458:
+	.string	"__GLIBC_USE_DEPRECATED_GETS 1"
+.LASF2040:
+	.string	"txBufferTail"
+.LASF2010:
+	.string	"SERIAL_NOT_INVERTED"
+.LASF189:
+	.string	"__LDBL_DIG__ 18"
+.LASF1294:
+	.string	"_WCHAR_T "
+.LASF1522:
+	.string	"DEFIO_PORT_A_OFFSET (0)"
+.LASF422:
+	.string	"__USE_DYNAMIC_STACK_SIZE"
+.LASF1806:
+	.string	"DEFIO_TAG__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1706:
+	.string	"DEFIO_REC__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1752:
+	.string	"DEFIO_TAG__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF1382:
+	.string	"FILE_COMPILE_NORMAL _Pragma(\"GCC optimize(\\\"O2\\\")\")"
+.LASF1771:
+	.string	"DEFIO_TAG_E__PE10 DEFIO_TAG_E__NONE"
+.LASF2064:
+	.string	"FUNCTION_TELEMETRY_FRSKY"
+.LASF905:
+	.string	"__DECL_SIMD_expm1f32x "
+.LASF813:
+	.string	"__DECL_SIMD_expf64 "
+.LASF1293:
+	.string	"__WCHAR_T__ "
+.LASF1604:
+	.string	"DEFIO_REC__PB2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1448:
+	.string	"DEGREES_TO_RADIANS(angle) ((angle) * RAD)"
+.LASF1875:
+	.string	"DEFIO_TAG__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF2147:
+	.string	"cxofPacket_t"
+.LASF1171:
+	.string	"USE_SERIAL_RX "
+.LASF979:
+	.string	"__DECL_SIMD_acoshf "
+.LASF784:
+	.string	"__DECL_SIMD_sinf128 "
+.LASF1228:
+	.string	"USE_CMS "
+.LASF957:
+	.string	"__DECL_SIMD_log2f128x "
+.LASF1714:
+	.string	"DEFIO_TAG_E__PD7 DEFIO_TAG_E__NONE"
+.LASF1698:
+	.string	"DEFIO_TAG__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF91:
+	.string	"__SHRT_WIDTH__ 16"
+.LASF1425:
+	.string	"US2S(us) ((us) * 1e-6f)"
+.LASF1847:
+	.string	"DEFIO_REC__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF910:
+	.string	"__DECL_SIMD_sinhl "
+.LASF1715:
+	.string	"DEFIO_REC__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF1793:
+	.string	"DEFIO_REC__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF1970:
+	.string	"OWNER_LED"
+.LASF772:
+	.string	"__DECL_SIMD_cosf32 "
+.LASF492:
+	.string	"__REDIRECT_NTH(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROW"
+.LASF2082:
+	.string	"FUNCTION_FRSKY_OSD"
+.LASF169:
+	.string	"__FLT_HAS_INFINITY__ 1"
+.LASF797:
+	.string	"__DECL_SIMD_sincosf128x "
+.LASF256:
+	.string	"__FLT128_MIN_10_EXP__ (-4931)"
+.LASF1254:
+	.string	"USE_LOGIC_CONDITIONS "
+.LASF1939:
+	.string	"uint16_t"
+.LASF1995:
+	.string	"RESOURCE_SPI_SCK"
+.LASF85:
+	.string	"__WCHAR_MIN__ (-__WCHAR_MAX__ - 1)"
+.LASF373:
+	.string	"linux 1"
+.LASF1444:
+	.string	"DECIDEGREES_TO_DEGREES(angle) ((angle) / 10)"
+.LASF1952:
+	.string	"OWNER_SOFTSERIAL"
+.LASF625:
+	.string	"__FD_SETSIZE 1024"
+.LASF583:
+	.string	"__STD_TYPE typedef"
+.LASF201:
+	.string	"__LDBL_HAS_DENORM__ 1"
+.LASF269:
+	.string	"__FLT32X_MANT_DIG__ 53"
+.LASF473:
+	.string	"__THROWNL __attribute__ ((__nothrow__))"
+.LASF215:
+	.string	"__FLT16_EPSILON__ 9.76562500000000000000000000000000000e-4F16"
+.LASF1822:
+	.string	"DEFIO_TAG_E__PF11 DEFIO_TAG_E__NONE"
+.LASF791:
+	.string	"__DECL_SIMD_sincosf16 "
+.LASF1256:
+	.string	"USE_CLI_BATCH "
+.LASF1909:
+	.string	"BUS_I2C4 I2CDEV_4"
+.LASF747:
+	.string	"__isupper_l(c,l) __isctype_l((c), _ISupper, (l))"
+.LASF1410:
+	.string	"PG_REGISTER_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name })"
+.LASF80:
+	.string	"__SHRT_MAX__ 0x7fff"
+.LASF1140:
+	.string	"isfinite(x) __builtin_isfinite (x)"
+.LASF766:
+	.string	"_MATH_H 1"
+.LASF707:
+	.string	"__isctype(c,type) ((*__ctype_b_loc ())[(int) (c)] & (unsigned short int) type)"
+.LASF1371:
+	.string	"USART6 ((USART_TypeDef *)0x0006)"
+.LASF685:
+	.string	"WINT_MAX (4294967295u)"
+.LASF1582:
+	.string	"DEFIO_TAG_E__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1263:
+	.string	"_T_PTRDIFF_ "
+.LASF1166:
+	.string	"DYNAMIC_HEAP_SIZE 2048"
+.LASF1820:
+	.string	"DEFIO_REC__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF663:
+	.string	"INT_FAST8_MAX (127)"
+.LASF1587:
+	.string	"DEFIO_TAG__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF572:
+	.string	"__U32_TYPE unsigned int"
+.LASF780:
+	.string	"__DECL_SIMD_sinl "
+.LASF1549:
+	.string	"DEFIO_TAG_E__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF1757:
+	.string	"DEFIO_REC__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1332:
+	.string	"DEFAULT_FEATURES (FEATURE_GPS | FEATURE_TELEMETRY)"
+.LASF1661:
+	.string	"DEFIO_REC__PC5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1155:
+	.string	"M_1_PI 0.31830988618379067154"
+.LASF587:
+	.string	"__DEV_T_TYPE __UQUAD_TYPE"
+.LASF120:
+	.string	"__INT_LEAST16_WIDTH__ 16"
+.LASF1640:
+	.string	"DEFIO_REC__PB14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF180:
+	.string	"__DBL_NORM_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF1897:
+	.string	"DMA_GET_FLAG_STATUS(d,flag) (d->dma->ISR & (flag << d->flagsShift))"
+.LASF1463:
+	.string	"MAX(a,b) _CHOOSE(>, a, b)"
+.LASF185:
+	.string	"__DBL_HAS_INFINITY__ 1"
+.LASF146:
+	.string	"__UINT_FAST64_MAX__ 0xffffffffffffffffUL"
+.LASF217:
+	.string	"__FLT16_HAS_DENORM__ 1"
+.LASF1648:
+	.string	"DEFIO_TAG_E__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1333:
+	.string	"MAX_PWM_OUTPUT_PORTS 16"
+.LASF315:
+	.string	"__DEC128_MANT_DIG__ 34"
+.LASF1028:
+	.string	"__DECL_SIMD_tan "
+.LASF1499:
+	.string	"LOG2_8BIT(v) (8 - 90/(((v)/4+14)|1) - 2/((v)/2+1))"
+.LASF76:
+	.string	"__INTPTR_TYPE__ long int"
+.LASF2152:
+	.string	"previousTimeUs"
+.LASF1292:
+	.string	"__wchar_t__ "
+.LASF232:
+	.string	"__FLT32_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F32"
+.LASF801:
+	.string	"__DECL_SIMD_logf16 "
+.LASF1534:
+	.string	"DEFIO_PORT_E_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT)"
+.LASF1642:
+	.string	"DEFIO_TAG_E__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF411:
+	.string	"__USE_XOPEN_EXTENDED"
+.LASF2150:
+	.string	"serialRxBytesWaiting"
+.LASF1725:
+	.string	"DEFIO_TAG__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF640:
+	.string	"INT16_MAX (32767)"
+.LASF530:
+	.string	"__LDBL_REDIR1_NTH(name,proto,alias) name proto __THROW"
+.LASF592:
+	.string	"__MODE_T_TYPE __U32_TYPE"
+.LASF745:
+	.string	"__ispunct_l(c,l) __isctype_l((c), _ISpunct, (l))"
+.LASF1062:
+	.string	"__f64x(x) x ##f64x"
+.LASF63:
+	.string	"__INT_LEAST64_TYPE__ long int"
+.LASF109:
+	.string	"__INT32_MAX__ 0x7fffffff"
+.LASF262:
+	.string	"__FLT128_MIN__ 3.36210314311209350626267781732175260e-4932F128"
+.LASF1915:
+	.string	"BUSDEV_REGISTER_SPI(_name,_devHw,_spiBus,_csnPin,_irqPin,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, 0, _flags, _param)"
+.LASF857:
+	.string	"__DECL_SIMD_asinf128x "
+.LASF1846:
+	.string	"DEFIO_TAG_E__PG3 DEFIO_TAG_E__NONE"
+.LASF330:
+	.string	"__GCC_ATOMIC_CHAR_LOCK_FREE 2"
+.LASF1984:
+	.string	"RESOURCE_NONE"
+.LASF253:
+	.string	"__FLT128_MANT_DIG__ 113"
+.LASF2129:
+	.string	"virtualOpflowVTable_s"
+.LASF2133:
+	.string	"virtualOpflowVTable_t"
+.LASF1739:
+	.string	"DEFIO_REC__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF74:
+	.string	"__UINT_FAST32_TYPE__ long unsigned int"
+.LASF800:
+	.string	"__DECL_SIMD_logl "
+.LASF1874:
+	.string	"DEFIO_REC__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF621:
+	.string	"__INO_T_MATCHES_INO64_T 1"
+.LASF25:
+	.string	"__SIZEOF_INT__ 4"
+.LASF1862:
+	.string	"DEFIO_REC__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF2066:
+	.string	"FUNCTION_TELEMETRY_LTM"
+.LASF274:
+	.string	"__FLT32X_MAX_10_EXP__ 308"
+.LASF1216:
+	.string	"USE_PWM_DRIVER_PCA9685 "
+.LASF1037:
+	.string	"__DECL_SIMD_tanf128x "
+.LASF1542:
+	.string	"DEFIO_GPIOID__B 1"
+.LASF95:
+	.string	"__WCHAR_WIDTH__ 32"
+.LASF51:
+	.string	"__SIG_ATOMIC_TYPE__ int"
+.LASF932:
+	.string	"__DECL_SIMD_atan2f32 "
+.LASF34:
+	.string	"__BIGGEST_ALIGNMENT__ 16"
+.LASF213:
+	.string	"__FLT16_NORM_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF1495:
+	.string	"BIT(x) (1 << (x))"
+.LASF1964:
+	.string	"OWNER_BEEPER"
+.LASF138:
+	.string	"__INT_FAST16_WIDTH__ 64"
+.LASF2037:
+	.string	"rxBufferHead"
+.LASF808:
+	.string	"__DECL_SIMD_exp "
+.LASF1550:
+	.string	"DEFIO_REC__PA0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(0) - 1)) + 0)"
+.LASF1673:
+	.string	"DEFIO_REC__PC9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1018:
+	.string	"__DECL_SIMD_erfc "
+.LASF1567:
+	.string	"DEFIO_TAG_E__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF336:
+	.string	"__GCC_ATOMIC_LONG_LOCK_FREE 2"
+.LASF900:
+	.string	"__DECL_SIMD_expm1l "
+.LASF344:
+	.string	"__PRAGMA_REDEFINE_EXTNAME 1"
+.LASF1092:
+	.string	"_Mdouble_"
+.LASF1937:
+	.string	"int32_t"
+.LASF1418:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_FN(_type,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF1040:
+	.string	"__HAVE_DISTINCT_FLOAT128 1"
+.LASF2118:
+	.string	"functionMask"
+.LASF17:
+	.string	"__pic__ 2"
+.LASF1993:
+	.string	"RESOURCE_I2C_SCL"
+.LASF1825:
+	.string	"DEFIO_TAG_E__PF12 DEFIO_TAG_E__NONE"
+.LASF1316:
+	.string	"USE_IMU_FAKE "
+.LASF1138:
+	.string	"fpclassify(x) __builtin_fpclassify (FP_NAN, FP_INFINITE, FP_NORMAL, FP_SUBNORMAL, FP_ZERO, x)"
+.LASF20:
+	.string	"__PIE__ 2"
+.LASF2056:
+	.string	"beginWrite"
+.LASF992:
+	.string	"__DECL_SIMD_erff32 "
+.LASF731:
+	.string	"_BITS_TYPES___LOCALE_T_H 1"
+.LASF1303:
+	.string	"___int_wchar_t_h "
+.LASF1975:
+	.string	"OWNER_SPI_PREINIT"
+.LASF810:
+	.string	"__DECL_SIMD_expl "
+.LASF1796:
+	.string	"DEFIO_REC__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF402:
+	.string	"__USE_ISOC11"
+.LASF1489:
+	.string	"STR_HELPER(x) #x"
+.LASF1985:
+	.string	"RESOURCE_INPUT"
+.LASF1617:
+	.string	"DEFIO_TAG__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF77:
+	.string	"__UINTPTR_TYPE__ long unsigned int"
+.LASF1337:
+	.string	"USE_DYNAMIC_FILTERS"
+.LASF182:
+	.string	"__DBL_EPSILON__ ((double)2.22044604925031308084726333618164062e-16L)"
+.LASF1210:
+	.string	"USE_TEMPERATURE_LM75 "
+.LASF89:
+	.string	"__SIZE_MAX__ 0xffffffffffffffffUL"
+.LASF276:
+	.string	"__FLT32X_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF1356:
+	.string	"USE_RX_PPM"
+.LASF300:
+	.string	"__FLT64X_IS_IEC_60559__ 2"
+.LASF513:
+	.string	"__always_inline"
+.LASF1994:
+	.string	"RESOURCE_I2C_SDA"
+.LASF56:
+	.string	"__UINT8_TYPE__ unsigned char"
+.LASF1046:
+	.string	"__HAVE_FLOAT16 0"
+.LASF754:
+	.string	"iscntrl_l(c,l) __iscntrl_l ((c), (l))"
+.LASF2005:
+	.string	"MODE_RX"
+.LASF907:
+	.string	"__DECL_SIMD_expm1f128x "
+.LASF224:
+	.string	"__FLT32_MIN_10_EXP__ (-37)"
+.LASF906:
+	.string	"__DECL_SIMD_expm1f64x "
+.LASF510:
+	.string	"__returns_nonnull __attribute__ ((__returns_nonnull__))"
+.LASF637:
+	.string	"INT32_MIN (-2147483647-1)"
+.LASF1493:
+	.string	"PP_CALL(macro,...) macro(__VA_ARGS__)"
+.LASF255:
+	.string	"__FLT128_MIN_EXP__ (-16381)"
+.LASF1633:
+	.string	"DEFIO_TAG_E__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF2078:
+	.string	"FUNCTION_RANGEFINDER"
+.LASF5:
+	.string	"__STDC_UTF_32__ 1"
+.LASF118:
+	.string	"__INT_LEAST16_MAX__ 0x7fff"
+.LASF1093:
+	.string	"__MATH_PRECNAME"
+.LASF943:
+	.string	"__DECL_SIMD_log10f64 "
+.LASF630:
+	.string	"__WCHAR_MAX __WCHAR_MAX__"
+.LASF195:
+	.string	"__LDBL_DECIMAL_DIG__ 21"
+.LASF1376:
+	.string	"FAST_CODE "
+.LASF1217:
+	.string	"USE_TELEMETRY_SIM "
+.LASF1620:
+	.string	"DEFIO_TAG__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF875:
+	.string	"__DECL_SIMD_exp2f32x "
+.LASF1350:
+	.string	"USE_1WIRE_DS2482"
+.LASF135:
+	.string	"__INT_FAST8_MAX__ 0x7f"
+.LASF1096:
+	.string	"_Mdouble_ float"
+.LASF2101:
+	.string	"BAUD_2000000"
+.LASF57:
+	.string	"__UINT16_TYPE__ short unsigned int"
+.LASF659:
+	.string	"INT_FAST8_MIN (-128)"
+.LASF1692:
+	.string	"DEFIO_TAG__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF1881:
+	.string	"DEFIO_TAG__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF807:
+	.string	"__DECL_SIMD_logf128x "
+.LASF1080:
+	.string	"__MATHCALL(function,suffix,args) __MATHDECL (_Mdouble_,function,suffix, args)"
+.LASF1212:
+	.string	"USE_MSP_DISPLAYPORT "
+.LASF496:
+	.string	"__attribute_malloc__ __attribute__ ((__malloc__))"
+.LASF1613:
+	.string	"DEFIO_REC__PB5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(5) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF746:
+	.string	"__isspace_l(c,l) __isctype_l((c), _ISspace, (l))"
+.LASF1277:
+	.string	"_T_SIZE_ "
+.LASF1319:
+	.string	"USE_FAKE_GPS "
+.LASF1086:
+	.string	"__MATHDECL_ALIAS(type,function,suffix,args,alias) __MATHDECL_1(type, function, suffix, args)"
+.LASF1462:
+	.string	"MIN(a,b) _CHOOSE(<, a, b)"
+.LASF282:
+	.string	"__FLT32X_HAS_INFINITY__ 1"
+.LASF980:
+	.string	"__DECL_SIMD_acoshl "
+.LASF1129:
+	.string	"__MATHCALL_NARROW"
+.LASF1618:
+	.string	"DEFIO_TAG_E__PB7 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 7)"
+.LASF486:
+	.string	"__glibc_objsize(__o) __bos (__o)"
+.LASF1590:
+	.string	"DEFIO_TAG__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF526:
+	.string	"__attribute_copy__(arg) __attribute__ ((__copy__ (arg)))"
+.LASF1213:
+	.string	"USE_DASHBOARD "
+.LASF220:
+	.string	"__FLT16_IS_IEC_60559__ 2"
+.LASF1776:
+	.string	"DEFIO_TAG__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF114:
+	.string	"__UINT64_MAX__ 0xffffffffffffffffUL"
+.LASF116:
+	.string	"__INT8_C(c) c"
+.LASF547:
+	.string	"__stub_chflags "
+.LASF1114:
+	.string	"__MATHDECL_1"
+.LASF1849:
+	.string	"DEFIO_TAG_E__PG4 DEFIO_TAG_E__NONE"
+.LASF1963:
+	.string	"OWNER_USB"
+.LASF209:
+	.string	"__FLT16_MAX_EXP__ 16"
+.LASF706:
+	.string	"_ISbit(bit) ((bit) < 8 ? ((1 << (bit)) << 8) : ((1 << (bit)) >> 8))"
+.LASF1886:
+	.string	"DEFIO_PORT_USED_LIST DEFIO_PORT_A_USED_MASK,DEFIO_PORT_B_USED_MASK,DEFIO_PORT_C_USED_MASK"
+.LASF1106:
+	.string	"__MATH_PRECNAME(name,r) name ##f64 ##r"
+.LASF989:
+	.string	"__DECL_SIMD_erff "
+.LASF160:
+	.string	"__FLT_MAX_EXP__ 128"
+.LASF686:
+	.string	"INT8_C(c) c"
+.LASF1412:
+	.ascii	"PG_REGISTER_ARRAY_I(_type,_size,_name,_pgn,_version,_reset) "
+	.ascii	"_type _name ## _SystemArray[_size]; _type _name ## _CopyArra"
+	.ascii	"y[_size]; extern const pgRegistry_t _name ##_Registry; c"
+	.string	"onst pgRegistry_t _name ## _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = (sizeof(_type) * _size) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _SystemArray, .copy = (uint8_t*)&_name ## _CopyArray, .ptr = 0, _reset, }"
+.LASF12:
+	.string	"__ATOMIC_SEQ_CST 5"
+.LASF1789:
+	.string	"DEFIO_TAG_E__PF0 DEFIO_TAG_E__NONE"
+.LASF1288:
+	.string	"_GCC_SIZE_T "
+.LASF551:
+	.string	"__stub_setlogin "
+.LASF1839:
+	.string	"DEFIO_TAG__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF2006:
+	.string	"MODE_TX"
+.LASF1050:
+	.string	"__HAVE_FLOAT128X 0"
+.LASF1450:
+	.string	"DECIDEGREES_TO_RADIANS(angle) (((angle) / 10.0f) * RAD)"
+.LASF1541:
+	.string	"DEFIO_GPIOID__A 0"
+.LASF1475:
+	.string	"IOCFG_AF_PP 0"
+.LASF8:
+	.string	"__GNUC_MINOR__ 2"
+.LASF293:
+	.string	"__FLT64X_NORM_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF221:
+	.string	"__FLT32_MANT_DIG__ 24"
+.LASF553:
+	.string	"__stub_stty "
+.LASF1490:
+	.string	"STR(x) STR_HELPER(x)"
+.LASF1414:
+	.string	"PG_REGISTER_ARRAY_WITH_RESET_FN(_type,_size,_name,_pgn,_version) extern void pgResetFn_ ## _name(_type *); PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.fn = (pgResetFunc*)&pgResetFn_ ## _name})"
+.LASF961:
+	.string	"__DECL_SIMD_log1pf16 "
+.LASF2079:
+	.string	"FUNCTION_VTX_FFPV"
+.LASF856:
+	.string	"__DECL_SIMD_asinf64x "
+.LASF868:
+	.string	"__DECL_SIMD_exp2 "
+.LASF100:
+	.string	"__INTMAX_C(c) c ## L"
+.LASF38:
+	.string	"__BYTE_ORDER__ __ORDER_LITTLE_ENDIAN__"
+.LASF688:
+	.string	"INT32_C(c) c"
+.LASF117:
+	.string	"__INT_LEAST8_WIDTH__ 8"
+.LASF1238:
+	.string	"USE_TELEMETRY_CRSF "
+.LASF886:
+	.string	"__DECL_SIMD_exp10f64x "
+.LASF1720:
+	.string	"DEFIO_TAG_E__PD9 DEFIO_TAG_E__NONE"
+.LASF1758:
+	.string	"DEFIO_TAG__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF1704:
+	.string	"DEFIO_TAG__PD4 defio_error_PD4_is_not_supported_on_TARGET"
+.LASF1177:
+	.string	"USE_ADC_AVERAGING "
+.LASF1141:
+	.string	"isnormal(x) __builtin_isnormal (x)"
+.LASF151:
+	.string	"__GCC_IEC_559_COMPLEX 2"
+.LASF1366:
+	.string	"USART1 ((USART_TypeDef *)0x0001)"
+.LASF381:
+	.string	"FLASH_SIZE 2048"
+.LASF1565:
+	.string	"DEFIO_REC__PA5 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(5) - 1)) + 0)"
+.LASF997:
+	.string	"__DECL_SIMD_erff128x "
+.LASF1882:
+	.string	"DEFIO_TAG_E__PG15 DEFIO_TAG_E__NONE"
+.LASF1042:
+	.string	"__HAVE_FLOAT64X_LONG_DOUBLE 1"
+.LASF1432:
+	.string	"TIME_SECTION_END(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[1][index] = micros(); debug[index] = sectionTimes[1][index] - sectionTimes[0][index]; }"
+.LASF2087:
+	.string	"BAUD_1200"
+.LASF323:
+	.string	"__USER_LABEL_PREFIX__ "
+.LASF525:
+	.string	"__attribute_copy__"
+.LASF1799:
+	.string	"DEFIO_REC__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1669:
+	.string	"DEFIO_TAG_E__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1863:
+	.string	"DEFIO_TAG__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF1285:
+	.string	"_SIZE_T_DECLARED "
+.LASF1248:
+	.string	"NAV_MAX_WAYPOINTS 60"
+.LASF194:
+	.string	"__DECIMAL_DIG__ 21"
+.LASF555:
+	.string	"__GLIBC_USE_LIB_EXT2 0"
+.LASF131:
+	.string	"__UINT_LEAST32_MAX__ 0xffffffffU"
+.LASF1965:
+	.string	"OWNER_OSD"
+.LASF1401:
+	.string	"PG_REGISTRY_SIZE (__pg_registry_end - __pg_registry_start)"
+.LASF208:
+	.string	"__FLT16_MIN_10_EXP__ (-4)"
+.LASF1951:
+	.string	"OWNER_SERVO"
+.LASF1349:
+	.string	"USE_1WIRE"
+.LASF718:
+	.string	"isprint(c) __isctype((c), _ISprint)"
+.LASF1459:
+	.string	"_CHOOSE_VAR2(prefix,unique) prefix ##unique"
+.LASF1423:
+	.string	"USECS_PER_SEC (1000 * 1000)"
+.LASF1901:
+	.string	"SPIDEV_COUNT 4"
+.LASF925:
+	.string	"__DECL_SIMD_cbrtf32x "
+.LASF2136:
+	.string	"flowPort"
+.LASF709:
+	.string	"__toascii(c) ((c) & 0x7f)"
+.LASF506:
+	.string	"__attribute_format_arg__(x) __attribute__ ((__format_arg__ (x)))"
+.LASF1840:
+	.string	"DEFIO_TAG_E__PG1 DEFIO_TAG_E__NONE"
+.LASF893:
+	.string	"__DECL_SIMD_coshf64 "
+.LASF328:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8 1"
+.LASF1361:
+	.string	"SKIP_CLI_RESOURCES "
+.LASF108:
+	.string	"__INT16_MAX__ 0x7fff"
+.LASF1468:
+	.string	"asin_approx(x) (M_PIf / 2 - acos_approx(x))"
+.LASF969:
+	.string	"__DECL_SIMD_atanhf "
+.LASF154:
+	.string	"__DEC_EVAL_METHOD__ 2"
+.LASF566:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT"
+.LASF2115:
+	.string	"SERIAL_PORT_IDENTIFIER_MAX"
+.LASF1982:
+	.string	"OWNER_IRLOCK"
+.LASF1625:
+	.string	"DEFIO_REC__PB9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(9) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1873:
+	.string	"DEFIO_TAG_E__PG12 DEFIO_TAG_E__NONE"
+.LASF223:
+	.string	"__FLT32_MIN_EXP__ (-125)"
+.LASF1574:
+	.string	"DEFIO_REC__PA8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(8) - 1)) + 0)"
+.LASF827:
+	.string	"__DECL_SIMD_powf128x "
+.LASF702:
+	.string	"_BITS_ENDIANNESS_H 1"
+.LASF1543:
+	.string	"DEFIO_GPIOID__C 2"
+.LASF1923:
+	.string	"long unsigned int"
+.LASF175:
+	.string	"__DBL_MIN_10_EXP__ (-307)"
+.LASF1770:
+	.string	"DEFIO_TAG__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1581:
+	.string	"DEFIO_TAG__PA11 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 11)"
+.LASF1269:
+	.string	"_GCC_PTRDIFF_T "
+.LASF280:
+	.string	"__FLT32X_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F32x"
+.LASF1404:
+	.string	"PG_RESET_CURRENT(_name) do { extern const pgRegistry_t _name ##_Registry; pgResetCurrent(&_name ## _Registry); } while (0)"
+.LASF1355:
+	.string	"USE_VCP"
+.LASF668:
+	.string	"UINT_FAST16_MAX (18446744073709551615UL)"
+.LASF1615:
+	.string	"DEFIO_TAG_E__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF159:
+	.string	"__FLT_MIN_10_EXP__ (-37)"
+.LASF1927:
+	.string	"__int16_t"
+.LASF922:
+	.string	"__DECL_SIMD_cbrtf32 "
+.LASF1774:
+	.string	"DEFIO_TAG_E__PE11 DEFIO_TAG_E__NONE"
+.LASF270:
+	.string	"__FLT32X_DIG__ 15"
+.LASF2089:
+	.string	"BAUD_4800"
+.LASF1929:
+	.string	"__uint16_t"
+.LASF1065:
+	.string	"__CFLOAT32X _Complex _Float32x"
+.LASF141:
+	.string	"__INT_FAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1950:
+	.string	"OWNER_MOTOR"
+.LASF894:
+	.string	"__DECL_SIMD_coshf128 "
+.LASF172:
+	.string	"__DBL_MANT_DIG__ 53"
+.LASF1632:
+	.string	"DEFIO_TAG__PB12 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 12)"
+.LASF861:
+	.string	"__DECL_SIMD_hypotf16 "
+.LASF1367:
+	.string	"USART2 ((USART_TypeDef *)0x0002)"
+.LASF2069:
+	.string	"FUNCTION_BLACKBOX"
+.LASF1516:
+	.string	"DEFIO_TAG_MAKE(gpioid,pin) ((((gpioid) + 1) << 4) | (pin))"
+.LASF443:
+	.string	"__USE_POSIX 1"
+.LASF406:
+	.string	"__USE_POSIX"
+.LASF1852:
+	.string	"DEFIO_TAG_E__PG5 DEFIO_TAG_E__NONE"
+.LASF1304:
+	.string	"__INT_WCHAR_T_H "
+.LASF1902:
+	.string	"BUS_SPI1 SPIDEV_1"
+.LASF939:
+	.string	"__DECL_SIMD_log10f "
+.LASF197:
+	.string	"__LDBL_NORM_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF306:
+	.string	"__DEC32_EPSILON__ 1E-6DF"
+.LASF1665:
+	.string	"DEFIO_TAG__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF864:
+	.string	"__DECL_SIMD_hypotf128 "
+.LASF147:
+	.string	"__INTPTR_MAX__ 0x7fffffffffffffffL"
+.LASF1151:
+	.string	"M_LN10 2.30258509299404568402"
+.LASF1520:
+	.string	"DEFIO_PORT_A_USED_MASK TARGET_IO_PORTA"
+.LASF537:
+	.string	"__glibc_macro_warning(message) __glibc_macro_warning1 (GCC warning message)"
+.LASF1792:
+	.string	"DEFIO_TAG_E__PF1 DEFIO_TAG_E__NONE"
+.LASF833:
+	.string	"__DECL_SIMD_acosf64 "
+.LASF277:
+	.string	"__FLT32X_NORM_MAX__ 1.79769313486231570814527423731704357e+308F32x"
+.LASF2039:
+	.string	"txBufferHead"
+.LASF666:
+	.string	"INT_FAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF2095:
+	.string	"BAUD_230400"
+.LASF130:
+	.string	"__UINT16_C(c) c"
+.LASF166:
+	.string	"__FLT_EPSILON__ 1.19209289550781250000000000000000000e-7F"
+.LASF895:
+	.string	"__DECL_SIMD_coshf32x "
+.LASF1551:
+	.string	"DEFIO_TAG__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF149:
+	.string	"__UINTPTR_MAX__ 0xffffffffffffffffUL"
+.LASF393:
+	.string	"_STDBOOL_H "
+.LASF1842:
+	.string	"DEFIO_TAG__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF488:
+	.string	"__errordecl(name,msg) extern void name (void) __attribute__((__error__ (msg)))"
+.LASF1576:
+	.string	"DEFIO_TAG_E__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF2097:
+	.string	"BAUD_460800"
+.LASF1003:
+	.string	"__DECL_SIMD_tanhf64 "
+.LASF338:
+	.string	"__GCC_ATOMIC_TEST_AND_SET_TRUEVAL 1"
+.LASF133:
+	.string	"__UINT_LEAST64_MAX__ 0xffffffffffffffffUL"
+.LASF796:
+	.string	"__DECL_SIMD_sincosf64x "
+.LASF556:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT"
+.LASF824:
+	.string	"__DECL_SIMD_powf128 "
+.LASF865:
+	.string	"__DECL_SIMD_hypotf32x "
+.LASF523:
+	.string	"__glibc_likely(cond) __builtin_expect ((cond), 1)"
+.LASF128:
+	.string	"__UINT8_C(c) c"
+.LASF1143:
+	.string	"isinf(x) __builtin_isinf_sign (x)"
+.LASF2099:
+	.string	"BAUD_1000000"
+.LASF1893:
+	.string	"DMATAG_GET_CHANNEL(x) ( ((x) >> 0) & 0x0F )"
+.LASF763:
+	.string	"isblank_l(c,l) __isblank_l ((c), (l))"
+.LASF2127:
+	.string	"quality"
+.LASF1947:
+	.string	"OWNER_PWMIO"
+.LASF1061:
+	.string	"__f32x(x) x ##f32x"
+.LASF882:
+	.string	"__DECL_SIMD_exp10f32 "
+.LASF1657:
+	.string	"DEFIO_TAG_E__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF562:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT"
+.LASF1215:
+	.string	"USE_OLED_UG2864 "
+.LASF1707:
+	.string	"DEFIO_TAG__PD5 defio_error_PD5_is_not_supported_on_TARGET"
+.LASF1158:
+	.string	"M_SQRT2 1.41421356237309504880"
+.LASF1668:
+	.string	"DEFIO_TAG__PC8 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 8)"
+.LASF1232:
+	.string	"NAV_GPS_GLITCH_DETECTION "
+.LASF1255:
+	.string	"USE_GLOBAL_FUNCTIONS "
+.LASF1484:
+	.string	"CONCAT(x,y) CONCAT_HELPER(x, y)"
+.LASF47:
+	.string	"__INTMAX_TYPE__ long int"
+.LASF737:
+	.string	"toupper_l(c,locale) __toupper_l ((c), (locale))"
+.LASF1127:
+	.string	"__MATHCALL_NARROW_NORMAL"
+.LASF1973:
+	.string	"OWNER_RX_SPI"
+.LASF749:
+	.string	"__isblank_l(c,l) __isctype_l((c), _ISblank, (l))"
+.LASF650:
+	.string	"INT_LEAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1860:
+	.string	"DEFIO_TAG__PG8 defio_error_PG8_is_not_supported_on_TARGET"
+.LASF349:
+	.string	"__amd64 1"
+.LASF2076:
+	.string	"FUNCTION_OPTICAL_FLOW"
+.LASF2065:
+	.string	"FUNCTION_TELEMETRY_HOTT"
+.LASF1920:
+	.string	"unsigned char"
+.LASF633:
+	.string	"_BITS_STDINT_UINTN_H 1"
+.LASF734:
+	.string	"__tolower_l(c,locale) __tobody (c, __tolower_l, (locale)->__ctype_tolower, (c, locale))"
+.LASF660:
+	.string	"INT_FAST16_MIN (-9223372036854775807L-1)"
+.LASF1078:
+	.string	"__MATHCALL_VEC(function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHCALL (function, suffix, args)"
+.LASF538:
+	.string	"__HAVE_GENERIC_SELECTION 1"
+.LASF874:
+	.string	"__DECL_SIMD_exp2f128 "
+.LASF1734:
+	.string	"DEFIO_TAG__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF1471:
+	.string	"IO_NONE ((IO_t)0)"
+.LASF664:
+	.string	"INT_FAST16_MAX (9223372036854775807L)"
+.LASF35:
+	.string	"__ORDER_LITTLE_ENDIAN__ 1234"
+.LASF1270:
+	.string	"_PTRDIFF_T_DECLARED "
+.LASF1447:
+	.string	"DEKADEGREES_TO_DEGREES(angle) ((angle) * DEGREES_PER_DEKADEGREE)"
+.LASF1731:
+	.string	"DEFIO_TAG__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1802:
+	.string	"DEFIO_REC__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF1182:
+	.string	"USE_NAV "
+.LASF1748:
+	.string	"DEFIO_REC__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF358:
+	.string	"__k8 1"
+.LASF1694:
+	.string	"DEFIO_REC__PD0 defio_error_PD0_is_not_supported_on_TARGET"
+.LASF157:
+	.string	"__FLT_DIG__ 6"
+.LASF1942:
+	.string	"float"
+.LASF2029:
+	.string	"identifier"
+.LASF176:
+	.string	"__DBL_MAX_EXP__ 1024"
+.LASF404:
+	.string	"__USE_ISOC95"
+.LASF1547:
+	.string	"DEFIO_GPIOID__G 6"
+.LASF403:
+	.string	"__USE_ISOC99"
+.LASF129:
+	.string	"__UINT_LEAST16_MAX__ 0xffff"
+.LASF1375:
+	.string	"__NOINLINE __attribute__((noinline))"
+.LASF1695:
+	.string	"DEFIO_TAG__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF687:
+	.string	"INT16_C(c) c"
+.LASF1637:
+	.string	"DEFIO_REC__PB13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF2053:
+	.string	"writeBuf"
+.LASF1116:
+	.string	"__MATHDECL"
+.LASF273:
+	.string	"__FLT32X_MAX_EXP__ 1024"
+.LASF990:
+	.string	"__DECL_SIMD_erfl "
+.LASF930:
+	.string	"__DECL_SIMD_atan2l "
+.LASF228:
+	.string	"__FLT32_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF319:
+	.string	"__DEC128_MAX__ 9.999999999999999999999999999999999E6144DL"
+.LASF2074:
+	.string	"FUNCTION_VTX_TRAMP"
+.LASF1474:
+	.string	"IOCFG_OUT_OD 0"
+.LASF632:
+	.string	"_BITS_STDINT_INTN_H 1"
+.LASF352:
+	.string	"__x86_64__ 1"
+.LASF851:
+	.string	"__DECL_SIMD_asinf16 "
+.LASF1262:
+	.string	"_PTRDIFF_T "
+.LASF534:
+	.string	"__REDIRECT_LDBL(name,proto,alias) __REDIRECT (name, proto, alias)"
+.LASF97:
+	.string	"__PTRDIFF_WIDTH__ 64"
+.LASF413:
+	.string	"__USE_XOPEN2K"
+.LASF1589:
+	.string	"DEFIO_REC__PA13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(13) - 1)) + 0)"
+.LASF409:
+	.string	"__USE_POSIX199506"
+.LASF1385:
+	.string	"STATIC_UNIT_TESTED static"
+.LASF2057:
+	.string	"endWrite"
+.LASF2061:
+	.string	"FUNCTION_NONE"
+.LASF474:
+	.string	"__NTH(fct) __attribute__ ((__nothrow__ __LEAF)) fct"
+.LASF1193:
+	.string	"USE_EXTENDED_CMS_MENUS "
+.LASF947:
+	.string	"__DECL_SIMD_log10f128x "
+.LASF1184:
+	.string	"USE_TELEMETRY_LTM "
+.LASF433:
+	.string	"_DEFAULT_SOURCE"
+.LASF1594:
+	.string	"DEFIO_TAG_E__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1180:
+	.string	"USE_GPS "
+.LASF655:
+	.string	"UINT_LEAST8_MAX (255)"
+.LASF67:
+	.string	"__UINT_LEAST64_TYPE__ long unsigned int"
+.LASF1855:
+	.string	"DEFIO_TAG_E__PG6 DEFIO_TAG_E__NONE"
+.LASF1974:
+	.string	"OWNER_VTX"
+.LASF512:
+	.string	"__wur "
+.LASF1824:
+	.string	"DEFIO_TAG__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF178:
+	.string	"__DBL_DECIMAL_DIG__ 17"
+.LASF27:
+	.string	"__SIZEOF_LONG_LONG__ 8"
+.LASF475:
+	.string	"__NTHNL(fct) __attribute__ ((__nothrow__)) fct"
+.LASF1175:
+	.string	"USE_SERIALRX_FPORT "
+.LASF841:
+	.string	"__DECL_SIMD_atanf16 "
+.LASF1144:
+	.string	"MATH_ERRNO 1"
+.LASF290:
+	.string	"__FLT64X_MAX_10_EXP__ 4932"
+.LASF227:
+	.string	"__FLT32_DECIMAL_DIG__ 9"
+.LASF1655:
+	.string	"DEFIO_REC__PC3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1978:
+	.string	"OWNER_1WIRE"
+.LASF1362:
+	.string	"USE_GYRO_STAGE_PROBE "
+.LASF1878:
+	.string	"DEFIO_TAG__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1100:
+	.string	"__MATH_PRECNAME(name,r) name ##l ##r"
+.LASF2131:
+	.string	"init"
+.LASF434:
+	.string	"_DEFAULT_SOURCE 1"
+.LASF1209:
+	.string	"USE_TEMPERATURE_SENSOR "
+.LASF1466:
+	.string	"ABS(x) _ABS_I(x, _CHOOSE_VAR(_abs, __COUNTER__))"
+.LASF594:
+	.string	"__FSWORD_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1749:
+	.string	"DEFIO_TAG__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF46:
+	.string	"__WINT_TYPE__ unsigned int"
+.LASF1243:
+	.string	"USE_SERIALRX_XBUS "
+.LASF258:
+	.string	"__FLT128_MAX_10_EXP__ 4932"
+.LASF1088:
+	.string	"_Mdouble_ double"
+.LASF2091:
+	.string	"BAUD_19200"
+.LASF1957:
+	.string	"OWNER_RANGEFINDER"
+.LASF863:
+	.string	"__DECL_SIMD_hypotf64 "
+.LASF2034:
+	.string	"txBufferSize"
+.LASF1845:
+	.string	"DEFIO_TAG__PG3 defio_error_PG3_is_not_supported_on_TARGET"
+.LASF106:
+	.string	"__SIG_ATOMIC_WIDTH__ 32"
+.LASF469:
+	.string	"__glibc_has_extension(ext) 0"
+.LASF1539:
+	.string	"DEFIO_PORT_G_USED_COUNT 0"
+.LASF472:
+	.string	"__THROW __attribute__ ((__nothrow__ __LEAF))"
+.LASF634:
+	.string	"__intptr_t_defined "
+.LASF1910:
+	.string	"BUS_I2C_EMULATED I2CINVALID"
+.LASF642:
+	.string	"INT64_MAX (__INT64_C(9223372036854775807))"
+.LASF653:
+	.string	"INT_LEAST32_MAX (2147483647)"
+.LASF528:
+	.string	"__LDBL_REDIR1(name,proto,alias) name proto"
+.LASF156:
+	.string	"__FLT_MANT_DIG__ 24"
+.LASF889:
+	.string	"__DECL_SIMD_coshf "
+.LASF1071:
+	.string	"NAN (__builtin_nanf (\"\"))"
+.LASF2132:
+	.string	"update"
+.LASF2100:
+	.string	"BAUD_1500000"
+.LASF137:
+	.string	"__INT_FAST16_MAX__ 0x7fffffffffffffffL"
+.LASF485:
+	.string	"__glibc_objsize0(__o) __bos0 (__o)"
+.LASF1712:
+	.string	"DEFIO_REC__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF987:
+	.string	"__DECL_SIMD_acoshf128x "
+.LASF1626:
+	.string	"DEFIO_TAG__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF962:
+	.string	"__DECL_SIMD_log1pf32 "
+.LASF251:
+	.string	"__FLT64_HAS_QUIET_NAN__ 1"
+.LASF729:
+	.string	"_toupper(c) ((int) (*__ctype_toupper_loc ())[(int) (c)])"
+.LASF1713:
+	.string	"DEFIO_TAG__PD7 defio_error_PD7_is_not_supported_on_TARGET"
+.LASF576:
+	.string	"__UQUAD_TYPE unsigned long int"
+.LASF2077:
+	.string	"FUNCTION_LOG"
+.LASF1912:
+	.string	"BUSDEV_REGISTER_ATTRIBUTES __attribute__ ((section(\".busdev_registry\"), used, aligned(4)))"
+.LASF1544:
+	.string	"DEFIO_GPIOID__D 3"
+.LASF1021:
+	.string	"__DECL_SIMD_erfcf16 "
+.LASF416:
+	.string	"__USE_XOPEN2K8XSI"
+.LASF2130:
+	.string	"detect"
+.LASF867:
+	.string	"__DECL_SIMD_hypotf128x "
+.LASF1556:
+	.string	"DEFIO_REC__PA2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(2) - 1)) + 0)"
+.LASF2058:
+	.string	"writeBufChunks"
+.LASF1110:
+	.string	"__MATH_PRECNAME(name,r) name ##f32x ##r"
+.LASF1360:
+	.string	"USE_ITCM_RAM"
+.LASF1596:
+	.string	"DEFIO_TAG__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF2155:
+	.string	"tmpData"
+.LASF670:
+	.string	"UINT_FAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF1663:
+	.string	"DEFIO_TAG_E__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF98:
+	.string	"__SIZE_WIDTH__ 64"
+.LASF1682:
+	.string	"DEFIO_REC__PC12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(12) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2030:
+	.string	"mode"
+.LASF1051:
+	.string	"__HAVE_DISTINCT_FLOAT16 __HAVE_FLOAT16"
+.LASF454:
+	.string	"__TIMESIZE __WORDSIZE"
+.LASF304:
+	.string	"__DEC32_MIN__ 1E-95DF"
+.LASF1090:
+	.string	"__MATH_DECLARING_DOUBLE 1"
+.LASF158:
+	.string	"__FLT_MIN_EXP__ (-125)"
+.LASF671:
+	.string	"INTPTR_MIN (-9223372036854775807L-1)"
+.LASF2050:
+	.string	"serialSetBaudRate"
+.LASF921:
+	.string	"__DECL_SIMD_cbrtf16 "
+.LASF2049:
+	.string	"serialRead"
+.LASF1865:
+	.string	"DEFIO_REC__PG9 defio_error_PG9_is_not_supported_on_TARGET"
+.LASF155:
+	.string	"__FLT_RADIX__ 2"
+.LASF122:
+	.string	"__INT32_C(c) c"
+.LASF536:
+	.string	"__glibc_macro_warning1(message) _Pragma (#message)"
+.LASF1794:
+	.string	"DEFIO_TAG__PF2 defio_error_PF2_is_not_supported_on_TARGET"
+.LASF204:
+	.string	"__LDBL_IS_IEC_60559__ 2"
+.LASF959:
+	.string	"__DECL_SIMD_log1pf "
+.LASF1239:
+	.string	"USE_MSP_OVER_TELEMETRY "
+.LASF777:
+	.string	"__DECL_SIMD_cosf128x "
+.LASF1998:
+	.string	"RESOURCE_SPI_CS"
+.LASF1472:
+	.string	"IO_TAG(pinid) DEFIO_TAG(pinid)"
+.LASF692:
+	.string	"UINT32_C(c) c ## U"
+.LASF940:
+	.string	"__DECL_SIMD_log10l "
+.LASF2041:
+	.string	"rxCallback"
+.LASF396:
+	.string	"false 0"
+.LASF1353:
+	.string	"USE_TEMPERATURE_DS18B20"
+.LASF1877:
+	.string	"DEFIO_REC__PG13 defio_error_PG13_is_not_supported_on_TARGET"
+.LASF646:
+	.string	"UINT64_MAX (__UINT64_C(18446744073709551615))"
+.LASF153:
+	.string	"__FLT_EVAL_METHOD_TS_18661_3__ 0"
+.LASF1805:
+	.string	"DEFIO_REC__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF1348:
+	.string	"USE_PITOT_ADC"
+.LASF2120:
+	.string	"gps_baudrateIndex"
+.LASF817:
+	.string	"__DECL_SIMD_expf128x "
+.LASF753:
+	.string	"isalpha_l(c,l) __isalpha_l ((c), (l))"
+.LASF1219:
+	.string	"USE_DJI_HD_OSD "
+.LASF1454:
+	.string	"CENTIMETERS_TO_CENTIFEET(cm) (cm * (328 / 100.0))"
+.LASF1599:
+	.string	"DEFIO_TAG__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2035:
+	.string	"rxBuffer"
+.LASF2023:
+	.string	"serialBufChunk_t"
+.LASF1053:
+	.string	"__HAVE_DISTINCT_FLOAT64 0"
+.LASF689:
+	.string	"INT64_C(c) c ## L"
+.LASF1123:
+	.string	"__MATHCALL_NARROW(func,redir,nargs) __MATHCALL_NARROW_NORMAL (func, nargs)"
+.LASF2014:
+	.string	"SERIAL_PARITY_NO"
+.LASF307:
+	.string	"__DEC32_SUBNORMAL_MIN__ 0.000001E-95DF"
+.LASF425:
+	.string	"__KERNEL_STRICT_NAMES"
+.LASF48:
+	.string	"__UINTMAX_TYPE__ long unsigned int"
+.LASF1201:
+	.string	"USE_RANGEFINDER_VL53L0X "
+.LASF1033:
+	.string	"__DECL_SIMD_tanf64 "
+.LASF626:
+	.string	"_BITS_TIME64_H 1"
+.LASF1443:
+	.string	"DEGREES_TO_DECIDEGREES(angle) ((angle) * 10)"
+.LASF665:
+	.string	"INT_FAST32_MAX (9223372036854775807L)"
+.LASF72:
+	.string	"__UINT_FAST8_TYPE__ unsigned char"
+.LASF1630:
+	.string	"DEFIO_TAG_E__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF50:
+	.string	"__CHAR32_TYPE__ unsigned int"
+.LASF927:
+	.string	"__DECL_SIMD_cbrtf128x "
+.LASF606:
+	.string	"__ID_T_TYPE __U32_TYPE"
+.LASF92:
+	.string	"__INT_WIDTH__ 32"
+.LASF498:
+	.string	"__attribute_alloc_align__(param) __attribute__ ((__alloc_align__ param))"
+.LASF1394:
+	.string	"STATIC_FASTRAM_UNIT_TESTED STATIC_UNIT_TESTED FASTRAM"
+.LASF59:
+	.string	"__UINT64_TYPE__ long unsigned int"
+.LASF946:
+	.string	"__DECL_SIMD_log10f64x "
+.LASF1826:
+	.string	"DEFIO_REC__PF12 defio_error_PF12_is_not_supported_on_TARGET"
+.LASF849:
+	.string	"__DECL_SIMD_asinf "
+.LASF1858:
+	.string	"DEFIO_TAG_E__PG7 DEFIO_TAG_E__NONE"
+.LASF1205:
+	.string	"USE_OPFLOW_MSP "
+.LASF760:
+	.string	"isspace_l(c,l) __isspace_l ((c), (l))"
+.LASF418:
+	.string	"__USE_LARGEFILE64"
+.LASF2157:
+	.string	"cxofOpflowDetect"
+.LASF236:
+	.string	"__FLT32_IS_IEC_60559__ 2"
+.LASF1997:
+	.string	"RESOURCE_SPI_MISO"
+.LASF514:
+	.string	"__always_inline __inline __attribute__ ((__always_inline__))"
+.LASF24:
+	.string	"__LP64__ 1"
+.LASF570:
+	.string	"__U16_TYPE unsigned short int"
+.LASF1967:
+	.string	"OWNER_MPU"
+.LASF1390:
+	.string	"REQUIRE_PRINTF_LONG_SUPPORT "
+.LASF509:
+	.string	"__nonnull(params) __attribute_nonnull__ (params)"
+.LASF1506:
+	.string	"ALIGNED(x) __attribute__ ((aligned(x)))"
+.LASF1120:
+	.string	"__MATHCALL_NARROW_ARGS_3 (_Marg_ __x, _Marg_ __y, _Marg_ __z)"
+.LASF1850:
+	.string	"DEFIO_REC__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF1091:
+	.string	"__MATH_DECLARING_FLOATN 0"
+.LASF1104:
+	.string	"__MATH_DECLARING_FLOATN 1"
+.LASF200:
+	.string	"__LDBL_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951L"
+.LASF368:
+	.string	"__SEG_FS 1"
+.LASF499:
+	.string	"__attribute_pure__ __attribute__ ((__pure__))"
+.LASF816:
+	.string	"__DECL_SIMD_expf64x "
+.LASF275:
+	.string	"__FLT32X_DECIMAL_DIG__ 17"
+.LASF1515:
+	.string	"DEFIO_REC_INDEXED(idx) (ioRecs + (idx))"
+.LASF1685:
+	.string	"DEFIO_REC__PC13 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(13) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF973:
+	.string	"__DECL_SIMD_atanhf64 "
+.LASF332:
+	.string	"__GCC_ATOMIC_CHAR32_T_LOCK_FREE 2"
+.LASF769:
+	.string	"__DECL_SIMD_cosf "
+.LASF53:
+	.string	"__INT16_TYPE__ short int"
+.LASF254:
+	.string	"__FLT128_DIG__ 33"
+.LASF1690:
+	.string	"DEFIO_TAG_E__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF429:
+	.string	"__KERNEL_STRICT_NAMES "
+.LASF1977:
+	.string	"OWNER_TEMPERATURE"
+.LASF1869:
+	.string	"DEFIO_TAG__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1048:
+	.string	"__HAVE_FLOAT64 1"
+.LASF70:
+	.string	"__INT_FAST32_TYPE__ long int"
+.LASF1287:
+	.string	"___int_size_t_h "
+.LASF66:
+	.string	"__UINT_LEAST32_TYPE__ unsigned int"
+.LASF1157:
+	.string	"M_2_SQRTPI 1.12837916709551257390"
+.LASF99:
+	.string	"__INTMAX_MAX__ 0x7fffffffffffffffL"
+.LASF1282:
+	.string	"_SIZE_T_DEFINED_ "
+.LASF2020:
+	.string	"SERIAL_BIDIR_NOPULL"
+.LASF1968:
+	.string	"OWNER_INVERTER"
+.LASF1185:
+	.string	"USE_TELEMETRY_FRSKY "
+.LASF2009:
+	.string	"portOptions_t"
+.LASF733:
+	.string	"__exctype_l(name) extern int name (int, locale_t) __THROW"
+.LASF1848:
+	.string	"DEFIO_TAG__PG4 defio_error_PG4_is_not_supported_on_TARGET"
+.LASF608:
+	.string	"__TIME_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1938:
+	.string	"uint8_t"
+.LASF1593:
+	.string	"DEFIO_TAG__PA15 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 15)"
+.LASF1908:
+	.string	"BUS_I2C3 I2CDEV_3"
+.LASF548:
+	.string	"__stub_fchflags "
+.LASF1195:
+	.string	"USE_RX_UIB "
+.LASF1651:
+	.string	"DEFIO_TAG_E__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+.LASF574:
+	.string	"__ULONGWORD_TYPE unsigned long int"
+.LASF1837:
+	.string	"DEFIO_TAG_E__PG0 DEFIO_TAG_E__NONE"
+.LASF317:
+	.string	"__DEC128_MAX_EXP__ 6145"
+.LASF1502:
+	.string	"LOG2_64BIT(v) (32*((v)/2L>>31 > 0) + LOG2_32BIT((v)*1L >>16*((v)/2L>>31 > 0) >>16*((v)/2L>>31 > 0)))"
+.LASF1094:
+	.string	"__MATH_DECLARING_DOUBLE"
+.LASF1492:
+	.string	"EXPAND(x) EXPAND_I(x)"
+.LASF758:
+	.string	"isprint_l(c,l) __isprint_l ((c), (l))"
+.LASF410:
+	.string	"__USE_XOPEN"
+.LASF834:
+	.string	"__DECL_SIMD_acosf128 "
+.LASF350:
+	.string	"__amd64__ 1"
+.LASF1895:
+	.string	"DEFINE_DMA_IRQ_HANDLER(d,c,i) void DMA ## d ## _Channel ## c ## _IRQHandler(void) { if (dmaDescriptors[i].irqHandlerCallback) dmaDescriptors[i].irqHandlerCallback(&dmaDescriptors[i]); }"
+.LASF432:
+	.string	"__GLIBC_USE(F) __GLIBC_USE_ ## F"
+.LASF1026:
+	.string	"__DECL_SIMD_erfcf64x "
+.LASF1008:
+	.string	"__DECL_SIMD_asinh "
+.LASF1719:
+	.string	"DEFIO_TAG__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1871:
+	.string	"DEFIO_REC__PG11 defio_error_PG11_is_not_supported_on_TARGET"
+.LASF1354:
+	.string	"USE_ADC"
+.LASF452:
+	.string	"__WORDSIZE_TIME64_COMPAT32 1"
+.LASF342:
+	.string	"__HAVE_SPECULATION_SAFE_VALUE 1"
+.LASF541:
+	.string	"__attr_access_none(argno) __attribute__ ((__access__ (__none__, argno)))"
+.LASF1305:
+	.string	"_GCC_WCHAR_T "
+.LASF1300:
+	.string	"_WCHAR_T_DEFINED_ "
+.LASF1161:
+	.string	"isgreaterequal(x,y) __builtin_isgreaterequal(x, y)"
+.LASF2124:
+	.string	"opflowData_s"
+.LASF2128:
+	.string	"opflowData_t"
+.LASF1987:
+	.string	"RESOURCE_IO"
+.LASF1677:
+	.string	"DEFIO_TAG__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF1036:
+	.string	"__DECL_SIMD_tanf64x "
+.LASF682:
+	.string	"WCHAR_MIN __WCHAR_MIN"
+.LASF645:
+	.string	"UINT32_MAX (4294967295U)"
+.LASF1380:
+	.string	"FUNCTION_COMPILE_FOR_SPEED __attribute__((optimize(\"-Ofast\")))"
+.LASF1374:
+	.string	"__NVIC_PRIO_BITS 4"
+.LASF142:
+	.string	"__INT_FAST64_WIDTH__ 64"
+.LASF533:
+	.string	"__LDBL_REDIR_DECL(name) "
+.LASF1787:
+	.string	"DEFIO_REC__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF835:
+	.string	"__DECL_SIMD_acosf32x "
+.LASF1814:
+	.string	"DEFIO_REC__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1231:
+	.string	"USE_GPS_PROTO_MTK "
+.LASF1700:
+	.string	"DEFIO_REC__PD2 defio_error_PD2_is_not_supported_on_TARGET"
+.LASF376:
+	.string	"unix 1"
+.LASF1134:
+	.string	"FP_INFINITE 1"
+.LASF1124:
+	.string	"__MATHCALL_NARROW_ARGS_1"
+.LASF1125:
+	.string	"__MATHCALL_NARROW_ARGS_2"
+.LASF1126:
+	.string	"__MATHCALL_NARROW_ARGS_3"
+.LASF171:
+	.string	"__FLT_IS_IEC_60559__ 2"
+.LASF778:
+	.string	"__DECL_SIMD_sin "
+.LASF1200:
+	.string	"USE_RANGEFINDER_BENEWAKE "
+.LASF1592:
+	.string	"DEFIO_REC__PA14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(14) - 1)) + 0)"
+.LASF1311:
+	.string	"NULL ((void *)0)"
+.LASF190:
+	.string	"__LDBL_MIN_EXP__ (-16381)"
+.LASF436:
+	.string	"__USE_ISOC99 1"
+.LASF1308:
+	.string	"_BSD_WCHAR_T_"
+.LASF974:
+	.string	"__DECL_SIMD_atanhf128 "
+.LASF79:
+	.string	"__SCHAR_MAX__ 0x7f"
+.LASF1611:
+	.string	"DEFIO_TAG__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF343:
+	.string	"__GCC_HAVE_DWARF2_CFI_ASM 1"
+.LASF1044:
+	.string	"__CFLOAT128 _Complex _Float128"
+.LASF1339:
+	.string	"USE_SERVO_SBUS"
+.LASF532:
+	.string	"__LDBL_REDIR2_DECL(name) "
+.LASF2125:
+	.string	"deltaTime"
+.LASF613:
+	.string	"__KEY_T_TYPE __S32_TYPE"
+.LASF2137:
+	.string	"portConfig"
+.LASF1139:
+	.string	"signbit(x) __builtin_signbit (x)"
+.LASF210:
+	.string	"__FLT16_MAX_10_EXP__ 4"
+.LASF2144:
+	.string	"motionT"
+.LASF1514:
+	.string	"DEFIO_IO(pinid) (IO_t)DEFIO_REC(pinid)"
+.LASF1291:
+	.string	"__need_size_t"
+.LASF1949:
+	.string	"OWNER_PPMINPUT"
+.LASF2085:
+	.string	"serialPortFunction_e"
+.LASF1477:
+	.string	"IOCFG_IPD 0"
+.LASF1272:
+	.string	"__need_ptrdiff_t"
+.LASF821:
+	.string	"__DECL_SIMD_powf16 "
+.LASF852:
+	.string	"__DECL_SIMD_asinf32 "
+.LASF1887:
+	.string	"DEFIO_PORT_OFFSET_LIST DEFIO_PORT_A_OFFSET,DEFIO_PORT_B_OFFSET,DEFIO_PORT_C_OFFSET"
+.LASF1069:
+	.string	"HUGE_VALL (__builtin_huge_vall ())"
+.LASF1226:
+	.string	"USE_LOG "
+.LASF1384:
+	.string	"BUILD_BUG_ON(condition) ((void)sizeof(char[1 - 2*!!(condition)]))"
+.LASF1861:
+	.string	"DEFIO_TAG_E__PG8 DEFIO_TAG_E__NONE"
+.LASF1569:
+	.string	"DEFIO_TAG__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF1108:
+	.string	"__MATH_PRECNAME(name,r) name ##f128 ##r"
+.LASF1616:
+	.string	"DEFIO_REC__PB6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1259:
+	.string	"_STDDEF_H "
+.LASF1804:
+	.string	"DEFIO_TAG_E__PF5 DEFIO_TAG_E__NONE"
+.LASF975:
+	.string	"__DECL_SIMD_atanhf32x "
+.LASF1318:
+	.string	"USE_FAKE_MAG "
+.LASF318:
+	.string	"__DEC128_MIN__ 1E-6143DL"
+.LASF680:
+	.string	"SIG_ATOMIC_MAX (2147483647)"
+.LASF55:
+	.string	"__INT64_TYPE__ long int"
+.LASF1505:
+	.string	"UNREACHABLE() __builtin_unreachable()"
+.LASF1545:
+	.string	"DEFIO_GPIOID__E 4"
+.LASF1122:
+	.string	"__MATHCALL_NARROW_REDIR(func,redir,nargs) extern _Mret_ __REDIRECT_NTH (func, __MATHCALL_NARROW_ARGS_ ## nargs, redir)"
+.LASF308:
+	.string	"__DEC64_MANT_DIG__ 16"
+.LASF1801:
+	.string	"DEFIO_TAG_E__PF4 DEFIO_TAG_E__NONE"
+.LASF871:
+	.string	"__DECL_SIMD_exp2f16 "
+.LASF170:
+	.string	"__FLT_HAS_QUIET_NAN__ 1"
+.LASF1819:
+	.string	"DEFIO_TAG_E__PF10 DEFIO_TAG_E__NONE"
+.LASF696:
+	.string	"_GCC_WRAP_STDINT_H "
+.LASF708:
+	.string	"__isascii(c) (((c) & ~0x7f) == 0)"
+.LASF695:
+	.string	"UINTMAX_C(c) c ## UL"
+.LASF620:
+	.string	"__OFF_T_MATCHES_OFF64_T 1"
+.LASF412:
+	.string	"__USE_UNIX98"
+.LASF806:
+	.string	"__DECL_SIMD_logf64x "
+.LASF1880:
+	.string	"DEFIO_REC__PG14 defio_error_PG14_is_not_supported_on_TARGET"
+.LASF1741:
+	.string	"DEFIO_TAG_E__PE0 DEFIO_TAG_E__NONE"
+.LASF1913:
+	.ascii	"BUSDEV_REGISTER_SPI_F(_name,_devHw,_spiBus,_csnPin,_irqPin,_"
+	.ascii	"tag,_flags,_param) extern const busDeviceDescriptor_t _name "
+	.ascii	"## _registry; static busDevice_t _name ## _memory; const bus"
+	.ascii	"DeviceDescriptor_t _name ## _registry BUSDEV_REGISTER"
+	.string	"_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_SPI, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.spi = { .spiBus = _spiBus, .csnPin = IO_TAG(_csnPin) }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF1097:
+	.string	"__MATH_PRECNAME(name,r) name ##f ##r"
+.LASF478:
+	.string	"__CONCAT(x,y) x ## y"
+.LASF2083:
+	.string	"FUNCTION_DJI_HD_OSD"
+.LASF1369:
+	.string	"UART4 ((USART_TypeDef *)0x0004)"
+.LASF214:
+	.string	"__FLT16_MIN__ 6.10351562500000000000000000000000000e-5F16"
+.LASF1656:
+	.string	"DEFIO_TAG__PC4 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 4)"
+.LASF1409:
+	.string	"PG_REGISTER(_type,_name,_pgn,_version) PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1560:
+	.string	"DEFIO_TAG__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF90:
+	.string	"__SCHAR_WIDTH__ 8"
+.LASF549:
+	.string	"__stub_gtty "
+.LASF1190:
+	.string	"USE_PITOT_VIRTUAL "
+.LASF924:
+	.string	"__DECL_SIMD_cbrtf128 "
+.LASF1451:
+	.string	"RADIANS_TO_DECIDEGREES(angle) (((angle) * 10.0f) / RAD)"
+.LASF37:
+	.string	"__ORDER_PDP_ENDIAN__ 3412"
+.LASF580:
+	.string	"__ULONG32_TYPE unsigned int"
+.LASF13:
+	.string	"__ATOMIC_ACQUIRE 2"
+.LASF1583:
+	.string	"DEFIO_REC__PA11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(11) - 1)) + 0)"
+.LASF83:
+	.string	"__LONG_LONG_MAX__ 0x7fffffffffffffffLL"
+.LASF1747:
+	.string	"DEFIO_TAG_E__PE2 DEFIO_TAG_E__NONE"
+.LASF1012:
+	.string	"__DECL_SIMD_asinhf32 "
+.LASF743:
+	.string	"__isgraph_l(c,l) __isctype_l((c), _ISgraph, (l))"
+.LASF1045:
+	.string	"_BITS_FLOATN_COMMON_H "
+.LASF1629:
+	.string	"DEFIO_TAG__PB11 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 11)"
+.LASF901:
+	.string	"__DECL_SIMD_expm1f16 "
+.LASF700:
+	.string	"__BIG_ENDIAN 4321"
+.LASF1504:
+	.string	"FALLTHROUGH __attribute__ ((fallthrough))"
+.LASF1189:
+	.string	"USE_PITOT_ADC "
+.LASF1607:
+	.string	"DEFIO_REC__PB3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(3) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF647:
+	.string	"INT_LEAST8_MIN (-128)"
+.LASF1529:
+	.string	"DEFIO_PORT_D_USED_MASK 0"
+.LASF622:
+	.string	"__RLIM_T_MATCHES_RLIM64_T 1"
+.LASF1797:
+	.string	"DEFIO_TAG__PF3 defio_error_PF3_is_not_supported_on_TARGET"
+.LASF1883:
+	.string	"DEFIO_REC__PG15 defio_error_PG15_is_not_supported_on_TARGET"
+.LASF1743:
+	.string	"DEFIO_TAG__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1918:
+	.string	"BUSDEV_REGISTER_I2C_TAG(_name,_devHw,_i2cBus,_devAddr,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, _tag, _flags, _param)"
+.LASF1778:
+	.string	"DEFIO_REC__PE12 defio_error_PE12_is_not_supported_on_TARGET"
+.LASF2158:
+	.string	"GNU C99 12.2.0 -mtune=generic -march=x86-64 -ggdb3 -O2 -std=gnu99 -flto -fuse-linker-plugin -ffunction-sections -fdata-sections -fno-common -fasynchronous-unwind-tables"
+.LASF693:
+	.string	"UINT64_C(c) c ## UL"
+.LASF1043:
+	.string	"__f128(x) x ##f128"
+.LASF981:
+	.string	"__DECL_SIMD_acoshf16 "
+.LASF1099:
+	.string	"_Mdouble_ long double"
+.LASF205:
+	.string	"__FLT16_MANT_DIG__ 11"
+.LASF648:
+	.string	"INT_LEAST16_MIN (-32767-1)"
+.LASF1585:
+	.string	"DEFIO_TAG_E__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF378:
+	.string	"__DECIMAL_BID_FORMAT__ 1"
+.LASF1823:
+	.string	"DEFIO_REC__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF103:
+	.string	"__INTMAX_WIDTH__ 64"
+.LASF1579:
+	.string	"DEFIO_TAG_E__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF124:
+	.string	"__INT_LEAST64_MAX__ 0x7fffffffffffffffL"
+.LASF1563:
+	.string	"DEFIO_TAG__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF1654:
+	.string	"DEFIO_TAG_E__PC3 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 3)"
+.LASF288:
+	.string	"__FLT64X_MIN_10_EXP__ (-4931)"
+.LASF2090:
+	.string	"BAUD_9600"
+.LASF1022:
+	.string	"__DECL_SIMD_erfcf32 "
+.LASF1838:
+	.string	"DEFIO_REC__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1461:
+	.string	"_CHOOSE(binoper,lexpr,rexpr) _CHOOSE2( binoper, lexpr, _CHOOSE_VAR(_left, __COUNTER__), rexpr, _CHOOSE_VAR(_right, __COUNTER__) )"
+.LASF1689:
+	.string	"DEFIO_TAG__PC15 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 15)"
+.LASF933:
+	.string	"__DECL_SIMD_atan2f64 "
+.LASF1976:
+	.string	"OWNER_COMPASS"
+.LASF1427:
+	.string	"MS2US(ms) ((ms) * 1000)"
+.LASF295:
+	.string	"__FLT64X_EPSILON__ 1.08420217248550443400745280086994171e-19F64x"
+.LASF11:
+	.string	"__ATOMIC_RELAXED 0"
+.LASF1518:
+	.string	"DEFIO_TAG_GPIOID(tag) (((tag) >> 4) - 1)"
+.LASF101:
+	.string	"__UINTMAX_MAX__ 0xffffffffffffffffUL"
+.LASF739:
+	.string	"__isalpha_l(c,l) __isctype_l((c), _ISalpha, (l))"
+.LASF1029:
+	.string	"__DECL_SIMD_tanf "
+.LASF391:
+	.string	"__STDC_IEC_60559_COMPLEX__ 201404L"
+.LASF1765:
+	.string	"DEFIO_TAG_E__PE8 DEFIO_TAG_E__NONE"
+.LASF1554:
+	.string	"DEFIO_TAG__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF460:
+	.string	"__GNU_LIBRARY__"
+.LASF1841:
+	.string	"DEFIO_REC__PG1 defio_error_PG1_is_not_supported_on_TARGET"
+.LASF1396:
+	.string	"DEBUG_SET(mode,index,value) {if (debugMode == (mode)) {debug[(index)] = (value);}}"
+.LASF456:
+	.string	"__USE_ATFILE 1"
+.LASF445:
+	.string	"__USE_POSIX199309 1"
+.LASF2073:
+	.string	"FUNCTION_VTX_SMARTAUDIO"
+.LASF1467:
+	.string	"tan_approx(x) (sin_approx(x) / cos_approx(x))"
+.LASF1679:
+	.string	"DEFIO_REC__PC11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1703:
+	.string	"DEFIO_REC__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1763:
+	.string	"DEFIO_REC__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1667:
+	.string	"DEFIO_REC__PC7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF2067:
+	.string	"FUNCTION_TELEMETRY_SMARTPORT"
+.LASF183:
+	.string	"__DBL_DENORM_MIN__ ((double)4.94065645841246544176568792868221372e-324L)"
+.LASF1357:
+	.string	"USE_SERIALRX_SPEKTRUM"
+.LASF770:
+	.string	"__DECL_SIMD_cosl "
+.LASF1990:
+	.string	"RESOURCE_UART_RX"
+.LASF150:
+	.string	"__GCC_IEC_559 2"
+.LASF657:
+	.string	"UINT_LEAST32_MAX (4294967295U)"
+.LASF1566:
+	.string	"DEFIO_TAG__PA6 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 6)"
+.LASF493:
+	.string	"__REDIRECT_NTHNL(name,proto,alias) name proto __asm__ (__ASMNAME (#alias)) __THROWNL"
+.LASF1478:
+	.string	"IOCFG_IPU 0"
+.LASF400:
+	.string	"__GLIBC_INTERNAL_STARTING_HEADER_IMPLEMENTATION"
+.LASF1310:
+	.string	"NULL"
+.LASF757:
+	.string	"isgraph_l(c,l) __isgraph_l ((c), (l))"
+.LASF1098:
+	.string	"__MATH_DECLARING_DOUBLE 0"
+.LASF1989:
+	.string	"RESOURCE_UART_TX"
+.LASF756:
+	.string	"islower_l(c,l) __islower_l ((c), (l))"
+.LASF1958:
+	.string	"OWNER_SYSTEM"
+.LASF1246:
+	.string	"USE_PWM_SERVO_DRIVER "
+.LASF599:
+	.string	"__RLIM64_T_TYPE __UQUAD_TYPE"
+.LASF1407:
+	.string	"PG_DECLARE_PROFILE(_type,_name) extern _type *_name ## _ProfileCurrent; static inline const _type* _name(void) { return _name ## _ProfileCurrent; } static inline _type* _name ## Mutable(void) { return _name ## _ProfileCurrent; } struct _dummy"
+.LASF466:
+	.string	"__PMT"
+.LASF1528:
+	.string	"DEFIO_PORT_C_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1487:
+	.string	"CONCAT4_HELPER(x,y,z,w) x ## y ## z ## w"
+.LASF697:
+	.string	"_CTYPE_H 1"
+.LASF1204:
+	.string	"USE_OPFLOW_CXOF "
+.LASF2003:
+	.string	"RESOURCE_RX_CE"
+.LASF1960:
+	.string	"OWNER_I2C"
+.LASF14:
+	.string	"__ATOMIC_RELEASE 3"
+.LASF110:
+	.string	"__INT64_MAX__ 0x7fffffffffffffffL"
+.LASF1191:
+	.string	"USE_DYNAMIC_FILTERS "
+.LASF2122:
+	.string	"telemetry_baudrateIndex"
+.LASF365:
+	.string	"__SSE_MATH__ 1"
+.LASF1480:
+	.string	"ARRAYLEN(x) (sizeof(x) / sizeof((x)[0]))"
+.LASF1103:
+	.string	"__MATH_PRECNAME(name,r) name ##f32 ##r"
+.LASF7:
+	.string	"__GNUC__ 12"
+.LASF996:
+	.string	"__DECL_SIMD_erff64x "
+.LASF292:
+	.string	"__FLT64X_MAX__ 1.18973149535723176502126385303097021e+4932F64x"
+.LASF1744:
+	.string	"DEFIO_TAG_E__PE1 DEFIO_TAG_E__NONE"
+.LASF387:
+	.string	"_STDC_PREDEF_H 1"
+.LASF748:
+	.string	"__isxdigit_l(c,l) __isctype_l((c), _ISxdigit, (l))"
+.LASF2096:
+	.string	"BAUD_250000"
+.LASF1150:
+	.string	"M_LN2 0.69314718055994530942"
+.LASF2062:
+	.string	"FUNCTION_MSP"
+.LASF1946:
+	.string	"OWNER_FREE"
+.LASF949:
+	.string	"__DECL_SIMD_log2f "
+.LASF123:
+	.string	"__INT_LEAST32_WIDTH__ 32"
+.LASF1815:
+	.string	"DEFIO_TAG__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF468:
+	.string	"__glibc_has_builtin(name) __has_builtin (name)"
+.LASF694:
+	.string	"INTMAX_C(c) c ## L"
+.LASF998:
+	.string	"__DECL_SIMD_tanh "
+.LASF187:
+	.string	"__DBL_IS_IEC_60559__ 2"
+.LASF1666:
+	.string	"DEFIO_TAG_E__PC7 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 7)"
+.LASF798:
+	.string	"__DECL_SIMD_log "
+.LASF1680:
+	.string	"DEFIO_TAG__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF265:
+	.string	"__FLT128_HAS_DENORM__ 1"
+.LASF1041:
+	.string	"__HAVE_FLOAT64X 1"
+.LASF1809:
+	.string	"DEFIO_TAG__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1591:
+	.string	"DEFIO_TAG_E__PA14 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 14)"
+.LASF294:
+	.string	"__FLT64X_MIN__ 3.36210314311209350626267781732175260e-4932F64x"
+.LASF1415:
+	.string	"_PG_PROFILE_CURRENT_DECL(_type,_name) _type *_name ## _ProfileCurrent;"
+.LASF1252:
+	.string	"USE_VTX_TRAMP "
+.LASF567:
+	.string	"__GLIBC_USE_IEC_60559_TYPES_EXT 0"
+.LASF81:
+	.string	"__INT_MAX__ 0x7fffffff"
+.LASF519:
+	.string	"__va_arg_pack() __builtin_va_arg_pack ()"
+.LASF736:
+	.string	"tolower_l(c,locale) __tolower_l ((c), (locale))"
+.LASF60:
+	.string	"__INT_LEAST8_TYPE__ signed char"
+.LASF1296:
+	.string	"_T_WCHAR "
+.LASF78:
+	.string	"__GXX_ABI_VERSION 1017"
+.LASF1821:
+	.string	"DEFIO_TAG__PF11 defio_error_PF11_is_not_supported_on_TARGET"
+.LASF363:
+	.string	"__SSE2__ 1"
+.LASF1486:
+	.string	"CONCAT3(x,y,z) CONCAT3_HELPER(x, y, z)"
+.LASF86:
+	.string	"__WINT_MAX__ 0xffffffffU"
+.LASF1664:
+	.string	"DEFIO_REC__PC6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(6) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF573:
+	.string	"__SLONGWORD_TYPE long int"
+.LASF1187:
+	.string	"USE_MR_BRAKING_MODE "
+.LASF1388:
+	.string	"UNIT_TESTED "
+.LASF802:
+	.string	"__DECL_SIMD_logf32 "
+.LASF252:
+	.string	"__FLT64_IS_IEC_60559__ 2"
+.LASF198:
+	.string	"__LDBL_MIN__ 3.36210314311209350626267781732175260e-4932L"
+.LASF346:
+	.string	"__SIZEOF_WCHAR_T__ 4"
+.LASF152:
+	.string	"__FLT_EVAL_METHOD__ 0"
+.LASF674:
+	.string	"INTMAX_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF462:
+	.string	"__GLIBC__ 2"
+.LASF1746:
+	.string	"DEFIO_TAG__PE2 defio_error_PE2_is_not_supported_on_TARGET"
+.LASF938:
+	.string	"__DECL_SIMD_log10 "
+.LASF661:
+	.string	"INT_FAST32_MIN (-9223372036854775807L-1)"
+.LASF107:
+	.string	"__INT8_MAX__ 0x7f"
+.LASF847:
+	.string	"__DECL_SIMD_atanf128x "
+.LASF641:
+	.string	"INT32_MAX (2147483647)"
+.LASF1298:
+	.string	"_WCHAR_T_ "
+.LASF762:
+	.string	"isxdigit_l(c,l) __isxdigit_l ((c), (l))"
+.LASF1420:
+	.string	"PG_RESET_TEMPLATE(_type,_name,...) const _type pgResetTemplate_ ## _name PG_RESETDATA_ATTRIBUTES = { __VA_ARGS__ }"
+.LASF846:
+	.string	"__DECL_SIMD_atanf64x "
+.LASF476:
+	.string	"__P(args) args"
+.LASF1057:
+	.string	"__HAVE_FLOAT128_UNLIKE_LDBL (__HAVE_DISTINCT_FLOAT128 && __LDBL_MANT_DIG__ != 113)"
+.LASF18:
+	.string	"__PIC__ 2"
+.LASF1426:
+	.string	"US2MS(us) ((us) * 1e-3f)"
+.LASF673:
+	.string	"UINTPTR_MAX (18446744073709551615UL)"
+.LASF651:
+	.string	"INT_LEAST8_MAX (127)"
+.LASF1406:
+	.ascii	"PG_DECLARE_ARRAY(_type,_size,_name) extern _type _name ## _S"
+	.ascii	"ystemArray[_size]; extern _type _name ## _CopyArray[_size]; "
+	.ascii	"static inline const _type*"
+	.string	" _name(int _index) { return &_name ## _SystemArray[_index]; } static inline _type* _name ## Mutable(int _index) { return &_name ## _SystemArray[_index]; } static inline _type (* _name ## _array(void))[_size] { return &_name ## _SystemArray; } struct _dummy"
+.LASF716:
+	.string	"islower(c) __isctype((c), _ISlower)"
+.LASF1276:
+	.string	"_SYS_SIZE_T_H "
+.LASF598:
+	.string	"__RLIM_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1941:
+	.string	"uint64_t"
+.LASF1107:
+	.string	"_Mdouble_ _Float128"
+.LASF755:
+	.string	"isdigit_l(c,l) __isdigit_l ((c), (l))"
+.LASF244:
+	.string	"__FLT64_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1017:
+	.string	"__DECL_SIMD_asinhf128x "
+.LASF351:
+	.string	"__x86_64 1"
+.LASF1524:
+	.string	"DEFIO_PORT_B_USED_COUNT BITCOUNT(DEFIO_PORT_B_USED_MASK)"
+.LASF1835:
+	.string	"DEFIO_REC__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF2026:
+	.string	"serialBufChunk_s"
+.LASF712:
+	.string	"isalnum(c) __isctype((c), _ISalnum)"
+.LASF964:
+	.string	"__DECL_SIMD_log1pf128 "
+.LASF1455:
+	.string	"CENTIMETERS_TO_FEET(cm) (cm * (328 / 10000.0))"
+.LASF424:
+	.string	"__USE_FORTIFY_LEVEL"
+.LASF1833:
+	.string	"DEFIO_TAG__PF15 defio_error_PF15_is_not_supported_on_TARGET"
+.LASF1935:
+	.string	"int8_t"
+.LASF903:
+	.string	"__DECL_SIMD_expm1f64 "
+.LASF1608:
+	.string	"DEFIO_TAG__PB4 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 4)"
+.LASF1766:
+	.string	"DEFIO_REC__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF32:
+	.string	"__SIZEOF_SIZE_T__ 8"
+.LASF609:
+	.string	"__USECONDS_T_TYPE __U32_TYPE"
+.LASF639:
+	.string	"INT8_MAX (127)"
+.LASF715:
+	.string	"isdigit(c) __isctype((c), _ISdigit)"
+.LASF960:
+	.string	"__DECL_SIMD_log1pl "
+.LASF842:
+	.string	"__DECL_SIMD_atanf32 "
+.LASF415:
+	.string	"__USE_XOPEN2K8"
+.LASF888:
+	.string	"__DECL_SIMD_cosh "
+.LASF681:
+	.string	"SIZE_MAX (18446744073709551615UL)"
+.LASF887:
+	.string	"__DECL_SIMD_exp10f128x "
+.LASF792:
+	.string	"__DECL_SIMD_sincosf32 "
+.LASF610:
+	.string	"__SUSECONDS_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1312:
+	.string	"__need_NULL"
+.LASF965:
+	.string	"__DECL_SIMD_log1pf32x "
+.LASF720:
+	.string	"isspace(c) __isctype((c), _ISspace)"
+.LASF382:
+	.string	"USE_STDPERIPH_DRIVER 1"
+.LASF1128:
+	.string	"__MATHCALL_NARROW_REDIR"
+.LASF428:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF"
+.LASF914:
+	.string	"__DECL_SIMD_sinhf128 "
+.LASF1109:
+	.string	"_Mdouble_ _Float32x"
+.LASF453:
+	.string	"__SYSCALL_WORDSIZE 64"
+.LASF1352:
+	.string	"USE_TEMPERATURE_LM75"
+.LASF417:
+	.string	"__USE_LARGEFILE"
+.LASF1807:
+	.string	"DEFIO_TAG_E__PF6 DEFIO_TAG_E__NONE"
+.LASF302:
+	.string	"__DEC32_MIN_EXP__ (-94)"
+.LASF909:
+	.string	"__DECL_SIMD_sinhf "
+.LASF1072:
+	.string	"__GLIBC_FLT_EVAL_METHOD __FLT_EVAL_METHOD__"
+.LASF854:
+	.string	"__DECL_SIMD_asinf128 "
+.LASF325:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_1 1"
+.LASF1537:
+	.string	"DEFIO_PORT_F_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT)"
+.LASF822:
+	.string	"__DECL_SIMD_powf32 "
+.LASF483:
+	.string	"__bos(ptr) __builtin_object_size (ptr, __USE_FORTIFY_LEVEL > 1)"
+.LASF1911:
+	.string	"BUS_SCRATCHPAD_MEMORY_SIZE (20)"
+.LASF953:
+	.string	"__DECL_SIMD_log2f64 "
+.LASF2007:
+	.string	"MODE_RXTX"
+.LASF838:
+	.string	"__DECL_SIMD_atan "
+.LASF884:
+	.string	"__DECL_SIMD_exp10f128 "
+.LASF1646:
+	.string	"DEFIO_REC__PC0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF58:
+	.string	"__UINT32_TYPE__ unsigned int"
+.LASF1115:
+	.string	"__MATHDECL_ALIAS"
+.LASF286:
+	.string	"__FLT64X_DIG__ 18"
+.LASF82:
+	.string	"__LONG_MAX__ 0x7fffffffffffffffL"
+.LASF1598:
+	.string	"DEFIO_REC__PB0 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(0) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1198:
+	.string	"USE_RANGEFINDER "
+.LASF1457:
+	.string	"METERS_TO_CENTIMETERS(m) (m * 100)"
+.LASF667:
+	.string	"UINT_FAST8_MAX (255)"
+.LASF1644:
+	.string	"DEFIO_TAG__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF872:
+	.string	"__DECL_SIMD_exp2f32 "
+.LASF1622:
+	.string	"DEFIO_REC__PB8 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(8) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF193:
+	.string	"__LDBL_MAX_10_EXP__ 4932"
+.LASF482:
+	.string	"__END_DECLS "
+.LASF1481:
+	.string	"ARRAYEND(x) (&(x)[ARRAYLEN(x)])"
+.LASF1917:
+	.string	"BUSDEV_REGISTER_I2C(_name,_devHw,_i2cBus,_devAddr,_irqPin,_flags,_param) BUSDEV_REGISTER_I2C_F(_name, _devHw, _i2cBus, _devAddr, _irqPin, 0, _flags, _param)"
+.LASF313:
+	.string	"__DEC64_EPSILON__ 1E-15DD"
+.LASF855:
+	.string	"__DECL_SIMD_asinf32x "
+.LASF1961:
+	.string	"OWNER_SDCARD"
+.LASF1627:
+	.string	"DEFIO_TAG_E__PB10 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 10)"
+.LASF958:
+	.string	"__DECL_SIMD_log1p "
+.LASF490:
+	.string	"__glibc_c99_flexarr_available 1"
+.LASF1030:
+	.string	"__DECL_SIMD_tanl "
+.LASF885:
+	.string	"__DECL_SIMD_exp10f32x "
+.LASF1866:
+	.string	"DEFIO_TAG__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF595:
+	.string	"__OFF_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF284:
+	.string	"__FLT32X_IS_IEC_60559__ 2"
+.LASF1145:
+	.string	"MATH_ERREXCEPT 2"
+.LASF1397:
+	.string	"DEBUG_SECTION_TIMES "
+.LASF1936:
+	.string	"int16_t"
+.LASF1564:
+	.string	"DEFIO_TAG_E__PA5 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 5)"
+.LASF263:
+	.string	"__FLT128_EPSILON__ 1.92592994438723585305597794258492732e-34F128"
+.LASF345:
+	.string	"__SIZEOF_INT128__ 16"
+.LASF1378:
+	.string	"FUNCTION_COMPILE_FOR_SIZE __attribute__((optimize(\"-Os\")))"
+.LASF1921:
+	.string	"short unsigned int"
+.LASF268:
+	.string	"__FLT128_IS_IEC_60559__ 2"
+.LASF1674:
+	.string	"DEFIO_TAG__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1924:
+	.string	"signed char"
+.LASF1058:
+	.string	"__HAVE_FLOATN_NOT_TYPEDEF 1"
+.LASF803:
+	.string	"__DECL_SIMD_logf64 "
+.LASF786:
+	.string	"__DECL_SIMD_sinf64x "
+.LASF1233:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_STORAGE "
+.LASF902:
+	.string	"__DECL_SIMD_expm1f32 "
+.LASF380:
+	.string	"SIMULATOR_BUILD 1"
+.LASF1273:
+	.string	"__size_t__ "
+.LASF447:
+	.string	"__USE_XOPEN2K 1"
+.LASF1131:
+	.string	"__MATH_TG_F64X(FUNC,ARGS) _Float64x: FUNC ## l ARGS,"
+.LASF1904:
+	.string	"BUS_SPI3 SPIDEV_3"
+.LASF1577:
+	.string	"DEFIO_REC__PA9 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(9) - 1)) + 0)"
+.LASF1437:
+	.string	"M_Ef 2.71828182845904523536f"
+.LASF1831:
+	.string	"DEFIO_TAG_E__PF14 DEFIO_TAG_E__NONE"
+.LASF1302:
+	.string	"_WCHAR_T_H "
+.LASF1687:
+	.string	"DEFIO_TAG_E__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF298:
+	.string	"__FLT64X_HAS_INFINITY__ 1"
+.LASF502:
+	.string	"__attribute_used__ __attribute__ ((__used__))"
+.LASF1864:
+	.string	"DEFIO_TAG_E__PG9 DEFIO_TAG_E__NONE"
+.LASF33:
+	.string	"__CHAR_BIT__ 8"
+.LASF2011:
+	.string	"SERIAL_INVERTED"
+.LASF982:
+	.string	"__DECL_SIMD_acoshf32 "
+.LASF986:
+	.string	"__DECL_SIMD_acoshf64x "
+.LASF1433:
+	.string	"sq(x) ((x)*(x))"
+.LASF782:
+	.string	"__DECL_SIMD_sinf32 "
+.LASF954:
+	.string	"__DECL_SIMD_log2f128 "
+.LASF675:
+	.string	"INTMAX_MAX (__INT64_C(9223372036854775807))"
+.LASF546:
+	.string	"__stub___compat_bdflush "
+.LASF2022:
+	.string	"count"
+.LASF1199:
+	.string	"USE_RANGEFINDER_MSP "
+.LASF1119:
+	.string	"__MATHCALL_NARROW_ARGS_2 (_Marg_ __x, _Marg_ __y)"
+.LASF384:
+	.string	"__FORKNAME__ \"inav\""
+.LASF1772:
+	.string	"DEFIO_REC__PE10 defio_error_PE10_is_not_supported_on_TARGET"
+.LASF1691:
+	.string	"DEFIO_REC__PC15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(15) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1496:
+	.string	"STATIC_ASSERT(condition,name) typedef char assert_failed_ ## name [(condition) ? 1 : -1 ] __attribute__((unused))"
+.LASF401:
+	.string	"_FEATURES_H 1"
+.LASF1060:
+	.string	"__f64(x) x ##f64"
+.LASF296:
+	.string	"__FLT64X_DENORM_MIN__ 3.64519953188247460252840593361941982e-4951F64x"
+.LASF1281:
+	.string	"_BSD_SIZE_T_ "
+.LASF520:
+	.string	"__va_arg_pack_len() __builtin_va_arg_pack_len ()"
+.LASF1790:
+	.string	"DEFIO_REC__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF504:
+	.string	"__attribute_deprecated__ __attribute__ ((__deprecated__))"
+.LASF1340:
+	.string	"USE_DASHBOARD"
+.LASF1253:
+	.string	"USE_VTX_FFPV "
+.LASF1889:
+	.string	"DMA_TAG(dma,stream,channel) ( (((dma) & 0x03) << 7) | (((stream) & 0x07) << 4) | (((channel) & 0x0F) << 0) )"
+.LASF1162:
+	.string	"isless(x,y) __builtin_isless(x, y)"
+.LASF54:
+	.string	"__INT32_TYPE__ int"
+.LASF1523:
+	.string	"DEFIO_PORT_B_USED_MASK TARGET_IO_PORTB"
+.LASF1498:
+	.string	"BX_(x) ((x) - (((x)>>1)&0x77777777) - (((x)>>2)&0x33333333) - (((x)>>3)&0x11111111))"
+.LASF1540:
+	.string	"DEFIO_PORT_G_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT)"
+.LASF950:
+	.string	"__DECL_SIMD_log2l "
+.LASF735:
+	.string	"__toupper_l(c,locale) __tobody (c, __toupper_l, (locale)->__ctype_toupper, (c, locale))"
+.LASF1284:
+	.string	"_BSD_SIZE_T_DEFINED_ "
+.LASF341:
+	.string	"__GCC_ATOMIC_POINTER_LOCK_FREE 2"
+.LASF545:
+	.string	"__USE_EXTERN_INLINES 1"
+.LASF1817:
+	.string	"DEFIO_REC__PF9 defio_error_PF9_is_not_supported_on_TARGET"
+.LASF596:
+	.string	"__OFF64_T_TYPE __SQUAD_TYPE"
+.LASF2113:
+	.string	"SERIAL_PORT_SOFTSERIAL1"
+.LASF2114:
+	.string	"SERIAL_PORT_SOFTSERIAL2"
+.LASF1223:
+	.string	"USE_ANTIGRAVITY "
+.LASF1769:
+	.string	"DEFIO_REC__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF226:
+	.string	"__FLT32_MAX_10_EXP__ 38"
+.LASF623:
+	.string	"__STATFS_MATCHES_STATFS64 1"
+.LASF1370:
+	.string	"UART5 ((USART_TypeDef *)0x0005)"
+.LASF1894:
+	.string	"DEFINE_DMA_CHANNEL(d,c,f) { .tag = DMA_TAG(d, 0, c), .dma = DMA ##d, .ref = DMA ##d ##_Channel ##c, .irqHandlerCallback = NULL, .flagsShift = f, .irqNumber = DMA ##d ##_Channel ##c ##_IRQn, .userParam = 0 }"
+.LASF247:
+	.string	"__FLT64_EPSILON__ 2.22044604925031308084726333618164062e-16F64"
+.LASF1368:
+	.string	"USART3 ((USART_TypeDef *)0x0003)"
+.LASF540:
+	.string	"__fortified_attr_access(a,o,s) __attr_access ((a, o, s))"
+.LASF1101:
+	.string	"__MATH_DECLARE_LDOUBLE 1"
+.LASF1603:
+	.string	"DEFIO_TAG_E__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF310:
+	.string	"__DEC64_MAX_EXP__ 385"
+.LASF2068:
+	.string	"FUNCTION_RX_SERIAL"
+.LASF1507:
+	.string	"ALWAYS_INLINE inline __attribute__ ((always_inline))"
+.LASF2142:
+	.string	"motionX"
+.LASF2143:
+	.string	"motionY"
+.LASF1251:
+	.string	"USE_VTX_SMARTAUDIO "
+.LASF96:
+	.string	"__WINT_WIDTH__ 32"
+.LASF1084:
+	.string	"__MATHDECL_1_IMPL(type,function,suffix,args) extern type __MATH_PRECNAME(function,suffix) args __THROW"
+.LASF1400:
+	.string	"PG_RESETDATA_ATTRIBUTES __attribute__ ((section(\"pg_resetdata\"), used, aligned(2)))"
+.LASF1954:
+	.string	"OWNER_SERIAL"
+.LASF1011:
+	.string	"__DECL_SIMD_asinhf16 "
+.LASF1261:
+	.string	"_ANSI_STDDEF_H "
+.LASF2149:
+	.string	"openSerialPort"
+.LASF1146:
+	.string	"math_errhandling (MATH_ERRNO | MATH_ERREXCEPT)"
+.LASF1169:
+	.string	"USE_I2C_PULLUP "
+.LASF794:
+	.string	"__DECL_SIMD_sincosf128 "
+.LASF1981:
+	.string	"OWNER_PINIO"
+.LASF1750:
+	.string	"DEFIO_TAG_E__PE3 DEFIO_TAG_E__NONE"
+.LASF1781:
+	.string	"DEFIO_REC__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF1614:
+	.string	"DEFIO_TAG__PB6 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 6)"
+.LASF1571:
+	.string	"DEFIO_REC__PA7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(7) - 1)) + 0)"
+.LASF1830:
+	.string	"DEFIO_TAG__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF1782:
+	.string	"DEFIO_TAG__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF926:
+	.string	"__DECL_SIMD_cbrtf64x "
+.LASF335:
+	.string	"__GCC_ATOMIC_INT_LOCK_FREE 2"
+.LASF132:
+	.string	"__UINT32_C(c) c ## U"
+.LASF241:
+	.string	"__FLT64_MAX_EXP__ 1024"
+.LASF139:
+	.string	"__INT_FAST32_MAX__ 0x7fffffffffffffffL"
+.LASF1315:
+	.string	"USBD_PRODUCT_STRING \"SITL\""
+.LASF1165:
+	.string	"isunordered(x,y) __builtin_isunordered(x, y)"
+.LASF322:
+	.string	"__REGISTER_PREFIX__ "
+.LASF2080:
+	.string	"FUNCTION_ESCSERIAL"
+.LASF1153:
+	.string	"M_PI_2 1.57079632679489661923"
+.LASF1424:
+	.string	"HZ2US(hz) (1000000 / (hz))"
+.LASF1532:
+	.string	"DEFIO_PORT_E_USED_MASK 0"
+.LASF1079:
+	.string	"__MATHDECL_VEC(type,function,suffix,args) __SIMD_DECL (__MATH_PRECNAME (function, suffix)) __MATHDECL(type, function,suffix, args)"
+.LASF819:
+	.string	"__DECL_SIMD_powf "
+.LASF535:
+	.string	"__REDIRECT_NTH_LDBL(name,proto,alias) __REDIRECT_NTH (name, proto, alias)"
+.LASF662:
+	.string	"INT_FAST64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF1174:
+	.string	"USE_SERIALRX_IBUS "
+.LASF1606:
+	.string	"DEFIO_TAG_E__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF1512:
+	.string	"DEFIO_REC(pinid) CONCAT(DEFIO_REC__, pinid)"
+.LASF10:
+	.string	"__VERSION__ \"12.2.0\""
+.LASF795:
+	.string	"__DECL_SIMD_sincosf32x "
+.LASF1723:
+	.string	"DEFIO_TAG_E__PD10 DEFIO_TAG_E__NONE"
+.LASF984:
+	.string	"__DECL_SIMD_acoshf128 "
+.LASF1059:
+	.string	"__f32(x) x ##f32"
+.LASF2044:
+	.string	"rxIrqCount"
+.LASF721:
+	.string	"isupper(c) __isctype((c), _ISupper)"
+.LASF1676:
+	.string	"DEFIO_REC__PC10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1402:
+	.string	"PG_FOREACH(_name) for (const pgRegistry_t *(_name) = __pg_registry_start; (_name) < __pg_registry_end; _name++)"
+.LASF590:
+	.string	"__INO_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF726:
+	.string	"isascii(c) __isascii (c)"
+.LASF1966:
+	.string	"OWNER_BARO"
+.LASF1135:
+	.string	"FP_ZERO 2"
+.LASF1395:
+	.string	"DEBUG32_VALUE_COUNT 8"
+.LASF589:
+	.string	"__GID_T_TYPE __U32_TYPE"
+.LASF761:
+	.string	"isupper_l(c,l) __isupper_l ((c), (l))"
+.LASF1733:
+	.string	"DEFIO_REC__PD13 defio_error_PD13_is_not_supported_on_TARGET"
+.LASF1476:
+	.string	"IOCFG_AF_OD 0"
+.LASF1898:
+	.string	"DMA_IT_TCIF ((uint32_t)0x00000002)"
+.LASF2017:
+	.string	"SERIAL_BIDIR"
+.LASF372:
+	.string	"__linux__ 1"
+.LASF1555:
+	.string	"DEFIO_TAG_E__PA2 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 2)"
+.LASF1329:
+	.string	"USE_UART8 "
+.LASF811:
+	.string	"__DECL_SIMD_expf16 "
+.LASF1351:
+	.string	"USE_TEMPERATURE_SENSOR"
+.LASF1538:
+	.string	"DEFIO_PORT_G_USED_MASK 0"
+.LASF539:
+	.string	"__attr_access(x) __attribute__ ((__access__ x))"
+.LASF2112:
+	.string	"SERIAL_PORT_USB_VCP"
+.LASF2081:
+	.string	"FUNCTION_TELEMETRY_SIM"
+.LASF1736:
+	.string	"DEFIO_REC__PD14 defio_error_PD14_is_not_supported_on_TARGET"
+.LASF480:
+	.string	"__ptr_t void *"
+.LASF1347:
+	.string	"USE_PITOT_MS4525"
+.LASF955:
+	.string	"__DECL_SIMD_log2f32x "
+.LASF1988:
+	.string	"RESOURCE_TIMER"
+.LASF579:
+	.string	"__SLONG32_TYPE int"
+.LASF6:
+	.string	"__STDC_HOSTED__ 1"
+.LASF2104:
+	.string	"SERIAL_PORT_USART1"
+.LASF2105:
+	.string	"SERIAL_PORT_USART2"
+.LASF2106:
+	.string	"SERIAL_PORT_USART3"
+.LASF2107:
+	.string	"SERIAL_PORT_USART4"
+.LASF2108:
+	.string	"SERIAL_PORT_USART5"
+.LASF2109:
+	.string	"SERIAL_PORT_USART6"
+.LASF2110:
+	.string	"SERIAL_PORT_USART7"
+.LASF2111:
+	.string	"SERIAL_PORT_USART8"
+.LASF353:
+	.string	"__SIZEOF_FLOAT80__ 16"
+.LASF2047:
+	.string	"serialTotalRxWaiting"
+.LASF1519:
+	.string	"DEFIO_TAG_PIN(tag) ((tag) & 0x0f)"
+.LASF1230:
+	.string	"USE_GPS_PROTO_NMEA "
+.LASF121:
+	.string	"__INT_LEAST32_MAX__ 0x7fffffff"
+.LASF225:
+	.string	"__FLT32_MAX_EXP__ 128"
+.LASF405:
+	.string	"__USE_ISOCXX11"
+.LASF1812:
+	.string	"DEFIO_TAG__PF8 defio_error_PF8_is_not_supported_on_TARGET"
+.LASF1429:
+	.string	"HZ2S(hz) US2S(HZ2US(hz))"
+.LASF1932:
+	.string	"long int"
+.LASF87:
+	.string	"__WINT_MIN__ 0U"
+.LASF1641:
+	.string	"DEFIO_TAG__PB15 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 15)"
+.LASF184:
+	.string	"__DBL_HAS_DENORM__ 1"
+.LASF951:
+	.string	"__DECL_SIMD_log2f16 "
+.LASF113:
+	.string	"__UINT32_MAX__ 0xffffffffU"
+.LASF242:
+	.string	"__FLT64_MAX_10_EXP__ 308"
+.LASF211:
+	.string	"__FLT16_DECIMAL_DIG__ 5"
+.LASF1907:
+	.string	"BUS_I2C2 I2CDEV_2"
+.LASF1530:
+	.string	"DEFIO_PORT_D_USED_COUNT 0"
+.LASF431:
+	.string	"__glibc_clang_prereq(maj,min) 0"
+.LASF1896:
+	.string	"DMA_CLEAR_FLAG(d,flag) d->dma->IFCR = (flag << d->flagsShift)"
+.LASF1234:
+	.string	"USE_TELEMETRY_HOTT "
+.LASF126:
+	.string	"__INT_LEAST64_WIDTH__ 64"
+.LASF1338:
+	.string	"USE_USB_MSC"
+.LASF635:
+	.string	"INT8_MIN (-128)"
+.LASF331:
+	.string	"__GCC_ATOMIC_CHAR16_T_LOCK_FREE 2"
+.LASF643:
+	.string	"UINT8_MAX (255)"
+.LASF1659:
+	.string	"DEFIO_TAG__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1955:
+	.string	"OWNER_PINDEBUG"
+.LASF1586:
+	.string	"DEFIO_REC__PA12 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(12) - 1)) + 0)"
+.LASF324:
+	.string	"__GNUC_STDC_INLINE__ 1"
+.LASF963:
+	.string	"__DECL_SIMD_log1pf64 "
+.LASF1853:
+	.string	"DEFIO_REC__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF279:
+	.string	"__FLT32X_EPSILON__ 2.22044604925031308084726333618164062e-16F32x"
+.LASF1439:
+	.string	"DEGREES_TO_CENTIDEGREES(angle) ((angle) * 100)"
+.LASF477:
+	.string	"__PMT(args) args"
+.LASF1546:
+	.string	"DEFIO_GPIOID__F 5"
+.LASF1266:
+	.string	"_PTRDIFF_T_ "
+.LASF383:
+	.string	"SITL 1"
+.LASF2092:
+	.string	"BAUD_38400"
+.LASF1494:
+	.string	"UNUSED(x) (void)(x)"
+.LASF652:
+	.string	"INT_LEAST16_MAX (32767)"
+.LASF246:
+	.string	"__FLT64_MIN__ 2.22507385850720138309023271733240406e-308F64"
+.LASF1265:
+	.string	"__PTRDIFF_T "
+.LASF389:
+	.string	"__STDC_IEC_60559_BFP__ 201404L"
+.LASF915:
+	.string	"__DECL_SIMD_sinhf32x "
+.LASF1686:
+	.string	"DEFIO_TAG__PC14 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 14)"
+.LASF1612:
+	.string	"DEFIO_TAG_E__PB5 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 5)"
+.LASF1083:
+	.string	"__MATHDECLX(type,function,suffix,args,attrib) __MATHDECL_1(type, function,suffix, args) __attribute__ (attrib); __MATHDECL_1(type, __CONCAT(__,function),suffix, args) __attribute__ (attrib)"
+.LASF84:
+	.string	"__WCHAR_MAX__ 0x7fffffff"
+.LASF1891:
+	.string	"DMATAG_GET_DMA(x) ( ((x) >> 7) & 0x03 )"
+.LASF1718:
+	.string	"DEFIO_REC__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF612:
+	.string	"__DADDR_T_TYPE __S32_TYPE"
+.LASF1813:
+	.string	"DEFIO_TAG_E__PF8 DEFIO_TAG_E__NONE"
+.LASF2004:
+	.string	"RESOURCE_TOTAL_COUNT"
+.LASF233:
+	.string	"__FLT32_HAS_DENORM__ 1"
+.LASF1482:
+	.string	"CONST_CAST(type,value) ((type)(value))"
+.LASF465:
+	.string	"_SYS_CDEFS_H 1"
+.LASF918:
+	.string	"__DECL_SIMD_cbrt "
+.LASF1491:
+	.string	"EXPAND_I(x) x"
+.LASF1662:
+	.string	"DEFIO_TAG__PC6 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 6)"
+.LASF1753:
+	.string	"DEFIO_TAG_E__PE4 DEFIO_TAG_E__NONE"
+.LASF1933:
+	.string	"__uint64_t"
+.LASF1089:
+	.string	"__MATH_PRECNAME(name,r) __CONCAT(name,r)"
+.LASF1940:
+	.string	"uint32_t"
+.LASF2025:
+	.string	"serialReceiveFrameCallbackPtr"
+.LASF1279:
+	.string	"__SIZE_T "
+.LASF617:
+	.string	"__FSID_T_TYPE struct { int __val[2]; }"
+.LASF1364:
+	.string	"U_ID_1 1"
+.LASF850:
+	.string	"__DECL_SIMD_asinl "
+.LASF1693:
+	.string	"DEFIO_TAG_E__PD0 DEFIO_TAG_E__NONE"
+.LASF2038:
+	.string	"rxBufferTail"
+.LASF1063:
+	.string	"__CFLOAT32 _Complex _Float32"
+.LASF1156:
+	.string	"M_2_PI 0.63661977236758134308"
+.LASF334:
+	.string	"__GCC_ATOMIC_SHORT_LOCK_FREE 2"
+.LASF1727:
+	.string	"DEFIO_REC__PD11 defio_error_PD11_is_not_supported_on_TARGET"
+.LASF1791:
+	.string	"DEFIO_TAG__PF1 defio_error_PF1_is_not_supported_on_TARGET"
+.LASF948:
+	.string	"__DECL_SIMD_log2 "
+.LASF1584:
+	.string	"DEFIO_TAG__PA12 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 12)"
+.LASF1306:
+	.string	"_WCHAR_T_DECLARED "
+.LASF1345:
+	.string	"USE_RANGEFINDER_VL53L0X"
+.LASF1313:
+	.string	"offsetof(TYPE,MEMBER) __builtin_offsetof (TYPE, MEMBER)"
+.LASF1377:
+	.string	"NOINLINE "
+.LASF600:
+	.string	"__BLKCNT_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF357:
+	.string	"__GCC_ASM_FLAG_OUTPUTS__ 1"
+.LASF616:
+	.string	"__BLKSIZE_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF40:
+	.string	"__SIZEOF_POINTER__ 8"
+.LASF1726:
+	.string	"DEFIO_TAG_E__PD11 DEFIO_TAG_E__NONE"
+.LASF1986:
+	.string	"RESOURCE_OUTPUT"
+.LASF261:
+	.string	"__FLT128_NORM_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1479:
+	.string	"IOCFG_IN_FLOATING 0"
+.LASF936:
+	.string	"__DECL_SIMD_atan2f64x "
+.LASF714:
+	.string	"iscntrl(c) __isctype((c), _IScntrl)"
+.LASF967:
+	.string	"__DECL_SIMD_log1pf128x "
+.LASF1278:
+	.string	"_T_SIZE "
+.LASF285:
+	.string	"__FLT64X_MANT_DIG__ 64"
+.LASF1064:
+	.string	"__CFLOAT64 _Complex _Float64"
+.LASF1118:
+	.string	"__MATHCALL_NARROW_ARGS_1 (_Marg_ __x)"
+.LASF977:
+	.string	"__DECL_SIMD_atanhf128x "
+.LASF2051:
+	.string	"isSerialTransmitBufferEmpty"
+.LASF444:
+	.string	"__USE_POSIX2 1"
+.LASF1006:
+	.string	"__DECL_SIMD_tanhf64x "
+.LASF1322:
+	.string	"USE_UART1 "
+.LASF495:
+	.string	"__ASMNAME2(prefix,cname) __STRING (prefix) cname"
+.LASF489:
+	.string	"__flexarr []"
+.LASF1066:
+	.string	"__CFLOAT64X _Complex _Float64x"
+.LASF430:
+	.string	"__GNUC_PREREQ(maj,min) ((__GNUC__ << 16) + __GNUC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF818:
+	.string	"__DECL_SIMD_pow "
+.LASF568:
+	.string	"_BITS_TYPES_H 1"
+.LASF250:
+	.string	"__FLT64_HAS_INFINITY__ 1"
+.LASF339:
+	.string	"__GCC_DESTRUCTIVE_SIZE 64"
+.LASF656:
+	.string	"UINT_LEAST16_MAX (65535)"
+.LASF1258:
+	.string	"USE_WIND_ESTIMATOR "
+.LASF1152:
+	.string	"M_PI 3.14159265358979323846"
+.LASF1389:
+	.string	"REQUIRE_CC_ARM_PRINTF_SUPPORT "
+.LASF491:
+	.string	"__REDIRECT(name,proto,alias) name proto __asm__ (__ASMNAME (#alias))"
+.LASF559:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X 0"
+.LASF1203:
+	.string	"USE_OPFLOW "
+.LASF1417:
+	.string	"PG_REGISTER_PROFILE(_type,_name,_pgn,_version) PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1295:
+	.string	"_T_WCHAR_ "
+.LASF359:
+	.string	"__k8__ 1"
+.LASF42:
+	.string	"__GNUC_WIDE_EXECUTION_CHARSET_NAME \"UTF-32LE\""
+.LASF3:
+	.string	"__STDC_VERSION__ 199901L"
+.LASF1229:
+	.string	"CMS_MENU_OSD "
+.LASF1602:
+	.string	"DEFIO_TAG__PB2 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 2)"
+.LASF649:
+	.string	"INT_LEAST32_MIN (-2147483647-1)"
+.LASF1422:
+	.string	"MILLISECS_PER_SEC 1000"
+.LASF441:
+	.string	"_POSIX_C_SOURCE"
+.LASF787:
+	.string	"__DECL_SIMD_sinf128x "
+.LASF2054:
+	.string	"isConnected"
+.LASF1711:
+	.string	"DEFIO_TAG_E__PD6 DEFIO_TAG_E__NONE"
+.LASF1381:
+	.string	"FILE_COMPILE_FOR_SIZE _Pragma(\"GCC optimize(\\\"Os\\\")\")"
+.LASF1307:
+	.string	"__DEFINED_wchar_t "
+.LASF1956:
+	.string	"OWNER_TIMER"
+.LASF571:
+	.string	"__S32_TYPE int"
+.LASF1164:
+	.string	"islessgreater(x,y) __builtin_islessgreater(x, y)"
+.LASF337:
+	.string	"__GCC_ATOMIC_LLONG_LOCK_FREE 2"
+.LASF1588:
+	.string	"DEFIO_TAG_E__PA13 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 13)"
+.LASF1785:
+	.string	"DEFIO_TAG__PE15 defio_error_PE15_is_not_supported_on_TARGET"
+.LASF354:
+	.string	"__SIZEOF_FLOAT128__ 16"
+.LASF140:
+	.string	"__INT_FAST32_WIDTH__ 64"
+.LASF1188:
+	.string	"USE_PITOT "
+.LASF1761:
+	.string	"DEFIO_TAG__PE7 defio_error_PE7_is_not_supported_on_TARGET"
+.LASF1178:
+	.string	"USE_64BIT_TIME "
+.LASF163:
+	.string	"__FLT_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF723:
+	.string	"isblank(c) __isctype((c), _ISblank)"
+.LASF94:
+	.string	"__LONG_LONG_WIDTH__ 64"
+.LASF1934:
+	.string	"char"
+.LASF1121:
+	.string	"__MATHCALL_NARROW_NORMAL(func,nargs) extern _Mret_ func __MATHCALL_NARROW_ARGS_ ## nargs __THROW"
+.LASF944:
+	.string	"__DECL_SIMD_log10f128 "
+.LASF1658:
+	.string	"DEFIO_REC__PC4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF591:
+	.string	"__INO64_T_TYPE __UQUAD_TYPE"
+.LASF552:
+	.string	"__stub_sigreturn "
+.LASF1004:
+	.string	"__DECL_SIMD_tanhf128 "
+.LASF1052:
+	.string	"__HAVE_DISTINCT_FLOAT32 0"
+.LASF1595:
+	.string	"DEFIO_REC__PA15 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(15) - 1)) + 0)"
+.LASF1856:
+	.string	"DEFIO_REC__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF1742:
+	.string	"DEFIO_REC__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF774:
+	.string	"__DECL_SIMD_cosf128 "
+.LASF65:
+	.string	"__UINT_LEAST16_TYPE__ short unsigned int"
+.LASF1446:
+	.string	"DEGREES_TO_DEKADEGREES(angle) ((angle) / DEGREES_PER_DEKADEGREE)"
+.LASF941:
+	.string	"__DECL_SIMD_log10f16 "
+.LASF203:
+	.string	"__LDBL_HAS_QUIET_NAN__ 1"
+.LASF569:
+	.string	"__S16_TYPE short int"
+.LASF858:
+	.string	"__DECL_SIMD_hypot "
+.LASF738:
+	.string	"__isalnum_l(c,l) __isctype_l((c), _ISalnum, (l))"
+.LASF1074:
+	.string	"__FP_LOGBNAN_IS_MIN 1"
+.LASF1737:
+	.string	"DEFIO_TAG__PD15 defio_error_PD15_is_not_supported_on_TARGET"
+.LASF248:
+	.string	"__FLT64_DENORM_MIN__ 4.94065645841246544176568792868221372e-324F64"
+.LASF1275:
+	.string	"_SIZE_T "
+.LASF898:
+	.string	"__DECL_SIMD_expm1 "
+.LASF442:
+	.string	"_POSIX_C_SOURCE 200809L"
+.LASF508:
+	.string	"__attribute_nonnull__(params) __attribute__ ((__nonnull__ params))"
+.LASF1236:
+	.string	"USE_TELEMETRY_MAVLINK "
+.LASF773:
+	.string	"__DECL_SIMD_cosf64 "
+.LASF945:
+	.string	"__DECL_SIMD_log10f32x "
+.LASF837:
+	.string	"__DECL_SIMD_acosf128x "
+.LASF1393:
+	.string	"STATIC_FASTRAM static FASTRAM"
+.LASF1570:
+	.string	"DEFIO_TAG_E__PA7 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 7)"
+.LASF2103:
+	.string	"SERIAL_PORT_NONE"
+.LASF631:
+	.string	"__WCHAR_MIN __WCHAR_MIN__"
+.LASF1906:
+	.string	"BUS_I2C1 I2CDEV_1"
+.LASF1456:
+	.string	"CENTIMETERS_TO_METERS(cm) (cm / 100)"
+.LASF1240:
+	.string	"USE_RX_MSP "
+.LASF1721:
+	.string	"DEFIO_REC__PD9 defio_error_PD9_is_not_supported_on_TARGET"
+.LASF1483:
+	.string	"CONCAT_HELPER(x,y) x ## y"
+.LASF1464:
+	.string	"_ABS_II(x,var) ( __extension__ ({ __typeof__(x) var = (x); var < 0 ? -var : var; }))"
+.LASF2139:
+	.string	"bufferPtr"
+.LASF2156:
+	.string	"cxofOpflowInit"
+.LASF1756:
+	.string	"DEFIO_TAG_E__PE5 DEFIO_TAG_E__NONE"
+.LASF775:
+	.string	"__DECL_SIMD_cosf32x "
+.LASF515:
+	.string	"__attribute_artificial__ __attribute__ ((__artificial__))"
+.LASF216:
+	.string	"__FLT16_DENORM_MIN__ 5.96046447753906250000000000000000000e-8F16"
+.LASF1202:
+	.string	"USE_RANGEFINDER_HCSR04_I2C "
+.LASF829:
+	.string	"__DECL_SIMD_acosf "
+.LASF603:
+	.string	"__FSBLKCNT64_T_TYPE __UQUAD_TYPE"
+.LASF1283:
+	.string	"_SIZE_T_DEFINED "
+.LASF199:
+	.string	"__LDBL_EPSILON__ 1.08420217248550443400745280086994171e-19L"
+.LASF219:
+	.string	"__FLT16_HAS_QUIET_NAN__ 1"
+.LASF260:
+	.string	"__FLT128_MAX__ 1.18973149535723176508575932662800702e+4932F128"
+.LASF1696:
+	.string	"DEFIO_TAG_E__PD1 DEFIO_TAG_E__NONE"
+.LASF815:
+	.string	"__DECL_SIMD_expf32x "
+.LASF1208:
+	.string	"USE_1WIRE_DS2482 "
+.LASF1154:
+	.string	"M_PI_4 0.78539816339744830962"
+.LASF628:
+	.string	"__STD_TYPE"
+.LASF1452:
+	.string	"RADIANS_TO_CENTIDEGREES(angle) (((angle) * 100.0f) / RAD)"
+.LASF614:
+	.string	"__CLOCKID_T_TYPE __S32_TYPE"
+.LASF2141:
+	.string	"res0"
+.LASF658:
+	.string	"UINT_LEAST64_MAX (__UINT64_C(18446744073709551615))"
+.LASF397:
+	.string	"__bool_true_false_are_defined 1"
+.LASF586:
+	.string	"__SYSCALL_ULONG_TYPE __ULONGWORD_TYPE"
+.LASF497:
+	.string	"__attribute_alloc_size__(params) __attribute__ ((__alloc_size__ params))"
+.LASF1047:
+	.string	"__HAVE_FLOAT32 1"
+.LASF71:
+	.string	"__INT_FAST64_TYPE__ long int"
+.LASF1290:
+	.string	"__size_t "
+.LASF1980:
+	.string	"OWNER_OLED_DISPLAY"
+.LASF1645:
+	.string	"DEFIO_TAG_E__PC0 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 0)"
+.LASF2084:
+	.string	"FUNCTION_SERVO_SERIAL"
+.LASF1573:
+	.string	"DEFIO_TAG_E__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF26:
+	.string	"__SIZEOF_LONG__ 8"
+.LASF188:
+	.string	"__LDBL_MANT_DIG__ 64"
+.LASF741:
+	.string	"__isdigit_l(c,l) __isctype_l((c), _ISdigit, (l))"
+.LASF1024:
+	.string	"__DECL_SIMD_erfcf128 "
+.LASF853:
+	.string	"__DECL_SIMD_asinf64 "
+.LASF75:
+	.string	"__UINT_FAST64_TYPE__ long unsigned int"
+.LASF2102:
+	.string	"BAUD_2470000"
+.LASF148:
+	.string	"__INTPTR_WIDTH__ 64"
+.LASF36:
+	.string	"__ORDER_BIG_ENDIAN__ 4321"
+.LASF1009:
+	.string	"__DECL_SIMD_asinhf "
+.LASF370:
+	.string	"__gnu_linux__ 1"
+.LASF985:
+	.string	"__DECL_SIMD_acoshf32x "
+.LASF2138:
+	.string	"buffer"
+.LASF326:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_2 1"
+.LASF297:
+	.string	"__FLT64X_HAS_DENORM__ 1"
+.LASF1173:
+	.string	"USE_SERIALRX_SBUS "
+.LASF638:
+	.string	"INT64_MIN (-__INT64_C(9223372036854775807)-1)"
+.LASF105:
+	.string	"__SIG_ATOMIC_MIN__ (-__SIG_ATOMIC_MAX__ - 1)"
+.LASF1623:
+	.string	"DEFIO_TAG__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF501:
+	.string	"__attribute_maybe_unused__ __attribute__ ((__unused__))"
+.LASF1386:
+	.string	"STATIC_INLINE_UNIT_TESTED static inline"
+.LASF542:
+	.string	"__attr_dealloc(dealloc,argno) __attribute__ ((__malloc__ (dealloc, argno)))"
+.LASF395:
+	.string	"true 1"
+.LASF1503:
+	.string	"container_of(ptr,type,member) ( __extension__ ({ const typeof( ((type *)0)->member ) *__mptr = (ptr); (type *)( (char *)__mptr - offsetof(type,member) );}))"
+.LASF390:
+	.string	"__STDC_IEC_559_COMPLEX__ 1"
+.LASF683:
+	.string	"WCHAR_MAX __WCHAR_MAX"
+.LASF531:
+	.string	"__LDBL_REDIR_NTH(name,proto) name proto __THROW"
+.LASF1421:
+	.string	"TIMEUS_MAX UINT64_MAX"
+.LASF1025:
+	.string	"__DECL_SIMD_erfcf32x "
+.LASF879:
+	.string	"__DECL_SIMD_exp10f "
+.LASF812:
+	.string	"__DECL_SIMD_expf32 "
+.LASF1601:
+	.string	"DEFIO_REC__PB1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1639:
+	.string	"DEFIO_TAG_E__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF516:
+	.string	"__extern_inline extern __inline __attribute__ ((__gnu_inline__))"
+.LASF1722:
+	.string	"DEFIO_TAG__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF1992:
+	.string	"RESOURCE_EXTI"
+.LASF1309:
+	.string	"__need_wchar_t"
+.LASF162:
+	.string	"__FLT_DECIMAL_DIG__ 9"
+.LASF672:
+	.string	"INTPTR_MAX (9223372036854775807L)"
+.LASF1510:
+	.string	"DEFIO_TAG_E(pinid) CONCAT(DEFIO_TAG_E__, pinid)"
+.LASF1068:
+	.string	"HUGE_VALF (__builtin_huge_valf ())"
+.LASF1264:
+	.string	"_T_PTRDIFF "
+.LASF843:
+	.string	"__DECL_SIMD_atanf64 "
+.LASF448:
+	.string	"__USE_XOPEN2K8 1"
+.LASF1035:
+	.string	"__DECL_SIMD_tanf32x "
+.LASF978:
+	.string	"__DECL_SIMD_acosh "
+.LASF1034:
+	.string	"__DECL_SIMD_tanf128 "
+.LASF1983:
+	.string	"OWNER_TOTAL_COUNT"
+.LASF1905:
+	.string	"BUS_SPI4 SPIDEV_4"
+.LASF557:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT 0"
+.LASF1181:
+	.string	"USE_GPS_PROTO_UBLOX "
+.LASF1672:
+	.string	"DEFIO_TAG_E__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF371:
+	.string	"__linux 1"
+.LASF970:
+	.string	"__DECL_SIMD_atanhl "
+.LASF1130:
+	.string	"__MATH_TG_F32(FUNC,ARGS) _Float32: FUNC ## f ARGS,"
+.LASF1828:
+	.string	"DEFIO_TAG_E__PF13 DEFIO_TAG_E__NONE"
+.LASF1764:
+	.string	"DEFIO_TAG__PE8 defio_error_PE8_is_not_supported_on_TARGET"
+.LASF464:
+	.string	"__GLIBC_PREREQ(maj,min) ((__GLIBC__ << 16) + __GLIBC_MINOR__ >= ((maj) << 16) + (min))"
+.LASF1163:
+	.string	"islessequal(x,y) __builtin_islessequal(x, y)"
+.LASF1710:
+	.string	"DEFIO_TAG__PD6 defio_error_PD6_is_not_supported_on_TARGET"
+.LASF264:
+	.string	"__FLT128_DENORM_MIN__ 6.47517511943802511092443895822764655e-4966F128"
+.LASF1133:
+	.string	"FP_NAN 0"
+.LASF22:
+	.string	"__FINITE_MATH_ONLY__ 0"
+.LASF544:
+	.string	"__attribute_returns_twice__ __attribute__ ((__returns_twice__))"
+.LASF1055:
+	.string	"__HAVE_DISTINCT_FLOAT64X 0"
+.LASF1235:
+	.string	"USE_TELEMETRY_IBUS "
+.LASF19:
+	.string	"__pie__ 2"
+.LASF457:
+	.string	"__USE_FORTIFY_LEVEL 0"
+.LASF935:
+	.string	"__DECL_SIMD_atan2f32x "
+.LASF1192:
+	.string	"USE_GYRO_KALMAN "
+.LASF891:
+	.string	"__DECL_SIMD_coshf16 "
+.LASF988:
+	.string	"__DECL_SIMD_erf "
+.LASF1149:
+	.string	"M_LOG10E 0.43429448190325182765"
+.LASF2117:
+	.string	"serialPortConfig_s"
+.LASF2123:
+	.string	"serialPortConfig_t"
+.LASF711:
+	.string	"__tobody(c,f,a,args) (__extension__ ({ int __res; if (sizeof (c) > 1) { if (__builtin_constant_p (c)) { int __c = (c); __res = __c < -128 || __c > 255 ? __c : (a)[__c]; } else __res = f args; } else __res = (a)[(int) (c)]; __res; }))"
+.LASF1684:
+	.string	"DEFIO_TAG_E__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF1859:
+	.string	"DEFIO_REC__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF450:
+	.string	"_ATFILE_SOURCE 1"
+.LASF1081:
+	.string	"__MATHDECL(type,function,suffix,args) __MATHDECL_1(type, function,suffix, args); __MATHDECL_1(type, __CONCAT(__,function),suffix, args)"
+.LASF742:
+	.string	"__islower_l(c,l) __isctype_l((c), _ISlower, (l))"
+.LASF804:
+	.string	"__DECL_SIMD_logf128 "
+.LASF1525:
+	.string	"DEFIO_PORT_B_OFFSET (DEFIO_PORT_A_USED_COUNT)"
+.LASF1867:
+	.string	"DEFIO_TAG_E__PG10 DEFIO_TAG_E__NONE"
+.LASF2145:
+	.string	"squal"
+.LASF517:
+	.string	"__extern_always_inline extern __always_inline __attribute__ ((__gnu_inline__))"
+.LASF2013:
+	.string	"SERIAL_STOPBITS_2"
+.LASF1023:
+	.string	"__DECL_SIMD_erfcf64 "
+.LASF289:
+	.string	"__FLT64X_MAX_EXP__ 16384"
+.LASF1428:
+	.string	"MS2S(ms) ((ms) * 1e-3f)"
+.LASF1678:
+	.string	"DEFIO_TAG_E__PC11 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 11)"
+.LASF484:
+	.string	"__bos0(ptr) __builtin_object_size (ptr, 0)"
+.LASF291:
+	.string	"__FLT64X_DECIMAL_DIG__ 21"
+.LASF703:
+	.string	"__BYTE_ORDER __LITTLE_ENDIAN"
+.LASF377:
+	.string	"__ELF__ 1"
+.LASF1892:
+	.string	"DMATAG_GET_STREAM(x) ( ((x) >> 4) & 0x07 )"
+.LASF828:
+	.string	"__DECL_SIMD_acos "
+.LASF427:
+	.string	"__GLIBC_USE_DEPRECATED_GETS"
+.LASF238:
+	.string	"__FLT64_DIG__ 15"
+.LASF329:
+	.string	"__GCC_ATOMIC_BOOL_LOCK_FREE 2"
+.LASF312:
+	.string	"__DEC64_MAX__ 9.999999999999999E384DD"
+.LASF899:
+	.string	"__DECL_SIMD_expm1f "
+.LASF578:
+	.string	"__UWORD_TYPE unsigned long int"
+.LASF1699:
+	.string	"DEFIO_TAG_E__PD2 DEFIO_TAG_E__NONE"
+.LASF805:
+	.string	"__DECL_SIMD_logf32x "
+.LASF1411:
+	.string	"PG_REGISTER_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1501:
+	.string	"LOG2_32BIT(v) (16*((v)>65535L) + LOG2_16BIT((v)*1L >>16*((v)>65535L)))"
+.LASF419:
+	.string	"__USE_FILE_OFFSET64"
+.LASF181:
+	.string	"__DBL_MIN__ ((double)2.22507385850720138309023271733240406e-308L)"
+.LASF1834:
+	.string	"DEFIO_TAG_E__PF15 DEFIO_TAG_E__NONE"
+.LASF1147:
+	.string	"M_E 2.7182818284590452354"
+.LASF1186:
+	.string	"SCHEDULER_DELAY_LIMIT 100"
+.LASF993:
+	.string	"__DECL_SIMD_erff64 "
+.LASF1160:
+	.string	"isgreater(x,y) __builtin_isgreater(x, y)"
+.LASF1732:
+	.string	"DEFIO_TAG_E__PD13 DEFIO_TAG_E__NONE"
+.LASF717:
+	.string	"isgraph(c) __isctype((c), _ISgraph)"
+.LASF1775:
+	.string	"DEFIO_REC__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF1943:
+	.string	"double"
+.LASF1344:
+	.string	"USE_RANGEFINDER"
+.LASF1631:
+	.string	"DEFIO_REC__PB11 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(11) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF218:
+	.string	"__FLT16_HAS_INFINITY__ 1"
+.LASF831:
+	.string	"__DECL_SIMD_acosf16 "
+.LASF764:
+	.string	"isascii_l(c,l) __isascii_l ((c), (l))"
+.LASF1513:
+	.string	"DEFIO_REC__NONE NULL"
+.LASF1497:
+	.string	"BITCOUNT(x) (((BX_(x)+(BX_(x)>>4)) & 0x0F0F0F0F) % 255)"
+.LASF601:
+	.string	"__BLKCNT64_T_TYPE __SQUAD_TYPE"
+.LASF701:
+	.string	"__PDP_ENDIAN 3412"
+.LASF1087:
+	.string	"__MATHREDIR(type,function,suffix,args,to) extern type __REDIRECT_NTH (__MATH_PRECNAME (function, suffix), args, to)"
+.LASF1536:
+	.string	"DEFIO_PORT_F_USED_COUNT 0"
+.LASF104:
+	.string	"__SIG_ATOMIC_MAX__ 0x7fffffff"
+.LASF1500:
+	.string	"LOG2_16BIT(v) (8*((v)>255) + LOG2_8BIT((v) >>8*((v)>255)))"
+.LASF1559:
+	.string	"DEFIO_REC__PA3 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(3) - 1)) + 0)"
+.LASF30:
+	.string	"__SIZEOF_DOUBLE__ 8"
+.LASF704:
+	.string	"__FLOAT_WORD_ORDER __BYTE_ORDER"
+.LASF1001:
+	.string	"__DECL_SIMD_tanhf16 "
+.LASF2075:
+	.string	"FUNCTION_UAV_INTERCONNECT"
+.LASF611:
+	.string	"__SUSECONDS64_T_TYPE __SQUAD_TYPE"
+.LASF386:
+	.string	"__REVISION__ \"60f400f\""
+.LASF257:
+	.string	"__FLT128_MAX_EXP__ 16384"
+.LASF1005:
+	.string	"__DECL_SIMD_tanhf32x "
+.LASF438:
+	.string	"__USE_POSIX_IMPLICITLY 1"
+.LASF230:
+	.string	"__FLT32_MIN__ 1.17549435082228750796873653722224568e-38F32"
+.LASF1299:
+	.string	"_BSD_WCHAR_T_ "
+.LASF876:
+	.string	"__DECL_SIMD_exp2f64x "
+.LASF1442:
+	.string	"DECIDEGREES_TO_CENTIDEGREES(angle) ((angle) * 10)"
+.LASF1168:
+	.string	"I2C2_OVERCLOCK false"
+.LASF2135:
+	.string	"opflowCxofVtable"
+.LASF654:
+	.string	"INT_LEAST64_MAX (__INT64_C(9223372036854775807))"
+.LASF1572:
+	.string	"DEFIO_TAG__PA8 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 8)"
+.LASF1373:
+	.string	"UART8 ((USART_TypeDef *)0x0008)"
+.LASF503:
+	.string	"__attribute_noinline__ __attribute__ ((__noinline__))"
+.LASF1148:
+	.string	"M_LOG2E 1.4426950408889634074"
+.LASF1827:
+	.string	"DEFIO_TAG__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF1675:
+	.string	"DEFIO_TAG_E__PC10 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 10)"
+.LASF1930:
+	.string	"__int32_t"
+.LASF1075:
+	.string	"FP_ILOGB0 (-2147483647 - 1)"
+.LASF1142:
+	.string	"isnan(x) __builtin_isnan (x)"
+.LASF2016:
+	.string	"SERIAL_UNIDIR"
+.LASF1931:
+	.string	"__uint32_t"
+.LASF839:
+	.string	"__DECL_SIMD_atanf "
+.LASF1899:
+	.string	"DMA_IT_HTIF ((uint32_t)0x00000004)"
+.LASF423:
+	.string	"__USE_GNU"
+.LASF245:
+	.string	"__FLT64_NORM_MAX__ 1.79769313486231570814527423731704357e+308F64"
+.LASF1016:
+	.string	"__DECL_SIMD_asinhf64x "
+.LASF407:
+	.string	"__USE_POSIX2"
+.LASF2021:
+	.string	"data"
+.LASF1788:
+	.string	"DEFIO_TAG__PF0 defio_error_PF0_is_not_supported_on_TARGET"
+.LASF1888:
+	.string	"I2C_TIMEOUT (10000)"
+.LASF21:
+	.string	"__OPTIMIZE__ 1"
+.LASF913:
+	.string	"__DECL_SIMD_sinhf64 "
+.LASF2134:
+	.string	"baudRates"
+.LASF1558:
+	.string	"DEFIO_TAG_E__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1916:
+	.string	"BUSDEV_REGISTER_SPI_TAG(_name,_devHw,_spiBus,_csnPin,_irqPin,_tag,_flags,_param) BUSDEV_REGISTER_SPI_F(_name, _devHw, _spiBus, _csnPin, _irqPin, _tag, _flags, _param)"
+.LASF1314:
+	.string	"TARGET_BOARD_IDENTIFIER \"SITL\""
+.LASF1578:
+	.string	"DEFIO_TAG__PA10 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 10)"
+.LASF2098:
+	.string	"BAUD_921600"
+.LASF2055:
+	.string	"isIdle"
+.LASF1944:
+	.string	"timeDelta_t"
+.LASF1962:
+	.string	"OWNER_FLASH"
+.LASF830:
+	.string	"__DECL_SIMD_acosl "
+.LASF1868:
+	.string	"DEFIO_REC__PG10 defio_error_PG10_is_not_supported_on_TARGET"
+.LASF420:
+	.string	"__USE_MISC"
+.LASF1562:
+	.string	"DEFIO_REC__PA4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(4) - 1)) + 0)"
+.LASF360:
+	.string	"__code_model_small__ 1"
+.LASF2116:
+	.string	"serialPortIdentifier_e"
+.LASF577:
+	.string	"__SWORD_TYPE long int"
+.LASF206:
+	.string	"__FLT16_DIG__ 3"
+.LASF1854:
+	.string	"DEFIO_TAG__PG6 defio_error_PG6_is_not_supported_on_TARGET"
+.LASF414:
+	.string	"__USE_XOPEN2KXSI"
+.LASF1767:
+	.string	"DEFIO_TAG__PE9 defio_error_PE9_is_not_supported_on_TARGET"
+.LASF669:
+	.string	"UINT_FAST32_MAX (18446744073709551615UL)"
+.LASF2042:
+	.string	"rxCallbackData"
+.LASF1170:
+	.string	"USE_RX_PPM "
+.LASF1214:
+	.string	"DASHBOARD_ARMED_BITMAP "
+.LASF966:
+	.string	"__DECL_SIMD_log1pf64x "
+.LASF15:
+	.string	"__ATOMIC_ACQ_REL 4"
+.LASF2119:
+	.string	"msp_baudrateIndex"
+.LASF705:
+	.string	"__LONG_LONG_PAIR(HI,LO) LO, HI"
+.LASF2036:
+	.string	"txBuffer"
+.LASF1250:
+	.string	"USE_VTX_CONTROL "
+.LASF751:
+	.string	"__toascii_l(c,l) ((l), __toascii (c))"
+.LASF825:
+	.string	"__DECL_SIMD_powf32x "
+.LASF1289:
+	.string	"_SIZET_ "
+.LASF52:
+	.string	"__INT8_TYPE__ signed char"
+.LASF1779:
+	.string	"DEFIO_TAG__PE13 defio_error_PE13_is_not_supported_on_TARGET"
+.LASF644:
+	.string	"UINT16_MAX (65535)"
+.LASF366:
+	.string	"__SSE2_MATH__ 1"
+.LASF327:
+	.string	"__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4 1"
+.LASF1621:
+	.string	"DEFIO_TAG_E__PB8 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 8)"
+.LASF361:
+	.string	"__MMX__ 1"
+.LASF619:
+	.string	"__CPU_MASK_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1260:
+	.string	"_STDDEF_H_ "
+.LASF1517:
+	.string	"DEFIO_TAG_ISEMPTY(tag) (!(tag))"
+.LASF627:
+	.string	"__TIME64_T_TYPE __TIME_T_TYPE"
+.LASF848:
+	.string	"__DECL_SIMD_asin "
+.LASF1884:
+	.string	"DEFIO_IO_USED_COUNT (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT+DEFIO_PORT_D_USED_COUNT+DEFIO_PORT_E_USED_COUNT+DEFIO_PORT_F_USED_COUNT+DEFIO_PORT_G_USED_COUNT)"
+.LASF1553:
+	.string	"DEFIO_REC__PA1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(1) - 1)) + 0)"
+.LASF584:
+	.string	"_BITS_TYPESIZES_H 1"
+.LASF1638:
+	.string	"DEFIO_TAG__PB14 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 14)"
+.LASF607:
+	.string	"__CLOCK_T_TYPE __SYSCALL_SLONG_TYPE"
+.LASF1754:
+	.string	"DEFIO_REC__PE4 defio_error_PE4_is_not_supported_on_TARGET"
+.LASF239:
+	.string	"__FLT64_MIN_EXP__ (-1021)"
+.LASF1117:
+	.string	"__MATHCALL"
+.LASF942:
+	.string	"__DECL_SIMD_log10f32 "
+.LASF1762:
+	.string	"DEFIO_TAG_E__PE7 DEFIO_TAG_E__NONE"
+.LASF1010:
+	.string	"__DECL_SIMD_asinhl "
+.LASF1972:
+	.string	"OWNER_TX"
+.LASF691:
+	.string	"UINT16_C(c) c"
+.LASF890:
+	.string	"__DECL_SIMD_coshl "
+.LASF728:
+	.string	"_tolower(c) ((int) (*__ctype_tolower_loc ())[(int) (c)])"
+.LASF1597:
+	.string	"DEFIO_TAG_E__PB0 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 0)"
+.LASF1227:
+	.string	"USE_STATS "
+.LASF1320:
+	.string	"USE_MAG "
+.LASF1979:
+	.string	"OWNER_AIRSPEED"
+.LASF1671:
+	.string	"DEFIO_TAG__PC9 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 9)"
+.LASF677:
+	.string	"PTRDIFF_MIN (-9223372036854775807L-1)"
+.LASF1702:
+	.string	"DEFIO_TAG_E__PD3 DEFIO_TAG_E__NONE"
+.LASF364:
+	.string	"__FXSR__ 1"
+.LASF995:
+	.string	"__DECL_SIMD_erff32x "
+.LASF68:
+	.string	"__INT_FAST8_TYPE__ signed char"
+.LASF968:
+	.string	"__DECL_SIMD_atanh "
+.LASF781:
+	.string	"__DECL_SIMD_sinf16 "
+.LASF1773:
+	.string	"DEFIO_TAG__PE11 defio_error_PE11_is_not_supported_on_TARGET"
+.LASF750:
+	.string	"__isascii_l(c,l) ((l), __isascii (c))"
+.LASF1076:
+	.string	"FP_ILOGBNAN (-2147483647 - 1)"
+.LASF408:
+	.string	"__USE_POSIX199309"
+.LASF679:
+	.string	"SIG_ATOMIC_MIN (-2147483647-1)"
+.LASF1919:
+	.string	"CXOF_PACKET_SIZE 9"
+.LASF880:
+	.string	"__DECL_SIMD_exp10l "
+.LASF1759:
+	.string	"DEFIO_TAG_E__PE6 DEFIO_TAG_E__NONE"
+.LASF369:
+	.string	"__SEG_GS 1"
+.LASF1430:
+	.string	"FORMATTED_DATE_TIME_BUFSIZE 30"
+.LASF1557:
+	.string	"DEFIO_TAG__PA3 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 3)"
+.LASF1735:
+	.string	"DEFIO_TAG_E__PD14 DEFIO_TAG_E__NONE"
+.LASF271:
+	.string	"__FLT32X_MIN_EXP__ (-1021)"
+.LASF1624:
+	.string	"DEFIO_TAG_E__PB9 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 9)"
+.LASF1267:
+	.string	"_BSD_PTRDIFF_T_ "
+.LASF1297:
+	.string	"__WCHAR_T "
+.LASF2094:
+	.string	"BAUD_115200"
+.LASF1745:
+	.string	"DEFIO_REC__PE1 defio_error_PE1_is_not_supported_on_TARGET"
+.LASF1548:
+	.string	"DEFIO_TAG__PA0 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 0)"
+.LASF560:
+	.string	"__GLIBC_USE_IEC_60559_EXT"
+.LASF2045:
+	.string	"serialPortVTable"
+.LASF388:
+	.string	"__STDC_IEC_559__ 1"
+.LASF897:
+	.string	"__DECL_SIMD_coshf128x "
+.LASF1683:
+	.string	"DEFIO_TAG__PC13 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 13)"
+.LASF859:
+	.string	"__DECL_SIMD_hypotf "
+.LASF355:
+	.string	"__ATOMIC_HLE_ACQUIRE 65536"
+.LASF311:
+	.string	"__DEC64_MIN__ 1E-383DD"
+.LASF793:
+	.string	"__DECL_SIMD_sincosf64 "
+.LASF119:
+	.string	"__INT16_C(c) c"
+.LASF2012:
+	.string	"SERIAL_STOPBITS_1"
+.LASF2063:
+	.string	"FUNCTION_GPS"
+.LASF844:
+	.string	"__DECL_SIMD_atanf128 "
+.LASF1136:
+	.string	"FP_SUBNORMAL 3"
+.LASF2008:
+	.string	"portMode_t"
+.LASF1054:
+	.string	"__HAVE_DISTINCT_FLOAT32X 0"
+.LASF375:
+	.string	"__unix__ 1"
+.LASF1111:
+	.string	"_Mdouble_ _Float64x"
+.LASF1945:
+	.string	"timeUs_t"
+.LASF266:
+	.string	"__FLT128_HAS_INFINITY__ 1"
+.LASF1363:
+	.string	"U_ID_0 0"
+.LASF28:
+	.string	"__SIZEOF_SHORT__ 2"
+.LASF937:
+	.string	"__DECL_SIMD_atan2f128x "
+.LASF624:
+	.string	"__KERNEL_OLD_TIMEVAL_MATCHES_TIMEVAL64 1"
+.LASF73:
+	.string	"__UINT_FAST16_TYPE__ long unsigned int"
+.LASF93:
+	.string	"__LONG_WIDTH__ 64"
+.LASF823:
+	.string	"__DECL_SIMD_powf64 "
+.LASF2070:
+	.string	"FUNCTION_TELEMETRY_MAVLINK"
+.LASF111:
+	.string	"__UINT8_MAX__ 0xff"
+.LASF789:
+	.string	"__DECL_SIMD_sincosf "
+.LASF1508:
+	.string	"DEFIO_TAG(pinid) CONCAT(DEFIO_TAG__, pinid)"
+.LASF1755:
+	.string	"DEFIO_TAG__PE5 defio_error_PE5_is_not_supported_on_TARGET"
+.LASF1039:
+	.string	"__HAVE_FLOAT128 1"
+.LASF740:
+	.string	"__iscntrl_l(c,l) __isctype_l((c), _IScntrl, (l))"
+.LASF1832:
+	.string	"DEFIO_REC__PF14 defio_error_PF14_is_not_supported_on_TARGET"
+.LASF69:
+	.string	"__INT_FAST16_TYPE__ long int"
+.LASF845:
+	.string	"__DECL_SIMD_atanf32x "
+.LASF1167:
+	.string	"I2C1_OVERCLOCK false"
+.LASF143:
+	.string	"__UINT_FAST8_MAX__ 0xff"
+.LASF439:
+	.string	"_POSIX_SOURCE"
+.LASF873:
+	.string	"__DECL_SIMD_exp2f64 "
+.LASF2160:
+	.string	"cxofOpflowUpdate"
+.LASF1431:
+	.string	"TIME_SECTION_BEGIN(index) { extern timeUs_t sectionTimes[2][4]; sectionTimes[0][index] = micros(); }"
+.LASF481:
+	.string	"__BEGIN_DECLS "
+.LASF869:
+	.string	"__DECL_SIMD_exp2f "
+.LASF521:
+	.string	"__restrict_arr __restrict"
+.LASF785:
+	.string	"__DECL_SIMD_sinf32x "
+.LASF690:
+	.string	"UINT8_C(c) c"
+.LASF398:
+	.string	"_STDINT_H 1"
+.LASF435:
+	.string	"__GLIBC_USE_ISOC2X 0"
+.LASF347:
+	.string	"__SIZEOF_WINT_T__ 4"
+.LASF1067:
+	.string	"HUGE_VAL (__builtin_huge_val ())"
+.LASF1413:
+	.string	"PG_REGISTER_ARRAY(_type,_size,_name,_pgn,_version) PG_REGISTER_ARRAY_I(_type, _size, _name, _pgn, _version, .reset = {.ptr = 0})"
+.LASF1197:
+	.string	"USE_GPS_PROTO_NAZA "
+.LASF1038:
+	.string	"_BITS_FLOATN_H "
+.LASF243:
+	.string	"__FLT64_DECIMAL_DIG__ 17"
+.LASF2024:
+	.string	"serialReceiveCallbackPtr"
+.LASF1851:
+	.string	"DEFIO_TAG__PG5 defio_error_PG5_is_not_supported_on_TARGET"
+.LASF1222:
+	.string	"USE_D_BOOST "
+.LASF212:
+	.string	"__FLT16_MAX__ 6.55040000000000000000000000000000000e+4F16"
+.LASF446:
+	.string	"__USE_POSIX199506 1"
+.LASF923:
+	.string	"__DECL_SIMD_cbrtf64 "
+.LASF727:
+	.string	"toascii(c) __toascii (c)"
+.LASF231:
+	.string	"__FLT32_EPSILON__ 1.19209289550781250000000000000000000e-7F32"
+.LASF134:
+	.string	"__UINT64_C(c) c ## UL"
+.LASF16:
+	.string	"__ATOMIC_CONSUME 1"
+.LASF2088:
+	.string	"BAUD_2400"
+.LASF1102:
+	.string	"_Mdouble_ _Float32"
+.LASF550:
+	.string	"__stub_revoke "
+.LASF61:
+	.string	"__INT_LEAST16_TYPE__ short int"
+.LASF522:
+	.string	"__glibc_unlikely(cond) __builtin_expect ((cond), 0)"
+.LASF1535:
+	.string	"DEFIO_PORT_F_USED_MASK 0"
+.LASF1810:
+	.string	"DEFIO_TAG_E__PF7 DEFIO_TAG_E__NONE"
+.LASF1341:
+	.string	"USE_OLED_UG2864"
+.LASF588:
+	.string	"__UID_T_TYPE __U32_TYPE"
+.LASF1391:
+	.string	"FASTRAM __attribute__ ((section(\".fastram_bss\"), aligned(4)))"
+.LASF991:
+	.string	"__DECL_SIMD_erff16 "
+.LASF1419:
+	.string	"PG_REGISTER_PROFILE_WITH_RESET_TEMPLATE(_type,_name,_pgn,_version) extern const _type pgResetTemplate_ ## _name; PG_REGISTER_PROFILE_I(_type, _name, _pgn, _version, .reset = {.ptr = (void*)&pgResetTemplate_ ## _name})"
+.LASF1257:
+	.string	"RTC_AUTOMATIC_DST "
+.LASF1379:
+	.string	"FUNCTION_COMPILE_NORMAL __attribute__((optimize(\"-O2\")))"
+.LASF1334:
+	.string	"TARGET_IO_PORTA 0xffff"
+.LASF1999:
+	.string	"RESOURCE_ADC_CH1"
+.LASF2000:
+	.string	"RESOURCE_ADC_CH2"
+.LASF2001:
+	.string	"RESOURCE_ADC_CH3"
+.LASF2002:
+	.string	"RESOURCE_ADC_CH4"
+.LASF896:
+	.string	"__DECL_SIMD_coshf64x "
+.LASF1241:
+	.string	"USE_SERIALRX_SUMD "
+.LASF333:
+	.string	"__GCC_ATOMIC_WCHAR_T_LOCK_FREE 2"
+.LASF1697:
+	.string	"DEFIO_REC__PD1 defio_error_PD1_is_not_supported_on_TARGET"
+.LASF1716:
+	.string	"DEFIO_TAG__PD8 defio_error_PD8_is_not_supported_on_TARGET"
+.LASF713:
+	.string	"isalpha(c) __isctype((c), _ISalpha)"
+.LASF62:
+	.string	"__INT_LEAST32_TYPE__ int"
+.LASF1717:
+	.string	"DEFIO_TAG_E__PD8 DEFIO_TAG_E__NONE"
+.LASF2018:
+	.string	"SERIAL_BIDIR_OD"
+.LASF470:
+	.string	"__LEAF , __leaf__"
+.LASF1007:
+	.string	"__DECL_SIMD_tanhf128x "
+.LASF348:
+	.string	"__SIZEOF_PTRDIFF_T__ 8"
+.LASF878:
+	.string	"__DECL_SIMD_exp10 "
+.LASF1049:
+	.string	"__HAVE_FLOAT32X 1"
+.LASF710:
+	.string	"__exctype(name) extern int name (int) __THROW"
+.LASF451:
+	.string	"__WORDSIZE 64"
+.LASF278:
+	.string	"__FLT32X_MIN__ 2.22507385850720138309023271733240406e-308F32x"
+.LASF618:
+	.string	"__SSIZE_T_TYPE __SWORD_TYPE"
+.LASF892:
+	.string	"__DECL_SIMD_coshf32 "
+.LASF866:
+	.string	"__DECL_SIMD_hypotf64x "
+.LASF983:
+	.string	"__DECL_SIMD_acoshf64 "
+.LASF283:
+	.string	"__FLT32X_HAS_QUIET_NAN__ 1"
+.LASF1458:
+	.string	"_CHOOSE2(binoper,lexpr,lvar,rexpr,rvar) ( __extension__ ({ __typeof__(lexpr) lvar = (lexpr); __typeof__(rexpr) rvar = (rexpr); lvar binoper rvar ? lvar : rvar; }))"
+.LASF783:
+	.string	"__DECL_SIMD_sinf64 "
+.LASF41:
+	.string	"__GNUC_EXECUTION_CHARSET_NAME \"UTF-8\""
+.LASF449:
+	.string	"_ATFILE_SOURCE"
+.LASF1247:
+	.string	"USE_SERIAL_PASSTHROUGH "
+.LASF1207:
+	.string	"USE_1WIRE "
+.LASF999:
+	.string	"__DECL_SIMD_tanhf "
+.LASF1811:
+	.string	"DEFIO_REC__PF7 defio_error_PF7_is_not_supported_on_TARGET"
+.LASF1900:
+	.string	"DMA_IT_TEIF ((uint32_t)0x00000008)"
+.LASF543:
+	.string	"__attr_dealloc_free __attr_dealloc (__builtin_free, 1)"
+.LASF1031:
+	.string	"__DECL_SIMD_tanf16 "
+.LASF174:
+	.string	"__DBL_MIN_EXP__ (-1021)"
+.LASF459:
+	.string	"__GLIBC_USE_DEPRECATED_SCANF 0"
+.LASF1705:
+	.string	"DEFIO_TAG_E__PD4 DEFIO_TAG_E__NONE"
+.LASF1568:
+	.string	"DEFIO_REC__PA6 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_A_USED_MASK & (BIT(6) - 1)) + 0)"
+.LASF2027:
+	.string	"serialPort_s"
+.LASF2059:
+	.string	"serialPort_t"
+.LASF1948:
+	.string	"OWNER_PWMINPUT"
+.LASF564:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X"
+.LASF1056:
+	.string	"__HAVE_DISTINCT_FLOAT128X __HAVE_FLOAT128X"
+.LASF1652:
+	.string	"DEFIO_REC__PC2 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(2) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF883:
+	.string	"__DECL_SIMD_exp10f64 "
+.LASF2086:
+	.string	"BAUD_AUTO"
+.LASF2048:
+	.string	"serialTotalTxFree"
+.LASF826:
+	.string	"__DECL_SIMD_powf64x "
+.LASF776:
+	.string	"__DECL_SIMD_cosf64x "
+.LASF1488:
+	.string	"CONCAT4(x,y,z,w) CONCAT4_HELPER(x, y, z, w)"
+.LASF1738:
+	.string	"DEFIO_TAG_E__PD15 DEFIO_TAG_E__NONE"
+.LASF1387:
+	.string	"INLINE_UNIT_TESTED inline"
+.LASF2126:
+	.string	"flowRateRaw"
+.LASF440:
+	.string	"_POSIX_SOURCE 1"
+.LASF840:
+	.string	"__DECL_SIMD_atanl "
+.LASF2019:
+	.string	"SERIAL_BIDIR_PP"
+.LASF1441:
+	.string	"CENTIDEGREES_TO_DECIDEGREES(angle) ((angle) / 10)"
+.LASF1019:
+	.string	"__DECL_SIMD_erfcf "
+.LASF1465:
+	.string	"_ABS_I(x,var) _ABS_II(x, var)"
+.LASF1890:
+	.string	"DMA_NONE (0)"
+.LASF2140:
+	.string	"header"
+.LASF305:
+	.string	"__DEC32_MAX__ 9.999999E96DF"
+.LASF676:
+	.string	"UINTMAX_MAX (__UINT64_C(18446744073709551615))"
+.LASF394:
+	.string	"bool _Bool"
+.LASF1268:
+	.string	"___int_ptrdiff_t_h "
+.LASF267:
+	.string	"__FLT128_HAS_QUIET_NAN__ 1"
+.LASF1552:
+	.string	"DEFIO_TAG_E__PA1 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 1)"
+.LASF971:
+	.string	"__DECL_SIMD_atanhf16 "
+.LASF524:
+	.string	"__attribute_nonstring__ __attribute__ ((__nonstring__))"
+.LASF615:
+	.string	"__TIMER_T_TYPE void *"
+.LASF732:
+	.string	"__isctype_l(c,type,locale) ((locale)->__ctype_b[(int) (c)] & (unsigned short int) type)"
+.LASF994:
+	.string	"__DECL_SIMD_erff128 "
+.LASF877:
+	.string	"__DECL_SIMD_exp2f128x "
+.LASF2072:
+	.string	"FUNCTION_RCDEVICE"
+.LASF911:
+	.string	"__DECL_SIMD_sinhf16 "
+.LASF1575:
+	.string	"DEFIO_TAG__PA9 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 9)"
+.LASF768:
+	.string	"__DECL_SIMD_cos "
+.LASF1179:
+	.string	"USE_BLACKBOX "
+.LASF1872:
+	.string	"DEFIO_TAG__PG12 defio_error_PG12_is_not_supported_on_TARGET"
+.LASF832:
+	.string	"__DECL_SIMD_acosf32 "
+.LASF1436:
+	.string	"M_LN2f 0.69314718055994530942f"
+.LASF281:
+	.string	"__FLT32X_HAS_DENORM__ 1"
+.LASF1526:
+	.string	"DEFIO_PORT_C_USED_MASK TARGET_IO_PORTC"
+.LASF2148:
+	.string	"findSerialPortConfig"
+.LASF235:
+	.string	"__FLT32_HAS_QUIET_NAN__ 1"
+.LASF919:
+	.string	"__DECL_SIMD_cbrtf "
+.LASF1183:
+	.string	"USE_TELEMETRY "
+.LASF820:
+	.string	"__DECL_SIMD_powl "
+.LASF461:
+	.string	"__GNU_LIBRARY__ 6"
+.LASF1628:
+	.string	"DEFIO_REC__PB10 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(10) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF303:
+	.string	"__DEC32_MAX_EXP__ 97"
+.LASF605:
+	.string	"__FSFILCNT64_T_TYPE __UQUAD_TYPE"
+.LASF684:
+	.string	"WINT_MIN (0u)"
+.LASF1469:
+	.string	"RESOURCE_INDEX(x) (x + 1)"
+.LASF1473:
+	.string	"IOCFG_OUT_PP 0"
+.LASF1002:
+	.string	"__DECL_SIMD_tanhf32 "
+.LASF1211:
+	.string	"USE_TEMPERATURE_DS18B20 "
+.LASF1808:
+	.string	"DEFIO_REC__PF6 defio_error_PF6_is_not_supported_on_TARGET"
+.LASF1336:
+	.string	"TARGET_IO_PORTC 0xffff"
+.LASF1105:
+	.string	"_Mdouble_ _Float64"
+.LASF321:
+	.string	"__DEC128_SUBNORMAL_MIN__ 0.000000000000000000000000000000001E-6143DL"
+.LASF1359:
+	.string	"USE_SERIAL_PASSTHROUGH"
+.LASF722:
+	.string	"isxdigit(c) __isctype((c), _ISxdigit)"
+.LASF1795:
+	.string	"DEFIO_TAG_E__PF2 DEFIO_TAG_E__NONE"
+.LASF207:
+	.string	"__FLT16_MIN_EXP__ (-13)"
+.LASF1777:
+	.string	"DEFIO_TAG_E__PE12 DEFIO_TAG_E__NONE"
+.LASF1112:
+	.string	"__MATH_PRECNAME(name,r) name ##f64x ##r"
+.LASF1286:
+	.string	"__DEFINED_size_t "
+.LASF2146:
+	.string	"footer"
+.LASF1460:
+	.string	"_CHOOSE_VAR(prefix,unique) _CHOOSE_VAR2(prefix, unique)"
+.LASF1533:
+	.string	"DEFIO_PORT_E_USED_COUNT 0"
+.LASF1531:
+	.string	"DEFIO_PORT_D_OFFSET (DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT+DEFIO_PORT_C_USED_COUNT)"
+.LASF1220:
+	.string	"NAV_NON_VOLATILE_WAYPOINT_CLI "
+.LASF1829:
+	.string	"DEFIO_REC__PF13 defio_error_PF13_is_not_supported_on_TARGET"
+.LASF2032:
+	.string	"baudRate"
+.LASF1996:
+	.string	"RESOURCE_SPI_MOSI"
+.LASF1959:
+	.string	"OWNER_SPI"
+.LASF112:
+	.string	"__UINT16_MAX__ 0xffff"
+.LASF1440:
+	.string	"CENTIDEGREES_TO_DEGREES(angle) ((angle) / 100)"
+.LASF1740:
+	.string	"DEFIO_TAG__PE0 defio_error_PE0_is_not_supported_on_TARGET"
+.LASF1800:
+	.string	"DEFIO_TAG__PF4 defio_error_PF4_is_not_supported_on_TARGET"
+.LASF759:
+	.string	"ispunct_l(c,l) __ispunct_l ((c), (l))"
+.LASF505:
+	.string	"__attribute_deprecated_msg__(msg) __attribute__ ((__deprecated__ (msg)))"
+.LASF1649:
+	.string	"DEFIO_REC__PC1 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(1) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF179:
+	.string	"__DBL_MAX__ ((double)1.79769313486231570814527423731704357e+308L)"
+.LASF2043:
+	.string	"rxFrameCallback"
+.LASF1218:
+	.string	"USE_FRSKYOSD "
+.LASF2015:
+	.string	"SERIAL_PARITY_EVEN"
+.LASF1605:
+	.string	"DEFIO_TAG__PB3 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 3)"
+.LASF602:
+	.string	"__FSBLKCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF362:
+	.string	"__SSE__ 1"
+.LASF186:
+	.string	"__DBL_HAS_QUIET_NAN__ 1"
+.LASF724:
+	.string	"tolower(c) __tobody (c, tolower, *__ctype_tolower_loc (), (c))"
+.LASF301:
+	.string	"__DEC32_MANT_DIG__ 7"
+.LASF421:
+	.string	"__USE_ATFILE"
+.LASF167:
+	.string	"__FLT_DENORM_MIN__ 1.40129846432481707092372958328991613e-45F"
+.LASF1159:
+	.string	"M_SQRT1_2 0.70710678118654752440"
+.LASF1751:
+	.string	"DEFIO_REC__PE3 defio_error_PE3_is_not_supported_on_TARGET"
+.LASF2071:
+	.string	"FUNCTION_TELEMETRY_IBUS"
+.LASF1280:
+	.string	"_SIZE_T_ "
+.LASF272:
+	.string	"__FLT32X_MIN_10_EXP__ (-307)"
+.LASF1636:
+	.string	"DEFIO_TAG_E__PB13 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 13)"
+.LASF1330:
+	.string	"SERIAL_PORT_COUNT 8"
+.LASF1914:
+	.ascii	"BUSDEV_REGISTER_I2C_F(_name,_devHw,_i2cBus,_devAddr,_irqPin,"
+	.ascii	"_tag,_flags,_param) extern const busDeviceDescriptor_t _name"
+	.ascii	" ## _registry; static busDevice_t _name ## _memory; const bu"
+	.ascii	"sDeviceDescriptor_t _name ## _registry BUSDEV_RE"
+	.string	"GISTER_ATTRIBUTES = { .devicePtr = (void *) & _name ## _memory, .busType = BUSTYPE_I2C, .devHwType = _devHw, .flags = _flags, .tag = _tag, .param = _param, .busdev.i2c = { .i2cBus = _i2cBus, .address = _devAddr }, .irqPin = IO_TAG(_irqPin) }; struct _dummy"
+.LASF374:
+	.string	"__unix 1"
+.LASF527:
+	.string	"__LDOUBLE_REDIRECTS_TO_FLOAT128_ABI 0"
+.LASF860:
+	.string	"__DECL_SIMD_hypotl "
+.LASF202:
+	.string	"__LDBL_HAS_INFINITY__ 1"
+.LASF771:
+	.string	"__DECL_SIMD_cosf16 "
+.LASF1242:
+	.string	"USE_SERIALRX_SUMH "
+.LASF507:
+	.string	"__attribute_format_strfmon__(a,b) __attribute__ ((__format__ (__strfmon__, a, b)))"
+.LASF1172:
+	.string	"USE_SERIALRX_SPEKTRUM "
+.LASF1509:
+	.string	"DEFIO_TAG__NONE 0"
+.LASF1969:
+	.string	"OWNER_LED_STRIP"
+.LASF1768:
+	.string	"DEFIO_TAG_E__PE9 DEFIO_TAG_E__NONE"
+.LASF765:
+	.string	"toascii_l(c,l) __toascii_l ((c), (l))"
+.LASF1323:
+	.string	"USE_UART2 "
+.LASF426:
+	.string	"__GLIBC_USE_ISOC2X"
+.LASF563:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT 0"
+.LASF561:
+	.string	"__GLIBC_USE_IEC_60559_EXT 0"
+.LASF678:
+	.string	"PTRDIFF_MAX (9223372036854775807L)"
+.LASF164:
+	.string	"__FLT_NORM_MAX__ 3.40282346638528859811704183484516925e+38F"
+.LASF1403:
+	.string	"PG_FOREACH_PROFILE(_name) PG_FOREACH(_name) if (pgIsSystem(_name)) continue; else"
+.LASF928:
+	.string	"__DECL_SIMD_atan2 "
+.LASF1708:
+	.string	"DEFIO_TAG_E__PD5 DEFIO_TAG_E__NONE"
+.LASF287:
+	.string	"__FLT64X_MIN_EXP__ (-16381)"
+.LASF1885:
+	.string	"DEFIO_PORT_USED_COUNT 3"
+.LASF314:
+	.string	"__DEC64_SUBNORMAL_MIN__ 0.000000000000001E-383DD"
+.LASF31:
+	.string	"__SIZEOF_LONG_DOUBLE__ 16"
+.LASF1760:
+	.string	"DEFIO_REC__PE6 defio_error_PE6_is_not_supported_on_TARGET"
+.LASF790:
+	.string	"__DECL_SIMD_sincosl "
+.LASF730:
+	.string	"_BITS_TYPES_LOCALE_T_H 1"
+.LASF1876:
+	.string	"DEFIO_TAG_E__PG13 DEFIO_TAG_E__NONE"
+.LASF604:
+	.string	"__FSFILCNT_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF1073:
+	.string	"__FP_LOGB0_IS_MIN 1"
+.LASF1070:
+	.string	"INFINITY (__builtin_inff ())"
+.LASF249:
+	.string	"__FLT64_HAS_DENORM__ 1"
+.LASF1784:
+	.string	"DEFIO_REC__PE14 defio_error_PE14_is_not_supported_on_TARGET"
+.LASF259:
+	.string	"__FLT128_DECIMAL_DIG__ 36"
+.LASF168:
+	.string	"__FLT_HAS_DENORM__ 1"
+.LASF1928:
+	.string	"short int"
+.LASF636:
+	.string	"INT16_MIN (-32767-1)"
+.LASF1449:
+	.string	"RADIANS_TO_DEGREES(angle) ((angle) / RAD)"
+.LASF597:
+	.string	"__PID_T_TYPE __S32_TYPE"
+.LASF1660:
+	.string	"DEFIO_TAG_E__PC5 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 5)"
+.LASF1681:
+	.string	"DEFIO_TAG_E__PC12 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 12)"
+.LASF870:
+	.string	"__DECL_SIMD_exp2l "
+.LASF340:
+	.string	"__GCC_CONSTRUCTIVE_SIZE 64"
+.LASF1324:
+	.string	"USE_UART3 "
+.LASF1445:
+	.string	"DEGREES_PER_DEKADEGREE 10"
+.LASF1085:
+	.string	"__MATHDECL_1(type,function,suffix,args) __MATHDECL_1_IMPL(type, function, suffix, args)"
+.LASF385:
+	.string	"__TARGET__ \"SITL\""
+.LASF1383:
+	.string	"FILE_COMPILE_FOR_SPEED _Pragma(\"GCC optimize(\\\"Ofast\\\")\")"
+.LASF1925:
+	.string	"__int8_t"
+.LASF196:
+	.string	"__LDBL_MAX__ 1.18973149535723176502126385303097021e+4932L"
+.LASF1527:
+	.string	"DEFIO_PORT_C_USED_COUNT BITCOUNT(DEFIO_PORT_C_USED_MASK)"
+.LASF1729:
+	.string	"DEFIO_TAG_E__PD12 DEFIO_TAG_E__NONE"
+.LASF29:
+	.string	"__SIZEOF_FLOAT__ 4"
+.LASF1485:
+	.string	"CONCAT3_HELPER(x,y,z) x ## y ## z"
+.LASF320:
+	.string	"__DEC128_EPSILON__ 1E-33DL"
+.LASF1274:
+	.string	"__SIZE_T__ "
+.LASF1408:
+	.ascii	"PG_REGISTER_I(_type,_name,_pgn,_version,_reset) _type _name "
+	.ascii	"## _System; _type _name ## _Copy; extern const pgRegistry_t "
+	.string	"_name ## _Registry; const pgRegistry_t _name ##_Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_SYSTEM_FLAG, .address = (uint8_t*)&_name ## _System, .copy = (uint8_t*)&_name ## _Copy, .ptr = 0, _reset, }"
+.LASF1249:
+	.string	"USE_RCDEVICE "
+.LASF1358:
+	.string	"USE_RCDEVICE"
+.LASF1453:
+	.string	"CENTIDEGREES_TO_RADIANS(angle) (((angle) / 100.0f) * RAD)"
+.LASF64:
+	.string	"__UINT_LEAST8_TYPE__ unsigned char"
+.LASF593:
+	.string	"__NLINK_T_TYPE __SYSCALL_ULONG_TYPE"
+.LASF392:
+	.string	"__STDC_ISO_10646__ 201706L"
+.LASF191:
+	.string	"__LDBL_MIN_10_EXP__ (-4931)"
+.LASF487:
+	.string	"__warnattr(msg) __attribute__((__warning__ (msg)))"
+.LASF479:
+	.string	"__STRING(x) #x"
+.LASF1346:
+	.string	"USE_RANGEFINDER_HCSR04_I2C"
+.LASF1399:
+	.string	"PG_REGISTER_ATTRIBUTES __attribute__ ((section(\"pg_registry\"), used, aligned(4)))"
+.LASF1903:
+	.string	"BUS_SPI2 SPIDEV_2"
+.LASF1610:
+	.string	"DEFIO_REC__PB4 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(4) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1438:
+	.string	"RAD (M_PIf / 180.0f)"
+.LASF49:
+	.string	"__CHAR16_TYPE__ short unsigned int"
+.LASF2093:
+	.string	"BAUD_57600"
+.LASF1922:
+	.string	"unsigned int"
+.LASF1325:
+	.string	"USE_UART4 "
+.LASF862:
+	.string	"__DECL_SIMD_hypotf32 "
+.LASF1027:
+	.string	"__DECL_SIMD_erfcf128x "
+.LASF1688:
+	.string	"DEFIO_REC__PC14 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_C_USED_MASK & (BIT(14) - 1)) + DEFIO_PORT_A_USED_COUNT+DEFIO_PORT_B_USED_COUNT)"
+.LASF1132:
+	.string	"__MATH_TG(TG_ARG,FUNC,ARGS) _Generic ((TG_ARG), float: FUNC ## f ARGS, __MATH_TG_F32 (FUNC, ARGS) default: FUNC ARGS, long double: FUNC ## l ARGS, __MATH_TG_F64X (FUNC, ARGS) _Float128: FUNC ## f128 ARGS)"
+.LASF1511:
+	.string	"DEFIO_TAG_E__NONE 0"
+.LASF500:
+	.string	"__attribute_const__ __attribute__ ((__const__))"
+.LASF565:
+	.string	"__GLIBC_USE_IEC_60559_FUNCS_EXT_C2X 0"
+.LASF1780:
+	.string	"DEFIO_TAG_E__PE13 DEFIO_TAG_E__NONE"
+.LASF1095:
+	.string	"__MATH_DECLARING_FLOATN"
+.LASF929:
+	.string	"__DECL_SIMD_atan2f "
+.LASF788:
+	.string	"__DECL_SIMD_sincos "
+.LASF1818:
+	.string	"DEFIO_TAG__PF10 defio_error_PF10_is_not_supported_on_TARGET"
+.LASF1000:
+	.string	"__DECL_SIMD_tanhl "
+.LASF165:
+	.string	"__FLT_MIN__ 1.17549435082228750796873653722224568e-38F"
+.LASF1237:
+	.string	"USE_TELEMETRY_SMARTPORT "
+.LASF585:
+	.string	"__SYSCALL_SLONG_TYPE __SLONGWORD_TYPE"
+.LASF463:
+	.string	"__GLIBC_MINOR__ 36"
+.LASF43:
+	.string	"__SIZE_TYPE__ long unsigned int"
+.LASF192:
+	.string	"__LDBL_MAX_EXP__ 16384"
+.LASF1416:
+	.ascii	"PG_REGISTER_PROFILE_I(_type,_name,_pgn,_version,_reset) STAT"
+	.ascii	"IC_UNIT_TESTED _type _name ## _Storage[MAX_PROFILE_COUNT]; S"
+	.ascii	"TATIC_UNIT_TESTED _type _name ## _CopyStorage[MAX_PROFILE_CO"
+	.ascii	"UNT]; _PG_PROFILE_CURRENT_DECL(_type, _name) extern const pg"
+	.ascii	"Registry_t _name ## _Registry; const pgRegistry_t _name #"
+	.string	"# _Registry PG_REGISTER_ATTRIBUTES = { .pgn = _pgn | (_version << 12), .size = sizeof(_type) | PGR_SIZE_PROFILE_FLAG, .address = (uint8_t*)&_name ## _Storage, .copy = (uint8_t*)&_name ## _CopyStorage, .ptr = (uint8_t **)&_name ## _ProfileCurrent, _reset, }"
+.LASF1953:
+	.string	"OWNER_ADC"
+.LASF881:
+	.string	"__DECL_SIMD_exp10f16 "
+.LASF367:
+	.string	"__MMX_WITH_SSE__ 1"
+.LASF1730:
+	.string	"DEFIO_REC__PD12 defio_error_PD12_is_not_supported_on_TARGET"
+.LASF1196:
+	.string	"USE_HOTT_TEXTMODE "
+.LASF779:
+	.string	"__DECL_SIMD_sinf "
+.LASF931:
+	.string	"__DECL_SIMD_atan2f16 "
+.LASF814:
+	.string	"__DECL_SIMD_expf128 "
+.LASF4:
+	.string	"__STDC_UTF_16__ 1"
+.LASF1619:
+	.string	"DEFIO_REC__PB7 DEFIO_REC_INDEXED(BITCOUNT(DEFIO_PORT_B_USED_MASK & (BIT(7) - 1)) + DEFIO_PORT_A_USED_COUNT)"
+.LASF1836:
+	.string	"DEFIO_TAG__PG0 defio_error_PG0_is_not_supported_on_TARGET"
+.LASF1647:
+	.string	"DEFIO_TAG__PC1 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 1)"
+.LASF1857:
+	.string	"DEFIO_TAG__PG7 defio_error_PG7_is_not_supported_on_TARGET"
+.LASF1786:
+	.string	"DEFIO_TAG_E__PE15 DEFIO_TAG_E__NONE"
+.LASF23:
+	.string	"_LP64 1"
+.LASF1326:
+	.string	"USE_UART5 "
+.LASF1803:
+	.string	"DEFIO_TAG__PF5 defio_error_PF5_is_not_supported_on_TARGET"
+.LASF581:
+	.string	"__S64_TYPE long int"
+.LASF1113:
+	.string	"__MATHDECL_1_IMPL"
+.LASF145:
+	.string	"__UINT_FAST32_MAX__ 0xffffffffffffffffUL"
+.LASF1991:
+	.string	"RESOURCE_UART_TXRX"
+.LASF379:
+	.string	"DEBUG 1"
+.LASF1020:
+	.string	"__DECL_SIMD_erfcl "
+.LASF1701:
+	.string	"DEFIO_TAG__PD3 defio_error_PD3_is_not_supported_on_TARGET"
+.LASF1342:
+	.string	"USE_PWM_DRIVER_PCA9685"
+.LASF1392:
+	.string	"EXTENDED_FASTRAM "
+.LASF136:
+	.string	"__INT_FAST8_WIDTH__ 8"
+.LASF102:
+	.string	"__UINTMAX_C(c) c ## UL"
+.LASF1600:
+	.string	"DEFIO_TAG_E__PB1 DEFIO_TAG_MAKE(DEFIO_GPIOID__B, 1)"
+.LASF2159:
+	.string	"micros"
+.LASF2031:
+	.string	"options"
+.LASF1561:
+	.string	"DEFIO_TAG_E__PA4 DEFIO_TAG_MAKE(DEFIO_GPIOID__A, 4)"
+.LASF1372:
+	.string	"UART7 ((USART_TypeDef *)0x0007)"
+.LASF2151:
+	.string	"constrain"
+.LASF44:
+	.string	"__PTRDIFF_TYPE__ long int"
+.LASF1844:
+	.string	"DEFIO_REC__PG2 defio_error_PG2_is_not_supported_on_TARGET"
+.LASF1271:
+	.string	"__DEFINED_ptrdiff_t "
+.LASF1405:
+	.string	"PG_DECLARE(_type,_name) extern _type _name ## _System; extern _type _name ## _Copy; static inline const _type* _name(void) { return &_name ## _System; } static inline _type* _name ## Mutable(void) { return &_name ## _System; } struct _dummy"
+.LASF127:
+	.string	"__UINT_LEAST8_MAX__ 0xff"
+.LASF229:
+	.string	"__FLT32_NORM_MAX__ 3.40282346638528859811704183484516925e+38F32"
+.LASF1724:
+	.string	"DEFIO_REC__PD10 defio_error_PD10_is_not_supported_on_TARGET"
+.LASF558:
+	.string	"__GLIBC_USE_IEC_60559_BFP_EXT_C2X"
+.LASF437:
+	.string	"__USE_ISOC95 1"
+.LASF908:
+	.string	"__DECL_SIMD_sinh "
+.LASF115:
+	.string	"__INT_LEAST8_MAX__ 0x7f"
+.LASF2154:
+	.string	"newPacket"
+.LASF125:
+	.string	"__INT64_C(c) c ## L"
+.LASF1331:
+	.string	"DEFAULT_RX_TYPE RX_TYPE_MSP"
+.LASF1014:
+	.string	"__DECL_SIMD_asinhf128 "
+.LASF554:
+	.string	"__GLIBC_USE_LIB_EXT2"
+.LASF1327:
+	.string	"USE_UART6 "
+.LASF9:
+	.string	"__GNUC_PATCHLEVEL__ 0"
+.LASF173:
+	.string	"__DBL_DIG__ 15"
+.LASF920:
+	.string	"__DECL_SIMD_cbrtl "
+.LASF1650:
+	.string	"DEFIO_TAG__PC2 DEFIO_TAG_MAKE(DEFIO_GPIOID__C, 2)"
+	.section	.gnu.debuglto_.debug_line_str,"eMS",@progbits,1
+.LASF2184:
+	.string	"opflow_virtual.h"
+.LASF2227:
+	.string	"io_types.h"
+.LASF2215:
+	.string	"mathcalls-helper-functions.h"
+.LASF2207:
+	.string	"math.h"
+.LASF2196:
+	.string	"long-double.h"
+.LASF2206:
+	.string	"__locale_t.h"
+.LASF2217:
+	.string	"platform.h"
+.LASF2216:
+	.string	"mathcalls.h"
+.LASF2219:
+	.string	"target.h"
+.LASF2209:
+	.string	"libm-simd-decl-stubs.h"
+.LASF2190:
+	.string	"libc-header-start.h"
+.LASF2188:
+	.string	"stdbool.h"
+.LASF2174:
+	.string	"/usr/include/x86_64-linux-gnu/sys"
+.LASF2203:
+	.string	"endian.h"
+.LASF2236:
+	.string	"dma.h"
+.LASF2178:
+	.string	"stdint-intn.h"
+.LASF2173:
+	.string	"/usr/include/x86_64-linux-gnu/gnu"
+.LASF2176:
+	.string	"/usr/lib/gcc/x86_64-linux-gnu/12/include"
+.LASF2197:
+	.string	"stubs.h"
+.LASF2223:
+	.string	"build_config.h"
+.LASF2168:
+	.string	"src/main/target/SITL"
+.LASF2166:
+	.string	"src/main/io"
+.LASF1:
+	.string	"/root/repo"
+.LASF2213:
+	.string	"fp-logb.h"
+.LASF2172:
+	.string	"/usr/include/x86_64-linux-gnu/bits"
+.LASF2233:
+	.string	"bus_i2c.h"
+.LASF2192:
+	.string	"features-time64.h"
+.LASF2177:
+	.string	"types.h"
+.LASF2164:
+	.string	"src/main/drivers/opflow"
+.LASF2211:
+	.string	"floatn-common.h"
+.LASF2210:
+	.string	"floatn.h"
+.LASF2194:
+	.string	"timesize.h"
+.LASF2165:
+	.string	"src/main/drivers"
+.LASF2175:
+	.string	"/usr/include"
+.LASF2161:
+	.string	"src/main/build"
+.LASF2221:
+	.string	"sanity_check.h"
+.LASF2234:
+	.string	"rcc_types.h"
+.LASF2191:
+	.string	"features.h"
+.LASF2218:
+	.string	"common.h"
+.LASF2199:
+	.string	"typesizes.h"
+.LASF2162:
+	.string	"src/main/common"
+.LASF2182:
+	.string	"serial.h"
+.LASF2185:
+	.string	"opflow_cxof.c"
+.LASF2163:
+	.string	"src/main/config"
+.LASF2200:
+	.string	"time64.h"
+.LASF2170:
+	.string	"src/main"
+.LASF2179:
+	.string	"stdint-uintn.h"
+.LASF2169:
+	.string	"src/main/target"
+.LASF2208:
+	.string	"math-vector.h"
+.LASF2232:
+	.string	"bus.h"
+.LASF2235:
+	.string	"bus_spi.h"
+.LASF0:
+	.string	"./src/main/io/opflow_cxof.c"
+.LASF2167:
+	.string	"src/main/sensors"
+.LASF2212:
+	.string	"flt-eval-method.h"
+.LASF2181:
+	.string	"resource.h"
+.LASF2180:
+	.string	"time.h"
+.LASF2231:
+	.string	"sensor.h"
+.LASF2224:
+	.string	"debug.h"
+.LASF2201:
+	.string	"wchar.h"
+.LASF2228:
+	.string	"io_def.h"
+.LASF2214:
+	.string	"fp-fast.h"
+.LASF2226:
+	.string	"io.h"
+.LASF2186:
+	.string	"maths.h"
+.LASF2171:
+	.string	"/usr/include/x86_64-linux-gnu/bits/types"
+.LASF2195:
+	.string	"cdefs.h"
+.LASF2205:
+	.string	"locale_t.h"
+.LASF2229:
+	.string	"utils.h"
+.LASF2189:
+	.string	"stdint.h"
+.LASF2183:
+	.string	"opflow.h"
+.LASF2220:
+	.string	"stddef.h"
+.LASF2198:
+	.string	"stubs-64.h"
+.LASF2202:
+	.string	"ctype.h"
+.LASF2193:
+	.string	"wordsize.h"
+.LASF2230:
+	.string	"io_def_generated.h"
+.LASF2222:
+	.string	"common_post.h"
+.LASF2225:
+	.string	"parameter_group.h"
+.LASF2204:
+	.string	"endianness.h"
+.LASF2187:
+	.string	"stdc-predef.h"
+	.text
+	.section	.gnu.lto_.profile.2debbea79dd35116,"e",@progbits
+	.string	"(\265/\375 \0061"
+	.string	""
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.text
+	.section	.gnu.lto_.icf.2debbea79dd35116,"e",@progbits
+	.string	"(\265/\375 \253\245\003"
+	.string	"$\005\237"
+	.string	"\t"
+	.string	"\302\310\356\327\001&\002"
+	.string	"\002"
+	.string	"\002\001\002\002\003\002\002\002\004\005\002\005\002\006\002\004\007\006\002\007\001\352\263\360\321\b\002\240\342\234\212\n\003\004\005\311\375\337\271\004\n\002\b\002\b\002\t\002\n\002\013\002\f\006\b\235\200\372\225\017\002\t\224\213\235\201\007"
+	.string	"\r"
+	.ascii	"D\205)\275\267\036(\324<!\245\335\335\271\253F,E`&\001pf\327"
+	.ascii	"\214\234S0\300\002"
+	.text
+	.section	.gnu.lto_.ipa_sra.2debbea79dd35116,"e",@progbits
+	.string	"(\265/\375 '\325"
+	.string	""
+	.string	"h\033"
+	.string	"\003"
+	.string	"\001\003\005\b"
+	.string	"\003"
+	.string	""
+	.string	""
+	.string	"\005"
+	.string	".! "
+	.ascii	"\304}\tc\003X"
+	.text
+	.section	.gnu.lto_.inline.2debbea79dd35116,"e",@progbits
+	.string	"(\265/\375 \275\365\003"
+	.string	"2G\030#\220)\351\377p\345\377I\351I\224\255\353\243\234\007u1\025\"^\034\234\276\273|2\352\215\213~\343{\313\024?\177\350\246[m\235\003\344\004\374\221cm\333\274\341\036\324\202\021\331\363`\024\205\0042\230yli\335S\300,->\241\373\267m\272FK=\217\260\312\344R\025\354\2318K\244\016\302\337U\n"
+	.ascii	"]!RuC\327\301\231\030c\210Q`\002\271\231\001sV8\020\340\006\260"
+	.text
+	.section	.gnu.lto_.jmpfuncs.2debbea79dd35116,"e",@progbits
+	.string	"(\265/\375 \370\355\003"
+	.string	"\"\306\022\034\260'\303\001\254\020E\337\0051\f\205{f\355\336`\230\"K\020$\232\335\204l\231R.\3364\240\033>\2309\250\252\272\360T\261\021\b\215\320\t3\317\002E\324\263$\321\224v-\303\020\336\327F\317\216\344GZ\007\330)o\261\021\024"
+	.ascii	"h\220\b\360\206x\241\b\330\177\026A&7G\013\223\020!%0\270\250"
+	.ascii	"\246\034\200\013\200|`\230\315\023RYljX\225\240\306,m\003X"
+	.text
+	.section	.gnu.lto_.pureconst.2debbea79dd35116,"e",@progbits
+	.string	"(\265/\375 \016q"
+	.string	""
+	.string	"\n"
+	.string	""
+	.string	""
+	.string	"\003"
+	.ascii	"\232\004\005\231\004\b\230\004"
+	.text
+	.section	.gnu.lto_.ipa_modref.2debbea79dd35116,"e",@progbits
+	.string	"(\265/\375 r%\002"
+	.string	"\202\304\f\027\300%\303\030\377\377\377\377\277\376\377o@k\233\214\212L\026!D\312\024Wc\005\246\200\025\231\222\355\211\255:\323\263:VfjVeZ6\274\030\250P\020\005"
+	.ascii	"O\221\300]\264U\003\257i\341\006\260"
+	.text
+	.section	.gnu.lto_.lto.2debbea79dd35116,"e",@progbits
+	.string	"\f"
+	.string	""
+	.string	""
+	.string	"\001"
+	.string	"\001"
+	.text
+	.section	.gnu.lto_cxofOpflowDetect.26.2debbea79dd35116,"e",@progbits
+	.string	"(\265/\375`\210"
+	.string	"u\n"
+	.string	"v\223H? \345*\035"
+	.string	"\350\2343"
+	.string	"^\031Zo\353\340\2631%r\320P\263\024\216_\271\221\030\214\035\312k\330\2061\375`\306oFZ\352\301 \001\307.pm\2344\325(\006\021vRm\023\"\245L\0017"
+	.string	"5"
+	.string	"7"
+	.string	" \227h\250\036oxM\251\307\371t7\003`\031\251y\021?\224\275\205\024\216\230\002\221\345u\\\002\240\350L\367%\256v9\237\356\376\272D\017\375\247\377\035\376'\374:\020\327\231~\262\333\200\\o\201\177L-\223\374\3525\307\376\357w\367*\271\243U;\270\351\206\355t}\373dd\377Q\177\347\n\f\250\207:\232\300\032t-\232\200\3561+\217\240E\304}\3066\003\341\237\244\262\304\212\rk\t\334`\207S\276\252\350x\272\236|\222\276+I\352\2674WN\265\273\313\325n\315\220\277ic\325\245\374 \302\342T\007yBS\003\004a\232\024\241\321\004\247\b\264\020ET\200\240\322\005\350A\370\034M\224@\2149K`gl\345\330%\315\253f[\325P\206\324`\370\032\312\345\327\377\345\177T\034\017"
+	.ascii	"Z\b\030\325QK6\360\300\354\325\331\b|\261\261\327\303V9\302\252"
+	.ascii	"\022jA\027r\024\314\036\033\214\210k.PM\231\001"
+	.text
+	.section	.gnu.lto_cxofOpflowInit.27.2debbea79dd35116,"e",@progbits
+	.string	"(\265/\375`\251\001\225\020"
+	.string	"6\237oE\320R%\035\240J\241Tp\330w\177\020\236\177\360\324\274\207@_[\221\3274\211Pqt\335TN\023\3618\f\255\fJ\r\210,\306\345\211m\nF`\327`\006\232z8\020\370\342\352;\257\212\005Q\333{K\231R_"
+	.string	"X"
+	.string	"X"
+	.ascii	"EV\007\224ba\333\306v\031\001\212\215c\357\204xZ9\"@\314\b\262"
+	.ascii	"\333m\252\342\261G\3704c\376\315\243\272\240\252\262r\232\365"
+	.ascii	"\034\276\004F!\236^\263\017\317\325\004\204\366Fz\256\317\304"
+	.ascii	"\247\t\307k\246\363\004X\031\245\370\321sg\226\223\331J\331]"
+	.ascii	"\247lF\342n\335\266\005\333\006\354\004\020/\241\037\"\251\022"
+	.ascii	"Z\227;\224\236\260\236\006\3759\212h\264P\327\304+\205$,\235"
+	.ascii	"\034b\037\306\221j"
+	.string	"\374!k\230\311\313\016\375\231xx%\301\362\301\311\232\177\364\007\264\025\222\265I\304\356nR\203\354\277U \333\351\b\323\360\245\237\2463\323'A\351\202\364 P\333\345\251\0056\240\372O\257A\343@E\345\207,k@\372\020\342\037!\246n\367%\304\357~B|j\257\260\344eP\337\232\320\033\333\260/\265\224\b\355\256\002\277\363P\301\344jw\237\376\304\017\021\022N\326b\\\351edWg\201/\343I\027\336\207\016\r\303E.\036\302\233*\036\246\006\206\235\270p\035`+\0348\f.1\334\306\275l\031^X`6\230\314\314vR\300\\L\213\314\266\201\343d6W\267\177\253@\216U+\230\240\340\037\213?:\203\252\022LP\352\307b\324\035\333Q\235\202\2439Q\203\226n\3608p?\352R\246j\340\251\364T<\fp\345\243h\004\n\247\027Q\220&\302\022Z! \200\002\021\231\305\007\tB\337^\274q"
+	.ascii	"\235\361g\f\353q\\\f\004\252\341\\\254\305h\3138\033\031\n\r"
+	.ascii	"7\340\311\270\232\373\210m\033\255c\033@h\257\254\323\326\306"
+	.ascii	"\331\266iL\371j\2671\221\024B?Z\344\360>\212\032\221o;\2714\006"
+	.ascii	"\003\005"
+	.text
+	.section	.gnu.lto_cxofOpflowUpdate.28.2debbea79dd35116,"e",@progbits
+	.string	"(\265/\375`\306\r\305E"
+	.ascii	"*v\360\031?0bN:\313\021\255r\250\242t\005z\374\311\316@\004\305"
+	.ascii	"c\255\360\\\346k\236\317\206\202\026\362\325\322\242\002\b\316"
+	.ascii	"\275\310E\252\367\327\242\350\276Y@5\013:\\\021\232\346f\326"
+	.ascii	"\210%\204\354\235d\211\001r\001\224\001~\375DB\205S\233\376u"
+	.ascii	"\031|\316\214\206n\035\217\353M\367\341<N\330\373\332\317\025"
+	.ascii	"2]\016\341\303\263C\364\ny\245\032\207{\366\271\3368^WK8\373"
+	.ascii	"\275?\357\327{\021\273\335oBR\325_\323o\323\310\246$lv\374-\233"
+	.ascii	"\032\327\310\362 \252\341\236m:\253\352\253\351\3635\362l\023"
+	.ascii	"\332\036X\n7C*\215\356\260>\336\323\274\332H'aU\267\036\217\365"
+	.ascii	"e\243\276k-\334\324\270PT\365<\351S\214\372\2469p\253C=\341\236"
+	.ascii	"u&V\235\3723aG\343\343\031\204\372\212\255p\333cg\370\276\257"
+	.ascii	"\324\331\006\341\236=\\\323\331W\205q\367\355~\027\3662@\316"
+	.ascii	"|\3378<p\336\227:\325R\356\331\246\336\331\236u\317\324\236u"
+	.ascii	"\020!\254\245\247\316\245\025\311\260\230\2451|_*U\236\322J,"
+	.ascii	"=s\251\244LJ\"\217F\267\330\262k\306\322>\0024l\360\002\361\251"
+	.ascii	"\211\235I\367%\335\372\254\233\316a%\301\351\223*\031V\266ko"
+	.ascii	"O\302N\236lrd1C\2245'?>"
+	.string	"EYcr\343\372@\210a\223\244#3?\257\233\266a\227\311\333\260\341\342\032\365\206\007\311\005\247MV'\037)\204\220jf\270\025\234\272!\325\3120\273b\335\205\241;\242&d\315h\252t^\375S\335\364\t^\225jB\326'\3371\232Z\020\234_\375\372\305\r\221\335a\224\265\267\343b\206\367}\033\237\251\255\275\227\336\375\r\335\035\247;9%`\355T~\024<A\312\352\222'Z\304'n\315r-u\234\275\360\b\203`G\335?tD\355\307\241\347\364\234\354\224\254&\231\312\337{\001\374\334\375!\004\376\331T~\006\311b\335\037tB\321\276\225\036Q\002\377\354l\277D{\366\271\211\220m\f'\366\371\376\"z\211\202\271\317 4{\271\261^$\301W\253}\340\003\r\332\271g\377\034P\373\265g\337\347\007\234\361\034\353j\337w\026pc\324K\333\347=O\017\265,\301\2049,\\\220\257\367\347\030~\324"
+	.string	"p7\n\025\370g\013\362\333\340\310\262X\267\205\202M0\357a\341\213\037uS\305p\226\353\376\0022l\264t\216\353~\340?\342\200\277\210\377\375!\336\367\203\320\200\341\202\005\254\253\007\276+P\200Nx\231_\002\004\253\357\275\247\242\256\367^"
+	.string	"\365\344\304\375T\302}\240\211\333\300\022w\201%n\002K\334\003\226\270\005,q\007`\342\006\260\304\355\264\304\335\324\304\355\\\342n.q35q/-q3\227p/\227p+-\341V2\341NZ\302\235\\\302\215<\340\373\310\304md\342v\213K\334\355\377\336\354\373\336\353\363\336y\211\033+\341>\211\346\340[\023)Yr \352\233\226\b\351\335\303\366e\301\323\375<\327\023\366\300"
+	.string	"\375\\\243\302M\255\270g\227\370Lm\326\361\264\354"
+	.string	"*\231z\035\277\277\016oFfn7*O\310h\275\026\241\362\333\334D\037C\2637F\314\344\275\272P\371)\243uK\275\177\b7)0\250h\f'\032\343\314P\017\013\237\362\363&\344\367\261\371\177\0200\306\217\272Bg\030;f9i\"\3016\005tl\201\006\362\003\263\201\274\0262C\034#\220\013d\001~ec\310\374\f\310\004r\200?eu\031\004\344\001\031\300\242)\334n\232\032 wK\247H\351\360\317\004\344gY\026k"
+	.string	"9@f\323T\301j`S"
+	.ascii	"Y\002\341\035\251\177\360\027\003\327T\265\343\224\017\b\315"
+	.ascii	"M\331\311\231\233\256\340#F\234t\004\337l\225\231r3\263\177\312"
+	.ascii	"\336\2262S\026\214\246u\266\224#\320\225\361c\346\367\375\231"
+	.ascii	"\231J\031\231\227y\215\224\223Y)\277LKRV\346\233!66\303C\244"
+	.ascii	"[tH\271H\271\264g\223\262\221mAN\346b\0333\304\250\214\314\371"
+	.ascii	"\217\031bSU\016Ke\303f\244r\260\326\2301 /8\b\2311S\021\226\031"
+	.ascii	"\303\211\037\320\326&\310Mt7\277\256\245`\260\030\230\204~\""
+	.ascii	"~\245b\334\367}wd\002te\232U3\221\244d&\314\275\357\330\317 "
+	.ascii	"\201]8\373\350l~5\2706?\222*\231~\203(\210H\321\330\022\212\351"
+	.ascii	"\356\0377\004s\016\276\357\013\3553z#\351]\337\312\331\226\232"
+	.ascii	"\321\240\241=\233\200\220\255\315\212~V\310\3408\2679\027*{#"
+	.ascii	"\303\211\255\254z\031\024\245m\260\315r\355\346IV\271\344\277"
+	.ascii	"<.pX\304\007\016||m\331\210\202\351P\262\252J\300#\232B\353+"
+	.ascii	"\232\302\031\375\262\241\025#\001\363\213+G\316\372\016\026Z"
+	.ascii	"7\266V|\341\320\362\362\002\313J\372\322"
+	.string	"\342\312\212\236\340\241\205\303\030\375\212v\310q\343\253\330\017\"T\305\220\021\205Bh\340\024\375\212\306X;\253\201\214\256\036Y/xt\331\220\221\243\213\252k\213\n\307V\364\006U\226\327\016\252\006\004\272+\207\226\027\325WW\227\027\025\222\372>\307\345L\001n,\223\r\002\376\035\3675\345L\231\032rw\026\326\242\205\225\326\005c\271\302\205\225\246\3458\205\253P\341\302J\263Rd\200\347f0\230\353-<\205\013+m\356\354\001$a\336\356\326\334}\003\313ua\245\305\275\331\3418\351\232\217\344 \220\366\254\022\341\213\3609i\346\001\324\266T^\345^\257\262\006h\356\025\232\217V\271W\253\\\214\312\275F\3455\243\265r\205\3129\2435\237\347\f\243\031\007N\235R\226kB\254|e!C\227\360\373\\\310V\"\360\354\0041\344\250\214\366\352=H!c\366\006\237\317{M\242\220\241\332I\373\314\330\020\236\240*|"
+	.ascii	"\212T\n\376\331\023\303\035\310J:\266\352\217\204\300\354\201"
+	.ascii	"\212\262\202^\345\007\376\353\233\274\312}\254\220\261\240\271"
+	.ascii	"\217\020\262\005\253\334G6_\210\312}\234\2201d\264NB\345^\217"
+	.ascii	"O\231\302\223rY\232\275j2\313\365\233\323\240\"WQ\234\351a!r"
+	.ascii	"-^u\271\323c4\220\333\275\312\025\240\353\335\027\243Sn\027\232"
+	.ascii	"!X!\272\303bl\346v\2552\033u\264\273\013\201\"\250a,%\025c\210"
+	.ascii	"dF\224$I\222\016!\005D1\007\251+\017\021\240\261b\214$IR)"
+	.string	",\373\006\251\367\224E\312\225\315\325\250\3552\221\nW\177\316\007\302\322\344\207)\343\245\021<\220f;W\262pp\216_\214W\241\302E7|\272\034\246b\f\201E\252xmI\363:\257\325\324\245\027f\033x\361\351g\362`4C\223\353\210\320\3312[\244\374\007p\016\201$2\017:\003\022\335v\361\2702\306^\362\251\002G\271\017m\351DaB\216\222\363\251\245GP\242\215\276z\373KA\252\006\300O\247\350\024\254Y\225\337\240\234V\213\212\311\3479\244\230\275\344*\347l\275\363F\016\310X'FB\240\311\211\226\022 \005V\356\276[=\202\237N?\222\200\302\030Bo\025\004\254\030\034\262k\034nDt\252\031\323\024\375\234\370s\206\0327M\251\277\241?\t\f\255\241i\220\004\317xh@90\227v>\b\217\223\321\035\301\333\300#\b\213\264$O\224\332\306\217{\320B\303\315\327i\306\2267\235\n\001\021"
+	.ascii	"<\267\bRX\246\225\215\357\315Q\210K\230\221\037.\217?+\201\237"
+	.ascii	"\030[}\320\027\001\247\333L\355\335\002U\240"
+	.string	"z\013\1776\262\312lM\244\242C\311!T\b\371\234\204\273\274t\323\305&\304\221\305\274\006\n\361\237\th\374\327\216z8~Z'\222\255$\331\362<\026\254\225\253\330\274\336\211\314\022\267\224\0015\311\0071 \217\027\216!b\031\252\312\256]/\327C\260\211\244S\201>@\334\314\212\201\037\b\017G\340\003\334\b\313XY\364\220#"
+	.string	"\253eSS\306\374\032\222\315UT\305<\255\201\016+\210\033\303\375B\203\243\302\001\312L\200\252\316\364/U\002\033\026\332\031\242<\364\\\335\203Z\376\333\305A\211\371\315\300\377\b\346\242\037$\025#Q\303\3367\256\350`\303\235\222}:*\345\\\002\310\312\271\343\237\346p1\322?Pd\024v^\200a\343x!'\030\020\326\330\227Yn\364\262z\301\220_`\00402\346\246mS\3130H\016'~"
+	.ascii	"hId\276!!a\236\367\007"
+	.text
+	.section	.gnu.lto_opflowCxofVtable.29.2debbea79dd35116,"e",@progbits
+	.string	"(\265/\375 q=\003"
+	.string	"\264\005;"
+	.string	""
+	.string	""
+	.string	"*"
+	.string	"\005\001\212\001\202\200\200\374\342\303\317\362\003\177}\270\317\322\003{y\370\316\362\003{w"
+	.string	"?\202\210\200\030us\275\001q\274\001o\273\001"
+	.string	"\013/root/repo"
+	.string	"\034./src/main/io/opflow_cxof.c"
+	.string	"\003"
+	.ascii	"1I1\223\324\001\300\001"
+	.text
+	.section	.gnu.lto_.symbol_nodes.2debbea79dd35116,"e",@progbits
+	.string	"(\265/\375`p"
+	.string	"\r\006"
+	.string	"d\tl\001"
+	.string	""
+	.string	""
+	.string	"\002\034\177\027\260\314\273)\001\220\316"
+	.string	""
+	.string	"\177"
+	.string	""
+	.string	"\270\320\202\202\200\006"
+	.string	""
+	.string	""
+	.string	"\005\026\030\300\204\001"
+	.string	""
+	.string	"\003\005\031\031\030\032 \033\002\033\177\034\200\200\200\200\004\027\035#\036`\032\177\037\035 \301"
+	.string	"\001\"\177!\377\037"
+	.string	""
+	.string	"\200\220\200\002"
+	.string	""
+	.string	""
+	.string	"\001!\177\"\037\177#\036\177$$\177%%\177&\003"
+	.string	"\rd\003"
+	.string	"\f\311\302\353\343\003\001\204\n\003"
+	.string	"\013\230\314\300\005\001\304\037\003"
+	.string	"\n\244v\003\005\016\351\315\304\341\002\001\344\001\003\b\017\200\200\200\200\004\001D"
+	.string	"\021"
+	.string	"\225m\206\313\272\034\250\035"
+	.string	"\035"
+	.string	"\035"
+	.ascii	"]\037\360\024\026\f\227\020X\256i950\007n\013\202\227`4\220\233"
+	.ascii	"\230\025="
+	.text
+	.section	.gnu.lto_.refs.2debbea79dd35116,"e",@progbits
+	.string	"(\265/\375 cu\002"
+	.string	"\362E\021\033\240\031\322\030\217\277\020"
+	.string	""
+	.string	""
+	.string	" \004\200\215x\315\234\233\177z\347\331,!{\313\024\223\241C\202Z\200\235\035\320\236\255\tL\200\246<\331%\021\332\220\262\216\272Q3\352EYQ'jD\355\201\326@\0276\341\217\001"
+	.ascii	"\206\240@\001"
+	.text
+	.section	.gnu.lto_.decls.2debbea79dd35116,"e",@progbits
+	.string	"(\265/\375`\033\035e\206"
+	.string	"\272\332h0O0\220\322\351\224\330O\236\005\334\255\315\214\273?\201{\004\214<x\373\301\217\366\252.CI\352_\202\362\b)%=P\021\206\024\342\222\002S\263"
+	.ascii	"#\363\265\264\233\007\261\347\023\273\027\333u5\376\272t{(\265"
+	.ascii	"\205\267\007\017\002\203%{l\231R\n\245\002\362\002\363\002\335"
+	.ascii	"\037\3037\237\307\313\360\317\207\372\037\017\303/\377\351\201"
+	.ascii	"\274\323;\277\351w\274\217\357\341\322g~\356O>S\377\2649/s\316"
+	.ascii	"\355r\335@\375L?\343\177\267\212\023_Q\372\320\313\271\r\363"
+	.ascii	"L\027\343c`0\235yie\257\004sm\210\324_\316\355\002?\013,\240"
+	.ascii	"\356XR\203\235\002j\177\032\274"
+	.string	"\346\271\307\013lSV\005/\207Ve\002\006M\t\033_\323\346\237\225J\335\021\2677\334\277\206w\332@i\243\306\f\253M\314\256\366\374\034\r\221\273\257\030\250\340~(8\007\312\224/\201\257z\237\363\251R\350\016O\217>#t\257\366o\341\376+\334?\004\3677\341\376\214;\370\341n\037\223\303MT\2114o\256G\330\346\253\256\b\031|\200\027\334\276\206\333\311\260{q:\227\232\360\272v*\016\3268\3136\213\341\334\365\315PF\005\267\233X{\334\304\332\276\004\253\230s\237\325\341\324\035Z\264\034\211zk\267\225nJ\036{\325\335z\270\316\274\030y\325\325\234K\340\031\034\333\253\256\305\327\\Z\302\331\332\267x[\3370\265\271\375-6fa\257vp\237\365\237p{\211\365\006\006z\211\265}\211[\tw\353 V\317\302\363\205\025\366\365j\203\200\333\245~\003\226  \025\r\355\225v,MF\230\263\224\234\363"
+	.ascii	"7\231\203\223\261W]\314\315X01\031{\325\245x\331m\372\200\346"
+	.ascii	"\262\234[\017\227\307\0243h\257\272\025\037s)\001N\326+\\\364"
+	.ascii	"MJ[)9\267=\302\247\247-\350\253\335\001\356@'`\365\260f\363'"
+	.ascii	"NY\370^\3553\235\247\323V\303\225\334\253\302\240\366*-B\232"
+	.ascii	"]\364\007\334\217\017p\237U\235\266\356\263b\007\261v;V\267g"
+	.ascii	"u\373U\267\037\241\262\362\240\273\353\272]I\\\267?\t\352\366"
+	.ascii	"\026\335\376\300[\267;\320\3551\334\255\333\013\370\352B\205"
+	.ascii	"\313\b\335\316\326\335\0038\003\335~A\267\327\350v\f\272\235"
+	.ascii	"F\267k\320i\272}\255\333o\254\350\276A/\323\322\355D \335\036"
+	.ascii	"D\315Ix\216\350\276\t\240\245\345\356\306\351\276,\272}\332\355"
+	.ascii	"f\335\016\326\355R\272\275\253\333\243\335\256\325\355R\335."
+	.ascii	"\244\333\177t\373\263\333\235\272\235G\2677\273\235\331\355\312"
+	.ascii	"n/\241\333\213\335\256\243\333!\350n\033\335.\242\273\373\272"
+	.ascii	"\333\257\273\341\272\375\330\355(t\273\261\333\221\272\335\250"
+	.ascii	"\333S\350\366\017\272}\202n\227\240\333#\350v\003\272}Dw{\320"
+	.ascii	"\355?\335]\242\273\337\272\373&000\260\373et\337\220\350\006"
+	.ascii	" Iy'/\231|(\257\240B\246\022\nCvR\304\237M\261+(P\332\230X4+"
+	.ascii	"\333\244Gs\030+'\026K\266\271\331\267\343w\366\345\357\3257\363"
+	.ascii	"g\\\332o\217\246y\304X!\323\004\f\356\027\274\337\326\347\343"
+	.ascii	"A\323\343L\233\032\376\275\276LA\342\320\364\340T\266g\336^\231"
+	.ascii	"~2\177\006\305\213L\333=\324\271~\231.\343\362L\354\244\271"
+	.string	"Sz\341\215q>\255\262+?\346s`\303w\206\371\252\230\346\224\017\250W{\005\303_\036\314\327=\335\337\275\235K?\314\317\265J\325\345\317\323\274\034\2322O\357\271xI\023\346q\300\323\373&n\035\262\262\256L\230\177s@\236d\233\237 \230\353\243\362\312\271\375q83ci<j\257O\270o\326\340\276)\363q.F\246\245\206\013~\270\316;:X\3232\2461\3347Np\337L\341\346\342>m[r\322\314\362\252^e\323\271\2222\277\274\3327N\270Y\250\375\364\271xnr\206b\211\252}\330\233\371\\\231\032\345\312\332k\3714\227\276\332g\351?{\264VY\250\375\225\277\201g\331\346g\216\226\023\214\023L\245\214\030;\254\266J\207\035\352>k\b\225\rc\351i;S55\303\255\202\341~\263\356\227\272\334\227=T8]\303\f\362\352[\3711\2276\333\223\271V[R\313\006\274\024l\266\325\267"
+	.ascii	"\365\213\335\351\026\346\232-,t\020UF\004mH\253\312j\373Me\302"
+	.ascii	"\266,\002F%\353\254j\311\253?\345\247g\213\2173d\257\266J\205"
+	.ascii	"\333\333\222<\027O\0029C\363\242,\242c\234\244q\241\304\001y"
+	.ascii	"n\316Tx\321\"V\016\030\345\357\257\272\336\310\037\361\271(\031"
+	.ascii	"^e\364r\316Q\336\353m\370'"
+	.string	"/\345\241\374\227K\277\253\237\311O}\223&\330w\275\326s\361<\333\354\fr\315\321A\375\345\234y\334\372\256\274:\250}\001q\227-\351\306\311\211\363\223\212\366\341\276x\270/\030\334\027\007\3745\374\226KG<\022\276#\312g\033v!g\037\261z`\240\217X\373\242\341\307\372,\227\376<\rN\247t\"R\206_\310\201\376\263\366m\261\212\033\005\303p\037h\025\013+d\226\257\366Wu\377\fO\345\200&\210\350\301\303\272\202\303\253=u\2375\307A\254?\005\324O\004\304\352\214js\217\316R\206+I^\305\351\037B@O\033\244\311\210\324G\021\201f\265\217z!i\314\2368_\r\3426\005\023}\265/\027n\227#3\004-\315\343\236\302j\320\003\273\243\212~\251\212\312\315\271\035\317\262C^^\035\211\202\351=\205\301\3631=\352\246\362\274\214T\336\236\233\251kZ\341\342\231\236\306\001o\033\r\222]\365"
+	.ascii	"R\343\201?\2241\240M;\217Y\267\345R^\3515\245\3653\030L'\016"
+	.ascii	"T\035\027\016`\334\216,l\206R\256\332\\4ON\204|\365\225\002\230"
+	.ascii	"#C"
+	.string	"\027iV\024\23494h\312\242@\271\\\234\336\266\324!X\326\272\244a\237\314\204\311\355\n\221\266\267\005\227S\007\305G\367\244oW\263\3350\361\314\320\275z\235`5f`v\257\336&\3017\271\253\252fS\201\244}\305!\301!r\b\332\352\255\033ui~Z\303\322\f\231\376\345\034e\002\247\251H\225!\257\244o\324\355\204XuH\256n\022a\233\314d>\t\027\016\037\336\230e\020\036\345T\224\206\213\344\263\220\nk\b\030!8DT\220C\361;\325.\275SW\353\246\2313\224\f-m\324\211\035\031\332\304\240y\365H\230\0277\277W\033'\211\251n\025\331^\226\233\227\325\275\032@\331\314\252Y2\313-\353\322p\215\270\364b\335\"}\211\334\031\372\007\353Bo\225\317E\265\031j\005\343%\313M\030\265\373*\202\325\356{u\2251@\243\316\316pc/\334x\t\256\272O\n\370|`!\301\376\203\2470"
+	.string	"L\244\244\356\023\347\234\203O-\346\201{\256\004\365\005\002\344\n\301"
+	.string	"\232\241d4\321\353\243\372\313\231\310\t\234\265C\314\224\033\304\307\332\260\265W[\261\020Q68\275\3328\343\017{A}\177\374\3701=[sg0"
+	.ascii	"G\256\363:\357sI\237\351\373\304Y\322\344\312\307\035\366\221"
+	.ascii	"\013\272=\3746\335\345uz\277\t\224\315\314d\325\302\206\334\206"
+	.ascii	";8\346\267\202x\006\365\345!\275<\276\3526\325)\016z\331\351"
+	.ascii	"<\321A0\f\202HP\337\246Ko\263\331\3246?\203M9\237\350\340\023"
+	.ascii	"\374\341.\350.\3752\245\227\371Q?m\206\322\0313u\266':\210\004"
+	.ascii	"\267\177\324\352#\r\372\277O\323\017\330\200W\351Q9\271\247\342"
+	.string	"I\224\323D\367\267\351\253\274I\036/&}F^\275\311\277\3712\365M~\240p\331\336\244\352$x\334I\334\260q1\205\255j\007\263p\237y6J\270\374Y\261\3715x\323\036\231-\357\260=\265t\275\232\317\342}iw\322W;\b\004\367w\257\031\352\246\315S\245\260\375\246\335D\367\216_G\240\273\325|\273\013\340 \347\244\231\250\231\325\315J\210\231\003r\316I\250\323C\263\025\263r6\227VB\274)f\365l\212Y%\277\t\307\364tf\253$\316\320'n2\345,\006\315O\235\326*\347\326*\211[&g\316\231\311\233\255\025\324Csi\365\364\246Xv\346ev~h\346\374\314bV{\336\314V\316\246\030\364\351!/\277\360\232~\200O\227\233#\233\222l.\263S"
+	.ascii	"^K\250s\256\331B}\232s\262\214\231\235V9\023\201\222\230.\223"
+	.ascii	"$\247\3129\247`\324\262M\272T\223\362\n"
+	.string	"\212\323*\363\\\323\t4\0073\3470\271\251E\322\2230de\322sf\266\316\234\225P\023\242\240n\007\20338\212EH\306\031DH\305\242\020\036 \021\223\214<\235\003\005\322x\034*\036\255D\303\234\316\201\002\231\203\035\036\245@2\036\035\031\207\002@*\016\217,\022\3118\204\203\003\251\310\026\207  \211,\013\024,\325\350\034(\204N(\255H!\243\241\022{,\352\360!Z\331\"RQe?(2.\315\350\300\016\021Yb\005H\034\266\210\224\001\017\217\n\024\310\033H%cQ\007\361\230\324a=\2624N\300\301FF#\005B7DvH\224t\243\203\016=T<\022\221\2108p\267x\321\300\013\030K\301\206\021CE\f\025k\303\210\001\004\024\343\005\020\356\027@\227\025B\336\300D!\013B\260\037\214E\021,\034Y\342\021\321\210\310\212@\n\341(\026!\031g|H\0019\334`\bI\251HH\024\312"
+	.string	"\200$\344\0212\t\207\207%\"\021R\006Dvx\0242\032\036\2119\222\212Gb\322\017\233"
+	.string	"\013l1\210\024\022\262B\025\020\217\212\254\016\361\250hc\310\032\021\211pV\030\326\320a\205X\032\302>\022Y\243\261h%\"\24604LZ\217D\242!1\307\252\002I<\252!\004EXm\030\217\202FC%\025\2207l\347@\221\002y$\352(\036\211\006hc\022\361\230\2025\032\217)tX$%\343\f\025\216\031,\035s\220B\302\017\330\243\221F\007\242\321\tC\033:\326#\261XTd\221\210D\305\034V\210Hd\334 \207Hd<RY\241\016\330\2431i\007\211d,\262I\306 \221\035\326 R\032\236\200\211-\024=\300,>\n\211\206D\fX\241\025,\214\212C\033GbQ\221\022\005K\254\360\310\322\370a\205^"
+	.string	"\341\234!;\254`\351\310sdi\020u\024\211C\304\032F\303\342\221\210$\200\025\202\301\"\025\225\202\315\302\205\n\242\242!\214\026(D\264\003\016\3148\340\006\007\027\340!\024E\306\245!\241\025\214FEI\306\024\306b\n\244\342\360(\305\320\021\231\002\205"
+	.string	")\f\rO02\032\316 \036\r\217\026,\035{\344\2429Ql\222\304\305\335\256\253\025\270\326\007\367~9]P\236\260\2759\340\327\305\371P\272IYq\027m\352\002\206\245M\330\374x\365n\271/\254\311\231\351n\371\313\345\266\365\335\322\356$\334I\364\004\303x5\231\326\266l\311\236\337\232\231;\233\350\301i\021\"\244\322\332q\247\326wJ\366\007&\365j\b(\026,w\372\003M\362\265\320\242\267S\003\220$0\334\320w\212\266\343\327#\355\356\321\316\340n\350\361E\fV\233.e\262\374\234"
+	.string	"y\315,\337'\314\342e,\313\253\235\323\204CT\251r\315~\240\311=\031m\320>*\016\234~\300\335\262\276f7\n\227\f\317(\257^\262\227\353Qk>y\365\216}\237\016\224\033\326\002_\275V<\016O}\005\232y\365\212u\336\216t\212\0275\257\3360\267\0132\323\246@^\275R\377\213@\214\023\215\233\321\371\242\003\f\323\006\373tQ\241r\301\310\226(\t\242\222\201\305@\344U\260\367S\245\3328\301\202\303>P/\257\033\202Y\250\022\331<\211\362\2242\b\241\031\231\031m\222tb\n\020\b\343a \271\322\003\022"
+	.string	"51\020J\313\204f\222B\246\375\016\362}\263h\311L#O\0270&\303\303\370\030Y\032\322>\234\321\017\314\200;/1\276\310\3028.SR3"
+	.ascii	"\314\241\0269\310\323\361\206\323!?\323\244.\025(\272\230ho\254"
+	.ascii	"\267b%\016\246\224X|\334c\304\201\364\024\205\340\303G\230m1"
+	.ascii	"\266.V\032\007d\302ERr\022\322\204\305)\325\305\277Kp\212\\\217"
+	.ascii	"\r\347vdLS\275e\263\356\340\260;U\345\337J\205(:\202z\257\312"
+	.ascii	"\310G\221Y?@\246\365;C~v\321t\336\346\263\022\252\262\331\336"
+	.ascii	"\251 \375\013\261\205\313)h`0\314\321\375d\354v\213\013\374\242"
+	.ascii	"\360\007\264\0344\031\372\270=\017\241\257I\360\034\031rlB\333"
+	.ascii	"\t\200a\340\022\366\342\024\021\030\231\207M\267\007\310\261"
+	.ascii	"\342\213\0057\032\3461\220\303\007\230\t\350\374\332<\242E\206"
+	.ascii	"\360\031\322\"(\200\264\360\003q\256W\325\t&IQ\210\002\266\310"
+	.ascii	"\257\314\002\355Q\200\026\270^\333\304\026\272RdVSO=\300\342"
+	.ascii	"i\311W\354\312\300\270cbd\001\353n\370\036c\35439<\312\300\225"
+	.ascii	"\330\304"
+	.string	"C\003\323q\350\"\351T;\367\356?Z=X\366\021\377i\260\313:%\277~\373\363`\210\2211\331\214\242\215\331\006-\367\216\r\266\210\3226\303\203e\373\230x\323Ubv\r\221\360F#m=:Z`\270\233\361\300\210\rP\201\337\266\366\255p1\353*O\302\240\251\026X\366G\357'\341\373\305\203\004\363\260z\330\300R\007O\335\260\2761\232\335\250=\362\352\321 \3374U\030\3327.S\022\366\235\307rCg\331\373i\253L\215\372\323ikA\306\221\2458\376\214t\301\263\037\204\356\220\320\3314\226cP\2268\007\325\307\222\324\023\376\203K\200\331\260\341[\0364%$\020\035\344sM\002\225\332+>\213\262\344\322q\241\331\365\351\252\241u\341\3612\375K\340\225\212\227\353\003\320Q\027\004kW\003+C\305e9\326\236\034\271?]\324\020(H\376i \356\277I\215\230\312\233\244\275\3216\007A\333)\303\224"
+	.ascii	"\251\354\007\036\030\024Q"
+	.string	"c$7\321#S\211\242\017\305\356/\340/\367f$\027\327\017\017\234|\2628\f\242cQ\342c\304\306\331\307U\267q\240q3~\300\\\274\326!7\366h\033#\005\342\341j7\221\007\377\262[\365\036\350\247o\366=\213@H\311c\202C\354\334\215\261\210\221\314hf[8U\331|\013\202\274n\322om\265\237\3318\237\327J\253\265\245\203n\230XS4\"0Gj\206G\360(\343\032\250\007\250\367\202\336\032\371L\373Q{\234\252$\3077DE\212\030\300W\2211\345\005\335\227D@\352;\004\017\336\333\025x\376\305\230\312\032]\315P\024\245\331\275\246\2208g\211\263k\207=\341,#4\3172y\210\217/\302\210~\001\206;\200\2207\031\036X\242Bt\307\005M\005\"f\007\3568vcV<'\334\034\376/1\370\273\3613\216\250{H\323\220\243\001\356\"vx\237\037\205\337\360\312\353\301\262\262\260\347\321"
+	.string	"\305tn\371\241\005*\035\177"
+	.string	"\270y\r\332\303Z\002\244\330jY,u"
+	.ascii	"k\031\236G!\370\252[\0028"
+	.string	"nN\002\240\337\207\342]r\n\025\335\b\3400;\245\002\267\022\246OW\005-5\263\202\245\347\226\f\220\354\002\023\t\303\375\205\230\226\354\233\"\372\220\242\204e\002iy\203\230\030\326\245\003\273\3112\221Cy\3462\r\220\337"
+	.ascii	"\302\337\361\002\304Ia\002u\275\241\203\307\234\237\021\307,"
+	.ascii	"\341s\370,\034\031-\344[\227F?y\026\257\272\353\027\003\3209"
+	.ascii	"\0251\351\354\213\331~\303\241\210\\^\306\200;\002a\013:\363"
+	.ascii	"\335x\001\246\016\3525\b\237\232\030X\227h\016\221\321,c\260"
+	.ascii	"\224\254\320\326\373^\031\362\321\223\201\201\315HS\356KM\311"
+	.ascii	"\344s\025\321\016\230\177-\320\367\343\206\350\035{\216Y\240"
+	.ascii	"\270\353\246@@\220\\YJwM\244-\340\273v.j\327\034(\016\224@n\231"
+	.ascii	"\254\274\026\302\017\024S\2106J\271\272\371\266\242k\237\357"
+	.ascii	"\234\234\341u6\317\213\032\363\007\275\352\277NO\351\030!\330"
+	.ascii	".\260\240\347\022t\217a7\033<'\376\276\254GJ+\234s:\257~\317"
+	.ascii	"\245W\232\363x\366\177*\257\352\277\271\245X\3361r\037\007\315"
+	.ascii	"?\214\351\322\b\354P\311\357\374K1\370\340\250V"
+	.text
+	.section	.gnu.lto_.symtab.2debbea79dd35116,"e",@progbits
+	.string	"opflowCxofVtable"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\251\001"
+	.string	""
+	.string	"baudRates"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\227\001"
+	.string	""
+	.string	"serialRxBytesWaiting"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\260\001"
+	.string	""
+	.string	"constrain"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\266\001"
+	.string	""
+	.string	"serialRead"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\274\001"
+	.string	""
+	.string	"micros"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\277\001"
+	.string	""
+	.string	"openSerialPort"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\311\001"
+	.string	""
+	.string	"findSerialPortConfig"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	"\320\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.ext_symtab.2debbea79dd35116,"e",@progbits
+	.ascii	"\001"
+	.ascii	"\002"
+	.string	""
+	.ascii	"\002"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.ascii	"\001"
+	.string	""
+	.text
+	.section	.gnu.lto_.opts,"e",@progbits
+	.string	"'-fno-openmp' '-fno-openacc' '-fPIC' '-fcf-protection=none' '-g' '-mtune=generic' '-march=x86-64' '-O2' '-Werror=switch' '-flto' '-fuse-linker-plugin' '-ffunction-sections' '-fdata-sections' '-fno-common' '-fasynchronous-unwind-tables'"
+	.text
+	.comm	__gnu_lto_slim,1,1
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits